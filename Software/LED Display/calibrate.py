@@ -0,0 +1,101 @@
+# Make the calibration.bin of core/Calibration.h from measurements of the
+# leds, for the LittleFS of the config files or the root of the SD card.
+#
+# python calibrate.py sheet leds.csv
+# python calibrate.py build leds.csv calibration.bin [--white 255,230,210]
+#
+# sheet writes every voxel (as drawn, orientation 0) with its led and channel
+# and empty red, green and blue columns. Light the voxels one die at a time at
+# full level, with gamma and brightness at 1, and fill in what a light meter
+# or a camera at a fixed exposure reads, in any unit. Rows left empty keep
+# the led as it is.
+#
+# build evens every color out to a low percentile of the leds, so no die has
+# to be driven above its full level, and masks the dies reading below a
+# fraction of the median as dead. The white point scales every gain of its
+# color, for batches that are all too blue for instance.
+import argparse
+import csv
+import struct
+import sys
+
+CHANNELS = 32
+LEDCOUNT = 128
+
+
+# The wiring of Display::setupMap() for orientation 0
+def wire(x, y, z):
+    led = 0x7F - ((x << 4) & 0x30) - (((0x10 - (x & 1)) ^ y) & 0x0F)
+    if not z & 1:
+        led = 0x7F - led
+    chn = ((x >> 1) & 0x0E) + ((z << 1) & 0xF8) + ((z >> 1) & 1)
+    return led, chn
+
+
+def sheet(path):
+    with open(path, "w", newline="") as f:
+        out = csv.writer(f)
+        out.writerow(["x", "y", "z", "led", "chn", "red", "green", "blue"])
+        for x in range(16):
+            for y in range(16):
+                for z in range(16):
+                    out.writerow([x, y, z, *wire(x, y, z), "", "", ""])
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+def build(path, out, white, low, dead):
+    readings = {}
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            if not all(row[c].strip() for c in ("red", "green", "blue")):
+                continue
+            led, chn = wire(int(row["x"]), int(row["y"]), int(row["z"]))
+            readings[led * CHANNELS + chn] = [
+                float(row[c]) for c in ("red", "green", "blue")]
+    if not readings:
+        sys.exit("no measured leds in " + path)
+    entries = [[255, 255, 255, 0] for _ in range(LEDCOUNT * CHANNELS)]
+    masked = 0
+    for c in range(3):
+        values = [r[c] for r in readings.values()]
+        cutoff = percentile(values, 50) * dead
+        target = percentile([v for v in values if v >= cutoff], low)
+        for i, r in readings.items():
+            if r[c] < cutoff:
+                entries[i][3] |= 1 << c
+                masked += 1
+            else:
+                entries[i][c] = min(255, round(255 * target / r[c]))
+    with open(out, "wb") as f:
+        f.write(b"MCAL" + bytes([1, *white]))
+        for e in entries:
+            f.write(struct.pack("4B", *e))
+    print("%d leds measured, %d dies masked" % (len(readings), masked))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    commands = parser.add_subparsers(dest="command", required=True)
+    p = commands.add_parser("sheet", help="write the measurement sheet")
+    p.add_argument("csv")
+    p = commands.add_parser("build", help="make calibration.bin")
+    p.add_argument("csv")
+    p.add_argument("out")
+    p.add_argument("--white", default="255,255,255",
+                   help="white point red,green,blue (0-255)")
+    p.add_argument("--low", type=float, default=5,
+                   help="percentile every die is evened out to")
+    p.add_argument("--dead", type=float, default=0.2,
+                   help="fraction of the median below which a die is masked")
+    args = parser.parse_args()
+    if args.command == "sheet":
+        sheet(args.csv)
+    else:
+        white = [int(v) for v in args.white.split(",")]
+        if len(white) != 3 or not all(0 <= v <= 255 for v in white):
+            sys.exit("--white takes three values from 0 to 255")
+        build(args.csv, args.out, white, args.low, args.dead)
@@ -0,0 +1,88 @@
+# Choose where the code of src/ runs from. The Teensy 4 core copies all code
+# that is not FLASHMEM into ITCM at boot, which costs RAM1 in 32K blocks that
+# DTCM no longer has. Set custom_code in platformio.ini:
+#
+#   itcm    all code in ITCM, as the core does it
+#   hot     only the functions listed in itcm.txt in ITCM, the rest of src/
+#           runs from flash through the 32K I-cache
+#   flash   all code of src/ from flash, to compare with the itcm build
+#
+# The functions are moved after compiling by renaming their sections
+# (-ffunction-sections) from .text.* to .flashmem.*, which the linker script
+# places in flash like FLASHMEM. FASTRUN code is never moved, libraries are
+# left as they are. A line of itcm.txt is a pattern of demangled function
+# names, or @ and a pattern of source files for all of their code;
+# itcm_select.py writes it from a profile and a trace.
+Import("env")
+import fnmatch
+import os
+import subprocess
+
+MODES = ("itcm", "hot", "flash")
+# Prefixes of -freorder-functions in front of the mangled name
+PREFIXES = ("unlikely.", "startup.", "exit.", "hot.")
+
+mode = env.GetProjectOption("custom_code", "itcm")
+if mode not in MODES:
+    raise SystemExit("custom_code is one of %s" % ", ".join(MODES))
+src = env.subst("$PROJECT_SRC_DIR")
+tool = env.subst("$SIZETOOL")
+
+
+def patterns(path):
+    names, files = [], []
+    for line in open(path):
+        line = line.split("#")[0].strip()
+        if line.startswith("@"):
+            files.append(line[1:])
+        elif line:
+            names.append(line)
+    return names, files
+
+
+def functions(obj):
+    out = subprocess.check_output([tool.replace("size", "objdump"), "-h", obj])
+    sections = [line.split()[1] for line in out.decode().splitlines()
+                if line.split()[1:2] and line.split()[0].isdigit()]
+    sections = [s for s in sections if s.startswith(".text.")]
+    mangled = []
+    for s in sections:
+        name = s[len(".text."):]
+        for prefix in PREFIXES:
+            if name.startswith(prefix):
+                name = name[len(prefix):]
+        mangled.append(name)
+    out = subprocess.run([tool.replace("size", "c++filt")],
+                         input="\n".join(mangled).encode(),
+                         stdout=subprocess.PIPE, check=True).stdout
+    return zip(sections, out.decode().splitlines())
+
+
+def relocate(target, source, env):
+    obj = str(target[0])
+    rel = os.path.relpath(str(source[0].srcnode().get_abspath()), src)
+    names, files = hot
+    if mode == "hot" and any(fnmatch.fnmatch(rel, f) for f in files):
+        return
+    renames = []
+    for section, name in functions(obj):
+        if mode == "hot" and any(fnmatch.fnmatch(name, n) for n in names):
+            continue
+        renames += ["--rename-section",
+                    "%s=.flashmem.%s" % (section, section[len(".text."):])]
+    if renames:
+        subprocess.check_call([tool.replace("size", "objcopy")] + renames +
+                              [obj])
+
+
+def place(env, node):
+    if not node.srcnode().get_abspath().startswith(src):
+        return node
+    obj = env.Object(node)
+    env.AddPostAction(obj, relocate)
+    return obj
+
+
+if mode != "itcm":
+    hot = patterns(os.path.join(env.subst("$PROJECT_DIR"), "itcm.txt"))
+    env.AddBuildMiddleware(place)
@@ -0,0 +1,139 @@
+# Pack the firmware for an update over WiFi, see src/core/Firmware.h. The
+# Intel HEX of the build is cut into blocks of BLOCK bytes, each compressed
+# in the LZ4 block format, or stored when that saves nothing. The .mcfw file
+# is the header and the blocks:
+#
+#   "MCFW", uint32 size, uint32 CRC-32 of the image, uint16 BLOCK, uint16
+#   blocks, then per block uint16 length (bit 15 = stored), uint32 CRC-32 of
+#   the decoded block and its bytes
+#
+# all little endian. It is written next to firmware.hex after every build
+# (extra_scripts = post:firmware_pack.py) and sent to the ESP8266 with
+#
+# curl --data-binary @.pio/build/teensy40/firmware.mcfw http://MegaCube.local/firmware
+#
+# python firmware_pack.py firmware.hex [firmware.mcfw]
+import os
+import struct
+import sys
+import zlib
+
+FLASH_BASE = 0x60000000
+BLOCK = 1024
+STORED = 0x8000
+# The LZ4 block format ends on literals: the last match starts 12 bytes and
+# ends 5 bytes before the end at the latest
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MATCH_LIMIT = 12
+MAX_OFFSET = 65535
+
+
+def read_hex(path):
+    image = bytearray()
+    upper = 0
+    for line in open(path):
+        line = line.strip()
+        if not line.startswith(":"):
+            continue
+        record = bytes.fromhex(line[1:])
+        length, address, kind = record[0], record[1] << 8 | record[2], record[3]
+        data = record[4:4 + length]
+        if kind == 0:
+            offset = upper + address - FLASH_BASE
+            if offset < 0:
+                continue
+            if len(image) < offset + length:
+                image.extend(b"\xff" * (offset + length - len(image)))
+            image[offset:offset + length] = data
+        elif kind == 4:
+            upper = (data[0] << 8 | data[1]) << 16
+        elif kind == 1:
+            break
+    return bytes(image)
+
+
+def count(n):
+    out = bytearray()
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return out
+
+
+def sequence(out, literals, offset, length):
+    token = min(len(literals), 15) << 4
+    if offset:
+        token |= min(length - MIN_MATCH, 15)
+    out.append(token)
+    if len(literals) >= 15:
+        out += count(len(literals) - 15)
+    out += literals
+    if offset:
+        out += struct.pack("<H", offset)
+        if length - MIN_MATCH >= 15:
+            out += count(length - MIN_MATCH - 15)
+
+
+def lz4_compress(data):
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    limit = len(data) - MATCH_LIMIT
+    while i < limit:
+        key = data[i:i + MIN_MATCH]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None or i - candidate > MAX_OFFSET:
+            i += 1
+            continue
+        length = MIN_MATCH
+        end = len(data) - LAST_LITERALS
+        while i + length < end and data[candidate + length] == data[i + length]:
+            length += 1
+        sequence(out, data[anchor:i], i - candidate, length)
+        i += length
+        anchor = i
+    sequence(out, data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def pack(image):
+    blocks = (len(image) + BLOCK - 1) // BLOCK
+    out = bytearray(b"MCFW")
+    out += struct.pack("<IIHH", len(image), zlib.crc32(image), BLOCK, blocks)
+    for i in range(blocks):
+        block = image[i * BLOCK:(i + 1) * BLOCK]
+        data = lz4_compress(block)
+        length = len(data)
+        if length >= len(block):
+            data = block
+            length = len(block) | STORED
+        out += struct.pack("<HI", length, zlib.crc32(block)) + data
+    return bytes(out)
+
+
+def pack_file(source, target):
+    image = read_hex(source)
+    packed = pack(image)
+    open(target, "wb").write(packed)
+    print("%s: %d bytes, %d packed" % (os.path.basename(target), len(image),
+                                       len(packed)))
+
+
+try:
+    Import("env")
+
+    def firmware_pack(source, target, env):
+        hex = str(target[0])
+        pack_file(hex, os.path.splitext(hex)[0] + ".mcfw")
+
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.hex", firmware_pack)
+except NameError:
+    if __name__ == "__main__":
+        if len(sys.argv) < 2:
+            sys.exit("python firmware_pack.py firmware.hex [firmware.mcfw]")
+        pack_file(sys.argv[1], sys.argv[2] if len(sys.argv) > 2 else
+                  os.path.splitext(sys.argv[1])[0] + ".mcfw")
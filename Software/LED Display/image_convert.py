@@ -0,0 +1,74 @@
+# Store the SquareLine images of src/gui in the cheapest format LVGL draws.
+# SquareLine exports every png as LV_IMG_CF_TRUE_COLOR_ALPHA, RGB565 and an
+# alpha byte per pixel, which LVGL blends pixel by pixel on every redraw.
+#
+# - no transparency at all: LV_IMG_CF_TRUE_COLOR, the RGB565 is copied as is
+# - only fully transparent pixels: LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED, they
+#   become LV_COLOR_CHROMA_KEY (pure green) when no opaque pixel is green
+# - anything else keeps its alpha
+#
+# The RGB565 stays in the byte order of LV_COLOR_16_SWAP 0, the order of the
+# ILI9341_T4 framebuffer. Converted files are left alone, so this runs before
+# every build (extra_scripts = pre:image_convert.py) and after an export:
+#
+# python image_convert.py [src/gui/ui_img_*.c ...]
+import glob
+import os
+import re
+import sys
+
+ALPHA = "LV_IMG_CF_TRUE_COLOR_ALPHA"
+CHROMA_KEY = 0x07E0
+
+
+def convert(path):
+    text = open(path).read()
+    if ALPHA not in text:
+        return None
+    match = re.search(r"uint8_t\s+\w+\[\]\s*=\s*\{([^}]*)\};", text)
+    if not match:
+        return None
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})",
+                                                match.group(1)))
+    if len(data) % 3:
+        sys.exit("%s: not 3 bytes per pixel" % path)
+    pixels = [(data[i] | data[i + 1] << 8, data[i + 2])
+              for i in range(0, len(data), 3)]
+    alphas = set(a for _, a in pixels)
+    if alphas == {255}:
+        format = "LV_IMG_CF_TRUE_COLOR"
+        colors = [c for c, _ in pixels]
+    elif alphas == {0, 255} and all(c != CHROMA_KEY or a == 0
+                                     for c, a in pixels):
+        format = "LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED"
+        colors = [c if a else CHROMA_KEY for c, a in pixels]
+    else:
+        return None
+    out = []
+    for c in colors:
+        out.append("0x%02X, 0x%02X," % (c & 0xFF, c >> 8))
+    lines = [" ".join(out[i:i + 32]) for i in range(0, len(out), 32)]
+    body = "\n    " + "\n    ".join(lines) + "\n"
+    text = text[:match.start(1)] + body + text[match.end(1):]
+    text = text.replace(ALPHA, format)
+    open(path, "w").write(text)
+    return format
+
+
+def convert_all(paths):
+    for path in paths:
+        format = convert(path)
+        if format:
+            print("%s: %s" % (os.path.basename(path), format))
+
+
+try:
+    Import("env")
+    convert_all(sorted(glob.glob(os.path.join(env.subst("$PROJECT_SRC_DIR"),
+                                              "gui", "ui_img_*.c"))))
+except NameError:
+    if __name__ == "__main__":
+        here = os.path.dirname(os.path.abspath(__file__))
+        convert_all(sys.argv[1:] or
+                    sorted(glob.glob(os.path.join(here, "src", "gui",
+                                                  "ui_img_*.c"))))
@@ -0,0 +1,140 @@
+# Write itcm.txt (code_placement.py) from measurements instead of guesses:
+# the draw profile of the animations (Animation::dump_profile(), the console
+# output of a run) and a trace of the same run (trace_convert.py) weigh the
+# code by the time spent in it, the firmware tells how large it is. The code
+# with the most time per byte goes to ITCM until the budget is spent, the
+# isrs always do.
+#
+# python itcm_select.py --elf .pio/build/teensy40/firmware.elf \
+#     --trace trace.json --budget 65536 log.txt itcm.txt
+#
+# Build the elf with custom_code = itcm, so every function is measured where
+# it is fastest.
+import argparse
+import fnmatch
+import json
+import re
+import subprocess
+import sys
+
+# Code that runs with interrupts, whatever it costs
+ISRS = ["Display::displayReady*", "Display::interruptAtCompletion*",
+        "Display::transposeFrame*", "Display::prepare*", "Display::toneMap*",
+        "Transpose::*"]
+# Code behind the trace events, besides the animations themselves
+EVENTS = {
+    "animation": ["Animation::loop*", "Noise::*", "Color::*", "PaletteLUT::*",
+                  "Vector3::*", "Vector3q::*", "Quaternion::*",
+                  "RotationMatrix::*", "FastTrig::*"],
+    "submit": ["Display::submit*", "Display::resolve*", "PixelPipe::*",
+               "PostProcess::*", "Layer::*"],
+    "link": ["ESP8266::*", "Frame::*"],
+    "gui": ["LCD::*"],
+}
+# Jump table names of another class than their own
+ALIASES = {"fairylights": "twinkels", "multilights": "twinkels",
+           "plasmatext": "plasma"}
+PROFILE = re.compile(r"^(.+?)\s+(\d+)\s+([\d.]+)\s+([\d.]+)( over budget)?$")
+
+
+def code(elf, nm):
+    out = subprocess.check_output([nm, "-S", "-C", elf])
+    for line in out.decode().splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in "tTwW":
+            yield parts[3], int(parts[1], 16)
+
+
+def profile(path):
+    # Every dump starts a new profile, the times add up
+    spent = {}
+    for line in open(path, errors="replace"):
+        match = PROFILE.match(line.strip())
+        if match:
+            name = match.group(1).replace(" ", "").lower()
+            name = ALIASES.get(name, name)
+            calls, avg = int(match.group(2)), float(match.group(3))
+            spent[name] = spent.get(name, 0) + calls * avg
+    return spent
+
+
+def trace(path):
+    # Time between the begin and end of every event, per row
+    spent, open_ = {}, {}
+    for e in json.load(open(path))["traceEvents"]:
+        key = (e.get("tid"), e["name"])
+        if e["ph"] == "B":
+            open_[key] = e["ts"]
+        elif e["ph"] == "E" and key in open_:
+            took = e["ts"] - open_.pop(key)
+            spent[e["name"]] = spent.get(e["name"], 0) + took
+    return spent
+
+
+def groups(functions, spent, events):
+    # The functions of an animation are those of its class, the jump table
+    # name without spaces
+    classes = {}
+    for name in functions:
+        if "::" in name:
+            classes.setdefault(name.split("::")[0].lower(), name.split("::")[0])
+    out, unknown = [], []
+    for name, us in spent.items():
+        if name in classes:
+            out.append((name, us, [classes[name] + "::*"]))
+        else:
+            unknown.append(name)
+    for name, patterns in EVENTS.items():
+        if name in events:
+            out.append((name, events[name], patterns))
+    return out, unknown
+
+
+def size(functions, patterns):
+    return sum(s for name, s in functions.items()
+               if any(fnmatch.fnmatch(name, p) for p in patterns))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("log", help="console output with draw profiles")
+    parser.add_argument("out", help="itcm.txt to write")
+    parser.add_argument("--elf", required=True, help="firmware.elf")
+    parser.add_argument("--trace", help="trace JSON of trace_convert.py")
+    parser.add_argument("--budget", type=int, default=65536,
+                        help="bytes of ITCM besides the isrs")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    args = parser.parse_args()
+    functions = {}
+    for name, s in code(args.elf, args.nm):
+        functions[name] = functions.get(name, 0) + s
+    spent = profile(args.log)
+    if not spent:
+        sys.exit("%s: no draw profile" % args.log)
+    events = trace(args.trace) if args.trace else {}
+    found, unknown = groups(functions, spent, events)
+    for name in unknown:
+        print("%s: no class of that name, left out" % name)
+    ranked = sorted(((us / max(size(functions, p), 1), name, us, p)
+                     for name, us, p in found), reverse=True)
+    isrs = size(functions, ISRS)
+    lines = ["# Written by itcm_select.py from %s%s" %
+             (args.log, " and " + args.trace if args.trace else ""),
+             "", "# isrs, %d bytes" % isrs] + ISRS
+    used = 0
+    for _, name, us, patterns in ranked:
+        bytes_ = size(functions, patterns)
+        if used + bytes_ > args.budget:
+            print("%-16s %10.0f us %7d bytes  flash" % (name, us, bytes_))
+            continue
+        used += bytes_
+        print("%-16s %10.0f us %7d bytes  itcm" % (name, us, bytes_))
+        lines += ["# %s, %.0f us, %d bytes" % (name, us, bytes_)] + patterns
+    with open(args.out, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print("%s: %d bytes of isrs and %d of %d selected" %
+          (args.out, isrs, used, args.budget))
+
+
+if __name__ == "__main__":
+    main()
@@ -267,6 +267,11 @@ namespace ILI9341_T4
                                     }
 
 
+// 4 pixels of both framebuffers at once (unaligned loads), true when they agree
+// on the bits of the mask
+#define COMPUTE_DIFF_SAME4(OLD, NEW, MASK64)    (((_load4(OLD) ^ _load4(NEW)) & (MASK64)) == 0)
+
+
 #define COMPUTE_DIFF_END    { const int cpos = DiffBuffBase::LX * DiffBuffBase::LY;                   \
                               if (cpos - pos - cgap != 0)                 \
                                   {                                       \
@@ -280,12 +285,22 @@ namespace ILI9341_T4
         template<bool COPY_NEW_OVER_OLD, bool USE_MASK>
         void DiffBuff::_computeDiff0(uint16_t* fb_old, const uint16_t* fb_new, int gap, uint16_t compare_mask)
             {
+            const uint64_t mask64 = USE_MASK ? (0x0001000100010001ULL * compare_mask) : ~0ULL;
             int cgap = 0;   // current gap size;
             int pos = 0;    // number of pixel written in diffbuf
             int n = 0;      // current offset  
             int m = 0; 
             while(m < DiffBuffBase::LX*DiffBuffBase::LY)
-                {
+                { // both framebuffers are in the same order: skip 4 equal pixels at once and 
+                  // only go pixel by pixel in a group that differs (LX*LY is a multiple of 4). 
+                if (COMPUTE_DIFF_SAME4(fb_old + n, fb_new + m, mask64))
+                    {
+                    cgap += 4;
+                    n += 4;
+                    m += 4;
+                    continue;
+                    }
+                COMPUTE_DIFF_LOOP((m++)) 
                 COMPUTE_DIFF_LOOP((m++)) 
                 }
             COMPUTE_DIFF_END
@@ -512,6 +527,7 @@ namespace ILI9341_T4
                 }
  
             if (compare_mask == 0) compare_mask = 0xFFFF;
+            const uint64_t mask64 = 0x0001000100010001ULL * compare_mask;
             int nb_write = 0, nb_skip = 0; // number of pixel to write / skip in the old diff
             diff_old->readRaw(nb_write, nb_skip);
 
@@ -635,6 +651,16 @@ namespace ILI9341_T4
                 const int nend = xmax + (DiffBuffBase::LX * yc);
                 for (int n = xmin + (DiffBuffBase::LX * yc); n <= nend; n++, m += mdelta)
                     {
+                    if ((mdelta == 1) && (nb_write == 0) && (nb_skip >= 4) && (n + 3 <= nend)
+                        && COMPUTE_DIFF_SAME4(fb_old + n, sub_fb_new + m, mask64))
+                        { // unrotated and skipped by the old diff: 4 equal pixels at once
+                        cgap += 4;
+                        nb_skip -= 4;
+                        if (nb_skip == 0) diff_old->readRaw(nb_write, nb_skip); // reload if needed
+                        n += 3; // the loop adds the 4th
+                        m += 3;
+                        continue;
+                        }
                     if (((fb_old[n]) ^ (sub_fb_new[m])) & compare_mask)
                         {
                         if (copy_new_over_old) 
@@ -830,6 +856,8 @@ namespace ILI9341_T4
 
 
 
+#undef COMPUTE_DIFF_SAME4
+
 }
 
 
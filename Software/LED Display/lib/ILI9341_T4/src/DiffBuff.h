@@ -29,6 +29,7 @@
 
 #include <Arduino.h>
 #include <math.h>
+#include <string.h>
 
 #define ILI9341_T4_ALWAYS_INLINE __attribute__((always_inline))
 
@@ -448,6 +449,16 @@ namespace ILI9341_T4
             }
 
 
+        /** Read 4 consecutive pixels as one word. The framebuffers are only 2 bytes aligned, 
+        * memcpy lets the compiler use unaligned word loads instead of ldrd. */
+        static uint64_t _load4(const uint16_t* p) ILI9341_T4_ALWAYS_INLINE
+            {
+            uint64_t v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+            }
+
+
         /** Write a [write,skip] sequence in the  buffer. */
         bool _write_chunk(uint32_t nbwrite, uint32_t nbskip)
             {            
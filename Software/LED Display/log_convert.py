@@ -0,0 +1,163 @@
+# Print the LOG frames of the Teensy (core/Log.h) as text between its console
+# output. The formats are read from core/Log.h, the Teensy only sends the
+# message ids and raw arguments. From a capture of the USB serial port, the
+# port itself (needs pyserial) or the link through the ESP8266 bridge, which
+# sends {"event":"log","on":true} first:
+#
+# python log_convert.py capture.bin
+# python log_convert.py --port /dev/ttyACM0
+# python log_convert.py --host MegaCube.local
+#
+# Every message is prefixed with its time in seconds, from the cycle counter
+# of the Teensy unwrapped since the first one.
+import argparse
+import os
+import re
+import socket
+import struct
+import sys
+
+FRAME_START = 0xF3
+FRAME_MAX = 1088
+JSON = 0
+LOG = 13
+HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                      "src", "core", "Log.h")
+CONVERSION = re.compile(r"%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l|z)?([diouxXcfeEgG%])")
+
+
+def messages(path):
+    text = open(path).read()
+    return [(name, fmt.encode().decode("unicode_escape")) for name, fmt in
+            re.findall(r'X\((\w+),\s*"((?:[^"\\]|\\.)*)"\)', text)]
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = (crc << 1 ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return crc
+
+
+# A frame of core/Frame.h with its CRC-16 CCITT-FALSE
+def frame(type, payload):
+    body = struct.pack("<BH", type, len(payload)) + payload
+    return b"\xf3" + body + struct.pack("<H", crc16(body))
+
+
+def render(fmt, args):
+    values = iter(args)
+
+    def one(match):
+        kind = match.group(1)
+        if kind == "%":
+            return "%"
+        raw = next(values, 0)
+        spec = re.sub(r"(hh|h|ll|l|z)", "", match.group(0))
+        if kind in "feEgG":
+            return spec % struct.unpack("<f", struct.pack("<I", raw))[0]
+        if kind in "di":
+            return spec % (raw - (1 << 32) if raw & 0x80000000 else raw)
+        return spec.replace("u", "d") % raw
+    return CONVERSION.sub(one, fmt)
+
+
+class Reader:
+    """Splits the bytes into console text and frames like core/Frame.cpp"""
+
+    def __init__(self, table, out):
+        self.table = table
+        self.out = out
+        self.pending = bytearray()
+        self.mhz = None
+        self.last = None
+        self.time = 0
+
+    def feed(self, data):
+        self.pending += data
+        while self.pending:
+            start = self.pending.find(FRAME_START)
+            if start < 0:
+                self.text(self.pending)
+                self.pending.clear()
+                return
+            if start:
+                self.text(self.pending[:start])
+                del self.pending[:start]
+            if len(self.pending) < 4:
+                return
+            type, length = struct.unpack_from("<BH", self.pending, 1)
+            if length > FRAME_MAX:
+                self.text(self.pending[:1])
+                del self.pending[:1]
+                continue
+            if len(self.pending) < 6 + length:
+                return
+            body = bytes(self.pending[1:4 + length])
+            crc = struct.unpack_from("<H", self.pending, 4 + length)[0]
+            if crc != crc16(body):
+                self.text(self.pending[:1])
+                del self.pending[:1]
+                continue
+            del self.pending[:6 + length]
+            if type == LOG:
+                self.log(body[3:])
+
+    def text(self, data):
+        self.out.write(data.decode(errors="replace"))
+
+    def log(self, payload):
+        hz, count, lost = struct.unpack_from("<IHI", payload)
+        self.mhz = hz / 1e6
+        if count != len(self.table):
+            self.out.write("log: %d messages on the Teensy, %d in %s\n"
+                           % (count, len(self.table), HEADER))
+        if lost:
+            self.out.write("log: %d messages lost\n" % lost)
+        at = 10
+        while at + 7 <= len(payload):
+            cycles, id, n = struct.unpack_from("<IHB", payload, at)
+            args = struct.unpack_from("<%dI" % n, payload, at + 7)
+            at += 7 + 4 * n
+            if self.last is not None:
+                self.time += (cycles - self.last) & 0xFFFFFFFF
+            self.last = cycles
+            if id < len(self.table):
+                line = render(self.table[id][1], args)
+            else:
+                line = "message %d %s" % (id, " ".join(map(str, args)))
+            self.out.write("[%10.6f] %s\n" % (self.time / self.mhz / 1e6, line))
+        self.out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("capture", nargs="?", help="bytes of the USB port")
+    parser.add_argument("--port", help="USB serial port of the Teensy")
+    parser.add_argument("--host", help="the cube, through the ESP8266")
+    parser.add_argument("--tcp-port", type=int, default=8000)
+    args = parser.parse_args()
+    reader = Reader(messages(HEADER), sys.stdout)
+    if args.capture:
+        reader.feed(open(args.capture, "rb").read())
+    elif args.port:
+        import serial
+        with serial.Serial(args.port, timeout=1) as s:
+            while True:
+                reader.feed(s.read(s.in_waiting or 1))
+    elif args.host:
+        sock = socket.create_connection((args.host, args.tcp_port))
+        sock.sendall(frame(JSON, b'{"event":"log","on":true}'))
+        while True:
+            data = sock.recv(4096)
+            if not data:
+                break
+            reader.feed(data)
+    else:
+        sys.exit("a capture, --port or --host")
+
+
+if __name__ == "__main__":
+    main()
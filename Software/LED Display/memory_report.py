@@ -0,0 +1,105 @@
+# Report RAM1 (ITCM/DTCM) and RAM2 (OCRAM, DMAMEM) usage after every build
+# and list the large objects in each, to see what fits next to the LVGL
+# buffers. RAM1 is shared, ITCM takes 32K blocks and DTCM gets the rest, the
+# functions left in ITCM and moved to flash (code_placement.py) are counted.
+# The PSRAM of the Teensy 4.1 (EXTMEM) is listed when there is any, and so
+# are the lookup tables marked HOTMEM (power/Memory.h), which the linker folds
+# into .data and only the objects still name.
+Import("env")
+import glob
+import os
+import re
+import subprocess
+
+RAM1 = 512 * 1024
+RAM2 = 512 * 1024
+PSRAM = 8 * 1024 * 1024
+ITCM_BLOCK = 32 * 1024
+LARGE = 4096
+
+
+def sections(elf):
+    size = {}
+    out = subprocess.check_output([env.subst("$SIZETOOL"), "-A", elf])
+    for line in out.decode().splitlines():
+        parts = line.split()
+        if len(parts) >= 3 and parts[0].startswith("."):
+            size[parts[0]] = int(parts[1])
+    return size
+
+
+def objects(elf):
+    nm = env.subst("$SIZETOOL").replace("size", "nm")
+    out = subprocess.check_output([nm, "-S", "-C", "--size-sort", elf])
+    for line in out.decode().splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in "bBdD":
+            yield int(parts[0], 16), int(parts[1], 16), parts[3]
+
+
+def hot(build):
+    objdump = env.subst("$SIZETOOL").replace("size", "objdump")
+    files = glob.glob(os.path.join(build, "src", "**", "*.o"), recursive=True)
+    if not files:
+        return
+    out = subprocess.check_output([objdump, "-t", "-C"] + files)
+    for line in out.decode().splitlines():
+        # address, flags with spaces, section, size and name
+        match = re.search(r"\s\.data\.hot\s+([0-9a-f]+)\s+(.+)$", line)
+        if match and int(match.group(1), 16):
+            yield int(match.group(1), 16), match.group(2)
+
+
+def code(elf):
+    # Bytes of functions in ITCM and in flash
+    nm = env.subst("$SIZETOOL").replace("size", "nm")
+    out = subprocess.check_output([nm, "-S", elf])
+    itcm = flash = 0
+    for line in out.decode().splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in "tTwW":
+            address, length = int(parts[0], 16), int(parts[1], 16)
+            if address < 0x00080000:
+                itcm += length
+            elif 0x60000000 <= address < 0x70000000:
+                flash += length
+    return itcm, flash
+
+
+def region(address):
+    if 0x20000000 <= address < 0x20080000:
+        return "RAM1"
+    if 0x20200000 <= address < 0x20280000:
+        return "RAM2"
+    if 0x70000000 <= address < 0x70000000 + PSRAM:
+        return "PSRAM"
+    return None
+
+
+def memory_report(source, target, env):
+    elf = str(target[0])
+    size = sections(elf)
+    itcm = size.get(".text.itcm", 0) + size.get(".ARM.exidx", 0)
+    itcm_padded = -(-itcm // ITCM_BLOCK) * ITCM_BLOCK
+    dtcm = size.get(".data", 0) + size.get(".bss", 0)
+    dma = size.get(".bss.dma", 0)
+    print("RAM1: code %6d, padding %6d, variables %6d, free %6d" %
+          (itcm, itcm_padded - itcm, dtcm, RAM1 - itcm_padded - dtcm))
+    itcm_code, flash_code = code(elf)
+    print("Code: ITCM %6d, flash %6d (custom_code = %s)" %
+          (itcm_code, flash_code, env.GetProjectOption("custom_code", "itcm")))
+    print("RAM2: variables %6d, free %6d" % (dma, RAM2 - dma))
+    extram = size.get(".bss.extram", 0)
+    if extram:
+        print("PSRAM: variables %7d, free %7d" % (extram, PSRAM - extram))
+    for address, length, name in reversed(list(objects(elf))):
+        if length >= LARGE and region(address):
+            print("  %s %7d %s" % (region(address), length, name))
+    tables = sorted(hot(env.subst("$BUILD_DIR")), reverse=True)
+    if tables:
+        print("Hot tables: %d bytes in DTCM" % sum(t[0] for t in tables))
+        for length, name in tables:
+            print("  %7d %s" % (length, name))
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", memory_report)
@@ -0,0 +1,150 @@
+# Convert MagicaVoxel .vox files into the model format of power/Model.h:
+# one palette, the occupied 4x4x4 bricks of every frame as a place and a 64 bit
+# mask, and (length, index) runs of the colors of their voxels.
+#
+# python model_convert.py heart.vox src/gfx/Heart3D.h       # header for flash
+# python model_convert.py walk1.vox walk2.vox sd/walk.vxm   # file for SD card
+#
+# Every model of a .vox file is a frame, several files are a sequence in the
+# order given and share the palette of the first. Only the colors used are
+# kept, in the order of their MagicaVoxel index; the header lists which index
+# became which, for palettes that replace them. A header is named after the
+# output file: heart3d_model.
+import os
+import struct
+import sys
+
+
+def chunks(data, offset, end):
+    while offset < end:
+        cid, content, children = struct.unpack_from("<4sII", data, offset)
+        offset += 12
+        yield cid.decode("ascii"), data[offset:offset + content], \
+            offset + content, offset + content + children
+        offset += content + children
+
+
+def parse(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"VOX ":
+        sys.exit("%s is not a MagicaVoxel file" % path)
+    models, size, rgba = [], None, None
+    cid, _, start, end = next(chunks(data, 8, len(data)))
+    if cid != "MAIN":
+        sys.exit("%s has no MAIN chunk" % path)
+    for cid, content, _, _ in chunks(data, start, end):
+        if cid == "SIZE":
+            size = struct.unpack_from("<3I", content)
+        elif cid == "XYZI":
+            n = struct.unpack_from("<I", content)[0]
+            voxels = [struct.unpack_from("<4B", content, 4 + 4 * i)
+                      for i in range(n)]
+            models.append((size, voxels))
+        elif cid == "RGBA":
+            rgba = [struct.unpack_from("<4B", content, 4 * i)[:3]
+                    for i in range(256)]
+    if not models:
+        sys.exit("%s has no models" % path)
+    return models, rgba
+
+
+def default_palette():
+    # Colors of MagicaVoxel without an RGBA chunk: its 6x6x6 cube without
+    # black, then ramps of blue, green, red and gray
+    ramp = [0xFF, 0xCC, 0x99, 0x66, 0x33, 0x00]
+    colors = [(r, g, b) for r in ramp for g in ramp for b in ramp][:215]
+    steps = [0xEE, 0xDD, 0xBB, 0xAA, 0x88, 0x77, 0x55, 0x44, 0x22, 0x11]
+    for channel in (2, 1, 0, None):
+        for s in steps:
+            c = [s] * 3 if channel is None else [0, 0, 0]
+            if channel is not None:
+                c[channel] = s
+            colors.append(tuple(c))
+    return colors + [(0, 0, 0)]
+
+
+def encode(frames, rgba):
+    # MagicaVoxel z is up, y on the cube
+    used = sorted({i for _, voxels in frames for *_, i in voxels})
+    if len(used) > 255:
+        sys.exit("more than 255 colors")
+    remap = {index: n + 1 for n, index in enumerate(used)}
+    palette = [rgba[index - 1] for index in used]
+    width = max(s[0] for s, _ in frames)
+    height = max(s[2] for s, _ in frames)
+    depth = max(s[1] for s, _ in frames)
+    if max(width, height, depth) > 255 or len(frames) > 255:
+        sys.exit("at most 255 frames of 255 voxels a side")
+    table, bricks, runs = [], [], []
+    for _, voxels in frames:
+        table.append((len(bricks), len(runs)))
+        grid = {}
+        for x, y, z, i in voxels:
+            brick = grid.setdefault((x >> 2, z >> 2, y >> 2), {})
+            brick[(x & 3) | (z & 3) << 2 | (y & 3) << 4] = remap[i]
+        colors = []
+        for place in sorted(grid, key=lambda p: (p[0], p[1], p[2])):
+            brick = grid[place]
+            mask = sum(1 << bit for bit in brick)
+            bricks.append((place, mask))
+            colors += [brick[bit] for bit in sorted(brick)]
+        length = 0
+        for n, index in enumerate(colors):
+            length += 1
+            if n + 1 == len(colors) or colors[n + 1] != index or length == 255:
+                runs.append((length, index))
+                length = 0
+    table.append((len(bricks), len(runs)))
+    if len(bricks) > 0xFFFF or len(runs) > 0xFFFF:
+        sys.exit("model too large for 16 bit offsets")
+    out = bytearray(b"VXM1")
+    out += bytes([width, height, depth, len(frames),
+                  len(palette)])
+    for color in palette:
+        out += bytes(color)
+    for brick, run in table:
+        out += struct.pack("<HH", brick, run)
+    for place, mask in bricks:
+        out += bytes(place) + struct.pack("<Q", mask)
+    for run in runs:
+        out += bytes(run)
+    return out, used, len(bricks), len(runs)
+
+
+def header(name, out, used, bricks, runs, frames):
+    guard = name.upper() + "_MODEL_H"
+    values = ["0x%02x" % b for b in out]
+    lines = ["    " + ", ".join(values[i:i + 12]) + ","
+             for i in range(0, len(values), 12)]
+    return "\n".join(
+        ["#ifndef " + guard, "#define " + guard, "#include <stdint.h>", "",
+         "#include \"power/Model.h\"", "",
+         "/* %d frames, %d colors, %d bricks, %d runs, %d bytes "
+         "(model_convert.py)" % (frames, len(used), bricks, runs, len(out)),
+         " * MagicaVoxel index of every color: %s */"
+         % " ".join(str(i) for i in used),
+         "",
+         "PROGMEM const uint8_t %s_model[] = {" % name] + lines +
+        ["};", "#endif", ""])
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        sys.exit("usage: model_convert.py <vox> [<vox> ...] <header or vxm>")
+    frames, rgba = [], None
+    for path in sys.argv[1:-1]:
+        models, colors = parse(path)
+        frames += models
+        rgba = rgba or colors
+    out, used, bricks, runs = encode(frames, rgba or default_palette())
+    target = sys.argv[-1]
+    if target.endswith(".h"):
+        name = os.path.splitext(os.path.basename(target))[0].lower()
+        with open(target, "w") as f:
+            f.write(header(name, out, used, bricks, runs, len(frames)))
+    else:
+        with open(target, "wb") as f:
+            f.write(out)
+    print("%d frames, %d bricks, %d runs, %d bytes" %
+          (len(frames), bricks, runs, len(out)))
@@ -0,0 +1,227 @@
+# Load test of the link to the cube: flood it with SOAK frames (core/Soak.h)
+# over tcp, through the ESP8266 bridge and the UART, while the Teensy floods
+# them back, then compare what both ends received. Run it before and after
+# every change of the protocol or the link rate:
+#
+# python soak_test.py MegaCube.local --rate 200 --size 256 --seconds 10
+#
+# Each direction reports the goodput, the frames lost, reordered and corrupt
+# (filler wrong), the frames its parser dropped and the resync time after
+# them: on the Teensy at the rate of the link, here the time between the good
+# frames around the drop.
+import argparse
+import json
+import socket
+import struct
+import sys
+import threading
+import time
+
+FRAME_START = 0xF3
+WIO_START = 0xF2
+WIO_STOP = 0xFA
+FRAME_MAX = 1088
+JSON = 0
+SOAK = 12
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = (crc << 1 ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return crc
+
+
+# A frame of core/Frame.h with its CRC-16 CCITT-FALSE
+def frame(type, payload):
+    body = struct.pack("<BH", type, len(payload)) + payload
+    return b"\xf3" + body + struct.pack("<H", crc16(body))
+
+
+def soak_payload(sequence, size):
+    return struct.pack("<I", sequence & 0xFFFFFFFF) + bytes(
+        (sequence + i) & 0xFF for i in range(4, size))
+
+
+class Receiver:
+    """The parser of core/Frame.cpp, counting the SOAK frames like
+    core/Soak.cpp and collecting the replies of the Teensy"""
+
+    def __init__(self):
+        self.state = "idle"
+        self.replies = []
+        self.frames = self.bytes = self.lost = self.reordered = 0
+        self.corrupt = self.errors = 0
+        self.resyncs = []
+        self.expected = None
+        self.first = self.last = None
+        self.broken = False
+        self.lock = threading.Lock()
+
+    def feed(self, data, now):
+        with self.lock:
+            for c in data:
+                self.byte(c, now)
+
+    def byte(self, c, now):
+        if self.state == "idle":
+            if c == FRAME_START:
+                self.state, self.header = "header", bytearray()
+            elif c == WIO_START:
+                self.state, self.text = "text", bytearray()
+        elif self.state == "text":
+            if c == WIO_STOP:
+                self.reply(bytes(self.text))
+                self.state = "idle"
+            else:
+                self.text.append(c)
+        elif self.state == "header":
+            self.header.append(c)
+            if len(self.header) == 3:
+                length = self.header[1] | self.header[2] << 8
+                if length > FRAME_MAX:
+                    self.drop()
+                else:
+                    self.length, self.body = length, bytearray()
+                    self.state = "body"
+        elif self.state == "body":
+            self.body.append(c)
+            if len(self.body) == self.length + 2:
+                crc = self.body[-2] | self.body[-1] << 8
+                if crc16(bytes(self.header) + bytes(self.body[:-2])) != crc:
+                    self.drop()
+                else:
+                    self.state = "idle"
+                    self.frame(self.header[0], bytes(self.body[:-2]), now)
+
+    def drop(self):
+        self.errors += 1
+        self.broken = True
+        self.state = "idle"
+
+    def reply(self, text):
+        try:
+            self.replies.append(json.loads(text))
+        except ValueError:
+            pass
+
+    def frame(self, type, payload, now):
+        if type == JSON:
+            self.reply(payload)
+        if type != SOAK or len(payload) < 4:
+            return
+        sequence = struct.unpack_from("<I", payload)[0]
+        if self.expected is None:
+            self.expected, self.first = sequence, now
+        if self.broken:
+            self.resyncs.append(now - self.last)
+            self.broken = False
+        self.last = now
+        self.frames += 1
+        self.bytes += len(payload)
+        ahead = (sequence - self.expected) & 0xFFFFFFFF
+        if ahead < 1 << 31:
+            self.lost += ahead
+            self.expected = sequence + 1
+        else:
+            self.reordered += 1
+            self.lost = max(0, self.lost - 1)
+        if payload != soak_payload(sequence, len(payload)):
+            self.corrupt += 1
+
+    def wait_reply(self, event, timeout):
+        end = time.monotonic() + timeout
+        while time.monotonic() < end:
+            with self.lock:
+                for r in self.replies:
+                    if r.get("event") == event:
+                        return r
+            time.sleep(0.05)
+        return None
+
+
+def report(name, sent, frames, size, seconds, lost, reordered, corrupt,
+           errors, resync_max, resync_avg):
+    print("%-14s %6d/%-6d frames %8.1f kB/s  lost %d  reordered %d  "
+          "corrupt %d  errors %d  resync %.2f ms max %.2f ms avg" %
+          (name, frames, sent, frames * size / 1000 / max(seconds, 1e-3),
+           lost, reordered, corrupt, errors, resync_max * 1e3,
+           resync_avg * 1e3))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("host", help="address of the ESP8266 of the cube")
+    parser.add_argument("--tcp-port", type=int, default=8000)
+    parser.add_argument("--rate", type=int, default=100,
+                        help="frames a second to the cube")
+    parser.add_argument("--back", type=int,
+                        help="frames a second from the cube, default --rate")
+    parser.add_argument("--size", type=int, default=256,
+                        help="payload bytes, 4 to %d" % FRAME_MAX)
+    parser.add_argument("--seconds", type=float, default=10)
+    args = parser.parse_args()
+    if not 4 <= args.size <= FRAME_MAX:
+        sys.exit("--size 4 to %d" % FRAME_MAX)
+    back = args.rate if args.back is None else args.back
+
+    sock = socket.create_connection((args.host, args.tcp_port), timeout=5)
+    sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    receiver = Receiver()
+    stop = threading.Event()
+
+    def read():
+        sock.settimeout(0.2)
+        while not stop.is_set():
+            try:
+                data = sock.recv(4096)
+            except socket.timeout:
+                continue
+            if not data:
+                break
+            receiver.feed(data, time.monotonic())
+
+    reader = threading.Thread(target=read, daemon=True)
+    reader.start()
+    start = {"event": "soak", "rate": back, "size": args.size,
+             "ms": int(args.seconds * 1000)}
+    sock.sendall(frame(JSON, json.dumps(start).encode()))
+
+    # Paced from the start, a late frame is sent at once
+    sent = 0
+    begin = time.monotonic()
+    while args.rate and time.monotonic() - begin < args.seconds:
+        due = begin + sent / args.rate
+        wait = due - time.monotonic()
+        if wait > 0:
+            time.sleep(wait)
+        sock.sendall(frame(SOAK, soak_payload(sent, args.size)))
+        sent += 1
+    # What is still on its way
+    time.sleep(max(0, begin + args.seconds - time.monotonic()) + 1)
+    sock.sendall(frame(JSON, b'{"event":"soak"}'))
+    counts = receiver.wait_reply("soak", 3)
+    stop.set()
+    reader.join()
+    sock.close()
+
+    if counts is None:
+        print("to the cube    no reply to the soak event")
+    else:
+        report("to the cube", sent, counts["frames"], args.size,
+               counts["ms"] / 1000, counts["lost"], counts["reordered"],
+               counts["corrupt"], counts["errors"],
+               counts["resync_max"] / 1e6, counts["resync_avg"] / 1e6)
+    r = receiver
+    sent_back = counts["sent"] if counts else r.frames
+    resync_max = max(r.resyncs) if r.resyncs else 0
+    resync_avg = sum(r.resyncs) / len(r.resyncs) if r.resyncs else 0
+    report("from the cube", sent_back, r.frames, args.size,
+           (r.last - r.first) if r.frames else 0, r.lost, r.reordered,
+           r.corrupt, r.errors, resync_max, resync_avg)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,107 @@
+# Convert a Piskel C export (uint32_t ARGB frames) into the sprite format of
+# power/Sprite.h: a palette per frame plus (length, index) runs per line.
+#
+# python sprite_convert.py Mario16x16.c src/gfx/Mario.h
+#
+# The #defines of the export are kept, the frames become <name>_sprite where
+# <name> is the export array name without _data. The tables are HOTMEM, read
+# from DTCM while drawing (power/Memory.h).
+import re
+import sys
+
+
+def parse(text):
+    match = re.search(r"uint32_t\s+(\w+)_data\s*\[(\d+)\]\s*\[(\d+)\]", text)
+    if not match:
+        sys.exit("no uint32_t <name>_data[frames][pixels] array found")
+    name = match.group(1)
+    count, pixels = int(match.group(2)), int(match.group(3))
+    defines = re.findall(r"^#define\s+(\w+)\s+(\d+)", text, re.M)
+    width = [int(v) for k, v in defines if k.endswith("WIDTH")]
+    if len(width) != 1 or pixels % width[0]:
+        sys.exit("no FRAME_WIDTH found that divides the frame size")
+    values = [int(v, 16) for v in
+              re.findall(r"0x([0-9a-fA-F]{8})", text[match.end():])]
+    if len(values) != count * pixels:
+        sys.exit("expected %d pixels, found %d" % (count * pixels, len(values)))
+    frames = [values[i * pixels:(i + 1) * pixels] for i in range(count)]
+    return name, defines, width[0], pixels // width[0], frames
+
+
+def encode(frames, width, height):
+    palette, palettes, runs, lines = [], [], [], []
+    for frame in frames:
+        colors = {}
+        palettes.append(len(palette))
+        for y in range(height):
+            lines.append(len(runs))
+            row = frame[y * width:(y + 1) * width]
+            x = 0
+            while x < width:
+                # ARGB with red in the low byte, alpha 0 is transparent
+                argb = row[x]
+                color = argb & 0xFFFFFF if argb >> 24 else None
+                length = 1
+                while x + length < width and length < 255 and \
+                        (row[x + length] & 0xFFFFFF if row[x + length] >> 24
+                         else None) == color:
+                    length += 1
+                if color is None:
+                    index = 0
+                else:
+                    if color not in colors:
+                        if len(colors) == 255:
+                            sys.exit("a frame has more than 255 colors")
+                        colors[color] = len(colors) + 1
+                        palette.append(color)
+                    index = colors[color]
+                runs.append((length, index))
+                x += length
+    if len(runs) > 0xFFFF or len(palette) > 0xFFFF:
+        sys.exit("sprite too large for 16 bit offsets")
+    return palette, palettes, runs, lines
+
+
+def table(items, per_line):
+    lines = []
+    for i in range(0, len(items), per_line):
+        lines.append("    " + ", ".join(items[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def convert(text):
+    name, defines, width, height, frames = parse(text)
+    palette, palettes, runs, lines = encode(frames, width, height)
+    rgb = ["0x%02x, 0x%02x, 0x%02x" % (c & 0xFF, c >> 8 & 0xFF, c >> 16)
+           for c in palette]
+    guard = name.upper() + "_SPRITE_H"
+    out = ["#ifndef " + guard, "#define " + guard, "#include <stdint.h>", "",
+           "#include \"power/Memory.h\"", "#include \"power/Sprite.h\"", ""]
+    out += ["#define %s %s" % d for d in defines]
+    out += ["",
+            "/* %d frames, %d colors, %d runs (sprite_convert.py) */" %
+            (len(frames), len(palette), len(runs)),
+            "",
+            "HOTMEM const uint8_t %s_palette[] = {" % name,
+            table(rgb, 4), "};",
+            "HOTMEM const uint16_t %s_palettes[] = {" % name,
+            table([str(p) for p in palettes], 12), "};",
+            "HOTMEM const uint8_t %s_runs[] = {" % name,
+            table(["%d, %d" % r for r in runs], 6), "};",
+            "HOTMEM const uint16_t %s_lines[] = {" % name,
+            table([str(l) for l in lines], 12), "};",
+            "",
+            "const sprite_t %s_sprite = {%d, %d, %d, %s_palette, %s_palettes,"
+            % (name, width, height, len(frames), name, name),
+            "                            %s_runs, %s_lines};" % (name, name),
+            "#endif", ""]
+    return "\n".join(out)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit("usage: sprite_convert.py <piskel export> <header>")
+    with open(sys.argv[1]) as f:
+        header = convert(f.read())
+    with open(sys.argv[2], "w") as f:
+        f.write(header)
@@ -0,0 +1,77 @@
+#include "Alloc.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+
+Alloc::stats_t Alloc::stats[Footprint::REGIONS] = {};
+const char *volatile Alloc::hot = nullptr;
+volatile uint32_t Alloc::hot_allocations = 0;
+volatile uint32_t Alloc::hot_bytes = 0;
+const char *volatile Alloc::hot_last = nullptr;
+void *volatile Alloc::hot_caller = nullptr;
+
+void Alloc::count(const void *data, const size_t size, void *caller) {
+  if (!data) return;
+  stats_t &s = stats[Footprint::region(data)];
+  s.allocations++;
+  s.bytes += size;
+  if (!hot) return;
+  hot_allocations++;
+  hot_bytes += size;
+  hot_last = hot;
+  hot_caller = caller;
+}
+
+int Alloc::report(char *buffer, const size_t size) {
+  static const char *const names[Footprint::REGIONS] = {"RAM1", "RAM2",
+                                                        "PSRAM"};
+  int n = snprintf(buffer, size, "Alloc hot %lu (%lu bytes)", hot_allocations,
+                   hot_bytes);
+  for (uint8_t r = 0; r < Footprint::REGIONS && n < (int)size; r++)
+    if (stats[r].allocations)
+      n += snprintf(buffer + n, size - n, "  %s %lu (%lu bytes) freed %lu",
+                    names[r], stats[r].allocations, stats[r].bytes,
+                    stats[r].frees);
+  if (hot_allocations && n < (int)size)
+    n += snprintf(buffer + n, size - n, " last in %s from %p", hot_last,
+                  hot_caller);
+  hot_allocations = hot_bytes = 0;
+  return n;
+}
+
+#if defined CUBE_ALLOC_TRACE
+// The allocator of newlib, wrapped by -Wl,--wrap=malloc,... so every call in
+// the firmware and the libraries comes here first
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *data, size_t size);
+void __real_free(void *data);
+
+void *__wrap_malloc(size_t size) {
+  void *data = __real_malloc(size);
+  Alloc::count(data, size, __builtin_return_address(0));
+  return data;
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  void *data = __real_calloc(count, size);
+  Alloc::count(data, count * size, __builtin_return_address(0));
+  return data;
+}
+
+// A grown String is an allocation as well, the old block counts as freed
+void *__wrap_realloc(void *data, size_t size) {
+  const Footprint::region_t region = Footprint::region(data);
+  void *moved = __real_realloc(data, size);
+  if (data && moved) Alloc::stats[region].frees++;
+  Alloc::count(moved, size, __builtin_return_address(0));
+  return moved;
+}
+
+void __wrap_free(void *data) {
+  if (data) Alloc::stats[Footprint::region(data)].frees++;
+  __real_free(data);
+}
+}
+#endif
@@ -0,0 +1,68 @@
+#ifndef ALLOC_H
+#define ALLOC_H
+#include <stdint.h>
+#include <stddef.h>
+
+#include "Footprint.h"
+/*------------------------------------------------------------------------------
+ * ALLOC CLASS
+ *------------------------------------------------------------------------------
+ * Counts the heap allocations, to keep them off the paths that run every
+ * frame or every byte. Built with CUBE_ALLOC_TRACE and the linker wrapping
+ * the allocator (see platformio.ini), __wrap_malloc() and friends count the
+ * allocations, frees and bytes per region of the address they return, and
+ * new, String and ArduinoJson all come through them. Without the define
+ * nothing is wrapped and the guards are empty.
+ *
+ * HOT_PATH() marks a scope that should not allocate: the frame of
+ * Animation::loop(), the UART and USB handlers. An allocation inside one is
+ * counted against it with the caller address of the last one, the allocator
+ * can not print itself. report() prints them every print interval, the goal
+ * is none at all.
+ *
+ * void ESP8266::loop() {
+ *   HOT_PATH("link");
+ *   ...
+ *----------------------------------------------------------------------------*/
+// #define CUBE_ALLOC_TRACE
+
+class Alloc {
+ public:
+  struct stats_t {
+    uint32_t allocations;
+    uint32_t frees;
+    uint32_t bytes;
+  };
+  // Since the boot, per region
+  static stats_t stats[Footprint::REGIONS];
+  // Innermost hot path running, nullptr outside of them
+  static const char *volatile hot;
+  // Allocations on hot paths since the last report, the last one
+  static volatile uint32_t hot_allocations;
+  static volatile uint32_t hot_bytes;
+  static const char *volatile hot_last;
+  static void *volatile hot_caller;
+
+  // Count an allocation from caller, called by the wrappers
+  static void count(const void *data, const size_t size, void *caller);
+  // Print the allocations since boot and on hot paths since the last report,
+  // returns the amount printed
+  static int report(char *buffer, const size_t size);
+};
+
+// Marks a scope as a hot path for as long as it runs
+class HotPath {
+ public:
+  explicit HotPath(const char *name) : outer(Alloc::hot) { Alloc::hot = name; }
+  ~HotPath() { Alloc::hot = outer; }
+
+ private:
+  const char *outer;
+};
+
+#if defined CUBE_ALLOC_TRACE
+#define HOT_PATH(name) HotPath hot_path(name)
+#else
+#define HOT_PATH(name)
+#endif
+#endif
@@ -0,0 +1,30 @@
+#include "Arena.h"
+/*------------------------------------------------------------------------------
+ * ARENA CLASS
+ *----------------------------------------------------------------------------*/
+alignas(8) uint8_t Arena::memory[SLOTS][SLOT];
+bool Arena::taken[SLOTS];
+
+void Arena::footprint(Footprint::usage_t &usage) {
+  usage.add(memory, sizeof(memory));
+}
+
+void *Arena::acquire() {
+  for (uint8_t i = 0; i < SLOTS; i++) {
+    if (taken[i]) continue;
+    taken[i] = true;
+    return memory[i];
+  }
+  return nullptr;
+}
+
+void Arena::release(void *slot) {
+  for (uint8_t i = 0; i < SLOTS; i++)
+    if (slot == memory[i]) taken[i] = false;
+}
+
+uint8_t Arena::available() {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < SLOTS; i++) n += !taken[i];
+  return n;
+}
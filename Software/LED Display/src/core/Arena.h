@@ -0,0 +1,39 @@
+#ifndef ARENA_H
+#define ARENA_H
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Footprint.h"
+/*------------------------------------------------------------------------------
+ * ARENA CLASS
+ *------------------------------------------------------------------------------
+ * Working memory of the animations that are drawn or about to be. Only a few
+ * animations are active at a time (one fading out while the next fades in and
+ * the one prepared after it), so the large state of the animations shares
+ * SLOTS slots of SLOT bytes instead of every animation keeping its own for
+ * good. An animation takes a slot for its state the first time it needs it
+ * (see Animation::memory()) and gives it back when it becomes inactive.
+ *
+ * void *memory = Arena::acquire();
+ * Arena::release(memory);
+ *----------------------------------------------------------------------------*/
+class Arena {
+ public:
+  static const uint8_t SLOTS = 3;
+  // Largest state of an animation (Plasma with its baked noise loop)
+  static const size_t SLOT = 22 * 1024;
+
+  // A free slot, nullptr when all of them are taken
+  static void *acquire();
+  // Give a slot back
+  static void release(void *slot);
+  // Slots that are free
+  static uint8_t available();
+  // The slots, see core/Footprint.h
+  static void footprint(Footprint::usage_t &usage);
+
+ private:
+  alignas(8) static uint8_t memory[SLOTS][SLOT];
+  static bool taken[SLOTS];
+};
+#endif
@@ -0,0 +1,71 @@
+#include "Boot.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+
+#include "Calibration.h"
+#include "ESP8266.h"
+#include "LCD.h"
+#include "Net.h"
+#include "Scheduler.h"
+/*------------------------------------------------------------------------------
+ * BOOT CLASS
+ *----------------------------------------------------------------------------*/
+static bool request_time() {
+  // The UART or Internet might fail, the time comes in as an event anyway
+  ESP8266::request_time();
+  return true;
+}
+
+static bool calibrate() {
+  // Gains of the leds from calibration.bin, on flash or the SD card
+  Calibration::load();
+  return true;
+}
+
+static bool gui() {
+  LCD::build();
+  return true;
+}
+
+const Boot::stage_t Boot::stages[STAGES] = {
+    {"time", request_time},
+    {"calibration", calibrate},
+    {"ethernet", Net::begin},
+    {"lcd", LCD::begin},
+    {"gui", gui},
+};
+uint32_t Boot::setup = 0;
+uint32_t Boot::first_frame = 0;
+uint32_t Boot::ready = 0;
+uint32_t Boot::took[STAGES] = {};
+uint8_t Boot::next = 0;
+
+void Boot::begin() { setup = micros(); }
+
+bool Boot::loop() {
+  if (ready) return false;
+  if (!first_frame) {
+    if (!Scheduler::frames) return false;
+    first_frame = micros();
+    return false;
+  }
+  const uint32_t start = micros();
+  const bool up = stages[next].run();
+  const uint32_t end = micros();
+  took[next] += end - start;
+  if (!up || ++next < STAGES) return false;
+  ready = end;
+  return true;
+}
+
+int Boot::report(char *buffer, const size_t size) {
+  int n = snprintf(buffer, size, "Boot setup %lu ms  first frame %lu ms",
+                   setup / 1000, first_frame / 1000);
+  for (uint8_t i = 0; i < STAGES && n >= 0 && (size_t)n < size; i++)
+    n += snprintf(buffer + n, size - n, "  %s %lu.%lu ms", stages[i].name,
+                  took[i] / 1000, took[i] / 100 % 10);
+  if (n >= 0 && (size_t)n < size)
+    n += snprintf(buffer + n, size - n, "  ready %lu ms", ready / 1000);
+  return n;
+}
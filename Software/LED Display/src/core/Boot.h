@@ -0,0 +1,53 @@
+#ifndef BOOT_H
+#define BOOT_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * BOOT CLASS
+ *------------------------------------------------------------------------------
+ * Brings up the slow parts of the cube over the first frames instead of
+ * before them. setup() only starts the display and the rotor, reads the
+ * config and opens the serial ports, so the first frame goes out right away.
+ * loop() then runs one stage per main loop after the frame was drawn: the
+ * time request to the ESP8266, the calibration, Ethernet on the Teensy 4.1,
+ * the LCD driver and the LVGL GUI. A stage that is not ready yet (the LCD does not answer) is tried
+ * again in the next loop without holding up the frames, the slow stages come
+ * last.
+ *
+ * Every stage is timed, with the time to the first frame and to the end of
+ * the boot, and the times go out with the telemetry.
+ *
+ * Boot::begin();         // last in setup()
+ * if (Boot::loop()) ...  // every main loop, true once when the boot is done
+ *----------------------------------------------------------------------------*/
+class Boot {
+ public:
+  static const uint8_t STAGES = 5;
+
+  struct stage_t {
+    const char *name;
+    // Bring the part up, false to be called again in the next loop
+    bool (*run)();
+  };
+
+  // Microseconds since reset at the end of setup(), the first frame submitted
+  // and the end of the last stage, 0 until then
+  static uint32_t setup;
+  static uint32_t first_frame;
+  static uint32_t ready;
+  // Microseconds each stage took, retries included
+  static uint32_t took[STAGES];
+
+  // The end of setup()
+  static void begin();
+  // Run the next stage once the first frame is out, true when it was the last
+  static bool loop();
+  static bool done() { return ready != 0; }
+  // Print the times in a line, returns the amount printed
+  static int report(char *buffer, const size_t size);
+
+ private:
+  static const stage_t stages[STAGES];
+  static uint8_t next;
+};
+#endif
@@ -0,0 +1,84 @@
+#include "Bus.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+
+#include "LCD.h"
+/*------------------------------------------------------------------------------
+ * BUS CLASS
+ *----------------------------------------------------------------------------*/
+static const char *const names[Bus::CLIENTS] = {"playback", "recording",
+                                                "screen", "touch"};
+
+Bus::stats_t Bus::stats[CLIENTS] = {};
+uint8_t Bus::owner = NONE;
+uint32_t Bus::since = 0;
+uint8_t Bus::waiting = 0;
+uint8_t Bus::asking = 0;
+uint32_t Bus::waited[CLIENTS] = {};
+bool Bus::draining = false;
+
+void Bus::drain() {
+  if (!draining || LCD::busy()) return;
+  draining = false;
+  stats[SCREEN].micros += micros() - since;
+  owner = NONE;
+}
+
+void Bus::loop() {
+  drain();
+  waiting = asking;
+  asking = 0;
+}
+
+bool Bus::acquire(const client_t client) {
+  drain();
+  const uint32_t now = micros();
+  const uint8_t bit = 1 << client;
+  if (!((waiting | asking) & bit)) waited[client] = now;
+  bool ahead = owner != NONE;
+  // Clients before this one in the queue, unless it starved
+  if (!ahead && now - waited[client] < STARVE)
+    ahead = (waiting | asking) & (bit - 1);
+  if (ahead) {
+    asking |= bit;
+    stats[client].refused++;
+    return false;
+  }
+  waiting &= ~bit;
+  asking &= ~bit;
+  owner = client;
+  since = now;
+  stats[client].grants++;
+  return true;
+}
+
+void Bus::release(const client_t client, const uint32_t size) {
+  if (owner != client) return;
+  stats[client].bytes += size;
+  if (client == SCREEN && LCD::busy()) {
+    draining = true;
+    return;
+  }
+  stats[client].micros += micros() - since;
+  owner = NONE;
+}
+
+bool Bus::idle() {
+  drain();
+  return owner == NONE && !LCD::busy();
+}
+
+int Bus::report(char *buffer, const size_t size) {
+  int n = snprintf(buffer, size, "SPI");
+  for (uint8_t c = 0; c < CLIENTS && n >= 0 && (size_t)n < size; c++) {
+    const stats_t &s = stats[c];
+    n += snprintf(buffer + n, size - n, "  %s %lu/%lu %lu KB %lu ms",
+                  names[c], s.grants, s.refused, s.bytes / 1024,
+                  s.micros / 1000);
+  }
+  if (n >= 0 && (size_t)n < size)
+    n += snprintf(buffer + n, size - n, " (grants/refused)");
+  for (uint8_t c = 0; c < CLIENTS; c++) stats[c] = stats_t();
+  return n;
+}
@@ -0,0 +1,72 @@
+#ifndef BUS_H
+#define BUS_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * BUS CLASS
+ *------------------------------------------------------------------------------
+ * Hands out the SPI bus of the LCD board (SCK 13, MOSI 11, MISO 12) that the
+ * screen, the touch controller and the SD card share. A client asks for the
+ * bus with acquire() when it has work and gives it back with release(). The
+ * screen keeps it until the update its GUI call started has gone out by DMA
+ * in the background.
+ *
+ * A client that was refused waits in the queue until the next main loop,
+ * and the bus goes to the waiting client of the highest priority: playback
+ * before recording before the screen before touch. loop() starts a main loop
+ * and frees the bus as soon as a screen update has ended, so the next
+ * client in the queue gets it in the same loop. A client that stops asking
+ * leaves the queue with the loop, one that waited STARVE goes first.
+ *
+ * The grants, refusals, bytes and time on the bus per client are counted
+ * until the report.
+ *
+ * if (!Bus::acquire(Bus::PLAYBACK)) return;
+ * const int read = file.read(data, n);
+ * Bus::release(Bus::PLAYBACK, read);
+ *----------------------------------------------------------------------------*/
+class Bus {
+ public:
+  // In order of priority
+  enum client_t : uint8_t { PLAYBACK, RECORDING, SCREEN, TOUCH, CLIENTS };
+  // A client that waited this long goes first (us)
+  static const uint32_t STARVE = 50000;
+
+  struct stats_t {
+    uint32_t grants;
+    uint32_t refused;
+    uint32_t bytes;
+    uint32_t micros;
+  };
+  static stats_t stats[CLIENTS];
+
+  // First in the main loop, before the clients
+  static void loop();
+
+  // The bus for the client, false while another has it or a client before it
+  // waits, it is then queued
+  static bool acquire(const client_t client);
+  // Give the bus back after size bytes, the screen keeps it while its update
+  // runs
+  static void release(const client_t client, const uint32_t size = 0);
+  // Nobody is on the bus, for the accesses that can not be queued
+  static bool idle();
+  // Print the stats per client and reset them, returns the amount printed
+  static int report(char *buffer, const size_t size);
+
+ private:
+  static const uint8_t NONE = 0xFF;
+  static uint8_t owner;
+  static uint32_t since;
+  // Bit per client refused in the last main loop and in this one, the start
+  // of its wait
+  static uint8_t waiting;
+  static uint8_t asking;
+  static uint32_t waited[CLIENTS];
+  // The screen released the bus with an update running
+  static bool draining;
+
+  // Let go of the bus when the update of the screen is done
+  static void drain();
+};
+#endif
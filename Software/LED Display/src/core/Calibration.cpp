@@ -0,0 +1,67 @@
+#include "Calibration.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+#include "Card.h"
+#include "Config.h"
+#include "Display.h"
+#include "Log.h"
+/*------------------------------------------------------------------------------
+ * CALIBRATION CLASS
+ *----------------------------------------------------------------------------*/
+static const char *FILE_NAME = "calibration.bin";
+// Entries read at a time
+static const uint16_t CHUNK = 64;
+
+DMAMEM uint8_t Calibration::gain[LEDS][3];
+uint16_t Calibration::masked = 0;
+
+// Same for a LittleFS File and an SD card FsFile
+template <typename F>
+bool Calibration::read(F &file) {
+  header_t header;
+  if (file.read(&header, sizeof(header)) != sizeof(header) ||
+      memcmp(header.magic, "MCAL", 4) != 0 || header.version != 1)
+    return false;
+  entry_t entries[CHUNK];
+  uint16_t count = 0;
+  for (uint16_t i = 0; i < LEDS; i += CHUNK) {
+    if (file.read(entries, sizeof(entries)) != sizeof(entries)) return false;
+    for (uint16_t j = 0; j < CHUNK; j++) {
+      const entry_t &e = entries[j];
+      for (uint8_t c = 0; c < 3; c++) {
+        const bool dead = e.mask >> c & 1;
+        gain[i + j][c] = dead ? 0 : e.gain[c] * header.white[c] / 255;
+      }
+      if (e.mask & 7) count++;
+    }
+  }
+  masked = count;
+  return true;
+}
+
+bool Calibration::load() {
+  // Not while the transpose reads the gains
+  Display::setCalibration(nullptr);
+  bool loaded = false;
+  FS *fs = config.filesystem();
+  if (fs && fs->exists(FILE_NAME)) {
+    File f = fs->open(FILE_NAME, FILE_READ);
+    if (f) {
+      loaded = read(f);
+      f.close();
+    }
+  } else if (Card::mount()) {
+    Card::wait();
+    FsFile f;
+    if (f.open(FILE_NAME, O_RDONLY)) {
+      loaded = read(f);
+      f.close();
+    }
+  }
+  if (!loaded) return false;
+  Display::setCalibration(gain);
+  LOG(CALIBRATION, masked);
+  return true;
+}
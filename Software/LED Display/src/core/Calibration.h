@@ -0,0 +1,51 @@
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+#include <stdint.h>
+
+#include "Transpose.h"
+/*------------------------------------------------------------------------------
+ * CALIBRATION CLASS
+ *------------------------------------------------------------------------------
+ * Evens out the leds of a cube built from several batches. calibration.bin,
+ * on the LittleFS of the config files or else on the SD card, holds a gain
+ * for the red, green and blue die of every led and mask bits for the dies
+ * that are dead or flicker. It is made by calibrate.py from measurements of
+ * the leds, little endian:
+ *
+ *   "MCAL", version (1), white point red, green, blue (0-255),
+ *   LEDS * {red, green, blue gain (0-255), mask (bit 0 red, 1 green, 2 blue)}
+ *
+ * in wire order (led * CHANNELS + chn), so it belongs to the leds and not to
+ * the orientation. The white point scales every gain of its color, a masked
+ * die gets gain 0. The folded gains go to Display::setCalibration(), which
+ * applies them in the transpose as a multiply of the power scale: no pass of
+ * its own and nothing for the animations to do.
+ *
+ * if (Calibration::load()) ...  // at startup, after config.load()
+ *----------------------------------------------------------------------------*/
+class Calibration {
+ public:
+  static const uint16_t LEDS = Transpose::LEDCOUNT * Transpose::CHANNELS;
+
+  // Read calibration.bin and hand the gains to the display, false without a
+  // valid one (the display stays uncalibrated)
+  static bool load();
+  // Leds with a masked die
+  static uint16_t masked;
+
+ private:
+  struct header_t {
+    char magic[4];
+    uint8_t version;
+    uint8_t white[3];
+  };
+  struct entry_t {
+    uint8_t gain[3];
+    uint8_t mask;
+  };
+  static uint8_t gain[LEDS][3];
+
+  template <typename F>
+  static bool read(F &file);
+};
+#endif
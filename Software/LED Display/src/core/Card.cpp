@@ -0,0 +1,26 @@
+#include "Card.h"
+
+#include "Bus.h"
+#include "LCD.h"
+/*------------------------------------------------------------------------------
+ * CARD CLASS
+ *----------------------------------------------------------------------------*/
+SdFs Card::fs;
+
+bool Card::mount() {
+  static bool mounted = false;
+  static uint32_t tried = 0;
+  if (mounted) return true;
+  if (tried && millis() - tried < 5000) return false;
+  tried = millis() | 1;
+  wait();
+  mounted = fs.begin(SdSpiConfig(LCD::SD_CS, SHARED_SPI, SD_SCK_MHZ(24)));
+  return mounted;
+}
+
+bool Card::idle() { return Bus::idle(); }
+
+void Card::wait() {
+  while (!idle())
+    ;
+}
@@ -0,0 +1,26 @@
+#ifndef CARD_H
+#define CARD_H
+#include <SdFat.h>
+/*------------------------------------------------------------------------------
+ * CARD CLASS
+ *------------------------------------------------------------------------------
+ * The SD card of the LCD board, on the SPI bus of the screen. It is mounted
+ * on first use, a missing card is tried again every few seconds. The screen
+ * driver updates in the background, the slices of the card are handed the
+ * bus by Bus.h, other accesses wait until idle() is true. Reads and writes
+ * are done in slices of SLICE bytes from the main loop, a slice at 24 MHz
+ * takes about 1.5 ms.
+ *----------------------------------------------------------------------------*/
+class Card {
+ public:
+  static const uint32_t SLICE = 4096;
+  static SdFs fs;
+
+  // Mount the card once, false while there is none
+  static bool mount();
+  // Nobody else is on the bus
+  static bool idle();
+  // Wait until idle, before the accesses that can not be sliced
+  static void wait();
+};
+#endif
@@ -0,0 +1,566 @@
+#include "Config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Schema.h"
+#include "power/Crc.h"
+/*------------------------------------------------------------------------------
+ * CONFIG PERSISTENCE
+ *------------------------------------------------------------------------------
+ * config.json is the canonical form, readable and editable, and holds the
+ * fields that differ from the defaults in flash. config.bin is a snapshot
+ * of the Settings bytes, with a header that tells
+ * if it is still current: same layout (version, build and size), made from a
+ * config.json with the same size and modify time, and an intact CRC. A current snapshot is read
+ * with a single memcpy at boot, the JSON is only parsed when it is not.
+ * The JSON fields and their ranges come from the Schema table.
+ *----------------------------------------------------------------------------*/
+#define CONFIG_JSON "/config.json"
+#define CONFIG_SNAPSHOT "/config.bin"
+#define CONFIG_TEMP "/config.tmp"
+#define CONFIG_JOURNAL "/config.jnl"
+// Bump when the meaning of stored bytes changes without changing the layout
+#define CONFIG_SNAPSHOT_VERSION 2
+
+// Size and modify time of config.json, both 0 for none. Read from the
+// directory entry, not the file, and an edit over USB changes the time
+struct json_stamp_t {
+  uint32_t size;
+  uint32_t time;
+};
+
+struct snapshot_t {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  // Hash of the build time, a new build may have moved fields
+  uint32_t build;
+  // The config.json the snapshot was taken from
+  json_stamp_t json;
+  uint32_t crc;
+};
+static const uint32_t SNAPSHOT_MAGIC = 0x4743464D;  // "MCFG"
+// Only the persistent part, the devices are live input
+static const size_t SNAPSHOT_SIZE = sizeof(Settings);
+
+// Sections of the snapshot that are journaled on their own, every animation
+// has one and the animation settings before them share one
+struct section_t {
+  uint16_t offset;
+  uint16_t size;
+};
+#define SECTION(s) {offsetof(Settings, s), sizeof(((Settings *)0)->s)}
+static const section_t sections[] = {
+    SECTION(power),
+    SECTION(display),
+    SECTION(modulation),
+    SECTION(network),
+    {offsetof(Settings, animation),
+     offsetof(Settings, animation.accelerometer) -
+         offsetof(Settings, animation)},
+    SECTION(animation.accelerometer),
+    SECTION(animation.arrows),
+    SECTION(animation.atoms),
+    SECTION(animation.cube),
+    SECTION(animation.fireworks),
+    SECTION(animation.helix),
+    SECTION(animation.life),
+    SECTION(animation.mario),
+    SECTION(animation.plasma),
+    SECTION(animation.pong),
+    SECTION(animation.arc_scroller),
+    SECTION(animation.box_scroller),
+    SECTION(animation.sinus),
+    SECTION(animation.spectrum),
+    SECTION(animation.starfield),
+    SECTION(animation.twinkels),
+    SECTION(animation.rain),
+    SECTION(animation.aurora),
+    SECTION(animation.lavalamp),
+    SECTION(animation.fireflies),
+    SECTION(animation.ocean),
+    SECTION(animation.lorenz),
+    SECTION(animation.torus),
+    SECTION(animation.sierpinski),
+    SECTION(animation.moebius),
+    SECTION(animation.spirograph),
+    SECTION(animation.snake),
+    SECTION(animation.tetris),
+    SECTION(animation.pong3d),
+    SECTION(animation.maze),
+    SECTION(animation.globe),
+    SECTION(animation.dna),
+    SECTION(animation.heart),
+    SECTION(animation.hourglass),
+    SECTION(animation.galaxy),
+    SECTION(animation.tornado),
+    SECTION(animation.fountain),
+    SECTION(animation.explosion),
+    SECTION(animation.boids),
+    SECTION(animation.matrix),
+    SECTION(animation.ripple),
+    SECTION(animation.kaleidoscope),
+    SECTION(animation.interference),
+    SECTION(animation.streaming),
+    SECTION(animation.playback),
+    SECTION(animation.program),
+};
+#undef SECTION
+static const uint8_t SECTIONS = sizeof(sections) / sizeof(sections[0]);
+
+static LittleFS_Program fs;
+
+static bool mount() {
+  static bool mounted = fs.begin(CONFIG_FS_SIZE);
+  return mounted;
+}
+
+FS *Config::filesystem() { return mount() ? &fs : nullptr; }
+
+static uint32_t build_hash() {
+  // FNV-1a
+  uint32_t h = 2166136261u;
+  for (const char *p = __DATE__ " " __TIME__; *p; p++) h = (h ^ *p) * 16777619u;
+  return h;
+}
+
+// The size alone would miss an edit of the same length, like a brightness
+// of 100 changed to 200, so the modify time goes along, packed like FAT
+static json_stamp_t json_stamp() {
+  json_stamp_t stamp = {0, 0};
+  if (!fs.exists(CONFIG_JSON)) return stamp;
+  File file = fs.open(CONFIG_JSON, FILE_READ);
+  if (!file) return stamp;
+  stamp.size = file.size();
+  DateTimeFields tm;
+  if (file.getModifyTime(tm))
+    stamp.time = (uint32_t)tm.year << 25 | (uint32_t)tm.mon << 21 |
+                 (uint32_t)tm.mday << 16 | (uint32_t)tm.hour << 11 |
+                 (uint32_t)tm.min << 5 | tm.sec >> 1;
+  file.close();
+  return stamp;
+}
+
+// Writes config.json text through to a file and notes a write that took
+// less, which leaves the file short of text
+class CheckedPrint : public Print {
+ public:
+  explicit CheckedPrint(Print &out) : out(out) {}
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override {
+    const size_t n = out.write(buffer, size);
+    if (n != size) failed = true;
+    return n;
+  }
+  bool failed = false;
+
+ private:
+  Print &out;
+};
+
+/*------------------------------------------------------------------------------
+ * SNAPSHOT AND JOURNAL
+ *------------------------------------------------------------------------------
+ * config.jnl holds the sections changed since the snapshot as records of
+ * offset, size, bytes and a CRC-32. Its header names the CRC of the snapshot
+ * it builds on, a journal over any other snapshot is ignored. A record cut
+ * short by a reset fails its CRC and ends the replay.
+ *----------------------------------------------------------------------------*/
+struct journal_t {
+  uint32_t magic;
+  uint32_t base;
+};
+struct record_t {
+  uint16_t offset;
+  uint16_t size;
+};
+static const uint32_t JOURNAL_MAGIC = 0x4C4E4A4D;  // "MJNL"
+
+// The bytes as they are on flash, with the runtime flags cleared
+static uint8_t persisted[SNAPSHOT_SIZE];
+// The config as it is now, with the runtime flags cleared
+alignas(Settings) static uint8_t staging[SNAPSHOT_SIZE];
+// CRC of the snapshot on flash, only valid when there is one
+static uint32_t base;
+static bool based = false;
+static uint32_t journal_size = 0;
+
+// Copy the config without the runtime flags
+static void stage(const Config &c, uint8_t *bytes) {
+  memcpy(bytes, (const Settings *)&c, SNAPSHOT_SIZE);
+  Settings *copy = (Settings *)bytes;
+  copy->animation.changed = false;
+  copy->animation.play_one = false;
+}
+
+// Copy bytes into the config but keep its runtime flags
+static void unstage(Config &c, const uint8_t *bytes, const uint16_t offset,
+                    const uint16_t size) {
+  const boolean changed = c.animation.changed;
+  const boolean play_one = c.animation.play_one;
+  memcpy((uint8_t *)(Settings *)&c + offset, bytes + offset, size);
+  c.animation.changed = changed;
+  c.animation.play_one = play_one;
+}
+
+static bool read_snapshot(Config &c, const json_stamp_t json) {
+  if (!fs.exists(CONFIG_SNAPSHOT)) return false;
+  File file = fs.open(CONFIG_SNAPSHOT, FILE_READ);
+  if (!file) return false;
+  // Read aside so a bad snapshot leaves the config untouched
+  snapshot_t header;
+  const bool complete =
+      file.read(&header, sizeof(header)) == sizeof(header) &&
+      file.read(persisted, SNAPSHOT_SIZE) == SNAPSHOT_SIZE;
+  file.close();
+  if (!complete || header.magic != SNAPSHOT_MAGIC ||
+      header.version != CONFIG_SNAPSHOT_VERSION ||
+      header.size != SNAPSHOT_SIZE || header.build != build_hash() ||
+      header.json.size != json.size || header.json.time != json.time ||
+      header.crc != crc32(persisted, SNAPSHOT_SIZE))
+    return false;
+  base = header.crc;
+  based = true;
+  unstage(c, persisted, 0, SNAPSHOT_SIZE);
+  return true;
+}
+
+// Apply the intact records of a journal over the snapshot
+static void read_journal(Config &c) {
+  journal_size = 0;
+  if (!fs.exists(CONFIG_JOURNAL)) return;
+  File file = fs.open(CONFIG_JOURNAL, FILE_READ);
+  if (!file) return;
+  journal_t header;
+  if (file.read(&header, sizeof(header)) == sizeof(header) &&
+      header.magic == JOURNAL_MAGIC && header.base == base) {
+    uint32_t size = sizeof(header);
+    record_t record;
+    uint32_t crc;
+    while (file.read(&record, sizeof(record)) == sizeof(record) &&
+           record.offset + record.size <= SNAPSHOT_SIZE &&
+           file.read(&staging[record.offset], record.size) == record.size &&
+           file.read(&crc, sizeof(crc)) == sizeof(crc) &&
+           crc == crc32(&staging[record.offset], record.size,
+                        crc32(&record, sizeof(record)))) {
+      memcpy(&persisted[record.offset], &staging[record.offset], record.size);
+      size += sizeof(record) + record.size + sizeof(crc);
+    }
+    unstage(c, persisted, 0, SNAPSHOT_SIZE);
+    journal_size = size;
+  }
+  file.close();
+}
+
+static void write_snapshot(const uint8_t *bytes, const json_stamp_t json) {
+  snapshot_t header;
+  header.magic = SNAPSHOT_MAGIC;
+  header.version = CONFIG_SNAPSHOT_VERSION;
+  header.size = SNAPSHOT_SIZE;
+  header.build = build_hash();
+  header.json = json;
+  header.crc = crc32(bytes, SNAPSHOT_SIZE);
+  // A snapshot cut short by a reset fails its checks and is ignored
+  fs.remove(CONFIG_SNAPSHOT);
+  File file = fs.open(CONFIG_SNAPSHOT, FILE_WRITE);
+  if (!file) return;
+  file.write(&header, sizeof(header));
+  file.write(bytes, SNAPSHOT_SIZE);
+  file.close();
+  base = header.crc;
+  based = true;
+}
+
+/*------------------------------------------------------------------------------
+ * WRITE BEHIND
+ *------------------------------------------------------------------------------
+ * loop() compares the config with the bytes on flash every CONFIG_POLL_MS and
+ * marks the sections that differ. Once nothing changed for CONFIG_QUIET_MS the
+ * dirty sections are appended to the journal. When the journal would grow
+ * beyond CONFIG_JOURNAL_MAX, or CONFIG_COMPACT_MS after its last record, it
+ * is compacted into a new config.json and snapshot and removed. All writes
+ * go out in slices of CONFIG_WRITE_CHUNK bytes, one slice per loop(). A
+ * write that fails leaves the sections dirty and is tried again after
+ * CONFIG_RETRY_MS, twice as long after every further failure.
+ *----------------------------------------------------------------------------*/
+enum class store_t : uint8_t { IDLE, JOURNAL, JSON, SNAPSHOT };
+enum class slice_t : uint8_t { MORE, DONE, FAILED };
+
+static store_t store = store_t::IDLE;
+static uint32_t retry_at = 0;
+static uint32_t backoff = CONFIG_RETRY_MS;
+// A failed append may have left a record cut short, which ends the replay,
+// so the next write compacts instead
+static bool broken = false;
+static uint64_t dirty = 0;
+static uint32_t last_poll = 0;
+static uint32_t last_change = 0;
+static uint32_t last_record = 0;
+// The file being appended to and the bytes still to go
+static const char *out_path;
+static const uint8_t *out_data;
+static uint32_t out_size;
+static uint32_t out_done;
+// Room for a journal header and every section as a record
+static uint8_t records[sizeof(journal_t) +
+                       SECTIONS * (sizeof(record_t) + sizeof(uint32_t)) +
+                       SNAPSHOT_SIZE];
+static uint32_t records_size;
+
+void Config::footprint(Footprint::usage_t &usage) {
+  usage.add(&config, sizeof(config));
+  usage.add(persisted, sizeof(persisted));
+  usage.add(staging, sizeof(staging));
+  usage.add(records, sizeof(records));
+}
+// config.json being written from staging
+static Schema::cursor_t json_cursor;
+
+static void begin_write(const char *path, const uint8_t *data,
+                        const uint32_t size) {
+  out_path = path;
+  out_data = data;
+  out_size = size;
+  out_done = 0;
+}
+
+// Append the next slice, a file that does not open or takes less fails
+static slice_t write_slice() {
+  if (out_done < out_size) {
+    File file = fs.open(out_path, FILE_WRITE);
+    if (!file) return slice_t::FAILED;
+    uint32_t n = out_size - out_done;
+    if (n > CONFIG_WRITE_CHUNK) n = CONFIG_WRITE_CHUNK;
+    const size_t written = file.write(out_data + out_done, n);
+    file.close();
+    if (written != n) return slice_t::FAILED;
+    out_done += n;
+  }
+  return out_done >= out_size ? slice_t::DONE : slice_t::MORE;
+}
+
+// Back to idle with the sections still dirty, to try again after a wait
+static void retry(const uint32_t now) {
+  retry_at = now + backoff;
+  backoff = backoff * 2 < CONFIG_RETRY_MAX_MS ? backoff * 2
+                                              : CONFIG_RETRY_MAX_MS;
+  store = store_t::IDLE;
+}
+
+// Records of the dirty sections, headed by the journal header when new
+static void begin_journal() {
+  uint8_t *p = records;
+  if (journal_size == 0) {
+    fs.remove(CONFIG_JOURNAL);
+    journal_t header = {JOURNAL_MAGIC, base};
+    memcpy(p, &header, sizeof(header));
+    p += sizeof(header);
+  }
+  for (uint8_t i = 0; i < SECTIONS; i++) {
+    if (!(dirty & (1ull << i))) continue;
+    const record_t record = {sections[i].offset, sections[i].size};
+    const uint32_t crc = crc32(&staging[record.offset], record.size,
+                               crc32(&record, sizeof(record)));
+    memcpy(p, &record, sizeof(record));
+    p += sizeof(record);
+    memcpy(p, &staging[record.offset], record.size);
+    p += record.size;
+    memcpy(p, &crc, sizeof(crc));
+    p += sizeof(crc);
+  }
+  records_size = p - records;
+  begin_write(CONFIG_JOURNAL, records, records_size);
+  store = store_t::JOURNAL;
+}
+
+// config.json goes out from staging, which was just staged from the config
+// and stays as it is until the store is idle again
+static void begin_compaction() {
+  fs.remove(CONFIG_TEMP);
+  json_cursor = Schema::cursor_t();
+  store = store_t::JSON;
+}
+
+// Append the next slice of config.json, a file that does not open or takes
+// less fails, and so does a document without a byte
+static slice_t write_json_slice() {
+  File file = fs.open(CONFIG_TEMP, FILE_WRITE);
+  if (!file) return slice_t::FAILED;
+  CheckedPrint out(file);
+  const bool done = Schema::write_json(out, json_cursor, CONFIG_WRITE_CHUNK,
+                                       *(const Settings *)staging);
+  file.close();
+  if (out.failed) return slice_t::FAILED;
+  if (!done) return slice_t::MORE;
+  return json_cursor.bytes ? slice_t::DONE : slice_t::FAILED;
+}
+
+static void end_compaction() {
+  broken = false;
+  dirty = 0;
+  journal_size = 0;
+  fs.remove(CONFIG_JOURNAL);
+  memcpy(persisted, staging, SNAPSHOT_SIZE);
+}
+
+/*------------------------------------------------------------------------------
+ * CONFIG
+ *----------------------------------------------------------------------------*/
+void Config::load() {
+  if (!mount()) return;
+  const json_stamp_t json = json_stamp();
+  if (read_snapshot(*this, json)) {
+    read_journal(*this);
+    last_record = millis();
+    return;
+  }
+  based = false;
+  journal_size = 0;
+  stage(*this, persisted);
+  if (!fs.exists(CONFIG_JSON)) {
+    // No config.json, keep the values supplied in the code
+    fs.remove(CONFIG_SNAPSHOT);
+    fs.remove(CONFIG_JOURNAL);
+    return;
+  }
+  File file = fs.open(CONFIG_JSON, FILE_READ);
+  if (!file) return;
+  const int found = Schema::read_json(file, *this);
+  file.close();
+  if (found < 0) return;
+  stage(*this, persisted);
+  write_snapshot(persisted, json);
+  fs.remove(CONFIG_JOURNAL);
+}
+
+void Config::save() {
+  if (!mount()) return;
+  // Write aside first, a reset while writing keeps the old config.json
+  fs.remove(CONFIG_TEMP);
+  File file = fs.open(CONFIG_TEMP, FILE_WRITE);
+  if (!file) return;
+  Schema::cursor_t cursor;
+  CheckedPrint out(file);
+  Schema::write_json(out, cursor, SIZE_MAX, *this);
+  file.close();
+  // Only a complete config.json replaces the old one
+  if (out.failed || !cursor.bytes) {
+    fs.remove(CONFIG_TEMP);
+    return;
+  }
+  fs.remove(CONFIG_JSON);
+  fs.rename(CONFIG_TEMP, CONFIG_JSON);
+  stage(*this, staging);
+  write_snapshot(staging, json_stamp());
+  end_compaction();
+  store = store_t::IDLE;
+}
+
+void Config::loop() {
+  if (!mount()) return;
+  const uint32_t now = millis();
+  switch (store) {
+    case store_t::IDLE:
+      if (now - last_poll < CONFIG_POLL_MS) return;
+      last_poll = now;
+      stage(*this, staging);
+      for (uint8_t i = 0; i < SECTIONS; i++) {
+        const section_t &s = sections[i];
+        if (memcmp(&staging[s.offset], &persisted[s.offset], s.size)) {
+          if (!(dirty & (1ull << i))) last_change = now;
+          dirty |= 1ull << i;
+        } else {
+          dirty &= ~(1ull << i);
+        }
+      }
+      if ((int32_t)(now - retry_at) < 0) break;
+      if (dirty && now - last_change >= CONFIG_QUIET_MS) {
+        // Without a snapshot there is nothing to journal against
+        if (!based || broken) {
+          begin_compaction();
+        } else {
+          begin_journal();
+          if (journal_size + records_size > CONFIG_JOURNAL_MAX) {
+            store = store_t::IDLE;
+            begin_compaction();
+          }
+        }
+      } else if (!dirty && journal_size &&
+                 now - last_record >= CONFIG_COMPACT_MS) {
+        begin_compaction();
+      }
+      break;
+    case store_t::JOURNAL: {
+      const slice_t slice = write_slice();
+      if (slice == slice_t::MORE) return;
+      if (slice == slice_t::FAILED) {
+        broken = true;
+        retry(now);
+        return;
+      }
+      backoff = CONFIG_RETRY_MS;
+      for (uint8_t i = 0; i < SECTIONS; i++) {
+        if (!(dirty & (1ull << i))) continue;
+        const section_t &s = sections[i];
+        memcpy(&persisted[s.offset], &staging[s.offset], s.size);
+      }
+      dirty = 0;
+      journal_size += records_size;
+      last_record = now;
+      store = store_t::IDLE;
+      break;
+    }
+    case store_t::JSON: {
+      const slice_t slice = write_json_slice();
+      if (slice == slice_t::MORE) return;
+      // The old config.json and snapshot stay, the compaction starts over
+      if (slice == slice_t::FAILED) {
+        fs.remove(CONFIG_TEMP);
+        retry(now);
+        return;
+      }
+      fs.remove(CONFIG_JSON);
+      fs.rename(CONFIG_TEMP, CONFIG_JSON);
+      // From here the old journal no longer matches, until the new snapshot
+      // is complete the JSON is used
+      based = false;
+      fs.remove(CONFIG_SNAPSHOT);
+      {
+        snapshot_t header;
+        header.magic = SNAPSHOT_MAGIC;
+        header.version = CONFIG_SNAPSHOT_VERSION;
+        header.size = SNAPSHOT_SIZE;
+        header.build = build_hash();
+        header.json = json_stamp();
+        header.crc = crc32(staging, SNAPSHOT_SIZE);
+        base = header.crc;
+        File file = fs.open(CONFIG_SNAPSHOT, FILE_WRITE);
+        if (file) {
+          file.write(&header, sizeof(header));
+          file.close();
+        }
+      }
+      // The header goes out at once, the bytes in slices straight from
+      // staging, which only changes again once the store is idle
+      begin_write(CONFIG_SNAPSHOT, staging, SNAPSHOT_SIZE);
+      store = store_t::SNAPSHOT;
+      break;
+    }
+    case store_t::SNAPSHOT: {
+      const slice_t slice = write_slice();
+      if (slice == slice_t::MORE) return;
+      // config.json is complete, a snapshot cut short fails its checks
+      if (slice == slice_t::FAILED) {
+        retry(now);
+        return;
+      }
+      backoff = CONFIG_RETRY_MS;
+      based = true;
+      end_compaction();
+      store = store_t::IDLE;
+      break;
+    }
+  }
+}
@@ -6,10 +6,25 @@
 #include <stdint.h>
 #include <string>
 
+#include "Devices.h"
+#include "Footprint.h"
+#include "power/Noise.h"
+
 // Json document size to hold the commands send between client/server
 #define COMMAND_DOC_SIZE 255
-// Json document size to hold the config (depends on config size)
-#define CONFIG_DOC_SIZE 20000
+// Program flash reserved for the LittleFS holding the config files
+#define CONFIG_FS_SIZE (256 * 1024)
+// Write behind: look for changes every poll, write them after a quiet
+// period, compact the journal when it is full or has been idle long enough
+#define CONFIG_POLL_MS 100
+#define CONFIG_QUIET_MS 2000
+#define CONFIG_COMPACT_MS 60000
+#define CONFIG_JOURNAL_MAX 8192
+#define CONFIG_WRITE_CHUNK 256
+// A write that failed is tried again after a wait, doubled after every
+// failure up to the maximum
+#define CONFIG_RETRY_MS 1000
+#define CONFIG_RETRY_MAX_MS 60000
 /*-----------------------------------------------------------------------------
  * Global parameters
  *
@@ -22,18 +37,136 @@
  * where to apply. And let these parameters take effect. (Be careful of Timers)
  *
  * After creation of the config object, call load() to load the configuration
- * from the "config.json" file and apply the values to the config struct.
+ * from the "config.json" file and apply the values to the config struct. A
+ * binary snapshot "config.bin" of the struct is kept next to it and read
+ * instead when it is current, so the JSON is only parsed after it changed or
+ * after a new build. Call loop() often, it journals changed settings after
+ * they stay put for a while and compacts the journal. See Config.cpp.
  *
  * If no "config.json" exists the config structs keeps the values supplied in
  * the code. After saveing a "config.json" is freshly created.
+ *
+ * The values supplied in the code are kept in flash as the defaults, and
+ * "config.json" only holds the fields that differ from them (see
+ * Schema::overridden()), so it grows with the settings changed instead of
+ * with every field there is. The config struct in RAM stays the place the
+ * firmware reads a setting from, a plain member access.
  *---------------------------------------------------------------------------*/
-struct Config {
+// Post processing of the whole cube after all animations have drawn, every
+// stage is off when zero. See PostProcess.h
+struct post_t {
+  // Keep level * fade / 256 of the previous frame per color channel
+  uint8_t fade_r = 0;
+  uint8_t fade_g = 0;
+  uint8_t fade_b = 0;
+  // Box blur radius in voxels, gaussian repeats the box three times
+  uint8_t blur = 0;
+  bool gaussian = false;
+  // Blur the levels above threshold by radius and add bloom / 256 of them
+  uint8_t bloom = 0;
+  uint8_t threshold = 128;
+  uint8_t radius = 1;
+
+  static constexpr post_t Fade(uint8_t r, uint8_t g, uint8_t b) {
+    post_t p;
+    p.fade_r = r;
+    p.fade_g = g;
+    p.fade_b = b;
+    return p;
+  }
+  static constexpr post_t Blur(uint8_t radius, bool gaussian = false) {
+    post_t p;
+    p.blur = radius;
+    p.gaussian = gaussian;
+    return p;
+  }
+  static constexpr post_t Bloom(uint8_t bloom, uint8_t threshold, uint8_t radius) {
+    post_t p;
+    p.bloom = bloom;
+    p.threshold = threshold;
+    p.radius = radius;
+    return p;
+  }
+};
+
+// Shape of the fade in and fade out of an animation, see Animation::ease()
+enum class ease_t : uint8_t { LINEAR, QUADRATIC, SMOOTH };
+
+// Audio sources of the modulation bus, see Modulation.h
+enum class modulator_t : uint8_t { NONE, LEVEL, BASS, MID, TREBLE, BEAT };
+
+// A numeric field moved by a modulator while the animations draw, path is
+// a schema path (see Schema.h) and depth is in the units of the field
+struct binding_t {
+  char path[48] = "";
+  modulator_t source = modulator_t::NONE;
+  float depth = 0;
+};
+
+// The persistent settings, the part of the config the Schema covers and the
+// config files hold
+struct Settings {
     struct {
     uint16_t max_milliamps = 18000;
+    // Average current over the last average_minutes the sequence of
+    // animations is planned for (0 is off), see Energy.h
+    uint16_t average_milliamps = 0;
+    uint8_t average_minutes = 10;
     float brightness = 1;
     int16_t motor_speed = -150;
   } power;
 
+  struct {
+    // Target frames per second, 0 draws as fast as the display allows
+    uint16_t fps = 60;
+    // Refresh the leds from frames interpolated between the drawn frames
+    bool interpolate = false;
+    // Slices per revolution of the rotating base, frames follow the rotation
+    // instead of fps while it turns (0 is off)
+    uint16_t pov = 0;
+    // How the cube is mounted, one of the 48 rotations and mirror images of
+    // Display::setOrientation() (0 is as wired)
+    uint8_t orientation = 0;
+    // Record the draw commands of an animation and rasterize them brick by
+    // brick after draw() (see DrawList.h), off draws them at once
+    bool deferred = false;
+    // Trade animation quality for draw time to hold fps (see Governor.h),
+    // between the levels min and max. A draw time over high percent of the
+    // frame period lowers the level, under low percent raises it.
+    struct {
+      bool enabled = false;
+      uint8_t min = 0;
+      uint8_t max = 3;
+      uint8_t high = 90;
+      uint8_t low = 50;
+    } quality;
+    // Reads of the touch screen per second while it is pressed, none while
+    // it is not
+    uint16_t touch_rate = 100;
+    // Seconds without a touch or a change on the LCD before it goes idle (0
+    // is never) and its backlight while idle (0 to 255)
+    uint16_t lcd_idle = 120;
+    uint8_t lcd_dim = 16;
+  } display;
+
+  struct {
+    // Cubes side by side sharing one animation and the position of this one
+    // along x, cube 0 keeps the shared clock (1 is on its own)
+    uint8_t cubes = 1;
+    uint8_t cube = 0;
+  } sync;
+
+  struct {
+    // Seconds for the band energies and envelopes to fall to 1/e of a peak,
+    // and for a beat pulse
+    float release = 1.5f;
+    float beat = 0.2f;
+    binding_t bind0;
+    binding_t bind1;
+    binding_t bind2;
+    binding_t bind3;
+  } modulation;
+
   struct {
     char ssid[32] = "-^..^-";
     char password[64] = "qazwsxedc";
@@ -47,6 +180,11 @@ struct Config {
     boolean play_one = false;
     // Only serialize animation to disk
     uint8_t animation = 0;
+    // Start the next animation while the previous one is still ending
+    boolean crossfade = true;
+    // Replay the frames of periodic animations, see FrameCache.h
+    boolean cache = false;
+    ease_t ease = ease_t::LINEAR;
     struct {
       float runtime = 30.0f;
       float radius = 7.5f;
@@ -94,6 +232,7 @@ struct Config {
       float radius = 7.5f;
       uint8_t brightness = 255;
       uint8_t motionBlur = 220;
+      post_t post = post_t::Bloom(160, 96, 1);
     } fireworks;
     struct {
       float runtime = 30.0f;
@@ -111,6 +250,9 @@ struct Config {
     struct {
       float runtime = 30.0f;
       float interval = 0.20f;
+      // Periods an oscillator is shown before all cells die, 0 starts the
+      // next game as soon as the period is known
+      uint8_t cycles = 6;
       uint8_t brightness = 255;
       uint8_t motionBlur = 0;
     } life;
@@ -138,6 +280,9 @@ struct Config {
       int8_t hue_speed = 30;
       uint8_t brightness = 70;
       uint8_t motionBlur = 0;
+      basis_t basis = basis_t::PERLIN;
+      // Loop baked noise (see NoiseLoop.h) instead of sampling it
+      bool baked = false;
     } plasma;
     struct {
       float starttime = 2.0f;
@@ -215,6 +360,8 @@ struct Config {
       float endtime = 5.0f;
       uint8_t brightness = 255;
       uint8_t motionBlur = 0;
+      // Loop baked noise (see NoiseLoop.h) instead of sampling it
+      bool baked = false;
     } aurora;
     struct {
       float starttime = 5.0f;
@@ -234,6 +381,9 @@ struct Config {
       float starttime = 5.0f;
       float runtime = 30.0f;
       float endtime = 5.0f;
+      float interval = 0.04f;
+      float amplitude = 2.0f;
+      uint8_t damping = 6;
       uint8_t brightness = 255;
       uint8_t motionBlur = 0;
     } ocean;
@@ -243,6 +393,8 @@ struct Config {
       float endtime = 3.0f;
       uint8_t brightness = 255;
       uint8_t motionBlur = 230;
+      // Lorenz, Rossler, Thomas or Aizawa (0 to 3), see power/Attractor.h
+      uint8_t attractor = 0;
     } lorenz;
     struct {
       float starttime = 5.0f;
@@ -257,6 +409,12 @@ struct Config {
       float endtime = 5.0f;
       uint8_t brightness = 255;
       uint8_t motionBlur = 200;
+      // Tetrahedron, corner or sponge (0 to 2) and its depth, see
+      // power/Fractal.h
+      uint8_t fractal = 0;
+      uint8_t depth = 4;
+      // Degrees per second about x on top of the turn about y, 0 for none
+      float tumble = 0.0f;
     } sierpinski;
     struct {
       float starttime = 5.0f;
@@ -297,6 +455,8 @@ struct Config {
       float starttime = 3.0f;
       float runtime = 30.0f;
       float endtime = 3.0f;
+      // Generator and solver steps per frame
+      uint16_t budget = 64;
       uint8_t brightness = 255;
       uint8_t motionBlur = 0;
     } maze;
@@ -325,6 +485,8 @@ struct Config {
       float starttime = 3.0f;
       float runtime = 30.0f;
       float endtime = 3.0f;
+      // Sand updates per second
+      uint8_t steps = 12;
       uint8_t brightness = 255;
       uint8_t motionBlur = 180;
     } hourglass;
@@ -360,6 +522,8 @@ struct Config {
       float starttime = 3.0f;
       float runtime = 30.0f;
       float endtime = 3.0f;
+      // Size of the flock, at most 512
+      uint16_t count = 150;
       uint8_t brightness = 255;
       uint8_t motionBlur = 220;
     } boids;
@@ -374,6 +538,9 @@ struct Config {
       float starttime = 3.0f;
       float runtime = 30.0f;
       float endtime = 3.0f;
+      float interval = 0.04f;
+      float drop = 8.0f;
+      uint8_t damping = 5;
       uint8_t brightness = 255;
       uint8_t motionBlur = 0;
     } ripple;
@@ -383,6 +550,7 @@ struct Config {
       float endtime = 3.0f;
       uint8_t brightness = 255;
       uint8_t motionBlur = 0;
+      basis_t basis = basis_t::PERLIN;
     } kaleidoscope;
     struct {
       float starttime = 3.0f;
@@ -391,25 +559,58 @@ struct Config {
       uint8_t brightness = 255;
       uint8_t motionBlur = 0;
     } interference;
-  } animation;
-
-  // Do not serialize devices
-  struct {
     struct {
-      float x = 0;
-      float y = 0;
-      float z = 0;
-    } accelerometer;
+      float starttime = 1.0f;
+      float runtime = 3600.0f;
+      float endtime = 1.0f;
+      // Ends early without frames for this long
+      float timeout = 5.0f;
+      // Motion blur right after lost frames, back to motionBlur in drop_time
+      float drop_time = 0.2f;
+      uint8_t drop_blur = 200;
+      uint8_t brightness = 255;
+      uint8_t motionBlur = 0;
+    } streaming;
     struct {
-      float x = 0;
-      float y = 0;
-    } joystick;
+      float starttime = 1.0f;
+      float runtime = 300.0f;
+      float endtime = 1.0f;
+      // Voxel file on the SD card, played from the keyframe before start
+      char file[32] = "cube.vox";
+      uint16_t start = 0;
+      uint8_t brightness = 255;
+    } playback;
     struct {
-      volatile float level[64];
-    } fft;
-  } devices;
- 
+      float starttime = 2.0f;
+      float runtime = 30.0f;
+      float endtime = 2.0f;
+      // Uploaded bytecode program (see core/Programs.h), the built in one
+      // when empty or not stored
+      char name[24] = "";
+      uint8_t brightness = 255;
+      uint8_t motionBlur = 0;
+    } program;
+  } animation;
+};
+
+struct Config : Settings {
+  // Do not serialize devices, live input from the serial event handler
+  Devices devices;
+
+  // Read config.bin when current, otherwise config.json
+  void load();
+  // Write config.json and a fresh config.bin
+  void save();
+  // Write changed sections behind in small slices, call every main loop
+  void loop();
+  // The LittleFS holding the config files, nullptr when it does not mount
+  FS *filesystem();
+  // The config, its snapshot buffers and the journal records, see
+  // core/Footprint.h
+  static void footprint(Footprint::usage_t &usage);
 };
 // All cpp files that include this link to a single config struct
 extern struct Config config;
+// The values supplied in the code, in flash
+extern const Settings defaults;
 #endif
\ No newline at end of file
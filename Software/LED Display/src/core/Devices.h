@@ -0,0 +1,125 @@
+#ifndef DEVICES_H
+#define DEVICES_H
+#include <stdint.h>
+
+#include "power/Seqlock.h"
+#include "power/SpscRing.h"
+/*------------------------------------------------------------------------------
+ * DEVICES CLASS
+ *------------------------------------------------------------------------------
+ * Live input of the WIO Terminal, written by the serial event handler and
+ * read by the animations. Every sample gets a sequence number and goes two
+ * ways: into a lock free ring for a consumer that wants every sample in
+ * order (button edges), and into a seqlocked snapshot per kind for
+ * readers that only want the latest value. Neither side ever blocks.
+ *
+ * accelerometer_t a;
+ * if (config.devices.read(a)) ...       // latest, 0 when nothing arrived yet
+ * device_sample_t s;
+ * config.devices.drain();               // once, when the consumer starts
+ * while (config.devices.next(s)) ...    // every sample, one consumer only
+ *
+ * Accelerometer and joystick samples carry the millis() they were taken at
+ * on this clock, so a Predictor can smooth them and extrapolate to the frame
+ * on the leds. Timed windows and button frames map the time of the WIO
+ * Terminal onto it, the other inputs only have their arrival.
+ *----------------------------------------------------------------------------*/
+// Samples waiting for the consumer, a full ring drops the newest
+#define DEVICES_RING 16
+
+struct fft_t {
+  // 64 bands, 0-15
+  uint8_t level[64];
+  // The window starts with a beat
+  bool onset;
+  // millis() when the window is due on the cube, 0 to show it at once
+  uint32_t due;
+};
+
+struct accelerometer_t {
+  float x, y, z;
+  // millis() when sampled
+  uint32_t time;
+};
+
+struct joystick_t {
+  float x, y;
+  // Pressed buttons
+  uint8_t buttons;
+  // millis() when sampled
+  uint32_t time;
+  static const uint8_t PRESS = 1, A = 2, B = 4, C = 8;
+};
+
+enum class device_t : uint8_t { FFT, ACCELEROMETER, JOYSTICK };
+
+struct device_sample_t {
+  device_t type;
+  uint32_t sequence;
+  union {
+    fft_t fft;
+    accelerometer_t accelerometer;
+    joystick_t joystick;
+  };
+};
+
+class Devices {
+ public:
+  // Producer side, the serial event handler and Mic::loop(), both on the
+  // main loop
+  void publish(const fft_t &fft) {
+    m_fft.write(fft);
+    device_sample_t s{device_t::FFT, ++m_sequence, {}};
+    s.fft = fft;
+    push(s);
+  }
+  void publish(const accelerometer_t &accelerometer) {
+    m_accelerometer.write(accelerometer);
+    device_sample_t s{device_t::ACCELEROMETER, ++m_sequence, {}};
+    s.accelerometer = accelerometer;
+    push(s);
+  }
+  void publish(const joystick_t &joystick) {
+    m_joystick.write(joystick);
+    device_sample_t s{device_t::JOYSTICK, ++m_sequence, {}};
+    s.joystick = joystick;
+    push(s);
+  }
+
+  // Latest value of a kind, returns how many arrived (0 leaves value as is)
+  uint32_t read(fft_t &fft) const { return read(m_fft, fft); }
+  uint32_t read(accelerometer_t &a) const { return read(m_accelerometer, a); }
+  uint32_t read(joystick_t &joystick) const {
+    return read(m_joystick, joystick);
+  }
+
+  // Next sample in order of arrival, for a single consumer
+  bool next(device_sample_t &sample) { return m_samples.pop(sample); }
+  // Drop the samples waiting, a consumer that starts only wants new ones.
+  // Without one the ring fills up and holds the oldest samples.
+  void drain() {
+    device_sample_t sample;
+    while (m_samples.pop(sample)) {
+    }
+  }
+  // Samples lost to a full ring, the sequence numbers show the gap
+  uint32_t overruns() const { return m_overruns; }
+
+ private:
+  Seqlock<fft_t> m_fft;
+  Seqlock<accelerometer_t> m_accelerometer;
+  Seqlock<joystick_t> m_joystick;
+  SpscRing<device_sample_t, DEVICES_RING> m_samples;
+  uint32_t m_sequence = 0;
+  uint32_t m_overruns = 0;
+
+  void push(const device_sample_t &s) {
+    if (!m_samples.push(s)) m_overruns++;
+  }
+  template <typename T>
+  static uint32_t read(const Seqlock<T> &latest, T &value) {
+    if (latest.sequence() == 0) return 0;
+    return latest.read(value);
+  }
+};
+#endif
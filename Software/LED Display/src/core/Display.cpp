@@ -2,26 +2,121 @@
 
 #include <Arduino.h>
 
+#include "core/Latency.h"
+#include "core/PixelPipe.h"
+#include "core/Trace.h"
+#include "power/Math8.h"
+
 /*------------------------------------------------------------------------------
  * DISPLAY CLASS
  *----------------------------------------------------------------------------*/
 volatile uint8_t Display::dmaBuffer = 0;
 volatile boolean Display::displayAvailable = true;
+volatile boolean Display::framePending = false;
+volatile boolean Display::preblended = false;
+volatile boolean Display::submitIndexed = false;
+volatile uint8_t Display::submitBuffer = 0;
+volatile uint8_t Display::previousBuffer = 2;
 DMAMEM uint32_t Display::dmaBufferData[2][BITCOUNT * LEDCOUNT] = {};
 DMAMEM uint32_t Display::dmaBufferHigh[1] = {0xFFFFFFFF};
-DMAMEM uint32_t Display::dmaBufferLow[50] = {};
+DMAMEM uint32_t Display::dmaBufferLow[1] = {};
 DMAChannel Display::dmaChannel[2];
 DMASetting Display::dmaSetting[6];
+uint16_t Display::voxelMap[LEDCOUNT][CHANNELS];
 uint8_t Display::motionBlur = 240;
 uint8_t Display::brightness = 255;
+uint8_t Display::dimming = 255;
+bool Display::gammaCorrection = true;
+bool Display::dither = true;
+uint8_t Display::ditherPhase = 0;
+bool Display::interpolation = false;
+uint8_t Display::orientation = 0;
+volatile uint8_t Display::tweenFrom = 0;
+volatile uint8_t Display::tweenWeight = 255;
+uint32_t Display::keyStart = 0;
+uint32_t Display::keyPeriod = 0;
+uint16_t Display::maxMilliamps = 0;
+volatile uint32_t Display::milliamps = 0;
+uint16_t Display::powerScale = 256;
+uint16_t Display::levels[256];
+const uint8_t (*Display::gain)[3] = nullptr;
+uint32_t Display::powerHistory[POWERHISTORY] = {};
+volatile uint8_t Display::powerIndex = 0;
+volatile uint32_t Display::transposeMicros = 0;
+volatile uint32_t Display::refreshes = 0;
+volatile uint32_t Display::swaps = 0;
+volatile uint32_t Display::stale = 0;
+volatile uint32_t Display::underruns = 0;
+volatile uint32_t Display::swapCycles = 0;
+volatile uint32_t Display::swapMax = 0;
+volatile uint32_t Display::refreshCycles = 0;
+volatile uint32_t Display::refreshTime = 0;
+// Slots of 450ns, T1H 1350ns, reset 61.2us (34 bits, more than 50us)
+const protocol_t Display::PL9823 = {
+    "PL9823", 1800, 450, 1350, 60000, {0, 1, 2}};
+// Slots of 312.5ns, T1H 625ns, reset 60us (48 bits, more than 50us)
+const protocol_t Display::WS2812 = {
+    "WS2812", 1250, 312, 625, 60000, {1, 0, 2}};
+const protocol_t *Display::protocol = &Display::PL9823;
+uint16_t Display::resetBits = 0;
 uint32_t Display::cubeBuffer = 0;
-DMAMEM Color Display::cube[2][width][height][depth];
+// Drawing does random writes, DTCM has no wait states and needs no cache
+// maintenance. Only the dma buffers have to be in DMAMEM.
+#if defined CUBE_DTCM
+#define CUBEMEM
+#else
+#define CUBEMEM DMAMEM
+#endif
+#if defined WIREORDER || defined MORTON
+CUBEMEM Color Display::cube[4][width * height * depth];
+CUBEMEM uint8_t Display::indices[4][width * height * depth];
+#else
+CUBEMEM Color Display::cube[4][width][height][depth];
+CUBEMEM uint8_t Display::indices[4][width][height][depth];
+#endif
+uint16_t Display::wireMap[width][height][depth];
+Color Display::palette[4][256];
+uint8_t Display::indexed = 0;
+CUBEMEM uint16_t Display::light[width][height][depth][3];
+bool Display::lighted = false;
+#if defined OCCUPANCY
+uint16_t Display::occupancy[4][width][height] = {};
+#endif
+
+void Display::setProtocol(const protocol_t &value) { protocol = &value; }
+
+void Display::footprint(Footprint::usage_t &usage) {
+  usage.add(dmaBufferData, sizeof(dmaBufferData));
+  usage.add(cube, sizeof(cube));
+  usage.add(indices, sizeof(indices));
+  usage.add(light, sizeof(light));
+  usage.add(wireMap, sizeof(wireMap));
+  usage.add(voxelMap, sizeof(voxelMap));
+  usage.add(palette, sizeof(palette));
+  usage.add(levels, sizeof(levels));
+#if defined OCCUPANCY
+  usage.add(occupancy, sizeof(occupancy));
+#endif
+}
+const protocol_t &Display::getProtocol() { return *protocol; }
 
 void Display::begin() {
+  resetBits = (protocol->reset + protocol->period - 1) / protocol->period;
+  if (resetBits > RESETMAX) resetBits = RESETMAX;
   setupRAM();
+  setupMap();
+#if defined SIMULATOR_BUILD
+  // No leds, the simulator runs the dma isr once it has shown a frame
+  dmaChannel[0].attachInterrupt(&displayReady);
+#else
   setupPLL();
   setupFIO();
   setupDMA();
+#if defined PIXELPIPE
+  PixelPipe::begin();
+#endif
+#endif
+  setupIRQ();
 }
 
 // DMAMEM can't be (static) initialized, need to do this in code
@@ -38,78 +133,529 @@ void Display::setupRAM(void) {
 void Display::displayReady(void) {
   // First clear the interrupt flag to avoid retriggering
   dmaChannel[0].clearInterrupt();
+  TRACE_MARK(REFRESH, !displayAvailable);
+  const uint32_t now = ARM_DWT_CYCCNT;
+  if (refreshes) refreshTime = now - refreshCycles;
+  refreshCycles = now;
+  refreshes++;
   // Swap dma buffer if a new one is available
   if (!displayAvailable) {
+    if (swaps && now - swapCycles > swapMax) swapMax = now - swapCycles;
+    swapCycles = now;
+    swaps++;
+    Latency::swapped();
     // The prep buffer becomes the dma buffer and visa versa
     dmaBuffer = 1 - dmaBuffer;
     // Write cached data to memory before dma transfer (DMAMEM)
     arm_dcache_flush(dmaBufferData[dmaBuffer], sizeof(dmaBufferData[0]));
+#if defined CHANNELS64
+    // Only the source moves, the minor loops of the chains stay
+    dmaSetting[0].TCD->SADDR = dmaBufferData[dmaBuffer];
+    dmaSetting[4].TCD->SADDR = dmaBufferData[dmaBuffer];
+#else
     dmaSetting[0].sourceBuffer(dmaBufferData[dmaBuffer],
                                sizeof(dmaBufferData[0]));
     dmaSetting[4].sourceBuffer(dmaBufferData[dmaBuffer],
                                sizeof(dmaBufferData[0]));
+#endif
+  } else {
+    // The frame before is sent again, when one is pending it was not
+    // transposed in time
+    stale++;
+    if (framePending) underruns++;
   }
   // The display is available to accept cube data
   displayAvailable = true;
+  // A submitted frame was waiting for the prep buffer or the next tween is due
+  if (framePending || (interpolation && tweenWeight < 255))
+    NVIC_SET_PENDING(IRQ_SOFTWARE);
+}
+
+// The transpose runs below the dma isr priority but above the main loop
+void Display::setupIRQ() {
+  attachInterruptVector(IRQ_SOFTWARE, &transposeFrame);
+  NVIC_SET_PRIORITY(IRQ_SOFTWARE, 208);
+  NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+}
+
+// Axes of a drawn voxel for the led axes per orientation / 8
+static const uint8_t AXES[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2},
+                                   {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+
+// Build the table that maps every led of every channel back to a voxel, and
+// wireMap the other way. The led and channel of a voxel follow the wiring of
+// the shift register boards, after turning it to the orientation, so both are
+// built again on every setOrientation() instead of being constexpr.
+void Display::setupMap() {
+  const uint8_t *axes = AXES[orientation / 8];
+  for (uint8_t x = 0; x < width; x++) {
+    for (uint8_t y = 0; y < height; y++) {
+      for (uint8_t z = 0; z < depth; z++) {
+        const uint8_t v[3] = {x, y, z};
+        uint8_t p[3];
+        for (uint8_t i = 0; i < 3; i++)
+          p[i] = orientation >> i & 1 ? 15 - v[axes[i]] : v[axes[i]];
+        // Leds run up and down a column, even z counts from the other end
+        uint8_t led =
+            0x7F - (p[0] << 4 & 0x30) - (((0x10 - (p[0] & 1)) ^ p[1]) & 0x0F);
+        if (!(p[2] & 1)) led = 0x7F - led;
+        uint8_t chn =
+            (p[0] >> 1 & 0x0E) + (p[2] << 1 & 0xF8) + (p[2] >> 1 & 1);
+        voxelMap[led][chn] = (x << 8) | (y << 4) | z;
+        wireMap[x][y][z] = led * CHANNELS + chn;
+      }
+    }
+  }
+}
+
+// Output levels for brightness and gamma, rebuilt before every frame since the
+// 256 entries are cheap compared to looking up 12288 color values.
+//
+// With dithering the brightness is applied in 16 bits and the gamma table is
+// interpolated between its entries, the 4 bits below the led level are kept.
+// Without, the levels are those of the 8 bit table and nothing is dithered.
+void Display::prepareLevels() {
+  ditherPhase = (ditherPhase + DITHERSTEP) & 15;
+  const uint8_t master = map8(brightness, dimming);
+  for (uint16_t v = 0; v < 256; v++) {
+    if (!dither) {
+      const uint8_t level = map8(v, master);
+      levels[v] = (gammaCorrection ? Color::GAMMA[level] : level) << 4;
+      continue;
+    }
+    const uint16_t position = (master + 1) * v;
+    if (!gammaCorrection) {
+      levels[v] = position >> 4;
+      continue;
+    }
+    const uint8_t i = position >> 8;
+    const uint16_t low = Color::GAMMA[i];
+    const uint16_t high = i < 255 ? Color::GAMMA[i + 1] : low;
+    levels[v] = (low << 4) + (((high - low) * (position & 0xFF)) >> 4);
+  }
 }
 
-// Notifies the display that a new frame is ready for displaying. Transfer
-// the cube data to the prep buffer and enable the interrupt to swap the
-// buffers.
+// Convert the summed output levels into milliamps and derive the scale for
+// the next frame. Using the previous estimate keeps it to one pass, motion
+// blur makes sure consecutive frames hardly differ.
+//
+// Above the knee (75% of the limit) the current is compressed smoothly and
+// approaches the limit instead of being clipped: with span = limit - knee,
+// target = limit - span^2 / (estimate - knee + span). The scale follows a
+// lower target immediately, but recovers only a few steps per frame.
+void Display::preparePower(const uint32_t sum) {
+  const uint16_t scale = powerScale;
+  milliamps = (sum >> 4) * MILLIAMPS / 255;
+  // Current actually delivered by this frame
+  powerHistory[powerIndex] = (milliamps * scale) >> 8;
+  powerIndex = (powerIndex + 1) % POWERHISTORY;
+  uint16_t target = 256;
+  const uint32_t knee = maxMilliamps - maxMilliamps / 4;
+  if (maxMilliamps && milliamps > knee) {
+    const uint32_t span = maxMilliamps - knee;
+    const uint32_t limit = maxMilliamps - span * span / (milliamps - knee + span);
+    target = (256 * limit) / milliamps;
+  }
+  if (target > scale + POWERRELEASE) target = scale + POWERRELEASE;
+  powerScale = target;
+}
+
+#if defined OCCUPANCY || !defined BITPLANE
+// Transfer the cube data to the prep buffer, blending with the previous frame.
 //
 // Note : In principle every 24 bit of led data (3 bytes) is rotated and
-// the 3 bytes become bits in 24 bytes with offset chn. Maybe this can be
-// made non-blocking using the pixel pipeline (pxp)?
+// the 3 bytes become bits in 24 bytes with offset chn. With PIXELPIPE the
+// pixel pipeline (pxp) blends the frame already (see PixelPipe.h).
 //
 // Maybe the rotate left can be implemented in assembly? Not sure if the
 // compiler is smart enough to optimize the shifts as a rotation.
-void Display::update() {
-  if (displayAvailable) {
-    uint32_t *prepBuffer = dmaBufferData[1 - dmaBuffer];
-    memset(prepBuffer, 0, sizeof(dmaBufferData[0]));
-    for (uint8_t x = 0; x < width; x++) {
-      for (uint8_t y = 0; y < height; y++) {
-        uint8_t led = 0x7F - (x << 4 & 0x30) - (((0x10 - (x & 1)) ^ y) & 0x0F);
-        for (uint8_t z = 0; z < depth; z++) {
-          led = 0x7F - led;
-          uint32_t *offset = prepBuffer + led * BITCOUNT;
-          uint8_t chn = (x >> 1 & 0x0E) + (z << 1 & 0xF8) + (z >> 1 & 1);
-          uint32_t value = cube[cubeBuffer][x][y][z]
-                               .blend(motionBlur, cube[1 - cubeBuffer][x][y][z])
-                               .bits();
-          value = (value << (1 + chn)) | (value >> (31 - chn));
-          uint32_t mask = 1 << chn;
-          for (uint8_t i = 0; i < BITCOUNT; i++) {
-            *offset++ |= (value & mask);
-            value = (value << 1) | (value >> 31);
-          }
+//
+// With OCCUPANCY only columns lit in either frame are visited, the cost then
+// scales with the amount of lit voxels instead of the cube size.
+//
+// With more than one chain led l of a channel is led l % (LEDCOUNT / CHAINS)
+// of chain l / (LEDCOUNT / CHAINS), the words of the chains are interleaved.
+void Display::prepareVoxels(const uint8_t current, const uint8_t previous) {
+  uint32_t *prepBuffer = dmaBufferData[1 - dmaBuffer];
+  const uint16_t scale = powerScale;
+  uint32_t sum = 0;
+  prepareLevels();
+  memset(prepBuffer, 0, sizeof(dmaBufferData[0]));
+  for (uint8_t x = 0; x < width; x++) {
+    for (uint8_t y = 0; y < height; y++) {
+#if defined OCCUPANCY
+      // Led toggles an even amount of times per column, so skipping is safe
+      const uint16_t lit = occupancy[current][x][y] | occupancy[previous][x][y];
+      uint16_t &occupied = occupancy[current][x][y];
+      occupied = 0;
+      if (!lit) continue;
+#endif
+      for (uint8_t z = 0; z < depth; z++) {
+#if defined OCCUPANCY
+        if (!(lit >> z & 1)) continue;
+#endif
+        const uint16_t wire = wireMap[x][y][z];
+        const uint8_t led = wire / CHANNELS;
+        const uint8_t chn = wire % CHANNELS;
+        const uint16_t half = LEDCOUNT / CHAINS;
+        uint32_t *offset =
+            prepBuffer + (led % half) * BITCOUNT * CHAINS + led / half;
+        Color &c = at(current, x, y, z);
+        uint8_t &index = indexAt(current, x, y, z);
+        if (index) {
+          c = palette[current][index];
+          index = 0;
+        }
+        if (!preblended) c.blend(motionBlur, at(previous, x, y, z));
+#if defined OCCUPANCY
+        if (!c.isBlack()) occupied |= 1 << z;
+#endif
+        const uint16_t lr = levels[c.r];
+        const uint16_t lg = levels[c.g];
+        const uint16_t lb = levels[c.b];
+        sum += lr + lg + lb;
+        const uint8_t *order = protocol->order;
+        const uint8_t t = Transpose::threshold(ditherPhase, led, chn);
+        uint16_t sr = scale, sg = scale, sb = scale;
+        if (gain) {
+          sr = Transpose::calibrate(scale, gain[wire][0]);
+          sg = Transpose::calibrate(scale, gain[wire][1]);
+          sb = Transpose::calibrate(scale, gain[wire][2]);
+        }
+        const uint32_t br = (((lr * sr) >> 8) + t) >> 4;
+        const uint32_t bg = (((lg * sg) >> 8) + t) >> 4;
+        const uint32_t bb = (((lb * sb) >> 8) + t) >> 4;
+        uint32_t value = br << (24 - 8 * order[0]) |
+                         bg << (24 - 8 * order[1]) |
+                         bb << (24 - 8 * order[2]);
+        value = (value << (1 + chn)) | (value >> (31 - chn));
+        uint32_t mask = 1 << chn;
+        for (uint8_t i = 0; i < BITCOUNT; i++) {
+          *offset |= (value & mask);
+          offset += CHAINS;
+          value = (value << 1) | (value >> 31);
         }
       }
     }
-    cubeBuffer = 1 - cubeBuffer;
-    // Writing to the cube data is not allowed to prevent frame tearing
-    displayAvailable = false;
   }
+  preparePower(sum);
+}
+#endif
+
+#if defined BITPLANE
+// Transfer the cube data to the prep buffer, blending with the previous frame.
+//
+// Every led index is a bit slice over all 32 channels. The 32 voxels of a
+// slice are gathered using the voxel map, or read in sequence when stored in
+// WIREORDER, and transposed in registers (core/Transpose.h). Every dma word is
+// written exactly once so the prep buffer needs no clearing.
+// Blending, brightness, gamma, current limiting and the calibration are fused
+// into the gather.
+void Display::prepare(const uint8_t current_, const uint8_t previous_) {
+  uint16_t *occupied = nullptr;
+#if defined OCCUPANCY
+  // Sparse frames are cheaper to scatter than to transpose completely
+  occupied = &occupancy[current_][0][0];
+  const uint16_t *lit = &occupancy[previous_][0][0];
+  uint16_t count = 0;
+  for (uint16_t i = 0; i < width * height; i++)
+    count += __builtin_popcount(occupied[i] | lit[i]);
+  if (count < SPARSE) return prepareVoxels(current_, previous_);
+  memset(occupied, 0, sizeof(occupancy[0]));
+#endif
+  Transpose::frame_t frame;
+  frame.current = (Color *)cube[current_];
+  frame.previous = preblended ? nullptr : (const Color *)cube[previous_];
+  frame.occupied = occupied;
+  frame.motionBlur = motionBlur;
+  frame.tween = false;
+  frame.indices = submitIndexed ? (uint8_t *)indices[current_] : nullptr;
+  frame.palette = palette[current_];
+  prepareFrame(frame);
+}
+#else
+void Display::prepare(const uint8_t current, const uint8_t previous) {
+  prepareVoxels(current, previous);
+}
+#endif
+
+void Display::prepareFrame(Transpose::frame_t &frame) {
+  prepareLevels();
+#if defined WIREORDER
+  frame.wireOrder = true;
+#else
+  frame.wireOrder = false;
+#endif
+#if defined MORTON
+  frame.morton = true;
+#else
+  frame.morton = false;
+#endif
+  frame.map = voxelMap;
+  frame.levels = levels;
+  frame.scale = powerScale;
+  frame.gain = gain;
+  frame.dither = ditherPhase;
+  for (uint8_t i = 0; i < 3; i++) frame.order[i] = protocol->order[i];
+#if defined CHANNELS64
+  preparePower(Transpose::interleaved(frame, dmaBufferData[1 - dmaBuffer]));
+#else
+  preparePower(Transpose::bitplane(frame, dmaBufferData[1 - dmaBuffer]));
+#endif
+}
+
+// The key before is blended towards the last key, both stay as they are. The
+// last key has been blended with the one before (motion blur) already.
+void Display::prepareTween(const uint8_t weight) {
+  Transpose::frame_t frame;
+  frame.current = (Color *)cube[previousBuffer];
+  frame.previous = (const Color *)cube[tweenFrom];
+  frame.occupied = nullptr;
+  frame.motionBlur = 255 - weight;
+  frame.tween = true;
+  frame.indices = nullptr;
+  prepareFrame(frame);
+  tweenWeight = weight;
+}
+
+// Low priority software interrupt, transposes the submitted frame as soon as
+// the prep buffer is free. Runs while the main loop draws the next frame.
+//
+// With interpolation the submitted frame is a key frame. It is blended in
+// place (motion blur) and the refreshes until the next key show tweens from
+// the key before to it, weighted by the time they will be on the leds (a
+// refresh from now) over the time between the last two keys. The tweens stop
+// once they reach the key. A key costs a transpose more, a tween one.
+void Display::transposeFrame(void) {
+  if (!displayAvailable) return;
+  if (!framePending && !(interpolation && tweenWeight < 255)) return;
+  TRACE_BEGIN(TRANSPOSE);
+  const uint32_t start = micros();
+  if (framePending) {
+#if defined PIXELPIPE
+    if (preblended) PixelPipe::wait();
+#endif
+    prepare(submitBuffer, previousBuffer);
+    // The submitted frame is blended and becomes the previous frame
+    tweenFrom = previousBuffer;
+    previousBuffer = submitBuffer;
+    keyPeriod = start - keyStart;
+    keyStart = start;
+    Latency::transposed();
+  }
+  if (interpolation) {
+    const uint32_t shown =
+        start - keyStart + refreshTime / (F_CPU_ACTUAL / 1000000);
+    const bool late = !keyPeriod || keyPeriod > KEYMAX || shown >= keyPeriod;
+    const uint8_t weight = late ? 255 : shown * 255 / keyPeriod;
+    // A key shown in full right away is the transposed key itself
+    if (weight < 255 || !framePending) prepareTween(weight);
+    else tweenWeight = 255;
+  }
+  if (framePending) transposeMicros = micros() - start;
+  // The prep buffer holds a frame, the dma isr swaps it in
+  displayAvailable = false;
+  framePending = false;
+  TRACE_END(TRANSPOSE, 0);
 }
-// Check if the display is available to accept new cube data
-bool Display::available() { return displayAvailable; }
+
+// Notifies the display that a new frame is ready for displaying. The frame is
+// handed to the transpose interrupt and drawing continues in the third cube
+// buffer, which is neither being transposed nor used for motion blur.
+void Display::submit() {
+  TRACE_BEGIN(SUBMIT);
+  if (!framePending) {
+    toneMap();
+    submitBuffer = cubeBuffer;
+    cubeBuffer = 3 - submitBuffer - previousBuffer;
+    submitIndexed = indexed >> submitBuffer & 1;
+    indexed &= ~(1 << submitBuffer);
+#if defined PIXELPIPE
+    // Blend on the pixel pipeline until the transpose, on the cpu when busy.
+    // The colors of an indexed frame are only known in the transpose.
+    preblended = !submitIndexed &&
+                 PixelPipe::blend((Color *)cube[submitBuffer],
+                                  (const Color *)cube[previousBuffer],
+                                  sizeof(cube[0]) / sizeof(Color), motionBlur);
+#endif
+    // Set pending before testing the prep buffer, so the dma isr can't miss it
+    Latency::submitted();
+    framePending = true;
+    if (displayAvailable) NVIC_SET_PENDING(IRQ_SOFTWARE);
+  }
+  TRACE_END(SUBMIT, 0);
+}
+// Check if the display is available to accept a new frame
+bool Display::available() { return !framePending; }
 // Clear the cube so a new frame can be freshly created.
-void Display::clear() { memset(cube[cubeBuffer], 0, sizeof(cube[0])); }
+void Display::clear() {
+#if defined OCCUPANCY
+  for (uint8_t x = 0; x < width; x++) {
+    for (uint8_t y = 0; y < height; y++) {
+      uint16_t &occupied = occupancy[cubeBuffer][x][y];
+#if defined WIREORDER || defined MORTON
+      // Only the lit voxels, a column is scattered over the buffer
+      for (uint8_t z = 0; occupied; z++, occupied >>= 1)
+        if (occupied & 1) at(cubeBuffer, x, y, z) = Color::BLACK;
+#else
+      if (occupied) {
+        memset(&cube[cubeBuffer][x][y], 0, sizeof(cube[0][0][0]));
+        occupied = 0;
+      }
+#endif
+    }
+  }
+#else
+  memset(&cube[cubeBuffer], 0, sizeof(cube[0]));
+#endif
+}
+uint8_t Display::getPreviousBuffer() { return previousBuffer; }
+// One pass instead of a saturation per addition. A sum over 255 is scaled
+// down as a whole, the hue stays where clipping each channel would turn it
+// towards white.
+void Display::toneMap() {
+  if (!lighted) return;
+  lighted = false;
+  for (uint8_t x = 0; x < width; x++) {
+    for (uint8_t y = 0; y < height; y++) {
+#if defined OCCUPANCY
+      const uint16_t occupied = occupancy[cubeBuffer][x][y];
+      if (!occupied) continue;
+#endif
+      for (uint8_t z = 0; z < depth; z++) {
+#if defined OCCUPANCY
+        if (!(occupied >> z & 1)) continue;
+#endif
+        uint16_t *l = light[x][y][z];
+        if (!(l[0] | l[1] | l[2])) continue;
+        Color &c = at(cubeBuffer, x, y, z);
+        uint32_t r = c.r + l[0], g = c.g + l[1], b = c.b + l[2];
+        const uint32_t peak = max(r, max(g, b));
+        if (peak > 255) {
+          const uint32_t scale = (255 << 16) / peak;
+          r = r * scale >> 16;
+          g = g * scale >> 16;
+          b = b * scale >> 16;
+        }
+        c.r = r;
+        c.g = g;
+        c.b = b;
+        l[0] = l[1] = l[2] = 0;
+      }
+    }
+  }
+}
+void Display::setPalette(const PaletteLUT &lut, const uint8_t offset,
+                         const uint8_t brightness) {
+  Color *colors = getPalette();
+  for (uint16_t i = 1; i < 256; i++)
+    colors[i] = lut.color[(uint8_t)(i + offset)].scaled(brightness);
+}
+Color *Display::getPalette() {
+  indexed |= 1 << cubeBuffer;
+  return palette[cubeBuffer];
+}
+// Only the drawn voxels, their columns are occupied
+void Display::resolve() {
+  toneMap();
+  if (!(indexed >> cubeBuffer & 1)) return;
+  indexed &= ~(1 << cubeBuffer);
+  const Color *colors = palette[cubeBuffer];
+  for (uint8_t x = 0; x < width; x++) {
+    for (uint8_t y = 0; y < height; y++) {
+#if defined OCCUPANCY
+      const uint16_t occupied = occupancy[cubeBuffer][x][y];
+      if (!occupied) continue;
+#endif
+      for (uint8_t z = 0; z < depth; z++) {
+#if defined OCCUPANCY
+        if (!(occupied >> z & 1)) continue;
+#endif
+        uint8_t &index = indexAt(cubeBuffer, x, y, z);
+        if (index) {
+          at(cubeBuffer, x, y, z) = colors[index];
+          index = 0;
+        }
+      }
+    }
+  }
+}
 // Set the master display brightness value
 void Display::setBrightness(const uint8_t value) { brightness = value; }
 uint8_t Display::getBrightness() { return brightness; }
+void Display::setDimming(const uint8_t value) { dimming = value; }
+uint8_t Display::getDimming() { return dimming; }
+// Enable or disable gamma correction
+void Display::setGamma(const bool value) { gammaCorrection = value; }
+bool Display::getGamma() { return gammaCorrection; }
+// Enable or disable dithering of the output levels
+void Display::setDither(const bool value) { dither = value; }
+bool Display::getDither() { return dither; }
+uint8_t Display::getDitherPhase() { return ditherPhase; }
+// Enable or disable interpolation between key frames
+void Display::setInterpolation(const bool value) { interpolation = value; }
+bool Display::getInterpolation() { return interpolation; }
+void Display::setOrientation(const uint8_t value) {
+  if (value == orientation || value >= 48) return;
+  // The buffers hold voxels in the places of the old orientation
+  NVIC_DISABLE_IRQ(IRQ_SOFTWARE);
+  orientation = value;
+  setupMap();
+  memset(cube, 0, sizeof(cube));
+  memset(indices, 0, sizeof(indices));
+#if defined OCCUPANCY
+  memset(occupancy, 0, sizeof(occupancy));
+#endif
+  NVIC_ENABLE_IRQ(IRQ_SOFTWARE);
+}
+uint8_t Display::getOrientation() { return orientation; }
+// Set the maximum current, enforced from the next frame on
+void Display::setCalibration(const uint8_t (*value)[3]) { gain = value; }
+const uint8_t (*Display::getCalibration())[3] { return gain; }
+void Display::setMaxMilliamps(const uint16_t value) { maxMilliamps = value; }
+uint16_t Display::getMaxMilliamps() { return maxMilliamps; }
+uint32_t Display::getMilliamps() { return milliamps; }
+uint32_t Display::getTransposeMicros() { return transposeMicros; }
+uint32_t Display::getRefreshMicros() {
+  return refreshTime / (F_CPU_ACTUAL / 1000000);
+}
+void Display::getDmaStats(dma_stats_t &stats) {
+  stats.refreshes = refreshes;
+  stats.swaps = swaps;
+  stats.stale = stale;
+  stats.underruns = underruns;
+  // A swap in between may be lost, the next call reports it
+  stats.swapMax = swapMax / (F_CPU_ACTUAL / 1000000);
+  swapMax = 0;
+  stats.refresh = refreshTime / (F_CPU_ACTUAL / 1000000);
+  stats.reset = resetBits * protocol->period / 1000;
+}
+const uint32_t *Display::getDmaBuffer() { return dmaBufferData[dmaBuffer]; }
+// Copy the power ring buffer, written by the transpose isr
+void Display::getPowerHistory(uint32_t *history) {
+  const uint8_t index = powerIndex;
+  for (uint8_t i = 0; i < POWERHISTORY; i++)
+    history[i] = powerHistory[(index + i) % POWERHISTORY];
+}
 // Set the motion blur value
 void Display::setMotionBlur(const uint8_t value) { motionBlur = value; }
 uint8_t Display::getMotionBlur() { return motionBlur; }
+#if !defined SIMULATOR_BUILD
 /****************************************************************************
  * Set up PLL5 (also known as "VIDEO PLL")
  * This configures the Clock Controller Module (CCM)
  *
  * The internal pll clock is set to 24MHz, the frequency generated is
- * 24 * (DIV_SELECT + NUM/DENOM) -> 24 * (42 + 2/3) = 1024 MHz
- * 24 * (DIV_SELECT + NUM/DENOM) -> 24 * (29 + 17/27) = 711.1111111 MHz
+ * 24 * (DIV_SELECT + NUM/DENOM). Flexio divides it by 5 and shifts a slot
+ * (32 bits) in 64 of its clocks, so a bit period of 4 slots needs
+ * 24 * 160000 / (3 * period) MHz:
+ * WS2812 1250ns -> 24 * (42 + 2500/3750) = 1024 MHz
+ * PL9823 1800ns -> 24 * (29 + 3400/5400) = 711.1111111 MHz
  ***************************************************************************/
 void Display::setupPLL() {
+  const uint32_t denom = 3 * protocol->period;
+  const uint32_t div = 160000 / denom;
+  const uint32_t num = 160000 % denom;
   // Before disabeling the PLL set the bypass source to the internal
   // 24MHz reference clock. See 14.6.1.6 page 1039.
   CCM_ANALOG_PLL_VIDEO_CLR = CCM_ANALOG_PLL_VIDEO_BYPASS_CLK_SRC(3) |
@@ -122,17 +668,10 @@ void Display::setupPLL() {
   // Clear dividers before setting the values
   CCM_ANALOG_PLL_VIDEO_CLR = CCM_ANALOG_PLL_VIDEO_DIV_SELECT(0x7f) |
                              CCM_ANALOG_PLL_VIDEO_POST_DIV_SELECT(3);
-#if defined PL9823
-  // NUM = 30 bits signed number, abs(NUM) must be less than DENOM
-  CCM_ANALOG_PLL_VIDEO_NUM = 17;
-  // DENOM = 30 bits unsigned number. NUM/DENOM -> fracional loop diver
-  CCM_ANALOG_PLL_VIDEO_DENOM = 27;
-#else
   // NUM = 30 bits signed number, abs(NUM) must be less than DENOM
-  CCM_ANALOG_PLL_VIDEO_NUM = 2;
+  CCM_ANALOG_PLL_VIDEO_NUM = num;
   // DENOM = 30 bits unsigned number. NUM/DENOM -> fracional loop diver
-  CCM_ANALOG_PLL_VIDEO_DENOM = 3;
-#endif
+  CCM_ANALOG_PLL_VIDEO_DENOM = denom;
   // Clear dividers before setting the values
   CCM_ANALOG_MISC2_CLR = CCM_ANALOG_MISC2_VIDEO_DIV(3);
   // Post-divider for video values (0=/1, 1=/2, 2=/1, 3=/4) (2 is also
@@ -140,12 +679,8 @@ void Display::setupPLL() {
   CCM_ANALOG_MISC2_SET = CCM_ANALOG_MISC2_VIDEO_DIV(0);
 
   CCM_ANALOG_PLL_VIDEO_SET =
-  // DIV_SELECT set the loop divider (27-54)
-#if defined PL9823
-      CCM_ANALOG_PLL_VIDEO_DIV_SELECT(29) |
-#else
-      CCM_ANALOG_PLL_VIDEO_DIV_SELECT(42) |
-#endif
+      // DIV_SELECT set the loop divider (27-54)
+      CCM_ANALOG_PLL_VIDEO_DIV_SELECT(div) |
       // Divider after PLL (0=/4, 1=/2, 2=/1, 3=reserved)
       CCM_ANALOG_PLL_VIDEO_POST_DIV_SELECT(2) |
       // Enable PLL output (still bypassed)
@@ -182,6 +717,12 @@ void Display::setupFIO() {
   *portControlRegister(DIN) = IOMUXC_PAD_DSE(3) | IOMUXC_PAD_SPEED(1);
   // SION + ALT4 (FLEXIO2_FLEXIO16) (IOMUXC_SW_MUX_CTL_PAD_GPIO_B1_00)
   *portConfigRegister(DIN) = 0x14;
+#if defined CHANNELS64
+  *portModeRegister(DIN2) |= digitalPinToBitMask(DIN2);
+  *portControlRegister(DIN2) = IOMUXC_PAD_DSE(3) | IOMUXC_PAD_SPEED(1);
+  // SION + ALT4 (FLEXIO2_FLEXIO17) (IOMUXC_SW_MUX_CTL_PAD_GPIO_B1_01)
+  *portConfigRegister(DIN2) = 0x14;
+#endif
 
   *portModeRegister(WCK) |= digitalPinToBitMask(WCK);
   *portControlRegister(WCK) = IOMUXC_PAD_DSE(3) | IOMUXC_PAD_SPEED(1);
@@ -246,6 +787,20 @@ void Display::setupFIO() {
   IMXRT_FLEXIO2_S.SHIFTCFG[2] = FLEXIO_SHIFTCFG_INSRC;
   // Illegal input source for shifter 3 ??????
   IMXRT_FLEXIO2_S.SHIFTCFG[3] = FLEXIO_SHIFTCFG_INSRC;
+#if defined CHANNELS64
+  // SHIFTERS 4-7 are the second chain on DIN2 = pin 7, the same as 0-3 and
+  // loaded by the same timer, so both chains shift in lockstep. Shifter 3
+  // takes in the bits of shifter 4, they never reach DIN before the reload.
+  IMXRT_FLEXIO2_S.SHIFTCTL[4] =
+      FLEXIO_SHIFTCTL_TIMSEL(0) | FLEXIO_SHIFTCTL_TIMPOL |
+      FLEXIO_SHIFTCTL_PINCFG(3) | FLEXIO_SHIFTCTL_PINSEL(17) |
+      FLEXIO_SHIFTCTL_SMOD(2);
+  for (uint8_t i = 5; i < 8; i++)
+    IMXRT_FLEXIO2_S.SHIFTCTL[i] =
+        FLEXIO_SHIFTCTL_TIMPOL | FLEXIO_SHIFTCTL_SMOD(2);
+  for (uint8_t i = 4; i < 8; i++)
+    IMXRT_FLEXIO2_S.SHIFTCFG[i] = FLEXIO_SHIFTCFG_INSRC;
+#endif
 
   // Timer configuration 50.5.1.21.4 page 2935
   IMXRT_FLEXIO2_S.TIMCFG[0] =
@@ -318,6 +873,9 @@ void Display::setupFIO() {
   IMXRT_FLEXIO2_S.SHIFTBUFBIS[1] = 0x00000000;
   IMXRT_FLEXIO2_S.SHIFTBUFBIS[2] = 0x00000000;
   IMXRT_FLEXIO2_S.SHIFTBUFBIS[3] = 0x00000000;
+#if defined CHANNELS64
+  for (uint8_t i = 4; i < 8; i++) IMXRT_FLEXIO2_S.SHIFTBUFBIS[i] = 0x00000000;
+#endif
   // Enable DMA trigger when SHIFTBUF[1 or 2] is loaded onto the shifter
   IMXRT_FLEXIO2_S.SHIFTSDEN |= 0x06;
   // Enable flexio, SHIFTBUF[0] has been written, so TIMER0 will start
@@ -325,6 +883,35 @@ void Display::setupFIO() {
   IMXRT_FLEXIO2_S.CTRL = FLEXIO_CTRL_FLEXEN;
 }
 
+// The reset reads the same word of zeros for every request, a single word
+// instead of a buffer as long as the reset
+static void repeatWord(DMASetting &setting, const uint16_t requests) {
+  setting.TCD->SOFF = 0;
+  setting.TCD->SLAST = 0;
+  setting.TCD->CITER = requests;
+  setting.TCD->BITER = requests;
+}
+
+#if defined CHANNELS64
+// Every dma request writes a word to the shift buffers of both chains, 4
+// shifters (16 bytes) apart. The minor loop offset takes the destination back
+// to the first chain for the next request. Sources that don't advance repeat
+// the same word.
+static void pairChains(DMASetting &setting, const uint16_t requests,
+                       const bool advance) {
+  setting.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_DMLOE |
+                                 DMA_TCD_NBYTES_MLOFFYES_MLOFF(-32) |
+                                 DMA_TCD_NBYTES_MLOFFYES_NBYTES(8);
+  setting.TCD->DOFF = 16;
+  if (!advance) {
+    setting.TCD->SOFF = 0;
+    setting.TCD->SLAST = 0;
+  }
+  setting.TCD->CITER = requests;
+  setting.TCD->BITER = requests;
+}
+#endif
+
 void Display::setupDMA() {
   // TCD 0 transfers the active dma buffer data to SHIFTBUF[1].
   dmaSetting[0].sourceBuffer(dmaBufferData[dmaBuffer],
@@ -341,8 +928,9 @@ void Display::setupDMA() {
   dmaSetting[1].destination(IMXRT_FLEXIO2_S.SHIFTBUFBIS[0]);
   dmaSetting[1].replaceSettingsOnCompletion(dmaSetting[2]);
   // TCD 2 sets SHIFTBUF[1] to 0. This is to reset the leds.
-  // We need >50us of zeros so adjust buffer size accordingly.
-  dmaSetting[2].sourceBuffer(dmaBufferLow, sizeof(dmaBufferLow));
+  // A word of zeros per bit period for the reset time of the protocol.
+  dmaSetting[2].sourceBuffer(dmaBufferLow, 4);
+  repeatWord(dmaSetting[2], resetBits);
   dmaSetting[2].destination(IMXRT_FLEXIO2_S.SHIFTBUFBIS[1]);
   dmaSetting[2].replaceSettingsOnCompletion(dmaSetting[3]);
   // TCD 3 sets SHIFTBUF[0] High. Triggers again.
@@ -356,10 +944,21 @@ void Display::setupDMA() {
   dmaSetting[4].destination(IMXRT_FLEXIO2_S.SHIFTBUFBIS[2]);
   dmaSetting[4].replaceSettingsOnCompletion(dmaSetting[5]);
   // TCD 5 = TCD 0 for SHIFBUF[2]
-  dmaSetting[5].sourceBuffer(dmaBufferLow, sizeof(dmaBufferLow));
+  dmaSetting[5].sourceBuffer(dmaBufferLow, 4);
+  repeatWord(dmaSetting[5], resetBits);
   dmaSetting[5].destination(IMXRT_FLEXIO2_S.SHIFTBUFBIS[2]);
   dmaSetting[5].replaceSettingsOnCompletion(dmaSetting[4]);
 
+#if defined CHANNELS64
+  // Same sequence for both chains, half the requests for the led data
+  pairChains(dmaSetting[0], BITCOUNT * LEDCOUNT / 2, true);
+  pairChains(dmaSetting[1], 1, false);
+  pairChains(dmaSetting[2], resetBits, false);
+  pairChains(dmaSetting[3], 1, false);
+  pairChains(dmaSetting[4], BITCOUNT * LEDCOUNT / 2, true);
+  pairChains(dmaSetting[5], resetBits, false);
+#endif
+
   // Initialize both DMA channels
   dmaChannel[0].disable();
   dmaChannel[1].disable();
@@ -370,13 +969,13 @@ void Display::setupDMA() {
   // Attach interrupt to dma channel 0. The interrupt is enabled in
   // update and disabled again in the ISR.
   dmaChannel[0].attachInterrupt(&displayReady);
-  // Bit pattern for PL9823 leds: High, Data, Data, Low
-  // Bit pattern for WS2812 leds: High, Data, Low, Low
-#if defined PL9823
-  // Quick Fix: Don't trigger DMA for WS2812, this keeps 2nd data pulse
-  // low
-  dmaChannel[1].triggerAtHardwareEvent(DMAMUX_SOURCE_FLEXIO2_REQUEST3);
-#endif
+  // Bit pattern for T1H of 3 slots (PL9823): High, Data, Data, Low
+  // Bit pattern for T1H of 2 slots (WS2812): High, Data, Low, Low
+  // Without trigger the second data shifter keeps sending its zeros
+  const uint16_t slot = protocol->period / 4;
+  if ((protocol->t1h + slot / 2) / slot >= 3)
+    dmaChannel[1].triggerAtHardwareEvent(DMAMUX_SOURCE_FLEXIO2_REQUEST3);
   dmaChannel[0].enable();
   dmaChannel[1].enable();
-}
\ No newline at end of file
+}
+#endif
@@ -4,37 +4,194 @@
 #include <DMAChannel.h>
 #include <stdint.h>
 
+#include "core/Footprint.h"
+#include "core/Transpose.h"
 #include "power/Color.h"
 #include "power/Math3D.h"
+#include "power/Morton.h"
 
-// Choose between WS2812 or PL9823
-#define PL9823
+// Choose between the bit-plane transpose or the per bit rotation in prepare()
+#define BITPLANE
+// Track occupied columns so clear() and prepare() can skip empty ones
+#define OCCUPANCY
+// Store the cube buffers in wire order (led, channel) instead of (x, y, z)
+#define WIREORDER
+// Store the cube buffers in Morton order instead (power/Morton.h), voxels
+// close in 3D are close in memory. Takes the place of WIREORDER, pays off
+// with the cube in DMAMEM where it is cached.
+// #define MORTON
+#if defined MORTON
+#undef WIREORDER
+#endif
+// Place the cube buffers in DTCM (RAM1) instead of DMAMEM (RAM2)
+#define CUBE_DTCM
+// Drive 64 channels of 64 leds, a second shift register chain on DIN2
+// #define CHANNELS64
+// Motion blur on the pixel pipeline (PXP), the transpose reads it blended
+// #define PIXELPIPE
+
+// Timing of a led type, times in nanoseconds. Every bit is sent as 4 slots of
+// a quarter period: high, data, data or low, low. T0H is a slot, T1H two or
+// three (the closest). The period sets the video pll (24 MHz * 160000 / (3 *
+// period) for 64 flexio clocks per slot), it has to lie between 988 and 1975.
+// The reset is rounded up to whole periods, at most RESETMAX. Use the shortest
+// reset the leds take, the refresh is idle for it.
+struct protocol_t {
+  const char *name;
+  uint16_t period;
+  uint16_t t0h;
+  uint16_t t1h;
+  uint32_t reset;
+  // Position (0 to 2) of the red, green and blue byte on the wire
+  uint8_t order[3];
+};
 
 class Display {
  public:
+  // Led types, PL9823 is what the cube is built with
+  static const protocol_t PL9823;
+  static const protocol_t WS2812;
   static const uint8_t width = 16;
   static const uint8_t height = 16;
   static const uint8_t depth = 16;
 
   // Buffer currently being used for drawing
   static uint32_t cubeBuffer;
-  // Create two cube buffers for motion blurring
-  static Color cube[2][width][height][depth];
+  // Buffer for layers that are composited into the frame (see Layer.h)
+  static const uint8_t LAYER = 3;
+  // Three cube buffers: drawing, transposing and previous (motion blurring)
+  // plus the layer buffer
+#if defined WIREORDER || defined MORTON
+  static Color cube[4][width * height * depth];
+#else
+  static Color cube[4][width][height][depth];
+#endif
+  // Wire order index (led * 32 + channel) of every voxel as drawn, the
+  // storage order with WIREORDER. Built by setupMap() rather than a constexpr
+  // table: it follows the orientation, which setOrientation() changes at
+  // runtime, and a table per orientation would take 48 x 8 KB of flash.
+  static uint16_t wireMap[width][height][depth];
+  // Palette indices drawn into the cube buffers (see setPalette()), in the
+  // same layout. Zero is not drawn, every index is cleared once resolved.
+#if defined WIREORDER || defined MORTON
+  static uint8_t indices[4][width * height * depth];
+#else
+  static uint8_t indices[4][width][height][depth];
+#endif
+  // Light added to the drawing buffer (voxel_light() in Graphics.h), 16 bits
+  // per channel without saturation. Tone mapped into the colors on submit(),
+  // so any number of additions up to 257 full ones per voxel stay in range.
+  static uint16_t light[width][height][depth][3];
+  // Light was added this frame
+  static bool lighted;
+#if defined OCCUPANCY
+  // Bit z is set when voxel (x,y,z) may be lit, one word per column
+  static uint16_t occupancy[4][width][height];
+#endif
+  // Voxel (x,y,z) of a cube buffer, independent of the storage layout
+  static inline Color &at(const uint8_t buffer, const uint8_t x,
+                          const uint8_t y, const uint8_t z) {
+#if defined WIREORDER
+    return cube[buffer][wireMap[x][y][z]];
+#elif defined MORTON
+    return cube[buffer][Morton::index(x, y, z)];
+#else
+    return cube[buffer][x][y][z];
+#endif
+  }
+  // Palette index of voxel (x,y,z) of a cube buffer
+  static inline uint8_t &indexAt(const uint8_t buffer, const uint8_t x,
+                                 const uint8_t y, const uint8_t z) {
+#if defined WIREORDER
+    return indices[buffer][wireMap[x][y][z]];
+#elif defined MORTON
+    return indices[buffer][Morton::index(x, y, z)];
+#else
+    return indices[buffer][x][y][z];
+#endif
+  }
 
  private:
   // Special display effect for all animations
   static uint8_t motionBlur;
   static uint8_t brightness;
+  static uint8_t dimming;
+  static bool gammaCorrection;
+  static bool dither;
+  // Dither phase of the frame being transposed, advanced DITHERSTEP per frame
+  static uint8_t ditherPhase;
+  static const uint8_t DITHERSTEP = 7;
+  // Current limit and the estimated current of the last transposed frame
+  static uint16_t maxMilliamps;
+  static volatile uint32_t milliamps;
+  // Frame level scale enforcing the current limit (256 means unlimited)
+  static uint16_t powerScale;
+  // Output level for every color value, combines brightness and gamma. 12
+  // bits, the fraction below the led level is dithered (see Transpose.h).
+  static uint16_t levels[256];
+  // Per led gains of setCalibration()
+  static const uint8_t (*gain)[3];
+  // Below this amount of occupied voxels prepare() scatters voxel by voxel
+  static const uint16_t SPARSE = 512;
+  // Current per color channel at full level
+  static const uint8_t MILLIAMPS = 20;
+  // Frame scale recovers slowly after limiting to prevent visible pumping
+  static const uint8_t POWERRELEASE = 4;
+  // Ring buffer of the delivered current per frame (oldest at powerIndex)
+  static uint32_t powerHistory[];
+  static volatile uint8_t powerIndex;
+  // Duration of the last transpose in microseconds
+  static volatile uint32_t transposeMicros;
+  // Refreshes of the leds, those that swapped in a new frame, those that
+  // repeated the previous one and repeats while a frame was pending
+  static volatile uint32_t refreshes;
+  static volatile uint32_t swaps;
+  static volatile uint32_t stale;
+  static volatile uint32_t underruns;
+  // Cycle count (ARM DWT CYCCNT) of the last swap, longest time between swaps
+  static volatile uint32_t swapCycles;
+  static volatile uint32_t swapMax;
+  // Cycle count of the last refresh and the time between the last two
+  static volatile uint32_t refreshCycles;
+  static volatile uint32_t refreshTime;
+  // Key frame interpolation: between two submitted (key) frames the refreshes
+  // show the key before blended towards the last one by the time since it.
+  static bool interpolation;
+  // Orientation of the cube as mounted, see setOrientation()
+  static uint8_t orientation;
+  // Key the tweens start from and the weight of the last tween (255 the key)
+  static volatile uint8_t tweenFrom;
+  static volatile uint8_t tweenWeight;
+  // Start of the last key transpose and the time between the last two keys
+  // in microseconds, longer gaps are not interpolated
+  static uint32_t keyStart;
+  static uint32_t keyPeriod;
+  static const uint32_t KEYMAX = 250000;
+  // Longest reset in bit periods and the reset of the protocol
+  static const uint16_t RESETMAX = 1024;
+  static uint16_t resetBits;
+  // Timing of the leds, set before begin()
+  static const protocol_t *protocol;
   // Amount of bits per led (keep at 24 for RGB)
-  static const uint8_t BITCOUNT = 24;
+  static const uint8_t BITCOUNT = Transpose::BITCOUNT;
   // Amount of leds per channel
-  static const uint16_t LEDCOUNT = 128;
+  static const uint16_t LEDCOUNT = Transpose::LEDCOUNT;
+  // Amount of channels (shift register outputs) per bit slice
+  static const uint8_t CHANNELS = Transpose::CHANNELS;
+  // Shift register chains, the leds of a channel are split over the chains
+#if defined CHANNELS64
+  static const uint8_t CHAINS = 2;
+#else
+  static const uint8_t CHAINS = 1;
+#endif
   // DIN (data in, bit to be shifted in on BCK)
   static const uint8_t DIN = 8;
   // WCK (word clock, latches the shiftregisters)
   static const uint8_t WCK = 9;
   // BCK (bit clock, shifts all data bits)
   static const uint8_t BCK = 10;
+  // DIN2 (data in of the second chain, shifted in on the same BCK)
+  static const uint8_t DIN2 = 7;
 
  private:
   // Hardware setup for RAM, PLL, FLEXIO and DMA
@@ -42,38 +199,144 @@ class Display {
   static void setupPLL();
   static void setupFIO();
   static void setupDMA();
+  static void setupMap();
+  static void setupIRQ();
   // DMA transfer complete ISR, this flips the dma with the prep buffer
   static void interruptAtCompletion();
   // Instance method for interruptAtCompletion
   static void displayReady();
+  // Software ISR that transposes a submitted frame into the prep buffer
+  static void transposeFrame();
+  // Blend current with previous cube buffer and transpose into prep buffer
+  static void prepare(const uint8_t current, const uint8_t previous);
+  // Blend, rotate and scatter voxel by voxel into the cleared prep buffer
+  static void prepareVoxels(const uint8_t current, const uint8_t previous);
+  // Transpose a frame of which the cube buffers are set into the prep buffer
+  static void prepareFrame(Transpose::frame_t &frame);
+  // Transpose the frame in between the tween key and the last key
+  static void prepareTween(const uint8_t weight);
+  // Add the light to the colors of the drawing buffer
+  static void toneMap();
+  // Rebuild the output levels and the current limit scale for the next frame
+  static void prepareLevels();
+  static void preparePower(const uint32_t sum);
+  // Frame waiting for or being transposed by the software ISR
+  static volatile boolean framePending;
+  // The submitted frame is blended by the pixel pipeline
+  static volatile boolean preblended;
+  // Palette of every cube buffer, the buffers with indices to resolve and
+  // whether the submitted frame has them
+  static Color palette[4][256];
+  static uint8_t indexed;
+  static volatile boolean submitIndexed;
+  // Buffer handed over by submit and the buffer last transposed
+  static volatile uint8_t submitBuffer;
+  static volatile uint8_t previousBuffer;
   // Buffer currently being used by dma
   static volatile uint8_t dmaBuffer;
   // Double buffered dma and prep data to prevent display artifacts
   static uint32_t dmaBufferData[2][BITCOUNT * LEDCOUNT];
   // Dma buffer for high signal and reset/latch low signal
   static uint32_t dmaBufferHigh[1];
-  static uint32_t dmaBufferLow[50];
-  // See if the display is available to accept a new frame
+  static uint32_t dmaBufferLow[1];
+  // See if the prep buffer is available to accept a new frame
   static volatile boolean displayAvailable;
-  // Need 2 dma channels for sending the data to PL9823 LED's
+  // Need 2 dma channels for sending the data to the LED's
   static DMAChannel dmaChannel[2];
-  // Need 6 TCD's for sending the data to PL9823 LED's
+  // Need 6 TCD's for sending the data to the LED's
   static DMASetting dmaSetting[6];
+  // Voxel index (x * 256 + y * 16 + z) of every led in every channel
+  static uint16_t voxelMap[LEDCOUNT][CHANNELS];
 
  public:
   // Do not use a class contructor to start the display (Arduino compatibility)
   static void begin();
-  // Notifies the display that a frame is ready for displaying
-  static void update();
+  // The cube, dma and lookup buffers, see core/Footprint.h
+  static void footprint(Footprint::usage_t &usage);
+  // Led timing used by begin() from then on, PL9823 by default
+  static void setProtocol(const protocol_t &value);
+  static const protocol_t &getProtocol();
+  // Hands a finished frame to the transpose ISR (non blocking)
+  static void submit();
   // Check if the display is available to accept a new frame
   static bool available();
   // Clear the cube so a new frame can be created fresh
   static void clear();
+  // Buffer of the last transposed frame (the motion blur source)
+  static uint8_t getPreviousBuffer();
+  // Draw palette indices into the drawing buffer this frame (voxel_index() in
+  // Graphics.h). Index i shows entry i + offset of the lut scaled by
+  // brightness, so a hue rotation only changes the offset. The transpose
+  // resolves them, drawing writes a byte per voxel and no colors.
+  static void setPalette(const PaletteLUT &lut, const uint8_t offset,
+                         const uint8_t brightness);
+  // The palette of the drawing buffer to fill directly instead (entries 1 to
+  // 255), same as setPalette() otherwise
+  static Color *getPalette();
+  // Resolve the indices and the light of the drawing buffer to colors now,
+  // for drawing or effects that need the colors
+  static void resolve();
+  // Refresh from frames interpolated between the submitted key frames, so
+  // animations can draw at a lower rate than the leds refresh. Every key is
+  // shown fully one key period after it was submitted.
+  static void setInterpolation(const bool value);
+  static bool getInterpolation();
+  // Orientation of the cube as mounted, one of the 48 symmetries of a cube
+  // (the 24 rotations and their mirror images). Axis i of a led is axis
+  // AXES[value / 8][i] of the voxel drawn, mirrored when bit i of value is
+  // set. Only the voxel and wire maps change, drawing and the transpose cost
+  // the same. A change starts from blank buffers.
+  static void setOrientation(const uint8_t value);
+  static uint8_t getOrientation();
   // Set the motion blur value higher is more blur
   static void setMotionBlur(const uint8_t value);
   static uint8_t getMotionBlur();
   // Set the master display brightness value
   static void setBrightness(const uint8_t value);
   static uint8_t getBrightness();
+  // Dim on top of the master brightness (255 is none), see Energy.h
+  static void setDimming(const uint8_t value);
+  static uint8_t getDimming();
+  // Enable or disable gamma correction of the output levels
+  static void setGamma(const bool value);
+  static bool getGamma();
+  // Dither the fraction of the output levels over frames, smooth gradients at
+  // low brightness instead of 8 bit steps
+  static void setDither(const bool value);
+  static bool getDither();
+  // Dither phase of the last transposed frame (see Transpose::threshold())
+  static uint8_t getDitherPhase();
+  // Gain of every die of every led (led * CHANNELS + chn, 255 is 1 and 0
+  // masks) applied in the transpose, nullptr for none. See Calibration.h
+  static void setCalibration(const uint8_t (*value)[3]);
+  static const uint8_t (*getCalibration())[3];
+  // Set the maximum current drawn by all leds (0 is unlimited)
+  static void setMaxMilliamps(const uint16_t value);
+  static uint16_t getMaxMilliamps();
+  // Estimated current of the last frame before limiting
+  static uint32_t getMilliamps();
+  // Copy the delivered current of the last frames, oldest first
+  static const uint8_t POWERHISTORY = 64;
+  static void getPowerHistory(uint32_t *history);
+  // Time spent transposing the last frame in microseconds
+  static uint32_t getTransposeMicros();
+  // Last refresh period (data and reset) in microseconds
+  static uint32_t getRefreshMicros();
+  // Refresh counters of the dma isr since begin(), the longest time between
+  // two swaps in microseconds since the previous call, the last refresh
+  // period (data and reset) and the reset of it in microseconds
+  struct dma_stats_t {
+    uint32_t refreshes;
+    uint32_t swaps;
+    uint32_t stale;
+    uint32_t underruns;
+    uint32_t swapMax;
+    uint32_t refresh;
+    uint32_t reset;
+  };
+  static void getDmaStats(dma_stats_t &stats);
+  // Led data being sent, 24 words per led (msb of red first), bit n of a word
+  // is channel n
+  static const uint32_t *getDmaBuffer();
 };
 #endif
\ No newline at end of file
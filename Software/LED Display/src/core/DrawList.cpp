@@ -0,0 +1,393 @@
+#include "DrawList.h"
+
+#include <string.h>
+
+#include "Config.h"
+#include "Log.h"
+/*------------------------------------------------------------------------------
+ * DRAWLIST CLASS
+ *----------------------------------------------------------------------------*/
+// Bricks of 4x4x4 voxels, 4 per axis
+static const uint8_t BRICK = 2;
+static const uint8_t BRICKS = 64;
+
+DMAMEM DrawList::command_t DrawList::commands[DRAWLIST_COMMANDS];
+uint16_t DrawList::count = 0;
+uint16_t DrawList::immediate = 0;
+DrawList::stats_t DrawList::counts = {};
+
+// Commands in order of brick, recorded order within a brick
+DMAMEM static uint16_t order[DRAWLIST_BINS];
+
+template <blend_t B>
+static inline void put(const uint8_t x, const uint8_t y, const uint8_t z,
+                       const Color &c) {
+  Color &v = cell(x, y, z);
+  if (B == blend_t::SET) v = c;
+  if (B == blend_t::ADD) v += c;
+  if (B == blend_t::MAX) v.maximize(c);
+  if (B == blend_t::MULTIPLY) v.multiply(c);
+}
+
+template <typename T>
+static inline T clamp(const int32_t v, const T lo, const T hi) {
+  return v < lo ? lo : v > hi ? hi : v;
+}
+
+static inline int16_t round_voxel(const float v, const float c) {
+  return (int16_t)(v + 32768.5f + c) - 32768;
+}
+
+static const kernel_t &kernel(const int16_t *q, const uint8_t radius,
+                              const falloff_t falloff) {
+  return Kernel::get(falloff, radius / 8.0f, q[0] & (Kernel::STEPS - 1),
+                     q[1] & (Kernel::STEPS - 1), q[2] & (Kernel::STEPS - 1));
+}
+
+// First voxel of the kernel of a splat along an axis
+static inline int16_t kernel_lo(const int16_t q, const int8_t lo) {
+  return (q - (q & (Kernel::STEPS - 1))) / Kernel::STEPS + lo;
+}
+
+// A command with the blend mode known at compile time, the part inside clip
+template <blend_t B>
+static void draw(const DrawList::command_t &d, const DrawList::box_t &clip) {
+  const uint8_t *lo = clip.lo, *hi = clip.hi;
+  switch (d.kind) {
+    case DrawList::POINT:
+      if (d.a[0] >= lo[0] && d.a[0] <= hi[0] && d.a[1] >= lo[1] &&
+          d.a[1] <= hi[1] && d.a[2] >= lo[2] && d.a[2] <= hi[2])
+        put<B>(d.a[0], d.a[1], d.a[2], d.color);
+      break;
+    case DrawList::SPAN: {
+      if (d.a[0] < lo[0] || d.a[0] > hi[0] || d.a[1] < lo[1] ||
+          d.a[1] > hi[1])
+        break;
+      const int16_t z1 = d.b[2] < hi[2] ? d.b[2] : hi[2];
+      for (int16_t z = d.a[2] > lo[2] ? d.a[2] : lo[2]; z <= z1; z++)
+        put<B>(d.a[0], d.a[1], z, d.color);
+      break;
+    }
+    case DrawList::SPLAT: {
+      const kernel_t &k = kernel(d.a, d.radius, d.falloff);
+      int16_t from[3], to[3];
+      for (uint8_t i = 0; i < 3; i++) {
+        from[i] = kernel_lo(d.a[i], k.lo[i]);
+        to[i] = from[i] + k.n[i] - 1;
+      }
+      const int16_t x0 = from[0] > lo[0] ? from[0] : lo[0];
+      const int16_t y0 = from[1] > lo[1] ? from[1] : lo[1];
+      const int16_t z0 = from[2] > lo[2] ? from[2] : lo[2];
+      const int16_t x1 = to[0] < hi[0] ? to[0] : hi[0];
+      const int16_t y1 = to[1] < hi[1] ? to[1] : hi[1];
+      const int16_t z1 = to[2] < hi[2] ? to[2] : hi[2];
+      for (int16_t x = x0; x <= x1; x++)
+        for (int16_t y = y0; y <= y1; y++) {
+          const uint8_t *w =
+              &k.weights[((x - from[0]) * k.n[1] + (y - from[1])) * k.n[2] +
+                         (z0 - from[2])];
+          for (int16_t z = z0; z <= z1; z++, w++)
+            if (*w) put<B>(x, y, z, d.color.scaled(*w));
+        }
+      break;
+    }
+    case DrawList::LINE:
+      walk(((int32_t)d.a[0] << 16) + 0x8000, ((int32_t)d.a[1] << 16) + 0x8000,
+           ((int32_t)d.a[2] << 16) + 0x8000, ((int32_t)d.b[0] << 16) + 0x8000,
+           ((int32_t)d.b[1] << 16) + 0x8000, ((int32_t)d.b[2] << 16) + 0x8000,
+           [&](int32_t x, int32_t y, int32_t z, int32_t) {
+             x >>= 16, y >>= 16, z >>= 16;
+             if (x >= lo[0] && x <= hi[0] && y >= lo[1] && y <= hi[1] &&
+                 z >= lo[2] && z <= hi[2])
+               put<B>(x, y, z, d.color);
+           });
+      break;
+    case DrawList::SPHERE: {
+      const int32_t r2 = d.radius * d.radius;
+      int16_t from[3], to[3];
+      for (uint8_t i = 0; i < 3; i++) {
+        from[i] = clamp<int16_t>((d.a[i] - d.radius + 7) >> 3, lo[i], 16);
+        to[i] = clamp<int16_t>((d.a[i] + d.radius) >> 3, -1, hi[i]);
+      }
+      const int16_t x0 = from[0], y0 = from[1], z0 = from[2];
+      const int16_t x1 = to[0], y1 = to[1], z1 = to[2];
+      for (int16_t x = x0; x <= x1; x++) {
+        const int32_t dx = x * 8 - d.a[0];
+        for (int16_t y = y0; y <= y1; y++) {
+          const int32_t dy = y * 8 - d.a[1];
+          for (int16_t z = z0; z <= z1; z++) {
+            const int32_t dz = z * 8 - d.a[2];
+            if (dx * dx + dy * dy + dz * dz <= r2) put<B>(x, y, z, d.color);
+          }
+        }
+      }
+      break;
+    }
+  }
+}
+
+// A run of commands of one blend mode, the mode is picked once
+static void draw(const DrawList::command_t *commands, const uint16_t *index,
+                 const uint16_t n, const DrawList::box_t &clip) {
+  switch (commands[index[0]].blend) {
+    case blend_t::SET:
+      for (uint16_t i = 0; i < n; i++)
+        draw<blend_t::SET>(commands[index[i]], clip);
+      break;
+    case blend_t::ADD:
+      for (uint16_t i = 0; i < n; i++)
+        draw<blend_t::ADD>(commands[index[i]], clip);
+      break;
+    case blend_t::MAX:
+      for (uint16_t i = 0; i < n; i++)
+        draw<blend_t::MAX>(commands[index[i]], clip);
+      break;
+    case blend_t::MULTIPLY:
+      for (uint16_t i = 0; i < n; i++)
+        draw<blend_t::MULTIPLY>(commands[index[i]], clip);
+      break;
+  }
+}
+
+// A splat over Kernel::RADIUS, weighted per voxel like the exact radiate()
+// functions but in any blend mode
+template <blend_t B>
+static void splat_exact(const Vector3 &v0, const Color &c, const float r,
+                        const falloff_t falloff) {
+  const Vector3 v = v0 + Vector3(CX, CY, CZ);
+  const int16_t x1 = (int16_t)(v.x - r + 1), x2 = (int16_t)(v.x + r);
+  const int16_t y1 = (int16_t)(v.y - r + 1), y2 = (int16_t)(v.y + r);
+  const int16_t z1 = (int16_t)(v.z - r + 1), z2 = (int16_t)(v.z + r);
+  for (int16_t x = x1; x <= x2; x++)
+    for (int16_t y = y1; y <= y2; y++)
+      for (int16_t z = z1; z <= z2; z++) {
+        if (((x | y | z) & 0xFFF0) != 0) continue;
+        const float d = (Vector3(x, y, z) - v).magnitude();
+        if (d >= r) continue;
+        if (falloff == falloff_t::QUARTIC)
+          put<B>(x, y, z, c.scaled(255 / (1 + d * d * d * d)));
+        else if (falloff == falloff_t::QUINTIC)
+          put<B>(x, y, z, c.scaled(255 / (1 + d * d * d * d * d)));
+        else
+          put<B>(x, y, z, c.scaled(255 * (1 - d / r)));
+      }
+}
+
+static void draw(const DrawList::command_t &d, const DrawList::box_t &clip) {
+  switch (d.blend) {
+    case blend_t::SET:
+      draw<blend_t::SET>(d, clip);
+      break;
+    case blend_t::ADD:
+      draw<blend_t::ADD>(d, clip);
+      break;
+    case blend_t::MAX:
+      draw<blend_t::MAX>(d, clip);
+      break;
+    case blend_t::MULTIPLY:
+      draw<blend_t::MULTIPLY>(d, clip);
+      break;
+  }
+}
+
+static const DrawList::box_t CUBE = {{0, 0, 0}, {15, 15, 15}};
+
+void DrawList::point(const Vector3 &v, const Color &c, const blend_t blend) {
+  command_t d = {POINT, blend, 0, falloff_t::LINEAR, c, {}, {}};
+  d.a[0] = round_voxel(v.x, CX);
+  d.a[1] = round_voxel(v.y, CY);
+  d.a[2] = round_voxel(v.z, CZ);
+  record(d);
+}
+
+void DrawList::splat(const Vector3 &v, const Color &c, const float r,
+                     const falloff_t falloff, const blend_t blend) {
+  if (r > Kernel::RADIUS) {
+    if (count) flush();
+    switch (blend) {
+      case blend_t::SET:
+        splat_exact<blend_t::SET>(v, c, r, falloff);
+        break;
+      case blend_t::ADD:
+        splat_exact<blend_t::ADD>(v, c, r, falloff);
+        break;
+      case blend_t::MAX:
+        splat_exact<blend_t::MAX>(v, c, r, falloff);
+        break;
+      case blend_t::MULTIPLY:
+        splat_exact<blend_t::MULTIPLY>(v, c, r, falloff);
+        break;
+    }
+    return;
+  }
+  command_t d = {SPLAT, blend, (uint8_t)(r * 8 + 0.5f), falloff, c, {}, {}};
+  // Quarter voxels as radiate() takes them
+  d.a[0] = (int32_t)((v.x + CX) * Kernel::STEPS + 131072.5f) - 131072;
+  d.a[1] = (int32_t)((v.y + CY) * Kernel::STEPS + 131072.5f) - 131072;
+  d.a[2] = (int32_t)((v.z + CZ) * Kernel::STEPS + 131072.5f) - 131072;
+  record(d);
+}
+
+void DrawList::line(const Vector3 &a, const Vector3 &b, const Color &c,
+                    const blend_t blend) {
+  command_t d = {LINE, blend, 0, falloff_t::LINEAR, c, {}, {}};
+  d.a[0] = round_voxel(a.x, CX);
+  d.a[1] = round_voxel(a.y, CY);
+  d.a[2] = round_voxel(a.z, CZ);
+  d.b[0] = round_voxel(b.x, CX);
+  d.b[1] = round_voxel(b.y, CY);
+  d.b[2] = round_voxel(b.z, CZ);
+  record(d);
+}
+
+void DrawList::span(const uint8_t x, const uint8_t y, const int16_t z0,
+                    const int16_t z1, const Color &c, const blend_t blend) {
+  command_t d = {SPAN, blend, 0, falloff_t::LINEAR, c, {x, y, z0}, {}};
+  d.b[2] = z1;
+  record(d);
+}
+
+void DrawList::sphere(const Vector3 &v, const float r, const Color &c,
+                      const blend_t blend) {
+  command_t d = {SPHERE, blend, clamp<uint8_t>((int32_t)(r * 8 + 0.5f), 0, 255),
+                 falloff_t::LINEAR, c, {}, {}};
+  d.a[0] = (int32_t)((v.x + CX) * 8 + 131072.5f) - 131072;
+  d.a[1] = (int32_t)((v.y + CY) * 8 + 131072.5f) - 131072;
+  d.a[2] = (int32_t)((v.z + CZ) * 8 + 131072.5f) - 131072;
+  record(d);
+}
+
+// Drawn at once unless deferred, a full list is flushed first
+void DrawList::record(const command_t &command) {
+  if (!config.display.deferred) {
+    const uint32_t start = ARM_DWT_CYCCNT;
+    draw(command, CUBE);
+    counts.cycles += ARM_DWT_CYCCNT - start;
+    immediate++;
+    return;
+  }
+  if (count == DRAWLIST_COMMANDS) {
+    counts.overflows++;
+    flush();
+  }
+  commands[count++] = command;
+}
+
+// Voxels a command may touch, false when it misses the cube
+bool DrawList::bounds(const command_t &d, box_t &box) {
+  int16_t lo[3], hi[3];
+  switch (d.kind) {
+    case POINT:
+      for (uint8_t i = 0; i < 3; i++) lo[i] = hi[i] = d.a[i];
+      break;
+    case SPAN:
+      lo[0] = hi[0] = d.a[0];
+      lo[1] = hi[1] = d.a[1];
+      lo[2] = d.a[2];
+      hi[2] = d.b[2];
+      break;
+    case SPLAT: {
+      const kernel_t &k = kernel(d.a, d.radius, d.falloff);
+      for (uint8_t i = 0; i < 3; i++) {
+        lo[i] = kernel_lo(d.a[i], k.lo[i]);
+        hi[i] = lo[i] + k.n[i] - 1;
+      }
+      break;
+    }
+    case LINE:
+      for (uint8_t i = 0; i < 3; i++) {
+        lo[i] = d.a[i] < d.b[i] ? d.a[i] : d.b[i];
+        hi[i] = d.a[i] < d.b[i] ? d.b[i] : d.a[i];
+      }
+      break;
+    case SPHERE:
+      for (uint8_t i = 0; i < 3; i++) {
+        lo[i] = (d.a[i] - d.radius + 7) >> 3;
+        hi[i] = (d.a[i] + d.radius) >> 3;
+      }
+      break;
+  }
+  for (uint8_t i = 0; i < 3; i++) {
+    if (hi[i] < 0 || lo[i] > 15 || lo[i] > hi[i]) return false;
+    box.lo[i] = lo[i] < 0 ? 0 : lo[i];
+    box.hi[i] = hi[i] > 15 ? 15 : hi[i];
+  }
+  return true;
+}
+
+void DrawList::flush() {
+  if (immediate) {
+    counts.flushes++;
+    counts.commands += immediate;
+    if (immediate > counts.peak) counts.peak = immediate;
+    immediate = 0;
+  }
+  if (!count) return;
+  const uint32_t start = ARM_DWT_CYCCNT;
+  // Count the bins of every brick, then place the commands in recorded
+  // order behind the bins before them
+  uint16_t first[BRICKS + 1] = {};
+  uint32_t bins = 0;
+  box_t box;
+  for (uint16_t i = 0; i < count; i++) {
+    if (!bounds(commands[i], box)) continue;
+    for (uint8_t x = box.lo[0] >> BRICK; x <= box.hi[0] >> BRICK; x++)
+      for (uint8_t y = box.lo[1] >> BRICK; y <= box.hi[1] >> BRICK; y++)
+        for (uint8_t z = box.lo[2] >> BRICK; z <= box.hi[2] >> BRICK; z++)
+          first[(x << 4 | y << 2 | z) + 1]++;
+    bins += (((box.hi[0] >> BRICK) - (box.lo[0] >> BRICK)) + 1) *
+            (((box.hi[1] >> BRICK) - (box.lo[1] >> BRICK)) + 1) *
+            (((box.hi[2] >> BRICK) - (box.lo[2] >> BRICK)) + 1);
+  }
+  if (bins > DRAWLIST_BINS) {
+    // Too many to bin, in recorded order over the whole cube
+    for (uint16_t i = 0; i < count; i++)
+      draw(commands[i], CUBE);
+  } else {
+    for (uint8_t b = 0; b < BRICKS; b++) first[b + 1] += first[b];
+    uint16_t next[BRICKS];
+    memcpy(next, first, sizeof(next));
+    for (uint16_t i = 0; i < count; i++) {
+      if (!bounds(commands[i], box)) continue;
+      for (uint8_t x = box.lo[0] >> BRICK; x <= box.hi[0] >> BRICK; x++)
+        for (uint8_t y = box.lo[1] >> BRICK; y <= box.hi[1] >> BRICK; y++)
+          for (uint8_t z = box.lo[2] >> BRICK; z <= box.hi[2] >> BRICK; z++)
+            order[next[x << 4 | y << 2 | z]++] = i;
+    }
+    // Brick after brick, runs of one blend mode share the dispatch
+    for (uint8_t b = 0; b < BRICKS; b++) {
+      const uint8_t x = b >> 4, y = b >> 2 & 3, z = b & 3;
+      const box_t clip = {{(uint8_t)(x << BRICK), (uint8_t)(y << BRICK),
+                           (uint8_t)(z << BRICK)},
+                          {(uint8_t)((x << BRICK) + 3),
+                           (uint8_t)((y << BRICK) + 3),
+                           (uint8_t)((z << BRICK) + 3)}};
+      uint16_t i = first[b];
+      while (i < first[b + 1]) {
+        const blend_t blend = commands[order[i]].blend;
+        uint16_t n = 1;
+        while (i + n < first[b + 1] && commands[order[i + n]].blend == blend)
+          n++;
+        draw(commands, &order[i], n, clip);
+        i += n;
+      }
+    }
+    counts.bins += bins;
+  }
+  counts.flushes++;
+  counts.commands += count;
+  if (count > counts.peak) counts.peak = count;
+  counts.cycles += ARM_DWT_CYCCNT - start;
+  count = 0;
+}
+
+const DrawList::stats_t &DrawList::stats() { return counts; }
+
+void DrawList::log() {
+  if (!counts.flushes) return;
+  const uint32_t flushes = counts.flushes;
+  LOG(DRAWLIST, counts.commands / flushes, counts.peak, counts.bins / flushes,
+      (uint32_t)(counts.cycles / flushes / (F_CPU_ACTUAL / 1000000)));
+}
+
+void DrawList::reset() { counts = {}; }
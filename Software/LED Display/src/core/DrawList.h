@@ -0,0 +1,106 @@
+#ifndef DRAWLIST_H
+#define DRAWLIST_H
+#include <stdint.h>
+
+#include "Graphics.h"
+/*------------------------------------------------------------------------------
+ * DRAWLIST CLASS
+ *------------------------------------------------------------------------------
+ * Deferred drawing. Instead of writing into the drawing buffer call by call,
+ * an animation records compact commands: points, kernel splats like
+ * radiate(), lines, spans along z and solid spheres, each with a blend mode.
+ * flush() bins them by the 4x4x4 bricks their bounds touch with a stable
+ * counting sort and runs brick after brick, every command clipped to the
+ * brick: the writes of a batch stay within 64 voxels, and runs of commands of
+ * the same kind and blend mode share their setup. Within a brick the
+ * commands keep the order they were recorded in, so every voxel sees the
+ * same writes in the same order as drawn at once and the frame is the same.
+ *
+ * With config.display.deferred off every command is drawn when it is
+ * recorded, through the same code, so an animation on the list can be
+ * compared in both modes. Animation::loop() flushes after every draw().
+ * Commands that do not fit flush the list first, a splat over
+ * Kernel::RADIUS is drawn at once after a flush, with the falloff of the
+ * exact radiate() functions and its own blend mode. An animation
+ * drawing the same voxels directly as well flushes before it does.
+ *
+ * Commands, bins and the time to rasterize them are counted per flush until
+ * reset(), log() sends them to the binary log (core/Log.h).
+ *
+ * DrawList::splat(position, color, 2.0f, falloff_t::QUINTIC);
+ * DrawList::line(a, b, Color::WHITE, blend_t::ADD);
+ * DrawList::flush();  // Animation::loop()
+ *----------------------------------------------------------------------------*/
+// Commands recorded before a flush, 20 bytes each in DMAMEM
+#define DRAWLIST_COMMANDS 512
+// Commands binned per flush, a command is in a bin of every brick it touches
+#define DRAWLIST_BINS 4096
+
+class DrawList {
+ public:
+  struct stats_t {
+    // Flushes with commands, commands and bins over all of them
+    uint32_t flushes;
+    uint32_t commands;
+    uint32_t bins;
+    // Most commands of a flush, flushes of a full list
+    uint16_t peak;
+    uint16_t overflows;
+    // Cycles spent rasterizing
+    uint64_t cycles;
+  };
+
+  static void point(const Vector3 &v, const Color &c,
+                    const blend_t blend = blend_t::SET);
+  // radiate(v, c, r, falloff) blended, MAX is what radiate() does
+  static void splat(const Vector3 &v, const Color &c, const float r,
+                    const falloff_t falloff,
+                    const blend_t blend = blend_t::MAX);
+  static void line(const Vector3 &a, const Vector3 &b, const Color &c,
+                   const blend_t blend = blend_t::SET);
+  // Voxels z0 to z1 of column x, y in physical cube coordinates
+  static void span(const uint8_t x, const uint8_t y, const int16_t z0,
+                   const int16_t z1, const Color &c,
+                   const blend_t blend = blend_t::SET);
+  // The voxels whose centers are within r of v
+  static void sphere(const Vector3 &v, const float r, const Color &c,
+                     const blend_t blend = blend_t::SET);
+  // Rasterize and clear the list
+  static void flush();
+
+  static const stats_t &stats();
+  static void log();
+  static void reset();
+
+  // The recorded form of a call, for the rasterizer
+  enum kind_t : uint8_t { POINT, SPLAT, LINE, SPAN, SPHERE };
+  // Inclusive voxel bounds, clipped to the cube
+  struct box_t {
+    uint8_t lo[3];
+    uint8_t hi[3];
+  };
+  struct command_t {
+    kind_t kind;
+    blend_t blend;
+    // Radius in 1/8 voxel of a splat or a sphere, falloff of a splat
+    uint8_t radius;
+    falloff_t falloff;
+    Color color;
+    // POINT, SPAN: voxel, SPAN ends at z b[2]
+    // SPLAT: quarter voxels, LINE: voxels of both ends
+    // SPHERE: center in 1/8 voxel
+    int16_t a[3];
+    int16_t b[3];
+  };
+
+ private:
+  static command_t commands[DRAWLIST_COMMANDS];
+  static uint16_t count;
+  // Commands drawn at once since the last flush, not deferred
+  static uint16_t immediate;
+  static stats_t counts;
+
+  static void record(const command_t &command);
+  static bool bounds(const command_t &command, box_t &box);
+};
+#endif
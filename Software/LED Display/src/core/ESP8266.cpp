@@ -1,6 +1,27 @@
 #include "ESP8266.h"
 
 #include <TimeLib.h>
+
+#include "Alloc.h"
+#include "Display.h"
+#include "Firmware.h"
+#include "Footprint.h"
+#include "Frame.h"
+#include "LCD.h"
+#include "Latency.h"
+#include "Log.h"
+#include "Net.h"
+#include "Outbox.h"
+#include "Preview.h"
+#include "Programs.h"
+#include "Recorder.h"
+#include "Scheduler.h"
+#include "Schema.h"
+#include "Soak.h"
+#include "Sync.h"
+#include "Trace.h"
+#include "USB.h"
+#include "Voxels.h"
 // Start and stop bytes for commands (outside of ascii range)
 const char ESP_START = 0xf0;
 const char TEENSY_START = 0xf1;
@@ -8,10 +29,29 @@ const char WIO_START = 0xf2;
 const char ESP_STOP = 0xf8;
 const char TEENSY_STOP = 0xf9;
 const char WIO_STOP = 0xfa;
-const char START = TEENSY_START;
-const char STOP = TEENSY_STOP;
 
-void execute(const char* char_buffer);
+void execute(char* char_buffer);
+void execute(frame_t type, uint8_t* payload, uint16_t size);
+static void execute_window(const uint8_t* payload, uint16_t size);
+static uint32_t schedule(const uint16_t time);
+static uint32_t input_delay(const uint16_t time);
+// Button changes since the last second and the longest delay among them
+static uint32_t inputs = 0;
+static uint32_t input_delay_max = 0;
+// Start of this read of the link and end of the one before, bytes waited
+// half the gap on average. The due time of the last window, for a probe of it.
+static uint32_t read_start = 0;
+static uint32_t read_end = 0;
+static uint32_t window_due = 0;
+// Bytes read from the link since begin(), where a SOAK frame ended
+static uint32_t link_bytes = 0;
+// Last preview event of the ESP8266 with viewers
+static bool previewing = false;
+static uint32_t preview_asked = 0;
+// Config export under way, a slice per main loop
+static bool exporting = false;
+static bool export_sparse = true;
+static Schema::cursor_t export_cursor;
 
 void ESP8266::reset() {
   // ESP8266 reset pin, pull down for reset
@@ -22,74 +62,691 @@ void ESP8266::reset() {
   delay(100);
 }
 
-// Check input from Serial1 connected to ESP8266
-void ESP8266::loop() {
-  static boolean command = false;
-  static String message = "";
-  while (Serial1.available()) {
-    char c = (char)Serial1.read();
-    if (c == START) {
-      message = "";
-      command = true;
-    } else if (c == STOP) {
-      if (command) {
-        execute(message.c_str());
+link_stats_t ESP8266::stats = {};
+
+/*------------------------------------------------------------------------------
+ * LINK RATE
+ *------------------------------------------------------------------------------
+ * Both ends start at ESP8266_BAUD. After ESP8266_PROBE_S seconds without
+ * frame errors the Teensy asks for the next rate, {"event":"baud","rate":r}.
+ * The ESP8266 acknowledges at the old rate and switches, the Teensy switches
+ * on the acknowledgement and sends {"event":"baud","confirm":r} every
+ * CONFIRM_EVERY ms until the ESP8266 answers {"event":"baud","ok":r} at the
+ * new rate. A second with more than ESP8266_ERRORS_MAX frame errors steps
+ * down the same way. A change that is not confirmed within ESP8266_CONFIRM_MS
+ * leaves both ends at ESP8266_BAUD, the ESP8266 giving up first. A rate that
+ * failed is not tried again.
+ *
+ * The ESP8266 may still be at a higher rate when the Teensy starts, begin()
+ * asks for ESP8266_BAUD at every rate and confirms it.
+ *----------------------------------------------------------------------------*/
+static constexpr uint32_t rates[] = ESP8266_RATES;
+static const uint8_t RATES = sizeof(rates) / sizeof(rates[0]);
+static const uint32_t CONFIRM_EVERY = 100;
+enum class change_t : uint8_t { NONE, ASKED, CONFIRMING };
+static change_t change = change_t::NONE;
+// Index of the rate in use, the one asked for and the highest not ruled out
+static uint8_t rate = 0;
+static uint8_t target = 0;
+static uint8_t ceiling = RATES - 1;
+// Seconds without errors at this rate
+static uint8_t clean = 0;
+static uint32_t asked = 0;
+static uint32_t confirmed = 0;
+
+// Prevents RX buffer overflow if not reading fast enough
+DMAMEM static char read_buffer[4096];
+// Takes what drain() of the Outbox hands over, the transmit isr sends it
+DMAMEM static char write_buffer[1024];
+// Frames of the ESP8266 and the one being sent to it
+static Frame parser;
+static uint8_t frame[6 + FRAME_MAX];
+// Payload of the SOAK frame being sent back
+DMAMEM static uint8_t soak_payload[FRAME_MAX];
+
+void ESP8266::footprint(Footprint::usage_t& usage) {
+  usage.add(read_buffer, sizeof(read_buffer));
+  usage.add(write_buffer, sizeof(write_buffer));
+  usage.add(&parser, sizeof(parser));
+  usage.add(frame, sizeof(frame));
+  usage.add(soak_payload, sizeof(soak_payload));
+  Outbox::footprint(usage);
+}
+
+// What is queued goes at the new rate, what the port holds at the old one
+static void open_link(const uint32_t baud) {
+  Serial1.flush();
+  Serial1.begin(baud);
+  Serial1.addMemoryForRead(read_buffer, sizeof(read_buffer));
+  Serial1.addMemoryForWrite(write_buffer, sizeof(write_buffer));
+#if defined ESP8266_FLOW
+  // Holds the ESP8266 off before the read buffer overflows, and waits while
+  // the ESP8266 can not take more
+  Serial1.attachRts(ESP8266_RTS);
+  if (!Serial1.attachCts(ESP8266_CTS))
+    Serial.println("ESP8266 CTS pin not supported by Serial1");
+#endif
+  ESP8266::stats.baud = baud;
+}
+
+static void send_baud(const char* key, const uint32_t baud) {
+  char buffer[64];
+  StaticJsonDocument<64> doc;
+  doc["event"] = "baud";
+  doc[key] = baud;
+  serializeJson(doc, buffer, sizeof(buffer));
+  ESP8266::rpc(buffer, Outbox::CONTROL);
+}
+
+static void ask(const uint8_t index) {
+  target = index;
+  change = change_t::ASKED;
+  asked = millis();
+  send_baud("rate", rates[index]);
+}
+
+void ESP8266::begin() {
+  static_assert(rates[0] == ESP8266_BAUD, "the rates start at ESP8266_BAUD");
+  Outbox::begin(Serial1);
+  for (uint8_t i = RATES - 1; i > 0; i--) {
+    open_link(rates[i]);
+    send_baud("rate", ESP8266_BAUD);
+    Outbox::flush();
+  }
+  open_link(ESP8266_BAUD);
+  target = rate = 0;
+  change = change_t::CONFIRMING;
+  asked = millis();
+  confirmed = asked - CONFIRM_EVERY;
+}
+
+void ESP8266::baud(JsonObjectConst doc) {
+  if (change == change_t::ASKED && doc["rate"] == rates[target]) {
+    open_link(rates[target]);
+    change = change_t::CONFIRMING;
+    confirmed = millis() - CONFIRM_EVERY;
+  } else if (change == change_t::CONFIRMING && doc["ok"] == rates[target]) {
+    rate = target;
+    change = change_t::NONE;
+    clean = 0;
+  }
+}
+
+// Carry on with a rate change, and once a second move the link a rate up or
+// down with the frame errors of that second
+void ESP8266::negotiate(const bool second, const uint32_t errors) {
+  const uint32_t now = millis();
+  if (change != change_t::NONE) {
+    if (now - asked >= ESP8266_CONFIRM_MS) {
+      if (target > 0 && target <= ceiling) ceiling = target - 1;
+      open_link(ESP8266_BAUD);
+      rate = target = 0;
+      change = change_t::NONE;
+      clean = 0;
+    } else if (change == change_t::CONFIRMING &&
+               now - confirmed >= CONFIRM_EVERY) {
+      confirmed = now;
+      send_baud("confirm", rates[target]);
+    }
+    return;
+  }
+  if (!second) return;
+  if (errors > ESP8266_ERRORS_MAX && rate > 0) {
+    ceiling = rate - 1;
+    ask(rate - 1);
+  } else if (errors) {
+    clean = 0;
+  } else if (++clean >= ESP8266_PROBE_S && rate < ceiling) {
+    ask(rate + 1);
+  }
+}
+
+// Bytes read from Serial1 and not yet fed to the parser. A command frame
+// that arrived in serialEvent1() waits in the parser for the main loop, with
+// the bytes behind it kept here.
+static uint8_t chunk[64];
+static uint8_t chunk_at = 0;
+static uint8_t chunk_size = 0;
+static bool parked = false;
+static link_stats_t counting = {};
+
+// Device samples, the only frames serialEvent1() runs
+static bool is_sample(const frame_t type) {
+  return type == frame_t::FFT || type == frame_t::BUTTON ||
+         type == frame_t::ACCELEROMETER || type == frame_t::WINDOW;
+}
+
+static void dispatch() {
+  if (parser.type() == frame_t::SOAK)
+    Soak::receive(parser.payload(), parser.size(), parser.errors(),
+                  link_bytes - (chunk_size - chunk_at), ESP8266::stats.baud);
+  else
+    execute(parser.type(), parser.payload(), parser.size());
+}
+
+// The bytes are taken from the serial read buffer in chunks and fed to the
+// frame parser. A flood is cut off after a byte and time budget so a frame
+// is never held up by the link. Without commands the first frame that is
+// not a device sample stops the reading until the main loop runs it.
+// A handler that yields, like a trace dump or a firmware update, comes back
+// here through serialEvent1() while its frame is still in the parser and
+// the chunk, so a nested call returns at once.
+static void read_link(const bool commands) {
+  HOT_PATH("link");
+  static bool busy = false;
+  if (busy || (parked && !commands)) return;
+  busy = true;
+  if (parked) {
+    parked = false;
+    dispatch();
+  }
+  uint32_t budget = ESP8266_RX_BYTES;
+  const uint32_t start = micros();
+  read_start = start;
+  TRACE_BEGIN(LINK);
+  while (!parked) {
+    if (chunk_at == chunk_size) {
+      const int available = Serial1.available();
+      if (available <= 0) break;
+      if (budget == 0 || micros() - start >= ESP8266_RX_MICROS) {
+        counting.deferred++;
+        break;
       }
-      message = "";
-      command = false;
-    } else {
-      if (command) {
-        // Accumulate command until stop character
-        message += c;
-      } else {
+      size_t n = available < (int)sizeof(chunk) ? available : sizeof(chunk);
+      if (n > budget) n = budget;
+      n = Serial1.readBytes((char*)chunk, n);
+      chunk_at = 0;
+      chunk_size = n;
+      budget -= n;
+      link_bytes += n;
+      counting.bytes += n;
+      if (n == 0) break;
+    }
+    const uint8_t byte = chunk[chunk_at++];
+    switch (parser.feed(byte)) {
+      case Frame::CONSOLE:
         // Serial passthrough (USB console logger)
-        Serial.write(c);
-      }
+        Serial.write(byte);
+        break;
+      case Frame::FRAME:
+        counting.frames++;
+        if (commands || is_sample(parser.type()))
+          dispatch();
+        else
+          parked = true;
+        break;
+      default:
+        break;
     }
   }
+  TRACE_END(LINK, ESP8266_RX_BYTES - budget);
+  read_end = micros();
+  busy = false;
+}
+
+// Device samples of Serial1 from serialEvent1(), which yield() also calls
+// inside blocking calls. It only shares config.devices with USB::loop() on
+// the same thread.
+void ESP8266::receive() { read_link(false); }
+
+// Task of the main loop: the frames of the link, commands included, and the
+// link rate. The ESP8266 is asked to drop stale frames while the backlog
+// stays high.
+void ESP8266::loop() {
+  static uint32_t second = millis();
+  read_link(true);
+
+  // Back pressure with hysteresis
+  const int backlog = Serial1.available();
+  if (!stats.throttled && backlog > ESP8266_RX_HIGH) throttle(true);
+  if (stats.throttled && backlog < ESP8266_RX_LOW) throttle(false);
+
+  const bool elapsed = millis() - second >= 1000;
+  if (elapsed) {
+    second = millis();
+    counting.errors = parser.errors() - counting.errors;
+    counting.throttled = stats.throttled;
+    counting.baud = stats.baud;
+    counting.inputs = inputs;
+    counting.input_delay = input_delay_max;
+    inputs = input_delay_max = 0;
+    stats = counting;
+    counting = {};
+    counting.errors = parser.errors();
+  }
+  negotiate(elapsed, stats.errors);
+  announce();
+}
+
+// Signal the ESP8266 to drop or forward low priority frames again
+void ESP8266::throttle(const bool on) {
+  stats.throttled = on;
+  char buffer[64];
+  StaticJsonDocument<64> doc;
+  doc["event"] = "throttle";
+  doc["on"] = on;
+  serializeJson(doc, buffer, sizeof(buffer));
+  rpc(buffer, Outbox::CONTROL);
+}
+
+// Executes a binary frame, JSON frames are parsed as text commands
+void execute(frame_t type, uint8_t* payload, uint16_t size) {
+  switch (type) {
+    case frame_t::JSON:
+      execute((char*)payload);
+      break;
+    case frame_t::FFT: {
+      if (size != 64) break;
+      fft_t fft = {};
+      for (uint8_t i = 0; i < 64; i++) fft.level[i] = payload[i] & 0x0F;
+      config.devices.publish(fft);
+    } break;
+    case frame_t::BUTTON: {
+      if (size != 3 && size != 5) break;
+      joystick_t joystick;
+      joystick.x = (int8_t)payload[0];
+      joystick.y = (int8_t)payload[1];
+      joystick.buttons = payload[2];
+      joystick.time = millis();
+      if (size == 5) {
+        const uint32_t late = input_delay(payload[3] | payload[4] << 8);
+        if (late > input_delay_max) input_delay_max = late;
+        inputs++;
+        joystick.time -= late;
+      }
+      config.devices.publish(joystick);
+    } break;
+    case frame_t::ACCELEROMETER: {
+      if (size != 12) break;
+      accelerometer_t a;
+      memcpy(&a.x, &payload[0], 4);
+      memcpy(&a.y, &payload[4], 4);
+      memcpy(&a.z, &payload[8], 4);
+      a.time = millis();
+      config.devices.publish(a);
+    } break;
+    case frame_t::WINDOW:
+      execute_window(payload, size);
+      break;
+    case frame_t::VOXELS:
+      Voxels::receive(payload, size);
+      break;
+    case frame_t::CLOCK:
+      Sync::receive(payload, size);
+      break;
+    case frame_t::FIELD: {
+      if (size != 3 && size != 7) break;
+      const uint16_t id = payload[1] | payload[2] << 8;
+      if (payload[0] == 1 && size == 7 && id < Schema::count() &&
+          Schema::at(id).type != value_t::STRING) {
+        float value;
+        memcpy(&value, &payload[3], 4);
+        Schema::set(Schema::at(id), value);
+        LCD::wake();
+      }
+      ESP8266::reply_field_id(id);
+    } break;
+    case frame_t::CONFIG:
+      ESP8266::import_config(payload, size);
+      break;
+    case frame_t::UPDATE:
+      ESP8266::update_firmware(payload, size);
+      break;
+    case frame_t::PROBE:
+      Latency::receive(payload, size,
+                       (read_start - read_end) / 2 + micros() - read_start,
+                       window_due);
+      break;
+    default:
+      break;
+  }
+}
+
+// Unpacks a WINDOW frame, deltas only apply on top of the window before
+// them, after a lost window the bands wait for the next keyframe
+static void execute_window(const uint8_t* payload, uint16_t size) {
+  static fft_t fft = {};
+  static bool synced = false;
+  static uint8_t sequence;
+  if (size < 9) return;
+  const bool delta = payload[1] & 1;
+  const bool timed = payload[1] & 2;
+  const uint8_t header = timed ? 11 : 9;
+  if (size < header) return;
+  const bool in_order = synced && payload[0] == (uint8_t)(sequence + 1);
+  sequence = payload[0];
+
+  fft.onset = payload[1] & 4;
+  fft.due = timed ? schedule(payload[9] | payload[10] << 8) : 0;
+  window_due = fft.due;
+  // Sampled a jitter margin before it is due
+  const uint32_t sampled = timed ? fft.due - WINDOW_JITTER : millis();
+
+  const uint8_t buttons = payload[2];
+  joystick_t joystick;
+  joystick.x = (buttons & 0x20 ? 1 : 0) - (buttons & 0x10 ? 1 : 0);
+  joystick.y = (buttons & 0x40 ? 1 : 0) - (buttons & 0x80 ? 1 : 0);
+  joystick.buttons = buttons & 0x0F;
+  joystick.time = sampled;
+  config.devices.publish(joystick);
+
+  accelerometer_t a;
+  float* axis[3] = {&a.x, &a.y, &a.z};
+  for (uint8_t i = 0; i < 3; i++)
+    *axis[i] = (int16_t)(payload[3 + i * 2] | payload[4 + i * 2] << 8) * 0.001f;
+  a.time = sampled;
+  config.devices.publish(a);
+  if (delta && !in_order) {
+    synced = false;
+    return;
+  }
+  const uint8_t* mask = delta ? &payload[header] : nullptr;
+  const uint8_t* bands = &payload[delta ? header + 8 : header];
+  const uint8_t* end = payload + size;
+  uint8_t nibble = 0;
+  for (uint8_t i = 0; i < 64; i++) {
+    if (mask && !(mask[i / 8] & (1 << (i & 7)))) continue;
+    const uint8_t* p = &bands[nibble / 2];
+    if (p >= end) return;
+    fft.level[i] = nibble & 1 ? *p >> 4 : *p & 0x0F;
+    nibble++;
+  }
+  synced = true;
+  config.devices.publish(fft);
+}
+
+// Maps the time a window was sampled on the WIO Terminal to millis() when it
+// is shown. The fastest window seen sets the offset between both clocks, every
+// window is due that long plus WINDOW_JITTER after it was sampled, so the
+// spectrum follows the audio at a steady delay instead of the arrival jitter.
+// The offset creeps up by 1 ms every 256 windows to follow the clocks
+// drifting apart, a jump of a second (a restarted WIO Terminal) resets it.
+static uint32_t schedule(const uint16_t time) {
+  static uint32_t sampled = 0;
+  static uint32_t offset = 0;
+  static uint8_t windows = 0;
+  static bool known = false;
+  // Extend to 32 bits, windows are far less than 32 s apart
+  sampled += (int16_t)(time - (uint16_t)sampled);
+  const uint32_t now = millis();
+  const int32_t behind = now - sampled - offset;
+  if (!known || behind < 0 || behind > 1000) {
+    if (!known || behind > 1000) sampled = time;
+    offset = now - sampled;
+    known = true;
+  } else if (++windows == 0) {
+    offset++;
+  }
+  return sampled + offset + WINDOW_JITTER;
+}
+
+// How much longer than the fastest button change one took from its first
+// edge on the WIO Terminal to here, in ms. The clocks are not synchronised,
+// so the fastest change seen sets the offset between them like schedule()
+// does for the windows, a change a second behind resets it.
+static uint32_t input_delay(const uint16_t time) {
+  static uint32_t changed = 0;
+  static uint32_t offset = 0;
+  static bool known = false;
+  changed += (int16_t)(time - (uint16_t)changed);
+  const uint32_t now = millis();
+  const int32_t behind = now - changed - offset;
+  if (!known || behind < 0 || behind > 1000) {
+    if (!known || behind > 1000) changed = time;
+    offset = now - changed;
+    known = true;
+    return 0;
+  }
+  return behind;
+}
+
+/*------------------------------------------------------------------------------
+ * JSON COMMANDS
+ *------------------------------------------------------------------------------
+ * One handler per event, found by a binary search over the sorted table. The
+ * command text is parsed in place, so strings in the document point into the
+ * received frame and nothing is copied.
+ *----------------------------------------------------------------------------*/
+typedef void (*handler_t)(JsonObjectConst doc);
+struct command_t {
+  const char* event;
+  handler_t handler;
+};
+
+static void on_baud(JsonObjectConst doc) { ESP8266::baud(doc); }
+
+static void on_accelerometer(JsonObjectConst doc) {
+  accelerometer_t a;
+  a.x = doc["x"] | 0.0f;
+  a.y = doc["y"] | 0.0f;
+  a.z = doc["z"] | 0.0f;
+  a.time = millis();
+  config.devices.publish(a);
+}
+
+static void on_button(JsonObjectConst doc) {
+  joystick_t joystick;
+  joystick.x = doc["x"] | 0.0f;
+  joystick.y = doc["y"] | 0.0f;
+  joystick.buttons = 0;
+  if (doc["z"] | false) joystick.buttons |= joystick_t::PRESS;
+  if (doc["a"] | false) joystick.buttons |= joystick_t::A;
+  if (doc["b"] | false) joystick.buttons |= joystick_t::B;
+  if (doc["c"] | false) joystick.buttons |= joystick_t::C;
+  joystick.time = millis();
+  config.devices.publish(joystick);
+}
+
+// Older senders, a letter from 'A' per level
+static void on_fft(JsonObjectConst doc) {
+  const char* data = doc["data"] | "";
+  fft_t fft = {};
+  for (uint8_t i = 0; i < 64 && data[i]; i++)
+    fft.level[i] = (data[i] - 'A') & 0x0F;
+  config.devices.publish(fft);
+}
+
+static void on_export(JsonObjectConst doc) {
+  ESP8266::export_config(!(doc["all"] | false));
+}
+
+static void on_frames(JsonObjectConst doc) { ESP8266::reply_frames(); }
+
+static void on_get(JsonObjectConst doc) { ESP8266::reply_field(doc["path"]); }
+
+// Probe the latency of an input, which the WIO Terminal hears, or reply
+// the latency per stage, see core/Latency.h
+static void on_latency(JsonObjectConst doc) {
+  const char* probe = doc["probe"];
+  if (!probe) {
+    ESP8266::reply_latency();
+    return;
+  }
+  for (uint8_t i = 0; i < Latency::SOURCES; i++)
+    if (!strcmp(probe, Latency::sources[i]))
+      Latency::probe((Latency::source_t)i);
+  ESP8266::reply_probe();
+}
+
+static void on_link(JsonObjectConst doc) { ESP8266::reply_link(); }
+
+static void on_memory(JsonObjectConst doc) { ESP8266::reply_memory(); }
+
+static void on_power(JsonObjectConst doc) { ESP8266::reply_power(); }
+
+static void on_preview(JsonObjectConst doc) { ESP8266::preview(doc["on"]); }
+
+// Store an uploaded bytecode program, hex encoded, and make it the program
+// of the Program animation
+static void on_program(JsonObjectConst doc) {
+  const char* name = doc["name"] | "";
+  const char* code = doc["code"] | "";
+  auto nibble = [](const char c) -> int {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  };
+  uint8_t data[Bytecode::SIZE];
+  uint16_t size = 0;
+  bool valid = strlen(code) % 2 == 0 && strlen(code) / 2 <= sizeof(data);
+  for (; valid && code[size * 2]; size++) {
+    const int hi = nibble(code[size * 2]);
+    const int lo = nibble(code[size * 2 + 1]);
+    valid = hi >= 0 && lo >= 0;
+    data[size] = hi << 4 | lo;
+  }
+  const bool stored = valid && Programs::store(name, data, size);
+  if (stored)
+    snprintf(config.animation.program.name,
+             sizeof(config.animation.program.name), "%s", name);
+  ESP8266::reply_program(name, stored);
+}
+
+// Record the cube to a file on the SD card, without file stop recording
+static void on_record(JsonObjectConst doc) {
+  const char* file = doc["file"];
+  if (file)
+    Recorder::start(file);
+  else
+    Recorder::stop();
+  ESP8266::reply_record();
+}
+
+// Any config field by path, the reply holds the value after clamping
+static void on_set(JsonObjectConst doc) {
+  const char* path = doc["path"];
+  const field_t* f = path ? Schema::find(path) : nullptr;
+  JsonVariantConst value = doc["value"];
+  if (f && f->type == value_t::STRING && value.is<const char*>())
+    Schema::set(*f, value.as<const char*>());
+  else if (f && f->type != value_t::STRING && !value.isNull())
+    Schema::set(*f, value.as<float>());
+  ESP8266::reply_field(path);
+  // The GUI shows some of the fields
+  LCD::wake();
+}
+
+// Start a load test of the link or reply its counts, see core/Soak.h
+static void on_soak(JsonObjectConst doc) {
+  if (doc.containsKey("rate"))
+    Soak::start(doc["rate"], doc["size"] | 64, doc["ms"] | 10000);
+  else
+    ESP8266::reply_soak();
+}
+
+// Unix time from the ESP8266, ignored until its clock is synced. The clock
+// only counts seconds, the one nearest to now is taken.
+static void on_time(JsonObjectConst doc) {
+  if (!(doc["synced"] | true)) return;
+  const uint32_t epoc = doc["epoc"];
+  const uint32_t us = doc["us"] | 0;
+  LOG(TIME, epoc, us);
+  setTime(epoc + (us >= 500000));
+}
+
+// Log frames over the link as well, see core/Log.h
+static void on_log(JsonObjectConst doc) { Log::link(doc["on"]); }
+
+// The trace ring to the USB console, see core/Trace.h
+static void on_trace(JsonObjectConst doc) { Trace::dump(); }
+
+// Keep sorted by event (strcmp order)
+static const command_t commands[] = {
+    {"accelerometer", on_accelerometer},
+    {"baud", on_baud},
+    {"button", on_button},
+    {"export", on_export},
+    {"fft", on_fft},
+    {"frames", on_frames},
+    {"get", on_get},
+    {"latency", on_latency},
+    {"link", on_link},
+    {"log", on_log},
+    {"memory", on_memory},
+    {"power", on_power},
+    {"preview", on_preview},
+    {"program", on_program},
+    {"record", on_record},
+    {"set", on_set},
+    {"soak", on_soak},
+    {"time", on_time},
+    {"trace", on_trace},
+};
+
+static handler_t find_handler(const char* event) {
+  uint8_t lo = 0, hi = sizeof(commands) / sizeof(commands[0]);
+  while (lo < hi) {
+    const uint8_t mid = (lo + hi) / 2;
+    const int c = strcmp(event, commands[mid].event);
+    if (c == 0) return commands[mid].handler;
+    if (c < 0)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return nullptr;
 }
 
-// Executes a json command present in the char_buffer
-void execute(const char* char_buffer) {
+// The event of a command, read up to its value without a document
+static bool is_event(const char* text, const char* event) {
+  JsonReader json(text);
+  for (json_t t = json.next(); t != json_t::END && t != json_t::ERROR;
+       t = json.next()) {
+    if (t == json_t::KEY && !strcmp(json.path(), "event"))
+      return json.next() == json_t::STRING && !strcmp(json.text(), event);
+  }
+  return false;
+}
+
+// Executes a json command present in the char_buffer, which is modified. A
+// config command is set field by field as it is read, whatever its size:
+// {"event":"config","power":{"brightness":0.5}}
+void execute(char* char_buffer) {
+  if (is_event(char_buffer, "config")) {
+    ESP8266::reply_fields("config", Schema::read_json(char_buffer, config));
+    // The GUI shows some of the fields
+    LCD::wake();
+    return;
+  }
   StaticJsonDocument<1024> doc;
   DeserializationError err = deserializeJson(doc, char_buffer);
   if (err) {
-    Serial.printf("Deserialization error: %s\n", err.c_str());
+    LOG(JSON_ERROR, err.code());
     return;
   }
-  String event = doc["event"];
-  // Serial.printf("Executing: %s\n", event.c_str());
-  // Serial.println(char_buffer);
-  if (event.equals("button")) {
-  //  config.devices.joystick.x = doc["x"];
-  //  config.devices.joystick.y = doc["y"];
- //   config.devices.joystick.z = doc["z"];
-//    config.hid.button.a = doc["a"];
-//    config.hid.button.b = doc["b"];
-//    config.hid.button.c = doc["c"];
-  } else if (event.equals("fft")) {
-    String msg = doc["data"];
-    for (uint16_t i = 0; i < msg.length(); i++) {
-      char c = msg.charAt(i) - 'A';
-  //    config.hid.fft.data[i] = (uint8_t)c;
-   //   config.hid.fft.updated = true;
-    }
-  } else if (event.equals("time")) {
-    Serial.println(char_buffer);
-    uint32_t epoc = doc["epoc"];
-    setTime(epoc);
-  } else if (event.equals("accelerometer")) {
-    //config.hid.accelerometer.x = doc["x"];
-    //config.hid.accelerometer.y = doc["y"];
-    //config.hid.accelerometer.z = doc["z"];
-  }
+  const char* event = doc["event"];
+  handler_t handler = event ? find_handler(event) : nullptr;
+  if (handler) handler(doc.as<JsonObjectConst>());
 }
 
-void ESP8266::rpc(String msg) {
-  Serial1.write(ESP_START);
-  Serial1.print(msg);
-  Serial1.write(ESP_STOP);
-  Serial1.flush();
+void ESP8266::rpc(const char* msg, const Outbox::priority_t priority) {
+  Outbox::push(priority, ESP_START, msg, ESP_STOP);
+}
+
+// Tell the ESP8266 the position of the cube and whether it has to join the
+// others, right away when that changes and every second while it shares an
+// animation so a restarted ESP8266 learns it again
+void ESP8266::announce() {
+  static uint8_t cube = 0;
+  static uint8_t cubes = 1;
+  static bool join = false;
+  static uint32_t sent = 0;
+  const bool changed = cube != config.sync.cube ||
+                       cubes != config.sync.cubes || join != !Sync::joined;
+  if (!changed && (cubes < 2 || millis() - sent < 1000)) return;
+  cube = config.sync.cube;
+  cubes = config.sync.cubes;
+  join = !Sync::joined;
+  sent = millis();
+  char buffer[64];
+  StaticJsonDocument<64> doc;
+  doc["event"] = "sync";
+  doc["cube"] = cube;
+  doc["cubes"] = cubes;
+  doc["join"] = join;
+  serializeJson(doc, buffer, sizeof(buffer));
+  rpc(buffer);
 }
 
 void ESP8266::request_time() {
@@ -99,4 +756,401 @@ void ESP8266::request_time() {
   serializeJson(doc, buffer);
   rpc(buffer);
   doc.clear();
-}
\ No newline at end of file
+}
+
+void ESP8266::update() {
+  Outbox::drain();
+  preview();
+  export_slice();
+  soak();
+}
+
+// The SOAK frames that are due, as long as the Outbox takes them without a
+// drop, see core/Soak.h
+void ESP8266::soak() {
+  uint16_t size;
+  while ((size = Soak::due()) && Outbox::room(Outbox::BULK) >= size + 6) {
+    Soak::fill(soak_payload);
+    send(frame_t::SOAK, soak_payload, size);
+  }
+}
+
+void ESP8266::preview(const bool on) {
+  previewing = on;
+  preview_asked = millis();
+}
+
+// XOR delta of the cells against the preview before, (skip, literals) pairs.
+// Returns 0 when it is not smaller than capacity.
+static uint16_t preview_delta(uint8_t* out, const uint16_t capacity,
+                              const uint16_t* cells, const uint16_t* before) {
+  const uint16_t count = Preview::CELLS * Preview::CELLS;
+  uint16_t n = 0, i = 0;
+  while (true) {
+    uint16_t skip = 0;
+    while (i + skip < count && cells[i + skip] == before[i + skip]) skip++;
+    if (i + skip == count) break;
+    i += skip;
+    for (; skip > 255; skip -= 255) {
+      if (n + 2 > capacity) return 0;
+      out[n++] = 255;
+      out[n++] = 0;
+    }
+    uint16_t literals = 0;
+    while (i + literals < count && literals < 255 &&
+           cells[i + literals] != before[i + literals])
+      literals++;
+    if (n + 2 + literals * 2 > capacity) return 0;
+    out[n++] = skip;
+    out[n++] = literals;
+    for (; literals; literals--, i++) {
+      const uint16_t x = cells[i] ^ before[i];
+      out[n++] = x & 0xFF;
+      out[n++] = x >> 8;
+    }
+  }
+  if (n == 0) {
+    out[n++] = 0;
+    out[n++] = 0;
+  }
+  return n;
+}
+
+// The top view of the last frame, a delta when that is smaller. It stops on
+// its own when the ESP8266 or its viewers are gone.
+void ESP8266::preview() {
+  static const uint16_t COUNT = Preview::CELLS * Preview::CELLS;
+  static uint16_t before[COUNT];
+  static uint8_t sequence = 0;
+  static uint32_t sent = 0;
+  if (!previewing || millis() - preview_asked >= ESP8266_PREVIEW_TIMEOUT_MS ||
+      millis() - sent < ESP8266_PREVIEW_MS)
+    return;
+  sent = millis();
+  uint16_t top[Preview::CELLS][Preview::CELLS];
+  Preview::top(top);
+  const uint16_t* cells = &top[0][0];
+  uint8_t payload[2 + COUNT * 2];
+  uint16_t size = 0;
+  if (sequence % ESP8266_PREVIEW_KEYFRAME)
+    size = preview_delta(&payload[2], COUNT * 2 - 1, cells, before);
+  payload[0] = sequence++;
+  payload[1] = size ? 1 : 0;
+  if (!size) {
+    size = COUNT * 2;
+    for (uint16_t i = 0; i < COUNT; i++) {
+      payload[2 + i * 2] = cells[i] & 0xFF;
+      payload[3 + i * 2] = cells[i] >> 8;
+    }
+  }
+  memcpy(before, cells, sizeof(before));
+  send(frame_t::PREVIEW, payload, 2 + size);
+}
+
+// The text of a CONFIG frame behind its flags, a slice ends after the field
+// that crossed ESP8266_CONFIG_SLICE
+class Slice : public Print {
+ public:
+  uint8_t data[FRAME_MAX];
+  size_t size = 1;
+  size_t write(uint8_t b) override {
+    if (size == sizeof(data)) return 0;
+    data[size++] = b;
+    return 1;
+  }
+};
+
+void ESP8266::export_config(const bool sparse) {
+  exporting = true;
+  export_sparse = sparse;
+  export_cursor = Schema::cursor_t();
+}
+
+// The next slice straight from the config, nothing holds the whole text
+void ESP8266::export_slice() {
+  if (!exporting) return;
+  static Slice slice;
+  slice.size = 1;
+  const bool first = export_cursor.bytes == 0;
+  const bool last = Schema::write_json(slice, export_cursor,
+                                       ESP8266_CONFIG_SLICE, config,
+                                       export_sparse);
+  slice.data[0] = (first ? 1 : 0) | (last ? 2 : 0);
+  send(frame_t::CONFIG, slice.data, slice.size);
+  exporting = !last;
+}
+
+// The slices go to a file, once the last one is in it is read field by
+// field. The result goes to the ESP8266 as a command, it answers the upload
+// with it and passes it on to its clients.
+void ESP8266::import_config(const uint8_t* payload, const uint16_t size) {
+  static File file;
+  FS* fs = config.filesystem();
+  if (!fs || size < 1) return;
+  if (payload[0] & 1) {
+    if (file) file.close();
+    fs->remove(ESP8266_IMPORT);
+    file = fs->open(ESP8266_IMPORT, FILE_WRITE);
+  }
+  if (!file) return;
+  file.write(&payload[1], size - 1);
+  if (!(payload[0] & 2)) return;
+  file.close();
+  file = fs->open(ESP8266_IMPORT, FILE_READ);
+  const int found = file ? Schema::read_json(file, config) : -1;
+  file.close();
+  fs->remove(ESP8266_IMPORT);
+  // The GUI shows some of the fields
+  LCD::wake();
+  reply_fields("import", found);
+}
+
+void ESP8266::reply_fields(const char* event, const int found) {
+  char buffer[64];
+  StaticJsonDocument<64> doc;
+  doc["event"] = event;
+  doc["ok"] = found >= 0;
+  doc["fields"] = found < 0 ? 0 : found;
+  serializeJson(doc, buffer, sizeof(buffer));
+  rpc(buffer);
+}
+
+// The ACK goes out before the staged image is copied, the Teensy resets
+// at the end of it and comes back at ESP8266_BAUD
+void ESP8266::update_firmware(const uint8_t* payload, const uint16_t size) {
+  const Firmware::ack_t ack = Firmware::receive(payload, size);
+  const uint8_t reply[4] = {Firmware::ACK, (uint8_t)(ack.next & 0xFF),
+                            (uint8_t)(ack.next >> 8), ack.status};
+  send(frame_t::UPDATE, reply, sizeof(reply), Outbox::CONTROL);
+  if (!ack.apply) return;
+  Outbox::flush();
+  Firmware::apply();
+}
+
+// Binary replies and streams, the ESP8266 passes frames through to its
+// clients
+void ESP8266::send(const frame_t type, const void* payload,
+                   const uint16_t size, const Outbox::priority_t priority) {
+  const size_t n = Frame::encode(frame, sizeof(frame), type, payload, size);
+  if (!n) return;
+  Outbox::push(priority, frame, n);
+}
+
+// Replies to the requesting tcp client are framed as a WIO command, so the
+// ESP8266 passes them through instead of executing them.
+void ESP8266::reply(const char* msg) {
+  Outbox::push(Outbox::REPLY, WIO_START, msg, WIO_STOP);
+}
+
+// Send the per frame current readings to the requesting tcp client
+void ESP8266::reply_power() {
+  char buffer[1024];
+  uint32_t history[Display::POWERHISTORY];
+  StaticJsonDocument<2048> doc;
+  Display::getPowerHistory(history);
+  doc["event"] = "power";
+  doc["max"] = Display::getMaxMilliamps();
+  doc["estimate"] = Display::getMilliamps();
+  JsonArray data = doc.createNestedArray("data");
+  for (uint8_t i = 0; i < Display::POWERHISTORY; i++) data.add(history[i]);
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
+
+// Send the value of a config field, without value when the path is unknown
+void ESP8266::reply_field(const char* path) {
+  char buffer[256];
+  StaticJsonDocument<256> doc;
+  const field_t* f = path ? Schema::find(path) : nullptr;
+  doc["event"] = "get";
+  doc["path"] = path;
+  if (f) {
+    doc["id"] = Schema::id(*f);
+    if (f->type == value_t::STRING)
+      doc["value"] = Schema::text(*f);
+    else if (f->type == value_t::FLOAT)
+      doc["value"] = Schema::get(*f);
+    else
+      doc["value"] = (int32_t)Schema::get(*f);
+    doc["min"] = f->min;
+    doc["max"] = f->max;
+  }
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
+
+void ESP8266::reply_field_id(const uint16_t id) {
+  uint8_t payload[15];
+  payload[1] = id & 0xFF;
+  payload[2] = id >> 8;
+  if (id >= Schema::count() || Schema::at(id).type == value_t::STRING) {
+    payload[0] = 3;
+    send(frame_t::FIELD, payload, 3, Outbox::REPLY);
+    return;
+  }
+  const field_t& f = Schema::at(id);
+  const float value = Schema::get(f);
+  payload[0] = 2;
+  memcpy(&payload[3], &value, 4);
+  memcpy(&payload[7], &f.min, 4);
+  memcpy(&payload[11], &f.max, 4);
+  send(frame_t::FIELD, payload, sizeof(payload), Outbox::REPLY);
+}
+
+// Send the link statistics of the last second
+void ESP8266::reply_link() {
+  char buffer[512];
+  StaticJsonDocument<512> doc;
+  doc["event"] = "link";
+  doc["bytes"] = stats.bytes;
+  doc["frames"] = stats.frames;
+  doc["baud"] = stats.baud;
+  doc["errors"] = stats.errors;
+  doc["deferred"] = stats.deferred;
+  doc["throttled"] = stats.throttled;
+  doc["inputs"] = stats.inputs;
+  doc["input_delay"] = stats.input_delay;
+  doc["overruns"] = config.devices.overruns();
+  doc["voxels"] = Voxels::completed;
+  doc["voxels_dropped"] = Voxels::dropped;
+  doc["usb_frames"] = USB::frames;
+  doc["usb_errors"] = USB::errors;
+  doc["net_datagrams"] = Net::datagrams;
+  doc["net_frames"] = Net::frames;
+  doc["tx_queued"] = Outbox::queued();
+  doc["tx_dropped"] = Outbox::dropped();
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
+
+// Send the latency per stage of the probes since probing started, see
+// core/Latency.h
+void ESP8266::reply_latency() {
+  char buffer[768];
+  StaticJsonDocument<1536> doc;
+  doc["event"] = "latency";
+  doc["probe"] = Latency::sources[Latency::source];
+  doc["probes"] = Latency::probes;
+  doc["missed"] = Latency::missed;
+  for (uint8_t i = 0; i < Latency::HOPS; i++) {
+    const Histogram& h = Latency::hops[i];
+    JsonObject o = doc.createNestedObject(Latency::names[i]);
+    o["min"] = h.min();
+    o["avg"] = h.avg();
+    o["max"] = h.max();
+    o["p99"] = h.percentile(99);
+  }
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
+
+// Send the counts of the load test, see core/Soak.h
+void ESP8266::reply_soak() {
+  char buffer[384];
+  StaticJsonDocument<384> doc;
+  const Soak::stats_t& s = Soak::stats;
+  doc["event"] = "soak";
+  doc["frames"] = s.frames;
+  doc["bytes"] = s.bytes;
+  doc["lost"] = s.lost;
+  doc["reordered"] = s.reordered;
+  doc["corrupt"] = s.corrupt;
+  doc["errors"] = s.errors;
+  doc["resyncs"] = s.resyncs;
+  doc["resync_max"] = s.resync_max;
+  doc["resync_avg"] = s.resyncs ? s.resync_sum / s.resyncs : 0;
+  doc["ms"] = s.ms;
+  doc["sent"] = s.sent;
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
+
+// Tell the WIO Terminal which input to send probes behind
+void ESP8266::reply_probe() {
+  char buffer[64];
+  StaticJsonDocument<64> doc;
+  doc["event"] = "probe";
+  doc["on"] = Latency::sources[Latency::source];
+  serializeJson(doc, buffer, sizeof(buffer));
+  reply(buffer);
+}
+
+// Send the static buffers per subsystem as [ram1, ram2, psram], the
+// animation objects, what is left per region and the stack high watermark
+void ESP8266::reply_memory() {
+  char buffer[512];
+  StaticJsonDocument<768> doc;
+  doc["event"] = "memory";
+  JsonObject systems = doc.createNestedObject("systems");
+  for (uint8_t i = 0; i < Footprint::SUBSYSTEMS; i++) {
+    Footprint::usage_t usage = {};
+    Footprint::subsystems[i].footprint(usage);
+    JsonArray bytes = systems.createNestedArray(Footprint::subsystems[i].name);
+    for (uint8_t r = 0; r < Footprint::REGIONS; r++) bytes.add(usage.bytes[r]);
+  }
+  doc["animations"] = Footprint::animations();
+  JsonArray free = doc.createNestedArray("free");
+  for (uint8_t r = 0; r < Footprint::REGIONS; r++)
+    free.add(Footprint::available((Footprint::region_t)r));
+  JsonArray stack = doc.createNestedArray("stack");
+  stack.add(Footprint::stack_used());
+  stack.add(Footprint::stack_size());
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
+
+// Send whether an uploaded program was stored
+void ESP8266::reply_program(const char* name, const bool stored) {
+  char buffer[128];
+  StaticJsonDocument<128> doc;
+  doc["event"] = "program";
+  doc["name"] = name;
+  doc["stored"] = stored;
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
+
+// Send the state of the recorder
+void ESP8266::reply_record() {
+  char buffer[128];
+  StaticJsonDocument<128> doc;
+  doc["event"] = "record";
+  doc["recording"] = Recorder::recording();
+  doc["frames"] = Recorder::frames;
+  doc["dropped"] = Recorder::dropped;
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
+
+// Send the frame timing statistics of the current measurement window
+void ESP8266::reply_frames() {
+  char buffer[512];
+  StaticJsonDocument<768> doc;
+  doc["event"] = "frames";
+  doc["fps"] = Scheduler::fps();
+  doc["target"] = config.display.fps;
+  doc["frames"] = Scheduler::frames;
+  doc["dropped"] = Scheduler::dropped;
+  doc["busy"] = Scheduler::busy;
+  const char* names[] = {"draw", "transpose", "slack", "wait"};
+  const Histogram* histograms[] = {&Scheduler::draw, &Scheduler::transpose,
+                                   &Scheduler::slack, &Scheduler::wait};
+  for (uint8_t i = 0; i < 4; i++) {
+    JsonObject o = doc.createNestedObject(names[i]);
+    o["min"] = histograms[i]->min();
+    o["avg"] = histograms[i]->avg();
+    o["max"] = histograms[i]->max();
+    o["p99"] = histograms[i]->percentile(99);
+  }
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  reply(buffer);
+}
@@ -6,14 +6,124 @@
 #include <string.h>
 
 #include "Config.h"
+#include "Frame.h"
+#include "Outbox.h"
+
+// UART baudrate the link starts at after a reset of either end, the ESP8266
+// firmware has to match it. While the link stays clean it is moved up the
+// rates one at a time, 2 Mbaud is enough for about 16 live RGB voxel frames
+// per second. See the link rate in ESP8266.cpp.
+#define ESP8266_BAUD 460800
+#define ESP8266_RATES {460800, 921600, 1500000, 2000000, 3000000}
+// Seconds without frame errors before the next rate is tried, frame errors
+// in a second that step the link down and rule out the rate it was at
+#define ESP8266_PROBE_S 5
+#define ESP8266_ERRORS_MAX 4
+// A rate change that is not confirmed in time falls back to ESP8266_BAUD on
+// both ends, the ESP8266 gives up after half of it
+#define ESP8266_CONFIRM_MS 1000
+// Hardware flow control, RTS of Serial1 to CTS (GPIO13) of the ESP8266 and
+// RTS (GPIO15) of the ESP8266 to CTS of Serial1, which has to be a pin
+// attachCts() takes. The ESP8266 firmware needs SERIAL_FLOW as well.
+// #define ESP8266_FLOW
+#define ESP8266_RTS 2
+#define ESP8266_CTS 6
+// Receive budget of one loop() call, the rest stays in the serial buffer and
+// the parser carries on with it next time
+#define ESP8266_RX_BYTES 1024
+#define ESP8266_RX_MICROS 500
+// Ask the ESP8266 to drop stale frames above this backlog, release below
+// the low mark (the read buffer holds 4 KB)
+#define ESP8266_RX_HIGH 2048
+#define ESP8266_RX_LOW 512
+// Delay in ms of a timed audio window behind the fastest one, covers the
+// jitter of WiFi and the link
+#define WINDOW_JITTER 30
+// Top view of the cube for a remote preview, sent every ESP8266_PREVIEW_MS
+// until the ESP8266 did not repeat the preview event for the timeout. Every
+// ESP8266_PREVIEW_KEYFRAME previews one is whole, so a new viewer gets the
+// picture.
+#define ESP8266_PREVIEW_MS 100
+#define ESP8266_PREVIEW_TIMEOUT_MS 3000
+#define ESP8266_PREVIEW_KEYFRAME 10
+// Text of a config export per CONFIG frame and main loop, an import is
+// collected in a file and read field by field once complete
+#define ESP8266_CONFIG_SLICE 512
+#define ESP8266_IMPORT "/import.json"
+
+// Link statistics of the last second
+struct link_stats_t {
+  uint32_t bytes;
+  uint32_t frames;
+  uint32_t errors;
+  // Calls that ran out of budget with bytes left
+  uint32_t deferred;
+  bool throttled;
+  // Rate of the link
+  uint32_t baud;
+  // Timed button changes and the longest one took in ms, beyond the fastest
+  uint32_t inputs;
+  uint32_t input_delay;
+};
 
 class ESP8266 {
- private:
- protected:
  public:
+  static link_stats_t stats;
+
   static void reset();
+  // Open Serial1 at ESP8266_BAUD
+  static void begin();
+  // Task of the main loop, every frame of the link
   static void loop();
-  static void rpc(String msg);
+  // serialEvent1(), only the device samples until the next loop()
+  static void receive();
+  // The serial buffers and frames of the link, see core/Footprint.h
+  static void footprint(Footprint::usage_t& usage);
+  // Main loop, the preview while the ESP8266 asks for it, the next slice of
+  // a config export and the frames of a load test
+  static void update();
+  // The ESP8266 has viewers of the preview
+  static void preview(const bool on);
+  // Send the config as CONFIG frames, only the overridden fields when sparse
+  static void export_config(const bool sparse);
+  // A CONFIG frame of an import
+  static void import_config(const uint8_t* payload, const uint16_t size);
+  // An UPDATE frame of a firmware update, answered before an update is
+  // applied
+  static void update_firmware(const uint8_t* payload, const uint16_t size);
+  // A binary frame to the ESP8266, it passes it through to its clients
+  static void send(const frame_t type, const void* payload,
+                   const uint16_t size,
+                   const Outbox::priority_t priority = Outbox::BULK);
+  // A command to the ESP8266, queued in the Outbox
+  static void rpc(const char* msg,
+                  const Outbox::priority_t priority = Outbox::REPLY);
   static void request_time();
+  static void reply_power();
+  static void reply_frames();
+  static void reply_field(const char* path);
+  // Same as a FIELD frame, by the id of the field in the schema
+  static void reply_field_id(const uint16_t id);
+  static void reply_link();
+  static void reply_latency();
+  static void reply_probe();
+  static void reply_memory();
+  static void reply_record();
+  static void reply_soak();
+  static void reply_program(const char* name, const bool stored);
+  // Fields set by an import or a config command, found < 0 when the text
+  // did not parse
+  static void reply_fields(const char* event, const int found);
+  // A rate change acknowledged or confirmed by the ESP8266
+  static void baud(JsonObjectConst doc);
+
+ private:
+  static void reply(const char* msg);
+  static void preview();
+  static void export_slice();
+  static void soak();
+  static void throttle(const bool on);
+  static void announce();
+  static void negotiate(const bool second, const uint32_t errors);
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "Energy.h"
+
+#include <Arduino.h>
+
+#include "Config.h"
+/*------------------------------------------------------------------------------
+ * ENERGY CLASS
+ *----------------------------------------------------------------------------*/
+uint8_t Energy::dimming = 255;
+float Energy::average = 0;
+Energy::profile_t Energy::profiles[ITEMS] = {};
+uint16_t Energy::playing = ITEMS;
+uint8_t Energy::target = 255;
+float Energy::charge = 0;
+float Energy::steady_seconds = 0;
+float Energy::played = 0;
+
+bool Energy::enabled() {
+  return config.power.average_milliamps && config.power.average_minutes;
+}
+
+void Energy::add(const uint32_t milliamps, const float dt, const bool steady) {
+  const float window = config.power.average_minutes * 60.0f;
+  const float k = window > dt ? dt / window : 1;
+  average += (milliamps - average) * k;
+  played += dt;
+  // As drawn without dimming
+  if (steady && dimming) {
+    charge += milliamps * 255.0f / dimming * dt;
+    steady_seconds += dt;
+  }
+  const uint8_t goal = enabled() ? target : 255;
+  if (dimming < goal) dimming++;
+  if (dimming > goal) dimming--;
+}
+
+uint8_t Energy::plan(const uint16_t item, const bool endless) {
+  if (!enabled() || item >= ITEMS || !profiles[item].milliamps) return 255;
+  const profile_t &p = profiles[item];
+  // The average after a play of the current c: a + (c - a) * k
+  const float window = config.power.average_minutes * 60.0f;
+  const float k = endless ? 1 : 1 - expf(-p.seconds / window);
+  if (k <= 0) return 255;
+  const float budget = config.power.average_milliamps;
+  const float allowed = average + (budget - average) / k;
+  const float d = 255 * allowed / p.milliamps;
+  return d >= 255 ? 255 : d <= FLOOR ? FLOOR : (uint8_t)d;
+}
+
+bool Energy::fits(const uint16_t item) { return plan(item, false) >= FIT; }
+
+void Energy::start(const uint16_t item, const bool endless) {
+  // The play that ends teaches its profile
+  if (playing < ITEMS && steady_seconds > 1) {
+    profile_t &p = profiles[playing];
+    const float milliamps = charge / steady_seconds;
+    if (!p.milliamps) {
+      p.milliamps = milliamps;
+      p.seconds = played;
+    } else {
+      p.milliamps += (milliamps - p.milliamps) / LEARN;
+      p.seconds += (played - p.seconds) / LEARN;
+    }
+  }
+  playing = item;
+  charge = steady_seconds = played = 0;
+  target = plan(item, endless);
+}
@@ -0,0 +1,75 @@
+#ifndef ENERGY_H
+#define ENERGY_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * ENERGY CLASS
+ *------------------------------------------------------------------------------
+ * Keeps the average current over config.power.average_minutes within
+ * config.power.average_milliamps by planning the sequence of animations,
+ * where the current limiter of the Display only cuts the peaks of frames.
+ *
+ * Every frame the estimated current (Display::getMilliamps()) moves a running
+ * average with the window as time constant. While the animations drawn are
+ * all running (none starting or ending) the current is learned into the
+ * profile of the item of the sequence that plays, as it would be without
+ * dimming, together with the time the item plays. A profile is a slow average
+ * over its plays since starting, an item that never played has none.
+ *
+ * Animation::next() asks fits() for the item coming up: the average left
+ * behind at the end of its play must stay within budget without dimming it
+ * much. An item that does not fit gives its turn to a lighter one a few
+ * items further on, so it plays after the average cooled down. When it still
+ * does not fit it is dimmed from its start as plan() says, just enough to end
+ * its play at the budget. The dimming follows the plan by a step per frame
+ * and is fused into the master brightness of the Display, so there is no
+ * pumping like with the limiter.
+ *
+ * Telemetry reports the average and the dimming.
+ *
+ * if (!Energy::fits(item)) ...;  // try a lighter one first
+ * Energy::start(item, false);
+ * Energy::add(Display::getMilliamps(), dt, steady);  // every frame
+ * Display::setDimming(Energy::dimming);
+ *----------------------------------------------------------------------------*/
+class Energy {
+ public:
+  // Dimming of the animations, 255 is none
+  static uint8_t dimming;
+  // Running average of the estimated current in milliamps
+  static float average;
+
+  // A budget is configured
+  static bool enabled();
+  // Estimated current of the last frame and the time it was shown, steady
+  // when all animations drawn were running
+  static void add(const uint32_t milliamps, const float dt, const bool steady);
+  // Dimming that brings the average to the budget at the end of a play of
+  // item (255 without a budget or a profile), endless when it plays on
+  static uint8_t plan(const uint16_t item, const bool endless);
+  // Item plays next without dimming it below FIT
+  static bool fits(const uint16_t item);
+  // Item of the sequence starts playing now
+  static void start(const uint16_t item, const bool endless);
+
+ private:
+  static const uint8_t ITEMS = 64;
+  static const uint8_t FIT = 224;
+  // Plans never dim below this
+  static const uint8_t FLOOR = 64;
+  // Weight of a new play in a profile (1 / LEARN)
+  static const uint8_t LEARN = 4;
+  // Current without dimming and the time of a play in seconds
+  struct profile_t {
+    float milliamps;
+    float seconds;
+  };
+  static profile_t profiles[ITEMS];
+  // The item that plays, its planned dimming, the charge (mA * s) and time
+  // it was steady and the time it played
+  static uint16_t playing;
+  static uint8_t target;
+  static float charge;
+  static float steady_seconds;
+  static float played;
+};
+#endif
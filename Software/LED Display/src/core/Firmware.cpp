@@ -0,0 +1,164 @@
+#include "Firmware.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+#include "Config.h"
+#include "Log.h"
+#include "power/Crc.h"
+#include "power/Lz4.h"
+
+// Flash programming of the EEPROM emulation in the core, both run from RAM
+extern "C" {
+void eepromemu_flash_write(void *addr, const void *data, uint32_t len);
+void eepromemu_flash_erase_sector(void *addr);
+}
+// Size of the program image in flash, from the linker script
+extern unsigned long _flashimagelen;
+
+#define FLASH_BASE 0x60000000
+// Bytes written by one program command
+#define FLASH_PAGE 256
+// Boot header of an image: the FlexSPI config block at the start and the
+// image vector table behind it
+#define FCFB_TAG 0x42464346
+#define IVT_OFFSET 0x1000
+#define IVT_TAG 0xD1
+
+uint32_t Firmware::size = 0;
+uint32_t Firmware::crc = 0;
+uint16_t Firmware::blocks = 0;
+uint16_t Firmware::next = 0;
+uint32_t Firmware::base = 0;
+uint32_t Firmware::written = 0;
+uint16_t Firmware::fill = 0;
+bool Firmware::running = false;
+
+// Decoded blocks waiting for their sector to be written, also the copy
+// buffer of apply()
+static uint8_t sector[FIRMWARE_SECTOR];
+
+static uint32_t read32(const uint8_t *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// The free flash starts behind the program and the 4K of its signature, the
+// config filesystem (LittleFS_Program) sits at the end
+static uint32_t staging() {
+  const uint32_t program = (uint32_t)&_flashimagelen + 4096;
+  return (program + FIRMWARE_SECTOR - 1) & ~(FIRMWARE_SECTOR - 1);
+}
+
+uint32_t Firmware::capacity() {
+  const uint32_t end = FIRMWARE_FLASH_SIZE - CONFIG_FS_SIZE;
+  return end > staging() ? end - staging() : 0;
+}
+
+Firmware::ack_t Firmware::receive(const uint8_t *payload, const uint16_t size) {
+  if (size >= 1) {
+    switch (payload[0]) {
+      case BEGIN:
+        return begin(payload, size);
+      case DATA:
+        return data(payload, size);
+      case END:
+        return end(payload, size);
+    }
+  }
+  return {next, ORDER, false};
+}
+
+Firmware::ack_t Firmware::begin(const uint8_t *payload, const uint16_t n) {
+  running = false;
+  if (n != 11) return {0, ORDER, false};
+  size = read32(&payload[1]);
+  crc = read32(&payload[5]);
+  blocks = payload[9] | payload[10] << 8;
+  if (size == 0 || size > capacity() ||
+      blocks != (size + FIRMWARE_BLOCK - 1) / FIRMWARE_BLOCK)
+    return {0, TOO_BIG, false};
+  base = staging();
+  written = 0;
+  fill = 0;
+  next = 0;
+  running = true;
+  LOG(FIRMWARE_RECEIVE, size, blocks);
+  return {0, OK, false};
+}
+
+Firmware::ack_t Firmware::data(const uint8_t *payload, const uint16_t n) {
+  if (!running || n < 8) return {next, ORDER, false};
+  const uint16_t index = payload[1] | payload[2] << 8;
+  // A block again, its ACK got lost
+  if (index < next) return {next, OK, false};
+  if (index > next) return {next, ORDER, false};
+  const uint32_t expected =
+      min((uint32_t)FIRMWARE_BLOCK, size - (uint32_t)index * FIRMWARE_BLOCK);
+  uint8_t *out = &sector[fill];
+  int decoded = -1;
+  if (payload[7] & 1) {
+    if (n - 8u == expected) {
+      memcpy(out, &payload[8], expected);
+      decoded = expected;
+    }
+  } else {
+    decoded = lz4_decode(&payload[8], n - 8, out, FIRMWARE_BLOCK);
+  }
+  if (decoded != (int)expected || crc32(out, expected) != read32(&payload[3]))
+    return {next, CRC, false};
+  fill += expected;
+  next++;
+  if (fill == FIRMWARE_SECTOR || next == blocks) flush();
+  return {next, OK, false};
+}
+
+Firmware::ack_t Firmware::end(const uint8_t *payload, const uint16_t n) {
+  if (!running || n != 2 || next != blocks) return {next, ORDER, false};
+  running = false;
+  const status_t status = verify();
+  if (status == OK)
+    LOG(FIRMWARE_OK);
+  else
+    LOG(FIRMWARE_BAD);
+  return {next, status, status == OK && payload[1]};
+}
+
+// Write the collected blocks to the next sector of the staging area, the
+// rest of a last sector stays erased
+void Firmware::flush() {
+  memset(&sector[fill], 0xFF, FIRMWARE_SECTOR - fill);
+  uint8_t *address = (uint8_t *)(FLASH_BASE + base + written);
+  eepromemu_flash_erase_sector(address);
+  for (uint32_t i = 0; i < FIRMWARE_SECTOR; i += FLASH_PAGE)
+    eepromemu_flash_write(address + i, &sector[i], FLASH_PAGE);
+  written += FIRMWARE_SECTOR;
+  fill = 0;
+}
+
+Firmware::status_t Firmware::verify() {
+  const uint8_t *image = (const uint8_t *)(FLASH_BASE + base);
+  if (crc32(image, size) != crc) return VERIFY;
+  if (size < IVT_OFFSET + 4 || read32(image) != FCFB_TAG ||
+      image[IVT_OFFSET] != IVT_TAG)
+    return IMAGE;
+  return OK;
+}
+
+// From RAM with interrupts off, the flash it runs over is overwritten. The
+// copy goes up from the start, a sector of the image is read before the
+// program reaches it even when the image runs into the staging area.
+FASTRUN void Firmware::apply() {
+  __disable_irq();
+  const uint32_t from = FLASH_BASE + base;
+  for (uint32_t offset = 0; offset < size; offset += FIRMWARE_SECTOR) {
+    const volatile uint8_t *source = (const uint8_t *)(from + offset);
+    for (uint32_t i = 0; i < FIRMWARE_SECTOR; i++) sector[i] = source[i];
+    uint8_t *address = (uint8_t *)(FLASH_BASE + offset);
+    eepromemu_flash_erase_sector(address);
+    for (uint32_t i = 0; i < FIRMWARE_SECTOR; i += FLASH_PAGE)
+      eepromemu_flash_write(address + i, &sector[i], FLASH_PAGE);
+  }
+  SCB_AIRCR = 0x05FA0004;
+  while (true) {
+  }
+}
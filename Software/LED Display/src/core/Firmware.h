@@ -0,0 +1,90 @@
+#ifndef FIRMWARE_H
+#define FIRMWARE_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * FIRMWARE CLASS
+ *------------------------------------------------------------------------------
+ * Receives a new firmware from the ESP8266 in UPDATE frames while the cube
+ * keeps running. The image comes in blocks of FIRMWARE_BLOCK bytes, each LZ4
+ * compressed (or stored when that does not save anything) with the CRC-32 of
+ * the block, see firmware_pack.py. Blocks have to arrive in order, each one
+ * is answered, which is the flow control of the transfer.
+ *
+ * Decoded blocks are collected in a sector in RAM and written to the free
+ * flash between the end of the program and the config filesystem, the way
+ * FlasherX stages an image. Once all blocks are in, the CRC-32 of the staged
+ * image and its boot header are checked, and only then is it copied over the
+ * program by a loop in RAM with interrupts off, which ends with a reset. A
+ * transfer that breaks off leaves the running firmware alone.
+ *
+ * Frames of the ESP8266, uint8 op first:
+ *
+ *   BEGIN  uint32 size, uint32 CRC-32 of the image, uint16 blocks
+ *   DATA   uint16 index, uint32 CRC-32 of the decoded block, uint8 flags
+ *          (1 = stored), the block
+ *   END    uint8 apply
+ *
+ * each answered with ACK, uint16 index of the next block and a status_t.
+ *
+ * const Firmware::ack_t ack = Firmware::receive(payload, size);
+ * if (ack.apply) Firmware::apply();
+ *----------------------------------------------------------------------------*/
+// Decoded size of a block, a flash sector holds 4 of them
+#define FIRMWARE_BLOCK 1024
+#define FIRMWARE_SECTOR 4096
+// Flash for the program, the EEPROM emulation takes the sectors after it
+#if defined(ARDUINO_TEENSY41)
+#define FIRMWARE_FLASH_SIZE 0x7C0000
+#else
+#define FIRMWARE_FLASH_SIZE 0x1F0000
+#endif
+
+class Firmware {
+ public:
+  enum op_t : uint8_t { BEGIN, DATA, END, ACK };
+  enum status_t : uint8_t {
+    OK,
+    // The block is corrupt, send it again
+    CRC,
+    // Not the block expected, or no transfer running
+    ORDER,
+    // The image does not fit the free flash
+    TOO_BIG,
+    // The staged image does not match its CRC-32
+    VERIFY,
+    // The staged image has no boot header of a Teensy 4
+    IMAGE
+  };
+  struct ack_t {
+    uint16_t next;
+    status_t status;
+    // Verified and asked for, call apply() once the ACK is out
+    bool apply;
+  };
+
+  // An UPDATE frame, the ACK to send back
+  static ack_t receive(const uint8_t *payload, const uint16_t size);
+  // Bytes of flash an image can take
+  static uint32_t capacity();
+  // Copy the staged image over the program and reset, does not return
+  static void apply();
+
+ private:
+  static uint32_t size;
+  static uint32_t crc;
+  static uint16_t blocks;
+  static uint16_t next;
+  // Offset of the staging area in flash, bytes of it written
+  static uint32_t base;
+  static uint32_t written;
+  static uint16_t fill;
+  static bool running;
+
+  static ack_t begin(const uint8_t *payload, const uint16_t size);
+  static ack_t data(const uint8_t *payload, const uint16_t size);
+  static ack_t end(const uint8_t *payload, const uint16_t size);
+  static void flush();
+  static status_t verify();
+};
+#endif
@@ -0,0 +1,120 @@
+#include "Footprint.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+
+#include "Arena.h"
+#include "Config.h"
+#include "Display.h"
+#include "ESP8266.h"
+#include "LCD.h"
+#include "space/Animation.h"
+
+// From the linker script: the end of the variables in RAM1, the top of the
+// stack and the end of the RAM2 heap
+extern unsigned long _ebss;
+extern unsigned long _estack;
+extern unsigned long _heap_end;
+extern "C" char *sbrk(int incr);
+#if defined CUBE_PSRAM
+extern unsigned long _extram_start;
+extern unsigned long _extram_end;
+#endif
+
+static const uint32_t PAINT = 0xC5C5C5C5;
+// Left alone above the stack pointer while painting
+static const uint32_t PAINT_MARGIN = 1024;
+
+const Footprint::subsystem_t Footprint::subsystems[] = {
+    {"display", Display::footprint}, {"lcd", LCD::footprint},
+    {"link", ESP8266::footprint},    {"config", Config::footprint},
+    {"arena", Arena::footprint},
+};
+const uint8_t Footprint::SUBSYSTEMS =
+    sizeof(subsystems) / sizeof(subsystems[0]);
+
+static uint32_t *bottom() {
+  return (uint32_t *)(((uintptr_t)&_ebss + 3) & ~(uintptr_t)3);
+}
+
+void Footprint::paint() {
+  char here;
+  uint32_t *end = (uint32_t *)((uintptr_t)(&here - PAINT_MARGIN) & ~3);
+  for (uint32_t *p = bottom(); p < end; p++) *p = PAINT;
+}
+
+uint32_t Footprint::stack_used() {
+  const uint32_t *p = bottom();
+  while (p < (uint32_t *)&_estack && *p == PAINT) p++;
+  return (char *)&_estack - (char *)p;
+}
+
+uint32_t Footprint::stack_size() {
+  return (char *)&_estack - (char *)bottom();
+}
+
+uint32_t Footprint::available(const region_t region) {
+  switch (region) {
+    case RAM1:
+      return stack_size() - stack_used();
+    case RAM2:
+      return (char *)&_heap_end - sbrk(0);
+#if defined CUBE_PSRAM
+    case PSRAM:
+      return external_psram_size * 1024 * 1024 -
+             ((char *)&_extram_end - (char *)&_extram_start);
+#endif
+    default:
+      return 0;
+  }
+}
+
+uint32_t Footprint::animations() {
+  uint32_t bytes = 0;
+  for (uint16_t i = 0;; i++) {
+    const jump_item_t &item = Animation::get_item(i);
+    if (!item.object) break;
+    bool listed = false;
+    for (uint16_t j = 0; j < i; j++)
+      listed |= Animation::get_item(j).object == item.object;
+    if (!listed) bytes += item.size;
+  }
+  return bytes;
+}
+
+int Footprint::report(char *buffer, const size_t size) {
+  int n = snprintf(buffer, size, "%-10s %8s %8s %8s\n", "Memory", "RAM1",
+                   "RAM2", "PSRAM");
+  for (uint8_t i = 0; i < SUBSYSTEMS && n < (int)size; i++) {
+    usage_t usage = {};
+    subsystems[i].footprint(usage);
+    n += snprintf(buffer + n, size - n, "%-10s %8lu %8lu %8lu\n",
+                  subsystems[i].name, usage.bytes[RAM1], usage.bytes[RAM2],
+                  usage.bytes[PSRAM]);
+  }
+  if (n < (int)size)
+    n += snprintf(buffer + n, size - n, "%-10s %8lu\n", "animations",
+                  animations());
+  if (n < (int)size)
+    n += snprintf(buffer + n, size - n, "%-10s %8lu %8lu %8lu\n", "free",
+                  available(RAM1), available(RAM2), available(PSRAM));
+  if (n < (int)size)
+    n += snprintf(buffer + n, size - n, "%-10s %8lu of %lu", "stack",
+                  stack_used(), stack_size());
+  return n;
+}
+
+int Footprint::report_animations(char *buffer, const size_t size) {
+  int n = snprintf(buffer, size, "%-16s %8s", "Animation", "bytes");
+  for (uint16_t i = 0; n < (int)size; i++) {
+    const jump_item_t &item = Animation::get_item(i);
+    if (!item.object) break;
+    bool listed = false;
+    for (uint16_t j = 0; j < i; j++)
+      listed |= Animation::get_item(j).object == item.object;
+    if (!listed)
+      n += snprintf(buffer + n, size - n, "\n%-16s %8lu", item.name,
+                    item.size);
+  }
+  return n;
+}
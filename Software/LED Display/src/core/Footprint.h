@@ -0,0 +1,68 @@
+#ifndef FOOTPRINT_H
+#define FOOTPRINT_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * FOOTPRINT CLASS
+ *------------------------------------------------------------------------------
+ * Where the RAM went, to budget it before the linker or a crash says it is
+ * gone: the static buffers of every subsystem by region (RAM1, RAM2 and the
+ * PSRAM of the Teensy 4.1), the size of every animation object, what is left
+ * of each region and the deepest the stack went.
+ *
+ * A subsystem lists its buffers in footprint(), usage_t tells the region by
+ * their address. The stack is measured by painting: paint(), first thing in
+ * setup(), fills the free RAM1 below the stack with a pattern, and the
+ * pattern still untouched is what the stack never reached. The report goes
+ * to the USB console once the boot is done and to the ESP8266 on
+ * {"event":"memory"}.
+ *
+ * Footprint::paint();
+ * ...
+ * Footprint::report(buffer, sizeof(buffer));
+ *----------------------------------------------------------------------------*/
+class Footprint {
+ public:
+  enum region_t : uint8_t { RAM1, RAM2, PSRAM, REGIONS };
+
+  // The region of an address, RAM1 for anything else
+  static region_t region(const void *data) {
+    const uintptr_t address = (uintptr_t)data;
+    if (address >= 0x20200000 && address < 0x20280000) return RAM2;
+    if (address >= 0x70000000 && address < 0x71000000) return PSRAM;
+    return RAM1;
+  }
+
+  // Bytes of static buffers per region
+  struct usage_t {
+    uint32_t bytes[REGIONS];
+
+    void add(const void *data, const size_t size) {
+      bytes[region(data)] += size;
+    }
+  };
+
+  struct subsystem_t {
+    const char *name;
+    void (*footprint)(usage_t &usage);
+  };
+  static const subsystem_t subsystems[];
+  static const uint8_t SUBSYSTEMS;
+
+  // Fill the free stack with the pattern, before anything ran deep
+  static void paint();
+  // Deepest the stack went since paint(), and the room it has
+  static uint32_t stack_used();
+  static uint32_t stack_size();
+  // Bytes of a region nothing took yet, RAM1 between the variables and the
+  // stack
+  static uint32_t available(const region_t region);
+  // Bytes of the animation objects, every object once
+  static uint32_t animations();
+
+  // Print the subsystems, regions and stack, returns the amount printed
+  static int report(char *buffer, const size_t size);
+  // Print the size of every animation object
+  static int report_animations(char *buffer, const size_t size);
+};
+#endif
@@ -0,0 +1,100 @@
+#include "Frame.h"
+
+#include <string.h>
+
+#include "power/Crc.h"
+/*------------------------------------------------------------------------------
+ * FRAME CLASS
+ *----------------------------------------------------------------------------*/
+Frame::result_t Frame::drop() {
+  dropped++;
+  state = state_t::IDLE;
+  return NONE;
+}
+
+Frame::result_t Frame::feed(const uint8_t c) {
+  switch (state) {
+    case state_t::IDLE:
+      if (c == FRAME_START) {
+        crc = 0xFFFF;
+        state = state_t::TYPE;
+      } else if (c == TEXT_START) {
+        received = 0;
+        state = state_t::TEXT;
+      } else if (c != TEXT_STOP) {
+        return CONSOLE;
+      }
+      return NONE;
+
+    case state_t::TEXT:
+      if (c == TEXT_STOP) {
+        state = state_t::IDLE;
+        buffer[received] = 0;
+        frame_type = frame_t::JSON;
+        length = received;
+        return FRAME;
+      }
+      // A new start before the stop discards the unfinished text
+      if (c == TEXT_START) {
+        received = 0;
+        return NONE;
+      }
+      if (received == FRAME_MAX) return drop();
+      buffer[received++] = c;
+      return NONE;
+
+    case state_t::TYPE:
+      frame_type = (frame_t)c;
+      crc = crc16_update(crc, c);
+      state = state_t::LENGTH_LO;
+      return NONE;
+
+    case state_t::LENGTH_LO:
+      length = c;
+      crc = crc16_update(crc, c);
+      state = state_t::LENGTH_HI;
+      return NONE;
+
+    case state_t::LENGTH_HI:
+      length |= c << 8;
+      crc = crc16_update(crc, c);
+      if (length > FRAME_MAX) return drop();
+      received = 0;
+      state = length ? state_t::PAYLOAD : state_t::CRC_LO;
+      return NONE;
+
+    case state_t::PAYLOAD:
+      buffer[received++] = c;
+      crc = crc16_update(crc, c);
+      if (received == length) state = state_t::CRC_LO;
+      return NONE;
+
+    case state_t::CRC_LO:
+      crc_in = c;
+      state = state_t::CRC_HI;
+      return NONE;
+
+    case state_t::CRC_HI:
+      crc_in |= c << 8;
+      if (crc_in != crc) return drop();
+      state = state_t::IDLE;
+      buffer[length] = 0;
+      return FRAME;
+  }
+  return NONE;
+}
+
+size_t Frame::encode(uint8_t *out, const size_t capacity, const frame_t type,
+                     const void *payload, const uint16_t size) {
+  const size_t total = size + 6;
+  if (size > FRAME_MAX || total > capacity) return 0;
+  out[0] = FRAME_START;
+  out[1] = (uint8_t)type;
+  out[2] = size & 0xFF;
+  out[3] = size >> 8;
+  memcpy(&out[4], payload, size);
+  const uint16_t crc = crc16(&out[1], size + 3);
+  out[size + 4] = crc & 0xFF;
+  out[size + 5] = crc >> 8;
+  return total;
+}
@@ -0,0 +1,118 @@
+#ifndef FRAME_H
+#define FRAME_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * FRAME CLASS
+ *------------------------------------------------------------------------------
+ * Binary frames on the UART link to the ESP8266:
+ *
+ *   FRAME_START, type, length (2 bytes LE), payload, CRC-16 (2 bytes LE)
+ *
+ * The CRC-16 (CCITT-FALSE) covers type, length and payload. Frames can carry
+ * any byte, the sync byte only counts between frames. The older text framing
+ * (TEENSY_START, JSON text, TEENSY_STOP) is still accepted and delivered as a
+ * JSON frame, bytes outside of both are console output.
+ *
+ * The parser is a state machine fed one byte at a time. It never allocates,
+ * the payload is collected in a fixed buffer and handed out until the next
+ * byte is fed, always followed by a terminator. Oversized and corrupt frames
+ * are dropped and counted.
+ *
+ * if (parser.feed(c) == Frame::FRAME) handle(parser.type(), parser.payload());
+ *----------------------------------------------------------------------------*/
+// Largest payload, enough for the JSON commands and a firmware block with
+// its header
+#define FRAME_MAX 1088
+
+// Frame types, JSON is the fallback for human facing commands
+enum class frame_t : uint8_t {
+  JSON = 0,
+  // 64 levels of 0-15, one per byte
+  FFT = 1,
+  // int8 x, int8 y, uint8 bits of z, a, b and c, optionally the uint16 ms of
+  // the change on the clock of the sender
+  BUTTON = 2,
+  // float x, y, z
+  ACCELEROMETER = 3,
+  // One audio window of the WIO Terminal: sequence, flags (1 = delta, 2 =
+  // timed, 4 = onset), buttons (press, a, b, c, left, right, up, down),
+  // int16 milli g x, y, z, a timed window the uint16 ms of its last sample,
+  // then 64 bands of 4 bits packed low nibble first. A delta first has a 64
+  // bit mask of the bands that changed and then only those.
+  WINDOW = 4,
+  // A chunk of a live voxel frame, see core/Voxels.h
+  VOXELS = 5,
+  // Shared clock of the cubes side by side, see core/Sync.h
+  CLOCK = 6,
+  // A config field by its id in the schema: uint8 op (0 get, 1 set), uint16
+  // id, a set the float value. Answered with op 2, id, float value, min and
+  // max, or op 3 and the id when it is unknown or a string.
+  FIELD = 7,
+  // Top view of the cube for a remote preview, the brightest voxel of every
+  // column: uint8 sequence, flags (1 = delta), then 16 x 16 RGB565 LE cells
+  // from the back row (y 15) to the front. A delta is (skip, literals) pairs
+  // of cells XOR the frame before, like the VOXELS deltas.
+  PREVIEW = 8,
+  // A slice of config.json text: uint8 flags (1 = first, 2 = last), then the
+  // text. The export event is answered with the slices of the config, the
+  // slices sent to the Teensy are imported once the last one is in.
+  CONFIG = 9,
+  // A firmware update, blocks of the image from the ESP8266 and the ACK of
+  // every one, see core/Firmware.h
+  UPDATE = 10,
+  // A latency probe behind an input of the WIO Terminal, stamped on its way,
+  // see core/Latency.h
+  PROBE = 11,
+  // A load test of the link: uint32 sequence, then (sequence + index) & 0xFF
+  // up to the size of the test, see core/Soak.h
+  SOAK = 12,
+  // Console messages as ids and raw arguments, formatted by log_convert.py,
+  // see core/Log.h
+  LOG = 13,
+};
+
+class Frame {
+ public:
+  static const uint8_t FRAME_START = 0xf3;
+  static const uint8_t TEXT_START = 0xf1;
+  static const uint8_t TEXT_STOP = 0xf9;
+  // What feed() made of a byte
+  enum result_t : uint8_t { NONE, CONSOLE, FRAME };
+
+  result_t feed(const uint8_t c);
+  frame_t type() const { return frame_type; }
+  // Writable until the next feed(), so JSON can be parsed in place
+  uint8_t *payload() { return buffer; }
+  uint16_t size() const { return length; }
+  uint32_t errors() const { return dropped; }
+
+  // Write the header and CRC around a payload, returns the frame size or 0
+  // when the frame does not fit out
+  static size_t encode(uint8_t *out, const size_t capacity, const frame_t type,
+                       const void *payload, const uint16_t size);
+
+ private:
+  enum class state_t : uint8_t {
+    IDLE,
+    TEXT,
+    TYPE,
+    LENGTH_LO,
+    LENGTH_HI,
+    PAYLOAD,
+    CRC_LO,
+    CRC_HI
+  };
+  state_t state = state_t::IDLE;
+  frame_t frame_type = frame_t::JSON;
+  uint16_t length = 0;
+  uint16_t received = 0;
+  uint16_t crc = 0;
+  uint16_t crc_in = 0;
+  uint32_t dropped = 0;
+  // Room for a terminator, so JSON payloads are C strings
+  uint8_t buffer[FRAME_MAX + 1];
+
+  result_t drop();
+};
+#endif
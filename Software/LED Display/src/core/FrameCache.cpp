@@ -0,0 +1,156 @@
+#include "FrameCache.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "Config.h"
+#include "Governor.h"
+#include "Graphics.h"
+#include "Sync.h"
+#include "power/Memory.h"
+#include "power/VoxelCodec.h"
+/*------------------------------------------------------------------------------
+ * FRAMECACHE CLASS
+ *----------------------------------------------------------------------------*/
+#if defined CUBE_PSRAM
+static const uint32_t CAPACITY = 4194304;
+#else
+static const uint32_t CAPACITY = 16384;
+#endif
+
+// The stored slots and the slot decoded last in [x][y][z] order
+BULKMEM static uint8_t slot_bytes[CAPACITY];
+BULKMEM static Color frame[VOXELS_COUNT];
+
+uint32_t FrameCache::hits = 0;
+uint32_t FrameCache::misses = 0;
+const void *FrameCache::owner = nullptr;
+uint32_t FrameCache::key = 0;
+uint16_t FrameCache::slots = 0;
+uint32_t FrameCache::offset[SLOTS];
+uint16_t FrameCache::size[SLOTS];
+bool FrameCache::keyed[SLOTS];
+uint32_t FrameCache::bytes = 0;
+bool FrameCache::full = false;
+uint16_t FrameCache::decoded = NONE;
+uint16_t FrameCache::pending = NONE;
+
+// FNV-1a
+uint32_t FrameCache::hash(const void *data, const size_t length) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < length; i++) h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+void FrameCache::restart(const void *animation, const uint32_t settings,
+                         const uint16_t count) {
+  owner = animation;
+  key = settings;
+  slots = count;
+  memset(size, 0, sizeof(size));
+  bytes = 0;
+  full = false;
+  decoded = NONE;
+}
+
+bool FrameCache::replay(const void *animation, uint32_t settings, float &cycle,
+                        uint16_t count) {
+  pending = NONE;
+  if (!config.animation.cache) return false;
+  if (count > SLOTS) count = SLOTS;
+  // The frames also depend on the detail drawn and the part of a shared
+  // volume this cube shows
+  settings ^= Governor::level * 0x9E3779B1u ^ (uint32_t)Sync::shift << 24;
+  if (animation != owner || settings != key || count != slots)
+    restart(animation, settings, count);
+  const float whole = floorf(cycle);
+  uint16_t slot = (cycle - whole) * count;
+  if (slot >= count) slot = count - 1;
+  cycle = whole + (float)slot / count;
+  if (!size[slot]) {
+    misses++;
+    pending = slot;
+    return false;
+  }
+  hits++;
+  decode(slot);
+  for (uint8_t x = 0; x < 16; x++)
+    for (uint8_t y = 0; y < 16; y++)
+      for (uint8_t z = 0; z < 16; z++) {
+        const Color &c = frame[x << 8 | y << 4 | z];
+        if (!c.isBlack()) cell(x, y, z) = c;
+      }
+  return true;
+}
+
+// Decode forward from the slot before that is against black or in the frame
+void FrameCache::decode(const uint16_t slot) {
+  if (slot == decoded) return;
+  uint16_t from = slot;
+  while (!keyed[from] && from - 1 != decoded) from--;
+  for (uint16_t s = from; s <= slot; s++) {
+    if (keyed[s]) std::fill(frame, frame + VOXELS_COUNT, Color::BLACK);
+    VoxelCodec::decode_delta(frame, frame, &slot_bytes[offset[s]], size[s],
+                             VOXELS_COUNT);
+  }
+  decoded = slot;
+}
+
+void FrameCache::store() {
+  if (pending == NONE || full) return;
+  const uint16_t slot = pending;
+  pending = NONE;
+  Display::resolve();
+  const bool black = slot % KEY == 0 || decoded != slot - 1;
+  if (black) std::fill(frame, frame + VOXELS_COUNT, Color::BLACK);
+  // A DELTA as VoxelCodec::encode_delta() writes it, straight from the
+  // drawing buffer, the frame becomes this slot on the way
+  uint8_t *out = &slot_bytes[bytes];
+  const uint32_t capacity = CAPACITY - bytes;
+  uint32_t n = 0;
+  uint16_t i = 0;
+  auto same = [](const uint16_t i) {
+    return Display::at(Display::cubeBuffer, i >> 8, i >> 4 & 15, i & 15) ==
+           frame[i];
+  };
+  decoded = NONE;
+  while (true) {
+    uint16_t skip = 0;
+    while (i + skip < VOXELS_COUNT && same(i + skip)) skip++;
+    if (i + skip == VOXELS_COUNT) break;
+    i += skip;
+    for (; skip > 255; skip -= 255) {
+      if (n + 2 > capacity) return (void)(full = true);
+      out[n++] = 255;
+      out[n++] = 0;
+    }
+    uint16_t literals = 0;
+    while (i + literals < VOXELS_COUNT && literals < 255 && !same(i + literals))
+      literals++;
+    if (n + 2 + literals * 3 > capacity) return (void)(full = true);
+    out[n++] = skip;
+    out[n++] = literals;
+    for (uint16_t k = 0; k < literals; k++, i++) {
+      const Color &c = Display::at(Display::cubeBuffer, i >> 8, i >> 4 & 15,
+                                   i & 15);
+      out[n++] = c.r ^ frame[i].r;
+      out[n++] = c.g ^ frame[i].g;
+      out[n++] = c.b ^ frame[i].b;
+      frame[i] = c;
+    }
+  }
+  // Without changes a single empty pair, a stored slot is never empty
+  if (n == 0) {
+    if (capacity < 2) return (void)(full = true);
+    out[n++] = 0;
+    out[n++] = 0;
+  }
+  offset[slot] = bytes;
+  size[slot] = n;
+  keyed[slot] = black;
+  bytes += n;
+  decoded = slot;
+}
@@ -0,0 +1,69 @@
+#ifndef FRAMECACHE_H
+#define FRAMECACHE_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * FRAMECACHE CLASS
+ *------------------------------------------------------------------------------
+ * Frames of a strictly periodic animation, drawn once and replayed in the
+ * cycles after, while config.animation.cache is on. A cycle is split into
+ * slots, the animation draws at the start of the slot it is in, so every
+ * cycle shows the same frames. A slot is stored as a DELTA against the slot
+ * before it (power/VoxelCodec.h), or against black every KEY slots and when
+ * the slot before was not drawn, replaying decodes from there.
+ *
+ * The cache belongs to one animation and its settings, another animation,
+ * changed settings or a quality level of the governor start it over. The
+ * slots are kept in BULKMEM, 4 MB with PSRAM, once it is full the slots
+ * that did not fit are drawn every time. Only the RUNNING state may be
+ * cached, the envelope of starting and ending changes the frames.
+ *
+ * float cycle = phase / PERIOD;
+ * if (FrameCache::replay(this, settings, cycle, 600)) return;
+ * ... draw at cycle * PERIOD
+ * FrameCache::store();
+ *----------------------------------------------------------------------------*/
+class FrameCache {
+ public:
+  static const uint16_t SLOTS = 1024;
+  static const uint8_t KEY = 16;
+  // Frames replayed and drawn while caching, since starting
+  static uint32_t hits;
+  static uint32_t misses;
+
+  // Snap cycle (its fraction is the position in the cycle) to the start of
+  // its slot of slots per cycle. True when the frame was drawn from the
+  // cache, otherwise draw it at the snapped cycle and store() it.
+  template <typename S>
+  static bool replay(const void *owner, const S &settings, float &cycle,
+                     const uint16_t slots) {
+    return replay(owner, hash(&settings, sizeof(S)), cycle, slots);
+  }
+  static bool replay(const void *owner, const uint32_t key, float &cycle,
+                     const uint16_t slots);
+  // Keep the frame just drawn for the slot replay() missed
+  static void store();
+  // Bytes of the stored slots
+  static uint32_t used() { return bytes; }
+
+ private:
+  static const uint16_t NONE = 0xFFFF;
+  static const void *owner;
+  static uint32_t key;
+  static uint16_t slots;
+  // Stored slots, 0 bytes when missing, and whether against black
+  static uint32_t offset[SLOTS];
+  static uint16_t size[SLOTS];
+  static bool keyed[SLOTS];
+  static uint32_t bytes;
+  static bool full;
+  // Slot in the frame buffer and the one to store
+  static uint16_t decoded;
+  static uint16_t pending;
+
+  static uint32_t hash(const void *data, const size_t length);
+  static void restart(const void *owner, const uint32_t key,
+                      const uint16_t slots);
+  static void decode(const uint16_t slot);
+};
+#endif
@@ -0,0 +1,58 @@
+#include "Governor.h"
+
+#include <Arduino.h>
+
+#include "Config.h"
+#include "Log.h"
+/*------------------------------------------------------------------------------
+ * GOVERNOR CLASS
+ *----------------------------------------------------------------------------*/
+uint8_t Governor::level = Governor::FULL;
+uint32_t Governor::changes = 0;
+// Up to 32ms with a resolution of 500us
+Histogram Governor::window = Histogram(500);
+uint8_t Governor::over = 0;
+uint8_t Governor::under = 0;
+
+void Governor::add(const uint32_t time) {
+  const auto &quality = config.display.quality;
+  const uint8_t max = quality.max < FULL ? quality.max : FULL;
+  const uint8_t min = quality.min < max ? quality.min : max;
+  const uint16_t fps = config.display.fps;
+  if (!quality.enabled || !fps) {
+    window.reset();
+    over = under = 0;
+    set(max);
+    return;
+  }
+  window.add(time);
+  if (window.count() < WINDOW) return;
+  const uint32_t period = 1000000 / fps;
+  const uint32_t p90 = window.percentile(90);
+  window.reset();
+  uint8_t next = level;
+  if (p90 > period * quality.high / 100) {
+    under = 0;
+    if (++over == DROP) {
+      over = 0;
+      if (next) next--;
+    }
+  } else if (p90 < period * quality.low / 100) {
+    over = 0;
+    if (++under == RISE) {
+      under = 0;
+      next++;
+    }
+  } else {
+    over = under = 0;
+  }
+  // Also when the bounds of the config changed
+  set(next < min ? min : next > max ? max : next);
+}
+
+void Governor::set(const uint8_t level) {
+  if (level == Governor::level) return;
+  LOG(QUALITY, Governor::level, level);
+  Governor::level = level;
+  changes++;
+}
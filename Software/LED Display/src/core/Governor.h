@@ -0,0 +1,50 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+#include <stdint.h>
+
+#include "power/Histogram.h"
+/*------------------------------------------------------------------------------
+ * GOVERNOR CLASS
+ *------------------------------------------------------------------------------
+ * Holds the frame rate of config.display.fps by trading quality for draw
+ * time. Every WINDOW frames the 90th percentile of the draw time is compared
+ * to the frame period: above config.display.quality.high percent of it the
+ * window is over budget, below low percent it is under budget. The level
+ * drops one step after DROP windows over budget in a row and rises one step
+ * after RISE windows under it, so a single slow frame or a short burst does
+ * not make the quality flicker. It stays within the min and max of the
+ * config, without a target frame rate or when disabled it is max.
+ *
+ * The animations read their level in draw() (see Animation::quality) and
+ * pick a cheaper way to draw at the lower ones: fewer particles, a noise
+ * volume sampled over more frames, smaller radiate radii, fewer substeps.
+ * FULL is the quality they are designed for.
+ *
+ * Every change is printed and counted, telemetry reports the level and the
+ * changes.
+ *----------------------------------------------------------------------------*/
+class Governor {
+ public:
+  static const uint8_t FULL = 3;
+
+  // Current quality level, 0 (cheapest) to FULL
+  static uint8_t level;
+  // Level changes since starting
+  static uint32_t changes;
+
+  // Draw time of a frame in microseconds
+  static void add(const uint32_t time);
+
+ private:
+  static const uint8_t WINDOW = 30;
+  static const uint8_t DROP = 2;
+  static const uint8_t RISE = 4;
+  // Draw times of the current window
+  static Histogram window;
+  // Windows over and under budget in a row
+  static uint8_t over;
+  static uint8_t under;
+
+  static void set(const uint8_t level);
+};
+#endif
@@ -5,8 +5,15 @@
 #include <stdint.h>
 
 #include "core/Display.h"
+#include "core/Kernel.h"
+#include "core/Sync.h"
 #include "power/Color.h"
+#include "power/Cost.h"
+#include "power/FastTrig.h"
 #include "power/Math3D.h"
+#include "power/Model.h"
+#include "power/Particle.h"
+#include "power/ParticlePool.h"
 /*------------------------------------------------------------------------------
  * Grapics is used to draw voxels on the screen in a safe way
  *------------------------------------------------------------------------------
@@ -30,16 +37,39 @@
  *   #define FASTFLOOR(x) (((int)(x) < (x)) ? ((int)x) : ((int)x - 1))
  *----------------------------------------------------------------------------*/
 
-// Define the center of the physical cube coordinates
-#define CX 7.5f
+// Define the center of the physical cube coordinates, along x the center of
+// the volume shared with the cubes beside it
+#define CX (7.5f + Sync::shift)
 #define CY 7.5f
 #define CZ 7.5f
 
+// Voxel in the drawing buffer, marks its column as occupied (no bound checks)
+inline Color &cell(const uint8_t x, const uint8_t y, const uint8_t z) {
+  COST(VOXEL, 1);
+#if defined OCCUPANCY
+  Display::occupancy[Display::cubeBuffer][x][y] |= 1 << z;
+#endif
+  return Display::at(Display::cubeBuffer, x, y, z);
+}
+
 // Set voxel using physical cube coordinates
 inline void voxel(const uint8_t x, const uint8_t y, const uint8_t z,
                   const Color &c) {
   if (((x | y | z) & 0xF0) == 0) {
-    Display::cube[Display::cubeBuffer][x][y][z] = c;
+    cell(x, y, z) = c;
+  }
+}
+
+// Set voxel to a palette index using physical cube coordinates, index 0 is not
+// drawn (see Display::setPalette())
+inline void voxel_index(const uint8_t x, const uint8_t y, const uint8_t z,
+                        const uint8_t index) {
+  if (((x | y | z) & 0xF0) == 0) {
+    COST(VOXEL, 1);
+#if defined OCCUPANCY
+    Display::occupancy[Display::cubeBuffer][x][y] |= 1 << z;
+#endif
+    Display::indexAt(Display::cubeBuffer, x, y, z) = index;
   }
 }
 
@@ -50,7 +80,23 @@ inline void voxel(const Vector3 &v, const Color &c) {
   int16_t y = (int16_t)(v.y + 32768.5f + CY) - 32768;
   int16_t z = (int16_t)(v.z + 32768.5f + CZ) - 32768;
   if (((x | y | z) & 0xFFF0) == 0) {
-    Display::cube[Display::cubeBuffer][x][y][z] = c;
+    cell(x, y, z) = c;
+  }
+}
+
+// Center of the cube plus rounding to nearest in Q8.8
+#define CXQ \
+  ((int16_t)((7.5f + 0.5f) * Vector3q::ONE) + Sync::shift * Vector3q::ONE)
+#define CYQ ((int16_t)((CY + 0.5f) * Vector3q::ONE))
+#define CZQ ((int16_t)((CZ + 0.5f) * Vector3q::ONE))
+
+// Set voxel using fixed point system coordinates
+inline void voxel(const Vector3q &v, const Color &c) {
+  int16_t x = (v.x + CXQ) >> 8;
+  int16_t y = (v.y + CYQ) >> 8;
+  int16_t z = (v.z + CZQ) >> 8;
+  if (((x | y | z) & 0xFFF0) == 0) {
+    cell(x, y, z) = c;
   }
 }
 
@@ -61,7 +107,76 @@ inline void voxel_add(const Vector3 &v, const Color &c) {
   int16_t y = (int16_t)(v.y + 32768.5f + CY) - 32768;
   int16_t z = (int16_t)(v.z + 32768.5f + CZ) - 32768;
   if (((x | y | z) & 0xFFF0) == 0) {
-    Display::cube[Display::cubeBuffer][x][y][z] += c;
+    cell(x, y, z) += c;
+  }
+}
+
+// Add to voxel using fixed point system coordinates
+inline void voxel_add(const Vector3q &v, const Color &c) {
+  int16_t x = (v.x + CXQ) >> 8;
+  int16_t y = (v.y + CYQ) >> 8;
+  int16_t z = (v.z + CZQ) >> 8;
+  if (((x | y | z) & 0xFFF0) == 0) {
+    cell(x, y, z) += c;
+  }
+}
+
+// Add a point using system coordinates, spread over the 8 voxels around it
+// with trilinear weights in Q8. It moves smoothly between voxels for 8 writes,
+// where voxel() jumps a voxel at a time and radiate() loops over a radius.
+inline void splat_aa(const Vector3 &v, const Color &c) {
+  // Offset to keep the position positive while truncating
+  const int32_t qx = (int32_t)((v.x + CX) * 256 + 8388608.0f) - 8388608;
+  const int32_t qy = (int32_t)((v.y + CY) * 256 + 8388608.0f) - 8388608;
+  const int32_t qz = (int32_t)((v.z + CZ) * 256 + 8388608.0f) - 8388608;
+  const int16_t x0 = qx >> 8, y0 = qy >> 8, z0 = qz >> 8;
+  const uint16_t wx[2] = {(uint16_t)(256 - (qx & 255)), (uint16_t)(qx & 255)};
+  const uint16_t wy[2] = {(uint16_t)(256 - (qy & 255)), (uint16_t)(qy & 255)};
+  const uint16_t wz[2] = {(uint16_t)(256 - (qz & 255)), (uint16_t)(qz & 255)};
+  for (uint8_t i = 0; i < 8; i++) {
+    const int16_t x = x0 + (i >> 2), y = y0 + (i >> 1 & 1), z = z0 + (i & 1);
+    if (((x | y | z) & 0xFFF0) != 0) continue;
+    const uint32_t w =
+        ((uint32_t)wx[i >> 2] * wy[i >> 1 & 1] >> 8) * wz[i & 1] >> 8;
+    if (w) cell(x, y, z) += c.scaled(w > 255 ? 255 : w);
+  }
+}
+
+// Light of a voxel in the drawing buffer, marks its column as occupied (no
+// bound checks)
+inline uint16_t *light_cell(const uint8_t x, const uint8_t y, const uint8_t z) {
+  COST(VOXEL, 1);
+#if defined OCCUPANCY
+  Display::occupancy[Display::cubeBuffer][x][y] |= 1 << z;
+#endif
+  Display::lighted = true;
+  return Display::light[x][y][z];
+}
+
+// Add light to a voxel using system coordinates. Unlike voxel_add() nothing
+// saturates, overlapping light adds up and is tone mapped once on submit.
+inline void voxel_light(const Vector3 &v, const Color &c) {
+  int16_t x = (int16_t)(v.x + 32768.5f + CX) - 32768;
+  int16_t y = (int16_t)(v.y + 32768.5f + CY) - 32768;
+  int16_t z = (int16_t)(v.z + 32768.5f + CZ) - 32768;
+  if (((x | y | z) & 0xFFF0) == 0) {
+    uint16_t *l = light_cell(x, y, z);
+    l[0] += c.r;
+    l[1] += c.g;
+    l[2] += c.b;
+  }
+}
+
+// Add light to a voxel using fixed point system coordinates
+inline void voxel_light(const Vector3q &v, const Color &c) {
+  int16_t x = (v.x + CXQ) >> 8;
+  int16_t y = (v.y + CYQ) >> 8;
+  int16_t z = (v.z + CZQ) >> 8;
+  if (((x | y | z) & 0xFFF0) == 0) {
+    uint16_t *l = light_cell(x, y, z);
+    l[0] += c.r;
+    l[1] += c.g;
+    l[2] += c.b;
   }
 }
 
@@ -81,8 +196,7 @@ inline void radiate(const Vector3 &v0, const Color &c, const float r) {
         if (((x | y | z) & 0xFFF0) == 0) {
           float radius = (Vector3(x, y, z) - v).magnitude();
           if (radius < r) {
-            Display::cube[Display::cubeBuffer][x][y][z].maximize(
-                c.scaled(255 * (1 - (radius / r))));
+            cell(x, y, z).maximize(c.scaled(255 * (1 - (radius / r))));
           }
         }
       }
@@ -104,7 +218,7 @@ inline void radiate4(const Vector3 &v0, const Color &c, const float r) {
         if (((x | y | z) & 0xFFF0) == 0) {
           float radius = (Vector3(x, y, z) - v).magnitude();
           if (radius < r) {
-            Display::cube[Display::cubeBuffer][x][y][z].maximize(
+            cell(x, y, z).maximize(
                 c.scaled(255 / (1 + (radius * radius * radius * radius))));
           }
         }
@@ -127,48 +241,617 @@ inline void radiate5(const Vector3 &v0, const Color &c, const float r) {
         if (((x | y | z) & 0xFFF0) == 0) {
           float radius = (Vector3(x, y, z) - v).magnitude();
           if (radius < r) {
-            Display::cube[Display::cubeBuffer][x][y][z].maximize(c.scaled(
+            cell(x, y, z).maximize(c.scaled(
                 255 / (1 + (radius * radius * radius * radius * radius))));
           }
         }
       }
 }
 
+// Set voxel using system coordinates with a cached falloff kernel. The
+// position is quantized to a quarter voxel and the radius to 1/8 voxel, radii
+// above Kernel::RADIUS use the exact functions.
+inline void radiate(const Vector3 &v0, const Color &c, const float r,
+                    const falloff_t falloff) {
+  if (r > Kernel::RADIUS) {
+    if (falloff == falloff_t::LINEAR) radiate(v0, c, r);
+    if (falloff == falloff_t::QUARTIC) radiate4(v0, c, r);
+    if (falloff == falloff_t::QUINTIC) radiate5(v0, c, r);
+    return;
+  }
+  // Quarter voxel position, offset to keep it positive while truncating
+  int32_t qx = (int32_t)((v0.x + CX) * Kernel::STEPS + 131072.5f) - 131072;
+  int32_t qy = (int32_t)((v0.y + CY) * Kernel::STEPS + 131072.5f) - 131072;
+  int32_t qz = (int32_t)((v0.z + CZ) * Kernel::STEPS + 131072.5f) - 131072;
+  const uint8_t ox = qx & (Kernel::STEPS - 1);
+  const uint8_t oy = qy & (Kernel::STEPS - 1);
+  const uint8_t oz = qz & (Kernel::STEPS - 1);
+  const kernel_t &k = Kernel::get(falloff, r, ox, oy, oz);
+  const int16_t x1 = (qx - ox) / Kernel::STEPS + k.lo[0];
+  const int16_t y1 = (qy - oy) / Kernel::STEPS + k.lo[1];
+  const int16_t z1 = (qz - oz) / Kernel::STEPS + k.lo[2];
+  const uint8_t *w = k.weights;
+  for (int16_t x = x1; x < x1 + k.n[0]; x++)
+    for (int16_t y = y1; y < y1 + k.n[1]; y++)
+      for (int16_t z = z1; z < z1 + k.n[2]; z++, w++) {
+        if (*w && ((x | y | z) & 0xFFF0) == 0) {
+          cell(x, y, z).maximize(c.scaled(*w));
+        }
+      }
+}
+
+// How splat() combines a particle with the voxel already drawn, also used to
+// composite layers (see Layer.h)
+enum class blend_t : uint8_t { SET = 0, ADD = 1, MAX = 2, MULTIPLY = 3 };
+
+// Draw a batch of particles as voxels using system coordinates scaled by
+// radius. The color is taken from the palette by hue and scaled by brightness
+// times scale. Particles without brightness or outside the cube are skipped.
+inline void splat(const Particle *p, const size_t n, const uint8_t *palette,
+                  const uint8_t scale, const blend_t mode,
+                  const float radius = 1.0f) {
+  // Translation and the offset to keep positions positive when truncating
+  const float ox = CX + 32768.5f;
+  const float oy = CY + 32768.5f;
+  const float oz = CZ + 32768.5f;
+  for (size_t i = 0; i < n; i++) {
+    const Particle &q = p[i];
+    if (q.brightness <= 0) continue;
+    const uint16_t x = (int32_t)(q.position.x * radius + ox) - 32768;
+    const uint16_t y = (int32_t)(q.position.y * radius + oy) - 32768;
+    const uint16_t z = (int32_t)(q.position.z * radius + oz) - 32768;
+    if ((x | y | z) & 0xFFF0) continue;
+    const Color c = Color(q.hue, palette).scale(q.brightness * scale);
+    Color &v = cell(x, y, z);
+    switch (mode) {
+      case blend_t::SET:
+        v = c;
+        break;
+      case blend_t::ADD:
+        v += c;
+        break;
+      case blend_t::MAX:
+        v.maximize(c);
+        break;
+      case blend_t::MULTIPLY:
+        v.multiply(c);
+        break;
+    }
+  }
+}
+
+// Same for a particle pool, life is used as brightness
+inline void splat(const ParticlePool &p, const uint8_t *palette,
+                  const uint8_t scale, const blend_t mode,
+                  const float radius = 1.0f) {
+  const float ox = CX + 32768.5f;
+  const float oy = CY + 32768.5f;
+  const float oz = CZ + 32768.5f;
+  for (uint16_t i = 0; i < p.count(); i++) {
+    if (p.life[i] <= 0) continue;
+    const uint16_t x = (int32_t)(p.x[i] * radius + ox) - 32768;
+    const uint16_t y = (int32_t)(p.y[i] * radius + oy) - 32768;
+    const uint16_t z = (int32_t)(p.z[i] * radius + oz) - 32768;
+    if ((x | y | z) & 0xFFF0) continue;
+    const Color c = Color(p.hue[i], palette).scale(p.life[i] * scale);
+    Color &v = cell(x, y, z);
+    switch (mode) {
+      case blend_t::SET:
+        v = c;
+        break;
+      case blend_t::ADD:
+        v += c;
+        break;
+      case blend_t::MAX:
+        v.maximize(c);
+        break;
+      case blend_t::MULTIPLY:
+        v.multiply(c);
+        break;
+    }
+  }
+}
+
+// Same as light, the particles add up without saturating (see voxel_light()).
+// Particles with their bit set in skip are left out.
+inline void splat_light(const ParticlePool &p, const uint8_t *palette,
+                        const uint8_t scale, const float radius = 1.0f,
+                        const uint32_t *skip = nullptr) {
+  const float ox = CX + 32768.5f;
+  const float oy = CY + 32768.5f;
+  const float oz = CZ + 32768.5f;
+  for (uint16_t i = 0; i < p.count(); i++) {
+    if (p.life[i] <= 0) continue;
+    if (skip && skip[i >> 5] & 1u << (i & 31)) continue;
+    const uint16_t x = (int32_t)(p.x[i] * radius + ox) - 32768;
+    const uint16_t y = (int32_t)(p.y[i] * radius + oy) - 32768;
+    const uint16_t z = (int32_t)(p.z[i] * radius + oz) - 32768;
+    if ((x | y | z) & 0xFFF0) continue;
+    const Color c = Color(p.hue[i], palette).scale(p.life[i] * scale);
+    uint16_t *l = light_cell(x, y, z);
+    l[0] += c.r;
+    l[1] += c.g;
+    l[2] += c.b;
+  }
+}
+
+// Fill a box of voxels using physical cube coordinates, clipped to the cube
+// once. The runs go along z, a run marks its column occupied with one word
+// and is sequential in memory without WIREORDER or MORTON. color(x, y, z) gives the
+// color of a voxel, typically from a gradient computed before.
+template <typename F>
+inline void fill_box(int16_t x0, int16_t y0, int16_t z0, int16_t x1,
+                     int16_t y1, int16_t z1, F color) {
+  x0 = max(x0, (int16_t)0), y0 = max(y0, (int16_t)0), z0 = max(z0, (int16_t)0);
+  x1 = min(x1, (int16_t)15), y1 = min(y1, (int16_t)15), z1 = min(z1, (int16_t)15);
+  if (x0 > x1 || y0 > y1 || z0 > z1) return;
+  const uint8_t b = Display::cubeBuffer;
+  COST(VOXEL, (x1 - x0 + 1) * (y1 - y0 + 1) * (z1 - z0 + 1));
+  for (uint8_t x = x0; x <= x1; x++)
+    for (uint8_t y = y0; y <= y1; y++) {
+#if defined OCCUPANCY
+      Display::occupancy[b][x][y] |= (uint16_t)((2 << z1) - (1 << z0));
+#endif
+#if defined WIREORDER || defined MORTON
+      for (uint8_t z = z0; z <= z1; z++) Display::at(b, x, y, z) = color(x, y, z);
+#else
+      Color *v = &Display::cube[b][x][y][z0];
+      for (uint8_t z = z0; z <= z1; z++) *v++ = color(x, y, z);
+#endif
+    }
+}
+
+// Draw a frame of a voxel model centered on position in system coordinates,
+// every voxel of the model scale voxels wide. Scaled up a voxel fills its box,
+// scaled down voxels share cells. palette replaces the colors of the model.
+inline void model(const model_t &m, const uint8_t frame,
+                  const Vector3 &position, const float scale = 1.0f,
+                  const uint8_t *palette = nullptr) {
+  const Vector3 corner =
+      position - Vector3(m.width, m.height, m.depth) * (0.5f * scale);
+  const float h = 0.5f * scale;
+  Model::frame(m, frame, [&](uint8_t x, uint8_t y, uint8_t z, uint8_t i) {
+    const Color c = Model::color(m, i, palette);
+    const Vector3 v = corner + Vector3(x + 0.5f, y + 0.5f, z + 0.5f) * scale;
+    if (scale <= 1.0f) {
+      voxel(v, c);
+      return;
+    }
+    // The cells whose centers are inside the box
+    fill_box((int16_t)(v.x - h + CX + 32768.5f) - 32768,
+             (int16_t)(v.y - h + CY + 32768.5f) - 32768,
+             (int16_t)(v.z - h + CZ + 32768.5f) - 32768,
+             (int16_t)(v.x + h + CX + 32768.5f) - 32769,
+             (int16_t)(v.y + h + CY + 32768.5f) - 32769,
+             (int16_t)(v.z + h + CZ + 32768.5f) - 32769,
+             [&](uint8_t, uint8_t, uint8_t) { return c; });
+  });
+}
+
+// Fill the voxels from y0 to y1 of column x, z with gradient[y]
+inline void fill_span(const uint8_t x, const uint8_t z, const int16_t y0,
+                      const int16_t y1, const Color *gradient) {
+  fill_box(x, y0, z, x, y1, z,
+           [gradient](uint8_t, uint8_t y, uint8_t) { return gradient[y]; });
+}
+
+// Fill the voxels from z0 to z1 of column x, y with gradient[z], the faster
+// direction
+inline void fill_span_z(const uint8_t x, const uint8_t y, const int16_t z0,
+                        const int16_t z1, const Color *gradient) {
+  fill_box(x, y, z0, x, y, z1,
+           [gradient](uint8_t, uint8_t, uint8_t z) { return gradient[z]; });
+}
+
+// Base of the shaders of shade(), the hooks a shader does not hide are empty
+struct shader_t {
+  // Before the rows of plane x, for the terms that only depend on x
+  void begin_plane(const uint8_t) {}
+  // Before the voxels of row x, y along z, for the terms of x and y
+  void begin_row(const uint8_t, const uint8_t) {}
+};
+
+// Shade a box of voxels using physical cube coordinates, clipped to the cube
+// once. The shader is called as shader(z, c) for every voxel of a row and
+// sets c and returns true when it lights the voxel, leaving voxels drawn
+// before (motion blur) as they are otherwise. The rows are written through a
+// pointer, the lit voxels of a row mark its column with one word.
+template <typename S>
+inline void shade(S &shader, int16_t x0, int16_t y0, int16_t z0, int16_t x1,
+                  int16_t y1, int16_t z1) {
+  x0 = max(x0, (int16_t)0), y0 = max(y0, (int16_t)0), z0 = max(z0, (int16_t)0);
+  x1 = min(x1, (int16_t)15), y1 = min(y1, (int16_t)15), z1 = min(z1, (int16_t)15);
+  if (x0 > x1 || y0 > y1 || z0 > z1) return;
+  const uint8_t b = Display::cubeBuffer;
+  COST(VOXEL, (x1 - x0 + 1) * (y1 - y0 + 1) * (z1 - z0 + 1));
+  for (uint8_t x = x0; x <= x1; x++) {
+    shader.begin_plane(x);
+    for (uint8_t y = y0; y <= y1; y++) {
+      shader.begin_row(x, y);
+      uint16_t lit = 0;
+#if defined WIREORDER || defined MORTON
+      for (uint8_t z = z0; z <= z1; z++)
+        if (shader(z, Display::at(b, x, y, z))) lit |= 1 << z;
+#else
+      Color *v = &Display::cube[b][x][y][0];
+      for (uint8_t z = z0; z <= z1; z++)
+        if (shader(z, v[z])) lit |= 1 << z;
+#endif
+#if defined OCCUPANCY
+      Display::occupancy[b][x][y] |= lit;
+#endif
+      (void)lit;
+    }
+  }
+}
+
+// Shade the whole cube
+template <typename S>
+inline void shade(S &shader) {
+  shade(shader, 0, 0, 0, 15, 15, 15);
+}
+
+// Draw a volume of bits (bit z of volume[x][y], see power/Fractal.h) turned
+// by angle radians about the y axis through the center of the cube. Every
+// voxel samples the nearest bit of the volume turned back, so the turned
+// volume has no holes, and a turn about y takes one rotation per column along
+// y instead of one per voxel. color(x, y, z) gives the color of a lit voxel.
+template <typename F>
+inline void sample_y(const uint16_t (&volume)[16][16], const float angle,
+                     F color) {
+  float s, c;
+  fsincos(angle, s, c);
+  for (uint8_t x = 0; x < 16; x++)
+    for (uint8_t z = 0; z < 16; z++) {
+      const float dx = x - 7.5f, dz = z - 7.5f;
+      const float fx = dx * c - dz * s + 8.0f;
+      const float fz = dx * s + dz * c + 8.0f;
+      if (!(fx >= 0 && fx < 16 && fz >= 0 && fz < 16)) continue;
+      const uint8_t sx = fx, sz = fz;
+      for (uint8_t y = 0; y < 16; y++)
+        if (volume[sx][y] >> sz & 1) voxel(x, y, z, color(x, y, z));
+    }
+}
+
+// Walk the voxels of the cube that lie inside a w x h x d source volume turned
+// by r about the centers of both, the inverse mapping: every voxel is turned
+// back to the point of the source it shows. The source point of a row is
+// stepped from the row before and steps by a constant Q16.16 delta along z,
+// the part of the row inside the source is solved once, so a voxel costs
+// three adds and a row that misses the source nothing.
+// visit(x, y, z, sx, sy, sz) gets the source point in Q16.16, voxel i of the
+// source spans i to i + 1.
+template <typename F>
+inline void walk_rotated(const RotationMatrix &r, const uint8_t w,
+                         const uint8_t h, const uint8_t d, F visit) {
+  // The transpose turns back, a step along an axis of the cube is a row of r
+  int32_t step[3][3], size[3] = {w << 16, h << 16, d << 16};
+  for (uint8_t a = 0; a < 3; a++)
+    for (uint8_t i = 0; i < 3; i++) step[a][i] = r.m[a][i] * 65536.0f;
+  float inverse[3];
+  for (uint8_t i = 0; i < 3; i++)
+    inverse[i] = step[2][i] ? 1.0f / step[2][i] : 0;
+  // Source point of voxel 0, 0, 0
+  const float cx = CX, cy = CY, cz = CZ;
+  int32_t plane[3];
+  for (uint8_t i = 0; i < 3; i++)
+    plane[i] = size[i] / 2 -
+               (int32_t)((r.m[0][i] * cx + r.m[1][i] * cy + r.m[2][i] * cz) *
+                         65536.0f);
+  for (uint8_t x = 0; x < 16; x++) {
+    int32_t row[3] = {plane[0], plane[1], plane[2]};
+    for (uint8_t y = 0; y < 16; y++) {
+      auto inside = [&](const int16_t z) {
+        for (uint8_t i = 0; i < 3; i++) {
+          const int32_t v = row[i] + z * step[2][i];
+          if (v < 0 || v >= size[i]) return false;
+        }
+        return true;
+      };
+      // The source is convex, the voxels inside it are one run
+      float lo = 0, hi = 15;
+      for (uint8_t i = 0; i < 3 && lo <= hi; i++) {
+        if (!step[2][i]) {
+          if (row[i] < 0 || row[i] >= size[i]) lo = 16;
+          continue;
+        }
+        const float a = -row[i] * inverse[i];
+        const float b = (size[i] - row[i]) * inverse[i];
+        lo = fmaxf(lo, fminf(a, b));
+        hi = fminf(hi, fmaxf(a, b));
+      }
+      if (lo <= hi) {
+        int16_t z0 = max((int16_t)0, (int16_t)((int16_t)lo - 1));
+        int16_t z1 = min((int16_t)15, (int16_t)((int16_t)hi + 1));
+        while (z0 <= z1 && !inside(z0)) z0++;
+        while (z1 >= z0 && !inside(z1)) z1--;
+        int32_t sx = row[0] + z0 * step[2][0];
+        int32_t sy = row[1] + z0 * step[2][1];
+        int32_t sz = row[2] + z0 * step[2][2];
+        for (int16_t z = z0; z <= z1; z++) {
+          visit(x, y, z, sx, sy, sz);
+          sx += step[2][0];
+          sy += step[2][1];
+          sz += step[2][2];
+        }
+      }
+      for (uint8_t i = 0; i < 3; i++) row[i] += step[1][i];
+    }
+    for (uint8_t i = 0; i < 3; i++) plane[i] += step[0][i];
+  }
+}
+
+// Draw a w x h x d source volume turned by r about the center of the cube,
+// every voxel shows the nearest voxel of the source. color(sx, sy, sz) gives
+// the color of a voxel of the source, black is not drawn.
+template <typename F>
+inline void sample_rotated(const RotationMatrix &r, const uint8_t w,
+                           const uint8_t h, const uint8_t d, F color) {
+  walk_rotated(r, w, h, d,
+               [&](uint8_t x, uint8_t y, uint8_t z, int32_t sx, int32_t sy,
+                   int32_t sz) {
+                 const Color c = color(sx >> 16, sy >> 16, sz >> 16);
+                 if (!c.isBlack()) cell(x, y, z) = c;
+               });
+}
+
+// Same, blending the 8 voxels of the source around the point trilinearly,
+// the edges of the source are repeated
+template <typename F>
+inline void sample_rotated_linear(const RotationMatrix &r, const uint8_t w,
+                                  const uint8_t h, const uint8_t d, F color) {
+  auto mix = [](const Color &a, const Color &b, const int32_t f) {
+    return Color(a.r + ((b.r - a.r) * f >> 8), a.g + ((b.g - a.g) * f >> 8),
+                 a.b + ((b.b - a.b) * f >> 8));
+  };
+  walk_rotated(r, w, h, d,
+               [&](uint8_t x, uint8_t y, uint8_t z, int32_t sx, int32_t sy,
+                   int32_t sz) {
+                 // Between the centers of the voxels
+                 sx -= 32768, sy -= 32768, sz -= 32768;
+                 const int16_t x0 = max(sx >> 16, (int32_t)0);
+                 const int16_t y0 = max(sy >> 16, (int32_t)0);
+                 const int16_t z0 = max(sz >> 16, (int32_t)0);
+                 const int16_t x1 = min(x0 + 1, w - 1), y1 = min(y0 + 1, h - 1);
+                 const int16_t z1 = min(z0 + 1, d - 1);
+                 const int32_t fx = sx < 0 ? 0 : sx >> 8 & 0xFF;
+                 const int32_t fy = sy < 0 ? 0 : sy >> 8 & 0xFF;
+                 const int32_t fz = sz < 0 ? 0 : sz >> 8 & 0xFF;
+                 const Color c = mix(
+                     mix(mix(color(x0, y0, z0), color(x1, y0, z0), fx),
+                         mix(color(x0, y1, z0), color(x1, y1, z0), fx), fy),
+                     mix(mix(color(x0, y0, z1), color(x1, y0, z1), fx),
+                         mix(color(x0, y1, z1), color(x1, y1, z1), fx), fy),
+                     fz);
+                 if (!c.isBlack()) cell(x, y, z) = c;
+               });
+}
+
+// Symmetry of a frame, the animation draws the fundamental region only and
+// symmetrize() copies it to the rest of the cube. A mirror draws the half
+// below 8 of its axis, ROTATE_Y4 the quarter with x and z below 8 (turned by
+// 90 degrees about y three times). Flags, mirrors combine.
+enum class symmetry_t : uint8_t {
+  MIRROR_X = 1,
+  MIRROR_Y = 2,
+  MIRROR_Z = 4,
+  OCTANT = 7,
+  ROTATE_Y4 = 8
+};
+
+// Calls f(x, y, z) for every voxel of the drawing buffer that may be lit,
+// with x below xn, y below yn and z below zn
+template <typename F>
+inline void drawn(const uint8_t xn, const uint8_t yn, const uint8_t zn, F f) {
+  for (uint8_t x = 0; x < xn; x++)
+    for (uint8_t y = 0; y < yn; y++) {
+#if defined OCCUPANCY
+      uint16_t lit = Display::occupancy[Display::cubeBuffer][x][y] &
+                     (uint16_t)((1 << zn) - 1);
+      for (uint8_t z = 0; lit; z++, lit >>= 1)
+        if (lit & 1) f(x, y, z);
+#else
+      for (uint8_t z = 0; z < zn; z++) f(x, y, z);
+#endif
+    }
+}
+
+// Copy a voxel of the drawing buffer with its palette index (not its light)
+inline void replicate(const uint8_t x, const uint8_t y, const uint8_t z,
+                      const uint8_t tx, const uint8_t ty, const uint8_t tz) {
+  const uint8_t b = Display::cubeBuffer;
+  COST(VOXEL, 1);
+#if defined OCCUPANCY
+  Display::occupancy[b][tx][ty] |= 1 << tz;
+#endif
+  Display::at(b, tx, ty, tz) = Display::at(b, x, y, z);
+  Display::indexAt(b, tx, ty, tz) = Display::indexAt(b, x, y, z);
+}
+
+// Replicate the drawn fundamental region, only its lit voxels are copied.
+// Light has to be added after.
+inline void symmetrize(const symmetry_t symmetry) {
+  const uint8_t s = (uint8_t)symmetry;
+  if (s & (uint8_t)symmetry_t::MIRROR_X)
+    drawn(8, 16, 16, [](uint8_t x, uint8_t y, uint8_t z) {
+      replicate(x, y, z, 15 - x, y, z);
+    });
+  if (s & (uint8_t)symmetry_t::MIRROR_Y)
+    drawn(16, 8, 16, [](uint8_t x, uint8_t y, uint8_t z) {
+      replicate(x, y, z, x, 15 - y, z);
+    });
+  if (s & (uint8_t)symmetry_t::MIRROR_Z)
+    drawn(16, 16, 8, [](uint8_t x, uint8_t y, uint8_t z) {
+      replicate(x, y, z, x, y, 15 - z);
+    });
+  if (s & (uint8_t)symmetry_t::ROTATE_Y4)
+    drawn(8, 16, 8, [](uint8_t x, uint8_t y, uint8_t z) {
+      replicate(x, y, z, z, y, 15 - x);
+      replicate(x, y, z, 15 - x, y, 15 - z);
+      replicate(x, y, z, 15 - z, y, x);
+    });
+}
+
+// Walk from a to b in Q16.16 cube coordinates with steps of at most one voxel
+// along the major axis, calling plot(x, y, z, i) for every point i
+template <typename F>
+inline void walk(int32_t x, int32_t y, int32_t z, const int32_t x1,
+                 const int32_t y1, const int32_t z1, F plot) {
+  const int32_t dx = x1 - x, dy = y1 - y, dz = z1 - z;
+  const int32_t steps = (max(abs(dz), max(abs(dx), abs(dy))) + 0xFFFF) >> 16;
+  const int32_t ix = steps ? dx / steps : 0;
+  const int32_t iy = steps ? dy / steps : 0;
+  const int32_t iz = steps ? dz / steps : 0;
+  for (int32_t i = 0; i <= steps; i++, x += ix, y += iy, z += iz)
+    plot(x, y, z, i);
+}
+
+// Voxel of a coordinate in system coordinates, shifted to the center of it
+inline int32_t walk_voxel(const float v, const float c) {
+  return (((int32_t)(v + 32768.5f + c) - 32768) << 16) + 0x8000;
+}
+
+// Walk from voxel to voxel (Bresenham), each major axis layer is set once
+template <typename F>
+inline void walk(const Vector3 &a, const Vector3 &b, F plot) {
+  walk(walk_voxel(a.x, CX), walk_voxel(a.y, CY), walk_voxel(a.z, CZ),
+       walk_voxel(b.x, CX), walk_voxel(b.y, CY), walk_voxel(b.z, CZ), plot);
+}
+
+// Set the voxel of a walked point
+inline void walk_plot(const int32_t x, const int32_t y, const int32_t z,
+                      const Color &c) {
+  const int16_t vx = x >> 16, vy = y >> 16, vz = z >> 16;
+  if (((vx | vy | vz) & 0xFFF0) == 0) cell(vx, vy, vz) = c;
+}
+
 //  Draw a line through two points using system coordinates
 inline void line(Vector3 a, Vector3 b) {
-  // Get the difference vector.
-  Vector3 n = (a - b);
-  // Get the amount of steps needed
-  float steps = 1 + max(abs(n.z), max(abs(n.x), abs(n.y)));
-  // Get the increment vector for each dimension
-  Vector3 inc = n / steps;
   // The vector is pointing in the direction of Red -> Yellow
-  for (uint8_t i = 0; i <= steps; i++)
-    voxel(a - (inc * i), Color(i * 8, RainbowGradientPalette));
+  walk(a, b, [](int32_t x, int32_t y, int32_t z, int32_t i) {
+    walk_plot(x, y, z, Color(i * 8, RainbowGradientPalette));
+  });
 }
 
 //  Draw a line through two points using system coordinates
 inline void line(Vector3 a, Vector3 b, Color c) {
-  // Get the difference vector.
-  Vector3 n = (a - b);
-  // Get the amount of steps needed
-  float steps = 1 + max(abs(n.z), max(abs(n.x), abs(n.y)));
-  // Get the increment vector for each dimension
-  Vector3 inc = n / steps;
-  // The vector is pointing in the direction of Red -> Yellow
-  for (uint8_t i = 0; i <= steps; i++) voxel(a - (inc * i), c);
+  walk(a, b, [&c](int32_t x, int32_t y, int32_t z, int32_t) {
+    walk_plot(x, y, z, c);
+  });
+}
+
+//  Draw a line through two points using system coordinates, the color goes
+//  from ca to cb
+inline void line(Vector3 a, Vector3 b, Color ca, Color cb) {
+  // Same amount of steps as the walk between the voxels of a and b
+  const int32_t dx = abs(walk_voxel(b.x, CX) - walk_voxel(a.x, CX));
+  const int32_t dy = abs(walk_voxel(b.y, CY) - walk_voxel(a.y, CY));
+  const int32_t dz = abs(walk_voxel(b.z, CZ) - walk_voxel(a.z, CZ));
+  const int32_t steps = max(dz, max(dx, dy)) >> 16;
+  walk(a, b, [&](int32_t x, int32_t y, int32_t z, int32_t i) {
+    walk_plot(x, y, z, Color(ca).blend(steps ? i * 255 / steps : 0, cb));
+  });
 }
 
 //  Draw a line through two points using system coordinates
 inline void line(Vector3 a, Vector3 b, Color c, const float r) {
-  // Get the difference vector.
-  Vector3 n = (a - b);
-  // Get the amount of steps needed
-  float steps = 1 + max(abs(n.z), max(abs(n.x), abs(n.y)));
-  // Get the increment vector for each dimension
-  Vector3 inc = n / steps;
-  // The vector is pointing in the direction of Red -> Yellow
-  for (uint8_t i = 0; i <= steps; i++) radiate4(a - (inc * i), c, r);
+  const int32_t ax = (a.x + CX) * 65536, ay = (a.y + CY) * 65536;
+  const int32_t az = (a.z + CZ) * 65536, bx = (b.x + CX) * 65536;
+  const int32_t by = (b.y + CY) * 65536, bz = (b.z + CZ) * 65536;
+  walk(ax, ay, az, bx, by, bz, [&](int32_t x, int32_t y, int32_t z, int32_t) {
+    const Vector3 v = Vector3(x, y, z) / 65536.0f - Vector3(CX, CY, CZ);
+    radiate(v, c, r, falloff_t::QUARTIC);
+  });
+}
+
+//  Draw a line through two points using fixed point system coordinates
+inline void line(const Vector3q &a, const Vector3q &b, const Color &c) {
+  // Round to the voxel and shift to its center in Q16.16
+  auto q = [](int16_t v, int16_t c) { return (((v + c) >> 8) << 16) + 0x8000; };
+  walk(q(a.x, CXQ), q(a.y, CYQ), q(a.z, CZQ), q(b.x, CXQ), q(b.y, CYQ),
+       q(b.z, CZQ), [&c](int32_t x, int32_t y, int32_t z, int32_t) {
+         walk_plot(x, y, z, c);
+       });
+}
+
+//  Draw an anti aliased line through two points using system coordinates.
+//  Every layer of the major axis spreads the color over the four voxels
+//  around the line weighted by coverage.
+inline void line_aa(const Vector3 &a, const Vector3 &b, const Color &c) {
+  float p[3] = {a.x + CX, a.y + CY, a.z + CZ};
+  float q[3] = {b.x + CX, b.y + CY, b.z + CZ};
+  float d[3] = {q[0] - p[0], q[1] - p[1], q[2] - p[2]};
+  // u is the major axis, v and w the minor axes
+  uint8_t u = abs(d[0]) >= abs(d[1]) ? (abs(d[0]) >= abs(d[2]) ? 0 : 2)
+                                     : (abs(d[1]) >= abs(d[2]) ? 1 : 2);
+  uint8_t v = (u + 1) % 3, w = (u + 2) % 3;
+  if (d[u] < 0) {
+    for (uint8_t i = 0; i < 3; i++) {
+      float t = p[i];
+      p[i] = q[i];
+      q[i] = t;
+      d[i] = -d[i];
+    }
+  }
+  const int32_t u0 = (int32_t)(p[u] + 0.5f), u1 = (int32_t)(q[u] + 0.5f);
+  const float sv = d[u] > 0 ? d[v] / d[u] : 0;
+  const float sw = d[u] > 0 ? d[w] / d[u] : 0;
+  // Minor axes in Q16.16 at the first layer, kept positive to truncate
+  int32_t pv = (p[v] + (u0 - p[u]) * sv + 1024) * 65536;
+  int32_t pw = (p[w] + (u0 - p[u]) * sw + 1024) * 65536;
+  const int32_t iv = sv * 65536, iw = sw * 65536;
+  for (int32_t l = u0; l <= u1; l++, pv += iv, pw += iw) {
+    const int32_t cv = (pv >> 16) - 1024, cw = (pw >> 16) - 1024;
+    const uint16_t fv = (pv >> 8) & 0xFF, fw = (pw >> 8) & 0xFF;
+    const uint8_t weight[4] = {
+        (uint8_t)((255 - fv) * (255 - fw) / 255),
+        (uint8_t)(fv * (255 - fw) / 255), (uint8_t)((255 - fv) * fw / 255),
+        (uint8_t)(fv * fw / 255)};
+    for (uint8_t k = 0; k < 4; k++) {
+      int16_t n[3];
+      n[u] = l;
+      n[v] = cv + (k & 1);
+      n[w] = cw + (k >> 1);
+      if (weight[k] && ((n[0] | n[1] | n[2]) & 0xFFF0) == 0)
+        cell(n[0], n[1], n[2]).maximize(c.scaled(weight[k]));
+    }
+  }
+}
+
+// Trace a parametric curve p = curve(t) from t0 to t1 (t0 < t1) with points
+// about spacing apart in system coordinates, calling dot(p, t) for each. The
+// step follows the speed of the curve, so it is evaluated about once per
+// spacing wherever its parameter runs fast or slow. A step landing further
+// than twice the spacing is retried shorter, which keeps the points touching.
+// Stops after budget evaluations, returns the evaluations used. Thin curves
+// draw their points with splat_aa() a voxel apart, thick ones with radiate()
+// at about the radius apart.
+//
+// trace([](float t) { return Vector3(cosf(t), t, sinf(t)) * 6; }, -1, 1, 1,
+//       64, [](const Vector3 &p, float t) { splat_aa(p, Color::WHITE); });
+template <typename C, typename D>
+inline uint16_t trace(C curve, const float t0, const float t1,
+                      const float spacing, const uint16_t budget, D dot) {
+  float t = t0;
+  Vector3 p = curve(t);
+  dot(p, t);
+  uint16_t n = 1;
+  float step = (t1 - t0) / 16;
+  while (t < t1 && n < budget) {
+    const float tn = t + step < t1 ? t + step : t1;
+    const Vector3 q = curve(tn);
+    n++;
+    const float d = (q - p).magnitude();
+    // Grow or shrink the step at most four times towards the spacing
+    float ratio = d > spacing / 4 ? spacing / d : 4;
+    if (ratio < 0.25f) ratio = 0.25f;
+    step = (tn - t) * ratio;
+    if (d > 2 * spacing) continue;
+    t = tn;
+    p = q;
+    dot(p, t);
+  }
+  return n;
 }
 
 // Draw a line through the center of the cube with direction n
@@ -180,4 +863,103 @@ inline void line(Vector3 n) {
   // Draw a line through the center
   line(n * scalar, n * -scalar);
 }
+
+// Rasterize a triangle using system coordinates. The voxels are visited in
+// columns along the dominant axis of the normal, one voxel per column. The
+// conservative mode sets every voxel the triangle touches, so surfaces built
+// from triangles are hole free.
+inline void triangle(const Vector3 &a, const Vector3 &b, const Vector3 &c,
+                     const Color &col, const bool conservative = false) {
+  const float p[3][3] = {{a.x + CX, a.y + CY, a.z + CZ},
+                         {b.x + CX, b.y + CY, b.z + CZ},
+                         {c.x + CX, c.y + CY, c.z + CZ}};
+  const Vector3 nv = (b - a).cross(c - a);
+  const float n[3] = {nv.x, nv.y, nv.z};
+  // w is the dominant axis of the normal, u and v span the projection plane
+  const uint8_t w = abs(n[0]) >= abs(n[1]) ? (abs(n[0]) >= abs(n[2]) ? 0 : 2)
+                                           : (abs(n[1]) >= abs(n[2]) ? 1 : 2);
+  const uint8_t u = (w + 1) % 3, v = (w + 2) % 3;
+  // Degenerated triangles are drawn as their outline
+  if (n[w] == 0) {
+    line(a, b, col);
+    line(b, c, col);
+    return;
+  }
+  // Edge functions in the projection plane, positive inside
+  const float s = n[w] > 0 ? 1.0f : -1.0f;
+  float eu[3], ev[3], e0[3];
+  for (uint8_t k = 0; k < 3; k++) {
+    const float *p0 = p[k], *p1 = p[(k + 1) % 3];
+    eu[k] = -s * (p1[v] - p0[v]);
+    ev[k] = s * (p1[u] - p0[u]);
+    e0[k] = -(eu[k] * p0[u] + ev[k] * p0[v]);
+    // Grow by half a voxel in the conservative mode
+    if (conservative) e0[k] += 0.5f * (abs(eu[k]) + abs(ev[k]));
+  }
+  // Plane w = (d - n[u] * u - n[v] * v) / n[w] and its slope over a voxel
+  const float d = n[0] * p[0][0] + n[1] * p[0][1] + n[2] * p[0][2];
+  const float du = -n[u] / n[w], dv = -n[v] / n[w];
+  const float spread = conservative ? 0.5f * (abs(du) + abs(dv)) : 0;
+  // Voxel centers around the projected triangle, the edges pick the inside
+  auto lo = [](float f) { return max((int32_t)(f + 32767.5f) - 32768, 0); };
+  auto hi = [](float f) { return min((int32_t)(f + 32769.5f) - 32768, 15); };
+  const int16_t u1 = lo(min(p[0][u], min(p[1][u], p[2][u])));
+  const int16_t u2 = hi(max(p[0][u], max(p[1][u], p[2][u])));
+  const int16_t v1 = lo(min(p[0][v], min(p[1][v], p[2][v])));
+  const int16_t v2 = hi(max(p[0][v], max(p[1][v], p[2][v])));
+  int16_t q[3];
+  for (int16_t i = u1; i <= u2; i++) {
+    for (int16_t j = v1; j <= v2; j++) {
+      if (eu[0] * i + ev[0] * j + e0[0] < 0) continue;
+      if (eu[1] * i + ev[1] * j + e0[1] < 0) continue;
+      if (eu[2] * i + ev[2] * j + e0[2] < 0) continue;
+      const float h = d / n[w] + du * i + dv * j;
+      const int16_t k1 = max((int32_t)(h - spread + 32768.5f) - 32768, 0);
+      const int16_t k2 = min((int32_t)(h + spread + 32768.5f) - 32768, 15);
+      q[u] = i;
+      q[v] = j;
+      for (q[w] = k1; q[w] <= k2; q[w]++)
+        cell(q[0], q[1], q[2]) = col;
+    }
+  }
+}
+
+// Rasterize a planar quad a b c d using system coordinates
+inline void quad(const Vector3 &a, const Vector3 &b, const Vector3 &c,
+                 const Vector3 &d, const Color &col,
+                 const bool conservative = false) {
+  triangle(a, b, c, col, conservative);
+  triangle(a, c, d, col, conservative);
+}
+
+/*------------------------------------------------------------------------------
+ * MESH
+ *------------------------------------------------------------------------------
+ * Indexed triangle mesh with V vertices and F faces. The vertices are set
+ * once, transform() rotates, scales and moves them into system coordinates
+ * and draw() rasterizes every face with the color returned by shade(face).
+ *
+ * Mesh<8, 12> box;
+ * box.transform(Quaternion(angle, Vector3::Y), 5.0f);
+ * box.draw([](uint16_t f) { return Color(f * 20, RainbowGradientPalette); });
+ *----------------------------------------------------------------------------*/
+template <uint16_t V, uint16_t F>
+struct Mesh {
+  Vector3 vertex[V];
+  uint16_t face[F][3];
+  Vector3 world[V];
+
+  void transform(const Quaternion &q, const float scale = 1.0f,
+                 const Vector3 &offset = Vector3(0, 0, 0)) {
+    for (uint16_t i = 0; i < V; i++)
+      world[i] = q.rotate(vertex[i] * scale) + offset;
+  }
+
+  template <typename S>
+  void draw(S shade, const bool conservative = false) const {
+    for (uint16_t f = 0; f < F; f++)
+      triangle(world[face[f][0]], world[face[f][1]], world[face[f][2]],
+               shade(f), conservative);
+  }
+};
 #endif
\ No newline at end of file
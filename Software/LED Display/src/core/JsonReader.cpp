@@ -0,0 +1,184 @@
+#include "JsonReader.h"
+/*------------------------------------------------------------------------------
+ * JSON READER CLASS
+ *----------------------------------------------------------------------------*/
+int JsonReader::read() {
+  if (pending != -2) {
+    const int c = pending;
+    pending = -2;
+    return c;
+  }
+  if (stream) return stream->read();
+  return *cursor ? (uint8_t)*cursor++ : -1;
+}
+
+json_t JsonReader::fail() {
+  want = want_t::DONE;
+  depth = 0;
+  stream = nullptr;
+  cursor = "";
+  return json_t::ERROR;
+}
+
+json_t JsonReader::next() {
+  for (;;) {
+    int c = read();
+    while (c == ' ' || c == '\t' || c == '\n' || c == '\r') c = read();
+    if (c < 0) return want == want_t::DONE && !depth ? json_t::END : fail();
+    switch (want) {
+      case want_t::DONE:
+        return fail();
+      case want_t::COLON:
+        if (c != ':') return fail();
+        want = want_t::VALUE;
+        continue;
+      case want_t::COMMA_OR_END:
+        if (c == ',') {
+          want = array_levels >> (depth - 1) & 1 ? want_t::VALUE : want_t::KEY;
+          continue;
+        }
+        return close(c);
+      case want_t::KEY_OR_END:
+        if (c == '}') return close(c);
+        // fall through
+      case want_t::KEY:
+        if (c != '"' || !string()) return fail();
+        key();
+        want = want_t::COLON;
+        return json_t::KEY;
+      case want_t::VALUE_OR_END:
+        if (c == ']') return close(c);
+        // fall through
+      case want_t::VALUE:
+        break;
+    }
+    // A value
+    if (c == '{') return open(false);
+    if (c == '[') return open(true);
+    if (c == '"') {
+      if (!string()) return fail();
+      valued();
+      return json_t::STRING;
+    }
+    if (c == 't' || c == 'f' || c == 'n') {
+      value[0] = c;
+      value[1] = 0;
+      if (!literal(c == 't' ? "rue" : c == 'f' ? "alse" : "ull")) return fail();
+      valued();
+      return c == 'n' ? json_t::NULL_VALUE : json_t::BOOLEAN;
+    }
+    if (c == '-' || (c >= '0' && c <= '9')) {
+      uint8_t n = 0;
+      while (c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E' ||
+             (c >= '0' && c <= '9')) {
+        if (n < TEXT) value[n++] = c;
+        c = read();
+      }
+      value[n] = 0;
+      unread(c);
+      valued();
+      return json_t::NUMBER;
+    }
+    return fail();
+  }
+}
+
+json_t JsonReader::open(const bool array) {
+  if (depth == DEPTH) return fail();
+  marks[depth] = length;
+  if (array) {
+    array_levels |= 1 << depth;
+    arrays++;
+  } else {
+    array_levels &= ~(1 << depth);
+  }
+  depth++;
+  want = array ? want_t::VALUE_OR_END : want_t::KEY_OR_END;
+  return array ? json_t::ARRAY : json_t::OBJECT;
+}
+
+json_t JsonReader::close(const char c) {
+  const bool array = array_levels >> (depth - 1) & 1;
+  if (c != (array ? ']' : '}')) return fail();
+  depth--;
+  if (array) arrays--;
+  // Back to the key that holds the container
+  length = marks[depth];
+  keys[length] = 0;
+  valued();
+  return array ? json_t::ARRAY_END : json_t::OBJECT_END;
+}
+
+// The characters of a string up to its closing quote into value
+bool JsonReader::string() {
+  uint8_t n = 0;
+  cut = false;
+  for (;;) {
+    int c = read();
+    if (c < 0) return false;
+    if (c == '"') break;
+    if (c == '\\') {
+      c = read();
+      switch (c) {
+        case 'b': c = '\b'; break;
+        case 'f': c = '\f'; break;
+        case 'n': c = '\n'; break;
+        case 'r': c = '\r'; break;
+        case 't': c = '\t'; break;
+        case 'u': {
+          // Only the basic latin of \u escapes, anything else is a '?'
+          uint16_t u = 0;
+          for (uint8_t i = 0; i < 4; i++) {
+            const int h = read();
+            if (h < 0) return false;
+            u = u << 4 | (h <= '9' ? h - '0' : (h | 0x20) - 'a' + 10);
+          }
+          c = u < 0x80 ? u : '?';
+          break;
+        }
+        case '"':
+        case '\\':
+        case '/':
+          break;
+        default:
+          return false;
+      }
+    }
+    if (n < TEXT)
+      value[n++] = c;
+    else
+      cut = true;
+  }
+  value[n] = 0;
+  return true;
+}
+
+bool JsonReader::literal(const char *rest) {
+  for (; *rest; rest++)
+    if (read() != *rest) return false;
+  return true;
+}
+
+// The key replaces the last one of the path in the open object
+void JsonReader::key() {
+  uint8_t n = marks[depth - 1];
+  // A container whose path is full already has no room for the separator
+  if (n >= PATH)
+    cut = true;
+  else if (n)
+    keys[n++] = '.';
+  for (const char *k = value; *k; k++) {
+    if (n >= PATH) {
+      cut = true;
+      break;
+    }
+    keys[n++] = *k;
+  }
+  keys[n] = 0;
+  length = n;
+}
+
+// After a complete value the container goes on or the document is done
+void JsonReader::valued() {
+  want = depth ? want_t::COMMA_OR_END : want_t::DONE;
+}
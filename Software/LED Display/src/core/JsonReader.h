@@ -0,0 +1,92 @@
+#ifndef JSON_READER_H
+#define JSON_READER_H
+#include <Arduino.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * JSON READER CLASS
+ *------------------------------------------------------------------------------
+ * Pull parser of JSON text from a Stream (a File) or from memory: next()
+ * returns one token at a time and nothing of the document is kept, only the
+ * dotted path of the key the current value belongs to and the text of the
+ * last key or value. Memory is that of a path and a value and the time is
+ * spent once per character, whatever the size of the document.
+ *
+ * Values inside arrays have the path of the array, in_array() tells them
+ * apart. A string or path longer than its buffer is cut short and marked
+ * truncated(). Text that is not JSON returns ERROR and then ends.
+ *
+ * JsonReader json(file);
+ * for (json_t t; (t = json.next()) != json_t::END && t != json_t::ERROR;)
+ *   if (t == json_t::NUMBER) Serial.printf("%s %f\n", json.path(),
+ *                                          json.number());
+ *----------------------------------------------------------------------------*/
+enum class json_t : uint8_t {
+  END,
+  ERROR,
+  OBJECT,
+  OBJECT_END,
+  ARRAY,
+  ARRAY_END,
+  KEY,
+  STRING,
+  NUMBER,
+  BOOLEAN,
+  NULL_VALUE
+};
+
+class JsonReader {
+ public:
+  static const uint8_t DEPTH = 16;
+  static const uint8_t TEXT = 64;
+  static const uint8_t PATH = 64;
+
+  JsonReader(Stream &in) : stream(&in) {}
+  JsonReader(const char *text) : cursor(text) {}
+
+  json_t next();
+  // Text of the last KEY, STRING or NUMBER
+  const char *text() const { return value; }
+  float number() const { return strtof(value, nullptr); }
+  bool boolean() const { return value[0] == 't'; }
+  // Keys from the root to the current one joined by dots
+  const char *path() const { return keys; }
+  bool in_array() const { return arrays > 0; }
+  bool truncated() const { return cut; }
+
+ private:
+  // What the grammar takes next
+  enum class want_t : uint8_t {
+    VALUE,
+    VALUE_OR_END,
+    KEY,
+    KEY_OR_END,
+    COLON,
+    COMMA_OR_END,
+    DONE
+  };
+  Stream *stream = nullptr;
+  const char *cursor = nullptr;
+  int pending = -2;
+  want_t want = want_t::VALUE;
+  // Containers open, a bit per level set for arrays
+  uint8_t depth = 0;
+  uint16_t array_levels = 0;
+  uint8_t arrays = 0;
+  // Length of the path where each open container started
+  uint8_t marks[DEPTH];
+  char keys[PATH + 1] = "";
+  uint8_t length = 0;
+  char value[TEXT + 1] = "";
+  bool cut = false;
+
+  int read();
+  void unread(const int c) { pending = c; }
+  json_t fail();
+  json_t open(const bool array);
+  json_t close(const char c);
+  bool string();
+  bool literal(const char *rest);
+  void key();
+  void valued();
+};
+#endif
@@ -0,0 +1,72 @@
+#include "Kernel.h"
+
+#include <math.h>
+/*------------------------------------------------------------------------------
+ * KERNEL CLASS
+ *----------------------------------------------------------------------------*/
+kernel_t Kernel::cache[SIZE];
+uint32_t Kernel::used[SIZE] = {};
+uint32_t Kernel::tick = 0;
+
+const kernel_t &Kernel::get(const falloff_t falloff, const float radius,
+                            const uint8_t ox, const uint8_t oy,
+                            const uint8_t oz) {
+  const uint8_t r = radius * 8 + 0.5f;
+  uint8_t oldest = 0;
+  tick++;
+  for (uint8_t i = 0; i < SIZE; i++) {
+    kernel_t &k = cache[i];
+    if (used[i] && k.falloff == falloff && k.radius == r &&
+        k.offset[0] == ox && k.offset[1] == oy && k.offset[2] == oz) {
+      used[i] = tick;
+      return k;
+    }
+    if (used[i] < used[oldest]) oldest = i;
+  }
+  kernel_t &k = cache[oldest];
+  k.falloff = falloff;
+  k.radius = r;
+  k.offset[0] = ox;
+  k.offset[1] = oy;
+  k.offset[2] = oz;
+  build(k);
+  used[oldest] = tick;
+  return k;
+}
+
+// Same curves as radiate(), radiate4() and radiate5(), zero outside radius
+void Kernel::build(kernel_t &k) {
+  const float r = k.radius / 8.0f;
+  float f[3];
+  for (uint8_t a = 0; a < 3; a++) {
+    f[a] = k.offset[a] / (float)STEPS;
+    k.lo[a] = (int8_t)ceilf(f[a] - r);
+    k.n[a] = (int8_t)floorf(f[a] + r) - k.lo[a] + 1;
+  }
+  uint8_t *w = k.weights;
+  for (uint8_t i = 0; i < k.n[0]; i++) {
+    const float dx = k.lo[0] + i - f[0];
+    for (uint8_t j = 0; j < k.n[1]; j++) {
+      const float dy = k.lo[1] + j - f[1];
+      for (uint8_t l = 0; l < k.n[2]; l++) {
+        const float dz = k.lo[2] + l - f[2];
+        const float d = sqrtf(dx * dx + dy * dy + dz * dz);
+        uint8_t weight = 0;
+        if (d < r) {
+          switch (k.falloff) {
+            case falloff_t::LINEAR:
+              weight = 255 * (1 - (d / r));
+              break;
+            case falloff_t::QUARTIC:
+              weight = 255 / (1 + (d * d * d * d));
+              break;
+            case falloff_t::QUINTIC:
+              weight = 255 / (1 + (d * d * d * d * d));
+              break;
+          }
+        }
+        *w++ = weight;
+      }
+    }
+  }
+}
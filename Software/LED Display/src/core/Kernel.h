@@ -0,0 +1,52 @@
+#ifndef KERNEL_H
+#define KERNEL_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * KERNEL CLASS
+ *------------------------------------------------------------------------------
+ * Cache of precomputed radial falloff kernels used by radiate() in Graphics.h
+ *
+ * A kernel holds the weights of all voxels within radius of a center with a
+ * sub voxel offset. The radius is quantized to 1/8 and the offset to 1/4 of a
+ * voxel, so drawing only needs a table lookup instead of a sqrt and a divide
+ * per voxel. Recently used kernels are kept, the least recently used kernel
+ * is rebuilt when a new one is needed.
+ *----------------------------------------------------------------------------*/
+// Falloff curves of radiate(), radiate4() and radiate5()
+enum class falloff_t : uint8_t {
+  LINEAR = 0,   // 255 * (1 - d / r)
+  QUARTIC = 1,  // 255 / (1 + d^4)
+  QUINTIC = 2   // 255 / (1 + d^5)
+};
+
+struct kernel_t {
+  falloff_t falloff;
+  // Radius in 1/8 and offset in 1/4 voxel
+  uint8_t radius;
+  uint8_t offset[3];
+  // First voxel relative to the center voxel and amount of voxels per axis
+  int8_t lo[3];
+  uint8_t n[3];
+  // Weights [x][y][z] using n as dimensions
+  uint8_t weights[9 * 9 * 9];
+};
+
+class Kernel {
+ public:
+  // Largest radius that fits, larger radii are drawn without kernel
+  static constexpr float RADIUS = 4.0f;
+  // Offset steps per voxel
+  static const uint8_t STEPS = 4;
+  // Get the kernel for a radius and a quantized offset (0 to STEPS - 1)
+  static const kernel_t &get(const falloff_t falloff, const float radius,
+                             const uint8_t ox, const uint8_t oy,
+                             const uint8_t oz);
+
+ private:
+  static const uint8_t SIZE = 16;
+  static kernel_t cache[SIZE];
+  static uint32_t used[SIZE];
+  static uint32_t tick;
+  static void build(kernel_t &k);
+};
+#endif
@@ -1,29 +1,50 @@
 #include "LCD.h"
 
-ILI9341_T4::DiffBuffStatic<8000> LCD::diff1;
-ILI9341_T4::DiffBuffStatic<8000> LCD::diff2;
+#include "Bus.h"
+#include "Config.h"
+#include "Scheduler.h"
+#include "Trace.h"
+
+ILI9341_T4::DiffBuffStatic<LCD::DIFF_SIZE> LCD::diff1;
+ILI9341_T4::DiffBuffStatic<LCD::DIFF_SIZE> LCD::diff2;
 uint16_t LCD::internal_fb[LX * LY];
-lv_color_t LCD::lvgl_buf[LX * BUF_LY];
+lv_color_t LCD::lvgl_buf[2][LX * BUF_LY];
+uint16_t LCD::band = LCD::BUF_LY;
+uint8_t LCD::gap = LCD::DIFF_GAP;
+// The pen interrupt is attached in begin(), not by the driver
 ILI9341_T4::ILI9341Driver LCD::tft(TFT_CS, TFT_DC, SCK, MOSI, MISO, TFT_RESET,
-                                   TOUCH_CS, TOUCH_IRQ);
+                                   TOUCH_CS);
 lv_disp_draw_buf_t LCD::draw_buf;
 lv_disp_drv_t LCD::disp_drv;
 lv_indev_drv_t LCD::indev_drv;
+uint32_t LCD::gui_cost = LCD::GUI_MIN;
+uint32_t LCD::gui_last = 0;
+bool LCD::ready = false;
+volatile bool LCD::pen = false;
+int16_t LCD::touch_x[TOUCH_SAMPLES];
+int16_t LCD::touch_y[TOUCH_SAMPLES];
+uint8_t LCD::touch_count = 0;
+uint8_t LCD::touch_next = 0;
+uint32_t LCD::touch_last = 0;
+uint32_t LCD::touch_reads = 0;
+uint32_t LCD::active = 0;
+bool LCD::idle = false;
+volatile bool LCD::woken = false;
+Histogram LCD::gui = Histogram(250);
 
-void LCD::begin() {
+bool LCD::begin() {
   // send debug info to serial port.
   tft.output(&Serial);
-  while (!tft.begin(SPI_SPEED))
-    ;
+  if (!tft.begin(SPI_SPEED)) return false;
   tft.setFramebuffer(internal_fb);
   tft.setDiffBuffers(&diff1, &diff2);
   tft.setRotation(1);
   // with have large 8K diff buffers so we can use a small gap.
-  tft.setDiffGap(4);
+  tft.setDiffGap(gap);
   // lvgl is already controlling framerate: we just set
   // this to 1 to minimize screen tearing.
   tft.setVSyncSpacing(1);
-  tft.setRefreshRate(180);
+  tft.setRefreshRate(REFRESH);
 
   pinMode(TFT_LED, OUTPUT);
   digitalWrite(TFT_LED, HIGH);
@@ -32,11 +53,14 @@ void LCD::begin() {
   // tft.calibrateTouch();
   int touch_calib[4] = {TS_MAXX, TS_MINX, TS_MAXY, TS_MINY};
   tft.setTouchCalibration(touch_calib);
+  // PENIRQ goes low while the screen is pressed
+  pinMode(TOUCH_IRQ, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(TOUCH_IRQ), pen_down, FALLING);
 
   // Init LVGL
   lv_init();
-  // initialize lvgl drawing buffer
-  lv_disp_draw_buf_init(&draw_buf, lvgl_buf, nullptr, LX * BUF_LY);
+  // initialize lvgl drawing buffers
+  lv_disp_draw_buf_init(&draw_buf, lvgl_buf[0], lvgl_buf[1], LX * band);
   // Initialize lvgl display driver
   lv_disp_drv_init(&disp_drv);
   disp_drv.hor_res = LX;
@@ -51,20 +75,111 @@ void LCD::begin() {
   indev_drv.read_cb = cb_touchpad_read;
   lv_indev_drv_register(&indev_drv);
 
-  // Set the interval timer giving lvgl ticks.
-  // static IntervalTimer guiTimer;
-  // guiTimer.begin(cb_tick_inc, 1000);
+  // lvgl ticks come from millis(), LV_TICK_CUSTOM in lv_conf.h
+  return true;
+}
 
+void LCD::build() {
   // Generate the GUI (generate with Squareline Studio)
   ui_init();
+  ready = true;
+  active = millis();
+}
+
+void LCD::sleep() {
+  idle = true;
+  tft.setRefreshRate(IDLE_REFRESH);
+  analogWrite(TFT_LED, config.display.lcd_dim);
+}
+
+void LCD::wake_up() {
+  idle = false;
+  woken = false;
+  active = millis();
+  tft.setRefreshRate(REFRESH);
+  pinMode(TFT_LED, OUTPUT);
+  digitalWrite(TFT_LED, HIGH);
 }
 
 // lvgl gui handler
-void LCD::loop() { lv_task_handler(); }
+void LCD::loop() {
+  // A flush would wait on the DMA of the running update
+  if (!ready || tft.asyncUpdateActive()) return;
+  if (idle && !pen && !woken) return;
+  // Between the GUI calls too, the reads follow touch_rate instead of the
+  // input period of LVGL
+  touch();
+  const uint32_t now = micros();
+  if (!idle && Scheduler::remaining() < gui_cost &&
+      now - gui_last < GUI_STARVE)
+    return;
+  if (!Bus::acquire(Bus::SCREEN)) return;
+  // The refresh rate goes out on the bus
+  if (idle) wake_up();
+  gui_last = now;
+  TRACE_BEGIN(GUI);
+  lv_timer_handler();
+  TRACE_END(GUI, 0);
+  const uint16_t timeout = config.display.lcd_idle;
+  if (timeout && !touch_count && millis() - active >= timeout * 1000UL)
+    sleep();
+  // Held until the update the flush started is out
+  Bus::release(Bus::SCREEN);
+  // Follow a slow call at once, forget it over about 16 calls
+  const uint32_t time = micros() - now;
+  gui.add(time);
+  gui_cost -= gui_cost / 16;
+  if (gui_cost < time) gui_cost = time;
+  if (gui_cost < GUI_MIN) gui_cost = GUI_MIN;
+}
+
+void LCD::footprint(Footprint::usage_t& usage) {
+  usage.add(internal_fb, sizeof(internal_fb));
+  usage.add(lvgl_buf, sizeof(lvgl_buf));
+  usage.add(&diff1, sizeof(diff1));
+  usage.add(&diff2, sizeof(diff2));
+  // The heap array is internal to LVGL, LV_ATTRIBUTE_LARGE_RAM_ARRAY puts
+  // it in RAM2
+  usage.bytes[Footprint::RAM2] += LV_MEM_SIZE;
+}
+
+int LCD::report(char* buffer, const size_t size) {
+  const uint32_t ram = sizeof(lvgl_buf[0][0]) * LX * band * 2 +
+                       sizeof(diff1) + sizeof(diff2);
+  const ILI9341_T4::StatsVar cpu = tft.statsCPUtimePerFrame();
+  const ILI9341_T4::StatsVar upload = tft.statsUploadtimePerFrame();
+  const ILI9341_T4::StatsVar pixels = tft.statsPixelsPerFrame();
+  const ILI9341_T4::StatsVar transactions = tft.statsTransactionsPerFrame();
+  const int n = snprintf(
+      buffer, size,
+      "LCD band=%u gap=%u ram=%lu frames=%lu cpu=%lu/%lu upload=%lu/%lu "
+      "pixels=%lu/%lu transactions=%lu/%lu touch=%lu (avg/max, times in us)",
+      band, gap, ram, tft.statsNbFrames(), (uint32_t)cpu.avg(),
+      (uint32_t)cpu.max(), (uint32_t)upload.avg(), (uint32_t)upload.max(),
+      (uint32_t)pixels.avg(), (uint32_t)pixels.max(),
+      (uint32_t)transactions.avg(), (uint32_t)transactions.max(),
+      touch_reads);
+  touch_reads = 0;
+#if defined LCD_TUNING
+  // Next band height and diff gap, within the buffers of BUF_LY lines
+  static const uint16_t BANDS[] = {10, 20, 40};
+  static const uint8_t GAPS[] = {2, 4, 8, 16};
+  static uint8_t setting = 0;
+  setting = (setting + 1) % (sizeof(BANDS) * sizeof(GAPS));
+  band = BANDS[setting / sizeof(GAPS)];
+  gap = GAPS[setting % sizeof(GAPS)];
+  lv_disp_draw_buf_init(&draw_buf, lvgl_buf[0], lvgl_buf[1], LX * band);
+  tft.setDiffGap(gap);
+  lv_obj_invalidate(lv_scr_act());
+#endif
+  tft.statsReset();
+  return n;
+}
 
 // Callback to draw on the screen
 void LCD::cb_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area,
                         lv_color_t* color_p) {
+  active = millis();
   // check if when should update the screen (or just buffer the changes).
   const bool redraw_now = lv_disp_flush_is_last(disp);
   // update the interval framebuffer and then redraw the screen if requested
@@ -77,16 +192,43 @@ void LCD::cb_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area,
 // Callback to read the touchpad
 void LCD::cb_touchpad_read(lv_indev_drv_t* indev_driver,
                            lv_indev_data_t* data) {
-  int touchX, touchY, touchZ;
-  bool touched = tft.readTouch(touchX, touchY, touchZ);
-  if (!touched) {
+  if (!touch_count) {
     data->state = LV_INDEV_STATE_REL;
-  } else {
-    data->state = LV_INDEV_STATE_PR;
-    data->point.x = touchX;
-    data->point.y = touchY;
+    return;
+  }
+  int32_t x = 0, y = 0;
+  for (uint8_t i = 0; i < touch_count; i++) {
+    x += touch_x[i];
+    y += touch_y[i];
   }
+  data->state = LV_INDEV_STATE_PR;
+  data->point.x = x / touch_count;
+  data->point.y = y / touch_count;
 }
 
-// Callback to update lvgl's tick every ms.
-// void LCD::cb_tick_inc() { lv_tick_inc(1); }
+void LCD::touch() {
+  if (!pen) {
+    touch_count = touch_next = 0;
+    return;
+  }
+  const uint32_t now = micros();
+  if (touch_count && now - touch_last < 1000000 / config.display.touch_rate)
+    return;
+  if (!Bus::acquire(Bus::TOUCH)) return;
+  touch_last = now;
+  touch_reads++;
+  int x, y, z;
+  const bool touched = tft.readTouch(x, y, z);
+  Bus::release(Bus::TOUCH);
+  if (!touched) {
+    // Lifted, unless the line went low again since
+    pen = digitalReadFast(TOUCH_IRQ) == LOW;
+    touch_count = touch_next = 0;
+    return;
+  }
+  active = millis();
+  touch_x[touch_next] = x;
+  touch_y[touch_next] = y;
+  touch_next = (touch_next + 1) % TOUCH_SAMPLES;
+  if (touch_count < TOUCH_SAMPLES) touch_count++;
+}
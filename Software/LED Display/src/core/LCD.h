@@ -8,12 +8,29 @@
  * to update the internal framebuffer and sync with the screen using
  * differential updates for maximum performance.
  *
- * The total memory consumption for the 'graphic part' is 191KB:
+ * The total memory consumption for the 'graphic part' is 216KB:
  *
  *   - 150KB for the internal framebuffer
- *   - 25KB for LVGL draw buffer
+ *   - 50KB for 2 LVGL draw buffers of 25KB, LVGL renders a band into one
+ *     while the other is copied into the framebuffer
  *   - 16KB for 2 diffs buffer with 8Kb each.
  *
+ * The touch controller XPT2046 is only read after its pen interrupt, at
+ * display.touch_rate reads per second from loop() until a read finds the pen
+ * lifted, and the input callback hands LVGL the average of the last
+ * TOUCH_SAMPLES reads. Without a pen LVGL is told the screen is released
+ * without a transaction on the SPI bus the screen updates share (see Bus.h).
+ *
+ * After display.lcd_idle seconds without a touch and without anything drawn
+ * the LCD goes idle: LVGL is no longer called, the panel refreshes at
+ * IDLE_REFRESH Hz and the backlight is dimmed to display.lcd_dim by PWM. The
+ * pen interrupt or wake() (from an rpc the GUI should show) brings it back
+ * in the next main loop, before the GUI call of that loop.
+ *
+ * With LCD_TUNING defined report() moves on to the next band height and diff
+ * gap every print interval, the driver statistics show how they trade
+ * against RAM.
+ *
  * Edit the file 'lv_conf.h' such that:
  *     -> Replace '#if 0' by '#if 1'
  *     -> set #define LV_COLOR_DEPTH 16
@@ -27,6 +44,12 @@
 #include <gui/ui.h>
 #include <lvgl.h>
 
+#include "core/Footprint.h"
+#include "power/Histogram.h"
+
+// Try every band height and diff gap in turn and report their statistics
+// #define LCD_TUNING
+
 class LCD {
  public:
   static const uint8_t TFT_LED = 22;
@@ -51,17 +74,31 @@ class LCD {
 
  private:
   static const uint16_t BUF_LY = 40;
+  static const uint8_t DIFF_GAP = 4;
+  static const uint16_t DIFF_SIZE = 8000;
   static const uint32_t SPI_SPEED = 30000000;
+  // The GUI runs regardless of the slack when it waited this long (us)
+  static const uint32_t GUI_STARVE = 50000;
+  // Smallest estimate of a GUI call (us)
+  static const uint32_t GUI_MIN = 500;
+  // Touch reads averaged into a point
+  static const uint8_t TOUCH_SAMPLES = 4;
+  // Panel refresh rate while active and idle (Hz)
+  static const uint16_t REFRESH = 180;
+  static const uint16_t IDLE_REFRESH = 60;
 
  private:
   // 2 diff buffers with about 8K memory each
-  DMAMEM static ILI9341_T4::DiffBuffStatic<8000> diff1;
-  DMAMEM static ILI9341_T4::DiffBuffStatic<8000> diff2;
+  DMAMEM static ILI9341_T4::DiffBuffStatic<DIFF_SIZE> diff1;
+  DMAMEM static ILI9341_T4::DiffBuffStatic<DIFF_SIZE> diff2;
   // the internal framebuffer for the ILI9341_T4 driver (150KB)
   // in DMAMEM to save space in the lower (faster) part of RAM.
   DMAMEM static uint16_t internal_fb[LX * LY];
-  // number of lines in lvgl's internal draw buffer (25K)
-  DMAMEM static lv_color_t lvgl_buf[LX * BUF_LY];
+  // 2 lvgl draw buffers of BUF_LY lines (25K each)
+  DMAMEM static lv_color_t lvgl_buf[2][LX * BUF_LY];
+  // Band height and diff gap in use
+  static uint16_t band;
+  static uint8_t gap;
 
   // the screen driver object
   static ILI9341_T4::ILI9341Driver tft;
@@ -71,14 +108,58 @@ class LCD {
   static lv_disp_drv_t disp_drv;
   // lvgl 'input device driver'
   static lv_indev_drv_t indev_drv;
+  // Decaying maximum duration of a GUI call, start of the last call (us)
+  static uint32_t gui_cost;
+  static uint32_t gui_last;
+  // The GUI is built, see build()
+  static bool ready;
+  // Set by the pen interrupt, cleared when a read finds the pen lifted
+  static volatile bool pen;
+  // The last reads while the pen is down, the amount and the next one
+  static int16_t touch_x[TOUCH_SAMPLES];
+  static int16_t touch_y[TOUCH_SAMPLES];
+  static uint8_t touch_count;
+  static uint8_t touch_next;
+  // Time of the last read (us) and the reads since the last report
+  static uint32_t touch_last;
+  static uint32_t touch_reads;
+  // Last touch or flush (ms), idle since then, woken by an rpc
+  static uint32_t active;
+  static bool idle;
+  static volatile bool woken;
+
+  static void pen_down() { pen = true; }
+  // Read the controller when the pen is down and a read is due
+  static void touch();
+  // Dim and stop the GUI, and back
+  static void sleep();
+  static void wake_up();
 
  public:
-  static void begin();
+  // Durations of the GUI calls (us), reset by Telemetry
+  static Histogram gui;
+
+  // Start the screen driver and LVGL, false while the screen does not answer
+  // yet, call again later
+  static bool begin();
+  // Generate the GUI, loop() runs it from then on
+  static void build();
+  // Run the GUI in the slack after a frame, when its estimated duration fits
+  // before the next frame slot and no screen update is running
   static void loop();
+  // Print the band height, diff gap, their RAM and the driver statistics
+  // since the last report, returns the amount printed
+  static int report(char* buffer, const size_t size);
+  // The framebuffer, draw buffers, diffs and the LVGL heap, see
+  // core/Footprint.h
+  static void footprint(Footprint::usage_t& usage);
+  // Leave the idle state in the next loop, for changes the GUI should show
+  static void wake() { woken = true; }
+  // The SD card shares the SPI bus, it is free while no update is running
+  static bool busy() { return tft.asyncUpdateActive(); }
   static void cb_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area,
                             lv_color_t* color_p);
   static void cb_touchpad_read(lv_indev_drv_t* indev_driver,
                                lv_indev_data_t* data);
-  // static void cb_tick_inc();
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "Latency.h"
+
+#include <string.h>
+
+#include "Display.h"
+
+const char *const Latency::names[HOPS] = {"wio",   "wifi", "bridge", "uart",
+                                          "parse", "pace", "draw",   "swap",
+                                          "shift", "total"};
+const char *const Latency::sources[SOURCES] = {"off", "button", "beat"};
+// Bins of 250us up to 16ms, the network, the window and the sum in wider ones
+Histogram Latency::hops[HOPS] = {
+    Histogram(1000), Histogram(1000), Histogram(250), Histogram(250),
+    Histogram(250),  Histogram(1000), Histogram(250), Histogram(250),
+    Histogram(250),  Histogram(2000)};
+Latency::source_t Latency::source = Latency::OFF;
+uint32_t Latency::probes = 0;
+uint32_t Latency::missed = 0;
+volatile Latency::stage_t Latency::stage = Latency::IDLE;
+volatile uint32_t Latency::stamps[HOPS] = {};
+uint32_t Latency::ready = 0;
+uint32_t Latency::before[PARSE + 1] = {};
+
+void Latency::probe(const source_t from) {
+  source = from;
+  stage = IDLE;
+  for (Histogram &h : hops) h.reset();
+  probes = missed = 0;
+}
+
+void Latency::receive(const uint8_t *payload, const uint16_t size,
+                      const uint32_t waited, const uint32_t due) {
+  if (size != LATENCY_PROBE_SIZE || payload[1] != source || source == OFF)
+    return;
+  if (stage != IDLE) {
+    missed++;
+    return;
+  }
+  for (uint8_t i = 0; i < 4; i++) memcpy(&before[i], &payload[2 + i * 4], 4);
+  before[PARSE] = waited;
+  const uint32_t now = micros();
+  stamps[PARSE] = now;
+  // A window is only shown once it is due, the frames before miss it
+  const int32_t wait = due ? (int32_t)(due - millis()) : 0;
+  ready = wait > 0 ? now + wait * 1000 : now;
+  stage = PARSED;
+}
+
+void Latency::loop() {
+  if (stage == IDLE) return;
+  if (stage != SHOWN) {
+    if (micros() - stamps[PARSE] >= LATENCY_TIMEOUT_MS * 1000) {
+      missed++;
+      stage = IDLE;
+    }
+    return;
+  }
+  uint32_t us[HOPS];
+  memcpy(us, before, sizeof(before));
+  us[PACE] = stamps[PACE] - stamps[PARSE];
+  us[DRAW] = stamps[DRAW] - stamps[PACE];
+  us[SWAP] = stamps[SWAP] - stamps[DRAW];
+  us[SHIFT] = Display::getRefreshMicros();
+  us[TOTAL] = 0;
+  for (uint8_t i = 0; i < TOTAL; i++) {
+    hops[i].add(us[i]);
+    us[TOTAL] += us[i];
+  }
+  hops[TOTAL].add(us[TOTAL]);
+  probes++;
+  stage = IDLE;
+}
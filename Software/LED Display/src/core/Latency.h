@@ -0,0 +1,124 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "power/Histogram.h"
+/*------------------------------------------------------------------------------
+ * LATENCY CLASS
+ *------------------------------------------------------------------------------
+ * Where the time goes between an input on the WIO Terminal and the leds
+ * showing it. In probe mode the WIO Terminal sends a PROBE frame right behind
+ * every button change or every audio window with an onset, on the same path
+ * as the input. The frame brings the stages before the Teensy, each measured
+ * on the clock of the device it ran on, the clocks are not synchronised:
+ *
+ *   wio     the button edge or the first sample of the hop to the frame
+ *           leaving the WIO Terminal, the audio window and the FFT
+ *   wifi    half the round trip of the probe before, echoed by the ESP8266
+ *   bridge  the ESP8266 reading the probe to writing it to the UART
+ *   uart    the bytes ahead of it in the UART FIFO of the ESP8266 and its own
+ *           at the rate of the link
+ *
+ * The Teensy follows the probe through the frame that shows the input:
+ *
+ *   parse   half the gap since the link was read before, the bytes waited
+ *           that long on average, plus the reading up to the probe
+ *   pace    parsed to the start of the next frame, a window also waits until
+ *           it is due
+ *   draw    the start of that frame to Display::submit()
+ *   swap    submitted to the dma isr swapping it in, the transpose and the
+ *           rest of the refresh before
+ *   shift   the refresh that sends it to the leds
+ *
+ * Every stage and their sum go into a histogram. One probe is followed at a
+ * time, one arriving meanwhile is missed, and one that is not shown within
+ * LATENCY_TIMEOUT_MS is given up. The hooks are inline and only compare the
+ * stage while no probe is under way.
+ *
+ * {"event":"latency","probe":"beat"} starts probing the onsets and clears the
+ * histograms, the WIO Terminal hears it as {"event":"probe","on":"beat"}.
+ * {"event":"latency"} replies the histograms.
+ *
+ * Latency::receive(payload, size, waited, due);  // the PROBE frame
+ * Latency::frame(frame_start);                   // Animation::loop()
+ * Latency::loop();                               // main loop
+ *----------------------------------------------------------------------------*/
+// Payload of a PROBE frame: uint8 id, uint8 source, then uint32 us of the
+// wio, wifi, bridge and uart stages
+#define LATENCY_PROBE_SIZE 18
+// A probe not shown by then is given up
+#define LATENCY_TIMEOUT_MS 1000
+
+class Latency {
+ public:
+  // Inputs that send a probe
+  enum source_t : uint8_t { OFF, BUTTON, BEAT, SOURCES };
+  enum hop_t : uint8_t {
+    WIO,
+    WIFI,
+    BRIDGE,
+    UART,
+    PARSE,
+    PACE,
+    DRAW,
+    SWAP,
+    SHIFT,
+    TOTAL,
+    HOPS
+  };
+  static const char *const names[HOPS];
+  static const char *const sources[SOURCES];
+  static Histogram hops[HOPS];
+  static source_t source;
+  static uint32_t probes;
+  static uint32_t missed;
+
+  // Probe this source from now on and clear the histograms
+  static void probe(const source_t from);
+  // A PROBE frame, waited the us it sat in the read buffer, due the millis()
+  // a window is shown at or 0
+  static void receive(const uint8_t *payload, const uint16_t size,
+                      const uint32_t waited, const uint32_t due);
+  // Main loop, adds a probe that was shown and gives up a late one
+  static void loop();
+
+  // A frame starts drawing
+  static void frame(const uint32_t start) {
+    if (stage != PARSED || (int32_t)(start - ready) < 0) return;
+    stamps[PACE] = start;
+    stage = DRAWING;
+  }
+  // Display::submit() took the frame
+  static void submitted() {
+    if (stage != DRAWING) return;
+    stamps[DRAW] = micros();
+    stage = SUBMITTED;
+  }
+  // The transpose prepared the submitted frame
+  static void transposed() {
+    if (stage == SUBMITTED) stage = TRANSPOSED;
+  }
+  // The dma isr swapped the prepared frame in
+  static void swapped() {
+    if (stage != TRANSPOSED) return;
+    stamps[SWAP] = micros();
+    stage = SHOWN;
+  }
+
+ private:
+  enum stage_t : uint8_t {
+    IDLE,
+    PARSED,
+    DRAWING,
+    SUBMITTED,
+    TRANSPOSED,
+    SHOWN
+  };
+  static volatile stage_t stage;
+  // micros() the stage ended, the input can show from ready on
+  static volatile uint32_t stamps[HOPS];
+  static uint32_t ready;
+  static uint32_t before[PARSE + 1];
+};
+#endif
@@ -0,0 +1,57 @@
+#include "Layer.h"
+/*------------------------------------------------------------------------------
+ * LAYER CLASS
+ *----------------------------------------------------------------------------*/
+uint8_t Layer::frame = 0;
+
+// Blending reads the colors, drawn indices of both are resolved first
+void Layer::begin() {
+  Display::resolve();
+  frame = Display::cubeBuffer;
+  Display::cubeBuffer = Display::LAYER;
+}
+
+void Layer::end(const blend_t mode, const uint8_t opacity) {
+  const uint8_t layer = Display::LAYER;
+  Display::resolve();
+  for (uint8_t x = 0; x < 16; x++)
+    for (uint8_t y = 0; y < 16; y++) {
+#if defined OCCUPANCY
+      // Multiply changes the lit frame voxels, all others the lit layer voxels
+      uint16_t &lit = Display::occupancy[frame][x][y];
+      const uint16_t voxels = mode == blend_t::MULTIPLY
+                                  ? lit
+                                  : Display::occupancy[layer][x][y];
+      if (mode != blend_t::MULTIPLY) lit |= voxels;
+      for (uint8_t z = 0; z < 16; z++) {
+        if (!(voxels & (1 << z))) continue;
+#else
+      for (uint8_t z = 0; z < 16; z++) {
+#endif
+        const Color &l = Display::at(layer, x, y, z);
+        Color &f = Display::at(frame, x, y, z);
+        Color c = f;
+        switch (mode) {
+          case blend_t::SET:
+            if (!l.isBlack()) c = l;
+            break;
+          case blend_t::ADD:
+            c += l;
+            break;
+          case blend_t::MAX:
+            c.maximize(l);
+            break;
+          case blend_t::MULTIPLY:
+            c.multiply(l);
+            break;
+        }
+        if (opacity == 255)
+          f = c;
+        else
+          f.blend(opacity, c);
+      }
+    }
+  // Leave the layer buffer cleared for the next layer
+  Display::clear();
+  Display::cubeBuffer = frame;
+}
@@ -0,0 +1,36 @@
+#ifndef LAYER_H
+#define LAYER_H
+#include <stdint.h>
+
+#include "Graphics.h"
+/*------------------------------------------------------------------------------
+ * LAYER CLASS
+ *------------------------------------------------------------------------------
+ * Every active animation is a layer, drawn from the bottom up. The bottom
+ * layer is drawn straight into the frame. Any other layer is drawn into the
+ * layer buffer and composited into the frame right after, in one pass over
+ * the columns it occupies:
+ *
+ * SET       lit voxels of the layer replace the frame, black is transparent
+ * ADD       saturated sum
+ * MAX       brightest of both per color channel
+ * MULTIPLY  the frame is filtered by the layer, black voxels turn it off
+ *
+ * Opacity is the amount of the result blended over the frame, 255 is fully.
+ *
+ * Layer::begin();
+ * animation.draw(dt);
+ * Layer::end(blend_t::SET, 255);
+ *----------------------------------------------------------------------------*/
+class Layer {
+ private:
+  // Drawing buffer of the frame while a layer is drawn
+  static uint8_t frame;
+
+ public:
+  // Redirect all drawing to the cleared layer buffer
+  static void begin();
+  // Composite the layer buffer into the frame and draw into the frame again
+  static void end(const blend_t mode, const uint8_t opacity);
+};
+#endif
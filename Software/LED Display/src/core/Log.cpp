@@ -0,0 +1,78 @@
+#include "Log.h"
+
+#include "ESP8266.h"
+#include "Frame.h"
+/*------------------------------------------------------------------------------
+ * LOG CLASS
+ *----------------------------------------------------------------------------*/
+DMAMEM Log::record_t Log::ring[LOG_RECORDS];
+std::atomic<uint32_t> Log::head{0};
+
+// Next record to send, records lost since the last frame and the link
+static uint32_t tail = 0;
+static uint32_t lost = 0;
+static bool linked = false;
+// A LOG frame: uint32 F_CPU_ACTUAL, uint16 messages, uint32 lost, then per
+// record uint32 cycles, uint16 id, uint8 count and the arguments
+static const uint16_t HEADER = 10;
+static const uint16_t RECORD = 7 + LOG_ARGS * 4;
+static uint8_t payload[FRAME_MAX];
+static uint8_t frame[6 + FRAME_MAX];
+
+static uint16_t put(uint8_t *out, const uint32_t value, const uint8_t bytes) {
+  for (uint8_t i = 0; i < bytes; i++) out[i] = value >> (8 * i);
+  return bytes;
+}
+
+void Log::begin() {
+  for (record_t &r : ring) r.stamp.store(0, std::memory_order_relaxed);
+}
+
+void Log::link(const bool on) { linked = on; }
+
+void Log::loop() {
+  const bool usb = Serial;
+  if (!usb && !linked) return;
+  // The console waits for a host that reads slowly, records may be lost
+  // meanwhile, the link drops a frame when the outbox is full
+  uint16_t capacity = sizeof(payload);
+  if (usb) {
+    const int room = Serial.availableForWrite() - 6;
+    if (room < HEADER + RECORD) return;
+    if (room < capacity) capacity = room;
+  }
+  const uint32_t end = head.load(std::memory_order_acquire);
+  if (end - tail > LOG_RECORDS) {
+    lost += end - tail - LOG_RECORDS;
+    tail = end - LOG_RECORDS;
+  }
+  uint16_t n = HEADER;
+  while (tail != end && n + RECORD <= capacity) {
+    const record_t &r = ring[tail & (LOG_RECORDS - 1)];
+    // Not written yet, or overwritten meanwhile
+    const uint32_t stamp = r.stamp.load(std::memory_order_acquire);
+    if (stamp != tail + 1 && tail + 1 - stamp <= LOG_RECORDS) break;
+    const uint16_t at = n;
+    n += put(&payload[n], r.cycles, 4);
+    n += put(&payload[n], r.id, 2);
+    const uint8_t count = r.count < LOG_ARGS ? r.count : LOG_ARGS;
+    n += put(&payload[n], count, 1);
+    for (uint8_t i = 0; i < count; i++) n += put(&payload[n], r.args[i], 4);
+    if (stamp != tail + 1 ||
+        r.stamp.load(std::memory_order_acquire) != tail + 1) {
+      n = at;
+      lost++;
+    }
+    tail++;
+  }
+  if (n == HEADER && !lost) return;
+  put(payload, F_CPU_ACTUAL, 4);
+  put(&payload[4], MESSAGES, 2);
+  put(&payload[6], lost, 4);
+  const size_t size =
+      Frame::encode(frame, sizeof(frame), frame_t::LOG, payload, n);
+  if (!size) return;
+  if (usb) Serial.write(frame, size);
+  if (linked) ESP8266::send(frame_t::LOG, payload, n, Outbox::BULK);
+  lost = 0;
+}
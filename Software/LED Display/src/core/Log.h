@@ -0,0 +1,102 @@
+#ifndef LOG_H
+#define LOG_H
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+/*------------------------------------------------------------------------------
+ * LOG CLASS
+ *------------------------------------------------------------------------------
+ * Console messages without formatting them on the Teensy. A call site names
+ * its message from LOG_MESSAGES, the id is known at compile time, and only
+ * the id, the cycle counter and the raw 32 bit arguments go into a ring of
+ * LOG_RECORDS: a few stores and an atomic add, so the isrs and the hot paths
+ * can log. Formats are not in the firmware at all.
+ *
+ * loop() drains the ring as LOG frames (core/Frame.h) to the USB console
+ * while a host has it open, and to the ESP8266 after {"event":"log",
+ * "on":true} came over the link. log_convert.py reads the formats from this
+ * header and prints the messages between the console text, from a capture,
+ * the USB port or the link. Records overwritten before they went out are
+ * counted as lost in the next frame.
+ *
+ * The arguments are integers, and floats as %f, %e or %g: at most LOG_ARGS,
+ * no strings.
+ *
+ * LOG(QUALITY, from, to);
+ *----------------------------------------------------------------------------*/
+// Records in the ring, a power of 2, 28 bytes each in DMAMEM
+#define LOG_RECORDS 256
+#define LOG_ARGS 4
+
+// Id and format of every message, append only so old captures still read
+#define LOG_MESSAGES                                                           \
+  X(FPS, "FPS=%.2f dropped=%u busy=%u late=%u")                                \
+  X(DRAW, "draw=%u/%u/%u/%u (min/avg/max/p99 us)")                             \
+  X(TRANSPOSE, "transpose=%u/%u/%u/%u (min/avg/max/p99 us)")                   \
+  X(SLACK, "slack=%u/%u/%u/%u (min/avg/max/p99 us)")                           \
+  X(WAIT, "wait=%u/%u/%u/%u (min/avg/max/p99 us)")                             \
+  X(QUALITY, "Quality %u -> %u")                                               \
+  X(CALIBRATION, "Calibration: %u leds masked")                                \
+  X(TIME, "Time: %u.%06u")                                                     \
+  X(JSON_ERROR, "Deserialization error %u (DeserializationError)")             \
+  X(FIRMWARE_RECEIVE, "Firmware: receiving %u bytes in %u blocks")             \
+  X(FIRMWARE_OK, "Firmware: staged image ok")                                  \
+  X(FIRMWARE_BAD, "Firmware: staged image bad")                                \
+  X(DRAWLIST, "DrawList: %u commands (peak %u) %u bins %u us per flush")
+
+#define LOG(message, ...) Log::write(Log::message, ##__VA_ARGS__)
+
+class Log {
+ public:
+#define X(id, format) id,
+  enum message_t : uint16_t { LOG_MESSAGES MESSAGES };
+#undef X
+
+  struct record_t {
+    uint32_t cycles;
+    message_t id;
+    uint8_t count;
+    uint32_t args[LOG_ARGS];
+    // Index + 1 of the record once it is complete
+    std::atomic<uint32_t> stamp;
+  };
+
+  template <typename... T>
+  static void write(const message_t id, const T... args) {
+    static_assert(sizeof...(T) <= LOG_ARGS, "at most LOG_ARGS arguments");
+    const uint32_t i = head.fetch_add(1, std::memory_order_relaxed);
+    record_t &r = ring[i & (LOG_RECORDS - 1)];
+    r.cycles = ARM_DWT_CYCCNT;
+    r.id = id;
+    r.count = sizeof...(T);
+    uint32_t *a = r.args;
+    (void)a;
+    ((*a++ = raw(args)), ...);
+    r.stamp.store(i + 1, std::memory_order_release);
+  }
+
+  // Clears the ring, DMAMEM is not, before the first message
+  static void begin();
+  // Frames of the ring to the USB console and the link, from the main loop
+  static void loop();
+  // The link gets the frames as well
+  static void link(const bool on);
+
+ private:
+  static record_t ring[LOG_RECORDS];
+  static std::atomic<uint32_t> head;
+
+  static uint32_t raw(const float v) {
+    uint32_t u;
+    memcpy(&u, &v, sizeof(u));
+    return u;
+  }
+  static uint32_t raw(const double v) { return raw((float)v); }
+  template <typename T>
+  static uint32_t raw(const T v) {
+    return (uint32_t)v;
+  }
+};
+#endif
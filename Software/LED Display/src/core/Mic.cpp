@@ -0,0 +1,219 @@
+#include "Mic.h"
+
+#include <Arduino.h>
+#include <math.h>
+
+#include "Config.h"
+#if defined CUBE_MIC
+#include <DMAChannel.h>
+#include <arm_math.h>
+#endif
+/*------------------------------------------------------------------------------
+ * MIC CLASS
+ *----------------------------------------------------------------------------*/
+static_assert(!(MIC_RING & (MIC_RING - 1)) &&
+                  MIC_RING >= MIC_WINDOW + MIC_HOP,
+              "the ring is a power of 2 over a window and a hop");
+
+uint32_t Mic::windows = 0;
+uint32_t Mic::skipped = 0;
+volatile uint32_t Mic::head = 0;
+uint32_t Mic::tail = 0;
+uint16_t Mic::edges[BANDS + 1];
+uint8_t Mic::levels[BANDS] = {};
+int32_t Mic::fluxMean = 0;
+uint8_t Mic::hold = 0;
+
+#if defined CUBE_MIC
+// Captured samples of a hop, per half of the dma buffer
+#define MIC_CAPTURED (MIC_HOP * MIC_DECIMATE)
+
+static DMAChannel dma;
+DMAMEM __attribute__((aligned(32))) static int16_t capture[2 * MIC_CAPTURED];
+static int16_t ring[MIC_RING];
+// State of the CIC, it wraps around on purpose
+static uint32_t integrator[2] = {};
+static uint32_t comb[2] = {};
+static arm_rfft_fast_instance_f32 rfft;
+static float hann[MIC_WINDOW];
+static float input[MIC_WINDOW];
+static float output[MIC_WINDOW];
+static float power[MIC_WINDOW / 2];
+
+void Mic::begin() {
+  // Log spaced from bin 1 (bin 0 has dc and mains hum) to the last bin, at
+  // least one bin per band
+  const uint16_t bins = MIC_WINDOW / 2;
+  edges[0] = 1;
+  for (uint8_t i = 1; i <= BANDS; i++) {
+    uint16_t edge = lrintf(powf(bins, (float)i / BANDS));
+    if (edge <= edges[i - 1]) edge = edges[i - 1] + 1;
+    edges[i] = edge < bins ? edge : bins;
+  }
+  for (uint16_t i = 0; i < MIC_WINDOW; i++)
+    hann[i] = 0.5f - 0.5f * cosf(2 * PI * i / MIC_WINDOW);
+  arm_rfft_fast_init_f32(&rfft, MIC_WINDOW);
+
+  dma.begin(true);
+  setupPLL();
+  setupSAI();
+  // The left slot, upper 16 bits of the 32 bit word, into both halves
+  dma.TCD->SADDR = (uint8_t *)&I2S2_RDR0 + 2;
+  dma.TCD->SOFF = 0;
+  dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
+  dma.TCD->NBYTES_MLNO = 2;
+  dma.TCD->SLAST = 0;
+  dma.TCD->DADDR = capture;
+  dma.TCD->DOFF = 2;
+  dma.TCD->CITER_ELINKNO = sizeof(capture) / 2;
+  dma.TCD->DLASTSGA = -(int32_t)sizeof(capture);
+  dma.TCD->BITER_ELINKNO = sizeof(capture) / 2;
+  dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
+  dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SAI2_RX);
+  dma.attachInterrupt(isr);
+  dma.enable();
+  I2S2_RCSR = I2S_RCSR_RE | I2S_RCSR_BCE | I2S_RCSR_FRDE | I2S_RCSR_FR;
+  // The receiver runs on the clocks of the transmitter
+  I2S2_TCSR |= I2S_TCSR_TE | I2S_TCSR_BCE;
+}
+
+void Mic::loop() {
+  const uint32_t end = head;
+  if (end - tail < MIC_HOP) return;
+  // Only the newest window, a late loop skips the hops in between
+  skipped += (end - tail) / MIC_HOP - 1;
+  tail = end;
+  for (uint16_t i = 0; i < MIC_WINDOW; i++)
+    input[i] = ring[(tail - MIC_WINDOW + i) & (MIC_RING - 1)] * hann[i];
+  arm_rfft_fast_f32(&rfft, input, output, 0);
+  // Bin 0 holds dc and nyquist packed, the bands start at bin 1
+  arm_cmplx_mag_squared_f32(output, power, MIC_WINDOW / 2);
+
+  // Mean power of the bins of each band in 3 dB steps above MIC_FLOOR, the
+  // flux is the sum of the levels that rose since the hop before
+  fft_t fft = {};
+  int32_t flux = 0;
+  for (uint8_t i = 0; i < BANDS; i++) {
+    float sum = 0;
+    for (uint16_t bin = edges[i]; bin < edges[i + 1]; bin++) sum += power[bin];
+    const float mean = sum / (edges[i + 1] - edges[i]);
+    int level = 0;
+    if (mean >= 1) {
+      int exponent;
+      frexpf(mean, &exponent);
+      level = exponent - 1 - MIC_FLOOR;
+      level = level < 0 ? 0 : level > UINT8_MAX ? UINT8_MAX : level;
+    }
+    if (level > levels[i]) flux += level - levels[i];
+    levels[i] = level;
+    fft.level[i] = level > 15 ? 15 : level;
+  }
+  const int32_t threshold = (fluxMean * ONSET_RATIO >> 8) + ONSET_MIN;
+  fft.onset = !hold && flux > threshold;
+  hold = fft.onset ? ONSET_HOLD : hold ? hold - 1 : 0;
+  // Mean over about 16 hops
+  fluxMean += flux - (fluxMean >> 4);
+  // Captured here, nothing to line up with
+  fft.due = 0;
+  config.devices.publish(fft);
+  windows++;
+}
+
+// Decimates the half the dma just filled by a second order CIC, its gain is
+// MIC_DECIMATE squared
+void Mic::isr() {
+  const int16_t *at = (const int16_t *)dma.TCD->DADDR;
+  dma.clearInterrupt();
+  int16_t *half =
+      at < &capture[MIC_CAPTURED] ? &capture[MIC_CAPTURED] : capture;
+  arm_dcache_delete(half, sizeof(capture) / 2);
+  uint32_t n = head;
+  for (uint16_t i = 0; i < MIC_CAPTURED; i++) {
+    integrator[0] += half[i];
+    integrator[1] += integrator[0];
+    if (i % MIC_DECIMATE != MIC_DECIMATE - 1) continue;
+    const uint32_t first = integrator[1] - comb[0];
+    comb[0] = integrator[1];
+    const uint32_t second = first - comb[1];
+    comb[1] = first;
+    ring[n++ & (MIC_RING - 1)] =
+        (int32_t)second / (MIC_DECIMATE * MIC_DECIMATE);
+  }
+  head = n;
+  asm volatile("dsb");
+}
+
+/*******************************************************************************
+ * Audio PLL (PLL4) for the SAI2 clock root of 256 * MIC_CAPTURE Hz
+ *
+ * The root is the PLL divided by pred (1-8) and podf (1-64), the PLL runs at
+ * 24 MHz * (DIV_SELECT + NUM / DENOM) between 648 and 1300 MHz:
+ * 32 kHz -> 256 * 32000 * 4 * 20 = 655.36 MHz = 24 * (27 + 7360000/24000000)
+ ******************************************************************************/
+void Mic::setupPLL() {
+  const uint32_t pred = 4;
+  const uint32_t podf = 1 + 648000000 / (256 * MIC_CAPTURE * pred);
+  const uint32_t pll = 256 * MIC_CAPTURE * pred * podf;
+  CCM_ANALOG_PLL_AUDIO = CCM_ANALOG_PLL_AUDIO_BYPASS |
+                         CCM_ANALOG_PLL_AUDIO_ENABLE |
+                         // Divider after PLL (0=/4, 1=/2, 2=/1)
+                         CCM_ANALOG_PLL_AUDIO_POST_DIV_SELECT(2) |
+                         CCM_ANALOG_PLL_AUDIO_DIV_SELECT(pll / 24000000);
+  CCM_ANALOG_PLL_AUDIO_NUM = pll % 24000000;
+  CCM_ANALOG_PLL_AUDIO_DENOM = 24000000;
+  CCM_ANALOG_PLL_AUDIO_CLR = CCM_ANALOG_PLL_AUDIO_POWERDOWN;
+  // Wait for the PLL to lock
+  while ((CCM_ANALOG_PLL_AUDIO & CCM_ANALOG_PLL_AUDIO_LOCK) == 0) {
+  }
+  // Audio post divider /1
+  CCM_ANALOG_MISC2_CLR = CCM_ANALOG_MISC2_DIV_MSB | CCM_ANALOG_MISC2_DIV_LSB;
+  CCM_ANALOG_PLL_AUDIO_CLR = CCM_ANALOG_PLL_AUDIO_BYPASS;
+
+  CCM_CCGR5 |= CCM_CCGR5_SAI2(CCM_CCGR_ON);
+  // SAI2 root from PLL4
+  CCM_CSCMR1 = (CCM_CSCMR1 & ~CCM_CSCMR1_SAI2_CLK_SEL_MASK) |
+               CCM_CSCMR1_SAI2_CLK_SEL(2);
+  CCM_CS2CDR = (CCM_CS2CDR & ~(CCM_CS2CDR_SAI2_CLK_PRED_MASK |
+                               CCM_CS2CDR_SAI2_CLK_PODF_MASK)) |
+               CCM_CS2CDR_SAI2_CLK_PRED(pred - 1) |
+               CCM_CS2CDR_SAI2_CLK_PODF(podf - 1);
+}
+
+/*******************************************************************************
+ * SAI2 as I2S master receiver
+ *
+ * Frames of two 32 bit slots, bit clock 64 * MIC_CAPTURE (the root / 4) out
+ * of the transmitter, the receiver is synchronous to it. The right slot is
+ * masked, only the left one goes through the fifo to the dma.
+ ******************************************************************************/
+void Mic::setupSAI() {
+  CORE_PIN4_CONFIG = 2;  // SAI2_TX_BCLK
+  CORE_PIN3_CONFIG = 2;  // SAI2_TX_SYNC
+  CORE_PIN5_CONFIG = 2;  // SAI2_RX_DATA0
+  IOMUXC_SAI2_RX_DATA0_SELECT_INPUT = 0;
+
+  I2S2_TMR = 0;
+  I2S2_TCR1 = I2S_TCR1_RFW(1);
+  I2S2_TCR2 = I2S_TCR2_SYNC(0) | I2S_TCR2_BCP | I2S_TCR2_BCD |
+              I2S_TCR2_DIV(1) | I2S_TCR2_MSEL(1);
+  I2S2_TCR3 = I2S_TCR3_TCE;
+  I2S2_TCR4 = I2S_TCR4_FRSZ(1) | I2S_TCR4_SYWD(31) | I2S_TCR4_MF |
+              I2S_TCR4_FSD | I2S_TCR4_FSE | I2S_TCR4_FSP;
+  I2S2_TCR5 = I2S_TCR5_WNW(31) | I2S_TCR5_W0W(31) | I2S_TCR5_FBT(31);
+
+  I2S2_RMR = 2;
+  I2S2_RCR1 = I2S_RCR1_RFW(1);
+  I2S2_RCR2 = I2S_RCR2_SYNC(1) | I2S_RCR2_BCP | I2S_RCR2_BCD |
+              I2S_RCR2_DIV(1) | I2S_RCR2_MSEL(1);
+  I2S2_RCR3 = I2S_RCR3_RCE;
+  I2S2_RCR4 = I2S_RCR4_FRSZ(1) | I2S_RCR4_SYWD(31) | I2S_RCR4_MF |
+              I2S_RCR4_FSD | I2S_RCR4_FSE | I2S_RCR4_FSP;
+  I2S2_RCR5 = I2S_RCR5_WNW(31) | I2S_RCR5_W0W(31) | I2S_RCR5_FBT(31);
+}
+#else
+void Mic::begin() {}
+void Mic::loop() {}
+void Mic::isr() {}
+void Mic::setupPLL() {}
+void Mic::setupSAI() {}
+#endif
@@ -0,0 +1,71 @@
+#ifndef MIC_H
+#define MIC_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * MIC CLASS
+ *------------------------------------------------------------------------------
+ * An I2S MEMS microphone (INMP441, ICS-43434 or the like, L/R to ground) on
+ * SAI2 of the Teensy, so the audio no longer takes the WIO Terminal, WiFi,
+ * the ESP8266 and the UART to reach the cube. Built with CUBE_MIC
+ * (env:teensy40_mic), otherwise the calls do nothing and the FFT windows come
+ * over the link as before.
+ *
+ * The SAI clocks the mic at MIC_CAPTURE Hz from the audio PLL and a DMA
+ * channel moves the left slot into two halves of a buffer. Every half is a
+ * hop: its isr decimates it by MIC_DECIMATE with a second order CIC into a
+ * ring of samples at the 8 kHz of the WIO Terminal. loop() is a task of the
+ * main loop, so the FFT is counted and budgeted like any other task and
+ * never delays the frame: it takes the newest window of MIC_WINDOW samples,
+ * Hann windowed, through the CMSIS-DSP real FFT and maps it the way the WIO
+ * Terminal does (AudioProcessing/Processor.cpp): 64 log spaced bands from
+ * bin 1, their mean power in 3 dB steps above MIC_FLOOR as levels 0-15, and
+ * an onset when the spectral flux rises over its running mean. The window
+ * goes to config.devices due at once, the modulation bus takes it on the
+ * next frame. Hops the loop was too late for are skipped and counted.
+ *
+ * The mic takes the pins of the rotating base, a cube with a mic has no
+ * rotor (core/Rotor.h):
+ *   BCLK 4, LRCLK (WS) 3, DATA (SD) 5
+ *
+ * Mic::begin();  // setup(), once
+ * Mic::loop();   // task of the main loop
+ *----------------------------------------------------------------------------*/
+#define MIC_CAPTURE 32000
+#define MIC_DECIMATE 4
+#define MIC_WINDOW 512
+#define MIC_HOP 128
+// Decimated samples kept, a power of 2 over MIC_WINDOW + MIC_HOP
+#define MIC_RING 1024
+// Band power of level 0, log2. A full scale sine is about 2^44.
+#define MIC_FLOOR 28
+
+class Mic {
+ public:
+  // Windows analysed and hops skipped since begin()
+  static uint32_t windows;
+  static uint32_t skipped;
+
+  static void begin();
+  static void loop();
+
+ private:
+  static const uint8_t BANDS = 64;
+  // Onset when the flux is over ratio / 256 of its mean plus min, then
+  // none for hold hops
+  static const uint16_t ONSET_RATIO = 24;
+  static const uint16_t ONSET_MIN = 16;
+  static const uint8_t ONSET_HOLD = 6;
+
+  // Decimated samples written by the isr, free running
+  static volatile uint32_t head;
+  static uint32_t tail;
+  static uint16_t edges[BANDS + 1];
+  static uint8_t levels[BANDS];
+  static int32_t fluxMean;
+  static uint8_t hold;
+
+  static void isr();
+  static void setupPLL();
+  static void setupSAI();
+};
+#endif
@@ -0,0 +1,115 @@
+#include "Modulation.h"
+
+#include <math.h>
+
+#include "Schema.h"
+/*------------------------------------------------------------------------------
+ * MODULATION CLASS
+ *----------------------------------------------------------------------------*/
+float Modulation::band[BANDS] = {0};
+float Modulation::bass = 0;
+float Modulation::mid = 0;
+float Modulation::treble = 0;
+float Modulation::level = 0;
+float Modulation::beat = 0;
+uint32_t Modulation::beats = 0;
+uint32_t Modulation::seen = 0;
+fft_t Modulation::pending;
+bool Modulation::waiting = false;
+const field_t *Modulation::bound[BINDINGS] = {nullptr};
+float Modulation::base[BINDINGS];
+
+float Modulation::decay(const float dt, const float time) {
+  return time > 0 ? expf(-dt / time) : 0;
+}
+
+void Modulation::update(const float dt) {
+  const auto &settings = config.modulation;
+  const float release = decay(dt, settings.release);
+  for (uint8_t i = 0; i < BANDS; i++) band[i] *= release;
+  beat *= decay(dt, settings.beat);
+
+  // Only the latest window, the ones in between hold no more than a frame.
+  // A window that is not due yet keeps the peaks of those after it
+  fft_t fft;
+  const uint32_t sequence = config.devices.read(fft);
+  if (sequence != seen) {
+    seen = sequence;
+    if (waiting) {
+      for (uint8_t i = 0; i < BANDS; i++)
+        if (fft.level[i] > pending.level[i]) pending.level[i] = fft.level[i];
+      pending.onset |= fft.onset;
+    } else {
+      pending = fft;
+      waiting = true;
+    }
+  }
+  if (waiting && (!pending.due || (int32_t)(pending.due - millis()) <= 0)) {
+    waiting = false;
+    for (uint8_t i = 0; i < BANDS; i++) {
+      const float a = (pending.level[i] & 0x0F) / 15.0f;
+      if (a > band[i]) band[i] = a;
+    }
+    if (pending.onset) {
+      beat = 1;
+      beats++;
+    }
+  }
+
+  float sum = 0;
+  for (uint8_t i = 0; i < 8; i++) sum += band[i];
+  bass = sum / 8;
+  for (uint8_t i = 8; i < 32; i++) sum += band[i];
+  mid = (sum - bass * 8) / 24;
+  for (uint8_t i = 32; i < BANDS; i++) sum += band[i];
+  treble = (sum - (bass * 8 + mid * 24)) / 32;
+  level = sum / BANDS;
+}
+
+float Modulation::value(const modulator_t source) {
+  switch (source) {
+    case modulator_t::LEVEL:
+      return level;
+    case modulator_t::BASS:
+      return bass;
+    case modulator_t::MID:
+      return mid;
+    case modulator_t::TREBLE:
+      return treble;
+    case modulator_t::BEAT:
+      return beat;
+    default:
+      return 0;
+  }
+}
+
+void Modulation::apply() {
+  const binding_t *bindings[BINDINGS] = {
+      &config.modulation.bind0, &config.modulation.bind1,
+      &config.modulation.bind2, &config.modulation.bind3};
+  for (uint8_t i = 0; i < BINDINGS; i++) {
+    const binding_t &b = *bindings[i];
+    bound[i] = nullptr;
+    if (b.source == modulator_t::NONE || !b.depth) continue;
+    const field_t *f = Schema::find(b.path);
+    if (!f || f->type == value_t::STRING) continue;
+    // A field bound twice moves by both, and goes back to the first base
+    for (uint8_t j = 0; j < i; j++)
+      if (bound[j] == f) {
+        Schema::set(*f, Schema::get(*f) + b.depth * value(b.source));
+        f = nullptr;
+        break;
+      }
+    if (!f) continue;
+    bound[i] = f;
+    base[i] = Schema::get(*f);
+    Schema::set(*f, base[i] + b.depth * value(b.source));
+  }
+}
+
+void Modulation::restore() {
+  for (uint8_t i = 0; i < BINDINGS; i++) {
+    if (bound[i]) Schema::set(*bound[i], base[i]);
+    bound[i] = nullptr;
+  }
+}
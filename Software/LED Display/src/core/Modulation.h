@@ -0,0 +1,65 @@
+#ifndef MODULATION_H
+#define MODULATION_H
+#include <stdint.h>
+
+#include "Config.h"
+
+struct field_t;
+/*------------------------------------------------------------------------------
+ * MODULATION CLASS
+ *------------------------------------------------------------------------------
+ * The audio of the WIO Terminal once per frame for every animation: the 64
+ * fft bands smoothed, envelopes of the bass, mid and treble bands and of all
+ * of them, and a pulse on every beat. A window is taken when it is due, in
+ * step with the audio. A peak is taken at once and falls off over
+ * config.modulation.release seconds, the beat pulse over beat seconds,
+ * whatever the frame rate.
+ *
+ * Any numeric config field can follow a source without code: the bindings
+ * of config.modulation add depth times the source (0 to 1) to the field of
+ * their schema path while the animations draw and put the value back after,
+ * so the settings saved and shown are never the modulated ones. However many
+ * fields react, the bands are scanned once per frame.
+ *
+ * Modulation::update(dt);  // once per frame, see Animation::loop()
+ * Modulation::apply();
+ * uint8_t radius = 2 + 6 * Modulation::bass;  // in draw()
+ * Modulation::restore();
+ *----------------------------------------------------------------------------*/
+class Modulation {
+ public:
+  static const uint8_t BANDS = 64;
+  static const uint8_t BINDINGS = 4;
+
+  // Smoothed energy of every band, 0 to 1
+  static float band[BANDS];
+  // Envelopes of the bands 0-7, 8-31, 32-63 and all of them, 0 to 1
+  static float bass;
+  static float mid;
+  static float treble;
+  static float level;
+  // 1 on a beat falling to 0, and the beats since starting
+  static float beat;
+  static uint32_t beats;
+
+  // Take the latest fft window when due and let the envelopes fall by dt
+  static void update(const float dt);
+  static float value(const modulator_t source);
+  // Move the bound fields by their sources, and back
+  static void apply();
+  static void restore();
+
+  // Factor that makes a value fall to 1/e over time seconds, for a frame of
+  // dt seconds
+  static float decay(const float dt, const float time);
+
+ private:
+  // Windows seen and the one waiting to be due
+  static uint32_t seen;
+  static fft_t pending;
+  static bool waiting;
+  // Unmodulated values of the bound fields, nullptr when not applied
+  static const field_t *bound[BINDINGS];
+  static float base[BINDINGS];
+};
+#endif
@@ -0,0 +1,76 @@
+#include "Net.h"
+
+#include <Arduino.h>
+
+#include "Config.h"
+#include "Frame.h"
+#include "Voxels.h"
+#if defined CUBE_ETHERNET
+#include <QNEthernet.h>
+
+using namespace qindesign::network;
+#endif
+/*------------------------------------------------------------------------------
+ * NET CLASS
+ *----------------------------------------------------------------------------*/
+// The frames and commands of the ESP8266 link, see ESP8266.cpp
+void execute(frame_t type, uint8_t* payload, uint16_t size);
+
+uint32_t Net::datagrams = 0;
+uint32_t Net::frames = 0;
+
+#if defined CUBE_ETHERNET
+static EthernetUDP stream;
+static EthernetServer server(NET_FRAME_PORT);
+static EthernetClient client;
+static Frame parser;
+static bool started = false;
+
+bool Net::begin() {
+  Ethernet.setHostname(config.network.hostname);
+  // DHCP runs in the background, the sockets wait for it. Without the PHY
+  // there is nothing to wait for.
+  if (!Ethernet.begin()) return true;
+  stream.begin(NET_STREAM_PORT);
+  server.begin();
+  started = true;
+  return true;
+}
+
+void Net::loop() {
+  if (!started) return;
+  // Every datagram is one chunk, the payload is read in place
+  int size;
+  while ((size = stream.parsePacket()) > 0) {
+    datagrams++;
+    Voxels::receive(stream.data(), size);
+  }
+  // One client at a time, a new one takes over with a fresh parser
+  EthernetClient next = server.accept();
+  if (next) {
+    client.stop();
+    client = next;
+    parser = Frame();
+  }
+  if (!client.connected()) return;
+  uint8_t chunk[512];
+  uint32_t budget = NET_RX_BYTES;
+  int available;
+  while (budget > 0 && (available = client.available()) > 0) {
+    size_t n = available < (int)sizeof(chunk) ? available : sizeof(chunk);
+    if (n > budget) n = budget;
+    n = client.read(chunk, n);
+    if (n == 0) break;
+    budget -= n;
+    for (size_t i = 0; i < n; i++) {
+      if (parser.feed(chunk[i]) == Frame::FRAME) {
+        frames++;
+        execute(parser.type(), parser.payload(), parser.size());
+      }
+    }
+  }
+}
+#else
+bool Net::begin() { return true; }
+void Net::loop() {}
+#endif
@@ -0,0 +1,36 @@
+#ifndef NET_H
+#define NET_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * NET CLASS
+ *------------------------------------------------------------------------------
+ * Native Ethernet of the Teensy 4.1 (QNEthernet), a streaming and control
+ * path beside the ESP8266 that skips its UART. Built with CUBE_ETHERNET
+ * (env:teensy41), on the Teensy 4.0 the calls do nothing.
+ *
+ * UDP port NET_STREAM_PORT takes the live voxel chunks the ESP8266 takes,
+ * one chunk per datagram (core/Voxels.h). A TCP client on NET_FRAME_PORT
+ * sends binary link frames as on USB (core/USB.h), JSON frames are commands.
+ * At 100 Mbit a full RGB frame takes about a millisecond.
+ *
+ * The address comes from DHCP under config.network.hostname, begin() only
+ * starts it, so it is a boot stage and the link can come and go later.
+ *
+ * Net::begin();  // boot stage, once
+ * Net::loop();   // every main loop
+ *----------------------------------------------------------------------------*/
+#define NET_STREAM_PORT 7000
+#define NET_FRAME_PORT 7001
+// Receive budget of one loop() call on the TCP client
+#define NET_RX_BYTES 16384
+
+class Net {
+ public:
+  // Voxel datagrams and link frames received
+  static uint32_t datagrams;
+  static uint32_t frames;
+
+  static bool begin();
+  static void loop();
+};
+#endif
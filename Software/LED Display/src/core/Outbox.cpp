@@ -0,0 +1,140 @@
+#include "Outbox.h"
+
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * OUTBOX CLASS
+ *----------------------------------------------------------------------------*/
+static_assert(!(OUTBOX_CONTROL & (OUTBOX_CONTROL - 1)) &&
+                  !(OUTBOX_REPLY & (OUTBOX_REPLY - 1)) &&
+                  !(OUTBOX_BULK & (OUTBOX_BULK - 1)),
+              "the rings are powers of 2");
+// A message is its length, 16 bit, and its bytes
+static const uint8_t LENGTH = 2;
+
+DMAMEM static uint8_t control_ring[OUTBOX_CONTROL];
+DMAMEM static uint8_t reply_ring[OUTBOX_REPLY];
+DMAMEM static uint8_t bulk_ring[OUTBOX_BULK];
+
+Outbox::ring_t Outbox::rings[PRIORITIES] = {
+    {control_ring, OUTBOX_CONTROL, 0, 0},
+    {reply_ring, OUTBOX_REPLY, 0, 0},
+    {bulk_ring, OUTBOX_BULK, 0, 0}};
+Outbox::stats_t Outbox::counts = {};
+Print *Outbox::port = nullptr;
+Outbox::priority_t Outbox::current = CONTROL;
+uint16_t Outbox::left = 0;
+
+void Outbox::begin(Print &p) { port = &p; }
+
+bool Outbox::push(const priority_t priority, const void *data,
+                  const uint16_t size) {
+  if (!reserve(priority, size)) return false;
+  put(rings[priority], data, size);
+  drain();
+  return true;
+}
+
+bool Outbox::push(const priority_t priority, const uint8_t start,
+                  const char *text, const uint8_t stop) {
+  const size_t length = strlen(text);
+  if (length > UINT16_MAX - 2 || !reserve(priority, length + 2)) return false;
+  ring_t &ring = rings[priority];
+  put(ring, &start, 1);
+  put(ring, text, length);
+  put(ring, &stop, 1);
+  drain();
+  return true;
+}
+
+uint16_t Outbox::room(const priority_t priority) {
+  const ring_t &ring = rings[priority];
+  const uint32_t used = ring.tail - ring.head;
+  return used + LENGTH < ring.size ? ring.size - used - LENGTH : 0;
+}
+
+uint32_t Outbox::queued() {
+  uint32_t bytes = 0;
+  for (const ring_t &ring : rings) bytes += ring.tail - ring.head;
+  return bytes;
+}
+
+// The length goes in first, the message is put behind it
+bool Outbox::reserve(const priority_t priority, const uint16_t size) {
+  ring_t &ring = rings[priority];
+  if (size + LENGTH > ring.size || !port) {
+    counts.dropped[priority]++;
+    return false;
+  }
+  while (room(priority) < size) {
+    if (priority != CONTROL) {
+      counts.dropped[priority]++;
+      return false;
+    }
+    drain();
+  }
+  const uint8_t length[LENGTH] = {(uint8_t)(size & 0xFF), (uint8_t)(size >> 8)};
+  put(ring, length, LENGTH);
+  const uint32_t used = ring.tail - ring.head + size;
+  if (counts.peak[priority] < used) counts.peak[priority] = used;
+  return true;
+}
+
+void Outbox::put(ring_t &ring, const void *data, const uint16_t size) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint16_t done = 0;
+  while (done < size) {
+    const uint16_t at = ring.tail & (ring.size - 1);
+    uint16_t n = ring.size - at;
+    if (n > size - done) n = size - done;
+    memcpy(&ring.data[at], &bytes[done], n);
+    ring.tail += n;
+    done += n;
+  }
+}
+
+void Outbox::drain() {
+  if (!port) return;
+  int space = port->availableForWrite();
+  while (space > 0) {
+    if (!left) {
+      uint8_t p = CONTROL;
+      while (p < PRIORITIES && rings[p].tail == rings[p].head) p++;
+      if (p == PRIORITIES) return;
+      ring_t &ring = rings[p];
+      const uint16_t mask = ring.size - 1;
+      current = (priority_t)p;
+      left = ring.data[ring.head & mask] | ring.data[(ring.head + 1) & mask]
+                                               << 8;
+      ring.head += LENGTH;
+    }
+    ring_t &ring = rings[current];
+    const uint16_t at = ring.head & (ring.size - 1);
+    uint16_t n = ring.size - at;
+    if (n > left) n = left;
+    if (n > space) n = space;
+    port->write(&ring.data[at], n);
+    ring.head += n;
+    left -= n;
+    space -= n;
+    if (!left) counts.sent[current]++;
+  }
+}
+
+void Outbox::flush() {
+  while (queued()) drain();
+  if (port) port->flush();
+}
+
+const Outbox::stats_t &Outbox::stats() { return counts; }
+
+uint32_t Outbox::dropped() {
+  uint32_t n = 0;
+  for (uint32_t d : counts.dropped) n += d;
+  return n;
+}
+
+void Outbox::footprint(Footprint::usage_t &usage) {
+  usage.add(control_ring, sizeof(control_ring));
+  usage.add(reply_ring, sizeof(reply_ring));
+  usage.add(bulk_ring, sizeof(bulk_ring));
+}
@@ -0,0 +1,84 @@
+#ifndef OUTBOX_H
+#define OUTBOX_H
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "Footprint.h"
+/*------------------------------------------------------------------------------
+ * OUTBOX CLASS
+ *------------------------------------------------------------------------------
+ * The messages to the ESP8266, queued so that sending one never waits for the
+ * UART. A message is copied whole into the ring of its priority, drain()
+ * hands the rings to the serial port as far as its write buffer takes them
+ * and the transmit interrupt of the port shifts the bytes out from there.
+ * drain() runs as a task of the main loop and after every push.
+ *
+ *   CONTROL  link rate, back pressure and firmware acks, never dropped: a
+ *            push waits for room like a flush would
+ *   REPLY    answers to a request, dropped when their ring is full
+ *   BULK     preview, telemetry, config export and soak frames, dropped when
+ *            their ring is full
+ *
+ * The rings go in order of priority, oldest first within one, but a message
+ * that started goes out whole first: the start and stop bytes of the link
+ * must not interleave. Messages sent and dropped are counted per priority.
+ *
+ * Outbox::begin(Serial1);
+ * Outbox::push(Outbox::REPLY, ESP_START, json, ESP_STOP);
+ * Outbox::push(Outbox::BULK, frame, size);
+ * Outbox::flush();  // before a rate change or a reset
+ *----------------------------------------------------------------------------*/
+// Bytes of the rings, powers of 2 in DMAMEM
+#define OUTBOX_CONTROL 256
+#define OUTBOX_REPLY 4096
+#define OUTBOX_BULK 4096
+
+class Outbox {
+ public:
+  enum priority_t : uint8_t { CONTROL, REPLY, BULK, PRIORITIES };
+
+  struct stats_t {
+    uint32_t sent[PRIORITIES];
+    uint32_t dropped[PRIORITIES];
+    // Most bytes waiting in a ring
+    uint16_t peak[PRIORITIES];
+  };
+
+  static void begin(Print &port);
+  // A message of bytes, or of text between a start and a stop byte. False
+  // when it was dropped.
+  static bool push(const priority_t priority, const void *data,
+                   const uint16_t size);
+  static bool push(const priority_t priority, const uint8_t start,
+                   const char *text, const uint8_t stop);
+  // Bytes a message may have to be queued without a drop
+  static uint16_t room(const priority_t priority);
+  // Bytes waiting in all rings
+  static uint32_t queued();
+  // As much as the write buffer of the port takes, never blocks
+  static void drain();
+  // Everything out, blocks until the port sent the last byte
+  static void flush();
+  static const stats_t &stats();
+  static uint32_t dropped();
+  static void footprint(Footprint::usage_t &usage);
+
+ private:
+  struct ring_t {
+    uint8_t *data;
+    uint16_t size;
+    // Free running, only the low bits index the data
+    uint32_t head;
+    uint32_t tail;
+  };
+  static ring_t rings[PRIORITIES];
+  static stats_t counts;
+  static Print *port;
+  // Priority of the message going out and its bytes left
+  static priority_t current;
+  static uint16_t left;
+
+  static bool reserve(const priority_t priority, const uint16_t size);
+  static void put(ring_t &ring, const void *data, const uint16_t size);
+};
+#endif
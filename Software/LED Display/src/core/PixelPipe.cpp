@@ -0,0 +1,68 @@
+#include "PixelPipe.h"
+
+#include <Arduino.h>
+/*------------------------------------------------------------------------------
+ * PIXELPIPE CLASS
+ *----------------------------------------------------------------------------*/
+volatile bool PixelPipe::running = false;
+
+// Pixel formats of the PS, AS and OUT control registers (66.6.1 PXP Memory
+// Map/Register Definition)
+static const uint32_t RGB888 = 0x4;
+static const uint32_t RGB888P = 0x5;
+// Lower right corner of a surface, x in bits 29:16 and y in bits 13:0
+static inline uint32_t corner(const uint16_t x, const uint16_t y) {
+  return (uint32_t)x << 16 | y;
+}
+
+void PixelPipe::begin() {
+  CCM_CCGR2 |= CCM_CCGR2_PXP(CCM_CCGR_ON);
+  PXP_CTRL_SET = PXP_CTRL_SFTRST;
+  PXP_CTRL_CLR = PXP_CTRL_SFTRST | PXP_CTRL_CLKGATE;
+}
+
+bool PixelPipe::blend(Color *current, const Color *previous,
+                      const uint16_t size, const uint8_t amount) {
+  if (PXP_CTRL & PXP_CTRL_ENABLE) return false;
+  // The PXP reads and writes memory, not the cache (no-op for DTCM)
+  arm_dcache_flush((void *)previous, size * sizeof(Color));
+  arm_dcache_flush_delete(current, size * sizeof(Color));
+  // A line per voxel
+  PXP_OUT_CTRL = RGB888P;
+  PXP_OUT_BUF = (uint32_t)current;
+  PXP_OUT_PITCH = sizeof(Color);
+  PXP_OUT_LRC = corner(0, size - 1);
+  // Process surface, the frame to blend, 1:1 without color key
+  PXP_PS_CTRL = RGB888;
+  PXP_PS_BUF = (uint32_t)current;
+  PXP_PS_PITCH = sizeof(Color);
+  PXP_PS_SCALE = 0x10001000;
+  PXP_PS_OFFSET = 0;
+  PXP_PS_CLRKEYLOW_0 = 0xFFFFFF;
+  PXP_PS_CLRKEYHIGH_0 = 0;
+  PXP_OUT_PS_ULC = 0;
+  PXP_OUT_PS_LRC = corner(0, size - 1);
+  // Alpha surface, the previous frame with the blend amount as global alpha
+  // (ALPHA_CTRL override)
+  PXP_AS_CTRL = RGB888 << 4 | 1 << 1 | (uint32_t)amount << 8;
+  PXP_AS_BUF = (uint32_t)previous;
+  PXP_AS_PITCH = sizeof(Color);
+  PXP_AS_CLRKEYLOW_0 = 0xFFFFFF;
+  PXP_AS_CLRKEYHIGH_0 = 0;
+  PXP_OUT_AS_ULC = 0;
+  PXP_OUT_AS_LRC = corner(0, size - 1);
+  // Rgb in and out, no color space conversion
+  PXP_CSC1_COEF0 = PXP_CSC1_COEF0_BYPASS;
+  PXP_STAT_CLR = PXP_STAT_IRQ;
+  running = true;
+  PXP_CTRL_SET = PXP_CTRL_ENABLE;
+  return true;
+}
+
+void PixelPipe::wait() {
+  if (!running) return;
+  while (!(PXP_STAT & PXP_STAT_IRQ)) {
+  }
+  PXP_STAT_CLR = PXP_STAT_IRQ;
+  running = false;
+}
@@ -0,0 +1,41 @@
+#ifndef PIXELPIPE_H
+#define PIXELPIPE_H
+#include <stdint.h>
+
+#include "power/Color.h"
+/*------------------------------------------------------------------------------
+ * PIXELPIPE CLASS
+ *------------------------------------------------------------------------------
+ * Motion blur on the pixel pipeline (PXP) of the i.MX RT1062, the cube is
+ * blended with the previous frame while the cpu does something else. The
+ * display starts it when a frame is submitted and the transpose only reads
+ * the blended frame (PIXELPIPE in Display.h).
+ *
+ * The previous frame is the alpha surface with a global alpha of the blend
+ * amount over the submitted frame as process surface, written back in place.
+ * The PXP can't read packed 24 bit pixels, so the cube goes through as a
+ * column of one pixel wide lines, 3 bytes apart. Every line reads a 32 bit
+ * pixel (the fourth byte, the next voxel, is ignored) and writes it packed.
+ * The result may differ by one from Color::blend().
+ *
+ * Brightness and gamma stay in the level table of the transpose, which is a
+ * lookup the transpose needs anyway.
+ *
+ * blend() returns false when the PXP is still busy (with a previous blend or
+ * another user such as LVGL), the transpose then blends on the cpu.
+ *----------------------------------------------------------------------------*/
+class PixelPipe {
+ public:
+  // Enable the PXP clock and reset it
+  static void begin();
+  // Start blending current towards previous by amount (as Color::blend()),
+  // false when the PXP is busy
+  static bool blend(Color *current, const Color *previous, const uint16_t size,
+                    const uint8_t amount);
+  // Wait until the blend has finished
+  static void wait();
+
+ private:
+  static volatile bool running;
+};
+#endif
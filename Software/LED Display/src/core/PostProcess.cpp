@@ -0,0 +1,130 @@
+#include "PostProcess.h"
+
+#include <string.h>
+
+#include "Display.h"
+#include "power/Math8.h"
+/*------------------------------------------------------------------------------
+ * POSTPROCESS CLASS
+ *----------------------------------------------------------------------------*/
+post_t PostProcess::stage;
+uint8_t PostProcess::plane[16][16][16];
+
+void PostProcess::set(const post_t &p) {
+  if (p.fade_r | p.fade_g | p.fade_b) {
+    stage.fade_r = p.fade_r;
+    stage.fade_g = p.fade_g;
+    stage.fade_b = p.fade_b;
+  }
+  if (p.blur) {
+    stage.blur = p.blur;
+    stage.gaussian = p.gaussian;
+  }
+  if (p.bloom) {
+    stage.bloom = p.bloom;
+    stage.threshold = p.threshold;
+    stage.radius = p.radius;
+  }
+}
+
+void PostProcess::reset() { stage = post_t(); }
+
+void PostProcess::apply() {
+  const bool faded = stage.fade_r | stage.fade_g | stage.fade_b;
+  if (!faded && !stage.blur && !stage.bloom) return;
+  // The stages work on colors, not on drawn palette indices
+  Display::resolve();
+  if (faded) fade();
+  if (!stage.blur && !stage.bloom) return;
+  for (uint8_t channel = 0; channel < 3; channel++) {
+    if (stage.blur) {
+      gather(channel, 0);
+      for (uint8_t i = 0; i < (stage.gaussian ? 3 : 1); i++) blur(stage.blur);
+      scatter(channel, 0);
+    }
+    if (stage.bloom) {
+      gather(channel, stage.threshold);
+      blur(stage.radius);
+      scatter(channel, stage.bloom);
+    }
+  }
+  occupy();
+}
+
+// Keep the brighter of the voxel and the faded voxel of the previous frame
+void PostProcess::fade() {
+  const uint8_t current = Display::cubeBuffer;
+  const uint8_t previous = Display::getPreviousBuffer();
+  for (uint8_t x = 0; x < 16; x++)
+    for (uint8_t y = 0; y < 16; y++) {
+#if defined OCCUPANCY
+      const uint16_t lit = Display::occupancy[previous][x][y];
+      Display::occupancy[current][x][y] |= lit;
+      for (uint8_t z = 0; z < 16; z++) {
+        if (!(lit & (1 << z))) continue;
+#else
+      for (uint8_t z = 0; z < 16; z++) {
+#endif
+        const Color &p = Display::at(previous, x, y, z);
+        Display::at(current, x, y, z)
+            .maximize(Color(map8(stage.fade_r, p.r), map8(stage.fade_g, p.g),
+                            map8(stage.fade_b, p.b)));
+      }
+    }
+}
+
+// Copy a color channel of the drawing buffer into the plane, minus threshold
+void PostProcess::gather(const uint8_t channel, const uint8_t threshold) {
+  const uint8_t current = Display::cubeBuffer;
+  for (uint8_t x = 0; x < 16; x++)
+    for (uint8_t y = 0; y < 16; y++)
+      for (uint8_t z = 0; z < 16; z++)
+        plane[x][y][z] = qsub8(
+            ((uint8_t *)&Display::at(current, x, y, z))[channel], threshold);
+}
+
+// Write the plane back into a color channel, or add amount / 256 of it
+void PostProcess::scatter(const uint8_t channel, const uint8_t amount) {
+  const uint8_t current = Display::cubeBuffer;
+  for (uint8_t x = 0; x < 16; x++)
+    for (uint8_t y = 0; y < 16; y++)
+      for (uint8_t z = 0; z < 16; z++) {
+        uint8_t &c = ((uint8_t *)&Display::at(current, x, y, z))[channel];
+        c = amount ? qadd8(c, map8(amount, plane[x][y][z])) : plane[x][y][z];
+      }
+}
+
+// Box filter of 16 values stride apart as running sum, zero outside the cube
+static void box(uint8_t *p, const uint16_t stride, const uint8_t r,
+                const uint32_t inverse) {
+  uint8_t in[16];
+  for (uint8_t i = 0; i < 16; i++) in[i] = p[i * stride];
+  uint16_t sum = 0;
+  for (uint8_t i = 0; i <= r && i < 16; i++) sum += in[i];
+  for (uint8_t i = 0; i < 16; i++) {
+    p[i * stride] = (sum * inverse) >> 16;
+    if (i + r + 1 < 16) sum += in[i + r + 1];
+    if (i >= r) sum -= in[i - r];
+  }
+}
+
+// Separable box blur of the plane along z, y and x
+void PostProcess::blur(const uint8_t radius) {
+  const uint8_t r = radius < 15 ? radius : 15;
+  // Rounded up, a full window still gives at most 255
+  const uint32_t inverse = (65536 + 2 * r) / (2 * r + 1);
+  uint8_t *p = &plane[0][0][0];
+  for (uint16_t i = 0; i < 256; i++) box(p + i * 16, 1, r, inverse);
+  for (uint8_t x = 0; x < 16; x++)
+    for (uint8_t z = 0; z < 16; z++) box(p + x * 256 + z, 16, r, inverse);
+  for (uint8_t y = 0; y < 16; y++)
+    for (uint8_t z = 0; z < 16; z++) box(p + y * 16 + z, 256, r, inverse);
+}
+
+// Blurred light can be anywhere, mark every column of the drawing buffer
+void PostProcess::occupy() {
+#if defined OCCUPANCY
+  memset(Display::occupancy[Display::cubeBuffer], 0xFF,
+         sizeof(Display::occupancy[0]));
+#endif
+}
@@ -0,0 +1,42 @@
+#ifndef POSTPROCESS_H
+#define POSTPROCESS_H
+#include <stdint.h>
+
+#include "Config.h"
+/*------------------------------------------------------------------------------
+ * POSTPROCESS CLASS
+ *------------------------------------------------------------------------------
+ * Whole cube effects applied after all animations have drawn and before the
+ * frame is submitted. Animations enable stages every frame with set(), like
+ * the motion blur, Animation::loop() turns them off again before drawing.
+ *
+ * fade   keeps part of the previous frame per color channel, trails of red
+ *        can outlast green and blue
+ * blur   separable box blur, three boxes approximate a gaussian
+ * bloom  blurs the levels above a threshold and adds them back as glow
+ *
+ * Blur and bloom filter one color channel at a time along x, y and z with a
+ * running sum, so the cost does not depend on the radius. Light leaving the
+ * cube is lost.
+ *----------------------------------------------------------------------------*/
+class PostProcess {
+ private:
+  static post_t stage;
+  // One color channel of the cube in (x, y, z) order
+  static uint8_t plane[16][16][16];
+
+ public:
+  // Enable the stages of p, stages already enabled this frame stay on
+  static void set(const post_t &p);
+  static void reset();
+  // Apply the enabled stages to the drawing buffer
+  static void apply();
+
+ private:
+  static void fade();
+  static void gather(const uint8_t channel, const uint8_t threshold);
+  static void scatter(const uint8_t channel, const uint8_t amount);
+  static void blur(const uint8_t radius);
+  static void occupy();
+};
+#endif
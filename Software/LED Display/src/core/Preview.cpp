@@ -0,0 +1,99 @@
+#include "Preview.h"
+
+#include <string.h>
+
+#include "Display.h"
+
+DMAMEM uint16_t Preview::image[VIEWS][SIZE * SIZE];
+uint16_t Preview::cells[VIEWS][CELLS][CELLS];
+
+static inline uint16_t rgb565(const Color &c) {
+  return (c.r & 0xF8) << 8 | (c.g & 0xFC) << 3 | c.b >> 3;
+}
+
+// Keep the brightest voxel of a cell
+static inline void keep(uint16_t &cell, uint16_t &level, const uint16_t color,
+                        const uint16_t sum) {
+  if (sum <= level) return;
+  level = sum;
+  cell = color;
+}
+
+uint16_t Preview::update(uint16_t changed[VIEWS][CELLS]) {
+  // Brightest voxel of every cell and its color
+  static uint16_t next[VIEWS][CELLS][CELLS];
+  static uint16_t level[VIEWS][CELLS][CELLS];
+  static bool cleared = false;
+  if (!cleared) {
+    memset(image, 0, sizeof(image));
+    cleared = true;
+  }
+  memset(next, 0, sizeof(next));
+  memset(level, 0, sizeof(level));
+  const uint8_t buffer = Display::getPreviousBuffer();
+  for (uint8_t x = 0; x < CELLS; x++) {
+    for (uint8_t y = 0; y < CELLS; y++) {
+#if defined OCCUPANCY
+      uint16_t column = Display::occupancy[buffer][x][y];
+#else
+      uint16_t column = 0xFFFF;
+#endif
+      while (column) {
+        const uint8_t z = __builtin_ctz(column);
+        column &= column - 1;
+        const Color &c = Display::at(buffer, x, y, z);
+        const uint16_t sum = c.r + c.g + c.b;
+        if (!sum) continue;
+        const uint16_t color = rgb565(c);
+        // Top looks down z, front along y, side along x, y and z up
+        keep(next[0][CELLS - 1 - y][x], level[0][CELLS - 1 - y][x], color, sum);
+        keep(next[1][CELLS - 1 - z][x], level[1][CELLS - 1 - z][x], color, sum);
+        keep(next[2][CELLS - 1 - z][y], level[2][CELLS - 1 - z][y], color, sum);
+      }
+    }
+  }
+
+  // Scale up the cells that changed
+  uint16_t count = 0;
+  for (uint8_t view = 0; view < VIEWS; view++) {
+    for (uint8_t v = 0; v < CELLS; v++) {
+      changed[view][v] = 0;
+      for (uint8_t u = 0; u < CELLS; u++) {
+        const uint16_t color = next[view][v][u];
+        if (color == cells[view][v][u]) continue;
+        cells[view][v][u] = color;
+        changed[view][v] |= 1 << u;
+        count++;
+        uint16_t *p = &image[view][v * SCALE * SIZE + u * SCALE];
+        for (uint8_t j = 0; j < SCALE; j++, p += SIZE)
+          for (uint8_t i = 0; i < SCALE; i++) p[i] = color;
+      }
+    }
+  }
+  return count;
+}
+
+void Preview::top(uint16_t cells[CELLS][CELLS]) {
+  uint16_t level[CELLS][CELLS];
+  memset(cells, 0, sizeof(uint16_t) * CELLS * CELLS);
+  memset(level, 0, sizeof(level));
+  const uint8_t buffer = Display::getPreviousBuffer();
+  for (uint8_t x = 0; x < CELLS; x++) {
+    for (uint8_t y = 0; y < CELLS; y++) {
+#if defined OCCUPANCY
+      uint16_t column = Display::occupancy[buffer][x][y];
+#else
+      uint16_t column = 0xFFFF;
+#endif
+      while (column) {
+        const uint8_t z = __builtin_ctz(column);
+        column &= column - 1;
+        const Color &c = Display::at(buffer, x, y, z);
+        const uint16_t sum = c.r + c.g + c.b;
+        if (sum)
+          keep(cells[CELLS - 1 - y][x], level[CELLS - 1 - y][x], rgb565(c),
+               sum);
+      }
+    }
+  }
+}
@@ -0,0 +1,40 @@
+#ifndef PREVIEW_H
+#define PREVIEW_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * PREVIEW CLASS
+ *------------------------------------------------------------------------------
+ * Maximum intensity projections of the last frame on the cube for the LCD:
+ * the top (x, y), front (x, z) and side (y, z) view, every voxel a cell of
+ * SCALE x SCALE pixels in an RGB565 image. Only columns marked in the
+ * occupancy of the frame are read, an empty column costs a word. A cell is
+ * only scaled up again when its color changed, update() returns those cells
+ * so the GUI invalidates just them and the differential update of the
+ * ILI9341_T4 driver sends just their pixels. A dense frame takes about 100
+ * us, an empty one about 5.
+ *
+ * top() projects just the top view for the preview stream of the ESP8266,
+ * without touching the images of the LCD.
+ *
+ * uint16_t changed[Preview::VIEWS][16];
+ * if (Preview::update(changed)) ... bit u of changed[view][v] is cell (u, v)
+ *----------------------------------------------------------------------------*/
+class Preview {
+ public:
+  static const uint8_t VIEWS = 3;
+  static const uint8_t CELLS = 16;
+  static const uint8_t SCALE = 4;
+  static const uint8_t SIZE = CELLS * SCALE;
+  // Images of the views, SIZE x SIZE RGB565 pixels row by row (24 KB)
+  static uint16_t image[VIEWS][SIZE * SIZE];
+
+  // Project the last transposed frame, returns the amount of changed cells
+  static uint16_t update(uint16_t changed[VIEWS][CELLS]);
+  // The top view of the last transposed frame, cells[v][u] like the LCD
+  static void top(uint16_t cells[CELLS][CELLS]);
+
+ private:
+  // Projections of the last update, the color of every cell
+  static uint16_t cells[VIEWS][CELLS][CELLS];
+};
+#endif
@@ -0,0 +1,48 @@
+#include "Programs.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+
+#include "Config.h"
+/*------------------------------------------------------------------------------
+ * PROGRAMS CLASS
+ *----------------------------------------------------------------------------*/
+uint32_t Programs::revision = 0;
+
+bool Programs::path(const char *name, char *out, const uint8_t size) {
+  uint8_t n = 0;
+  for (; name[n]; n++) {
+    const char c = name[n];
+    if (n == 23 || !(isalnum(c) || c == '-' || c == '_')) return false;
+  }
+  return n && snprintf(out, size, "%s.vm", name) < size;
+}
+
+bool Programs::store(const char *name, const uint8_t *data,
+                     const uint16_t size) {
+  static Bytecode check;
+  char file[32];
+  FS *fs = config.filesystem();
+  if (!fs || !path(name, file, sizeof(file)) || !check.load(data, size))
+    return false;
+  fs->remove(file);
+  File f = fs->open(file, FILE_WRITE);
+  if (!f) return false;
+  const bool written = f.write(data, size) == size;
+  f.close();
+  if (!written) fs->remove(file);
+  revision++;
+  return written;
+}
+
+bool Programs::load(const char *name, Bytecode &vm) {
+  uint8_t data[Bytecode::SIZE];
+  char file[32];
+  FS *fs = config.filesystem();
+  if (!fs || !path(name, file, sizeof(file)) || !fs->exists(file)) return false;
+  File f = fs->open(file, FILE_READ);
+  if (!f) return false;
+  const int size = f.read(data, sizeof(data));
+  f.close();
+  return size > 0 && vm.load(data, size);
+}
@@ -0,0 +1,33 @@
+#ifndef PROGRAMS_H
+#define PROGRAMS_H
+#include <stdint.h>
+
+#include "power/Bytecode.h"
+/*------------------------------------------------------------------------------
+ * PROGRAMS CLASS
+ *------------------------------------------------------------------------------
+ * Bytecode programs (see power/Bytecode.h) uploaded over the ESP8266 with a
+ * "program" command, kept as <name>.vm on the LittleFS of the config files
+ * so they survive a restart. A program is only stored when it loads, a name
+ * is up to 23 letters, digits, '-' and '_'.
+ *
+ * {"event":"program","name":"rings","code":"4d564d31..."}  (hex)
+ *
+ * revision counts the programs stored, the Program animation reloads its
+ * program when it changes.
+ *----------------------------------------------------------------------------*/
+class Programs {
+ public:
+  static uint32_t revision;
+
+  // Validate and store a program, false when it does not load or can not be
+  // written
+  static bool store(const char *name, const uint8_t *data, const uint16_t size);
+  // Load a stored program, false when there is none or it does not load
+  static bool load(const char *name, Bytecode &vm);
+
+ private:
+  // File name of a program, false for an invalid name
+  static bool path(const char *name, char *out, const uint8_t size);
+};
+#endif
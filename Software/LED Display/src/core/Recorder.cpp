@@ -0,0 +1,145 @@
+#include "Recorder.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+#include "Bus.h"
+#include "Card.h"
+#include "Display.h"
+#include "power/Memory.h"
+/*------------------------------------------------------------------------------
+ * RECORDER CLASS
+ *----------------------------------------------------------------------------*/
+// With PSRAM the buffer rides out seconds of a slow card and the index
+// keeps every keyframe of hours of recording
+#if defined CUBE_PSRAM
+static const uint32_t BUFFER = 1048576;
+static const uint32_t INDEX = 65536;
+#else
+static const uint32_t BUFFER = 16384;
+static const uint32_t INDEX = 2048;
+#endif
+
+// Encoded frames waiting for the card and the index, in RAM2 or PSRAM
+BULKMEM static uint8_t buffer[BUFFER];
+BULKMEM static uint32_t keyframes[INDEX];
+// The frame as r, g, b in [x][y][z] order and the one before it for DELTA
+DMAMEM static uint8_t rgb[2][VOXELS_COUNT * 3];
+DMAMEM static uint8_t frame[VOXEL_FILE_FRAME_MAX];
+DMAMEM static VoxelEncoder encoder;
+
+static FsFile file;
+static voxel_file_t header;
+static uint8_t current = 0;
+// Bytes put in and taken from the buffer, file offset of the next frame
+static uint32_t head = 0;
+static uint32_t tail = 0;
+static uint32_t offset = 0;
+// The frame before was dropped, the next has to be a keyframe
+static bool resync = true;
+
+uint32_t Recorder::frames = 0;
+uint32_t Recorder::dropped = 0;
+
+bool Recorder::start(const char *name) {
+  stop();
+  if (!Card::mount()) return false;
+  Card::wait();
+  if (!file.open(name, O_WRONLY | O_CREAT | O_TRUNC)) return false;
+  header = {};
+  header.magic = VOXEL_FILE_MAGIC;
+  header.version = VOXEL_FILE_VERSION;
+  header.header_size = sizeof(header);
+  header.keyframe_interval = VOXEL_FILE_KEYFRAME;
+  header.index_interval = VOXEL_FILE_KEYFRAME;
+  file.write(&header, sizeof(header));
+  frames = 0;
+  dropped = 0;
+  head = 0;
+  tail = 0;
+  offset = sizeof(header);
+  resync = true;
+  return true;
+}
+
+// Blocks until the buffer, the index and the header are on the card
+void Recorder::stop() {
+  if (!file.isOpen()) return;
+  Card::wait();
+  while (head != tail) write(head - tail);
+  header.frames = frames;
+  if (header.index_count) header.index_offset = offset;
+  file.write(keyframes, header.index_count * sizeof(uint32_t));
+  file.seekSet(0);
+  file.write(&header, sizeof(header));
+  file.close();
+}
+
+bool Recorder::recording() { return file.isOpen(); }
+
+void Recorder::capture(const uint16_t duration, const uint8_t motion_blur) {
+  if (!file.isOpen()) return;
+  Display::resolve();
+  uint8_t *now = rgb[current];
+  const uint8_t *before = rgb[current ^ 1];
+  uint8_t *p = now;
+  for (uint8_t x = 0; x < Display::width; x++)
+    for (uint8_t y = 0; y < Display::height; y++)
+      for (uint8_t z = 0; z < Display::depth; z++) {
+        const Color &c = Display::at(Display::cubeBuffer, x, y, z);
+        *p++ = c.r;
+        *p++ = c.g;
+        *p++ = c.b;
+      }
+
+  const bool key = resync || frames % VOXEL_FILE_KEYFRAME == 0;
+  const uint16_t total = encoder.encode(frame, now, before, frames, key,
+                                        duration, motion_blur);
+
+  // Without room the player would miss this frame, deltas can not follow
+  if (BUFFER - (head - tail) < total) {
+    dropped++;
+    resync = true;
+    return;
+  }
+  push(frame, total);
+  if (frames % header.index_interval == 0) index(offset);
+  offset += total;
+  frames++;
+  current ^= 1;
+  resync = false;
+}
+
+void Recorder::loop() {
+  if (!file.isOpen() || head - tail < Card::SLICE) return;
+  if (!Bus::acquire(Bus::RECORDING)) return;
+  write(Card::SLICE);
+  Bus::release(Bus::RECORDING, Card::SLICE);
+}
+
+void Recorder::push(const uint8_t *data, const uint16_t size) {
+  const uint32_t at = head % BUFFER;
+  const uint32_t n = size < BUFFER - at ? size : BUFFER - at;
+  memcpy(&buffer[at], data, n);
+  memcpy(buffer, data + n, size - n);
+  head += size;
+}
+
+// At most size bytes up to the end of the buffer
+void Recorder::write(const uint32_t size) {
+  const uint32_t at = tail % BUFFER;
+  const uint32_t n = size < BUFFER - at ? size : BUFFER - at;
+  file.write(&buffer[at], n);
+  tail += n;
+}
+
+// A full index keeps every other entry and doubles its interval
+void Recorder::index(const uint32_t at) {
+  if (header.index_count == INDEX) {
+    for (uint32_t i = 0; i < INDEX / 2; i++) keyframes[i] = keyframes[i * 2];
+    header.index_count = INDEX / 2;
+    header.index_interval *= 2;
+    if (frames % header.index_interval) return;
+  }
+  keyframes[header.index_count++] = at;
+}
@@ -0,0 +1,43 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+#include <stdint.h>
+
+#include "power/VoxelFile.h"
+/*------------------------------------------------------------------------------
+ * RECORDER CLASS
+ *------------------------------------------------------------------------------
+ * Records the composited frames of Animation::loop() to a voxel file on the
+ * SD card (power/VoxelFile.h). Every frame is encoded as the smallest of an
+ * RGB, a palette and RLE or a DELTA chunk (power/VoxelCodec.h), most frames
+ * of Plasma or Life take 1 to 4 KB instead of 12.
+ *
+ * capture() encodes into a write buffer of 16 KB, loop() writes it to the
+ * card a slice at a time while the SPI bus is free. When the card falls
+ * behind a frame is dropped and the next one becomes a keyframe, so the file
+ * stays playable. stop() writes what is left, the index and the header.
+ *
+ * Recorder::start("plasma.vox");
+ * ... Animation::loop() calls capture(), main loop calls loop() ...
+ * Recorder::stop();
+ *----------------------------------------------------------------------------*/
+class Recorder {
+ public:
+  // Frames written and frames dropped since start()
+  static uint32_t frames;
+  static uint32_t dropped;
+
+  // Create the file and record from the next frame on, false without card
+  static bool start(const char *name);
+  static void stop();
+  static bool recording();
+  // Encode the frame about to be submitted, duration in ms
+  static void capture(const uint16_t duration, const uint8_t motion_blur);
+  // Write buffered frames to the card, call every main loop
+  static void loop();
+
+ private:
+  static void push(const uint8_t *data, const uint16_t size);
+  static void write(const uint32_t size);
+  static void index(const uint32_t at);
+};
+#endif
@@ -0,0 +1,148 @@
+#include "Replay.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "Bus.h"
+#include "Card.h"
+#include "power/Memory.h"
+/*------------------------------------------------------------------------------
+ * REPLAY CLASS
+ *----------------------------------------------------------------------------*/
+static const uint32_t BLOCK = 16384;
+// A second of frames or so, with PSRAM about a minute of a typical recording
+// so SD card hiccups never reach the display
+#if defined CUBE_PSRAM
+static const uint32_t RING = 64 * BLOCK;
+#else
+static const uint32_t RING = 2 * BLOCK;
+#endif
+
+// Read ahead blocks in RAM2 or PSRAM and a frame copied together
+BULKMEM static uint8_t blocks[RING];
+DMAMEM static uint8_t joined[VOXEL_FILE_FRAME_MAX];
+static Color palette[256];
+
+static FsFile file;
+static voxel_file_t header;
+// Bytes read into and taken from the blocks, file offset of the next read
+// and the end of the frames
+static uint32_t head = 0;
+static uint32_t tail = 0;
+static uint32_t position = 0;
+static uint32_t limit = 0;
+
+uint32_t Replay::underruns = 0;
+
+// Drop what was read ahead and continue reading from a file offset
+static void restart(const uint32_t at) {
+  Card::wait();
+  file.seekSet(at);
+  position = at;
+  head = 0;
+  tail = 0;
+}
+
+bool Replay::open(const char *name) {
+  close();
+  if (!Card::mount()) return false;
+  Card::wait();
+  if (!file.open(name, O_RDONLY)) return false;
+  if (file.read(&header, sizeof(header)) != sizeof(header) ||
+      header.magic != VOXEL_FILE_MAGIC ||
+      header.version != VOXEL_FILE_VERSION ||
+      header.header_size < sizeof(header)) {
+    file.close();
+    return false;
+  }
+  limit = header.index_count ? header.index_offset : file.fileSize();
+  std::fill(palette, palette + 256, Color::BLACK);
+  underruns = 0;
+  restart(header.header_size);
+  return true;
+}
+
+void Replay::close() {
+  if (!file.isOpen()) return;
+  Card::wait();
+  file.close();
+}
+
+bool Replay::is_open() { return file.isOpen(); }
+
+bool Replay::ended() {
+  return !file.isOpen() || (position >= limit && head == tail);
+}
+
+uint32_t Replay::frames() { return file.isOpen() ? header.frames : 0; }
+
+uint32_t Replay::seek(const uint32_t frame) {
+  if (!file.isOpen()) return 0;
+  if (!header.index_count) {
+    restart(header.header_size);
+    return 0;
+  }
+  uint32_t entry = frame / header.index_interval;
+  if (entry >= header.index_count) entry = header.index_count - 1;
+  uint32_t at = header.header_size;
+  Card::wait();
+  file.seekSet(header.index_offset + entry * sizeof(uint32_t));
+  file.read(&at, sizeof(at));
+  restart(at);
+  return entry * header.index_interval;
+}
+
+bool Replay::next(Color *out, voxel_frame_t &frame) {
+  if (ended()) return false;
+  if (tail - head < sizeof(frame)) {
+    underruns++;
+    return false;
+  }
+  copy((uint8_t *)&frame, head, sizeof(frame));
+  const uint32_t total = sizeof(frame) + frame.size;
+  // A damaged frame ends the file
+  if (total > VOXEL_FILE_FRAME_MAX) {
+    position = limit;
+    head = tail;
+    return false;
+  }
+  if (tail - head < total) {
+    underruns++;
+    return false;
+  }
+  const uint32_t at = (head + sizeof(frame)) % RING;
+  const uint8_t *data = &blocks[at];
+  if (at + frame.size > RING) {
+    copy(joined, head + sizeof(frame), frame.size);
+    data = joined;
+  }
+  head += total;
+  return VoxelFile::decode(out, palette, data, frame.size);
+}
+
+void Replay::loop() {
+  if (!file.isOpen() || position >= limit) return;
+  if (RING - (tail - head) < Card::SLICE) return;
+  if (!Bus::acquire(Bus::PLAYBACK)) return;
+  // Slices end on a slice boundary of the blocks, never past the ring
+  const uint32_t at = tail % RING;
+  uint32_t n = Card::SLICE - at % Card::SLICE;
+  if (n > limit - position) n = limit - position;
+  const int read = file.read(&blocks[at], n);
+  Bus::release(Bus::PLAYBACK, read > 0 ? read : 0);
+  if (read <= 0) {
+    position = limit;
+    return;
+  }
+  tail += read;
+  position += read;
+}
+
+void Replay::copy(uint8_t *out, uint32_t from, const uint32_t size) {
+  from %= RING;
+  const uint32_t n = size < RING - from ? size : RING - from;
+  memcpy(out, &blocks[from], n);
+  memcpy(out + n, blocks, size - n);
+}
@@ -0,0 +1,44 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+#include <stdint.h>
+
+#include "power/Color.h"
+#include "power/VoxelFile.h"
+/*------------------------------------------------------------------------------
+ * REPLAY CLASS
+ *------------------------------------------------------------------------------
+ * Reads a voxel file from the SD card (power/VoxelFile.h) for the Playback
+ * animation. The file is read ahead into two blocks of 16 KB used as a ring,
+ * loop() reads a slice into the free part while the SPI bus is free and
+ * next() decodes frames from the part that was read. A frame that runs over
+ * the end of the second block is copied together first. Drawing never waits
+ * on the card, a frame that is not there yet counts as an underrun.
+ *
+ * open(), seek() and close() block for a few ms, they read the header, an
+ * index entry or finish the file.
+ *----------------------------------------------------------------------------*/
+class Replay {
+ public:
+  // Frames that were not read in time
+  static uint32_t underruns;
+
+  // Open a file and read its header, false without card or when invalid
+  static bool open(const char *name);
+  static void close();
+  static bool is_open();
+  // All frames have been returned by next()
+  static bool ended();
+  // Amount of frames, 0 for a file that was not closed by the recorder
+  static uint32_t frames();
+  // Continue from a keyframe at or before frame, returns its number
+  static uint32_t seek(const uint32_t frame);
+  // Decode the next frame over the previous one in out, false while it has
+  // not been read yet or after the last frame
+  static bool next(Color *out, voxel_frame_t &frame);
+  // Read ahead, call every main loop
+  static void loop();
+
+ private:
+  static void copy(uint8_t *out, uint32_t from, const uint32_t size);
+};
+#endif
@@ -0,0 +1,70 @@
+#include "Rotor.h"
+
+#include <Arduino.h>
+
+#include "Config.h"
+/*------------------------------------------------------------------------------
+ * ROTOR CLASS
+ *----------------------------------------------------------------------------*/
+volatile uint32_t Rotor::revolutions = 0;
+volatile uint32_t Rotor::indexCycles = 0;
+volatile uint32_t Rotor::periodCycles = 0;
+// Not a valid speed, the first loop() applies the config
+int16_t Rotor::speed = INT16_MIN;
+
+void Rotor::begin() {
+#if defined CUBE_MIC
+  // The pins carry the microphone, see core/Mic.h
+  return;
+#endif
+  pinMode(PWM, OUTPUT);
+  pinMode(DIR, OUTPUT);
+  pinMode(INDEX, INPUT_PULLUP);
+  // Above hearing
+  analogWriteFrequency(PWM, 20000);
+  analogWrite(PWM, 0);
+  attachInterrupt(digitalPinToInterrupt(INDEX), index, FALLING);
+}
+
+void Rotor::loop() {
+#if defined CUBE_MIC
+  return;
+#endif
+  if (config.power.motor_speed == speed) return;
+  speed = config.power.motor_speed;
+  digitalWrite(DIR, speed < 0);
+  analogWrite(PWM, speed < 0 ? -speed : speed);
+}
+
+// Bounces of the sensor right after an index are ignored (over 12000 rpm)
+void Rotor::index() {
+  const uint32_t now = ARM_DWT_CYCCNT;
+  if (revolutions && now - indexCycles < F_CPU_ACTUAL / 200) return;
+  if (revolutions) periodCycles = now - indexCycles;
+  indexCycles = now;
+  revolutions++;
+}
+
+uint32_t Rotor::period() {
+  const uint32_t cycles = periodCycles;
+  const uint32_t since = ARM_DWT_CYCCNT - indexCycles;
+  if (!cycles || since > 2 * cycles || since > F_CPU_ACTUAL) return 0;
+  return cycles / (F_CPU_ACTUAL / 1000000);
+}
+
+uint16_t Rotor::angle() {
+  const uint32_t cycles = periodCycles;
+  if (!cycles) return 0;
+  const uint32_t since = (ARM_DWT_CYCCNT - indexCycles) % cycles;
+  return ((uint64_t)since << 16) / cycles;
+}
+
+uint32_t Rotor::until(const uint16_t target) {
+  const uint16_t delta = target - angle();
+  return ((uint64_t)delta * period()) >> 16;
+}
+
+float Rotor::rpm() {
+  const uint32_t time = period();
+  return time ? 60000000.0f / time : 0;
+}
@@ -0,0 +1,51 @@
+#ifndef ROTOR_H
+#define ROTOR_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * ROTOR CLASS
+ *------------------------------------------------------------------------------
+ * The motor of the rotating base and its index sensor. The motor runs at
+ * config.power.motor_speed (-255 to 255, the sign is the direction) on a pwm
+ * and a direction pin. A hall sensor on the base pulls INDEX low once per
+ * revolution, the isr takes the cycle counter then, so the angle of the cube
+ * is known at any time in between.
+ *
+ * Angles are 0 to 65535 for a full turn, starting at the index. Without an
+ * index for a second (or two revolutions) the base counts as standing still
+ * and period() is 0.
+ *
+ * In pov mode (config.display.pov slices per revolution) the scheduler takes
+ * its frame slots from here instead of the frame rate, see Scheduler.h.
+ *
+ * Built with CUBE_MIC the pins belong to the microphone (core/Mic.h), the
+ * motor is not driven and the base counts as standing still.
+ *----------------------------------------------------------------------------*/
+class Rotor {
+ public:
+  // Revolutions since begin()
+  static volatile uint32_t revolutions;
+
+  static void begin();
+  // Apply config.power.motor_speed when it changed
+  static void loop();
+  // Time of a revolution in microseconds, 0 when not turning
+  static uint32_t period();
+  // Angle of the cube now
+  static uint16_t angle();
+  // Microseconds until the cube reaches an angle
+  static uint32_t until(const uint16_t target);
+  static float rpm();
+
+ private:
+  // Motor driver pwm and direction, index sensor (active low)
+  static const uint8_t PWM = 3;
+  static const uint8_t DIR = 4;
+  static const uint8_t INDEX = 5;
+  // Cycle count of the last index and the cycles of the last revolution
+  static volatile uint32_t indexCycles;
+  static volatile uint32_t periodCycles;
+  static int16_t speed;
+  // Index isr
+  static void index();
+};
+#endif
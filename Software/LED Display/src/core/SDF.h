@@ -0,0 +1,56 @@
+#ifndef SDF_H_
+#define SDF_H_
+#include <stdint.h>
+
+#include "core/Graphics.h"
+/*------------------------------------------------------------------------------
+ * SIGNED DISTANCE FIELD RENDERER
+ *------------------------------------------------------------------------------
+ * sdf() draws the shell of a surface given by a distance function in system
+ * coordinates (negative inside). Voxels closer than shell to the surface get
+ * the palette color at 255 * (1 - |d| / shell), so a palette starting at black
+ * fades out the shell.
+ *
+ * The cube is visited in 4x4x4 bricks and 2x2x2 sub bricks. A distance at the
+ * center of a brick changes at most lipschitz * radius towards its corners, so
+ * bricks that are entirely outside the shell (far outside or deep inside) are
+ * skipped with a single evaluation. For an exact distance lipschitz is 1,
+ * bound estimates need a larger value.
+ *
+ * sdf([&](const Vector3 &p) { return p.magnitude() - 5.0f; }, 1.5f,
+ *     LavaPalette, brightness);
+ *----------------------------------------------------------------------------*/
+// Distance from the center of a brick to its outer voxel centers
+#define SDF_BRICK 2.598f
+#define SDF_SUBBRICK 0.866f
+
+template <typename F>
+inline void sdf(F distance, const float shell, const uint8_t *palette,
+                const uint8_t scale, const float lipschitz = 1.0f) {
+  const float brick = SDF_BRICK * lipschitz;
+  const float subbrick = SDF_SUBBRICK * lipschitz;
+  for (uint8_t bx = 0; bx < 16; bx += 4)
+    for (uint8_t by = 0; by < 16; by += 4)
+      for (uint8_t bz = 0; bz < 16; bz += 4) {
+        const Vector3 b =
+            Vector3(bx + 1.5f - CX, by + 1.5f - CY, bz + 1.5f - CZ);
+        if (abs(distance(b)) - brick >= shell) continue;
+        for (uint8_t sx = bx; sx < bx + 4; sx += 2)
+          for (uint8_t sy = by; sy < by + 4; sy += 2)
+            for (uint8_t sz = bz; sz < bz + 4; sz += 2) {
+              const Vector3 s =
+                  Vector3(sx + 0.5f - CX, sy + 0.5f - CY, sz + 0.5f - CZ);
+              if (abs(distance(s)) - subbrick >= shell) continue;
+              for (uint8_t x = sx; x < sx + 2; x++)
+                for (uint8_t y = sy; y < sy + 2; y++)
+                  for (uint8_t z = sz; z < sz + 2; z++) {
+                    const float d = distance(Vector3(x - CX, y - CY, z - CZ));
+                    const float t = 1.0f - abs(d) / shell;
+                    if (t <= 0) continue;
+                    cell(x, y, z) =
+                        Color((uint8_t)(t * 255), palette).scale(scale);
+                  }
+            }
+      }
+}
+#endif
@@ -0,0 +1,140 @@
+#include "Scheduler.h"
+
+#include "Config.h"
+#include "Display.h"
+#include "Log.h"
+#include "Rotor.h"
+#include "Sync.h"
+/*------------------------------------------------------------------------------
+ * SCHEDULER CLASS
+ *----------------------------------------------------------------------------*/
+// Histograms up to 16ms with a resolution of 250us
+Histogram Scheduler::draw = Histogram(250);
+Histogram Scheduler::transpose = Histogram(250);
+Histogram Scheduler::slack = Histogram(250);
+Histogram Scheduler::wait = Histogram(250);
+uint32_t Scheduler::frames = 0;
+uint32_t Scheduler::dropped = 0;
+uint32_t Scheduler::busy = 0;
+uint32_t Scheduler::late = 0;
+uint16_t Scheduler::slice = 0;
+uint32_t Scheduler::frame = 0;
+bool Scheduler::synced = false;
+uint32_t Scheduler::frameStart = 0;
+uint32_t Scheduler::frameNext = 0;
+uint32_t Scheduler::windowStart = 0;
+uint32_t Scheduler::frameDeadline = 0;
+uint32_t Scheduler::waitStart = 0;
+
+bool Scheduler::ready() {
+  const uint32_t now = micros();
+  const uint16_t fps = config.display.fps;
+  const uint16_t slices = config.display.pov;
+  const uint32_t rotation = slices ? Rotor::period() : 0;
+  if ((fps || rotation) && (int32_t)(now - frameNext) < 0) return false;
+  // The last frame is still waiting for the transpose
+  if (!Display::available()) {
+    if (!waitStart) {
+      busy++;
+      waitStart = now | 1;
+    }
+    return false;
+  }
+  if (waitStart) {
+    wait.add(now - waitStart);
+    waitStart = 0;
+  }
+  if (!rotation) frameDeadline = 0;
+  const bool following = synced;
+  synced = !rotation && fps && Sync::locked();
+  if (rotation) {
+    // The cube is in slice current, the frame is for the next one and due
+    // when the cube reaches it
+    const uint16_t current = ((uint32_t)Rotor::angle() * slices) >> 16;
+    if (frameDeadline) dropped += (current + slices - slice) % slices;
+    slice = (current + 1) % slices;
+    // Never zero, that is no deadline
+    frameDeadline = (now + Rotor::until(((uint32_t)slice << 16) / slices)) | 1;
+    frameNext = frameDeadline;
+  } else if (synced) {
+    // The slots of all cubes are at the same shared times, a frame is drawn
+    // for the slot that has come
+    const uint32_t period = 1000000 / fps;
+    const uint64_t shared = Sync::now();
+    const uint32_t slot = shared / period;
+    const bool again = following && slot == frame;
+    if (following && slot > frame + 1) dropped += slot - frame - 1;
+    frame = slot;
+    frameNext = now + period - shared % period;
+    // The offset moved back a little, this slot has been drawn
+    if (again) return false;
+  } else if (fps) {
+    const uint32_t period = 1000000 / fps;
+    // Too late for the next slot, skip ahead instead of catching up
+    const uint32_t behind = now - frameNext;
+    if (behind >= period) {
+      // The very first frame has no previous slot to be late for
+      if (frameNext) dropped += behind / period;
+      frameNext = now + period;
+    } else {
+      frameNext += period;
+    }
+  }
+  frameStart = now;
+  return true;
+}
+
+void Scheduler::submitted() {
+  const uint32_t now = micros();
+  const uint32_t time = now - frameStart;
+  const uint16_t fps = config.display.fps;
+  const uint32_t period = fps ? 1000000 / fps : time;
+  draw.add(time);
+  transpose.add(Display::getTransposeMicros());
+  if (frameDeadline) {
+    const int32_t left = frameDeadline - now;
+    if (left < 0) late++;
+    slack.add(left > 0 ? left : 0);
+  } else {
+    slack.add(period > time ? period - time : 0);
+  }
+  frames++;
+}
+
+uint32_t Scheduler::remaining() {
+  if (!config.display.fps && !frameDeadline) return 0;
+  const int32_t left = frameNext - micros();
+  return left > 0 ? left : 0;
+}
+
+bool Scheduler::paced() { return config.display.fps || frameDeadline; }
+
+uint32_t Scheduler::shown() {
+  return millis() + (remaining() + Display::getRefreshMicros()) / 1000;
+}
+
+float Scheduler::fps() {
+  const uint32_t time = micros() - windowStart;
+  return time ? frames * 1000000.0f / time : 0;
+}
+
+void Scheduler::log() {
+  LOG(FPS, fps(), dropped, busy, late);
+  LOG(DRAW, draw.min(), draw.avg(), draw.max(), draw.percentile(99));
+  LOG(TRANSPOSE, transpose.min(), transpose.avg(), transpose.max(),
+      transpose.percentile(99));
+  LOG(SLACK, slack.min(), slack.avg(), slack.max(), slack.percentile(99));
+  LOG(WAIT, wait.min(), wait.avg(), wait.max(), wait.percentile(99));
+}
+
+void Scheduler::reset() {
+  draw.reset();
+  transpose.reset();
+  slack.reset();
+  wait.reset();
+  frames = 0;
+  dropped = 0;
+  busy = 0;
+  late = 0;
+  windowStart = micros();
+}
@@ -0,0 +1,84 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "power/Histogram.h"
+/*------------------------------------------------------------------------------
+ * SCHEDULER CLASS
+ *------------------------------------------------------------------------------
+ * Paces rendering to config.display.fps and measures every frame. A frame is
+ * started when the display is available and the next frame slot has come.
+ * Frame slots that pass without starting a frame are counted as dropped.
+ *
+ * Draw time is from starting to submitting a frame, transpose time is spent
+ * by the display isr and slack is what is left of the frame period after
+ * drawing. A frame slot that finds the last frame not yet taken by the
+ * transpose counts as busy, wait is how long it took to become available.
+ * Statistics are collected until reset(), main prints and resets them every
+ * print interval.
+ *
+ * remaining() is the time left until the next frame slot, the GUI and the
+ * background tasks (Tasks.h) use it to run only in the slack between frames. shown() is the millis() the frame
+ * being drawn reaches the leds: taken by the transpose at the next frame slot
+ * and shifted out a refresh later, input predictors extrapolate to it.
+ *
+ * With config.display.pov slices per revolution and the base turning (see
+ * Rotor.h) the frame slots are phase locked to the rotation instead: a frame
+ * is started when the cube enters a slice and is drawn for the next one,
+ * slice. Its deadline is the angle of that slice, a frame submitted after it
+ * is late and slack is the time left until it. Slices passed without a frame
+ * count as dropped.
+ *
+ * With more cubes in sync (see Sync.h) the frame slots are at the same
+ * shared times on all of them, frame is the slot of the shared clock.
+ *----------------------------------------------------------------------------*/
+class Scheduler {
+ public:
+  // Durations in microseconds of the frames since the last reset
+  static Histogram draw;
+  static Histogram transpose;
+  static Histogram slack;
+  static Histogram wait;
+  // Frames submitted and frame slots dropped since the last reset
+  static uint32_t frames;
+  static uint32_t dropped;
+  // Frame slots that found the display busy since the last reset
+  static uint32_t busy;
+  // Pov frames submitted after their deadline since the last reset
+  static uint32_t late;
+  // Slice of the revolution the pov frame is drawn for
+  static uint16_t slice;
+  // Frame slot of the shared clock of the cubes in sync, while synced
+  static uint32_t frame;
+  static bool synced;
+
+ private:
+  // Start of the current frame, the next frame slot and the last reset
+  static uint32_t frameStart;
+  static uint32_t frameNext;
+  static uint32_t windowStart;
+  // Deadline of the pov frame, zero when not in pov mode
+  static uint32_t frameDeadline;
+  // Start of waiting for the display, zero when not waiting
+  static uint32_t waitStart;
+
+ public:
+  // Check if a new frame should be drawn, starts the frame timing
+  static bool ready();
+  // Records the timing of the frame after it has been submitted
+  static void submitted();
+  // Microseconds until the next frame slot, 0 when late or not paced
+  static uint32_t remaining();
+  // Frame slots are paced by the fps or the rotation, remaining() is known
+  static bool paced();
+  // millis() the frame being drawn is on the leds
+  static uint32_t shown();
+  // Frames per second since the last reset
+  static float fps();
+  // Log the statistics of the window, see core/Log.h
+  static void log();
+  // Start a new measurement window
+  static void reset();
+};
+#endif
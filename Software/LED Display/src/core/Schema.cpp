@@ -0,0 +1,629 @@
+#include "Schema.h"
+
+#include <stddef.h>
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * SCHEMA CLASS
+ *----------------------------------------------------------------------------*/
+template <typename T>
+struct value_of;
+template <>
+struct value_of<bool> {
+  static constexpr value_t type = value_t::BOOL;
+};
+template <>
+struct value_of<uint8_t> {
+  static constexpr value_t type = value_t::UINT8;
+};
+template <>
+struct value_of<int8_t> {
+  static constexpr value_t type = value_t::INT8;
+};
+template <>
+struct value_of<uint16_t> {
+  static constexpr value_t type = value_t::UINT16;
+};
+template <>
+struct value_of<int16_t> {
+  static constexpr value_t type = value_t::INT16;
+};
+template <>
+struct value_of<float> {
+  static constexpr value_t type = value_t::FLOAT;
+};
+template <>
+struct value_of<ease_t> {
+  static constexpr value_t type = value_t::ENUM;
+};
+template <>
+struct value_of<basis_t> {
+  static constexpr value_t type = value_t::ENUM;
+};
+template <>
+struct value_of<modulator_t> {
+  static constexpr value_t type = value_t::ENUM;
+};
+template <size_t N>
+struct value_of<char[N]> {
+  static constexpr value_t type = value_t::STRING;
+};
+
+// The member designator doubles as the path of the field
+#define FIELD(m, lo, hi)                                              \
+  {                                                                   \
+    #m, offsetof(Settings, m), value_of<decltype(((Settings *)0)->m)>::type, \
+        sizeof(((Settings *)0)->m), lo, hi                              \
+  }
+
+// Keep sorted by path (strcmp order), find() depends on it. The changed and
+// play_one flags and the devices are runtime state and not in the schema.
+PROGMEM static const field_t fields[] = {
+    FIELD(animation.accelerometer.brightness, 0, 255),
+    FIELD(animation.accelerometer.motionBlur, 0, 255),
+    FIELD(animation.accelerometer.radius, 0, 32),
+    FIELD(animation.accelerometer.runtime, 0, 3600),
+    FIELD(animation.animation, 0, 255),
+    FIELD(animation.arc_scroller.brightness, 0, 255),
+    FIELD(animation.arc_scroller.endtime, 0, 60),
+    FIELD(animation.arc_scroller.motionBlur, 0, 255),
+    FIELD(animation.arc_scroller.radius, 0, 32),
+    FIELD(animation.arc_scroller.rotation_speed, -720, 720),
+    FIELD(animation.arc_scroller.runtime, 0, 3600),
+    FIELD(animation.arc_scroller.starttime, 0, 60),
+    FIELD(animation.arrows.angle_speed, -720, 720),
+    FIELD(animation.arrows.brightness, 0, 255),
+    FIELD(animation.arrows.distance, 0, 16),
+    FIELD(animation.arrows.endtime, 0, 60),
+    FIELD(animation.arrows.hue_speed, -128, 127),
+    FIELD(animation.arrows.motionBlur, 0, 255),
+    FIELD(animation.arrows.radius, 0, 32),
+    FIELD(animation.arrows.radius_start, 0, 32),
+    FIELD(animation.arrows.runtime, 0, 3600),
+    FIELD(animation.arrows.starttime, 0, 60),
+    FIELD(animation.atoms.angle_speed, -720, 720),
+    FIELD(animation.atoms.brightness, 0, 255),
+    FIELD(animation.atoms.distance, 0, 16),
+    FIELD(animation.atoms.endtime, 0, 60),
+    FIELD(animation.atoms.hue_speed, -128, 127),
+    FIELD(animation.atoms.motionBlur, 0, 255),
+    FIELD(animation.atoms.radius, 0, 32),
+    FIELD(animation.atoms.radius_start, 0, 32),
+    FIELD(animation.atoms.runtime, 0, 3600),
+    FIELD(animation.atoms.starttime, 0, 60),
+    FIELD(animation.aurora.baked, 0, 1),
+    FIELD(animation.aurora.brightness, 0, 255),
+    FIELD(animation.aurora.endtime, 0, 60),
+    FIELD(animation.aurora.motionBlur, 0, 255),
+    FIELD(animation.aurora.runtime, 0, 3600),
+    FIELD(animation.aurora.starttime, 0, 60),
+    FIELD(animation.boids.brightness, 0, 255),
+    FIELD(animation.boids.count, 1, 512),
+    FIELD(animation.boids.endtime, 0, 60),
+    FIELD(animation.boids.motionBlur, 0, 255),
+    FIELD(animation.boids.runtime, 0, 3600),
+    FIELD(animation.boids.starttime, 0, 60),
+    FIELD(animation.box_scroller.brightness, 0, 255),
+    FIELD(animation.box_scroller.endtime, 0, 60),
+    FIELD(animation.box_scroller.hue_speed, -128, 127),
+    FIELD(animation.box_scroller.interval, 0, 10),
+    FIELD(animation.box_scroller.motionBlur, 0, 255),
+    FIELD(animation.box_scroller.runtime, 0, 3600),
+    FIELD(animation.box_scroller.starttime, 0, 60),
+    FIELD(animation.cache, 0, 1),
+    FIELD(animation.crossfade, 0, 1),
+    FIELD(animation.cube.angle_speed, -720, 720),
+    FIELD(animation.cube.brightness, 0, 255),
+    FIELD(animation.cube.distance, 0, 16),
+    FIELD(animation.cube.endtime, 0, 60),
+    FIELD(animation.cube.hue_speed, -128, 127),
+    FIELD(animation.cube.motionBlur, 0, 255),
+    FIELD(animation.cube.radius, 0, 32),
+    FIELD(animation.cube.radius_start, 0, 32),
+    FIELD(animation.cube.runtime, 0, 3600),
+    FIELD(animation.cube.starttime, 0, 60),
+    FIELD(animation.dna.brightness, 0, 255),
+    FIELD(animation.dna.endtime, 0, 60),
+    FIELD(animation.dna.motionBlur, 0, 255),
+    FIELD(animation.dna.runtime, 0, 3600),
+    FIELD(animation.dna.starttime, 0, 60),
+    FIELD(animation.ease, 0, 2),
+    FIELD(animation.explosion.brightness, 0, 255),
+    FIELD(animation.explosion.endtime, 0, 60),
+    FIELD(animation.explosion.motionBlur, 0, 255),
+    FIELD(animation.explosion.runtime, 0, 3600),
+    FIELD(animation.explosion.starttime, 0, 60),
+    FIELD(animation.fireflies.brightness, 0, 255),
+    FIELD(animation.fireflies.endtime, 0, 60),
+    FIELD(animation.fireflies.motionBlur, 0, 255),
+    FIELD(animation.fireflies.runtime, 0, 3600),
+    FIELD(animation.fireflies.starttime, 0, 60),
+    FIELD(animation.fireworks.brightness, 0, 255),
+    FIELD(animation.fireworks.motionBlur, 0, 255),
+    FIELD(animation.fireworks.post.bloom, 0, 255),
+    FIELD(animation.fireworks.post.blur, 0, 15),
+    FIELD(animation.fireworks.post.fade_b, 0, 255),
+    FIELD(animation.fireworks.post.fade_g, 0, 255),
+    FIELD(animation.fireworks.post.fade_r, 0, 255),
+    FIELD(animation.fireworks.post.gaussian, 0, 1),
+    FIELD(animation.fireworks.post.radius, 0, 15),
+    FIELD(animation.fireworks.post.threshold, 0, 255),
+    FIELD(animation.fireworks.radius, 0, 32),
+    FIELD(animation.fireworks.runtime, 0, 3600),
+    FIELD(animation.fountain.brightness, 0, 255),
+    FIELD(animation.fountain.endtime, 0, 60),
+    FIELD(animation.fountain.motionBlur, 0, 255),
+    FIELD(animation.fountain.runtime, 0, 3600),
+    FIELD(animation.fountain.starttime, 0, 60),
+    FIELD(animation.galaxy.brightness, 0, 255),
+    FIELD(animation.galaxy.endtime, 0, 60),
+    FIELD(animation.galaxy.motionBlur, 0, 255),
+    FIELD(animation.galaxy.runtime, 0, 3600),
+    FIELD(animation.galaxy.starttime, 0, 60),
+    FIELD(animation.globe.brightness, 0, 255),
+    FIELD(animation.globe.endtime, 0, 60),
+    FIELD(animation.globe.motionBlur, 0, 255),
+    FIELD(animation.globe.runtime, 0, 3600),
+    FIELD(animation.globe.starttime, 0, 60),
+    FIELD(animation.heart.brightness, 0, 255),
+    FIELD(animation.heart.endtime, 0, 60),
+    FIELD(animation.heart.motionBlur, 0, 255),
+    FIELD(animation.heart.runtime, 0, 3600),
+    FIELD(animation.heart.starttime, 0, 60),
+    FIELD(animation.helix.angle, 0, 360),
+    FIELD(animation.helix.angle_speed, -720, 720),
+    FIELD(animation.helix.brightness, 0, 255),
+    FIELD(animation.helix.hue_speed, -128, 127),
+    FIELD(animation.helix.interval, 0, 10),
+    FIELD(animation.helix.motionBlur, 0, 255),
+    FIELD(animation.helix.phase_speed, -20, 20),
+    FIELD(animation.helix.radius, 0, 32),
+    FIELD(animation.helix.resolution, 1, 100),
+    FIELD(animation.helix.runtime, 0, 3600),
+    FIELD(animation.helix.thickness, 0, 255),
+    FIELD(animation.hourglass.brightness, 0, 255),
+    FIELD(animation.hourglass.endtime, 0, 60),
+    FIELD(animation.hourglass.motionBlur, 0, 255),
+    FIELD(animation.hourglass.runtime, 0, 3600),
+    FIELD(animation.hourglass.starttime, 0, 60),
+    FIELD(animation.hourglass.steps, 1, 60),
+    FIELD(animation.interference.brightness, 0, 255),
+    FIELD(animation.interference.endtime, 0, 60),
+    FIELD(animation.interference.motionBlur, 0, 255),
+    FIELD(animation.interference.runtime, 0, 3600),
+    FIELD(animation.interference.starttime, 0, 60),
+    FIELD(animation.kaleidoscope.basis, 0, 1),
+    FIELD(animation.kaleidoscope.brightness, 0, 255),
+    FIELD(animation.kaleidoscope.endtime, 0, 60),
+    FIELD(animation.kaleidoscope.motionBlur, 0, 255),
+    FIELD(animation.kaleidoscope.runtime, 0, 3600),
+    FIELD(animation.kaleidoscope.starttime, 0, 60),
+    FIELD(animation.lavalamp.brightness, 0, 255),
+    FIELD(animation.lavalamp.endtime, 0, 60),
+    FIELD(animation.lavalamp.motionBlur, 0, 255),
+    FIELD(animation.lavalamp.runtime, 0, 3600),
+    FIELD(animation.lavalamp.starttime, 0, 60),
+    FIELD(animation.life.brightness, 0, 255),
+    FIELD(animation.life.cycles, 0, 255),
+    FIELD(animation.life.interval, 0, 10),
+    FIELD(animation.life.motionBlur, 0, 255),
+    FIELD(animation.life.runtime, 0, 3600),
+    FIELD(animation.lorenz.attractor, 0, 3),
+    FIELD(animation.lorenz.brightness, 0, 255),
+    FIELD(animation.lorenz.endtime, 0, 60),
+    FIELD(animation.lorenz.motionBlur, 0, 255),
+    FIELD(animation.lorenz.runtime, 0, 3600),
+    FIELD(animation.lorenz.starttime, 0, 60),
+    FIELD(animation.mario.angle_speed, -720, 720),
+    FIELD(animation.mario.brightness, 0, 255),
+    FIELD(animation.mario.endtime, 0, 60),
+    FIELD(animation.mario.interval, 0, 10),
+    FIELD(animation.mario.motionBlur, 0, 255),
+    FIELD(animation.mario.radius, 0, 32),
+    FIELD(animation.mario.radius_start, 0, 32),
+    FIELD(animation.mario.runtime, 0, 3600),
+    FIELD(animation.mario.starttime, 0, 60),
+    FIELD(animation.matrix.brightness, 0, 255),
+    FIELD(animation.matrix.endtime, 0, 60),
+    FIELD(animation.matrix.motionBlur, 0, 255),
+    FIELD(animation.matrix.runtime, 0, 3600),
+    FIELD(animation.matrix.starttime, 0, 60),
+    FIELD(animation.maze.brightness, 0, 255),
+    FIELD(animation.maze.budget, 1, 4096),
+    FIELD(animation.maze.endtime, 0, 60),
+    FIELD(animation.maze.motionBlur, 0, 255),
+    FIELD(animation.maze.runtime, 0, 3600),
+    FIELD(animation.maze.starttime, 0, 60),
+    FIELD(animation.moebius.brightness, 0, 255),
+    FIELD(animation.moebius.endtime, 0, 60),
+    FIELD(animation.moebius.motionBlur, 0, 255),
+    FIELD(animation.moebius.runtime, 0, 3600),
+    FIELD(animation.moebius.starttime, 0, 60),
+    FIELD(animation.ocean.amplitude, 0, 8),
+    FIELD(animation.ocean.brightness, 0, 255),
+    FIELD(animation.ocean.damping, 1, 15),
+    FIELD(animation.ocean.endtime, 0, 60),
+    FIELD(animation.ocean.interval, 0, 10),
+    FIELD(animation.ocean.motionBlur, 0, 255),
+    FIELD(animation.ocean.runtime, 0, 3600),
+    FIELD(animation.ocean.starttime, 0, 60),
+    FIELD(animation.plasma.baked, 0, 1),
+    FIELD(animation.plasma.basis, 0, 1),
+    FIELD(animation.plasma.brightness, 0, 255),
+    FIELD(animation.plasma.endtime, 0, 60),
+    FIELD(animation.plasma.hue_speed, -128, 127),
+    FIELD(animation.plasma.motionBlur, 0, 255),
+    FIELD(animation.plasma.runtime, 0, 3600),
+    FIELD(animation.plasma.scale_p, 0, 1),
+    FIELD(animation.plasma.speed_offset_speed, 0, 1),
+    FIELD(animation.plasma.speed_w, 0, 2),
+    FIELD(animation.plasma.speed_x, 0, 2),
+    FIELD(animation.plasma.speed_y, 0, 2),
+    FIELD(animation.plasma.speed_z, 0, 2),
+    FIELD(animation.plasma.starttime, 0, 60),
+    FIELD(animation.playback.brightness, 0, 255),
+    FIELD(animation.playback.endtime, 0, 60),
+    FIELD(animation.playback.file, 0, 0),
+    FIELD(animation.playback.runtime, 0, 3600),
+    FIELD(animation.playback.start, 0, 65535),
+    FIELD(animation.playback.starttime, 0, 60),
+    FIELD(animation.pong.brightness, 0, 255),
+    FIELD(animation.pong.endtime, 0, 60),
+    FIELD(animation.pong.hue_speed, -128, 127),
+    FIELD(animation.pong.motionBlur, 0, 255),
+    FIELD(animation.pong.runtime, 0, 3600),
+    FIELD(animation.pong.starttime, 0, 60),
+    FIELD(animation.pong3d.brightness, 0, 255),
+    FIELD(animation.pong3d.endtime, 0, 60),
+    FIELD(animation.pong3d.motionBlur, 0, 255),
+    FIELD(animation.pong3d.runtime, 0, 3600),
+    FIELD(animation.pong3d.starttime, 0, 60),
+    FIELD(animation.program.brightness, 0, 255),
+    FIELD(animation.program.endtime, 0, 60),
+    FIELD(animation.program.motionBlur, 0, 255),
+    FIELD(animation.program.name, 0, 0),
+    FIELD(animation.program.runtime, 0, 3600),
+    FIELD(animation.program.starttime, 0, 60),
+    FIELD(animation.rain.brightness, 0, 255),
+    FIELD(animation.rain.endtime, 0, 60),
+    FIELD(animation.rain.motionBlur, 0, 255),
+    FIELD(animation.rain.runtime, 0, 3600),
+    FIELD(animation.rain.starttime, 0, 60),
+    FIELD(animation.ripple.brightness, 0, 255),
+    FIELD(animation.ripple.damping, 1, 15),
+    FIELD(animation.ripple.drop, 0, 16),
+    FIELD(animation.ripple.endtime, 0, 60),
+    FIELD(animation.ripple.interval, 0, 10),
+    FIELD(animation.ripple.motionBlur, 0, 255),
+    FIELD(animation.ripple.runtime, 0, 3600),
+    FIELD(animation.ripple.starttime, 0, 60),
+    FIELD(animation.sierpinski.brightness, 0, 255),
+    FIELD(animation.sierpinski.depth, 1, 4),
+    FIELD(animation.sierpinski.endtime, 0, 60),
+    FIELD(animation.sierpinski.fractal, 0, 2),
+    FIELD(animation.sierpinski.motionBlur, 0, 255),
+    FIELD(animation.sierpinski.runtime, 0, 3600),
+    FIELD(animation.sierpinski.starttime, 0, 60),
+    FIELD(animation.sierpinski.tumble, -720, 720),
+    FIELD(animation.sinus.brightness, 0, 255),
+    FIELD(animation.sinus.endtime, 0, 60),
+    FIELD(animation.sinus.hue_speed, -128, 127),
+    FIELD(animation.sinus.motionBlur, 0, 255),
+    FIELD(animation.sinus.phase_speed, -20, 20),
+    FIELD(animation.sinus.radius, 0, 32),
+    FIELD(animation.sinus.resolution, 1, 100),
+    FIELD(animation.sinus.runtime, 0, 3600),
+    FIELD(animation.sinus.starttime, 0, 60),
+    FIELD(animation.snake.brightness, 0, 255),
+    FIELD(animation.snake.endtime, 0, 60),
+    FIELD(animation.snake.motionBlur, 0, 255),
+    FIELD(animation.snake.runtime, 0, 3600),
+    FIELD(animation.snake.starttime, 0, 60),
+    FIELD(animation.spectrum.brightness, 0, 255),
+    FIELD(animation.spectrum.endtime, 0, 60),
+    FIELD(animation.spectrum.hue_speed, -128, 127),
+    FIELD(animation.spectrum.motionBlur, 0, 255),
+    FIELD(animation.spectrum.runtime, 0, 3600),
+    FIELD(animation.spectrum.starttime, 0, 60),
+    FIELD(animation.spirograph.brightness, 0, 255),
+    FIELD(animation.spirograph.endtime, 0, 60),
+    FIELD(animation.spirograph.motionBlur, 0, 255),
+    FIELD(animation.spirograph.runtime, 0, 3600),
+    FIELD(animation.spirograph.starttime, 0, 60),
+    FIELD(animation.starfield.body_diagonal, 0, 32),
+    FIELD(animation.starfield.brightness, 0, 255),
+    FIELD(animation.starfield.endtime, 0, 60),
+    FIELD(animation.starfield.hue_speed, -128, 127),
+    FIELD(animation.starfield.motionBlur, 0, 255),
+    FIELD(animation.starfield.phase_speed, -20, 20),
+    FIELD(animation.starfield.runtime, 0, 3600),
+    FIELD(animation.starfield.starttime, 0, 60),
+    FIELD(animation.streaming.brightness, 0, 255),
+    FIELD(animation.streaming.drop_blur, 0, 255),
+    FIELD(animation.streaming.drop_time, 0, 5),
+    FIELD(animation.streaming.endtime, 0, 60),
+    FIELD(animation.streaming.motionBlur, 0, 255),
+    FIELD(animation.streaming.runtime, 0, 3600),
+    FIELD(animation.streaming.starttime, 0, 60),
+    FIELD(animation.streaming.timeout, 0, 60),
+    FIELD(animation.tetris.brightness, 0, 255),
+    FIELD(animation.tetris.endtime, 0, 60),
+    FIELD(animation.tetris.motionBlur, 0, 255),
+    FIELD(animation.tetris.runtime, 0, 3600),
+    FIELD(animation.tetris.starttime, 0, 60),
+    FIELD(animation.tornado.brightness, 0, 255),
+    FIELD(animation.tornado.endtime, 0, 60),
+    FIELD(animation.tornado.motionBlur, 0, 255),
+    FIELD(animation.tornado.runtime, 0, 3600),
+    FIELD(animation.tornado.starttime, 0, 60),
+    FIELD(animation.torus.brightness, 0, 255),
+    FIELD(animation.torus.endtime, 0, 60),
+    FIELD(animation.torus.motionBlur, 0, 255),
+    FIELD(animation.torus.runtime, 0, 3600),
+    FIELD(animation.torus.starttime, 0, 60),
+    FIELD(animation.twinkels.brightness, 0, 255),
+    FIELD(animation.twinkels.fade_in_speed, 0, 10),
+    FIELD(animation.twinkels.fade_out_speed, 0, 10),
+    FIELD(animation.twinkels.interval, 0, 10),
+    FIELD(animation.twinkels.motionBlur, 0, 255),
+    FIELD(animation.twinkels.runtime, 0, 3600),
+    FIELD(display.deferred, 0, 1),
+    FIELD(display.fps, 0, 240),
+    FIELD(display.interpolate, 0, 1),
+    FIELD(display.lcd_dim, 0, 255),
+    FIELD(display.lcd_idle, 0, 3600),
+    FIELD(display.orientation, 0, 47),
+    FIELD(display.pov, 0, 360),
+    FIELD(display.quality.enabled, 0, 1),
+    FIELD(display.quality.high, 0, 100),
+    FIELD(display.quality.low, 0, 100),
+    FIELD(display.quality.max, 0, 3),
+    FIELD(display.quality.min, 0, 3),
+    FIELD(display.touch_rate, 1, 1000),
+    FIELD(modulation.beat, 0.01, 10),
+    FIELD(modulation.bind0.depth, -1000, 1000),
+    FIELD(modulation.bind0.path, 0, 0),
+    FIELD(modulation.bind0.source, 0, 5),
+    FIELD(modulation.bind1.depth, -1000, 1000),
+    FIELD(modulation.bind1.path, 0, 0),
+    FIELD(modulation.bind1.source, 0, 5),
+    FIELD(modulation.bind2.depth, -1000, 1000),
+    FIELD(modulation.bind2.path, 0, 0),
+    FIELD(modulation.bind2.source, 0, 5),
+    FIELD(modulation.bind3.depth, -1000, 1000),
+    FIELD(modulation.bind3.path, 0, 0),
+    FIELD(modulation.bind3.source, 0, 5),
+    FIELD(modulation.release, 0.01, 10),
+    FIELD(network.hostname, 0, 0),
+    FIELD(network.password, 0, 0),
+    FIELD(network.port, 1, 65535),
+    FIELD(network.ssid, 0, 0),
+    FIELD(power.average_milliamps, 0, 30000),
+    FIELD(power.average_minutes, 1, 240),
+    FIELD(power.brightness, 0, 1),
+    FIELD(power.max_milliamps, 0, 30000),
+    FIELD(power.motor_speed, -255, 255),
+    FIELD(sync.cube, 0, 7),
+    FIELD(sync.cubes, 1, 8),
+};
+#undef FIELD
+
+static const uint16_t FIELDS = sizeof(fields) / sizeof(fields[0]);
+
+static inline uint8_t *address(const field_t &f, Settings &c) {
+  return (uint8_t *)&c + f.offset;
+}
+
+static inline const uint8_t *address(const field_t &f,
+                                     const Settings &c) {
+  return (const uint8_t *)&c + f.offset;
+}
+
+uint16_t Schema::count() { return FIELDS; }
+
+const field_t &Schema::at(const uint16_t i) { return fields[i]; }
+
+uint16_t Schema::id(const field_t &f) { return &f - fields; }
+
+const field_t *Schema::find(const char *path) {
+  uint16_t lo = 0, hi = FIELDS;
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2;
+    const int c = strcmp(path, fields[mid].path);
+    if (c == 0) return &fields[mid];
+    if (c < 0)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return nullptr;
+}
+
+float Schema::get(const field_t &f, const Settings &c) {
+  const uint8_t *p = address(f, c);
+  switch (f.type) {
+    case value_t::BOOL:
+      return *(const bool *)p;
+    case value_t::UINT8:
+    case value_t::ENUM:
+      return *p;
+    case value_t::INT8:
+      return *(const int8_t *)p;
+    case value_t::UINT16:
+      return *(const uint16_t *)p;
+    case value_t::INT16:
+      return *(const int16_t *)p;
+    case value_t::FLOAT:
+      return *(const float *)p;
+    default:
+      return 0;
+  }
+}
+
+void Schema::set(const field_t &f, const float value, Settings &c) {
+  float v = value < f.min ? f.min : value > f.max ? f.max : value;
+  // Round integers to nearest, the range keeps them representable
+  if (f.type != value_t::FLOAT) v = v < 0 ? v - 0.5f : v + 0.5f;
+  uint8_t *p = address(f, c);
+  switch (f.type) {
+    case value_t::BOOL:
+      *(bool *)p = v >= 1;
+      break;
+    case value_t::UINT8:
+    case value_t::ENUM:
+      *p = (uint8_t)v;
+      break;
+    case value_t::INT8:
+      *(int8_t *)p = (int8_t)v;
+      break;
+    case value_t::UINT16:
+      *(uint16_t *)p = (uint16_t)v;
+      break;
+    case value_t::INT16:
+      *(int16_t *)p = (int16_t)v;
+      break;
+    case value_t::FLOAT:
+      *(float *)p = v;
+      break;
+    default:
+      break;
+  }
+}
+
+bool Schema::overridden(const field_t &f, const Settings &c) {
+  return memcmp(address(f, c), address(f, defaults), f.size) != 0;
+}
+
+const char *Schema::text(const field_t &f, const Settings &c) {
+  return f.type == value_t::STRING ? (const char *)address(f, c) : nullptr;
+}
+
+void Schema::set(const field_t &f, const char *text, Settings &c) {
+  if (f.type != value_t::STRING) return;
+  char *p = (char *)address(f, c);
+  strncpy(p, text, f.size - 1);
+  p[f.size - 1] = 0;
+}
+
+// Segments two paths share before their last one
+static uint8_t shared(const char *a, const char *b) {
+  uint8_t n = 0;
+  while (true) {
+    const char *da = strchr(a, '.');
+    const char *db = strchr(b, '.');
+    if (!da || !db || da - a != db - b || memcmp(a, b, da - a)) return n;
+    a = da + 1;
+    b = db + 1;
+    n++;
+  }
+}
+
+// Objects a path is nested in
+static uint8_t depth(const char *path) {
+  uint8_t n = 0;
+  while ((path = strchr(path, '.'))) {
+    path++;
+    n++;
+  }
+  return n;
+}
+
+static size_t write_key(Print &out, const char *key, const size_t size) {
+  size_t n = out.write('"');
+  n += out.write((const uint8_t *)key, size);
+  return n + out.write((const uint8_t *)"\":", 2);
+}
+
+// ArduinoJson formats the value, a string is referenced, not copied
+static size_t write_value(Print &out, const field_t &f, const Settings &c) {
+  StaticJsonDocument<16> v;
+  switch (f.type) {
+    case value_t::STRING:
+      v.set(Schema::text(f, c));
+      break;
+    case value_t::BOOL:
+      v.set(Schema::get(f, c) != 0);
+      break;
+    case value_t::FLOAT:
+      v.set(Schema::get(f, c));
+      break;
+    default:
+      v.set((int32_t)Schema::get(f, c));
+      break;
+  }
+  return serializeJson(v, out);
+}
+
+bool Schema::write_json(Print &out, cursor_t &cursor, const size_t budget,
+                        const Settings &c, const bool sparse) {
+  static const uint16_t NONE = 0xFFFF;
+  size_t n = 0;
+  if (!cursor.bytes) n += out.write('{');
+  while (cursor.next < FIELDS && n < budget) {
+    const field_t &f = fields[cursor.next++];
+    if (sparse && !overridden(f, c)) continue;
+    // Close the objects of the field before that this one is not in
+    uint8_t keep = 0;
+    if (cursor.last != NONE) {
+      const char *before = fields[cursor.last].path;
+      keep = shared(before, f.path);
+      for (uint8_t i = depth(before); i > keep; i--) n += out.write('}');
+      n += out.write(',');
+    }
+    const char *rest = f.path;
+    for (uint8_t i = 0; i < keep; i++) rest = strchr(rest, '.') + 1;
+    const char *dot;
+    while ((dot = strchr(rest, '.'))) {
+      n += write_key(out, rest, dot - rest);
+      n += out.write('{');
+      rest = dot + 1;
+    }
+    n += write_key(out, rest, strlen(rest));
+    n += write_value(out, f, c);
+    cursor.last = id(f);
+  }
+  const bool done = cursor.next == FIELDS;
+  if (done) {
+    const uint8_t open =
+        cursor.last == NONE ? 0 : depth(fields[cursor.last].path);
+    for (uint8_t i = 0; i <= open; i++) n += out.write('}');
+  }
+  cursor.bytes += n;
+  return done;
+}
+
+// Set the fields of the text as the reader passes them, returns how many or
+// -1 when the text does not parse. Only checks the text when dry.
+static int apply(JsonReader &json, Settings &c, const bool dry) {
+  int found = 0;
+  for (;;) {
+    const json_t t = json.next();
+    if (t == json_t::END) return found;
+    if (t == json_t::ERROR) return -1;
+    if (dry || json.in_array() || json.truncated()) continue;
+    if (t != json_t::STRING && t != json_t::NUMBER && t != json_t::BOOLEAN)
+      continue;
+    const field_t *f = Schema::find(json.path());
+    if (!f || (f->type == value_t::STRING) != (t == json_t::STRING)) continue;
+    if (t == json_t::STRING)
+      Schema::set(*f, json.text(), c);
+    else
+      Schema::set(*f, t == json_t::BOOLEAN ? json.boolean() : json.number(), c);
+    found++;
+  }
+}
+
+int Schema::read_json(File &file, Settings &c) {
+  // Broken text changes nothing, it is checked before a field is set
+  JsonReader check(file);
+  if (apply(check, c, true) < 0) return -1;
+  file.seek(0);
+  JsonReader json(file);
+  return apply(json, c, false);
+}
+
+int Schema::read_json(const char *text, Settings &c) {
+  JsonReader check(text);
+  if (apply(check, c, true) < 0) return -1;
+  JsonReader json(text);
+  return apply(json, c, false);
+}
@@ -0,0 +1,86 @@
+#ifndef SCHEMA_H
+#define SCHEMA_H
+#include <ArduinoJson.h>
+#include <stdint.h>
+
+#include "Config.h"
+#include "JsonReader.h"
+/*------------------------------------------------------------------------------
+ * SCHEMA CLASS
+ *------------------------------------------------------------------------------
+ * Table of every persistent Config field with its path, offset, type, size
+ * and range, made by one FIELD(path, min, max) line per field in Schema.cpp.
+ * It drives the JSON of config.json, get and set by path over the ESP8266
+ * link and the binding of GUI sliders, so neither hand-codes a field.
+ *
+ * The table is sorted by path, find() is a binary search over it. The
+ * position of a field in the table is its id. Sorting also keeps the fields
+ * of a struct together, so config.json is written and read field by field
+ * and struct by struct instead of as one document.
+ *
+ * const field_t *f = Schema::find("animation.plasma.scale_p");
+ * if (f) Schema::set(*f, 0.2f);  // clamped to the range of the field
+ *----------------------------------------------------------------------------*/
+enum class value_t : uint8_t {
+  BOOL,
+  UINT8,
+  INT8,
+  UINT16,
+  INT16,
+  FLOAT,
+  // ease_t, basis_t and other enums stored in a byte
+  ENUM,
+  // char array of size bytes, range is unused
+  STRING
+};
+
+struct field_t {
+  const char *path;
+  uint16_t offset;
+  value_t type;
+  uint8_t size;
+  float min;
+  float max;
+};
+
+class Schema {
+ public:
+  static uint16_t count();
+  static const field_t &at(const uint16_t i);
+  static const field_t *find(const char *path);
+  static uint16_t id(const field_t &f);
+  // A field differs from its default, see defaults in Config.h
+  static bool overridden(const field_t &f, const Settings &c = config);
+  // Numeric value of a field, 0 for strings
+  static float get(const field_t &f, const Settings &c = config);
+  // Set a numeric field, clamped to its range and rounded for integers
+  static void set(const field_t &f, const float value,
+                  Settings &c = config);
+  // Text of a string field, nullptr for other types
+  static const char *text(const field_t &f, const Settings &c = config);
+  static void set(const field_t &f, const char *text, Settings &c = config);
+
+  // Where write_json() carries on, a new cursor starts a new document
+  struct cursor_t {
+    uint16_t next = 0;
+    // The field written last, the nesting follows from its path
+    uint16_t last = 0xFFFF;
+    // Bytes written so far
+    uint32_t bytes = 0;
+  };
+  // Write the fields as config.json text straight to out, nested objects by
+  // path, only the overridden ones when sparse. Returns false after about
+  // budget bytes, the next call carries on from the cursor, and true once
+  // the document is complete. Takes no memory beyond a field.
+  static bool write_json(Print &out, cursor_t &cursor, const size_t budget,
+                         const Settings &c = config, const bool sparse = true);
+  // Read the fields present in config.json text and set them by path as a
+  // JsonReader passes them, without a document: memory is that of a path
+  // and a value whatever the size of the text. The text is checked in a
+  // first pass, broken text changes nothing. Returns the fields set, -1
+  // when the text does not parse.
+  static int read_json(File &file, Settings &c = config);
+  // The same for text in memory, the config command of the ESP8266 link
+  static int read_json(const char *text, Settings &c = config);
+};
+#endif
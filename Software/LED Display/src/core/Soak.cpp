@@ -0,0 +1,87 @@
+#include "Soak.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+#include "Frame.h"
+
+Soak::stats_t Soak::stats = {};
+bool Soak::sending = false;
+uint16_t Soak::rate = 0;
+uint16_t Soak::size = 0;
+uint32_t Soak::started = 0;
+uint32_t Soak::duration = 0;
+bool Soak::any = false;
+uint32_t Soak::expected = 0;
+uint32_t Soak::errors_seen = 0;
+uint32_t Soak::good_end = 0;
+uint32_t Soak::first = 0;
+static uint32_t errors_base = 0;
+
+void Soak::start(const uint16_t r, const uint16_t s, const uint32_t ms) {
+  stats = {};
+  any = false;
+  rate = r;
+  size = s < 4 ? 4 : s > FRAME_MAX ? FRAME_MAX : s;
+  duration = ms;
+  started = micros();
+  sending = rate && duration;
+}
+
+void Soak::receive(const uint8_t *payload, const uint16_t length,
+                   const uint32_t errors, const uint32_t end,
+                   const uint32_t baud) {
+  if (length < 4) return;
+  uint32_t sequence;
+  memcpy(&sequence, payload, 4);
+  const uint32_t now = millis();
+  if (!any) {
+    any = true;
+    expected = sequence;
+    errors_base = errors_seen = errors;
+    first = now;
+  }
+  // Bytes of the link from the last good frame to this one
+  if (errors != errors_seen) {
+    const uint32_t lost = end - length - 6 - good_end;
+    const uint32_t us = (uint64_t)lost * 10 * 1000000 / baud;
+    stats.resyncs++;
+    stats.resync_sum += us;
+    if (us > stats.resync_max) stats.resync_max = us;
+    errors_seen = errors;
+  }
+  good_end = end;
+  stats.errors = errors - errors_base;
+  stats.frames++;
+  stats.bytes += length;
+  stats.ms = now - first;
+  if ((int32_t)(sequence - expected) >= 0) {
+    stats.lost += sequence - expected;
+    expected = sequence + 1;
+  } else {
+    stats.reordered++;
+    if (stats.lost) stats.lost--;
+  }
+  for (uint16_t i = 4; i < length; i++) {
+    if (payload[i] != (uint8_t)(sequence + i)) {
+      stats.corrupt++;
+      break;
+    }
+  }
+}
+
+uint16_t Soak::due() {
+  if (!sending) return 0;
+  const uint32_t elapsed = micros() - started;
+  if (elapsed >= duration * 1000) {
+    sending = false;
+    return 0;
+  }
+  return elapsed < (uint64_t)stats.sent * 1000000 / rate ? 0 : size;
+}
+
+void Soak::fill(uint8_t *payload) {
+  const uint32_t sequence = stats.sent++;
+  memcpy(payload, &sequence, 4);
+  for (uint16_t i = 4; i < size; i++) payload[i] = sequence + i;
+}
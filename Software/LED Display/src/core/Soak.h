@@ -0,0 +1,76 @@
+#ifndef SOAK_H
+#define SOAK_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * SOAK CLASS
+ *------------------------------------------------------------------------------
+ * A load test of the link to the ESP8266 and the bridge behind it, to compare
+ * a protocol or link rate change by numbers instead of by bit errors seen.
+ * soak_test.py floods the cube with SOAK frames over tcp at a rate and size
+ * and has the Teensy flood it back at the same time. A SOAK frame is a uint32
+ * sequence and filler bytes of (sequence + index) & 0xFF, so a frame that
+ * passes the CRC but was spliced in the bridge still shows.
+ *
+ * The receiving end counts the frames and payload bytes, the frames lost
+ * (gaps in the sequence, a reordered frame that arrives late comes off them
+ * again), reordered, corrupt (filler wrong) and the frames the parser dropped.
+ * The resync time is the stretch from the end of the last good frame to the
+ * start of the first good one after a drop, at the rate of the link.
+ *
+ * {"event":"soak","rate":r,"size":s,"ms":t} clears the counts and sends r
+ * frames of s bytes a second back for t ms, {"event":"soak"} replies the
+ * counts. Only the frames of the ESP8266 link are counted.
+ *
+ * Soak::start(200, 256, 10000);
+ * while ((size = Soak::due()) && Outbox::room(Outbox::BULK) >= size + 6) {
+ *   Soak::fill(payload);
+ *   send(frame_t::SOAK, payload, size);
+ * }
+ *----------------------------------------------------------------------------*/
+class Soak {
+ public:
+  struct stats_t {
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t lost;
+    uint32_t reordered;
+    uint32_t corrupt;
+    // Frames the parser dropped, resyncs after them and their time in us
+    uint32_t errors;
+    uint32_t resyncs;
+    uint32_t resync_max;
+    uint32_t resync_sum;
+    // millis() from the first frame received to the last
+    uint32_t ms;
+    // Frames sent back
+    uint32_t sent;
+  };
+  static stats_t stats;
+
+  // Clear the counts and send rate frames of size bytes a second for ms
+  static void start(const uint16_t rate, const uint16_t size,
+                    const uint32_t ms);
+  // A SOAK frame ending at byte end of the link, the frame errors of its
+  // parser so far and the baud rate of the link
+  static void receive(const uint8_t *payload, const uint16_t size,
+                      const uint32_t errors, const uint32_t end,
+                      const uint32_t baud);
+  // Size of the frame due to be sent back, 0 while none is
+  static uint16_t due();
+  // Fill in the frame that is due and count it sent
+  static void fill(uint8_t *payload);
+
+ private:
+  static bool sending;
+  static uint16_t rate;
+  static uint16_t size;
+  static uint32_t started;
+  static uint32_t duration;
+  // Next sequence expected, the frame errors and end of the last good frame
+  static bool any;
+  static uint32_t expected;
+  static uint32_t errors_seen;
+  static uint32_t good_end;
+  static uint32_t first;
+};
+#endif
@@ -0,0 +1,65 @@
+#include "Sync.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+#include "Config.h"
+/*------------------------------------------------------------------------------
+ * SYNC CLASS
+ *----------------------------------------------------------------------------*/
+int16_t Sync::shift = 0;
+uint64_t Sync::epoch = 0;
+bool Sync::joined = false;
+int64_t Sync::offset = 0;
+int64_t Sync::largest = 0;
+uint8_t Sync::clocks = 0;
+uint64_t Sync::heard = 0;
+
+// Cube 0 at the negative end, the origin at the center of the shared volume
+void Sync::loop() {
+  const uint8_t cubes = config.sync.cubes;
+  const uint8_t cube = config.sync.cube < cubes ? config.sync.cube : 0;
+  shift = cubes > 1 ? 8 * (cubes - 1) - 16 * cube : 0;
+}
+
+// Shared time (uint64), epoch (uint64), flags (1 = the ESP8266 follows cube 0)
+void Sync::receive(const uint8_t* payload, const uint16_t size) {
+  if (size != 17 || !(payload[16] & 1)) return;
+  uint64_t time, start;
+  memcpy(&time, &payload[0], 8);
+  memcpy(&start, &payload[8], 8);
+  const uint64_t now = local();
+  const int64_t behind = time - now;
+  epoch = start;
+  // The first clock or a restarted leader, start over
+  if (!heard || now - heard > TIMEOUT || behind - offset > 1000000 ||
+      offset - behind > 1000000) {
+    offset = largest = behind;
+    clocks = 0;
+    joined = false;
+  }
+  if (behind > largest) largest = behind;
+  if (++clocks == WINDOW) {
+    offset = largest;
+    largest = INT64_MIN;
+    clocks = 0;
+  }
+  heard = now;
+}
+
+bool Sync::locked() {
+  return config.sync.cubes > 1 && heard && local() - heard < TIMEOUT;
+}
+
+uint64_t Sync::now() { return local() + offset; }
+
+uint32_t Sync::seed(const uint32_t frame) {
+  return ((uint32_t)epoch ^ (uint32_t)(epoch >> 32)) + frame * 0x9E3779B9u;
+}
+
+// Only called from the main loop, far more often than micros() wraps
+uint64_t Sync::local() {
+  static uint64_t time = 0;
+  time += (uint32_t)(micros() - (uint32_t)time);
+  return time;
+}
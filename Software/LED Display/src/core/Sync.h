@@ -0,0 +1,64 @@
+#ifndef SYNC_H
+#define SYNC_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * SYNC CLASS
+ *------------------------------------------------------------------------------
+ * Cubes side by side along x (config.sync.cubes) show one animation in a
+ * shared volume of 16 * cubes by 16 by 16 voxels. Nobody sends frames, every
+ * cube draws the same frame at the same time and keeps its own part of it.
+ *
+ * The ESP8266 of cube 0 keeps the shared clock, the others follow it with the
+ * four timestamp exchange of NTP (see Sync.h of the ESP8266). Every ESP8266
+ * sends its cube a CLOCK frame ten times a second with the shared time and
+ * the epoch. The link only delays a clock, so the largest shared minus local
+ * time of a window of clocks is the offset. A new window every WINDOW clocks
+ * follows the crystals drifting apart.
+ *
+ * The scheduler puts the frame slots at the same shared times on every cube,
+ * frame is the slot of the shared clock. The animations take their time and
+ * random numbers from it (see Animation::synchronize()). A cube that has not
+ * started with the others asks to join, cube 0 then sets a new epoch a second
+ * ahead and all cubes start the sequence over with the first slot after it.
+ *
+ * A cube that drops a frame keeps the same time and random numbers in the
+ * next one, but state that animations integrate over frames (particles) can
+ * drift apart until the next epoch.
+ *
+ * Drawing in system coordinates is shifted to the part of the volume of this
+ * cube (CX in Graphics.h), the origin is the center of the shared volume.
+ *----------------------------------------------------------------------------*/
+class Sync {
+ public:
+  // Voxels the system coordinates are shifted along x on this cube
+  static int16_t shift;
+  // Shared time the sequence starts over, in microseconds
+  static uint64_t epoch;
+  // The sequence started over with the others, asks to join until then
+  static bool joined;
+
+  // Apply the cube position of the config
+  static void loop();
+  // A CLOCK frame from the ESP8266
+  static void receive(const uint8_t* payload, const uint16_t size);
+  // Whether the shared clock is known, more cubes and a recent clock
+  static bool locked();
+  // Shared time in microseconds
+  static uint64_t now();
+  // Random seed of a frame, the same on all cubes
+  static uint32_t seed(const uint32_t frame);
+
+ private:
+  // Clocks per offset window and the age of a clock still locked
+  static const uint8_t WINDOW = 16;
+  static const uint32_t TIMEOUT = 2000000;
+  // Offset of the shared clock and the largest of the current window
+  static int64_t offset;
+  static int64_t largest;
+  static uint8_t clocks;
+  // Local time of the last clock, zero before the first
+  static uint64_t heard;
+  // micros() without wrapping
+  static uint64_t local();
+};
+#endif
@@ -0,0 +1,94 @@
+#include "Tasks.h"
+
+#include <Arduino.h>
+#include <stdio.h>
+
+#include "Scheduler.h"
+/*------------------------------------------------------------------------------
+ * TASKS CLASS
+ *----------------------------------------------------------------------------*/
+Tasks::task_t *Tasks::tasks = nullptr;
+uint8_t Tasks::count = 0;
+
+void Tasks::begin(task_t *table, const uint8_t size) {
+  tasks = table;
+  count = size;
+  const uint32_t now = micros();
+  for (uint8_t i = 0; i < count; i++) tasks[i].last = now;
+}
+
+void Tasks::run(task_t &task, const uint32_t now) {
+  task.run();
+  const uint32_t end = micros();
+  const uint32_t time = end - now;
+  task.runs++;
+  task.micros += time;
+  if (task.max < time) task.max = time;
+  if (time > task.budget) task.overruns++;
+  // Follow a slow run at once, forget it over about 16 runs
+  task.cost -= task.cost / 16;
+  if (task.cost < time) task.cost = time;
+  task.last = end;
+}
+
+void Tasks::loop() {
+  for (uint8_t tier = FRAME; tier < TIERS; tier++) {
+    for (uint8_t i = 0; i < count; i++) {
+      task_t &task = tasks[i];
+      if (task.tier != tier) continue;
+      const uint32_t now = micros();
+      // Only in the slack before the next frame slot, unless it starved
+      if (tier == BACKGROUND && Scheduler::paced() &&
+          Scheduler::remaining() < task.cost && now - task.last < STARVE) {
+        task.deferred++;
+        continue;
+      }
+      run(task, now);
+    }
+  }
+}
+
+uint32_t Tasks::overruns() {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < count; i++) total += tasks[i].overruns;
+  return total;
+}
+
+uint32_t Tasks::deferred() {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < count; i++) total += tasks[i].deferred;
+  return total;
+}
+
+const Tasks::task_t *Tasks::worst() {
+  const task_t *worst = nullptr;
+  for (uint8_t i = 0; i < count; i++) {
+    if (tasks[i].overruns && (!worst || worst->overruns < tasks[i].overruns))
+      worst = &tasks[i];
+  }
+  return worst;
+}
+
+int Tasks::report(char *buffer, const size_t size) {
+  int n = snprintf(buffer, size, "Tasks");
+  for (uint8_t i = 0; i < count && n >= 0 && (size_t)n < size; i++) {
+    const task_t &t = tasks[i];
+    if (!t.runs && !t.deferred) continue;
+    n += snprintf(buffer + n, size - n, "  %s %lu/%lu us", t.name,
+                  t.runs ? t.micros / t.runs : 0, t.max);
+    if (t.overruns && n >= 0 && (size_t)n < size)
+      n += snprintf(buffer + n, size - n, " %lu over", t.overruns);
+    if (t.deferred && n >= 0 && (size_t)n < size)
+      n += snprintf(buffer + n, size - n, " %lu deferred", t.deferred);
+  }
+  if (n >= 0 && (size_t)n < size)
+    n += snprintf(buffer + n, size - n, " (avg/max)");
+  return n;
+}
+
+void Tasks::reset() {
+  for (uint8_t i = 0; i < count; i++) {
+    task_t &t = tasks[i];
+    t.runs = t.overruns = t.deferred = t.micros = t.max = 0;
+  }
+}
@@ -0,0 +1,72 @@
+#ifndef TASKS_H
+#define TASKS_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * TASKS CLASS
+ *------------------------------------------------------------------------------
+ * Runs the main loop as a table of tasks in three tiers instead of one call
+ * after the other. Every loop runs the FRAME tier first, frame submission and
+ * the dma buffers, then the RECEIVE tier, the input of the links. A task of
+ * the BACKGROUND tier (the GUI, config writes, telemetry, the SD card) only
+ * runs when its estimated cost fits in the slack before the next frame slot
+ * (Scheduler::remaining()), so a slow one waits for a later loop instead of
+ * delaying the frame. A background task that waited STARVE runs anyway. The
+ * serial input keeps running from yield() between loops (serialEvent).
+ *
+ * Every task declares a budget, a run that takes longer counts as an overrun.
+ * The estimated cost follows a slow run at once and forgets it over about 16
+ * runs. Runs, overruns, deferred runs and the time per task are counted until
+ * reset(), the telemetry reports the overruns and the worst task.
+ *
+ * static Tasks::task_t tasks[] = {
+ *     {"animation", Animation::loop, Tasks::FRAME, 16000},
+ *     {"lcd", LCD::loop, Tasks::BACKGROUND, 8000}};
+ * Tasks::begin(tasks, 2);  // setup()
+ * Tasks::loop();           // loop()
+ *----------------------------------------------------------------------------*/
+class Tasks {
+ public:
+  // In order of priority
+  enum tier_t : uint8_t { FRAME, RECEIVE, BACKGROUND, TIERS };
+  // A background task that waited this long runs anyway (us)
+  static const uint32_t STARVE = 50000;
+
+  struct task_t {
+    const char *name;
+    void (*run)();
+    tier_t tier;
+    // Longest run that is not an overrun (us)
+    uint32_t budget;
+    // Since the last reset, times in us
+    uint32_t runs;
+    uint32_t overruns;
+    uint32_t deferred;
+    uint32_t micros;
+    uint32_t max;
+    // Estimated cost of a run and the end of the last one (us)
+    uint32_t cost;
+    uint32_t last;
+  };
+
+  // The table of the main loop, it must outlive the loop
+  static void begin(task_t *table, const uint8_t size);
+  // All tiers once, the whole main loop
+  static void loop();
+  // Overruns and deferred runs of all tasks since the last reset
+  static uint32_t overruns();
+  static uint32_t deferred();
+  // Task with the most overruns since the last reset, nullptr without any
+  static const task_t *worst();
+  // Print the time per task in a single line, returns the amount printed
+  static int report(char *buffer, const size_t size);
+  // Start a new measurement window
+  static void reset();
+
+ private:
+  static task_t *tasks;
+  static uint8_t count;
+
+  static void run(task_t &task, const uint32_t now);
+};
+#endif
@@ -0,0 +1,219 @@
+#include "Telemetry.h"
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "Boot.h"
+#include "Display.h"
+#include "ESP8266.h"
+#include "Energy.h"
+#include "FrameCache.h"
+#include "Governor.h"
+#include "LCD.h"
+#include "Scheduler.h"
+#include "Tasks.h"
+#include "space/Animation.h"
+
+// Teensy 4 linker symbols, the end of the variables in RAM1 and of RAM2
+extern unsigned long _ebss;
+extern unsigned long _heap_end;
+extern "C" char *sbrk(int incr);
+/*------------------------------------------------------------------------------
+ * TELEMETRY CLASS
+ *----------------------------------------------------------------------------*/
+Telemetry::telemetry_t Telemetry::last = {};
+Display::dma_stats_t Telemetry::dma = {};
+uint32_t Telemetry::hits = 0;
+uint32_t Telemetry::misses = 0;
+
+void Telemetry::sample() {
+  telemetry_t &t = last;
+  t.fps = Scheduler::fps();
+  t.dropped = Scheduler::dropped;
+  t.draw_avg = Scheduler::draw.avg();
+  t.draw_p99 = Scheduler::draw.percentile(99);
+  t.draw_max = Scheduler::draw.max();
+  t.transpose_avg = Scheduler::transpose.avg();
+  t.transpose_max = Scheduler::transpose.max();
+  t.slack_min = Scheduler::slack.min();
+  t.slack_avg = Scheduler::slack.avg();
+  t.busy = Scheduler::busy;
+  t.wait_avg = Scheduler::wait.avg();
+  t.wait_max = Scheduler::wait.max();
+  t.gui_avg = LCD::gui.avg();
+  t.gui_max = LCD::gui.max();
+  LCD::gui.reset();
+  t.link_bytes = ESP8266::stats.bytes;
+  t.link_errors = ESP8266::stats.errors;
+  Display::dma_stats_t now;
+  Display::getDmaStats(now);
+  t.refreshes = now.refreshes - dma.refreshes;
+  t.stale = now.stale - dma.stale;
+  t.underruns = now.underruns - dma.underruns;
+  t.swap_max = now.swapMax;
+  t.refresh = now.refresh;
+  t.reset = now.reset;
+  dma = now;
+  t.milliamps = Display::getMilliamps();
+  t.average_milliamps = Energy::average;
+  t.dimming = Energy::dimming;
+  // The stack grows down towards the variables
+  char top;
+  t.ram1 = &top - (char *)&_ebss;
+  t.ram2 = (char *)&_heap_end - sbrk(0);
+  t.quality = Governor::level;
+  t.quality_changes = Governor::changes;
+  t.boot_frame = Boot::first_frame;
+  t.boot_ready = Boot::ready;
+  t.cache_hits = FrameCache::hits - hits;
+  t.cache_misses = FrameCache::misses - misses;
+  t.cache_bytes = FrameCache::used();
+  hits = FrameCache::hits;
+  misses = FrameCache::misses;
+  // The heap exists once LCD::begin() started LVGL
+  lv_mem_monitor_t heap = {};
+  if (lv_is_initialized()) lv_mem_monitor(&heap);
+  t.heap_used = heap.total_size - heap.free_size;
+  t.heap_peak = heap.max_used;
+  t.heap_biggest = heap.free_biggest_size;
+  t.heap_fragmentation = heap.frag_pct;
+  t.task_overruns = Tasks::overruns();
+  t.task_deferred = Tasks::deferred();
+  const Tasks::task_t *worst = Tasks::worst();
+  t.task_worst = worst ? worst->name : "";
+  t.task_max = worst ? worst->max : 0;
+
+  // Animations on display, named after their first jump item
+  const float cycles_per_us = F_CPU_ACTUAL / 1000000.0f;
+  t.animations = 0;
+  for (uint8_t i = 0; t.animations < ANIMATIONS; i++) {
+    Animation *a = Animation::get_active(i);
+    if (!a) break;
+    animation_t &entry = t.animation[t.animations++];
+    entry.name = "";
+    for (uint16_t j = 0; Animation::get_item(j).object; j++) {
+      if (Animation::get_item(j).object != a) continue;
+      entry.name = Animation::get_item(j).name;
+      break;
+    }
+    entry.avg = a->profile_calls
+                    ? a->profile_total / a->profile_calls / cycles_per_us
+                    : 0;
+    entry.max = a->profile_max / cycles_per_us;
+  }
+}
+
+void Telemetry::publish() {
+  char buffer[768];
+  StaticJsonDocument<1536> doc;
+  const telemetry_t &t = last;
+  doc["event"] = "telemetry";
+  // One decimal, formatted on the stack instead of in a String
+  char fps[16];
+  snprintf(fps, sizeof(fps), "%.1f", t.fps);
+  doc["fps"] = serialized(fps);
+  doc["drop"] = t.dropped;
+  JsonArray draw = doc.createNestedArray("draw");
+  draw.add(t.draw_avg);
+  draw.add(t.draw_p99);
+  draw.add(t.draw_max);
+  JsonArray transpose = doc.createNestedArray("tr");
+  transpose.add(t.transpose_avg);
+  transpose.add(t.transpose_max);
+  JsonArray slack = doc.createNestedArray("slack");
+  slack.add(t.slack_min);
+  slack.add(t.slack_avg);
+  JsonArray busy = doc.createNestedArray("busy");
+  busy.add(t.busy);
+  busy.add(t.wait_avg);
+  busy.add(t.wait_max);
+  JsonArray gui = doc.createNestedArray("gui");
+  gui.add(t.gui_avg);
+  gui.add(t.gui_max);
+  JsonArray link = doc.createNestedArray("link");
+  link.add(t.link_bytes);
+  link.add(t.link_errors);
+  JsonArray dma = doc.createNestedArray("dma");
+  dma.add(t.refreshes);
+  dma.add(t.stale);
+  dma.add(t.underruns);
+  dma.add(t.swap_max);
+  dma.add(t.refresh);
+  dma.add(t.reset);
+  doc["mA"] = t.milliamps;
+  JsonArray energy = doc.createNestedArray("energy");
+  energy.add(t.average_milliamps);
+  energy.add(t.dimming);
+  JsonArray ram = doc.createNestedArray("ram");
+  ram.add(t.ram1);
+  ram.add(t.ram2);
+  JsonArray quality = doc.createNestedArray("quality");
+  quality.add(t.quality);
+  quality.add(t.quality_changes);
+  JsonArray boot = doc.createNestedArray("boot");
+  boot.add(t.boot_frame);
+  boot.add(t.boot_ready);
+  JsonArray cache = doc.createNestedArray("cache");
+  cache.add(t.cache_hits);
+  cache.add(t.cache_misses);
+  cache.add(t.cache_bytes);
+  JsonArray heap = doc.createNestedArray("heap");
+  heap.add(t.heap_used);
+  heap.add(t.heap_peak);
+  heap.add(t.heap_biggest);
+  heap.add(t.heap_fragmentation);
+  JsonArray tasks = doc.createNestedArray("tasks");
+  tasks.add(t.task_overruns);
+  tasks.add(t.task_deferred);
+  tasks.add(t.task_worst);
+  tasks.add(t.task_max);
+  JsonArray anim = doc.createNestedArray("anim");
+  for (uint8_t i = 0; i < t.animations; i++) {
+    JsonArray entry = anim.createNestedArray();
+    entry.add(t.animation[i].name);
+    entry.add(t.animation[i].avg);
+    entry.add(t.animation[i].max);
+  }
+  serializeJson(doc, buffer, sizeof(buffer));
+  doc.clear();
+  ESP8266::rpc(buffer, Outbox::BULK);
+}
+
+int Telemetry::report(char *buffer, const size_t size) {
+  const telemetry_t &t = last;
+  int n = snprintf(buffer, size,
+                   "FPS %1.1f  dropped %lu  busy %lu (%lu / %lu us)\n"
+                   "Draw %lu / %lu / %lu us (avg/p99/max)\n"
+                   "Transpose %lu / %lu us  min slack %lu us\n"
+                   "Refresh %lu us  reset %lu us\n"
+                   "Refreshes %lu  stale %lu  underruns %lu\n"
+                   "GUI %lu / %lu us  current %lu mA  average %lu mA\n"
+                   "Link %lu B/s  %lu errors\n"
+                   "Free RAM1 %lu KB  RAM2 %lu KB\n"
+                   "GUI heap %lu KB  peak %lu KB  fragmented %u%%\n"
+                   "Quality %u  %lu changes\n"
+                   "Boot first frame %lu ms  ready %lu ms\n",
+                   t.fps, t.dropped, t.busy, t.wait_avg, t.wait_max,
+                   t.draw_avg, t.draw_p99, t.draw_max, t.transpose_avg,
+                   t.transpose_max, t.slack_min, t.refresh, t.reset,
+                   t.refreshes, t.stale, t.underruns, t.gui_avg, t.gui_max,
+                   t.milliamps, t.average_milliamps, t.link_bytes, t.link_errors, t.ram1 / 1024,
+                   t.ram2 / 1024, t.heap_used / 1024, t.heap_peak / 1024,
+                   t.heap_fragmentation, t.quality, t.quality_changes,
+                   t.boot_frame / 1000, t.boot_ready / 1000);
+  if (t.dimming < 255 && n >= 0 && (size_t)n < size)
+    n += snprintf(buffer + n, size - n, "Energy dimming %u%%\n",
+                  t.dimming * 100 / 255);
+  if (t.task_overruns && n >= 0 && (size_t)n < size)
+    n += snprintf(buffer + n, size - n, "Tasks %lu over  worst %s %lu us\n",
+                  t.task_overruns, t.task_worst, t.task_max);
+  const uint32_t cached = t.cache_hits + t.cache_misses;
+  if (cached && n >= 0 && (size_t)n < size)
+    n += snprintf(buffer + n, size - n, "Cache %lu%% of %lu frames  %lu KB\n",
+                  t.cache_hits * 100 / cached, cached, t.cache_bytes / 1024);
+  for (uint8_t i = 0; i < t.animations && n >= 0 && (size_t)n < size; i++) {
+    n += snprintf(buffer + n, size - n, "%s %lu / %lu us\n",
+                  t.animation[i].name, t.animation[i].avg, t.animation[i].max);
+  }
+  return n;
+}
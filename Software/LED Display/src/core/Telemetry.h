@@ -0,0 +1,117 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+#include <stdint.h>
+#include <string.h>
+
+#include "Display.h"
+/*------------------------------------------------------------------------------
+ * TELEMETRY CLASS
+ *------------------------------------------------------------------------------
+ * Health of the cube in one snapshot: frame timing, the draw cost of the
+ * animations on display, the ESP8266 link, the led refreshes of the dma isr,
+ * the estimated current, free RAM, the time the LVGL handler takes, the
+ * quality level of the governor, how long the boot took, the frame cache,
+ * the LVGL heap and the tasks of the main loop.
+ *
+ * sample() takes the snapshot from the statistics the other classes collect
+ * anyway, main calls it every print interval before the scheduler starts a
+ * new measurement window. Per frame it costs a few counter increments in the
+ * dma isr and the scheduler, a sample a few microseconds. The snapshot is published to the
+ * ESP8266 as a "telemetry" event, which passes it on to its subscribed tcp
+ * clients:
+ *
+ * {"event":"telemetry","fps":60.0,"drop":0,"draw":[avg,p99,max],
+ *  "tr":[avg,max],"slack":[min,avg],"busy":[count,avg,max],"gui":[avg,max],
+ *  "link":[bytes,errors],"dma":[refreshes,stale,underruns,swap max,refresh,
+ *  reset],
+ *  "mA":1200,"ram":[ram1,ram2],"quality":[level,changes],
+ *  "boot":[first frame,ready],"cache":[hits,misses,bytes],
+ *  "heap":[used,peak,biggest free,fragmentation],
+ *  "tasks":[overruns,deferred,"worst",max],
+ *  "anim":[["Plasma",avg,max]]}
+ *
+ * Times are in microseconds, link bytes and errors are those of the last
+ * second. The draw cost of an animation is since the last profile dump. The
+ * boot times are since reset, ready is 0 while the boot is still going on.
+ * Cache hits and misses are the frames of the window replayed and drawn by
+ * periodic animations (FrameCache.h), bytes the slots stored. The LVGL heap
+ * is in bytes, its peak since the boot and the fragmentation of its free
+ * memory in percent (0 while the LCD is not up yet). Tasks are the runs of
+ * the main loop over their budget and the background runs deferred to a
+ * later loop (Tasks.h), worst the task with the most overruns and its
+ * longest run ("" and 0 without overruns).
+ *
+ * Frame slots that find the display busy and long waits for it mean the
+ * transpose or the leds are the limit. Long draws and dropped slots mean the
+ * animation is (compute bound). Stale refreshes while streaming together with
+ * link errors or a full link mean the link is (link bound).
+ *----------------------------------------------------------------------------*/
+class Telemetry {
+ public:
+  // Animations with their draw cost in a snapshot
+  static const uint8_t ANIMATIONS = 4;
+
+  struct animation_t {
+    const char *name;
+    uint32_t avg;
+    uint32_t max;
+  };
+
+  struct telemetry_t {
+    float fps;
+    uint32_t dropped;
+    uint32_t draw_avg, draw_p99, draw_max;
+    uint32_t transpose_avg, transpose_max;
+    uint32_t slack_min, slack_avg;
+    // Frame slots that found the display busy, the wait for it
+    uint32_t busy, wait_avg, wait_max;
+    uint32_t gui_avg, gui_max;
+    uint32_t link_bytes, link_errors;
+    // Led refreshes, those repeating the previous frame, those repeating it
+    // while the next one was waiting and the longest time between swaps
+    uint32_t refreshes, stale, underruns, swap_max;
+    // Time of a refresh and the led reset at its end
+    uint32_t refresh, reset;
+    uint32_t milliamps;
+    // Running average of the current and the dimming of the energy budget
+    uint32_t average_milliamps;
+    uint8_t dimming;
+    // Free RAM1 (between the variables and the stack) and RAM2 (heap)
+    uint32_t ram1, ram2;
+    // Quality level of the governor and its changes since starting
+    uint8_t quality;
+    uint32_t quality_changes;
+    // Time to the first frame and to the end of the boot, see Boot.h
+    uint32_t boot_frame, boot_ready;
+    // Frames replayed and drawn for the frame cache, its bytes in use
+    uint32_t cache_hits, cache_misses, cache_bytes;
+    // LVGL heap in use, its peak, the largest free block and how much the
+    // free memory is fragmented in percent
+    uint32_t heap_used, heap_peak, heap_biggest;
+    uint8_t heap_fragmentation;
+    // Task runs over their budget, background runs deferred, the task with
+    // the most overruns and its longest run
+    uint32_t task_overruns, task_deferred;
+    const char *task_worst;
+    uint32_t task_max;
+    uint8_t animations;
+    animation_t animation[ANIMATIONS];
+  };
+
+  // The last snapshot
+  static telemetry_t last;
+
+  // Take a snapshot of the current measurement window
+  static void sample();
+  // Send the last snapshot to the ESP8266
+  static void publish();
+  // Print the last snapshot in lines for the LCD, returns the amount printed
+  static int report(char *buffer, const size_t size);
+
+ private:
+  // Dma isr counters of the previous snapshot
+  static Display::dma_stats_t dma;
+  // Frame cache counters of the previous snapshot
+  static uint32_t hits, misses;
+};
+#endif
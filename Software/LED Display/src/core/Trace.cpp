@@ -0,0 +1,32 @@
+#include "Trace.h"
+
+#include <Arduino.h>
+
+#if defined CUBE_TRACE
+// Name and context of every event, the context is the row in the viewer
+static const char *const names[Trace::EVENTS] = {
+    "animation:loop", "submit:loop", "transpose:transpose",
+    "refresh:dma",    "link:loop",   "gui:loop"};
+
+DMAMEM Trace::record_t Trace::ring[TRACE_RECORDS];
+std::atomic<uint32_t> Trace::head{0};
+volatile bool Trace::paused = false;
+
+void Trace::dump() {
+  paused = true;
+  const uint32_t end = head.load();
+  const uint32_t count = end < TRACE_RECORDS ? end : TRACE_RECORDS;
+  Serial.printf("trace %lu", F_CPU_ACTUAL);
+  for (uint8_t i = 0; i < EVENTS; i++) Serial.printf(" %s", names[i]);
+  Serial.println();
+  for (uint32_t i = end - count; i != end; i++) {
+    const record_t &r = ring[i & (TRACE_RECORDS - 1)];
+    Serial.printf("%lu %u %u %u\n", r.cycles, r.event, r.phase, r.arg);
+  }
+  Serial.println("trace end");
+  head = 0;
+  paused = false;
+}
+#else
+void Trace::dump() { Serial.println("trace: built without CUBE_TRACE"); }
+#endif
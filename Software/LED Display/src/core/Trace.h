@@ -0,0 +1,90 @@
+#ifndef TRACE_H
+#define TRACE_H
+#include <stdint.h>
+#if defined CUBE_TRACE
+#include <Arduino.h>
+
+#include <atomic>
+#endif
+/*------------------------------------------------------------------------------
+ * TRACE CLASS
+ *------------------------------------------------------------------------------
+ * A recorder of what the core did when, to see where a frame hitch came
+ * from: the animation, the GUI, the link, the transpose and the dma isr all
+ * take turns on the one core. The macros below write a record of the cycle
+ * counter, the event, its phase and an argument into a ring of TRACE_RECORDS,
+ * overwriting the oldest. A record is inline and takes a few cycles, the
+ * index is claimed with an atomic add so the isrs can trace as well. Without CUBE_TRACE the
+ * macros are empty and the ring does not exist.
+ *
+ * The "trace" command prints the ring to the USB console, recording pauses
+ * meanwhile. trace_convert.py turns the dump into the JSON of the Chrome
+ * trace viewer (chrome://tracing, ui.perfetto.dev), one row per context:
+ *
+ *   trace <F_CPU_ACTUAL> <event>:<context> ...
+ *   <cycles> <event> <phase> <arg>
+ *   trace end
+ *
+ * TRACE_BEGIN(LCD);
+ * lv_timer_handler();
+ * TRACE_END(LCD, 0);
+ *----------------------------------------------------------------------------*/
+// #define CUBE_TRACE
+// Records in the ring, a power of 2, 8 bytes each in DMAMEM
+#define TRACE_RECORDS 2048
+
+class Trace {
+ public:
+  enum event_t : uint8_t {
+    // Animation::loop() drawing a frame, the end the animations drawn
+    ANIMATION,
+    // Display::submit() handing the frame to the transpose
+    SUBMIT,
+    // Display::transposeFrame() in the software isr
+    TRANSPOSE,
+    // Display::displayReady() in the dma isr, 1 when it swapped a frame in
+    REFRESH,
+    // ESP8266::loop() reading the link, the end the bytes read
+    LINK,
+    // LCD::loop() running the LVGL handler
+    GUI,
+    EVENTS
+  };
+  enum phase_t : uint8_t { BEGIN, END, MARK };
+
+  struct record_t {
+    uint32_t cycles;
+    event_t event;
+    phase_t phase;
+    uint16_t arg;
+  };
+
+  // Print the ring to the USB console, oldest first
+  static void dump();
+
+#if defined CUBE_TRACE
+  static void record(const event_t event, const phase_t phase,
+                     const uint16_t arg) {
+    if (paused) return;
+    const uint32_t i =
+        head.fetch_add(1, std::memory_order_relaxed) & (TRACE_RECORDS - 1);
+    ring[i] = {ARM_DWT_CYCCNT, event, phase, arg};
+  }
+
+ private:
+  static record_t ring[TRACE_RECORDS];
+  static std::atomic<uint32_t> head;
+  static volatile bool paused;
+#endif
+};
+
+#if defined CUBE_TRACE
+#define TRACE_BEGIN(event) Trace::record(Trace::event, Trace::BEGIN, 0)
+#define TRACE_END(event, arg) Trace::record(Trace::event, Trace::END, arg)
+#define TRACE_MARK(event, arg) Trace::record(Trace::event, Trace::MARK, arg)
+#else
+#define TRACE_BEGIN(event)
+#define TRACE_END(event, arg)
+#define TRACE_MARK(event, arg)
+#endif
+#endif
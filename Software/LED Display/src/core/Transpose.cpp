@@ -0,0 +1,329 @@
+#include "Transpose.h"
+
+#include <algorithm>
+
+#include "power/Color32.h"
+#include "power/Morton.h"
+
+/*------------------------------------------------------------------------------
+ * TRANSPOSE CLASS
+ *----------------------------------------------------------------------------*/
+// Transpose 32 channel bytes into 8 bit planes (Hacker's Delight 7-3). Plane
+// 0 holds the msb of every channel byte, channel n ends up in bit n. The input
+// is read as 8 little endian words, so each word holds 4 channel bytes.
+static inline void planes(const uint32_t *in, uint32_t *out) {
+  uint32_t p0 = 0, p1 = 0, p2 = 0, p3 = 0, p4 = 0, p5 = 0, p6 = 0, p7 = 0;
+  for (uint8_t i = 0; i < 4; i++) {
+    // Channel 8i+7 .. 8i+4 in x and channel 8i+3 .. 8i in y (msb first)
+    uint32_t x = in[2 * i + 1];
+    uint32_t y = in[2 * i];
+    uint32_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+    // Every byte of x and y is a bit plane of 8 channels
+    const uint8_t s = i << 3;
+    p0 |= (x >> 24) << s;
+    p1 |= (x >> 16 & 0xFF) << s;
+    p2 |= (x >> 8 & 0xFF) << s;
+    p3 |= (x & 0xFF) << s;
+    p4 |= (y >> 24) << s;
+    p5 |= (y >> 16 & 0xFF) << s;
+    p6 |= (y >> 8 & 0xFF) << s;
+    p7 |= (y & 0xFF) << s;
+  }
+  out[0] = p0;
+  out[1] = p1;
+  out[2] = p2;
+  out[3] = p3;
+  out[4] = p4;
+  out[5] = p5;
+  out[6] = p6;
+  out[7] = p7;
+}
+
+// Bit 7 - k of a byte moved to bit 0 of byte k, planes 0 to 3 and 4 to 7
+struct Spread {
+  uint32_t high[256];
+  uint32_t low[256];
+  Spread() {
+    for (uint16_t v = 0; v < 256; v++) {
+      high[v] = low[v] = 0;
+      for (uint8_t k = 0; k < 4; k++) {
+        high[v] |= (uint32_t)(v >> (7 - k) & 1) << (8 * k);
+        low[v] |= (uint32_t)(v >> (3 - k) & 1) << (8 * k);
+      }
+    }
+  }
+};
+static const Spread spread;
+
+// Same planes as planes(), every channel of a group of 8 is shifted into the
+// planes from the table
+static inline void lookup(const uint32_t *in, uint32_t *out) {
+  const uint8_t *bytes = (const uint8_t *)in;
+  for (uint8_t k = 0; k < 8; k++) out[k] = 0;
+  for (uint8_t group = 0; group < 4; group++) {
+    uint32_t high = 0, low = 0;
+    for (uint8_t j = 0; j < 8; j++) {
+      const uint8_t v = bytes[group * 8 + j];
+      high |= spread.high[v] << j;
+      low |= spread.low[v] << j;
+    }
+    const uint8_t s = group << 3;
+    for (uint8_t k = 0; k < 4; k++) {
+      out[k] |= (high >> (8 * k) & 0xFF) << s;
+      out[k + 4] |= (low >> (8 * k) & 0xFF) << s;
+    }
+  }
+}
+
+// Same planes as planes(), a bit at a time
+static inline void single(const uint32_t *in, uint32_t *out) {
+  const uint8_t *bytes = (const uint8_t *)in;
+  for (uint8_t k = 0; k < 8; k++) {
+    uint32_t plane = 0;
+    for (uint8_t chn = 0; chn < Transpose::CHANNELS; chn++) {
+      plane |= (uint32_t)(bytes[chn] >> (7 - k) & 1) << chn;
+    }
+    out[k] = plane;
+  }
+}
+
+// Order the cube is stored in, how a voxel of a slice is found. Not named
+// after the WIREORDER and MORTON switches of Display.h, which are macros.
+enum store_t : uint8_t { STORE_XYZ, STORE_WIRE, STORE_ZORDER };
+
+// Gather every slice (blend, levels, scale and gain) and transpose it with
+// SLICE. The layout is a template parameter so the loop has no branches for
+// it. With more than one chain the words of the chains are interleaved. A
+// TWEEN blends a copy of the voxel and leaves the frame as it is. INDEXED
+// resolves the drawn palette indices first. A frame is calibrated or not as
+// a whole, so the branch on the gain is always predicted.
+template <void (*SLICE)(const uint32_t *, uint32_t *), store_t STORE,
+          bool OCCUPY, uint8_t CHAINS, bool TWEEN = false,
+          bool INDEXED = false>
+static uint32_t gather(const Transpose::frame_t &frame, uint32_t *out) {
+  Color *current = frame.current;
+  const Color *previous = frame.previous;
+  uint8_t *indices = frame.indices;
+  const Color *palette = frame.palette;
+  const uint16_t *levels = frame.levels;
+  const uint16_t scale = frame.scale;
+  const uint8_t(*gain)[3] = frame.gain;
+  // Offset of the planes of every color byte
+  const uint8_t ro = 8 * frame.order[0];
+  const uint8_t go = 8 * frame.order[1];
+  const uint8_t bo = 8 * frame.order[2];
+  uint32_t sum = 0;
+  Color copy;
+  // Channel bytes of a single slice, 4 channels per word
+  uint32_t red[Transpose::CHANNELS / 4];
+  uint32_t green[Transpose::CHANNELS / 4];
+  uint32_t blue[Transpose::CHANNELS / 4];
+  uint8_t *r = (uint8_t *)red;
+  uint8_t *g = (uint8_t *)green;
+  uint8_t *b = (uint8_t *)blue;
+  for (uint16_t led = 0; led < Transpose::LEDCOUNT; led++) {
+    const uint16_t *map =
+        (OCCUPY || STORE != STORE_WIRE) ? frame.map[led] : nullptr;
+    for (uint8_t chn = 0; chn < Transpose::CHANNELS; chn++) {
+      // Slices are stored consecutively in wire order, a linear read
+      const uint16_t i = STORE == STORE_WIRE ? led * Transpose::CHANNELS + chn
+                         : STORE == STORE_ZORDER ? Morton::packed(map[chn])
+                                                 : map[chn];
+      // Blend in place, the blended frame is the next previous frame. A
+      // tween blends a copy.
+      Color &voxel = TWEEN ? (copy = current[i]) : current[i];
+      if (INDEXED && indices[i]) {
+        voxel = palette[indices[i]];
+        indices[i] = 0;
+      }
+      const Color &c =
+          previous ? voxel.blend(frame.motionBlur, previous[i]) : voxel;
+      if (OCCUPY) {
+        frame.occupied[map[chn] >> 4] |= !c.isBlack() << (map[chn] & 0x0F);
+      }
+      const uint16_t lr = levels[c.r];
+      const uint16_t lg = levels[c.g];
+      const uint16_t lb = levels[c.b];
+      sum += lr + lg + lb;
+      const uint8_t t = Transpose::threshold(frame.dither, led, chn);
+      uint16_t sr = scale, sg = scale, sb = scale;
+      if (gain) {
+        const uint8_t *k = gain[led * Transpose::CHANNELS + chn];
+        sr = Transpose::calibrate(scale, k[0]);
+        sg = Transpose::calibrate(scale, k[1]);
+        sb = Transpose::calibrate(scale, k[2]);
+      }
+      r[chn] = (((lr * sr) >> 8) + t) >> 4;
+      g[chn] = (((lg * sg) >> 8) + t) >> 4;
+      b[chn] = (((lb * sb) >> 8) + t) >> 4;
+    }
+    if (CHAINS == 1) {
+      uint32_t *offset = out + led * Transpose::BITCOUNT;
+      SLICE(red, offset + ro);
+      SLICE(green, offset + go);
+      SLICE(blue, offset + bo);
+      continue;
+    }
+    uint32_t bits[Transpose::BITCOUNT];
+    SLICE(red, bits + ro);
+    SLICE(green, bits + go);
+    SLICE(blue, bits + bo);
+    const uint16_t half = Transpose::LEDCOUNT / CHAINS;
+    uint32_t *offset =
+        out + (led % half) * Transpose::BITCOUNT * CHAINS + led / half;
+    for (uint8_t i = 0; i < Transpose::BITCOUNT; i++)
+      offset[i * CHAINS] = bits[i];
+  }
+  return sum;
+}
+
+template <void (*SLICE)(const uint32_t *, uint32_t *), store_t STORE,
+          uint8_t CHAINS>
+static uint32_t stored(const Transpose::frame_t &frame, uint32_t *out) {
+  if (frame.tween) return gather<SLICE, STORE, false, CHAINS, true>(frame, out);
+  if (frame.indices) {
+    return frame.occupied
+               ? gather<SLICE, STORE, true, CHAINS, false, true>(frame, out)
+               : gather<SLICE, STORE, false, CHAINS, false, true>(frame, out);
+  }
+  return frame.occupied ? gather<SLICE, STORE, true, CHAINS>(frame, out)
+                        : gather<SLICE, STORE, false, CHAINS>(frame, out);
+}
+
+template <void (*SLICE)(const uint32_t *, uint32_t *), uint8_t CHAINS = 1>
+static uint32_t layout(const Transpose::frame_t &frame, uint32_t *out) {
+  if (frame.wireOrder) return stored<SLICE, STORE_WIRE, CHAINS>(frame, out);
+  if (frame.morton) return stored<SLICE, STORE_ZORDER, CHAINS>(frame, out);
+  return stored<SLICE, STORE_XYZ, CHAINS>(frame, out);
+}
+
+uint32_t Transpose::bitplane(const frame_t &frame, uint32_t *out) {
+  return layout<planes>(frame, out);
+}
+
+uint32_t Transpose::table(const frame_t &frame, uint32_t *out) {
+  return layout<lookup>(frame, out);
+}
+
+uint32_t Transpose::bits(const frame_t &frame, uint32_t *out) {
+  return layout<single>(frame, out);
+}
+
+uint32_t Transpose::interleaved(const frame_t &frame, uint32_t *out) {
+  return layout<planes, 2>(frame, out);
+}
+
+// The 32 channel bytes of a led are consecutive in every plane, so they are
+// blended a word (4 channels) at a time. The planes have to be word aligned.
+uint32_t Transpose::planar(const planar_t &frame, uint32_t *out) {
+  const uint16_t *levels = frame.levels;
+  const uint16_t scale = frame.scale;
+  uint32_t sum = 0;
+  uint32_t slice[CHANNELS / 4];
+  uint8_t *bytes = (uint8_t *)slice;
+  for (uint16_t led = 0; led < LEDCOUNT; led++) {
+    for (uint8_t plane = 0; plane < 3; plane++) {
+      uint32_t *current = (uint32_t *)(frame.current[plane] + led * CHANNELS);
+      const uint32_t *previous =
+          (const uint32_t *)(frame.previous[plane] + led * CHANNELS);
+      for (uint8_t w = 0; w < CHANNELS / 4; w++) {
+        current[w] = ublend8(current[w], previous[w], frame.motionBlur);
+        slice[w] = current[w];
+      }
+      for (uint8_t chn = 0; chn < CHANNELS; chn++) {
+        const uint16_t level = levels[bytes[chn]];
+        sum += level;
+        const uint8_t t = threshold(frame.dither, led, chn);
+        bytes[chn] = (((level * scale) >> 8) + t) >> 4;
+      }
+      planes(slice, out + led * BITCOUNT + plane * 8);
+    }
+  }
+  return sum;
+}
+
+#if defined TRANSPOSE_BENCH
+#include <Arduino.h>
+
+#include "power/Noise.h"
+
+// A dense random frame (the bit plane path) through every variant, the led
+// data of all of them has to equal bitplane(), interleaved() after taking the
+// chains apart again.
+void Transpose::benchmark() {
+  const uint16_t VOXELS = LEDCOUNT * CHANNELS;
+  const uint8_t FRAMES = 16;
+  DMAMEM static Color source[2][VOXELS];
+  DMAMEM static Color current[VOXELS];
+  DMAMEM static uint32_t split[2][3][VOXELS / 4];
+  DMAMEM static uint32_t reference[WORDS];
+  DMAMEM static uint32_t out[WORDS];
+  static uint16_t levels[256];
+  // Gamma with a fraction, so the dithering is part of the comparison
+  for (uint16_t v = 0; v < 256; v++) levels[v] = Color::GAMMA[v] << 4 | v % 16;
+  for (uint8_t f = 0; f < 2; f++) {
+    for (uint16_t i = 0; i < VOXELS; i++) {
+      const uint32_t random = Noise::next32();
+      source[f][i] = Color(random, random >> 8, random >> 16);
+    }
+  }
+
+  frame_t frame = {current, source[1], true,    nullptr, nullptr,
+                   220,     levels,    200,     5,       {0, 1, 2},
+                   false,   nullptr,   nullptr, nullptr, false};
+  planar_t plane = {{}, {}, 220, levels, 200, 5};
+  for (uint8_t p = 0; p < 3; p++) {
+    plane.current[p] = (uint8_t *)split[0][p];
+    plane.previous[p] = (const uint8_t *)split[1][p];
+  }
+
+  const char *names[] = {"bitplane", "table", "bits", "planar", "interleaved"};
+  Serial.printf("%-12s %12s %10s\n", "Transpose", "cycles", "us");
+  for (uint8_t variant = 0; variant < 5; variant++) {
+    uint32_t cycles = 0;
+    for (uint8_t f = 0; f < FRAMES; f++) {
+      // Every frame blends the same two frames
+      std::copy(source[0], source[0] + VOXELS, current);
+      for (uint16_t i = 0; variant == 3 && i < VOXELS; i++) {
+        plane.current[0][i] = source[0][i].r;
+        plane.current[1][i] = source[0][i].g;
+        plane.current[2][i] = source[0][i].b;
+        ((uint8_t *)split[1][0])[i] = source[1][i].r;
+        ((uint8_t *)split[1][1])[i] = source[1][i].g;
+        ((uint8_t *)split[1][2])[i] = source[1][i].b;
+      }
+      const uint32_t start = ARM_DWT_CYCCNT;
+      switch (variant) {
+        case 0: bitplane(frame, reference); break;
+        case 1: table(frame, out); break;
+        case 2: bits(frame, out); break;
+        case 3: planar(plane, out); break;
+        case 4: interleaved(frame, out); break;
+      }
+      cycles += ARM_DWT_CYCCNT - start;
+    }
+    cycles /= FRAMES;
+    bool same =
+        !variant || variant == 4 || !memcmp(out, reference, sizeof(out));
+    for (uint16_t w = 0; variant == 4 && w < WORDS; w++) {
+      const uint16_t half = LEDCOUNT / 2;
+      const uint16_t led = w / 2 / BITCOUNT + (w % 2) * half;
+      same &= out[w] == reference[led * BITCOUNT + w / 2 % BITCOUNT];
+    }
+    Serial.printf("%-12s %12lu %10.1f%s\n", names[variant],
+                  (unsigned long)cycles, cycles / (F_CPU_ACTUAL / 1000000.0f),
+                  same ? "" : " differs");
+  }
+}
+#endif
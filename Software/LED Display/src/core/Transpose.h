@@ -0,0 +1,134 @@
+#ifndef TRANSPOSE_H
+#define TRANSPOSE_H
+#include <stdint.h>
+
+#include "power/Color.h"
+
+// Print the cycles per frame of every transpose at startup
+// #define TRANSPOSE_BENCH
+/*------------------------------------------------------------------------------
+ * TRANSPOSE CLASS
+ *------------------------------------------------------------------------------
+ * Turns a cube into the led data of the 32 channels, the part of the display
+ * that runs every frame whatever the animation. No hardware is involved, the
+ * same code runs on the Teensy and on the host (simulator benchmarks).
+ *
+ * The led data is 24 words per led (BITCOUNT * LEDCOUNT words), word i holds
+ * bit 7 - i % 8 of the color byte i / 8 and bit n of a word is channel n. The
+ * order of the color bytes is that of the leds (order, red first for rgb). On
+ * the way every voxel is blended in place with the previous frame (the
+ * blended frame is the next previous frame), mapped through the brightness
+ * and gamma levels and scaled by the power scale (256 is 1). The functions
+ * return the sum of the levels, the current estimate of the frame.
+ *
+ * Levels have 12 bits, 16 times the byte sent to the led. The 4 bits of
+ * fraction are dithered over frames: threshold() of the frame's dither phase
+ * is added before they are dropped. The threshold of a voxel takes all 16
+ * values in 16 frames, so a voxel averages its exact level over them instead
+ * of banding at low brightness. Levels without fraction are sent unchanged.
+ *
+ * The 32 voxels of a led (a slice) are gathered in wire order or through the
+ * voxel map, from a cube stored in (x, y, z) or Morton order. The variants differ in how a slice becomes bits:
+ *   bitplane() transposes the channel bytes in registers (Hacker's Delight
+ *              7-3), what Display uses
+ *   table()    spreads every channel byte with a 256 entry table
+ *   bits()     moves one bit at a time, like the original rotation
+ *   planar()   like bitplane() on a cube stored as separate r, g and b planes
+ *              in wire order, blending four channels per word
+ *
+ * interleaved() is bitplane() for the leds driven as two chains of LEDCOUNT /
+ * 2 (64 channels, CHANNELS64 in Display.h): led l of a channel is led l % 64
+ * of chain l / 64. The words of the chains alternate, word 2w is chain 0 and
+ * word 2w + 1 chain 1, so every dma request takes one word of each.
+ *
+ * A calibrated frame scales every die of a led by its gain on top of the
+ * power scale, one multiply per color like the power scale itself. The sum
+ * stays that of the uncalibrated levels, which never underestimates.
+ *
+ * A tween frame blends the same way but into a copy, it sends a frame in
+ * between previous and current (motionBlur 255 is previous, 0 current).
+ *
+ * An indexed frame was drawn as palette indices (Display::setPalette()), the
+ * gather resolves them to current before blending. Drawing wrote a byte per
+ * voxel and the palette holds the hue rotation and brightness, so the colors
+ * cost a lookup per voxel here instead.
+ *
+ * With TRANSPOSE_BENCH defined benchmark() prints the cycles per frame of
+ * each on Serial and checks they all produce the same led data.
+ *----------------------------------------------------------------------------*/
+class Transpose {
+ public:
+  static const uint8_t BITCOUNT = 24;
+  static const uint16_t LEDCOUNT = 128;
+  static const uint8_t CHANNELS = 32;
+  static const uint16_t WORDS = BITCOUNT * LEDCOUNT;
+
+  struct frame_t {
+    // Frame to send, blended in place, and the frame sent before it (nullptr
+    // when current is blended already)
+    Color *current;
+    const Color *previous;
+    // Cube in wire order (led * CHANNELS + chn), otherwise indexed by map
+    bool wireOrder;
+    // Voxel index of every led and channel, needed unless in wire order
+    // without occupied
+    const uint16_t (*map)[CHANNELS];
+    // Lit voxels of the blended frame per column, nullptr to skip
+    uint16_t *occupied;
+    uint8_t motionBlur;
+    // Brightness and gamma output levels (12 bit), power scale
+    const uint16_t *levels;
+    uint16_t scale;
+    // Dither phase of the frame (0 to 15)
+    uint8_t dither;
+    // Position (0 to 2) of the red, green and blue byte on the wire
+    uint8_t order[3];
+    // Blend a copy, current is left as it is (an interpolated frame). Needs
+    // no occupied.
+    bool tween;
+    // Indexed frame, nullptr for rgb. A voxel with an index is first set to
+    // its palette color in current and the index cleared. Not for a tween.
+    uint8_t *indices;
+    const Color *palette;
+    // Gain of the red, green and blue die of every led (led * CHANNELS +
+    // chn, 255 is 1 and 0 masks), nullptr for none. See Calibration.h
+    const uint8_t (*gain)[3];
+    // Cube in Morton order (power/Morton.h), map still holds x, y and z and
+    // the index is spread from it. Not with wireOrder.
+    bool morton;
+  };
+
+  // Always sent as rgb
+  struct planar_t {
+    // Planes in wire order, current blended in place
+    uint8_t *current[3];
+    const uint8_t *previous[3];
+    uint8_t motionBlur;
+    const uint16_t *levels;
+    uint16_t scale;
+    uint8_t dither;
+  };
+
+  // Added to the 12 bit level of led and chn before the fraction is dropped.
+  // Neighbouring leds and channels are spread over the 16 thresholds.
+  static inline uint8_t threshold(const uint8_t dither, const uint16_t led,
+                                  const uint8_t chn) {
+    return (dither + 7 * led + 11 * chn) & 15;
+  }
+
+  // Power scale of a die with gain (0 to 255), 255 keeps the scale
+  static inline uint16_t calibrate(const uint16_t scale, const uint8_t gain) {
+    return (scale * (gain + (gain >> 7))) >> 8;
+  }
+
+  static uint32_t bitplane(const frame_t &frame, uint32_t *out);
+  static uint32_t table(const frame_t &frame, uint32_t *out);
+  static uint32_t bits(const frame_t &frame, uint32_t *out);
+  static uint32_t planar(const planar_t &frame, uint32_t *out);
+  static uint32_t interleaved(const frame_t &frame, uint32_t *out);
+
+#if defined TRANSPOSE_BENCH
+  static void benchmark();
+#endif
+};
+#endif
@@ -0,0 +1,41 @@
+#include "USB.h"
+
+#include <Arduino.h>
+
+#include "Alloc.h"
+#include "Frame.h"
+/*------------------------------------------------------------------------------
+ * USB CLASS
+ *----------------------------------------------------------------------------*/
+// The frames and commands of the ESP8266 link, see ESP8266.cpp
+void execute(frame_t type, uint8_t* payload, uint16_t size);
+
+uint32_t USB::bytes = 0;
+uint32_t USB::frames = 0;
+uint32_t USB::errors = 0;
+
+// Runs from serialEvent() like the device samples of the ESP8266 link from
+// serialEvent1(), on the same thread, so both can publish devices and voxels
+void USB::loop() {
+  HOT_PATH("usb");
+  static Frame parser;
+  uint8_t chunk[512];
+  uint32_t budget = USB_RX_BYTES;
+  const uint32_t start = micros();
+  int available;
+  while (budget > 0 && micros() - start < USB_RX_MICROS &&
+         (available = Serial.available()) > 0) {
+    size_t n = available < (int)sizeof(chunk) ? available : sizeof(chunk);
+    if (n > budget) n = budget;
+    n = Serial.readBytes((char*)chunk, n);
+    budget -= n;
+    bytes += n;
+    for (size_t i = 0; i < n; i++) {
+      if (parser.feed(chunk[i]) == Frame::FRAME) {
+        frames++;
+        execute(parser.type(), parser.payload(), parser.size());
+      }
+    }
+  }
+  errors = parser.errors();
+}
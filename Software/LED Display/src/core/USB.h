@@ -0,0 +1,35 @@
+#ifndef USB_H
+#define USB_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * USB CLASS
+ *------------------------------------------------------------------------------
+ * Frames of a host on the USB serial port, the same binary frames as on the
+ * ESP8266 link (core/Frame.h). The port runs at 480 Mbit whatever baudrate
+ * the host opens it with, a full RGB voxel frame of 12 KB in 17 VOXELS
+ * chunks takes well under a millisecond, so a host can drive the Streaming
+ * animation at 60 frames per second and more where WiFi is not reliable.
+ * The chunks land in the back buffer of core/Voxels.h, so the animation
+ * shows the last complete frame while the next one arrives.
+ *
+ * There is no throttle, bytes that are not read stay with the host: USB only
+ * sends when the Teensy has room. Bytes outside of frames are ignored, the
+ * port carries the console output the other way. JSON frames are commands
+ * as on the ESP8266 link, their replies go out to the ESP8266.
+ *
+ * void serialEvent() { USB::loop(); }
+ *----------------------------------------------------------------------------*/
+// Receive budget of one loop() call, the rest waits for the next one
+#define USB_RX_BYTES 16384
+#define USB_RX_MICROS 1000
+
+class USB {
+ public:
+  // Bytes and frames received and frames dropped by the parser
+  static uint32_t bytes;
+  static uint32_t frames;
+  static uint32_t errors;
+
+  static void loop();
+};
+#endif
@@ -0,0 +1,102 @@
+#include "Voxels.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+#include "power/VoxelCodec.h"
+/*------------------------------------------------------------------------------
+ * VOXELS CLASS
+ *----------------------------------------------------------------------------*/
+// Two frames of 12 KB in RAM2, chunks and the animation access them in order
+DMAMEM static Color buffers[2][VOXELS_COUNT];
+
+uint32_t Voxels::completed = 0;
+uint32_t Voxels::dropped = 0;
+Color *Voxels::front = buffers[0];
+Color *Voxels::back = buffers[1];
+Color Voxels::palette[256];
+uint32_t Voxels::filled[VOXELS_COUNT / 32];
+uint16_t Voxels::count = 0;
+uint16_t Voxels::current = 0;
+uint16_t Voxels::shown = 0;
+bool Voxels::receiving = false;
+
+// A sender that restarts its sequence is followed after this many frames back
+static const int16_t RESTARTED = -16;
+
+void Voxels::begin() { memset(buffers, 0, sizeof(buffers)); }
+
+void Voxels::restart(const uint16_t sequence) {
+  if (receiving) dropped++;
+  receiving = true;
+  current = sequence;
+  count = 0;
+  memset(filled, 0, sizeof(filled));
+}
+
+void Voxels::receive(const uint8_t *chunk, const uint16_t size) {
+  static bool synced = false;
+  if (size < VOXELS_HEADER) return;
+  const uint16_t sequence = chunk[0] | chunk[1] << 8;
+  const voxels_t format = (voxels_t)chunk[2];
+  const uint16_t offset = chunk[3] | chunk[4] << 8;
+  const uint16_t n = chunk[5] | chunk[6] << 8;
+  const uint8_t *data = chunk + VOXELS_HEADER;
+  const uint16_t bytes = size - VOXELS_HEADER;
+
+  if (format == voxels_t::PALETTE) {
+    if (offset + n > 256 || bytes != n * 3) return;
+    for (uint16_t i = 0; i < n; i++, data += 3)
+      palette[offset + i] = Color(data[0], data[1], data[2]);
+    return;
+  }
+  if (offset + n > VOXELS_COUNT) return;
+
+  // Chunks of an older frame are late, the newer one is being assembled
+  const int16_t age = sequence - current;
+  if (!synced || age > 0 || age < RESTARTED) {
+    synced = true;
+    restart(sequence);
+  } else if (age < 0 || !receiving) {
+    return;
+  }
+
+  Color *v = &back[offset];
+  switch (format) {
+    case voxels_t::RGB:
+      if (bytes != n * 3) return;
+      for (uint16_t i = 0; i < n; i++, data += 3)
+        v[i] = Color(data[0], data[1], data[2]);
+      break;
+    case voxels_t::INDEXED:
+      if (bytes != n) return;
+      for (uint16_t i = 0; i < n; i++) v[i] = palette[data[i]];
+      break;
+    case voxels_t::RLE:
+      if ((offset | n) % 16) return;
+      if (!VoxelCodec::decode_rle(v, palette, data, bytes, n / 16)) return;
+      break;
+    case voxels_t::DELTA:
+      // Only on top of the frame right before it
+      if (!completed || shown != (uint16_t)(sequence - 1)) return;
+      if (!VoxelCodec::decode_delta(v, &front[offset], data, bytes, n)) return;
+      break;
+    default:
+      return;
+  }
+  // Count every voxel once, a repeated chunk must not complete the frame
+  for (uint16_t i = offset; i < offset + n; i++) {
+    const uint32_t bit = 1u << (i & 31);
+    if (filled[i >> 5] & bit) continue;
+    filled[i >> 5] |= bit;
+    count++;
+  }
+  if (count < VOXELS_COUNT) return;
+
+  Color *t = front;
+  front = back;
+  back = t;
+  shown = current;
+  receiving = false;
+  completed++;
+}
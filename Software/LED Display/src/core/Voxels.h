@@ -0,0 +1,62 @@
+#ifndef VOXELS_H
+#define VOXELS_H
+#include <stdint.h>
+
+#include "power/Color.h"
+#include "power/VoxelCodec.h"
+/*------------------------------------------------------------------------------
+ * VOXELS CLASS
+ *------------------------------------------------------------------------------
+ * Live voxel frames from the network, sent in chunks as VOXELS frames. Every
+ * chunk starts with a header of 7 bytes:
+ *
+ *   sequence (LE16), format, offset (LE16), count (LE16)
+ *
+ *   RGB      count voxels of 3 bytes, from voxel offset on
+ *   INDEXED  count voxels of 1 byte into the palette, from voxel offset on
+ *   PALETTE  count palette entries of 3 bytes, from palette index offset on
+ *   RLE      count voxels as runs in palette colors per z column, offset and
+ *            count are whole columns (power/VoxelCodec.h)
+ *   DELTA    count voxels as XOR against the frame of the sequence before,
+ *            with runs of unchanged voxels skipped (power/VoxelCodec.h)
+ *
+ * Voxel i is x = i / 256, y = i / 16 % 16 and z = i % 16, the [x][y][z]
+ * order of the cube buffers. The chunks of a frame land straight in the back
+ * buffer, once every voxel of a sequence arrived it becomes the front buffer.
+ * A newer sequence abandons an incomplete frame, so a lost chunk costs one
+ * frame and the last complete one stays on display. The palette is kept
+ * between frames and only has to be sent when it changes. A DELTA chunk
+ * needs the frame before it on display, after a lost frame the sender has to
+ * send a keyframe without deltas first.
+ *
+ * receive() runs from the serial event handler and the animations read
+ * between loops on the same thread, swapping the buffers needs no lock.
+ *----------------------------------------------------------------------------*/
+class Voxels {
+ public:
+  // Complete frames and frames that were abandoned or came too late
+  static uint32_t completed;
+  static uint32_t dropped;
+
+  // Clear both frames, DMAMEM is not zeroed at startup. Before the link.
+  static void begin();
+  static void receive(const uint8_t *chunk, const uint16_t size);
+  // The latest complete frame, black until the first one arrived
+  static const Color *frame() { return front; }
+  // Sequence of the latest complete frame
+  static uint16_t sequence() { return shown; }
+
+ private:
+  static Color *front;
+  static Color *back;
+  static Color palette[256];
+  // Voxels of the back buffer written for the current sequence
+  static uint32_t filled[VOXELS_COUNT / 32];
+  static uint16_t count;
+  static uint16_t current;
+  static uint16_t shown;
+  static bool receiving;
+
+  static void restart(const uint16_t sequence);
+};
+#endif
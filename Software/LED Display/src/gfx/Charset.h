@@ -1,2723 +1,2719 @@
+#ifndef CHARSET_SPRITE_H
+#define CHARSET_SPRITE_H
 #include <stdint.h>
 
+#include "power/Memory.h"
+#include "power/Sprite.h"
+
 #define CHARSET_FRAME_COUNT 59
 #define CHARSET_FRAME_WIDTH 16
 #define CHARSET_FRAME_HEIGHT 17
 
-/* Piskel data for "Charset" */
+/* 59 frames, 4973 colors, 8166 runs (sprite_convert.py) */
+
+HOTMEM const uint8_t charset_palette[] = {
+    0xa4, 0xee, 0xd7, 0xed, 0xff, 0xff, 0x6a, 0xe5, 0xbf, 0x3f, 0x58, 0x82,
+    0xa5, 0xf0, 0xd7, 0xd9, 0xfa, 0xf1, 0x44, 0xdc, 0xac, 0x40, 0x63, 0x7e,
+    0x4a, 0x1a, 0x6c, 0x48, 0x34, 0x75, 0xfb, 0xff, 0xff, 0xe1, 0xa4, 0xea,
+    0xa4, 0x3b, 0xa7, 0x5f, 0x1a, 0x75, 0x45, 0x53, 0x79, 0x4a, 0x57, 0x83,
+    0xff, 0xc4, 0xff, 0xdf, 0x62, 0xdc, 0x9b, 0x30, 0x9b, 0x90, 0x16, 0x8c,
+    0x4c, 0x6e, 0x86, 0x46, 0x7a, 0x84, 0xfe, 0xe1, 0xff, 0xc5, 0x58, 0xc6,
+    0x98, 0x1f, 0x92, 0x7d, 0x1b, 0x83, 0x45, 0x5e, 0x86, 0x39, 0x94, 0x94,
+    0xec, 0xff, 0xfc, 0x64, 0xbe, 0xb5, 0x70, 0x31, 0x86, 0x4b, 0x19, 0x6b,
+    0x3b, 0xaf, 0x9d, 0x36, 0xa1, 0x95, 0xed, 0xff, 0xfc, 0x40, 0xe2, 0xab,
+    0x40, 0x4b, 0x79, 0x4c, 0x16, 0x6a, 0x36, 0xb6, 0xa6, 0x42, 0x70, 0x87,
+    0xef, 0xff, 0xfd, 0x47, 0xdb, 0xad, 0x49, 0x46, 0x7b, 0x49, 0x1b, 0x6c,
+    0x42, 0x9c, 0x9a, 0x46, 0x6b, 0x8c, 0xb8, 0xff, 0xec, 0x48, 0xde, 0xae,
+    0x44, 0x48, 0x79, 0x4a, 0x1a, 0x6e, 0x44, 0x92, 0x8c, 0x49, 0x9b, 0x93,
+    0x37, 0xbd, 0x9e, 0x3e, 0xdc, 0xa9, 0x86, 0x3d, 0x95, 0x9d, 0x26, 0x9b,
+    0x6c, 0x8c, 0xa3, 0x43, 0x59, 0x7e, 0x42, 0x46, 0x76, 0x7b, 0x5f, 0x9e,
+    0xc0, 0x41, 0xb9, 0xb8, 0x4c, 0xb8, 0xaf, 0x44, 0xb0, 0x4c, 0x26, 0x6f,
+    0x98, 0xa0, 0xc1, 0xf8, 0x7a, 0xec, 0xcb, 0x4d, 0xc5, 0x84, 0x2e, 0x90,
+    0x8a, 0xe9, 0xce, 0xfd, 0xff, 0xff, 0xc6, 0xe1, 0xe9, 0x87, 0x88, 0xb9,
+    0x4f, 0x3f, 0x7f, 0x47, 0x30, 0x73, 0x7f, 0xe6, 0xc5, 0xc3, 0xff, 0xec,
+    0x37, 0xc4, 0x9d, 0x3c, 0x50, 0x7c, 0x49, 0x3e, 0x78, 0x47, 0x83, 0x92,
+    0x3b, 0xbe, 0x8f, 0x3a, 0xb6, 0x9a, 0x49, 0x4a, 0x81, 0x4d, 0x39, 0x78,
+    0x3e, 0xb0, 0x9a, 0x3b, 0x81, 0x8a, 0x4d, 0x4d, 0x82, 0x49, 0x31, 0x77,
+    0x46, 0x8a, 0x95, 0x3c, 0x99, 0x95, 0xff, 0xff, 0xff, 0xe7, 0xef, 0xff,
+    0xd6, 0xd6, 0xff, 0x73, 0x6b, 0x9c, 0x73, 0x73, 0xa5, 0x39, 0x39, 0x73,
+    0x5a, 0x5a, 0x84, 0x7b, 0x7b, 0xad, 0xa5, 0xa5, 0xd6, 0x84, 0x84, 0xb5,
+    0x6b, 0x6b, 0xa5, 0x8c, 0x8c, 0xb5, 0x94, 0x94, 0xbd, 0xff, 0x10, 0x08,
+    0xff, 0x73, 0x73, 0xff, 0x31, 0x29, 0xff, 0x29, 0x21, 0xff, 0x18, 0x10,
+    0xd6, 0x08, 0x08, 0xef, 0x6b, 0x63, 0xff, 0x9c, 0x9c, 0xff, 0xa5, 0x9c,
+    0xff, 0x39, 0x29, 0xff, 0x4a, 0x39, 0xf7, 0x18, 0x18, 0xc6, 0x08, 0x08,
+    0xde, 0xa5, 0x9c, 0xef, 0x94, 0x8c, 0xf7, 0x9c, 0x94, 0xff, 0x21, 0x18,
+    0xff, 0x39, 0x31, 0xe7, 0x10, 0x08, 0xb5, 0x08, 0x08, 0xd6, 0x6b, 0x63,
+    0xde, 0x73, 0x73, 0xe7, 0x52, 0x4a, 0xe7, 0x10, 0x10, 0xef, 0x18, 0x10,
+    0xad, 0x08, 0x08, 0x73, 0x08, 0x08, 0x7b, 0x21, 0x18, 0xad, 0x31, 0x21,
+    0xc6, 0x10, 0x10, 0xce, 0x08, 0x08, 0xbd, 0x08, 0x08, 0x9c, 0x08, 0x08,
+    0x73, 0x10, 0x08, 0x63, 0x42, 0x29, 0x73, 0x4a, 0x31, 0x52, 0x39, 0x21,
+    0x7b, 0x29, 0x21, 0x9c, 0x21, 0x18, 0x9c, 0x18, 0x10, 0x94, 0x08, 0x08,
+    0xa5, 0x08, 0x08, 0xd6, 0xbd, 0xa5, 0xef, 0xce, 0x9c, 0xbd, 0xce, 0xe7,
+    0xe7, 0xce, 0x9c, 0xff, 0xbd, 0x7b, 0xef, 0xa5, 0x6b, 0xa5, 0x63, 0x39,
+    0x84, 0x08, 0x08, 0x8c, 0x08, 0x08, 0x7b, 0x08, 0x08, 0xc6, 0x9c, 0x6b,
+    0xf7, 0xe7, 0xce, 0x4a, 0x7b, 0x9c, 0xb5, 0x9c, 0x73, 0xde, 0x9c, 0x63,
+    0x73, 0x42, 0x21, 0x5a, 0x29, 0x10, 0xe7, 0xb5, 0x73, 0xef, 0xad, 0x6b,
+    0xa5, 0x52, 0x39, 0xff, 0xc6, 0x7b, 0xe7, 0x9c, 0x63, 0xd6, 0x9c, 0x63,
+    0xe7, 0xd6, 0xbd, 0x42, 0x7b, 0x94, 0xde, 0xb5, 0x73, 0xb5, 0x7b, 0x4a,
+    0x63, 0x31, 0x18, 0xa5, 0x7b, 0x4a, 0xd6, 0x94, 0x63, 0xce, 0x8c, 0x5a,
+    0xff, 0xd6, 0x8c, 0xf7, 0xad, 0x6b, 0xbd, 0x84, 0x52, 0xd6, 0xad, 0x73,
+    0x84, 0x73, 0x63, 0x4a, 0x42, 0x39, 0xde, 0xa5, 0x6b, 0xc6, 0x94, 0x5a,
+    0xa5, 0x6b, 0x4a, 0xef, 0xb5, 0x73, 0xc6, 0x84, 0x52, 0x8c, 0x5a, 0x39,
+    0x31, 0x29, 0x21, 0x29, 0x29, 0x29, 0x39, 0x29, 0x21, 0x9c, 0x63, 0x42,
+    0xf7, 0xc6, 0x7b, 0xa5, 0x6b, 0x42, 0x6b, 0x42, 0x29, 0x21, 0x18, 0x10,
+    0x08, 0x08, 0x08, 0x29, 0x18, 0x10, 0xde, 0x94, 0x63, 0xbd, 0x7b, 0x52,
+    0x94, 0x63, 0x39, 0x39, 0x21, 0x18, 0x5a, 0x39, 0x29, 0x84, 0x5a, 0x39,
+    0xd6, 0x94, 0x5a, 0xad, 0x73, 0x4a, 0x29, 0x10, 0x08, 0x9c, 0x6b, 0x42,
+    0x7b, 0x52, 0x31, 0x7b, 0x4a, 0x31, 0x42, 0x21, 0x10, 0x94, 0x5a, 0x39,
+    0xc6, 0x73, 0x00, 0xde, 0x94, 0x00, 0xef, 0xad, 0x10, 0xe7, 0xa5, 0x00,
+    0xce, 0x84, 0x00, 0xb5, 0x5a, 0x00, 0xc6, 0x6b, 0x00, 0xff, 0xbd, 0x00,
+    0xff, 0xef, 0x29, 0xff, 0xff, 0x84, 0xff, 0xf7, 0x5a, 0xef, 0xbd, 0x31,
+    0xd6, 0xa5, 0x29, 0xce, 0x8c, 0x21, 0xbd, 0x63, 0x00, 0x94, 0x42, 0x00,
+    0xff, 0xa5, 0x00, 0xff, 0xce, 0x21, 0xff, 0xff, 0x94, 0xf7, 0xde, 0x6b,
+    0xc6, 0xa5, 0x4a, 0xbd, 0x9c, 0x42, 0x9c, 0x6b, 0x21, 0xc6, 0x9c, 0x42,
+    0xb5, 0x7b, 0x21, 0x8c, 0x42, 0x00, 0xf7, 0x84, 0x00, 0xff, 0x94, 0x00,
+    0xff, 0xff, 0x73, 0xff, 0xef, 0x6b, 0x9c, 0x63, 0x21, 0xbd, 0x8c, 0x31,
+    0xad, 0x7b, 0x21, 0xce, 0x6b, 0x00, 0xf7, 0x94, 0x00, 0xff, 0xc6, 0x29,
+    0xff, 0xf7, 0x6b, 0xce, 0xa5, 0x4a, 0xa5, 0x6b, 0x18, 0xc6, 0x8c, 0x31,
+    0xbd, 0x84, 0x29, 0x8c, 0x4a, 0x00, 0xef, 0x94, 0x00, 0xef, 0x9c, 0x00,
+    0xff, 0xc6, 0x31, 0xef, 0xbd, 0x4a, 0xad, 0x84, 0x31, 0x9c, 0x63, 0x18,
+    0x94, 0x5a, 0x10, 0xc6, 0x84, 0x31, 0xce, 0x8c, 0x31, 0xc6, 0x8c, 0x29,
+    0x9c, 0x6b, 0x18, 0xe7, 0x94, 0x00, 0xde, 0x9c, 0x10, 0xbd, 0x8c, 0x29,
+    0x7b, 0x39, 0x00, 0xb5, 0x73, 0x21, 0xbd, 0x7b, 0x29, 0xbd, 0x73, 0x21,
+    0xa5, 0x63, 0x18, 0xa5, 0x63, 0x10, 0xc6, 0x94, 0x21, 0xd6, 0x8c, 0x00,
+    0xe7, 0xad, 0x29, 0xce, 0xa5, 0x42, 0xad, 0x73, 0x18, 0xd6, 0x94, 0x39,
+    0xff, 0xff, 0xc6, 0xc6, 0x7b, 0x00, 0xce, 0x8c, 0x00, 0xe7, 0xb5, 0x31,
+    0xff, 0xff, 0x6b, 0xff, 0xff, 0x9c, 0xce, 0xad, 0x4a, 0xb5, 0x63, 0x00,
+    0xad, 0x63, 0x00, 0xb5, 0x84, 0x21, 0xc6, 0x9c, 0x39, 0xce, 0x94, 0x39,
+    0xde, 0xad, 0x42, 0xce, 0x9c, 0x39, 0xbd, 0x94, 0x42, 0x94, 0x4a, 0x00,
+    0xd6, 0x94, 0x31, 0xf7, 0xb5, 0x21, 0xd6, 0x94, 0x29, 0xe7, 0xa5, 0x39,
+    0xce, 0x94, 0x21, 0x9c, 0x73, 0x29, 0x84, 0x31, 0x00, 0x7b, 0x31, 0x00,
+    0x9c, 0x5a, 0x00, 0xce, 0xad, 0x52, 0xbd, 0x7b, 0x10, 0xff, 0xde, 0x10,
+    0xff, 0xff, 0x4a, 0xde, 0xb5, 0x39, 0xc6, 0x84, 0x10, 0xf7, 0xbd, 0x29,
+    0xce, 0x94, 0x10, 0x7b, 0x42, 0x08, 0x5a, 0x18, 0x00, 0x73, 0x31, 0x00,
+    0xad, 0x6b, 0x18, 0xe7, 0xad, 0x18, 0xff, 0xe7, 0x52, 0xd6, 0xb5, 0x52,
+    0xb5, 0x8c, 0x39, 0x63, 0x21, 0x00, 0x52, 0x18, 0x00, 0x84, 0x4a, 0x08,
+    0xad, 0x73, 0x29, 0x6b, 0x29, 0x00, 0x63, 0x29, 0x00, 0x8c, 0x5a, 0x18,
+    0x9c, 0x6b, 0x29, 0xa5, 0x7b, 0x31, 0xc6, 0xa5, 0x42, 0xbd, 0x94, 0x39,
+    0x94, 0x63, 0x18, 0x6b, 0x31, 0x00, 0x73, 0x42, 0x00, 0x73, 0x39, 0x00,
+    0xff, 0xc6, 0x10, 0xce, 0x84, 0x08, 0xff, 0xe7, 0x21, 0xd6, 0x8c, 0x08,
+    0xff, 0xf7, 0x4a, 0xe7, 0x9c, 0x10, 0x9c, 0x52, 0x00, 0xff, 0xd6, 0x18,
+    0xff, 0xff, 0x4a, 0xef, 0xad, 0x10, 0xbd, 0x73, 0x08, 0xff, 0xde, 0x18,
+    0xff, 0xf7, 0x31, 0xff, 0xf7, 0x39, 0xf7, 0xb5, 0x10, 0xde, 0x94, 0x08,
+    0xff, 0xd6, 0x21, 0xff, 0xde, 0x21, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x6b,
+    0xff, 0xe7, 0x31, 0xff, 0xb5, 0x10, 0xf7, 0xad, 0x10, 0xff, 0xbd, 0x10,
+    0xef, 0xa5, 0x10, 0xf7, 0xbd, 0x18, 0xff, 0xe7, 0x42, 0xff, 0xf7, 0x42,
+    0xff, 0xff, 0x39, 0xff, 0xff, 0x63, 0x63, 0x39, 0x10, 0xef, 0xb5, 0x18,
+    0xde, 0x94, 0x10, 0x52, 0x21, 0x00, 0xff, 0xc6, 0x18, 0xad, 0x63, 0x08,
+    0x7b, 0x39, 0x00, 0x94, 0x4a, 0x00, 0xff, 0xce, 0x18, 0x42, 0x18, 0x00,
+    0xd6, 0x8c, 0x10, 0x42, 0x10, 0x00, 0xc6, 0x7b, 0x08, 0x8c, 0x4a, 0x00,
+    0x73, 0x31, 0x00, 0x39, 0x10, 0x00, 0x84, 0x42, 0x00, 0x6b, 0x31, 0x00,
+    0xb5, 0x6b, 0x08, 0xef, 0xa5, 0x08, 0xe7, 0x9c, 0x08, 0x84, 0x39, 0x00,
+    0xef, 0x9c, 0x10, 0xff, 0xce, 0x10, 0xad, 0x63, 0x00, 0xa5, 0x5a, 0x00,
+    0x94, 0x52, 0x00, 0x9c, 0x5a, 0x00, 0x21, 0x18, 0x08, 0x29, 0x21, 0x08,
+    0x31, 0x29, 0x10, 0xef, 0x9c, 0x18, 0x73, 0x4a, 0x08, 0x6b, 0x42, 0x08,
+    0x6b, 0x42, 0x10, 0x4a, 0x39, 0x10, 0x6b, 0x52, 0x21, 0xad, 0x73, 0x21,
+    0xff, 0xa5, 0x18, 0xf7, 0x8c, 0x18, 0x31, 0x39, 0x39, 0x21, 0x21, 0x21,
+    0x29, 0x18, 0x08, 0x39, 0x39, 0x42, 0xb5, 0xb5, 0xbd, 0xad, 0xb5, 0xb5,
+    0x31, 0x31, 0x31, 0xde, 0x8c, 0x21, 0xff, 0x9c, 0x18, 0xe7, 0x84, 0x18,
+    0x21, 0x21, 0x29, 0xce, 0xde, 0xef, 0x9c, 0x9c, 0xa5, 0x84, 0x8c, 0x94,
+    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x94, 0x94, 0x42, 0x39, 0x29,
+    0xff, 0x94, 0x18, 0xb5, 0x63, 0x10, 0x63, 0x6b, 0x73, 0xad, 0xb5, 0xc6,
+    0xce, 0xd6, 0xde, 0xd6, 0xde, 0xe7, 0xc6, 0xc6, 0xce, 0x10, 0x10, 0x10,
+    0x7b, 0x42, 0x10, 0xa5, 0x5a, 0x10, 0x9c, 0xa5, 0xb5, 0x5a, 0x5a, 0x63,
+    0x8c, 0x94, 0x94, 0x73, 0x73, 0x73, 0xef, 0xf7, 0xf7, 0x18, 0x10, 0x08,
+    0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x31, 0x18, 0x08, 0x94, 0x9c, 0xad,
+    0xad, 0xa5, 0xa5, 0x21, 0x21, 0x18, 0x94, 0x94, 0x9c, 0xf7, 0xf7, 0xf7,
+    0x63, 0x63, 0x6b, 0x21, 0x10, 0x08, 0x5a, 0x31, 0x08, 0x6b, 0x39, 0x08,
+    0x63, 0x39, 0x08, 0x6b, 0x52, 0x31, 0xff, 0xc6, 0x29, 0xc6, 0x73, 0x10,
+    0x29, 0x21, 0x10, 0x7b, 0x7b, 0x7b, 0x4a, 0x4a, 0x4a, 0x4a, 0x29, 0x08,
+    0x8c, 0x52, 0x10, 0xe7, 0x7b, 0x18, 0xc6, 0x6b, 0x10, 0x94, 0x52, 0x10,
+    0xff, 0xad, 0x18, 0xde, 0x7b, 0x18, 0x94, 0x5a, 0x10, 0xb5, 0x8c, 0x21,
+    0xb5, 0x7b, 0x18, 0xc6, 0x8c, 0x18, 0xde, 0x8c, 0x18, 0xef, 0x84, 0x18,
+    0xbd, 0x6b, 0x10, 0xff, 0xb5, 0x21, 0xff, 0xce, 0x31, 0xd6, 0x73, 0x10,
+    0xce, 0x73, 0x10, 0x73, 0x42, 0x10, 0xd6, 0x7b, 0x10, 0xad, 0x42, 0x10,
+    0x84, 0x31, 0x08, 0xa5, 0x4a, 0x10, 0xff, 0x8c, 0x18, 0xad, 0x63, 0x10,
+    0xde, 0x5a, 0x10, 0x73, 0x08, 0x08, 0x6b, 0x18, 0x08, 0xde, 0x7b, 0x10,
+    0x9c, 0x5a, 0x10, 0x8c, 0x4a, 0x10, 0x84, 0x4a, 0x10, 0xde, 0x4a, 0x10,
+    0xce, 0x52, 0x10, 0x7b, 0x4a, 0x10, 0x73, 0x42, 0x08, 0x63, 0x31, 0x08,
+    0xff, 0xff, 0xff, 0xe7, 0xef, 0xff, 0xd6, 0xd6, 0xff, 0xa5, 0xa5, 0xd6,
+    0x73, 0x73, 0xa5, 0x5a, 0x5a, 0x84, 0x7b, 0x7b, 0xad, 0x84, 0x84, 0xb5,
+    0x6b, 0x6b, 0xa5, 0x8c, 0x8c, 0xb5, 0x94, 0x94, 0xbd, 0x32, 0xbb, 0x9b,
+    0x46, 0xdd, 0xac, 0x43, 0xdb, 0xab, 0x2d, 0xe8, 0xa8, 0x3b, 0xb2, 0x9f,
+    0x60, 0xe1, 0xb9, 0xcd, 0xfe, 0xf0, 0xec, 0xb1, 0xf7, 0xd8, 0x84, 0xe8,
+    0x58, 0xc3, 0xb4, 0x2d, 0xee, 0xa6, 0x3b, 0xd0, 0xa1, 0x66, 0xe4, 0xbb,
+    0xf7, 0xff, 0xff, 0xc5, 0xaf, 0xdb, 0xbb, 0x36, 0xb4, 0xa6, 0x35, 0xa3,
+    0xa0, 0x20, 0x97, 0x50, 0x61, 0x82, 0x37, 0xdb, 0xa4, 0x46, 0xbb, 0x97,
+    0x35, 0xb6, 0x97, 0xbf, 0xff, 0xec, 0x76, 0xed, 0xc5, 0x44, 0x5c, 0x81,
+    0x94, 0x16, 0x8c, 0x96, 0x1b, 0x8f, 0x7a, 0x2a, 0x8b, 0x49, 0x4f, 0x81,
+    0x41, 0xc6, 0x9c, 0x46, 0x85, 0x8e, 0x78, 0xe3, 0xc4, 0x9b, 0xff, 0xdf,
+    0x2e, 0x92, 0x89, 0x4b, 0x19, 0x6c, 0x5c, 0x3a, 0x81, 0x6f, 0x61, 0x98,
+    0x49, 0x7e, 0x91, 0x47, 0x91, 0x91, 0x4a, 0x6a, 0x86, 0x3e, 0xdf, 0xa9,
+    0x88, 0xfe, 0xd6, 0x4b, 0xba, 0xa1, 0x48, 0x32, 0x74, 0x49, 0x39, 0x76,
+    0x45, 0x87, 0x8f, 0x42, 0x58, 0x81, 0x47, 0x7c, 0x92, 0x6a, 0xfd, 0xd1,
+    0x78, 0xff, 0xd0, 0x35, 0x8b, 0x89, 0x4e, 0x15, 0x6d, 0x4b, 0x7b, 0x87,
+    0x4a, 0x6e, 0x8a, 0xff, 0xfb, 0xff, 0x9a, 0xff, 0xdc, 0x33, 0x8e, 0x89,
+    0x4c, 0x2e, 0x74, 0x38, 0xc7, 0xa1, 0x46, 0x7e, 0x95, 0xff, 0xfd, 0xff,
+    0x9d, 0xff, 0xdd, 0x32, 0x8d, 0x89, 0x4c, 0x29, 0x71, 0x30, 0xd4, 0xa8,
+    0x42, 0x83, 0x98, 0x94, 0xff, 0xd9, 0x2c, 0x91, 0x87, 0x52, 0x24, 0x75,
+    0x49, 0x71, 0x89, 0x46, 0x56, 0x83, 0xc1, 0xff, 0xeb, 0x50, 0x8d, 0x99,
+    0x93, 0x1b, 0x8f, 0x7b, 0x2e, 0x8d, 0x4b, 0x52, 0x82, 0x3c, 0xbe, 0x9d,
+    0xe1, 0xeb, 0xec, 0x95, 0x2b, 0x96, 0x90, 0x25, 0x91, 0x9a, 0x23, 0x94,
+    0x72, 0x35, 0x89, 0x32, 0xbc, 0x99, 0x5d, 0xeb, 0xbb, 0x99, 0xfb, 0xdd,
+    0x93, 0xd4, 0xbf, 0xca, 0xee, 0xe1, 0xbb, 0x71, 0xb9, 0x87, 0x05, 0x83,
+    0x95, 0x1d, 0x90, 0x5b, 0x27, 0x78, 0x49, 0x3d, 0x7b, 0x40, 0x6d, 0x82,
+    0x44, 0xd1, 0xa2, 0xb9, 0xf8, 0xe5, 0x43, 0xde, 0xab, 0xff, 0xf0, 0xf9,
+    0xa7, 0xa2, 0xc3, 0x53, 0x5b, 0x86, 0x46, 0x1d, 0x6b, 0x48, 0x17, 0x67,
+    0x4e, 0x17, 0x6f, 0x3d, 0x8a, 0x8c, 0x4e, 0xfd, 0xc1, 0x47, 0xdb, 0xae,
+    0xab, 0xfb, 0xdd, 0x33, 0xeb, 0xad, 0x48, 0x76, 0x88, 0x48, 0x4b, 0x7e,
+    0x4a, 0x6e, 0x86, 0x41, 0xc8, 0x9f, 0x39, 0xae, 0x97, 0x4f, 0x30, 0x75,
+    0x49, 0x99, 0x92, 0x48, 0x98, 0x96, 0x49, 0x9d, 0x94, 0x46, 0x96, 0x92,
+    0x4c, 0x40, 0x7d, 0x38, 0xcc, 0x98, 0x39, 0xdd, 0xa7, 0x98, 0x93, 0xbb,
+    0x72, 0x8d, 0xa5, 0x37, 0x84, 0x8e, 0x44, 0xad, 0x97, 0x31, 0xe5, 0xa6,
+    0x96, 0x8e, 0xc4, 0xd2, 0x48, 0xc8, 0xb5, 0x51, 0xb6, 0x63, 0x62, 0x92,
+    0x44, 0x41, 0x7b, 0x35, 0xe0, 0xa3, 0x49, 0xa6, 0x97, 0xa9, 0x2a, 0xa1,
+    0x98, 0x2f, 0x99, 0x9b, 0x24, 0x97, 0x73, 0x1d, 0x80, 0x42, 0x20, 0x68,
+    0x4a, 0x25, 0x6f, 0x41, 0xbb, 0x99, 0x43, 0x9c, 0x92, 0x5a, 0x1d, 0x77,
+    0x91, 0x1e, 0x8e, 0x7b, 0x25, 0x86, 0x48, 0x27, 0x6e, 0x48, 0x23, 0x6d,
+    0x49, 0x2c, 0x71, 0x49, 0x44, 0x7d, 0x4a, 0x46, 0x7c, 0x49, 0x86, 0x8e,
+    0x46, 0x88, 0x8f, 0x4d, 0x43, 0x7e, 0x48, 0x1f, 0x6b, 0x47, 0x22, 0x6b,
+    0x49, 0x27, 0x6f, 0x48, 0x21, 0x6b, 0x48, 0x41, 0x7d, 0x48, 0x38, 0x78,
+    0x49, 0x76, 0x8f, 0x47, 0x51, 0x83, 0x49, 0x5a, 0x86, 0x4c, 0x32, 0x77,
+    0x48, 0x20, 0x6c, 0x49, 0x1c, 0x6a, 0x49, 0x5d, 0x81, 0x49, 0x56, 0x83,
+    0x46, 0x70, 0x86, 0x3e, 0x98, 0x92, 0x49, 0x3e, 0x78, 0x48, 0x14, 0x68,
+    0x48, 0x73, 0x83, 0x49, 0x5a, 0x84, 0x5f, 0xf4, 0xc1, 0x42, 0x9a, 0x94,
+    0x4e, 0x0f, 0x69, 0x39, 0x92, 0x92, 0x43, 0x78, 0x88, 0xe0, 0xff, 0xf6,
+    0x38, 0xe4, 0xa9, 0x48, 0x33, 0x73, 0x35, 0x99, 0x95, 0x32, 0xac, 0x9a,
+    0xc2, 0xe0, 0xd5, 0xf9, 0xfd, 0xff, 0x87, 0xa0, 0xbc, 0x5c, 0x29, 0x79,
+    0x3f, 0x5e, 0x81, 0x41, 0x8a, 0x8e, 0xd2, 0xe8, 0xe1, 0xe4, 0xfb, 0xf4,
+    0xe3, 0x91, 0xe0, 0xb5, 0x2f, 0xad, 0x94, 0x1d, 0x8f, 0x5f, 0x53, 0x8d,
+    0x46, 0x5e, 0x7f, 0x64, 0xd0, 0xb6, 0x69, 0xff, 0xca, 0x9d, 0xff, 0xde,
+    0x4c, 0xd6, 0xaf, 0x9c, 0x3d, 0xa4, 0x8d, 0x23, 0x8e, 0xb2, 0x2b, 0xa5,
+    0x79, 0x50, 0x9a, 0x36, 0x32, 0x6e, 0x6f, 0xf1, 0xc7, 0x73, 0xf0, 0xc6,
+    0x38, 0xa7, 0x8e, 0x33, 0x8a, 0x89, 0x44, 0x50, 0x7d, 0x59, 0x30, 0x7b,
+    0x9f, 0x1a, 0x96, 0x8a, 0x87, 0xb8, 0x44, 0x62, 0x81, 0x64, 0xf7, 0xc8,
+    0x3d, 0xdc, 0xaa, 0x4b, 0x3d, 0x7a, 0x4d, 0x15, 0x6b, 0x49, 0x1e, 0x6b,
+    0x46, 0x91, 0x99, 0x30, 0xc0, 0xa2, 0x3c, 0x77, 0x88, 0x43, 0xcc, 0x9e,
+    0x46, 0x72, 0x85, 0x41, 0x46, 0x7c, 0x42, 0x45, 0x7c, 0x44, 0x5d, 0x88,
+    0x3d, 0x74, 0x7f, 0x39, 0x6f, 0x81, 0x59, 0xa3, 0x9d, 0x65, 0x59, 0x90,
+    0x6a, 0x41, 0x85, 0x79, 0x2a, 0x40, 0xa3, 0x2d, 0x45, 0xfc, 0x4e, 0x35,
+    0xfe, 0x5b, 0x32, 0xc7, 0x2f, 0x46, 0xff, 0x75, 0x3a, 0xff, 0x8d, 0x44,
+    0xe3, 0x34, 0x43, 0xf0, 0x3e, 0x3a, 0xff, 0xbe, 0x50, 0xff, 0xda, 0x55,
+    0xff, 0xf3, 0x7b, 0xde, 0x39, 0x31, 0xf7, 0x5a, 0x4a, 0x8c, 0x21, 0x21,
+    0x84, 0x18, 0x18, 0xad, 0x31, 0x29, 0x73, 0x21, 0x18, 0xff, 0x73, 0x63,
+    0xde, 0x4a, 0x42, 0xb5, 0x31, 0x29, 0xd6, 0x39, 0x31, 0xbd, 0x31, 0x29,
+    0xff, 0x63, 0x5a, 0xd6, 0x42, 0x39, 0xce, 0x39, 0x29, 0xa5, 0x29, 0x21,
+    0xce, 0x39, 0x31, 0xc6, 0x31, 0x29, 0x8c, 0x29, 0x29, 0xce, 0x42, 0x31,
+    0xc6, 0x39, 0x29, 0x4a, 0x10, 0x10, 0x6b, 0x18, 0x10, 0xde, 0x42, 0x31,
+    0x5a, 0x10, 0x10, 0xe7, 0x52, 0x39, 0xff, 0xa5, 0x39, 0xde, 0x84, 0x31,
+    0xbd, 0x42, 0x29, 0xa5, 0x31, 0x21, 0x42, 0x08, 0x08, 0xc6, 0x42, 0x31,
+    0xf7, 0x94, 0x39, 0xff, 0xd6, 0x5a, 0xd6, 0x8c, 0x29, 0x8c, 0x52, 0x21,
+    0x9c, 0x29, 0x21, 0x94, 0x21, 0x18, 0xce, 0x73, 0x29, 0xc6, 0x84, 0x29,
+    0x9c, 0x6b, 0x21, 0x52, 0x31, 0x10, 0x42, 0x18, 0x10, 0x52, 0x10, 0x10,
+    0x9c, 0x21, 0x21, 0xbd, 0x39, 0x29, 0x73, 0x39, 0x18, 0x4a, 0x29, 0x10,
+    0x4a, 0x18, 0x10, 0x73, 0x18, 0x18, 0xc6, 0x39, 0x31, 0x42, 0x10, 0x10,
+    0x6b, 0x21, 0x18, 0x7b, 0x21, 0x18, 0xad, 0x29, 0x21, 0x52, 0x18, 0x10,
+    0x63, 0x18, 0x18, 0x94, 0x29, 0x21, 0x6b, 0x18, 0x18, 0x18, 0x08, 0x08,
+    0x8c, 0x29, 0x21, 0x84, 0x29, 0x21, 0x21, 0x08, 0x08, 0x5a, 0x18, 0x18,
+    0xff, 0xff, 0xff, 0xe7, 0xef, 0xff, 0xd6, 0xd6, 0xff, 0xa5, 0xa5, 0xd6,
+    0x73, 0x73, 0xa5, 0x5a, 0x5a, 0x84, 0x7b, 0x7b, 0xad, 0x84, 0x84, 0xb5,
+    0x6b, 0x6b, 0xa5, 0x8c, 0x8c, 0xb5, 0x94, 0x94, 0xbd, 0xf0, 0xf0, 0xf0,
+    0xff, 0xff, 0xff, 0xe7, 0xef, 0xff, 0xd6, 0xd6, 0xff, 0xa5, 0xa5, 0xd6,
+    0x73, 0x73, 0xa5, 0x5a, 0x5a, 0x84, 0x7b, 0x7b, 0xad, 0x84, 0x84, 0xb5,
+    0x6b, 0x6b, 0xa5, 0xf0, 0xf0, 0xf0, 0xff, 0xf7, 0xde, 0xff, 0xc6, 0x00,
+    0xff, 0x94, 0x00, 0xff, 0x6b, 0x00, 0xff, 0x08, 0x00, 0xff, 0xef, 0xce,
+    0xff, 0x63, 0x00, 0xff, 0x00, 0x00, 0xad, 0x00, 0x00, 0xff, 0xff, 0xbd,
+    0xff, 0x52, 0x00, 0xff, 0x10, 0x00, 0xff, 0x18, 0x00, 0xbd, 0x00, 0x00,
+    0xff, 0xbd, 0x00, 0xff, 0x21, 0x00, 0xff, 0x31, 0x00, 0xef, 0x08, 0x00,
+    0xf7, 0x18, 0x00, 0xde, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x4a, 0x00,
+    0xff, 0x42, 0x00, 0xde, 0x18, 0x00, 0xff, 0x73, 0x00, 0xff, 0x29, 0x00,
+    0xb5, 0x00, 0x00, 0xff, 0x9c, 0x00, 0xd6, 0x10, 0x00, 0xff, 0xa5, 0x00,
+    0xff, 0x5a, 0x00, 0xe7, 0x00, 0x00, 0xff, 0xf7, 0x00, 0xc6, 0x10, 0x00,
+    0xff, 0xad, 0x00, 0xff, 0x39, 0x00, 0xa5, 0x00, 0x00, 0xff, 0xde, 0x00,
+    0xff, 0x7b, 0x00, 0xff, 0x8c, 0x00, 0xff, 0xe7, 0x00, 0xff, 0xce, 0x00,
+    0xff, 0x84, 0x00, 0xff, 0xff, 0x4a, 0xff, 0xe7, 0xbd, 0xff, 0xb5, 0x00,
+    0xb5, 0x18, 0x00, 0xff, 0xf7, 0xa5, 0xef, 0x4a, 0x00, 0xb5, 0x08, 0x00,
+    0xff, 0xff, 0x8c, 0xde, 0x39, 0x00, 0xff, 0xd6, 0x00, 0xd6, 0x42, 0x00,
+    0xd6, 0x21, 0x00, 0xc6, 0x31, 0x00, 0xff, 0xff, 0xbd, 0xff, 0xe7, 0x00,
+    0xff, 0x94, 0x00, 0xff, 0x52, 0x00, 0xff, 0x8c, 0x00, 0xff, 0x42, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x08, 0x00, 0xff, 0xbd, 0x31, 0xff, 0x39, 0x00,
+    0xff, 0x10, 0x00, 0xff, 0x18, 0x00, 0xff, 0x21, 0x00, 0xc6, 0x00, 0x00,
+    0xff, 0x29, 0x00, 0xff, 0x31, 0x00, 0xde, 0x00, 0x00, 0xbd, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0xff, 0x4a, 0x00, 0xff, 0x5a, 0x00, 0xff, 0x63, 0x00,
+    0xc6, 0x10, 0x00, 0xbd, 0x08, 0x00, 0xe7, 0xc6, 0x00, 0xff, 0xad, 0x00,
+    0xff, 0x6b, 0x00, 0xff, 0xff, 0xe7, 0xff, 0x7b, 0x00, 0xff, 0x84, 0x00,
+    0xb5, 0x00, 0x00, 0xff, 0xad, 0x10, 0xff, 0x9c, 0x00, 0xad, 0x00, 0x00,
+    0xff, 0xa5, 0x00, 0xff, 0xe7, 0x29, 0xff, 0xb5, 0x00, 0xe7, 0x42, 0x00,
+    0xff, 0xff, 0x5a, 0xff, 0xc6, 0x00, 0xff, 0xce, 0x00, 0xff, 0xd6, 0x00,
+    0xff, 0xde, 0x00, 0xff, 0xef, 0x00, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xbd,
+    0xff, 0xef, 0x6b, 0xff, 0xde, 0x00, 0xff, 0x7b, 0x00, 0xff, 0x5a, 0x00,
+    0xb5, 0x00, 0x00, 0xff, 0x63, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x00,
+    0xff, 0x10, 0x00, 0xff, 0x18, 0x00, 0xc6, 0x08, 0x00, 0xff, 0x21, 0x00,
+    0xff, 0x29, 0x00, 0xff, 0x31, 0x00, 0xd6, 0x10, 0x00, 0xef, 0x10, 0x00,
+    0xd6, 0x00, 0x00, 0xff, 0x39, 0x00, 0xff, 0x42, 0x00, 0xff, 0x4a, 0x00,
+    0xbd, 0x00, 0x00, 0xff, 0xe7, 0x00, 0xff, 0x6b, 0x00, 0xff, 0x52, 0x00,
+    0xce, 0x00, 0x00, 0xff, 0x8c, 0x00, 0xd6, 0x21, 0x00, 0xff, 0x94, 0x21,
+    0xff, 0x73, 0x00, 0xc6, 0x18, 0x00, 0xff, 0x8c, 0x29, 0xa5, 0x00, 0x00,
+    0xff, 0x84, 0x10, 0xff, 0x84, 0x00, 0xf7, 0x39, 0x00, 0xff, 0xf7, 0x5a,
+    0xff, 0xf7, 0x00, 0xff, 0xb5, 0x00, 0xff, 0x94, 0x00, 0xff, 0xbd, 0x00,
+    0xff, 0xc6, 0x00, 0xff, 0x9c, 0x00, 0xff, 0xa5, 0x00, 0xff, 0xd6, 0x00,
+    0xff, 0xef, 0x00, 0xff, 0xce, 0x00, 0xff, 0xad, 0x00, 0xde, 0x63, 0x00,
+    0xc6, 0x10, 0x00, 0xff, 0xf7, 0x00, 0xff, 0xbd, 0x00, 0xff, 0x7b, 0x00,
+    0xff, 0x84, 0x00, 0xff, 0x73, 0x00, 0xff, 0xe7, 0x00, 0xff, 0xce, 0x00,
+    0xff, 0x4a, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x00, 0xff, 0x10, 0x00,
+    0xc6, 0x08, 0x00, 0xff, 0xff, 0xbd, 0xff, 0x39, 0x00, 0xff, 0x18, 0x00,
+    0xff, 0x21, 0x00, 0xff, 0x29, 0x00, 0xd6, 0x00, 0x00, 0xef, 0x10, 0x00,
+    0xff, 0x31, 0x00, 0xbd, 0x00, 0x00, 0xde, 0x10, 0x00, 0xff, 0x6b, 0x00,
+    0xff, 0x42, 0x00, 0xff, 0x52, 0x00, 0xff, 0x63, 0x00, 0xce, 0x00, 0x00,
+    0xff, 0xef, 0xbd, 0xff, 0xa5, 0x00, 0xff, 0x94, 0x4a, 0xd6, 0xd6, 0x00,
+    0xff, 0x8c, 0x29, 0xb5, 0x00, 0x00, 0xde, 0x00, 0x00, 0xef, 0x08, 0x00,
+    0xff, 0xef, 0xce, 0xff, 0xe7, 0xce, 0xff, 0x8c, 0x00, 0xff, 0x9c, 0x00,
+    0xff, 0xef, 0x00, 0x94, 0x00, 0x00, 0xff, 0xc6, 0x00, 0xff, 0xad, 0x00,
+    0xff, 0xb5, 0x00, 0xff, 0x94, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8c,
+    0xff, 0xd6, 0x00, 0xf7, 0x00, 0x00, 0xff, 0xe7, 0x8c, 0xff, 0xde, 0x00,
+    0xde, 0x4a, 0x00, 0xd6, 0x31, 0x00, 0xc6, 0x21, 0x00, 0xb5, 0x18, 0x00,
+    0xb5, 0x10, 0x00, 0xff, 0xff, 0xce, 0xff, 0xbd, 0x00, 0xff, 0x6b, 0x00,
+    0xff, 0x39, 0x00, 0xff, 0x08, 0x00, 0xff, 0x10, 0x00, 0xff, 0x42, 0x00,
+    0xff, 0x31, 0x00, 0xff, 0x18, 0x00, 0xff, 0x21, 0x00, 0xff, 0x29, 0x00,
+    0x8c, 0x00, 0x00, 0xde, 0x10, 0x00, 0xff, 0xff, 0xbd, 0xff, 0x9c, 0x10,
+    0xde, 0x21, 0x00, 0xff, 0x4a, 0x00, 0xff, 0x52, 0x00, 0xff, 0x5a, 0x00,
+    0xff, 0x94, 0x10, 0xce, 0x00, 0x00, 0xff, 0x63, 0x00, 0xb5, 0x00, 0x00,
+    0xf7, 0x84, 0x08, 0xff, 0x73, 0x00, 0xff, 0x7b, 0x00, 0xf7, 0x29, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0xff, 0x8c, 0x00, 0xff, 0xad, 0x00,
+    0xf7, 0xe7, 0x00, 0xe7, 0x10, 0x00, 0xff, 0xef, 0xce, 0xff, 0x94, 0x00,
+    0xff, 0x9c, 0x00, 0xff, 0xa5, 0x00, 0xd6, 0x31, 0x00, 0xff, 0xb5, 0x00,
+    0xff, 0xc6, 0x00, 0xc6, 0x00, 0x00, 0xff, 0xce, 0x00, 0xff, 0xe7, 0x00,
+    0xff, 0xd6, 0x00, 0xff, 0xde, 0x00, 0xce, 0x21, 0x00, 0xc6, 0x10, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xff, 0xde, 0x21, 0xff, 0xe7, 0x21,
+    0xff, 0xc6, 0x00, 0xff, 0xad, 0x00, 0xff, 0x8c, 0x00, 0xff, 0xff, 0xbd,
+    0xff, 0xef, 0xce, 0xff, 0x63, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x00,
+    0xff, 0x10, 0x00, 0xff, 0x18, 0x00, 0xff, 0x21, 0x00, 0xff, 0x29, 0x00,
+    0xce, 0x08, 0x00, 0xff, 0x52, 0x00, 0xff, 0x31, 0x00, 0xff, 0x39, 0x00,
+    0xff, 0x42, 0x00, 0xde, 0x00, 0x00, 0xff, 0xbd, 0x00, 0xe7, 0x10, 0x00,
+    0x8c, 0x00, 0x00, 0x6b, 0x00, 0x00, 0xff, 0x4a, 0x00, 0xff, 0xa5, 0x00,
+    0xef, 0x00, 0x00, 0xef, 0xc6, 0x00, 0xff, 0xad, 0x4a, 0xff, 0x9c, 0x00,
+    0xff, 0x94, 0x00, 0xce, 0x00, 0x00, 0xff, 0x5a, 0x00, 0xff, 0x7b, 0x00,
+    0xff, 0x73, 0x00, 0xff, 0x6b, 0x00, 0xff, 0x84, 0x00, 0xde, 0x08, 0x00,
+    0x9c, 0x00, 0x00, 0xf7, 0x18, 0x00, 0xb5, 0x00, 0x00, 0x84, 0x00, 0x00,
+    0xff, 0xb5, 0x00, 0xff, 0xce, 0x00, 0x63, 0x00, 0x00, 0xff, 0xde, 0x00,
+    0xc6, 0x00, 0x00, 0xff, 0xd6, 0x00, 0xff, 0xef, 0x00, 0xff, 0xf7, 0x00,
+    0xf7, 0x29, 0x00, 0xff, 0xe7, 0x00, 0xef, 0x10, 0x00, 0xc6, 0x18, 0x00,
+    0xc6, 0x10, 0x00, 0xce, 0x21, 0x00, 0xff, 0xf7, 0xde, 0xff, 0xe7, 0x42,
+    0xff, 0xb5, 0x00, 0xff, 0x73, 0x00, 0xff, 0xef, 0xce, 0xff, 0x5a, 0x00,
+    0xff, 0x08, 0x00, 0xff, 0x10, 0x00, 0xff, 0x18, 0x00, 0xbd, 0x00, 0x00,
+    0xff, 0xff, 0xde, 0xff, 0x4a, 0x00, 0xff, 0x21, 0x00, 0xff, 0x31, 0x00,
+    0x8c, 0x00, 0x00, 0xff, 0xc6, 0x18, 0xff, 0x29, 0x00, 0xff, 0x39, 0x00,
+    0xff, 0xff, 0x29, 0xff, 0x94, 0x00, 0xff, 0x52, 0x00, 0x9c, 0x00, 0x00,
+    0xff, 0xde, 0x00, 0xff, 0x42, 0x00, 0xff, 0x6b, 0x00, 0xb5, 0x00, 0x00,
+    0xff, 0x84, 0x00, 0xc6, 0x18, 0x00, 0xff, 0x7b, 0x00, 0xce, 0x00, 0x00,
+    0xff, 0xce, 0x00, 0xad, 0x00, 0x00, 0xff, 0x8c, 0x00, 0xff, 0x9c, 0x00,
+    0xe7, 0x10, 0x00, 0xff, 0x63, 0x00, 0xff, 0xde, 0x4a, 0xff, 0xa5, 0x00,
+    0xff, 0xad, 0x00, 0xe7, 0x00, 0x00, 0xce, 0x29, 0x00, 0xff, 0xe7, 0xbd,
+    0xff, 0xbd, 0x00, 0xff, 0xc6, 0x00, 0xff, 0xf7, 0xa5, 0xff, 0xd6, 0x00,
+    0xff, 0xef, 0x8c, 0xff, 0xff, 0xa5, 0xff, 0xe7, 0x00, 0xef, 0x18, 0x00,
+    0xff, 0xff, 0xde, 0xff, 0xe7, 0x42, 0xff, 0xc6, 0x00, 0xff, 0xce, 0x00,
+    0xff, 0xb5, 0x00, 0xff, 0x73, 0x00, 0xff, 0x5a, 0x00, 0xff, 0x08, 0x00,
+    0xff, 0x10, 0x00, 0xff, 0x18, 0x00, 0xff, 0x21, 0x00, 0xff, 0x29, 0x00,
+    0xff, 0x31, 0x00, 0xbd, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x39, 0x00,
+    0xff, 0x42, 0x00, 0xf7, 0x18, 0x00, 0xc6, 0x00, 0x00, 0xde, 0x08, 0x00,
+    0xff, 0x4a, 0x00, 0xff, 0x52, 0x00, 0xff, 0xb5, 0x10, 0xff, 0xff, 0xce,
+    0xff, 0x8c, 0x00, 0xff, 0x6b, 0x00, 0xff, 0xff, 0x21, 0xff, 0x94, 0x00,
+    0xff, 0x63, 0x00, 0xff, 0xbd, 0x00, 0xff, 0xd6, 0x4a, 0xbd, 0x08, 0x00,
+    0xff, 0x7b, 0x00, 0xff, 0x84, 0x00, 0xc6, 0x08, 0x00, 0xff, 0xad, 0x08,
+    0xff, 0x9c, 0x00, 0xff, 0xa5, 0x00, 0xff, 0xad, 0x00, 0xff, 0xf7, 0x8c,
+    0xff, 0xd6, 0x00, 0xff, 0xde, 0x00, 0xd6, 0x18, 0x00, 0xff, 0xc6, 0x10,
+    0xff, 0xe7, 0x00, 0xef, 0x18, 0x00, 0xc6, 0x18, 0x00, 0xff, 0xe7, 0xce,
+    0xff, 0xe7, 0xde, 0xff, 0xe7, 0x42, 0xff, 0xad, 0x00, 0xff, 0x73, 0x00,
+    0xc6, 0x00, 0x00, 0xff, 0x08, 0x00, 0xff, 0x10, 0x00, 0xff, 0x18, 0x00,
+    0xff, 0x21, 0x00, 0xce, 0x08, 0x00, 0xce, 0x00, 0x00, 0xff, 0x31, 0x00,
+    0xff, 0x39, 0x00, 0xff, 0x29, 0x00, 0xde, 0x00, 0x00, 0xe7, 0x08, 0x00,
+    0xff, 0x52, 0x00, 0xff, 0x5a, 0x00, 0x9c, 0x00, 0x00, 0xde, 0x08, 0x00,
+    0xef, 0x08, 0x00, 0xff, 0x7b, 0x00, 0xef, 0x6b, 0x00, 0xff, 0x4a, 0x00,
+    0xff, 0x6b, 0x00, 0xff, 0x63, 0x00, 0xef, 0xe7, 0xd6, 0xff, 0x84, 0x00,
+    0xf7, 0x21, 0x00, 0xff, 0xb5, 0x4a, 0xff, 0xa5, 0x00, 0xff, 0xce, 0x00,
+    0xff, 0x8c, 0x00, 0xff, 0xff, 0xce, 0xff, 0xb5, 0x00, 0xff, 0xbd, 0x00,
+    0xff, 0x9c, 0x00, 0xff, 0x94, 0x00, 0xde, 0x4a, 0x00, 0xff, 0xc6, 0x00,
+    0xff, 0xde, 0x00, 0xff, 0xef, 0x00, 0xff, 0x42, 0x00, 0xff, 0xe7, 0x00,
+    0xc6, 0x18, 0x00, 0xc6, 0x10, 0x00, 0xff, 0xef, 0xde, 0xff, 0xe7, 0x42,
+    0xff, 0xc6, 0x00, 0xff, 0xa5, 0x00, 0xff, 0x73, 0x00, 0xff, 0xe7, 0xce,
+    0xff, 0x42, 0x00, 0xff, 0x10, 0x00, 0xff, 0x18, 0x00, 0xff, 0x21, 0x00,
+    0xff, 0x29, 0x00, 0xce, 0x08, 0x00, 0xce, 0x00, 0x00, 0xff, 0xff, 0xbd,
+    0xff, 0x39, 0x00, 0xef, 0x18, 0x00, 0xff, 0x4a, 0x00, 0xff, 0x31, 0x00,
+    0xde, 0x10, 0x00, 0xff, 0x6b, 0x00, 0xbd, 0x00, 0x00, 0xf7, 0x29, 0x00,
+    0xff, 0x5a, 0x00, 0xde, 0x00, 0x00, 0xff, 0xf7, 0x00, 0xff, 0x52, 0x00,
+    0xff, 0xbd, 0x00, 0xff, 0xad, 0x00, 0xf7, 0x8c, 0x00, 0xf7, 0x31, 0x00,
+    0xff, 0xde, 0x00, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0xff, 0x84, 0x00,
+    0xff, 0x63, 0x00, 0xff, 0x94, 0x00, 0xff, 0x9c, 0x29, 0xff, 0x7b, 0x00,
+    0xff, 0x8c, 0x00, 0xf7, 0x73, 0x00, 0xf7, 0x5a, 0x00, 0xff, 0xce, 0x00,
+    0xff, 0xb5, 0x00, 0xff, 0xd6, 0x73, 0xff, 0xe7, 0x00, 0xc6, 0x10, 0x00,
+    0x39, 0xdb, 0xa2, 0x48, 0x82, 0x86, 0xc3, 0xf3, 0xe8, 0xb6, 0xfe, 0xe5,
+    0x3b, 0xc6, 0x9b, 0x4a, 0x47, 0x7d, 0xa1, 0x7b, 0xbc, 0xff, 0x96, 0xff,
+    0xa4, 0xc7, 0xd0, 0x39, 0x90, 0x91, 0x4c, 0x2d, 0x76, 0x4a, 0x56, 0x85,
+    0xc3, 0x4b, 0xbf, 0xd2, 0x50, 0xc9, 0x74, 0x51, 0x9a, 0x42, 0x2c, 0x71,
+    0x47, 0x79, 0x8a, 0x40, 0x95, 0x94, 0x6d, 0x45, 0x8f, 0x4e, 0x30, 0x78,
+    0x49, 0x6d, 0x89, 0x3a, 0xb2, 0x9b, 0x27, 0x53, 0x6f, 0x38, 0x8c, 0x90,
+    0x83, 0xf9, 0xcb, 0xb3, 0xdc, 0xe1, 0x87, 0x64, 0xa6, 0x47, 0x34, 0x76,
+    0x8a, 0xf1, 0xcc, 0xf0, 0xfb, 0xfb, 0xfd, 0x89, 0xf8, 0xca, 0x4e, 0xc5,
+    0x6a, 0x24, 0x7e, 0x41, 0x36, 0x75, 0x7f, 0xe8, 0xc5, 0xc4, 0xff, 0xeb,
+    0x96, 0x77, 0xb5, 0x9c, 0x1d, 0x96, 0x5c, 0x3d, 0x81, 0x43, 0x84, 0x91,
+    0x3b, 0xbc, 0x8f, 0x38, 0xb7, 0x9a, 0x44, 0x51, 0x80, 0x4d, 0x3a, 0x78,
+    0x3b, 0xb1, 0x99, 0x3b, 0x7f, 0x8a, 0x4d, 0x4d, 0x82, 0x4a, 0x30, 0x77,
+    0x46, 0x8a, 0x95, 0x3d, 0x98, 0x95, 0x36, 0xdb, 0xa1, 0x47, 0x81, 0x87,
+    0xc6, 0xfa, 0xe9, 0xbd, 0xfe, 0xe7, 0x3a, 0xc6, 0x9b, 0x4b, 0x47, 0x7d,
+    0x91, 0xec, 0xd0, 0xff, 0xff, 0xff, 0x77, 0xed, 0xc5, 0x3f, 0x8a, 0x92,
+    0x4b, 0x2f, 0x76, 0x4a, 0x56, 0x85, 0x51, 0xd2, 0xa6, 0x62, 0xed, 0xbd,
+    0x37, 0x83, 0x8c, 0x4c, 0x23, 0x74, 0x45, 0x7b, 0x8a, 0x40, 0x95, 0x94,
+    0x42, 0x7f, 0x8d, 0x4e, 0x2d, 0x79, 0x47, 0x70, 0x88, 0x3a, 0xb3, 0x9b,
+    0x33, 0x49, 0x73, 0x4a, 0x7b, 0x96, 0x8d, 0xf4, 0xd1, 0x83, 0xf6, 0xce,
+    0x3e, 0xa9, 0x8f, 0x4a, 0x3d, 0x79, 0x87, 0xef, 0xcc, 0xfb, 0xff, 0xfe,
+    0xba, 0xff, 0xe7, 0x3b, 0xbd, 0x9d, 0x4e, 0x46, 0x80, 0x42, 0x1f, 0x68,
+    0x80, 0xe2, 0xc5, 0xc2, 0xff, 0xec, 0x39, 0xba, 0x9c, 0x89, 0x41, 0x9c,
+    0x94, 0x2b, 0x97, 0x67, 0x3e, 0x8a, 0x3b, 0xab, 0x91, 0x3a, 0xba, 0x98,
+    0x4d, 0x4e, 0x85, 0x8e, 0x1b, 0x8c, 0xbd, 0x37, 0xb1, 0x98, 0x70, 0xb9,
+    0x3e, 0xc8, 0x9c, 0x46, 0xb3, 0x9d, 0x5c, 0x32, 0x7f, 0x83, 0x72, 0xa7,
+    0x53, 0x8d, 0x99, 0x60, 0xfd, 0xcd, 0x3b, 0x50, 0x7f, 0x42, 0x84, 0x89,
+    0x44, 0xc4, 0x9c, 0x3f, 0x6d, 0x86, 0x47, 0x23, 0x6e, 0x72, 0x98, 0x9f,
+    0x5f, 0x30, 0x7d, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0x71, 0x7f, 0xa6, 0x7f, 0x87, 0x99, 0x84, 0x89, 0x94, 0x89, 0x8e, 0xa1,
+    0x82, 0x87, 0x96, 0x46, 0x60, 0xaa, 0x00, 0x00, 0xd2, 0x82, 0x9e, 0x84,
+    0xda, 0xef, 0x61, 0xa9, 0xff, 0x1f, 0x96, 0xff, 0x02, 0x96, 0xff, 0x00,
+    0x8f, 0xff, 0x02, 0xc5, 0xff, 0x47, 0x60, 0x82, 0x9d, 0x00, 0x00, 0xd5,
+    0x00, 0x00, 0x89, 0x59, 0x77, 0xed, 0xe5, 0xf2, 0x58, 0xc2, 0xf9, 0x0e,
+    0xd0, 0xef, 0x2b, 0xd7, 0xed, 0x4e, 0xd0, 0xf9, 0x42, 0xc2, 0xf8, 0x11,
+    0xf8, 0xff, 0x3f, 0x55, 0x62, 0xac, 0x00, 0x00, 0xce, 0x02, 0x02, 0x00,
+    0x00, 0x08, 0x97, 0x6b, 0x9a, 0xe8, 0xee, 0xe6, 0x77, 0xa1, 0xe0, 0xc0,
+    0x77, 0xaf, 0xca, 0xaf, 0xb4, 0x90, 0xfa, 0xfe, 0x53, 0xf3, 0xfb, 0x00,
+    0xb4, 0xb5, 0x7f, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x00, 0x12, 0x93,
+    0x42, 0x8d, 0xff, 0x14, 0x4f, 0xd1, 0x00, 0x0b, 0xcd, 0x73, 0x6a, 0xa9,
+    0xfe, 0xfe, 0x47, 0xff, 0xff, 0x00, 0xb2, 0xb3, 0x82, 0x00, 0x00, 0x53,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x4a, 0x42, 0x3f, 0xb3,
+    0xda, 0xd8, 0x68, 0xff, 0xff, 0x19, 0xfc, 0xfc, 0x39, 0x50, 0x61, 0xe0,
+    0x00, 0x00, 0x4c, 0x03, 0x03, 0x00, 0x02, 0x01, 0xd2, 0x73, 0x74, 0xb6,
+    0xfc, 0xfa, 0x58, 0xff, 0xff, 0x13, 0xf8, 0xf3, 0x4b, 0x74, 0x8e, 0xae,
+    0x00, 0x28, 0xf3, 0x06, 0x03, 0x28, 0x64, 0x65, 0xb8, 0xff, 0xff, 0x1d,
+    0xff, 0xec, 0x00, 0xe7, 0xdf, 0x57, 0x4a, 0x70, 0xda, 0x05, 0x3c, 0xf5,
+    0x0a, 0x07, 0x3a, 0x74, 0x74, 0xa2, 0xf0, 0xe1, 0x21, 0xf1, 0xdf, 0x20,
+    0x96, 0x92, 0x73, 0x00, 0x05, 0xed, 0x10, 0x0e, 0x35, 0x0d, 0x2a, 0xdd,
+    0x26, 0x64, 0xf8, 0x2b, 0x67, 0xef, 0x15, 0x3b, 0xf8, 0x04, 0x02, 0x42,
+    0x00, 0x04, 0x00, 0x1f, 0x22, 0xc2, 0x4b, 0x62, 0xc3, 0x49, 0x66, 0xc1,
+    0x2c, 0x39, 0xd6, 0x00, 0x00, 0x3b, 0x74, 0x74, 0xa1, 0xfc, 0xd4, 0x2c,
+    0xfb, 0xcf, 0x27, 0x97, 0x8c, 0x83, 0x00, 0x00, 0x50, 0x7d, 0x7b, 0xa1,
+    0xff, 0xc4, 0x05, 0xff, 0xb6, 0x00, 0xa2, 0x80, 0x75, 0x00, 0x00, 0x51,
+    0x2a, 0x3c, 0xc9, 0x5a, 0x88, 0xc7, 0x59, 0x84, 0xc4, 0x36, 0x4a, 0xca,
+    0x01, 0x00, 0x3c, 0x09, 0x20, 0xe7, 0x18, 0x5d, 0xff, 0x18, 0x5f, 0xff,
+    0x0c, 0x30, 0xff, 0x03, 0x00, 0x3c, 0x01, 0x00, 0x1e, 0x02, 0x00, 0x1c,
+    0x02, 0x00, 0x20, 0x00, 0x00, 0x0a, 0xf0, 0xf0, 0xf0, 0x31, 0x37, 0x9f,
+    0x39, 0x3d, 0xa2, 0x92, 0xa9, 0x7a, 0xae, 0xc2, 0x66, 0x00, 0x00, 0xc0,
+    0x46, 0x44, 0xa9, 0xb8, 0xea, 0x39, 0xd6, 0xff, 0x19, 0x42, 0x3e, 0xa5,
+    0x80, 0x7f, 0x88, 0xf3, 0xff, 0x0d, 0xe9, 0xfd, 0x03, 0xcc, 0xc9, 0x5f,
+    0x11, 0x0f, 0xbf, 0x21, 0x21, 0xaf, 0xd5, 0xd4, 0x58, 0xff, 0xff, 0x03,
+    0xfc, 0xfe, 0x00, 0xfc, 0xfb, 0x1f, 0x63, 0x5f, 0x9b, 0x78, 0x78, 0x8e,
+    0xfc, 0xfc, 0x31, 0xef, 0xf0, 0x4b, 0xed, 0xef, 0x38, 0xfe, 0xff, 0x00,
+    0xd5, 0xce, 0x5a, 0x25, 0x24, 0xba, 0xa4, 0xa4, 0x75, 0xff, 0xff, 0x23,
+    0x97, 0xa8, 0x9f, 0x99, 0xa6, 0xa2, 0xff, 0xff, 0x0d, 0xff, 0xff, 0x13,
+    0x70, 0x6d, 0x94, 0x3e, 0x3c, 0xac, 0xe5, 0xe4, 0x49, 0xfc, 0xfd, 0x32,
+    0x21, 0x36, 0xbc, 0x10, 0x22, 0xd8, 0xe6, 0xe8, 0x45, 0xfd, 0xff, 0x00,
+    0xd2, 0xce, 0x54, 0x11, 0x10, 0xb8, 0x71, 0x72, 0x95, 0xff, 0xff, 0x10,
+    0xec, 0xf0, 0x52, 0x65, 0x66, 0x66, 0x62, 0x64, 0x76, 0xe0, 0xe2, 0x4c,
+    0xfc, 0xf7, 0x00, 0xff, 0xff, 0x14, 0x64, 0x5f, 0x94, 0x0b, 0x0b, 0xc0,
+    0xbb, 0xb6, 0x66, 0xfe, 0xf3, 0x00, 0xff, 0xec, 0x1e, 0xff, 0xff, 0x01,
+    0xff, 0xf1, 0x0c, 0xfe, 0xd7, 0x09, 0xfe, 0xd7, 0x00, 0xd9, 0xc4, 0x4c,
+    0x2d, 0x32, 0xb6, 0x3b, 0x3d, 0xa5, 0xef, 0xcf, 0x32, 0xfe, 0xc9, 0x04,
+    0xdd, 0xc2, 0x4e, 0x89, 0x82, 0x89, 0x6a, 0x69, 0xad, 0x64, 0x5d, 0xae,
+    0xe0, 0xb2, 0x46, 0xfe, 0xa8, 0x00, 0xff, 0xbd, 0x13, 0x94, 0x8c, 0x7e,
+    0x02, 0x0a, 0xa0, 0x96, 0x7d, 0x68, 0xff, 0xb1, 0x05, 0xfe, 0xb1, 0x11,
+    0x80, 0x65, 0x99, 0x00, 0x08, 0xff, 0x00, 0x2d, 0xff, 0x00, 0x05, 0xfd,
+    0x77, 0x6d, 0x8c, 0xff, 0xa5, 0x01, 0xff, 0xa1, 0x01, 0xd5, 0xb7, 0x53,
+    0x05, 0x16, 0x5d, 0x01, 0x0a, 0xb3, 0x7e, 0x64, 0x80, 0xff, 0x8c, 0x00,
+    0xfd, 0x9f, 0x29, 0x3a, 0x2a, 0xc1, 0x02, 0x00, 0x72, 0x07, 0x01, 0x21,
+    0x03, 0x04, 0x4b, 0x1b, 0x21, 0xc1, 0xe2, 0xa0, 0x36, 0xe3, 0xb5, 0x3c,
+    0x40, 0x6a, 0xe3, 0x00, 0x1f, 0x92, 0x04, 0x03, 0x00, 0x04, 0x11, 0x62,
+    0x06, 0x29, 0xcb, 0x71, 0x5e, 0x95, 0xcf, 0x92, 0x5c, 0x15, 0x10, 0xa2,
+    0x00, 0x00, 0x0d, 0x01, 0x04, 0x00, 0x00, 0x0c, 0xc6, 0x5b, 0x62, 0xae,
+    0x47, 0x76, 0xe0, 0x00, 0x34, 0xab, 0x02, 0x0b, 0x20, 0x04, 0x08, 0x3a,
+    0x10, 0x39, 0xb7, 0x28, 0x46, 0xbc, 0x09, 0x14, 0x6d, 0x00, 0x00, 0x02,
+    0x02, 0x0f, 0x8c, 0x0a, 0x35, 0xb8, 0x03, 0x27, 0x73, 0x02, 0x01, 0x01,
+    0x09, 0x08, 0x1e, 0x0f, 0x33, 0x91, 0x03, 0x14, 0x55, 0x05, 0x0b, 0x0d,
+    0x03, 0x00, 0x00, 0x09, 0x04, 0x19, 0x0a, 0x0a, 0x0a, 0x19, 0x1e, 0xcc,
+    0x56, 0x64, 0xb0, 0x50, 0x60, 0xab, 0x4b, 0x5c, 0xa7, 0x48, 0x59, 0xa9,
+    0x3f, 0x50, 0xac, 0x32, 0x3a, 0xb3, 0x4c, 0x54, 0xb8, 0xce, 0xff, 0x36,
+    0xaa, 0xff, 0x1d, 0xb0, 0xff, 0x1c, 0xac, 0xff, 0x1e, 0xb0, 0xfc, 0x29,
+    0xb7, 0xd5, 0x62, 0x6f, 0x7b, 0xa4, 0x00, 0x02, 0xd4, 0x51, 0x53, 0xbb,
+    0xc8, 0xfa, 0x24, 0xb5, 0xf0, 0x23, 0xcb, 0xfa, 0x43, 0xca, 0xff, 0x31,
+    0xbd, 0xf9, 0x14, 0xbd, 0xfe, 0x12, 0xe4, 0xfc, 0x4b, 0x53, 0x58, 0xaf,
+    0x6a, 0x65, 0xaa, 0xf2, 0xfe, 0x14, 0xf7, 0xfc, 0x29, 0x60, 0x6b, 0xc0,
+    0x5c, 0x75, 0xdc, 0xdd, 0xe5, 0x4f, 0xda, 0xf5, 0x13, 0xe5, 0xff, 0x07,
+    0xc7, 0xce, 0x64, 0x0a, 0x0d, 0xc2, 0x74, 0x6d, 0x9f, 0xff, 0xff, 0x0f,
+    0xff, 0xff, 0x43, 0x10, 0x10, 0x9c, 0x00, 0x00, 0xb5, 0xae, 0xad, 0x88,
+    0xff, 0xff, 0x0a, 0xf4, 0xfc, 0x05, 0xe7, 0xeb, 0x55, 0x19, 0x1b, 0x94,
+    0x00, 0x00, 0x0e, 0x7c, 0x73, 0x96, 0xfe, 0xfe, 0x08, 0xfe, 0xfe, 0x50,
+    0x63, 0x63, 0x79, 0x6f, 0x6d, 0x30, 0xee, 0xef, 0x44, 0xfa, 0xfc, 0x00,
+    0xff, 0xff, 0x19, 0xa9, 0xa9, 0x9d, 0x01, 0x02, 0xb2, 0x09, 0x0e, 0x00,
+    0x8d, 0x84, 0x8c, 0xfe, 0xff, 0x0a, 0xfd, 0xff, 0x0c, 0xff, 0xff, 0x22,
+    0xff, 0xff, 0x24, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x23, 0xd2, 0xd8, 0x6d,
+    0x24, 0x27, 0xe5, 0x01, 0x02, 0x53, 0x9f, 0x90, 0x7d, 0xff, 0xfe, 0x06,
+    0xfb, 0xee, 0x17, 0xf8, 0xed, 0x23, 0xff, 0xf4, 0x12, 0xff, 0xfc, 0x16,
+    0xcb, 0xd2, 0x80, 0x1a, 0x20, 0xaf, 0x00, 0x00, 0x5a, 0x00, 0x00, 0xe5,
+    0xaa, 0x94, 0x6f, 0xff, 0xfd, 0x00, 0xdb, 0xd1, 0x4d, 0x32, 0x34, 0xc3,
+    0x88, 0x8e, 0x94, 0xfa, 0xe1, 0x28, 0xf6, 0xee, 0x3b, 0x79, 0x7c, 0x86,
+    0x0c, 0x0b, 0x5a, 0x00, 0x00, 0xe7, 0xb7, 0x98, 0x62, 0xff, 0xec, 0x00,
+    0xd1, 0xc6, 0x5c, 0x01, 0x00, 0x5e, 0x05, 0x17, 0x7d, 0xd9, 0xbb, 0x4f,
+    0xff, 0xd4, 0x05, 0xfd, 0xe1, 0x26, 0x42, 0x3c, 0xad, 0x00, 0x02, 0xe3,
+    0xc2, 0x99, 0x58, 0xff, 0xda, 0x00, 0xc6, 0xbd, 0x6f, 0x09, 0x0c, 0x51,
+    0x34, 0x3d, 0x42, 0xe8, 0xb9, 0x3d, 0xfe, 0xb9, 0x03, 0xff, 0xce, 0x23,
+    0x4d, 0x47, 0x9e, 0x00, 0x06, 0xe3, 0xc6, 0x97, 0x55, 0xfe, 0xb1, 0x01,
+    0xed, 0xbc, 0x33, 0xdf, 0xae, 0x31, 0xf0, 0xab, 0x1a, 0xff, 0xa0, 0x0a,
+    0xfc, 0x91, 0x00, 0xff, 0xc3, 0x33, 0x43, 0x45, 0xa9, 0x00, 0x07, 0xe5,
+    0xc9, 0x90, 0x52, 0xff, 0x80, 0x00, 0xff, 0x7b, 0x00, 0xff, 0x7e, 0x00,
+    0xff, 0x92, 0x02, 0xf4, 0xbf, 0x52, 0x31, 0x3b, 0xa5, 0x09, 0x0b, 0xdb,
+    0xce, 0x9d, 0x53, 0xfd, 0xa3, 0x1f, 0xf7, 0x9d, 0x28, 0xf8, 0x9a, 0x25,
+    0xf6, 0x98, 0x28, 0xf4, 0x9c, 0x30, 0xd1, 0xa3, 0x61, 0x5d, 0x7d, 0xdc,
+    0x07, 0x21, 0x88, 0x03, 0x02, 0xd8, 0x21, 0x3c, 0xf1, 0x30, 0x72, 0xf3,
+    0x2c, 0x76, 0xe5, 0x32, 0x7a, 0xe6, 0x31, 0x71, 0xe7, 0x2e, 0x69, 0xe5,
+    0x1a, 0x56, 0xf8, 0x0b, 0x34, 0xbe, 0x08, 0x09, 0x22, 0x00, 0x00, 0x4f,
+    0x00, 0x00, 0x5f, 0x00, 0x00, 0x58, 0x01, 0x03, 0x59, 0x02, 0x05, 0x58,
+    0x03, 0x08, 0x68, 0x07, 0x0e, 0x65, 0x0b, 0x0a, 0x1d, 0x05, 0x05, 0x00,
+    0x04, 0x05, 0x00, 0x08, 0x0a, 0x00, 0x08, 0x04, 0x00, 0x03, 0x08, 0xc7,
+    0x48, 0x43, 0xbc, 0x63, 0x5e, 0xb8, 0x39, 0x3d, 0xa4, 0x3f, 0x44, 0xb8,
+    0xae, 0xb0, 0x95, 0xce, 0xf6, 0x4d, 0xd7, 0xff, 0x2e, 0xb5, 0xbe, 0x72,
+    0x00, 0x00, 0x56, 0x5e, 0x5f, 0xa2, 0xf1, 0xf0, 0x69, 0xe5, 0xff, 0x17,
+    0xb7, 0xfc, 0x00, 0xbe, 0xfa, 0x00, 0xbb, 0xc3, 0x71, 0x06, 0x05, 0x6b,
+    0x55, 0x5a, 0xa5, 0xfc, 0xfb, 0x53, 0xe9, 0xff, 0x0f, 0xd2, 0xfa, 0x00,
+    0xe2, 0xfd, 0x18, 0xff, 0xff, 0x3f, 0xdf, 0xdd, 0x71, 0x18, 0x18, 0x72,
+    0x3e, 0x47, 0xb8, 0xdc, 0xe1, 0x51, 0xff, 0xff, 0x12, 0xe8, 0xfb, 0x03,
+    0xf8, 0xff, 0x03, 0xf8, 0xf6, 0x31, 0xc4, 0xc1, 0x77, 0x6e, 0x73, 0xac,
+    0x0a, 0x0b, 0x7d, 0x8a, 0x8c, 0x7f, 0xff, 0xff, 0x0f, 0xfa, 0xfa, 0x00,
+    0xff, 0xff, 0x00, 0xe8, 0xe9, 0x41, 0x51, 0x8a, 0xcb, 0x05, 0x6e, 0xff,
+    0x00, 0x4e, 0xff, 0x00, 0x08, 0x62, 0x2b, 0x2b, 0xb0, 0xe5, 0xe4, 0x56,
+    0xfd, 0xfd, 0x04, 0xfd, 0xfd, 0x02, 0xf2, 0xf3, 0x38, 0x3c, 0x52, 0xe9,
+    0x00, 0x30, 0xda, 0x04, 0x30, 0x77, 0x02, 0x10, 0x35, 0x01, 0x03, 0x05,
+    0x49, 0x49, 0xa9, 0xff, 0xff, 0x42, 0xfb, 0xf9, 0x03, 0xfe, 0xfe, 0x2e,
+    0x6d, 0x6f, 0xba, 0x00, 0x00, 0x93, 0x07, 0x03, 0x09, 0xff, 0xff, 0x3c,
+    0xfe, 0xfe, 0x00, 0xf6, 0xf5, 0x58, 0x2a, 0x2b, 0x91, 0x05, 0x02, 0x00,
+    0x04, 0x06, 0x02, 0x3b, 0x3b, 0xaa, 0xee, 0xee, 0x4c, 0xfe, 0xfb, 0x00,
+    0xfd, 0xff, 0x3b, 0x4f, 0x50, 0x84, 0x00, 0x00, 0x53, 0xa5, 0xa3, 0x73,
+    0xff, 0xfb, 0x07, 0xfc, 0xe4, 0x01, 0xd5, 0xd1, 0x5a, 0x41, 0x40, 0x9c,
+    0x06, 0x06, 0xde, 0x0c, 0x09, 0xf8, 0x0a, 0x07, 0xf1, 0x23, 0x2a, 0xe4,
+    0xd0, 0xaf, 0x73, 0xff, 0xdb, 0x00, 0xff, 0xcd, 0x02, 0xe4, 0xca, 0x4b,
+    0xbc, 0xa7, 0x6a, 0xcb, 0xb3, 0x50, 0x8b, 0x87, 0x95, 0x00, 0x00, 0xa3,
+    0x00, 0x00, 0x5d, 0x32, 0x25, 0xd5, 0xb3, 0xa3, 0x9c, 0xfa, 0xc9, 0x1b,
+    0xff, 0xca, 0x00, 0xff, 0xc6, 0x00, 0xff, 0xd1, 0x00, 0xc4, 0xb2, 0x5c,
+    0x00, 0x00, 0x5e, 0x00, 0x00, 0x36, 0x00, 0x00, 0xc8, 0x43, 0x54, 0xe6,
+    0x93, 0x93, 0xa7, 0xa1, 0x9b, 0x89, 0x9f, 0x9f, 0x86, 0x6a, 0x66, 0xb4,
+    0x00, 0x00, 0x64, 0x00, 0x01, 0x0d, 0x00, 0x07, 0x89, 0x00, 0x10, 0xe1,
+    0x00, 0x2a, 0xff, 0x00, 0x37, 0xfc, 0x00, 0x29, 0xff, 0x01, 0x06, 0x7c,
+    0x04, 0x00, 0x00, 0x04, 0x06, 0x1a, 0x06, 0x0f, 0x40, 0x05, 0x0f, 0x31,
+    0x05, 0x0c, 0x3b, 0x01, 0x01, 0x24, 0x02, 0x00, 0x00, 0x39, 0x45, 0xb7,
+    0x5d, 0x63, 0xb6, 0x48, 0x46, 0xc3, 0x2b, 0x2c, 0xc7, 0x9c, 0xae, 0x86,
+    0xbd, 0xff, 0x1b, 0xaa, 0xf0, 0x37, 0xb4, 0xe4, 0x4e, 0x7f, 0x92, 0x8e,
+    0x17, 0x24, 0xc0, 0x9a, 0xa2, 0x77, 0xa9, 0xfc, 0x00, 0x93, 0xf3, 0x00,
+    0x9b, 0xfc, 0x00, 0xd7, 0xff, 0x2a, 0xb6, 0xca, 0x6e, 0x2c, 0x3a, 0xb4,
+    0xad, 0xab, 0x69, 0xee, 0xfe, 0x01, 0xcd, 0xf9, 0x00, 0xce, 0xfc, 0x00,
+    0xb4, 0xf5, 0x00, 0xec, 0xff, 0x19, 0x92, 0xac, 0x73, 0x10, 0x1e, 0xc9,
+    0xc1, 0xbd, 0x5e, 0xff, 0xff, 0x00, 0xd0, 0xea, 0x48, 0xcb, 0xe4, 0x4a,
+    0xeb, 0xff, 0x02, 0xe8, 0xfa, 0x03, 0xfa, 0xff, 0x14, 0x63, 0x6b, 0xab,
+    0x34, 0x2c, 0xd5, 0xd4, 0xd3, 0x4f, 0xfe, 0xff, 0x00, 0x76, 0x98, 0xb3,
+    0x23, 0x55, 0xfb, 0xe5, 0xe5, 0x59, 0xfe, 0xfd, 0x04, 0xff, 0xfe, 0x00,
+    0xa6, 0xa2, 0x8b, 0x00, 0x02, 0xbe, 0x35, 0x2e, 0xd4, 0xec, 0xeb, 0x40,
+    0xff, 0xff, 0x07, 0x61, 0x66, 0x97, 0x00, 0x02, 0xee, 0x78, 0x84, 0xc3,
+    0xff, 0xff, 0x1b, 0xfe, 0xfe, 0x00, 0xc7, 0xc7, 0x60, 0x03, 0x04, 0x7b,
+    0x4b, 0x46, 0xcc, 0xfb, 0xfb, 0x2f, 0xfe, 0xfe, 0x1c, 0x4a, 0x49, 0x63,
+    0x02, 0x00, 0x6b, 0x6e, 0x65, 0xd8, 0xfe, 0xfe, 0x12, 0xc4, 0xc2, 0x6b,
+    0x02, 0x01, 0x61, 0x58, 0x52, 0xca, 0xff, 0xfe, 0x1a, 0xff, 0xfe, 0x1e,
+    0x32, 0x34, 0x6d, 0x00, 0x00, 0x23, 0x87, 0x81, 0xc5, 0xfe, 0xfe, 0x07,
+    0xfe, 0xfe, 0x04, 0xae, 0xb7, 0x84, 0x00, 0x00, 0x49, 0x55, 0x55, 0xb8,
+    0xfe, 0xff, 0x12, 0xfe, 0xff, 0x2a, 0x18, 0x18, 0x7f, 0x0e, 0x11, 0x42,
+    0xd7, 0xdb, 0x8c, 0xfd, 0xfd, 0x00, 0xff, 0xff, 0x3b, 0x43, 0x47, 0xaf,
+    0x00, 0x00, 0x1a, 0x58, 0x57, 0xa4, 0xfe, 0xf2, 0x0d, 0xfa, 0xec, 0x2d,
+    0x6a, 0x76, 0x89, 0xb8, 0xc0, 0x66, 0xff, 0xff, 0x09, 0xff, 0xff, 0x0d,
+    0x97, 0x9c, 0xa2, 0x00, 0x00, 0x87, 0x01, 0x01, 0x00, 0x00, 0x00, 0xeb,
+    0x61, 0x5e, 0xa3, 0xfb, 0xdb, 0x05, 0xf7, 0xbc, 0x0b, 0xff, 0xdb, 0x20,
+    0xff, 0xdb, 0x02, 0xff, 0xec, 0x0b, 0xa4, 0xae, 0x98, 0x05, 0x1b, 0xf1,
+    0x02, 0x03, 0x17, 0x00, 0x00, 0xef, 0x8e, 0x85, 0x8b, 0xff, 0xd5, 0x00,
+    0xff, 0xa7, 0x00, 0xff, 0xb8, 0x00, 0xea, 0xc0, 0x44, 0x7c, 0x89, 0xc8,
+    0x08, 0x1f, 0xf7, 0x03, 0x09, 0x42, 0x03, 0x04, 0x00, 0x00, 0x00, 0xe5,
+    0x56, 0x52, 0xb6, 0xab, 0xa3, 0x85, 0xb3, 0xa8, 0x8c, 0x7d, 0x9d, 0xc1,
+    0x2b, 0x5b, 0xfa, 0x00, 0x1d, 0xcc, 0x04, 0x07, 0x33, 0x03, 0x00, 0x00,
+    0x07, 0x00, 0xdd, 0x00, 0x2e, 0xff, 0x02, 0x4d, 0xff, 0x0f, 0x42, 0xff,
+    0x00, 0x2b, 0xe0, 0x02, 0x10, 0x82, 0x07, 0x04, 0x1a, 0x01, 0x00, 0x00,
+    0x02, 0x00, 0x43, 0x00, 0x06, 0x5b, 0x05, 0x0a, 0x62, 0x08, 0x00, 0x30,
+    0x02, 0x00, 0x00, 0x01, 0x03, 0xd4, 0x4c, 0x4e, 0xb2, 0x76, 0x6a, 0x9b,
+    0x67, 0x64, 0xb7, 0x62, 0x60, 0xca, 0x4a, 0x55, 0xd2, 0x1a, 0x25, 0x89,
+    0x17, 0x1e, 0xd3, 0x9a, 0xa3, 0x9c, 0xd4, 0xff, 0x37, 0xb0, 0xff, 0x08,
+    0xb0, 0xff, 0x14, 0xb7, 0xff, 0x19, 0xbf, 0xcc, 0x72, 0x11, 0x0f, 0x7f,
+    0x1c, 0x1c, 0xd2, 0xbb, 0xc1, 0x8a, 0xec, 0xff, 0x13, 0xc7, 0xf8, 0x03,
+    0xd5, 0xff, 0x08, 0xd0, 0xff, 0x00, 0xcf, 0xff, 0x00, 0x07, 0x04, 0x9e,
+    0x05, 0x09, 0xea, 0x8c, 0x8d, 0x9b, 0xff, 0xff, 0x17, 0xd4, 0xf4, 0x01,
+    0xf4, 0xff, 0x51, 0xbf, 0xd6, 0x9f, 0xad, 0xbc, 0x96, 0xc0, 0xc5, 0x6a,
+    0x96, 0x93, 0x9a, 0x00, 0x00, 0x74, 0x00, 0x00, 0xed, 0xb9, 0xb8, 0x68,
+    0xfd, 0xfd, 0x00, 0xff, 0xfd, 0x17, 0x7c, 0x87, 0xb5, 0x00, 0x27, 0xff,
+    0x00, 0x3e, 0xff, 0x00, 0x43, 0xff, 0x08, 0x2e, 0xff, 0x00, 0x00, 0x52,
+    0x06, 0x06, 0xeb, 0xc4, 0xc2, 0x5c, 0xfe, 0xfe, 0x00, 0xfd, 0xfa, 0x18,
+    0xb2, 0xb1, 0x90, 0x82, 0x7b, 0xa2, 0x82, 0x82, 0xab, 0x68, 0x6c, 0xbc,
+    0x04, 0x12, 0xcf, 0x00, 0x00, 0x30, 0x1c, 0x1c, 0xe5, 0xd9, 0xd8, 0x45,
+    0xff, 0xfe, 0x00, 0xfd, 0xfa, 0x0c, 0xff, 0xff, 0x00, 0xed, 0xec, 0x7b,
+    0x0f, 0x0c, 0x8b, 0x30, 0x30, 0xdd, 0xea, 0xea, 0x38, 0xff, 0xff, 0x01,
+    0xf6, 0xf8, 0x5a, 0xcf, 0xd6, 0x81, 0xde, 0xdd, 0x66, 0xe7, 0xe5, 0x3f,
+    0xa9, 0xa7, 0x81, 0x07, 0x07, 0x90, 0x44, 0x44, 0xd2, 0xfb, 0xf8, 0x2e,
+    0xff, 0xfb, 0x07, 0xea, 0xf0, 0x65, 0x2e, 0x4f, 0xf0, 0x08, 0x30, 0xff,
+    0x17, 0x46, 0xff, 0x15, 0x2e, 0xe5, 0x01, 0x01, 0x39, 0x40, 0x3f, 0xd3,
+    0xf8, 0xea, 0x2d, 0xfe, 0xe8, 0x00, 0xfe, 0xf2, 0x2f, 0xd1, 0xd0, 0x7e,
+    0x57, 0x58, 0xb4, 0x3d, 0x4f, 0xd5, 0x15, 0x1e, 0xdd, 0x00, 0x00, 0x24,
+    0x14, 0x15, 0xe0, 0xd4, 0xc4, 0x6d, 0xff, 0xe3, 0x00, 0xfb, 0xce, 0x08,
+    0xff, 0xdf, 0x23, 0xff, 0xe2, 0x24, 0xff, 0xf9, 0x39, 0x70, 0x65, 0xac,
+    0x00, 0x00, 0x33, 0x00, 0x00, 0x6c, 0x59, 0x54, 0xd1, 0xfe, 0xdd, 0x32,
+    0xff, 0xb5, 0x00, 0xfa, 0xa9, 0x00, 0xf4, 0xa0, 0x00, 0xf8, 0xdc, 0x27,
+    0x60, 0x5e, 0xb2, 0x00, 0x00, 0x25, 0x00, 0x01, 0x96, 0x6f, 0x73, 0xd8,
+    0xdf, 0xbc, 0x5c, 0xff, 0xbc, 0x1a, 0xff, 0xb6, 0x04, 0xff, 0xea, 0x38,
+    0x52, 0x51, 0xa4, 0x00, 0x00, 0x13, 0x00, 0x01, 0x14, 0x00, 0x15, 0xe8,
+    0x23, 0x5e, 0xff, 0x5d, 0x85, 0xd7, 0x7a, 0x96, 0xc2, 0x8d, 0x9c, 0xb9,
+    0x28, 0x26, 0x91, 0x00, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x04, 0x2f,
+    0x00, 0x1b, 0x95, 0x00, 0x36, 0xef, 0x00, 0x54, 0xf1, 0x09, 0x47, 0xff,
+    0x00, 0x03, 0x88, 0x02, 0x00, 0x00, 0x06, 0x00, 0x1d, 0x05, 0x00, 0x1e,
+    0x04, 0x07, 0x39, 0x00, 0x01, 0x30, 0x3a, 0x34, 0xd6, 0x4b, 0x41, 0xc6,
+    0x4d, 0x45, 0xcc, 0x0d, 0x11, 0xc0, 0x22, 0x24, 0xbc, 0x7d, 0x8f, 0x90,
+    0x89, 0x97, 0x83, 0xa1, 0xba, 0x6c, 0xa1, 0xd3, 0x55, 0xa1, 0xed, 0x38,
+    0x9c, 0xfd, 0x25, 0xd3, 0xff, 0x27, 0x53, 0x52, 0x8a, 0x35, 0x31, 0xba,
+    0xd5, 0xfc, 0x41, 0x9c, 0xff, 0x00, 0xa9, 0xff, 0x04, 0xbd, 0xff, 0x00,
+    0xc6, 0xff, 0x01, 0xc3, 0xff, 0x17, 0xe0, 0xf7, 0x35, 0x73, 0x73, 0x9b,
+    0x20, 0x2c, 0x57, 0xc4, 0xcf, 0x59, 0xc3, 0xfa, 0x07, 0xd3, 0xed, 0x6d,
+    0x9e, 0xb7, 0xb4, 0x70, 0x9e, 0xcb, 0x4c, 0x83, 0xe4, 0x3a, 0x71, 0xef,
+    0x0d, 0x33, 0xf2, 0x0b, 0x0b, 0x41, 0xa7, 0xab, 0x81, 0xfb, 0xfe, 0x00,
+    0xb6, 0xc8, 0x55, 0x00, 0x33, 0xff, 0x03, 0x5f, 0xff, 0x05, 0x48, 0xff,
+    0x08, 0x43, 0xf3, 0x00, 0x1a, 0xcc, 0x08, 0x0a, 0x3a, 0x94, 0x94, 0x8e,
+    0xff, 0xff, 0x00, 0xd5, 0xd3, 0x34, 0x0c, 0x0b, 0x6f, 0x00, 0x00, 0x26,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x02, 0x03, 0x00, 0x7c, 0x7b, 0xa0,
+    0xfe, 0xfe, 0x09, 0xed, 0xee, 0x2b, 0x2f, 0x2f, 0x74, 0x0d, 0x0d, 0x89,
+    0x19, 0x1b, 0x97, 0x23, 0x26, 0x97, 0x22, 0x32, 0xb0, 0x83, 0x82, 0xa7,
+    0xf6, 0xf6, 0x28, 0xfc, 0xfc, 0x18, 0xce, 0xcd, 0x79, 0xe6, 0xe6, 0x6c,
+    0xff, 0xff, 0x47, 0xff, 0xff, 0x6c, 0x1c, 0x23, 0xb4, 0x4a, 0x4a, 0xbd,
+    0xf2, 0xf2, 0x3b, 0xff, 0xff, 0x02, 0xff, 0xff, 0x1f, 0xe1, 0xe1, 0x24,
+    0xc1, 0xbc, 0x3e, 0xbb, 0xb7, 0x81, 0x0e, 0x0e, 0x84, 0x1b, 0x1b, 0xd4,
+    0xe1, 0xe1, 0x52, 0xfe, 0xfe, 0x00, 0x84, 0x86, 0xa9, 0x11, 0x35, 0xff,
+    0x0b, 0x68, 0xff, 0x00, 0x4f, 0xff, 0x00, 0x0f, 0xbd, 0x0c, 0x0c, 0xd0,
+    0xc1, 0xbe, 0x6f, 0xff, 0xfe, 0x00, 0x9c, 0x96, 0x8c, 0x00, 0x0d, 0xd8,
+    0x0a, 0x25, 0x95, 0x06, 0x13, 0x8e, 0x00, 0x04, 0x58, 0x00, 0x00, 0xcb,
+    0x9e, 0x9c, 0x8a, 0xff, 0xe0, 0x01, 0xd2, 0xc3, 0x83, 0x06, 0x05, 0x72,
+    0x7b, 0x7e, 0xa5, 0xfb, 0xb2, 0x00, 0xf0, 0xbe, 0x5d, 0x0b, 0x12, 0x85,
+    0x76, 0x70, 0xb0, 0xff, 0xdc, 0x33, 0xee, 0xd2, 0x72, 0x1a, 0x18, 0x8f,
+    0x1d, 0x21, 0xc5, 0x47, 0x6f, 0xec, 0x31, 0x6c, 0xfe, 0x04, 0x17, 0xc6,
+    0x00, 0x06, 0xcb, 0x00, 0x36, 0xf9, 0x00, 0x39, 0xdb, 0x00, 0x0e, 0xa5,
+    0x00, 0x01, 0x1a, 0x03, 0x00, 0x2b, 0x04, 0x00, 0x1a, 0x04, 0x01, 0x05,
+    0x00, 0x02, 0x00, 0x3d, 0x46, 0xd8, 0x46, 0x4d, 0xd9, 0x48, 0x46, 0xcd,
+    0x25, 0x2a, 0xbf, 0x3c, 0x42, 0xbe, 0x99, 0xac, 0x91, 0xbf, 0xe6, 0x58,
+    0xaf, 0xf7, 0x2e, 0xcd, 0xfe, 0x31, 0x9a, 0xab, 0x98, 0x00, 0x00, 0x6b,
+    0x47, 0x49, 0xbd, 0xe1, 0xef, 0x5c, 0xdc, 0xff, 0x06, 0xc1, 0xff, 0x01,
+    0xbe, 0xff, 0x00, 0xde, 0xff, 0x04, 0xa9, 0xb3, 0x96, 0x00, 0x00, 0x4a,
+    0x29, 0x2c, 0xca, 0xda, 0xde, 0x69, 0xf1, 0xff, 0x01, 0xe6, 0xfd, 0x06,
+    0xf1, 0xfd, 0x3a, 0xd9, 0xe5, 0x47, 0xdf, 0xe1, 0x4e, 0x92, 0x98, 0xa0,
+    0x00, 0x00, 0x4e, 0x00, 0x00, 0xdd, 0x91, 0x93, 0x97, 0xff, 0xff, 0x1b,
+    0xfa, 0xfe, 0x0e, 0xe8, 0xed, 0x55, 0x70, 0x97, 0xb1, 0x3b, 0x88, 0xe2,
+    0x34, 0x82, 0xf2, 0x12, 0x3b, 0xf4, 0x00, 0x00, 0x43, 0x21, 0x25, 0xc8,
+    0xdd, 0xdd, 0x69, 0xfd, 0xfd, 0x0a, 0xec, 0xec, 0x4c, 0x31, 0x4b, 0xd0,
+    0x00, 0x24, 0xfe, 0x00, 0x30, 0xfc, 0x00, 0x19, 0xef, 0x00, 0x0e, 0xe7,
+    0x00, 0x03, 0x43, 0x59, 0x5c, 0xb9, 0xff, 0xff, 0x37, 0xfe, 0xfe, 0x32,
+    0x5c, 0x61, 0x99, 0x00, 0x00, 0xc2, 0xad, 0xa7, 0x79, 0xb3, 0xac, 0x42,
+    0xb2, 0xad, 0x42, 0x78, 0x75, 0x9f, 0x00, 0x00, 0x81, 0x58, 0x5b, 0xb7,
+    0xfe, 0xfd, 0x1b, 0xff, 0xfe, 0x40, 0x19, 0x19, 0xaf, 0x05, 0x03, 0xa4,
+    0xff, 0xff, 0x54, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xc0, 0xc0, 0x87,
+    0x00, 0x00, 0x53, 0x5a, 0x5c, 0xaf, 0xfe, 0xff, 0x1a, 0xff, 0xff, 0x33,
+    0x41, 0x41, 0x9f, 0x00, 0x00, 0xb5, 0x1c, 0x2e, 0xd7, 0xc5, 0xc2, 0x5e,
+    0xfb, 0xfd, 0x02, 0xaf, 0xaf, 0x8d, 0x00, 0x00, 0x4f, 0x50, 0x50, 0xb8,
+    0xfc, 0xf0, 0x29, 0xfe, 0xe5, 0x11, 0xdc, 0xc5, 0x56, 0x30, 0x3f, 0xc4,
+    0x07, 0x26, 0xed, 0xc3, 0xb4, 0x62, 0xff, 0xf2, 0x00, 0xb2, 0xab, 0x8c,
+    0x00, 0x00, 0x50, 0x19, 0x1b, 0x9c, 0xd9, 0xc4, 0x75, 0xff, 0xc8, 0x08,
+    0xff, 0xbe, 0x0d, 0xfc, 0xca, 0x2c, 0xf8, 0xc9, 0x3c, 0xfa, 0xc4, 0x27,
+    0xff, 0xcc, 0x01, 0xb4, 0xa5, 0x8b, 0x00, 0x04, 0x4d, 0x65, 0x61, 0xc3,
+    0xfd, 0xd5, 0x49, 0xff, 0xb1, 0x09, 0xfe, 0xa8, 0x00, 0xfd, 0xab, 0x01,
+    0xf7, 0xa5, 0x06, 0xfa, 0xbb, 0x04, 0xb2, 0x9d, 0x8d, 0x00, 0x00, 0x8d,
+    0x58, 0x6c, 0xed, 0xdd, 0xc0, 0x65, 0xff, 0xac, 0x1c, 0xff, 0xa3, 0x02,
+    0xff, 0xa1, 0x00, 0xff, 0xb6, 0x00, 0xc1, 0xa2, 0x84, 0x03, 0x03, 0x10,
+    0x00, 0x04, 0xa4, 0x11, 0x4c, 0xf9, 0x61, 0x8b, 0xd0, 0xa1, 0xa9, 0x9f,
+    0xa8, 0x96, 0x85, 0xa9, 0x9e, 0x7d, 0x77, 0x73, 0xaf, 0x00, 0x00, 0x48,
+    0x02, 0x00, 0x04, 0x01, 0x04, 0x5f, 0x00, 0x29, 0xb8, 0x00, 0x47, 0xfc,
+    0x00, 0x53, 0xff, 0x00, 0x5d, 0xff, 0x00, 0x33, 0xff, 0x00, 0x00, 0x02,
+    0x03, 0x00, 0x1b, 0x04, 0x00, 0x3a, 0x04, 0x03, 0x5e, 0x05, 0x04, 0x5c,
+    0x03, 0x02, 0x63, 0x00, 0x00, 0x20, 0x01, 0x01, 0x00, 0x02, 0x02, 0x00,
+    0x2e, 0x38, 0xc3, 0x4e, 0x4c, 0xaf, 0x2c, 0x34, 0xc7, 0x4f, 0x5a, 0xc5,
+    0x92, 0x99, 0x9d, 0x96, 0x9f, 0x9b, 0x5a, 0x5e, 0xb0, 0x8a, 0xae, 0x74,
+    0xcc, 0xfd, 0x10, 0x99, 0xbe, 0x68, 0x06, 0x0a, 0x98, 0x80, 0x8f, 0xa4,
+    0xdc, 0xff, 0x1a, 0xd1, 0xff, 0x12, 0x9b, 0x9e, 0xa2, 0x00, 0x00, 0x3f,
+    0x95, 0xaa, 0x91, 0xc6, 0xfe, 0x00, 0xb2, 0xd0, 0x56, 0x17, 0x18, 0x8a,
+    0x64, 0x72, 0xb2, 0xe3, 0xfa, 0x23, 0xe3, 0xfa, 0x11, 0x8d, 0x91, 0xa5,
+    0x04, 0x04, 0x5d, 0xa5, 0xaa, 0x96, 0xff, 0xff, 0x09, 0xd7, 0xdb, 0x4a,
+    0x2e, 0x2f, 0x9b, 0x59, 0x65, 0xb9, 0xfc, 0xff, 0x2b, 0xfe, 0xff, 0x14,
+    0x87, 0x8b, 0xa5, 0x00, 0x00, 0x75, 0x9c, 0x9f, 0x9c, 0xff, 0xfe, 0x10,
+    0xe9, 0xeb, 0x41, 0x39, 0x39, 0x96, 0x5c, 0x66, 0xb9, 0xf8, 0xf9, 0x37,
+    0xfe, 0xff, 0x18, 0xb4, 0xb7, 0xa7, 0x53, 0x59, 0xb8, 0x6b, 0x71, 0xb7,
+    0x5c, 0x62, 0xd4, 0xbd, 0xbe, 0x97, 0xfe, 0xff, 0x19, 0xfb, 0xfb, 0x37,
+    0x46, 0x46, 0x91, 0x00, 0x00, 0x27, 0x87, 0x8b, 0xa9, 0xe8, 0xe9, 0x4a,
+    0xfe, 0xff, 0x12, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40,
+    0xff, 0xff, 0x44, 0xff, 0xff, 0x4e, 0xfe, 0xfe, 0x1a, 0xff, 0xff, 0x26,
+    0x5b, 0x5b, 0x99, 0x00, 0x00, 0x40, 0x5a, 0x5a, 0xb7, 0xe3, 0xe3, 0x44,
+    0xff, 0xff, 0x10, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x1f,
+    0xfd, 0xfd, 0x05, 0xfe, 0xfe, 0x21, 0x69, 0x69, 0x9e, 0x00, 0x00, 0x4c,
+    0x3f, 0x3f, 0xc4, 0xdd, 0xdd, 0x4a, 0xff, 0xfe, 0x18, 0xd7, 0xd7, 0x5a,
+    0xb4, 0xbf, 0x65, 0xb6, 0xc3, 0x66, 0xb3, 0xbc, 0x66, 0xe0, 0xe1, 0x4f,
+    0xfd, 0xfd, 0x0b, 0xff, 0xfe, 0x22, 0x79, 0x79, 0x9f, 0x00, 0x00, 0x64,
+    0x21, 0x21, 0xd3, 0xd5, 0xd3, 0x61, 0xff, 0xff, 0x0b, 0x75, 0x70, 0xa4,
+    0x00, 0x39, 0xff, 0x1a, 0x63, 0xff, 0x00, 0x24, 0xff, 0x8b, 0x8b, 0x94,
+    0xff, 0xff, 0x2a, 0xff, 0xff, 0x25, 0x89, 0x8a, 0x97, 0x00, 0x00, 0x7c,
+    0x06, 0x09, 0xda, 0xcf, 0xc4, 0x68, 0xff, 0xfb, 0x09, 0x8a, 0x83, 0x9b,
+    0x04, 0x08, 0x77, 0x15, 0x17, 0x58, 0x02, 0x04, 0x78, 0x7f, 0x80, 0x9f,
+    0xff, 0xf4, 0x2e, 0xff, 0xef, 0x16, 0x95, 0x95, 0x8e, 0x00, 0x00, 0x97,
+    0x00, 0x09, 0xe3, 0xc8, 0xb5, 0x71, 0xfe, 0xe7, 0x03, 0x8e, 0x89, 0x9c,
+    0x00, 0x00, 0x2f, 0x6f, 0x6e, 0xa3, 0xfc, 0xd9, 0x2d, 0xfc, 0xcb, 0x04,
+    0xab, 0xa7, 0x91, 0x00, 0x00, 0x5d, 0x00, 0x12, 0xed, 0xbd, 0xa3, 0x7a,
+    0xfb, 0xc1, 0x00, 0x9c, 0x92, 0x8e, 0x00, 0x00, 0x4e, 0x7b, 0x7f, 0xb8,
+    0xfe, 0xc5, 0x38, 0xff, 0xb6, 0x00, 0xc8, 0xb7, 0x83, 0x02, 0x04, 0x56,
+    0x00, 0x16, 0xeb, 0xba, 0xa7, 0x8c, 0xff, 0xe0, 0x33, 0xa4, 0x96, 0x90,
+    0x00, 0x00, 0x55, 0x5a, 0x58, 0xb8, 0xd6, 0xc6, 0x6b, 0xd8, 0xc8, 0x53,
+    0xa8, 0xa4, 0x9a, 0x0d, 0x0c, 0x53, 0x04, 0x1e, 0xe0, 0x35, 0x59, 0xd7,
+    0x52, 0x93, 0xe1, 0x26, 0x53, 0xe6, 0x00, 0x01, 0x61, 0x04, 0x0d, 0xdd,
+    0x3b, 0x7b, 0xf9, 0x4e, 0xa2, 0xff, 0x25, 0x68, 0xff, 0x00, 0x03, 0x69,
+    0x05, 0x28, 0xe2, 0x0c, 0x2f, 0xed, 0x12, 0x42, 0xe9, 0x03, 0x27, 0xda,
+    0x00, 0x00, 0x5e, 0x02, 0x1a, 0x88, 0x07, 0x22, 0x77, 0x04, 0x15, 0x78,
+    0x00, 0x00, 0x32, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x0b,
+    0x02, 0x00, 0x00, 0x49, 0x59, 0xdf, 0x59, 0x62, 0xd1, 0x2c, 0x36, 0xd6,
+    0x02, 0x02, 0x99, 0x1f, 0x1d, 0xe8, 0xb6, 0xd9, 0x58, 0xc6, 0xfc, 0x08,
+    0x87, 0x9a, 0x7f, 0x02, 0x00, 0xde, 0x17, 0x17, 0xef, 0xb7, 0xcd, 0x5c,
+    0xc9, 0xfe, 0x00, 0xba, 0xd0, 0x56, 0x14, 0x14, 0xcd, 0x07, 0x0b, 0xf2,
+    0xb4, 0xb9, 0x70, 0xf5, 0xff, 0x00, 0xec, 0xf3, 0x37, 0x41, 0x40, 0xca,
+    0xa6, 0xa9, 0x7d, 0xff, 0xff, 0x04, 0xff, 0xff, 0x18, 0x69, 0x69, 0xb6,
+    0x00, 0x00, 0x4a, 0x8f, 0x93, 0xa1, 0xfe, 0xfe, 0x08, 0xfe, 0xfe, 0x04,
+    0x8a, 0x89, 0x9e, 0x00, 0x00, 0x5c, 0x6f, 0x70, 0xbb, 0xfe, 0xfe, 0x12,
+    0xfe, 0xff, 0x00, 0xaf, 0xaf, 0x7e, 0x00, 0x00, 0x72, 0x5d, 0x5a, 0xbe,
+    0xfe, 0xfe, 0x1c, 0xff, 0xfb, 0x00, 0xd2, 0xd2, 0x65, 0x0b, 0x0a, 0x7e,
+    0x46, 0x44, 0xc7, 0xfd, 0xf1, 0x28, 0xff, 0xdf, 0x00, 0xf1, 0xe5, 0x4b,
+    0x2e, 0x22, 0x86, 0x54, 0x50, 0xac, 0xe8, 0xd2, 0x3e, 0xff, 0xc4, 0x00,
+    0xfe, 0xdd, 0x2f, 0x5d, 0x44, 0x8e, 0x14, 0x1a, 0x58, 0xd5, 0xb8, 0x52,
+    0xfe, 0xaf, 0x01, 0xfe, 0xc4, 0x17, 0x91, 0x69, 0x83, 0x08, 0x0b, 0x58,
+    0xcb, 0xa8, 0x64, 0xfd, 0x9c, 0x00, 0xfe, 0xb5, 0x0a, 0xc0, 0x95, 0x74,
+    0x00, 0x00, 0x74, 0xbb, 0x9d, 0x82, 0xff, 0xc6, 0x1c, 0xff, 0xc0, 0x37,
+    0xae, 0x79, 0x85, 0x05, 0x01, 0x98, 0x7d, 0x66, 0xa0, 0xb2, 0xa8, 0x8f,
+    0x59, 0x81, 0xcc, 0x29, 0x66, 0xff, 0x06, 0x10, 0xbe, 0x10, 0x32, 0xd7,
+    0x22, 0x84, 0xf9, 0x14, 0x5f, 0xd8, 0x01, 0x2e, 0x6a, 0x00, 0x04, 0x33,
+    0x00, 0x11, 0x80, 0x03, 0x15, 0x49, 0x0e, 0x06, 0x17, 0x04, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x19, 0x15, 0xff, 0x44, 0x45, 0xeb, 0x48, 0x48, 0xf6,
+    0x32, 0x37, 0xe2, 0xb2, 0xbe, 0x9d, 0xd3, 0xf3, 0x6e, 0xb9, 0xd3, 0x8a,
+    0x07, 0x06, 0xf9, 0x1d, 0x34, 0xd0, 0xb0, 0xdb, 0x6c, 0xc4, 0xff, 0x07,
+    0xcf, 0xfc, 0x44, 0x3e, 0x48, 0xd9, 0x64, 0x65, 0xd4, 0xee, 0xfb, 0x31,
+    0xf9, 0xff, 0x16, 0x65, 0x68, 0xc4, 0x00, 0x00, 0xff, 0x29, 0x2d, 0xf0,
+    0xd4, 0xd4, 0x6d, 0xff, 0xfe, 0x00, 0xa0, 0x9c, 0xb8, 0x01, 0x00, 0xda,
+    0x9f, 0x9f, 0x94, 0xfe, 0xff, 0x13, 0xe8, 0xe9, 0x7f, 0x0e, 0x0e, 0xa6,
+    0x83, 0x83, 0xb8, 0xff, 0xff, 0x16, 0xfd, 0xfd, 0x51, 0x17, 0x17, 0x9e,
+    0x63, 0x63, 0xcd, 0xff, 0xff, 0x0b, 0xfe, 0xfe, 0x3c, 0x17, 0x17, 0x95,
+    0x65, 0x65, 0xc8, 0xff, 0xfe, 0x0c, 0xfb, 0xfb, 0x39, 0x17, 0x17, 0x96,
+    0x14, 0x14, 0xd4, 0x61, 0x61, 0xc0, 0xff, 0xff, 0x0c, 0xef, 0xf1, 0x3d,
+    0x17, 0x17, 0x86, 0x16, 0x16, 0xe7, 0xc7, 0xc6, 0x7b, 0xa1, 0x9f, 0x99,
+    0x39, 0x42, 0xe2, 0xcb, 0xcb, 0x8b, 0xfe, 0xf6, 0x00, 0xe7, 0xe4, 0x5f,
+    0x11, 0x11, 0x77, 0x26, 0x2b, 0xf9, 0xe0, 0xce, 0x5e, 0xff, 0xe9, 0x0c,
+    0xc6, 0xb4, 0x72, 0xb9, 0xa3, 0x6b, 0xe6, 0xd5, 0x67, 0xff, 0xdd, 0x13,
+    0xff, 0xe0, 0x00, 0xac, 0xa4, 0xa9, 0x00, 0x05, 0x74, 0x37, 0x44, 0xff,
+    0xe3, 0xc2, 0x60, 0xff, 0xb6, 0x00, 0xff, 0xb5, 0x00, 0xff, 0xbb, 0x00,
+    0xff, 0xaf, 0x00, 0xff, 0xc2, 0x09, 0xeb, 0xd1, 0x6a, 0x2c, 0x31, 0xd1,
+    0x00, 0x00, 0x31, 0x05, 0x32, 0xfa, 0x59, 0x7f, 0xe0, 0xf1, 0xc9, 0x55,
+    0xff, 0xbc, 0x29, 0xff, 0xb0, 0x25, 0xff, 0xb6, 0x28, 0xd3, 0xbd, 0x83,
+    0x2e, 0x47, 0xf8, 0x00, 0x00, 0x64, 0x00, 0x08, 0xcb, 0x2b, 0x4f, 0xf2,
+    0x43, 0x86, 0xe4, 0x41, 0x9a, 0xe6, 0x43, 0x95, 0xe4, 0x15, 0x41, 0xfc,
+    0x00, 0x00, 0x76, 0x06, 0x02, 0x02, 0x05, 0x00, 0x1e, 0x00, 0x01, 0x81,
+    0x00, 0x1b, 0xb2, 0x00, 0x29, 0xc2, 0x00, 0x27, 0xcd, 0x00, 0x06, 0x75,
+    0x04, 0x00, 0x00, 0x06, 0x00, 0x06, 0x07, 0x00, 0x00, 0x13, 0x18, 0xce,
+    0x27, 0x2b, 0xd7, 0x1f, 0x24, 0xd2, 0x0c, 0x11, 0xcf, 0x53, 0x5b, 0xac,
+    0xb0, 0xd5, 0x62, 0xc3, 0xe2, 0x56, 0x6c, 0x70, 0x96, 0x57, 0x55, 0xb7,
+    0xc6, 0xff, 0x19, 0xe3, 0xff, 0x01, 0x8b, 0x86, 0x7e, 0x00, 0x00, 0x38,
+    0x09, 0x12, 0xc4, 0x3b, 0x35, 0xc1, 0xe0, 0xf2, 0x31, 0xfc, 0xfe, 0x04,
+    0x84, 0x81, 0x83, 0x00, 0x00, 0x3d, 0x23, 0x27, 0xcc, 0xad, 0xc1, 0x85,
+    0x61, 0x76, 0x9c, 0x35, 0x2c, 0xc7, 0xd2, 0xd8, 0x4b, 0xff, 0xff, 0x00,
+    0x82, 0x81, 0x83, 0x01, 0x01, 0x34, 0x26, 0x2b, 0xca, 0xb6, 0xc0, 0x7b,
+    0xf3, 0xff, 0x21, 0xf5, 0xff, 0x56, 0x3e, 0x4c, 0xb3, 0x06, 0x06, 0xdd,
+    0xce, 0xce, 0x5a, 0xfe, 0xff, 0x00, 0x83, 0x83, 0x81, 0x00, 0x00, 0x3f,
+    0x2e, 0x2e, 0xc7, 0xbd, 0xbe, 0x80, 0xff, 0xff, 0x14, 0xfc, 0xfd, 0x29,
+    0xab, 0xb8, 0x9d, 0x0d, 0x2a, 0xc4, 0x02, 0x05, 0x74, 0x00, 0x00, 0xe0,
+    0xcc, 0xc9, 0x64, 0x89, 0x89, 0x81, 0x0f, 0x0e, 0xbc, 0xc7, 0xc7, 0x7c,
+    0xff, 0xff, 0x15, 0xff, 0xff, 0x26, 0xb3, 0xb7, 0xa3, 0x09, 0x34, 0xf6,
+    0x00, 0x09, 0x62, 0x00, 0x00, 0xdd, 0xc2, 0xc0, 0x65, 0xff, 0xfe, 0x00,
+    0xb4, 0xb3, 0x67, 0xb5, 0xb3, 0x8e, 0xff, 0xff, 0x13, 0xff, 0xfc, 0x27,
+    0xb1, 0xb5, 0xa4, 0x09, 0x2d, 0xf2, 0x00, 0x0b, 0x5c, 0x01, 0x00, 0x00,
+    0xac, 0xaa, 0x76, 0xff, 0xf9, 0x1b, 0xff, 0xfc, 0x1e, 0xfc, 0xf9, 0x0c,
+    0xd9, 0xd9, 0x88, 0x06, 0x10, 0xce, 0x00, 0x03, 0x58, 0x03, 0x00, 0x00,
+    0x9c, 0x9a, 0x8a, 0xff, 0xfa, 0x07, 0xf9, 0xed, 0x38, 0xf9, 0xec, 0x29,
+    0xfc, 0xe9, 0x00, 0xfa, 0xf6, 0x30, 0x6d, 0x69, 0x88, 0x85, 0x81, 0x96,
+    0xff, 0xf7, 0x0b, 0xe1, 0xd6, 0x5b, 0x9c, 0x9d, 0xa2, 0xff, 0xec, 0x13,
+    0xfc, 0xde, 0x00, 0xff, 0xf3, 0x2f, 0x7d, 0x76, 0xaa, 0x66, 0x63, 0xa8,
+    0xfd, 0xe8, 0x14, 0xf4, 0xd7, 0x41, 0x1e, 0x25, 0xdf, 0x98, 0x92, 0x9b,
+    0xff, 0xdf, 0x12, 0xf9, 0xc7, 0x00, 0xf8, 0xdd, 0x2d, 0x76, 0x6a, 0x9a,
+    0x53, 0x55, 0xbc, 0xff, 0xd2, 0x11, 0xff, 0xdb, 0x28, 0x2f, 0x31, 0xa7,
+    0x00, 0x03, 0xbb, 0xa3, 0x97, 0xa3, 0xff, 0xcb, 0x13, 0xfd, 0xb8, 0x00,
+    0xff, 0xd1, 0x3f, 0x39, 0x39, 0xc5, 0x46, 0x44, 0xbd, 0xe8, 0xcd, 0x5b,
+    0xdb, 0xcb, 0x69, 0x42, 0x43, 0x9d, 0x00, 0x00, 0x19, 0x04, 0x0e, 0xc0,
+    0xa2, 0x8b, 0xa1, 0xff, 0xcb, 0x1d, 0x9b, 0x8a, 0x9b, 0x13, 0x40, 0xf8,
+    0x03, 0x06, 0x5f, 0x07, 0x06, 0xd5, 0x21, 0x58, 0xff, 0x18, 0x68, 0xff,
+    0x10, 0x2b, 0xff, 0x00, 0x00, 0x13, 0x09, 0x12, 0xb4, 0x6a, 0x69, 0xc7,
+    0x1b, 0x46, 0xff, 0x01, 0x0b, 0x59, 0x0e, 0x13, 0xd9, 0x11, 0x38, 0xce,
+    0x0e, 0x3b, 0xb5, 0x0a, 0x16, 0x89, 0x00, 0x00, 0x10, 0x00, 0x14, 0xc0,
+    0x04, 0x0e, 0x62, 0x14, 0x14, 0x00, 0x05, 0x02, 0x0b, 0x0a, 0x0f, 0xba,
+    0x21, 0x21, 0xd3, 0x36, 0x2a, 0xbf, 0x0f, 0x0e, 0xc9, 0x31, 0x39, 0xa8,
+    0xac, 0xdf, 0x5e, 0xc7, 0xeb, 0x45, 0x41, 0x46, 0x8f, 0x31, 0x34, 0xac,
+    0xb6, 0xed, 0x2c, 0xcf, 0xff, 0x00, 0x61, 0x67, 0x8e, 0x1e, 0x1e, 0xb5,
+    0xcf, 0xd7, 0x47, 0xfe, 0xfe, 0x07, 0x7f, 0x7e, 0x95, 0x00, 0x00, 0x4a,
+    0x15, 0x10, 0xbf, 0xc3, 0xc4, 0x54, 0xff, 0xff, 0x02, 0x9a, 0x97, 0x94,
+    0x00, 0x00, 0x44, 0xb3, 0xb1, 0x61, 0xfe, 0xff, 0x00, 0xab, 0xaa, 0x8a,
+    0x00, 0x00, 0x55, 0xa7, 0xa7, 0x75, 0xff, 0xff, 0x00, 0xb9, 0xb8, 0x7e,
+    0x00, 0x00, 0x5c, 0x9b, 0x9c, 0x89, 0xff, 0xfe, 0x00, 0xc9, 0xc6, 0x6b,
+    0x01, 0x01, 0x6b, 0x8a, 0x89, 0x94, 0xdb, 0xd7, 0x57, 0x1b, 0x1a, 0x77,
+    0x78, 0x75, 0x9c, 0xfe, 0xfe, 0x01, 0xe9, 0xda, 0x43, 0x22, 0x22, 0xa6,
+    0x60, 0x5a, 0xa8, 0xff, 0xe6, 0x07, 0xf6, 0xc2, 0x28, 0x95, 0x88, 0x9a,
+    0x79, 0x68, 0x8e, 0x94, 0x7d, 0x79, 0xa3, 0x92, 0x78, 0x58, 0x4f, 0xa6,
+    0x00, 0x00, 0x49, 0x4e, 0x45, 0xaf, 0xfd, 0xc8, 0x11, 0xfd, 0xa0, 0x09,
+    0xff, 0xb9, 0x09, 0xff, 0xb9, 0x00, 0xff, 0xa8, 0x00, 0xff, 0xc3, 0x07,
+    0x93, 0x86, 0x9c, 0x00, 0x00, 0x3d, 0x53, 0x47, 0xac, 0xf5, 0xaf, 0x24,
+    0xff, 0x93, 0x00, 0xff, 0x92, 0x00, 0xff, 0x93, 0x01, 0xff, 0xb5, 0x06,
+    0xa5, 0x87, 0x8b, 0x00, 0x00, 0x48, 0x33, 0x23, 0xb7, 0xe3, 0x9d, 0x4d,
+    0xdf, 0x96, 0x52, 0xc4, 0x92, 0x6f, 0xa6, 0x8c, 0x8b, 0x8b, 0x85, 0xa4,
+    0x6e, 0x86, 0xbd, 0x35, 0x48, 0xdd, 0x0d, 0x0c, 0xd1, 0x4a, 0x56, 0xd4,
+    0x3e, 0x73, 0xf2, 0x26, 0x70, 0xff, 0x12, 0x63, 0xff, 0x0b, 0x56, 0xff,
+    0x0a, 0x4a, 0xf4, 0x06, 0x2b, 0xf1, 0x01, 0x02, 0x47, 0x06, 0x16, 0xca,
+    0x07, 0x2a, 0x8c, 0x0d, 0x35, 0x89, 0x0d, 0x2e, 0x7b, 0x0b, 0x19, 0x5c,
+    0x08, 0x09, 0x3d, 0x07, 0x05, 0x2a, 0x04, 0x03, 0x1c, 0x02, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x0e, 0x0a, 0xca, 0x00, 0x00, 0xd5, 0x1a, 0x2b, 0xba,
+    0x04, 0x0a, 0xc8, 0x08, 0x0a, 0xd3, 0x8a, 0x9c, 0x9c, 0x26, 0x2b, 0xc6,
+    0x1c, 0x31, 0xb8, 0xb0, 0xda, 0x78, 0x15, 0x10, 0xd6, 0x2e, 0x38, 0xb4,
+    0xe8, 0xff, 0x58, 0x78, 0x89, 0xa6, 0x00, 0x00, 0xe4, 0x04, 0x01, 0xdb,
+    0x8e, 0xbb, 0x64, 0xe0, 0xff, 0x4d, 0x3d, 0x3b, 0xc1, 0x76, 0x7a, 0xa3,
+    0xee, 0xfe, 0x14, 0xd6, 0xe8, 0x47, 0x27, 0x27, 0xd0, 0x5f, 0x5e, 0xa3,
+    0xe6, 0xff, 0x15, 0xe5, 0xfd, 0x20, 0x66, 0x6c, 0xb1, 0x16, 0x18, 0xcd,
+    0xec, 0xee, 0x5a, 0xfc, 0xfe, 0x00, 0xff, 0xff, 0x00, 0x9e, 0x9f, 0x91,
+    0x04, 0x04, 0xdd, 0x1c, 0x1f, 0xd2, 0xde, 0xe8, 0x3f, 0xf9, 0xfa, 0x00,
+    0xff, 0xff, 0x01, 0x90, 0x90, 0xa4, 0x00, 0x00, 0xe1, 0x65, 0x66, 0xac,
+    0xff, 0xff, 0x2e, 0xfc, 0xfc, 0x14, 0xeb, 0xec, 0x3a, 0xfe, 0xfd, 0x49,
+    0x50, 0x4f, 0xb4, 0x00, 0x00, 0xea, 0xab, 0xae, 0x6e, 0xff, 0xff, 0x1c,
+    0xf9, 0xfb, 0x2a, 0xfe, 0xfe, 0x00, 0xb0, 0xb0, 0x8f, 0x04, 0x04, 0xde,
+    0x09, 0x07, 0xd9, 0xa3, 0xa3, 0x92, 0xfe, 0xfe, 0x05, 0xff, 0xff, 0x1e,
+    0x78, 0x77, 0xa8, 0xda, 0xdb, 0x61, 0xc4, 0xc4, 0x71, 0x45, 0x45, 0xcf,
+    0xff, 0xff, 0x15, 0xd7, 0xd8, 0x7f, 0xeb, 0xea, 0x4c, 0xdd, 0xdd, 0x67,
+    0x19, 0x19, 0xd7, 0x22, 0x26, 0xbf, 0xeb, 0xeb, 0x55, 0xfe, 0xfb, 0x00,
+    0xfb, 0xf7, 0x34, 0x2e, 0x2c, 0xb5, 0x47, 0x4a, 0xcc, 0xff, 0xff, 0x4e,
+    0xe3, 0xde, 0x2b, 0xf7, 0xf7, 0x62, 0x41, 0x45, 0xe2, 0xd4, 0xd0, 0x4a,
+    0xff, 0xfe, 0x00, 0xff, 0xff, 0x3f, 0x22, 0x22, 0xd8, 0x61, 0x60, 0xb4,
+    0xff, 0xff, 0x28, 0xff, 0xeb, 0x00, 0xe3, 0xd8, 0x5b, 0x05, 0x06, 0x92,
+    0x00, 0x00, 0xab, 0xaf, 0xac, 0xa3, 0x74, 0x78, 0xc8, 0x00, 0x02, 0xf2,
+    0xd4, 0xc9, 0x57, 0xff, 0xef, 0x00, 0xfe, 0xf8, 0x2a, 0x47, 0x48, 0xcf,
+    0x0a, 0x0c, 0xd8, 0xbe, 0xb3, 0x7f, 0xfd, 0xd9, 0x07, 0xff, 0xd1, 0x05,
+    0xc6, 0xae, 0x6b, 0x01, 0x01, 0x50, 0x00, 0x00, 0x15, 0x3d, 0x3c, 0xca,
+    0x9a, 0xa5, 0xc6, 0x0e, 0x1f, 0xd3, 0x01, 0x03, 0xa2, 0xb5, 0xa6, 0x7e,
+    0xff, 0xd5, 0x02, 0xfe, 0xdf, 0x1e, 0x81, 0x7b, 0xa9, 0x00, 0x00, 0xe2,
+    0x15, 0x11, 0xd6, 0xd8, 0xb9, 0x69, 0xff, 0xc7, 0x1e, 0xfd, 0xb8, 0x08,
+    0x9d, 0x8a, 0x82, 0x00, 0x00, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x04, 0x7f,
+    0x0c, 0x2e, 0xf2, 0x04, 0x04, 0x25, 0x00, 0x00, 0x71, 0x98, 0x8b, 0xa0,
+    0xfe, 0xc4, 0x04, 0xfc, 0xc5, 0x0b, 0xbb, 0xad, 0x89, 0x00, 0x00, 0xe0,
+    0x0f, 0x0c, 0x97, 0x67, 0x62, 0xcc, 0xf4, 0xc9, 0x56, 0xff, 0xd0, 0x28,
+    0x71, 0x64, 0x99, 0x00, 0x00, 0x24, 0x03, 0x03, 0x1e, 0x04, 0x04, 0x5c,
+    0x03, 0x02, 0x00, 0x00, 0x00, 0x7f, 0x77, 0x6a, 0xab, 0xff, 0xc8, 0x1b,
+    0xff, 0xd9, 0x2e, 0x98, 0x84, 0xa1, 0x00, 0x00, 0xbe, 0x08, 0x22, 0xb3,
+    0x58, 0x6c, 0xe9, 0xf4, 0xd5, 0x66, 0x55, 0x48, 0xa7, 0x00, 0x00, 0x09,
+    0x61, 0x56, 0xa8, 0xf9, 0xd4, 0x57, 0xa2, 0x88, 0x90, 0x3c, 0x60, 0xf6,
+    0x00, 0x06, 0x7e, 0x00, 0x1a, 0x96, 0x44, 0x57, 0xe4, 0x22, 0x1e, 0xbc,
+    0x00, 0x00, 0x04, 0x30, 0x24, 0xc2, 0x73, 0x5e, 0xb9, 0x28, 0x4c, 0xff,
+    0x0d, 0x26, 0x9b, 0x01, 0x18, 0x72, 0x04, 0x12, 0x81, 0x00, 0x00, 0x05,
+    0x04, 0x0b, 0xeb, 0x18, 0x2e, 0xc5, 0x05, 0x08, 0x58, 0x02, 0x04, 0x00,
+    0x04, 0x04, 0x56, 0x03, 0x00, 0x12, 0x38, 0x37, 0xa6, 0x39, 0x3b, 0x94,
+    0x4e, 0x51, 0x95, 0x96, 0xb1, 0x6a, 0xc9, 0xed, 0x45, 0x5f, 0x64, 0x5d,
+    0x94, 0xa5, 0x7a, 0x92, 0xb3, 0x6f, 0xa0, 0xbe, 0x50, 0xea, 0xff, 0x16,
+    0x6c, 0x75, 0x47, 0x84, 0x92, 0x7e, 0xe1, 0xff, 0x20, 0x8c, 0xa1, 0x6f,
+    0xb0, 0xbb, 0x48, 0xfe, 0xfe, 0x06, 0x92, 0x95, 0x46, 0x8e, 0x93, 0x79,
+    0xf3, 0xfd, 0x00, 0xf3, 0xff, 0x19, 0x9b, 0xa0, 0x72, 0xbb, 0xbc, 0x54,
+    0xfe, 0xff, 0x00, 0xaf, 0xae, 0x59, 0x97, 0x95, 0x78, 0xff, 0xff, 0x01,
+    0xf6, 0xf9, 0x00, 0xff, 0xff, 0x20, 0x90, 0x8f, 0x70, 0xbc, 0xba, 0x57,
+    0xcc, 0xca, 0x5c, 0x15, 0x12, 0x3f, 0xf6, 0xf5, 0x28, 0xfc, 0xfc, 0x4b,
+    0xff, 0xff, 0x29, 0x91, 0x90, 0x6d, 0x0a, 0x05, 0xb9, 0xc2, 0xc1, 0x51,
+    0xfe, 0xfe, 0x00, 0xde, 0xdc, 0x4f, 0x26, 0x24, 0x34, 0x96, 0x94, 0x78,
+    0xdc, 0xdc, 0x56, 0x5e, 0x5d, 0xb4, 0xf8, 0xf8, 0x57, 0xff, 0xff, 0x21,
+    0x78, 0x76, 0x6a, 0xc3, 0xc3, 0x4e, 0xec, 0xeb, 0x43, 0x3d, 0x3a, 0x57,
+    0xff, 0xfe, 0x00, 0xe9, 0xe7, 0x51, 0x00, 0x00, 0xb9, 0x57, 0x5b, 0xd1,
+    0xfe, 0xfc, 0x56, 0xfa, 0xfa, 0x23, 0xef, 0xef, 0x32, 0xff, 0xfd, 0x01,
+    0xf8, 0xf1, 0x33, 0x4b, 0x49, 0x67, 0x96, 0x91, 0x79, 0xe6, 0xdd, 0x62,
+    0x13, 0x12, 0x4e, 0x00, 0x00, 0x74, 0x56, 0x58, 0xe4, 0xfc, 0xf2, 0x34,
+    0xff, 0xec, 0x0a, 0xfc, 0xe3, 0x04, 0xff, 0xf3, 0x23, 0x53, 0x4f, 0x76,
+    0x96, 0x86, 0x78, 0xff, 0xdf, 0x00, 0xe6, 0xcd, 0x63, 0x0e, 0x0e, 0x5e,
+    0x06, 0x05, 0x00, 0x00, 0x07, 0xa6, 0x5f, 0x5d, 0xd7, 0xfb, 0xe9, 0x28,
+    0xfa, 0xc5, 0x00, 0xfd, 0xe3, 0x17, 0x5c, 0x56, 0x68, 0x00, 0x00, 0x03,
+    0x94, 0x7b, 0x79, 0xfc, 0xb6, 0x01, 0xe6, 0xbe, 0x65, 0x12, 0x14, 0x5d,
+    0x0d, 0x0b, 0x06, 0x00, 0x0b, 0xac, 0x65, 0x62, 0xe2, 0xf9, 0xcd, 0x38,
+    0xff, 0xd0, 0x12, 0x75, 0x63, 0x60, 0x00, 0x00, 0x11, 0x9c, 0x79, 0x76,
+    0xff, 0x9d, 0x00, 0xf5, 0xba, 0x5e, 0x17, 0x1a, 0x5c, 0x0b, 0x09, 0x09,
+    0x03, 0x14, 0xb2, 0x5c, 0x59, 0xe3, 0xf0, 0xd3, 0x4e, 0x98, 0x82, 0x5c,
+    0x00, 0x00, 0x3b, 0x7d, 0x6a, 0x8c, 0xcf, 0xb5, 0x69, 0xc0, 0xa4, 0x8d,
+    0x15, 0x15, 0x55, 0x04, 0x06, 0x0e, 0x04, 0x1c, 0xb6, 0x56, 0x5b, 0xf4,
+    0x74, 0x56, 0x83, 0x09, 0x09, 0x3f, 0x0f, 0x31, 0xd5, 0x17, 0x53, 0xff,
+    0x19, 0x45, 0xff, 0x0e, 0x13, 0x5e, 0x04, 0x05, 0x13, 0x0c, 0x28, 0xac,
+    0x16, 0x30, 0xe2, 0x11, 0x09, 0x51, 0x16, 0x23, 0x88, 0x17, 0x24, 0x72,
+    0x18, 0x24, 0x7f, 0x08, 0x0d, 0x3a, 0x07, 0x07, 0x06, 0x0d, 0x17, 0x3f,
+    0x07, 0x04, 0x3a, 0x23, 0x24, 0xf8, 0x2b, 0x30, 0xd7, 0x76, 0x8d, 0x94,
+    0x9d, 0xe2, 0x46, 0xae, 0xdd, 0x60, 0x6a, 0x7c, 0xa1, 0x01, 0x09, 0xca,
+    0x35, 0x38, 0xd4, 0xc5, 0xdd, 0x63, 0xd4, 0xff, 0x12, 0xc8, 0xff, 0x00,
+    0xbf, 0xff, 0x00, 0xd5, 0xff, 0x26, 0x8d, 0xa7, 0x87, 0x06, 0x13, 0xc2,
+    0x34, 0x3f, 0xc6, 0xcb, 0xe8, 0x56, 0xe5, 0xff, 0x04, 0xb9, 0xdc, 0x54,
+    0x5f, 0x83, 0xc0, 0xa5, 0xbe, 0x87, 0xd2, 0xff, 0x06, 0xef, 0xff, 0x24,
+    0x66, 0x75, 0xa5, 0x9a, 0xa1, 0x7f, 0xfb, 0xff, 0x00, 0xdf, 0xe6, 0x3c,
+    0x26, 0x34, 0xeb, 0x00, 0x2c, 0xff, 0x09, 0x15, 0xff, 0xba, 0xbb, 0x71,
+    0xf6, 0xfc, 0x04, 0xd1, 0xda, 0x58, 0x20, 0x25, 0xd6, 0x45, 0x45, 0xbc,
+    0xf7, 0xf6, 0x28, 0xfc, 0xfa, 0x25, 0x55, 0x53, 0xa5, 0x00, 0x00, 0xa8,
+    0x0c, 0x10, 0x54, 0x00, 0x00, 0x91, 0x47, 0x4b, 0xa7, 0xff, 0xff, 0x1d,
+    0xfe, 0xfc, 0x2b, 0x43, 0x43, 0xb1, 0x7b, 0x7c, 0x9b, 0xff, 0xff, 0x00,
+    0xe7, 0xe8, 0x49, 0x0e, 0x0e, 0xb1, 0x01, 0x00, 0x0c, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x01, 0x26, 0x26, 0xa5, 0xfe, 0xfe, 0x27, 0xfe, 0xff, 0x24,
+    0x46, 0x46, 0xa8, 0x00, 0x00, 0x10, 0x84, 0x84, 0x99, 0xfe, 0xfe, 0x00,
+    0xe8, 0xe8, 0x50, 0x11, 0x11, 0x87, 0x36, 0x32, 0xbc, 0xf0, 0xf0, 0x2c,
+    0xfe, 0xfe, 0x23, 0x46, 0x46, 0xac, 0x00, 0x00, 0x11, 0x84, 0x84, 0x97,
+    0xfa, 0xfc, 0x4b, 0x37, 0x38, 0x63, 0x72, 0x72, 0x92, 0xfa, 0xfa, 0x20,
+    0xff, 0xff, 0x1c, 0x44, 0x44, 0xa5, 0x00, 0x00, 0x12, 0x7f, 0x80, 0x96,
+    0xff, 0xfb, 0x02, 0xf7, 0xee, 0x19, 0xae, 0xa9, 0x71, 0x2b, 0x23, 0x6f,
+    0x42, 0x35, 0xad, 0xce, 0xc6, 0x53, 0xf9, 0xf2, 0x05, 0xf9, 0xf6, 0x30,
+    0x32, 0x32, 0xaa, 0x00, 0x00, 0x0f, 0x5e, 0x5f, 0xa3, 0xe2, 0xd7, 0x4c,
+    0xf7, 0xc5, 0x05, 0xff, 0xd5, 0x19, 0xd8, 0xb9, 0x57, 0xa4, 0x8d, 0x6d,
+    0xdb, 0xbc, 0x4e, 0xff, 0xcf, 0x18, 0xf7, 0xd2, 0x01, 0xd0, 0xc0, 0x67,
+    0x0c, 0x17, 0x9b, 0x02, 0x02, 0x02, 0x99, 0x8e, 0x85, 0xff, 0xd0, 0x10,
+    0xf2, 0xa7, 0x00, 0xfc, 0xbd, 0x06, 0xff, 0xca, 0x0a, 0xfd, 0xbc, 0x05,
+    0xf1, 0xa7, 0x00, 0xff, 0xd0, 0x0b, 0x70, 0x6c, 0x96, 0x00, 0x00, 0x52,
+    0x06, 0x04, 0x00, 0x24, 0x21, 0xda, 0xdb, 0xb3, 0x5e, 0xff, 0xba, 0x05,
+    0xff, 0xa5, 0x00, 0xff, 0xa7, 0x00, 0xff, 0xa8, 0x00, 0xff, 0xc2, 0x0d,
+    0xbf, 0x9d, 0x83, 0x08, 0x0a, 0xaf, 0x02, 0x01, 0x0e, 0x1a, 0x20, 0x9c,
+    0xa1, 0x9e, 0xb1, 0xd2, 0xb7, 0x6c, 0xcf, 0xab, 0x78, 0xcf, 0xaf, 0x6d,
+    0x66, 0x77, 0xc9, 0x0d, 0x23, 0xdd, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x06,
+    0x00, 0x14, 0x9d, 0x00, 0x46, 0xff, 0x00, 0x5a, 0xff, 0x00, 0x55, 0xff,
+    0x00, 0x34, 0xec, 0x01, 0x06, 0x34, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x02, 0x09, 0x62, 0x04, 0x15, 0x9d, 0x07, 0x15, 0x9b, 0x05, 0x01, 0x3e,
+    0x2d, 0x39, 0xff, 0x9b, 0xaa, 0x84, 0xab, 0xc3, 0x78, 0x8c, 0xaa, 0x86,
+    0x8e, 0xa3, 0x8f, 0x7a, 0x95, 0x8d, 0x67, 0x83, 0x76, 0x1c, 0x34, 0xb4,
+    0x3e, 0x4a, 0xdc, 0xd8, 0xf6, 0x3b, 0xc5, 0xff, 0x00, 0xa4, 0xff, 0x00,
+    0xab, 0xff, 0x00, 0xa7, 0xff, 0x00, 0xae, 0xff, 0x00, 0xb5, 0xe4, 0x3c,
+    0x36, 0x45, 0xb4, 0x3e, 0x40, 0xd5, 0xe6, 0xf5, 0x3f, 0xd7, 0xfd, 0x0b,
+    0xcd, 0xfc, 0x16, 0xd8, 0xff, 0x06, 0xd7, 0xff, 0x0e, 0xc7, 0xfa, 0x15,
+    0xd2, 0xff, 0x00, 0xc5, 0xe1, 0x49, 0x20, 0x29, 0xcc, 0x4b, 0x4b, 0xca,
+    0xfe, 0xff, 0x34, 0xef, 0xfe, 0x05, 0xf0, 0xfd, 0x44, 0xf4, 0xea, 0x27,
+    0xf9, 0xf0, 0x21, 0xfc, 0xff, 0x44, 0xea, 0xfa, 0x17, 0xff, 0xff, 0x0a,
+    0x59, 0x5b, 0x95, 0x54, 0x54, 0xc2, 0xff, 0xfe, 0x2d, 0xff, 0xff, 0x00,
+    0xd2, 0xcc, 0x61, 0x28, 0x44, 0xd8, 0x35, 0x60, 0xd4, 0xa0, 0xa1, 0xa6,
+    0xff, 0xfd, 0x26, 0xfd, 0xfd, 0x03, 0x4a, 0x49, 0x8e, 0x00, 0x00, 0x17,
+    0x54, 0x54, 0xb8, 0xfe, 0xfe, 0x24, 0xfe, 0xfe, 0x00, 0xc3, 0xbd, 0x73,
+    0x00, 0x17, 0xc5, 0x03, 0x2c, 0x9d, 0x2b, 0x2b, 0xc6, 0xfe, 0xfe, 0x1c,
+    0xff, 0xff, 0x14, 0x45, 0x45, 0x96, 0x00, 0x00, 0x14, 0x54, 0x55, 0xab,
+    0xff, 0xfe, 0x16, 0xbf, 0xc2, 0x9b, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x1c,
+    0x5e, 0x5e, 0x9c, 0xfe, 0xff, 0x03, 0xe8, 0xe9, 0x49, 0x1f, 0x20, 0x9d,
+    0x04, 0x04, 0x07, 0x57, 0x54, 0xa1, 0xff, 0xff, 0x12, 0xff, 0xfd, 0x02,
+    0xd8, 0xd6, 0x77, 0x56, 0x54, 0xb8, 0x6a, 0x6b, 0xb6, 0xf9, 0xfa, 0x35,
+    0xff, 0xfc, 0x22, 0x62, 0x67, 0xd3, 0x00, 0x00, 0x6b, 0x1d, 0x25, 0x07,
+    0x6e, 0x65, 0x96, 0xff, 0xf3, 0x10, 0xfc, 0xd8, 0x01, 0xff, 0xf2, 0x0d,
+    0xff, 0xff, 0x02, 0xff, 0xff, 0x13, 0xec, 0xe5, 0x37, 0x64, 0x67, 0xcd,
+    0x01, 0x05, 0xa2, 0x01, 0x04, 0x16, 0x84, 0x86, 0x9a, 0xff, 0xd6, 0x03,
+    0xfd, 0xbf, 0x08, 0xda, 0xcd, 0x64, 0xc0, 0xb4, 0x68, 0x97, 0x8f, 0x95,
+    0x2a, 0x2e, 0xe8, 0x00, 0x00, 0x99, 0x03, 0x03, 0x10, 0x3b, 0x5b, 0xfd,
+    0x90, 0x89, 0x8f, 0xfe, 0xb4, 0x00, 0xfe, 0xc2, 0x0e, 0x80, 0x7a, 0xaf,
+    0x00, 0x0b, 0xfd, 0x00, 0x0d, 0xb8, 0x00, 0x02, 0x51, 0x04, 0x03, 0x00,
+    0x1e, 0x45, 0xff, 0x9d, 0x85, 0x7a, 0xff, 0x8f, 0x00, 0xff, 0xb3, 0x11,
+    0x76, 0x75, 0xb1, 0x00, 0x03, 0x4b, 0x05, 0x08, 0x00, 0x04, 0x27, 0xf9,
+    0xa9, 0x85, 0x74, 0xf8, 0xaf, 0x21, 0xfb, 0xce, 0x34, 0x61, 0x5d, 0x97,
+    0x00, 0x00, 0x1b, 0x1e, 0x1c, 0xd3, 0x17, 0x45, 0xf2, 0x39, 0x86, 0xf7,
+    0x3d, 0x84, 0xfd, 0x12, 0x1a, 0xb1, 0x00, 0x1c, 0xd4, 0x00, 0x40, 0xd2,
+    0x00, 0x3d, 0xd4, 0x00, 0x0d, 0x96, 0x01, 0x00, 0x00, 0x44, 0x65, 0xb1,
+    0x72, 0xb9, 0x6f, 0x7f, 0xc5, 0x62, 0x82, 0xb0, 0x85, 0x43, 0x58, 0xcb,
+    0x08, 0x17, 0xed, 0x85, 0xab, 0x92, 0xa1, 0xfd, 0x34, 0x9e, 0xff, 0x13,
+    0xa5, 0xff, 0x16, 0xa8, 0xff, 0x26, 0xc0, 0xf3, 0x6b, 0x43, 0x52, 0xce,
+    0x79, 0x7c, 0x9f, 0xe3, 0xff, 0x2a, 0xcf, 0xfe, 0x39, 0xb1, 0xd4, 0x9c,
+    0x8b, 0xa7, 0xbe, 0xb5, 0xd9, 0x89, 0xc9, 0xff, 0x34, 0xce, 0xee, 0x6d,
+    0x1d, 0x20, 0xe9, 0x55, 0x56, 0xb9, 0xe8, 0xee, 0x42, 0xf0, 0xfb, 0x2c,
+    0xab, 0xae, 0x9a, 0x2f, 0x73, 0xff, 0x15, 0x73, 0xff, 0x44, 0x55, 0xf5,
+    0xde, 0xe3, 0x52, 0xfc, 0xff, 0x38, 0x7b, 0x7e, 0xba, 0x79, 0x7c, 0xa4,
+    0xff, 0xff, 0x23, 0xd0, 0xca, 0x66, 0x1b, 0x37, 0xfb, 0x1a, 0x55, 0xd3,
+    0x11, 0x1d, 0x72, 0x02, 0x14, 0xed, 0xaf, 0xa3, 0x81, 0xff, 0xfe, 0x1c,
+    0xc2, 0xc3, 0x85, 0x0b, 0x11, 0xe6, 0x85, 0x85, 0xab, 0xfe, 0xfe, 0x19,
+    0xa7, 0xab, 0x87, 0x01, 0x0a, 0xda, 0x06, 0x06, 0x30, 0x03, 0x00, 0x8f,
+    0x93, 0x90, 0xa2, 0xfe, 0xfe, 0x28, 0xd5, 0xd3, 0x6e, 0x2a, 0x30, 0xbe,
+    0x82, 0x82, 0xac, 0xff, 0xfe, 0x12, 0xa4, 0xa7, 0xa3, 0x01, 0x03, 0x83,
+    0x8a, 0x88, 0x95, 0xff, 0xff, 0x25, 0xeb, 0xe9, 0x61, 0x28, 0x29, 0xa4,
+    0x83, 0x84, 0xac, 0xfe, 0xff, 0x14, 0xa6, 0xa9, 0xa1, 0x00, 0x00, 0x84,
+    0x01, 0x01, 0x00, 0x4a, 0x46, 0xc3, 0xad, 0xa8, 0x80, 0xfe, 0xfe, 0x20,
+    0xed, 0xe9, 0x5e, 0x23, 0x25, 0x9b, 0x00, 0x00, 0x0e, 0x83, 0x7f, 0xa6,
+    0xfe, 0xf9, 0x13, 0xd3, 0xcf, 0x7a, 0x14, 0x17, 0x93, 0x00, 0x00, 0x6a,
+    0x90, 0x92, 0xb0, 0xeb, 0xea, 0x58, 0xf6, 0xf4, 0x32, 0xff, 0xff, 0x1b,
+    0xc9, 0xc6, 0x81, 0x01, 0x00, 0x93, 0x02, 0x02, 0x00, 0x6b, 0x5f, 0xbb,
+    0xff, 0xe7, 0x31, 0xff, 0xe5, 0x2f, 0xae, 0xa7, 0x71, 0x04, 0x00, 0xab,
+    0x9d, 0x9a, 0xab, 0xff, 0xff, 0x1c, 0xf8, 0xe3, 0x10, 0xfe, 0xee, 0x1a,
+    0xe8, 0xd7, 0x5a, 0x2d, 0x2b, 0x9d, 0x00, 0x00, 0x28, 0x3e, 0x3a, 0xf9,
+    0xed, 0xc7, 0x75, 0xfc, 0xbd, 0x17, 0xff, 0xd0, 0x38, 0xc4, 0xa2, 0x48,
+    0xda, 0xc3, 0x60, 0xfd, 0xd1, 0x2a, 0xfd, 0xc5, 0x11, 0xfd, 0xc2, 0x10,
+    0xff, 0xe0, 0x27, 0xd7, 0xc5, 0x7b, 0x17, 0x25, 0xfd, 0x00, 0x04, 0x8c,
+    0x7a, 0x6f, 0xcb, 0xff, 0xd7, 0x4e, 0xfe, 0xaa, 0x15, 0xff, 0xb9, 0x1a,
+    0xff, 0xba, 0x16, 0xff, 0xb8, 0x19, 0xff, 0xd1, 0x52, 0xff, 0xc9, 0x43,
+    0xff, 0xd5, 0x2e, 0x9e, 0x8b, 0xaa, 0x25, 0x41, 0xc5, 0x0f, 0x1f, 0xc0,
+    0x7f, 0x9c, 0xe0, 0xed, 0xc6, 0x66, 0xfd, 0xb5, 0x41, 0xfd, 0xbb, 0x47,
+    0xef, 0xc5, 0x65, 0x80, 0x88, 0xd3, 0x65, 0x7e, 0xe4, 0xc5, 0xa4, 0x8c,
+    0x3f, 0x53, 0xef, 0x04, 0x14, 0x61, 0x00, 0x00, 0x13, 0x0e, 0x2a, 0xbd,
+    0x50, 0x8d, 0xff, 0x7b, 0xae, 0xe4, 0x75, 0xaf, 0xea, 0x4b, 0x8a, 0xff,
+    0x1b, 0x48, 0xe3, 0x19, 0x3a, 0xd5, 0x3c, 0x7a, 0xff, 0x1b, 0x3d, 0xbc,
+    0x00, 0x00, 0x02, 0x01, 0x00, 0x40, 0x08, 0x14, 0x87, 0x13, 0x50, 0xd8,
+    0x19, 0x5b, 0xd4, 0x11, 0x2d, 0xb8, 0x05, 0x01, 0x2d, 0x09, 0x0b, 0x13,
+    0x18, 0x30, 0xa8, 0x03, 0x06, 0x37, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0xf7, 0x00, 0x00, 0xcb, 0x21, 0x26, 0xba, 0x65, 0x59, 0x9c,
+    0x7f, 0x85, 0x97, 0x91, 0xa8, 0x8b, 0x9e, 0xba, 0x83, 0x98, 0xc8, 0x61,
+    0x9e, 0xb7, 0x76, 0x68, 0x6d, 0xa7, 0x07, 0x09, 0xce, 0x62, 0x68, 0xac,
+    0xd7, 0xff, 0x2d, 0x91, 0xf9, 0x08, 0x8d, 0xfd, 0x00, 0x80, 0xf7, 0x00,
+    0x75, 0xf1, 0x00, 0xa4, 0xfb, 0x04, 0xea, 0xff, 0x39, 0x83, 0x8d, 0x93,
+    0x00, 0x04, 0xce, 0x44, 0x42, 0xbe, 0xd7, 0xf8, 0x30, 0x89, 0xe8, 0x02,
+    0x9c, 0xec, 0x17, 0xc2, 0xf9, 0x0d, 0xc3, 0xfc, 0x15, 0xc0, 0xf4, 0x02,
+    0xd4, 0xf6, 0x02, 0xfc, 0xff, 0x3a, 0x4d, 0x52, 0xa2, 0x00, 0x00, 0x5d,
+    0x29, 0x27, 0xc6, 0xf0, 0xf4, 0x3c, 0xd3, 0xfb, 0x00, 0xe3, 0xf7, 0x39,
+    0x64, 0x68, 0xce, 0x6a, 0x7e, 0x9c, 0xe5, 0xf3, 0x09, 0xf3, 0xfa, 0x00,
+    0xfd, 0xfc, 0x2a, 0x9a, 0x99, 0x8f, 0x00, 0x00, 0x46, 0x0c, 0x0c, 0xd3,
+    0xdd, 0xde, 0x53, 0xf8, 0xff, 0x00, 0xf7, 0xfa, 0x29, 0x1c, 0x2b, 0xd6,
+    0x00, 0x00, 0xde, 0xac, 0xa8, 0x4f, 0xfe, 0xfd, 0x06, 0xff, 0xff, 0x48,
+    0x68, 0x6a, 0x98, 0x00, 0x00, 0x40, 0x00, 0x00, 0xd5, 0xd1, 0xd1, 0x68,
+    0xff, 0xfe, 0x00, 0xff, 0xff, 0x1e, 0x20, 0x1f, 0xa2, 0x09, 0x06, 0x9c,
+    0xcf, 0xd0, 0x4f, 0xff, 0xff, 0x21, 0xbf, 0xc1, 0x82, 0x0e, 0x19, 0xba,
+    0x00, 0x00, 0x0f, 0x00, 0x00, 0xd4, 0xc1, 0xc1, 0x79, 0xfe, 0xff, 0x00,
+    0xfe, 0xfe, 0x13, 0x76, 0x76, 0xa0, 0xa7, 0xa8, 0x5f, 0xff, 0xff, 0x10,
+    0xcf, 0xd1, 0x6a, 0x22, 0x3a, 0xec, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00,
+    0xa5, 0xa6, 0x8a, 0xfc, 0xfc, 0x12, 0xf9, 0xf9, 0x2a, 0xff, 0xff, 0x11,
+    0xd7, 0xda, 0x46, 0x16, 0x38, 0xee, 0x00, 0x08, 0x72, 0x05, 0x03, 0x00,
+    0x83, 0x83, 0x91, 0xff, 0xff, 0x02, 0xfb, 0xf0, 0x03, 0xff, 0xff, 0x0e,
+    0xfe, 0xf6, 0x00, 0xf0, 0xea, 0x36, 0xab, 0xb1, 0x97, 0x22, 0x1e, 0x83,
+    0x67, 0x67, 0x95, 0xff, 0xf5, 0x11, 0xfd, 0xdf, 0x04, 0xe6, 0xd9, 0x62,
+    0xeb, 0xdd, 0x39, 0xff, 0xe3, 0x00, 0xff, 0xea, 0x1a, 0xe0, 0xde, 0x83,
+    0x57, 0x57, 0xcd, 0x54, 0x59, 0xad, 0xfe, 0xe6, 0x27, 0xfe, 0xce, 0x00,
+    0xb4, 0xa0, 0x72, 0x3e, 0x38, 0xc9, 0xef, 0xd3, 0x40, 0xff, 0xb4, 0x00,
+    0xff, 0xb9, 0x08, 0xe5, 0xcd, 0x5a, 0x71, 0x63, 0xa8, 0x52, 0x55, 0xb6,
+    0xfd, 0xc3, 0x2c, 0xfe, 0xa2, 0x00, 0xcc, 0xaf, 0x4c, 0x00, 0x00, 0xf3,
+    0x3c, 0x43, 0xe2, 0xd9, 0xa3, 0x5e, 0xff, 0xa1, 0x08, 0xf8, 0xce, 0x36,
+    0x79, 0x83, 0xbe, 0x11, 0x35, 0xcc, 0x47, 0x43, 0xb9, 0xff, 0xcf, 0x37,
+    0xff, 0xbd, 0x13, 0xdc, 0xc1, 0x5b, 0x17, 0x10, 0x8c, 0x00, 0x0f, 0xb0,
+    0x2b, 0x4b, 0xfc, 0xaf, 0xa0, 0x96, 0x3c, 0x6a, 0xe6, 0x00, 0x4a, 0xf2,
+    0x0a, 0x16, 0x61, 0x1c, 0x13, 0xc3, 0x70, 0x7b, 0xc4, 0x5b, 0x83, 0xd7,
+    0x38, 0x66, 0xf9, 0x04, 0x0c, 0x84, 0x02, 0x01, 0x09, 0x03, 0x25, 0xac,
+    0x03, 0x50, 0xff, 0x00, 0x36, 0xc5, 0x06, 0x06, 0x2d, 0x00, 0x34, 0xff,
+    0x00, 0x52, 0xfc, 0x00, 0x38, 0xec, 0x00, 0x0b, 0x7b, 0x09, 0x03, 0x18,
+    0x07, 0x15, 0x6b, 0x03, 0x00, 0x18, 0x0c, 0x0a, 0x61, 0x03, 0x00, 0x3a,
+    0x02, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xd5,
+    0x6c, 0x6c, 0xb3, 0x9f, 0xb9, 0x6f, 0x7e, 0xb2, 0x62, 0xa5, 0xcc, 0x50,
+    0x5f, 0x68, 0xa0, 0x02, 0x00, 0xe7, 0x70, 0x7c, 0xb0, 0xca, 0xfc, 0x49,
+    0x9a, 0xff, 0x13, 0x8c, 0xff, 0x00, 0xa9, 0xff, 0x00, 0x9d, 0xa0, 0x8e,
+    0x00, 0x00, 0x73, 0x6c, 0x7b, 0xaa, 0xe8, 0xff, 0x2a, 0xa1, 0xfc, 0x00,
+    0xa6, 0xfb, 0x01, 0xb2, 0xfa, 0x11, 0xd1, 0xff, 0x0e, 0xb6, 0xc1, 0x74,
+    0x07, 0x09, 0xaa, 0x2c, 0x2e, 0xc1, 0xc9, 0xe7, 0x52, 0xc3, 0xfd, 0x0e,
+    0xc2, 0xff, 0x0e, 0xe3, 0xff, 0x27, 0xeb, 0xfe, 0x33, 0xf6, 0xeb, 0x34,
+    0xb0, 0xae, 0x6e, 0x0a, 0x0e, 0x96, 0x65, 0x63, 0xad, 0xea, 0xfc, 0x10,
+    0xdc, 0xfe, 0x06, 0xdf, 0xf4, 0x4f, 0x9a, 0xbc, 0x95, 0x78, 0xb1, 0xb3,
+    0x54, 0xa4, 0xd1, 0x29, 0x6f, 0xf0, 0x01, 0x04, 0x7d, 0x78, 0x78, 0xaa,
+    0xfe, 0xfe, 0x0c, 0xff, 0xfe, 0x00, 0xb7, 0xc2, 0x79, 0x00, 0x3c, 0xff,
+    0x10, 0x76, 0xe0, 0x13, 0x61, 0xc6, 0x09, 0x35, 0xc4, 0x01, 0x01, 0x62,
+    0x48, 0x46, 0xb9, 0xff, 0xff, 0x38, 0xfb, 0xfc, 0x09, 0xee, 0xef, 0x2c,
+    0x6e, 0x6f, 0xab, 0x14, 0x11, 0xbd, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x1a,
+    0x02, 0x01, 0x00, 0x09, 0x11, 0xe3, 0x9d, 0x98, 0x85, 0xff, 0xff, 0x3e,
+    0xff, 0xff, 0x0f, 0xff, 0xff, 0x0d, 0xd5, 0xd5, 0x54, 0x8b, 0x8b, 0x94,
+    0x1c, 0x1c, 0xb6, 0x24, 0x39, 0xcb, 0x8a, 0x9e, 0xa0, 0xd8, 0xd5, 0x6e,
+    0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x09, 0xc2, 0xc3, 0x70,
+    0x1f, 0x21, 0xc0, 0x07, 0x13, 0x6d, 0x12, 0x4a, 0xd5, 0x1e, 0x54, 0xdf,
+    0x73, 0x7a, 0xbb, 0xea, 0xe9, 0x2a, 0xfb, 0xee, 0x00, 0xff, 0xff, 0x0e,
+    0x67, 0x65, 0x9b, 0x00, 0x00, 0x32, 0x00, 0x04, 0xd1, 0xc6, 0xb7, 0x70,
+    0xfe, 0xc4, 0x01, 0xfa, 0xd1, 0x09, 0xa2, 0x93, 0x90, 0x00, 0x00, 0x4e,
+    0x20, 0x1a, 0xd1, 0x3f, 0x43, 0xa4, 0x97, 0x8a, 0x87, 0xfa, 0xbe, 0x1b,
+    0xfd, 0xa2, 0x00, 0xff, 0xde, 0x28, 0x6c, 0x71, 0xd0, 0x00, 0x00, 0x4a,
+    0x7d, 0x72, 0xa4, 0xff, 0xf8, 0x2a, 0xff, 0xd0, 0x1f, 0xff, 0xbd, 0x19,
+    0xff, 0xc9, 0x38, 0xaa, 0x8e, 0x7f, 0x0c, 0x20, 0xd2, 0x01, 0x00, 0x25,
+    0x51, 0x48, 0xb7, 0xa2, 0x9e, 0x7b, 0x8e, 0x81, 0x9a, 0x86, 0x87, 0xac,
+    0x5e, 0x73, 0xc9, 0x0b, 0x37, 0xee, 0x05, 0x08, 0x60, 0x02, 0x02, 0x00,
+    0x09, 0x19, 0xdd, 0x2f, 0x69, 0xff, 0x1c, 0x5f, 0xfd, 0x05, 0x4a, 0xed,
+    0x0e, 0x39, 0xb6, 0x06, 0x0c, 0x5b, 0x00, 0x00, 0x0a, 0x0b, 0x0d, 0x59,
+    0x09, 0x04, 0x39, 0x06, 0x02, 0x29, 0x01, 0x00, 0x12, 0x00, 0x00, 0xf3,
+    0x00, 0x00, 0xe5, 0x1e, 0x25, 0xdf, 0x43, 0x48, 0xd8, 0x4d, 0x49, 0xd0,
+    0x60, 0x59, 0xbd, 0x82, 0x7d, 0x9e, 0x82, 0x80, 0x99, 0x8d, 0x94, 0x8f,
+    0x94, 0xa4, 0x87, 0xa8, 0xc1, 0x75, 0x71, 0x7e, 0x99, 0x51, 0x5b, 0xb5,
+    0xbb, 0xf4, 0x38, 0xa1, 0xff, 0x29, 0xa6, 0xff, 0x1d, 0xa8, 0xff, 0x18,
+    0xad, 0xff, 0x0e, 0xaf, 0xff, 0x01, 0xb3, 0xff, 0x00, 0xbc, 0xff, 0x00,
+    0xc2, 0xe2, 0x46, 0x0a, 0x0a, 0x7b, 0x58, 0x63, 0xac, 0xe0, 0xff, 0x00,
+    0xc0, 0xfe, 0x00, 0xc1, 0xff, 0x16, 0xad, 0xfd, 0x0e, 0xa5, 0xfc, 0x00,
+    0xc2, 0xf7, 0x0e, 0xbe, 0xce, 0x52, 0xb3, 0xba, 0x55, 0x8c, 0x92, 0x99,
+    0x10, 0x13, 0x8b, 0x19, 0x2e, 0xe1, 0x4c, 0x6e, 0xca, 0x42, 0x63, 0xe0,
+    0x5f, 0x5a, 0xca, 0xeb, 0xf1, 0x26, 0xe1, 0xff, 0x01, 0xdd, 0xd9, 0x3e,
+    0x21, 0x2b, 0xfa, 0x11, 0x66, 0xff, 0x09, 0x56, 0xff, 0x00, 0x06, 0xb5,
+    0x00, 0x06, 0xf7, 0x01, 0x3f, 0xff, 0x00, 0x3b, 0xff, 0x1b, 0x23, 0xe0,
+    0xe7, 0xe7, 0x2a, 0xf2, 0xff, 0x00, 0xf1, 0xef, 0x33, 0x25, 0x28, 0xcf,
+    0x06, 0x1d, 0x92, 0x08, 0x15, 0x79, 0x00, 0x01, 0x48, 0x03, 0x00, 0x31,
+    0x00, 0x00, 0x14, 0x10, 0x0d, 0x79, 0xe2, 0xe2, 0x52, 0xfd, 0xfe, 0x00,
+    0xfe, 0xfe, 0x32, 0x31, 0x30, 0x96, 0x02, 0x00, 0x00, 0x00, 0x00, 0xb2,
+    0xca, 0xca, 0x5b, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x23, 0x34, 0x34, 0x96,
+    0xc4, 0xc3, 0x55, 0xfe, 0xff, 0x00, 0xfe, 0xfe, 0x18, 0x38, 0x38, 0x95,
+    0xc5, 0xc1, 0x5a, 0xff, 0xf1, 0x00, 0xff, 0xfe, 0x11, 0x4e, 0x4e, 0x8e,
+    0xc5, 0xbd, 0x59, 0xff, 0xda, 0x00, 0xff, 0xf4, 0x08, 0x66, 0x66, 0x89,
+    0xc5, 0xb7, 0x59, 0xfe, 0xbc, 0x00, 0xfe, 0xdb, 0x01, 0x7e, 0x77, 0x84,
+    0xc1, 0xaf, 0x5b, 0xfa, 0xa2, 0x01, 0xfb, 0xc3, 0x02, 0xa0, 0x91, 0x8b,
+    0x00, 0x00, 0x4a, 0xd4, 0xc0, 0x52, 0xff, 0xad, 0x00, 0xff, 0xcc, 0x00,
+    0xbc, 0xa5, 0x86, 0x00, 0x00, 0x58, 0x76, 0x75, 0x96, 0x98, 0x98, 0x9c,
+    0x8e, 0x9c, 0xa0, 0x62, 0x6e, 0xc8, 0x00, 0x00, 0x5a, 0x00, 0x17, 0xff,
+    0x00, 0x45, 0xff, 0x00, 0x44, 0xff, 0x00, 0x2f, 0xff, 0x00, 0x00, 0x6b,
+    0x06, 0x07, 0x71, 0x05, 0x04, 0x5e, 0x05, 0x02, 0x4e, 0x03, 0x01, 0x45,
+    0x00, 0x02, 0x1d, 0x0f, 0x13, 0xeb, 0x9c, 0xa9, 0x84, 0xc3, 0xcf, 0x5b,
+    0x71, 0x7a, 0xa9, 0x10, 0x12, 0xa4, 0x83, 0x99, 0xb5, 0x87, 0x95, 0xa9,
+    0x2e, 0x31, 0xb2, 0x31, 0x2d, 0xdd, 0xbe, 0xdc, 0x46, 0xd0, 0xff, 0x00,
+    0x88, 0x96, 0x99, 0x24, 0x26, 0xb2, 0xc8, 0xff, 0x35, 0xd0, 0xff, 0x04,
+    0x59, 0x5e, 0x98, 0x00, 0x00, 0x18, 0x45, 0x41, 0xcd, 0xce, 0xda, 0x46,
+    0xef, 0xfc, 0x02, 0x7c, 0x7e, 0x9f, 0x32, 0x31, 0xb7, 0xdb, 0xfc, 0x1f,
+    0xd7, 0xfc, 0x13, 0x47, 0x49, 0xac, 0x00, 0x00, 0x16, 0x49, 0x49, 0xca,
+    0xf4, 0xf4, 0x24, 0xff, 0xff, 0x00, 0x85, 0x85, 0x77, 0x43, 0x45, 0xb7,
+    0xfe, 0xff, 0x0c, 0xfb, 0xff, 0x26, 0x3d, 0x3c, 0xac, 0x00, 0x00, 0x0f,
+    0x60, 0x61, 0xb8, 0xfd, 0xfd, 0x15, 0xfe, 0xff, 0x00, 0x84, 0x85, 0x7b,
+    0x59, 0x5a, 0xb5, 0xfe, 0xfe, 0x00, 0xf9, 0xfa, 0x39, 0x30, 0x30, 0xa1,
+    0x00, 0x00, 0x04, 0x6d, 0x6d, 0xac, 0xff, 0xfe, 0x0d, 0xff, 0xfe, 0x00,
+    0x85, 0x85, 0x7a, 0x74, 0x72, 0xaa, 0xed, 0xed, 0x4b, 0x25, 0x25, 0x93,
+    0x73, 0x74, 0xa4, 0xfe, 0xff, 0x07, 0x90, 0x8d, 0x99, 0xdd, 0xdd, 0x5f,
+    0x17, 0x17, 0x83, 0x02, 0x04, 0x00, 0x75, 0x74, 0xa8, 0xfe, 0xf9, 0x04,
+    0xff, 0xf8, 0x04, 0x87, 0x7a, 0x89, 0x00, 0x02, 0xf8, 0xb2, 0xa6, 0x80,
+    0xcd, 0xce, 0x77, 0x07, 0x07, 0x6d, 0x09, 0x0b, 0x00, 0x76, 0x6b, 0xa6,
+    0xff, 0xea, 0x08, 0xfe, 0xd9, 0x00, 0xd6, 0xbc, 0x57, 0x51, 0x40, 0xbf,
+    0x27, 0x1c, 0xca, 0x7c, 0x77, 0xa3, 0xf4, 0xd9, 0x22, 0xfe, 0xf0, 0x00,
+    0xbf, 0xbb, 0x7d, 0x00, 0x00, 0x5e, 0x36, 0x3e, 0xcb, 0xf9, 0xdd, 0x35,
+    0xfd, 0xc5, 0x01, 0xff, 0xd1, 0x07, 0xe8, 0xc2, 0x3f, 0xe0, 0xba, 0x48,
+    0xff, 0xd9, 0x13, 0xfe, 0xc6, 0x01, 0xff, 0xe3, 0x0b, 0x91, 0x84, 0xa2,
+    0x00, 0x00, 0x62, 0x00, 0x0f, 0x89, 0xce, 0xb9, 0x6a, 0xff, 0xcd, 0x00,
+    0xf8, 0xaf, 0x02, 0xff, 0xbd, 0x00, 0xff, 0xc1, 0x00, 0xfa, 0xb3, 0x01,
+    0xfb, 0xbe, 0x04, 0xfa, 0xd4, 0x35, 0x47, 0x36, 0xd2, 0x00, 0x00, 0x4d,
+    0x00, 0x05, 0x49, 0x45, 0x61, 0xcd, 0xe7, 0xca, 0x34, 0xff, 0xc0, 0x00,
+    0xff, 0xae, 0x00, 0xfe, 0xac, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xd5, 0x19,
+    0x9d, 0x89, 0xa5, 0x04, 0x03, 0x9e, 0x00, 0x00, 0x0c, 0x05, 0x24, 0x8c,
+    0x39, 0x5f, 0xee, 0xb7, 0xa1, 0x7b, 0xe5, 0xad, 0x4c, 0xf7, 0xae, 0x30,
+    0xd1, 0xa1, 0x59, 0x74, 0x82, 0xb9, 0x13, 0x2d, 0xcb, 0x00, 0x00, 0x1e,
+    0x01, 0x01, 0x03, 0x02, 0x2d, 0x8a, 0x03, 0x62, 0xff, 0x1c, 0x6d, 0xfa,
+    0x27, 0x69, 0xf0, 0x13, 0x63, 0xff, 0x00, 0x3c, 0xce, 0x00, 0x04, 0x1b,
+    0x03, 0x22, 0x74, 0x00, 0x39, 0xd9, 0x00, 0x41, 0xda, 0x02, 0x32, 0x97,
+    0x03, 0x04, 0x1f, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x06, 0x00,
+    0x61, 0x6e, 0xc0, 0xa6, 0xb1, 0xae, 0x00, 0x00, 0xfb, 0x37, 0x3b, 0xed,
+    0x77, 0x88, 0xb4, 0x0e, 0x21, 0xeb, 0x5d, 0x5e, 0xd9, 0xff, 0xff, 0x56,
+    0xd4, 0xf5, 0x63, 0x31, 0x33, 0xe7, 0x5e, 0x71, 0xcc, 0xd8, 0xff, 0x45,
+    0xb0, 0xcc, 0x91, 0x3e, 0x41, 0xe3, 0x6d, 0x6d, 0xe1, 0xfe, 0xfe, 0x52,
+    0xf9, 0xfe, 0x0d, 0x69, 0x6e, 0xcf, 0x27, 0x23, 0xeb, 0xac, 0xd0, 0x87,
+    0xb1, 0xfb, 0x04, 0xc5, 0xe4, 0x90, 0x21, 0x25, 0xe7, 0x0c, 0x0c, 0xff,
+    0xd3, 0xd4, 0x9c, 0xff, 0xfe, 0x02, 0xb6, 0xb5, 0x74, 0x15, 0x13, 0xf7,
+    0x53, 0x51, 0xdc, 0xf1, 0xfc, 0x30, 0xe9, 0xff, 0x0d, 0x70, 0x7c, 0xd8,
+    0x00, 0x00, 0xb3, 0x03, 0x03, 0x00, 0x00, 0x00, 0xfd, 0x79, 0x77, 0xe7,
+    0xff, 0xff, 0x0e, 0xf6, 0xf5, 0x35, 0x40, 0x40, 0xd2, 0x00, 0x00, 0xff,
+    0xc5, 0xc5, 0x81, 0xff, 0xfe, 0x00, 0xfb, 0xf7, 0x53, 0x26, 0x28, 0xff,
+    0x00, 0x00, 0x52, 0x04, 0x04, 0x00, 0x3c, 0x3c, 0xfd, 0xf6, 0xf6, 0x60,
+    0xff, 0xff, 0x05, 0x88, 0x88, 0x9a, 0x43, 0x43, 0xd1, 0xff, 0xff, 0x30,
+    0xfe, 0xff, 0x00, 0xa9, 0xae, 0xc7, 0x00, 0x00, 0xcf, 0x01, 0x01, 0x0c,
+    0x06, 0x06, 0xff, 0xbd, 0xbc, 0xb5, 0xfd, 0xfd, 0x00, 0xdc, 0xdc, 0x63,
+    0xd5, 0xd5, 0x81, 0xfd, 0xfd, 0x01, 0xf8, 0xf9, 0x42, 0x3b, 0x40, 0xff,
+    0x00, 0x00, 0x58, 0x06, 0x06, 0x00, 0x5c, 0x5c, 0xf9, 0xff, 0xff, 0x33,
+    0xfd, 0xfd, 0x1c, 0xfc, 0xfc, 0x26, 0xff, 0xff, 0x04, 0xb0, 0xb4, 0xc3,
+    0x01, 0x01, 0x05, 0x0f, 0x0e, 0xff, 0xeb, 0xeb, 0x8c, 0xfe, 0xf9, 0x00,
+    0xfb, 0xf6, 0x00, 0xfb, 0xfc, 0x3f, 0x39, 0x3b, 0xff, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0xfe, 0x8a, 0x85, 0xd5, 0xff, 0xed, 0x16, 0xff, 0xd9, 0x00,
+    0xb8, 0xb5, 0xb5, 0x02, 0x04, 0xdd, 0x02, 0x01, 0x0c, 0x37, 0x39, 0xfd,
+    0xfc, 0xd4, 0x54, 0xfc, 0xbd, 0x34, 0x34, 0x40, 0xff, 0x00, 0x00, 0x5b,
+    0x00, 0x02, 0xff, 0xc2, 0xa5, 0xac, 0xa4, 0x9b, 0xc9, 0x00, 0x04, 0xe0,
+    0x02, 0x00, 0x09, 0x24, 0x22, 0xf6, 0x27, 0x3c, 0xf9, 0x00, 0x00, 0x5c,
+    0x02, 0x01, 0x00, 0x00, 0x0e, 0xff, 0x00, 0x1d, 0xe0, 0x00, 0x01, 0x03,
+    0x01, 0x08, 0xf5, 0x01, 0x05, 0x58, 0x00, 0x00, 0x01, 0x0b, 0x0f, 0xd2,
+    0x75, 0x82, 0xa9, 0x75, 0x79, 0xb3, 0x00, 0x00, 0xdb, 0x6b, 0x6b, 0xb3,
+    0x64, 0x64, 0xbc, 0x27, 0x27, 0xcd, 0xbc, 0xc5, 0x8d, 0xeb, 0xff, 0x44,
+    0xb3, 0xbb, 0xa6, 0x02, 0x01, 0xb0, 0x02, 0x00, 0xdc, 0xc0, 0xc6, 0x8a,
+    0xdb, 0xf6, 0x60, 0x9a, 0xa5, 0x9d, 0x1a, 0x1a, 0xdb, 0x47, 0x46, 0xbe,
+    0xf4, 0xf7, 0x6d, 0xd9, 0xeb, 0x2f, 0xd2, 0xd2, 0x9a, 0x0f, 0x0e, 0xb3,
+    0x00, 0x00, 0xd6, 0x04, 0x00, 0xe0, 0xb6, 0xbc, 0x86, 0xcc, 0xf2, 0x39,
+    0xe6, 0xf3, 0x6e, 0x31, 0x30, 0xb8, 0x28, 0x2d, 0xc9, 0xcb, 0xcb, 0x80,
+    0xfa, 0xf7, 0x24, 0xe4, 0xe2, 0x8e, 0x25, 0x25, 0xac, 0x00, 0x00, 0x3f,
+    0x31, 0x31, 0xd9, 0x3e, 0x3e, 0xbe, 0x02, 0x00, 0xdf, 0xbf, 0xc2, 0x87,
+    0xe3, 0xf3, 0x2d, 0xdc, 0xe3, 0x55, 0x1a, 0x18, 0x89, 0xb8, 0xb6, 0x90,
+    0xff, 0xfc, 0x1e, 0xf7, 0xf3, 0x78, 0x30, 0x2f, 0xb3, 0x0a, 0x0a, 0xaa,
+    0xd1, 0xcb, 0x81, 0xec, 0xeb, 0x64, 0x3c, 0x39, 0xc7, 0x08, 0x06, 0xe1,
+    0xc1, 0xbe, 0x87, 0xfa, 0xfd, 0x1f, 0xc1, 0xc4, 0x70, 0x0d, 0x0d, 0x95,
+    0xa7, 0xa5, 0x9e, 0xfe, 0xff, 0x28, 0xff, 0xfd, 0x5e, 0x3a, 0x3a, 0xcd,
+    0x92, 0x90, 0x9b, 0xff, 0xff, 0x25, 0xff, 0xf7, 0x1d, 0xd1, 0xce, 0x72,
+    0x2f, 0x2d, 0xcc, 0x00, 0x00, 0xe9, 0xd1, 0xcb, 0x75, 0xff, 0xff, 0x0e,
+    0xa4, 0xa0, 0x83, 0x02, 0x06, 0x74, 0x94, 0x93, 0xac, 0xff, 0xff, 0x31,
+    0xf7, 0xf3, 0x54, 0xbf, 0xbf, 0xa3, 0xff, 0xfa, 0x3b, 0xe8, 0xe3, 0x72,
+    0xf9, 0xf0, 0x4c, 0xff, 0xff, 0x19, 0xb6, 0xb1, 0x8b, 0x17, 0x18, 0xda,
+    0xe4, 0xde, 0x5e, 0xfe, 0xff, 0x08, 0x81, 0x7d, 0xa5, 0x00, 0x01, 0x3c,
+    0x9c, 0x9a, 0xaf, 0xfc, 0xf2, 0x41, 0xf9, 0xea, 0x31, 0xff, 0xfa, 0x54,
+    0xfa, 0xf8, 0x59, 0x5e, 0x70, 0xf0, 0x8c, 0x99, 0xd7, 0xff, 0xfc, 0x38,
+    0xff, 0xf7, 0x1b, 0xae, 0xac, 0xab, 0xea, 0xe0, 0x53, 0xff, 0xfd, 0x0b,
+    0x66, 0x62, 0xb1, 0x00, 0x00, 0x28, 0x4c, 0x4e, 0xc9, 0xf6, 0xe4, 0x59,
+    0xff, 0xd5, 0x0f, 0xff, 0xe8, 0x2f, 0xb0, 0xb4, 0xb9, 0x23, 0x31, 0xcd,
+    0x27, 0x35, 0xe3, 0xb6, 0xbb, 0xc6, 0xff, 0xf8, 0x24, 0xff, 0xed, 0x3a,
+    0xff, 0xec, 0x30, 0xfc, 0xed, 0x23, 0x3d, 0x3c, 0x95, 0x00, 0x00, 0x1c,
+    0x2a, 0x2c, 0xd1, 0xef, 0xd7, 0x6f, 0xfe, 0xc5, 0x0d, 0xec, 0xd7, 0x77,
+    0x3d, 0x52, 0xe4, 0x0a, 0x0f, 0x56, 0x13, 0x14, 0x5e, 0x30, 0x3e, 0xf0,
+    0xd2, 0xcf, 0xad, 0xff, 0xe1, 0x15, 0xfe, 0xd1, 0x0b, 0xf1, 0xd1, 0x3e,
+    0x1a, 0x18, 0x81, 0x00, 0x00, 0x08, 0xde, 0xc4, 0x7c, 0xff, 0xcc, 0x35,
+    0x77, 0x7f, 0xd7, 0x09, 0x19, 0x8e, 0x02, 0x03, 0x01, 0x01, 0x02, 0x00,
+    0x09, 0x0d, 0x64, 0x3a, 0x49, 0xec, 0xe1, 0xcd, 0x86, 0xff, 0xc2, 0x08,
+    0xde, 0xa6, 0x5c, 0x00, 0x01, 0x7e, 0xd3, 0xbd, 0x8c, 0xd6, 0xbf, 0x9e,
+    0x22, 0x3c, 0xd9, 0x07, 0x0c, 0x1c, 0x02, 0x02, 0x00, 0x05, 0x0e, 0x67,
+    0x49, 0x5d, 0xdc, 0xf3, 0xcb, 0x5b, 0xcf, 0x97, 0x7c, 0x00, 0x00, 0x63,
+    0xaf, 0x98, 0xae, 0x6d, 0x7b, 0xdc, 0x0a, 0x1c, 0x75, 0x01, 0x00, 0x00,
+    0x10, 0x20, 0x99, 0x69, 0x76, 0xd0, 0xa7, 0x95, 0xaf, 0x04, 0x04, 0x59,
+    0x44, 0x49, 0xf1, 0x24, 0x3f, 0xcd, 0x05, 0x09, 0x18, 0x04, 0x04, 0x1f,
+    0x23, 0x36, 0xbe, 0x32, 0x45, 0xd2, 0x09, 0x0a, 0x4b, 0x22, 0x39, 0xb1,
+    0x13, 0x21, 0x5f, 0x02, 0x03, 0x19, 0x1c, 0x30, 0xa6, 0x04, 0x06, 0x41,
+    0x0a, 0x0e, 0x1e, 0x01, 0x02, 0x06, 0x00, 0x00, 0x01, 0x01, 0x01, 0x21,
+    0x00, 0x00, 0x23, 0x6a, 0x67, 0xd3, 0x9b, 0x9f, 0xa8, 0xe8, 0xff, 0x60,
+    0x95, 0x9a, 0xbb, 0x5f, 0x6e, 0xcb, 0x59, 0x7a, 0xc0, 0x06, 0x0f, 0xff,
+    0xb4, 0xba, 0xa6, 0xe8, 0xfb, 0x3c, 0xe9, 0xfe, 0x5d, 0xaa, 0xa7, 0xbe,
+    0x64, 0x74, 0xc5, 0xa7, 0xf1, 0x61, 0xb8, 0xfe, 0x53, 0x6b, 0x74, 0xc3,
+    0x00, 0x11, 0xb1, 0x1f, 0x55, 0xf9, 0xc1, 0xbf, 0x9d, 0xff, 0xff, 0x36,
+    0xed, 0xed, 0x68, 0x78, 0x77, 0xd5, 0x00, 0x02, 0xff, 0x94, 0x96, 0xa9,
+    0xe2, 0xf5, 0x50, 0xd3, 0xff, 0x31, 0xe2, 0xf5, 0x5d, 0x5a, 0x66, 0xc4,
+    0x00, 0x12, 0x7f, 0x21, 0x56, 0xff, 0xcb, 0xc8, 0x90, 0xff, 0xff, 0x2c,
+    0xe9, 0xe9, 0x72, 0x44, 0x43, 0xea, 0x98, 0x96, 0x9d, 0xfe, 0xfe, 0x3f,
+    0xff, 0xff, 0x24, 0xf0, 0xe6, 0x54, 0x64, 0x83, 0xe8, 0x01, 0x20, 0xe5,
+    0x00, 0x12, 0xa3, 0x3d, 0x5f, 0xff, 0xe8, 0xe6, 0x6b, 0xff, 0xff, 0x3f,
+    0xf6, 0xf6, 0x65, 0xff, 0xff, 0x35, 0xff, 0xff, 0x18, 0xe4, 0xdd, 0x59,
+    0x4d, 0x6b, 0xef, 0x03, 0x36, 0xe9, 0x07, 0x11, 0x43, 0x04, 0x02, 0x11,
+    0x00, 0x0e, 0xb8, 0x66, 0x6b, 0xdc, 0xfe, 0xfe, 0x27, 0xfe, 0xfe, 0x18,
+    0xfc, 0xfd, 0x1f, 0xdb, 0xdc, 0x5c, 0x4b, 0x6d, 0xfa, 0x00, 0x1b, 0xca,
+    0x02, 0x00, 0x21, 0x03, 0x00, 0xd0, 0xa3, 0xa4, 0x9d, 0xfe, 0xff, 0x0f,
+    0xf7, 0xf7, 0x18, 0xfe, 0xff, 0x25, 0x75, 0x7f, 0xc8, 0x00, 0x07, 0xa8,
+    0x04, 0x00, 0x0a, 0x07, 0x03, 0xff, 0x9b, 0x92, 0xa8, 0xff, 0xfb, 0x15,
+    0xff, 0xf5, 0x30, 0xff, 0xf7, 0x56, 0xfe, 0xf9, 0x0f, 0xd3, 0xd1, 0x73,
+    0x15, 0x10, 0x72, 0x10, 0x05, 0xfa, 0xa1, 0x8a, 0x93, 0xff, 0xe8, 0x13,
+    0xff, 0xe4, 0x1d, 0xd1, 0xcf, 0x85, 0xa7, 0xb5, 0xaf, 0xff, 0xf3, 0x26,
+    0xff, 0xfa, 0x13, 0xa0, 0x8f, 0x9b, 0x00, 0x00, 0xff, 0x91, 0x7b, 0xa3,
+    0xff, 0xd6, 0x10, 0xff, 0xcf, 0x1b, 0xdd, 0xd0, 0x80, 0x39, 0x6b, 0xf3,
+    0x2e, 0x5d, 0xeb, 0xd9, 0xcf, 0x76, 0xfc, 0xd5, 0x0f, 0xfc, 0xe1, 0x34,
+    0x60, 0x51, 0xc1, 0x83, 0x6a, 0xa8, 0xff, 0xc0, 0x12, 0xff, 0xbc, 0x1b,
+    0xd8, 0xc1, 0x7a, 0x41, 0x78, 0xf6, 0x0e, 0x39, 0xc6, 0x12, 0x38, 0xc8,
+    0x6c, 0x80, 0xe0, 0xff, 0xdc, 0x3c, 0xfc, 0xcb, 0x05, 0xca, 0xab, 0x62,
+    0x2d, 0x1e, 0xef, 0x78, 0x6d, 0xba, 0xff, 0xf2, 0x2c, 0xff, 0xcf, 0x2d,
+    0xf2, 0xc1, 0x5e, 0x5a, 0x7c, 0xea, 0x13, 0x56, 0xe8, 0x06, 0x03, 0x16,
+    0x05, 0x14, 0x5f, 0x32, 0x5c, 0xfd, 0xde, 0xc1, 0x6f, 0xff, 0xba, 0x00,
+    0xff, 0xc1, 0x12, 0x98, 0x78, 0x8f, 0x38, 0x47, 0xf2, 0x5e, 0x8f, 0xde,
+    0x6d, 0x95, 0xd1, 0x60, 0x7a, 0xd7, 0x23, 0x5d, 0xf9, 0x09, 0x0c, 0x4a,
+    0x19, 0x45, 0xf8, 0x7a, 0x7b, 0xb7, 0xd1, 0xba, 0x66, 0xb3, 0xac, 0x96,
+    0x43, 0x54, 0xde, 0x12, 0x1d, 0xee, 0x17, 0x5e, 0xff, 0x12, 0x63, 0xff,
+    0x1d, 0x4b, 0xff, 0x0f, 0x17, 0x98, 0x10, 0x22, 0xde, 0x38, 0x73, 0xff,
+    0x33, 0x7f, 0xff, 0x1f, 0x5a, 0xff, 0x04, 0x10, 0xbd, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x1b, 0x01, 0x00, 0x32, 0x01, 0x00, 0x4a, 0x00, 0x00, 0x16,
+    0x00, 0x02, 0x02, 0x00, 0x00, 0xb6, 0x0b, 0x16, 0xa5, 0x0f, 0x14, 0x91,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0x08, 0x08, 0xcf, 0x57, 0x56, 0xbc,
+    0x4f, 0x4e, 0xb8, 0x9c, 0x9e, 0x9d, 0x32, 0x34, 0xc2, 0x72, 0x85, 0xa0,
+    0xda, 0xfc, 0x70, 0x63, 0x67, 0xae, 0x69, 0x63, 0xa7, 0xd7, 0xe4, 0x64,
+    0xf3, 0xff, 0x54, 0x82, 0x82, 0xa4, 0x85, 0x8e, 0xa3, 0xca, 0xf5, 0x5d,
+    0xa9, 0xe4, 0x4a, 0xe8, 0xf7, 0x73, 0x41, 0x45, 0xc7, 0x1a, 0x1c, 0x8b,
+    0xba, 0xba, 0xa4, 0xef, 0xf9, 0x31, 0xe0, 0xe8, 0x37, 0xd3, 0xd0, 0x78,
+    0x3b, 0x3c, 0xbd, 0x8c, 0x89, 0x94, 0xf2, 0xf8, 0x46, 0xd2, 0xe1, 0x3c,
+    0xee, 0xfa, 0x55, 0xb0, 0xbe, 0xbe, 0x22, 0x2e, 0xc4, 0x02, 0x01, 0x15,
+    0x30, 0x33, 0x9f, 0xe7, 0xe6, 0x70, 0xf8, 0xf1, 0x16, 0xff, 0xfc, 0x35,
+    0xa0, 0x9f, 0x9e, 0x8b, 0x89, 0x9b, 0xff, 0xf9, 0x41, 0xf6, 0xe5, 0x23,
+    0xff, 0xfd, 0x51, 0xae, 0xb8, 0xc5, 0x13, 0x22, 0xe1, 0x00, 0x00, 0x2c,
+    0x02, 0x04, 0x00, 0x02, 0x04, 0x56, 0x6e, 0x74, 0xbe, 0xfd, 0xfd, 0x40,
+    0xfd, 0xf1, 0x12, 0xfc, 0xf5, 0x4b, 0xff, 0xf6, 0x3f, 0xfc, 0xee, 0x17,
+    0xff, 0xff, 0x49, 0xad, 0xb9, 0xca, 0x10, 0x21, 0xe0, 0x00, 0x00, 0x27,
+    0x03, 0x01, 0x00, 0x0a, 0x0c, 0x88, 0xa8, 0xaa, 0xa3, 0xff, 0xff, 0x1f,
+    0xfd, 0xee, 0x1a, 0xfd, 0xf0, 0x18, 0xff, 0xff, 0x43, 0xb4, 0xc0, 0xc1,
+    0x18, 0x27, 0xcd, 0x00, 0x00, 0x22, 0x02, 0x01, 0x00, 0x43, 0x48, 0xc0,
+    0xee, 0xe7, 0x59, 0xfd, 0xeb, 0x0c, 0xff, 0xfa, 0x35, 0xb9, 0xc6, 0xb3,
+    0x19, 0x27, 0xc3, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x00, 0x23, 0x23, 0xc1,
+    0xde, 0xcb, 0x51, 0xff, 0xdd, 0x08, 0xf8, 0xe6, 0x46, 0x37, 0x3d, 0xbb,
+    0x00, 0x00, 0x23, 0x05, 0x03, 0x00, 0x2d, 0x2e, 0xb2, 0xee, 0xcb, 0x3f,
+    0xfe, 0xbf, 0x0c, 0xed, 0xcf, 0x56, 0x1b, 0x1c, 0x73, 0x01, 0x01, 0x00,
+    0x2e, 0x30, 0xaf, 0xed, 0xbd, 0x39, 0xfe, 0xa5, 0x0d, 0xe2, 0xba, 0x62,
+    0x09, 0x0e, 0x69, 0x2e, 0x33, 0xac, 0xee, 0xac, 0x2e, 0xfe, 0x82, 0x01,
+    0xd2, 0xa1, 0x67, 0x03, 0x08, 0x5b, 0x2c, 0x2f, 0xaa, 0xe8, 0xbf, 0x35,
+    0xff, 0xb4, 0x16, 0xbd, 0x9b, 0x7d, 0x00, 0x03, 0x46, 0x0f, 0x17, 0xc2,
+    0x33, 0x76, 0xeb, 0x3d, 0x90, 0xef, 0x2c, 0x4f, 0xe7, 0x00, 0x00, 0x26,
+    0x0a, 0x0d, 0xbd, 0x13, 0x2c, 0xc8, 0x17, 0x3a, 0xd1, 0x0b, 0x1a, 0xc0,
+    0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06,
+    0x40, 0x45, 0xe2, 0x8d, 0x93, 0xb9, 0x7e, 0x8d, 0xbf, 0x81, 0x90, 0xbe,
+    0x7b, 0x88, 0xb4, 0x7c, 0x8a, 0xb2, 0x7b, 0x89, 0xb4, 0x89, 0x8f, 0xac,
+    0x4e, 0x55, 0xda, 0x7d, 0x85, 0xb9, 0xe5, 0xff, 0x0a, 0xbe, 0xff, 0x08,
+    0xc4, 0xff, 0x0a, 0xc0, 0xff, 0x0f, 0xba, 0xff, 0x14, 0xdd, 0xff, 0x0e,
+    0x85, 0x90, 0xad, 0x65, 0x6b, 0xc5, 0xd2, 0xdf, 0x61, 0xbe, 0xd3, 0x68,
+    0xc4, 0xd9, 0x69, 0xcb, 0xe3, 0x65, 0xd7, 0xf2, 0x50, 0xc2, 0xec, 0x1e,
+    0xdf, 0xf8, 0x15, 0x7f, 0x86, 0xb6, 0x00, 0x00, 0x42, 0x12, 0x1b, 0xff,
+    0x2a, 0x48, 0xff, 0x39, 0x65, 0xff, 0x28, 0x52, 0xff, 0x3d, 0x47, 0xeb,
+    0xf4, 0xf8, 0x61, 0xe5, 0xf6, 0x25, 0xff, 0xff, 0x3b, 0x75, 0x75, 0xa0,
+    0x00, 0x00, 0x3c, 0x0f, 0x14, 0xd2, 0x19, 0x22, 0xac, 0x17, 0x26, 0xb2,
+    0x1c, 0x29, 0xf3, 0xc3, 0xc3, 0x8e, 0xfe, 0xfe, 0x29, 0xff, 0xff, 0x46,
+    0xab, 0xae, 0x84, 0x13, 0x24, 0xd9, 0x03, 0x03, 0x30, 0x09, 0x07, 0x63,
+    0xc4, 0xc2, 0x90, 0xff, 0xff, 0x25, 0xff, 0xff, 0x43, 0xbe, 0xc1, 0x6c,
+    0x21, 0x49, 0xe1, 0x08, 0x1a, 0x96, 0x01, 0x00, 0x0d, 0xbc, 0xbd, 0x9c,
+    0xff, 0xff, 0x29, 0xff, 0xff, 0x37, 0xb6, 0xb9, 0x8b, 0x30, 0x65, 0xe6,
+    0x0b, 0x1e, 0x93, 0xb1, 0xb3, 0x97, 0xae, 0xb4, 0xa3, 0x25, 0x5d, 0xff,
+    0x0b, 0x22, 0x93, 0xb0, 0xb0, 0x92, 0xff, 0xff, 0x27, 0xff, 0xff, 0x35,
+    0xb5, 0xbb, 0xa1, 0x21, 0x5b, 0xff, 0x0c, 0x22, 0x9a, 0xa6, 0x9f, 0x9f,
+    0xff, 0xfc, 0x2c, 0xff, 0xf5, 0x2e, 0xbe, 0xc2, 0x9c, 0x27, 0x5a, 0xf6,
+    0x0e, 0x1f, 0x7c, 0x05, 0x01, 0x00, 0x8e, 0x84, 0xae, 0xff, 0xee, 0x2c,
+    0xfd, 0xde, 0x22, 0xc6, 0xc3, 0x98, 0x06, 0x33, 0xff, 0x00, 0x0d, 0xc8,
+    0x00, 0x00, 0x32, 0x00, 0x00, 0x51, 0x43, 0x39, 0xda, 0xf9, 0xc5, 0x3c,
+    0xf9, 0x9d, 0x01, 0xfb, 0xbd, 0x2c, 0xd2, 0xb8, 0x7b, 0x7e, 0x69, 0xa4,
+    0x86, 0x70, 0xa0, 0x83, 0x6f, 0xab, 0x89, 0x7e, 0xab, 0x49, 0x3f, 0xd6,
+    0x17, 0x1a, 0xf5, 0xce, 0xa9, 0x7f, 0xff, 0xb8, 0x14, 0xff, 0xa2, 0x17,
+    0xff, 0xa9, 0x19, 0xff, 0xb8, 0x17, 0xff, 0xc8, 0x0f, 0xff, 0xc8, 0x12,
+    0xff, 0xc7, 0x0c, 0xff, 0xe5, 0x36, 0x5e, 0x5b, 0xc1, 0x00, 0x00, 0x49,
+    0x15, 0x12, 0xf3, 0x73, 0x6a, 0xb9, 0x91, 0x8a, 0xa3, 0x8d, 0x88, 0xa9,
+    0x8e, 0x89, 0xa7, 0x8d, 0x88, 0xa7, 0x89, 0x85, 0xa9, 0x88, 0x85, 0xa9,
+    0x8b, 0x83, 0xa6, 0x7d, 0x67, 0xb4, 0x1e, 0x2a, 0x8d, 0x00, 0x00, 0x05,
+    0x0b, 0x0d, 0xff, 0x19, 0x42, 0xff, 0x1d, 0x69, 0xff, 0x21, 0x72, 0xff,
+    0x1f, 0x71, 0xff, 0x21, 0x71, 0xff, 0x1f, 0x73, 0xff, 0x20, 0x63, 0xff,
+    0x20, 0x36, 0xff, 0x04, 0x07, 0x28, 0x03, 0x02, 0x25, 0x02, 0x00, 0x25,
+    0x03, 0x03, 0x24,
+};
+HOTMEM const uint16_t charset_palettes[] = {
+    0, 0, 90, 103, 212, 336, 394, 496, 507, 625, 737, 749,
+    812, 823, 824, 833, 834, 890, 935, 985, 1041, 1088, 1146, 1196,
+    1243, 1290, 1336, 1386, 1445, 1446, 1447, 1448, 1562, 1563, 1691, 1847,
+    1967, 2101, 2234, 2349, 2488, 2649, 2729, 2827, 2963, 3057, 3222, 3349,
+    3488, 3619, 3772, 3926, 4051, 4161, 4296, 4403, 4573, 4726, 4840,
+};
+HOTMEM const uint8_t charset_runs[] = {
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 6, 0,
+    1, 1, 1, 2, 1, 3, 1, 4, 6, 0, 5, 0,
+    1, 5, 1, 6, 1, 7, 1, 8, 1, 9, 1, 10,
+    5, 0, 5, 0, 1, 11, 1, 12, 1, 13, 1, 14,
+    1, 15, 1, 16, 5, 0, 5, 0, 1, 17, 1, 18,
+    1, 19, 1, 20, 1, 21, 1, 22, 5, 0, 5, 0,
+    1, 23, 1, 24, 1, 25, 1, 26, 1, 27, 1, 28,
+    5, 0, 5, 0, 1, 29, 1, 30, 1, 31, 1, 32,
+    1, 33, 1, 34, 5, 0, 5, 0, 1, 35, 1, 36,
+    1, 37, 1, 38, 1, 39, 1, 40, 5, 0, 5, 0,
+    1, 41, 1, 42, 1, 43, 1, 44, 1, 45, 1, 46,
+    5, 0, 5, 0, 1, 47, 1, 48, 1, 49, 1, 50,
+    1, 51, 1, 52, 5, 0, 5, 0, 1, 53, 1, 54,
+    1, 55, 1, 56, 1, 57, 1, 58, 5, 0, 5, 0,
+    1, 59, 1, 60, 1, 61, 1, 62, 1, 63, 1, 64,
+    5, 0, 6, 0, 1, 65, 1, 66, 1, 67, 1, 68,
+    6, 0, 5, 0, 1, 69, 1, 70, 1, 71, 1, 72,
+    1, 73, 1, 74, 5, 0, 5, 0, 1, 75, 1, 76,
+    1, 77, 1, 78, 1, 79, 1, 80, 5, 0, 5, 0,
+    1, 81, 1, 82, 1, 83, 1, 84, 1, 85, 1, 86,
+    5, 0, 6, 0, 1, 87, 1, 88, 1, 89, 1, 90,
+    6, 0, 16, 0, 16, 0, 4, 0, 1, 1, 1, 2,
+    1, 3, 1, 4, 1, 1, 1, 2, 1, 3, 1, 4,
+    4, 0, 4, 0, 1, 2, 2, 5, 1, 6, 1, 2,
+    2, 5, 1, 7, 4, 0, 4, 0, 1, 3, 2, 8,
+    1, 6, 1, 3, 2, 8, 1, 7, 4, 0, 3, 0,
+    1, 3, 1, 9, 1, 10, 1, 11, 1, 12, 1, 9,
+    1, 10, 1, 11, 1, 7, 4, 0, 3, 0, 1, 3,
+    1, 12, 1, 13, 1, 6, 1, 3, 1, 12, 1, 13,
+    1, 7, 5, 0, 3, 0, 1, 12, 2, 7, 1, 0,
+    1, 12, 2, 7, 6, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 6, 0, 2, 1, 8, 0, 5, 0, 1, 2,
+    1, 3, 1, 4, 1, 5, 1, 6, 6, 0, 4, 0,
+    1, 7, 1, 8, 1, 9, 1, 10, 1, 11, 1, 12,
+    1, 13, 5, 0, 4, 0, 1, 14, 1, 15, 1, 16,
+    1, 17, 1, 18, 1, 3, 1, 19, 1, 20, 4, 0,
+    3, 0, 1, 20, 1, 21, 1, 22, 1, 23, 1, 19,
+    1, 24, 1, 25, 1, 24, 1, 13, 1, 26, 3, 0,
+    2, 0, 2, 27, 1, 28, 1, 29, 1, 30, 1, 6,
+    1, 31, 3, 32, 1, 20, 1, 33, 2, 0, 3, 0,
+    1, 34, 1, 35, 1, 36, 1, 37, 1, 38, 1, 39,
+    1, 40, 1, 41, 1, 33, 2, 42, 2, 0, 4, 0,
+    1, 43, 1, 44, 1, 45, 1, 46, 1, 47, 1, 48,
+    1, 49, 1, 34, 1, 50, 1, 51, 1, 52, 1, 0,
+    4, 0, 1, 53, 1, 54, 1, 55, 1, 56, 1, 47,
+    1, 57, 1, 58, 1, 59, 1, 60, 1, 61, 1, 62,
+    1, 0, 2, 0, 1, 63, 1, 64, 1, 65, 1, 66,
+    1, 67, 1, 68, 1, 47, 1, 69, 1, 70, 1, 71,
+    1, 72, 1, 73, 1, 57, 1, 0, 1, 0, 1, 63,
+    1, 74, 1, 75, 1, 76, 1, 77, 1, 78, 1, 79,
+    1, 80, 1, 64, 1, 70, 1, 81, 1, 82, 2, 83,
+    1, 0, 1, 0, 1, 64, 1, 48, 1, 84, 1, 85,
+    1, 86, 1, 87, 1, 88, 1, 64, 1, 57, 1, 89,
+    1, 64, 1, 61, 1, 90, 1, 76, 1, 0, 2, 0,
+    1, 91, 1, 92, 1, 93, 1, 94, 1, 95, 1, 48,
+    1, 96, 1, 73, 1, 97, 1, 91, 1, 98, 3, 0,
+    3, 0, 1, 99, 1, 100, 1, 101, 1, 84, 1, 102,
+    1, 84, 1, 103, 1, 85, 1, 36, 2, 104, 2, 0,
+    4, 0, 1, 85, 1, 97, 1, 73, 1, 105, 1, 85,
+    1, 106, 1, 107, 1, 108, 2, 104, 2, 0, 5, 0,
+    1, 82, 1, 109, 1, 106, 2, 107, 6, 0, 16, 0,
+    5, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5,
+    1, 6, 5, 0, 3, 0, 1, 7, 1, 8, 1, 9,
+    1, 10, 1, 11, 1, 12, 1, 13, 1, 14, 1, 15,
+    1, 16, 3, 0, 2, 0, 1, 15, 1, 17, 1, 18,
+    1, 19, 1, 20, 1, 21, 1, 22, 1, 23, 1, 24,
+    1, 21, 1, 25, 1, 26, 2, 0, 2, 0, 1, 27,
+    1, 28, 1, 29, 1, 30, 2, 21, 1, 23, 1, 31,
+    1, 32, 2, 21, 1, 33, 2, 0, 1, 0, 1, 34,
+    1, 35, 1, 36, 1, 37, 1, 38, 2, 21, 1, 39,
+    1, 40, 1, 41, 1, 24, 2, 21, 1, 42, 1, 0,
+    1, 0, 1, 43, 1, 44, 1, 45, 1, 46, 1, 47,
+    1, 48, 1, 49, 1, 50, 1, 51, 1, 52, 1, 49,
+    1, 53, 1, 47, 1, 23, 1, 0, 1, 0, 2, 54,
+    1, 55, 1, 56, 1, 57, 1, 58, 1, 59, 2, 51,
+    1, 60, 1, 61, 1, 62, 1, 63, 1, 32, 1, 0,
+    1, 0, 1, 64, 1, 2, 1, 65, 1, 66, 1, 67,
+    5, 51, 1, 68, 1, 69, 1, 10, 1, 21, 1, 0,
+    1, 0, 1, 70, 1, 71, 1, 72, 1, 66, 1, 38,
+    1, 41, 4, 51, 1, 73, 1, 74, 1, 75, 1, 21,
+    1, 0, 1, 0, 1, 76, 1, 77, 1, 78, 1, 79,
+    1, 75, 1, 24, 3, 51, 1, 80, 1, 81, 1, 82,
+    1, 21, 1, 83, 1, 0, 1, 0, 2, 84, 1, 78,
+    2, 75, 1, 80, 1, 85, 1, 86, 1, 87, 1, 51,
+    1, 88, 1, 89, 1, 38, 1, 90, 1, 0, 1, 0,
+    1, 91, 1, 92, 1, 93, 1, 78, 1, 94, 1, 95,
+    1, 96, 1, 97, 1, 98, 1, 99, 1, 100, 1, 101,
+    1, 66, 1, 102, 1, 0, 2, 0, 1, 103, 1, 104,
+    1, 105, 1, 24, 1, 106, 1, 107, 1, 108, 2, 75,
+    1, 89, 1, 12, 1, 109, 2, 0, 2, 0, 1, 110,
+    1, 111, 1, 112, 1, 113, 1, 21, 2, 108, 1, 94,
+    2, 75, 1, 109, 1, 114, 2, 0, 3, 0, 1, 114,
+    1, 115, 1, 116, 1, 117, 1, 118, 1, 119, 1, 75,
+    1, 120, 1, 121, 1, 110, 3, 0, 5, 0, 1, 122,
+    2, 123, 1, 124, 1, 122, 1, 110, 5, 0, 16, 0,
+    7, 0, 1, 1, 1, 2, 7, 0, 7, 0, 1, 3,
+    1, 4, 7, 0, 6, 0, 1, 1, 1, 5, 1, 6,
+    1, 7, 6, 0, 6, 0, 1, 8, 1, 9, 1, 10,
+    1, 11, 6, 0, 4, 0, 1, 1, 1, 12, 1, 13,
+    1, 14, 1, 15, 1, 16, 1, 2, 1, 4, 4, 0,
+    1, 1, 1, 17, 2, 1, 1, 18, 1, 19, 1, 20,
+    1, 21, 1, 22, 1, 23, 1, 22, 2, 24, 1, 22,
+    1, 25, 1, 11, 1, 11, 1, 26, 1, 27, 1, 28,
+    1, 29, 1, 30, 1, 31, 1, 32, 1, 33, 1, 34,
+    2, 35, 1, 22, 1, 16, 1, 36, 1, 37, 1, 0,
+    1, 38, 1, 2, 1, 15, 1, 39, 1, 17, 1, 40,
+    1, 41, 1, 2, 1, 42, 1, 15, 1, 6, 1, 43,
+    1, 44, 1, 45, 1, 0, 2, 0, 1, 7, 1, 2,
+    1, 23, 1, 22, 1, 42, 1, 33, 1, 2, 1, 46,
+    1, 16, 1, 11, 1, 47, 1, 45, 2, 0, 3, 0,
+    1, 16, 1, 24, 1, 35, 1, 45, 2, 6, 1, 48,
+    1, 16, 1, 49, 1, 37, 3, 0, 3, 0, 1, 50,
+    1, 8, 1, 39, 1, 15, 1, 25, 2, 23, 1, 51,
+    1, 11, 1, 52, 3, 0, 3, 0, 1, 24, 1, 39,
+    1, 22, 1, 51, 1, 4, 1, 16, 1, 25, 1, 53,
+    1, 2, 1, 44, 3, 0, 3, 0, 1, 54, 1, 24,
+    1, 4, 1, 36, 1, 55, 1, 49, 1, 2, 1, 51,
+    1, 16, 1, 56, 3, 0, 2, 0, 1, 24, 1, 22,
+    1, 2, 1, 38, 2, 37, 1, 47, 1, 57, 1, 11,
+    1, 4, 1, 43, 1, 52, 2, 0, 2, 0, 1, 23,
+    1, 11, 1, 47, 1, 37, 4, 0, 1, 47, 1, 58,
+    1, 49, 1, 44, 2, 0, 2, 0, 1, 56, 1, 37,
+    8, 0, 1, 47, 1, 37, 2, 0, 16, 0, 8, 0,
+    2, 1, 2, 0, 1, 2, 1, 3, 2, 0, 8, 0,
+    1, 4, 1, 5, 1, 6, 1, 1, 4, 0, 6, 0,
+    1, 7, 1, 8, 1, 9, 1, 10, 1, 11, 1, 12,
+    4, 0, 3, 0, 1, 13, 1, 14, 1, 15, 1, 16,
+    1, 17, 1, 18, 1, 19, 1, 20, 1, 21, 1, 22,
+    3, 0, 2, 0, 1, 23, 1, 24, 1, 25, 1, 26,
+    1, 27, 2, 28, 1, 29, 1, 30, 1, 31, 1, 22,
+    1, 32, 2, 0, 2, 0, 1, 33, 1, 34, 1, 35,
+    1, 36, 1, 37, 3, 28, 1, 38, 1, 39, 2, 40,
+    2, 0, 2, 0, 1, 41, 1, 42, 1, 36, 1, 43,
+    1, 44, 2, 28, 1, 45, 1, 38, 1, 46, 1, 47,
+    1, 48, 1, 49, 1, 0, 2, 0, 1, 50, 1, 51,
+    1, 52, 1, 53, 1, 54, 2, 28, 1, 55, 1, 56,
+    1, 57, 1, 58, 2, 59, 1, 0, 2, 0, 1, 60,
+    1, 61, 1, 62, 1, 63, 1, 64, 1, 29, 1, 65,
+    1, 47, 1, 66, 1, 67, 1, 68, 1, 69, 1, 70,
+    1, 0, 1, 0, 1, 71, 1, 4, 1, 72, 1, 73,
+    1, 74, 1, 75, 2, 76, 1, 77, 1, 22, 1, 78,
+    1, 72, 1, 79, 1, 70, 1, 0, 1, 0, 1, 21,
+    1, 11, 1, 40, 1, 21, 1, 71, 1, 80, 1, 81,
+    1, 80, 1, 21, 1, 22, 1, 82, 1, 83, 1, 40,
+    1, 84, 1, 0, 1, 0, 1, 85, 1, 78, 1, 86,
+    1, 87, 1, 88, 2, 21, 1, 89, 1, 68, 1, 69,
+    1, 32, 1, 90, 1, 39, 1, 57, 1, 0, 2, 0,
+    1, 79, 1, 91, 1, 92, 1, 93, 1, 82, 1, 94,
+    1, 83, 1, 32, 1, 95, 1, 96, 1, 84, 2, 57,
+    1, 0, 3, 0, 1, 97, 1, 98, 1, 99, 2, 67,
+    1, 96, 1, 100, 1, 101, 1, 58, 1, 59, 1, 102,
+    2, 0, 4, 0, 1, 97, 1, 95, 1, 70, 2, 84,
+    1, 101, 2, 58, 1, 59, 3, 0, 6, 0, 2, 84,
+    1, 101, 1, 6, 1, 58, 5, 0, 16, 0, 16, 0,
+    2, 0, 1, 1, 1, 2, 1, 3, 1, 4, 10, 0,
+    2, 0, 1, 2, 2, 5, 1, 6, 10, 0, 2, 0,
+    1, 3, 2, 7, 1, 6, 10, 0, 1, 0, 1, 3,
+    1, 4, 1, 8, 1, 9, 1, 6, 10, 0, 1, 0,
+    1, 3, 1, 10, 1, 11, 1, 6, 11, 0, 1, 0,
+    1, 4, 2, 6, 12, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 9, 0, 1, 1, 1, 2, 1, 3, 1, 4,
+    1, 5, 2, 0, 8, 0, 1, 6, 1, 7, 1, 8,
+    1, 9, 1, 10, 1, 11, 1, 12, 1, 0, 7, 0,
+    1, 13, 1, 14, 1, 15, 1, 16, 1, 17, 1, 18,
+    1, 19, 1, 20, 1, 21, 6, 0, 1, 22, 1, 23,
+    1, 24, 1, 25, 1, 26, 1, 27, 1, 28, 1, 29,
+    1, 30, 1, 31, 6, 0, 1, 32, 1, 33, 1, 34,
+    1, 35, 1, 36, 1, 37, 1, 38, 1, 39, 1, 40,
+    1, 0, 5, 0, 1, 41, 1, 42, 1, 43, 1, 44,
+    1, 45, 1, 46, 1, 47, 1, 48, 3, 0, 5, 0,
+    1, 49, 1, 50, 1, 51, 1, 52, 1, 53, 1, 54,
+    5, 0, 5, 0, 1, 55, 1, 56, 1, 57, 1, 58,
+    1, 59, 1, 60, 5, 0, 5, 0, 1, 61, 1, 62,
+    1, 63, 1, 64, 1, 65, 1, 66, 5, 0, 6, 0,
+    1, 67, 1, 68, 1, 69, 1, 70, 1, 71, 5, 0,
+    6, 0, 1, 72, 1, 73, 1, 74, 1, 75, 1, 76,
+    1, 77, 4, 0, 6, 0, 1, 78, 1, 79, 1, 80,
+    1, 81, 1, 82, 1, 83, 1, 84, 1, 85, 1, 86,
+    1, 0, 6, 0, 1, 87, 1, 88, 1, 89, 1, 90,
+    1, 91, 1, 92, 1, 93, 1, 94, 1, 95, 1, 96,
+    7, 0, 1, 97, 1, 98, 1, 99, 1, 100, 1, 101,
+    1, 102, 1, 103, 1, 104, 1, 105, 8, 0, 1, 106,
+    1, 107, 1, 108, 1, 109, 1, 110, 1, 111, 1, 112,
+    1, 113, 10, 0, 1, 114, 1, 115, 1, 116, 1, 117,
+    1, 118, 1, 0, 16, 0, 1, 0, 1, 1, 1, 2,
+    1, 3, 1, 4, 1, 5, 10, 0, 1, 6, 1, 7,
+    1, 8, 1, 9, 1, 10, 1, 11, 1, 12, 9, 0,
+    1, 13, 1, 14, 1, 15, 1, 16, 1, 17, 1, 18,
+    1, 19, 1, 20, 8, 0, 1, 21, 1, 22, 1, 23,
+    1, 24, 1, 25, 1, 26, 1, 27, 1, 28, 1, 29,
+    7, 0, 1, 30, 1, 31, 1, 32, 1, 33, 1, 34,
+    1, 35, 1, 36, 1, 37, 1, 38, 1, 39, 6, 0,
+    2, 0, 1, 40, 1, 41, 1, 42, 1, 43, 1, 44,
+    1, 45, 1, 46, 1, 47, 6, 0, 4, 0, 1, 48,
+    1, 49, 1, 50, 1, 51, 1, 52, 1, 53, 6, 0,
+    5, 0, 1, 54, 1, 55, 1, 56, 1, 57, 1, 58,
+    6, 0, 5, 0, 1, 59, 1, 60, 1, 61, 1, 62,
+    1, 63, 6, 0, 4, 0, 1, 64, 1, 65, 1, 66,
+    1, 67, 1, 68, 1, 69, 6, 0, 3, 0, 1, 70,
+    1, 71, 1, 72, 1, 73, 1, 74, 1, 75, 1, 76,
+    6, 0, 1, 0, 1, 77, 1, 78, 1, 79, 1, 80,
+    1, 81, 1, 82, 1, 83, 1, 84, 1, 85, 6, 0,
+    1, 86, 1, 87, 1, 88, 1, 89, 1, 90, 1, 91,
+    1, 92, 1, 93, 1, 94, 7, 0, 1, 95, 1, 96,
+    1, 97, 1, 98, 1, 99, 1, 34, 1, 100, 1, 101,
+    8, 0, 1, 102, 1, 103, 1, 104, 1, 105, 1, 106,
+    1, 107, 1, 108, 9, 0, 1, 0, 1, 109, 1, 110,
+    1, 111, 1, 112, 11, 0, 16, 0, 16, 0, 16, 0,
+    4, 0, 1, 1, 1, 2, 4, 0, 1, 3, 1, 4,
+    4, 0, 3, 0, 2, 1, 1, 2, 1, 5, 2, 0,
+    2, 3, 1, 6, 1, 7, 3, 0, 2, 0, 2, 1,
+    2, 2, 1, 5, 1, 8, 1, 9, 2, 3, 1, 6,
+    1, 10, 1, 11, 2, 0, 1, 0, 2, 1, 2, 2,
+    2, 5, 1, 8, 2, 3, 2, 6, 1, 10, 1, 11,
+    1, 12, 1, 0, 1, 0, 1, 1, 1, 2, 2, 5,
+    2, 8, 1, 9, 1, 3, 2, 6, 1, 7, 2, 11,
+    1, 12, 1, 0, 1, 0, 1, 2, 2, 5, 1, 8,
+    1, 9, 3, 3, 1, 6, 1, 7, 2, 11, 2, 12,
+    1, 0, 2, 0, 1, 5, 2, 9, 2, 3, 2, 6,
+    1, 7, 1, 10, 1, 11, 2, 12, 2, 0, 3, 0,
+    1, 9, 2, 3, 1, 6, 2, 7, 1, 10, 1, 11,
+    2, 12, 3, 0, 4, 0, 1, 4, 2, 6, 1, 7,
+    1, 10, 3, 12, 4, 0, 6, 0, 1, 7, 1, 10,
+    1, 11, 1, 12, 6, 0, 7, 0, 1, 11, 1, 12,
+    7, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    3, 0, 1, 1, 1, 2, 1, 3, 4, 0, 1, 4,
+    1, 5, 1, 6, 3, 0, 2, 0, 1, 1, 1, 7,
+    1, 8, 1, 9, 4, 0, 1, 10, 1, 11, 1, 5,
+    1, 6, 2, 0, 1, 0, 1, 1, 1, 12, 1, 13,
+    2, 14, 1, 15, 2, 0, 1, 16, 1, 17, 2, 11,
+    1, 5, 1, 6, 1, 0, 1, 0, 1, 18, 1, 19,
+    2, 14, 2, 20, 1, 3, 2, 17, 3, 11, 1, 9,
+    1, 21, 1, 0, 2, 0, 1, 22, 1, 9, 3, 20,
+    1, 23, 1, 20, 3, 11, 1, 5, 1, 21, 2, 0,
+    3, 0, 1, 24, 1, 9, 1, 20, 1, 25, 1, 26,
+    1, 27, 1, 28, 1, 11, 1, 29, 1, 30, 3, 0,
+    4, 0, 1, 24, 1, 31, 1, 32, 1, 33, 1, 34,
+    1, 35, 1, 36, 1, 30, 4, 0, 4, 0, 1, 37,
+    1, 19, 1, 38, 1, 39, 1, 40, 1, 41, 1, 42,
+    1, 43, 4, 0, 3, 0, 1, 44, 1, 20, 1, 11,
+    1, 45, 1, 46, 1, 47, 1, 42, 1, 48, 1, 11,
+    1, 49, 3, 0, 2, 0, 1, 15, 1, 50, 3, 11,
+    1, 5, 1, 42, 1, 51, 1, 52, 2, 11, 1, 53,
+    2, 0, 1, 0, 1, 54, 5, 11, 1, 48, 1, 55,
+    1, 36, 4, 11, 1, 56, 1, 0, 1, 0, 1, 55,
+    1, 57, 3, 11, 1, 58, 2, 0, 1, 3, 3, 11,
+    1, 6, 1, 59, 1, 0, 2, 0, 1, 55, 1, 60,
+    1, 9, 1, 61, 4, 0, 1, 15, 1, 11, 1, 52,
+    1, 62, 2, 0, 3, 0, 1, 21, 1, 6, 1, 30,
+    4, 0, 1, 24, 1, 63, 1, 59, 3, 0, 16, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 2, 0,
+    1, 1, 1, 2, 1, 3, 1, 4, 10, 0, 2, 0,
+    1, 2, 2, 5, 1, 6, 10, 0, 2, 0, 1, 3,
+    2, 7, 1, 6, 10, 0, 1, 0, 1, 3, 1, 4,
+    1, 8, 1, 9, 1, 6, 10, 0, 1, 0, 1, 3,
+    1, 10, 1, 11, 1, 6, 11, 0, 1, 0, 1, 4,
+    2, 6, 12, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 12, 1, 4, 0, 12, 1, 4, 0,
+    12, 1, 4, 0, 12, 1, 4, 0, 12, 1, 4, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 1, 0, 1, 1, 1, 2, 1, 3, 1, 4,
+    11, 0, 1, 0, 1, 2, 2, 5, 1, 6, 11, 0,
+    1, 0, 1, 3, 2, 7, 1, 6, 11, 0, 1, 0,
+    1, 4, 1, 8, 1, 9, 1, 6, 11, 0, 16, 0,
+    16, 0, 10, 0, 5, 1, 1, 0, 9, 0, 6, 1,
+    1, 0, 8, 0, 7, 1, 1, 0, 7, 0, 8, 1,
+    1, 0, 6, 0, 9, 1, 1, 0, 5, 0, 9, 1,
+    2, 0, 4, 0, 9, 1, 3, 0, 3, 0, 9, 1,
+    4, 0, 2, 0, 9, 1, 5, 0, 1, 0, 9, 1,
+    6, 0, 9, 1, 7, 0, 8, 1, 8, 0, 7, 1,
+    9, 0, 6, 1, 10, 0, 5, 1, 11, 0, 16, 0,
+    6, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5,
+    5, 0, 5, 0, 1, 6, 1, 7, 2, 8, 1, 5,
+    1, 9, 5, 0, 4, 0, 1, 10, 1, 11, 1, 5,
+    1, 12, 2, 13, 1, 14, 5, 0, 3, 0, 1, 10,
+    1, 15, 1, 12, 2, 16, 1, 17, 1, 18, 1, 19,
+    2, 20, 3, 0, 3, 0, 1, 21, 1, 22, 2, 17,
+    1, 23, 1, 24, 1, 0, 1, 25, 1, 22, 1, 26,
+    1, 27, 2, 0, 2, 0, 1, 10, 1, 28, 1, 17,
+    1, 23, 1, 22, 1, 29, 2, 0, 1, 30, 1, 31,
+    1, 7, 1, 32, 1, 27, 1, 0, 2, 0, 1, 33,
+    3, 11, 1, 34, 3, 0, 1, 35, 2, 4, 1, 31,
+    1, 14, 1, 0, 1, 0, 1, 33, 1, 3, 1, 31,
+    1, 7, 1, 36, 1, 37, 3, 0, 1, 38, 2, 39,
+    1, 40, 1, 9, 1, 0, 1, 0, 1, 33, 3, 4,
+    1, 9, 4, 0, 1, 41, 1, 40, 2, 3, 1, 9,
+    1, 0, 1, 42, 1, 43, 1, 39, 1, 43, 1, 39,
+    1, 14, 4, 0, 1, 44, 2, 28, 1, 35, 1, 9,
+    1, 0, 1, 30, 2, 40, 1, 3, 1, 28, 1, 22,
+    4, 0, 1, 45, 1, 35, 2, 46, 1, 14, 1, 0,
+    1, 47, 1, 39, 1, 28, 2, 30, 1, 3, 1, 48,
+    2, 0, 1, 48, 1, 46, 1, 2, 1, 46, 1, 49,
+    1, 50, 1, 0, 1, 0, 1, 47, 1, 25, 1, 30,
+    2, 15, 1, 42, 1, 48, 1, 51, 1, 42, 1, 38,
+    1, 30, 1, 52, 1, 50, 2, 0, 2, 0, 1, 47,
+    1, 4, 1, 30, 2, 42, 1, 53, 1, 38, 1, 28,
+    1, 54, 1, 55, 1, 50, 3, 0, 3, 0, 1, 47,
+    1, 31, 1, 30, 1, 41, 1, 3, 1, 56, 1, 34,
+    1, 50, 5, 0, 4, 0, 1, 47, 1, 50, 1, 47,
+    2, 50, 7, 0, 16, 0, 8, 0, 1, 1, 1, 2,
+    1, 3, 1, 4, 4, 0, 6, 0, 2, 1, 1, 5,
+    1, 6, 1, 7, 1, 8, 1, 4, 3, 0, 4, 0,
+    2, 1, 1, 9, 1, 10, 1, 7, 1, 11, 1, 12,
+    1, 13, 1, 11, 1, 14, 2, 0, 3, 0, 1, 1,
+    1, 2, 1, 15, 1, 7, 1, 12, 1, 13, 1, 15,
+    2, 16, 1, 17, 1, 18, 2, 0, 3, 0, 1, 19,
+    1, 6, 1, 13, 1, 15, 1, 10, 1, 16, 1, 10,
+    1, 6, 1, 20, 1, 18, 3, 0, 3, 0, 1, 5,
+    2, 6, 1, 20, 1, 14, 1, 3, 1, 4, 1, 21,
+    1, 22, 1, 18, 3, 0, 4, 0, 1, 18, 1, 23,
+    1, 24, 1, 25, 1, 26, 1, 22, 1, 27, 1, 20,
+    1, 18, 3, 0, 7, 0, 1, 28, 2, 29, 1, 30,
+    1, 31, 4, 0, 6, 0, 1, 28, 1, 32, 1, 30,
+    1, 5, 1, 33, 1, 34, 4, 0, 6, 0, 1, 28,
+    1, 3, 1, 33, 1, 35, 1, 33, 1, 18, 4, 0,
+    6, 0, 1, 36, 1, 26, 2, 37, 1, 38, 1, 18,
+    4, 0, 5, 0, 1, 39, 1, 37, 2, 40, 1, 41,
+    1, 18, 5, 0, 5, 0, 1, 39, 1, 41, 1, 42,
+    1, 43, 1, 2, 1, 18, 5, 0, 5, 0, 1, 37,
+    1, 2, 1, 44, 1, 45, 1, 19, 1, 18, 5, 0,
+    5, 0, 1, 30, 1, 43, 1, 45, 1, 19, 1, 33,
+    1, 34, 5, 0, 6, 0, 1, 30, 2, 10, 1, 18,
+    6, 0, 16, 0, 5, 0, 1, 1, 1, 2, 1, 3,
+    1, 4, 1, 5, 1, 6, 5, 0, 3, 0, 2, 1,
+    1, 7, 2, 8, 1, 9, 1, 10, 1, 11, 1, 12,
+    4, 0, 1, 0, 2, 1, 1, 7, 2, 8, 1, 10,
+    1, 11, 2, 13, 1, 14, 1, 15, 1, 16, 3, 0,
+    1, 1, 1, 7, 2, 8, 1, 9, 1, 13, 1, 10,
+    1, 17, 1, 18, 1, 15, 1, 19, 1, 20, 1, 21,
+    1, 22, 2, 0, 1, 23, 1, 13, 1, 10, 1, 13,
+    1, 14, 1, 10, 1, 18, 1, 0, 1, 24, 2, 21,
+    1, 25, 1, 7, 1, 22, 2, 0, 1, 0, 1, 7,
+    2, 15, 1, 9, 1, 26, 1, 0, 1, 3, 1, 27,
+    1, 5, 1, 7, 1, 24, 1, 28, 3, 0, 2, 0,
+    2, 12, 1, 22, 1, 0, 1, 1, 1, 29, 1, 5,
+    1, 24, 1, 30, 1, 31, 4, 0, 5, 0, 1, 1,
+    1, 32, 1, 7, 1, 4, 1, 30, 1, 33, 5, 0,
+    4, 0, 1, 1, 1, 34, 1, 30, 1, 35, 1, 7,
+    1, 26, 6, 0, 3, 0, 1, 1, 1, 4, 1, 35,
+    1, 27, 1, 30, 1, 36, 1, 0, 1, 37, 1, 38,
+    1, 39, 3, 0, 2, 0, 1, 1, 1, 35, 2, 27,
+    1, 40, 1, 30, 1, 38, 1, 37, 2, 41, 1, 42,
+    1, 7, 2, 0, 1, 0, 1, 1, 1, 27, 1, 43,
+    1, 44, 2, 43, 1, 3, 1, 39, 1, 41, 1, 42,
+    1, 45, 1, 46, 1, 3, 1, 8, 1, 0, 1, 47,
+    1, 43, 1, 44, 1, 48, 1, 39, 1, 41, 2, 42,
+    1, 45, 1, 23, 1, 46, 1, 39, 1, 49, 2, 28,
+    1, 0, 1, 0, 1, 7, 1, 42, 1, 41, 1, 42,
+    1, 47, 1, 3, 1, 23, 1, 44, 4, 28, 3, 0,
+    2, 0, 1, 14, 1, 45, 1, 3, 1, 40, 2, 28,
+    1, 50, 7, 0, 3, 0, 1, 11, 2, 28, 10, 0,
+    16, 0, 6, 0, 1, 1, 1, 2, 1, 3, 1, 4,
+    1, 5, 5, 0, 4, 0, 1, 6, 1, 7, 1, 8,
+    1, 9, 2, 10, 1, 11, 1, 12, 4, 0, 2, 0,
+    1, 13, 1, 2, 1, 14, 1, 9, 1, 10, 1, 15,
+    3, 16, 1, 17, 1, 18, 3, 0, 1, 0, 1, 13,
+    1, 17, 1, 9, 1, 11, 1, 16, 1, 11, 1, 19,
+    1, 18, 2, 20, 1, 14, 1, 17, 1, 21, 2, 0,
+    1, 6, 1, 16, 1, 11, 1, 16, 1, 10, 1, 22,
+    1, 18, 1, 0, 1, 23, 1, 24, 1, 8, 1, 25,
+    1, 17, 1, 21, 2, 0, 1, 0, 1, 26, 1, 17,
+    1, 10, 1, 27, 2, 0, 1, 28, 1, 29, 1, 25,
+    1, 26, 1, 16, 1, 18, 3, 0, 2, 0, 1, 12,
+    1, 21, 2, 0, 1, 28, 1, 30, 1, 25, 1, 26,
+    1, 15, 1, 21, 4, 0, 5, 0, 1, 31, 1, 32,
+    1, 26, 1, 23, 1, 5, 1, 33, 5, 0, 6, 0,
+    1, 34, 1, 23, 2, 4, 1, 3, 1, 35, 4, 0,
+    2, 0, 1, 36, 1, 37, 1, 1, 2, 0, 1, 33,
+    1, 23, 1, 38, 1, 39, 1, 38, 1, 15, 3, 0,
+    1, 0, 1, 28, 1, 38, 1, 3, 1, 29, 1, 40,
+    2, 0, 1, 41, 1, 42, 1, 43, 1, 44, 1, 43,
+    1, 20, 2, 0, 1, 6, 1, 45, 1, 38, 3, 45,
+    1, 40, 1, 46, 1, 0, 1, 47, 1, 2, 1, 42,
+    1, 48, 1, 42, 1, 49, 1, 0, 1, 0, 1, 20,
+    1, 45, 1, 44, 1, 43, 1, 44, 1, 43, 1, 7,
+    1, 1, 1, 50, 1, 7, 1, 51, 1, 7, 1, 52,
+    2, 0, 2, 0, 1, 16, 1, 14, 1, 44, 4, 7,
+    1, 48, 1, 6, 1, 42, 1, 53, 3, 0, 4, 0,
+    1, 16, 1, 17, 1, 44, 2, 6, 1, 40, 1, 44,
+    1, 54, 4, 0, 6, 0, 1, 11, 3, 55, 1, 56,
+    5, 0, 16, 0, 7, 0, 1, 1, 1, 2, 1, 3,
+    6, 0, 6, 0, 1, 1, 1, 4, 1, 5, 1, 6,
+    1, 7, 5, 0, 5, 0, 1, 1, 1, 8, 1, 9,
+    1, 10, 1, 11, 1, 9, 1, 12, 4, 0, 4, 0,
+    1, 1, 1, 11, 1, 10, 1, 11, 1, 8, 1, 13,
+    1, 12, 5, 0, 3, 0, 1, 14, 1, 15, 1, 11,
+    1, 8, 2, 7, 1, 16, 6, 0, 3, 0, 1, 14,
+    1, 8, 1, 7, 1, 17, 1, 8, 1, 18, 1, 19,
+    1, 6, 5, 0, 2, 0, 1, 14, 1, 20, 1, 17,
+    1, 18, 1, 8, 1, 21, 3, 22, 1, 21, 4, 0,
+    2, 0, 1, 14, 1, 18, 2, 19, 1, 23, 1, 24,
+    2, 25, 1, 26, 1, 27, 4, 0, 1, 0, 1, 14,
+    1, 26, 1, 22, 1, 3, 1, 21, 1, 0, 1, 28,
+    2, 29, 1, 30, 1, 31, 1, 32, 1, 33, 2, 0,
+    1, 0, 1, 14, 1, 3, 1, 25, 1, 26, 1, 7,
+    2, 34, 2, 35, 1, 36, 2, 37, 1, 38, 2, 0,
+    1, 39, 1, 26, 2, 29, 1, 30, 1, 35, 1, 30,
+    1, 35, 2, 37, 1, 2, 2, 40, 1, 38, 2, 0,
+    1, 41, 1, 25, 1, 36, 1, 37, 1, 31, 1, 39,
+    2, 31, 2, 39, 3, 23, 1, 21, 2, 0, 1, 0,
+    5, 41, 1, 30, 2, 2, 1, 42, 1, 23, 5, 0,
+    6, 0, 1, 43, 1, 42, 1, 44, 1, 40, 1, 41,
+    5, 0, 6, 0, 1, 43, 1, 45, 1, 2, 1, 46,
+    6, 0, 6, 0, 1, 18, 2, 47, 7, 0, 16, 0,
+    4, 0, 1, 1, 1, 2, 1, 3, 1, 4, 2, 5,
+    1, 6, 1, 7, 4, 0, 3, 0, 1, 8, 1, 9,
+    1, 10, 1, 11, 1, 12, 1, 13, 1, 14, 1, 15,
+    1, 16, 1, 17, 3, 0, 3, 0, 1, 8, 1, 18,
+    1, 12, 1, 14, 1, 15, 1, 16, 1, 19, 1, 20,
+    1, 21, 1, 18, 1, 22, 2, 0, 2, 0, 1, 8,
+    1, 23, 1, 13, 1, 15, 1, 24, 6, 25, 1, 26,
+    2, 0, 2, 0, 1, 8, 1, 27, 1, 16, 1, 20,
+    1, 25, 9, 0, 1, 0, 1, 8, 1, 28, 1, 16,
+    1, 20, 1, 29, 1, 25, 2, 8, 1, 4, 1, 18,
+    5, 0, 1, 0, 1, 8, 1, 18, 1, 21, 2, 27,
+    1, 30, 1, 5, 1, 31, 1, 32, 1, 33, 1, 34,
+    4, 0, 1, 30, 1, 7, 1, 27, 1, 18, 1, 35,
+    1, 36, 1, 7, 1, 37, 1, 38, 1, 37, 1, 7,
+    1, 39, 1, 40, 3, 0, 1, 18, 1, 27, 1, 10,
+    1, 38, 1, 37, 1, 36, 1, 38, 1, 27, 2, 41,
+    1, 36, 2, 28, 1, 42, 2, 0, 1, 0, 1, 43,
+    1, 18, 1, 37, 1, 10, 1, 21, 2, 44, 2, 0,
+    1, 20, 1, 45, 1, 23, 1, 46, 1, 11, 1, 0,
+    2, 0, 1, 41, 3, 47, 2, 0, 2, 8, 1, 48,
+    1, 5, 2, 48, 1, 49, 1, 0, 6, 0, 2, 8,
+    1, 50, 1, 23, 1, 5, 2, 51, 1, 49, 2, 0,
+    3, 0, 3, 8, 1, 46, 1, 23, 1, 46, 1, 48,
+    2, 52, 1, 49, 3, 0, 3, 0, 1, 37, 2, 5,
+    1, 46, 1, 48, 1, 51, 2, 46, 1, 49, 4, 0,
+    4, 0, 1, 53, 1, 23, 2, 54, 1, 23, 2, 49,
+    5, 0, 5, 0, 1, 55, 1, 56, 1, 57, 1, 58,
+    7, 0, 16, 0, 6, 0, 1, 1, 1, 2, 1, 3,
+    1, 4, 6, 0, 5, 0, 1, 5, 1, 6, 1, 7,
+    1, 8, 1, 9, 1, 10, 5, 0, 4, 0, 1, 11,
+    1, 12, 1, 8, 2, 13, 1, 14, 1, 15, 5, 0,
+    3, 0, 1, 5, 1, 16, 1, 9, 1, 17, 1, 14,
+    1, 18, 1, 15, 6, 0, 3, 0, 1, 19, 1, 18,
+    2, 14, 1, 18, 1, 15, 7, 0, 2, 0, 1, 5,
+    1, 20, 1, 14, 1, 18, 1, 12, 1, 21, 2, 15,
+    1, 22, 5, 0, 2, 0, 1, 23, 1, 12, 1, 24,
+    3, 21, 2, 25, 1, 6, 1, 26, 4, 0, 1, 0,
+    1, 5, 1, 27, 1, 12, 1, 6, 1, 17, 1, 28,
+    1, 10, 1, 17, 1, 29, 1, 27, 1, 4, 1, 30,
+    3, 0, 1, 0, 1, 31, 1, 21, 1, 6, 1, 17,
+    1, 28, 2, 0, 1, 32, 2, 33, 1, 34, 1, 20,
+    1, 35, 2, 0, 1, 31, 1, 29, 1, 36, 1, 25,
+    1, 28, 4, 0, 1, 37, 1, 34, 1, 38, 1, 39,
+    1, 3, 1, 40, 1, 0, 1, 31, 1, 25, 1, 4,
+    1, 29, 1, 41, 4, 0, 1, 42, 1, 39, 1, 3,
+    2, 43, 1, 30, 1, 0, 2, 4, 1, 20, 1, 33,
+    1, 34, 1, 44, 2, 0, 1, 45, 1, 39, 1, 43,
+    2, 44, 1, 46, 1, 22, 1, 0, 1, 0, 1, 17,
+    2, 39, 2, 38, 1, 47, 1, 48, 1, 3, 1, 44,
+    2, 31, 1, 23, 1, 22, 2, 0, 2, 0, 1, 17,
+    2, 43, 2, 3, 1, 44, 1, 31, 2, 46, 1, 49,
+    1, 22, 3, 0, 3, 0, 1, 17, 2, 31, 2, 46,
+    1, 23, 2, 49, 1, 22, 4, 0, 4, 0, 1, 17,
+    1, 9, 1, 50, 3, 28, 1, 22, 5, 0, 16, 0,
+    4, 0, 1, 1, 2, 2, 1, 3, 2, 4, 2, 5,
+    1, 6, 3, 0, 3, 0, 1, 1, 1, 7, 2, 8,
+    1, 9, 2, 10, 1, 11, 1, 12, 1, 13, 1, 14,
+    2, 0, 2, 0, 1, 1, 1, 15, 1, 9, 1, 10,
+    1, 11, 1, 12, 1, 13, 1, 12, 1, 13, 1, 16,
+    1, 17, 1, 13, 1, 14, 1, 0, 1, 0, 1, 1,
+    1, 17, 2, 11, 1, 13, 1, 18, 1, 19, 1, 20,
+    1, 6, 1, 17, 1, 21, 1, 22, 1, 13, 1, 14,
+    1, 0, 1, 23, 1, 17, 1, 11, 1, 13, 1, 16,
+    1, 10, 1, 14, 1, 0, 1, 24, 1, 25, 1, 22,
+    1, 7, 1, 26, 1, 14, 2, 0, 1, 27, 2, 16,
+    1, 17, 1, 10, 1, 14, 1, 0, 1, 24, 1, 28,
+    1, 7, 1, 29, 1, 6, 1, 14, 3, 0, 1, 0,
+    1, 30, 1, 21, 1, 10, 1, 14, 1, 0, 1, 24,
+    1, 31, 1, 29, 2, 6, 1, 14, 4, 0, 2, 0,
+    1, 32, 1, 14, 2, 0, 1, 24, 2, 33, 1, 34,
+    1, 35, 5, 0, 5, 0, 1, 24, 1, 36, 1, 34,
+    2, 25, 1, 14, 5, 0, 5, 0, 1, 24, 1, 25,
+    1, 28, 1, 37, 1, 6, 1, 14, 5, 0, 4, 0,
+    1, 24, 1, 3, 2, 38, 1, 39, 1, 14, 6, 0,
+    4, 0, 1, 40, 1, 38, 1, 39, 1, 5, 1, 3,
+    1, 14, 6, 0, 3, 0, 1, 24, 1, 3, 2, 30,
+    1, 3, 1, 37, 1, 14, 6, 0, 3, 0, 1, 24,
+    1, 3, 1, 4, 1, 41, 1, 42, 1, 43, 7, 0,
+    3, 0, 1, 44, 2, 42, 1, 45, 1, 25, 1, 14,
+    7, 0, 4, 0, 1, 7, 1, 46, 1, 47, 1, 14,
+    8, 0, 16, 0, 3, 0, 1, 1, 1, 2, 2, 3,
+    2, 4, 1, 5, 1, 6, 5, 0, 2, 0, 1, 1,
+    4, 7, 1, 8, 2, 9, 1, 10, 1, 11, 1, 12,
+    3, 0, 1, 0, 1, 1, 2, 7, 4, 8, 1, 9,
+    1, 13, 2, 14, 1, 15, 1, 16, 2, 0, 1, 1,
+    2, 7, 1, 10, 1, 17, 5, 6, 1, 17, 1, 18,
+    1, 19, 1, 14, 1, 20, 1, 0, 1, 4, 1, 8,
+    2, 15, 1, 6, 3, 0, 1, 1, 1, 3, 1, 19,
+    1, 17, 1, 14, 1, 20, 2, 0, 1, 0, 1, 21,
+    2, 14, 1, 22, 2, 0, 1, 1, 3, 23, 1, 24,
+    1, 20, 3, 0, 2, 0, 1, 11, 2, 25, 2, 3,
+    3, 23, 1, 26, 1, 12, 4, 0, 3, 0, 1, 9,
+    3, 27, 1, 26, 2, 23, 1, 12, 5, 0, 2, 0,
+    1, 28, 1, 27, 3, 5, 1, 26, 1, 5, 2, 29,
+    1, 24, 1, 30, 3, 0, 1, 0, 1, 1, 1, 5,
+    1, 23, 2, 29, 3, 6, 1, 31, 2, 32, 1, 23,
+    1, 10, 2, 0, 1, 33, 1, 5, 1, 29, 1, 34,
+    1, 5, 1, 6, 3, 0, 1, 35, 1, 4, 1, 36,
+    1, 37, 1, 38, 1, 8, 1, 0, 1, 14, 1, 38,
+    1, 39, 1, 38, 1, 5, 1, 40, 2, 0, 1, 35,
+    1, 4, 1, 37, 1, 41, 2, 37, 1, 12, 1, 0,
+    1, 0, 1, 18, 1, 32, 2, 36, 1, 41, 2, 35,
+    1, 36, 1, 41, 1, 33, 1, 41, 1, 42, 1, 12,
+    2, 0, 2, 0, 2, 25, 1, 4, 2, 33, 1, 41,
+    1, 33, 1, 42, 1, 33, 1, 43, 1, 12, 3, 0,
+    4, 0, 1, 13, 1, 44, 1, 4, 3, 45, 1, 4,
+    1, 12, 4, 0, 6, 0, 1, 15, 2, 46, 1, 47,
+    1, 12, 5, 0, 16, 0, 3, 0, 1, 1, 3, 2,
+    2, 3, 1, 4, 1, 5, 5, 0, 2, 0, 1, 6,
+    1, 7, 2, 8, 1, 9, 2, 10, 2, 11, 1, 12,
+    1, 13, 3, 0, 1, 0, 1, 14, 1, 15, 1, 9,
+    1, 10, 1, 16, 2, 9, 1, 15, 1, 7, 2, 17,
+    1, 18, 1, 19, 2, 0, 1, 6, 1, 20, 1, 10,
+    1, 11, 1, 18, 4, 21, 1, 22, 2, 23, 2, 17,
+    1, 24, 1, 0, 1, 25, 2, 18, 1, 15, 1, 7,
+    1, 21, 3, 0, 1, 21, 1, 15, 1, 17, 1, 26,
+    1, 17, 1, 16, 1, 0, 1, 27, 1, 15, 1, 7,
+    1, 17, 1, 26, 1, 21, 3, 0, 1, 28, 1, 20,
+    1, 15, 1, 19, 1, 16, 2, 0, 1, 29, 1, 17,
+    2, 26, 1, 23, 1, 30, 2, 31, 1, 32, 1, 33,
+    2, 34, 1, 21, 3, 0, 1, 35, 1, 15, 1, 23,
+    3, 20, 1, 5, 1, 36, 1, 37, 1, 38, 1, 39,
+    1, 40, 1, 21, 3, 0, 1, 0, 1, 13, 1, 15,
+    1, 35, 2, 20, 1, 5, 1, 34, 1, 39, 1, 36,
+    1, 33, 1, 12, 4, 0, 2, 0, 4, 13, 1, 35,
+    1, 36, 1, 33, 1, 4, 1, 41, 1, 21, 4, 0,
+    6, 0, 1, 42, 1, 4, 1, 28, 1, 43, 1, 21,
+    5, 0, 5, 0, 1, 32, 1, 4, 1, 43, 2, 27,
+    1, 13, 5, 0, 4, 0, 1, 32, 1, 44, 1, 27,
+    2, 3, 1, 41, 1, 13, 5, 0, 4, 0, 1, 44,
+    1, 3, 2, 42, 1, 31, 1, 21, 6, 0, 5, 0,
+    1, 23, 1, 31, 1, 45, 1, 28, 1, 21, 6, 0,
+    6, 0, 2, 18, 1, 46, 7, 0, 16, 0, 16, 0,
+    16, 0, 7, 0, 1, 1, 1, 2, 7, 0, 6, 0,
+    1, 3, 1, 4, 1, 5, 1, 6, 6, 0, 5, 0,
+    1, 7, 1, 8, 1, 9, 1, 10, 1, 11, 1, 12,
+    5, 0, 5, 0, 1, 13, 1, 14, 1, 15, 1, 16,
+    1, 17, 1, 18, 5, 0, 6, 0, 1, 19, 1, 20,
+    1, 21, 1, 22, 6, 0, 7, 0, 1, 23, 1, 24,
+    7, 0, 6, 0, 1, 25, 1, 26, 1, 27, 1, 28,
+    6, 0, 5, 0, 1, 29, 1, 30, 1, 31, 1, 32,
+    1, 33, 1, 34, 5, 0, 5, 0, 1, 35, 1, 36,
+    1, 37, 1, 38, 1, 39, 1, 40, 5, 0, 5, 0,
+    1, 41, 1, 42, 1, 43, 1, 44, 1, 45, 1, 46,
+    5, 0, 6, 0, 1, 47, 1, 48, 1, 49, 1, 50,
+    6, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 7, 0, 1, 1, 1, 2, 7, 0, 6, 0,
+    1, 3, 1, 4, 1, 5, 1, 6, 6, 0, 5, 0,
+    1, 7, 1, 8, 1, 9, 1, 10, 1, 11, 1, 12,
+    5, 0, 5, 0, 1, 13, 1, 14, 1, 15, 1, 16,
+    1, 17, 1, 18, 5, 0, 6, 0, 1, 19, 1, 20,
+    1, 21, 1, 22, 6, 0, 7, 0, 1, 23, 1, 24,
+    7, 0, 6, 0, 1, 25, 1, 26, 1, 27, 1, 28,
+    6, 0, 5, 0, 1, 29, 1, 30, 1, 31, 1, 32,
+    1, 33, 1, 34, 5, 0, 5, 0, 1, 35, 1, 36,
+    1, 37, 1, 38, 1, 39, 1, 40, 5, 0, 5, 0,
+    1, 41, 1, 42, 1, 43, 1, 44, 1, 45, 1, 46,
+    5, 0, 6, 0, 1, 47, 1, 48, 1, 49, 1, 50,
+    1, 51, 5, 0, 7, 0, 1, 52, 1, 53, 1, 54,
+    6, 0, 6, 0, 1, 55, 1, 56, 1, 57, 7, 0,
+    6, 0, 1, 58, 1, 59, 8, 0, 16, 0, 16, 0,
+    16, 0, 10, 0, 2, 1, 4, 0, 9, 0, 2, 1,
+    5, 0, 7, 0, 3, 1, 6, 0, 6, 0, 2, 1,
+    8, 0, 5, 0, 1, 1, 10, 0, 3, 0, 2, 1,
+    11, 0, 2, 0, 2, 1, 12, 0, 3, 0, 3, 1,
+    10, 0, 5, 0, 1, 1, 10, 0, 6, 0, 2, 1,
+    8, 0, 8, 0, 3, 1, 5, 0, 10, 0, 2, 1,
+    4, 0, 16, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 13, 1, 3, 0, 13, 1, 3, 0, 13, 1,
+    3, 0, 13, 1, 3, 0, 13, 1, 3, 0, 13, 1,
+    3, 0, 16, 0, 13, 1, 3, 0, 13, 1, 3, 0,
+    13, 1, 3, 0, 13, 1, 3, 0, 13, 1, 3, 0,
+    13, 1, 3, 0, 16, 0, 16, 0, 16, 0, 4, 0,
+    3, 1, 9, 0, 7, 0, 2, 1, 7, 0, 8, 0,
+    2, 1, 6, 0, 9, 0, 2, 1, 5, 0, 10, 0,
+    2, 1, 4, 0, 11, 0, 2, 1, 3, 0, 9, 0,
+    2, 1, 5, 0, 7, 0, 2, 1, 7, 0, 6, 0,
+    2, 1, 8, 0, 5, 0, 2, 1, 9, 0, 4, 0,
+    2, 1, 10, 0, 16, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 4, 0, 1, 1, 1, 2, 1, 3, 1, 4,
+    1, 5, 1, 6, 1, 7, 5, 0, 3, 0, 1, 8,
+    1, 9, 1, 10, 1, 11, 1, 12, 1, 13, 1, 14,
+    1, 15, 1, 16, 4, 0, 2, 0, 1, 17, 1, 18,
+    1, 19, 1, 20, 1, 21, 1, 22, 1, 23, 1, 24,
+    1, 25, 1, 26, 1, 27, 3, 0, 2, 0, 1, 28,
+    1, 29, 1, 30, 1, 31, 1, 32, 1, 33, 1, 34,
+    1, 35, 1, 36, 1, 37, 1, 38, 3, 0, 3, 0,
+    1, 39, 1, 40, 1, 41, 1, 42, 1, 43, 1, 44,
+    1, 45, 1, 46, 1, 47, 1, 48, 3, 0, 4, 0,
+    1, 49, 1, 50, 1, 51, 1, 52, 1, 53, 1, 54,
+    1, 55, 1, 56, 1, 57, 1, 58, 2, 0, 5, 0,
+    1, 59, 1, 60, 1, 61, 1, 62, 1, 63, 1, 64,
+    1, 65, 1, 66, 3, 0, 5, 0, 1, 67, 1, 68,
+    1, 69, 1, 70, 1, 71, 1, 72, 1, 73, 1, 28,
+    3, 0, 5, 0, 1, 74, 1, 75, 1, 76, 1, 77,
+    1, 78, 1, 79, 5, 0, 5, 0, 1, 80, 1, 81,
+    1, 82, 1, 83, 1, 84, 1, 85, 5, 0, 5, 0,
+    1, 86, 1, 87, 1, 88, 1, 89, 1, 90, 6, 0,
+    5, 0, 1, 91, 1, 92, 1, 93, 1, 94, 1, 95,
+    6, 0, 5, 0, 1, 96, 1, 97, 1, 98, 1, 99,
+    1, 100, 6, 0, 5, 0, 1, 101, 1, 102, 1, 103,
+    1, 104, 1, 105, 6, 0, 5, 0, 1, 106, 1, 107,
+    1, 108, 1, 109, 1, 105, 6, 0, 5, 0, 1, 110,
+    1, 111, 1, 112, 1, 113, 1, 114, 6, 0, 16, 0,
+    16, 0, 9, 0, 3, 1, 4, 0, 5, 0, 4, 1,
+    3, 0, 3, 1, 1, 0, 3, 0, 3, 1, 8, 0,
+    1, 1, 1, 0, 2, 0, 2, 1, 2, 0, 3, 1,
+    6, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1,
+    3, 0, 2, 1, 3, 0, 2, 1, 2, 0, 2, 1,
+    1, 0, 1, 1, 4, 0, 1, 1, 3, 0, 1, 1,
+    1, 0, 3, 0, 1, 1, 1, 0, 1, 1, 8, 0,
+    1, 1, 1, 0, 3, 0, 3, 1, 8, 0, 1, 1,
+    1, 0, 4, 0, 3, 1, 6, 0, 2, 1, 1, 0,
+    4, 0, 1, 1, 2, 0, 7, 1, 2, 0, 5, 0,
+    1, 1, 10, 0, 6, 0, 1, 1, 9, 0, 7, 0,
+    2, 1, 7, 0, 9, 0, 2, 1, 5, 0, 16, 0,
+    6, 0, 1, 1, 1, 2, 8, 0, 6, 0, 1, 3,
+    1, 4, 1, 5, 7, 0, 5, 0, 1, 6, 1, 7,
+    1, 8, 1, 9, 7, 0, 5, 0, 1, 10, 1, 11,
+    1, 12, 1, 13, 1, 14, 6, 0, 4, 0, 1, 15,
+    1, 16, 1, 17, 1, 18, 1, 19, 1, 20, 6, 0,
+    4, 0, 1, 21, 1, 22, 1, 23, 1, 24, 1, 25,
+    1, 26, 1, 27, 5, 0, 4, 0, 1, 28, 1, 29,
+    1, 30, 1, 31, 1, 32, 1, 33, 1, 34, 5, 0,
+    3, 0, 1, 35, 1, 36, 1, 37, 1, 38, 1, 39,
+    1, 40, 1, 41, 1, 42, 1, 43, 4, 0, 3, 0,
+    1, 44, 1, 45, 1, 46, 1, 47, 1, 48, 1, 49,
+    1, 50, 1, 51, 1, 52, 4, 0, 2, 0, 1, 53,
+    1, 54, 1, 55, 1, 56, 1, 51, 1, 57, 1, 58,
+    1, 59, 1, 60, 1, 61, 1, 62, 3, 0, 2, 0,
+    1, 63, 1, 64, 1, 65, 1, 66, 1, 67, 1, 68,
+    1, 69, 1, 70, 1, 71, 1, 72, 1, 73, 1, 74,
+    2, 0, 2, 0, 1, 75, 1, 76, 1, 77, 1, 78,
+    1, 79, 1, 80, 1, 81, 1, 82, 1, 83, 1, 84,
+    1, 85, 1, 86, 2, 0, 1, 0, 1, 87, 1, 88,
+    1, 89, 1, 90, 1, 91, 1, 92, 1, 93, 1, 94,
+    1, 95, 1, 96, 1, 97, 1, 98, 1, 99, 1, 100,
+    1, 0, 1, 0, 1, 101, 1, 102, 1, 103, 1, 104,
+    1, 105, 1, 106, 1, 107, 1, 0, 1, 108, 1, 109,
+    1, 110, 1, 111, 1, 112, 2, 0, 2, 0, 1, 113,
+    1, 114, 1, 115, 1, 116, 1, 117, 2, 0, 1, 118,
+    1, 119, 1, 120, 1, 121, 3, 0, 3, 0, 1, 122,
+    1, 123, 1, 124, 4, 0, 1, 125, 1, 126, 4, 0,
+    4, 0, 1, 127, 1, 128, 10, 0, 3, 0, 1, 1,
+    1, 2, 1, 3, 1, 4, 1, 5, 1, 6, 1, 7,
+    6, 0, 3, 0, 1, 8, 1, 9, 1, 10, 1, 11,
+    1, 12, 1, 13, 1, 14, 1, 15, 1, 16, 4, 0,
+    3, 0, 1, 17, 1, 18, 1, 19, 1, 20, 1, 21,
+    1, 22, 1, 23, 1, 24, 1, 25, 4, 0, 3, 0,
+    1, 26, 1, 27, 1, 28, 1, 29, 1, 30, 1, 31,
+    1, 32, 1, 33, 1, 34, 1, 35, 3, 0, 3, 0,
+    1, 36, 1, 37, 1, 38, 1, 39, 1, 40, 1, 41,
+    1, 42, 1, 43, 1, 44, 1, 45, 1, 46, 2, 0,
+    3, 0, 1, 47, 1, 48, 1, 49, 1, 50, 1, 51,
+    1, 52, 1, 53, 1, 54, 1, 55, 1, 56, 1, 57,
+    2, 0, 3, 0, 1, 58, 1, 59, 1, 60, 1, 61,
+    1, 62, 1, 63, 1, 64, 1, 65, 1, 66, 1, 67,
+    3, 0, 3, 0, 1, 68, 1, 69, 1, 70, 1, 71,
+    1, 72, 1, 73, 1, 74, 1, 75, 1, 76, 4, 0,
+    2, 0, 1, 77, 1, 78, 1, 79, 1, 80, 1, 81,
+    1, 82, 1, 83, 1, 84, 1, 85, 1, 86, 4, 0,
+    2, 0, 1, 87, 1, 88, 1, 89, 1, 90, 1, 91,
+    1, 92, 1, 93, 1, 94, 1, 95, 1, 96, 4, 0,
+    2, 0, 1, 97, 1, 98, 1, 99, 1, 100, 1, 101,
+    1, 102, 1, 103, 1, 104, 1, 105, 1, 106, 4, 0,
+    2, 0, 1, 107, 1, 108, 1, 109, 1, 110, 1, 111,
+    1, 112, 1, 113, 1, 114, 1, 115, 1, 116, 4, 0,
+    2, 0, 1, 117, 1, 118, 1, 119, 1, 120, 1, 121,
+    2, 119, 1, 122, 1, 123, 1, 124, 4, 0, 2, 0,
+    1, 125, 1, 126, 1, 127, 1, 128, 1, 129, 1, 130,
+    1, 131, 1, 132, 1, 133, 1, 134, 4, 0, 2, 0,
+    1, 135, 1, 136, 1, 137, 1, 138, 1, 139, 1, 140,
+    1, 141, 1, 142, 1, 143, 1, 144, 4, 0, 3, 0,
+    1, 145, 1, 146, 1, 147, 1, 148, 1, 149, 1, 150,
+    1, 151, 1, 152, 5, 0, 4, 0, 1, 153, 1, 154,
+    1, 155, 1, 156, 8, 0, 8, 0, 1, 1, 1, 2,
+    1, 3, 1, 4, 4, 0, 7, 0, 1, 5, 1, 6,
+    1, 7, 1, 8, 1, 9, 1, 10, 3, 0, 6, 0,
+    1, 11, 1, 12, 1, 13, 1, 14, 1, 15, 1, 16,
+    1, 17, 3, 0, 5, 0, 1, 18, 1, 19, 1, 20,
+    1, 21, 1, 22, 1, 23, 1, 24, 1, 25, 3, 0,
+    4, 0, 1, 26, 1, 27, 1, 28, 1, 29, 1, 30,
+    1, 31, 1, 32, 1, 33, 1, 34, 3, 0, 4, 0,
+    1, 35, 1, 36, 1, 37, 1, 38, 1, 39, 1, 40,
+    1, 41, 1, 42, 1, 43, 3, 0, 3, 0, 1, 44,
+    1, 45, 1, 46, 1, 47, 1, 48, 1, 49, 1, 50,
+    1, 51, 1, 52, 1, 53, 3, 0, 3, 0, 1, 54,
+    1, 55, 1, 56, 1, 57, 1, 58, 1, 59, 1, 60,
+    6, 0, 3, 0, 1, 54, 1, 61, 1, 62, 1, 63,
+    1, 64, 1, 65, 1, 66, 6, 0, 3, 0, 1, 67,
+    1, 68, 1, 69, 1, 70, 1, 71, 1, 72, 7, 0,
+    4, 0, 1, 73, 1, 74, 1, 75, 1, 76, 1, 77,
+    1, 78, 1, 79, 1, 80, 4, 0, 4, 0, 1, 81,
+    1, 82, 1, 83, 1, 84, 1, 85, 1, 86, 1, 87,
+    1, 88, 1, 89, 3, 0, 4, 0, 1, 90, 1, 91,
+    1, 92, 1, 93, 1, 94, 1, 95, 1, 96, 1, 97,
+    1, 98, 3, 0, 5, 0, 1, 99, 1, 100, 1, 101,
+    1, 102, 1, 103, 1, 104, 1, 105, 1, 106, 3, 0,
+    6, 0, 1, 107, 1, 108, 1, 109, 1, 110, 1, 111,
+    1, 112, 1, 113, 3, 0, 7, 0, 1, 114, 1, 115,
+    1, 116, 1, 117, 1, 118, 1, 119, 3, 0, 8, 0,
+    1, 120, 7, 0, 4, 0, 1, 1, 1, 2, 1, 3,
+    1, 4, 8, 0, 4, 0, 1, 5, 1, 6, 1, 7,
+    1, 8, 1, 9, 1, 10, 6, 0, 4, 0, 1, 11,
+    1, 12, 1, 13, 1, 14, 1, 15, 1, 16, 1, 17,
+    5, 0, 4, 0, 1, 18, 1, 19, 1, 20, 1, 21,
+    1, 22, 1, 23, 1, 24, 1, 25, 4, 0, 4, 0,
+    1, 26, 1, 27, 1, 28, 1, 29, 1, 30, 1, 31,
+    1, 32, 1, 33, 4, 0, 3, 0, 1, 34, 1, 35,
+    1, 36, 1, 37, 1, 38, 1, 39, 1, 40, 1, 41,
+    1, 42, 1, 43, 3, 0, 3, 0, 1, 44, 1, 45,
+    1, 46, 1, 47, 1, 48, 1, 49, 1, 50, 1, 51,
+    1, 52, 1, 53, 3, 0, 3, 0, 1, 54, 1, 55,
+    1, 56, 1, 57, 1, 58, 1, 59, 1, 60, 1, 51,
+    1, 61, 1, 62, 3, 0, 3, 0, 1, 63, 1, 64,
+    1, 65, 1, 66, 1, 67, 1, 68, 1, 69, 1, 70,
+    1, 71, 1, 72, 3, 0, 3, 0, 1, 73, 1, 74,
+    1, 75, 1, 76, 1, 77, 1, 78, 1, 79, 1, 80,
+    1, 81, 1, 82, 3, 0, 3, 0, 1, 83, 1, 84,
+    1, 85, 1, 86, 1, 87, 1, 88, 1, 89, 1, 90,
+    1, 91, 1, 92, 3, 0, 2, 0, 1, 93, 1, 94,
+    1, 95, 1, 96, 1, 97, 1, 98, 1, 99, 1, 100,
+    1, 101, 1, 102, 4, 0, 2, 0, 1, 103, 1, 104,
+    1, 105, 1, 106, 1, 107, 1, 108, 1, 109, 1, 110,
+    1, 111, 1, 112, 4, 0, 2, 0, 1, 113, 1, 114,
+    1, 115, 1, 116, 1, 117, 1, 118, 1, 119, 1, 120,
+    1, 121, 5, 0, 2, 0, 1, 122, 1, 123, 1, 124,
+    1, 125, 1, 126, 1, 127, 1, 128, 1, 129, 6, 0,
+    3, 0, 1, 130, 1, 131, 1, 132, 1, 133, 1, 134,
+    8, 0, 16, 0, 6, 0, 1, 1, 1, 2, 1, 3,
+    1, 4, 1, 5, 1, 6, 1, 7, 3, 0, 5, 0,
+    1, 8, 1, 9, 1, 10, 1, 11, 1, 12, 1, 13,
+    1, 14, 1, 15, 3, 0, 4, 0, 1, 16, 1, 17,
+    1, 18, 1, 19, 1, 20, 1, 21, 1, 22, 1, 14,
+    1, 23, 3, 0, 3, 0, 1, 24, 1, 25, 1, 26,
+    1, 27, 1, 28, 1, 29, 1, 30, 1, 31, 1, 32,
+    1, 33, 3, 0, 3, 0, 1, 34, 1, 35, 1, 36,
+    1, 37, 1, 38, 1, 39, 1, 40, 1, 41, 1, 42,
+    1, 43, 3, 0, 3, 0, 1, 44, 1, 45, 1, 46,
+    1, 47, 1, 48, 1, 49, 1, 50, 1, 51, 1, 52,
+    1, 53, 3, 0, 3, 0, 1, 54, 1, 55, 1, 56,
+    1, 57, 3, 58, 1, 59, 1, 60, 4, 0, 3, 0,
+    1, 61, 1, 62, 1, 63, 1, 64, 1, 65, 1, 66,
+    1, 67, 1, 68, 1, 69, 4, 0, 3, 0, 1, 70,
+    1, 71, 1, 72, 1, 73, 1, 74, 1, 75, 1, 76,
+    1, 77, 1, 78, 4, 0, 3, 0, 1, 79, 1, 80,
+    1, 81, 1, 82, 1, 83, 1, 84, 1, 85, 1, 86,
+    1, 87, 4, 0, 3, 0, 1, 88, 1, 89, 1, 90,
+    1, 91, 1, 92, 1, 93, 1, 94, 1, 95, 1, 96,
+    4, 0, 3, 0, 1, 97, 1, 98, 1, 99, 1, 100,
+    1, 101, 1, 102, 1, 103, 1, 104, 1, 105, 4, 0,
+    4, 0, 1, 106, 1, 107, 1, 108, 1, 109, 1, 110,
+    1, 111, 1, 112, 1, 113, 4, 0, 4, 0, 1, 114,
+    1, 115, 1, 116, 1, 117, 1, 118, 1, 119, 1, 120,
+    1, 121, 4, 0, 4, 0, 1, 122, 1, 123, 1, 124,
+    1, 125, 1, 126, 1, 127, 1, 128, 5, 0, 6, 0,
+    1, 129, 1, 130, 1, 131, 1, 132, 1, 133, 5, 0,
+    16, 0, 8, 0, 1, 1, 1, 2, 1, 3, 1, 4,
+    4, 0, 3, 0, 1, 5, 1, 6, 1, 7, 1, 8,
+    1, 9, 1, 10, 1, 11, 1, 12, 1, 13, 4, 0,
+    3, 0, 1, 14, 1, 15, 1, 16, 1, 17, 1, 18,
+    1, 19, 1, 20, 1, 21, 1, 22, 1, 23, 3, 0,
+    4, 0, 1, 24, 1, 25, 1, 26, 1, 27, 1, 28,
+    1, 29, 1, 30, 1, 31, 1, 32, 3, 0, 4, 0,
+    1, 33, 1, 34, 1, 35, 1, 36, 1, 37, 1, 38,
+    1, 39, 1, 40, 1, 41, 3, 0, 4, 0, 1, 42,
+    1, 43, 1, 44, 1, 45, 1, 46, 1, 47, 1, 48,
+    1, 0, 1, 49, 3, 0, 4, 0, 1, 50, 1, 51,
+    1, 52, 1, 53, 1, 54, 1, 55, 1, 56, 1, 57,
+    4, 0, 4, 0, 1, 58, 1, 59, 1, 60, 1, 61,
+    1, 62, 1, 63, 1, 64, 1, 65, 4, 0, 4, 0,
+    1, 66, 1, 67, 1, 68, 1, 69, 1, 70, 1, 71,
+    1, 72, 1, 73, 4, 0, 4, 0, 1, 74, 1, 75,
+    1, 76, 1, 77, 1, 78, 1, 79, 1, 80, 1, 81,
+    4, 0, 4, 0, 1, 82, 1, 83, 1, 84, 1, 85,
+    1, 86, 1, 87, 1, 88, 1, 89, 4, 0, 4, 0,
+    1, 90, 1, 91, 1, 92, 1, 93, 1, 94, 7, 0,
+    5, 0, 1, 95, 1, 96, 1, 97, 1, 98, 7, 0,
+    5, 0, 1, 99, 1, 100, 1, 101, 1, 102, 7, 0,
+    5, 0, 1, 103, 1, 104, 1, 105, 1, 106, 7, 0,
+    5, 0, 1, 107, 1, 108, 1, 109, 1, 110, 1, 111,
+    6, 0, 6, 0, 1, 112, 1, 113, 1, 114, 1, 115,
+    6, 0, 8, 0, 1, 1, 1, 2, 1, 3, 1, 4,
+    4, 0, 6, 0, 1, 5, 1, 6, 1, 7, 1, 8,
+    1, 9, 1, 10, 1, 11, 3, 0, 5, 0, 1, 12,
+    1, 13, 1, 14, 1, 15, 1, 16, 1, 17, 1, 18,
+    1, 19, 3, 0, 4, 0, 1, 20, 1, 21, 1, 22,
+    1, 23, 1, 24, 1, 25, 1, 26, 1, 27, 1, 28,
+    3, 0, 3, 0, 1, 29, 1, 30, 1, 31, 1, 32,
+    1, 33, 1, 34, 1, 35, 1, 36, 1, 37, 1, 38,
+    3, 0, 3, 0, 1, 39, 1, 40, 1, 41, 1, 42,
+    1, 43, 1, 44, 1, 45, 1, 46, 1, 47, 1, 48,
+    3, 0, 3, 0, 1, 49, 1, 50, 1, 51, 1, 52,
+    1, 53, 1, 54, 1, 55, 1, 56, 1, 57, 1, 58,
+    3, 0, 3, 0, 1, 59, 1, 60, 1, 61, 1, 62,
+    1, 63, 1, 64, 1, 65, 1, 66, 1, 67, 1, 68,
+    3, 0, 3, 0, 1, 69, 1, 70, 1, 71, 1, 72,
+    1, 73, 1, 74, 1, 75, 1, 76, 1, 77, 1, 78,
+    3, 0, 3, 0, 1, 79, 1, 80, 1, 81, 1, 82,
+    1, 83, 1, 84, 1, 85, 1, 86, 1, 87, 1, 88,
+    3, 0, 3, 0, 1, 89, 1, 90, 1, 91, 1, 92,
+    1, 93, 1, 94, 1, 95, 1, 96, 1, 97, 1, 78,
+    3, 0, 3, 0, 1, 98, 1, 99, 1, 100, 1, 101,
+    1, 102, 1, 103, 1, 104, 1, 105, 1, 106, 1, 78,
+    3, 0, 4, 0, 1, 107, 1, 108, 1, 109, 1, 110,
+    1, 111, 1, 112, 1, 113, 1, 114, 1, 88, 3, 0,
+    4, 0, 1, 115, 1, 116, 1, 117, 1, 118, 1, 119,
+    1, 120, 1, 121, 1, 122, 1, 123, 3, 0, 5, 0,
+    1, 124, 1, 125, 1, 126, 1, 127, 1, 128, 1, 129,
+    1, 130, 1, 123, 3, 0, 6, 0, 1, 131, 1, 132,
+    1, 133, 1, 134, 1, 135, 1, 136, 1, 137, 3, 0,
+    10, 0, 2, 138, 1, 139, 3, 0, 9, 0, 1, 1,
+    1, 2, 1, 3, 4, 0, 2, 0, 1, 4, 1, 5,
+    1, 6, 1, 7, 3, 0, 1, 8, 1, 9, 1, 10,
+    1, 11, 3, 0, 2, 0, 1, 12, 1, 13, 1, 14,
+    1, 15, 1, 16, 2, 0, 1, 17, 1, 18, 1, 19,
+    1, 20, 3, 0, 2, 0, 1, 21, 1, 22, 1, 23,
+    1, 24, 1, 25, 2, 0, 1, 26, 1, 27, 1, 28,
+    1, 29, 3, 0, 2, 0, 1, 30, 1, 31, 1, 32,
+    1, 33, 1, 34, 2, 0, 1, 35, 1, 36, 1, 37,
+    1, 38, 3, 0, 2, 0, 1, 39, 1, 40, 1, 41,
+    1, 42, 1, 43, 1, 44, 1, 45, 1, 46, 1, 47,
+    1, 48, 1, 49, 1, 50, 2, 0, 2, 0, 1, 51,
+    1, 52, 1, 53, 1, 54, 1, 55, 1, 56, 1, 57,
+    1, 58, 1, 59, 1, 60, 1, 61, 1, 62, 2, 0,
+    2, 0, 1, 63, 1, 64, 2, 65, 1, 66, 1, 67,
+    1, 66, 1, 68, 1, 69, 1, 70, 1, 71, 1, 72,
+    2, 0, 2, 0, 1, 73, 1, 74, 1, 75, 1, 76,
+    1, 77, 1, 78, 1, 79, 1, 80, 1, 81, 1, 82,
+    1, 83, 1, 84, 2, 0, 2, 0, 1, 85, 1, 86,
+    1, 87, 1, 88, 1, 89, 1, 90, 1, 91, 1, 92,
+    1, 93, 1, 94, 1, 95, 1, 96, 2, 0, 2, 0,
+    1, 97, 1, 98, 1, 99, 1, 100, 1, 101, 1, 102,
+    1, 103, 1, 104, 1, 105, 1, 106, 1, 107, 1, 108,
+    2, 0, 2, 0, 1, 109, 1, 110, 1, 111, 1, 112,
+    1, 113, 2, 0, 1, 114, 1, 115, 1, 116, 1, 117,
+    1, 118, 2, 0, 2, 0, 1, 119, 1, 120, 1, 121,
+    1, 122, 1, 123, 2, 0, 1, 124, 1, 125, 1, 126,
+    1, 127, 1, 128, 2, 0, 2, 0, 1, 129, 1, 130,
+    1, 131, 1, 132, 1, 133, 2, 0, 1, 134, 1, 135,
+    1, 136, 1, 137, 1, 138, 2, 0, 2, 0, 1, 139,
+    1, 140, 1, 141, 1, 142, 1, 143, 2, 0, 1, 144,
+    1, 145, 1, 146, 1, 147, 1, 148, 2, 0, 2, 0,
+    1, 149, 1, 150, 1, 151, 1, 152, 1, 153, 3, 0,
+    1, 154, 1, 155, 1, 156, 1, 157, 2, 0, 4, 0,
+    1, 158, 1, 159, 1, 160, 5, 0, 1, 161, 3, 0,
+    5, 0, 1, 1, 1, 2, 1, 3, 1, 4, 7, 0,
+    4, 0, 1, 5, 1, 6, 1, 7, 1, 8, 1, 9,
+    7, 0, 4, 0, 1, 10, 1, 11, 1, 12, 1, 13,
+    1, 14, 7, 0, 4, 0, 1, 15, 1, 16, 1, 17,
+    1, 18, 1, 19, 7, 0, 5, 0, 1, 20, 1, 21,
+    1, 22, 1, 23, 1, 24, 6, 0, 5, 0, 1, 25,
+    1, 26, 1, 27, 1, 28, 1, 29, 6, 0, 5, 0,
+    1, 30, 1, 31, 1, 32, 1, 33, 1, 34, 6, 0,
+    5, 0, 1, 35, 1, 36, 1, 37, 1, 38, 1, 39,
+    6, 0, 5, 0, 1, 40, 1, 41, 1, 42, 1, 43,
+    1, 44, 6, 0, 5, 0, 1, 45, 1, 46, 1, 47,
+    1, 48, 1, 49, 1, 50, 5, 0, 6, 0, 1, 51,
+    1, 52, 1, 53, 1, 54, 1, 55, 5, 0, 6, 0,
+    1, 56, 1, 57, 1, 58, 1, 59, 1, 60, 5, 0,
+    6, 0, 1, 61, 1, 62, 1, 63, 1, 64, 1, 65,
+    5, 0, 6, 0, 1, 66, 1, 67, 1, 68, 1, 69,
+    1, 70, 5, 0, 6, 0, 1, 71, 1, 72, 1, 73,
+    1, 74, 1, 75, 5, 0, 6, 0, 1, 76, 1, 77,
+    1, 78, 1, 79, 1, 80, 5, 0, 16, 0, 7, 0,
+    1, 1, 1, 2, 1, 3, 6, 0, 6, 0, 1, 4,
+    1, 5, 1, 6, 1, 7, 1, 8, 5, 0, 6, 0,
+    1, 9, 1, 10, 1, 11, 1, 12, 1, 13, 5, 0,
+    7, 0, 1, 14, 1, 15, 1, 16, 1, 17, 1, 18,
+    4, 0, 7, 0, 1, 19, 1, 20, 1, 21, 1, 22,
+    1, 23, 4, 0, 8, 0, 1, 24, 1, 25, 1, 26,
+    1, 27, 4, 0, 8, 0, 1, 28, 1, 29, 1, 30,
+    1, 31, 4, 0, 8, 0, 1, 32, 1, 33, 1, 34,
+    1, 35, 4, 0, 8, 0, 1, 36, 1, 37, 1, 38,
+    1, 39, 4, 0, 3, 0, 1, 40, 1, 18, 3, 0,
+    1, 41, 1, 42, 1, 43, 1, 44, 4, 0, 2, 0,
+    1, 45, 1, 46, 1, 47, 2, 0, 1, 48, 1, 49,
+    1, 50, 1, 51, 1, 52, 4, 0, 2, 0, 1, 53,
+    1, 54, 1, 55, 1, 56, 1, 57, 1, 58, 1, 59,
+    1, 60, 1, 61, 1, 62, 4, 0, 2, 0, 1, 63,
+    1, 64, 1, 65, 1, 66, 1, 67, 1, 68, 1, 69,
+    1, 70, 1, 71, 1, 72, 4, 0, 2, 0, 1, 73,
+    1, 74, 1, 75, 1, 76, 1, 77, 1, 78, 1, 79,
+    1, 80, 1, 81, 5, 0, 3, 0, 1, 82, 1, 83,
+    1, 84, 1, 85, 1, 86, 1, 87, 1, 88, 1, 89,
+    5, 0, 3, 0, 1, 90, 1, 91, 1, 92, 1, 93,
+    1, 94, 1, 95, 1, 96, 6, 0, 5, 0, 1, 97,
+    1, 98, 9, 0, 2, 0, 1, 1, 1, 2, 1, 3,
+    1, 4, 10, 0, 2, 0, 1, 5, 1, 6, 1, 7,
+    1, 8, 10, 0, 2, 0, 1, 9, 1, 10, 1, 11,
+    1, 12, 1, 13, 3, 0, 1, 14, 5, 0, 2, 0,
+    1, 15, 1, 16, 1, 17, 1, 18, 1, 19, 2, 0,
+    1, 20, 1, 21, 1, 22, 4, 0, 2, 0, 1, 23,
+    1, 24, 1, 25, 1, 26, 1, 27, 1, 0, 1, 28,
+    1, 29, 1, 30, 1, 31, 1, 32, 3, 0, 2, 0,
+    1, 33, 1, 34, 1, 35, 1, 36, 1, 37, 1, 38,
+    1, 39, 1, 40, 1, 41, 1, 42, 1, 43, 1, 44,
+    2, 0, 2, 0, 1, 45, 1, 46, 1, 25, 1, 47,
+    1, 48, 1, 49, 1, 50, 1, 51, 1, 52, 1, 53,
+    1, 54, 3, 0, 2, 0, 1, 55, 1, 56, 1, 57,
+    1, 58, 1, 59, 1, 60, 1, 61, 1, 62, 1, 63,
+    1, 64, 1, 65, 3, 0, 2, 0, 1, 55, 1, 66,
+    1, 25, 1, 67, 1, 68, 1, 69, 1, 70, 1, 71,
+    1, 72, 1, 73, 4, 0, 3, 0, 1, 74, 1, 75,
+    1, 76, 1, 77, 1, 78, 1, 79, 1, 80, 6, 0,
+    3, 0, 1, 81, 1, 82, 1, 83, 1, 84, 1, 85,
+    1, 86, 1, 87, 1, 88, 5, 0, 3, 0, 1, 89,
+    1, 90, 1, 91, 1, 92, 1, 93, 1, 94, 1, 95,
+    1, 96, 1, 97, 4, 0, 3, 0, 1, 98, 1, 99,
+    1, 100, 1, 101, 1, 102, 1, 103, 1, 104, 1, 105,
+    1, 106, 1, 107, 3, 0, 3, 0, 1, 108, 1, 109,
+    1, 110, 1, 111, 1, 112, 1, 113, 1, 114, 1, 115,
+    1, 116, 1, 117, 1, 118, 2, 0, 3, 0, 1, 119,
+    1, 120, 1, 121, 1, 122, 1, 0, 1, 123, 1, 124,
+    1, 125, 1, 126, 1, 127, 3, 0, 3, 0, 1, 128,
+    1, 129, 1, 130, 1, 131, 2, 0, 1, 132, 1, 133,
+    1, 134, 4, 0, 4, 0, 1, 135, 5, 0, 1, 136,
+    5, 0, 3, 0, 1, 1, 1, 2, 1, 3, 1, 4,
+    9, 0, 3, 0, 1, 5, 1, 6, 1, 7, 1, 8,
+    9, 0, 3, 0, 1, 9, 1, 10, 1, 11, 1, 12,
+    9, 0, 3, 0, 1, 13, 1, 14, 1, 15, 1, 16,
+    1, 17, 8, 0, 3, 0, 1, 18, 1, 19, 1, 20,
+    1, 21, 1, 22, 8, 0, 4, 0, 1, 23, 1, 24,
+    1, 25, 1, 26, 8, 0, 4, 0, 1, 27, 1, 28,
+    1, 29, 1, 30, 8, 0, 4, 0, 1, 31, 1, 32,
+    1, 33, 1, 34, 8, 0, 4, 0, 1, 35, 1, 32,
+    1, 36, 1, 37, 8, 0, 4, 0, 1, 38, 1, 39,
+    1, 40, 1, 41, 8, 0, 4, 0, 1, 42, 1, 43,
+    1, 44, 1, 45, 1, 46, 1, 47, 1, 48, 1, 49,
+    1, 50, 3, 0, 4, 0, 1, 51, 1, 52, 1, 53,
+    1, 54, 1, 55, 1, 56, 1, 57, 1, 58, 1, 59,
+    3, 0, 4, 0, 1, 60, 1, 61, 1, 62, 1, 63,
+    1, 62, 1, 64, 1, 65, 1, 66, 1, 67, 3, 0,
+    4, 0, 1, 68, 1, 69, 1, 70, 1, 71, 1, 72,
+    1, 73, 1, 74, 1, 75, 1, 22, 3, 0, 4, 0,
+    1, 76, 1, 77, 1, 78, 1, 79, 1, 80, 1, 81,
+    1, 82, 1, 83, 1, 84, 3, 0, 4, 0, 1, 85,
+    1, 86, 1, 87, 1, 88, 1, 89, 1, 90, 1, 91,
+    1, 92, 4, 0, 5, 0, 1, 93, 3, 0, 1, 94,
+    6, 0, 16, 0, 4, 0, 1, 1, 6, 0, 1, 2,
+    1, 3, 1, 4, 2, 0, 3, 0, 1, 5, 1, 6,
+    1, 7, 5, 0, 1, 8, 1, 9, 1, 10, 2, 0,
+    3, 0, 1, 11, 1, 12, 1, 13, 1, 14, 3, 0,
+    1, 15, 1, 16, 1, 17, 1, 18, 2, 0, 3, 0,
+    1, 19, 1, 20, 1, 21, 1, 22, 3, 0, 1, 23,
+    1, 24, 1, 25, 1, 26, 2, 0, 2, 0, 1, 27,
+    1, 28, 1, 29, 1, 30, 1, 31, 1, 32, 1, 0,
+    1, 33, 1, 34, 1, 35, 1, 36, 1, 37, 1, 38,
+    1, 0, 2, 0, 1, 39, 1, 40, 1, 41, 1, 42,
+    1, 43, 1, 44, 1, 45, 1, 46, 1, 47, 1, 48,
+    1, 49, 1, 50, 1, 51, 1, 0, 1, 0, 1, 52,
+    1, 53, 1, 54, 1, 55, 1, 56, 1, 57, 1, 58,
+    1, 59, 1, 60, 1, 61, 1, 62, 1, 49, 1, 63,
+    1, 64, 1, 0, 1, 0, 1, 65, 1, 66, 1, 67,
+    1, 68, 1, 69, 1, 70, 1, 71, 1, 72, 1, 73,
+    1, 74, 1, 75, 1, 76, 1, 77, 1, 78, 1, 0,
+    1, 0, 1, 79, 1, 80, 1, 81, 1, 82, 1, 83,
+    1, 84, 1, 85, 1, 40, 1, 86, 1, 87, 1, 88,
+    1, 89, 1, 90, 1, 91, 1, 0, 1, 92, 1, 93,
+    1, 94, 1, 95, 1, 96, 1, 97, 1, 98, 1, 99,
+    1, 100, 1, 101, 1, 102, 1, 103, 1, 104, 1, 105,
+    1, 106, 1, 107, 1, 108, 1, 109, 1, 110, 1, 111,
+    1, 112, 1, 113, 1, 114, 1, 115, 1, 116, 1, 117,
+    1, 118, 1, 119, 1, 120, 1, 121, 1, 122, 1, 123,
+    1, 124, 1, 125, 1, 126, 1, 127, 1, 128, 1, 129,
+    1, 0, 1, 130, 1, 131, 1, 132, 1, 133, 1, 134,
+    1, 135, 1, 136, 1, 137, 1, 138, 1, 0, 1, 139,
+    1, 140, 1, 141, 1, 142, 1, 143, 5, 0, 1, 144,
+    1, 145, 1, 146, 1, 147, 1, 148, 2, 0, 1, 149,
+    1, 150, 1, 151, 1, 152, 5, 0, 1, 153, 1, 154,
+    1, 155, 1, 156, 1, 143, 3, 0, 1, 157, 1, 158,
+    1, 159, 5, 0, 1, 160, 1, 161, 1, 162, 2, 0,
+    4, 0, 1, 163, 6, 0, 1, 164, 1, 165, 3, 0,
+    9, 0, 1, 1, 1, 2, 5, 0, 2, 0, 1, 3,
+    6, 0, 1, 4, 1, 5, 1, 6, 4, 0, 2, 0,
+    1, 7, 1, 8, 5, 0, 1, 9, 1, 10, 1, 11,
+    4, 0, 2, 0, 1, 12, 1, 13, 1, 14, 4, 0,
+    1, 15, 1, 16, 1, 17, 4, 0, 2, 0, 1, 18,
+    1, 19, 1, 20, 1, 21, 3, 0, 1, 22, 1, 23,
+    1, 24, 4, 0, 2, 0, 1, 25, 1, 26, 1, 27,
+    1, 28, 1, 29, 2, 0, 1, 30, 1, 23, 1, 31,
+    1, 32, 3, 0, 2, 0, 1, 25, 1, 23, 1, 33,
+    1, 34, 1, 35, 1, 36, 1, 37, 1, 38, 1, 39,
+    1, 40, 1, 41, 3, 0, 2, 0, 1, 42, 1, 39,
+    1, 43, 1, 44, 1, 45, 1, 46, 1, 47, 1, 48,
+    1, 23, 1, 49, 1, 50, 3, 0, 2, 0, 1, 42,
+    1, 51, 1, 52, 1, 53, 1, 54, 1, 55, 1, 56,
+    1, 57, 1, 58, 1, 59, 1, 60, 3, 0, 2, 0,
+    1, 61, 1, 51, 1, 62, 1, 63, 1, 64, 1, 65,
+    1, 66, 1, 67, 1, 68, 1, 69, 1, 70, 3, 0,
+    2, 0, 1, 71, 1, 72, 1, 73, 1, 74, 1, 75,
+    1, 76, 1, 77, 1, 78, 1, 79, 1, 80, 1, 81,
+    1, 82, 2, 0, 2, 0, 1, 83, 1, 84, 1, 85,
+    1, 86, 1, 0, 1, 87, 1, 88, 1, 89, 1, 90,
+    1, 91, 1, 92, 1, 93, 2, 0, 2, 0, 1, 94,
+    1, 95, 1, 96, 1, 97, 2, 0, 1, 98, 1, 99,
+    1, 100, 1, 101, 1, 102, 1, 103, 2, 0, 2, 0,
+    1, 104, 1, 105, 1, 106, 1, 107, 3, 0, 1, 108,
+    1, 109, 1, 110, 1, 111, 1, 112, 2, 0, 2, 0,
+    1, 113, 1, 114, 1, 115, 1, 116, 4, 0, 1, 117,
+    1, 118, 1, 119, 1, 120, 2, 0, 2, 0, 1, 121,
+    1, 122, 1, 123, 1, 124, 5, 0, 1, 125, 1, 126,
+    1, 127, 2, 0, 16, 0, 7, 0, 1, 1, 8, 0,
+    5, 0, 1, 2, 1, 3, 1, 4, 1, 5, 1, 6,
+    1, 7, 5, 0, 4, 0, 1, 8, 1, 9, 1, 10,
+    1, 11, 1, 12, 1, 13, 1, 14, 1, 15, 4, 0,
+    3, 0, 1, 16, 1, 17, 1, 18, 1, 19, 1, 20,
+    1, 21, 1, 22, 1, 23, 1, 24, 4, 0, 3, 0,
+    1, 25, 1, 26, 1, 27, 1, 28, 1, 29, 1, 30,
+    1, 31, 1, 32, 1, 33, 1, 34, 3, 0, 2, 0,
+    1, 35, 1, 36, 1, 37, 1, 38, 1, 39, 1, 40,
+    1, 41, 1, 42, 1, 43, 1, 44, 1, 45, 3, 0,
+    2, 0, 1, 46, 1, 47, 1, 48, 1, 49, 1, 50,
+    1, 51, 1, 52, 1, 53, 1, 54, 1, 55, 1, 56,
+    1, 57, 2, 0, 2, 0, 1, 58, 1, 59, 1, 60,
+    1, 61, 1, 51, 2, 0, 1, 62, 1, 63, 1, 64,
+    1, 65, 1, 66, 2, 0, 2, 0, 1, 67, 1, 59,
+    1, 68, 1, 69, 3, 0, 1, 70, 1, 71, 1, 72,
+    1, 73, 1, 74, 2, 0, 2, 0, 1, 75, 1, 76,
+    1, 77, 1, 78, 1, 79, 1, 0, 1, 80, 1, 81,
+    1, 82, 1, 83, 1, 84, 1, 85, 2, 0, 2, 0,
+    1, 86, 1, 87, 1, 88, 1, 89, 1, 90, 1, 91,
+    1, 92, 1, 93, 1, 94, 1, 95, 1, 96, 1, 97,
+    2, 0, 3, 0, 1, 98, 1, 99, 1, 100, 1, 101,
+    1, 102, 1, 103, 1, 104, 1, 105, 1, 106, 1, 107,
+    1, 108, 2, 0, 3, 0, 1, 109, 1, 110, 1, 111,
+    1, 112, 1, 113, 1, 114, 1, 115, 1, 116, 1, 117,
+    1, 118, 3, 0, 4, 0, 1, 119, 1, 120, 1, 121,
+    1, 122, 1, 123, 1, 124, 1, 125, 1, 126, 4, 0,
+    4, 0, 1, 127, 1, 128, 1, 129, 1, 130, 1, 131,
+    1, 132, 1, 133, 1, 134, 4, 0, 5, 0, 1, 135,
+    1, 136, 1, 137, 1, 138, 1, 139, 1, 134, 5, 0,
+    16, 0, 8, 0, 1, 1, 7, 0, 4, 0, 1, 2,
+    1, 3, 1, 4, 1, 5, 1, 6, 1, 7, 1, 8,
+    5, 0, 3, 0, 1, 9, 1, 10, 1, 11, 1, 12,
+    1, 13, 1, 14, 1, 15, 1, 16, 1, 17, 4, 0,
+    3, 0, 1, 18, 1, 19, 1, 20, 1, 21, 1, 22,
+    1, 23, 1, 24, 1, 25, 1, 26, 1, 27, 3, 0,
+    3, 0, 1, 28, 1, 29, 1, 30, 1, 31, 1, 32,
+    1, 33, 1, 34, 1, 35, 1, 36, 1, 37, 3, 0,
+    3, 0, 1, 38, 1, 39, 1, 40, 1, 41, 1, 42,
+    1, 43, 1, 44, 1, 45, 1, 46, 1, 47, 1, 48,
+    2, 0, 3, 0, 1, 49, 1, 50, 1, 51, 1, 52,
+    1, 53, 1, 54, 1, 55, 1, 56, 1, 57, 1, 58,
+    1, 59, 2, 0, 3, 0, 1, 60, 1, 61, 1, 40,
+    1, 62, 1, 63, 1, 64, 1, 65, 1, 66, 1, 67,
+    1, 68, 1, 69, 2, 0, 3, 0, 1, 70, 1, 71,
+    1, 72, 1, 73, 1, 74, 1, 75, 1, 76, 1, 77,
+    1, 78, 1, 79, 1, 80, 2, 0, 3, 0, 1, 81,
+    1, 82, 1, 83, 1, 84, 1, 85, 1, 86, 1, 87,
+    1, 88, 1, 89, 1, 90, 3, 0, 3, 0, 1, 91,
+    1, 92, 1, 93, 1, 94, 1, 95, 1, 96, 1, 97,
+    1, 98, 1, 99, 4, 0, 2, 0, 1, 100, 1, 101,
+    1, 102, 1, 103, 1, 104, 1, 105, 1, 106, 1, 107,
+    1, 108, 5, 0, 2, 0, 1, 109, 1, 110, 1, 111,
+    1, 112, 1, 113, 1, 114, 1, 115, 7, 0, 2, 0,
+    1, 116, 1, 117, 1, 118, 1, 119, 1, 120, 1, 121,
+    8, 0, 2, 0, 1, 122, 1, 123, 1, 124, 1, 125,
+    1, 126, 9, 0, 3, 0, 1, 127, 1, 128, 1, 129,
+    1, 130, 9, 0, 6, 0, 1, 131, 9, 0, 16, 0,
+    5, 0, 1, 1, 1, 2, 1, 3, 1, 4, 1, 5,
+    6, 0, 3, 0, 1, 6, 1, 7, 1, 8, 1, 9,
+    1, 10, 1, 11, 1, 12, 1, 13, 5, 0, 3, 0,
+    1, 14, 1, 15, 1, 16, 1, 17, 1, 18, 1, 19,
+    1, 20, 1, 21, 1, 22, 4, 0, 2, 0, 1, 23,
+    1, 24, 1, 25, 1, 26, 1, 27, 1, 28, 1, 29,
+    1, 30, 1, 31, 1, 32, 4, 0, 2, 0, 1, 33,
+    1, 34, 1, 35, 1, 36, 1, 37, 1, 38, 1, 39,
+    1, 40, 1, 41, 1, 42, 1, 43, 3, 0, 2, 0,
+    1, 44, 1, 45, 1, 46, 1, 47, 1, 48, 1, 0,
+    1, 49, 1, 50, 1, 51, 1, 52, 1, 53, 3, 0,
+    2, 0, 1, 54, 1, 55, 1, 56, 1, 57, 3, 0,
+    1, 58, 1, 59, 1, 60, 1, 61, 3, 0, 2, 0,
+    1, 62, 1, 63, 1, 64, 1, 65, 1, 66, 1, 0,
+    1, 67, 1, 68, 1, 69, 1, 70, 1, 71, 1, 72,
+    2, 0, 2, 0, 1, 73, 1, 74, 1, 75, 1, 76,
+    1, 77, 1, 78, 1, 79, 1, 80, 1, 81, 1, 82,
+    1, 83, 1, 84, 2, 0, 2, 0, 1, 85, 1, 86,
+    1, 87, 1, 88, 1, 89, 1, 90, 1, 91, 1, 92,
+    1, 93, 1, 94, 1, 95, 1, 96, 2, 0, 2, 0,
+    1, 97, 1, 98, 1, 99, 1, 100, 1, 101, 1, 102,
+    1, 103, 1, 104, 1, 105, 1, 106, 1, 107, 1, 108,
+    2, 0, 2, 0, 1, 109, 1, 110, 1, 111, 1, 112,
+    1, 113, 1, 114, 1, 115, 1, 116, 1, 117, 1, 118,
+    1, 119, 1, 120, 2, 0, 3, 0, 1, 121, 1, 122,
+    1, 123, 1, 124, 1, 125, 1, 126, 1, 127, 1, 128,
+    1, 129, 1, 130, 1, 131, 2, 0, 3, 0, 1, 132,
+    1, 133, 1, 134, 1, 135, 1, 136, 1, 137, 1, 138,
+    1, 139, 1, 140, 1, 141, 1, 142, 2, 0, 4, 0,
+    1, 143, 1, 144, 1, 145, 1, 146, 1, 147, 1, 148,
+    1, 149, 1, 150, 1, 151, 3, 0, 6, 0, 1, 132,
+    1, 152, 1, 153, 7, 0, 5, 0, 1, 1, 2, 0,
+    1, 2, 7, 0, 2, 0, 1, 3, 1, 4, 1, 5,
+    1, 6, 1, 7, 1, 8, 1, 9, 1, 10, 1, 11,
+    5, 0, 2, 0, 1, 12, 1, 13, 1, 14, 1, 15,
+    1, 16, 1, 17, 1, 18, 1, 19, 1, 20, 1, 21,
+    4, 0, 2, 0, 1, 22, 1, 23, 1, 24, 1, 25,
+    1, 26, 1, 27, 1, 28, 1, 29, 1, 30, 1, 31,
+    1, 32, 3, 0, 2, 0, 1, 33, 1, 34, 1, 35,
+    1, 36, 1, 37, 1, 38, 1, 39, 1, 40, 1, 41,
+    1, 42, 1, 43, 3, 0, 2, 0, 1, 44, 1, 45,
+    1, 46, 1, 47, 1, 48, 1, 49, 1, 50, 1, 51,
+    1, 52, 1, 53, 1, 54, 3, 0, 2, 0, 1, 55,
+    1, 56, 1, 57, 1, 58, 1, 59, 1, 60, 1, 61,
+    1, 62, 1, 63, 1, 64, 1, 65, 3, 0, 2, 0,
+    1, 66, 1, 67, 1, 68, 1, 69, 1, 70, 1, 71,
+    1, 72, 1, 73, 1, 74, 1, 75, 1, 76, 3, 0,
+    2, 0, 1, 66, 1, 77, 1, 57, 1, 78, 1, 79,
+    1, 80, 1, 81, 1, 82, 1, 83, 1, 84, 4, 0,
+    2, 0, 1, 66, 1, 85, 1, 86, 1, 87, 1, 88,
+    1, 89, 1, 90, 1, 91, 1, 92, 5, 0, 3, 0,
+    1, 93, 1, 94, 1, 95, 1, 96, 1, 97, 1, 98,
+    1, 99, 1, 100, 1, 101, 4, 0, 3, 0, 1, 102,
+    1, 103, 1, 104, 1, 105, 1, 106, 1, 107, 1, 108,
+    1, 109, 1, 110, 1, 111, 3, 0, 3, 0, 1, 112,
+    1, 113, 1, 114, 1, 115, 1, 116, 1, 117, 1, 118,
+    1, 119, 1, 120, 1, 121, 1, 122, 2, 0, 3, 0,
+    1, 123, 1, 124, 1, 125, 1, 126, 1, 127, 1, 128,
+    1, 129, 1, 130, 1, 131, 1, 132, 1, 133, 2, 0,
+    3, 0, 1, 134, 1, 135, 1, 136, 1, 137, 1, 138,
+    1, 139, 1, 140, 1, 141, 1, 142, 1, 143, 3, 0,
+    4, 0, 1, 144, 1, 145, 1, 146, 1, 147, 1, 0,
+    1, 148, 1, 149, 1, 150, 4, 0, 4, 0, 1, 151,
+    1, 152, 1, 153, 1, 154, 8, 0, 9, 0, 1, 1,
+    1, 2, 5, 0, 6, 0, 1, 3, 1, 4, 1, 5,
+    1, 6, 1, 7, 5, 0, 4, 0, 1, 8, 1, 9,
+    1, 10, 1, 11, 1, 12, 1, 13, 1, 14, 1, 15,
+    4, 0, 4, 0, 1, 16, 1, 17, 1, 18, 1, 19,
+    1, 20, 1, 21, 1, 22, 1, 23, 4, 0, 3, 0,
+    1, 24, 1, 25, 1, 26, 1, 27, 1, 28, 1, 29,
+    1, 30, 1, 31, 1, 32, 4, 0, 3, 0, 1, 33,
+    1, 34, 1, 35, 1, 36, 1, 37, 1, 38, 1, 39,
+    1, 40, 1, 41, 4, 0, 3, 0, 1, 42, 1, 43,
+    1, 44, 1, 45, 1, 46, 1, 47, 1, 48, 1, 49,
+    1, 50, 4, 0, 3, 0, 1, 51, 1, 52, 1, 53,
+    1, 54, 1, 55, 1, 56, 1, 57, 1, 58, 1, 59,
+    4, 0, 3, 0, 1, 60, 1, 61, 1, 62, 1, 63,
+    1, 64, 1, 65, 1, 66, 1, 67, 5, 0, 4, 0,
+    1, 68, 1, 69, 1, 70, 1, 71, 1, 72, 1, 73,
+    1, 74, 1, 75, 4, 0, 4, 0, 1, 76, 1, 77,
+    1, 78, 1, 79, 1, 80, 1, 81, 1, 82, 1, 83,
+    4, 0, 6, 0, 1, 84, 1, 85, 1, 86, 1, 87,
+    1, 88, 1, 89, 1, 90, 3, 0, 5, 0, 1, 91,
+    1, 92, 1, 93, 1, 94, 1, 95, 1, 96, 1, 97,
+    1, 98, 3, 0, 5, 0, 1, 99, 1, 100, 1, 101,
+    1, 102, 1, 103, 1, 104, 1, 105, 1, 106, 3, 0,
+    5, 0, 1, 107, 1, 108, 1, 109, 1, 110, 1, 111,
+    1, 112, 1, 113, 1, 114, 3, 0, 5, 0, 1, 115,
+    1, 116, 1, 117, 1, 118, 1, 119, 1, 120, 1, 121,
+    4, 0, 6, 0, 1, 122, 1, 123, 1, 124, 1, 125,
+    6, 0, 10, 0, 1, 1, 1, 2, 4, 0, 2, 0,
+    1, 3, 1, 4, 1, 5, 1, 6, 1, 7, 1, 8,
+    1, 9, 1, 10, 1, 11, 1, 12, 4, 0, 2, 0,
+    1, 13, 1, 14, 1, 15, 1, 16, 1, 17, 1, 18,
+    1, 19, 1, 20, 1, 21, 1, 22, 1, 23, 3, 0,
+    2, 0, 1, 24, 1, 25, 1, 26, 1, 27, 1, 28,
+    1, 29, 1, 30, 1, 31, 1, 32, 1, 33, 1, 34,
+    3, 0, 2, 0, 1, 35, 1, 36, 1, 37, 1, 38,
+    1, 39, 1, 40, 1, 41, 1, 42, 1, 43, 1, 44,
+    1, 45, 3, 0, 2, 0, 1, 46, 1, 47, 1, 48,
+    1, 49, 1, 50, 1, 51, 1, 52, 1, 53, 1, 54,
+    1, 55, 1, 56, 3, 0, 3, 0, 1, 57, 1, 58,
+    1, 59, 1, 60, 1, 61, 1, 62, 1, 63, 1, 0,
+    1, 64, 4, 0, 5, 0, 1, 65, 1, 66, 1, 67,
+    1, 68, 1, 69, 6, 0, 6, 0, 1, 70, 1, 71,
+    1, 72, 1, 73, 6, 0, 6, 0, 1, 74, 1, 75,
+    1, 76, 1, 77, 6, 0, 6, 0, 1, 78, 1, 79,
+    1, 80, 1, 81, 6, 0, 6, 0, 1, 82, 1, 83,
+    1, 84, 1, 85, 6, 0, 6, 0, 1, 86, 1, 87,
+    1, 88, 1, 89, 1, 90, 5, 0, 6, 0, 1, 91,
+    1, 92, 1, 93, 1, 94, 1, 95, 5, 0, 6, 0,
+    1, 96, 1, 97, 1, 98, 1, 99, 1, 100, 5, 0,
+    5, 0, 1, 2, 1, 101, 1, 102, 1, 103, 1, 104,
+    1, 105, 5, 0, 6, 0, 1, 106, 1, 107, 1, 108,
+    1, 109, 1, 110, 5, 0, 16, 0, 2, 0, 1, 1,
+    1, 2, 1, 3, 1, 4, 3, 0, 1, 5, 1, 6,
+    1, 7, 1, 8, 3, 0, 2, 0, 1, 9, 1, 10,
+    1, 11, 1, 12, 3, 0, 1, 13, 1, 14, 1, 15,
+    1, 16, 1, 17, 2, 0, 2, 0, 1, 18, 1, 19,
+    1, 20, 1, 21, 3, 0, 1, 22, 1, 23, 1, 24,
+    1, 25, 1, 26, 2, 0, 2, 0, 1, 27, 1, 28,
+    1, 29, 1, 30, 3, 0, 1, 31, 1, 32, 1, 33,
+    1, 34, 1, 35, 2, 0, 2, 0, 1, 36, 1, 37,
+    1, 38, 1, 39, 3, 0, 1, 40, 1, 41, 1, 42,
+    1, 43, 1, 44, 2, 0, 2, 0, 1, 45, 1, 46,
+    1, 47, 1, 48, 3, 0, 1, 49, 1, 38, 1, 50,
+    1, 51, 3, 0, 2, 0, 1, 52, 2, 53, 1, 48,
+    3, 0, 1, 54, 1, 47, 1, 55, 1, 56, 1, 57,
+    2, 0, 2, 0, 1, 58, 1, 59, 1, 60, 1, 61,
+    2, 0, 1, 62, 1, 63, 1, 29, 1, 64, 1, 65,
+    1, 66, 2, 0, 2, 0, 1, 67, 1, 68, 1, 69,
+    1, 70, 1, 71, 1, 72, 1, 73, 1, 74, 1, 75,
+    1, 76, 1, 77, 3, 0, 2, 0, 1, 78, 1, 79,
+    1, 80, 1, 81, 1, 82, 1, 83, 1, 84, 1, 85,
+    1, 86, 1, 87, 1, 88, 3, 0, 2, 0, 1, 89,
+    1, 90, 1, 91, 1, 92, 1, 93, 1, 94, 1, 95,
+    1, 96, 1, 97, 1, 98, 1, 99, 3, 0, 2, 0,
+    1, 100, 1, 101, 1, 102, 1, 103, 1, 104, 1, 105,
+    1, 106, 1, 107, 1, 108, 1, 109, 1, 110, 3, 0,
+    3, 0, 1, 111, 1, 112, 1, 113, 1, 114, 1, 115,
+    1, 116, 1, 117, 1, 118, 1, 119, 4, 0, 3, 0,
+    1, 120, 1, 121, 1, 122, 1, 123, 1, 124, 1, 125,
+    1, 126, 1, 127, 5, 0, 4, 0, 1, 44, 1, 128,
+    1, 129, 1, 130, 1, 131, 1, 132, 6, 0, 5, 0,
+    1, 133, 3, 134, 1, 135, 6, 0, 16, 0, 3, 0,
+    1, 1, 1, 2, 1, 3, 3, 0, 1, 4, 1, 5,
+    1, 6, 4, 0, 2, 0, 1, 7, 1, 8, 1, 9,
+    1, 10, 3, 0, 1, 11, 1, 12, 1, 13, 1, 14,
+    3, 0, 2, 0, 1, 15, 1, 16, 1, 17, 1, 18,
+    2, 0, 1, 19, 1, 20, 1, 21, 1, 22, 1, 23,
+    3, 0, 2, 0, 1, 24, 1, 25, 1, 26, 1, 27,
+    1, 28, 1, 0, 1, 29, 1, 30, 1, 31, 1, 32,
+    1, 33, 1, 34, 2, 0, 2, 0, 1, 35, 1, 36,
+    1, 37, 1, 38, 1, 39, 1, 40, 1, 41, 1, 42,
+    1, 43, 1, 44, 1, 45, 1, 46, 2, 0, 3, 0,
+    1, 47, 1, 48, 1, 49, 1, 50, 1, 51, 1, 52,
+    1, 53, 1, 54, 1, 55, 1, 56, 3, 0, 3, 0,
+    1, 57, 1, 58, 1, 59, 1, 60, 1, 61, 1, 62,
+    1, 63, 1, 64, 1, 65, 1, 66, 3, 0, 4, 0,
+    1, 67, 1, 68, 1, 69, 1, 70, 1, 71, 1, 72,
+    1, 55, 1, 73, 4, 0, 4, 0, 1, 74, 1, 75,
+    1, 76, 1, 77, 1, 78, 1, 79, 1, 65, 1, 80,
+    4, 0, 4, 0, 1, 81, 1, 82, 1, 83, 1, 84,
+    1, 85, 1, 86, 1, 87, 5, 0, 5, 0, 1, 88,
+    1, 89, 1, 90, 1, 91, 1, 92, 1, 80, 5, 0,
+    5, 0, 1, 93, 1, 94, 1, 95, 1, 96, 1, 97,
+    6, 0, 6, 0, 1, 98, 1, 99, 1, 100, 1, 101,
+    6, 0, 6, 0, 1, 102, 1, 103, 1, 104, 7, 0,
+    6, 0, 1, 105, 1, 106, 1, 107, 7, 0, 7, 0,
+    1, 46, 8, 0, 16, 0, 1, 0, 1, 1, 1, 2,
+    1, 3, 6, 0, 1, 4, 1, 5, 1, 6, 3, 0,
+    1, 7, 1, 8, 1, 9, 1, 10, 1, 11, 5, 0,
+    1, 12, 1, 13, 1, 14, 1, 15, 1, 16, 1, 0,
+    1, 17, 1, 18, 1, 19, 1, 20, 1, 21, 2, 0,
+    1, 22, 2, 0, 1, 23, 1, 24, 1, 25, 1, 26,
+    1, 27, 1, 0, 1, 28, 1, 29, 1, 30, 1, 31,
+    1, 32, 1, 33, 1, 34, 1, 35, 2, 0, 1, 36,
+    1, 37, 1, 38, 1, 39, 1, 40, 1, 0, 1, 0,
+    1, 41, 1, 42, 1, 43, 1, 44, 1, 45, 1, 46,
+    1, 47, 1, 48, 1, 0, 1, 49, 1, 50, 1, 51,
+    1, 52, 1, 53, 1, 0, 1, 0, 1, 54, 1, 55,
+    1, 56, 1, 57, 1, 58, 1, 59, 1, 60, 1, 61,
+    1, 62, 1, 63, 1, 64, 1, 65, 1, 66, 1, 67,
+    1, 0, 1, 0, 1, 68, 1, 69, 1, 70, 1, 71,
+    1, 72, 1, 73, 1, 74, 1, 75, 1, 76, 1, 77,
+    1, 78, 1, 79, 1, 80, 1, 81, 1, 0, 1, 0,
+    1, 82, 1, 83, 1, 84, 1, 85, 1, 86, 1, 87,
+    1, 88, 1, 89, 1, 90, 1, 91, 1, 92, 1, 93,
+    1, 94, 1, 95, 1, 0, 1, 0, 1, 96, 1, 97,
+    1, 98, 1, 99, 1, 100, 1, 101, 1, 102, 1, 103,
+    1, 104, 1, 105, 1, 106, 1, 107, 1, 108, 1, 109,
+    1, 0, 1, 0, 1, 110, 1, 111, 1, 112, 1, 113,
+    1, 114, 1, 115, 1, 116, 1, 117, 1, 118, 1, 119,
+    1, 120, 1, 121, 1, 122, 1, 123, 1, 0, 2, 0,
+    1, 124, 1, 125, 1, 126, 1, 127, 1, 128, 1, 129,
+    1, 130, 1, 131, 1, 132, 1, 133, 1, 134, 1, 135,
+    2, 0, 2, 0, 1, 136, 1, 137, 1, 138, 1, 139,
+    2, 0, 1, 140, 1, 141, 1, 142, 1, 143, 1, 144,
+    1, 145, 2, 0, 2, 0, 1, 146, 1, 147, 1, 148,
+    1, 149, 3, 0, 1, 149, 1, 150, 1, 151, 1, 152,
+    1, 153, 2, 0, 2, 0, 1, 154, 1, 155, 1, 156,
+    5, 0, 1, 157, 1, 158, 1, 159, 1, 160, 2, 0,
+    2, 0, 1, 161, 1, 162, 7, 0, 1, 163, 1, 164,
+    1, 165, 2, 0, 2, 0, 1, 166, 1, 167, 1, 168,
+    7, 0, 1, 169, 1, 170, 2, 0, 16, 0, 4, 0,
+    1, 1, 11, 0, 3, 0, 1, 2, 1, 3, 1, 4,
+    6, 0, 1, 5, 1, 6, 2, 0, 2, 0, 1, 7,
+    1, 8, 1, 9, 1, 10, 1, 11, 4, 0, 1, 12,
+    1, 13, 1, 14, 1, 15, 1, 0, 2, 0, 1, 16,
+    1, 17, 1, 18, 1, 19, 1, 20, 1, 21, 1, 0,
+    1, 22, 1, 23, 1, 24, 1, 25, 1, 26, 1, 27,
+    1, 0, 3, 0, 1, 28, 1, 29, 1, 30, 1, 31,
+    1, 32, 1, 33, 1, 34, 1, 35, 1, 36, 1, 37,
+    1, 38, 1, 39, 1, 0, 4, 0, 1, 40, 1, 41,
+    1, 42, 1, 43, 1, 44, 1, 45, 1, 46, 1, 47,
+    1, 48, 1, 49, 1, 50, 1, 0, 4, 0, 1, 51,
+    1, 52, 1, 53, 1, 54, 1, 55, 1, 56, 1, 57,
+    1, 58, 1, 59, 1, 60, 2, 0, 5, 0, 1, 61,
+    1, 62, 1, 63, 1, 64, 1, 65, 1, 66, 1, 67,
+    1, 68, 3, 0, 4, 0, 1, 69, 1, 70, 1, 71,
+    1, 72, 1, 73, 1, 74, 1, 75, 1, 76, 4, 0,
+    3, 0, 1, 77, 1, 78, 1, 79, 1, 80, 1, 81,
+    1, 82, 1, 83, 1, 84, 1, 85, 4, 0, 2, 0,
+    1, 86, 1, 87, 1, 88, 1, 89, 1, 90, 1, 91,
+    1, 92, 1, 93, 1, 94, 1, 95, 1, 96, 3, 0,
+    2, 0, 1, 97, 1, 98, 1, 99, 1, 100, 1, 101,
+    1, 102, 1, 103, 1, 104, 1, 105, 1, 106, 1, 107,
+    1, 108, 2, 0, 1, 0, 1, 109, 1, 110, 1, 111,
+    1, 112, 1, 113, 1, 114, 1, 115, 1, 116, 1, 117,
+    1, 118, 1, 119, 1, 120, 1, 121, 2, 0, 1, 0,
+    1, 122, 1, 123, 1, 124, 1, 125, 1, 126, 1, 127,
+    2, 0, 1, 128, 1, 129, 1, 130, 1, 131, 1, 132,
+    2, 0, 1, 0, 1, 133, 1, 134, 1, 135, 1, 136,
+    1, 137, 3, 0, 1, 138, 1, 139, 1, 140, 1, 141,
+    1, 142, 2, 0, 1, 0, 1, 143, 1, 144, 1, 145,
+    1, 146, 1, 147, 1, 148, 2, 0, 1, 149, 1, 150,
+    1, 151, 1, 152, 1, 153, 2, 0, 16, 0, 4, 0,
+    1, 1, 6, 0, 1, 2, 4, 0, 3, 0, 1, 3,
+    1, 4, 1, 5, 4, 0, 1, 6, 1, 7, 1, 8,
+    3, 0, 2, 0, 1, 9, 1, 10, 1, 11, 1, 12,
+    3, 0, 1, 13, 1, 14, 1, 15, 1, 16, 1, 17,
+    2, 0, 1, 0, 1, 18, 1, 19, 1, 20, 1, 21,
+    1, 22, 1, 23, 1, 0, 1, 24, 1, 25, 1, 26,
+    1, 27, 1, 28, 1, 29, 1, 30, 1, 0, 2, 0,
+    1, 31, 1, 32, 1, 33, 1, 34, 1, 35, 1, 36,
+    1, 37, 1, 38, 1, 39, 1, 40, 1, 41, 1, 42,
+    1, 43, 1, 0, 2, 0, 1, 44, 1, 45, 1, 46,
+    1, 47, 1, 48, 1, 49, 1, 50, 1, 51, 1, 52,
+    1, 53, 1, 54, 1, 55, 2, 0, 3, 0, 1, 56,
+    1, 57, 1, 58, 1, 59, 1, 60, 1, 61, 1, 62,
+    1, 63, 1, 64, 1, 65, 3, 0, 4, 0, 1, 66,
+    1, 67, 1, 68, 1, 69, 1, 70, 1, 71, 1, 72,
+    1, 73, 4, 0, 4, 0, 1, 74, 1, 75, 1, 76,
+    1, 77, 1, 78, 1, 79, 1, 80, 5, 0, 4, 0,
+    1, 81, 1, 82, 1, 83, 1, 84, 1, 85, 1, 86,
+    6, 0, 4, 0, 1, 87, 1, 88, 1, 89, 1, 90,
+    1, 91, 7, 0, 4, 0, 1, 92, 1, 93, 1, 94,
+    1, 95, 1, 96, 7, 0, 4, 0, 1, 97, 1, 98,
+    1, 99, 1, 100, 1, 101, 7, 0, 4, 0, 1, 102,
+    1, 103, 1, 104, 1, 105, 1, 106, 7, 0, 4, 0,
+    1, 107, 1, 108, 1, 109, 1, 110, 1, 111, 7, 0,
+    5, 0, 1, 112, 1, 113, 1, 114, 1, 113, 7, 0,
+    16, 0, 5, 0, 1, 1, 1, 2, 1, 3, 1, 4,
+    1, 5, 1, 6, 1, 7, 1, 8, 1, 9, 2, 0,
+    5, 0, 1, 10, 1, 11, 1, 12, 2, 13, 1, 14,
+    1, 15, 1, 16, 1, 17, 2, 0, 5, 0, 1, 18,
+    1, 19, 1, 20, 1, 21, 1, 22, 1, 23, 1, 24,
+    1, 25, 1, 26, 1, 27, 1, 0, 5, 0, 1, 28,
+    1, 29, 1, 30, 1, 31, 1, 32, 1, 33, 1, 34,
+    1, 35, 1, 36, 1, 37, 1, 0, 5, 0, 1, 38,
+    1, 39, 1, 40, 1, 41, 1, 42, 1, 43, 1, 44,
+    1, 45, 1, 46, 1, 47, 1, 0, 7, 0, 1, 48,
+    1, 49, 1, 50, 1, 51, 1, 52, 1, 53, 1, 54,
+    1, 55, 1, 0, 7, 0, 1, 56, 1, 57, 1, 58,
+    1, 59, 1, 60, 1, 61, 3, 0, 6, 0, 1, 62,
+    1, 57, 1, 58, 1, 63, 1, 64, 1, 65, 4, 0,
+    5, 0, 1, 66, 1, 67, 1, 68, 1, 69, 1, 70,
+    1, 71, 5, 0, 4, 0, 1, 72, 1, 73, 1, 74,
+    1, 75, 1, 76, 1, 77, 1, 78, 5, 0, 3, 0,
+    1, 79, 1, 80, 1, 81, 1, 82, 1, 83, 1, 84,
+    1, 85, 1, 86, 5, 0, 2, 0, 1, 87, 1, 88,
+    1, 89, 1, 90, 1, 91, 1, 92, 1, 93, 1, 94,
+    1, 95, 1, 96, 4, 0, 1, 0, 1, 97, 1, 98,
+    1, 99, 1, 100, 1, 101, 1, 102, 1, 103, 1, 104,
+    1, 105, 1, 106, 1, 107, 1, 108, 3, 0, 1, 0,
+    1, 109, 1, 110, 1, 111, 1, 112, 1, 113, 1, 114,
+    1, 115, 1, 116, 1, 117, 1, 118, 1, 119, 1, 120,
+    3, 0, 1, 0, 1, 121, 1, 122, 1, 123, 1, 124,
+    1, 125, 2, 126, 1, 127, 1, 128, 1, 129, 1, 130,
+    4, 0, 2, 0, 1, 131, 7, 132, 1, 133, 5, 0,
+};
+HOTMEM const uint16_t charset_lines[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 23, 31, 39, 47, 55, 63,
+    71, 79, 87, 95, 103, 109, 117, 125, 133, 139, 140, 141,
+    151, 159, 167, 178, 188, 195, 196, 197, 198, 199, 200, 201,
+    202, 203, 204, 205, 208, 215, 224, 234, 246, 257, 269, 282,
+    295, 310, 325, 341, 354, 366, 377, 383, 384, 392, 404, 418,
+    430, 444, 460, 474, 486, 499, 513, 527, 543, 556, 568, 580,
+    587, 588, 592, 596, 602, 608, 618, 632, 647, 663, 677, 688,
+    699, 711, 723, 736, 747, 754, 755, 761, 767, 775, 787, 800,
+    811, 825, 838, 853, 868, 884, 899, 913, 925, 934, 940, 941,
+    942, 948, 953, 958, 965, 971, 975, 976, 977, 978, 979, 980,
+    981, 982, 983, 984, 985, 992, 1001, 1011, 1022, 1033, 1043, 1051,
+    1059, 1067, 1074, 1082, 1093, 1104, 1114, 1123, 1130, 1131, 1138, 1146,
+    1155, 1165, 1176, 1186, 1194, 1201, 1208, 1216, 1225, 1236, 1246, 1255,
+    1263, 1269, 1270, 1271, 1272, 1279, 1288, 1299, 1310, 1322, 1333, 1343,
+    1352, 1359, 1365, 1369, 1370, 1371, 1372, 1373, 1374, 1383, 1394, 1407,
+    1418, 1428, 1440, 1450, 1460, 1472, 1483, 1492, 1503, 1514, 1523, 1524,
+    1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1541,
+    1546, 1551, 1558, 1564, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1576,
+    1578, 1580, 1582, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592,
+    1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1609,
+    1614, 1619, 1625, 1626, 1627, 1630, 1633, 1636, 1639, 1642, 1645, 1648,
+    1651, 1654, 1657, 1659, 1661, 1663, 1665, 1667, 1668, 1675, 1682, 1690,
+    1700, 1712, 1726, 1736, 1749, 1759, 1771, 1782, 1796, 1810, 1822, 1832,
+    1838, 1839, 1845, 1853, 1864, 1876, 1888, 1899, 1910, 1916, 1924, 1932,
+    1939, 1946, 1954, 1962, 1970, 1975, 1976, 1984, 1993, 2004, 2018, 2032,
+    2045, 2056, 2064, 2072, 2084, 2096, 2111, 2125, 2136, 2144, 2148, 2149,
+    2156, 2165, 2176, 2190, 2205, 2218, 2229, 2237, 2244, 2256, 2270, 2284,
+    2299, 2309, 2318, 2323, 2324, 2329, 2336, 2345, 2354, 2362, 2372, 2382,
+    2392, 2406, 2418, 2430, 2441, 2448, 2455, 2461, 2465, 2466, 2475, 2487,
+    2500, 2509, 2516, 2527, 2539, 2553, 2566, 2580, 2590, 2598, 2607, 2616,
+    2623, 2629, 2630, 2636, 2644, 2652, 2661, 2668, 2678, 2687, 2701, 2714,
+    2727, 2739, 2752, 2764, 2774, 2782, 2789, 2790, 2798, 2809, 2824, 2839,
+    2854, 2867, 2879, 2888, 2895, 2903, 2910, 2918, 2926, 2934, 2941, 2947,
+    2948, 2956, 2965, 2975, 2986, 2998, 3008, 3016, 3023, 3033, 3044, 3058,
+    3072, 3085, 3096, 3104, 3110, 3111, 3118, 3128, 3141, 3152, 3165, 3178,
+    3189, 3201, 3213, 3222, 3229, 3236, 3244, 3251, 3258, 3262, 3263, 3264,
+    3265, 3269, 3275, 3283, 3291, 3297, 3301, 3307, 3315, 3323, 3331, 3337,
+    3338, 3339, 3340, 3341, 3342, 3343, 3347, 3353, 3361, 3369, 3375, 3379,
+    3385, 3393, 3401, 3409, 3416, 3421, 3426, 3430, 3431, 3432, 3433, 3436,
+    3439, 3442, 3445, 3448, 3451, 3454, 3457, 3460, 3463, 3466, 3469, 3470,
+    3471, 3472, 3473, 3474, 3475, 3477, 3479, 3481, 3483, 3485, 3487, 3488,
+    3490, 3492, 3494, 3496, 3498, 3500, 3501, 3502, 3503, 3506, 3509, 3512,
+    3515, 3518, 3521, 3524, 3527, 3530, 3533, 3536, 3537, 3538, 3539, 3540,
+    3541, 3550, 3561, 3574, 3587, 3599, 3611, 3621, 3631, 3639, 3647, 3654,
+    3661, 3668, 3675, 3682, 3689, 3690, 3691, 3694, 3699, 3704, 3710, 3718,
+    3727, 3734, 3739, 3744, 3749, 3752, 3755, 3758, 3761, 3762, 3766, 3771,
+    3777, 3784, 3792, 3801, 3810, 3821, 3832, 3845, 3859, 3873, 3889, 3904,
+    3916, 3924, 3928, 3937, 3948, 3959, 3971, 3984, 3997, 4009, 4020, 4032,
+    4044, 4056, 4068, 4079, 4091, 4103, 4113, 4119, 4125, 4133, 4142, 4152,
+    4163, 4174, 4186, 4195, 4204, 4212, 4222, 4233, 4244, 4254, 4263, 4271,
+    4274, 4280, 4288, 4297, 4307, 4317, 4329, 4341, 4353, 4365, 4377, 4389,
+    4401, 4413, 4424, 4434, 4441, 4442, 4451, 4461, 4472, 4484, 4496, 4508,
+    4517, 4528, 4539, 4550, 4561, 4572, 4582, 4592, 4601, 4608, 4609, 4615,
+    4626, 4638, 4649, 4660, 4671, 4681, 4691, 4701, 4711, 4721, 4728, 4734,
+    4740, 4746, 4753, 4759, 4765, 4774, 4784, 4795, 4807, 4819, 4831, 4843,
+    4855, 4867, 4879, 4891, 4902, 4913, 4923, 4932, 4936, 4941, 4952, 4964,
+    4976, 4988, 5002, 5016, 5029, 5043, 5057, 5071, 5084, 5097, 5110, 5123,
+    5135, 5142, 5148, 5155, 5162, 5169, 5176, 5183, 5190, 5197, 5204, 5212,
+    5219, 5226, 5233, 5240, 5247, 5254, 5255, 5260, 5267, 5274, 5281, 5288,
+    5294, 5300, 5306, 5312, 5321, 5332, 5344, 5356, 5367, 5377, 5386, 5390,
+    5396, 5402, 5411, 5422, 5435, 5449, 5462, 5475, 5487, 5496, 5506, 5517,
+    5529, 5542, 5554, 5564, 5569, 5575, 5581, 5587, 5594, 5601, 5607, 5613,
+    5619, 5625, 5631, 5642, 5653, 5664, 5675, 5686, 5696, 5701, 5702, 5709,
+    5718, 5729, 5740, 5755, 5770, 5786, 5802, 5818, 5834, 5850, 5866, 5878,
+    5889, 5898, 5904, 5908, 5915, 5923, 5932, 5942, 5954, 5967, 5980, 5993,
+    6006, 6020, 6034, 6047, 6059, 6070, 6080, 6081, 6084, 6092, 6102, 6113,
+    6125, 6138, 6152, 6165, 6177, 6191, 6205, 6218, 6230, 6240, 6250, 6258,
+    6259, 6262, 6271, 6282, 6294, 6306, 6319, 6332, 6345, 6358, 6370, 6381,
+    6392, 6401, 6409, 6416, 6422, 6425, 6426, 6433, 6443, 6454, 6466, 6479,
+    6492, 6503, 6517, 6531, 6545, 6559, 6573, 6586, 6599, 6610, 6615, 6620,
+    6631, 6643, 6656, 6669, 6682, 6695, 6708, 6720, 6731, 6742, 6754, 6767,
+    6780, 6792, 6802, 6808, 6812, 6819, 6829, 6839, 6850, 6861, 6872, 6883,
+    6893, 6903, 6913, 6922, 6932, 6942, 6952, 6961, 6967, 6971, 6983, 6996,
+    7009, 7022, 7035, 7046, 7053, 7059, 7065, 7071, 7077, 7084, 7091, 7098,
+    7106, 7113, 7114, 7125, 7137, 7149, 7161, 7173, 7184, 7195, 7208, 7221,
+    7234, 7247, 7260, 7271, 7281, 7289, 7294, 7295, 7304, 7315, 7327, 7341,
+    7355, 7367, 7379, 7389, 7399, 7408, 7416, 7423, 7429, 7434, 7439, 7442,
+    7443, 7452, 7464, 7478, 7493, 7509, 7525, 7541, 7557, 7573, 7589, 7603,
+    7616, 7628, 7638, 7646, 7654, 7655, 7658, 7666, 7678, 7693, 7707, 7720,
+    7732, 7742, 7752, 7763, 7776, 7790, 7805, 7819, 7832, 7846, 7847, 7852,
+    7861, 7873, 7889, 7904, 7918, 7930, 7940, 7949, 7957, 7964, 7971, 7978,
+    7985, 7992, 7998, 7999, 8010, 8020, 8032, 8044, 8056, 8066, 8074, 8082,
+    8090, 8099, 8109, 8121, 8135, 8149, 8161,
+};
 
-PROGMEM const uint32_t charset_data[59][272] = {
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffd7eea4, 0xffffffed, 0xffbfe56a, 0xff82583f, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd7f0a5, 0xfff1fad9, 0xffacdc44,
-     0xff7e6340, 0xff6c1a4a, 0xff753448, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfffffffb, 0xffeaa4e1, 0xffa73ba4, 0xff751a5f, 0xff795345,
-     0xff83574a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffc4ff,
-     0xffdc62df, 0xff9b309b, 0xff8c1690, 0xff866e4c, 0xff847a46, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffffe1fe, 0xffc658c5, 0xff921f98,
-     0xff831b7d, 0xff865e45, 0xff949439, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfffcffec, 0xffb5be64, 0xff863170, 0xff6b194b, 0xff9daf3b,
-     0xff95a136, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffcffed,
-     0xffabe240, 0xff794b40, 0xff6a164c, 0xffa6b636, 0xff877042, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfffdffef, 0xffaddb47, 0xff7b4649,
-     0xff6c1b49, 0xff9a9c42, 0xff8c6b46, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffecffb8, 0xffaede48, 0xff794844, 0xff6e1a4a, 0xff8c9244,
-     0xff939b49, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff9ebd37,
-     0xffa9dc3e, 0xff953d86, 0xff9b269d, 0xffa38c6c, 0xff7e5943, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff764642, 0xff9e5f7b, 0xffb941c0,
-     0xffb84cb8, 0xffb044af, 0xff6f264c, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffc1a098, 0xffec7af8, 0xffc54dcb, 0xff902e84,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcee98a,
-     0xfffffffd, 0xffe9e1c6, 0xffb98887, 0xff7f3f4f, 0xff733047, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffc5e67f, 0xffecffc3, 0xff9dc437,
-     0xff7c503c, 0xff783e49, 0xff928347, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff8fbe3b, 0xff9ab63a, 0xff814a49, 0xff78394d, 0xff9ab03e,
-     0xff8a813b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff824d4d, 0xff773149, 0xff958a46, 0xff95993c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffffffff, 0xffffefe7, 0xffffd6d6, 0xff9c6b73,
-     0xffffffff, 0xffffefe7, 0xffffd6d6, 0xff9c6b73, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffffefe7, 0xffa57373, 0xffa57373, 0xff733939, 0xffffefe7, 0xffa57373,
-     0xffa57373, 0xff845a5a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffd6d6, 0xffad7b7b,
-     0xffad7b7b, 0xff733939, 0xffffd6d6, 0xffad7b7b, 0xffad7b7b, 0xff845a5a,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffffd6d6, 0xffd6a5a5, 0xffb58484, 0xffa56b6b, 0xffb58c8c,
-     0xffd6a5a5, 0xffb58484, 0xffa56b6b, 0xff845a5a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffd6d6,
-     0xffb58c8c, 0xffbd9494, 0xff733939, 0xffffd6d6, 0xffb58c8c, 0xffbd9494,
-     0xff845a5a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb58c8c, 0xff845a5a, 0xff845a5a,
-     0x00000000, 0xffb58c8c, 0xff845a5a, 0xff845a5a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0810ff, 0xff0810ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff7373ff, 0xff2931ff, 0xff2129ff,
-     0xff1018ff, 0xff0808d6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff636bef, 0xff9c9cff, 0xff9ca5ff, 0xff2939ff, 0xff394aff, 0xff1818f7,
-     0xff0808c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff9ca5de, 0xff8c94ef,
-     0xff949cf7, 0xff1821ff, 0xff3139ff, 0xff2931ff, 0xff0810e7, 0xff0808b5,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff0808b5, 0xff636bd6, 0xff7373de, 0xff4a52e7, 0xff0810e7,
-     0xff1010e7, 0xff1018ef, 0xff1010e7, 0xff0808c6, 0xff0808ad, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff080873, 0xff080873,
-     0xff18217b, 0xff2131ad, 0xff1010c6, 0xff0808d6, 0xff0808ce, 0xff0808bd,
-     0xff0808bd, 0xff0808bd, 0xff0808b5, 0xff08089c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff081073, 0xff294263, 0xff314a73,
-     0xff213952, 0xff21297b, 0xff18219c, 0xff10189c, 0xff080894, 0xff08089c,
-     0xff0808a5, 0xff0808a5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa5bdd6, 0xff9cceef, 0xffe7cebd, 0xff9ccee7,
-     0xff7bbdff, 0xff6ba5ef, 0xff3963a5, 0xff081073, 0xff080884, 0xff08088c,
-     0xff08087b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff6b9cc6, 0xffcee7f7, 0xff9c7b4a, 0xff739cb5, 0xff7bbdff, 0xff639cde,
-     0xff214273, 0xff10295a, 0xff73b5e7, 0xff6badef, 0xff3952a5, 0x00000000,
-     0x00000000, 0x00000000, 0xff7bc6ff, 0xff639ce7, 0xff639cd6, 0xffbdd6e7,
-     0xff947b42, 0xff73b5de, 0xff7bbdff, 0xff4a7bb5, 0xff183163, 0xff4a7ba5,
-     0xff6394d6, 0xff5a8cce, 0xff639cde, 0x00000000, 0x00000000, 0xff7bc6ff,
-     0xff8cd6ff, 0xff6badf7, 0xff5284bd, 0xff73add6, 0xff637384, 0xff39424a,
-     0xff6ba5de, 0xff639ce7, 0xff183163, 0xff5a94c6, 0xff4a6ba5, 0xff73b5ef,
-     0xff73b5ef, 0x00000000, 0x00000000, 0xff639ce7, 0xff6ba5ef, 0xff5284c6,
-     0xff395a8c, 0xff212931, 0xff292929, 0xff212939, 0xff639ce7, 0xff639cde,
-     0xff42639c, 0xff639ce7, 0xff6badef, 0xff7bc6f7, 0xff5284bd, 0x00000000,
-     0x00000000, 0x00000000, 0xff426ba5, 0xff29426b, 0xff101821, 0xff080808,
-     0xff101829, 0xff6ba5ef, 0xff6394de, 0xff5a8cce, 0xff527bbd, 0xff426ba5,
-     0xff396394, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff182139, 0xff29395a, 0xff395a84, 0xff5284c6, 0xff5a94d6,
-     0xff5284c6, 0xff4a73ad, 0xff395a8c, 0xff314a73, 0xff081029, 0xff081029,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff395a8c, 0xff527bbd, 0xff5a8cce, 0xff426b9c, 0xff395a8c, 0xff31527b,
-     0xff314a7b, 0xff102142, 0xff081029, 0xff081029, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4a6ba5,
-     0xff395a94, 0xff31527b, 0xff314a7b, 0xff314a7b, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0073c6,
-     0xff0094de, 0xff10adef, 0xff00a5e7, 0xff0084ce, 0xff005ab5, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff006bc6, 0xff00bdff, 0xff29efff, 0xff84ffff, 0xff5af7ff,
-     0xff31bdef, 0xff29a5d6, 0xff218cce, 0xff0063bd, 0xff004294, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0063bd, 0xff00a5ff,
-     0xff21ceff, 0xff94ffff, 0xff6bdef7, 0xff4aa5c6, 0xff429cbd, 0xff216b9c,
-     0xff429cc6, 0xff4aa5c6, 0xff217bb5, 0xff00428c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff0084f7, 0xff0094ff, 0xff73ffff, 0xff6befff,
-     0xff4aa5c6, 0xff4aa5c6, 0xff216b9c, 0xff21639c, 0xff318cbd, 0xff4aa5c6,
-     0xff4aa5c6, 0xff217bad, 0x00000000, 0x00000000, 0x00000000, 0xff006bce,
-     0xff0094f7, 0xff29c6ff, 0xff6bf7ff, 0xff4aa5ce, 0xff4aa5c6, 0xff4aa5c6,
-     0xff186ba5, 0xff318cc6, 0xff2984bd, 0xff429cc6, 0xff4aa5c6, 0xff4aa5c6,
-     0xff004a8c, 0x00000000, 0x00000000, 0xff0094ef, 0xff009cef, 0xff31c6ff,
-     0xff4abdef, 0xff3184ad, 0xff18639c, 0xff105a94, 0xff3184c6, 0xff318cce,
-     0xff298cc6, 0xff105a94, 0xff186b9c, 0xff3184ad, 0xff216b9c, 0x00000000,
-     0x00000000, 0xff0094e7, 0xff0094e7, 0xff109cde, 0xff298cbd, 0xff00397b,
-     0xff2173b5, 0xff297bbd, 0xff318cce, 0xff318cce, 0xff2173bd, 0xff1863a5,
-     0xff1063a5, 0xff2194c6, 0xff318cbd, 0x00000000, 0x00000000, 0xff008cd6,
-     0xff0094de, 0xff29ade7, 0xff42a5ce, 0xff1873ad, 0xff318cce, 0xff318cce,
-     0xff318cce, 0xff318cce, 0xff318cce, 0xff3994d6, 0xffc6ffff, 0xff84ffff,
-     0xff4aa5c6, 0x00000000, 0x00000000, 0xff007bc6, 0xff008cce, 0xff31b5e7,
-     0xff42a5ce, 0xff4aa5ce, 0xff2984bd, 0xff318cce, 0xff318cce, 0xff318cce,
-     0xff318cce, 0xff6bffff, 0xff9cffff, 0xff4aadce, 0xff4aa5c6, 0x00000000,
-     0x00000000, 0xff0063b5, 0xff0063ad, 0xff2184b5, 0xff399cc6, 0xff4aadce,
-     0xff429cc6, 0xff318cce, 0xff318cce, 0xff318cce, 0xff3994ce, 0xff42adde,
-     0xff399cce, 0xff4aa5c6, 0xff4294bd, 0x00000000, 0x00000000, 0xff004a94,
-     0xff004a94, 0xff2184b5, 0xff4aadce, 0xff4aadce, 0xff3994ce, 0xff3194d6,
-     0xff21b5f7, 0xff2994d6, 0xff318cce, 0xff39a5e7, 0xff2194ce, 0xff4aa5ce,
-     0xff29739c, 0x00000000, 0x00000000, 0xff003184, 0xff00317b, 0xff005a9c,
-     0xff2184b5, 0xff52adce, 0xff107bbd, 0xff10deff, 0xff4affff, 0xff39b5de,
-     0xff1084c6, 0xff29bdf7, 0xff1094ce, 0xff42a5ce, 0xff08427b, 0x00000000,
-     0x00000000, 0x00000000, 0xff00185a, 0xff003173, 0xff186bad, 0xff429cc6,
-     0xff18ade7, 0xff52e7ff, 0xff52b5d6, 0xff4aadce, 0xff4aadce, 0xff2194ce,
-     0xff31bdef, 0xff398cb5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff002163, 0xff001852, 0xff084a84, 0xff2973ad, 0xff4aa5c6, 0xff52b5d6,
-     0xff52b5d6, 0xff52adce, 0xff4aadce, 0xff4aadce, 0xff398cb5, 0xff00296b,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00296b,
-     0xff002963, 0xff185a8c, 0xff296b9c, 0xff317ba5, 0xff42a5c6, 0xff4aadce,
-     0xff3994bd, 0xff186394, 0xff002163, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00316b,
-     0xff004273, 0xff004273, 0xff003973, 0xff00316b, 0xff002163, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff10c6ff, 0xff0884ce, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff21e7ff,
-     0xff088cd6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff10c6ff, 0xff4af7ff, 0xff109ce7, 0xff00529c,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff18d6ff, 0xff4affff, 0xff10adef, 0xff0873bd, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff10c6ff, 0xff18deff, 0xff31f7ff, 0xff39f7ff,
-     0xff10b5f7, 0xff0894de, 0xff0884ce, 0xff088cd6, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff10c6ff, 0xff21d6ff, 0xff10c6ff, 0xff10c6ff,
-     0xff21deff, 0xff5affff, 0xff6bffff, 0xff31e7ff, 0xff10b5ff, 0xff10adf7,
-     0xff10b5ff, 0xff10bdff, 0xff10bdff, 0xff10b5ff, 0xff10a5ef, 0xff0873bd,
-     0xff0873bd, 0xff18bdf7, 0xff42e7ff, 0xff42f7ff, 0xff39ffff, 0xff63ffff,
-     0xff103963, 0xff18b5ef, 0xff1094de, 0xff002152, 0xff18c6ff, 0xff18c6ff,
-     0xff10b5ff, 0xff0894de, 0xff0863ad, 0xff00397b, 0x00000000, 0xff004a94,
-     0xff0884ce, 0xff10b5f7, 0xff18ceff, 0xff21d6ff, 0xff001842, 0xff108cd6,
-     0xff0884ce, 0xff001042, 0xff10b5f7, 0xff109ce7, 0xff087bc6, 0xff004a8c,
-     0xff003173, 0x00000000, 0x00000000, 0x00000000, 0xff00529c, 0xff0884ce,
-     0xff10adf7, 0xff10b5ff, 0xff001042, 0xff1094de, 0xff0884ce, 0xff001039,
-     0xff0894de, 0xff0873bd, 0xff004284, 0xff003173, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff0894de, 0xff10bdff, 0xff18c6ff,
-     0xff003173, 0xff109ce7, 0xff109ce7, 0xff00316b, 0xff0894de, 0xff086bb5,
-     0xff00397b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff08a5ef, 0xff18d6ff, 0xff18ceff, 0xff10b5f7, 0xff10a5ef,
-     0xff10adf7, 0xff10adf7, 0xff089ce7, 0xff0873bd, 0xff003984, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff10bdff,
-     0xff18ceff, 0xff10b5ff, 0xff089ce7, 0xff088cd6, 0xff0894de, 0xff10a5ef,
-     0xff109cef, 0xff0884ce, 0xff004a8c, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff10ceff, 0xff10bdff, 0xff088cd6,
-     0xff0863ad, 0xff0063ad, 0xff086bb5, 0xff0884ce, 0xff089ce7, 0xff0894de,
-     0xff005aa5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff10bdff, 0xff10b5ff, 0xff0884ce, 0xff004a94, 0xff00397b, 0xff00397b,
-     0xff004284, 0xff005294, 0xff0873bd, 0xff088cd6, 0xff087bc6, 0xff003984,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff10adf7, 0xff0873bd,
-     0xff004284, 0xff00397b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff004284, 0xff005a9c, 0xff086bb5, 0xff004a8c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff005aa5, 0xff00397b, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff004284, 0xff00397b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff081821, 0xff081821, 0x00000000, 0x00000000,
-     0xff082129, 0xff102931, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff189cef, 0xff084a73, 0xff08426b, 0xff081821, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff10426b, 0xff10394a, 0xff21526b, 0xff2173ad,
-     0xff18a5ff, 0xff188cf7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff393931, 0xff212121, 0xff081829,
-     0xff423939, 0xffbdb5b5, 0xffb5b5ad, 0xff313131, 0xff218cde, 0xff189cff,
-     0xff1884e7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff292121, 0xffefdece, 0xffa59c9c, 0xff948c84, 0xfffffff7, 0xffffffff,
-     0xffffffff, 0xff949494, 0xff293942, 0xff1894ff, 0xff1884e7, 0xff1063b5,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff736b63, 0xffc6b5ad,
-     0xffded6ce, 0xffe7ded6, 0xffcec6c6, 0xffffffff, 0xffffffff, 0xffffffff,
-     0xff101010, 0xff10427b, 0xff105aa5, 0xff105aa5, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffb5a59c, 0xff635a5a, 0xffe7ded6, 0xff94948c,
-     0xff737373, 0xffffffff, 0xffffffff, 0xfff7f7ef, 0xff101010, 0xff081018,
-     0xff080810, 0xff080808, 0xff081831, 0x00000000, 0x00000000, 0x00000000,
-     0xffad9c94, 0xffa5a5ad, 0xff182121, 0xff9c9494, 0xfff7f7f7, 0xffffffff,
-     0xffffffff, 0xff6b6363, 0xff081021, 0xff08315a, 0xff08396b, 0xff083963,
-     0xff083963, 0x00000000, 0x00000000, 0x00000000, 0xff31526b, 0xff29c6ff,
-     0xff1073c6, 0xff102129, 0xff7b7b7b, 0xff949494, 0xff4a4a4a, 0xff080810,
-     0xff08294a, 0xff10528c, 0xff187be7, 0xff106bc6, 0xff105294, 0x00000000,
-     0x00000000, 0xff18adff, 0xff189cef, 0xff187bde, 0xff105a94, 0xff218cb5,
-     0xff187bb5, 0xff188cc6, 0xff188cc6, 0xff188cde, 0xff1884e7, 0xff1884ef,
-     0xff187bde, 0xff106bbd, 0xff105294, 0x00000000, 0x00000000, 0xff189cff,
-     0xff18a5ff, 0xff105aa5, 0xff189cff, 0xff18adff, 0xff21b5ff, 0xff31ceff,
-     0xff21b5ff, 0xff189cff, 0xff1884e7, 0xff1073d6, 0xff1073ce, 0xff105aa5,
-     0xff104273, 0x00000000, 0x00000000, 0xff107bd6, 0xff1884ef, 0xff1042ad,
-     0xff083184, 0xff104aa5, 0xff189cff, 0xff189cff, 0xff188cff, 0xff187be7,
-     0xff106bc6, 0xff1063b5, 0xff1063ad, 0xff10427b, 0xff08315a, 0x00000000,
-     0x00000000, 0x00000000, 0xff106bbd, 0xff105ade, 0xff080873, 0xff08186b,
-     0xff1073d6, 0xff107bde, 0xff1073ce, 0xff1063b5, 0xff105a9c, 0xff104a8c,
-     0xff104273, 0xff08315a, 0xff08315a, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff104a84, 0xff104ade, 0xff1052ce, 0xff10528c, 0xff10528c,
-     0xff104a8c, 0xff104a7b, 0xff084273, 0xff08396b, 0xff083963, 0xff083163,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff104a84, 0xff105a9c, 0xff105294, 0xff104273, 0xff104273, 0xff084273,
-     0xff08396b, 0xff08396b, 0xff083963, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff104273, 0xff104273, 0xff084273, 0xff08426b, 0xff08396b, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffffffff, 0xffffefe7, 0xffffd6d6, 0xffd6a5a5, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffefe7, 0xffa57373,
-     0xffa57373, 0xff845a5a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffffd6d6, 0xffad7b7b, 0xffad7b7b, 0xff845a5a,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffd6d6,
-     0xffd6a5a5, 0xffb58484, 0xffa56b6b, 0xff845a5a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffffd6d6, 0xffb58c8c, 0xffbd9494,
-     0xff845a5a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffd6a5a5, 0xff845a5a, 0xff845a5a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff9bbb32, 0xffacdd46, 0xffabdb43,
-     0xffa8e82d, 0xff9fb23b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffb9e160, 0xfff0fecd, 0xfff7b1ec, 0xffe884d8, 0xffb4c358, 0xffa6ee2d,
-     0xffa1d03b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbbe466, 0xfffffff7, 0xffdbafc5,
-     0xffb436bb, 0xffa335a6, 0xff9720a0, 0xff826150, 0xffa4db37, 0xff97bb46,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff97b635, 0xffecffbf, 0xffc5ed76, 0xff815c44, 0xff8c1694, 0xff8f1b96,
-     0xff8b2a7a, 0xff814f49, 0xff9cc641, 0xff8e8546, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc4e378, 0xffdfff9b,
-     0xff89922e, 0xff6c194b, 0xff813a5c, 0xff98616f, 0xff917e49, 0xff919147,
-     0xff866a4a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffa9df3e, 0xffd6fe88, 0xffa1ba4b, 0xff743248, 0xff763949,
-     0xff8f8745, 0xff815842, 0xff927c47, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd1fd6a,
-     0xffd0ff78, 0xff898b35, 0xff6d154e, 0xff877b4b, 0xff8a6e4a, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfffffbff, 0xffdcff9a, 0xff898e33,
-     0xff742e4c, 0xffa1c738, 0xff957e46, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfffffdff, 0xffddff9d, 0xff898d32, 0xff71294c, 0xffa8d430,
-     0xff988342, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffd9ff94, 0xff87912c, 0xff752452, 0xff897149, 0xff835646, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffebffc1, 0xff998d50,
-     0xff8f1b93, 0xff8d2e7b, 0xff82524b, 0xff9dbe3c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffecebe1, 0xff962b95, 0xff912590, 0xff94239a,
-     0xff893572, 0xff99bc32, 0xffbbeb5d, 0xffddfb99, 0xffbfd493, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe1eeca, 0xffb971bb, 0xff830587, 0xff901d95, 0xff78275b, 0xff7b3d49,
-     0xff826d40, 0xffa2d144, 0xffe5f8b9, 0xffabde43, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff9f0ff,
-     0xffc3a2a7, 0xff865b53, 0xff6b1d46, 0xff671748, 0xff6f174e, 0xff8c8a3d,
-     0xffc1fd4e, 0xffaedb47, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffddfbab, 0xffadeb33,
-     0xff887648, 0xff7e4b48, 0xff866e4a, 0xff9fc841, 0xff97ae39, 0xff75304f,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff929949, 0xff969848,
-     0xff949d49, 0xff929646, 0xff7d404c, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0xff98cc38, 0xffa7dd39, 0xffbb9398, 0xffa58d72, 0xff8e8437,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff97ad44, 0xffa6e531,
-     0xffc48e96, 0xffc848d2, 0xffb651b5, 0xff926263, 0xff7b4144, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa3e035, 0xff97a649, 0xffa12aa9, 0xff992f98,
-     0xff97249b, 0xff801d73, 0xff682042, 0xff6f254a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff99bb41, 0xff929c43, 0xff771d5a, 0xff8e1e91, 0xff86257b, 0xff6e2748,
-     0xff6d2348, 0xff712c49, 0xff7d4449, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff7c464a, 0xff8e8649,
-     0xff8f8846, 0xff7e434d, 0xff6b1f48, 0xff6b2247, 0xff6f2749, 0xff6b2148,
-     0xff7d4148, 0xff783848, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff8f7649, 0xff835147,
-     0xff865a49, 0xff77324c, 0xff6c2048, 0xff6a1c49, 0xff815d49, 0xff835649,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff867046, 0xff92983e,
-     0xff783e49, 0xff681448, 0xff837348, 0xff845a49, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffc1f45f, 0xff949a42, 0xff690f4e,
-     0xff929239, 0xff887843, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfff6ffe0, 0xffa9e438, 0xff733348, 0xff959935, 0xff9aac32,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd5e0c2, 0xfffffdf9,
-     0xffbca087, 0xff79295c, 0xff815e3f, 0xff8e8a41, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffe1e8d2, 0xfff4fbe4, 0xffe091e3, 0xffad2fb5, 0xff8f1d94,
-     0xff8d535f, 0xff7f5e46, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb6d064, 0xffcaff69, 0xffdeff9d,
-     0xffafd64c, 0xffa43d9c, 0xff8e238d, 0xffa52bb2, 0xff9a5079, 0xff6e3236,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffc7f16f, 0xffc6f073, 0xff8ea738, 0xff898a33, 0xff7d5044, 0xff7b3059,
-     0xff961a9f, 0xffb8878a, 0xff816244, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc8f764, 0xffaadc3d,
-     0xff7a3d4b, 0xff6b154d, 0xff6b1e49, 0xff6b1f48, 0xff999146, 0xffa2c030,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff88773c, 0xff9ecc43, 0xff857246, 0xff7c4641,
-     0xff7c4542, 0xff885d44, 0xff7f743d, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff816f39, 0xff9da359, 0xff905965, 0xff85416a, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff402a79, 0xff452da3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff354efc, 0xff325bfe, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff402a79, 0xff402a79, 0xff452da3,
-     0xff462fc7, 0x00000000, 0x00000000, 0xff354efc, 0xff354efc, 0xff3a75ff,
-     0xff448dff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff402a79, 0xff402a79, 0xff452da3, 0xff452da3, 0xff462fc7, 0xff4334e3,
-     0xff3a3ef0, 0xff354efc, 0xff354efc, 0xff3a75ff, 0xff50beff, 0xff55daff,
-     0x00000000, 0x00000000, 0x00000000, 0xff402a79, 0xff402a79, 0xff452da3,
-     0xff452da3, 0xff462fc7, 0xff462fc7, 0xff4334e3, 0xff354efc, 0xff354efc,
-     0xff3a75ff, 0xff3a75ff, 0xff50beff, 0xff55daff, 0xff7bf3ff, 0x00000000,
-     0x00000000, 0xff402a79, 0xff452da3, 0xff462fc7, 0xff462fc7, 0xff4334e3,
-     0xff4334e3, 0xff3a3ef0, 0xff354efc, 0xff3a75ff, 0xff3a75ff, 0xff448dff,
-     0xff55daff, 0xff55daff, 0xff7bf3ff, 0x00000000, 0x00000000, 0xff452da3,
-     0xff462fc7, 0xff462fc7, 0xff4334e3, 0xff3a3ef0, 0xff354efc, 0xff354efc,
-     0xff354efc, 0xff3a75ff, 0xff448dff, 0xff55daff, 0xff55daff, 0xff7bf3ff,
-     0xff7bf3ff, 0x00000000, 0x00000000, 0x00000000, 0xff462fc7, 0xff3a3ef0,
-     0xff3a3ef0, 0xff354efc, 0xff354efc, 0xff3a75ff, 0xff3a75ff, 0xff448dff,
-     0xff50beff, 0xff55daff, 0xff7bf3ff, 0xff7bf3ff, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff3a3ef0, 0xff354efc, 0xff354efc,
-     0xff3a75ff, 0xff448dff, 0xff448dff, 0xff50beff, 0xff55daff, 0xff7bf3ff,
-     0xff7bf3ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff325bfe, 0xff3a75ff, 0xff3a75ff, 0xff448dff,
-     0xff50beff, 0xff7bf3ff, 0xff7bf3ff, 0xff7bf3ff, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff448dff, 0xff50beff, 0xff55daff, 0xff7bf3ff,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff55daff, 0xff7bf3ff, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff3139de, 0xff4a5af7, 0xff21218c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff181884, 0xff2931ad, 0xff182173, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff3139de, 0xff6373ff,
-     0xff424ade, 0xff2931b5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff3139d6, 0xff2931bd, 0xff2931ad, 0xff182173, 0x00000000, 0x00000000,
-     0x00000000, 0xff3139de, 0xff5a63ff, 0xff3942d6, 0xff2939ce, 0xff2939ce,
-     0xff2129a5, 0x00000000, 0x00000000, 0xff3139ce, 0xff2931c6, 0xff2931bd,
-     0xff2931bd, 0xff2931ad, 0xff182173, 0x00000000, 0x00000000, 0xff29298c,
-     0xff3142ce, 0xff2939ce, 0xff2939ce, 0xff2939c6, 0xff2939c6, 0xff21218c,
-     0xff2931c6, 0xff2931c6, 0xff2931bd, 0xff2931bd, 0xff2931bd, 0xff2931b5,
-     0xff10104a, 0x00000000, 0x00000000, 0x00000000, 0xff10186b, 0xff2931b5,
-     0xff2939c6, 0xff2939c6, 0xff2939c6, 0xff3142de, 0xff2939c6, 0xff2931bd,
-     0xff2931bd, 0xff2931bd, 0xff2931ad, 0xff10104a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff10105a, 0xff2931b5, 0xff2939c6,
-     0xff3952e7, 0xff39a5ff, 0xff3184de, 0xff2942bd, 0xff2931bd, 0xff2131a5,
-     0xff080842, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff10105a, 0xff3142c6, 0xff3994f7, 0xff5ad6ff,
-     0xff298cd6, 0xff21528c, 0xff21299c, 0xff080842, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff182194, 0xff3142ce, 0xff2973ce, 0xff2984c6, 0xff216b9c, 0xff103152,
-     0xff101842, 0xff101052, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff21219c, 0xff2939c6, 0xff2931bd,
-     0xff2939bd, 0xff183973, 0xff10294a, 0xff101842, 0xff10184a, 0xff2931bd,
-     0xff181873, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff2129a5, 0xff3139c6, 0xff2931bd, 0xff2931bd, 0xff2931bd, 0xff2931ad,
-     0xff101842, 0xff101042, 0xff18216b, 0xff2931bd, 0xff2931bd, 0xff18217b,
-     0x00000000, 0x00000000, 0x00000000, 0xff2129ad, 0xff2931bd, 0xff2931bd,
-     0xff2931bd, 0xff2931bd, 0xff2931bd, 0xff10184a, 0xff101852, 0xff21299c,
-     0xff2931bd, 0xff2931bd, 0xff2931bd, 0xff2931bd, 0xff181863, 0x00000000,
-     0x00000000, 0xff101852, 0xff212994, 0xff2931bd, 0xff2931bd, 0xff2931bd,
-     0xff18186b, 0x00000000, 0x00000000, 0xff21218c, 0xff2931bd, 0xff2931bd,
-     0xff2931bd, 0xff182173, 0xff080818, 0x00000000, 0x00000000, 0x00000000,
-     0xff101852, 0xff21298c, 0xff2931b5, 0xff212984, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff2129a5, 0xff2931bd, 0xff18216b, 0xff080821,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff10104a,
-     0xff182173, 0xff080842, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff10105a, 0xff18185a, 0xff080818, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffffffff, 0xffffefe7, 0xffffd6d6, 0xffd6a5a5, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffefe7, 0xffa57373,
-     0xffa57373, 0xff845a5a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffffd6d6, 0xffad7b7b, 0xffad7b7b, 0xff845a5a,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffd6d6,
-     0xffd6a5a5, 0xffb58484, 0xffa56b6b, 0xff845a5a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffffd6d6, 0xffb58c8c, 0xffbd9494,
-     0xff845a5a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffd6a5a5, 0xff845a5a, 0xff845a5a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffffffff, 0xffffefe7, 0xffffd6d6, 0xffd6a5a5, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffefe7,
-     0xffa57373, 0xffa57373, 0xff845a5a, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffffd6d6, 0xffad7b7b, 0xffad7b7b,
-     0xff845a5a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffd6a5a5, 0xffb58484, 0xffa56b6b, 0xff845a5a, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffdef7ff, 0xff00c6ff, 0xff0094ff, 0xff006bff, 0xff0008ff, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffceefff, 0xff0063ff, 0xff0000ff,
-     0xff0000ff, 0xff0008ff, 0xff0000ad, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffbdffff, 0xff0052ff, 0xff0008ff, 0xff0010ff, 0xff0018ff, 0xff0018ff,
-     0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff00bdff, 0xff0010ff,
-     0xff0021ff, 0xff0021ff, 0xff0031ff, 0xff0008ef, 0xff0018f7, 0xff0000de,
-     0xff0000de, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff00ffff, 0xff004aff, 0xff0031ff, 0xff0031ff, 0xff0042ff,
-     0xff0018de, 0x00000000, 0xff0073ff, 0xff004aff, 0xff0029ff, 0xff0000b5,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff009cff,
-     0xff0031ff, 0xff0042ff, 0xff004aff, 0xff0010d6, 0x00000000, 0x00000000,
-     0xff00a5ff, 0xff005aff, 0xff0063ff, 0xff0000e7, 0xff0000b5, 0x00000000,
-     0x00000000, 0x00000000, 0xff00f7ff, 0xff0052ff, 0xff0052ff, 0xff0052ff,
-     0xff0010c6, 0x00000000, 0x00000000, 0x00000000, 0xff00adff, 0xff006bff,
-     0xff006bff, 0xff005aff, 0xff0000bd, 0x00000000, 0x00000000, 0xff00f7ff,
-     0xff0094ff, 0xff005aff, 0xff0063ff, 0xff0039ff, 0xff0000a5, 0x00000000,
-     0x00000000, 0x00000000, 0xff00deff, 0xff007bff, 0xff007bff, 0xff008cff,
-     0xff0000ad, 0x00000000, 0x00000000, 0xff00f7ff, 0xff006bff, 0xff006bff,
-     0xff006bff, 0xff0000ad, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff00e7ff, 0xff008cff, 0xff0094ff, 0xff0094ff, 0xff0000ad, 0x00000000,
-     0xff00ceff, 0xff0084ff, 0xff007bff, 0xff0084ff, 0xff007bff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4affff, 0xff009cff,
-     0xff009cff, 0xff00adff, 0xff0000ad, 0x00000000, 0xff00a5ff, 0xff008cff,
-     0xff008cff, 0xff0094ff, 0xff009cff, 0xff004aff, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffbde7ff, 0xff00adff, 0xff00b5ff, 0xff00b5ff,
-     0xff0000bd, 0x00000000, 0xff0018b5, 0xff007bff, 0xff009cff, 0xff00a5ff,
-     0xff00a5ff, 0xff0094ff, 0xffa5f7ff, 0x00000000, 0x00000000, 0xffa5f7ff,
-     0xff00b5ff, 0xff00c6ff, 0xff00b5ff, 0xff004aef, 0xff0008b5, 0x00000000,
-     0x00000000, 0xff0018b5, 0xff0073ff, 0xff00a5ff, 0xff00bdff, 0xff00bdff,
-     0xff00ceff, 0xffa5f7ff, 0xff8cffff, 0xff00ceff, 0xff00deff, 0xff00a5ff,
-     0xff0039de, 0xff0008b5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0018b5, 0xff006bff, 0xff00a5ff, 0xff00ceff, 0xff00ceff, 0xff00d6ff,
-     0xff00deff, 0xff009cff, 0xff0042d6, 0xff0021d6, 0xff0008b5, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0018b5,
-     0xff005aff, 0xff00a5ff, 0xff00e7ff, 0xff0094ff, 0xff0031c6, 0xff0010c6,
-     0xff0008b5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0018b5, 0xff0008b5,
-     0xff0018b5, 0xff0008b5, 0xff0008b5, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffbdffff, 0xff00e7ff, 0xff0094ff, 0xff0052ff,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xffbdffff,
-     0xff008cff, 0xff0042ff, 0xff0000ff, 0xff0008ff, 0xff0052ff, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffbdffff, 0xffbdffff, 0xff31bdff, 0xff0039ff, 0xff0000ff, 0xff0010ff,
-     0xff0018ff, 0xff0021ff, 0xff0010ff, 0xff0000c6, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff00e7ff, 0xff0029ff,
-     0xff0000ff, 0xff0018ff, 0xff0021ff, 0xff0029ff, 0xff0031ff, 0xff0031ff,
-     0xff0000de, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff00ffff, 0xff0042ff, 0xff0021ff, 0xff0029ff, 0xff0039ff,
-     0xff0031ff, 0xff0039ff, 0xff0042ff, 0xff004aff, 0xff0000bd, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff008cff,
-     0xff0042ff, 0xff0042ff, 0xff004aff, 0xff0000c6, 0xff0094ff, 0xff0052ff,
-     0xff005aff, 0xff0063ff, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0000bd, 0xff0010c6,
-     0xff0008bd, 0xff00c6e7, 0xff00adff, 0xff0063ff, 0xff006bff, 0xff004aff,
-     0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe7ffff,
-     0xff007bff, 0xff007bff, 0xff0084ff, 0xff0000b5, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffe7ffff, 0xff10adff, 0xff0084ff, 0xff008cff,
-     0xff009cff, 0xff0000ad, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe7ffff, 0xff0094ff, 0xff009cff, 0xff00a5ff, 0xff009cff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff29e7ff, 0xff00adff,
-     0xff00b5ff, 0xff00b5ff, 0xff0042e7, 0xff0000bd, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff5affff, 0xff00b5ff, 0xff00c6ff, 0xff00c6ff, 0xff00ceff,
-     0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff5affff,
-     0xff00ceff, 0xff00d6ff, 0xff00deff, 0xff00e7ff, 0xff0000bd, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff00b5ff, 0xff00e7ff, 0xff00efff,
-     0xff00f7ff, 0xff00ffff, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff0084ff, 0xff00deff, 0xff00f7ff, 0xff00ffff, 0xff009cff,
-     0xff0000ad, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0084ff, 0xff0039ff, 0xff0039ff, 0xff0000bd, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbdffff,
-     0xff6befff, 0xff00deff, 0xff007bff, 0xff005aff, 0xff0000b5, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbdffff, 0xffbdffff, 0xff0063ff, 0xff0000ff, 0xff0000ff,
-     0xff0008ff, 0xff0010ff, 0xff0018ff, 0xff0008c6, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xffbdffff, 0xff0063ff,
-     0xff0000ff, 0xff0000ff, 0xff0010ff, 0xff0018ff, 0xff0021ff, 0xff0021ff,
-     0xff0029ff, 0xff0031ff, 0xff0010d6, 0x00000000, 0x00000000, 0x00000000,
-     0xffbdffff, 0xff0063ff, 0xff0000ff, 0xff0000ff, 0xff0008ff, 0xff0021ff,
-     0xff0010ff, 0xff0010ef, 0xff0000d6, 0xff0031ff, 0xff0039ff, 0xff0042ff,
-     0xff004aff, 0xff0000bd, 0x00000000, 0x00000000, 0xff00e7ff, 0xff0021ff,
-     0xff0010ff, 0xff0021ff, 0xff0029ff, 0xff0010ff, 0xff0000d6, 0x00000000,
-     0xff006bff, 0xff004aff, 0xff004aff, 0xff0052ff, 0xff0063ff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0xff0063ff, 0xff0031ff, 0xff0031ff,
-     0xff0008ff, 0xff0000ce, 0x00000000, 0xff00deff, 0xff008cff, 0xff005aff,
-     0xff0063ff, 0xff006bff, 0xff0021d6, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff0008c6, 0xff0008c6, 0xff0000bd, 0x00000000,
-     0xffbdffff, 0xff2194ff, 0xff005aff, 0xff006bff, 0xff0073ff, 0xff0018c6,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff298cff, 0xff0063ff,
-     0xff007bff, 0xff0073ff, 0xff0000a5, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffbdffff, 0xff1084ff, 0xff0073ff, 0xff0084ff, 0xff0063ff, 0xff0000ce,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff007bff, 0xff0084ff,
-     0xff008cff, 0xff0073ff, 0xff0039f7, 0x00000000, 0xff5af7ff, 0xff00f7ff,
-     0xff00b5ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffbdffff, 0xff0084ff, 0xff008cff, 0xff008cff, 0xff0094ff, 0xff0073ff,
-     0xff00f7ff, 0xff5af7ff, 0xff00bdff, 0xff00bdff, 0xff00c6ff, 0xff0063ff,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff008cff, 0xff009cff,
-     0xff00a5ff, 0xff009cff, 0xff009cff, 0xff00deff, 0xff00b5ff, 0xff00bdff,
-     0xff00c6ff, 0xff00d6ff, 0xff00efff, 0xff00deff, 0xff0000ff, 0x00000000,
-     0xff00ceff, 0xff009cff, 0xff00a5ff, 0xff00adff, 0xff00b5ff, 0xff00bdff,
-     0xff00c6ff, 0xff00c6ff, 0xff00d6ff, 0xff00e7ff, 0xff00efff, 0xff00b5ff,
-     0xff0063de, 0xff0021d6, 0xff0021d6, 0x00000000, 0x00000000, 0xff0063ff,
-     0xff00c6ff, 0xff00bdff, 0xff00c6ff, 0xff00ceff, 0xff00deff, 0xff00e7ff,
-     0xff00a5ff, 0xff0021d6, 0xff0021d6, 0xff0021d6, 0xff0021d6, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0029ff, 0xff00d6ff,
-     0xff00deff, 0xff0094ff, 0xff0021d6, 0xff0021d6, 0xff0010c6, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff0018ff, 0xff0021d6, 0xff0021d6,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff00f7ff, 0xff00bdff, 0xff007bff, 0xff0084ff, 0xff0073ff, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff00e7ff, 0xff00ceff, 0xff004aff, 0xff0000ff,
-     0xff0008ff, 0xff0008ff, 0xff0010ff, 0xff0008c6, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff00bdff,
-     0xff0039ff, 0xff0000ff, 0xff0008ff, 0xff0018ff, 0xff0021ff, 0xff0021ff,
-     0xff0021ff, 0xff0029ff, 0xff0000d6, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbdffff, 0xff0029ff, 0xff0000ff, 0xff0010ff, 0xff0021ff,
-     0xff0010ff, 0xff0010ef, 0xff0000d6, 0xff0031ff, 0xff0031ff, 0xff0039ff,
-     0xff0029ff, 0xff0000bd, 0x00000000, 0x00000000, 0xff00e7ff, 0xff0021ff,
-     0xff0010ff, 0xff0021ff, 0xff0008ff, 0xff0010de, 0xff0000d6, 0x00000000,
-     0xff006bff, 0xff0042ff, 0xff004aff, 0xff0052ff, 0xff0029ff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0xff0063ff, 0xff0029ff, 0xff0008ff,
-     0xff0000ce, 0x00000000, 0x00000000, 0xffbdefff, 0xff00a5ff, 0xff0052ff,
-     0xff0063ff, 0xff0021ff, 0xff0000d6, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff0008c6, 0xff0000bd, 0x00000000, 0x00000000,
-     0xffbdefff, 0xff4a94ff, 0xff0052ff, 0xff0063ff, 0xff0018ff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff00d6d6, 0xff298cff, 0xff0063ff,
-     0xff006bff, 0xff0073ff, 0xff0000b5, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff0000de, 0xff006bff, 0xff0084ff, 0xff0084ff,
-     0xff007bff, 0xff0008ef, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffceefff, 0xffcee7ff, 0xff00f7ff, 0x00000000,
-     0x00000000, 0xff0000b5, 0xff006bff, 0xff008cff, 0xff009cff, 0xff008cff,
-     0xff0018ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbdefff,
-     0xff008cff, 0xff007bff, 0xff00a5ff, 0xff00efff, 0x00000000, 0x00000000,
-     0xff000094, 0xff00c6ff, 0xff00adff, 0xff00b5ff, 0xff00adff, 0xff0031ff,
-     0x00000000, 0x00000000, 0xff00e7ff, 0xff0094ff, 0xff008cff, 0xff0094ff,
-     0xff0094ff, 0xff0094ff, 0xff00efff, 0xff00ffff, 0x00000000, 0xff8cffff,
-     0xff00bdff, 0xff00c6ff, 0xff00d6ff, 0xff00c6ff, 0xff0000f7, 0x00000000,
-     0x00000000, 0xff0031ff, 0xff0094ff, 0xff00b5ff, 0xff00adff, 0xff00b5ff,
-     0xff00adff, 0xff00ceff, 0xff00f7ff, 0xff8ce7ff, 0xff00ceff, 0xff00deff,
-     0xff00ceff, 0xff004ade, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0021ff, 0xff0039ff, 0xff00b5ff, 0xff00ceff, 0xff00ceff, 0xff00ceff,
-     0xff00ceff, 0xff00d6ff, 0xff00e7ff, 0xff00c6ff, 0xff0031d6, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0021ff, 0xff0029ff, 0xff00b5ff, 0xff00e7ff, 0xff00e7ff, 0xff00efff,
-     0xff00b5ff, 0xff0021c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0010ff, 0xff0018b5, 0xff0018b5, 0xff0018b5, 0xff0010b5, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffceffff, 0xff00bdff, 0xff006bff, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffceffff, 0xff0039ff,
-     0xff0008ff, 0xff0010ff, 0xff0042ff, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffceffff, 0xff0031ff, 0xff0018ff, 0xff0021ff, 0xff0029ff,
-     0xff0018ff, 0xff00008c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffceffff, 0xff0029ff,
-     0xff0021ff, 0xff0029ff, 0xff0031ff, 0xff0010de, 0xff00008c, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbdffff, 0xff109cff, 0xff0029ff, 0xff0031ff, 0xff0042ff,
-     0xff0042ff, 0xff0021de, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbdffff,
-     0xff0031ff, 0xff0042ff, 0xff004aff, 0xff0031ff, 0xff0052ff, 0xff005aff,
-     0xff0010ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffbdffff, 0xff1094ff, 0xff004aff, 0xff0052ff,
-     0xff0031ff, 0xff0000ce, 0xff0063ff, 0xff0063ff, 0xff0063ff, 0xff0000ce,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffbdffff, 0xff0052ff, 0xff005aff, 0xff005aff, 0xff0000b5, 0xff0884f7,
-     0xff0073ff, 0xff0073ff, 0xff007bff, 0xff0029f7, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff007bff, 0xff0063ff,
-     0xff006bff, 0xff0000ce, 0x00000000, 0xffffffff, 0xff0084ff, 0xff0084ff,
-     0xff008cff, 0xff00adff, 0xff00e7f7, 0xff0010e7, 0x00000000, 0x00000000,
-     0x00000000, 0xffbdffff, 0xff006bff, 0xff0073ff, 0xff007bff, 0xff0042ff,
-     0xffceefff, 0xffceefff, 0xff0094ff, 0xff0094ff, 0xff009cff, 0xff00a5ff,
-     0xff00a5ff, 0xff0031d6, 0x00000000, 0x00000000, 0xff00b5ff, 0xff007bff,
-     0xff0084ff, 0xff0084ff, 0xff008cff, 0xff0094ff, 0xff008cff, 0xff0094ff,
-     0xff00a5ff, 0xff00a5ff, 0xff00bdff, 0xff00c6ff, 0xff00c6ff, 0xff0031d6,
-     0x00000000, 0x00000000, 0xff0000c6, 0xff0073ff, 0xff009cff, 0xff00a5ff,
-     0xff00adff, 0xff00b5ff, 0xff00adff, 0xff00adff, 0xff00b5ff, 0xff00b5ff,
-     0xff0000b5, 0xff0000b5, 0xff0000b5, 0xff0000ce, 0x00000000, 0x00000000,
-     0x00000000, 0xff0000c6, 0xff0000c6, 0xff0000c6, 0xff0000c6, 0xff0000c6,
-     0xff008cff, 0xff00bdff, 0xff00bdff, 0xff00ceff, 0xff0000b5, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00e7ff, 0xff00ceff,
-     0xff00d6ff, 0xff00c6ff, 0xff0000c6, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff00e7ff, 0xff00deff, 0xff00bdff, 0xff0021ce,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0052ff, 0xff0010c6, 0xff0010c6, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffdef7ff,
-     0xff21deff, 0xff21e7ff, 0xff00c6ff, 0xff00c6ff, 0xff00adff, 0xff008cff,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbdffff, 0xffceefff, 0xff0063ff, 0xff0000ff, 0xff0008ff,
-     0xff0010ff, 0xff0018ff, 0xff0021ff, 0xff0029ff, 0xff0008ce, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbdffff,
-     0xff0052ff, 0xff0008ff, 0xff0018ff, 0xff0021ff, 0xff0029ff, 0xff0031ff,
-     0xff0039ff, 0xff0042ff, 0xff0052ff, 0xff0000de, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffbdffff, 0xff00bdff, 0xff0010ff, 0xff0021ff,
-     0xff0010e7, 0xff00008c, 0xff00008c, 0xff00008c, 0xff00008c, 0xff00008c,
-     0xff00008c, 0xff00006b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffbdffff, 0xff004aff, 0xff0029ff, 0xff0039ff, 0xff00008c, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff00a5ff, 0xff0029ff,
-     0xff0039ff, 0xff0000ef, 0xff00008c, 0xffbdffff, 0xffbdffff, 0xff21e7ff,
-     0xff0052ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbdffff, 0xff0052ff, 0xff0042ff, 0xff004aff, 0xff004aff,
-     0xff00c6ef, 0xff00c6ff, 0xff4aadff, 0xff009cff, 0xff0094ff, 0xff0000ce,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00c6ef, 0xff008cff,
-     0xff004aff, 0xff0052ff, 0xff005aff, 0xff007bff, 0xff008cff, 0xff0073ff,
-     0xff006bff, 0xff0073ff, 0xff008cff, 0xff0084ff, 0xff0008de, 0x00000000,
-     0x00000000, 0x00000000, 0xff0052ff, 0xff004aff, 0xff0063ff, 0xff006bff,
-     0xff0073ff, 0xff007bff, 0xff006bff, 0xff004aff, 0xff00009c, 0xff00009c,
-     0xff007bff, 0xff00a5ff, 0xff00a5ff, 0xff0018f7, 0x00000000, 0x00000000,
-     0x00000000, 0xff0000b5, 0xff0052ff, 0xff0073ff, 0xff0063ff, 0xff0042ff,
-     0xff000084, 0xff000084, 0x00000000, 0x00000000, 0xff0039ff, 0xff00b5ff,
-     0xff00bdff, 0xff00ceff, 0xff0000ff, 0x00000000, 0x00000000, 0x00000000,
-     0xff00009c, 0xff000063, 0xff000063, 0xff000063, 0x00000000, 0x00000000,
-     0xffbdffff, 0xffbdffff, 0xff00deff, 0xff00c6ff, 0xff00deff, 0xff00deff,
-     0xff0000c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffbdffff, 0xffbdffff, 0xff00d6ff, 0xff00bdff,
-     0xff00c6ff, 0xff00efff, 0xff00efff, 0xff0000c6, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xffbdffff, 0xffbdffff,
-     0xff00ceff, 0xff00bdff, 0xff00ceff, 0xff00deff, 0xff00f7ff, 0xff00f7ff,
-     0xff0000c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff0073ff, 0xff00c6ff, 0xff00c6ff, 0xff00ceff, 0xff00deff,
-     0xff00efff, 0xff00ceff, 0xff00ceff, 0xff0000c6, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0029f7, 0xff00bdff, 0xff00e7ff, 0xff00e7ff, 0xff00bdff, 0xff0000c6,
-     0xff0000c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0010ef,
-     0xff0018c6, 0xff0010c6, 0xff0021ce, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffdef7ff, 0xff42e7ff, 0xff00b5ff, 0xff0073ff, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffceefff, 0xff005aff, 0xff0008ff,
-     0xff0010ff, 0xff0018ff, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffdeffff, 0xff004aff, 0xff0010ff, 0xff0021ff, 0xff0021ff, 0xff0031ff,
-     0xff00008c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffceefff, 0xff18c6ff, 0xff0018ff,
-     0xff0029ff, 0xff0031ff, 0xff0039ff, 0xff00008c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff29ffff, 0xff0039ff, 0xff0031ff, 0xff0031ff, 0xff0039ff,
-     0xff00008c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffceefff, 0xff0094ff,
-     0xff0031ff, 0xff0039ff, 0xff004aff, 0xff0052ff, 0xff00008c, 0xff00008c,
-     0xff00009c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff00deff, 0xff004aff, 0xff0042ff, 0xff0052ff,
-     0xff0052ff, 0xff0052ff, 0xff006bff, 0xff006bff, 0xff005aff, 0xff0000b5,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffceefff,
-     0xff0084ff, 0xff004aff, 0xff005aff, 0xff0029ff, 0xff0018c6, 0xff0000bd,
-     0xff0029ff, 0xff007bff, 0xff0084ff, 0xff0073ff, 0xff0000ce, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff00ceff, 0xff0052ff, 0xff005aff,
-     0xff0029ff, 0xff0018c6, 0x00000000, 0x00000000, 0xff0000ad, 0xff008cff,
-     0xff008cff, 0xff009cff, 0xff0094ff, 0xff0010e7, 0x00000000, 0x00000000,
-     0xff00ceff, 0xff007bff, 0xff0063ff, 0xff006bff, 0xff0018c6, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff4adeff, 0xff009cff, 0xff00a5ff,
-     0xff00adff, 0xff00b5ff, 0xff0000e7, 0x00000000, 0xff00ceff, 0xff006bff,
-     0xff0073ff, 0xff007bff, 0xff0029ce, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbde7ff, 0xff00adff, 0xff00b5ff, 0xff00bdff, 0xff00bdff,
-     0xff0000ce, 0x00000000, 0xff0073ff, 0xff0073ff, 0xff0094ff, 0xff008cff,
-     0xff009cff, 0xff00c6ff, 0x00000000, 0x00000000, 0xffa5f7ff, 0xff00adff,
-     0xff00bdff, 0xff00c6ff, 0xff00c6ff, 0xff00d6ff, 0xff00009c, 0x00000000,
-     0x00000000, 0xff0029ff, 0xff00adff, 0xff00adff, 0xff00a5ff, 0xff00a5ff,
-     0xff8cefff, 0xffa5ffff, 0xff00b5ff, 0xff00c6ff, 0xff00ceff, 0xff00ceff,
-     0xff00deff, 0xff00009c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0029ff, 0xff00bdff, 0xff00bdff, 0xff00b5ff, 0xff00b5ff, 0xff00c6ff,
-     0xff00ceff, 0xff00d6ff, 0xff00d6ff, 0xff00e7ff, 0xff00009c, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0029ff,
-     0xff00ceff, 0xff00ceff, 0xff00d6ff, 0xff00d6ff, 0xff00deff, 0xff00e7ff,
-     0xff00e7ff, 0xff00009c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0029ff, 0xff0018ff,
-     0xff0018ef, 0xff0018c6, 0xff0018c6, 0xff0018c6, 0xff00009c, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdeffff, 0xff42e7ff,
-     0xff42e7ff, 0xff00c6ff, 0xff00ceff, 0xff00ceff, 0xff00b5ff, 0xff00b5ff,
-     0xff0073ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffdeffff, 0xff005aff, 0xff0008ff, 0xff0008ff, 0xff0010ff,
-     0xff0018ff, 0xff0018ff, 0xff0021ff, 0xff0029ff, 0xff0031ff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdeffff, 0xff0000ff,
-     0xff0010ff, 0xff0018ff, 0xff0021ff, 0xff0029ff, 0xff0031ff, 0xff0029ff,
-     0xff0031ff, 0xff0039ff, 0xff0042ff, 0xff0031ff, 0xff0000bd, 0x00000000,
-     0x00000000, 0xffdeffff, 0xff0042ff, 0xff0021ff, 0xff0021ff, 0xff0031ff,
-     0xff0018f7, 0xff0000c6, 0xff0008de, 0xff0073ff, 0xff0042ff, 0xff004aff,
-     0xff0052ff, 0xff0031ff, 0xff0000bd, 0x00000000, 0xff10b5ff, 0xff0042ff,
-     0xff0021ff, 0xff0031ff, 0xff0039ff, 0xff0018ff, 0xff0000bd, 0x00000000,
-     0xffceffff, 0xff008cff, 0xff0052ff, 0xff005aff, 0xff006bff, 0xff0000bd,
-     0x00000000, 0x00000000, 0xff21ffff, 0xff0039ff, 0xff0039ff, 0xff0042ff,
-     0xff0018ff, 0xff0000bd, 0x00000000, 0xffceffff, 0xff0094ff, 0xff005aff,
-     0xff0063ff, 0xff0073ff, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff00bdff, 0xff004aff, 0xff0018ff, 0xff0000bd, 0x00000000,
-     0xffceffff, 0xff4ad6ff, 0xff0063ff, 0xff0073ff, 0xff0073ff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0008bd, 0xff0000bd, 0x00000000, 0x00000000, 0xffceffff, 0xff007bff,
-     0xff007bff, 0xff0084ff, 0xff0008c6, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffceffff, 0xff08adff, 0xff0084ff, 0xff008cff, 0xff008cff,
-     0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffceffff,
-     0xff008cff, 0xff0094ff, 0xff009cff, 0xff0073ff, 0xff0000bd, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffceffff, 0xff00c6ff, 0xff00a5ff, 0xff00a5ff,
-     0xff00adff, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff8cf7ff, 0xff00a5ff, 0xff00adff, 0xff00b5ff, 0xff00c6ff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffceffff, 0xff00c6ff, 0xff00bdff,
-     0xff00bdff, 0xff00c6ff, 0xff009cff, 0xff0000bd, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffceffff, 0xff00c6ff, 0xff00ceff, 0xff00d6ff, 0xff00deff,
-     0xff0018d6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff10c6ff,
-     0xff00deff, 0xff00deff, 0xff00e7ff, 0xff008cff, 0xff0000bd, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff005aff, 0xff0018ef,
-     0xff0018c6, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0xffcee7ff, 0xffdee7ff, 0xff42e7ff,
-     0xff42e7ff, 0xff00adff, 0xff00adff, 0xff0073ff, 0xff0000c6, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffcee7ff, 0xff0008ff, 0xff0008ff, 0xff0008ff, 0xff0008ff, 0xff0010ff,
-     0xff0018ff, 0xff0018ff, 0xff0021ff, 0xff0008ce, 0xff0000ce, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffcee7ff, 0xff0008ff, 0xff0008ff,
-     0xff0010ff, 0xff0010ff, 0xff0010ff, 0xff0010ff, 0xff0018ff, 0xff0031ff,
-     0xff0039ff, 0xff0039ff, 0xff0029ff, 0xff0000de, 0x00000000, 0x00000000,
-     0xffcee7ff, 0xff0008ff, 0xff0008ff, 0xff0021ff, 0xff0008e7, 0xff0000c6,
-     0xff0000c6, 0xff0000c6, 0xff0000c6, 0xff0000c6, 0xff0008e7, 0xff0052ff,
-     0xff005aff, 0xff0039ff, 0xff00009c, 0x00000000, 0xff00adff, 0xff0010ff,
-     0xff0029ff, 0xff0029ff, 0xff0000c6, 0x00000000, 0x00000000, 0x00000000,
-     0xffcee7ff, 0xff42e7ff, 0xff005aff, 0xff0008e7, 0xff0039ff, 0xff00009c,
-     0x00000000, 0x00000000, 0x00000000, 0xff0008de, 0xff0039ff, 0xff0039ff,
-     0xff0008ef, 0x00000000, 0x00000000, 0xffcee7ff, 0xff007bff, 0xff007bff,
-     0xff007bff, 0xff006bef, 0xff00009c, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff0008ce, 0xff004aff, 0xff004aff, 0xff42e7ff,
-     0xff42e7ff, 0xff007bff, 0xff007bff, 0xff007bff, 0xff006bff, 0xff0000ce,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff0018ff, 0xff0063ff, 0xff0063ff, 0xff0063ff, 0xff006bff,
-     0xff007bff, 0xff007bff, 0xff0000ce, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd6e7ef, 0xff0063ff,
-     0xff0073ff, 0xff0073ff, 0xff0073ff, 0xff006bff, 0xff0073ff, 0xff0084ff,
-     0xff0084ff, 0xff006bef, 0xff0021f7, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffcee7ff, 0xff0073ff, 0xff007bff, 0xff0084ff, 0xff0084ff,
-     0xff0000c6, 0xff0000c6, 0xff0000c6, 0xff4ab5ff, 0xff00a5ff, 0xff00a5ff,
-     0xff007bff, 0xff0021ff, 0x00000000, 0x00000000, 0xff00ceff, 0xff0073ff,
-     0xff0084ff, 0xff008cff, 0xff0073ff, 0xff0000c6, 0x00000000, 0x00000000,
-     0x00000000, 0xffceffff, 0xff00adff, 0xff00b5ff, 0xff00bdff, 0xff009cff,
-     0xff0010ff, 0x00000000, 0xff0039ff, 0xff009cff, 0xff0094ff, 0xff009cff,
-     0xff0073ff, 0xff004ade, 0x00000000, 0x00000000, 0xffceffff, 0xff00adff,
-     0xff00bdff, 0xff00c6ff, 0xff00bdff, 0xff00bdff, 0xff0000ce, 0x00000000,
-     0x00000000, 0xff0052ff, 0xff00a5ff, 0xff00b5ff, 0xff00b5ff, 0xff00c6ff,
-     0xffceffff, 0xffceffff, 0xff00b5ff, 0xff00c6ff, 0xff00ceff, 0xff00c6ff,
-     0xff00deff, 0xff0000ce, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff004aff, 0xff004aff, 0xff00adff, 0xff00ceff, 0xff00ceff, 0xff00c6ff,
-     0xff00ceff, 0xff00deff, 0xff00ceff, 0xff00efff, 0xff0000ce, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0031ff, 0xff0042ff, 0xff00adff, 0xff00e7ff, 0xff00e7ff, 0xff00e7ff,
-     0xff00adff, 0xff0000ce, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0029ff, 0xff0018c6, 0xff0018c6, 0xff0010c6, 0xff0000ce, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0xffdeefff, 0xff42e7ff, 0xff42e7ff,
-     0xff42e7ff, 0xff00c6ff, 0xff00c6ff, 0xff00a5ff, 0xff0073ff, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffcee7ff, 0xff0042ff, 0xff0010ff, 0xff0010ff, 0xff0018ff, 0xff0021ff,
-     0xff0021ff, 0xff0029ff, 0xff0029ff, 0xff0008ce, 0xff0000ce, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbdffff, 0xff0039ff, 0xff0018ff,
-     0xff0021ff, 0xff0018ef, 0xff0018ff, 0xff0018ff, 0xff0039ff, 0xff0042ff,
-     0xff004aff, 0xff004aff, 0xff0031ff, 0xff0010de, 0x00000000, 0x00000000,
-     0xffcee7ff, 0xff006bff, 0xff0021ff, 0xff0029ff, 0xff0031ff, 0xff0000bd,
-     0xff0000bd, 0xff0000bd, 0xff0000bd, 0xff0029f7, 0xff005aff, 0xff005aff,
-     0xff004aff, 0xff004aff, 0xff0000de, 0x00000000, 0xff00f7ff, 0xff0031ff,
-     0xff0031ff, 0xff0039ff, 0xff0042ff, 0xff0000bd, 0x00000000, 0x00000000,
-     0x00000000, 0xff0000bd, 0xff0039ff, 0xff004aff, 0xff0052ff, 0xff004aff,
-     0xff0018ef, 0x00000000, 0xff00bdff, 0xff0039ff, 0xff0042ff, 0xff004aff,
-     0xff0052ff, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0xff00adff,
-     0xff006bff, 0xff0039ff, 0xff0010de, 0xff0018ef, 0x00000000, 0x00000000,
-     0xff008cf7, 0xff004aff, 0xff0052ff, 0xff0052ff, 0xff005aff, 0xff0031f7,
-     0xff00deff, 0xff00deff, 0xffffffff, 0xff009cff, 0xff0084ff, 0xff0084ff,
-     0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0xff0063ff, 0xff0039ff,
-     0xff005aff, 0xff006bff, 0xff006bff, 0xff006bff, 0xff0073ff, 0xff0094ff,
-     0xff299cff, 0xff007bff, 0xff008cff, 0xff0073f7, 0xff0000bd, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff0000ce, 0xff0039ff, 0xff0063ff,
-     0xff006bff, 0xff006bff, 0xff0073ff, 0xff0084ff, 0xff008cff, 0xff0094ff,
-     0xff009cff, 0xff0008ce, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff0000ce, 0xff0000ce, 0xff0000ce, 0xff0000ce,
-     0xff0063ff, 0xff0094ff, 0xff009cff, 0xff00a5ff, 0xff005af7, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff00ceff, 0xff00a5ff,
-     0xff00adff, 0xff00b5ff, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffffffff, 0xff00a5ff, 0xff00b5ff, 0xff00bdff, 0xff00bdff,
-     0xff0000ce, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xff73d6ff,
-     0xff00bdff, 0xff00c6ff, 0xff00c6ff, 0xff005af7, 0xff0000ce, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff73d6ff, 0xff00c6ff, 0xff00ceff, 0xff00ceff,
-     0xff00deff, 0xff0000bd, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff005aff, 0xff00deff, 0xff00e7ff, 0xff00adff, 0xff0000bd,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff0031ff, 0xff0031ff, 0xff0010c6, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffa2db39, 0xff868248, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe8f3c3, 0xffe5feb6, 0xff9bc63b, 0xff7d474a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbc7ba1, 0xffff96ff, 0xffd0c7a4,
-     0xff919039, 0xff762d4c, 0xff85564a, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbf4bc3, 0xffc950d2, 0xff9a5174, 0xff712c42, 0xff8a7947,
-     0xff949540, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff8f456d, 0xff78304e, 0xff896d49, 0xff9bb23a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6f5327,
-     0xff908c38, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffcbf983, 0xffe1dcb3, 0xffa66487, 0xff763447,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffccf18a,
-     0xfffbfbf0, 0xfff889fd, 0xffc54eca, 0xff7e246a, 0xff753641, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffc5e87f, 0xffebffc4, 0xffb57796,
-     0xff961d9c, 0xff813d5c, 0xff918443, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff8fbc3b, 0xff9ab738, 0xff805144, 0xff783a4d, 0xff99b13b,
-     0xff8a7f3b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff824d4d, 0xff77304a, 0xff958a46, 0xff95983d, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffa1db36, 0xff878147, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe9fac6, 0xffe7febd, 0xff9bc63a, 0xff7d474b, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd0ec91, 0xffffffff, 0xffc5ed77,
-     0xff928a3f, 0xff762f4b, 0xff85564a, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffa6d251, 0xffbded62, 0xff8c8337, 0xff74234c, 0xff8a7b45,
-     0xff949540, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff8d7f42, 0xff792d4e, 0xff887047, 0xff9bb33a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff734933,
-     0xff967b4a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd1f48d, 0xffcef683, 0xff8fa93e, 0xff793d4a,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffccef87,
-     0xfffefffb, 0xffe7ffba, 0xff9dbd3b, 0xff80464e, 0xff681f42, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffc5e280, 0xffecffc2, 0xff9cba39,
-     0xff9c4189, 0xff972b94, 0xff8a3e67, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff91ab3b, 0xff98ba3a, 0xff854e4d, 0xff8c1b8e, 0xffb137bd,
-     0xffb97098, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff9cc83e, 0xff9db346, 0xff7f325c, 0xffa77283, 0xff998d53, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcdfd60,
-     0xff7f503b, 0xff898442, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff9cc444, 0xff866d3f, 0xff6e2347, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff9f9872, 0xff7d305f, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa67f71, 0xff99877f, 0xff948984, 0xffa18e89,
-     0xff968782, 0xffaa6046, 0xffd20000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff849e82,
-     0xff61efda, 0xff1fffa9, 0xff02ff96, 0xff00ff96, 0xff02ff8f, 0xff47ffc5,
-     0xff9d8260, 0xffd50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff890000, 0xffed7759, 0xff58f2e5, 0xff0ef9c2,
-     0xff2befd0, 0xff4eedd7, 0xff42f9d0, 0xff11f8c2, 0xff3ffff8, 0xffac6255,
-     0xffce0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000202, 0xff970800, 0xffe89a6b, 0xff77e6ee, 0xffc0e0a1, 0xffcaaf77,
-     0xff90b4af, 0xff53fefa, 0xff00fbf3, 0xff7fb5b4, 0xff650000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000001,
-     0xff931200, 0xffff8d42, 0xffd14f14, 0xffcd0b00, 0xffa96a73, 0xff47fefe,
-     0xff00ffff, 0xff82b3b2, 0xff530000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000003, 0xff6e0000,
-     0xff4a0000, 0xffb33f42, 0xff68d8da, 0xff19ffff, 0xff39fcfc, 0xffe06150,
-     0xff4c0000, 0xff000303, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd20102, 0xffb67473, 0xff58fafc,
-     0xff13ffff, 0xff4bf3f8, 0xffae8e74, 0xfff32800, 0xff280306, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffb86564, 0xff1dffff, 0xff00ecff, 0xff57dfe7, 0xffda704a,
-     0xfff53c05, 0xff3a070a, 0xff000202, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa27474,
-     0xff21e1f0, 0xff20dff1, 0xff739296, 0xffed0500, 0xff350e10, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffdd2a0d, 0xfff86426, 0xffef672b,
-     0xfff83b15, 0xff420204, 0xff000400, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffc2221f, 0xffc3624b, 0xffc16649, 0xffd6392c, 0xff3b0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa17474,
-     0xff2cd4fc, 0xff27cffb, 0xff838c97, 0xff500000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffa17b7d, 0xff05c4ff, 0xff00b6ff,
-     0xff7580a2, 0xff510000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffc93c2a, 0xffc7885a, 0xffc48459, 0xffca4a36, 0xff3c0001,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe72009,
-     0xffff5d18, 0xffff5f18, 0xffff300c, 0xff3c0001, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff3c0003, 0xff1e0001, 0xff1c0002,
-     0xff200002, 0xff0a0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0x00000000, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff0f0f0, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0,
-     0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0xfff0f0f0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfff0f0f0, 0xfff0f0f0, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff9f3731, 0xffa23d39, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff7aa992, 0xff66c2ae,
-     0xffc00000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffa94446, 0xff39eab8, 0xff19ffd6, 0xffa53e42, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff887f80,
-     0xff0dfff3, 0xff03fde9, 0xff5fc9cc, 0xffbf0f11, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffaf2121, 0xff58d4d5, 0xff03ffff, 0xff00fefc,
-     0xff1ffbfc, 0xff9b5f63, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff8e7878, 0xff31fcfc, 0xff4bf0ef, 0xff38efed, 0xff00fffe, 0xff5aced5,
-     0xffba2425, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff75a4a4, 0xff23ffff,
-     0xff9fa897, 0xffa2a699, 0xff0dffff, 0xff13ffff, 0xff946d70, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffac3c3e, 0xff49e4e5, 0xff32fdfc, 0xffbc3621, 0xffd82210,
-     0xff45e8e6, 0xff00fffd, 0xff54ced2, 0xffb81011, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff957271,
-     0xff10ffff, 0xff52f0ec, 0xff666665, 0xff766462, 0xff4ce2e0, 0xff00f7fc,
-     0xff14ffff, 0xff945f64, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffc00b0b, 0xff66b6bb, 0xff00f3fe, 0xff1eecff,
-     0xff14ffff, 0xff01ffff, 0xff0cf1ff, 0xff09d7fe, 0xff00d7fe, 0xff4cc4d9,
-     0xffb6322d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffa53d3b, 0xff32cfef, 0xff04c9fe, 0xff4ec2dd, 0xff898289, 0xffad696a,
-     0xffae5d64, 0xff46b2e0, 0xff00a8fe, 0xff13bdff, 0xff7e8c94, 0xffa00a02,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff687d96, 0xff05b1ff,
-     0xff11b1fe, 0xff996580, 0xffff0800, 0xffff2d00, 0xfffd0500, 0xff8c6d77,
-     0xff01a5ff, 0xff01a1ff, 0xff53b7d5, 0xff5d1605, 0x00000000, 0x00000000,
-     0x00000000, 0xffb30a01, 0xff80647e, 0xff008cff, 0xff299ffd, 0xffc12a3a,
-     0xff720002, 0xff210107, 0xff4b0403, 0xffc1211b, 0xff36a0e2, 0xff3cb5e3,
-     0xffe36a40, 0xff921f00, 0xff000304, 0x00000000, 0x00000000, 0xff621104,
-     0xffcb2906, 0xff955e71, 0xff5c92cf, 0xffa21015, 0xff0d0000, 0xff000401,
-     0x00000000, 0xffc60c00, 0xffae625b, 0xffe07647, 0xffab3400, 0xff200b02,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff3a0804, 0xffb73910,
-     0xffbc4628, 0xff6d1409, 0xff020000, 0x00000000, 0x00000000, 0xff8c0f02,
-     0xffb8350a, 0xff732703, 0xff010102, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff1e0809, 0xff91330f, 0xff551403,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff0d0b05, 0xff000003,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff190409, 0xff0a0a0a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0xffcc1e19, 0xffb06456, 0xffab6050,
-     0xffa75c4b, 0xffa95948, 0xffac503f, 0xffb33a32, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffb8544c, 0xff36ffce, 0xff1dffaa, 0xff1cffb0, 0xff1effac,
-     0xff29fcb0, 0xff62d5b7, 0xffa47b6f, 0xffd40200, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbb5351,
-     0xff24fac8, 0xff23f0b5, 0xff43facb, 0xff31ffca, 0xff14f9bd, 0xff12febd,
-     0xff4bfce4, 0xffaf5853, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffaa656a, 0xff14fef2, 0xff29fcf7,
-     0xffc06b60, 0xffdc755c, 0xff4fe5dd, 0xff13f5da, 0xff07ffe5, 0xff64cec7,
-     0xffc20d0a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff9f6d74, 0xff0fffff, 0xff43ffff, 0xff9c1010, 0xffb50000,
-     0xff88adae, 0xff0affff, 0xff05fcf4, 0xff55ebe7, 0xff941b19, 0xff0e0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff96737c,
-     0xff08fefe, 0xff50fefe, 0xff796363, 0xff306d6f, 0xff44efee, 0xff00fcfa,
-     0xff19ffff, 0xff9da9a9, 0xffb20201, 0xff000e09, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff8c848d, 0xff0afffe, 0xff0cfffd,
-     0xff22ffff, 0xff24ffff, 0xff0bffff, 0xff23ffff, 0xff6dd8d2, 0xffe52724,
-     0xff530201, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff7d909f, 0xff06feff, 0xff17eefb, 0xff23edf8, 0xff12f4ff,
-     0xff16fcff, 0xff80d2cb, 0xffaf201a, 0xff5a0000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe50000, 0xff6f94aa,
-     0xff00fdff, 0xff4dd1db, 0xffc33432, 0xff948e88, 0xff28e1fa, 0xff3beef6,
-     0xff867c79, 0xff5a0b0c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffe70000, 0xff6298b7, 0xff00ecff, 0xff5cc6d1,
-     0xff5e0001, 0xff7d1705, 0xff4fbbd9, 0xff05d4ff, 0xff26e1fd, 0xffad3c42,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe30200, 0xff5899c2, 0xff00daff, 0xff6fbdc6, 0xff510c09, 0xff423d34,
-     0xff3db9e8, 0xff03b9fe, 0xff23ceff, 0xff9e474d, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe30600, 0xff5597c6,
-     0xff01b1fe, 0xff33bced, 0xff31aedf, 0xff1aabf0, 0xff0aa0ff, 0xff0091fc,
-     0xff33c3ff, 0xffa94543, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffe50700, 0xff5290c9, 0xff0080ff, 0xff007bff,
-     0xff007eff, 0xff0080ff, 0xff0080ff, 0xff0292ff, 0xff52bff4, 0xffa53b31,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffdb0b09, 0xff539dce, 0xff1fa3fd, 0xff289df7, 0xff259af8, 0xff2898f6,
-     0xff309cf4, 0xff61a3d1, 0xffdc7d5d, 0xff882107, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd80203, 0xfff13c21,
-     0xfff37230, 0xffe5762c, 0xffe67a32, 0xffe77131, 0xffe5692e, 0xfff8561a,
-     0xffbe340b, 0xff220908, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff4f0000, 0xff5f0000, 0xff580000,
-     0xff590301, 0xff580502, 0xff680803, 0xff650e07, 0xff1d0a0b, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000505, 0xff000504, 0xff000a08, 0xff000408,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffc70803, 0xffbc4348, 0xffb85e63, 0xffa43d39,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb8443f,
-     0xff95b0ae, 0xff4df6ce, 0xff2effd7, 0xff72beb5, 0xff560000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa25f5e, 0xff69f0f1, 0xff17ffe5, 0xff00fcb7,
-     0xff00fabe, 0xff71c3bb, 0xff6b0506, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa55a55,
-     0xff53fbfc, 0xff0fffe9, 0xff00fad2, 0xff18fde2, 0xff3fffff, 0xff71dddf,
-     0xff721818, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffb8473e, 0xff51e1dc, 0xff12ffff, 0xff03fbe8,
-     0xff03fff8, 0xff31f6f8, 0xff77c1c4, 0xffac736e, 0xff7d0b0a, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff7f8c8a, 0xff0fffff, 0xff00fafa, 0xff00ffff, 0xff41e9e8, 0xffcb8a51,
-     0xffff6e05, 0xffff4e00, 0xff620800, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb02b2b, 0xff56e4e5, 0xff04fdfd,
-     0xff02fdfd, 0xff38f3f2, 0xffe9523c, 0xffda3000, 0xff773004, 0xff351002,
-     0xff050301, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffa94949, 0xff42ffff, 0xff03f9fb, 0xff2efefe, 0xffba6f6d,
-     0xff930000, 0xff090307, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa94949,
-     0xff3cffff, 0xff00fefe, 0xff58f5f6, 0xff912b2a, 0xff000205, 0xff020604,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffaa3b3b, 0xff4ceeee, 0xff00fbfe,
-     0xff3bfffd, 0xff84504f, 0xff530000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff73a3a5, 0xff07fbff, 0xff01e4fc, 0xff5ad1d5,
-     0xff9c4041, 0xffde0606, 0xfff8090c, 0xfff1070a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe42a23, 0xff73afd0, 0xff00dbff, 0xff02cdff, 0xff4bcae4, 0xff6aa7bc,
-     0xff50b3cb, 0xff95878b, 0xffa30000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff5d0000, 0xffd52532,
-     0xff9ca3b3, 0xff1bc9fa, 0xff00caff, 0xff00c6ff, 0xff00d1ff, 0xff5cb2c4,
-     0xff5e0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff360000, 0xffc80000, 0xffe65443,
-     0xffa79393, 0xff899ba1, 0xff869f9f, 0xffb4666a, 0xff640000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff0d0100, 0xff890700, 0xffe11000, 0xffff2a00,
-     0xfffc3700, 0xffff2900, 0xff7c0601, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff000004, 0xff1a0604, 0xff400f06, 0xff310f05, 0xff3b0c05,
-     0xff240101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb74539, 0xffb6635d,
-     0xffc34648, 0xffc72c2b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff86ae9c, 0xff1bffbd, 0xff37f0aa, 0xff4ee4b4,
-     0xff8e927f, 0xffc02417, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff77a29a, 0xff00fca9, 0xff00f393, 0xff00fc9b, 0xff2affd7, 0xff6ecab6,
-     0xffb43a2c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff69abad, 0xff01feee,
-     0xff00f9cd, 0xff00fcce, 0xff00f5b4, 0xff19ffec, 0xff73ac92, 0xffc91e10,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff5ebdc1, 0xff00ffff, 0xff48ead0, 0xff4ae4cb,
-     0xff02ffeb, 0xff03fae8, 0xff14fffa, 0xffab6b63, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd52c34,
-     0xff4fd3d4, 0xff00fffe, 0xffb39876, 0xfffb5523, 0xff59e5e5, 0xff04fdfe,
-     0xff00feff, 0xff8ba2a6, 0xffbe0200, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd42e35, 0xff40ebec, 0xff07ffff,
-     0xff976661, 0xffee0200, 0xffc38478, 0xff1bffff, 0xff00fefe, 0xff60c7c7,
-     0xff7b0403, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffcc464b, 0xff2ffbfb, 0xff1cfefe, 0xff63494a, 0xff6b0002,
-     0xffd8656e, 0xff12fefe, 0xff00fefe, 0xff6bc2c4, 0xff610102, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffca5258,
-     0xff1afeff, 0xff1efeff, 0xff6d3432, 0xff230000, 0xffc58187, 0xff07fefe,
-     0xff04fefe, 0xff84b7ae, 0xff490000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb85555, 0xff12fffe, 0xff2afffe,
-     0xff7f1818, 0xff42110e, 0xff8cdbd7, 0xff00fdfd, 0xff3bffff, 0xffaf4743,
-     0xff1a0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffa45758, 0xff0df2fe, 0xff2decfa, 0xff89766a, 0xff66c0b8,
-     0xff09ffff, 0xff0dffff, 0xffa29c97, 0xff870000, 0xff000101, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffeb0000, 0xffa35e61,
-     0xff05dbfb, 0xff0bbcf7, 0xff20dbff, 0xff02dbff, 0xff0becff, 0xff98aea4,
-     0xfff11b05, 0xff170302, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffef0000, 0xff8b858e, 0xff00d5ff, 0xff00a7ff,
-     0xff00b8ff, 0xff44c0ea, 0xffc8897c, 0xfff71f08, 0xff420903, 0xff000403,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe50000, 0xffb65256, 0xff85a3ab, 0xff8ca8b3, 0xffc19d7d, 0xfffa5b2b,
-     0xffcc1d00, 0xff330704, 0xff000003, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdd0007, 0xffff2e00,
-     0xffff4d02, 0xffff420f, 0xffe02b00, 0xff821002, 0xff1a0407, 0xff000001,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff430002, 0xff5b0600, 0xff620a05,
-     0xff300008, 0xff000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffd40301, 0xffb24e4c, 0xff9b6a76, 0xffb76467, 0xffca6062, 0xffd2554a,
-     0xff89251a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd31e17, 0xff9ca39a, 0xff37ffd4,
-     0xff08ffb0, 0xff14ffb0, 0xff19ffb7, 0xff72ccbf, 0xff7f0f11, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffd21c1c, 0xff8ac1bb, 0xff13ffec, 0xff03f8c7, 0xff08ffd5, 0xff00ffd0,
-     0xff00ffcf, 0xff72ccbf, 0xff9e0407, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffea0905, 0xff9b8d8c, 0xff17ffff,
-     0xff01f4d4, 0xff51fff4, 0xff9fd6bf, 0xff96bcad, 0xff6ac5c0, 0xff9a9396,
-     0xff740000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffed0000, 0xff68b8b9, 0xff00fdfd, 0xff17fdff, 0xffb5877c,
-     0xffff2700, 0xffff3e00, 0xffff4300, 0xffff2e08, 0xff520000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffeb0606,
-     0xff5cc2c4, 0xff00fefe, 0xff18fafd, 0xff90b1b2, 0xffa27b82, 0xffab8282,
-     0xffbc6c68, 0xffcf1204, 0xff300000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffe51c1c, 0xff45d8d9, 0xff00feff,
-     0xff0cfafd, 0xff00ffff, 0xff00ffff, 0xff00ffff, 0xff7beced, 0xff8b0c0f,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffdd3030, 0xff38eaea, 0xff01ffff, 0xff5af8f6, 0xff81d6cf,
-     0xff66ddde, 0xff3fe5e7, 0xff81a7a9, 0xff900707, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd24444,
-     0xff2ef8fb, 0xff07fbff, 0xff65f0ea, 0xfff04f2e, 0xffff3008, 0xffff4617,
-     0xffe52e15, 0xff390101, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd33f40, 0xff2deaf8, 0xff00e8fe,
-     0xff2ff2fe, 0xff7ed0d1, 0xffb45857, 0xffd54f3d, 0xffdd1e15, 0xff240000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffe01514, 0xff6dc4d4, 0xff00e3ff, 0xff08cefb, 0xff23dfff,
-     0xff24e2ff, 0xff39f9ff, 0xffac6570, 0xff330000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6c0000,
-     0xffd15459, 0xff32ddfe, 0xff00b5ff, 0xff00a9fa, 0xff00a0f4, 0xff27dcf8,
-     0xffb25e60, 0xff250000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff960100, 0xffd8736f,
-     0xff5cbcdf, 0xff1abcff, 0xff04b6ff, 0xff38eaff, 0xffa45152, 0xff130000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff140100, 0xffe81500, 0xffff5e23, 0xffd7855d,
-     0xffc2967a, 0xffb99c8d, 0xff912628, 0xff040000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff020202, 0xff2f0404, 0xff951b00, 0xffef3600, 0xfff15400, 0xffff4709,
-     0xff880300, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000002, 0xff1d0006, 0xff1e0005, 0xff390704, 0xff300100, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd6343a, 0xffc6414b, 0xffcc454d, 0xffc0110d,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbc2422, 0xff908f7d, 0xff839789, 0xff6cbaa1, 0xff55d3a1,
-     0xff38eda1, 0xff25fd9c, 0xff27ffd3, 0xff8a5253, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffba3135,
-     0xff41fcd5, 0xff00ff9c, 0xff04ffa9, 0xff00ffbd, 0xff01ffc6, 0xff17ffc3,
-     0xff35f7e0, 0xff9b7373, 0xff572c20, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff59cfc4, 0xff07fac3,
-     0xff6dedd3, 0xffb4b79e, 0xffcb9e70, 0xffe4834c, 0xffef713a, 0xfff2330d,
-     0xff410b0b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff81aba7, 0xff00fefb, 0xff55c8b6, 0xffff3300,
-     0xffff5f03, 0xffff4805, 0xfff34308, 0xffcc1a00, 0xff3a0a08, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff8e9494, 0xff00ffff, 0xff34d3d5, 0xff6f0b0c, 0xff260000, 0xff080000,
-     0xff040000, 0x00000000, 0xff000302, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa07b7c, 0xff09fefe,
-     0xff2beeed, 0xff742f2f, 0xff890d0d, 0xff971b19, 0xff972623, 0xffb03222,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa78283, 0xff28f6f6, 0xff18fcfc, 0xff79cdce,
-     0xff6ce6e6, 0xff47ffff, 0xff6cffff, 0xffb4231c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffbd4a4a, 0xff3bf2f2, 0xff02ffff, 0xff1fffff, 0xff24e1e1, 0xff3ebcc1,
-     0xff81b7bb, 0xff840e0e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd41b1b, 0xff52e1e1,
-     0xff00fefe, 0xffa98684, 0xffff3511, 0xffff680b, 0xffff4f00, 0xffbd0f00,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd00c0c, 0xff6fbec1, 0xff00feff, 0xff8c969c,
-     0xffd80d00, 0xff95250a, 0xff8e1306, 0xff580400, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffcb0000, 0xff8a9c9e, 0xff01e0ff, 0xff83c3d2, 0xff720506, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa57e7b,
-     0xff00b2fb, 0xff5dbef0, 0xff85120b, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb07076, 0xff33dcff, 0xff72d2ee,
-     0xff8f181a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffc5211d, 0xffec6f47, 0xfffe6c31, 0xffc61704, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcb0600,
-     0xfff93600, 0xffdb3900, 0xffa50e00, 0xff1a0100, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff2b0003, 0xff1a0004,
-     0xff050104, 0xff000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd8463d, 0xffd94d46, 0xffcd4648, 0xffbf2a25,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbe423c, 0xff91ac99,
-     0xff58e6bf, 0xff2ef7af, 0xff31fecd, 0xff98ab9a, 0xff6b0000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbd4947, 0xff5cefe1, 0xff06ffdc, 0xff01ffc1, 0xff00ffbe,
-     0xff04ffde, 0xff96b3a9, 0xff4a0000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffca2c29, 0xff69deda,
-     0xff01fff1, 0xff06fde6, 0xff3afdf1, 0xff47e5d9, 0xff4ee1df, 0xffa09892,
-     0xff4e0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffdd0000, 0xff979391, 0xff1bffff, 0xff0efefa, 0xff55ede8,
-     0xffb19770, 0xffe2883b, 0xfff28234, 0xfff43b12, 0xff430000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc82521,
-     0xff69dddd, 0xff0afdfd, 0xff4cecec, 0xffd04b31, 0xfffe2400, 0xfffc3000,
-     0xffef1900, 0xffe70e00, 0xff430300, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb95c59, 0xff37ffff, 0xff32fefe,
-     0xff99615c, 0xffc20000, 0xff79a7ad, 0xff42acb3, 0xff42adb2, 0xff9f7578,
-     0xff810000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffb75b58, 0xff1bfdfe, 0xff40feff, 0xffaf1919, 0xffa40305,
-     0xff54ffff, 0xff0fffff, 0xff00ffff, 0xff87c0c0, 0xff530000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffaf5c5a,
-     0xff1afffe, 0xff33ffff, 0xff9f4141, 0xffb50000, 0xffd72e1c, 0xff5ec2c5,
-     0xff02fdfb, 0xff8dafaf, 0xff4f0000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb85050, 0xff29f0fc, 0xff11e5fe,
-     0xff56c5dc, 0xffc43f30, 0xffed2607, 0xff62b4c3, 0xff00f2ff, 0xff8cabb2,
-     0xff500000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff9c1b19, 0xff75c4d9, 0xff08c8ff, 0xff0dbeff, 0xff2ccafc,
-     0xff3cc9f8, 0xff27c4fa, 0xff01ccff, 0xff8ba5b4, 0xff4f0000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4d0400,
-     0xffc36165, 0xff49d5fd, 0xff09b1ff, 0xff00a8fe, 0xff01abfd, 0xff06a5f7,
-     0xff04bbfa, 0xff8d9db2, 0xff4f0000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff8d0000, 0xffed6c58,
-     0xff65c0dd, 0xff1cacff, 0xff02a3ff, 0xff00a1ff, 0xff00b6ff, 0xff84a2c1,
-     0xff500000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff100303, 0xffa40400, 0xfff94c11, 0xffd08b61,
-     0xff9fa9a1, 0xff8596a8, 0xff7d9ea9, 0xffaf7377, 0xff480000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff040002, 0xff5f0401, 0xffb82900, 0xfffc4700, 0xffff5300,
-     0xffff5d00, 0xffff3300, 0xff480000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff020000, 0xff1b0003, 0xff3a0004, 0xff5e0304, 0xff5c0405, 0xff630203,
-     0xff200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000101, 0xff000101, 0xff000202, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffc3382e, 0xffaf4c4e, 0xffc7342c,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffc55a4f, 0xff9d9992, 0xff9b9f96, 0xffb05e5a, 0x00000000, 0x00000000,
-     0x00000000, 0xff74ae8a, 0xff10fdcc, 0xff68be99, 0xff980a06, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa48f80, 0xff1affdc,
-     0xff12ffd1, 0xffa29e9b, 0xff3f0000, 0x00000000, 0x00000000, 0xff91aa95,
-     0xff00fec6, 0xff56d0b2, 0xff8a1817, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffb27264, 0xff23fae3, 0xff11fae3, 0xffa5918d,
-     0xff5d0404, 0x00000000, 0x00000000, 0xff96aaa5, 0xff09ffff, 0xff4adbd7,
-     0xff9b2f2e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffb96559, 0xff2bfffc, 0xff14fffe, 0xffa58b87, 0xff750000, 0x00000000,
-     0x00000000, 0xff9c9f9c, 0xff10feff, 0xff41ebe9, 0xff963939, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb9665c, 0xff37f9f8,
-     0xff18fffe, 0xffa7b7b4, 0xffb85953, 0xffb7716b, 0xffd4625c, 0xff97bebd,
-     0xff19fffe, 0xff37fbfb, 0xff914646, 0xff270000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa98b87, 0xff4ae9e8, 0xff12fffe, 0xff3fffff,
-     0xff42ffff, 0xff40ffff, 0xff44ffff, 0xff4effff, 0xff1afefe, 0xff26ffff,
-     0xff995b5b, 0xff400000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffb75a5a, 0xff44e3e3, 0xff10ffff, 0xff10ffff, 0xff0cffff, 0xff0fffff,
-     0xff0cffff, 0xff1fffff, 0xff05fdfd, 0xff21fefe, 0xff9e6969, 0xff4c0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc43f3f, 0xff4adddd,
-     0xff18feff, 0xff5ad7d7, 0xff65bfb4, 0xff66c3b6, 0xff66bcb3, 0xff4fe1e0,
-     0xff0bfdfd, 0xff22feff, 0xff9f7979, 0xff640000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd32121, 0xff61d3d5, 0xff0bffff, 0xffa47075,
-     0xffff3900, 0xffff631a, 0xffff2400, 0xff948b8b, 0xff2affff, 0xff25ffff,
-     0xff978a89, 0xff7c0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffda0906, 0xff68c4cf, 0xff09fbff, 0xff9b838a, 0xff770804, 0xff581715,
-     0xff780402, 0xff9f807f, 0xff2ef4ff, 0xff16efff, 0xff8e9595, 0xff970000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe30900, 0xff71b5c8,
-     0xff03e7fe, 0xff9c898e, 0xff2f0000, 0x00000000, 0x00000000, 0xffa36e6f,
-     0xff2dd9fc, 0xff04cbfc, 0xff91a7ab, 0xff5d0000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffed1200, 0xff7aa3bd, 0xff00c1fb, 0xff8e929c,
-     0xff4e0000, 0x00000000, 0x00000000, 0xffb87f7b, 0xff38c5fe, 0xff00b6ff,
-     0xff83b7c8, 0xff560402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffeb1600, 0xff8ca7ba, 0xff33e0ff, 0xff9096a4, 0xff550000, 0x00000000,
-     0x00000000, 0xffb8585a, 0xff6bc6d6, 0xff53c8d8, 0xff9aa4a8, 0xff530c0d,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe01e04, 0xffd75935,
-     0xffe19352, 0xffe65326, 0xff610100, 0x00000000, 0x00000000, 0xffdd0d04,
-     0xfff97b3b, 0xffffa24e, 0xffff6825, 0xff690300, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffe22805, 0xffed2f0c, 0xffe94212, 0xffda2703,
-     0xff5e0000, 0x00000000, 0x00000000, 0x00000000, 0xff881a02, 0xff772207,
-     0xff781504, 0xff320000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff1a0000, 0xff1c0001, 0xff0b0000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000002, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdf5949,
-     0xffd16259, 0xffd6362c, 0xff990202, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffe81d1f, 0xff58d9b6, 0xff08fcc6, 0xff7f9a87,
-     0xffde0002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffef1717, 0xff5ccdb7, 0xff00fec9, 0xff56d0ba, 0xffcd1414, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff20b07, 0xff70b9b4,
-     0xff00fff5, 0xff37f3ec, 0xffca4041, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff7da9a6, 0xff04ffff, 0xff18ffff,
-     0xffb66969, 0xff4a0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffa1938f, 0xff08fefe, 0xff04fefe, 0xff9e898a, 0xff5c0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbb706f,
-     0xff12fefe, 0xff00fffe, 0xff7eafaf, 0xff720000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbe5a5d, 0xff1cfefe, 0xff00fbff,
-     0xff65d2d2, 0xff7e0a0b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffc74446, 0xff28f1fd, 0xff00dfff, 0xff4be5f1, 0xff86222e,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffac5054,
-     0xff3ed2e8, 0xff00c4ff, 0xff2fddfe, 0xff8e445d, 0xff581a14, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff52b8d5, 0xff01affe,
-     0xff17c4fe, 0xff836991, 0xff580b08, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff64a8cb, 0xff009cfd, 0xff0ab5fe, 0xff7495c0,
-     0xff740000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff829dbb, 0xff1cc6ff, 0xff37c0ff, 0xff8579ae, 0xff980105, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa0667d, 0xff8fa8b2,
-     0xffcc8159, 0xffff6629, 0xffbe1006, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd73210, 0xfff98422, 0xffd85f14, 0xff6a2e01,
-     0xff330400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff801100, 0xff491503, 0xff17060e, 0xff000004, 0xff000002, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffff1519, 0xffeb4544, 0xfff64848, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe23732, 0xff9dbeb2,
-     0xff6ef3d3, 0xff8ad3b9, 0xfff90607, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd0341d, 0xff6cdbb0, 0xff07ffc4, 0xff44fccf,
-     0xffd9483e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffd46564, 0xff31fbee, 0xff16fff9, 0xffc46865, 0xffff0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff02d29,
-     0xff6dd4d4, 0xff00feff, 0xffb89ca0, 0xffda0001, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff949f9f, 0xff13fffe,
-     0xff7fe9e8, 0xffa60e0e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffb88383, 0xff16ffff, 0xff51fdfd, 0xff9e1717,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffcd6363, 0xff0bffff, 0xff3cfefe, 0xff951717, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc86565, 0xff0cfeff,
-     0xff39fbfb, 0xff961717, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd41414, 0xffff0000, 0x00000000,
-     0x00000000, 0x00000000, 0xffc06161, 0xff0cffff, 0xff3df1ef, 0xff861717,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe71616, 0xff7bc6c7, 0xff999fa1, 0x00000000, 0x00000000, 0xffe24239,
-     0xff8bcbcb, 0xff00f6fe, 0xff5fe4e7, 0xff771111, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff92b26, 0xff5ecee0,
-     0xff0ce9ff, 0xff72b4c6, 0xff6ba3b9, 0xff67d5e6, 0xff13ddff, 0xff00e0ff,
-     0xffa9a4ac, 0xff740500, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffff4437, 0xff60c2e3, 0xff00b6ff, 0xff00b5ff,
-     0xff00bbff, 0xff00afff, 0xff09c2ff, 0xff6ad1eb, 0xffd1312c, 0xff310000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfffa3205, 0xffe07f59, 0xff55c9f1, 0xff29bcff, 0xff25b0ff, 0xff28b6ff,
-     0xff83bdd3, 0xfff8472e, 0xff640000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcb0800,
-     0xfff24f2b, 0xffe48643, 0xffe69a41, 0xffe49543, 0xfffc4115, 0xff760000,
-     0xff020206, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff1e0005, 0xff810100, 0xffb21b00,
-     0xffc22900, 0xffcd2700, 0xff750600, 0xff000004, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff060006, 0xff000007, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0xffce1813, 0xffd72b27, 0xffd2241f, 0xffcf110c,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffac5b53, 0xff62d5b0, 0xff56e2c3, 0xff96706c, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb75557, 0xff19ffc6,
-     0xff01ffe3, 0xff7e868b, 0xff380000, 0x00000000, 0x00000000, 0x00000000,
-     0xffc41209, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffc1353b, 0xff31f2e0, 0xff04fefc, 0xff838184,
-     0xff3d0000, 0x00000000, 0x00000000, 0xffcc2723, 0xff85c1ad, 0xff9c7661,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffc72c35, 0xff4bd8d2, 0xff00ffff, 0xff838182, 0xff340101, 0x00000000,
-     0xffca2b26, 0xff7bc0b6, 0xff21fff3, 0xff56fff5, 0xffb34c3e, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdd0606, 0xff5acece,
-     0xff00fffe, 0xff818383, 0xff3f0000, 0xffc72e2e, 0xff80bebd, 0xff14ffff,
-     0xff29fdfc, 0xff9db8ab, 0xffc42a0d, 0xff740502, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffe00000, 0xff64c9cc, 0xff00ffff, 0xff818989,
-     0xffbc0e0f, 0xff7cc7c7, 0xff15ffff, 0xff26ffff, 0xffa3b7b3, 0xfff63409,
-     0xff620900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffdd0000, 0xff65c0c2, 0xff00feff, 0xff67b3b4, 0xff8eb3b5, 0xff13ffff,
-     0xff27fcff, 0xffa4b5b1, 0xfff22d09, 0xff5c0b00, 0xff000001, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdd0000, 0xff76aaac,
-     0xff00ffff, 0xff1bf9ff, 0xff1efcff, 0xff0cf9fc, 0xff88d9d9, 0xffce1006,
-     0xff580300, 0xff000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff8a9a9c, 0xff07faff, 0xff38edf9,
-     0xff29ecf9, 0xff00e9fc, 0xff30f6fa, 0xff88696d, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff968185, 0xff0bf7ff, 0xff5bd6e1, 0xffa29d9c, 0xff13ecff,
-     0xff00defc, 0xff2ff3ff, 0xffaa767d, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa86366,
-     0xff14e8fd, 0xff41d7f4, 0xffdf251e, 0xff9b9298, 0xff12dfff, 0xff00c7f9,
-     0xff2dddf8, 0xff9a6a76, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbc5553, 0xff11d2ff, 0xff28dbff,
-     0xffa7312f, 0xffbb0300, 0xffa397a3, 0xff13cbff, 0xff00b8fd, 0xff3fd1ff,
-     0xffc53939, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbd4446, 0xff5bcde8, 0xff69cbdb, 0xff9d4342, 0xff190000,
-     0xffc00e04, 0xffa18ba2, 0xff1dcbff, 0xff9b8a9b, 0xfff84013, 0xff5f0603,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd50607,
-     0xffff5821, 0xffff6818, 0xffff2b10, 0x00000000, 0xff130000, 0xffb41209,
-     0xffc7696a, 0xffff461b, 0xff590b01, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd9130e, 0xffce3811, 0xffb53b0e,
-     0xff89160a, 0x00000000, 0x00000000, 0xff100000, 0xffc01400, 0xff620e04,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff001414, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff0b0205, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0xffba0f0a, 0xffd32121, 0xffbf2a36,
-     0xffc90e0f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffa83931, 0xff5edfac, 0xff45ebc7, 0xff8f4641, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffac3431,
-     0xff2cedb6, 0xff00ffcf, 0xff8e6761, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb51e1e, 0xff47d7cf, 0xff07fefe,
-     0xff957e7f, 0xff4a0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffbf1015, 0xff54c4c3, 0xff02ffff, 0xff94979a, 0xff440000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff61b1b3, 0xff00fffe, 0xff8aaaab, 0xff550000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff75a7a7, 0xff00ffff,
-     0xff7eb8b9, 0xff5c0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff899c9b, 0xff00feff, 0xff6bc6c9, 0xff6b0101,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff94898a, 0xff00feff, 0xff57d7db, 0xff771a1b, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff9c7578, 0xff01fefe,
-     0xff43dae9, 0xffa62222, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa85a60, 0xff07e6ff, 0xff28c2f6, 0xff9a8895,
-     0xff8e6879, 0xff797d94, 0xff7892a3, 0xffa64f58, 0xff490000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffaf454e, 0xff11c8fd, 0xff09a0fd, 0xff09b9ff, 0xff00b9ff, 0xff00a8ff,
-     0xff07c3ff, 0xff9c8693, 0xff3d0000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffac4753, 0xff24aff5,
-     0xff0093ff, 0xff0092ff, 0xff0093ff, 0xff0193ff, 0xff06b5ff, 0xff8b87a5,
-     0xff480000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffb72333, 0xff4d9de3, 0xff5296df, 0xff6f92c4,
-     0xff8b8ca6, 0xffa4858b, 0xffbd866e, 0xffdd4835, 0xff440000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffd10c0d, 0xffd4564a, 0xfff2733e, 0xffff7026, 0xffff6312, 0xffff560b,
-     0xfff44a0a, 0xfff12b06, 0xff470201, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffca1606, 0xff8c2a07,
-     0xff89350d, 0xff7b2e0d, 0xff5c190b, 0xff3d0908, 0xff2a0507, 0xff1c0304,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000002, 0x00000000, 0x00000000,
-     0x00000000, 0xff000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffca0a0e, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd50000, 0xffba2b1a, 0xffc80a04,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd30a08,
-     0xff9c9c8a, 0xffc62b26, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffb8311c, 0xff78dab0, 0xffd61015, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb4382e, 0xff58ffe8, 0xffa68978,
-     0xffe40000, 0x00000000, 0x00000000, 0x00000000, 0xffdb0104, 0xff64bb8e,
-     0xff4dffe0, 0xffc13b3d, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffa37a76, 0xff14feee, 0xff47e8d6, 0xffd02727, 0x00000000,
-     0x00000000, 0x00000000, 0xffa35e5f, 0xff15ffe6, 0xff20fde5, 0xffb16c66,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcd1816, 0xff5aeeec,
-     0xff00fefc, 0xff00ffff, 0xff919f9e, 0xffdd0404, 0x00000000, 0xffd21f1c,
-     0xff3fe8de, 0xff00faf9, 0xff01ffff, 0xffa49090, 0xffe10000, 0x00000000,
-     0x00000000, 0x00000000, 0xffac6665, 0xff2effff, 0xff14fcfc, 0xff3aeceb,
-     0xff49fdfe, 0xffb44f50, 0xffea0000, 0xff6eaeab, 0xff1cffff, 0xff2afbf9,
-     0xff00fefe, 0xff8fb0b0, 0xffde0404, 0x00000000, 0x00000000, 0xffd90709,
-     0xff92a3a3, 0xff05fefe, 0xff1effff, 0xffa87778, 0xff61dbda, 0xff71c4c4,
-     0xffcf4545, 0xff15ffff, 0xff7fd8d7, 0xff4ceaeb, 0xff00fefe, 0xff67dddd,
-     0xffd71919, 0x00000000, 0x00000000, 0xffbf2622, 0xff55ebeb, 0xff00fbfe,
-     0xff34f7fb, 0xffb52c2e, 0xffcc4a47, 0xff4effff, 0xff2bdee3, 0xff62f7f7,
-     0xffe24541, 0xff4ad0d4, 0xff00feff, 0xff3fffff, 0xffd82222, 0x00000000,
-     0x00000000, 0xffb46061, 0xff28ffff, 0xff00ebff, 0xff5bd8e3, 0xff920605,
-     0xffab0000, 0xffa3acaf, 0xff2effff, 0xffc87874, 0xfff20200, 0xff57c9d4,
-     0xff00efff, 0xff2af8fe, 0xffcf4847, 0x00000000, 0xffd80c0a, 0xff7fb3be,
-     0xff07d9fd, 0xff05d1ff, 0xff6baec6, 0xff500101, 0xff150000, 0xffca3c3d,
-     0xffc6a59a, 0xffd31f0e, 0xffa20301, 0xff7ea6b5, 0xff02d5ff, 0xff1edffe,
-     0xffa97b81, 0xffe20000, 0xffd61115, 0xff69b9d8, 0xff1ec7ff, 0xff08b8fd,
-     0xff828a9d, 0xff3b0000, 0xff000001, 0xff7f0400, 0xfff22e0c, 0xff250404,
-     0xff710000, 0xffa08b98, 0xff04c4fe, 0xff0bc5fc, 0xff89adbb, 0xffe00000,
-     0xff970c0f, 0xffcc6267, 0xff56c9f4, 0xff28d0ff, 0xff996471, 0xff240000,
-     0x00000000, 0xff1e0303, 0xff5c0404, 0xff000203, 0xff7f0000, 0xffab6a77,
-     0xff1bc8ff, 0xff2ed9ff, 0xffa18498, 0xffbe0000, 0x00000000, 0xffb32208,
-     0xffe96c58, 0xff66d5f4, 0xffa74855, 0xff090000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffa85661, 0xff57d4f9, 0xff9088a2,
-     0xfff6603c, 0xff7e0600, 0x00000000, 0x00000000, 0xff961a00, 0xffe45744,
-     0xffbc1e22, 0xff040000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffc22430, 0xffb95e73, 0xffff4c28, 0xff9b260d, 0xff090000,
-     0x00000000, 0x00000000, 0x00000000, 0xff721801, 0xff811204, 0xff050000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffeb0b04,
-     0xffc52e18, 0xff580805, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000402, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff560404, 0xff120003, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffa63738, 0xff943b39, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff95514e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff6ab196, 0xff45edc9, 0xff5d645f, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff7aa594, 0xff6fb392,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff50bea0,
-     0xff16ffea, 0xff47756c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff7e9284, 0xff20ffe1, 0xff6fa18c, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff48bbb0, 0xff06fefe, 0xff469592,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff79938e, 0xff00fdf3, 0xff19fff3, 0xff72a09b, 0x00000000, 0x00000000,
-     0x00000000, 0xff54bcbb, 0xff00fffe, 0xff59aeaf, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff789597, 0xff01ffff,
-     0xff00f9f6, 0xff20ffff, 0xff708f90, 0x00000000, 0x00000000, 0xff57babc,
-     0xff00fffe, 0xff5ccacc, 0xff3f1215, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff789597, 0xff00fffe, 0xff28f5f6, 0xff4bfcfc,
-     0xff29ffff, 0xff6d9091, 0xffb9050a, 0xff51c1c2, 0xff00fefe, 0xff4fdcde,
-     0xff342426, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff789496, 0xff00fefe, 0xff56dcdc, 0xffb45d5e, 0xff57f8f8, 0xff21ffff,
-     0xff6a7678, 0xff4ec3c3, 0xff00fffe, 0xff43ebec, 0xff573a3d, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff789496, 0xff00feff,
-     0xff51e7e9, 0xffb90000, 0xffd15b57, 0xff56fcfe, 0xff23fafa, 0xff32efef,
-     0xff01fdff, 0xff33f1f8, 0xff67494b, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff799196, 0xff00feff, 0xff62dde6, 0xff4e1213,
-     0xff740000, 0xffe45856, 0xff34f2fc, 0xff0aecff, 0xff04e3fc, 0xff23f3ff,
-     0xff764f53, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff788696, 0xff00dfff, 0xff63cde6, 0xff5e0e0e, 0xff000506, 0xffa60700,
-     0xffd75d5f, 0xff28e9fb, 0xff00c5fa, 0xff17e3fd, 0xff68565c, 0xff030000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff797b94, 0xff01b6fc,
-     0xff65bee6, 0xff5d1412, 0x00000000, 0xff060b0d, 0xffac0b00, 0xffe26265,
-     0xff38cdf9, 0xff12d0ff, 0xff606375, 0xff110000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff76799c, 0xff009dff, 0xff5ebaf5, 0xff5c1a17,
-     0x00000000, 0x00000000, 0xff09090b, 0xffb21403, 0xffe3595c, 0xff4ed3f0,
-     0xff5c8298, 0xff3b0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff8c6a7d, 0xff69b5cf, 0xff8da4c0, 0xff551515, 0x00000000, 0x00000000,
-     0x00000000, 0xff0e0604, 0xffb61c04, 0xfff45b56, 0xff835674, 0xff3f0909,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd5310f, 0xffff5317,
-     0xffff4519, 0xff5e130e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff130504, 0xffac280c, 0xffe23016, 0xff510911, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff882316, 0xff722417, 0xff7f2418, 0xff3a0d08,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060707,
-     0xff3f170d, 0xff3a0407, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfff82423, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd7302b, 0xff948d76, 0xff46e29d,
-     0xff60ddae, 0xffa17c6a, 0xffca0901, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffd43835, 0xff63ddc5, 0xff12ffd4, 0xff00ffc8, 0xff00ffbf, 0xff26ffd5,
-     0xff87a78d, 0xffc21306, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffc63f34, 0xff56e8cb, 0xff04ffe5,
-     0xff54dcb9, 0xffc0835f, 0xff87bea5, 0xff06ffd2, 0xff24ffef, 0xffa57566,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff7fa19a, 0xff00fffb, 0xff3ce6df, 0xffeb3426, 0xffff2c00,
-     0xffff1509, 0xff71bbba, 0xff04fcf6, 0xff58dad1, 0xffd62520, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbc4545, 0xff28f6f7,
-     0xff25fafc, 0xffa55355, 0xffa80000, 0xff54100c, 0xff910000, 0xffa74b47,
-     0xff1dffff, 0xff2bfcfe, 0xffb14343, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff9b7c7b, 0xff00ffff, 0xff49e8e7, 0xffb10e0e,
-     0xff0c0001, 0xff000303, 0xff010000, 0xffa52626, 0xff27fefe, 0xff24fffe,
-     0xffa84646, 0xff100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff998484, 0xff00fefe, 0xff50e8e8, 0xff871111, 0xff000303, 0x00000000,
-     0x00000000, 0xffbc3236, 0xff2cf0f0, 0xff23fefe, 0xffac4646, 0xff110000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff978484, 0xff00fefe,
-     0xff4bfcfa, 0xff633837, 0x00000000, 0x00000000, 0x00000000, 0xff927272,
-     0xff20fafa, 0xff1cffff, 0xffa54444, 0xff120000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff96807f, 0xff02fbff, 0xff19eef7, 0xff71a9ae,
-     0xff6f232b, 0x00000000, 0xffad3542, 0xff53c6ce, 0xff05f2f9, 0xff30f6f9,
-     0xffaa3232, 0xff0f0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffa35f5e, 0xff4cd7e2, 0xff05c5f7, 0xff19d5ff, 0xff57b9d8, 0xff6d8da4,
-     0xff4ebcdb, 0xff18cfff, 0xff01d2f7, 0xff67c0d0, 0xff9b170c, 0xff020202,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff858e99,
-     0xff10d0ff, 0xff00a7f2, 0xff06bdfc, 0xff0acaff, 0xff05bcfd, 0xff00a7f1,
-     0xff0bd0ff, 0xff966c70, 0xff520000, 0xff000406, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffda2124, 0xff5eb3db, 0xff05baff,
-     0xff00a5ff, 0xff00a7ff, 0xff00a8ff, 0xff0dc2ff, 0xff839dbf, 0xffaf0a08,
-     0xff0e0102, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff9c201a, 0xffb19ea1, 0xff6cb7d2, 0xff78abcf,
-     0xff6dafcf, 0xffc97766, 0xffdd230d, 0xff1e0001, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff060000, 0xff9d1400, 0xffff4600, 0xffff5a00, 0xffff5500, 0xffec3400,
-     0xff340601, 0xff000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000003,
-     0xff620902, 0xff9d1504, 0xff9b1507, 0xff3e0105, 0xff000001, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffff392d, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff84aa9b, 0xff78c3ab, 0xff86aa8c, 0xff8fa38e,
-     0xff8d957a, 0xff768367, 0xffb4341c, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdc4a3e,
-     0xff3bf6d8, 0xff00ffc5, 0xff00ffa4, 0xff00ffab, 0xff00ffa7, 0xff00ffae,
-     0xff3ce4b5, 0xffb44536, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd5403e, 0xff3ff5e6, 0xff0bfdd7,
-     0xff16fccd, 0xff06ffd8, 0xff0effd7, 0xff15fac7, 0xff00ffd2, 0xff49e1c5,
-     0xffcc2920, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffca4b4b, 0xff34fffe, 0xff05feef, 0xff44fdf0, 0xff27eaf4,
-     0xff21f0f9, 0xff44fffc, 0xff17faea, 0xff0affff, 0xff955b59, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc25454,
-     0xff2dfeff, 0xff00ffff, 0xff61ccd2, 0xffd84428, 0xffd46035, 0xffa6a1a0,
-     0xff26fdff, 0xff03fdfd, 0xff8e494a, 0xff170000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb85454, 0xff24fefe, 0xff00fefe,
-     0xff73bdc3, 0xffc51700, 0xff9d2c03, 0xffc62b2b, 0xff1cfefe, 0xff14ffff,
-     0xff964545, 0xff140000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffab5554, 0xff16feff, 0xff00ffff, 0xff9bc2bf, 0xff5a0000,
-     0xff1c0000, 0xff9c5e5e, 0xff03fffe, 0xff49e9e8, 0xff9d201f, 0xff070404,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa15457,
-     0xff12ffff, 0xff02fdff, 0xff77d6d8, 0xffb85456, 0xffb66b6a, 0xff35faf9,
-     0xff22fcff, 0xffd36762, 0xff6b0000, 0xff07251d, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff96656e, 0xff10f3ff, 0xff01d8fc,
-     0xff0df2ff, 0xff02ffff, 0xff13ffff, 0xff37e5ec, 0xffcd6764, 0xffa20501,
-     0xff160401, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff9a8684, 0xff03d6ff, 0xff08bffd, 0xff64cdda, 0xff68b4c0,
-     0xff958f97, 0xffe82e2a, 0xff990000, 0xff100303, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffd5b3b, 0xff8f8990,
-     0xff00b4fe, 0xff0ec2fe, 0xffaf7a80, 0xfffd0b00, 0xffb80d00, 0xff510200,
-     0xff000304, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffff451e, 0xff7a859d, 0xff008fff, 0xff11b3ff,
-     0xffb17576, 0xff4b0300, 0xff000805, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff92704, 0xff7485a9, 0xff21aff8, 0xff34cefb, 0xff975d61, 0xff1b0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd31c1e, 0xfff24517,
-     0xfff78639, 0xfffd843d, 0xffb11a12, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffd41c00, 0xffd24000, 0xffd43d00,
-     0xff960d00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000001, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb16544, 0xff6fb972, 0xff62c57f,
-     0xff85b082, 0xffcb5843, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffed1708,
-     0xff92ab85, 0xff34fda1, 0xff13ff9e, 0xff16ffa5, 0xff26ffa8, 0xff6bf3c0,
-     0xffce5243, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff9f7c79, 0xff2affe3, 0xff39fecf,
-     0xff9cd4b1, 0xffbea78b, 0xff89d9b5, 0xff34ffc9, 0xff6deece, 0xffe9201d,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffb95655, 0xff42eee8, 0xff2cfbf0, 0xff9aaeab, 0xffff732f, 0xffff7315,
-     0xfff55544, 0xff52e3de, 0xff38fffc, 0xffba7e7b, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa47c79, 0xff23ffff,
-     0xff66cad0, 0xfffb371b, 0xffd3551a, 0xff721d11, 0xffed1402, 0xff81a3af,
-     0xff1cfeff, 0xff85c3c2, 0xffe6110b, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffab8585, 0xff19fefe, 0xff87aba7, 0xffda0a01,
-     0xff300606, 0x00000000, 0xff8f0003, 0xffa29093, 0xff28fefe, 0xff6ed3d5,
-     0xffbe302a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffac8282, 0xff12feff, 0xffa3a7a4, 0xff830301, 0x00000000, 0x00000000,
-     0x00000000, 0xff95888a, 0xff25ffff, 0xff61e9eb, 0xffa42928, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffac8483, 0xff14fffe,
-     0xffa1a9a6, 0xff840000, 0xff000101, 0x00000000, 0xffc3464a, 0xff80a8ad,
-     0xff20fefe, 0xff5ee9ed, 0xff9b2523, 0xff0e0000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa67f83, 0xff13f9fe, 0xff7acfd3, 0xff931714,
-     0xff6a0000, 0xffb09290, 0xff58eaeb, 0xff32f4f6, 0xff1bffff, 0xff81c6c9,
-     0xff930001, 0xff000202, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffbb5f6b, 0xff31e7ff, 0xff2fe5ff, 0xff71a7ae, 0xffab0004, 0xffab9a9d,
-     0xff1cffff, 0xff10e3f8, 0xff1aeefe, 0xff5ad7e8, 0xff9d2b2d, 0xff280000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff93a3e, 0xff75c7ed,
-     0xff17bdfc, 0xff38d0ff, 0xff48a2c4, 0xff60c3da, 0xff2ad1fd, 0xff11c5fd,
-     0xff10c2fd, 0xff27e0ff, 0xff7bc5d7, 0xfffd2517, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff8c0400, 0xffcb6f7a, 0xff4ed7ff, 0xff15aafe,
-     0xff1ab9ff, 0xff16baff, 0xff19b8ff, 0xff52d1ff, 0xff43c9ff, 0xff2ed5ff,
-     0xffaa8b9e, 0xffc54125, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffc01f0f, 0xffe09c7f, 0xff66c6ed, 0xff41b5fd, 0xff47bbfd,
-     0xff65c5ef, 0xffd38880, 0xffe47e65, 0xff8ca4c5, 0xffef533f, 0xff611404,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff130000,
-     0xffbd2a0e, 0xffff8d50, 0xffe4ae7b, 0xffeaaf75, 0xffff8a4b, 0xffe3481b,
-     0xffd53a19, 0xffff7a3c, 0xffbc3d1b, 0xff020000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff400001, 0xff871408,
-     0xffd85013, 0xffd45b19, 0xffb82d11, 0xff2d0105, 0xff130b09, 0xffa83018,
-     0xff370603, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff130000, 0xff1e0000,
-     0xff090000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff70000,
-     0x00000000, 0x00000000, 0xffcb0000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffba2621, 0xff9c5965, 0xff97857f, 0xff8ba891, 0xff83ba9e, 0xff61c898,
-     0xff76b79e, 0xffa76d68, 0xffce0907, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffac6862, 0xff2dffd7,
-     0xff08f991, 0xff00fd8d, 0xff00f780, 0xff00f175, 0xff04fba4, 0xff39ffea,
-     0xff938d83, 0xffce0400, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffbe4244, 0xff30f8d7, 0xff02e889, 0xff17ec9c,
-     0xff0df9c2, 0xff15fcc3, 0xff02f4c0, 0xff02f6d4, 0xff3afffc, 0xffa2524d,
-     0xff5d0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffc62729, 0xff3cf4f0, 0xff00fbd3, 0xff39f7e3, 0xffce6864, 0xff9c7e6a,
-     0xff09f3e5, 0xff00faf3, 0xff2afcfd, 0xff8f999a, 0xff460000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd30c0c, 0xff53dedd,
-     0xff00fff8, 0xff29faf7, 0xffd62b1c, 0xffde0000, 0xff4fa8ac, 0xff06fdfe,
-     0xff48ffff, 0xff986a68, 0xff400000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd50000, 0xff68d1d1, 0xff00feff, 0xff1effff,
-     0xffa21f20, 0xff9c0609, 0xff4fd0cf, 0xff21ffff, 0xff82c1bf, 0xffba190e,
-     0xff0f0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffd40000, 0xff79c1c1, 0xff00fffe, 0xff13fefe, 0xffa07676, 0xff5fa8a7,
-     0xff10ffff, 0xff6ad1cf, 0xffec3a22, 0xff450000, 0xff000001, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd40000, 0xff8aa6a5,
-     0xff00feff, 0xff12fcfc, 0xff2af9f9, 0xff11ffff, 0xff46dad7, 0xffee3816,
-     0xff720800, 0xff000305, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd40000, 0xff918383, 0xff02ffff, 0xff03f0fb,
-     0xff0effff, 0xff00f6fe, 0xff36eaf0, 0xff97b1ab, 0xff831e22, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff956767, 0xff11f5ff, 0xff04dffd, 0xff62d9e6, 0xff39ddeb,
-     0xff00e3ff, 0xff1aeaff, 0xff83dee0, 0xffcd5757, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffad5954,
-     0xff27e6fe, 0xff00cefe, 0xff72a0b4, 0xffc9383e, 0xff40d3ef, 0xff00b4ff,
-     0xff08b9ff, 0xff5acde5, 0xffa86371, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb65552, 0xff2cc3fd, 0xff00a2fe,
-     0xff4cafcc, 0xfff30000, 0xffe2433c, 0xff5ea3d9, 0xff08a1ff, 0xff36cef8,
-     0xffbe8379, 0xffcc3511, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffb94347, 0xff37cfff, 0xff13bdff, 0xff5bc1dc, 0xff8c1017,
-     0xffb00f00, 0xfffc4b2b, 0xff96a0af, 0xffe66a3c, 0xfff24a00, 0xff61160a,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc3131c,
-     0xffc47b70, 0xffd7835b, 0xfff96638, 0xff840c04, 0xff090102, 0xffac2503,
-     0xffff5003, 0xffc53600, 0xff2d0606, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff3400, 0xfffc5200,
-     0xffec3800, 0xff7b0b00, 0x00000000, 0xff180309, 0xff6b1507, 0xff180003,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff610a0c, 0xff3a0003, 0xff230002, 0xff0b0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffe10000, 0xffd50000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb36c6c, 0xff6fb99f,
-     0xff62b27e, 0xff50cca5, 0xffa0685f, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe70002, 0xffb07c70, 0xff49fcca, 0xff13ff9a, 0xff00ff8c, 0xff00ffa9,
-     0xff8ea09d, 0xff730000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffaa7b6c, 0xff2affe8,
-     0xff00fca1, 0xff01fba6, 0xff11fab2, 0xff0effd1, 0xff74c1b6, 0xffaa0907,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffc12e2c, 0xff52e7c9, 0xff0efdc3, 0xff0effc2, 0xff27ffe3,
-     0xff33feeb, 0xff34ebf6, 0xff6eaeb0, 0xff960e0a, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffad6365,
-     0xff10fcea, 0xff06fedc, 0xff4ff4df, 0xff95bc9a, 0xffb3b178, 0xffd1a454,
-     0xfff06f29, 0xff7d0401, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffaa7878, 0xff0cfefe, 0xff00feff,
-     0xff79c2b7, 0xffff3c00, 0xffe07610, 0xffc66113, 0xffc43509, 0xff620101,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffb94648, 0xff38ffff, 0xff09fcfb, 0xff2cefee, 0xffab6f6e,
-     0xffbd1114, 0xff7b0000, 0xff1a0000, 0xff000102, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe31109,
-     0xff85989d, 0xff3effff, 0xff0fffff, 0xff0dffff, 0xff54d5d5, 0xff948b8b,
-     0xffb61c1c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcb3924, 0xffa09e8a,
-     0xff6ed5d8, 0xff28ffff, 0xff00ffff, 0xff09ffff, 0xff70c3c2, 0xffc0211f,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff6d1307, 0xffd54a12, 0xffdf541e, 0xffbb7a73,
-     0xff2ae9ea, 0xff00eefb, 0xff0effff, 0xff9b6567, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff320000, 0xffd10400, 0xff70b7c6, 0xff01c4fe,
-     0xff09d1fa, 0xff9093a2, 0xff4e0000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd11a20,
-     0xffa4433f, 0xff878a97, 0xff1bbefa, 0xff00a2fd, 0xff28deff, 0xffd0716c,
-     0xff4a0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffa4727d, 0xff2af8ff, 0xff1fd0ff,
-     0xff19bdff, 0xff38c9ff, 0xff7f8eaa, 0xffd2200c, 0xff250001, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffb74851, 0xff7b9ea2, 0xff9a818e, 0xffac8786, 0xffc9735e,
-     0xffee370b, 0xff600805, 0xff000202, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdd1909,
-     0xffff692f, 0xfffd5f1c, 0xffed4a05, 0xffb6390e, 0xff5b0c06, 0xff0a0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff590d0b, 0xff390409,
-     0xff290206, 0xff120001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff30000, 0xffe50000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffdf251e, 0xffd84843, 0xffd0494d, 0xffbd5960, 0xff9e7d82, 0xff998082,
-     0xff8f948d, 0xff87a494, 0xff75c1a8, 0xff997e71, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb55b51, 0xff38f4bb,
-     0xff29ffa1, 0xff1dffa6, 0xff18ffa8, 0xff0effad, 0xff01ffaf, 0xff00ffb3,
-     0xff00ffbc, 0xff46e2c2, 0xff7b0a0a, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffac6358, 0xff00ffe0, 0xff00fec0, 0xff16ffc1,
-     0xff0efdad, 0xff00fca5, 0xff0ef7c2, 0xff52cebe, 0xff55bab3, 0xff99928c,
-     0xff8b1310, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffe12e19, 0xffca6e4c, 0xffe06342, 0xffca5a5f, 0xff26f1eb, 0xff01ffe1,
-     0xff3ed9dd, 0xfffa2b21, 0xffff6611, 0xffff5609, 0xffb50600, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff70600, 0xffff3f01,
-     0xffff3b00, 0xffe0231b, 0xff2ae7e7, 0xff00fff2, 0xff33eff1, 0xffcf2825,
-     0xff921d06, 0xff791508, 0xff480100, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff310003, 0xff140000, 0xff790d10,
-     0xff52e2e2, 0xff00fefd, 0xff32fefe, 0xff963031, 0x00000000, 0xff000002,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffb20000, 0xff5bcaca, 0xff00feff,
-     0xff23feff, 0xff963434, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff55c3c4, 0xff00fffe, 0xff18fefe, 0xff953838,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff5ac1c5, 0xff00f1ff, 0xff11feff, 0xff8e4e4e, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff59bdc5, 0xff00daff,
-     0xff08f4ff, 0xff896666, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff59b7c5, 0xff00bcfe, 0xff01dbfe, 0xff84777e,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff5bafc1, 0xff01a2fa, 0xff02c3fb, 0xff8b91a0, 0xff4a0000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff52c0d4, 0xff00adff,
-     0xff00ccff, 0xff86a5bc, 0xff580000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff967576, 0xff9c9898, 0xffa09c8e, 0xffc86e62,
-     0xff5a0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe50000,
-     0xffff1700, 0xffff4500, 0xffff4400, 0xffff2f00, 0xff6b0000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff710706, 0xff5e0405,
-     0xff4e0205, 0xff450103, 0xff1d0200, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffeb130f, 0xff84a99c, 0xff5bcfc3, 0xffa97a71, 0x00000000, 0x00000000,
-     0x00000000, 0xffa41210, 0xffb59983, 0xffa99587, 0xffb2312e, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffdd2d31, 0xff46dcbe,
-     0xff00ffd0, 0xff999688, 0x00000000, 0x00000000, 0x00000000, 0xffb22624,
-     0xff35ffc8, 0xff04ffd0, 0xff985e59, 0xff180000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffcd4145, 0xff46dace, 0xff02fcef, 0xff9f7e7c,
-     0x00000000, 0x00000000, 0x00000000, 0xffb73132, 0xff1ffcdb, 0xff13fcd7,
-     0xffac4947, 0xff160000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffca4949, 0xff24f4f4, 0xff00ffff, 0xff778585, 0x00000000, 0x00000000,
-     0x00000000, 0xffb74543, 0xff0cfffe, 0xff26fffb, 0xffac3c3d, 0xff0f0000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb86160, 0xff15fdfd,
-     0xff00fffe, 0xff7b8584, 0x00000000, 0x00000000, 0x00000000, 0xffb55a59,
-     0xff00fefe, 0xff39faf9, 0xffa13030, 0xff040000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffac6d6d, 0xff0dfeff, 0xff00feff, 0xff7a8585,
-     0x00000000, 0x00000000, 0x00000000, 0xffaa7274, 0xff00fffe, 0xff4beded,
-     0xff932525, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffa47473, 0xff07fffe, 0xff07fffe, 0xff7a8585, 0x00000000, 0x00000000,
-     0x00000000, 0xff998d90, 0xff00feff, 0xff5fdddd, 0xff831717, 0xff000402,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa87475, 0xff04f9fe,
-     0xff04f8ff, 0xff897a87, 0x00000000, 0x00000000, 0xfff80200, 0xff80a6b2,
-     0xff00ffff, 0xff77cecd, 0xff6d0707, 0xff000b09, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa66b76, 0xff08eaff, 0xff00d9fe, 0xff57bcd6,
-     0xffbf4051, 0xffca1c27, 0xffa3777c, 0xff22d9f4, 0xff00f0fe, 0xff7dbbbf,
-     0xff5e0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffcb3e36, 0xff35ddf9, 0xff01c5fd, 0xff07d1ff, 0xff3fc2e8, 0xff48bae0,
-     0xff13d9ff, 0xff01c6fe, 0xff0be3ff, 0xffa28491, 0xff620000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff890f00, 0xff6ab9ce,
-     0xff00cdff, 0xff02aff8, 0xff00bdff, 0xff00c1ff, 0xff01b3fa, 0xff04befb,
-     0xff35d4fa, 0xffd23647, 0xff4d0000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff490500, 0xffcd6145, 0xff34cae7, 0xff00c0ff,
-     0xff00aeff, 0xff00acfe, 0xff00b8ff, 0xff19d5ff, 0xffa5899d, 0xff9e0304,
-     0xff0c0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff8c2405, 0xffee5f39, 0xff7ba1b7, 0xff4cade5, 0xff30aef7,
-     0xff59a1d1, 0xffb98274, 0xffcb2d13, 0xff1e0000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff030101,
-     0xff8a2d02, 0xffff6203, 0xfffa6d1c, 0xfff06927, 0xffff6313, 0xffce3c00,
-     0xff1b0400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff040000, 0xff742203,
-     0xffd93900, 0xffda4100, 0xff973202, 0xff1f0403, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000003, 0xff000004, 0xff000004,
-     0xff000004, 0xff000606, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffc06e61, 0xffaeb1a6, 0xfffb0000, 0x00000000, 0x00000000,
-     0x00000000, 0xffed3b37, 0xffb48877, 0xffeb210e, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd95e5d, 0xff56ffff,
-     0xff63f5d4, 0xffe73331, 0x00000000, 0x00000000, 0x00000000, 0xffcc715e,
-     0xff45ffd8, 0xff91ccb0, 0xffe3413e, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffe16d6d, 0xff52fefe, 0xff0dfef9, 0xffcf6e69,
-     0x00000000, 0x00000000, 0xffeb2327, 0xff87d0ac, 0xff04fbb1, 0xff90e4c5,
-     0xffe72521, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffff0c0c, 0xff9cd4d3, 0xff02feff, 0xff74b5b6, 0xfff71315, 0x00000000,
-     0xffdc5153, 0xff30fcf1, 0xff0dffe9, 0xffd87c70, 0xffb30000, 0xff000303,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffd0000, 0xffe77779,
-     0xff0effff, 0xff35f5f6, 0xffd24040, 0xffff0000, 0xff81c5c5, 0xff00feff,
-     0xff53f7fb, 0xffff2826, 0xff520000, 0xff000404, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfffd3c3c, 0xff60f6f6, 0xff05ffff,
-     0xff9a8888, 0xffd14343, 0xff30ffff, 0xff00fffe, 0xffc7aea9, 0xffcf0000,
-     0xff0c0101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffff0606, 0xffb5bcbd, 0xff00fdfd, 0xff63dcdc, 0xff81d5d5,
-     0xff01fdfd, 0xff42f9f8, 0xffff403b, 0xff580000, 0xff000606, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff95c5c, 0xff33ffff, 0xff1cfdfd, 0xff26fcfc, 0xff04ffff, 0xffc3b4b0,
-     0xffcf0000, 0xff050101, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0e0f, 0xff8cebeb,
-     0xff00f9fe, 0xff00f6fb, 0xff3ffcfb, 0xffff3b39, 0xff580000, 0xff000202,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xfffe0000, 0xffd5858a, 0xff16edff, 0xff00d9ff,
-     0xffb5b5b8, 0xffdd0402, 0xff0c0102, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfffd3937, 0xff54d4fc, 0xff34bdfc, 0xffff4034, 0xff5b0000,
-     0xff000202, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0200,
-     0xffaca5c2, 0xffc99ba4, 0xffe00400, 0xff090002, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff62224, 0xfff93c27,
-     0xff5c0000, 0xff000102, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffff0e00, 0xffe01d00, 0xff030100, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xfff50801, 0xff580501, 0xff010000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000404,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd20f0b,
-     0xffa98275, 0xffb37975, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffdb0000, 0xffb36b6b, 0xffbc6464, 0x00000000,
-     0x00000000, 0x00000000, 0xffcd2727, 0xff8dc5bc, 0xff44ffeb, 0xffa6bbb3,
-     0xffb00102, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffdc0002, 0xff8ac6c0, 0xff60f6db, 0xff9da59a, 0xffdb1a1a, 0x00000000,
-     0xffbe4647, 0xff6df7f4, 0xff2febd9, 0xff9ad2d2, 0xffb30e0f, 0x00000000,
-     0x00000000, 0xffd60000, 0x00000000, 0x00000000, 0xffe00004, 0xff86bcb6,
-     0xff39f2cc, 0xff6ef3e6, 0xffb83031, 0x00000000, 0xffc92d28, 0xff80cbcb,
-     0xff24f7fa, 0xff8ee2e4, 0xffac2525, 0xff3f0000, 0xffd93131, 0xffbe3e3e,
-     0x00000000, 0x00000000, 0xffdf0002, 0xff87c2bf, 0xff2df3e3, 0xff55e3dc,
-     0xff89181a, 0x00000000, 0x00000000, 0xff90b6b8, 0xff1efcff, 0xff78f3f7,
-     0xffb32f30, 0xffaa0a0a, 0xff81cbd1, 0xff64ebec, 0xffc7393c, 0x00000000,
-     0xffe10608, 0xff87bec1, 0xff1ffdfa, 0xff70c4c1, 0xff950d0d, 0x00000000,
-     0x00000000, 0xff9ea5a7, 0xff28fffe, 0xff5efdff, 0xffcd3a3a, 0xff9b9092,
-     0xff25ffff, 0xff1df7ff, 0xff72ced1, 0xffcc2d2f, 0xffe90000, 0xff75cbd1,
-     0xff0effff, 0xff83a0a4, 0xff740602, 0x00000000, 0x00000000, 0xffac9394,
-     0xff31ffff, 0xff54f3f7, 0xffa3bfbf, 0xff3bfaff, 0xff72e3e8, 0xff4cf0f9,
-     0xff19ffff, 0xff8bb1b6, 0xffda1817, 0xff5edee4, 0xff08fffe, 0xffa57d81,
-     0xff3c0100, 0x00000000, 0x00000000, 0xffaf9a9c, 0xff41f2fc, 0xff31eaf9,
-     0xff54faff, 0xff59f8fa, 0xfff0705e, 0xffd7998c, 0xff38fcff, 0xff1bf7ff,
-     0xffabacae, 0xff53e0ea, 0xff0bfdff, 0xffb16266, 0xff280000, 0x00000000,
-     0x00000000, 0xffc94e4c, 0xff59e4f6, 0xff0fd5ff, 0xff2fe8ff, 0xffb9b4b0,
-     0xffcd3123, 0xffe33527, 0xffc6bbb6, 0xff24f8ff, 0xff3aedff, 0xff30ecff,
-     0xff23edfc, 0xff953c3d, 0xff1c0000, 0x00000000, 0x00000000, 0xffd12c2a,
-     0xff6fd7ef, 0xff0dc5fe, 0xff77d7ec, 0xffe4523d, 0xff560f0a, 0xff5e1413,
-     0xfff03e30, 0xffadcfd2, 0xff15e1ff, 0xff0bd1fe, 0xff3ed1f1, 0xff81181a,
-     0xff080000, 0x00000000, 0x00000000, 0x00000000, 0xff7cc4de, 0xff35ccff,
-     0xffd77f77, 0xff8e1909, 0xff010302, 0xff000201, 0xff640d09, 0xffec493a,
-     0xff86cde1, 0xff08c2ff, 0xff5ca6de, 0xff7e0100, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff8cbdd3, 0xff9ebfd6, 0xffd93c22, 0xff1c0c07,
-     0x00000000, 0x00000000, 0xff000202, 0xff670e05, 0xffdc5d49, 0xff5bcbf3,
-     0xff7c97cf, 0xff630000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffae98af, 0xffdc7b6d, 0xff751c0a, 0xff000001, 0x00000000, 0x00000000,
-     0x00000000, 0xff000001, 0xff992010, 0xffd07669, 0xffaf95a7, 0xff590404,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff14944, 0xffcd3f24,
-     0xff180905, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff1f0404, 0xffbe3623, 0xffd24532, 0xff4b0a09, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffb13922, 0xff5f2113, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff190302,
-     0xffa6301c, 0xff410604, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff1e0e0a, 0xff060201, 0xff010000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff210101, 0xff230000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffd3676a, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa89f9b,
-     0xff60ffe8, 0xffbb9a95, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffcb6e5f, 0xffc07a59, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffff0f06, 0xffa6bab4, 0xff3cfbe8, 0xff5dfee9,
-     0xffbea7aa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc57464,
-     0xff61f1a7, 0xff53feb8, 0xffc3746b, 0x00000000, 0x00000000, 0x00000000,
-     0xffb11100, 0xfff9551f, 0xff9dbfc1, 0xff36ffff, 0xff68eded, 0xffd57778,
-     0x00000000, 0xffff0200, 0xffa99694, 0xff50f5e2, 0xff31ffd3, 0xff5df5e2,
-     0xffc4665a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff7f1200,
-     0xffff5621, 0xff90c8cb, 0xff2cffff, 0xff72e9e9, 0xffea4344, 0xff9d9698,
-     0xff3ffefe, 0xff24ffff, 0xff54e6f0, 0xffe88364, 0xffe52001, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa31200, 0xffff5f3d,
-     0xff6be6e8, 0xff3fffff, 0xff65f6f6, 0xff35ffff, 0xff18ffff, 0xff59dde4,
-     0xffef6b4d, 0xffe93603, 0xff431107, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff110204, 0xffb80e00, 0xffdc6b66, 0xff27fefe,
-     0xff18fefe, 0xff1ffdfc, 0xff5cdcdb, 0xfffa6d4b, 0xffca1b00, 0xff210002,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffd00003, 0xff9da4a3, 0xff0ffffe, 0xff18f7f7, 0xff25fffe,
-     0xffc87f75, 0xffa80700, 0xff0a0004, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0307, 0xffa8929b,
-     0xff15fbff, 0xff30f5ff, 0xff56f7ff, 0xff0ff9fe, 0xff73d1d3, 0xff721015,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xfffa0510, 0xff938aa1, 0xff13e8ff, 0xff1de4ff, 0xff85cfd1,
-     0xffafb5a7, 0xff26f3ff, 0xff13faff, 0xff9b8fa0, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0xffa37b91,
-     0xff10d6ff, 0xff1bcfff, 0xff80d0dd, 0xfff36b39, 0xffeb5d2e, 0xff76cfd9,
-     0xff0fd5fc, 0xff34e1fc, 0xffc15160, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa86a83, 0xff12c0ff, 0xff1bbcff, 0xff7ac1d8,
-     0xfff67841, 0xffc6390e, 0xffc83812, 0xffe0806c, 0xff3cdcff, 0xff05cbfc,
-     0xff62abca, 0xffef1e2d, 0x00000000, 0x00000000, 0x00000000, 0xffba6d78,
-     0xff2cf2ff, 0xff2dcfff, 0xff5ec1f2, 0xffea7c5a, 0xffe85613, 0xff160306,
-     0xff5f1405, 0xfffd5c32, 0xff6fc1de, 0xff00baff, 0xff12c1ff, 0xff8f7898,
-     0x00000000, 0x00000000, 0x00000000, 0xfff24738, 0xffde8f5e, 0xffd1956d,
-     0xffd77a60, 0xfff95d23, 0xff4a0c09, 0x00000000, 0x00000000, 0xfff84519,
-     0xffb77b7a, 0xff66bad1, 0xff96acb3, 0xffde5443, 0x00000000, 0x00000000,
-     0x00000000, 0xffee1d12, 0xffff5e17, 0xffff6312, 0xffff4b1d, 0xff98170f,
-     0x00000000, 0x00000000, 0x00000000, 0xffde2210, 0xffff7338, 0xffff7f33,
-     0xffff5a1f, 0xffbd1004, 0x00000000, 0x00000000, 0x00000000, 0xff140000,
-     0xff1b0000, 0xff320001, 0xff4a0001, 0xff160000, 0xff020200, 0x00000000,
-     0x00000000, 0xffb60000, 0xffa5160b, 0xff91140f, 0xff3e0000, 0xff010000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffcf0808, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffbc5657, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb84e4f,
-     0xff9d9e9c, 0xffc23432, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffa08572, 0xff70fcda, 0xffae6763, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffa76369, 0xff64e4d7, 0xff54fff3, 0xffa48282,
-     0x00000000, 0x00000000, 0x00000000, 0xffa38e85, 0xff5df5ca, 0xff4ae4a9,
-     0xff73f7e8, 0xffc74541, 0x00000000, 0x00000000, 0x00000000, 0xff8b1c1a,
-     0xffa4baba, 0xff31f9ef, 0xff37e8e0, 0xff78d0d3, 0xffbd3c3b, 0x00000000,
-     0xff94898c, 0xff46f8f2, 0xff3ce1d2, 0xff55faee, 0xffbebeb0, 0xffc42e22,
-     0xff150102, 0x00000000, 0x00000000, 0x00000000, 0xff9f3330, 0xff70e6e7,
-     0xff16f1f8, 0xff35fcff, 0xff9e9fa0, 0xff9b898b, 0xff41f9ff, 0xff23e5f6,
-     0xff51fdff, 0xffc5b8ae, 0xffe12213, 0xff2c0000, 0xff000402, 0x00000000,
-     0x00000000, 0x00000000, 0xff560402, 0xffbe746e, 0xff40fdfd, 0xff12f1fd,
-     0xff4bf5fc, 0xff3ff6ff, 0xff17eefc, 0xff49ffff, 0xffcab9ad, 0xffe02110,
-     0xff270000, 0xff000103, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff880c0a, 0xffa3aaa8, 0xff1fffff, 0xff1aeefd, 0xff18f0fd,
-     0xff43ffff, 0xffc1c0b4, 0xffcd2718, 0xff220000, 0xff000102, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffc04843, 0xff59e7ee, 0xff0cebfd, 0xff35faff, 0xffb3c6b9, 0xffc32719,
-     0xff1f0000, 0xff000404, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc12323, 0xff51cbde,
-     0xff08ddff, 0xff46e6f8, 0xffbb3d37, 0xff230000, 0xff000305, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffb22e2d, 0xff3fcbee, 0xff0cbffe, 0xff56cfed,
-     0xff731c1b, 0xff000101, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffaf302e, 0xff39bded, 0xff0da5fe, 0xff62bae2, 0xff690e09, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffac332e, 0xff2eacee,
-     0xff0182fe, 0xff67a1d2, 0xff5b0803, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffaa2f2c, 0xff35bfe8, 0xff16b4ff, 0xff7d9bbd,
-     0xff460300, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xffc2170f, 0xffeb7633, 0xffef903d, 0xffe74f2c, 0xff260000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbd0d0a, 0xffc82c13,
-     0xffd13a17, 0xffc01a0b, 0xff140000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff010000, 0xff020000, 0xff060000,
-     0xff020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffe24540, 0xffb9938d, 0xffbf8d7e,
-     0xffbe9081, 0xffb4887b, 0xffb28a7c, 0xffb4897b, 0xffac8f89, 0xffda554e,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffb9857d, 0xff0affe5, 0xff08ffbe, 0xff0affc4, 0xff0affc4,
-     0xff0fffc0, 0xff14ffba, 0xff0effdd, 0xffad9085, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc56b65,
-     0xff61dfd2, 0xff68d3be, 0xff69d9c4, 0xff65e3cb, 0xff50f2d7, 0xff1eecc2,
-     0xff15f8df, 0xffb6867f, 0xff420000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xffff1b12, 0xffff482a, 0xffff6539,
-     0xffff5228, 0xffeb473d, 0xff61f8f4, 0xff25f6e5, 0xff3bffff, 0xffa07575,
-     0xff3c0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffd2140f, 0xffac2219, 0xffb22617, 0xfff3291c, 0xff8ec3c3,
-     0xff29fefe, 0xff46ffff, 0xff84aeab, 0xffd92413, 0xff300303, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff630709, 0xff90c2c4, 0xff25ffff, 0xff43ffff, 0xff6cc1be,
-     0xffe14921, 0xff961a08, 0xff0d0001, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff9cbdbc,
-     0xff29ffff, 0xff37ffff, 0xff8bb9b6, 0xffe66530, 0xff931e0b, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff97b3b1, 0xff29ffff, 0xff37ffff, 0xffa3b4ae,
-     0xffff5d25, 0xff93220b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff92b0b0,
-     0xff27ffff, 0xff35ffff, 0xffa1bbb5, 0xffff5b21, 0xff9a220c, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff9f9fa6, 0xff2cfcff, 0xff2ef5ff, 0xff9cc2be,
-     0xfff65a27, 0xff7c1f0e, 0xff000105, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffae848e,
-     0xff2ceeff, 0xff22defd, 0xff98c3c6, 0xffff3306, 0xffc80d00, 0xff320000,
-     0xff510000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xffda3943, 0xff3cc5f9, 0xff019df9, 0xff2cbdfb,
-     0xff7bb8d2, 0xffa4697e, 0xffa07086, 0xffab6f83, 0xffab7e89, 0xffd63f49,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff51a17,
-     0xff7fa9ce, 0xff14b8ff, 0xff17a2ff, 0xff19a9ff, 0xff17b8ff, 0xff0fc8ff,
-     0xff12c8ff, 0xff0cc7ff, 0xff36e5ff, 0xffc15b5e, 0xff490000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xfff31215, 0xffb96a73, 0xffa38a91,
-     0xffa9888d, 0xffa7898e, 0xffa7888d, 0xffa98589, 0xffa98588, 0xffa6838b,
-     0xffb4677d, 0xff8d2a1e, 0xff050000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xffff0d0b, 0xffff4219, 0xffff691d, 0xffff7221, 0xffff711f,
-     0xffff7121, 0xffff7121, 0xffff731f, 0xffff6320, 0xffff3620, 0xff280704,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff250203, 0xff250002, 0xff250002, 0xff250002, 0xff250002, 0xff250002,
-     0xff250002, 0xff250002, 0xff240303, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000}};
+const sprite_t charset_sprite = {16, 17, 59, charset_palette, charset_palettes,
+                            charset_runs, charset_lines};
+#endif
@@ -1,181 +1,129 @@
+#ifndef MARIO_SPRITE_H
+#define MARIO_SPRITE_H
 #include <stdint.h>
 
+#include "power/Memory.h"
+#include "power/Sprite.h"
+
 #define FRAME_COUNT 4
 #define FRAME_WIDTH 16
 #define FRAME_HEIGHT 16
 
-/* Piskel data for "Mario16x16" */
+/* 4 frames, 51 colors, 502 runs (sprite_convert.py) */
+
+HOTMEM const uint8_t mario_palette[] = {
+    0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xc8, 0x00, 0x18, 0xf8, 0x20, 0x38,
+    0xe0, 0x60, 0x58, 0xf8, 0xa8, 0x70, 0x40, 0x58, 0xb8, 0x30, 0x38, 0x88,
+    0x70, 0x88, 0xe8, 0xf8, 0xf8, 0xf8, 0xa8, 0x50, 0x00, 0xe0, 0x80, 0x30,
+    0xf0, 0xc8, 0x30, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xc8, 0x00, 0x18,
+    0xf8, 0x20, 0x38, 0xe0, 0x60, 0x58, 0xf8, 0xa8, 0x70, 0x70, 0x88, 0xe8,
+    0x40, 0x58, 0xb8, 0x30, 0x38, 0x88, 0xf8, 0xf8, 0xf8, 0xe0, 0x80, 0x30,
+    0xa8, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xc8, 0x00, 0x18,
+    0xf8, 0x20, 0x38, 0xe0, 0x60, 0x58, 0xf8, 0xa8, 0x70, 0x40, 0x58, 0xb8,
+    0x70, 0x88, 0xe8, 0x30, 0x38, 0x88, 0xf8, 0xf8, 0xf8, 0xf0, 0xc8, 0x30,
+    0xa8, 0x50, 0x00, 0xe0, 0x80, 0x30, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00,
+    0xc8, 0x00, 0x18, 0xf8, 0x20, 0x38, 0xf8, 0xf8, 0xf8, 0xe0, 0x60, 0x58,
+    0x40, 0x58, 0xb8, 0xf8, 0xa8, 0x70, 0x70, 0x88, 0xe8, 0x30, 0x38, 0x88,
+    0xf0, 0xc8, 0x30, 0xa8, 0x50, 0x00, 0xe0, 0x80, 0x30,
+};
+HOTMEM const uint16_t mario_palettes[] = {
+    0, 13, 25, 38,
+};
+HOTMEM const uint8_t mario_runs[] = {
+    5, 0, 6, 1, 5, 0, 4, 0, 1, 1, 2, 2,
+    2, 3, 2, 4, 2, 1, 3, 0, 3, 0, 1, 1,
+    2, 2, 7, 3, 1, 1, 2, 0, 3, 0, 3, 1,
+    2, 5, 1, 1, 1, 5, 3, 1, 3, 0, 2, 0,
+    1, 1, 2, 6, 2, 1, 1, 5, 1, 1, 4, 6,
+    1, 1, 2, 0, 2, 0, 1, 1, 2, 5, 2, 1,
+    2, 6, 1, 1, 3, 5, 1, 1, 2, 0, 3, 0,
+    2, 1, 2, 5, 1, 6, 5, 1, 3, 0, 4, 0,
+    2, 1, 5, 5, 1, 1, 4, 0, 3, 0, 1, 1,
+    2, 7, 1, 1, 1, 3, 1, 8, 1, 7, 1, 1,
+    5, 0, 2, 0, 1, 1, 1, 8, 1, 7, 1, 9,
+    1, 7, 1, 1, 1, 3, 1, 8, 1, 7, 1, 1,
+    4, 0, 2, 0, 1, 1, 3, 8, 1, 7, 1, 1,
+    3, 3, 1, 1, 4, 0, 3, 0, 1, 1, 3, 10,
+    1, 1, 1, 2, 1, 10, 1, 4, 1, 1, 4, 0,
+    3, 0, 1, 1, 2, 10, 1, 11, 2, 12, 1, 1,
+    1, 2, 1, 1, 4, 0, 4, 0, 1, 1, 3, 11,
+    1, 12, 1, 13, 1, 1, 5, 0, 4, 0, 7, 1,
+    5, 0, 16, 0, 5, 0, 6, 1, 5, 0, 4, 0,
+    1, 1, 2, 2, 2, 3, 2, 4, 2, 1, 3, 0,
+    3, 0, 1, 1, 2, 2, 7, 3, 1, 1, 2, 0,
+    3, 0, 3, 1, 2, 5, 1, 1, 1, 5, 3, 1,
+    3, 0, 2, 0, 1, 1, 2, 6, 2, 1, 1, 5,
+    1, 1, 4, 6, 1, 1, 2, 0, 2, 0, 1, 1,
+    2, 5, 2, 1, 2, 6, 1, 1, 3, 5, 1, 1,
+    2, 0, 3, 0, 2, 1, 2, 5, 1, 6, 5, 1,
+    3, 0, 4, 0, 2, 1, 5, 5, 1, 1, 4, 0,
+    3, 0, 1, 1, 1, 7, 1, 8, 1, 1, 1, 3,
+    1, 9, 1, 8, 1, 1, 1, 9, 1, 1, 3, 0,
+    3, 0, 1, 1, 1, 9, 1, 7, 1, 8, 1, 1,
+    1, 3, 1, 9, 1, 8, 1, 1, 1, 9, 1, 1,
+    2, 0, 2, 0, 1, 1, 2, 10, 2, 9, 1, 1,
+    1, 2, 2, 3, 1, 1, 1, 10, 1, 1, 2, 0,
+    2, 0, 1, 1, 2, 10, 2, 1, 2, 2, 1, 10,
+    1, 3, 2, 1, 3, 0, 3, 0, 2, 1, 3, 2,
+    1, 1, 2, 2, 1, 11, 1, 1, 3, 0, 3, 0,
+    1, 1, 2, 12, 1, 11, 2, 1, 1, 12, 2, 11,
+    1, 1, 3, 0, 4, 0, 3, 1, 2, 0, 3, 1,
+    4, 0, 16, 0, 5, 0, 5, 1, 6, 0, 4, 0,
+    1, 1, 2, 2, 1, 3, 2, 4, 3, 1, 3, 0,
+    3, 0, 1, 1, 2, 2, 7, 3, 1, 1, 2, 0,
+    3, 0, 3, 1, 2, 5, 1, 1, 1, 5, 3, 1,
+    3, 0, 2, 0, 1, 1, 2, 6, 2, 1, 1, 5,
+    1, 1, 4, 6, 1, 1, 2, 0, 2, 0, 1, 1,
+    2, 5, 2, 1, 2, 6, 1, 1, 3, 5, 1, 1,
+    2, 0, 3, 0, 2, 1, 2, 5, 1, 6, 5, 1,
+    3, 0, 3, 0, 3, 1, 5, 5, 1, 1, 4, 0,
+    1, 0, 2, 1, 1, 7, 2, 8, 1, 2, 1, 3,
+    1, 9, 1, 7, 3, 1, 3, 0, 1, 1, 2, 10,
+    1, 9, 2, 7, 1, 9, 1, 2, 1, 3, 1, 9,
+    1, 7, 1, 1, 1, 7, 1, 1, 2, 0, 1, 1,
+    3, 10, 2, 9, 1, 1, 4, 3, 1, 1, 1, 9,
+    1, 10, 1, 1, 1, 0, 1, 0, 1, 1, 2, 10,
+    2, 1, 2, 3, 1, 10, 2, 4, 2, 1, 1, 10,
+    1, 1, 1, 0, 2, 0, 2, 1, 3, 2, 3, 3,
+    1, 1, 2, 11, 1, 1, 2, 0, 1, 0, 1, 1,
+    2, 12, 1, 1, 1, 2, 2, 1, 1, 2, 1, 1,
+    2, 13, 1, 12, 1, 1, 2, 0, 1, 0, 1, 1,
+    1, 12, 2, 13, 1, 1, 2, 0, 1, 1, 3, 12,
+    1, 1, 3, 0, 2, 0, 3, 1, 4, 0, 3, 1,
+    4, 0, 5, 0, 5, 1, 2, 0, 3, 1, 1, 0,
+    4, 0, 1, 1, 2, 2, 1, 3, 2, 4, 2, 1,
+    3, 5, 1, 1, 3, 0, 1, 1, 2, 2, 6, 3,
+    1, 1, 2, 5, 1, 1, 3, 0, 3, 1, 2, 6,
+    1, 1, 1, 6, 3, 1, 1, 7, 1, 1, 1, 0,
+    2, 0, 1, 1, 2, 8, 2, 1, 1, 6, 1, 1,
+    4, 8, 1, 7, 1, 1, 1, 0, 2, 0, 1, 1,
+    2, 6, 2, 1, 2, 8, 1, 1, 3, 6, 1, 7,
+    1, 1, 1, 0, 3, 0, 2, 1, 2, 6, 1, 8,
+    6, 1, 2, 0, 4, 0, 2, 1, 6, 6, 1, 7,
+    1, 1, 2, 0, 2, 0, 1, 1, 1, 7, 1, 9,
+    1, 7, 1, 2, 1, 3, 1, 10, 1, 7, 1, 1,
+    1, 7, 1, 1, 3, 0, 1, 0, 3, 1, 1, 10,
+    1, 9, 1, 7, 1, 2, 1, 3, 1, 10, 1, 7,
+    4, 1, 1, 0, 1, 1, 3, 5, 1, 1, 2, 10,
+    1, 1, 1, 5, 2, 4, 1, 5, 1, 1, 1, 11,
+    1, 12, 1, 1, 1, 1, 3, 5, 1, 1, 1, 10,
+    1, 1, 4, 3, 1, 1, 1, 11, 2, 12, 1, 1,
+    1, 0, 5, 1, 1, 3, 4, 2, 1, 1, 1, 13,
+    1, 12, 1, 1, 1, 0, 1, 1, 2, 12, 1, 13,
+    1, 1, 1, 3, 3, 2, 3, 1, 1, 13, 1, 12,
+    1, 1, 1, 0, 1, 1, 1, 12, 1, 13, 1, 1,
+    3, 2, 2, 1, 3, 0, 2, 1, 2, 0, 1, 0,
+    2, 1, 1, 0, 3, 1, 9, 0,
+};
+HOTMEM const uint16_t mario_lines[] = {
+    0, 3, 10, 16, 23, 32, 41, 47, 52, 61, 73, 81,
+    90, 99, 106, 109, 110, 113, 120, 126, 133, 142, 151, 157,
+    162, 174, 187, 198, 207, 215, 224, 229, 230, 233, 240, 246,
+    253, 262, 271, 277, 282, 292, 305, 315, 326, 334, 346, 356,
+    361, 366, 374, 381, 390, 400, 410, 416, 422, 435, 446, 458,
+    468, 477, 488, 497,
+};
 
-PROGMEM const uint32_t mario_data[4][256] = {
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff0000a0, 0xff0000a0, 0xff1800c8,
-     0xff1800c8, 0xff3820f8, 0xff3820f8, 0xff000000, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff0000a0, 0xff0000a0, 0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff1800c8,
-     0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff5860e0, 0xff5860e0, 0xff000000, 0xff5860e0, 0xff000000, 0xff000000,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff000000, 0xff000000, 0xff5860e0,
-     0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff70a8f8, 0xff70a8f8, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff5860e0,
-     0xff5860e0, 0xff000000, 0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff000000,
-     0xff5860e0, 0xff5860e0, 0xff5860e0, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff5860e0,
-     0xff5860e0, 0xff70a8f8, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff5860e0, 0xff5860e0,
-     0xff5860e0, 0xff5860e0, 0xff5860e0, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xffb85840, 0xffb85840, 0xff000000, 0xff1800c8, 0xff883830, 0xffb85840,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff883830, 0xffb85840, 0xffe88870,
-     0xffb85840, 0xff000000, 0xff1800c8, 0xff883830, 0xffb85840, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xff883830, 0xff883830, 0xff883830, 0xffb85840, 0xff000000,
-     0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xfff8f8f8, 0xfff8f8f8, 0xfff8f8f8, 0xff000000, 0xff0000a0, 0xfff8f8f8,
-     0xff3820f8, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xfff8f8f8, 0xfff8f8f8,
-     0xff0050a8, 0xff3080e0, 0xff3080e0, 0xff000000, 0xff0000a0, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff0050a8, 0xff0050a8, 0xff0050a8,
-     0xff3080e0, 0xff30c8f0, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff0000a0, 0xff0000a0, 0xff1800c8,
-     0xff1800c8, 0xff3820f8, 0xff3820f8, 0xff000000, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff0000a0, 0xff0000a0, 0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff1800c8,
-     0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff5860e0, 0xff5860e0, 0xff000000, 0xff5860e0, 0xff000000, 0xff000000,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff000000, 0xff000000, 0xff5860e0,
-     0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff70a8f8, 0xff70a8f8, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff5860e0,
-     0xff5860e0, 0xff000000, 0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff000000,
-     0xff5860e0, 0xff5860e0, 0xff5860e0, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff5860e0,
-     0xff5860e0, 0xff70a8f8, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff5860e0, 0xff5860e0,
-     0xff5860e0, 0xff5860e0, 0xff5860e0, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xffe88870, 0xffb85840, 0xff000000, 0xff1800c8, 0xff883830, 0xffb85840,
-     0xff000000, 0xff883830, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff883830, 0xffe88870,
-     0xffb85840, 0xff000000, 0xff1800c8, 0xff883830, 0xffb85840, 0xff000000,
-     0xff883830, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xfff8f8f8, 0xfff8f8f8, 0xff883830, 0xff883830, 0xff000000,
-     0xff0000a0, 0xff1800c8, 0xff1800c8, 0xff000000, 0xfff8f8f8, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xfff8f8f8,
-     0xfff8f8f8, 0xff000000, 0xff000000, 0xff0000a0, 0xff0000a0, 0xfff8f8f8,
-     0xff1800c8, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff0000a0,
-     0xff0000a0, 0xff0000a0, 0xff000000, 0xff0000a0, 0xff0000a0, 0xff3080e0,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff000000, 0xff0050a8, 0xff0050a8, 0xff3080e0, 0xff000000,
-     0xff000000, 0xff0050a8, 0xff3080e0, 0xff3080e0, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff0000a0, 0xff0000a0, 0xff1800c8,
-     0xff3820f8, 0xff3820f8, 0xff000000, 0xff000000, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff0000a0, 0xff0000a0, 0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff1800c8,
-     0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff5860e0, 0xff5860e0, 0xff000000, 0xff5860e0, 0xff000000, 0xff000000,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff000000, 0xff000000, 0xff5860e0,
-     0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff70a8f8, 0xff70a8f8, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff5860e0,
-     0xff5860e0, 0xff000000, 0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff000000,
-     0xff5860e0, 0xff5860e0, 0xff5860e0, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff5860e0,
-     0xff5860e0, 0xff70a8f8, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff000000, 0xff000000, 0xff000000, 0xff5860e0, 0xff5860e0,
-     0xff5860e0, 0xff5860e0, 0xff5860e0, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xffb85840,
-     0xffe88870, 0xffe88870, 0xff0000a0, 0xff1800c8, 0xff883830, 0xffb85840,
-     0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xfff8f8f8, 0xfff8f8f8, 0xff883830, 0xffb85840, 0xffb85840,
-     0xff883830, 0xff0000a0, 0xff1800c8, 0xff883830, 0xffb85840, 0xff000000,
-     0xffb85840, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xfff8f8f8,
-     0xfff8f8f8, 0xfff8f8f8, 0xff883830, 0xff883830, 0xff000000, 0xff1800c8,
-     0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff000000, 0xff883830, 0xfff8f8f8,
-     0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xfff8f8f8, 0xfff8f8f8,
-     0xff000000, 0xff000000, 0xff1800c8, 0xff1800c8, 0xfff8f8f8, 0xff3820f8,
-     0xff3820f8, 0xff000000, 0xff000000, 0xfff8f8f8, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff0000a0, 0xff0000a0,
-     0xff0000a0, 0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff000000, 0xff30c8f0,
-     0xff30c8f0, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff0050a8, 0xff0050a8, 0xff000000, 0xff0000a0, 0xff000000, 0xff000000,
-     0xff0000a0, 0xff000000, 0xff3080e0, 0xff3080e0, 0xff0050a8, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff0050a8, 0xff3080e0,
-     0xff3080e0, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xff0050a8,
-     0xff0050a8, 0xff0050a8, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000},
-    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000,
-     0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff0000a0, 0xff0000a0, 0xff1800c8,
-     0xff3820f8, 0xff3820f8, 0xff000000, 0xff000000, 0xfff8f8f8, 0xfff8f8f8,
-     0xfff8f8f8, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
-     0xff0000a0, 0xff0000a0, 0xff1800c8, 0xff1800c8, 0xff1800c8, 0xff1800c8,
-     0xff1800c8, 0xff1800c8, 0xff000000, 0xfff8f8f8, 0xfff8f8f8, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff5860e0, 0xff5860e0, 0xff000000, 0xff5860e0, 0xff000000, 0xff000000,
-     0xff000000, 0xffb85840, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
-     0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff000000, 0xff000000, 0xff5860e0,
-     0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff70a8f8, 0xff70a8f8, 0xffb85840,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff5860e0,
-     0xff5860e0, 0xff000000, 0xff000000, 0xff70a8f8, 0xff70a8f8, 0xff000000,
-     0xff5860e0, 0xff5860e0, 0xff5860e0, 0xffb85840, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff5860e0,
-     0xff5860e0, 0xff70a8f8, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff5860e0, 0xff5860e0,
-     0xff5860e0, 0xff5860e0, 0xff5860e0, 0xff5860e0, 0xffb85840, 0xff000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffb85840,
-     0xffe88870, 0xffb85840, 0xff0000a0, 0xff1800c8, 0xff883830, 0xffb85840,
-     0xff000000, 0xffb85840, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff000000, 0xff000000, 0xff000000, 0xff883830, 0xffe88870,
-     0xffb85840, 0xff0000a0, 0xff1800c8, 0xff883830, 0xffb85840, 0xff000000,
-     0xff000000, 0xff000000, 0xff000000, 0x00000000, 0xff000000, 0xfff8f8f8,
-     0xfff8f8f8, 0xfff8f8f8, 0xff000000, 0xff883830, 0xff883830, 0xff000000,
-     0xfff8f8f8, 0xff3820f8, 0xff3820f8, 0xfff8f8f8, 0xff000000, 0xff30c8f0,
-     0xff0050a8, 0xff000000, 0xff000000, 0xfff8f8f8, 0xfff8f8f8, 0xfff8f8f8,
-     0xff000000, 0xff883830, 0xff000000, 0xff1800c8, 0xff1800c8, 0xff1800c8,
-     0xff1800c8, 0xff000000, 0xff30c8f0, 0xff0050a8, 0xff0050a8, 0xff000000,
-     0x00000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-     0xff1800c8, 0xff0000a0, 0xff0000a0, 0xff0000a0, 0xff0000a0, 0xff000000,
-     0xff3080e0, 0xff0050a8, 0xff000000, 0x00000000, 0xff000000, 0xff0050a8,
-     0xff0050a8, 0xff3080e0, 0xff000000, 0xff1800c8, 0xff0000a0, 0xff0000a0,
-     0xff0000a0, 0xff000000, 0xff000000, 0xff000000, 0xff3080e0, 0xff0050a8,
-     0xff000000, 0x00000000, 0xff000000, 0xff0050a8, 0xff3080e0, 0xff000000,
-     0xff0000a0, 0xff0000a0, 0xff0000a0, 0xff000000, 0xff000000, 0x00000000,
-     0x00000000, 0x00000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000,
-     0x00000000, 0xff000000, 0xff000000, 0x00000000, 0xff000000, 0xff000000,
-     0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-     0x00000000, 0x00000000, 0x00000000, 0x00000000}};
+const sprite_t mario_sprite = {16, 16, 4, mario_palette, mario_palettes,
+                            mario_runs, mario_lines};
+#endif
@@ -49,6 +49,7 @@
 #define LV_MEM_CUSTOM 0
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
+    /*A TLSF heap in RAM2, see LV_ATTRIBUTE_LARGE_RAM_ARRAY, its use goes out with the telemetry*/
     #define LV_MEM_SIZE (48U * 1024U)          /*[bytes]*/
 
     /*Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too.*/
@@ -319,17 +320,19 @@
 #define LV_ATTRIBUTE_FLUSH_READY
 
 /*Required alignment size for buffers*/
-#define LV_ATTRIBUTE_MEM_ALIGN_SIZE 1
+#define LV_ATTRIBUTE_MEM_ALIGN_SIZE 4
 
 /*Will be added where memories needs to be aligned (with -Os data might not be aligned to boundary by default).
  * E.g. __attribute__((aligned(4)))*/
-#define LV_ATTRIBUTE_MEM_ALIGN __attribute__((section(".progmem")))
+/*The images stay in flash, word aligned for whole word copies and DMA*/
+#define LV_ATTRIBUTE_MEM_ALIGN __attribute__((section(".progmem"), aligned(4)))
 
 /*Attribute to mark large constant arrays for example font's bitmaps*/
 #define LV_ATTRIBUTE_LARGE_CONST
 
 /*Compiler prefix for a big array declaration in RAM*/
-#define LV_ATTRIBUTE_LARGE_RAM_ARRAY
+/*The LVGL heap (LV_MEM_SIZE) goes to RAM2 like DMAMEM, RAM1 is kept for the cube buffers*/
+#define LV_ATTRIBUTE_LARGE_RAM_ARRAY __attribute__((section(".dmabuffers"), used))
 
 /*Place performance critical functions into a faster memory (e.g RAM)*/
 #define LV_ATTRIBUTE_FAST_MEM
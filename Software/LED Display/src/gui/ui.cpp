@@ -4,20 +4,26 @@
 
 #include "core/Config.h"
 #include "core/Display.h"
+#include "core/Preview.h"
+#include "core/Schema.h"
+#include "core/Telemetry.h"
 #include "space/Animation.h"
 #include "ui_helpers.h"
 
 ///////////////////// PROTOTYPES ///////////////////
 lv_obj_t* ui_create_screen();
-lv_obj_t* ui_create_label(lv_obj_t* screen, uint16_t x, uint16_t y,
+lv_obj_t* ui_create_label(lv_obj_t* screen, int16_t x, uint16_t y,
                           const char* text);
 lv_obj_t* ui_create_slider(lv_obj_t* screen, uint16_t x, uint16_t y);
+void ui_bind_slider(lv_obj_t* slider, const char* path);
 void ui_create_listed_icon(lv_obj_t* screen, uint32_t id, uint16_t x,
                            uint16_t y, lv_event_cb_t event);
 void ui_create_icon(lv_obj_t* screen, uint32_t id, uint16_t x, uint16_t y,
                     lv_event_cb_t event, const lv_img_dsc_t* image,
                     const char* text);
 void ui_event(lv_event_t* e);
+void ui_field_event(lv_event_t* e);
+void ui_create_preview(lv_obj_t* screen);
 ///////////////////// VARIABLES ////////////////////
 lv_obj_t* ui_animation_screens[9];
 lv_obj_t* ui_configuration_screens[14];
@@ -26,16 +32,67 @@ lv_obj_t* ui_label_brightness;
 lv_obj_t* ui_slider_brightness;
 lv_obj_t* ui_label_motionblur;
 lv_obj_t* ui_slider_motionblur;
+lv_obj_t* ui_slider_motor;
+lv_obj_t* ui_preview_screen;
+lv_obj_t* ui_preview_images[Preview::VIEWS];
+lv_img_dsc_t ui_preview_dsc[Preview::VIEWS];
+lv_obj_t* ui_diagnostics_screen;
+lv_obj_t* ui_label_diagnostics;
+// Float fields are mapped onto this many slider steps
+const int32_t SLIDER_STEPS = 1000;
 
+// Labels are only set on a change, setting one redraws it and keeps the
+// LCD from going idle
 void ui_refresh(lv_timer_t* timer) {
-  lv_label_set_text_fmt(ui_label_brightness, "Brightness : %d",
-                        Display::getBrightness());
+  static int brightness = -1, motionblur = -1;
+  if (brightness != Display::getBrightness()) {
+    brightness = Display::getBrightness();
+    lv_label_set_text_fmt(ui_label_brightness, "Brightness : %d", brightness);
+  }
   lv_slider_set_value(ui_slider_brightness, Display::getBrightness(),
                       LV_ANIM_OFF);
-  lv_label_set_text_fmt(ui_label_motionblur, "Motionblur : %d",
-                        Display::getMotionBlur());
+  if (motionblur != Display::getMotionBlur()) {
+    motionblur = Display::getMotionBlur();
+    lv_label_set_text_fmt(ui_label_motionblur, "Motionblur : %d", motionblur);
+  }
   lv_slider_set_value(ui_slider_motionblur, Display::getMotionBlur(),
                       LV_ANIM_OFF);
+  ui_bind_slider(ui_slider_motor, "power.motor_speed");
+}
+
+// Show the last telemetry snapshot, a new one is taken every print interval
+void ui_diagnostics_refresh(lv_timer_t* timer) {
+  if (lv_scr_act() != ui_diagnostics_screen) return;
+  static char text[768];
+  Telemetry::report(text, sizeof(text));
+  lv_label_set_text_static(ui_label_diagnostics, text);
+}
+
+// Invalidate the changed cells of every view, the flush only sends the pixels
+// that differ from what is on the screen
+void ui_preview_refresh(lv_timer_t* timer) {
+  if (lv_scr_act() != ui_preview_screen) return;
+  uint16_t changed[Preview::VIEWS][Preview::CELLS];
+  if (!Preview::update(changed)) return;
+  for (uint8_t view = 0; view < Preview::VIEWS; view++) {
+    uint16_t columns = 0;
+    int8_t top = -1, bottom = -1;
+    for (uint8_t v = 0; v < Preview::CELLS; v++) {
+      if (!changed[view][v]) continue;
+      if (top < 0) top = v;
+      bottom = v;
+      columns |= changed[view][v];
+    }
+    if (top < 0) continue;
+    lv_area_t area;
+    lv_obj_get_coords(ui_preview_images[view], &area);
+    const lv_coord_t x = area.x1, y = area.y1;
+    area.x1 = x + __builtin_ctz(columns) * Preview::SCALE;
+    area.x2 = x + (16 - __builtin_clz(columns << 16)) * Preview::SCALE - 1;
+    area.y1 = y + top * Preview::SCALE;
+    area.y2 = y + (bottom + 1) * Preview::SCALE - 1;
+    lv_obj_invalidate_area(ui_preview_images[view], &area);
+  }
 }
 
 void ui_init(void) {
@@ -157,8 +214,26 @@ void ui_init(void) {
   ui_slider_motionblur = ui_create_slider(screen, 0, 130 + 25);
   lv_obj_add_event_cb(ui_slider_motionblur, ui_event, LV_EVENT_ALL, (void*)401);
 
+  ui_create_label(screen, 0, 190, "Motor speed");
+  ui_slider_motor = ui_create_slider(screen, 0, 190 + 20);
+  ui_bind_slider(ui_slider_motor, "power.motor_speed");
+  lv_obj_add_event_cb(ui_slider_motor, ui_field_event, LV_EVENT_VALUE_CHANGED,
+                      NULL);
+
+  screen = ui_create_screen();
+  ui_preview_screen = screen;
+  lv_obj_add_event_cb(screen, ui_event, LV_EVENT_ALL, (void*)500);
+  ui_create_preview(screen);
+
+  screen = ui_create_screen();
+  ui_diagnostics_screen = screen;
+  lv_obj_add_event_cb(screen, ui_event, LV_EVENT_ALL, (void*)300);
+  ui_label_diagnostics = ui_create_label(screen, 0, 10, "Diagnostics");
+
   lv_disp_load_scr(ui_animation_screens[0]);
   lv_timer_create(ui_refresh, 500, NULL);
+  lv_timer_create(ui_preview_refresh, 40, NULL);
+  lv_timer_create(ui_diagnostics_refresh, 1000, NULL);
 }
 
 void ui_create_listed_icon(lv_obj_t* screen, uint32_t id, uint16_t x,
@@ -186,7 +261,7 @@ void ui_create_listed_icon(lv_obj_t* screen, uint32_t id, uint16_t x,
       &ui_img_generic_80_png,       &ui_img_generic_80_png,
       &ui_img_generic_80_png,       &ui_img_generic_80_png,
       &ui_img_generic_80_png,       &ui_img_generic_80_png,
-      &ui_img_generic_80_png};
+      &ui_img_generic_80_png,       &ui_img_generic_80_png};
   const lv_img_dsc_t* image = images[id];
   const char* text = Animation::get_item(id).name;
   ui_create_icon(screen, id, x, y, event, image, text);
@@ -217,6 +292,11 @@ void ui_event(lv_event_t* e) {
   }
   if (event == LV_EVENT_LONG_PRESSED) {
     switch (type) {
+      case 1:  // Preview of the cube
+        lv_indev_wait_release(lv_indev_get_act());
+        _ui_screen_change(ui_preview_screen, LV_SCR_LOAD_ANIM_FADE_ON, 1000,
+                          0);
+        break;
       case 0:  // Animation configuration screen (one for each animation)
         lv_indev_wait_release(lv_indev_get_act());
         _ui_screen_change(ui_configuration_screens[index - index],
@@ -232,6 +312,11 @@ void ui_event(lv_event_t* e) {
         _ui_screen_change(ui_animation_screens[0], LV_SCR_LOAD_ANIM_FADE_ON,
                           1000, 0);
         break;
+      case 5:  // Diagnostics screen, from the preview
+        lv_indev_wait_release(lv_indev_get_act());
+        _ui_screen_change(ui_diagnostics_screen, LV_SCR_LOAD_ANIM_FADE_ON,
+                          1000, 0);
+        break;
     }
   }
   if (event == LV_EVENT_VALUE_CHANGED) {
@@ -245,6 +330,56 @@ void ui_event(lv_event_t* e) {
   }
 }
 
+// Dragging a bound slider writes its config field through the schema
+void ui_field_event(lv_event_t* e) {
+  lv_obj_t* target = lv_event_get_target(e);
+  const field_t* f = (const field_t*)lv_obj_get_user_data(target);
+  if (f == nullptr) return;
+  int32_t value = lv_slider_get_value(target);
+  if (f->type == value_t::FLOAT)
+    Schema::set(*f, f->min + (f->max - f->min) * value / SLIDER_STEPS);
+  else
+    Schema::set(*f, value);
+}
+
+// Take the range and value of a slider from a config field, a field the
+// schema does not know leaves the slider as it is
+void ui_bind_slider(lv_obj_t* slider, const char* path) {
+  const field_t* f = Schema::find(path);
+  if (f == nullptr || f->type == value_t::STRING) return;
+  lv_obj_set_user_data(slider, (void*)f);
+  if (f->type == value_t::FLOAT) {
+    lv_slider_set_range(slider, 0, SLIDER_STEPS);
+    lv_slider_set_value(
+        slider, (Schema::get(*f) - f->min) / (f->max - f->min) * SLIDER_STEPS,
+        LV_ANIM_OFF);
+  } else {
+    lv_slider_set_range(slider, f->min, f->max);
+    lv_slider_set_value(slider, Schema::get(*f), LV_ANIM_OFF);
+  }
+}
+
+// Top, front and side view of the cube, images drawn straight from the
+// projections of core/Preview.h
+void ui_create_preview(lv_obj_t* screen) {
+  const char* names[Preview::VIEWS] = {"Top", "Front", "Side"};
+  for (uint8_t view = 0; view < Preview::VIEWS; view++) {
+    lv_img_dsc_t& dsc = ui_preview_dsc[view];
+    dsc.header.always_zero = 0;
+    dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    dsc.header.w = Preview::SIZE;
+    dsc.header.h = Preview::SIZE;
+    dsc.data_size = sizeof(Preview::image[view]);
+    dsc.data = (const uint8_t*)Preview::image[view];
+    const lv_coord_t x = 24 + view * (Preview::SIZE + 40);
+    ui_create_label(screen, x + Preview::SIZE / 2 - 160, 50, names[view]);
+    lv_obj_t* image = lv_img_create(screen);
+    lv_img_set_src(image, &dsc);
+    lv_obj_set_pos(image, x, 80);
+    ui_preview_images[view] = image;
+  }
+}
+
 lv_obj_t* ui_create_screen() {
   lv_obj_t* screen = lv_obj_create(NULL);
   lv_obj_set_style_bg_color(screen, lv_color_hex(0x000000),
@@ -302,7 +437,7 @@ void ui_create_icon(lv_obj_t* screen, uint32_t id, uint16_t x, uint16_t y,
                               LV_PART_MAIN | LV_STATE_DEFAULT);
 }
 
-lv_obj_t* ui_create_label(lv_obj_t* screen, uint16_t x, uint16_t y,
+lv_obj_t* ui_create_label(lv_obj_t* screen, int16_t x, uint16_t y,
                           const char* text) {
   lv_obj_t* label = lv_label_create(screen);
   lv_obj_set_width(label, LV_SIZE_CONTENT);
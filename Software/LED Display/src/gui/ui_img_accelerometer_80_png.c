@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Accelerometer_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_accelerometer_80_png_data[] = {
-    0x57, 0x10, 0xFF, 0x36, 0x08, 0xFF, 0x56, 0x10, 0xFF, 0x55, 0x08, 0xFF, 0x34, 0x00, 0xFF, 0xDB, 0x20, 0xFF, 0x33, 0x00, 0xFF, 0x32, 0x00, 0xFF, 0x11, 0x00, 0xFF, 0x31, 0x00, 0xFF, 0xBA, 0x20, 0xFF, 0x51, 0x00, 0xFF, 0x91, 0x10, 0xFF, 0x31, 0x00, 0xFF, 0x52, 0x08, 0xFF, 0xBA, 0x28, 0xFF, 0x2C, 0x00, 0xFF, 0x0C, 0x00, 0xFF, 0x4C, 0x08, 0xFF, 0x2C, 0x08, 0xFF, 0xD6, 0x30, 0xFF, 0x2B, 0x08, 0xFF, 0x2A, 0x10, 0xFF, 0x0F, 0x31, 0xFF, 0x0A, 0x08, 0xFF, 0x0B, 0x10, 0xFF, 0x29, 0x10, 0xFF, 0x29, 0x10, 0xFF, 0x29, 0x10, 0xFF, 0xD5, 0x38, 0xFF, 0x2B, 0x18, 0xFF, 0x6A, 0x18, 0xFF, 0x8A, 0x20, 0xFF, 0x49, 0x18, 0xFF, 0xB3, 0x48, 0xFF, 0x29, 0x18, 0xFF, 0xD0, 0x30, 0xFF, 0x08, 0x10, 0xFF, 0x2A, 0x18, 0xFF, 0x56, 0x69, 0xFF, 0x2A, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x2A, 0x20, 0xFF, 0x2A, 0x20, 0xFF, 0xBA, 0x70, 0xFF, 0x6B, 0x28, 0xFF, 0x2A, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x9D, 0x60, 0xFF, 0x2F, 0x30, 0xFF, 0x13, 0x48, 0xFF, 0x13, 0x40, 0xFF, 0x76, 0x58, 0xFF, 0x3A, 0x60, 0xFF, 0x13, 0x38, 0xFF, 0x1E, 0xA0, 0xFF, 0x3F, 0x88, 0xFF, 0x19, 0x50, 0xFF, 0xDF, 0x78, 0xFF, 0x1D, 0x48, 0xFF, 0x1B, 0x28, 0xFF, 0xFF, 0xB0, 0xFF, 0xBF, 0x50, 0xFF,
-    0x1E, 0x48, 0xFF, 0x1F, 0x40, 0xFF, 0x36, 0x28, 0xFF, 0x53, 0x28, 0xFF, 0x14, 0x28, 0xFF, 0x16, 0x20, 0xFF, 0x13, 0x18, 0xFF, 0x30, 0x20, 0xFF, 0x32, 0x28, 0xFF, 0x74, 0x38, 0xFF, 0x12, 0x20, 0xFF, 0x0E, 0x18, 0xFF, 0x10, 0x20, 0xFF, 0x0C, 0x10, 0xFF, 0x0D, 0x18, 0xFF, 0x2D, 0x20, 0xFF, 0x59, 0x10, 0xFF, 0x58, 0x10, 0xFF, 0x37, 0x08, 0xFF, 0x36, 0x08, 0xFF, 0x56, 0x08, 0xFF, 0x34, 0x00, 0xFF, 0x34, 0x00, 0xFF, 0x34, 0x00, 0xFF, 0x32, 0x00, 0xFF, 0x31, 0x00, 0xFF, 0x31, 0x00, 0xFF, 0x10, 0x00, 0xFF, 0x30, 0x00, 0xFF, 0x0E, 0x00, 0xFF, 0x0F, 0x08, 0xFF, 0x0E, 0x00, 0xFF, 0x2E, 0x08, 0xFF, 0x0C, 0x00, 0xFF, 0x2C, 0x08, 0xFF, 0x2B, 0x08, 0xFF, 0x0B, 0x08, 0xFF, 0x4B, 0x10, 0xFF, 0x2A, 0x08, 0xFF, 0x0A, 0x08, 0xFF, 0x2A, 0x08, 0xFF, 0x2A, 0x10, 0xFF, 0x09, 0x08, 0xFF, 0x29, 0x10, 0xFF, 0x29, 0x10, 0xFF, 0x29, 0x10, 0xFF, 0x6B, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x29, 0x10, 0xFF, 0x6A, 0x20, 0xFF, 0x29, 0x18, 0xFF, 0x49, 0x18, 0xFF, 0x4A, 0x20, 0xFF, 0x29, 0x18, 0xFF, 0x4A, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x4A, 0x20, 0xFF, 0x28, 0x10, 0xFF, 0x09, 0x18, 0xFF, 0x2A, 0x18, 0xFF, 0x4B, 0x20, 0xFF, 0x09, 0x18, 0xFF, 0x0A, 0x18, 0xFF,
-    0x0A, 0x18, 0xFF, 0x2B, 0x18, 0xFF, 0x2B, 0x20, 0xFF, 0x2B, 0x18, 0xFF, 0x2C, 0x20, 0xFF, 0x2F, 0x30, 0xFF, 0x0F, 0x28, 0xFF, 0x36, 0x48, 0xFF, 0x38, 0x58, 0xFF, 0x39, 0x48, 0xFF, 0x55, 0x40, 0xFF, 0xDF, 0xD0, 0xFF, 0x1D, 0x38, 0xFF, 0x1C, 0x30, 0xFF, 0x5F, 0xD2, 0xFF, 0x1F, 0x38, 0xFF, 0x1E, 0x30, 0xFF, 0x16, 0x28, 0xFF, 0x59, 0x28, 0xFF, 0x33, 0x28, 0xFF, 0x11, 0x18, 0xFF, 0x37, 0x20, 0xFF, 0x34, 0x20, 0xFF, 0x32, 0x20, 0xFF, 0xB7, 0x60, 0xFF, 0x37, 0x20, 0xFF, 0x34, 0x28, 0xFF, 0x32, 0x20, 0xFF, 0x11, 0x20, 0xFF, 0x31, 0x28, 0xFF, 0x2E, 0x18, 0xFF, 0x2D, 0x18, 0xFF, 0x59, 0x10, 0xFF, 0x59, 0x10, 0xFF, 0x18, 0x08, 0xFF, 0x78, 0x10, 0xFF, 0x58, 0x08, 0xFF, 0x56, 0x00, 0xFF, 0x35, 0x00, 0xFF, 0x7A, 0x18, 0xFF, 0x13, 0x00, 0xFF, 0x53, 0x00, 0xFF, 0x32, 0x00, 0xFF, 0x11, 0x00, 0xFF, 0x96, 0x18, 0xFF, 0x53, 0x10, 0xFF, 0x2F, 0x08, 0xFF, 0x2E, 0x08, 0xFF, 0xB6, 0x28, 0xFF, 0x2E, 0x08, 0xFF, 0x1F, 0x41, 0xFF, 0x2C, 0x08, 0xFF, 0x2D, 0x10, 0xFF, 0x70, 0x20, 0xFF, 0x2B, 0x10, 0xFF, 0x2C, 0x18, 0xFF, 0x0A, 0x10, 0xFF, 0xB1, 0x30, 0xFF, 0x4B, 0x18, 0xFF, 0x29, 0x10, 0xFF, 0x4B, 0x18, 0xFF, 0x2A, 0x10, 0xFF, 0x0D, 0x20, 0xFF, 0x29, 0x10, 0xFF,
-    0x29, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x0B, 0x18, 0xFF, 0x4A, 0x20, 0xFF, 0x29, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x4B, 0x20, 0xFF, 0xD7, 0x68, 0xFF, 0x2A, 0x20, 0xFF, 0x29, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x2A, 0x20, 0xFF, 0xD5, 0x60, 0xFF, 0x4A, 0x20, 0xFF, 0x09, 0x18, 0xFF, 0x71, 0x49, 0xFF, 0x52, 0x40, 0xFF, 0xF5, 0x68, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0xF3, 0x58, 0xFF, 0x5E, 0xA1, 0xFF, 0x2E, 0x28, 0xFF, 0x53, 0x40, 0xFF, 0x15, 0x40, 0xFF, 0x15, 0x28, 0xFF, 0x9E, 0x78, 0xFF, 0x3F, 0xFB, 0xFF, 0x3A, 0x60, 0xFF, 0x3E, 0x58, 0xFF, 0x3C, 0x80, 0xFF, 0x9F, 0x80, 0xFF, 0x3E, 0x30, 0xFF, 0x75, 0x50, 0xFF, 0x16, 0x18, 0xFF, 0x54, 0x30, 0xFF, 0x10, 0x18, 0xFF, 0x15, 0x18, 0xFF, 0x34, 0x48, 0xFF, 0x14, 0x20, 0xFF, 0x16, 0x20, 0xFF, 0x17, 0x20, 0xFF, 0x3D, 0x28, 0xFF, 0xB3, 0x40, 0xFF, 0x14, 0x30, 0xFF, 0x0E, 0x18, 0xFF, 0x0E, 0x18, 0xFF, 0x0C, 0x10, 0xFF, 0x5B, 0x08, 0xFF, 0x5A, 0x10, 0xFF, 0x5A, 0x10, 0xFF, 0xFF, 0x18, 0xFF, 0x38, 0x00, 0xFF, 0x38, 0x00, 0xFF, 0x57, 0x00, 0xFF, 0x16, 0x00, 0xFF, 0xBF, 0x08, 0xFF, 0x54, 0x00, 0xFF, 0x12, 0x00, 0xFF, 0x32, 0x00, 0xFF, 0x32, 0x08, 0xFF, 0xDB, 0x30, 0xFF, 0x10, 0x00, 0xFF, 0x2F, 0x08, 0xFF,
-    0x2E, 0x08, 0xFF, 0x4E, 0x08, 0xFF, 0xFC, 0x30, 0xFF, 0x37, 0x4A, 0xFF, 0x4C, 0x10, 0xFF, 0x2B, 0x08, 0xFF, 0x2B, 0x10, 0xFF, 0xB3, 0x49, 0xFF, 0x90, 0x28, 0xFF, 0x2B, 0x10, 0xFF, 0x2C, 0x18, 0xFF, 0x29, 0x10, 0xFF, 0x0A, 0x10, 0xFF, 0x37, 0x51, 0xFF, 0x4C, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0x29, 0x10, 0xFF, 0x8B, 0x20, 0xFF, 0xF7, 0x79, 0xFF, 0x0A, 0x10, 0xFF, 0x09, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x2A, 0x20, 0xFF, 0x11, 0x50, 0xFF, 0x0A, 0x18, 0xFF, 0x0A, 0x18, 0xFF, 0x09, 0x10, 0xFF, 0x4A, 0x28, 0xFF, 0xF5, 0x80, 0xFF, 0x2B, 0x28, 0xFF, 0x0A, 0x18, 0xFF, 0x2A, 0x18, 0xFF, 0xF5, 0x60, 0xFF, 0x97, 0x70, 0xFF, 0x0C, 0x20, 0xFF, 0x2C, 0x20, 0xFF, 0x2D, 0x20, 0xFF, 0x4F, 0x28, 0xFF, 0x31, 0x30, 0xFF, 0x11, 0x30, 0xFF, 0x15, 0x38, 0xFF, 0x79, 0x60, 0xFF, 0x7F, 0xB8, 0xFF, 0x7F, 0xFA, 0xFF, 0x1E, 0x60, 0xFF, 0x5C, 0x48, 0xFF, 0x1F, 0xEB, 0xFF, 0x5F, 0xA1, 0xFF, 0x1F, 0x38, 0xFF, 0x1F, 0x68, 0xFF, 0x11, 0x28, 0xFF, 0x14, 0x20, 0xFF, 0x1F, 0x28, 0xFF, 0x38, 0x20, 0xFF, 0x77, 0x50, 0xFF, 0x15, 0x28, 0xFF, 0x15, 0x18, 0xFF, 0x13, 0x18, 0xFF, 0x30, 0x20, 0xFF, 0x94, 0x40, 0xFF, 0x34, 0x30, 0xFF, 0x30, 0x20, 0xFF, 0x2E, 0x18, 0xFF, 0x2D, 0x18, 0xFF,
-    0x7C, 0x10, 0xFF, 0x5B, 0x10, 0xFF, 0x5B, 0x08, 0xFF, 0x3A, 0x08, 0xFF, 0x5B, 0x08, 0xFF, 0x59, 0x08, 0xFF, 0x38, 0x00, 0xFF, 0x37, 0x00, 0xFF, 0x57, 0x08, 0xFF, 0x36, 0x08, 0xFF, 0x13, 0x00, 0xFF, 0x33, 0x00, 0xFF, 0x12, 0x00, 0xFF, 0xF8, 0x30, 0xFF, 0x31, 0x08, 0xFF, 0x30, 0x08, 0xFF, 0x0E, 0x00, 0xFF, 0x51, 0x10, 0xFF, 0x0E, 0x08, 0xFF, 0x2D, 0x08, 0xFF, 0x2C, 0x08, 0xFF, 0x10, 0x31, 0xFF, 0x6F, 0x20, 0xFF, 0x0B, 0x10, 0xFF, 0x0C, 0x10, 0xFF, 0x4D, 0x18, 0xFF, 0xF5, 0x50, 0xFF, 0x09, 0x08, 0xFF, 0x2A, 0x10, 0xFF, 0x77, 0x61, 0xFF, 0x4C, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x2A, 0x18, 0xFF, 0x76, 0x69, 0xFF, 0x4D, 0x28, 0xFF, 0x2A, 0x18, 0xFF, 0x49, 0x18, 0xFF, 0x2A, 0x20, 0xFF, 0xD6, 0x68, 0xFF, 0x09, 0x18, 0xFF, 0x2A, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x2B, 0x20, 0xFF, 0x73, 0x50, 0xFF, 0x4B, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0xD1, 0x38, 0xFF, 0x39, 0x89, 0xFF, 0xB7, 0x68, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0D, 0x20, 0xFF, 0x0F, 0x20, 0xFF, 0xB6, 0x70, 0xFF, 0x32, 0x30, 0xFF, 0x15, 0x41, 0xFF, 0x13, 0x28, 0xFF, 0x7F, 0xC0, 0xFF, 0x1B, 0x78, 0xFF, 0x1F, 0x50, 0xFF, 0x3E, 0x50, 0xFF, 0x7F, 0x88, 0xFF, 0x1F, 0x60, 0xFF,
-    0x79, 0x60, 0xFF, 0x1F, 0xA1, 0xFF, 0x3A, 0x30, 0xFF, 0x19, 0x20, 0xFF, 0x7F, 0x38, 0xFF, 0x76, 0x58, 0xFF, 0x16, 0x20, 0xFF, 0x13, 0x18, 0xFF, 0x13, 0x18, 0xFF, 0x33, 0x28, 0xFF, 0x74, 0x40, 0xFF, 0x33, 0x28, 0xFF, 0x33, 0x28, 0xFF, 0x2F, 0x20, 0xFF, 0x0E, 0x20, 0xFF, 0x0F, 0x28, 0xFF, 0x3D, 0x08, 0xFF, 0x5D, 0x08, 0xFF, 0x5D, 0x08, 0xFF, 0x5C, 0x08, 0xFF, 0x3B, 0x00, 0xFF, 0x9F, 0x08, 0xFF, 0x7E, 0x00, 0xFF, 0x58, 0x08, 0xFF, 0x57, 0x00, 0xFF, 0x37, 0x00, 0xFF, 0xBF, 0x20, 0xFF, 0xB8, 0x10, 0xFF, 0x33, 0x08, 0xFF, 0x31, 0x00, 0xFF, 0x34, 0x10, 0xFF, 0xFC, 0x30, 0xFF, 0xB5, 0x20, 0xFF, 0x4F, 0x08, 0xFF, 0xF5, 0x38, 0xFF, 0x90, 0x18, 0xFF, 0x93, 0x20, 0xFF, 0x2D, 0x10, 0xFF, 0x2C, 0x08, 0xFF, 0x2B, 0x10, 0xFF, 0x6D, 0x18, 0xFF, 0x4D, 0x18, 0xFF, 0x2A, 0x10, 0xFF, 0x2F, 0x28, 0xFF, 0x2A, 0x10, 0xFF, 0x94, 0x38, 0xFF, 0x4B, 0x18, 0xFF, 0xB3, 0x40, 0xFF, 0x29, 0x10, 0xFF, 0x8D, 0x28, 0xFF, 0xF4, 0x58, 0xFF, 0x4E, 0x28, 0xFF, 0x2A, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0xD2, 0x79, 0xFF, 0xBA, 0x91, 0xFF, 0x2A, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x09, 0x18, 0xFF, 0x2B, 0x28, 0xFF, 0xD5, 0x60, 0xFF, 0x0A, 0x18, 0xFF, 0x0A, 0x18, 0xFF, 0x0B, 0x20, 0xFF,
-    0x0F, 0x30, 0xFF, 0xDF, 0xF4, 0xFF, 0x2D, 0x28, 0xFF, 0x8E, 0x30, 0xFF, 0x3B, 0x68, 0xFF, 0x2F, 0x20, 0xFF, 0x52, 0x30, 0xFF, 0x31, 0x28, 0xFF, 0x1B, 0x60, 0xFF, 0x16, 0x30, 0xFF, 0x3F, 0x88, 0xFF, 0x3F, 0xA0, 0xFF, 0x3C, 0x58, 0xFF, 0x3F, 0x50, 0xFF, 0x1F, 0x50, 0xFF, 0x1F, 0x48, 0xFF, 0x3D, 0x28, 0xFF, 0x3F, 0xD3, 0xFF, 0x9E, 0x38, 0xFF, 0x1A, 0x28, 0xFF, 0x1F, 0x38, 0xFF, 0x39, 0x40, 0xFF, 0x14, 0x18, 0xFF, 0x34, 0x20, 0xFF, 0x52, 0x20, 0xFF, 0x78, 0x40, 0xFF, 0x30, 0x18, 0xFF, 0x51, 0x20, 0xFF, 0x2F, 0x18, 0xFF, 0x2E, 0x18, 0xFF, 0x4F, 0x20, 0xFF, 0x2D, 0x18, 0xFF, 0x7F, 0x08, 0xFF, 0x3F, 0x08, 0xFF, 0x5F, 0x08, 0xFF, 0x3D, 0x00, 0xFF, 0x3D, 0x00, 0xFF, 0x3C, 0x00, 0xFF, 0x1A, 0x00, 0xFF, 0x5B, 0x08, 0xFF, 0x38, 0x00, 0xFF, 0x37, 0x00, 0xFF, 0x15, 0x00, 0xFF, 0x1E, 0x31, 0xFF, 0x75, 0x08, 0xFF, 0x32, 0x00, 0xFF, 0x11, 0x00, 0xFF, 0x52, 0x08, 0xFF, 0xF6, 0x30, 0xFF, 0x2F, 0x08, 0xFF, 0x0E, 0x08, 0xFF, 0x2D, 0x08, 0xFF, 0x0E, 0x08, 0xFF, 0x0C, 0x08, 0xFF, 0x0B, 0x08, 0xFF, 0x2C, 0x10, 0xFF, 0x2B, 0x10, 0xFF, 0x14, 0x49, 0xFF, 0x2B, 0x10, 0xFF, 0x6C, 0x20, 0xFF, 0x2A, 0x10, 0xFF, 0x2A, 0x10, 0xFF, 0xB1, 0x38, 0xFF, 0x4B, 0x20, 0xFF,
-    0x2A, 0x18, 0xFF, 0x4B, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0x4C, 0x20, 0xFF, 0x4A, 0x18, 0xFF, 0x49, 0x18, 0xFF, 0x2A, 0x20, 0xFF, 0xD7, 0x70, 0xFF, 0x2A, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0x2A, 0x18, 0xFF, 0x0B, 0x18, 0xFF, 0x73, 0x58, 0xFF, 0x2B, 0x20, 0xFF, 0x4C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x2D, 0x20, 0xFF, 0x4E, 0x28, 0xFF, 0x2E, 0x20, 0xFF, 0x2F, 0x28, 0xFF, 0x2F, 0x38, 0xFF, 0x2F, 0x20, 0xFF, 0x73, 0x30, 0xFF, 0x13, 0x28, 0xFF, 0x13, 0x28, 0xFF, 0x99, 0x60, 0xFF, 0x1F, 0x58, 0xFF, 0x3F, 0x48, 0xFF, 0x3F, 0x40, 0xFF, 0x3F, 0x48, 0xFF, 0xDF, 0x71, 0xFF, 0x3F, 0xFD, 0xFF, 0xBF, 0xE3, 0xFF, 0x16, 0x28, 0xFF, 0x3A, 0x68, 0xFF, 0x3F, 0x58, 0xFF, 0x1C, 0x10, 0xFF, 0x15, 0x18, 0xFF, 0x35, 0x20, 0xFF, 0xB5, 0x48, 0xFF, 0x50, 0x18, 0xFF, 0x30, 0x18, 0xFF, 0x30, 0x18, 0xFF, 0x91, 0x30, 0xFF, 0x74, 0x38, 0xFF, 0x2E, 0x18, 0xFF, 0x0C, 0x10, 0xFF, 0x7F, 0x08, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3D, 0x08, 0xFF, 0x5D, 0x08, 0xFF, 0x3C, 0x00, 0xFF, 0x1A, 0x00, 0xFF, 0x38, 0x00, 0xFF, 0x37, 0x00, 0xFF, 0x77, 0x08, 0xFF, 0x17, 0x00, 0xFF, 0x37, 0x08, 0xFF, 0x32, 0x08, 0xFF, 0x53, 0x08, 0xFF,
-    0x73, 0x18, 0xFF, 0x31, 0x08, 0xFF, 0x7F, 0x41, 0xFF, 0x10, 0x08, 0xFF, 0x90, 0x18, 0xFF, 0x0D, 0x08, 0xFF, 0x2D, 0x10, 0xFF, 0x50, 0x20, 0xFF, 0x4C, 0x18, 0xFF, 0x4C, 0x18, 0xFF, 0x0A, 0x10, 0xFF, 0x2C, 0x18, 0xFF, 0x6D, 0x20, 0xFF, 0x6A, 0x18, 0xFF, 0xAF, 0x30, 0xFF, 0x4C, 0x20, 0xFF, 0x6B, 0x20, 0xFF, 0x6C, 0x28, 0xFF, 0x2A, 0x20, 0xFF, 0x4C, 0x28, 0xFF, 0xED, 0x38, 0xFF, 0x29, 0x18, 0xFF, 0x6B, 0x28, 0xFF, 0x16, 0x69, 0xFF, 0x2B, 0x20, 0xFF, 0x4B, 0x20, 0xFF, 0x4B, 0x20, 0xFF, 0x2D, 0x28, 0xFF, 0xD3, 0x58, 0xFF, 0x0C, 0x20, 0xFF, 0x2D, 0x20, 0xFF, 0x2F, 0x30, 0xFF, 0x0E, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x2F, 0x28, 0xFF, 0x11, 0x30, 0xFF, 0x31, 0x30, 0xFF, 0x10, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x32, 0x30, 0xFF, 0x13, 0x28, 0xFF, 0x12, 0x28, 0xFF, 0x37, 0x30, 0xFF, 0x19, 0x38, 0xFF, 0xD7, 0x68, 0xFF, 0x36, 0x28, 0xFF, 0x1E, 0x28, 0xFF, 0x1F, 0x59, 0xFF, 0x3F, 0xF5, 0xFF, 0x58, 0x50, 0xFF, 0x78, 0x40, 0xFF, 0x14, 0x20, 0xFF, 0x1B, 0x20, 0xFF, 0x3C, 0x20, 0xFF, 0xF9, 0x48, 0xFF, 0x11, 0x20, 0xFF, 0x30, 0x20, 0xFF, 0x30, 0x18, 0xFF, 0x2F, 0x18, 0xFF, 0x75, 0x40, 0xFF, 0x94, 0x58, 0xFF, 0x2E, 0x18, 0xFF, 0x2E, 0x18, 0xFF, 0x4D, 0x18, 0xFF,
-    0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x5F, 0x00, 0xFF, 0x9F, 0x01, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3E, 0x00, 0xFF, 0x3C, 0x00, 0xFF, 0x1F, 0x01, 0xFF, 0x5D, 0x00, 0xFF, 0x37, 0x00, 0xFF, 0x16, 0x00, 0xFF, 0x57, 0x10, 0xFF, 0x3F, 0x29, 0xFF, 0x5C, 0x29, 0xFF, 0x73, 0x08, 0xFF, 0x73, 0x10, 0xFF, 0x13, 0x10, 0xFF, 0xFB, 0x28, 0xFF, 0xD1, 0x20, 0xFF, 0xB3, 0x30, 0xFF, 0x2E, 0x10, 0xFF, 0x92, 0x28, 0xFF, 0x10, 0x08, 0xFF, 0xB7, 0x61, 0xFF, 0x2D, 0x18, 0xFF, 0x93, 0x40, 0xFF, 0x4C, 0x18, 0xFF, 0xD3, 0x40, 0xFF, 0x90, 0x30, 0xFF, 0x90, 0x30, 0xFF, 0xCE, 0x38, 0xFF, 0x6F, 0x30, 0xFF, 0x4C, 0x20, 0xFF, 0x79, 0x79, 0xFF, 0x70, 0x30, 0xFF, 0x29, 0x20, 0xFF, 0x4A, 0x18, 0xFF, 0x8D, 0x28, 0xFF, 0x16, 0x89, 0xFF, 0x0A, 0x20, 0xFF, 0x2B, 0x20, 0xFF, 0x4B, 0x20, 0xFF, 0x0D, 0x20, 0xFF, 0x96, 0x70, 0xFF, 0x0C, 0x20, 0xFF, 0x2E, 0x28, 0xFF, 0x55, 0x40, 0xFF, 0x59, 0x70, 0xFF, 0xB6, 0x68, 0xFF, 0x91, 0x48, 0xFF, 0x1E, 0x68, 0xFF, 0x54, 0x40, 0xFF, 0x11, 0x28, 0xFF, 0x14, 0x40, 0xFF, 0x1E, 0x89, 0xFF, 0x1B, 0x69, 0xFF, 0x1C, 0xA9, 0xFF, 0x1E, 0x69, 0xFF, 0x3E, 0x60, 0xFF, 0x15, 0x28, 0xFF, 0x18, 0x30, 0xFF, 0x1E, 0x28, 0xFF, 0x1F, 0x40, 0xFF,
-    0x1F, 0x6A, 0xFF, 0x3D, 0x48, 0xFF, 0x15, 0x30, 0xFF, 0x16, 0x28, 0xFF, 0x1A, 0x20, 0xFF, 0x15, 0x18, 0xFF, 0x34, 0x30, 0xFF, 0xB6, 0x38, 0xFF, 0x51, 0x20, 0xFF, 0x30, 0x18, 0xFF, 0x30, 0x20, 0xFF, 0x52, 0x40, 0xFF, 0x2F, 0x18, 0xFF, 0x0E, 0x18, 0xFF, 0x2E, 0x18, 0xFF, 0x51, 0x28, 0xFF, 0x5F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x1D, 0x00, 0xFF, 0x1C, 0x00, 0xFF, 0x5C, 0x08, 0xFF, 0x9C, 0x18, 0xFF, 0x38, 0x00, 0xFF, 0x38, 0x00, 0xFF, 0x15, 0x00, 0xFF, 0xDC, 0x28, 0xFF, 0x54, 0x08, 0xFF, 0x72, 0x08, 0xFF, 0x52, 0x10, 0xFF, 0xF6, 0x38, 0xFF, 0x9E, 0x49, 0xFF, 0x2E, 0x10, 0xFF, 0xD3, 0x30, 0xFF, 0x2E, 0x10, 0xFF, 0x2C, 0x10, 0xFF, 0x3A, 0x61, 0xFF, 0x6F, 0x20, 0xFF, 0x0B, 0x10, 0xFF, 0x4D, 0x20, 0xFF, 0x2B, 0x18, 0xFF, 0x38, 0x69, 0xFF, 0x2B, 0x18, 0xFF, 0x13, 0x51, 0xFF, 0x2C, 0x18, 0xFF, 0x6B, 0x20, 0xFF, 0x38, 0x79, 0xFF, 0x6F, 0x30, 0xFF, 0x2B, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0x8C, 0x28, 0xFF, 0xF5, 0x68, 0xFF, 0x2B, 0x20, 0xFF, 0x2B, 0x20, 0xFF, 0x4B, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0xF7, 0x78, 0xFF, 0x2D, 0x20, 0xFF, 0x4E, 0x28, 0xFF, 0xB7, 0x50, 0xFF,
-    0x18, 0x69, 0xFF, 0xB6, 0x70, 0xFF, 0x2F, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x59, 0x70, 0xFF, 0x31, 0x30, 0xFF, 0xB7, 0x70, 0xFF, 0x32, 0x28, 0xFF, 0x3B, 0x70, 0xFF, 0x13, 0x28, 0xFF, 0x1D, 0x60, 0xFF, 0x98, 0x68, 0xFF, 0x14, 0x28, 0xFF, 0x17, 0x20, 0xFF, 0x3F, 0x60, 0xFF, 0x3D, 0x28, 0xFF, 0x58, 0x58, 0xFF, 0x3A, 0x58, 0xFF, 0x35, 0x20, 0xFF, 0x15, 0x20, 0xFF, 0x14, 0x20, 0xFF, 0x75, 0x40, 0xFF, 0x32, 0x18, 0xFF, 0x32, 0x20, 0xFF, 0x31, 0x18, 0xFF, 0x9B, 0x58, 0xFF, 0x10, 0x30, 0xFF, 0x30, 0x18, 0xFF, 0x30, 0x20, 0xFF, 0x91, 0x28, 0xFF, 0x12, 0x28, 0xFF, 0x93, 0x48, 0xFF, 0x5F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3E, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x11, 0xFF, 0x3F, 0x00, 0xFF, 0x3E, 0x00, 0xFF, 0x3E, 0x00, 0xFF, 0x5D, 0x00, 0xFF, 0x9E, 0x18, 0xFF, 0x3A, 0x00, 0xFF, 0x58, 0x08, 0xFF, 0x36, 0x00, 0xFF, 0x35, 0x08, 0xFF, 0x34, 0x10, 0xFF, 0x32, 0x08, 0xFF, 0x32, 0x08, 0xFF, 0x30, 0x08, 0xFF, 0x0F, 0x08, 0xFF, 0x2E, 0x08, 0xFF, 0x2F, 0x10, 0xFF, 0x2F, 0x10, 0xFF, 0x0D, 0x10, 0xFF, 0x2D, 0x10, 0xFF, 0x2E, 0x18, 0xFF, 0x2C, 0x10, 0xFF, 0x0D, 0x18, 0xFF, 0x0B, 0x10, 0xFF, 0x4D, 0x20, 0xFF, 0x6D, 0x20, 0xFF, 0x6E, 0x30, 0xFF,
-    0x6C, 0x20, 0xFF, 0x6D, 0x28, 0xFF, 0x0A, 0x18, 0xFF, 0x6E, 0x30, 0xFF, 0x2C, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0x8D, 0x28, 0xFF, 0x52, 0x61, 0xFF, 0x4B, 0x20, 0xFF, 0x4B, 0x20, 0xFF, 0x2B, 0x18, 0xFF, 0x0D, 0x28, 0xFF, 0xF2, 0x58, 0xFF, 0x2D, 0x20, 0xFF, 0x90, 0x30, 0xFF, 0x91, 0x38, 0xFF, 0x30, 0x28, 0xFF, 0x30, 0x30, 0xFF, 0x10, 0x28, 0xFF, 0x50, 0x28, 0xFF, 0x32, 0x30, 0xFF, 0x31, 0x30, 0xFF, 0x19, 0x40, 0xFF, 0x12, 0x28, 0xFF, 0x13, 0x28, 0xFF, 0x14, 0x30, 0xFF, 0x54, 0x30, 0xFF, 0x34, 0x28, 0xFF, 0x7B, 0x58, 0xFF, 0x7F, 0x88, 0xFF, 0x16, 0x20, 0xFF, 0x19, 0x20, 0xFF, 0xFF, 0x90, 0xFF, 0x17, 0x28, 0xFF, 0x15, 0x20, 0xFF, 0x35, 0x20, 0xFF, 0x5F, 0x70, 0xFF, 0x33, 0x20, 0xFF, 0x33, 0x20, 0xFF, 0x12, 0x18, 0xFF, 0x18, 0x40, 0xFF, 0x33, 0x20, 0xFF, 0x31, 0x20, 0xFF, 0x30, 0x20, 0xFF, 0x54, 0x30, 0xFF, 0x94, 0x48, 0xFF, 0x2F, 0x18, 0xFF, 0x2F, 0x20, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0xDF, 0x00, 0xFF, 0x1E, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x08, 0xFF, 0x3F, 0x00, 0xFF, 0x1C, 0x00, 0xFF, 0x3A, 0x00, 0xFF, 0xBF, 0x10, 0xFF, 0x58, 0x08, 0xFF, 0x37, 0x08, 0xFF, 0x56, 0x08, 0xFF, 0x77, 0x10, 0xFF,
-    0x3C, 0x39, 0xFF, 0x94, 0x10, 0xFF, 0x30, 0x00, 0xFF, 0x31, 0x10, 0xFF, 0x10, 0x08, 0xFF, 0x0F, 0x10, 0xFF, 0x2F, 0x10, 0xFF, 0x0E, 0x10, 0xFF, 0x4E, 0x10, 0xFF, 0xF7, 0x50, 0xFF, 0x2C, 0x10, 0xFF, 0x4D, 0x20, 0xFF, 0x0C, 0x18, 0xFF, 0xAF, 0x30, 0xFF, 0x76, 0x61, 0xFF, 0x2C, 0x18, 0xFF, 0x6C, 0x20, 0xFF, 0x6C, 0x28, 0xFF, 0x0C, 0x20, 0xFF, 0x70, 0x38, 0xFF, 0x6E, 0x30, 0xFF, 0x49, 0x18, 0xFF, 0x4D, 0x28, 0xFF, 0x14, 0x69, 0xFF, 0xB2, 0x61, 0xFF, 0x2B, 0x20, 0xFF, 0x0A, 0x18, 0xFF, 0x0D, 0x28, 0xFF, 0xBF, 0xB1, 0xFF, 0x4E, 0x28, 0xFF, 0x4F, 0x28, 0xFF, 0x91, 0x38, 0xFF, 0x73, 0x40, 0xFF, 0x10, 0x30, 0xFF, 0x33, 0x30, 0xFF, 0x51, 0x30, 0xFF, 0x32, 0x40, 0xFF, 0x55, 0x58, 0xFF, 0xF7, 0x60, 0xFF, 0x33, 0x30, 0xFF, 0x14, 0x28, 0xFF, 0x3C, 0x60, 0xFF, 0xBE, 0x80, 0xFF, 0x16, 0x28, 0xFF, 0x1A, 0x30, 0xFF, 0x15, 0x30, 0xFF, 0x18, 0x20, 0xFF, 0x1B, 0x28, 0xFF, 0x3D, 0x58, 0xFF, 0x36, 0x28, 0xFF, 0x36, 0x28, 0xFF, 0x3E, 0x48, 0xFF, 0x35, 0x20, 0xFF, 0x14, 0x20, 0xFF, 0x13, 0x20, 0xFF, 0x14, 0x20, 0xFF, 0x34, 0x28, 0xFF, 0x33, 0x20, 0xFF, 0x31, 0x20, 0xFF, 0x55, 0x30, 0xFF, 0x31, 0x20, 0xFF, 0x10, 0x18, 0xFF, 0x73, 0x28, 0xFF, 0x30, 0x18, 0xFF,
-    0x3F, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0x5D, 0x06, 0xFF, 0x3F, 0x06, 0xFF, 0x5F, 0x01, 0xFF, 0x3F, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x1E, 0x00, 0xFF, 0x7F, 0x00, 0xFF, 0x9E, 0x18, 0xFF, 0xBD, 0x20, 0xFF, 0x38, 0x00, 0xFF, 0x36, 0x00, 0xFF, 0x98, 0x18, 0xFF, 0x5A, 0x39, 0xFF, 0x13, 0x08, 0xFF, 0x30, 0x08, 0xFF, 0x93, 0x28, 0xFF, 0x0F, 0x10, 0xFF, 0x0F, 0x10, 0xFF, 0x0E, 0x18, 0xFF, 0xB3, 0x38, 0xFF, 0x2F, 0x18, 0xFF, 0xF6, 0x58, 0xFF, 0x4C, 0x18, 0xFF, 0xB2, 0x40, 0xFF, 0x4C, 0x20, 0xFF, 0x13, 0x51, 0xFF, 0xCF, 0x38, 0xFF, 0x2E, 0x30, 0xFF, 0x6F, 0x30, 0xFF, 0x4B, 0x20, 0xFF, 0x71, 0x48, 0xFF, 0x0B, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0x8D, 0x30, 0xFF, 0x15, 0x79, 0xFF, 0x2C, 0x28, 0xFF, 0x0A, 0x18, 0xFF, 0x2A, 0x20, 0xFF, 0x75, 0x48, 0xFF, 0x7A, 0x89, 0xFF, 0x2E, 0x28, 0xFF, 0x4E, 0x28, 0xFF, 0x58, 0x50, 0xFF, 0x1A, 0x89, 0xFF, 0x0F, 0x30, 0xFF, 0x52, 0x30, 0xFF, 0x9F, 0x88, 0xFF, 0x31, 0x30, 0xFF, 0x98, 0x50, 0xFF, 0x34, 0x38, 0xFF, 0x3B, 0x99, 0xFF, 0x5B, 0x40, 0xFF, 0x5A, 0x70, 0xFF, 0x14, 0x30, 0xFF, 0x17, 0x28, 0xFF, 0xDA, 0x78, 0xFF, 0x16, 0x28, 0xFF, 0x3D, 0x40, 0xFF, 0xDF, 0x88, 0xFF,
-    0x37, 0x20, 0xFF, 0x37, 0x30, 0xFF, 0xBD, 0x60, 0xFF, 0xDA, 0x40, 0xFF, 0x36, 0x28, 0xFF, 0x15, 0x20, 0xFF, 0x15, 0x28, 0xFF, 0x98, 0x58, 0xFF, 0x13, 0x20, 0xFF, 0x12, 0x18, 0xFF, 0x35, 0x28, 0xFF, 0x15, 0x38, 0xFF, 0x75, 0x48, 0xFF, 0x38, 0x28, 0xFF, 0x31, 0x18, 0xFF, 0x73, 0x28, 0xFF, 0x7F, 0x01, 0xFF, 0x9E, 0x02, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x03, 0xFF, 0x1F, 0x1B, 0xFF, 0x3F, 0x2B, 0xFF, 0x1E, 0x00, 0xFF, 0xFF, 0x0B, 0xFF, 0x1B, 0x09, 0xFF, 0x7E, 0x08, 0xFF, 0x1E, 0x21, 0xFF, 0x5A, 0x18, 0xFF, 0x3F, 0x39, 0xFF, 0x99, 0x20, 0xFF, 0x96, 0x18, 0xFF, 0x34, 0x08, 0xFF, 0x33, 0x08, 0xFF, 0xDB, 0x69, 0xFF, 0x57, 0x52, 0xFF, 0x0F, 0x08, 0xFF, 0x92, 0x30, 0xFF, 0x70, 0x20, 0xFF, 0xB3, 0x38, 0xFF, 0xB1, 0x38, 0xFF, 0x11, 0x41, 0xFF, 0x0B, 0x10, 0xFF, 0x2D, 0x20, 0xFF, 0x4D, 0x20, 0xFF, 0x15, 0x82, 0xFF, 0xB2, 0x59, 0xFF, 0xAE, 0x40, 0xFF, 0x8D, 0x40, 0xFF, 0x6C, 0x28, 0xFF, 0x15, 0x71, 0xFF, 0x6F, 0x40, 0xFF, 0xD3, 0x60, 0xFF, 0x0A, 0x28, 0xFF, 0x6D, 0x30, 0xFF, 0xB7, 0xC9, 0xFF, 0x6E, 0x40, 0xFF, 0x2A, 0x18, 0xFF, 0x2B, 0x20, 0xFF, 0x56, 0x50, 0xFF, 0x94, 0x70, 0xFF, 0xD1, 0x48, 0xFF, 0x72, 0x40, 0xFF, 0xD7, 0x68, 0xFF,
-    0x17, 0x69, 0xFF, 0xD6, 0x78, 0xFF, 0x73, 0x40, 0xFF, 0xB6, 0x50, 0xFF, 0x5C, 0x91, 0xFF, 0xD4, 0x50, 0xFF, 0x7A, 0x58, 0xFF, 0xD8, 0x58, 0xFF, 0x7E, 0x80, 0xFF, 0x34, 0x38, 0xFF, 0x7C, 0x78, 0xFF, 0x7F, 0x50, 0xFF, 0x19, 0x48, 0xFF, 0x17, 0x30, 0xFF, 0x1E, 0xBB, 0xFF, 0x17, 0x20, 0xFF, 0x37, 0x20, 0xFF, 0x9C, 0x58, 0xFF, 0x3A, 0x30, 0xFF, 0x58, 0x30, 0xFF, 0x17, 0x20, 0xFF, 0x5A, 0x48, 0xFF, 0x17, 0x30, 0xFF, 0x35, 0x28, 0xFF, 0x34, 0x20, 0xFF, 0xFF, 0x60, 0xFF, 0x36, 0x30, 0xFF, 0x74, 0x30, 0xFF, 0x55, 0x28, 0xFF, 0x11, 0x20, 0xFF, 0x31, 0x20, 0xFF, 0x33, 0x28, 0xFF, 0x1F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x9F, 0x02, 0xFF, 0x1F, 0x03, 0xFF, 0x7D, 0x01, 0xFF, 0xBF, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0x5F, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0x5F, 0x21, 0xFF, 0x9F, 0x18, 0xFF, 0x1B, 0x00, 0xFF, 0x59, 0x08, 0xFF, 0x38, 0x08, 0xFF, 0x1F, 0x41, 0xFF, 0x57, 0x18, 0xFF, 0x55, 0x08, 0xFF, 0x53, 0x10, 0xFF, 0x74, 0x18, 0xFF, 0x5D, 0x59, 0xFF, 0x4F, 0x10, 0xFF, 0x50, 0x18, 0xFF, 0x92, 0x30, 0xFF, 0x4E, 0x18, 0xFF, 0x37, 0x59, 0xFF, 0x4F, 0x20, 0xFF, 0x2C, 0x18, 0xFF, 0x50, 0x30, 0xFF, 0x2D, 0x20, 0xFF, 0x36, 0x79, 0xFF, 0x4D, 0x28, 0xFF, 0x2E, 0x30, 0xFF,
-    0x6C, 0x28, 0xFF, 0x4D, 0x28, 0xFF, 0x14, 0x71, 0xFF, 0x6F, 0x40, 0xFF, 0x91, 0x48, 0xFF, 0x0B, 0x20, 0xFF, 0x6E, 0x38, 0xFF, 0x15, 0x81, 0xFF, 0x0C, 0x28, 0xFF, 0x0A, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x57, 0x58, 0xFF, 0xF7, 0x80, 0xFF, 0x4F, 0x30, 0xFF, 0x36, 0x40, 0xFF, 0x74, 0x48, 0xFF, 0x50, 0x30, 0xFF, 0xF8, 0x80, 0xFF, 0x36, 0x40, 0xFF, 0x73, 0x40, 0xFF, 0x38, 0x48, 0xFF, 0x34, 0x38, 0xFF, 0xB9, 0x80, 0xFF, 0x15, 0x38, 0xFF, 0x5A, 0x60, 0xFF, 0x18, 0x40, 0xFF, 0x3A, 0x48, 0xFF, 0x5C, 0x78, 0xFF, 0x18, 0x40, 0xFF, 0x3B, 0x58, 0xFF, 0x1A, 0x28, 0xFF, 0x19, 0x20, 0xFF, 0x5D, 0x50, 0xFF, 0x3C, 0x38, 0xFF, 0x5C, 0x38, 0xFF, 0x19, 0x28, 0xFF, 0xDF, 0x70, 0xFF, 0x16, 0x38, 0xFF, 0x1B, 0x69, 0xFF, 0x57, 0x30, 0xFF, 0x5A, 0x48, 0xFF, 0x36, 0x30, 0xFF, 0x78, 0x58, 0xFF, 0xF7, 0x48, 0xFF, 0xF8, 0x40, 0xFF, 0x75, 0x30, 0xFF, 0x53, 0x28, 0xFF, 0x56, 0x50, 0xFF, 0x5F, 0x00, 0xFF, 0x5F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x1F, 0x00, 0xFF, 0x5E, 0x00, 0xFF, 0x5F, 0x00, 0xFF, 0x3F, 0x21, 0xFF, 0x5F, 0x00, 0xFF, 0x5F, 0x00, 0xFF, 0x1D, 0x00, 0xFF, 0x5D, 0x00, 0xFF, 0x1F, 0x29, 0xFF, 0x5B, 0x08, 0xFF, 0x59, 0x10, 0xFF, 0x37, 0x08, 0xFF, 0x56, 0x10, 0xFF,
-    0x15, 0x10, 0xFF, 0x73, 0x18, 0xFF, 0x51, 0x10, 0xFF, 0x52, 0x18, 0xFF, 0x38, 0x61, 0xFF, 0x50, 0x18, 0xFF, 0x92, 0x28, 0xFF, 0x0F, 0x18, 0xFF, 0x4F, 0x20, 0xFF, 0x55, 0x71, 0xFF, 0xB1, 0x38, 0xFF, 0x70, 0x28, 0xFF, 0x6F, 0x30, 0xFF, 0x4D, 0x28, 0xFF, 0x4F, 0x30, 0xFF, 0x6F, 0x38, 0xFF, 0x4D, 0x28, 0xFF, 0xB1, 0x40, 0xFF, 0x2E, 0x30, 0xFF, 0x70, 0x38, 0xFF, 0x6F, 0x40, 0xFF, 0x6F, 0x30, 0xFF, 0x6E, 0x38, 0xFF, 0x94, 0x80, 0xFF, 0x4F, 0x30, 0xFF, 0x4F, 0x30, 0xFF, 0x0D, 0x28, 0xFF, 0x77, 0x58, 0xFF, 0xB5, 0x78, 0xFF, 0x2F, 0x38, 0xFF, 0x54, 0x40, 0xFF, 0x12, 0x40, 0xFF, 0x32, 0x38, 0xFF, 0x57, 0x50, 0xFF, 0x9B, 0x68, 0xFF, 0x36, 0x48, 0xFF, 0x36, 0x40, 0xFF, 0x78, 0x58, 0xFF, 0x58, 0x48, 0xFF, 0x17, 0x40, 0xFF, 0x18, 0x40, 0xFF, 0x1C, 0x50, 0xFF, 0x5D, 0x88, 0xFF, 0x5B, 0x58, 0xFF, 0x1D, 0x48, 0xFF, 0x1B, 0x38, 0xFF, 0x1E, 0x40, 0xFF, 0x7F, 0x70, 0xFF, 0x1F, 0x28, 0xFF, 0x1F, 0x38, 0xFF, 0x1F, 0x38, 0xFF, 0xDF, 0x90, 0xFF, 0x9F, 0x80, 0xFF, 0x5A, 0x30, 0xFF, 0x3A, 0x30, 0xFF, 0x39, 0x30, 0xFF, 0x7E, 0x68, 0xFF, 0x17, 0x30, 0xFF, 0x59, 0x38, 0xFF, 0x15, 0x28, 0xFF, 0x56, 0x30, 0xFF, 0x35, 0x40, 0xFF, 0x74, 0x30, 0xFF, 0x14, 0x20, 0xFF,
-    0x9F, 0x10, 0xFF, 0x7F, 0x08, 0xFF, 0x5F, 0x00, 0xFF, 0x5F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x3F, 0x00, 0xFF, 0x5E, 0x00, 0xFF, 0x7F, 0x08, 0xFF, 0xDF, 0x20, 0xFF, 0x7F, 0x00, 0xFF, 0x5E, 0x08, 0xFF, 0x3B, 0x10, 0xFF, 0xDB, 0x30, 0xFF, 0x59, 0x18, 0xFF, 0x39, 0x08, 0xFF, 0x56, 0x10, 0xFF, 0x19, 0x39, 0xFF, 0x76, 0x28, 0xFF, 0x53, 0x10, 0xFF, 0x31, 0x18, 0xFF, 0x72, 0x20, 0xFF, 0x31, 0x28, 0xFF, 0x30, 0x20, 0xFF, 0x0E, 0x18, 0xFF, 0x2F, 0x20, 0xFF, 0x2F, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x6F, 0x28, 0xFF, 0xD3, 0x48, 0xFF, 0x4C, 0x28, 0xFF, 0xF3, 0x58, 0xFF, 0xCF, 0x38, 0xFF, 0x2D, 0x30, 0xFF, 0x4E, 0x30, 0xFF, 0x0C, 0x28, 0xFF, 0x71, 0x40, 0xFF, 0xD0, 0x48, 0xFF, 0x4D, 0x28, 0xFF, 0x6F, 0x38, 0xFF, 0x0F, 0x40, 0xFF, 0x0F, 0x30, 0xFF, 0x2F, 0x30, 0xFF, 0x2E, 0x30, 0xFF, 0x76, 0x58, 0xFF, 0x53, 0x60, 0xFF, 0x51, 0x38, 0xFF, 0x13, 0x38, 0xFF, 0x33, 0x40, 0xFF, 0x33, 0x38, 0xFF, 0x36, 0x48, 0xFF, 0x55, 0x48, 0xFF, 0x5D, 0xA1, 0xFF, 0x36, 0x48, 0xFF, 0x1A, 0x71, 0xFF, 0x39, 0x50, 0xFF, 0x17, 0x40, 0xFF, 0x3D, 0x58, 0xFF, 0x1D, 0x60, 0xFF, 0x5C, 0x68, 0xFF, 0x1B, 0x38, 0xFF, 0x1C, 0x40, 0xFF, 0x3C, 0x40, 0xFF, 0x7F, 0x88, 0xFF, 0x1F, 0x38, 0xFF,
-    0x7E, 0x38, 0xFF, 0xBD, 0x50, 0xFF, 0x7F, 0x90, 0xFF, 0x3F, 0x40, 0xFF, 0x5F, 0x40, 0xFF, 0x5F, 0x38, 0xFF, 0x1F, 0x38, 0xFF, 0x1B, 0x48, 0xFF, 0x19, 0x28, 0xFF, 0xDF, 0x50, 0xFF, 0x19, 0x30, 0xFF, 0x3E, 0x50, 0xFF, 0x7D, 0x48, 0xFF, 0x37, 0x28, 0xFF, 0xBD, 0x58, 0xFF, 0x39, 0x30, 0xFF, 0xBF, 0x18, 0xFF, 0x7F, 0x10, 0xFF, 0x9F, 0x10, 0xFF, 0x7F, 0x10, 0xFF, 0x3F, 0x00, 0xFF, 0x5F, 0x08, 0xFF, 0xDF, 0x11, 0xFF, 0x7F, 0x10, 0xFF, 0x7F, 0x10, 0xFF, 0x5F, 0x08, 0xFF, 0x5D, 0x10, 0xFF, 0x5A, 0x18, 0xFF, 0x79, 0x18, 0xFF, 0x58, 0x10, 0xFF, 0x57, 0x18, 0xFF, 0x55, 0x18, 0xFF, 0x76, 0x18, 0xFF, 0x33, 0x18, 0xFF, 0x16, 0x39, 0xFF, 0x52, 0x20, 0xFF, 0x51, 0x18, 0xFF, 0x70, 0x20, 0xFF, 0x51, 0x20, 0xFF, 0x2F, 0x18, 0xFF, 0x50, 0x20, 0xFF, 0x2E, 0x20, 0xFF, 0xB4, 0x71, 0xFF, 0x4E, 0x30, 0xFF, 0xD2, 0x38, 0xFF, 0x8F, 0x38, 0xFF, 0x4E, 0x28, 0xFF, 0xB0, 0x40, 0xFF, 0x2D, 0x28, 0xFF, 0x4E, 0x30, 0xFF, 0x2D, 0x28, 0xFF, 0x72, 0x40, 0xFF, 0x71, 0x50, 0xFF, 0x2D, 0x28, 0xFF, 0x4F, 0x38, 0xFF, 0x0F, 0x30, 0xFF, 0x50, 0x38, 0xFF, 0x50, 0x38, 0xFF, 0x2F, 0x30, 0xFF, 0x76, 0x60, 0xFF, 0x7D, 0xC3, 0xFF, 0x51, 0x40, 0xFF, 0x78, 0x58, 0xFF, 0x34, 0x48, 0xFF,
-    0x9A, 0x88, 0xFF, 0x19, 0x50, 0xFF, 0x36, 0x48, 0xFF, 0x17, 0x48, 0xFF, 0x17, 0x48, 0xFF, 0x37, 0x40, 0xFF, 0x1D, 0x90, 0xFF, 0x39, 0x48, 0xFF, 0x3C, 0x50, 0xFF, 0x1F, 0x60, 0xFF, 0x3F, 0x70, 0xFF, 0x1F, 0x50, 0xFF, 0x5D, 0x50, 0xFF, 0x9E, 0x88, 0xFF, 0x1F, 0xD4, 0xFF, 0x1E, 0xBB, 0xFF, 0xBF, 0xFF, 0xFF, 0x3F, 0xF6, 0xFF, 0x1F, 0x38, 0xFF, 0x3F, 0x40, 0xFF, 0x3D, 0x8A, 0xFF, 0x9E, 0xBC, 0xFF, 0x1D, 0x30, 0xFF, 0xBE, 0x68, 0xFF, 0x1E, 0x30, 0xFF, 0x1E, 0x40, 0xFF, 0x3A, 0x48, 0xFF, 0x19, 0x30, 0xFF, 0x18, 0x38, 0xFF, 0x59, 0x40, 0xFF, 0x17, 0x28, 0xFF, 0x38, 0x38, 0xFF, 0x9F, 0x18, 0xFF, 0x7F, 0x20, 0xFF, 0x3F, 0x14, 0xFF, 0xDF, 0x10, 0xFF, 0x7F, 0x10, 0xFF, 0x9F, 0x20, 0xFF, 0x9F, 0x10, 0xFF, 0x5D, 0x00, 0xFF, 0x1F, 0x09, 0xFF, 0x3C, 0x08, 0xFF, 0xDF, 0x10, 0xFF, 0x58, 0x20, 0xFF, 0x78, 0x18, 0xFF, 0x1F, 0x31, 0xFF, 0xFC, 0x20, 0xFF, 0x55, 0x20, 0xFF, 0x77, 0x20, 0xFF, 0x53, 0x18, 0xFF, 0xBF, 0x61, 0xFF, 0x72, 0x30, 0xFF, 0x51, 0x18, 0xFF, 0x50, 0x20, 0xFF, 0x96, 0x18, 0xFF, 0x1C, 0x59, 0xFF, 0x51, 0x28, 0xFF, 0x4E, 0x28, 0xFF, 0xB1, 0x38, 0xFF, 0xD4, 0x48, 0xFF, 0x54, 0x28, 0xFF, 0xD5, 0x58, 0xFF, 0x2F, 0x30, 0xFF, 0x31, 0x50, 0xFF,
-    0x4D, 0x30, 0xFF, 0x6F, 0x40, 0xFF, 0x5B, 0xA1, 0xFF, 0x0D, 0x28, 0xFF, 0x14, 0x61, 0xFF, 0x6F, 0x38, 0xFF, 0x51, 0x40, 0xFF, 0x9A, 0xC9, 0xFF, 0x52, 0x40, 0xFF, 0x30, 0x38, 0xFF, 0x0F, 0x30, 0xFF, 0xBF, 0xF4, 0xFF, 0xF9, 0x90, 0xFF, 0x32, 0x40, 0xFF, 0x56, 0x50, 0xFF, 0x37, 0x48, 0xFF, 0x54, 0x50, 0xFF, 0xDA, 0x80, 0xFF, 0x3F, 0x91, 0xFF, 0x3A, 0x50, 0xFF, 0x19, 0x48, 0xFF, 0x18, 0x48, 0xFF, 0x1B, 0x68, 0xFF, 0x7C, 0x70, 0xFF, 0xBF, 0x98, 0xFF, 0xBF, 0xF9, 0xFF, 0x1E, 0x50, 0xFF, 0x5F, 0x58, 0xFF, 0x3E, 0x80, 0xFF, 0x1D, 0x60, 0xFF, 0xDE, 0xA0, 0xFF, 0xDF, 0xB9, 0xFF, 0xBE, 0xA0, 0xFF, 0x5D, 0x80, 0xFF, 0x1F, 0x38, 0xFF, 0x7C, 0x50, 0xFF, 0x9F, 0x68, 0xFF, 0x1E, 0x38, 0xFF, 0x1E, 0x30, 0xFF, 0x1B, 0x38, 0xFF, 0x7D, 0x70, 0xFF, 0x1E, 0x40, 0xFF, 0x3D, 0x40, 0xFF, 0x5F, 0x58, 0xFF, 0x9E, 0x60, 0xFF, 0x1B, 0x48, 0xFF, 0x99, 0x40, 0xFF, 0x1C, 0x48, 0xFF, 0xDF, 0x28, 0xFF, 0xBF, 0x20, 0xFF, 0x9F, 0x20, 0xFF, 0x9E, 0x20, 0xFF, 0x5F, 0x19, 0xFF, 0xFF, 0x18, 0xFF, 0x7E, 0x18, 0xFF, 0x7F, 0x08, 0xFF, 0x7A, 0x20, 0xFF, 0x1F, 0x29, 0xFF, 0x7D, 0x10, 0xFF, 0x78, 0x20, 0xFF, 0x19, 0x39, 0xFF, 0x79, 0x18, 0xFF, 0x7F, 0x41, 0xFF, 0x54, 0x18, 0xFF,
-    0x59, 0x49, 0xFF, 0x74, 0x20, 0xFF, 0x72, 0x18, 0xFF, 0x5C, 0x59, 0xFF, 0xF4, 0x38, 0xFF, 0x90, 0x28, 0xFF, 0x30, 0x18, 0xFF, 0xD2, 0x30, 0xFF, 0x58, 0x61, 0xFF, 0xB0, 0x38, 0xFF, 0xB0, 0x38, 0xFF, 0x71, 0x30, 0xFF, 0x92, 0x28, 0xFF, 0x79, 0x79, 0xFF, 0xF4, 0x48, 0xFF, 0xB1, 0x40, 0xFF, 0x4D, 0x30, 0xFF, 0x90, 0x40, 0xFF, 0x37, 0x81, 0xFF, 0x71, 0x40, 0xFF, 0x4E, 0x38, 0xFF, 0x4E, 0x38, 0xFF, 0x52, 0x48, 0xFF, 0x16, 0x81, 0xFF, 0x31, 0x40, 0xFF, 0x50, 0x38, 0xFF, 0x30, 0x38, 0xFF, 0x39, 0x60, 0xFF, 0xF8, 0x88, 0xFF, 0x32, 0x40, 0xFF, 0x15, 0x48, 0xFF, 0x36, 0x48, 0xFF, 0x55, 0x50, 0xFF, 0xD9, 0x88, 0xFF, 0x15, 0x48, 0xFF, 0x3C, 0x70, 0xFF, 0x19, 0x48, 0xFF, 0x7E, 0x68, 0xFF, 0x7D, 0x90, 0xFF, 0x1A, 0x48, 0xFF, 0x1E, 0x68, 0xFF, 0x3C, 0x68, 0xFF, 0x1F, 0x58, 0xFF, 0x9F, 0x78, 0xFF, 0x3D, 0x68, 0xFF, 0x1E, 0x88, 0xFF, 0xDF, 0xFF, 0xFF, 0x5F, 0xFD, 0xFF, 0x7F, 0x98, 0xFF, 0x1F, 0xB2, 0xFF, 0x1E, 0x48, 0xFF, 0x1E, 0x90, 0xFF, 0xFC, 0x70, 0xFF, 0x3E, 0x70, 0xFF, 0x3F, 0x40, 0xFF, 0x1B, 0x80, 0xFF, 0x1F, 0x50, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0x80, 0xFF, 0x5F, 0x60, 0xFF, 0x5D, 0xE2, 0xFF, 0x1E, 0x90, 0xFF, 0x1A, 0x48, 0xFF, 0x16, 0x48, 0xFF,
-    0xDF, 0x28, 0xFF, 0xFF, 0x38, 0xFF, 0xBD, 0x28, 0xFF, 0xBC, 0x28, 0xFF, 0xBC, 0x28, 0xFF, 0xBC, 0x30, 0xFF, 0x5F, 0x31, 0xFF, 0x7D, 0x18, 0xFF, 0x9A, 0x20, 0xFF, 0x99, 0x20, 0xFF, 0x9C, 0x41, 0xFF, 0x7F, 0x51, 0xFF, 0x76, 0x20, 0xFF, 0x78, 0x20, 0xFF, 0x55, 0x18, 0xFF, 0x39, 0x41, 0xFF, 0xF8, 0x38, 0xFF, 0xD7, 0x38, 0xFF, 0x92, 0x28, 0xFF, 0x71, 0x20, 0xFF, 0x79, 0x61, 0xFF, 0x14, 0x49, 0xFF, 0x74, 0x28, 0xFF, 0x4F, 0x20, 0xFF, 0x38, 0x31, 0xFF, 0x38, 0x71, 0xFF, 0x91, 0x30, 0xFF, 0x95, 0x38, 0xFF, 0xB3, 0x40, 0xFF, 0x6E, 0x30, 0xFF, 0x59, 0x79, 0xFF, 0x70, 0x38, 0xFF, 0x72, 0x50, 0xFF, 0x8F, 0x40, 0xFF, 0x50, 0x48, 0xFF, 0x7E, 0x59, 0xFF, 0x36, 0x69, 0xFF, 0x6E, 0x38, 0xFF, 0x73, 0x50, 0xFF, 0xD6, 0x88, 0xFF, 0x52, 0x40, 0xFF, 0x51, 0x40, 0xFF, 0x30, 0x38, 0xFF, 0x55, 0x58, 0xFF, 0x99, 0x88, 0xFF, 0x53, 0x40, 0xFF, 0x3A, 0x60, 0xFF, 0xBF, 0xA8, 0xFF, 0x5E, 0xCB, 0xFF, 0x1B, 0x68, 0xFF, 0x19, 0x48, 0xFF, 0x9F, 0xC0, 0xFF, 0x1B, 0x50, 0xFF, 0x9F, 0xA0, 0xFF, 0x1C, 0x68, 0xFF, 0x1E, 0x98, 0xFF, 0xBD, 0x78, 0xFF, 0x3E, 0x68, 0xFF, 0x9F, 0x98, 0xFF, 0x3E, 0x78, 0xFF, 0x1E, 0x60, 0xFF, 0xDE, 0x88, 0xFF, 0x3F, 0xFB, 0xFF, 0x3E, 0xB8, 0xFF,
-    0x1E, 0x58, 0xFF, 0x3F, 0x58, 0xFF, 0x1E, 0x68, 0xFF, 0x1E, 0x40, 0xFF, 0x7F, 0x89, 0xFF, 0x1F, 0x50, 0xFF, 0x1E, 0x50, 0xFF, 0x5F, 0x48, 0xFF, 0x5F, 0x50, 0xFF, 0x7F, 0x60, 0xFF, 0x3D, 0x60, 0xFF, 0x3E, 0x50, 0xFF, 0x3D, 0x60, 0xFF, 0xDF, 0x80, 0xFF, 0x14, 0x38, 0xFF, 0x17, 0x30, 0xFF, 0xBD, 0x28, 0xFF, 0xBD, 0x28, 0xFF, 0xDC, 0x38, 0xFF, 0xDC, 0x30, 0xFF, 0xBA, 0x30, 0xFF, 0x7A, 0x28, 0xFF, 0x9A, 0x28, 0xFF, 0x59, 0x20, 0xFF, 0x3D, 0x41, 0xFF, 0x99, 0x28, 0xFF, 0x98, 0x28, 0xFF, 0xB6, 0x28, 0xFF, 0x3C, 0x41, 0xFF, 0x76, 0x20, 0xFF, 0x75, 0x20, 0xFF, 0x95, 0x20, 0xFF, 0x78, 0x41, 0xFF, 0x59, 0x51, 0xFF, 0x15, 0x39, 0xFF, 0x91, 0x28, 0xFF, 0xB0, 0x28, 0xFF, 0x55, 0x51, 0xFF, 0xB4, 0x38, 0xFF, 0x91, 0x28, 0xFF, 0xFA, 0x48, 0xFF, 0x70, 0x30, 0xFF, 0x57, 0x79, 0xFF, 0xF4, 0x50, 0xFF, 0xB4, 0x38, 0xFF, 0xD2, 0x50, 0xFF, 0x18, 0x71, 0xFF, 0xB8, 0x38, 0xFF, 0x8E, 0x38, 0xFF, 0x78, 0x48, 0xFF, 0x4F, 0x38, 0xFF, 0xBD, 0x80, 0xFF, 0x95, 0x60, 0xFF, 0xB0, 0x48, 0xFF, 0x5E, 0x71, 0xFF, 0x34, 0x68, 0xFF, 0x31, 0x48, 0xFF, 0x51, 0x40, 0xFF, 0x0F, 0x38, 0xFF, 0xBD, 0x80, 0xFF, 0x38, 0x80, 0xFF, 0x37, 0x58, 0xFF, 0x19, 0x50, 0xFF, 0x9F, 0x90, 0xFF,
-    0x7A, 0x70, 0xFF, 0x79, 0x68, 0xFF, 0x7E, 0x78, 0xFF, 0x9E, 0x78, 0xFF, 0x1A, 0x60, 0xFF, 0x3E, 0xE2, 0xFF, 0x5E, 0xF2, 0xFF, 0x9F, 0x88, 0xFF, 0x1F, 0xA0, 0xFF, 0x9D, 0xF0, 0xFF, 0x1F, 0x80, 0xFF, 0x1F, 0x68, 0xFF, 0x1F, 0x68, 0xFF, 0x1F, 0x80, 0xFF, 0x1F, 0xDA, 0xFF, 0x3F, 0x78, 0xFF, 0x1D, 0x50, 0xFF, 0xBD, 0x80, 0xFF, 0x1E, 0x60, 0xFF, 0x1C, 0x38, 0xFF, 0x3E, 0x58, 0xFF, 0x3C, 0x50, 0xFF, 0x1A, 0x38, 0xFF, 0x1B, 0x48, 0xFF, 0x1C, 0x38, 0xFF, 0x19, 0x38, 0xFF, 0x1D, 0x48, 0xFF, 0x3B, 0x48, 0xFF, 0x5A, 0x48, 0xFF, 0x1B, 0x40, 0xFF, 0x37, 0x40, 0xFF, 0x7E, 0xC1, 0xFF, 0x1C, 0x41, 0xFF, 0xBA, 0x30, 0xFF, 0xDB, 0x38, 0xFF, 0xDA, 0x30, 0xFF, 0xDA, 0x30, 0xFF, 0x9A, 0x28, 0xFF, 0x98, 0x30, 0xFF, 0xB8, 0x30, 0xFF, 0x97, 0x28, 0xFF, 0xB8, 0x28, 0xFF, 0xB7, 0x30, 0xFF, 0x74, 0x20, 0xFF, 0x74, 0x20, 0xFF, 0x95, 0x28, 0xFF, 0xB6, 0x30, 0xFF, 0x37, 0x41, 0xFF, 0x71, 0x20, 0xFF, 0x74, 0x28, 0xFF, 0xF4, 0x40, 0xFF, 0xB2, 0x30, 0xFF, 0x90, 0x30, 0xFF, 0x2F, 0x20, 0xFF, 0xB4, 0x38, 0xFF, 0x33, 0x51, 0xFF, 0x17, 0x41, 0xFF, 0x6E, 0x30, 0xFF, 0x13, 0x51, 0xFF, 0x7D, 0x61, 0xFF, 0x72, 0x38, 0xFF, 0x6E, 0x30, 0xFF, 0x92, 0x48, 0xFF, 0xB8, 0x60, 0xFF,
-    0x75, 0x69, 0xFF, 0x95, 0x48, 0xFF, 0x31, 0x38, 0xFF, 0xF7, 0x78, 0xFF, 0x33, 0x61, 0xFF, 0x50, 0x40, 0xFF, 0x58, 0x40, 0xFF, 0xFA, 0x78, 0xFF, 0x54, 0x60, 0xFF, 0x50, 0x40, 0xFF, 0x30, 0x40, 0xFF, 0x5D, 0x78, 0xFF, 0x1F, 0xA1, 0xFF, 0xFD, 0x60, 0xFF, 0x18, 0x50, 0xFF, 0x19, 0x58, 0xFF, 0xFE, 0xB8, 0xFF, 0x19, 0x58, 0xFF, 0x1B, 0x48, 0xFF, 0x5C, 0x70, 0xFF, 0xDF, 0xE8, 0xFF, 0xFE, 0xB8, 0xFF, 0x1D, 0x58, 0xFF, 0x3D, 0xB0, 0xFF, 0xDE, 0xF4, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xC8, 0xFF, 0x5E, 0xC1, 0xFF, 0xDF, 0xE9, 0xFF, 0x7F, 0xFE, 0xFF, 0x1D, 0xC1, 0xFF, 0xDF, 0xFA, 0xFF, 0x3F, 0x70, 0xFF, 0x1D, 0x70, 0xFF, 0x5F, 0x68, 0xFF, 0x1C, 0x50, 0xFF, 0x1A, 0x50, 0xFF, 0x9E, 0x99, 0xFF, 0x1A, 0x40, 0xFF, 0x1A, 0x40, 0xFF, 0x3B, 0x50, 0xFF, 0x19, 0x38, 0xFF, 0x3F, 0x60, 0xFF, 0x38, 0x38, 0xFF, 0xBD, 0x60, 0xFF, 0x3D, 0x50, 0xFF, 0x3B, 0x58, 0xFF, 0x7D, 0x60, 0xFF, 0xFA, 0x38, 0xFF, 0x1B, 0x39, 0xFF, 0xBF, 0x49, 0xFF, 0xFA, 0x38, 0xFF, 0xB8, 0x30, 0xFF, 0xB8, 0x30, 0xFF, 0xD8, 0x30, 0xFF, 0x7F, 0x29, 0xFF, 0x77, 0x28, 0xFF, 0x96, 0x28, 0xFF, 0x38, 0x39, 0xFF, 0x94, 0x28, 0xFF, 0xFE, 0x69, 0xFF, 0x5A, 0x59, 0xFF, 0xB8, 0x20, 0xFF, 0x92, 0x28, 0xFF,
-    0x36, 0x41, 0xFF, 0x72, 0x30, 0xFF, 0xDF, 0x79, 0xFF, 0x50, 0x28, 0xFF, 0x54, 0x51, 0xFF, 0x4F, 0x28, 0xFF, 0xF5, 0x38, 0xFF, 0x98, 0x71, 0xFF, 0x15, 0x51, 0xFF, 0xB0, 0x38, 0xFF, 0x8E, 0x30, 0xFF, 0x5A, 0x61, 0xFF, 0x17, 0x71, 0xFF, 0xF4, 0x60, 0xFF, 0x6E, 0x38, 0xFF, 0xB5, 0x50, 0xFF, 0x90, 0x40, 0xFF, 0x14, 0x69, 0xFF, 0xFB, 0xA9, 0xFF, 0x30, 0x40, 0xFF, 0x50, 0x48, 0xFF, 0x70, 0x40, 0xFF, 0xFE, 0x89, 0xFF, 0x95, 0x88, 0xFF, 0x51, 0x50, 0xFF, 0x50, 0x48, 0xFF, 0x30, 0x40, 0xFF, 0x32, 0x48, 0xFF, 0x58, 0x91, 0xFF, 0xBA, 0x58, 0xFF, 0x7E, 0x78, 0xFF, 0x1A, 0x60, 0xFF, 0x15, 0x48, 0xFF, 0x3A, 0x90, 0xFF, 0x19, 0x58, 0xFF, 0x5D, 0x98, 0xFF, 0x5D, 0x68, 0xFF, 0x5F, 0x78, 0xFF, 0x1C, 0x60, 0xFF, 0xDF, 0x98, 0xFF, 0x3F, 0xC0, 0xFF, 0x1F, 0xA8, 0xFF, 0x3D, 0x88, 0xFF, 0x9F, 0xD0, 0xFF, 0x7C, 0x78, 0xFF, 0x1D, 0x50, 0xFF, 0x1C, 0x68, 0xFF, 0x9F, 0xA8, 0xFF, 0x3F, 0x68, 0xFF, 0x9C, 0x78, 0xFF, 0x7B, 0x60, 0xFF, 0x1D, 0x78, 0xFF, 0x1A, 0x40, 0xFF, 0x7C, 0x58, 0xFF, 0x37, 0x38, 0xFF, 0x79, 0x58, 0xFF, 0x9B, 0x71, 0xFF, 0x9B, 0x50, 0xFF, 0x39, 0x40, 0xFF, 0x5F, 0x71, 0xFF, 0xBA, 0x60, 0xFF, 0x56, 0x38, 0xFF, 0x36, 0x38, 0xFF, 0x15, 0x38, 0xFF,
-    0x19, 0x41, 0xFF, 0x19, 0x41, 0xFF, 0xD7, 0x38, 0xFF, 0xF8, 0x38, 0xFF, 0x9F, 0x49, 0xFF, 0xDD, 0x49, 0xFF, 0xF8, 0x38, 0xFF, 0xB6, 0x30, 0xFF, 0xD5, 0x30, 0xFF, 0x9F, 0x49, 0xFF, 0xD9, 0x30, 0xFF, 0x93, 0x28, 0xFF, 0xB4, 0x30, 0xFF, 0xD4, 0x30, 0xFF, 0x75, 0x38, 0xFF, 0x30, 0x20, 0xFF, 0x91, 0x28, 0xFF, 0xF3, 0x38, 0xFF, 0x92, 0x30, 0xFF, 0x1B, 0x7A, 0xFF, 0x4F, 0x30, 0xFF, 0x13, 0x49, 0xFF, 0xB4, 0x48, 0xFF, 0x13, 0x41, 0xFF, 0x76, 0x71, 0xFF, 0x90, 0x48, 0xFF, 0x8F, 0x38, 0xFF, 0x96, 0x50, 0xFF, 0x71, 0x38, 0xFF, 0x58, 0x89, 0xFF, 0x0C, 0x30, 0xFF, 0x35, 0x61, 0xFF, 0x37, 0x71, 0xFF, 0x70, 0x48, 0xFF, 0x35, 0x81, 0xFF, 0xB2, 0x58, 0xFF, 0x39, 0x89, 0xFF, 0xB1, 0x50, 0xFF, 0x52, 0x48, 0xFF, 0xF6, 0x90, 0xFF, 0x32, 0x50, 0xFF, 0x50, 0x48, 0xFF, 0x50, 0x48, 0xFF, 0x9B, 0x80, 0xFF, 0xF8, 0x98, 0xFF, 0x57, 0x79, 0xFF, 0x18, 0x58, 0xFF, 0x5E, 0xD8, 0xFF, 0x56, 0x60, 0xFF, 0x9C, 0x98, 0xFF, 0x39, 0x78, 0xFF, 0x9C, 0xC0, 0xFF, 0x3D, 0x70, 0xFF, 0x3E, 0x80, 0xFF, 0x7B, 0x90, 0xFF, 0x7F, 0xB1, 0xFF, 0x9E, 0x78, 0xFF, 0xDF, 0x88, 0xFF, 0xDF, 0xE9, 0xFF, 0x3C, 0x88, 0xFF, 0x3B, 0x70, 0xFF, 0x3B, 0x68, 0xFF, 0x5F, 0x88, 0xFF, 0x1C, 0x58, 0xFF,
-    0x1F, 0xCA, 0xFF, 0x1E, 0x68, 0xFF, 0x1C, 0x58, 0xFF, 0x5E, 0x60, 0xFF, 0x18, 0x48, 0xFF, 0x1D, 0x70, 0xFF, 0x38, 0x48, 0xFF, 0x36, 0x38, 0xFF, 0x56, 0x40, 0xFF, 0x9A, 0x60, 0xFF, 0x77, 0x50, 0xFF, 0x35, 0x38, 0xFF, 0x36, 0x38, 0xFF, 0x1A, 0x40, 0xFF, 0x79, 0x58, 0xFF, 0xDB, 0x79, 0xFF, 0x38, 0x49, 0xFF, 0xB6, 0x30, 0xFF, 0x58, 0x49, 0xFF, 0x17, 0x41, 0xFF, 0xF6, 0x40, 0xFF, 0xB5, 0x38, 0xFF, 0x79, 0x49, 0xFF, 0xD6, 0x38, 0xFF, 0x58, 0x49, 0xFF, 0xD5, 0x38, 0xFF, 0xD4, 0x30, 0xFF, 0xB8, 0x61, 0xFF, 0x73, 0x30, 0xFF, 0x93, 0x30, 0xFF, 0xD2, 0x30, 0xFF, 0xF2, 0x38, 0xFF, 0xD1, 0x28, 0xFF, 0xF4, 0x48, 0xFF, 0xB0, 0x30, 0xFF, 0xB0, 0x30, 0xFF, 0xD3, 0x40, 0xFF, 0xF6, 0x81, 0xFF, 0xD1, 0x40, 0xFF, 0xD2, 0x48, 0xFF, 0xB1, 0x40, 0xFF, 0x35, 0x8A, 0xFF, 0x53, 0x79, 0xFF, 0xB4, 0x48, 0xFF, 0xD0, 0x48, 0xFF, 0x4F, 0x40, 0xFF, 0x59, 0xC2, 0xFF, 0xD0, 0x50, 0xFF, 0xF1, 0x50, 0xFF, 0xD2, 0x58, 0xFF, 0x4F, 0x40, 0xFF, 0xD4, 0x80, 0xFF, 0xB4, 0x68, 0xFF, 0x4F, 0x48, 0xFF, 0xF4, 0x68, 0xFF, 0xB5, 0xA0, 0xFF, 0x11, 0x50, 0xFF, 0x50, 0x48, 0xFF, 0x50, 0x50, 0xFF, 0x5D, 0x88, 0xFF, 0xDD, 0xE9, 0xFF, 0xD5, 0x78, 0xFF, 0xD9, 0x78, 0xFF, 0x5C, 0x78, 0xFF,
-    0x38, 0x68, 0xFF, 0x1A, 0x78, 0xFF, 0x3E, 0xF8, 0xFF, 0x9C, 0xA8, 0xFF, 0x3D, 0x90, 0xFF, 0x3D, 0xEA, 0xFF, 0x1D, 0xB0, 0xFF, 0x1E, 0x90, 0xFF, 0x3F, 0x78, 0xFF, 0x9F, 0xF9, 0xFF, 0x7C, 0xA0, 0xFF, 0x1C, 0x68, 0xFF, 0xFF, 0xE1, 0xFF, 0x1C, 0x58, 0xFF, 0x7F, 0xA0, 0xFF, 0x1C, 0x58, 0xFF, 0x9C, 0xA8, 0xFF, 0x3D, 0x68, 0xFF, 0x7B, 0x70, 0xFF, 0xFF, 0x90, 0xFF, 0x3D, 0x91, 0xFF, 0x16, 0x40, 0xFF, 0x37, 0x40, 0xFF, 0x9F, 0xCA, 0xFF, 0x3D, 0x71, 0xFF, 0x14, 0x30, 0xFF, 0x37, 0x38, 0xFF, 0x16, 0x38, 0xFF, 0x18, 0x58, 0xFF, 0x35, 0x48, 0xFF, 0x38, 0x40, 0xFF, 0x37, 0x40, 0xFF, 0x78, 0x51, 0xFF, 0x16, 0x41, 0xFF, 0x36, 0x49, 0xFF, 0xF6, 0x40, 0xFF, 0x15, 0x49, 0xFF, 0xB4, 0x38, 0xFF, 0xD4, 0x38, 0xFF, 0xF4, 0x38, 0xFF, 0xB3, 0x30, 0xFF, 0x93, 0x30, 0xFF, 0xB3, 0x30, 0xFF, 0xB2, 0x30, 0xFF, 0xD2, 0x38, 0xFF, 0xD2, 0x38, 0xFF, 0x94, 0x51, 0xFF, 0x8F, 0x28, 0xFF, 0xD1, 0x38, 0xFF, 0xF6, 0x61, 0xFF, 0x73, 0x61, 0xFF, 0x34, 0x49, 0xFF, 0xF0, 0x40, 0xFF, 0xF0, 0x40, 0xFF, 0xF2, 0x50, 0xFF, 0xF1, 0x48, 0xFF, 0xD1, 0x48, 0xFF, 0x6E, 0x38, 0xFF, 0xD3, 0x69, 0xFF, 0x90, 0x58, 0xFF, 0x1D, 0xDC, 0xFF, 0x6C, 0x38, 0xFF, 0x30, 0x69, 0xFF, 0x9E, 0xDA, 0xFF,
-    0xB9, 0x92, 0xFF, 0xF9, 0xB9, 0xFF, 0x6E, 0x48, 0xFF, 0xB3, 0x78, 0xFF, 0x4F, 0x58, 0xFF, 0x6F, 0x48, 0xFF, 0x15, 0x81, 0xFF, 0x39, 0xA9, 0xFF, 0x32, 0x58, 0xFF, 0x70, 0x50, 0xFF, 0x50, 0x50, 0xFF, 0x39, 0xC1, 0xFF, 0xFE, 0xD8, 0xFF, 0x33, 0x60, 0xFF, 0x1B, 0x88, 0xFF, 0x9B, 0x88, 0xFF, 0x17, 0x88, 0xFF, 0x7D, 0x90, 0xFF, 0x5E, 0x88, 0xFF, 0x3A, 0x80, 0xFF, 0x1F, 0xFE, 0xFF, 0x3F, 0xD9, 0xFF, 0x1D, 0x90, 0xFF, 0x1D, 0x80, 0xFF, 0x5F, 0xC9, 0xFF, 0x1B, 0x70, 0xFF, 0x1B, 0x60, 0xFF, 0xDC, 0x98, 0xFF, 0x3D, 0x70, 0xFF, 0x5E, 0x98, 0xFF, 0xBF, 0x90, 0xFF, 0x18, 0x48, 0xFF, 0x3E, 0x81, 0xFF, 0x5E, 0x98, 0xFF, 0x5D, 0xB0, 0xFF, 0x19, 0x38, 0xFF, 0x7C, 0x68, 0xFF, 0x59, 0x48, 0xFF, 0xBB, 0x68, 0xFF, 0x16, 0x38, 0xFF, 0x79, 0x70, 0xFF, 0x16, 0x38, 0xFF, 0xBB, 0x68, 0xFF, 0x35, 0x38, 0xFF, 0x16, 0x48, 0xFF, 0x34, 0x38, 0xFF, 0x34, 0x40, 0xFF, 0x34, 0x38, 0xFF, 0x36, 0x41, 0xFF, 0x56, 0x49, 0xFF, 0x15, 0x41, 0xFF, 0x15, 0x41, 0xFF, 0x35, 0x49, 0xFF, 0xF3, 0x38, 0xFF, 0xB2, 0x30, 0xFF, 0x14, 0x41, 0xFF, 0x13, 0x41, 0xFF, 0xD2, 0x38, 0xFF, 0xB2, 0x30, 0xFF, 0xD1, 0x38, 0xFF, 0x13, 0x41, 0xFF, 0xB1, 0x38, 0xFF, 0x90, 0x38, 0xFF, 0x6E, 0x30, 0xFF,
-    0x12, 0x49, 0xFF, 0x12, 0x41, 0xFF, 0xB0, 0x48, 0xFF, 0xB0, 0x40, 0xFF, 0x51, 0x59, 0xFF, 0x10, 0x49, 0xFF, 0xD0, 0x40, 0xFF, 0xD1, 0x48, 0xFF, 0x74, 0x71, 0xFF, 0xD0, 0x48, 0xFF, 0xAD, 0x40, 0xFF, 0x12, 0x61, 0xFF, 0x12, 0x69, 0xFF, 0x8D, 0x40, 0xFF, 0x11, 0x59, 0xFF, 0x6F, 0x50, 0xFF, 0x11, 0x69, 0xFF, 0xB1, 0x58, 0xFF, 0xD0, 0x58, 0xFF, 0x11, 0x58, 0xFF, 0x91, 0x60, 0xFF, 0xD1, 0x58, 0xFF, 0x72, 0x60, 0xFF, 0x72, 0x70, 0xFF, 0x94, 0x60, 0xFF, 0x70, 0x50, 0xFF, 0x50, 0x50, 0xFF, 0xF9, 0x90, 0xFF, 0x5C, 0xA0, 0xFF, 0x76, 0x68, 0xFF, 0x17, 0x68, 0xFF, 0xFE, 0xF0, 0xFF, 0x1A, 0x80, 0xFF, 0x1A, 0x80, 0xFF, 0x5F, 0xC8, 0xFF, 0x7F, 0xF1, 0xFF, 0xDE, 0xE1, 0xFF, 0x3D, 0x80, 0xFF, 0x7E, 0x80, 0xFF, 0x7E, 0xFB, 0xFF, 0x3A, 0x70, 0xFF, 0x1A, 0x60, 0xFF, 0x3C, 0x68, 0xFF, 0x3E, 0xD0, 0xFF, 0x9F, 0xB9, 0xFF, 0x7A, 0x68, 0xFF, 0x7C, 0x78, 0xFF, 0x17, 0x50, 0xFF, 0x7C, 0x78, 0xFF, 0xDC, 0x70, 0xFF, 0x3E, 0xA1, 0xFF, 0x7D, 0x70, 0xFF, 0x39, 0x58, 0xFF, 0x3C, 0x50, 0xFF, 0xFC, 0x68, 0xFF, 0x1D, 0x68, 0xFF, 0x97, 0x58, 0xFF, 0x34, 0x38, 0xFF, 0x34, 0x38, 0xFF, 0x55, 0x48, 0xFF, 0x56, 0x48, 0xFF, 0x53, 0x38, 0xFF, 0x32, 0x30, 0xFF, 0x32, 0x30, 0xFF,
-    0x35, 0x49, 0xFF, 0xF5, 0x40, 0xFF, 0x7C, 0x7A, 0xFF, 0xF4, 0x40, 0xFF, 0x35, 0x49, 0xFF, 0x13, 0x41, 0xFF, 0xB6, 0x28, 0xFF, 0x3F, 0x6A, 0xFF, 0xF2, 0x38, 0xFF, 0xF2, 0x38, 0xFF, 0xD1, 0x38, 0xFF, 0xD1, 0x38, 0xFF, 0x3E, 0x72, 0xFF, 0x90, 0x30, 0xFF, 0x11, 0x41, 0xFF, 0xCF, 0x38, 0xFF, 0x36, 0x72, 0xFF, 0xB0, 0x48, 0xFF, 0x18, 0x8A, 0xFF, 0xCF, 0x40, 0xFF, 0xCF, 0x40, 0xFF, 0xCE, 0x40, 0xFF, 0x31, 0x59, 0xFF, 0x3A, 0x9A, 0xFF, 0xAF, 0x48, 0xFF, 0x31, 0x61, 0xFF, 0xEF, 0x50, 0xFF, 0x32, 0x61, 0xFF, 0x7A, 0xAA, 0xFF, 0xF3, 0x70, 0xFF, 0x8E, 0x48, 0xFF, 0xCF, 0x58, 0xFF, 0xAF, 0x58, 0xFF, 0xCF, 0x60, 0xFF, 0xFB, 0xD9, 0xFF, 0x91, 0x60, 0xFF, 0x15, 0x89, 0xFF, 0x8F, 0x50, 0xFF, 0xD2, 0x68, 0xFF, 0x78, 0xA1, 0xFF, 0x70, 0x58, 0xFF, 0x70, 0x58, 0xFF, 0x4D, 0x48, 0xFF, 0x3F, 0xE1, 0xFF, 0xD9, 0xA0, 0xFF, 0x56, 0x78, 0xFF, 0x38, 0x90, 0xFF, 0x5C, 0xE0, 0xFF, 0x38, 0x80, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF8, 0xFF, 0x1E, 0xA0, 0xFF, 0x1C, 0x78, 0xFF, 0x1F, 0xF9, 0xFF, 0xDA, 0x98, 0xFF, 0x17, 0x58, 0xFF, 0x3E, 0xA8, 0xFF, 0x1E, 0xA8, 0xFF, 0x39, 0x68, 0xFF, 0xDA, 0x78, 0xFF, 0x1D, 0x70, 0xFF, 0x18, 0x58, 0xFF, 0xB9, 0x80, 0xFF,
-    0x18, 0x50, 0xFF, 0x7B, 0x60, 0xFF, 0x97, 0x78, 0xFF, 0x14, 0x38, 0xFF, 0x1C, 0x68, 0xFF, 0x3B, 0x60, 0xFF, 0x13, 0x38, 0xFF, 0x1D, 0xB1, 0xFF, 0x56, 0x50, 0xFF, 0x34, 0x38, 0xFF, 0x34, 0x40, 0xFF, 0x5A, 0x81, 0xFF, 0x55, 0x40, 0xFF, 0xB6, 0x60, 0xFF, 0x52, 0x30, 0xFF, 0x55, 0x40, 0xFF, 0x95, 0x59, 0xFF, 0x54, 0x51, 0xFF, 0x34, 0x49, 0xFF, 0x52, 0x28, 0xFF, 0xD9, 0x59, 0xFF, 0x12, 0x41, 0xFF, 0xD2, 0x40, 0xFF, 0xF3, 0x40, 0xFF, 0x57, 0x72, 0xFF, 0x3B, 0x7A, 0xFF, 0x99, 0x7A, 0xFF, 0xB1, 0x38, 0xFF, 0xF0, 0x38, 0xFF, 0xB3, 0x59, 0xFF, 0x19, 0x7A, 0xFF, 0x57, 0x82, 0xFF, 0x8D, 0x30, 0xFF, 0x10, 0x51, 0xFF, 0x71, 0x61, 0xFF, 0x58, 0x92, 0xFF, 0x55, 0x92, 0xFF, 0xCE, 0x48, 0xFF, 0x93, 0x71, 0xFF, 0xAE, 0x40, 0xFF, 0xD6, 0x89, 0xFF, 0x16, 0xA2, 0xFF, 0x10, 0x59, 0xFF, 0xB6, 0x91, 0xFF, 0xEE, 0x58, 0xFF, 0xB5, 0x99, 0xFF, 0x31, 0x79, 0xFF, 0x10, 0x71, 0xFF, 0xEF, 0x60, 0xFF, 0x0F, 0x71, 0xFF, 0x53, 0x99, 0xFF, 0xD0, 0x60, 0xFF, 0xD2, 0x70, 0xFF, 0x8E, 0x50, 0xFF, 0xD1, 0x78, 0xFF, 0xB5, 0xD1, 0xFF, 0x38, 0x89, 0xFF, 0x90, 0x58, 0xFF, 0x6F, 0x58, 0xFF, 0x54, 0x80, 0xFF, 0xB9, 0xA0, 0xFF, 0x54, 0x78, 0xFF, 0x5F, 0xB8, 0xFF, 0xBC, 0xA8, 0xFF,
-    0x36, 0x80, 0xFF, 0x1F, 0xE1, 0xFF, 0x3F, 0xFA, 0xFF, 0x7F, 0xF9, 0xFF, 0x3D, 0x98, 0xFF, 0x1B, 0x80, 0xFF, 0x9A, 0x98, 0xFF, 0xDF, 0xD1, 0xFF, 0x3B, 0x68, 0xFF, 0x17, 0x58, 0xFF, 0x37, 0x68, 0xFF, 0x9A, 0x98, 0xFF, 0x39, 0x60, 0xFF, 0x99, 0x78, 0xFF, 0x7A, 0x68, 0xFF, 0x13, 0x50, 0xFF, 0x16, 0x50, 0xFF, 0x7A, 0x70, 0xFF, 0x1B, 0x58, 0xFF, 0x97, 0x60, 0xFF, 0x1D, 0xB1, 0xFF, 0x15, 0x48, 0xFF, 0x36, 0x68, 0xFF, 0x34, 0x40, 0xFF, 0x13, 0x38, 0xFF, 0x18, 0x60, 0xFF, 0xB4, 0x50, 0xFF, 0xDE, 0x91, 0xFF, 0x32, 0x38, 0xFF, 0x32, 0x30, 0xFF, 0x98, 0x50, 0xFF, 0x52, 0x40, 0xFF, 0x95, 0x59, 0xFF, 0x74, 0x51, 0xFF, 0x94, 0x59, 0xFF, 0x33, 0x49, 0xFF, 0x73, 0x59, 0xFF, 0x11, 0x49, 0xFF, 0xF1, 0x40, 0xFF, 0xF1, 0x40, 0xFF, 0xD0, 0x40, 0xFF, 0xB4, 0x61, 0xFF, 0xF0, 0x38, 0xFF, 0xEF, 0x38, 0xFF, 0x36, 0x72, 0xFF, 0x76, 0x7A, 0xFF, 0xAE, 0x38, 0xFF, 0x0F, 0x41, 0xFF, 0x8C, 0x38, 0xFF, 0xEF, 0x48, 0xFF, 0x71, 0x71, 0xFF, 0xEE, 0x48, 0xFF, 0xB2, 0x71, 0xFF, 0x33, 0x92, 0xFF, 0x75, 0x9A, 0xFF, 0x0F, 0x59, 0xFF, 0x8D, 0x48, 0xFF, 0xAD, 0x48, 0xFF, 0xF4, 0xA1, 0xFF, 0x30, 0x69, 0xFF, 0xAD, 0x50, 0xFF, 0xAC, 0x40, 0xFF, 0x75, 0xAA, 0xFF, 0x15, 0xAA, 0xFF,
-    0xAE, 0x50, 0xFF, 0xEF, 0x60, 0xFF, 0x50, 0x79, 0xFF, 0x4F, 0x98, 0xFF, 0xB0, 0x70, 0xFF, 0xAF, 0x60, 0xFF, 0xD1, 0x80, 0xFF, 0x7B, 0xFA, 0xFF, 0xB2, 0x70, 0xFF, 0x70, 0x58, 0xFF, 0x0D, 0x50, 0xFF, 0xB4, 0x88, 0xFF, 0x19, 0xD8, 0xFF, 0x33, 0x88, 0xFF, 0x99, 0xA8, 0xFF, 0x5F, 0xFA, 0xFF, 0x36, 0xB0, 0xFF, 0x7A, 0xA0, 0xFF, 0xDE, 0xB8, 0xFF, 0x3F, 0xC1, 0xFF, 0x9D, 0xE8, 0xFF, 0x9C, 0xC8, 0xFF, 0x99, 0x80, 0xFF, 0x3C, 0x99, 0xFF, 0x35, 0x60, 0xFF, 0x17, 0x80, 0xFF, 0x7A, 0x78, 0xFF, 0x36, 0x68, 0xFF, 0x36, 0x60, 0xFF, 0xFF, 0xB0, 0xFF, 0xFA, 0x88, 0xFF, 0x96, 0x58, 0xFF, 0x36, 0x40, 0xFF, 0x1D, 0x81, 0xFF, 0xB9, 0x70, 0xFF, 0x3B, 0x91, 0xFF, 0x55, 0x50, 0xFF, 0x96, 0x58, 0xFF, 0x56, 0x58, 0xFF, 0x9B, 0x89, 0xFF, 0x32, 0x38, 0xFF, 0x11, 0x38, 0xFF, 0xB7, 0x60, 0xFF, 0x31, 0x38, 0xFF, 0xB5, 0x50, 0xFF, 0x30, 0x30, 0xFF, 0x30, 0x30, 0xFF, 0x51, 0x38, 0xFF, 0x93, 0x59, 0xFF, 0x93, 0x59, 0xFF, 0x72, 0x51, 0xFF, 0x73, 0x51, 0xFF, 0x31, 0x49, 0xFF, 0x31, 0x49, 0xFF, 0x50, 0x49, 0xFF, 0x51, 0x49, 0xFF, 0x30, 0x49, 0xFF, 0xEF, 0x40, 0xFF, 0xEF, 0x40, 0xFF, 0x0F, 0x41, 0xFF, 0x91, 0x59, 0xFF, 0x4F, 0x51, 0xFF, 0xCD, 0x38, 0xFF, 0x4F, 0x51, 0xFF,
-    0xB2, 0x69, 0xFF, 0x91, 0x61, 0xFF, 0xEF, 0x50, 0xFF, 0x0E, 0x49, 0xFF, 0x2F, 0x59, 0xFF, 0x6F, 0x61, 0xFF, 0x2E, 0x59, 0xFF, 0x0E, 0x61, 0xFF, 0x2F, 0x69, 0xFF, 0xCD, 0x50, 0xFF, 0xED, 0x58, 0xFF, 0x91, 0x81, 0xFF, 0x55, 0xAA, 0xFF, 0xAC, 0x48, 0xFF, 0xAC, 0x48, 0xFF, 0xCF, 0x70, 0xFF, 0xD3, 0x99, 0xFF, 0x11, 0x71, 0xFF, 0xEE, 0x60, 0xFF, 0xCF, 0x78, 0xFF, 0xD0, 0x80, 0xFF, 0x8D, 0x58, 0xFF, 0xF1, 0x80, 0xFF, 0x91, 0x90, 0xFF, 0x4E, 0x70, 0xFF, 0x8F, 0x60, 0xFF, 0x4E, 0x60, 0xFF, 0x32, 0x80, 0xFF, 0x58, 0xC0, 0xFF, 0xB5, 0xA8, 0xFF, 0x5B, 0xF8, 0xFF, 0x3F, 0xF9, 0xFF, 0xDA, 0xC0, 0xFF, 0x16, 0x88, 0xFF, 0x9A, 0xA8, 0xFF, 0x1F, 0xF9, 0xFF, 0x79, 0x90, 0xFF, 0x36, 0x70, 0xFF, 0x15, 0x70, 0xFF, 0xDF, 0xF0, 0xFF, 0x14, 0x68, 0xFF, 0x56, 0x70, 0xFF, 0x16, 0x60, 0xFF, 0x7D, 0xA8, 0xFF, 0x36, 0x68, 0xFF, 0x76, 0x68, 0xFF, 0x77, 0x70, 0xFF, 0x5F, 0x99, 0xFF, 0x35, 0x48, 0xFF, 0x34, 0x40, 0xFF, 0x7C, 0x70, 0xFF, 0xDA, 0x78, 0xFF, 0x33, 0x48, 0xFF, 0x12, 0x40, 0xFF, 0xB9, 0x68, 0xFF, 0xBA, 0x70, 0xFF, 0x10, 0x30, 0xFF, 0x92, 0x48, 0xFF, 0x31, 0x38, 0xFF, 0x52, 0x38, 0xFF, 0x31, 0x38, 0xFF, 0x30, 0x38, 0xFF, 0x0F, 0x30, 0xFF, 0x51, 0x38, 0xFF,
-    0xB2, 0x59, 0xFF, 0x72, 0x51, 0xFF, 0x92, 0x59, 0xFF, 0x51, 0x51, 0xFF, 0x51, 0x51, 0xFF, 0x30, 0x49, 0xFF, 0x30, 0x49, 0xFF, 0x30, 0x49, 0xFF, 0x0F, 0x41, 0xFF, 0x0F, 0x49, 0xFF, 0x0F, 0x41, 0xFF, 0xCD, 0x38, 0xFF, 0xED, 0x40, 0xFF, 0x4F, 0x51, 0xFF, 0xCD, 0x38, 0xFF, 0xED, 0x40, 0xFF, 0x2E, 0x49, 0xFF, 0x2E, 0x51, 0xFF, 0x0D, 0x51, 0xFF, 0xED, 0x50, 0xFF, 0xED, 0x50, 0xFF, 0x0D, 0x49, 0xFF, 0x0E, 0x59, 0xFF, 0x0F, 0x69, 0xFF, 0x2E, 0x61, 0xFF, 0xED, 0x58, 0xFF, 0x70, 0x71, 0xFF, 0x52, 0x99, 0xFF, 0x6C, 0x58, 0xFF, 0xEE, 0x60, 0xFF, 0xEF, 0x68, 0xFF, 0xF0, 0x80, 0xFF, 0x6D, 0x58, 0xFF, 0xF0, 0x78, 0xFF, 0x31, 0x91, 0xFF, 0x4D, 0x70, 0xFF, 0x91, 0x88, 0xFF, 0x8E, 0x68, 0xFF, 0xF6, 0xC8, 0xFF, 0x50, 0x80, 0xFF, 0xF5, 0x88, 0xFF, 0x8F, 0x68, 0xFF, 0x90, 0x78, 0xFF, 0x9C, 0xC8, 0xFF, 0x3E, 0xF1, 0xFF, 0x35, 0xC0, 0xFF, 0x1E, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xD8, 0xFF, 0x38, 0xA8, 0xFF, 0x1F, 0xFA, 0xFF, 0x9A, 0xB0, 0xFF, 0x58, 0xA8, 0xFF, 0xDF, 0xA0, 0xFF, 0x59, 0xA8, 0xFF, 0xB6, 0xA0, 0xFF, 0xDA, 0xB0, 0xFF, 0xDB, 0xC8, 0xFF, 0x54, 0x60, 0xFF, 0x7E, 0xEB, 0xFF, 0x1C, 0xA0, 0xFF, 0x16, 0x80, 0xFF, 0x54, 0xB0, 0xFF, 0x1A, 0x68, 0xFF,
-    0x57, 0x48, 0xFF, 0x34, 0x40, 0xFF, 0x58, 0x58, 0xFF, 0x17, 0x58, 0xFF, 0x35, 0x50, 0xFF, 0x94, 0x58, 0xFF, 0x93, 0x80, 0xFF, 0xB5, 0x90, 0xFF, 0x32, 0x38, 0xFF, 0xB6, 0x70, 0xFF, 0x30, 0x40, 0xFF, 0x51, 0x38, 0xFF, 0xDC, 0xE2, 0xFF, 0xB8, 0x89, 0xFF, 0x5A, 0xD2, 0xFF, 0x0E, 0x30, 0xFF, 0xD2, 0x61, 0xFF, 0xB2, 0x59, 0xFF, 0x91, 0x51, 0xFF, 0x70, 0x51, 0xFF, 0x70, 0x51, 0xFF, 0x50, 0x51, 0xFF, 0x2F, 0x49, 0xFF, 0xD0, 0x38, 0xFF, 0x0F, 0x49, 0xFF, 0x0E, 0x41, 0xFF, 0x0E, 0x41, 0xFF, 0xED, 0x40, 0xFF, 0x70, 0x59, 0xFF, 0x0E, 0x49, 0xFF, 0xCD, 0x40, 0xFF, 0xAB, 0x40, 0xFF, 0xEC, 0x40, 0xFF, 0xAC, 0x48, 0xFF, 0x0D, 0x51, 0xFF, 0xED, 0x50, 0xFF, 0xCC, 0x50, 0xFF, 0x2C, 0x51, 0xFF, 0x56, 0xC3, 0xFF, 0x4F, 0x71, 0xFF, 0x2E, 0x61, 0xFF, 0x0D, 0x59, 0xFF, 0xED, 0x68, 0xFF, 0x0D, 0x61, 0xFF, 0xEE, 0x68, 0xFF, 0xEC, 0x58, 0xFF, 0xAB, 0x50, 0xFF, 0xCC, 0x60, 0xFF, 0xED, 0x60, 0xFF, 0x4F, 0x79, 0xFF, 0x34, 0xC2, 0xFF, 0x0F, 0x79, 0xFF, 0xCD, 0x70, 0xFF, 0x6C, 0x60, 0xFF, 0xCF, 0x78, 0xFF, 0x76, 0xA1, 0xFF, 0xB0, 0x78, 0xFF, 0xAE, 0x68, 0xFF, 0x2F, 0x70, 0xFF, 0x72, 0x88, 0xFF, 0x97, 0xC8, 0xFF, 0xD4, 0xA8, 0xFF, 0xFE, 0xF9, 0xFF, 0x38, 0xD0, 0xFF,
-    0x54, 0x98, 0xFF, 0x3A, 0xD1, 0xFF, 0xD6, 0x98, 0xFF, 0xB7, 0x90, 0xFF, 0x34, 0x78, 0xFF, 0x33, 0x60, 0xFF, 0x95, 0x78, 0xFF, 0x13, 0x68, 0xFF, 0x93, 0x60, 0xFF, 0xD9, 0xA0, 0xFF, 0x96, 0x78, 0xFF, 0x33, 0x60, 0xFF, 0x9E, 0xB9, 0xFF, 0x75, 0x70, 0xFF, 0x54, 0x68, 0xFF, 0x73, 0x48, 0xFF, 0x32, 0x38, 0xFF, 0x52, 0x38, 0xFF, 0x5B, 0x80, 0xFF, 0x0F, 0x38, 0xFF, 0x10, 0x38, 0xFF, 0x10, 0x40, 0xFF, 0x51, 0x48, 0xFF, 0x54, 0x68, 0xFF, 0xF6, 0x70, 0xFF, 0x0F, 0x40, 0xFF, 0x70, 0x40, 0xFF, 0x70, 0x40, 0xFF, 0x70, 0x40, 0xFF, 0x96, 0x58, 0xFF, 0x8F, 0x40, 0xFF, 0x6F, 0x40, 0xFF, 0x32, 0x72, 0xFF, 0xD1, 0x61, 0xFF, 0x70, 0x59, 0xFF, 0x6F, 0x51, 0xFF, 0x96, 0x82, 0xFF, 0x15, 0x8B, 0xFF, 0x73, 0x7A, 0xFF, 0xEE, 0x40, 0xFF, 0xB6, 0x72, 0xFF, 0x98, 0x92, 0xFF, 0xD6, 0x8A, 0xFF, 0xED, 0x40, 0xFF, 0xB4, 0x82, 0xFF, 0x91, 0x51, 0xFF, 0x37, 0xBB, 0xFF, 0xD3, 0x9A, 0xFF, 0x76, 0xA3, 0xFF, 0xCB, 0x40, 0xFF, 0x91, 0x82, 0xFF, 0x4E, 0x81, 0xFF, 0xB5, 0xAA, 0xFF, 0x55, 0xB3, 0xFF, 0x92, 0xA2, 0xFF, 0xAA, 0x60, 0xFF, 0x31, 0xAA, 0xFF, 0x93, 0xCA, 0xFF, 0x4C, 0x71, 0xFF, 0xAA, 0x58, 0xFF, 0xAD, 0x91, 0xFF, 0x15, 0xC2, 0xFF, 0x17, 0xFB, 0xFF, 0xCC, 0x70, 0xFF,
-    0xCA, 0x68, 0xFF, 0x8E, 0x89, 0xFF, 0x31, 0xC1, 0xFF, 0x10, 0xB1, 0xFF, 0xED, 0x80, 0xFF, 0x8B, 0x68, 0xFF, 0x8C, 0x78, 0xFF, 0x17, 0xEA, 0xFF, 0x8E, 0x80, 0xFF, 0x8D, 0x80, 0xFF, 0xB0, 0x98, 0xFF, 0xD0, 0xC8, 0xFF, 0xF4, 0xE0, 0xFF, 0x92, 0xA0, 0xFF, 0x36, 0xB9, 0xFF, 0x53, 0x98, 0xFF, 0x94, 0xA0, 0xFF, 0xF8, 0xC8, 0xFF, 0x93, 0x80, 0xFF, 0x72, 0x68, 0xFF, 0xB5, 0x80, 0xFF, 0x76, 0x88, 0xFF, 0xD7, 0xA8, 0xFF, 0x33, 0x70, 0xFF, 0x92, 0x68, 0xFF, 0xB6, 0x70, 0xFF, 0x50, 0x58, 0xFF, 0xD8, 0xA0, 0xFF, 0x12, 0x58, 0xFF, 0x32, 0x58, 0xFF, 0xB6, 0x80, 0xFF, 0x78, 0x88, 0xFF, 0x11, 0x40, 0xFF, 0xD5, 0x60, 0xFF, 0x10, 0x48, 0xFF, 0x30, 0x48, 0xFF, 0x98, 0x88, 0xFF, 0x31, 0x48, 0xFF, 0x10, 0x48, 0xFF, 0x2F, 0x48, 0xFF, 0x2F, 0x38, 0xFF, 0x94, 0x68, 0xFF, 0x2E, 0x30, 0xFF, 0xD3, 0x60, 0xFF, 0xB4, 0x58, 0xFF, 0x71, 0x40, 0xFF, 0x55, 0x60, 0xFF, 0xAF, 0x40, 0xFF, 0xF1, 0x69, 0xFF, 0xD1, 0x61, 0xFF, 0xB0, 0x61, 0xFF, 0x4E, 0x49, 0xFF, 0xD0, 0x61, 0xFF, 0x8F, 0x59, 0xFF, 0x8F, 0x59, 0xFF, 0x8F, 0x59, 0xFF, 0x6E, 0x51, 0xFF, 0x4D, 0x51, 0xFF, 0x4D, 0x49, 0xFF, 0x2C, 0x49, 0xFF, 0x31, 0x72, 0xFF, 0xF0, 0x69, 0xFF, 0x4D, 0x51, 0xFF, 0xAE, 0x59, 0xFF,
-    0xEF, 0x69, 0xFF, 0xCF, 0x69, 0xFF, 0xB5, 0xAB, 0xFF, 0x2B, 0x51, 0xFF, 0xEE, 0x79, 0xFF, 0xEF, 0x81, 0xFF, 0xAE, 0x79, 0xFF, 0x71, 0x92, 0xFF, 0xCE, 0x81, 0xFF, 0x8F, 0x81, 0xFF, 0x91, 0x9A, 0xFF, 0x8E, 0x99, 0xFF, 0xD0, 0xA1, 0xFF, 0x70, 0xA2, 0xFF, 0xED, 0x89, 0xFF, 0xF6, 0xFA, 0xFF, 0xD2, 0xC9, 0xFF, 0x0D, 0xA9, 0xFF, 0x8D, 0xA1, 0xFF, 0xEF, 0xC0, 0xFF, 0xD5, 0xE9, 0xFF, 0x2E, 0xA1, 0xFF, 0x2F, 0xB9, 0xFF, 0x4F, 0xC0, 0xFF, 0xD4, 0xE9, 0xFF, 0x4B, 0x78, 0xFF, 0x8F, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xF8, 0xFF, 0xB1, 0xB0, 0xFF, 0x37, 0xE1, 0xFF, 0x5F, 0xF9, 0xFF, 0x95, 0xD0, 0xFF, 0xF5, 0xB0, 0xFF, 0x58, 0xE1, 0xFF, 0x5F, 0xF9, 0xFF, 0x55, 0xA0, 0xFF, 0x76, 0x90, 0xFF, 0x95, 0xA8, 0xFF, 0x38, 0x98, 0xFF, 0xF7, 0xC0, 0xFF, 0xF6, 0x90, 0xFF, 0x55, 0x80, 0xFF, 0x3E, 0xA9, 0xFF, 0x34, 0x60, 0xFF, 0x55, 0x70, 0xFF, 0xD9, 0x80, 0xFF, 0x7B, 0x70, 0xFF, 0x34, 0x50, 0xFF, 0x54, 0x48, 0xFF, 0x74, 0x58, 0xFF, 0x32, 0x48, 0xFF, 0x93, 0x58, 0xFF, 0x74, 0x58, 0xFF, 0xB4, 0x60, 0xFF, 0x33, 0x71, 0xFF, 0x31, 0x38, 0xFF, 0x53, 0x48, 0xFF, 0x71, 0x40, 0xFF, 0x91, 0x40, 0xFF, 0x4F, 0x38, 0xFF, 0x2E, 0x30, 0xFF, 0x50, 0x38, 0xFF, 0x4E, 0x30, 0xFF,
-    0xF1, 0x61, 0xFF, 0xD0, 0x61, 0xFF, 0xD0, 0x61, 0xFF, 0x4D, 0x51, 0xFF, 0x8F, 0x59, 0xFF, 0x6E, 0x51, 0xFF, 0x4D, 0x51, 0xFF, 0x6E, 0x51, 0xFF, 0x4D, 0x51, 0xFF, 0x2C, 0x49, 0xFF, 0x0C, 0x49, 0xFF, 0xCF, 0x69, 0xFF, 0x2C, 0x49, 0xFF, 0x2B, 0x49, 0xFF, 0x2B, 0x49, 0xFF, 0x2B, 0x49, 0xFF, 0x4C, 0x51, 0xFF, 0x0A, 0x49, 0xFF, 0x2A, 0x49, 0xFF, 0x2A, 0x51, 0xFF, 0x2A, 0x51, 0xFF, 0x0A, 0x51, 0xFF, 0x2B, 0x59, 0xFF, 0x6C, 0x71, 0xFF, 0x4B, 0x69, 0xFF, 0x4B, 0x61, 0xFF, 0x4B, 0x69, 0xFF, 0x2B, 0x69, 0xFF, 0xE9, 0x60, 0xFF, 0xEA, 0x60, 0xFF, 0x0A, 0x61, 0xFF, 0x89, 0x68, 0xFF, 0x0B, 0x69, 0xFF, 0xAE, 0x99, 0xFF, 0x0B, 0x81, 0xFF, 0x6D, 0x91, 0xFF, 0xCB, 0x88, 0xFF, 0xCC, 0x78, 0xFF, 0xEC, 0x90, 0xFF, 0xED, 0x88, 0xFF, 0xAC, 0x70, 0xFF, 0xAC, 0x80, 0xFF, 0xAF, 0xA8, 0xFF, 0x71, 0xF8, 0xFF, 0x76, 0xF9, 0xFF, 0xF0, 0xA0, 0xFF, 0x13, 0xB1, 0xFF, 0x70, 0x88, 0xFF, 0xB0, 0x80, 0xFF, 0x13, 0x99, 0xFF, 0x0F, 0x70, 0xFF, 0x2F, 0x68, 0xFF, 0x95, 0xA1, 0xFF, 0x70, 0x60, 0xFF, 0x0F, 0x70, 0xFF, 0xF3, 0x88, 0xFF, 0x0F, 0x58, 0xFF, 0x35, 0x99, 0xFF, 0x6F, 0x60, 0xFF, 0x70, 0x70, 0xFF, 0xB1, 0x70, 0xFF, 0xD3, 0x78, 0xFF, 0xD2, 0x78, 0xFF, 0x4F, 0x40, 0xFF,
-    0x4F, 0x38, 0xFF, 0x4F, 0x38, 0xFF, 0x6F, 0x48, 0xFF, 0xF1, 0x68, 0xFF, 0x2E, 0x40, 0xFF, 0x70, 0x58, 0xFF, 0xD0, 0x58, 0xFF, 0xF0, 0x60, 0xFF, 0x4D, 0x38, 0xFF, 0x2D, 0x38, 0xFF, 0x2C, 0x38, 0xFF, 0x2C, 0x38, 0xFF, 0x4D, 0x38, 0xFF, 0x4D, 0x38, 0xFF, 0x4D, 0x30, 0xFF, 0x6C, 0x30, 0xFF, 0x10, 0x6A, 0xFF, 0xD0, 0x61, 0xFF, 0xAF, 0x61, 0xFF, 0x4C, 0x51, 0xFF, 0x8E, 0x59, 0xFF, 0x6D, 0x51, 0xFF, 0x8E, 0x59, 0xFF, 0x6D, 0x51, 0xFF, 0x6D, 0x51, 0xFF, 0x4C, 0x51, 0xFF, 0x4C, 0x51, 0xFF, 0x4C, 0x51, 0xFF, 0x2B, 0x49, 0xFF, 0x2B, 0x51, 0xFF, 0xAD, 0x61, 0xFF, 0x2B, 0x49, 0xFF, 0x0B, 0x49, 0xFF, 0x4B, 0x59, 0xFF, 0x2A, 0x49, 0xFF, 0x4A, 0x51, 0xFF, 0x2A, 0x51, 0xFF, 0x2A, 0x51, 0xFF, 0x4B, 0x61, 0xFF, 0x6C, 0x71, 0xFF, 0x0A, 0x61, 0xFF, 0x4B, 0x69, 0xFF, 0x6B, 0x71, 0xFF, 0x4B, 0x71, 0xFF, 0x2A, 0x69, 0xFF, 0x2A, 0x71, 0xFF, 0x0A, 0x61, 0xFF, 0x2A, 0x79, 0xFF, 0x0A, 0x71, 0xFF, 0xAD, 0x99, 0xFF, 0x4C, 0x91, 0xFF, 0x2C, 0x91, 0xFF, 0x4D, 0xA1, 0xFF, 0xEB, 0x88, 0xFF, 0x0C, 0x91, 0xFF, 0x0D, 0x91, 0xFF, 0xCC, 0x70, 0xFF, 0x6A, 0x60, 0xFF, 0x55, 0xEA, 0xFF, 0x8D, 0x90, 0xFF, 0x13, 0xC1, 0xFF, 0x6F, 0x88, 0xFF, 0xAF, 0x88, 0xFF, 0xAF, 0x80, 0xFF,
-    0xB0, 0x80, 0xFF, 0x6F, 0x70, 0xFF, 0x6F, 0x70, 0xFF, 0x2D, 0x58, 0xFF, 0xD1, 0x78, 0xFF, 0x6F, 0x60, 0xFF, 0x90, 0x70, 0xFF, 0xD1, 0x78, 0xFF, 0x8F, 0x68, 0xFF, 0x2F, 0x50, 0xFF, 0xAF, 0x68, 0xFF, 0xD0, 0x68, 0xFF, 0x2F, 0x48, 0xFF, 0xD0, 0x68, 0xFF, 0x2E, 0x50, 0xFF, 0xB0, 0x58, 0xFF, 0x6E, 0x40, 0xFF, 0x4E, 0x38, 0xFF, 0x2C, 0x40, 0xFF, 0xF0, 0x60, 0xFF, 0x6E, 0x48, 0xFF, 0x6D, 0x48, 0xFF, 0x4D, 0x40, 0xFF, 0x4D, 0x40, 0xFF, 0x2C, 0x30, 0xFF, 0x4C, 0x38, 0xFF, 0x8D, 0x48, 0xFF, 0xCE, 0x48, 0xFF, 0x4C, 0x30, 0xFF, 0x4C, 0x30, 0xFF, 0x4C, 0x30, 0xFF, 0x6B, 0x30, 0xFF, 0xEF, 0x61, 0xFF, 0xEF, 0x61, 0xFF, 0xCF, 0x61, 0xFF, 0x6D, 0x51, 0xFF, 0xCE, 0x59, 0xFF, 0x2B, 0x41, 0xFF, 0x8D, 0x59, 0xFF, 0x6D, 0x51, 0xFF, 0x6C, 0x51, 0xFF, 0x6C, 0x51, 0xFF, 0x6C, 0x59, 0xFF, 0x4B, 0x49, 0xFF, 0x2B, 0x49, 0xFF, 0x6C, 0x51, 0xFF, 0x8C, 0x61, 0xFF, 0x4B, 0x51, 0xFF, 0x4A, 0x51, 0xFF, 0x8B, 0x59, 0xFF, 0x09, 0x49, 0xFF, 0x4A, 0x51, 0xFF, 0x4A, 0x59, 0xFF, 0x4A, 0x59, 0xFF, 0x4A, 0x59, 0xFF, 0x8C, 0x71, 0xFF, 0x29, 0x61, 0xFF, 0x8C, 0x71, 0xFF, 0xAC, 0x81, 0xFF, 0x8B, 0x79, 0xFF, 0x29, 0x69, 0xFF, 0x29, 0x71, 0xFF, 0x29, 0x69, 0xFF, 0x0A, 0x79, 0xFF,
-    0xE9, 0x78, 0xFF, 0x6C, 0x99, 0xFF, 0x8C, 0x89, 0xFF, 0x2B, 0xA9, 0xFF, 0xAE, 0xF9, 0xFF, 0x2B, 0xA9, 0xFF, 0x2C, 0x99, 0xFF, 0xEB, 0x88, 0xFF, 0xAC, 0x78, 0xFF, 0xAB, 0x68, 0xFF, 0x8D, 0x78, 0xFF, 0xAD, 0x88, 0xFF, 0xCE, 0x98, 0xFF, 0x8D, 0x78, 0xFF, 0xAF, 0x88, 0xFF, 0x6E, 0x70, 0xFF, 0x6E, 0x80, 0xFF, 0x8E, 0x70, 0xFF, 0xF0, 0x80, 0xFF, 0x4D, 0x58, 0xFF, 0x6E, 0x68, 0xFF, 0x6F, 0x58, 0xFF, 0x94, 0x91, 0xFF, 0x8F, 0x68, 0xFF, 0xAF, 0x68, 0xFF, 0x50, 0x48, 0xFF, 0x11, 0x71, 0xFF, 0xCF, 0x60, 0xFF, 0x8F, 0x48, 0xFF, 0xF0, 0x68, 0xFF, 0x2D, 0x48, 0xFF, 0x6E, 0x50, 0xFF, 0x4E, 0x38, 0xFF, 0x4E, 0x38, 0xFF, 0x2D, 0x38, 0xFF, 0x10, 0x69, 0xFF, 0x10, 0x59, 0xFF, 0x0B, 0x38, 0xFF, 0x2C, 0x38, 0xFF, 0x0C, 0x30, 0xFF, 0x4D, 0x38, 0xFF, 0x4C, 0x30, 0xFF, 0xEE, 0x50, 0xFF, 0xCD, 0x48, 0xFF, 0x6C, 0x38, 0xFF, 0x6C, 0x30, 0xFF, 0x4C, 0x30, 0xFF, 0x4B, 0x30, 0xFF, 0x50, 0x6A, 0xFF, 0xD3, 0x82, 0xFF, 0x0F, 0x62, 0xFF, 0xAE, 0x59, 0xFF, 0xD1, 0x82, 0xFF, 0xB5, 0xAB, 0xFF, 0x78, 0xA3, 0xFF, 0x97, 0xB3, 0xFF, 0x6D, 0x51, 0xFF, 0x34, 0x9B, 0xFF, 0x50, 0x72, 0xFF, 0xF2, 0x7A, 0xFF, 0x78, 0xAB, 0xFF, 0xCF, 0x69, 0xFF, 0x55, 0xB3, 0xFF, 0xAD, 0x71, 0xFF,
-    0x8F, 0x82, 0xFF, 0x57, 0xAB, 0xFF, 0x15, 0xBC, 0xFF, 0x16, 0xEC, 0xFF, 0x92, 0xDB, 0xFF, 0x4D, 0x92, 0xFF, 0x93, 0xC3, 0xFF, 0x75, 0xBB, 0xFF, 0xF9, 0xEC, 0xFF, 0xD5, 0xEB, 0xFF, 0x8B, 0x81, 0xFF, 0x6A, 0x91, 0xFF, 0xF1, 0xCA, 0xFF, 0x74, 0xDB, 0xFF, 0x92, 0xEB, 0xFF, 0x9A, 0xFD, 0xFF, 0xB2, 0xF2, 0xFF, 0x0A, 0x91, 0xFF, 0x5A, 0xFC, 0xFF, 0x2C, 0xD1, 0xFF, 0xDF, 0xFF, 0xFF, 0xCC, 0xB8, 0xFF, 0xB0, 0xC2, 0xFF, 0xB1, 0xA9, 0xFF, 0x8D, 0xC8, 0xFF, 0xCC, 0x68, 0xFF, 0xAC, 0x68, 0xFF, 0xCC, 0x80, 0xFF, 0xF8, 0xE9, 0xFF, 0x2E, 0x81, 0xFF, 0x4C, 0x80, 0xFF, 0xD2, 0xB0, 0xFF, 0x4D, 0x70, 0xFF, 0x79, 0xDA, 0xFF, 0x94, 0xA1, 0xFF, 0x6F, 0x70, 0xFF, 0x0D, 0x68, 0xFF, 0x2D, 0x58, 0xFF, 0x14, 0x99, 0xFF, 0x13, 0x89, 0xFF, 0x53, 0x81, 0xFF, 0x17, 0x99, 0xFF, 0x77, 0x99, 0xFF, 0x90, 0x68, 0xFF, 0x97, 0x99, 0xFF, 0x55, 0x89, 0xFF, 0x14, 0x79, 0xFF, 0xD8, 0x78, 0xFF, 0x35, 0x81, 0xFF, 0xF5, 0x70, 0xFF, 0xF3, 0x78, 0xFF, 0x70, 0x48, 0xFF, 0xD4, 0x68, 0xFF, 0x15, 0x71, 0xFF, 0x13, 0x69, 0xFF, 0x4D, 0x38, 0xFF, 0xD3, 0x58, 0xFF, 0xAF, 0x48, 0xFF, 0x8D, 0x40, 0xFF, 0xD4, 0x70, 0xFF, 0xB3, 0x60, 0xFF, 0x91, 0x58, 0xFF, 0x4F, 0x48, 0xFF, 0xCF, 0x48, 0xFF,
-    0x2F, 0x6A, 0xFF, 0x2F, 0x6A, 0xFF, 0x0E, 0x62, 0xFF, 0x0E, 0x62, 0xFF, 0xED, 0x59, 0xFF, 0xCC, 0x59, 0xFF, 0x8C, 0x51, 0xFF, 0x8C, 0x51, 0xFF, 0xAC, 0x59, 0xFF, 0x6B, 0x51, 0xFF, 0x8C, 0x51, 0xFF, 0x6B, 0x51, 0xFF, 0x6B, 0x51, 0xFF, 0x8B, 0x59, 0xFF, 0xCB, 0x61, 0xFF, 0x6A, 0x51, 0xFF, 0x8A, 0x59, 0xFF, 0x8A, 0x51, 0xFF, 0x6A, 0x51, 0xFF, 0x6A, 0x51, 0xFF, 0x89, 0x59, 0xFF, 0x8A, 0x61, 0xFF, 0xAA, 0x69, 0xFF, 0xAB, 0x71, 0xFF, 0xCB, 0x71, 0xFF, 0xCA, 0x71, 0xFF, 0x0B, 0x82, 0xFF, 0xAA, 0x79, 0xFF, 0xAA, 0x81, 0xFF, 0xAE, 0xAA, 0xFF, 0xEC, 0x91, 0xFF, 0xCB, 0xA1, 0xFF, 0x8B, 0x89, 0xFF, 0x2A, 0x91, 0xFF, 0x8B, 0x89, 0xFF, 0x6B, 0x99, 0xFF, 0x6B, 0xA9, 0xFF, 0x0A, 0x91, 0xFF, 0x2A, 0x81, 0xFF, 0xEA, 0x78, 0xFF, 0xEB, 0x70, 0xFF, 0xAC, 0x60, 0xFF, 0xAC, 0x68, 0xFF, 0xCC, 0x68, 0xFF, 0xED, 0x80, 0xFF, 0x8B, 0x68, 0xFF, 0x6C, 0x70, 0xFF, 0x0E, 0x79, 0xFF, 0xAC, 0x60, 0xFF, 0xAD, 0x60, 0xFF, 0x70, 0x79, 0xFF, 0xAC, 0x58, 0xFF, 0xCE, 0x68, 0xFF, 0x8D, 0x68, 0xFF, 0x50, 0x79, 0xFF, 0x8D, 0x58, 0xFF, 0x0E, 0x71, 0xFF, 0x6E, 0x48, 0xFF, 0x6C, 0x50, 0xFF, 0x8C, 0x58, 0xFF, 0x6E, 0x40, 0xFF, 0xAD, 0x50, 0xFF, 0xAD, 0x48, 0xFF, 0x6C, 0x40, 0xFF,
-    0xAD, 0x40, 0xFF, 0x6D, 0x38, 0xFF, 0x0E, 0x51, 0xFF, 0x6C, 0x38, 0xFF, 0x8C, 0x40, 0xFF, 0xAD, 0x40, 0xFF, 0x4C, 0x38, 0xFF, 0x6D, 0x30, 0xFF, 0x4F, 0x51, 0xFF, 0xAC, 0x40, 0xFF, 0x4B, 0x30, 0xFF, 0x6A, 0x30, 0xFF, 0x4A, 0x28, 0xFF, 0x6B, 0x30, 0xFF, 0x6B, 0x28, 0xFF, 0x4E, 0x51, 0xFF, 0x6F, 0x72, 0xFF, 0x4E, 0x6A, 0xFF, 0x2E, 0x6A, 0xFF, 0x4E, 0x6A, 0xFF, 0xED, 0x61, 0xFF, 0xCC, 0x59, 0xFF, 0xED, 0x61, 0xFF, 0xAC, 0x59, 0xFF, 0xAC, 0x59, 0xFF, 0xAB, 0x59, 0xFF, 0x8B, 0x59, 0xFF, 0x8A, 0x51, 0xFF, 0x8B, 0x59, 0xFF, 0xCB, 0x61, 0xFF, 0x8A, 0x59, 0xFF, 0xCB, 0x61, 0xFF, 0xAA, 0x61, 0xFF, 0x8A, 0x59, 0xFF, 0x89, 0x51, 0xFF, 0x89, 0x59, 0xFF, 0xEA, 0x69, 0xFF, 0xAA, 0x69, 0xFF, 0xEB, 0x79, 0xFF, 0xCB, 0x71, 0xFF, 0xEB, 0x79, 0xFF, 0xCB, 0x71, 0xFF, 0x0B, 0x82, 0xFF, 0xAA, 0x81, 0xFF, 0x2C, 0x92, 0xFF, 0x0B, 0x92, 0xFF, 0xAA, 0x89, 0xFF, 0x2C, 0xB2, 0xFF, 0x2C, 0xBA, 0xFF, 0x6A, 0x99, 0xFF, 0x8A, 0x89, 0xFF, 0xAB, 0x91, 0xFF, 0x8B, 0x91, 0xFF, 0x2A, 0x79, 0xFF, 0x2A, 0x79, 0xFF, 0x2A, 0x71, 0xFF, 0x0B, 0x69, 0xFF, 0xCB, 0x60, 0xFF, 0xCC, 0x68, 0xFF, 0xCC, 0x68, 0xFF, 0x0C, 0x81, 0xFF, 0xAB, 0x68, 0xFF, 0xAC, 0x68, 0xFF, 0xED, 0x70, 0xFF,
-    0xED, 0x68, 0xFF, 0xAC, 0x60, 0xFF, 0x2E, 0x79, 0xFF, 0x8C, 0x68, 0xFF, 0xF1, 0x91, 0xFF, 0x0D, 0x69, 0xFF, 0xCE, 0x60, 0xFF, 0x6C, 0x50, 0xFF, 0x4F, 0x71, 0xFF, 0x8E, 0x50, 0xFF, 0x8B, 0x48, 0xFF, 0xAC, 0x58, 0xFF, 0x8D, 0x48, 0xFF, 0xAD, 0x50, 0xFF, 0xF2, 0x79, 0xFF, 0x90, 0x69, 0xFF, 0x8C, 0x38, 0xFF, 0x6C, 0x30, 0xFF, 0xCD, 0x48, 0xFF, 0x6B, 0x38, 0xFF, 0x2A, 0x30, 0xFF, 0xAC, 0x40, 0xFF, 0x8C, 0x38, 0xFF, 0x6C, 0x30, 0xFF, 0x8C, 0x38, 0xFF, 0x2D, 0x49, 0xFF, 0x6B, 0x30, 0xFF, 0x6B, 0x30, 0xFF, 0x4A, 0x30, 0xFF, 0x0D, 0x49, 0xFF, 0x6B, 0x28, 0xFF, 0x6A, 0x28, 0xFF, 0xAF, 0x7A, 0xFF, 0x8E, 0x72, 0xFF, 0x4E, 0x6A, 0xFF, 0x2D, 0x6A, 0xFF, 0x0D, 0x6A, 0xFF, 0xED, 0x61, 0xFF, 0xED, 0x61, 0xFF, 0xEC, 0x61, 0xFF, 0x6A, 0x51, 0xFF, 0xAB, 0x69, 0xFF, 0x6A, 0x51, 0xFF, 0x8B, 0x59, 0xFF, 0x0C, 0x72, 0xFF, 0xCB, 0x69, 0xFF, 0x8A, 0x59, 0xFF, 0xEB, 0x69, 0xFF, 0xEB, 0x69, 0xFF, 0x0C, 0x6A, 0xFF, 0xCA, 0x61, 0xFF, 0x4D, 0x72, 0xFF, 0x0B, 0x7A, 0xFF, 0x2C, 0x82, 0xFF, 0xEB, 0x79, 0xFF, 0xEB, 0x79, 0xFF, 0x6D, 0x92, 0xFF, 0xAA, 0x71, 0xFF, 0x8E, 0xAA, 0xFF, 0xCB, 0x89, 0xFF, 0xAE, 0xAA, 0xFF, 0xCE, 0xBA, 0xFF, 0x2C, 0xBA, 0xFF, 0x91, 0xFB, 0xFF,
-    0xD1, 0xFB, 0xFF, 0x4D, 0xD2, 0xFF, 0xCB, 0xA1, 0xFF, 0xCC, 0xA1, 0xFF, 0xCC, 0x99, 0xFF, 0x2A, 0x79, 0xFF, 0x29, 0x81, 0xFF, 0x6B, 0x81, 0xFF, 0x91, 0x99, 0xFF, 0xCB, 0x60, 0xFF, 0xCC, 0x60, 0xFF, 0x2F, 0x89, 0xFF, 0xEC, 0x78, 0xFF, 0xAB, 0x60, 0xFF, 0x70, 0x99, 0xFF, 0xCD, 0x70, 0xFF, 0xAB, 0x60, 0xFF, 0x6C, 0x60, 0xFF, 0x10, 0x79, 0xFF, 0x4E, 0x79, 0xFF, 0xD1, 0x89, 0xFF, 0xD0, 0x89, 0xFF, 0x4B, 0x50, 0xFF, 0x6D, 0x50, 0xFF, 0xF6, 0xB2, 0xFF, 0x51, 0x58, 0xFF, 0x6C, 0x50, 0xFF, 0x2E, 0x69, 0xFF, 0xD2, 0x58, 0xFF, 0x8D, 0x50, 0xFF, 0xCE, 0x50, 0xFF, 0xAF, 0x50, 0xFF, 0xAF, 0x48, 0xFF, 0x8F, 0x40, 0xFF, 0xCE, 0x58, 0xFF, 0x0A, 0x38, 0xFF, 0x2B, 0x30, 0xFF, 0x0A, 0x30, 0xFF, 0x8F, 0x69, 0xFF, 0x4C, 0x30, 0xFF, 0x2B, 0x30, 0xFF, 0x2C, 0x59, 0xFF, 0x6B, 0x30, 0xFF, 0xAC, 0x30, 0xFF, 0x4B, 0x30, 0xFF, 0x6C, 0x61, 0xFF, 0x8B, 0x30, 0xFF, 0x49, 0x28, 0xFF, 0xCF, 0x82, 0xFF, 0xAF, 0x7A, 0xFF, 0x6D, 0x6A, 0xFF, 0x4C, 0x6A, 0xFF, 0x2D, 0x6A, 0xFF, 0x6D, 0x72, 0xFF, 0x0C, 0x62, 0xFF, 0x4D, 0x72, 0xFF, 0x8A, 0x69, 0xFF, 0xEB, 0x61, 0xFF, 0x30, 0x8B, 0xFF, 0xCE, 0x82, 0xFF, 0x6D, 0x7A, 0xFF, 0x74, 0xBC, 0xFF, 0x71, 0x9B, 0xFF, 0xAE, 0x92, 0xFF,
-    0xCA, 0x69, 0xFF, 0x0E, 0x93, 0xFF, 0x74, 0xCC, 0xFF, 0x90, 0xA3, 0xFF, 0x8D, 0x8A, 0xFF, 0x8C, 0x9A, 0xFF, 0x4B, 0xAA, 0xFF, 0x92, 0xDB, 0xFF, 0x8D, 0xA2, 0xFF, 0xEA, 0x81, 0xFF, 0x7A, 0xFE, 0xFF, 0x55, 0xF5, 0xFF, 0xAF, 0xE3, 0xFF, 0x0F, 0xD3, 0xFF, 0x2C, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x0B, 0xDA, 0xFF, 0x11, 0xEB, 0xFF, 0xAB, 0xD9, 0xFF, 0xD0, 0xEA, 0xFF, 0x29, 0x69, 0xFF, 0x28, 0x99, 0xFF, 0x30, 0xEA, 0xFF, 0xA9, 0x80, 0xFF, 0xEC, 0x60, 0xFF, 0x0C, 0x61, 0xFF, 0x0C, 0xA1, 0xFF, 0x75, 0xF9, 0xFF, 0xCB, 0x60, 0xFF, 0x4D, 0x71, 0xFF, 0xCF, 0x99, 0xFF, 0x6E, 0xA0, 0xFF, 0xCC, 0x58, 0xFF, 0xAB, 0x58, 0xFF, 0xCB, 0x78, 0xFF, 0xD7, 0xC9, 0xFF, 0x51, 0x81, 0xFF, 0x8C, 0x48, 0xFF, 0xAE, 0x60, 0xFF, 0x6E, 0x68, 0xFF, 0xF5, 0xA0, 0xFF, 0x4B, 0x48, 0xFF, 0x2F, 0x71, 0xFF, 0x16, 0x79, 0xFF, 0x55, 0x89, 0xFF, 0x4C, 0x40, 0xFF, 0x4F, 0x48, 0xFF, 0x16, 0x79, 0xFF, 0xF3, 0x60, 0xFF, 0x33, 0x71, 0xFF, 0x6E, 0x48, 0xFF, 0x4F, 0x48, 0xFF, 0xD3, 0x68, 0xFF, 0xF1, 0x60, 0xFF, 0x4D, 0x38, 0xFF, 0xB1, 0x50, 0xFF, 0xAF, 0x50, 0xFF, 0x4C, 0x38, 0xFF, 0xF3, 0x48, 0xFF, 0x4C, 0x28, 0xFF, 0x8C, 0x30, 0xFF, 0x8C, 0x30, 0xFF, 0x8B, 0x30, 0xFF,
-    0x6D, 0x72, 0xFF, 0x51, 0x8B, 0xFF, 0x6D, 0x6A, 0xFF, 0x74, 0xAC, 0xFF, 0x8E, 0x72, 0xFF, 0xF2, 0x9B, 0xFF, 0xCB, 0x59, 0xFF, 0xF4, 0xB3, 0xFF, 0xEB, 0x69, 0xFF, 0x6D, 0x7A, 0xFF, 0x13, 0xBC, 0xFF, 0xAB, 0x59, 0xFF, 0xB3, 0xBB, 0xFF, 0xF6, 0xE4, 0xFF, 0x0E, 0x9B, 0xFF, 0x36, 0xFD, 0xFF, 0x6C, 0x7A, 0xFF, 0xD2, 0xBB, 0xFF, 0xF3, 0xCB, 0xFF, 0x78, 0xFD, 0xFF, 0xB7, 0xE5, 0xFF, 0x8C, 0x92, 0xFF, 0x2A, 0x82, 0xFF, 0x34, 0xEC, 0xFF, 0xD6, 0xF4, 0xFF, 0x7D, 0xFF, 0xFF, 0x8C, 0x9A, 0xFF, 0x4B, 0x9A, 0xFF, 0x94, 0xDB, 0xFF, 0x94, 0xEB, 0xFF, 0x0A, 0xB2, 0xFF, 0x2F, 0xFB, 0xFF, 0xAD, 0xF2, 0xFF, 0x6D, 0xCA, 0xFF, 0x3B, 0xFF, 0xFF, 0x8A, 0x89, 0xFF, 0xCB, 0x89, 0xFF, 0x2A, 0x69, 0xFF, 0x8A, 0x81, 0xFF, 0x73, 0xC2, 0xFF, 0x49, 0x69, 0xFF, 0xEB, 0x60, 0xFF, 0xEB, 0x58, 0xFF, 0x0B, 0x69, 0xFF, 0x16, 0xF2, 0xFF, 0xAA, 0x58, 0xFF, 0x6D, 0x79, 0xFF, 0x0C, 0x69, 0xFF, 0xCB, 0x60, 0xFF, 0x53, 0xD1, 0xFF, 0x92, 0xA1, 0xFF, 0x89, 0x50, 0xFF, 0x0C, 0x59, 0xFF, 0x8E, 0x69, 0xFF, 0x37, 0xDA, 0xFF, 0x12, 0x99, 0xFF, 0x8A, 0x48, 0xFF, 0x8C, 0x48, 0xFF, 0xAB, 0x58, 0xFF, 0x54, 0x91, 0xFF, 0x33, 0x81, 0xFF, 0x51, 0x71, 0xFF, 0x8B, 0x38, 0xFF, 0x0D, 0x51, 0xFF,
-    0x14, 0x79, 0xFF, 0x4D, 0x48, 0xFF, 0xF4, 0x88, 0xFF, 0x2F, 0x59, 0xFF, 0x6E, 0x59, 0xFF, 0x13, 0x79, 0xFF, 0x14, 0x79, 0xFF, 0x2B, 0x30, 0xFF, 0xB5, 0x68, 0xFF, 0x4A, 0x30, 0xFF, 0xCF, 0x58, 0xFF, 0x31, 0x59, 0xFF, 0x4D, 0x40, 0xFF, 0xF4, 0x81, 0xFF, 0x8E, 0x40, 0xFF, 0xB2, 0x50, 0xFF, 0x8D, 0x6A, 0xFF, 0xCE, 0x72, 0xFF, 0x8D, 0x72, 0xFF, 0x6C, 0x6A, 0xFF, 0x2C, 0x62, 0xFF, 0x2C, 0x62, 0xFF, 0x6D, 0x72, 0xFF, 0x0B, 0x6A, 0xFF, 0xEA, 0x59, 0xFF, 0x2B, 0x72, 0xFF, 0xCB, 0x59, 0xFF, 0xEA, 0x59, 0xFF, 0xED, 0x8A, 0xFF, 0xED, 0x82, 0xFF, 0x0A, 0x6A, 0xFF, 0x09, 0x62, 0xFF, 0x2A, 0x6A, 0xFF, 0x4C, 0x72, 0xFF, 0x2B, 0x6A, 0xFF, 0x2A, 0x72, 0xFF, 0x6B, 0x82, 0xFF, 0xAC, 0x92, 0xFF, 0x8B, 0x8A, 0xFF, 0x6B, 0x8A, 0xFF, 0xAC, 0x9A, 0xFF, 0x2A, 0x82, 0xFF, 0x8B, 0x9A, 0xFF, 0xED, 0xB2, 0xFF, 0x2D, 0xCB, 0xFF, 0xEC, 0xBA, 0xFF, 0xAD, 0xB2, 0xFF, 0xCD, 0xC2, 0xFF, 0x8A, 0xB2, 0xFF, 0xCA, 0x99, 0xFF, 0x89, 0x81, 0xFF, 0xCA, 0x81, 0xFF, 0x8D, 0x9A, 0xFF, 0x29, 0x69, 0xFF, 0x48, 0x71, 0xFF, 0x29, 0x61, 0xFF, 0x6D, 0x79, 0xFF, 0xCA, 0x58, 0xFF, 0x0B, 0x61, 0xFF, 0xEC, 0x60, 0xFF, 0x0A, 0x69, 0xFF, 0xCA, 0x58, 0xFF, 0x50, 0x92, 0xFF, 0xEB, 0x60, 0xFF,
-    0xCB, 0x50, 0xFF, 0xCF, 0x81, 0xFF, 0xAB, 0x50, 0xFF, 0x0A, 0x59, 0xFF, 0x6D, 0x69, 0xFF, 0xED, 0x60, 0xFF, 0xAB, 0x48, 0xFF, 0xEC, 0x58, 0xFF, 0x4A, 0x48, 0xFF, 0x6C, 0x40, 0xFF, 0x8E, 0x69, 0xFF, 0x0D, 0x59, 0xFF, 0x6B, 0x38, 0xFF, 0x6B, 0x38, 0xFF, 0xCC, 0x48, 0xFF, 0x2E, 0x59, 0xFF, 0xCB, 0x40, 0xFF, 0xAA, 0x40, 0xFF, 0x4A, 0x40, 0xFF, 0x71, 0x82, 0xFF, 0x10, 0x7A, 0xFF, 0x6B, 0x30, 0xFF, 0x4A, 0x28, 0xFF, 0x4A, 0x28, 0xFF, 0x6A, 0x28, 0xFF, 0xA9, 0x48, 0xFF, 0xAE, 0x59, 0xFF, 0x6A, 0x28, 0xFF, 0x8C, 0x59, 0xFF, 0x6A, 0x28, 0xFF, 0x6A, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0x2B, 0x62, 0xFF, 0xEE, 0x7A, 0xFF, 0xCD, 0x72, 0xFF, 0x8D, 0x72, 0xFF, 0x6C, 0x6A, 0xFF, 0x2B, 0x62, 0xFF, 0x70, 0x93, 0xFF, 0x2B, 0x62, 0xFF, 0x0B, 0x6A, 0xFF, 0x6B, 0x72, 0xFF, 0x0B, 0x62, 0xFF, 0x2B, 0x6A, 0xFF, 0x8B, 0x7A, 0xFF, 0x2B, 0x6A, 0xFF, 0x8B, 0x7A, 0xFF, 0x4A, 0x7A, 0xFF, 0x6B, 0x72, 0xFF, 0xE9, 0x61, 0xFF, 0x0E, 0x8B, 0xFF, 0x6C, 0x7A, 0xFF, 0x4A, 0x82, 0xFF, 0x0D, 0x9B, 0xFF, 0xEC, 0x9A, 0xFF, 0x8B, 0x82, 0xFF, 0xCC, 0x9A, 0xFF, 0x6F, 0xBB, 0xFF, 0xAC, 0xB2, 0xFF, 0x30, 0xFC, 0xFF, 0xB3, 0xFC, 0xFF, 0xD0, 0xE3, 0xFF, 0x4E, 0xC3, 0xFF, 0xCC, 0xB2, 0xFF,
-    0x6B, 0xA2, 0xFF, 0xCA, 0x91, 0xFF, 0xA9, 0x79, 0xFF, 0xCA, 0x81, 0xFF, 0xD0, 0xBA, 0xFF, 0x8A, 0x71, 0xFF, 0x8A, 0x79, 0xFF, 0x69, 0x71, 0xFF, 0xEA, 0x60, 0xFF, 0xEA, 0x58, 0xFF, 0x0B, 0x59, 0xFF, 0x2A, 0x71, 0xFF, 0x6B, 0x71, 0xFF, 0xA9, 0x58, 0xFF, 0x6C, 0x69, 0xFF, 0x4F, 0x81, 0xFF, 0x4E, 0x92, 0xFF, 0x6D, 0x92, 0xFF, 0xAC, 0x58, 0xFF, 0xB3, 0xA2, 0xFF, 0x8A, 0x48, 0xFF, 0x4A, 0x40, 0xFF, 0xCF, 0x60, 0xFF, 0xB8, 0xDC, 0xFF, 0xCB, 0x48, 0xFF, 0xEE, 0x58, 0xFF, 0x10, 0x69, 0xFF, 0xCA, 0x48, 0xFF, 0x8B, 0x40, 0xFF, 0x6C, 0x40, 0xFF, 0x8C, 0x48, 0xFF, 0xAB, 0x40, 0xFF, 0x2D, 0x51, 0xFF, 0x31, 0x8A, 0xFF, 0x0D, 0x51, 0xFF, 0x49, 0x30, 0xFF, 0xCC, 0x40, 0xFF, 0xCD, 0x40, 0xFF, 0x4B, 0x30, 0xFF, 0x6A, 0x30, 0xFF, 0x69, 0x28, 0xFF, 0x6C, 0x51, 0xFF, 0xCB, 0x38, 0xFF, 0x8A, 0x30, 0xFF, 0xD1, 0x82, 0xFF, 0x6A, 0x28, 0xFF, 0x8A, 0x28, 0xFF, 0x8A, 0x28, 0xFF, 0x2E, 0x9B, 0xFF, 0x0E, 0x7B, 0xFF, 0xED, 0x7A, 0xFF, 0xAD, 0x72, 0xFF, 0x6B, 0x6A, 0xFF, 0xEE, 0x7A, 0xFF, 0xCD, 0x7A, 0xFF, 0x8C, 0x72, 0xFF, 0xAC, 0x9A, 0xFF, 0x8B, 0x72, 0xFF, 0xD0, 0x9B, 0xFF, 0x90, 0x93, 0xFF, 0x4A, 0x72, 0xFF, 0x2A, 0x6A, 0xFF, 0xCB, 0x82, 0xFF, 0x8E, 0xBB, 0xFF,
-    0x0C, 0xB3, 0xFF, 0x8B, 0x72, 0xFF, 0x29, 0x6A, 0xFF, 0x31, 0xBC, 0xFF, 0x4D, 0xB3, 0xFF, 0x6E, 0xCB, 0xFF, 0xF2, 0xDC, 0xFF, 0x34, 0xED, 0xFF, 0xAF, 0xBB, 0xFF, 0x2C, 0xAB, 0xFF, 0xF1, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0xEB, 0xFF, 0x5C, 0xFF, 0xFF, 0x8D, 0xCB, 0xFF, 0xD3, 0xE4, 0xFF, 0x14, 0xDD, 0xFF, 0x89, 0x79, 0xFF, 0x6E, 0xC3, 0xFF, 0xCE, 0xB2, 0xFF, 0x69, 0x69, 0xFF, 0xE9, 0x89, 0xFF, 0x12, 0xE4, 0xFF, 0x2A, 0x69, 0xFF, 0x0A, 0x59, 0xFF, 0x2B, 0x59, 0xFF, 0xC9, 0x60, 0xFF, 0xF2, 0xB1, 0xFF, 0xE9, 0x58, 0xFF, 0xCD, 0x71, 0xFF, 0xC9, 0x58, 0xFF, 0xB0, 0x99, 0xFF, 0x50, 0x9A, 0xFF, 0xA9, 0x48, 0xFF, 0x12, 0x9B, 0xFF, 0x52, 0x91, 0xFF, 0x89, 0x40, 0xFF, 0xEB, 0x48, 0xFF, 0xCE, 0x71, 0xFF, 0x4D, 0x50, 0xFF, 0x0D, 0x49, 0xFF, 0x4C, 0x51, 0xFF, 0xAB, 0x48, 0xFF, 0x4E, 0x58, 0xFF, 0x6B, 0x38, 0xFF, 0xCA, 0x40, 0xFF, 0xCA, 0x40, 0xFF, 0x12, 0x61, 0xFF, 0x6D, 0x59, 0xFF, 0xCF, 0x69, 0xFF, 0x28, 0x28, 0xFF, 0x12, 0x61, 0xFF, 0x10, 0x59, 0xFF, 0x49, 0x28, 0xFF, 0x8A, 0x30, 0xFF, 0xAF, 0x40, 0xFF, 0x6D, 0x51, 0xFF, 0x28, 0x20, 0xFF, 0x69, 0x20, 0xFF, 0x2B, 0x49, 0xFF, 0xAB, 0x30, 0xFF, 0x69, 0x28, 0xFF, 0x89, 0x28, 0xFF,
-    0xAC, 0x72, 0xFF, 0xD0, 0x93, 0xFF, 0xAC, 0x6A, 0xFF, 0x4F, 0x83, 0xFF, 0x8C, 0x6A, 0xFF, 0x8C, 0x72, 0xFF, 0x4B, 0x6A, 0xFF, 0xF3, 0xB4, 0xFF, 0x4D, 0x83, 0xFF, 0xED, 0x82, 0xFF, 0x4B, 0x62, 0xFF, 0x75, 0xCD, 0xFF, 0xAF, 0x93, 0xFF, 0x38, 0xE6, 0xFF, 0x4D, 0x8B, 0xFF, 0x0C, 0x8B, 0xFF, 0x89, 0x8A, 0xFF, 0x10, 0xAC, 0xFF, 0xCC, 0x82, 0xFF, 0x8B, 0x7A, 0xFF, 0x0C, 0x9B, 0xFF, 0xDB, 0xFF, 0xFF, 0x4F, 0xCC, 0xFF, 0xEB, 0x92, 0xFF, 0xEC, 0x9A, 0xFF, 0x30, 0xD4, 0xFF, 0x75, 0xF5, 0xFF, 0xD5, 0xF5, 0xFF, 0xF2, 0xFC, 0xFF, 0xB4, 0xFC, 0xFF, 0x55, 0xFD, 0xFF, 0x8B, 0xA2, 0xFF, 0x8C, 0x92, 0xFF, 0x4B, 0x92, 0xFF, 0x68, 0x71, 0xFF, 0x69, 0xA1, 0xFF, 0x8D, 0x92, 0xFF, 0x28, 0x61, 0xFF, 0xC9, 0x79, 0xFF, 0x4E, 0xBA, 0xFF, 0xAE, 0x81, 0xFF, 0xE7, 0x40, 0xFF, 0x2A, 0x59, 0xFF, 0xEA, 0x60, 0xFF, 0xD1, 0xB9, 0xFF, 0x8D, 0x81, 0xFF, 0xAD, 0x69, 0xFF, 0xC9, 0x50, 0xFF, 0xAD, 0x79, 0xFF, 0x91, 0xA1, 0xFF, 0xEA, 0x50, 0xFF, 0xEC, 0x69, 0xFF, 0xAB, 0x48, 0xFF, 0x94, 0xA9, 0xFF, 0x4D, 0x59, 0xFF, 0x2C, 0x59, 0xFF, 0xEE, 0x69, 0xFF, 0x92, 0x81, 0xFF, 0x30, 0x79, 0xFF, 0xEC, 0x48, 0xFF, 0x6C, 0x59, 0xFF, 0xCA, 0x38, 0xFF, 0xEF, 0x60, 0xFF, 0x0F, 0x61, 0xFF,
-    0xA9, 0x38, 0xFF, 0xE9, 0x40, 0xFF, 0x70, 0x61, 0xFF, 0xEF, 0x58, 0xFF, 0x69, 0x28, 0xFF, 0x69, 0x30, 0xFF, 0x28, 0x28, 0xFF, 0xF3, 0x58, 0xFF, 0xCF, 0x50, 0xFF, 0xEC, 0x38, 0xFF, 0xA9, 0x30, 0xFF, 0xEF, 0x50, 0xFF, 0x49, 0x28, 0xFF, 0xCD, 0x40, 0xFF, 0x89, 0x28, 0xFF, 0x89, 0x28, 0xFF, 0x0C, 0x7B, 0xFF, 0x2D, 0x7B, 0xFF, 0xED, 0x7A, 0xFF, 0x72, 0xA4, 0xFF, 0xED, 0x72, 0xFF, 0xB2, 0xAC, 0xFF, 0xAC, 0x6A, 0xFF, 0x8B, 0x6A, 0xFF, 0xB3, 0xB4, 0xFF, 0x8E, 0x93, 0xFF, 0xD6, 0xE5, 0xFF, 0x6A, 0x6A, 0xFF, 0x2A, 0x6A, 0xFF, 0x93, 0xBC, 0xFF, 0x6E, 0x9B, 0xFF, 0x9C, 0xFF, 0xFF, 0x0B, 0x8B, 0xFF, 0xAB, 0x7A, 0xFF, 0x49, 0x7A, 0xFF, 0x17, 0xFE, 0xFF, 0x0E, 0xB4, 0xFF, 0x6E, 0xC4, 0xFF, 0x8D, 0xAB, 0xFF, 0xF8, 0xEE, 0xFF, 0x97, 0xFD, 0xFF, 0xCA, 0x9A, 0xFF, 0x2E, 0xAB, 0xFF, 0xAE, 0xC3, 0xFF, 0x4C, 0xB3, 0xFF, 0x78, 0xF6, 0xFF, 0x6B, 0x9A, 0xFF, 0xC8, 0x71, 0xFF, 0x0D, 0xA3, 0xFF, 0x6C, 0x92, 0xFF, 0x13, 0xEB, 0xFF, 0xA9, 0x79, 0xFF, 0x0B, 0x82, 0xFF, 0x48, 0x59, 0xFF, 0xA8, 0x71, 0xFF, 0x13, 0xEB, 0xFF, 0x6C, 0x71, 0xFF, 0xE6, 0x40, 0xFF, 0x2A, 0x59, 0xFF, 0xE9, 0x58, 0xFF, 0x8F, 0xA9, 0xFF, 0x30, 0xAA, 0xFF, 0x2A, 0x59, 0xFF, 0x2A, 0x59, 0xFF,
-    0x4B, 0x61, 0xFF, 0xB2, 0xB1, 0xFF, 0x2D, 0x61, 0xFF, 0xE9, 0x48, 0xFF, 0xA9, 0x40, 0xFF, 0xCB, 0x48, 0xFF, 0x92, 0xA1, 0xFF, 0xCB, 0x50, 0xFF, 0x6C, 0x59, 0xFF, 0x2D, 0x51, 0xFF, 0x8B, 0x38, 0xFF, 0x51, 0x71, 0xFF, 0xEF, 0x58, 0xFF, 0x8B, 0x38, 0xFF, 0xAE, 0x59, 0xFF, 0x69, 0x30, 0xFF, 0x32, 0x81, 0xFF, 0x32, 0x79, 0xFF, 0xEA, 0x48, 0xFF, 0x0C, 0x49, 0xFF, 0x6A, 0x28, 0xFF, 0xCE, 0x58, 0xFF, 0x49, 0x30, 0xFF, 0xEB, 0x38, 0xFF, 0x8A, 0x28, 0xFF, 0x69, 0x28, 0xFF, 0xF0, 0x58, 0xFF, 0xA9, 0x28, 0xFF, 0x4B, 0x30, 0xFF, 0x68, 0x20, 0xFF, 0x89, 0x28, 0xFF, 0x8C, 0x38, 0xFF, 0x0F, 0x9C, 0xFF, 0xB5, 0xDD, 0xFF, 0x0D, 0x7B, 0xFF, 0xEC, 0x72, 0xFF, 0xAC, 0x72, 0xFF, 0xCC, 0x72, 0xFF, 0xD5, 0xC4, 0xFF, 0x8E, 0x8B, 0xFF, 0x8A, 0x72, 0xFF, 0xCF, 0x93, 0xFF, 0x8B, 0x6A, 0xFF, 0x32, 0xBC, 0xFF, 0x99, 0xFE, 0xFF, 0xCB, 0x7A, 0xFF, 0x8D, 0x8B, 0xFF, 0x6D, 0x93, 0xFF, 0x8D, 0x93, 0xFF, 0x35, 0xE5, 0xFF, 0xD2, 0xC4, 0xFF, 0x2B, 0x8B, 0xFF, 0x8C, 0xA3, 0xFF, 0xD1, 0xDC, 0xFF, 0xF2, 0xE4, 0xFF, 0x56, 0xF5, 0xFF, 0x32, 0xDD, 0xFF, 0xEF, 0xC3, 0xFF, 0xEC, 0x92, 0xFF, 0xAE, 0xB3, 0xFF, 0xB4, 0xE4, 0xFF, 0xCB, 0xA2, 0xFF, 0x6A, 0x8A, 0xFF, 0x4A, 0x82, 0xFF,
-    0xB0, 0xBB, 0xFF, 0x6B, 0x92, 0xFF, 0x0F, 0xCB, 0xFF, 0xC8, 0x71, 0xFF, 0xEF, 0xAA, 0xFF, 0x89, 0x61, 0xFF, 0xC8, 0x71, 0xFF, 0x6F, 0xAA, 0xFF, 0xC8, 0x48, 0xFF, 0x29, 0x51, 0xFF, 0x4A, 0x59, 0xFF, 0x08, 0x59, 0xFF, 0x91, 0xB2, 0xFF, 0x0D, 0x7A, 0xFF, 0xED, 0x79, 0xFF, 0x0C, 0x61, 0xFF, 0xCC, 0x71, 0xFF, 0x2F, 0x82, 0xFF, 0xAF, 0x89, 0xFF, 0x4D, 0x69, 0xFF, 0xA9, 0x40, 0xFF, 0x8A, 0x40, 0xFF, 0x4C, 0x51, 0xFF, 0x91, 0x89, 0xFF, 0xCC, 0x48, 0xFF, 0xA8, 0x38, 0xFF, 0x8C, 0x40, 0xFF, 0x69, 0x38, 0xFF, 0xCF, 0x61, 0xFF, 0x50, 0x69, 0xFF, 0xEB, 0x38, 0xFF, 0x0B, 0x41, 0xFF, 0xCA, 0x38, 0xFF, 0x2E, 0x62, 0xFF, 0x8C, 0x48, 0xFF, 0x0F, 0x71, 0xFF, 0x89, 0x30, 0xFF, 0xEF, 0x59, 0xFF, 0x4D, 0x49, 0xFF, 0x6A, 0x30, 0xFF, 0x71, 0x69, 0xFF, 0x6A, 0x28, 0xFF, 0x2A, 0x39, 0xFF, 0x88, 0x28, 0xFF, 0x69, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xCE, 0x50, 0xFF, 0x68, 0x28, 0xFF, 0x0F, 0x94, 0xFF, 0xEF, 0x8B, 0xFF, 0xB1, 0xBC, 0xFF, 0x0D, 0x7B, 0xFF, 0x75, 0xE5, 0xFF, 0x0D, 0x7B, 0xFF, 0x2D, 0x83, 0xFF, 0xCB, 0x72, 0xFF, 0xAB, 0x7A, 0xFF, 0xCB, 0x72, 0xFF, 0xAB, 0x6A, 0xFF, 0x8D, 0x8B, 0xFF, 0xAE, 0x93, 0xFF, 0x70, 0xA4, 0xFF, 0x50, 0xAC, 0xFF, 0x6F, 0xB4, 0xFF,
-    0x8D, 0x9B, 0xFF, 0x6C, 0x93, 0xFF, 0xCE, 0x9B, 0xFF, 0x94, 0xDD, 0xFF, 0x0D, 0xB4, 0xFF, 0xB3, 0xFD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x76, 0xFE, 0xFF, 0xEE, 0xBB, 0xFF, 0x2C, 0x93, 0xFF, 0x4F, 0xC4, 0xFF, 0x8A, 0x8A, 0xFF, 0x2C, 0x9B, 0xFF, 0x4C, 0xAB, 0xFF, 0xCB, 0x9A, 0xFF, 0xAB, 0x92, 0xFF, 0xB3, 0xD4, 0xFF, 0x67, 0x69, 0xFF, 0xC8, 0x81, 0xFF, 0x6B, 0x82, 0xFF, 0x48, 0x59, 0xFF, 0xE8, 0x71, 0xFF, 0x0B, 0x7A, 0xFF, 0x2A, 0x61, 0xFF, 0x49, 0x51, 0xFF, 0x2A, 0x51, 0xFF, 0xEB, 0x79, 0xFF, 0xEF, 0x91, 0xFF, 0x8B, 0x69, 0xFF, 0x50, 0x92, 0xFF, 0x6C, 0x61, 0xFF, 0x10, 0x92, 0xFF, 0x8C, 0x69, 0xFF, 0x6F, 0x7A, 0xFF, 0xE9, 0x50, 0xFF, 0x2F, 0x71, 0xFF, 0xAA, 0x40, 0xFF, 0xCB, 0x50, 0xFF, 0xEA, 0x48, 0xFF, 0x71, 0x79, 0xFF, 0x6B, 0x51, 0xFF, 0x6C, 0x49, 0xFF, 0x68, 0x30, 0xFF, 0xEF, 0x58, 0xFF, 0x89, 0x38, 0xFF, 0xCA, 0x38, 0xFF, 0x2D, 0x51, 0xFF, 0x4E, 0x59, 0xFF, 0x4F, 0x6A, 0xFF, 0xEA, 0x38, 0xFF, 0x6F, 0x61, 0xFF, 0x6B, 0x38, 0xFF, 0x4E, 0x62, 0xFF, 0x51, 0x83, 0xFF, 0xAA, 0x38, 0xFF, 0xEE, 0x48, 0xFF, 0x49, 0x28, 0xFF, 0x4C, 0x41, 0xFF, 0xC8, 0x28, 0xFF, 0x89, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0x8B, 0x41, 0xFF, 0x0A, 0x39, 0xFF,
-    0x70, 0x9C, 0xFF, 0xAE, 0x83, 0xFF, 0xAE, 0x8B, 0xFF, 0x30, 0x94, 0xFF, 0x6D, 0x83, 0xFF, 0x0C, 0x7B, 0xFF, 0xEC, 0x72, 0xFF, 0x0C, 0x83, 0xFF, 0xAC, 0x8B, 0xFF, 0xAB, 0x6A, 0xFF, 0xCB, 0x72, 0xFF, 0xCD, 0x93, 0xFF, 0x4E, 0xA4, 0xFF, 0x14, 0xD6, 0xFF, 0x2E, 0x9C, 0xFF, 0xCB, 0x9B, 0xFF, 0xDE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xAD, 0x9B, 0xFF, 0x2E, 0xBC, 0xFF, 0x95, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0xFF, 0xFF, 0xD0, 0xD4, 0xFF, 0x38, 0xF7, 0xFF, 0x0E, 0xBC, 0xFF, 0xCA, 0x92, 0xFF, 0x98, 0xFE, 0xFF, 0xAA, 0x92, 0xFF, 0x35, 0xFD, 0xFF, 0xEC, 0x92, 0xFF, 0x6E, 0xA3, 0xFF, 0xEB, 0x79, 0xFF, 0x0B, 0x9A, 0xFF, 0x8C, 0x8A, 0xFF, 0x48, 0x51, 0xFF, 0x87, 0x61, 0xFF, 0x69, 0x69, 0xFF, 0x4B, 0x61, 0xFF, 0x29, 0x51, 0xFF, 0x29, 0x51, 0xFF, 0xEA, 0x71, 0xFF, 0xF0, 0xB1, 0xFF, 0x6D, 0x7A, 0xFF, 0x09, 0x49, 0xFF, 0xAC, 0x61, 0xFF, 0x4C, 0x69, 0xFF, 0x09, 0x49, 0xFF, 0xED, 0x69, 0xFF, 0x87, 0x38, 0xFF, 0x68, 0x38, 0xFF, 0x4E, 0x69, 0xFF, 0xC9, 0x38, 0xFF, 0x09, 0x41, 0xFF, 0x69, 0x38, 0xFF, 0xB3, 0x9A, 0xFF, 0x8C, 0x49, 0xFF, 0x0A, 0x41, 0xFF, 0xAA, 0x38, 0xFF, 0xEC, 0x50, 0xFF, 0x4F, 0x61, 0xFF, 0x52, 0x7B, 0xFF,
-    0x0E, 0x5A, 0xFF, 0x2C, 0x49, 0xFF, 0xCB, 0x40, 0xFF, 0xEA, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0x6A, 0x49, 0xFF, 0x4E, 0x51, 0xFF, 0xCB, 0x38, 0xFF, 0x88, 0x28, 0xFF, 0x69, 0x28, 0xFF, 0xAB, 0x38, 0xFF, 0x8E, 0x51, 0xFF, 0x68, 0x20, 0xFF, 0x8B, 0x41, 0xFF, 0xAF, 0x6A, 0xFF, 0x68, 0x20, 0xFF, 0x2F, 0x8C, 0xFF, 0xD1, 0xA4, 0xFF, 0xEE, 0x8B, 0xFF, 0x8E, 0x8B, 0xFF, 0x6E, 0x83, 0xFF, 0x4D, 0x7B, 0xFF, 0x6E, 0x9C, 0xFF, 0xB3, 0xC5, 0xFF, 0x4C, 0x83, 0xFF, 0xCB, 0x72, 0xFF, 0x0B, 0x73, 0xFF, 0x18, 0xEF, 0xFF, 0x2C, 0x83, 0xFF, 0x31, 0xBD, 0xFF, 0xEA, 0x7A, 0xFF, 0xD8, 0xF6, 0xFF, 0xDC, 0xFF, 0xFF, 0xAC, 0x9B, 0xFF, 0xEE, 0xA3, 0xFF, 0xAD, 0xA3, 0xFF, 0x5A, 0xFF, 0xFF, 0x55, 0xF6, 0xFF, 0x58, 0xFF, 0xFF, 0x13, 0xFE, 0xFF, 0x8F, 0xCC, 0xFF, 0xF1, 0xE4, 0xFF, 0x0B, 0x9B, 0xFF, 0x2F, 0xB4, 0xFF, 0x6A, 0x82, 0xFF, 0xAC, 0x9A, 0xFF, 0xD4, 0xFC, 0xFF, 0x6A, 0x7A, 0xFF, 0xCC, 0x8A, 0xFF, 0x90, 0xAB, 0xFF, 0xA8, 0x69, 0xFF, 0x09, 0x7A, 0xFF, 0x0A, 0x72, 0xFF, 0x27, 0x51, 0xFF, 0xC9, 0x69, 0xFF, 0xAE, 0x9A, 0xFF, 0x6B, 0x61, 0xFF, 0x28, 0x49, 0xFF, 0x49, 0x51, 0xFF, 0x4B, 0x7A, 0xFF, 0xB2, 0xC2, 0xFF, 0x8D, 0x7A, 0xFF, 0xE9, 0x48, 0xFF, 0x4B, 0x61, 0xFF,
-    0x29, 0x51, 0xFF, 0xD1, 0x99, 0xFF, 0x8A, 0x59, 0xFF, 0x0A, 0x49, 0xFF, 0xEA, 0x48, 0xFF, 0x6A, 0x51, 0xFF, 0x0C, 0x59, 0xFF, 0x0D, 0x62, 0xFF, 0x89, 0x30, 0xFF, 0xCD, 0x59, 0xFF, 0x90, 0x81, 0xFF, 0x2B, 0x41, 0xFF, 0xA9, 0x30, 0xFF, 0x4C, 0x49, 0xFF, 0x0A, 0x39, 0xFF, 0x0F, 0x69, 0xFF, 0x2A, 0x41, 0xFF, 0x69, 0x30, 0xFF, 0x0B, 0x39, 0xFF, 0xCA, 0x38, 0xFF, 0x4D, 0x49, 0xFF, 0x47, 0x20, 0xFF, 0x67, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x0D, 0x51, 0xFF, 0x49, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x47, 0x20, 0xFF, 0xB2, 0x7A, 0xFF, 0x88, 0x28, 0xFF, 0x47, 0x18, 0xFF, 0x2F, 0x94, 0xFF, 0x0E, 0x8C, 0xFF, 0xAE, 0x83, 0xFF, 0x4D, 0x7B, 0xFF, 0x8D, 0x83, 0xFF, 0x4E, 0x9C, 0xFF, 0x70, 0x9C, 0xFF, 0x2C, 0x7B, 0xFF, 0x4D, 0x7B, 0xFF, 0x2E, 0x9C, 0xFF, 0xDC, 0xFF, 0xFF, 0xCC, 0x93, 0xFF, 0x8D, 0x8B, 0xFF, 0x51, 0xBD, 0xFF, 0x79, 0xFF, 0xFF, 0x79, 0xFF, 0xFF, 0x52, 0xD5, 0xFF, 0xD1, 0xC4, 0xFF, 0x0E, 0xAC, 0xFF, 0x57, 0xFE, 0xFF, 0x8F, 0xBC, 0xFF, 0x90, 0xC4, 0xFF, 0x0D, 0xB4, 0xFF, 0x2E, 0xBC, 0xFF, 0xD4, 0xF5, 0xFF, 0x0E, 0xB4, 0xFF, 0xEB, 0x82, 0xFF, 0x2C, 0x93, 0xFF, 0xEB, 0x92, 0xFF, 0x37, 0xFD, 0xFF, 0xAA, 0x82, 0xFF, 0x29, 0x72, 0xFF,
-    0x6F, 0xA3, 0xFF, 0x8E, 0x9B, 0xFF, 0x92, 0xE3, 0xFF, 0xC8, 0x61, 0xFF, 0xCE, 0x92, 0xFF, 0x27, 0x51, 0xFF, 0xC8, 0x61, 0xFF, 0xB1, 0xAA, 0xFF, 0x2A, 0x69, 0xFF, 0x29, 0x49, 0xFF, 0x49, 0x51, 0xFF, 0x0A, 0x6A, 0xFF, 0x71, 0xBA, 0xFF, 0xAA, 0x61, 0xFF, 0x09, 0x49, 0xFF, 0x8B, 0x61, 0xFF, 0xE7, 0x48, 0xFF, 0xCF, 0x89, 0xFF, 0x49, 0x49, 0xFF, 0x4D, 0x61, 0xFF, 0x0A, 0x49, 0xFF, 0x2A, 0x49, 0xFF, 0xEA, 0x58, 0xFF, 0xCF, 0x69, 0xFF, 0xC9, 0x38, 0xFF, 0x6D, 0x62, 0xFF, 0xA9, 0x30, 0xFF, 0x2F, 0x71, 0xFF, 0xA8, 0x30, 0xFF, 0x0A, 0x41, 0xFF, 0xA9, 0x30, 0xFF, 0x0A, 0x41, 0xFF, 0xCC, 0x50, 0xFF, 0x8A, 0x30, 0xFF, 0x0D, 0x49, 0xFF, 0x4E, 0x51, 0xFF, 0x0D, 0x52, 0xFF, 0x0F, 0x59, 0xFF, 0x8A, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x68, 0x20, 0xFF, 0xAD, 0x48, 0xFF, 0xA9, 0x30, 0xFF, 0x87, 0x20, 0xFF, 0x46, 0x18, 0xFF, 0x27, 0x18, 0xFF, 0xEE, 0x50, 0xFF, 0x2F, 0x94, 0xFF, 0x73, 0xCD, 0xFF, 0xF1, 0xB4, 0xFF, 0xF7, 0xE6, 0xFF, 0x8C, 0x83, 0xFF, 0xAD, 0x8B, 0xFF, 0xF3, 0xB4, 0xFF, 0x6C, 0x7B, 0xFF, 0xDC, 0xFF, 0xFF, 0x6C, 0x7B, 0xFF, 0x8D, 0x83, 0xFF, 0x0D, 0x94, 0xFF, 0xEE, 0xA3, 0xFF, 0x93, 0xDD, 0xFF, 0x6C, 0x83, 0xFF, 0xF8, 0xEE, 0xFF,
-    0xD0, 0xC4, 0xFF, 0xF7, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xF6, 0xFF, 0xAF, 0xC4, 0xFF, 0xED, 0xA3, 0xFF, 0x8C, 0x9B, 0xFF, 0x12, 0xE5, 0xFF, 0x0D, 0xB4, 0xFF, 0xB7, 0xF6, 0xFF, 0xCB, 0x82, 0xFF, 0xEF, 0xAB, 0xFF, 0x58, 0xFE, 0xFF, 0x52, 0xDC, 0xFF, 0xF4, 0xDD, 0xFF, 0xC8, 0x61, 0xFF, 0x49, 0x72, 0xFF, 0xEF, 0xA3, 0xFF, 0x71, 0xCB, 0xFF, 0xC8, 0x61, 0xFF, 0xAC, 0x7A, 0xFF, 0x68, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0xD2, 0xCA, 0xFF, 0x6B, 0x61, 0xFF, 0x27, 0x41, 0xFF, 0x68, 0x49, 0xFF, 0x4B, 0x72, 0xFF, 0x8E, 0x81, 0xFF, 0x69, 0x59, 0xFF, 0x08, 0x41, 0xFF, 0xC7, 0x40, 0xFF, 0x6B, 0x61, 0xFF, 0x09, 0x41, 0xFF, 0x4F, 0x89, 0xFF, 0x09, 0x49, 0xFF, 0xB0, 0x71, 0xFF, 0x2B, 0x49, 0xFF, 0xEC, 0x61, 0xFF, 0xD2, 0x91, 0xFF, 0x2E, 0x59, 0xFF, 0xA8, 0x38, 0xFF, 0x87, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x71, 0x79, 0xFF, 0x2D, 0x59, 0xFF, 0x0A, 0x39, 0xFF, 0x2B, 0x49, 0xFF, 0x88, 0x30, 0xFF, 0xCB, 0x40, 0xFF, 0x0D, 0x51, 0xFF, 0x68, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0xEE, 0x58, 0xFF, 0xC8, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0x67, 0x20, 0xFF, 0xCD, 0x48, 0xFF, 0x68, 0x28, 0xFF, 0x67, 0x20, 0xFF, 0x68, 0x20, 0xFF,
-    0x32, 0xB5, 0xFF, 0xAF, 0xA4, 0xFF, 0x0D, 0x8C, 0xFF, 0x0E, 0x8C, 0xFF, 0xED, 0x8B, 0xFF, 0xAC, 0x83, 0xFF, 0xD6, 0xDD, 0xFF, 0x6B, 0x83, 0xFF, 0x8D, 0x83, 0xFF, 0x8C, 0x83, 0xFF, 0x33, 0xD6, 0xFF, 0x97, 0xFE, 0xFF, 0x11, 0xBD, 0xFF, 0x74, 0xEE, 0xFF, 0xF9, 0xF7, 0xFF, 0x16, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xCF, 0xCC, 0xFF, 0xED, 0xA3, 0xFF, 0x77, 0xFF, 0xFF, 0xAC, 0x9B, 0xFF, 0x8C, 0x93, 0xFF, 0xAC, 0x9B, 0xFF, 0xCF, 0xA3, 0xFF, 0x71, 0xBC, 0xFF, 0xB1, 0xC3, 0xFF, 0x49, 0x72, 0xFF, 0x6C, 0x93, 0xFF, 0xF0, 0xB3, 0xFF, 0xE8, 0x61, 0xFF, 0x4E, 0x93, 0xFF, 0xE8, 0x61, 0xFF, 0x09, 0x72, 0xFF, 0x4A, 0x72, 0xFF, 0x68, 0x49, 0xFF, 0xE8, 0x59, 0xFF, 0xEF, 0x92, 0xFF, 0xEC, 0x71, 0xFF, 0x48, 0x49, 0xFF, 0x28, 0x49, 0xFF, 0xCC, 0x7A, 0xFF, 0xCE, 0x81, 0xFF, 0x69, 0x51, 0xFF, 0x29, 0x49, 0xFF, 0x87, 0x38, 0xFF, 0xCA, 0x69, 0xFF, 0xEB, 0x61, 0xFF, 0xB0, 0x89, 0xFF, 0x8A, 0x49, 0xFF, 0x4C, 0x59, 0xFF, 0x4A, 0x49, 0xFF, 0x6B, 0x49, 0xFF, 0x6A, 0x49, 0xFF, 0xF0, 0x79, 0xFF, 0x6D, 0x59, 0xFF, 0xA9, 0x30, 0xFF, 0x87, 0x28, 0xFF, 0xE9, 0x40, 0xFF, 0x0E, 0x61, 0xFF, 0x47, 0x28, 0xFF, 0xE9, 0x38, 0xFF,
-    0xE8, 0x30, 0xFF, 0x2B, 0x41, 0xFF, 0x87, 0x20, 0xFF, 0x2F, 0x59, 0xFF, 0x88, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xED, 0x48, 0xFF, 0xE8, 0x30, 0xFF, 0x09, 0x31, 0xFF, 0x0E, 0x51, 0xFF, 0x8B, 0x30, 0xFF, 0x67, 0x20, 0xFF, 0x88, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0xCD, 0x48, 0xFF, 0xAB, 0x30, 0xFF, 0xAF, 0x9C, 0xFF, 0x6F, 0x94, 0xFF, 0xCF, 0x9C, 0xFF, 0x72, 0xAD, 0xFF, 0xCD, 0x83, 0xFF, 0xCD, 0x83, 0xFF, 0xED, 0x8B, 0xFF, 0xCD, 0x8B, 0xFF, 0xFB, 0xF7, 0xFF, 0xCD, 0x83, 0xFF, 0xCF, 0xA4, 0xFF, 0xEF, 0xAC, 0xFF, 0x9A, 0xF7, 0xFF, 0x2D, 0x94, 0xFF, 0xCC, 0x8B, 0xFF, 0x75, 0xE6, 0xFF, 0xB1, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x90, 0xED, 0xFF, 0x2D, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x9B, 0xFF, 0xAC, 0x93, 0xFF, 0x6C, 0x93, 0xFF, 0x4C, 0x93, 0xFF, 0xB7, 0xFE, 0xFF, 0xA9, 0x72, 0xFF, 0xEB, 0x82, 0xFF, 0xAB, 0x7A, 0xFF, 0x91, 0xB4, 0xFF, 0x29, 0x72, 0xFF, 0x09, 0x62, 0xFF, 0xAE, 0x93, 0xFF, 0xC8, 0x59, 0xFF, 0xE9, 0x79, 0xFF, 0x68, 0x59, 0xFF, 0x88, 0x51, 0xFF, 0xCA, 0x6A, 0xFF, 0x0A, 0x6A, 0xFF, 0x6A, 0x59, 0xFF, 0x28, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0x56, 0xE6, 0xFF, 0xF0, 0x91, 0xFF, 0x89, 0x59, 0xFF, 0x09, 0x41, 0xFF, 0x4A, 0x51, 0xFF,
-    0x88, 0x51, 0xFF, 0x09, 0x49, 0xFF, 0xC7, 0x38, 0xFF, 0xAC, 0x59, 0xFF, 0x29, 0x41, 0xFF, 0x6E, 0x69, 0xFF, 0x4A, 0x52, 0xFF, 0x29, 0x41, 0xFF, 0xA7, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xCB, 0x40, 0xFF, 0x09, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x4F, 0x61, 0xFF, 0x6B, 0x51, 0xFF, 0x09, 0x39, 0xFF, 0xAA, 0x28, 0xFF, 0x68, 0x28, 0xFF, 0x0D, 0x49, 0xFF, 0x09, 0x39, 0xFF, 0xEA, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0x8A, 0x30, 0xFF, 0x66, 0x20, 0xFF, 0x88, 0x20, 0xFF, 0xA8, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0xAB, 0x30, 0xFF, 0x88, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x10, 0xA5, 0xFF, 0xD3, 0xB5, 0xFF, 0xAF, 0x9C, 0xFF, 0x6E, 0x94, 0xFF, 0x6F, 0x9C, 0xFF, 0x2E, 0x94, 0xFF, 0xFD, 0xFF, 0xFF, 0x4D, 0x94, 0xFF, 0x2E, 0x94, 0xFF, 0x0E, 0x8C, 0xFF, 0x8F, 0xA4, 0xFF, 0xFD, 0xFF, 0xFF, 0x8E, 0xA4, 0xFF, 0xCC, 0x8B, 0xFF, 0x6E, 0x9C, 0xFF, 0x33, 0xD6, 0xFF, 0xF9, 0xFF, 0xFF, 0x14, 0xE6, 0xFF, 0x8E, 0xBC, 0xFF, 0xEC, 0xA3, 0xFF, 0xFC, 0xFF, 0xFF, 0xCD, 0x9B, 0xFF, 0x0A, 0x7B, 0xFF, 0xCD, 0x9B, 0xFF, 0xAC, 0x93, 0xFF, 0x56, 0xFE, 0xFF, 0xCA, 0x7A, 0xFF, 0x89, 0x6A, 0xFF, 0x8E, 0x93, 0xFF, 0x09, 0x62, 0xFF, 0xD2, 0xCC, 0xFF, 0x2C, 0x83, 0xFF,
-    0xE9, 0x69, 0xFF, 0x75, 0xCE, 0xFF, 0x67, 0x51, 0xFF, 0x08, 0x62, 0xFF, 0x2B, 0x6A, 0xFF, 0x68, 0x49, 0xFF, 0x6A, 0x6A, 0xFF, 0xB1, 0xB3, 0xFF, 0x8A, 0x59, 0xFF, 0x48, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0x51, 0xAC, 0xFF, 0x4F, 0x8A, 0xFF, 0x69, 0x51, 0xFF, 0x28, 0x41, 0xFF, 0xC7, 0x38, 0xFF, 0x48, 0x49, 0xFF, 0x8E, 0x81, 0xFF, 0xE8, 0x38, 0xFF, 0xCC, 0x59, 0xFF, 0xE8, 0x38, 0xFF, 0x29, 0x41, 0xFF, 0x8D, 0x69, 0xFF, 0x4B, 0x51, 0xFF, 0xE8, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xED, 0x50, 0xFF, 0x08, 0x39, 0xFF, 0xA7, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x0D, 0x59, 0xFF, 0x28, 0x39, 0xFF, 0x87, 0x20, 0xFF, 0x68, 0x20, 0xFF, 0xA8, 0x30, 0xFF, 0x0D, 0x51, 0xFF, 0xA7, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xED, 0x48, 0xFF, 0x87, 0x20, 0xFF, 0xA8, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0xEC, 0x40, 0xFF, 0xC8, 0x28, 0xFF, 0x67, 0x18, 0xFF, 0x10, 0xA5, 0xFF, 0xCF, 0x9C, 0xFF, 0x51, 0xAD, 0xFF, 0xCF, 0x9C, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0xB5, 0xFF, 0x4E, 0x94, 0xFF, 0x6E, 0x94, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0xE6, 0xFF, 0x10, 0xAD, 0xFF, 0x6E, 0x9C, 0xFF, 0x6D, 0x94, 0xFF, 0xFB, 0xFF, 0xFF, 0x95, 0xDE, 0xFF,
-    0xAE, 0xA4, 0xFF, 0xCF, 0xB4, 0xFF, 0xD2, 0xCD, 0xFF, 0x17, 0xFF, 0xFF, 0xED, 0x93, 0xFF, 0x8C, 0x8B, 0xFF, 0x0A, 0x7B, 0xFF, 0xEE, 0x9B, 0xFF, 0x8F, 0xC4, 0xFF, 0x0A, 0x7B, 0xFF, 0x89, 0x6A, 0xFF, 0xCA, 0x7A, 0xFF, 0xB0, 0xAC, 0xFF, 0x32, 0xCC, 0xFF, 0x59, 0xEF, 0xFF, 0x08, 0x62, 0xFF, 0xE8, 0x61, 0xFF, 0xEB, 0x7A, 0xFF, 0x30, 0xB3, 0xFF, 0xA7, 0x51, 0xFF, 0x0A, 0x62, 0xFF, 0x67, 0x49, 0xFF, 0x29, 0x62, 0xFF, 0x6C, 0x8A, 0xFF, 0x29, 0x51, 0xFF, 0x28, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0xD0, 0x93, 0xFF, 0x30, 0x9A, 0xFF, 0x28, 0x49, 0xFF, 0x28, 0x41, 0xFF, 0xE8, 0x40, 0xFF, 0x69, 0x51, 0xFF, 0x8F, 0x8A, 0xFF, 0xEA, 0x48, 0xFF, 0x8A, 0x49, 0xFF, 0x2B, 0x49, 0xFF, 0xC8, 0x38, 0xFF, 0xCD, 0x71, 0xFF, 0xC8, 0x30, 0xFF, 0x4C, 0x51, 0xFF, 0xE8, 0x38, 0xFF, 0xA8, 0x28, 0xFF, 0x4E, 0x61, 0xFF, 0xC9, 0x38, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0x87, 0x28, 0xFF, 0x4E, 0x61, 0xFF, 0x88, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xEA, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xED, 0x50, 0xFF, 0xA8, 0x28, 0xFF, 0x2A, 0x39, 0xFF, 0xE8, 0x30, 0xFF, 0x87, 0x20, 0xFF, 0x2C, 0x51, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0xCB, 0x38, 0xFF,
-    0x71, 0xAD, 0xFF, 0xF0, 0xA4, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xB2, 0xBD, 0xFF, 0x30, 0xAD, 0xFF, 0x10, 0xB5, 0xFF, 0x92, 0xCD, 0xFF, 0xFE, 0xFF, 0xFF, 0xF4, 0xE6, 0xFF, 0x12, 0xCE, 0xFF, 0x10, 0xAD, 0xFF, 0xD4, 0xE6, 0xFF, 0x33, 0xE6, 0xFF, 0xF6, 0xEE, 0xFF, 0x6E, 0xA4, 0xFF, 0x30, 0xAD, 0xFF, 0x53, 0xCE, 0xFF, 0x76, 0xF6, 0xFF, 0xAC, 0x8B, 0xFF, 0xAC, 0x83, 0xFF, 0x6B, 0x83, 0xFF, 0x0A, 0x73, 0xFF, 0x54, 0xF5, 0xFF, 0x2D, 0x8C, 0xFF, 0xAA, 0x72, 0xFF, 0xEB, 0x7A, 0xFF, 0x49, 0x6A, 0xFF, 0xAE, 0xAB, 0xFF, 0x92, 0xD4, 0xFF, 0x08, 0x5A, 0xFF, 0xF1, 0xAB, 0xFF, 0x09, 0x62, 0xFF, 0x2A, 0x72, 0xFF, 0x0F, 0xAB, 0xFF, 0xA8, 0x61, 0xFF, 0xC9, 0x59, 0xFF, 0x47, 0x41, 0xFF, 0xA8, 0x61, 0xFF, 0x4D, 0x8A, 0xFF, 0x49, 0x51, 0xFF, 0x28, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0xED, 0x72, 0xFF, 0x90, 0x92, 0xFF, 0xAA, 0x61, 0xFF, 0x28, 0x41, 0xFF, 0x4A, 0x49, 0xFF, 0xCA, 0x61, 0xFF, 0x2A, 0x61, 0xFF, 0xAB, 0x71, 0xFF, 0x49, 0x49, 0xFF, 0xA8, 0x38, 0xFF, 0x49, 0x41, 0xFF, 0xC9, 0x38, 0xFF, 0x6D, 0x69, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x87, 0x28, 0xFF, 0x29, 0x41, 0xFF, 0x6E, 0x61, 0xFF, 0xEA, 0x40, 0xFF, 0x87, 0x28, 0xFF, 0x87, 0x28, 0xFF,
-    0x29, 0x39, 0xFF, 0xEF, 0x61, 0xFF, 0x89, 0x38, 0xFF, 0xA7, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x67, 0x20, 0xFF, 0xEC, 0x48, 0xFF, 0x67, 0x20, 0xFF, 0x0B, 0x39, 0xFF, 0x66, 0x20, 0xFF, 0x67, 0x20, 0xFF, 0xEB, 0x48, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x67, 0x20, 0xFF, 0x35, 0xDE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF2, 0xCD, 0xFF, 0x17, 0xF7, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xB5, 0xFF, 0x2C, 0x94, 0xFF, 0xF9, 0xFF, 0xFF, 0x35, 0xFE, 0xFF, 0x2D, 0x9C, 0xFF, 0xCC, 0x8B, 0xFF, 0x8C, 0x83, 0xFF, 0x2B, 0x83, 0xFF, 0xF0, 0xCC, 0xFF, 0x72, 0xD5, 0xFF, 0xA9, 0x72, 0xFF, 0x4C, 0x83, 0xFF, 0x30, 0xAC, 0xFF, 0x49, 0x6A, 0xFF, 0x79, 0xFE, 0xFF, 0x29, 0x62, 0xFF, 0xAB, 0x72, 0xFF, 0xE8, 0x61, 0xFF, 0xA7, 0x51, 0xFF, 0x8B, 0x92, 0xFF, 0x4E, 0x9B, 0xFF, 0xE9, 0x69, 0xFF, 0xA9, 0x59, 0xFF, 0x68, 0x41, 0xFF, 0xC8, 0x51, 0xFF, 0xD0, 0xB2, 0xFF, 0x8B, 0x71, 0xFF, 0x28, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0xE9, 0x59, 0xFF, 0x0A, 0x69, 0xFF, 0x08, 0x49, 0xFF, 0x48, 0x41, 0xFF, 0x49, 0x49, 0xFF,
-    0xAA, 0x51, 0xFF, 0x6A, 0x51, 0xFF, 0xCD, 0x81, 0xFF, 0x4A, 0x49, 0xFF, 0xC7, 0x30, 0xFF, 0x6A, 0x51, 0xFF, 0xE7, 0x30, 0xFF, 0xC9, 0x40, 0xFF, 0x4C, 0x59, 0xFF, 0x09, 0x41, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0x6C, 0x49, 0xFF, 0x6F, 0x61, 0xFF, 0x4D, 0x49, 0xFF, 0x87, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x49, 0x28, 0xFF, 0x0E, 0x61, 0xFF, 0x87, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0x87, 0x20, 0xFF, 0xCA, 0x30, 0xFF, 0x67, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0x67, 0x20, 0xFF, 0xCA, 0x40, 0xFF, 0x67, 0x18, 0xFF, 0x16, 0xDF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xDE, 0xFF, 0x50, 0xAD, 0xFF, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xD4, 0xF6, 0xFF, 0x58, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x30, 0xB5, 0xFF, 0xCC, 0x83, 0xFF, 0xAF, 0xA4, 0xFF, 0xEC, 0x8B, 0xFF, 0xED, 0x8B, 0xFF, 0xAC, 0x83, 0xFF, 0xAD, 0x8B, 0xFF, 0xAC, 0x8B, 0xFF, 0xEA, 0x72, 0xFF, 0xCA, 0x72, 0xFF, 0xAA, 0x6A, 0xFF, 0x89, 0x6A, 0xFF, 0xA9, 0x6A, 0xFF, 0x49, 0x62, 0xFF, 0x2D, 0x83, 0xFF, 0xE8, 0x51, 0xFF, 0xAB, 0x7A, 0xFF, 0x29, 0x62, 0xFF,
-    0x2A, 0x62, 0xFF, 0xC8, 0x51, 0xFF, 0x87, 0x49, 0xFF, 0x4B, 0x72, 0xFF, 0xC9, 0x59, 0xFF, 0x67, 0x41, 0xFF, 0x87, 0x49, 0xFF, 0x47, 0x49, 0xFF, 0x69, 0x51, 0xFF, 0x27, 0x39, 0xFF, 0x28, 0x39, 0xFF, 0x6B, 0x62, 0xFF, 0x2F, 0x8A, 0xFF, 0x28, 0x49, 0xFF, 0x08, 0x39, 0xFF, 0x09, 0x41, 0xFF, 0x69, 0x49, 0xFF, 0x49, 0x49, 0xFF, 0x29, 0x49, 0xFF, 0x28, 0x41, 0xFF, 0xE7, 0x30, 0xFF, 0xED, 0x61, 0xFF, 0x28, 0x39, 0xFF, 0xE9, 0x40, 0xFF, 0x6D, 0x61, 0xFF, 0x8A, 0x49, 0xFF, 0xEA, 0x40, 0xFF, 0x0C, 0x49, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0x67, 0x20, 0xFF, 0xEB, 0x38, 0xFF, 0xA6, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0xEC, 0x48, 0xFF, 0xA6, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0x0C, 0x41, 0xFF, 0xC7, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0xA9, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xED, 0x50, 0xFF, 0x96, 0xF7, 0xFF, 0xB1, 0xB5, 0xFF, 0xF2, 0xB5, 0xFF, 0xF2, 0xBD, 0xFF, 0x30, 0xA5, 0xFF, 0x2F, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x12, 0xC6, 0xFF, 0x12, 0xD6, 0xFF, 0x59, 0xF7, 0xFF, 0xF2, 0xCD, 0xFF, 0x10, 0xBD, 0xFF, 0x6E, 0x9C, 0xFF, 0x6D, 0xA4, 0xFF,
-    0x6D, 0x94, 0xFF, 0xAC, 0x83, 0xFF, 0xCD, 0x8B, 0xFF, 0xCC, 0x8B, 0xFF, 0xD8, 0xFF, 0xFF, 0x6E, 0x9C, 0xFF, 0xAA, 0x6A, 0xFF, 0x0E, 0x8C, 0xFF, 0xA9, 0x6A, 0xFF, 0x74, 0xDD, 0xFF, 0x29, 0x5A, 0xFF, 0x08, 0x52, 0xFF, 0xAA, 0x6A, 0xFF, 0x08, 0x52, 0xFF, 0x6A, 0x72, 0xFF, 0x29, 0x5A, 0xFF, 0xC8, 0x51, 0xFF, 0xA8, 0x49, 0xFF, 0xA8, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x88, 0x49, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0x0B, 0x6A, 0xFF, 0x07, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x08, 0x39, 0xFF, 0xC8, 0x51, 0xFF, 0x6B, 0x59, 0xFF, 0x08, 0x41, 0xFF, 0x28, 0x39, 0xFF, 0x29, 0x41, 0xFF, 0x69, 0x49, 0xFF, 0xAD, 0x79, 0xFF, 0x08, 0x39, 0xFF, 0x08, 0x39, 0xFF, 0xE8, 0x38, 0xFF, 0x28, 0x39, 0xFF, 0x4D, 0x61, 0xFF, 0xE8, 0x30, 0xFF, 0x6A, 0x49, 0xFF, 0x8A, 0x49, 0xFF, 0x08, 0x39, 0xFF, 0x8E, 0x69, 0xFF, 0xE9, 0x38, 0xFF, 0xE8, 0x30, 0xFF, 0x86, 0x20, 0xFF, 0xCA, 0x40, 0xFF, 0xEA, 0x38, 0xFF, 0x87, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0x8A, 0x38, 0xFF, 0x66, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0xEA, 0x38, 0xFF, 0xAA, 0x38, 0xFF, 0xA7, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x87, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xCB, 0x38, 0xFF, 0x86, 0x18, 0xFF,
-    0x30, 0x9D, 0xFF, 0xEF, 0x9C, 0xFF, 0xCE, 0x94, 0xFF, 0x10, 0xA5, 0xFF, 0x12, 0xD6, 0xFF, 0xB0, 0xB5, 0xFF, 0x91, 0xB5, 0xFF, 0xF2, 0xC5, 0xFF, 0x2F, 0xAD, 0xFF, 0xFC, 0xFF, 0xFF, 0x4F, 0xAD, 0xFF, 0x4D, 0x94, 0xFF, 0x4D, 0x94, 0xFF, 0xEC, 0x8B, 0xFF, 0xFA, 0xFF, 0xFF, 0x0D, 0x8C, 0xFF, 0xAB, 0x7B, 0xFF, 0x4B, 0x7B, 0xFF, 0x8C, 0x83, 0xFF, 0x14, 0xE6, 0xFF, 0x0A, 0x73, 0xFF, 0xEA, 0x6A, 0xFF, 0xCA, 0x6A, 0xFF, 0x0F, 0x9C, 0xFF, 0x50, 0xBC, 0xFF, 0x69, 0x62, 0xFF, 0x29, 0x5A, 0xFF, 0x6E, 0x8B, 0xFF, 0x49, 0x5A, 0xFF, 0x6E, 0xA3, 0xFF, 0x49, 0x62, 0xFF, 0xEC, 0x72, 0xFF, 0xC8, 0x51, 0xFF, 0xE9, 0x59, 0xFF, 0x2F, 0x9B, 0xFF, 0xC8, 0x59, 0xFF, 0xA8, 0x51, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x41, 0xFF, 0x4D, 0x82, 0xFF, 0xAA, 0x61, 0xFF, 0x28, 0x41, 0xFF, 0x48, 0x41, 0xFF, 0xC8, 0x51, 0xFF, 0xAC, 0x71, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x69, 0x49, 0xFF, 0x49, 0x49, 0xFF, 0xCC, 0x69, 0xFF, 0x49, 0x41, 0xFF, 0xE7, 0x30, 0xFF, 0x0A, 0x41, 0xFF, 0xC7, 0x30, 0xFF, 0x8B, 0x59, 0xFF, 0xE8, 0x38, 0xFF, 0xE7, 0x30, 0xFF, 0x6A, 0x41, 0xFF, 0xE8, 0x30, 0xFF, 0x8C, 0x51, 0xFF, 0xE9, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x20, 0xFF,
-    0x4D, 0x51, 0xFF, 0x2C, 0x41, 0xFF, 0x87, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x29, 0x31, 0xFF, 0xEB, 0x40, 0xFF, 0x87, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0x67, 0x18, 0xFF, 0x0F, 0x5A, 0xFF, 0x67, 0x20, 0xFF, 0xA7, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x30, 0xA5, 0xFF, 0x8E, 0x94, 0xFF, 0x2D, 0x8C, 0xFF, 0xF3, 0xCD, 0xFF, 0x10, 0xA5, 0xFF, 0x6E, 0x94, 0xFF, 0x6E, 0x94, 0xFF, 0x10, 0xA5, 0xFF, 0xD2, 0xCD, 0xFF, 0x91, 0xB5, 0xFF, 0xAD, 0x94, 0xFF, 0xEC, 0x83, 0xFF, 0xEC, 0x83, 0xFF, 0xFC, 0xFF, 0xFF, 0x6A, 0x7B, 0xFF, 0x6B, 0x7B, 0xFF, 0x6B, 0x7B, 0xFF, 0x6B, 0x7B, 0xFF, 0xFE, 0xFF, 0xFF, 0x0A, 0x73, 0xFF, 0xEA, 0x6A, 0xFF, 0xA9, 0x62, 0xFF, 0x90, 0xA4, 0xFF, 0x89, 0x6A, 0xFF, 0x8E, 0x93, 0xFF, 0x28, 0x5A, 0xFF, 0x09, 0x5A, 0xFF, 0x49, 0x5A, 0xFF, 0x29, 0x5A, 0xFF, 0xC8, 0x59, 0xFF, 0x08, 0x5A, 0xFF, 0x4E, 0x8B, 0xFF, 0xA7, 0x49, 0xFF, 0x46, 0x41, 0xFF, 0xCF, 0x9A, 0xFF, 0xC8, 0x61, 0xFF, 0xA8, 0x51, 0xFF, 0x67, 0x41, 0xFF, 0x87, 0x49, 0xFF, 0xEB, 0x71, 0xFF, 0x28, 0x41, 0xFF, 0x07, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x88, 0x49, 0xFF, 0xCC, 0x69, 0xFF, 0x07, 0x41, 0xFF, 0xE7, 0x38, 0xFF, 0x29, 0x41, 0xFF,
-    0x28, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0xA7, 0x30, 0xFF, 0x49, 0x41, 0xFF, 0xA6, 0x30, 0xFF, 0x2B, 0x49, 0xFF, 0xE7, 0x30, 0xFF, 0x2B, 0x59, 0xFF, 0xC7, 0x30, 0xFF, 0x6B, 0x51, 0xFF, 0x29, 0x39, 0xFF, 0xC8, 0x28, 0xFF, 0x0A, 0x49, 0xFF, 0x0A, 0x39, 0xFF, 0x4B, 0x41, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xEC, 0x38, 0xFF, 0xC7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xCC, 0x40, 0xFF, 0x87, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x8E, 0x8C, 0xFF, 0x4E, 0x8C, 0xFF, 0x74, 0xE6, 0xFF, 0x6E, 0x94, 0xFF, 0x0D, 0x8C, 0xFF, 0x0C, 0x84, 0xFF, 0xCC, 0x83, 0xFF, 0xD3, 0xD5, 0xFF, 0xD4, 0xC6, 0xFF, 0x0C, 0x84, 0xFF, 0xEC, 0x83, 0xFF, 0x8B, 0x7B, 0xFF, 0xFA, 0xF7, 0xFF, 0x0C, 0x8C, 0xFF, 0x4B, 0x73, 0xFF, 0x4B, 0x73, 0xFF, 0x6B, 0x7B, 0xFF, 0x94, 0xD6, 0xFF, 0xD1, 0xBC, 0xFF, 0xEA, 0x6A, 0xFF, 0xCA, 0x6A, 0xFF, 0xB3, 0xBD, 0xFF, 0xEA, 0x72, 0xFF, 0x91, 0xD4, 0xFF, 0xCA, 0x6A, 0xFF, 0x28, 0x5A, 0xFF, 0x2F, 0x9C, 0xFF, 0x33, 0xB5, 0xFF, 0x4A, 0x62, 0xFF, 0x09, 0x5A, 0xFF, 0x49, 0x62, 0xFF, 0xE8, 0x59, 0xFF,
-    0x29, 0x5A, 0xFF, 0xA8, 0x49, 0xFF, 0x50, 0xAB, 0xFF, 0x0A, 0x62, 0xFF, 0xC9, 0x51, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x41, 0xFF, 0x2D, 0x82, 0xFF, 0xE7, 0x38, 0xFF, 0x07, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0xED, 0x71, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x28, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0xE8, 0x38, 0xFF, 0x29, 0x49, 0xFF, 0xE7, 0x38, 0xFF, 0xC6, 0x28, 0xFF, 0xAB, 0x59, 0xFF, 0xC7, 0x30, 0xFF, 0xAE, 0x71, 0xFF, 0xE7, 0x28, 0xFF, 0x49, 0x39, 0xFF, 0xE9, 0x38, 0xFF, 0x2B, 0x41, 0xFF, 0xC8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0x2B, 0x49, 0xFF, 0xE9, 0x38, 0xFF, 0xA7, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xEC, 0x48, 0xFF, 0xA8, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0x0C, 0x51, 0xFF, 0x67, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0x0A, 0x39, 0xFF, 0xCA, 0x38, 0xFF, 0xA6, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x11, 0xBD, 0xFF, 0x2D, 0x8C, 0xFF, 0xED, 0x83, 0xFF, 0x0D, 0x84, 0xFF, 0xCC, 0x7B, 0xFF, 0x0D, 0x94, 0xFF, 0x32, 0xC5, 0xFF, 0x30, 0xA5, 0xFF, 0x6B, 0x73, 0xFF, 0x8B, 0x7B, 0xFF, 0x6B, 0x7B, 0xFF, 0xB0, 0xBC, 0xFF, 0x6A, 0x83, 0xFF, 0x0A, 0x6B, 0xFF, 0xEA, 0x62, 0xFF, 0xEA, 0x62, 0xFF,
-    0x27, 0x52, 0xFF, 0xD2, 0xD4, 0xFF, 0x0B, 0x73, 0xFF, 0xCA, 0x62, 0xFF, 0x88, 0x62, 0xFF, 0xA9, 0x62, 0xFF, 0x91, 0xBC, 0xFF, 0x69, 0x6A, 0xFF, 0xEB, 0x72, 0xFF, 0x49, 0x5A, 0xFF, 0x08, 0x52, 0xFF, 0x09, 0x52, 0xFF, 0x0E, 0xA3, 0xFF, 0xE8, 0x51, 0xFF, 0x29, 0x5A, 0xFF, 0x4A, 0x62, 0xFF, 0x87, 0x49, 0xFF, 0xA8, 0x59, 0xFF, 0x6C, 0x72, 0xFF, 0x87, 0x49, 0xFF, 0x67, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x67, 0x41, 0xFF, 0x2D, 0x7A, 0xFF, 0x07, 0x41, 0xFF, 0x27, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0xA8, 0x49, 0xFF, 0x8B, 0x61, 0xFF, 0x0C, 0x72, 0xFF, 0xC7, 0x30, 0xFF, 0x28, 0x41, 0xFF, 0x49, 0x49, 0xFF, 0xC7, 0x30, 0xFF, 0xCC, 0x71, 0xFF, 0x87, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0xE8, 0x30, 0xFF, 0xA6, 0x28, 0xFF, 0xA7, 0x30, 0xFF, 0x8D, 0x71, 0xFF, 0xEC, 0x59, 0xFF, 0xC8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0x2A, 0x49, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xCB, 0x38, 0xFF, 0x86, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x0A, 0x49, 0xFF, 0xA8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xA6, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xAA, 0x30, 0xFF, 0xEC, 0x48, 0xFF, 0xA6, 0x20, 0xFF, 0x65, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x88, 0x28, 0xFF,
-    0xF2, 0xBD, 0xFF, 0x0D, 0x84, 0xFF, 0xAC, 0x7B, 0xFF, 0xAC, 0x7B, 0xFF, 0x8C, 0x7B, 0xFF, 0x8B, 0x73, 0xFF, 0x75, 0xCE, 0xFF, 0x2A, 0x6B, 0xFF, 0x2A, 0x6B, 0xFF, 0x6B, 0x73, 0xFF, 0x2A, 0x73, 0xFF, 0xE9, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0xAA, 0x62, 0xFF, 0xF4, 0xC5, 0xFF, 0x89, 0x5A, 0xFF, 0x89, 0x5A, 0xFF, 0xAA, 0x62, 0xFF, 0xCA, 0x6A, 0xFF, 0x16, 0xEF, 0xFF, 0x8A, 0x62, 0xFF, 0x49, 0x5A, 0xFF, 0xEC, 0x72, 0xFF, 0x69, 0x5A, 0xFF, 0xB1, 0xAC, 0xFF, 0x08, 0x52, 0xFF, 0x8A, 0x6A, 0xFF, 0xE8, 0x59, 0xFF, 0xC8, 0x51, 0xFF, 0xC8, 0x51, 0xFF, 0x2A, 0x62, 0xFF, 0xE8, 0x51, 0xFF, 0x67, 0x41, 0xFF, 0xA8, 0x49, 0xFF, 0xA8, 0x51, 0xFF, 0x87, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x41, 0xFF, 0xCA, 0x61, 0xFF, 0x89, 0x51, 0xFF, 0x27, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x67, 0x41, 0xFF, 0x4A, 0x51, 0xFF, 0xA6, 0x30, 0xFF, 0xE7, 0x40, 0xFF, 0xC7, 0x30, 0xFF, 0x28, 0x41, 0xFF, 0xCC, 0x61, 0xFF, 0xC8, 0x40, 0xFF, 0x08, 0x39, 0xFF, 0xC8, 0x30, 0xFF, 0x29, 0x39, 0xFF, 0x4C, 0x51, 0xFF, 0x86, 0x20, 0xFF, 0xAC, 0x61, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x6B, 0x59, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0x86, 0x20, 0xFF, 0x6A, 0x41, 0xFF,
-    0x87, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0x0B, 0x49, 0xFF, 0xE9, 0x30, 0xFF, 0x87, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x28, 0xFF, 0xEA, 0x38, 0xFF, 0xE7, 0x28, 0xFF, 0xA6, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0xEA, 0x38, 0xFF, 0x2D, 0x8C, 0xFF, 0x0D, 0x84, 0xFF, 0xAC, 0x7B, 0xFF, 0xAC, 0x7B, 0xFF, 0xF5, 0xEE, 0xFF, 0xEF, 0xAC, 0xFF, 0x0A, 0x6B, 0xFF, 0x0A, 0x6B, 0xFF, 0x2A, 0x73, 0xFF, 0xFB, 0xFF, 0xFF, 0x54, 0xD6, 0xFF, 0xEA, 0x62, 0xFF, 0x0B, 0x6B, 0xFF, 0x4E, 0x94, 0xFF, 0x77, 0xF7, 0xFF, 0xAC, 0x83, 0xFF, 0xCD, 0x83, 0xFF, 0x0B, 0x6B, 0xFF, 0xCA, 0x6A, 0xFF, 0x34, 0xDE, 0xFF, 0xED, 0x8B, 0xFF, 0xA9, 0x62, 0xFF, 0xAD, 0x83, 0xFF, 0x49, 0x5A, 0xFF, 0xEE, 0x93, 0xFF, 0x8D, 0x83, 0xFF, 0xC8, 0x49, 0xFF, 0x09, 0x52, 0xFF, 0x6A, 0x62, 0xFF, 0xD0, 0xA3, 0xFF, 0xC8, 0x51, 0xFF, 0xE9, 0x59, 0xFF, 0x87, 0x41, 0xFF, 0xC8, 0x51, 0xFF, 0xCD, 0x82, 0xFF, 0x67, 0x41, 0xFF, 0x87, 0x41, 0xFF, 0x27, 0x39, 0xFF, 0x88, 0x49, 0xFF, 0xEB, 0x69, 0xFF, 0x28, 0x41, 0xFF, 0x07, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x88, 0x49, 0xFF, 0x6F, 0x9A, 0xFF, 0x07, 0x41, 0xFF, 0xE6, 0x30, 0xFF, 0xE7, 0x30, 0xFF,
-    0x28, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x87, 0x30, 0xFF, 0xA6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0x4B, 0x49, 0xFF, 0xA6, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC6, 0x28, 0xFF, 0xEA, 0x38, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0x28, 0x31, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0xCC, 0x7B, 0xFF, 0x8B, 0x7B, 0xFF, 0x6B, 0x73, 0xFF, 0x2A, 0x6B, 0xFF, 0x4B, 0x73, 0xFF, 0x2A, 0x6B, 0xFF, 0x0A, 0x63, 0xFF, 0xE9, 0x62, 0xFF, 0x6B, 0x7B, 0xFF, 0x0A, 0x6B, 0xFF, 0xEA, 0x62, 0xFF, 0xEB, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0x69, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x69, 0x5A, 0xFF, 0x89, 0x5A, 0xFF, 0x69, 0x5A, 0xFF, 0x49, 0x52, 0xFF, 0x08, 0x52, 0xFF, 0x69, 0x5A, 0xFF, 0x49, 0x5A, 0xFF, 0x29, 0x52, 0xFF, 0xE8, 0x51, 0xFF, 0x08, 0x52, 0xFF, 0xA8, 0x49, 0xFF, 0x29, 0x5A, 0xFF, 0xA8, 0x49, 0xFF, 0xC8, 0x51, 0xFF,
-    0x67, 0x41, 0xFF, 0x67, 0x41, 0xFF, 0xA9, 0x59, 0xFF, 0x2A, 0x5A, 0xFF, 0x47, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0x89, 0x51, 0xFF, 0x28, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x38, 0xFF, 0x68, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x28, 0x39, 0xFF, 0x48, 0x39, 0xFF, 0xC6, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x29, 0x41, 0xFF, 0xA6, 0x28, 0xFF, 0x86, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x30, 0xFF, 0xA6, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x6C, 0x51, 0xFF, 0x2B, 0x41, 0xFF, 0x65, 0x18, 0xFF, 0xA6, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0xEB, 0x40, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x66, 0x18, 0xFF, 0xEB, 0x40, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0x28, 0x31, 0xFF, 0x8B, 0x73, 0xFF, 0x6B, 0x73, 0xFF, 0xB1, 0xC5, 0xFF, 0xEB, 0x6A, 0xFF, 0xEA, 0x62, 0xFF, 0x0A, 0x6B, 0xFF, 0xCA, 0x62, 0xFF, 0x74, 0xE6, 0xFF, 0xA8, 0x5A, 0xFF, 0xAA, 0x5A, 0xFF, 0xAA, 0x62, 0xFF, 0x8A, 0x5A, 0xFF, 0xAC, 0x83, 0xFF, 0x30, 0xB5, 0xFF, 0xA9, 0x62, 0xFF, 0x48, 0x52, 0xFF,
-    0x0B, 0x6B, 0xFF, 0x69, 0x52, 0xFF, 0xF1, 0xBC, 0xFF, 0x49, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0x8D, 0x83, 0xFF, 0x28, 0x52, 0xFF, 0x2F, 0xA4, 0xFF, 0x49, 0x52, 0xFF, 0xE8, 0x49, 0xFF, 0x4D, 0x83, 0xFF, 0xA7, 0x49, 0xFF, 0xE8, 0x59, 0xFF, 0x2D, 0x83, 0xFF, 0x4A, 0x62, 0xFF, 0xA8, 0x49, 0xFF, 0x87, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0xAD, 0x82, 0xFF, 0xC8, 0x51, 0xFF, 0x47, 0x39, 0xFF, 0xC9, 0x59, 0xFF, 0x47, 0x41, 0xFF, 0x4D, 0x7A, 0xFF, 0x27, 0x41, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0xE6, 0x30, 0xFF, 0xEC, 0x61, 0xFF, 0xE8, 0x40, 0xFF, 0x27, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x07, 0x31, 0xFF, 0x4A, 0x51, 0xFF, 0xAB, 0x61, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0x8B, 0x51, 0xFF, 0xA7, 0x28, 0xFF, 0x6B, 0x59, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x2C, 0x49, 0xFF, 0xA9, 0x41, 0xFF, 0xE7, 0x30, 0xFF, 0x87, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE9, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xEB, 0x49, 0xFF, 0x86, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0xA8, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xE7, 0x30, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x30, 0xFF, 0xCB, 0x41, 0xFF, 0x68, 0x39, 0xFF,
-    0x6E, 0x94, 0xFF, 0x2A, 0x6B, 0xFF, 0x0A, 0x6B, 0xFF, 0xEA, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0x6A, 0x73, 0xFF, 0xD4, 0xCE, 0xFF, 0x92, 0xB5, 0xFF, 0xEA, 0x62, 0xFF, 0x68, 0x52, 0xFF, 0x89, 0x5A, 0xFF, 0x32, 0xAD, 0xFF, 0x8C, 0x7B, 0xFF, 0x68, 0x5A, 0xFF, 0x07, 0x4A, 0xFF, 0x08, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0xE9, 0x6A, 0xFF, 0x49, 0x5A, 0xFF, 0x49, 0x52, 0xFF, 0x8D, 0x7B, 0xFF, 0x49, 0x5A, 0xFF, 0x49, 0x52, 0xFF, 0x29, 0x52, 0xFF, 0x28, 0x52, 0xFF, 0xEF, 0x93, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xA8, 0x49, 0xFF, 0xA8, 0x49, 0xFF, 0xA7, 0x49, 0xFF, 0xE9, 0x51, 0xFF, 0x67, 0x39, 0xFF, 0x67, 0x41, 0xFF, 0x68, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0x27, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0xE6, 0x40, 0xFF, 0x27, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x07, 0x39, 0xFF, 0x47, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0x07, 0x31, 0xFF, 0xA6, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0x28, 0x39, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x28, 0x31, 0xFF, 0xC7, 0x30, 0xFF, 0x86, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0xA6, 0x20, 0xFF,
-    0xA6, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xC6, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xA6, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0x65, 0x18, 0xFF, 0x2B, 0x41, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x89, 0x39, 0xFF, 0x09, 0x39, 0xFF, 0xA6, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x30, 0xC5, 0xFF, 0x0A, 0x6B, 0xFF, 0xEB, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0xEA, 0x62, 0xFF, 0xD2, 0xD5, 0xFF, 0x8F, 0x9C, 0xFF, 0x89, 0x5A, 0xFF, 0x69, 0x5A, 0xFF, 0x69, 0x52, 0xFF, 0x0A, 0x6B, 0xFF, 0xF0, 0xBC, 0xFF, 0x48, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x14, 0xC6, 0xFF, 0xAC, 0x83, 0xFF, 0xAF, 0xAC, 0xFF, 0x28, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0x52, 0xAD, 0xFF, 0xAB, 0x62, 0xFF, 0x2F, 0xAC, 0xFF, 0x4A, 0x5A, 0xFF, 0xE8, 0x49, 0xFF, 0x0F, 0x94, 0xFF, 0xC8, 0x49, 0xFF, 0xA8, 0x41, 0xFF, 0x6E, 0x93, 0xFF, 0x87, 0x41, 0xFF, 0xAC, 0x6A, 0xFF, 0x88, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x47, 0x49, 0xFF, 0x2A, 0x62, 0xFF, 0x26, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0x06, 0x39, 0xFF, 0x6C, 0x7A, 0xFF, 0x28, 0x39, 0xFF, 0xE6, 0x30, 0xFF, 0x07, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x0C, 0x6A, 0xFF, 0xE6, 0x30, 0xFF, 0xE7, 0x38, 0xFF,
-    0xE7, 0x30, 0xFF, 0x28, 0x39, 0xFF, 0xEC, 0x69, 0xFF, 0x49, 0x41, 0xFF, 0xA7, 0x28, 0xFF, 0xC6, 0x28, 0xFF, 0x6B, 0x59, 0xFF, 0xA7, 0x28, 0xFF, 0xAD, 0x69, 0xFF, 0xC7, 0x28, 0xFF, 0x86, 0x28, 0xFF, 0x4A, 0x49, 0xFF, 0xE7, 0x30, 0xFF, 0x86, 0x20, 0xFF, 0x4A, 0x49, 0xFF, 0xA7, 0x28, 0xFF, 0x66, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x27, 0x31, 0xFF, 0xA8, 0x30, 0xFF, 0xE9, 0x38, 0xFF, 0xA7, 0x20, 0xFF, 0x28, 0x31, 0xFF, 0x07, 0x29, 0xFF, 0xC7, 0x28, 0xFF, 0x0A, 0x39, 0xFF, 0xA7, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xEA, 0x38, 0xFF, 0xEB, 0x40, 0xFF, 0x0A, 0x63, 0xFF, 0xCA, 0x5A, 0xFF, 0xCA, 0x62, 0xFF, 0x69, 0x5A, 0xFF, 0x91, 0xB5, 0xFF, 0xEA, 0x62, 0xFF, 0xEA, 0x62, 0xFF, 0x89, 0x5A, 0xFF, 0x0B, 0x73, 0xFF, 0xD5, 0xDE, 0xFF, 0x48, 0x52, 0xFF, 0x89, 0x62, 0xFF, 0x89, 0x5A, 0xFF, 0xA9, 0x5A, 0xFF, 0x0A, 0x73, 0xFF, 0x08, 0x4A, 0xFF, 0x08, 0x52, 0xFF, 0x08, 0x52, 0xFF, 0x89, 0x5A, 0xFF, 0x31, 0xBD, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0x08, 0x52, 0xFF, 0x28, 0x5A, 0xFF, 0x71, 0xA4, 0xFF, 0xC7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x41, 0xFF, 0xC8, 0x51, 0xFF, 0x6B, 0x72, 0xFF, 0x67, 0x39, 0xFF, 0x67, 0x41, 0xFF,
-    0x88, 0x49, 0xFF, 0x47, 0x39, 0xFF, 0x26, 0x39, 0xFF, 0x47, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0x27, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0x28, 0x41, 0xFF, 0x07, 0x39, 0xFF, 0xE6, 0x30, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0x07, 0x31, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xAC, 0x59, 0xFF, 0xC7, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0xC8, 0x30, 0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x09, 0x39, 0xFF, 0xC7, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xE7, 0x30, 0xFF, 0x66, 0x18, 0xFF, 0x6C, 0x61, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x2A, 0x39, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0xA6, 0x20, 0xFF, 0xCA, 0x62, 0xFF, 0xCA, 0x5A, 0xFF, 0xCA, 0x62, 0xFF, 0xAA, 0x5A, 0xFF, 0x69, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x8A, 0x5A, 0xFF, 0x29, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x29, 0x52, 0xFF, 0xE8, 0x49, 0xFF, 0x08, 0x4A, 0xFF, 0x28, 0x52, 0xFF, 0x48, 0x5A, 0xFF, 0x08, 0x4A, 0xFF,
-    0x07, 0x4A, 0xFF, 0xE7, 0x49, 0xFF, 0xE8, 0x49, 0xFF, 0x70, 0x9C, 0xFF, 0xAA, 0x72, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0xC8, 0x41, 0xFF, 0x50, 0xA4, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xCC, 0x82, 0xFF, 0x67, 0x41, 0xFF, 0x67, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0x46, 0x39, 0xFF, 0x8C, 0x7A, 0xFF, 0x47, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x27, 0x41, 0xFF, 0xEB, 0x59, 0xFF, 0x28, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x38, 0xFF, 0xC5, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0xC6, 0x30, 0xFF, 0x27, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC6, 0x28, 0xFF, 0xAB, 0x51, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x09, 0x49, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0x29, 0x41, 0xFF, 0xC7, 0x28, 0xFF, 0x66, 0x20, 0xFF, 0x66, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xEA, 0x40, 0xFF, 0xE6, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0x0A, 0x39, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xCA, 0x38, 0xFF, 0xA6, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0x85, 0x18, 0xFF,
-    0xEB, 0x62, 0xFF, 0x27, 0x4A, 0xFF, 0xFA, 0xFF, 0xFF, 0xB2, 0xBD, 0xFF, 0x89, 0x5A, 0xFF, 0xCB, 0x6A, 0xFF, 0x08, 0x52, 0xFF, 0xE7, 0x41, 0xFF, 0x86, 0x39, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0xC7, 0x41, 0xFF, 0x29, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0x28, 0x4A, 0xFF, 0xE7, 0x41, 0xFF, 0x28, 0x4A, 0xFF, 0x08, 0x4A, 0xFF, 0xC8, 0x6A, 0xFF, 0x49, 0x52, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x49, 0xFF, 0xC6, 0x49, 0xFF, 0xAD, 0x8B, 0xFF, 0xC7, 0x49, 0xFF, 0xC7, 0x41, 0xFF, 0x86, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xA8, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0x87, 0x41, 0xFF, 0x46, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0x26, 0x31, 0xFF, 0x47, 0x39, 0xFF, 0x06, 0x31, 0xFF, 0x06, 0x31, 0xFF, 0xE6, 0x30, 0xFF, 0x27, 0x39, 0xFF, 0x28, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x27, 0x41, 0xFF, 0x07, 0x31, 0xFF, 0xC7, 0x30, 0xFF, 0x28, 0x39, 0xFF, 0xE8, 0x38, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0xA6, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF,
-    0xA7, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0xE7, 0x30, 0xFF, 0x86, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x65, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x66, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0x0B, 0x6B, 0xFF, 0xCA, 0x62, 0xFF, 0xE9, 0x62, 0xFF, 0x89, 0x5A, 0xFF, 0x2C, 0x6B, 0xFF, 0x69, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0xAE, 0xA4, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0x71, 0xBD, 0xFF, 0xE8, 0x49, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xA6, 0x41, 0xFF, 0xC7, 0x49, 0xFF, 0xA7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0x0E, 0x9C, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x39, 0xFF, 0x87, 0x41, 0xFF, 0xC8, 0x49, 0xFF, 0xAB, 0x6A, 0xFF, 0x87, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x88, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x47, 0x39, 0xFF, 0xCC, 0x7A, 0xFF, 0x47, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0x06, 0x31, 0xFF, 0x27, 0x39, 0xFF, 0x0B, 0x62, 0xFF, 0x07, 0x39, 0xFF, 0xE6, 0x30, 0xFF, 0x07, 0x31, 0xFF, 0x0B, 0x6A, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x38, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x38, 0xFF,
-    0xE8, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0x6A, 0x51, 0xFF, 0xE7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x6A, 0x51, 0xFF, 0xA7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0xA6, 0x28, 0xFF, 0x87, 0x28, 0xFF, 0x2A, 0x41, 0xFF, 0xA7, 0x28, 0xFF, 0xC6, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x30, 0xFF, 0x69, 0x41, 0xFF, 0x86, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x07, 0x31, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0xE8, 0x30, 0xFF, 0x66, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xE9, 0x30, 0xFF, 0xA6, 0x20, 0xFF, 0x65, 0x18, 0xFF, 0x6E, 0x9C, 0xFF, 0x69, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x4C, 0x6B, 0xFF, 0x49, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x28, 0x52, 0xFF, 0x28, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0x28, 0x52, 0xFF, 0xE7, 0x49, 0xFF, 0xE7, 0x41, 0xFF, 0x08, 0x4A, 0xFF, 0xC8, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xE7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x39, 0xFF, 0xC7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x39, 0xFF, 0x87, 0x39, 0xFF, 0x46, 0x39, 0xFF, 0x4A, 0x62, 0xFF, 0x47, 0x39, 0xFF, 0x47, 0x39, 0xFF, 0x47, 0x31, 0xFF,
-    0x87, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x06, 0x31, 0xFF, 0x27, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0x06, 0x31, 0xFF, 0x27, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xA9, 0x51, 0xFF, 0x08, 0x39, 0xFF, 0x08, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x28, 0xFF, 0x66, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x28, 0xFF, 0x48, 0x39, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x08, 0x31, 0xFF, 0x86, 0x20, 0xFF, 0x65, 0x18, 0xFF, 0x45, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xA6, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0x66, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0x2D, 0x94, 0xFF, 0x89, 0x5A, 0xFF, 0x6D, 0x73, 0xFF, 0x69, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x4E, 0x9C, 0xFF, 0x28, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0x08, 0x4A, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x41, 0xFF, 0xEE, 0x93, 0xFF, 0x08, 0x4A, 0xFF, 0x48, 0x4A, 0xFF, 0xC7, 0x41, 0xFF, 0xE8, 0x41, 0xFF,
-    0xEE, 0x9B, 0xFF, 0xC7, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0x4D, 0x8B, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x41, 0xFF, 0x87, 0x39, 0xFF, 0x87, 0x41, 0xFF, 0xB4, 0x29, 0xFF, 0xAD, 0x7A, 0xFF, 0x46, 0x39, 0xFF, 0x47, 0x39, 0xFF, 0xA8, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0x09, 0x5A, 0xFF, 0x47, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0x06, 0x39, 0xFF, 0x06, 0x39, 0xFF, 0x2C, 0x6A, 0xFF, 0x07, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0xCB, 0x61, 0xFF, 0xE7, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0xC7, 0x30, 0xFF, 0xA6, 0x28, 0xFF, 0xAB, 0x59, 0xFF, 0x4A, 0x49, 0xFF, 0xA7, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0x86, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x6B, 0x59, 0xFF, 0xC7, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x89, 0x41, 0xFF, 0x86, 0x20, 0xFF, 0x2B, 0x51, 0xFF, 0xE8, 0x30, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x38, 0xFF, 0xCA, 0x49, 0xFF, 0x86, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0x45, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0x45, 0x18, 0xFF, 0xE9, 0x30, 0xFF,
+    0x57, 0x10, 0x36, 0x08, 0x56, 0x10, 0x55, 0x08, 0x34, 0x00, 0xDB, 0x20, 0x33, 0x00, 0x32, 0x00, 0x11, 0x00, 0x31, 0x00, 0xBA, 0x20, 0x51, 0x00, 0x91, 0x10, 0x31, 0x00, 0x52, 0x08, 0xBA, 0x28, 0x2C, 0x00, 0x0C, 0x00, 0x4C, 0x08, 0x2C, 0x08, 0xD6, 0x30, 0x2B, 0x08, 0x2A, 0x10, 0x0F, 0x31, 0x0A, 0x08, 0x0B, 0x10, 0x29, 0x10, 0x29, 0x10, 0x29, 0x10, 0xD5, 0x38, 0x2B, 0x18, 0x6A, 0x18,
+    0x8A, 0x20, 0x49, 0x18, 0xB3, 0x48, 0x29, 0x18, 0xD0, 0x30, 0x08, 0x10, 0x2A, 0x18, 0x56, 0x69, 0x2A, 0x18, 0x29, 0x18, 0x2A, 0x20, 0x2A, 0x20, 0xBA, 0x70, 0x6B, 0x28, 0x2A, 0x20, 0x0B, 0x20, 0x0D, 0x28, 0x9D, 0x60, 0x2F, 0x30, 0x13, 0x48, 0x13, 0x40, 0x76, 0x58, 0x3A, 0x60, 0x13, 0x38, 0x1E, 0xA0, 0x3F, 0x88, 0x19, 0x50, 0xDF, 0x78, 0x1D, 0x48, 0x1B, 0x28, 0xFF, 0xB0, 0xBF, 0x50,
+    0x1E, 0x48, 0x1F, 0x40, 0x36, 0x28, 0x53, 0x28, 0x14, 0x28, 0x16, 0x20, 0x13, 0x18, 0x30, 0x20, 0x32, 0x28, 0x74, 0x38, 0x12, 0x20, 0x0E, 0x18, 0x10, 0x20, 0x0C, 0x10, 0x0D, 0x18, 0x2D, 0x20, 0x59, 0x10, 0x58, 0x10, 0x37, 0x08, 0x36, 0x08, 0x56, 0x08, 0x34, 0x00, 0x34, 0x00, 0x34, 0x00, 0x32, 0x00, 0x31, 0x00, 0x31, 0x00, 0x10, 0x00, 0x30, 0x00, 0x0E, 0x00, 0x0F, 0x08, 0x0E, 0x00,
+    0x2E, 0x08, 0x0C, 0x00, 0x2C, 0x08, 0x2B, 0x08, 0x0B, 0x08, 0x4B, 0x10, 0x2A, 0x08, 0x0A, 0x08, 0x2A, 0x08, 0x2A, 0x10, 0x09, 0x08, 0x29, 0x10, 0x29, 0x10, 0x29, 0x10, 0x6B, 0x18, 0x29, 0x18, 0x29, 0x10, 0x6A, 0x20, 0x29, 0x18, 0x49, 0x18, 0x4A, 0x20, 0x29, 0x18, 0x4A, 0x18, 0x29, 0x18, 0x29, 0x18, 0x4A, 0x20, 0x28, 0x10, 0x09, 0x18, 0x2A, 0x18, 0x4B, 0x20, 0x09, 0x18, 0x0A, 0x18,
+    0x0A, 0x18, 0x2B, 0x18, 0x2B, 0x20, 0x2B, 0x18, 0x2C, 0x20, 0x2F, 0x30, 0x0F, 0x28, 0x36, 0x48, 0x38, 0x58, 0x39, 0x48, 0x55, 0x40, 0xDF, 0xD0, 0x1D, 0x38, 0x1C, 0x30, 0x5F, 0xD2, 0x1F, 0x38, 0x1E, 0x30, 0x16, 0x28, 0x59, 0x28, 0x33, 0x28, 0x11, 0x18, 0x37, 0x20, 0x34, 0x20, 0x32, 0x20, 0xB7, 0x60, 0x37, 0x20, 0x34, 0x28, 0x32, 0x20, 0x11, 0x20, 0x31, 0x28, 0x2E, 0x18, 0x2D, 0x18,
+    0x59, 0x10, 0x59, 0x10, 0x18, 0x08, 0x78, 0x10, 0x58, 0x08, 0x56, 0x00, 0x35, 0x00, 0x7A, 0x18, 0x13, 0x00, 0x53, 0x00, 0x32, 0x00, 0x11, 0x00, 0x96, 0x18, 0x53, 0x10, 0x2F, 0x08, 0x2E, 0x08, 0xB6, 0x28, 0x2E, 0x08, 0x1F, 0x41, 0x2C, 0x08, 0x2D, 0x10, 0x70, 0x20, 0x2B, 0x10, 0x2C, 0x18, 0x0A, 0x10, 0xB1, 0x30, 0x4B, 0x18, 0x29, 0x10, 0x4B, 0x18, 0x2A, 0x10, 0x0D, 0x20, 0x29, 0x10,
+    0x29, 0x18, 0x29, 0x18, 0x0B, 0x18, 0x4A, 0x20, 0x29, 0x18, 0x29, 0x18, 0x4B, 0x20, 0xD7, 0x68, 0x2A, 0x20, 0x29, 0x18, 0x29, 0x18, 0x2A, 0x20, 0xD5, 0x60, 0x4A, 0x20, 0x09, 0x18, 0x71, 0x49, 0x52, 0x40, 0xF5, 0x68, 0x0B, 0x20, 0x0C, 0x20, 0xF3, 0x58, 0x5E, 0xA1, 0x2E, 0x28, 0x53, 0x40, 0x15, 0x40, 0x15, 0x28, 0x9E, 0x78, 0x3F, 0xFB, 0x3A, 0x60, 0x3E, 0x58, 0x3C, 0x80, 0x9F, 0x80,
+    0x3E, 0x30, 0x75, 0x50, 0x16, 0x18, 0x54, 0x30, 0x10, 0x18, 0x15, 0x18, 0x34, 0x48, 0x14, 0x20, 0x16, 0x20, 0x17, 0x20, 0x3D, 0x28, 0xB3, 0x40, 0x14, 0x30, 0x0E, 0x18, 0x0E, 0x18, 0x0C, 0x10, 0x5B, 0x08, 0x5A, 0x10, 0x5A, 0x10, 0xFF, 0x18, 0x38, 0x00, 0x38, 0x00, 0x57, 0x00, 0x16, 0x00, 0xBF, 0x08, 0x54, 0x00, 0x12, 0x00, 0x32, 0x00, 0x32, 0x08, 0xDB, 0x30, 0x10, 0x00, 0x2F, 0x08,
+    0x2E, 0x08, 0x4E, 0x08, 0xFC, 0x30, 0x37, 0x4A, 0x4C, 0x10, 0x2B, 0x08, 0x2B, 0x10, 0xB3, 0x49, 0x90, 0x28, 0x2B, 0x10, 0x2C, 0x18, 0x29, 0x10, 0x0A, 0x10, 0x37, 0x51, 0x4C, 0x20, 0x2A, 0x18, 0x29, 0x10, 0x8B, 0x20, 0xF7, 0x79, 0x0A, 0x10, 0x09, 0x18, 0x29, 0x18, 0x2A, 0x20, 0x11, 0x50, 0x0A, 0x18, 0x0A, 0x18, 0x09, 0x10, 0x4A, 0x28, 0xF5, 0x80, 0x2B, 0x28, 0x0A, 0x18, 0x2A, 0x18,
+    0xF5, 0x60, 0x97, 0x70, 0x0C, 0x20, 0x2C, 0x20, 0x2D, 0x20, 0x4F, 0x28, 0x31, 0x30, 0x11, 0x30, 0x15, 0x38, 0x79, 0x60, 0x7F, 0xB8, 0x7F, 0xFA, 0x1E, 0x60, 0x5C, 0x48, 0x1F, 0xEB, 0x5F, 0xA1, 0x1F, 0x38, 0x1F, 0x68, 0x11, 0x28, 0x14, 0x20, 0x1F, 0x28, 0x38, 0x20, 0x77, 0x50, 0x15, 0x28, 0x15, 0x18, 0x13, 0x18, 0x30, 0x20, 0x94, 0x40, 0x34, 0x30, 0x30, 0x20, 0x2E, 0x18, 0x2D, 0x18,
+    0x7C, 0x10, 0x5B, 0x10, 0x5B, 0x08, 0x3A, 0x08, 0x5B, 0x08, 0x59, 0x08, 0x38, 0x00, 0x37, 0x00, 0x57, 0x08, 0x36, 0x08, 0x13, 0x00, 0x33, 0x00, 0x12, 0x00, 0xF8, 0x30, 0x31, 0x08, 0x30, 0x08, 0x0E, 0x00, 0x51, 0x10, 0x0E, 0x08, 0x2D, 0x08, 0x2C, 0x08, 0x10, 0x31, 0x6F, 0x20, 0x0B, 0x10, 0x0C, 0x10, 0x4D, 0x18, 0xF5, 0x50, 0x09, 0x08, 0x2A, 0x10, 0x77, 0x61, 0x4C, 0x20, 0x2A, 0x18,
+    0x29, 0x18, 0x2A, 0x18, 0x76, 0x69, 0x4D, 0x28, 0x2A, 0x18, 0x49, 0x18, 0x2A, 0x20, 0xD6, 0x68, 0x09, 0x18, 0x2A, 0x18, 0x29, 0x18, 0x2B, 0x20, 0x73, 0x50, 0x4B, 0x20, 0x2A, 0x18, 0xD1, 0x38, 0x39, 0x89, 0xB7, 0x68, 0x0C, 0x20, 0x0C, 0x20, 0x0D, 0x20, 0x0F, 0x20, 0xB6, 0x70, 0x32, 0x30, 0x15, 0x41, 0x13, 0x28, 0x7F, 0xC0, 0x1B, 0x78, 0x1F, 0x50, 0x3E, 0x50, 0x7F, 0x88, 0x1F, 0x60,
+    0x79, 0x60, 0x1F, 0xA1, 0x3A, 0x30, 0x19, 0x20, 0x7F, 0x38, 0x76, 0x58, 0x16, 0x20, 0x13, 0x18, 0x13, 0x18, 0x33, 0x28, 0x74, 0x40, 0x33, 0x28, 0x33, 0x28, 0x2F, 0x20, 0x0E, 0x20, 0x0F, 0x28, 0x3D, 0x08, 0x5D, 0x08, 0x5D, 0x08, 0x5C, 0x08, 0x3B, 0x00, 0x9F, 0x08, 0x7E, 0x00, 0x58, 0x08, 0x57, 0x00, 0x37, 0x00, 0xBF, 0x20, 0xB8, 0x10, 0x33, 0x08, 0x31, 0x00, 0x34, 0x10, 0xFC, 0x30,
+    0xB5, 0x20, 0x4F, 0x08, 0xF5, 0x38, 0x90, 0x18, 0x93, 0x20, 0x2D, 0x10, 0x2C, 0x08, 0x2B, 0x10, 0x6D, 0x18, 0x4D, 0x18, 0x2A, 0x10, 0x2F, 0x28, 0x2A, 0x10, 0x94, 0x38, 0x4B, 0x18, 0xB3, 0x40, 0x29, 0x10, 0x8D, 0x28, 0xF4, 0x58, 0x4E, 0x28, 0x2A, 0x18, 0x29, 0x18, 0xD2, 0x79, 0xBA, 0x91, 0x2A, 0x18, 0x29, 0x18, 0x09, 0x18, 0x2B, 0x28, 0xD5, 0x60, 0x0A, 0x18, 0x0A, 0x18, 0x0B, 0x20,
+    0x0F, 0x30, 0xDF, 0xF4, 0x2D, 0x28, 0x8E, 0x30, 0x3B, 0x68, 0x2F, 0x20, 0x52, 0x30, 0x31, 0x28, 0x1B, 0x60, 0x16, 0x30, 0x3F, 0x88, 0x3F, 0xA0, 0x3C, 0x58, 0x3F, 0x50, 0x1F, 0x50, 0x1F, 0x48, 0x3D, 0x28, 0x3F, 0xD3, 0x9E, 0x38, 0x1A, 0x28, 0x1F, 0x38, 0x39, 0x40, 0x14, 0x18, 0x34, 0x20, 0x52, 0x20, 0x78, 0x40, 0x30, 0x18, 0x51, 0x20, 0x2F, 0x18, 0x2E, 0x18, 0x4F, 0x20, 0x2D, 0x18,
+    0x7F, 0x08, 0x3F, 0x08, 0x5F, 0x08, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x1A, 0x00, 0x5B, 0x08, 0x38, 0x00, 0x37, 0x00, 0x15, 0x00, 0x1E, 0x31, 0x75, 0x08, 0x32, 0x00, 0x11, 0x00, 0x52, 0x08, 0xF6, 0x30, 0x2F, 0x08, 0x0E, 0x08, 0x2D, 0x08, 0x0E, 0x08, 0x0C, 0x08, 0x0B, 0x08, 0x2C, 0x10, 0x2B, 0x10, 0x14, 0x49, 0x2B, 0x10, 0x6C, 0x20, 0x2A, 0x10, 0x2A, 0x10, 0xB1, 0x38, 0x4B, 0x20,
+    0x2A, 0x18, 0x4B, 0x20, 0x2A, 0x18, 0x4C, 0x20, 0x4A, 0x18, 0x49, 0x18, 0x2A, 0x20, 0xD7, 0x70, 0x2A, 0x20, 0x2A, 0x18, 0x2A, 0x18, 0x0B, 0x18, 0x73, 0x58, 0x2B, 0x20, 0x4C, 0x20, 0x0C, 0x20, 0x0C, 0x20, 0x2D, 0x20, 0x4E, 0x28, 0x2E, 0x20, 0x2F, 0x28, 0x2F, 0x38, 0x2F, 0x20, 0x73, 0x30, 0x13, 0x28, 0x13, 0x28, 0x99, 0x60, 0x1F, 0x58, 0x3F, 0x48, 0x3F, 0x40, 0x3F, 0x48, 0xDF, 0x71,
+    0x3F, 0xFD, 0xBF, 0xE3, 0x16, 0x28, 0x3A, 0x68, 0x3F, 0x58, 0x1C, 0x10, 0x15, 0x18, 0x35, 0x20, 0xB5, 0x48, 0x50, 0x18, 0x30, 0x18, 0x30, 0x18, 0x91, 0x30, 0x74, 0x38, 0x2E, 0x18, 0x0C, 0x10, 0x7F, 0x08, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3D, 0x08, 0x5D, 0x08, 0x3C, 0x00, 0x1A, 0x00, 0x38, 0x00, 0x37, 0x00, 0x77, 0x08, 0x17, 0x00, 0x37, 0x08, 0x32, 0x08, 0x53, 0x08,
+    0x73, 0x18, 0x31, 0x08, 0x7F, 0x41, 0x10, 0x08, 0x90, 0x18, 0x0D, 0x08, 0x2D, 0x10, 0x50, 0x20, 0x4C, 0x18, 0x4C, 0x18, 0x0A, 0x10, 0x2C, 0x18, 0x6D, 0x20, 0x6A, 0x18, 0xAF, 0x30, 0x4C, 0x20, 0x6B, 0x20, 0x6C, 0x28, 0x2A, 0x20, 0x4C, 0x28, 0xED, 0x38, 0x29, 0x18, 0x6B, 0x28, 0x16, 0x69, 0x2B, 0x20, 0x4B, 0x20, 0x4B, 0x20, 0x2D, 0x28, 0xD3, 0x58, 0x0C, 0x20, 0x2D, 0x20, 0x2F, 0x30,
+    0x0E, 0x28, 0x0F, 0x28, 0x2F, 0x28, 0x11, 0x30, 0x31, 0x30, 0x10, 0x28, 0x11, 0x28, 0x32, 0x30, 0x13, 0x28, 0x12, 0x28, 0x37, 0x30, 0x19, 0x38, 0xD7, 0x68, 0x36, 0x28, 0x1E, 0x28, 0x1F, 0x59, 0x3F, 0xF5, 0x58, 0x50, 0x78, 0x40, 0x14, 0x20, 0x1B, 0x20, 0x3C, 0x20, 0xF9, 0x48, 0x11, 0x20, 0x30, 0x20, 0x30, 0x18, 0x2F, 0x18, 0x75, 0x40, 0x94, 0x58, 0x2E, 0x18, 0x2E, 0x18, 0x4D, 0x18,
+    0x3F, 0x00, 0x3F, 0x00, 0x5F, 0x00, 0x9F, 0x01, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x1F, 0x01, 0x5D, 0x00, 0x37, 0x00, 0x16, 0x00, 0x57, 0x10, 0x3F, 0x29, 0x5C, 0x29, 0x73, 0x08, 0x73, 0x10, 0x13, 0x10, 0xFB, 0x28, 0xD1, 0x20, 0xB3, 0x30, 0x2E, 0x10, 0x92, 0x28, 0x10, 0x08, 0xB7, 0x61, 0x2D, 0x18, 0x93, 0x40, 0x4C, 0x18, 0xD3, 0x40, 0x90, 0x30, 0x90, 0x30, 0xCE, 0x38,
+    0x6F, 0x30, 0x4C, 0x20, 0x79, 0x79, 0x70, 0x30, 0x29, 0x20, 0x4A, 0x18, 0x8D, 0x28, 0x16, 0x89, 0x0A, 0x20, 0x2B, 0x20, 0x4B, 0x20, 0x0D, 0x20, 0x96, 0x70, 0x0C, 0x20, 0x2E, 0x28, 0x55, 0x40, 0x59, 0x70, 0xB6, 0x68, 0x91, 0x48, 0x1E, 0x68, 0x54, 0x40, 0x11, 0x28, 0x14, 0x40, 0x1E, 0x89, 0x1B, 0x69, 0x1C, 0xA9, 0x1E, 0x69, 0x3E, 0x60, 0x15, 0x28, 0x18, 0x30, 0x1E, 0x28, 0x1F, 0x40,
+    0x1F, 0x6A, 0x3D, 0x48, 0x15, 0x30, 0x16, 0x28, 0x1A, 0x20, 0x15, 0x18, 0x34, 0x30, 0xB6, 0x38, 0x51, 0x20, 0x30, 0x18, 0x30, 0x20, 0x52, 0x40, 0x2F, 0x18, 0x0E, 0x18, 0x2E, 0x18, 0x51, 0x28, 0x5F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x1D, 0x00, 0x1C, 0x00, 0x5C, 0x08, 0x9C, 0x18, 0x38, 0x00, 0x38, 0x00, 0x15, 0x00, 0xDC, 0x28, 0x54, 0x08,
+    0x72, 0x08, 0x52, 0x10, 0xF6, 0x38, 0x9E, 0x49, 0x2E, 0x10, 0xD3, 0x30, 0x2E, 0x10, 0x2C, 0x10, 0x3A, 0x61, 0x6F, 0x20, 0x0B, 0x10, 0x4D, 0x20, 0x2B, 0x18, 0x38, 0x69, 0x2B, 0x18, 0x13, 0x51, 0x2C, 0x18, 0x6B, 0x20, 0x38, 0x79, 0x6F, 0x30, 0x2B, 0x20, 0x2A, 0x18, 0x8C, 0x28, 0xF5, 0x68, 0x2B, 0x20, 0x2B, 0x20, 0x4B, 0x20, 0x0C, 0x20, 0xF7, 0x78, 0x2D, 0x20, 0x4E, 0x28, 0xB7, 0x50,
+    0x18, 0x69, 0xB6, 0x70, 0x2F, 0x28, 0x11, 0x28, 0x59, 0x70, 0x31, 0x30, 0xB7, 0x70, 0x32, 0x28, 0x3B, 0x70, 0x13, 0x28, 0x1D, 0x60, 0x98, 0x68, 0x14, 0x28, 0x17, 0x20, 0x3F, 0x60, 0x3D, 0x28, 0x58, 0x58, 0x3A, 0x58, 0x35, 0x20, 0x15, 0x20, 0x14, 0x20, 0x75, 0x40, 0x32, 0x18, 0x32, 0x20, 0x31, 0x18, 0x9B, 0x58, 0x10, 0x30, 0x30, 0x18, 0x30, 0x20, 0x91, 0x28, 0x12, 0x28, 0x93, 0x48,
+    0x5F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x11, 0x3F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x5D, 0x00, 0x9E, 0x18, 0x3A, 0x00, 0x58, 0x08, 0x36, 0x00, 0x35, 0x08, 0x34, 0x10, 0x32, 0x08, 0x32, 0x08, 0x30, 0x08, 0x0F, 0x08, 0x2E, 0x08, 0x2F, 0x10, 0x2F, 0x10, 0x0D, 0x10, 0x2D, 0x10, 0x2E, 0x18, 0x2C, 0x10, 0x0D, 0x18, 0x0B, 0x10, 0x4D, 0x20, 0x6D, 0x20, 0x6E, 0x30,
+    0x6C, 0x20, 0x6D, 0x28, 0x0A, 0x18, 0x6E, 0x30, 0x2C, 0x20, 0x2A, 0x18, 0x8D, 0x28, 0x52, 0x61, 0x4B, 0x20, 0x4B, 0x20, 0x2B, 0x18, 0x0D, 0x28, 0xF2, 0x58, 0x2D, 0x20, 0x90, 0x30, 0x91, 0x38, 0x30, 0x28, 0x30, 0x30, 0x10, 0x28, 0x50, 0x28, 0x32, 0x30, 0x31, 0x30, 0x19, 0x40, 0x12, 0x28, 0x13, 0x28, 0x14, 0x30, 0x54, 0x30, 0x34, 0x28, 0x7B, 0x58, 0x7F, 0x88, 0x16, 0x20, 0x19, 0x20,
+    0xFF, 0x90, 0x17, 0x28, 0x15, 0x20, 0x35, 0x20, 0x5F, 0x70, 0x33, 0x20, 0x33, 0x20, 0x12, 0x18, 0x18, 0x40, 0x33, 0x20, 0x31, 0x20, 0x30, 0x20, 0x54, 0x30, 0x94, 0x48, 0x2F, 0x18, 0x2F, 0x20, 0x3F, 0x00, 0x3F, 0x00, 0xDF, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0xFF, 0x08, 0x3F, 0x00, 0x1C, 0x00, 0x3A, 0x00, 0xBF, 0x10, 0x58, 0x08, 0x37, 0x08, 0x56, 0x08, 0x77, 0x10,
+    0x3C, 0x39, 0x94, 0x10, 0x30, 0x00, 0x31, 0x10, 0x10, 0x08, 0x0F, 0x10, 0x2F, 0x10, 0x0E, 0x10, 0x4E, 0x10, 0xF7, 0x50, 0x2C, 0x10, 0x4D, 0x20, 0x0C, 0x18, 0xAF, 0x30, 0x76, 0x61, 0x2C, 0x18, 0x6C, 0x20, 0x6C, 0x28, 0x0C, 0x20, 0x70, 0x38, 0x6E, 0x30, 0x49, 0x18, 0x4D, 0x28, 0x14, 0x69, 0xB2, 0x61, 0x2B, 0x20, 0x0A, 0x18, 0x0D, 0x28, 0xBF, 0xB1, 0x4E, 0x28, 0x4F, 0x28, 0x91, 0x38,
+    0x73, 0x40, 0x10, 0x30, 0x33, 0x30, 0x51, 0x30, 0x32, 0x40, 0x55, 0x58, 0xF7, 0x60, 0x33, 0x30, 0x14, 0x28, 0x3C, 0x60, 0xBE, 0x80, 0x16, 0x28, 0x1A, 0x30, 0x15, 0x30, 0x18, 0x20, 0x1B, 0x28, 0x3D, 0x58, 0x36, 0x28, 0x36, 0x28, 0x3E, 0x48, 0x35, 0x20, 0x14, 0x20, 0x13, 0x20, 0x14, 0x20, 0x34, 0x28, 0x33, 0x20, 0x31, 0x20, 0x55, 0x30, 0x31, 0x20, 0x10, 0x18, 0x73, 0x28, 0x30, 0x18,
+    0x3F, 0x00, 0xFF, 0x01, 0x5D, 0x06, 0x3F, 0x06, 0x5F, 0x01, 0x3F, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x7F, 0x00, 0x9E, 0x18, 0xBD, 0x20, 0x38, 0x00, 0x36, 0x00, 0x98, 0x18, 0x5A, 0x39, 0x13, 0x08, 0x30, 0x08, 0x93, 0x28, 0x0F, 0x10, 0x0F, 0x10, 0x0E, 0x18, 0xB3, 0x38, 0x2F, 0x18, 0xF6, 0x58, 0x4C, 0x18, 0xB2, 0x40, 0x4C, 0x20, 0x13, 0x51, 0xCF, 0x38,
+    0x2E, 0x30, 0x6F, 0x30, 0x4B, 0x20, 0x71, 0x48, 0x0B, 0x20, 0x2A, 0x18, 0x8D, 0x30, 0x15, 0x79, 0x2C, 0x28, 0x0A, 0x18, 0x2A, 0x20, 0x75, 0x48, 0x7A, 0x89, 0x2E, 0x28, 0x4E, 0x28, 0x58, 0x50, 0x1A, 0x89, 0x0F, 0x30, 0x52, 0x30, 0x9F, 0x88, 0x31, 0x30, 0x98, 0x50, 0x34, 0x38, 0x3B, 0x99, 0x5B, 0x40, 0x5A, 0x70, 0x14, 0x30, 0x17, 0x28, 0xDA, 0x78, 0x16, 0x28, 0x3D, 0x40, 0xDF, 0x88,
+    0x37, 0x20, 0x37, 0x30, 0xBD, 0x60, 0xDA, 0x40, 0x36, 0x28, 0x15, 0x20, 0x15, 0x28, 0x98, 0x58, 0x13, 0x20, 0x12, 0x18, 0x35, 0x28, 0x15, 0x38, 0x75, 0x48, 0x38, 0x28, 0x31, 0x18, 0x73, 0x28, 0x7F, 0x01, 0x9E, 0x02, 0xFF, 0xDF, 0xFF, 0xFF, 0xBD, 0x03, 0x1F, 0x1B, 0x3F, 0x2B, 0x1E, 0x00, 0xFF, 0x0B, 0x1B, 0x09, 0x7E, 0x08, 0x1E, 0x21, 0x5A, 0x18, 0x3F, 0x39, 0x99, 0x20, 0x96, 0x18,
+    0x34, 0x08, 0x33, 0x08, 0xDB, 0x69, 0x57, 0x52, 0x0F, 0x08, 0x92, 0x30, 0x70, 0x20, 0xB3, 0x38, 0xB1, 0x38, 0x11, 0x41, 0x0B, 0x10, 0x2D, 0x20, 0x4D, 0x20, 0x15, 0x82, 0xB2, 0x59, 0xAE, 0x40, 0x8D, 0x40, 0x6C, 0x28, 0x15, 0x71, 0x6F, 0x40, 0xD3, 0x60, 0x0A, 0x28, 0x6D, 0x30, 0xB7, 0xC9, 0x6E, 0x40, 0x2A, 0x18, 0x2B, 0x20, 0x56, 0x50, 0x94, 0x70, 0xD1, 0x48, 0x72, 0x40, 0xD7, 0x68,
+    0x17, 0x69, 0xD6, 0x78, 0x73, 0x40, 0xB6, 0x50, 0x5C, 0x91, 0xD4, 0x50, 0x7A, 0x58, 0xD8, 0x58, 0x7E, 0x80, 0x34, 0x38, 0x7C, 0x78, 0x7F, 0x50, 0x19, 0x48, 0x17, 0x30, 0x1E, 0xBB, 0x17, 0x20, 0x37, 0x20, 0x9C, 0x58, 0x3A, 0x30, 0x58, 0x30, 0x17, 0x20, 0x5A, 0x48, 0x17, 0x30, 0x35, 0x28, 0x34, 0x20, 0xFF, 0x60, 0x36, 0x30, 0x74, 0x30, 0x55, 0x28, 0x11, 0x20, 0x31, 0x20, 0x33, 0x28,
+    0x1F, 0x00, 0x3F, 0x00, 0x9F, 0x02, 0x1F, 0x03, 0x7D, 0x01, 0xBF, 0x00, 0x1F, 0x00, 0x5F, 0x00, 0x1F, 0x00, 0x5F, 0x21, 0x9F, 0x18, 0x1B, 0x00, 0x59, 0x08, 0x38, 0x08, 0x1F, 0x41, 0x57, 0x18, 0x55, 0x08, 0x53, 0x10, 0x74, 0x18, 0x5D, 0x59, 0x4F, 0x10, 0x50, 0x18, 0x92, 0x30, 0x4E, 0x18, 0x37, 0x59, 0x4F, 0x20, 0x2C, 0x18, 0x50, 0x30, 0x2D, 0x20, 0x36, 0x79, 0x4D, 0x28, 0x2E, 0x30,
+    0x6C, 0x28, 0x4D, 0x28, 0x14, 0x71, 0x6F, 0x40, 0x91, 0x48, 0x0B, 0x20, 0x6E, 0x38, 0x15, 0x81, 0x0C, 0x28, 0x0A, 0x20, 0x0C, 0x20, 0x57, 0x58, 0xF7, 0x80, 0x4F, 0x30, 0x36, 0x40, 0x74, 0x48, 0x50, 0x30, 0xF8, 0x80, 0x36, 0x40, 0x73, 0x40, 0x38, 0x48, 0x34, 0x38, 0xB9, 0x80, 0x15, 0x38, 0x5A, 0x60, 0x18, 0x40, 0x3A, 0x48, 0x5C, 0x78, 0x18, 0x40, 0x3B, 0x58, 0x1A, 0x28, 0x19, 0x20,
+    0x5D, 0x50, 0x3C, 0x38, 0x5C, 0x38, 0x19, 0x28, 0xDF, 0x70, 0x16, 0x38, 0x1B, 0x69, 0x57, 0x30, 0x5A, 0x48, 0x36, 0x30, 0x78, 0x58, 0xF7, 0x48, 0xF8, 0x40, 0x75, 0x30, 0x53, 0x28, 0x56, 0x50, 0x5F, 0x00, 0x5F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x3F, 0x21, 0x5F, 0x00, 0x5F, 0x00, 0x1D, 0x00, 0x5D, 0x00, 0x1F, 0x29, 0x5B, 0x08, 0x59, 0x10, 0x37, 0x08, 0x56, 0x10,
+    0x15, 0x10, 0x73, 0x18, 0x51, 0x10, 0x52, 0x18, 0x38, 0x61, 0x50, 0x18, 0x92, 0x28, 0x0F, 0x18, 0x4F, 0x20, 0x55, 0x71, 0xB1, 0x38, 0x70, 0x28, 0x6F, 0x30, 0x4D, 0x28, 0x4F, 0x30, 0x6F, 0x38, 0x4D, 0x28, 0xB1, 0x40, 0x2E, 0x30, 0x70, 0x38, 0x6F, 0x40, 0x6F, 0x30, 0x6E, 0x38, 0x94, 0x80, 0x4F, 0x30, 0x4F, 0x30, 0x0D, 0x28, 0x77, 0x58, 0xB5, 0x78, 0x2F, 0x38, 0x54, 0x40, 0x12, 0x40,
+    0x32, 0x38, 0x57, 0x50, 0x9B, 0x68, 0x36, 0x48, 0x36, 0x40, 0x78, 0x58, 0x58, 0x48, 0x17, 0x40, 0x18, 0x40, 0x1C, 0x50, 0x5D, 0x88, 0x5B, 0x58, 0x1D, 0x48, 0x1B, 0x38, 0x1E, 0x40, 0x7F, 0x70, 0x1F, 0x28, 0x1F, 0x38, 0x1F, 0x38, 0xDF, 0x90, 0x9F, 0x80, 0x5A, 0x30, 0x3A, 0x30, 0x39, 0x30, 0x7E, 0x68, 0x17, 0x30, 0x59, 0x38, 0x15, 0x28, 0x56, 0x30, 0x35, 0x40, 0x74, 0x30, 0x14, 0x20,
+    0x9F, 0x10, 0x7F, 0x08, 0x5F, 0x00, 0x5F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x5E, 0x00, 0x7F, 0x08, 0xDF, 0x20, 0x7F, 0x00, 0x5E, 0x08, 0x3B, 0x10, 0xDB, 0x30, 0x59, 0x18, 0x39, 0x08, 0x56, 0x10, 0x19, 0x39, 0x76, 0x28, 0x53, 0x10, 0x31, 0x18, 0x72, 0x20, 0x31, 0x28, 0x30, 0x20, 0x0E, 0x18, 0x2F, 0x20, 0x2F, 0x28, 0x0D, 0x20, 0x6F, 0x28, 0xD3, 0x48, 0x4C, 0x28, 0xF3, 0x58, 0xCF, 0x38,
+    0x2D, 0x30, 0x4E, 0x30, 0x0C, 0x28, 0x71, 0x40, 0xD0, 0x48, 0x4D, 0x28, 0x6F, 0x38, 0x0F, 0x40, 0x0F, 0x30, 0x2F, 0x30, 0x2E, 0x30, 0x76, 0x58, 0x53, 0x60, 0x51, 0x38, 0x13, 0x38, 0x33, 0x40, 0x33, 0x38, 0x36, 0x48, 0x55, 0x48, 0x5D, 0xA1, 0x36, 0x48, 0x1A, 0x71, 0x39, 0x50, 0x17, 0x40, 0x3D, 0x58, 0x1D, 0x60, 0x5C, 0x68, 0x1B, 0x38, 0x1C, 0x40, 0x3C, 0x40, 0x7F, 0x88, 0x1F, 0x38,
+    0x7E, 0x38, 0xBD, 0x50, 0x7F, 0x90, 0x3F, 0x40, 0x5F, 0x40, 0x5F, 0x38, 0x1F, 0x38, 0x1B, 0x48, 0x19, 0x28, 0xDF, 0x50, 0x19, 0x30, 0x3E, 0x50, 0x7D, 0x48, 0x37, 0x28, 0xBD, 0x58, 0x39, 0x30, 0xBF, 0x18, 0x7F, 0x10, 0x9F, 0x10, 0x7F, 0x10, 0x3F, 0x00, 0x5F, 0x08, 0xDF, 0x11, 0x7F, 0x10, 0x7F, 0x10, 0x5F, 0x08, 0x5D, 0x10, 0x5A, 0x18, 0x79, 0x18, 0x58, 0x10, 0x57, 0x18, 0x55, 0x18,
+    0x76, 0x18, 0x33, 0x18, 0x16, 0x39, 0x52, 0x20, 0x51, 0x18, 0x70, 0x20, 0x51, 0x20, 0x2F, 0x18, 0x50, 0x20, 0x2E, 0x20, 0xB4, 0x71, 0x4E, 0x30, 0xD2, 0x38, 0x8F, 0x38, 0x4E, 0x28, 0xB0, 0x40, 0x2D, 0x28, 0x4E, 0x30, 0x2D, 0x28, 0x72, 0x40, 0x71, 0x50, 0x2D, 0x28, 0x4F, 0x38, 0x0F, 0x30, 0x50, 0x38, 0x50, 0x38, 0x2F, 0x30, 0x76, 0x60, 0x7D, 0xC3, 0x51, 0x40, 0x78, 0x58, 0x34, 0x48,
+    0x9A, 0x88, 0x19, 0x50, 0x36, 0x48, 0x17, 0x48, 0x17, 0x48, 0x37, 0x40, 0x1D, 0x90, 0x39, 0x48, 0x3C, 0x50, 0x1F, 0x60, 0x3F, 0x70, 0x1F, 0x50, 0x5D, 0x50, 0x9E, 0x88, 0x1F, 0xD4, 0x1E, 0xBB, 0xBF, 0xFF, 0x3F, 0xF6, 0x1F, 0x38, 0x3F, 0x40, 0x3D, 0x8A, 0x9E, 0xBC, 0x1D, 0x30, 0xBE, 0x68, 0x1E, 0x30, 0x1E, 0x40, 0x3A, 0x48, 0x19, 0x30, 0x18, 0x38, 0x59, 0x40, 0x17, 0x28, 0x38, 0x38,
+    0x9F, 0x18, 0x7F, 0x20, 0x3F, 0x14, 0xDF, 0x10, 0x7F, 0x10, 0x9F, 0x20, 0x9F, 0x10, 0x5D, 0x00, 0x1F, 0x09, 0x3C, 0x08, 0xDF, 0x10, 0x58, 0x20, 0x78, 0x18, 0x1F, 0x31, 0xFC, 0x20, 0x55, 0x20, 0x77, 0x20, 0x53, 0x18, 0xBF, 0x61, 0x72, 0x30, 0x51, 0x18, 0x50, 0x20, 0x96, 0x18, 0x1C, 0x59, 0x51, 0x28, 0x4E, 0x28, 0xB1, 0x38, 0xD4, 0x48, 0x54, 0x28, 0xD5, 0x58, 0x2F, 0x30, 0x31, 0x50,
+    0x4D, 0x30, 0x6F, 0x40, 0x5B, 0xA1, 0x0D, 0x28, 0x14, 0x61, 0x6F, 0x38, 0x51, 0x40, 0x9A, 0xC9, 0x52, 0x40, 0x30, 0x38, 0x0F, 0x30, 0xBF, 0xF4, 0xF9, 0x90, 0x32, 0x40, 0x56, 0x50, 0x37, 0x48, 0x54, 0x50, 0xDA, 0x80, 0x3F, 0x91, 0x3A, 0x50, 0x19, 0x48, 0x18, 0x48, 0x1B, 0x68, 0x7C, 0x70, 0xBF, 0x98, 0xBF, 0xF9, 0x1E, 0x50, 0x5F, 0x58, 0x3E, 0x80, 0x1D, 0x60, 0xDE, 0xA0, 0xDF, 0xB9,
+    0xBE, 0xA0, 0x5D, 0x80, 0x1F, 0x38, 0x7C, 0x50, 0x9F, 0x68, 0x1E, 0x38, 0x1E, 0x30, 0x1B, 0x38, 0x7D, 0x70, 0x1E, 0x40, 0x3D, 0x40, 0x5F, 0x58, 0x9E, 0x60, 0x1B, 0x48, 0x99, 0x40, 0x1C, 0x48, 0xDF, 0x28, 0xBF, 0x20, 0x9F, 0x20, 0x9E, 0x20, 0x5F, 0x19, 0xFF, 0x18, 0x7E, 0x18, 0x7F, 0x08, 0x7A, 0x20, 0x1F, 0x29, 0x7D, 0x10, 0x78, 0x20, 0x19, 0x39, 0x79, 0x18, 0x7F, 0x41, 0x54, 0x18,
+    0x59, 0x49, 0x74, 0x20, 0x72, 0x18, 0x5C, 0x59, 0xF4, 0x38, 0x90, 0x28, 0x30, 0x18, 0xD2, 0x30, 0x58, 0x61, 0xB0, 0x38, 0xB0, 0x38, 0x71, 0x30, 0x92, 0x28, 0x79, 0x79, 0xF4, 0x48, 0xB1, 0x40, 0x4D, 0x30, 0x90, 0x40, 0x37, 0x81, 0x71, 0x40, 0x4E, 0x38, 0x4E, 0x38, 0x52, 0x48, 0x16, 0x81, 0x31, 0x40, 0x50, 0x38, 0x30, 0x38, 0x39, 0x60, 0xF8, 0x88, 0x32, 0x40, 0x15, 0x48, 0x36, 0x48,
+    0x55, 0x50, 0xD9, 0x88, 0x15, 0x48, 0x3C, 0x70, 0x19, 0x48, 0x7E, 0x68, 0x7D, 0x90, 0x1A, 0x48, 0x1E, 0x68, 0x3C, 0x68, 0x1F, 0x58, 0x9F, 0x78, 0x3D, 0x68, 0x1E, 0x88, 0xDF, 0xFF, 0x5F, 0xFD, 0x7F, 0x98, 0x1F, 0xB2, 0x1E, 0x48, 0x1E, 0x90, 0xFC, 0x70, 0x3E, 0x70, 0x3F, 0x40, 0x1B, 0x80, 0x1F, 0x50, 0xDF, 0xFF, 0xDF, 0x80, 0x5F, 0x60, 0x5D, 0xE2, 0x1E, 0x90, 0x1A, 0x48, 0x16, 0x48,
+    0xDF, 0x28, 0xFF, 0x38, 0xBD, 0x28, 0xBC, 0x28, 0xBC, 0x28, 0xBC, 0x30, 0x5F, 0x31, 0x7D, 0x18, 0x9A, 0x20, 0x99, 0x20, 0x9C, 0x41, 0x7F, 0x51, 0x76, 0x20, 0x78, 0x20, 0x55, 0x18, 0x39, 0x41, 0xF8, 0x38, 0xD7, 0x38, 0x92, 0x28, 0x71, 0x20, 0x79, 0x61, 0x14, 0x49, 0x74, 0x28, 0x4F, 0x20, 0x38, 0x31, 0x38, 0x71, 0x91, 0x30, 0x95, 0x38, 0xB3, 0x40, 0x6E, 0x30, 0x59, 0x79, 0x70, 0x38,
+    0x72, 0x50, 0x8F, 0x40, 0x50, 0x48, 0x7E, 0x59, 0x36, 0x69, 0x6E, 0x38, 0x73, 0x50, 0xD6, 0x88, 0x52, 0x40, 0x51, 0x40, 0x30, 0x38, 0x55, 0x58, 0x99, 0x88, 0x53, 0x40, 0x3A, 0x60, 0xBF, 0xA8, 0x5E, 0xCB, 0x1B, 0x68, 0x19, 0x48, 0x9F, 0xC0, 0x1B, 0x50, 0x9F, 0xA0, 0x1C, 0x68, 0x1E, 0x98, 0xBD, 0x78, 0x3E, 0x68, 0x9F, 0x98, 0x3E, 0x78, 0x1E, 0x60, 0xDE, 0x88, 0x3F, 0xFB, 0x3E, 0xB8,
+    0x1E, 0x58, 0x3F, 0x58, 0x1E, 0x68, 0x1E, 0x40, 0x7F, 0x89, 0x1F, 0x50, 0x1E, 0x50, 0x5F, 0x48, 0x5F, 0x50, 0x7F, 0x60, 0x3D, 0x60, 0x3E, 0x50, 0x3D, 0x60, 0xDF, 0x80, 0x14, 0x38, 0x17, 0x30, 0xBD, 0x28, 0xBD, 0x28, 0xDC, 0x38, 0xDC, 0x30, 0xBA, 0x30, 0x7A, 0x28, 0x9A, 0x28, 0x59, 0x20, 0x3D, 0x41, 0x99, 0x28, 0x98, 0x28, 0xB6, 0x28, 0x3C, 0x41, 0x76, 0x20, 0x75, 0x20, 0x95, 0x20,
+    0x78, 0x41, 0x59, 0x51, 0x15, 0x39, 0x91, 0x28, 0xB0, 0x28, 0x55, 0x51, 0xB4, 0x38, 0x91, 0x28, 0xFA, 0x48, 0x70, 0x30, 0x57, 0x79, 0xF4, 0x50, 0xB4, 0x38, 0xD2, 0x50, 0x18, 0x71, 0xB8, 0x38, 0x8E, 0x38, 0x78, 0x48, 0x4F, 0x38, 0xBD, 0x80, 0x95, 0x60, 0xB0, 0x48, 0x5E, 0x71, 0x34, 0x68, 0x31, 0x48, 0x51, 0x40, 0x0F, 0x38, 0xBD, 0x80, 0x38, 0x80, 0x37, 0x58, 0x19, 0x50, 0x9F, 0x90,
+    0x7A, 0x70, 0x79, 0x68, 0x7E, 0x78, 0x9E, 0x78, 0x1A, 0x60, 0x3E, 0xE2, 0x5E, 0xF2, 0x9F, 0x88, 0x1F, 0xA0, 0x9D, 0xF0, 0x1F, 0x80, 0x1F, 0x68, 0x1F, 0x68, 0x1F, 0x80, 0x1F, 0xDA, 0x3F, 0x78, 0x1D, 0x50, 0xBD, 0x80, 0x1E, 0x60, 0x1C, 0x38, 0x3E, 0x58, 0x3C, 0x50, 0x1A, 0x38, 0x1B, 0x48, 0x1C, 0x38, 0x19, 0x38, 0x1D, 0x48, 0x3B, 0x48, 0x5A, 0x48, 0x1B, 0x40, 0x37, 0x40, 0x7E, 0xC1,
+    0x1C, 0x41, 0xBA, 0x30, 0xDB, 0x38, 0xDA, 0x30, 0xDA, 0x30, 0x9A, 0x28, 0x98, 0x30, 0xB8, 0x30, 0x97, 0x28, 0xB8, 0x28, 0xB7, 0x30, 0x74, 0x20, 0x74, 0x20, 0x95, 0x28, 0xB6, 0x30, 0x37, 0x41, 0x71, 0x20, 0x74, 0x28, 0xF4, 0x40, 0xB2, 0x30, 0x90, 0x30, 0x2F, 0x20, 0xB4, 0x38, 0x33, 0x51, 0x17, 0x41, 0x6E, 0x30, 0x13, 0x51, 0x7D, 0x61, 0x72, 0x38, 0x6E, 0x30, 0x92, 0x48, 0xB8, 0x60,
+    0x75, 0x69, 0x95, 0x48, 0x31, 0x38, 0xF7, 0x78, 0x33, 0x61, 0x50, 0x40, 0x58, 0x40, 0xFA, 0x78, 0x54, 0x60, 0x50, 0x40, 0x30, 0x40, 0x5D, 0x78, 0x1F, 0xA1, 0xFD, 0x60, 0x18, 0x50, 0x19, 0x58, 0xFE, 0xB8, 0x19, 0x58, 0x1B, 0x48, 0x5C, 0x70, 0xDF, 0xE8, 0xFE, 0xB8, 0x1D, 0x58, 0x3D, 0xB0, 0xDE, 0xF4, 0xDF, 0xFF, 0x9F, 0xC8, 0x5E, 0xC1, 0xDF, 0xE9, 0x7F, 0xFE, 0x1D, 0xC1, 0xDF, 0xFA,
+    0x3F, 0x70, 0x1D, 0x70, 0x5F, 0x68, 0x1C, 0x50, 0x1A, 0x50, 0x9E, 0x99, 0x1A, 0x40, 0x1A, 0x40, 0x3B, 0x50, 0x19, 0x38, 0x3F, 0x60, 0x38, 0x38, 0xBD, 0x60, 0x3D, 0x50, 0x3B, 0x58, 0x7D, 0x60, 0xFA, 0x38, 0x1B, 0x39, 0xBF, 0x49, 0xFA, 0x38, 0xB8, 0x30, 0xB8, 0x30, 0xD8, 0x30, 0x7F, 0x29, 0x77, 0x28, 0x96, 0x28, 0x38, 0x39, 0x94, 0x28, 0xFE, 0x69, 0x5A, 0x59, 0xB8, 0x20, 0x92, 0x28,
+    0x36, 0x41, 0x72, 0x30, 0xDF, 0x79, 0x50, 0x28, 0x54, 0x51, 0x4F, 0x28, 0xF5, 0x38, 0x98, 0x71, 0x15, 0x51, 0xB0, 0x38, 0x8E, 0x30, 0x5A, 0x61, 0x17, 0x71, 0xF4, 0x60, 0x6E, 0x38, 0xB5, 0x50, 0x90, 0x40, 0x14, 0x69, 0xFB, 0xA9, 0x30, 0x40, 0x50, 0x48, 0x70, 0x40, 0xFE, 0x89, 0x95, 0x88, 0x51, 0x50, 0x50, 0x48, 0x30, 0x40, 0x32, 0x48, 0x58, 0x91, 0xBA, 0x58, 0x7E, 0x78, 0x1A, 0x60,
+    0x15, 0x48, 0x3A, 0x90, 0x19, 0x58, 0x5D, 0x98, 0x5D, 0x68, 0x5F, 0x78, 0x1C, 0x60, 0xDF, 0x98, 0x3F, 0xC0, 0x1F, 0xA8, 0x3D, 0x88, 0x9F, 0xD0, 0x7C, 0x78, 0x1D, 0x50, 0x1C, 0x68, 0x9F, 0xA8, 0x3F, 0x68, 0x9C, 0x78, 0x7B, 0x60, 0x1D, 0x78, 0x1A, 0x40, 0x7C, 0x58, 0x37, 0x38, 0x79, 0x58, 0x9B, 0x71, 0x9B, 0x50, 0x39, 0x40, 0x5F, 0x71, 0xBA, 0x60, 0x56, 0x38, 0x36, 0x38, 0x15, 0x38,
+    0x19, 0x41, 0x19, 0x41, 0xD7, 0x38, 0xF8, 0x38, 0x9F, 0x49, 0xDD, 0x49, 0xF8, 0x38, 0xB6, 0x30, 0xD5, 0x30, 0x9F, 0x49, 0xD9, 0x30, 0x93, 0x28, 0xB4, 0x30, 0xD4, 0x30, 0x75, 0x38, 0x30, 0x20, 0x91, 0x28, 0xF3, 0x38, 0x92, 0x30, 0x1B, 0x7A, 0x4F, 0x30, 0x13, 0x49, 0xB4, 0x48, 0x13, 0x41, 0x76, 0x71, 0x90, 0x48, 0x8F, 0x38, 0x96, 0x50, 0x71, 0x38, 0x58, 0x89, 0x0C, 0x30, 0x35, 0x61,
+    0x37, 0x71, 0x70, 0x48, 0x35, 0x81, 0xB2, 0x58, 0x39, 0x89, 0xB1, 0x50, 0x52, 0x48, 0xF6, 0x90, 0x32, 0x50, 0x50, 0x48, 0x50, 0x48, 0x9B, 0x80, 0xF8, 0x98, 0x57, 0x79, 0x18, 0x58, 0x5E, 0xD8, 0x56, 0x60, 0x9C, 0x98, 0x39, 0x78, 0x9C, 0xC0, 0x3D, 0x70, 0x3E, 0x80, 0x7B, 0x90, 0x7F, 0xB1, 0x9E, 0x78, 0xDF, 0x88, 0xDF, 0xE9, 0x3C, 0x88, 0x3B, 0x70, 0x3B, 0x68, 0x5F, 0x88, 0x1C, 0x58,
+    0x1F, 0xCA, 0x1E, 0x68, 0x1C, 0x58, 0x5E, 0x60, 0x18, 0x48, 0x1D, 0x70, 0x38, 0x48, 0x36, 0x38, 0x56, 0x40, 0x9A, 0x60, 0x77, 0x50, 0x35, 0x38, 0x36, 0x38, 0x1A, 0x40, 0x79, 0x58, 0xDB, 0x79, 0x38, 0x49, 0xB6, 0x30, 0x58, 0x49, 0x17, 0x41, 0xF6, 0x40, 0xB5, 0x38, 0x79, 0x49, 0xD6, 0x38, 0x58, 0x49, 0xD5, 0x38, 0xD4, 0x30, 0xB8, 0x61, 0x73, 0x30, 0x93, 0x30, 0xD2, 0x30, 0xF2, 0x38,
+    0xD1, 0x28, 0xF4, 0x48, 0xB0, 0x30, 0xB0, 0x30, 0xD3, 0x40, 0xF6, 0x81, 0xD1, 0x40, 0xD2, 0x48, 0xB1, 0x40, 0x35, 0x8A, 0x53, 0x79, 0xB4, 0x48, 0xD0, 0x48, 0x4F, 0x40, 0x59, 0xC2, 0xD0, 0x50, 0xF1, 0x50, 0xD2, 0x58, 0x4F, 0x40, 0xD4, 0x80, 0xB4, 0x68, 0x4F, 0x48, 0xF4, 0x68, 0xB5, 0xA0, 0x11, 0x50, 0x50, 0x48, 0x50, 0x50, 0x5D, 0x88, 0xDD, 0xE9, 0xD5, 0x78, 0xD9, 0x78, 0x5C, 0x78,
+    0x38, 0x68, 0x1A, 0x78, 0x3E, 0xF8, 0x9C, 0xA8, 0x3D, 0x90, 0x3D, 0xEA, 0x1D, 0xB0, 0x1E, 0x90, 0x3F, 0x78, 0x9F, 0xF9, 0x7C, 0xA0, 0x1C, 0x68, 0xFF, 0xE1, 0x1C, 0x58, 0x7F, 0xA0, 0x1C, 0x58, 0x9C, 0xA8, 0x3D, 0x68, 0x7B, 0x70, 0xFF, 0x90, 0x3D, 0x91, 0x16, 0x40, 0x37, 0x40, 0x9F, 0xCA, 0x3D, 0x71, 0x14, 0x30, 0x37, 0x38, 0x16, 0x38, 0x18, 0x58, 0x35, 0x48, 0x38, 0x40, 0x37, 0x40,
+    0x78, 0x51, 0x16, 0x41, 0x36, 0x49, 0xF6, 0x40, 0x15, 0x49, 0xB4, 0x38, 0xD4, 0x38, 0xF4, 0x38, 0xB3, 0x30, 0x93, 0x30, 0xB3, 0x30, 0xB2, 0x30, 0xD2, 0x38, 0xD2, 0x38, 0x94, 0x51, 0x8F, 0x28, 0xD1, 0x38, 0xF6, 0x61, 0x73, 0x61, 0x34, 0x49, 0xF0, 0x40, 0xF0, 0x40, 0xF2, 0x50, 0xF1, 0x48, 0xD1, 0x48, 0x6E, 0x38, 0xD3, 0x69, 0x90, 0x58, 0x1D, 0xDC, 0x6C, 0x38, 0x30, 0x69, 0x9E, 0xDA,
+    0xB9, 0x92, 0xF9, 0xB9, 0x6E, 0x48, 0xB3, 0x78, 0x4F, 0x58, 0x6F, 0x48, 0x15, 0x81, 0x39, 0xA9, 0x32, 0x58, 0x70, 0x50, 0x50, 0x50, 0x39, 0xC1, 0xFE, 0xD8, 0x33, 0x60, 0x1B, 0x88, 0x9B, 0x88, 0x17, 0x88, 0x7D, 0x90, 0x5E, 0x88, 0x3A, 0x80, 0x1F, 0xFE, 0x3F, 0xD9, 0x1D, 0x90, 0x1D, 0x80, 0x5F, 0xC9, 0x1B, 0x70, 0x1B, 0x60, 0xDC, 0x98, 0x3D, 0x70, 0x5E, 0x98, 0xBF, 0x90, 0x18, 0x48,
+    0x3E, 0x81, 0x5E, 0x98, 0x5D, 0xB0, 0x19, 0x38, 0x7C, 0x68, 0x59, 0x48, 0xBB, 0x68, 0x16, 0x38, 0x79, 0x70, 0x16, 0x38, 0xBB, 0x68, 0x35, 0x38, 0x16, 0x48, 0x34, 0x38, 0x34, 0x40, 0x34, 0x38, 0x36, 0x41, 0x56, 0x49, 0x15, 0x41, 0x15, 0x41, 0x35, 0x49, 0xF3, 0x38, 0xB2, 0x30, 0x14, 0x41, 0x13, 0x41, 0xD2, 0x38, 0xB2, 0x30, 0xD1, 0x38, 0x13, 0x41, 0xB1, 0x38, 0x90, 0x38, 0x6E, 0x30,
+    0x12, 0x49, 0x12, 0x41, 0xB0, 0x48, 0xB0, 0x40, 0x51, 0x59, 0x10, 0x49, 0xD0, 0x40, 0xD1, 0x48, 0x74, 0x71, 0xD0, 0x48, 0xAD, 0x40, 0x12, 0x61, 0x12, 0x69, 0x8D, 0x40, 0x11, 0x59, 0x6F, 0x50, 0x11, 0x69, 0xB1, 0x58, 0xD0, 0x58, 0x11, 0x58, 0x91, 0x60, 0xD1, 0x58, 0x72, 0x60, 0x72, 0x70, 0x94, 0x60, 0x70, 0x50, 0x50, 0x50, 0xF9, 0x90, 0x5C, 0xA0, 0x76, 0x68, 0x17, 0x68, 0xFE, 0xF0,
+    0x1A, 0x80, 0x1A, 0x80, 0x5F, 0xC8, 0x7F, 0xF1, 0xDE, 0xE1, 0x3D, 0x80, 0x7E, 0x80, 0x7E, 0xFB, 0x3A, 0x70, 0x1A, 0x60, 0x3C, 0x68, 0x3E, 0xD0, 0x9F, 0xB9, 0x7A, 0x68, 0x7C, 0x78, 0x17, 0x50, 0x7C, 0x78, 0xDC, 0x70, 0x3E, 0xA1, 0x7D, 0x70, 0x39, 0x58, 0x3C, 0x50, 0xFC, 0x68, 0x1D, 0x68, 0x97, 0x58, 0x34, 0x38, 0x34, 0x38, 0x55, 0x48, 0x56, 0x48, 0x53, 0x38, 0x32, 0x30, 0x32, 0x30,
+    0x35, 0x49, 0xF5, 0x40, 0x7C, 0x7A, 0xF4, 0x40, 0x35, 0x49, 0x13, 0x41, 0xB6, 0x28, 0x3F, 0x6A, 0xF2, 0x38, 0xF2, 0x38, 0xD1, 0x38, 0xD1, 0x38, 0x3E, 0x72, 0x90, 0x30, 0x11, 0x41, 0xCF, 0x38, 0x36, 0x72, 0xB0, 0x48, 0x18, 0x8A, 0xCF, 0x40, 0xCF, 0x40, 0xCE, 0x40, 0x31, 0x59, 0x3A, 0x9A, 0xAF, 0x48, 0x31, 0x61, 0xEF, 0x50, 0x32, 0x61, 0x7A, 0xAA, 0xF3, 0x70, 0x8E, 0x48, 0xCF, 0x58,
+    0xAF, 0x58, 0xCF, 0x60, 0xFB, 0xD9, 0x91, 0x60, 0x15, 0x89, 0x8F, 0x50, 0xD2, 0x68, 0x78, 0xA1, 0x70, 0x58, 0x70, 0x58, 0x4D, 0x48, 0x3F, 0xE1, 0xD9, 0xA0, 0x56, 0x78, 0x38, 0x90, 0x5C, 0xE0, 0x38, 0x80, 0x7F, 0xFC, 0xFF, 0xFF, 0xDF, 0xF8, 0x1E, 0xA0, 0x1C, 0x78, 0x1F, 0xF9, 0xDA, 0x98, 0x17, 0x58, 0x3E, 0xA8, 0x1E, 0xA8, 0x39, 0x68, 0xDA, 0x78, 0x1D, 0x70, 0x18, 0x58, 0xB9, 0x80,
+    0x18, 0x50, 0x7B, 0x60, 0x97, 0x78, 0x14, 0x38, 0x1C, 0x68, 0x3B, 0x60, 0x13, 0x38, 0x1D, 0xB1, 0x56, 0x50, 0x34, 0x38, 0x34, 0x40, 0x5A, 0x81, 0x55, 0x40, 0xB6, 0x60, 0x52, 0x30, 0x55, 0x40, 0x95, 0x59, 0x54, 0x51, 0x34, 0x49, 0x52, 0x28, 0xD9, 0x59, 0x12, 0x41, 0xD2, 0x40, 0xF3, 0x40, 0x57, 0x72, 0x3B, 0x7A, 0x99, 0x7A, 0xB1, 0x38, 0xF0, 0x38, 0xB3, 0x59, 0x19, 0x7A, 0x57, 0x82,
+    0x8D, 0x30, 0x10, 0x51, 0x71, 0x61, 0x58, 0x92, 0x55, 0x92, 0xCE, 0x48, 0x93, 0x71, 0xAE, 0x40, 0xD6, 0x89, 0x16, 0xA2, 0x10, 0x59, 0xB6, 0x91, 0xEE, 0x58, 0xB5, 0x99, 0x31, 0x79, 0x10, 0x71, 0xEF, 0x60, 0x0F, 0x71, 0x53, 0x99, 0xD0, 0x60, 0xD2, 0x70, 0x8E, 0x50, 0xD1, 0x78, 0xB5, 0xD1, 0x38, 0x89, 0x90, 0x58, 0x6F, 0x58, 0x54, 0x80, 0xB9, 0xA0, 0x54, 0x78, 0x5F, 0xB8, 0xBC, 0xA8,
+    0x36, 0x80, 0x1F, 0xE1, 0x3F, 0xFA, 0x7F, 0xF9, 0x3D, 0x98, 0x1B, 0x80, 0x9A, 0x98, 0xDF, 0xD1, 0x3B, 0x68, 0x17, 0x58, 0x37, 0x68, 0x9A, 0x98, 0x39, 0x60, 0x99, 0x78, 0x7A, 0x68, 0x13, 0x50, 0x16, 0x50, 0x7A, 0x70, 0x1B, 0x58, 0x97, 0x60, 0x1D, 0xB1, 0x15, 0x48, 0x36, 0x68, 0x34, 0x40, 0x13, 0x38, 0x18, 0x60, 0xB4, 0x50, 0xDE, 0x91, 0x32, 0x38, 0x32, 0x30, 0x98, 0x50, 0x52, 0x40,
+    0x95, 0x59, 0x74, 0x51, 0x94, 0x59, 0x33, 0x49, 0x73, 0x59, 0x11, 0x49, 0xF1, 0x40, 0xF1, 0x40, 0xD0, 0x40, 0xB4, 0x61, 0xF0, 0x38, 0xEF, 0x38, 0x36, 0x72, 0x76, 0x7A, 0xAE, 0x38, 0x0F, 0x41, 0x8C, 0x38, 0xEF, 0x48, 0x71, 0x71, 0xEE, 0x48, 0xB2, 0x71, 0x33, 0x92, 0x75, 0x9A, 0x0F, 0x59, 0x8D, 0x48, 0xAD, 0x48, 0xF4, 0xA1, 0x30, 0x69, 0xAD, 0x50, 0xAC, 0x40, 0x75, 0xAA, 0x15, 0xAA,
+    0xAE, 0x50, 0xEF, 0x60, 0x50, 0x79, 0x4F, 0x98, 0xB0, 0x70, 0xAF, 0x60, 0xD1, 0x80, 0x7B, 0xFA, 0xB2, 0x70, 0x70, 0x58, 0x0D, 0x50, 0xB4, 0x88, 0x19, 0xD8, 0x33, 0x88, 0x99, 0xA8, 0x5F, 0xFA, 0x36, 0xB0, 0x7A, 0xA0, 0xDE, 0xB8, 0x3F, 0xC1, 0x9D, 0xE8, 0x9C, 0xC8, 0x99, 0x80, 0x3C, 0x99, 0x35, 0x60, 0x17, 0x80, 0x7A, 0x78, 0x36, 0x68, 0x36, 0x60, 0xFF, 0xB0, 0xFA, 0x88, 0x96, 0x58,
+    0x36, 0x40, 0x1D, 0x81, 0xB9, 0x70, 0x3B, 0x91, 0x55, 0x50, 0x96, 0x58, 0x56, 0x58, 0x9B, 0x89, 0x32, 0x38, 0x11, 0x38, 0xB7, 0x60, 0x31, 0x38, 0xB5, 0x50, 0x30, 0x30, 0x30, 0x30, 0x51, 0x38, 0x93, 0x59, 0x93, 0x59, 0x72, 0x51, 0x73, 0x51, 0x31, 0x49, 0x31, 0x49, 0x50, 0x49, 0x51, 0x49, 0x30, 0x49, 0xEF, 0x40, 0xEF, 0x40, 0x0F, 0x41, 0x91, 0x59, 0x4F, 0x51, 0xCD, 0x38, 0x4F, 0x51,
+    0xB2, 0x69, 0x91, 0x61, 0xEF, 0x50, 0x0E, 0x49, 0x2F, 0x59, 0x6F, 0x61, 0x2E, 0x59, 0x0E, 0x61, 0x2F, 0x69, 0xCD, 0x50, 0xED, 0x58, 0x91, 0x81, 0x55, 0xAA, 0xAC, 0x48, 0xAC, 0x48, 0xCF, 0x70, 0xD3, 0x99, 0x11, 0x71, 0xEE, 0x60, 0xCF, 0x78, 0xD0, 0x80, 0x8D, 0x58, 0xF1, 0x80, 0x91, 0x90, 0x4E, 0x70, 0x8F, 0x60, 0x4E, 0x60, 0x32, 0x80, 0x58, 0xC0, 0xB5, 0xA8, 0x5B, 0xF8, 0x3F, 0xF9,
+    0xDA, 0xC0, 0x16, 0x88, 0x9A, 0xA8, 0x1F, 0xF9, 0x79, 0x90, 0x36, 0x70, 0x15, 0x70, 0xDF, 0xF0, 0x14, 0x68, 0x56, 0x70, 0x16, 0x60, 0x7D, 0xA8, 0x36, 0x68, 0x76, 0x68, 0x77, 0x70, 0x5F, 0x99, 0x35, 0x48, 0x34, 0x40, 0x7C, 0x70, 0xDA, 0x78, 0x33, 0x48, 0x12, 0x40, 0xB9, 0x68, 0xBA, 0x70, 0x10, 0x30, 0x92, 0x48, 0x31, 0x38, 0x52, 0x38, 0x31, 0x38, 0x30, 0x38, 0x0F, 0x30, 0x51, 0x38,
+    0xB2, 0x59, 0x72, 0x51, 0x92, 0x59, 0x51, 0x51, 0x51, 0x51, 0x30, 0x49, 0x30, 0x49, 0x30, 0x49, 0x0F, 0x41, 0x0F, 0x49, 0x0F, 0x41, 0xCD, 0x38, 0xED, 0x40, 0x4F, 0x51, 0xCD, 0x38, 0xED, 0x40, 0x2E, 0x49, 0x2E, 0x51, 0x0D, 0x51, 0xED, 0x50, 0xED, 0x50, 0x0D, 0x49, 0x0E, 0x59, 0x0F, 0x69, 0x2E, 0x61, 0xED, 0x58, 0x70, 0x71, 0x52, 0x99, 0x6C, 0x58, 0xEE, 0x60, 0xEF, 0x68, 0xF0, 0x80,
+    0x6D, 0x58, 0xF0, 0x78, 0x31, 0x91, 0x4D, 0x70, 0x91, 0x88, 0x8E, 0x68, 0xF6, 0xC8, 0x50, 0x80, 0xF5, 0x88, 0x8F, 0x68, 0x90, 0x78, 0x9C, 0xC8, 0x3E, 0xF1, 0x35, 0xC0, 0x1E, 0xF3, 0xFF, 0xFF, 0x5A, 0xD8, 0x38, 0xA8, 0x1F, 0xFA, 0x9A, 0xB0, 0x58, 0xA8, 0xDF, 0xA0, 0x59, 0xA8, 0xB6, 0xA0, 0xDA, 0xB0, 0xDB, 0xC8, 0x54, 0x60, 0x7E, 0xEB, 0x1C, 0xA0, 0x16, 0x80, 0x54, 0xB0, 0x1A, 0x68,
+    0x57, 0x48, 0x34, 0x40, 0x58, 0x58, 0x17, 0x58, 0x35, 0x50, 0x94, 0x58, 0x93, 0x80, 0xB5, 0x90, 0x32, 0x38, 0xB6, 0x70, 0x30, 0x40, 0x51, 0x38, 0xDC, 0xE2, 0xB8, 0x89, 0x5A, 0xD2, 0x0E, 0x30, 0xD2, 0x61, 0xB2, 0x59, 0x91, 0x51, 0x70, 0x51, 0x70, 0x51, 0x50, 0x51, 0x2F, 0x49, 0xD0, 0x38, 0x0F, 0x49, 0x0E, 0x41, 0x0E, 0x41, 0xED, 0x40, 0x70, 0x59, 0x0E, 0x49, 0xCD, 0x40, 0xAB, 0x40,
+    0xEC, 0x40, 0xAC, 0x48, 0x0D, 0x51, 0xED, 0x50, 0xCC, 0x50, 0x2C, 0x51, 0x56, 0xC3, 0x4F, 0x71, 0x2E, 0x61, 0x0D, 0x59, 0xED, 0x68, 0x0D, 0x61, 0xEE, 0x68, 0xEC, 0x58, 0xAB, 0x50, 0xCC, 0x60, 0xED, 0x60, 0x4F, 0x79, 0x34, 0xC2, 0x0F, 0x79, 0xCD, 0x70, 0x6C, 0x60, 0xCF, 0x78, 0x76, 0xA1, 0xB0, 0x78, 0xAE, 0x68, 0x2F, 0x70, 0x72, 0x88, 0x97, 0xC8, 0xD4, 0xA8, 0xFE, 0xF9, 0x38, 0xD0,
+    0x54, 0x98, 0x3A, 0xD1, 0xD6, 0x98, 0xB7, 0x90, 0x34, 0x78, 0x33, 0x60, 0x95, 0x78, 0x13, 0x68, 0x93, 0x60, 0xD9, 0xA0, 0x96, 0x78, 0x33, 0x60, 0x9E, 0xB9, 0x75, 0x70, 0x54, 0x68, 0x73, 0x48, 0x32, 0x38, 0x52, 0x38, 0x5B, 0x80, 0x0F, 0x38, 0x10, 0x38, 0x10, 0x40, 0x51, 0x48, 0x54, 0x68, 0xF6, 0x70, 0x0F, 0x40, 0x70, 0x40, 0x70, 0x40, 0x70, 0x40, 0x96, 0x58, 0x8F, 0x40, 0x6F, 0x40,
+    0x32, 0x72, 0xD1, 0x61, 0x70, 0x59, 0x6F, 0x51, 0x96, 0x82, 0x15, 0x8B, 0x73, 0x7A, 0xEE, 0x40, 0xB6, 0x72, 0x98, 0x92, 0xD6, 0x8A, 0xED, 0x40, 0xB4, 0x82, 0x91, 0x51, 0x37, 0xBB, 0xD3, 0x9A, 0x76, 0xA3, 0xCB, 0x40, 0x91, 0x82, 0x4E, 0x81, 0xB5, 0xAA, 0x55, 0xB3, 0x92, 0xA2, 0xAA, 0x60, 0x31, 0xAA, 0x93, 0xCA, 0x4C, 0x71, 0xAA, 0x58, 0xAD, 0x91, 0x15, 0xC2, 0x17, 0xFB, 0xCC, 0x70,
+    0xCA, 0x68, 0x8E, 0x89, 0x31, 0xC1, 0x10, 0xB1, 0xED, 0x80, 0x8B, 0x68, 0x8C, 0x78, 0x17, 0xEA, 0x8E, 0x80, 0x8D, 0x80, 0xB0, 0x98, 0xD0, 0xC8, 0xF4, 0xE0, 0x92, 0xA0, 0x36, 0xB9, 0x53, 0x98, 0x94, 0xA0, 0xF8, 0xC8, 0x93, 0x80, 0x72, 0x68, 0xB5, 0x80, 0x76, 0x88, 0xD7, 0xA8, 0x33, 0x70, 0x92, 0x68, 0xB6, 0x70, 0x50, 0x58, 0xD8, 0xA0, 0x12, 0x58, 0x32, 0x58, 0xB6, 0x80, 0x78, 0x88,
+    0x11, 0x40, 0xD5, 0x60, 0x10, 0x48, 0x30, 0x48, 0x98, 0x88, 0x31, 0x48, 0x10, 0x48, 0x2F, 0x48, 0x2F, 0x38, 0x94, 0x68, 0x2E, 0x30, 0xD3, 0x60, 0xB4, 0x58, 0x71, 0x40, 0x55, 0x60, 0xAF, 0x40, 0xF1, 0x69, 0xD1, 0x61, 0xB0, 0x61, 0x4E, 0x49, 0xD0, 0x61, 0x8F, 0x59, 0x8F, 0x59, 0x8F, 0x59, 0x6E, 0x51, 0x4D, 0x51, 0x4D, 0x49, 0x2C, 0x49, 0x31, 0x72, 0xF0, 0x69, 0x4D, 0x51, 0xAE, 0x59,
+    0xEF, 0x69, 0xCF, 0x69, 0xB5, 0xAB, 0x2B, 0x51, 0xEE, 0x79, 0xEF, 0x81, 0xAE, 0x79, 0x71, 0x92, 0xCE, 0x81, 0x8F, 0x81, 0x91, 0x9A, 0x8E, 0x99, 0xD0, 0xA1, 0x70, 0xA2, 0xED, 0x89, 0xF6, 0xFA, 0xD2, 0xC9, 0x0D, 0xA9, 0x8D, 0xA1, 0xEF, 0xC0, 0xD5, 0xE9, 0x2E, 0xA1, 0x2F, 0xB9, 0x4F, 0xC0, 0xD4, 0xE9, 0x4B, 0x78, 0x8F, 0xB0, 0xFF, 0xFF, 0x55, 0xF8, 0xB1, 0xB0, 0x37, 0xE1, 0x5F, 0xF9,
+    0x95, 0xD0, 0xF5, 0xB0, 0x58, 0xE1, 0x5F, 0xF9, 0x55, 0xA0, 0x76, 0x90, 0x95, 0xA8, 0x38, 0x98, 0xF7, 0xC0, 0xF6, 0x90, 0x55, 0x80, 0x3E, 0xA9, 0x34, 0x60, 0x55, 0x70, 0xD9, 0x80, 0x7B, 0x70, 0x34, 0x50, 0x54, 0x48, 0x74, 0x58, 0x32, 0x48, 0x93, 0x58, 0x74, 0x58, 0xB4, 0x60, 0x33, 0x71, 0x31, 0x38, 0x53, 0x48, 0x71, 0x40, 0x91, 0x40, 0x4F, 0x38, 0x2E, 0x30, 0x50, 0x38, 0x4E, 0x30,
+    0xF1, 0x61, 0xD0, 0x61, 0xD0, 0x61, 0x4D, 0x51, 0x8F, 0x59, 0x6E, 0x51, 0x4D, 0x51, 0x6E, 0x51, 0x4D, 0x51, 0x2C, 0x49, 0x0C, 0x49, 0xCF, 0x69, 0x2C, 0x49, 0x2B, 0x49, 0x2B, 0x49, 0x2B, 0x49, 0x4C, 0x51, 0x0A, 0x49, 0x2A, 0x49, 0x2A, 0x51, 0x2A, 0x51, 0x0A, 0x51, 0x2B, 0x59, 0x6C, 0x71, 0x4B, 0x69, 0x4B, 0x61, 0x4B, 0x69, 0x2B, 0x69, 0xE9, 0x60, 0xEA, 0x60, 0x0A, 0x61, 0x89, 0x68,
+    0x0B, 0x69, 0xAE, 0x99, 0x0B, 0x81, 0x6D, 0x91, 0xCB, 0x88, 0xCC, 0x78, 0xEC, 0x90, 0xED, 0x88, 0xAC, 0x70, 0xAC, 0x80, 0xAF, 0xA8, 0x71, 0xF8, 0x76, 0xF9, 0xF0, 0xA0, 0x13, 0xB1, 0x70, 0x88, 0xB0, 0x80, 0x13, 0x99, 0x0F, 0x70, 0x2F, 0x68, 0x95, 0xA1, 0x70, 0x60, 0x0F, 0x70, 0xF3, 0x88, 0x0F, 0x58, 0x35, 0x99, 0x6F, 0x60, 0x70, 0x70, 0xB1, 0x70, 0xD3, 0x78, 0xD2, 0x78, 0x4F, 0x40,
+    0x4F, 0x38, 0x4F, 0x38, 0x6F, 0x48, 0xF1, 0x68, 0x2E, 0x40, 0x70, 0x58, 0xD0, 0x58, 0xF0, 0x60, 0x4D, 0x38, 0x2D, 0x38, 0x2C, 0x38, 0x2C, 0x38, 0x4D, 0x38, 0x4D, 0x38, 0x4D, 0x30, 0x6C, 0x30, 0x10, 0x6A, 0xD0, 0x61, 0xAF, 0x61, 0x4C, 0x51, 0x8E, 0x59, 0x6D, 0x51, 0x8E, 0x59, 0x6D, 0x51, 0x6D, 0x51, 0x4C, 0x51, 0x4C, 0x51, 0x4C, 0x51, 0x2B, 0x49, 0x2B, 0x51, 0xAD, 0x61, 0x2B, 0x49,
+    0x0B, 0x49, 0x4B, 0x59, 0x2A, 0x49, 0x4A, 0x51, 0x2A, 0x51, 0x2A, 0x51, 0x4B, 0x61, 0x6C, 0x71, 0x0A, 0x61, 0x4B, 0x69, 0x6B, 0x71, 0x4B, 0x71, 0x2A, 0x69, 0x2A, 0x71, 0x0A, 0x61, 0x2A, 0x79, 0x0A, 0x71, 0xAD, 0x99, 0x4C, 0x91, 0x2C, 0x91, 0x4D, 0xA1, 0xEB, 0x88, 0x0C, 0x91, 0x0D, 0x91, 0xCC, 0x70, 0x6A, 0x60, 0x55, 0xEA, 0x8D, 0x90, 0x13, 0xC1, 0x6F, 0x88, 0xAF, 0x88, 0xAF, 0x80,
+    0xB0, 0x80, 0x6F, 0x70, 0x6F, 0x70, 0x2D, 0x58, 0xD1, 0x78, 0x6F, 0x60, 0x90, 0x70, 0xD1, 0x78, 0x8F, 0x68, 0x2F, 0x50, 0xAF, 0x68, 0xD0, 0x68, 0x2F, 0x48, 0xD0, 0x68, 0x2E, 0x50, 0xB0, 0x58, 0x6E, 0x40, 0x4E, 0x38, 0x2C, 0x40, 0xF0, 0x60, 0x6E, 0x48, 0x6D, 0x48, 0x4D, 0x40, 0x4D, 0x40, 0x2C, 0x30, 0x4C, 0x38, 0x8D, 0x48, 0xCE, 0x48, 0x4C, 0x30, 0x4C, 0x30, 0x4C, 0x30, 0x6B, 0x30,
+    0xEF, 0x61, 0xEF, 0x61, 0xCF, 0x61, 0x6D, 0x51, 0xCE, 0x59, 0x2B, 0x41, 0x8D, 0x59, 0x6D, 0x51, 0x6C, 0x51, 0x6C, 0x51, 0x6C, 0x59, 0x4B, 0x49, 0x2B, 0x49, 0x6C, 0x51, 0x8C, 0x61, 0x4B, 0x51, 0x4A, 0x51, 0x8B, 0x59, 0x09, 0x49, 0x4A, 0x51, 0x4A, 0x59, 0x4A, 0x59, 0x4A, 0x59, 0x8C, 0x71, 0x29, 0x61, 0x8C, 0x71, 0xAC, 0x81, 0x8B, 0x79, 0x29, 0x69, 0x29, 0x71, 0x29, 0x69, 0x0A, 0x79,
+    0xE9, 0x78, 0x6C, 0x99, 0x8C, 0x89, 0x2B, 0xA9, 0xAE, 0xF9, 0x2B, 0xA9, 0x2C, 0x99, 0xEB, 0x88, 0xAC, 0x78, 0xAB, 0x68, 0x8D, 0x78, 0xAD, 0x88, 0xCE, 0x98, 0x8D, 0x78, 0xAF, 0x88, 0x6E, 0x70, 0x6E, 0x80, 0x8E, 0x70, 0xF0, 0x80, 0x4D, 0x58, 0x6E, 0x68, 0x6F, 0x58, 0x94, 0x91, 0x8F, 0x68, 0xAF, 0x68, 0x50, 0x48, 0x11, 0x71, 0xCF, 0x60, 0x8F, 0x48, 0xF0, 0x68, 0x2D, 0x48, 0x6E, 0x50,
+    0x4E, 0x38, 0x4E, 0x38, 0x2D, 0x38, 0x10, 0x69, 0x10, 0x59, 0x0B, 0x38, 0x2C, 0x38, 0x0C, 0x30, 0x4D, 0x38, 0x4C, 0x30, 0xEE, 0x50, 0xCD, 0x48, 0x6C, 0x38, 0x6C, 0x30, 0x4C, 0x30, 0x4B, 0x30, 0x50, 0x6A, 0xD3, 0x82, 0x0F, 0x62, 0xAE, 0x59, 0xD1, 0x82, 0xB5, 0xAB, 0x78, 0xA3, 0x97, 0xB3, 0x6D, 0x51, 0x34, 0x9B, 0x50, 0x72, 0xF2, 0x7A, 0x78, 0xAB, 0xCF, 0x69, 0x55, 0xB3, 0xAD, 0x71,
+    0x8F, 0x82, 0x57, 0xAB, 0x15, 0xBC, 0x16, 0xEC, 0x92, 0xDB, 0x4D, 0x92, 0x93, 0xC3, 0x75, 0xBB, 0xF9, 0xEC, 0xD5, 0xEB, 0x8B, 0x81, 0x6A, 0x91, 0xF1, 0xCA, 0x74, 0xDB, 0x92, 0xEB, 0x9A, 0xFD, 0xB2, 0xF2, 0x0A, 0x91, 0x5A, 0xFC, 0x2C, 0xD1, 0xDF, 0xFF, 0xCC, 0xB8, 0xB0, 0xC2, 0xB1, 0xA9, 0x8D, 0xC8, 0xCC, 0x68, 0xAC, 0x68, 0xCC, 0x80, 0xF8, 0xE9, 0x2E, 0x81, 0x4C, 0x80, 0xD2, 0xB0,
+    0x4D, 0x70, 0x79, 0xDA, 0x94, 0xA1, 0x6F, 0x70, 0x0D, 0x68, 0x2D, 0x58, 0x14, 0x99, 0x13, 0x89, 0x53, 0x81, 0x17, 0x99, 0x77, 0x99, 0x90, 0x68, 0x97, 0x99, 0x55, 0x89, 0x14, 0x79, 0xD8, 0x78, 0x35, 0x81, 0xF5, 0x70, 0xF3, 0x78, 0x70, 0x48, 0xD4, 0x68, 0x15, 0x71, 0x13, 0x69, 0x4D, 0x38, 0xD3, 0x58, 0xAF, 0x48, 0x8D, 0x40, 0xD4, 0x70, 0xB3, 0x60, 0x91, 0x58, 0x4F, 0x48, 0xCF, 0x48,
+    0x2F, 0x6A, 0x2F, 0x6A, 0x0E, 0x62, 0x0E, 0x62, 0xED, 0x59, 0xCC, 0x59, 0x8C, 0x51, 0x8C, 0x51, 0xAC, 0x59, 0x6B, 0x51, 0x8C, 0x51, 0x6B, 0x51, 0x6B, 0x51, 0x8B, 0x59, 0xCB, 0x61, 0x6A, 0x51, 0x8A, 0x59, 0x8A, 0x51, 0x6A, 0x51, 0x6A, 0x51, 0x89, 0x59, 0x8A, 0x61, 0xAA, 0x69, 0xAB, 0x71, 0xCB, 0x71, 0xCA, 0x71, 0x0B, 0x82, 0xAA, 0x79, 0xAA, 0x81, 0xAE, 0xAA, 0xEC, 0x91, 0xCB, 0xA1,
+    0x8B, 0x89, 0x2A, 0x91, 0x8B, 0x89, 0x6B, 0x99, 0x6B, 0xA9, 0x0A, 0x91, 0x2A, 0x81, 0xEA, 0x78, 0xEB, 0x70, 0xAC, 0x60, 0xAC, 0x68, 0xCC, 0x68, 0xED, 0x80, 0x8B, 0x68, 0x6C, 0x70, 0x0E, 0x79, 0xAC, 0x60, 0xAD, 0x60, 0x70, 0x79, 0xAC, 0x58, 0xCE, 0x68, 0x8D, 0x68, 0x50, 0x79, 0x8D, 0x58, 0x0E, 0x71, 0x6E, 0x48, 0x6C, 0x50, 0x8C, 0x58, 0x6E, 0x40, 0xAD, 0x50, 0xAD, 0x48, 0x6C, 0x40,
+    0xAD, 0x40, 0x6D, 0x38, 0x0E, 0x51, 0x6C, 0x38, 0x8C, 0x40, 0xAD, 0x40, 0x4C, 0x38, 0x6D, 0x30, 0x4F, 0x51, 0xAC, 0x40, 0x4B, 0x30, 0x6A, 0x30, 0x4A, 0x28, 0x6B, 0x30, 0x6B, 0x28, 0x4E, 0x51, 0x6F, 0x72, 0x4E, 0x6A, 0x2E, 0x6A, 0x4E, 0x6A, 0xED, 0x61, 0xCC, 0x59, 0xED, 0x61, 0xAC, 0x59, 0xAC, 0x59, 0xAB, 0x59, 0x8B, 0x59, 0x8A, 0x51, 0x8B, 0x59, 0xCB, 0x61, 0x8A, 0x59, 0xCB, 0x61,
+    0xAA, 0x61, 0x8A, 0x59, 0x89, 0x51, 0x89, 0x59, 0xEA, 0x69, 0xAA, 0x69, 0xEB, 0x79, 0xCB, 0x71, 0xEB, 0x79, 0xCB, 0x71, 0x0B, 0x82, 0xAA, 0x81, 0x2C, 0x92, 0x0B, 0x92, 0xAA, 0x89, 0x2C, 0xB2, 0x2C, 0xBA, 0x6A, 0x99, 0x8A, 0x89, 0xAB, 0x91, 0x8B, 0x91, 0x2A, 0x79, 0x2A, 0x79, 0x2A, 0x71, 0x0B, 0x69, 0xCB, 0x60, 0xCC, 0x68, 0xCC, 0x68, 0x0C, 0x81, 0xAB, 0x68, 0xAC, 0x68, 0xED, 0x70,
+    0xED, 0x68, 0xAC, 0x60, 0x2E, 0x79, 0x8C, 0x68, 0xF1, 0x91, 0x0D, 0x69, 0xCE, 0x60, 0x6C, 0x50, 0x4F, 0x71, 0x8E, 0x50, 0x8B, 0x48, 0xAC, 0x58, 0x8D, 0x48, 0xAD, 0x50, 0xF2, 0x79, 0x90, 0x69, 0x8C, 0x38, 0x6C, 0x30, 0xCD, 0x48, 0x6B, 0x38, 0x2A, 0x30, 0xAC, 0x40, 0x8C, 0x38, 0x6C, 0x30, 0x8C, 0x38, 0x2D, 0x49, 0x6B, 0x30, 0x6B, 0x30, 0x4A, 0x30, 0x0D, 0x49, 0x6B, 0x28, 0x6A, 0x28,
+    0xAF, 0x7A, 0x8E, 0x72, 0x4E, 0x6A, 0x2D, 0x6A, 0x0D, 0x6A, 0xED, 0x61, 0xED, 0x61, 0xEC, 0x61, 0x6A, 0x51, 0xAB, 0x69, 0x6A, 0x51, 0x8B, 0x59, 0x0C, 0x72, 0xCB, 0x69, 0x8A, 0x59, 0xEB, 0x69, 0xEB, 0x69, 0x0C, 0x6A, 0xCA, 0x61, 0x4D, 0x72, 0x0B, 0x7A, 0x2C, 0x82, 0xEB, 0x79, 0xEB, 0x79, 0x6D, 0x92, 0xAA, 0x71, 0x8E, 0xAA, 0xCB, 0x89, 0xAE, 0xAA, 0xCE, 0xBA, 0x2C, 0xBA, 0x91, 0xFB,
+    0xD1, 0xFB, 0x4D, 0xD2, 0xCB, 0xA1, 0xCC, 0xA1, 0xCC, 0x99, 0x2A, 0x79, 0x29, 0x81, 0x6B, 0x81, 0x91, 0x99, 0xCB, 0x60, 0xCC, 0x60, 0x2F, 0x89, 0xEC, 0x78, 0xAB, 0x60, 0x70, 0x99, 0xCD, 0x70, 0xAB, 0x60, 0x6C, 0x60, 0x10, 0x79, 0x4E, 0x79, 0xD1, 0x89, 0xD0, 0x89, 0x4B, 0x50, 0x6D, 0x50, 0xF6, 0xB2, 0x51, 0x58, 0x6C, 0x50, 0x2E, 0x69, 0xD2, 0x58, 0x8D, 0x50, 0xCE, 0x50, 0xAF, 0x50,
+    0xAF, 0x48, 0x8F, 0x40, 0xCE, 0x58, 0x0A, 0x38, 0x2B, 0x30, 0x0A, 0x30, 0x8F, 0x69, 0x4C, 0x30, 0x2B, 0x30, 0x2C, 0x59, 0x6B, 0x30, 0xAC, 0x30, 0x4B, 0x30, 0x6C, 0x61, 0x8B, 0x30, 0x49, 0x28, 0xCF, 0x82, 0xAF, 0x7A, 0x6D, 0x6A, 0x4C, 0x6A, 0x2D, 0x6A, 0x6D, 0x72, 0x0C, 0x62, 0x4D, 0x72, 0x8A, 0x69, 0xEB, 0x61, 0x30, 0x8B, 0xCE, 0x82, 0x6D, 0x7A, 0x74, 0xBC, 0x71, 0x9B, 0xAE, 0x92,
+    0xCA, 0x69, 0x0E, 0x93, 0x74, 0xCC, 0x90, 0xA3, 0x8D, 0x8A, 0x8C, 0x9A, 0x4B, 0xAA, 0x92, 0xDB, 0x8D, 0xA2, 0xEA, 0x81, 0x7A, 0xFE, 0x55, 0xF5, 0xAF, 0xE3, 0x0F, 0xD3, 0x2C, 0xD2, 0xFF, 0xFF, 0xDF, 0xFF, 0x0B, 0xDA, 0x11, 0xEB, 0xAB, 0xD9, 0xD0, 0xEA, 0x29, 0x69, 0x28, 0x99, 0x30, 0xEA, 0xA9, 0x80, 0xEC, 0x60, 0x0C, 0x61, 0x0C, 0xA1, 0x75, 0xF9, 0xCB, 0x60, 0x4D, 0x71, 0xCF, 0x99,
+    0x6E, 0xA0, 0xCC, 0x58, 0xAB, 0x58, 0xCB, 0x78, 0xD7, 0xC9, 0x51, 0x81, 0x8C, 0x48, 0xAE, 0x60, 0x6E, 0x68, 0xF5, 0xA0, 0x4B, 0x48, 0x2F, 0x71, 0x16, 0x79, 0x55, 0x89, 0x4C, 0x40, 0x4F, 0x48, 0x16, 0x79, 0xF3, 0x60, 0x33, 0x71, 0x6E, 0x48, 0x4F, 0x48, 0xD3, 0x68, 0xF1, 0x60, 0x4D, 0x38, 0xB1, 0x50, 0xAF, 0x50, 0x4C, 0x38, 0xF3, 0x48, 0x4C, 0x28, 0x8C, 0x30, 0x8C, 0x30, 0x8B, 0x30,
+    0x6D, 0x72, 0x51, 0x8B, 0x6D, 0x6A, 0x74, 0xAC, 0x8E, 0x72, 0xF2, 0x9B, 0xCB, 0x59, 0xF4, 0xB3, 0xEB, 0x69, 0x6D, 0x7A, 0x13, 0xBC, 0xAB, 0x59, 0xB3, 0xBB, 0xF6, 0xE4, 0x0E, 0x9B, 0x36, 0xFD, 0x6C, 0x7A, 0xD2, 0xBB, 0xF3, 0xCB, 0x78, 0xFD, 0xB7, 0xE5, 0x8C, 0x92, 0x2A, 0x82, 0x34, 0xEC, 0xD6, 0xF4, 0x7D, 0xFF, 0x8C, 0x9A, 0x4B, 0x9A, 0x94, 0xDB, 0x94, 0xEB, 0x0A, 0xB2, 0x2F, 0xFB,
+    0xAD, 0xF2, 0x6D, 0xCA, 0x3B, 0xFF, 0x8A, 0x89, 0xCB, 0x89, 0x2A, 0x69, 0x8A, 0x81, 0x73, 0xC2, 0x49, 0x69, 0xEB, 0x60, 0xEB, 0x58, 0x0B, 0x69, 0x16, 0xF2, 0xAA, 0x58, 0x6D, 0x79, 0x0C, 0x69, 0xCB, 0x60, 0x53, 0xD1, 0x92, 0xA1, 0x89, 0x50, 0x0C, 0x59, 0x8E, 0x69, 0x37, 0xDA, 0x12, 0x99, 0x8A, 0x48, 0x8C, 0x48, 0xAB, 0x58, 0x54, 0x91, 0x33, 0x81, 0x51, 0x71, 0x8B, 0x38, 0x0D, 0x51,
+    0x14, 0x79, 0x4D, 0x48, 0xF4, 0x88, 0x2F, 0x59, 0x6E, 0x59, 0x13, 0x79, 0x14, 0x79, 0x2B, 0x30, 0xB5, 0x68, 0x4A, 0x30, 0xCF, 0x58, 0x31, 0x59, 0x4D, 0x40, 0xF4, 0x81, 0x8E, 0x40, 0xB2, 0x50, 0x8D, 0x6A, 0xCE, 0x72, 0x8D, 0x72, 0x6C, 0x6A, 0x2C, 0x62, 0x2C, 0x62, 0x6D, 0x72, 0x0B, 0x6A, 0xEA, 0x59, 0x2B, 0x72, 0xCB, 0x59, 0xEA, 0x59, 0xED, 0x8A, 0xED, 0x82, 0x0A, 0x6A, 0x09, 0x62,
+    0x2A, 0x6A, 0x4C, 0x72, 0x2B, 0x6A, 0x2A, 0x72, 0x6B, 0x82, 0xAC, 0x92, 0x8B, 0x8A, 0x6B, 0x8A, 0xAC, 0x9A, 0x2A, 0x82, 0x8B, 0x9A, 0xED, 0xB2, 0x2D, 0xCB, 0xEC, 0xBA, 0xAD, 0xB2, 0xCD, 0xC2, 0x8A, 0xB2, 0xCA, 0x99, 0x89, 0x81, 0xCA, 0x81, 0x8D, 0x9A, 0x29, 0x69, 0x48, 0x71, 0x29, 0x61, 0x6D, 0x79, 0xCA, 0x58, 0x0B, 0x61, 0xEC, 0x60, 0x0A, 0x69, 0xCA, 0x58, 0x50, 0x92, 0xEB, 0x60,
+    0xCB, 0x50, 0xCF, 0x81, 0xAB, 0x50, 0x0A, 0x59, 0x6D, 0x69, 0xED, 0x60, 0xAB, 0x48, 0xEC, 0x58, 0x4A, 0x48, 0x6C, 0x40, 0x8E, 0x69, 0x0D, 0x59, 0x6B, 0x38, 0x6B, 0x38, 0xCC, 0x48, 0x2E, 0x59, 0xCB, 0x40, 0xAA, 0x40, 0x4A, 0x40, 0x71, 0x82, 0x10, 0x7A, 0x6B, 0x30, 0x4A, 0x28, 0x4A, 0x28, 0x6A, 0x28, 0xA9, 0x48, 0xAE, 0x59, 0x6A, 0x28, 0x8C, 0x59, 0x6A, 0x28, 0x6A, 0x28, 0xAA, 0x28,
+    0x2B, 0x62, 0xEE, 0x7A, 0xCD, 0x72, 0x8D, 0x72, 0x6C, 0x6A, 0x2B, 0x62, 0x70, 0x93, 0x2B, 0x62, 0x0B, 0x6A, 0x6B, 0x72, 0x0B, 0x62, 0x2B, 0x6A, 0x8B, 0x7A, 0x2B, 0x6A, 0x8B, 0x7A, 0x4A, 0x7A, 0x6B, 0x72, 0xE9, 0x61, 0x0E, 0x8B, 0x6C, 0x7A, 0x4A, 0x82, 0x0D, 0x9B, 0xEC, 0x9A, 0x8B, 0x82, 0xCC, 0x9A, 0x6F, 0xBB, 0xAC, 0xB2, 0x30, 0xFC, 0xB3, 0xFC, 0xD0, 0xE3, 0x4E, 0xC3, 0xCC, 0xB2,
+    0x6B, 0xA2, 0xCA, 0x91, 0xA9, 0x79, 0xCA, 0x81, 0xD0, 0xBA, 0x8A, 0x71, 0x8A, 0x79, 0x69, 0x71, 0xEA, 0x60, 0xEA, 0x58, 0x0B, 0x59, 0x2A, 0x71, 0x6B, 0x71, 0xA9, 0x58, 0x6C, 0x69, 0x4F, 0x81, 0x4E, 0x92, 0x6D, 0x92, 0xAC, 0x58, 0xB3, 0xA2, 0x8A, 0x48, 0x4A, 0x40, 0xCF, 0x60, 0xB8, 0xDC, 0xCB, 0x48, 0xEE, 0x58, 0x10, 0x69, 0xCA, 0x48, 0x8B, 0x40, 0x6C, 0x40, 0x8C, 0x48, 0xAB, 0x40,
+    0x2D, 0x51, 0x31, 0x8A, 0x0D, 0x51, 0x49, 0x30, 0xCC, 0x40, 0xCD, 0x40, 0x4B, 0x30, 0x6A, 0x30, 0x69, 0x28, 0x6C, 0x51, 0xCB, 0x38, 0x8A, 0x30, 0xD1, 0x82, 0x6A, 0x28, 0x8A, 0x28, 0x8A, 0x28, 0x2E, 0x9B, 0x0E, 0x7B, 0xED, 0x7A, 0xAD, 0x72, 0x6B, 0x6A, 0xEE, 0x7A, 0xCD, 0x7A, 0x8C, 0x72, 0xAC, 0x9A, 0x8B, 0x72, 0xD0, 0x9B, 0x90, 0x93, 0x4A, 0x72, 0x2A, 0x6A, 0xCB, 0x82, 0x8E, 0xBB,
+    0x0C, 0xB3, 0x8B, 0x72, 0x29, 0x6A, 0x31, 0xBC, 0x4D, 0xB3, 0x6E, 0xCB, 0xF2, 0xDC, 0x34, 0xED, 0xAF, 0xBB, 0x2C, 0xAB, 0xF1, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0xEB, 0x5C, 0xFF, 0x8D, 0xCB, 0xD3, 0xE4, 0x14, 0xDD, 0x89, 0x79, 0x6E, 0xC3, 0xCE, 0xB2, 0x69, 0x69, 0xE9, 0x89, 0x12, 0xE4, 0x2A, 0x69, 0x0A, 0x59, 0x2B, 0x59, 0xC9, 0x60, 0xF2, 0xB1, 0xE9, 0x58, 0xCD, 0x71, 0xC9, 0x58,
+    0xB0, 0x99, 0x50, 0x9A, 0xA9, 0x48, 0x12, 0x9B, 0x52, 0x91, 0x89, 0x40, 0xEB, 0x48, 0xCE, 0x71, 0x4D, 0x50, 0x0D, 0x49, 0x4C, 0x51, 0xAB, 0x48, 0x4E, 0x58, 0x6B, 0x38, 0xCA, 0x40, 0xCA, 0x40, 0x12, 0x61, 0x6D, 0x59, 0xCF, 0x69, 0x28, 0x28, 0x12, 0x61, 0x10, 0x59, 0x49, 0x28, 0x8A, 0x30, 0xAF, 0x40, 0x6D, 0x51, 0x28, 0x20, 0x69, 0x20, 0x2B, 0x49, 0xAB, 0x30, 0x69, 0x28, 0x89, 0x28,
+    0xAC, 0x72, 0xD0, 0x93, 0xAC, 0x6A, 0x4F, 0x83, 0x8C, 0x6A, 0x8C, 0x72, 0x4B, 0x6A, 0xF3, 0xB4, 0x4D, 0x83, 0xED, 0x82, 0x4B, 0x62, 0x75, 0xCD, 0xAF, 0x93, 0x38, 0xE6, 0x4D, 0x8B, 0x0C, 0x8B, 0x89, 0x8A, 0x10, 0xAC, 0xCC, 0x82, 0x8B, 0x7A, 0x0C, 0x9B, 0xDB, 0xFF, 0x4F, 0xCC, 0xEB, 0x92, 0xEC, 0x9A, 0x30, 0xD4, 0x75, 0xF5, 0xD5, 0xF5, 0xF2, 0xFC, 0xB4, 0xFC, 0x55, 0xFD, 0x8B, 0xA2,
+    0x8C, 0x92, 0x4B, 0x92, 0x68, 0x71, 0x69, 0xA1, 0x8D, 0x92, 0x28, 0x61, 0xC9, 0x79, 0x4E, 0xBA, 0xAE, 0x81, 0xE7, 0x40, 0x2A, 0x59, 0xEA, 0x60, 0xD1, 0xB9, 0x8D, 0x81, 0xAD, 0x69, 0xC9, 0x50, 0xAD, 0x79, 0x91, 0xA1, 0xEA, 0x50, 0xEC, 0x69, 0xAB, 0x48, 0x94, 0xA9, 0x4D, 0x59, 0x2C, 0x59, 0xEE, 0x69, 0x92, 0x81, 0x30, 0x79, 0xEC, 0x48, 0x6C, 0x59, 0xCA, 0x38, 0xEF, 0x60, 0x0F, 0x61,
+    0xA9, 0x38, 0xE9, 0x40, 0x70, 0x61, 0xEF, 0x58, 0x69, 0x28, 0x69, 0x30, 0x28, 0x28, 0xF3, 0x58, 0xCF, 0x50, 0xEC, 0x38, 0xA9, 0x30, 0xEF, 0x50, 0x49, 0x28, 0xCD, 0x40, 0x89, 0x28, 0x89, 0x28, 0x0C, 0x7B, 0x2D, 0x7B, 0xED, 0x7A, 0x72, 0xA4, 0xED, 0x72, 0xB2, 0xAC, 0xAC, 0x6A, 0x8B, 0x6A, 0xB3, 0xB4, 0x8E, 0x93, 0xD6, 0xE5, 0x6A, 0x6A, 0x2A, 0x6A, 0x93, 0xBC, 0x6E, 0x9B, 0x9C, 0xFF,
+    0x0B, 0x8B, 0xAB, 0x7A, 0x49, 0x7A, 0x17, 0xFE, 0x0E, 0xB4, 0x6E, 0xC4, 0x8D, 0xAB, 0xF8, 0xEE, 0x97, 0xFD, 0xCA, 0x9A, 0x2E, 0xAB, 0xAE, 0xC3, 0x4C, 0xB3, 0x78, 0xF6, 0x6B, 0x9A, 0xC8, 0x71, 0x0D, 0xA3, 0x6C, 0x92, 0x13, 0xEB, 0xA9, 0x79, 0x0B, 0x82, 0x48, 0x59, 0xA8, 0x71, 0x13, 0xEB, 0x6C, 0x71, 0xE6, 0x40, 0x2A, 0x59, 0xE9, 0x58, 0x8F, 0xA9, 0x30, 0xAA, 0x2A, 0x59, 0x2A, 0x59,
+    0x4B, 0x61, 0xB2, 0xB1, 0x2D, 0x61, 0xE9, 0x48, 0xA9, 0x40, 0xCB, 0x48, 0x92, 0xA1, 0xCB, 0x50, 0x6C, 0x59, 0x2D, 0x51, 0x8B, 0x38, 0x51, 0x71, 0xEF, 0x58, 0x8B, 0x38, 0xAE, 0x59, 0x69, 0x30, 0x32, 0x81, 0x32, 0x79, 0xEA, 0x48, 0x0C, 0x49, 0x6A, 0x28, 0xCE, 0x58, 0x49, 0x30, 0xEB, 0x38, 0x8A, 0x28, 0x69, 0x28, 0xF0, 0x58, 0xA9, 0x28, 0x4B, 0x30, 0x68, 0x20, 0x89, 0x28, 0x8C, 0x38,
+    0x0F, 0x9C, 0xB5, 0xDD, 0x0D, 0x7B, 0xEC, 0x72, 0xAC, 0x72, 0xCC, 0x72, 0xD5, 0xC4, 0x8E, 0x8B, 0x8A, 0x72, 0xCF, 0x93, 0x8B, 0x6A, 0x32, 0xBC, 0x99, 0xFE, 0xCB, 0x7A, 0x8D, 0x8B, 0x6D, 0x93, 0x8D, 0x93, 0x35, 0xE5, 0xD2, 0xC4, 0x2B, 0x8B, 0x8C, 0xA3, 0xD1, 0xDC, 0xF2, 0xE4, 0x56, 0xF5, 0x32, 0xDD, 0xEF, 0xC3, 0xEC, 0x92, 0xAE, 0xB3, 0xB4, 0xE4, 0xCB, 0xA2, 0x6A, 0x8A, 0x4A, 0x82,
+    0xB0, 0xBB, 0x6B, 0x92, 0x0F, 0xCB, 0xC8, 0x71, 0xEF, 0xAA, 0x89, 0x61, 0xC8, 0x71, 0x6F, 0xAA, 0xC8, 0x48, 0x29, 0x51, 0x4A, 0x59, 0x08, 0x59, 0x91, 0xB2, 0x0D, 0x7A, 0xED, 0x79, 0x0C, 0x61, 0xCC, 0x71, 0x2F, 0x82, 0xAF, 0x89, 0x4D, 0x69, 0xA9, 0x40, 0x8A, 0x40, 0x4C, 0x51, 0x91, 0x89, 0xCC, 0x48, 0xA8, 0x38, 0x8C, 0x40, 0x69, 0x38, 0xCF, 0x61, 0x50, 0x69, 0xEB, 0x38, 0x0B, 0x41,
+    0xCA, 0x38, 0x2E, 0x62, 0x8C, 0x48, 0x0F, 0x71, 0x89, 0x30, 0xEF, 0x59, 0x4D, 0x49, 0x6A, 0x30, 0x71, 0x69, 0x6A, 0x28, 0x2A, 0x39, 0x88, 0x28, 0x69, 0x28, 0xA9, 0x28, 0xCE, 0x50, 0x68, 0x28, 0x0F, 0x94, 0xEF, 0x8B, 0xB1, 0xBC, 0x0D, 0x7B, 0x75, 0xE5, 0x0D, 0x7B, 0x2D, 0x83, 0xCB, 0x72, 0xAB, 0x7A, 0xCB, 0x72, 0xAB, 0x6A, 0x8D, 0x8B, 0xAE, 0x93, 0x70, 0xA4, 0x50, 0xAC, 0x6F, 0xB4,
+    0x8D, 0x9B, 0x6C, 0x93, 0xCE, 0x9B, 0x94, 0xDD, 0x0D, 0xB4, 0xB3, 0xFD, 0xFB, 0xFF, 0xFB, 0xFF, 0x76, 0xFE, 0xEE, 0xBB, 0x2C, 0x93, 0x4F, 0xC4, 0x8A, 0x8A, 0x2C, 0x9B, 0x4C, 0xAB, 0xCB, 0x9A, 0xAB, 0x92, 0xB3, 0xD4, 0x67, 0x69, 0xC8, 0x81, 0x6B, 0x82, 0x48, 0x59, 0xE8, 0x71, 0x0B, 0x7A, 0x2A, 0x61, 0x49, 0x51, 0x2A, 0x51, 0xEB, 0x79, 0xEF, 0x91, 0x8B, 0x69, 0x50, 0x92, 0x6C, 0x61,
+    0x10, 0x92, 0x8C, 0x69, 0x6F, 0x7A, 0xE9, 0x50, 0x2F, 0x71, 0xAA, 0x40, 0xCB, 0x50, 0xEA, 0x48, 0x71, 0x79, 0x6B, 0x51, 0x6C, 0x49, 0x68, 0x30, 0xEF, 0x58, 0x89, 0x38, 0xCA, 0x38, 0x2D, 0x51, 0x4E, 0x59, 0x4F, 0x6A, 0xEA, 0x38, 0x6F, 0x61, 0x6B, 0x38, 0x4E, 0x62, 0x51, 0x83, 0xAA, 0x38, 0xEE, 0x48, 0x49, 0x28, 0x4C, 0x41, 0xC8, 0x28, 0x89, 0x28, 0x88, 0x28, 0x8B, 0x41, 0x0A, 0x39,
+    0x70, 0x9C, 0xAE, 0x83, 0xAE, 0x8B, 0x30, 0x94, 0x6D, 0x83, 0x0C, 0x7B, 0xEC, 0x72, 0x0C, 0x83, 0xAC, 0x8B, 0xAB, 0x6A, 0xCB, 0x72, 0xCD, 0x93, 0x4E, 0xA4, 0x14, 0xD6, 0x2E, 0x9C, 0xCB, 0x9B, 0xDE, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0xAD, 0x9B, 0x2E, 0xBC, 0x95, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0xFF, 0xD0, 0xD4, 0x38, 0xF7, 0x0E, 0xBC, 0xCA, 0x92, 0x98, 0xFE, 0xAA, 0x92, 0x35, 0xFD,
+    0xEC, 0x92, 0x6E, 0xA3, 0xEB, 0x79, 0x0B, 0x9A, 0x8C, 0x8A, 0x48, 0x51, 0x87, 0x61, 0x69, 0x69, 0x4B, 0x61, 0x29, 0x51, 0x29, 0x51, 0xEA, 0x71, 0xF0, 0xB1, 0x6D, 0x7A, 0x09, 0x49, 0xAC, 0x61, 0x4C, 0x69, 0x09, 0x49, 0xED, 0x69, 0x87, 0x38, 0x68, 0x38, 0x4E, 0x69, 0xC9, 0x38, 0x09, 0x41, 0x69, 0x38, 0xB3, 0x9A, 0x8C, 0x49, 0x0A, 0x41, 0xAA, 0x38, 0xEC, 0x50, 0x4F, 0x61, 0x52, 0x7B,
+    0x0E, 0x5A, 0x2C, 0x49, 0xCB, 0x40, 0xEA, 0x38, 0xC8, 0x30, 0x6A, 0x49, 0x4E, 0x51, 0xCB, 0x38, 0x88, 0x28, 0x69, 0x28, 0xAB, 0x38, 0x8E, 0x51, 0x68, 0x20, 0x8B, 0x41, 0xAF, 0x6A, 0x68, 0x20, 0x2F, 0x8C, 0xD1, 0xA4, 0xEE, 0x8B, 0x8E, 0x8B, 0x6E, 0x83, 0x4D, 0x7B, 0x6E, 0x9C, 0xB3, 0xC5, 0x4C, 0x83, 0xCB, 0x72, 0x0B, 0x73, 0x18, 0xEF, 0x2C, 0x83, 0x31, 0xBD, 0xEA, 0x7A, 0xD8, 0xF6,
+    0xDC, 0xFF, 0xAC, 0x9B, 0xEE, 0xA3, 0xAD, 0xA3, 0x5A, 0xFF, 0x55, 0xF6, 0x58, 0xFF, 0x13, 0xFE, 0x8F, 0xCC, 0xF1, 0xE4, 0x0B, 0x9B, 0x2F, 0xB4, 0x6A, 0x82, 0xAC, 0x9A, 0xD4, 0xFC, 0x6A, 0x7A, 0xCC, 0x8A, 0x90, 0xAB, 0xA8, 0x69, 0x09, 0x7A, 0x0A, 0x72, 0x27, 0x51, 0xC9, 0x69, 0xAE, 0x9A, 0x6B, 0x61, 0x28, 0x49, 0x49, 0x51, 0x4B, 0x7A, 0xB2, 0xC2, 0x8D, 0x7A, 0xE9, 0x48, 0x4B, 0x61,
+    0x29, 0x51, 0xD1, 0x99, 0x8A, 0x59, 0x0A, 0x49, 0xEA, 0x48, 0x6A, 0x51, 0x0C, 0x59, 0x0D, 0x62, 0x89, 0x30, 0xCD, 0x59, 0x90, 0x81, 0x2B, 0x41, 0xA9, 0x30, 0x4C, 0x49, 0x0A, 0x39, 0x0F, 0x69, 0x2A, 0x41, 0x69, 0x30, 0x0B, 0x39, 0xCA, 0x38, 0x4D, 0x49, 0x47, 0x20, 0x67, 0x28, 0xA8, 0x28, 0x0D, 0x51, 0x49, 0x28, 0x88, 0x28, 0xE9, 0x30, 0x47, 0x20, 0xB2, 0x7A, 0x88, 0x28, 0x47, 0x18,
+    0x2F, 0x94, 0x0E, 0x8C, 0xAE, 0x83, 0x4D, 0x7B, 0x8D, 0x83, 0x4E, 0x9C, 0x70, 0x9C, 0x2C, 0x7B, 0x4D, 0x7B, 0x2E, 0x9C, 0xDC, 0xFF, 0xCC, 0x93, 0x8D, 0x8B, 0x51, 0xBD, 0x79, 0xFF, 0x79, 0xFF, 0x52, 0xD5, 0xD1, 0xC4, 0x0E, 0xAC, 0x57, 0xFE, 0x8F, 0xBC, 0x90, 0xC4, 0x0D, 0xB4, 0x2E, 0xBC, 0xD4, 0xF5, 0x0E, 0xB4, 0xEB, 0x82, 0x2C, 0x93, 0xEB, 0x92, 0x37, 0xFD, 0xAA, 0x82, 0x29, 0x72,
+    0x6F, 0xA3, 0x8E, 0x9B, 0x92, 0xE3, 0xC8, 0x61, 0xCE, 0x92, 0x27, 0x51, 0xC8, 0x61, 0xB1, 0xAA, 0x2A, 0x69, 0x29, 0x49, 0x49, 0x51, 0x0A, 0x6A, 0x71, 0xBA, 0xAA, 0x61, 0x09, 0x49, 0x8B, 0x61, 0xE7, 0x48, 0xCF, 0x89, 0x49, 0x49, 0x4D, 0x61, 0x0A, 0x49, 0x2A, 0x49, 0xEA, 0x58, 0xCF, 0x69, 0xC9, 0x38, 0x6D, 0x62, 0xA9, 0x30, 0x2F, 0x71, 0xA8, 0x30, 0x0A, 0x41, 0xA9, 0x30, 0x0A, 0x41,
+    0xCC, 0x50, 0x8A, 0x30, 0x0D, 0x49, 0x4E, 0x51, 0x0D, 0x52, 0x0F, 0x59, 0x8A, 0x38, 0xC9, 0x30, 0xC8, 0x28, 0x68, 0x20, 0xAD, 0x48, 0xA9, 0x30, 0x87, 0x20, 0x46, 0x18, 0x27, 0x18, 0xEE, 0x50, 0x2F, 0x94, 0x73, 0xCD, 0xF1, 0xB4, 0xF7, 0xE6, 0x8C, 0x83, 0xAD, 0x8B, 0xF3, 0xB4, 0x6C, 0x7B, 0xDC, 0xFF, 0x6C, 0x7B, 0x8D, 0x83, 0x0D, 0x94, 0xEE, 0xA3, 0x93, 0xDD, 0x6C, 0x83, 0xF8, 0xEE,
+    0xD0, 0xC4, 0xF7, 0xF6, 0xFF, 0xFF, 0xD5, 0xF6, 0xAF, 0xC4, 0xED, 0xA3, 0x8C, 0x9B, 0x12, 0xE5, 0x0D, 0xB4, 0xB7, 0xF6, 0xCB, 0x82, 0xEF, 0xAB, 0x58, 0xFE, 0x52, 0xDC, 0xF4, 0xDD, 0xC8, 0x61, 0x49, 0x72, 0xEF, 0xA3, 0x71, 0xCB, 0xC8, 0x61, 0xAC, 0x7A, 0x68, 0x51, 0x87, 0x59, 0xD2, 0xCA, 0x6B, 0x61, 0x27, 0x41, 0x68, 0x49, 0x4B, 0x72, 0x8E, 0x81, 0x69, 0x59, 0x08, 0x41, 0xC7, 0x40,
+    0x6B, 0x61, 0x09, 0x41, 0x4F, 0x89, 0x09, 0x49, 0xB0, 0x71, 0x2B, 0x49, 0xEC, 0x61, 0xD2, 0x91, 0x2E, 0x59, 0xA8, 0x38, 0x87, 0x30, 0xC9, 0x30, 0x71, 0x79, 0x2D, 0x59, 0x0A, 0x39, 0x2B, 0x49, 0x88, 0x30, 0xCB, 0x40, 0x0D, 0x51, 0x68, 0x28, 0xA9, 0x30, 0xC8, 0x28, 0x88, 0x28, 0xEE, 0x58, 0xC8, 0x28, 0x88, 0x28, 0x87, 0x20, 0x67, 0x20, 0xCD, 0x48, 0x68, 0x28, 0x67, 0x20, 0x68, 0x20,
+    0x32, 0xB5, 0xAF, 0xA4, 0x0D, 0x8C, 0x0E, 0x8C, 0xED, 0x8B, 0xAC, 0x83, 0xD6, 0xDD, 0x6B, 0x83, 0x8D, 0x83, 0x8C, 0x83, 0x33, 0xD6, 0x97, 0xFE, 0x11, 0xBD, 0x74, 0xEE, 0xF9, 0xF7, 0x16, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0xFF, 0xCF, 0xCC, 0xED, 0xA3, 0x77, 0xFF, 0xAC, 0x9B, 0x8C, 0x93, 0xAC, 0x9B, 0xCF, 0xA3, 0x71, 0xBC, 0xB1, 0xC3, 0x49, 0x72, 0x6C, 0x93, 0xF0, 0xB3,
+    0xE8, 0x61, 0x4E, 0x93, 0xE8, 0x61, 0x09, 0x72, 0x4A, 0x72, 0x68, 0x49, 0xE8, 0x59, 0xEF, 0x92, 0xEC, 0x71, 0x48, 0x49, 0x28, 0x49, 0xCC, 0x7A, 0xCE, 0x81, 0x69, 0x51, 0x29, 0x49, 0x87, 0x38, 0xCA, 0x69, 0xEB, 0x61, 0xB0, 0x89, 0x8A, 0x49, 0x4C, 0x59, 0x4A, 0x49, 0x6B, 0x49, 0x6A, 0x49, 0xF0, 0x79, 0x6D, 0x59, 0xA9, 0x30, 0x87, 0x28, 0xE9, 0x40, 0x0E, 0x61, 0x47, 0x28, 0xE9, 0x38,
+    0xE8, 0x30, 0x2B, 0x41, 0x87, 0x20, 0x2F, 0x59, 0x88, 0x28, 0xA8, 0x28, 0xED, 0x48, 0xE8, 0x30, 0x09, 0x31, 0x0E, 0x51, 0x8B, 0x30, 0x67, 0x20, 0x88, 0x20, 0x87, 0x20, 0xCD, 0x48, 0xAB, 0x30, 0xAF, 0x9C, 0x6F, 0x94, 0xCF, 0x9C, 0x72, 0xAD, 0xCD, 0x83, 0xCD, 0x83, 0xED, 0x8B, 0xCD, 0x8B, 0xFB, 0xF7, 0xCD, 0x83, 0xCF, 0xA4, 0xEF, 0xAC, 0x9A, 0xF7, 0x2D, 0x94, 0xCC, 0x8B, 0x75, 0xE6,
+    0xB1, 0xD5, 0xFF, 0xFF, 0xFE, 0xFF, 0x90, 0xED, 0x2D, 0xAC, 0xFF, 0xFF, 0xED, 0x9B, 0xAC, 0x93, 0x6C, 0x93, 0x4C, 0x93, 0xB7, 0xFE, 0xA9, 0x72, 0xEB, 0x82, 0xAB, 0x7A, 0x91, 0xB4, 0x29, 0x72, 0x09, 0x62, 0xAE, 0x93, 0xC8, 0x59, 0xE9, 0x79, 0x68, 0x59, 0x88, 0x51, 0xCA, 0x6A, 0x0A, 0x6A, 0x6A, 0x59, 0x28, 0x41, 0x28, 0x41, 0x56, 0xE6, 0xF0, 0x91, 0x89, 0x59, 0x09, 0x41, 0x4A, 0x51,
+    0x88, 0x51, 0x09, 0x49, 0xC7, 0x38, 0xAC, 0x59, 0x29, 0x41, 0x6E, 0x69, 0x4A, 0x52, 0x29, 0x41, 0xA7, 0x30, 0xA8, 0x30, 0xCB, 0x40, 0x09, 0x39, 0xC7, 0x30, 0xA8, 0x30, 0x4F, 0x61, 0x6B, 0x51, 0x09, 0x39, 0xAA, 0x28, 0x68, 0x28, 0x0D, 0x49, 0x09, 0x39, 0xEA, 0x30, 0x88, 0x28, 0x8A, 0x30, 0x66, 0x20, 0x88, 0x20, 0xA8, 0x28, 0x87, 0x20, 0xAB, 0x30, 0x88, 0x20, 0x87, 0x20, 0x66, 0x18,
+    0x10, 0xA5, 0xD3, 0xB5, 0xAF, 0x9C, 0x6E, 0x94, 0x6F, 0x9C, 0x2E, 0x94, 0xFD, 0xFF, 0x4D, 0x94, 0x2E, 0x94, 0x0E, 0x8C, 0x8F, 0xA4, 0xFD, 0xFF, 0x8E, 0xA4, 0xCC, 0x8B, 0x6E, 0x9C, 0x33, 0xD6, 0xF9, 0xFF, 0x14, 0xE6, 0x8E, 0xBC, 0xEC, 0xA3, 0xFC, 0xFF, 0xCD, 0x9B, 0x0A, 0x7B, 0xCD, 0x9B, 0xAC, 0x93, 0x56, 0xFE, 0xCA, 0x7A, 0x89, 0x6A, 0x8E, 0x93, 0x09, 0x62, 0xD2, 0xCC, 0x2C, 0x83,
+    0xE9, 0x69, 0x75, 0xCE, 0x67, 0x51, 0x08, 0x62, 0x2B, 0x6A, 0x68, 0x49, 0x6A, 0x6A, 0xB1, 0xB3, 0x8A, 0x59, 0x48, 0x41, 0x28, 0x41, 0x51, 0xAC, 0x4F, 0x8A, 0x69, 0x51, 0x28, 0x41, 0xC7, 0x38, 0x48, 0x49, 0x8E, 0x81, 0xE8, 0x38, 0xCC, 0x59, 0xE8, 0x38, 0x29, 0x41, 0x8D, 0x69, 0x4B, 0x51, 0xE8, 0x38, 0xC8, 0x30, 0xC9, 0x38, 0xED, 0x50, 0x08, 0x39, 0xA7, 0x28, 0xA8, 0x28, 0x0D, 0x59,
+    0x28, 0x39, 0x87, 0x20, 0x68, 0x20, 0xA8, 0x30, 0x0D, 0x51, 0xA7, 0x28, 0xCA, 0x30, 0xE8, 0x30, 0xA8, 0x28, 0xED, 0x48, 0x87, 0x20, 0xA8, 0x28, 0x87, 0x20, 0xEC, 0x40, 0xC8, 0x28, 0x67, 0x18, 0x10, 0xA5, 0xCF, 0x9C, 0x51, 0xAD, 0xCF, 0x9C, 0xFD, 0xFF, 0xFF, 0xFF, 0x30, 0xB5, 0x4E, 0x94, 0x6E, 0x94, 0xFE, 0xFF, 0xF8, 0xE6, 0x10, 0xAD, 0x6E, 0x9C, 0x6D, 0x94, 0xFB, 0xFF, 0x95, 0xDE,
+    0xAE, 0xA4, 0xCF, 0xB4, 0xD2, 0xCD, 0x17, 0xFF, 0xED, 0x93, 0x8C, 0x8B, 0x0A, 0x7B, 0xEE, 0x9B, 0x8F, 0xC4, 0x0A, 0x7B, 0x89, 0x6A, 0xCA, 0x7A, 0xB0, 0xAC, 0x32, 0xCC, 0x59, 0xEF, 0x08, 0x62, 0xE8, 0x61, 0xEB, 0x7A, 0x30, 0xB3, 0xA7, 0x51, 0x0A, 0x62, 0x67, 0x49, 0x29, 0x62, 0x6C, 0x8A, 0x29, 0x51, 0x28, 0x41, 0x28, 0x41, 0xD0, 0x93, 0x30, 0x9A, 0x28, 0x49, 0x28, 0x41, 0xE8, 0x40,
+    0x69, 0x51, 0x8F, 0x8A, 0xEA, 0x48, 0x8A, 0x49, 0x2B, 0x49, 0xC8, 0x38, 0xCD, 0x71, 0xC8, 0x30, 0x4C, 0x51, 0xE8, 0x38, 0xA8, 0x28, 0x4E, 0x61, 0xC9, 0x38, 0xE8, 0x30, 0xA7, 0x28, 0x87, 0x28, 0x4E, 0x61, 0x88, 0x28, 0xA7, 0x20, 0xEA, 0x30, 0xA7, 0x28, 0xED, 0x50, 0xA8, 0x28, 0x2A, 0x39, 0xE8, 0x30, 0x87, 0x20, 0x2C, 0x51, 0xA8, 0x28, 0xC8, 0x28, 0x87, 0x20, 0x87, 0x20, 0xCB, 0x38,
+    0x71, 0xAD, 0xF0, 0xA4, 0xFA, 0xFF, 0xFD, 0xFF, 0xB2, 0xBD, 0x30, 0xAD, 0x10, 0xB5, 0x92, 0xCD, 0xFE, 0xFF, 0xF4, 0xE6, 0x12, 0xCE, 0x10, 0xAD, 0xD4, 0xE6, 0x33, 0xE6, 0xF6, 0xEE, 0x6E, 0xA4, 0x30, 0xAD, 0x53, 0xCE, 0x76, 0xF6, 0xAC, 0x8B, 0xAC, 0x83, 0x6B, 0x83, 0x0A, 0x73, 0x54, 0xF5, 0x2D, 0x8C, 0xAA, 0x72, 0xEB, 0x7A, 0x49, 0x6A, 0xAE, 0xAB, 0x92, 0xD4, 0x08, 0x5A, 0xF1, 0xAB,
+    0x09, 0x62, 0x2A, 0x72, 0x0F, 0xAB, 0xA8, 0x61, 0xC9, 0x59, 0x47, 0x41, 0xA8, 0x61, 0x4D, 0x8A, 0x49, 0x51, 0x28, 0x41, 0x08, 0x41, 0xED, 0x72, 0x90, 0x92, 0xAA, 0x61, 0x28, 0x41, 0x4A, 0x49, 0xCA, 0x61, 0x2A, 0x61, 0xAB, 0x71, 0x49, 0x49, 0xA8, 0x38, 0x49, 0x41, 0xC9, 0x38, 0x6D, 0x69, 0xC8, 0x30, 0xA8, 0x30, 0x87, 0x28, 0x29, 0x41, 0x6E, 0x61, 0xEA, 0x40, 0x87, 0x28, 0x87, 0x28,
+    0x29, 0x39, 0xEF, 0x61, 0x89, 0x38, 0xA7, 0x28, 0xC9, 0x30, 0xC9, 0x30, 0x67, 0x20, 0xEC, 0x48, 0x67, 0x20, 0x0B, 0x39, 0x66, 0x20, 0x67, 0x20, 0xEB, 0x48, 0xE9, 0x30, 0xC8, 0x28, 0x67, 0x20, 0x35, 0xDE, 0xFD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF2, 0xCD, 0x17, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDA, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xB5, 0x2C, 0x94,
+    0xF9, 0xFF, 0x35, 0xFE, 0x2D, 0x9C, 0xCC, 0x8B, 0x8C, 0x83, 0x2B, 0x83, 0xF0, 0xCC, 0x72, 0xD5, 0xA9, 0x72, 0x4C, 0x83, 0x30, 0xAC, 0x49, 0x6A, 0x79, 0xFE, 0x29, 0x62, 0xAB, 0x72, 0xE8, 0x61, 0xA7, 0x51, 0x8B, 0x92, 0x4E, 0x9B, 0xE9, 0x69, 0xA9, 0x59, 0x68, 0x41, 0xC8, 0x51, 0xD0, 0xB2, 0x8B, 0x71, 0x28, 0x41, 0x28, 0x41, 0xE9, 0x59, 0x0A, 0x69, 0x08, 0x49, 0x48, 0x41, 0x49, 0x49,
+    0xAA, 0x51, 0x6A, 0x51, 0xCD, 0x81, 0x4A, 0x49, 0xC7, 0x30, 0x6A, 0x51, 0xE7, 0x30, 0xC9, 0x40, 0x4C, 0x59, 0x09, 0x41, 0xC8, 0x30, 0xE8, 0x30, 0x6C, 0x49, 0x6F, 0x61, 0x4D, 0x49, 0x87, 0x20, 0xC7, 0x28, 0xC8, 0x28, 0x49, 0x28, 0x0E, 0x61, 0x87, 0x20, 0xE9, 0x30, 0x88, 0x28, 0xA8, 0x30, 0x87, 0x20, 0xCA, 0x30, 0x67, 0x20, 0xA7, 0x20, 0x87, 0x20, 0x67, 0x20, 0xCA, 0x40, 0x67, 0x18,
+    0x16, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xDE, 0x50, 0xAD, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xD4, 0xF6, 0x58, 0xF7, 0xFF, 0xFF, 0xFB, 0xFF, 0x30, 0xB5, 0xCC, 0x83, 0xAF, 0xA4, 0xEC, 0x8B, 0xED, 0x8B, 0xAC, 0x83, 0xAD, 0x8B, 0xAC, 0x8B, 0xEA, 0x72, 0xCA, 0x72, 0xAA, 0x6A, 0x89, 0x6A, 0xA9, 0x6A, 0x49, 0x62, 0x2D, 0x83, 0xE8, 0x51, 0xAB, 0x7A, 0x29, 0x62,
+    0x2A, 0x62, 0xC8, 0x51, 0x87, 0x49, 0x4B, 0x72, 0xC9, 0x59, 0x67, 0x41, 0x87, 0x49, 0x47, 0x49, 0x69, 0x51, 0x27, 0x39, 0x28, 0x39, 0x6B, 0x62, 0x2F, 0x8A, 0x28, 0x49, 0x08, 0x39, 0x09, 0x41, 0x69, 0x49, 0x49, 0x49, 0x29, 0x49, 0x28, 0x41, 0xE7, 0x30, 0xED, 0x61, 0x28, 0x39, 0xE9, 0x40, 0x6D, 0x61, 0x8A, 0x49, 0xEA, 0x40, 0x0C, 0x49, 0xE8, 0x30, 0xE8, 0x30, 0x67, 0x20, 0xEB, 0x38,
+    0xA6, 0x20, 0xA7, 0x20, 0x87, 0x20, 0xEC, 0x48, 0xA6, 0x28, 0xA7, 0x20, 0xC8, 0x28, 0xA7, 0x28, 0x87, 0x20, 0x0C, 0x41, 0xC7, 0x28, 0x86, 0x20, 0xA9, 0x30, 0xA7, 0x20, 0xA7, 0x20, 0xED, 0x50, 0x96, 0xF7, 0xB1, 0xB5, 0xF2, 0xB5, 0xF2, 0xBD, 0x30, 0xA5, 0x2F, 0xAD, 0xFF, 0xFF, 0xF8, 0xFF, 0xF9, 0xFF, 0x12, 0xC6, 0x12, 0xD6, 0x59, 0xF7, 0xF2, 0xCD, 0x10, 0xBD, 0x6E, 0x9C, 0x6D, 0xA4,
+    0x6D, 0x94, 0xAC, 0x83, 0xCD, 0x8B, 0xCC, 0x8B, 0xD8, 0xFF, 0x6E, 0x9C, 0xAA, 0x6A, 0x0E, 0x8C, 0xA9, 0x6A, 0x74, 0xDD, 0x29, 0x5A, 0x08, 0x52, 0xAA, 0x6A, 0x08, 0x52, 0x6A, 0x72, 0x29, 0x5A, 0xC8, 0x51, 0xA8, 0x49, 0xA8, 0x49, 0x67, 0x49, 0x88, 0x49, 0x47, 0x41, 0x67, 0x49, 0x0B, 0x6A, 0x07, 0x39, 0x07, 0x39, 0x08, 0x39, 0xC8, 0x51, 0x6B, 0x59, 0x08, 0x41, 0x28, 0x39, 0x29, 0x41,
+    0x69, 0x49, 0xAD, 0x79, 0x08, 0x39, 0x08, 0x39, 0xE8, 0x38, 0x28, 0x39, 0x4D, 0x61, 0xE8, 0x30, 0x6A, 0x49, 0x8A, 0x49, 0x08, 0x39, 0x8E, 0x69, 0xE9, 0x38, 0xE8, 0x30, 0x86, 0x20, 0xCA, 0x40, 0xEA, 0x38, 0x87, 0x20, 0x87, 0x20, 0xA7, 0x20, 0x8A, 0x38, 0x66, 0x20, 0xA6, 0x20, 0x66, 0x18, 0xEA, 0x38, 0xAA, 0x38, 0xA7, 0x20, 0x66, 0x18, 0x87, 0x20, 0xA7, 0x20, 0xCB, 0x38, 0x86, 0x18,
+    0x30, 0x9D, 0xEF, 0x9C, 0xCE, 0x94, 0x10, 0xA5, 0x12, 0xD6, 0xB0, 0xB5, 0x91, 0xB5, 0xF2, 0xC5, 0x2F, 0xAD, 0xFC, 0xFF, 0x4F, 0xAD, 0x4D, 0x94, 0x4D, 0x94, 0xEC, 0x8B, 0xFA, 0xFF, 0x0D, 0x8C, 0xAB, 0x7B, 0x4B, 0x7B, 0x8C, 0x83, 0x14, 0xE6, 0x0A, 0x73, 0xEA, 0x6A, 0xCA, 0x6A, 0x0F, 0x9C, 0x50, 0xBC, 0x69, 0x62, 0x29, 0x5A, 0x6E, 0x8B, 0x49, 0x5A, 0x6E, 0xA3, 0x49, 0x62, 0xEC, 0x72,
+    0xC8, 0x51, 0xE9, 0x59, 0x2F, 0x9B, 0xC8, 0x59, 0xA8, 0x51, 0x47, 0x41, 0x67, 0x41, 0x4D, 0x82, 0xAA, 0x61, 0x28, 0x41, 0x48, 0x41, 0xC8, 0x51, 0xAC, 0x71, 0x07, 0x39, 0xE7, 0x30, 0x69, 0x49, 0x49, 0x49, 0xCC, 0x69, 0x49, 0x41, 0xE7, 0x30, 0x0A, 0x41, 0xC7, 0x30, 0x8B, 0x59, 0xE8, 0x38, 0xE7, 0x30, 0x6A, 0x41, 0xE8, 0x30, 0x8C, 0x51, 0xE9, 0x30, 0xE8, 0x30, 0xA7, 0x28, 0xA7, 0x20,
+    0x4D, 0x51, 0x2C, 0x41, 0x87, 0x20, 0x86, 0x20, 0x29, 0x31, 0xEB, 0x40, 0x87, 0x20, 0xC7, 0x28, 0x67, 0x18, 0x0F, 0x5A, 0x67, 0x20, 0xA7, 0x28, 0x87, 0x20, 0xE7, 0x28, 0xA7, 0x20, 0x66, 0x18, 0x30, 0xA5, 0x8E, 0x94, 0x2D, 0x8C, 0xF3, 0xCD, 0x10, 0xA5, 0x6E, 0x94, 0x6E, 0x94, 0x10, 0xA5, 0xD2, 0xCD, 0x91, 0xB5, 0xAD, 0x94, 0xEC, 0x83, 0xEC, 0x83, 0xFC, 0xFF, 0x6A, 0x7B, 0x6B, 0x7B,
+    0x6B, 0x7B, 0x6B, 0x7B, 0xFE, 0xFF, 0x0A, 0x73, 0xEA, 0x6A, 0xA9, 0x62, 0x90, 0xA4, 0x89, 0x6A, 0x8E, 0x93, 0x28, 0x5A, 0x09, 0x5A, 0x49, 0x5A, 0x29, 0x5A, 0xC8, 0x59, 0x08, 0x5A, 0x4E, 0x8B, 0xA7, 0x49, 0x46, 0x41, 0xCF, 0x9A, 0xC8, 0x61, 0xA8, 0x51, 0x67, 0x41, 0x87, 0x49, 0xEB, 0x71, 0x28, 0x41, 0x07, 0x39, 0x07, 0x39, 0x88, 0x49, 0xCC, 0x69, 0x07, 0x41, 0xE7, 0x38, 0x29, 0x41,
+    0x28, 0x41, 0x08, 0x39, 0xA7, 0x30, 0x49, 0x41, 0xA6, 0x30, 0x2B, 0x49, 0xE7, 0x30, 0x2B, 0x59, 0xC7, 0x30, 0x6B, 0x51, 0x29, 0x39, 0xC8, 0x28, 0x0A, 0x49, 0x0A, 0x39, 0x4B, 0x41, 0xE8, 0x28, 0xA7, 0x20, 0xC8, 0x28, 0xEC, 0x38, 0xC7, 0x20, 0xC7, 0x20, 0xC8, 0x28, 0xCC, 0x40, 0x87, 0x28, 0x86, 0x20, 0x86, 0x20, 0xA7, 0x28, 0xA9, 0x28, 0x86, 0x20, 0xE7, 0x28, 0x86, 0x18, 0x86, 0x18,
+    0x8E, 0x8C, 0x4E, 0x8C, 0x74, 0xE6, 0x6E, 0x94, 0x0D, 0x8C, 0x0C, 0x84, 0xCC, 0x83, 0xD3, 0xD5, 0xD4, 0xC6, 0x0C, 0x84, 0xEC, 0x83, 0x8B, 0x7B, 0xFA, 0xF7, 0x0C, 0x8C, 0x4B, 0x73, 0x4B, 0x73, 0x6B, 0x7B, 0x94, 0xD6, 0xD1, 0xBC, 0xEA, 0x6A, 0xCA, 0x6A, 0xB3, 0xBD, 0xEA, 0x72, 0x91, 0xD4, 0xCA, 0x6A, 0x28, 0x5A, 0x2F, 0x9C, 0x33, 0xB5, 0x4A, 0x62, 0x09, 0x5A, 0x49, 0x62, 0xE8, 0x59,
+    0x29, 0x5A, 0xA8, 0x49, 0x50, 0xAB, 0x0A, 0x62, 0xC9, 0x51, 0x47, 0x41, 0x67, 0x41, 0x2D, 0x82, 0xE7, 0x38, 0x07, 0x39, 0x07, 0x39, 0x47, 0x41, 0xED, 0x71, 0x07, 0x39, 0xE7, 0x30, 0x28, 0x41, 0x08, 0x39, 0xE8, 0x38, 0x29, 0x49, 0xE7, 0x38, 0xC6, 0x28, 0xAB, 0x59, 0xC7, 0x30, 0xAE, 0x71, 0xE7, 0x28, 0x49, 0x39, 0xE9, 0x38, 0x2B, 0x41, 0xC8, 0x30, 0xA7, 0x28, 0x2B, 0x49, 0xE9, 0x38,
+    0xA7, 0x20, 0xA7, 0x20, 0xEC, 0x48, 0xA8, 0x28, 0x86, 0x20, 0xA7, 0x20, 0xA7, 0x20, 0x0C, 0x51, 0x67, 0x20, 0x86, 0x20, 0x66, 0x18, 0xC7, 0x20, 0x0A, 0x39, 0xCA, 0x38, 0xA6, 0x20, 0x86, 0x18, 0x11, 0xBD, 0x2D, 0x8C, 0xED, 0x83, 0x0D, 0x84, 0xCC, 0x7B, 0x0D, 0x94, 0x32, 0xC5, 0x30, 0xA5, 0x6B, 0x73, 0x8B, 0x7B, 0x6B, 0x7B, 0xB0, 0xBC, 0x6A, 0x83, 0x0A, 0x6B, 0xEA, 0x62, 0xEA, 0x62,
+    0x27, 0x52, 0xD2, 0xD4, 0x0B, 0x73, 0xCA, 0x62, 0x88, 0x62, 0xA9, 0x62, 0x91, 0xBC, 0x69, 0x6A, 0xEB, 0x72, 0x49, 0x5A, 0x08, 0x52, 0x09, 0x52, 0x0E, 0xA3, 0xE8, 0x51, 0x29, 0x5A, 0x4A, 0x62, 0x87, 0x49, 0xA8, 0x59, 0x6C, 0x72, 0x87, 0x49, 0x67, 0x41, 0x47, 0x39, 0x67, 0x41, 0x2D, 0x7A, 0x07, 0x41, 0x27, 0x39, 0x07, 0x39, 0xA8, 0x49, 0x8B, 0x61, 0x0C, 0x72, 0xC7, 0x30, 0x28, 0x41,
+    0x49, 0x49, 0xC7, 0x30, 0xCC, 0x71, 0x87, 0x30, 0xE8, 0x38, 0xE8, 0x30, 0xA6, 0x28, 0xA7, 0x30, 0x8D, 0x71, 0xEC, 0x59, 0xC8, 0x30, 0xA7, 0x28, 0xE8, 0x30, 0x2A, 0x49, 0xA8, 0x28, 0xE8, 0x30, 0xCB, 0x38, 0x86, 0x20, 0xA6, 0x20, 0x0A, 0x49, 0xA8, 0x28, 0xC7, 0x28, 0xA6, 0x20, 0x86, 0x20, 0xAA, 0x30, 0xEC, 0x48, 0xA6, 0x20, 0x65, 0x18, 0x86, 0x20, 0x86, 0x20, 0x86, 0x20, 0x88, 0x28,
+    0xF2, 0xBD, 0x0D, 0x84, 0xAC, 0x7B, 0xAC, 0x7B, 0x8C, 0x7B, 0x8B, 0x73, 0x75, 0xCE, 0x2A, 0x6B, 0x2A, 0x6B, 0x6B, 0x73, 0x2A, 0x73, 0xE9, 0x62, 0xCA, 0x62, 0xCA, 0x62, 0xAA, 0x62, 0xF4, 0xC5, 0x89, 0x5A, 0x89, 0x5A, 0xAA, 0x62, 0xCA, 0x6A, 0x16, 0xEF, 0x8A, 0x62, 0x49, 0x5A, 0xEC, 0x72, 0x69, 0x5A, 0xB1, 0xAC, 0x08, 0x52, 0x8A, 0x6A, 0xE8, 0x59, 0xC8, 0x51, 0xC8, 0x51, 0x2A, 0x62,
+    0xE8, 0x51, 0x67, 0x41, 0xA8, 0x49, 0xA8, 0x51, 0x87, 0x41, 0x47, 0x41, 0x67, 0x41, 0xCA, 0x61, 0x89, 0x51, 0x27, 0x39, 0x07, 0x39, 0x67, 0x41, 0x4A, 0x51, 0xA6, 0x30, 0xE7, 0x40, 0xC7, 0x30, 0x28, 0x41, 0xCC, 0x61, 0xC8, 0x40, 0x08, 0x39, 0xC8, 0x30, 0x29, 0x39, 0x4C, 0x51, 0x86, 0x20, 0xAC, 0x61, 0xC7, 0x28, 0xE7, 0x28, 0x6B, 0x59, 0xC8, 0x28, 0xE8, 0x30, 0x86, 0x20, 0x6A, 0x41,
+    0x87, 0x20, 0xC9, 0x30, 0xA7, 0x28, 0x08, 0x31, 0x0B, 0x49, 0xE9, 0x30, 0x87, 0x20, 0x86, 0x20, 0xA7, 0x28, 0xEA, 0x38, 0xE7, 0x28, 0xA6, 0x20, 0x85, 0x18, 0xA7, 0x20, 0xC9, 0x30, 0xEA, 0x38, 0x2D, 0x8C, 0x0D, 0x84, 0xAC, 0x7B, 0xAC, 0x7B, 0xF5, 0xEE, 0xEF, 0xAC, 0x0A, 0x6B, 0x0A, 0x6B, 0x2A, 0x73, 0xFB, 0xFF, 0x54, 0xD6, 0xEA, 0x62, 0x0B, 0x6B, 0x4E, 0x94, 0x77, 0xF7, 0xAC, 0x83,
+    0xCD, 0x83, 0x0B, 0x6B, 0xCA, 0x6A, 0x34, 0xDE, 0xED, 0x8B, 0xA9, 0x62, 0xAD, 0x83, 0x49, 0x5A, 0xEE, 0x93, 0x8D, 0x83, 0xC8, 0x49, 0x09, 0x52, 0x6A, 0x62, 0xD0, 0xA3, 0xC8, 0x51, 0xE9, 0x59, 0x87, 0x41, 0xC8, 0x51, 0xCD, 0x82, 0x67, 0x41, 0x87, 0x41, 0x27, 0x39, 0x88, 0x49, 0xEB, 0x69, 0x28, 0x41, 0x07, 0x39, 0x07, 0x39, 0x88, 0x49, 0x6F, 0x9A, 0x07, 0x41, 0xE6, 0x30, 0xE7, 0x30,
+    0x28, 0x39, 0xC7, 0x30, 0xC7, 0x30, 0xE7, 0x30, 0xC7, 0x28, 0xC8, 0x30, 0x87, 0x30, 0xA6, 0x28, 0xA6, 0x28, 0x4B, 0x49, 0xA6, 0x28, 0xE8, 0x30, 0xC7, 0x28, 0xA7, 0x28, 0x08, 0x31, 0xC6, 0x28, 0xEA, 0x38, 0x86, 0x20, 0xA7, 0x20, 0x86, 0x18, 0xA7, 0x20, 0x28, 0x31, 0x86, 0x20, 0x86, 0x20, 0x66, 0x18, 0x86, 0x18, 0x86, 0x18, 0xA7, 0x20, 0xC6, 0x20, 0x86, 0x20, 0xA6, 0x20, 0xA6, 0x20,
+    0xCC, 0x7B, 0x8B, 0x7B, 0x6B, 0x73, 0x2A, 0x6B, 0x4B, 0x73, 0x2A, 0x6B, 0x0A, 0x63, 0xE9, 0x62, 0x6B, 0x7B, 0x0A, 0x6B, 0xEA, 0x62, 0xEB, 0x62, 0xCA, 0x62, 0xCA, 0x62, 0xCA, 0x62, 0x69, 0x52, 0x68, 0x52, 0x49, 0x52, 0x69, 0x5A, 0x89, 0x5A, 0x69, 0x5A, 0x49, 0x52, 0x08, 0x52, 0x69, 0x5A, 0x49, 0x5A, 0x29, 0x52, 0xE8, 0x51, 0x08, 0x52, 0xA8, 0x49, 0x29, 0x5A, 0xA8, 0x49, 0xC8, 0x51,
+    0x67, 0x41, 0x67, 0x41, 0xA9, 0x59, 0x2A, 0x5A, 0x47, 0x41, 0x47, 0x39, 0x47, 0x41, 0x89, 0x51, 0x28, 0x39, 0x07, 0x39, 0xE7, 0x38, 0x68, 0x41, 0x08, 0x41, 0x07, 0x39, 0xE7, 0x30, 0x08, 0x39, 0x07, 0x39, 0xE7, 0x30, 0x28, 0x39, 0x48, 0x39, 0xC6, 0x28, 0xA7, 0x28, 0xC7, 0x28, 0x29, 0x41, 0xA6, 0x28, 0x86, 0x28, 0xC7, 0x28, 0xC7, 0x28, 0xC7, 0x30, 0xA7, 0x20, 0xE8, 0x30, 0xA6, 0x28,
+    0xA7, 0x20, 0x6C, 0x51, 0x2B, 0x41, 0x65, 0x18, 0xA6, 0x20, 0x66, 0x18, 0xEB, 0x40, 0x86, 0x20, 0x86, 0x20, 0x86, 0x18, 0x66, 0x18, 0xEB, 0x40, 0x86, 0x18, 0x86, 0x20, 0xE7, 0x28, 0x28, 0x31, 0x8B, 0x73, 0x6B, 0x73, 0xB1, 0xC5, 0xEB, 0x6A, 0xEA, 0x62, 0x0A, 0x6B, 0xCA, 0x62, 0x74, 0xE6, 0xA8, 0x5A, 0xAA, 0x5A, 0xAA, 0x62, 0x8A, 0x5A, 0xAC, 0x83, 0x30, 0xB5, 0xA9, 0x62, 0x48, 0x52,
+    0x0B, 0x6B, 0x69, 0x52, 0xF1, 0xBC, 0x49, 0x52, 0x08, 0x4A, 0x8D, 0x83, 0x28, 0x52, 0x2F, 0xA4, 0x49, 0x52, 0xE8, 0x49, 0x4D, 0x83, 0xA7, 0x49, 0xE8, 0x59, 0x2D, 0x83, 0x4A, 0x62, 0xA8, 0x49, 0x87, 0x41, 0x67, 0x49, 0xAD, 0x82, 0xC8, 0x51, 0x47, 0x39, 0xC9, 0x59, 0x47, 0x41, 0x4D, 0x7A, 0x27, 0x41, 0x07, 0x39, 0xE7, 0x30, 0xE6, 0x30, 0xEC, 0x61, 0xE8, 0x40, 0x27, 0x39, 0xE7, 0x30,
+    0x07, 0x31, 0x4A, 0x51, 0xAB, 0x61, 0xC7, 0x30, 0xC7, 0x28, 0x8B, 0x51, 0xA7, 0x28, 0x6B, 0x59, 0xA7, 0x28, 0xA7, 0x28, 0x2C, 0x49, 0xA9, 0x41, 0xE7, 0x30, 0x87, 0x20, 0xC7, 0x28, 0xA7, 0x28, 0xA7, 0x28, 0xA7, 0x20, 0xE9, 0x38, 0xC8, 0x30, 0xEB, 0x49, 0x86, 0x20, 0xA6, 0x20, 0x87, 0x20, 0xA8, 0x28, 0x86, 0x20, 0x86, 0x20, 0xE7, 0x30, 0x09, 0x31, 0xE9, 0x30, 0xCB, 0x41, 0x68, 0x39,
+    0x6E, 0x94, 0x2A, 0x6B, 0x0A, 0x6B, 0xEA, 0x62, 0xCA, 0x62, 0x6A, 0x73, 0xD4, 0xCE, 0x92, 0xB5, 0xEA, 0x62, 0x68, 0x52, 0x89, 0x5A, 0x32, 0xAD, 0x8C, 0x7B, 0x68, 0x5A, 0x07, 0x4A, 0x08, 0x4A, 0x27, 0x52, 0xE9, 0x6A, 0x49, 0x5A, 0x49, 0x52, 0x8D, 0x7B, 0x49, 0x5A, 0x49, 0x52, 0x29, 0x52, 0x28, 0x52, 0xEF, 0x93, 0xA7, 0x41, 0xA7, 0x41, 0xA8, 0x49, 0xA8, 0x49, 0xA7, 0x49, 0xE9, 0x51,
+    0x67, 0x39, 0x67, 0x41, 0x68, 0x41, 0x47, 0x39, 0x47, 0x41, 0x27, 0x39, 0x27, 0x39, 0xE6, 0x40, 0x27, 0x39, 0xE7, 0x30, 0x07, 0x39, 0x47, 0x39, 0xE7, 0x30, 0x08, 0x39, 0x07, 0x31, 0xA6, 0x28, 0xE7, 0x30, 0xC7, 0x30, 0xE7, 0x30, 0x28, 0x39, 0xC7, 0x28, 0xC7, 0x30, 0xC7, 0x28, 0xC7, 0x28, 0xA6, 0x28, 0xA7, 0x28, 0xA7, 0x28, 0x28, 0x31, 0xC7, 0x30, 0x86, 0x20, 0xA6, 0x20, 0xA6, 0x20,
+    0xA6, 0x20, 0x86, 0x20, 0xC6, 0x28, 0xC7, 0x28, 0xA6, 0x20, 0x66, 0x18, 0xA7, 0x20, 0x65, 0x18, 0x2B, 0x41, 0x86, 0x18, 0x86, 0x20, 0x86, 0x20, 0x89, 0x39, 0x09, 0x39, 0xA6, 0x20, 0x86, 0x18, 0x30, 0xC5, 0x0A, 0x6B, 0xEB, 0x62, 0xCA, 0x62, 0xEA, 0x62, 0xD2, 0xD5, 0x8F, 0x9C, 0x89, 0x5A, 0x69, 0x5A, 0x69, 0x52, 0x0A, 0x6B, 0xF0, 0xBC, 0x48, 0x52, 0x49, 0x52, 0x49, 0x52, 0x14, 0xC6,
+    0xAC, 0x83, 0xAF, 0xAC, 0x28, 0x52, 0x08, 0x4A, 0x52, 0xAD, 0xAB, 0x62, 0x2F, 0xAC, 0x4A, 0x5A, 0xE8, 0x49, 0x0F, 0x94, 0xC8, 0x49, 0xA8, 0x41, 0x6E, 0x93, 0x87, 0x41, 0xAC, 0x6A, 0x88, 0x41, 0x47, 0x39, 0x47, 0x49, 0x2A, 0x62, 0x26, 0x39, 0x27, 0x39, 0x27, 0x39, 0x06, 0x39, 0x6C, 0x7A, 0x28, 0x39, 0xE6, 0x30, 0x07, 0x39, 0x07, 0x39, 0xE7, 0x30, 0x0C, 0x6A, 0xE6, 0x30, 0xE7, 0x38,
+    0xE7, 0x30, 0x28, 0x39, 0xEC, 0x69, 0x49, 0x41, 0xA7, 0x28, 0xC6, 0x28, 0x6B, 0x59, 0xA7, 0x28, 0xAD, 0x69, 0xC7, 0x28, 0x86, 0x28, 0x4A, 0x49, 0xE7, 0x30, 0x86, 0x20, 0x4A, 0x49, 0xA7, 0x28, 0x66, 0x20, 0x86, 0x20, 0x27, 0x31, 0xA8, 0x30, 0xE9, 0x38, 0xA7, 0x20, 0x28, 0x31, 0x07, 0x29, 0xC7, 0x28, 0x0A, 0x39, 0xA7, 0x20, 0x66, 0x18, 0x86, 0x20, 0xC7, 0x20, 0xEA, 0x38, 0xEB, 0x40,
+    0x0A, 0x63, 0xCA, 0x5A, 0xCA, 0x62, 0x69, 0x5A, 0x91, 0xB5, 0xEA, 0x62, 0xEA, 0x62, 0x89, 0x5A, 0x0B, 0x73, 0xD5, 0xDE, 0x48, 0x52, 0x89, 0x62, 0x89, 0x5A, 0xA9, 0x5A, 0x0A, 0x73, 0x08, 0x4A, 0x08, 0x52, 0x08, 0x52, 0x89, 0x5A, 0x31, 0xBD, 0x08, 0x4A, 0xE8, 0x49, 0x08, 0x52, 0x28, 0x5A, 0x71, 0xA4, 0xC7, 0x41, 0xA7, 0x41, 0x87, 0x41, 0xC8, 0x51, 0x6B, 0x72, 0x67, 0x39, 0x67, 0x41,
+    0x88, 0x49, 0x47, 0x39, 0x26, 0x39, 0x47, 0x39, 0x47, 0x41, 0x27, 0x39, 0x27, 0x39, 0x28, 0x41, 0x07, 0x39, 0xE6, 0x30, 0x07, 0x39, 0xE7, 0x30, 0xE7, 0x30, 0xE7, 0x30, 0x07, 0x31, 0xC7, 0x30, 0xE7, 0x30, 0xE7, 0x30, 0xC7, 0x30, 0x08, 0x39, 0xC7, 0x30, 0xC7, 0x28, 0xC7, 0x30, 0xE8, 0x30, 0xAC, 0x59, 0xC7, 0x28, 0x86, 0x20, 0xC8, 0x30, 0xE7, 0x28, 0xC7, 0x28, 0x09, 0x39, 0xC7, 0x28,
+    0xA7, 0x20, 0xA7, 0x20, 0xE7, 0x30, 0x66, 0x18, 0x6C, 0x61, 0x86, 0x20, 0xA7, 0x20, 0xE7, 0x28, 0x86, 0x18, 0x86, 0x18, 0x2A, 0x39, 0x86, 0x18, 0x86, 0x20, 0x86, 0x20, 0x85, 0x18, 0xA6, 0x20, 0xCA, 0x62, 0xCA, 0x5A, 0xCA, 0x62, 0xAA, 0x5A, 0x69, 0x52, 0x69, 0x52, 0x8A, 0x5A, 0x29, 0x52, 0x49, 0x52, 0x68, 0x52, 0x29, 0x52, 0xE8, 0x49, 0x08, 0x4A, 0x28, 0x52, 0x48, 0x5A, 0x08, 0x4A,
+    0x07, 0x4A, 0xE7, 0x49, 0xE8, 0x49, 0x70, 0x9C, 0xAA, 0x72, 0x08, 0x4A, 0xE8, 0x49, 0xC8, 0x41, 0x50, 0xA4, 0xA7, 0x41, 0x87, 0x41, 0xA7, 0x41, 0xA7, 0x41, 0xCC, 0x82, 0x67, 0x41, 0x67, 0x39, 0x67, 0x39, 0x46, 0x39, 0x8C, 0x7A, 0x47, 0x39, 0x27, 0x39, 0x07, 0x39, 0x27, 0x41, 0xEB, 0x59, 0x28, 0x39, 0x07, 0x39, 0xE7, 0x38, 0xC5, 0x30, 0xE7, 0x38, 0xC6, 0x30, 0x27, 0x39, 0xE7, 0x30,
+    0xC7, 0x30, 0xC6, 0x28, 0xAB, 0x51, 0xE7, 0x30, 0xC7, 0x28, 0xC8, 0x30, 0xC7, 0x30, 0x09, 0x49, 0xC7, 0x28, 0xC7, 0x28, 0xC7, 0x28, 0x86, 0x20, 0x29, 0x41, 0xC7, 0x28, 0x66, 0x20, 0x66, 0x20, 0x86, 0x20, 0xEA, 0x40, 0xE6, 0x28, 0x86, 0x20, 0x86, 0x20, 0x85, 0x18, 0x0A, 0x39, 0x86, 0x20, 0x86, 0x20, 0x86, 0x18, 0x86, 0x18, 0xCA, 0x38, 0xA6, 0x20, 0x66, 0x18, 0x65, 0x18, 0x85, 0x18,
+    0xEB, 0x62, 0x27, 0x4A, 0xFA, 0xFF, 0xB2, 0xBD, 0x89, 0x5A, 0xCB, 0x6A, 0x08, 0x52, 0xE7, 0x41, 0x86, 0x39, 0x08, 0x4A, 0xE8, 0x49, 0xC7, 0x41, 0x29, 0x52, 0x48, 0x52, 0x28, 0x4A, 0xE7, 0x41, 0x28, 0x4A, 0x08, 0x4A, 0xC8, 0x6A, 0x49, 0x52, 0xE8, 0x41, 0xE8, 0x49, 0xC6, 0x49, 0xAD, 0x8B, 0xC7, 0x49, 0xC7, 0x41, 0x86, 0x41, 0xA7, 0x41, 0xA7, 0x41, 0xA8, 0x41, 0x47, 0x39, 0x67, 0x39,
+    0x87, 0x41, 0x46, 0x39, 0x47, 0x41, 0x26, 0x31, 0x47, 0x39, 0x06, 0x31, 0x06, 0x31, 0xE6, 0x30, 0x27, 0x39, 0x28, 0x39, 0xE7, 0x30, 0x27, 0x41, 0x07, 0x31, 0xC7, 0x30, 0x28, 0x39, 0xE8, 0x38, 0xC7, 0x30, 0xC7, 0x28, 0xA7, 0x28, 0xC7, 0x30, 0xA7, 0x28, 0xA7, 0x28, 0xC6, 0x30, 0xC7, 0x28, 0xC7, 0x30, 0xC7, 0x28, 0xC7, 0x28, 0xC7, 0x28, 0x86, 0x20, 0xA6, 0x28, 0x86, 0x20, 0x86, 0x20,
+    0xA7, 0x28, 0x86, 0x20, 0xE7, 0x30, 0x86, 0x20, 0x87, 0x20, 0xA6, 0x20, 0x65, 0x18, 0x65, 0x18, 0x86, 0x20, 0x86, 0x20, 0x86, 0x18, 0x66, 0x18, 0x65, 0x18, 0x86, 0x18, 0x86, 0x20, 0x85, 0x18, 0x0B, 0x6B, 0xCA, 0x62, 0xE9, 0x62, 0x89, 0x5A, 0x2C, 0x6B, 0x69, 0x52, 0x49, 0x52, 0xAE, 0xA4, 0x08, 0x4A, 0xE8, 0x49, 0x08, 0x4A, 0xE8, 0x49, 0x71, 0xBD, 0xE8, 0x49, 0x08, 0x4A, 0xE8, 0x41,
+    0xE8, 0x41, 0xC7, 0x41, 0xA6, 0x41, 0xC7, 0x49, 0xA7, 0x41, 0xC7, 0x41, 0xA7, 0x41, 0x0E, 0x9C, 0xA7, 0x41, 0x87, 0x39, 0x87, 0x41, 0xC8, 0x49, 0xAB, 0x6A, 0x87, 0x41, 0x47, 0x39, 0x88, 0x41, 0x47, 0x39, 0x47, 0x39, 0xCC, 0x7A, 0x47, 0x39, 0x27, 0x39, 0x06, 0x31, 0x27, 0x39, 0x0B, 0x62, 0x07, 0x39, 0xE6, 0x30, 0x07, 0x31, 0x0B, 0x6A, 0x07, 0x39, 0xE7, 0x38, 0xE7, 0x30, 0xE7, 0x38,
+    0xE8, 0x30, 0xE7, 0x30, 0x6A, 0x51, 0xE7, 0x30, 0xE8, 0x30, 0xA7, 0x28, 0xC7, 0x28, 0x6A, 0x51, 0xA7, 0x28, 0xC7, 0x28, 0x87, 0x20, 0xA6, 0x28, 0x87, 0x28, 0x2A, 0x41, 0xA7, 0x28, 0xC6, 0x28, 0xA7, 0x20, 0xE8, 0x30, 0x69, 0x41, 0x86, 0x20, 0x66, 0x18, 0x07, 0x31, 0x86, 0x20, 0x86, 0x18, 0xE8, 0x30, 0x66, 0x18, 0x86, 0x20, 0x66, 0x18, 0x86, 0x18, 0xE9, 0x30, 0xA6, 0x20, 0x65, 0x18,
+    0x6E, 0x9C, 0x69, 0x52, 0x69, 0x52, 0x4C, 0x6B, 0x49, 0x52, 0x49, 0x52, 0x28, 0x52, 0x28, 0x52, 0x08, 0x4A, 0xE8, 0x49, 0x28, 0x52, 0xE7, 0x49, 0xE7, 0x41, 0x08, 0x4A, 0xC8, 0x41, 0xC7, 0x41, 0xE7, 0x41, 0xC7, 0x41, 0xA7, 0x41, 0x87, 0x39, 0xC7, 0x41, 0xA7, 0x41, 0xA7, 0x41, 0xA7, 0x41, 0xA7, 0x41, 0x87, 0x39, 0x87, 0x39, 0x46, 0x39, 0x4A, 0x62, 0x47, 0x39, 0x47, 0x39, 0x47, 0x31,
+    0x87, 0x41, 0x47, 0x39, 0x06, 0x31, 0x27, 0x39, 0x27, 0x39, 0x06, 0x31, 0x27, 0x39, 0x07, 0x39, 0x07, 0x39, 0xE7, 0x30, 0xE7, 0x30, 0xA9, 0x51, 0x08, 0x39, 0x08, 0x39, 0x07, 0x39, 0xC7, 0x30, 0xC7, 0x30, 0xC7, 0x30, 0xE8, 0x30, 0xA7, 0x28, 0xC7, 0x28, 0xA7, 0x28, 0xA7, 0x28, 0xA7, 0x28, 0xA7, 0x28, 0xA7, 0x28, 0x86, 0x20, 0xA7, 0x28, 0x66, 0x20, 0x86, 0x20, 0xA7, 0x28, 0x48, 0x39,
+    0x86, 0x20, 0x86, 0x20, 0xA6, 0x20, 0x86, 0x20, 0x86, 0x20, 0x08, 0x31, 0x86, 0x20, 0x65, 0x18, 0x45, 0x18, 0x86, 0x18, 0xA6, 0x20, 0x86, 0x18, 0x86, 0x20, 0x85, 0x18, 0x66, 0x18, 0x65, 0x18, 0x2D, 0x94, 0x89, 0x5A, 0x6D, 0x73, 0x69, 0x52, 0x49, 0x52, 0x4E, 0x9C, 0x28, 0x4A, 0xE8, 0x49, 0x08, 0x4A, 0x08, 0x4A, 0xE8, 0x41, 0xEE, 0x93, 0x08, 0x4A, 0x48, 0x4A, 0xC7, 0x41, 0xE8, 0x41,
+    0xEE, 0x9B, 0xC7, 0x41, 0xE8, 0x41, 0xA7, 0x41, 0x87, 0x41, 0xA7, 0x41, 0x4D, 0x8B, 0xA7, 0x41, 0x87, 0x41, 0x87, 0x39, 0x87, 0x41, 0xB4, 0x29, 0xAD, 0x7A, 0x46, 0x39, 0x47, 0x39, 0xA8, 0x41, 0x47, 0x39, 0x27, 0x39, 0x09, 0x5A, 0x47, 0x39, 0x27, 0x39, 0x06, 0x39, 0x06, 0x39, 0x2C, 0x6A, 0x07, 0x39, 0xE7, 0x30, 0xE7, 0x30, 0xE7, 0x30, 0xE7, 0x38, 0xCB, 0x61, 0xE7, 0x30, 0xE8, 0x40,
+    0xC7, 0x30, 0xA6, 0x28, 0xAB, 0x59, 0x4A, 0x49, 0xA7, 0x28, 0xA8, 0x30, 0x86, 0x28, 0xA7, 0x28, 0x6B, 0x59, 0xC7, 0x28, 0xA8, 0x28, 0xA8, 0x28, 0x89, 0x41, 0x86, 0x20, 0x2B, 0x51, 0xE8, 0x30, 0x86, 0x20, 0xA7, 0x20, 0x86, 0x20, 0xA7, 0x20, 0xE8, 0x38, 0xCA, 0x49, 0x86, 0x20, 0xA7, 0x20, 0x86, 0x20, 0x87, 0x20, 0x87, 0x20, 0x45, 0x18, 0x86, 0x18, 0x86, 0x20, 0x45, 0x18, 0xE9, 0x30,
 };
 const lv_img_dsc_t ui_img_accelerometer_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_accelerometer_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_accelerometer_80_png_data
 };
 
@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Arrows_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_arrows_80_png_data[] = {
-    0x84, 0x28, 0xFF, 0x88, 0x51, 0xFF, 0xA6, 0x30, 0xFF, 0xA6, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0xA8, 0x38, 0xFF, 0xC8, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0x07, 0x41, 0xFF, 0xE7, 0x40, 0xFF, 0xE7, 0x38, 0xFF, 0xCB, 0x69, 0xFF, 0xC8, 0x38, 0xFF, 0xE9, 0x38, 0xFF, 0xC8, 0x40, 0xFF, 0xC7, 0x38, 0xFF, 0xE9, 0x40, 0xFF, 0x29, 0x49, 0xFF, 0xE9, 0x40, 0xFF, 0xE9, 0x48, 0xFF, 0xE9, 0x40, 0xFF, 0x0A, 0x49, 0xFF, 0x2A, 0x51, 0xFF, 0x09, 0x49, 0xFF, 0x29, 0x51, 0xFF, 0x29, 0x49, 0xFF, 0x29, 0x49, 0xFF, 0x69, 0x59, 0xFF, 0x28, 0x51, 0xFF, 0x68, 0x59, 0xFF, 0xC8, 0x61, 0xFF, 0x88, 0x51, 0xFF, 0x88, 0x51, 0xFF, 0xA6, 0x59, 0xFF, 0x28, 0x6A, 0xFF, 0xE7, 0x61, 0xFF, 0xC7, 0x59, 0xFF, 0x07, 0x62, 0xFF, 0x88, 0x6A, 0xFF, 0x67, 0x6A, 0xFF, 0x47, 0x6A, 0xFF, 0xE8, 0x7A, 0xFF, 0xC7, 0x6A, 0xFF, 0xA6, 0x72, 0xFF, 0x86, 0x6A, 0xFF, 0x06, 0x6B, 0xFF, 0xE6, 0x72, 0xFF, 0xC7, 0x72, 0xFF, 0x86, 0x6A, 0xFF, 0xC6, 0x72, 0xFF, 0xA6, 0x72, 0xFF, 0x86, 0x72, 0xFF, 0x46, 0x6A, 0xFF, 0x46, 0x6A, 0xFF, 0x04, 0x6A, 0xFF, 0x26, 0x6A, 0xFF, 0x06, 0x6A, 0xFF, 0x05, 0x72, 0xFF, 0xC5, 0x61, 0xFF, 0xC5, 0x61, 0xFF,
-    0xC5, 0x69, 0xFF, 0xC5, 0x61, 0xFF, 0xE6, 0x69, 0xFF, 0xE7, 0x69, 0xFF, 0xA6, 0x61, 0xFF, 0xA6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xE6, 0x69, 0xFF, 0x48, 0x7A, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xE6, 0x71, 0xFF, 0xE7, 0x71, 0xFF, 0x06, 0x72, 0xFF, 0x26, 0x72, 0xFF, 0xA6, 0x30, 0xFF, 0xAB, 0x59, 0xFF, 0xC7, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0x69, 0x51, 0xFF, 0xC6, 0x38, 0xFF, 0xC8, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xC9, 0x61, 0xFF, 0xAE, 0x59, 0xFF, 0xC7, 0x38, 0xFF, 0x68, 0x49, 0xFF, 0xE8, 0x38, 0xFF, 0xCD, 0x69, 0xFF, 0xC7, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0xC9, 0x40, 0xFF, 0xE9, 0x40, 0xFF, 0x2D, 0x72, 0xFF, 0x09, 0x49, 0xFF, 0x0A, 0x49, 0xFF, 0x0A, 0x49, 0xFF, 0x09, 0x49, 0xFF, 0x09, 0x49, 0xFF, 0x0B, 0x72, 0xFF, 0x28, 0x51, 0xFF, 0x28, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x48, 0x51, 0xFF, 0x4C, 0x9B, 0xFF, 0xA7, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0xA7, 0x59, 0xFF, 0x6B, 0x9B, 0xFF, 0xE7, 0x61, 0xFF, 0xC6, 0x59, 0xFF, 0x07, 0x62, 0xFF, 0xC7, 0x7A, 0xFF, 0xCA, 0xAB, 0xFF, 0x47, 0x6A, 0xFF, 0x66, 0x6A, 0xFF, 0xFD, 0xFF, 0xFF, 0xC7, 0x72, 0xFF,
-    0xAB, 0xC4, 0xFF, 0xC6, 0x7A, 0xFF, 0x8F, 0xF7, 0xFF, 0x26, 0x83, 0xFF, 0xC6, 0x7A, 0xFF, 0x09, 0xA4, 0xFF, 0xF2, 0xFF, 0xFF, 0x69, 0xB4, 0xFF, 0x46, 0x72, 0xFF, 0x45, 0x6A, 0xFF, 0x86, 0x7A, 0xFF, 0x4A, 0xCC, 0xFF, 0x05, 0x7A, 0xFF, 0x25, 0x7A, 0xFF, 0x26, 0x72, 0xFF, 0x27, 0x82, 0xFF, 0x48, 0xCC, 0xFF, 0xC5, 0x69, 0xFF, 0xC5, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xCD, 0xE5, 0xFF, 0xC5, 0x69, 0xFF, 0xE6, 0x71, 0xFF, 0xE6, 0x71, 0xFF, 0xE6, 0x71, 0xFF, 0x6F, 0xFF, 0xFF, 0xC6, 0x69, 0xFF, 0x06, 0x72, 0xFF, 0xE6, 0x69, 0xFF, 0x06, 0x72, 0xFF, 0x47, 0x82, 0xFF, 0xC6, 0x30, 0xFF, 0x69, 0x49, 0xFF, 0x46, 0x28, 0xFF, 0x07, 0x41, 0xFF, 0xA6, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0x09, 0x41, 0xFF, 0xE8, 0x40, 0xFF, 0xC7, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0x07, 0x49, 0xFF, 0xE8, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0xC9, 0x40, 0xFF, 0xC7, 0x38, 0xFF, 0x09, 0x41, 0xFF, 0xC8, 0x40, 0xFF, 0xEA, 0x40, 0xFF, 0xC9, 0x40, 0xFF, 0xC9, 0x40, 0xFF, 0x0A, 0x49, 0xFF, 0xE9, 0x48, 0xFF, 0x0A, 0x49, 0xFF, 0x09, 0x49, 0xFF, 0x09, 0x49, 0xFF, 0x29, 0x51, 0xFF, 0x68, 0x51, 0xFF, 0x48, 0x51, 0xFF, 0x68, 0x59, 0xFF,
-    0x48, 0x51, 0xFF, 0x0F, 0xBC, 0xFF, 0xA7, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0xC7, 0x59, 0xFF, 0xE8, 0x69, 0xFF, 0xC6, 0x59, 0xFF, 0xC7, 0x61, 0xFF, 0x07, 0x62, 0xFF, 0x47, 0x6A, 0xFF, 0x87, 0x7A, 0xFF, 0x47, 0x6A, 0xFF, 0x66, 0x6A, 0xFF, 0xA6, 0x6A, 0xFF, 0x87, 0x72, 0xFF, 0xC7, 0x82, 0xFF, 0xE7, 0x7A, 0xFF, 0xE6, 0x7A, 0xFF, 0xC6, 0x7A, 0xFF, 0xA6, 0x7A, 0xFF, 0xA6, 0x7A, 0xFF, 0xA6, 0x72, 0xFF, 0x66, 0x7A, 0xFF, 0x46, 0x72, 0xFF, 0x46, 0x9B, 0xFF, 0x25, 0x72, 0xFF, 0x26, 0x6A, 0xFF, 0x25, 0x72, 0xFF, 0x06, 0x72, 0xFF, 0x06, 0x72, 0xFF, 0xE5, 0x69, 0xFF, 0xC5, 0x69, 0xFF, 0xE6, 0x69, 0xFF, 0xC5, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xE6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xE6, 0x71, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0x06, 0x72, 0xFF, 0x06, 0x72, 0xFF, 0x27, 0x7A, 0xFF, 0x46, 0x82, 0xFF, 0xA6, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0x6B, 0x51, 0xFF, 0xA7, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0x07, 0x41, 0xFF, 0x8D, 0x59, 0xFF, 0xE7, 0x40, 0xFF, 0xC7, 0x38, 0xFF,
-    0x2A, 0x49, 0xFF, 0x8C, 0x59, 0xFF, 0xAD, 0x61, 0xFF, 0xC8, 0x40, 0xFF, 0xE9, 0x40, 0xFF, 0xEA, 0x40, 0xFF, 0xCA, 0x40, 0xFF, 0x2D, 0x72, 0xFF, 0xAB, 0x59, 0xFF, 0xEA, 0x48, 0xFF, 0x29, 0x51, 0xFF, 0x2A, 0x51, 0xFF, 0x4C, 0x72, 0xFF, 0x28, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x68, 0x59, 0xFF, 0x68, 0x59, 0xFF, 0x8A, 0x82, 0xFF, 0x67, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x88, 0x59, 0xFF, 0xA7, 0x61, 0xFF, 0x6A, 0x93, 0xFF, 0x08, 0x62, 0xFF, 0xC7, 0x61, 0xFF, 0x07, 0x62, 0xFF, 0x6A, 0x84, 0xFF, 0x6B, 0xBC, 0xFF, 0x47, 0x6A, 0xFF, 0x67, 0x6A, 0xFF, 0x44, 0x6A, 0xFF, 0x87, 0x72, 0xFF, 0x6B, 0xCD, 0xFF, 0xA6, 0x72, 0xFF, 0xC5, 0x7A, 0xFF, 0xA6, 0x7A, 0xFF, 0xA6, 0x7A, 0xFF, 0x8C, 0xE5, 0xFF, 0x06, 0x8B, 0xFF, 0x66, 0x7A, 0xFF, 0x66, 0x7A, 0xFF, 0x46, 0x72, 0xFF, 0x0B, 0xD5, 0xFF, 0x26, 0x72, 0xFF, 0x25, 0x72, 0xFF, 0x05, 0x72, 0xFF, 0xE4, 0x71, 0xFF, 0x45, 0x82, 0xFF, 0xC5, 0x69, 0xFF, 0xE6, 0x69, 0xFF, 0xE6, 0x69, 0xFF, 0x88, 0xAB, 0xFF, 0xC6, 0x71, 0xFF, 0xE7, 0x71, 0xFF, 0xC6, 0x71, 0xFF, 0xC6, 0x71, 0xFF, 0x0A, 0xBC, 0xFF, 0xE6, 0x71, 0xFF, 0xE6, 0x71, 0xFF, 0xE6, 0x71, 0xFF, 0x06, 0x72, 0xFF, 0x06, 0x7A, 0xFF, 0xA8, 0x8A, 0xFF, 0x67, 0x82, 0xFF,
-    0xC7, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0x49, 0x51, 0xFF, 0xC7, 0x38, 0xFF, 0xC7, 0x30, 0xFF, 0x87, 0x30, 0xFF, 0x87, 0x30, 0xFF, 0xAD, 0x61, 0xFF, 0x07, 0x49, 0xFF, 0xE9, 0x40, 0xFF, 0xE7, 0x38, 0xFF, 0xE7, 0x38, 0xFF, 0x8A, 0x59, 0xFF, 0xCD, 0x71, 0xFF, 0xAD, 0x61, 0xFF, 0xEA, 0x48, 0xFF, 0xAA, 0x38, 0xFF, 0xA8, 0x40, 0xFF, 0x88, 0x40, 0xFF, 0x0A, 0x51, 0xFF, 0xEB, 0x48, 0xFF, 0x8B, 0x61, 0xFF, 0x0A, 0x49, 0xFF, 0x09, 0x49, 0xFF, 0x4D, 0x8A, 0xFF, 0x49, 0x51, 0xFF, 0x07, 0x49, 0xFF, 0x08, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x68, 0x59, 0xFF, 0x67, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0xA8, 0x61, 0xFF, 0xA8, 0x59, 0xFF, 0x44, 0x51, 0xFF, 0x6C, 0xAB, 0xFF, 0xE7, 0x61, 0xFF, 0xE7, 0x61, 0xFF, 0x07, 0x6A, 0xFF, 0x47, 0x72, 0xFF, 0xEB, 0xB3, 0xFF, 0x66, 0x72, 0xFF, 0x87, 0x72, 0xFF, 0xA7, 0x72, 0xFF, 0xC7, 0x7A, 0xFF, 0xC7, 0x7A, 0xFF, 0x6E, 0xFD, 0xFF, 0xE7, 0x82, 0xFF, 0xC6, 0x82, 0xFF, 0xA6, 0x82, 0xFF, 0xE7, 0x8A, 0xFF, 0xED, 0xDC, 0xFF, 0x66, 0x7A, 0xFF, 0x93, 0xF7, 0xFF, 0x45, 0x7A, 0xFF, 0x26, 0x7A, 0xFF, 0x46, 0x7A, 0xFF, 0xEC, 0xF4, 0xFF, 0x46, 0x7A, 0xFF, 0xE4, 0x71, 0xFF, 0x06, 0x72, 0xFF,
-    0xE6, 0x71, 0xFF, 0x0A, 0xDC, 0xFF, 0xE6, 0x79, 0xFF, 0x4D, 0xBC, 0xFF, 0xE6, 0x71, 0xFF, 0xE6, 0x79, 0xFF, 0x26, 0x7A, 0xFF, 0xCA, 0xDB, 0xFF, 0xE6, 0x71, 0xFF, 0x29, 0xA3, 0xFF, 0xE6, 0x71, 0xFF, 0xE6, 0x71, 0xFF, 0x88, 0xCB, 0xFF, 0x06, 0x82, 0xFF, 0x87, 0x82, 0xFF, 0x67, 0x82, 0xFF, 0x4D, 0x59, 0xFF, 0x85, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0x8D, 0x92, 0xFF, 0x11, 0x59, 0xFF, 0xC7, 0x38, 0xFF, 0x87, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0x8E, 0x61, 0xFF, 0x8C, 0x61, 0xFF, 0xA6, 0x38, 0xFF, 0xC8, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xE6, 0x40, 0xFF, 0x6F, 0x61, 0xFF, 0x0B, 0x49, 0xFF, 0xC8, 0x40, 0xFF, 0xCE, 0x61, 0xFF, 0xC9, 0x40, 0xFF, 0x0A, 0x49, 0xFF, 0xCF, 0x79, 0xFF, 0x69, 0x59, 0xFF, 0x49, 0x51, 0xFF, 0x0A, 0x49, 0xFF, 0x29, 0x51, 0xFF, 0xAE, 0x69, 0xFF, 0xEC, 0x71, 0xFF, 0x28, 0x51, 0xFF, 0x48, 0x51, 0xFF, 0x48, 0x51, 0xFF, 0x68, 0x59, 0xFF, 0x2D, 0x9B, 0xFF, 0xA7, 0x61, 0xFF, 0x88, 0x59, 0xFF, 0xA8, 0x61, 0xFF, 0x86, 0x61, 0xFF, 0x8D, 0xB3, 0xFF, 0x68, 0x7A, 0xFF, 0x47, 0x6A, 0xFF, 0x27, 0x6A, 0xFF, 0xA7, 0x82, 0xFF, 0x2D, 0xDD, 0xFF, 0xEC, 0xAB, 0xFF, 0xA7, 0x7A, 0xFF, 0xC7, 0x7A, 0xFF, 0x4B, 0xC5, 0xFF,
-    0x27, 0x83, 0xFF, 0xD1, 0xFF, 0xFF, 0x28, 0x8B, 0xFF, 0x07, 0x8B, 0xFF, 0x64, 0x8B, 0xFF, 0xE6, 0x82, 0xFF, 0x8D, 0xFD, 0xFF, 0x65, 0x82, 0xFF, 0x86, 0x82, 0xFF, 0xCC, 0xE5, 0xFF, 0x65, 0x7A, 0xFF, 0x66, 0x82, 0xFF, 0x05, 0x7A, 0xFF, 0x69, 0xA3, 0xFF, 0x26, 0x7A, 0xFF, 0x26, 0x72, 0xFF, 0x06, 0x72, 0xFF, 0x24, 0x82, 0xFF, 0x48, 0xAB, 0xFF, 0x06, 0x72, 0xFF, 0xE6, 0x71, 0xFF, 0x06, 0x7A, 0xFF, 0xA7, 0xA2, 0xFF, 0xCC, 0xBB, 0xFF, 0x26, 0x7A, 0xFF, 0xE6, 0x79, 0xFF, 0x06, 0x7A, 0xFF, 0xE6, 0x71, 0xFF, 0xA8, 0x8A, 0xFF, 0x47, 0x82, 0xFF, 0x67, 0x82, 0xFF, 0x67, 0x82, 0xFF, 0xA5, 0x30, 0xFF, 0xCA, 0x40, 0xFF, 0x64, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x68, 0x49, 0xFF, 0xC8, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0xC9, 0x38, 0xFF, 0x48, 0x49, 0xFF, 0xC7, 0x38, 0xFF, 0xC9, 0x38, 0xFF, 0xE7, 0x40, 0xFF, 0x48, 0x51, 0xFF, 0xC6, 0x38, 0xFF, 0xA8, 0x40, 0xFF, 0xAA, 0x61, 0xFF, 0x0B, 0x51, 0xFF, 0xCB, 0x48, 0xFF, 0xC9, 0x40, 0xFF, 0xC9, 0x48, 0xFF, 0x0A, 0x49, 0xFF, 0x07, 0x49, 0xFF, 0xAA, 0x61, 0xFF, 0x29, 0x51, 0xFF, 0x28, 0x51, 0xFF, 0x28, 0x51, 0xFF, 0x28, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x69, 0x59, 0xFF,
-    0x67, 0x59, 0xFF, 0xCC, 0x92, 0xFF, 0xA7, 0x61, 0xFF, 0xA8, 0x59, 0xFF, 0xC8, 0x61, 0xFF, 0x67, 0x72, 0xFF, 0x0D, 0xB4, 0xFF, 0x27, 0x6A, 0xFF, 0x88, 0x72, 0xFF, 0x47, 0x72, 0xFF, 0x48, 0x83, 0xFF, 0x4E, 0xE5, 0xFF, 0x86, 0x72, 0xFF, 0xC7, 0x7A, 0xFF, 0x27, 0x83, 0xFF, 0x68, 0xA4, 0xFF, 0xA6, 0xA3, 0xFF, 0x47, 0x93, 0xFF, 0x47, 0x8B, 0xFF, 0x67, 0x8B, 0xFF, 0x27, 0x93, 0xFF, 0x06, 0x8B, 0xFF, 0xC6, 0x8A, 0xFF, 0xA6, 0x82, 0xFF, 0x86, 0x82, 0xFF, 0x86, 0x82, 0xFF, 0x65, 0x82, 0xFF, 0x4E, 0xFE, 0xFF, 0x86, 0x82, 0xFF, 0x8A, 0xAB, 0xFF, 0x26, 0x7A, 0xFF, 0x25, 0x72, 0xFF, 0xEC, 0xF4, 0xFF, 0x06, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0x86, 0xA2, 0xFF, 0xE5, 0x79, 0xFF, 0xE6, 0x71, 0xFF, 0xE6, 0x79, 0xFF, 0x06, 0x7A, 0xFF, 0x0B, 0xDC, 0xFF, 0x06, 0x7A, 0xFF, 0x47, 0x82, 0xFF, 0x26, 0x7A, 0xFF, 0x87, 0x8A, 0xFF, 0x87, 0x8A, 0xFF, 0xA7, 0x30, 0xFF, 0x2F, 0x39, 0xFF, 0x0F, 0x51, 0xFF, 0xA6, 0x30, 0xFF, 0x27, 0x41, 0xFF, 0xE7, 0x38, 0xFF, 0xE7, 0x40, 0xFF, 0x33, 0x61, 0xFF, 0xC7, 0x38, 0xFF, 0xC9, 0x40, 0xFF, 0xA7, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0x4D, 0x59, 0xFF, 0xC8, 0x38, 0xFF, 0xC8, 0x38, 0xFF, 0x69, 0x51, 0xFF,
-    0x09, 0x41, 0xFF, 0xA9, 0x40, 0xFF, 0x6D, 0x72, 0xFF, 0xCB, 0x61, 0xFF, 0x6F, 0x59, 0xFF, 0xAA, 0x40, 0xFF, 0xAB, 0x40, 0xFF, 0xEE, 0x79, 0xFF, 0x49, 0x51, 0xFF, 0x8A, 0x61, 0xFF, 0x6A, 0x59, 0xFF, 0x69, 0x59, 0xFF, 0x6C, 0x82, 0xFF, 0xAB, 0x61, 0xFF, 0x28, 0x51, 0xFF, 0x48, 0x51, 0xFF, 0x48, 0x59, 0xFF, 0xCD, 0x92, 0xFF, 0x66, 0x59, 0xFF, 0xA8, 0x59, 0xFF, 0xC8, 0x61, 0xFF, 0x66, 0x7A, 0xFF, 0x2E, 0xBC, 0xFF, 0x47, 0x6A, 0xFF, 0x67, 0x72, 0xFF, 0xA8, 0x7A, 0xFF, 0x08, 0x94, 0xFF, 0x8F, 0xED, 0xFF, 0xA6, 0x7A, 0xFF, 0x07, 0x83, 0xFF, 0x4D, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xD5, 0xFF, 0xC8, 0xA3, 0xFF, 0xA6, 0x9B, 0xFF, 0xEE, 0xF6, 0xFF, 0x67, 0x9B, 0xFF, 0x0D, 0xEE, 0xFF, 0xE7, 0x92, 0xFF, 0xE6, 0x92, 0xFF, 0xEC, 0xDD, 0xFF, 0xC6, 0x92, 0xFF, 0x27, 0xA3, 0xFF, 0xE6, 0x92, 0xFF, 0xA7, 0xA3, 0xFF, 0x86, 0x82, 0xFF, 0x46, 0x82, 0xFF, 0x26, 0x7A, 0xFF, 0x66, 0x82, 0xFF, 0x06, 0x7A, 0xFF, 0x26, 0x82, 0xFF, 0x67, 0x8A, 0xFF, 0x26, 0x82, 0xFF, 0xA7, 0x92, 0xFF, 0x06, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0xA8, 0x92, 0xFF, 0x06, 0x7A, 0xFF, 0x67, 0x8A, 0xFF, 0x47, 0x8A, 0xFF, 0xA7, 0x8A, 0xFF, 0xA7, 0x92, 0xFF,
-    0xA7, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x07, 0x41, 0xFF, 0xA6, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x66, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xA8, 0x38, 0xFF, 0xE6, 0x40, 0xFF, 0xA7, 0x38, 0xFF, 0xC7, 0x40, 0xFF, 0xC7, 0x38, 0xFF, 0x08, 0x49, 0xFF, 0x6B, 0x51, 0xFF, 0xE7, 0x40, 0xFF, 0x4B, 0x59, 0xFF, 0x8C, 0x59, 0xFF, 0xE9, 0x40, 0xFF, 0xCA, 0x40, 0xFF, 0x09, 0x49, 0xFF, 0x6C, 0x61, 0xFF, 0x08, 0x49, 0xFF, 0x4A, 0x59, 0xFF, 0xEA, 0x69, 0xFF, 0xAA, 0x61, 0xFF, 0x2D, 0x82, 0xFF, 0x48, 0x59, 0xFF, 0x48, 0x51, 0xFF, 0x48, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0xEC, 0x92, 0xFF, 0xA7, 0x61, 0xFF, 0xA8, 0x59, 0xFF, 0xC8, 0x61, 0xFF, 0xA7, 0x7A, 0xFF, 0x0C, 0xB4, 0xFF, 0x47, 0x72, 0xFF, 0x47, 0x72, 0xFF, 0x87, 0x72, 0xFF, 0xA8, 0x9B, 0xFF, 0x8F, 0xF6, 0xFF, 0xC7, 0x82, 0xFF, 0x07, 0x83, 0xFF, 0x08, 0x9D, 0xFF, 0x29, 0xB5, 0xFF, 0x0D, 0xEF, 0xFF, 0xA7, 0x9B, 0xFF, 0xC7, 0x9B, 0xFF, 0x0E, 0xD6, 0xFF, 0x08, 0xA4, 0xFF, 0xF1, 0xFF, 0xFF, 0x27, 0x93, 0xFF, 0xB0, 0xF6, 0xFF, 0xC6, 0x8A, 0xFF, 0xE6, 0x8A, 0xFF, 0x11, 0xFF, 0xFF, 0xC7, 0x92, 0xFF, 0xA6, 0x8A, 0xFF, 0xC6, 0x92, 0xFF, 0xA5, 0x92, 0xFF, 0xA5, 0x92, 0xFF,
-    0x46, 0x82, 0xFF, 0x26, 0x7A, 0xFF, 0x26, 0x82, 0xFF, 0xCB, 0xDC, 0xFF, 0x05, 0x82, 0xFF, 0x26, 0x82, 0xFF, 0x06, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0x8A, 0xDC, 0xFF, 0x26, 0x82, 0xFF, 0x47, 0x82, 0xFF, 0x27, 0x82, 0xFF, 0x67, 0x8A, 0xFF, 0x46, 0x8A, 0xFF, 0x28, 0xA3, 0xFF, 0xC7, 0x92, 0xFF, 0xE7, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0x88, 0x38, 0xFF, 0xCE, 0x48, 0xFF, 0x28, 0x41, 0xFF, 0x07, 0x41, 0xFF, 0x85, 0x30, 0xFF, 0xAB, 0x40, 0xFF, 0x4D, 0x51, 0xFF, 0xEA, 0x48, 0xFF, 0xE9, 0x40, 0xFF, 0xA7, 0x38, 0xFF, 0x0C, 0x49, 0xFF, 0x30, 0x51, 0xFF, 0x09, 0x49, 0xFF, 0xC6, 0x40, 0xFF, 0xE9, 0x48, 0xFF, 0x88, 0x59, 0xFF, 0x2B, 0x51, 0xFF, 0xE9, 0x48, 0xFF, 0x6E, 0x59, 0xFF, 0xC9, 0x40, 0xFF, 0x09, 0x49, 0xFF, 0xCC, 0x61, 0xFF, 0x29, 0x51, 0xFF, 0x8A, 0x59, 0xFF, 0x89, 0x59, 0xFF, 0x49, 0x59, 0xFF, 0x49, 0x59, 0xFF, 0x49, 0x51, 0xFF, 0x69, 0x61, 0xFF, 0x67, 0x61, 0xFF, 0x4C, 0x82, 0xFF, 0xA7, 0x69, 0xFF, 0xA8, 0x61, 0xFF, 0xC8, 0x61, 0xFF, 0x68, 0x8B, 0xFF, 0x08, 0x72, 0xFF, 0x27, 0x6A, 0xFF, 0x68, 0x72, 0xFF, 0x87, 0x7A, 0xFF, 0x47, 0x93, 0xFF, 0x09, 0xA4, 0xFF, 0xE7, 0x82, 0xFF, 0x07, 0x8B, 0xFF, 0xA6, 0x8B, 0xFF, 0x4B, 0xCE, 0xFF,
-    0x89, 0xB4, 0xFF, 0x49, 0xB4, 0xFF, 0x27, 0xA4, 0xFF, 0x48, 0xAC, 0xFF, 0x28, 0xB4, 0xFF, 0x25, 0x8B, 0xFF, 0xC4, 0x8A, 0xFF, 0x47, 0xAC, 0xFF, 0x27, 0x9B, 0xFF, 0x06, 0x93, 0xFF, 0xE6, 0x92, 0xFF, 0x88, 0xA3, 0xFF, 0xC6, 0x92, 0xFF, 0xC6, 0x92, 0xFF, 0x45, 0x82, 0xFF, 0x45, 0x82, 0xFF, 0x25, 0x82, 0xFF, 0x46, 0x8A, 0xFF, 0x26, 0x82, 0xFF, 0x05, 0x82, 0xFF, 0x26, 0x82, 0xFF, 0x46, 0x82, 0xFF, 0x26, 0x82, 0xFF, 0x26, 0x8A, 0xFF, 0x47, 0x8A, 0xFF, 0x27, 0x82, 0xFF, 0x47, 0x82, 0xFF, 0x27, 0x82, 0xFF, 0x88, 0x8A, 0xFF, 0x66, 0x8A, 0xFF, 0xC8, 0x92, 0xFF, 0xE8, 0x9A, 0xFF, 0x2D, 0x51, 0xFF, 0xEC, 0x40, 0xFF, 0xA6, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0xE6, 0x38, 0xFF, 0x4C, 0x59, 0xFF, 0xCA, 0x59, 0xFF, 0x07, 0x41, 0xFF, 0xA6, 0x30, 0xFF, 0xC8, 0x38, 0xFF, 0x0F, 0x59, 0xFF, 0xEE, 0x69, 0xFF, 0xC8, 0x38, 0xFF, 0xC8, 0x38, 0xFF, 0x07, 0x41, 0xFF, 0x2B, 0x51, 0xFF, 0xF0, 0x79, 0xFF, 0xE7, 0x40, 0xFF, 0xCB, 0x61, 0xFF, 0xCA, 0x48, 0xFF, 0x2E, 0x51, 0xFF, 0xEA, 0x48, 0xFF, 0x4E, 0x92, 0xFF, 0x09, 0x49, 0xFF, 0xED, 0x71, 0xFF, 0x29, 0x51, 0xFF, 0x49, 0x59, 0xFF, 0x8F, 0x9A, 0xFF, 0x6A, 0x59, 0xFF, 0x48, 0x51, 0xFF, 0xCC, 0x69, 0xFF, 0x68, 0x59, 0xFF,
-    0x87, 0x69, 0xFF, 0x2E, 0xD4, 0xFF, 0x09, 0x72, 0xFF, 0xA8, 0x61, 0xFF, 0xE8, 0x69, 0xFF, 0x0A, 0x93, 0xFF, 0x70, 0xFD, 0xFF, 0x48, 0x7A, 0xFF, 0x68, 0x7A, 0xFF, 0x87, 0x7A, 0xFF, 0x86, 0xA4, 0xFF, 0xFD, 0xFF, 0xFF, 0x26, 0x9B, 0xFF, 0x47, 0x8B, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0xCD, 0xFF, 0xB0, 0xFE, 0xFF, 0xF6, 0xFF, 0xFF, 0x88, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xAB, 0xFF, 0xD0, 0xF6, 0xFF, 0xA7, 0xAB, 0xFF, 0xA7, 0xAB, 0xFF, 0xD2, 0xFF, 0xFF, 0xC8, 0xB3, 0xFF, 0x26, 0xA3, 0xFF, 0x0F, 0xF6, 0xFF, 0xAA, 0xCC, 0xFF, 0x88, 0xAB, 0xFF, 0x66, 0x8A, 0xFF, 0x86, 0x92, 0xFF, 0xCE, 0xF5, 0xFF, 0x6A, 0xDC, 0xFF, 0x26, 0x82, 0xFF, 0x26, 0x82, 0xFF, 0x45, 0x92, 0xFF, 0x70, 0xFE, 0xFF, 0x45, 0x9A, 0xFF, 0x47, 0x8A, 0xFF, 0x47, 0x8A, 0xFF, 0x67, 0x8A, 0xFF, 0x08, 0xA3, 0xFF, 0x48, 0xDB, 0xFF, 0x67, 0x92, 0xFF, 0xE8, 0x9A, 0xFF, 0x08, 0xA3, 0xFF, 0x8A, 0x38, 0xFF, 0xA9, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0x89, 0x30, 0xFF, 0x88, 0x30, 0xFF, 0x27, 0x49, 0xFF, 0xC7, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0xA9, 0x38, 0xFF, 0x15, 0x7A, 0xFF, 0xA8, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0x8A, 0x59, 0xFF, 0xE8, 0x40, 0xFF,
-    0xC9, 0x40, 0xFF, 0xC8, 0x48, 0xFF, 0xC9, 0x61, 0xFF, 0xC7, 0x40, 0xFF, 0xE8, 0x48, 0xFF, 0xE9, 0x48, 0xFF, 0xEB, 0x50, 0xFF, 0x09, 0x49, 0xFF, 0x2A, 0x51, 0xFF, 0x29, 0x51, 0xFF, 0x4A, 0x59, 0xFF, 0x28, 0x51, 0xFF, 0x48, 0x59, 0xFF, 0xAB, 0x69, 0xFF, 0xED, 0x69, 0xFF, 0x68, 0x59, 0xFF, 0xE8, 0x69, 0xFF, 0xC8, 0x61, 0xFF, 0x0A, 0x72, 0xFF, 0xA8, 0x61, 0xFF, 0xC8, 0x69, 0xFF, 0xCE, 0xC4, 0xFF, 0xFA, 0xFF, 0xFF, 0x48, 0x72, 0xFF, 0x68, 0x7A, 0xFF, 0xC7, 0x7A, 0xFF, 0xFE, 0xFF, 0xFF, 0x2D, 0xF7, 0xFF, 0x28, 0x93, 0xFF, 0x47, 0x93, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0xD5, 0xFF, 0x09, 0xC5, 0xFF, 0x30, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xFE, 0xFF, 0x27, 0xB4, 0xFF, 0x90, 0xF6, 0xFF, 0xC7, 0xAB, 0xFF, 0xFE, 0xFF, 0xFF, 0x67, 0xA3, 0xFF, 0x88, 0xAB, 0xFF, 0xA8, 0xBB, 0xFF, 0x66, 0xA3, 0xFF, 0x47, 0xAB, 0xFF, 0xA6, 0x92, 0xFF, 0x86, 0x8A, 0xFF, 0x0F, 0xFE, 0xFF, 0x8B, 0xD4, 0xFF, 0x66, 0x8A, 0xFF, 0x46, 0x8A, 0xFF, 0x26, 0x82, 0xFF, 0x6E, 0xFD, 0xFF, 0x67, 0x92, 0xFF, 0x27, 0x8A, 0xFF, 0x47, 0x8A, 0xFF, 0x67, 0x8A, 0xFF, 0x6C, 0xEC, 0xFF, 0x67, 0x8A, 0xFF, 0x87, 0x92, 0xFF, 0x87, 0x9A, 0xFF, 0xE8, 0x9A, 0xFF, 0x48, 0xAB, 0xFF,
-    0x85, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xF0, 0x50, 0xFF, 0x2B, 0x49, 0xFF, 0xC6, 0x38, 0xFF, 0xE7, 0x38, 0xFF, 0xA8, 0x38, 0xFF, 0x8F, 0x61, 0xFF, 0xC7, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xEC, 0x48, 0xFF, 0x90, 0x61, 0xFF, 0xC7, 0x38, 0xFF, 0x07, 0x49, 0xFF, 0x2F, 0x7A, 0xFF, 0x32, 0x51, 0xFF, 0xE7, 0x48, 0xFF, 0x09, 0x51, 0xFF, 0xE8, 0x40, 0xFF, 0x08, 0x49, 0xFF, 0x0C, 0x51, 0xFF, 0x0A, 0x51, 0xFF, 0x70, 0x8A, 0xFF, 0x09, 0x51, 0xFF, 0xEE, 0x71, 0xFF, 0x47, 0x51, 0xFF, 0x48, 0x59, 0xFF, 0x8E, 0x92, 0xFF, 0xAA, 0x69, 0xFF, 0x49, 0x59, 0xFF, 0x48, 0x59, 0xFF, 0x8A, 0x82, 0xFF, 0x2E, 0xF3, 0xFF, 0xE9, 0x71, 0xFF, 0xC7, 0x69, 0xFF, 0xE8, 0x69, 0xFF, 0x73, 0xF7, 0xFF, 0xEE, 0xFB, 0xFF, 0x88, 0x82, 0xFF, 0x67, 0x7A, 0xFF, 0x08, 0x8B, 0xFF, 0x88, 0xB4, 0xFF, 0xF1, 0xF6, 0xFF, 0x27, 0x9B, 0xFF, 0x67, 0x93, 0xFF, 0x6D, 0xEF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xA9, 0xCC, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xEB, 0xF5, 0xFF, 0xF6, 0xFF, 0xFF, 0x29, 0xDD, 0xFF, 0xF3, 0xFF, 0xFF, 0x07, 0xCD, 0xFF, 0xC7, 0xB3, 0xFF, 0xEC, 0xF5, 0xFF, 0x65, 0xA3, 0xFF, 0xE8, 0xBB, 0xFF, 0x88, 0xBB, 0xFF, 0x26, 0xA3, 0xFF, 0x90, 0xED, 0xFF,
-    0xC5, 0xA2, 0xFF, 0xA7, 0x92, 0xFF, 0x66, 0x8A, 0xFF, 0x66, 0x8A, 0xFF, 0xE5, 0x81, 0xFF, 0x0C, 0xD4, 0xFF, 0x67, 0x92, 0xFF, 0x47, 0x8A, 0xFF, 0x67, 0x8A, 0xFF, 0x05, 0x8A, 0xFF, 0xC7, 0xA2, 0xFF, 0x88, 0x92, 0xFF, 0xC8, 0x9A, 0xFF, 0xA7, 0x92, 0xFF, 0xE8, 0xA2, 0xFF, 0xE8, 0xA2, 0xFF, 0xC7, 0x30, 0xFF, 0x89, 0x51, 0xFF, 0x68, 0x28, 0xFF, 0xEA, 0x40, 0xFF, 0x4D, 0x38, 0xFF, 0x48, 0x49, 0xFF, 0xA7, 0x38, 0xFF, 0x6A, 0x51, 0xFF, 0xAE, 0x40, 0xFF, 0xE8, 0x40, 0xFF, 0xE8, 0x40, 0xFF, 0x07, 0x41, 0xFF, 0xEE, 0x48, 0xFF, 0x2E, 0x51, 0xFF, 0x68, 0x51, 0xFF, 0x08, 0x49, 0xFF, 0xE9, 0x48, 0xFF, 0x2F, 0x59, 0xFF, 0xC8, 0x40, 0xFF, 0xE8, 0x48, 0xFF, 0xF3, 0x48, 0xFF, 0x4F, 0x61, 0xFF, 0xCA, 0x48, 0xFF, 0x0B, 0x59, 0xFF, 0xE9, 0x48, 0xFF, 0xCE, 0x69, 0xFF, 0x68, 0x61, 0xFF, 0x29, 0x59, 0xFF, 0x6F, 0x8A, 0xFF, 0x49, 0x59, 0xFF, 0x4A, 0x59, 0xFF, 0x68, 0x59, 0xFF, 0xC9, 0x82, 0xFF, 0x2E, 0xA3, 0xFF, 0x29, 0x7A, 0xFF, 0xE8, 0x71, 0xFF, 0xC8, 0x69, 0xFF, 0x0C, 0xC5, 0xFF, 0xCE, 0xC4, 0xFF, 0x27, 0x7A, 0xFF, 0x48, 0x7A, 0xFF, 0xC7, 0x8A, 0xFF, 0x6D, 0xDE, 0xFF, 0xF7, 0xFF, 0xFF, 0x47, 0x9B, 0xFF, 0x87, 0x9B, 0xFF, 0xF3, 0xFF, 0xFF, 0xEC, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x09, 0xD5, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x6A, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0xDD, 0xFF, 0x28, 0xC4, 0xFF, 0xF7, 0xFF, 0xFF, 0x2E, 0xF7, 0xFF, 0xA9, 0xD4, 0xFF, 0x28, 0xCC, 0xFF, 0x51, 0xFF, 0xFF, 0x0C, 0xE5, 0xFF, 0x8A, 0xCC, 0xFF, 0x86, 0x92, 0xFF, 0x66, 0x92, 0xFF, 0xEF, 0xFE, 0xFF, 0x86, 0x9A, 0xFF, 0xA7, 0x9A, 0xFF, 0x47, 0x8A, 0xFF, 0x67, 0x92, 0xFF, 0x2C, 0xFD, 0xFF, 0x87, 0x92, 0xFF, 0x88, 0x92, 0xFF, 0x87, 0x92, 0xFF, 0xA8, 0x9A, 0xFF, 0xA7, 0x9A, 0xFF, 0x89, 0xC3, 0xFF, 0x68, 0xAB, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x38, 0xFF, 0xA7, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xAE, 0x38, 0xFF, 0xAA, 0x38, 0xFF, 0xA9, 0x38, 0xFF, 0xE7, 0x40, 0xFF, 0x88, 0x30, 0xFF, 0xB3, 0x50, 0xFF, 0xCA, 0x40, 0xFF, 0x29, 0x41, 0xFF, 0xE7, 0x40, 0xFF, 0xCB, 0x40, 0xFF, 0xD7, 0x48, 0xFF, 0x4B, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x6A, 0x51, 0xFF, 0x0D, 0x51, 0xFF, 0x4D, 0x59, 0xFF, 0xD2, 0x8A, 0xFF, 0xE9, 0x48, 0xFF, 0x6D, 0x59, 0xFF, 0xC8, 0x48, 0xFF, 0xEA, 0x48, 0xFF, 0x09, 0x51, 0xFF, 0x69, 0x61, 0xFF, 0x49, 0x59, 0xFF, 0x08, 0x59, 0xFF, 0x29, 0x59, 0xFF, 0x4E, 0x7A, 0xFF, 0x48, 0x59, 0xFF,
-    0x26, 0x72, 0xFF, 0x4B, 0x82, 0xFF, 0xAD, 0x92, 0xFF, 0x08, 0x72, 0xFF, 0xE9, 0x69, 0xFF, 0xAB, 0xBC, 0xFF, 0x8D, 0x9B, 0xFF, 0x08, 0x7A, 0xFF, 0x68, 0x82, 0xFF, 0xE8, 0x8A, 0xFF, 0xF4, 0xFF, 0xFF, 0xE8, 0xB3, 0xFF, 0x69, 0xAB, 0xFF, 0x47, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xEA, 0xED, 0xFF, 0xCD, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCA, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xFE, 0xFF, 0xFB, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x48, 0xC4, 0xFF, 0x07, 0xC4, 0xFF, 0x28, 0xC4, 0xFF, 0x2A, 0xDD, 0xFF, 0x07, 0xA3, 0xFF, 0x66, 0x9A, 0xFF, 0xA6, 0x9A, 0xFF, 0x88, 0xC3, 0xFF, 0xA7, 0x9A, 0xFF, 0x67, 0x92, 0xFF, 0x87, 0x92, 0xFF, 0x67, 0x92, 0xFF, 0xC8, 0x9A, 0xFF, 0x87, 0x92, 0xFF, 0x87, 0x9A, 0xFF, 0x87, 0x9A, 0xFF, 0xE8, 0xA2, 0xFF, 0x08, 0xAB, 0xFF, 0x08, 0xA3, 0xFF, 0x28, 0xAB, 0xFF, 0x6A, 0xCC, 0xFF, 0x8A, 0x30, 0xFF, 0x6D, 0x38, 0xFF, 0x8B, 0x30, 0xFF, 0x66, 0x28, 0xFF, 0xA6, 0x30, 0xFF, 0x8B, 0x38, 0xFF, 0x11, 0x51, 0xFF, 0x8A, 0x38, 0xFF, 0x69, 0x51, 0xFF, 0xA8, 0x38, 0xFF, 0x0E, 0x51, 0xFF, 0xEA, 0x48, 0xFF, 0x87, 0x38, 0xFF, 0xE7, 0x40, 0xFF, 0x6C, 0x51, 0xFF, 0x51, 0x59, 0xFF,
-    0x09, 0x49, 0xFF, 0x09, 0x49, 0xFF, 0xAC, 0x40, 0xFF, 0x6E, 0x61, 0xFF, 0xF1, 0x8A, 0xFF, 0x4B, 0x59, 0xFF, 0xEA, 0x48, 0xFF, 0x09, 0x51, 0xFF, 0xB0, 0x71, 0xFF, 0x8B, 0x59, 0xFF, 0x69, 0x61, 0xFF, 0x49, 0x59, 0xFF, 0x2A, 0x61, 0xFF, 0xEC, 0x79, 0xFF, 0xCF, 0x79, 0xFF, 0x6A, 0x61, 0xFF, 0x68, 0x82, 0xFF, 0x8D, 0xAA, 0xFF, 0x2D, 0x82, 0xFF, 0x49, 0x7A, 0xFF, 0xC9, 0x71, 0xFF, 0x67, 0x9B, 0xFF, 0xEC, 0xBB, 0xFF, 0x27, 0x82, 0xFF, 0x68, 0x82, 0xFF, 0xA8, 0x92, 0xFF, 0x8C, 0xCD, 0xFF, 0xF6, 0xFF, 0xFF, 0x08, 0xDC, 0xFF, 0x88, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x89, 0xE5, 0xFF, 0xF6, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF, 0xAB, 0xF5, 0xFF, 0x8F, 0xFF, 0xFF, 0x0B, 0xE6, 0xFF, 0x8B, 0xF5, 0xFF, 0x68, 0xD4, 0xFF, 0xB2, 0xFF, 0xFF, 0xAC, 0xF6, 0xFF, 0xA9, 0xD4, 0xFF, 0x27, 0xAB, 0xFF, 0xA7, 0xA2, 0xFF, 0x10, 0xFE, 0xFF, 0x26, 0xB3, 0xFF, 0x87, 0x9A, 0xFF, 0x66, 0x92, 0xFF, 0xE7, 0xAA, 0xFF, 0x4D, 0xFD, 0xFF, 0x2E, 0xFD, 0xFF, 0x68, 0x92, 0xFF, 0x87, 0x9A, 0xFF, 0x87, 0x9A, 0xFF, 0xA7, 0xA2, 0xFF, 0x6E, 0xFC, 0xFF, 0x28, 0xB3, 0xFF, 0x89, 0xB3, 0xFF, 0x28, 0xB3, 0xFF,
-    0xB1, 0x48, 0xFF, 0x8A, 0x30, 0xFF, 0xAB, 0x38, 0xFF, 0xCD, 0x40, 0xFF, 0xA8, 0x30, 0xFF, 0x71, 0x61, 0xFF, 0xB0, 0x69, 0xFF, 0xF3, 0x48, 0xFF, 0x4C, 0x49, 0xFF, 0xA7, 0x38, 0xFF, 0x6C, 0x61, 0xFF, 0x51, 0x71, 0xFF, 0xEA, 0x40, 0xFF, 0xE7, 0x40, 0xFF, 0xEC, 0x69, 0xFF, 0xAB, 0x40, 0xFF, 0x31, 0x59, 0xFF, 0x0E, 0x7A, 0xFF, 0x2A, 0x51, 0xFF, 0x2B, 0x51, 0xFF, 0x70, 0x7A, 0xFF, 0x0A, 0x59, 0xFF, 0xB1, 0x89, 0xFF, 0x2F, 0x72, 0xFF, 0x0A, 0x51, 0xFF, 0xCF, 0x71, 0xFF, 0xEC, 0x79, 0xFF, 0xF2, 0x89, 0xFF, 0x4C, 0x69, 0xFF, 0x2F, 0x82, 0xFF, 0x6A, 0x61, 0xFF, 0x69, 0x61, 0xFF, 0xCC, 0xAB, 0xFF, 0x0E, 0xCB, 0xFF, 0x2B, 0x8A, 0xFF, 0x8A, 0x82, 0xFF, 0xC9, 0x71, 0xFF, 0x09, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0x82, 0xFF, 0x68, 0x82, 0xFF, 0xA8, 0x92, 0xFF, 0x6B, 0xDD, 0xFF, 0xF3, 0xFF, 0xFF, 0x8C, 0xEC, 0xFF, 0xC9, 0xB3, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xF5, 0xFF, 0xFB, 0xFF, 0xFF, 0x6D, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0xFF, 0xFF, 0xAE, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xF5, 0xFF, 0xEC, 0xFD, 0xFF, 0xAD, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0x0E, 0xFF, 0xFF, 0xE7, 0xC3, 0xFF, 0xC8, 0xBB, 0xFF,
-    0x2E, 0xFE, 0xFF, 0x8E, 0xF6, 0xFF, 0xF3, 0xFD, 0xFF, 0xA7, 0xA2, 0xFF, 0xC8, 0xA2, 0xFF, 0xE8, 0xCB, 0xFF, 0x0D, 0xF5, 0xFF, 0x47, 0xA2, 0xFF, 0xA8, 0xA2, 0xFF, 0x87, 0x9A, 0xFF, 0x49, 0xBB, 0xFF, 0xE8, 0xAA, 0xFF, 0x08, 0xAB, 0xFF, 0x48, 0xAB, 0xFF, 0x0B, 0xCC, 0xFF, 0xCA, 0xCB, 0xFF, 0x4A, 0x30, 0xFF, 0x89, 0x30, 0xFF, 0x10, 0x51, 0xFF, 0x6A, 0x30, 0xFF, 0x6A, 0x30, 0xFF, 0x0C, 0x41, 0xFF, 0xAB, 0x38, 0xFF, 0x52, 0x61, 0xFF, 0xCB, 0x40, 0xFF, 0xAA, 0x38, 0xFF, 0x46, 0x28, 0xFF, 0xAA, 0x38, 0xFF, 0xD3, 0x71, 0xFF, 0xEA, 0x48, 0xFF, 0xEA, 0x61, 0xFF, 0xC8, 0x40, 0xFF, 0xCB, 0x40, 0xFF, 0x52, 0x59, 0xFF, 0x10, 0x7A, 0xFF, 0xAD, 0x61, 0xFF, 0xCA, 0x48, 0xFF, 0x71, 0x69, 0xFF, 0xEC, 0x50, 0xFF, 0xF0, 0x81, 0xFF, 0x2A, 0x51, 0xFF, 0x8C, 0x61, 0xFF, 0xE8, 0x50, 0xFF, 0xAC, 0x69, 0xFF, 0x70, 0x9A, 0xFF, 0x69, 0x61, 0xFF, 0x49, 0x61, 0xFF, 0xED, 0x71, 0xFF, 0x0E, 0xB4, 0xFF, 0x0F, 0xB3, 0xFF, 0x89, 0x69, 0xFF, 0x6A, 0x82, 0xFF, 0xC9, 0x71, 0xFF, 0x25, 0x93, 0xFF, 0xF4, 0xFF, 0xFF, 0xE7, 0x81, 0xFF, 0x68, 0x8A, 0xFF, 0x68, 0x8A, 0xFF, 0xA9, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xC3, 0xFF, 0x69, 0xAB, 0xFF, 0xCD, 0xE6, 0xFF, 0xAD, 0xF6, 0xFF,
-    0xFB, 0xFF, 0xFF, 0x2D, 0xFE, 0xFF, 0x6D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xFF, 0xFF, 0x0B, 0xEE, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFE, 0xFF, 0x49, 0xED, 0xFF, 0xE8, 0xDC, 0xFF, 0xB2, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xA6, 0xA2, 0xFF, 0x86, 0xA2, 0xFF, 0xC8, 0xC3, 0xFF, 0xA6, 0xB2, 0xFF, 0x6D, 0xFD, 0xFF, 0x67, 0x9A, 0xFF, 0x87, 0xA2, 0xFF, 0x29, 0xB3, 0xFF, 0xE7, 0xBA, 0xFF, 0xED, 0xFC, 0xFF, 0xE8, 0xAA, 0xFF, 0x0C, 0xCC, 0xFF, 0x0C, 0xEE, 0xFF, 0x89, 0xC3, 0xFF, 0x0A, 0xD4, 0xFF, 0x2A, 0x28, 0xFF, 0x8A, 0x30, 0xFF, 0x8A, 0x38, 0xFF, 0x8B, 0x30, 0xFF, 0xEE, 0x48, 0xFF, 0xCC, 0x38, 0xFF, 0x6A, 0x30, 0xFF, 0x8B, 0x38, 0xFF, 0x8A, 0x38, 0xFF, 0xAD, 0x40, 0xFF, 0x0B, 0x49, 0xFF, 0xE8, 0x40, 0xFF, 0xEA, 0x48, 0xFF, 0xAE, 0x38, 0xFF, 0x0A, 0x49, 0xFF, 0xC9, 0x40, 0xFF, 0xC9, 0x40, 0xFF, 0xAA, 0x40, 0xFF, 0x6D, 0x40, 0xFF, 0x4B, 0x59, 0xFF, 0xC8, 0x48, 0xFF, 0x0C, 0x59, 0xFF, 0xCC, 0x48, 0xFF, 0x0E, 0x6A, 0xFF, 0xCC, 0x50, 0xFF, 0xCB, 0x69, 0xFF, 0x0B, 0x59, 0xFF, 0xEB, 0x71, 0xFF, 0x8D, 0x71, 0xFF, 0xCA, 0x71, 0xFF, 0x0F, 0x82, 0xFF, 0xCB, 0x69, 0xFF,
-    0x49, 0xA3, 0xFF, 0xEF, 0xAA, 0xFF, 0x6F, 0x92, 0xFF, 0x09, 0x7A, 0xFF, 0xA9, 0x71, 0xFF, 0xA5, 0x8A, 0xFF, 0x30, 0xD4, 0xFF, 0xE7, 0x81, 0xFF, 0x48, 0x8A, 0xFF, 0x47, 0x8A, 0xFF, 0x4D, 0xE5, 0xFF, 0xFE, 0xFF, 0xFF, 0x08, 0xAB, 0xFF, 0x6A, 0xBB, 0xFF, 0xF4, 0xFF, 0xFF, 0x8C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xFE, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0xCC, 0xF6, 0xFF, 0x6E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0xF6, 0xFF, 0xD1, 0xFF, 0xFF, 0x8D, 0xFE, 0xFF, 0xFB, 0xFF, 0xFF, 0xC6, 0xC3, 0xFF, 0xE6, 0xAA, 0xFF, 0xE7, 0xAA, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x87, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0xA8, 0xA2, 0xFF, 0xCB, 0xF4, 0xFF, 0xAE, 0xFD, 0xFF, 0xE8, 0xAA, 0xFF, 0x89, 0xC3, 0xFF, 0xFA, 0xFF, 0xFF, 0xAA, 0xCB, 0xFF, 0x89, 0xC3, 0xFF, 0x4B, 0xE4, 0xFF, 0xB3, 0xFF, 0xFF, 0x6A, 0x30, 0xFF, 0x8B, 0x38, 0xFF, 0x89, 0x30, 0xFF, 0x8B, 0x30, 0xFF, 0x4B, 0x30, 0xFF, 0xAB, 0x38, 0xFF, 0x8B, 0x38, 0xFF, 0x6B, 0x30, 0xFF, 0xEC, 0x40, 0xFF, 0x54, 0x8B, 0xFF, 0xB1, 0x7A, 0xFF, 0xEC, 0x40, 0xFF, 0xE7, 0x38, 0xFF, 0x4E, 0x72, 0xFF, 0x73, 0x40, 0xFF, 0xCE, 0x48, 0xFF,
-    0xE8, 0x40, 0xFF, 0x89, 0x40, 0xFF, 0x72, 0x61, 0xFF, 0x91, 0x71, 0xFF, 0xEA, 0x50, 0xFF, 0xC9, 0x50, 0xFF, 0xAB, 0x48, 0xFF, 0xEA, 0x50, 0xFF, 0xCB, 0x50, 0xFF, 0x8C, 0x61, 0xFF, 0xEA, 0x58, 0xFF, 0x2F, 0x9B, 0xFF, 0x8D, 0x69, 0xFF, 0xB0, 0xAB, 0xFF, 0xAF, 0x79, 0xFF, 0x6C, 0x7A, 0xFF, 0x48, 0x82, 0xFF, 0x0A, 0x7A, 0xFF, 0x0F, 0x8A, 0xFF, 0xE6, 0x71, 0xFF, 0xA9, 0x79, 0xFF, 0x44, 0x8A, 0xFF, 0xCE, 0xAA, 0xFF, 0xE7, 0x81, 0xFF, 0x88, 0x8A, 0xFF, 0x47, 0x8A, 0xFF, 0xA9, 0xD3, 0xFF, 0x28, 0xBB, 0xFF, 0xE8, 0xAA, 0xFF, 0x08, 0xAB, 0xFF, 0x8C, 0xDC, 0xFF, 0xF7, 0xFF, 0xFF, 0x8A, 0xEC, 0xFF, 0x8F, 0xFF, 0xFF, 0xB0, 0xF6, 0xFF, 0x4D, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xF7, 0xFF, 0x30, 0xF7, 0xFF, 0xEB, 0xF5, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0xFF, 0xFF, 0x8A, 0xED, 0xFF, 0xCA, 0xF5, 0xFF, 0xFC, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0x29, 0xDC, 0xFF, 0x27, 0xBB, 0xFF, 0xF5, 0xFF, 0xFF, 0xB1, 0xFF, 0xFF, 0x28, 0xBB, 0xFF, 0x66, 0xA2, 0xFF, 0xE9, 0xBA, 0xFF, 0xCB, 0xEC, 0xFF, 0xE7, 0xBA, 0xFF, 0xA8, 0xAA, 0xFF, 0xC8, 0xAA, 0xFF, 0x6A, 0xC3, 0xFF, 0x09, 0xB3, 0xFF, 0x2B, 0xE4, 0xFF, 0xCA, 0xCB, 0xFF, 0xEA, 0xDB, 0xFF, 0xCA, 0xD3, 0xFF,
-    0x8B, 0x30, 0xFF, 0x4A, 0x28, 0xFF, 0x49, 0x28, 0xFF, 0x8B, 0x38, 0xFF, 0x08, 0x20, 0xFF, 0x6A, 0x30, 0xFF, 0x93, 0x40, 0xFF, 0x8B, 0x38, 0xFF, 0xCC, 0x40, 0xFF, 0xEE, 0x61, 0xFF, 0x8D, 0x61, 0xFF, 0x34, 0x59, 0xFF, 0x4D, 0x51, 0xFF, 0x0F, 0x83, 0xFF, 0xAB, 0x40, 0xFF, 0xD3, 0x48, 0xFF, 0xD0, 0x48, 0xFF, 0x89, 0x40, 0xFF, 0xCB, 0x48, 0xFF, 0xED, 0x48, 0xFF, 0x0D, 0x59, 0xFF, 0x09, 0x51, 0xFF, 0xAC, 0x48, 0xFF, 0x2D, 0x59, 0xFF, 0x13, 0x59, 0xFF, 0x49, 0x59, 0xFF, 0x0A, 0x51, 0xFF, 0x31, 0xA4, 0xFF, 0x2A, 0x61, 0xFF, 0x71, 0xB3, 0xFF, 0x28, 0x61, 0xFF, 0xF2, 0xB3, 0xFF, 0xE7, 0x81, 0xFF, 0xCD, 0x92, 0xFF, 0xED, 0x81, 0xFF, 0x08, 0x7A, 0xFF, 0xCA, 0x79, 0xFF, 0x85, 0xA2, 0xFF, 0xAC, 0xA2, 0xFF, 0xE8, 0x89, 0xFF, 0x29, 0x92, 0xFF, 0xEA, 0xAA, 0xFF, 0xCC, 0xDC, 0xFF, 0xE8, 0xBA, 0xFF, 0x49, 0xCB, 0xFF, 0x09, 0xBB, 0xFF, 0x08, 0xBB, 0xFF, 0x72, 0xF7, 0xFF, 0x49, 0xEC, 0xFF, 0x71, 0xFF, 0xFF, 0xCA, 0xEC, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xF6, 0xFF, 0x6C, 0xFE, 0xFF, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xEE, 0xFF, 0x0B, 0xF6, 0xFF, 0xEB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2B, 0xEE, 0xFF, 0xAA, 0xEC, 0xFF,
-    0x6A, 0xEC, 0xFF, 0x8F, 0xFE, 0xFF, 0xE7, 0xC2, 0xFF, 0x48, 0xC3, 0xFF, 0xA7, 0xB2, 0xFF, 0xEF, 0xFD, 0xFF, 0x88, 0xB2, 0xFF, 0xC8, 0xB2, 0xFF, 0xC9, 0xB2, 0xFF, 0xE8, 0xB2, 0xFF, 0x2B, 0xE4, 0xFF, 0x8A, 0xCB, 0xFF, 0x8A, 0xC3, 0xFF, 0xCA, 0xD3, 0xFF, 0x4D, 0xFD, 0xFF, 0xEE, 0xFE, 0xFF, 0x11, 0x51, 0xFF, 0xAA, 0x38, 0xFF, 0x50, 0x72, 0xFF, 0x56, 0x38, 0xFF, 0x2D, 0x49, 0xFF, 0x6B, 0x38, 0xFF, 0xAB, 0x38, 0xFF, 0x4D, 0x30, 0xFF, 0x71, 0x59, 0xFF, 0xEB, 0x40, 0xFF, 0x8C, 0x38, 0xFF, 0x73, 0x69, 0xFF, 0xD2, 0x50, 0xFF, 0xAE, 0x61, 0xFF, 0xAC, 0x40, 0xFF, 0xAB, 0x40, 0xFF, 0xD5, 0x50, 0xFF, 0xFA, 0x8A, 0xFF, 0xCB, 0x48, 0xFF, 0xEB, 0x48, 0xFF, 0x10, 0x59, 0xFF, 0xAE, 0x61, 0xFF, 0xB2, 0x89, 0xFF, 0x0D, 0x59, 0xFF, 0x90, 0x69, 0xFF, 0xF0, 0x79, 0xFF, 0x2D, 0x61, 0xFF, 0xCA, 0x71, 0xFF, 0x6B, 0x69, 0xFF, 0xCE, 0x9A, 0xFF, 0xF1, 0xBB, 0xFF, 0x4F, 0x8A, 0xFF, 0x6A, 0x92, 0xFF, 0xD1, 0xC2, 0xFF, 0x8B, 0x79, 0xFF, 0xEC, 0x9A, 0xFF, 0xAA, 0x81, 0xFF, 0x05, 0xA2, 0xFF, 0x96, 0xFF, 0xFF, 0xE8, 0x89, 0xFF, 0x29, 0x92, 0xFF, 0x49, 0x9A, 0xFF, 0xEA, 0xD3, 0xFF, 0xF9, 0xFF, 0xFF, 0x78, 0xFF, 0xFF, 0xEA, 0xC2, 0xFF, 0x49, 0xCB, 0xFF, 0x4E, 0xFD, 0xFF,
-    0xAC, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xEC, 0xFF, 0xD8, 0xFF, 0xFF, 0xCD, 0xF5, 0xFF, 0x4B, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xFF, 0xFF, 0x8B, 0xF5, 0xFF, 0x4C, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xF6, 0xFF, 0xCB, 0xF5, 0xFF, 0xFE, 0xFF, 0xFF, 0xC9, 0xE4, 0xFF, 0xF1, 0xF6, 0xFF, 0x07, 0xCB, 0xFF, 0x49, 0xD3, 0xFF, 0xA6, 0xC2, 0xFF, 0x6A, 0xD3, 0xFF, 0x93, 0xFF, 0xFF, 0x07, 0xC3, 0xFF, 0xCA, 0xD3, 0xFF, 0x08, 0xC3, 0xFF, 0xA8, 0xBA, 0xFF, 0xAC, 0xF4, 0xFF, 0xCE, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xDB, 0xFF, 0x6B, 0xF4, 0xFF, 0x50, 0x30, 0xFF, 0xF1, 0x69, 0xFF, 0xF0, 0x69, 0xFF, 0x6B, 0x30, 0xFF, 0x54, 0x8B, 0xFF, 0x56, 0x30, 0xFF, 0xF6, 0x50, 0xFF, 0x2E, 0x38, 0xFF, 0x8C, 0x38, 0xFF, 0x16, 0x51, 0xFF, 0x8B, 0x40, 0xFF, 0x32, 0x51, 0xFF, 0xCB, 0x40, 0xFF, 0x8D, 0x40, 0xFF, 0x6F, 0x38, 0xFF, 0xAF, 0x40, 0xFF, 0xCD, 0x48, 0xFF, 0xF8, 0x70, 0xFF, 0xF0, 0x58, 0xFF, 0xEB, 0x48, 0xFF, 0x6D, 0x59, 0xFF, 0xB3, 0x9A, 0xFF, 0x93, 0x79, 0xFF, 0x90, 0x79, 0xFF, 0x8D, 0x69, 0xFF, 0x92, 0xAB, 0xFF, 0x94, 0x79, 0xFF, 0x0B, 0x82, 0xFF, 0x32, 0x9A, 0xFF, 0xED, 0xA2, 0xFF, 0x34, 0xAB, 0xFF, 0x6F, 0x8A, 0xFF,
-    0x2E, 0xAB, 0xFF, 0x50, 0xB2, 0xFF, 0x30, 0x9A, 0xFF, 0x54, 0xE5, 0xFF, 0xAA, 0x81, 0xFF, 0x08, 0xB3, 0xFF, 0xD4, 0xF3, 0xFF, 0x2A, 0x9A, 0xFF, 0x0A, 0x92, 0xFF, 0x08, 0x9A, 0xFF, 0xD2, 0xFD, 0xFF, 0xFA, 0xFF, 0xFF, 0x09, 0xDB, 0xFF, 0xAA, 0xC2, 0xFF, 0x8F, 0xF4, 0xFF, 0x8C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF1, 0xF6, 0xFF, 0xCD, 0xFC, 0xFF, 0xCC, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xF5, 0xFF, 0x6B, 0xED, 0xFF, 0x8B, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0x2B, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x88, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0xE3, 0xFF, 0x6B, 0xE4, 0xFF, 0x6F, 0xFE, 0xFF, 0xC8, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0xCB, 0xFF, 0x08, 0xCB, 0xFF, 0x6A, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0xCB, 0xFF, 0xAA, 0xD3, 0xFF, 0x0B, 0xE4, 0xFF, 0x95, 0xFF, 0xFF, 0x6C, 0x30, 0xFF, 0xEA, 0x38, 0xFF, 0xAC, 0x38, 0xFF, 0x12, 0x51, 0xFF, 0x2E, 0x51, 0xFF, 0x6B, 0x30, 0xFF, 0x0C, 0x41, 0xFF, 0x2E, 0x30, 0xFF, 0x39, 0x82, 0xFF, 0x73, 0x61, 0xFF, 0x6C, 0x38, 0xFF, 0xD5, 0x7A, 0xFF, 0x2A, 0x30, 0xFF, 0xF9, 0x81, 0xFF, 0x54, 0x61, 0xFF, 0xD8, 0x50, 0xFF,
-    0xCD, 0x48, 0xFF, 0xEF, 0x68, 0xFF, 0xB8, 0x58, 0xFF, 0xF5, 0x58, 0xFF, 0xAE, 0x69, 0xFF, 0xAC, 0x71, 0xFF, 0xF3, 0x89, 0xFF, 0xF9, 0x68, 0xFF, 0xF0, 0x79, 0xFF, 0xF1, 0x9A, 0xFF, 0xED, 0x60, 0xFF, 0x4F, 0x92, 0xFF, 0xB1, 0x81, 0xFF, 0x0E, 0xAB, 0xFF, 0x90, 0x9A, 0xFF, 0xAB, 0x79, 0xFF, 0xEF, 0xB2, 0xFF, 0xB2, 0xB2, 0xFF, 0xF1, 0x91, 0xFF, 0x10, 0xC4, 0xFF, 0x89, 0x81, 0xFF, 0x07, 0xA2, 0xFF, 0xF1, 0xE3, 0xFF, 0xEB, 0x91, 0xFF, 0xE9, 0x91, 0xFF, 0x4A, 0xA2, 0xFF, 0xD1, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xCA, 0xFF, 0x8A, 0xC2, 0xFF, 0xEE, 0xFB, 0xFF, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xFD, 0xFF, 0xAE, 0xFD, 0xFF, 0xAD, 0xFC, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0xFE, 0xFF, 0xAA, 0xEC, 0xFF, 0xEB, 0xED, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xFE, 0xFF, 0xF0, 0xFE, 0xFF, 0x2B, 0xF6, 0xFF, 0xFE, 0xFF, 0xFF, 0xED, 0xE5, 0xFF, 0xC9, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xFC, 0xFF, 0xF6, 0xFF, 0xFF, 0x6F, 0xFD, 0xFF, 0xEB, 0xF3, 0xFF, 0x8D, 0xED, 0xFF, 0xEB, 0xEB, 0xFF, 0x6F, 0xFD, 0xFF, 0x09, 0xCB, 0xFF, 0x4A, 0xD3, 0xFF, 0x29, 0xCB, 0xFF, 0x6A, 0xCB, 0xFF, 0x2C, 0xEC, 0xFF, 0xAD, 0xF4, 0xFF, 0x0B, 0xEC, 0xFF,
-    0xD3, 0x61, 0xFF, 0x6C, 0x30, 0xFF, 0x4A, 0x30, 0xFF, 0x92, 0x72, 0xFF, 0x4D, 0x49, 0xFF, 0x6C, 0x38, 0xFF, 0x72, 0x59, 0xFF, 0x6E, 0x38, 0xFF, 0x8D, 0x40, 0xFF, 0xB1, 0x40, 0xFF, 0x4C, 0x30, 0xFF, 0x0E, 0x49, 0xFF, 0xB3, 0x48, 0xFF, 0xCC, 0x48, 0xFF, 0x70, 0x38, 0xFF, 0xF3, 0x50, 0xFF, 0x37, 0x40, 0xFF, 0xF4, 0x92, 0xFF, 0x8D, 0x48, 0xFF, 0xFC, 0x60, 0xFF, 0xB1, 0x50, 0xFF, 0x2B, 0x69, 0xFF, 0xD2, 0xA2, 0xFF, 0xAF, 0x58, 0xFF, 0x95, 0x79, 0xFF, 0x2A, 0x61, 0xFF, 0xEE, 0x60, 0xFF, 0x33, 0xAB, 0xFF, 0x8C, 0x71, 0xFF, 0x0D, 0xA2, 0xFF, 0x4A, 0x79, 0xFF, 0x6F, 0x79, 0xFF, 0xEF, 0xB2, 0xFF, 0x6B, 0x81, 0xFF, 0xCC, 0x81, 0xFF, 0xAC, 0x9A, 0xFF, 0x8B, 0x81, 0xFF, 0x0A, 0xCB, 0xFF, 0x52, 0xD3, 0xFF, 0xC9, 0x91, 0xFF, 0xEA, 0x99, 0xFF, 0x0A, 0xA2, 0xFF, 0x73, 0xFD, 0xFF, 0xB2, 0xF4, 0xFF, 0x69, 0xCA, 0xFF, 0x6B, 0xCA, 0xFF, 0xCA, 0xDA, 0xFF, 0xF8, 0xFF, 0xFF, 0xCA, 0xE3, 0xFF, 0x13, 0xFF, 0xFF, 0x0C, 0xF4, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xED, 0xFF, 0x2A, 0xEC, 0xFF, 0xCC, 0xF5, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xF6, 0xFF, 0x6E, 0xFE, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x8A, 0xEC, 0xFF,
-    0x49, 0xE4, 0xFF, 0x0B, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0xE3, 0xFF, 0xEA, 0xEB, 0xFF, 0x09, 0xCB, 0xFF, 0xB4, 0xFF, 0xFF, 0x8D, 0xFC, 0xFF, 0xC9, 0xC2, 0xFF, 0x2A, 0xCB, 0xFF, 0x08, 0xCB, 0xFF, 0x8B, 0xE3, 0xFF, 0x8D, 0xFC, 0xFF, 0x2C, 0xEC, 0xFF, 0x0C, 0xF4, 0xFF, 0xCD, 0xFC, 0xFF, 0x6C, 0x30, 0xFF, 0xAB, 0x38, 0xFF, 0x8C, 0x38, 0xFF, 0x90, 0x38, 0xFF, 0x8C, 0x38, 0xFF, 0x6B, 0x30, 0xFF, 0x4F, 0x51, 0xFF, 0x4F, 0x30, 0xFF, 0x51, 0x51, 0xFF, 0x6B, 0x38, 0xFF, 0x33, 0x38, 0xFF, 0x6F, 0x40, 0xFF, 0x14, 0x51, 0xFF, 0x8C, 0x40, 0xFF, 0x59, 0x40, 0xFF, 0x6E, 0x38, 0xFF, 0x17, 0x59, 0xFF, 0xCD, 0x50, 0xFF, 0xAD, 0x50, 0xFF, 0x6D, 0x48, 0xFF, 0x6D, 0x40, 0xFF, 0x30, 0x79, 0xFF, 0x2C, 0x61, 0xFF, 0xAD, 0x58, 0xFF, 0x0C, 0x69, 0xFF, 0x52, 0x71, 0xFF, 0xAD, 0x58, 0xFF, 0x8D, 0x79, 0xFF, 0x30, 0x69, 0xFF, 0xEB, 0x80, 0xFF, 0x4A, 0x79, 0xFF, 0x4C, 0x71, 0xFF, 0xAA, 0x99, 0xFF, 0x8B, 0x89, 0xFF, 0xB2, 0xB2, 0xFF, 0xE9, 0x89, 0xFF, 0x6C, 0x81, 0xFF, 0x70, 0xF4, 0xFF, 0x73, 0xCB, 0xFF, 0xA9, 0x91, 0xFF, 0x0B, 0xA2, 0xFF, 0xAD, 0xBA, 0xFF, 0x53, 0xFD, 0xFF, 0x49, 0xC2, 0xFF, 0x6D, 0xEB, 0xFF, 0x0D, 0xDB, 0xFF, 0xAA, 0xD2, 0xFF, 0xAD, 0xE4, 0xFF,
-    0x0B, 0xE4, 0xFF, 0x74, 0xFF, 0xFF, 0x8D, 0xF4, 0xFF, 0x96, 0xFF, 0xFF, 0x2F, 0xF6, 0xFF, 0xCD, 0xF5, 0xFF, 0x2A, 0xF4, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xED, 0xFF, 0x6C, 0xFD, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xF6, 0xFF, 0xEF, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x8B, 0xF4, 0xFF, 0x49, 0xE4, 0xFF, 0xCE, 0xFD, 0xFF, 0xA7, 0xC2, 0xFF, 0xC9, 0xC2, 0xFF, 0x4C, 0xEC, 0xFF, 0x29, 0xD3, 0xFF, 0x6A, 0xE3, 0xFF, 0xEA, 0xEB, 0xFF, 0x8B, 0xDB, 0xFF, 0x0B, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFE, 0xFF, 0x0E, 0xFD, 0xFF, 0x4F, 0x28, 0xFF, 0xAC, 0x38, 0xFF, 0x4B, 0x30, 0xFF, 0x8D, 0x38, 0xFF, 0x6C, 0x30, 0xFF, 0x75, 0x38, 0xFF, 0x73, 0x7A, 0xFF, 0x4C, 0x30, 0xFF, 0xAD, 0x40, 0xFF, 0x98, 0x48, 0xFF, 0x6F, 0x40, 0xFF, 0x6D, 0x38, 0xFF, 0x51, 0x38, 0xFF, 0x13, 0x51, 0xFF, 0x10, 0x28, 0xFF, 0x74, 0x38, 0xFF, 0xF0, 0x50, 0xFF, 0xF2, 0x50, 0xFF, 0xD6, 0x79, 0xFF, 0x2E, 0x38, 0xFF, 0x4D, 0x48, 0xFF, 0xEE, 0x60, 0xFF, 0xEE, 0x68, 0xFF, 0xD1, 0x58, 0xFF, 0xAC, 0x58, 0xFF, 0x50, 0x71, 0xFF, 0xF3, 0x68, 0xFF, 0xEB, 0x70, 0xFF, 0x0D, 0x69, 0xFF, 0x2C, 0x79, 0xFF, 0x90, 0x89, 0xFF, 0xAC, 0x81, 0xFF,
-    0x29, 0x89, 0xFF, 0x8E, 0xB2, 0xFF, 0xF2, 0x99, 0xFF, 0x6A, 0xA2, 0xFF, 0x6C, 0x81, 0xFF, 0x94, 0xF5, 0xFF, 0x6D, 0x91, 0xFF, 0x89, 0x91, 0xFF, 0xAB, 0x99, 0xFF, 0xCA, 0xA1, 0xFF, 0x70, 0xF4, 0xFF, 0xCB, 0xDA, 0xFF, 0x28, 0xC2, 0xFF, 0x4A, 0xC2, 0xFF, 0xAF, 0xFB, 0xFF, 0x0E, 0xF4, 0xFF, 0x2C, 0xF4, 0xFF, 0xF4, 0xFF, 0xFF, 0x8D, 0xEC, 0xFF, 0x2D, 0xFC, 0xFF, 0x4E, 0xFD, 0xFF, 0x0C, 0xED, 0xFF, 0xFE, 0xFF, 0xFF, 0xCD, 0xEE, 0xFF, 0x8B, 0xF4, 0xFF, 0xCD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xFE, 0xFF, 0xFF, 0xAE, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0x0B, 0xF5, 0xFF, 0x2B, 0xED, 0xFF, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0xE4, 0xFF, 0x2D, 0xFD, 0xFF, 0xEA, 0xCA, 0xFF, 0xAF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xE3, 0xFF, 0x4A, 0xDB, 0xFF, 0x6B, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xFD, 0xFF, 0xCC, 0xEB, 0xFF, 0xEC, 0xEB, 0xFF, 0x6E, 0xF6, 0xFF, 0xB3, 0x50, 0xFF, 0x14, 0x59, 0xFF, 0x30, 0x30, 0xFF, 0x6E, 0x30, 0xFF, 0x8E, 0x38, 0xFF, 0x6D, 0x40, 0xFF, 0x14, 0x69, 0xFF, 0x0D, 0x28, 0xFF, 0xF2, 0x50, 0xFF, 0x12, 0x6A, 0xFF, 0x2C, 0x30, 0xFF, 0x55, 0x69, 0xFF, 0x91, 0x48, 0xFF, 0x0F, 0x59, 0xFF, 0x50, 0x38, 0xFF, 0x1C, 0x40, 0xFF,
-    0x35, 0x79, 0xFF, 0x35, 0x79, 0xFF, 0xB6, 0x9A, 0xFF, 0x3C, 0x50, 0xFF, 0x90, 0x50, 0xFF, 0xAE, 0x58, 0xFF, 0x96, 0x91, 0xFF, 0xB6, 0x68, 0xFF, 0xAD, 0x58, 0xFF, 0x72, 0x92, 0xFF, 0xD0, 0x60, 0xFF, 0x11, 0x81, 0xFF, 0x55, 0xBA, 0xFF, 0x0E, 0x79, 0xFF, 0xCA, 0x78, 0xFF, 0x6E, 0x81, 0xFF, 0x6D, 0x99, 0xFF, 0x54, 0xD2, 0xFF, 0xB1, 0xA1, 0xFF, 0x8B, 0x99, 0xFF, 0x4D, 0x89, 0xFF, 0xF2, 0xFB, 0xFF, 0x38, 0xFE, 0xFF, 0x6C, 0xA1, 0xFF, 0xAB, 0x99, 0xFF, 0x8B, 0xA1, 0xFF, 0x4E, 0xEB, 0xFF, 0xCD, 0xDB, 0xFF, 0xAF, 0xE3, 0xFF, 0x2E, 0xEB, 0xFF, 0x2E, 0xF3, 0xFF, 0x8D, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0xFE, 0xFF, 0xED, 0xFB, 0xFF, 0x8F, 0xFD, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xF5, 0xFF, 0xAD, 0xF4, 0xFF, 0xAE, 0xFD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEE, 0xF5, 0xFF, 0x53, 0xFF, 0xFF, 0x6E, 0xFE, 0xFF, 0x72, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFC, 0xFF, 0xCB, 0xEB, 0xFF, 0xAF, 0xF5, 0xFF, 0x74, 0xFF, 0xFF, 0x52, 0xFE, 0xFF, 0x4F, 0xFC, 0xFF, 0x0A, 0xDB, 0xFF, 0x6F, 0xF5, 0xFF, 0x2D, 0xF4, 0xFF, 0x6B, 0xDB, 0xFF, 0xAC, 0xEB, 0xFF, 0xAC, 0xE3, 0xFF, 0xCC, 0xEB, 0xFF, 0x0D, 0xF4, 0xFF,
-    0x71, 0x38, 0xFF, 0x50, 0x38, 0xFF, 0x11, 0x30, 0xFF, 0xDE, 0x68, 0xFF, 0x0E, 0x30, 0xFF, 0x36, 0xAB, 0xFF, 0x8E, 0x38, 0xFF, 0x70, 0x38, 0xFF, 0xFE, 0x68, 0xFF, 0xF7, 0x58, 0xFF, 0x77, 0x61, 0xFF, 0x4D, 0x38, 0xFF, 0x70, 0x40, 0xFF, 0x7B, 0x89, 0xFF, 0x37, 0x69, 0xFF, 0x31, 0x38, 0xFF, 0x18, 0x38, 0xFF, 0x3C, 0x48, 0xFF, 0x7D, 0x50, 0xFF, 0x17, 0x71, 0xFF, 0x39, 0x50, 0xFF, 0x72, 0x69, 0xFF, 0x32, 0x71, 0xFF, 0xFD, 0x68, 0xFF, 0x36, 0x79, 0xFF, 0xEE, 0x68, 0xFF, 0x10, 0x71, 0xFF, 0xB0, 0x70, 0xFF, 0x19, 0x91, 0xFF, 0xCF, 0x78, 0xFF, 0xEB, 0x78, 0xFF, 0x54, 0x89, 0xFF, 0xAF, 0x99, 0xFF, 0xF8, 0xB1, 0xFF, 0x6D, 0x89, 0xFF, 0x6E, 0xC2, 0xFF, 0x4D, 0x89, 0xFF, 0xEB, 0xC9, 0xFF, 0x55, 0xEB, 0xFF, 0x8D, 0xA1, 0xFF, 0x8A, 0x99, 0xFF, 0xAA, 0xA1, 0xFF, 0xCD, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xCA, 0xFF, 0x4E, 0xDA, 0xFF, 0x8C, 0xEA, 0xFF, 0xF1, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xCD, 0xF3, 0xFF, 0xEE, 0xFB, 0xFF, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0xFE, 0xFF, 0x8D, 0xF4, 0xFF, 0xEF, 0xF5, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0xFD, 0xFF, 0x6E, 0xFD, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xEE, 0xFF,
-    0xCC, 0xF4, 0xFF, 0x2C, 0xF4, 0xFF, 0xF6, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xEB, 0xEB, 0xFF, 0xEB, 0xDA, 0xFF, 0xCA, 0xCA, 0xFF, 0x0A, 0xE3, 0xFF, 0x50, 0xFD, 0xFF, 0x2C, 0xDB, 0xFF, 0xEA, 0xDA, 0xFF, 0x2B, 0xD3, 0xFF, 0xAC, 0xEB, 0xFF, 0xAF, 0xFC, 0xFF, 0x6E, 0xF4, 0xFF, 0xAC, 0xEB, 0xFF, 0x12, 0x20, 0xFF, 0x50, 0x38, 0xFF, 0xF8, 0x48, 0xFF, 0x4F, 0x30, 0xFF, 0x72, 0x38, 0xFF, 0x54, 0x40, 0xFF, 0xF5, 0x50, 0xFF, 0x13, 0x51, 0xFF, 0x71, 0x40, 0xFF, 0x0E, 0x30, 0xFF, 0x8F, 0x40, 0xFF, 0x18, 0x61, 0xFF, 0x15, 0x38, 0xFF, 0xB6, 0x9A, 0xFF, 0x10, 0x30, 0xFF, 0x9F, 0xAC, 0xFF, 0x18, 0x8A, 0xFF, 0x36, 0x48, 0xFF, 0x7E, 0x6B, 0xFF, 0xBC, 0x60, 0xFF, 0x39, 0x71, 0xFF, 0x74, 0x58, 0xFF, 0x74, 0x58, 0xFF, 0xB0, 0x58, 0xFF, 0x31, 0x58, 0xFF, 0xB5, 0x70, 0xFF, 0x10, 0x71, 0xFF, 0x8E, 0x68, 0xFF, 0x75, 0xAA, 0xFF, 0x95, 0x99, 0xFF, 0xF1, 0xA1, 0xFF, 0x2E, 0x81, 0xFF, 0x6F, 0x91, 0xFF, 0xB0, 0xA1, 0xFF, 0x0D, 0x89, 0xFF, 0x2E, 0xBA, 0xFF, 0x4D, 0x91, 0xFF, 0xCC, 0xDA, 0xFF, 0x36, 0xE3, 0xFF, 0x6E, 0xA1, 0xFF, 0x6A, 0x99, 0xFF, 0x8A, 0xA1, 0xFF, 0x6F, 0xEB, 0xFF, 0xF4, 0xFB, 0xFF, 0xCB, 0xC1, 0xFF, 0xCB, 0xC9, 0xFF, 0x6C, 0xE2, 0xFF, 0x38, 0xFF, 0xFF,
-    0x6E, 0xEB, 0xFF, 0x13, 0xFE, 0xFF, 0x6D, 0xF3, 0xFF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xEC, 0xFF, 0x0E, 0xF4, 0xFF, 0x0B, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xFE, 0xFF, 0xED, 0xEC, 0xFF, 0x0D, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x6C, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF6, 0xFF, 0x0E, 0xFD, 0xFF, 0x2B, 0xEC, 0xFF, 0x2E, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xFE, 0xFF, 0x6C, 0xEB, 0xFF, 0x14, 0xFE, 0xFF, 0x6F, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0x6B, 0xEB, 0xFF, 0xAC, 0xF3, 0xFF, 0xEF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x52, 0x30, 0xFF, 0x2E, 0x30, 0xFF, 0x0F, 0x30, 0xFF, 0x32, 0x28, 0xFF, 0x17, 0x18, 0xFF, 0x30, 0x38, 0xFF, 0x51, 0x30, 0xFF, 0xF2, 0x50, 0xFF, 0x59, 0x38, 0xFF, 0xF9, 0x50, 0xFF, 0x8F, 0x48, 0xFF, 0x13, 0x59, 0xFF, 0x58, 0x40, 0xFF, 0xD9, 0x81, 0xFF, 0x34, 0x38, 0xFF, 0x12, 0x38, 0xFF, 0x1A, 0xC3, 0xFF, 0x13, 0x38, 0xFF, 0x38, 0x69, 0xFF, 0x5A, 0x58, 0xFF, 0x35, 0x50, 0xFF, 0xBB, 0x58, 0xFF, 0xD6, 0x68, 0xFF, 0x33, 0x58, 0xFF, 0x8E, 0x68, 0xFF, 0x72, 0x68, 0xFF, 0xF7, 0x78, 0xFF, 0x8F, 0x68, 0xFF, 0x6E, 0x68, 0xFF, 0x11, 0x81, 0xFF, 0xB4, 0xA9, 0xFF, 0x4F, 0x89, 0xFF,
-    0xD0, 0x90, 0xFF, 0xF0, 0xB1, 0xFF, 0xF5, 0xB1, 0xFF, 0x51, 0xC2, 0xFF, 0x2E, 0x91, 0xFF, 0xAB, 0xCA, 0xFF, 0xD3, 0xB9, 0xFF, 0x4B, 0x99, 0xFF, 0x6B, 0xA1, 0xFF, 0x4B, 0xA1, 0xFF, 0x2E, 0xDB, 0xFF, 0xF0, 0xEA, 0xFF, 0x0D, 0xD2, 0xFF, 0xCC, 0xC9, 0xFF, 0xB0, 0xEA, 0xFF, 0x13, 0xFD, 0xFF, 0x0E, 0xF3, 0xFF, 0xD3, 0xFD, 0xFF, 0x0E, 0xE3, 0xFF, 0x8F, 0xF3, 0xFF, 0xB3, 0xFD, 0xFF, 0xAE, 0xEC, 0xFF, 0x30, 0xEC, 0xFF, 0xEE, 0xF4, 0xFF, 0x6D, 0xEB, 0xFF, 0x6E, 0xFC, 0xFF, 0x51, 0xFD, 0xFF, 0xF9, 0xFF, 0xFF, 0x6C, 0xEC, 0xFF, 0x0E, 0xFD, 0xFF, 0xF9, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x0E, 0xFE, 0xFF, 0x4B, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x0E, 0xFE, 0xFF, 0xEB, 0xEA, 0xFF, 0x2C, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF5, 0xFF, 0x8D, 0xF3, 0xFF, 0x0B, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0xEB, 0xFF, 0x8D, 0xF3, 0xFF, 0x4B, 0xE3, 0xFF, 0x2E, 0xFC, 0xFF, 0x10, 0x30, 0xFF, 0xD4, 0x71, 0xFF, 0x16, 0x30, 0xFF, 0x31, 0x30, 0xFF, 0x30, 0x30, 0xFF, 0x2D, 0x40, 0xFF, 0x50, 0x38, 0xFF, 0x32, 0x61, 0xFF, 0x1B, 0x38, 0xFF, 0x72, 0x40, 0xFF, 0xD2, 0x50, 0xFF, 0x71, 0x40, 0xFF, 0x3C, 0x71, 0xFF, 0x91, 0x68, 0xFF, 0x14, 0x30, 0xFF, 0x5B, 0x40, 0xFF,
-    0x75, 0x60, 0xFF, 0x11, 0x40, 0xFF, 0x35, 0x50, 0xFF, 0x3B, 0x50, 0xFF, 0x38, 0x58, 0xFF, 0x31, 0x50, 0xFF, 0x12, 0x50, 0xFF, 0x1B, 0x68, 0xFF, 0x93, 0x89, 0xFF, 0x50, 0x60, 0xFF, 0xF2, 0x78, 0xFF, 0x19, 0x89, 0xFF, 0xB2, 0xB1, 0xFF, 0x8F, 0x78, 0xFF, 0x15, 0xE3, 0xFF, 0x12, 0x91, 0xFF, 0x8D, 0x88, 0xFF, 0xEE, 0xA0, 0xFF, 0x33, 0x99, 0xFF, 0xB2, 0xE2, 0xFF, 0xEE, 0x90, 0xFF, 0xED, 0xD2, 0xFF, 0x52, 0xB1, 0xFF, 0x6E, 0xB1, 0xFF, 0x6C, 0xA1, 0xFF, 0x2C, 0xA1, 0xFF, 0x8D, 0xDA, 0xFF, 0x70, 0xEA, 0xFF, 0x0C, 0xC2, 0xFF, 0xCD, 0xD1, 0xFF, 0x6F, 0xE2, 0xFF, 0x11, 0xFC, 0xFF, 0x4D, 0xDA, 0xFF, 0x31, 0xF4, 0xFF, 0x90, 0xFB, 0xFF, 0x90, 0xFB, 0xFF, 0x71, 0xFC, 0xFF, 0x10, 0xE4, 0xFF, 0xEE, 0xF3, 0xFF, 0xED, 0xEB, 0xFF, 0x0F, 0xFC, 0xFF, 0x2F, 0xFC, 0xFF, 0xAF, 0xFC, 0xFF, 0xAE, 0xF4, 0xFF, 0xAF, 0xF4, 0xFF, 0x8F, 0xF4, 0xFF, 0x8E, 0xF4, 0xFF, 0xCF, 0xFC, 0xFF, 0xB4, 0xF7, 0xFF, 0xEE, 0xEC, 0xFF, 0xAD, 0xFB, 0xFF, 0x6D, 0xF3, 0xFF, 0xEC, 0xF3, 0xFF, 0xAB, 0xDA, 0xFF, 0xAA, 0xDA, 0xFF, 0xAB, 0xE2, 0xFF, 0x8A, 0xD2, 0xFF, 0xCB, 0xDA, 0xFF, 0xCB, 0xDA, 0xFF, 0x0C, 0xE3, 0xFF, 0x4D, 0xEB, 0xFF, 0x6D, 0xEB, 0xFF, 0x8E, 0xF3, 0xFF, 0x8D, 0xF3, 0xFF,
-    0x1F, 0x5D, 0xFF, 0xD7, 0x50, 0xFF, 0x1B, 0x20, 0xFF, 0x15, 0x28, 0xFF, 0x19, 0x00, 0xFF, 0x11, 0x38, 0xFF, 0x54, 0x40, 0xFF, 0xB1, 0x60, 0xFF, 0x31, 0x40, 0xFF, 0x78, 0x61, 0xFF, 0x37, 0x40, 0xFF, 0x57, 0x71, 0xFF, 0x9C, 0xA2, 0xFF, 0x12, 0x48, 0xFF, 0xFB, 0x2A, 0xFF, 0x1D, 0x20, 0xFF, 0x15, 0x40, 0xFF, 0x39, 0x48, 0xFF, 0xFF, 0xF7, 0xFF, 0x99, 0x68, 0xFF, 0x77, 0x60, 0xFF, 0x5F, 0x60, 0xFF, 0x16, 0x50, 0xFF, 0x12, 0x60, 0xFF, 0xD8, 0xA9, 0xFF, 0x3C, 0x68, 0xFF, 0xB1, 0x70, 0xFF, 0x10, 0x98, 0xFF, 0x7D, 0xF3, 0xFF, 0x73, 0xA1, 0xFF, 0x57, 0xEB, 0xFF, 0xD2, 0x90, 0xFF, 0xAF, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0xB1, 0xFF, 0x73, 0xDA, 0xFF, 0xCE, 0x90, 0xFF, 0x91, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xE9, 0xFF, 0x2D, 0xA9, 0xFF, 0x2D, 0xA1, 0xFF, 0xCE, 0xD9, 0xFF, 0x7D, 0xF2, 0xFF, 0x1E, 0xFF, 0xFF, 0xF0, 0xE1, 0xFF, 0x2D, 0xE2, 0xFF, 0xD0, 0xEA, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF3, 0xFF, 0x92, 0xFB, 0xFF, 0x12, 0xFC, 0xFF, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xFD, 0xFF, 0x6E, 0xF3, 0xFF, 0xF1, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xEB, 0xFF, 0x6F, 0xFD, 0xFF, 0x8F, 0xED, 0xFF,
-    0xDC, 0xFF, 0xFF, 0x96, 0xF6, 0xFF, 0x2D, 0xEB, 0xFF, 0x6D, 0xFB, 0xFF, 0x15, 0xFF, 0xFF, 0xB6, 0xFE, 0xFF, 0x79, 0xFF, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xE2, 0xFF, 0xB5, 0xFF, 0xFF, 0x33, 0xFD, 0xFF, 0xD4, 0xFD, 0xFF, 0xD0, 0xF3, 0xFF, 0x2D, 0xEB, 0xFF, 0x6E, 0xF3, 0xFF, 0xAE, 0xF3, 0xFF, 0x58, 0x30, 0xFF, 0x1B, 0x00, 0xFF, 0x13, 0x28, 0xFF, 0x5B, 0x39, 0xFF, 0xBF, 0x5B, 0xFF, 0xF9, 0x48, 0xFF, 0x1F, 0x4B, 0xFF, 0x53, 0x38, 0xFF, 0x7A, 0x48, 0xFF, 0x75, 0x40, 0xFF, 0xFC, 0x60, 0xFF, 0xD9, 0x81, 0xFF, 0x15, 0x48, 0xFF, 0xD5, 0x48, 0xFF, 0x1B, 0x59, 0xFF, 0x19, 0x28, 0xFF, 0x9A, 0x49, 0xFF, 0x78, 0x58, 0xFF, 0x3B, 0x38, 0xFF, 0x3F, 0x58, 0xFF, 0x99, 0x48, 0xFF, 0x59, 0x60, 0xFF, 0x18, 0x48, 0xFF, 0x7D, 0x81, 0xFF, 0xD6, 0x98, 0xFF, 0x13, 0x60, 0xFF, 0x7E, 0x70, 0xFF, 0x12, 0x80, 0xFF, 0xDA, 0xB0, 0xFF, 0x5B, 0xCA, 0xFF, 0x71, 0xA1, 0xFF, 0x33, 0x99, 0xFF, 0x32, 0xA8, 0xFF, 0xF9, 0xE0, 0xFF, 0x32, 0xA9, 0xFF, 0x11, 0xA1, 0xFF, 0xAF, 0x90, 0xFF, 0xB8, 0xFA, 0xFF, 0x3D, 0xF2, 0xFF, 0x11, 0xC9, 0xFF, 0x2E, 0xA9, 0xFF, 0x2F, 0xB1, 0xFF, 0x91, 0xE1, 0xFF, 0xBF, 0xFF, 0xFF, 0xB0, 0xE9, 0xFF, 0xB4, 0xF3, 0xFF, 0xEF, 0xE1, 0xFF, 0x3B, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x93, 0xF3, 0xFF, 0xD1, 0xEA, 0xFF, 0x51, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEB, 0xFF, 0xD0, 0xF3, 0xFF, 0xF6, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x6F, 0xEC, 0xFF, 0x91, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xB1, 0xF4, 0xFF, 0x6D, 0xF4, 0xFF, 0xEE, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0x2E, 0xF4, 0xFF, 0xB0, 0xF5, 0xFF, 0x95, 0xFF, 0xFF, 0x4B, 0xE2, 0xFF, 0x0D, 0xEC, 0xFF, 0x0D, 0xF3, 0xFF, 0x93, 0xF6, 0xFF, 0xEF, 0xFB, 0xFF, 0x0F, 0xFC, 0xFF, 0xEF, 0xFB, 0xFF, 0x70, 0xED, 0xFF, 0x2F, 0xFC, 0xFF, 0x10, 0x28, 0xFF, 0x32, 0x30, 0xFF, 0x79, 0x49, 0xFF, 0x12, 0x28, 0xFF, 0x9A, 0x40, 0xFF, 0x72, 0x40, 0xFF, 0x33, 0x30, 0xFF, 0x56, 0x61, 0xFF, 0xDA, 0x40, 0xFF, 0x34, 0x30, 0xFF, 0x12, 0x30, 0xFF, 0xF8, 0x50, 0xFF, 0x76, 0x58, 0xFF, 0x15, 0x38, 0xFF, 0x16, 0x30, 0xFF, 0x17, 0x38, 0xFF, 0x7E, 0x71, 0xFF, 0x3F, 0x71, 0xFF, 0x18, 0x40, 0xFF, 0x16, 0x48, 0xFF, 0x9C, 0x60, 0xFF, 0x9D, 0x68, 0xFF, 0x9C, 0x68, 0xFF, 0x57, 0x89, 0xFF, 0x73, 0x80, 0xFF, 0x1C, 0x89, 0xFF, 0x16, 0x68, 0xFF, 0x34, 0x99, 0xFF, 0x71, 0x90, 0xFF, 0x51, 0x80, 0xFF, 0xD5, 0xA8, 0xFF, 0xF1, 0x90, 0xFF,
-    0x76, 0xEA, 0xFF, 0x8E, 0x90, 0xFF, 0x96, 0xB9, 0xFF, 0xEF, 0xA8, 0xFF, 0xB0, 0x90, 0xFF, 0x98, 0xF3, 0xFF, 0x14, 0xB9, 0xFF, 0x93, 0xC1, 0xFF, 0x0E, 0xA1, 0xFF, 0x0F, 0xA9, 0xFF, 0x73, 0xE2, 0xFF, 0xD5, 0xFA, 0xFF, 0x14, 0xF3, 0xFF, 0x6F, 0xC1, 0xFF, 0x33, 0xF2, 0xFF, 0xD9, 0xFC, 0xFF, 0x92, 0xFA, 0xFF, 0x51, 0xE3, 0xFF, 0x91, 0xEA, 0xFF, 0x12, 0xF3, 0xFF, 0x33, 0xF4, 0xFF, 0x2F, 0xEB, 0xFF, 0x51, 0xF3, 0xFF, 0x95, 0xFC, 0xFF, 0xCE, 0xE2, 0xFF, 0xF0, 0xF3, 0xFF, 0x92, 0xFC, 0xFF, 0xF8, 0xFF, 0xFF, 0xAD, 0xEB, 0xFF, 0xCC, 0xE3, 0xFF, 0xD0, 0xED, 0xFF, 0x95, 0xF7, 0xFF, 0x71, 0xF5, 0xFF, 0xCD, 0xEB, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xFD, 0xFF, 0x8C, 0xF2, 0xFF, 0x6C, 0xEA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x6E, 0xFB, 0xFF, 0xED, 0xEA, 0xFF, 0xF1, 0xFE, 0xFF, 0x8F, 0xF3, 0xFF, 0x6E, 0xF3, 0xFF, 0x6F, 0xF3, 0xFF, 0x6E, 0xF3, 0xFF, 0x18, 0x28, 0xFF, 0x7E, 0x4E, 0xFF, 0xBC, 0x40, 0xFF, 0x16, 0x20, 0xFF, 0x37, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x20, 0xFF, 0x15, 0x48, 0xFF, 0x5B, 0x48, 0xFF, 0x1B, 0x20, 0xFF, 0x17, 0x30, 0xFF, 0x17, 0x30, 0xFF, 0x3D, 0x83, 0xFF, 0xDE, 0x4B, 0xFF, 0x1E, 0x08, 0xFF, 0x5D, 0x20, 0xFF,
-    0xDC, 0x63, 0xFF, 0xFF, 0xEF, 0xFF, 0x7E, 0x48, 0xFF, 0x9D, 0x50, 0xFF, 0x3F, 0x61, 0xFF, 0x19, 0x48, 0xFF, 0x1C, 0x50, 0xFF, 0x38, 0x80, 0xFF, 0x1D, 0x70, 0xFF, 0xF7, 0x80, 0xFF, 0x11, 0x68, 0xFF, 0x3A, 0x80, 0xFF, 0x78, 0x90, 0xFF, 0xB4, 0x88, 0xFF, 0x91, 0x98, 0xFF, 0xB9, 0x98, 0xFF, 0x17, 0xD2, 0xFF, 0xD1, 0xA0, 0xFF, 0xB3, 0x98, 0xFF, 0xB1, 0xA0, 0xFF, 0x8F, 0x90, 0xFF, 0x71, 0xC1, 0xFF, 0xB1, 0x98, 0xFF, 0xB0, 0xA0, 0xFF, 0xF0, 0xA8, 0xFF, 0x0F, 0xA9, 0xFF, 0xD0, 0xD9, 0xFF, 0xB1, 0xD1, 0xFF, 0xAF, 0xC9, 0xFF, 0xB2, 0xD9, 0xFF, 0xD1, 0xD9, 0xFF, 0x14, 0xFB, 0xFF, 0x72, 0xF2, 0xFF, 0xD3, 0xEA, 0xFF, 0xF3, 0xFA, 0xFF, 0x91, 0xF2, 0xFF, 0x13, 0xF3, 0xFF, 0x52, 0xF3, 0xFF, 0x70, 0xF2, 0xFF, 0x52, 0xFB, 0xFF, 0xD0, 0xF2, 0xFF, 0xCF, 0xEA, 0xFF, 0x30, 0xF3, 0xFF, 0xEF, 0xEA, 0xFF, 0x0F, 0xF3, 0xFF, 0x6C, 0xE2, 0xFF, 0x2F, 0xF3, 0xFF, 0x0F, 0xF3, 0xFF, 0x8C, 0xEA, 0xFF, 0x8D, 0xEA, 0xFF, 0xEE, 0xFA, 0xFF, 0xEE, 0xF2, 0xFF, 0xCE, 0xF2, 0xFF, 0x2C, 0xD2, 0xFF, 0x4C, 0xD2, 0xFF, 0x4C, 0xE2, 0xFF, 0x6D, 0xDA, 0xFF, 0x8D, 0xDA, 0xFF, 0x6C, 0xDA, 0xFF, 0xAD, 0xDA, 0xFF, 0xAD, 0xE2, 0xFF, 0xCD, 0xE2, 0xFF, 0x0E, 0xEB, 0xFF, 0x0F, 0xF3, 0xFF,
-    0x7F, 0xE7, 0xFF, 0x1D, 0x00, 0xFF, 0xDB, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x69, 0xFF, 0x7F, 0xDF, 0xFF, 0x1D, 0x10, 0xFF, 0x34, 0x48, 0xFF, 0xB8, 0x99, 0xFF, 0x14, 0x30, 0xFF, 0x17, 0x38, 0xFF, 0x16, 0x48, 0xFF, 0x3F, 0x79, 0xFF, 0xFF, 0x79, 0xFF, 0x5F, 0x30, 0xFF, 0x1E, 0x18, 0xFF, 0xFF, 0xAF, 0xFF, 0x3D, 0x70, 0xFF, 0x7F, 0x9B, 0xFF, 0x5E, 0xD6, 0xFF, 0xBE, 0x8D, 0xFF, 0x1B, 0x48, 0xFF, 0xBF, 0xB5, 0xFF, 0x1D, 0xC6, 0xFF, 0x7B, 0x68, 0xFF, 0x9A, 0x88, 0xFF, 0xDD, 0x98, 0xFF, 0x18, 0x70, 0xFF, 0x15, 0x70, 0xFF, 0x1A, 0x90, 0xFF, 0x15, 0x88, 0xFF, 0x16, 0x90, 0xFF, 0xFB, 0xC0, 0xFF, 0x93, 0xA8, 0xFF, 0x95, 0xA0, 0xFF, 0x76, 0xA0, 0xFF, 0x70, 0x90, 0xFF, 0x92, 0xB0, 0xFF, 0xB4, 0xB0, 0xFF, 0xD3, 0xB0, 0xFF, 0xF0, 0xA8, 0xFF, 0x13, 0xB1, 0xFF, 0x14, 0xE1, 0xFF, 0x35, 0xF2, 0xFF, 0x54, 0xE1, 0xFF, 0x10, 0xC9, 0xFF, 0xD2, 0xE1, 0xFF, 0x35, 0xF2, 0xFF, 0xB2, 0xE9, 0xFF, 0x34, 0xF2, 0xFF, 0x13, 0xF2, 0xFF, 0x8F, 0xE1, 0xFF, 0x53, 0xF2, 0xFF, 0x52, 0xF2, 0xFF, 0x10, 0xF2, 0xFF, 0x70, 0xF2, 0xFF, 0x30, 0xEA, 0xFF, 0xD1, 0xF2, 0xFF, 0xF1, 0xF2, 0xFF, 0xD0, 0xF2, 0xFF, 0x8E, 0xF2, 0xFF, 0x6E, 0xF2, 0xFF, 0xEF, 0xF2, 0xFF, 0xEF, 0xFA, 0xFF,
-    0x4D, 0xEA, 0xFF, 0x2C, 0xEA, 0xFF, 0x4D, 0xF2, 0xFF, 0x6E, 0xF2, 0xFF, 0xAF, 0xF2, 0xFF, 0x0C, 0xD2, 0xFF, 0x0C, 0xD2, 0xFF, 0x2C, 0xDA, 0xFF, 0x0C, 0xD2, 0xFF, 0x4D, 0xD2, 0xFF, 0x2C, 0xD2, 0xFF, 0x6D, 0xDA, 0xFF, 0x8D, 0xDA, 0xFF, 0xCE, 0xE2, 0xFF, 0xCE, 0xEA, 0xFF, 0xEF, 0xF2, 0xFF, 0x75, 0x81, 0xFF, 0x13, 0x28, 0xFF, 0x12, 0x28, 0xFF, 0x3B, 0x7A, 0xFF, 0x56, 0x69, 0xFF, 0x12, 0x30, 0xFF, 0x78, 0x61, 0xFF, 0x12, 0x38, 0xFF, 0x1A, 0x8A, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x38, 0xFF, 0x15, 0x28, 0xFF, 0xB8, 0x60, 0xFF, 0x39, 0x48, 0xFF, 0x18, 0x30, 0xFF, 0x18, 0x30, 0xFF, 0x38, 0x50, 0xFF, 0x18, 0x50, 0xFF, 0xBD, 0x68, 0xFF, 0x18, 0x48, 0xFF, 0xDD, 0x80, 0xFF, 0x18, 0x58, 0xFF, 0x1A, 0x48, 0xFF, 0x99, 0x80, 0xFF, 0x1A, 0x58, 0xFF, 0x15, 0x68, 0xFF, 0x39, 0x99, 0xFF, 0x15, 0x88, 0xFF, 0x97, 0xC8, 0xFF, 0x14, 0x80, 0xFF, 0x35, 0x90, 0xFF, 0x95, 0x98, 0xFF, 0xDC, 0xF9, 0xFF, 0x1D, 0xF1, 0xFF, 0x34, 0xC8, 0xFF, 0x93, 0xA8, 0xFF, 0x52, 0x98, 0xFF, 0x53, 0xC0, 0xFF, 0x17, 0xF0, 0xFF, 0x98, 0xE0, 0xFF, 0xD1, 0xB0, 0xFF, 0xD1, 0xB0, 0xFF, 0xF4, 0xE8, 0xFF, 0x9C, 0xE9, 0xFF, 0xF9, 0xF1, 0xFF, 0x13, 0xE1, 0xFF, 0x32, 0xD1, 0xFF, 0x18, 0xFA, 0xFF,
-    0x5F, 0xFC, 0xFF, 0xBF, 0xFD, 0xFF, 0xF4, 0xF1, 0xFF, 0xB1, 0xE9, 0xFF, 0x36, 0xEA, 0xFF, 0x7B, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xF2, 0xFF, 0x51, 0xEA, 0xFF, 0xB6, 0xFB, 0xFF, 0x98, 0xFD, 0xFF, 0x76, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEA, 0xFF, 0x75, 0xEE, 0xFF, 0x54, 0xED, 0xFF, 0x6E, 0xF3, 0xFF, 0x5A, 0xFE, 0xFF, 0xAE, 0xF2, 0xFF, 0xAE, 0xEA, 0xFF, 0x77, 0xFE, 0xFF, 0xAF, 0xF2, 0xFF, 0xD8, 0xFD, 0xFF, 0xEC, 0xD9, 0xFF, 0x4E, 0xE2, 0xFF, 0xB4, 0xFD, 0xFF, 0x2C, 0xE2, 0xFF, 0x3A, 0xFE, 0xFF, 0x95, 0xFC, 0xFF, 0xEF, 0xEA, 0xFF, 0xF0, 0xF2, 0xFF, 0x31, 0xF3, 0xFF, 0x14, 0x38, 0xFF, 0x97, 0x40, 0xFF, 0x15, 0x28, 0xFF, 0x97, 0x40, 0xFF, 0x34, 0x20, 0xFF, 0xF8, 0x40, 0xFF, 0xD7, 0x58, 0xFF, 0x7C, 0x69, 0xFF, 0x34, 0x50, 0xFF, 0x13, 0x30, 0xFF, 0xDB, 0x58, 0xFF, 0xB8, 0x48, 0xFF, 0xBF, 0x69, 0xFF, 0x1B, 0x59, 0xFF, 0x1D, 0x51, 0xFF, 0x5D, 0x69, 0xFF, 0xBD, 0x58, 0xFF, 0x3F, 0x6A, 0xFF, 0x1D, 0x50, 0xFF, 0xDF, 0x70, 0xFF, 0x9E, 0x68, 0xFF, 0x3E, 0x60, 0xFF, 0x7B, 0x50, 0xFF, 0xDF, 0xA0, 0xFF, 0xBD, 0x90, 0xFF, 0x18, 0x70, 0xFF, 0xF9, 0x98, 0xFF, 0x37, 0x98, 0xFF, 0xDF, 0xFF, 0xFF, 0xDC, 0xB8, 0xFF, 0x97, 0x98, 0xFF, 0x35, 0x90, 0xFF,
-    0x78, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF9, 0xFF, 0x53, 0xA8, 0xFF, 0x53, 0xA0, 0xFF, 0x56, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF0, 0xFF, 0xB2, 0xB0, 0xFF, 0x91, 0xA8, 0xFF, 0x36, 0xE9, 0xFF, 0x9F, 0xFE, 0xFF, 0x3E, 0xFA, 0xFF, 0xB2, 0xD8, 0xFF, 0x17, 0xFA, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0xE3, 0xFF, 0xF7, 0xF1, 0xFF, 0xFB, 0xF3, 0xFF, 0xDF, 0xFF, 0xFF, 0x3E, 0xFE, 0xFF, 0x58, 0xF3, 0xFF, 0x58, 0xFB, 0xFF, 0xFF, 0xFD, 0xFF, 0x3A, 0xED, 0xFF, 0x79, 0xEC, 0xFF, 0xD6, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xB4, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xEC, 0xFF, 0xED, 0xDA, 0xFF, 0xB4, 0xED, 0xFF, 0x73, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xE2, 0xFF, 0xF3, 0xFD, 0xFF, 0x2F, 0xF3, 0xFF, 0xCF, 0xEA, 0xFF, 0xD0, 0xF2, 0xFF, 0xF8, 0xED, 0xFF, 0xD0, 0xF2, 0xFF, 0xFF, 0xBF, 0xFF, 0xDF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x2A, 0xFF, 0x5B, 0x3A, 0xFF, 0x3D, 0x08, 0xFF, 0x1A, 0x18, 0xFF, 0x19, 0x28, 0xFF, 0x16, 0x40, 0xFF, 0x5E, 0x28, 0xFF, 0x3D, 0x41, 0xFF, 0x1F, 0x18, 0xFF, 0xFD, 0x54, 0xFF, 0x1B, 0x45, 0xFF, 0xFF, 0x8F, 0xFF, 0x5F, 0x9F, 0xFF,
-    0xFE, 0x6B, 0xFF, 0xFE, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0x1F, 0xB6, 0xFF, 0xFB, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDD, 0xFF, 0x1D, 0x58, 0xFF, 0x7D, 0x98, 0xFF, 0x5F, 0xFF, 0xFF, 0x3F, 0x88, 0xFF, 0x5F, 0xD1, 0xFF, 0x9F, 0xFD, 0xFF, 0x5A, 0xA0, 0xFF, 0x1A, 0x98, 0xFF, 0x5E, 0xC8, 0xFF, 0x38, 0xB0, 0xFF, 0x17, 0xA0, 0xFF, 0x39, 0xB0, 0xFF, 0x33, 0xA0, 0xFF, 0x57, 0xC0, 0xFF, 0x37, 0xC8, 0xFF, 0x76, 0xC0, 0xFF, 0x93, 0xA8, 0xFF, 0xB5, 0xB0, 0xFF, 0x3A, 0xE9, 0xFF, 0x15, 0xD9, 0xFF, 0xB6, 0xD8, 0xFF, 0x92, 0xC0, 0xFF, 0x14, 0xD1, 0xFF, 0xD8, 0xF9, 0xFF, 0x34, 0xE9, 0xFF, 0x75, 0xE9, 0xFF, 0x97, 0xF1, 0xFF, 0x32, 0xE1, 0xFF, 0x13, 0xE1, 0xFF, 0xF5, 0xF9, 0xFF, 0x72, 0xF1, 0xFF, 0xB2, 0xF1, 0xFF, 0xF2, 0xF1, 0xFF, 0x33, 0xF2, 0xFF, 0x11, 0xEA, 0xFF, 0x11, 0xF2, 0xFF, 0xF0, 0xF1, 0xFF, 0xCE, 0xF1, 0xFF, 0x10, 0xF2, 0xFF, 0xEF, 0xF1, 0xFF, 0xEF, 0xF1, 0xFF, 0x70, 0xFA, 0xFF, 0x0F, 0xF2, 0xFF, 0xEE, 0xF1, 0xFF, 0xCE, 0xE9, 0xFF, 0x8D, 0xC9, 0xFF, 0xAD, 0xC9, 0xFF, 0xAD, 0xD1, 0xFF, 0xCD, 0xC9, 0xFF, 0xEE, 0xC9, 0xFF, 0xCD, 0xC9, 0xFF, 0x0E, 0xD2, 0xFF, 0x2E, 0xD2, 0xFF, 0x4F, 0xE2, 0xFF, 0x6F, 0xE2, 0xFF, 0x6F, 0xEA, 0xFF,
-    0x13, 0x30, 0xFF, 0x15, 0x28, 0xFF, 0x13, 0x28, 0xFF, 0x14, 0x30, 0xFF, 0x35, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x38, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0x36, 0x40, 0xFF, 0x16, 0x30, 0xFF, 0xFB, 0x58, 0xFF, 0x18, 0x38, 0xFF, 0xFE, 0x68, 0xFF, 0xBC, 0x50, 0xFF, 0x7A, 0x50, 0xFF, 0x5B, 0x50, 0xFF, 0x1C, 0x38, 0xFF, 0xBE, 0x80, 0xFF, 0x3B, 0x60, 0xFF, 0x1B, 0x50, 0xFF, 0x1C, 0x48, 0xFF, 0x3E, 0x68, 0xFF, 0x1B, 0x60, 0xFF, 0x18, 0x68, 0xFF, 0x17, 0x68, 0xFF, 0x17, 0x80, 0xFF, 0x58, 0x88, 0xFF, 0x17, 0x78, 0xFF, 0x17, 0x88, 0xFF, 0x16, 0x90, 0xFF, 0x15, 0x90, 0xFF, 0x15, 0x98, 0xFF, 0x77, 0xA8, 0xFF, 0x15, 0xA0, 0xFF, 0x35, 0x98, 0xFF, 0x15, 0xA0, 0xFF, 0x33, 0xA0, 0xFF, 0x75, 0xB0, 0xFF, 0x73, 0xA8, 0xFF, 0x92, 0xA8, 0xFF, 0x94, 0xD0, 0xFF, 0xF5, 0xC8, 0xFF, 0xD4, 0xD0, 0xFF, 0x93, 0xC0, 0xFF, 0xD2, 0xC0, 0xFF, 0x76, 0xF1, 0xFF, 0x96, 0xF1, 0xFF, 0x75, 0xE9, 0xFF, 0x96, 0xF9, 0xFF, 0x12, 0xD9, 0xFF, 0x13, 0xE1, 0xFF, 0x74, 0xF1, 0xFF, 0x52, 0xE9, 0xFF, 0x72, 0xE9, 0xFF, 0xD4, 0xF9, 0xFF, 0xB2, 0xF1, 0xFF, 0xB2, 0xF1, 0xFF, 0x90, 0xF1, 0xFF, 0x6E, 0xD9, 0xFF, 0xD0, 0xF1, 0xFF, 0xB0, 0xF1, 0xFF, 0xB0, 0xF1, 0xFF,
-    0x6F, 0xE1, 0xFF, 0x30, 0xF2, 0xFF, 0xAF, 0xE9, 0xFF, 0x8E, 0xE1, 0xFF, 0x8E, 0xD9, 0xFF, 0x8D, 0xC9, 0xFF, 0x8D, 0xC1, 0xFF, 0x8D, 0xC9, 0xFF, 0xAD, 0xC9, 0xFF, 0x8D, 0xC1, 0xFF, 0xCD, 0xC9, 0xFF, 0xEE, 0xC9, 0xFF, 0xEE, 0xD1, 0xFF, 0x2F, 0xDA, 0xFF, 0x2F, 0xDA, 0xFF, 0x70, 0xEA, 0xFF, 0x13, 0x30, 0xFF, 0x34, 0x30, 0xFF, 0x14, 0x28, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x38, 0xFF, 0x13, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0x14, 0x38, 0xFF, 0x15, 0x40, 0xFF, 0x14, 0x20, 0xFF, 0x37, 0x40, 0xFF, 0x78, 0x38, 0xFF, 0x1C, 0x61, 0xFF, 0x7D, 0x69, 0xFF, 0x9A, 0x48, 0xFF, 0xBD, 0x60, 0xFF, 0x19, 0x40, 0xFF, 0x3A, 0x50, 0xFF, 0xBD, 0x70, 0xFF, 0x1B, 0x50, 0xFF, 0x3D, 0x68, 0xFF, 0x1B, 0x68, 0xFF, 0x1A, 0x60, 0xFF, 0x59, 0x80, 0xFF, 0x1A, 0x70, 0xFF, 0x16, 0x78, 0xFF, 0x19, 0x90, 0xFF, 0x18, 0x80, 0xFF, 0x17, 0x90, 0xFF, 0x37, 0x90, 0xFF, 0x17, 0x98, 0xFF, 0x36, 0xA0, 0xFF, 0x99, 0xB0, 0xFF, 0x14, 0xA0, 0xFF, 0x15, 0x98, 0xFF, 0x14, 0x98, 0xFF, 0x15, 0xA8, 0xFF, 0x97, 0xB8, 0xFF, 0x54, 0xA8, 0xFF, 0x53, 0xA8, 0xFF, 0x56, 0xD0, 0xFF, 0xB6, 0xD0, 0xFF, 0xB6, 0xD0, 0xFF, 0x93, 0xC0, 0xFF, 0x93, 0xC0, 0xFF, 0x58, 0xF1, 0xFF,
-    0xF5, 0xE0, 0xFF, 0x16, 0xE9, 0xFF, 0x78, 0xF9, 0xFF, 0xB2, 0xD0, 0xFF, 0xB3, 0xE0, 0xFF, 0xF4, 0xE8, 0xFF, 0x34, 0xF1, 0xFF, 0x52, 0xE9, 0xFF, 0x95, 0xF9, 0xFF, 0x94, 0xF1, 0xFF, 0xB4, 0xF1, 0xFF, 0x92, 0xF1, 0xFF, 0x70, 0xE9, 0xFF, 0x4F, 0xE9, 0xFF, 0xB1, 0xF1, 0xFF, 0x90, 0xE9, 0xFF, 0x4F, 0xE9, 0xFF, 0xD0, 0xF1, 0xFF, 0x6F, 0xE9, 0xFF, 0x8F, 0xE9, 0xFF, 0xCF, 0xE9, 0xFF, 0x6E, 0xD1, 0xFF, 0x6D, 0xC9, 0xFF, 0x8E, 0xD1, 0xFF, 0x8D, 0xC1, 0xFF, 0xCE, 0xC9, 0xFF, 0xAE, 0xC9, 0xFF, 0xEF, 0xC9, 0xFF, 0xCE, 0xD1, 0xFF, 0x0F, 0xD2, 0xFF, 0xEF, 0xD9, 0xFF, 0x50, 0xE2, 0xFF, 0x19, 0x38, 0xFF, 0x18, 0x10, 0xFF, 0x18, 0x20, 0xFF, 0x15, 0x38, 0xFF, 0x19, 0x18, 0xFF, 0x39, 0x30, 0xFF, 0x97, 0x40, 0xFF, 0x35, 0x30, 0xFF, 0x16, 0x30, 0xFF, 0xB9, 0x50, 0xFF, 0xD9, 0x38, 0xFF, 0xD8, 0x30, 0xFF, 0x59, 0x11, 0xFF, 0x9F, 0x6D, 0xFF, 0xFC, 0x31, 0xFF, 0xFE, 0x53, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x9F, 0xFF, 0xBF, 0xCF, 0xFF, 0x3F, 0xFF, 0xFF, 0x9C, 0x70, 0xFF, 0x5F, 0x7C, 0xFF, 0xFE, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0x91, 0xFF, 0x9F, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFA, 0xFF, 0xBE, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0xC0, 0xFF, 0x1C, 0xA0, 0xFF,
-    0x1F, 0xD0, 0xFF, 0x1D, 0xF0, 0xFF, 0x5C, 0xC8, 0xFF, 0x5B, 0xD0, 0xFF, 0x15, 0x98, 0xFF, 0x17, 0xB8, 0xFF, 0x1A, 0xE8, 0xFF, 0x3A, 0xE0, 0xFF, 0x14, 0xB0, 0xFF, 0x78, 0xD1, 0xFF, 0xDD, 0xF0, 0xFF, 0x5C, 0xF1, 0xFF, 0xBC, 0xF1, 0xFF, 0x55, 0xD0, 0xFF, 0xF9, 0xE0, 0xFF, 0x7F, 0xFA, 0xFF, 0xBF, 0xF4, 0xFF, 0x5A, 0xE9, 0xFF, 0xBC, 0xF9, 0xFF, 0xDA, 0xF1, 0xFF, 0x5D, 0xE3, 0xFF, 0x7F, 0xFB, 0xFF, 0xFB, 0xF1, 0xFF, 0x5A, 0xFA, 0xFF, 0x5D, 0xEB, 0xFF, 0xDC, 0xE3, 0xFF, 0xBC, 0xE3, 0xFF, 0x99, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0xFE, 0xFF, 0x32, 0xEC, 0xFF, 0x99, 0xFE, 0xFF, 0x55, 0xF3, 0xFF, 0x39, 0xF6, 0xFF, 0x37, 0xFC, 0xFF, 0x7B, 0xFF, 0xFF, 0x75, 0xFB, 0xFF, 0x50, 0xD4, 0xFF, 0xB3, 0xFA, 0xFF, 0x7C, 0xFE, 0xFF, 0xD3, 0xF2, 0xFF, 0x58, 0x51, 0xFF, 0x97, 0x48, 0xFF, 0xD8, 0x38, 0xFF, 0xB6, 0x58, 0xFF, 0x1B, 0x39, 0xFF, 0xB6, 0x48, 0xFF, 0x55, 0x38, 0xFF, 0xBA, 0x68, 0xFF, 0xB8, 0x50, 0xFF, 0x57, 0x38, 0xFF, 0xF9, 0x28, 0xFF, 0xB7, 0x40, 0xFF, 0xBC, 0x79, 0xFF, 0x5B, 0x59, 0xFF, 0x59, 0x38, 0xFF, 0x7B, 0x51, 0xFF,
-    0xBD, 0x94, 0xFF, 0x1F, 0xEE, 0xFF, 0xBF, 0x80, 0xFF, 0x5A, 0x50, 0xFF, 0x1B, 0x58, 0xFF, 0x1C, 0x50, 0xFF, 0x3E, 0x58, 0xFF, 0x5F, 0x98, 0xFF, 0x3B, 0x68, 0xFF, 0x1A, 0x70, 0xFF, 0x1B, 0x70, 0xFF, 0xBE, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xA8, 0xFF, 0x16, 0x88, 0xFF, 0x39, 0x90, 0xFF, 0x1A, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xF0, 0xFF, 0x17, 0xB0, 0xFF, 0x17, 0xA0, 0xFF, 0x18, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0x17, 0xB8, 0xFF, 0x15, 0xA8, 0xFF, 0x1A, 0xE0, 0xFF, 0xBE, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0x16, 0xD8, 0xFF, 0x55, 0xC8, 0xFF, 0xFD, 0xF8, 0xFF, 0x9B, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xF0, 0xFF, 0x75, 0xE0, 0xFF, 0xBA, 0xF0, 0xFF, 0x9D, 0xEA, 0xFF, 0x3F, 0xFC, 0xFF, 0xF6, 0xE8, 0xFF, 0x37, 0xF1, 0xFF, 0x78, 0xE9, 0xFF, 0xD8, 0xF1, 0xFF, 0x53, 0xE1, 0xFF, 0xF2, 0xE8, 0xFF, 0x54, 0xE9, 0xFF, 0x72, 0xF1, 0xFF, 0xB4, 0xF9, 0xFF, 0x51, 0xE9, 0xFF, 0x56, 0xF2, 0xFF, 0x10, 0xD9, 0xFF, 0xCF, 0xE0, 0xFF, 0x0F, 0xD9, 0xFF, 0x2F, 0xC1, 0xFF, 0xEF, 0xC8, 0xFF, 0x50, 0xD1, 0xFF, 0x4E, 0xB9, 0xFF, 0x4E, 0xB9, 0xFF, 0x6F, 0xC1, 0xFF, 0xB0, 0xC9, 0xFF, 0xB0, 0xC9, 0xFF, 0xB0, 0xC9, 0xFF, 0xB0, 0xD1, 0xFF, 0xF0, 0xD9, 0xFF,
-    0x34, 0x40, 0xFF, 0x14, 0x20, 0xFF, 0x18, 0x61, 0xFF, 0x55, 0x58, 0xFF, 0x15, 0x30, 0xFF, 0x14, 0x28, 0xFF, 0x35, 0x40, 0xFF, 0x97, 0x48, 0xFF, 0x15, 0x30, 0xFF, 0x39, 0x69, 0xFF, 0x15, 0x30, 0xFF, 0xFA, 0x80, 0xFF, 0x79, 0x30, 0xFF, 0x5A, 0x40, 0xFF, 0xDF, 0x79, 0xFF, 0x5A, 0x60, 0xFF, 0xDD, 0x40, 0xFF, 0x5F, 0x69, 0xFF, 0xBE, 0x60, 0xFF, 0x1D, 0x50, 0xFF, 0x3D, 0x60, 0xFF, 0x1C, 0x50, 0xFF, 0x3F, 0x68, 0xFF, 0x1E, 0x40, 0xFF, 0x3E, 0x78, 0xFF, 0x1B, 0x60, 0xFF, 0x1D, 0x70, 0xFF, 0x7F, 0x98, 0xFF, 0x5D, 0xB8, 0xFF, 0x1A, 0x88, 0xFF, 0x3B, 0xA8, 0xFF, 0x19, 0x98, 0xFF, 0x1A, 0x98, 0xFF, 0x5B, 0xB8, 0xFF, 0x3B, 0xB0, 0xFF, 0x7B, 0xC8, 0xFF, 0x17, 0x98, 0xFF, 0x16, 0xA0, 0xFF, 0x19, 0xD0, 0xFF, 0x1C, 0xD0, 0xFF, 0x17, 0xA8, 0xFF, 0x15, 0xA0, 0xFF, 0x1A, 0xE0, 0xFF, 0x18, 0xD0, 0xFF, 0x1C, 0xF1, 0xFF, 0x15, 0xC0, 0xFF, 0x36, 0xC0, 0xFF, 0xDC, 0xF8, 0xFF, 0x15, 0xD0, 0xFF, 0xF8, 0xF0, 0xFF, 0x98, 0xE8, 0xFF, 0x33, 0xC8, 0xFF, 0x77, 0xE8, 0xFF, 0x75, 0xE0, 0xFF, 0x35, 0xD8, 0xFF, 0x74, 0xD8, 0xFF, 0x17, 0xF1, 0xFF, 0x74, 0xE0, 0xFF, 0xD5, 0xF0, 0xFF, 0xB2, 0xD8, 0xFF, 0xD1, 0xD0, 0xFF, 0xF1, 0xD8, 0xFF, 0x93, 0xF1, 0xFF, 0xF3, 0xE8, 0xFF,
-    0xD2, 0xE0, 0xFF, 0x32, 0xE9, 0xFF, 0xF0, 0xC8, 0xFF, 0xD0, 0xD0, 0xFF, 0x30, 0xD1, 0xFF, 0x0F, 0xB9, 0xFF, 0x50, 0xD1, 0xFF, 0x30, 0xC9, 0xFF, 0x2E, 0xB9, 0xFF, 0x4F, 0xB9, 0xFF, 0x4F, 0xB9, 0xFF, 0x4F, 0xB9, 0xFF, 0xD0, 0xC9, 0xFF, 0x8F, 0xC9, 0xFF, 0xD1, 0xD1, 0xFF, 0xB1, 0xD9, 0xFF, 0xDC, 0x68, 0xFF, 0x19, 0x28, 0xFF, 0x9C, 0x78, 0xFF, 0x17, 0x40, 0xFF, 0x17, 0x28, 0xFF, 0x78, 0x58, 0xFF, 0x16, 0x38, 0xFF, 0x99, 0x48, 0xFF, 0x16, 0x28, 0xFF, 0x15, 0x40, 0xFF, 0x99, 0x58, 0xFF, 0x5F, 0xC2, 0xFF, 0x58, 0x30, 0xFF, 0x9A, 0x38, 0xFF, 0x9D, 0x48, 0xFF, 0xFF, 0x91, 0xFF, 0x1F, 0x94, 0xFF, 0x5F, 0x5A, 0xFF, 0x9D, 0x38, 0xFF, 0x9D, 0x48, 0xFF, 0x3F, 0x78, 0xFF, 0x5F, 0x81, 0xFF, 0x5F, 0xD4, 0xFF, 0x9B, 0xBB, 0xFF, 0x3F, 0x90, 0xFF, 0x5E, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xA8, 0xFF, 0x1E, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xE8, 0xFF, 0x7E, 0xB0, 0xFF, 0xBE, 0xFD, 0xFF, 0x1A, 0xA0, 0xFF, 0x5D, 0xB0, 0xFF, 0x5D, 0xC8, 0xFF, 0x18, 0x98, 0xFF, 0x16, 0x98, 0xFF, 0x16, 0xA0, 0xFF, 0x39, 0xB0, 0xFF, 0x17, 0xA8, 0xFF, 0x17, 0xA0, 0xFF, 0x1C, 0xE0, 0xFF, 0x38, 0xC8, 0xFF, 0x3E, 0xF1, 0xFF, 0x77, 0xD0, 0xFF, 0x17, 0xC0, 0xFF, 0x1E, 0xF9, 0xFF,
-    0x37, 0xD8, 0xFF, 0x99, 0xE8, 0xFF, 0x7C, 0xF0, 0xFF, 0x15, 0xD0, 0xFF, 0x99, 0xF0, 0xFF, 0x55, 0xD0, 0xFF, 0xB6, 0xD8, 0xFF, 0xD6, 0xE0, 0xFF, 0xF7, 0xF0, 0xFF, 0x95, 0xE8, 0xFF, 0xB6, 0xE8, 0xFF, 0x92, 0xD8, 0xFF, 0x54, 0xE9, 0xFF, 0xF3, 0xE0, 0xFF, 0x91, 0xD0, 0xFF, 0x16, 0xF9, 0xFF, 0x15, 0xF1, 0xFF, 0xD2, 0xE0, 0xFF, 0xF1, 0xD8, 0xFF, 0xB1, 0xD8, 0xFF, 0xF0, 0xD0, 0xFF, 0x10, 0xC9, 0xFF, 0x53, 0xE1, 0xFF, 0x32, 0xD9, 0xFF, 0x2F, 0xC1, 0xFF, 0x50, 0xC1, 0xFF, 0x50, 0xC1, 0xFF, 0x2F, 0xC1, 0xFF, 0x90, 0xD1, 0xFF, 0x70, 0xC9, 0xFF, 0xD1, 0xD9, 0xFF, 0xD1, 0xE1, 0xFF, 0x1C, 0x11, 0xFF, 0xFF, 0xAF, 0xFF, 0x7E, 0x22, 0xFF, 0xFF, 0xF7, 0xFF, 0x5D, 0x10, 0xFF, 0x3F, 0x73, 0xFF, 0x37, 0x20, 0xFF, 0x3B, 0x41, 0xFF, 0x17, 0x28, 0xFF, 0x39, 0x28, 0xFF, 0x9F, 0x7A, 0xFF, 0x7B, 0x4A, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xD7, 0xFF, 0x7B, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0x1B, 0xFF, 0x9F, 0x96, 0xFF, 0x7A, 0x5C, 0xFF, 0xBD, 0xAD, 0xFF, 0x9F, 0x89, 0xFF, 0x5F, 0xE5, 0xFF, 0x1C, 0x70, 0xFF, 0x7D, 0x68, 0xFF, 0x3F, 0x80, 0xFF, 0x3A, 0xA0, 0xFF, 0xFE, 0xC8, 0xFF, 0x1C, 0x88, 0xFF, 0x5F, 0xE9, 0xFF, 0x5F, 0xA8, 0xFF,
-    0x3B, 0x98, 0xFF, 0x39, 0x98, 0xFF, 0x1B, 0xA0, 0xFF, 0x1B, 0xC8, 0xFF, 0x39, 0x98, 0xFF, 0x16, 0xA0, 0xFF, 0x18, 0xA8, 0xFF, 0x3B, 0xB8, 0xFF, 0x17, 0xA8, 0xFF, 0x17, 0xA8, 0xFF, 0x1F, 0xF9, 0xFF, 0x9B, 0xE0, 0xFF, 0x1E, 0xF2, 0xFF, 0x36, 0xC8, 0xFF, 0xBD, 0xE8, 0xFF, 0x9F, 0xF9, 0xFF, 0xBD, 0xF8, 0xFF, 0x79, 0xE0, 0xFF, 0x7D, 0xF0, 0xFF, 0x9D, 0xF9, 0xFF, 0x3D, 0xF0, 0xFF, 0x39, 0xE8, 0xFF, 0x1A, 0xF1, 0xFF, 0x37, 0xD8, 0xFF, 0x7E, 0xF8, 0xFF, 0x1C, 0xF9, 0xFF, 0xD9, 0xF0, 0xFF, 0xFB, 0xF9, 0xFF, 0x78, 0xE2, 0xFF, 0xD7, 0xF0, 0xFF, 0xF9, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF3, 0xFF, 0x97, 0xF0, 0xFF, 0x9A, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFC, 0xFF, 0xF6, 0xF0, 0xFF, 0xB6, 0xF9, 0xFF, 0x36, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0xF1, 0xFF, 0x3A, 0xD9, 0xFF, 0x71, 0xD1, 0xFF, 0xDF, 0xFF, 0xFF, 0x52, 0xE1, 0xFF, 0x9D, 0xF4, 0xFF, 0x96, 0xF9, 0xFF, 0x35, 0x28, 0xFF, 0x79, 0x18, 0xFF, 0x35, 0x28, 0xFF, 0x5F, 0x84, 0xFF, 0x5F, 0x52, 0xFF, 0x77, 0x38, 0xFF, 0x1A, 0x20, 0xFF, 0x7C, 0x28, 0xFF, 0x38, 0x30, 0xFF, 0xDD, 0x43, 0xFF, 0x39, 0x28, 0xFF, 0x59, 0x38, 0xFF, 0xDF, 0x94, 0xFF, 0x7D, 0x4A, 0xFF, 0xDB, 0x40, 0xFF, 0xFB, 0x29, 0xFF,
-    0xBF, 0x41, 0xFF, 0x9C, 0x21, 0xFF, 0x3D, 0x38, 0xFF, 0x1E, 0x50, 0xFF, 0xFF, 0xAA, 0xFF, 0x1E, 0x60, 0xFF, 0x5E, 0x78, 0xFF, 0x1D, 0x48, 0xFF, 0x1C, 0x70, 0xFF, 0x1E, 0x80, 0xFF, 0x9F, 0xA9, 0xFF, 0x1B, 0x88, 0xFF, 0x1A, 0x80, 0xFF, 0x1F, 0xA0, 0xFF, 0x1B, 0x90, 0xFF, 0x1C, 0x90, 0xFF, 0x1B, 0x98, 0xFF, 0x1D, 0xC8, 0xFF, 0x1D, 0xE0, 0xFF, 0x19, 0xB0, 0xFF, 0x1A, 0x98, 0xFF, 0x18, 0xA0, 0xFF, 0xBF, 0xF8, 0xFF, 0x1F, 0xF8, 0xFF, 0x19, 0xA8, 0xFF, 0x17, 0xA8, 0xFF, 0x1E, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0x38, 0xD0, 0xFF, 0x39, 0xC8, 0xFF, 0x7D, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE8, 0xFF, 0x1F, 0xFA, 0xFF, 0x19, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x1B, 0xE8, 0xFF, 0x19, 0xD8, 0xFF, 0x1E, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF4, 0xFF, 0x38, 0xE8, 0xFF, 0x98, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xFF, 0x5D, 0xF9, 0xFF, 0x5F, 0xFB, 0xFF, 0x96, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFB, 0xFF, 0x74, 0xE8, 0xFF, 0x5B, 0xDB, 0xFF, 0xB3, 0xE0, 0xFF, 0x59, 0xFA, 0xFF, 0x78, 0xEB, 0xFF, 0xD6, 0xF3, 0xFF, 0x35, 0xF1, 0xFF, 0x31, 0xD9, 0xFF, 0x94, 0xF1, 0xFF, 0x52, 0xE1, 0xFF, 0xD5, 0xF1, 0xFF,
-    0x37, 0x38, 0xFF, 0x16, 0x20, 0xFF, 0x58, 0x30, 0xFF, 0xFA, 0x48, 0xFF, 0x5D, 0x40, 0xFF, 0x17, 0x38, 0xFF, 0x55, 0x40, 0xFF, 0x9A, 0x48, 0xFF, 0x59, 0x40, 0xFF, 0xBD, 0x28, 0xFF, 0x7A, 0x60, 0xFF, 0xDF, 0x48, 0xFF, 0xBF, 0x42, 0xFF, 0x38, 0x30, 0xFF, 0x3D, 0x51, 0xFF, 0x1A, 0x38, 0xFF, 0x3D, 0x30, 0xFF, 0xDD, 0x50, 0xFF, 0x3E, 0x68, 0xFF, 0xBF, 0xA3, 0xFF, 0x1E, 0x40, 0xFF, 0x1F, 0x58, 0xFF, 0xBE, 0x99, 0xFF, 0x1F, 0x88, 0xFF, 0xBD, 0x78, 0xFF, 0x7A, 0x68, 0xFF, 0x9F, 0xFF, 0xFF, 0x3E, 0x90, 0xFF, 0x3F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xB8, 0xFF, 0x7E, 0xEA, 0xFF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0x7D, 0xD0, 0xFF, 0x5C, 0xB0, 0xFF, 0x1B, 0xA8, 0xFF, 0xFD, 0xF5, 0xFF, 0xBD, 0xEB, 0xFF, 0x1A, 0xB0, 0xFF, 0x18, 0xA0, 0xFF, 0x3F, 0xF0, 0xFF, 0x1F, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xE8, 0xFF, 0x59, 0xC0, 0xFF, 0x5F, 0xF8, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xF0, 0xFF, 0x18, 0xD0, 0xFF, 0x1D, 0xF8, 0xFF, 0x1D, 0xE8, 0xFF, 0xBF, 0xFB, 0xFF, 0x16, 0xC8, 0xFF, 0x19, 0xE8, 0xFF, 0x3A, 0xF0, 0xFF, 0x5A, 0xF0, 0xFF, 0x7F, 0xFC, 0xFF, 0x5C, 0xFA, 0xFF, 0xB6, 0xE8, 0xFF, 0x54, 0xE0, 0xFF, 0xB7, 0xF8, 0xFF,
-    0xF8, 0xF0, 0xFF, 0x3F, 0xFB, 0xFF, 0x71, 0xC8, 0xFF, 0xF5, 0xE0, 0xFF, 0x91, 0xB8, 0xFF, 0x91, 0xB8, 0xFF, 0xFA, 0xFA, 0xFF, 0xD0, 0xB8, 0xFF, 0xF0, 0xB0, 0xFF, 0xF0, 0xB0, 0xFF, 0xF0, 0xB8, 0xFF, 0x97, 0xFA, 0xFF, 0xD3, 0xC8, 0xFF, 0x31, 0xC1, 0xFF, 0x51, 0xC1, 0xFF, 0x31, 0xC9, 0xFF, 0x1C, 0x08, 0xFF, 0xFF, 0xEF, 0xFF, 0x1C, 0x08, 0xFF, 0x1A, 0x00, 0xFF, 0x5F, 0x38, 0xFF, 0x18, 0x28, 0xFF, 0x36, 0x38, 0xFF, 0x17, 0x20, 0xFF, 0x16, 0x08, 0xFF, 0x39, 0x20, 0xFF, 0xDF, 0x58, 0xFF, 0x3D, 0x20, 0xFF, 0x3F, 0x30, 0xFF, 0x7F, 0x41, 0xFF, 0x7F, 0xA6, 0xFF, 0x3F, 0x75, 0xFF, 0x9D, 0x01, 0xFF, 0xDF, 0x77, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0x7C, 0xFF, 0x1E, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0x48, 0xFF, 0x3C, 0x50, 0xFF, 0xBF, 0xF7, 0xFF, 0x1D, 0x68, 0xFF, 0x1E, 0x78, 0xFF, 0x3F, 0xB1, 0xFF, 0x5F, 0x88, 0xFF, 0x5D, 0xA0, 0xFF, 0x1D, 0x90, 0xFF, 0x1A, 0x80, 0xFF, 0x1C, 0xA0, 0xFF, 0x3D, 0xA8, 0xFF, 0x3F, 0xC8, 0xFF, 0x9E, 0xA0, 0xFF, 0x1A, 0x98, 0xFF, 0x1B, 0xD0, 0xFF, 0x1D, 0xC8, 0xFF, 0x19, 0xA0, 0xFF, 0x18, 0xA0, 0xFF, 0x9F, 0xF0, 0xFF, 0x7B, 0xD0, 0xFF, 0x9E, 0xF0, 0xFF, 0x17, 0xB8, 0xFF, 0x19, 0xB8, 0xFF, 0x7E, 0xF0, 0xFF,
-    0x19, 0xC8, 0xFF, 0x19, 0xD0, 0xFF, 0x1C, 0xE0, 0xFF, 0x18, 0xC0, 0xFF, 0x1C, 0xE8, 0xFF, 0x17, 0xC8, 0xFF, 0x17, 0xC8, 0xFF, 0x16, 0xC0, 0xFF, 0x3A, 0xE8, 0xFF, 0x9A, 0xF0, 0xFF, 0x19, 0xE0, 0xFF, 0x77, 0xD8, 0xFF, 0xB6, 0xD8, 0xFF, 0x33, 0xC0, 0xFF, 0x33, 0xC0, 0xFF, 0x57, 0xE8, 0xFF, 0xB6, 0xE0, 0xFF, 0x13, 0xC0, 0xFF, 0x54, 0xC8, 0xFF, 0x94, 0xD0, 0xFF, 0x92, 0xC0, 0xFF, 0x31, 0xB8, 0xFF, 0x92, 0xC0, 0xFF, 0xD0, 0xB0, 0xFF, 0xD0, 0xB0, 0xFF, 0xCF, 0xB0, 0xFF, 0x12, 0xC1, 0xFF, 0x11, 0xB9, 0xFF, 0xD2, 0xC0, 0xFF, 0x11, 0xC1, 0xFF, 0x31, 0xC1, 0xFF, 0x73, 0xD9, 0xFF, 0xDF, 0x47, 0xFF, 0x9C, 0x10, 0xFF, 0x37, 0x20, 0xFF, 0x59, 0x20, 0xFF, 0x18, 0x20, 0xFF, 0x15, 0x28, 0xFF, 0xDE, 0x89, 0xFF, 0x15, 0x20, 0xFF, 0x17, 0x10, 0xFF, 0x9E, 0x18, 0xFF, 0x18, 0x38, 0xFF, 0x7B, 0x21, 0xFF, 0xFF, 0xE7, 0xFF, 0x7F, 0x3A, 0xFF, 0x9E, 0x38, 0xFF, 0xDF, 0x4D, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0x56, 0xFF, 0x7E, 0x18, 0xFF, 0x1F, 0x5B, 0xFF, 0x9F, 0xBF, 0xFF, 0x1E, 0x40, 0xFF, 0x1C, 0x50, 0xFF, 0x7E, 0x69, 0xFF, 0x1C, 0x60, 0xFF, 0x1E, 0x58, 0xFF, 0x1D, 0x58, 0xFF, 0x1D, 0x78, 0xFF, 0x19, 0x68, 0xFF, 0x3B, 0x78, 0xFF, 0x1C, 0x88, 0xFF, 0x7F, 0xA8, 0xFF,
-    0x1A, 0x78, 0xFF, 0x1C, 0x98, 0xFF, 0x3D, 0x98, 0xFF, 0xDF, 0xE8, 0xFF, 0x9F, 0xA0, 0xFF, 0x18, 0x90, 0xFF, 0x19, 0xA0, 0xFF, 0x3B, 0xA8, 0xFF, 0x18, 0xA0, 0xFF, 0x18, 0x98, 0xFF, 0xFF, 0xF0, 0xFF, 0x5D, 0xD0, 0xFF, 0x3F, 0xFA, 0xFF, 0x3A, 0xC0, 0xFF, 0x3C, 0xC8, 0xFF, 0x5F, 0xF0, 0xFF, 0x19, 0xB8, 0xFF, 0x1A, 0xD0, 0xFF, 0x3F, 0xE8, 0xFF, 0x17, 0xB8, 0xFF, 0x3E, 0xF0, 0xFF, 0x17, 0xB8, 0xFF, 0x9A, 0xF0, 0xFF, 0x5C, 0xF0, 0xFF, 0x3D, 0xF0, 0xFF, 0x3C, 0xF0, 0xFF, 0x3D, 0xF0, 0xFF, 0xBB, 0xF8, 0xFF, 0x18, 0xF0, 0xFF, 0x35, 0xD0, 0xFF, 0x59, 0xF9, 0xFF, 0xFB, 0xD5, 0xFF, 0x1C, 0xF0, 0xFF, 0x15, 0xD0, 0xFF, 0x12, 0xC0, 0xFF, 0x9E, 0xF7, 0xFF, 0x17, 0xF0, 0xFF, 0xB9, 0xF0, 0xFF, 0x92, 0xC0, 0xFF, 0xB4, 0xC8, 0xFF, 0x9D, 0xED, 0xFF, 0xB2, 0xC8, 0xFF, 0x52, 0xC8, 0xFF, 0x11, 0xB1, 0xFF, 0x7E, 0xFA, 0xFF, 0x12, 0xC1, 0xFF, 0x35, 0xD9, 0xFF, 0x15, 0xE1, 0xFF, 0x56, 0x38, 0xFF, 0x38, 0x18, 0xFF, 0x14, 0x28, 0xFF, 0x35, 0x28, 0xFF, 0x13, 0x28, 0xFF, 0xDF, 0x6A, 0xFF, 0x17, 0x38, 0xFF, 0x36, 0x38, 0xFF, 0x77, 0x38, 0xFF, 0xFF, 0xAF, 0xFF, 0x17, 0x28, 0xFF, 0x1A, 0x20, 0xFF, 0x18, 0x18, 0xFF, 0x1B, 0x20, 0xFF, 0x19, 0x38, 0xFF, 0x3A, 0x28, 0xFF,
-    0x1C, 0x18, 0xFF, 0xDF, 0x41, 0xFF, 0x3F, 0x30, 0xFF, 0x1C, 0x30, 0xFF, 0x1E, 0x38, 0xFF, 0x1D, 0x40, 0xFF, 0x5F, 0xB2, 0xFF, 0x1E, 0x48, 0xFF, 0x1F, 0x58, 0xFF, 0xFF, 0xA2, 0xFF, 0x5F, 0x88, 0xFF, 0x1B, 0x68, 0xFF, 0x1B, 0x60, 0xFF, 0xFF, 0xFE, 0xFF, 0x1E, 0x98, 0xFF, 0x1E, 0x80, 0xFF, 0xDE, 0xD1, 0xFF, 0x1C, 0x98, 0xFF, 0x1E, 0xA8, 0xFF, 0x7F, 0xE9, 0xFF, 0x1B, 0x90, 0xFF, 0x18, 0x90, 0xFF, 0x1B, 0xA8, 0xFF, 0x1C, 0xA8, 0xFF, 0x1A, 0xA0, 0xFF, 0x18, 0x98, 0xFF, 0x9F, 0xFA, 0xFF, 0x1D, 0xE8, 0xFF, 0x7F, 0xFA, 0xFF, 0x9E, 0xE0, 0xFF, 0x1A, 0xB0, 0xFF, 0x9E, 0xF4, 0xFF, 0xFF, 0xF9, 0xFF, 0x3D, 0xE8, 0xFF, 0x5F, 0xF0, 0xFF, 0x1B, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xF0, 0xFF, 0x1B, 0xD8, 0xFF, 0x1C, 0xE0, 0xFF, 0xDF, 0xFF, 0xFF, 0x3F, 0xF9, 0xFF, 0x5E, 0xF0, 0xFF, 0x39, 0xE0, 0xFF, 0x9E, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF8, 0xFF, 0x3C, 0xF8, 0xFF, 0xDE, 0xF5, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x14, 0xD0, 0xFF, 0x39, 0xF0, 0xFF, 0x39, 0xF0, 0xFF, 0xDF, 0xFF, 0xFF, 0x91, 0xB0, 0xFF, 0xD1, 0xB0, 0xFF, 0xD1, 0xA8, 0xFF, 0xB2, 0xC0, 0xFF, 0x5F, 0xFD, 0xFF, 0x35, 0xF1, 0xFF, 0xF3, 0xC8, 0xFF, 0xF3, 0xD8, 0xFF, 0x1F, 0xFB, 0xFF,
-    0x14, 0x10, 0xFF, 0x9F, 0x4A, 0xFF, 0x1E, 0x08, 0xFF, 0x7C, 0x30, 0xFF, 0x16, 0x20, 0xFF, 0x15, 0x28, 0xFF, 0x5D, 0x51, 0xFF, 0x5E, 0x59, 0xFF, 0x7E, 0x38, 0xFF, 0x1C, 0x20, 0xFF, 0x7A, 0x40, 0xFF, 0x17, 0x20, 0xFF, 0x1D, 0x10, 0xFF, 0x19, 0x30, 0xFF, 0x19, 0x38, 0xFF, 0x3E, 0x40, 0xFF, 0x9C, 0x53, 0xFF, 0x1D, 0x08, 0xFF, 0xFD, 0x39, 0xFF, 0x1C, 0x20, 0xFF, 0x1F, 0x58, 0xFF, 0x1E, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x38, 0xFF, 0xDF, 0x79, 0xFF, 0xBF, 0xFF, 0xFF, 0xBC, 0x58, 0xFF, 0x7D, 0x70, 0xFF, 0x1C, 0x58, 0xFF, 0x1F, 0xA0, 0xFF, 0x1A, 0x68, 0xFF, 0x19, 0x68, 0xFF, 0x1F, 0x98, 0xFF, 0x5F, 0xA8, 0xFF, 0x9F, 0xFA, 0xFF, 0x1D, 0x98, 0xFF, 0x19, 0x80, 0xFF, 0x19, 0x90, 0xFF, 0xDF, 0xF9, 0xFF, 0xFD, 0xF1, 0xFF, 0x1A, 0xA0, 0xFF, 0x1A, 0x98, 0xFF, 0x5F, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF8, 0xFF, 0x9D, 0xD8, 0xFF, 0x3B, 0xB0, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xF0, 0xFF, 0x7F, 0xFA, 0xFF, 0x1B, 0xC8, 0xFF, 0x1E, 0xF1, 0xFF, 0x5E, 0xEE, 0xFF, 0x1C, 0xD8, 0xFF, 0x1B, 0xD0, 0xFF, 0x3E, 0xF8, 0xFF, 0xDF, 0xFF, 0xFF, 0x5F, 0xFC, 0xFF, 0x18, 0xD8, 0xFF, 0x16, 0xC8, 0xFF, 0x19, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF2, 0xFF,
-    0x1F, 0xFA, 0xFF, 0x13, 0xB8, 0xFF, 0x13, 0xC0, 0xFF, 0x1F, 0xFB, 0xFF, 0x7E, 0xF2, 0xFF, 0xB2, 0xC8, 0xFF, 0x71, 0xA8, 0xFF, 0x2F, 0xA0, 0xFF, 0x6F, 0xA8, 0xFF, 0x99, 0xF9, 0xFF, 0xD0, 0xA8, 0xFF, 0xD0, 0xA8, 0xFF, 0xB0, 0xA8, 0xFF, 0xD1, 0xB0, 0xFF, 0xD1, 0xB8, 0xFF, 0x34, 0xE1, 0xFF, 0x39, 0x00, 0xFF, 0x14, 0x10, 0xFF, 0xDE, 0x18, 0xFF, 0xDF, 0x10, 0xFF, 0x3B, 0x40, 0xFF, 0x14, 0x20, 0xFF, 0x18, 0x30, 0xFF, 0x59, 0x40, 0xFF, 0x38, 0x28, 0xFF, 0x1F, 0x61, 0xFF, 0x1D, 0x10, 0xFF, 0x18, 0x18, 0xFF, 0x17, 0x20, 0xFF, 0x5E, 0x11, 0xFF, 0xDF, 0x60, 0xFF, 0x18, 0x20, 0xFF, 0x1E, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x7C, 0xFF, 0x1E, 0x20, 0xFF, 0x7E, 0x20, 0xFF, 0xDD, 0x4B, 0xFF, 0x1C, 0x40, 0xFF, 0x1E, 0x70, 0xFF, 0x3F, 0x92, 0xFF, 0x3F, 0x48, 0xFF, 0x7D, 0x60, 0xFF, 0x1B, 0x48, 0xFF, 0x1F, 0x98, 0xFF, 0x19, 0x58, 0xFF, 0x1A, 0x68, 0xFF, 0x1E, 0xC2, 0xFF, 0x5B, 0x78, 0xFF, 0xBE, 0xED, 0xFF, 0x1B, 0xA8, 0xFF, 0x1E, 0xB8, 0xFF, 0x1B, 0x70, 0xFF, 0x1A, 0x88, 0xFF, 0x1C, 0xE8, 0xFF, 0x7D, 0xE3, 0xFF, 0x1A, 0x98, 0xFF, 0x18, 0x88, 0xFF, 0x5F, 0xD8, 0xFF, 0x7D, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xC0, 0xFF, 0x1C, 0xB8, 0xFF, 0x3F, 0xE0, 0xFF,
-    0x1E, 0xE0, 0xFF, 0x7F, 0xFB, 0xFF, 0x9C, 0xD0, 0xFF, 0x19, 0xA8, 0xFF, 0x5E, 0xE8, 0xFF, 0x1C, 0xE8, 0xFF, 0x3F, 0xFA, 0xFF, 0x7D, 0xD8, 0xFF, 0x18, 0xB8, 0xFF, 0x19, 0xD0, 0xFF, 0x39, 0xD0, 0xFF, 0x9F, 0xF2, 0xFF, 0x14, 0xB8, 0xFF, 0x14, 0xB0, 0xFF, 0x13, 0xA8, 0xFF, 0x14, 0xA8, 0xFF, 0x15, 0xB8, 0xFF, 0xDF, 0xF9, 0xFF, 0x31, 0xA0, 0xFF, 0x51, 0x98, 0xFF, 0x51, 0x98, 0xFF, 0x53, 0xB0, 0xFF, 0xBA, 0xF9, 0xFF, 0x90, 0x98, 0xFF, 0x90, 0xA0, 0xFF, 0xD1, 0xA0, 0xFF, 0xB0, 0xA0, 0xFF, 0x97, 0xF9, 0xFF, 0xF1, 0xB0, 0xFF, 0xD1, 0xA8, 0xFF, 0xF2, 0xB8, 0xFF, 0xF6, 0xE9, 0xFF, 0x36, 0x28, 0xFF, 0x14, 0x30, 0xFF, 0x56, 0x40, 0xFF, 0x17, 0x18, 0xFF, 0x15, 0x28, 0xFF, 0x14, 0x20, 0xFF, 0x16, 0x30, 0xFF, 0x98, 0x48, 0xFF, 0x1B, 0x30, 0xFF, 0x15, 0x20, 0xFF, 0x15, 0x28, 0xFF, 0x1A, 0x10, 0xFF, 0x3B, 0x30, 0xFF, 0x5D, 0x30, 0xFF, 0x79, 0x48, 0xFF, 0x7F, 0x4A, 0xFF, 0x5D, 0x18, 0xFF, 0x1F, 0x18, 0xFF, 0x3E, 0x30, 0xFF, 0x1F, 0x52, 0xFF, 0x1C, 0x28, 0xFF, 0x1B, 0x30, 0xFF, 0x3E, 0x68, 0xFF, 0x1F, 0x61, 0xFF, 0x3E, 0x48, 0xFF, 0x1D, 0x48, 0xFF, 0x1D, 0x50, 0xFF, 0x5E, 0x68, 0xFF, 0x1A, 0x50, 0xFF, 0x19, 0x50, 0xFF, 0x18, 0x58, 0xFF, 0x1D, 0x70, 0xFF,
-    0x5F, 0x78, 0xFF, 0x5D, 0x90, 0xFF, 0x1B, 0x78, 0xFF, 0x1B, 0x98, 0xFF, 0x1A, 0x78, 0xFF, 0x18, 0x80, 0xFF, 0x1D, 0xA8, 0xFF, 0x7F, 0xC0, 0xFF, 0x1A, 0x88, 0xFF, 0x18, 0x80, 0xFF, 0x1E, 0xC0, 0xFF, 0x3E, 0xC8, 0xFF, 0x7F, 0xE0, 0xFF, 0x1D, 0xB0, 0xFF, 0x1A, 0xA0, 0xFF, 0x5F, 0xE8, 0xFF, 0x1B, 0xB0, 0xFF, 0x1A, 0xA8, 0xFF, 0x1E, 0xC8, 0xFF, 0x19, 0xA8, 0xFF, 0x5D, 0xD0, 0xFF, 0x18, 0xA8, 0xFF, 0x5B, 0xD8, 0xFF, 0x9E, 0xE8, 0xFF, 0x18, 0xB0, 0xFF, 0x17, 0xB0, 0xFF, 0x39, 0xC0, 0xFF, 0x16, 0xB8, 0xFF, 0x16, 0xB8, 0xFF, 0x13, 0xA0, 0xFF, 0x12, 0xA0, 0xFF, 0x77, 0xC8, 0xFF, 0x13, 0xA8, 0xFF, 0x12, 0x98, 0xFF, 0x11, 0x98, 0xFF, 0xF5, 0xC0, 0xFF, 0x31, 0x98, 0xFF, 0xB6, 0xC0, 0xFF, 0x70, 0x98, 0xFF, 0x91, 0xA0, 0xFF, 0x91, 0xA0, 0xFF, 0x90, 0x98, 0xFF, 0x90, 0xA0, 0xFF, 0xB0, 0xA0, 0xFF, 0xD1, 0xA8, 0xFF, 0xD0, 0xA0, 0xFF, 0xD1, 0xA8, 0xFF, 0x96, 0xD9, 0xFF, 0x13, 0x20, 0xFF, 0x98, 0x38, 0xFF, 0x15, 0x28, 0xFF, 0x13, 0x18, 0xFF, 0x14, 0x20, 0xFF, 0xBC, 0x30, 0xFF, 0x17, 0x18, 0xFF, 0x14, 0x20, 0xFF, 0x14, 0x28, 0xFF, 0x3E, 0x18, 0xFF, 0x7F, 0x49, 0xFF, 0x7C, 0x40, 0xFF, 0xBD, 0x38, 0xFF, 0xBF, 0x30, 0xFF, 0x3A, 0x38, 0xFF, 0x17, 0x28, 0xFF,
-    0x1F, 0x28, 0xFF, 0x1F, 0x39, 0xFF, 0x3F, 0x30, 0xFF, 0x1F, 0x18, 0xFF, 0x1D, 0x30, 0xFF, 0x1C, 0x30, 0xFF, 0x1B, 0x50, 0xFF, 0x1C, 0x28, 0xFF, 0x1E, 0x30, 0xFF, 0x1E, 0x30, 0xFF, 0x1F, 0x68, 0xFF, 0x1A, 0x50, 0xFF, 0x1D, 0x48, 0xFF, 0xFE, 0xF7, 0xFF, 0x1F, 0x80, 0xFF, 0x19, 0x68, 0xFF, 0xDE, 0xB1, 0xFF, 0x1C, 0x78, 0xFF, 0x9D, 0x90, 0xFF, 0x1C, 0xA0, 0xFF, 0x39, 0x78, 0xFF, 0x18, 0x78, 0xFF, 0x1B, 0x80, 0xFF, 0x1B, 0x88, 0xFF, 0x19, 0x80, 0xFF, 0x19, 0x80, 0xFF, 0x3E, 0xC8, 0xFF, 0x1E, 0xC8, 0xFF, 0xDF, 0xE9, 0xFF, 0x3F, 0xC0, 0xFF, 0x1A, 0x98, 0xFF, 0x9B, 0xD1, 0xFF, 0x1F, 0xC0, 0xFF, 0x1D, 0xD0, 0xFF, 0x1D, 0xB8, 0xFF, 0xFE, 0xFF, 0xFF, 0x1F, 0xE8, 0xFF, 0x1A, 0xA8, 0xFF, 0x19, 0xA8, 0xFF, 0x3F, 0xF8, 0xFF, 0x1D, 0xE8, 0xFF, 0x1B, 0xD0, 0xFF, 0xBE, 0xE0, 0xFF, 0x17, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xC0, 0xFF, 0x14, 0xA0, 0xFF, 0x14, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x13, 0xB0, 0xFF, 0x11, 0xA0, 0xFF, 0x31, 0x90, 0xFF, 0xB5, 0xC0, 0xFF, 0xD6, 0xC8, 0xFF, 0x70, 0x90, 0xFF, 0x90, 0x90, 0xFF, 0x90, 0x98, 0xFF, 0x90, 0x98, 0xFF, 0x90, 0x98, 0xFF, 0xB0, 0xA0, 0xFF, 0xB0, 0xA0, 0xFF, 0xD1, 0xA8, 0xFF, 0x75, 0xE0, 0xFF, 0x76, 0xE1, 0xFF,
-    0xBF, 0x9E, 0xFF, 0x3B, 0x10, 0xFF, 0x36, 0x28, 0xFF, 0x1E, 0x63, 0xFF, 0x77, 0x20, 0xFF, 0x14, 0x20, 0xFF, 0x15, 0x20, 0xFF, 0x9B, 0x38, 0xFF, 0x15, 0x20, 0xFF, 0x14, 0x28, 0xFF, 0x17, 0x20, 0xFF, 0x15, 0x28, 0xFF, 0x7B, 0x58, 0xFF, 0x17, 0x20, 0xFF, 0x18, 0x30, 0xFF, 0x17, 0x28, 0xFF, 0x7F, 0x38, 0xFF, 0x3F, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x28, 0xFF, 0xFF, 0x61, 0xFF, 0x3E, 0x52, 0xFF, 0xBD, 0x48, 0xFF, 0x3B, 0x40, 0xFF, 0x1D, 0x30, 0xFF, 0x1E, 0x60, 0xFF, 0x1A, 0x40, 0xFF, 0x19, 0x48, 0xFF, 0x1E, 0x60, 0xFF, 0x1B, 0x58, 0xFF, 0x19, 0x60, 0xFF, 0x18, 0x58, 0xFF, 0x39, 0x60, 0xFF, 0x3B, 0x70, 0xFF, 0x9F, 0xD0, 0xFF, 0x3D, 0xA0, 0xFF, 0x9C, 0x80, 0xFF, 0x18, 0x78, 0xFF, 0x1F, 0xB0, 0xFF, 0x1E, 0xB0, 0xFF, 0x1B, 0x88, 0xFF, 0x19, 0x80, 0xFF, 0x5D, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0x7F, 0xC0, 0xFF, 0x1A, 0x98, 0xFF, 0x1F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC0, 0xFF, 0x5E, 0xD8, 0xFF, 0x1D, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 0xFF, 0x19, 0xA8, 0xFF, 0x3C, 0xC0, 0xFF, 0xDE, 0xF2, 0xFF, 0x9F, 0xFE, 0xFF, 0x1C, 0xC8, 0xFF, 0x17, 0xA8, 0xFF, 0x17, 0xB8, 0xFF, 0xDF, 0xFF, 0xFF, 0xBD, 0xEB, 0xFF, 0x15, 0xB8, 0xFF,
-    0x12, 0x98, 0xFF, 0x13, 0x98, 0xFF, 0x7B, 0xF9, 0xFF, 0x10, 0x90, 0xFF, 0x31, 0x90, 0xFF, 0x11, 0x98, 0xFF, 0x50, 0xA8, 0xFF, 0xF9, 0xF0, 0xFF, 0xB1, 0xA8, 0xFF, 0x6F, 0x90, 0xFF, 0x8F, 0x98, 0xFF, 0x70, 0x98, 0xFF, 0xB1, 0xA0, 0xFF, 0xD2, 0xB8, 0xFF, 0xD1, 0xA8, 0xFF, 0x53, 0xC9, 0xFF, 0x13, 0x20, 0xFF, 0x77, 0x38, 0xFF, 0x36, 0x28, 0xFF, 0x94, 0x40, 0xFF, 0x54, 0x30, 0xFF, 0x12, 0x20, 0xFF, 0x9B, 0x48, 0xFF, 0x11, 0x20, 0xFF, 0x58, 0x40, 0xFF, 0x1F, 0x28, 0xFF, 0x3B, 0x38, 0xFF, 0x17, 0x30, 0xFF, 0x18, 0x20, 0xFF, 0x3F, 0x28, 0xFF, 0x58, 0x30, 0xFF, 0x5C, 0x48, 0xFF, 0x1A, 0x18, 0xFF, 0x5C, 0x2A, 0xFF, 0xDF, 0x49, 0xFF, 0x7D, 0x52, 0xFF, 0x3D, 0x48, 0xFF, 0x1B, 0x28, 0xFF, 0x1B, 0x38, 0xFF, 0x5C, 0x50, 0xFF, 0x1E, 0xE4, 0xFF, 0x18, 0x40, 0xFF, 0x19, 0x40, 0xFF, 0x17, 0x40, 0xFF, 0x1A, 0x58, 0xFF, 0x1E, 0x90, 0xFF, 0x17, 0x58, 0xFF, 0x1F, 0x70, 0xFF, 0x39, 0x60, 0xFF, 0x1A, 0x70, 0xFF, 0xDE, 0xD1, 0xFF, 0xFF, 0xB8, 0xFF, 0x18, 0x68, 0xFF, 0x19, 0x70, 0xFF, 0x9D, 0xE2, 0xFF, 0xFF, 0xFB, 0xFF, 0x1A, 0x80, 0xFF, 0x19, 0x78, 0xFF, 0x1F, 0xA8, 0xFF, 0x9F, 0xFF, 0xFF, 0x9E, 0xE8, 0xFF, 0xBF, 0xC8, 0xFF, 0x1D, 0xA8, 0xFF, 0x1B, 0xD0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x1B, 0xA8, 0xFF, 0x3E, 0xC8, 0xFF, 0x19, 0x98, 0xFF, 0xBB, 0xD0, 0xFF, 0x3F, 0xFA, 0xFF, 0x17, 0xA0, 0xFF, 0x7A, 0xB0, 0xFF, 0x18, 0xA8, 0xFF, 0x1C, 0xD8, 0xFF, 0x5F, 0xF9, 0xFF, 0x17, 0xA8, 0xFF, 0x14, 0x98, 0xFF, 0x14, 0x98, 0xFF, 0x9E, 0xFA, 0xFF, 0x3E, 0xF0, 0xFF, 0x12, 0x98, 0xFF, 0x11, 0x90, 0xFF, 0x10, 0x88, 0xFF, 0x97, 0xD1, 0xFF, 0x1F, 0xFA, 0xFF, 0x30, 0x90, 0xFF, 0x50, 0x90, 0xFF, 0x70, 0x88, 0xFF, 0x4F, 0x88, 0xFF, 0x16, 0xF1, 0xFF, 0xB0, 0x90, 0xFF, 0xB0, 0x90, 0xFF, 0xD0, 0x98, 0xFF, 0xB0, 0xA0, 0xFF, 0xB1, 0xA0, 0xFF, 0xF2, 0xC0, 0xFF, 0x12, 0x18, 0xFF, 0x12, 0x28, 0xFF, 0x12, 0x20, 0xFF, 0x12, 0x18, 0xFF, 0x97, 0x48, 0xFF, 0x11, 0x28, 0xFF, 0x13, 0x28, 0xFF, 0x13, 0x28, 0xFF, 0x37, 0x30, 0xFF, 0x58, 0x50, 0xFF, 0x13, 0x28, 0xFF, 0x36, 0x30, 0xFF, 0x16, 0x28, 0xFF, 0x1E, 0x7A, 0xFF, 0x7A, 0x50, 0xFF, 0x1B, 0x28, 0xFF, 0x19, 0x28, 0xFF, 0x17, 0x28, 0xFF, 0x7D, 0x49, 0xFF, 0x3D, 0x38, 0xFF, 0x19, 0x30, 0xFF, 0x19, 0x30, 0xFF, 0x1C, 0x30, 0xFF, 0x3D, 0x51, 0xFF, 0x17, 0x38, 0xFF, 0x1E, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x48, 0xFF, 0x1F, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x48, 0xFF, 0x16, 0x48, 0xFF,
-    0x7E, 0x50, 0xFF, 0x19, 0x68, 0xFF, 0xDD, 0xA8, 0xFF, 0x9D, 0x90, 0xFF, 0x17, 0x68, 0xFF, 0x17, 0x68, 0xFF, 0x1E, 0x88, 0xFF, 0x3D, 0xB9, 0xFF, 0x18, 0x78, 0xFF, 0x19, 0x80, 0xFF, 0x3F, 0xA0, 0xFF, 0x1E, 0xC0, 0xFF, 0xDE, 0xF2, 0xFF, 0x7D, 0xB0, 0xFF, 0x5A, 0x90, 0xFF, 0x7F, 0xB8, 0xFF, 0x1B, 0xA0, 0xFF, 0xFF, 0xF9, 0xFF, 0x1D, 0xC9, 0xFF, 0x18, 0x90, 0xFF, 0x9C, 0xA8, 0xFF, 0x17, 0x90, 0xFF, 0x1E, 0xF0, 0xFF, 0x9B, 0xC8, 0xFF, 0x16, 0x98, 0xFF, 0x15, 0x90, 0xFF, 0x17, 0xB0, 0xFF, 0x5E, 0xF8, 0xFF, 0x12, 0x90, 0xFF, 0x11, 0x80, 0xFF, 0x12, 0x88, 0xFF, 0x3A, 0xB0, 0xFF, 0x5E, 0xF1, 0xFF, 0x3D, 0xF9, 0xFF, 0x52, 0x98, 0xFF, 0x72, 0xA0, 0xFF, 0x10, 0x88, 0xFF, 0x30, 0x90, 0xFF, 0xD6, 0xE8, 0xFF, 0x50, 0x88, 0xFF, 0x70, 0x88, 0xFF, 0x6F, 0x88, 0xFF, 0x6F, 0x90, 0xFF, 0x35, 0xE1, 0xFF, 0xD0, 0x98, 0xFF, 0xB0, 0x98, 0xFF, 0xB0, 0x98, 0xFF, 0x2C, 0x80, 0xFF, 0x11, 0x20, 0xFF, 0x13, 0x28, 0xFF, 0x96, 0x48, 0xFF, 0x11, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x12, 0x20, 0xFF, 0x7B, 0x30, 0xFF, 0x97, 0x58, 0xFF, 0x14, 0x28, 0xFF, 0x54, 0x38, 0xFF, 0x13, 0x20, 0xFF, 0x13, 0x28, 0xFF, 0x5B, 0x40, 0xFF, 0x38, 0x38, 0xFF, 0x15, 0x28, 0xFF, 0x14, 0x20, 0xFF,
-    0x15, 0x28, 0xFF, 0x15, 0x18, 0xFF, 0x1B, 0x30, 0xFF, 0x1A, 0x20, 0xFF, 0x18, 0x28, 0xFF, 0x3D, 0x30, 0xFF, 0x9E, 0x58, 0xFF, 0x17, 0x40, 0xFF, 0x18, 0x38, 0xFF, 0x3A, 0x73, 0xFF, 0xFE, 0x98, 0xFF, 0x17, 0x40, 0xFF, 0x3A, 0x48, 0xFF, 0x38, 0x50, 0xFF, 0x3E, 0x70, 0xFF, 0x38, 0x60, 0xFF, 0x18, 0x58, 0xFF, 0x17, 0x60, 0xFF, 0x17, 0x58, 0xFF, 0x9E, 0xA0, 0xFF, 0x17, 0x60, 0xFF, 0x17, 0x60, 0xFF, 0x18, 0x68, 0xFF, 0x1B, 0x78, 0xFF, 0x18, 0x68, 0xFF, 0x17, 0x70, 0xFF, 0x1F, 0x90, 0xFF, 0x9E, 0xEC, 0xFF, 0x1B, 0x80, 0xFF, 0x1C, 0x98, 0xFF, 0x18, 0x78, 0xFF, 0x18, 0xAB, 0xFF, 0x1A, 0x90, 0xFF, 0x19, 0x90, 0xFF, 0x18, 0x80, 0xFF, 0x1F, 0xCB, 0xFF, 0x1B, 0x98, 0xFF, 0x16, 0x80, 0xFF, 0x16, 0x88, 0xFF, 0x3A, 0xA8, 0xFF, 0x16, 0x88, 0xFF, 0x14, 0x88, 0xFF, 0x14, 0x80, 0xFF, 0x15, 0x90, 0xFF, 0x34, 0x98, 0xFF, 0x12, 0x80, 0xFF, 0x12, 0x88, 0xFF, 0x32, 0x88, 0xFF, 0xB5, 0xB0, 0xFF, 0x10, 0x88, 0xFF, 0x11, 0x80, 0xFF, 0x10, 0x80, 0xFF, 0xB3, 0xB0, 0xFF, 0x30, 0x88, 0xFF, 0x30, 0x80, 0xFF, 0x4F, 0x88, 0xFF, 0x4F, 0x80, 0xFF, 0x90, 0x90, 0xFF, 0x4F, 0x88, 0xFF, 0x90, 0x88, 0xFF, 0x8F, 0x90, 0xFF, 0xB0, 0x98, 0xFF, 0x90, 0x98, 0xFF, 0xF0, 0xA0, 0xFF,
-    0x10, 0x18, 0xFF, 0x10, 0x20, 0xFF, 0x13, 0x20, 0xFF, 0x32, 0x28, 0xFF, 0x10, 0x28, 0xFF, 0x10, 0x20, 0xFF, 0x13, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x13, 0x30, 0xFF, 0x12, 0x30, 0xFF, 0x18, 0x20, 0xFF, 0x13, 0x28, 0xFF, 0x18, 0x30, 0xFF, 0x16, 0x30, 0xFF, 0x1F, 0x20, 0xFF, 0x14, 0x28, 0xFF, 0x14, 0x28, 0xFF, 0x1E, 0x30, 0xFF, 0x17, 0x30, 0xFF, 0x15, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0x1E, 0x48, 0xFF, 0x3A, 0x40, 0xFF, 0xBA, 0x58, 0xFF, 0x18, 0x38, 0xFF, 0x1A, 0x40, 0xFF, 0x38, 0x50, 0xFF, 0x15, 0x40, 0xFF, 0x7F, 0x58, 0xFF, 0x14, 0x48, 0xFF, 0x3C, 0x70, 0xFF, 0x15, 0x50, 0xFF, 0x16, 0x50, 0xFF, 0x35, 0x50, 0xFF, 0xBE, 0x78, 0xFF, 0x9D, 0x88, 0xFF, 0x16, 0x58, 0xFF, 0x17, 0x60, 0xFF, 0x1F, 0x78, 0xFF, 0xBD, 0xD2, 0xFF, 0x19, 0x60, 0xFF, 0x17, 0x68, 0xFF, 0x3C, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x78, 0xFF, 0x7E, 0xA8, 0xFF, 0x1A, 0x88, 0xFF, 0x5F, 0xFF, 0xFF, 0x1D, 0xB8, 0xFF, 0x1A, 0x90, 0xFF, 0x18, 0x88, 0xFF, 0x19, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x98, 0xFF, 0x15, 0x80, 0xFF, 0x18, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0x16, 0x90, 0xFF, 0x12, 0x80, 0xFF, 0x12, 0x80, 0xFF, 0x12, 0x80, 0xFF, 0x5A, 0xE0, 0xFF, 0x11, 0x78, 0xFF, 0x53, 0x90, 0xFF,
-    0x32, 0x90, 0xFF, 0x77, 0xB8, 0xFF, 0x10, 0x88, 0xFF, 0x0F, 0x78, 0xFF, 0x10, 0x80, 0xFF, 0x30, 0x88, 0xFF, 0x35, 0xC1, 0xFF, 0x4F, 0x80, 0xFF, 0x4F, 0x80, 0xFF, 0x90, 0x88, 0xFF, 0x6F, 0x88, 0xFF, 0xB1, 0x98, 0xFF, 0xB0, 0x90, 0xFF, 0xB0, 0x90, 0xFF, 0xB0, 0x98, 0xFF, 0xD0, 0xA0, 0xFF, 0x10, 0x20, 0xFF, 0x13, 0x20, 0xFF, 0x0F, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x53, 0x38, 0xFF, 0x37, 0x28, 0xFF, 0x11, 0x30, 0xFF, 0x11, 0x30, 0xFF, 0x13, 0x30, 0xFF, 0x12, 0x28, 0xFF, 0x9C, 0x48, 0xFF, 0x13, 0x30, 0xFF, 0x16, 0x30, 0xFF, 0x14, 0x28, 0xFF, 0x16, 0x28, 0xFF, 0x17, 0x28, 0xFF, 0x35, 0x40, 0xFF, 0x13, 0x30, 0xFF, 0x14, 0x30, 0xFF, 0xFB, 0x48, 0xFF, 0x14, 0x30, 0xFF, 0x17, 0x30, 0xFF, 0x18, 0x40, 0xFF, 0x15, 0x30, 0xFF, 0x1C, 0x60, 0xFF, 0x1B, 0x20, 0xFF, 0x9C, 0x58, 0xFF, 0x5E, 0x40, 0xFF, 0x1E, 0x60, 0xFF, 0x15, 0x50, 0xFF, 0x5A, 0x60, 0xFF, 0xBE, 0x49, 0xFF, 0x14, 0x50, 0xFF, 0x3F, 0xFE, 0xFF, 0x1A, 0x70, 0xFF, 0x15, 0x58, 0xFF, 0x16, 0x58, 0xFF, 0x3F, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x70, 0xFF, 0x17, 0x60, 0xFF, 0x1A, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x88, 0xFF, 0x1B, 0x80, 0xFF, 0x1A, 0x88, 0xFF, 0x5F, 0xB8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x19, 0x80, 0xFF, 0x19, 0x88, 0xFF, 0x17, 0x80, 0xFF, 0x3A, 0x98, 0xFF, 0x18, 0x90, 0xFF, 0x15, 0x88, 0xFF, 0x15, 0x80, 0xFF, 0x14, 0x80, 0xFF, 0x9C, 0xE0, 0xFF, 0x15, 0x90, 0xFF, 0x12, 0x78, 0xFF, 0x11, 0x70, 0xFF, 0x10, 0x78, 0xFF, 0x1C, 0xD8, 0xFF, 0x32, 0x88, 0xFF, 0x10, 0x80, 0xFF, 0x72, 0x90, 0xFF, 0x32, 0x90, 0xFF, 0x17, 0xC1, 0xFF, 0x0F, 0x78, 0xFF, 0x2F, 0x80, 0xFF, 0x4F, 0x80, 0xFF, 0xD3, 0xB8, 0xFF, 0x4E, 0x80, 0xFF, 0x6F, 0x80, 0xFF, 0x8F, 0x88, 0xFF, 0x6F, 0x80, 0xFF, 0x8F, 0x88, 0xFF, 0xD1, 0x98, 0xFF, 0x90, 0x90, 0xFF, 0xAF, 0x90, 0xFF, 0x0F, 0x20, 0xFF, 0x11, 0x20, 0xFF, 0x10, 0x20, 0xFF, 0x12, 0x20, 0xFF, 0x72, 0x38, 0xFF, 0x11, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x10, 0x28, 0xFF, 0x13, 0x28, 0xFF, 0x33, 0x40, 0xFF, 0x10, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x11, 0x30, 0xFF, 0x33, 0x30, 0xFF, 0x16, 0x28, 0xFF, 0x12, 0x28, 0xFF, 0x13, 0x28, 0xFF, 0x75, 0x48, 0xFF, 0x12, 0x28, 0xFF, 0xBF, 0x62, 0xFF, 0x13, 0x28, 0xFF, 0x37, 0x38, 0xFF, 0x5B, 0x6C, 0xFF, 0x9E, 0xB9, 0xFF, 0x1A, 0x60, 0xFF, 0x1A, 0x30, 0xFF, 0x17, 0x38, 0xFF, 0x15, 0x40, 0xFF, 0x14, 0x50, 0xFF, 0x9D, 0x88, 0xFF, 0x14, 0x50, 0xFF, 0x14, 0x50, 0xFF,
-    0x18, 0x48, 0xFF, 0x13, 0x50, 0xFF, 0x3F, 0x98, 0xFF, 0x16, 0x60, 0xFF, 0x16, 0x50, 0xFF, 0x15, 0x58, 0xFF, 0x1B, 0x68, 0xFF, 0x7F, 0xFB, 0xFF, 0x17, 0x68, 0xFF, 0x17, 0x60, 0xFF, 0x19, 0x78, 0xFF, 0x99, 0x98, 0xFF, 0x18, 0x70, 0xFF, 0x17, 0x78, 0xFF, 0x37, 0x78, 0xFF, 0x17, 0x80, 0xFF, 0xFE, 0xE8, 0xFF, 0x16, 0x78, 0xFF, 0x16, 0x78, 0xFF, 0x14, 0x78, 0xFF, 0x36, 0x80, 0xFF, 0xFF, 0xF8, 0xFF, 0x14, 0x80, 0xFF, 0x15, 0x80, 0xFF, 0x13, 0x78, 0xFF, 0x11, 0x70, 0xFF, 0x5F, 0xE8, 0xFF, 0x12, 0x80, 0xFF, 0x10, 0x70, 0xFF, 0x0F, 0x68, 0xFF, 0x31, 0x88, 0xFF, 0x15, 0xA8, 0xFF, 0x10, 0x78, 0xFF, 0x0F, 0x70, 0xFF, 0x0F, 0x78, 0xFF, 0x30, 0x88, 0xFF, 0xD7, 0xC8, 0xFF, 0x4E, 0x78, 0xFF, 0x4F, 0x78, 0xFF, 0x4E, 0x78, 0xFF, 0x2E, 0x78, 0xFF, 0x55, 0xD1, 0xFF, 0x4E, 0x80, 0xFF, 0x8F, 0x88, 0xFF, 0x90, 0x88, 0xFF, 0x6F, 0x88, 0xFF, 0x90, 0x90, 0xFF, 0xAF, 0x90, 0xFF, 0x12, 0x18, 0xFF, 0x10, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x11, 0x30, 0xFF, 0x0F, 0x28, 0xFF, 0x10, 0x20, 0xFF, 0x11, 0x28, 0xFF, 0x12, 0x28, 0xFF, 0x76, 0x48, 0xFF, 0x0F, 0x20, 0xFF, 0x17, 0x30, 0xFF, 0x10, 0x30, 0xFF, 0x12, 0x28, 0xFF, 0x77, 0x48, 0xFF, 0x13, 0x28, 0xFF,
-    0x11, 0x28, 0xFF, 0x32, 0x30, 0xFF, 0x1B, 0x28, 0xFF, 0x12, 0x30, 0xFF, 0x12, 0x30, 0xFF, 0x18, 0x28, 0xFF, 0x18, 0x20, 0xFF, 0x16, 0x38, 0xFF, 0x15, 0x30, 0xFF, 0x14, 0x38, 0xFF, 0x9B, 0x50, 0xFF, 0x13, 0x40, 0xFF, 0x3E, 0x58, 0xFF, 0x14, 0x48, 0xFF, 0x18, 0x48, 0xFF, 0x14, 0x50, 0xFF, 0x14, 0x48, 0xFF, 0x95, 0x70, 0xFF, 0xBE, 0xC1, 0xFF, 0x18, 0x70, 0xFF, 0x13, 0x50, 0xFF, 0x14, 0x50, 0xFF, 0x14, 0x58, 0xFF, 0x1B, 0x88, 0xFF, 0x16, 0x68, 0xFF, 0x15, 0x58, 0xFF, 0x18, 0x78, 0xFF, 0xBE, 0xB0, 0xFF, 0x1E, 0xD0, 0xFF, 0x17, 0x78, 0xFF, 0x14, 0x68, 0xFF, 0x18, 0x98, 0xFF, 0x9C, 0xDB, 0xFF, 0x5F, 0xFA, 0xFF, 0x99, 0x90, 0xFF, 0x1A, 0xC1, 0xFF, 0x3F, 0xEB, 0xFF, 0x13, 0x78, 0xFF, 0x1D, 0xE8, 0xFF, 0xDD, 0xD9, 0xFF, 0x13, 0x80, 0xFF, 0x11, 0x68, 0xFF, 0x11, 0x78, 0xFF, 0x9D, 0xE8, 0xFF, 0x73, 0x98, 0xFF, 0xB3, 0x98, 0xFF, 0xF0, 0xA0, 0xFF, 0x0F, 0x70, 0xFF, 0x18, 0xC0, 0xFF, 0x0E, 0x70, 0xFF, 0x0D, 0x70, 0xFF, 0x0C, 0x70, 0xFF, 0x0F, 0x80, 0xFF, 0xF6, 0xB0, 0xFF, 0xB3, 0xB8, 0xFF, 0x6E, 0x78, 0xFF, 0x4D, 0x78, 0xFF, 0x2D, 0x70, 0xFF, 0x13, 0xA9, 0xFF, 0x12, 0xC1, 0xFF, 0x8F, 0x80, 0xFF, 0xB0, 0x90, 0xFF, 0xB0, 0x90, 0xFF, 0xF0, 0x90, 0xFF,
-    0x0F, 0x20, 0xFF, 0x0E, 0x20, 0xFF, 0x96, 0x48, 0xFF, 0x31, 0x38, 0xFF, 0x0E, 0x20, 0xFF, 0x38, 0x30, 0xFF, 0x10, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x13, 0x40, 0xFF, 0x35, 0x30, 0xFF, 0x14, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x15, 0x40, 0xFF, 0x11, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x11, 0x30, 0xFF, 0x78, 0x68, 0xFF, 0x11, 0x30, 0xFF, 0x12, 0x30, 0xFF, 0x13, 0x30, 0xFF, 0x12, 0x38, 0xFF, 0x14, 0x48, 0xFF, 0x1F, 0x38, 0xFF, 0x11, 0x38, 0xFF, 0x14, 0x40, 0xFF, 0x13, 0x38, 0xFF, 0x12, 0x38, 0xFF, 0x13, 0x40, 0xFF, 0x3A, 0x60, 0xFF, 0x15, 0x50, 0xFF, 0x13, 0x48, 0xFF, 0x10, 0x40, 0xFF, 0x5E, 0x80, 0xFF, 0x36, 0x58, 0xFF, 0x12, 0x48, 0xFF, 0x12, 0x48, 0xFF, 0x12, 0x48, 0xFF, 0x15, 0x58, 0xFF, 0x35, 0x60, 0xFF, 0x13, 0x50, 0xFF, 0x1A, 0x78, 0xFF, 0x1E, 0xB2, 0xFF, 0x5C, 0x80, 0xFF, 0x14, 0x68, 0xFF, 0x16, 0x78, 0xFF, 0x16, 0x60, 0xFF, 0x7A, 0x88, 0xFF, 0x14, 0x68, 0xFF, 0x13, 0x68, 0xFF, 0x13, 0x68, 0xFF, 0x18, 0x98, 0xFF, 0x14, 0x78, 0xFF, 0x12, 0x60, 0xFF, 0x32, 0x70, 0xFF, 0x36, 0x90, 0xFF, 0x55, 0x90, 0xFF, 0x10, 0x68, 0xFF, 0x0F, 0x60, 0xFF, 0x0F, 0x68, 0xFF, 0x0E, 0x68, 0xFF, 0x0D, 0x58, 0xFF, 0x0F, 0x68, 0xFF,
-    0x30, 0x78, 0xFF, 0xD3, 0xA0, 0xFF, 0x2F, 0x78, 0xFF, 0x0D, 0x68, 0xFF, 0x2E, 0x70, 0xFF, 0xD1, 0x90, 0xFF, 0x4E, 0x78, 0xFF, 0x4E, 0x70, 0xFF, 0x4E, 0x70, 0xFF, 0x6E, 0x78, 0xFF, 0x6E, 0x78, 0xFF, 0x8F, 0x88, 0xFF, 0x6F, 0x80, 0xFF, 0x6E, 0x80, 0xFF, 0x8F, 0x88, 0xFF, 0xAE, 0x88, 0xFF, 0x0D, 0x20, 0xFF, 0x0D, 0x20, 0xFF, 0x0F, 0x28, 0xFF, 0x57, 0x38, 0xFF, 0x0F, 0x28, 0xFF, 0x10, 0x28, 0xFF, 0x2F, 0x30, 0xFF, 0x0E, 0x28, 0xFF, 0x38, 0x38, 0xFF, 0x10, 0x28, 0xFF, 0x0F, 0x20, 0xFF, 0x10, 0x30, 0xFF, 0x17, 0x40, 0xFF, 0x0F, 0x28, 0xFF, 0x0F, 0x30, 0xFF, 0x0F, 0x28, 0xFF, 0x16, 0x28, 0xFF, 0x10, 0x38, 0xFF, 0x0F, 0x28, 0xFF, 0x17, 0x30, 0xFF, 0x10, 0x28, 0xFF, 0x18, 0x48, 0xFF, 0x11, 0x30, 0xFF, 0x57, 0x40, 0xFF, 0x12, 0x30, 0xFF, 0xBE, 0x92, 0xFF, 0x11, 0x38, 0xFF, 0x3E, 0x48, 0xFF, 0x13, 0x40, 0xFF, 0x15, 0x48, 0xFF, 0x11, 0x40, 0xFF, 0x14, 0x48, 0xFF, 0x16, 0x50, 0xFF, 0x30, 0x50, 0xFF, 0x5D, 0x88, 0xFF, 0x56, 0x68, 0xFF, 0x11, 0x48, 0xFF, 0x11, 0x48, 0xFF, 0x12, 0x48, 0xFF, 0x16, 0x60, 0xFF, 0x34, 0x60, 0xFF, 0x12, 0x48, 0xFF, 0x35, 0x60, 0xFF, 0x18, 0x58, 0xFF, 0x13, 0x58, 0xFF, 0x14, 0x60, 0xFF, 0x15, 0x70, 0xFF, 0x13, 0x58, 0xFF,
-    0x3B, 0x88, 0xFF, 0x12, 0x60, 0xFF, 0x14, 0x70, 0xFF, 0x10, 0x58, 0xFF, 0x13, 0x78, 0xFF, 0x10, 0x58, 0xFF, 0x34, 0x80, 0xFF, 0x11, 0x68, 0xFF, 0x31, 0x70, 0xFF, 0x9A, 0xB0, 0xFF, 0x53, 0x80, 0xFF, 0x0E, 0x60, 0xFF, 0x0D, 0x58, 0xFF, 0x0C, 0x58, 0xFF, 0xD4, 0x98, 0xFF, 0x2E, 0x68, 0xFF, 0x2E, 0x68, 0xFF, 0x2F, 0x78, 0xFF, 0x73, 0xA0, 0xFF, 0x0D, 0x60, 0xFF, 0x2E, 0x68, 0xFF, 0x2D, 0x68, 0xFF, 0xF1, 0x88, 0xFF, 0xF2, 0xA8, 0xFF, 0x4D, 0x70, 0xFF, 0x2D, 0x70, 0xFF, 0x6E, 0x78, 0xFF, 0x6E, 0x78, 0xFF, 0xB0, 0x88, 0xFF, 0x6F, 0x80, 0xFF, 0x4E, 0x80, 0xFF, 0xCF, 0x88, 0xFF, 0x0E, 0x20, 0xFF, 0x33, 0x28, 0xFF, 0x33, 0x30, 0xFF, 0x0E, 0x20, 0xFF, 0x0E, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x38, 0x38, 0xFF, 0x33, 0x30, 0xFF, 0x0F, 0x28, 0xFF, 0x0E, 0x20, 0xFF, 0x0E, 0x20, 0xFF, 0x17, 0x40, 0xFF, 0x0E, 0x28, 0xFF, 0x0F, 0x30, 0xFF, 0x0E, 0x28, 0xFF, 0x17, 0x30, 0xFF, 0x10, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x37, 0x38, 0xFF, 0x10, 0x30, 0xFF, 0x59, 0x58, 0xFF, 0x0F, 0x30, 0xFF, 0x11, 0x30, 0xFF, 0x33, 0x40, 0xFF, 0x10, 0x30, 0xFF, 0x18, 0x50, 0xFF, 0x10, 0x38, 0xFF, 0x36, 0x48, 0xFF, 0x10, 0x38, 0xFF, 0x10, 0x38, 0xFF, 0x10, 0x40, 0xFF, 0x11, 0x40, 0xFF,
-    0x12, 0x40, 0xFF, 0x0F, 0x48, 0xFF, 0x15, 0x58, 0xFF, 0x34, 0x60, 0xFF, 0x11, 0x48, 0xFF, 0x10, 0x40, 0xFF, 0x33, 0x58, 0xFF, 0x16, 0x50, 0xFF, 0x54, 0x60, 0xFF, 0x11, 0x48, 0xFF, 0x13, 0x58, 0xFF, 0x16, 0x58, 0xFF, 0x12, 0x50, 0xFF, 0x12, 0x58, 0xFF, 0x11, 0x50, 0xFF, 0x11, 0x58, 0xFF, 0x13, 0x60, 0xFF, 0x12, 0x68, 0xFF, 0x11, 0x60, 0xFF, 0x10, 0x58, 0xFF, 0x10, 0x60, 0xFF, 0x10, 0x60, 0xFF, 0x10, 0x60, 0xFF, 0x10, 0x68, 0xFF, 0x30, 0x68, 0xFF, 0x0E, 0x58, 0xFF, 0x10, 0x70, 0xFF, 0x0E, 0x60, 0xFF, 0x0D, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x0D, 0x58, 0xFF, 0x2E, 0x68, 0xFF, 0x4E, 0x68, 0xFF, 0x4E, 0x68, 0xFF, 0x0D, 0x68, 0xFF, 0x0D, 0x60, 0xFF, 0x0D, 0x60, 0xFF, 0x0D, 0x60, 0xFF, 0x2D, 0x68, 0xFF, 0x2D, 0x68, 0xFF, 0x4E, 0x70, 0xFF, 0x2D, 0x68, 0xFF, 0x4E, 0x70, 0xFF, 0x4E, 0x78, 0xFF, 0x8F, 0x80, 0xFF, 0x8F, 0x80, 0xFF, 0x90, 0x88, 0xFF, 0x6E, 0x80, 0xFF, 0x0D, 0x20, 0xFF, 0x0E, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x0D, 0x20, 0xFF, 0x0D, 0x20, 0xFF, 0x0E, 0x20, 0xFF, 0x10, 0x28, 0xFF, 0x2E, 0x30, 0xFF, 0x0D, 0x28, 0xFF, 0x0E, 0x28, 0xFF, 0x75, 0x38, 0xFF, 0x0E, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x0F, 0x30, 0xFF, 0x19, 0x38, 0xFF, 0x0F, 0x28, 0xFF,
-    0x30, 0x30, 0xFF, 0x0F, 0x30, 0xFF, 0x75, 0x48, 0xFF, 0x38, 0x50, 0xFF, 0x0E, 0x28, 0xFF, 0x19, 0x30, 0xFF, 0x10, 0x30, 0xFF, 0x10, 0x38, 0xFF, 0x17, 0x60, 0xFF, 0x11, 0x38, 0xFF, 0x11, 0x38, 0xFF, 0x10, 0x30, 0xFF, 0x15, 0x40, 0xFF, 0x18, 0x68, 0xFF, 0x10, 0x38, 0xFF, 0x10, 0x40, 0xFF, 0x10, 0x38, 0xFF, 0x10, 0x48, 0xFF, 0x1B, 0x80, 0xFF, 0x33, 0x58, 0xFF, 0x10, 0x48, 0xFF, 0x10, 0x40, 0xFF, 0x33, 0x58, 0xFF, 0x3C, 0x88, 0xFF, 0x53, 0x60, 0xFF, 0x10, 0x48, 0xFF, 0x13, 0x58, 0xFF, 0x17, 0x70, 0xFF, 0x11, 0x50, 0xFF, 0x10, 0x50, 0xFF, 0x11, 0x58, 0xFF, 0x16, 0x78, 0xFF, 0x14, 0x60, 0xFF, 0x31, 0x60, 0xFF, 0x10, 0x58, 0xFF, 0x15, 0x80, 0xFF, 0x37, 0x99, 0xFF, 0x1B, 0xA8, 0xFF, 0x0F, 0x58, 0xFF, 0x0F, 0x58, 0xFF, 0x0E, 0x58, 0xFF, 0x0E, 0x58, 0xFF, 0x5A, 0xB0, 0xFF, 0x0E, 0x58, 0xFF, 0xF1, 0x80, 0xFF, 0x0C, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x30, 0x88, 0xFF, 0x0C, 0x60, 0xFF, 0x0C, 0x60, 0xFF, 0x2D, 0x60, 0xFF, 0x0C, 0x60, 0xFF, 0x0D, 0x70, 0xFF, 0x0C, 0x60, 0xFF, 0x2D, 0x60, 0xFF, 0x2D, 0x60, 0xFF, 0x2D, 0x68, 0xFF, 0x4E, 0x78, 0xFF, 0x4E, 0x70, 0xFF, 0x6E, 0x70, 0xFF, 0x6E, 0x78, 0xFF, 0x8F, 0x80, 0xFF, 0x6F, 0x80, 0xFF, 0xAF, 0x88, 0xFF,
-    0x0F, 0x20, 0xFF, 0x2E, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x0E, 0x20, 0xFF, 0x58, 0x30, 0xFF, 0x2E, 0x30, 0xFF, 0x0D, 0x30, 0xFF, 0x0D, 0x28, 0xFF, 0x18, 0x30, 0xFF, 0x0D, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x15, 0x30, 0xFF, 0x0E, 0x28, 0xFF, 0x0E, 0x30, 0xFF, 0x0F, 0x28, 0xFF, 0x34, 0x40, 0xFF, 0x11, 0x38, 0xFF, 0x0F, 0x30, 0xFF, 0x12, 0x20, 0xFF, 0x0F, 0x30, 0xFF, 0x59, 0x50, 0xFF, 0x10, 0x30, 0xFF, 0x1B, 0x38, 0xFF, 0x10, 0x38, 0xFF, 0x12, 0x40, 0xFF, 0x10, 0x30, 0xFF, 0x10, 0x38, 0xFF, 0x10, 0x38, 0xFF, 0x72, 0x50, 0xFF, 0x10, 0x40, 0xFF, 0x0F, 0x38, 0xFF, 0x11, 0x50, 0xFF, 0x37, 0x70, 0xFF, 0xBE, 0xBA, 0xFF, 0x10, 0x48, 0xFF, 0x0F, 0x38, 0xFF, 0x10, 0x40, 0xFF, 0x5B, 0x78, 0xFF, 0x11, 0x58, 0xFF, 0x10, 0x48, 0xFF, 0x53, 0x68, 0xFF, 0xD9, 0x88, 0xFF, 0x3F, 0xB8, 0xFF, 0x10, 0x50, 0xFF, 0x10, 0x50, 0xFF, 0x10, 0x50, 0xFF, 0x77, 0xA9, 0xFF, 0x5E, 0xC0, 0xFF, 0x11, 0x60, 0xFF, 0x0F, 0x58, 0xFF, 0x10, 0x60, 0xFF, 0x54, 0x80, 0xFF, 0x7A, 0xC0, 0xFF, 0x50, 0x78, 0xFF, 0x74, 0x99, 0xFF, 0x0E, 0x60, 0xFF, 0xF1, 0x90, 0xFF, 0x18, 0xB0, 0xFF, 0x0C, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x2D, 0x68, 0xFF,
-    0x15, 0xA8, 0xFF, 0x0B, 0x68, 0xFF, 0x0C, 0x60, 0xFF, 0x0C, 0x58, 0xFF, 0x4C, 0x68, 0xFF, 0x94, 0xA8, 0xFF, 0xD0, 0x88, 0xFF, 0x2D, 0x60, 0xFF, 0x2D, 0x60, 0xFF, 0x4D, 0x68, 0xFF, 0xD2, 0xA0, 0xFF, 0x13, 0xB1, 0xFF, 0x6E, 0x70, 0xFF, 0x4D, 0x70, 0xFF, 0x8F, 0x80, 0xFF, 0xAE, 0x80, 0xFF, 0x2E, 0x28, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x75, 0x50, 0xFF, 0x34, 0x30, 0xFF, 0x2D, 0x28, 0xFF, 0x4D, 0x30, 0xFF, 0x0D, 0x28, 0xFF, 0x35, 0x50, 0xFF, 0x0E, 0x28, 0xFF, 0x0C, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x34, 0x40, 0xFF, 0x55, 0x50, 0xFF, 0x0D, 0x20, 0xFF, 0x0F, 0x28, 0xFF, 0x19, 0x28, 0xFF, 0x95, 0x50, 0xFF, 0x77, 0x60, 0xFF, 0x10, 0x30, 0xFF, 0x12, 0x30, 0xFF, 0x18, 0x48, 0xFF, 0x0F, 0x30, 0xFF, 0x12, 0x38, 0xFF, 0x11, 0x28, 0xFF, 0x11, 0x38, 0xFF, 0x11, 0x30, 0xFF, 0x39, 0x40, 0xFF, 0x10, 0x38, 0xFF, 0x10, 0x38, 0xFF, 0x37, 0x68, 0xFF, 0x34, 0x48, 0xFF, 0x0F, 0x38, 0xFF, 0x10, 0x48, 0xFF, 0x38, 0x70, 0xFF, 0x31, 0x58, 0xFF, 0x0F, 0x40, 0xFF, 0x0E, 0x38, 0xFF, 0x0F, 0x40, 0xFF, 0x9C, 0x98, 0xFF, 0x10, 0x50, 0xFF, 0x0F, 0x40, 0xFF, 0x31, 0x58, 0xFF, 0x19, 0x80, 0xFF, 0x12, 0x60, 0xFF, 0x10, 0x50, 0xFF, 0x0F, 0x50, 0xFF, 0x0F, 0x50, 0xFF,
-    0x0F, 0x50, 0xFF, 0x11, 0x60, 0xFF, 0x10, 0x58, 0xFF, 0x0E, 0x58, 0xFF, 0xD5, 0x88, 0xFF, 0x0D, 0x50, 0xFF, 0x53, 0x78, 0xFF, 0x0D, 0x50, 0xFF, 0x0D, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x2E, 0x60, 0xFF, 0x0C, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x0C, 0x58, 0xFF, 0x0B, 0x50, 0xFF, 0x0D, 0x68, 0xFF, 0x0B, 0x58, 0xFF, 0x2B, 0x58, 0xFF, 0x2C, 0x60, 0xFF, 0x0B, 0x58, 0xFF, 0x0C, 0x60, 0xFF, 0x2C, 0x60, 0xFF, 0x4D, 0x60, 0xFF, 0x2D, 0x68, 0xFF, 0x4D, 0x68, 0xFF, 0x4D, 0x68, 0xFF, 0x6E, 0x70, 0xFF, 0x6D, 0x70, 0xFF, 0x6E, 0x78, 0xFF, 0xAD, 0x78, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x31, 0x30, 0xFF, 0x0C, 0x20, 0xFF, 0x2C, 0x28, 0xFF, 0x2C, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x71, 0x38, 0xFF, 0x0D, 0x28, 0xFF, 0x0C, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x34, 0x38, 0xFF, 0x2E, 0x30, 0xFF, 0x0D, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0xDD, 0x51, 0xFF, 0x14, 0x40, 0xFF, 0x0E, 0x38, 0xFF, 0x0D, 0x28, 0xFF, 0x10, 0x18, 0xFF, 0x17, 0x30, 0xFF, 0x53, 0x38, 0xFF, 0x10, 0x38, 0xFF, 0x14, 0x40, 0xFF, 0x0F, 0x30, 0xFF, 0x59, 0x60, 0xFF, 0x33, 0x40, 0xFF, 0x17, 0x40, 0xFF, 0x0F, 0x38, 0xFF, 0x10, 0x40, 0xFF, 0x11, 0x48, 0xFF, 0x33, 0x48, 0xFF,
-    0x0E, 0x38, 0xFF, 0x0E, 0x40, 0xFF, 0x17, 0x68, 0xFF, 0x30, 0x58, 0xFF, 0x0E, 0x40, 0xFF, 0x0F, 0x40, 0xFF, 0x0E, 0x40, 0xFF, 0x15, 0x68, 0xFF, 0x10, 0x50, 0xFF, 0x0E, 0x40, 0xFF, 0x0E, 0x48, 0xFF, 0x16, 0x70, 0xFF, 0x31, 0x60, 0xFF, 0x10, 0x58, 0xFF, 0x0E, 0x48, 0xFF, 0x11, 0x58, 0xFF, 0x17, 0x88, 0xFF, 0x0E, 0x50, 0xFF, 0x0E, 0x50, 0xFF, 0x0D, 0x48, 0xFF, 0x10, 0x60, 0xFF, 0x0D, 0x50, 0xFF, 0x0D, 0x50, 0xFF, 0x0D, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x35, 0x90, 0xFF, 0x0C, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x0B, 0x48, 0xFF, 0x73, 0x90, 0xFF, 0x0C, 0x58, 0xFF, 0x0B, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0xB2, 0x90, 0xFF, 0x2B, 0x58, 0xFF, 0x2B, 0x58, 0xFF, 0x0B, 0x58, 0xFF, 0x0B, 0x58, 0xFF, 0xF1, 0x98, 0xFF, 0x2C, 0x60, 0xFF, 0x4D, 0x68, 0xFF, 0x4D, 0x68, 0xFF, 0x4D, 0x68, 0xFF, 0x4E, 0x68, 0xFF, 0x6E, 0x78, 0xFF, 0x6E, 0x70, 0xFF, 0xCE, 0x78, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x28, 0xFF, 0xD7, 0x48, 0xFF, 0x2D, 0x28, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x18, 0xFF, 0x0D, 0x28, 0xFF, 0x2F, 0x30, 0xFF, 0x2E, 0x30, 0xFF, 0x0D, 0x20, 0xFF, 0x0E, 0x28, 0xFF, 0x0E, 0x28, 0xFF,
-    0x51, 0x40, 0xFF, 0x0D, 0x28, 0xFF, 0x0E, 0x30, 0xFF, 0x0F, 0x28, 0xFF, 0x0E, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x10, 0x30, 0xFF, 0x0F, 0x30, 0xFF, 0x0F, 0x30, 0xFF, 0x12, 0x30, 0xFF, 0x0F, 0x30, 0xFF, 0x0F, 0x38, 0xFF, 0xD5, 0x50, 0xFF, 0x0F, 0x38, 0xFF, 0x0E, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x0E, 0x40, 0xFF, 0xB5, 0x60, 0xFF, 0x0E, 0x40, 0xFF, 0x0D, 0x40, 0xFF, 0x0E, 0x40, 0xFF, 0x0F, 0x48, 0xFF, 0x10, 0x48, 0xFF, 0x0F, 0x50, 0xFF, 0x0E, 0x40, 0xFF, 0x0F, 0x50, 0xFF, 0x53, 0x68, 0xFF, 0x0D, 0x40, 0xFF, 0x0E, 0x50, 0xFF, 0x2F, 0x58, 0xFF, 0x54, 0x70, 0xFF, 0x0E, 0x50, 0xFF, 0x0E, 0x50, 0xFF, 0x0E, 0x50, 0xFF, 0x53, 0x78, 0xFF, 0x2F, 0x68, 0xFF, 0x11, 0x68, 0xFF, 0x0C, 0x50, 0xFF, 0x0F, 0x60, 0xFF, 0x0C, 0x48, 0xFF, 0x0C, 0x48, 0xFF, 0xDA, 0xC9, 0xFF, 0x2F, 0x70, 0xFF, 0x0B, 0x50, 0xFF, 0x0B, 0x48, 0xFF, 0x0B, 0x50, 0xFF, 0x13, 0x99, 0xFF, 0x0B, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x0A, 0x50, 0xFF, 0xF0, 0x88, 0xFF, 0x2A, 0x58, 0xFF, 0x2B, 0x58, 0xFF, 0x0B, 0x58, 0xFF, 0xF1, 0x90, 0xFF, 0x4D, 0x70, 0xFF, 0x4D, 0x60, 0xFF, 0x4D, 0x60, 0xFF, 0x4D, 0x68, 0xFF, 0x6E, 0x70, 0xFF, 0x8F, 0x78, 0xFF, 0xAE, 0x78, 0xFF,
-    0x33, 0x38, 0xFF, 0x0C, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x91, 0x38, 0xFF, 0x34, 0x40, 0xFF, 0x0C, 0x20, 0xFF, 0x2D, 0x28, 0xFF, 0x0B, 0x20, 0xFF, 0x0E, 0x20, 0xFF, 0x34, 0x40, 0xFF, 0x0D, 0x30, 0xFF, 0x2D, 0x28, 0xFF, 0x0D, 0x28, 0xFF, 0x35, 0x40, 0xFF, 0x0E, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x12, 0x30, 0xFF, 0x36, 0x50, 0xFF, 0x0E, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x17, 0x48, 0xFF, 0x11, 0x28, 0xFF, 0x35, 0x58, 0xFF, 0x12, 0x28, 0xFF, 0x16, 0x40, 0xFF, 0x10, 0x30, 0xFF, 0x0E, 0x30, 0xFF, 0x16, 0x60, 0xFF, 0x0F, 0x40, 0xFF, 0x0D, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x0D, 0x40, 0xFF, 0x38, 0x70, 0xFF, 0x2E, 0x48, 0xFF, 0x0E, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x58, 0x78, 0xFF, 0x0F, 0x50, 0xFF, 0x0D, 0x40, 0xFF, 0x4F, 0x50, 0xFF, 0x0D, 0x48, 0xFF, 0x0D, 0x48, 0xFF, 0x0D, 0x40, 0xFF, 0x0D, 0x40, 0xFF, 0x0D, 0x48, 0xFF, 0x0D, 0x48, 0xFF, 0x0D, 0x50, 0xFF, 0x0D, 0x50, 0xFF, 0x0C, 0x48, 0xFF, 0x2D, 0x50, 0xFF, 0x0D, 0x50, 0xFF, 0x0B, 0x48, 0xFF, 0x0C, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x0B, 0x40, 0xFF, 0x51, 0x78, 0xFF, 0x0B, 0x50, 0xFF, 0x0B, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x0B, 0x48, 0xFF, 0x2C, 0x60, 0xFF,
-    0x0B, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x2A, 0x48, 0xFF, 0x0A, 0x58, 0xFF, 0x2A, 0x50, 0xFF, 0x4B, 0x58, 0xFF, 0x4B, 0x58, 0xFF, 0x4C, 0x58, 0xFF, 0x4C, 0x58, 0xFF, 0x2C, 0x58, 0xFF, 0x4C, 0x60, 0xFF, 0x6D, 0x68, 0xFF, 0x8E, 0x70, 0xFF, 0x6D, 0x70, 0xFF, 0xAE, 0x78, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x28, 0xFF, 0x0B, 0x28, 0xFF, 0x0B, 0x20, 0xFF, 0x0F, 0x18, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x4D, 0x38, 0xFF, 0x12, 0x28, 0xFF, 0x4D, 0x30, 0xFF, 0x0C, 0x20, 0xFF, 0x2D, 0x28, 0xFF, 0x2D, 0x30, 0xFF, 0xB4, 0x40, 0xFF, 0x0E, 0x28, 0xFF, 0x0D, 0x28, 0xFF, 0x53, 0x59, 0xFF, 0x13, 0x38, 0xFF, 0x0F, 0x30, 0xFF, 0x0F, 0x28, 0xFF, 0x0F, 0x28, 0xFF, 0x9A, 0x40, 0xFF, 0x32, 0x20, 0xFF, 0x13, 0x20, 0xFF, 0x0F, 0x28, 0xFF, 0x36, 0x30, 0xFF, 0x15, 0x48, 0xFF, 0x11, 0x28, 0xFF, 0x0F, 0x38, 0xFF, 0x0F, 0x30, 0xFF, 0x51, 0x50, 0xFF, 0x0D, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x15, 0x60, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0D, 0x40, 0xFF, 0x2E, 0x38, 0xFF, 0x56, 0x68, 0xFF, 0x0E, 0x50, 0xFF, 0x0C, 0x38, 0xFF, 0x0D, 0x48, 0xFF, 0xFA, 0x90, 0xFF, 0x18, 0x90, 0xFF, 0x0C, 0x48, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x48, 0xFF,
-    0x0F, 0x48, 0xFF, 0x38, 0x98, 0xFF, 0x0C, 0x48, 0xFF, 0x0D, 0x48, 0xFF, 0x11, 0x60, 0xFF, 0x50, 0x68, 0xFF, 0x58, 0xB0, 0xFF, 0x0C, 0x50, 0xFF, 0x51, 0x70, 0xFF, 0x0B, 0x48, 0xFF, 0x4C, 0x60, 0xFF, 0x15, 0x98, 0xFF, 0x0B, 0x48, 0xFF, 0x0B, 0x50, 0xFF, 0x0A, 0x48, 0xFF, 0x2B, 0x48, 0xFF, 0x75, 0x98, 0xFF, 0x52, 0x99, 0xFF, 0x0A, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0xB3, 0xA0, 0xFF, 0x09, 0x50, 0xFF, 0x2A, 0x50, 0xFF, 0x4B, 0x58, 0xFF, 0x0A, 0x50, 0xFF, 0xD1, 0x98, 0xFF, 0x4E, 0x80, 0xFF, 0x4D, 0x68, 0xFF, 0x2C, 0x60, 0xFF, 0x4C, 0x68, 0xFF, 0xAD, 0x70, 0xFF, 0x0C, 0x20, 0xFF, 0x4C, 0x28, 0xFF, 0x2C, 0x28, 0xFF, 0x53, 0x48, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x28, 0xFF, 0x13, 0x48, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x74, 0x50, 0xFF, 0x0D, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x0E, 0x28, 0xFF, 0x0D, 0x28, 0xFF, 0x55, 0x58, 0xFF, 0x0F, 0x20, 0xFF, 0x10, 0x20, 0xFF, 0x32, 0x20, 0xFF, 0x12, 0x20, 0xFF, 0x13, 0x28, 0xFF, 0x10, 0x30, 0xFF, 0x13, 0x30, 0xFF, 0x13, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x0E, 0x30, 0xFF, 0x0F, 0x38, 0xFF, 0x0E, 0x40, 0xFF, 0x0C, 0x30, 0xFF,
-    0x0C, 0x30, 0xFF, 0x0D, 0x40, 0xFF, 0x11, 0x40, 0xFF, 0x0D, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x19, 0x88, 0xFF, 0x0D, 0x48, 0xFF, 0x0D, 0x38, 0xFF, 0x0D, 0x40, 0xFF, 0x0E, 0x48, 0xFF, 0x38, 0x98, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x40, 0xFF, 0x54, 0x78, 0xFF, 0x95, 0x88, 0xFF, 0x0C, 0x48, 0xFF, 0x0B, 0x40, 0xFF, 0x0E, 0x60, 0xFF, 0x0B, 0x48, 0xFF, 0x2B, 0x48, 0xFF, 0x0B, 0x48, 0xFF, 0x4D, 0x60, 0xFF, 0x73, 0x88, 0xFF, 0x0B, 0x48, 0xFF, 0x0B, 0x50, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x0C, 0x58, 0xFF, 0x09, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x2A, 0x50, 0xFF, 0xD0, 0x88, 0xFF, 0xB2, 0x91, 0xFF, 0x09, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x0A, 0x50, 0xFF, 0xAE, 0x78, 0xFF, 0x4A, 0x58, 0xFF, 0x2A, 0x58, 0xFF, 0x4B, 0x58, 0xFF, 0x4C, 0x60, 0xFF, 0x8D, 0x68, 0xFF, 0x4D, 0x68, 0xFF, 0x6D, 0x68, 0xFF, 0x8C, 0x70, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0E, 0x18, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x2B, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x11, 0x38, 0xFF, 0x0C, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0D, 0x28, 0xFF,
-    0x53, 0x48, 0xFF, 0x0D, 0x20, 0xFF, 0x10, 0x18, 0xFF, 0x11, 0x20, 0xFF, 0x12, 0x20, 0xFF, 0x11, 0x28, 0xFF, 0x14, 0x20, 0xFF, 0x11, 0x20, 0xFF, 0x0F, 0x28, 0xFF, 0x33, 0x48, 0xFF, 0x12, 0x28, 0xFF, 0x10, 0x30, 0xFF, 0x0E, 0x38, 0xFF, 0x0E, 0x30, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x35, 0x68, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0xD5, 0x70, 0xFF, 0x0D, 0x48, 0xFF, 0x0C, 0x38, 0xFF, 0x0D, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x40, 0xFF, 0x52, 0x68, 0xFF, 0x0C, 0x48, 0xFF, 0x0D, 0x50, 0xFF, 0x0B, 0x40, 0xFF, 0x2D, 0x58, 0xFF, 0x0B, 0x48, 0xFF, 0x0B, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x0B, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x09, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x2A, 0x50, 0xFF, 0x2A, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x08, 0x48, 0xFF, 0x49, 0x50, 0xFF, 0x29, 0x50, 0xFF, 0x2A, 0x50, 0xFF, 0x2A, 0x58, 0xFF, 0x4B, 0x58, 0xFF, 0x6C, 0x60, 0xFF, 0x4D, 0x60, 0xFF, 0x6C, 0x68, 0xFF, 0x6C, 0x68, 0xFF,
-    0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0A, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x52, 0x30, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x28, 0xFF, 0x0C, 0x20, 0xFF, 0x0E, 0x20, 0xFF, 0x0D, 0x28, 0xFF, 0x0D, 0x20, 0xFF, 0x0F, 0x18, 0xFF, 0x10, 0x20, 0xFF, 0x12, 0x20, 0xFF, 0x12, 0x20, 0xFF, 0x15, 0x20, 0xFF, 0x15, 0x18, 0xFF, 0x12, 0x28, 0xFF, 0x13, 0x30, 0xFF, 0x38, 0x20, 0xFF, 0x13, 0x28, 0xFF, 0x10, 0x30, 0xFF, 0x98, 0x58, 0xFF, 0x0E, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x0E, 0x38, 0xFF, 0x0D, 0x40, 0xFF, 0x1A, 0x70, 0xFF, 0x2D, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x34, 0x68, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x52, 0x68, 0xFF, 0x0C, 0x40, 0xFF, 0x0B, 0x38, 0xFF, 0x0C, 0x40, 0xFF, 0x0F, 0x58, 0xFF, 0x0C, 0x48, 0xFF, 0x0B, 0x40, 0xFF, 0x0B, 0x40, 0xFF, 0x2C, 0x50, 0xFF, 0x55, 0x90, 0xFF, 0x0B, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0xD4, 0x98, 0xFF, 0x09, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x09, 0x40, 0xFF, 0xD1, 0x88, 0xFF,
-    0x09, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x2A, 0x50, 0xFF, 0x10, 0x89, 0xFF, 0x29, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x8D, 0x68, 0xFF, 0xF0, 0x88, 0xFF, 0x29, 0x50, 0xFF, 0x6B, 0x58, 0xFF, 0x4B, 0x58, 0xFF, 0x4C, 0x60, 0xFF, 0x6D, 0x68, 0xFF, 0xAD, 0x70, 0xFF, 0x55, 0x38, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x2C, 0x28, 0xFF, 0x0B, 0x20, 0xFF, 0x32, 0x38, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x28, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x28, 0xFF, 0x52, 0x40, 0xFF, 0x0C, 0x28, 0xFF, 0x0C, 0x20, 0xFF, 0x2D, 0x28, 0xFF, 0x11, 0x30, 0xFF, 0x0F, 0x20, 0xFF, 0x4E, 0x30, 0xFF, 0x11, 0x18, 0xFF, 0x14, 0x10, 0xFF, 0x14, 0x18, 0xFF, 0x12, 0x20, 0xFF, 0x15, 0x10, 0xFF, 0x19, 0x00, 0xFF, 0x1A, 0x08, 0xFF, 0x37, 0x50, 0xFF, 0x37, 0x20, 0xFF, 0x1C, 0x08, 0xFF, 0x16, 0x28, 0xFF, 0x32, 0x30, 0xFF, 0x36, 0x58, 0xFF, 0x0F, 0x38, 0xFF, 0x10, 0x38, 0xFF, 0x11, 0x40, 0xFF, 0x0E, 0x40, 0xFF, 0x12, 0x58, 0xFF, 0x0D, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x30, 0xFF, 0x0C, 0x38, 0xFF, 0x10, 0x50, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0B, 0x38, 0xFF, 0x0C, 0x40, 0xFF, 0x0B, 0x40, 0xFF, 0x0B, 0x38, 0xFF, 0x0B, 0x40, 0xFF, 0x0B, 0x40, 0xFF,
-    0x0B, 0x40, 0xFF, 0x2C, 0x48, 0xFF, 0x0B, 0x40, 0xFF, 0x0B, 0x40, 0xFF, 0x0B, 0x48, 0xFF, 0x0B, 0x48, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x2A, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x40, 0xFF, 0x09, 0x48, 0xFF, 0x09, 0x40, 0xFF, 0x2A, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x29, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x08, 0x48, 0xFF, 0x49, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x49, 0x50, 0xFF, 0x08, 0x48, 0xFF, 0x4A, 0x58, 0xFF, 0x6B, 0x58, 0xFF, 0x4B, 0x58, 0xFF, 0x6C, 0x60, 0xFF, 0x8C, 0x68, 0xFF, 0x0C, 0x20, 0xFF, 0x0B, 0x18, 0xFF, 0x0B, 0x18, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0A, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0A, 0x18, 0xFF, 0x0C, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x0D, 0x20, 0xFF, 0x0E, 0x28, 0xFF, 0x0E, 0x20, 0xFF, 0x2E, 0x20, 0xFF, 0x13, 0x10, 0xFF, 0x13, 0x18, 0xFF, 0x16, 0x18, 0xFF, 0x34, 0x20, 0xFF, 0x18, 0x10, 0xFF, 0x1C, 0x00, 0xFF, 0x1B, 0x00, 0xFF, 0x38, 0x20, 0xFF, 0x14, 0x20, 0xFF, 0x1C, 0x10, 0xFF, 0x36, 0x28, 0xFF, 0x11, 0x28, 0xFF, 0x14, 0x40, 0xFF, 0x0F, 0x38, 0xFF, 0x0F, 0x38, 0xFF,
-    0x10, 0x40, 0xFF, 0x30, 0x50, 0xFF, 0x54, 0x68, 0xFF, 0x0D, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0D, 0x38, 0xFF, 0x0B, 0x30, 0xFF, 0xB4, 0x78, 0xFF, 0x0B, 0x40, 0xFF, 0x0B, 0x38, 0xFF, 0x0B, 0x38, 0xFF, 0x97, 0x91, 0xFF, 0x15, 0x80, 0xFF, 0x0B, 0x40, 0xFF, 0x0A, 0x38, 0xFF, 0x0A, 0x40, 0xFF, 0x0C, 0x50, 0xFF, 0x19, 0xA9, 0xFF, 0x0B, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x55, 0x98, 0xFF, 0x73, 0x81, 0xFF, 0x09, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x4A, 0x50, 0xFF, 0x76, 0x90, 0xFF, 0xAD, 0x68, 0xFF, 0x29, 0x48, 0xFF, 0x09, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x53, 0x90, 0xFF, 0x8C, 0x68, 0xFF, 0x08, 0x50, 0xFF, 0x08, 0x48, 0xFF, 0x08, 0x48, 0xFF, 0xD2, 0x98, 0xFF, 0x6A, 0x50, 0xFF, 0x49, 0x48, 0xFF, 0x28, 0x40, 0xFF, 0x29, 0x48, 0xFF, 0xB0, 0x90, 0xFF, 0x4A, 0x60, 0xFF, 0x6A, 0x58, 0xFF, 0x6B, 0x60, 0xFF, 0x4A, 0x58, 0xFF, 0x8C, 0x68, 0xFF, 0x0C, 0x18, 0xFF, 0x0C, 0x18, 0xFF, 0x0C, 0x20, 0xFF, 0x32, 0x40, 0xFF, 0x4C, 0x28, 0xFF, 0x0A, 0x18, 0xFF, 0x0B, 0x20, 0xFF, 0x2B, 0x28, 0xFF, 0x53, 0x50, 0xFF, 0x0C, 0x20, 0xFF, 0x0B, 0x20, 0xFF, 0x2C, 0x20, 0xFF, 0x0C, 0x20, 0xFF, 0x93, 0x50, 0xFF, 0x0F, 0x20, 0xFF, 0x12, 0x20, 0xFF,
-    0x0E, 0x20, 0xFF, 0x11, 0x18, 0xFF, 0x55, 0x58, 0xFF, 0x15, 0x08, 0xFF, 0x12, 0x20, 0xFF, 0x38, 0x10, 0xFF, 0x1B, 0x00, 0xFF, 0x1E, 0x00, 0xFF, 0x17, 0x10, 0xFF, 0x13, 0x18, 0xFF, 0x1C, 0x18, 0xFF, 0x16, 0x28, 0xFF, 0x10, 0x28, 0xFF, 0x13, 0x40, 0xFF, 0x0F, 0x38, 0xFF, 0x0F, 0x40, 0xFF, 0x10, 0x40, 0xFF, 0x0E, 0x40, 0xFF, 0x0F, 0x40, 0xFF, 0x0C, 0x38, 0xFF, 0x0B, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x35, 0x78, 0xFF, 0x0B, 0x38, 0xFF, 0x0B, 0x38, 0xFF, 0x0B, 0x38, 0xFF, 0x0B, 0x38, 0xFF, 0x56, 0x80, 0xFF, 0x0B, 0x40, 0xFF, 0x0A, 0x38, 0xFF, 0x0B, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x17, 0xA1, 0xFF, 0x2B, 0x48, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x38, 0xFF, 0x2A, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x29, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x2A, 0x48, 0xFF, 0x09, 0x40, 0xFF, 0x08, 0x38, 0xFF, 0x29, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x29, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x08, 0x40, 0xFF, 0x08, 0x40, 0xFF, 0x08, 0x40, 0xFF, 0x29, 0x48, 0xFF, 0x49, 0x48, 0xFF, 0x69, 0x48, 0xFF, 0x28, 0x48, 0xFF, 0x28, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x49, 0x50, 0xFF, 0x69, 0x58, 0xFF, 0x49, 0x58, 0xFF, 0x6A, 0x58, 0xFF, 0x6B, 0x60, 0xFF,
+    0x84, 0x28, 0x88, 0x51, 0xA6, 0x30, 0xA6, 0x28, 0xC6, 0x30, 0x86, 0x30, 0xC7, 0x30, 0xA6, 0x30, 0xC7, 0x38, 0xA8, 0x38, 0xC8, 0x38, 0xC6, 0x38, 0x07, 0x41, 0xE7, 0x40, 0xE7, 0x38, 0xCB, 0x69, 0xC8, 0x38, 0xE9, 0x38, 0xC8, 0x40, 0xC7, 0x38, 0xE9, 0x40, 0x29, 0x49, 0xE9, 0x40, 0xE9, 0x48, 0xE9, 0x40, 0x0A, 0x49, 0x2A, 0x51, 0x09, 0x49, 0x29, 0x51, 0x29, 0x49, 0x29, 0x49, 0x69, 0x59,
+    0x28, 0x51, 0x68, 0x59, 0xC8, 0x61, 0x88, 0x51, 0x88, 0x51, 0xA6, 0x59, 0x28, 0x6A, 0xE7, 0x61, 0xC7, 0x59, 0x07, 0x62, 0x88, 0x6A, 0x67, 0x6A, 0x47, 0x6A, 0xE8, 0x7A, 0xC7, 0x6A, 0xA6, 0x72, 0x86, 0x6A, 0x06, 0x6B, 0xE6, 0x72, 0xC7, 0x72, 0x86, 0x6A, 0xC6, 0x72, 0xA6, 0x72, 0x86, 0x72, 0x46, 0x6A, 0x46, 0x6A, 0x04, 0x6A, 0x26, 0x6A, 0x06, 0x6A, 0x05, 0x72, 0xC5, 0x61, 0xC5, 0x61,
+    0xC5, 0x69, 0xC5, 0x61, 0xE6, 0x69, 0xE7, 0x69, 0xA6, 0x61, 0xA6, 0x69, 0xC6, 0x69, 0xC6, 0x69, 0xE6, 0x69, 0x48, 0x7A, 0xC6, 0x69, 0xC6, 0x69, 0xE6, 0x71, 0xE7, 0x71, 0x06, 0x72, 0x26, 0x72, 0xA6, 0x30, 0xAB, 0x59, 0xC7, 0x38, 0x86, 0x30, 0xA6, 0x30, 0xA6, 0x30, 0xA7, 0x38, 0x69, 0x51, 0xC6, 0x38, 0xC8, 0x38, 0xC7, 0x38, 0xC6, 0x38, 0xC9, 0x61, 0xAE, 0x59, 0xC7, 0x38, 0x68, 0x49,
+    0xE8, 0x38, 0xCD, 0x69, 0xC7, 0x38, 0xE8, 0x40, 0xC9, 0x40, 0xE9, 0x40, 0x2D, 0x72, 0x09, 0x49, 0x0A, 0x49, 0x0A, 0x49, 0x09, 0x49, 0x09, 0x49, 0x0B, 0x72, 0x28, 0x51, 0x28, 0x51, 0x49, 0x51, 0x48, 0x51, 0x4C, 0x9B, 0xA7, 0x59, 0x87, 0x59, 0x87, 0x59, 0xA7, 0x59, 0x6B, 0x9B, 0xE7, 0x61, 0xC6, 0x59, 0x07, 0x62, 0xC7, 0x7A, 0xCA, 0xAB, 0x47, 0x6A, 0x66, 0x6A, 0xFD, 0xFF, 0xC7, 0x72,
+    0xAB, 0xC4, 0xC6, 0x7A, 0x8F, 0xF7, 0x26, 0x83, 0xC6, 0x7A, 0x09, 0xA4, 0xF2, 0xFF, 0x69, 0xB4, 0x46, 0x72, 0x45, 0x6A, 0x86, 0x7A, 0x4A, 0xCC, 0x05, 0x7A, 0x25, 0x7A, 0x26, 0x72, 0x27, 0x82, 0x48, 0xCC, 0xC5, 0x69, 0xC5, 0x69, 0xC6, 0x69, 0xC6, 0x69, 0xCD, 0xE5, 0xC5, 0x69, 0xE6, 0x71, 0xE6, 0x71, 0xE6, 0x71, 0x6F, 0xFF, 0xC6, 0x69, 0x06, 0x72, 0xE6, 0x69, 0x06, 0x72, 0x47, 0x82,
+    0xC6, 0x30, 0x69, 0x49, 0x46, 0x28, 0x07, 0x41, 0xA6, 0x30, 0xA6, 0x30, 0x86, 0x30, 0x09, 0x41, 0xE8, 0x40, 0xC7, 0x30, 0xA7, 0x38, 0xC6, 0x38, 0x07, 0x49, 0xE8, 0x38, 0xC7, 0x38, 0xA7, 0x38, 0xC9, 0x40, 0xC7, 0x38, 0x09, 0x41, 0xC8, 0x40, 0xEA, 0x40, 0xC9, 0x40, 0xC9, 0x40, 0x0A, 0x49, 0xE9, 0x48, 0x0A, 0x49, 0x09, 0x49, 0x09, 0x49, 0x29, 0x51, 0x68, 0x51, 0x48, 0x51, 0x68, 0x59,
+    0x48, 0x51, 0x0F, 0xBC, 0xA7, 0x59, 0x87, 0x59, 0x87, 0x59, 0xC7, 0x59, 0xE8, 0x69, 0xC6, 0x59, 0xC7, 0x61, 0x07, 0x62, 0x47, 0x6A, 0x87, 0x7A, 0x47, 0x6A, 0x66, 0x6A, 0xA6, 0x6A, 0x87, 0x72, 0xC7, 0x82, 0xE7, 0x7A, 0xE6, 0x7A, 0xC6, 0x7A, 0xA6, 0x7A, 0xA6, 0x7A, 0xA6, 0x72, 0x66, 0x7A, 0x46, 0x72, 0x46, 0x9B, 0x25, 0x72, 0x26, 0x6A, 0x25, 0x72, 0x06, 0x72, 0x06, 0x72, 0xE5, 0x69,
+    0xC5, 0x69, 0xE6, 0x69, 0xC5, 0x69, 0xC6, 0x69, 0xC6, 0x69, 0xE6, 0x69, 0xC6, 0x69, 0xE6, 0x71, 0xC6, 0x69, 0xC6, 0x69, 0xC6, 0x69, 0xC6, 0x69, 0x06, 0x72, 0x06, 0x72, 0x27, 0x7A, 0x46, 0x82, 0xA6, 0x30, 0xC6, 0x30, 0xA6, 0x30, 0xE8, 0x38, 0xA5, 0x30, 0xA7, 0x30, 0x86, 0x30, 0xE7, 0x38, 0x6B, 0x51, 0xA7, 0x30, 0xA7, 0x30, 0xE8, 0x40, 0x07, 0x41, 0x8D, 0x59, 0xE7, 0x40, 0xC7, 0x38,
+    0x2A, 0x49, 0x8C, 0x59, 0xAD, 0x61, 0xC8, 0x40, 0xE9, 0x40, 0xEA, 0x40, 0xCA, 0x40, 0x2D, 0x72, 0xAB, 0x59, 0xEA, 0x48, 0x29, 0x51, 0x2A, 0x51, 0x4C, 0x72, 0x28, 0x51, 0x49, 0x51, 0x68, 0x59, 0x68, 0x59, 0x8A, 0x82, 0x67, 0x59, 0x87, 0x59, 0x88, 0x59, 0xA7, 0x61, 0x6A, 0x93, 0x08, 0x62, 0xC7, 0x61, 0x07, 0x62, 0x6A, 0x84, 0x6B, 0xBC, 0x47, 0x6A, 0x67, 0x6A, 0x44, 0x6A, 0x87, 0x72,
+    0x6B, 0xCD, 0xA6, 0x72, 0xC5, 0x7A, 0xA6, 0x7A, 0xA6, 0x7A, 0x8C, 0xE5, 0x06, 0x8B, 0x66, 0x7A, 0x66, 0x7A, 0x46, 0x72, 0x0B, 0xD5, 0x26, 0x72, 0x25, 0x72, 0x05, 0x72, 0xE4, 0x71, 0x45, 0x82, 0xC5, 0x69, 0xE6, 0x69, 0xE6, 0x69, 0x88, 0xAB, 0xC6, 0x71, 0xE7, 0x71, 0xC6, 0x71, 0xC6, 0x71, 0x0A, 0xBC, 0xE6, 0x71, 0xE6, 0x71, 0xE6, 0x71, 0x06, 0x72, 0x06, 0x7A, 0xA8, 0x8A, 0x67, 0x82,
+    0xC7, 0x38, 0x85, 0x30, 0xC6, 0x30, 0xA7, 0x30, 0xA7, 0x30, 0x49, 0x51, 0xC7, 0x38, 0xC7, 0x30, 0x87, 0x30, 0x87, 0x30, 0xAD, 0x61, 0x07, 0x49, 0xE9, 0x40, 0xE7, 0x38, 0xE7, 0x38, 0x8A, 0x59, 0xCD, 0x71, 0xAD, 0x61, 0xEA, 0x48, 0xAA, 0x38, 0xA8, 0x40, 0x88, 0x40, 0x0A, 0x51, 0xEB, 0x48, 0x8B, 0x61, 0x0A, 0x49, 0x09, 0x49, 0x4D, 0x8A, 0x49, 0x51, 0x07, 0x49, 0x08, 0x51, 0x49, 0x51,
+    0x68, 0x59, 0x67, 0x59, 0x87, 0x59, 0xA8, 0x61, 0xA8, 0x59, 0x44, 0x51, 0x6C, 0xAB, 0xE7, 0x61, 0xE7, 0x61, 0x07, 0x6A, 0x47, 0x72, 0xEB, 0xB3, 0x66, 0x72, 0x87, 0x72, 0xA7, 0x72, 0xC7, 0x7A, 0xC7, 0x7A, 0x6E, 0xFD, 0xE7, 0x82, 0xC6, 0x82, 0xA6, 0x82, 0xE7, 0x8A, 0xED, 0xDC, 0x66, 0x7A, 0x93, 0xF7, 0x45, 0x7A, 0x26, 0x7A, 0x46, 0x7A, 0xEC, 0xF4, 0x46, 0x7A, 0xE4, 0x71, 0x06, 0x72,
+    0xE6, 0x71, 0x0A, 0xDC, 0xE6, 0x79, 0x4D, 0xBC, 0xE6, 0x71, 0xE6, 0x79, 0x26, 0x7A, 0xCA, 0xDB, 0xE6, 0x71, 0x29, 0xA3, 0xE6, 0x71, 0xE6, 0x71, 0x88, 0xCB, 0x06, 0x82, 0x87, 0x82, 0x67, 0x82, 0x4D, 0x59, 0x85, 0x30, 0xA7, 0x30, 0xA6, 0x30, 0x8D, 0x92, 0x11, 0x59, 0xC7, 0x38, 0x87, 0x30, 0xA7, 0x30, 0xA7, 0x38, 0x8E, 0x61, 0x8C, 0x61, 0xA6, 0x38, 0xC8, 0x38, 0xC6, 0x38, 0xE6, 0x40,
+    0x6F, 0x61, 0x0B, 0x49, 0xC8, 0x40, 0xCE, 0x61, 0xC9, 0x40, 0x0A, 0x49, 0xCF, 0x79, 0x69, 0x59, 0x49, 0x51, 0x0A, 0x49, 0x29, 0x51, 0xAE, 0x69, 0xEC, 0x71, 0x28, 0x51, 0x48, 0x51, 0x48, 0x51, 0x68, 0x59, 0x2D, 0x9B, 0xA7, 0x61, 0x88, 0x59, 0xA8, 0x61, 0x86, 0x61, 0x8D, 0xB3, 0x68, 0x7A, 0x47, 0x6A, 0x27, 0x6A, 0xA7, 0x82, 0x2D, 0xDD, 0xEC, 0xAB, 0xA7, 0x7A, 0xC7, 0x7A, 0x4B, 0xC5,
+    0x27, 0x83, 0xD1, 0xFF, 0x28, 0x8B, 0x07, 0x8B, 0x64, 0x8B, 0xE6, 0x82, 0x8D, 0xFD, 0x65, 0x82, 0x86, 0x82, 0xCC, 0xE5, 0x65, 0x7A, 0x66, 0x82, 0x05, 0x7A, 0x69, 0xA3, 0x26, 0x7A, 0x26, 0x72, 0x06, 0x72, 0x24, 0x82, 0x48, 0xAB, 0x06, 0x72, 0xE6, 0x71, 0x06, 0x7A, 0xA7, 0xA2, 0xCC, 0xBB, 0x26, 0x7A, 0xE6, 0x79, 0x06, 0x7A, 0xE6, 0x71, 0xA8, 0x8A, 0x47, 0x82, 0x67, 0x82, 0x67, 0x82,
+    0xA5, 0x30, 0xCA, 0x40, 0x64, 0x28, 0xC7, 0x30, 0x68, 0x49, 0xC8, 0x38, 0x86, 0x30, 0xE7, 0x38, 0x86, 0x30, 0xC7, 0x38, 0xC9, 0x38, 0x48, 0x49, 0xC7, 0x38, 0xC9, 0x38, 0xE7, 0x40, 0x48, 0x51, 0xC6, 0x38, 0xA8, 0x40, 0xAA, 0x61, 0x0B, 0x51, 0xCB, 0x48, 0xC9, 0x40, 0xC9, 0x48, 0x0A, 0x49, 0x07, 0x49, 0xAA, 0x61, 0x29, 0x51, 0x28, 0x51, 0x28, 0x51, 0x28, 0x51, 0x49, 0x51, 0x69, 0x59,
+    0x67, 0x59, 0xCC, 0x92, 0xA7, 0x61, 0xA8, 0x59, 0xC8, 0x61, 0x67, 0x72, 0x0D, 0xB4, 0x27, 0x6A, 0x88, 0x72, 0x47, 0x72, 0x48, 0x83, 0x4E, 0xE5, 0x86, 0x72, 0xC7, 0x7A, 0x27, 0x83, 0x68, 0xA4, 0xA6, 0xA3, 0x47, 0x93, 0x47, 0x8B, 0x67, 0x8B, 0x27, 0x93, 0x06, 0x8B, 0xC6, 0x8A, 0xA6, 0x82, 0x86, 0x82, 0x86, 0x82, 0x65, 0x82, 0x4E, 0xFE, 0x86, 0x82, 0x8A, 0xAB, 0x26, 0x7A, 0x25, 0x72,
+    0xEC, 0xF4, 0x06, 0x7A, 0x06, 0x7A, 0x06, 0x7A, 0x06, 0x7A, 0x86, 0xA2, 0xE5, 0x79, 0xE6, 0x71, 0xE6, 0x79, 0x06, 0x7A, 0x0B, 0xDC, 0x06, 0x7A, 0x47, 0x82, 0x26, 0x7A, 0x87, 0x8A, 0x87, 0x8A, 0xA7, 0x30, 0x2F, 0x39, 0x0F, 0x51, 0xA6, 0x30, 0x27, 0x41, 0xE7, 0x38, 0xE7, 0x40, 0x33, 0x61, 0xC7, 0x38, 0xC9, 0x40, 0xA7, 0x38, 0xA7, 0x38, 0x4D, 0x59, 0xC8, 0x38, 0xC8, 0x38, 0x69, 0x51,
+    0x09, 0x41, 0xA9, 0x40, 0x6D, 0x72, 0xCB, 0x61, 0x6F, 0x59, 0xAA, 0x40, 0xAB, 0x40, 0xEE, 0x79, 0x49, 0x51, 0x8A, 0x61, 0x6A, 0x59, 0x69, 0x59, 0x6C, 0x82, 0xAB, 0x61, 0x28, 0x51, 0x48, 0x51, 0x48, 0x59, 0xCD, 0x92, 0x66, 0x59, 0xA8, 0x59, 0xC8, 0x61, 0x66, 0x7A, 0x2E, 0xBC, 0x47, 0x6A, 0x67, 0x72, 0xA8, 0x7A, 0x08, 0x94, 0x8F, 0xED, 0xA6, 0x7A, 0x07, 0x83, 0x4D, 0xC5, 0xFF, 0xFF,
+    0x2A, 0xD5, 0xC8, 0xA3, 0xA6, 0x9B, 0xEE, 0xF6, 0x67, 0x9B, 0x0D, 0xEE, 0xE7, 0x92, 0xE6, 0x92, 0xEC, 0xDD, 0xC6, 0x92, 0x27, 0xA3, 0xE6, 0x92, 0xA7, 0xA3, 0x86, 0x82, 0x46, 0x82, 0x26, 0x7A, 0x66, 0x82, 0x06, 0x7A, 0x26, 0x82, 0x67, 0x8A, 0x26, 0x82, 0xA7, 0x92, 0x06, 0x7A, 0x06, 0x7A, 0x06, 0x7A, 0x06, 0x7A, 0xA8, 0x92, 0x06, 0x7A, 0x67, 0x8A, 0x47, 0x8A, 0xA7, 0x8A, 0xA7, 0x92,
+    0xA7, 0x30, 0xA5, 0x30, 0x86, 0x30, 0xA8, 0x30, 0x07, 0x41, 0xA6, 0x30, 0xA5, 0x30, 0x66, 0x30, 0xA7, 0x38, 0xC7, 0x38, 0xA8, 0x38, 0xE6, 0x40, 0xA7, 0x38, 0xC7, 0x40, 0xC7, 0x38, 0x08, 0x49, 0x6B, 0x51, 0xE7, 0x40, 0x4B, 0x59, 0x8C, 0x59, 0xE9, 0x40, 0xCA, 0x40, 0x09, 0x49, 0x6C, 0x61, 0x08, 0x49, 0x4A, 0x59, 0xEA, 0x69, 0xAA, 0x61, 0x2D, 0x82, 0x48, 0x59, 0x48, 0x51, 0x48, 0x51,
+    0x87, 0x59, 0xEC, 0x92, 0xA7, 0x61, 0xA8, 0x59, 0xC8, 0x61, 0xA7, 0x7A, 0x0C, 0xB4, 0x47, 0x72, 0x47, 0x72, 0x87, 0x72, 0xA8, 0x9B, 0x8F, 0xF6, 0xC7, 0x82, 0x07, 0x83, 0x08, 0x9D, 0x29, 0xB5, 0x0D, 0xEF, 0xA7, 0x9B, 0xC7, 0x9B, 0x0E, 0xD6, 0x08, 0xA4, 0xF1, 0xFF, 0x27, 0x93, 0xB0, 0xF6, 0xC6, 0x8A, 0xE6, 0x8A, 0x11, 0xFF, 0xC7, 0x92, 0xA6, 0x8A, 0xC6, 0x92, 0xA5, 0x92, 0xA5, 0x92,
+    0x46, 0x82, 0x26, 0x7A, 0x26, 0x82, 0xCB, 0xDC, 0x05, 0x82, 0x26, 0x82, 0x06, 0x7A, 0x06, 0x7A, 0x8A, 0xDC, 0x26, 0x82, 0x47, 0x82, 0x27, 0x82, 0x67, 0x8A, 0x46, 0x8A, 0x28, 0xA3, 0xC7, 0x92, 0xE7, 0x38, 0xC7, 0x38, 0xA6, 0x30, 0x88, 0x38, 0xCE, 0x48, 0x28, 0x41, 0x07, 0x41, 0x85, 0x30, 0xAB, 0x40, 0x4D, 0x51, 0xEA, 0x48, 0xE9, 0x40, 0xA7, 0x38, 0x0C, 0x49, 0x30, 0x51, 0x09, 0x49,
+    0xC6, 0x40, 0xE9, 0x48, 0x88, 0x59, 0x2B, 0x51, 0xE9, 0x48, 0x6E, 0x59, 0xC9, 0x40, 0x09, 0x49, 0xCC, 0x61, 0x29, 0x51, 0x8A, 0x59, 0x89, 0x59, 0x49, 0x59, 0x49, 0x59, 0x49, 0x51, 0x69, 0x61, 0x67, 0x61, 0x4C, 0x82, 0xA7, 0x69, 0xA8, 0x61, 0xC8, 0x61, 0x68, 0x8B, 0x08, 0x72, 0x27, 0x6A, 0x68, 0x72, 0x87, 0x7A, 0x47, 0x93, 0x09, 0xA4, 0xE7, 0x82, 0x07, 0x8B, 0xA6, 0x8B, 0x4B, 0xCE,
+    0x89, 0xB4, 0x49, 0xB4, 0x27, 0xA4, 0x48, 0xAC, 0x28, 0xB4, 0x25, 0x8B, 0xC4, 0x8A, 0x47, 0xAC, 0x27, 0x9B, 0x06, 0x93, 0xE6, 0x92, 0x88, 0xA3, 0xC6, 0x92, 0xC6, 0x92, 0x45, 0x82, 0x45, 0x82, 0x25, 0x82, 0x46, 0x8A, 0x26, 0x82, 0x05, 0x82, 0x26, 0x82, 0x46, 0x82, 0x26, 0x82, 0x26, 0x8A, 0x47, 0x8A, 0x27, 0x82, 0x47, 0x82, 0x27, 0x82, 0x88, 0x8A, 0x66, 0x8A, 0xC8, 0x92, 0xE8, 0x9A,
+    0x2D, 0x51, 0xEC, 0x40, 0xA6, 0x30, 0xA6, 0x30, 0xE6, 0x38, 0x4C, 0x59, 0xCA, 0x59, 0x07, 0x41, 0xA6, 0x30, 0xC8, 0x38, 0x0F, 0x59, 0xEE, 0x69, 0xC8, 0x38, 0xC8, 0x38, 0x07, 0x41, 0x2B, 0x51, 0xF0, 0x79, 0xE7, 0x40, 0xCB, 0x61, 0xCA, 0x48, 0x2E, 0x51, 0xEA, 0x48, 0x4E, 0x92, 0x09, 0x49, 0xED, 0x71, 0x29, 0x51, 0x49, 0x59, 0x8F, 0x9A, 0x6A, 0x59, 0x48, 0x51, 0xCC, 0x69, 0x68, 0x59,
+    0x87, 0x69, 0x2E, 0xD4, 0x09, 0x72, 0xA8, 0x61, 0xE8, 0x69, 0x0A, 0x93, 0x70, 0xFD, 0x48, 0x7A, 0x68, 0x7A, 0x87, 0x7A, 0x86, 0xA4, 0xFD, 0xFF, 0x26, 0x9B, 0x47, 0x8B, 0xFC, 0xFF, 0xFF, 0xFF, 0x68, 0xCD, 0xB0, 0xFE, 0xF6, 0xFF, 0x88, 0xAC, 0xFF, 0xFF, 0xC7, 0xAB, 0xD0, 0xF6, 0xA7, 0xAB, 0xA7, 0xAB, 0xD2, 0xFF, 0xC8, 0xB3, 0x26, 0xA3, 0x0F, 0xF6, 0xAA, 0xCC, 0x88, 0xAB, 0x66, 0x8A,
+    0x86, 0x92, 0xCE, 0xF5, 0x6A, 0xDC, 0x26, 0x82, 0x26, 0x82, 0x45, 0x92, 0x70, 0xFE, 0x45, 0x9A, 0x47, 0x8A, 0x47, 0x8A, 0x67, 0x8A, 0x08, 0xA3, 0x48, 0xDB, 0x67, 0x92, 0xE8, 0x9A, 0x08, 0xA3, 0x8A, 0x38, 0xA9, 0x38, 0xA6, 0x30, 0xC6, 0x30, 0xA6, 0x30, 0x89, 0x30, 0x88, 0x30, 0x27, 0x49, 0xC7, 0x38, 0xA6, 0x38, 0xA9, 0x38, 0x15, 0x7A, 0xA8, 0x38, 0xA6, 0x38, 0x8A, 0x59, 0xE8, 0x40,
+    0xC9, 0x40, 0xC8, 0x48, 0xC9, 0x61, 0xC7, 0x40, 0xE8, 0x48, 0xE9, 0x48, 0xEB, 0x50, 0x09, 0x49, 0x2A, 0x51, 0x29, 0x51, 0x4A, 0x59, 0x28, 0x51, 0x48, 0x59, 0xAB, 0x69, 0xED, 0x69, 0x68, 0x59, 0xE8, 0x69, 0xC8, 0x61, 0x0A, 0x72, 0xA8, 0x61, 0xC8, 0x69, 0xCE, 0xC4, 0xFA, 0xFF, 0x48, 0x72, 0x68, 0x7A, 0xC7, 0x7A, 0xFE, 0xFF, 0x2D, 0xF7, 0x28, 0x93, 0x47, 0x93, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x8A, 0xD5, 0x09, 0xC5, 0x30, 0xEF, 0xFF, 0xFF, 0xEC, 0xFE, 0x27, 0xB4, 0x90, 0xF6, 0xC7, 0xAB, 0xFE, 0xFF, 0x67, 0xA3, 0x88, 0xAB, 0xA8, 0xBB, 0x66, 0xA3, 0x47, 0xAB, 0xA6, 0x92, 0x86, 0x8A, 0x0F, 0xFE, 0x8B, 0xD4, 0x66, 0x8A, 0x46, 0x8A, 0x26, 0x82, 0x6E, 0xFD, 0x67, 0x92, 0x27, 0x8A, 0x47, 0x8A, 0x67, 0x8A, 0x6C, 0xEC, 0x67, 0x8A, 0x87, 0x92, 0x87, 0x9A, 0xE8, 0x9A, 0x48, 0xAB,
+    0x85, 0x30, 0xA8, 0x30, 0xF0, 0x50, 0x2B, 0x49, 0xC6, 0x38, 0xE7, 0x38, 0xA8, 0x38, 0x8F, 0x61, 0xC7, 0x38, 0xA7, 0x38, 0xC6, 0x38, 0xEC, 0x48, 0x90, 0x61, 0xC7, 0x38, 0x07, 0x49, 0x2F, 0x7A, 0x32, 0x51, 0xE7, 0x48, 0x09, 0x51, 0xE8, 0x40, 0x08, 0x49, 0x0C, 0x51, 0x0A, 0x51, 0x70, 0x8A, 0x09, 0x51, 0xEE, 0x71, 0x47, 0x51, 0x48, 0x59, 0x8E, 0x92, 0xAA, 0x69, 0x49, 0x59, 0x48, 0x59,
+    0x8A, 0x82, 0x2E, 0xF3, 0xE9, 0x71, 0xC7, 0x69, 0xE8, 0x69, 0x73, 0xF7, 0xEE, 0xFB, 0x88, 0x82, 0x67, 0x7A, 0x08, 0x8B, 0x88, 0xB4, 0xF1, 0xF6, 0x27, 0x9B, 0x67, 0x93, 0x6D, 0xEF, 0xF2, 0xFF, 0xF2, 0xFF, 0xA9, 0xCC, 0xF3, 0xFF, 0xF1, 0xFF, 0xEB, 0xF5, 0xF6, 0xFF, 0x29, 0xDD, 0xF3, 0xFF, 0x07, 0xCD, 0xC7, 0xB3, 0xEC, 0xF5, 0x65, 0xA3, 0xE8, 0xBB, 0x88, 0xBB, 0x26, 0xA3, 0x90, 0xED,
+    0xC5, 0xA2, 0xA7, 0x92, 0x66, 0x8A, 0x66, 0x8A, 0xE5, 0x81, 0x0C, 0xD4, 0x67, 0x92, 0x47, 0x8A, 0x67, 0x8A, 0x05, 0x8A, 0xC7, 0xA2, 0x88, 0x92, 0xC8, 0x9A, 0xA7, 0x92, 0xE8, 0xA2, 0xE8, 0xA2, 0xC7, 0x30, 0x89, 0x51, 0x68, 0x28, 0xEA, 0x40, 0x4D, 0x38, 0x48, 0x49, 0xA7, 0x38, 0x6A, 0x51, 0xAE, 0x40, 0xE8, 0x40, 0xE8, 0x40, 0x07, 0x41, 0xEE, 0x48, 0x2E, 0x51, 0x68, 0x51, 0x08, 0x49,
+    0xE9, 0x48, 0x2F, 0x59, 0xC8, 0x40, 0xE8, 0x48, 0xF3, 0x48, 0x4F, 0x61, 0xCA, 0x48, 0x0B, 0x59, 0xE9, 0x48, 0xCE, 0x69, 0x68, 0x61, 0x29, 0x59, 0x6F, 0x8A, 0x49, 0x59, 0x4A, 0x59, 0x68, 0x59, 0xC9, 0x82, 0x2E, 0xA3, 0x29, 0x7A, 0xE8, 0x71, 0xC8, 0x69, 0x0C, 0xC5, 0xCE, 0xC4, 0x27, 0x7A, 0x48, 0x7A, 0xC7, 0x8A, 0x6D, 0xDE, 0xF7, 0xFF, 0x47, 0x9B, 0x87, 0x9B, 0xF3, 0xFF, 0xEC, 0xFE,
+    0xFF, 0xFF, 0x09, 0xD5, 0xF0, 0xFF, 0xF8, 0xFF, 0x6A, 0xF6, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0x09, 0xDD, 0x28, 0xC4, 0xF7, 0xFF, 0x2E, 0xF7, 0xA9, 0xD4, 0x28, 0xCC, 0x51, 0xFF, 0x0C, 0xE5, 0x8A, 0xCC, 0x86, 0x92, 0x66, 0x92, 0xEF, 0xFE, 0x86, 0x9A, 0xA7, 0x9A, 0x47, 0x8A, 0x67, 0x92, 0x2C, 0xFD, 0x87, 0x92, 0x88, 0x92, 0x87, 0x92, 0xA8, 0x9A, 0xA7, 0x9A, 0x89, 0xC3, 0x68, 0xAB,
+    0xA8, 0x30, 0xC8, 0x38, 0xA7, 0x30, 0xA9, 0x30, 0xAE, 0x38, 0xAA, 0x38, 0xA9, 0x38, 0xE7, 0x40, 0x88, 0x30, 0xB3, 0x50, 0xCA, 0x40, 0x29, 0x41, 0xE7, 0x40, 0xCB, 0x40, 0xD7, 0x48, 0x4B, 0x51, 0x49, 0x51, 0x6A, 0x51, 0x0D, 0x51, 0x4D, 0x59, 0xD2, 0x8A, 0xE9, 0x48, 0x6D, 0x59, 0xC8, 0x48, 0xEA, 0x48, 0x09, 0x51, 0x69, 0x61, 0x49, 0x59, 0x08, 0x59, 0x29, 0x59, 0x4E, 0x7A, 0x48, 0x59,
+    0x26, 0x72, 0x4B, 0x82, 0xAD, 0x92, 0x08, 0x72, 0xE9, 0x69, 0xAB, 0xBC, 0x8D, 0x9B, 0x08, 0x7A, 0x68, 0x82, 0xE8, 0x8A, 0xF4, 0xFF, 0xE8, 0xB3, 0x69, 0xAB, 0x47, 0x9B, 0xFF, 0xFF, 0xF5, 0xFF, 0xEA, 0xED, 0xCD, 0xF6, 0xFF, 0xFF, 0x8D, 0xFF, 0xF3, 0xFF, 0xCA, 0xED, 0xFF, 0xFF, 0x2B, 0xFE, 0xFB, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0x48, 0xC4, 0x07, 0xC4, 0x28, 0xC4, 0x2A, 0xDD, 0x07, 0xA3,
+    0x66, 0x9A, 0xA6, 0x9A, 0x88, 0xC3, 0xA7, 0x9A, 0x67, 0x92, 0x87, 0x92, 0x67, 0x92, 0xC8, 0x9A, 0x87, 0x92, 0x87, 0x9A, 0x87, 0x9A, 0xE8, 0xA2, 0x08, 0xAB, 0x08, 0xA3, 0x28, 0xAB, 0x6A, 0xCC, 0x8A, 0x30, 0x6D, 0x38, 0x8B, 0x30, 0x66, 0x28, 0xA6, 0x30, 0x8B, 0x38, 0x11, 0x51, 0x8A, 0x38, 0x69, 0x51, 0xA8, 0x38, 0x0E, 0x51, 0xEA, 0x48, 0x87, 0x38, 0xE7, 0x40, 0x6C, 0x51, 0x51, 0x59,
+    0x09, 0x49, 0x09, 0x49, 0xAC, 0x40, 0x6E, 0x61, 0xF1, 0x8A, 0x4B, 0x59, 0xEA, 0x48, 0x09, 0x51, 0xB0, 0x71, 0x8B, 0x59, 0x69, 0x61, 0x49, 0x59, 0x2A, 0x61, 0xEC, 0x79, 0xCF, 0x79, 0x6A, 0x61, 0x68, 0x82, 0x8D, 0xAA, 0x2D, 0x82, 0x49, 0x7A, 0xC9, 0x71, 0x67, 0x9B, 0xEC, 0xBB, 0x27, 0x82, 0x68, 0x82, 0xA8, 0x92, 0x8C, 0xCD, 0xF6, 0xFF, 0x08, 0xDC, 0x88, 0xAB, 0xFF, 0xFF, 0xFB, 0xFF,
+    0x89, 0xE5, 0xF6, 0xFF, 0xF7, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x8D, 0xF7, 0xFC, 0xFF, 0xAB, 0xF5, 0x8F, 0xFF, 0x0B, 0xE6, 0x8B, 0xF5, 0x68, 0xD4, 0xB2, 0xFF, 0xAC, 0xF6, 0xA9, 0xD4, 0x27, 0xAB, 0xA7, 0xA2, 0x10, 0xFE, 0x26, 0xB3, 0x87, 0x9A, 0x66, 0x92, 0xE7, 0xAA, 0x4D, 0xFD, 0x2E, 0xFD, 0x68, 0x92, 0x87, 0x9A, 0x87, 0x9A, 0xA7, 0xA2, 0x6E, 0xFC, 0x28, 0xB3, 0x89, 0xB3, 0x28, 0xB3,
+    0xB1, 0x48, 0x8A, 0x30, 0xAB, 0x38, 0xCD, 0x40, 0xA8, 0x30, 0x71, 0x61, 0xB0, 0x69, 0xF3, 0x48, 0x4C, 0x49, 0xA7, 0x38, 0x6C, 0x61, 0x51, 0x71, 0xEA, 0x40, 0xE7, 0x40, 0xEC, 0x69, 0xAB, 0x40, 0x31, 0x59, 0x0E, 0x7A, 0x2A, 0x51, 0x2B, 0x51, 0x70, 0x7A, 0x0A, 0x59, 0xB1, 0x89, 0x2F, 0x72, 0x0A, 0x51, 0xCF, 0x71, 0xEC, 0x79, 0xF2, 0x89, 0x4C, 0x69, 0x2F, 0x82, 0x6A, 0x61, 0x69, 0x61,
+    0xCC, 0xAB, 0x0E, 0xCB, 0x2B, 0x8A, 0x8A, 0x82, 0xC9, 0x71, 0x09, 0xA3, 0xFF, 0xFF, 0x27, 0x82, 0x68, 0x82, 0xA8, 0x92, 0x6B, 0xDD, 0xF3, 0xFF, 0x8C, 0xEC, 0xC9, 0xB3, 0xF1, 0xFF, 0xFF, 0xFF, 0xCB, 0xF5, 0xFB, 0xFF, 0x6D, 0xF6, 0xFF, 0xFF, 0xAE, 0xFF, 0xAE, 0xFF, 0xF5, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xCA, 0xF5, 0xEC, 0xFD, 0xAD, 0xFE, 0xFE, 0xFF, 0x0E, 0xFF, 0xE7, 0xC3, 0xC8, 0xBB,
+    0x2E, 0xFE, 0x8E, 0xF6, 0xF3, 0xFD, 0xA7, 0xA2, 0xC8, 0xA2, 0xE8, 0xCB, 0x0D, 0xF5, 0x47, 0xA2, 0xA8, 0xA2, 0x87, 0x9A, 0x49, 0xBB, 0xE8, 0xAA, 0x08, 0xAB, 0x48, 0xAB, 0x0B, 0xCC, 0xCA, 0xCB, 0x4A, 0x30, 0x89, 0x30, 0x10, 0x51, 0x6A, 0x30, 0x6A, 0x30, 0x0C, 0x41, 0xAB, 0x38, 0x52, 0x61, 0xCB, 0x40, 0xAA, 0x38, 0x46, 0x28, 0xAA, 0x38, 0xD3, 0x71, 0xEA, 0x48, 0xEA, 0x61, 0xC8, 0x40,
+    0xCB, 0x40, 0x52, 0x59, 0x10, 0x7A, 0xAD, 0x61, 0xCA, 0x48, 0x71, 0x69, 0xEC, 0x50, 0xF0, 0x81, 0x2A, 0x51, 0x8C, 0x61, 0xE8, 0x50, 0xAC, 0x69, 0x70, 0x9A, 0x69, 0x61, 0x49, 0x61, 0xED, 0x71, 0x0E, 0xB4, 0x0F, 0xB3, 0x89, 0x69, 0x6A, 0x82, 0xC9, 0x71, 0x25, 0x93, 0xF4, 0xFF, 0xE7, 0x81, 0x68, 0x8A, 0x68, 0x8A, 0xA9, 0xC3, 0xFF, 0xFF, 0xEA, 0xC3, 0x69, 0xAB, 0xCD, 0xE6, 0xAD, 0xF6,
+    0xFB, 0xFF, 0x2D, 0xFE, 0x6D, 0xFF, 0xFF, 0xFF, 0xED, 0xFE, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x2D, 0xFF, 0x0B, 0xEE, 0xF8, 0xFF, 0xFF, 0xFF, 0x4B, 0xFE, 0x49, 0xED, 0xE8, 0xDC, 0xB2, 0xFF, 0x0F, 0xFF, 0xA6, 0xA2, 0x86, 0xA2, 0xC8, 0xC3, 0xA6, 0xB2, 0x6D, 0xFD, 0x67, 0x9A, 0x87, 0xA2, 0x29, 0xB3, 0xE7, 0xBA, 0xED, 0xFC, 0xE8, 0xAA, 0x0C, 0xCC, 0x0C, 0xEE, 0x89, 0xC3, 0x0A, 0xD4,
+    0x2A, 0x28, 0x8A, 0x30, 0x8A, 0x38, 0x8B, 0x30, 0xEE, 0x48, 0xCC, 0x38, 0x6A, 0x30, 0x8B, 0x38, 0x8A, 0x38, 0xAD, 0x40, 0x0B, 0x49, 0xE8, 0x40, 0xEA, 0x48, 0xAE, 0x38, 0x0A, 0x49, 0xC9, 0x40, 0xC9, 0x40, 0xAA, 0x40, 0x6D, 0x40, 0x4B, 0x59, 0xC8, 0x48, 0x0C, 0x59, 0xCC, 0x48, 0x0E, 0x6A, 0xCC, 0x50, 0xCB, 0x69, 0x0B, 0x59, 0xEB, 0x71, 0x8D, 0x71, 0xCA, 0x71, 0x0F, 0x82, 0xCB, 0x69,
+    0x49, 0xA3, 0xEF, 0xAA, 0x6F, 0x92, 0x09, 0x7A, 0xA9, 0x71, 0xA5, 0x8A, 0x30, 0xD4, 0xE7, 0x81, 0x48, 0x8A, 0x47, 0x8A, 0x4D, 0xE5, 0xFE, 0xFF, 0x08, 0xAB, 0x6A, 0xBB, 0xF4, 0xFF, 0x8C, 0xF5, 0xFF, 0xFF, 0xEC, 0xFD, 0xFF, 0xFF, 0xAD, 0xFE, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xFF, 0xCC, 0xF6, 0x6E, 0xF7, 0xFF, 0xFF, 0x6A, 0xF6, 0xD1, 0xFF, 0x8D, 0xFE, 0xFB, 0xFF, 0xC6, 0xC3,
+    0xE6, 0xAA, 0xE7, 0xAA, 0xF9, 0xFF, 0xF9, 0xFF, 0x87, 0xAA, 0x87, 0xAA, 0xA8, 0xA2, 0xCB, 0xF4, 0xAE, 0xFD, 0xE8, 0xAA, 0x89, 0xC3, 0xFA, 0xFF, 0xAA, 0xCB, 0x89, 0xC3, 0x4B, 0xE4, 0xB3, 0xFF, 0x6A, 0x30, 0x8B, 0x38, 0x89, 0x30, 0x8B, 0x30, 0x4B, 0x30, 0xAB, 0x38, 0x8B, 0x38, 0x6B, 0x30, 0xEC, 0x40, 0x54, 0x8B, 0xB1, 0x7A, 0xEC, 0x40, 0xE7, 0x38, 0x4E, 0x72, 0x73, 0x40, 0xCE, 0x48,
+    0xE8, 0x40, 0x89, 0x40, 0x72, 0x61, 0x91, 0x71, 0xEA, 0x50, 0xC9, 0x50, 0xAB, 0x48, 0xEA, 0x50, 0xCB, 0x50, 0x8C, 0x61, 0xEA, 0x58, 0x2F, 0x9B, 0x8D, 0x69, 0xB0, 0xAB, 0xAF, 0x79, 0x6C, 0x7A, 0x48, 0x82, 0x0A, 0x7A, 0x0F, 0x8A, 0xE6, 0x71, 0xA9, 0x79, 0x44, 0x8A, 0xCE, 0xAA, 0xE7, 0x81, 0x88, 0x8A, 0x47, 0x8A, 0xA9, 0xD3, 0x28, 0xBB, 0xE8, 0xAA, 0x08, 0xAB, 0x8C, 0xDC, 0xF7, 0xFF,
+    0x8A, 0xEC, 0x8F, 0xFF, 0xB0, 0xF6, 0x4D, 0xF6, 0xFF, 0xFF, 0x2C, 0xF7, 0x30, 0xF7, 0xEB, 0xF5, 0xF0, 0xFF, 0xFF, 0xFF, 0x6D, 0xFF, 0x8A, 0xED, 0xCA, 0xF5, 0xFC, 0xFF, 0x0C, 0xFF, 0x29, 0xDC, 0x27, 0xBB, 0xF5, 0xFF, 0xB1, 0xFF, 0x28, 0xBB, 0x66, 0xA2, 0xE9, 0xBA, 0xCB, 0xEC, 0xE7, 0xBA, 0xA8, 0xAA, 0xC8, 0xAA, 0x6A, 0xC3, 0x09, 0xB3, 0x2B, 0xE4, 0xCA, 0xCB, 0xEA, 0xDB, 0xCA, 0xD3,
+    0x8B, 0x30, 0x4A, 0x28, 0x49, 0x28, 0x8B, 0x38, 0x08, 0x20, 0x6A, 0x30, 0x93, 0x40, 0x8B, 0x38, 0xCC, 0x40, 0xEE, 0x61, 0x8D, 0x61, 0x34, 0x59, 0x4D, 0x51, 0x0F, 0x83, 0xAB, 0x40, 0xD3, 0x48, 0xD0, 0x48, 0x89, 0x40, 0xCB, 0x48, 0xED, 0x48, 0x0D, 0x59, 0x09, 0x51, 0xAC, 0x48, 0x2D, 0x59, 0x13, 0x59, 0x49, 0x59, 0x0A, 0x51, 0x31, 0xA4, 0x2A, 0x61, 0x71, 0xB3, 0x28, 0x61, 0xF2, 0xB3,
+    0xE7, 0x81, 0xCD, 0x92, 0xED, 0x81, 0x08, 0x7A, 0xCA, 0x79, 0x85, 0xA2, 0xAC, 0xA2, 0xE8, 0x89, 0x29, 0x92, 0xEA, 0xAA, 0xCC, 0xDC, 0xE8, 0xBA, 0x49, 0xCB, 0x09, 0xBB, 0x08, 0xBB, 0x72, 0xF7, 0x49, 0xEC, 0x71, 0xFF, 0xCA, 0xEC, 0xFE, 0xFF, 0xEF, 0xFF, 0xEF, 0xF6, 0x6C, 0xFE, 0xEC, 0xFE, 0xFF, 0xFF, 0x0B, 0xEE, 0x0B, 0xF6, 0xEB, 0xF5, 0xFF, 0xFF, 0x4C, 0xFF, 0x2B, 0xEE, 0xAA, 0xEC,
+    0x6A, 0xEC, 0x8F, 0xFE, 0xE7, 0xC2, 0x48, 0xC3, 0xA7, 0xB2, 0xEF, 0xFD, 0x88, 0xB2, 0xC8, 0xB2, 0xC9, 0xB2, 0xE8, 0xB2, 0x2B, 0xE4, 0x8A, 0xCB, 0x8A, 0xC3, 0xCA, 0xD3, 0x4D, 0xFD, 0xEE, 0xFE, 0x11, 0x51, 0xAA, 0x38, 0x50, 0x72, 0x56, 0x38, 0x2D, 0x49, 0x6B, 0x38, 0xAB, 0x38, 0x4D, 0x30, 0x71, 0x59, 0xEB, 0x40, 0x8C, 0x38, 0x73, 0x69, 0xD2, 0x50, 0xAE, 0x61, 0xAC, 0x40, 0xAB, 0x40,
+    0xD5, 0x50, 0xFA, 0x8A, 0xCB, 0x48, 0xEB, 0x48, 0x10, 0x59, 0xAE, 0x61, 0xB2, 0x89, 0x0D, 0x59, 0x90, 0x69, 0xF0, 0x79, 0x2D, 0x61, 0xCA, 0x71, 0x6B, 0x69, 0xCE, 0x9A, 0xF1, 0xBB, 0x4F, 0x8A, 0x6A, 0x92, 0xD1, 0xC2, 0x8B, 0x79, 0xEC, 0x9A, 0xAA, 0x81, 0x05, 0xA2, 0x96, 0xFF, 0xE8, 0x89, 0x29, 0x92, 0x49, 0x9A, 0xEA, 0xD3, 0xF9, 0xFF, 0x78, 0xFF, 0xEA, 0xC2, 0x49, 0xCB, 0x4E, 0xFD,
+    0xAC, 0xED, 0xFF, 0xFF, 0xAA, 0xEC, 0xD8, 0xFF, 0xCD, 0xF5, 0x4B, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xFF, 0x8B, 0xF5, 0x4C, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xF6, 0xCB, 0xF5, 0xFE, 0xFF, 0xC9, 0xE4, 0xF1, 0xF6, 0x07, 0xCB, 0x49, 0xD3, 0xA6, 0xC2, 0x6A, 0xD3, 0x93, 0xFF, 0x07, 0xC3, 0xCA, 0xD3, 0x08, 0xC3, 0xA8, 0xBA, 0xAC, 0xF4, 0xCE, 0xF4, 0xFF, 0xFF, 0xEB, 0xDB, 0x6B, 0xF4,
+    0x50, 0x30, 0xF1, 0x69, 0xF0, 0x69, 0x6B, 0x30, 0x54, 0x8B, 0x56, 0x30, 0xF6, 0x50, 0x2E, 0x38, 0x8C, 0x38, 0x16, 0x51, 0x8B, 0x40, 0x32, 0x51, 0xCB, 0x40, 0x8D, 0x40, 0x6F, 0x38, 0xAF, 0x40, 0xCD, 0x48, 0xF8, 0x70, 0xF0, 0x58, 0xEB, 0x48, 0x6D, 0x59, 0xB3, 0x9A, 0x93, 0x79, 0x90, 0x79, 0x8D, 0x69, 0x92, 0xAB, 0x94, 0x79, 0x0B, 0x82, 0x32, 0x9A, 0xED, 0xA2, 0x34, 0xAB, 0x6F, 0x8A,
+    0x2E, 0xAB, 0x50, 0xB2, 0x30, 0x9A, 0x54, 0xE5, 0xAA, 0x81, 0x08, 0xB3, 0xD4, 0xF3, 0x2A, 0x9A, 0x0A, 0x92, 0x08, 0x9A, 0xD2, 0xFD, 0xFA, 0xFF, 0x09, 0xDB, 0xAA, 0xC2, 0x8F, 0xF4, 0x8C, 0xF5, 0xFF, 0xFF, 0xEF, 0xFF, 0xF1, 0xF6, 0xCD, 0xFC, 0xCC, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xF5, 0x6B, 0xED, 0x8B, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0x2B, 0xFD, 0xFF, 0xFF, 0x10, 0xFF,
+    0xF3, 0xFF, 0x88, 0xDB, 0xFF, 0xFF, 0x68, 0xE3, 0x6B, 0xE4, 0x6F, 0xFE, 0xC8, 0xC2, 0xFF, 0xFF, 0x09, 0xCB, 0x08, 0xCB, 0x6A, 0xEB, 0xFF, 0xFF, 0x8A, 0xCB, 0xAA, 0xD3, 0x0B, 0xE4, 0x95, 0xFF, 0x6C, 0x30, 0xEA, 0x38, 0xAC, 0x38, 0x12, 0x51, 0x2E, 0x51, 0x6B, 0x30, 0x0C, 0x41, 0x2E, 0x30, 0x39, 0x82, 0x73, 0x61, 0x6C, 0x38, 0xD5, 0x7A, 0x2A, 0x30, 0xF9, 0x81, 0x54, 0x61, 0xD8, 0x50,
+    0xCD, 0x48, 0xEF, 0x68, 0xB8, 0x58, 0xF5, 0x58, 0xAE, 0x69, 0xAC, 0x71, 0xF3, 0x89, 0xF9, 0x68, 0xF0, 0x79, 0xF1, 0x9A, 0xED, 0x60, 0x4F, 0x92, 0xB1, 0x81, 0x0E, 0xAB, 0x90, 0x9A, 0xAB, 0x79, 0xEF, 0xB2, 0xB2, 0xB2, 0xF1, 0x91, 0x10, 0xC4, 0x89, 0x81, 0x07, 0xA2, 0xF1, 0xE3, 0xEB, 0x91, 0xE9, 0x91, 0x4A, 0xA2, 0xD1, 0xFC, 0xFF, 0xFF, 0x88, 0xCA, 0x8A, 0xC2, 0xEE, 0xFB, 0xF0, 0xFE,
+    0xFF, 0xFF, 0xCE, 0xFD, 0xAE, 0xFD, 0xAD, 0xFC, 0xF2, 0xFF, 0xFF, 0xFF, 0xAE, 0xFE, 0xAA, 0xEC, 0xEB, 0xED, 0xF5, 0xFF, 0xFF, 0xFF, 0xCE, 0xFE, 0xF0, 0xFE, 0x2B, 0xF6, 0xFE, 0xFF, 0xED, 0xE5, 0xC9, 0xDB, 0xFF, 0xFF, 0xED, 0xFC, 0xF6, 0xFF, 0x6F, 0xFD, 0xEB, 0xF3, 0x8D, 0xED, 0xEB, 0xEB, 0x6F, 0xFD, 0x09, 0xCB, 0x4A, 0xD3, 0x29, 0xCB, 0x6A, 0xCB, 0x2C, 0xEC, 0xAD, 0xF4, 0x0B, 0xEC,
+    0xD3, 0x61, 0x6C, 0x30, 0x4A, 0x30, 0x92, 0x72, 0x4D, 0x49, 0x6C, 0x38, 0x72, 0x59, 0x6E, 0x38, 0x8D, 0x40, 0xB1, 0x40, 0x4C, 0x30, 0x0E, 0x49, 0xB3, 0x48, 0xCC, 0x48, 0x70, 0x38, 0xF3, 0x50, 0x37, 0x40, 0xF4, 0x92, 0x8D, 0x48, 0xFC, 0x60, 0xB1, 0x50, 0x2B, 0x69, 0xD2, 0xA2, 0xAF, 0x58, 0x95, 0x79, 0x2A, 0x61, 0xEE, 0x60, 0x33, 0xAB, 0x8C, 0x71, 0x0D, 0xA2, 0x4A, 0x79, 0x6F, 0x79,
+    0xEF, 0xB2, 0x6B, 0x81, 0xCC, 0x81, 0xAC, 0x9A, 0x8B, 0x81, 0x0A, 0xCB, 0x52, 0xD3, 0xC9, 0x91, 0xEA, 0x99, 0x0A, 0xA2, 0x73, 0xFD, 0xB2, 0xF4, 0x69, 0xCA, 0x6B, 0xCA, 0xCA, 0xDA, 0xF8, 0xFF, 0xCA, 0xE3, 0x13, 0xFF, 0x0C, 0xF4, 0xEF, 0xFD, 0xFF, 0xFF, 0xEC, 0xED, 0x2A, 0xEC, 0xCC, 0xF5, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xF6, 0x6E, 0xFE, 0xF1, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0x8A, 0xEC,
+    0x49, 0xE4, 0x0B, 0xF5, 0xFF, 0xFF, 0x69, 0xE3, 0xEA, 0xEB, 0x09, 0xCB, 0xB4, 0xFF, 0x8D, 0xFC, 0xC9, 0xC2, 0x2A, 0xCB, 0x08, 0xCB, 0x8B, 0xE3, 0x8D, 0xFC, 0x2C, 0xEC, 0x0C, 0xF4, 0xCD, 0xFC, 0x6C, 0x30, 0xAB, 0x38, 0x8C, 0x38, 0x90, 0x38, 0x8C, 0x38, 0x6B, 0x30, 0x4F, 0x51, 0x4F, 0x30, 0x51, 0x51, 0x6B, 0x38, 0x33, 0x38, 0x6F, 0x40, 0x14, 0x51, 0x8C, 0x40, 0x59, 0x40, 0x6E, 0x38,
+    0x17, 0x59, 0xCD, 0x50, 0xAD, 0x50, 0x6D, 0x48, 0x6D, 0x40, 0x30, 0x79, 0x2C, 0x61, 0xAD, 0x58, 0x0C, 0x69, 0x52, 0x71, 0xAD, 0x58, 0x8D, 0x79, 0x30, 0x69, 0xEB, 0x80, 0x4A, 0x79, 0x4C, 0x71, 0xAA, 0x99, 0x8B, 0x89, 0xB2, 0xB2, 0xE9, 0x89, 0x6C, 0x81, 0x70, 0xF4, 0x73, 0xCB, 0xA9, 0x91, 0x0B, 0xA2, 0xAD, 0xBA, 0x53, 0xFD, 0x49, 0xC2, 0x6D, 0xEB, 0x0D, 0xDB, 0xAA, 0xD2, 0xAD, 0xE4,
+    0x0B, 0xE4, 0x74, 0xFF, 0x8D, 0xF4, 0x96, 0xFF, 0x2F, 0xF6, 0xCD, 0xF5, 0x2A, 0xF4, 0xD4, 0xFF, 0xFF, 0xFF, 0x4B, 0xED, 0x6C, 0xFD, 0xF3, 0xFF, 0xFF, 0xFF, 0xED, 0xF6, 0xEF, 0xFE, 0xF7, 0xFF, 0xFD, 0xFF, 0x92, 0xFF, 0x8B, 0xF4, 0x49, 0xE4, 0xCE, 0xFD, 0xA7, 0xC2, 0xC9, 0xC2, 0x4C, 0xEC, 0x29, 0xD3, 0x6A, 0xE3, 0xEA, 0xEB, 0x8B, 0xDB, 0x0B, 0xF4, 0xFF, 0xFF, 0xF1, 0xFE, 0x0E, 0xFD,
+    0x4F, 0x28, 0xAC, 0x38, 0x4B, 0x30, 0x8D, 0x38, 0x6C, 0x30, 0x75, 0x38, 0x73, 0x7A, 0x4C, 0x30, 0xAD, 0x40, 0x98, 0x48, 0x6F, 0x40, 0x6D, 0x38, 0x51, 0x38, 0x13, 0x51, 0x10, 0x28, 0x74, 0x38, 0xF0, 0x50, 0xF2, 0x50, 0xD6, 0x79, 0x2E, 0x38, 0x4D, 0x48, 0xEE, 0x60, 0xEE, 0x68, 0xD1, 0x58, 0xAC, 0x58, 0x50, 0x71, 0xF3, 0x68, 0xEB, 0x70, 0x0D, 0x69, 0x2C, 0x79, 0x90, 0x89, 0xAC, 0x81,
+    0x29, 0x89, 0x8E, 0xB2, 0xF2, 0x99, 0x6A, 0xA2, 0x6C, 0x81, 0x94, 0xF5, 0x6D, 0x91, 0x89, 0x91, 0xAB, 0x99, 0xCA, 0xA1, 0x70, 0xF4, 0xCB, 0xDA, 0x28, 0xC2, 0x4A, 0xC2, 0xAF, 0xFB, 0x0E, 0xF4, 0x2C, 0xF4, 0xF4, 0xFF, 0x8D, 0xEC, 0x2D, 0xFC, 0x4E, 0xFD, 0x0C, 0xED, 0xFE, 0xFF, 0xCD, 0xEE, 0x8B, 0xF4, 0xCD, 0xFC, 0xFF, 0xFF, 0x4F, 0xF7, 0xFE, 0xFF, 0xAE, 0xFD, 0xFE, 0xFF, 0x0B, 0xF5,
+    0x2B, 0xED, 0x95, 0xFF, 0xFF, 0xFF, 0x49, 0xE4, 0x2D, 0xFD, 0xEA, 0xCA, 0xAF, 0xF5, 0xFF, 0xFF, 0xAA, 0xE3, 0x4A, 0xDB, 0x6B, 0xE3, 0xFF, 0xFF, 0x32, 0xFD, 0xCC, 0xEB, 0xEC, 0xEB, 0x6E, 0xF6, 0xB3, 0x50, 0x14, 0x59, 0x30, 0x30, 0x6E, 0x30, 0x8E, 0x38, 0x6D, 0x40, 0x14, 0x69, 0x0D, 0x28, 0xF2, 0x50, 0x12, 0x6A, 0x2C, 0x30, 0x55, 0x69, 0x91, 0x48, 0x0F, 0x59, 0x50, 0x38, 0x1C, 0x40,
+    0x35, 0x79, 0x35, 0x79, 0xB6, 0x9A, 0x3C, 0x50, 0x90, 0x50, 0xAE, 0x58, 0x96, 0x91, 0xB6, 0x68, 0xAD, 0x58, 0x72, 0x92, 0xD0, 0x60, 0x11, 0x81, 0x55, 0xBA, 0x0E, 0x79, 0xCA, 0x78, 0x6E, 0x81, 0x6D, 0x99, 0x54, 0xD2, 0xB1, 0xA1, 0x8B, 0x99, 0x4D, 0x89, 0xF2, 0xFB, 0x38, 0xFE, 0x6C, 0xA1, 0xAB, 0x99, 0x8B, 0xA1, 0x4E, 0xEB, 0xCD, 0xDB, 0xAF, 0xE3, 0x2E, 0xEB, 0x2E, 0xF3, 0x8D, 0xEB,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0xFE, 0xED, 0xFB, 0x8F, 0xFD, 0xF9, 0xFF, 0xFF, 0xFF, 0x4D, 0xF5, 0xAD, 0xF4, 0xAE, 0xFD, 0xFB, 0xFF, 0xFE, 0xFF, 0xEE, 0xF5, 0x53, 0xFF, 0x6E, 0xFE, 0x72, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFC, 0xCB, 0xEB, 0xAF, 0xF5, 0x74, 0xFF, 0x52, 0xFE, 0x4F, 0xFC, 0x0A, 0xDB, 0x6F, 0xF5, 0x2D, 0xF4, 0x6B, 0xDB, 0xAC, 0xEB, 0xAC, 0xE3, 0xCC, 0xEB, 0x0D, 0xF4,
+    0x71, 0x38, 0x50, 0x38, 0x11, 0x30, 0xDE, 0x68, 0x0E, 0x30, 0x36, 0xAB, 0x8E, 0x38, 0x70, 0x38, 0xFE, 0x68, 0xF7, 0x58, 0x77, 0x61, 0x4D, 0x38, 0x70, 0x40, 0x7B, 0x89, 0x37, 0x69, 0x31, 0x38, 0x18, 0x38, 0x3C, 0x48, 0x7D, 0x50, 0x17, 0x71, 0x39, 0x50, 0x72, 0x69, 0x32, 0x71, 0xFD, 0x68, 0x36, 0x79, 0xEE, 0x68, 0x10, 0x71, 0xB0, 0x70, 0x19, 0x91, 0xCF, 0x78, 0xEB, 0x78, 0x54, 0x89,
+    0xAF, 0x99, 0xF8, 0xB1, 0x6D, 0x89, 0x6E, 0xC2, 0x4D, 0x89, 0xEB, 0xC9, 0x55, 0xEB, 0x8D, 0xA1, 0x8A, 0x99, 0xAA, 0xA1, 0xCD, 0xEA, 0xFF, 0xFF, 0x0A, 0xCA, 0x4E, 0xDA, 0x8C, 0xEA, 0xF1, 0xFC, 0xFF, 0xFF, 0xEF, 0xFC, 0xCD, 0xF3, 0xEE, 0xFB, 0xB5, 0xFF, 0xFF, 0xFF, 0x30, 0xFE, 0x8D, 0xF4, 0xEF, 0xF5, 0xFD, 0xFF, 0xFE, 0xFF, 0xD0, 0xFD, 0x6E, 0xFD, 0xB0, 0xFF, 0xFF, 0xFF, 0x4E, 0xEE,
+    0xCC, 0xF4, 0x2C, 0xF4, 0xF6, 0xFF, 0xF5, 0xFF, 0xEB, 0xEB, 0xEB, 0xDA, 0xCA, 0xCA, 0x0A, 0xE3, 0x50, 0xFD, 0x2C, 0xDB, 0xEA, 0xDA, 0x2B, 0xD3, 0xAC, 0xEB, 0xAF, 0xFC, 0x6E, 0xF4, 0xAC, 0xEB, 0x12, 0x20, 0x50, 0x38, 0xF8, 0x48, 0x4F, 0x30, 0x72, 0x38, 0x54, 0x40, 0xF5, 0x50, 0x13, 0x51, 0x71, 0x40, 0x0E, 0x30, 0x8F, 0x40, 0x18, 0x61, 0x15, 0x38, 0xB6, 0x9A, 0x10, 0x30, 0x9F, 0xAC,
+    0x18, 0x8A, 0x36, 0x48, 0x7E, 0x6B, 0xBC, 0x60, 0x39, 0x71, 0x74, 0x58, 0x74, 0x58, 0xB0, 0x58, 0x31, 0x58, 0xB5, 0x70, 0x10, 0x71, 0x8E, 0x68, 0x75, 0xAA, 0x95, 0x99, 0xF1, 0xA1, 0x2E, 0x81, 0x6F, 0x91, 0xB0, 0xA1, 0x0D, 0x89, 0x2E, 0xBA, 0x4D, 0x91, 0xCC, 0xDA, 0x36, 0xE3, 0x6E, 0xA1, 0x6A, 0x99, 0x8A, 0xA1, 0x6F, 0xEB, 0xF4, 0xFB, 0xCB, 0xC1, 0xCB, 0xC9, 0x6C, 0xE2, 0x38, 0xFF,
+    0x6E, 0xEB, 0x13, 0xFE, 0x6D, 0xF3, 0x7B, 0xFF, 0xFF, 0xFF, 0xCD, 0xEC, 0x0E, 0xF4, 0x0B, 0xE4, 0xFF, 0xFF, 0x90, 0xFE, 0xED, 0xEC, 0x0D, 0xF5, 0xFF, 0xFF, 0xFD, 0xFF, 0xF3, 0xFF, 0x6C, 0xED, 0xFF, 0xFF, 0x8F, 0xF6, 0x0E, 0xFD, 0x2B, 0xEC, 0x2E, 0xFE, 0xFF, 0xFF, 0xB3, 0xFE, 0x6C, 0xEB, 0x14, 0xFE, 0x6F, 0xFC, 0xFE, 0xFF, 0x6B, 0xEB, 0xAC, 0xF3, 0xEF, 0xF5, 0xFF, 0xFF, 0x12, 0xFF,
+    0x52, 0x30, 0x2E, 0x30, 0x0F, 0x30, 0x32, 0x28, 0x17, 0x18, 0x30, 0x38, 0x51, 0x30, 0xF2, 0x50, 0x59, 0x38, 0xF9, 0x50, 0x8F, 0x48, 0x13, 0x59, 0x58, 0x40, 0xD9, 0x81, 0x34, 0x38, 0x12, 0x38, 0x1A, 0xC3, 0x13, 0x38, 0x38, 0x69, 0x5A, 0x58, 0x35, 0x50, 0xBB, 0x58, 0xD6, 0x68, 0x33, 0x58, 0x8E, 0x68, 0x72, 0x68, 0xF7, 0x78, 0x8F, 0x68, 0x6E, 0x68, 0x11, 0x81, 0xB4, 0xA9, 0x4F, 0x89,
+    0xD0, 0x90, 0xF0, 0xB1, 0xF5, 0xB1, 0x51, 0xC2, 0x2E, 0x91, 0xAB, 0xCA, 0xD3, 0xB9, 0x4B, 0x99, 0x6B, 0xA1, 0x4B, 0xA1, 0x2E, 0xDB, 0xF0, 0xEA, 0x0D, 0xD2, 0xCC, 0xC9, 0xB0, 0xEA, 0x13, 0xFD, 0x0E, 0xF3, 0xD3, 0xFD, 0x0E, 0xE3, 0x8F, 0xF3, 0xB3, 0xFD, 0xAE, 0xEC, 0x30, 0xEC, 0xEE, 0xF4, 0x6D, 0xEB, 0x6E, 0xFC, 0x51, 0xFD, 0xF9, 0xFF, 0x6C, 0xEC, 0x0E, 0xFD, 0xF9, 0xFF, 0xD7, 0xFF,
+    0x0E, 0xFE, 0x4B, 0xEC, 0xFF, 0xFF, 0xFB, 0xFF, 0x0E, 0xFE, 0xEB, 0xEA, 0x2C, 0xF3, 0xFF, 0xFF, 0xCD, 0xF5, 0x8D, 0xF3, 0x0B, 0xEB, 0xFF, 0xFF, 0x8D, 0xEB, 0x8D, 0xF3, 0x4B, 0xE3, 0x2E, 0xFC, 0x10, 0x30, 0xD4, 0x71, 0x16, 0x30, 0x31, 0x30, 0x30, 0x30, 0x2D, 0x40, 0x50, 0x38, 0x32, 0x61, 0x1B, 0x38, 0x72, 0x40, 0xD2, 0x50, 0x71, 0x40, 0x3C, 0x71, 0x91, 0x68, 0x14, 0x30, 0x5B, 0x40,
+    0x75, 0x60, 0x11, 0x40, 0x35, 0x50, 0x3B, 0x50, 0x38, 0x58, 0x31, 0x50, 0x12, 0x50, 0x1B, 0x68, 0x93, 0x89, 0x50, 0x60, 0xF2, 0x78, 0x19, 0x89, 0xB2, 0xB1, 0x8F, 0x78, 0x15, 0xE3, 0x12, 0x91, 0x8D, 0x88, 0xEE, 0xA0, 0x33, 0x99, 0xB2, 0xE2, 0xEE, 0x90, 0xED, 0xD2, 0x52, 0xB1, 0x6E, 0xB1, 0x6C, 0xA1, 0x2C, 0xA1, 0x8D, 0xDA, 0x70, 0xEA, 0x0C, 0xC2, 0xCD, 0xD1, 0x6F, 0xE2, 0x11, 0xFC,
+    0x4D, 0xDA, 0x31, 0xF4, 0x90, 0xFB, 0x90, 0xFB, 0x71, 0xFC, 0x10, 0xE4, 0xEE, 0xF3, 0xED, 0xEB, 0x0F, 0xFC, 0x2F, 0xFC, 0xAF, 0xFC, 0xAE, 0xF4, 0xAF, 0xF4, 0x8F, 0xF4, 0x8E, 0xF4, 0xCF, 0xFC, 0xB4, 0xF7, 0xEE, 0xEC, 0xAD, 0xFB, 0x6D, 0xF3, 0xEC, 0xF3, 0xAB, 0xDA, 0xAA, 0xDA, 0xAB, 0xE2, 0x8A, 0xD2, 0xCB, 0xDA, 0xCB, 0xDA, 0x0C, 0xE3, 0x4D, 0xEB, 0x6D, 0xEB, 0x8E, 0xF3, 0x8D, 0xF3,
+    0x1F, 0x5D, 0xD7, 0x50, 0x1B, 0x20, 0x15, 0x28, 0x19, 0x00, 0x11, 0x38, 0x54, 0x40, 0xB1, 0x60, 0x31, 0x40, 0x78, 0x61, 0x37, 0x40, 0x57, 0x71, 0x9C, 0xA2, 0x12, 0x48, 0xFB, 0x2A, 0x1D, 0x20, 0x15, 0x40, 0x39, 0x48, 0xFF, 0xF7, 0x99, 0x68, 0x77, 0x60, 0x5F, 0x60, 0x16, 0x50, 0x12, 0x60, 0xD8, 0xA9, 0x3C, 0x68, 0xB1, 0x70, 0x10, 0x98, 0x7D, 0xF3, 0x73, 0xA1, 0x57, 0xEB, 0xD2, 0x90,
+    0xAF, 0xA8, 0xFF, 0xFF, 0x11, 0xB1, 0x73, 0xDA, 0xCE, 0x90, 0x91, 0xF2, 0xFF, 0xFF, 0x33, 0xE9, 0x2D, 0xA9, 0x2D, 0xA1, 0xCE, 0xD9, 0x7D, 0xF2, 0x1E, 0xFF, 0xF0, 0xE1, 0x2D, 0xE2, 0xD0, 0xEA, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF3, 0x92, 0xFB, 0x12, 0xFC, 0xDA, 0xFF, 0xFF, 0xFF, 0xB2, 0xFD, 0x6E, 0xF3, 0xF1, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xEB, 0x6F, 0xFD, 0x8F, 0xED,
+    0xDC, 0xFF, 0x96, 0xF6, 0x2D, 0xEB, 0x6D, 0xFB, 0x15, 0xFF, 0xB6, 0xFE, 0x79, 0xFF, 0xCC, 0xF2, 0xEC, 0xE2, 0xB5, 0xFF, 0x33, 0xFD, 0xD4, 0xFD, 0xD0, 0xF3, 0x2D, 0xEB, 0x6E, 0xF3, 0xAE, 0xF3, 0x58, 0x30, 0x1B, 0x00, 0x13, 0x28, 0x5B, 0x39, 0xBF, 0x5B, 0xF9, 0x48, 0x1F, 0x4B, 0x53, 0x38, 0x7A, 0x48, 0x75, 0x40, 0xFC, 0x60, 0xD9, 0x81, 0x15, 0x48, 0xD5, 0x48, 0x1B, 0x59, 0x19, 0x28,
+    0x9A, 0x49, 0x78, 0x58, 0x3B, 0x38, 0x3F, 0x58, 0x99, 0x48, 0x59, 0x60, 0x18, 0x48, 0x7D, 0x81, 0xD6, 0x98, 0x13, 0x60, 0x7E, 0x70, 0x12, 0x80, 0xDA, 0xB0, 0x5B, 0xCA, 0x71, 0xA1, 0x33, 0x99, 0x32, 0xA8, 0xF9, 0xE0, 0x32, 0xA9, 0x11, 0xA1, 0xAF, 0x90, 0xB8, 0xFA, 0x3D, 0xF2, 0x11, 0xC9, 0x2E, 0xA9, 0x2F, 0xB1, 0x91, 0xE1, 0xBF, 0xFF, 0xB0, 0xE9, 0xB4, 0xF3, 0xEF, 0xE1, 0x3B, 0xFD,
+    0xFF, 0xFF, 0x93, 0xF3, 0xD1, 0xEA, 0x51, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEB, 0xD0, 0xF3, 0xF6, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0x6F, 0xEC, 0x91, 0xF6, 0xFF, 0xFF, 0xFE, 0xFF, 0xB1, 0xF4, 0x6D, 0xF4, 0xEE, 0xEC, 0xFF, 0xFF, 0xDA, 0xFF, 0x2E, 0xF4, 0xB0, 0xF5, 0x95, 0xFF, 0x4B, 0xE2, 0x0D, 0xEC, 0x0D, 0xF3, 0x93, 0xF6, 0xEF, 0xFB, 0x0F, 0xFC, 0xEF, 0xFB, 0x70, 0xED, 0x2F, 0xFC,
+    0x10, 0x28, 0x32, 0x30, 0x79, 0x49, 0x12, 0x28, 0x9A, 0x40, 0x72, 0x40, 0x33, 0x30, 0x56, 0x61, 0xDA, 0x40, 0x34, 0x30, 0x12, 0x30, 0xF8, 0x50, 0x76, 0x58, 0x15, 0x38, 0x16, 0x30, 0x17, 0x38, 0x7E, 0x71, 0x3F, 0x71, 0x18, 0x40, 0x16, 0x48, 0x9C, 0x60, 0x9D, 0x68, 0x9C, 0x68, 0x57, 0x89, 0x73, 0x80, 0x1C, 0x89, 0x16, 0x68, 0x34, 0x99, 0x71, 0x90, 0x51, 0x80, 0xD5, 0xA8, 0xF1, 0x90,
+    0x76, 0xEA, 0x8E, 0x90, 0x96, 0xB9, 0xEF, 0xA8, 0xB0, 0x90, 0x98, 0xF3, 0x14, 0xB9, 0x93, 0xC1, 0x0E, 0xA1, 0x0F, 0xA9, 0x73, 0xE2, 0xD5, 0xFA, 0x14, 0xF3, 0x6F, 0xC1, 0x33, 0xF2, 0xD9, 0xFC, 0x92, 0xFA, 0x51, 0xE3, 0x91, 0xEA, 0x12, 0xF3, 0x33, 0xF4, 0x2F, 0xEB, 0x51, 0xF3, 0x95, 0xFC, 0xCE, 0xE2, 0xF0, 0xF3, 0x92, 0xFC, 0xF8, 0xFF, 0xAD, 0xEB, 0xCC, 0xE3, 0xD0, 0xED, 0x95, 0xF7,
+    0x71, 0xF5, 0xCD, 0xEB, 0xFE, 0xFF, 0xFF, 0xFF, 0x50, 0xFD, 0x8C, 0xF2, 0x6C, 0xEA, 0xFE, 0xFF, 0xFD, 0xFF, 0x6E, 0xFB, 0xED, 0xEA, 0xF1, 0xFE, 0x8F, 0xF3, 0x6E, 0xF3, 0x6F, 0xF3, 0x6E, 0xF3, 0x18, 0x28, 0x7E, 0x4E, 0xBC, 0x40, 0x16, 0x20, 0x37, 0x30, 0x14, 0x30, 0x14, 0x20, 0x15, 0x48, 0x5B, 0x48, 0x1B, 0x20, 0x17, 0x30, 0x17, 0x30, 0x3D, 0x83, 0xDE, 0x4B, 0x1E, 0x08, 0x5D, 0x20,
+    0xDC, 0x63, 0xFF, 0xEF, 0x7E, 0x48, 0x9D, 0x50, 0x3F, 0x61, 0x19, 0x48, 0x1C, 0x50, 0x38, 0x80, 0x1D, 0x70, 0xF7, 0x80, 0x11, 0x68, 0x3A, 0x80, 0x78, 0x90, 0xB4, 0x88, 0x91, 0x98, 0xB9, 0x98, 0x17, 0xD2, 0xD1, 0xA0, 0xB3, 0x98, 0xB1, 0xA0, 0x8F, 0x90, 0x71, 0xC1, 0xB1, 0x98, 0xB0, 0xA0, 0xF0, 0xA8, 0x0F, 0xA9, 0xD0, 0xD9, 0xB1, 0xD1, 0xAF, 0xC9, 0xB2, 0xD9, 0xD1, 0xD9, 0x14, 0xFB,
+    0x72, 0xF2, 0xD3, 0xEA, 0xF3, 0xFA, 0x91, 0xF2, 0x13, 0xF3, 0x52, 0xF3, 0x70, 0xF2, 0x52, 0xFB, 0xD0, 0xF2, 0xCF, 0xEA, 0x30, 0xF3, 0xEF, 0xEA, 0x0F, 0xF3, 0x6C, 0xE2, 0x2F, 0xF3, 0x0F, 0xF3, 0x8C, 0xEA, 0x8D, 0xEA, 0xEE, 0xFA, 0xEE, 0xF2, 0xCE, 0xF2, 0x2C, 0xD2, 0x4C, 0xD2, 0x4C, 0xE2, 0x6D, 0xDA, 0x8D, 0xDA, 0x6C, 0xDA, 0xAD, 0xDA, 0xAD, 0xE2, 0xCD, 0xE2, 0x0E, 0xEB, 0x0F, 0xF3,
+    0x7F, 0xE7, 0x1D, 0x00, 0xDB, 0x61, 0xFF, 0xFF, 0x3F, 0x69, 0x7F, 0xDF, 0x1D, 0x10, 0x34, 0x48, 0xB8, 0x99, 0x14, 0x30, 0x17, 0x38, 0x16, 0x48, 0x3F, 0x79, 0xFF, 0x79, 0x5F, 0x30, 0x1E, 0x18, 0xFF, 0xAF, 0x3D, 0x70, 0x7F, 0x9B, 0x5E, 0xD6, 0xBE, 0x8D, 0x1B, 0x48, 0xBF, 0xB5, 0x1D, 0xC6, 0x7B, 0x68, 0x9A, 0x88, 0xDD, 0x98, 0x18, 0x70, 0x15, 0x70, 0x1A, 0x90, 0x15, 0x88, 0x16, 0x90,
+    0xFB, 0xC0, 0x93, 0xA8, 0x95, 0xA0, 0x76, 0xA0, 0x70, 0x90, 0x92, 0xB0, 0xB4, 0xB0, 0xD3, 0xB0, 0xF0, 0xA8, 0x13, 0xB1, 0x14, 0xE1, 0x35, 0xF2, 0x54, 0xE1, 0x10, 0xC9, 0xD2, 0xE1, 0x35, 0xF2, 0xB2, 0xE9, 0x34, 0xF2, 0x13, 0xF2, 0x8F, 0xE1, 0x53, 0xF2, 0x52, 0xF2, 0x10, 0xF2, 0x70, 0xF2, 0x30, 0xEA, 0xD1, 0xF2, 0xF1, 0xF2, 0xD0, 0xF2, 0x8E, 0xF2, 0x6E, 0xF2, 0xEF, 0xF2, 0xEF, 0xFA,
+    0x4D, 0xEA, 0x2C, 0xEA, 0x4D, 0xF2, 0x6E, 0xF2, 0xAF, 0xF2, 0x0C, 0xD2, 0x0C, 0xD2, 0x2C, 0xDA, 0x0C, 0xD2, 0x4D, 0xD2, 0x2C, 0xD2, 0x6D, 0xDA, 0x8D, 0xDA, 0xCE, 0xE2, 0xCE, 0xEA, 0xEF, 0xF2, 0x75, 0x81, 0x13, 0x28, 0x12, 0x28, 0x3B, 0x7A, 0x56, 0x69, 0x12, 0x30, 0x78, 0x61, 0x12, 0x38, 0x1A, 0x8A, 0x14, 0x30, 0x14, 0x38, 0x15, 0x28, 0xB8, 0x60, 0x39, 0x48, 0x18, 0x30, 0x18, 0x30,
+    0x38, 0x50, 0x18, 0x50, 0xBD, 0x68, 0x18, 0x48, 0xDD, 0x80, 0x18, 0x58, 0x1A, 0x48, 0x99, 0x80, 0x1A, 0x58, 0x15, 0x68, 0x39, 0x99, 0x15, 0x88, 0x97, 0xC8, 0x14, 0x80, 0x35, 0x90, 0x95, 0x98, 0xDC, 0xF9, 0x1D, 0xF1, 0x34, 0xC8, 0x93, 0xA8, 0x52, 0x98, 0x53, 0xC0, 0x17, 0xF0, 0x98, 0xE0, 0xD1, 0xB0, 0xD1, 0xB0, 0xF4, 0xE8, 0x9C, 0xE9, 0xF9, 0xF1, 0x13, 0xE1, 0x32, 0xD1, 0x18, 0xFA,
+    0x5F, 0xFC, 0xBF, 0xFD, 0xF4, 0xF1, 0xB1, 0xE9, 0x36, 0xEA, 0x7B, 0xF3, 0xFF, 0xFF, 0x51, 0xF2, 0x51, 0xEA, 0xB6, 0xFB, 0x98, 0xFD, 0x76, 0xF6, 0xFF, 0xFF, 0xAF, 0xEA, 0x75, 0xEE, 0x54, 0xED, 0x6E, 0xF3, 0x5A, 0xFE, 0xAE, 0xF2, 0xAE, 0xEA, 0x77, 0xFE, 0xAF, 0xF2, 0xD8, 0xFD, 0xEC, 0xD9, 0x4E, 0xE2, 0xB4, 0xFD, 0x2C, 0xE2, 0x3A, 0xFE, 0x95, 0xFC, 0xEF, 0xEA, 0xF0, 0xF2, 0x31, 0xF3,
+    0x14, 0x38, 0x97, 0x40, 0x15, 0x28, 0x97, 0x40, 0x34, 0x20, 0xF8, 0x40, 0xD7, 0x58, 0x7C, 0x69, 0x34, 0x50, 0x13, 0x30, 0xDB, 0x58, 0xB8, 0x48, 0xBF, 0x69, 0x1B, 0x59, 0x1D, 0x51, 0x5D, 0x69, 0xBD, 0x58, 0x3F, 0x6A, 0x1D, 0x50, 0xDF, 0x70, 0x9E, 0x68, 0x3E, 0x60, 0x7B, 0x50, 0xDF, 0xA0, 0xBD, 0x90, 0x18, 0x70, 0xF9, 0x98, 0x37, 0x98, 0xDF, 0xFF, 0xDC, 0xB8, 0x97, 0x98, 0x35, 0x90,
+    0x78, 0xD0, 0xFF, 0xFF, 0x7F, 0xF9, 0x53, 0xA8, 0x53, 0xA0, 0x56, 0xD8, 0xFF, 0xFF, 0x9D, 0xF0, 0xB2, 0xB0, 0x91, 0xA8, 0x36, 0xE9, 0x9F, 0xFE, 0x3E, 0xFA, 0xB2, 0xD8, 0x17, 0xFA, 0x1F, 0xFC, 0xFF, 0xFF, 0x39, 0xE3, 0xF7, 0xF1, 0xFB, 0xF3, 0xDF, 0xFF, 0x3E, 0xFE, 0x58, 0xF3, 0x58, 0xFB, 0xFF, 0xFD, 0x3A, 0xED, 0x79, 0xEC, 0xD6, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDA, 0xFF, 0xB4, 0xF6, 0xFF, 0xFF, 0xD0, 0xEC, 0xED, 0xDA, 0xB4, 0xED, 0x73, 0xFE, 0xFF, 0xFF, 0x4D, 0xE2, 0xF3, 0xFD, 0x2F, 0xF3, 0xCF, 0xEA, 0xD0, 0xF2, 0xF8, 0xED, 0xD0, 0xF2, 0xFF, 0xBF, 0xDF, 0x4F, 0xFF, 0xFF, 0xFB, 0x2A, 0x5B, 0x3A, 0x3D, 0x08, 0x1A, 0x18, 0x19, 0x28, 0x16, 0x40, 0x5E, 0x28, 0x3D, 0x41, 0x1F, 0x18, 0xFD, 0x54, 0x1B, 0x45, 0xFF, 0x8F, 0x5F, 0x9F,
+    0xFE, 0x6B, 0xFE, 0x95, 0xFF, 0xFF, 0xBF, 0xF7, 0x1F, 0xB6, 0xFB, 0x50, 0xFF, 0xFF, 0xDF, 0xDD, 0x1D, 0x58, 0x7D, 0x98, 0x5F, 0xFF, 0x3F, 0x88, 0x5F, 0xD1, 0x9F, 0xFD, 0x5A, 0xA0, 0x1A, 0x98, 0x5E, 0xC8, 0x38, 0xB0, 0x17, 0xA0, 0x39, 0xB0, 0x33, 0xA0, 0x57, 0xC0, 0x37, 0xC8, 0x76, 0xC0, 0x93, 0xA8, 0xB5, 0xB0, 0x3A, 0xE9, 0x15, 0xD9, 0xB6, 0xD8, 0x92, 0xC0, 0x14, 0xD1, 0xD8, 0xF9,
+    0x34, 0xE9, 0x75, 0xE9, 0x97, 0xF1, 0x32, 0xE1, 0x13, 0xE1, 0xF5, 0xF9, 0x72, 0xF1, 0xB2, 0xF1, 0xF2, 0xF1, 0x33, 0xF2, 0x11, 0xEA, 0x11, 0xF2, 0xF0, 0xF1, 0xCE, 0xF1, 0x10, 0xF2, 0xEF, 0xF1, 0xEF, 0xF1, 0x70, 0xFA, 0x0F, 0xF2, 0xEE, 0xF1, 0xCE, 0xE9, 0x8D, 0xC9, 0xAD, 0xC9, 0xAD, 0xD1, 0xCD, 0xC9, 0xEE, 0xC9, 0xCD, 0xC9, 0x0E, 0xD2, 0x2E, 0xD2, 0x4F, 0xE2, 0x6F, 0xE2, 0x6F, 0xEA,
+    0x13, 0x30, 0x15, 0x28, 0x13, 0x28, 0x14, 0x30, 0x35, 0x30, 0x14, 0x30, 0x14, 0x38, 0x14, 0x30, 0x14, 0x30, 0x14, 0x30, 0x36, 0x40, 0x16, 0x30, 0xFB, 0x58, 0x18, 0x38, 0xFE, 0x68, 0xBC, 0x50, 0x7A, 0x50, 0x5B, 0x50, 0x1C, 0x38, 0xBE, 0x80, 0x3B, 0x60, 0x1B, 0x50, 0x1C, 0x48, 0x3E, 0x68, 0x1B, 0x60, 0x18, 0x68, 0x17, 0x68, 0x17, 0x80, 0x58, 0x88, 0x17, 0x78, 0x17, 0x88, 0x16, 0x90,
+    0x15, 0x90, 0x15, 0x98, 0x77, 0xA8, 0x15, 0xA0, 0x35, 0x98, 0x15, 0xA0, 0x33, 0xA0, 0x75, 0xB0, 0x73, 0xA8, 0x92, 0xA8, 0x94, 0xD0, 0xF5, 0xC8, 0xD4, 0xD0, 0x93, 0xC0, 0xD2, 0xC0, 0x76, 0xF1, 0x96, 0xF1, 0x75, 0xE9, 0x96, 0xF9, 0x12, 0xD9, 0x13, 0xE1, 0x74, 0xF1, 0x52, 0xE9, 0x72, 0xE9, 0xD4, 0xF9, 0xB2, 0xF1, 0xB2, 0xF1, 0x90, 0xF1, 0x6E, 0xD9, 0xD0, 0xF1, 0xB0, 0xF1, 0xB0, 0xF1,
+    0x6F, 0xE1, 0x30, 0xF2, 0xAF, 0xE9, 0x8E, 0xE1, 0x8E, 0xD9, 0x8D, 0xC9, 0x8D, 0xC1, 0x8D, 0xC9, 0xAD, 0xC9, 0x8D, 0xC1, 0xCD, 0xC9, 0xEE, 0xC9, 0xEE, 0xD1, 0x2F, 0xDA, 0x2F, 0xDA, 0x70, 0xEA, 0x13, 0x30, 0x34, 0x30, 0x14, 0x28, 0x14, 0x30, 0x14, 0x30, 0x14, 0x30, 0x14, 0x38, 0x13, 0x30, 0x14, 0x30, 0x14, 0x38, 0x15, 0x40, 0x14, 0x20, 0x37, 0x40, 0x78, 0x38, 0x1C, 0x61, 0x7D, 0x69,
+    0x9A, 0x48, 0xBD, 0x60, 0x19, 0x40, 0x3A, 0x50, 0xBD, 0x70, 0x1B, 0x50, 0x3D, 0x68, 0x1B, 0x68, 0x1A, 0x60, 0x59, 0x80, 0x1A, 0x70, 0x16, 0x78, 0x19, 0x90, 0x18, 0x80, 0x17, 0x90, 0x37, 0x90, 0x17, 0x98, 0x36, 0xA0, 0x99, 0xB0, 0x14, 0xA0, 0x15, 0x98, 0x14, 0x98, 0x15, 0xA8, 0x97, 0xB8, 0x54, 0xA8, 0x53, 0xA8, 0x56, 0xD0, 0xB6, 0xD0, 0xB6, 0xD0, 0x93, 0xC0, 0x93, 0xC0, 0x58, 0xF1,
+    0xF5, 0xE0, 0x16, 0xE9, 0x78, 0xF9, 0xB2, 0xD0, 0xB3, 0xE0, 0xF4, 0xE8, 0x34, 0xF1, 0x52, 0xE9, 0x95, 0xF9, 0x94, 0xF1, 0xB4, 0xF1, 0x92, 0xF1, 0x70, 0xE9, 0x4F, 0xE9, 0xB1, 0xF1, 0x90, 0xE9, 0x4F, 0xE9, 0xD0, 0xF1, 0x6F, 0xE9, 0x8F, 0xE9, 0xCF, 0xE9, 0x6E, 0xD1, 0x6D, 0xC9, 0x8E, 0xD1, 0x8D, 0xC1, 0xCE, 0xC9, 0xAE, 0xC9, 0xEF, 0xC9, 0xCE, 0xD1, 0x0F, 0xD2, 0xEF, 0xD9, 0x50, 0xE2,
+    0x19, 0x38, 0x18, 0x10, 0x18, 0x20, 0x15, 0x38, 0x19, 0x18, 0x39, 0x30, 0x97, 0x40, 0x35, 0x30, 0x16, 0x30, 0xB9, 0x50, 0xD9, 0x38, 0xD8, 0x30, 0x59, 0x11, 0x9F, 0x6D, 0xFC, 0x31, 0xFE, 0x53, 0xFF, 0x55, 0xFF, 0x9F, 0xBF, 0xCF, 0x3F, 0xFF, 0x9C, 0x70, 0x5F, 0x7C, 0xFE, 0xF7, 0x7F, 0xFF, 0x7F, 0x91, 0x9F, 0xB1, 0xFF, 0xFF, 0x3F, 0xFA, 0xBE, 0xB8, 0xFF, 0xFF, 0x5C, 0xC0, 0x1C, 0xA0,
+    0x1F, 0xD0, 0x1D, 0xF0, 0x5C, 0xC8, 0x5B, 0xD0, 0x15, 0x98, 0x17, 0xB8, 0x1A, 0xE8, 0x3A, 0xE0, 0x14, 0xB0, 0x78, 0xD1, 0xDD, 0xF0, 0x5C, 0xF1, 0xBC, 0xF1, 0x55, 0xD0, 0xF9, 0xE0, 0x7F, 0xFA, 0xBF, 0xF4, 0x5A, 0xE9, 0xBC, 0xF9, 0xDA, 0xF1, 0x5D, 0xE3, 0x7F, 0xFB, 0xFB, 0xF1, 0x5A, 0xFA, 0x5D, 0xEB, 0xDC, 0xE3, 0xBC, 0xE3, 0x99, 0xEB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+    0xDF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0xFE, 0x32, 0xEC, 0x99, 0xFE, 0x55, 0xF3, 0x39, 0xF6, 0x37, 0xFC, 0x7B, 0xFF, 0x75, 0xFB, 0x50, 0xD4, 0xB3, 0xFA, 0x7C, 0xFE, 0xD3, 0xF2, 0x58, 0x51, 0x97, 0x48, 0xD8, 0x38, 0xB6, 0x58, 0x1B, 0x39, 0xB6, 0x48, 0x55, 0x38, 0xBA, 0x68, 0xB8, 0x50, 0x57, 0x38, 0xF9, 0x28, 0xB7, 0x40, 0xBC, 0x79, 0x5B, 0x59, 0x59, 0x38, 0x7B, 0x51,
+    0xBD, 0x94, 0x1F, 0xEE, 0xBF, 0x80, 0x5A, 0x50, 0x1B, 0x58, 0x1C, 0x50, 0x3E, 0x58, 0x5F, 0x98, 0x3B, 0x68, 0x1A, 0x70, 0x1B, 0x70, 0xBE, 0xB8, 0xFF, 0xFF, 0x1C, 0xA8, 0x16, 0x88, 0x39, 0x90, 0x1A, 0xB0, 0xFF, 0xFF, 0x3E, 0xF0, 0x17, 0xB0, 0x17, 0xA0, 0x18, 0xC0, 0xFF, 0xFF, 0x1F, 0xFC, 0x17, 0xB8, 0x15, 0xA8, 0x1A, 0xE0, 0xBE, 0xE9, 0xFF, 0xFF, 0x16, 0xD8, 0x55, 0xC8, 0xFD, 0xF8,
+    0x9B, 0xE0, 0xFF, 0xFF, 0xBA, 0xF0, 0x75, 0xE0, 0xBA, 0xF0, 0x9D, 0xEA, 0x3F, 0xFC, 0xF6, 0xE8, 0x37, 0xF1, 0x78, 0xE9, 0xD8, 0xF1, 0x53, 0xE1, 0xF2, 0xE8, 0x54, 0xE9, 0x72, 0xF1, 0xB4, 0xF9, 0x51, 0xE9, 0x56, 0xF2, 0x10, 0xD9, 0xCF, 0xE0, 0x0F, 0xD9, 0x2F, 0xC1, 0xEF, 0xC8, 0x50, 0xD1, 0x4E, 0xB9, 0x4E, 0xB9, 0x6F, 0xC1, 0xB0, 0xC9, 0xB0, 0xC9, 0xB0, 0xC9, 0xB0, 0xD1, 0xF0, 0xD9,
+    0x34, 0x40, 0x14, 0x20, 0x18, 0x61, 0x55, 0x58, 0x15, 0x30, 0x14, 0x28, 0x35, 0x40, 0x97, 0x48, 0x15, 0x30, 0x39, 0x69, 0x15, 0x30, 0xFA, 0x80, 0x79, 0x30, 0x5A, 0x40, 0xDF, 0x79, 0x5A, 0x60, 0xDD, 0x40, 0x5F, 0x69, 0xBE, 0x60, 0x1D, 0x50, 0x3D, 0x60, 0x1C, 0x50, 0x3F, 0x68, 0x1E, 0x40, 0x3E, 0x78, 0x1B, 0x60, 0x1D, 0x70, 0x7F, 0x98, 0x5D, 0xB8, 0x1A, 0x88, 0x3B, 0xA8, 0x19, 0x98,
+    0x1A, 0x98, 0x5B, 0xB8, 0x3B, 0xB0, 0x7B, 0xC8, 0x17, 0x98, 0x16, 0xA0, 0x19, 0xD0, 0x1C, 0xD0, 0x17, 0xA8, 0x15, 0xA0, 0x1A, 0xE0, 0x18, 0xD0, 0x1C, 0xF1, 0x15, 0xC0, 0x36, 0xC0, 0xDC, 0xF8, 0x15, 0xD0, 0xF8, 0xF0, 0x98, 0xE8, 0x33, 0xC8, 0x77, 0xE8, 0x75, 0xE0, 0x35, 0xD8, 0x74, 0xD8, 0x17, 0xF1, 0x74, 0xE0, 0xD5, 0xF0, 0xB2, 0xD8, 0xD1, 0xD0, 0xF1, 0xD8, 0x93, 0xF1, 0xF3, 0xE8,
+    0xD2, 0xE0, 0x32, 0xE9, 0xF0, 0xC8, 0xD0, 0xD0, 0x30, 0xD1, 0x0F, 0xB9, 0x50, 0xD1, 0x30, 0xC9, 0x2E, 0xB9, 0x4F, 0xB9, 0x4F, 0xB9, 0x4F, 0xB9, 0xD0, 0xC9, 0x8F, 0xC9, 0xD1, 0xD1, 0xB1, 0xD9, 0xDC, 0x68, 0x19, 0x28, 0x9C, 0x78, 0x17, 0x40, 0x17, 0x28, 0x78, 0x58, 0x16, 0x38, 0x99, 0x48, 0x16, 0x28, 0x15, 0x40, 0x99, 0x58, 0x5F, 0xC2, 0x58, 0x30, 0x9A, 0x38, 0x9D, 0x48, 0xFF, 0x91,
+    0x1F, 0x94, 0x5F, 0x5A, 0x9D, 0x38, 0x9D, 0x48, 0x3F, 0x78, 0x5F, 0x81, 0x5F, 0xD4, 0x9B, 0xBB, 0x3F, 0x90, 0x5E, 0x90, 0xFF, 0xFF, 0x1D, 0xA8, 0x1E, 0xD1, 0xFF, 0xFF, 0x9F, 0xE8, 0x7E, 0xB0, 0xBE, 0xFD, 0x1A, 0xA0, 0x5D, 0xB0, 0x5D, 0xC8, 0x18, 0x98, 0x16, 0x98, 0x16, 0xA0, 0x39, 0xB0, 0x17, 0xA8, 0x17, 0xA0, 0x1C, 0xE0, 0x38, 0xC8, 0x3E, 0xF1, 0x77, 0xD0, 0x17, 0xC0, 0x1E, 0xF9,
+    0x37, 0xD8, 0x99, 0xE8, 0x7C, 0xF0, 0x15, 0xD0, 0x99, 0xF0, 0x55, 0xD0, 0xB6, 0xD8, 0xD6, 0xE0, 0xF7, 0xF0, 0x95, 0xE8, 0xB6, 0xE8, 0x92, 0xD8, 0x54, 0xE9, 0xF3, 0xE0, 0x91, 0xD0, 0x16, 0xF9, 0x15, 0xF1, 0xD2, 0xE0, 0xF1, 0xD8, 0xB1, 0xD8, 0xF0, 0xD0, 0x10, 0xC9, 0x53, 0xE1, 0x32, 0xD9, 0x2F, 0xC1, 0x50, 0xC1, 0x50, 0xC1, 0x2F, 0xC1, 0x90, 0xD1, 0x70, 0xC9, 0xD1, 0xD9, 0xD1, 0xE1,
+    0x1C, 0x11, 0xFF, 0xAF, 0x7E, 0x22, 0xFF, 0xF7, 0x5D, 0x10, 0x3F, 0x73, 0x37, 0x20, 0x3B, 0x41, 0x17, 0x28, 0x39, 0x28, 0x9F, 0x7A, 0x7B, 0x4A, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xD7, 0x7B, 0x4C, 0xFF, 0xFF, 0xFF, 0xDF, 0x3C, 0x1B, 0x9F, 0x96, 0x7A, 0x5C, 0xBD, 0xAD, 0x9F, 0x89, 0x5F, 0xE5, 0x1C, 0x70, 0x7D, 0x68, 0x3F, 0x80, 0x3A, 0xA0, 0xFE, 0xC8, 0x1C, 0x88, 0x5F, 0xE9, 0x5F, 0xA8,
+    0x3B, 0x98, 0x39, 0x98, 0x1B, 0xA0, 0x1B, 0xC8, 0x39, 0x98, 0x16, 0xA0, 0x18, 0xA8, 0x3B, 0xB8, 0x17, 0xA8, 0x17, 0xA8, 0x1F, 0xF9, 0x9B, 0xE0, 0x1E, 0xF2, 0x36, 0xC8, 0xBD, 0xE8, 0x9F, 0xF9, 0xBD, 0xF8, 0x79, 0xE0, 0x7D, 0xF0, 0x9D, 0xF9, 0x3D, 0xF0, 0x39, 0xE8, 0x1A, 0xF1, 0x37, 0xD8, 0x7E, 0xF8, 0x1C, 0xF9, 0xD9, 0xF0, 0xFB, 0xF9, 0x78, 0xE2, 0xD7, 0xF0, 0xF9, 0xF1, 0xFF, 0xFF,
+    0xBE, 0xF3, 0x97, 0xF0, 0x9A, 0xFA, 0xFF, 0xFF, 0x3E, 0xFC, 0xF6, 0xF0, 0xB6, 0xF9, 0x36, 0xF1, 0xFF, 0xFF, 0x98, 0xF1, 0x3A, 0xD9, 0x71, 0xD1, 0xDF, 0xFF, 0x52, 0xE1, 0x9D, 0xF4, 0x96, 0xF9, 0x35, 0x28, 0x79, 0x18, 0x35, 0x28, 0x5F, 0x84, 0x5F, 0x52, 0x77, 0x38, 0x1A, 0x20, 0x7C, 0x28, 0x38, 0x30, 0xDD, 0x43, 0x39, 0x28, 0x59, 0x38, 0xDF, 0x94, 0x7D, 0x4A, 0xDB, 0x40, 0xFB, 0x29,
+    0xBF, 0x41, 0x9C, 0x21, 0x3D, 0x38, 0x1E, 0x50, 0xFF, 0xAA, 0x1E, 0x60, 0x5E, 0x78, 0x1D, 0x48, 0x1C, 0x70, 0x1E, 0x80, 0x9F, 0xA9, 0x1B, 0x88, 0x1A, 0x80, 0x1F, 0xA0, 0x1B, 0x90, 0x1C, 0x90, 0x1B, 0x98, 0x1D, 0xC8, 0x1D, 0xE0, 0x19, 0xB0, 0x1A, 0x98, 0x18, 0xA0, 0xBF, 0xF8, 0x1F, 0xF8, 0x19, 0xA8, 0x17, 0xA8, 0x1E, 0xF1, 0xFF, 0xFF, 0x3F, 0xF8, 0x38, 0xD0, 0x39, 0xC8, 0x7D, 0xF1,
+    0xFF, 0xFF, 0x3C, 0xE8, 0x1F, 0xFA, 0x19, 0xE0, 0xFF, 0xFF, 0x5F, 0xFF, 0x1B, 0xE8, 0x19, 0xD8, 0x1E, 0xEA, 0xFF, 0xFF, 0x9F, 0xF4, 0x38, 0xE8, 0x98, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x5D, 0xF9, 0x5F, 0xFB, 0x96, 0xF0, 0xFF, 0xFF, 0xDE, 0xFB, 0x74, 0xE8, 0x5B, 0xDB, 0xB3, 0xE0, 0x59, 0xFA, 0x78, 0xEB, 0xD6, 0xF3, 0x35, 0xF1, 0x31, 0xD9, 0x94, 0xF1, 0x52, 0xE1, 0xD5, 0xF1,
+    0x37, 0x38, 0x16, 0x20, 0x58, 0x30, 0xFA, 0x48, 0x5D, 0x40, 0x17, 0x38, 0x55, 0x40, 0x9A, 0x48, 0x59, 0x40, 0xBD, 0x28, 0x7A, 0x60, 0xDF, 0x48, 0xBF, 0x42, 0x38, 0x30, 0x3D, 0x51, 0x1A, 0x38, 0x3D, 0x30, 0xDD, 0x50, 0x3E, 0x68, 0xBF, 0xA3, 0x1E, 0x40, 0x1F, 0x58, 0xBE, 0x99, 0x1F, 0x88, 0xBD, 0x78, 0x7A, 0x68, 0x9F, 0xFF, 0x3E, 0x90, 0x3F, 0xFD, 0xFF, 0xFF, 0x1D, 0xB8, 0x7E, 0xEA,
+    0xBF, 0xFD, 0xFF, 0xFF, 0x9F, 0xF8, 0x7D, 0xD0, 0x5C, 0xB0, 0x1B, 0xA8, 0xFD, 0xF5, 0xBD, 0xEB, 0x1A, 0xB0, 0x18, 0xA0, 0x3F, 0xF0, 0x1F, 0xFA, 0xFF, 0xFF, 0x5A, 0xE8, 0x59, 0xC0, 0x5F, 0xF8, 0x1F, 0xF0, 0xFF, 0xFF, 0x1D, 0xF0, 0x18, 0xD0, 0x1D, 0xF8, 0x1D, 0xE8, 0xBF, 0xFB, 0x16, 0xC8, 0x19, 0xE8, 0x3A, 0xF0, 0x5A, 0xF0, 0x7F, 0xFC, 0x5C, 0xFA, 0xB6, 0xE8, 0x54, 0xE0, 0xB7, 0xF8,
+    0xF8, 0xF0, 0x3F, 0xFB, 0x71, 0xC8, 0xF5, 0xE0, 0x91, 0xB8, 0x91, 0xB8, 0xFA, 0xFA, 0xD0, 0xB8, 0xF0, 0xB0, 0xF0, 0xB0, 0xF0, 0xB8, 0x97, 0xFA, 0xD3, 0xC8, 0x31, 0xC1, 0x51, 0xC1, 0x31, 0xC9, 0x1C, 0x08, 0xFF, 0xEF, 0x1C, 0x08, 0x1A, 0x00, 0x5F, 0x38, 0x18, 0x28, 0x36, 0x38, 0x17, 0x20, 0x16, 0x08, 0x39, 0x20, 0xDF, 0x58, 0x3D, 0x20, 0x3F, 0x30, 0x7F, 0x41, 0x7F, 0xA6, 0x3F, 0x75,
+    0x9D, 0x01, 0xDF, 0x77, 0xFF, 0xDF, 0xBF, 0x7C, 0x1E, 0x30, 0xFF, 0xFF, 0x7F, 0xFF, 0x3F, 0x48, 0x3C, 0x50, 0xBF, 0xF7, 0x1D, 0x68, 0x1E, 0x78, 0x3F, 0xB1, 0x5F, 0x88, 0x5D, 0xA0, 0x1D, 0x90, 0x1A, 0x80, 0x1C, 0xA0, 0x3D, 0xA8, 0x3F, 0xC8, 0x9E, 0xA0, 0x1A, 0x98, 0x1B, 0xD0, 0x1D, 0xC8, 0x19, 0xA0, 0x18, 0xA0, 0x9F, 0xF0, 0x7B, 0xD0, 0x9E, 0xF0, 0x17, 0xB8, 0x19, 0xB8, 0x7E, 0xF0,
+    0x19, 0xC8, 0x19, 0xD0, 0x1C, 0xE0, 0x18, 0xC0, 0x1C, 0xE8, 0x17, 0xC8, 0x17, 0xC8, 0x16, 0xC0, 0x3A, 0xE8, 0x9A, 0xF0, 0x19, 0xE0, 0x77, 0xD8, 0xB6, 0xD8, 0x33, 0xC0, 0x33, 0xC0, 0x57, 0xE8, 0xB6, 0xE0, 0x13, 0xC0, 0x54, 0xC8, 0x94, 0xD0, 0x92, 0xC0, 0x31, 0xB8, 0x92, 0xC0, 0xD0, 0xB0, 0xD0, 0xB0, 0xCF, 0xB0, 0x12, 0xC1, 0x11, 0xB9, 0xD2, 0xC0, 0x11, 0xC1, 0x31, 0xC1, 0x73, 0xD9,
+    0xDF, 0x47, 0x9C, 0x10, 0x37, 0x20, 0x59, 0x20, 0x18, 0x20, 0x15, 0x28, 0xDE, 0x89, 0x15, 0x20, 0x17, 0x10, 0x9E, 0x18, 0x18, 0x38, 0x7B, 0x21, 0xFF, 0xE7, 0x7F, 0x3A, 0x9E, 0x38, 0xDF, 0x4D, 0xFF, 0xF7, 0x7F, 0x56, 0x7E, 0x18, 0x1F, 0x5B, 0x9F, 0xBF, 0x1E, 0x40, 0x1C, 0x50, 0x7E, 0x69, 0x1C, 0x60, 0x1E, 0x58, 0x1D, 0x58, 0x1D, 0x78, 0x19, 0x68, 0x3B, 0x78, 0x1C, 0x88, 0x7F, 0xA8,
+    0x1A, 0x78, 0x1C, 0x98, 0x3D, 0x98, 0xDF, 0xE8, 0x9F, 0xA0, 0x18, 0x90, 0x19, 0xA0, 0x3B, 0xA8, 0x18, 0xA0, 0x18, 0x98, 0xFF, 0xF0, 0x5D, 0xD0, 0x3F, 0xFA, 0x3A, 0xC0, 0x3C, 0xC8, 0x5F, 0xF0, 0x19, 0xB8, 0x1A, 0xD0, 0x3F, 0xE8, 0x17, 0xB8, 0x3E, 0xF0, 0x17, 0xB8, 0x9A, 0xF0, 0x5C, 0xF0, 0x3D, 0xF0, 0x3C, 0xF0, 0x3D, 0xF0, 0xBB, 0xF8, 0x18, 0xF0, 0x35, 0xD0, 0x59, 0xF9, 0xFB, 0xD5,
+    0x1C, 0xF0, 0x15, 0xD0, 0x12, 0xC0, 0x9E, 0xF7, 0x17, 0xF0, 0xB9, 0xF0, 0x92, 0xC0, 0xB4, 0xC8, 0x9D, 0xED, 0xB2, 0xC8, 0x52, 0xC8, 0x11, 0xB1, 0x7E, 0xFA, 0x12, 0xC1, 0x35, 0xD9, 0x15, 0xE1, 0x56, 0x38, 0x38, 0x18, 0x14, 0x28, 0x35, 0x28, 0x13, 0x28, 0xDF, 0x6A, 0x17, 0x38, 0x36, 0x38, 0x77, 0x38, 0xFF, 0xAF, 0x17, 0x28, 0x1A, 0x20, 0x18, 0x18, 0x1B, 0x20, 0x19, 0x38, 0x3A, 0x28,
+    0x1C, 0x18, 0xDF, 0x41, 0x3F, 0x30, 0x1C, 0x30, 0x1E, 0x38, 0x1D, 0x40, 0x5F, 0xB2, 0x1E, 0x48, 0x1F, 0x58, 0xFF, 0xA2, 0x5F, 0x88, 0x1B, 0x68, 0x1B, 0x60, 0xFF, 0xFE, 0x1E, 0x98, 0x1E, 0x80, 0xDE, 0xD1, 0x1C, 0x98, 0x1E, 0xA8, 0x7F, 0xE9, 0x1B, 0x90, 0x18, 0x90, 0x1B, 0xA8, 0x1C, 0xA8, 0x1A, 0xA0, 0x18, 0x98, 0x9F, 0xFA, 0x1D, 0xE8, 0x7F, 0xFA, 0x9E, 0xE0, 0x1A, 0xB0, 0x9E, 0xF4,
+    0xFF, 0xF9, 0x3D, 0xE8, 0x5F, 0xF0, 0x1B, 0xE0, 0xFF, 0xFF, 0x1E, 0xF0, 0x1B, 0xD8, 0x1C, 0xE0, 0xDF, 0xFF, 0x3F, 0xF9, 0x5E, 0xF0, 0x39, 0xE0, 0x9E, 0xF3, 0xFF, 0xFF, 0x9F, 0xF8, 0x3C, 0xF8, 0xDE, 0xF5, 0xBF, 0xFF, 0xFF, 0xFA, 0x14, 0xD0, 0x39, 0xF0, 0x39, 0xF0, 0xDF, 0xFF, 0x91, 0xB0, 0xD1, 0xB0, 0xD1, 0xA8, 0xB2, 0xC0, 0x5F, 0xFD, 0x35, 0xF1, 0xF3, 0xC8, 0xF3, 0xD8, 0x1F, 0xFB,
+    0x14, 0x10, 0x9F, 0x4A, 0x1E, 0x08, 0x7C, 0x30, 0x16, 0x20, 0x15, 0x28, 0x5D, 0x51, 0x5E, 0x59, 0x7E, 0x38, 0x1C, 0x20, 0x7A, 0x40, 0x17, 0x20, 0x1D, 0x10, 0x19, 0x30, 0x19, 0x38, 0x3E, 0x40, 0x9C, 0x53, 0x1D, 0x08, 0xFD, 0x39, 0x1C, 0x20, 0x1F, 0x58, 0x1E, 0x20, 0xFF, 0xFF, 0x1F, 0x38, 0xDF, 0x79, 0xBF, 0xFF, 0xBC, 0x58, 0x7D, 0x70, 0x1C, 0x58, 0x1F, 0xA0, 0x1A, 0x68, 0x19, 0x68,
+    0x1F, 0x98, 0x5F, 0xA8, 0x9F, 0xFA, 0x1D, 0x98, 0x19, 0x80, 0x19, 0x90, 0xDF, 0xF9, 0xFD, 0xF1, 0x1A, 0xA0, 0x1A, 0x98, 0x5F, 0xE8, 0xFF, 0xFF, 0x5F, 0xF8, 0x9D, 0xD8, 0x3B, 0xB0, 0xFF, 0xFB, 0xFF, 0xFF, 0x7D, 0xF0, 0x7F, 0xFA, 0x1B, 0xC8, 0x1E, 0xF1, 0x5E, 0xEE, 0x1C, 0xD8, 0x1B, 0xD0, 0x3E, 0xF8, 0xDF, 0xFF, 0x5F, 0xFC, 0x18, 0xD8, 0x16, 0xC8, 0x19, 0xE0, 0xFF, 0xFF, 0x9E, 0xF2,
+    0x1F, 0xFA, 0x13, 0xB8, 0x13, 0xC0, 0x1F, 0xFB, 0x7E, 0xF2, 0xB2, 0xC8, 0x71, 0xA8, 0x2F, 0xA0, 0x6F, 0xA8, 0x99, 0xF9, 0xD0, 0xA8, 0xD0, 0xA8, 0xB0, 0xA8, 0xD1, 0xB0, 0xD1, 0xB8, 0x34, 0xE1, 0x39, 0x00, 0x14, 0x10, 0xDE, 0x18, 0xDF, 0x10, 0x3B, 0x40, 0x14, 0x20, 0x18, 0x30, 0x59, 0x40, 0x38, 0x28, 0x1F, 0x61, 0x1D, 0x10, 0x18, 0x18, 0x17, 0x20, 0x5E, 0x11, 0xDF, 0x60, 0x18, 0x20,
+    0x1E, 0x08, 0xFF, 0xFF, 0x7D, 0x7C, 0x1E, 0x20, 0x7E, 0x20, 0xDD, 0x4B, 0x1C, 0x40, 0x1E, 0x70, 0x3F, 0x92, 0x3F, 0x48, 0x7D, 0x60, 0x1B, 0x48, 0x1F, 0x98, 0x19, 0x58, 0x1A, 0x68, 0x1E, 0xC2, 0x5B, 0x78, 0xBE, 0xED, 0x1B, 0xA8, 0x1E, 0xB8, 0x1B, 0x70, 0x1A, 0x88, 0x1C, 0xE8, 0x7D, 0xE3, 0x1A, 0x98, 0x18, 0x88, 0x5F, 0xD8, 0x7D, 0xE8, 0xFF, 0xFF, 0x3C, 0xC0, 0x1C, 0xB8, 0x3F, 0xE0,
+    0x1E, 0xE0, 0x7F, 0xFB, 0x9C, 0xD0, 0x19, 0xA8, 0x5E, 0xE8, 0x1C, 0xE8, 0x3F, 0xFA, 0x7D, 0xD8, 0x18, 0xB8, 0x19, 0xD0, 0x39, 0xD0, 0x9F, 0xF2, 0x14, 0xB8, 0x14, 0xB0, 0x13, 0xA8, 0x14, 0xA8, 0x15, 0xB8, 0xDF, 0xF9, 0x31, 0xA0, 0x51, 0x98, 0x51, 0x98, 0x53, 0xB0, 0xBA, 0xF9, 0x90, 0x98, 0x90, 0xA0, 0xD1, 0xA0, 0xB0, 0xA0, 0x97, 0xF9, 0xF1, 0xB0, 0xD1, 0xA8, 0xF2, 0xB8, 0xF6, 0xE9,
+    0x36, 0x28, 0x14, 0x30, 0x56, 0x40, 0x17, 0x18, 0x15, 0x28, 0x14, 0x20, 0x16, 0x30, 0x98, 0x48, 0x1B, 0x30, 0x15, 0x20, 0x15, 0x28, 0x1A, 0x10, 0x3B, 0x30, 0x5D, 0x30, 0x79, 0x48, 0x7F, 0x4A, 0x5D, 0x18, 0x1F, 0x18, 0x3E, 0x30, 0x1F, 0x52, 0x1C, 0x28, 0x1B, 0x30, 0x3E, 0x68, 0x1F, 0x61, 0x3E, 0x48, 0x1D, 0x48, 0x1D, 0x50, 0x5E, 0x68, 0x1A, 0x50, 0x19, 0x50, 0x18, 0x58, 0x1D, 0x70,
+    0x5F, 0x78, 0x5D, 0x90, 0x1B, 0x78, 0x1B, 0x98, 0x1A, 0x78, 0x18, 0x80, 0x1D, 0xA8, 0x7F, 0xC0, 0x1A, 0x88, 0x18, 0x80, 0x1E, 0xC0, 0x3E, 0xC8, 0x7F, 0xE0, 0x1D, 0xB0, 0x1A, 0xA0, 0x5F, 0xE8, 0x1B, 0xB0, 0x1A, 0xA8, 0x1E, 0xC8, 0x19, 0xA8, 0x5D, 0xD0, 0x18, 0xA8, 0x5B, 0xD8, 0x9E, 0xE8, 0x18, 0xB0, 0x17, 0xB0, 0x39, 0xC0, 0x16, 0xB8, 0x16, 0xB8, 0x13, 0xA0, 0x12, 0xA0, 0x77, 0xC8,
+    0x13, 0xA8, 0x12, 0x98, 0x11, 0x98, 0xF5, 0xC0, 0x31, 0x98, 0xB6, 0xC0, 0x70, 0x98, 0x91, 0xA0, 0x91, 0xA0, 0x90, 0x98, 0x90, 0xA0, 0xB0, 0xA0, 0xD1, 0xA8, 0xD0, 0xA0, 0xD1, 0xA8, 0x96, 0xD9, 0x13, 0x20, 0x98, 0x38, 0x15, 0x28, 0x13, 0x18, 0x14, 0x20, 0xBC, 0x30, 0x17, 0x18, 0x14, 0x20, 0x14, 0x28, 0x3E, 0x18, 0x7F, 0x49, 0x7C, 0x40, 0xBD, 0x38, 0xBF, 0x30, 0x3A, 0x38, 0x17, 0x28,
+    0x1F, 0x28, 0x1F, 0x39, 0x3F, 0x30, 0x1F, 0x18, 0x1D, 0x30, 0x1C, 0x30, 0x1B, 0x50, 0x1C, 0x28, 0x1E, 0x30, 0x1E, 0x30, 0x1F, 0x68, 0x1A, 0x50, 0x1D, 0x48, 0xFE, 0xF7, 0x1F, 0x80, 0x19, 0x68, 0xDE, 0xB1, 0x1C, 0x78, 0x9D, 0x90, 0x1C, 0xA0, 0x39, 0x78, 0x18, 0x78, 0x1B, 0x80, 0x1B, 0x88, 0x19, 0x80, 0x19, 0x80, 0x3E, 0xC8, 0x1E, 0xC8, 0xDF, 0xE9, 0x3F, 0xC0, 0x1A, 0x98, 0x9B, 0xD1,
+    0x1F, 0xC0, 0x1D, 0xD0, 0x1D, 0xB8, 0xFE, 0xFF, 0x1F, 0xE8, 0x1A, 0xA8, 0x19, 0xA8, 0x3F, 0xF8, 0x1D, 0xE8, 0x1B, 0xD0, 0xBE, 0xE0, 0x17, 0xB0, 0xFF, 0xFF, 0x1A, 0xC0, 0x14, 0xA0, 0x14, 0xA8, 0xFF, 0xFF, 0x13, 0xB0, 0x11, 0xA0, 0x31, 0x90, 0xB5, 0xC0, 0xD6, 0xC8, 0x70, 0x90, 0x90, 0x90, 0x90, 0x98, 0x90, 0x98, 0x90, 0x98, 0xB0, 0xA0, 0xB0, 0xA0, 0xD1, 0xA8, 0x75, 0xE0, 0x76, 0xE1,
+    0xBF, 0x9E, 0x3B, 0x10, 0x36, 0x28, 0x1E, 0x63, 0x77, 0x20, 0x14, 0x20, 0x15, 0x20, 0x9B, 0x38, 0x15, 0x20, 0x14, 0x28, 0x17, 0x20, 0x15, 0x28, 0x7B, 0x58, 0x17, 0x20, 0x18, 0x30, 0x17, 0x28, 0x7F, 0x38, 0x3F, 0x08, 0xFF, 0xFF, 0x3F, 0x28, 0xFF, 0x61, 0x3E, 0x52, 0xBD, 0x48, 0x3B, 0x40, 0x1D, 0x30, 0x1E, 0x60, 0x1A, 0x40, 0x19, 0x48, 0x1E, 0x60, 0x1B, 0x58, 0x19, 0x60, 0x18, 0x58,
+    0x39, 0x60, 0x3B, 0x70, 0x9F, 0xD0, 0x3D, 0xA0, 0x9C, 0x80, 0x18, 0x78, 0x1F, 0xB0, 0x1E, 0xB0, 0x1B, 0x88, 0x19, 0x80, 0x5D, 0xB8, 0xFF, 0xFF, 0x1F, 0xD0, 0x7F, 0xC0, 0x1A, 0x98, 0x1F, 0xF2, 0xFF, 0xFF, 0x3E, 0xC0, 0x5E, 0xD8, 0x1D, 0xC8, 0xFF, 0xFF, 0x3F, 0xF0, 0x19, 0xA8, 0x3C, 0xC0, 0xDE, 0xF2, 0x9F, 0xFE, 0x1C, 0xC8, 0x17, 0xA8, 0x17, 0xB8, 0xDF, 0xFF, 0xBD, 0xEB, 0x15, 0xB8,
+    0x12, 0x98, 0x13, 0x98, 0x7B, 0xF9, 0x10, 0x90, 0x31, 0x90, 0x11, 0x98, 0x50, 0xA8, 0xF9, 0xF0, 0xB1, 0xA8, 0x6F, 0x90, 0x8F, 0x98, 0x70, 0x98, 0xB1, 0xA0, 0xD2, 0xB8, 0xD1, 0xA8, 0x53, 0xC9, 0x13, 0x20, 0x77, 0x38, 0x36, 0x28, 0x94, 0x40, 0x54, 0x30, 0x12, 0x20, 0x9B, 0x48, 0x11, 0x20, 0x58, 0x40, 0x1F, 0x28, 0x3B, 0x38, 0x17, 0x30, 0x18, 0x20, 0x3F, 0x28, 0x58, 0x30, 0x5C, 0x48,
+    0x1A, 0x18, 0x5C, 0x2A, 0xDF, 0x49, 0x7D, 0x52, 0x3D, 0x48, 0x1B, 0x28, 0x1B, 0x38, 0x5C, 0x50, 0x1E, 0xE4, 0x18, 0x40, 0x19, 0x40, 0x17, 0x40, 0x1A, 0x58, 0x1E, 0x90, 0x17, 0x58, 0x1F, 0x70, 0x39, 0x60, 0x1A, 0x70, 0xDE, 0xD1, 0xFF, 0xB8, 0x18, 0x68, 0x19, 0x70, 0x9D, 0xE2, 0xFF, 0xFB, 0x1A, 0x80, 0x19, 0x78, 0x1F, 0xA8, 0x9F, 0xFF, 0x9E, 0xE8, 0xBF, 0xC8, 0x1D, 0xA8, 0x1B, 0xD0,
+    0xFF, 0xFF, 0x1B, 0xA8, 0x3E, 0xC8, 0x19, 0x98, 0xBB, 0xD0, 0x3F, 0xFA, 0x17, 0xA0, 0x7A, 0xB0, 0x18, 0xA8, 0x1C, 0xD8, 0x5F, 0xF9, 0x17, 0xA8, 0x14, 0x98, 0x14, 0x98, 0x9E, 0xFA, 0x3E, 0xF0, 0x12, 0x98, 0x11, 0x90, 0x10, 0x88, 0x97, 0xD1, 0x1F, 0xFA, 0x30, 0x90, 0x50, 0x90, 0x70, 0x88, 0x4F, 0x88, 0x16, 0xF1, 0xB0, 0x90, 0xB0, 0x90, 0xD0, 0x98, 0xB0, 0xA0, 0xB1, 0xA0, 0xF2, 0xC0,
+    0x12, 0x18, 0x12, 0x28, 0x12, 0x20, 0x12, 0x18, 0x97, 0x48, 0x11, 0x28, 0x13, 0x28, 0x13, 0x28, 0x37, 0x30, 0x58, 0x50, 0x13, 0x28, 0x36, 0x30, 0x16, 0x28, 0x1E, 0x7A, 0x7A, 0x50, 0x1B, 0x28, 0x19, 0x28, 0x17, 0x28, 0x7D, 0x49, 0x3D, 0x38, 0x19, 0x30, 0x19, 0x30, 0x1C, 0x30, 0x3D, 0x51, 0x17, 0x38, 0x1E, 0x30, 0xFF, 0xFF, 0x1B, 0x48, 0x1F, 0x60, 0xFF, 0xFF, 0x17, 0x48, 0x16, 0x48,
+    0x7E, 0x50, 0x19, 0x68, 0xDD, 0xA8, 0x9D, 0x90, 0x17, 0x68, 0x17, 0x68, 0x1E, 0x88, 0x3D, 0xB9, 0x18, 0x78, 0x19, 0x80, 0x3F, 0xA0, 0x1E, 0xC0, 0xDE, 0xF2, 0x7D, 0xB0, 0x5A, 0x90, 0x7F, 0xB8, 0x1B, 0xA0, 0xFF, 0xF9, 0x1D, 0xC9, 0x18, 0x90, 0x9C, 0xA8, 0x17, 0x90, 0x1E, 0xF0, 0x9B, 0xC8, 0x16, 0x98, 0x15, 0x90, 0x17, 0xB0, 0x5E, 0xF8, 0x12, 0x90, 0x11, 0x80, 0x12, 0x88, 0x3A, 0xB0,
+    0x5E, 0xF1, 0x3D, 0xF9, 0x52, 0x98, 0x72, 0xA0, 0x10, 0x88, 0x30, 0x90, 0xD6, 0xE8, 0x50, 0x88, 0x70, 0x88, 0x6F, 0x88, 0x6F, 0x90, 0x35, 0xE1, 0xD0, 0x98, 0xB0, 0x98, 0xB0, 0x98, 0x2C, 0x80, 0x11, 0x20, 0x13, 0x28, 0x96, 0x48, 0x11, 0x28, 0x11, 0x28, 0x12, 0x20, 0x7B, 0x30, 0x97, 0x58, 0x14, 0x28, 0x54, 0x38, 0x13, 0x20, 0x13, 0x28, 0x5B, 0x40, 0x38, 0x38, 0x15, 0x28, 0x14, 0x20,
+    0x15, 0x28, 0x15, 0x18, 0x1B, 0x30, 0x1A, 0x20, 0x18, 0x28, 0x3D, 0x30, 0x9E, 0x58, 0x17, 0x40, 0x18, 0x38, 0x3A, 0x73, 0xFE, 0x98, 0x17, 0x40, 0x3A, 0x48, 0x38, 0x50, 0x3E, 0x70, 0x38, 0x60, 0x18, 0x58, 0x17, 0x60, 0x17, 0x58, 0x9E, 0xA0, 0x17, 0x60, 0x17, 0x60, 0x18, 0x68, 0x1B, 0x78, 0x18, 0x68, 0x17, 0x70, 0x1F, 0x90, 0x9E, 0xEC, 0x1B, 0x80, 0x1C, 0x98, 0x18, 0x78, 0x18, 0xAB,
+    0x1A, 0x90, 0x19, 0x90, 0x18, 0x80, 0x1F, 0xCB, 0x1B, 0x98, 0x16, 0x80, 0x16, 0x88, 0x3A, 0xA8, 0x16, 0x88, 0x14, 0x88, 0x14, 0x80, 0x15, 0x90, 0x34, 0x98, 0x12, 0x80, 0x12, 0x88, 0x32, 0x88, 0xB5, 0xB0, 0x10, 0x88, 0x11, 0x80, 0x10, 0x80, 0xB3, 0xB0, 0x30, 0x88, 0x30, 0x80, 0x4F, 0x88, 0x4F, 0x80, 0x90, 0x90, 0x4F, 0x88, 0x90, 0x88, 0x8F, 0x90, 0xB0, 0x98, 0x90, 0x98, 0xF0, 0xA0,
+    0x10, 0x18, 0x10, 0x20, 0x13, 0x20, 0x32, 0x28, 0x10, 0x28, 0x10, 0x20, 0x13, 0x28, 0x11, 0x28, 0x13, 0x30, 0x12, 0x30, 0x18, 0x20, 0x13, 0x28, 0x18, 0x30, 0x16, 0x30, 0x1F, 0x20, 0x14, 0x28, 0x14, 0x28, 0x1E, 0x30, 0x17, 0x30, 0x15, 0x30, 0x14, 0x30, 0x1E, 0x48, 0x3A, 0x40, 0xBA, 0x58, 0x18, 0x38, 0x1A, 0x40, 0x38, 0x50, 0x15, 0x40, 0x7F, 0x58, 0x14, 0x48, 0x3C, 0x70, 0x15, 0x50,
+    0x16, 0x50, 0x35, 0x50, 0xBE, 0x78, 0x9D, 0x88, 0x16, 0x58, 0x17, 0x60, 0x1F, 0x78, 0xBD, 0xD2, 0x19, 0x60, 0x17, 0x68, 0x3C, 0x90, 0xFF, 0xFF, 0x1D, 0x78, 0x7E, 0xA8, 0x1A, 0x88, 0x5F, 0xFF, 0x1D, 0xB8, 0x1A, 0x90, 0x18, 0x88, 0x19, 0x90, 0xFF, 0xFF, 0x3A, 0x98, 0x15, 0x80, 0x18, 0x98, 0xFF, 0xFF, 0x16, 0x90, 0x12, 0x80, 0x12, 0x80, 0x12, 0x80, 0x5A, 0xE0, 0x11, 0x78, 0x53, 0x90,
+    0x32, 0x90, 0x77, 0xB8, 0x10, 0x88, 0x0F, 0x78, 0x10, 0x80, 0x30, 0x88, 0x35, 0xC1, 0x4F, 0x80, 0x4F, 0x80, 0x90, 0x88, 0x6F, 0x88, 0xB1, 0x98, 0xB0, 0x90, 0xB0, 0x90, 0xB0, 0x98, 0xD0, 0xA0, 0x10, 0x20, 0x13, 0x20, 0x0F, 0x28, 0x11, 0x28, 0x11, 0x28, 0x53, 0x38, 0x37, 0x28, 0x11, 0x30, 0x11, 0x30, 0x13, 0x30, 0x12, 0x28, 0x9C, 0x48, 0x13, 0x30, 0x16, 0x30, 0x14, 0x28, 0x16, 0x28,
+    0x17, 0x28, 0x35, 0x40, 0x13, 0x30, 0x14, 0x30, 0xFB, 0x48, 0x14, 0x30, 0x17, 0x30, 0x18, 0x40, 0x15, 0x30, 0x1C, 0x60, 0x1B, 0x20, 0x9C, 0x58, 0x5E, 0x40, 0x1E, 0x60, 0x15, 0x50, 0x5A, 0x60, 0xBE, 0x49, 0x14, 0x50, 0x3F, 0xFE, 0x1A, 0x70, 0x15, 0x58, 0x16, 0x58, 0x3F, 0xA0, 0xFF, 0xFF, 0x19, 0x70, 0x17, 0x60, 0x1A, 0x78, 0xFF, 0xFF, 0x1C, 0x88, 0x1B, 0x80, 0x1A, 0x88, 0x5F, 0xB8,
+    0xFF, 0xFF, 0x19, 0x80, 0x19, 0x88, 0x17, 0x80, 0x3A, 0x98, 0x18, 0x90, 0x15, 0x88, 0x15, 0x80, 0x14, 0x80, 0x9C, 0xE0, 0x15, 0x90, 0x12, 0x78, 0x11, 0x70, 0x10, 0x78, 0x1C, 0xD8, 0x32, 0x88, 0x10, 0x80, 0x72, 0x90, 0x32, 0x90, 0x17, 0xC1, 0x0F, 0x78, 0x2F, 0x80, 0x4F, 0x80, 0xD3, 0xB8, 0x4E, 0x80, 0x6F, 0x80, 0x8F, 0x88, 0x6F, 0x80, 0x8F, 0x88, 0xD1, 0x98, 0x90, 0x90, 0xAF, 0x90,
+    0x0F, 0x20, 0x11, 0x20, 0x10, 0x20, 0x12, 0x20, 0x72, 0x38, 0x11, 0x28, 0x0F, 0x28, 0x10, 0x28, 0x13, 0x28, 0x33, 0x40, 0x10, 0x28, 0x11, 0x28, 0x11, 0x30, 0x33, 0x30, 0x16, 0x28, 0x12, 0x28, 0x13, 0x28, 0x75, 0x48, 0x12, 0x28, 0xBF, 0x62, 0x13, 0x28, 0x37, 0x38, 0x5B, 0x6C, 0x9E, 0xB9, 0x1A, 0x60, 0x1A, 0x30, 0x17, 0x38, 0x15, 0x40, 0x14, 0x50, 0x9D, 0x88, 0x14, 0x50, 0x14, 0x50,
+    0x18, 0x48, 0x13, 0x50, 0x3F, 0x98, 0x16, 0x60, 0x16, 0x50, 0x15, 0x58, 0x1B, 0x68, 0x7F, 0xFB, 0x17, 0x68, 0x17, 0x60, 0x19, 0x78, 0x99, 0x98, 0x18, 0x70, 0x17, 0x78, 0x37, 0x78, 0x17, 0x80, 0xFE, 0xE8, 0x16, 0x78, 0x16, 0x78, 0x14, 0x78, 0x36, 0x80, 0xFF, 0xF8, 0x14, 0x80, 0x15, 0x80, 0x13, 0x78, 0x11, 0x70, 0x5F, 0xE8, 0x12, 0x80, 0x10, 0x70, 0x0F, 0x68, 0x31, 0x88, 0x15, 0xA8,
+    0x10, 0x78, 0x0F, 0x70, 0x0F, 0x78, 0x30, 0x88, 0xD7, 0xC8, 0x4E, 0x78, 0x4F, 0x78, 0x4E, 0x78, 0x2E, 0x78, 0x55, 0xD1, 0x4E, 0x80, 0x8F, 0x88, 0x90, 0x88, 0x6F, 0x88, 0x90, 0x90, 0xAF, 0x90, 0x12, 0x18, 0x10, 0x28, 0x0F, 0x28, 0x0F, 0x28, 0x11, 0x30, 0x0F, 0x28, 0x10, 0x20, 0x11, 0x28, 0x12, 0x28, 0x76, 0x48, 0x0F, 0x20, 0x17, 0x30, 0x10, 0x30, 0x12, 0x28, 0x77, 0x48, 0x13, 0x28,
+    0x11, 0x28, 0x32, 0x30, 0x1B, 0x28, 0x12, 0x30, 0x12, 0x30, 0x18, 0x28, 0x18, 0x20, 0x16, 0x38, 0x15, 0x30, 0x14, 0x38, 0x9B, 0x50, 0x13, 0x40, 0x3E, 0x58, 0x14, 0x48, 0x18, 0x48, 0x14, 0x50, 0x14, 0x48, 0x95, 0x70, 0xBE, 0xC1, 0x18, 0x70, 0x13, 0x50, 0x14, 0x50, 0x14, 0x58, 0x1B, 0x88, 0x16, 0x68, 0x15, 0x58, 0x18, 0x78, 0xBE, 0xB0, 0x1E, 0xD0, 0x17, 0x78, 0x14, 0x68, 0x18, 0x98,
+    0x9C, 0xDB, 0x5F, 0xFA, 0x99, 0x90, 0x1A, 0xC1, 0x3F, 0xEB, 0x13, 0x78, 0x1D, 0xE8, 0xDD, 0xD9, 0x13, 0x80, 0x11, 0x68, 0x11, 0x78, 0x9D, 0xE8, 0x73, 0x98, 0xB3, 0x98, 0xF0, 0xA0, 0x0F, 0x70, 0x18, 0xC0, 0x0E, 0x70, 0x0D, 0x70, 0x0C, 0x70, 0x0F, 0x80, 0xF6, 0xB0, 0xB3, 0xB8, 0x6E, 0x78, 0x4D, 0x78, 0x2D, 0x70, 0x13, 0xA9, 0x12, 0xC1, 0x8F, 0x80, 0xB0, 0x90, 0xB0, 0x90, 0xF0, 0x90,
+    0x0F, 0x20, 0x0E, 0x20, 0x96, 0x48, 0x31, 0x38, 0x0E, 0x20, 0x38, 0x30, 0x10, 0x28, 0x0F, 0x28, 0x13, 0x40, 0x35, 0x30, 0x14, 0x28, 0x0F, 0x28, 0x0F, 0x28, 0x15, 0x40, 0x11, 0x28, 0x0F, 0x28, 0x0F, 0x28, 0x11, 0x30, 0x78, 0x68, 0x11, 0x30, 0x12, 0x30, 0x13, 0x30, 0x12, 0x38, 0x14, 0x48, 0x1F, 0x38, 0x11, 0x38, 0x14, 0x40, 0x13, 0x38, 0x12, 0x38, 0x13, 0x40, 0x3A, 0x60, 0x15, 0x50,
+    0x13, 0x48, 0x10, 0x40, 0x5E, 0x80, 0x36, 0x58, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x15, 0x58, 0x35, 0x60, 0x13, 0x50, 0x1A, 0x78, 0x1E, 0xB2, 0x5C, 0x80, 0x14, 0x68, 0x16, 0x78, 0x16, 0x60, 0x7A, 0x88, 0x14, 0x68, 0x13, 0x68, 0x13, 0x68, 0x18, 0x98, 0x14, 0x78, 0x12, 0x60, 0x32, 0x70, 0x36, 0x90, 0x55, 0x90, 0x10, 0x68, 0x0F, 0x60, 0x0F, 0x68, 0x0E, 0x68, 0x0D, 0x58, 0x0F, 0x68,
+    0x30, 0x78, 0xD3, 0xA0, 0x2F, 0x78, 0x0D, 0x68, 0x2E, 0x70, 0xD1, 0x90, 0x4E, 0x78, 0x4E, 0x70, 0x4E, 0x70, 0x6E, 0x78, 0x6E, 0x78, 0x8F, 0x88, 0x6F, 0x80, 0x6E, 0x80, 0x8F, 0x88, 0xAE, 0x88, 0x0D, 0x20, 0x0D, 0x20, 0x0F, 0x28, 0x57, 0x38, 0x0F, 0x28, 0x10, 0x28, 0x2F, 0x30, 0x0E, 0x28, 0x38, 0x38, 0x10, 0x28, 0x0F, 0x20, 0x10, 0x30, 0x17, 0x40, 0x0F, 0x28, 0x0F, 0x30, 0x0F, 0x28,
+    0x16, 0x28, 0x10, 0x38, 0x0F, 0x28, 0x17, 0x30, 0x10, 0x28, 0x18, 0x48, 0x11, 0x30, 0x57, 0x40, 0x12, 0x30, 0xBE, 0x92, 0x11, 0x38, 0x3E, 0x48, 0x13, 0x40, 0x15, 0x48, 0x11, 0x40, 0x14, 0x48, 0x16, 0x50, 0x30, 0x50, 0x5D, 0x88, 0x56, 0x68, 0x11, 0x48, 0x11, 0x48, 0x12, 0x48, 0x16, 0x60, 0x34, 0x60, 0x12, 0x48, 0x35, 0x60, 0x18, 0x58, 0x13, 0x58, 0x14, 0x60, 0x15, 0x70, 0x13, 0x58,
+    0x3B, 0x88, 0x12, 0x60, 0x14, 0x70, 0x10, 0x58, 0x13, 0x78, 0x10, 0x58, 0x34, 0x80, 0x11, 0x68, 0x31, 0x70, 0x9A, 0xB0, 0x53, 0x80, 0x0E, 0x60, 0x0D, 0x58, 0x0C, 0x58, 0xD4, 0x98, 0x2E, 0x68, 0x2E, 0x68, 0x2F, 0x78, 0x73, 0xA0, 0x0D, 0x60, 0x2E, 0x68, 0x2D, 0x68, 0xF1, 0x88, 0xF2, 0xA8, 0x4D, 0x70, 0x2D, 0x70, 0x6E, 0x78, 0x6E, 0x78, 0xB0, 0x88, 0x6F, 0x80, 0x4E, 0x80, 0xCF, 0x88,
+    0x0E, 0x20, 0x33, 0x28, 0x33, 0x30, 0x0E, 0x20, 0x0E, 0x20, 0x0D, 0x28, 0x38, 0x38, 0x33, 0x30, 0x0F, 0x28, 0x0E, 0x20, 0x0E, 0x20, 0x17, 0x40, 0x0E, 0x28, 0x0F, 0x30, 0x0E, 0x28, 0x17, 0x30, 0x10, 0x28, 0x0F, 0x28, 0x37, 0x38, 0x10, 0x30, 0x59, 0x58, 0x0F, 0x30, 0x11, 0x30, 0x33, 0x40, 0x10, 0x30, 0x18, 0x50, 0x10, 0x38, 0x36, 0x48, 0x10, 0x38, 0x10, 0x38, 0x10, 0x40, 0x11, 0x40,
+    0x12, 0x40, 0x0F, 0x48, 0x15, 0x58, 0x34, 0x60, 0x11, 0x48, 0x10, 0x40, 0x33, 0x58, 0x16, 0x50, 0x54, 0x60, 0x11, 0x48, 0x13, 0x58, 0x16, 0x58, 0x12, 0x50, 0x12, 0x58, 0x11, 0x50, 0x11, 0x58, 0x13, 0x60, 0x12, 0x68, 0x11, 0x60, 0x10, 0x58, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x68, 0x30, 0x68, 0x0E, 0x58, 0x10, 0x70, 0x0E, 0x60, 0x0D, 0x50, 0x0C, 0x50, 0x0D, 0x58, 0x2E, 0x68,
+    0x4E, 0x68, 0x4E, 0x68, 0x0D, 0x68, 0x0D, 0x60, 0x0D, 0x60, 0x0D, 0x60, 0x2D, 0x68, 0x2D, 0x68, 0x4E, 0x70, 0x2D, 0x68, 0x4E, 0x70, 0x4E, 0x78, 0x8F, 0x80, 0x8F, 0x80, 0x90, 0x88, 0x6E, 0x80, 0x0D, 0x20, 0x0E, 0x28, 0x0D, 0x20, 0x0D, 0x20, 0x0D, 0x20, 0x0E, 0x20, 0x10, 0x28, 0x2E, 0x30, 0x0D, 0x28, 0x0E, 0x28, 0x75, 0x38, 0x0E, 0x28, 0x0D, 0x20, 0x0F, 0x30, 0x19, 0x38, 0x0F, 0x28,
+    0x30, 0x30, 0x0F, 0x30, 0x75, 0x48, 0x38, 0x50, 0x0E, 0x28, 0x19, 0x30, 0x10, 0x30, 0x10, 0x38, 0x17, 0x60, 0x11, 0x38, 0x11, 0x38, 0x10, 0x30, 0x15, 0x40, 0x18, 0x68, 0x10, 0x38, 0x10, 0x40, 0x10, 0x38, 0x10, 0x48, 0x1B, 0x80, 0x33, 0x58, 0x10, 0x48, 0x10, 0x40, 0x33, 0x58, 0x3C, 0x88, 0x53, 0x60, 0x10, 0x48, 0x13, 0x58, 0x17, 0x70, 0x11, 0x50, 0x10, 0x50, 0x11, 0x58, 0x16, 0x78,
+    0x14, 0x60, 0x31, 0x60, 0x10, 0x58, 0x15, 0x80, 0x37, 0x99, 0x1B, 0xA8, 0x0F, 0x58, 0x0F, 0x58, 0x0E, 0x58, 0x0E, 0x58, 0x5A, 0xB0, 0x0E, 0x58, 0xF1, 0x80, 0x0C, 0x50, 0x0C, 0x50, 0x30, 0x88, 0x0C, 0x60, 0x0C, 0x60, 0x2D, 0x60, 0x0C, 0x60, 0x0D, 0x70, 0x0C, 0x60, 0x2D, 0x60, 0x2D, 0x60, 0x2D, 0x68, 0x4E, 0x78, 0x4E, 0x70, 0x6E, 0x70, 0x6E, 0x78, 0x8F, 0x80, 0x6F, 0x80, 0xAF, 0x88,
+    0x0F, 0x20, 0x2E, 0x28, 0x0D, 0x20, 0x0D, 0x28, 0x0E, 0x20, 0x58, 0x30, 0x2E, 0x30, 0x0D, 0x30, 0x0D, 0x28, 0x18, 0x30, 0x0D, 0x20, 0x0D, 0x28, 0x0D, 0x20, 0x15, 0x30, 0x0E, 0x28, 0x0E, 0x30, 0x0F, 0x28, 0x34, 0x40, 0x11, 0x38, 0x0F, 0x30, 0x12, 0x20, 0x0F, 0x30, 0x59, 0x50, 0x10, 0x30, 0x1B, 0x38, 0x10, 0x38, 0x12, 0x40, 0x10, 0x30, 0x10, 0x38, 0x10, 0x38, 0x72, 0x50, 0x10, 0x40,
+    0x0F, 0x38, 0x11, 0x50, 0x37, 0x70, 0xBE, 0xBA, 0x10, 0x48, 0x0F, 0x38, 0x10, 0x40, 0x5B, 0x78, 0x11, 0x58, 0x10, 0x48, 0x53, 0x68, 0xD9, 0x88, 0x3F, 0xB8, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x77, 0xA9, 0x5E, 0xC0, 0x11, 0x60, 0x0F, 0x58, 0x10, 0x60, 0x54, 0x80, 0x7A, 0xC0, 0x50, 0x78, 0x74, 0x99, 0x0E, 0x60, 0xF1, 0x90, 0x18, 0xB0, 0x0C, 0x50, 0x0C, 0x50, 0x0B, 0x50, 0x2D, 0x68,
+    0x15, 0xA8, 0x0B, 0x68, 0x0C, 0x60, 0x0C, 0x58, 0x4C, 0x68, 0x94, 0xA8, 0xD0, 0x88, 0x2D, 0x60, 0x2D, 0x60, 0x4D, 0x68, 0xD2, 0xA0, 0x13, 0xB1, 0x6E, 0x70, 0x4D, 0x70, 0x8F, 0x80, 0xAE, 0x80, 0x2E, 0x28, 0x0C, 0x20, 0x0C, 0x20, 0x75, 0x50, 0x34, 0x30, 0x2D, 0x28, 0x4D, 0x30, 0x0D, 0x28, 0x35, 0x50, 0x0E, 0x28, 0x0C, 0x20, 0x0D, 0x28, 0x34, 0x40, 0x55, 0x50, 0x0D, 0x20, 0x0F, 0x28,
+    0x19, 0x28, 0x95, 0x50, 0x77, 0x60, 0x10, 0x30, 0x12, 0x30, 0x18, 0x48, 0x0F, 0x30, 0x12, 0x38, 0x11, 0x28, 0x11, 0x38, 0x11, 0x30, 0x39, 0x40, 0x10, 0x38, 0x10, 0x38, 0x37, 0x68, 0x34, 0x48, 0x0F, 0x38, 0x10, 0x48, 0x38, 0x70, 0x31, 0x58, 0x0F, 0x40, 0x0E, 0x38, 0x0F, 0x40, 0x9C, 0x98, 0x10, 0x50, 0x0F, 0x40, 0x31, 0x58, 0x19, 0x80, 0x12, 0x60, 0x10, 0x50, 0x0F, 0x50, 0x0F, 0x50,
+    0x0F, 0x50, 0x11, 0x60, 0x10, 0x58, 0x0E, 0x58, 0xD5, 0x88, 0x0D, 0x50, 0x53, 0x78, 0x0D, 0x50, 0x0D, 0x50, 0x0C, 0x50, 0x2E, 0x60, 0x0C, 0x50, 0x0C, 0x50, 0x0C, 0x50, 0x0B, 0x50, 0x0C, 0x58, 0x0B, 0x50, 0x0D, 0x68, 0x0B, 0x58, 0x2B, 0x58, 0x2C, 0x60, 0x0B, 0x58, 0x0C, 0x60, 0x2C, 0x60, 0x4D, 0x60, 0x2D, 0x68, 0x4D, 0x68, 0x4D, 0x68, 0x6E, 0x70, 0x6D, 0x70, 0x6E, 0x78, 0xAD, 0x78,
+    0x0C, 0x20, 0x0C, 0x20, 0x31, 0x30, 0x0C, 0x20, 0x2C, 0x28, 0x2C, 0x28, 0x0D, 0x20, 0x71, 0x38, 0x0D, 0x28, 0x0C, 0x20, 0x0D, 0x28, 0x34, 0x38, 0x2E, 0x30, 0x0D, 0x28, 0x0D, 0x20, 0xDD, 0x51, 0x14, 0x40, 0x0E, 0x38, 0x0D, 0x28, 0x10, 0x18, 0x17, 0x30, 0x53, 0x38, 0x10, 0x38, 0x14, 0x40, 0x0F, 0x30, 0x59, 0x60, 0x33, 0x40, 0x17, 0x40, 0x0F, 0x38, 0x10, 0x40, 0x11, 0x48, 0x33, 0x48,
+    0x0E, 0x38, 0x0E, 0x40, 0x17, 0x68, 0x30, 0x58, 0x0E, 0x40, 0x0F, 0x40, 0x0E, 0x40, 0x15, 0x68, 0x10, 0x50, 0x0E, 0x40, 0x0E, 0x48, 0x16, 0x70, 0x31, 0x60, 0x10, 0x58, 0x0E, 0x48, 0x11, 0x58, 0x17, 0x88, 0x0E, 0x50, 0x0E, 0x50, 0x0D, 0x48, 0x10, 0x60, 0x0D, 0x50, 0x0D, 0x50, 0x0D, 0x50, 0x0C, 0x50, 0x35, 0x90, 0x0C, 0x50, 0x0C, 0x50, 0x0B, 0x50, 0x0B, 0x48, 0x73, 0x90, 0x0C, 0x58,
+    0x0B, 0x50, 0x0B, 0x50, 0xB2, 0x90, 0x2B, 0x58, 0x2B, 0x58, 0x0B, 0x58, 0x0B, 0x58, 0xF1, 0x98, 0x2C, 0x60, 0x4D, 0x68, 0x4D, 0x68, 0x4D, 0x68, 0x4E, 0x68, 0x6E, 0x78, 0x6E, 0x70, 0xCE, 0x78, 0x0B, 0x20, 0x0C, 0x20, 0x0B, 0x20, 0x0C, 0x20, 0x0B, 0x20, 0x0C, 0x28, 0xD7, 0x48, 0x2D, 0x28, 0x0C, 0x20, 0x0C, 0x18, 0x0D, 0x28, 0x2F, 0x30, 0x2E, 0x30, 0x0D, 0x20, 0x0E, 0x28, 0x0E, 0x28,
+    0x51, 0x40, 0x0D, 0x28, 0x0E, 0x30, 0x0F, 0x28, 0x0E, 0x28, 0x0F, 0x28, 0x0F, 0x28, 0x10, 0x30, 0x0F, 0x30, 0x0F, 0x30, 0x12, 0x30, 0x0F, 0x30, 0x0F, 0x38, 0xD5, 0x50, 0x0F, 0x38, 0x0E, 0x38, 0x0D, 0x38, 0x0E, 0x40, 0xB5, 0x60, 0x0E, 0x40, 0x0D, 0x40, 0x0E, 0x40, 0x0F, 0x48, 0x10, 0x48, 0x0F, 0x50, 0x0E, 0x40, 0x0F, 0x50, 0x53, 0x68, 0x0D, 0x40, 0x0E, 0x50, 0x2F, 0x58, 0x54, 0x70,
+    0x0E, 0x50, 0x0E, 0x50, 0x0E, 0x50, 0x53, 0x78, 0x2F, 0x68, 0x11, 0x68, 0x0C, 0x50, 0x0F, 0x60, 0x0C, 0x48, 0x0C, 0x48, 0xDA, 0xC9, 0x2F, 0x70, 0x0B, 0x50, 0x0B, 0x48, 0x0B, 0x50, 0x13, 0x99, 0x0B, 0x50, 0x0B, 0x50, 0x0B, 0x50, 0x0A, 0x50, 0xF0, 0x88, 0x2A, 0x58, 0x2B, 0x58, 0x0B, 0x58, 0xF1, 0x90, 0x4D, 0x70, 0x4D, 0x60, 0x4D, 0x60, 0x4D, 0x68, 0x6E, 0x70, 0x8F, 0x78, 0xAE, 0x78,
+    0x33, 0x38, 0x0C, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x91, 0x38, 0x34, 0x40, 0x0C, 0x20, 0x2D, 0x28, 0x0B, 0x20, 0x0E, 0x20, 0x34, 0x40, 0x0D, 0x30, 0x2D, 0x28, 0x0D, 0x28, 0x35, 0x40, 0x0E, 0x28, 0x0D, 0x20, 0x0D, 0x28, 0x12, 0x30, 0x36, 0x50, 0x0E, 0x28, 0x11, 0x28, 0x17, 0x48, 0x11, 0x28, 0x35, 0x58, 0x12, 0x28, 0x16, 0x40, 0x10, 0x30, 0x0E, 0x30, 0x16, 0x60, 0x0F, 0x40, 0x0D, 0x38,
+    0x0D, 0x38, 0x0D, 0x40, 0x38, 0x70, 0x2E, 0x48, 0x0E, 0x38, 0x0D, 0x38, 0x0D, 0x38, 0x58, 0x78, 0x0F, 0x50, 0x0D, 0x40, 0x4F, 0x50, 0x0D, 0x48, 0x0D, 0x48, 0x0D, 0x40, 0x0D, 0x40, 0x0D, 0x48, 0x0D, 0x48, 0x0D, 0x50, 0x0D, 0x50, 0x0C, 0x48, 0x2D, 0x50, 0x0D, 0x50, 0x0B, 0x48, 0x0C, 0x50, 0x0C, 0x50, 0x0B, 0x40, 0x51, 0x78, 0x0B, 0x50, 0x0B, 0x48, 0x0A, 0x48, 0x0B, 0x48, 0x2C, 0x60,
+    0x0B, 0x50, 0x0B, 0x50, 0x0B, 0x50, 0x2A, 0x48, 0x0A, 0x58, 0x2A, 0x50, 0x4B, 0x58, 0x4B, 0x58, 0x4C, 0x58, 0x4C, 0x58, 0x2C, 0x58, 0x4C, 0x60, 0x6D, 0x68, 0x8E, 0x70, 0x6D, 0x70, 0xAE, 0x78, 0x0B, 0x20, 0x0C, 0x28, 0x0B, 0x28, 0x0B, 0x20, 0x0F, 0x18, 0x0C, 0x20, 0x0C, 0x20, 0x4D, 0x38, 0x12, 0x28, 0x4D, 0x30, 0x0C, 0x20, 0x2D, 0x28, 0x2D, 0x30, 0xB4, 0x40, 0x0E, 0x28, 0x0D, 0x28,
+    0x53, 0x59, 0x13, 0x38, 0x0F, 0x30, 0x0F, 0x28, 0x0F, 0x28, 0x9A, 0x40, 0x32, 0x20, 0x13, 0x20, 0x0F, 0x28, 0x36, 0x30, 0x15, 0x48, 0x11, 0x28, 0x0F, 0x38, 0x0F, 0x30, 0x51, 0x50, 0x0D, 0x38, 0x0D, 0x38, 0x0D, 0x38, 0x15, 0x60, 0x0C, 0x40, 0x0C, 0x38, 0x0D, 0x40, 0x2E, 0x38, 0x56, 0x68, 0x0E, 0x50, 0x0C, 0x38, 0x0D, 0x48, 0xFA, 0x90, 0x18, 0x90, 0x0C, 0x48, 0x0C, 0x40, 0x0C, 0x48,
+    0x0F, 0x48, 0x38, 0x98, 0x0C, 0x48, 0x0D, 0x48, 0x11, 0x60, 0x50, 0x68, 0x58, 0xB0, 0x0C, 0x50, 0x51, 0x70, 0x0B, 0x48, 0x4C, 0x60, 0x15, 0x98, 0x0B, 0x48, 0x0B, 0x50, 0x0A, 0x48, 0x2B, 0x48, 0x75, 0x98, 0x52, 0x99, 0x0A, 0x48, 0x09, 0x48, 0x09, 0x48, 0xB3, 0xA0, 0x09, 0x50, 0x2A, 0x50, 0x4B, 0x58, 0x0A, 0x50, 0xD1, 0x98, 0x4E, 0x80, 0x4D, 0x68, 0x2C, 0x60, 0x4C, 0x68, 0xAD, 0x70,
+    0x0C, 0x20, 0x4C, 0x28, 0x2C, 0x28, 0x53, 0x48, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0C, 0x28, 0x13, 0x48, 0x0B, 0x20, 0x0C, 0x20, 0x0C, 0x20, 0x0C, 0x20, 0x74, 0x50, 0x0D, 0x20, 0x0D, 0x28, 0x0E, 0x28, 0x0D, 0x28, 0x55, 0x58, 0x0F, 0x20, 0x10, 0x20, 0x32, 0x20, 0x12, 0x20, 0x13, 0x28, 0x10, 0x30, 0x13, 0x30, 0x13, 0x28, 0x11, 0x28, 0x0E, 0x30, 0x0F, 0x38, 0x0E, 0x40, 0x0C, 0x30,
+    0x0C, 0x30, 0x0D, 0x40, 0x11, 0x40, 0x0D, 0x40, 0x0C, 0x38, 0x0C, 0x38, 0x0D, 0x38, 0x19, 0x88, 0x0D, 0x48, 0x0D, 0x38, 0x0D, 0x40, 0x0E, 0x48, 0x38, 0x98, 0x0C, 0x40, 0x0C, 0x40, 0x0C, 0x40, 0x54, 0x78, 0x95, 0x88, 0x0C, 0x48, 0x0B, 0x40, 0x0E, 0x60, 0x0B, 0x48, 0x2B, 0x48, 0x0B, 0x48, 0x4D, 0x60, 0x73, 0x88, 0x0B, 0x48, 0x0B, 0x50, 0x0A, 0x48, 0x0A, 0x48, 0x0C, 0x58, 0x09, 0x48,
+    0x0A, 0x48, 0x2A, 0x50, 0xD0, 0x88, 0xB2, 0x91, 0x09, 0x48, 0x29, 0x48, 0x0A, 0x50, 0xAE, 0x78, 0x4A, 0x58, 0x2A, 0x58, 0x4B, 0x58, 0x4C, 0x60, 0x8D, 0x68, 0x4D, 0x68, 0x6D, 0x68, 0x8C, 0x70, 0x0B, 0x20, 0x0B, 0x20, 0x0E, 0x18, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x2B, 0x20, 0x0D, 0x28, 0x0B, 0x20, 0x0C, 0x20, 0x0B, 0x20, 0x11, 0x38, 0x0C, 0x28, 0x0D, 0x20, 0x0C, 0x20, 0x0D, 0x28,
+    0x53, 0x48, 0x0D, 0x20, 0x10, 0x18, 0x11, 0x20, 0x12, 0x20, 0x11, 0x28, 0x14, 0x20, 0x11, 0x20, 0x0F, 0x28, 0x33, 0x48, 0x12, 0x28, 0x10, 0x30, 0x0E, 0x38, 0x0E, 0x30, 0x0C, 0x38, 0x0C, 0x38, 0x0C, 0x38, 0x0C, 0x38, 0x35, 0x68, 0x0C, 0x40, 0x0C, 0x38, 0x0D, 0x38, 0x0C, 0x38, 0xD5, 0x70, 0x0D, 0x48, 0x0C, 0x38, 0x0D, 0x40, 0x0C, 0x38, 0x0C, 0x40, 0x0C, 0x40, 0x0C, 0x40, 0x0C, 0x40,
+    0x52, 0x68, 0x0C, 0x48, 0x0D, 0x50, 0x0B, 0x40, 0x2D, 0x58, 0x0B, 0x48, 0x0B, 0x40, 0x0A, 0x48, 0x0B, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x40, 0x0A, 0x48, 0x09, 0x40, 0x0A, 0x48, 0x09, 0x48, 0x29, 0x48, 0x09, 0x48, 0x2A, 0x50, 0x2A, 0x48, 0x29, 0x48, 0x08, 0x48, 0x49, 0x50, 0x29, 0x50, 0x2A, 0x50, 0x2A, 0x58, 0x4B, 0x58, 0x6C, 0x60, 0x4D, 0x60, 0x6C, 0x68, 0x6C, 0x68,
+    0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0A, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0C, 0x20, 0x52, 0x30, 0x0C, 0x20, 0x0C, 0x20, 0x0C, 0x28, 0x0C, 0x20, 0x0E, 0x20, 0x0D, 0x28, 0x0D, 0x20, 0x0F, 0x18, 0x10, 0x20, 0x12, 0x20, 0x12, 0x20, 0x15, 0x20, 0x15, 0x18, 0x12, 0x28, 0x13, 0x30, 0x38, 0x20, 0x13, 0x28, 0x10, 0x30, 0x98, 0x58, 0x0E, 0x38, 0x0D, 0x38,
+    0x0E, 0x38, 0x0D, 0x40, 0x1A, 0x70, 0x2D, 0x40, 0x0C, 0x38, 0x0C, 0x38, 0x0C, 0x38, 0x34, 0x68, 0x0C, 0x40, 0x0C, 0x38, 0x0C, 0x38, 0x0C, 0x38, 0x52, 0x68, 0x0C, 0x40, 0x0B, 0x38, 0x0C, 0x40, 0x0F, 0x58, 0x0C, 0x48, 0x0B, 0x40, 0x0B, 0x40, 0x2C, 0x50, 0x55, 0x90, 0x0B, 0x40, 0x0A, 0x48, 0x0A, 0x40, 0x0A, 0x48, 0xD4, 0x98, 0x09, 0x40, 0x0A, 0x48, 0x09, 0x48, 0x09, 0x40, 0xD1, 0x88,
+    0x09, 0x48, 0x09, 0x48, 0x09, 0x48, 0x2A, 0x50, 0x10, 0x89, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x8D, 0x68, 0xF0, 0x88, 0x29, 0x50, 0x6B, 0x58, 0x4B, 0x58, 0x4C, 0x60, 0x6D, 0x68, 0xAD, 0x70, 0x55, 0x38, 0x0B, 0x20, 0x0B, 0x20, 0x2C, 0x28, 0x0B, 0x20, 0x32, 0x38, 0x0B, 0x20, 0x0B, 0x28, 0x0B, 0x20, 0x0B, 0x28, 0x52, 0x40, 0x0C, 0x28, 0x0C, 0x20, 0x2D, 0x28, 0x11, 0x30, 0x0F, 0x20,
+    0x4E, 0x30, 0x11, 0x18, 0x14, 0x10, 0x14, 0x18, 0x12, 0x20, 0x15, 0x10, 0x19, 0x00, 0x1A, 0x08, 0x37, 0x50, 0x37, 0x20, 0x1C, 0x08, 0x16, 0x28, 0x32, 0x30, 0x36, 0x58, 0x0F, 0x38, 0x10, 0x38, 0x11, 0x40, 0x0E, 0x40, 0x12, 0x58, 0x0D, 0x40, 0x0C, 0x38, 0x0C, 0x30, 0x0C, 0x38, 0x10, 0x50, 0x0C, 0x40, 0x0C, 0x38, 0x0B, 0x38, 0x0C, 0x40, 0x0B, 0x40, 0x0B, 0x38, 0x0B, 0x40, 0x0B, 0x40,
+    0x0B, 0x40, 0x2C, 0x48, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x48, 0x0B, 0x48, 0x0A, 0x40, 0x0A, 0x40, 0x0A, 0x40, 0x2A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x40, 0x09, 0x48, 0x09, 0x40, 0x2A, 0x48, 0x09, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x29, 0x48, 0x09, 0x48, 0x08, 0x48, 0x49, 0x48, 0x08, 0x40, 0x49, 0x50, 0x08, 0x48, 0x4A, 0x58, 0x6B, 0x58, 0x4B, 0x58, 0x6C, 0x60, 0x8C, 0x68,
+    0x0C, 0x20, 0x0B, 0x18, 0x0B, 0x18, 0x0B, 0x20, 0x0B, 0x20, 0x0A, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0A, 0x18, 0x0C, 0x20, 0x0B, 0x20, 0x0C, 0x20, 0x0C, 0x20, 0x0D, 0x20, 0x0E, 0x28, 0x0E, 0x20, 0x2E, 0x20, 0x13, 0x10, 0x13, 0x18, 0x16, 0x18, 0x34, 0x20, 0x18, 0x10, 0x1C, 0x00, 0x1B, 0x00, 0x38, 0x20, 0x14, 0x20, 0x1C, 0x10, 0x36, 0x28, 0x11, 0x28, 0x14, 0x40, 0x0F, 0x38, 0x0F, 0x38,
+    0x10, 0x40, 0x30, 0x50, 0x54, 0x68, 0x0D, 0x40, 0x0C, 0x38, 0x0D, 0x38, 0x0B, 0x30, 0xB4, 0x78, 0x0B, 0x40, 0x0B, 0x38, 0x0B, 0x38, 0x97, 0x91, 0x15, 0x80, 0x0B, 0x40, 0x0A, 0x38, 0x0A, 0x40, 0x0C, 0x50, 0x19, 0xA9, 0x0B, 0x40, 0x0A, 0x40, 0x0A, 0x40, 0x0A, 0x40, 0x55, 0x98, 0x73, 0x81, 0x09, 0x40, 0x0A, 0x48, 0x4A, 0x50, 0x76, 0x90, 0xAD, 0x68, 0x29, 0x48, 0x09, 0x40, 0x09, 0x40,
+    0x53, 0x90, 0x8C, 0x68, 0x08, 0x50, 0x08, 0x48, 0x08, 0x48, 0xD2, 0x98, 0x6A, 0x50, 0x49, 0x48, 0x28, 0x40, 0x29, 0x48, 0xB0, 0x90, 0x4A, 0x60, 0x6A, 0x58, 0x6B, 0x60, 0x4A, 0x58, 0x8C, 0x68, 0x0C, 0x18, 0x0C, 0x18, 0x0C, 0x20, 0x32, 0x40, 0x4C, 0x28, 0x0A, 0x18, 0x0B, 0x20, 0x2B, 0x28, 0x53, 0x50, 0x0C, 0x20, 0x0B, 0x20, 0x2C, 0x20, 0x0C, 0x20, 0x93, 0x50, 0x0F, 0x20, 0x12, 0x20,
+    0x0E, 0x20, 0x11, 0x18, 0x55, 0x58, 0x15, 0x08, 0x12, 0x20, 0x38, 0x10, 0x1B, 0x00, 0x1E, 0x00, 0x17, 0x10, 0x13, 0x18, 0x1C, 0x18, 0x16, 0x28, 0x10, 0x28, 0x13, 0x40, 0x0F, 0x38, 0x0F, 0x40, 0x10, 0x40, 0x0E, 0x40, 0x0F, 0x40, 0x0C, 0x38, 0x0B, 0x38, 0x0C, 0x38, 0x0C, 0x38, 0x35, 0x78, 0x0B, 0x38, 0x0B, 0x38, 0x0B, 0x38, 0x0B, 0x38, 0x56, 0x80, 0x0B, 0x40, 0x0A, 0x38, 0x0B, 0x40,
+    0x0A, 0x40, 0x17, 0xA1, 0x2B, 0x48, 0x0A, 0x40, 0x0A, 0x40, 0x0A, 0x38, 0x2A, 0x40, 0x0A, 0x40, 0x09, 0x40, 0x29, 0x40, 0x09, 0x40, 0x2A, 0x48, 0x09, 0x40, 0x08, 0x38, 0x29, 0x40, 0x09, 0x40, 0x29, 0x48, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x29, 0x48, 0x49, 0x48, 0x69, 0x48, 0x28, 0x48, 0x28, 0x48, 0x08, 0x40, 0x49, 0x50, 0x69, 0x58, 0x49, 0x58, 0x6A, 0x58, 0x6B, 0x60,
 };
 const lv_img_dsc_t ui_img_arrows_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_arrows_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_arrows_80_png_data
 };
 
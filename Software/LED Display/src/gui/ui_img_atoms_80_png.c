@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Atoms_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_atoms_80_png_data[] = {
-    0x06, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x69, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x2A, 0x03, 0xFF, 0xDC, 0x27, 0xFF, 0xAB, 0x03, 0xFF, 0xAC, 0x0B, 0xFF, 0x30, 0x05, 0xFF, 0x0F, 0x05, 0xFF, 0x8C, 0x0B, 0xFF, 0x0E, 0x14, 0xFF, 0x6C, 0x0B, 0xFF, 0xAD, 0x13, 0xFF, 0x4C, 0x03, 0xFF, 0x4C, 0x03, 0xFF, 0xCE, 0x13, 0xFF, 0x30, 0x14, 0xFF, 0x10, 0x0C, 0xFF, 0x8D, 0x0B, 0xFF, 0x30, 0x0C, 0xFF, 0xCE, 0x13, 0xFF, 0x6C, 0x0B, 0xFF, 0xAD, 0x03, 0xFF, 0x8D, 0x0B, 0xFF, 0x8C, 0x03, 0xFF, 0x2E, 0x04, 0xFF, 0xCD, 0x03, 0xFF, 0x8D, 0x03, 0xFF, 0x2C, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x8D, 0x13, 0xFF, 0xEA, 0x02, 0xFF, 0x2C, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0xBE, 0x07, 0xFF, 0x2C, 0x03, 0xFF, 0xAA, 0x02, 0xFF, 0xFF, 0xAF, 0xFF, 0xCA, 0x02, 0xFF, 0x54, 0x05, 0xFF, 0x4C, 0x03, 0xFF, 0xCA, 0x02, 0xFF,
-    0x8C, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0x0B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0x8C, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0xED, 0x13, 0xFF, 0x4B, 0x03, 0xFF, 0x0A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x6B, 0x0B, 0xFF, 0xC9, 0x0A, 0xFF, 0x47, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0xAB, 0x0B, 0xFF, 0x27, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x93, 0x15, 0xFF, 0x47, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xEA, 0x0A, 0xFF, 0x47, 0x02, 0xFF, 0x2D, 0x0C, 0xFF, 0xC9, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x2A, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x6E, 0x0C, 0xFF, 0x2A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0x26, 0x02, 0xFF, 0x0C, 0x0C, 0xFF, 0xAC, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0xCD, 0x03, 0xFF, 0x8F, 0x14, 0xFF, 0x8F, 0x0C, 0xFF, 0x4D, 0x0B, 0xFF, 0x30, 0x1C, 0xFF, 0x75, 0x15, 0xFF, 0xB2, 0x0C, 0xFF, 0xCD, 0x03, 0xFF, 0xF5, 0x55, 0xFF, 0x2F, 0x14, 0xFF, 0xCE, 0x0B, 0xFF, 0x70, 0x0C, 0xFF, 0x8F, 0x14, 0xFF, 0x4E, 0x0C, 0xFF, 0x90, 0x04, 0xFF, 0xD1, 0x1C, 0xFF, 0xAD, 0x0B, 0xFF, 0xAD, 0x0B, 0xFF, 0x6F, 0x1C, 0xFF, 0x6C, 0x0B, 0xFF,
-    0x0B, 0x03, 0xFF, 0x2C, 0x03, 0xFF, 0x6C, 0x03, 0xFF, 0x53, 0x1D, 0xFF, 0xCA, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0x6C, 0x0B, 0xFF, 0x4B, 0x03, 0xFF, 0x6F, 0x14, 0xFF, 0x4B, 0x03, 0xFF, 0x89, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0xEE, 0x03, 0xFF, 0x89, 0x0A, 0xFF, 0x88, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xCD, 0x03, 0xFF, 0xA9, 0x02, 0xFF, 0x0A, 0x0B, 0xFF, 0x2B, 0x0B, 0xFF, 0x48, 0x02, 0xFF, 0x4F, 0x1C, 0xFF, 0x6C, 0x0B, 0xFF, 0xC9, 0x02, 0xFF, 0x0A, 0x13, 0xFF, 0x68, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0xED, 0x13, 0xFF, 0xE9, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x88, 0x0A, 0xFF, 0x67, 0x02, 0xFF, 0x0C, 0x0C, 0xFF, 0xA9, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xA8, 0x0A, 0xFF, 0x46, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x2A, 0x0B, 0xFF, 0x2A, 0x03, 0xFF, 0x0A, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0xA8, 0x02, 0xFF, 0x0D, 0x04, 0xFF, 0x0D, 0x14, 0xFF, 0xAC, 0x03, 0xFF, 0x2E, 0x0C, 0xFF, 0x8B, 0x03, 0xFF, 0xCC, 0x0B, 0xFF, 0xD3, 0x04, 0xFF, 0x6D, 0x03, 0xFF,
-    0x0F, 0x14, 0xFF, 0x79, 0x06, 0xFF, 0xF6, 0x04, 0xFF, 0x57, 0x3E, 0xFF, 0x15, 0x35, 0xFF, 0xD2, 0x14, 0xFF, 0xEE, 0x0B, 0xFF, 0xF1, 0x04, 0xFF, 0x90, 0x04, 0xFF, 0x2E, 0x04, 0xFF, 0x73, 0x05, 0xFF, 0xD1, 0x0C, 0xFF, 0x0E, 0x0C, 0xFF, 0x8C, 0x03, 0xFF, 0x4E, 0x04, 0xFF, 0x0B, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0x6C, 0x0B, 0xFF, 0xAA, 0x02, 0xFF, 0x0B, 0x03, 0xFF, 0x8D, 0x0B, 0xFF, 0xCA, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xAD, 0x03, 0xFF, 0xA9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0xA9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0x4C, 0x03, 0xFF, 0x6B, 0x0B, 0xFF, 0x4B, 0x03, 0xFF, 0xAD, 0x0B, 0xFF, 0x8C, 0x0B, 0xFF, 0x0A, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0x2A, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0xED, 0x13, 0xFF, 0x47, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xAE, 0x1C, 0xFF, 0x88, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xEA, 0x02, 0xFF,
-    0x4B, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x8C, 0x0B, 0xFF, 0xE9, 0x02, 0xFF, 0x4D, 0x0C, 0xFF, 0x8B, 0x0B, 0xFF, 0x4B, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x8B, 0x03, 0xFF, 0x4E, 0x14, 0xFF, 0x4B, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x6F, 0x14, 0xFF, 0x18, 0x5F, 0xFF, 0x4E, 0x1C, 0xFF, 0xB6, 0x26, 0xFF, 0x51, 0x1C, 0xFF, 0xD5, 0x0C, 0xFF, 0xD4, 0x04, 0xFF, 0x91, 0x14, 0xFF, 0x73, 0x1D, 0xFF, 0x13, 0x25, 0xFF, 0x70, 0x0C, 0xFF, 0xEF, 0x03, 0xFF, 0xF2, 0x14, 0xFF, 0x0E, 0x0C, 0xFF, 0xD4, 0x05, 0xFF, 0xB4, 0x05, 0xFF, 0x0E, 0x0C, 0xFF, 0x56, 0x56, 0xFF, 0x6C, 0x03, 0xFF, 0x6C, 0x0B, 0xFF, 0x6D, 0x0B, 0xFF, 0x0B, 0x03, 0xFF, 0x14, 0x25, 0xFF, 0xEB, 0x02, 0xFF, 0x6C, 0x0B, 0xFF, 0x0B, 0x0B, 0xFF, 0xCA, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x6C, 0x0B, 0xFF, 0x19, 0x67, 0xFF, 0x89, 0x02, 0xFF, 0x0D, 0x04, 0xFF, 0x0B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0x48, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x8C, 0x13, 0xFF, 0x89, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x4B, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0xAD, 0x0B, 0xFF, 0x4B, 0x0B, 0xFF, 0x6B, 0x0B, 0xFF, 0xEA, 0x0A, 0xFF, 0xA9, 0x02, 0xFF, 0xCD, 0x13, 0xFF, 0xE9, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0xC9, 0x02, 0xFF,
-    0x88, 0x0A, 0xFF, 0x47, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xA9, 0x0A, 0xFF, 0x68, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0xA8, 0x02, 0xFF, 0x4B, 0x0B, 0xFF, 0x2A, 0x0B, 0xFF, 0x29, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0x0A, 0x03, 0xFF, 0xCD, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xAB, 0x0B, 0xFF, 0x6C, 0x03, 0xFF, 0xAD, 0x03, 0xFF, 0x0E, 0x0C, 0xFF, 0x8C, 0x0B, 0xFF, 0x72, 0x25, 0xFF, 0x4F, 0x14, 0xFF, 0xF0, 0x13, 0xFF, 0x71, 0x1C, 0xFF, 0xFF, 0xEF, 0xFF, 0x34, 0x04, 0xFF, 0xEF, 0x0B, 0xFF, 0xD8, 0x96, 0xFF, 0x13, 0x25, 0xFF, 0x91, 0x14, 0xFF, 0x50, 0x04, 0xFF, 0xF2, 0x14, 0xFF, 0x2F, 0x0C, 0xFF, 0xF3, 0x04, 0xFF, 0x94, 0x05, 0xFF, 0x2B, 0x03, 0xFF, 0x0E, 0x0C, 0xFF, 0x4F, 0x0C, 0xFF, 0xAD, 0x0B, 0xFF, 0x0A, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xAD, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0x0B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0x0B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0x0B, 0x03, 0xFF, 0x88, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x88, 0x0A, 0xFF,
-    0x89, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x4C, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0x0B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x0A, 0xFF, 0xEA, 0x02, 0xFF, 0x0A, 0x0B, 0xFF, 0x67, 0x02, 0xFF, 0xED, 0x03, 0xFF, 0x47, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0xC9, 0x0A, 0xFF, 0x68, 0x02, 0xFF, 0x2E, 0x0C, 0xFF, 0xA8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x2D, 0x14, 0xFF, 0x34, 0x3E, 0xFF, 0xE9, 0x02, 0xFF, 0x2A, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0xED, 0x0B, 0xFF, 0x0E, 0x0C, 0xFF, 0x0A, 0x03, 0xFF, 0x2E, 0x14, 0xFF, 0x2E, 0x14, 0xFF, 0x90, 0x14, 0xFF, 0x50, 0x0C, 0xFF, 0x4E, 0x1C, 0xFF, 0x4C, 0x03, 0xFF, 0xD1, 0x1C, 0xFF, 0x0F, 0x14, 0xFF, 0xB1, 0x24, 0xFF, 0xFF, 0xD7, 0xFF, 0x73, 0x04, 0xFF, 0xB2, 0x1C, 0xFF, 0x76, 0x5E, 0xFF, 0x94, 0x2D, 0xFF, 0xD2, 0x14, 0xFF, 0x12, 0x0D, 0xFF, 0x73, 0x2D, 0xFF, 0x2F, 0x0C, 0xFF, 0xB5, 0x0D, 0xFF, 0x70, 0x04, 0xFF, 0x4C, 0x03, 0xFF, 0x2F, 0x14, 0xFF, 0x2E, 0x14, 0xFF, 0x4B, 0x0B, 0xFF,
-    0x2B, 0x03, 0xFF, 0x2B, 0x0B, 0xFF, 0x0E, 0x0C, 0xFF, 0x4B, 0x0B, 0xFF, 0x0B, 0x0B, 0xFF, 0x4C, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0x2D, 0x14, 0xFF, 0x35, 0x3E, 0xFF, 0xCA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x4B, 0x0B, 0xFF, 0xA9, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xB0, 0x24, 0xFF, 0xA9, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x94, 0x2D, 0xFF, 0x2B, 0x03, 0xFF, 0x6C, 0x0B, 0xFF, 0x0A, 0x0B, 0xFF, 0x0A, 0x0B, 0xFF, 0xCD, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0x2B, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0x4B, 0x0B, 0xFF, 0x4B, 0x03, 0xFF, 0x48, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x8E, 0x0C, 0xFF, 0x27, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x2A, 0x13, 0xFF, 0xC9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xF0, 0x14, 0xFF, 0x0A, 0x03, 0xFF, 0xA8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x2A, 0x03, 0xFF, 0xCC, 0x0B, 0xFF, 0x4A, 0x03, 0xFF, 0x6B, 0x0B, 0xFF, 0xED, 0x0B, 0xFF, 0xE8, 0x02, 0xFF, 0x4B, 0x0B, 0xFF, 0xF0, 0x0C, 0xFF, 0x2E, 0x0C, 0xFF, 0x8F, 0x14, 0xFF, 0xCD, 0x03, 0xFF, 0xAD, 0x0B, 0xFF, 0xAC, 0x0B, 0xFF, 0xD0, 0x14, 0xFF, 0x91, 0x24, 0xFF,
-    0x4F, 0x24, 0xFF, 0xF9, 0x76, 0xFF, 0x8E, 0x03, 0xFF, 0xF0, 0x14, 0xFF, 0x9C, 0x87, 0xFF, 0xB4, 0x35, 0xFF, 0xF1, 0x1C, 0xFF, 0x70, 0x14, 0xFF, 0x36, 0x46, 0xFF, 0x4F, 0x14, 0xFF, 0xD5, 0x05, 0xFF, 0xD1, 0x04, 0xFF, 0x2B, 0x0B, 0xFF, 0x0F, 0x14, 0xFF, 0x0E, 0x0C, 0xFF, 0xCD, 0x13, 0xFF, 0x4B, 0x03, 0xFF, 0x0B, 0x03, 0xFF, 0xEB, 0x0A, 0xFF, 0x2E, 0x14, 0xFF, 0x0A, 0x0B, 0xFF, 0x0B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0x6C, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0x2E, 0x14, 0xFF, 0x48, 0x02, 0xFF, 0xA9, 0x0A, 0xFF, 0x68, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xED, 0x0B, 0xFF, 0x2B, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0xA9, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x8C, 0x0B, 0xFF, 0x0D, 0x14, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x2B, 0x0B, 0xFF, 0xCC, 0x0B, 0xFF, 0xE9, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xA9, 0x0A, 0xFF, 0x68, 0x02, 0xFF, 0xF0, 0x24, 0xFF, 0x46, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xC9, 0x0A, 0xFF, 0xB3, 0x3D, 0xFF, 0x8E, 0x04, 0xFF, 0x67, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x0D, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0x2A, 0x0B, 0xFF,
-    0xC8, 0x02, 0xFF, 0xCF, 0x1C, 0xFF, 0x0D, 0x14, 0xFF, 0x10, 0x0D, 0xFF, 0xF1, 0x24, 0xFF, 0x8B, 0x03, 0xFF, 0x0E, 0x1C, 0xFF, 0x2A, 0x0B, 0xFF, 0xED, 0x03, 0xFF, 0x2D, 0x04, 0xFF, 0xAF, 0x14, 0xFF, 0x4F, 0x14, 0xFF, 0xCD, 0x13, 0xFF, 0x2A, 0x03, 0xFF, 0x51, 0x1D, 0xFF, 0x6C, 0x0B, 0xFF, 0x4F, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0x1B, 0xFF, 0x11, 0x15, 0xFF, 0xD3, 0x55, 0xFF, 0xB3, 0x3D, 0xFF, 0xF1, 0x24, 0xFF, 0xCD, 0x1B, 0xFF, 0x52, 0x25, 0xFF, 0xCD, 0x0B, 0xFF, 0x53, 0x15, 0xFF, 0x12, 0x05, 0xFF, 0x4C, 0x13, 0xFF, 0x91, 0x1C, 0xFF, 0x0F, 0x0C, 0xFF, 0x2B, 0x0B, 0xFF, 0xCD, 0x13, 0xFF, 0x2F, 0x1C, 0xFF, 0x0B, 0x0B, 0xFF, 0xF1, 0x14, 0xFF, 0x2F, 0x2C, 0xFF, 0xEA, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0x0D, 0x04, 0xFF, 0x2B, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0x0B, 0x0B, 0xFF, 0x88, 0x02, 0xFF, 0x0E, 0x14, 0xFF, 0xA9, 0x0A, 0xFF, 0xA9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x0B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xF0, 0x14, 0xFF, 0x0A, 0x03, 0xFF, 0x0A, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0x0A, 0x0B, 0xFF, 0x4B, 0x03, 0xFF, 0x6C, 0x03, 0xFF, 0x2A, 0x0B, 0xFF,
-    0x68, 0x02, 0xFF, 0x2B, 0x13, 0xFF, 0x88, 0x0A, 0xFF, 0x2A, 0x13, 0xFF, 0x4E, 0x1C, 0xFF, 0xA8, 0x02, 0xFF, 0x09, 0x0B, 0xFF, 0xA8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xE9, 0x0A, 0xFF, 0xCC, 0x0B, 0xFF, 0x88, 0x02, 0xFF, 0xED, 0x13, 0xFF, 0x09, 0x03, 0xFF, 0xE9, 0x0A, 0xFF, 0x0A, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x4E, 0x14, 0xFF, 0x6B, 0x03, 0xFF, 0xED, 0x13, 0xFF, 0x2A, 0x0B, 0xFF, 0x2A, 0x03, 0xFF, 0x8E, 0x14, 0xFF, 0x0E, 0x0C, 0xFF, 0x0D, 0x0C, 0xFF, 0xCD, 0x0B, 0xFF, 0x0A, 0x03, 0xFF, 0xCE, 0x14, 0xFF, 0x4E, 0x14, 0xFF, 0x0E, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x24, 0xFF, 0xB0, 0x1C, 0xFF, 0x7B, 0x87, 0xFF, 0x92, 0x3D, 0xFF, 0x12, 0x25, 0xFF, 0xEC, 0x1B, 0xFF, 0x51, 0x25, 0xFF, 0x2F, 0x14, 0xFF, 0x73, 0x15, 0xFF, 0x8F, 0x04, 0xFF, 0x2B, 0x0B, 0xFF, 0x0E, 0x0C, 0xFF, 0x2F, 0x1C, 0xFF, 0x6C, 0x03, 0xFF, 0x6C, 0x13, 0xFF, 0x2B, 0x03, 0xFF, 0x6C, 0x03, 0xFF, 0x0B, 0x03, 0xFF, 0x0B, 0x0B, 0xFF, 0x0B, 0x0B, 0xFF, 0xC9, 0x02, 0xFF, 0xEA, 0x0A, 0xFF, 0xCA, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x6F, 0x1C, 0xFF, 0xA8, 0x02, 0xFF, 0xCA, 0x0A, 0xFF,
-    0x27, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x0E, 0x14, 0xFF, 0xCA, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0x89, 0x02, 0xFF, 0x2F, 0x1C, 0xFF, 0x0A, 0x03, 0xFF, 0xA9, 0x02, 0xFF, 0x4B, 0x0B, 0xFF, 0x6C, 0x0B, 0xFF, 0x8C, 0x0B, 0xFF, 0x0A, 0x03, 0xFF, 0xCD, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x88, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x4B, 0x13, 0xFF, 0x88, 0x02, 0xFF, 0x6E, 0x04, 0xFF, 0xA8, 0x02, 0xFF, 0x09, 0x0B, 0xFF, 0x88, 0x02, 0xFF, 0x8B, 0x13, 0xFF, 0xB0, 0x14, 0xFF, 0xA8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xAC, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xEC, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xEE, 0x04, 0xFF, 0x6B, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xD0, 0x24, 0xFF, 0x4A, 0x03, 0xFF, 0x0F, 0x0D, 0xFF, 0xE9, 0x02, 0xFF, 0x76, 0x2E, 0xFF, 0x8C, 0x1B, 0xFF, 0x0A, 0x03, 0xFF, 0x8F, 0x14, 0xFF, 0xF0, 0x24, 0xFF, 0x2D, 0x1C, 0xFF, 0xF3, 0x5D, 0xFF, 0x8C, 0x13, 0xFF, 0x4E, 0x14, 0xFF, 0x38, 0x6F, 0xFF, 0x17, 0x3E, 0xFF, 0xD1, 0x1C, 0xFF, 0x6B, 0x13, 0xFF, 0xDA, 0x4E, 0xFF, 0x4F, 0x1C, 0xFF, 0x11, 0x15, 0xFF, 0x12, 0x15, 0xFF, 0x0B, 0x0B, 0xFF, 0xAD, 0x0B, 0xFF, 0x4B, 0x03, 0xFF, 0x0B, 0x03, 0xFF,
-    0x2B, 0x0B, 0xFF, 0xEE, 0x13, 0xFF, 0x2A, 0x03, 0xFF, 0x4C, 0x03, 0xFF, 0xEB, 0x0A, 0xFF, 0xD2, 0x0C, 0xFF, 0xCA, 0x02, 0xFF, 0xCA, 0x0A, 0xFF, 0xCA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0x8C, 0x1B, 0xFF, 0x4C, 0x0B, 0xFF, 0xA9, 0x02, 0xFF, 0xB0, 0x04, 0xFF, 0x68, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x89, 0x02, 0xFF, 0xAF, 0x04, 0xFF, 0x8C, 0x13, 0xFF, 0x0A, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0x0B, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0xA9, 0x02, 0xFF, 0x6C, 0x0B, 0xFF, 0x70, 0x24, 0xFF, 0x4B, 0x0B, 0xFF, 0x8C, 0x0B, 0xFF, 0xCD, 0x0B, 0xFF, 0x2B, 0x03, 0xFF, 0x68, 0x02, 0xFF, 0x6B, 0x0B, 0xFF, 0x0A, 0x0B, 0xFF, 0x89, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xB0, 0x24, 0xFF, 0xE9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xCF, 0x04, 0xFF, 0xE8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xAE, 0x04, 0xFF, 0x6B, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0x8F, 0x0C, 0xFF, 0x2A, 0x03, 0xFF, 0x72, 0x35, 0xFF, 0x4B, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x4E, 0x14, 0xFF, 0xB0, 0x2C, 0xFF, 0x0E, 0x1C, 0xFF, 0x8C, 0x03, 0xFF, 0xD8, 0x76, 0xFF, 0xF2, 0x34, 0xFF,
-    0x0E, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x24, 0xFF, 0x6F, 0x14, 0xFF, 0xB3, 0x4D, 0xFF, 0x32, 0x25, 0xFF, 0xB0, 0x14, 0xFF, 0x2A, 0x0B, 0xFF, 0xF0, 0x24, 0xFF, 0x2F, 0x14, 0xFF, 0x2F, 0x0C, 0xFF, 0xB1, 0x14, 0xFF, 0x70, 0x2C, 0xFF, 0xD1, 0x24, 0xFF, 0x0E, 0x0C, 0xFF, 0x2B, 0x0B, 0xFF, 0x4C, 0x13, 0xFF, 0x2B, 0x13, 0xFF, 0x2F, 0x14, 0xFF, 0xCA, 0x02, 0xFF, 0xEB, 0x0A, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x0A, 0xFF, 0x2E, 0x1C, 0xFF, 0xC9, 0x02, 0xFF, 0xD1, 0x0C, 0xFF, 0xA9, 0x0A, 0xFF, 0x0A, 0x03, 0xFF, 0xA9, 0x02, 0xFF, 0x2F, 0x04, 0xFF, 0x68, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x8F, 0x14, 0xFF, 0x0A, 0x03, 0xFF, 0xCA, 0x0A, 0xFF, 0x0A, 0x03, 0xFF, 0xAA, 0x02, 0xFF, 0xEE, 0x03, 0xFF, 0x89, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0x0B, 0x03, 0xFF, 0x8C, 0x0B, 0xFF, 0x6C, 0x03, 0xFF, 0x0A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0xED, 0x0B, 0xFF, 0x8C, 0x0B, 0xFF, 0x48, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x4A, 0x0B, 0xFF, 0x0A, 0x0B, 0xFF, 0xC8, 0x02, 0xFF, 0xE9, 0x02, 0xFF,
-    0x2A, 0x0B, 0xFF, 0x0A, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x2A, 0x03, 0xFF, 0x6B, 0x0B, 0xFF, 0x6B, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xCC, 0x0B, 0xFF, 0x6B, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0xCD, 0x0B, 0xFF, 0xAC, 0x0B, 0xFF, 0x8C, 0x03, 0xFF, 0xFF, 0x7F, 0xFF, 0x90, 0x24, 0xFF, 0x0E, 0x1C, 0xFF, 0xBE, 0xE7, 0xFF, 0x8F, 0x24, 0xFF, 0x2E, 0x0C, 0xFF, 0x52, 0x2D, 0xFF, 0xD1, 0x1C, 0xFF, 0xB1, 0x1C, 0xFF, 0x2A, 0x0B, 0xFF, 0x53, 0x2D, 0xFF, 0x0F, 0x14, 0xFF, 0x4F, 0x14, 0xFF, 0x70, 0x0C, 0xFF, 0xB1, 0x34, 0xFF, 0xCE, 0x13, 0xFF, 0xED, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0x50, 0x24, 0xFF, 0x4C, 0x0B, 0xFF, 0x0B, 0x0B, 0xFF, 0x4C, 0x0B, 0xFF, 0x70, 0x24, 0xFF, 0xEA, 0x02, 0xFF, 0xC9, 0x0A, 0xFF, 0xAA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xA9, 0x0A, 0xFF, 0xAA, 0x02, 0xFF, 0xC9, 0x0A, 0xFF, 0x89, 0x02, 0xFF, 0x48, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xC9, 0x0A, 0xFF, 0xCA, 0x02, 0xFF, 0x2B, 0x0B, 0xFF, 0x0A, 0x03, 0xFF, 0x89, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0x8C, 0x03, 0xFF, 0xCA, 0x02, 0xFF, 0x6C, 0x03, 0xFF, 0x2E, 0x14, 0xFF, 0x2B, 0x03, 0xFF,
-    0xA8, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x8E, 0x14, 0xFF, 0xD0, 0x04, 0xFF, 0x0D, 0x04, 0xFF, 0x6B, 0x13, 0xFF, 0xA8, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xEF, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0xB2, 0x05, 0xFF, 0x2E, 0x0C, 0xFF, 0xC9, 0x02, 0xFF, 0x52, 0x15, 0xFF, 0x4A, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x30, 0x05, 0xFF, 0xF1, 0x04, 0xFF, 0x19, 0x5F, 0xFF, 0x31, 0x0D, 0xFF, 0x4A, 0x03, 0xFF, 0x30, 0x05, 0xFF, 0xCC, 0x03, 0xFF, 0xCF, 0x04, 0xFF, 0xED, 0x03, 0xFF, 0xBE, 0x4F, 0xFF, 0xB0, 0x24, 0xFF, 0x50, 0x0D, 0xFF, 0x52, 0x1D, 0xFF, 0xF4, 0x45, 0xFF, 0x2F, 0x14, 0xFF, 0xED, 0x1B, 0xFF, 0xAF, 0x0C, 0xFF, 0x97, 0x56, 0xFF, 0xD6, 0x4E, 0xFF, 0x91, 0x14, 0xFF, 0x2A, 0x03, 0xFF, 0xF1, 0x1C, 0xFF, 0xCD, 0x0B, 0xFF, 0xAD, 0x0B, 0xFF, 0xAA, 0x02, 0xFF, 0x6D, 0x1B, 0xFF, 0xD1, 0x1C, 0xFF, 0xB1, 0x1C, 0xFF, 0xEB, 0x0A, 0xFF, 0x4C, 0x0B, 0xFF, 0xF5, 0x45, 0xFF, 0x0B, 0x0B, 0xFF, 0x6F, 0x14, 0xFF, 0xA9, 0x02, 0xFF, 0xAB, 0x0B, 0xFF, 0xB1, 0x0C, 0xFF, 0x68, 0x02, 0xFF, 0xFE, 0x97, 0xFF, 0xCA, 0x02, 0xFF, 0xAD, 0x03, 0xFF, 0xCA, 0x0A, 0xFF, 0x4B, 0x0B, 0xFF, 0xCA, 0x0A, 0xFF, 0x6F, 0x1C, 0xFF, 0xFF, 0x47, 0xFF,
-    0x47, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xEA, 0x0A, 0xFF, 0x36, 0x36, 0xFF, 0x0B, 0x13, 0xFF, 0x2B, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0xAC, 0x13, 0xFF, 0xB6, 0x15, 0xFF, 0x4C, 0x0B, 0xFF, 0x2B, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x0A, 0x03, 0xFF, 0xB0, 0x24, 0xFF, 0xED, 0x0B, 0xFF, 0xAC, 0x0B, 0xFF, 0xE9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x88, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x0A, 0x0B, 0xFF, 0xF0, 0x04, 0xFF, 0xE9, 0x02, 0xFF, 0x2A, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x0C, 0x0C, 0xFF, 0x34, 0x1E, 0xFF, 0x4A, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x72, 0x15, 0xFF, 0xAB, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x4B, 0x0B, 0xFF, 0xB0, 0x14, 0xFF, 0xEC, 0x0B, 0xFF, 0xAC, 0x0B, 0xFF, 0x6B, 0x0B, 0xFF, 0xCD, 0x0B, 0xFF, 0x2A, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0x0D, 0x0C, 0xFF, 0x2E, 0x1C, 0xFF, 0xED, 0x03, 0xFF, 0x90, 0x1C, 0xFF, 0xF1, 0x1C, 0xFF, 0x8F, 0x2C, 0xFF, 0x0F, 0x1C, 0xFF, 0x6B, 0x03, 0xFF, 0xFF, 0x7F, 0xFF, 0x31, 0x45, 0xFF, 0x8D, 0x0B, 0xFF, 0xEE, 0x1B, 0xFF, 0x11, 0x25, 0xFF, 0x4B, 0x0B, 0xFF, 0xAD, 0x0B, 0xFF, 0x2B, 0x0B, 0xFF, 0x12, 0x3D, 0xFF, 0xCA, 0x02, 0xFF, 0xAD, 0x13, 0xFF, 0xEA, 0x02, 0xFF,
-    0x2B, 0x03, 0xFF, 0x90, 0x1C, 0xFF, 0x6C, 0x13, 0xFF, 0xCA, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xF3, 0x14, 0xFF, 0xA9, 0x02, 0xFF, 0x90, 0x14, 0xFF, 0x0B, 0x03, 0xFF, 0xC9, 0x0A, 0xFF, 0x71, 0x1C, 0xFF, 0x70, 0x0C, 0xFF, 0x88, 0x02, 0xFF, 0x6B, 0x03, 0xFF, 0x90, 0x0C, 0xFF, 0xEE, 0x13, 0xFF, 0x48, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x8E, 0x1C, 0xFF, 0x2B, 0x0B, 0xFF, 0xEA, 0x0A, 0xFF, 0x4B, 0x03, 0xFF, 0x0A, 0x03, 0xFF, 0xB0, 0x14, 0xFF, 0xEE, 0x0B, 0xFF, 0x0E, 0x1C, 0xFF, 0xA9, 0x02, 0xFF, 0x0E, 0x04, 0xFF, 0xC9, 0x02, 0xFF, 0xCD, 0x0B, 0xFF, 0xCD, 0x03, 0xFF, 0xCD, 0x0B, 0xFF, 0x90, 0x04, 0xFF, 0x88, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xEF, 0x04, 0xFF, 0xAC, 0x13, 0xFF, 0xE8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0xB3, 0x15, 0xFF, 0x4A, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xED, 0x0B, 0xFF, 0x4E, 0x04, 0xFF, 0x4A, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0xED, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xCF, 0x04, 0xFF, 0xEC, 0x03, 0xFF, 0xAC, 0x03, 0xFF, 0xCC, 0x0B, 0xFF, 0xAC, 0x0B, 0xFF, 0x92, 0x15, 0xFF, 0x6A, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0xCC, 0x13, 0xFF, 0x72, 0x35, 0xFF, 0x31, 0x15, 0xFF, 0x0D, 0x0C, 0xFF,
-    0x8C, 0x0B, 0xFF, 0x2E, 0x1C, 0xFF, 0x0D, 0x1C, 0xFF, 0x72, 0x1D, 0xFF, 0xFF, 0x9F, 0xFF, 0x90, 0x2C, 0xFF, 0xED, 0x0B, 0xFF, 0x6C, 0x0B, 0xFF, 0x5A, 0x8F, 0xFF, 0xEA, 0x0A, 0xFF, 0x2B, 0x03, 0xFF, 0x0B, 0x0B, 0xFF, 0x6D, 0x13, 0xFF, 0x6C, 0x03, 0xFF, 0x6C, 0x13, 0xFF, 0x8C, 0x0B, 0xFF, 0x2B, 0x0B, 0xFF, 0xCA, 0x0A, 0xFF, 0x89, 0x02, 0xFF, 0x4B, 0x03, 0xFF, 0xCA, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0xEA, 0x0A, 0xFF, 0x8D, 0x0B, 0xFF, 0xEE, 0x1B, 0xFF, 0x93, 0x0D, 0xFF, 0xB0, 0x1C, 0xFF, 0xA9, 0x02, 0xFF, 0xCE, 0x13, 0xFF, 0xF2, 0x04, 0xFF, 0xB0, 0x14, 0xFF, 0x88, 0x0A, 0xFF, 0xC9, 0x0A, 0xFF, 0x2A, 0x03, 0xFF, 0xC9, 0x0A, 0xFF, 0xC9, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xD1, 0x24, 0xFF, 0x2B, 0x0B, 0xFF, 0xAC, 0x03, 0xFF, 0xCD, 0x03, 0xFF, 0x4F, 0x14, 0xFF, 0xC9, 0x02, 0xFF, 0xCD, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0xED, 0x03, 0xFF, 0x4F, 0x0C, 0xFF, 0xCD, 0x0B, 0xFF, 0xC9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xAF, 0x0C, 0xFF, 0xA8, 0x02, 0xFF, 0x6B, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0xAF, 0x0C, 0xFF, 0x2A, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x51, 0x15, 0xFF, 0x4B, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0x8B, 0x0B, 0xFF, 0x6E, 0x04, 0xFF,
-    0x51, 0x0D, 0xFF, 0x2A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0xD0, 0x0C, 0xFF, 0xAB, 0x0B, 0xFF, 0xF0, 0x0C, 0xFF, 0x12, 0x05, 0xFF, 0xED, 0x0B, 0xFF, 0xCC, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0x11, 0x1D, 0xFF, 0xCC, 0x0B, 0xFF, 0x0D, 0x14, 0xFF, 0x6E, 0x0C, 0xFF, 0x2E, 0x0C, 0xFF, 0x73, 0x35, 0xFF, 0xCD, 0x13, 0xFF, 0x38, 0x77, 0xFF, 0xED, 0x1B, 0xFF, 0x11, 0x25, 0xFF, 0x97, 0x6E, 0xFF, 0xD0, 0x3C, 0xFF, 0x0E, 0x14, 0xFF, 0xF5, 0x55, 0xFF, 0x76, 0x56, 0xFF, 0x4B, 0x13, 0xFF, 0xCD, 0x13, 0xFF, 0x4C, 0x0B, 0xFF, 0x2B, 0x0B, 0xFF, 0xF2, 0x1C, 0xFF, 0x2B, 0x0B, 0xFF, 0xAD, 0x0B, 0xFF, 0x4C, 0x03, 0xFF, 0x0B, 0x0B, 0xFF, 0x70, 0x14, 0xFF, 0xCA, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x0A, 0x0B, 0xFF, 0xEE, 0x13, 0xFF, 0x90, 0x1C, 0xFF, 0x0A, 0x03, 0xFF, 0x4B, 0x0B, 0xFF, 0xA9, 0x02, 0xFF, 0x4F, 0x14, 0xFF, 0xCA, 0x02, 0xFF, 0x91, 0x0C, 0xFF, 0xA9, 0x02, 0xFF, 0xA9, 0x02, 0xFF, 0xF7, 0x1E, 0xFF, 0x48, 0x02, 0xFF, 0xA9, 0x0A, 0xFF, 0x0A, 0x0B, 0xFF, 0x4C, 0x0B, 0xFF, 0xFF, 0x97, 0xFF, 0x2B, 0x13, 0xFF, 0xAD, 0x03, 0xFF, 0x2E, 0x04, 0xFF, 0x2F, 0x0C, 0xFF, 0x0A, 0x03, 0xFF, 0xCD, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0xCD, 0x03, 0xFF, 0xCD, 0x03, 0xFF, 0x0D, 0x0C, 0xFF,
-    0xE9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0xA8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xAF, 0x04, 0xFF, 0x4A, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0x6E, 0x04, 0xFF, 0xAB, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0xAC, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0x1A, 0x47, 0xFF, 0xEC, 0x03, 0xFF, 0x6E, 0x0C, 0xFF, 0xED, 0x03, 0xFF, 0x36, 0x1E, 0xFF, 0x2D, 0x0C, 0xFF, 0x6E, 0x14, 0xFF, 0x72, 0x25, 0xFF, 0x6E, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x3D, 0xFF, 0x4E, 0x1C, 0xFF, 0x5B, 0x47, 0xFF, 0x6F, 0x34, 0xFF, 0x2E, 0x1C, 0xFF, 0x6F, 0x24, 0xFF, 0xFF, 0xCF, 0xFF, 0xEE, 0x2B, 0xFF, 0x0E, 0x1C, 0xFF, 0xB1, 0x2C, 0xFF, 0x38, 0x5E, 0xFF, 0xB0, 0x24, 0xFF, 0x8C, 0x13, 0xFF, 0x0B, 0x0B, 0xFF, 0x6C, 0x0B, 0xFF, 0x0B, 0x03, 0xFF, 0xF2, 0x14, 0xFF, 0xEA, 0x0A, 0xFF, 0xEA, 0x02, 0xFF, 0xEA, 0x02, 0xFF, 0xB0, 0x24, 0xFF, 0xEA, 0x0A, 0xFF, 0x90, 0x1C, 0xFF, 0xEA, 0x02, 0xFF, 0xCA, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x33, 0x05, 0xFF, 0xA9, 0x0A, 0xFF, 0xCA, 0x02, 0xFF, 0xB0, 0x14, 0xFF,
-    0xCA, 0x0A, 0xFF, 0x89, 0x02, 0xFF, 0x0B, 0x0B, 0xFF, 0x2C, 0x0B, 0xFF, 0x6F, 0x1C, 0xFF, 0x6C, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0x0E, 0x04, 0xFF, 0x8F, 0x0C, 0xFF, 0x4F, 0x14, 0xFF, 0x4B, 0x03, 0xFF, 0xEE, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0xED, 0x03, 0xFF, 0x4F, 0x0C, 0xFF, 0xED, 0x0B, 0xFF, 0xE9, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x6D, 0x14, 0xFF, 0x0E, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xAB, 0x0B, 0xFF, 0x4A, 0x03, 0xFF, 0x51, 0x15, 0xFF, 0x4A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xD0, 0x0C, 0xFF, 0xD4, 0x2D, 0xFF, 0x2D, 0x04, 0xFF, 0xAB, 0x03, 0xFF, 0x36, 0x0E, 0xFF, 0x14, 0x16, 0xFF, 0xEC, 0x03, 0xFF, 0xB5, 0x16, 0xFF, 0xF8, 0x36, 0xFF, 0x4E, 0x14, 0xFF, 0x51, 0x0D, 0xFF, 0x93, 0x25, 0xFF, 0x2D, 0x0C, 0xFF, 0xFF, 0xE7, 0xFF, 0xAF, 0x14, 0xFF, 0x32, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x45, 0xFF, 0xF3, 0x1D, 0xFF, 0xFF, 0xAF, 0xFF, 0x30, 0x4D, 0xFF, 0x2F, 0x1C, 0xFF, 0x4D, 0x14, 0xFF, 0xBE, 0xBF, 0xFF, 0x6F, 0x34, 0xFF, 0x90, 0x24, 0xFF, 0xF5, 0x3D, 0xFF, 0x2F, 0x24, 0xFF, 0x4C, 0x13, 0xFF, 0xD1, 0x1C, 0xFF, 0x0B, 0x03, 0xFF,
-    0x2B, 0x13, 0xFF, 0xD1, 0x34, 0xFF, 0x2B, 0x0B, 0xFF, 0x6F, 0x1C, 0xFF, 0x0B, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0x2B, 0x03, 0xFF, 0x74, 0x25, 0xFF, 0x0E, 0x0C, 0xFF, 0xEA, 0x0A, 0xFF, 0xEB, 0x02, 0xFF, 0x17, 0x1E, 0xFF, 0xA9, 0x02, 0xFF, 0xEA, 0x0A, 0xFF, 0x8F, 0x24, 0xFF, 0xAA, 0x02, 0xFF, 0xA9, 0x0A, 0xFF, 0xCA, 0x0A, 0xFF, 0x4B, 0x03, 0xFF, 0x8F, 0x1C, 0xFF, 0x2B, 0x0B, 0xFF, 0xCD, 0x13, 0xFF, 0xAD, 0x0B, 0xFF, 0xF1, 0x14, 0xFF, 0x6F, 0x14, 0xFF, 0xB0, 0x14, 0xFF, 0xEA, 0x02, 0xFF, 0xCE, 0x03, 0xFF, 0x8C, 0x0B, 0xFF, 0x0D, 0x0C, 0xFF, 0x4E, 0x14, 0xFF, 0x2E, 0x0C, 0xFF, 0xA8, 0x02, 0xFF, 0x0A, 0x0B, 0xFF, 0x97, 0x47, 0xFF, 0xCE, 0x04, 0xFF, 0xE9, 0x02, 0xFF, 0x4D, 0x0C, 0xFF, 0x09, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0xAF, 0x0C, 0xFF, 0x4C, 0x04, 0xFF, 0xEF, 0x0C, 0xFF, 0x6A, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x4E, 0x1C, 0xFF, 0xB2, 0x05, 0xFF, 0x0C, 0x04, 0xFF, 0x6B, 0x03, 0xFF, 0xAF, 0x14, 0xFF, 0x31, 0x05, 0xFF, 0xD2, 0x05, 0xFF, 0xD2, 0x0D, 0xFF, 0x8E, 0x04, 0xFF, 0x6F, 0x04, 0xFF, 0xD3, 0x15, 0xFF, 0xB3, 0x15, 0xFF, 0x71, 0x05, 0xFF, 0x4D, 0x04, 0xFF, 0x96, 0x26, 0xFF, 0xAF, 0x14, 0xFF, 0xD5, 0x15, 0xFF, 0x16, 0x07, 0xFF, 0x6E, 0x04, 0xFF,
-    0x11, 0x35, 0xFF, 0xF1, 0x24, 0xFF, 0x8E, 0x24, 0xFF, 0x14, 0x36, 0xFF, 0xFF, 0xBF, 0xFF, 0x72, 0x45, 0xFF, 0x70, 0x24, 0xFF, 0xB0, 0x2C, 0xFF, 0x18, 0x67, 0xFF, 0x4E, 0x1C, 0xFF, 0xF2, 0x24, 0xFF, 0xD6, 0x45, 0xFF, 0x8C, 0x13, 0xFF, 0x4F, 0x24, 0xFF, 0xB4, 0x2D, 0xFF, 0x4B, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0xD1, 0x24, 0xFF, 0x2C, 0x13, 0xFF, 0x93, 0x35, 0xFF, 0x2B, 0x03, 0xFF, 0x57, 0x46, 0xFF, 0x4F, 0x1C, 0xFF, 0x0B, 0x0B, 0xFF, 0xD0, 0x24, 0xFF, 0x0B, 0x03, 0xFF, 0x12, 0x1D, 0xFF, 0xEA, 0x0A, 0xFF, 0xCA, 0x0A, 0xFF, 0x6C, 0x03, 0xFF, 0x4C, 0x03, 0xFF, 0xC9, 0x0A, 0xFF, 0xA9, 0x0A, 0xFF, 0x4B, 0x03, 0xFF, 0x6E, 0x14, 0xFF, 0x0E, 0x24, 0xFF, 0xEA, 0x02, 0xFF, 0x4C, 0x03, 0xFF, 0xEA, 0x02, 0xFF, 0x6F, 0x14, 0xFF, 0x2F, 0x04, 0xFF, 0x0F, 0x04, 0xFF, 0xEA, 0x02, 0xFF, 0x4F, 0x04, 0xFF, 0x4F, 0x1C, 0xFF, 0x4E, 0x0C, 0xFF, 0x0E, 0x04, 0xFF, 0xED, 0x03, 0xFF, 0x10, 0x15, 0xFF, 0x67, 0x02, 0xFF, 0x2A, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0xAE, 0x04, 0xFF, 0x4A, 0x03, 0xFF, 0xEF, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x6D, 0x0C, 0xFF, 0x2D, 0x04, 0xFF, 0x8E, 0x0C, 0xFF, 0x8B, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x30, 0x05, 0xFF,
-    0x4D, 0x04, 0xFF, 0xED, 0x03, 0xFF, 0xCE, 0x04, 0xFF, 0xF0, 0x0C, 0xFF, 0xF2, 0x0D, 0xFF, 0xCF, 0x04, 0xFF, 0x32, 0x15, 0xFF, 0x2E, 0x04, 0xFF, 0x4E, 0x04, 0xFF, 0xFE, 0x1F, 0xFF, 0x10, 0x0D, 0xFF, 0x6F, 0x04, 0xFF, 0xF6, 0x55, 0xFF, 0x6F, 0x14, 0xFF, 0x7A, 0x2F, 0xFF, 0x10, 0x1D, 0xFF, 0xFD, 0x97, 0xFF, 0x35, 0x66, 0xFF, 0xEF, 0x34, 0xFF, 0x55, 0x4E, 0xFF, 0xBB, 0x77, 0xFF, 0xD3, 0x55, 0xFF, 0x91, 0x2C, 0xFF, 0x92, 0x3D, 0xFF, 0x7A, 0x87, 0xFF, 0xCC, 0x1B, 0xFF, 0xEE, 0x13, 0xFF, 0xCF, 0x13, 0xFF, 0xCD, 0x13, 0xFF, 0x52, 0x25, 0xFF, 0xCD, 0x1B, 0xFF, 0x4B, 0x03, 0xFF, 0x4C, 0x03, 0xFF, 0xAD, 0x1B, 0xFF, 0x52, 0x25, 0xFF, 0x0B, 0x0B, 0xFF, 0x0B, 0x03, 0xFF, 0x0A, 0x13, 0xFF, 0xD2, 0x3C, 0xFF, 0x73, 0x2D, 0xFF, 0x4B, 0x03, 0xFF, 0x2B, 0x03, 0xFF, 0x0A, 0x0B, 0xFF, 0xEA, 0x02, 0xFF, 0x91, 0x04, 0xFF, 0xAA, 0x02, 0xFF, 0xCA, 0x0A, 0xFF, 0xEA, 0x0A, 0xFF, 0xD4, 0x3D, 0xFF, 0x0B, 0x03, 0xFF, 0x4B, 0x0B, 0xFF, 0x2B, 0x0B, 0xFF, 0x0B, 0x03, 0xFF, 0xF1, 0x14, 0xFF, 0x4C, 0x03, 0xFF, 0x90, 0x04, 0xFF, 0x91, 0x04, 0xFF, 0x70, 0x04, 0xFF, 0x0B, 0x03, 0xFF, 0x0F, 0x04, 0xFF, 0x2E, 0x04, 0xFF, 0x2E, 0x0C, 0xFF, 0x6F, 0x0C, 0xFF, 0x6F, 0x14, 0xFF,
-    0xE9, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xCC, 0x0B, 0xFF, 0x09, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x13, 0x1E, 0xFF, 0xAF, 0x0C, 0xFF, 0xCB, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x92, 0x0D, 0xFF, 0xAB, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x92, 0x0D, 0xFF, 0x2D, 0x04, 0xFF, 0x10, 0x1D, 0xFF, 0x8E, 0x0C, 0xFF, 0x52, 0x05, 0xFF, 0xB2, 0x05, 0xFF, 0x8F, 0x04, 0xFF, 0x52, 0x15, 0xFF, 0xAE, 0x04, 0xFF, 0x10, 0x0D, 0xFF, 0x11, 0x0D, 0xFF, 0x6E, 0x04, 0xFF, 0x18, 0x2F, 0xFF, 0xAF, 0x14, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0x9A, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x13, 0x5E, 0xFF, 0xB2, 0x45, 0xFF, 0xFF, 0xEF, 0xFF, 0x75, 0x7E, 0xFF, 0xD0, 0x24, 0xFF, 0x92, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x2C, 0xFF, 0x2F, 0x1C, 0xFF, 0xDB, 0x57, 0xFF, 0xAD, 0x0B, 0xFF, 0x71, 0x14, 0xFF, 0x6C, 0x0B, 0xFF, 0x6C, 0x0B, 0xFF, 0xF5, 0x35, 0xFF, 0x4F, 0x24, 0xFF, 0x2F, 0x0C, 0xFF, 0xEA, 0x02, 0xFF, 0x0A, 0x03, 0xFF, 0x6C, 0x03, 0xFF, 0x8D, 0x0B, 0xFF, 0x12, 0x1D, 0xFF, 0x74, 0x0D, 0xFF, 0x0B, 0x0B, 0xFF, 0x8C, 0x13, 0xFF, 0xF5, 0x2D, 0xFF, 0x8C, 0x03, 0xFF, 0xEA, 0x0A, 0xFF, 0x0B, 0x0B, 0xFF, 0x4C, 0x03, 0xFF,
-    0xF1, 0x1C, 0xFF, 0x6C, 0x1B, 0xFF, 0x6C, 0x0B, 0xFF, 0x6C, 0x0B, 0xFF, 0x6C, 0x0B, 0xFF, 0xB0, 0x14, 0xFF, 0xEE, 0x0B, 0xFF, 0x70, 0x04, 0xFF, 0xD1, 0x0C, 0xFF, 0xF1, 0x0C, 0xFF, 0xC9, 0x02, 0xFF, 0xF2, 0x04, 0xFF, 0x4F, 0x0C, 0xFF, 0x4F, 0x04, 0xFF, 0x0D, 0x0C, 0xFF, 0x4E, 0x04, 0xFF, 0x67, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x49, 0x13, 0xFF, 0xA8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xEB, 0x1B, 0xFF, 0x4A, 0x03, 0xFF, 0x6D, 0x0C, 0xFF, 0x4D, 0x14, 0xFF, 0xCB, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0xCF, 0x0C, 0xFF, 0xCB, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x72, 0x15, 0xFF, 0x51, 0x15, 0xFF, 0xEF, 0x14, 0xFF, 0x6E, 0x04, 0xFF, 0x19, 0x3F, 0xFF, 0xB2, 0x0D, 0xFF, 0xAF, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0xB2, 0x1D, 0xFF, 0x52, 0x0D, 0xFF, 0xB4, 0x0D, 0xFF, 0x10, 0x15, 0xFF, 0xD0, 0x0C, 0xFF, 0xFF, 0xF7, 0xFF, 0xB3, 0x25, 0xFF, 0x96, 0x66, 0xFF, 0xFF, 0xF7, 0xFF, 0x56, 0x8E, 0xFF, 0xF3, 0x65, 0xFF, 0xFF, 0xDF, 0xFF, 0x9A, 0xC7, 0xFF, 0xF1, 0x2C, 0xFF, 0xF3, 0x5D, 0xFF, 0xFF, 0xEF, 0xFF, 0xF0, 0x44, 0xFF, 0x2E, 0x14, 0xFF, 0xFF, 0x7F, 0xFF, 0x0E, 0x14, 0xFF, 0xD1, 0x1C, 0xFF, 0xB5, 0x25, 0xFF, 0xCD, 0x0B, 0xFF,
-    0x6C, 0x0B, 0xFF, 0x9D, 0x9F, 0xFF, 0xAC, 0x13, 0xFF, 0x2F, 0x0C, 0xFF, 0x4C, 0x03, 0xFF, 0x4C, 0x13, 0xFF, 0xD2, 0x14, 0xFF, 0x8C, 0x03, 0xFF, 0x4B, 0x0B, 0xFF, 0x6B, 0x13, 0xFF, 0x70, 0x04, 0xFF, 0x8D, 0x0B, 0xFF, 0xEA, 0x0A, 0xFF, 0x2B, 0x0B, 0xFF, 0x1A, 0x0F, 0xFF, 0x12, 0x15, 0xFF, 0x8C, 0x1B, 0xFF, 0xEA, 0x02, 0xFF, 0x90, 0x1C, 0xFF, 0x52, 0x1D, 0xFF, 0xEE, 0x13, 0xFF, 0x2F, 0x1C, 0xFF, 0x0E, 0x04, 0xFF, 0x70, 0x04, 0xFF, 0x8F, 0x04, 0xFF, 0xD2, 0x04, 0xFF, 0x6C, 0x03, 0xFF, 0xD1, 0x04, 0xFF, 0x90, 0x0C, 0xFF, 0xB0, 0x04, 0xFF, 0x6F, 0x0C, 0xFF, 0xED, 0x03, 0xFF, 0xA8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x0D, 0x1C, 0xFF, 0xE9, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0x4E, 0x24, 0xFF, 0x8E, 0x14, 0xFF, 0x10, 0x1D, 0xFF, 0xEC, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x51, 0x0D, 0xFF, 0xCF, 0x04, 0xFF, 0xEC, 0x03, 0xFF, 0x6E, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0x31, 0x0D, 0xFF, 0xAF, 0x04, 0xFF, 0xEF, 0x04, 0xFF, 0x10, 0x05, 0xFF, 0xF4, 0x0D, 0xFF, 0x50, 0x05, 0xFF, 0x71, 0x05, 0xFF, 0x38, 0x1F, 0xFF, 0xD3, 0x15, 0xFF, 0x10, 0x0D, 0xFF, 0x92, 0x1D, 0xFF, 0x52, 0x15, 0xFF, 0x31, 0x15, 0xFF,
-    0xF0, 0x1C, 0xFF, 0xD9, 0x9E, 0xFF, 0x51, 0x35, 0xFF, 0x11, 0x35, 0xFF, 0x55, 0x3E, 0xFF, 0x92, 0x4D, 0xFF, 0x12, 0x25, 0xFF, 0x5B, 0x77, 0xFF, 0xB8, 0x3E, 0xFF, 0x4E, 0x24, 0xFF, 0x4F, 0x0C, 0xFF, 0x32, 0x25, 0xFF, 0xCE, 0x13, 0xFF, 0xEF, 0x13, 0xFF, 0x0E, 0x14, 0xFF, 0xCE, 0x03, 0xFF, 0x0F, 0x1C, 0xFF, 0x12, 0x2D, 0xFF, 0xAD, 0x1B, 0xFF, 0x8C, 0x13, 0xFF, 0x6C, 0x13, 0xFF, 0x73, 0x15, 0xFF, 0x2B, 0x03, 0xFF, 0x4B, 0x0B, 0xFF, 0xAD, 0x13, 0xFF, 0x6F, 0x0C, 0xFF, 0x6C, 0x03, 0xFF, 0x8D, 0x13, 0xFF, 0xEA, 0x02, 0xFF, 0xFF, 0x0F, 0xFF, 0xF5, 0x15, 0xFF, 0x4B, 0x13, 0xFF, 0x12, 0x1D, 0xFF, 0x2B, 0x03, 0xFF, 0xBB, 0x2F, 0xFF, 0x2B, 0x03, 0xFF, 0x8D, 0x0B, 0xFF, 0xEE, 0x0B, 0xFF, 0x33, 0x15, 0xFF, 0x6C, 0x03, 0xFF, 0xFD, 0x0E, 0xFF, 0xB1, 0x04, 0xFF, 0x4C, 0x03, 0xFF, 0xD2, 0x04, 0xFF, 0x97, 0x0E, 0xFF, 0x6F, 0x0C, 0xFF, 0x2D, 0x0C, 0xFF, 0x6F, 0x0C, 0xFF, 0xC9, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xCE, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x8D, 0x04, 0xFF, 0x32, 0x06, 0xFF, 0xF2, 0x0D, 0xFF, 0xEB, 0x03, 0xFF, 0xEF, 0x0C, 0xFF, 0xCB, 0x03, 0xFF, 0xB2, 0x15, 0xFF, 0xFB, 0x07, 0xFF, 0xB2, 0x05, 0xFF,
-    0xB3, 0x05, 0xFF, 0xAF, 0x04, 0xFF, 0xAE, 0x04, 0xFF, 0xFF, 0x6F, 0xFF, 0x71, 0x05, 0xFF, 0x51, 0x05, 0xFF, 0x11, 0x05, 0xFF, 0x55, 0x06, 0xFF, 0xFB, 0x07, 0xFF, 0xFF, 0xEF, 0xFF, 0xD3, 0x05, 0xFF, 0x72, 0x05, 0xFF, 0x3A, 0x4F, 0xFF, 0x34, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x15, 0xFF, 0x10, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2C, 0xFF, 0xFF, 0x1F, 0xFF, 0xD7, 0x56, 0xFF, 0xB3, 0x55, 0xFF, 0x53, 0x2D, 0xFF, 0x15, 0x3E, 0xFF, 0xFF, 0x97, 0xFF, 0xCD, 0x0B, 0xFF, 0xB0, 0x1C, 0xFF, 0x70, 0x04, 0xFF, 0x94, 0x2D, 0xFF, 0x0F, 0x14, 0xFF, 0x31, 0x1D, 0xFF, 0xAC, 0x0B, 0xFF, 0x2E, 0x04, 0xFF, 0xED, 0x13, 0xFF, 0x53, 0x35, 0xFF, 0xB0, 0x1C, 0xFF, 0xAD, 0x13, 0xFF, 0x74, 0x76, 0xFF, 0x8F, 0x34, 0xFF, 0xAC, 0x13, 0xFF, 0x52, 0x1D, 0xFF, 0xB1, 0x0C, 0xFF, 0x8C, 0x0B, 0xFF, 0xED, 0x13, 0xFF, 0x16, 0x06, 0xFF, 0xD9, 0x16, 0xFF, 0xD1, 0x1C, 0xFF, 0x2F, 0x14, 0xFF, 0x4F, 0x24, 0xFF, 0xB4, 0x35, 0xFF, 0xAD, 0x03, 0xFF, 0xD1, 0x24, 0xFF, 0x6C, 0x0B, 0xFF, 0xEF, 0x0B, 0xFF, 0x0E, 0x04, 0xFF, 0xD1, 0x04, 0xFF, 0xF1, 0x24, 0xFF, 0x70, 0x0C, 0xFF, 0x0F, 0x0C, 0xFF, 0x90, 0x04, 0xFF, 0xB0, 0x1C, 0xFF, 0x31, 0x25, 0xFF, 0x0E, 0x0C, 0xFF, 0x4F, 0x14, 0xFF,
-    0x2D, 0x04, 0xFF, 0xE9, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0xCF, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0xAA, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x71, 0x05, 0xFF, 0x2D, 0x04, 0xFF, 0xEC, 0x03, 0xFF, 0xAA, 0x03, 0xFF, 0x31, 0x05, 0xFF, 0xFD, 0x07, 0xFF, 0x8E, 0x04, 0xFF, 0x10, 0x05, 0xFF, 0x51, 0x0D, 0xFF, 0xEF, 0x04, 0xFF, 0xBD, 0x57, 0xFF, 0xFD, 0x1F, 0xFF, 0x50, 0x05, 0xFF, 0x72, 0x05, 0xFF, 0xF7, 0x16, 0xFF, 0xBF, 0x6F, 0xFF, 0xFF, 0xA7, 0xFF, 0xFD, 0x1F, 0xFF, 0x58, 0x2F, 0xFF, 0x9D, 0x67, 0xFF, 0xFF, 0x67, 0xFF, 0x5A, 0x37, 0xFF, 0xD4, 0x2D, 0xFF, 0xD8, 0x56, 0xFF, 0xFC, 0x77, 0xFF, 0x72, 0x25, 0xFF, 0xFE, 0x87, 0xFF, 0x96, 0x86, 0xFF, 0x33, 0x1D, 0xFF, 0xD0, 0x14, 0xFF, 0xFF, 0xDF, 0xFF, 0x90, 0x24, 0xFF, 0xD0, 0x14, 0xFF, 0xFE, 0x27, 0xFF, 0x0E, 0x04, 0xFF, 0xDF, 0x5F, 0xFF, 0x58, 0x36, 0xFF, 0x4E, 0x0C, 0xFF, 0xB4, 0x3D, 0xFF, 0x94, 0x35, 0xFF, 0x78, 0x36, 0xFF, 0xAD, 0x0B, 0xFF, 0x96, 0x76, 0xFF, 0xB3, 0x5D, 0xFF, 0x0E, 0x1C, 0xFF, 0x93, 0x25, 0xFF, 0x2F, 0x04, 0xFF, 0xAD, 0x0B, 0xFF, 0xAD, 0x0B, 0xFF, 0x37, 0x1E, 0xFF, 0x2F, 0x0C, 0xFF, 0xCE, 0x03, 0xFF, 0x70, 0x0C, 0xFF, 0x3B, 0x17, 0xFF,
-    0x4F, 0x24, 0xFF, 0x2E, 0x14, 0xFF, 0x0E, 0x0C, 0xFF, 0x8D, 0x03, 0xFF, 0x2F, 0x14, 0xFF, 0x8C, 0x03, 0xFF, 0x4F, 0x14, 0xFF, 0x95, 0x05, 0xFF, 0x74, 0x05, 0xFF, 0xF3, 0x04, 0xFF, 0x6C, 0x03, 0xFF, 0x50, 0x04, 0xFF, 0x4F, 0x04, 0xFF, 0x6F, 0x0C, 0xFF, 0x8F, 0x0C, 0xFF, 0xD0, 0x0C, 0xFF, 0x6B, 0x0B, 0xFF, 0x0A, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xF0, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x6D, 0x0C, 0xFF, 0xEF, 0x0C, 0xFF, 0xB3, 0x05, 0xFF, 0x0C, 0x04, 0xFF, 0x0C, 0x04, 0xFF, 0xCF, 0x04, 0xFF, 0xAF, 0x04, 0xFF, 0xB6, 0x06, 0xFF, 0x75, 0x0E, 0xFF, 0xF0, 0x04, 0xFF, 0x71, 0x05, 0xFF, 0xFE, 0x2F, 0xFF, 0xFC, 0x27, 0xFF, 0x91, 0x05, 0xFF, 0xD3, 0x05, 0xFF, 0xB8, 0x07, 0xFF, 0xFF, 0xEF, 0xFF, 0x38, 0x07, 0xFF, 0xD4, 0x05, 0xFF, 0x19, 0x27, 0xFF, 0x56, 0x0E, 0xFF, 0xFF, 0xBF, 0xFF, 0x52, 0x05, 0xFF, 0xB9, 0x3E, 0xFF, 0x39, 0x06, 0xFF, 0x33, 0x15, 0xFF, 0xBC, 0x47, 0xFF, 0x52, 0x15, 0xFF, 0x13, 0x0D, 0xFF, 0x73, 0x0D, 0xFF, 0x5C, 0x27, 0xFF, 0x4F, 0x14, 0xFF, 0x11, 0x15, 0xFF, 0xF8, 0x06, 0xFF, 0xB0, 0x14, 0xFF, 0x12, 0x1D, 0xFF, 0x90, 0x0C, 0xFF, 0x4F, 0x04, 0xFF,
-    0xD1, 0x1C, 0xFF, 0xAE, 0x0B, 0xFF, 0x37, 0x2E, 0xFF, 0x6B, 0x03, 0xFF, 0x8C, 0x0B, 0xFF, 0xAD, 0x13, 0xFF, 0x4F, 0x14, 0xFF, 0x6D, 0x03, 0xFF, 0x70, 0x0C, 0xFF, 0xD1, 0x0C, 0xFF, 0xFF, 0x0F, 0xFF, 0x50, 0x04, 0xFF, 0x71, 0x04, 0xFF, 0xDF, 0x2F, 0xFF, 0xFF, 0x57, 0xFF, 0x90, 0x1C, 0xFF, 0x2F, 0x14, 0xFF, 0x7D, 0x1F, 0xFF, 0xEF, 0x0B, 0xFF, 0xAD, 0x03, 0xFF, 0x70, 0x1C, 0xFF, 0x4C, 0x03, 0xFF, 0x54, 0x15, 0xFF, 0x13, 0x05, 0xFF, 0x54, 0x0D, 0xFF, 0x17, 0x06, 0xFF, 0x70, 0x04, 0xFF, 0xF3, 0x04, 0xFF, 0x1C, 0x07, 0xFF, 0xB5, 0x05, 0xFF, 0xD0, 0x0C, 0xFF, 0x73, 0x0D, 0xFF, 0xC8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xCF, 0x2C, 0xFF, 0xEB, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x0C, 0x04, 0xFF, 0x72, 0x05, 0xFF, 0xAB, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x6D, 0x04, 0xFF, 0x50, 0x05, 0xFF, 0xD0, 0x04, 0xFF, 0xAF, 0x04, 0xFF, 0x8F, 0x04, 0xFF, 0x30, 0x05, 0xFF, 0x34, 0x06, 0xFF, 0xB2, 0x05, 0xFF, 0x51, 0x05, 0xFF, 0xF2, 0x05, 0xFF, 0x55, 0x06, 0xFF, 0xD2, 0x05, 0xFF, 0x95, 0x06, 0xFF, 0xD6, 0x06, 0xFF, 0x9A, 0x0F, 0xFF, 0x55, 0x06, 0xFF, 0xB3, 0x05, 0xFF, 0x93, 0x05, 0xFF, 0x53, 0x05, 0xFF, 0x15, 0x06, 0xFF,
-    0x73, 0x05, 0xFF, 0xFF, 0x47, 0xFF, 0x9D, 0x17, 0xFF, 0x74, 0x15, 0xFF, 0x17, 0x16, 0xFF, 0xB1, 0x04, 0xFF, 0x34, 0x05, 0xFF, 0x74, 0x05, 0xFF, 0xFF, 0x3F, 0xFF, 0x2F, 0x04, 0xFF, 0xF5, 0x05, 0xFF, 0x94, 0x0D, 0xFF, 0x90, 0x0C, 0xFF, 0x78, 0x3E, 0xFF, 0x4F, 0x14, 0xFF, 0xD1, 0x04, 0xFF, 0x33, 0x15, 0xFF, 0x12, 0x1D, 0xFF, 0x33, 0x15, 0xFF, 0x0E, 0x0C, 0xFF, 0x0E, 0x14, 0xFF, 0x52, 0x15, 0xFF, 0xEF, 0x03, 0xFF, 0x4F, 0x04, 0xFF, 0xB9, 0x06, 0xFF, 0xFF, 0xDF, 0xFF, 0x74, 0x05, 0xFF, 0x94, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x04, 0xFF, 0x53, 0x15, 0xFF, 0x1B, 0x07, 0xFF, 0x91, 0x0C, 0xFF, 0x50, 0x14, 0xFF, 0x53, 0x15, 0xFF, 0x0F, 0x04, 0xFF, 0x14, 0x05, 0xFF, 0x6D, 0x03, 0xFF, 0x94, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x05, 0xFF, 0xD6, 0x0D, 0xFF, 0xF7, 0x05, 0xFF, 0x39, 0x06, 0xFF, 0x33, 0x0D, 0xFF, 0xD0, 0x04, 0xFF, 0xFD, 0x0F, 0xFF, 0xF1, 0x1C, 0xFF, 0x4A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x2A, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x0C, 0x04, 0xFF, 0xCA, 0x03, 0xFF, 0x10, 0x05, 0xFF, 0x6A, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x6E, 0x04, 0xFF, 0x6E, 0x04, 0xFF, 0x51, 0x05, 0xFF, 0x30, 0x15, 0xFF, 0xF3, 0x15, 0xFF, 0x91, 0x05, 0xFF, 0xF0, 0x04, 0xFF,
-    0xEF, 0x04, 0xFF, 0x13, 0x06, 0xFF, 0x95, 0x0E, 0xFF, 0x74, 0x06, 0xFF, 0x95, 0x06, 0xFF, 0xB5, 0x06, 0xFF, 0x55, 0x06, 0xFF, 0x14, 0x06, 0xFF, 0x79, 0x07, 0xFF, 0x78, 0x07, 0xFF, 0x75, 0x06, 0xFF, 0x19, 0x07, 0xFF, 0x9D, 0x27, 0xFF, 0x35, 0x06, 0xFF, 0x98, 0x06, 0xFF, 0x77, 0x06, 0xFF, 0x97, 0x0E, 0xFF, 0x9B, 0x06, 0xFF, 0x7E, 0x17, 0xFF, 0x74, 0x05, 0xFF, 0x38, 0x0E, 0xFF, 0x13, 0x05, 0xFF, 0x75, 0x05, 0xFF, 0x54, 0x05, 0xFF, 0xFF, 0x4F, 0xFF, 0xB1, 0x04, 0xFF, 0xF6, 0x0D, 0xFF, 0xBE, 0x07, 0xFF, 0xD6, 0x05, 0xFF, 0x12, 0x1D, 0xFF, 0x2F, 0x04, 0xFF, 0x93, 0x1D, 0xFF, 0x7D, 0x5F, 0xFF, 0x4F, 0x04, 0xFF, 0xAD, 0x03, 0xFF, 0x2F, 0x14, 0xFF, 0x30, 0x04, 0xFF, 0x33, 0x25, 0xFF, 0x50, 0x0C, 0xFF, 0x90, 0x04, 0xFF, 0xFB, 0x3E, 0xFF, 0x1A, 0x17, 0xFF, 0x91, 0x04, 0xFF, 0xB6, 0x0D, 0xFF, 0x75, 0x05, 0xFF, 0xD5, 0x05, 0xFF, 0x71, 0x04, 0xFF, 0x30, 0x14, 0xFF, 0x2F, 0x0C, 0xFF, 0xD1, 0x0C, 0xFF, 0x0E, 0x14, 0xFF, 0x8D, 0x03, 0xFF, 0xCE, 0x03, 0xFF, 0x4D, 0x03, 0xFF, 0xF3, 0x04, 0xFF, 0x54, 0x05, 0xFF, 0xB7, 0x06, 0xFF, 0xB5, 0x05, 0xFF, 0xF3, 0x0C, 0xFF, 0x12, 0x05, 0xFF, 0xB0, 0x0C, 0xFF, 0x6F, 0x04, 0xFF, 0x8F, 0x0C, 0xFF, 0xB0, 0x0C, 0xFF,
-    0xE9, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x4D, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0xD3, 0x25, 0xFF, 0x0D, 0x04, 0xFF, 0x8C, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x50, 0x05, 0xFF, 0x8A, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x31, 0x0D, 0xFF, 0xF3, 0x05, 0xFF, 0xBD, 0x77, 0xFF, 0xAF, 0x04, 0xFF, 0x11, 0x05, 0xFF, 0x72, 0x05, 0xFF, 0x34, 0x06, 0xFF, 0xFD, 0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0xDA, 0x07, 0xFF, 0xD6, 0x06, 0xFF, 0xD7, 0x06, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0x9A, 0x07, 0xFF, 0x3B, 0x07, 0xFF, 0xDB, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xBE, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xBF, 0x17, 0xFF, 0xBE, 0x9F, 0xFF, 0x5C, 0x0F, 0xFF, 0xFD, 0x06, 0xFF, 0xDE, 0x7F, 0xFF, 0xB6, 0x05, 0xFF, 0x3C, 0x07, 0xFF, 0xDF, 0x6F, 0xFF, 0x58, 0x06, 0xFF, 0x3B, 0x07, 0xFF, 0xFF, 0xEF, 0xFF, 0xF2, 0x04, 0xFF, 0x74, 0x15, 0xFF, 0xD3, 0x25, 0xFF, 0xD2, 0x0C, 0xFF, 0x95, 0x0D, 0xFF, 0x53, 0x0D, 0xFF, 0x8C, 0x03, 0xFF, 0x72, 0x35, 0xFF, 0x2F, 0x14, 0xFF, 0x91, 0x14, 0xFF, 0xB1, 0x04, 0xFF, 0x17, 0x1E, 0xFF, 0x59, 0x2E, 0xFF, 0x14, 0x05, 0xFF, 0x75, 0x05, 0xFF, 0x9D, 0x07, 0xFF, 0x75, 0x05, 0xFF, 0x34, 0x05, 0xFF, 0xD4, 0x35, 0xFF, 0x9B, 0x07, 0xFF,
-    0xB1, 0x1C, 0xFF, 0xD2, 0x1C, 0xFF, 0xF6, 0x25, 0xFF, 0x31, 0x35, 0xFF, 0x50, 0x14, 0xFF, 0xAE, 0x0B, 0xFF, 0xF3, 0x04, 0xFF, 0x34, 0x05, 0xFF, 0x53, 0x25, 0xFF, 0xF2, 0x04, 0xFF, 0x34, 0x05, 0xFF, 0x94, 0x05, 0xFF, 0x0E, 0x04, 0xFF, 0x74, 0x25, 0xFF, 0x10, 0x1D, 0xFF, 0x6F, 0x04, 0xFF, 0xCC, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0xFC, 0x4F, 0xFF, 0xED, 0x03, 0xFF, 0x8F, 0x04, 0xFF, 0xEC, 0x03, 0xFF, 0x33, 0x06, 0xFF, 0xB2, 0x05, 0xFF, 0x51, 0x05, 0xFF, 0x0C, 0x04, 0xFF, 0xF3, 0x05, 0xFF, 0xD3, 0x05, 0xFF, 0xFF, 0x3F, 0xFF, 0x70, 0x05, 0xFF, 0x71, 0x05, 0xFF, 0x54, 0x06, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFC, 0x07, 0xFF, 0x1A, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0x96, 0x06, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF7, 0xFF, 0xD8, 0x06, 0xFF, 0x59, 0x06, 0xFF, 0xFF, 0x27, 0xFF, 0x96, 0x05, 0xFF, 0xDE, 0x07, 0xFF, 0x96, 0x05, 0xFF, 0x96, 0x05, 0xFF, 0x96, 0x05, 0xFF, 0xFF, 0x17, 0xFF, 0xF2, 0x04, 0xFF, 0xFF, 0x17, 0xFF, 0xD5, 0x05, 0xFF, 0x71, 0x04, 0xFF, 0xFF, 0x2F, 0xFF, 0xB1, 0x14, 0xFF, 0x4F, 0x04, 0xFF,
-    0xDE, 0x3F, 0xFF, 0x4F, 0x04, 0xFF, 0xF8, 0x26, 0xFF, 0x70, 0x0C, 0xFF, 0x0F, 0x0C, 0xFF, 0xD2, 0x0C, 0xFF, 0x19, 0x0F, 0xFF, 0x58, 0x36, 0xFF, 0x9C, 0x06, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0x07, 0xFF, 0xFB, 0x0E, 0xFF, 0xFF, 0x37, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x04, 0xFF, 0x54, 0x05, 0xFF, 0xB2, 0x0C, 0xFF, 0x37, 0x1E, 0xFF, 0xB5, 0x2D, 0xFF, 0xF2, 0x04, 0xFF, 0x34, 0x05, 0xFF, 0xCE, 0x03, 0xFF, 0x17, 0x1E, 0xFF, 0xDF, 0x27, 0xFF, 0xFF, 0xC7, 0xFF, 0x39, 0x06, 0xFF, 0x3B, 0x07, 0xFF, 0x5F, 0x07, 0xFF, 0xFF, 0xBF, 0xFF, 0x33, 0x05, 0xFF, 0xDD, 0x0F, 0xFF, 0xD2, 0x04, 0xFF, 0x2B, 0x03, 0xFF, 0xAD, 0x03, 0xFF, 0x4D, 0x04, 0xFF, 0x8B, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0xF2, 0x0D, 0xFF, 0xAF, 0x04, 0xFF, 0x4D, 0x04, 0xFF, 0xCB, 0x03, 0xFF, 0xAE, 0x04, 0xFF, 0x6E, 0x04, 0xFF, 0xCF, 0x04, 0xFF, 0x51, 0x05, 0xFF, 0xFF, 0x3F, 0xFF, 0x72, 0x05, 0xFF, 0x31, 0x05, 0xFF, 0x31, 0x05, 0xFF, 0xF6, 0x06, 0xFF, 0x92, 0x05, 0xFF, 0x54, 0x06, 0xFF, 0xFD, 0x07, 0xFF, 0xDE, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x07, 0xFF, 0x79, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x0F, 0xFF, 0x76, 0x06, 0xFF, 0xF7, 0x06, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x16, 0x06, 0xFF, 0x76, 0x05, 0xFF, 0x9A, 0x06, 0xFF, 0x13, 0x05, 0xFF, 0xBD, 0x0F, 0xFF, 0xD6, 0x05, 0xFF, 0x75, 0x05, 0xFF, 0x71, 0x04, 0xFF, 0x3B, 0x07, 0xFF, 0x70, 0x04, 0xFF, 0x7D, 0x07, 0xFF, 0x5C, 0x17, 0xFF, 0x33, 0x0D, 0xFF, 0x73, 0x15, 0xFF, 0xF6, 0x1D, 0xFF, 0xF5, 0x15, 0xFF, 0xD6, 0x1D, 0xFF, 0xDA, 0x2E, 0xFF, 0x78, 0x3E, 0xFF, 0x71, 0x04, 0xFF, 0x30, 0x04, 0xFF, 0xDF, 0x3F, 0xFF, 0x33, 0x15, 0xFF, 0xD6, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xDF, 0x47, 0xFF, 0x7F, 0x07, 0xFF, 0x76, 0x05, 0xFF, 0xB5, 0x05, 0xFF, 0x94, 0x15, 0xFF, 0x75, 0x1D, 0xFF, 0x55, 0x05, 0xFF, 0x17, 0x0E, 0xFF, 0xFA, 0x16, 0xFF, 0x4F, 0x0C, 0xFF, 0x30, 0x0C, 0xFF, 0xFF, 0x7F, 0xFF, 0xD8, 0x05, 0xFF, 0x14, 0x15, 0xFF, 0xBD, 0x57, 0xFF, 0x95, 0x05, 0xFF, 0xD6, 0x05, 0xFF, 0x33, 0x0D, 0xFF, 0xB5, 0x15, 0xFF, 0x2F, 0x04, 0xFF, 0xB0, 0x0C, 0xFF, 0xB9, 0x0F, 0xFF, 0x8C, 0x03, 0xFF, 0x91, 0x05, 0xFF, 0xBD, 0x5F, 0xFF, 0xEC, 0x03, 0xFF, 0x33, 0x06, 0xFF, 0x10, 0x05, 0xFF, 0xCF, 0x04, 0xFF, 0xEF, 0x0C, 0xFF, 0xF2, 0x05, 0xFF, 0x30, 0x05, 0xFF, 0x9B, 0x47, 0xFF, 0xF4, 0x05, 0xFF, 0x95, 0x0E, 0xFF, 0x71, 0x05, 0xFF, 0x93, 0x0D, 0xFF,
-    0x31, 0x05, 0xFF, 0x34, 0x06, 0xFF, 0xD3, 0x05, 0xFF, 0x96, 0x06, 0xFF, 0xB6, 0x06, 0xFF, 0xDB, 0x07, 0xFF, 0x9B, 0x07, 0xFF, 0xF7, 0x06, 0xFF, 0x39, 0x07, 0xFF, 0xDF, 0x6F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x07, 0xFF, 0xB7, 0x06, 0xFF, 0xB8, 0x06, 0xFF, 0x7D, 0x6F, 0xFF, 0xF9, 0x06, 0xFF, 0xBB, 0x06, 0xFF, 0xFF, 0xEF, 0xFF, 0x19, 0x0E, 0xFF, 0x39, 0x06, 0xFF, 0xBE, 0x37, 0xFF, 0xB6, 0x05, 0xFF, 0x12, 0x05, 0xFF, 0xFF, 0xAF, 0xFF, 0xD6, 0x05, 0xFF, 0x99, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0x06, 0xFF, 0x53, 0x05, 0xFF, 0x9C, 0x27, 0xFF, 0xFF, 0x3F, 0xFF, 0x73, 0x05, 0xFF, 0xB8, 0x36, 0xFF, 0x70, 0x04, 0xFF, 0xB1, 0x04, 0xFF, 0x94, 0x05, 0xFF, 0x77, 0x46, 0xFF, 0xD5, 0x25, 0xFF, 0xB1, 0x04, 0xFF, 0x75, 0x05, 0xFF, 0x99, 0x1E, 0xFF, 0xB3, 0x0C, 0xFF, 0x59, 0x26, 0xFF, 0x55, 0x05, 0xFF, 0x18, 0x16, 0xFF, 0x71, 0x0C, 0xFF, 0x91, 0x0C, 0xFF, 0xD2, 0x14, 0xFF, 0x94, 0x1D, 0xFF, 0xF2, 0x24, 0xFF, 0xB2, 0x14, 0xFF, 0x0F, 0x0C, 0xFF, 0xAE, 0x0B, 0xFF, 0x53, 0x05, 0xFF, 0x75, 0x05, 0xFF, 0xF7, 0x05, 0xFF, 0xDA, 0x0E, 0xFF, 0x94, 0x05, 0xFF, 0x33, 0x0D, 0xFF, 0x74, 0x05, 0xFF, 0xF2, 0x0C, 0xFF, 0xF2, 0x0C, 0xFF, 0xB0, 0x04, 0xFF,
-    0xCC, 0x03, 0xFF, 0x4B, 0x03, 0xFF, 0xB2, 0x0D, 0xFF, 0x2D, 0x04, 0xFF, 0x8B, 0x03, 0xFF, 0x0C, 0x04, 0xFF, 0x4D, 0x04, 0xFF, 0xB6, 0x2E, 0xFF, 0x99, 0x47, 0xFF, 0xBB, 0x3F, 0xFF, 0xF3, 0x15, 0xFF, 0x18, 0x27, 0xFF, 0x34, 0x16, 0xFF, 0x72, 0x05, 0xFF, 0x56, 0x0E, 0xFF, 0x92, 0x05, 0xFF, 0x30, 0x05, 0xFF, 0xFA, 0x1F, 0xFF, 0x93, 0x05, 0xFF, 0x15, 0x06, 0xFF, 0xBC, 0x0F, 0xFF, 0xD6, 0x06, 0xFF, 0x9A, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0x7A, 0x07, 0xFF, 0xDA, 0x07, 0xFF, 0xD7, 0x06, 0xFF, 0xB6, 0x06, 0xFF, 0xD8, 0x06, 0xFF, 0xB7, 0x06, 0xFF, 0x57, 0x06, 0xFF, 0x74, 0x05, 0xFF, 0x57, 0x06, 0xFF, 0xB7, 0x05, 0xFF, 0x7E, 0x17, 0xFF, 0x34, 0x05, 0xFF, 0x7C, 0x17, 0xFF, 0xF9, 0x1D, 0xFF, 0x95, 0x05, 0xFF, 0x74, 0x05, 0xFF, 0xF9, 0x06, 0xFF, 0xB0, 0x04, 0xFF, 0xDB, 0x06, 0xFF, 0x52, 0x05, 0xFF, 0x1A, 0x1F, 0xFF, 0xD6, 0x0D, 0xFF, 0x70, 0x04, 0xFF, 0xF6, 0x1D, 0xFF, 0x5C, 0x37, 0xFF, 0x12, 0x0D, 0xFF, 0xCD, 0x03, 0xFF, 0xB5, 0x05, 0xFF, 0x50, 0x1C, 0xFF, 0x91, 0x1C, 0xFF, 0x77, 0x2E, 0xFF, 0x99, 0x16, 0xFF, 0xD2, 0x0C, 0xFF, 0x54, 0x05, 0xFF, 0xFF, 0x37, 0xFF, 0x1B, 0x17, 0xFF, 0x34, 0x05, 0xFF, 0x98, 0x06, 0xFF, 0xBC, 0x0F, 0xFF, 0x12, 0x0D, 0xFF,
-    0x50, 0x0C, 0xFF, 0xBA, 0x06, 0xFF, 0x57, 0x0E, 0xFF, 0x54, 0x35, 0xFF, 0xD1, 0x14, 0xFF, 0x8D, 0x0B, 0xFF, 0x16, 0x0E, 0xFF, 0x17, 0x06, 0xFF, 0x58, 0x0E, 0xFF, 0xF7, 0x05, 0xFF, 0x75, 0x05, 0xFF, 0xF6, 0x0D, 0xFF, 0x78, 0x06, 0xFF, 0xF8, 0x0E, 0xFF, 0xD1, 0x0C, 0xFF, 0x93, 0x0D, 0xFF, 0x4A, 0x03, 0xFF, 0x6E, 0x04, 0xFF, 0xB2, 0x1D, 0xFF, 0x4D, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0x54, 0x1E, 0xFF, 0x34, 0x1E, 0xFF, 0xD6, 0x2E, 0xFF, 0x2D, 0x04, 0xFF, 0xCF, 0x04, 0xFF, 0x4D, 0x04, 0xFF, 0xF3, 0x15, 0xFF, 0xEF, 0x04, 0xFF, 0x51, 0x05, 0xFF, 0x71, 0x05, 0xFF, 0xB6, 0x0E, 0xFF, 0x16, 0x17, 0xFF, 0xF3, 0x05, 0xFF, 0x37, 0x07, 0xFF, 0xFB, 0x07, 0xFF, 0xFB, 0x07, 0xFF, 0x98, 0x07, 0xFF, 0x9A, 0x07, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x1F, 0xFF, 0x18, 0x07, 0xFF, 0xB6, 0x06, 0xFF, 0x75, 0x06, 0xFF, 0xFE, 0x0F, 0xFF, 0x35, 0x06, 0xFF, 0x93, 0x05, 0xFF, 0x3B, 0x07, 0xFF, 0xD6, 0x05, 0xFF, 0x53, 0x05, 0xFF, 0x94, 0x05, 0xFF, 0x12, 0x05, 0xFF, 0x90, 0x04, 0xFF, 0x91, 0x04, 0xFF, 0x5C, 0x07, 0xFF, 0x90, 0x0C, 0xFF, 0xF2, 0x04, 0xFF, 0xD2, 0x04, 0xFF, 0x32, 0x0D, 0xFF, 0x12, 0x0D, 0xFF, 0x35, 0x26, 0xFF, 0xD1, 0x04, 0xFF,
-    0x54, 0x1D, 0xFF, 0x13, 0x15, 0xFF, 0x33, 0x0D, 0xFF, 0x32, 0x15, 0xFF, 0x70, 0x14, 0xFF, 0xDD, 0x07, 0xFF, 0x34, 0x15, 0xFF, 0x12, 0x1D, 0xFF, 0xDF, 0x8F, 0xFF, 0x79, 0x26, 0xFF, 0x95, 0x1D, 0xFF, 0xDF, 0x77, 0xFF, 0xDF, 0xFF, 0xFF, 0xBA, 0x1E, 0xFF, 0xFE, 0xEF, 0xFF, 0xFF, 0x17, 0xFF, 0x4F, 0x14, 0xFF, 0xB2, 0x04, 0xFF, 0x94, 0x2D, 0xFF, 0xD3, 0x4D, 0xFF, 0xEE, 0x0B, 0xFF, 0xEE, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xD9, 0x1E, 0xFF, 0xF4, 0x35, 0xFF, 0xFF, 0x5F, 0xFF, 0x95, 0x0D, 0xFF, 0x13, 0x05, 0xFF, 0x53, 0x15, 0xFF, 0x53, 0x25, 0xFF, 0x31, 0x25, 0xFF, 0x4F, 0x0C, 0xFF, 0x54, 0x1E, 0xFF, 0x0D, 0x04, 0xFF, 0x9D, 0x8F, 0xFF, 0x94, 0x16, 0xFF, 0xD2, 0x05, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0x4F, 0x05, 0xFF, 0x50, 0x05, 0xFF, 0x13, 0x06, 0xFF, 0xF3, 0x1D, 0xFF, 0xF3, 0x05, 0xFF, 0x94, 0x0E, 0xFF, 0x50, 0x05, 0xFF, 0xFF, 0x37, 0xFF, 0xD7, 0x06, 0xFF, 0xD9, 0x0F, 0xFF, 0x58, 0x0F, 0xFF, 0x38, 0x07, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x87, 0xFF, 0xDC, 0x07, 0xFF, 0xBE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xEF, 0xFF, 0x9B, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xB7, 0x06, 0xFF, 0x93, 0x05, 0xFF, 0xBE, 0x1F, 0xFF, 0x73, 0x05, 0xFF, 0x9C, 0x0F, 0xFF, 0xFF, 0x2F, 0xFF, 0xF2, 0x04, 0xFF, 0xD2, 0x04, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x26, 0xFF, 0xF2, 0x04, 0xFF, 0xFF, 0x5F, 0xFF, 0x4F, 0x04, 0xFF, 0x9B, 0x2F, 0xFF, 0xF6, 0x36, 0xFF, 0x32, 0x2D, 0xFF, 0xF1, 0x14, 0xFF, 0x96, 0x36, 0xFF, 0xD7, 0x66, 0xFF, 0x98, 0x97, 0xFF, 0x6F, 0x24, 0xFF, 0xB1, 0x24, 0xFF, 0xD1, 0x34, 0xFF, 0x38, 0x9F, 0xFF, 0xFF, 0xCF, 0xFF, 0xD1, 0x2C, 0xFF, 0xD1, 0x24, 0xFF, 0x98, 0x6E, 0xFF, 0xBB, 0x87, 0xFF, 0x6F, 0x34, 0xFF, 0x70, 0x24, 0xFF, 0xF1, 0x3C, 0xFF, 0xF0, 0x44, 0xFF, 0xB6, 0x56, 0xFF, 0xF1, 0x24, 0xFF, 0x90, 0x1C, 0xFF, 0xEE, 0x1B, 0xFF, 0x90, 0x2C, 0xFF, 0xB4, 0x35, 0xFF, 0x54, 0x0D, 0xFF, 0xB5, 0x1D, 0xFF, 0x93, 0x25, 0xFF, 0x33, 0x25, 0xFF, 0xF5, 0x35, 0xFF, 0x90, 0x14, 0xFF, 0xD1, 0x0C, 0xFF, 0x6F, 0x1C, 0xFF, 0xD0, 0x14, 0xFF, 0xE8, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0xCF, 0x04, 0xFF, 0xAE, 0x04, 0xFF, 0xAE, 0x04, 0xFF, 0xEF, 0x04, 0xFF, 0x4C, 0x04, 0xFF, 0xAB, 0x03, 0xFF, 0x2F, 0x05, 0xFF, 0xCF, 0x04, 0xFF, 0x2F, 0x05, 0xFF, 0xD2, 0x05, 0xFF, 0xCF, 0x04, 0xFF, 0xF3, 0x05, 0xFF, 0x55, 0x06, 0xFF,
-    0x10, 0x05, 0xFF, 0x96, 0x06, 0xFF, 0x54, 0x06, 0xFF, 0xD6, 0x06, 0xFF, 0x77, 0x07, 0xFF, 0xFA, 0x07, 0xFF, 0xFD, 0x07, 0xFF, 0x58, 0x07, 0xFF, 0xFB, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xDF, 0x07, 0xFF, 0xFF, 0x57, 0xFF, 0x97, 0x06, 0xFF, 0x14, 0x06, 0xFF, 0x17, 0x07, 0xFF, 0x99, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0x73, 0x05, 0xFF, 0x15, 0x06, 0xFF, 0x32, 0x05, 0xFF, 0x14, 0x06, 0xFF, 0xD1, 0x04, 0xFF, 0xF2, 0x04, 0xFF, 0xD1, 0x04, 0xFF, 0x16, 0x0E, 0xFF, 0xF1, 0x0C, 0xFF, 0xD1, 0x04, 0xFF, 0x6F, 0x0C, 0xFF, 0x72, 0x1D, 0xFF, 0x51, 0x15, 0xFF, 0xB0, 0x1C, 0xFF, 0xFD, 0x4F, 0xFF, 0x12, 0x1D, 0xFF, 0x96, 0x36, 0xFF, 0xCD, 0x13, 0xFF, 0xF0, 0x34, 0xFF, 0xB1, 0x24, 0xFF, 0xB3, 0x35, 0xFF, 0x11, 0x3D, 0xFF, 0x11, 0x35, 0xFF, 0xF2, 0x34, 0xFF, 0x56, 0x3E, 0xFF, 0xF1, 0x34, 0xFF, 0xB1, 0x3C, 0xFF, 0x2E, 0x1C, 0xFF, 0xF5, 0x35, 0xFF, 0x73, 0x35, 0xFF, 0xD1, 0x2C, 0xFF, 0xCD, 0x1B, 0xFF, 0x52, 0x2D, 0xFF, 0x6F, 0x14, 0xFF, 0x90, 0x24, 0xFF, 0xED, 0x13, 0xFF, 0x8C, 0x13, 0xFF, 0x94, 0x1D, 0xFF, 0x73, 0x25, 0xFF, 0xF6, 0x1D, 0xFF, 0x12, 0x15, 0xFF, 0x94, 0x1D, 0xFF, 0x74, 0x1D, 0xFF, 0xD1, 0x0C, 0xFF, 0x90, 0x14, 0xFF, 0x0E, 0x0C, 0xFF, 0x4F, 0x14, 0xFF,
-    0x69, 0x03, 0xFF, 0x6B, 0x03, 0xFF, 0x4D, 0x04, 0xFF, 0x4D, 0x04, 0xFF, 0xCE, 0x0C, 0xFF, 0xEB, 0x03, 0xFF, 0x6E, 0x04, 0xFF, 0x2C, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0xF0, 0x04, 0xFF, 0xEC, 0x03, 0xFF, 0x8E, 0x04, 0xFF, 0x4D, 0x04, 0xFF, 0x91, 0x05, 0xFF, 0xB2, 0x05, 0xFF, 0xB2, 0x05, 0xFF, 0xEF, 0x04, 0xFF, 0xB2, 0x05, 0xFF, 0xD5, 0x06, 0xFF, 0x13, 0x06, 0xFF, 0x54, 0x06, 0xFF, 0xF6, 0x06, 0xFF, 0x37, 0x07, 0xFF, 0x98, 0x17, 0xFF, 0x16, 0x07, 0xFF, 0x57, 0x07, 0xFF, 0xFE, 0x2F, 0xFF, 0x54, 0x06, 0xFF, 0xB3, 0x05, 0xFF, 0xD7, 0x06, 0xFF, 0xF7, 0x0E, 0xFF, 0x75, 0x0E, 0xFF, 0x76, 0x0E, 0xFF, 0x77, 0x16, 0xFF, 0x12, 0x05, 0xFF, 0x90, 0x04, 0xFF, 0x74, 0x05, 0xFF, 0xD1, 0x04, 0xFF, 0xD2, 0x04, 0xFF, 0x91, 0x04, 0xFF, 0x36, 0x06, 0xFF, 0x11, 0x1D, 0xFF, 0xB0, 0x0C, 0xFF, 0x90, 0x0C, 0xFF, 0x77, 0x1E, 0xFF, 0x8F, 0x14, 0xFF, 0x8F, 0x0C, 0xFF, 0x32, 0x15, 0xFF, 0xB0, 0x24, 0xFF, 0xF0, 0x2C, 0xFF, 0x6F, 0x14, 0xFF, 0xB3, 0x15, 0xFF, 0x8F, 0x2C, 0xFF, 0x11, 0x2D, 0xFF, 0x72, 0x35, 0xFF, 0xBD, 0xB7, 0xFF, 0xCF, 0x34, 0xFF, 0xDC, 0x47, 0xFF, 0xFD, 0x57, 0xFF, 0x52, 0x35, 0xFF, 0xFF, 0x37, 0xFF, 0xBD, 0x27, 0xFF, 0xF0, 0x24, 0xFF, 0x97, 0x2E, 0xFF,
-    0xD1, 0x14, 0xFF, 0x76, 0x2E, 0xFF, 0xCD, 0x23, 0xFF, 0x4E, 0x24, 0xFF, 0x6F, 0x14, 0xFF, 0xAC, 0x1B, 0xFF, 0xB3, 0x15, 0xFF, 0x19, 0x17, 0xFF, 0xB4, 0x1D, 0xFF, 0x53, 0x15, 0xFF, 0x93, 0x15, 0xFF, 0xB0, 0x14, 0xFF, 0xB0, 0x14, 0xFF, 0x6F, 0x14, 0xFF, 0x90, 0x14, 0xFF, 0x4F, 0x1C, 0xFF, 0x73, 0x0E, 0xFF, 0xB6, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xF5, 0x06, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF1, 0x05, 0xFF, 0x33, 0x0E, 0xFF, 0x0E, 0x05, 0xFF, 0x8E, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0x71, 0x15, 0xFF, 0xEE, 0x04, 0xFF, 0x70, 0x05, 0xFF, 0x53, 0x06, 0xFF, 0xF5, 0x0E, 0xFF, 0x33, 0x0E, 0xFF, 0xFF, 0x27, 0xFF, 0x33, 0x06, 0xFF, 0x7A, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0x94, 0x06, 0xFF, 0xDE, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x07, 0xFF, 0xB6, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x05, 0xFF, 0x34, 0x06, 0xFF, 0xFF, 0x57, 0xFF, 0xF5, 0x0D, 0xFF, 0xB0, 0x04, 0xFF, 0x3B, 0x17, 0xFF, 0x93, 0x0D, 0xFF, 0x31, 0x05, 0xFF, 0x12, 0x0D, 0xFF, 0xF2, 0x04, 0xFF, 0xB0, 0x04, 0xFF, 0xFF, 0x0F, 0xFF, 0xAC, 0x03, 0xFF, 0x8F, 0x0C, 0xFF, 0x90, 0x04, 0xFF, 0x52, 0x2D, 0xFF, 0x51, 0x25, 0xFF, 0x32, 0x1D, 0xFF, 0xB3, 0x3D, 0xFF,
-    0x8F, 0x1C, 0xFF, 0xD2, 0x35, 0xFF, 0xAC, 0x1B, 0xFF, 0xAF, 0x2C, 0xFF, 0x31, 0x35, 0xFF, 0xD0, 0x34, 0xFF, 0xF4, 0x5D, 0xFF, 0xF0, 0x4C, 0xFF, 0x11, 0x4D, 0xFF, 0x51, 0x55, 0xFF, 0x52, 0x55, 0xFF, 0x72, 0x5D, 0xFF, 0x10, 0x45, 0xFF, 0xAF, 0x44, 0xFF, 0x6F, 0x3C, 0xFF, 0x6E, 0x34, 0xFF, 0xCC, 0x1B, 0xFF, 0x6E, 0x34, 0xFF, 0x6E, 0x2C, 0xFF, 0xEC, 0x1B, 0xFF, 0xAC, 0x13, 0xFF, 0xEC, 0x23, 0xFF, 0x11, 0x25, 0xFF, 0xD0, 0x24, 0xFF, 0xF1, 0x24, 0xFF, 0xF1, 0x1C, 0xFF, 0x31, 0x25, 0xFF, 0x6F, 0x14, 0xFF, 0xCF, 0x1C, 0xFF, 0x4E, 0x14, 0xFF, 0x4F, 0x1C, 0xFF, 0x4E, 0x14, 0xFF, 0x6A, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x4D, 0x04, 0xFF, 0x0C, 0x04, 0xFF, 0x0C, 0x04, 0xFF, 0x0B, 0x04, 0xFF, 0x2C, 0x04, 0xFF, 0xEF, 0x14, 0xFF, 0xCE, 0x04, 0xFF, 0x93, 0x0E, 0xFF, 0x4D, 0x04, 0xFF, 0x50, 0x0D, 0xFF, 0x6D, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0xCF, 0x04, 0xFF, 0x50, 0x05, 0xFF, 0xEF, 0x04, 0xFF, 0x30, 0x05, 0xFF, 0x50, 0x05, 0xFF, 0xF3, 0x05, 0xFF, 0xF2, 0x05, 0xFF, 0x53, 0x06, 0xFF, 0xD2, 0x05, 0xFF, 0xF2, 0x05, 0xFF, 0x36, 0x07, 0xFF, 0x34, 0x06, 0xFF, 0x34, 0x06, 0xFF, 0xD5, 0x06, 0xFF, 0x92, 0x05, 0xFF, 0x72, 0x05, 0xFF, 0x92, 0x05, 0xFF,
-    0x32, 0x05, 0xFF, 0x70, 0x04, 0xFF, 0xD1, 0x04, 0xFF, 0x90, 0x04, 0xFF, 0xD1, 0x04, 0xFF, 0x4E, 0x0C, 0xFF, 0xB0, 0x04, 0xFF, 0x4F, 0x04, 0xFF, 0x70, 0x04, 0xFF, 0x8B, 0x03, 0xFF, 0x90, 0x1C, 0xFF, 0xCC, 0x0B, 0xFF, 0x0D, 0x14, 0xFF, 0x8F, 0x1C, 0xFF, 0x6F, 0x24, 0xFF, 0x6F, 0x24, 0xFF, 0x31, 0x35, 0xFF, 0x8F, 0x34, 0xFF, 0x4D, 0x34, 0xFF, 0x30, 0x4D, 0xFF, 0x31, 0x4D, 0xFF, 0x4E, 0x34, 0xFF, 0x33, 0x86, 0xFF, 0xB5, 0xB6, 0xFF, 0x37, 0xBF, 0xFF, 0xB2, 0x75, 0xFF, 0x10, 0x5D, 0xFF, 0x10, 0x5D, 0xFF, 0x51, 0x6D, 0xFF, 0x13, 0x8E, 0xFF, 0x31, 0x5D, 0xFF, 0xAF, 0x44, 0xFF, 0x6E, 0x3C, 0xFF, 0xF0, 0x4C, 0xFF, 0x4E, 0x34, 0xFF, 0x6E, 0x2C, 0xFF, 0x8B, 0x1B, 0xFF, 0xCC, 0x1B, 0xFF, 0x11, 0x25, 0xFF, 0x8F, 0x1C, 0xFF, 0xD0, 0x1C, 0xFF, 0xF1, 0x1C, 0xFF, 0x12, 0x1D, 0xFF, 0x90, 0x14, 0xFF, 0x90, 0x1C, 0xFF, 0x6F, 0x14, 0xFF, 0x6F, 0x1C, 0xFF, 0x4F, 0x1C, 0xFF, 0x29, 0x03, 0xFF, 0x30, 0x15, 0xFF, 0x09, 0x03, 0xFF, 0xD2, 0x1D, 0xFF, 0xB2, 0x05, 0xFF, 0xAB, 0x03, 0xFF, 0x91, 0x05, 0xFF, 0xEB, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x71, 0x05, 0xFF, 0xEC, 0x03, 0xFF, 0xD2, 0x05, 0xFF, 0xEF, 0x0C, 0xFF, 0x8E, 0x04, 0xFF, 0x94, 0x06, 0xFF, 0x4D, 0x04, 0xFF,
-    0xB5, 0x06, 0xFF, 0x12, 0x06, 0xFF, 0xEF, 0x04, 0xFF, 0xBB, 0x37, 0xFF, 0xFF, 0x67, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x06, 0xFF, 0x91, 0x05, 0xFF, 0x33, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0x38, 0x07, 0xFF, 0x31, 0x05, 0xFF, 0x51, 0x05, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x77, 0xFF, 0xDE, 0x4F, 0xFF, 0x6F, 0x04, 0xFF, 0xB0, 0x04, 0xFF, 0x6F, 0x04, 0xFF, 0x18, 0x1F, 0xFF, 0x8F, 0x14, 0xFF, 0x90, 0x04, 0xFF, 0x2E, 0x0C, 0xFF, 0xD0, 0x14, 0xFF, 0x95, 0x26, 0xFF, 0xCF, 0x1C, 0xFF, 0xED, 0x13, 0xFF, 0xB2, 0x35, 0xFF, 0x75, 0x3E, 0xFF, 0x95, 0x4E, 0xFF, 0x0C, 0x2C, 0xFF, 0xD0, 0x14, 0xFF, 0x34, 0x56, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x6E, 0xFF, 0x16, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x9E, 0xFF, 0xB6, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xCF, 0xFF, 0x3A, 0xCF, 0xFF, 0x37, 0x87, 0xFF, 0x2D, 0x3C, 0xFF, 0x34, 0x66, 0xFF, 0x0C, 0x2C, 0xFF, 0x10, 0x3D, 0xFF, 0x92, 0x3D, 0xFF, 0x8F, 0x2C, 0xFF, 0xF3, 0x4D, 0xFF, 0x93, 0x35, 0xFF, 0x31, 0x35, 0xFF, 0x52, 0x2D, 0xFF, 0xB0, 0x1C, 0xFF, 0x6F, 0x1C, 0xFF, 0xB0, 0x24, 0xFF, 0x90, 0x1C, 0xFF,
-    0x09, 0x0B, 0xFF, 0x29, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0x4C, 0x04, 0xFF, 0xEB, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0xEB, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xAE, 0x04, 0xFF, 0x91, 0x15, 0xFF, 0x6D, 0x04, 0xFF, 0xAD, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0x30, 0x05, 0xFF, 0xEF, 0x04, 0xFF, 0xEF, 0x04, 0xFF, 0xB2, 0x0D, 0xFF, 0xCE, 0x04, 0xFF, 0x34, 0x0E, 0xFF, 0x94, 0x0E, 0xFF, 0x12, 0x06, 0xFF, 0x9D, 0x87, 0xFF, 0xF7, 0x06, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xEF, 0xFF, 0x55, 0x06, 0xFF, 0x58, 0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0x51, 0x05, 0xFF, 0x96, 0x16, 0xFF, 0x32, 0x05, 0xFF, 0xAF, 0x0C, 0xFF, 0x4E, 0x04, 0xFF, 0xD4, 0x0D, 0xFF, 0x6F, 0x0C, 0xFF, 0x32, 0x15, 0xFF, 0xCF, 0x24, 0xFF, 0x6F, 0x04, 0xFF, 0x4B, 0x03, 0xFF, 0x53, 0x05, 0xFF, 0x6B, 0x03, 0xFF, 0x31, 0x3D, 0xFF, 0xCC, 0x0B, 0xFF, 0x2D, 0x1C, 0xFF, 0xAF, 0x2C, 0xFF, 0x55, 0x56, 0xFF, 0x4E, 0x24, 0xFF, 0xCF, 0x1C, 0xFF, 0x76, 0x56, 0xFF, 0x6E, 0x34, 0xFF, 0xF3, 0x55, 0xFF, 0xF4, 0x5D, 0xFF, 0xF4, 0x65, 0xFF, 0xD6, 0x86, 0xFF, 0xDD, 0xDF, 0xFF, 0xB6, 0x9E, 0xFF, 0xB2, 0x65, 0xFF, 0x51, 0x5D, 0xFF, 0x92, 0x65, 0xFF, 0x51, 0x65, 0xFF, 0xF0, 0x5C, 0xFF, 0xD0, 0x54, 0xFF, 0x8E, 0x44, 0xFF,
-    0x4E, 0x3C, 0xFF, 0xF0, 0x4C, 0xFF, 0xEC, 0x2B, 0xFF, 0x2D, 0x2C, 0xFF, 0x4D, 0x2C, 0xFF, 0xF0, 0x34, 0xFF, 0xF0, 0x2C, 0xFF, 0x0D, 0x1C, 0xFF, 0x0D, 0x1C, 0xFF, 0x30, 0x2D, 0xFF, 0xF0, 0x24, 0xFF, 0x8E, 0x24, 0xFF, 0x8E, 0x24, 0xFF, 0x6F, 0x1C, 0xFF, 0x4E, 0x1C, 0xFF, 0x2E, 0x1C, 0xFF, 0xA8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x4D, 0x1C, 0xFF, 0x6A, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xCF, 0x24, 0xFF, 0x8A, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x6D, 0x0C, 0xFF, 0xAF, 0x14, 0xFF, 0xCF, 0x14, 0xFF, 0x2C, 0x04, 0xFF, 0x2D, 0x04, 0xFF, 0x2C, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0xCF, 0x04, 0xFF, 0xAE, 0x04, 0xFF, 0xCF, 0x04, 0xFF, 0x10, 0x05, 0xFF, 0xF0, 0x04, 0xFF, 0xCF, 0x04, 0xFF, 0xD0, 0x04, 0xFF, 0xAF, 0x04, 0xFF, 0x4E, 0x04, 0xFF, 0x6F, 0x04, 0xFF, 0x0E, 0x04, 0xFF, 0x4E, 0x04, 0xFF, 0x0D, 0x0C, 0xFF, 0x8F, 0x14, 0xFF, 0xAF, 0x24, 0xFF, 0x4F, 0x0C, 0xFF, 0x0A, 0x03, 0xFF, 0x2E, 0x0C, 0xFF, 0x8B, 0x13, 0xFF, 0xF0, 0x3C, 0xFF, 0xAC, 0x13, 0xFF, 0xEC, 0x1B, 0xFF, 0x6E, 0x2C, 0xFF, 0xCF, 0x3C, 0xFF, 0x2D, 0x2C, 0xFF,
-    0xAF, 0x34, 0xFF, 0x8E, 0x34, 0xFF, 0x6E, 0x34, 0xFF, 0x71, 0x5D, 0xFF, 0xCF, 0x44, 0xFF, 0xAF, 0x44, 0xFF, 0x34, 0x76, 0xFF, 0x34, 0x7E, 0xFF, 0xF2, 0x75, 0xFF, 0x51, 0x65, 0xFF, 0x31, 0x5D, 0xFF, 0xD2, 0x6D, 0xFF, 0x30, 0x65, 0xFF, 0xCF, 0x54, 0xFF, 0xAF, 0x4C, 0xFF, 0xAF, 0x4C, 0xFF, 0x6E, 0x44, 0xFF, 0xD0, 0x4C, 0xFF, 0x0D, 0x2C, 0xFF, 0x6E, 0x34, 0xFF, 0x4D, 0x34, 0xFF, 0x31, 0x3D, 0xFF, 0xF0, 0x24, 0xFF, 0xAB, 0x1B, 0xFF, 0xCC, 0x1B, 0xFF, 0x31, 0x2D, 0xFF, 0x31, 0x2D, 0xFF, 0xCF, 0x24, 0xFF, 0x6E, 0x24, 0xFF, 0x4E, 0x1C, 0xFF, 0x2E, 0x24, 0xFF, 0x0E, 0x1C, 0xFF, 0xC8, 0x02, 0xFF, 0xC9, 0x02, 0xFF, 0x4A, 0x0B, 0xFF, 0xA7, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0xC7, 0x02, 0xFF, 0xEC, 0x13, 0xFF, 0x6A, 0x03, 0xFF, 0x6D, 0x1C, 0xFF, 0x4A, 0x03, 0xFF, 0xAA, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0x34, 0x4E, 0xFF, 0x0C, 0x04, 0xFF, 0xB1, 0x35, 0xFF, 0x4D, 0x04, 0xFF, 0x2C, 0x04, 0xFF, 0x8E, 0x0C, 0xFF, 0x6D, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0x50, 0x15, 0xFF, 0x8E, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0xAF, 0x04, 0xFF, 0x8E, 0x04, 0xFF, 0xCF, 0x0C, 0xFF, 0xF0, 0x14, 0xFF, 0x8F, 0x0C, 0xFF,
-    0x6F, 0x0C, 0xFF, 0x2E, 0x04, 0xFF, 0x6F, 0x0C, 0xFF, 0x0D, 0x0C, 0xFF, 0xAF, 0x1C, 0xFF, 0x2D, 0x14, 0xFF, 0x2F, 0x0C, 0xFF, 0xEA, 0x0A, 0xFF, 0x0D, 0x0C, 0xFF, 0x6B, 0x13, 0xFF, 0x31, 0x45, 0xFF, 0xEC, 0x13, 0xFF, 0xAB, 0x13, 0xFF, 0x10, 0x3D, 0xFF, 0x72, 0x55, 0xFF, 0x2D, 0x2C, 0xFF, 0x8E, 0x34, 0xFF, 0xCE, 0x3C, 0xFF, 0xAE, 0x3C, 0xFF, 0x74, 0x6E, 0xFF, 0x12, 0x66, 0xFF, 0x71, 0x65, 0xFF, 0x99, 0x97, 0xFF, 0x16, 0x8F, 0xFF, 0xB4, 0x86, 0xFF, 0xD2, 0x6D, 0xFF, 0xD2, 0x6D, 0xFF, 0x54, 0x86, 0xFF, 0xB1, 0x7D, 0xFF, 0x71, 0x6D, 0xFF, 0x30, 0x5D, 0xFF, 0x8E, 0x44, 0xFF, 0x8E, 0x44, 0xFF, 0x51, 0x65, 0xFF, 0x6E, 0x3C, 0xFF, 0xAF, 0x3C, 0xFF, 0x8E, 0x34, 0xFF, 0x51, 0x3D, 0xFF, 0x51, 0x2D, 0xFF, 0x0D, 0x24, 0xFF, 0xF0, 0x2C, 0xFF, 0x92, 0x3D, 0xFF, 0x54, 0x3E, 0xFF, 0x11, 0x2D, 0xFF, 0xAE, 0x2C, 0xFF, 0xAE, 0x24, 0xFF, 0x4E, 0x24, 0xFF, 0x6E, 0x24, 0xFF, 0x46, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xAC, 0x13, 0xFF, 0xE8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x49, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xAA, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0xCA, 0x03, 0xFF,
-    0x2C, 0x04, 0xFF, 0x55, 0x26, 0xFF, 0x2D, 0x04, 0xFF, 0x55, 0x36, 0xFF, 0x13, 0x26, 0xFF, 0xB2, 0x05, 0xFF, 0x35, 0x06, 0xFF, 0xF5, 0x0E, 0xFF, 0xF5, 0x0E, 0xFF, 0xFC, 0x1F, 0xFF, 0x75, 0x16, 0xFF, 0x12, 0x06, 0xFF, 0xF3, 0x05, 0xFF, 0x10, 0x05, 0xFF, 0x10, 0x05, 0xFF, 0x2E, 0x04, 0xFF, 0x0D, 0x04, 0xFF, 0x93, 0x0D, 0xFF, 0x11, 0x0D, 0xFF, 0x8F, 0x1C, 0xFF, 0x2F, 0x04, 0xFF, 0x6D, 0x1C, 0xFF, 0x2F, 0x0C, 0xFF, 0x0A, 0x0B, 0xFF, 0x94, 0x0D, 0xFF, 0xAC, 0x13, 0xFF, 0xF3, 0x5D, 0xFF, 0xED, 0x0B, 0xFF, 0xF0, 0x1C, 0xFF, 0x6A, 0x13, 0xFF, 0xDD, 0xBF, 0xFF, 0x6E, 0x24, 0xFF, 0x55, 0x4E, 0xFF, 0xAD, 0x44, 0xFF, 0x33, 0x76, 0xFF, 0xDA, 0xA7, 0xFF, 0xDA, 0x87, 0xFF, 0xFC, 0x97, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xA6, 0xFF, 0x79, 0xAF, 0xFF, 0xFA, 0xD7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFC, 0xDF, 0xFF, 0xD6, 0x86, 0xFF, 0x72, 0x65, 0xFF, 0x51, 0x55, 0xFF, 0xB9, 0xA7, 0xFF, 0xEF, 0x3C, 0xFF, 0x72, 0x3D, 0xFF, 0x8D, 0x34, 0xFF, 0x30, 0x35, 0xFF, 0xB3, 0x2D, 0xFF, 0xCC, 0x1B, 0xFF, 0x2D, 0x1C, 0xFF, 0x72, 0x45, 0xFF, 0xF0, 0x2C, 0xFF, 0xF0, 0x24, 0xFF, 0x6E, 0x2C, 0xFF, 0xCF, 0x24, 0xFF, 0x4C, 0x24, 0xFF, 0x90, 0x24, 0xFF,
-    0xA8, 0x02, 0xFF, 0x4C, 0x04, 0xFF, 0xE5, 0x01, 0xFF, 0xAE, 0x14, 0xFF, 0x8A, 0x03, 0xFF, 0xEB, 0x03, 0xFF, 0xEF, 0x04, 0xFF, 0x87, 0x02, 0xFF, 0xAE, 0x04, 0xFF, 0xAB, 0x03, 0xFF, 0xC7, 0x02, 0xFF, 0xF3, 0x0D, 0xFF, 0x0B, 0x04, 0xFF, 0x08, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x0F, 0x05, 0xFF, 0x2C, 0x04, 0xFF, 0x71, 0x05, 0xFF, 0x71, 0x0D, 0xFF, 0x33, 0x06, 0xFF, 0xF2, 0x05, 0xFF, 0xF3, 0x0D, 0xFF, 0x33, 0x16, 0xFF, 0x71, 0x15, 0xFF, 0xD2, 0x05, 0xFF, 0xB2, 0x05, 0xFF, 0x33, 0x0E, 0xFF, 0xAF, 0x04, 0xFF, 0x2C, 0x04, 0xFF, 0x0F, 0x0D, 0xFF, 0xF3, 0x05, 0xFF, 0x93, 0x2D, 0xFF, 0x4E, 0x0C, 0xFF, 0xEE, 0x03, 0xFF, 0x31, 0x15, 0xFF, 0x56, 0x16, 0xFF, 0xAF, 0x24, 0xFF, 0x0E, 0x0C, 0xFF, 0xC9, 0x02, 0xFF, 0x2D, 0x0C, 0xFF, 0x55, 0x26, 0xFF, 0x50, 0x3D, 0xFF, 0x8B, 0x03, 0xFF, 0x0C, 0x14, 0xFF, 0x92, 0x45, 0xFF, 0x94, 0x56, 0xFF, 0xD5, 0x5E, 0xFF, 0xEF, 0x34, 0xFF, 0xAE, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x6D, 0xFF, 0x34, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x65, 0xFF,
-    0x8F, 0x4C, 0xFF, 0xD6, 0x76, 0xFF, 0xEF, 0x44, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x2B, 0xFF, 0x30, 0x2D, 0xFF, 0x71, 0x3D, 0xFF, 0xCC, 0x23, 0xFF, 0x71, 0x45, 0xFF, 0xCC, 0x23, 0xFF, 0xAF, 0x24, 0xFF, 0xD0, 0x2C, 0xFF, 0x0D, 0x24, 0xFF, 0x51, 0x3D, 0xFF, 0x10, 0x35, 0xFF, 0xAC, 0x13, 0xFF, 0x46, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x4D, 0x2C, 0xFF, 0xE8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x08, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x49, 0x03, 0xFF, 0xC7, 0x02, 0xFF, 0x6E, 0x1C, 0xFF, 0x6A, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0x8E, 0x14, 0xFF, 0xCB, 0x03, 0xFF, 0x4D, 0x04, 0xFF, 0x4D, 0x04, 0xFF, 0xCB, 0x03, 0xFF, 0x2D, 0x04, 0xFF, 0x6E, 0x0C, 0xFF, 0x14, 0x36, 0xFF, 0x2D, 0x04, 0xFF, 0xD0, 0x14, 0xFF, 0x4E, 0x04, 0xFF, 0xF0, 0x1C, 0xFF, 0x0D, 0x04, 0xFF, 0x8B, 0x03, 0xFF, 0xB0, 0x1C, 0xFF, 0xD4, 0x35, 0xFF, 0x4E, 0x0C, 0xFF, 0x0D, 0x14, 0xFF, 0x8F, 0x0C, 0xFF, 0x4E, 0x1C, 0xFF, 0xED, 0x0B, 0xFF, 0xCD, 0x13, 0xFF, 0xCD, 0x0B, 0xFF, 0x09, 0x03, 0xFF, 0x0C, 0x1C, 0xFF, 0xCC, 0x1B, 0xFF, 0xAB, 0x13, 0xFF, 0x8E, 0x2C, 0xFF, 0x6D, 0x2C, 0xFF, 0x8E, 0x34, 0xFF,
-    0x0F, 0x3D, 0xFF, 0x50, 0x4D, 0xFF, 0x70, 0x45, 0xFF, 0xD5, 0x7E, 0xFF, 0xB5, 0x6E, 0xFF, 0xD2, 0x65, 0xFF, 0xF9, 0xA7, 0xFF, 0xB7, 0xAF, 0xFF, 0x77, 0xB7, 0xFF, 0x94, 0x96, 0xFF, 0xF2, 0x75, 0xFF, 0x53, 0x8E, 0xFF, 0xF2, 0x8D, 0xFF, 0xB1, 0x85, 0xFF, 0x91, 0x75, 0xFF, 0xEF, 0x54, 0xFF, 0x8E, 0x44, 0xFF, 0x6D, 0x44, 0xFF, 0x71, 0x4D, 0xFF, 0xEF, 0x3C, 0xFF, 0x30, 0x45, 0xFF, 0x91, 0x2D, 0xFF, 0xB2, 0x3D, 0xFF, 0x30, 0x3D, 0xFF, 0xB2, 0x3D, 0xFF, 0x10, 0x35, 0xFF, 0x54, 0x46, 0xFF, 0x10, 0x2D, 0xFF, 0x6E, 0x2C, 0xFF, 0xAF, 0x2C, 0xFF, 0xEC, 0x1B, 0xFF, 0x2D, 0x24, 0xFF, 0x67, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x8B, 0x13, 0xFF, 0xCF, 0x3C, 0xFF, 0xE8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x4A, 0x0B, 0xFF, 0xE8, 0x02, 0xFF, 0x49, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x0C, 0x04, 0xFF, 0x69, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xB2, 0x35, 0xFF, 0xAF, 0x0C, 0xFF, 0x0C, 0x04, 0xFF, 0xEB, 0x03, 0xFF, 0xAF, 0x0C, 0xFF, 0xED, 0x03, 0xFF, 0x8F, 0x0C, 0xFF, 0x30, 0x0D, 0xFF, 0xCC, 0x03, 0xFF, 0x0D, 0x04, 0xFF, 0xAF, 0x14, 0xFF,
-    0x11, 0x2D, 0xFF, 0xEE, 0x03, 0xFF, 0xB0, 0x04, 0xFF, 0xF1, 0x34, 0xFF, 0x0D, 0x04, 0xFF, 0x8F, 0x2C, 0xFF, 0xED, 0x0B, 0xFF, 0xCD, 0x0B, 0xFF, 0xF2, 0x0C, 0xFF, 0x2A, 0x03, 0xFF, 0xAB, 0x13, 0xFF, 0x8B, 0x0B, 0xFF, 0xCC, 0x13, 0xFF, 0xAF, 0x34, 0xFF, 0x50, 0x2D, 0xFF, 0x6D, 0x24, 0xFF, 0xCF, 0x3C, 0xFF, 0xDE, 0xCF, 0xFF, 0x34, 0x56, 0xFF, 0xF5, 0x66, 0xFF, 0xFF, 0xF7, 0xFF, 0xFE, 0xA7, 0xFF, 0xF5, 0x76, 0xFF, 0xFE, 0xCF, 0xFF, 0xFF, 0xB7, 0xFF, 0x33, 0x6E, 0xFF, 0xF2, 0x65, 0xFF, 0xF2, 0x5D, 0xFF, 0xD6, 0x7E, 0xFF, 0xD2, 0x6D, 0xFF, 0x94, 0x56, 0xFF, 0xF6, 0x5E, 0xFF, 0x71, 0x55, 0xFF, 0x4D, 0x3C, 0xFF, 0x51, 0x4D, 0xFF, 0x51, 0x3D, 0xFF, 0x10, 0x3D, 0xFF, 0x10, 0x2D, 0xFF, 0x90, 0x35, 0xFF, 0xB1, 0x45, 0xFF, 0x50, 0x35, 0xFF, 0x2F, 0x25, 0xFF, 0x71, 0x3D, 0xFF, 0x50, 0x2D, 0xFF, 0xF0, 0x34, 0xFF, 0x10, 0x35, 0xFF, 0x0D, 0x1C, 0xFF, 0xCC, 0x1B, 0xFF, 0x88, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x4A, 0x0B, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x6E, 0x1C, 0xFF, 0x4D, 0x1C, 0xFF, 0x6A, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x0F, 0x15, 0xFF,
-    0x2D, 0x0C, 0xFF, 0x6A, 0x03, 0xFF, 0xEF, 0x04, 0xFF, 0x28, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x2D, 0x04, 0xFF, 0x31, 0x0D, 0xFF, 0x0C, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0x33, 0x26, 0xFF, 0xD3, 0x0D, 0xFF, 0xAC, 0x03, 0xFF, 0x8E, 0x14, 0xFF, 0x6B, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xB3, 0x3D, 0xFF, 0x72, 0x0D, 0xFF, 0xCC, 0x03, 0xFF, 0x8F, 0x2C, 0xFF, 0x0D, 0x04, 0xFF, 0x0D, 0x24, 0xFF, 0xAC, 0x1B, 0xFF, 0xCD, 0x0B, 0xFF, 0xAC, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0xAB, 0x1B, 0xFF, 0xAB, 0x13, 0xFF, 0x10, 0x25, 0xFF, 0x6E, 0x2C, 0xFF, 0x93, 0x55, 0xFF, 0x2D, 0x24, 0xFF, 0x92, 0x35, 0xFF, 0xCF, 0x3C, 0xFF, 0xF0, 0x44, 0xFF, 0x33, 0x5E, 0xFF, 0x33, 0x4E, 0xFF, 0xD2, 0x65, 0xFF, 0x53, 0x86, 0xFF, 0x54, 0x6E, 0xFF, 0x54, 0x66, 0xFF, 0x71, 0x65, 0xFF, 0xD2, 0x6D, 0xFF, 0x71, 0x65, 0xFF, 0xF3, 0x65, 0xFF, 0xEF, 0x54, 0xFF, 0x6D, 0x44, 0xFF, 0x6E, 0x3C, 0xFF, 0x4E, 0x44, 0xFF, 0x4D, 0x34, 0xFF, 0x52, 0x4D, 0xFF, 0xB3, 0x45, 0xFF, 0x8F, 0x44, 0xFF, 0x10, 0x35, 0xFF, 0xF0, 0x24, 0xFF, 0x51, 0x45, 0xFF, 0x30, 0x2D, 0xFF, 0x2D, 0x24, 0xFF, 0xCF, 0x2C, 0xFF, 0xD0, 0x2C, 0xFF, 0x0D, 0x24, 0xFF, 0x2E, 0x24, 0xFF, 0x4D, 0x24, 0xFF, 0x2E, 0x24, 0xFF,
-    0x47, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x2C, 0x04, 0xFF, 0x4D, 0x14, 0xFF, 0x09, 0x03, 0xFF, 0xCB, 0x0B, 0xFF, 0x4D, 0x0C, 0xFF, 0xE8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x70, 0x05, 0xFF, 0x4D, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xCF, 0x14, 0xFF, 0x49, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x71, 0x05, 0xFF, 0xCA, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0x0C, 0x04, 0xFF, 0x71, 0x05, 0xFF, 0x4D, 0x04, 0xFF, 0x49, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x0F, 0x25, 0xFF, 0xCB, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0x4D, 0x14, 0xFF, 0xB3, 0x15, 0xFF, 0x0D, 0x14, 0xFF, 0xE9, 0x0A, 0xFF, 0xAD, 0x0B, 0xFF, 0x2E, 0x14, 0xFF, 0x4E, 0x14, 0xFF, 0xAB, 0x0B, 0xFF, 0x8C, 0x13, 0xFF, 0x2D, 0x24, 0xFF, 0xF3, 0x25, 0xFF, 0x10, 0x3D, 0xFF, 0x2D, 0x24, 0xFF, 0x8E, 0x2C, 0xFF, 0xB2, 0x3D, 0xFF, 0xFF, 0xE7, 0xFF, 0x94, 0x7E, 0xFF, 0xAF, 0x44, 0xFF, 0x0F, 0x4D, 0xFF, 0xFE, 0xD7, 0xFF, 0xFD, 0xF7, 0xFF, 0x33, 0x96, 0xFF, 0xB3, 0x75, 0xFF, 0x70, 0x55, 0xFF, 0x16, 0x9F, 0xFF, 0x74, 0x96, 0xFF, 0x50, 0x75, 0xFF, 0xCE, 0x54, 0xFF, 0x71, 0x55, 0xFF,
-    0xB1, 0x45, 0xFF, 0x0C, 0x3C, 0xFF, 0x6D, 0x34, 0xFF, 0x10, 0x35, 0xFF, 0x6E, 0x34, 0xFF, 0x31, 0x35, 0xFF, 0xB0, 0x24, 0xFF, 0x11, 0x3D, 0xFF, 0x2D, 0x24, 0xFF, 0xAB, 0x0B, 0xFF, 0xF0, 0x3C, 0xFF, 0xB0, 0x24, 0xFF, 0x4A, 0x13, 0xFF, 0x8F, 0x24, 0xFF, 0xEC, 0x1B, 0xFF, 0x4E, 0x1C, 0xFF, 0x46, 0x02, 0xFF, 0xAD, 0x0C, 0xFF, 0x88, 0x02, 0xFF, 0xCB, 0x03, 0xFF, 0x47, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xCB, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0xA7, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x2F, 0x05, 0xFF, 0xEC, 0x0B, 0xFF, 0xAB, 0x03, 0xFF, 0x0C, 0x04, 0xFF, 0x49, 0x03, 0xFF, 0x50, 0x05, 0xFF, 0x4C, 0x04, 0xFF, 0x8A, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x91, 0x05, 0xFF, 0xEC, 0x03, 0xFF, 0x0D, 0x0C, 0xFF, 0x4A, 0x03, 0xFF, 0xF2, 0x1D, 0xFF, 0xB1, 0x05, 0xFF, 0xEC, 0x0B, 0xFF, 0xAB, 0x03, 0xFF, 0x4E, 0x04, 0xFF, 0x8B, 0x0B, 0xFF, 0x34, 0x16, 0xFF, 0x8B, 0x03, 0xFF, 0xE9, 0x0A, 0xFF, 0xAC, 0x0B, 0xFF, 0xCF, 0x14, 0xFF, 0x54, 0x1E, 0xFF, 0xEC, 0x13, 0xFF, 0x6B, 0x03, 0xFF, 0x6E, 0x2C, 0xFF, 0x8E, 0x1C, 0xFF, 0x94, 0x36, 0xFF, 0x2D, 0x24, 0xFF,
-    0x2D, 0x24, 0xFF, 0xDC, 0x8F, 0xFF, 0x13, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xD3, 0x5D, 0xFF, 0x17, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x75, 0xFF, 0xAE, 0x44, 0xFF, 0x16, 0x77, 0xFF, 0x53, 0xA6, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x44, 0xFF, 0x4D, 0x3C, 0xFF, 0x6E, 0x44, 0xFF, 0xCF, 0x3C, 0xFF, 0x53, 0x66, 0xFF, 0x0C, 0x34, 0xFF, 0xCF, 0x2C, 0xFF, 0x10, 0x2D, 0xFF, 0xAF, 0x34, 0xFF, 0x13, 0x56, 0xFF, 0x6E, 0x2C, 0xFF, 0xD2, 0x3D, 0xFF, 0x2D, 0x14, 0xFF, 0xCB, 0x23, 0xFF, 0x2F, 0x2D, 0xFF, 0x2A, 0x13, 0xFF, 0x0C, 0x1C, 0xFF, 0x87, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x4C, 0x04, 0xFF, 0x09, 0x0B, 0xFF, 0xA8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x09, 0x0B, 0xFF, 0xEF, 0x1C, 0xFF, 0x87, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x4D, 0x14, 0xFF, 0x6D, 0x0C, 0xFF, 0x8E, 0x14, 0xFF, 0x4D, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x2D, 0x04, 0xFF, 0x49, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0xAE, 0x04, 0xFF, 0x8A, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x6D, 0x04, 0xFF, 0xCC, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x30, 0x05, 0xFF, 0xAB, 0x03, 0xFF,
-    0x09, 0x03, 0xFF, 0x8E, 0x0C, 0xFF, 0xAB, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x0D, 0x0C, 0xFF, 0x8A, 0x03, 0xFF, 0xC9, 0x02, 0xFF, 0x8C, 0x0B, 0xFF, 0x2D, 0x0C, 0xFF, 0xE9, 0x0A, 0xFF, 0xEC, 0x13, 0xFF, 0xCC, 0x0B, 0xFF, 0xF0, 0x1C, 0xFF, 0x2D, 0x1C, 0xFF, 0x8F, 0x2C, 0xFF, 0x6E, 0x1C, 0xFF, 0x2D, 0x24, 0xFF, 0x6E, 0x2C, 0xFF, 0x4D, 0x24, 0xFF, 0x2F, 0x35, 0xFF, 0x2D, 0x34, 0xFF, 0xAF, 0x44, 0xFF, 0x30, 0x45, 0xFF, 0x30, 0x65, 0xFF, 0x50, 0x6D, 0xFF, 0x10, 0x55, 0xFF, 0x4C, 0x3C, 0xFF, 0x4C, 0x44, 0xFF, 0xCE, 0x54, 0xFF, 0x8D, 0x44, 0xFF, 0xAE, 0x44, 0xFF, 0x0C, 0x34, 0xFF, 0x0C, 0x2C, 0xFF, 0xAB, 0x23, 0xFF, 0x4C, 0x2C, 0xFF, 0x2C, 0x2C, 0xFF, 0xEC, 0x2B, 0xFF, 0xB0, 0x2C, 0xFF, 0xAF, 0x2C, 0xFF, 0xAF, 0x2C, 0xFF, 0x6F, 0x24, 0xFF, 0xED, 0x1B, 0xFF, 0x6E, 0x24, 0xFF, 0xED, 0x1B, 0xFF, 0xCC, 0x1B, 0xFF, 0x6F, 0x2C, 0xFF, 0x2D, 0x2C, 0xFF, 0xEC, 0x1B, 0xFF, 0x88, 0x0A, 0xFF, 0x47, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x08, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x8E, 0x14, 0xFF, 0xE8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x0C, 0x0C, 0xFF, 0x49, 0x03, 0xFF,
-    0x09, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x10, 0x05, 0xFF, 0xAB, 0x03, 0xFF, 0xCB, 0x0B, 0xFF, 0xAE, 0x0C, 0xFF, 0xEF, 0x1C, 0xFF, 0x8E, 0x0C, 0xFF, 0xAB, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x71, 0x15, 0xFF, 0x0C, 0x0C, 0xFF, 0x8B, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0xF0, 0x14, 0xFF, 0x8B, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x0C, 0x0C, 0xFF, 0xAB, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0xAB, 0x03, 0xFF, 0x2E, 0x0C, 0xFF, 0x4A, 0x03, 0xFF, 0xEC, 0x0B, 0xFF, 0x8B, 0x03, 0xFF, 0xF0, 0x1C, 0xFF, 0x6E, 0x1C, 0xFF, 0xEF, 0x2C, 0xFF, 0xEC, 0x13, 0xFF, 0xB2, 0x35, 0xFF, 0x10, 0x2D, 0xFF, 0x4E, 0x2C, 0xFF, 0xAE, 0x34, 0xFF, 0xD3, 0x3D, 0xFF, 0x0F, 0x45, 0xFF, 0x30, 0x3D, 0xFF, 0xAE, 0x3C, 0xFF, 0xD2, 0x4D, 0xFF, 0xEF, 0x44, 0xFF, 0x4C, 0x3C, 0xFF, 0x4D, 0x34, 0xFF, 0x0F, 0x45, 0xFF, 0x6D, 0x3C, 0xFF, 0x0B, 0x34, 0xFF, 0xEB, 0x33, 0xFF, 0xCB, 0x2B, 0xFF, 0xEB, 0x2B, 0xFF, 0x0C, 0x2C, 0xFF, 0xCF, 0x34, 0xFF, 0xCB, 0x23, 0xFF, 0x4E, 0x24, 0xFF, 0x4E, 0x24, 0xFF, 0x4E, 0x2C, 0xFF, 0x4E, 0x24, 0xFF, 0x4E, 0x2C, 0xFF, 0x0D, 0x24, 0xFF, 0xCC, 0x13, 0xFF, 0x2E, 0x24, 0xFF, 0x2D, 0x24, 0xFF, 0x2A, 0x13, 0xFF, 0xCB, 0x1B, 0xFF,
-    0x07, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x2D, 0x24, 0xFF, 0x2B, 0x04, 0xFF, 0xCB, 0x0B, 0xFF, 0xA8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x2C, 0x04, 0xFF, 0xCB, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x4D, 0x14, 0xFF, 0x8A, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0xCE, 0x0C, 0xFF, 0x09, 0x03, 0xFF, 0xCC, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x10, 0x05, 0xFF, 0xAB, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0x08, 0x03, 0xFF, 0xEC, 0x0B, 0xFF, 0xAE, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x8E, 0x04, 0xFF, 0x29, 0x03, 0xFF, 0x51, 0x0D, 0xFF, 0x2C, 0x0C, 0xFF, 0x6B, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x8F, 0x14, 0xFF, 0x4A, 0x03, 0xFF, 0x0C, 0x0C, 0xFF, 0x8B, 0x03, 0xFF, 0xEC, 0x0B, 0xFF, 0xF3, 0x1D, 0xFF, 0xAE, 0x1C, 0xFF, 0x4D, 0x1C, 0xFF, 0x4D, 0x1C, 0xFF, 0x12, 0x2E, 0xFF, 0x2D, 0x24, 0xFF, 0xAE, 0x2C, 0xFF, 0x91, 0x25, 0xFF, 0xB1, 0x35, 0xFF, 0xCE, 0x34, 0xFF, 0x6D, 0x2C, 0xFF, 0x6D, 0x2C, 0xFF, 0xCE, 0x3C, 0xFF, 0x2F, 0x35, 0xFF, 0x50, 0x45, 0xFF, 0xAE, 0x44, 0xFF, 0x0C, 0x34, 0xFF, 0x0F, 0x35, 0xFF, 0x2C, 0x24, 0xFF,
-    0xEC, 0x2B, 0xFF, 0xEB, 0x2B, 0xFF, 0x30, 0x35, 0xFF, 0x70, 0x2D, 0xFF, 0x8A, 0x1B, 0xFF, 0x6E, 0x24, 0xFF, 0x2D, 0x1C, 0xFF, 0x0C, 0x24, 0xFF, 0xCC, 0x1B, 0xFF, 0x6E, 0x2C, 0xFF, 0xED, 0x1B, 0xFF, 0x2D, 0x1C, 0xFF, 0x0D, 0x1C, 0xFF, 0x0D, 0x1C, 0xFF, 0xE8, 0x0A, 0xFF, 0xCC, 0x1B, 0xFF, 0x68, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0xAB, 0x03, 0xFF, 0x0C, 0x14, 0xFF, 0x87, 0x02, 0xFF, 0xEE, 0x04, 0xFF, 0x67, 0x02, 0xFF, 0x6A, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x51, 0x05, 0xFF, 0x29, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x0D, 0x0C, 0xFF, 0xE8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x0F, 0x05, 0xFF, 0xCB, 0x03, 0xFF, 0x0C, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x92, 0x0D, 0xFF, 0x8A, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0xCE, 0x0C, 0xFF, 0xEC, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x89, 0x03, 0xFF, 0xB2, 0x05, 0xFF, 0xEF, 0x1C, 0xFF, 0x6B, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x8E, 0x0C, 0xFF, 0x73, 0x26, 0xFF, 0x2C, 0x0C, 0xFF, 0x4A, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x59, 0x17, 0xFF, 0xAE, 0x0C, 0xFF, 0x30, 0x1D, 0xFF,
-    0x4D, 0x14, 0xFF, 0x2C, 0x14, 0xFF, 0xFE, 0x5F, 0xFF, 0x6C, 0x0C, 0xFF, 0x2C, 0x1C, 0xFF, 0xCE, 0x2C, 0xFF, 0x0F, 0x2D, 0xFF, 0x2F, 0x1D, 0xFF, 0x4C, 0x2C, 0xFF, 0x8D, 0x24, 0xFF, 0x2C, 0x2C, 0xFF, 0x32, 0x3E, 0xFF, 0x8D, 0x24, 0xFF, 0xCB, 0x23, 0xFF, 0xCB, 0x23, 0xFF, 0xCB, 0x23, 0xFF, 0x70, 0x35, 0xFF, 0xCE, 0x24, 0xFF, 0xCB, 0x23, 0xFF, 0xCB, 0x1B, 0xFF, 0x69, 0x0B, 0xFF, 0x30, 0x2D, 0xFF, 0x30, 0x2D, 0xFF, 0x4D, 0x2C, 0xFF, 0xAF, 0x24, 0xFF, 0xEF, 0x2C, 0xFF, 0xAB, 0x23, 0xFF, 0x51, 0x2D, 0xFF, 0xAB, 0x1B, 0xFF, 0x0C, 0x1C, 0xFF, 0x6A, 0x13, 0xFF, 0x0C, 0x1C, 0xFF, 0xE6, 0x01, 0xFF, 0x8B, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x08, 0x03, 0xFF, 0x66, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x4D, 0x04, 0xFF, 0x2C, 0x0C, 0xFF, 0x67, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xCE, 0x04, 0xFF, 0xA8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x6D, 0x04, 0xFF, 0xC8, 0x02, 0xFF, 0x70, 0x05, 0xFF, 0x09, 0x03, 0xFF, 0xEF, 0x14, 0xFF, 0xE9, 0x02, 0xFF, 0xCC, 0x0B, 0xFF, 0xB1, 0x05, 0xFF, 0xEB, 0x0B, 0xFF, 0x8E, 0x14, 0xFF, 0xCB, 0x03, 0xFF, 0xAE, 0x14, 0xFF, 0xD2, 0x0D, 0xFF,
-    0x8B, 0x03, 0xFF, 0xEF, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xB4, 0x0E, 0xFF, 0x10, 0x1D, 0xFF, 0x6A, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0x4D, 0x04, 0xFF, 0x50, 0x05, 0xFF, 0x2C, 0x0C, 0xFF, 0x6A, 0x03, 0xFF, 0x31, 0x0D, 0xFF, 0xCB, 0x03, 0xFF, 0xFA, 0x1F, 0xFF, 0x50, 0x25, 0xFF, 0x6D, 0x0C, 0xFF, 0x8E, 0x1C, 0xFF, 0x4C, 0x0C, 0xFF, 0xD8, 0x3F, 0xFF, 0x4D, 0x1C, 0xFF, 0x6D, 0x24, 0xFF, 0xEE, 0x24, 0xFF, 0x12, 0x4E, 0xFF, 0xFA, 0x4F, 0xFF, 0x4C, 0x24, 0xFF, 0x4D, 0x24, 0xFF, 0xEB, 0x23, 0xFF, 0x2B, 0x1C, 0xFF, 0xD4, 0x56, 0xFF, 0x0F, 0x35, 0xFF, 0xAB, 0x23, 0xFF, 0x8A, 0x1B, 0xFF, 0xAA, 0x1B, 0xFF, 0x0F, 0x35, 0xFF, 0xF1, 0x3D, 0xFF, 0xAA, 0x13, 0xFF, 0x0D, 0x1C, 0xFF, 0x2D, 0x24, 0xFF, 0xAA, 0x13, 0xFF, 0xEF, 0x24, 0xFF, 0xEC, 0x1B, 0xFF, 0xCB, 0x13, 0xFF, 0x2C, 0x1C, 0xFF, 0xEC, 0x1B, 0xFF, 0x50, 0x2D, 0xFF, 0xEC, 0x1B, 0xFF, 0xEC, 0x1B, 0xFF, 0x88, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x05, 0x02, 0xFF, 0xCD, 0x04, 0xFF, 0x2C, 0x04, 0xFF, 0x05, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x49, 0x03, 0xFF, 0x0F, 0x05, 0xFF, 0x66, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x4A, 0x0B, 0xFF, 0x0F, 0x05, 0xFF,
-    0xE9, 0x02, 0xFF, 0x4D, 0x0C, 0xFF, 0x09, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x6E, 0x04, 0xFF, 0x49, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x2F, 0x1D, 0xFF, 0x4A, 0x03, 0xFF, 0xD5, 0x3E, 0xFF, 0xEC, 0x03, 0xFF, 0x30, 0x0D, 0xFF, 0x34, 0x3E, 0xFF, 0x4D, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x6D, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0xEB, 0x03, 0xFF, 0x8E, 0x0C, 0xFF, 0x6A, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0xAF, 0x04, 0xFF, 0x50, 0x15, 0xFF, 0xCE, 0x14, 0xFF, 0xCB, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0x33, 0x2E, 0xFF, 0xCE, 0x04, 0xFF, 0xAD, 0x14, 0xFF, 0xAE, 0x04, 0xFF, 0x91, 0x15, 0xFF, 0xCE, 0x14, 0xFF, 0xCE, 0x0C, 0xFF, 0x2F, 0x0D, 0xFF, 0x6D, 0x14, 0xFF, 0xCE, 0x1C, 0xFF, 0xAD, 0x14, 0xFF, 0xAD, 0x14, 0xFF, 0x90, 0x3D, 0xFF, 0x0C, 0x1C, 0xFF, 0xCB, 0x13, 0xFF, 0xEB, 0x1B, 0xFF, 0x0B, 0x1C, 0xFF, 0xAB, 0x1B, 0xFF, 0x8A, 0x1B, 0xFF, 0x69, 0x13, 0xFF, 0x8A, 0x1B, 0xFF, 0xCB, 0x1B, 0xFF, 0x8A, 0x13, 0xFF, 0x6A, 0x0B, 0xFF, 0xEC, 0x1B, 0xFF, 0x0C, 0x1C, 0xFF, 0x6A, 0x0B, 0xFF, 0x0C, 0x1C, 0xFF, 0x4D, 0x24, 0xFF, 0x8B, 0x13, 0xFF, 0xEC, 0x13, 0xFF, 0xCB, 0x1B, 0xFF, 0x0C, 0x1C, 0xFF, 0x6A, 0x0B, 0xFF, 0xCB, 0x1B, 0xFF,
-    0x07, 0x02, 0xFF, 0xF0, 0x24, 0xFF, 0x27, 0x02, 0xFF, 0x67, 0x0A, 0xFF, 0x47, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0xEB, 0x0B, 0xFF, 0x67, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x0C, 0x14, 0xFF, 0x2A, 0x03, 0xFF, 0xE9, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0xA8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xEB, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x6D, 0x0C, 0xFF, 0x2D, 0x0C, 0xFF, 0xE8, 0x02, 0xFF, 0x8E, 0x24, 0xFF, 0x50, 0x05, 0xFF, 0x8A, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xB2, 0x2D, 0xFF, 0xCF, 0x04, 0xFF, 0x49, 0x03, 0xFF, 0x4D, 0x14, 0xFF, 0x29, 0x03, 0xFF, 0xAE, 0x0C, 0xFF, 0x4C, 0x04, 0xFF, 0x4D, 0x04, 0xFF, 0x6D, 0x14, 0xFF, 0x2C, 0x04, 0xFF, 0xAE, 0x04, 0xFF, 0x6A, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x8F, 0x04, 0xFF, 0x8E, 0x14, 0xFF, 0xF2, 0x1D, 0xFF, 0x0C, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0xB8, 0x0F, 0xFF, 0x70, 0x05, 0xFF, 0x91, 0x0D, 0xFF, 0x0F, 0x05, 0xFF, 0xFF, 0xD7, 0xFF, 0x32, 0x0E, 0xFF, 0xF1, 0x0D, 0xFF, 0xCE, 0x0C, 0xFF, 0xFE, 0x17, 0xFF, 0x2E, 0x15, 0xFF, 0xAD, 0x14, 0xFF, 0x4C, 0x0C, 0xFF, 0x0E, 0x05, 0xFF, 0xEB, 0x0B, 0xFF, 0xCA, 0x13, 0xFF, 0xC9, 0x03, 0xFF, 0xCB, 0x13, 0xFF, 0xAA, 0x13, 0xFF, 0x28, 0x03, 0xFF,
-    0x49, 0x13, 0xFF, 0x6A, 0x13, 0xFF, 0x2F, 0x25, 0xFF, 0xCB, 0x13, 0xFF, 0x69, 0x0B, 0xFF, 0xEB, 0x1B, 0xFF, 0xAE, 0x1C, 0xFF, 0x8A, 0x0B, 0xFF, 0xEC, 0x13, 0xFF, 0xAB, 0x13, 0xFF, 0x09, 0x03, 0xFF, 0x0C, 0x14, 0xFF, 0x8A, 0x0B, 0xFF, 0xCB, 0x1B, 0xFF, 0xAB, 0x13, 0xFF, 0xCB, 0x13, 0xFF, 0xEA, 0x0A, 0xFF, 0x2A, 0x0B, 0xFF, 0x47, 0x02, 0xFF, 0x92, 0x3D, 0xFF, 0x27, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0xD1, 0x3C, 0xFF, 0x67, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0x87, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x12, 0x26, 0xFF, 0xA8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xEC, 0x1B, 0xFF, 0x6D, 0x04, 0xFF, 0x0C, 0x04, 0xFF, 0xC8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xAE, 0x04, 0xFF, 0x09, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x10, 0x1D, 0xFF, 0x29, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xAE, 0x0C, 0xFF, 0x09, 0x03, 0xFF, 0x0F, 0x0D, 0xFF, 0x70, 0x15, 0xFF, 0xCF, 0x1C, 0xFF, 0xEF, 0x1C, 0xFF, 0x91, 0x05, 0xFF, 0xEF, 0x04, 0xFF, 0xAB, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0xB4, 0x16, 0xFF, 0x58, 0x37, 0xFF, 0x2C, 0x04, 0xFF, 0x91, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x05, 0xFF, 0xEF, 0x04, 0xFF,
-    0x2F, 0x05, 0xFF, 0x94, 0x06, 0xFF, 0xDE, 0x3F, 0xFF, 0x58, 0x0F, 0xFF, 0xEE, 0x04, 0xFF, 0xEE, 0x04, 0xFF, 0x9D, 0x8F, 0xFF, 0xB5, 0x26, 0xFF, 0x6C, 0x0C, 0xFF, 0x0E, 0x1D, 0xFF, 0x4C, 0x04, 0xFF, 0xF1, 0x1D, 0xFF, 0x0A, 0x04, 0xFF, 0x89, 0x03, 0xFF, 0x8A, 0x13, 0xFF, 0xEF, 0x24, 0xFF, 0x0F, 0x2D, 0xFF, 0xEF, 0x2C, 0xFF, 0x69, 0x0B, 0xFF, 0x8A, 0x03, 0xFF, 0x28, 0x03, 0xFF, 0x0C, 0x1C, 0xFF, 0xCB, 0x13, 0xFF, 0x29, 0x03, 0xFF, 0xAB, 0x13, 0xFF, 0x30, 0x25, 0xFF, 0xEC, 0x1B, 0xFF, 0xAB, 0x13, 0xFF, 0xAB, 0x13, 0xFF, 0xEC, 0x1B, 0xFF, 0x49, 0x0B, 0xFF, 0xCC, 0x13, 0xFF, 0xE6, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0x6A, 0x03, 0xFF, 0x4A, 0x0B, 0xFF, 0x05, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0xEB, 0x03, 0xFF, 0x66, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x8A, 0x03, 0xFF, 0x67, 0x02, 0xFF, 0x6D, 0x04, 0xFF, 0x95, 0x3E, 0xFF, 0x8B, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x89, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x50, 0x05, 0xFF, 0xAB, 0x13, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0xEF, 0x14, 0xFF, 0xCB, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x8A, 0x0B, 0xFF, 0x0F, 0x05, 0xFF,
-    0x4A, 0x03, 0xFF, 0x98, 0x37, 0xFF, 0xCB, 0x03, 0xFF, 0x75, 0x3E, 0xFF, 0x73, 0x06, 0xFF, 0x6D, 0x04, 0xFF, 0x8B, 0x03, 0xFF, 0xEB, 0x03, 0xFF, 0x4D, 0x04, 0xFF, 0xFB, 0x27, 0xFF, 0xF1, 0x15, 0xFF, 0x0B, 0x04, 0xFF, 0xD1, 0x05, 0xFF, 0xF2, 0x05, 0xFF, 0x73, 0x06, 0xFF, 0x2F, 0x05, 0xFF, 0x73, 0x0E, 0xFF, 0x11, 0x06, 0xFF, 0xFF, 0xE7, 0xFF, 0x56, 0x0F, 0xFF, 0x94, 0x16, 0xFF, 0xEE, 0x04, 0xFF, 0x73, 0x0E, 0xFF, 0xFF, 0x07, 0xFF, 0x70, 0x15, 0xFF, 0xB1, 0x2D, 0xFF, 0x0B, 0x04, 0xFF, 0xAE, 0x14, 0xFF, 0x6B, 0x04, 0xFF, 0x0B, 0x14, 0xFF, 0x6A, 0x0B, 0xFF, 0x48, 0x03, 0xFF, 0x28, 0x0B, 0xFF, 0x73, 0x1E, 0xFF, 0xD1, 0x3D, 0xFF, 0xAD, 0x14, 0xFF, 0xCE, 0x24, 0xFF, 0xAA, 0x0B, 0xFF, 0x70, 0x25, 0xFF, 0x6A, 0x0B, 0xFF, 0x4D, 0x1C, 0xFF, 0xAA, 0x0B, 0xFF, 0x0C, 0x1C, 0xFF, 0x6D, 0x1C, 0xFF, 0xEC, 0x1B, 0xFF, 0x8B, 0x13, 0xFF, 0xCB, 0x13, 0xFF, 0x6A, 0x0B, 0xFF, 0xE6, 0x01, 0xFF, 0xAC, 0x0B, 0xFF, 0x4A, 0x03, 0xFF, 0x27, 0x02, 0xFF, 0x07, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x4D, 0x04, 0xFF, 0xA8, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xA4, 0x01, 0xFF, 0xCC, 0x03, 0xFF, 0x6D, 0x0C, 0xFF, 0x05, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x09, 0x03, 0xFF,
-    0xEE, 0x04, 0xFF, 0x88, 0x02, 0xFF, 0x6A, 0x03, 0xFF, 0x25, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0xAE, 0x04, 0xFF, 0xA7, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xEF, 0x0C, 0xFF, 0xC8, 0x02, 0xFF, 0x8D, 0x0C, 0xFF, 0xE9, 0x02, 0xFF, 0x49, 0x03, 0xFF, 0x0B, 0x04, 0xFF, 0x34, 0x1E, 0xFF, 0x8A, 0x03, 0xFF, 0x2F, 0x0D, 0xFF, 0x0C, 0x04, 0xFF, 0x96, 0x2E, 0xFF, 0x94, 0x06, 0xFF, 0xEF, 0x04, 0xFF, 0xAB, 0x03, 0xFF, 0xEC, 0x03, 0xFF, 0x4D, 0x04, 0xFF, 0x70, 0x05, 0xFF, 0x36, 0x17, 0xFF, 0x8E, 0x04, 0xFF, 0x12, 0x0E, 0xFF, 0x70, 0x05, 0xFF, 0xFF, 0x1F, 0xFF, 0x70, 0x05, 0xFF, 0xB4, 0x16, 0xFF, 0xF1, 0x05, 0xFF, 0x12, 0x06, 0xFF, 0xFD, 0x0F, 0xFF, 0x95, 0x1E, 0xFF, 0xB1, 0x0D, 0xFF, 0xD3, 0x06, 0xFF, 0x4F, 0x05, 0xFF, 0xFC, 0x0F, 0xFF, 0x32, 0x26, 0xFF, 0xEA, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0x0F, 0x1D, 0xFF, 0x0B, 0x04, 0xFF, 0x69, 0x0B, 0xFF, 0xAA, 0x0B, 0xFF, 0x0C, 0x14, 0xFF, 0x49, 0x03, 0xFF, 0x8E, 0x2C, 0xFF, 0xEA, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x6A, 0x0B, 0xFF, 0xAB, 0x0B, 0xFF, 0xAA, 0x03, 0xFF, 0x70, 0x2D, 0xFF, 0xAB, 0x0B, 0xFF, 0x8A, 0x13, 0xFF, 0xCB, 0x13, 0xFF, 0x6A, 0x0B, 0xFF, 0x8D, 0x1C, 0xFF, 0x4A, 0x0B, 0xFF, 0x8A, 0x13, 0xFF,
-    0xAB, 0x03, 0xFF, 0xE6, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0x8D, 0x04, 0xFF, 0x06, 0x02, 0xFF, 0x68, 0x02, 0xFF, 0x30, 0x2D, 0xFF, 0x87, 0x02, 0xFF, 0x8D, 0x04, 0xFF, 0x88, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0xAE, 0x04, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xE7, 0x02, 0xFF, 0x4F, 0x05, 0xFF, 0x67, 0x02, 0xFF, 0x86, 0x02, 0xFF, 0x6A, 0x03, 0xFF, 0x91, 0x15, 0xFF, 0x09, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x4C, 0x04, 0xFF, 0xAE, 0x04, 0xFF, 0x49, 0x03, 0xFF, 0x0B, 0x04, 0xFF, 0x89, 0x03, 0xFF, 0x6C, 0x04, 0xFF, 0x89, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0x50, 0x0D, 0xFF, 0x0B, 0x04, 0xFF, 0x10, 0x05, 0xFF, 0xAB, 0x03, 0xFF, 0x0C, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0x56, 0x07, 0xFF, 0x1A, 0x0F, 0xFF, 0xCE, 0x04, 0xFF, 0x56, 0x0E, 0xFF, 0xFF, 0x87, 0xFF, 0xBA, 0x0F, 0xFF, 0x73, 0x0E, 0xFF, 0xF1, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x06, 0xFF, 0xFD, 0x0F, 0xFF, 0xB1, 0x05, 0xFF, 0xFF, 0xF7, 0xFF, 0x73, 0x06, 0xFF, 0x32, 0x16, 0xFF, 0xEE, 0x04, 0xFF, 0x53, 0x06, 0xFF, 0x4C, 0x04, 0xFF, 0xCA, 0x03, 0xFF, 0x32, 0x26, 0xFF, 0x8D, 0x14, 0xFF, 0x69, 0x03, 0xFF, 0x69, 0x03, 0xFF,
-    0x6D, 0x14, 0xFF, 0x49, 0x03, 0xFF, 0xAD, 0x14, 0xFF, 0xCB, 0x13, 0xFF, 0x0C, 0x1C, 0xFF, 0xAB, 0x13, 0xFF, 0x6D, 0x14, 0xFF, 0x8A, 0x0B, 0xFF, 0x8B, 0x13, 0xFF, 0x8A, 0x13, 0xFF, 0x6A, 0x13, 0xFF, 0x0C, 0x14, 0xFF, 0x49, 0x0B, 0xFF, 0x8A, 0x0B, 0xFF, 0x6A, 0x13, 0xFF, 0x8A, 0x0B, 0xFF, 0xC6, 0x01, 0xFF, 0x07, 0x02, 0xFF, 0x07, 0x02, 0xFF, 0xE6, 0x01, 0xFF, 0x07, 0x02, 0xFF, 0x88, 0x0A, 0xFF, 0xC6, 0x01, 0xFF, 0x29, 0x0B, 0xFF, 0xAC, 0x13, 0xFF, 0xAF, 0x24, 0xFF, 0x46, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0x4A, 0x0B, 0xFF, 0xC4, 0x01, 0xFF, 0x46, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0x26, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0xEF, 0x14, 0xFF, 0xC8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x4D, 0x04, 0xFF, 0x8A, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0xEB, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xCA, 0x03, 0xFF, 0x0C, 0x14, 0xFF, 0x6A, 0x03, 0xFF, 0x0F, 0x0D, 0xFF, 0xEE, 0x04, 0xFF, 0x28, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0xB1, 0x05, 0xFF, 0xAF, 0x04, 0xFF, 0xCB, 0x03, 0xFF, 0x0C, 0x04, 0xFF, 0xB1, 0x15, 0xFF, 0x9C, 0x17, 0xFF, 0x9D, 0x0F, 0xFF, 0xEE, 0x04, 0xFF, 0xFB, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x0F, 0xFF, 0xD1, 0x05, 0xFF,
-    0xB4, 0x06, 0xFF, 0xFF, 0xA7, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x47, 0xFF, 0x12, 0x06, 0xFF, 0x93, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x0F, 0xFF, 0x0E, 0x05, 0xFF, 0x32, 0x16, 0xFF, 0x18, 0x07, 0xFF, 0x8C, 0x04, 0xFF, 0x59, 0x57, 0xFF, 0x91, 0x2D, 0xFF, 0xAD, 0x0C, 0xFF, 0x4F, 0x1D, 0xFF, 0x69, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x27, 0x03, 0xFF, 0x8D, 0x14, 0xFF, 0x69, 0x0B, 0xFF, 0x8A, 0x13, 0xFF, 0x29, 0x0B, 0xFF, 0x4D, 0x1C, 0xFF, 0x6A, 0x0B, 0xFF, 0x29, 0x03, 0xFF, 0xAB, 0x13, 0xFF, 0x8A, 0x0B, 0xFF, 0x6A, 0x0B, 0xFF, 0x8A, 0x0B, 0xFF, 0x8A, 0x13, 0xFF, 0x6A, 0x13, 0xFF, 0x07, 0x02, 0xFF, 0xE6, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0x07, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x07, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xAC, 0x1B, 0xFF, 0xE5, 0x01, 0xFF, 0x88, 0x02, 0xFF, 0xC9, 0x0A, 0xFF, 0x2A, 0x0B, 0xFF, 0x87, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x26, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x6A, 0x03, 0xFF, 0x87, 0x02, 0xFF, 0xAB, 0x13, 0xFF, 0x09, 0x03, 0xFF, 0x70, 0x15, 0xFF, 0x87, 0x02, 0xFF, 0x49, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0x13, 0x3E, 0xFF, 0x4C, 0x0C, 0xFF, 0x09, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x0C, 0x04, 0xFF,
-    0x90, 0x15, 0xFF, 0x4C, 0x04, 0xFF, 0x8A, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0xF2, 0x05, 0xFF, 0x8E, 0x04, 0xFF, 0xAB, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0x71, 0x05, 0xFF, 0xFF, 0xAF, 0xFF, 0x93, 0x06, 0xFF, 0x0F, 0x05, 0xFF, 0xF5, 0x06, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x07, 0xFF, 0x32, 0x06, 0xFF, 0xB4, 0x06, 0xFF, 0xFB, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xD5, 0x06, 0xFF, 0x12, 0x06, 0xFF, 0xFF, 0x87, 0xFF, 0x9E, 0x87, 0xFF, 0xD1, 0x05, 0xFF, 0x90, 0x0D, 0xFF, 0x8C, 0x04, 0xFF, 0x97, 0x07, 0xFF, 0x12, 0x1E, 0xFF, 0x50, 0x25, 0xFF, 0x49, 0x03, 0xFF, 0x6D, 0x0C, 0xFF, 0x2F, 0x0D, 0xFF, 0x49, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xEF, 0x1C, 0xFF, 0x6D, 0x14, 0xFF, 0x8A, 0x03, 0xFF, 0x8A, 0x0B, 0xFF, 0x49, 0x0B, 0xFF, 0x8A, 0x0B, 0xFF, 0x4C, 0x0C, 0xFF, 0x6A, 0x0B, 0xFF, 0x6A, 0x0B, 0xFF, 0x8B, 0x0B, 0xFF, 0x29, 0x0B, 0xFF, 0x49, 0x0B, 0xFF, 0x6A, 0x0B, 0xFF, 0xE6, 0x01, 0xFF, 0x07, 0x02, 0xFF, 0xC6, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0xC6, 0x01, 0xFF, 0x07, 0x02, 0xFF, 0x07, 0x02, 0xFF, 0xE6, 0x01, 0xFF, 0xCC, 0x13, 0xFF, 0x67, 0x0A, 0xFF, 0xC8, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xA8, 0x0A, 0xFF, 0xE9, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x26, 0x02, 0xFF,
-    0x26, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x09, 0x0B, 0xFF, 0xE9, 0x0A, 0xFF, 0xF7, 0x46, 0xFF, 0xC8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xAA, 0x03, 0xFF, 0xEB, 0x03, 0xFF, 0x4A, 0x03, 0xFF, 0xAD, 0x14, 0xFF, 0xE8, 0x02, 0xFF, 0x30, 0x05, 0xFF, 0x29, 0x03, 0xFF, 0x4D, 0x0C, 0xFF, 0x50, 0x25, 0xFF, 0x31, 0x0E, 0xFF, 0x12, 0x06, 0xFF, 0xAE, 0x04, 0xFF, 0xCB, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0xEE, 0x04, 0xFF, 0xBD, 0x17, 0xFF, 0xCF, 0x05, 0xFF, 0xD1, 0x05, 0xFF, 0x56, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x67, 0xFF, 0x15, 0x07, 0xFF, 0xB3, 0x06, 0xFF, 0xD9, 0x07, 0xFF, 0xFF, 0xB7, 0xFF, 0xDE, 0x07, 0xFF, 0x52, 0x06, 0xFF, 0x90, 0x05, 0xFF, 0x76, 0x07, 0xFF, 0xFF, 0x4F, 0xFF, 0xD1, 0x05, 0xFF, 0x90, 0x05, 0xFF, 0x2B, 0x04, 0xFF, 0x8D, 0x04, 0xFF, 0x14, 0x0F, 0xFF, 0x2B, 0x04, 0xFF, 0x49, 0x03, 0xFF, 0x28, 0x03, 0xFF, 0xCA, 0x03, 0xFF, 0xB0, 0x05, 0xFF, 0x50, 0x2D, 0xFF, 0x0C, 0x24, 0xFF, 0xEB, 0x13, 0xFF, 0x49, 0x0B, 0xFF, 0xCE, 0x0C, 0xFF, 0x49, 0x0B, 0xFF, 0x8A, 0x0B, 0xFF, 0x6A, 0x0B, 0xFF, 0x29, 0x03, 0xFF, 0x8D, 0x1C, 0xFF, 0x29, 0x0B, 0xFF, 0x4A, 0x0B, 0xFF, 0x29, 0x0B, 0xFF, 0x29, 0x03, 0xFF,
-    0xC6, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0xCC, 0x0B, 0xFF, 0xA5, 0x01, 0xFF, 0x48, 0x0A, 0xFF, 0xA6, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0x2A, 0x03, 0xFF, 0xC6, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0x2A, 0x0B, 0xFF, 0x68, 0x02, 0xFF, 0x2A, 0x13, 0xFF, 0x06, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x6D, 0x0C, 0xFF, 0x27, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xEC, 0x0B, 0xFF, 0xE9, 0x0A, 0xFF, 0xEF, 0x24, 0xFF, 0x0C, 0x0C, 0xFF, 0x87, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0xAA, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xEB, 0x03, 0xFF, 0x89, 0x03, 0xFF, 0x28, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xAA, 0x03, 0xFF, 0x89, 0x03, 0xFF, 0x73, 0x06, 0xFF, 0xCF, 0x04, 0xFF, 0x8A, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x2C, 0x04, 0xFF, 0xDC, 0x37, 0xFF, 0xD4, 0x16, 0xFF, 0x4F, 0x05, 0xFF, 0xFB, 0x2F, 0xFF, 0xFE, 0x47, 0xFF, 0xFF, 0x27, 0xFF, 0x50, 0x05, 0xFF, 0xB0, 0x05, 0xFF, 0xFF, 0xC7, 0xFF, 0x14, 0x07, 0xFF, 0xDE, 0x0F, 0xFF, 0x8F, 0x05, 0xFF, 0xFF, 0xF7, 0xFF, 0xD4, 0x06, 0xFF, 0x90, 0x05, 0xFF, 0xFF, 0x0F, 0xFF, 0x2E, 0x05, 0xFF, 0x6C, 0x04, 0xFF, 0x89, 0x03, 0xFF, 0x37, 0x47, 0xFF, 0xC9, 0x03, 0xFF, 0xEB, 0x0B, 0xFF, 0x08, 0x03, 0xFF,
-    0xE8, 0x02, 0xFF, 0xF1, 0x25, 0xFF, 0xAD, 0x04, 0xFF, 0x8A, 0x13, 0xFF, 0x28, 0x03, 0xFF, 0x6A, 0x0B, 0xFF, 0x50, 0x2D, 0xFF, 0x8A, 0x0B, 0xFF, 0x8A, 0x0B, 0xFF, 0x6A, 0x0B, 0xFF, 0xE8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xEB, 0x0B, 0xFF, 0x0C, 0x14, 0xFF, 0x49, 0x0B, 0xFF, 0x6A, 0x0B, 0xFF, 0x6A, 0x03, 0xFF, 0xA5, 0x01, 0xFF, 0x07, 0x02, 0xFF, 0xE6, 0x01, 0xFF, 0x27, 0x02, 0xFF, 0xCB, 0x03, 0xFF, 0xC6, 0x01, 0xFF, 0x8B, 0x03, 0xFF, 0x06, 0x02, 0xFF, 0xC5, 0x01, 0xFF, 0xEB, 0x03, 0xFF, 0x09, 0x0B, 0xFF, 0x26, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xC5, 0x01, 0xFF, 0x4C, 0x04, 0xFF, 0x26, 0x02, 0xFF, 0xC5, 0x01, 0xFF, 0x66, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x8F, 0x2C, 0xFF, 0x26, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x8E, 0x0C, 0xFF, 0x26, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x0B, 0x04, 0xFF, 0x90, 0x0D, 0xFF, 0xAA, 0x03, 0xFF, 0xAB, 0x03, 0xFF, 0x28, 0x03, 0xFF, 0xB1, 0x05, 0xFF, 0x8E, 0x04, 0xFF, 0xAA, 0x03, 0xFF, 0xAA, 0x03, 0xFF, 0xEB, 0x03, 0xFF, 0x97, 0x07, 0xFF, 0x8F, 0x05, 0xFF, 0x0E, 0x05, 0xFF, 0xB7, 0x17, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0x90, 0x05, 0xFF,
-    0xF1, 0x05, 0xFF, 0xFF, 0x07, 0xFF, 0xFA, 0x07, 0xFF, 0xBC, 0x27, 0xFF, 0x70, 0x05, 0xFF, 0xF1, 0x05, 0xFF, 0xFE, 0x47, 0xFF, 0x93, 0x0E, 0xFF, 0x50, 0x05, 0xFF, 0x0E, 0x0D, 0xFF, 0x0D, 0x05, 0xFF, 0x2E, 0x05, 0xFF, 0x0F, 0x1D, 0xFF, 0x28, 0x03, 0xFF, 0x0B, 0x04, 0xFF, 0xAA, 0x0B, 0xFF, 0x08, 0x03, 0xFF, 0xA6, 0x02, 0xFF, 0x6C, 0x14, 0xFF, 0x69, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x0B, 0x04, 0xFF, 0x08, 0x03, 0xFF, 0x08, 0x0B, 0xFF, 0x4A, 0x0B, 0xFF, 0x8A, 0x13, 0xFF, 0x29, 0x0B, 0xFF, 0xAB, 0x13, 0xFF, 0x29, 0x0B, 0xFF, 0x49, 0x0B, 0xFF, 0x07, 0x02, 0xFF, 0xA5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xC6, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xC9, 0x12, 0xFF, 0xC9, 0x0A, 0xFF, 0xE6, 0x01, 0xFF, 0xC6, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xCB, 0x0B, 0xFF, 0x84, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0xCB, 0x03, 0xFF, 0xC5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0x26, 0x02, 0xFF, 0x49, 0x03, 0xFF, 0x06, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xEF, 0x14, 0xFF, 0x29, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0xA7, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x2C, 0x04, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF,
-    0xC8, 0x02, 0xFF, 0xAE, 0x0C, 0xFF, 0x08, 0x03, 0xFF, 0xC7, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x8D, 0x04, 0xFF, 0x89, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x0B, 0x04, 0xFF, 0x70, 0x0D, 0xFF, 0x4E, 0x05, 0xFF, 0x8D, 0x04, 0xFF, 0x73, 0x0E, 0xFF, 0xBD, 0x2F, 0xFF, 0x14, 0x07, 0xFF, 0x11, 0x06, 0xFF, 0x93, 0x06, 0xFF, 0xB7, 0x07, 0xFF, 0xDD, 0x37, 0xFF, 0xFD, 0x0F, 0xFF, 0x53, 0x06, 0xFF, 0x8F, 0x05, 0xFF, 0xFE, 0x07, 0xFF, 0xBA, 0x1F, 0xFF, 0x73, 0x0E, 0xFF, 0xCD, 0x04, 0xFF, 0x0E, 0x0D, 0xFF, 0xD0, 0x05, 0xFF, 0x30, 0x0D, 0xFF, 0x49, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0xAA, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xE7, 0x02, 0xFF, 0x2C, 0x1C, 0xFF, 0x89, 0x0B, 0xFF, 0x8D, 0x0C, 0xFF, 0xE8, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x08, 0x03, 0xFF, 0xAB, 0x13, 0xFF, 0xEB, 0x0B, 0xFF, 0x29, 0x0B, 0xFF, 0x6A, 0x13, 0xFF, 0x8A, 0x0B, 0xFF, 0xC8, 0x02, 0xFF, 0x6A, 0x0B, 0xFF, 0x29, 0x0B, 0xFF, 0x85, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xC6, 0x09, 0xFF, 0x4B, 0x0B, 0xFF, 0xC6, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xA9, 0x02, 0xFF, 0xC6, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xE9, 0x02, 0xFF, 0x27, 0x02, 0xFF, 0xA5, 0x01, 0xFF,
-    0xC5, 0x01, 0xFF, 0xC8, 0x02, 0xFF, 0xEB, 0x0B, 0xFF, 0xE5, 0x01, 0xFF, 0x09, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xC4, 0x01, 0xFF, 0x26, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xCE, 0x0C, 0xFF, 0x67, 0x02, 0xFF, 0xCB, 0x0B, 0xFF, 0xA8, 0x02, 0xFF, 0x69, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x6D, 0x0C, 0xFF, 0xC7, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x53, 0x16, 0xFF, 0xAE, 0x0C, 0xFF, 0x49, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xAD, 0x04, 0xFF, 0xFF, 0xE7, 0xFF, 0x0D, 0x05, 0xFF, 0x8C, 0x04, 0xFF, 0xF1, 0x05, 0xFF, 0xD9, 0x07, 0xFF, 0x75, 0x07, 0xFF, 0x8F, 0x05, 0xFF, 0xB0, 0x05, 0xFF, 0x35, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0x90, 0x05, 0xFF, 0x4E, 0x05, 0xFF, 0xB6, 0x0F, 0xFF, 0x51, 0x06, 0xFF, 0xCD, 0x04, 0xFF, 0x6C, 0x04, 0xFF, 0x2B, 0x04, 0xFF, 0x0B, 0x04, 0xFF, 0xEE, 0x14, 0xFF, 0x28, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0xEA, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x6A, 0x0B, 0xFF, 0xE8, 0x02, 0xFF, 0xCB, 0x0B, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xE8, 0x0A, 0xFF, 0xE8, 0x02, 0xFF, 0x09, 0x0B, 0xFF, 0x09, 0x0B, 0xFF, 0x08, 0x03, 0xFF,
-    0x85, 0x01, 0xFF, 0x06, 0x0A, 0xFF, 0xC6, 0x09, 0xFF, 0xA5, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x2D, 0x14, 0xFF, 0x84, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0xC8, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xA8, 0x0A, 0xFF, 0x09, 0x0B, 0xFF, 0xE7, 0x02, 0xFF, 0x4A, 0x03, 0xFF, 0x46, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x0C, 0x0C, 0xFF, 0x67, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xCB, 0x03, 0xFF, 0x4F, 0x05, 0xFF, 0xE8, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x8A, 0x03, 0xFF, 0x12, 0x06, 0xFF, 0x49, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0x6D, 0x04, 0xFF, 0xFF, 0x4F, 0xFF, 0xCE, 0x04, 0xFF, 0x6D, 0x04, 0xFF, 0x70, 0x05, 0xFF, 0x37, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x0D, 0xFF, 0x2E, 0x05, 0xFF, 0xB9, 0x0F, 0xFF, 0xDA, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0x6F, 0x05, 0xFF, 0xFF, 0x57, 0xFF, 0x73, 0x0E, 0xFF, 0xDE, 0x0F, 0xFF, 0x2E, 0x05, 0xFF, 0x6C, 0x04, 0xFF, 0x0B, 0x04, 0xFF, 0x69, 0x03, 0xFF, 0xD5, 0x16, 0xFF, 0xEA, 0x03, 0xFF, 0x0B, 0x0C, 0xFF, 0xE7, 0x02, 0xFF,
-    0xA7, 0x02, 0xFF, 0x90, 0x15, 0xFF, 0x49, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x8D, 0x1C, 0xFF, 0xE8, 0x0A, 0xFF, 0xE8, 0x0A, 0xFF, 0xC8, 0x02, 0xFF, 0x29, 0x0B, 0xFF, 0x04, 0x02, 0xFF, 0x08, 0x0B, 0xFF, 0xE9, 0x0A, 0xFF, 0x29, 0x0B, 0xFF, 0x09, 0x0B, 0xFF, 0x65, 0x01, 0xFF, 0x65, 0x01, 0xFF, 0x2B, 0x13, 0xFF, 0xC6, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0x65, 0x01, 0xFF, 0xC9, 0x02, 0xFF, 0x44, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x68, 0x02, 0xFF, 0xC6, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x67, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x88, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0x87, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0xAE, 0x14, 0xFF, 0x26, 0x02, 0xFF, 0x6A, 0x03, 0xFF, 0x46, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x98, 0x37, 0xFF, 0x09, 0x03, 0xFF, 0x6A, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x08, 0x03, 0xFF, 0x73, 0x0E, 0xFF, 0x29, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x8B, 0x03, 0xFF, 0xD5, 0x0E, 0xFF, 0xED, 0x04, 0xFF, 0x2B, 0x04, 0xFF, 0xCD, 0x04, 0xFF, 0xCD, 0x04, 0xFF, 0xFD, 0x0F, 0xFF, 0xAD, 0x04, 0xFF,
-    0x2F, 0x05, 0xFF, 0x4F, 0x05, 0xFF, 0x90, 0x05, 0xFF, 0xBE, 0x27, 0xFF, 0xED, 0x04, 0xFF, 0xAD, 0x04, 0xFF, 0x90, 0x0D, 0xFF, 0xED, 0x04, 0xFF, 0xFF, 0x1F, 0xFF, 0x4C, 0x04, 0xFF, 0x2B, 0x04, 0xFF, 0x29, 0x03, 0xFF, 0x6C, 0x04, 0xFF, 0xA7, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xEB, 0x13, 0xFF, 0xA7, 0x02, 0xFF, 0xB9, 0x6F, 0xFF, 0x89, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x8A, 0x0B, 0xFF, 0x0F, 0x25, 0xFF, 0xC8, 0x02, 0xFF, 0xC8, 0x0A, 0xFF, 0xC8, 0x0A, 0xFF, 0x87, 0x02, 0xFF, 0x0B, 0x0C, 0xFF, 0xAB, 0x13, 0xFF, 0xE8, 0x0A, 0xFF, 0x29, 0x0B, 0xFF, 0x31, 0x25, 0xFF, 0xA6, 0x01, 0xFF, 0xE6, 0x09, 0xFF, 0xA5, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x8B, 0x03, 0xFF, 0xE9, 0x0A, 0xFF, 0x2A, 0x23, 0xFF, 0x84, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x8B, 0x03, 0xFF, 0xA5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0xA8, 0x02, 0xFF, 0x2C, 0x04, 0xFF, 0xC5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x8A, 0x03, 0xFF, 0xC5, 0x01, 0xFF, 0x8E, 0x14, 0xFF, 0x26, 0x02, 0xFF, 0x8A, 0x03, 0xFF, 0x06, 0x02, 0xFF, 0x05, 0x02, 0xFF, 0x8D, 0x0C, 0xFF, 0x67, 0x02, 0xFF, 0xAB, 0x0B, 0xFF, 0xCB, 0x03, 0xFF, 0x66, 0x02, 0xFF, 0xD1, 0x05, 0xFF,
-    0xEE, 0x04, 0xFF, 0x4C, 0x04, 0xFF, 0xC8, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x33, 0x06, 0xFF, 0x6A, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x76, 0x07, 0xFF, 0x8C, 0x04, 0xFF, 0xEA, 0x03, 0xFF, 0x4C, 0x04, 0xFF, 0xFF, 0xD7, 0xFF, 0xFE, 0x07, 0xFF, 0x2B, 0x04, 0xFF, 0xCE, 0x04, 0xFF, 0xEE, 0x04, 0xFF, 0xCD, 0x04, 0xFF, 0xFF, 0x5F, 0xFF, 0x2E, 0x05, 0xFF, 0x2C, 0x04, 0xFF, 0xFF, 0xAF, 0xFF, 0x2C, 0x04, 0xFF, 0xCF, 0x0C, 0xFF, 0xEB, 0x03, 0xFF, 0xEB, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xEB, 0x0B, 0xFF, 0xE8, 0x02, 0xFF, 0x71, 0x1D, 0xFF, 0xE8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x08, 0x0B, 0xFF, 0x87, 0x02, 0xFF, 0x6C, 0x0C, 0xFF, 0x66, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xA8, 0x0A, 0xFF, 0xA7, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x09, 0x0B, 0xFF, 0xE8, 0x0A, 0xFF, 0x08, 0x0B, 0xFF, 0x65, 0x01, 0xFF, 0x03, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0xB0, 0x34, 0xFF, 0xC5, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0x88, 0x02, 0xFF, 0xA4, 0x01, 0xFF, 0xA5, 0x01, 0xFF,
-    0xE5, 0x01, 0xFF, 0xE8, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0xE9, 0x02, 0xFF, 0xA8, 0x0A, 0xFF, 0x67, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x6A, 0x03, 0xFF, 0x46, 0x02, 0xFF, 0x4D, 0x04, 0xFF, 0xA8, 0x02, 0xFF, 0xEB, 0x03, 0xFF, 0x67, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xEF, 0x0C, 0xFF, 0xCD, 0x0C, 0xFF, 0xA7, 0x02, 0xFF, 0x6A, 0x03, 0xFF, 0xAD, 0x04, 0xFF, 0x8A, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0xC8, 0x02, 0xFF, 0x49, 0x03, 0xFF, 0x90, 0x05, 0xFF, 0x2B, 0x04, 0xFF, 0xAA, 0x03, 0xFF, 0x0B, 0x04, 0xFF, 0x0F, 0x05, 0xFF, 0xAD, 0x04, 0xFF, 0x2B, 0x04, 0xFF, 0x2B, 0x04, 0xFF, 0x8C, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x04, 0xFF, 0x2B, 0x04, 0xFF, 0x0B, 0x04, 0xFF, 0xCD, 0x04, 0xFF, 0x0B, 0x04, 0xFF, 0x69, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x12, 0x06, 0xFF, 0xCB, 0x0B, 0xFF, 0xC8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xCD, 0x04, 0xFF, 0x09, 0x13, 0xFF, 0xA7, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x6C, 0x0C, 0xFF, 0x46, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x0A, 0xFF, 0xEB, 0x13, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xC8, 0x0A, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x0B, 0xFF,
-    0x44, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x0A, 0x03, 0xFF, 0x64, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0xA6, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0xE6, 0x09, 0xFF, 0x64, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xCB, 0x03, 0xFF, 0x84, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0x84, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0xA5, 0x01, 0xFF, 0x09, 0x13, 0xFF, 0xC5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xCB, 0x13, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x69, 0x03, 0xFF, 0xD1, 0x15, 0xFF, 0x2B, 0x04, 0xFF, 0x69, 0x03, 0xFF, 0x0B, 0x04, 0xFF, 0x4F, 0x05, 0xFF, 0x0B, 0x04, 0xFF, 0xEB, 0x03, 0xFF, 0x8C, 0x04, 0xFF, 0xD1, 0x0D, 0xFF, 0xAD, 0x04, 0xFF, 0xAD, 0x04, 0xFF, 0x2B, 0x04, 0xFF, 0x4F, 0x05, 0xFF, 0x8B, 0x04, 0xFF, 0xAA, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xEA, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x0E, 0x0D, 0xFF, 0xEB, 0x0B, 0xFF, 0xC7, 0x02, 0xFF, 0x87, 0x02, 0xFF,
-    0x87, 0x02, 0xFF, 0x89, 0x03, 0xFF, 0x87, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x25, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x45, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xA7, 0x0A, 0xFF, 0xEC, 0x13, 0xFF, 0xA8, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x08, 0x03, 0xFF, 0x44, 0x01, 0xFF, 0x65, 0x01, 0xFF, 0x07, 0x02, 0xFF, 0xC5, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x03, 0x01, 0xFF, 0x4A, 0x03, 0xFF, 0xA5, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x67, 0x0A, 0xFF, 0x0C, 0x0C, 0xFF, 0x84, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x26, 0x02, 0xFF, 0xCC, 0x0B, 0xFF, 0xC5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x8A, 0x0B, 0xFF, 0xE5, 0x01, 0xFF, 0x0C, 0x0C, 0xFF, 0x47, 0x02, 0xFF, 0x2D, 0x14, 0xFF, 0xE5, 0x01, 0xFF, 0x46, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x09, 0x03, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x70, 0x0D, 0xFF, 0x26, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x09, 0x0B, 0xFF, 0x09, 0x0B, 0xFF, 0xF1, 0x05, 0xFF, 0xC7, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x28, 0x03, 0xFF, 0x73, 0x06, 0xFF, 0xCB, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x89, 0x03, 0xFF, 0xFF, 0x27, 0xFF, 0x89, 0x03, 0xFF,
-    0xCA, 0x03, 0xFF, 0xCB, 0x03, 0xFF, 0xEA, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xCA, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x8A, 0x03, 0xFF, 0x89, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x8A, 0x0B, 0xFF, 0xE8, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x28, 0x03, 0xFF, 0xA7, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x8A, 0x0B, 0xFF, 0x87, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x25, 0x02, 0xFF, 0x25, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x05, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x0A, 0xFF, 0x87, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0x24, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x65, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x47, 0x0A, 0xFF, 0xC5, 0x01, 0xFF, 0x4A, 0x03, 0xFF, 0x26, 0x02, 0xFF, 0x29, 0x13, 0xFF, 0xE5, 0x01, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0xC7, 0x02, 0xFF, 0xA8, 0x0A, 0xFF, 0x0C, 0x04, 0xFF, 0x26, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xB0, 0x0D, 0xFF,
-    0x4D, 0x0C, 0xFF, 0x67, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x52, 0x0E, 0xFF, 0x87, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x08, 0x03, 0xFF, 0x6C, 0x04, 0xFF, 0xAA, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x93, 0x1E, 0xFF, 0xAC, 0x04, 0xFF, 0x8A, 0x03, 0xFF, 0xAA, 0x03, 0xFF, 0x89, 0x03, 0xFF, 0x89, 0x03, 0xFF, 0xB7, 0x0E, 0xFF, 0x8A, 0x03, 0xFF, 0xAA, 0x03, 0xFF, 0xD7, 0x0F, 0xFF, 0xEA, 0x0B, 0xFF, 0x15, 0x0F, 0xFF, 0xED, 0x0C, 0xFF, 0x69, 0x03, 0xFF, 0xC7, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x6B, 0x04, 0xFF, 0x66, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xEE, 0x14, 0xFF, 0x0C, 0x0C, 0xFF, 0x26, 0x02, 0xFF, 0x25, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x4C, 0x0C, 0xFF, 0x87, 0x0A, 0xFF, 0x46, 0x02, 0xFF, 0x87, 0x0A, 0xFF, 0x87, 0x0A, 0xFF, 0xEB, 0x0B, 0xFF, 0x87, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xA8, 0x0A, 0xFF, 0xA9, 0x02, 0xFF, 0xE6, 0x09, 0xFF, 0x23, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x09, 0x03, 0xFF, 0xC5, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0xEC, 0x0B, 0xFF, 0xE5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x47, 0x02, 0xFF,
-    0xC5, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xC6, 0x01, 0xFF, 0x6D, 0x04, 0xFF, 0xE5, 0x01, 0xFF, 0x26, 0x02, 0xFF, 0xC5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0xEE, 0x04, 0xFF, 0xE5, 0x01, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x70, 0x05, 0xFF, 0x26, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xD1, 0x05, 0xFF, 0xA7, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x93, 0x06, 0xFF, 0x49, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x28, 0x03, 0xFF, 0x35, 0x07, 0xFF, 0x07, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xF0, 0x05, 0xFF, 0x35, 0x0F, 0xFF, 0x49, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x0E, 0x1D, 0xFF, 0x08, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x6C, 0x04, 0xFF, 0xE8, 0x0A, 0xFF, 0x66, 0x02, 0xFF, 0x2E, 0x15, 0xFF, 0x46, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xCE, 0x1C, 0xFF, 0x0F, 0x2D, 0xFF, 0x26, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x47, 0x02, 0xFF, 0x29, 0x0B, 0xFF, 0x46, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0xC8, 0x02, 0xFF, 0xA7, 0x0A, 0xFF,
-    0x44, 0x01, 0xFF, 0x24, 0x01, 0xFF, 0x24, 0x01, 0xFF, 0x24, 0x01, 0xFF, 0xE9, 0x0A, 0xFF, 0xC5, 0x09, 0xFF, 0x23, 0x01, 0xFF, 0xA5, 0x09, 0xFF, 0x44, 0x01, 0xFF, 0x0A, 0x03, 0xFF, 0xA5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0x26, 0x02, 0xFF, 0x64, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0xE6, 0x01, 0xFF, 0x8A, 0x03, 0xFF, 0xC5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0xC6, 0x01, 0xFF, 0x87, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0x05, 0x02, 0xFF, 0x4C, 0x04, 0xFF, 0x05, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x05, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x4D, 0x14, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0xB0, 0x0D, 0xFF, 0x08, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x28, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x28, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x52, 0x0E, 0xFF, 0x49, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0x08, 0x03, 0xFF, 0xA7, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x86, 0x02, 0xFF, 0xC8, 0x0A, 0xFF, 0x46, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF,
-    0x46, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x05, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0x05, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xA4, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x87, 0x0A, 0xFF, 0x24, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0x43, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x43, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x8D, 0x14, 0xFF, 0xC5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0x05, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xB9, 0x2F, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x12, 0x06, 0xFF, 0x08, 0x03, 0xFF,
-    0x08, 0x03, 0xFF, 0x28, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0xEE, 0x0C, 0xFF, 0x49, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x09, 0x03, 0xFF, 0xCE, 0x14, 0xFF, 0x08, 0x03, 0xFF, 0x86, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x08, 0x03, 0xFF, 0x2E, 0x15, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x25, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x45, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0x6A, 0x1B, 0xFF, 0xC5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0xE8, 0x0A, 0xFF, 0x6A, 0x13, 0xFF, 0xE5, 0x01, 0xFF, 0x47, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x23, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x68, 0x02, 0xFF, 0x24, 0x01, 0xFF, 0x03, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x63, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0x43, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0x6B, 0x23, 0xFF, 0xC8, 0x0A, 0xFF, 0x84, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xCB, 0x0B, 0xFF, 0xC5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0xC6, 0x01, 0xFF, 0x26, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xEB, 0x03, 0xFF,
-    0x46, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0xF2, 0x1D, 0xFF, 0x66, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xA8, 0x02, 0xFF, 0xF1, 0x05, 0xFF, 0xA7, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x73, 0x1E, 0xFF, 0xE7, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0x29, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x69, 0x03, 0xFF, 0x49, 0x03, 0xFF, 0x29, 0x03, 0xFF, 0x49, 0x0B, 0xFF, 0x28, 0x03, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x05, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0x05, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x23, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0xE3, 0x00, 0xFF, 0x23, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x85, 0x01, 0xFF, 0x44, 0x01, 0xFF, 0x23, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x43, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x64, 0x01, 0xFF, 0x84, 0x01, 0xFF,
-    0xA9, 0x0A, 0xFF, 0xC5, 0x01, 0xFF, 0x84, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0x06, 0x02, 0xFF, 0xA5, 0x01, 0xFF, 0xA5, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0xE8, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x04, 0x02, 0xFF, 0x46, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0x25, 0x02, 0xFF, 0x0B, 0x04, 0xFF, 0x67, 0x02, 0xFF, 0x66, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xA7, 0x02, 0xFF, 0xC7, 0x02, 0xFF, 0x52, 0x16, 0xFF, 0x08, 0x03, 0xFF, 0xE8, 0x02, 0xFF, 0x69, 0x03, 0xFF, 0xEA, 0x03, 0xFF, 0xB0, 0x05, 0xFF, 0x8A, 0x03, 0xFF, 0x8A, 0x0B, 0xFF, 0x6A, 0x0B, 0xFF, 0x66, 0x02, 0xFF, 0x6F, 0x05, 0xFF, 0xC8, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x87, 0x02, 0xFF, 0x67, 0x02, 0xFF, 0x6C, 0x04, 0xFF, 0x46, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0x06, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0xCB, 0x03, 0xFF, 0x06, 0x02, 0xFF, 0x26, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0xE5, 0x01, 0xFF, 0x0C, 0x14, 0xFF, 0x27, 0x0A, 0xFF, 0xE6, 0x01, 0xFF, 0xC5, 0x01, 0xFF, 0xA4, 0x01, 0xFF, 0xAA, 0x0B, 0xFF, 0x46, 0x02, 0xFF, 0xE5, 0x01, 0xFF, 0x26, 0x02, 0xFF,
+    0x06, 0x02, 0x27, 0x02, 0x06, 0x02, 0x26, 0x02, 0x47, 0x02, 0x47, 0x02, 0x67, 0x02, 0x87, 0x02, 0x47, 0x02, 0x47, 0x02, 0x67, 0x02, 0x88, 0x02, 0x67, 0x02, 0xC8, 0x02, 0x88, 0x02, 0xC8, 0x02, 0xA8, 0x02, 0xC9, 0x02, 0x69, 0x03, 0xE9, 0x02, 0x2A, 0x03, 0xDC, 0x27, 0xAB, 0x03, 0xAC, 0x0B, 0x30, 0x05, 0x0F, 0x05, 0x8C, 0x0B, 0x0E, 0x14, 0x6C, 0x0B, 0xAD, 0x13, 0x4C, 0x03, 0x4C, 0x03,
+    0xCE, 0x13, 0x30, 0x14, 0x10, 0x0C, 0x8D, 0x0B, 0x30, 0x0C, 0xCE, 0x13, 0x6C, 0x0B, 0xAD, 0x03, 0x8D, 0x0B, 0x8C, 0x03, 0x2E, 0x04, 0xCD, 0x03, 0x8D, 0x03, 0x2C, 0x0B, 0xEA, 0x02, 0xEA, 0x02, 0xCA, 0x02, 0xEA, 0x02, 0xCA, 0x02, 0xEA, 0x02, 0x8D, 0x13, 0xEA, 0x02, 0x2C, 0x03, 0x2B, 0x03, 0xBE, 0x07, 0x2C, 0x03, 0xAA, 0x02, 0xFF, 0xAF, 0xCA, 0x02, 0x54, 0x05, 0x4C, 0x03, 0xCA, 0x02,
+    0x8C, 0x03, 0xC9, 0x02, 0x0B, 0x03, 0xEA, 0x02, 0xEA, 0x02, 0x2B, 0x03, 0x2B, 0x03, 0x8C, 0x03, 0x4B, 0x03, 0xED, 0x13, 0x4B, 0x03, 0x0A, 0x03, 0x6B, 0x03, 0xE9, 0x02, 0x6B, 0x0B, 0xC9, 0x0A, 0x47, 0x02, 0x27, 0x02, 0xAB, 0x0B, 0x27, 0x02, 0x27, 0x02, 0x47, 0x02, 0x47, 0x02, 0x67, 0x02, 0x93, 0x15, 0x47, 0x02, 0x67, 0x02, 0xEA, 0x0A, 0x47, 0x02, 0x2D, 0x0C, 0xC9, 0x02, 0x4A, 0x03,
+    0xE9, 0x02, 0x2A, 0x03, 0xC8, 0x02, 0x6E, 0x0C, 0x2A, 0x03, 0x6B, 0x03, 0x8B, 0x03, 0x26, 0x02, 0x0C, 0x0C, 0xAC, 0x03, 0x4B, 0x03, 0xCC, 0x03, 0xCD, 0x03, 0x8F, 0x14, 0x8F, 0x0C, 0x4D, 0x0B, 0x30, 0x1C, 0x75, 0x15, 0xB2, 0x0C, 0xCD, 0x03, 0xF5, 0x55, 0x2F, 0x14, 0xCE, 0x0B, 0x70, 0x0C, 0x8F, 0x14, 0x4E, 0x0C, 0x90, 0x04, 0xD1, 0x1C, 0xAD, 0x0B, 0xAD, 0x0B, 0x6F, 0x1C, 0x6C, 0x0B,
+    0x0B, 0x03, 0x2C, 0x03, 0x6C, 0x03, 0x53, 0x1D, 0xCA, 0x02, 0xCA, 0x02, 0x6C, 0x0B, 0x4B, 0x03, 0x6F, 0x14, 0x4B, 0x03, 0x89, 0x02, 0xCA, 0x02, 0x2B, 0x03, 0x2B, 0x03, 0xEE, 0x03, 0x89, 0x0A, 0x88, 0x02, 0x89, 0x02, 0xA9, 0x02, 0xCD, 0x03, 0xA9, 0x02, 0x0A, 0x0B, 0x2B, 0x0B, 0x48, 0x02, 0x4F, 0x1C, 0x6C, 0x0B, 0xC9, 0x02, 0x0A, 0x13, 0x68, 0x02, 0x0A, 0x03, 0xED, 0x13, 0xE9, 0x02,
+    0x47, 0x02, 0x47, 0x02, 0x27, 0x02, 0x27, 0x02, 0x47, 0x02, 0x27, 0x02, 0x88, 0x0A, 0x67, 0x02, 0x0C, 0x0C, 0xA9, 0x02, 0x67, 0x02, 0xA8, 0x0A, 0x46, 0x02, 0x88, 0x02, 0xE9, 0x02, 0x4A, 0x03, 0xC8, 0x02, 0xC8, 0x02, 0x2A, 0x0B, 0x2A, 0x03, 0x0A, 0x03, 0x4A, 0x03, 0x6B, 0x03, 0xA8, 0x02, 0x0D, 0x04, 0x0D, 0x14, 0xAC, 0x03, 0x2E, 0x0C, 0x8B, 0x03, 0xCC, 0x0B, 0xD3, 0x04, 0x6D, 0x03,
+    0x0F, 0x14, 0x79, 0x06, 0xF6, 0x04, 0x57, 0x3E, 0x15, 0x35, 0xD2, 0x14, 0xEE, 0x0B, 0xF1, 0x04, 0x90, 0x04, 0x2E, 0x04, 0x73, 0x05, 0xD1, 0x0C, 0x0E, 0x0C, 0x8C, 0x03, 0x4E, 0x04, 0x0B, 0x03, 0x2B, 0x03, 0x4B, 0x03, 0x6C, 0x0B, 0xAA, 0x02, 0x0B, 0x03, 0x8D, 0x0B, 0xCA, 0x02, 0x0A, 0x03, 0x2A, 0x03, 0xEA, 0x02, 0xAD, 0x03, 0xA9, 0x02, 0xC9, 0x02, 0xA9, 0x02, 0xA9, 0x02, 0x47, 0x02,
+    0xEA, 0x02, 0x2B, 0x03, 0xA9, 0x02, 0xC9, 0x02, 0x2B, 0x03, 0x4B, 0x03, 0x4C, 0x03, 0x6B, 0x0B, 0x4B, 0x03, 0xAD, 0x0B, 0x8C, 0x0B, 0x0A, 0x03, 0xC9, 0x02, 0x2A, 0x0B, 0xEA, 0x02, 0xE9, 0x02, 0x27, 0x02, 0x47, 0x02, 0x06, 0x02, 0x47, 0x02, 0xED, 0x13, 0x47, 0x02, 0x88, 0x02, 0x67, 0x02, 0xA8, 0x02, 0xAE, 0x1C, 0x88, 0x02, 0x68, 0x02, 0xA8, 0x02, 0x88, 0x02, 0xA8, 0x02, 0xEA, 0x02,
+    0x4B, 0x03, 0xE9, 0x02, 0x8C, 0x0B, 0xE9, 0x02, 0x4D, 0x0C, 0x8B, 0x0B, 0x4B, 0x03, 0xE9, 0x02, 0x8B, 0x03, 0x4E, 0x14, 0x4B, 0x03, 0xEC, 0x03, 0x6F, 0x14, 0x18, 0x5F, 0x4E, 0x1C, 0xB6, 0x26, 0x51, 0x1C, 0xD5, 0x0C, 0xD4, 0x04, 0x91, 0x14, 0x73, 0x1D, 0x13, 0x25, 0x70, 0x0C, 0xEF, 0x03, 0xF2, 0x14, 0x0E, 0x0C, 0xD4, 0x05, 0xB4, 0x05, 0x0E, 0x0C, 0x56, 0x56, 0x6C, 0x03, 0x6C, 0x0B,
+    0x6D, 0x0B, 0x0B, 0x03, 0x14, 0x25, 0xEB, 0x02, 0x6C, 0x0B, 0x0B, 0x0B, 0xCA, 0x02, 0x0A, 0x03, 0x6C, 0x0B, 0x19, 0x67, 0x89, 0x02, 0x0D, 0x04, 0x0B, 0x03, 0xEA, 0x02, 0xCA, 0x02, 0x48, 0x02, 0x89, 0x02, 0x68, 0x02, 0x8C, 0x13, 0x89, 0x02, 0xEA, 0x02, 0x4B, 0x03, 0x2B, 0x03, 0xAD, 0x0B, 0x4B, 0x0B, 0x6B, 0x0B, 0xEA, 0x0A, 0xA9, 0x02, 0xCD, 0x13, 0xE9, 0x02, 0x0A, 0x03, 0xC9, 0x02,
+    0x88, 0x0A, 0x47, 0x02, 0x47, 0x02, 0x26, 0x02, 0xA9, 0x0A, 0x68, 0x02, 0xA8, 0x02, 0xA8, 0x02, 0x68, 0x02, 0xE9, 0x02, 0xA8, 0x02, 0x88, 0x02, 0x88, 0x02, 0x0A, 0x03, 0xC9, 0x02, 0x4A, 0x03, 0xA8, 0x02, 0x4B, 0x0B, 0x2A, 0x0B, 0x29, 0x03, 0x2A, 0x03, 0x0A, 0x03, 0xCD, 0x03, 0xEA, 0x02, 0xAB, 0x0B, 0x6C, 0x03, 0xAD, 0x03, 0x0E, 0x0C, 0x8C, 0x0B, 0x72, 0x25, 0x4F, 0x14, 0xF0, 0x13,
+    0x71, 0x1C, 0xFF, 0xEF, 0x34, 0x04, 0xEF, 0x0B, 0xD8, 0x96, 0x13, 0x25, 0x91, 0x14, 0x50, 0x04, 0xF2, 0x14, 0x2F, 0x0C, 0xF3, 0x04, 0x94, 0x05, 0x2B, 0x03, 0x0E, 0x0C, 0x4F, 0x0C, 0xAD, 0x0B, 0x0A, 0x03, 0xEA, 0x02, 0xAD, 0x0B, 0xEA, 0x02, 0x0B, 0x03, 0xEA, 0x02, 0x0B, 0x03, 0xEA, 0x02, 0xA9, 0x02, 0x2B, 0x03, 0xC9, 0x02, 0x0B, 0x03, 0x88, 0x02, 0x89, 0x02, 0x68, 0x02, 0x88, 0x0A,
+    0x89, 0x02, 0x89, 0x02, 0x89, 0x02, 0xCA, 0x02, 0xEA, 0x02, 0x2B, 0x03, 0x4C, 0x03, 0x4B, 0x03, 0x0B, 0x03, 0xEA, 0x02, 0xC9, 0x02, 0x2B, 0x03, 0xEA, 0x02, 0xEA, 0x0A, 0xEA, 0x02, 0x0A, 0x0B, 0x67, 0x02, 0xED, 0x03, 0x47, 0x02, 0x47, 0x02, 0xC9, 0x0A, 0x68, 0x02, 0x2E, 0x0C, 0xA8, 0x02, 0xA8, 0x02, 0x88, 0x02, 0xA8, 0x02, 0xE9, 0x02, 0xA8, 0x02, 0xC9, 0x02, 0xA8, 0x02, 0xC9, 0x02,
+    0x2D, 0x14, 0x34, 0x3E, 0xE9, 0x02, 0x2A, 0x03, 0x2A, 0x03, 0xED, 0x0B, 0x0E, 0x0C, 0x0A, 0x03, 0x2E, 0x14, 0x2E, 0x14, 0x90, 0x14, 0x50, 0x0C, 0x4E, 0x1C, 0x4C, 0x03, 0xD1, 0x1C, 0x0F, 0x14, 0xB1, 0x24, 0xFF, 0xD7, 0x73, 0x04, 0xB2, 0x1C, 0x76, 0x5E, 0x94, 0x2D, 0xD2, 0x14, 0x12, 0x0D, 0x73, 0x2D, 0x2F, 0x0C, 0xB5, 0x0D, 0x70, 0x04, 0x4C, 0x03, 0x2F, 0x14, 0x2E, 0x14, 0x4B, 0x0B,
+    0x2B, 0x03, 0x2B, 0x0B, 0x0E, 0x0C, 0x4B, 0x0B, 0x0B, 0x0B, 0x4C, 0x03, 0xEA, 0x02, 0x2D, 0x14, 0x35, 0x3E, 0xCA, 0x02, 0xEA, 0x02, 0x88, 0x02, 0x4B, 0x0B, 0xA9, 0x02, 0x68, 0x02, 0xA9, 0x02, 0xB0, 0x24, 0xA9, 0x02, 0x89, 0x02, 0xEA, 0x02, 0xEA, 0x02, 0x94, 0x2D, 0x2B, 0x03, 0x6C, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0xCD, 0x0B, 0xEA, 0x02, 0x2B, 0x0B, 0xEA, 0x02, 0x4B, 0x0B, 0x4B, 0x03,
+    0x48, 0x02, 0x68, 0x02, 0x8E, 0x0C, 0x27, 0x02, 0x67, 0x02, 0x68, 0x02, 0x2A, 0x13, 0xC9, 0x02, 0xC9, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0x68, 0x02, 0xA8, 0x02, 0xF0, 0x14, 0x0A, 0x03, 0xA8, 0x02, 0xC9, 0x02, 0x2A, 0x03, 0xCC, 0x0B, 0x4A, 0x03, 0x6B, 0x0B, 0xED, 0x0B, 0xE8, 0x02, 0x4B, 0x0B, 0xF0, 0x0C, 0x2E, 0x0C, 0x8F, 0x14, 0xCD, 0x03, 0xAD, 0x0B, 0xAC, 0x0B, 0xD0, 0x14, 0x91, 0x24,
+    0x4F, 0x24, 0xF9, 0x76, 0x8E, 0x03, 0xF0, 0x14, 0x9C, 0x87, 0xB4, 0x35, 0xF1, 0x1C, 0x70, 0x14, 0x36, 0x46, 0x4F, 0x14, 0xD5, 0x05, 0xD1, 0x04, 0x2B, 0x0B, 0x0F, 0x14, 0x0E, 0x0C, 0xCD, 0x13, 0x4B, 0x03, 0x0B, 0x03, 0xEB, 0x0A, 0x2E, 0x14, 0x0A, 0x0B, 0x0B, 0x03, 0xEA, 0x02, 0xCA, 0x02, 0xEA, 0x02, 0xCA, 0x02, 0x6C, 0x0B, 0xEA, 0x02, 0xA9, 0x02, 0xA9, 0x02, 0x2E, 0x14, 0x48, 0x02,
+    0xA9, 0x0A, 0x68, 0x02, 0xA9, 0x02, 0xED, 0x0B, 0x2B, 0x03, 0x2B, 0x03, 0xA9, 0x02, 0x0A, 0x03, 0x8C, 0x0B, 0x0D, 0x14, 0xEA, 0x02, 0xEA, 0x02, 0x0A, 0x03, 0x2B, 0x0B, 0xCC, 0x0B, 0xE9, 0x02, 0x68, 0x02, 0xA9, 0x0A, 0x68, 0x02, 0xF0, 0x24, 0x46, 0x02, 0x88, 0x02, 0xC9, 0x0A, 0xB3, 0x3D, 0x8E, 0x04, 0x67, 0x02, 0xA8, 0x02, 0xA8, 0x02, 0xE9, 0x02, 0x0D, 0x04, 0x09, 0x03, 0x2A, 0x0B,
+    0xC8, 0x02, 0xCF, 0x1C, 0x0D, 0x14, 0x10, 0x0D, 0xF1, 0x24, 0x8B, 0x03, 0x0E, 0x1C, 0x2A, 0x0B, 0xED, 0x03, 0x2D, 0x04, 0xAF, 0x14, 0x4F, 0x14, 0xCD, 0x13, 0x2A, 0x03, 0x51, 0x1D, 0x6C, 0x0B, 0x4F, 0x1C, 0xFF, 0xFF, 0xEE, 0x1B, 0x11, 0x15, 0xD3, 0x55, 0xB3, 0x3D, 0xF1, 0x24, 0xCD, 0x1B, 0x52, 0x25, 0xCD, 0x0B, 0x53, 0x15, 0x12, 0x05, 0x4C, 0x13, 0x91, 0x1C, 0x0F, 0x0C, 0x2B, 0x0B,
+    0xCD, 0x13, 0x2F, 0x1C, 0x0B, 0x0B, 0xF1, 0x14, 0x2F, 0x2C, 0xEA, 0x02, 0x2B, 0x03, 0x2B, 0x03, 0x0D, 0x04, 0x2B, 0x03, 0xC9, 0x02, 0xC9, 0x02, 0x89, 0x02, 0x0B, 0x0B, 0x88, 0x02, 0x0E, 0x14, 0xA9, 0x0A, 0xA9, 0x02, 0xC9, 0x02, 0xE9, 0x02, 0x2B, 0x03, 0x0B, 0x03, 0xEA, 0x02, 0xEA, 0x02, 0xF0, 0x14, 0x0A, 0x03, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x0B, 0x4B, 0x03, 0x6C, 0x03, 0x2A, 0x0B,
+    0x68, 0x02, 0x2B, 0x13, 0x88, 0x0A, 0x2A, 0x13, 0x4E, 0x1C, 0xA8, 0x02, 0x09, 0x0B, 0xA8, 0x02, 0xA8, 0x02, 0xE9, 0x02, 0xE9, 0x0A, 0xCC, 0x0B, 0x88, 0x02, 0xED, 0x13, 0x09, 0x03, 0xE9, 0x0A, 0x0A, 0x03, 0xC8, 0x02, 0x09, 0x03, 0xE9, 0x02, 0x4E, 0x14, 0x6B, 0x03, 0xED, 0x13, 0x2A, 0x0B, 0x2A, 0x03, 0x8E, 0x14, 0x0E, 0x0C, 0x0D, 0x0C, 0xCD, 0x0B, 0x0A, 0x03, 0xCE, 0x14, 0x4E, 0x14,
+    0x0E, 0x1C, 0xFF, 0xFF, 0x4F, 0x24, 0xB0, 0x1C, 0x7B, 0x87, 0x92, 0x3D, 0x12, 0x25, 0xEC, 0x1B, 0x51, 0x25, 0x2F, 0x14, 0x73, 0x15, 0x8F, 0x04, 0x2B, 0x0B, 0x0E, 0x0C, 0x2F, 0x1C, 0x6C, 0x03, 0x6C, 0x13, 0x2B, 0x03, 0x6C, 0x03, 0x0B, 0x03, 0x0B, 0x0B, 0x0B, 0x0B, 0xC9, 0x02, 0xEA, 0x0A, 0xCA, 0x02, 0xA9, 0x02, 0xA9, 0x02, 0x89, 0x02, 0x0A, 0x03, 0x6F, 0x1C, 0xA8, 0x02, 0xCA, 0x0A,
+    0x27, 0x02, 0xC9, 0x02, 0x0E, 0x14, 0xCA, 0x02, 0x0A, 0x03, 0x2B, 0x03, 0x89, 0x02, 0x2F, 0x1C, 0x0A, 0x03, 0xA9, 0x02, 0x4B, 0x0B, 0x6C, 0x0B, 0x8C, 0x0B, 0x0A, 0x03, 0xCD, 0x03, 0x2A, 0x03, 0x4A, 0x03, 0x88, 0x02, 0x68, 0x02, 0x4B, 0x13, 0x88, 0x02, 0x6E, 0x04, 0xA8, 0x02, 0x09, 0x0B, 0x88, 0x02, 0x8B, 0x13, 0xB0, 0x14, 0xA8, 0x02, 0xA8, 0x02, 0xC9, 0x02, 0xAC, 0x03, 0x6A, 0x03,
+    0xC9, 0x02, 0xE9, 0x02, 0xEC, 0x03, 0xC8, 0x02, 0xEE, 0x04, 0x6B, 0x03, 0x4A, 0x03, 0xD0, 0x24, 0x4A, 0x03, 0x0F, 0x0D, 0xE9, 0x02, 0x76, 0x2E, 0x8C, 0x1B, 0x0A, 0x03, 0x8F, 0x14, 0xF0, 0x24, 0x2D, 0x1C, 0xF3, 0x5D, 0x8C, 0x13, 0x4E, 0x14, 0x38, 0x6F, 0x17, 0x3E, 0xD1, 0x1C, 0x6B, 0x13, 0xDA, 0x4E, 0x4F, 0x1C, 0x11, 0x15, 0x12, 0x15, 0x0B, 0x0B, 0xAD, 0x0B, 0x4B, 0x03, 0x0B, 0x03,
+    0x2B, 0x0B, 0xEE, 0x13, 0x2A, 0x03, 0x4C, 0x03, 0xEB, 0x0A, 0xD2, 0x0C, 0xCA, 0x02, 0xCA, 0x0A, 0xCA, 0x02, 0xEA, 0x02, 0xEA, 0x02, 0x8C, 0x1B, 0x4C, 0x0B, 0xA9, 0x02, 0xB0, 0x04, 0x68, 0x02, 0x68, 0x02, 0x89, 0x02, 0xAF, 0x04, 0x8C, 0x13, 0x0A, 0x03, 0x2B, 0x03, 0xEA, 0x02, 0x0B, 0x03, 0x2A, 0x03, 0xA9, 0x02, 0x6C, 0x0B, 0x70, 0x24, 0x4B, 0x0B, 0x8C, 0x0B, 0xCD, 0x0B, 0x2B, 0x03,
+    0x68, 0x02, 0x6B, 0x0B, 0x0A, 0x0B, 0x89, 0x02, 0x88, 0x02, 0x67, 0x02, 0xB0, 0x24, 0xE9, 0x02, 0xA8, 0x02, 0xC9, 0x02, 0xC9, 0x02, 0xCF, 0x04, 0xE8, 0x02, 0xE9, 0x02, 0xE9, 0x02, 0xA8, 0x02, 0xAE, 0x04, 0x6B, 0x03, 0x09, 0x03, 0x6A, 0x03, 0x8B, 0x03, 0x8F, 0x0C, 0x2A, 0x03, 0x72, 0x35, 0x4B, 0x03, 0x6B, 0x03, 0x4E, 0x14, 0xB0, 0x2C, 0x0E, 0x1C, 0x8C, 0x03, 0xD8, 0x76, 0xF2, 0x34,
+    0x0E, 0x1C, 0xFF, 0xFF, 0x4F, 0x24, 0x6F, 0x14, 0xB3, 0x4D, 0x32, 0x25, 0xB0, 0x14, 0x2A, 0x0B, 0xF0, 0x24, 0x2F, 0x14, 0x2F, 0x0C, 0xB1, 0x14, 0x70, 0x2C, 0xD1, 0x24, 0x0E, 0x0C, 0x2B, 0x0B, 0x4C, 0x13, 0x2B, 0x13, 0x2F, 0x14, 0xCA, 0x02, 0xEB, 0x0A, 0xEA, 0x02, 0xEA, 0x0A, 0x2E, 0x1C, 0xC9, 0x02, 0xD1, 0x0C, 0xA9, 0x0A, 0x0A, 0x03, 0xA9, 0x02, 0x2F, 0x04, 0x68, 0x02, 0x68, 0x02,
+    0x8F, 0x14, 0x0A, 0x03, 0xCA, 0x0A, 0x0A, 0x03, 0xAA, 0x02, 0xEE, 0x03, 0x89, 0x02, 0x4A, 0x03, 0x4B, 0x03, 0x0B, 0x03, 0x8C, 0x0B, 0x6C, 0x03, 0x0A, 0x03, 0x6B, 0x03, 0xED, 0x0B, 0x8C, 0x0B, 0x48, 0x02, 0x88, 0x02, 0xA8, 0x02, 0x88, 0x02, 0x88, 0x02, 0x88, 0x02, 0x68, 0x02, 0xE9, 0x02, 0xC9, 0x02, 0xC9, 0x02, 0xC9, 0x02, 0xE9, 0x02, 0x4A, 0x0B, 0x0A, 0x0B, 0xC8, 0x02, 0xE9, 0x02,
+    0x2A, 0x0B, 0x0A, 0x03, 0xE9, 0x02, 0x2A, 0x03, 0x6B, 0x0B, 0x6B, 0x03, 0x4A, 0x03, 0x4A, 0x03, 0xCC, 0x0B, 0x6B, 0x03, 0x6B, 0x03, 0xCD, 0x0B, 0xAC, 0x0B, 0x8C, 0x03, 0xFF, 0x7F, 0x90, 0x24, 0x0E, 0x1C, 0xBE, 0xE7, 0x8F, 0x24, 0x2E, 0x0C, 0x52, 0x2D, 0xD1, 0x1C, 0xB1, 0x1C, 0x2A, 0x0B, 0x53, 0x2D, 0x0F, 0x14, 0x4F, 0x14, 0x70, 0x0C, 0xB1, 0x34, 0xCE, 0x13, 0xED, 0x0B, 0xEA, 0x02,
+    0x50, 0x24, 0x4C, 0x0B, 0x0B, 0x0B, 0x4C, 0x0B, 0x70, 0x24, 0xEA, 0x02, 0xC9, 0x0A, 0xAA, 0x02, 0xEA, 0x02, 0xA9, 0x02, 0xA9, 0x02, 0xA9, 0x0A, 0xAA, 0x02, 0xC9, 0x0A, 0x89, 0x02, 0x48, 0x02, 0x27, 0x02, 0x68, 0x02, 0xC9, 0x0A, 0xCA, 0x02, 0x2B, 0x0B, 0x0A, 0x03, 0x89, 0x02, 0x2B, 0x03, 0x4B, 0x03, 0x4B, 0x03, 0x2B, 0x03, 0x8C, 0x03, 0xCA, 0x02, 0x6C, 0x03, 0x2E, 0x14, 0x2B, 0x03,
+    0xA8, 0x02, 0x68, 0x02, 0x8E, 0x14, 0xD0, 0x04, 0x0D, 0x04, 0x6B, 0x13, 0xA8, 0x02, 0x67, 0x02, 0xEF, 0x04, 0x09, 0x03, 0x09, 0x03, 0xE8, 0x02, 0x4A, 0x03, 0xB2, 0x05, 0x2E, 0x0C, 0xC9, 0x02, 0x52, 0x15, 0x4A, 0x03, 0x29, 0x03, 0x30, 0x05, 0xF1, 0x04, 0x19, 0x5F, 0x31, 0x0D, 0x4A, 0x03, 0x30, 0x05, 0xCC, 0x03, 0xCF, 0x04, 0xED, 0x03, 0xBE, 0x4F, 0xB0, 0x24, 0x50, 0x0D, 0x52, 0x1D,
+    0xF4, 0x45, 0x2F, 0x14, 0xED, 0x1B, 0xAF, 0x0C, 0x97, 0x56, 0xD6, 0x4E, 0x91, 0x14, 0x2A, 0x03, 0xF1, 0x1C, 0xCD, 0x0B, 0xAD, 0x0B, 0xAA, 0x02, 0x6D, 0x1B, 0xD1, 0x1C, 0xB1, 0x1C, 0xEB, 0x0A, 0x4C, 0x0B, 0xF5, 0x45, 0x0B, 0x0B, 0x6F, 0x14, 0xA9, 0x02, 0xAB, 0x0B, 0xB1, 0x0C, 0x68, 0x02, 0xFE, 0x97, 0xCA, 0x02, 0xAD, 0x03, 0xCA, 0x0A, 0x4B, 0x0B, 0xCA, 0x0A, 0x6F, 0x1C, 0xFF, 0x47,
+    0x47, 0x02, 0x68, 0x02, 0xEA, 0x0A, 0x36, 0x36, 0x0B, 0x13, 0x2B, 0x03, 0xC9, 0x02, 0xAC, 0x13, 0xB6, 0x15, 0x4C, 0x0B, 0x2B, 0x03, 0x6B, 0x03, 0x0A, 0x03, 0xB0, 0x24, 0xED, 0x0B, 0xAC, 0x0B, 0xE9, 0x02, 0xC9, 0x02, 0x88, 0x02, 0x67, 0x02, 0x88, 0x02, 0x0A, 0x03, 0x88, 0x02, 0xE9, 0x02, 0x0A, 0x0B, 0xF0, 0x04, 0xE9, 0x02, 0x2A, 0x03, 0xE9, 0x02, 0x0C, 0x0C, 0x34, 0x1E, 0x4A, 0x03,
+    0x29, 0x03, 0x72, 0x15, 0xAB, 0x03, 0x4A, 0x03, 0x4B, 0x0B, 0xB0, 0x14, 0xEC, 0x0B, 0xAC, 0x0B, 0x6B, 0x0B, 0xCD, 0x0B, 0x2A, 0x03, 0x8B, 0x03, 0x0D, 0x0C, 0x2E, 0x1C, 0xED, 0x03, 0x90, 0x1C, 0xF1, 0x1C, 0x8F, 0x2C, 0x0F, 0x1C, 0x6B, 0x03, 0xFF, 0x7F, 0x31, 0x45, 0x8D, 0x0B, 0xEE, 0x1B, 0x11, 0x25, 0x4B, 0x0B, 0xAD, 0x0B, 0x2B, 0x0B, 0x12, 0x3D, 0xCA, 0x02, 0xAD, 0x13, 0xEA, 0x02,
+    0x2B, 0x03, 0x90, 0x1C, 0x6C, 0x13, 0xCA, 0x02, 0xA9, 0x02, 0xF3, 0x14, 0xA9, 0x02, 0x90, 0x14, 0x0B, 0x03, 0xC9, 0x0A, 0x71, 0x1C, 0x70, 0x0C, 0x88, 0x02, 0x6B, 0x03, 0x90, 0x0C, 0xEE, 0x13, 0x48, 0x02, 0x68, 0x02, 0x8E, 0x1C, 0x2B, 0x0B, 0xEA, 0x0A, 0x4B, 0x03, 0x0A, 0x03, 0xB0, 0x14, 0xEE, 0x0B, 0x0E, 0x1C, 0xA9, 0x02, 0x0E, 0x04, 0xC9, 0x02, 0xCD, 0x0B, 0xCD, 0x03, 0xCD, 0x0B,
+    0x90, 0x04, 0x88, 0x02, 0xC9, 0x02, 0xA9, 0x02, 0x67, 0x02, 0xEF, 0x04, 0xAC, 0x13, 0xE8, 0x02, 0xC9, 0x02, 0x09, 0x03, 0xB3, 0x15, 0x4A, 0x03, 0x2A, 0x03, 0x4A, 0x03, 0xED, 0x0B, 0x4E, 0x04, 0x4A, 0x03, 0x2A, 0x03, 0xED, 0x03, 0x4A, 0x03, 0xCF, 0x04, 0xEC, 0x03, 0xAC, 0x03, 0xCC, 0x0B, 0xAC, 0x0B, 0x92, 0x15, 0x6A, 0x03, 0xCC, 0x03, 0xCC, 0x13, 0x72, 0x35, 0x31, 0x15, 0x0D, 0x0C,
+    0x8C, 0x0B, 0x2E, 0x1C, 0x0D, 0x1C, 0x72, 0x1D, 0xFF, 0x9F, 0x90, 0x2C, 0xED, 0x0B, 0x6C, 0x0B, 0x5A, 0x8F, 0xEA, 0x0A, 0x2B, 0x03, 0x0B, 0x0B, 0x6D, 0x13, 0x6C, 0x03, 0x6C, 0x13, 0x8C, 0x0B, 0x2B, 0x0B, 0xCA, 0x0A, 0x89, 0x02, 0x4B, 0x03, 0xCA, 0x02, 0x0A, 0x03, 0xEA, 0x0A, 0x8D, 0x0B, 0xEE, 0x1B, 0x93, 0x0D, 0xB0, 0x1C, 0xA9, 0x02, 0xCE, 0x13, 0xF2, 0x04, 0xB0, 0x14, 0x88, 0x0A,
+    0xC9, 0x0A, 0x2A, 0x03, 0xC9, 0x0A, 0xC9, 0x02, 0xEA, 0x02, 0xD1, 0x24, 0x2B, 0x0B, 0xAC, 0x03, 0xCD, 0x03, 0x4F, 0x14, 0xC9, 0x02, 0xCD, 0x03, 0xE9, 0x02, 0xED, 0x03, 0x4F, 0x0C, 0xCD, 0x0B, 0xC9, 0x02, 0xA8, 0x02, 0xAF, 0x0C, 0xA8, 0x02, 0x6B, 0x03, 0xC8, 0x02, 0x29, 0x03, 0xAF, 0x0C, 0x2A, 0x03, 0xE9, 0x02, 0x09, 0x03, 0x51, 0x15, 0x4B, 0x03, 0x2A, 0x03, 0x8B, 0x0B, 0x6E, 0x04,
+    0x51, 0x0D, 0x2A, 0x03, 0x6B, 0x03, 0xD0, 0x0C, 0xAB, 0x0B, 0xF0, 0x0C, 0x12, 0x05, 0xED, 0x0B, 0xCC, 0x03, 0xCC, 0x03, 0x11, 0x1D, 0xCC, 0x0B, 0x0D, 0x14, 0x6E, 0x0C, 0x2E, 0x0C, 0x73, 0x35, 0xCD, 0x13, 0x38, 0x77, 0xED, 0x1B, 0x11, 0x25, 0x97, 0x6E, 0xD0, 0x3C, 0x0E, 0x14, 0xF5, 0x55, 0x76, 0x56, 0x4B, 0x13, 0xCD, 0x13, 0x4C, 0x0B, 0x2B, 0x0B, 0xF2, 0x1C, 0x2B, 0x0B, 0xAD, 0x0B,
+    0x4C, 0x03, 0x0B, 0x0B, 0x70, 0x14, 0xCA, 0x02, 0x2B, 0x03, 0x0A, 0x0B, 0xEE, 0x13, 0x90, 0x1C, 0x0A, 0x03, 0x4B, 0x0B, 0xA9, 0x02, 0x4F, 0x14, 0xCA, 0x02, 0x91, 0x0C, 0xA9, 0x02, 0xA9, 0x02, 0xF7, 0x1E, 0x48, 0x02, 0xA9, 0x0A, 0x0A, 0x0B, 0x4C, 0x0B, 0xFF, 0x97, 0x2B, 0x13, 0xAD, 0x03, 0x2E, 0x04, 0x2F, 0x0C, 0x0A, 0x03, 0xCD, 0x03, 0x4B, 0x03, 0xCD, 0x03, 0xCD, 0x03, 0x0D, 0x0C,
+    0xE9, 0x02, 0xA8, 0x02, 0x0A, 0x03, 0xA8, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0x29, 0x03, 0x09, 0x03, 0xEC, 0x03, 0x2A, 0x03, 0x29, 0x03, 0x6B, 0x03, 0x8A, 0x03, 0x2A, 0x03, 0x6B, 0x03, 0x6A, 0x03, 0xAF, 0x04, 0x4A, 0x03, 0x8B, 0x03, 0x6E, 0x04, 0xAB, 0x03, 0x8A, 0x03, 0xAC, 0x03, 0xCC, 0x03, 0x1A, 0x47, 0xEC, 0x03, 0x6E, 0x0C, 0xED, 0x03, 0x36, 0x1E, 0x2D, 0x0C, 0x6E, 0x14, 0x72, 0x25,
+    0x6E, 0x04, 0xFF, 0xFF, 0x11, 0x3D, 0x4E, 0x1C, 0x5B, 0x47, 0x6F, 0x34, 0x2E, 0x1C, 0x6F, 0x24, 0xFF, 0xCF, 0xEE, 0x2B, 0x0E, 0x1C, 0xB1, 0x2C, 0x38, 0x5E, 0xB0, 0x24, 0x8C, 0x13, 0x0B, 0x0B, 0x6C, 0x0B, 0x0B, 0x03, 0xF2, 0x14, 0xEA, 0x0A, 0xEA, 0x02, 0xEA, 0x02, 0xB0, 0x24, 0xEA, 0x0A, 0x90, 0x1C, 0xEA, 0x02, 0xCA, 0x02, 0xC9, 0x02, 0x33, 0x05, 0xA9, 0x0A, 0xCA, 0x02, 0xB0, 0x14,
+    0xCA, 0x0A, 0x89, 0x02, 0x0B, 0x0B, 0x2C, 0x0B, 0x6F, 0x1C, 0x6C, 0x03, 0xC9, 0x02, 0x0E, 0x04, 0x8F, 0x0C, 0x4F, 0x14, 0x4B, 0x03, 0xEE, 0x03, 0x2B, 0x03, 0xED, 0x03, 0x4F, 0x0C, 0xED, 0x0B, 0xE9, 0x02, 0xE9, 0x02, 0xA8, 0x02, 0x6D, 0x14, 0x0E, 0x04, 0x09, 0x03, 0xC8, 0x02, 0xE9, 0x02, 0x0A, 0x03, 0x6A, 0x03, 0xAB, 0x03, 0xAB, 0x0B, 0x4A, 0x03, 0x51, 0x15, 0x4A, 0x03, 0x6B, 0x03,
+    0x6A, 0x03, 0xD0, 0x0C, 0xD4, 0x2D, 0x2D, 0x04, 0xAB, 0x03, 0x36, 0x0E, 0x14, 0x16, 0xEC, 0x03, 0xB5, 0x16, 0xF8, 0x36, 0x4E, 0x14, 0x51, 0x0D, 0x93, 0x25, 0x2D, 0x0C, 0xFF, 0xE7, 0xAF, 0x14, 0x32, 0x2D, 0xFF, 0xFF, 0x71, 0x45, 0xF3, 0x1D, 0xFF, 0xAF, 0x30, 0x4D, 0x2F, 0x1C, 0x4D, 0x14, 0xBE, 0xBF, 0x6F, 0x34, 0x90, 0x24, 0xF5, 0x3D, 0x2F, 0x24, 0x4C, 0x13, 0xD1, 0x1C, 0x0B, 0x03,
+    0x2B, 0x13, 0xD1, 0x34, 0x2B, 0x0B, 0x6F, 0x1C, 0x0B, 0x0B, 0xEA, 0x02, 0x2B, 0x03, 0x74, 0x25, 0x0E, 0x0C, 0xEA, 0x0A, 0xEB, 0x02, 0x17, 0x1E, 0xA9, 0x02, 0xEA, 0x0A, 0x8F, 0x24, 0xAA, 0x02, 0xA9, 0x0A, 0xCA, 0x0A, 0x4B, 0x03, 0x8F, 0x1C, 0x2B, 0x0B, 0xCD, 0x13, 0xAD, 0x0B, 0xF1, 0x14, 0x6F, 0x14, 0xB0, 0x14, 0xEA, 0x02, 0xCE, 0x03, 0x8C, 0x0B, 0x0D, 0x0C, 0x4E, 0x14, 0x2E, 0x0C,
+    0xA8, 0x02, 0x0A, 0x0B, 0x97, 0x47, 0xCE, 0x04, 0xE9, 0x02, 0x4D, 0x0C, 0x09, 0x03, 0x2A, 0x03, 0xAF, 0x0C, 0x4C, 0x04, 0xEF, 0x0C, 0x6A, 0x03, 0x6A, 0x03, 0x4E, 0x1C, 0xB2, 0x05, 0x0C, 0x04, 0x6B, 0x03, 0xAF, 0x14, 0x31, 0x05, 0xD2, 0x05, 0xD2, 0x0D, 0x8E, 0x04, 0x6F, 0x04, 0xD3, 0x15, 0xB3, 0x15, 0x71, 0x05, 0x4D, 0x04, 0x96, 0x26, 0xAF, 0x14, 0xD5, 0x15, 0x16, 0x07, 0x6E, 0x04,
+    0x11, 0x35, 0xF1, 0x24, 0x8E, 0x24, 0x14, 0x36, 0xFF, 0xBF, 0x72, 0x45, 0x70, 0x24, 0xB0, 0x2C, 0x18, 0x67, 0x4E, 0x1C, 0xF2, 0x24, 0xD6, 0x45, 0x8C, 0x13, 0x4F, 0x24, 0xB4, 0x2D, 0x4B, 0x03, 0x4B, 0x03, 0xD1, 0x24, 0x2C, 0x13, 0x93, 0x35, 0x2B, 0x03, 0x57, 0x46, 0x4F, 0x1C, 0x0B, 0x0B, 0xD0, 0x24, 0x0B, 0x03, 0x12, 0x1D, 0xEA, 0x0A, 0xCA, 0x0A, 0x6C, 0x03, 0x4C, 0x03, 0xC9, 0x0A,
+    0xA9, 0x0A, 0x4B, 0x03, 0x6E, 0x14, 0x0E, 0x24, 0xEA, 0x02, 0x4C, 0x03, 0xEA, 0x02, 0x6F, 0x14, 0x2F, 0x04, 0x0F, 0x04, 0xEA, 0x02, 0x4F, 0x04, 0x4F, 0x1C, 0x4E, 0x0C, 0x0E, 0x04, 0xED, 0x03, 0x10, 0x15, 0x67, 0x02, 0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0xAE, 0x04, 0x4A, 0x03, 0xEF, 0x04, 0x6A, 0x03, 0x09, 0x03, 0x6D, 0x0C, 0x2D, 0x04, 0x8E, 0x0C, 0x8B, 0x03, 0x4A, 0x03, 0x30, 0x05,
+    0x4D, 0x04, 0xED, 0x03, 0xCE, 0x04, 0xF0, 0x0C, 0xF2, 0x0D, 0xCF, 0x04, 0x32, 0x15, 0x2E, 0x04, 0x4E, 0x04, 0xFE, 0x1F, 0x10, 0x0D, 0x6F, 0x04, 0xF6, 0x55, 0x6F, 0x14, 0x7A, 0x2F, 0x10, 0x1D, 0xFD, 0x97, 0x35, 0x66, 0xEF, 0x34, 0x55, 0x4E, 0xBB, 0x77, 0xD3, 0x55, 0x91, 0x2C, 0x92, 0x3D, 0x7A, 0x87, 0xCC, 0x1B, 0xEE, 0x13, 0xCF, 0x13, 0xCD, 0x13, 0x52, 0x25, 0xCD, 0x1B, 0x4B, 0x03,
+    0x4C, 0x03, 0xAD, 0x1B, 0x52, 0x25, 0x0B, 0x0B, 0x0B, 0x03, 0x0A, 0x13, 0xD2, 0x3C, 0x73, 0x2D, 0x4B, 0x03, 0x2B, 0x03, 0x0A, 0x0B, 0xEA, 0x02, 0x91, 0x04, 0xAA, 0x02, 0xCA, 0x0A, 0xEA, 0x0A, 0xD4, 0x3D, 0x0B, 0x03, 0x4B, 0x0B, 0x2B, 0x0B, 0x0B, 0x03, 0xF1, 0x14, 0x4C, 0x03, 0x90, 0x04, 0x91, 0x04, 0x70, 0x04, 0x0B, 0x03, 0x0F, 0x04, 0x2E, 0x04, 0x2E, 0x0C, 0x6F, 0x0C, 0x6F, 0x14,
+    0xE9, 0x02, 0xA8, 0x02, 0xCC, 0x0B, 0x09, 0x03, 0x09, 0x03, 0xC8, 0x02, 0x09, 0x03, 0x13, 0x1E, 0xAF, 0x0C, 0xCB, 0x03, 0xAB, 0x03, 0x4A, 0x03, 0x92, 0x0D, 0xAB, 0x03, 0xAB, 0x03, 0xAB, 0x03, 0x92, 0x0D, 0x2D, 0x04, 0x10, 0x1D, 0x8E, 0x0C, 0x52, 0x05, 0xB2, 0x05, 0x8F, 0x04, 0x52, 0x15, 0xAE, 0x04, 0x10, 0x0D, 0x11, 0x0D, 0x6E, 0x04, 0x18, 0x2F, 0xAF, 0x14, 0xFF, 0xCF, 0xFF, 0xCF,
+    0x9A, 0x77, 0xFF, 0xFF, 0x13, 0x5E, 0xB2, 0x45, 0xFF, 0xEF, 0x75, 0x7E, 0xD0, 0x24, 0x92, 0x45, 0xFF, 0xFF, 0x6E, 0x2C, 0x2F, 0x1C, 0xDB, 0x57, 0xAD, 0x0B, 0x71, 0x14, 0x6C, 0x0B, 0x6C, 0x0B, 0xF5, 0x35, 0x4F, 0x24, 0x2F, 0x0C, 0xEA, 0x02, 0x0A, 0x03, 0x6C, 0x03, 0x8D, 0x0B, 0x12, 0x1D, 0x74, 0x0D, 0x0B, 0x0B, 0x8C, 0x13, 0xF5, 0x2D, 0x8C, 0x03, 0xEA, 0x0A, 0x0B, 0x0B, 0x4C, 0x03,
+    0xF1, 0x1C, 0x6C, 0x1B, 0x6C, 0x0B, 0x6C, 0x0B, 0x6C, 0x0B, 0xB0, 0x14, 0xEE, 0x0B, 0x70, 0x04, 0xD1, 0x0C, 0xF1, 0x0C, 0xC9, 0x02, 0xF2, 0x04, 0x4F, 0x0C, 0x4F, 0x04, 0x0D, 0x0C, 0x4E, 0x04, 0x67, 0x02, 0xE9, 0x02, 0x49, 0x13, 0xA8, 0x02, 0x09, 0x03, 0x4A, 0x03, 0xEB, 0x1B, 0x4A, 0x03, 0x6D, 0x0C, 0x4D, 0x14, 0xCB, 0x03, 0xCC, 0x03, 0x8A, 0x03, 0xCF, 0x0C, 0xCB, 0x03, 0xCC, 0x03,
+    0xAB, 0x03, 0x72, 0x15, 0x51, 0x15, 0xEF, 0x14, 0x6E, 0x04, 0x19, 0x3F, 0xB2, 0x0D, 0xAF, 0x04, 0x8E, 0x04, 0xB2, 0x1D, 0x52, 0x0D, 0xB4, 0x0D, 0x10, 0x15, 0xD0, 0x0C, 0xFF, 0xF7, 0xB3, 0x25, 0x96, 0x66, 0xFF, 0xF7, 0x56, 0x8E, 0xF3, 0x65, 0xFF, 0xDF, 0x9A, 0xC7, 0xF1, 0x2C, 0xF3, 0x5D, 0xFF, 0xEF, 0xF0, 0x44, 0x2E, 0x14, 0xFF, 0x7F, 0x0E, 0x14, 0xD1, 0x1C, 0xB5, 0x25, 0xCD, 0x0B,
+    0x6C, 0x0B, 0x9D, 0x9F, 0xAC, 0x13, 0x2F, 0x0C, 0x4C, 0x03, 0x4C, 0x13, 0xD2, 0x14, 0x8C, 0x03, 0x4B, 0x0B, 0x6B, 0x13, 0x70, 0x04, 0x8D, 0x0B, 0xEA, 0x0A, 0x2B, 0x0B, 0x1A, 0x0F, 0x12, 0x15, 0x8C, 0x1B, 0xEA, 0x02, 0x90, 0x1C, 0x52, 0x1D, 0xEE, 0x13, 0x2F, 0x1C, 0x0E, 0x04, 0x70, 0x04, 0x8F, 0x04, 0xD2, 0x04, 0x6C, 0x03, 0xD1, 0x04, 0x90, 0x0C, 0xB0, 0x04, 0x6F, 0x0C, 0xED, 0x03,
+    0xA8, 0x02, 0xC8, 0x02, 0xA8, 0x02, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x0D, 0x1C, 0xE9, 0x02, 0x4A, 0x03, 0x4E, 0x24, 0x8E, 0x14, 0x10, 0x1D, 0xEC, 0x03, 0xCB, 0x03, 0x51, 0x0D, 0xCF, 0x04, 0xEC, 0x03, 0x6E, 0x04, 0x8E, 0x04, 0x31, 0x0D, 0xAF, 0x04, 0xEF, 0x04, 0x10, 0x05, 0xF4, 0x0D, 0x50, 0x05, 0x71, 0x05, 0x38, 0x1F, 0xD3, 0x15, 0x10, 0x0D, 0x92, 0x1D, 0x52, 0x15, 0x31, 0x15,
+    0xF0, 0x1C, 0xD9, 0x9E, 0x51, 0x35, 0x11, 0x35, 0x55, 0x3E, 0x92, 0x4D, 0x12, 0x25, 0x5B, 0x77, 0xB8, 0x3E, 0x4E, 0x24, 0x4F, 0x0C, 0x32, 0x25, 0xCE, 0x13, 0xEF, 0x13, 0x0E, 0x14, 0xCE, 0x03, 0x0F, 0x1C, 0x12, 0x2D, 0xAD, 0x1B, 0x8C, 0x13, 0x6C, 0x13, 0x73, 0x15, 0x2B, 0x03, 0x4B, 0x0B, 0xAD, 0x13, 0x6F, 0x0C, 0x6C, 0x03, 0x8D, 0x13, 0xEA, 0x02, 0xFF, 0x0F, 0xF5, 0x15, 0x4B, 0x13,
+    0x12, 0x1D, 0x2B, 0x03, 0xBB, 0x2F, 0x2B, 0x03, 0x8D, 0x0B, 0xEE, 0x0B, 0x33, 0x15, 0x6C, 0x03, 0xFD, 0x0E, 0xB1, 0x04, 0x4C, 0x03, 0xD2, 0x04, 0x97, 0x0E, 0x6F, 0x0C, 0x2D, 0x0C, 0x6F, 0x0C, 0xC9, 0x02, 0xC9, 0x02, 0xC8, 0x02, 0xCE, 0x04, 0x09, 0x03, 0x29, 0x03, 0x8A, 0x03, 0x8D, 0x04, 0x32, 0x06, 0xF2, 0x0D, 0xEB, 0x03, 0xEF, 0x0C, 0xCB, 0x03, 0xB2, 0x15, 0xFB, 0x07, 0xB2, 0x05,
+    0xB3, 0x05, 0xAF, 0x04, 0xAE, 0x04, 0xFF, 0x6F, 0x71, 0x05, 0x51, 0x05, 0x11, 0x05, 0x55, 0x06, 0xFB, 0x07, 0xFF, 0xEF, 0xD3, 0x05, 0x72, 0x05, 0x3A, 0x4F, 0x34, 0x06, 0xFF, 0xFF, 0xD3, 0x15, 0x10, 0x15, 0xFF, 0xFF, 0xD0, 0x2C, 0xFF, 0x1F, 0xD7, 0x56, 0xB3, 0x55, 0x53, 0x2D, 0x15, 0x3E, 0xFF, 0x97, 0xCD, 0x0B, 0xB0, 0x1C, 0x70, 0x04, 0x94, 0x2D, 0x0F, 0x14, 0x31, 0x1D, 0xAC, 0x0B,
+    0x2E, 0x04, 0xED, 0x13, 0x53, 0x35, 0xB0, 0x1C, 0xAD, 0x13, 0x74, 0x76, 0x8F, 0x34, 0xAC, 0x13, 0x52, 0x1D, 0xB1, 0x0C, 0x8C, 0x0B, 0xED, 0x13, 0x16, 0x06, 0xD9, 0x16, 0xD1, 0x1C, 0x2F, 0x14, 0x4F, 0x24, 0xB4, 0x35, 0xAD, 0x03, 0xD1, 0x24, 0x6C, 0x0B, 0xEF, 0x0B, 0x0E, 0x04, 0xD1, 0x04, 0xF1, 0x24, 0x70, 0x0C, 0x0F, 0x0C, 0x90, 0x04, 0xB0, 0x1C, 0x31, 0x25, 0x0E, 0x0C, 0x4F, 0x14,
+    0x2D, 0x04, 0xE9, 0x02, 0xE9, 0x02, 0xE8, 0x02, 0x4A, 0x03, 0xCF, 0x04, 0x09, 0x03, 0x2C, 0x04, 0xAA, 0x03, 0xEC, 0x03, 0x71, 0x05, 0x2D, 0x04, 0xEC, 0x03, 0xAA, 0x03, 0x31, 0x05, 0xFD, 0x07, 0x8E, 0x04, 0x10, 0x05, 0x51, 0x0D, 0xEF, 0x04, 0xBD, 0x57, 0xFD, 0x1F, 0x50, 0x05, 0x72, 0x05, 0xF7, 0x16, 0xBF, 0x6F, 0xFF, 0xA7, 0xFD, 0x1F, 0x58, 0x2F, 0x9D, 0x67, 0xFF, 0x67, 0x5A, 0x37,
+    0xD4, 0x2D, 0xD8, 0x56, 0xFC, 0x77, 0x72, 0x25, 0xFE, 0x87, 0x96, 0x86, 0x33, 0x1D, 0xD0, 0x14, 0xFF, 0xDF, 0x90, 0x24, 0xD0, 0x14, 0xFE, 0x27, 0x0E, 0x04, 0xDF, 0x5F, 0x58, 0x36, 0x4E, 0x0C, 0xB4, 0x3D, 0x94, 0x35, 0x78, 0x36, 0xAD, 0x0B, 0x96, 0x76, 0xB3, 0x5D, 0x0E, 0x1C, 0x93, 0x25, 0x2F, 0x04, 0xAD, 0x0B, 0xAD, 0x0B, 0x37, 0x1E, 0x2F, 0x0C, 0xCE, 0x03, 0x70, 0x0C, 0x3B, 0x17,
+    0x4F, 0x24, 0x2E, 0x14, 0x0E, 0x0C, 0x8D, 0x03, 0x2F, 0x14, 0x8C, 0x03, 0x4F, 0x14, 0x95, 0x05, 0x74, 0x05, 0xF3, 0x04, 0x6C, 0x03, 0x50, 0x04, 0x4F, 0x04, 0x6F, 0x0C, 0x8F, 0x0C, 0xD0, 0x0C, 0x6B, 0x0B, 0x0A, 0x03, 0xCC, 0x03, 0x6B, 0x03, 0x09, 0x03, 0x29, 0x03, 0x09, 0x03, 0xF0, 0x04, 0x6A, 0x03, 0xAB, 0x03, 0x6D, 0x0C, 0xEF, 0x0C, 0xB3, 0x05, 0x0C, 0x04, 0x0C, 0x04, 0xCF, 0x04,
+    0xAF, 0x04, 0xB6, 0x06, 0x75, 0x0E, 0xF0, 0x04, 0x71, 0x05, 0xFE, 0x2F, 0xFC, 0x27, 0x91, 0x05, 0xD3, 0x05, 0xB8, 0x07, 0xFF, 0xEF, 0x38, 0x07, 0xD4, 0x05, 0x19, 0x27, 0x56, 0x0E, 0xFF, 0xBF, 0x52, 0x05, 0xB9, 0x3E, 0x39, 0x06, 0x33, 0x15, 0xBC, 0x47, 0x52, 0x15, 0x13, 0x0D, 0x73, 0x0D, 0x5C, 0x27, 0x4F, 0x14, 0x11, 0x15, 0xF8, 0x06, 0xB0, 0x14, 0x12, 0x1D, 0x90, 0x0C, 0x4F, 0x04,
+    0xD1, 0x1C, 0xAE, 0x0B, 0x37, 0x2E, 0x6B, 0x03, 0x8C, 0x0B, 0xAD, 0x13, 0x4F, 0x14, 0x6D, 0x03, 0x70, 0x0C, 0xD1, 0x0C, 0xFF, 0x0F, 0x50, 0x04, 0x71, 0x04, 0xDF, 0x2F, 0xFF, 0x57, 0x90, 0x1C, 0x2F, 0x14, 0x7D, 0x1F, 0xEF, 0x0B, 0xAD, 0x03, 0x70, 0x1C, 0x4C, 0x03, 0x54, 0x15, 0x13, 0x05, 0x54, 0x0D, 0x17, 0x06, 0x70, 0x04, 0xF3, 0x04, 0x1C, 0x07, 0xB5, 0x05, 0xD0, 0x0C, 0x73, 0x0D,
+    0xC8, 0x02, 0x29, 0x03, 0x09, 0x03, 0xCF, 0x2C, 0xEB, 0x03, 0x49, 0x03, 0x09, 0x03, 0x29, 0x03, 0x0C, 0x04, 0x72, 0x05, 0xAB, 0x03, 0x69, 0x03, 0x6D, 0x04, 0x50, 0x05, 0xD0, 0x04, 0xAF, 0x04, 0x8F, 0x04, 0x30, 0x05, 0x34, 0x06, 0xB2, 0x05, 0x51, 0x05, 0xF2, 0x05, 0x55, 0x06, 0xD2, 0x05, 0x95, 0x06, 0xD6, 0x06, 0x9A, 0x0F, 0x55, 0x06, 0xB3, 0x05, 0x93, 0x05, 0x53, 0x05, 0x15, 0x06,
+    0x73, 0x05, 0xFF, 0x47, 0x9D, 0x17, 0x74, 0x15, 0x17, 0x16, 0xB1, 0x04, 0x34, 0x05, 0x74, 0x05, 0xFF, 0x3F, 0x2F, 0x04, 0xF5, 0x05, 0x94, 0x0D, 0x90, 0x0C, 0x78, 0x3E, 0x4F, 0x14, 0xD1, 0x04, 0x33, 0x15, 0x12, 0x1D, 0x33, 0x15, 0x0E, 0x0C, 0x0E, 0x14, 0x52, 0x15, 0xEF, 0x03, 0x4F, 0x04, 0xB9, 0x06, 0xFF, 0xDF, 0x74, 0x05, 0x94, 0x05, 0xFF, 0xFF, 0xF2, 0x04, 0x53, 0x15, 0x1B, 0x07,
+    0x91, 0x0C, 0x50, 0x14, 0x53, 0x15, 0x0F, 0x04, 0x14, 0x05, 0x6D, 0x03, 0x94, 0x0D, 0xFF, 0xFF, 0x95, 0x05, 0xD6, 0x0D, 0xF7, 0x05, 0x39, 0x06, 0x33, 0x0D, 0xD0, 0x04, 0xFD, 0x0F, 0xF1, 0x1C, 0x4A, 0x03, 0x6B, 0x03, 0x2A, 0x03, 0x4A, 0x03, 0x0C, 0x04, 0xCA, 0x03, 0x10, 0x05, 0x6A, 0x03, 0xCB, 0x03, 0x6E, 0x04, 0x6E, 0x04, 0x51, 0x05, 0x30, 0x15, 0xF3, 0x15, 0x91, 0x05, 0xF0, 0x04,
+    0xEF, 0x04, 0x13, 0x06, 0x95, 0x0E, 0x74, 0x06, 0x95, 0x06, 0xB5, 0x06, 0x55, 0x06, 0x14, 0x06, 0x79, 0x07, 0x78, 0x07, 0x75, 0x06, 0x19, 0x07, 0x9D, 0x27, 0x35, 0x06, 0x98, 0x06, 0x77, 0x06, 0x97, 0x0E, 0x9B, 0x06, 0x7E, 0x17, 0x74, 0x05, 0x38, 0x0E, 0x13, 0x05, 0x75, 0x05, 0x54, 0x05, 0xFF, 0x4F, 0xB1, 0x04, 0xF6, 0x0D, 0xBE, 0x07, 0xD6, 0x05, 0x12, 0x1D, 0x2F, 0x04, 0x93, 0x1D,
+    0x7D, 0x5F, 0x4F, 0x04, 0xAD, 0x03, 0x2F, 0x14, 0x30, 0x04, 0x33, 0x25, 0x50, 0x0C, 0x90, 0x04, 0xFB, 0x3E, 0x1A, 0x17, 0x91, 0x04, 0xB6, 0x0D, 0x75, 0x05, 0xD5, 0x05, 0x71, 0x04, 0x30, 0x14, 0x2F, 0x0C, 0xD1, 0x0C, 0x0E, 0x14, 0x8D, 0x03, 0xCE, 0x03, 0x4D, 0x03, 0xF3, 0x04, 0x54, 0x05, 0xB7, 0x06, 0xB5, 0x05, 0xF3, 0x0C, 0x12, 0x05, 0xB0, 0x0C, 0x6F, 0x04, 0x8F, 0x0C, 0xB0, 0x0C,
+    0xE9, 0x02, 0x4A, 0x03, 0x6B, 0x03, 0x4D, 0x04, 0x6A, 0x03, 0xD3, 0x25, 0x0D, 0x04, 0x8C, 0x03, 0xCB, 0x03, 0x50, 0x05, 0x8A, 0x03, 0xCB, 0x03, 0x31, 0x0D, 0xF3, 0x05, 0xBD, 0x77, 0xAF, 0x04, 0x11, 0x05, 0x72, 0x05, 0x34, 0x06, 0xFD, 0x07, 0xFE, 0x0F, 0xDA, 0x07, 0xD6, 0x06, 0xD7, 0x06, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x07, 0x9A, 0x07, 0x3B, 0x07, 0xDB, 0x0F, 0xFF, 0xCF, 0xBE, 0x1F,
+    0xFF, 0x3F, 0xBF, 0x17, 0xBE, 0x9F, 0x5C, 0x0F, 0xFD, 0x06, 0xDE, 0x7F, 0xB6, 0x05, 0x3C, 0x07, 0xDF, 0x6F, 0x58, 0x06, 0x3B, 0x07, 0xFF, 0xEF, 0xF2, 0x04, 0x74, 0x15, 0xD3, 0x25, 0xD2, 0x0C, 0x95, 0x0D, 0x53, 0x0D, 0x8C, 0x03, 0x72, 0x35, 0x2F, 0x14, 0x91, 0x14, 0xB1, 0x04, 0x17, 0x1E, 0x59, 0x2E, 0x14, 0x05, 0x75, 0x05, 0x9D, 0x07, 0x75, 0x05, 0x34, 0x05, 0xD4, 0x35, 0x9B, 0x07,
+    0xB1, 0x1C, 0xD2, 0x1C, 0xF6, 0x25, 0x31, 0x35, 0x50, 0x14, 0xAE, 0x0B, 0xF3, 0x04, 0x34, 0x05, 0x53, 0x25, 0xF2, 0x04, 0x34, 0x05, 0x94, 0x05, 0x0E, 0x04, 0x74, 0x25, 0x10, 0x1D, 0x6F, 0x04, 0xCC, 0x03, 0x4B, 0x03, 0x8B, 0x03, 0xEC, 0x03, 0x8B, 0x03, 0xFC, 0x4F, 0xED, 0x03, 0x8F, 0x04, 0xEC, 0x03, 0x33, 0x06, 0xB2, 0x05, 0x51, 0x05, 0x0C, 0x04, 0xF3, 0x05, 0xD3, 0x05, 0xFF, 0x3F,
+    0x70, 0x05, 0x71, 0x05, 0x54, 0x06, 0xFD, 0x07, 0xFF, 0xF7, 0xFF, 0xF7, 0xFC, 0x07, 0x1A, 0x07, 0xFE, 0x07, 0xFF, 0xCF, 0xFF, 0xFF, 0xFE, 0x07, 0x96, 0x06, 0xFE, 0x07, 0xFF, 0x8F, 0xFF, 0xF7, 0xD8, 0x06, 0x59, 0x06, 0xFF, 0x27, 0x96, 0x05, 0xDE, 0x07, 0x96, 0x05, 0x96, 0x05, 0x96, 0x05, 0xFF, 0x17, 0xF2, 0x04, 0xFF, 0x17, 0xD5, 0x05, 0x71, 0x04, 0xFF, 0x2F, 0xB1, 0x14, 0x4F, 0x04,
+    0xDE, 0x3F, 0x4F, 0x04, 0xF8, 0x26, 0x70, 0x0C, 0x0F, 0x0C, 0xD2, 0x0C, 0x19, 0x0F, 0x58, 0x36, 0x9C, 0x06, 0xFF, 0xA7, 0xFE, 0x07, 0xFB, 0x0E, 0xFF, 0x37, 0xFF, 0xFF, 0xB3, 0x04, 0x54, 0x05, 0xB2, 0x0C, 0x37, 0x1E, 0xB5, 0x2D, 0xF2, 0x04, 0x34, 0x05, 0xCE, 0x03, 0x17, 0x1E, 0xDF, 0x27, 0xFF, 0xC7, 0x39, 0x06, 0x3B, 0x07, 0x5F, 0x07, 0xFF, 0xBF, 0x33, 0x05, 0xDD, 0x0F, 0xD2, 0x04,
+    0x2B, 0x03, 0xAD, 0x03, 0x4D, 0x04, 0x8B, 0x03, 0xCC, 0x03, 0xF2, 0x0D, 0xAF, 0x04, 0x4D, 0x04, 0xCB, 0x03, 0xAE, 0x04, 0x6E, 0x04, 0xCF, 0x04, 0x51, 0x05, 0xFF, 0x3F, 0x72, 0x05, 0x31, 0x05, 0x31, 0x05, 0xF6, 0x06, 0x92, 0x05, 0x54, 0x06, 0xFD, 0x07, 0xDE, 0x07, 0xFF, 0x0F, 0xFE, 0x07, 0x79, 0x07, 0xFE, 0x07, 0xFF, 0xF7, 0xFF, 0x0F, 0x76, 0x06, 0xF7, 0x06, 0xFE, 0x0F, 0xFF, 0xFF,
+    0x16, 0x06, 0x76, 0x05, 0x9A, 0x06, 0x13, 0x05, 0xBD, 0x0F, 0xD6, 0x05, 0x75, 0x05, 0x71, 0x04, 0x3B, 0x07, 0x70, 0x04, 0x7D, 0x07, 0x5C, 0x17, 0x33, 0x0D, 0x73, 0x15, 0xF6, 0x1D, 0xF5, 0x15, 0xD6, 0x1D, 0xDA, 0x2E, 0x78, 0x3E, 0x71, 0x04, 0x30, 0x04, 0xDF, 0x3F, 0x33, 0x15, 0xD6, 0x05, 0xFF, 0xFF, 0x9B, 0x06, 0xFF, 0x0F, 0xDF, 0x47, 0x7F, 0x07, 0x76, 0x05, 0xB5, 0x05, 0x94, 0x15,
+    0x75, 0x1D, 0x55, 0x05, 0x17, 0x0E, 0xFA, 0x16, 0x4F, 0x0C, 0x30, 0x0C, 0xFF, 0x7F, 0xD8, 0x05, 0x14, 0x15, 0xBD, 0x57, 0x95, 0x05, 0xD6, 0x05, 0x33, 0x0D, 0xB5, 0x15, 0x2F, 0x04, 0xB0, 0x0C, 0xB9, 0x0F, 0x8C, 0x03, 0x91, 0x05, 0xBD, 0x5F, 0xEC, 0x03, 0x33, 0x06, 0x10, 0x05, 0xCF, 0x04, 0xEF, 0x0C, 0xF2, 0x05, 0x30, 0x05, 0x9B, 0x47, 0xF4, 0x05, 0x95, 0x0E, 0x71, 0x05, 0x93, 0x0D,
+    0x31, 0x05, 0x34, 0x06, 0xD3, 0x05, 0x96, 0x06, 0xB6, 0x06, 0xDB, 0x07, 0x9B, 0x07, 0xF7, 0x06, 0x39, 0x07, 0xDF, 0x6F, 0xFC, 0x07, 0xFC, 0x0F, 0xFD, 0x07, 0xB7, 0x06, 0xB8, 0x06, 0x7D, 0x6F, 0xF9, 0x06, 0xBB, 0x06, 0xFF, 0xEF, 0x19, 0x0E, 0x39, 0x06, 0xBE, 0x37, 0xB6, 0x05, 0x12, 0x05, 0xFF, 0xAF, 0xD6, 0x05, 0x99, 0x06, 0xFF, 0xFF, 0x36, 0x06, 0x53, 0x05, 0x9C, 0x27, 0xFF, 0x3F,
+    0x73, 0x05, 0xB8, 0x36, 0x70, 0x04, 0xB1, 0x04, 0x94, 0x05, 0x77, 0x46, 0xD5, 0x25, 0xB1, 0x04, 0x75, 0x05, 0x99, 0x1E, 0xB3, 0x0C, 0x59, 0x26, 0x55, 0x05, 0x18, 0x16, 0x71, 0x0C, 0x91, 0x0C, 0xD2, 0x14, 0x94, 0x1D, 0xF2, 0x24, 0xB2, 0x14, 0x0F, 0x0C, 0xAE, 0x0B, 0x53, 0x05, 0x75, 0x05, 0xF7, 0x05, 0xDA, 0x0E, 0x94, 0x05, 0x33, 0x0D, 0x74, 0x05, 0xF2, 0x0C, 0xF2, 0x0C, 0xB0, 0x04,
+    0xCC, 0x03, 0x4B, 0x03, 0xB2, 0x0D, 0x2D, 0x04, 0x8B, 0x03, 0x0C, 0x04, 0x4D, 0x04, 0xB6, 0x2E, 0x99, 0x47, 0xBB, 0x3F, 0xF3, 0x15, 0x18, 0x27, 0x34, 0x16, 0x72, 0x05, 0x56, 0x0E, 0x92, 0x05, 0x30, 0x05, 0xFA, 0x1F, 0x93, 0x05, 0x15, 0x06, 0xBC, 0x0F, 0xD6, 0x06, 0x9A, 0x07, 0xFE, 0x07, 0x7A, 0x07, 0xDA, 0x07, 0xD7, 0x06, 0xB6, 0x06, 0xD8, 0x06, 0xB7, 0x06, 0x57, 0x06, 0x74, 0x05,
+    0x57, 0x06, 0xB7, 0x05, 0x7E, 0x17, 0x34, 0x05, 0x7C, 0x17, 0xF9, 0x1D, 0x95, 0x05, 0x74, 0x05, 0xF9, 0x06, 0xB0, 0x04, 0xDB, 0x06, 0x52, 0x05, 0x1A, 0x1F, 0xD6, 0x0D, 0x70, 0x04, 0xF6, 0x1D, 0x5C, 0x37, 0x12, 0x0D, 0xCD, 0x03, 0xB5, 0x05, 0x50, 0x1C, 0x91, 0x1C, 0x77, 0x2E, 0x99, 0x16, 0xD2, 0x0C, 0x54, 0x05, 0xFF, 0x37, 0x1B, 0x17, 0x34, 0x05, 0x98, 0x06, 0xBC, 0x0F, 0x12, 0x0D,
+    0x50, 0x0C, 0xBA, 0x06, 0x57, 0x0E, 0x54, 0x35, 0xD1, 0x14, 0x8D, 0x0B, 0x16, 0x0E, 0x17, 0x06, 0x58, 0x0E, 0xF7, 0x05, 0x75, 0x05, 0xF6, 0x0D, 0x78, 0x06, 0xF8, 0x0E, 0xD1, 0x0C, 0x93, 0x0D, 0x4A, 0x03, 0x6E, 0x04, 0xB2, 0x1D, 0x4D, 0x04, 0x8E, 0x04, 0x6D, 0x04, 0x54, 0x1E, 0x34, 0x1E, 0xD6, 0x2E, 0x2D, 0x04, 0xCF, 0x04, 0x4D, 0x04, 0xF3, 0x15, 0xEF, 0x04, 0x51, 0x05, 0x71, 0x05,
+    0xB6, 0x0E, 0x16, 0x17, 0xF3, 0x05, 0x37, 0x07, 0xFB, 0x07, 0xFB, 0x07, 0x98, 0x07, 0x9A, 0x07, 0xFD, 0x07, 0xFF, 0x0F, 0xFF, 0x1F, 0x18, 0x07, 0xB6, 0x06, 0x75, 0x06, 0xFE, 0x0F, 0x35, 0x06, 0x93, 0x05, 0x3B, 0x07, 0xD6, 0x05, 0x53, 0x05, 0x94, 0x05, 0x12, 0x05, 0x90, 0x04, 0x91, 0x04, 0x5C, 0x07, 0x90, 0x0C, 0xF2, 0x04, 0xD2, 0x04, 0x32, 0x0D, 0x12, 0x0D, 0x35, 0x26, 0xD1, 0x04,
+    0x54, 0x1D, 0x13, 0x15, 0x33, 0x0D, 0x32, 0x15, 0x70, 0x14, 0xDD, 0x07, 0x34, 0x15, 0x12, 0x1D, 0xDF, 0x8F, 0x79, 0x26, 0x95, 0x1D, 0xDF, 0x77, 0xDF, 0xFF, 0xBA, 0x1E, 0xFE, 0xEF, 0xFF, 0x17, 0x4F, 0x14, 0xB2, 0x04, 0x94, 0x2D, 0xD3, 0x4D, 0xEE, 0x0B, 0xEE, 0x0B, 0xFF, 0xCF, 0xD9, 0x1E, 0xF4, 0x35, 0xFF, 0x5F, 0x95, 0x0D, 0x13, 0x05, 0x53, 0x15, 0x53, 0x25, 0x31, 0x25, 0x4F, 0x0C,
+    0x54, 0x1E, 0x0D, 0x04, 0x9D, 0x8F, 0x94, 0x16, 0xD2, 0x05, 0xFF, 0xBF, 0xFF, 0xEF, 0x4F, 0x05, 0x50, 0x05, 0x13, 0x06, 0xF3, 0x1D, 0xF3, 0x05, 0x94, 0x0E, 0x50, 0x05, 0xFF, 0x37, 0xD7, 0x06, 0xD9, 0x0F, 0x58, 0x0F, 0x38, 0x07, 0xFD, 0x07, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0x87, 0xDC, 0x07, 0xBE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xEF, 0x9B, 0x07, 0xFF, 0xFF, 0xFF, 0xF7,
+    0xB7, 0x06, 0x93, 0x05, 0xBE, 0x1F, 0x73, 0x05, 0x9C, 0x0F, 0xFF, 0x2F, 0xF2, 0x04, 0xD2, 0x04, 0xFE, 0x0F, 0xF8, 0x26, 0xF2, 0x04, 0xFF, 0x5F, 0x4F, 0x04, 0x9B, 0x2F, 0xF6, 0x36, 0x32, 0x2D, 0xF1, 0x14, 0x96, 0x36, 0xD7, 0x66, 0x98, 0x97, 0x6F, 0x24, 0xB1, 0x24, 0xD1, 0x34, 0x38, 0x9F, 0xFF, 0xCF, 0xD1, 0x2C, 0xD1, 0x24, 0x98, 0x6E, 0xBB, 0x87, 0x6F, 0x34, 0x70, 0x24, 0xF1, 0x3C,
+    0xF0, 0x44, 0xB6, 0x56, 0xF1, 0x24, 0x90, 0x1C, 0xEE, 0x1B, 0x90, 0x2C, 0xB4, 0x35, 0x54, 0x0D, 0xB5, 0x1D, 0x93, 0x25, 0x33, 0x25, 0xF5, 0x35, 0x90, 0x14, 0xD1, 0x0C, 0x6F, 0x1C, 0xD0, 0x14, 0xE8, 0x02, 0x4A, 0x03, 0x8A, 0x03, 0xCF, 0x04, 0xAE, 0x04, 0xAE, 0x04, 0xEF, 0x04, 0x4C, 0x04, 0xAB, 0x03, 0x2F, 0x05, 0xCF, 0x04, 0x2F, 0x05, 0xD2, 0x05, 0xCF, 0x04, 0xF3, 0x05, 0x55, 0x06,
+    0x10, 0x05, 0x96, 0x06, 0x54, 0x06, 0xD6, 0x06, 0x77, 0x07, 0xFA, 0x07, 0xFD, 0x07, 0x58, 0x07, 0xFB, 0x07, 0xFE, 0x07, 0xDF, 0x07, 0xFF, 0x57, 0x97, 0x06, 0x14, 0x06, 0x17, 0x07, 0x99, 0x07, 0xFF, 0x1F, 0x73, 0x05, 0x15, 0x06, 0x32, 0x05, 0x14, 0x06, 0xD1, 0x04, 0xF2, 0x04, 0xD1, 0x04, 0x16, 0x0E, 0xF1, 0x0C, 0xD1, 0x04, 0x6F, 0x0C, 0x72, 0x1D, 0x51, 0x15, 0xB0, 0x1C, 0xFD, 0x4F,
+    0x12, 0x1D, 0x96, 0x36, 0xCD, 0x13, 0xF0, 0x34, 0xB1, 0x24, 0xB3, 0x35, 0x11, 0x3D, 0x11, 0x35, 0xF2, 0x34, 0x56, 0x3E, 0xF1, 0x34, 0xB1, 0x3C, 0x2E, 0x1C, 0xF5, 0x35, 0x73, 0x35, 0xD1, 0x2C, 0xCD, 0x1B, 0x52, 0x2D, 0x6F, 0x14, 0x90, 0x24, 0xED, 0x13, 0x8C, 0x13, 0x94, 0x1D, 0x73, 0x25, 0xF6, 0x1D, 0x12, 0x15, 0x94, 0x1D, 0x74, 0x1D, 0xD1, 0x0C, 0x90, 0x14, 0x0E, 0x0C, 0x4F, 0x14,
+    0x69, 0x03, 0x6B, 0x03, 0x4D, 0x04, 0x4D, 0x04, 0xCE, 0x0C, 0xEB, 0x03, 0x6E, 0x04, 0x2C, 0x04, 0x6D, 0x04, 0xF0, 0x04, 0xEC, 0x03, 0x8E, 0x04, 0x4D, 0x04, 0x91, 0x05, 0xB2, 0x05, 0xB2, 0x05, 0xEF, 0x04, 0xB2, 0x05, 0xD5, 0x06, 0x13, 0x06, 0x54, 0x06, 0xF6, 0x06, 0x37, 0x07, 0x98, 0x17, 0x16, 0x07, 0x57, 0x07, 0xFE, 0x2F, 0x54, 0x06, 0xB3, 0x05, 0xD7, 0x06, 0xF7, 0x0E, 0x75, 0x0E,
+    0x76, 0x0E, 0x77, 0x16, 0x12, 0x05, 0x90, 0x04, 0x74, 0x05, 0xD1, 0x04, 0xD2, 0x04, 0x91, 0x04, 0x36, 0x06, 0x11, 0x1D, 0xB0, 0x0C, 0x90, 0x0C, 0x77, 0x1E, 0x8F, 0x14, 0x8F, 0x0C, 0x32, 0x15, 0xB0, 0x24, 0xF0, 0x2C, 0x6F, 0x14, 0xB3, 0x15, 0x8F, 0x2C, 0x11, 0x2D, 0x72, 0x35, 0xBD, 0xB7, 0xCF, 0x34, 0xDC, 0x47, 0xFD, 0x57, 0x52, 0x35, 0xFF, 0x37, 0xBD, 0x27, 0xF0, 0x24, 0x97, 0x2E,
+    0xD1, 0x14, 0x76, 0x2E, 0xCD, 0x23, 0x4E, 0x24, 0x6F, 0x14, 0xAC, 0x1B, 0xB3, 0x15, 0x19, 0x17, 0xB4, 0x1D, 0x53, 0x15, 0x93, 0x15, 0xB0, 0x14, 0xB0, 0x14, 0x6F, 0x14, 0x90, 0x14, 0x4F, 0x1C, 0x73, 0x0E, 0xB6, 0x26, 0xFF, 0xFF, 0xFF, 0xEF, 0xF5, 0x06, 0xFF, 0xDF, 0xFF, 0xF7, 0xF1, 0x05, 0x33, 0x0E, 0x0E, 0x05, 0x8E, 0x04, 0x6D, 0x04, 0x71, 0x15, 0xEE, 0x04, 0x70, 0x05, 0x53, 0x06,
+    0xF5, 0x0E, 0x33, 0x0E, 0xFF, 0x27, 0x33, 0x06, 0x7A, 0x1F, 0xFF, 0xFF, 0xFF, 0xEF, 0x94, 0x06, 0xDE, 0x9F, 0xFF, 0xFF, 0x17, 0x07, 0xB6, 0x06, 0xFF, 0xFF, 0x91, 0x05, 0x34, 0x06, 0xFF, 0x57, 0xF5, 0x0D, 0xB0, 0x04, 0x3B, 0x17, 0x93, 0x0D, 0x31, 0x05, 0x12, 0x0D, 0xF2, 0x04, 0xB0, 0x04, 0xFF, 0x0F, 0xAC, 0x03, 0x8F, 0x0C, 0x90, 0x04, 0x52, 0x2D, 0x51, 0x25, 0x32, 0x1D, 0xB3, 0x3D,
+    0x8F, 0x1C, 0xD2, 0x35, 0xAC, 0x1B, 0xAF, 0x2C, 0x31, 0x35, 0xD0, 0x34, 0xF4, 0x5D, 0xF0, 0x4C, 0x11, 0x4D, 0x51, 0x55, 0x52, 0x55, 0x72, 0x5D, 0x10, 0x45, 0xAF, 0x44, 0x6F, 0x3C, 0x6E, 0x34, 0xCC, 0x1B, 0x6E, 0x34, 0x6E, 0x2C, 0xEC, 0x1B, 0xAC, 0x13, 0xEC, 0x23, 0x11, 0x25, 0xD0, 0x24, 0xF1, 0x24, 0xF1, 0x1C, 0x31, 0x25, 0x6F, 0x14, 0xCF, 0x1C, 0x4E, 0x14, 0x4F, 0x1C, 0x4E, 0x14,
+    0x6A, 0x03, 0x4A, 0x03, 0xAB, 0x03, 0x4D, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x0B, 0x04, 0x2C, 0x04, 0xEF, 0x14, 0xCE, 0x04, 0x93, 0x0E, 0x4D, 0x04, 0x50, 0x0D, 0x6D, 0x04, 0x6D, 0x04, 0xCF, 0x04, 0x50, 0x05, 0xEF, 0x04, 0x30, 0x05, 0x50, 0x05, 0xF3, 0x05, 0xF2, 0x05, 0x53, 0x06, 0xD2, 0x05, 0xF2, 0x05, 0x36, 0x07, 0x34, 0x06, 0x34, 0x06, 0xD5, 0x06, 0x92, 0x05, 0x72, 0x05, 0x92, 0x05,
+    0x32, 0x05, 0x70, 0x04, 0xD1, 0x04, 0x90, 0x04, 0xD1, 0x04, 0x4E, 0x0C, 0xB0, 0x04, 0x4F, 0x04, 0x70, 0x04, 0x8B, 0x03, 0x90, 0x1C, 0xCC, 0x0B, 0x0D, 0x14, 0x8F, 0x1C, 0x6F, 0x24, 0x6F, 0x24, 0x31, 0x35, 0x8F, 0x34, 0x4D, 0x34, 0x30, 0x4D, 0x31, 0x4D, 0x4E, 0x34, 0x33, 0x86, 0xB5, 0xB6, 0x37, 0xBF, 0xB2, 0x75, 0x10, 0x5D, 0x10, 0x5D, 0x51, 0x6D, 0x13, 0x8E, 0x31, 0x5D, 0xAF, 0x44,
+    0x6E, 0x3C, 0xF0, 0x4C, 0x4E, 0x34, 0x6E, 0x2C, 0x8B, 0x1B, 0xCC, 0x1B, 0x11, 0x25, 0x8F, 0x1C, 0xD0, 0x1C, 0xF1, 0x1C, 0x12, 0x1D, 0x90, 0x14, 0x90, 0x1C, 0x6F, 0x14, 0x6F, 0x1C, 0x4F, 0x1C, 0x29, 0x03, 0x30, 0x15, 0x09, 0x03, 0xD2, 0x1D, 0xB2, 0x05, 0xAB, 0x03, 0x91, 0x05, 0xEB, 0x03, 0x69, 0x03, 0x71, 0x05, 0xEC, 0x03, 0xD2, 0x05, 0xEF, 0x0C, 0x8E, 0x04, 0x94, 0x06, 0x4D, 0x04,
+    0xB5, 0x06, 0x12, 0x06, 0xEF, 0x04, 0xBB, 0x37, 0xFF, 0x67, 0xFF, 0xFF, 0x94, 0x06, 0x91, 0x05, 0x33, 0x06, 0xFF, 0xFF, 0xFF, 0xEF, 0x38, 0x07, 0x31, 0x05, 0x51, 0x05, 0xFF, 0x07, 0xFF, 0x77, 0xDE, 0x4F, 0x6F, 0x04, 0xB0, 0x04, 0x6F, 0x04, 0x18, 0x1F, 0x8F, 0x14, 0x90, 0x04, 0x2E, 0x0C, 0xD0, 0x14, 0x95, 0x26, 0xCF, 0x1C, 0xED, 0x13, 0xB2, 0x35, 0x75, 0x3E, 0x95, 0x4E, 0x0C, 0x2C,
+    0xD0, 0x14, 0x34, 0x56, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x6E, 0x16, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x9E, 0xB6, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xBA, 0xCF, 0x3A, 0xCF, 0x37, 0x87, 0x2D, 0x3C, 0x34, 0x66, 0x0C, 0x2C, 0x10, 0x3D, 0x92, 0x3D, 0x8F, 0x2C, 0xF3, 0x4D, 0x93, 0x35, 0x31, 0x35, 0x52, 0x2D, 0xB0, 0x1C, 0x6F, 0x1C, 0xB0, 0x24, 0x90, 0x1C,
+    0x09, 0x0B, 0x29, 0x03, 0x49, 0x03, 0x8B, 0x03, 0x4C, 0x04, 0xEB, 0x03, 0x2C, 0x04, 0xEB, 0x03, 0x6A, 0x03, 0xAE, 0x04, 0x91, 0x15, 0x6D, 0x04, 0xAD, 0x04, 0x6D, 0x04, 0x30, 0x05, 0xEF, 0x04, 0xEF, 0x04, 0xB2, 0x0D, 0xCE, 0x04, 0x34, 0x0E, 0x94, 0x0E, 0x12, 0x06, 0x9D, 0x87, 0xF7, 0x06, 0xFF, 0x47, 0xFF, 0xEF, 0x55, 0x06, 0x58, 0x07, 0xFF, 0x9F, 0x51, 0x05, 0x96, 0x16, 0x32, 0x05,
+    0xAF, 0x0C, 0x4E, 0x04, 0xD4, 0x0D, 0x6F, 0x0C, 0x32, 0x15, 0xCF, 0x24, 0x6F, 0x04, 0x4B, 0x03, 0x53, 0x05, 0x6B, 0x03, 0x31, 0x3D, 0xCC, 0x0B, 0x2D, 0x1C, 0xAF, 0x2C, 0x55, 0x56, 0x4E, 0x24, 0xCF, 0x1C, 0x76, 0x56, 0x6E, 0x34, 0xF3, 0x55, 0xF4, 0x5D, 0xF4, 0x65, 0xD6, 0x86, 0xDD, 0xDF, 0xB6, 0x9E, 0xB2, 0x65, 0x51, 0x5D, 0x92, 0x65, 0x51, 0x65, 0xF0, 0x5C, 0xD0, 0x54, 0x8E, 0x44,
+    0x4E, 0x3C, 0xF0, 0x4C, 0xEC, 0x2B, 0x2D, 0x2C, 0x4D, 0x2C, 0xF0, 0x34, 0xF0, 0x2C, 0x0D, 0x1C, 0x0D, 0x1C, 0x30, 0x2D, 0xF0, 0x24, 0x8E, 0x24, 0x8E, 0x24, 0x6F, 0x1C, 0x4E, 0x1C, 0x2E, 0x1C, 0xA8, 0x02, 0x87, 0x02, 0xE9, 0x02, 0xE8, 0x02, 0xE9, 0x02, 0x29, 0x03, 0x4D, 0x1C, 0x6A, 0x03, 0x49, 0x03, 0xCF, 0x24, 0x8A, 0x03, 0xCB, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x6D, 0x0C, 0xAF, 0x14,
+    0xCF, 0x14, 0x2C, 0x04, 0x2D, 0x04, 0x2C, 0x04, 0x8E, 0x04, 0x8E, 0x04, 0x8E, 0x04, 0xCF, 0x04, 0xAE, 0x04, 0xCF, 0x04, 0x10, 0x05, 0xF0, 0x04, 0xCF, 0x04, 0xD0, 0x04, 0xAF, 0x04, 0x4E, 0x04, 0x6F, 0x04, 0x0E, 0x04, 0x4E, 0x04, 0x0D, 0x0C, 0x8F, 0x14, 0xAF, 0x24, 0x4F, 0x0C, 0x0A, 0x03, 0x2E, 0x0C, 0x8B, 0x13, 0xF0, 0x3C, 0xAC, 0x13, 0xEC, 0x1B, 0x6E, 0x2C, 0xCF, 0x3C, 0x2D, 0x2C,
+    0xAF, 0x34, 0x8E, 0x34, 0x6E, 0x34, 0x71, 0x5D, 0xCF, 0x44, 0xAF, 0x44, 0x34, 0x76, 0x34, 0x7E, 0xF2, 0x75, 0x51, 0x65, 0x31, 0x5D, 0xD2, 0x6D, 0x30, 0x65, 0xCF, 0x54, 0xAF, 0x4C, 0xAF, 0x4C, 0x6E, 0x44, 0xD0, 0x4C, 0x0D, 0x2C, 0x6E, 0x34, 0x4D, 0x34, 0x31, 0x3D, 0xF0, 0x24, 0xAB, 0x1B, 0xCC, 0x1B, 0x31, 0x2D, 0x31, 0x2D, 0xCF, 0x24, 0x6E, 0x24, 0x4E, 0x1C, 0x2E, 0x24, 0x0E, 0x1C,
+    0xC8, 0x02, 0xC9, 0x02, 0x4A, 0x0B, 0xA7, 0x02, 0xE8, 0x02, 0x09, 0x03, 0xC7, 0x02, 0xEC, 0x13, 0x6A, 0x03, 0x6D, 0x1C, 0x4A, 0x03, 0xAA, 0x03, 0x6A, 0x03, 0x8B, 0x03, 0x34, 0x4E, 0x0C, 0x04, 0xB1, 0x35, 0x4D, 0x04, 0x2C, 0x04, 0x8E, 0x0C, 0x6D, 0x04, 0x8E, 0x04, 0x50, 0x15, 0x8E, 0x04, 0x6D, 0x04, 0x8E, 0x04, 0x8E, 0x04, 0xAF, 0x04, 0x8E, 0x04, 0xCF, 0x0C, 0xF0, 0x14, 0x8F, 0x0C,
+    0x6F, 0x0C, 0x2E, 0x04, 0x6F, 0x0C, 0x0D, 0x0C, 0xAF, 0x1C, 0x2D, 0x14, 0x2F, 0x0C, 0xEA, 0x0A, 0x0D, 0x0C, 0x6B, 0x13, 0x31, 0x45, 0xEC, 0x13, 0xAB, 0x13, 0x10, 0x3D, 0x72, 0x55, 0x2D, 0x2C, 0x8E, 0x34, 0xCE, 0x3C, 0xAE, 0x3C, 0x74, 0x6E, 0x12, 0x66, 0x71, 0x65, 0x99, 0x97, 0x16, 0x8F, 0xB4, 0x86, 0xD2, 0x6D, 0xD2, 0x6D, 0x54, 0x86, 0xB1, 0x7D, 0x71, 0x6D, 0x30, 0x5D, 0x8E, 0x44,
+    0x8E, 0x44, 0x51, 0x65, 0x6E, 0x3C, 0xAF, 0x3C, 0x8E, 0x34, 0x51, 0x3D, 0x51, 0x2D, 0x0D, 0x24, 0xF0, 0x2C, 0x92, 0x3D, 0x54, 0x3E, 0x11, 0x2D, 0xAE, 0x2C, 0xAE, 0x24, 0x4E, 0x24, 0x6E, 0x24, 0x46, 0x02, 0xE9, 0x02, 0xAC, 0x13, 0xE8, 0x02, 0xE9, 0x02, 0xE8, 0x02, 0x49, 0x03, 0x29, 0x03, 0x4A, 0x03, 0xAA, 0x03, 0x6A, 0x03, 0xAB, 0x03, 0x49, 0x03, 0xAB, 0x03, 0xCB, 0x03, 0xCA, 0x03,
+    0x2C, 0x04, 0x55, 0x26, 0x2D, 0x04, 0x55, 0x36, 0x13, 0x26, 0xB2, 0x05, 0x35, 0x06, 0xF5, 0x0E, 0xF5, 0x0E, 0xFC, 0x1F, 0x75, 0x16, 0x12, 0x06, 0xF3, 0x05, 0x10, 0x05, 0x10, 0x05, 0x2E, 0x04, 0x0D, 0x04, 0x93, 0x0D, 0x11, 0x0D, 0x8F, 0x1C, 0x2F, 0x04, 0x6D, 0x1C, 0x2F, 0x0C, 0x0A, 0x0B, 0x94, 0x0D, 0xAC, 0x13, 0xF3, 0x5D, 0xED, 0x0B, 0xF0, 0x1C, 0x6A, 0x13, 0xDD, 0xBF, 0x6E, 0x24,
+    0x55, 0x4E, 0xAD, 0x44, 0x33, 0x76, 0xDA, 0xA7, 0xDA, 0x87, 0xFC, 0x97, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xA6, 0x79, 0xAF, 0xFA, 0xD7, 0xFF, 0xEF, 0xFC, 0xDF, 0xD6, 0x86, 0x72, 0x65, 0x51, 0x55, 0xB9, 0xA7, 0xEF, 0x3C, 0x72, 0x3D, 0x8D, 0x34, 0x30, 0x35, 0xB3, 0x2D, 0xCC, 0x1B, 0x2D, 0x1C, 0x72, 0x45, 0xF0, 0x2C, 0xF0, 0x24, 0x6E, 0x2C, 0xCF, 0x24, 0x4C, 0x24, 0x90, 0x24,
+    0xA8, 0x02, 0x4C, 0x04, 0xE5, 0x01, 0xAE, 0x14, 0x8A, 0x03, 0xEB, 0x03, 0xEF, 0x04, 0x87, 0x02, 0xAE, 0x04, 0xAB, 0x03, 0xC7, 0x02, 0xF3, 0x0D, 0x0B, 0x04, 0x08, 0x03, 0xAB, 0x03, 0xAB, 0x03, 0x0F, 0x05, 0x2C, 0x04, 0x71, 0x05, 0x71, 0x0D, 0x33, 0x06, 0xF2, 0x05, 0xF3, 0x0D, 0x33, 0x16, 0x71, 0x15, 0xD2, 0x05, 0xB2, 0x05, 0x33, 0x0E, 0xAF, 0x04, 0x2C, 0x04, 0x0F, 0x0D, 0xF3, 0x05,
+    0x93, 0x2D, 0x4E, 0x0C, 0xEE, 0x03, 0x31, 0x15, 0x56, 0x16, 0xAF, 0x24, 0x0E, 0x0C, 0xC9, 0x02, 0x2D, 0x0C, 0x55, 0x26, 0x50, 0x3D, 0x8B, 0x03, 0x0C, 0x14, 0x92, 0x45, 0x94, 0x56, 0xD5, 0x5E, 0xEF, 0x34, 0xAE, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x6D, 0x34, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x65,
+    0x8F, 0x4C, 0xD6, 0x76, 0xEF, 0x44, 0xFF, 0xFF, 0x8A, 0x2B, 0x30, 0x2D, 0x71, 0x3D, 0xCC, 0x23, 0x71, 0x45, 0xCC, 0x23, 0xAF, 0x24, 0xD0, 0x2C, 0x0D, 0x24, 0x51, 0x3D, 0x10, 0x35, 0xAC, 0x13, 0x46, 0x02, 0x87, 0x02, 0xC8, 0x02, 0x4D, 0x2C, 0xE8, 0x02, 0xE9, 0x02, 0x09, 0x03, 0xE8, 0x02, 0x08, 0x03, 0xE8, 0x02, 0x49, 0x03, 0xC7, 0x02, 0x6E, 0x1C, 0x6A, 0x03, 0x69, 0x03, 0x4A, 0x03,
+    0xAB, 0x03, 0x8B, 0x03, 0x8E, 0x14, 0xCB, 0x03, 0x4D, 0x04, 0x4D, 0x04, 0xCB, 0x03, 0x2D, 0x04, 0x6E, 0x0C, 0x14, 0x36, 0x2D, 0x04, 0xD0, 0x14, 0x4E, 0x04, 0xF0, 0x1C, 0x0D, 0x04, 0x8B, 0x03, 0xB0, 0x1C, 0xD4, 0x35, 0x4E, 0x0C, 0x0D, 0x14, 0x8F, 0x0C, 0x4E, 0x1C, 0xED, 0x0B, 0xCD, 0x13, 0xCD, 0x0B, 0x09, 0x03, 0x0C, 0x1C, 0xCC, 0x1B, 0xAB, 0x13, 0x8E, 0x2C, 0x6D, 0x2C, 0x8E, 0x34,
+    0x0F, 0x3D, 0x50, 0x4D, 0x70, 0x45, 0xD5, 0x7E, 0xB5, 0x6E, 0xD2, 0x65, 0xF9, 0xA7, 0xB7, 0xAF, 0x77, 0xB7, 0x94, 0x96, 0xF2, 0x75, 0x53, 0x8E, 0xF2, 0x8D, 0xB1, 0x85, 0x91, 0x75, 0xEF, 0x54, 0x8E, 0x44, 0x6D, 0x44, 0x71, 0x4D, 0xEF, 0x3C, 0x30, 0x45, 0x91, 0x2D, 0xB2, 0x3D, 0x30, 0x3D, 0xB2, 0x3D, 0x10, 0x35, 0x54, 0x46, 0x10, 0x2D, 0x6E, 0x2C, 0xAF, 0x2C, 0xEC, 0x1B, 0x2D, 0x24,
+    0x67, 0x02, 0x67, 0x02, 0xA8, 0x02, 0x46, 0x02, 0x8B, 0x13, 0xCF, 0x3C, 0xE8, 0x02, 0x09, 0x03, 0xC8, 0x02, 0x09, 0x03, 0x4A, 0x0B, 0xE8, 0x02, 0x49, 0x03, 0x29, 0x03, 0x6A, 0x03, 0x4A, 0x03, 0xEC, 0x03, 0x8A, 0x03, 0x0C, 0x04, 0x69, 0x03, 0x49, 0x03, 0xB2, 0x35, 0xAF, 0x0C, 0x0C, 0x04, 0xEB, 0x03, 0xAF, 0x0C, 0xED, 0x03, 0x8F, 0x0C, 0x30, 0x0D, 0xCC, 0x03, 0x0D, 0x04, 0xAF, 0x14,
+    0x11, 0x2D, 0xEE, 0x03, 0xB0, 0x04, 0xF1, 0x34, 0x0D, 0x04, 0x8F, 0x2C, 0xED, 0x0B, 0xCD, 0x0B, 0xF2, 0x0C, 0x2A, 0x03, 0xAB, 0x13, 0x8B, 0x0B, 0xCC, 0x13, 0xAF, 0x34, 0x50, 0x2D, 0x6D, 0x24, 0xCF, 0x3C, 0xDE, 0xCF, 0x34, 0x56, 0xF5, 0x66, 0xFF, 0xF7, 0xFE, 0xA7, 0xF5, 0x76, 0xFE, 0xCF, 0xFF, 0xB7, 0x33, 0x6E, 0xF2, 0x65, 0xF2, 0x5D, 0xD6, 0x7E, 0xD2, 0x6D, 0x94, 0x56, 0xF6, 0x5E,
+    0x71, 0x55, 0x4D, 0x3C, 0x51, 0x4D, 0x51, 0x3D, 0x10, 0x3D, 0x10, 0x2D, 0x90, 0x35, 0xB1, 0x45, 0x50, 0x35, 0x2F, 0x25, 0x71, 0x3D, 0x50, 0x2D, 0xF0, 0x34, 0x10, 0x35, 0x0D, 0x1C, 0xCC, 0x1B, 0x88, 0x02, 0xA8, 0x02, 0xA8, 0x02, 0xA8, 0x02, 0xC8, 0x02, 0x4A, 0x0B, 0xE8, 0x02, 0x29, 0x03, 0xC8, 0x02, 0xC8, 0x02, 0x6E, 0x1C, 0x4D, 0x1C, 0x6A, 0x03, 0xCC, 0x03, 0x6A, 0x03, 0x0F, 0x15,
+    0x2D, 0x0C, 0x6A, 0x03, 0xEF, 0x04, 0x28, 0x03, 0x8A, 0x03, 0x2D, 0x04, 0x31, 0x0D, 0x0C, 0x04, 0x6A, 0x03, 0x33, 0x26, 0xD3, 0x0D, 0xAC, 0x03, 0x8E, 0x14, 0x6B, 0x03, 0xEC, 0x03, 0x4A, 0x03, 0xB3, 0x3D, 0x72, 0x0D, 0xCC, 0x03, 0x8F, 0x2C, 0x0D, 0x04, 0x0D, 0x24, 0xAC, 0x1B, 0xCD, 0x0B, 0xAC, 0x03, 0xE9, 0x02, 0xAB, 0x1B, 0xAB, 0x13, 0x10, 0x25, 0x6E, 0x2C, 0x93, 0x55, 0x2D, 0x24,
+    0x92, 0x35, 0xCF, 0x3C, 0xF0, 0x44, 0x33, 0x5E, 0x33, 0x4E, 0xD2, 0x65, 0x53, 0x86, 0x54, 0x6E, 0x54, 0x66, 0x71, 0x65, 0xD2, 0x6D, 0x71, 0x65, 0xF3, 0x65, 0xEF, 0x54, 0x6D, 0x44, 0x6E, 0x3C, 0x4E, 0x44, 0x4D, 0x34, 0x52, 0x4D, 0xB3, 0x45, 0x8F, 0x44, 0x10, 0x35, 0xF0, 0x24, 0x51, 0x45, 0x30, 0x2D, 0x2D, 0x24, 0xCF, 0x2C, 0xD0, 0x2C, 0x0D, 0x24, 0x2E, 0x24, 0x4D, 0x24, 0x2E, 0x24,
+    0x47, 0x02, 0x87, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0x67, 0x02, 0x66, 0x02, 0x66, 0x02, 0x2C, 0x04, 0x4D, 0x14, 0x09, 0x03, 0xCB, 0x0B, 0x4D, 0x0C, 0xE8, 0x02, 0x09, 0x03, 0x70, 0x05, 0x4D, 0x04, 0x09, 0x03, 0x09, 0x03, 0xAB, 0x03, 0xCF, 0x14, 0x49, 0x03, 0xCB, 0x03, 0x8A, 0x03, 0x71, 0x05, 0xCA, 0x03, 0x2C, 0x04, 0x0C, 0x04, 0x71, 0x05, 0x4D, 0x04, 0x49, 0x03, 0xEC, 0x03, 0xEC, 0x03,
+    0x0F, 0x25, 0xCB, 0x03, 0xCC, 0x03, 0x4D, 0x14, 0xB3, 0x15, 0x0D, 0x14, 0xE9, 0x0A, 0xAD, 0x0B, 0x2E, 0x14, 0x4E, 0x14, 0xAB, 0x0B, 0x8C, 0x13, 0x2D, 0x24, 0xF3, 0x25, 0x10, 0x3D, 0x2D, 0x24, 0x8E, 0x2C, 0xB2, 0x3D, 0xFF, 0xE7, 0x94, 0x7E, 0xAF, 0x44, 0x0F, 0x4D, 0xFE, 0xD7, 0xFD, 0xF7, 0x33, 0x96, 0xB3, 0x75, 0x70, 0x55, 0x16, 0x9F, 0x74, 0x96, 0x50, 0x75, 0xCE, 0x54, 0x71, 0x55,
+    0xB1, 0x45, 0x0C, 0x3C, 0x6D, 0x34, 0x10, 0x35, 0x6E, 0x34, 0x31, 0x35, 0xB0, 0x24, 0x11, 0x3D, 0x2D, 0x24, 0xAB, 0x0B, 0xF0, 0x3C, 0xB0, 0x24, 0x4A, 0x13, 0x8F, 0x24, 0xEC, 0x1B, 0x4E, 0x1C, 0x46, 0x02, 0xAD, 0x0C, 0x88, 0x02, 0xCB, 0x03, 0x47, 0x02, 0xA8, 0x02, 0xCB, 0x03, 0x09, 0x03, 0x2C, 0x04, 0xA7, 0x02, 0xE9, 0x02, 0xC7, 0x02, 0xE9, 0x02, 0x29, 0x03, 0x4A, 0x03, 0x08, 0x03,
+    0x2F, 0x05, 0xEC, 0x0B, 0xAB, 0x03, 0x0C, 0x04, 0x49, 0x03, 0x50, 0x05, 0x4C, 0x04, 0x8A, 0x03, 0xAB, 0x03, 0xE8, 0x02, 0x91, 0x05, 0xEC, 0x03, 0x0D, 0x0C, 0x4A, 0x03, 0xF2, 0x1D, 0xB1, 0x05, 0xEC, 0x0B, 0xAB, 0x03, 0x4E, 0x04, 0x8B, 0x0B, 0x34, 0x16, 0x8B, 0x03, 0xE9, 0x0A, 0xAC, 0x0B, 0xCF, 0x14, 0x54, 0x1E, 0xEC, 0x13, 0x6B, 0x03, 0x6E, 0x2C, 0x8E, 0x1C, 0x94, 0x36, 0x2D, 0x24,
+    0x2D, 0x24, 0xDC, 0x8F, 0x13, 0x76, 0xFF, 0xFF, 0xFE, 0xAF, 0xD3, 0x5D, 0x17, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x75, 0xAE, 0x44, 0x16, 0x77, 0x53, 0xA6, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0x44, 0x4D, 0x3C, 0x6E, 0x44, 0xCF, 0x3C, 0x53, 0x66, 0x0C, 0x34, 0xCF, 0x2C, 0x10, 0x2D, 0xAF, 0x34, 0x13, 0x56, 0x6E, 0x2C, 0xD2, 0x3D, 0x2D, 0x14, 0xCB, 0x23, 0x2F, 0x2D, 0x2A, 0x13, 0x0C, 0x1C,
+    0x87, 0x02, 0xA8, 0x02, 0x88, 0x02, 0x87, 0x02, 0x4C, 0x04, 0x09, 0x0B, 0xA8, 0x02, 0xA8, 0x02, 0x09, 0x0B, 0xEF, 0x1C, 0x87, 0x02, 0xE8, 0x02, 0xC8, 0x02, 0xC7, 0x02, 0x4D, 0x14, 0x6D, 0x0C, 0x8E, 0x14, 0x4D, 0x04, 0x09, 0x03, 0x8A, 0x03, 0x2D, 0x04, 0x49, 0x03, 0x8A, 0x03, 0xAE, 0x04, 0x8A, 0x03, 0x49, 0x03, 0x6D, 0x04, 0xCC, 0x03, 0xAB, 0x03, 0xAB, 0x03, 0x30, 0x05, 0xAB, 0x03,
+    0x09, 0x03, 0x8E, 0x0C, 0xAB, 0x03, 0x8A, 0x03, 0x0D, 0x0C, 0x8A, 0x03, 0xC9, 0x02, 0x8C, 0x0B, 0x2D, 0x0C, 0xE9, 0x0A, 0xEC, 0x13, 0xCC, 0x0B, 0xF0, 0x1C, 0x2D, 0x1C, 0x8F, 0x2C, 0x6E, 0x1C, 0x2D, 0x24, 0x6E, 0x2C, 0x4D, 0x24, 0x2F, 0x35, 0x2D, 0x34, 0xAF, 0x44, 0x30, 0x45, 0x30, 0x65, 0x50, 0x6D, 0x10, 0x55, 0x4C, 0x3C, 0x4C, 0x44, 0xCE, 0x54, 0x8D, 0x44, 0xAE, 0x44, 0x0C, 0x34,
+    0x0C, 0x2C, 0xAB, 0x23, 0x4C, 0x2C, 0x2C, 0x2C, 0xEC, 0x2B, 0xB0, 0x2C, 0xAF, 0x2C, 0xAF, 0x2C, 0x6F, 0x24, 0xED, 0x1B, 0x6E, 0x24, 0xED, 0x1B, 0xCC, 0x1B, 0x6F, 0x2C, 0x2D, 0x2C, 0xEC, 0x1B, 0x88, 0x0A, 0x47, 0x02, 0x47, 0x02, 0x87, 0x02, 0x67, 0x02, 0xC8, 0x02, 0x08, 0x03, 0xC8, 0x02, 0xA7, 0x02, 0xA8, 0x02, 0x67, 0x02, 0x8E, 0x14, 0xE8, 0x02, 0xA7, 0x02, 0x0C, 0x0C, 0x49, 0x03,
+    0x09, 0x03, 0x6A, 0x03, 0x10, 0x05, 0xAB, 0x03, 0xCB, 0x0B, 0xAE, 0x0C, 0xEF, 0x1C, 0x8E, 0x0C, 0xAB, 0x03, 0xAB, 0x03, 0xEC, 0x03, 0x8A, 0x03, 0x49, 0x03, 0x71, 0x15, 0x0C, 0x0C, 0x8B, 0x03, 0x29, 0x03, 0xF0, 0x14, 0x8B, 0x03, 0x6A, 0x03, 0x0C, 0x0C, 0xAB, 0x03, 0xE9, 0x02, 0xAB, 0x03, 0x2E, 0x0C, 0x4A, 0x03, 0xEC, 0x0B, 0x8B, 0x03, 0xF0, 0x1C, 0x6E, 0x1C, 0xEF, 0x2C, 0xEC, 0x13,
+    0xB2, 0x35, 0x10, 0x2D, 0x4E, 0x2C, 0xAE, 0x34, 0xD3, 0x3D, 0x0F, 0x45, 0x30, 0x3D, 0xAE, 0x3C, 0xD2, 0x4D, 0xEF, 0x44, 0x4C, 0x3C, 0x4D, 0x34, 0x0F, 0x45, 0x6D, 0x3C, 0x0B, 0x34, 0xEB, 0x33, 0xCB, 0x2B, 0xEB, 0x2B, 0x0C, 0x2C, 0xCF, 0x34, 0xCB, 0x23, 0x4E, 0x24, 0x4E, 0x24, 0x4E, 0x2C, 0x4E, 0x24, 0x4E, 0x2C, 0x0D, 0x24, 0xCC, 0x13, 0x2E, 0x24, 0x2D, 0x24, 0x2A, 0x13, 0xCB, 0x1B,
+    0x07, 0x02, 0x26, 0x02, 0x88, 0x02, 0x87, 0x02, 0x88, 0x02, 0xC8, 0x02, 0x2D, 0x24, 0x2B, 0x04, 0xCB, 0x0B, 0xA8, 0x02, 0xC8, 0x02, 0x2C, 0x04, 0xCB, 0x03, 0xE9, 0x02, 0x09, 0x03, 0x4D, 0x14, 0x8A, 0x03, 0x4A, 0x03, 0x09, 0x03, 0x8A, 0x03, 0xCE, 0x0C, 0x09, 0x03, 0xCC, 0x03, 0x4A, 0x03, 0x10, 0x05, 0xAB, 0x03, 0xCB, 0x03, 0xCB, 0x03, 0x2C, 0x04, 0x08, 0x03, 0xEC, 0x0B, 0xAE, 0x04,
+    0x6A, 0x03, 0x8A, 0x03, 0x8E, 0x04, 0x29, 0x03, 0x51, 0x0D, 0x2C, 0x0C, 0x6B, 0x03, 0xAB, 0x03, 0x8F, 0x14, 0x4A, 0x03, 0x0C, 0x0C, 0x8B, 0x03, 0xEC, 0x0B, 0xF3, 0x1D, 0xAE, 0x1C, 0x4D, 0x1C, 0x4D, 0x1C, 0x12, 0x2E, 0x2D, 0x24, 0xAE, 0x2C, 0x91, 0x25, 0xB1, 0x35, 0xCE, 0x34, 0x6D, 0x2C, 0x6D, 0x2C, 0xCE, 0x3C, 0x2F, 0x35, 0x50, 0x45, 0xAE, 0x44, 0x0C, 0x34, 0x0F, 0x35, 0x2C, 0x24,
+    0xEC, 0x2B, 0xEB, 0x2B, 0x30, 0x35, 0x70, 0x2D, 0x8A, 0x1B, 0x6E, 0x24, 0x2D, 0x1C, 0x0C, 0x24, 0xCC, 0x1B, 0x6E, 0x2C, 0xED, 0x1B, 0x2D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0xE8, 0x0A, 0xCC, 0x1B, 0x68, 0x02, 0x27, 0x02, 0x47, 0x02, 0x67, 0x02, 0x47, 0x02, 0xAB, 0x03, 0x0C, 0x14, 0x87, 0x02, 0xEE, 0x04, 0x67, 0x02, 0x6A, 0x03, 0xC8, 0x02, 0x87, 0x02, 0x51, 0x05, 0x29, 0x03, 0x4A, 0x03,
+    0xC8, 0x02, 0x0D, 0x0C, 0xE8, 0x02, 0x09, 0x03, 0x4A, 0x03, 0xCB, 0x03, 0x0F, 0x05, 0xCB, 0x03, 0x0C, 0x04, 0x6A, 0x03, 0x29, 0x03, 0x92, 0x0D, 0x8A, 0x03, 0x08, 0x03, 0xCE, 0x0C, 0xEC, 0x03, 0x6A, 0x03, 0x6A, 0x03, 0x8A, 0x03, 0x89, 0x03, 0xB2, 0x05, 0xEF, 0x1C, 0x6B, 0x03, 0xAB, 0x03, 0x8E, 0x0C, 0x73, 0x26, 0x2C, 0x0C, 0x4A, 0x03, 0xAB, 0x03, 0x59, 0x17, 0xAE, 0x0C, 0x30, 0x1D,
+    0x4D, 0x14, 0x2C, 0x14, 0xFE, 0x5F, 0x6C, 0x0C, 0x2C, 0x1C, 0xCE, 0x2C, 0x0F, 0x2D, 0x2F, 0x1D, 0x4C, 0x2C, 0x8D, 0x24, 0x2C, 0x2C, 0x32, 0x3E, 0x8D, 0x24, 0xCB, 0x23, 0xCB, 0x23, 0xCB, 0x23, 0x70, 0x35, 0xCE, 0x24, 0xCB, 0x23, 0xCB, 0x1B, 0x69, 0x0B, 0x30, 0x2D, 0x30, 0x2D, 0x4D, 0x2C, 0xAF, 0x24, 0xEF, 0x2C, 0xAB, 0x23, 0x51, 0x2D, 0xAB, 0x1B, 0x0C, 0x1C, 0x6A, 0x13, 0x0C, 0x1C,
+    0xE6, 0x01, 0x8B, 0x03, 0xE9, 0x02, 0x26, 0x02, 0x88, 0x02, 0xC8, 0x02, 0x08, 0x03, 0x66, 0x02, 0xE8, 0x02, 0xA8, 0x02, 0xC8, 0x02, 0x4D, 0x04, 0x2C, 0x0C, 0x67, 0x02, 0xC8, 0x02, 0x87, 0x02, 0xCE, 0x04, 0xA8, 0x02, 0x09, 0x03, 0x6D, 0x04, 0xC8, 0x02, 0x70, 0x05, 0x09, 0x03, 0xEF, 0x14, 0xE9, 0x02, 0xCC, 0x0B, 0xB1, 0x05, 0xEB, 0x0B, 0x8E, 0x14, 0xCB, 0x03, 0xAE, 0x14, 0xD2, 0x0D,
+    0x8B, 0x03, 0xEF, 0x04, 0x09, 0x03, 0x49, 0x03, 0xB4, 0x0E, 0x10, 0x1D, 0x6A, 0x03, 0x8B, 0x03, 0x4D, 0x04, 0x50, 0x05, 0x2C, 0x0C, 0x6A, 0x03, 0x31, 0x0D, 0xCB, 0x03, 0xFA, 0x1F, 0x50, 0x25, 0x6D, 0x0C, 0x8E, 0x1C, 0x4C, 0x0C, 0xD8, 0x3F, 0x4D, 0x1C, 0x6D, 0x24, 0xEE, 0x24, 0x12, 0x4E, 0xFA, 0x4F, 0x4C, 0x24, 0x4D, 0x24, 0xEB, 0x23, 0x2B, 0x1C, 0xD4, 0x56, 0x0F, 0x35, 0xAB, 0x23,
+    0x8A, 0x1B, 0xAA, 0x1B, 0x0F, 0x35, 0xF1, 0x3D, 0xAA, 0x13, 0x0D, 0x1C, 0x2D, 0x24, 0xAA, 0x13, 0xEF, 0x24, 0xEC, 0x1B, 0xCB, 0x13, 0x2C, 0x1C, 0xEC, 0x1B, 0x50, 0x2D, 0xEC, 0x1B, 0xEC, 0x1B, 0x88, 0x02, 0x67, 0x02, 0x27, 0x02, 0x05, 0x02, 0xCD, 0x04, 0x2C, 0x04, 0x05, 0x02, 0x47, 0x02, 0x87, 0x02, 0x49, 0x03, 0x0F, 0x05, 0x66, 0x02, 0xC8, 0x02, 0xE8, 0x02, 0x4A, 0x0B, 0x0F, 0x05,
+    0xE9, 0x02, 0x4D, 0x0C, 0x09, 0x03, 0xE8, 0x02, 0xE8, 0x02, 0x6E, 0x04, 0x49, 0x03, 0x09, 0x03, 0x09, 0x03, 0x2F, 0x1D, 0x4A, 0x03, 0xD5, 0x3E, 0xEC, 0x03, 0x30, 0x0D, 0x34, 0x3E, 0x4D, 0x04, 0x6A, 0x03, 0xCB, 0x03, 0x6D, 0x04, 0x6A, 0x03, 0xEB, 0x03, 0x8E, 0x0C, 0x6A, 0x03, 0xAB, 0x03, 0xAF, 0x04, 0x50, 0x15, 0xCE, 0x14, 0xCB, 0x03, 0x2C, 0x04, 0x33, 0x2E, 0xCE, 0x04, 0xAD, 0x14,
+    0xAE, 0x04, 0x91, 0x15, 0xCE, 0x14, 0xCE, 0x0C, 0x2F, 0x0D, 0x6D, 0x14, 0xCE, 0x1C, 0xAD, 0x14, 0xAD, 0x14, 0x90, 0x3D, 0x0C, 0x1C, 0xCB, 0x13, 0xEB, 0x1B, 0x0B, 0x1C, 0xAB, 0x1B, 0x8A, 0x1B, 0x69, 0x13, 0x8A, 0x1B, 0xCB, 0x1B, 0x8A, 0x13, 0x6A, 0x0B, 0xEC, 0x1B, 0x0C, 0x1C, 0x6A, 0x0B, 0x0C, 0x1C, 0x4D, 0x24, 0x8B, 0x13, 0xEC, 0x13, 0xCB, 0x1B, 0x0C, 0x1C, 0x6A, 0x0B, 0xCB, 0x1B,
+    0x07, 0x02, 0xF0, 0x24, 0x27, 0x02, 0x67, 0x0A, 0x47, 0x02, 0x88, 0x02, 0x68, 0x02, 0x68, 0x02, 0xEB, 0x0B, 0x67, 0x02, 0xE9, 0x02, 0x0C, 0x14, 0x2A, 0x03, 0xE9, 0x02, 0xE8, 0x02, 0x4A, 0x03, 0xA8, 0x02, 0x87, 0x02, 0xEB, 0x03, 0x08, 0x03, 0x6D, 0x0C, 0x2D, 0x0C, 0xE8, 0x02, 0x8E, 0x24, 0x50, 0x05, 0x8A, 0x03, 0x6A, 0x03, 0xB2, 0x2D, 0xCF, 0x04, 0x49, 0x03, 0x4D, 0x14, 0x29, 0x03,
+    0xAE, 0x0C, 0x4C, 0x04, 0x4D, 0x04, 0x6D, 0x14, 0x2C, 0x04, 0xAE, 0x04, 0x6A, 0x03, 0xEC, 0x03, 0x8F, 0x04, 0x8E, 0x14, 0xF2, 0x1D, 0x0C, 0x04, 0x6D, 0x04, 0xB8, 0x0F, 0x70, 0x05, 0x91, 0x0D, 0x0F, 0x05, 0xFF, 0xD7, 0x32, 0x0E, 0xF1, 0x0D, 0xCE, 0x0C, 0xFE, 0x17, 0x2E, 0x15, 0xAD, 0x14, 0x4C, 0x0C, 0x0E, 0x05, 0xEB, 0x0B, 0xCA, 0x13, 0xC9, 0x03, 0xCB, 0x13, 0xAA, 0x13, 0x28, 0x03,
+    0x49, 0x13, 0x6A, 0x13, 0x2F, 0x25, 0xCB, 0x13, 0x69, 0x0B, 0xEB, 0x1B, 0xAE, 0x1C, 0x8A, 0x0B, 0xEC, 0x13, 0xAB, 0x13, 0x09, 0x03, 0x0C, 0x14, 0x8A, 0x0B, 0xCB, 0x1B, 0xAB, 0x13, 0xCB, 0x13, 0xEA, 0x0A, 0x2A, 0x0B, 0x47, 0x02, 0x92, 0x3D, 0x27, 0x02, 0x09, 0x03, 0xD1, 0x3C, 0x67, 0x02, 0x47, 0x02, 0x09, 0x03, 0x2C, 0x04, 0x87, 0x02, 0x88, 0x02, 0x29, 0x03, 0x12, 0x26, 0xA8, 0x02,
+    0xA7, 0x02, 0xA8, 0x02, 0xEC, 0x1B, 0x6D, 0x04, 0x0C, 0x04, 0xC8, 0x02, 0xA7, 0x02, 0xAE, 0x04, 0x09, 0x03, 0x08, 0x03, 0x8A, 0x03, 0x10, 0x1D, 0x29, 0x03, 0x49, 0x03, 0xAE, 0x0C, 0x09, 0x03, 0x0F, 0x0D, 0x70, 0x15, 0xCF, 0x1C, 0xEF, 0x1C, 0x91, 0x05, 0xEF, 0x04, 0xAB, 0x03, 0xEC, 0x03, 0x2C, 0x04, 0xB4, 0x16, 0x58, 0x37, 0x2C, 0x04, 0x91, 0x05, 0xFF, 0xFF, 0xB1, 0x05, 0xEF, 0x04,
+    0x2F, 0x05, 0x94, 0x06, 0xDE, 0x3F, 0x58, 0x0F, 0xEE, 0x04, 0xEE, 0x04, 0x9D, 0x8F, 0xB5, 0x26, 0x6C, 0x0C, 0x0E, 0x1D, 0x4C, 0x04, 0xF1, 0x1D, 0x0A, 0x04, 0x89, 0x03, 0x8A, 0x13, 0xEF, 0x24, 0x0F, 0x2D, 0xEF, 0x2C, 0x69, 0x0B, 0x8A, 0x03, 0x28, 0x03, 0x0C, 0x1C, 0xCB, 0x13, 0x29, 0x03, 0xAB, 0x13, 0x30, 0x25, 0xEC, 0x1B, 0xAB, 0x13, 0xAB, 0x13, 0xEC, 0x1B, 0x49, 0x0B, 0xCC, 0x13,
+    0xE6, 0x01, 0xE6, 0x01, 0xE6, 0x01, 0x6A, 0x03, 0x4A, 0x0B, 0x05, 0x02, 0x27, 0x02, 0x27, 0x02, 0xEB, 0x03, 0x66, 0x02, 0x88, 0x02, 0x8A, 0x03, 0x67, 0x02, 0x6D, 0x04, 0x95, 0x3E, 0x8B, 0x03, 0xE8, 0x02, 0xA8, 0x02, 0x89, 0x03, 0xE8, 0x02, 0xC8, 0x02, 0xC8, 0x02, 0x50, 0x05, 0xAB, 0x13, 0xE8, 0x02, 0x29, 0x03, 0xCB, 0x03, 0xEF, 0x14, 0xCB, 0x03, 0x29, 0x03, 0x8A, 0x0B, 0x0F, 0x05,
+    0x4A, 0x03, 0x98, 0x37, 0xCB, 0x03, 0x75, 0x3E, 0x73, 0x06, 0x6D, 0x04, 0x8B, 0x03, 0xEB, 0x03, 0x4D, 0x04, 0xFB, 0x27, 0xF1, 0x15, 0x0B, 0x04, 0xD1, 0x05, 0xF2, 0x05, 0x73, 0x06, 0x2F, 0x05, 0x73, 0x0E, 0x11, 0x06, 0xFF, 0xE7, 0x56, 0x0F, 0x94, 0x16, 0xEE, 0x04, 0x73, 0x0E, 0xFF, 0x07, 0x70, 0x15, 0xB1, 0x2D, 0x0B, 0x04, 0xAE, 0x14, 0x6B, 0x04, 0x0B, 0x14, 0x6A, 0x0B, 0x48, 0x03,
+    0x28, 0x0B, 0x73, 0x1E, 0xD1, 0x3D, 0xAD, 0x14, 0xCE, 0x24, 0xAA, 0x0B, 0x70, 0x25, 0x6A, 0x0B, 0x4D, 0x1C, 0xAA, 0x0B, 0x0C, 0x1C, 0x6D, 0x1C, 0xEC, 0x1B, 0x8B, 0x13, 0xCB, 0x13, 0x6A, 0x0B, 0xE6, 0x01, 0xAC, 0x0B, 0x4A, 0x03, 0x27, 0x02, 0x07, 0x02, 0x88, 0x02, 0x4D, 0x04, 0xA8, 0x02, 0x26, 0x02, 0xA4, 0x01, 0xCC, 0x03, 0x6D, 0x0C, 0x05, 0x02, 0x67, 0x02, 0x87, 0x02, 0x09, 0x03,
+    0xEE, 0x04, 0x88, 0x02, 0x6A, 0x03, 0x25, 0x02, 0x66, 0x02, 0xAE, 0x04, 0xA7, 0x02, 0x4A, 0x03, 0x09, 0x03, 0xEF, 0x0C, 0xC8, 0x02, 0x8D, 0x0C, 0xE9, 0x02, 0x49, 0x03, 0x0B, 0x04, 0x34, 0x1E, 0x8A, 0x03, 0x2F, 0x0D, 0x0C, 0x04, 0x96, 0x2E, 0x94, 0x06, 0xEF, 0x04, 0xAB, 0x03, 0xEC, 0x03, 0x4D, 0x04, 0x70, 0x05, 0x36, 0x17, 0x8E, 0x04, 0x12, 0x0E, 0x70, 0x05, 0xFF, 0x1F, 0x70, 0x05,
+    0xB4, 0x16, 0xF1, 0x05, 0x12, 0x06, 0xFD, 0x0F, 0x95, 0x1E, 0xB1, 0x0D, 0xD3, 0x06, 0x4F, 0x05, 0xFC, 0x0F, 0x32, 0x26, 0xEA, 0x03, 0x2C, 0x04, 0x0F, 0x1D, 0x0B, 0x04, 0x69, 0x0B, 0xAA, 0x0B, 0x0C, 0x14, 0x49, 0x03, 0x8E, 0x2C, 0xEA, 0x03, 0x8A, 0x03, 0x6A, 0x0B, 0xAB, 0x0B, 0xAA, 0x03, 0x70, 0x2D, 0xAB, 0x0B, 0x8A, 0x13, 0xCB, 0x13, 0x6A, 0x0B, 0x8D, 0x1C, 0x4A, 0x0B, 0x8A, 0x13,
+    0xAB, 0x03, 0xE6, 0x01, 0x06, 0x02, 0x27, 0x02, 0x27, 0x02, 0x8D, 0x04, 0x06, 0x02, 0x68, 0x02, 0x30, 0x2D, 0x87, 0x02, 0x8D, 0x04, 0x88, 0x02, 0x87, 0x02, 0x67, 0x02, 0x46, 0x02, 0xAE, 0x04, 0x87, 0x02, 0x87, 0x02, 0x87, 0x02, 0xE7, 0x02, 0x4F, 0x05, 0x67, 0x02, 0x86, 0x02, 0x6A, 0x03, 0x91, 0x15, 0x09, 0x03, 0x49, 0x03, 0x4C, 0x04, 0xAE, 0x04, 0x49, 0x03, 0x0B, 0x04, 0x89, 0x03,
+    0x6C, 0x04, 0x89, 0x03, 0xCB, 0x03, 0x50, 0x0D, 0x0B, 0x04, 0x10, 0x05, 0xAB, 0x03, 0x0C, 0x04, 0x6D, 0x04, 0x56, 0x07, 0x1A, 0x0F, 0xCE, 0x04, 0x56, 0x0E, 0xFF, 0x87, 0xBA, 0x0F, 0x73, 0x0E, 0xF1, 0x05, 0xFF, 0xFF, 0xD4, 0x06, 0xFD, 0x0F, 0xB1, 0x05, 0xFF, 0xF7, 0x73, 0x06, 0x32, 0x16, 0xEE, 0x04, 0x53, 0x06, 0x4C, 0x04, 0xCA, 0x03, 0x32, 0x26, 0x8D, 0x14, 0x69, 0x03, 0x69, 0x03,
+    0x6D, 0x14, 0x49, 0x03, 0xAD, 0x14, 0xCB, 0x13, 0x0C, 0x1C, 0xAB, 0x13, 0x6D, 0x14, 0x8A, 0x0B, 0x8B, 0x13, 0x8A, 0x13, 0x6A, 0x13, 0x0C, 0x14, 0x49, 0x0B, 0x8A, 0x0B, 0x6A, 0x13, 0x8A, 0x0B, 0xC6, 0x01, 0x07, 0x02, 0x07, 0x02, 0xE6, 0x01, 0x07, 0x02, 0x88, 0x0A, 0xC6, 0x01, 0x29, 0x0B, 0xAC, 0x13, 0xAF, 0x24, 0x46, 0x02, 0x88, 0x02, 0x4A, 0x0B, 0xC4, 0x01, 0x46, 0x02, 0x47, 0x02,
+    0x4A, 0x03, 0x26, 0x02, 0x46, 0x02, 0xEF, 0x14, 0xC8, 0x02, 0xA7, 0x02, 0xA7, 0x02, 0x4D, 0x04, 0x8A, 0x03, 0x8A, 0x03, 0xEB, 0x03, 0x49, 0x03, 0xCA, 0x03, 0x0C, 0x14, 0x6A, 0x03, 0x0F, 0x0D, 0xEE, 0x04, 0x28, 0x03, 0xAB, 0x03, 0x2C, 0x04, 0xB1, 0x05, 0xAF, 0x04, 0xCB, 0x03, 0x0C, 0x04, 0xB1, 0x15, 0x9C, 0x17, 0x9D, 0x0F, 0xEE, 0x04, 0xFB, 0x0F, 0xFF, 0xFF, 0xB9, 0x0F, 0xD1, 0x05,
+    0xB4, 0x06, 0xFF, 0xA7, 0xFE, 0x07, 0xFF, 0x47, 0x12, 0x06, 0x93, 0x06, 0xFF, 0xFF, 0xB9, 0x0F, 0x0E, 0x05, 0x32, 0x16, 0x18, 0x07, 0x8C, 0x04, 0x59, 0x57, 0x91, 0x2D, 0xAD, 0x0C, 0x4F, 0x1D, 0x69, 0x03, 0x69, 0x03, 0x27, 0x03, 0x8D, 0x14, 0x69, 0x0B, 0x8A, 0x13, 0x29, 0x0B, 0x4D, 0x1C, 0x6A, 0x0B, 0x29, 0x03, 0xAB, 0x13, 0x8A, 0x0B, 0x6A, 0x0B, 0x8A, 0x0B, 0x8A, 0x13, 0x6A, 0x13,
+    0x07, 0x02, 0xE6, 0x01, 0xE6, 0x01, 0x07, 0x02, 0x06, 0x02, 0x26, 0x02, 0x07, 0x02, 0x06, 0x02, 0x26, 0x02, 0xAC, 0x1B, 0xE5, 0x01, 0x88, 0x02, 0xC9, 0x0A, 0x2A, 0x0B, 0x87, 0x02, 0x09, 0x03, 0x26, 0x02, 0x67, 0x02, 0x6A, 0x03, 0x87, 0x02, 0xAB, 0x13, 0x09, 0x03, 0x70, 0x15, 0x87, 0x02, 0x49, 0x03, 0x4A, 0x03, 0x13, 0x3E, 0x4C, 0x0C, 0x09, 0x03, 0xAB, 0x03, 0x6A, 0x03, 0x0C, 0x04,
+    0x90, 0x15, 0x4C, 0x04, 0x8A, 0x03, 0x29, 0x03, 0xF2, 0x05, 0x8E, 0x04, 0xAB, 0x03, 0x2C, 0x04, 0x71, 0x05, 0xFF, 0xAF, 0x93, 0x06, 0x0F, 0x05, 0xF5, 0x06, 0xFF, 0xF7, 0xFF, 0x07, 0x32, 0x06, 0xB4, 0x06, 0xFB, 0x07, 0xFF, 0xFF, 0xFF, 0x07, 0xD5, 0x06, 0x12, 0x06, 0xFF, 0x87, 0x9E, 0x87, 0xD1, 0x05, 0x90, 0x0D, 0x8C, 0x04, 0x97, 0x07, 0x12, 0x1E, 0x50, 0x25, 0x49, 0x03, 0x6D, 0x0C,
+    0x2F, 0x0D, 0x49, 0x03, 0x49, 0x03, 0xEF, 0x1C, 0x6D, 0x14, 0x8A, 0x03, 0x8A, 0x0B, 0x49, 0x0B, 0x8A, 0x0B, 0x4C, 0x0C, 0x6A, 0x0B, 0x6A, 0x0B, 0x8B, 0x0B, 0x29, 0x0B, 0x49, 0x0B, 0x6A, 0x0B, 0xE6, 0x01, 0x07, 0x02, 0xC6, 0x01, 0xE6, 0x01, 0xC6, 0x01, 0x07, 0x02, 0x07, 0x02, 0xE6, 0x01, 0xCC, 0x13, 0x67, 0x0A, 0xC8, 0x02, 0x06, 0x02, 0xA8, 0x0A, 0xE9, 0x02, 0x09, 0x03, 0x26, 0x02,
+    0x26, 0x02, 0x87, 0x02, 0x06, 0x02, 0xC8, 0x02, 0x09, 0x0B, 0xE9, 0x0A, 0xF7, 0x46, 0xC8, 0x02, 0x29, 0x03, 0xC8, 0x02, 0xAA, 0x03, 0xEB, 0x03, 0x4A, 0x03, 0xAD, 0x14, 0xE8, 0x02, 0x30, 0x05, 0x29, 0x03, 0x4D, 0x0C, 0x50, 0x25, 0x31, 0x0E, 0x12, 0x06, 0xAE, 0x04, 0xCB, 0x03, 0x2C, 0x04, 0xEE, 0x04, 0xBD, 0x17, 0xCF, 0x05, 0xD1, 0x05, 0x56, 0x0F, 0xFC, 0x07, 0xFF, 0x67, 0x15, 0x07,
+    0xB3, 0x06, 0xD9, 0x07, 0xFF, 0xB7, 0xDE, 0x07, 0x52, 0x06, 0x90, 0x05, 0x76, 0x07, 0xFF, 0x4F, 0xD1, 0x05, 0x90, 0x05, 0x2B, 0x04, 0x8D, 0x04, 0x14, 0x0F, 0x2B, 0x04, 0x49, 0x03, 0x28, 0x03, 0xCA, 0x03, 0xB0, 0x05, 0x50, 0x2D, 0x0C, 0x24, 0xEB, 0x13, 0x49, 0x0B, 0xCE, 0x0C, 0x49, 0x0B, 0x8A, 0x0B, 0x6A, 0x0B, 0x29, 0x03, 0x8D, 0x1C, 0x29, 0x0B, 0x4A, 0x0B, 0x29, 0x0B, 0x29, 0x03,
+    0xC6, 0x01, 0xA4, 0x01, 0xCC, 0x0B, 0xA5, 0x01, 0x48, 0x0A, 0xA6, 0x01, 0xE6, 0x01, 0x2A, 0x03, 0xC6, 0x01, 0xA5, 0x01, 0x06, 0x02, 0x2A, 0x0B, 0x68, 0x02, 0x2A, 0x13, 0x06, 0x02, 0x46, 0x02, 0x6D, 0x0C, 0x27, 0x02, 0x26, 0x02, 0xA7, 0x02, 0xEC, 0x0B, 0xE9, 0x0A, 0xEF, 0x24, 0x0C, 0x0C, 0x87, 0x02, 0x4A, 0x03, 0xAA, 0x03, 0xE8, 0x02, 0x29, 0x03, 0xC8, 0x02, 0xEB, 0x03, 0x89, 0x03,
+    0x28, 0x03, 0xC8, 0x02, 0xAA, 0x03, 0x89, 0x03, 0x73, 0x06, 0xCF, 0x04, 0x8A, 0x03, 0x8A, 0x03, 0x2C, 0x04, 0xDC, 0x37, 0xD4, 0x16, 0x4F, 0x05, 0xFB, 0x2F, 0xFE, 0x47, 0xFF, 0x27, 0x50, 0x05, 0xB0, 0x05, 0xFF, 0xC7, 0x14, 0x07, 0xDE, 0x0F, 0x8F, 0x05, 0xFF, 0xF7, 0xD4, 0x06, 0x90, 0x05, 0xFF, 0x0F, 0x2E, 0x05, 0x6C, 0x04, 0x89, 0x03, 0x37, 0x47, 0xC9, 0x03, 0xEB, 0x0B, 0x08, 0x03,
+    0xE8, 0x02, 0xF1, 0x25, 0xAD, 0x04, 0x8A, 0x13, 0x28, 0x03, 0x6A, 0x0B, 0x50, 0x2D, 0x8A, 0x0B, 0x8A, 0x0B, 0x6A, 0x0B, 0xE8, 0x02, 0x87, 0x02, 0xEB, 0x0B, 0x0C, 0x14, 0x49, 0x0B, 0x6A, 0x0B, 0x6A, 0x03, 0xA5, 0x01, 0x07, 0x02, 0xE6, 0x01, 0x27, 0x02, 0xCB, 0x03, 0xC6, 0x01, 0x8B, 0x03, 0x06, 0x02, 0xC5, 0x01, 0xEB, 0x03, 0x09, 0x0B, 0x26, 0x02, 0x06, 0x02, 0xC5, 0x01, 0x4C, 0x04,
+    0x26, 0x02, 0xC5, 0x01, 0x66, 0x02, 0xA7, 0x02, 0xE8, 0x02, 0x29, 0x03, 0x8F, 0x2C, 0x26, 0x02, 0x29, 0x03, 0xE8, 0x02, 0x8E, 0x0C, 0x26, 0x02, 0x29, 0x03, 0xE8, 0x02, 0xA7, 0x02, 0x0B, 0x04, 0x90, 0x0D, 0xAA, 0x03, 0xAB, 0x03, 0x28, 0x03, 0xB1, 0x05, 0x8E, 0x04, 0xAA, 0x03, 0xAA, 0x03, 0xEB, 0x03, 0x97, 0x07, 0x8F, 0x05, 0x0E, 0x05, 0xB7, 0x17, 0xFF, 0x1F, 0xFF, 0x07, 0x90, 0x05,
+    0xF1, 0x05, 0xFF, 0x07, 0xFA, 0x07, 0xBC, 0x27, 0x70, 0x05, 0xF1, 0x05, 0xFE, 0x47, 0x93, 0x0E, 0x50, 0x05, 0x0E, 0x0D, 0x0D, 0x05, 0x2E, 0x05, 0x0F, 0x1D, 0x28, 0x03, 0x0B, 0x04, 0xAA, 0x0B, 0x08, 0x03, 0xA6, 0x02, 0x6C, 0x14, 0x69, 0x03, 0x08, 0x03, 0xE8, 0x02, 0x09, 0x03, 0x0B, 0x04, 0x08, 0x03, 0x08, 0x0B, 0x4A, 0x0B, 0x8A, 0x13, 0x29, 0x0B, 0xAB, 0x13, 0x29, 0x0B, 0x49, 0x0B,
+    0x07, 0x02, 0xA5, 0x01, 0xA5, 0x01, 0xC6, 0x01, 0xA5, 0x01, 0xC9, 0x12, 0xC9, 0x0A, 0xE6, 0x01, 0xC6, 0x01, 0xA5, 0x01, 0xCB, 0x0B, 0x84, 0x01, 0xE5, 0x01, 0xE6, 0x01, 0xCB, 0x03, 0xC5, 0x01, 0xE5, 0x01, 0xA4, 0x01, 0x26, 0x02, 0x49, 0x03, 0x06, 0x02, 0xC8, 0x02, 0x87, 0x02, 0xEF, 0x14, 0x29, 0x03, 0x08, 0x03, 0xA7, 0x02, 0x87, 0x02, 0x67, 0x02, 0x2C, 0x04, 0xE8, 0x02, 0xE8, 0x02,
+    0xC8, 0x02, 0xAE, 0x0C, 0x08, 0x03, 0xC7, 0x02, 0x09, 0x03, 0x8D, 0x04, 0x89, 0x03, 0x8A, 0x03, 0x0B, 0x04, 0x70, 0x0D, 0x4E, 0x05, 0x8D, 0x04, 0x73, 0x0E, 0xBD, 0x2F, 0x14, 0x07, 0x11, 0x06, 0x93, 0x06, 0xB7, 0x07, 0xDD, 0x37, 0xFD, 0x0F, 0x53, 0x06, 0x8F, 0x05, 0xFE, 0x07, 0xBA, 0x1F, 0x73, 0x0E, 0xCD, 0x04, 0x0E, 0x0D, 0xD0, 0x05, 0x30, 0x0D, 0x49, 0x03, 0x08, 0x03, 0xAA, 0x03,
+    0x6A, 0x03, 0xE7, 0x02, 0x2C, 0x1C, 0x89, 0x0B, 0x8D, 0x0C, 0xE8, 0x02, 0xC7, 0x02, 0x08, 0x03, 0xAB, 0x13, 0xEB, 0x0B, 0x29, 0x0B, 0x6A, 0x13, 0x8A, 0x0B, 0xC8, 0x02, 0x6A, 0x0B, 0x29, 0x0B, 0x85, 0x01, 0x85, 0x01, 0xA5, 0x01, 0xC6, 0x09, 0x4B, 0x0B, 0xC6, 0x01, 0xC5, 0x01, 0x85, 0x01, 0xC5, 0x01, 0xA9, 0x02, 0xC6, 0x01, 0xC5, 0x01, 0xC5, 0x01, 0xE9, 0x02, 0x27, 0x02, 0xA5, 0x01,
+    0xC5, 0x01, 0xC8, 0x02, 0xEB, 0x0B, 0xE5, 0x01, 0x09, 0x03, 0x09, 0x03, 0xC4, 0x01, 0x26, 0x02, 0x46, 0x02, 0xA7, 0x02, 0xA7, 0x02, 0xCE, 0x0C, 0x67, 0x02, 0xCB, 0x0B, 0xA8, 0x02, 0x69, 0x03, 0xE8, 0x02, 0x6D, 0x0C, 0xC7, 0x02, 0xE8, 0x02, 0x53, 0x16, 0xAE, 0x0C, 0x49, 0x03, 0x6A, 0x03, 0xAD, 0x04, 0xFF, 0xE7, 0x0D, 0x05, 0x8C, 0x04, 0xF1, 0x05, 0xD9, 0x07, 0x75, 0x07, 0x8F, 0x05,
+    0xB0, 0x05, 0x35, 0x07, 0xFF, 0xFF, 0xFC, 0x07, 0x90, 0x05, 0x4E, 0x05, 0xB6, 0x0F, 0x51, 0x06, 0xCD, 0x04, 0x6C, 0x04, 0x2B, 0x04, 0x0B, 0x04, 0xEE, 0x14, 0x28, 0x03, 0x08, 0x03, 0xE8, 0x02, 0xEA, 0x03, 0x08, 0x03, 0x6A, 0x0B, 0xE8, 0x02, 0xCB, 0x0B, 0xE8, 0x02, 0xE8, 0x02, 0xC7, 0x02, 0xE8, 0x02, 0x29, 0x03, 0xC8, 0x02, 0xE8, 0x0A, 0xE8, 0x02, 0x09, 0x0B, 0x09, 0x0B, 0x08, 0x03,
+    0x85, 0x01, 0x06, 0x0A, 0xC6, 0x09, 0xA5, 0x01, 0x85, 0x01, 0x85, 0x01, 0xA5, 0x01, 0x84, 0x01, 0xC5, 0x01, 0xA5, 0x01, 0xA5, 0x01, 0xA5, 0x01, 0x2D, 0x14, 0x84, 0x01, 0xA5, 0x01, 0xE6, 0x01, 0xC8, 0x02, 0xE9, 0x02, 0x46, 0x02, 0x06, 0x02, 0xA8, 0x0A, 0x09, 0x0B, 0xE7, 0x02, 0x4A, 0x03, 0x46, 0x02, 0x67, 0x02, 0x0C, 0x0C, 0x67, 0x02, 0x46, 0x02, 0x87, 0x02, 0xCB, 0x03, 0x4F, 0x05,
+    0xE8, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0x8A, 0x03, 0x12, 0x06, 0x49, 0x03, 0x69, 0x03, 0x6A, 0x03, 0x6D, 0x04, 0xFF, 0x4F, 0xCE, 0x04, 0x6D, 0x04, 0x70, 0x05, 0x37, 0x07, 0xFF, 0xFF, 0xF1, 0x0D, 0x2E, 0x05, 0xB9, 0x0F, 0xDA, 0x07, 0xFF, 0x6F, 0x6F, 0x05, 0xFF, 0x57, 0x73, 0x0E, 0xDE, 0x0F, 0x2E, 0x05, 0x6C, 0x04, 0x0B, 0x04, 0x69, 0x03, 0xD5, 0x16, 0xEA, 0x03, 0x0B, 0x0C, 0xE7, 0x02,
+    0xA7, 0x02, 0x90, 0x15, 0x49, 0x03, 0xC8, 0x02, 0xC8, 0x02, 0xC7, 0x02, 0x8D, 0x1C, 0xE8, 0x0A, 0xE8, 0x0A, 0xC8, 0x02, 0x29, 0x0B, 0x04, 0x02, 0x08, 0x0B, 0xE9, 0x0A, 0x29, 0x0B, 0x09, 0x0B, 0x65, 0x01, 0x65, 0x01, 0x2B, 0x13, 0xC6, 0x01, 0x85, 0x01, 0x85, 0x01, 0x65, 0x01, 0xC9, 0x02, 0x44, 0x01, 0xA5, 0x01, 0xA5, 0x01, 0x68, 0x02, 0xC6, 0x01, 0xA5, 0x01, 0xA5, 0x01, 0x67, 0x02,
+    0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x47, 0x02, 0x88, 0x02, 0xE5, 0x01, 0x87, 0x02, 0x46, 0x02, 0xAE, 0x14, 0x26, 0x02, 0x6A, 0x03, 0x46, 0x02, 0x66, 0x02, 0x67, 0x02, 0x66, 0x02, 0x98, 0x37, 0x09, 0x03, 0x6A, 0x03, 0xC8, 0x02, 0x08, 0x03, 0x73, 0x0E, 0x29, 0x03, 0x29, 0x03, 0x49, 0x03, 0x8B, 0x03, 0xD5, 0x0E, 0xED, 0x04, 0x2B, 0x04, 0xCD, 0x04, 0xCD, 0x04, 0xFD, 0x0F, 0xAD, 0x04,
+    0x2F, 0x05, 0x4F, 0x05, 0x90, 0x05, 0xBE, 0x27, 0xED, 0x04, 0xAD, 0x04, 0x90, 0x0D, 0xED, 0x04, 0xFF, 0x1F, 0x4C, 0x04, 0x2B, 0x04, 0x29, 0x03, 0x6C, 0x04, 0xA7, 0x02, 0xE8, 0x02, 0xEB, 0x13, 0xA7, 0x02, 0xB9, 0x6F, 0x89, 0x03, 0xC8, 0x02, 0xC8, 0x02, 0xA7, 0x02, 0x8A, 0x0B, 0x0F, 0x25, 0xC8, 0x02, 0xC8, 0x0A, 0xC8, 0x0A, 0x87, 0x02, 0x0B, 0x0C, 0xAB, 0x13, 0xE8, 0x0A, 0x29, 0x0B,
+    0x31, 0x25, 0xA6, 0x01, 0xE6, 0x09, 0xA5, 0x01, 0x64, 0x01, 0x8B, 0x03, 0xE9, 0x0A, 0x2A, 0x23, 0x84, 0x01, 0xA5, 0x01, 0x8B, 0x03, 0xA5, 0x01, 0xA5, 0x01, 0x84, 0x01, 0xA8, 0x02, 0x2C, 0x04, 0xC5, 0x01, 0x06, 0x02, 0x06, 0x02, 0x8A, 0x03, 0xC5, 0x01, 0x8E, 0x14, 0x26, 0x02, 0x8A, 0x03, 0x06, 0x02, 0x05, 0x02, 0x8D, 0x0C, 0x67, 0x02, 0xAB, 0x0B, 0xCB, 0x03, 0x66, 0x02, 0xD1, 0x05,
+    0xEE, 0x04, 0x4C, 0x04, 0xC8, 0x02, 0x09, 0x03, 0x33, 0x06, 0x6A, 0x03, 0x29, 0x03, 0x09, 0x03, 0x49, 0x03, 0x76, 0x07, 0x8C, 0x04, 0xEA, 0x03, 0x4C, 0x04, 0xFF, 0xD7, 0xFE, 0x07, 0x2B, 0x04, 0xCE, 0x04, 0xEE, 0x04, 0xCD, 0x04, 0xFF, 0x5F, 0x2E, 0x05, 0x2C, 0x04, 0xFF, 0xAF, 0x2C, 0x04, 0xCF, 0x0C, 0xEB, 0x03, 0xEB, 0x03, 0x49, 0x03, 0xEB, 0x0B, 0xE8, 0x02, 0x71, 0x1D, 0xE8, 0x02,
+    0x87, 0x02, 0x08, 0x0B, 0x87, 0x02, 0x6C, 0x0C, 0x66, 0x02, 0x87, 0x02, 0xA8, 0x0A, 0xA7, 0x02, 0xC7, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0x09, 0x0B, 0xE8, 0x0A, 0x08, 0x0B, 0x65, 0x01, 0x03, 0x01, 0x44, 0x01, 0x44, 0x01, 0xA5, 0x01, 0x64, 0x01, 0xA5, 0x01, 0x23, 0x01, 0x64, 0x01, 0xB0, 0x34, 0xC5, 0x01, 0x64, 0x01, 0xA4, 0x01, 0x88, 0x02, 0xA4, 0x01, 0xA5, 0x01,
+    0xE5, 0x01, 0xE8, 0x02, 0x47, 0x02, 0xE5, 0x01, 0x06, 0x02, 0xE9, 0x02, 0xA8, 0x0A, 0x67, 0x02, 0x26, 0x02, 0x6A, 0x03, 0x46, 0x02, 0x4D, 0x04, 0xA8, 0x02, 0xEB, 0x03, 0x67, 0x02, 0xA8, 0x02, 0xEF, 0x0C, 0xCD, 0x0C, 0xA7, 0x02, 0x6A, 0x03, 0xAD, 0x04, 0x8A, 0x03, 0x08, 0x03, 0xC8, 0x02, 0x49, 0x03, 0x90, 0x05, 0x2B, 0x04, 0xAA, 0x03, 0x0B, 0x04, 0x0F, 0x05, 0xAD, 0x04, 0x2B, 0x04,
+    0x2B, 0x04, 0x8C, 0x04, 0xFF, 0xFF, 0xCD, 0x04, 0x2B, 0x04, 0x0B, 0x04, 0xCD, 0x04, 0x0B, 0x04, 0x69, 0x03, 0x49, 0x03, 0x49, 0x03, 0x12, 0x06, 0xCB, 0x0B, 0xC8, 0x02, 0x87, 0x02, 0xA7, 0x02, 0xCD, 0x04, 0x09, 0x13, 0xA7, 0x02, 0x87, 0x02, 0x6C, 0x0C, 0x46, 0x02, 0x67, 0x02, 0x87, 0x02, 0x87, 0x0A, 0xEB, 0x13, 0x87, 0x02, 0x87, 0x02, 0xA7, 0x02, 0xC8, 0x0A, 0xE8, 0x02, 0x29, 0x0B,
+    0x44, 0x01, 0x44, 0x01, 0x85, 0x01, 0x64, 0x01, 0x0A, 0x03, 0x64, 0x01, 0x85, 0x01, 0x85, 0x01, 0xA6, 0x01, 0x23, 0x01, 0xE6, 0x09, 0x64, 0x01, 0xA5, 0x01, 0xCB, 0x03, 0x84, 0x01, 0xA5, 0x01, 0xA4, 0x01, 0x06, 0x02, 0x84, 0x01, 0xE5, 0x01, 0xC5, 0x01, 0x06, 0x02, 0xA5, 0x01, 0x09, 0x13, 0xC5, 0x01, 0x06, 0x02, 0x26, 0x02, 0x47, 0x02, 0x47, 0x02, 0x46, 0x02, 0x46, 0x02, 0xA8, 0x02,
+    0x46, 0x02, 0x26, 0x02, 0xA7, 0x02, 0xCB, 0x13, 0xE8, 0x02, 0xE8, 0x02, 0xE8, 0x02, 0xE8, 0x02, 0x69, 0x03, 0xD1, 0x15, 0x2B, 0x04, 0x69, 0x03, 0x0B, 0x04, 0x4F, 0x05, 0x0B, 0x04, 0xEB, 0x03, 0x8C, 0x04, 0xD1, 0x0D, 0xAD, 0x04, 0xAD, 0x04, 0x2B, 0x04, 0x4F, 0x05, 0x8B, 0x04, 0xAA, 0x03, 0x49, 0x03, 0xEA, 0x03, 0x69, 0x03, 0xE8, 0x02, 0x0E, 0x0D, 0xEB, 0x0B, 0xC7, 0x02, 0x87, 0x02,
+    0x87, 0x02, 0x89, 0x03, 0x87, 0x02, 0x46, 0x02, 0x25, 0x02, 0xA7, 0x02, 0x45, 0x02, 0x67, 0x02, 0x67, 0x02, 0xA7, 0x0A, 0xEC, 0x13, 0xA8, 0x02, 0x67, 0x02, 0xA8, 0x02, 0xC8, 0x02, 0x08, 0x03, 0x44, 0x01, 0x65, 0x01, 0x07, 0x02, 0xC5, 0x01, 0x23, 0x01, 0x64, 0x01, 0x03, 0x01, 0x4A, 0x03, 0xA5, 0x01, 0x44, 0x01, 0x64, 0x01, 0x67, 0x0A, 0x0C, 0x0C, 0x84, 0x01, 0x64, 0x01, 0xA5, 0x01,
+    0x26, 0x02, 0xCC, 0x0B, 0xC5, 0x01, 0xA5, 0x01, 0x8A, 0x0B, 0xE5, 0x01, 0x0C, 0x0C, 0x47, 0x02, 0x2D, 0x14, 0xE5, 0x01, 0x46, 0x02, 0x06, 0x02, 0x09, 0x03, 0x26, 0x02, 0x26, 0x02, 0x70, 0x0D, 0x26, 0x02, 0x66, 0x02, 0x09, 0x0B, 0x09, 0x0B, 0xF1, 0x05, 0xC7, 0x02, 0xA7, 0x02, 0xC7, 0x02, 0x28, 0x03, 0x73, 0x06, 0xCB, 0x03, 0x29, 0x03, 0x69, 0x03, 0x89, 0x03, 0xFF, 0x27, 0x89, 0x03,
+    0xCA, 0x03, 0xCB, 0x03, 0xEA, 0x03, 0xFE, 0x0F, 0xCA, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x89, 0x03, 0x08, 0x03, 0x8A, 0x0B, 0xE8, 0x02, 0xC8, 0x02, 0x28, 0x03, 0xA7, 0x02, 0x87, 0x02, 0x66, 0x02, 0x46, 0x02, 0x8A, 0x0B, 0x87, 0x02, 0x26, 0x02, 0x26, 0x02, 0x25, 0x02, 0x25, 0x02, 0x26, 0x02, 0x05, 0x02, 0x67, 0x02, 0x67, 0x02, 0x87, 0x02, 0x87, 0x02, 0x87, 0x0A, 0x87, 0x02, 0xC8, 0x02,
+    0x24, 0x01, 0x44, 0x01, 0x23, 0x01, 0x23, 0x01, 0x44, 0x01, 0x64, 0x01, 0x65, 0x01, 0x23, 0x01, 0x64, 0x01, 0x44, 0x01, 0x85, 0x01, 0x84, 0x01, 0xC5, 0x01, 0x84, 0x01, 0x84, 0x01, 0xC5, 0x01, 0xA5, 0x01, 0x47, 0x0A, 0xC5, 0x01, 0x4A, 0x03, 0x26, 0x02, 0x29, 0x13, 0xE5, 0x01, 0x46, 0x02, 0x26, 0x02, 0xE5, 0x01, 0xC7, 0x02, 0xA8, 0x0A, 0x0C, 0x04, 0x26, 0x02, 0x06, 0x02, 0xB0, 0x0D,
+    0x4D, 0x0C, 0x67, 0x02, 0x46, 0x02, 0xA7, 0x02, 0x52, 0x0E, 0x87, 0x02, 0xA7, 0x02, 0xC7, 0x02, 0x08, 0x03, 0x6C, 0x04, 0xAA, 0x03, 0x29, 0x03, 0x49, 0x03, 0x93, 0x1E, 0xAC, 0x04, 0x8A, 0x03, 0xAA, 0x03, 0x89, 0x03, 0x89, 0x03, 0xB7, 0x0E, 0x8A, 0x03, 0xAA, 0x03, 0xD7, 0x0F, 0xEA, 0x0B, 0x15, 0x0F, 0xED, 0x0C, 0x69, 0x03, 0xC7, 0x02, 0xA7, 0x02, 0x6B, 0x04, 0x66, 0x02, 0x66, 0x02,
+    0x46, 0x02, 0x87, 0x02, 0xEE, 0x14, 0x0C, 0x0C, 0x26, 0x02, 0x25, 0x02, 0x26, 0x02, 0x4C, 0x0C, 0x87, 0x0A, 0x46, 0x02, 0x87, 0x0A, 0x87, 0x0A, 0xEB, 0x0B, 0x87, 0x02, 0x67, 0x02, 0xA8, 0x0A, 0xA9, 0x02, 0xE6, 0x09, 0x23, 0x01, 0x64, 0x01, 0x64, 0x01, 0x09, 0x03, 0xC5, 0x01, 0x64, 0x01, 0x44, 0x01, 0x44, 0x01, 0xEC, 0x0B, 0xE5, 0x01, 0xA5, 0x01, 0x84, 0x01, 0x64, 0x01, 0x47, 0x02,
+    0xC5, 0x01, 0xE6, 0x01, 0xA5, 0x01, 0xC5, 0x01, 0xC6, 0x01, 0x6D, 0x04, 0xE5, 0x01, 0x26, 0x02, 0xC5, 0x01, 0x06, 0x02, 0xEE, 0x04, 0xE5, 0x01, 0x26, 0x02, 0x26, 0x02, 0x26, 0x02, 0x70, 0x05, 0x26, 0x02, 0x46, 0x02, 0x46, 0x02, 0xC8, 0x02, 0xD1, 0x05, 0xA7, 0x02, 0x66, 0x02, 0xA7, 0x02, 0xE8, 0x02, 0x93, 0x06, 0x49, 0x03, 0x08, 0x03, 0x08, 0x03, 0x28, 0x03, 0x35, 0x07, 0x07, 0x03,
+    0x49, 0x03, 0x49, 0x03, 0xF0, 0x05, 0x35, 0x0F, 0x49, 0x03, 0x69, 0x03, 0x0E, 0x1D, 0x08, 0x03, 0xE8, 0x02, 0xE8, 0x02, 0xC7, 0x02, 0x6C, 0x04, 0xE8, 0x0A, 0x66, 0x02, 0x2E, 0x15, 0x46, 0x02, 0xC7, 0x02, 0x26, 0x02, 0x67, 0x02, 0x67, 0x02, 0xCE, 0x1C, 0x0F, 0x2D, 0x26, 0x02, 0x06, 0x02, 0x47, 0x02, 0x29, 0x0B, 0x46, 0x02, 0x46, 0x02, 0x67, 0x02, 0x46, 0x02, 0xC8, 0x02, 0xA7, 0x0A,
+    0x44, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0xE9, 0x0A, 0xC5, 0x09, 0x23, 0x01, 0xA5, 0x09, 0x44, 0x01, 0x0A, 0x03, 0xA5, 0x01, 0xA5, 0x01, 0xC5, 0x01, 0x26, 0x02, 0x64, 0x01, 0xC5, 0x01, 0x84, 0x01, 0xE6, 0x01, 0x8A, 0x03, 0xC5, 0x01, 0xC5, 0x01, 0xA4, 0x01, 0xC6, 0x01, 0x87, 0x02, 0xE5, 0x01, 0xE5, 0x01, 0x05, 0x02, 0x4C, 0x04, 0x05, 0x02, 0x26, 0x02, 0x05, 0x02, 0x26, 0x02,
+    0x4D, 0x14, 0x46, 0x02, 0x26, 0x02, 0x87, 0x02, 0xC7, 0x02, 0x67, 0x02, 0x66, 0x02, 0x87, 0x02, 0xC7, 0x02, 0xB0, 0x0D, 0x08, 0x03, 0xE8, 0x02, 0x29, 0x03, 0x08, 0x03, 0x28, 0x03, 0x29, 0x03, 0x28, 0x03, 0x29, 0x03, 0x52, 0x0E, 0x49, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x03, 0x08, 0x03, 0x08, 0x03, 0xA7, 0x02, 0xA7, 0x02, 0x86, 0x02, 0xC8, 0x0A, 0x46, 0x02, 0x46, 0x02, 0x26, 0x02,
+    0x46, 0x02, 0x46, 0x02, 0x06, 0x02, 0x05, 0x02, 0xE5, 0x01, 0x06, 0x02, 0x05, 0x02, 0x06, 0x02, 0xA4, 0x01, 0xE5, 0x01, 0x26, 0x02, 0x26, 0x02, 0x26, 0x02, 0x46, 0x02, 0x67, 0x02, 0x87, 0x0A, 0x24, 0x01, 0x23, 0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x01, 0x64, 0x01, 0x84, 0x01, 0x43, 0x01, 0x23, 0x01, 0x43, 0x01, 0x84, 0x01, 0x64, 0x01, 0x64, 0x01, 0x64, 0x01, 0x64, 0x01,
+    0xC5, 0x01, 0xC5, 0x01, 0x64, 0x01, 0x84, 0x01, 0xA4, 0x01, 0xA5, 0x01, 0x8D, 0x14, 0xC5, 0x01, 0xE5, 0x01, 0x05, 0x02, 0xE5, 0x01, 0x06, 0x02, 0x26, 0x02, 0x26, 0x02, 0x26, 0x02, 0x46, 0x02, 0x26, 0x02, 0x46, 0x02, 0x26, 0x02, 0x67, 0x02, 0xA7, 0x02, 0x66, 0x02, 0x66, 0x02, 0xA7, 0x02, 0xA7, 0x02, 0xB9, 0x2F, 0xE8, 0x02, 0xE8, 0x02, 0xE8, 0x02, 0x29, 0x03, 0x12, 0x06, 0x08, 0x03,
+    0x08, 0x03, 0x28, 0x03, 0x49, 0x03, 0xEE, 0x0C, 0x49, 0x03, 0x69, 0x03, 0x09, 0x03, 0xCE, 0x14, 0x08, 0x03, 0x86, 0x02, 0x87, 0x02, 0x08, 0x03, 0x2E, 0x15, 0x46, 0x02, 0x26, 0x02, 0x25, 0x02, 0x26, 0x02, 0x45, 0x02, 0x06, 0x02, 0xE5, 0x01, 0xE5, 0x01, 0xE5, 0x01, 0x6A, 0x1B, 0xC5, 0x01, 0xC5, 0x01, 0xA4, 0x01, 0xE8, 0x0A, 0x6A, 0x13, 0xE5, 0x01, 0x47, 0x02, 0x26, 0x02, 0x67, 0x02,
+    0x23, 0x01, 0x23, 0x01, 0x68, 0x02, 0x24, 0x01, 0x03, 0x01, 0x23, 0x01, 0x23, 0x01, 0x63, 0x01, 0x64, 0x01, 0x64, 0x01, 0x64, 0x01, 0x64, 0x01, 0xA5, 0x01, 0x43, 0x01, 0x64, 0x01, 0x84, 0x01, 0x6B, 0x23, 0xC8, 0x0A, 0x84, 0x01, 0x84, 0x01, 0xA4, 0x01, 0xC5, 0x01, 0xCB, 0x0B, 0xC5, 0x01, 0xC5, 0x01, 0xE5, 0x01, 0xC6, 0x01, 0x26, 0x02, 0x06, 0x02, 0x46, 0x02, 0x26, 0x02, 0xEB, 0x03,
+    0x46, 0x02, 0x66, 0x02, 0x46, 0x02, 0x67, 0x02, 0xF2, 0x1D, 0x66, 0x02, 0x67, 0x02, 0x87, 0x02, 0xA8, 0x02, 0xF1, 0x05, 0xA7, 0x02, 0xA7, 0x02, 0xC7, 0x02, 0xE8, 0x02, 0x73, 0x1E, 0xE7, 0x02, 0xE8, 0x02, 0x29, 0x03, 0x69, 0x03, 0x69, 0x03, 0x49, 0x03, 0x29, 0x03, 0x49, 0x0B, 0x28, 0x03, 0x87, 0x02, 0x87, 0x02, 0x87, 0x02, 0x67, 0x02, 0x67, 0x02, 0x46, 0x02, 0x26, 0x02, 0x06, 0x02,
+    0x05, 0x02, 0x26, 0x02, 0xE5, 0x01, 0x06, 0x02, 0x06, 0x02, 0xE5, 0x01, 0xC5, 0x01, 0xE5, 0x01, 0xC5, 0x01, 0xE5, 0x01, 0xA5, 0x01, 0xE5, 0x01, 0x05, 0x02, 0x06, 0x02, 0x26, 0x02, 0x46, 0x02, 0x23, 0x01, 0x23, 0x01, 0xE3, 0x00, 0x23, 0x01, 0x23, 0x01, 0x23, 0x01, 0x23, 0x01, 0x85, 0x01, 0x44, 0x01, 0x23, 0x01, 0x64, 0x01, 0x43, 0x01, 0x84, 0x01, 0x64, 0x01, 0x64, 0x01, 0x84, 0x01,
+    0xA9, 0x0A, 0xC5, 0x01, 0x84, 0x01, 0xA5, 0x01, 0xE5, 0x01, 0x06, 0x02, 0xA5, 0x01, 0xA5, 0x01, 0xC5, 0x01, 0xE5, 0x01, 0xE8, 0x02, 0x26, 0x02, 0x26, 0x02, 0x06, 0x02, 0x26, 0x02, 0x04, 0x02, 0x46, 0x02, 0x26, 0x02, 0x26, 0x02, 0x25, 0x02, 0x0B, 0x04, 0x67, 0x02, 0x66, 0x02, 0x67, 0x02, 0x87, 0x02, 0xA7, 0x02, 0x87, 0x02, 0xA7, 0x02, 0xA7, 0x02, 0xC7, 0x02, 0x52, 0x16, 0x08, 0x03,
+    0xE8, 0x02, 0x69, 0x03, 0xEA, 0x03, 0xB0, 0x05, 0x8A, 0x03, 0x8A, 0x0B, 0x6A, 0x0B, 0x66, 0x02, 0x6F, 0x05, 0xC8, 0x02, 0x87, 0x02, 0x87, 0x02, 0x67, 0x02, 0x6C, 0x04, 0x46, 0x02, 0x06, 0x02, 0x06, 0x02, 0xE5, 0x01, 0xCB, 0x03, 0x06, 0x02, 0x26, 0x02, 0xE5, 0x01, 0xE5, 0x01, 0x0C, 0x14, 0x27, 0x0A, 0xE6, 0x01, 0xC5, 0x01, 0xA4, 0x01, 0xAA, 0x0B, 0x46, 0x02, 0xE5, 0x01, 0x26, 0x02,
 };
 const lv_img_dsc_t ui_img_atoms_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_atoms_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_atoms_80_png_data
 };
 
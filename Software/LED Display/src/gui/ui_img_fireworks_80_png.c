@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Fireworks_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_fireworks_80_png_data[] = {
-    0x46, 0x09, 0xFF, 0x66, 0x09, 0xFF, 0x66, 0x09, 0xFF, 0xA8, 0x11, 0xFF, 0xE9, 0x19, 0xFF, 0x88, 0x11, 0xFF, 0xE9, 0x11, 0xFF, 0x6B, 0x12, 0xFF, 0xE9, 0x11, 0xFF, 0xE9, 0x11, 0xFF, 0xE9, 0x11, 0xFF, 0x09, 0x12, 0xFF, 0x0A, 0x0A, 0xFF, 0x2B, 0x0A, 0xFF, 0x6B, 0x12, 0xFF, 0xAC, 0x1A, 0xFF, 0x6C, 0x0A, 0xFF, 0x2E, 0x1B, 0xFF, 0xEE, 0x0A, 0xFF, 0xEE, 0x12, 0xFF, 0xAD, 0x0A, 0xFF, 0x0E, 0x0B, 0xFF, 0x0F, 0x0B, 0xFF, 0x57, 0x1E, 0xFF, 0xB0, 0x03, 0xFF, 0x90, 0x0B, 0xFF, 0x16, 0x03, 0xFF, 0x13, 0x04, 0xFF, 0xFF, 0xF7, 0xFF, 0x38, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0x11, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x04, 0xFF, 0x13, 0x04, 0xFF, 0x30, 0x0B, 0xFF, 0x2F, 0x3B, 0xFF, 0xD5, 0x14, 0xFF, 0x31, 0x03, 0xFF, 0xFF, 0xF7, 0xFF, 0x10, 0x03, 0xFF, 0x10, 0x03, 0xFF, 0x10, 0x03, 0xFF, 0x36, 0x04, 0xFF, 0x10, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0x94, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x04, 0xFF, 0xF1, 0x02, 0xFF, 0xD2, 0x02, 0xFF, 0x12, 0x03, 0xFF, 0x12, 0x03, 0xFF, 0xF3, 0x02, 0xFF, 0xB7, 0x04, 0xFF, 0x11, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0xEF, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0x35, 0x04, 0xFF, 0x8E, 0x02, 0xFF, 0x6D, 0x02, 0xFF,
-    0x6D, 0x02, 0xFF, 0x2C, 0x02, 0xFF, 0x2C, 0x02, 0xFF, 0xB3, 0x03, 0xFF, 0x0B, 0x02, 0xFF, 0x2B, 0x02, 0xFF, 0x2B, 0x02, 0xFF, 0x2C, 0x02, 0xFF, 0x93, 0x0B, 0xFF, 0x2C, 0x02, 0xFF, 0x4C, 0x0A, 0xFF, 0x4C, 0x0A, 0xFF, 0x6C, 0x0A, 0xFF, 0xCE, 0x12, 0xFF, 0x8D, 0x02, 0xFF, 0x4B, 0x02, 0xFF, 0x66, 0x09, 0xFF, 0x67, 0x09, 0xFF, 0xAC, 0x1A, 0xFF, 0x87, 0x11, 0xFF, 0xAB, 0x22, 0xFF, 0x87, 0x11, 0xFF, 0xA8, 0x11, 0xFF, 0xEE, 0x1A, 0xFF, 0x09, 0x12, 0xFF, 0x8B, 0x22, 0xFF, 0xE9, 0x11, 0xFF, 0x09, 0x12, 0xFF, 0xEA, 0x09, 0xFF, 0xB0, 0x13, 0xFF, 0x4A, 0x02, 0xFF, 0x4B, 0x0A, 0xFF, 0x4B, 0x12, 0xFF, 0x6B, 0x0A, 0xFF, 0xCE, 0x02, 0xFF, 0xD1, 0x23, 0xFF, 0xCD, 0x12, 0xFF, 0xEE, 0x0A, 0xFF, 0xEE, 0x0A, 0xFF, 0x37, 0x06, 0xFF, 0x92, 0x0C, 0xFF, 0x72, 0x0C, 0xFF, 0x55, 0x1C, 0xFF, 0xF2, 0x0B, 0xFF, 0xD6, 0x25, 0xFF, 0x9C, 0x5F, 0xFF, 0x6F, 0x04, 0xFF, 0x4F, 0x03, 0xFF, 0x4F, 0x0C, 0xFF, 0x52, 0x1D, 0xFF, 0xFF, 0x8F, 0xFF, 0xB0, 0x0C, 0xFF, 0xF1, 0x03, 0xFF, 0x50, 0x0B, 0xFF, 0xF0, 0x12, 0xFF, 0x98, 0x1D, 0xFF, 0xF0, 0x02, 0xFF, 0x52, 0x04, 0xFF, 0x30, 0x03, 0xFF, 0x10, 0x03, 0xFF, 0x51, 0x0B, 0xFF, 0x30, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0xD0, 0x02, 0xFF,
-    0x71, 0x03, 0xFF, 0x34, 0x03, 0xFF, 0x52, 0x03, 0xFF, 0xB1, 0x02, 0xFF, 0xD3, 0x02, 0xFF, 0xF2, 0x02, 0xFF, 0xF1, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0x11, 0x03, 0xFF, 0xF8, 0x2D, 0xFF, 0xD0, 0x02, 0xFF, 0x0F, 0x03, 0xFF, 0xEF, 0x02, 0xFF, 0xF7, 0x1C, 0xFF, 0x0F, 0x03, 0xFF, 0x6D, 0x02, 0xFF, 0x8D, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x2C, 0x02, 0xFF, 0x2B, 0x02, 0xFF, 0x2B, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x8D, 0x02, 0xFF, 0x4C, 0x0A, 0xFF, 0x4C, 0x0A, 0xFF, 0x6C, 0x0A, 0xFF, 0xCD, 0x0A, 0xFF, 0x6C, 0x0A, 0xFF, 0x4B, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x46, 0x09, 0xFF, 0x87, 0x09, 0xFF, 0xA7, 0x11, 0xFF, 0x87, 0x11, 0xFF, 0x4A, 0x22, 0xFF, 0x87, 0x11, 0xFF, 0xA8, 0x11, 0xFF, 0x2A, 0x1A, 0xFF, 0x2A, 0x12, 0xFF, 0x09, 0x12, 0xFF, 0xC9, 0x11, 0xFF, 0x09, 0x0A, 0xFF, 0x4B, 0x12, 0xFF, 0x2A, 0x0A, 0xFF, 0x4B, 0x12, 0xFF, 0x6B, 0x12, 0xFF, 0x8C, 0x12, 0xFF, 0xF1, 0x23, 0xFF, 0x8C, 0x02, 0xFF, 0x8C, 0x12, 0xFF, 0xCD, 0x0A, 0xFF, 0xED, 0x0A, 0xFF, 0x2E, 0x03, 0xFF, 0x51, 0x0C, 0xFF, 0xD9, 0x0E, 0xFF, 0xD0, 0x0B, 0xFF, 0x50, 0x03, 0xFF, 0x53, 0x03, 0xFF, 0xDE, 0x5F, 0xFF, 0x71, 0x16, 0xFF, 0x54, 0x36, 0xFF, 0xD1, 0x03, 0xFF,
-    0xF1, 0x13, 0xFF, 0x10, 0x04, 0xFF, 0x50, 0x05, 0xFF, 0x30, 0x04, 0xFF, 0xF1, 0x0B, 0xFF, 0x91, 0x0B, 0xFF, 0x30, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0xF1, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0x10, 0x03, 0xFF, 0xF3, 0x0D, 0xFF, 0xF0, 0x02, 0xFF, 0x11, 0x03, 0xFF, 0xFF, 0x7F, 0xFF, 0x14, 0x04, 0xFF, 0x32, 0x03, 0xFF, 0xF2, 0x02, 0xFF, 0x15, 0x03, 0xFF, 0x74, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0x53, 0x03, 0xFF, 0x94, 0x03, 0xFF, 0xF5, 0x03, 0xFF, 0xB3, 0x03, 0xFF, 0x15, 0x04, 0xFF, 0x2F, 0x03, 0xFF, 0x2F, 0x03, 0xFF, 0xCE, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x2C, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x4C, 0x0A, 0xFF, 0x4C, 0x0A, 0xFF, 0x4C, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x4C, 0x0A, 0xFF, 0xEA, 0x01, 0xFF, 0x4C, 0x0A, 0xFF, 0x87, 0x09, 0xFF, 0x87, 0x09, 0xFF, 0xA8, 0x11, 0xFF, 0x87, 0x11, 0xFF, 0x6B, 0x12, 0xFF, 0xC8, 0x11, 0xFF, 0xC8, 0x11, 0xFF, 0xC9, 0x11, 0xFF, 0xE9, 0x11, 0xFF, 0x90, 0x1B, 0xFF, 0x0A, 0x0A, 0xFF, 0x0A, 0x12, 0xFF, 0x2A, 0x12, 0xFF, 0x2A, 0x12, 0xFF, 0xF2, 0x23, 0xFF, 0x8C, 0x12, 0xFF,
-    0xCD, 0x02, 0xFF, 0xAB, 0x0A, 0xFF, 0x6B, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xAC, 0x0A, 0xFF, 0xEE, 0x1A, 0xFF, 0x76, 0x15, 0xFF, 0x93, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0x14, 0xFF, 0x2F, 0x0B, 0xFF, 0x54, 0x0C, 0xFF, 0x9A, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x26, 0xFF, 0x8F, 0x03, 0xFF, 0x90, 0x03, 0xFF, 0x39, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x04, 0xFF, 0x91, 0x03, 0xFF, 0x10, 0x03, 0xFF, 0xD4, 0x1C, 0xFF, 0x92, 0x03, 0xFF, 0xFF, 0x3E, 0xFF, 0x53, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0xB8, 0x04, 0xFF, 0x11, 0x03, 0xFF, 0x10, 0x03, 0xFF, 0x92, 0x03, 0xFF, 0x13, 0x04, 0xFF, 0x39, 0x05, 0xFF, 0xF1, 0x02, 0xFF, 0xFF, 0x57, 0xFF, 0x34, 0x03, 0xFF, 0x94, 0x03, 0xFF, 0x1A, 0x05, 0xFF, 0xFD, 0x05, 0xFF, 0xFF, 0x8F, 0xFF, 0x92, 0x03, 0xFF, 0xF1, 0x03, 0xFF, 0xF9, 0x06, 0xFF, 0x90, 0x03, 0xFF, 0x17, 0x05, 0xFF, 0xAE, 0x02, 0xFF, 0xEF, 0x0A, 0xFF, 0xB3, 0x03, 0xFF, 0x6E, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x75, 0x04, 0xFF, 0x6D, 0x02, 0xFF, 0x4D, 0x02, 0xFF, 0x52, 0x03, 0xFF, 0x6C, 0x0A, 0xFF, 0x6C, 0x02, 0xFF, 0x92, 0x03, 0xFF, 0x2C, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x2B, 0x02, 0xFF, 0x4B, 0x02, 0xFF,
-    0x11, 0x13, 0xFF, 0xA7, 0x09, 0xFF, 0x67, 0x09, 0xFF, 0xA8, 0x11, 0xFF, 0xC8, 0x11, 0xFF, 0x0F, 0x13, 0xFF, 0x09, 0x12, 0xFF, 0xE9, 0x19, 0xFF, 0xE9, 0x11, 0xFF, 0x4A, 0x1A, 0xFF, 0xEA, 0x09, 0xFF, 0x5A, 0x04, 0xFF, 0x0A, 0x12, 0xFF, 0x2A, 0x0A, 0xFF, 0x4A, 0x12, 0xFF, 0x2A, 0x0A, 0xFF, 0x12, 0x1C, 0xFF, 0xFF, 0x7F, 0xFF, 0x8C, 0x02, 0xFF, 0xAD, 0x0A, 0xFF, 0x8C, 0x0A, 0xFF, 0x6F, 0x0B, 0xFF, 0xF8, 0x15, 0xFF, 0x73, 0x0C, 0xFF, 0x12, 0x04, 0xFF, 0xB0, 0x0B, 0xFF, 0x4F, 0x1B, 0xFF, 0x95, 0x1C, 0xFF, 0x5B, 0x27, 0xFF, 0xB0, 0x0C, 0xFF, 0xAE, 0x04, 0xFF, 0x70, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x05, 0xFF, 0xAF, 0x03, 0xFF, 0x90, 0x03, 0xFF, 0x51, 0x03, 0xFF, 0x71, 0x03, 0xFF, 0xD3, 0x0B, 0xFF, 0xF9, 0x0C, 0xFF, 0xFE, 0x1C, 0xFF, 0x33, 0x03, 0xFF, 0xD1, 0x02, 0xFF, 0xF1, 0x02, 0xFF, 0x3F, 0x26, 0xFF, 0x77, 0x0C, 0xFF, 0x51, 0x03, 0xFF, 0x72, 0x03, 0xFF, 0x13, 0x04, 0xFF, 0xF5, 0x04, 0xFF, 0xBE, 0x05, 0xFF, 0x74, 0x03, 0xFF, 0xB4, 0x03, 0xFF, 0xD4, 0x02, 0xFF, 0x74, 0x03, 0xFF, 0x35, 0x03, 0xFF, 0x7E, 0x06, 0xFF, 0xFD, 0x16, 0xFF, 0x53, 0x04, 0xFF, 0x11, 0x06, 0xFF, 0x11, 0x06, 0xFF, 0xF0, 0x03, 0xFF, 0x1B, 0x0F, 0xFF, 0x70, 0x03, 0xFF,
-    0xAE, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x4D, 0x02, 0xFF, 0xCE, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x4D, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x6D, 0x0A, 0xFF, 0x6D, 0x0A, 0xFF, 0x6D, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x6C, 0x0A, 0xFF, 0x2B, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x87, 0x09, 0xFF, 0x46, 0x11, 0xFF, 0x67, 0x09, 0xFF, 0x88, 0x09, 0xFF, 0xC9, 0x11, 0xFF, 0x2A, 0x1A, 0xFF, 0xC9, 0x09, 0xFF, 0xE9, 0x11, 0xFF, 0x09, 0x12, 0xFF, 0x09, 0x12, 0xFF, 0xE9, 0x09, 0xFF, 0x54, 0x2C, 0xFF, 0x2A, 0x12, 0xFF, 0x2A, 0x12, 0xFF, 0x4B, 0x0A, 0xFF, 0x6B, 0x12, 0xFF, 0xCD, 0x0A, 0xFF, 0xD4, 0x34, 0xFF, 0xAC, 0x0A, 0xFF, 0x8C, 0x0A, 0xFF, 0xEF, 0x02, 0xFF, 0x8C, 0x02, 0xFF, 0x0E, 0x0B, 0xFF, 0x2E, 0x03, 0xFF, 0x2F, 0x0B, 0xFF, 0xF5, 0x14, 0xFF, 0x2D, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x25, 0xFF, 0x6F, 0x03, 0xFF, 0xF5, 0x1D, 0xFF, 0xEF, 0x02, 0xFF, 0x30, 0x03, 0xFF, 0x96, 0x35, 0xFF, 0x71, 0x03, 0xFF, 0x71, 0x03, 0xFF, 0x51, 0x03, 0xFF, 0x72, 0x03, 0xFF, 0xB3, 0x03, 0xFF, 0x5C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x02, 0xFF, 0xD1, 0x02, 0xFF, 0x31, 0x03, 0xFF, 0x31, 0x03, 0xFF, 0xB4, 0x03, 0xFF, 0xB3, 0x0B, 0xFF, 0x11, 0x03, 0xFF,
-    0xD2, 0x03, 0xFF, 0x15, 0x04, 0xFF, 0x73, 0x03, 0xFF, 0x12, 0x03, 0xFF, 0xDB, 0x02, 0xFF, 0x54, 0x03, 0xFF, 0xF6, 0x03, 0xFF, 0x9F, 0x15, 0xFF, 0xBD, 0x04, 0xFF, 0xF7, 0x03, 0xFF, 0x54, 0x04, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF7, 0xFF, 0xD1, 0x0C, 0xFF, 0x10, 0x03, 0xFF, 0xAE, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0x15, 0x25, 0xFF, 0x6D, 0x02, 0xFF, 0x51, 0x03, 0xFF, 0x6D, 0x02, 0xFF, 0x0F, 0x03, 0xFF, 0x4C, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x8D, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0xCE, 0x0A, 0xFF, 0x0B, 0x02, 0xFF, 0x2B, 0x02, 0xFF, 0x6C, 0x02, 0xFF, 0xEE, 0x0A, 0xFF, 0x4B, 0x02, 0xFF, 0xC8, 0x11, 0xFF, 0xA8, 0x19, 0xFF, 0x0F, 0x1B, 0xFF, 0xE8, 0x11, 0xFF, 0xA8, 0x09, 0xFF, 0xC8, 0x11, 0xFF, 0xE9, 0x09, 0xFF, 0xB2, 0x23, 0xFF, 0xEA, 0x11, 0xFF, 0x2A, 0x12, 0xFF, 0xAC, 0x22, 0xFF, 0x4E, 0x1B, 0xFF, 0x2F, 0x1B, 0xFF, 0x8C, 0x12, 0xFF, 0x6B, 0x12, 0xFF, 0x4B, 0x0A, 0xFF, 0x34, 0x24, 0xFF, 0x93, 0x3D, 0xFF, 0x10, 0x03, 0xFF, 0x8E, 0x02, 0xFF, 0xCE, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x90, 0x13, 0xFF, 0x3B, 0x1E, 0xFF, 0x10, 0x0B, 0xFF, 0x74, 0x0C, 0xFF, 0x4F, 0x03, 0xFF, 0x53, 0x25, 0xFF, 0x51, 0x03, 0xFF, 0xF2, 0x03, 0xFF, 0xD1, 0x03, 0xFF, 0x13, 0x03, 0xFF,
-    0x72, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xDA, 0x0D, 0xFF, 0x12, 0x04, 0xFF, 0x94, 0x04, 0xFF, 0xF7, 0x14, 0xFF, 0x31, 0x03, 0xFF, 0xFC, 0x04, 0xFF, 0x7F, 0x27, 0xFF, 0x76, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0x92, 0x03, 0xFF, 0x9A, 0x2D, 0xFF, 0xFF, 0x5F, 0xFF, 0x71, 0x03, 0xFF, 0xBE, 0x77, 0xFF, 0x72, 0x03, 0xFF, 0x38, 0x04, 0xFF, 0x3C, 0x05, 0xFF, 0x53, 0x03, 0xFF, 0xFA, 0x03, 0xFF, 0x75, 0x03, 0xFF, 0x58, 0x0C, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x97, 0xFF, 0xF7, 0x03, 0xFF, 0xBC, 0x1E, 0xFF, 0xD3, 0x0E, 0xFF, 0xB2, 0x04, 0xFF, 0xBB, 0x05, 0xFF, 0xF0, 0x02, 0xFF, 0x10, 0x03, 0xFF, 0x30, 0x03, 0xFF, 0x50, 0x03, 0xFF, 0x18, 0x1D, 0xFF, 0xB2, 0x03, 0xFF, 0x6D, 0x02, 0xFF, 0xF3, 0x13, 0xFF, 0x4D, 0x02, 0xFF, 0x8D, 0x02, 0xFF, 0x11, 0x03, 0xFF, 0x6D, 0x02, 0xFF, 0x30, 0x13, 0xFF, 0x6D, 0x02, 0xFF, 0x2B, 0x02, 0xFF, 0x70, 0x0B, 0xFF, 0xCE, 0x02, 0xFF, 0x8C, 0x0A, 0xFF, 0xA8, 0x11, 0xFF, 0x87, 0x11, 0xFF, 0xA8, 0x11, 0xFF, 0xA8, 0x11, 0xFF, 0xC8, 0x01, 0xFF, 0xA8, 0x09, 0xFF, 0xA8, 0x01, 0xFF, 0xE9, 0x09, 0xFF, 0xA9, 0x01, 0xFF, 0xAE, 0x23, 0xFF, 0xF1, 0x33, 0xFF, 0x8F, 0x33, 0xFF, 0xE9, 0x09, 0xFF, 0x13, 0x24, 0xFF, 0x2B, 0x0A, 0xFF, 0x6B, 0x0A, 0xFF,
-    0xAC, 0x02, 0xFF, 0x10, 0x0B, 0xFF, 0xEF, 0x0A, 0xFF, 0xAE, 0x12, 0xFF, 0x8D, 0x0A, 0xFF, 0x8E, 0x12, 0xFF, 0xEF, 0x12, 0xFF, 0x71, 0x13, 0xFF, 0x71, 0x13, 0xFF, 0x0F, 0x0B, 0xFF, 0x10, 0x03, 0xFF, 0x2F, 0x0B, 0xFF, 0x50, 0x0B, 0xFF, 0x12, 0x03, 0xFF, 0xB8, 0x0B, 0xFF, 0x11, 0x03, 0xFF, 0x10, 0x03, 0xFF, 0xB5, 0x0B, 0xFF, 0xFB, 0x25, 0xFF, 0xFF, 0xF7, 0xFF, 0x15, 0x05, 0xFF, 0x51, 0x03, 0xFF, 0x52, 0x03, 0xFF, 0xF5, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0x0B, 0xFF, 0xD2, 0x02, 0xFF, 0x71, 0x03, 0xFF, 0xD1, 0x03, 0xFF, 0xF3, 0x04, 0xFF, 0x71, 0x03, 0xFF, 0x5E, 0x87, 0xFF, 0xB3, 0x03, 0xFF, 0xDE, 0x7F, 0xFF, 0x5E, 0x0D, 0xFF, 0x94, 0x03, 0xFF, 0xFF, 0x67, 0xFF, 0xD6, 0x0B, 0xFF, 0xFF, 0x26, 0xFF, 0x7D, 0x0D, 0xFF, 0x59, 0x06, 0xFF, 0x94, 0x03, 0xFF, 0xB3, 0x03, 0xFF, 0x17, 0x05, 0xFF, 0x91, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0xD0, 0x02, 0xFF, 0x10, 0x03, 0xFF, 0xD0, 0x02, 0xFF, 0x90, 0x02, 0xFF, 0x33, 0x03, 0xFF, 0x6E, 0x02, 0xFF, 0x93, 0x03, 0xFF, 0x8E, 0x02, 0xFF, 0x4D, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x51, 0x03, 0xFF, 0x6C, 0x02, 0xFF, 0x6C, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x4C, 0x02, 0xFF, 0x8D, 0x02, 0xFF, 0x8D, 0x02, 0xFF,
-    0xA8, 0x11, 0xFF, 0x87, 0x11, 0xFF, 0x87, 0x09, 0xFF, 0xA8, 0x09, 0xFF, 0x0E, 0x1B, 0xFF, 0x09, 0x12, 0xFF, 0xC8, 0x09, 0xFF, 0x09, 0x12, 0xFF, 0xEA, 0x09, 0xFF, 0xD3, 0x2B, 0xFF, 0x2B, 0x12, 0xFF, 0xCD, 0x1A, 0xFF, 0x8D, 0x0A, 0xFF, 0x9B, 0x36, 0xFF, 0x51, 0x13, 0xFF, 0x4C, 0x12, 0xFF, 0x0F, 0x13, 0xFF, 0xF2, 0x13, 0xFF, 0xCE, 0x02, 0xFF, 0xB4, 0x0B, 0xFF, 0x8E, 0x12, 0xFF, 0xAE, 0x0A, 0xFF, 0x76, 0x0C, 0xFF, 0x51, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x0B, 0xFF, 0xD3, 0x0B, 0xFF, 0x10, 0x03, 0xFF, 0x31, 0x0B, 0xFF, 0x5B, 0x15, 0xFF, 0x77, 0x03, 0xFF, 0x77, 0x04, 0xFF, 0x79, 0x2D, 0xFF, 0x33, 0x03, 0xFF, 0x3D, 0x0E, 0xFF, 0xFF, 0x77, 0xFF, 0x34, 0x04, 0xFF, 0x51, 0x03, 0xFF, 0x93, 0x0B, 0xFF, 0x7A, 0x04, 0xFF, 0xDF, 0x37, 0xFF, 0x55, 0x03, 0xFF, 0xF1, 0x02, 0xFF, 0x18, 0x35, 0xFF, 0x75, 0x1C, 0xFF, 0x7C, 0x05, 0xFF, 0x72, 0x03, 0xFF, 0x32, 0x03, 0xFF, 0xB5, 0x03, 0xFF, 0x7E, 0x26, 0xFF, 0x5E, 0x06, 0xFF, 0x94, 0x03, 0xFF, 0x54, 0x03, 0xFF, 0x79, 0x1E, 0xFF, 0x38, 0x04, 0xFF, 0xFF, 0xCF, 0xFF, 0x36, 0x04, 0xFF, 0x53, 0x03, 0xFF, 0xB4, 0x03, 0xFF, 0x52, 0x03, 0xFF, 0xDE, 0x05, 0xFF, 0xF1, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0xF0, 0x02, 0xFF,
-    0x91, 0x02, 0xFF, 0xF9, 0x0B, 0xFF, 0xB2, 0x02, 0xFF, 0x4E, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0x2F, 0x02, 0xFF, 0xF7, 0x03, 0xFF, 0x6D, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x4D, 0x02, 0xFF, 0x52, 0x03, 0xFF, 0xAD, 0x0A, 0xFF, 0xCE, 0x02, 0xFF, 0xAD, 0x02, 0xFF, 0xEE, 0x22, 0xFF, 0xC7, 0x11, 0xFF, 0x87, 0x11, 0xFF, 0xC9, 0x11, 0xFF, 0xE9, 0x09, 0xFF, 0x0E, 0x1B, 0xFF, 0x0A, 0x0A, 0xFF, 0x09, 0x12, 0xFF, 0x0A, 0x12, 0xFF, 0x96, 0x66, 0xFF, 0x74, 0x2C, 0xFF, 0xB3, 0x1B, 0xFF, 0xCD, 0x1A, 0xFF, 0x4B, 0x0A, 0xFF, 0x4C, 0x02, 0xFF, 0x35, 0x24, 0xFF, 0x13, 0x1C, 0xFF, 0x0F, 0x0B, 0xFF, 0xCE, 0x02, 0xFF, 0xB8, 0x1C, 0xFF, 0xD2, 0x13, 0xFF, 0xCF, 0x02, 0xFF, 0xD4, 0x14, 0xFF, 0x30, 0x0B, 0xFF, 0x3D, 0x2E, 0xFF, 0x58, 0x04, 0xFF, 0x32, 0x0B, 0xFF, 0x93, 0x03, 0xFF, 0x31, 0x03, 0xFF, 0xD5, 0x03, 0xFF, 0x59, 0x02, 0xFF, 0x91, 0x02, 0xFF, 0x72, 0x0B, 0xFF, 0x79, 0x15, 0xFF, 0xFF, 0xA7, 0xFF, 0xB2, 0x03, 0xFF, 0x51, 0x03, 0xFF, 0xD0, 0x02, 0xFF, 0xF4, 0x13, 0xFF, 0x33, 0x03, 0xFF, 0x3A, 0x1D, 0xFF, 0x97, 0x1C, 0xFF, 0xD0, 0x02, 0xFF, 0x31, 0x03, 0xFF, 0x31, 0x03, 0xFF, 0x9A, 0x03, 0xFF, 0x35, 0x0C, 0xFF, 0x33, 0x03, 0xFF,
-    0x1A, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x16, 0xFF, 0xF7, 0x0B, 0xFF, 0x53, 0x03, 0xFF, 0x17, 0x0C, 0xFF, 0x16, 0x04, 0xFF, 0x18, 0x05, 0xFF, 0xBF, 0x06, 0xFF, 0xD4, 0x03, 0xFF, 0x17, 0x04, 0xFF, 0xF5, 0x02, 0xFF, 0xDF, 0x1E, 0xFF, 0xD2, 0x02, 0xFF, 0x3B, 0x05, 0xFF, 0xB3, 0x02, 0xFF, 0x17, 0x02, 0xFF, 0x7D, 0x0B, 0xFF, 0x56, 0x0B, 0xFF, 0x94, 0x03, 0xFF, 0xB7, 0x04, 0xFF, 0xAF, 0x02, 0xFF, 0x4E, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x4D, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0xD3, 0x03, 0xFF, 0x8D, 0x02, 0xFF, 0x6C, 0x02, 0xFF, 0xCE, 0x02, 0xFF, 0xAD, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0xD1, 0x33, 0xFF, 0xE8, 0x19, 0xFF, 0x87, 0x09, 0xFF, 0xC9, 0x11, 0xFF, 0xC9, 0x09, 0xFF, 0x6F, 0x1B, 0xFF, 0x2F, 0x23, 0xFF, 0x2B, 0x12, 0xFF, 0x4B, 0x1A, 0xFF, 0x0D, 0x23, 0xFF, 0x4C, 0x12, 0xFF, 0x94, 0x04, 0xFF, 0xCE, 0x2A, 0xFF, 0x8D, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF, 0x4D, 0x0A, 0xFF, 0xF3, 0x2B, 0xFF, 0x78, 0x25, 0xFF, 0xCE, 0x02, 0xFF, 0x55, 0x1C, 0xFF, 0x8E, 0x02, 0xFF, 0x13, 0x14, 0xFF, 0xD8, 0x25, 0xFF, 0xF8, 0x14, 0xFF, 0x72, 0x13, 0xFF, 0xFB, 0x0C, 0xFF, 0x72, 0x13, 0xFF, 0x3E, 0x05, 0xFF, 0x1E, 0x16, 0xFF, 0x52, 0x03, 0xFF, 0x58, 0x04, 0xFF, 0xF1, 0x02, 0xFF,
-    0x51, 0x03, 0xFF, 0x59, 0x0D, 0xFF, 0xD3, 0x0B, 0xFF, 0x98, 0x1C, 0xFF, 0x77, 0x0C, 0xFF, 0xF0, 0x02, 0xFF, 0x52, 0x0B, 0xFF, 0xBA, 0x15, 0xFF, 0x36, 0x0C, 0xFF, 0xB3, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0x11, 0x03, 0xFF, 0x1E, 0x26, 0xFF, 0x35, 0x04, 0xFF, 0x92, 0x03, 0xFF, 0x12, 0x03, 0xFF, 0x39, 0x0C, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x3F, 0xFF, 0x35, 0x04, 0xFF, 0x33, 0x03, 0xFF, 0xD5, 0x03, 0xFF, 0xBF, 0x3F, 0xFF, 0xBF, 0x3F, 0xFF, 0xDF, 0x06, 0xFF, 0x39, 0x05, 0xFF, 0x97, 0x03, 0xFF, 0xFF, 0xC7, 0xFF, 0xDE, 0x01, 0xFF, 0xF3, 0x02, 0xFF, 0x9D, 0x05, 0xFF, 0x58, 0x04, 0xFF, 0xFF, 0xEF, 0xFF, 0xDD, 0x01, 0xFF, 0x96, 0x02, 0xFF, 0x70, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0x92, 0x02, 0xFF, 0x8D, 0x02, 0xFF, 0x31, 0x03, 0xFF, 0x8F, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x51, 0x03, 0xFF, 0x6C, 0x02, 0xFF, 0x8D, 0x0A, 0xFF, 0xAE, 0x02, 0xFF, 0xAD, 0x02, 0xFF, 0xB2, 0x0B, 0xFF, 0xA8, 0x11, 0xFF, 0xA8, 0x11, 0xFF, 0x4B, 0x22, 0xFF, 0x0A, 0x1A, 0xFF, 0xC9, 0x09, 0xFF, 0xEA, 0x11, 0xFF, 0xD0, 0x3B, 0xFF, 0xF2, 0x1B, 0xFF, 0x0A, 0x12, 0xFF, 0xAC, 0x0A, 0xFF, 0x2B, 0x12, 0xFF, 0x0A, 0x02, 0xFF, 0x10, 0x1B, 0xFF, 0xAD, 0x12, 0xFF, 0x2C, 0x0A, 0xFF, 0x6D, 0x0A, 0xFF,
-    0xB2, 0x1B, 0xFF, 0xF0, 0x12, 0xFF, 0x8E, 0x0A, 0xFF, 0xD0, 0x0A, 0xFF, 0xF1, 0x02, 0xFF, 0x97, 0x14, 0xFF, 0x11, 0x0B, 0xFF, 0xB0, 0x0A, 0xFF, 0x74, 0x03, 0xFF, 0xDB, 0x04, 0xFF, 0xD3, 0x02, 0xFF, 0xDB, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x02, 0xFF, 0x38, 0x04, 0xFF, 0xD0, 0x02, 0xFF, 0x53, 0x03, 0xFF, 0xF1, 0x02, 0xFF, 0x90, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0xD9, 0x04, 0xFF, 0x31, 0x0B, 0xFF, 0x53, 0x1C, 0xFF, 0x73, 0x0B, 0xFF, 0x9A, 0x0D, 0xFF, 0x92, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0x52, 0x0B, 0xFF, 0x31, 0x03, 0xFF, 0x35, 0x25, 0xFF, 0x71, 0x03, 0xFF, 0x32, 0x03, 0xFF, 0x15, 0x04, 0xFF, 0xBE, 0x1F, 0xFF, 0x9A, 0x05, 0xFF, 0x39, 0x0D, 0xFF, 0x95, 0x03, 0xFF, 0x3E, 0x16, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x17, 0xFF, 0xDE, 0x06, 0xFF, 0xBE, 0x06, 0xFF, 0x3A, 0x04, 0xFF, 0xFF, 0x15, 0xFF, 0x35, 0x03, 0xFF, 0x7F, 0x0E, 0xFF, 0x34, 0x03, 0xFF, 0xD5, 0x02, 0xFF, 0xDF, 0x14, 0xFF, 0x37, 0x02, 0xFF, 0xF8, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0x6E, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0xF2, 0x02, 0xFF, 0x6E, 0x02, 0xFF, 0xD5, 0x03, 0xFF, 0xD0, 0x02, 0xFF, 0x8D, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xCF, 0x02, 0xFF,
-    0xC8, 0x11, 0xFF, 0xA8, 0x11, 0xFF, 0x2E, 0x23, 0xFF, 0x4B, 0x12, 0xFF, 0xC9, 0x01, 0xFF, 0xE9, 0x11, 0xFF, 0x2A, 0x12, 0xFF, 0xAD, 0x0A, 0xFF, 0x91, 0x13, 0xFF, 0x4B, 0x0A, 0xFF, 0x2B, 0x12, 0xFF, 0x2B, 0x0A, 0xFF, 0xEE, 0x1A, 0xFF, 0xF8, 0x14, 0xFF, 0x4C, 0x0A, 0xFF, 0x6D, 0x0A, 0xFF, 0x30, 0x13, 0xFF, 0x97, 0x1C, 0xFF, 0x98, 0x0C, 0xFF, 0xCF, 0x02, 0xFF, 0xD3, 0x13, 0xFF, 0x11, 0x0B, 0xFF, 0xB9, 0x1C, 0xFF, 0xBA, 0x15, 0xFF, 0x35, 0x03, 0xFF, 0x33, 0x03, 0xFF, 0xFC, 0x04, 0xFF, 0xFC, 0x14, 0xFF, 0x99, 0x03, 0xFF, 0xFF, 0x97, 0xFF, 0x32, 0x03, 0xFF, 0xBC, 0x0C, 0xFF, 0xB4, 0x0B, 0xFF, 0x73, 0x13, 0xFF, 0x7A, 0x1D, 0xFF, 0x1A, 0x1D, 0xFF, 0x32, 0x03, 0xFF, 0x8F, 0x02, 0xFF, 0x11, 0x0B, 0xFF, 0xD8, 0x34, 0xFF, 0xD9, 0x14, 0xFF, 0x94, 0x14, 0xFF, 0xF0, 0x02, 0xFF, 0x50, 0x03, 0xFF, 0x13, 0x04, 0xFF, 0x3B, 0x26, 0xFF, 0x11, 0x03, 0xFF, 0x32, 0x03, 0xFF, 0xB5, 0x0D, 0xFF, 0x3E, 0x0F, 0xFF, 0x9F, 0x06, 0xFF, 0xD8, 0x04, 0xFF, 0x55, 0x03, 0xFF, 0xF7, 0x03, 0xFF, 0x9F, 0x06, 0xFF, 0xFF, 0xE7, 0xFF, 0xDF, 0x07, 0xFF, 0xFF, 0xAF, 0xFF, 0xF8, 0x03, 0xFF, 0xF9, 0x04, 0xFF, 0xD5, 0x04, 0xFF, 0x5E, 0x06, 0xFF, 0x96, 0x04, 0xFF, 0x9E, 0x1D, 0xFF,
-    0x93, 0x02, 0xFF, 0x14, 0x03, 0xFF, 0xD6, 0x03, 0xFF, 0x8F, 0x02, 0xFF, 0x15, 0x04, 0xFF, 0x6E, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0x53, 0x03, 0xFF, 0xF4, 0x0B, 0xFF, 0x71, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x6E, 0x02, 0xFF, 0xB3, 0x03, 0xFF, 0x31, 0x03, 0xFF, 0xCF, 0x02, 0xFF, 0xA8, 0x11, 0xFF, 0x09, 0x1A, 0xFF, 0xA7, 0x11, 0xFF, 0xC9, 0x11, 0xFF, 0x0B, 0x02, 0xFF, 0x4B, 0x1A, 0xFF, 0xE9, 0x09, 0xFF, 0x6F, 0x23, 0xFF, 0x4B, 0x12, 0xFF, 0xAE, 0x12, 0xFF, 0x2C, 0x12, 0xFF, 0x0B, 0x02, 0xFF, 0x2C, 0x12, 0xFF, 0x92, 0x13, 0xFF, 0x6C, 0x12, 0xFF, 0x6D, 0x0A, 0xFF, 0xAE, 0x0A, 0xFF, 0xB2, 0x13, 0xFF, 0xB0, 0x0A, 0xFF, 0x11, 0x0B, 0xFF, 0xF1, 0x0A, 0xFF, 0x31, 0x04, 0xFF, 0xB4, 0x03, 0xFF, 0x12, 0x03, 0xFF, 0xF3, 0x02, 0xFF, 0xDF, 0x87, 0xFF, 0xF3, 0x02, 0xFF, 0x53, 0x03, 0xFF, 0xF2, 0x02, 0xFF, 0x16, 0x0C, 0xFF, 0x93, 0x03, 0xFF, 0x38, 0x04, 0xFF, 0x93, 0x0B, 0xFF, 0x55, 0x0B, 0xFF, 0x32, 0x0B, 0xFF, 0x32, 0x03, 0xFF, 0xF2, 0x02, 0xFF, 0x91, 0x02, 0xFF, 0x54, 0x1C, 0xFF, 0xF1, 0x0A, 0xFF, 0x97, 0x2C, 0xFF, 0x13, 0x04, 0xFF, 0x10, 0x03, 0xFF, 0x31, 0x03, 0xFF, 0xFA, 0x45, 0xFF, 0x52, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0xB3, 0x0B, 0xFF,
-    0x38, 0x1E, 0xFF, 0xB8, 0x04, 0xFF, 0xDD, 0x03, 0xFF, 0xF7, 0x03, 0xFF, 0x99, 0x03, 0xFF, 0xB7, 0x03, 0xFF, 0x3B, 0x04, 0xFF, 0xFF, 0xF7, 0xFF, 0x3F, 0x06, 0xFF, 0xFF, 0x87, 0xFF, 0xD7, 0x03, 0xFF, 0x75, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x05, 0xFF, 0x76, 0x0C, 0xFF, 0x37, 0x0D, 0xFF, 0xD1, 0x02, 0xFF, 0xB7, 0x03, 0xFF, 0xB0, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0x9A, 0x24, 0xFF, 0xF0, 0x02, 0xFF, 0x71, 0x13, 0xFF, 0xCF, 0x02, 0xFF, 0xB3, 0x13, 0xFF, 0xAE, 0x02, 0xFF, 0x93, 0x03, 0xFF, 0xAE, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0x4E, 0x2B, 0xFF, 0x09, 0x1A, 0xFF, 0xA7, 0x11, 0xFF, 0xE9, 0x11, 0xFF, 0xCD, 0x1A, 0xFF, 0x90, 0x2C, 0xFF, 0xAC, 0x32, 0xFF, 0x90, 0x23, 0xFF, 0x2B, 0x12, 0xFF, 0xCE, 0x12, 0xFF, 0x55, 0x24, 0xFF, 0xAF, 0x12, 0xFF, 0x4C, 0x0A, 0xFF, 0x6D, 0x02, 0xFF, 0x30, 0x0B, 0xFF, 0x76, 0x04, 0xFF, 0x8E, 0x0A, 0xFF, 0x32, 0x03, 0xFF, 0x72, 0x0B, 0xFF, 0x9F, 0x1E, 0xFF, 0xD8, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0x5D, 0x05, 0xFF, 0x9F, 0x05, 0xFF, 0xF8, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0x3E, 0x05, 0xFF, 0x52, 0x03, 0xFF, 0x5D, 0x05, 0xFF, 0x33, 0x03, 0xFF, 0x19, 0x14, 0xFF,
-    0x13, 0x03, 0xFF, 0x1C, 0x3E, 0xFF, 0xFE, 0x55, 0xFF, 0x75, 0x13, 0xFF, 0x7A, 0x0C, 0xFF, 0xB6, 0x03, 0xFF, 0x11, 0x03, 0xFF, 0x13, 0x03, 0xFF, 0xF9, 0x0C, 0xFF, 0x14, 0x04, 0xFF, 0xF1, 0x02, 0xFF, 0x93, 0x03, 0xFF, 0x72, 0x0B, 0xFF, 0x9D, 0x0E, 0xFF, 0x52, 0x03, 0xFF, 0x32, 0x03, 0xFF, 0xF5, 0x03, 0xFF, 0x7D, 0x05, 0xFF, 0xBF, 0x1F, 0xFF, 0x78, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x0F, 0xFF, 0xFD, 0x1D, 0xFF, 0xFF, 0x4F, 0xFF, 0x1F, 0x06, 0xFF, 0x38, 0x04, 0xFF, 0x9F, 0x0E, 0xFF, 0x33, 0x04, 0xFF, 0xFF, 0xCF, 0xFF, 0xDF, 0x37, 0xFF, 0x16, 0x04, 0xFF, 0x72, 0x03, 0xFF, 0x93, 0x03, 0xFF, 0x5F, 0x15, 0xFF, 0x73, 0x03, 0xFF, 0x76, 0x0C, 0xFF, 0x31, 0x03, 0xFF, 0x8E, 0x02, 0xFF, 0x56, 0x04, 0xFF, 0x51, 0x03, 0xFF, 0xAE, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x6D, 0x02, 0xFF, 0x73, 0x0B, 0xFF, 0x0F, 0x03, 0xFF, 0xCE, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0xA7, 0x11, 0xFF, 0xC8, 0x19, 0xFF, 0x0E, 0x2B, 0xFF, 0xC9, 0x11, 0xFF, 0x56, 0x55, 0xFF, 0x12, 0x2C, 0xFF, 0x4E, 0x23, 0xFF, 0x74, 0x23, 0xFF, 0x2B, 0x12, 0xFF, 0xCD, 0x12, 0xFF, 0xAD, 0x0A, 0xFF, 0xCE, 0x0A, 0xFF, 0x4D, 0x0A, 0xFF, 0x2F, 0x0B, 0xFF, 0x6D, 0x12, 0xFF, 0x30, 0x13, 0xFF,
-    0x10, 0x03, 0xFF, 0xB4, 0x13, 0xFF, 0x11, 0x03, 0xFF, 0x58, 0x04, 0xFF, 0x78, 0x05, 0xFF, 0x54, 0x03, 0xFF, 0xF7, 0x0C, 0xFF, 0x59, 0x0C, 0xFF, 0x7D, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x03, 0xFF, 0xFB, 0x47, 0xFF, 0x33, 0x05, 0xFF, 0xF4, 0x03, 0xFF, 0x1F, 0x1E, 0xFF, 0x37, 0x14, 0xFF, 0x56, 0x03, 0xFF, 0x9B, 0x15, 0xFF, 0x75, 0x63, 0xFF, 0x18, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x03, 0xFF, 0x33, 0x03, 0xFF, 0x93, 0x0B, 0xFF, 0x75, 0x03, 0xFF, 0x35, 0x04, 0xFF, 0x12, 0x03, 0xFF, 0x34, 0x0C, 0xFF, 0xFF, 0xE7, 0xFF, 0xBE, 0x8F, 0xFF, 0x73, 0x03, 0xFF, 0x73, 0x03, 0xFF, 0x58, 0x0D, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x05, 0xFF, 0x77, 0x03, 0xFF, 0xFF, 0x5F, 0xFF, 0x1F, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x05, 0xFF, 0x7F, 0x06, 0xFF, 0x95, 0x03, 0xFF, 0xD5, 0x03, 0xFF, 0xFF, 0x8F, 0xFF, 0x54, 0x04, 0xFF, 0x34, 0x04, 0xFF, 0x7B, 0x05, 0xFF, 0x92, 0x03, 0xFF, 0xDC, 0x05, 0xFF, 0x93, 0x13, 0xFF, 0xB0, 0x02, 0xFF, 0x35, 0x03, 0xFF, 0xF9, 0x04, 0xFF, 0x16, 0x04, 0xFF, 0x10, 0x03, 0xFF, 0xCF, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0xF4, 0x03, 0xFF, 0x76, 0x04, 0xFF, 0x31, 0x13, 0xFF, 0xCE, 0x02, 0xFF, 0xCE, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0xF4, 0x03, 0xFF,
-    0x4E, 0x2B, 0xFF, 0xE9, 0x21, 0xFF, 0xA8, 0x19, 0xFF, 0xA9, 0x09, 0xFF, 0xB1, 0x23, 0xFF, 0x2B, 0x12, 0xFF, 0x50, 0x0B, 0xFF, 0x8D, 0x0A, 0xFF, 0xEF, 0x22, 0xFF, 0x8D, 0x12, 0xFF, 0x0F, 0x03, 0xFF, 0xD5, 0x2C, 0xFF, 0x0F, 0x03, 0xFF, 0x51, 0x0B, 0xFF, 0x6D, 0x12, 0xFF, 0xEF, 0x12, 0xFF, 0x91, 0x1B, 0xFF, 0xFC, 0x0D, 0xFF, 0x53, 0x03, 0xFF, 0x98, 0x04, 0xFF, 0xFF, 0x57, 0xFF, 0xD7, 0x0C, 0xFF, 0xFC, 0x1D, 0xFF, 0xF7, 0x03, 0xFF, 0xBF, 0x5F, 0xFF, 0xBF, 0x4F, 0xFF, 0xFB, 0x02, 0xFF, 0x35, 0x0D, 0xFF, 0xFF, 0x87, 0xFF, 0x53, 0x05, 0xFF, 0x3F, 0x05, 0xFF, 0x9C, 0x14, 0xFF, 0x55, 0x03, 0xFF, 0x9E, 0x2E, 0xFF, 0x3C, 0x1B, 0xFF, 0xBD, 0x4C, 0xFF, 0xDC, 0x03, 0xFF, 0x37, 0x03, 0xFF, 0x53, 0x03, 0xFF, 0x5B, 0x05, 0xFF, 0x3E, 0x2F, 0xFF, 0x1C, 0x27, 0xFF, 0x92, 0x03, 0xFF, 0xB9, 0x25, 0xFF, 0xFF, 0x87, 0xFF, 0x79, 0x1D, 0xFF, 0x93, 0x03, 0xFF, 0x13, 0x03, 0xFF, 0xD7, 0x03, 0xFF, 0xFB, 0x0B, 0xFF, 0x3D, 0x07, 0xFF, 0x79, 0x04, 0xFF, 0x35, 0x03, 0xFF, 0xD8, 0x03, 0xFF, 0xFF, 0xC7, 0xFF, 0xBB, 0x04, 0xFF, 0x5F, 0x07, 0xFF, 0xFE, 0x25, 0xFF, 0x74, 0x03, 0xFF, 0xD9, 0x0C, 0xFF, 0x93, 0x03, 0xFF, 0x36, 0x0C, 0xFF, 0x33, 0x04, 0xFF, 0xB4, 0x0D, 0xFF,
-    0x53, 0x04, 0xFF, 0x71, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0xD3, 0x03, 0xFF, 0x6E, 0x02, 0xFF, 0x2D, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0xF3, 0x03, 0xFF, 0xCE, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0xCE, 0x02, 0xFF, 0x10, 0x03, 0xFF, 0xEF, 0x02, 0xFF, 0xC8, 0x11, 0xFF, 0xE9, 0x11, 0xFF, 0x50, 0x23, 0xFF, 0x2B, 0x12, 0xFF, 0x4C, 0x02, 0xFF, 0x0B, 0x1A, 0xFF, 0x2F, 0x23, 0xFF, 0x30, 0x13, 0xFF, 0xCF, 0x0A, 0xFF, 0x2F, 0x0B, 0xFF, 0x10, 0x13, 0xFF, 0xEF, 0x1A, 0xFF, 0x4F, 0x02, 0xFF, 0x35, 0x0C, 0xFF, 0x6D, 0x12, 0xFF, 0xF8, 0x34, 0xFF, 0xD2, 0x02, 0xFF, 0xF7, 0x14, 0xFF, 0x9F, 0x1E, 0xFF, 0xB6, 0x03, 0xFF, 0xB5, 0x03, 0xFF, 0xB8, 0x0C, 0xFF, 0x7C, 0x04, 0xFF, 0x57, 0x04, 0xFF, 0x56, 0x03, 0xFF, 0xFE, 0x14, 0xFF, 0x7F, 0x0D, 0xFF, 0xF6, 0x04, 0xFF, 0xFF, 0x97, 0xFF, 0xBD, 0xA7, 0xFF, 0x18, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x04, 0xFF, 0x5B, 0x14, 0xFF, 0xDF, 0x25, 0xFF, 0x1F, 0x47, 0xFF, 0xF8, 0x03, 0xFF, 0xB6, 0x03, 0xFF, 0x33, 0x03, 0xFF, 0xBC, 0x1D, 0xFF, 0x7E, 0x16, 0xFF, 0x5B, 0x26, 0xFF, 0x53, 0x03, 0xFF, 0xD9, 0x36, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x3F, 0xFF, 0x73, 0x03, 0xFF, 0xF2, 0x02, 0xFF,
-    0x5C, 0x1D, 0xFF, 0x1E, 0x06, 0xFF, 0xBF, 0x05, 0xFF, 0x39, 0x04, 0xFF, 0x98, 0x03, 0xFF, 0xD8, 0x03, 0xFF, 0x1B, 0x05, 0xFF, 0xFF, 0x37, 0xFF, 0xD7, 0x03, 0xFF, 0xB8, 0x04, 0xFF, 0xFF, 0x37, 0xFF, 0x55, 0x03, 0xFF, 0xD4, 0x03, 0xFF, 0xBD, 0x05, 0xFF, 0xD5, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0x1D, 0xFF, 0x71, 0x03, 0xFF, 0x1A, 0x05, 0xFF, 0x10, 0x03, 0xFF, 0x56, 0x0C, 0xFF, 0x8E, 0x02, 0xFF, 0x50, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0x56, 0x04, 0xFF, 0x0F, 0x03, 0xFF, 0xAE, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0xBA, 0x0C, 0xFF, 0x50, 0x03, 0xFF, 0xEF, 0x02, 0xFF, 0xC9, 0x19, 0xFF, 0xE9, 0x19, 0xFF, 0xA8, 0x11, 0xFF, 0x4F, 0x1B, 0xFF, 0x6C, 0x12, 0xFF, 0xEA, 0x11, 0xFF, 0xAD, 0x12, 0xFF, 0x4B, 0x12, 0xFF, 0xAD, 0x12, 0xFF, 0x0B, 0x0A, 0xFF, 0x30, 0x1B, 0xFF, 0xF0, 0x12, 0xFF, 0x4C, 0x02, 0xFF, 0x75, 0x1C, 0xFF, 0x51, 0x23, 0xFF, 0x31, 0x13, 0xFF, 0x10, 0x0B, 0xFF, 0x34, 0x24, 0xFF, 0x15, 0x04, 0xFF, 0x16, 0x04, 0xFF, 0x77, 0x0C, 0xFF, 0x15, 0x1E, 0xFF, 0x16, 0x04, 0xFF, 0xD6, 0x03, 0xFF, 0xF1, 0x02, 0xFF, 0x56, 0x0C, 0xFF, 0x53, 0x03, 0xFF, 0xD7, 0x04, 0xFF, 0x34, 0x16, 0xFF, 0xFF, 0x67, 0xFF, 0x53, 0x04, 0xFF, 0x1C, 0x05, 0xFF,
-    0x17, 0x15, 0xFF, 0x5D, 0x3E, 0xFF, 0x9E, 0x2E, 0xFF, 0xB8, 0x1C, 0xFF, 0x35, 0x14, 0xFF, 0xB7, 0x04, 0xFF, 0x14, 0x03, 0xFF, 0x71, 0x03, 0xFF, 0x7E, 0x1E, 0xFF, 0xFF, 0xC7, 0xFF, 0x35, 0x14, 0xFF, 0x57, 0x0D, 0xFF, 0xF8, 0x0E, 0xFF, 0xF6, 0x05, 0xFF, 0x53, 0x03, 0xFF, 0x17, 0x14, 0xFF, 0x9F, 0x26, 0xFF, 0xBF, 0x05, 0xFF, 0x9E, 0x02, 0xFF, 0xDE, 0x1C, 0xFF, 0xFF, 0xF7, 0xFF, 0xBE, 0x0D, 0xFF, 0x19, 0x03, 0xFF, 0xBD, 0x04, 0xFF, 0x59, 0x04, 0xFF, 0xBB, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x04, 0xFF, 0x35, 0x04, 0xFF, 0x72, 0x03, 0xFF, 0x9A, 0x15, 0xFF, 0x52, 0x03, 0xFF, 0x34, 0x0C, 0xFF, 0x11, 0x03, 0xFF, 0x51, 0x03, 0xFF, 0xAF, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x72, 0x0B, 0xFF, 0xB3, 0x03, 0xFF, 0xEF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0x30, 0x03, 0xFF, 0xEF, 0x02, 0xFF, 0x50, 0x0B, 0xFF, 0x31, 0x03, 0xFF, 0x2F, 0x33, 0xFF, 0x2A, 0x1A, 0xFF, 0xC9, 0x11, 0xFF, 0xC9, 0x11, 0xFF, 0xAE, 0x12, 0xFF, 0xF2, 0x2B, 0xFF, 0xAD, 0x1A, 0xFF, 0x4B, 0x12, 0xFF, 0x6C, 0x12, 0xFF, 0x6E, 0x0A, 0xFF, 0x76, 0x35, 0xFF, 0x4D, 0x0A, 0xFF, 0x0F, 0x0B, 0xFF, 0xB5, 0x13, 0xFF, 0xAE, 0x0A, 0xFF, 0xBE, 0x57, 0xFF,
-    0x51, 0x13, 0xFF, 0xB2, 0x13, 0xFF, 0x92, 0x0B, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x57, 0xFF, 0xB6, 0x04, 0xFF, 0x76, 0x0C, 0xFF, 0xB8, 0x0C, 0xFF, 0x7E, 0x05, 0xFF, 0x79, 0x15, 0xFF, 0x3B, 0x27, 0xFF, 0x95, 0x04, 0xFF, 0xF3, 0x03, 0xFF, 0x1D, 0x16, 0xFF, 0xDD, 0x2F, 0xFF, 0xDD, 0x2E, 0xFF, 0x76, 0x14, 0xFF, 0xBC, 0x35, 0xFF, 0xFC, 0x25, 0xFF, 0xF7, 0x1C, 0xFF, 0xF2, 0x02, 0xFF, 0x56, 0x04, 0xFF, 0x53, 0x0B, 0xFF, 0x16, 0x44, 0xFF, 0x33, 0x23, 0xFF, 0xBA, 0x1C, 0xFF, 0xF2, 0x02, 0xFF, 0x99, 0x04, 0xFF, 0x1C, 0x05, 0xFF, 0x38, 0x04, 0xFF, 0xF3, 0x02, 0xFF, 0xD3, 0x02, 0xFF, 0xFF, 0x5F, 0xFF, 0x1F, 0x05, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xFF, 0x9E, 0x03, 0xFF, 0xFE, 0x77, 0xFF, 0xF6, 0x13, 0xFF, 0x39, 0x0D, 0xFF, 0xF6, 0x0C, 0xFF, 0x57, 0x04, 0xFF, 0x17, 0x04, 0xFF, 0x32, 0x03, 0xFF, 0x73, 0x03, 0xFF, 0x35, 0x14, 0xFF, 0x72, 0x03, 0xFF, 0x97, 0x04, 0xFF, 0x10, 0x03, 0xFF, 0xAF, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0x14, 0x03, 0xFF, 0x10, 0x03, 0xFF, 0xAE, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0x15, 0x04, 0xFF, 0xEF, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0x30, 0x03, 0xFF,
-    0xE9, 0x19, 0xFF, 0xC8, 0x19, 0xFF, 0x2F, 0x2B, 0xFF, 0x0A, 0x1A, 0xFF, 0xF1, 0x33, 0xFF, 0x0A, 0x1A, 0xFF, 0x2B, 0x0A, 0xFF, 0x0E, 0x1B, 0xFF, 0x4E, 0x1B, 0xFF, 0x6B, 0x12, 0xFF, 0xCE, 0x02, 0xFF, 0x8D, 0x12, 0xFF, 0xF1, 0x0B, 0xFF, 0xF3, 0x23, 0xFF, 0xAD, 0x12, 0xFF, 0xAF, 0x02, 0xFF, 0xF7, 0x14, 0xFF, 0x71, 0x0B, 0xFF, 0x10, 0x0B, 0xFF, 0xF3, 0x03, 0xFF, 0x9F, 0x27, 0xFF, 0xBD, 0x15, 0xFF, 0x99, 0x25, 0xFF, 0x38, 0x25, 0xFF, 0x5A, 0x1D, 0xFF, 0xFF, 0xB7, 0xFF, 0xB3, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x47, 0xFF, 0xD6, 0x0C, 0xFF, 0x3E, 0x0E, 0xFF, 0xDE, 0x56, 0xFF, 0x97, 0x1C, 0xFF, 0xF8, 0x24, 0xFF, 0xBB, 0x4D, 0xFF, 0x19, 0x4E, 0xFF, 0xFF, 0x1D, 0xFF, 0xF6, 0x13, 0xFF, 0x93, 0x13, 0xFF, 0x13, 0x73, 0xFF, 0xBC, 0xEE, 0xFF, 0x3B, 0x1C, 0xFF, 0xB3, 0x02, 0xFF, 0xB7, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0x59, 0x04, 0xFF, 0xDF, 0x0D, 0xFF, 0x18, 0x03, 0xFF, 0x7C, 0x0C, 0xFF, 0xF9, 0x0B, 0xFF, 0x7D, 0x24, 0xFF, 0xFF, 0xCF, 0xFF, 0xDB, 0x03, 0xFF, 0x35, 0x03, 0xFF, 0x3B, 0x05, 0xFF, 0x94, 0x03, 0xFF, 0x9E, 0x0D, 0xFF, 0xD7, 0x03, 0xFF, 0x57, 0x0C, 0xFF, 0x97, 0x1C, 0xFF, 0xF5, 0x13, 0xFF,
-    0x3C, 0x05, 0xFF, 0xF4, 0x03, 0xFF, 0x31, 0x03, 0xFF, 0x8F, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0x38, 0x04, 0xFF, 0xCF, 0x02, 0xFF, 0xCE, 0x02, 0xFF, 0xCE, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0xF4, 0x03, 0xFF, 0xCE, 0x02, 0xFF, 0xEE, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0x30, 0x03, 0xFF, 0xB2, 0x0B, 0xFF, 0x74, 0x44, 0xFF, 0x2A, 0x1A, 0xFF, 0xE9, 0x19, 0xFF, 0x6B, 0x1A, 0xFF, 0xB1, 0x3B, 0xFF, 0x33, 0x2C, 0xFF, 0x8C, 0x12, 0xFF, 0x6C, 0x12, 0xFF, 0x0B, 0x02, 0xFF, 0x4C, 0x12, 0xFF, 0x2F, 0x03, 0xFF, 0x36, 0x25, 0xFF, 0xF9, 0x3D, 0xFF, 0x70, 0x0B, 0xFF, 0xEE, 0x12, 0xFF, 0xF0, 0x02, 0xFF, 0x31, 0x0B, 0xFF, 0x36, 0x04, 0xFF, 0x30, 0x03, 0xFF, 0x5A, 0x2D, 0xFF, 0xD7, 0x14, 0xFF, 0xBA, 0x0D, 0xFF, 0x99, 0x1D, 0xFF, 0x39, 0x15, 0xFF, 0xB7, 0x0C, 0xFF, 0xFF, 0x4F, 0xFF, 0x34, 0x04, 0xFF, 0xD7, 0x1D, 0xFF, 0xD5, 0x04, 0xFF, 0xB5, 0x04, 0xFF, 0xB8, 0x04, 0xFF, 0x7C, 0x04, 0xFF, 0xB7, 0x24, 0xFF, 0x7A, 0x15, 0xFF, 0x9C, 0x4E, 0xFF, 0xBD, 0xB7, 0xFF, 0xF9, 0x2C, 0xFF, 0xD8, 0x03, 0xFF, 0x94, 0x03, 0xFF, 0x94, 0x3B, 0xFF, 0x9D, 0x5B, 0xFF, 0xBB, 0x13, 0xFF, 0xD3, 0x02, 0xFF, 0xF6, 0x03, 0xFF, 0x7D, 0x05, 0xFF, 0xF3, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xD4, 0x02, 0xFF,
-    0x5B, 0x04, 0xFF, 0x9C, 0x0C, 0xFF, 0x1F, 0x06, 0xFF, 0xFD, 0x0B, 0xFF, 0x5C, 0x03, 0xFF, 0xF8, 0x02, 0xFF, 0x99, 0x03, 0xFF, 0xD6, 0x02, 0xFF, 0x7F, 0x05, 0xFF, 0xB7, 0x03, 0xFF, 0xBC, 0x03, 0xFF, 0xB9, 0x03, 0xFF, 0x56, 0x04, 0xFF, 0xF6, 0x03, 0xFF, 0x5C, 0x05, 0xFF, 0x5E, 0x1E, 0xFF, 0x55, 0x03, 0xFF, 0xD1, 0x02, 0xFF, 0xF1, 0x02, 0xFF, 0xB8, 0x05, 0xFF, 0xB4, 0x03, 0xFF, 0xD0, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0x10, 0x0B, 0xFF, 0x8E, 0x02, 0xFF, 0x56, 0x04, 0xFF, 0xCF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0x50, 0x0B, 0xFF, 0x30, 0x03, 0xFF, 0xB4, 0x03, 0xFF, 0x2B, 0x22, 0xFF, 0xC8, 0x19, 0xFF, 0x0A, 0x1A, 0xFF, 0x0A, 0x12, 0xFF, 0x0D, 0x13, 0xFF, 0x8C, 0x2A, 0xFF, 0x7D, 0x6F, 0xFF, 0x8C, 0x12, 0xFF, 0x8D, 0x12, 0xFF, 0x12, 0x24, 0xFF, 0x54, 0x1C, 0xFF, 0x32, 0x44, 0xFF, 0x50, 0x0C, 0xFF, 0xB2, 0x04, 0xFF, 0x0E, 0x13, 0xFF, 0x50, 0x13, 0xFF, 0x31, 0x13, 0xFF, 0x3A, 0x2E, 0xFF, 0x36, 0x2E, 0xFF, 0xF5, 0x1C, 0xFF, 0x9B, 0x2D, 0xFF, 0xF6, 0x24, 0xFF, 0xFF, 0x3F, 0xFF, 0x9A, 0x26, 0xFF, 0xB0, 0x03, 0xFF, 0x3B, 0x37, 0xFF, 0x9D, 0x37, 0xFF, 0x77, 0x0C, 0xFF, 0x55, 0x04, 0xFF, 0xBF, 0x57, 0xFF, 0xF8, 0x0C, 0xFF, 0xDF, 0x4F, 0xFF,
-    0x3A, 0x1D, 0xFF, 0x7D, 0x25, 0xFF, 0x18, 0x2D, 0xFF, 0x9F, 0x8F, 0xFF, 0xF1, 0x0A, 0xFF, 0x59, 0x0C, 0xFF, 0x12, 0x03, 0xFF, 0xFE, 0x25, 0xFF, 0xDF, 0x46, 0xFF, 0xD8, 0x04, 0xFF, 0xF3, 0x02, 0xFF, 0xBA, 0x14, 0xFF, 0x5D, 0x1D, 0xFF, 0x95, 0x03, 0xFF, 0x14, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xBB, 0x05, 0xFF, 0xFF, 0x27, 0xFF, 0xDF, 0x9F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xDF, 0xFF, 0xD7, 0x02, 0xFF, 0xBC, 0x0C, 0xFF, 0x19, 0x04, 0xFF, 0xFF, 0xF7, 0xFF, 0x98, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0x3D, 0x15, 0xFF, 0x3C, 0x27, 0xFF, 0xFE, 0x47, 0xFF, 0xD5, 0x03, 0xFF, 0xDE, 0x0D, 0xFF, 0x33, 0x03, 0xFF, 0x90, 0x02, 0xFF, 0xF3, 0x02, 0xFF, 0x94, 0x03, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0xB0, 0x02, 0xFF, 0x33, 0x03, 0xFF, 0xD3, 0x03, 0xFF, 0xCF, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0x71, 0x03, 0xFF, 0x50, 0x03, 0xFF, 0xB2, 0x0B, 0xFF, 0x71, 0x0B, 0xFF, 0xC9, 0x19, 0xFF, 0xE9, 0x19, 0xFF, 0x2A, 0x1A, 0xFF, 0xD3, 0x2B, 0xFF, 0x8B, 0x02, 0xFF, 0x2A, 0x22, 0xFF, 0x0E, 0x2B, 0xFF, 0x0D, 0x13, 0xFF, 0x54, 0x2C, 0xFF, 0x6C, 0x12, 0xFF, 0x7B, 0x67, 0xFF, 0xED, 0x1A, 0xFF, 0x13, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x13, 0xFF, 0xD6, 0x24, 0xFF,
-    0xF2, 0x1B, 0xFF, 0x90, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0x39, 0x15, 0xFF, 0x75, 0x1C, 0xFF, 0xBC, 0x2D, 0xFF, 0x3A, 0x1D, 0xFF, 0xFD, 0x15, 0xFF, 0x36, 0x04, 0xFF, 0x7C, 0x0C, 0xFF, 0x5A, 0x0D, 0xFF, 0x55, 0x14, 0xFF, 0x9C, 0x1E, 0xFF, 0x9E, 0x5F, 0xFF, 0x3E, 0x26, 0xFF, 0x35, 0x1C, 0xFF, 0xFC, 0x1D, 0xFF, 0xDA, 0x15, 0xFF, 0x37, 0x55, 0xFF, 0x9E, 0x76, 0xFF, 0xDA, 0x24, 0xFF, 0x73, 0x03, 0xFF, 0xBE, 0x3E, 0xFF, 0xFE, 0x0D, 0xFF, 0x97, 0x04, 0xFF, 0x55, 0x03, 0xFF, 0xB7, 0x03, 0xFF, 0xDF, 0x37, 0xFF, 0xB4, 0x02, 0xFF, 0xB7, 0x03, 0xFF, 0x56, 0x03, 0xFF, 0x9C, 0x06, 0xFF, 0xFF, 0x17, 0xFF, 0xDE, 0x87, 0xFF, 0xFC, 0x03, 0xFF, 0x59, 0x03, 0xFF, 0xBB, 0x04, 0xFF, 0x7F, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x14, 0xFF, 0x7E, 0x0D, 0xFF, 0x99, 0x03, 0xFF, 0x57, 0x04, 0xFF, 0xFF, 0x0F, 0xFF, 0xD6, 0x04, 0xFF, 0xF6, 0x03, 0xFF, 0x12, 0x03, 0xFF, 0xF2, 0x02, 0xFF, 0x33, 0x03, 0xFF, 0x36, 0x04, 0xFF, 0x7A, 0x25, 0xFF, 0x8E, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0x77, 0x04, 0xFF, 0x52, 0x0B, 0xFF, 0x8F, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0xCF, 0x02, 0xFF, 0x30, 0x03, 0xFF, 0xD3, 0x0B, 0xFF, 0xAE, 0x02, 0xFF, 0x71, 0x03, 0xFF,
-    0xAD, 0x2A, 0xFF, 0xC8, 0x19, 0xFF, 0xE8, 0x19, 0xFF, 0x2A, 0x1A, 0xFF, 0x0A, 0x12, 0xFF, 0x13, 0x44, 0xFF, 0x6C, 0x22, 0xFF, 0x6B, 0x12, 0xFF, 0x13, 0x44, 0xFF, 0x70, 0x2B, 0xFF, 0xB8, 0x55, 0xFF, 0x6C, 0x1A, 0xFF, 0xF0, 0x0B, 0xFF, 0xAF, 0x23, 0xFF, 0x2F, 0x23, 0xFF, 0x9C, 0xBE, 0xFF, 0x75, 0x24, 0xFF, 0x92, 0x23, 0xFF, 0x30, 0x03, 0xFF, 0x35, 0x04, 0xFF, 0xFF, 0x7F, 0xFF, 0x18, 0x25, 0xFF, 0x59, 0x2D, 0xFF, 0xD4, 0x0B, 0xFF, 0xBD, 0x1D, 0xFF, 0xF8, 0x24, 0xFF, 0x74, 0x0B, 0xFF, 0x35, 0x1C, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0x14, 0x14, 0xFF, 0xF8, 0x14, 0xFF, 0x17, 0x0C, 0xFF, 0xB9, 0x1C, 0xFF, 0xFF, 0x2E, 0xFF, 0x76, 0x14, 0xFF, 0xBF, 0x05, 0xFF, 0xDA, 0x03, 0xFF, 0x13, 0x03, 0xFF, 0x5F, 0x4E, 0xFF, 0x1F, 0x8F, 0xFF, 0xBA, 0x1B, 0xFF, 0x36, 0x03, 0xFF, 0x5C, 0x0C, 0xFF, 0xFF, 0xAF, 0xFF, 0x59, 0x03, 0xFF, 0xF5, 0x02, 0xFF, 0x76, 0x03, 0xFF, 0x7D, 0x06, 0xFF, 0xFF, 0x2E, 0xFF, 0xDE, 0x03, 0xFF, 0x7A, 0x03, 0xFF, 0x77, 0x03, 0xFF, 0x9C, 0x04, 0xFF, 0xDD, 0x04, 0xFF, 0xDE, 0x04, 0xFF, 0x19, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x0B, 0xFF, 0xD6, 0x03, 0xFF, 0x9C, 0x05, 0xFF, 0x78, 0x04, 0xFF, 0x97, 0x0C, 0xFF, 0x12, 0x03, 0xFF,
-    0xD6, 0x0B, 0xFF, 0x78, 0x04, 0xFF, 0x90, 0x02, 0xFF, 0x31, 0x0B, 0xFF, 0x8F, 0x02, 0xFF, 0x73, 0x0B, 0xFF, 0x16, 0x04, 0xFF, 0x93, 0x0B, 0xFF, 0x30, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0x10, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0x30, 0x03, 0xFF, 0x92, 0x0B, 0xFF, 0x10, 0x03, 0xFF, 0xB2, 0x03, 0xFF, 0xC9, 0x19, 0xFF, 0xE9, 0x19, 0xFF, 0x4F, 0x33, 0xFF, 0xEF, 0x2A, 0xFF, 0xD2, 0x33, 0xFF, 0x6B, 0x22, 0xFF, 0x4B, 0x1A, 0xFF, 0x91, 0x33, 0xFF, 0xB5, 0x4C, 0xFF, 0x8B, 0x0A, 0xFF, 0x1E, 0x87, 0xFF, 0xAD, 0x1A, 0xFF, 0x17, 0x3D, 0xFF, 0xB1, 0x2B, 0xFF, 0xCD, 0x22, 0xFF, 0x14, 0x34, 0xFF, 0xFB, 0xFF, 0xFF, 0x35, 0x24, 0xFF, 0xB6, 0x34, 0xFF, 0xB5, 0x13, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0x16, 0x14, 0xFF, 0x59, 0x35, 0xFF, 0x56, 0x14, 0xFF, 0xB7, 0x14, 0xFF, 0x11, 0x03, 0xFF, 0x15, 0x1C, 0xFF, 0x14, 0x0C, 0xFF, 0x18, 0x1D, 0xFF, 0x9B, 0x1D, 0xFF, 0x37, 0x14, 0xFF, 0x1C, 0x25, 0xFF, 0x1F, 0x3E, 0xFF, 0xD7, 0x25, 0xFF, 0xFF, 0xBF, 0xFF, 0x9F, 0x3E, 0xFF, 0xDE, 0x34, 0xFF, 0xD3, 0x02, 0xFF, 0x17, 0x03, 0xFF, 0x5E, 0x66, 0xFF, 0x7D, 0x2B, 0xFF, 0x36, 0x03, 0xFF, 0xBD, 0x03, 0xFF, 0x1E, 0x6F, 0xFF, 0x5E, 0x02, 0xFF, 0xF5, 0x02, 0xFF, 0x15, 0x03, 0xFF,
-    0xBF, 0x0D, 0xFF, 0x1F, 0x06, 0xFF, 0x99, 0x03, 0xFF, 0x56, 0x03, 0xFF, 0x9F, 0x0D, 0xFF, 0x55, 0x04, 0xFF, 0x5F, 0x17, 0xFF, 0xB9, 0x14, 0xFF, 0x3F, 0x0D, 0xFF, 0x56, 0x03, 0xFF, 0xD6, 0x0B, 0xFF, 0xD7, 0x03, 0xFF, 0x98, 0x0C, 0xFF, 0x16, 0x0C, 0xFF, 0x73, 0x03, 0xFF, 0xF2, 0x02, 0xFF, 0xFA, 0x04, 0xFF, 0x94, 0x0B, 0xFF, 0x73, 0x0B, 0xFF, 0x52, 0x0B, 0xFF, 0xB4, 0x03, 0xFF, 0x16, 0x04, 0xFF, 0x8F, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0xF0, 0x02, 0xFF, 0x31, 0x03, 0xFF, 0x72, 0x0B, 0xFF, 0xEF, 0x02, 0xFF, 0x30, 0x0B, 0xFF, 0x10, 0x03, 0xFF, 0x31, 0x03, 0xFF, 0xB1, 0x03, 0xFF, 0xA8, 0x11, 0xFF, 0x09, 0x1A, 0xFF, 0x2B, 0x22, 0xFF, 0x09, 0x1A, 0xFF, 0x12, 0x44, 0xFF, 0x0A, 0x22, 0xFF, 0x70, 0x2B, 0xFF, 0x0B, 0x12, 0xFF, 0x0F, 0x33, 0xFF, 0xB1, 0x33, 0xFF, 0x95, 0x3C, 0xFF, 0x70, 0x23, 0xFF, 0xD7, 0x4C, 0xFF, 0x92, 0x23, 0xFF, 0xAD, 0x12, 0xFF, 0x37, 0x45, 0xFF, 0x50, 0x13, 0xFF, 0x30, 0x23, 0xFF, 0x57, 0x1C, 0xFF, 0xB4, 0x1B, 0xFF, 0xBB, 0x1C, 0xFF, 0x79, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x16, 0xFF, 0x10, 0x03, 0xFF, 0x16, 0x2D, 0xFF, 0xD9, 0x1D, 0xFF, 0x99, 0x24, 0xFF, 0x31, 0x03, 0xFF, 0x3A, 0x0D, 0xFF, 0xB9, 0x14, 0xFF, 0x9D, 0x1D, 0xFF,
-    0x56, 0x1C, 0xFF, 0x1F, 0x5F, 0xFF, 0x14, 0x0C, 0xFF, 0x9E, 0x1E, 0xFF, 0x34, 0x03, 0xFF, 0x5C, 0x25, 0xFF, 0x55, 0x0B, 0xFF, 0x56, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x05, 0xFF, 0x35, 0x03, 0xFF, 0x39, 0x04, 0xFF, 0x59, 0x03, 0xFF, 0x17, 0x03, 0xFF, 0x15, 0x03, 0xFF, 0x15, 0x03, 0xFF, 0xBE, 0x05, 0xFF, 0x1F, 0x07, 0xFF, 0x56, 0x03, 0xFF, 0x55, 0x03, 0xFF, 0x3B, 0x05, 0xFF, 0xFF, 0xE7, 0xFF, 0xFC, 0x3F, 0xFF, 0xDE, 0x6F, 0xFF, 0xBB, 0x04, 0xFF, 0x75, 0x03, 0xFF, 0xBC, 0x05, 0xFF, 0x36, 0x04, 0xFF, 0xB4, 0x03, 0xFF, 0xB5, 0x0B, 0xFF, 0x52, 0x03, 0xFF, 0xB9, 0x04, 0xFF, 0xF6, 0x1B, 0xFF, 0xF1, 0x02, 0xFF, 0x73, 0x0B, 0xFF, 0x73, 0x03, 0xFF, 0x32, 0x03, 0xFF, 0x71, 0x03, 0xFF, 0xB0, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0xB3, 0x0B, 0xFF, 0xCF, 0x02, 0xFF, 0x10, 0x0B, 0xFF, 0xEF, 0x02, 0xFF, 0x50, 0x03, 0xFF, 0x0F, 0x03, 0xFF, 0x71, 0x03, 0xFF, 0x13, 0x04, 0xFF, 0x0F, 0x2B, 0xFF, 0x2A, 0x12, 0xFF, 0x4A, 0x1A, 0xFF, 0x09, 0x1A, 0xFF, 0xF1, 0x4B, 0xFF, 0x33, 0x44, 0xFF, 0xD6, 0x3C, 0xFF, 0x2B, 0x1A, 0xFF, 0x8C, 0x22, 0xFF, 0xD0, 0x33, 0xFF, 0xCC, 0x1A, 0xFF, 0x74, 0x2C, 0xFF, 0xF7, 0x4C, 0xFF, 0x8F, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF, 0x13, 0x2C, 0xFF,
-    0xEF, 0x0A, 0xFF, 0x17, 0x25, 0xFF, 0xF4, 0x2B, 0xFF, 0xD7, 0x2C, 0xFF, 0xD3, 0x1B, 0xFF, 0x75, 0x3C, 0xFF, 0xFA, 0x2D, 0xFF, 0xDA, 0x15, 0xFF, 0xD5, 0x0B, 0xFF, 0x55, 0x1C, 0xFF, 0x10, 0x0B, 0xFF, 0x39, 0x15, 0xFF, 0xBF, 0x5F, 0xFF, 0x9C, 0x15, 0xFF, 0xFF, 0x77, 0xFF, 0x19, 0x15, 0xFF, 0xD4, 0x0B, 0xFF, 0x9B, 0x15, 0xFF, 0xDB, 0x85, 0xFF, 0x7B, 0x35, 0xFF, 0x12, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x33, 0x1B, 0xFF, 0x5E, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xAF, 0xFF, 0xB6, 0x03, 0xFF, 0x3A, 0x1D, 0xFF, 0x7F, 0x05, 0xFF, 0xB7, 0x03, 0xFF, 0x14, 0x03, 0xFF, 0x55, 0x03, 0xFF, 0x78, 0x04, 0xFF, 0xBF, 0x05, 0xFF, 0x7F, 0x05, 0xFF, 0x75, 0x03, 0xFF, 0x37, 0x04, 0xFF, 0xFF, 0xEF, 0xFF, 0xD9, 0x0D, 0xFF, 0x1A, 0x06, 0xFF, 0x7D, 0x05, 0xFF, 0x38, 0x03, 0xFF, 0xB6, 0x03, 0xFF, 0x9B, 0x16, 0xFF, 0x32, 0x03, 0xFF, 0xFF, 0xBF, 0xFF, 0x99, 0x04, 0xFF, 0xB1, 0x02, 0xFF, 0xB4, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xF1, 0x02, 0xFF, 0xB9, 0x04, 0xFF, 0xAF, 0x02, 0xFF, 0x10, 0x03, 0xFF, 0x73, 0x13, 0xFF, 0x31, 0x03, 0xFF, 0xAF, 0x02, 0xFF, 0x16, 0x04, 0xFF, 0xD3, 0x1B, 0xFF, 0x51, 0x0B, 0xFF, 0x30, 0x03, 0xFF, 0x50, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x03, 0xFF,
-    0xE8, 0x19, 0xFF, 0xE9, 0x19, 0xFF, 0x8C, 0x22, 0xFF, 0x76, 0x4D, 0xFF, 0x8F, 0x5B, 0xFF, 0x2A, 0x2A, 0xFF, 0xCD, 0x2A, 0xFF, 0x4B, 0x1A, 0xFF, 0xF2, 0x2B, 0xFF, 0x8F, 0x2B, 0xFF, 0x30, 0x2B, 0xFF, 0xCD, 0x2A, 0xFF, 0xB6, 0x4C, 0xFF, 0x35, 0x2C, 0xFF, 0x6D, 0x1A, 0xFF, 0x18, 0x5D, 0xFF, 0x33, 0x34, 0xFF, 0xAE, 0x22, 0xFF, 0x39, 0x2D, 0xFF, 0x11, 0x0B, 0xFF, 0xB6, 0x2C, 0xFF, 0x95, 0xE6, 0xFF, 0xB6, 0x2C, 0xFF, 0x34, 0x14, 0xFF, 0xF9, 0x1D, 0xFF, 0x75, 0x2C, 0xFF, 0x0F, 0x03, 0xFF, 0xF3, 0x1B, 0xFF, 0x7A, 0x1D, 0xFF, 0xFF, 0x67, 0xFF, 0x34, 0x0C, 0xFF, 0x35, 0x14, 0xFF, 0xD4, 0x0B, 0xFF, 0x14, 0x14, 0xFF, 0xDB, 0x0D, 0xFF, 0x93, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x8C, 0xFF, 0x53, 0x3B, 0xFF, 0x1F, 0x06, 0xFF, 0xDE, 0x87, 0xFF, 0x76, 0x04, 0xFF, 0xD6, 0x03, 0xFF, 0x18, 0x04, 0xFF, 0x1F, 0x27, 0xFF, 0x19, 0x04, 0xFF, 0x34, 0x03, 0xFF, 0x55, 0x03, 0xFF, 0x59, 0x04, 0xFF, 0x58, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xD7, 0x03, 0xFF, 0x5E, 0x05, 0xFF, 0xFF, 0x87, 0xFF, 0xFB, 0x04, 0xFF, 0x5D, 0x05, 0xFF, 0x16, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x0B, 0xFF, 0xD2, 0x02, 0xFF, 0xFE, 0x16, 0xFF, 0x57, 0x04, 0xFF, 0x12, 0x03, 0xFF, 0xD1, 0x02, 0xFF,
-    0x12, 0x03, 0xFF, 0x16, 0x04, 0xFF, 0x78, 0x04, 0xFF, 0xD0, 0x02, 0xFF, 0x14, 0x1C, 0xFF, 0x72, 0x03, 0xFF, 0xAF, 0x02, 0xFF, 0x7E, 0x15, 0xFF, 0xEF, 0x02, 0xFF, 0x10, 0x0B, 0xFF, 0x10, 0x03, 0xFF, 0x30, 0x03, 0xFF, 0x30, 0x03, 0xFF, 0xB3, 0x03, 0xFF, 0x50, 0x03, 0xFF, 0xB2, 0x0B, 0xFF, 0xED, 0x3A, 0xFF, 0xE9, 0x19, 0xFF, 0x8F, 0x33, 0xFF, 0xE9, 0x21, 0xFF, 0x6B, 0x5A, 0xFF, 0x2F, 0x33, 0xFF, 0xD0, 0x43, 0xFF, 0x8C, 0x22, 0xFF, 0x0B, 0x22, 0xFF, 0xED, 0x22, 0xFF, 0xF0, 0x1A, 0xFF, 0xEE, 0x2A, 0xFF, 0x13, 0x44, 0xFF, 0x4D, 0x22, 0xFF, 0xCE, 0x12, 0xFF, 0x77, 0x35, 0xFF, 0xAD, 0x0A, 0xFF, 0x12, 0x34, 0xFF, 0x75, 0x44, 0xFF, 0xB3, 0x2B, 0xFF, 0xBC, 0x3D, 0xFF, 0xD2, 0x1B, 0xFF, 0x92, 0x1B, 0xFF, 0xD6, 0x34, 0xFF, 0xB5, 0x14, 0xFF, 0xB4, 0x25, 0xFF, 0xF1, 0x3B, 0xFF, 0xD6, 0x2C, 0xFF, 0x73, 0x1C, 0xFF, 0xFF, 0xF7, 0xFF, 0xF6, 0x15, 0xFF, 0x18, 0x25, 0xFF, 0x35, 0x14, 0xFF, 0x39, 0x25, 0xFF, 0xDE, 0x1E, 0xFF, 0x9A, 0x2D, 0xFF, 0x1D, 0x5F, 0xFF, 0x9D, 0x5E, 0xFF, 0x73, 0x1B, 0xFF, 0xDF, 0x2E, 0xFF, 0xF8, 0x0C, 0xFF, 0xDC, 0x1D, 0xFF, 0xF5, 0x03, 0xFF, 0x3D, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0xFF, 0x55, 0x03, 0xFF, 0xF7, 0x03, 0xFF,
-    0x1D, 0x16, 0xFF, 0xFF, 0x3F, 0xFF, 0xD7, 0x0B, 0xFF, 0xBA, 0x0C, 0xFF, 0x5C, 0x05, 0xFF, 0xDB, 0x14, 0xFF, 0x5E, 0x16, 0xFF, 0xB6, 0x03, 0xFF, 0xD9, 0x04, 0xFF, 0x9F, 0x25, 0xFF, 0x18, 0x04, 0xFF, 0xF7, 0x03, 0xFF, 0x39, 0x05, 0xFF, 0xF5, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0x77, 0x1C, 0xFF, 0xF4, 0x03, 0xFF, 0xB8, 0x04, 0xFF, 0x51, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xCF, 0x02, 0xFF, 0x76, 0x04, 0xFF, 0xEF, 0x02, 0xFF, 0xF0, 0x02, 0xFF, 0x30, 0x03, 0xFF, 0xAE, 0x02, 0xFF, 0xAF, 0x02, 0xFF, 0x72, 0x0B, 0xFF, 0x71, 0x0B, 0xFF, 0x50, 0x03, 0xFF, 0x30, 0x03, 0xFF, 0x47, 0x11, 0xFF, 0x09, 0x22, 0xFF, 0x90, 0x43, 0xFF, 0x4F, 0x43, 0xFF, 0xA9, 0x09, 0xFF, 0x49, 0x2A, 0xFF, 0x51, 0x5C, 0xFF, 0xF3, 0x43, 0xFF, 0xAC, 0x32, 0xFF, 0x12, 0x4C, 0xFF, 0xED, 0x32, 0xFF, 0x90, 0x43, 0xFF, 0x30, 0x23, 0xFF, 0xEE, 0x32, 0xFF, 0x4B, 0x12, 0xFF, 0x4F, 0x2B, 0xFF, 0xB5, 0x34, 0xFF, 0xCE, 0x1A, 0xFF, 0x33, 0x3C, 0xFF, 0xF2, 0x23, 0xFF, 0xF2, 0x1C, 0xFF, 0x76, 0x2C, 0xFF, 0x11, 0x24, 0xFF, 0x15, 0x46, 0xFF, 0xB1, 0x13, 0xFF, 0x11, 0x0C, 0xFF, 0xFE, 0x87, 0xFF, 0x78, 0x3D, 0xFF, 0xD1, 0x1B, 0xFF, 0xBB, 0x27, 0xFF, 0x5A, 0x1E, 0xFF, 0x77, 0x1D, 0xFF,
-    0xB2, 0x13, 0xFF, 0xDC, 0x2E, 0xFF, 0xF2, 0x0C, 0xFF, 0xBF, 0x27, 0xFF, 0x92, 0x0B, 0xFF, 0x5C, 0x15, 0xFF, 0xB3, 0x13, 0xFF, 0x97, 0x04, 0xFF, 0x7E, 0x57, 0xFF, 0x7C, 0xBF, 0xFF, 0xF5, 0x13, 0xFF, 0xFC, 0x0C, 0xFF, 0xFF, 0xF7, 0xFF, 0x9F, 0x05, 0xFF, 0x75, 0x03, 0xFF, 0x95, 0x03, 0xFF, 0xBE, 0xAF, 0xFF, 0x3F, 0x06, 0xFF, 0x34, 0x03, 0xFF, 0xB4, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0x79, 0x26, 0xFF, 0x98, 0x05, 0xFF, 0xF5, 0x03, 0xFF, 0x98, 0x14, 0xFF, 0xD4, 0x03, 0xFF, 0x76, 0x0C, 0xFF, 0xBB, 0x05, 0xFF, 0x10, 0x03, 0xFF, 0x76, 0x14, 0xFF, 0xEF, 0x02, 0xFF, 0xB3, 0x03, 0xFF, 0x34, 0x04, 0xFF, 0x30, 0x03, 0xFF, 0x92, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0x76, 0x04, 0xFF, 0xCF, 0x02, 0xFF, 0x30, 0x0B, 0xFF, 0xEF, 0x02, 0xFF, 0x10, 0x03, 0xFF, 0x14, 0x04, 0xFF, 0xEF, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0x30, 0x03, 0xFF, 0x2F, 0x0B, 0xFF, 0x70, 0x0B, 0xFF, 0xD2, 0x03, 0xFF, 0x88, 0x21, 0xFF, 0xA8, 0x19, 0xFF, 0x70, 0x44, 0xFF, 0x29, 0x2A, 0xFF, 0x4A, 0x2A, 0xFF, 0x6F, 0x43, 0xFF, 0x0D, 0x43, 0xFF, 0x71, 0x54, 0xFF, 0x2A, 0x32, 0xFF, 0x95, 0x7D, 0xFF, 0x0C, 0x5B, 0xFF, 0xEC, 0x52, 0xFF, 0x6E, 0x33, 0xFF, 0x12, 0x54, 0xFF, 0xCD, 0x2A, 0xFF, 0x70, 0x2B, 0xFF,
-    0xD1, 0x2B, 0xFF, 0x0F, 0x2B, 0xFF, 0xF6, 0x34, 0xFF, 0x70, 0x1B, 0xFF, 0xD0, 0x1B, 0xFF, 0x0F, 0x23, 0xFF, 0x38, 0x2D, 0xFF, 0x32, 0x0C, 0xFF, 0xD1, 0x13, 0xFF, 0xF2, 0x23, 0xFF, 0x32, 0x03, 0xFF, 0x35, 0x25, 0xFF, 0xB1, 0x13, 0xFF, 0x9C, 0x57, 0xFF, 0x12, 0x04, 0xFF, 0xDA, 0x26, 0xFF, 0xF1, 0x03, 0xFF, 0xDB, 0x36, 0xFF, 0xFF, 0xB7, 0xFF, 0xBD, 0x2E, 0xFF, 0x75, 0x14, 0xFF, 0x9D, 0x36, 0xFF, 0xD3, 0x03, 0xFF, 0x5A, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x0B, 0xFF, 0xB9, 0x05, 0xFF, 0xFF, 0xF7, 0xFF, 0x38, 0x05, 0xFF, 0x75, 0x03, 0xFF, 0x52, 0x03, 0xFF, 0x9D, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0x54, 0x03, 0xFF, 0x34, 0x04, 0xFF, 0x77, 0x05, 0xFF, 0xFF, 0xE7, 0xFF, 0xB5, 0x05, 0xFF, 0x14, 0x04, 0xFF, 0xFA, 0x1D, 0xFF, 0xFE, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xD6, 0x0C, 0xFF, 0xCF, 0x02, 0xFF, 0xB3, 0x03, 0xFF, 0x92, 0x03, 0xFF, 0xB3, 0x03, 0xFF, 0xCF, 0x02, 0xFF, 0x30, 0x03, 0xFF, 0x51, 0x0B, 0xFF, 0x14, 0x0C, 0xFF, 0xF0, 0x02, 0xFF, 0x8D, 0x02, 0xFF, 0x92, 0x0B, 0xFF, 0x31, 0x0B, 0xFF, 0x13, 0x04, 0xFF, 0x0F, 0x0B, 0xFF, 0xCE, 0x02, 0xFF, 0x0F, 0x0B, 0xFF, 0x50, 0x0B, 0xFF, 0xB1, 0x03, 0xFF, 0x71, 0x0B, 0xFF, 0x50, 0x03, 0xFF,
-    0x29, 0xA2, 0xFF, 0x4A, 0x42, 0xFF, 0xAB, 0x22, 0xFF, 0x09, 0x32, 0xFF, 0x29, 0x3A, 0xFF, 0x09, 0x2A, 0xFF, 0x8B, 0x52, 0xFF, 0xF1, 0x53, 0xFF, 0x0D, 0x4B, 0xFF, 0xAF, 0x53, 0xFF, 0xCC, 0x5A, 0xFF, 0x2D, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x42, 0xFF, 0x6C, 0x1A, 0xFF, 0x4F, 0x33, 0xFF, 0x56, 0x65, 0xFF, 0x6C, 0x1A, 0xFF, 0x4F, 0x2B, 0xFF, 0xAD, 0x12, 0xFF, 0x3A, 0x4E, 0xFF, 0xEF, 0x1A, 0xFF, 0x15, 0x4D, 0xFF, 0xD2, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0x3C, 0xFF, 0x91, 0x03, 0xFF, 0x94, 0x24, 0xFF, 0xFF, 0x6F, 0xFF, 0x9E, 0x5F, 0xFF, 0xB1, 0x13, 0xFF, 0xB5, 0x24, 0xFF, 0x54, 0x04, 0xFF, 0x79, 0x25, 0xFF, 0xF2, 0x03, 0xFF, 0x5C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x2D, 0xFF, 0x35, 0x1C, 0xFF, 0xFB, 0x1D, 0xFF, 0xFE, 0xCF, 0xFF, 0x39, 0x05, 0xFF, 0xF6, 0x0B, 0xFF, 0x96, 0x04, 0xFF, 0x9E, 0x67, 0xFF, 0xD4, 0x03, 0xFF, 0x74, 0x03, 0xFF, 0x54, 0x03, 0xFF, 0xFC, 0x04, 0xFF, 0xD7, 0x02, 0xFF, 0x33, 0x03, 0xFF, 0xD4, 0x03, 0xFF, 0x18, 0x1F, 0xFF, 0x56, 0x0E, 0xFF, 0xB4, 0x04, 0xFF, 0x35, 0x04, 0xFF, 0xBA, 0x1E, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x15, 0xFF, 0xF6, 0x1C, 0xFF, 0x93, 0x0B, 0xFF, 0xB7, 0x04, 0xFF, 0xCF, 0x02, 0xFF, 0xEF, 0x02, 0xFF,
-    0xCF, 0x02, 0xFF, 0xB2, 0x03, 0xFF, 0xD3, 0x03, 0xFF, 0x8E, 0x02, 0xFF, 0xD2, 0x0B, 0xFF, 0x10, 0x03, 0xFF, 0xF3, 0x0B, 0xFF, 0x71, 0x13, 0xFF, 0xAE, 0x02, 0xFF, 0x0F, 0x03, 0xFF, 0x91, 0x13, 0xFF, 0x30, 0x0B, 0xFF, 0x71, 0x0B, 0xFF, 0x50, 0x0B, 0xFF, 0x91, 0x0B, 0xFF, 0x91, 0x0B, 0xFF, 0xE9, 0x52, 0xFF, 0x6B, 0x22, 0xFF, 0x4B, 0x32, 0xFF, 0x30, 0x43, 0xFF, 0xEC, 0x2A, 0xFF, 0x09, 0x32, 0xFF, 0xF2, 0x53, 0xFF, 0xF6, 0x64, 0xFF, 0x6F, 0x4B, 0xFF, 0x2F, 0x43, 0xFF, 0x4F, 0x4B, 0xFF, 0x71, 0x3B, 0xFF, 0x2B, 0x2A, 0xFF, 0xF2, 0x3B, 0xFF, 0xED, 0x2A, 0xFF, 0xAD, 0x22, 0xFF, 0x57, 0x75, 0xFF, 0xB7, 0x2B, 0xFF, 0xFB, 0xFF, 0xFF, 0x6D, 0x1A, 0xFF, 0x71, 0x2B, 0xFF, 0x53, 0x44, 0xFF, 0xD6, 0x2C, 0xFF, 0x74, 0x2C, 0xFF, 0x34, 0x34, 0xFF, 0xAE, 0x43, 0xFF, 0x70, 0x1B, 0xFF, 0xD1, 0x1B, 0xFF, 0xFA, 0x15, 0xFF, 0x9A, 0x35, 0xFF, 0xF2, 0x23, 0xFF, 0xDC, 0x45, 0xFF, 0xB1, 0x1B, 0xFF, 0x59, 0x15, 0xFF, 0x92, 0x03, 0xFF, 0x9E, 0x5F, 0xFF, 0x7F, 0x36, 0xFF, 0xBF, 0x77, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0x3D, 0x05, 0xFF, 0x1A, 0x05, 0xFF, 0xF4, 0x03, 0xFF, 0x17, 0x04, 0xFF, 0x5D, 0x05, 0xFF, 0xB5, 0x03, 0xFF, 0x73, 0x03, 0xFF, 0xD5, 0x0B, 0xFF,
-    0xF8, 0x04, 0xFF, 0x17, 0x04, 0xFF, 0x7E, 0x05, 0xFF, 0x7B, 0x25, 0xFF, 0x35, 0x05, 0xFF, 0xB6, 0x04, 0xFF, 0xD3, 0x03, 0xFF, 0xDD, 0x06, 0xFF, 0xDA, 0x05, 0xFF, 0x12, 0x04, 0xFF, 0x34, 0x04, 0xFF, 0x91, 0x03, 0xFF, 0xB7, 0x04, 0xFF, 0xDC, 0x26, 0xFF, 0x51, 0x03, 0xFF, 0x0F, 0x03, 0xFF, 0x13, 0x04, 0xFF, 0x30, 0x03, 0xFF, 0xCF, 0x02, 0xFF, 0x15, 0x04, 0xFF, 0x95, 0x1C, 0xFF, 0x10, 0x0B, 0xFF, 0xCF, 0x02, 0xFF, 0x0F, 0x03, 0xFF, 0x13, 0x14, 0xFF, 0x55, 0x0C, 0xFF, 0x2F, 0x0B, 0xFF, 0x50, 0x0B, 0xFF, 0x70, 0x0B, 0xFF, 0xAE, 0x02, 0xFF, 0x35, 0x0C, 0xFF, 0xF4, 0x13, 0xFF, 0x0E, 0x53, 0xFF, 0xCD, 0x3A, 0xFF, 0x6B, 0x32, 0xFF, 0x09, 0x32, 0xFF, 0x91, 0x5C, 0xFF, 0x2F, 0x4B, 0xFF, 0x4A, 0x3A, 0xFF, 0xED, 0x3A, 0xFF, 0x0A, 0x2A, 0xFF, 0x8C, 0x32, 0xFF, 0x91, 0x43, 0xFF, 0x4F, 0x33, 0xFF, 0x6B, 0x22, 0xFF, 0x6C, 0x32, 0xFF, 0x96, 0x44, 0xFF, 0x35, 0x3C, 0xFF, 0x53, 0x4C, 0xFF, 0x2F, 0x33, 0xFF, 0xAE, 0x22, 0xFF, 0xB0, 0x0A, 0xFF, 0x5D, 0x34, 0xFF, 0x95, 0x12, 0xFF, 0x72, 0x23, 0xFF, 0x95, 0x24, 0xFF, 0x5C, 0x46, 0xFF, 0x92, 0x0B, 0xFF, 0x72, 0x13, 0xFF, 0x99, 0x15, 0xFF, 0xF3, 0x23, 0xFF, 0x5D, 0x5F, 0xFF, 0xD6, 0x2C, 0xFF, 0xB8, 0x3D, 0xFF,
-    0xB2, 0x23, 0xFF, 0x9C, 0x2D, 0xFF, 0xDE, 0x05, 0xFF, 0xDC, 0x35, 0xFF, 0x32, 0x03, 0xFF, 0xDF, 0x2E, 0xFF, 0xF6, 0x0B, 0xFF, 0xDF, 0xA7, 0xFF, 0xDC, 0x05, 0xFF, 0xF4, 0x03, 0xFF, 0xF5, 0x0B, 0xFF, 0xFB, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x14, 0xFF, 0x74, 0x03, 0xFF, 0xF5, 0x0C, 0xFF, 0xFF, 0x6F, 0xFF, 0x7F, 0x2F, 0xFF, 0x55, 0x14, 0xFF, 0x1A, 0x37, 0xFF, 0x33, 0x04, 0xFF, 0x72, 0x03, 0xFF, 0x1F, 0x1F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFA, 0x05, 0xFF, 0x95, 0x0C, 0xFF, 0xF4, 0x03, 0xFF, 0x16, 0x05, 0xFF, 0x3A, 0x05, 0xFF, 0xEF, 0x02, 0xFF, 0x75, 0x1C, 0xFF, 0x34, 0x14, 0xFF, 0x74, 0x1C, 0xFF, 0x94, 0x03, 0xFF, 0x72, 0x03, 0xFF, 0xAE, 0x02, 0xFF, 0x2F, 0x03, 0xFF, 0x71, 0x13, 0xFF, 0x14, 0x0C, 0xFF, 0xAF, 0x02, 0xFF, 0x0F, 0x0B, 0xFF, 0x0F, 0x03, 0xFF, 0xD0, 0x13, 0xFF, 0xD2, 0x13, 0xFF, 0x34, 0x0C, 0xFF, 0x70, 0x0B, 0xFF, 0xB1, 0x13, 0xFF, 0x71, 0x0B, 0xFF, 0xE9, 0x31, 0xFF, 0x6B, 0x32, 0xFF, 0xAC, 0x2A, 0xFF, 0xEC, 0x4A, 0xFF, 0x32, 0x5C, 0xFF, 0x2F, 0x4B, 0xFF, 0x09, 0x2A, 0xFF, 0x2B, 0x3A, 0xFF, 0x0A, 0x2A, 0xFF, 0xCD, 0x42, 0xFF, 0x0A, 0x22, 0xFF, 0xAC, 0x3A, 0xFF, 0xF2, 0x53, 0xFF, 0x12, 0x54, 0xFF, 0xF5, 0x43, 0xFF, 0xEF, 0x2A, 0xFF,
-    0x11, 0x1B, 0xFF, 0x4E, 0x32, 0xFF, 0x33, 0x4C, 0xFF, 0x70, 0x2B, 0xFF, 0x79, 0x1B, 0xFF, 0xFF, 0xEF, 0xFF, 0x17, 0x2C, 0xFF, 0x15, 0x24, 0xFF, 0x19, 0x35, 0xFF, 0x75, 0x0B, 0xFF, 0xD2, 0x1B, 0xFF, 0xB1, 0x23, 0xFF, 0xB7, 0x4C, 0xFF, 0x70, 0x0B, 0xFF, 0x5A, 0x26, 0xFF, 0x99, 0xCF, 0xFF, 0x53, 0x54, 0xFF, 0x38, 0x35, 0xFF, 0x19, 0x25, 0xFF, 0xFE, 0x1E, 0xFF, 0xB3, 0x03, 0xFF, 0x7B, 0x35, 0xFF, 0x17, 0x04, 0xFF, 0xFF, 0x37, 0xFF, 0xBD, 0x47, 0xFF, 0xD7, 0x14, 0xFF, 0x97, 0x14, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x2E, 0xFF, 0x94, 0x0B, 0xFF, 0x73, 0x03, 0xFF, 0x1F, 0x27, 0xFF, 0x3B, 0x05, 0xFF, 0x93, 0x03, 0xFF, 0xFB, 0x25, 0xFF, 0x92, 0x03, 0xFF, 0x93, 0x03, 0xFF, 0xDC, 0x0D, 0xFF, 0x15, 0x04, 0xFF, 0x55, 0x04, 0xFF, 0xF6, 0x03, 0xFF, 0x3C, 0x02, 0xFF, 0x7D, 0x15, 0xFF, 0x31, 0x03, 0xFF, 0x93, 0x03, 0xFF, 0x97, 0x1C, 0xFF, 0x35, 0x04, 0xFF, 0x96, 0x1C, 0xFF, 0xAF, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0xF7, 0x1C, 0xFF, 0xF4, 0x0B, 0xFF, 0xCE, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0x2F, 0x13, 0xFF, 0x14, 0x0C, 0xFF, 0xCE, 0x02, 0xFF, 0x2F, 0x03, 0xFF, 0x70, 0x0B, 0xFF, 0x70, 0x0B, 0xFF, 0x70, 0x0B, 0xFF, 0xF2, 0x0B, 0xFF,
-    0x2C, 0xFC, 0xFF, 0x6B, 0x3A, 0xFF, 0xCD, 0x2A, 0xFF, 0xC8, 0x29, 0xFF, 0x8C, 0x3A, 0xFF, 0x2A, 0x2A, 0xFF, 0xCC, 0x42, 0xFF, 0xAC, 0x32, 0xFF, 0x0D, 0x4B, 0xFF, 0x4B, 0x2A, 0xFF, 0x2B, 0x32, 0xFF, 0x34, 0x74, 0xFF, 0xF4, 0xFF, 0xFF, 0xCD, 0x3A, 0xFF, 0x6C, 0x22, 0xFF, 0x12, 0x54, 0xFF, 0x70, 0x23, 0xFF, 0x8D, 0x32, 0xFF, 0xEF, 0x2A, 0xFF, 0x59, 0x45, 0xFF, 0xFF, 0x57, 0xFF, 0xF1, 0x2A, 0xFF, 0xD3, 0x2B, 0xFF, 0x5A, 0x26, 0xFF, 0xFF, 0xF7, 0xFF, 0x53, 0x0C, 0xFF, 0xFA, 0x35, 0xFF, 0xB8, 0x25, 0xFF, 0xFF, 0xF7, 0xFF, 0x96, 0x14, 0xFF, 0x17, 0x2D, 0xFF, 0x54, 0x2D, 0xFF, 0x55, 0x1C, 0xFF, 0xB5, 0x24, 0xFF, 0xD3, 0x13, 0xFF, 0x96, 0x24, 0xFF, 0x3B, 0x26, 0xFF, 0xF7, 0x24, 0xFF, 0x14, 0x1C, 0xFF, 0x36, 0x05, 0xFF, 0xFB, 0x06, 0xFF, 0xFA, 0x0D, 0xFF, 0x55, 0x0C, 0xFF, 0xFB, 0x04, 0xFF, 0x1E, 0x0F, 0xFF, 0xB3, 0x03, 0xFF, 0x93, 0x03, 0xFF, 0x73, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0x5E, 0x1D, 0xFF, 0x1F, 0x3F, 0xFF, 0x36, 0x15, 0xFF, 0x97, 0x1F, 0xFF, 0xBA, 0x06, 0xFF, 0x97, 0x04, 0xFF, 0x35, 0x04, 0xFF, 0x76, 0x04, 0xFF, 0xDF, 0x05, 0xFF, 0x9B, 0x03, 0xFF, 0x95, 0x03, 0xFF, 0xB3, 0x0B, 0xFF, 0x8F, 0x02, 0xFF, 0x31, 0x03, 0xFF, 0x50, 0x03, 0xFF,
-    0xB2, 0x03, 0xFF, 0x8F, 0x02, 0xFF, 0x35, 0x04, 0xFF, 0x51, 0x13, 0xFF, 0x76, 0x24, 0xFF, 0x50, 0x0B, 0xFF, 0x34, 0x0C, 0xFF, 0x30, 0x03, 0xFF, 0xD4, 0x1B, 0xFF, 0x30, 0x13, 0xFF, 0x30, 0x13, 0xFF, 0x50, 0x0B, 0xFF, 0xB2, 0x0B, 0xFF, 0x71, 0x13, 0xFF, 0x91, 0x13, 0xFF, 0x90, 0x0B, 0xFF, 0x6B, 0x32, 0xFF, 0xE8, 0x29, 0xFF, 0xAC, 0x22, 0xFF, 0xE9, 0x29, 0xFF, 0x4A, 0x22, 0xFF, 0xE9, 0x21, 0xFF, 0x0A, 0x32, 0xFF, 0x6B, 0x32, 0xFF, 0xEA, 0x29, 0xFF, 0x4A, 0x2A, 0xFF, 0x4C, 0x2B, 0xFF, 0xB3, 0x5C, 0xFF, 0x9A, 0x76, 0xFF, 0x6B, 0x2A, 0xFF, 0x71, 0x1B, 0xFF, 0x91, 0x4B, 0xFF, 0x30, 0x1B, 0xFF, 0xAD, 0x2A, 0xFF, 0x32, 0x3C, 0xFF, 0x17, 0x45, 0xFF, 0xD7, 0x3C, 0xFF, 0xD3, 0x3B, 0xFF, 0x95, 0x3C, 0xFF, 0xB5, 0x24, 0xFF, 0x19, 0x2E, 0xFF, 0xF3, 0x04, 0xFF, 0x19, 0x3F, 0xFF, 0x53, 0x14, 0xFF, 0x14, 0x24, 0xFF, 0xFF, 0xD7, 0xFF, 0x95, 0x0B, 0xFF, 0x7E, 0x5F, 0xFF, 0xD3, 0x1B, 0xFF, 0x1D, 0x26, 0xFF, 0x95, 0x14, 0xFF, 0xFB, 0x2D, 0xFF, 0xDF, 0x57, 0xFF, 0x7C, 0x3F, 0xFF, 0x13, 0x04, 0xFF, 0x57, 0x15, 0xFF, 0x3A, 0x06, 0xFF, 0xFD, 0x05, 0xFF, 0x55, 0x14, 0xFF, 0xD7, 0x04, 0xFF, 0x3A, 0x0E, 0xFF, 0x72, 0x03, 0xFF, 0x72, 0x03, 0xFF, 0xF7, 0x1C, 0xFF,
-    0x39, 0x47, 0xFF, 0x74, 0x04, 0xFF, 0x17, 0x15, 0xFF, 0x94, 0x04, 0xFF, 0x58, 0x0E, 0xFF, 0xD2, 0x03, 0xFF, 0x34, 0x14, 0xFF, 0x94, 0x04, 0xFF, 0x97, 0x05, 0xFF, 0xB3, 0x03, 0xFF, 0x73, 0x03, 0xFF, 0xD4, 0x03, 0xFF, 0x95, 0x04, 0xFF, 0x8E, 0x02, 0xFF, 0x51, 0x03, 0xFF, 0x30, 0x03, 0xFF, 0x91, 0x03, 0xFF, 0x8E, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x8E, 0x02, 0xFF, 0x50, 0x03, 0xFF, 0x70, 0x0B, 0xFF, 0xAE, 0x02, 0xFF, 0xEF, 0x0A, 0xFF, 0x91, 0x0B, 0xFF, 0x54, 0x2C, 0xFF, 0x2F, 0x0B, 0xFF, 0x50, 0x0B, 0xFF, 0x90, 0x13, 0xFF, 0x90, 0x03, 0xFF, 0x70, 0x0B, 0xFF, 0x70, 0x0B, 0xFF, 0x2E, 0x3B, 0xFF, 0x90, 0x33, 0xFF, 0x6C, 0x2A, 0xFF, 0x09, 0x32, 0xFF, 0x2B, 0x2A, 0xFF, 0x2E, 0x3B, 0xFF, 0xD3, 0x43, 0xFF, 0x2B, 0x4A, 0xFF, 0x49, 0x3A, 0xFF, 0x4A, 0x3A, 0xFF, 0x74, 0x54, 0xFF, 0xB2, 0x43, 0xFF, 0x16, 0x6D, 0xFF, 0x29, 0x32, 0xFF, 0xB2, 0x1B, 0xFF, 0xCE, 0x32, 0xFF, 0x2E, 0x33, 0xFF, 0xF5, 0x43, 0xFF, 0x30, 0x43, 0xFF, 0x74, 0x44, 0xFF, 0x93, 0x33, 0xFF, 0x31, 0x2B, 0xFF, 0x51, 0x23, 0xFF, 0xF9, 0x24, 0xFF, 0x15, 0x1C, 0xFF, 0x50, 0x13, 0xFF, 0x54, 0x24, 0xFF, 0x53, 0x1C, 0xFF, 0x13, 0x1C, 0xFF, 0x92, 0x1B, 0xFF, 0xD3, 0x1B, 0xFF, 0x54, 0x2C, 0xFF,
-    0x91, 0x1B, 0xFF, 0xF9, 0x1C, 0xFF, 0xBD, 0x1C, 0xFF, 0xDB, 0x3D, 0xFF, 0x52, 0x03, 0xFF, 0x5E, 0x35, 0xFF, 0x33, 0x13, 0xFF, 0xB3, 0x0B, 0xFF, 0x75, 0x0C, 0xFF, 0x76, 0x0C, 0xFF, 0xD3, 0x03, 0xFF, 0x76, 0x04, 0xFF, 0x35, 0x1C, 0xFF, 0x92, 0x03, 0xFF, 0x72, 0x03, 0xFF, 0x96, 0x1C, 0xFF, 0xF4, 0x03, 0xFF, 0x71, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0x53, 0x04, 0xFF, 0x51, 0x03, 0xFF, 0x92, 0x03, 0xFF, 0x75, 0x04, 0xFF, 0x95, 0x04, 0xFF, 0xB3, 0x03, 0xFF, 0xD4, 0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0x32, 0x03, 0xFF, 0x92, 0x03, 0xFF, 0x15, 0x0C, 0xFF, 0x10, 0x03, 0xFF, 0xAF, 0x02, 0xFF, 0x30, 0x03, 0xFF, 0x91, 0x0B, 0xFF, 0xAF, 0x02, 0xFF, 0xCF, 0x0A, 0xFF, 0xAD, 0x02, 0xFF, 0x13, 0x24, 0xFF, 0xAE, 0x02, 0xFF, 0x50, 0x13, 0xFF, 0x0F, 0x03, 0xFF, 0x70, 0x13, 0xFF, 0x50, 0x0B, 0xFF, 0x2F, 0x0B, 0xFF, 0x2F, 0x0B, 0xFF, 0x70, 0x0B, 0xFF, 0x91, 0x0B, 0xFF, 0x90, 0x0B, 0xFF, 0x0D, 0x5B, 0xFF, 0xB1, 0x73, 0xFF, 0xC8, 0x31, 0xFF, 0x0D, 0x4B, 0xFF, 0xE8, 0x31, 0xFF, 0x6F, 0x7B, 0xFF, 0x4A, 0x6A, 0xFF, 0xF7, 0xFF, 0xFF, 0x6F, 0xC3, 0xFF, 0x2A, 0x5A, 0xFF, 0x71, 0x63, 0xFF, 0x6C, 0x42, 0xFF, 0x12, 0x64, 0xFF, 0x31, 0x43, 0xFF, 0x8C, 0x3A, 0xFF, 0xD6, 0x43, 0xFF,
-    0xEF, 0x3A, 0xFF, 0x4C, 0x32, 0xFF, 0x8D, 0x32, 0xFF, 0x79, 0x7D, 0xFF, 0x39, 0x13, 0xFF, 0xFA, 0x01, 0xFF, 0x31, 0x2B, 0xFF, 0x34, 0x44, 0xFF, 0x51, 0x03, 0xFF, 0xB2, 0x0B, 0xFF, 0xF2, 0x23, 0xFF, 0x74, 0x4C, 0xFF, 0xF7, 0x44, 0xFF, 0xD7, 0x2C, 0xFF, 0x91, 0x13, 0xFF, 0x72, 0x24, 0xFF, 0xF1, 0x1B, 0xFF, 0xDA, 0x4D, 0xFF, 0x59, 0x1D, 0xFF, 0x94, 0xE5, 0xFF, 0x50, 0x13, 0xFF, 0xD6, 0x44, 0xFF, 0xB2, 0xAB, 0xFF, 0xFC, 0x1D, 0xFF, 0x95, 0x1C, 0xFF, 0xB3, 0x0B, 0xFF, 0x53, 0x0C, 0xFF, 0x17, 0x0D, 0xFF, 0x19, 0x0D, 0xFF, 0x50, 0x0B, 0xFF, 0x72, 0x0B, 0xFF, 0xB7, 0x2C, 0xFF, 0x13, 0x04, 0xFF, 0xBB, 0x0D, 0xFF, 0x35, 0x04, 0xFF, 0x34, 0x14, 0xFF, 0x51, 0x03, 0xFF, 0xF4, 0x0B, 0xFF, 0x5F, 0x2F, 0xFF, 0xDF, 0xCF, 0xFF, 0xB4, 0x03, 0xFF, 0x95, 0x03, 0xFF, 0x17, 0x0C, 0xFF, 0xD5, 0x03, 0xFF, 0xB9, 0x04, 0xFF, 0x56, 0x04, 0xFF, 0x8F, 0x02, 0xFF, 0x8F, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0x39, 0x15, 0xFF, 0xF4, 0x0B, 0xFF, 0x14, 0x0C, 0xFF, 0xEE, 0x0A, 0xFF, 0xB2, 0x1B, 0xFF, 0xEF, 0x02, 0xFF, 0x35, 0x0C, 0xFF, 0x54, 0x04, 0xFF, 0x50, 0x0B, 0xFF, 0x4F, 0x0B, 0xFF, 0x70, 0x0B, 0xFF, 0x57, 0x2D, 0xFF, 0x53, 0x1C, 0xFF, 0xB6, 0x1C, 0xFF, 0xCE, 0x0A, 0xFF,
-    0x09, 0x3A, 0xFF, 0xA8, 0x31, 0xFF, 0xC9, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0x74, 0x75, 0xFF, 0xE9, 0x49, 0xFF, 0x6F, 0xA3, 0xFF, 0x0E, 0x93, 0xFF, 0x09, 0x4A, 0xFF, 0xEC, 0x52, 0xFF, 0xAC, 0x62, 0xFF, 0xAD, 0x3A, 0xFF, 0x8A, 0x42, 0xFF, 0x70, 0x43, 0xFF, 0xB1, 0x4B, 0xFF, 0x76, 0x65, 0xFF, 0x2B, 0x3A, 0xFF, 0x73, 0x9C, 0xFF, 0x6D, 0x1A, 0xFF, 0x98, 0x65, 0xFF, 0x56, 0x1A, 0xFF, 0x56, 0x34, 0xFF, 0x71, 0x1B, 0xFF, 0x51, 0x0C, 0xFF, 0xD0, 0x14, 0xFF, 0xF5, 0x3D, 0xFF, 0xB4, 0x2C, 0xFF, 0xF6, 0x44, 0xFF, 0x70, 0x1B, 0xFF, 0xF3, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x3E, 0xFF, 0xF2, 0x23, 0xFF, 0xF2, 0x23, 0xFF, 0xF9, 0x2D, 0xFF, 0x50, 0x03, 0xFF, 0x36, 0x3D, 0xFF, 0xD2, 0x23, 0xFF, 0xF4, 0x0B, 0xFF, 0xBA, 0x25, 0xFF, 0x54, 0x1C, 0xFF, 0x71, 0x0B, 0xFF, 0x12, 0x04, 0xFF, 0x7C, 0x26, 0xFF, 0xF2, 0x03, 0xFF, 0x52, 0x0B, 0xFF, 0x75, 0x1C, 0xFF, 0x18, 0x15, 0xFF, 0x9A, 0x0D, 0xFF, 0x31, 0x03, 0xFF, 0xD3, 0x0B, 0xFF, 0x71, 0x03, 0xFF, 0x3A, 0x05, 0xFF, 0xB7, 0x04, 0xFF, 0x9A, 0x1D, 0xFF, 0x53, 0x03, 0xFF, 0x1B, 0x04, 0xFF, 0xFF, 0xDF, 0xFF, 0xB3, 0x02, 0xFF, 0x52, 0x0B, 0xFF, 0x56, 0x03, 0xFF, 0x54, 0x03, 0xFF, 0x79, 0x0C, 0xFF,
-    0x2E, 0x02, 0xFF, 0xB3, 0x1B, 0xFF, 0xAE, 0x0A, 0xFF, 0xEF, 0x02, 0xFF, 0xB4, 0x0B, 0xFF, 0xAF, 0x02, 0xFF, 0xD7, 0x44, 0xFF, 0x54, 0x14, 0xFF, 0xEE, 0x0A, 0xFF, 0x14, 0x14, 0xFF, 0x8D, 0x02, 0xFF, 0x50, 0x13, 0xFF, 0x50, 0x0B, 0xFF, 0x91, 0x0B, 0xFF, 0x13, 0x1C, 0xFF, 0xD2, 0x13, 0xFF, 0xE9, 0x39, 0xFF, 0xE9, 0x39, 0xFF, 0xE8, 0x31, 0xFF, 0x4A, 0x4A, 0xFF, 0xA8, 0x31, 0xFF, 0x0D, 0x63, 0xFF, 0x53, 0x84, 0xFF, 0x0A, 0x4A, 0xFF, 0x4F, 0x5B, 0xFF, 0x2A, 0x52, 0xFF, 0xAE, 0xB3, 0xFF, 0xFD, 0xFF, 0xFF, 0xCC, 0x4A, 0xFF, 0x2B, 0x4A, 0xFF, 0x50, 0xC3, 0xFF, 0x09, 0xE2, 0xFF, 0x6F, 0x63, 0xFF, 0x0F, 0x4B, 0xFF, 0x0F, 0x43, 0xFF, 0x30, 0x23, 0xFF, 0xB2, 0x3B, 0xFF, 0x0B, 0x82, 0xFF, 0xB1, 0x4B, 0xFF, 0xF2, 0x33, 0xFF, 0x50, 0x1B, 0xFF, 0xB3, 0x15, 0xFF, 0x76, 0x3F, 0xFF, 0xD7, 0x4D, 0xFF, 0x51, 0x23, 0xFF, 0x97, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x1C, 0xFF, 0x14, 0x2C, 0xFF, 0x17, 0x25, 0xFF, 0x3B, 0x66, 0xFF, 0x19, 0x3E, 0xFF, 0xF3, 0x2C, 0xFF, 0xDD, 0xEF, 0xFF, 0x13, 0x24, 0xFF, 0x50, 0x0B, 0xFF, 0xF8, 0x14, 0xFF, 0xF3, 0x0B, 0xFF, 0x51, 0x0B, 0xFF, 0x34, 0x14, 0xFF, 0xDF, 0xEF, 0xFF, 0x56, 0x2D, 0xFF, 0x10, 0x03, 0xFF, 0x57, 0x46, 0xFF,
-    0xFF, 0xDF, 0xFF, 0x51, 0x03, 0xFF, 0xF0, 0x02, 0xFF, 0x14, 0x14, 0xFF, 0xB8, 0x1D, 0xFF, 0x11, 0x03, 0xFF, 0x97, 0x24, 0xFF, 0x55, 0x14, 0xFF, 0xD6, 0x04, 0xFF, 0x39, 0x1C, 0xFF, 0x76, 0x03, 0xFF, 0x56, 0x0C, 0xFF, 0x95, 0x0C, 0xFF, 0x92, 0x0B, 0xFF, 0x10, 0x03, 0xFF, 0x92, 0x0B, 0xFF, 0x54, 0x1C, 0xFF, 0xB2, 0x1B, 0xFF, 0xAE, 0x02, 0xFF, 0x91, 0x0B, 0xFF, 0xF2, 0x1B, 0xFF, 0xEF, 0x02, 0xFF, 0xAD, 0x02, 0xFF, 0xEF, 0x0A, 0xFF, 0x0F, 0x0B, 0xFF, 0x50, 0x13, 0xFF, 0x50, 0x13, 0xFF, 0x50, 0x0B, 0xFF, 0x50, 0x0B, 0xFF, 0x91, 0x0B, 0xFF, 0xB1, 0x13, 0xFF, 0xB1, 0x13, 0xFF, 0xC8, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0x29, 0x3A, 0xFF, 0xD0, 0x5B, 0xFF, 0xE9, 0x39, 0xFF, 0x6B, 0x32, 0xFF, 0xE9, 0x39, 0xFF, 0xEA, 0x39, 0xFF, 0x0A, 0x42, 0xFF, 0x2B, 0x42, 0xFF, 0xED, 0x42, 0xFF, 0x2E, 0x53, 0xFF, 0x6C, 0x42, 0xFF, 0xCD, 0x3A, 0xFF, 0x4B, 0x2A, 0xFF, 0x4C, 0x22, 0xFF, 0x4B, 0x2A, 0xFF, 0xEE, 0x3A, 0xFF, 0xAD, 0x3A, 0xFF, 0x8C, 0x3A, 0xFF, 0x6F, 0x2B, 0xFF, 0xED, 0x22, 0xFF, 0x4D, 0x1B, 0xFF, 0xF0, 0x33, 0xFF, 0x4F, 0x23, 0xFF, 0x33, 0x3C, 0xFF, 0xAF, 0x1A, 0xFF, 0xF0, 0x1A, 0xFF, 0xCF, 0x1A, 0xFF,
-    0x0F, 0x23, 0xFF, 0xB1, 0x2B, 0xFF, 0x91, 0x2B, 0xFF, 0x53, 0x3C, 0xFF, 0x0F, 0x13, 0xFF, 0x94, 0x34, 0xFF, 0x91, 0x6B, 0xFF, 0x30, 0x1B, 0xFF, 0x51, 0x1B, 0xFF, 0x10, 0x64, 0xFF, 0x10, 0x13, 0xFF, 0x71, 0x13, 0xFF, 0x92, 0x1B, 0xFF, 0x13, 0x2C, 0xFF, 0x10, 0x0B, 0xFF, 0x51, 0x0B, 0xFF, 0x10, 0x03, 0xFF, 0x72, 0x13, 0xFF, 0x4E, 0x02, 0xFF, 0x10, 0x0B, 0xFF, 0x52, 0x13, 0xFF, 0x51, 0x0B, 0xFF, 0x14, 0x1C, 0xFF, 0xD0, 0x02, 0xFF, 0xF1, 0x0A, 0xFF, 0x72, 0x13, 0xFF, 0x52, 0x0B, 0xFF, 0x11, 0x0B, 0xFF, 0x10, 0x0B, 0xFF, 0x8E, 0x02, 0xFF, 0x51, 0x13, 0xFF, 0x4D, 0x02, 0xFF, 0xCF, 0x0A, 0xFF, 0x8E, 0x02, 0xFF, 0x6D, 0x0A, 0xFF, 0xAD, 0x12, 0xFF, 0x8D, 0x0A, 0xFF, 0xEF, 0x0A, 0xFF, 0xAD, 0x02, 0xFF, 0xEE, 0x0A, 0xFF, 0xEF, 0x12, 0xFF, 0xEF, 0x12, 0xFF, 0x2F, 0x0B, 0xFF, 0x2F, 0x13, 0xFF, 0x4F, 0x0B, 0xFF, 0x91, 0x13, 0xFF, 0x70, 0x13, 0xFF, 0x90, 0x13, 0xFF, 0xA8, 0x29, 0xFF, 0xC8, 0x31, 0xFF, 0xA8, 0x31, 0xFF, 0xA8, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xA8, 0x29, 0xFF, 0x29, 0x3A, 0xFF, 0xE9, 0x31, 0xFF, 0x09, 0x32, 0xFF, 0xE9, 0x39, 0xFF, 0x09, 0x3A, 0xFF, 0x0A, 0x3A, 0xFF, 0x4B, 0x3A, 0xFF, 0xCC, 0x42, 0xFF, 0xAD, 0x3A, 0xFF, 0x2B, 0x32, 0xFF,
-    0x2B, 0x2A, 0xFF, 0xAD, 0x32, 0xFF, 0x8C, 0x32, 0xFF, 0x6B, 0x2A, 0xFF, 0x8C, 0x32, 0xFF, 0x6C, 0x32, 0xFF, 0xAC, 0x32, 0xFF, 0xAD, 0x2A, 0xFF, 0xCD, 0x2A, 0xFF, 0x2E, 0x2B, 0xFF, 0x0E, 0x2B, 0xFF, 0x0E, 0x2B, 0xFF, 0x0F, 0x23, 0xFF, 0xCE, 0x22, 0xFF, 0x0F, 0x23, 0xFF, 0x0F, 0x23, 0xFF, 0xCE, 0x1A, 0xFF, 0xF1, 0x23, 0xFF, 0x0F, 0x23, 0xFF, 0x72, 0x23, 0xFF, 0x30, 0x1B, 0xFF, 0x91, 0x1B, 0xFF, 0x50, 0x13, 0xFF, 0x0F, 0x1B, 0xFF, 0x0F, 0x13, 0xFF, 0x0F, 0x13, 0xFF, 0x0F, 0x13, 0xFF, 0x51, 0x13, 0xFF, 0x30, 0x13, 0xFF, 0x92, 0x1B, 0xFF, 0x10, 0x0B, 0xFF, 0x10, 0x0B, 0xFF, 0x10, 0x0B, 0xFF, 0x10, 0x0B, 0xFF, 0x6E, 0x02, 0xFF, 0xEF, 0x02, 0xFF, 0xEF, 0x0A, 0xFF, 0x71, 0x13, 0xFF, 0x10, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x02, 0xFF, 0x51, 0x0B, 0xFF, 0xAF, 0x0A, 0xFF, 0xAF, 0x0A, 0xFF, 0x10, 0x1B, 0xFF, 0x8E, 0x02, 0xFF, 0xEF, 0x12, 0xFF, 0xCE, 0x12, 0xFF, 0x6D, 0x0A, 0xFF, 0x8D, 0x0A, 0xFF, 0x6D, 0x0A, 0xFF, 0x8D, 0x0A, 0xFF, 0xAD, 0x0A, 0xFF, 0xAD, 0x0A, 0xFF, 0xCE, 0x0A, 0xFF, 0xAD, 0x0A, 0xFF, 0xEE, 0x12, 0xFF, 0xEF, 0x12, 0xFF, 0x0F, 0x13, 0xFF, 0x4F, 0x13, 0xFF, 0x2F, 0x0B, 0xFF, 0x2F, 0x0B, 0xFF, 0x91, 0x1B, 0xFF,
-    0x08, 0x4A, 0xFF, 0x0E, 0x4B, 0xFF, 0xAB, 0x52, 0xFF, 0xEE, 0x52, 0xFF, 0xE8, 0x39, 0xFF, 0x4A, 0x42, 0xFF, 0x0F, 0x4B, 0xFF, 0xAF, 0x6B, 0xFF, 0x4E, 0x53, 0xFF, 0xCC, 0x4A, 0xFF, 0x70, 0x5B, 0xFF, 0xB1, 0x43, 0xFF, 0x12, 0xFC, 0xFF, 0xAD, 0x2A, 0xFF, 0xEA, 0x31, 0xFF, 0xD8, 0x44, 0xFF, 0xC9, 0x21, 0xFF, 0xB3, 0x43, 0xFF, 0xD6, 0x5C, 0xFF, 0x34, 0x74, 0xFF, 0xCF, 0x32, 0xFF, 0xF2, 0x5B, 0xFF, 0x8D, 0x2A, 0xFF, 0x54, 0x44, 0xFF, 0xED, 0x3A, 0xFF, 0xAD, 0x1A, 0xFF, 0xCC, 0x2A, 0xFF, 0x8D, 0x1A, 0xFF, 0x55, 0x34, 0xFF, 0x74, 0x34, 0xFF, 0x70, 0x2B, 0xFF, 0x77, 0x45, 0xFF, 0x0E, 0x2B, 0xFF, 0xB6, 0x24, 0xFF, 0xF6, 0x2C, 0xFF, 0xCD, 0x0A, 0xFF, 0x93, 0x44, 0xFF, 0xF2, 0x33, 0xFF, 0x91, 0x23, 0xFF, 0x78, 0x25, 0xFF, 0xD2, 0x23, 0xFF, 0x51, 0x1B, 0xFF, 0xEF, 0x12, 0xFF, 0x50, 0x03, 0xFF, 0xD7, 0x14, 0xFF, 0xD2, 0x13, 0xFF, 0xF0, 0x12, 0xFF, 0xF0, 0x02, 0xFF, 0x50, 0x0B, 0xFF, 0xB8, 0x15, 0xFF, 0xEF, 0x02, 0xFF, 0x10, 0x0B, 0xFF, 0x4D, 0x02, 0xFF, 0x51, 0x13, 0xFF, 0x9A, 0x1D, 0xFF, 0xD8, 0x04, 0xFF, 0xAE, 0x02, 0xFF, 0xAF, 0x0A, 0xFF, 0x11, 0x13, 0xFF, 0xD1, 0x02, 0xFF, 0x99, 0x0C, 0xFF, 0x36, 0x04, 0xFF, 0x8E, 0x02, 0xFF, 0x6D, 0x02, 0xFF,
-    0xB2, 0x13, 0xFF, 0x10, 0x0B, 0xFF, 0x1B, 0x3E, 0xFF, 0xCF, 0x0A, 0xFF, 0x8C, 0x0A, 0xFF, 0xEE, 0x12, 0xFF, 0x0F, 0x0B, 0xFF, 0x0F, 0x13, 0xFF, 0x34, 0x14, 0xFF, 0x0F, 0x13, 0xFF, 0x0F, 0x13, 0xFF, 0x2F, 0x13, 0xFF, 0x4F, 0x03, 0xFF, 0xEE, 0x0A, 0xFF, 0xD3, 0x1B, 0xFF, 0xCD, 0x0A, 0xFF, 0xA7, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0xA8, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0xA8, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xE8, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0xE9, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xC8, 0x39, 0xFF, 0xE9, 0x39, 0xFF, 0x29, 0x3A, 0xFF, 0x2A, 0x3A, 0xFF, 0x09, 0x32, 0xFF, 0xA8, 0x29, 0xFF, 0x4A, 0x3A, 0xFF, 0x2A, 0x3A, 0xFF, 0x4A, 0x32, 0xFF, 0x2A, 0x3A, 0xFF, 0x4A, 0x42, 0xFF, 0xE9, 0x49, 0xFF, 0x6B, 0x32, 0xFF, 0xAC, 0x3A, 0xFF, 0xAC, 0x3A, 0xFF, 0x8C, 0x32, 0xFF, 0xAC, 0x32, 0xFF, 0xAC, 0x2A, 0xFF, 0x8C, 0x2A, 0xFF, 0x8C, 0x2A, 0xFF, 0x8C, 0x22, 0xFF, 0xAD, 0x2A, 0xFF, 0xCD, 0x32, 0xFF, 0xCE, 0x2A, 0xFF, 0x0E, 0x33, 0xFF, 0x8C, 0x22, 0xFF, 0xB0, 0x6B, 0xFF, 0xCE, 0x2A, 0xFF, 0xCE, 0x22, 0xFF, 0x8D, 0x12, 0xFF, 0x30, 0x23, 0xFF, 0x8D, 0x12, 0xFF, 0x0F, 0x1B, 0xFF, 0x71, 0x2B, 0xFF, 0x50, 0x23, 0xFF, 0xAE, 0x12, 0xFF, 0x50, 0x1B, 0xFF,
-    0xAE, 0x02, 0xFF, 0x30, 0x1B, 0xFF, 0xAE, 0x12, 0xFF, 0xD2, 0x23, 0xFF, 0x50, 0x1B, 0xFF, 0x10, 0x13, 0xFF, 0xCF, 0x02, 0xFF, 0x91, 0x1B, 0xFF, 0xCE, 0x02, 0xFF, 0x31, 0x13, 0xFF, 0x0F, 0x0B, 0xFF, 0xB2, 0x13, 0xFF, 0x8D, 0x02, 0xFF, 0xAE, 0x02, 0xFF, 0x71, 0x1B, 0xFF, 0xB2, 0x0B, 0xFF, 0x10, 0x13, 0xFF, 0xEF, 0x1A, 0xFF, 0x0F, 0x13, 0xFF, 0x30, 0x0B, 0xFF, 0xEF, 0x0A, 0xFF, 0x6D, 0x02, 0xFF, 0xF3, 0x1B, 0xFF, 0xF2, 0x13, 0xFF, 0xCE, 0x0A, 0xFF, 0x70, 0x13, 0xFF, 0x13, 0x1C, 0xFF, 0xD2, 0x1B, 0xFF, 0x70, 0x13, 0xFF, 0x0E, 0x13, 0xFF, 0xF2, 0x13, 0xFF, 0xAD, 0x0A, 0xFF, 0xA7, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0xA8, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xC8, 0x31, 0xFF, 0xC7, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xE9, 0x31, 0xFF, 0xC8, 0x29, 0xFF, 0xC9, 0x31, 0xFF, 0xE9, 0x31, 0xFF, 0xE9, 0x31, 0xFF, 0xE9, 0x31, 0xFF, 0x0A, 0x32, 0xFF, 0xE9, 0x29, 0xFF, 0x09, 0x32, 0xFF, 0x0A, 0x3A, 0xFF, 0x0A, 0x3A, 0xFF, 0x6C, 0x32, 0xFF, 0x2A, 0x2A, 0xFF, 0x6B, 0x32, 0xFF, 0x8C, 0x32, 0xFF, 0x6B, 0x2A, 0xFF, 0xAC, 0x2A, 0xFF, 0x6B, 0x2A, 0xFF, 0x8C, 0x2A, 0xFF, 0x8C, 0x2A, 0xFF,
-    0x4B, 0x22, 0xFF, 0xAD, 0x2A, 0xFF, 0x8C, 0x22, 0xFF, 0xEE, 0x2A, 0xFF, 0x8C, 0x22, 0xFF, 0xEE, 0x2A, 0xFF, 0xCD, 0x2A, 0xFF, 0x8D, 0x22, 0xFF, 0x6C, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF, 0xEF, 0x1A, 0xFF, 0xCE, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF, 0x8D, 0x12, 0xFF, 0xEF, 0x1A, 0xFF, 0xAE, 0x12, 0xFF, 0x0F, 0x1B, 0xFF, 0xAE, 0x1A, 0xFF, 0xEE, 0x12, 0xFF, 0x0B, 0x02, 0xFF, 0xCE, 0x12, 0xFF, 0x8E, 0x12, 0xFF, 0xEF, 0x1A, 0xFF, 0xAE, 0x12, 0xFF, 0x6D, 0x0A, 0xFF, 0x8D, 0x0A, 0xFF, 0x0C, 0x02, 0xFF, 0x2C, 0x02, 0xFF, 0x4C, 0x0A, 0xFF, 0x4C, 0x0A, 0xFF, 0x4C, 0x0A, 0xFF, 0x6C, 0x12, 0xFF, 0x2B, 0x0A, 0xFF, 0x2B, 0x0A, 0xFF, 0xEA, 0x01, 0xFF, 0x2B, 0x0A, 0xFF, 0x4C, 0x0A, 0xFF, 0xAD, 0x12, 0xFF, 0xAD, 0x12, 0xFF, 0xAD, 0x12, 0xFF, 0xAD, 0x12, 0xFF, 0xEE, 0x12, 0xFF, 0x0E, 0x1B, 0xFF, 0x2F, 0x13, 0xFF, 0x0E, 0x13, 0xFF, 0x50, 0x13, 0xFF, 0xEE, 0x12, 0xFF, 0x09, 0x42, 0xFF, 0xA7, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x87, 0x31, 0xFF, 0xA7, 0x39, 0xFF, 0xC8, 0x39, 0xFF, 0x08, 0x3A, 0xFF, 0xC7, 0x39, 0xFF, 0x08, 0x3A, 0xFF, 0xC7, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xC8, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xE9, 0x31, 0xFF,
-    0x29, 0x42, 0xFF, 0x09, 0x3A, 0xFF, 0x2A, 0x42, 0xFF, 0xAB, 0x4A, 0xFF, 0xE9, 0x41, 0xFF, 0x2A, 0x52, 0xFF, 0x09, 0x42, 0xFF, 0x8B, 0x4A, 0xFF, 0x6B, 0x3A, 0xFF, 0xAC, 0x3A, 0xFF, 0x8B, 0x32, 0xFF, 0x8B, 0x3A, 0xFF, 0x6B, 0x3A, 0xFF, 0x6B, 0x32, 0xFF, 0x6B, 0x3A, 0xFF, 0x4B, 0x3A, 0xFF, 0x8C, 0x32, 0xFF, 0xCD, 0x3A, 0xFF, 0xCD, 0x32, 0xFF, 0x4F, 0x43, 0xFF, 0x6C, 0x2A, 0xFF, 0x8C, 0x2A, 0xFF, 0xAD, 0x2A, 0xFF, 0x6C, 0x1A, 0xFF, 0xAD, 0x22, 0xFF, 0xAD, 0x22, 0xFF, 0x8D, 0x1A, 0xFF, 0x8D, 0x12, 0xFF, 0xAD, 0x1A, 0xFF, 0x8D, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF, 0xCE, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF, 0xAE, 0x1A, 0xFF, 0xCE, 0x1A, 0xFF, 0x8D, 0x12, 0xFF, 0x8D, 0x12, 0xFF, 0xCE, 0x1A, 0xFF, 0x6D, 0x0A, 0xFF, 0xCE, 0x1A, 0xFF, 0x8D, 0x12, 0xFF, 0x4C, 0x0A, 0xFF, 0xAE, 0x12, 0xFF, 0xEB, 0x01, 0xFF, 0x6D, 0x12, 0xFF, 0x2C, 0x0A, 0xFF, 0x2C, 0x0A, 0xFF, 0x2C, 0x0A, 0xFF, 0x6C, 0x12, 0xFF, 0x2C, 0x0A, 0xFF, 0x4B, 0x12, 0xFF, 0x2B, 0x0A, 0xFF, 0x4B, 0x12, 0xFF, 0x6C, 0x12, 0xFF, 0x8C, 0x12, 0xFF, 0x8D, 0x12, 0xFF, 0xAD, 0x12, 0xFF, 0xCD, 0x12, 0xFF, 0xEE, 0x12, 0xFF, 0x2F, 0x1B, 0xFF, 0x4F, 0x1B, 0xFF, 0x4F, 0x13, 0xFF, 0x70, 0x1B, 0xFF, 0x0E, 0x1B, 0xFF,
-    0xCC, 0x5A, 0xFF, 0xA7, 0x39, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0x0D, 0x5B, 0xFF, 0x6A, 0x42, 0xFF, 0xAC, 0x5A, 0xFF, 0xCB, 0x5A, 0xFF, 0xEC, 0x52, 0xFF, 0x4A, 0x42, 0xFF, 0xE9, 0x39, 0xFF, 0x6B, 0x5A, 0xFF, 0x8E, 0x73, 0xFF, 0xED, 0x62, 0xFF, 0xEA, 0x72, 0xFF, 0x8D, 0x8B, 0xFF, 0xF1, 0x93, 0xFF, 0xAC, 0xBA, 0xFF, 0xFE, 0xFF, 0xFF, 0x0D, 0xA3, 0xFF, 0x4E, 0x7B, 0xFF, 0xCC, 0xC4, 0xFF, 0x2E, 0x5B, 0xFF, 0xED, 0x52, 0xFF, 0x8F, 0x63, 0xFF, 0x78, 0xFF, 0xFF, 0x32, 0x74, 0xFF, 0x90, 0xA3, 0xFF, 0xF1, 0xAB, 0xFF, 0xAC, 0x62, 0xFF, 0x90, 0xDD, 0xFF, 0x32, 0xA4, 0xFF, 0xCD, 0x3A, 0xFF, 0x8C, 0x3A, 0xFF, 0xF0, 0x93, 0xFF, 0x0E, 0x3B, 0xFF, 0x8C, 0x2A, 0xFF, 0xEE, 0x3A, 0xFF, 0x0E, 0x2B, 0xFF, 0x6C, 0x1A, 0xFF, 0xEE, 0x22, 0xFF, 0x0F, 0x23, 0xFF, 0x90, 0x53, 0xFF, 0x6C, 0x12, 0xFF, 0xEE, 0x1A, 0xFF, 0x8D, 0x1A, 0xFF, 0x8D, 0x12, 0xFF, 0x13, 0x44, 0xFF, 0xAE, 0x12, 0xFF, 0x50, 0x2B, 0xFF, 0xEE, 0x22, 0xFF, 0xCE, 0x12, 0xFF, 0xEF, 0x1A, 0xFF, 0xAD, 0x12, 0xFF, 0xCE, 0x1A, 0xFF, 0x2B, 0x0A, 0xFF, 0x2B, 0x02, 0xFF, 0xAD, 0x1A, 0xFF, 0x4C, 0x0A, 0xFF, 0x8D, 0x1A, 0xFF, 0x8D, 0x12, 0xFF,
-    0x4C, 0x0A, 0xFF, 0x4B, 0x12, 0xFF, 0x2B, 0x0A, 0xFF, 0x0B, 0x0A, 0xFF, 0x4C, 0x12, 0xFF, 0x4B, 0x12, 0xFF, 0x6B, 0x0A, 0xFF, 0xCE, 0x1A, 0xFF, 0x4B, 0x0A, 0xFF, 0xCD, 0x12, 0xFF, 0xCD, 0x12, 0xFF, 0xED, 0x12, 0xFF, 0xAD, 0x12, 0xFF, 0x0E, 0x13, 0xFF, 0x70, 0x13, 0xFF, 0x50, 0x1B, 0xFF, 0x05, 0x21, 0xFF, 0xD1, 0x5B, 0xFF, 0xC8, 0x39, 0xFF, 0x2E, 0x4B, 0xFF, 0xE8, 0x39, 0xFF, 0x87, 0x31, 0xFF, 0x0F, 0x43, 0xFF, 0x29, 0x42, 0xFF, 0x2E, 0x4B, 0xFF, 0xE8, 0x39, 0xFF, 0xD0, 0x6B, 0xFF, 0x6F, 0x4B, 0xFF, 0xB1, 0x53, 0xFF, 0xF1, 0x5B, 0xFF, 0x4B, 0x42, 0xFF, 0x70, 0x53, 0xFF, 0x08, 0x3A, 0xFF, 0x2F, 0x43, 0xFF, 0x2A, 0x3A, 0xFF, 0x52, 0x6C, 0xFF, 0x90, 0x63, 0xFF, 0xB0, 0x6B, 0xFF, 0x0A, 0x42, 0xFF, 0xB4, 0x64, 0xFF, 0xD0, 0x4B, 0xFF, 0xF1, 0x5B, 0xFF, 0x4A, 0x32, 0xFF, 0x8B, 0x3A, 0xFF, 0xB4, 0x33, 0xFF, 0xD1, 0x43, 0xFF, 0xAD, 0x42, 0xFF, 0x54, 0x74, 0xFF, 0xAB, 0x42, 0xFF, 0xAD, 0x32, 0xFF, 0x73, 0x3C, 0xFF, 0x90, 0x3B, 0xFF, 0xAC, 0x32, 0xFF, 0x6B, 0x2A, 0xFF, 0x6B, 0x2A, 0xFF, 0x16, 0x4D, 0xFF, 0x6C, 0x1A, 0xFF, 0xAD, 0x22, 0xFF, 0x8C, 0x1A, 0xFF, 0x70, 0x2B, 0xFF, 0x13, 0x1C, 0xFF, 0x6F, 0x33, 0xFF, 0x8D, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF,
-    0xCD, 0x12, 0xFF, 0x57, 0x2D, 0xFF, 0x70, 0x2B, 0xFF, 0x8D, 0x1A, 0xFF, 0xEE, 0x12, 0xFF, 0xD5, 0x24, 0xFF, 0x95, 0x14, 0xFF, 0x6C, 0x0A, 0xFF, 0x33, 0x34, 0xFF, 0x75, 0x24, 0xFF, 0x17, 0x2D, 0xFF, 0x13, 0x24, 0xFF, 0x4C, 0x02, 0xFF, 0x95, 0x24, 0xFF, 0x14, 0x24, 0xFF, 0x13, 0x14, 0xFF, 0x91, 0x0B, 0xFF, 0x4D, 0x02, 0xFF, 0xD1, 0x1B, 0xFF, 0x91, 0x23, 0xFF, 0x2F, 0x1B, 0xFF, 0x6C, 0x0A, 0xFF, 0xAD, 0x12, 0xFF, 0x4C, 0x02, 0xFF, 0xAD, 0x02, 0xFF, 0x0E, 0x1B, 0xFF, 0x70, 0x1B, 0xFF, 0x6C, 0x02, 0xFF, 0xEA, 0x01, 0xFF, 0x4F, 0x1B, 0xFF, 0x50, 0x13, 0xFF, 0x50, 0x13, 0xFF, 0x45, 0x29, 0xFF, 0xC7, 0x41, 0xFF, 0x65, 0x39, 0xFF, 0x27, 0xF4, 0xFF, 0xA7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0x29, 0x4A, 0xFF, 0xE7, 0x41, 0xFF, 0xC7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0x09, 0x3A, 0xFF, 0xC8, 0x39, 0xFF, 0x09, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0x09, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0xE9, 0x41, 0xFF, 0x09, 0x42, 0xFF, 0x4A, 0x52, 0xFF, 0xAB, 0x5A, 0xFF, 0x6A, 0x42, 0xFF, 0x4A, 0x3A, 0xFF, 0x8B, 0x42, 0xFF, 0x6B, 0x42, 0xFF, 0x6A, 0x52, 0xFF, 0x4A, 0x4A, 0xFF, 0x4F, 0x9C, 0xFF,
-    0x4A, 0x32, 0xFF, 0x4B, 0x32, 0xFF, 0x6B, 0x32, 0xFF, 0xED, 0x42, 0xFF, 0x8B, 0x32, 0xFF, 0x8C, 0x3A, 0xFF, 0xAC, 0x32, 0xFF, 0x2B, 0x22, 0xFF, 0x8B, 0x2A, 0xFF, 0x6B, 0x22, 0xFF, 0x6C, 0x22, 0xFF, 0x8C, 0x22, 0xFF, 0xB7, 0x24, 0xFF, 0x8C, 0x2A, 0xFF, 0x6C, 0x1A, 0xFF, 0x8C, 0x1A, 0xFF, 0x6C, 0x1A, 0xFF, 0x74, 0x34, 0xFF, 0xCD, 0x22, 0xFF, 0x6C, 0x1A, 0xFF, 0x8C, 0x1A, 0xFF, 0x8C, 0x1A, 0xFF, 0x2C, 0x12, 0xFF, 0xD7, 0x1C, 0xFF, 0x2B, 0x0A, 0xFF, 0x4B, 0x12, 0xFF, 0x4B, 0x12, 0xFF, 0x8C, 0x1A, 0xFF, 0xD2, 0x1B, 0xFF, 0xD7, 0x24, 0xFF, 0x0B, 0x0A, 0xFF, 0x68, 0x01, 0xFF, 0x4C, 0x1A, 0xFF, 0x96, 0x1C, 0xFF, 0x95, 0x24, 0xFF, 0xAE, 0x02, 0xFF, 0x2B, 0x12, 0xFF, 0xEA, 0x01, 0xFF, 0xD6, 0x2C, 0xFF, 0x4B, 0x0A, 0xFF, 0x34, 0x1C, 0xFF, 0x57, 0x2D, 0xFF, 0xEE, 0x1A, 0xFF, 0xC9, 0x01, 0xFF, 0x8C, 0x0A, 0xFF, 0x12, 0x24, 0xFF, 0x13, 0x14, 0xFF, 0x70, 0x1B, 0xFF, 0x45, 0x29, 0xFF, 0xC7, 0x41, 0xFF, 0x09, 0x52, 0xFF, 0xC7, 0x41, 0xFF, 0xE7, 0x41, 0xFF, 0xE8, 0x49, 0xFF, 0x86, 0x41, 0xFF, 0x08, 0x42, 0xFF, 0x15, 0xF7, 0xFF, 0xCB, 0x62, 0xFF, 0x08, 0x4A, 0xFF, 0x29, 0x4A, 0xFF, 0x08, 0x4A, 0xFF, 0xC7, 0x41, 0xFF, 0x8B, 0x5A, 0xFF, 0x08, 0x42, 0xFF,
-    0x29, 0x4A, 0xFF, 0xEB, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x52, 0xFF, 0x87, 0x41, 0xFF, 0x8B, 0x62, 0xFF, 0x6B, 0xFC, 0xFF, 0x6A, 0x5A, 0xFF, 0x8B, 0x4A, 0xFF, 0x0C, 0x63, 0xFF, 0x8B, 0x4A, 0xFF, 0x8B, 0x4A, 0xFF, 0xAB, 0x5A, 0xFF, 0x69, 0x6A, 0xFF, 0xAA, 0x72, 0xFF, 0x0D, 0x73, 0xFF, 0x09, 0x3A, 0xFF, 0x0D, 0x53, 0xFF, 0xCC, 0x4A, 0xFF, 0x0D, 0x4B, 0xFF, 0x8B, 0x3A, 0xFF, 0x6A, 0x32, 0xFF, 0x4A, 0x2A, 0xFF, 0x4B, 0x2A, 0xFF, 0x4B, 0x2A, 0xFF, 0x8B, 0x32, 0xFF, 0x2B, 0x1A, 0xFF, 0xAC, 0x2A, 0xFF, 0x2D, 0x4B, 0xFF, 0x8C, 0x2A, 0xFF, 0x8C, 0x22, 0xFF, 0xCD, 0x2A, 0xFF, 0x6C, 0x1A, 0xFF, 0x6C, 0x1A, 0xFF, 0x6C, 0x1A, 0xFF, 0x6C, 0x1A, 0xFF, 0x6C, 0x1A, 0xFF, 0x8C, 0x1A, 0xFF, 0x6C, 0x12, 0xFF, 0x2B, 0x0A, 0xFF, 0xAD, 0x22, 0xFF, 0x0A, 0x0A, 0xFF, 0x2B, 0x12, 0xFF, 0x6B, 0x12, 0xFF, 0x4B, 0x12, 0xFF, 0x6C, 0x1A, 0xFF, 0x0A, 0x0A, 0xFF, 0x2B, 0x1A, 0xFF, 0xEA, 0x11, 0xFF, 0x2B, 0x12, 0xFF, 0x6C, 0x1A, 0xFF, 0x2B, 0x12, 0xFF, 0x2A, 0x12, 0xFF, 0x6B, 0x12, 0xFF, 0x4B, 0x12, 0xFF, 0x6B, 0x1A, 0xFF, 0x8C, 0x1A, 0xFF, 0xAC, 0x1A, 0xFF, 0xE9, 0x01, 0xFF, 0xCD, 0x1A, 0xFF, 0x2E, 0x23, 0xFF, 0xCD, 0x12, 0xFF, 0x0E, 0x13, 0xFF, 0xEE, 0x12, 0xFF,
-    0x87, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x08, 0x4A, 0xFF, 0xE8, 0x41, 0xFF, 0x08, 0x4A, 0xFF, 0xC8, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xC7, 0x31, 0xFF, 0x29, 0x4A, 0xFF, 0xCB, 0x5A, 0xFF, 0xAB, 0x5A, 0xFF, 0xCB, 0x5A, 0xFF, 0x09, 0x42, 0xFF, 0xCB, 0x5A, 0xFF, 0xEC, 0x62, 0xFF, 0xC7, 0x39, 0xFF, 0xAB, 0x5A, 0xFF, 0x48, 0x62, 0xFF, 0xE7, 0x51, 0xFF, 0x49, 0x4A, 0xFF, 0x6E, 0x73, 0xFF, 0x4D, 0x6B, 0xFF, 0xAB, 0x52, 0xFF, 0xE8, 0x39, 0xFF, 0xD0, 0x7B, 0xFF, 0x6F, 0x6B, 0xFF, 0x29, 0x3A, 0xFF, 0x6A, 0x42, 0xFF, 0xEC, 0x62, 0xFF, 0x8E, 0x8B, 0xFF, 0xEB, 0x62, 0xFF, 0xCB, 0x5A, 0xFF, 0x29, 0x5A, 0xFF, 0xFC, 0xFF, 0xFF, 0x4A, 0x3A, 0xFF, 0x6E, 0x5B, 0xFF, 0xB4, 0x84, 0xFF, 0xB0, 0x63, 0xFF, 0x8B, 0x32, 0xFF, 0xE9, 0x21, 0xFF, 0x53, 0x64, 0xFF, 0x2E, 0x43, 0xFF, 0x4B, 0x2A, 0xFF, 0xAD, 0x2A, 0xFF, 0xAD, 0x2A, 0xFF, 0x6B, 0x2A, 0xFF, 0x4B, 0x22, 0xFF, 0xAD, 0x22, 0xFF, 0xAD, 0x22, 0xFF, 0x4B, 0x1A, 0xFF, 0x8C, 0x22, 0xFF, 0x70, 0x2B, 0xFF, 0xAD, 0x22, 0xFF, 0x2B, 0x12, 0xFF, 0xCD, 0x22, 0xFF, 0x2F, 0x1B, 0xFF, 0x6C, 0x1A, 0xFF, 0x4B, 0x1A, 0xFF, 0x4F, 0x23, 0xFF, 0xC9, 0x01, 0xFF, 0x2B, 0x12, 0xFF, 0x8C, 0x1A, 0xFF, 0xED, 0x1A, 0xFF, 0x0A, 0x12, 0xFF,
-    0xE9, 0x09, 0xFF, 0x4B, 0x12, 0xFF, 0x2B, 0x12, 0xFF, 0x0A, 0x12, 0xFF, 0x0A, 0x12, 0xFF, 0xAC, 0x1A, 0xFF, 0x0E, 0x23, 0xFF, 0x4B, 0x12, 0xFF, 0xAC, 0x1A, 0xFF, 0x8C, 0x12, 0xFF, 0x4B, 0x0A, 0xFF, 0xCC, 0x1A, 0xFF, 0x2E, 0x1B, 0xFF, 0x2E, 0x1B, 0xFF, 0x4F, 0x1B, 0xFF, 0x2F, 0x1B, 0xFF, 0xC7, 0x41, 0xFF, 0xAC, 0x52, 0xFF, 0x26, 0x52, 0xFF, 0x8A, 0x4A, 0xFF, 0xC6, 0x49, 0xFF, 0x29, 0x4A, 0xFF, 0x4E, 0x5B, 0xFF, 0xC8, 0x31, 0xFF, 0x4A, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0xC7, 0x41, 0xFF, 0x4E, 0x5B, 0xFF, 0x08, 0x42, 0xFF, 0x6E, 0x6B, 0xFF, 0x29, 0x42, 0xFF, 0xC7, 0x41, 0xFF, 0xAF, 0x73, 0xFF, 0xCF, 0x73, 0xFF, 0x6A, 0x4A, 0xFF, 0xE7, 0x49, 0xFF, 0x2D, 0x6B, 0xFF, 0xF1, 0x73, 0xFF, 0xE8, 0x49, 0xFF, 0x6A, 0x4A, 0xFF, 0x4A, 0x42, 0xFF, 0xB2, 0x8C, 0xFF, 0x6E, 0x6B, 0xFF, 0x29, 0x4A, 0xFF, 0x29, 0x52, 0xFF, 0xF0, 0xCC, 0xFF, 0xF6, 0xFF, 0xFF, 0xE8, 0x41, 0xFF, 0x6A, 0x42, 0xFF, 0xAB, 0x4A, 0xFF, 0x76, 0x95, 0xFF, 0x52, 0x74, 0xFF, 0x6A, 0x3A, 0xFF, 0xCC, 0x4A, 0xFF, 0x09, 0x2A, 0xFF, 0x2E, 0x43, 0xFF, 0x6B, 0x3A, 0xFF, 0x4B, 0x2A, 0xFF, 0x2E, 0x3B, 0xFF, 0x91, 0x33, 0xFF, 0xAC, 0x2A, 0xFF, 0x4B, 0x22, 0xFF, 0x6B, 0x22, 0xFF,
-    0x54, 0x4C, 0xFF, 0x6C, 0x22, 0xFF, 0x4B, 0x1A, 0xFF, 0x4B, 0x22, 0xFF, 0xD1, 0x33, 0xFF, 0x4C, 0x1A, 0xFF, 0x0B, 0x12, 0xFF, 0x0A, 0x12, 0xFF, 0x4F, 0x2B, 0xFF, 0x6C, 0x02, 0xFF, 0x4B, 0x1A, 0xFF, 0x09, 0x12, 0xFF, 0xF2, 0x33, 0xFF, 0x13, 0x24, 0xFF, 0xC9, 0x09, 0xFF, 0x8C, 0x22, 0xFF, 0x0E, 0x13, 0xFF, 0xCE, 0x12, 0xFF, 0xEA, 0x09, 0xFF, 0x6B, 0x1A, 0xFF, 0x4F, 0x1B, 0xFF, 0x2B, 0x0A, 0xFF, 0x6B, 0x1A, 0xFF, 0xAC, 0x22, 0xFF, 0xAC, 0x1A, 0xFF, 0x4B, 0x12, 0xFF, 0x0E, 0x23, 0xFF, 0xCC, 0x12, 0xFF, 0x6F, 0x1B, 0xFF, 0x6F, 0x23, 0xFF, 0x90, 0x23, 0xFF, 0x70, 0x1B, 0xFF, 0xA6, 0x31, 0xFF, 0xEC, 0x5A, 0xFF, 0xE7, 0x49, 0xFF, 0x0D, 0x53, 0xFF, 0x0C, 0x6B, 0xFF, 0x28, 0x4A, 0xFF, 0xC7, 0x41, 0xFF, 0x08, 0x42, 0xFF, 0xA7, 0x29, 0xFF, 0x0C, 0x5B, 0xFF, 0xE7, 0x41, 0xFF, 0x29, 0x4A, 0xFF, 0x6A, 0x42, 0xFF, 0xD0, 0x63, 0xFF, 0xAF, 0x73, 0xFF, 0x8A, 0x52, 0xFF, 0x29, 0x4A, 0xFF, 0xE8, 0x41, 0xFF, 0xA7, 0x31, 0xFF, 0x92, 0x94, 0xFF, 0xC7, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0x6A, 0x52, 0xFF, 0x09, 0x3A, 0xFF, 0x10, 0x6C, 0xFF, 0x08, 0x42, 0xFF, 0x09, 0x4A, 0xFF, 0x4A, 0x42, 0xFF, 0x6A, 0x4A, 0xFF, 0xD0, 0x63, 0xFF, 0xCC, 0x62, 0xFF, 0x69, 0x52, 0xFF,
-    0x29, 0x42, 0xFF, 0x6A, 0x4A, 0xFF, 0xB0, 0x43, 0xFF, 0xAB, 0x42, 0xFF, 0x4A, 0x42, 0xFF, 0x29, 0x42, 0xFF, 0xCC, 0x4A, 0xFF, 0xB4, 0x5C, 0xFF, 0xCC, 0x42, 0xFF, 0xAB, 0x7A, 0xFF, 0x2A, 0x2A, 0xFF, 0x4B, 0x2A, 0xFF, 0x34, 0x34, 0xFF, 0xCC, 0x32, 0xFF, 0x4B, 0x22, 0xFF, 0x0A, 0x1A, 0xFF, 0xEA, 0x19, 0xFF, 0xD5, 0x34, 0xFF, 0x8C, 0x22, 0xFF, 0xE9, 0x11, 0xFF, 0x0A, 0x1A, 0xFF, 0x2F, 0x0B, 0xFF, 0xF2, 0x33, 0xFF, 0x0A, 0x12, 0xFF, 0x8C, 0x2A, 0xFF, 0x0A, 0x1A, 0xFF, 0x91, 0x23, 0xFF, 0x4F, 0x2B, 0xFF, 0xC9, 0x09, 0xFF, 0x4B, 0x1A, 0xFF, 0x0A, 0x0A, 0xFF, 0x34, 0x1C, 0xFF, 0x0A, 0x02, 0xFF, 0xEA, 0x11, 0xFF, 0x2A, 0x1A, 0xFF, 0xF2, 0x23, 0xFF, 0xC9, 0x01, 0xFF, 0x2A, 0x12, 0xFF, 0x2B, 0x12, 0xFF, 0xD1, 0x2B, 0xFF, 0xF3, 0x23, 0xFF, 0x8B, 0x1A, 0xFF, 0xED, 0x1A, 0xFF, 0x0E, 0x23, 0xFF, 0x2E, 0x1B, 0xFF, 0x70, 0x23, 0xFF, 0x90, 0x1B, 0xFF, 0x4F, 0x23, 0xFF, 0x08, 0x4A, 0xFF, 0xA6, 0x41, 0xFF, 0xE7, 0x49, 0xFF, 0xE8, 0x51, 0xFF, 0xE8, 0x49, 0xFF, 0x28, 0x52, 0xFF, 0x4A, 0x4A, 0xFF, 0xC7, 0x41, 0xFF, 0x24, 0x29, 0xFF, 0x08, 0x4A, 0xFF, 0xCB, 0x5A, 0xFF, 0xC7, 0x41, 0xFF, 0xE7, 0x41, 0xFF, 0x4D, 0x73, 0xFF, 0xC7, 0x41, 0xFF, 0x49, 0x52, 0xFF,
-    0xAB, 0x62, 0xFF, 0x6A, 0x4A, 0xFF, 0x8A, 0x62, 0xFF, 0xE8, 0x49, 0xFF, 0xA6, 0x39, 0xFF, 0xEA, 0x62, 0xFF, 0x6A, 0x5A, 0xFF, 0xCC, 0xFA, 0xFF, 0xE8, 0x41, 0xFF, 0x69, 0x52, 0xFF, 0xCC, 0x5A, 0xFF, 0x8A, 0x5A, 0xFF, 0xF3, 0x9C, 0xFF, 0x08, 0x4A, 0xFF, 0x8A, 0x5A, 0xFF, 0x29, 0x6A, 0xFF, 0x08, 0x52, 0xFF, 0x73, 0x6C, 0xFF, 0xF0, 0x8B, 0xFF, 0x4D, 0x6B, 0xFF, 0x09, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x63, 0xFF, 0xB0, 0x63, 0xFF, 0xAB, 0x4A, 0xFF, 0x8C, 0x52, 0xFF, 0x0A, 0x22, 0xFF, 0xC9, 0x21, 0xFF, 0x54, 0x34, 0xFF, 0x4E, 0x4B, 0xFF, 0x4B, 0x32, 0xFF, 0xCD, 0x3A, 0xFF, 0xAC, 0x22, 0xFF, 0x54, 0x2C, 0xFF, 0x0A, 0x22, 0xFF, 0xE9, 0x11, 0xFF, 0xA9, 0x11, 0xFF, 0x2A, 0x1A, 0xFF, 0xF7, 0x44, 0xFF, 0x14, 0x1C, 0xFF, 0xAC, 0x32, 0xFF, 0x2A, 0x1A, 0xFF, 0x6B, 0x22, 0xFF, 0x50, 0x23, 0xFF, 0xD6, 0x34, 0xFF, 0xAC, 0x22, 0xFF, 0x0A, 0x1A, 0xFF, 0xE9, 0x11, 0xFF, 0x2A, 0x12, 0xFF, 0x75, 0x24, 0xFF, 0x33, 0x2C, 0xFF, 0xC9, 0x11, 0xFF, 0x4B, 0x22, 0xFF, 0x4B, 0x12, 0xFF, 0x33, 0x24, 0xFF, 0x4B, 0x1A, 0xFF, 0xAD, 0x1A, 0xFF, 0x8C, 0x22, 0xFF, 0x4F, 0x2B, 0xFF, 0x33, 0x24, 0xFF, 0xF2, 0x2B, 0xFF, 0xED, 0x1A, 0xFF, 0x4F, 0x23, 0xFF, 0x0E, 0x1B, 0xFF,
-    0xC7, 0x49, 0xFF, 0xE7, 0x49, 0xFF, 0xC7, 0x59, 0xFF, 0x48, 0xFB, 0xFF, 0xE8, 0x51, 0xFF, 0x86, 0x41, 0xFF, 0x48, 0x5A, 0xFF, 0x28, 0x52, 0xFF, 0x86, 0x39, 0xFF, 0x08, 0x4A, 0xFF, 0x69, 0x52, 0xFF, 0x28, 0x4A, 0xFF, 0xE7, 0x41, 0xFF, 0xCB, 0x62, 0xFF, 0x46, 0x5A, 0xFF, 0x88, 0x72, 0xFF, 0xE8, 0x51, 0xFF, 0xC7, 0x49, 0xFF, 0x89, 0x93, 0xFF, 0x86, 0x49, 0xFF, 0x4D, 0x6B, 0xFF, 0x69, 0x52, 0xFF, 0x07, 0x4A, 0xFF, 0x08, 0x52, 0xFF, 0x2D, 0x6B, 0xFF, 0x29, 0x52, 0xFF, 0xE8, 0x49, 0xFF, 0xEB, 0x6A, 0xFF, 0x0C, 0x6B, 0xFF, 0xE8, 0x71, 0xFF, 0x23, 0xBB, 0xFF, 0x68, 0x82, 0xFF, 0xEA, 0xCC, 0xFF, 0x0E, 0xB4, 0xFF, 0x49, 0x52, 0xFF, 0xAB, 0x52, 0xFF, 0x8F, 0x7B, 0xFF, 0x08, 0x42, 0xFF, 0x69, 0x5A, 0xFF, 0x8B, 0x42, 0xFF, 0xF1, 0x7B, 0xFF, 0x4A, 0x32, 0xFF, 0x2A, 0x2A, 0xFF, 0xC8, 0x19, 0xFF, 0xCD, 0x42, 0xFF, 0xF0, 0xAB, 0xFF, 0x2A, 0x2A, 0xFF, 0x0A, 0x22, 0xFF, 0x6B, 0x22, 0xFF, 0x09, 0x1A, 0xFF, 0xE9, 0x19, 0xFF, 0x4B, 0x1A, 0xFF, 0x67, 0x01, 0xFF, 0x2A, 0x22, 0xFF, 0xE9, 0x19, 0xFF, 0x2F, 0x23, 0xFF, 0x6E, 0x4B, 0xFF, 0xE9, 0x19, 0xFF, 0x09, 0x12, 0xFF, 0x6F, 0x33, 0xFF, 0x2A, 0x1A, 0xFF, 0x09, 0x12, 0xFF, 0x0A, 0x12, 0xFF, 0x6B, 0x1A, 0xFF,
-    0xC9, 0x11, 0xFF, 0x09, 0x1A, 0xFF, 0x88, 0x01, 0xFF, 0xC9, 0x11, 0xFF, 0x0A, 0x1A, 0xFF, 0x4B, 0x1A, 0xFF, 0xAC, 0x22, 0xFF, 0xAC, 0x1A, 0xFF, 0x75, 0x2C, 0xFF, 0x8C, 0x22, 0xFF, 0xED, 0x1A, 0xFF, 0xEE, 0x1A, 0xFF, 0x0D, 0x1B, 0xFF, 0x13, 0x2C, 0xFF, 0x33, 0x2C, 0xFF, 0x2F, 0x1B, 0xFF, 0x07, 0x52, 0xFF, 0xC7, 0x49, 0xFF, 0x08, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0xC7, 0x49, 0xFF, 0xA7, 0x39, 0xFF, 0xE8, 0x49, 0xFF, 0xE7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xE6, 0x49, 0xFF, 0x07, 0x42, 0xFF, 0xE7, 0x41, 0xFF, 0x04, 0x31, 0xFF, 0xEC, 0x6A, 0xFF, 0x28, 0x52, 0xFF, 0x69, 0x5A, 0xFF, 0xC6, 0x41, 0xFF, 0x0C, 0x63, 0xFF, 0xC7, 0x49, 0xFF, 0xA6, 0x41, 0xFF, 0x08, 0x52, 0xFF, 0xB8, 0xFF, 0xFF, 0x47, 0x62, 0xFF, 0x28, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0xA9, 0x8A, 0xFF, 0x10, 0xC5, 0xFF, 0xE7, 0x49, 0xFF, 0x49, 0x6A, 0xFF, 0x12, 0xE6, 0xFF, 0xFD, 0xFF, 0xFF, 0xC8, 0x8A, 0xFF, 0x8A, 0x62, 0xFF, 0x49, 0x52, 0xFF, 0xEF, 0x93, 0xFF, 0x8A, 0x5A, 0xFF, 0x29, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0x29, 0x42, 0xFF, 0xB2, 0x9C, 0xFF, 0xE8, 0x31, 0xFF, 0xC8, 0x19, 0xFF, 0x87, 0x19, 0xFF, 0x53, 0x5C, 0xFF, 0x0C, 0x53, 0xFF, 0xC8, 0x19, 0xFF, 0x2A, 0x22, 0xFF,
-    0x90, 0x33, 0xFF, 0x6B, 0x32, 0xFF, 0x4B, 0x22, 0xFF, 0xA8, 0x11, 0xFF, 0x32, 0x34, 0xFF, 0x09, 0x1A, 0xFF, 0xA8, 0x11, 0xFF, 0x4A, 0x22, 0xFF, 0x4A, 0x1A, 0xFF, 0xCC, 0x2A, 0xFF, 0xA8, 0x09, 0xFF, 0x2A, 0x1A, 0xFF, 0x2F, 0x1B, 0xFF, 0xC8, 0x01, 0xFF, 0xA8, 0x09, 0xFF, 0xA8, 0x09, 0xFF, 0x90, 0x1B, 0xFF, 0x4F, 0x2B, 0xFF, 0x88, 0x09, 0xFF, 0xC9, 0x11, 0xFF, 0x2E, 0x2B, 0xFF, 0xED, 0x1A, 0xFF, 0x8B, 0x22, 0xFF, 0x6B, 0x1A, 0xFF, 0x6B, 0x1A, 0xFF, 0x6B, 0x1A, 0xFF, 0xED, 0x22, 0xFF, 0xAC, 0x12, 0xFF, 0xED, 0x1A, 0xFF, 0x2F, 0x23, 0xFF, 0x0E, 0x1B, 0xFF, 0x0E, 0x1B, 0xFF, 0xE7, 0x49, 0xFF, 0xEC, 0x62, 0xFF, 0x28, 0x52, 0xFF, 0xC7, 0x41, 0xFF, 0xE7, 0x49, 0xFF, 0x86, 0x31, 0xFF, 0xEC, 0x6A, 0xFF, 0x28, 0x4A, 0xFF, 0xE7, 0x41, 0xFF, 0xE7, 0x49, 0xFF, 0xC7, 0x41, 0xFF, 0xAA, 0x5A, 0xFF, 0xEB, 0x62, 0xFF, 0xC7, 0x41, 0xFF, 0x08, 0x42, 0xFF, 0xA7, 0x39, 0xFF, 0x28, 0x52, 0xFF, 0x8A, 0x62, 0xFF, 0xC7, 0x49, 0xFF, 0xA7, 0x41, 0xFF, 0x6D, 0x73, 0xFF, 0x0F, 0x8C, 0xFF, 0x27, 0x6A, 0xFF, 0x06, 0xD3, 0xFF, 0xEB, 0x6A, 0xFF, 0xD2, 0x9C, 0xFF, 0xEF, 0x83, 0xFF, 0xAA, 0x5A, 0xFF, 0xE7, 0x41, 0xFF, 0x08, 0x4A, 0xFF, 0xB0, 0xD4, 0xFF, 0x29, 0x7B, 0xFF,
-    0x89, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0xEF, 0xAB, 0xFF, 0xAF, 0x73, 0xFF, 0xE7, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x61, 0xFF, 0xF0, 0x83, 0xFF, 0x4A, 0x3A, 0xFF, 0x2A, 0x42, 0xFF, 0xA7, 0x19, 0xFF, 0x09, 0x22, 0xFF, 0x50, 0x3B, 0xFF, 0xCC, 0x52, 0xFF, 0xC9, 0x21, 0xFF, 0xCC, 0x3A, 0xFF, 0xED, 0x3A, 0xFF, 0x4E, 0x3B, 0xFF, 0x2A, 0x22, 0xFF, 0xC9, 0x19, 0xFF, 0xC8, 0x11, 0xFF, 0xD1, 0x1B, 0xFF, 0xD8, 0x65, 0xFF, 0xE9, 0x19, 0xFF, 0x4A, 0x22, 0xFF, 0x33, 0x2C, 0xFF, 0x0A, 0x1A, 0xFF, 0xC9, 0x19, 0xFF, 0x4A, 0x1A, 0xFF, 0xE9, 0x11, 0xFF, 0x4C, 0x0A, 0xFF, 0xA8, 0x09, 0xFF, 0xC8, 0x19, 0xFF, 0xA8, 0x11, 0xFF, 0xB0, 0x2B, 0xFF, 0x09, 0x12, 0xFF, 0x67, 0x01, 0xFF, 0x0A, 0x1A, 0xFF, 0xC9, 0x11, 0xFF, 0x0E, 0x2B, 0xFF, 0x6B, 0x1A, 0xFF, 0xC8, 0x09, 0xFF, 0xAC, 0x1A, 0xFF, 0xCD, 0x1A, 0xFF, 0x0E, 0x13, 0xFF, 0x0E, 0x23, 0xFF, 0x0E, 0x23, 0xFF, 0x4F, 0x23, 0xFF, 0xC6, 0x49, 0xFF, 0x07, 0x52, 0xFF, 0xAE, 0xDB, 0xFF, 0x28, 0x3A, 0xFF, 0xCB, 0x5A, 0xFF, 0xE7, 0x49, 0xFF, 0xE7, 0x49, 0xFF, 0xE7, 0x41, 0xFF, 0x8F, 0x5B, 0xFF, 0x10, 0x84, 0xFF, 0xA6, 0x39, 0xFF, 0xC7, 0x49, 0xFF, 0x08, 0x52, 0xFF, 0xD0, 0x6B, 0xFF, 0x2D, 0x7B, 0xFF, 0x65, 0x41, 0xFF,
-    0x08, 0x52, 0xFF, 0xC6, 0x49, 0xFF, 0x65, 0x41, 0xFF, 0x53, 0xE5, 0xFF, 0x65, 0x41, 0xFF, 0x05, 0xDB, 0xFF, 0x2C, 0x8B, 0xFF, 0x4B, 0x9B, 0xFF, 0xBA, 0xCE, 0xFF, 0x8E, 0x7B, 0xFF, 0xAB, 0x5A, 0xFF, 0x28, 0x4A, 0xFF, 0x08, 0x3A, 0xFF, 0xAF, 0x5B, 0xFF, 0xC7, 0x41, 0xFF, 0x69, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x6E, 0x7B, 0xFF, 0xD1, 0x63, 0xFF, 0x08, 0x3A, 0xFF, 0x8A, 0x62, 0xFF, 0xC7, 0x79, 0xFF, 0x8A, 0x52, 0xFF, 0x32, 0x5C, 0xFF, 0x09, 0x3A, 0xFF, 0x29, 0x3A, 0xFF, 0x67, 0x19, 0xFF, 0x09, 0x2A, 0xFF, 0x94, 0x4C, 0xFF, 0x6A, 0x3A, 0xFF, 0xE8, 0x21, 0xFF, 0x2A, 0x2A, 0xFF, 0xE8, 0x21, 0xFF, 0x70, 0x2B, 0xFF, 0xC8, 0x19, 0xFF, 0x4B, 0x22, 0xFF, 0xE9, 0x19, 0xFF, 0xC8, 0x11, 0xFF, 0x0A, 0x0A, 0xFF, 0x06, 0x01, 0xFF, 0x2A, 0x22, 0xFF, 0xE8, 0x11, 0xFF, 0xEA, 0x09, 0xFF, 0xC9, 0x01, 0xFF, 0xC9, 0x11, 0xFF, 0xC8, 0x11, 0xFF, 0x88, 0x09, 0xFF, 0xD0, 0x33, 0xFF, 0x4B, 0x1A, 0xFF, 0x2A, 0x12, 0xFF, 0x09, 0x1A, 0xFF, 0xAD, 0x22, 0xFF, 0xE9, 0x01, 0xFF, 0x2A, 0x1A, 0xFF, 0x09, 0x12, 0xFF, 0xE9, 0x11, 0xFF, 0xED, 0x1A, 0xFF, 0xCD, 0x22, 0xFF, 0xAC, 0x1A, 0xFF, 0xCD, 0x1A, 0xFF, 0x0D, 0x23, 0xFF, 0x2D, 0x23, 0xFF, 0x2F, 0x1B, 0xFF, 0x2E, 0x1B, 0xFF,
-    0xA6, 0x51, 0xFF, 0x2E, 0x53, 0xFF, 0xC7, 0x49, 0xFF, 0x24, 0x31, 0xFF, 0xA6, 0x49, 0xFF, 0x08, 0x52, 0xFF, 0x8F, 0x5B, 0xFF, 0xCB, 0x5A, 0xFF, 0xE7, 0x49, 0xFF, 0x28, 0x52, 0xFF, 0xC7, 0x41, 0xFF, 0xC7, 0x51, 0xFF, 0xCF, 0x63, 0xFF, 0xE7, 0x51, 0xFF, 0xA6, 0x49, 0xFF, 0xA7, 0xA9, 0xFF, 0xE8, 0x71, 0xFF, 0x4E, 0x53, 0xFF, 0xE8, 0x51, 0xFF, 0x86, 0x41, 0xFF, 0x0C, 0x6B, 0xFF, 0xE7, 0x51, 0xFF, 0x8A, 0x62, 0xFF, 0x8E, 0x6B, 0xFF, 0xA6, 0x39, 0xFF, 0x28, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0x8A, 0x5A, 0xFF, 0xD1, 0x5B, 0xFF, 0x28, 0x4A, 0xFF, 0x28, 0x4A, 0xFF, 0x49, 0x52, 0xFF, 0xC5, 0x71, 0xFF, 0xF2, 0x53, 0xFF, 0xEC, 0x4A, 0xFF, 0x08, 0x42, 0xFF, 0x2E, 0x63, 0xFF, 0xA7, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0x09, 0x3A, 0xFF, 0x29, 0x32, 0xFF, 0x8A, 0x3A, 0xFF, 0x8B, 0x32, 0xFF, 0x6B, 0x2A, 0xFF, 0x33, 0x44, 0xFF, 0x4A, 0x3A, 0xFF, 0xA7, 0x11, 0xFF, 0x6B, 0x2A, 0xFF, 0x2A, 0x22, 0xFF, 0x70, 0x1B, 0xFF, 0x2A, 0x22, 0xFF, 0x2A, 0x22, 0xFF, 0x47, 0x09, 0xFF, 0xE9, 0x19, 0xFF, 0xB5, 0x34, 0xFF, 0x0E, 0x23, 0xFF, 0x29, 0x1A, 0xFF, 0xC8, 0x11, 0xFF, 0xC8, 0x19, 0xFF, 0xD2, 0x2B, 0xFF, 0x2A, 0x22, 0xFF, 0xC9, 0x11, 0xFF, 0xC9, 0x11, 0xFF, 0x0D, 0x2B, 0xFF,
-    0x2E, 0x2B, 0xFF, 0x33, 0x2C, 0xFF, 0xED, 0x22, 0xFF, 0x2A, 0x22, 0xFF, 0xE9, 0x19, 0xFF, 0x4B, 0x1A, 0xFF, 0xCE, 0x22, 0xFF, 0x4B, 0x1A, 0xFF, 0x0A, 0x12, 0xFF, 0x4A, 0x1A, 0xFF, 0xED, 0x22, 0xFF, 0xB1, 0x1B, 0xFF, 0x73, 0x34, 0xFF, 0xED, 0x1A, 0xFF, 0x0E, 0x23, 0xFF, 0xED, 0x1A, 0xFF, 0x28, 0x62, 0xFF, 0xE7, 0x51, 0xFF, 0x08, 0x5A, 0xFF, 0xE7, 0x49, 0xFF, 0xC6, 0x49, 0xFF, 0x89, 0x5A, 0xFF, 0x28, 0x52, 0xFF, 0xA6, 0x41, 0xFF, 0xC7, 0x49, 0xFF, 0x86, 0x31, 0xFF, 0xCB, 0x62, 0xFF, 0x2D, 0x5B, 0xFF, 0x08, 0x52, 0xFF, 0xC7, 0x49, 0xFF, 0xCC, 0x82, 0xFF, 0xA6, 0x69, 0xFF, 0x28, 0x6A, 0xFF, 0x69, 0x62, 0xFF, 0x08, 0x4A, 0xFF, 0xA6, 0x41, 0xFF, 0xC6, 0x41, 0xFF, 0x89, 0x72, 0xFF, 0x87, 0x82, 0xFF, 0xCF, 0x8B, 0xFF, 0xEC, 0xFC, 0xFF, 0xA6, 0x39, 0xFF, 0x28, 0x4A, 0xFF, 0x89, 0x62, 0xFF, 0xC7, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0x28, 0x52, 0xFF, 0x08, 0x52, 0xFF, 0x08, 0x3A, 0xFF, 0xEB, 0x5A, 0xFF, 0x8B, 0x52, 0xFF, 0xC7, 0x39, 0xFF, 0xE8, 0x41, 0xFF, 0xEC, 0x5A, 0xFF, 0xE8, 0x31, 0xFF, 0xC8, 0x31, 0xFF, 0xE8, 0x81, 0xFF, 0xE8, 0x31, 0xFF, 0x87, 0x21, 0xFF, 0xA8, 0x29, 0xFF, 0xB1, 0x4B, 0xFF, 0x4A, 0x32, 0xFF, 0xE9, 0x29, 0xFF, 0xA8, 0x21, 0xFF,
-    0xCD, 0x22, 0xFF, 0x8C, 0x22, 0xFF, 0x4A, 0x2A, 0xFF, 0xE9, 0x21, 0xFF, 0x90, 0x33, 0xFF, 0xC8, 0x11, 0xFF, 0x4A, 0x22, 0xFF, 0xD6, 0x34, 0xFF, 0x2E, 0x2B, 0xFF, 0xA8, 0x09, 0xFF, 0x29, 0x22, 0xFF, 0x66, 0x09, 0xFF, 0x32, 0x34, 0xFF, 0xC9, 0x11, 0xFF, 0x09, 0x22, 0xFF, 0x09, 0x22, 0xFF, 0x6F, 0x23, 0xFF, 0x87, 0x09, 0xFF, 0xF3, 0x2B, 0xFF, 0x94, 0x5C, 0xFF, 0x8C, 0x12, 0xFF, 0xE9, 0x11, 0xFF, 0xC8, 0x11, 0xFF, 0xB1, 0x2B, 0xFF, 0xD2, 0x23, 0xFF, 0x8C, 0x1A, 0xFF, 0x6B, 0x1A, 0xFF, 0xAC, 0x1A, 0xFF, 0xAC, 0x1A, 0xFF, 0x32, 0x24, 0xFF, 0x76, 0x4D, 0xFF, 0x0E, 0x23, 0xFF, 0x28, 0x62, 0xFF, 0x07, 0x5A, 0xFF, 0x28, 0x62, 0xFF, 0x8A, 0x52, 0xFF, 0xE7, 0x51, 0xFF, 0x85, 0x81, 0xFF, 0xE7, 0x51, 0xFF, 0xC6, 0x49, 0xFF, 0x0C, 0x6B, 0xFF, 0xE7, 0x49, 0xFF, 0xC6, 0x41, 0xFF, 0x8E, 0x7B, 0xFF, 0x2C, 0x73, 0xFF, 0x65, 0x41, 0xFF, 0xC7, 0x49, 0xFF, 0xA6, 0x49, 0xFF, 0x0B, 0x6B, 0xFF, 0x2C, 0x63, 0xFF, 0x45, 0x31, 0xFF, 0xCB, 0x6A, 0xFF, 0xE6, 0x59, 0xFF, 0x6B, 0xAB, 0xFF, 0x08, 0x83, 0xFF, 0xF8, 0xFF, 0xFF, 0xEB, 0x6A, 0xFF, 0x65, 0x31, 0xFF, 0x91, 0x9C, 0xFF, 0x0B, 0x6B, 0xFF, 0x69, 0x52, 0xFF, 0x69, 0x4A, 0xFF, 0xEB, 0xE2, 0xFF, 0xEC, 0x62, 0xFF,
-    0xE7, 0x41, 0xFF, 0x8A, 0x52, 0xFF, 0xA7, 0x41, 0xFF, 0xE8, 0x31, 0xFF, 0x08, 0x42, 0xFF, 0x4D, 0x73, 0xFF, 0x29, 0x42, 0xFF, 0xE8, 0x39, 0xFF, 0x29, 0x3A, 0xFF, 0xC8, 0x31, 0xFF, 0xE8, 0x29, 0xFF, 0x66, 0x19, 0xFF, 0x52, 0x64, 0xFF, 0x6A, 0x3A, 0xFF, 0xA8, 0x21, 0xFF, 0xC8, 0x21, 0xFF, 0x32, 0x3C, 0xFF, 0xA8, 0x19, 0xFF, 0x29, 0x2A, 0xFF, 0xC8, 0x21, 0xFF, 0xA8, 0x19, 0xFF, 0xE9, 0x21, 0xFF, 0x6F, 0x43, 0xFF, 0x8F, 0x43, 0xFF, 0xC8, 0x19, 0xFF, 0xD1, 0x2B, 0xFF, 0xA8, 0x11, 0xFF, 0x4B, 0x2A, 0xFF, 0xD0, 0x43, 0xFF, 0xAC, 0x2A, 0xFF, 0x09, 0x1A, 0xFF, 0x09, 0x22, 0xFF, 0x6B, 0x22, 0xFF, 0x4F, 0x33, 0xFF, 0x6F, 0x2B, 0xFF, 0xC8, 0x19, 0xFF, 0x2A, 0x22, 0xFF, 0x88, 0x09, 0xFF, 0xD1, 0x3B, 0xFF, 0x09, 0x1A, 0xFF, 0x29, 0x12, 0xFF, 0x29, 0x12, 0xFF, 0x8C, 0x22, 0xFF, 0xCC, 0x22, 0xFF, 0x09, 0x12, 0xFF, 0xAC, 0x1A, 0xFF, 0x6B, 0x1A, 0xFF, 0x0D, 0x1B, 0xFF, 0x07, 0x62, 0xFF, 0x8A, 0x52, 0xFF, 0xE7, 0xA1, 0xFF, 0x28, 0x5A, 0xFF, 0x07, 0x5A, 0xFF, 0x48, 0x5A, 0xFF, 0x6D, 0x63, 0xFF, 0xC6, 0x49, 0xFF, 0xE7, 0x51, 0xFF, 0x07, 0x4A, 0xFF, 0x6E, 0x63, 0xFF, 0x89, 0x5A, 0xFF, 0x08, 0x4A, 0xFF, 0xA6, 0x49, 0xFF, 0x6C, 0xFE, 0xFF, 0x08, 0x3A, 0xFF,
-    0x8A, 0x62, 0xFF, 0x86, 0x41, 0xFF, 0xC6, 0x41, 0xFF, 0x2C, 0x5B, 0xFF, 0x4D, 0x63, 0xFF, 0x69, 0x5A, 0xFF, 0x49, 0x62, 0xFF, 0x07, 0x4A, 0xFF, 0xC7, 0x41, 0xFF, 0xEF, 0x7B, 0xFF, 0x86, 0x49, 0xFF, 0x08, 0x4A, 0xFF, 0x07, 0xB3, 0xFF, 0x4D, 0x7B, 0xFF, 0x8A, 0x5A, 0xFF, 0xA6, 0x39, 0xFF, 0x27, 0x4A, 0xFF, 0x6A, 0x52, 0xFF, 0xB5, 0xED, 0xFF, 0x08, 0x52, 0xFF, 0xCB, 0x6A, 0xFF, 0xCB, 0x5A, 0xFF, 0x08, 0x3A, 0xFF, 0x93, 0x6C, 0xFF, 0x29, 0x42, 0xFF, 0xA7, 0x29, 0xFF, 0xA8, 0x29, 0xFF, 0x46, 0x19, 0xFF, 0xF1, 0x53, 0xFF, 0x6A, 0x42, 0xFF, 0x87, 0x19, 0xFF, 0xC8, 0x21, 0xFF, 0x06, 0x11, 0xFF, 0xC8, 0x19, 0xFF, 0x09, 0x22, 0xFF, 0x8B, 0x22, 0xFF, 0x46, 0x09, 0xFF, 0x12, 0x2C, 0xFF, 0x4A, 0x2A, 0xFF, 0x2A, 0x1A, 0xFF, 0xE8, 0x19, 0xFF, 0xE9, 0x21, 0xFF, 0xCC, 0x1A, 0xFF, 0xA8, 0x09, 0xFF, 0xE5, 0x00, 0xFF, 0xE8, 0x11, 0xFF, 0xA8, 0x01, 0xFF, 0x67, 0x09, 0xFF, 0x09, 0x22, 0xFF, 0xE8, 0x11, 0xFF, 0xC8, 0x11, 0xFF, 0x66, 0x09, 0xFF, 0xED, 0x22, 0xFF, 0x87, 0x09, 0xFF, 0x4A, 0x22, 0xFF, 0xE9, 0x11, 0xFF, 0x4A, 0x1A, 0xFF, 0x2A, 0x1A, 0xFF, 0x2A, 0x12, 0xFF, 0x8B, 0x1A, 0xFF, 0x2A, 0x12, 0xFF, 0xED, 0x22, 0xFF, 0x0A, 0x12, 0xFF, 0xCD, 0x22, 0xFF,
-    0x07, 0x62, 0xFF, 0xE7, 0x61, 0xFF, 0x28, 0x62, 0xFF, 0x89, 0x5A, 0xFF, 0x0C, 0x5B, 0xFF, 0x69, 0x62, 0xFF, 0xE7, 0x51, 0xFF, 0xC6, 0x49, 0xFF, 0x4D, 0x63, 0xFF, 0x2C, 0x53, 0xFF, 0xC6, 0x41, 0xFF, 0x07, 0x4A, 0xFF, 0xE7, 0x49, 0xFF, 0xEC, 0x62, 0xFF, 0x4D, 0x63, 0xFF, 0xA6, 0x39, 0xFF, 0xC7, 0x49, 0xFF, 0xC6, 0x49, 0xFF, 0xC7, 0x41, 0xFF, 0x6D, 0x63, 0xFF, 0x2C, 0x6B, 0xFF, 0x86, 0x39, 0xFF, 0x86, 0x39, 0xFF, 0x86, 0x39, 0xFF, 0x6E, 0x6B, 0xFF, 0xC6, 0x51, 0xFF, 0xA7, 0x41, 0xFF, 0xE8, 0x51, 0xFF, 0x08, 0x42, 0xFF, 0xCF, 0x6B, 0xFF, 0x49, 0x4A, 0xFF, 0xE7, 0x49, 0xFF, 0x49, 0x52, 0xFF, 0xC7, 0x39, 0xFF, 0xF0, 0x6B, 0xFF, 0xA7, 0x39, 0xFF, 0x8F, 0x73, 0xFF, 0x66, 0x29, 0xFF, 0xC7, 0x31, 0xFF, 0x8F, 0x53, 0xFF, 0xE8, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0xA7, 0x21, 0xFF, 0x67, 0x21, 0xFF, 0x0E, 0x3B, 0xFF, 0x08, 0x32, 0xFF, 0xA7, 0x21, 0xFF, 0x09, 0x2A, 0xFF, 0x09, 0x22, 0xFF, 0xA8, 0x19, 0xFF, 0x4A, 0x2A, 0xFF, 0xE9, 0x21, 0xFF, 0x87, 0x19, 0xFF, 0xC9, 0x19, 0xFF, 0x0D, 0x4B, 0xFF, 0xCD, 0x32, 0xFF, 0xC8, 0x19, 0xFF, 0xA8, 0x19, 0xFF, 0xAC, 0x22, 0xFF, 0x2E, 0x23, 0xFF, 0x67, 0x11, 0xFF, 0xA8, 0x19, 0xFF, 0x87, 0x11, 0xFF, 0xA8, 0x09, 0xFF,
-    0x6A, 0x2A, 0xFF, 0x46, 0x09, 0xFF, 0x4A, 0x22, 0xFF, 0x87, 0x09, 0xFF, 0xF1, 0x2B, 0xFF, 0x87, 0x09, 0xFF, 0x29, 0x1A, 0xFF, 0x4A, 0x22, 0xFF, 0x4A, 0x1A, 0xFF, 0x50, 0x23, 0xFF, 0x2A, 0x1A, 0xFF, 0x8B, 0x22, 0xFF, 0xAB, 0x1A, 0xFF, 0xAC, 0x22, 0xFF, 0xAC, 0x22, 0xFF, 0x0E, 0x23, 0xFF, 0x48, 0x6A, 0xFF, 0xEC, 0x52, 0xFF, 0x8B, 0x5A, 0xFF, 0x07, 0x5A, 0xFF, 0x07, 0x62, 0xFF, 0x2C, 0xB3, 0xFF, 0xAA, 0x62, 0xFF, 0x2D, 0x53, 0xFF, 0x48, 0x62, 0xFF, 0x0F, 0x84, 0xFF, 0xEB, 0x62, 0xFF, 0xC6, 0x41, 0xFF, 0x0D, 0x4B, 0xFF, 0xE7, 0x41, 0xFF, 0x28, 0x5A, 0xFF, 0xA6, 0x41, 0xFF, 0x6A, 0x52, 0xFF, 0x0C, 0x5B, 0xFF, 0xA6, 0x39, 0xFF, 0xAA, 0x42, 0xFF, 0x03, 0x31, 0xFF, 0x24, 0x29, 0xFF, 0x45, 0x31, 0xFF, 0x4C, 0x63, 0xFF, 0x49, 0x52, 0xFF, 0x6A, 0x4A, 0xFF, 0x4C, 0xA3, 0xFF, 0x09, 0x8A, 0xFF, 0xAF, 0x6B, 0xFF, 0xC7, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0x4D, 0x5B, 0xFF, 0xF2, 0xCC, 0xFF, 0xE8, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0xC7, 0x39, 0xFF, 0x8A, 0x52, 0xFF, 0xE8, 0x39, 0xFF, 0x87, 0x39, 0xFF, 0x4A, 0x62, 0xFF, 0x08, 0x3A, 0xFF, 0xA8, 0x29, 0xFF, 0x66, 0x19, 0xFF, 0x90, 0x4B, 0xFF, 0xE8, 0x39, 0xFF, 0x25, 0x11, 0xFF, 0xA8, 0x21, 0xFF,
-    0x90, 0x4B, 0xFF, 0x32, 0x4C, 0xFF, 0x8C, 0x3A, 0xFF, 0x2A, 0x2A, 0xFF, 0x0D, 0x2B, 0xFF, 0xC8, 0x19, 0xFF, 0x53, 0x34, 0xFF, 0xC8, 0x19, 0xFF, 0x0E, 0x33, 0xFF, 0x4A, 0x2A, 0xFF, 0x87, 0x11, 0xFF, 0xD1, 0x2B, 0xFF, 0xE9, 0x11, 0xFF, 0x66, 0x09, 0xFF, 0x66, 0x11, 0xFF, 0xE8, 0x21, 0xFF, 0xD1, 0x2B, 0xFF, 0x87, 0x11, 0xFF, 0x67, 0x11, 0xFF, 0x87, 0x11, 0xFF, 0x6F, 0x3B, 0xFF, 0x09, 0x12, 0xFF, 0x8C, 0x12, 0xFF, 0x4A, 0x22, 0xFF, 0x4A, 0x1A, 0xFF, 0x09, 0x12, 0xFF, 0xE9, 0x09, 0xFF, 0x0E, 0x1B, 0xFF, 0x8B, 0x1A, 0xFF, 0xCD, 0x22, 0xFF, 0xEC, 0x22, 0xFF, 0xCC, 0x1A, 0xFF, 0x47, 0x72, 0xFF, 0x27, 0x6A, 0xFF, 0x27, 0x6A, 0xFF, 0x27, 0x5A, 0xFF, 0x28, 0x5A, 0xFF, 0x45, 0x41, 0xFF, 0x28, 0x62, 0xFF, 0xA5, 0x49, 0xFF, 0x2C, 0x73, 0xFF, 0x08, 0x52, 0xFF, 0x08, 0x52, 0xFF, 0x07, 0x4A, 0xFF, 0xE7, 0x51, 0xFF, 0xA6, 0x49, 0xFF, 0x65, 0x39, 0xFF, 0xC6, 0x41, 0xFF, 0xA6, 0x39, 0xFF, 0xAD, 0x73, 0xFF, 0x85, 0x39, 0xFF, 0xE7, 0x49, 0xFF, 0x44, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0xC7, 0x49, 0xFF, 0x86, 0x39, 0xFF, 0xC7, 0x41, 0xFF, 0xC7, 0x51, 0xFF, 0xCA, 0x62, 0xFF, 0x07, 0x4A, 0xFF, 0x27, 0xDC, 0xFF, 0xC6, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xF0, 0x6B, 0xFF,
-    0xE8, 0x39, 0xFF, 0xAB, 0x62, 0xFF, 0x8A, 0x52, 0xFF, 0xA4, 0xB8, 0xFF, 0x86, 0x31, 0xFF, 0xEC, 0x5A, 0xFF, 0x29, 0x4A, 0xFF, 0xA6, 0xB1, 0xFF, 0xE8, 0x91, 0xFF, 0xC7, 0x31, 0xFF, 0x87, 0x29, 0xFF, 0xA7, 0x31, 0xFF, 0x12, 0x64, 0xFF, 0xC8, 0x51, 0xFF, 0xA7, 0x29, 0xFF, 0x87, 0x21, 0xFF, 0xD1, 0x4B, 0xFF, 0x32, 0x44, 0xFF, 0x4A, 0x32, 0xFF, 0x47, 0x11, 0xFF, 0xAC, 0x2A, 0xFF, 0xA8, 0x19, 0xFF, 0x8B, 0x2A, 0xFF, 0x53, 0x3C, 0xFF, 0xAC, 0x1A, 0xFF, 0x8B, 0x22, 0xFF, 0x09, 0x22, 0xFF, 0x66, 0x11, 0xFF, 0x12, 0x34, 0xFF, 0x09, 0x1A, 0xFF, 0xC8, 0x19, 0xFF, 0x67, 0x11, 0xFF, 0xF4, 0x5C, 0xFF, 0x8F, 0x33, 0xFF, 0x0A, 0x0A, 0xFF, 0xC8, 0x19, 0xFF, 0xA8, 0x11, 0xFF, 0xEC, 0x22, 0xFF, 0x4A, 0x12, 0xFF, 0xB1, 0x23, 0xFF, 0x09, 0x1A, 0xFF, 0x6B, 0x22, 0xFF, 0x8B, 0x22, 0xFF, 0x2A, 0x12, 0xFF, 0x6B, 0x1A, 0xFF, 0x6B, 0x12, 0xFF, 0x4A, 0x12, 0xFF, 0xED, 0x22, 0xFF, 0x69, 0x9A, 0xFF, 0xAA, 0x6A, 0xFF, 0x27, 0x62, 0xFF, 0x48, 0x62, 0xFF, 0x06, 0x62, 0xFF, 0x45, 0x39, 0xFF, 0xEB, 0x62, 0xFF, 0xC6, 0x41, 0xFF, 0x28, 0x5A, 0xFF, 0x28, 0x5A, 0xFF, 0x28, 0x52, 0xFF, 0xE7, 0x49, 0xFF, 0xE7, 0x49, 0xFF, 0x28, 0x5A, 0xFF, 0xA6, 0x39, 0xFF, 0xC7, 0x49, 0xFF,
-    0x86, 0x41, 0xFF, 0xC7, 0x49, 0xFF, 0x44, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x45, 0x31, 0xFF, 0xAE, 0x7B, 0xFF, 0xE4, 0x20, 0xFF, 0xA6, 0x39, 0xFF, 0xE7, 0x41, 0xFF, 0xEB, 0x52, 0xFF, 0xC6, 0x41, 0xFF, 0xA6, 0x39, 0xFF, 0xEA, 0x7A, 0xFF, 0xC6, 0x41, 0xFF, 0x49, 0x4A, 0xFF, 0x89, 0x5A, 0xFF, 0x66, 0x31, 0xFF, 0xE8, 0x41, 0xFF, 0x8A, 0x52, 0xFF, 0xA7, 0x39, 0xFF, 0x0C, 0x5B, 0xFF, 0xC7, 0x39, 0xFF, 0x04, 0x29, 0xFF, 0xD0, 0x8B, 0xFF, 0x69, 0x52, 0xFF, 0x04, 0x19, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x19, 0xFF, 0xEE, 0x72, 0xFF, 0x08, 0x3A, 0xFF, 0xE4, 0x10, 0xFF, 0x6A, 0x3A, 0xFF, 0x11, 0x64, 0xFF, 0xEC, 0x3A, 0xFF, 0x6A, 0x3A, 0xFF, 0x2D, 0x3B, 0xFF, 0xAB, 0x3A, 0xFF, 0xB0, 0x43, 0xFF, 0xA7, 0x19, 0xFF, 0x09, 0x1A, 0xFF, 0xA7, 0x11, 0xFF, 0x46, 0x11, 0xFF, 0x05, 0x09, 0xFF, 0xE9, 0x19, 0xFF, 0xC8, 0x21, 0xFF, 0x46, 0x09, 0xFF, 0x6B, 0x2A, 0xFF, 0x46, 0x09, 0xFF, 0x66, 0x11, 0xFF, 0x66, 0x11, 0xFF, 0xD1, 0x33, 0xFF, 0x66, 0x11, 0xFF, 0xA7, 0x11, 0xFF, 0xC8, 0x19, 0xFF, 0xED, 0x22, 0xFF, 0x66, 0x09, 0xFF, 0x29, 0x1A, 0xFF, 0x2A, 0x1A, 0xFF, 0xCC, 0x2A, 0xFF, 0xA8, 0x09, 0xFF, 0xCC, 0x22, 0xFF, 0xB1, 0x23, 0xFF, 0xCC, 0x22, 0xFF, 0xCC, 0x22, 0xFF,
-    0x68, 0x7A, 0xFF, 0x68, 0x7A, 0xFF, 0xA9, 0x7A, 0xFF, 0x68, 0x72, 0xFF, 0xE6, 0x61, 0xFF, 0xC6, 0x51, 0xFF, 0x27, 0x62, 0xFF, 0x07, 0x5A, 0xFF, 0x07, 0x5A, 0xFF, 0x85, 0x41, 0xFF, 0xA6, 0x49, 0xFF, 0xE7, 0x41, 0xFF, 0xA6, 0x41, 0xFF, 0x08, 0x4A, 0xFF, 0x03, 0x29, 0xFF, 0x8D, 0x73, 0xFF, 0xE3, 0x20, 0xFF, 0x65, 0x31, 0xFF, 0x24, 0x31, 0xFF, 0x24, 0x29, 0xFF, 0x8E, 0x73, 0xFF, 0x24, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0xE3, 0x20, 0xFF, 0xC7, 0x41, 0xFF, 0x8A, 0x62, 0xFF, 0x45, 0x31, 0xFF, 0xE7, 0x49, 0xFF, 0x2C, 0x63, 0xFF, 0x08, 0x4A, 0xFF, 0xE7, 0x49, 0xFF, 0x65, 0x31, 0xFF, 0xEB, 0x62, 0xFF, 0xE8, 0x41, 0xFF, 0xF0, 0x6B, 0xFF, 0x48, 0x52, 0xFF, 0x2D, 0x63, 0xFF, 0x69, 0x4A, 0xFF, 0x45, 0x29, 0xFF, 0x2E, 0x5B, 0xFF, 0x49, 0x4A, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x67, 0x29, 0xFF, 0x8F, 0x63, 0xFF, 0x29, 0x42, 0xFF, 0x66, 0x21, 0xFF, 0xC8, 0x31, 0xFF, 0x8A, 0x22, 0xFF, 0x87, 0x21, 0xFF, 0xE8, 0x29, 0xFF, 0x87, 0x19, 0xFF, 0xA7, 0x19, 0xFF, 0x4B, 0x2A, 0xFF, 0xE8, 0x29, 0xFF, 0xC8, 0x19, 0xFF, 0x66, 0x11, 0xFF, 0xC8, 0x21, 0xFF, 0x05, 0x09, 0xFF, 0x6B, 0x22, 0xFF, 0x87, 0x11, 0xFF, 0x05, 0x09, 0xFF, 0xB0, 0x3B, 0xFF, 0xC8, 0x19, 0xFF,
-    0x26, 0x09, 0xFF, 0x25, 0x09, 0xFF, 0x25, 0x09, 0xFF, 0x2E, 0x1B, 0xFF, 0x09, 0x1A, 0xFF, 0xA7, 0x11, 0xFF, 0x66, 0x09, 0xFF, 0x67, 0x01, 0xFF, 0xED, 0x1A, 0xFF, 0xC8, 0x11, 0xFF, 0x4A, 0x22, 0xFF, 0x67, 0x09, 0xFF, 0x6A, 0x1A, 0xFF, 0x6A, 0x12, 0xFF, 0x8C, 0x1A, 0xFF, 0xCD, 0x22, 0xFF, 0x88, 0x82, 0xFF, 0x88, 0x7A, 0xFF, 0x07, 0x6A, 0xFF, 0x68, 0x6A, 0xFF, 0x2C, 0x63, 0xFF, 0x48, 0x52, 0xFF, 0xCA, 0x62, 0xFF, 0x86, 0x41, 0xFF, 0xE7, 0x59, 0xFF, 0x4D, 0x63, 0xFF, 0xE7, 0x49, 0xFF, 0x08, 0x52, 0xFF, 0xE8, 0x49, 0xFF, 0x86, 0x41, 0xFF, 0x51, 0xB5, 0xFF, 0x24, 0x29, 0xFF, 0xE3, 0x20, 0xFF, 0x85, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x10, 0xB4, 0xFF, 0x45, 0x31, 0xFF, 0x24, 0x29, 0xFF, 0x04, 0x31, 0xFF, 0x48, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0xE7, 0x49, 0xFF, 0x48, 0x5A, 0xFF, 0xAA, 0xF2, 0xFF, 0x4C, 0x7B, 0xFF, 0x2C, 0x7B, 0xFF, 0x85, 0x41, 0xFF, 0xA6, 0x49, 0xFF, 0x66, 0x39, 0xFF, 0xAE, 0x7B, 0xFF, 0xCF, 0x83, 0xFF, 0x28, 0xA3, 0xFF, 0x85, 0x41, 0xFF, 0x25, 0x21, 0xFF, 0xE4, 0x20, 0xFF, 0x2D, 0x5B, 0xFF, 0xC7, 0x39, 0xFF, 0xE4, 0x18, 0xFF, 0x25, 0x19, 0xFF, 0x05, 0x21, 0xFF, 0x8B, 0x42, 0xFF, 0xEB, 0x6A, 0xFF, 0x26, 0x19, 0xFF, 0xC7, 0x29, 0xFF,
-    0xEC, 0x32, 0xFF, 0xE8, 0x31, 0xFF, 0xA8, 0x21, 0xFF, 0xA8, 0x21, 0xFF, 0x0C, 0x33, 0xFF, 0x87, 0x21, 0xFF, 0xC8, 0x19, 0xFF, 0x29, 0x32, 0xFF, 0xCB, 0x2A, 0xFF, 0x46, 0x09, 0xFF, 0x26, 0x09, 0xFF, 0x26, 0x09, 0xFF, 0x46, 0x11, 0xFF, 0x4A, 0x22, 0xFF, 0xE4, 0x00, 0xFF, 0x0E, 0x23, 0xFF, 0x67, 0x11, 0xFF, 0x46, 0x09, 0xFF, 0x25, 0x09, 0xFF, 0x45, 0x09, 0xFF, 0x67, 0x01, 0xFF, 0x26, 0x09, 0xFF, 0xE8, 0x19, 0xFF, 0xC8, 0x19, 0xFF, 0xE8, 0x19, 0xFF, 0x0D, 0x2B, 0xFF, 0x87, 0x09, 0xFF, 0x29, 0x1A, 0xFF, 0x6A, 0x22, 0xFF, 0x8B, 0x1A, 0xFF, 0x6A, 0x1A, 0xFF, 0x0E, 0x2B, 0xFF, 0x88, 0x82, 0xFF, 0xEA, 0x7A, 0xFF, 0xCB, 0x52, 0xFF, 0x27, 0x5A, 0xFF, 0x89, 0x62, 0xFF, 0x68, 0x72, 0xFF, 0x48, 0x62, 0xFF, 0x53, 0xBD, 0xFF, 0x48, 0x62, 0xFF, 0x48, 0x62, 0xFF, 0x08, 0x52, 0xFF, 0x44, 0x31, 0xFF, 0x2B, 0x6B, 0xFF, 0xC7, 0x41, 0xFF, 0x07, 0x42, 0xFF, 0xE3, 0x20, 0xFF, 0x04, 0x21, 0xFF, 0xCB, 0x62, 0xFF, 0x28, 0x7B, 0xFF, 0xC2, 0x20, 0xFF, 0x44, 0x39, 0xFF, 0x44, 0x39, 0xFF, 0x6F, 0xF6, 0xFF, 0xA9, 0x6A, 0xFF, 0x48, 0x5A, 0xFF, 0xA6, 0x79, 0xFF, 0x85, 0x71, 0xFF, 0x49, 0xA2, 0xFF, 0x72, 0x94, 0xFF, 0x86, 0x41, 0xFF, 0x86, 0x71, 0xFF, 0xEE, 0xFF, 0xFF,
-    0x45, 0x41, 0xFF, 0x66, 0x39, 0xFF, 0x25, 0x29, 0xFF, 0x27, 0xFA, 0xFF, 0x65, 0x31, 0xFF, 0x05, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0xAB, 0x62, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x59, 0xFF, 0xE8, 0xE9, 0xFF, 0x08, 0x4A, 0xFF, 0x66, 0x21, 0xFF, 0xA7, 0x39, 0xFF, 0x31, 0x5C, 0xFF, 0xD1, 0x4B, 0xFF, 0x46, 0x29, 0xFF, 0x2A, 0x2A, 0xFF, 0x6A, 0x3A, 0xFF, 0x6A, 0x3A, 0xFF, 0xF1, 0x33, 0xFF, 0x08, 0x2A, 0xFF, 0x25, 0x01, 0xFF, 0x46, 0x11, 0xFF, 0x4A, 0x1A, 0xFF, 0x90, 0x2B, 0xFF, 0x66, 0x11, 0xFF, 0x05, 0x09, 0xFF, 0xE4, 0x00, 0xFF, 0x67, 0x09, 0xFF, 0xC9, 0x11, 0xFF, 0x25, 0x01, 0xFF, 0x46, 0x09, 0xFF, 0x25, 0x09, 0xFF, 0xC8, 0x19, 0xFF, 0xCD, 0x1A, 0xFF, 0x09, 0x12, 0xFF, 0x87, 0x11, 0xFF, 0xC8, 0x19, 0xFF, 0x29, 0x22, 0xFF, 0xAB, 0x22, 0xFF, 0x6B, 0x22, 0xFF, 0x09, 0x12, 0xFF, 0x4A, 0x1A, 0xFF, 0x8B, 0x1A, 0xFF, 0xAB, 0x1A, 0xFF, 0xC9, 0x92, 0xFF, 0xA9, 0x8A, 0xFF, 0x88, 0x7A, 0xFF, 0x44, 0x39, 0xFF, 0x06, 0x6A, 0xFF, 0x47, 0x62, 0xFF, 0x68, 0x6A, 0xFF, 0x45, 0x41, 0xFF, 0x8A, 0x52, 0xFF, 0xA7, 0x39, 0xFF, 0xC6, 0x51, 0xFF, 0x28, 0x52, 0xFF, 0xA6, 0x39, 0xFF, 0x88, 0x5A, 0xFF, 0x24, 0x29, 0xFF, 0x04, 0x29, 0xFF,
-    0x28, 0x52, 0xFF, 0x0B, 0x5B, 0xFF, 0x44, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0x44, 0x39, 0xFF, 0x2D, 0x9C, 0xFF, 0x45, 0x39, 0xFF, 0x44, 0x39, 0xFF, 0xC6, 0x49, 0xFF, 0xA6, 0x59, 0xFF, 0x6C, 0x8B, 0xFF, 0x65, 0x41, 0xFF, 0xA6, 0x49, 0xFF, 0x07, 0x62, 0xFF, 0xD1, 0xFD, 0xFF, 0x86, 0x59, 0xFF, 0xAA, 0x62, 0xFF, 0xF1, 0x63, 0xFF, 0x86, 0x39, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0xAF, 0x73, 0xFF, 0x08, 0x4A, 0xFF, 0x8D, 0x53, 0xFF, 0xE4, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x39, 0xFF, 0x0D, 0x53, 0xFF, 0x26, 0x21, 0xFF, 0x46, 0x21, 0xFF, 0x25, 0x11, 0xFF, 0x46, 0x19, 0xFF, 0x6F, 0x2B, 0xFF, 0x66, 0x19, 0xFF, 0x8B, 0x32, 0xFF, 0x09, 0x32, 0xFF, 0x6A, 0x32, 0xFF, 0xF0, 0x43, 0xFF, 0xC8, 0x19, 0xFF, 0xC4, 0x00, 0xFF, 0xA7, 0x11, 0xFF, 0x46, 0x11, 0xFF, 0x26, 0x09, 0xFF, 0x05, 0x01, 0xFF, 0xAC, 0x1A, 0xFF, 0x05, 0x09, 0xFF, 0xE4, 0x00, 0xFF, 0xA4, 0x00, 0xFF, 0xA4, 0x00, 0xFF, 0x26, 0x01, 0xFF, 0x66, 0x09, 0xFF, 0x46, 0x09, 0xFF, 0x87, 0x11, 0xFF, 0xED, 0x22, 0xFF, 0xA8, 0x11, 0xFF, 0xE8, 0x11, 0xFF, 0xA7, 0x11, 0xFF, 0xE8, 0x11, 0xFF, 0x2A, 0x12, 0xFF, 0xE8, 0x11, 0xFF, 0x4A, 0x1A, 0xFF, 0xCC, 0x22, 0xFF, 0x6A, 0x12, 0xFF,
-    0xA7, 0x8A, 0xFF, 0xAA, 0x5A, 0xFF, 0xA9, 0x7A, 0xFF, 0x84, 0x49, 0xFF, 0x47, 0x7A, 0xFF, 0x07, 0x5A, 0xFF, 0x8E, 0x83, 0xFF, 0x24, 0x39, 0xFF, 0xE6, 0x51, 0xFF, 0x65, 0x41, 0xFF, 0x04, 0x29, 0xFF, 0x28, 0x62, 0xFF, 0x85, 0x49, 0xFF, 0xE3, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0xC3, 0x18, 0xFF, 0x85, 0x39, 0xFF, 0x24, 0x31, 0xFF, 0x65, 0x31, 0xFF, 0x04, 0x29, 0xFF, 0x0B, 0x6B, 0xFF, 0x85, 0x59, 0xFF, 0x24, 0x31, 0xFF, 0x44, 0x39, 0xFF, 0xA6, 0x41, 0xFF, 0x07, 0x62, 0xFF, 0xE8, 0xC1, 0xFF, 0x86, 0x41, 0xFF, 0x88, 0x72, 0xFF, 0x26, 0x6A, 0xFF, 0xA6, 0x59, 0xFF, 0x45, 0x39, 0xFF, 0x86, 0x39, 0xFF, 0x66, 0x39, 0xFF, 0x09, 0x5A, 0xFF, 0x69, 0x6A, 0xFF, 0x66, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x20, 0xFF, 0x0D, 0x5B, 0xFF, 0x66, 0x21, 0xFF, 0x25, 0x19, 0xFF, 0x67, 0x29, 0xFF, 0x8B, 0x4A, 0xFF, 0xC7, 0x31, 0xFF, 0x26, 0x19, 0xFF, 0x66, 0x19, 0xFF, 0xB0, 0x4B, 0xFF, 0x05, 0x11, 0xFF, 0x26, 0x19, 0xFF, 0x67, 0x19, 0xFF, 0xC8, 0x21, 0xFF, 0x0A, 0x22, 0xFF, 0x05, 0x09, 0xFF, 0xC8, 0x21, 0xFF, 0x05, 0x09, 0xFF, 0x4A, 0x2A, 0xFF, 0x87, 0x19, 0xFF, 0x67, 0x11, 0xFF, 0xF2, 0x33, 0xFF, 0x46, 0x11, 0xFF, 0xAC, 0x1A, 0xFF, 0x25, 0x11, 0xFF,
-    0x66, 0x19, 0xFF, 0xC4, 0x00, 0xFF, 0xB1, 0x2B, 0xFF, 0xE8, 0x19, 0xFF, 0x46, 0x09, 0xFF, 0x66, 0x09, 0xFF, 0x46, 0x09, 0xFF, 0x90, 0x2B, 0xFF, 0x46, 0x09, 0xFF, 0x47, 0x01, 0xFF, 0xE9, 0x11, 0xFF, 0xE8, 0x11, 0xFF, 0xED, 0x1A, 0xFF, 0xB0, 0x2B, 0xFF, 0x6B, 0x1A, 0xFF, 0x8B, 0x22, 0xFF, 0x09, 0x9B, 0xFF, 0xC8, 0x92, 0xFF, 0x26, 0x7A, 0xFF, 0xC5, 0x59, 0xFF, 0x47, 0x7A, 0xFF, 0x85, 0x41, 0xFF, 0xC9, 0x72, 0xFF, 0x43, 0x39, 0xFF, 0xE5, 0x61, 0xFF, 0x05, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0x85, 0x59, 0xFF, 0xE3, 0x30, 0xFF, 0x24, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0xE4, 0x20, 0xFF, 0x8C, 0x83, 0xFF, 0x65, 0x31, 0xFF, 0x03, 0x21, 0xFF, 0x49, 0x52, 0xFF, 0x03, 0x39, 0xFF, 0x65, 0x69, 0xFF, 0xA5, 0x51, 0xFF, 0xEA, 0x6A, 0xFF, 0x07, 0x52, 0xFF, 0x86, 0x51, 0xFF, 0xA6, 0x91, 0xFF, 0x07, 0x52, 0xFF, 0xC5, 0x59, 0xFF, 0xA5, 0x51, 0xFF, 0x86, 0x49, 0xFF, 0x45, 0x41, 0xFF, 0x66, 0x39, 0xFF, 0x46, 0x31, 0xFF, 0xD0, 0x7B, 0xFF, 0x0B, 0x93, 0xFF, 0x66, 0x31, 0xFF, 0xE4, 0x20, 0xFF, 0x45, 0x29, 0xFF, 0x8F, 0x6B, 0xFF, 0x87, 0x31, 0xFF, 0x04, 0x19, 0xFF, 0x26, 0x19, 0xFF, 0x05, 0x19, 0xFF, 0x2E, 0x53, 0xFF, 0xE8, 0x39, 0xFF, 0x06, 0x11, 0xFF, 0xC8, 0x29, 0xFF,
-    0x2A, 0x2A, 0xFF, 0x05, 0x11, 0xFF, 0x46, 0x11, 0xFF, 0x46, 0x19, 0xFF, 0xE5, 0x00, 0xFF, 0x09, 0x22, 0xFF, 0xE4, 0x00, 0xFF, 0xC8, 0x21, 0xFF, 0xC8, 0x19, 0xFF, 0xE8, 0x21, 0xFF, 0x8F, 0x43, 0xFF, 0xA7, 0x19, 0xFF, 0x92, 0x5C, 0xFF, 0xA3, 0x00, 0xFF, 0x25, 0x11, 0xFF, 0x2D, 0x2B, 0xFF, 0x46, 0x11, 0xFF, 0x05, 0x09, 0xFF, 0xC4, 0x00, 0xFF, 0x25, 0x11, 0xFF, 0x46, 0x09, 0xFF, 0x46, 0x09, 0xFF, 0x87, 0x09, 0xFF, 0x66, 0x09, 0xFF, 0x86, 0x09, 0xFF, 0xA8, 0x11, 0xFF, 0x09, 0x1A, 0xFF, 0xC8, 0x11, 0xFF, 0x29, 0x1A, 0xFF, 0x8A, 0x1A, 0xFF, 0x29, 0x12, 0xFF, 0x4A, 0x1A, 0xFF, 0xE8, 0x92, 0xFF, 0xC9, 0x8A, 0xFF, 0xA8, 0x8A, 0xFF, 0xC9, 0x7A, 0xFF, 0x89, 0x62, 0xFF, 0x02, 0x39, 0xFF, 0xE6, 0x51, 0xFF, 0x85, 0x41, 0xFF, 0x04, 0x21, 0xFF, 0xE8, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x39, 0xFF, 0x45, 0x31, 0xFF, 0x04, 0x29, 0xFF, 0xAA, 0x52, 0xFF, 0x25, 0x29, 0xFF, 0x65, 0x31, 0xFF, 0x44, 0x29, 0xFF, 0xCB, 0x5A, 0xFF, 0x6C, 0x73, 0xFF, 0x03, 0x39, 0xFF, 0xE6, 0x61, 0xFF, 0xE8, 0xEC, 0xFF, 0x86, 0x8B, 0xFF, 0xC7, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xE7, 0x71, 0xFF, 0x6C, 0x93, 0xFF, 0xCA, 0x72, 0xFF, 0xCE, 0xB3, 0xFF, 0x45, 0x51, 0xFF, 0x39, 0xD4, 0xFF,
-    0x86, 0x41, 0xFF, 0xAB, 0x5A, 0xFF, 0xEC, 0x62, 0xFF, 0xCF, 0x73, 0xFF, 0xE7, 0x39, 0xFF, 0x46, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x8B, 0x5A, 0xFF, 0x86, 0x31, 0xFF, 0x04, 0x19, 0xFF, 0x04, 0x11, 0xFF, 0x05, 0x19, 0xFF, 0xE5, 0x08, 0xFF, 0x66, 0x21, 0xFF, 0x05, 0x11, 0xFF, 0x66, 0x21, 0xFF, 0xE6, 0x10, 0xFF, 0x26, 0x11, 0xFF, 0x05, 0x11, 0xFF, 0xC4, 0x08, 0xFF, 0xC5, 0x08, 0xFF, 0x87, 0x19, 0xFF, 0x05, 0x09, 0xFF, 0x66, 0x19, 0xFF, 0xED, 0x32, 0xFF, 0x25, 0x09, 0xFF, 0xC4, 0x08, 0xFF, 0x46, 0x11, 0xFF, 0x46, 0x11, 0xFF, 0xE4, 0x00, 0xFF, 0xE4, 0x08, 0xFF, 0xC9, 0x19, 0xFF, 0x66, 0x11, 0xFF, 0x06, 0x09, 0xFF, 0xE5, 0x00, 0xFF, 0x05, 0x09, 0xFF, 0x0E, 0x23, 0xFF, 0x26, 0x01, 0xFF, 0x47, 0x09, 0xFF, 0x67, 0x09, 0xFF, 0x87, 0x11, 0xFF, 0xCC, 0x2A, 0xFF, 0xE9, 0x11, 0xFF, 0xE9, 0x11, 0xFF, 0x09, 0x12, 0xFF, 0x4A, 0x1A, 0xFF, 0x4A, 0x1A, 0xFF, 0x6A, 0x1A, 0xFF, 0xC8, 0x9A, 0xFF, 0xC9, 0x82, 0xFF, 0x4D, 0x63, 0xFF, 0xC6, 0x49, 0xFF, 0x48, 0x4A, 0xFF, 0xA1, 0x28, 0xFF, 0x03, 0x21, 0xFF, 0x2D, 0x5B, 0xFF, 0xC7, 0x39, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x10, 0x7C, 0xFF, 0x86, 0x31, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF,
-    0x89, 0x52, 0xFF, 0x4C, 0x6B, 0xFF, 0xE6, 0x49, 0xFF, 0x44, 0x31, 0xFF, 0x85, 0x41, 0xFF, 0xC5, 0x59, 0xFF, 0x65, 0x72, 0xFF, 0xA5, 0x49, 0xFF, 0xA6, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0xC3, 0x40, 0xFF, 0x45, 0x41, 0xFF, 0x2B, 0x6B, 0xFF, 0xC7, 0x69, 0xFF, 0xC7, 0xC9, 0xFF, 0x26, 0x71, 0xFF, 0x05, 0x39, 0xFF, 0xC7, 0x49, 0xFF, 0x24, 0x39, 0xFF, 0xA6, 0x49, 0xFF, 0x04, 0x29, 0xFF, 0x08, 0x52, 0xFF, 0x86, 0x31, 0xFF, 0x24, 0x21, 0xFF, 0xA6, 0x29, 0xFF, 0x45, 0x21, 0xFF, 0x04, 0x19, 0xFF, 0x05, 0x19, 0xFF, 0xC4, 0x08, 0xFF, 0x86, 0x21, 0xFF, 0xE5, 0x10, 0xFF, 0x87, 0x21, 0xFF, 0x6F, 0x4B, 0xFF, 0xF0, 0x4B, 0xFF, 0xE5, 0x10, 0xFF, 0x05, 0x11, 0xFF, 0x29, 0x22, 0xFF, 0xC8, 0x21, 0xFF, 0xB0, 0x3B, 0xFF, 0x46, 0x19, 0xFF, 0xE5, 0x08, 0xFF, 0xA7, 0x11, 0xFF, 0x25, 0x09, 0xFF, 0xB0, 0x3B, 0xFF, 0x05, 0x09, 0xFF, 0x6B, 0x1A, 0xFF, 0xE4, 0x00, 0xFF, 0xC4, 0x00, 0xFF, 0xAC, 0x1A, 0xFF, 0xA7, 0x11, 0xFF, 0xE5, 0x00, 0xFF, 0xE4, 0x00, 0xFF, 0x2A, 0x2A, 0xFF, 0x0E, 0x2B, 0xFF, 0x67, 0x01, 0xFF, 0x67, 0x09, 0xFF, 0x87, 0x09, 0xFF, 0xC8, 0x19, 0xFF, 0x8B, 0x1A, 0xFF, 0x2A, 0x1A, 0xFF, 0xE9, 0x11, 0xFF, 0xE9, 0x11, 0xFF, 0xE8, 0x11, 0xFF, 0x29, 0x12, 0xFF,
-    0xE8, 0x9A, 0xFF, 0xC9, 0x82, 0xFF, 0x4A, 0x9B, 0xFF, 0x07, 0x62, 0xFF, 0x87, 0x8A, 0xFF, 0x45, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0xE4, 0x20, 0xFF, 0x04, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0xE4, 0x20, 0xFF, 0x04, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0x24, 0x29, 0xFF, 0x4D, 0x63, 0xFF, 0xC7, 0xBB, 0xFF, 0x85, 0x41, 0xFF, 0x44, 0x41, 0xFF, 0x44, 0x49, 0xFF, 0x8A, 0x5A, 0xFF, 0x04, 0x31, 0xFF, 0x65, 0x39, 0xFF, 0x24, 0x41, 0xFF, 0x65, 0x41, 0xFF, 0x44, 0x31, 0xFF, 0xAB, 0x5A, 0xFF, 0x85, 0x61, 0xFF, 0xF1, 0xFF, 0xFF, 0x65, 0x69, 0xFF, 0xC3, 0x28, 0xFF, 0x2E, 0x5B, 0xFF, 0x45, 0x31, 0xFF, 0x86, 0x41, 0xFF, 0x05, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0xEC, 0x5A, 0xFF, 0x2E, 0x63, 0xFF, 0x45, 0x21, 0xFF, 0xC4, 0x10, 0xFF, 0xE4, 0x10, 0xFF, 0x05, 0x19, 0xFF, 0x2D, 0x43, 0xFF, 0x87, 0x21, 0xFF, 0x46, 0x11, 0xFF, 0x66, 0x21, 0xFF, 0x8F, 0x4B, 0xFF, 0x0E, 0x33, 0xFF, 0xE4, 0x08, 0xFF, 0xE5, 0x10, 0xFF, 0x05, 0x09, 0xFF, 0xC8, 0x21, 0xFF, 0x05, 0x11, 0xFF, 0x46, 0x11, 0xFF, 0x05, 0x09, 0xFF, 0x46, 0x11, 0xFF, 0x04, 0x01, 0xFF, 0xE4, 0x08, 0xFF, 0x05, 0x09, 0xFF, 0xE5, 0x00, 0xFF, 0xE4, 0x00, 0xFF, 0x25, 0x09, 0xFF,
-    0x25, 0x11, 0xFF, 0xE4, 0x00, 0xFF, 0x46, 0x11, 0xFF, 0x05, 0x09, 0xFF, 0xE4, 0x00, 0xFF, 0x26, 0x09, 0xFF, 0x05, 0x01, 0xFF, 0x47, 0x09, 0xFF, 0x46, 0x09, 0xFF, 0xA8, 0x11, 0xFF, 0xC8, 0x11, 0xFF, 0xC8, 0x11, 0xFF, 0xA8, 0x09, 0xFF, 0x09, 0x12, 0xFF, 0x2A, 0x1A, 0xFF, 0xE8, 0x11, 0xFF, 0xE9, 0xA2, 0xFF, 0xC7, 0x49, 0xFF, 0xE9, 0x9A, 0xFF, 0xC5, 0x51, 0xFF, 0x03, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0xE8, 0x41, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0xE4, 0x20, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x20, 0xFF, 0x6C, 0x6B, 0xFF, 0x85, 0x39, 0xFF, 0x85, 0x62, 0xFF, 0xE7, 0xC3, 0xFF, 0xC6, 0x49, 0xFF, 0xAA, 0x52, 0xFF, 0x45, 0x39, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x31, 0xFF, 0x04, 0x31, 0xFF, 0x23, 0x39, 0xFF, 0x24, 0x39, 0xFF, 0x44, 0x39, 0xFF, 0x86, 0x49, 0xFF, 0xC7, 0x71, 0xFF, 0xE8, 0x79, 0xFF, 0x04, 0x31, 0xFF, 0x04, 0x29, 0xFF, 0xA7, 0x39, 0xFF, 0x2D, 0x8B, 0xFF, 0xC7, 0x39, 0xFF, 0x05, 0x21, 0xFF, 0x66, 0x31, 0xFF, 0x05, 0x11, 0xFF, 0xAB, 0x52, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x19, 0xFF, 0x05, 0x19, 0xFF, 0x26, 0x19, 0xFF, 0x05, 0x11, 0xFF, 0x46, 0x21, 0xFF, 0x25, 0x19, 0xFF, 0x05, 0x11, 0xFF,
-    0x05, 0x11, 0xFF, 0xB1, 0x43, 0xFF, 0x05, 0x09, 0xFF, 0xE5, 0x08, 0xFF, 0xE4, 0x08, 0xFF, 0x67, 0x19, 0xFF, 0xC4, 0x08, 0xFF, 0xE5, 0x00, 0xFF, 0x05, 0x09, 0xFF, 0xE4, 0x00, 0xFF, 0xE5, 0x00, 0xFF, 0x05, 0x09, 0xFF, 0x6F, 0x33, 0xFF, 0x46, 0x11, 0xFF, 0xED, 0x22, 0xFF, 0x05, 0x01, 0xFF, 0x25, 0x09, 0xFF, 0x0D, 0x2B, 0xFF, 0x05, 0x01, 0xFF, 0x05, 0x01, 0xFF, 0xE5, 0x00, 0xFF, 0xC4, 0x00, 0xFF, 0xE5, 0x00, 0xFF, 0xAD, 0x1A, 0xFF, 0x47, 0x11, 0xFF, 0x47, 0x09, 0xFF, 0x87, 0x09, 0xFF, 0xA8, 0x11, 0xFF, 0x4E, 0x2B, 0xFF, 0x11, 0x4C, 0xFF, 0x09, 0x12, 0xFF, 0xE9, 0x11, 0xFF, 0x67, 0x7A, 0xFF, 0x68, 0x7A, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x29, 0xFF, 0x8A, 0x52, 0xFF, 0xC7, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0xE3, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0x4D, 0x6B, 0xFF, 0xE4, 0x20, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x20, 0xFF, 0x25, 0x29, 0xFF, 0x08, 0x42, 0xFF, 0x04, 0x21, 0xFF, 0xA6, 0x39, 0xFF, 0x45, 0x5A, 0xFF, 0x87, 0xAB, 0xFF, 0x69, 0x4A, 0xFF, 0x04, 0x29, 0xFF, 0x24, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0xE3, 0x20, 0xFF, 0x86, 0x49, 0xFF, 0x04, 0x29, 0xFF, 0x04, 0x29, 0xFF, 0x65, 0x39, 0xFF, 0x04, 0x31, 0xFF, 0x25, 0x39, 0xFF, 0x25, 0x31, 0xFF,
-    0x25, 0x29, 0xFF, 0xE4, 0x20, 0xFF, 0x25, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0xE4, 0x28, 0xFF, 0x2D, 0x5B, 0xFF, 0xE4, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x21, 0xFF, 0x05, 0x19, 0xFF, 0xE5, 0x10, 0xFF, 0x25, 0x19, 0xFF, 0x05, 0x09, 0xFF, 0x05, 0x11, 0xFF, 0xC4, 0x00, 0xFF, 0xE5, 0x10, 0xFF, 0x05, 0x11, 0xFF, 0x05, 0x09, 0xFF, 0xE4, 0x08, 0xFF, 0x4A, 0x2A, 0xFF, 0xE5, 0x08, 0xFF, 0xE5, 0x08, 0xFF, 0x05, 0x09, 0xFF, 0xE5, 0x08, 0xFF, 0x8B, 0x22, 0xFF, 0x4E, 0x4B, 0xFF, 0x25, 0x11, 0xFF, 0xC4, 0x00, 0xFF, 0xC4, 0x00, 0xFF, 0x6B, 0x1A, 0xFF, 0x05, 0x09, 0xFF, 0x25, 0x09, 0xFF, 0xE4, 0x00, 0xFF, 0x6A, 0x22, 0xFF, 0x87, 0x11, 0xFF, 0xE5, 0x00, 0xFF, 0xC4, 0x00, 0xFF, 0x25, 0x09, 0xFF, 0x26, 0x09, 0xFF, 0x46, 0x09, 0xFF, 0xA8, 0x11, 0xFF, 0x67, 0x09, 0xFF, 0xA8, 0x09, 0xFF, 0xC8, 0x11, 0xFF, 0xA8, 0x09, 0xFF, 0xE9, 0x11, 0xFF, 0xE8, 0xAA, 0xFF, 0x45, 0x29, 0xFF, 0xC3, 0x18, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x18, 0xFF, 0x82, 0x10, 0xFF, 0xE3, 0x20, 0xFF, 0xE4, 0x18, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x45, 0x41, 0xFF, 0x04, 0x31, 0xFF, 0x05, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x29, 0xFF,
-    0x0B, 0x6B, 0xFF, 0x66, 0x62, 0xFF, 0x87, 0x72, 0xFF, 0xA9, 0x5A, 0xFF, 0x24, 0x29, 0xFF, 0x04, 0x29, 0xFF, 0x04, 0x31, 0xFF, 0x85, 0x41, 0xFF, 0x45, 0x39, 0xFF, 0xC2, 0x30, 0xFF, 0x45, 0x39, 0xFF, 0x65, 0x39, 0xFF, 0xE7, 0x59, 0xFF, 0x08, 0x4A, 0xFF, 0x86, 0x51, 0xFF, 0x66, 0x39, 0xFF, 0x25, 0x29, 0xFF, 0xE4, 0x20, 0xFF, 0x6A, 0x5A, 0xFF, 0x46, 0x31, 0xFF, 0x45, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0xAC, 0x62, 0xFF, 0xE9, 0x31, 0xFF, 0x25, 0x19, 0xFF, 0x25, 0x19, 0xFF, 0xE4, 0x18, 0xFF, 0x05, 0x11, 0xFF, 0x0D, 0x4B, 0xFF, 0x46, 0x11, 0xFF, 0x05, 0x11, 0xFF, 0x25, 0x11, 0xFF, 0x05, 0x11, 0xFF, 0x46, 0x19, 0xFF, 0x05, 0x09, 0xFF, 0x05, 0x09, 0xFF, 0xE4, 0x00, 0xFF, 0xE4, 0x08, 0xFF, 0xA4, 0x00, 0xFF, 0x05, 0x09, 0xFF, 0xE5, 0x08, 0xFF, 0xC4, 0x00, 0xFF, 0xE4, 0x00, 0xFF, 0xC4, 0x08, 0xFF, 0x25, 0x09, 0xFF, 0x46, 0x11, 0xFF, 0xE4, 0x00, 0xFF, 0xC4, 0x00, 0xFF, 0xE5, 0x08, 0xFF, 0x46, 0x11, 0xFF, 0xE5, 0x00, 0xFF, 0x05, 0x09, 0xFF, 0xC4, 0x00, 0xFF, 0x25, 0x09, 0xFF, 0xE5, 0x00, 0xFF, 0xE5, 0x00, 0xFF, 0xE5, 0x00, 0xFF, 0x4B, 0x1A, 0xFF, 0x46, 0x09, 0xFF, 0x47, 0x09, 0xFF, 0x87, 0x09, 0xFF, 0xC8, 0x11, 0xFF, 0x0A, 0x1A, 0xFF, 0xC8, 0x11, 0xFF,
+    0x46, 0x09, 0x66, 0x09, 0x66, 0x09, 0xA8, 0x11, 0xE9, 0x19, 0x88, 0x11, 0xE9, 0x11, 0x6B, 0x12, 0xE9, 0x11, 0xE9, 0x11, 0xE9, 0x11, 0x09, 0x12, 0x0A, 0x0A, 0x2B, 0x0A, 0x6B, 0x12, 0xAC, 0x1A, 0x6C, 0x0A, 0x2E, 0x1B, 0xEE, 0x0A, 0xEE, 0x12, 0xAD, 0x0A, 0x0E, 0x0B, 0x0F, 0x0B, 0x57, 0x1E, 0xB0, 0x03, 0x90, 0x0B, 0x16, 0x03, 0x13, 0x04, 0xFF, 0xF7, 0x38, 0x87, 0xFF, 0xFF, 0x90, 0x0B,
+    0xD0, 0x0B, 0x11, 0x15, 0xFF, 0xFF, 0x91, 0x04, 0x13, 0x04, 0x30, 0x0B, 0x2F, 0x3B, 0xD5, 0x14, 0x31, 0x03, 0xFF, 0xF7, 0x10, 0x03, 0x10, 0x03, 0x10, 0x03, 0x36, 0x04, 0x10, 0x03, 0xF0, 0x02, 0x94, 0x03, 0xFF, 0xFF, 0x37, 0x04, 0xF1, 0x02, 0xD2, 0x02, 0x12, 0x03, 0x12, 0x03, 0xF3, 0x02, 0xB7, 0x04, 0x11, 0x03, 0x11, 0x03, 0xEF, 0x02, 0xAE, 0x02, 0x35, 0x04, 0x8E, 0x02, 0x6D, 0x02,
+    0x6D, 0x02, 0x2C, 0x02, 0x2C, 0x02, 0xB3, 0x03, 0x0B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x93, 0x0B, 0x2C, 0x02, 0x4C, 0x0A, 0x4C, 0x0A, 0x6C, 0x0A, 0xCE, 0x12, 0x8D, 0x02, 0x4B, 0x02, 0x66, 0x09, 0x67, 0x09, 0xAC, 0x1A, 0x87, 0x11, 0xAB, 0x22, 0x87, 0x11, 0xA8, 0x11, 0xEE, 0x1A, 0x09, 0x12, 0x8B, 0x22, 0xE9, 0x11, 0x09, 0x12, 0xEA, 0x09, 0xB0, 0x13, 0x4A, 0x02, 0x4B, 0x0A,
+    0x4B, 0x12, 0x6B, 0x0A, 0xCE, 0x02, 0xD1, 0x23, 0xCD, 0x12, 0xEE, 0x0A, 0xEE, 0x0A, 0x37, 0x06, 0x92, 0x0C, 0x72, 0x0C, 0x55, 0x1C, 0xF2, 0x0B, 0xD6, 0x25, 0x9C, 0x5F, 0x6F, 0x04, 0x4F, 0x03, 0x4F, 0x0C, 0x52, 0x1D, 0xFF, 0x8F, 0xB0, 0x0C, 0xF1, 0x03, 0x50, 0x0B, 0xF0, 0x12, 0x98, 0x1D, 0xF0, 0x02, 0x52, 0x04, 0x30, 0x03, 0x10, 0x03, 0x51, 0x0B, 0x30, 0x03, 0xF0, 0x02, 0xD0, 0x02,
+    0x71, 0x03, 0x34, 0x03, 0x52, 0x03, 0xB1, 0x02, 0xD3, 0x02, 0xF2, 0x02, 0xF1, 0x02, 0xF4, 0x0B, 0x11, 0x03, 0xF8, 0x2D, 0xD0, 0x02, 0x0F, 0x03, 0xEF, 0x02, 0xF7, 0x1C, 0x0F, 0x03, 0x6D, 0x02, 0x8D, 0x02, 0x6D, 0x02, 0x8E, 0x02, 0x2C, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x6D, 0x02, 0x4C, 0x02, 0x8D, 0x02, 0x4C, 0x0A, 0x4C, 0x0A, 0x6C, 0x0A, 0xCD, 0x0A, 0x6C, 0x0A, 0x4B, 0x02, 0x4C, 0x02,
+    0x46, 0x09, 0x87, 0x09, 0xA7, 0x11, 0x87, 0x11, 0x4A, 0x22, 0x87, 0x11, 0xA8, 0x11, 0x2A, 0x1A, 0x2A, 0x12, 0x09, 0x12, 0xC9, 0x11, 0x09, 0x0A, 0x4B, 0x12, 0x2A, 0x0A, 0x4B, 0x12, 0x6B, 0x12, 0x8C, 0x12, 0xF1, 0x23, 0x8C, 0x02, 0x8C, 0x12, 0xCD, 0x0A, 0xED, 0x0A, 0x2E, 0x03, 0x51, 0x0C, 0xD9, 0x0E, 0xD0, 0x0B, 0x50, 0x03, 0x53, 0x03, 0xDE, 0x5F, 0x71, 0x16, 0x54, 0x36, 0xD1, 0x03,
+    0xF1, 0x13, 0x10, 0x04, 0x50, 0x05, 0x30, 0x04, 0xF1, 0x0B, 0x91, 0x0B, 0x30, 0x0B, 0xF0, 0x02, 0xF1, 0x02, 0xFF, 0xFF, 0xB2, 0x03, 0xF0, 0x02, 0x10, 0x03, 0xF3, 0x0D, 0xF0, 0x02, 0x11, 0x03, 0xFF, 0x7F, 0x14, 0x04, 0x32, 0x03, 0xF2, 0x02, 0x15, 0x03, 0x74, 0x03, 0x11, 0x03, 0x53, 0x03, 0x94, 0x03, 0xF5, 0x03, 0xB3, 0x03, 0x15, 0x04, 0x2F, 0x03, 0x2F, 0x03, 0xCE, 0x02, 0x8E, 0x02,
+    0x6D, 0x02, 0x6D, 0x02, 0x6D, 0x02, 0x4C, 0x02, 0x4C, 0x02, 0x2C, 0x02, 0x4C, 0x02, 0x6D, 0x02, 0x4C, 0x0A, 0x4C, 0x0A, 0x4C, 0x02, 0x4C, 0x02, 0x4C, 0x02, 0x4C, 0x0A, 0xEA, 0x01, 0x4C, 0x0A, 0x87, 0x09, 0x87, 0x09, 0xA8, 0x11, 0x87, 0x11, 0x6B, 0x12, 0xC8, 0x11, 0xC8, 0x11, 0xC9, 0x11, 0xE9, 0x11, 0x90, 0x1B, 0x0A, 0x0A, 0x0A, 0x12, 0x2A, 0x12, 0x2A, 0x12, 0xF2, 0x23, 0x8C, 0x12,
+    0xCD, 0x02, 0xAB, 0x0A, 0x6B, 0x02, 0xF4, 0x0B, 0xAC, 0x0A, 0xEE, 0x1A, 0x76, 0x15, 0x93, 0x0C, 0xFF, 0xFF, 0x12, 0x14, 0x2F, 0x0B, 0x54, 0x0C, 0x9A, 0x05, 0xFF, 0xFF, 0x11, 0x26, 0x8F, 0x03, 0x90, 0x03, 0x39, 0x16, 0xFF, 0xFF, 0x10, 0x04, 0x91, 0x03, 0x10, 0x03, 0xD4, 0x1C, 0x92, 0x03, 0xFF, 0x3E, 0x53, 0x03, 0x11, 0x03, 0x11, 0x03, 0x11, 0x03, 0xB8, 0x04, 0x11, 0x03, 0x10, 0x03,
+    0x92, 0x03, 0x13, 0x04, 0x39, 0x05, 0xF1, 0x02, 0xFF, 0x57, 0x34, 0x03, 0x94, 0x03, 0x1A, 0x05, 0xFD, 0x05, 0xFF, 0x8F, 0x92, 0x03, 0xF1, 0x03, 0xF9, 0x06, 0x90, 0x03, 0x17, 0x05, 0xAE, 0x02, 0xEF, 0x0A, 0xB3, 0x03, 0x6E, 0x02, 0x4C, 0x02, 0x75, 0x04, 0x6D, 0x02, 0x4D, 0x02, 0x52, 0x03, 0x6C, 0x0A, 0x6C, 0x02, 0x92, 0x03, 0x2C, 0x02, 0xEF, 0x02, 0x4C, 0x02, 0x2B, 0x02, 0x4B, 0x02,
+    0x11, 0x13, 0xA7, 0x09, 0x67, 0x09, 0xA8, 0x11, 0xC8, 0x11, 0x0F, 0x13, 0x09, 0x12, 0xE9, 0x19, 0xE9, 0x11, 0x4A, 0x1A, 0xEA, 0x09, 0x5A, 0x04, 0x0A, 0x12, 0x2A, 0x0A, 0x4A, 0x12, 0x2A, 0x0A, 0x12, 0x1C, 0xFF, 0x7F, 0x8C, 0x02, 0xAD, 0x0A, 0x8C, 0x0A, 0x6F, 0x0B, 0xF8, 0x15, 0x73, 0x0C, 0x12, 0x04, 0xB0, 0x0B, 0x4F, 0x1B, 0x95, 0x1C, 0x5B, 0x27, 0xB0, 0x0C, 0xAE, 0x04, 0x70, 0x0B,
+    0xD0, 0x0B, 0xF8, 0x05, 0xAF, 0x03, 0x90, 0x03, 0x51, 0x03, 0x71, 0x03, 0xD3, 0x0B, 0xF9, 0x0C, 0xFE, 0x1C, 0x33, 0x03, 0xD1, 0x02, 0xF1, 0x02, 0x3F, 0x26, 0x77, 0x0C, 0x51, 0x03, 0x72, 0x03, 0x13, 0x04, 0xF5, 0x04, 0xBE, 0x05, 0x74, 0x03, 0xB4, 0x03, 0xD4, 0x02, 0x74, 0x03, 0x35, 0x03, 0x7E, 0x06, 0xFD, 0x16, 0x53, 0x04, 0x11, 0x06, 0x11, 0x06, 0xF0, 0x03, 0x1B, 0x0F, 0x70, 0x03,
+    0xAE, 0x02, 0xAE, 0x02, 0x6D, 0x02, 0x4D, 0x02, 0xCE, 0x02, 0x6D, 0x02, 0x4D, 0x02, 0x4C, 0x02, 0x6D, 0x0A, 0x6D, 0x0A, 0x6D, 0x02, 0x4C, 0x02, 0x6C, 0x0A, 0x2B, 0x02, 0x4C, 0x02, 0x6D, 0x02, 0x87, 0x09, 0x46, 0x11, 0x67, 0x09, 0x88, 0x09, 0xC9, 0x11, 0x2A, 0x1A, 0xC9, 0x09, 0xE9, 0x11, 0x09, 0x12, 0x09, 0x12, 0xE9, 0x09, 0x54, 0x2C, 0x2A, 0x12, 0x2A, 0x12, 0x4B, 0x0A, 0x6B, 0x12,
+    0xCD, 0x0A, 0xD4, 0x34, 0xAC, 0x0A, 0x8C, 0x0A, 0xEF, 0x02, 0x8C, 0x02, 0x0E, 0x0B, 0x2E, 0x03, 0x2F, 0x0B, 0xF5, 0x14, 0x2D, 0x33, 0xFF, 0xFF, 0x95, 0x25, 0x6F, 0x03, 0xF5, 0x1D, 0xEF, 0x02, 0x30, 0x03, 0x96, 0x35, 0x71, 0x03, 0x71, 0x03, 0x51, 0x03, 0x72, 0x03, 0xB3, 0x03, 0x5C, 0x02, 0xFF, 0xFF, 0xF5, 0x02, 0xD1, 0x02, 0x31, 0x03, 0x31, 0x03, 0xB4, 0x03, 0xB3, 0x0B, 0x11, 0x03,
+    0xD2, 0x03, 0x15, 0x04, 0x73, 0x03, 0x12, 0x03, 0xDB, 0x02, 0x54, 0x03, 0xF6, 0x03, 0x9F, 0x15, 0xBD, 0x04, 0xF7, 0x03, 0x54, 0x04, 0xFF, 0xCF, 0xFF, 0xF7, 0xD1, 0x0C, 0x10, 0x03, 0xAE, 0x02, 0xEF, 0x02, 0x15, 0x25, 0x6D, 0x02, 0x51, 0x03, 0x6D, 0x02, 0x0F, 0x03, 0x4C, 0x02, 0x4C, 0x02, 0x8D, 0x02, 0x6D, 0x02, 0xCE, 0x0A, 0x0B, 0x02, 0x2B, 0x02, 0x6C, 0x02, 0xEE, 0x0A, 0x4B, 0x02,
+    0xC8, 0x11, 0xA8, 0x19, 0x0F, 0x1B, 0xE8, 0x11, 0xA8, 0x09, 0xC8, 0x11, 0xE9, 0x09, 0xB2, 0x23, 0xEA, 0x11, 0x2A, 0x12, 0xAC, 0x22, 0x4E, 0x1B, 0x2F, 0x1B, 0x8C, 0x12, 0x6B, 0x12, 0x4B, 0x0A, 0x34, 0x24, 0x93, 0x3D, 0x10, 0x03, 0x8E, 0x02, 0xCE, 0x02, 0x4C, 0x02, 0x90, 0x13, 0x3B, 0x1E, 0x10, 0x0B, 0x74, 0x0C, 0x4F, 0x03, 0x53, 0x25, 0x51, 0x03, 0xF2, 0x03, 0xD1, 0x03, 0x13, 0x03,
+    0x72, 0x03, 0xFF, 0x03, 0xDA, 0x0D, 0x12, 0x04, 0x94, 0x04, 0xF7, 0x14, 0x31, 0x03, 0xFC, 0x04, 0x7F, 0x27, 0x76, 0x03, 0xF0, 0x02, 0x92, 0x03, 0x9A, 0x2D, 0xFF, 0x5F, 0x71, 0x03, 0xBE, 0x77, 0x72, 0x03, 0x38, 0x04, 0x3C, 0x05, 0x53, 0x03, 0xFA, 0x03, 0x75, 0x03, 0x58, 0x0C, 0xFF, 0xCF, 0xFF, 0x97, 0xF7, 0x03, 0xBC, 0x1E, 0xD3, 0x0E, 0xB2, 0x04, 0xBB, 0x05, 0xF0, 0x02, 0x10, 0x03,
+    0x30, 0x03, 0x50, 0x03, 0x18, 0x1D, 0xB2, 0x03, 0x6D, 0x02, 0xF3, 0x13, 0x4D, 0x02, 0x8D, 0x02, 0x11, 0x03, 0x6D, 0x02, 0x30, 0x13, 0x6D, 0x02, 0x2B, 0x02, 0x70, 0x0B, 0xCE, 0x02, 0x8C, 0x0A, 0xA8, 0x11, 0x87, 0x11, 0xA8, 0x11, 0xA8, 0x11, 0xC8, 0x01, 0xA8, 0x09, 0xA8, 0x01, 0xE9, 0x09, 0xA9, 0x01, 0xAE, 0x23, 0xF1, 0x33, 0x8F, 0x33, 0xE9, 0x09, 0x13, 0x24, 0x2B, 0x0A, 0x6B, 0x0A,
+    0xAC, 0x02, 0x10, 0x0B, 0xEF, 0x0A, 0xAE, 0x12, 0x8D, 0x0A, 0x8E, 0x12, 0xEF, 0x12, 0x71, 0x13, 0x71, 0x13, 0x0F, 0x0B, 0x10, 0x03, 0x2F, 0x0B, 0x50, 0x0B, 0x12, 0x03, 0xB8, 0x0B, 0x11, 0x03, 0x10, 0x03, 0xB5, 0x0B, 0xFB, 0x25, 0xFF, 0xF7, 0x15, 0x05, 0x51, 0x03, 0x52, 0x03, 0xF5, 0x02, 0xFF, 0xFF, 0x79, 0x0B, 0xD2, 0x02, 0x71, 0x03, 0xD1, 0x03, 0xF3, 0x04, 0x71, 0x03, 0x5E, 0x87,
+    0xB3, 0x03, 0xDE, 0x7F, 0x5E, 0x0D, 0x94, 0x03, 0xFF, 0x67, 0xD6, 0x0B, 0xFF, 0x26, 0x7D, 0x0D, 0x59, 0x06, 0x94, 0x03, 0xB3, 0x03, 0x17, 0x05, 0x91, 0x03, 0x11, 0x03, 0xD0, 0x02, 0x10, 0x03, 0xD0, 0x02, 0x90, 0x02, 0x33, 0x03, 0x6E, 0x02, 0x93, 0x03, 0x8E, 0x02, 0x4D, 0x02, 0x6D, 0x02, 0x6D, 0x02, 0x51, 0x03, 0x6C, 0x02, 0x6C, 0x02, 0x4C, 0x02, 0x4C, 0x02, 0x8D, 0x02, 0x8D, 0x02,
+    0xA8, 0x11, 0x87, 0x11, 0x87, 0x09, 0xA8, 0x09, 0x0E, 0x1B, 0x09, 0x12, 0xC8, 0x09, 0x09, 0x12, 0xEA, 0x09, 0xD3, 0x2B, 0x2B, 0x12, 0xCD, 0x1A, 0x8D, 0x0A, 0x9B, 0x36, 0x51, 0x13, 0x4C, 0x12, 0x0F, 0x13, 0xF2, 0x13, 0xCE, 0x02, 0xB4, 0x0B, 0x8E, 0x12, 0xAE, 0x0A, 0x76, 0x0C, 0x51, 0x13, 0xFF, 0xFF, 0x6F, 0x0B, 0xD3, 0x0B, 0x10, 0x03, 0x31, 0x0B, 0x5B, 0x15, 0x77, 0x03, 0x77, 0x04,
+    0x79, 0x2D, 0x33, 0x03, 0x3D, 0x0E, 0xFF, 0x77, 0x34, 0x04, 0x51, 0x03, 0x93, 0x0B, 0x7A, 0x04, 0xDF, 0x37, 0x55, 0x03, 0xF1, 0x02, 0x18, 0x35, 0x75, 0x1C, 0x7C, 0x05, 0x72, 0x03, 0x32, 0x03, 0xB5, 0x03, 0x7E, 0x26, 0x5E, 0x06, 0x94, 0x03, 0x54, 0x03, 0x79, 0x1E, 0x38, 0x04, 0xFF, 0xCF, 0x36, 0x04, 0x53, 0x03, 0xB4, 0x03, 0x52, 0x03, 0xDE, 0x05, 0xF1, 0x02, 0xD0, 0x02, 0xF0, 0x02,
+    0x91, 0x02, 0xF9, 0x0B, 0xB2, 0x02, 0x4E, 0x02, 0xAF, 0x02, 0xAF, 0x02, 0x2F, 0x02, 0xF7, 0x03, 0x6D, 0x02, 0x8E, 0x02, 0x6D, 0x02, 0x4D, 0x02, 0x52, 0x03, 0xAD, 0x0A, 0xCE, 0x02, 0xAD, 0x02, 0xEE, 0x22, 0xC7, 0x11, 0x87, 0x11, 0xC9, 0x11, 0xE9, 0x09, 0x0E, 0x1B, 0x0A, 0x0A, 0x09, 0x12, 0x0A, 0x12, 0x96, 0x66, 0x74, 0x2C, 0xB3, 0x1B, 0xCD, 0x1A, 0x4B, 0x0A, 0x4C, 0x02, 0x35, 0x24,
+    0x13, 0x1C, 0x0F, 0x0B, 0xCE, 0x02, 0xB8, 0x1C, 0xD2, 0x13, 0xCF, 0x02, 0xD4, 0x14, 0x30, 0x0B, 0x3D, 0x2E, 0x58, 0x04, 0x32, 0x0B, 0x93, 0x03, 0x31, 0x03, 0xD5, 0x03, 0x59, 0x02, 0x91, 0x02, 0x72, 0x0B, 0x79, 0x15, 0xFF, 0xA7, 0xB2, 0x03, 0x51, 0x03, 0xD0, 0x02, 0xF4, 0x13, 0x33, 0x03, 0x3A, 0x1D, 0x97, 0x1C, 0xD0, 0x02, 0x31, 0x03, 0x31, 0x03, 0x9A, 0x03, 0x35, 0x0C, 0x33, 0x03,
+    0x1A, 0x04, 0xFF, 0xFF, 0x3E, 0x16, 0xF7, 0x0B, 0x53, 0x03, 0x17, 0x0C, 0x16, 0x04, 0x18, 0x05, 0xBF, 0x06, 0xD4, 0x03, 0x17, 0x04, 0xF5, 0x02, 0xDF, 0x1E, 0xD2, 0x02, 0x3B, 0x05, 0xB3, 0x02, 0x17, 0x02, 0x7D, 0x0B, 0x56, 0x0B, 0x94, 0x03, 0xB7, 0x04, 0xAF, 0x02, 0x4E, 0x02, 0x8E, 0x02, 0x4D, 0x02, 0xAF, 0x02, 0xD3, 0x03, 0x8D, 0x02, 0x6C, 0x02, 0xCE, 0x02, 0xAD, 0x02, 0xEF, 0x02,
+    0xD1, 0x33, 0xE8, 0x19, 0x87, 0x09, 0xC9, 0x11, 0xC9, 0x09, 0x6F, 0x1B, 0x2F, 0x23, 0x2B, 0x12, 0x4B, 0x1A, 0x0D, 0x23, 0x4C, 0x12, 0x94, 0x04, 0xCE, 0x2A, 0x8D, 0x1A, 0xAD, 0x1A, 0x4D, 0x0A, 0xF3, 0x2B, 0x78, 0x25, 0xCE, 0x02, 0x55, 0x1C, 0x8E, 0x02, 0x13, 0x14, 0xD8, 0x25, 0xF8, 0x14, 0x72, 0x13, 0xFB, 0x0C, 0x72, 0x13, 0x3E, 0x05, 0x1E, 0x16, 0x52, 0x03, 0x58, 0x04, 0xF1, 0x02,
+    0x51, 0x03, 0x59, 0x0D, 0xD3, 0x0B, 0x98, 0x1C, 0x77, 0x0C, 0xF0, 0x02, 0x52, 0x0B, 0xBA, 0x15, 0x36, 0x0C, 0xB3, 0x0B, 0xD0, 0x02, 0x11, 0x03, 0x1E, 0x26, 0x35, 0x04, 0x92, 0x03, 0x12, 0x03, 0x39, 0x0C, 0xFF, 0xF7, 0xFF, 0x3F, 0x35, 0x04, 0x33, 0x03, 0xD5, 0x03, 0xBF, 0x3F, 0xBF, 0x3F, 0xDF, 0x06, 0x39, 0x05, 0x97, 0x03, 0xFF, 0xC7, 0xDE, 0x01, 0xF3, 0x02, 0x9D, 0x05, 0x58, 0x04,
+    0xFF, 0xEF, 0xDD, 0x01, 0x96, 0x02, 0x70, 0x02, 0x8F, 0x02, 0x92, 0x02, 0x8D, 0x02, 0x31, 0x03, 0x8F, 0x02, 0x6D, 0x02, 0x51, 0x03, 0x6C, 0x02, 0x8D, 0x0A, 0xAE, 0x02, 0xAD, 0x02, 0xB2, 0x0B, 0xA8, 0x11, 0xA8, 0x11, 0x4B, 0x22, 0x0A, 0x1A, 0xC9, 0x09, 0xEA, 0x11, 0xD0, 0x3B, 0xF2, 0x1B, 0x0A, 0x12, 0xAC, 0x0A, 0x2B, 0x12, 0x0A, 0x02, 0x10, 0x1B, 0xAD, 0x12, 0x2C, 0x0A, 0x6D, 0x0A,
+    0xB2, 0x1B, 0xF0, 0x12, 0x8E, 0x0A, 0xD0, 0x0A, 0xF1, 0x02, 0x97, 0x14, 0x11, 0x0B, 0xB0, 0x0A, 0x74, 0x03, 0xDB, 0x04, 0xD3, 0x02, 0xDB, 0x02, 0xFF, 0xFF, 0xB3, 0x02, 0x38, 0x04, 0xD0, 0x02, 0x53, 0x03, 0xF1, 0x02, 0x90, 0x02, 0xCF, 0x02, 0xD9, 0x04, 0x31, 0x0B, 0x53, 0x1C, 0x73, 0x0B, 0x9A, 0x0D, 0x92, 0x03, 0xF0, 0x02, 0x52, 0x0B, 0x31, 0x03, 0x35, 0x25, 0x71, 0x03, 0x32, 0x03,
+    0x15, 0x04, 0xBE, 0x1F, 0x9A, 0x05, 0x39, 0x0D, 0x95, 0x03, 0x3E, 0x16, 0xFF, 0x27, 0xFF, 0x17, 0xDE, 0x06, 0xBE, 0x06, 0x3A, 0x04, 0xFF, 0x15, 0x35, 0x03, 0x7F, 0x0E, 0x34, 0x03, 0xD5, 0x02, 0xDF, 0x14, 0x37, 0x02, 0xF8, 0x02, 0xD0, 0x02, 0x6E, 0x02, 0x8F, 0x02, 0xF2, 0x02, 0x6E, 0x02, 0xD5, 0x03, 0xD0, 0x02, 0x8D, 0x02, 0xAE, 0x02, 0xAE, 0x02, 0xAF, 0x02, 0xF4, 0x0B, 0xCF, 0x02,
+    0xC8, 0x11, 0xA8, 0x11, 0x2E, 0x23, 0x4B, 0x12, 0xC9, 0x01, 0xE9, 0x11, 0x2A, 0x12, 0xAD, 0x0A, 0x91, 0x13, 0x4B, 0x0A, 0x2B, 0x12, 0x2B, 0x0A, 0xEE, 0x1A, 0xF8, 0x14, 0x4C, 0x0A, 0x6D, 0x0A, 0x30, 0x13, 0x97, 0x1C, 0x98, 0x0C, 0xCF, 0x02, 0xD3, 0x13, 0x11, 0x0B, 0xB9, 0x1C, 0xBA, 0x15, 0x35, 0x03, 0x33, 0x03, 0xFC, 0x04, 0xFC, 0x14, 0x99, 0x03, 0xFF, 0x97, 0x32, 0x03, 0xBC, 0x0C,
+    0xB4, 0x0B, 0x73, 0x13, 0x7A, 0x1D, 0x1A, 0x1D, 0x32, 0x03, 0x8F, 0x02, 0x11, 0x0B, 0xD8, 0x34, 0xD9, 0x14, 0x94, 0x14, 0xF0, 0x02, 0x50, 0x03, 0x13, 0x04, 0x3B, 0x26, 0x11, 0x03, 0x32, 0x03, 0xB5, 0x0D, 0x3E, 0x0F, 0x9F, 0x06, 0xD8, 0x04, 0x55, 0x03, 0xF7, 0x03, 0x9F, 0x06, 0xFF, 0xE7, 0xDF, 0x07, 0xFF, 0xAF, 0xF8, 0x03, 0xF9, 0x04, 0xD5, 0x04, 0x5E, 0x06, 0x96, 0x04, 0x9E, 0x1D,
+    0x93, 0x02, 0x14, 0x03, 0xD6, 0x03, 0x8F, 0x02, 0x15, 0x04, 0x6E, 0x02, 0x8F, 0x02, 0x8F, 0x02, 0x53, 0x03, 0xF4, 0x0B, 0x71, 0x02, 0x8E, 0x02, 0x6E, 0x02, 0xB3, 0x03, 0x31, 0x03, 0xCF, 0x02, 0xA8, 0x11, 0x09, 0x1A, 0xA7, 0x11, 0xC9, 0x11, 0x0B, 0x02, 0x4B, 0x1A, 0xE9, 0x09, 0x6F, 0x23, 0x4B, 0x12, 0xAE, 0x12, 0x2C, 0x12, 0x0B, 0x02, 0x2C, 0x12, 0x92, 0x13, 0x6C, 0x12, 0x6D, 0x0A,
+    0xAE, 0x0A, 0xB2, 0x13, 0xB0, 0x0A, 0x11, 0x0B, 0xF1, 0x0A, 0x31, 0x04, 0xB4, 0x03, 0x12, 0x03, 0xF3, 0x02, 0xDF, 0x87, 0xF3, 0x02, 0x53, 0x03, 0xF2, 0x02, 0x16, 0x0C, 0x93, 0x03, 0x38, 0x04, 0x93, 0x0B, 0x55, 0x0B, 0x32, 0x0B, 0x32, 0x03, 0xF2, 0x02, 0x91, 0x02, 0x54, 0x1C, 0xF1, 0x0A, 0x97, 0x2C, 0x13, 0x04, 0x10, 0x03, 0x31, 0x03, 0xFA, 0x45, 0x52, 0x03, 0x11, 0x03, 0xB3, 0x0B,
+    0x38, 0x1E, 0xB8, 0x04, 0xDD, 0x03, 0xF7, 0x03, 0x99, 0x03, 0xB7, 0x03, 0x3B, 0x04, 0xFF, 0xF7, 0x3F, 0x06, 0xFF, 0x87, 0xD7, 0x03, 0x75, 0x04, 0xFF, 0xFF, 0x38, 0x05, 0x76, 0x0C, 0x37, 0x0D, 0xD1, 0x02, 0xB7, 0x03, 0xB0, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0xD0, 0x02, 0x9A, 0x24, 0xF0, 0x02, 0x71, 0x13, 0xCF, 0x02, 0xB3, 0x13, 0xAE, 0x02, 0x93, 0x03, 0xAE, 0x02, 0xEF, 0x02, 0xCF, 0x02,
+    0x4E, 0x2B, 0x09, 0x1A, 0xA7, 0x11, 0xE9, 0x11, 0xCD, 0x1A, 0x90, 0x2C, 0xAC, 0x32, 0x90, 0x23, 0x2B, 0x12, 0xCE, 0x12, 0x55, 0x24, 0xAF, 0x12, 0x4C, 0x0A, 0x6D, 0x02, 0x30, 0x0B, 0x76, 0x04, 0x8E, 0x0A, 0x32, 0x03, 0x72, 0x0B, 0x9F, 0x1E, 0xD8, 0x03, 0x11, 0x03, 0x11, 0x03, 0x5D, 0x05, 0x9F, 0x05, 0xF8, 0x02, 0xF4, 0x02, 0x3E, 0x05, 0x52, 0x03, 0x5D, 0x05, 0x33, 0x03, 0x19, 0x14,
+    0x13, 0x03, 0x1C, 0x3E, 0xFE, 0x55, 0x75, 0x13, 0x7A, 0x0C, 0xB6, 0x03, 0x11, 0x03, 0x13, 0x03, 0xF9, 0x0C, 0x14, 0x04, 0xF1, 0x02, 0x93, 0x03, 0x72, 0x0B, 0x9D, 0x0E, 0x52, 0x03, 0x32, 0x03, 0xF5, 0x03, 0x7D, 0x05, 0xBF, 0x1F, 0x78, 0x03, 0xFF, 0xFF, 0x3E, 0x0F, 0xFD, 0x1D, 0xFF, 0x4F, 0x1F, 0x06, 0x38, 0x04, 0x9F, 0x0E, 0x33, 0x04, 0xFF, 0xCF, 0xDF, 0x37, 0x16, 0x04, 0x72, 0x03,
+    0x93, 0x03, 0x5F, 0x15, 0x73, 0x03, 0x76, 0x0C, 0x31, 0x03, 0x8E, 0x02, 0x56, 0x04, 0x51, 0x03, 0xAE, 0x02, 0x8E, 0x02, 0x6D, 0x02, 0x73, 0x0B, 0x0F, 0x03, 0xCE, 0x02, 0xCF, 0x02, 0xEF, 0x02, 0xA7, 0x11, 0xC8, 0x19, 0x0E, 0x2B, 0xC9, 0x11, 0x56, 0x55, 0x12, 0x2C, 0x4E, 0x23, 0x74, 0x23, 0x2B, 0x12, 0xCD, 0x12, 0xAD, 0x0A, 0xCE, 0x0A, 0x4D, 0x0A, 0x2F, 0x0B, 0x6D, 0x12, 0x30, 0x13,
+    0x10, 0x03, 0xB4, 0x13, 0x11, 0x03, 0x58, 0x04, 0x78, 0x05, 0x54, 0x03, 0xF7, 0x0C, 0x59, 0x0C, 0x7D, 0x04, 0xFF, 0xFF, 0x3C, 0x03, 0xFB, 0x47, 0x33, 0x05, 0xF4, 0x03, 0x1F, 0x1E, 0x37, 0x14, 0x56, 0x03, 0x9B, 0x15, 0x75, 0x63, 0x18, 0x6C, 0xFF, 0xFF, 0xD8, 0x03, 0x33, 0x03, 0x93, 0x0B, 0x75, 0x03, 0x35, 0x04, 0x12, 0x03, 0x34, 0x0C, 0xFF, 0xE7, 0xBE, 0x8F, 0x73, 0x03, 0x73, 0x03,
+    0x58, 0x0D, 0xFF, 0x7F, 0xFF, 0x05, 0x77, 0x03, 0xFF, 0x5F, 0x1F, 0x06, 0xFF, 0xFF, 0x3F, 0x05, 0x7F, 0x06, 0x95, 0x03, 0xD5, 0x03, 0xFF, 0x8F, 0x54, 0x04, 0x34, 0x04, 0x7B, 0x05, 0x92, 0x03, 0xDC, 0x05, 0x93, 0x13, 0xB0, 0x02, 0x35, 0x03, 0xF9, 0x04, 0x16, 0x04, 0x10, 0x03, 0xCF, 0x02, 0xAE, 0x02, 0xF4, 0x03, 0x76, 0x04, 0x31, 0x13, 0xCE, 0x02, 0xCE, 0x02, 0xEF, 0x02, 0xF4, 0x03,
+    0x4E, 0x2B, 0xE9, 0x21, 0xA8, 0x19, 0xA9, 0x09, 0xB1, 0x23, 0x2B, 0x12, 0x50, 0x0B, 0x8D, 0x0A, 0xEF, 0x22, 0x8D, 0x12, 0x0F, 0x03, 0xD5, 0x2C, 0x0F, 0x03, 0x51, 0x0B, 0x6D, 0x12, 0xEF, 0x12, 0x91, 0x1B, 0xFC, 0x0D, 0x53, 0x03, 0x98, 0x04, 0xFF, 0x57, 0xD7, 0x0C, 0xFC, 0x1D, 0xF7, 0x03, 0xBF, 0x5F, 0xBF, 0x4F, 0xFB, 0x02, 0x35, 0x0D, 0xFF, 0x87, 0x53, 0x05, 0x3F, 0x05, 0x9C, 0x14,
+    0x55, 0x03, 0x9E, 0x2E, 0x3C, 0x1B, 0xBD, 0x4C, 0xDC, 0x03, 0x37, 0x03, 0x53, 0x03, 0x5B, 0x05, 0x3E, 0x2F, 0x1C, 0x27, 0x92, 0x03, 0xB9, 0x25, 0xFF, 0x87, 0x79, 0x1D, 0x93, 0x03, 0x13, 0x03, 0xD7, 0x03, 0xFB, 0x0B, 0x3D, 0x07, 0x79, 0x04, 0x35, 0x03, 0xD8, 0x03, 0xFF, 0xC7, 0xBB, 0x04, 0x5F, 0x07, 0xFE, 0x25, 0x74, 0x03, 0xD9, 0x0C, 0x93, 0x03, 0x36, 0x0C, 0x33, 0x04, 0xB4, 0x0D,
+    0x53, 0x04, 0x71, 0x03, 0xF0, 0x02, 0xD3, 0x03, 0x6E, 0x02, 0x2D, 0x02, 0x8E, 0x02, 0x8E, 0x02, 0x8E, 0x02, 0xF3, 0x03, 0xCE, 0x02, 0xAE, 0x02, 0xAE, 0x02, 0xCE, 0x02, 0x10, 0x03, 0xEF, 0x02, 0xC8, 0x11, 0xE9, 0x11, 0x50, 0x23, 0x2B, 0x12, 0x4C, 0x02, 0x0B, 0x1A, 0x2F, 0x23, 0x30, 0x13, 0xCF, 0x0A, 0x2F, 0x0B, 0x10, 0x13, 0xEF, 0x1A, 0x4F, 0x02, 0x35, 0x0C, 0x6D, 0x12, 0xF8, 0x34,
+    0xD2, 0x02, 0xF7, 0x14, 0x9F, 0x1E, 0xB6, 0x03, 0xB5, 0x03, 0xB8, 0x0C, 0x7C, 0x04, 0x57, 0x04, 0x56, 0x03, 0xFE, 0x14, 0x7F, 0x0D, 0xF6, 0x04, 0xFF, 0x97, 0xBD, 0xA7, 0x18, 0x04, 0xFF, 0xFF, 0x37, 0x04, 0x5B, 0x14, 0xDF, 0x25, 0x1F, 0x47, 0xF8, 0x03, 0xB6, 0x03, 0x33, 0x03, 0xBC, 0x1D, 0x7E, 0x16, 0x5B, 0x26, 0x53, 0x03, 0xD9, 0x36, 0xFF, 0xFF, 0x59, 0x3F, 0x73, 0x03, 0xF2, 0x02,
+    0x5C, 0x1D, 0x1E, 0x06, 0xBF, 0x05, 0x39, 0x04, 0x98, 0x03, 0xD8, 0x03, 0x1B, 0x05, 0xFF, 0x37, 0xD7, 0x03, 0xB8, 0x04, 0xFF, 0x37, 0x55, 0x03, 0xD4, 0x03, 0xBD, 0x05, 0xD5, 0x04, 0xFF, 0xFF, 0x36, 0x1D, 0x71, 0x03, 0x1A, 0x05, 0x10, 0x03, 0x56, 0x0C, 0x8E, 0x02, 0x50, 0x0B, 0xF0, 0x02, 0x56, 0x04, 0x0F, 0x03, 0xAE, 0x02, 0xCF, 0x02, 0xCF, 0x02, 0xBA, 0x0C, 0x50, 0x03, 0xEF, 0x02,
+    0xC9, 0x19, 0xE9, 0x19, 0xA8, 0x11, 0x4F, 0x1B, 0x6C, 0x12, 0xEA, 0x11, 0xAD, 0x12, 0x4B, 0x12, 0xAD, 0x12, 0x0B, 0x0A, 0x30, 0x1B, 0xF0, 0x12, 0x4C, 0x02, 0x75, 0x1C, 0x51, 0x23, 0x31, 0x13, 0x10, 0x0B, 0x34, 0x24, 0x15, 0x04, 0x16, 0x04, 0x77, 0x0C, 0x15, 0x1E, 0x16, 0x04, 0xD6, 0x03, 0xF1, 0x02, 0x56, 0x0C, 0x53, 0x03, 0xD7, 0x04, 0x34, 0x16, 0xFF, 0x67, 0x53, 0x04, 0x1C, 0x05,
+    0x17, 0x15, 0x5D, 0x3E, 0x9E, 0x2E, 0xB8, 0x1C, 0x35, 0x14, 0xB7, 0x04, 0x14, 0x03, 0x71, 0x03, 0x7E, 0x1E, 0xFF, 0xC7, 0x35, 0x14, 0x57, 0x0D, 0xF8, 0x0E, 0xF6, 0x05, 0x53, 0x03, 0x17, 0x14, 0x9F, 0x26, 0xBF, 0x05, 0x9E, 0x02, 0xDE, 0x1C, 0xFF, 0xF7, 0xBE, 0x0D, 0x19, 0x03, 0xBD, 0x04, 0x59, 0x04, 0xBB, 0x16, 0xFF, 0xFF, 0x14, 0x04, 0x35, 0x04, 0x72, 0x03, 0x9A, 0x15, 0x52, 0x03,
+    0x34, 0x0C, 0x11, 0x03, 0x51, 0x03, 0xAF, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x72, 0x0B, 0xB3, 0x03, 0xEF, 0x02, 0xCF, 0x02, 0xCF, 0x02, 0xCF, 0x02, 0x30, 0x03, 0xEF, 0x02, 0x50, 0x0B, 0x31, 0x03, 0x2F, 0x33, 0x2A, 0x1A, 0xC9, 0x11, 0xC9, 0x11, 0xAE, 0x12, 0xF2, 0x2B, 0xAD, 0x1A, 0x4B, 0x12, 0x6C, 0x12, 0x6E, 0x0A, 0x76, 0x35, 0x4D, 0x0A, 0x0F, 0x0B, 0xB5, 0x13, 0xAE, 0x0A, 0xBE, 0x57,
+    0x51, 0x13, 0xB2, 0x13, 0x92, 0x0B, 0xFF, 0xF7, 0xFF, 0x57, 0xB6, 0x04, 0x76, 0x0C, 0xB8, 0x0C, 0x7E, 0x05, 0x79, 0x15, 0x3B, 0x27, 0x95, 0x04, 0xF3, 0x03, 0x1D, 0x16, 0xDD, 0x2F, 0xDD, 0x2E, 0x76, 0x14, 0xBC, 0x35, 0xFC, 0x25, 0xF7, 0x1C, 0xF2, 0x02, 0x56, 0x04, 0x53, 0x0B, 0x16, 0x44, 0x33, 0x23, 0xBA, 0x1C, 0xF2, 0x02, 0x99, 0x04, 0x1C, 0x05, 0x38, 0x04, 0xF3, 0x02, 0xD3, 0x02,
+    0xFF, 0x5F, 0x1F, 0x05, 0xFF, 0xDF, 0xBF, 0x0C, 0xFF, 0xFF, 0xFF, 0x2D, 0x9E, 0x03, 0xFE, 0x77, 0xF6, 0x13, 0x39, 0x0D, 0xF6, 0x0C, 0x57, 0x04, 0x17, 0x04, 0x32, 0x03, 0x73, 0x03, 0x35, 0x14, 0x72, 0x03, 0x97, 0x04, 0x10, 0x03, 0xAF, 0x02, 0xAF, 0x02, 0xCF, 0x02, 0x14, 0x03, 0x10, 0x03, 0xAE, 0x02, 0xEF, 0x02, 0xCF, 0x02, 0x15, 0x04, 0xEF, 0x02, 0xEF, 0x02, 0xEF, 0x02, 0x30, 0x03,
+    0xE9, 0x19, 0xC8, 0x19, 0x2F, 0x2B, 0x0A, 0x1A, 0xF1, 0x33, 0x0A, 0x1A, 0x2B, 0x0A, 0x0E, 0x1B, 0x4E, 0x1B, 0x6B, 0x12, 0xCE, 0x02, 0x8D, 0x12, 0xF1, 0x0B, 0xF3, 0x23, 0xAD, 0x12, 0xAF, 0x02, 0xF7, 0x14, 0x71, 0x0B, 0x10, 0x0B, 0xF3, 0x03, 0x9F, 0x27, 0xBD, 0x15, 0x99, 0x25, 0x38, 0x25, 0x5A, 0x1D, 0xFF, 0xB7, 0xB3, 0x03, 0xFF, 0xFF, 0x9E, 0x47, 0xD6, 0x0C, 0x3E, 0x0E, 0xDE, 0x56,
+    0x97, 0x1C, 0xF8, 0x24, 0xBB, 0x4D, 0x19, 0x4E, 0xFF, 0x1D, 0xF6, 0x13, 0x93, 0x13, 0x13, 0x73, 0xBC, 0xEE, 0x3B, 0x1C, 0xB3, 0x02, 0xB7, 0x03, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0x59, 0x04, 0xDF, 0x0D, 0x18, 0x03, 0x7C, 0x0C, 0xF9, 0x0B, 0x7D, 0x24, 0xFF, 0xCF, 0xDB, 0x03, 0x35, 0x03, 0x3B, 0x05, 0x94, 0x03, 0x9E, 0x0D, 0xD7, 0x03, 0x57, 0x0C, 0x97, 0x1C, 0xF5, 0x13,
+    0x3C, 0x05, 0xF4, 0x03, 0x31, 0x03, 0x8F, 0x02, 0x8F, 0x02, 0x38, 0x04, 0xCF, 0x02, 0xCE, 0x02, 0xCE, 0x02, 0xEF, 0x02, 0xF4, 0x03, 0xCE, 0x02, 0xEE, 0x02, 0xEF, 0x02, 0x30, 0x03, 0xB2, 0x0B, 0x74, 0x44, 0x2A, 0x1A, 0xE9, 0x19, 0x6B, 0x1A, 0xB1, 0x3B, 0x33, 0x2C, 0x8C, 0x12, 0x6C, 0x12, 0x0B, 0x02, 0x4C, 0x12, 0x2F, 0x03, 0x36, 0x25, 0xF9, 0x3D, 0x70, 0x0B, 0xEE, 0x12, 0xF0, 0x02,
+    0x31, 0x0B, 0x36, 0x04, 0x30, 0x03, 0x5A, 0x2D, 0xD7, 0x14, 0xBA, 0x0D, 0x99, 0x1D, 0x39, 0x15, 0xB7, 0x0C, 0xFF, 0x4F, 0x34, 0x04, 0xD7, 0x1D, 0xD5, 0x04, 0xB5, 0x04, 0xB8, 0x04, 0x7C, 0x04, 0xB7, 0x24, 0x7A, 0x15, 0x9C, 0x4E, 0xBD, 0xB7, 0xF9, 0x2C, 0xD8, 0x03, 0x94, 0x03, 0x94, 0x3B, 0x9D, 0x5B, 0xBB, 0x13, 0xD3, 0x02, 0xF6, 0x03, 0x7D, 0x05, 0xF3, 0x02, 0xF4, 0x02, 0xD4, 0x02,
+    0x5B, 0x04, 0x9C, 0x0C, 0x1F, 0x06, 0xFD, 0x0B, 0x5C, 0x03, 0xF8, 0x02, 0x99, 0x03, 0xD6, 0x02, 0x7F, 0x05, 0xB7, 0x03, 0xBC, 0x03, 0xB9, 0x03, 0x56, 0x04, 0xF6, 0x03, 0x5C, 0x05, 0x5E, 0x1E, 0x55, 0x03, 0xD1, 0x02, 0xF1, 0x02, 0xB8, 0x05, 0xB4, 0x03, 0xD0, 0x02, 0xAF, 0x02, 0x10, 0x0B, 0x8E, 0x02, 0x56, 0x04, 0xCF, 0x02, 0xCF, 0x02, 0xEF, 0x02, 0x50, 0x0B, 0x30, 0x03, 0xB4, 0x03,
+    0x2B, 0x22, 0xC8, 0x19, 0x0A, 0x1A, 0x0A, 0x12, 0x0D, 0x13, 0x8C, 0x2A, 0x7D, 0x6F, 0x8C, 0x12, 0x8D, 0x12, 0x12, 0x24, 0x54, 0x1C, 0x32, 0x44, 0x50, 0x0C, 0xB2, 0x04, 0x0E, 0x13, 0x50, 0x13, 0x31, 0x13, 0x3A, 0x2E, 0x36, 0x2E, 0xF5, 0x1C, 0x9B, 0x2D, 0xF6, 0x24, 0xFF, 0x3F, 0x9A, 0x26, 0xB0, 0x03, 0x3B, 0x37, 0x9D, 0x37, 0x77, 0x0C, 0x55, 0x04, 0xBF, 0x57, 0xF8, 0x0C, 0xDF, 0x4F,
+    0x3A, 0x1D, 0x7D, 0x25, 0x18, 0x2D, 0x9F, 0x8F, 0xF1, 0x0A, 0x59, 0x0C, 0x12, 0x03, 0xFE, 0x25, 0xDF, 0x46, 0xD8, 0x04, 0xF3, 0x02, 0xBA, 0x14, 0x5D, 0x1D, 0x95, 0x03, 0x14, 0x03, 0xF4, 0x02, 0xBB, 0x05, 0xFF, 0x27, 0xDF, 0x9F, 0xFD, 0x03, 0xFF, 0xDF, 0xD7, 0x02, 0xBC, 0x0C, 0x19, 0x04, 0xFF, 0xF7, 0x98, 0x03, 0xFF, 0x4F, 0x3D, 0x15, 0x3C, 0x27, 0xFE, 0x47, 0xD5, 0x03, 0xDE, 0x0D,
+    0x33, 0x03, 0x90, 0x02, 0xF3, 0x02, 0x94, 0x03, 0xD0, 0x02, 0xD0, 0x02, 0xB0, 0x02, 0x33, 0x03, 0xD3, 0x03, 0xCF, 0x02, 0xAF, 0x02, 0xEF, 0x02, 0x71, 0x03, 0x50, 0x03, 0xB2, 0x0B, 0x71, 0x0B, 0xC9, 0x19, 0xE9, 0x19, 0x2A, 0x1A, 0xD3, 0x2B, 0x8B, 0x02, 0x2A, 0x22, 0x0E, 0x2B, 0x0D, 0x13, 0x54, 0x2C, 0x6C, 0x12, 0x7B, 0x67, 0xED, 0x1A, 0x13, 0x26, 0xFF, 0xFF, 0x6E, 0x13, 0xD6, 0x24,
+    0xF2, 0x1B, 0x90, 0x13, 0xFF, 0xFF, 0xFF, 0x4F, 0x39, 0x15, 0x75, 0x1C, 0xBC, 0x2D, 0x3A, 0x1D, 0xFD, 0x15, 0x36, 0x04, 0x7C, 0x0C, 0x5A, 0x0D, 0x55, 0x14, 0x9C, 0x1E, 0x9E, 0x5F, 0x3E, 0x26, 0x35, 0x1C, 0xFC, 0x1D, 0xDA, 0x15, 0x37, 0x55, 0x9E, 0x76, 0xDA, 0x24, 0x73, 0x03, 0xBE, 0x3E, 0xFE, 0x0D, 0x97, 0x04, 0x55, 0x03, 0xB7, 0x03, 0xDF, 0x37, 0xB4, 0x02, 0xB7, 0x03, 0x56, 0x03,
+    0x9C, 0x06, 0xFF, 0x17, 0xDE, 0x87, 0xFC, 0x03, 0x59, 0x03, 0xBB, 0x04, 0x7F, 0x05, 0xFF, 0xFF, 0xBC, 0x14, 0x7E, 0x0D, 0x99, 0x03, 0x57, 0x04, 0xFF, 0x0F, 0xD6, 0x04, 0xF6, 0x03, 0x12, 0x03, 0xF2, 0x02, 0x33, 0x03, 0x36, 0x04, 0x7A, 0x25, 0x8E, 0x02, 0x8F, 0x02, 0xAF, 0x02, 0x77, 0x04, 0x52, 0x0B, 0x8F, 0x02, 0xAF, 0x02, 0xCF, 0x02, 0x30, 0x03, 0xD3, 0x0B, 0xAE, 0x02, 0x71, 0x03,
+    0xAD, 0x2A, 0xC8, 0x19, 0xE8, 0x19, 0x2A, 0x1A, 0x0A, 0x12, 0x13, 0x44, 0x6C, 0x22, 0x6B, 0x12, 0x13, 0x44, 0x70, 0x2B, 0xB8, 0x55, 0x6C, 0x1A, 0xF0, 0x0B, 0xAF, 0x23, 0x2F, 0x23, 0x9C, 0xBE, 0x75, 0x24, 0x92, 0x23, 0x30, 0x03, 0x35, 0x04, 0xFF, 0x7F, 0x18, 0x25, 0x59, 0x2D, 0xD4, 0x0B, 0xBD, 0x1D, 0xF8, 0x24, 0x74, 0x0B, 0x35, 0x1C, 0xFF, 0x7F, 0xFF, 0x6F, 0x14, 0x14, 0xF8, 0x14,
+    0x17, 0x0C, 0xB9, 0x1C, 0xFF, 0x2E, 0x76, 0x14, 0xBF, 0x05, 0xDA, 0x03, 0x13, 0x03, 0x5F, 0x4E, 0x1F, 0x8F, 0xBA, 0x1B, 0x36, 0x03, 0x5C, 0x0C, 0xFF, 0xAF, 0x59, 0x03, 0xF5, 0x02, 0x76, 0x03, 0x7D, 0x06, 0xFF, 0x2E, 0xDE, 0x03, 0x7A, 0x03, 0x77, 0x03, 0x9C, 0x04, 0xDD, 0x04, 0xDE, 0x04, 0x19, 0x0C, 0xFF, 0xFF, 0xF9, 0x0B, 0xD6, 0x03, 0x9C, 0x05, 0x78, 0x04, 0x97, 0x0C, 0x12, 0x03,
+    0xD6, 0x0B, 0x78, 0x04, 0x90, 0x02, 0x31, 0x0B, 0x8F, 0x02, 0x73, 0x0B, 0x16, 0x04, 0x93, 0x0B, 0x30, 0x0B, 0xF0, 0x02, 0x10, 0x03, 0xF4, 0x03, 0x30, 0x03, 0x92, 0x0B, 0x10, 0x03, 0xB2, 0x03, 0xC9, 0x19, 0xE9, 0x19, 0x4F, 0x33, 0xEF, 0x2A, 0xD2, 0x33, 0x6B, 0x22, 0x4B, 0x1A, 0x91, 0x33, 0xB5, 0x4C, 0x8B, 0x0A, 0x1E, 0x87, 0xAD, 0x1A, 0x17, 0x3D, 0xB1, 0x2B, 0xCD, 0x22, 0x14, 0x34,
+    0xFB, 0xFF, 0x35, 0x24, 0xB6, 0x34, 0xB5, 0x13, 0xFF, 0xBF, 0xFF, 0xEF, 0x16, 0x14, 0x59, 0x35, 0x56, 0x14, 0xB7, 0x14, 0x11, 0x03, 0x15, 0x1C, 0x14, 0x0C, 0x18, 0x1D, 0x9B, 0x1D, 0x37, 0x14, 0x1C, 0x25, 0x1F, 0x3E, 0xD7, 0x25, 0xFF, 0xBF, 0x9F, 0x3E, 0xDE, 0x34, 0xD3, 0x02, 0x17, 0x03, 0x5E, 0x66, 0x7D, 0x2B, 0x36, 0x03, 0xBD, 0x03, 0x1E, 0x6F, 0x5E, 0x02, 0xF5, 0x02, 0x15, 0x03,
+    0xBF, 0x0D, 0x1F, 0x06, 0x99, 0x03, 0x56, 0x03, 0x9F, 0x0D, 0x55, 0x04, 0x5F, 0x17, 0xB9, 0x14, 0x3F, 0x0D, 0x56, 0x03, 0xD6, 0x0B, 0xD7, 0x03, 0x98, 0x0C, 0x16, 0x0C, 0x73, 0x03, 0xF2, 0x02, 0xFA, 0x04, 0x94, 0x0B, 0x73, 0x0B, 0x52, 0x0B, 0xB4, 0x03, 0x16, 0x04, 0x8F, 0x02, 0xD0, 0x02, 0xF0, 0x02, 0x31, 0x03, 0x72, 0x0B, 0xEF, 0x02, 0x30, 0x0B, 0x10, 0x03, 0x31, 0x03, 0xB1, 0x03,
+    0xA8, 0x11, 0x09, 0x1A, 0x2B, 0x22, 0x09, 0x1A, 0x12, 0x44, 0x0A, 0x22, 0x70, 0x2B, 0x0B, 0x12, 0x0F, 0x33, 0xB1, 0x33, 0x95, 0x3C, 0x70, 0x23, 0xD7, 0x4C, 0x92, 0x23, 0xAD, 0x12, 0x37, 0x45, 0x50, 0x13, 0x30, 0x23, 0x57, 0x1C, 0xB4, 0x1B, 0xBB, 0x1C, 0x79, 0x3C, 0xFF, 0xFF, 0x1D, 0x16, 0x10, 0x03, 0x16, 0x2D, 0xD9, 0x1D, 0x99, 0x24, 0x31, 0x03, 0x3A, 0x0D, 0xB9, 0x14, 0x9D, 0x1D,
+    0x56, 0x1C, 0x1F, 0x5F, 0x14, 0x0C, 0x9E, 0x1E, 0x34, 0x03, 0x5C, 0x25, 0x55, 0x0B, 0x56, 0x03, 0xFF, 0xFF, 0x19, 0x05, 0x35, 0x03, 0x39, 0x04, 0x59, 0x03, 0x17, 0x03, 0x15, 0x03, 0x15, 0x03, 0xBE, 0x05, 0x1F, 0x07, 0x56, 0x03, 0x55, 0x03, 0x3B, 0x05, 0xFF, 0xE7, 0xFC, 0x3F, 0xDE, 0x6F, 0xBB, 0x04, 0x75, 0x03, 0xBC, 0x05, 0x36, 0x04, 0xB4, 0x03, 0xB5, 0x0B, 0x52, 0x03, 0xB9, 0x04,
+    0xF6, 0x1B, 0xF1, 0x02, 0x73, 0x0B, 0x73, 0x03, 0x32, 0x03, 0x71, 0x03, 0xB0, 0x02, 0xAF, 0x02, 0xB3, 0x0B, 0xCF, 0x02, 0x10, 0x0B, 0xEF, 0x02, 0x50, 0x03, 0x0F, 0x03, 0x71, 0x03, 0x13, 0x04, 0x0F, 0x2B, 0x2A, 0x12, 0x4A, 0x1A, 0x09, 0x1A, 0xF1, 0x4B, 0x33, 0x44, 0xD6, 0x3C, 0x2B, 0x1A, 0x8C, 0x22, 0xD0, 0x33, 0xCC, 0x1A, 0x74, 0x2C, 0xF7, 0x4C, 0x8F, 0x1A, 0xAD, 0x1A, 0x13, 0x2C,
+    0xEF, 0x0A, 0x17, 0x25, 0xF4, 0x2B, 0xD7, 0x2C, 0xD3, 0x1B, 0x75, 0x3C, 0xFA, 0x2D, 0xDA, 0x15, 0xD5, 0x0B, 0x55, 0x1C, 0x10, 0x0B, 0x39, 0x15, 0xBF, 0x5F, 0x9C, 0x15, 0xFF, 0x77, 0x19, 0x15, 0xD4, 0x0B, 0x9B, 0x15, 0xDB, 0x85, 0x7B, 0x35, 0x12, 0x0B, 0xFE, 0xFF, 0x33, 0x1B, 0x5E, 0x16, 0xFF, 0xFF, 0xDE, 0xAF, 0xB6, 0x03, 0x3A, 0x1D, 0x7F, 0x05, 0xB7, 0x03, 0x14, 0x03, 0x55, 0x03,
+    0x78, 0x04, 0xBF, 0x05, 0x7F, 0x05, 0x75, 0x03, 0x37, 0x04, 0xFF, 0xEF, 0xD9, 0x0D, 0x1A, 0x06, 0x7D, 0x05, 0x38, 0x03, 0xB6, 0x03, 0x9B, 0x16, 0x32, 0x03, 0xFF, 0xBF, 0x99, 0x04, 0xB1, 0x02, 0xB4, 0x0B, 0xD0, 0x02, 0xF1, 0x02, 0xB9, 0x04, 0xAF, 0x02, 0x10, 0x03, 0x73, 0x13, 0x31, 0x03, 0xAF, 0x02, 0x16, 0x04, 0xD3, 0x1B, 0x51, 0x0B, 0x30, 0x03, 0x50, 0x03, 0xF4, 0x03, 0xF4, 0x03,
+    0xE8, 0x19, 0xE9, 0x19, 0x8C, 0x22, 0x76, 0x4D, 0x8F, 0x5B, 0x2A, 0x2A, 0xCD, 0x2A, 0x4B, 0x1A, 0xF2, 0x2B, 0x8F, 0x2B, 0x30, 0x2B, 0xCD, 0x2A, 0xB6, 0x4C, 0x35, 0x2C, 0x6D, 0x1A, 0x18, 0x5D, 0x33, 0x34, 0xAE, 0x22, 0x39, 0x2D, 0x11, 0x0B, 0xB6, 0x2C, 0x95, 0xE6, 0xB6, 0x2C, 0x34, 0x14, 0xF9, 0x1D, 0x75, 0x2C, 0x0F, 0x03, 0xF3, 0x1B, 0x7A, 0x1D, 0xFF, 0x67, 0x34, 0x0C, 0x35, 0x14,
+    0xD4, 0x0B, 0x14, 0x14, 0xDB, 0x0D, 0x93, 0x0B, 0xFF, 0xFF, 0xD9, 0x8C, 0x53, 0x3B, 0x1F, 0x06, 0xDE, 0x87, 0x76, 0x04, 0xD6, 0x03, 0x18, 0x04, 0x1F, 0x27, 0x19, 0x04, 0x34, 0x03, 0x55, 0x03, 0x59, 0x04, 0x58, 0x03, 0xFF, 0x4F, 0xD7, 0x03, 0x5E, 0x05, 0xFF, 0x87, 0xFB, 0x04, 0x5D, 0x05, 0x16, 0x03, 0xFF, 0xFF, 0xDA, 0x0B, 0xD2, 0x02, 0xFE, 0x16, 0x57, 0x04, 0x12, 0x03, 0xD1, 0x02,
+    0x12, 0x03, 0x16, 0x04, 0x78, 0x04, 0xD0, 0x02, 0x14, 0x1C, 0x72, 0x03, 0xAF, 0x02, 0x7E, 0x15, 0xEF, 0x02, 0x10, 0x0B, 0x10, 0x03, 0x30, 0x03, 0x30, 0x03, 0xB3, 0x03, 0x50, 0x03, 0xB2, 0x0B, 0xED, 0x3A, 0xE9, 0x19, 0x8F, 0x33, 0xE9, 0x21, 0x6B, 0x5A, 0x2F, 0x33, 0xD0, 0x43, 0x8C, 0x22, 0x0B, 0x22, 0xED, 0x22, 0xF0, 0x1A, 0xEE, 0x2A, 0x13, 0x44, 0x4D, 0x22, 0xCE, 0x12, 0x77, 0x35,
+    0xAD, 0x0A, 0x12, 0x34, 0x75, 0x44, 0xB3, 0x2B, 0xBC, 0x3D, 0xD2, 0x1B, 0x92, 0x1B, 0xD6, 0x34, 0xB5, 0x14, 0xB4, 0x25, 0xF1, 0x3B, 0xD6, 0x2C, 0x73, 0x1C, 0xFF, 0xF7, 0xF6, 0x15, 0x18, 0x25, 0x35, 0x14, 0x39, 0x25, 0xDE, 0x1E, 0x9A, 0x2D, 0x1D, 0x5F, 0x9D, 0x5E, 0x73, 0x1B, 0xDF, 0x2E, 0xF8, 0x0C, 0xDC, 0x1D, 0xF5, 0x03, 0x3D, 0x04, 0xFF, 0xFF, 0xBF, 0x04, 0x55, 0x03, 0xF7, 0x03,
+    0x1D, 0x16, 0xFF, 0x3F, 0xD7, 0x0B, 0xBA, 0x0C, 0x5C, 0x05, 0xDB, 0x14, 0x5E, 0x16, 0xB6, 0x03, 0xD9, 0x04, 0x9F, 0x25, 0x18, 0x04, 0xF7, 0x03, 0x39, 0x05, 0xF5, 0x03, 0xF0, 0x02, 0x77, 0x1C, 0xF4, 0x03, 0xB8, 0x04, 0x51, 0x0B, 0xF0, 0x02, 0xF4, 0x0B, 0xCF, 0x02, 0x76, 0x04, 0xEF, 0x02, 0xF0, 0x02, 0x30, 0x03, 0xAE, 0x02, 0xAF, 0x02, 0x72, 0x0B, 0x71, 0x0B, 0x50, 0x03, 0x30, 0x03,
+    0x47, 0x11, 0x09, 0x22, 0x90, 0x43, 0x4F, 0x43, 0xA9, 0x09, 0x49, 0x2A, 0x51, 0x5C, 0xF3, 0x43, 0xAC, 0x32, 0x12, 0x4C, 0xED, 0x32, 0x90, 0x43, 0x30, 0x23, 0xEE, 0x32, 0x4B, 0x12, 0x4F, 0x2B, 0xB5, 0x34, 0xCE, 0x1A, 0x33, 0x3C, 0xF2, 0x23, 0xF2, 0x1C, 0x76, 0x2C, 0x11, 0x24, 0x15, 0x46, 0xB1, 0x13, 0x11, 0x0C, 0xFE, 0x87, 0x78, 0x3D, 0xD1, 0x1B, 0xBB, 0x27, 0x5A, 0x1E, 0x77, 0x1D,
+    0xB2, 0x13, 0xDC, 0x2E, 0xF2, 0x0C, 0xBF, 0x27, 0x92, 0x0B, 0x5C, 0x15, 0xB3, 0x13, 0x97, 0x04, 0x7E, 0x57, 0x7C, 0xBF, 0xF5, 0x13, 0xFC, 0x0C, 0xFF, 0xF7, 0x9F, 0x05, 0x75, 0x03, 0x95, 0x03, 0xBE, 0xAF, 0x3F, 0x06, 0x34, 0x03, 0xB4, 0x03, 0xF4, 0x03, 0x79, 0x26, 0x98, 0x05, 0xF5, 0x03, 0x98, 0x14, 0xD4, 0x03, 0x76, 0x0C, 0xBB, 0x05, 0x10, 0x03, 0x76, 0x14, 0xEF, 0x02, 0xB3, 0x03,
+    0x34, 0x04, 0x30, 0x03, 0x92, 0x0B, 0xF0, 0x02, 0x76, 0x04, 0xCF, 0x02, 0x30, 0x0B, 0xEF, 0x02, 0x10, 0x03, 0x14, 0x04, 0xEF, 0x02, 0xEF, 0x02, 0x30, 0x03, 0x2F, 0x0B, 0x70, 0x0B, 0xD2, 0x03, 0x88, 0x21, 0xA8, 0x19, 0x70, 0x44, 0x29, 0x2A, 0x4A, 0x2A, 0x6F, 0x43, 0x0D, 0x43, 0x71, 0x54, 0x2A, 0x32, 0x95, 0x7D, 0x0C, 0x5B, 0xEC, 0x52, 0x6E, 0x33, 0x12, 0x54, 0xCD, 0x2A, 0x70, 0x2B,
+    0xD1, 0x2B, 0x0F, 0x2B, 0xF6, 0x34, 0x70, 0x1B, 0xD0, 0x1B, 0x0F, 0x23, 0x38, 0x2D, 0x32, 0x0C, 0xD1, 0x13, 0xF2, 0x23, 0x32, 0x03, 0x35, 0x25, 0xB1, 0x13, 0x9C, 0x57, 0x12, 0x04, 0xDA, 0x26, 0xF1, 0x03, 0xDB, 0x36, 0xFF, 0xB7, 0xBD, 0x2E, 0x75, 0x14, 0x9D, 0x36, 0xD3, 0x03, 0x5A, 0x05, 0xFF, 0xFF, 0xFF, 0xCF, 0xF4, 0x0B, 0xB9, 0x05, 0xFF, 0xF7, 0x38, 0x05, 0x75, 0x03, 0x52, 0x03,
+    0x9D, 0x05, 0xFF, 0x06, 0x54, 0x03, 0x34, 0x04, 0x77, 0x05, 0xFF, 0xE7, 0xB5, 0x05, 0x14, 0x04, 0xFA, 0x1D, 0xFE, 0x2F, 0xFC, 0x07, 0xD6, 0x0C, 0xCF, 0x02, 0xB3, 0x03, 0x92, 0x03, 0xB3, 0x03, 0xCF, 0x02, 0x30, 0x03, 0x51, 0x0B, 0x14, 0x0C, 0xF0, 0x02, 0x8D, 0x02, 0x92, 0x0B, 0x31, 0x0B, 0x13, 0x04, 0x0F, 0x0B, 0xCE, 0x02, 0x0F, 0x0B, 0x50, 0x0B, 0xB1, 0x03, 0x71, 0x0B, 0x50, 0x03,
+    0x29, 0xA2, 0x4A, 0x42, 0xAB, 0x22, 0x09, 0x32, 0x29, 0x3A, 0x09, 0x2A, 0x8B, 0x52, 0xF1, 0x53, 0x0D, 0x4B, 0xAF, 0x53, 0xCC, 0x5A, 0x2D, 0x7B, 0xFF, 0xFF, 0x6C, 0x42, 0x6C, 0x1A, 0x4F, 0x33, 0x56, 0x65, 0x6C, 0x1A, 0x4F, 0x2B, 0xAD, 0x12, 0x3A, 0x4E, 0xEF, 0x1A, 0x15, 0x4D, 0xD2, 0x13, 0xFF, 0xFF, 0x12, 0x3C, 0x91, 0x03, 0x94, 0x24, 0xFF, 0x6F, 0x9E, 0x5F, 0xB1, 0x13, 0xB5, 0x24,
+    0x54, 0x04, 0x79, 0x25, 0xF2, 0x03, 0x5C, 0x3D, 0xFF, 0xFF, 0x7A, 0x2D, 0x35, 0x1C, 0xFB, 0x1D, 0xFE, 0xCF, 0x39, 0x05, 0xF6, 0x0B, 0x96, 0x04, 0x9E, 0x67, 0xD4, 0x03, 0x74, 0x03, 0x54, 0x03, 0xFC, 0x04, 0xD7, 0x02, 0x33, 0x03, 0xD4, 0x03, 0x18, 0x1F, 0x56, 0x0E, 0xB4, 0x04, 0x35, 0x04, 0xBA, 0x1E, 0xFF, 0x3F, 0xF8, 0x15, 0xF6, 0x1C, 0x93, 0x0B, 0xB7, 0x04, 0xCF, 0x02, 0xEF, 0x02,
+    0xCF, 0x02, 0xB2, 0x03, 0xD3, 0x03, 0x8E, 0x02, 0xD2, 0x0B, 0x10, 0x03, 0xF3, 0x0B, 0x71, 0x13, 0xAE, 0x02, 0x0F, 0x03, 0x91, 0x13, 0x30, 0x0B, 0x71, 0x0B, 0x50, 0x0B, 0x91, 0x0B, 0x91, 0x0B, 0xE9, 0x52, 0x6B, 0x22, 0x4B, 0x32, 0x30, 0x43, 0xEC, 0x2A, 0x09, 0x32, 0xF2, 0x53, 0xF6, 0x64, 0x6F, 0x4B, 0x2F, 0x43, 0x4F, 0x4B, 0x71, 0x3B, 0x2B, 0x2A, 0xF2, 0x3B, 0xED, 0x2A, 0xAD, 0x22,
+    0x57, 0x75, 0xB7, 0x2B, 0xFB, 0xFF, 0x6D, 0x1A, 0x71, 0x2B, 0x53, 0x44, 0xD6, 0x2C, 0x74, 0x2C, 0x34, 0x34, 0xAE, 0x43, 0x70, 0x1B, 0xD1, 0x1B, 0xFA, 0x15, 0x9A, 0x35, 0xF2, 0x23, 0xDC, 0x45, 0xB1, 0x1B, 0x59, 0x15, 0x92, 0x03, 0x9E, 0x5F, 0x7F, 0x36, 0xBF, 0x77, 0xDB, 0xFF, 0xFF, 0x5F, 0x3D, 0x05, 0x1A, 0x05, 0xF4, 0x03, 0x17, 0x04, 0x5D, 0x05, 0xB5, 0x03, 0x73, 0x03, 0xD5, 0x0B,
+    0xF8, 0x04, 0x17, 0x04, 0x7E, 0x05, 0x7B, 0x25, 0x35, 0x05, 0xB6, 0x04, 0xD3, 0x03, 0xDD, 0x06, 0xDA, 0x05, 0x12, 0x04, 0x34, 0x04, 0x91, 0x03, 0xB7, 0x04, 0xDC, 0x26, 0x51, 0x03, 0x0F, 0x03, 0x13, 0x04, 0x30, 0x03, 0xCF, 0x02, 0x15, 0x04, 0x95, 0x1C, 0x10, 0x0B, 0xCF, 0x02, 0x0F, 0x03, 0x13, 0x14, 0x55, 0x0C, 0x2F, 0x0B, 0x50, 0x0B, 0x70, 0x0B, 0xAE, 0x02, 0x35, 0x0C, 0xF4, 0x13,
+    0x0E, 0x53, 0xCD, 0x3A, 0x6B, 0x32, 0x09, 0x32, 0x91, 0x5C, 0x2F, 0x4B, 0x4A, 0x3A, 0xED, 0x3A, 0x0A, 0x2A, 0x8C, 0x32, 0x91, 0x43, 0x4F, 0x33, 0x6B, 0x22, 0x6C, 0x32, 0x96, 0x44, 0x35, 0x3C, 0x53, 0x4C, 0x2F, 0x33, 0xAE, 0x22, 0xB0, 0x0A, 0x5D, 0x34, 0x95, 0x12, 0x72, 0x23, 0x95, 0x24, 0x5C, 0x46, 0x92, 0x0B, 0x72, 0x13, 0x99, 0x15, 0xF3, 0x23, 0x5D, 0x5F, 0xD6, 0x2C, 0xB8, 0x3D,
+    0xB2, 0x23, 0x9C, 0x2D, 0xDE, 0x05, 0xDC, 0x35, 0x32, 0x03, 0xDF, 0x2E, 0xF6, 0x0B, 0xDF, 0xA7, 0xDC, 0x05, 0xF4, 0x03, 0xF5, 0x0B, 0xFB, 0x04, 0xFF, 0xFF, 0x37, 0x14, 0x74, 0x03, 0xF5, 0x0C, 0xFF, 0x6F, 0x7F, 0x2F, 0x55, 0x14, 0x1A, 0x37, 0x33, 0x04, 0x72, 0x03, 0x1F, 0x1F, 0xFF, 0xE7, 0xFA, 0x05, 0x95, 0x0C, 0xF4, 0x03, 0x16, 0x05, 0x3A, 0x05, 0xEF, 0x02, 0x75, 0x1C, 0x34, 0x14,
+    0x74, 0x1C, 0x94, 0x03, 0x72, 0x03, 0xAE, 0x02, 0x2F, 0x03, 0x71, 0x13, 0x14, 0x0C, 0xAF, 0x02, 0x0F, 0x0B, 0x0F, 0x03, 0xD0, 0x13, 0xD2, 0x13, 0x34, 0x0C, 0x70, 0x0B, 0xB1, 0x13, 0x71, 0x0B, 0xE9, 0x31, 0x6B, 0x32, 0xAC, 0x2A, 0xEC, 0x4A, 0x32, 0x5C, 0x2F, 0x4B, 0x09, 0x2A, 0x2B, 0x3A, 0x0A, 0x2A, 0xCD, 0x42, 0x0A, 0x22, 0xAC, 0x3A, 0xF2, 0x53, 0x12, 0x54, 0xF5, 0x43, 0xEF, 0x2A,
+    0x11, 0x1B, 0x4E, 0x32, 0x33, 0x4C, 0x70, 0x2B, 0x79, 0x1B, 0xFF, 0xEF, 0x17, 0x2C, 0x15, 0x24, 0x19, 0x35, 0x75, 0x0B, 0xD2, 0x1B, 0xB1, 0x23, 0xB7, 0x4C, 0x70, 0x0B, 0x5A, 0x26, 0x99, 0xCF, 0x53, 0x54, 0x38, 0x35, 0x19, 0x25, 0xFE, 0x1E, 0xB3, 0x03, 0x7B, 0x35, 0x17, 0x04, 0xFF, 0x37, 0xBD, 0x47, 0xD7, 0x14, 0x97, 0x14, 0xFF, 0x57, 0xFF, 0xFF, 0x1E, 0x2E, 0x94, 0x0B, 0x73, 0x03,
+    0x1F, 0x27, 0x3B, 0x05, 0x93, 0x03, 0xFB, 0x25, 0x92, 0x03, 0x93, 0x03, 0xDC, 0x0D, 0x15, 0x04, 0x55, 0x04, 0xF6, 0x03, 0x3C, 0x02, 0x7D, 0x15, 0x31, 0x03, 0x93, 0x03, 0x97, 0x1C, 0x35, 0x04, 0x96, 0x1C, 0xAF, 0x02, 0xAE, 0x02, 0xAE, 0x02, 0xF7, 0x1C, 0xF4, 0x0B, 0xCE, 0x02, 0xEF, 0x02, 0x2F, 0x13, 0x14, 0x0C, 0xCE, 0x02, 0x2F, 0x03, 0x70, 0x0B, 0x70, 0x0B, 0x70, 0x0B, 0xF2, 0x0B,
+    0x2C, 0xFC, 0x6B, 0x3A, 0xCD, 0x2A, 0xC8, 0x29, 0x8C, 0x3A, 0x2A, 0x2A, 0xCC, 0x42, 0xAC, 0x32, 0x0D, 0x4B, 0x4B, 0x2A, 0x2B, 0x32, 0x34, 0x74, 0xF4, 0xFF, 0xCD, 0x3A, 0x6C, 0x22, 0x12, 0x54, 0x70, 0x23, 0x8D, 0x32, 0xEF, 0x2A, 0x59, 0x45, 0xFF, 0x57, 0xF1, 0x2A, 0xD3, 0x2B, 0x5A, 0x26, 0xFF, 0xF7, 0x53, 0x0C, 0xFA, 0x35, 0xB8, 0x25, 0xFF, 0xF7, 0x96, 0x14, 0x17, 0x2D, 0x54, 0x2D,
+    0x55, 0x1C, 0xB5, 0x24, 0xD3, 0x13, 0x96, 0x24, 0x3B, 0x26, 0xF7, 0x24, 0x14, 0x1C, 0x36, 0x05, 0xFB, 0x06, 0xFA, 0x0D, 0x55, 0x0C, 0xFB, 0x04, 0x1E, 0x0F, 0xB3, 0x03, 0x93, 0x03, 0x73, 0x03, 0xFE, 0x03, 0x5E, 0x1D, 0x1F, 0x3F, 0x36, 0x15, 0x97, 0x1F, 0xBA, 0x06, 0x97, 0x04, 0x35, 0x04, 0x76, 0x04, 0xDF, 0x05, 0x9B, 0x03, 0x95, 0x03, 0xB3, 0x0B, 0x8F, 0x02, 0x31, 0x03, 0x50, 0x03,
+    0xB2, 0x03, 0x8F, 0x02, 0x35, 0x04, 0x51, 0x13, 0x76, 0x24, 0x50, 0x0B, 0x34, 0x0C, 0x30, 0x03, 0xD4, 0x1B, 0x30, 0x13, 0x30, 0x13, 0x50, 0x0B, 0xB2, 0x0B, 0x71, 0x13, 0x91, 0x13, 0x90, 0x0B, 0x6B, 0x32, 0xE8, 0x29, 0xAC, 0x22, 0xE9, 0x29, 0x4A, 0x22, 0xE9, 0x21, 0x0A, 0x32, 0x6B, 0x32, 0xEA, 0x29, 0x4A, 0x2A, 0x4C, 0x2B, 0xB3, 0x5C, 0x9A, 0x76, 0x6B, 0x2A, 0x71, 0x1B, 0x91, 0x4B,
+    0x30, 0x1B, 0xAD, 0x2A, 0x32, 0x3C, 0x17, 0x45, 0xD7, 0x3C, 0xD3, 0x3B, 0x95, 0x3C, 0xB5, 0x24, 0x19, 0x2E, 0xF3, 0x04, 0x19, 0x3F, 0x53, 0x14, 0x14, 0x24, 0xFF, 0xD7, 0x95, 0x0B, 0x7E, 0x5F, 0xD3, 0x1B, 0x1D, 0x26, 0x95, 0x14, 0xFB, 0x2D, 0xDF, 0x57, 0x7C, 0x3F, 0x13, 0x04, 0x57, 0x15, 0x3A, 0x06, 0xFD, 0x05, 0x55, 0x14, 0xD7, 0x04, 0x3A, 0x0E, 0x72, 0x03, 0x72, 0x03, 0xF7, 0x1C,
+    0x39, 0x47, 0x74, 0x04, 0x17, 0x15, 0x94, 0x04, 0x58, 0x0E, 0xD2, 0x03, 0x34, 0x14, 0x94, 0x04, 0x97, 0x05, 0xB3, 0x03, 0x73, 0x03, 0xD4, 0x03, 0x95, 0x04, 0x8E, 0x02, 0x51, 0x03, 0x30, 0x03, 0x91, 0x03, 0x8E, 0x02, 0x8E, 0x02, 0x8E, 0x02, 0x50, 0x03, 0x70, 0x0B, 0xAE, 0x02, 0xEF, 0x0A, 0x91, 0x0B, 0x54, 0x2C, 0x2F, 0x0B, 0x50, 0x0B, 0x90, 0x13, 0x90, 0x03, 0x70, 0x0B, 0x70, 0x0B,
+    0x2E, 0x3B, 0x90, 0x33, 0x6C, 0x2A, 0x09, 0x32, 0x2B, 0x2A, 0x2E, 0x3B, 0xD3, 0x43, 0x2B, 0x4A, 0x49, 0x3A, 0x4A, 0x3A, 0x74, 0x54, 0xB2, 0x43, 0x16, 0x6D, 0x29, 0x32, 0xB2, 0x1B, 0xCE, 0x32, 0x2E, 0x33, 0xF5, 0x43, 0x30, 0x43, 0x74, 0x44, 0x93, 0x33, 0x31, 0x2B, 0x51, 0x23, 0xF9, 0x24, 0x15, 0x1C, 0x50, 0x13, 0x54, 0x24, 0x53, 0x1C, 0x13, 0x1C, 0x92, 0x1B, 0xD3, 0x1B, 0x54, 0x2C,
+    0x91, 0x1B, 0xF9, 0x1C, 0xBD, 0x1C, 0xDB, 0x3D, 0x52, 0x03, 0x5E, 0x35, 0x33, 0x13, 0xB3, 0x0B, 0x75, 0x0C, 0x76, 0x0C, 0xD3, 0x03, 0x76, 0x04, 0x35, 0x1C, 0x92, 0x03, 0x72, 0x03, 0x96, 0x1C, 0xF4, 0x03, 0x71, 0x03, 0xF4, 0x03, 0x53, 0x04, 0x51, 0x03, 0x92, 0x03, 0x75, 0x04, 0x95, 0x04, 0xB3, 0x03, 0xD4, 0x0B, 0xF4, 0x03, 0x32, 0x03, 0x92, 0x03, 0x15, 0x0C, 0x10, 0x03, 0xAF, 0x02,
+    0x30, 0x03, 0x91, 0x0B, 0xAF, 0x02, 0xCF, 0x0A, 0xAD, 0x02, 0x13, 0x24, 0xAE, 0x02, 0x50, 0x13, 0x0F, 0x03, 0x70, 0x13, 0x50, 0x0B, 0x2F, 0x0B, 0x2F, 0x0B, 0x70, 0x0B, 0x91, 0x0B, 0x90, 0x0B, 0x0D, 0x5B, 0xB1, 0x73, 0xC8, 0x31, 0x0D, 0x4B, 0xE8, 0x31, 0x6F, 0x7B, 0x4A, 0x6A, 0xF7, 0xFF, 0x6F, 0xC3, 0x2A, 0x5A, 0x71, 0x63, 0x6C, 0x42, 0x12, 0x64, 0x31, 0x43, 0x8C, 0x3A, 0xD6, 0x43,
+    0xEF, 0x3A, 0x4C, 0x32, 0x8D, 0x32, 0x79, 0x7D, 0x39, 0x13, 0xFA, 0x01, 0x31, 0x2B, 0x34, 0x44, 0x51, 0x03, 0xB2, 0x0B, 0xF2, 0x23, 0x74, 0x4C, 0xF7, 0x44, 0xD7, 0x2C, 0x91, 0x13, 0x72, 0x24, 0xF1, 0x1B, 0xDA, 0x4D, 0x59, 0x1D, 0x94, 0xE5, 0x50, 0x13, 0xD6, 0x44, 0xB2, 0xAB, 0xFC, 0x1D, 0x95, 0x1C, 0xB3, 0x0B, 0x53, 0x0C, 0x17, 0x0D, 0x19, 0x0D, 0x50, 0x0B, 0x72, 0x0B, 0xB7, 0x2C,
+    0x13, 0x04, 0xBB, 0x0D, 0x35, 0x04, 0x34, 0x14, 0x51, 0x03, 0xF4, 0x0B, 0x5F, 0x2F, 0xDF, 0xCF, 0xB4, 0x03, 0x95, 0x03, 0x17, 0x0C, 0xD5, 0x03, 0xB9, 0x04, 0x56, 0x04, 0x8F, 0x02, 0x8F, 0x02, 0xD0, 0x02, 0x39, 0x15, 0xF4, 0x0B, 0x14, 0x0C, 0xEE, 0x0A, 0xB2, 0x1B, 0xEF, 0x02, 0x35, 0x0C, 0x54, 0x04, 0x50, 0x0B, 0x4F, 0x0B, 0x70, 0x0B, 0x57, 0x2D, 0x53, 0x1C, 0xB6, 0x1C, 0xCE, 0x0A,
+    0x09, 0x3A, 0xA8, 0x31, 0xC9, 0x31, 0xC8, 0x31, 0xE8, 0x39, 0x74, 0x75, 0xE9, 0x49, 0x6F, 0xA3, 0x0E, 0x93, 0x09, 0x4A, 0xEC, 0x52, 0xAC, 0x62, 0xAD, 0x3A, 0x8A, 0x42, 0x70, 0x43, 0xB1, 0x4B, 0x76, 0x65, 0x2B, 0x3A, 0x73, 0x9C, 0x6D, 0x1A, 0x98, 0x65, 0x56, 0x1A, 0x56, 0x34, 0x71, 0x1B, 0x51, 0x0C, 0xD0, 0x14, 0xF5, 0x3D, 0xB4, 0x2C, 0xF6, 0x44, 0x70, 0x1B, 0xF3, 0x04, 0xFF, 0xFF,
+    0xB6, 0x3E, 0xF2, 0x23, 0xF2, 0x23, 0xF9, 0x2D, 0x50, 0x03, 0x36, 0x3D, 0xD2, 0x23, 0xF4, 0x0B, 0xBA, 0x25, 0x54, 0x1C, 0x71, 0x0B, 0x12, 0x04, 0x7C, 0x26, 0xF2, 0x03, 0x52, 0x0B, 0x75, 0x1C, 0x18, 0x15, 0x9A, 0x0D, 0x31, 0x03, 0xD3, 0x0B, 0x71, 0x03, 0x3A, 0x05, 0xB7, 0x04, 0x9A, 0x1D, 0x53, 0x03, 0x1B, 0x04, 0xFF, 0xDF, 0xB3, 0x02, 0x52, 0x0B, 0x56, 0x03, 0x54, 0x03, 0x79, 0x0C,
+    0x2E, 0x02, 0xB3, 0x1B, 0xAE, 0x0A, 0xEF, 0x02, 0xB4, 0x0B, 0xAF, 0x02, 0xD7, 0x44, 0x54, 0x14, 0xEE, 0x0A, 0x14, 0x14, 0x8D, 0x02, 0x50, 0x13, 0x50, 0x0B, 0x91, 0x0B, 0x13, 0x1C, 0xD2, 0x13, 0xE9, 0x39, 0xE9, 0x39, 0xE8, 0x31, 0x4A, 0x4A, 0xA8, 0x31, 0x0D, 0x63, 0x53, 0x84, 0x0A, 0x4A, 0x4F, 0x5B, 0x2A, 0x52, 0xAE, 0xB3, 0xFD, 0xFF, 0xCC, 0x4A, 0x2B, 0x4A, 0x50, 0xC3, 0x09, 0xE2,
+    0x6F, 0x63, 0x0F, 0x4B, 0x0F, 0x43, 0x30, 0x23, 0xB2, 0x3B, 0x0B, 0x82, 0xB1, 0x4B, 0xF2, 0x33, 0x50, 0x1B, 0xB3, 0x15, 0x76, 0x3F, 0xD7, 0x4D, 0x51, 0x23, 0x97, 0x0B, 0xFF, 0xFF, 0x55, 0x1C, 0x14, 0x2C, 0x17, 0x25, 0x3B, 0x66, 0x19, 0x3E, 0xF3, 0x2C, 0xDD, 0xEF, 0x13, 0x24, 0x50, 0x0B, 0xF8, 0x14, 0xF3, 0x0B, 0x51, 0x0B, 0x34, 0x14, 0xDF, 0xEF, 0x56, 0x2D, 0x10, 0x03, 0x57, 0x46,
+    0xFF, 0xDF, 0x51, 0x03, 0xF0, 0x02, 0x14, 0x14, 0xB8, 0x1D, 0x11, 0x03, 0x97, 0x24, 0x55, 0x14, 0xD6, 0x04, 0x39, 0x1C, 0x76, 0x03, 0x56, 0x0C, 0x95, 0x0C, 0x92, 0x0B, 0x10, 0x03, 0x92, 0x0B, 0x54, 0x1C, 0xB2, 0x1B, 0xAE, 0x02, 0x91, 0x0B, 0xF2, 0x1B, 0xEF, 0x02, 0xAD, 0x02, 0xEF, 0x0A, 0x0F, 0x0B, 0x50, 0x13, 0x50, 0x13, 0x50, 0x0B, 0x50, 0x0B, 0x91, 0x0B, 0xB1, 0x13, 0xB1, 0x13,
+    0xC8, 0x31, 0xC8, 0x31, 0xA7, 0x31, 0xC8, 0x31, 0xE8, 0x39, 0x29, 0x3A, 0xD0, 0x5B, 0xE9, 0x39, 0x6B, 0x32, 0xE9, 0x39, 0xEA, 0x39, 0x0A, 0x42, 0x2B, 0x42, 0xED, 0x42, 0x2E, 0x53, 0x6C, 0x42, 0xCD, 0x3A, 0x4B, 0x2A, 0x4C, 0x22, 0x4B, 0x2A, 0xEE, 0x3A, 0xAD, 0x3A, 0x8C, 0x3A, 0x6F, 0x2B, 0xED, 0x22, 0x4D, 0x1B, 0xF0, 0x33, 0x4F, 0x23, 0x33, 0x3C, 0xAF, 0x1A, 0xF0, 0x1A, 0xCF, 0x1A,
+    0x0F, 0x23, 0xB1, 0x2B, 0x91, 0x2B, 0x53, 0x3C, 0x0F, 0x13, 0x94, 0x34, 0x91, 0x6B, 0x30, 0x1B, 0x51, 0x1B, 0x10, 0x64, 0x10, 0x13, 0x71, 0x13, 0x92, 0x1B, 0x13, 0x2C, 0x10, 0x0B, 0x51, 0x0B, 0x10, 0x03, 0x72, 0x13, 0x4E, 0x02, 0x10, 0x0B, 0x52, 0x13, 0x51, 0x0B, 0x14, 0x1C, 0xD0, 0x02, 0xF1, 0x0A, 0x72, 0x13, 0x52, 0x0B, 0x11, 0x0B, 0x10, 0x0B, 0x8E, 0x02, 0x51, 0x13, 0x4D, 0x02,
+    0xCF, 0x0A, 0x8E, 0x02, 0x6D, 0x0A, 0xAD, 0x12, 0x8D, 0x0A, 0xEF, 0x0A, 0xAD, 0x02, 0xEE, 0x0A, 0xEF, 0x12, 0xEF, 0x12, 0x2F, 0x0B, 0x2F, 0x13, 0x4F, 0x0B, 0x91, 0x13, 0x70, 0x13, 0x90, 0x13, 0xA8, 0x29, 0xC8, 0x31, 0xA8, 0x31, 0xA8, 0x31, 0xC8, 0x31, 0xA8, 0x29, 0x29, 0x3A, 0xE9, 0x31, 0x09, 0x32, 0xE9, 0x39, 0x09, 0x3A, 0x0A, 0x3A, 0x4B, 0x3A, 0xCC, 0x42, 0xAD, 0x3A, 0x2B, 0x32,
+    0x2B, 0x2A, 0xAD, 0x32, 0x8C, 0x32, 0x6B, 0x2A, 0x8C, 0x32, 0x6C, 0x32, 0xAC, 0x32, 0xAD, 0x2A, 0xCD, 0x2A, 0x2E, 0x2B, 0x0E, 0x2B, 0x0E, 0x2B, 0x0F, 0x23, 0xCE, 0x22, 0x0F, 0x23, 0x0F, 0x23, 0xCE, 0x1A, 0xF1, 0x23, 0x0F, 0x23, 0x72, 0x23, 0x30, 0x1B, 0x91, 0x1B, 0x50, 0x13, 0x0F, 0x1B, 0x0F, 0x13, 0x0F, 0x13, 0x0F, 0x13, 0x51, 0x13, 0x30, 0x13, 0x92, 0x1B, 0x10, 0x0B, 0x10, 0x0B,
+    0x10, 0x0B, 0x10, 0x0B, 0x6E, 0x02, 0xEF, 0x02, 0xEF, 0x0A, 0x71, 0x13, 0x10, 0x0B, 0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x02, 0x51, 0x0B, 0xAF, 0x0A, 0xAF, 0x0A, 0x10, 0x1B, 0x8E, 0x02, 0xEF, 0x12, 0xCE, 0x12, 0x6D, 0x0A, 0x8D, 0x0A, 0x6D, 0x0A, 0x8D, 0x0A, 0xAD, 0x0A, 0xAD, 0x0A, 0xCE, 0x0A, 0xAD, 0x0A, 0xEE, 0x12, 0xEF, 0x12, 0x0F, 0x13, 0x4F, 0x13, 0x2F, 0x0B, 0x2F, 0x0B, 0x91, 0x1B,
+    0x08, 0x4A, 0x0E, 0x4B, 0xAB, 0x52, 0xEE, 0x52, 0xE8, 0x39, 0x4A, 0x42, 0x0F, 0x4B, 0xAF, 0x6B, 0x4E, 0x53, 0xCC, 0x4A, 0x70, 0x5B, 0xB1, 0x43, 0x12, 0xFC, 0xAD, 0x2A, 0xEA, 0x31, 0xD8, 0x44, 0xC9, 0x21, 0xB3, 0x43, 0xD6, 0x5C, 0x34, 0x74, 0xCF, 0x32, 0xF2, 0x5B, 0x8D, 0x2A, 0x54, 0x44, 0xED, 0x3A, 0xAD, 0x1A, 0xCC, 0x2A, 0x8D, 0x1A, 0x55, 0x34, 0x74, 0x34, 0x70, 0x2B, 0x77, 0x45,
+    0x0E, 0x2B, 0xB6, 0x24, 0xF6, 0x2C, 0xCD, 0x0A, 0x93, 0x44, 0xF2, 0x33, 0x91, 0x23, 0x78, 0x25, 0xD2, 0x23, 0x51, 0x1B, 0xEF, 0x12, 0x50, 0x03, 0xD7, 0x14, 0xD2, 0x13, 0xF0, 0x12, 0xF0, 0x02, 0x50, 0x0B, 0xB8, 0x15, 0xEF, 0x02, 0x10, 0x0B, 0x4D, 0x02, 0x51, 0x13, 0x9A, 0x1D, 0xD8, 0x04, 0xAE, 0x02, 0xAF, 0x0A, 0x11, 0x13, 0xD1, 0x02, 0x99, 0x0C, 0x36, 0x04, 0x8E, 0x02, 0x6D, 0x02,
+    0xB2, 0x13, 0x10, 0x0B, 0x1B, 0x3E, 0xCF, 0x0A, 0x8C, 0x0A, 0xEE, 0x12, 0x0F, 0x0B, 0x0F, 0x13, 0x34, 0x14, 0x0F, 0x13, 0x0F, 0x13, 0x2F, 0x13, 0x4F, 0x03, 0xEE, 0x0A, 0xD3, 0x1B, 0xCD, 0x0A, 0xA7, 0x31, 0x87, 0x31, 0xA8, 0x31, 0xC8, 0x39, 0xA8, 0x31, 0xC8, 0x31, 0xC8, 0x31, 0xE8, 0x31, 0xE8, 0x39, 0xE9, 0x39, 0xE8, 0x39, 0xC8, 0x39, 0xE9, 0x39, 0x29, 0x3A, 0x2A, 0x3A, 0x09, 0x32,
+    0xA8, 0x29, 0x4A, 0x3A, 0x2A, 0x3A, 0x4A, 0x32, 0x2A, 0x3A, 0x4A, 0x42, 0xE9, 0x49, 0x6B, 0x32, 0xAC, 0x3A, 0xAC, 0x3A, 0x8C, 0x32, 0xAC, 0x32, 0xAC, 0x2A, 0x8C, 0x2A, 0x8C, 0x2A, 0x8C, 0x22, 0xAD, 0x2A, 0xCD, 0x32, 0xCE, 0x2A, 0x0E, 0x33, 0x8C, 0x22, 0xB0, 0x6B, 0xCE, 0x2A, 0xCE, 0x22, 0x8D, 0x12, 0x30, 0x23, 0x8D, 0x12, 0x0F, 0x1B, 0x71, 0x2B, 0x50, 0x23, 0xAE, 0x12, 0x50, 0x1B,
+    0xAE, 0x02, 0x30, 0x1B, 0xAE, 0x12, 0xD2, 0x23, 0x50, 0x1B, 0x10, 0x13, 0xCF, 0x02, 0x91, 0x1B, 0xCE, 0x02, 0x31, 0x13, 0x0F, 0x0B, 0xB2, 0x13, 0x8D, 0x02, 0xAE, 0x02, 0x71, 0x1B, 0xB2, 0x0B, 0x10, 0x13, 0xEF, 0x1A, 0x0F, 0x13, 0x30, 0x0B, 0xEF, 0x0A, 0x6D, 0x02, 0xF3, 0x1B, 0xF2, 0x13, 0xCE, 0x0A, 0x70, 0x13, 0x13, 0x1C, 0xD2, 0x1B, 0x70, 0x13, 0x0E, 0x13, 0xF2, 0x13, 0xAD, 0x0A,
+    0xA7, 0x31, 0x87, 0x31, 0xC8, 0x39, 0xA7, 0x39, 0xA7, 0x31, 0x87, 0x31, 0xA8, 0x31, 0xE8, 0x39, 0xE8, 0x39, 0xC8, 0x31, 0xC7, 0x31, 0xC8, 0x31, 0xE9, 0x31, 0xC8, 0x29, 0xC9, 0x31, 0xE9, 0x31, 0xE9, 0x31, 0xE9, 0x31, 0x0A, 0x32, 0xE9, 0x29, 0x09, 0x32, 0x0A, 0x3A, 0x0A, 0x3A, 0x6C, 0x32, 0x2A, 0x2A, 0x6B, 0x32, 0x8C, 0x32, 0x6B, 0x2A, 0xAC, 0x2A, 0x6B, 0x2A, 0x8C, 0x2A, 0x8C, 0x2A,
+    0x4B, 0x22, 0xAD, 0x2A, 0x8C, 0x22, 0xEE, 0x2A, 0x8C, 0x22, 0xEE, 0x2A, 0xCD, 0x2A, 0x8D, 0x22, 0x6C, 0x1A, 0xAD, 0x1A, 0xAD, 0x1A, 0xEF, 0x1A, 0xCE, 0x1A, 0xAD, 0x1A, 0x8D, 0x12, 0xEF, 0x1A, 0xAE, 0x12, 0x0F, 0x1B, 0xAE, 0x1A, 0xEE, 0x12, 0x0B, 0x02, 0xCE, 0x12, 0x8E, 0x12, 0xEF, 0x1A, 0xAE, 0x12, 0x6D, 0x0A, 0x8D, 0x0A, 0x0C, 0x02, 0x2C, 0x02, 0x4C, 0x0A, 0x4C, 0x0A, 0x4C, 0x0A,
+    0x6C, 0x12, 0x2B, 0x0A, 0x2B, 0x0A, 0xEA, 0x01, 0x2B, 0x0A, 0x4C, 0x0A, 0xAD, 0x12, 0xAD, 0x12, 0xAD, 0x12, 0xAD, 0x12, 0xEE, 0x12, 0x0E, 0x1B, 0x2F, 0x13, 0x0E, 0x13, 0x50, 0x13, 0xEE, 0x12, 0x09, 0x42, 0xA7, 0x31, 0xC7, 0x39, 0xA7, 0x39, 0x87, 0x31, 0xA7, 0x39, 0xC8, 0x39, 0x08, 0x3A, 0xC7, 0x39, 0x08, 0x3A, 0xC7, 0x39, 0xE8, 0x39, 0xE8, 0x39, 0xC8, 0x31, 0xC8, 0x31, 0xE9, 0x31,
+    0x29, 0x42, 0x09, 0x3A, 0x2A, 0x42, 0xAB, 0x4A, 0xE9, 0x41, 0x2A, 0x52, 0x09, 0x42, 0x8B, 0x4A, 0x6B, 0x3A, 0xAC, 0x3A, 0x8B, 0x32, 0x8B, 0x3A, 0x6B, 0x3A, 0x6B, 0x32, 0x6B, 0x3A, 0x4B, 0x3A, 0x8C, 0x32, 0xCD, 0x3A, 0xCD, 0x32, 0x4F, 0x43, 0x6C, 0x2A, 0x8C, 0x2A, 0xAD, 0x2A, 0x6C, 0x1A, 0xAD, 0x22, 0xAD, 0x22, 0x8D, 0x1A, 0x8D, 0x12, 0xAD, 0x1A, 0x8D, 0x1A, 0xAD, 0x1A, 0xCE, 0x1A,
+    0xAD, 0x1A, 0xAE, 0x1A, 0xCE, 0x1A, 0x8D, 0x12, 0x8D, 0x12, 0xCE, 0x1A, 0x6D, 0x0A, 0xCE, 0x1A, 0x8D, 0x12, 0x4C, 0x0A, 0xAE, 0x12, 0xEB, 0x01, 0x6D, 0x12, 0x2C, 0x0A, 0x2C, 0x0A, 0x2C, 0x0A, 0x6C, 0x12, 0x2C, 0x0A, 0x4B, 0x12, 0x2B, 0x0A, 0x4B, 0x12, 0x6C, 0x12, 0x8C, 0x12, 0x8D, 0x12, 0xAD, 0x12, 0xCD, 0x12, 0xEE, 0x12, 0x2F, 0x1B, 0x4F, 0x1B, 0x4F, 0x13, 0x70, 0x1B, 0x0E, 0x1B,
+    0xCC, 0x5A, 0xA7, 0x39, 0xE8, 0x41, 0xE8, 0x41, 0xE8, 0x41, 0xE8, 0x41, 0xE8, 0x41, 0x0D, 0x5B, 0x6A, 0x42, 0xAC, 0x5A, 0xCB, 0x5A, 0xEC, 0x52, 0x4A, 0x42, 0xE9, 0x39, 0x6B, 0x5A, 0x8E, 0x73, 0xED, 0x62, 0xEA, 0x72, 0x8D, 0x8B, 0xF1, 0x93, 0xAC, 0xBA, 0xFE, 0xFF, 0x0D, 0xA3, 0x4E, 0x7B, 0xCC, 0xC4, 0x2E, 0x5B, 0xED, 0x52, 0x8F, 0x63, 0x78, 0xFF, 0x32, 0x74, 0x90, 0xA3, 0xF1, 0xAB,
+    0xAC, 0x62, 0x90, 0xDD, 0x32, 0xA4, 0xCD, 0x3A, 0x8C, 0x3A, 0xF0, 0x93, 0x0E, 0x3B, 0x8C, 0x2A, 0xEE, 0x3A, 0x0E, 0x2B, 0x6C, 0x1A, 0xEE, 0x22, 0x0F, 0x23, 0x90, 0x53, 0x6C, 0x12, 0xEE, 0x1A, 0x8D, 0x1A, 0x8D, 0x12, 0x13, 0x44, 0xAE, 0x12, 0x50, 0x2B, 0xEE, 0x22, 0xCE, 0x12, 0xEF, 0x1A, 0xAD, 0x12, 0xCE, 0x1A, 0x2B, 0x0A, 0x2B, 0x02, 0xAD, 0x1A, 0x4C, 0x0A, 0x8D, 0x1A, 0x8D, 0x12,
+    0x4C, 0x0A, 0x4B, 0x12, 0x2B, 0x0A, 0x0B, 0x0A, 0x4C, 0x12, 0x4B, 0x12, 0x6B, 0x0A, 0xCE, 0x1A, 0x4B, 0x0A, 0xCD, 0x12, 0xCD, 0x12, 0xED, 0x12, 0xAD, 0x12, 0x0E, 0x13, 0x70, 0x13, 0x50, 0x1B, 0x05, 0x21, 0xD1, 0x5B, 0xC8, 0x39, 0x2E, 0x4B, 0xE8, 0x39, 0x87, 0x31, 0x0F, 0x43, 0x29, 0x42, 0x2E, 0x4B, 0xE8, 0x39, 0xD0, 0x6B, 0x6F, 0x4B, 0xB1, 0x53, 0xF1, 0x5B, 0x4B, 0x42, 0x70, 0x53,
+    0x08, 0x3A, 0x2F, 0x43, 0x2A, 0x3A, 0x52, 0x6C, 0x90, 0x63, 0xB0, 0x6B, 0x0A, 0x42, 0xB4, 0x64, 0xD0, 0x4B, 0xF1, 0x5B, 0x4A, 0x32, 0x8B, 0x3A, 0xB4, 0x33, 0xD1, 0x43, 0xAD, 0x42, 0x54, 0x74, 0xAB, 0x42, 0xAD, 0x32, 0x73, 0x3C, 0x90, 0x3B, 0xAC, 0x32, 0x6B, 0x2A, 0x6B, 0x2A, 0x16, 0x4D, 0x6C, 0x1A, 0xAD, 0x22, 0x8C, 0x1A, 0x70, 0x2B, 0x13, 0x1C, 0x6F, 0x33, 0x8D, 0x1A, 0xAD, 0x1A,
+    0xCD, 0x12, 0x57, 0x2D, 0x70, 0x2B, 0x8D, 0x1A, 0xEE, 0x12, 0xD5, 0x24, 0x95, 0x14, 0x6C, 0x0A, 0x33, 0x34, 0x75, 0x24, 0x17, 0x2D, 0x13, 0x24, 0x4C, 0x02, 0x95, 0x24, 0x14, 0x24, 0x13, 0x14, 0x91, 0x0B, 0x4D, 0x02, 0xD1, 0x1B, 0x91, 0x23, 0x2F, 0x1B, 0x6C, 0x0A, 0xAD, 0x12, 0x4C, 0x02, 0xAD, 0x02, 0x0E, 0x1B, 0x70, 0x1B, 0x6C, 0x02, 0xEA, 0x01, 0x4F, 0x1B, 0x50, 0x13, 0x50, 0x13,
+    0x45, 0x29, 0xC7, 0x41, 0x65, 0x39, 0x27, 0xF4, 0xA7, 0x39, 0xC7, 0x39, 0xE8, 0x39, 0xE8, 0x39, 0xC7, 0x39, 0x29, 0x4A, 0xE7, 0x41, 0xC7, 0x39, 0xE7, 0x39, 0xE8, 0x39, 0xE8, 0x39, 0x09, 0x3A, 0xC8, 0x39, 0x09, 0x42, 0xE8, 0x41, 0x09, 0x42, 0xE8, 0x41, 0xE9, 0x41, 0x09, 0x42, 0x4A, 0x52, 0xAB, 0x5A, 0x6A, 0x42, 0x4A, 0x3A, 0x8B, 0x42, 0x6B, 0x42, 0x6A, 0x52, 0x4A, 0x4A, 0x4F, 0x9C,
+    0x4A, 0x32, 0x4B, 0x32, 0x6B, 0x32, 0xED, 0x42, 0x8B, 0x32, 0x8C, 0x3A, 0xAC, 0x32, 0x2B, 0x22, 0x8B, 0x2A, 0x6B, 0x22, 0x6C, 0x22, 0x8C, 0x22, 0xB7, 0x24, 0x8C, 0x2A, 0x6C, 0x1A, 0x8C, 0x1A, 0x6C, 0x1A, 0x74, 0x34, 0xCD, 0x22, 0x6C, 0x1A, 0x8C, 0x1A, 0x8C, 0x1A, 0x2C, 0x12, 0xD7, 0x1C, 0x2B, 0x0A, 0x4B, 0x12, 0x4B, 0x12, 0x8C, 0x1A, 0xD2, 0x1B, 0xD7, 0x24, 0x0B, 0x0A, 0x68, 0x01,
+    0x4C, 0x1A, 0x96, 0x1C, 0x95, 0x24, 0xAE, 0x02, 0x2B, 0x12, 0xEA, 0x01, 0xD6, 0x2C, 0x4B, 0x0A, 0x34, 0x1C, 0x57, 0x2D, 0xEE, 0x1A, 0xC9, 0x01, 0x8C, 0x0A, 0x12, 0x24, 0x13, 0x14, 0x70, 0x1B, 0x45, 0x29, 0xC7, 0x41, 0x09, 0x52, 0xC7, 0x41, 0xE7, 0x41, 0xE8, 0x49, 0x86, 0x41, 0x08, 0x42, 0x15, 0xF7, 0xCB, 0x62, 0x08, 0x4A, 0x29, 0x4A, 0x08, 0x4A, 0xC7, 0x41, 0x8B, 0x5A, 0x08, 0x42,
+    0x29, 0x4A, 0xEB, 0x72, 0xFF, 0xFF, 0x29, 0x52, 0x87, 0x41, 0x8B, 0x62, 0x6B, 0xFC, 0x6A, 0x5A, 0x8B, 0x4A, 0x0C, 0x63, 0x8B, 0x4A, 0x8B, 0x4A, 0xAB, 0x5A, 0x69, 0x6A, 0xAA, 0x72, 0x0D, 0x73, 0x09, 0x3A, 0x0D, 0x53, 0xCC, 0x4A, 0x0D, 0x4B, 0x8B, 0x3A, 0x6A, 0x32, 0x4A, 0x2A, 0x4B, 0x2A, 0x4B, 0x2A, 0x8B, 0x32, 0x2B, 0x1A, 0xAC, 0x2A, 0x2D, 0x4B, 0x8C, 0x2A, 0x8C, 0x22, 0xCD, 0x2A,
+    0x6C, 0x1A, 0x6C, 0x1A, 0x6C, 0x1A, 0x6C, 0x1A, 0x6C, 0x1A, 0x8C, 0x1A, 0x6C, 0x12, 0x2B, 0x0A, 0xAD, 0x22, 0x0A, 0x0A, 0x2B, 0x12, 0x6B, 0x12, 0x4B, 0x12, 0x6C, 0x1A, 0x0A, 0x0A, 0x2B, 0x1A, 0xEA, 0x11, 0x2B, 0x12, 0x6C, 0x1A, 0x2B, 0x12, 0x2A, 0x12, 0x6B, 0x12, 0x4B, 0x12, 0x6B, 0x1A, 0x8C, 0x1A, 0xAC, 0x1A, 0xE9, 0x01, 0xCD, 0x1A, 0x2E, 0x23, 0xCD, 0x12, 0x0E, 0x13, 0xEE, 0x12,
+    0x87, 0x39, 0xA7, 0x39, 0x08, 0x4A, 0xE8, 0x41, 0x08, 0x4A, 0xC8, 0x41, 0xC7, 0x41, 0xC7, 0x31, 0x29, 0x4A, 0xCB, 0x5A, 0xAB, 0x5A, 0xCB, 0x5A, 0x09, 0x42, 0xCB, 0x5A, 0xEC, 0x62, 0xC7, 0x39, 0xAB, 0x5A, 0x48, 0x62, 0xE7, 0x51, 0x49, 0x4A, 0x6E, 0x73, 0x4D, 0x6B, 0xAB, 0x52, 0xE8, 0x39, 0xD0, 0x7B, 0x6F, 0x6B, 0x29, 0x3A, 0x6A, 0x42, 0xEC, 0x62, 0x8E, 0x8B, 0xEB, 0x62, 0xCB, 0x5A,
+    0x29, 0x5A, 0xFC, 0xFF, 0x4A, 0x3A, 0x6E, 0x5B, 0xB4, 0x84, 0xB0, 0x63, 0x8B, 0x32, 0xE9, 0x21, 0x53, 0x64, 0x2E, 0x43, 0x4B, 0x2A, 0xAD, 0x2A, 0xAD, 0x2A, 0x6B, 0x2A, 0x4B, 0x22, 0xAD, 0x22, 0xAD, 0x22, 0x4B, 0x1A, 0x8C, 0x22, 0x70, 0x2B, 0xAD, 0x22, 0x2B, 0x12, 0xCD, 0x22, 0x2F, 0x1B, 0x6C, 0x1A, 0x4B, 0x1A, 0x4F, 0x23, 0xC9, 0x01, 0x2B, 0x12, 0x8C, 0x1A, 0xED, 0x1A, 0x0A, 0x12,
+    0xE9, 0x09, 0x4B, 0x12, 0x2B, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0xAC, 0x1A, 0x0E, 0x23, 0x4B, 0x12, 0xAC, 0x1A, 0x8C, 0x12, 0x4B, 0x0A, 0xCC, 0x1A, 0x2E, 0x1B, 0x2E, 0x1B, 0x4F, 0x1B, 0x2F, 0x1B, 0xC7, 0x41, 0xAC, 0x52, 0x26, 0x52, 0x8A, 0x4A, 0xC6, 0x49, 0x29, 0x4A, 0x4E, 0x5B, 0xC8, 0x31, 0x4A, 0x42, 0x08, 0x42, 0x08, 0x42, 0xC7, 0x41, 0x4E, 0x5B, 0x08, 0x42, 0x6E, 0x6B, 0x29, 0x42,
+    0xC7, 0x41, 0xAF, 0x73, 0xCF, 0x73, 0x6A, 0x4A, 0xE7, 0x49, 0x2D, 0x6B, 0xF1, 0x73, 0xE8, 0x49, 0x6A, 0x4A, 0x4A, 0x42, 0xB2, 0x8C, 0x6E, 0x6B, 0x29, 0x4A, 0x29, 0x52, 0xF0, 0xCC, 0xF6, 0xFF, 0xE8, 0x41, 0x6A, 0x42, 0xAB, 0x4A, 0x76, 0x95, 0x52, 0x74, 0x6A, 0x3A, 0xCC, 0x4A, 0x09, 0x2A, 0x2E, 0x43, 0x6B, 0x3A, 0x4B, 0x2A, 0x2E, 0x3B, 0x91, 0x33, 0xAC, 0x2A, 0x4B, 0x22, 0x6B, 0x22,
+    0x54, 0x4C, 0x6C, 0x22, 0x4B, 0x1A, 0x4B, 0x22, 0xD1, 0x33, 0x4C, 0x1A, 0x0B, 0x12, 0x0A, 0x12, 0x4F, 0x2B, 0x6C, 0x02, 0x4B, 0x1A, 0x09, 0x12, 0xF2, 0x33, 0x13, 0x24, 0xC9, 0x09, 0x8C, 0x22, 0x0E, 0x13, 0xCE, 0x12, 0xEA, 0x09, 0x6B, 0x1A, 0x4F, 0x1B, 0x2B, 0x0A, 0x6B, 0x1A, 0xAC, 0x22, 0xAC, 0x1A, 0x4B, 0x12, 0x0E, 0x23, 0xCC, 0x12, 0x6F, 0x1B, 0x6F, 0x23, 0x90, 0x23, 0x70, 0x1B,
+    0xA6, 0x31, 0xEC, 0x5A, 0xE7, 0x49, 0x0D, 0x53, 0x0C, 0x6B, 0x28, 0x4A, 0xC7, 0x41, 0x08, 0x42, 0xA7, 0x29, 0x0C, 0x5B, 0xE7, 0x41, 0x29, 0x4A, 0x6A, 0x42, 0xD0, 0x63, 0xAF, 0x73, 0x8A, 0x52, 0x29, 0x4A, 0xE8, 0x41, 0xA7, 0x31, 0x92, 0x94, 0xC7, 0x39, 0x08, 0x42, 0x6A, 0x52, 0x09, 0x3A, 0x10, 0x6C, 0x08, 0x42, 0x09, 0x4A, 0x4A, 0x42, 0x6A, 0x4A, 0xD0, 0x63, 0xCC, 0x62, 0x69, 0x52,
+    0x29, 0x42, 0x6A, 0x4A, 0xB0, 0x43, 0xAB, 0x42, 0x4A, 0x42, 0x29, 0x42, 0xCC, 0x4A, 0xB4, 0x5C, 0xCC, 0x42, 0xAB, 0x7A, 0x2A, 0x2A, 0x4B, 0x2A, 0x34, 0x34, 0xCC, 0x32, 0x4B, 0x22, 0x0A, 0x1A, 0xEA, 0x19, 0xD5, 0x34, 0x8C, 0x22, 0xE9, 0x11, 0x0A, 0x1A, 0x2F, 0x0B, 0xF2, 0x33, 0x0A, 0x12, 0x8C, 0x2A, 0x0A, 0x1A, 0x91, 0x23, 0x4F, 0x2B, 0xC9, 0x09, 0x4B, 0x1A, 0x0A, 0x0A, 0x34, 0x1C,
+    0x0A, 0x02, 0xEA, 0x11, 0x2A, 0x1A, 0xF2, 0x23, 0xC9, 0x01, 0x2A, 0x12, 0x2B, 0x12, 0xD1, 0x2B, 0xF3, 0x23, 0x8B, 0x1A, 0xED, 0x1A, 0x0E, 0x23, 0x2E, 0x1B, 0x70, 0x23, 0x90, 0x1B, 0x4F, 0x23, 0x08, 0x4A, 0xA6, 0x41, 0xE7, 0x49, 0xE8, 0x51, 0xE8, 0x49, 0x28, 0x52, 0x4A, 0x4A, 0xC7, 0x41, 0x24, 0x29, 0x08, 0x4A, 0xCB, 0x5A, 0xC7, 0x41, 0xE7, 0x41, 0x4D, 0x73, 0xC7, 0x41, 0x49, 0x52,
+    0xAB, 0x62, 0x6A, 0x4A, 0x8A, 0x62, 0xE8, 0x49, 0xA6, 0x39, 0xEA, 0x62, 0x6A, 0x5A, 0xCC, 0xFA, 0xE8, 0x41, 0x69, 0x52, 0xCC, 0x5A, 0x8A, 0x5A, 0xF3, 0x9C, 0x08, 0x4A, 0x8A, 0x5A, 0x29, 0x6A, 0x08, 0x52, 0x73, 0x6C, 0xF0, 0x8B, 0x4D, 0x6B, 0x09, 0x4A, 0xFF, 0xFF, 0x8F, 0x63, 0xB0, 0x63, 0xAB, 0x4A, 0x8C, 0x52, 0x0A, 0x22, 0xC9, 0x21, 0x54, 0x34, 0x4E, 0x4B, 0x4B, 0x32, 0xCD, 0x3A,
+    0xAC, 0x22, 0x54, 0x2C, 0x0A, 0x22, 0xE9, 0x11, 0xA9, 0x11, 0x2A, 0x1A, 0xF7, 0x44, 0x14, 0x1C, 0xAC, 0x32, 0x2A, 0x1A, 0x6B, 0x22, 0x50, 0x23, 0xD6, 0x34, 0xAC, 0x22, 0x0A, 0x1A, 0xE9, 0x11, 0x2A, 0x12, 0x75, 0x24, 0x33, 0x2C, 0xC9, 0x11, 0x4B, 0x22, 0x4B, 0x12, 0x33, 0x24, 0x4B, 0x1A, 0xAD, 0x1A, 0x8C, 0x22, 0x4F, 0x2B, 0x33, 0x24, 0xF2, 0x2B, 0xED, 0x1A, 0x4F, 0x23, 0x0E, 0x1B,
+    0xC7, 0x49, 0xE7, 0x49, 0xC7, 0x59, 0x48, 0xFB, 0xE8, 0x51, 0x86, 0x41, 0x48, 0x5A, 0x28, 0x52, 0x86, 0x39, 0x08, 0x4A, 0x69, 0x52, 0x28, 0x4A, 0xE7, 0x41, 0xCB, 0x62, 0x46, 0x5A, 0x88, 0x72, 0xE8, 0x51, 0xC7, 0x49, 0x89, 0x93, 0x86, 0x49, 0x4D, 0x6B, 0x69, 0x52, 0x07, 0x4A, 0x08, 0x52, 0x2D, 0x6B, 0x29, 0x52, 0xE8, 0x49, 0xEB, 0x6A, 0x0C, 0x6B, 0xE8, 0x71, 0x23, 0xBB, 0x68, 0x82,
+    0xEA, 0xCC, 0x0E, 0xB4, 0x49, 0x52, 0xAB, 0x52, 0x8F, 0x7B, 0x08, 0x42, 0x69, 0x5A, 0x8B, 0x42, 0xF1, 0x7B, 0x4A, 0x32, 0x2A, 0x2A, 0xC8, 0x19, 0xCD, 0x42, 0xF0, 0xAB, 0x2A, 0x2A, 0x0A, 0x22, 0x6B, 0x22, 0x09, 0x1A, 0xE9, 0x19, 0x4B, 0x1A, 0x67, 0x01, 0x2A, 0x22, 0xE9, 0x19, 0x2F, 0x23, 0x6E, 0x4B, 0xE9, 0x19, 0x09, 0x12, 0x6F, 0x33, 0x2A, 0x1A, 0x09, 0x12, 0x0A, 0x12, 0x6B, 0x1A,
+    0xC9, 0x11, 0x09, 0x1A, 0x88, 0x01, 0xC9, 0x11, 0x0A, 0x1A, 0x4B, 0x1A, 0xAC, 0x22, 0xAC, 0x1A, 0x75, 0x2C, 0x8C, 0x22, 0xED, 0x1A, 0xEE, 0x1A, 0x0D, 0x1B, 0x13, 0x2C, 0x33, 0x2C, 0x2F, 0x1B, 0x07, 0x52, 0xC7, 0x49, 0x08, 0x52, 0x08, 0x4A, 0xC7, 0x49, 0xA7, 0x39, 0xE8, 0x49, 0xE7, 0x41, 0xC7, 0x41, 0xC7, 0x41, 0xE6, 0x49, 0x07, 0x42, 0xE7, 0x41, 0x04, 0x31, 0xEC, 0x6A, 0x28, 0x52,
+    0x69, 0x5A, 0xC6, 0x41, 0x0C, 0x63, 0xC7, 0x49, 0xA6, 0x41, 0x08, 0x52, 0xB8, 0xFF, 0x47, 0x62, 0x28, 0x52, 0x08, 0x4A, 0xA9, 0x8A, 0x10, 0xC5, 0xE7, 0x49, 0x49, 0x6A, 0x12, 0xE6, 0xFD, 0xFF, 0xC8, 0x8A, 0x8A, 0x62, 0x49, 0x52, 0xEF, 0x93, 0x8A, 0x5A, 0x29, 0x52, 0x08, 0x4A, 0x29, 0x42, 0xB2, 0x9C, 0xE8, 0x31, 0xC8, 0x19, 0x87, 0x19, 0x53, 0x5C, 0x0C, 0x53, 0xC8, 0x19, 0x2A, 0x22,
+    0x90, 0x33, 0x6B, 0x32, 0x4B, 0x22, 0xA8, 0x11, 0x32, 0x34, 0x09, 0x1A, 0xA8, 0x11, 0x4A, 0x22, 0x4A, 0x1A, 0xCC, 0x2A, 0xA8, 0x09, 0x2A, 0x1A, 0x2F, 0x1B, 0xC8, 0x01, 0xA8, 0x09, 0xA8, 0x09, 0x90, 0x1B, 0x4F, 0x2B, 0x88, 0x09, 0xC9, 0x11, 0x2E, 0x2B, 0xED, 0x1A, 0x8B, 0x22, 0x6B, 0x1A, 0x6B, 0x1A, 0x6B, 0x1A, 0xED, 0x22, 0xAC, 0x12, 0xED, 0x1A, 0x2F, 0x23, 0x0E, 0x1B, 0x0E, 0x1B,
+    0xE7, 0x49, 0xEC, 0x62, 0x28, 0x52, 0xC7, 0x41, 0xE7, 0x49, 0x86, 0x31, 0xEC, 0x6A, 0x28, 0x4A, 0xE7, 0x41, 0xE7, 0x49, 0xC7, 0x41, 0xAA, 0x5A, 0xEB, 0x62, 0xC7, 0x41, 0x08, 0x42, 0xA7, 0x39, 0x28, 0x52, 0x8A, 0x62, 0xC7, 0x49, 0xA7, 0x41, 0x6D, 0x73, 0x0F, 0x8C, 0x27, 0x6A, 0x06, 0xD3, 0xEB, 0x6A, 0xD2, 0x9C, 0xEF, 0x83, 0xAA, 0x5A, 0xE7, 0x41, 0x08, 0x4A, 0xB0, 0xD4, 0x29, 0x7B,
+    0x89, 0x62, 0xCA, 0x62, 0xEF, 0xAB, 0xAF, 0x73, 0xE7, 0x81, 0xFF, 0xFF, 0xE7, 0x61, 0xF0, 0x83, 0x4A, 0x3A, 0x2A, 0x42, 0xA7, 0x19, 0x09, 0x22, 0x50, 0x3B, 0xCC, 0x52, 0xC9, 0x21, 0xCC, 0x3A, 0xED, 0x3A, 0x4E, 0x3B, 0x2A, 0x22, 0xC9, 0x19, 0xC8, 0x11, 0xD1, 0x1B, 0xD8, 0x65, 0xE9, 0x19, 0x4A, 0x22, 0x33, 0x2C, 0x0A, 0x1A, 0xC9, 0x19, 0x4A, 0x1A, 0xE9, 0x11, 0x4C, 0x0A, 0xA8, 0x09,
+    0xC8, 0x19, 0xA8, 0x11, 0xB0, 0x2B, 0x09, 0x12, 0x67, 0x01, 0x0A, 0x1A, 0xC9, 0x11, 0x0E, 0x2B, 0x6B, 0x1A, 0xC8, 0x09, 0xAC, 0x1A, 0xCD, 0x1A, 0x0E, 0x13, 0x0E, 0x23, 0x0E, 0x23, 0x4F, 0x23, 0xC6, 0x49, 0x07, 0x52, 0xAE, 0xDB, 0x28, 0x3A, 0xCB, 0x5A, 0xE7, 0x49, 0xE7, 0x49, 0xE7, 0x41, 0x8F, 0x5B, 0x10, 0x84, 0xA6, 0x39, 0xC7, 0x49, 0x08, 0x52, 0xD0, 0x6B, 0x2D, 0x7B, 0x65, 0x41,
+    0x08, 0x52, 0xC6, 0x49, 0x65, 0x41, 0x53, 0xE5, 0x65, 0x41, 0x05, 0xDB, 0x2C, 0x8B, 0x4B, 0x9B, 0xBA, 0xCE, 0x8E, 0x7B, 0xAB, 0x5A, 0x28, 0x4A, 0x08, 0x3A, 0xAF, 0x5B, 0xC7, 0x41, 0x69, 0x52, 0x68, 0x52, 0x6E, 0x7B, 0xD1, 0x63, 0x08, 0x3A, 0x8A, 0x62, 0xC7, 0x79, 0x8A, 0x52, 0x32, 0x5C, 0x09, 0x3A, 0x29, 0x3A, 0x67, 0x19, 0x09, 0x2A, 0x94, 0x4C, 0x6A, 0x3A, 0xE8, 0x21, 0x2A, 0x2A,
+    0xE8, 0x21, 0x70, 0x2B, 0xC8, 0x19, 0x4B, 0x22, 0xE9, 0x19, 0xC8, 0x11, 0x0A, 0x0A, 0x06, 0x01, 0x2A, 0x22, 0xE8, 0x11, 0xEA, 0x09, 0xC9, 0x01, 0xC9, 0x11, 0xC8, 0x11, 0x88, 0x09, 0xD0, 0x33, 0x4B, 0x1A, 0x2A, 0x12, 0x09, 0x1A, 0xAD, 0x22, 0xE9, 0x01, 0x2A, 0x1A, 0x09, 0x12, 0xE9, 0x11, 0xED, 0x1A, 0xCD, 0x22, 0xAC, 0x1A, 0xCD, 0x1A, 0x0D, 0x23, 0x2D, 0x23, 0x2F, 0x1B, 0x2E, 0x1B,
+    0xA6, 0x51, 0x2E, 0x53, 0xC7, 0x49, 0x24, 0x31, 0xA6, 0x49, 0x08, 0x52, 0x8F, 0x5B, 0xCB, 0x5A, 0xE7, 0x49, 0x28, 0x52, 0xC7, 0x41, 0xC7, 0x51, 0xCF, 0x63, 0xE7, 0x51, 0xA6, 0x49, 0xA7, 0xA9, 0xE8, 0x71, 0x4E, 0x53, 0xE8, 0x51, 0x86, 0x41, 0x0C, 0x6B, 0xE7, 0x51, 0x8A, 0x62, 0x8E, 0x6B, 0xA6, 0x39, 0x28, 0x4A, 0xE8, 0x49, 0x8A, 0x5A, 0xD1, 0x5B, 0x28, 0x4A, 0x28, 0x4A, 0x49, 0x52,
+    0xC5, 0x71, 0xF2, 0x53, 0xEC, 0x4A, 0x08, 0x42, 0x2E, 0x63, 0xA7, 0x39, 0xE8, 0x39, 0x09, 0x3A, 0x29, 0x32, 0x8A, 0x3A, 0x8B, 0x32, 0x6B, 0x2A, 0x33, 0x44, 0x4A, 0x3A, 0xA7, 0x11, 0x6B, 0x2A, 0x2A, 0x22, 0x70, 0x1B, 0x2A, 0x22, 0x2A, 0x22, 0x47, 0x09, 0xE9, 0x19, 0xB5, 0x34, 0x0E, 0x23, 0x29, 0x1A, 0xC8, 0x11, 0xC8, 0x19, 0xD2, 0x2B, 0x2A, 0x22, 0xC9, 0x11, 0xC9, 0x11, 0x0D, 0x2B,
+    0x2E, 0x2B, 0x33, 0x2C, 0xED, 0x22, 0x2A, 0x22, 0xE9, 0x19, 0x4B, 0x1A, 0xCE, 0x22, 0x4B, 0x1A, 0x0A, 0x12, 0x4A, 0x1A, 0xED, 0x22, 0xB1, 0x1B, 0x73, 0x34, 0xED, 0x1A, 0x0E, 0x23, 0xED, 0x1A, 0x28, 0x62, 0xE7, 0x51, 0x08, 0x5A, 0xE7, 0x49, 0xC6, 0x49, 0x89, 0x5A, 0x28, 0x52, 0xA6, 0x41, 0xC7, 0x49, 0x86, 0x31, 0xCB, 0x62, 0x2D, 0x5B, 0x08, 0x52, 0xC7, 0x49, 0xCC, 0x82, 0xA6, 0x69,
+    0x28, 0x6A, 0x69, 0x62, 0x08, 0x4A, 0xA6, 0x41, 0xC6, 0x41, 0x89, 0x72, 0x87, 0x82, 0xCF, 0x8B, 0xEC, 0xFC, 0xA6, 0x39, 0x28, 0x4A, 0x89, 0x62, 0xC7, 0x41, 0xE8, 0x41, 0x28, 0x52, 0x08, 0x52, 0x08, 0x3A, 0xEB, 0x5A, 0x8B, 0x52, 0xC7, 0x39, 0xE8, 0x41, 0xEC, 0x5A, 0xE8, 0x31, 0xC8, 0x31, 0xE8, 0x81, 0xE8, 0x31, 0x87, 0x21, 0xA8, 0x29, 0xB1, 0x4B, 0x4A, 0x32, 0xE9, 0x29, 0xA8, 0x21,
+    0xCD, 0x22, 0x8C, 0x22, 0x4A, 0x2A, 0xE9, 0x21, 0x90, 0x33, 0xC8, 0x11, 0x4A, 0x22, 0xD6, 0x34, 0x2E, 0x2B, 0xA8, 0x09, 0x29, 0x22, 0x66, 0x09, 0x32, 0x34, 0xC9, 0x11, 0x09, 0x22, 0x09, 0x22, 0x6F, 0x23, 0x87, 0x09, 0xF3, 0x2B, 0x94, 0x5C, 0x8C, 0x12, 0xE9, 0x11, 0xC8, 0x11, 0xB1, 0x2B, 0xD2, 0x23, 0x8C, 0x1A, 0x6B, 0x1A, 0xAC, 0x1A, 0xAC, 0x1A, 0x32, 0x24, 0x76, 0x4D, 0x0E, 0x23,
+    0x28, 0x62, 0x07, 0x5A, 0x28, 0x62, 0x8A, 0x52, 0xE7, 0x51, 0x85, 0x81, 0xE7, 0x51, 0xC6, 0x49, 0x0C, 0x6B, 0xE7, 0x49, 0xC6, 0x41, 0x8E, 0x7B, 0x2C, 0x73, 0x65, 0x41, 0xC7, 0x49, 0xA6, 0x49, 0x0B, 0x6B, 0x2C, 0x63, 0x45, 0x31, 0xCB, 0x6A, 0xE6, 0x59, 0x6B, 0xAB, 0x08, 0x83, 0xF8, 0xFF, 0xEB, 0x6A, 0x65, 0x31, 0x91, 0x9C, 0x0B, 0x6B, 0x69, 0x52, 0x69, 0x4A, 0xEB, 0xE2, 0xEC, 0x62,
+    0xE7, 0x41, 0x8A, 0x52, 0xA7, 0x41, 0xE8, 0x31, 0x08, 0x42, 0x4D, 0x73, 0x29, 0x42, 0xE8, 0x39, 0x29, 0x3A, 0xC8, 0x31, 0xE8, 0x29, 0x66, 0x19, 0x52, 0x64, 0x6A, 0x3A, 0xA8, 0x21, 0xC8, 0x21, 0x32, 0x3C, 0xA8, 0x19, 0x29, 0x2A, 0xC8, 0x21, 0xA8, 0x19, 0xE9, 0x21, 0x6F, 0x43, 0x8F, 0x43, 0xC8, 0x19, 0xD1, 0x2B, 0xA8, 0x11, 0x4B, 0x2A, 0xD0, 0x43, 0xAC, 0x2A, 0x09, 0x1A, 0x09, 0x22,
+    0x6B, 0x22, 0x4F, 0x33, 0x6F, 0x2B, 0xC8, 0x19, 0x2A, 0x22, 0x88, 0x09, 0xD1, 0x3B, 0x09, 0x1A, 0x29, 0x12, 0x29, 0x12, 0x8C, 0x22, 0xCC, 0x22, 0x09, 0x12, 0xAC, 0x1A, 0x6B, 0x1A, 0x0D, 0x1B, 0x07, 0x62, 0x8A, 0x52, 0xE7, 0xA1, 0x28, 0x5A, 0x07, 0x5A, 0x48, 0x5A, 0x6D, 0x63, 0xC6, 0x49, 0xE7, 0x51, 0x07, 0x4A, 0x6E, 0x63, 0x89, 0x5A, 0x08, 0x4A, 0xA6, 0x49, 0x6C, 0xFE, 0x08, 0x3A,
+    0x8A, 0x62, 0x86, 0x41, 0xC6, 0x41, 0x2C, 0x5B, 0x4D, 0x63, 0x69, 0x5A, 0x49, 0x62, 0x07, 0x4A, 0xC7, 0x41, 0xEF, 0x7B, 0x86, 0x49, 0x08, 0x4A, 0x07, 0xB3, 0x4D, 0x7B, 0x8A, 0x5A, 0xA6, 0x39, 0x27, 0x4A, 0x6A, 0x52, 0xB5, 0xED, 0x08, 0x52, 0xCB, 0x6A, 0xCB, 0x5A, 0x08, 0x3A, 0x93, 0x6C, 0x29, 0x42, 0xA7, 0x29, 0xA8, 0x29, 0x46, 0x19, 0xF1, 0x53, 0x6A, 0x42, 0x87, 0x19, 0xC8, 0x21,
+    0x06, 0x11, 0xC8, 0x19, 0x09, 0x22, 0x8B, 0x22, 0x46, 0x09, 0x12, 0x2C, 0x4A, 0x2A, 0x2A, 0x1A, 0xE8, 0x19, 0xE9, 0x21, 0xCC, 0x1A, 0xA8, 0x09, 0xE5, 0x00, 0xE8, 0x11, 0xA8, 0x01, 0x67, 0x09, 0x09, 0x22, 0xE8, 0x11, 0xC8, 0x11, 0x66, 0x09, 0xED, 0x22, 0x87, 0x09, 0x4A, 0x22, 0xE9, 0x11, 0x4A, 0x1A, 0x2A, 0x1A, 0x2A, 0x12, 0x8B, 0x1A, 0x2A, 0x12, 0xED, 0x22, 0x0A, 0x12, 0xCD, 0x22,
+    0x07, 0x62, 0xE7, 0x61, 0x28, 0x62, 0x89, 0x5A, 0x0C, 0x5B, 0x69, 0x62, 0xE7, 0x51, 0xC6, 0x49, 0x4D, 0x63, 0x2C, 0x53, 0xC6, 0x41, 0x07, 0x4A, 0xE7, 0x49, 0xEC, 0x62, 0x4D, 0x63, 0xA6, 0x39, 0xC7, 0x49, 0xC6, 0x49, 0xC7, 0x41, 0x6D, 0x63, 0x2C, 0x6B, 0x86, 0x39, 0x86, 0x39, 0x86, 0x39, 0x6E, 0x6B, 0xC6, 0x51, 0xA7, 0x41, 0xE8, 0x51, 0x08, 0x42, 0xCF, 0x6B, 0x49, 0x4A, 0xE7, 0x49,
+    0x49, 0x52, 0xC7, 0x39, 0xF0, 0x6B, 0xA7, 0x39, 0x8F, 0x73, 0x66, 0x29, 0xC7, 0x31, 0x8F, 0x53, 0xE8, 0x31, 0xA7, 0x31, 0xA7, 0x21, 0x67, 0x21, 0x0E, 0x3B, 0x08, 0x32, 0xA7, 0x21, 0x09, 0x2A, 0x09, 0x22, 0xA8, 0x19, 0x4A, 0x2A, 0xE9, 0x21, 0x87, 0x19, 0xC9, 0x19, 0x0D, 0x4B, 0xCD, 0x32, 0xC8, 0x19, 0xA8, 0x19, 0xAC, 0x22, 0x2E, 0x23, 0x67, 0x11, 0xA8, 0x19, 0x87, 0x11, 0xA8, 0x09,
+    0x6A, 0x2A, 0x46, 0x09, 0x4A, 0x22, 0x87, 0x09, 0xF1, 0x2B, 0x87, 0x09, 0x29, 0x1A, 0x4A, 0x22, 0x4A, 0x1A, 0x50, 0x23, 0x2A, 0x1A, 0x8B, 0x22, 0xAB, 0x1A, 0xAC, 0x22, 0xAC, 0x22, 0x0E, 0x23, 0x48, 0x6A, 0xEC, 0x52, 0x8B, 0x5A, 0x07, 0x5A, 0x07, 0x62, 0x2C, 0xB3, 0xAA, 0x62, 0x2D, 0x53, 0x48, 0x62, 0x0F, 0x84, 0xEB, 0x62, 0xC6, 0x41, 0x0D, 0x4B, 0xE7, 0x41, 0x28, 0x5A, 0xA6, 0x41,
+    0x6A, 0x52, 0x0C, 0x5B, 0xA6, 0x39, 0xAA, 0x42, 0x03, 0x31, 0x24, 0x29, 0x45, 0x31, 0x4C, 0x63, 0x49, 0x52, 0x6A, 0x4A, 0x4C, 0xA3, 0x09, 0x8A, 0xAF, 0x6B, 0xC7, 0x41, 0xE8, 0x41, 0xE8, 0x41, 0x4D, 0x5B, 0xF2, 0xCC, 0xE8, 0x39, 0x08, 0x42, 0xC7, 0x39, 0x8A, 0x52, 0xE8, 0x39, 0x87, 0x39, 0x4A, 0x62, 0x08, 0x3A, 0xA8, 0x29, 0x66, 0x19, 0x90, 0x4B, 0xE8, 0x39, 0x25, 0x11, 0xA8, 0x21,
+    0x90, 0x4B, 0x32, 0x4C, 0x8C, 0x3A, 0x2A, 0x2A, 0x0D, 0x2B, 0xC8, 0x19, 0x53, 0x34, 0xC8, 0x19, 0x0E, 0x33, 0x4A, 0x2A, 0x87, 0x11, 0xD1, 0x2B, 0xE9, 0x11, 0x66, 0x09, 0x66, 0x11, 0xE8, 0x21, 0xD1, 0x2B, 0x87, 0x11, 0x67, 0x11, 0x87, 0x11, 0x6F, 0x3B, 0x09, 0x12, 0x8C, 0x12, 0x4A, 0x22, 0x4A, 0x1A, 0x09, 0x12, 0xE9, 0x09, 0x0E, 0x1B, 0x8B, 0x1A, 0xCD, 0x22, 0xEC, 0x22, 0xCC, 0x1A,
+    0x47, 0x72, 0x27, 0x6A, 0x27, 0x6A, 0x27, 0x5A, 0x28, 0x5A, 0x45, 0x41, 0x28, 0x62, 0xA5, 0x49, 0x2C, 0x73, 0x08, 0x52, 0x08, 0x52, 0x07, 0x4A, 0xE7, 0x51, 0xA6, 0x49, 0x65, 0x39, 0xC6, 0x41, 0xA6, 0x39, 0xAD, 0x73, 0x85, 0x39, 0xE7, 0x49, 0x44, 0x31, 0x45, 0x29, 0xC7, 0x49, 0x86, 0x39, 0xC7, 0x41, 0xC7, 0x51, 0xCA, 0x62, 0x07, 0x4A, 0x27, 0xDC, 0xC6, 0x41, 0xE8, 0x41, 0xF0, 0x6B,
+    0xE8, 0x39, 0xAB, 0x62, 0x8A, 0x52, 0xA4, 0xB8, 0x86, 0x31, 0xEC, 0x5A, 0x29, 0x4A, 0xA6, 0xB1, 0xE8, 0x91, 0xC7, 0x31, 0x87, 0x29, 0xA7, 0x31, 0x12, 0x64, 0xC8, 0x51, 0xA7, 0x29, 0x87, 0x21, 0xD1, 0x4B, 0x32, 0x44, 0x4A, 0x32, 0x47, 0x11, 0xAC, 0x2A, 0xA8, 0x19, 0x8B, 0x2A, 0x53, 0x3C, 0xAC, 0x1A, 0x8B, 0x22, 0x09, 0x22, 0x66, 0x11, 0x12, 0x34, 0x09, 0x1A, 0xC8, 0x19, 0x67, 0x11,
+    0xF4, 0x5C, 0x8F, 0x33, 0x0A, 0x0A, 0xC8, 0x19, 0xA8, 0x11, 0xEC, 0x22, 0x4A, 0x12, 0xB1, 0x23, 0x09, 0x1A, 0x6B, 0x22, 0x8B, 0x22, 0x2A, 0x12, 0x6B, 0x1A, 0x6B, 0x12, 0x4A, 0x12, 0xED, 0x22, 0x69, 0x9A, 0xAA, 0x6A, 0x27, 0x62, 0x48, 0x62, 0x06, 0x62, 0x45, 0x39, 0xEB, 0x62, 0xC6, 0x41, 0x28, 0x5A, 0x28, 0x5A, 0x28, 0x52, 0xE7, 0x49, 0xE7, 0x49, 0x28, 0x5A, 0xA6, 0x39, 0xC7, 0x49,
+    0x86, 0x41, 0xC7, 0x49, 0x44, 0x39, 0x44, 0x31, 0x45, 0x31, 0xAE, 0x7B, 0xE4, 0x20, 0xA6, 0x39, 0xE7, 0x41, 0xEB, 0x52, 0xC6, 0x41, 0xA6, 0x39, 0xEA, 0x7A, 0xC6, 0x41, 0x49, 0x4A, 0x89, 0x5A, 0x66, 0x31, 0xE8, 0x41, 0x8A, 0x52, 0xA7, 0x39, 0x0C, 0x5B, 0xC7, 0x39, 0x04, 0x29, 0xD0, 0x8B, 0x69, 0x52, 0x04, 0x19, 0x25, 0x21, 0x05, 0x19, 0xEE, 0x72, 0x08, 0x3A, 0xE4, 0x10, 0x6A, 0x3A,
+    0x11, 0x64, 0xEC, 0x3A, 0x6A, 0x3A, 0x2D, 0x3B, 0xAB, 0x3A, 0xB0, 0x43, 0xA7, 0x19, 0x09, 0x1A, 0xA7, 0x11, 0x46, 0x11, 0x05, 0x09, 0xE9, 0x19, 0xC8, 0x21, 0x46, 0x09, 0x6B, 0x2A, 0x46, 0x09, 0x66, 0x11, 0x66, 0x11, 0xD1, 0x33, 0x66, 0x11, 0xA7, 0x11, 0xC8, 0x19, 0xED, 0x22, 0x66, 0x09, 0x29, 0x1A, 0x2A, 0x1A, 0xCC, 0x2A, 0xA8, 0x09, 0xCC, 0x22, 0xB1, 0x23, 0xCC, 0x22, 0xCC, 0x22,
+    0x68, 0x7A, 0x68, 0x7A, 0xA9, 0x7A, 0x68, 0x72, 0xE6, 0x61, 0xC6, 0x51, 0x27, 0x62, 0x07, 0x5A, 0x07, 0x5A, 0x85, 0x41, 0xA6, 0x49, 0xE7, 0x41, 0xA6, 0x41, 0x08, 0x4A, 0x03, 0x29, 0x8D, 0x73, 0xE3, 0x20, 0x65, 0x31, 0x24, 0x31, 0x24, 0x29, 0x8E, 0x73, 0x24, 0x29, 0x44, 0x31, 0xE3, 0x20, 0xC7, 0x41, 0x8A, 0x62, 0x45, 0x31, 0xE7, 0x49, 0x2C, 0x63, 0x08, 0x4A, 0xE7, 0x49, 0x65, 0x31,
+    0xEB, 0x62, 0xE8, 0x41, 0xF0, 0x6B, 0x48, 0x52, 0x2D, 0x63, 0x69, 0x4A, 0x45, 0x29, 0x2E, 0x5B, 0x49, 0x4A, 0x25, 0x21, 0x25, 0x21, 0x67, 0x29, 0x8F, 0x63, 0x29, 0x42, 0x66, 0x21, 0xC8, 0x31, 0x8A, 0x22, 0x87, 0x21, 0xE8, 0x29, 0x87, 0x19, 0xA7, 0x19, 0x4B, 0x2A, 0xE8, 0x29, 0xC8, 0x19, 0x66, 0x11, 0xC8, 0x21, 0x05, 0x09, 0x6B, 0x22, 0x87, 0x11, 0x05, 0x09, 0xB0, 0x3B, 0xC8, 0x19,
+    0x26, 0x09, 0x25, 0x09, 0x25, 0x09, 0x2E, 0x1B, 0x09, 0x1A, 0xA7, 0x11, 0x66, 0x09, 0x67, 0x01, 0xED, 0x1A, 0xC8, 0x11, 0x4A, 0x22, 0x67, 0x09, 0x6A, 0x1A, 0x6A, 0x12, 0x8C, 0x1A, 0xCD, 0x22, 0x88, 0x82, 0x88, 0x7A, 0x07, 0x6A, 0x68, 0x6A, 0x2C, 0x63, 0x48, 0x52, 0xCA, 0x62, 0x86, 0x41, 0xE7, 0x59, 0x4D, 0x63, 0xE7, 0x49, 0x08, 0x52, 0xE8, 0x49, 0x86, 0x41, 0x51, 0xB5, 0x24, 0x29,
+    0xE3, 0x20, 0x85, 0x31, 0x03, 0x29, 0x10, 0xB4, 0x45, 0x31, 0x24, 0x29, 0x04, 0x31, 0x48, 0x52, 0x68, 0x52, 0xE7, 0x49, 0x48, 0x5A, 0xAA, 0xF2, 0x4C, 0x7B, 0x2C, 0x7B, 0x85, 0x41, 0xA6, 0x49, 0x66, 0x39, 0xAE, 0x7B, 0xCF, 0x83, 0x28, 0xA3, 0x85, 0x41, 0x25, 0x21, 0xE4, 0x20, 0x2D, 0x5B, 0xC7, 0x39, 0xE4, 0x18, 0x25, 0x19, 0x05, 0x21, 0x8B, 0x42, 0xEB, 0x6A, 0x26, 0x19, 0xC7, 0x29,
+    0xEC, 0x32, 0xE8, 0x31, 0xA8, 0x21, 0xA8, 0x21, 0x0C, 0x33, 0x87, 0x21, 0xC8, 0x19, 0x29, 0x32, 0xCB, 0x2A, 0x46, 0x09, 0x26, 0x09, 0x26, 0x09, 0x46, 0x11, 0x4A, 0x22, 0xE4, 0x00, 0x0E, 0x23, 0x67, 0x11, 0x46, 0x09, 0x25, 0x09, 0x45, 0x09, 0x67, 0x01, 0x26, 0x09, 0xE8, 0x19, 0xC8, 0x19, 0xE8, 0x19, 0x0D, 0x2B, 0x87, 0x09, 0x29, 0x1A, 0x6A, 0x22, 0x8B, 0x1A, 0x6A, 0x1A, 0x0E, 0x2B,
+    0x88, 0x82, 0xEA, 0x7A, 0xCB, 0x52, 0x27, 0x5A, 0x89, 0x62, 0x68, 0x72, 0x48, 0x62, 0x53, 0xBD, 0x48, 0x62, 0x48, 0x62, 0x08, 0x52, 0x44, 0x31, 0x2B, 0x6B, 0xC7, 0x41, 0x07, 0x42, 0xE3, 0x20, 0x04, 0x21, 0xCB, 0x62, 0x28, 0x7B, 0xC2, 0x20, 0x44, 0x39, 0x44, 0x39, 0x6F, 0xF6, 0xA9, 0x6A, 0x48, 0x5A, 0xA6, 0x79, 0x85, 0x71, 0x49, 0xA2, 0x72, 0x94, 0x86, 0x41, 0x86, 0x71, 0xEE, 0xFF,
+    0x45, 0x41, 0x66, 0x39, 0x25, 0x29, 0x27, 0xFA, 0x65, 0x31, 0x05, 0x21, 0x25, 0x29, 0x66, 0x31, 0xAB, 0x62, 0x25, 0x21, 0x25, 0x21, 0x66, 0x59, 0xE8, 0xE9, 0x08, 0x4A, 0x66, 0x21, 0xA7, 0x39, 0x31, 0x5C, 0xD1, 0x4B, 0x46, 0x29, 0x2A, 0x2A, 0x6A, 0x3A, 0x6A, 0x3A, 0xF1, 0x33, 0x08, 0x2A, 0x25, 0x01, 0x46, 0x11, 0x4A, 0x1A, 0x90, 0x2B, 0x66, 0x11, 0x05, 0x09, 0xE4, 0x00, 0x67, 0x09,
+    0xC9, 0x11, 0x25, 0x01, 0x46, 0x09, 0x25, 0x09, 0xC8, 0x19, 0xCD, 0x1A, 0x09, 0x12, 0x87, 0x11, 0xC8, 0x19, 0x29, 0x22, 0xAB, 0x22, 0x6B, 0x22, 0x09, 0x12, 0x4A, 0x1A, 0x8B, 0x1A, 0xAB, 0x1A, 0xC9, 0x92, 0xA9, 0x8A, 0x88, 0x7A, 0x44, 0x39, 0x06, 0x6A, 0x47, 0x62, 0x68, 0x6A, 0x45, 0x41, 0x8A, 0x52, 0xA7, 0x39, 0xC6, 0x51, 0x28, 0x52, 0xA6, 0x39, 0x88, 0x5A, 0x24, 0x29, 0x04, 0x29,
+    0x28, 0x52, 0x0B, 0x5B, 0x44, 0x31, 0x44, 0x31, 0x44, 0x39, 0x2D, 0x9C, 0x45, 0x39, 0x44, 0x39, 0xC6, 0x49, 0xA6, 0x59, 0x6C, 0x8B, 0x65, 0x41, 0xA6, 0x49, 0x07, 0x62, 0xD1, 0xFD, 0x86, 0x59, 0xAA, 0x62, 0xF1, 0x63, 0x86, 0x39, 0xA7, 0x41, 0xA7, 0x31, 0x45, 0x29, 0xAF, 0x73, 0x08, 0x4A, 0x8D, 0x53, 0xE4, 0x18, 0x25, 0x21, 0x25, 0x39, 0x0D, 0x53, 0x26, 0x21, 0x46, 0x21, 0x25, 0x11,
+    0x46, 0x19, 0x6F, 0x2B, 0x66, 0x19, 0x8B, 0x32, 0x09, 0x32, 0x6A, 0x32, 0xF0, 0x43, 0xC8, 0x19, 0xC4, 0x00, 0xA7, 0x11, 0x46, 0x11, 0x26, 0x09, 0x05, 0x01, 0xAC, 0x1A, 0x05, 0x09, 0xE4, 0x00, 0xA4, 0x00, 0xA4, 0x00, 0x26, 0x01, 0x66, 0x09, 0x46, 0x09, 0x87, 0x11, 0xED, 0x22, 0xA8, 0x11, 0xE8, 0x11, 0xA7, 0x11, 0xE8, 0x11, 0x2A, 0x12, 0xE8, 0x11, 0x4A, 0x1A, 0xCC, 0x22, 0x6A, 0x12,
+    0xA7, 0x8A, 0xAA, 0x5A, 0xA9, 0x7A, 0x84, 0x49, 0x47, 0x7A, 0x07, 0x5A, 0x8E, 0x83, 0x24, 0x39, 0xE6, 0x51, 0x65, 0x41, 0x04, 0x29, 0x28, 0x62, 0x85, 0x49, 0xE3, 0x20, 0xE4, 0x20, 0xC3, 0x18, 0x85, 0x39, 0x24, 0x31, 0x65, 0x31, 0x04, 0x29, 0x0B, 0x6B, 0x85, 0x59, 0x24, 0x31, 0x44, 0x39, 0xA6, 0x41, 0x07, 0x62, 0xE8, 0xC1, 0x86, 0x41, 0x88, 0x72, 0x26, 0x6A, 0xA6, 0x59, 0x45, 0x39,
+    0x86, 0x39, 0x66, 0x39, 0x09, 0x5A, 0x69, 0x6A, 0x66, 0x31, 0x86, 0x31, 0x04, 0x21, 0xE4, 0x20, 0x0D, 0x5B, 0x66, 0x21, 0x25, 0x19, 0x67, 0x29, 0x8B, 0x4A, 0xC7, 0x31, 0x26, 0x19, 0x66, 0x19, 0xB0, 0x4B, 0x05, 0x11, 0x26, 0x19, 0x67, 0x19, 0xC8, 0x21, 0x0A, 0x22, 0x05, 0x09, 0xC8, 0x21, 0x05, 0x09, 0x4A, 0x2A, 0x87, 0x19, 0x67, 0x11, 0xF2, 0x33, 0x46, 0x11, 0xAC, 0x1A, 0x25, 0x11,
+    0x66, 0x19, 0xC4, 0x00, 0xB1, 0x2B, 0xE8, 0x19, 0x46, 0x09, 0x66, 0x09, 0x46, 0x09, 0x90, 0x2B, 0x46, 0x09, 0x47, 0x01, 0xE9, 0x11, 0xE8, 0x11, 0xED, 0x1A, 0xB0, 0x2B, 0x6B, 0x1A, 0x8B, 0x22, 0x09, 0x9B, 0xC8, 0x92, 0x26, 0x7A, 0xC5, 0x59, 0x47, 0x7A, 0x85, 0x41, 0xC9, 0x72, 0x43, 0x39, 0xE5, 0x61, 0x05, 0x29, 0x04, 0x21, 0x85, 0x59, 0xE3, 0x30, 0x24, 0x29, 0x25, 0x29, 0xE4, 0x20,
+    0x8C, 0x83, 0x65, 0x31, 0x03, 0x21, 0x49, 0x52, 0x03, 0x39, 0x65, 0x69, 0xA5, 0x51, 0xEA, 0x6A, 0x07, 0x52, 0x86, 0x51, 0xA6, 0x91, 0x07, 0x52, 0xC5, 0x59, 0xA5, 0x51, 0x86, 0x49, 0x45, 0x41, 0x66, 0x39, 0x46, 0x31, 0xD0, 0x7B, 0x0B, 0x93, 0x66, 0x31, 0xE4, 0x20, 0x45, 0x29, 0x8F, 0x6B, 0x87, 0x31, 0x04, 0x19, 0x26, 0x19, 0x05, 0x19, 0x2E, 0x53, 0xE8, 0x39, 0x06, 0x11, 0xC8, 0x29,
+    0x2A, 0x2A, 0x05, 0x11, 0x46, 0x11, 0x46, 0x19, 0xE5, 0x00, 0x09, 0x22, 0xE4, 0x00, 0xC8, 0x21, 0xC8, 0x19, 0xE8, 0x21, 0x8F, 0x43, 0xA7, 0x19, 0x92, 0x5C, 0xA3, 0x00, 0x25, 0x11, 0x2D, 0x2B, 0x46, 0x11, 0x05, 0x09, 0xC4, 0x00, 0x25, 0x11, 0x46, 0x09, 0x46, 0x09, 0x87, 0x09, 0x66, 0x09, 0x86, 0x09, 0xA8, 0x11, 0x09, 0x1A, 0xC8, 0x11, 0x29, 0x1A, 0x8A, 0x1A, 0x29, 0x12, 0x4A, 0x1A,
+    0xE8, 0x92, 0xC9, 0x8A, 0xA8, 0x8A, 0xC9, 0x7A, 0x89, 0x62, 0x02, 0x39, 0xE6, 0x51, 0x85, 0x41, 0x04, 0x21, 0xE8, 0x39, 0x86, 0x31, 0x86, 0x39, 0x45, 0x31, 0x04, 0x29, 0xAA, 0x52, 0x25, 0x29, 0x65, 0x31, 0x44, 0x29, 0xCB, 0x5A, 0x6C, 0x73, 0x03, 0x39, 0xE6, 0x61, 0xE8, 0xEC, 0x86, 0x8B, 0xC7, 0x59, 0x84, 0x59, 0xE7, 0x71, 0x6C, 0x93, 0xCA, 0x72, 0xCE, 0xB3, 0x45, 0x51, 0x39, 0xD4,
+    0x86, 0x41, 0xAB, 0x5A, 0xEC, 0x62, 0xCF, 0x73, 0xE7, 0x39, 0x46, 0x29, 0x45, 0x29, 0x8B, 0x5A, 0x86, 0x31, 0x04, 0x19, 0x04, 0x11, 0x05, 0x19, 0xE5, 0x08, 0x66, 0x21, 0x05, 0x11, 0x66, 0x21, 0xE6, 0x10, 0x26, 0x11, 0x05, 0x11, 0xC4, 0x08, 0xC5, 0x08, 0x87, 0x19, 0x05, 0x09, 0x66, 0x19, 0xED, 0x32, 0x25, 0x09, 0xC4, 0x08, 0x46, 0x11, 0x46, 0x11, 0xE4, 0x00, 0xE4, 0x08, 0xC9, 0x19,
+    0x66, 0x11, 0x06, 0x09, 0xE5, 0x00, 0x05, 0x09, 0x0E, 0x23, 0x26, 0x01, 0x47, 0x09, 0x67, 0x09, 0x87, 0x11, 0xCC, 0x2A, 0xE9, 0x11, 0xE9, 0x11, 0x09, 0x12, 0x4A, 0x1A, 0x4A, 0x1A, 0x6A, 0x1A, 0xC8, 0x9A, 0xC9, 0x82, 0x4D, 0x63, 0xC6, 0x49, 0x48, 0x4A, 0xA1, 0x28, 0x03, 0x21, 0x2D, 0x5B, 0xC7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x05, 0x21, 0x10, 0x7C, 0x86, 0x31, 0x04, 0x21, 0x45, 0x29,
+    0x89, 0x52, 0x4C, 0x6B, 0xE6, 0x49, 0x44, 0x31, 0x85, 0x41, 0xC5, 0x59, 0x65, 0x72, 0xA5, 0x49, 0xA6, 0x51, 0x65, 0x51, 0xC3, 0x40, 0x45, 0x41, 0x2B, 0x6B, 0xC7, 0x69, 0xC7, 0xC9, 0x26, 0x71, 0x05, 0x39, 0xC7, 0x49, 0x24, 0x39, 0xA6, 0x49, 0x04, 0x29, 0x08, 0x52, 0x86, 0x31, 0x24, 0x21, 0xA6, 0x29, 0x45, 0x21, 0x04, 0x19, 0x05, 0x19, 0xC4, 0x08, 0x86, 0x21, 0xE5, 0x10, 0x87, 0x21,
+    0x6F, 0x4B, 0xF0, 0x4B, 0xE5, 0x10, 0x05, 0x11, 0x29, 0x22, 0xC8, 0x21, 0xB0, 0x3B, 0x46, 0x19, 0xE5, 0x08, 0xA7, 0x11, 0x25, 0x09, 0xB0, 0x3B, 0x05, 0x09, 0x6B, 0x1A, 0xE4, 0x00, 0xC4, 0x00, 0xAC, 0x1A, 0xA7, 0x11, 0xE5, 0x00, 0xE4, 0x00, 0x2A, 0x2A, 0x0E, 0x2B, 0x67, 0x01, 0x67, 0x09, 0x87, 0x09, 0xC8, 0x19, 0x8B, 0x1A, 0x2A, 0x1A, 0xE9, 0x11, 0xE9, 0x11, 0xE8, 0x11, 0x29, 0x12,
+    0xE8, 0x9A, 0xC9, 0x82, 0x4A, 0x9B, 0x07, 0x62, 0x87, 0x8A, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0x25, 0x29, 0xE4, 0x20, 0x04, 0x21, 0x25, 0x29, 0xE4, 0x20, 0x04, 0x29, 0x25, 0x29, 0x04, 0x21, 0x24, 0x29, 0x4D, 0x63, 0xC7, 0xBB, 0x85, 0x41, 0x44, 0x41, 0x44, 0x49, 0x8A, 0x5A, 0x04, 0x31, 0x65, 0x39, 0x24, 0x41, 0x65, 0x41, 0x44, 0x31, 0xAB, 0x5A, 0x85, 0x61, 0xF1, 0xFF, 0x65, 0x69,
+    0xC3, 0x28, 0x2E, 0x5B, 0x45, 0x31, 0x86, 0x41, 0x05, 0x29, 0x04, 0x21, 0xEC, 0x5A, 0x2E, 0x63, 0x45, 0x21, 0xC4, 0x10, 0xE4, 0x10, 0x05, 0x19, 0x2D, 0x43, 0x87, 0x21, 0x46, 0x11, 0x66, 0x21, 0x8F, 0x4B, 0x0E, 0x33, 0xE4, 0x08, 0xE5, 0x10, 0x05, 0x09, 0xC8, 0x21, 0x05, 0x11, 0x46, 0x11, 0x05, 0x09, 0x46, 0x11, 0x04, 0x01, 0xE4, 0x08, 0x05, 0x09, 0xE5, 0x00, 0xE4, 0x00, 0x25, 0x09,
+    0x25, 0x11, 0xE4, 0x00, 0x46, 0x11, 0x05, 0x09, 0xE4, 0x00, 0x26, 0x09, 0x05, 0x01, 0x47, 0x09, 0x46, 0x09, 0xA8, 0x11, 0xC8, 0x11, 0xC8, 0x11, 0xA8, 0x09, 0x09, 0x12, 0x2A, 0x1A, 0xE8, 0x11, 0xE9, 0xA2, 0xC7, 0x49, 0xE9, 0x9A, 0xC5, 0x51, 0x03, 0x21, 0x45, 0x29, 0xE8, 0x41, 0x04, 0x21, 0x45, 0x29, 0x25, 0x29, 0x45, 0x29, 0x66, 0x31, 0xE4, 0x20, 0x04, 0x21, 0xE4, 0x20, 0x6C, 0x6B,
+    0x85, 0x39, 0x85, 0x62, 0xE7, 0xC3, 0xC6, 0x49, 0xAA, 0x52, 0x45, 0x39, 0x04, 0x21, 0x45, 0x31, 0x04, 0x31, 0x23, 0x39, 0x24, 0x39, 0x44, 0x39, 0x86, 0x49, 0xC7, 0x71, 0xE8, 0x79, 0x04, 0x31, 0x04, 0x29, 0xA7, 0x39, 0x2D, 0x8B, 0xC7, 0x39, 0x05, 0x21, 0x66, 0x31, 0x05, 0x11, 0xAB, 0x52, 0x25, 0x21, 0x05, 0x19, 0x05, 0x19, 0x26, 0x19, 0x05, 0x11, 0x46, 0x21, 0x25, 0x19, 0x05, 0x11,
+    0x05, 0x11, 0xB1, 0x43, 0x05, 0x09, 0xE5, 0x08, 0xE4, 0x08, 0x67, 0x19, 0xC4, 0x08, 0xE5, 0x00, 0x05, 0x09, 0xE4, 0x00, 0xE5, 0x00, 0x05, 0x09, 0x6F, 0x33, 0x46, 0x11, 0xED, 0x22, 0x05, 0x01, 0x25, 0x09, 0x0D, 0x2B, 0x05, 0x01, 0x05, 0x01, 0xE5, 0x00, 0xC4, 0x00, 0xE5, 0x00, 0xAD, 0x1A, 0x47, 0x11, 0x47, 0x09, 0x87, 0x09, 0xA8, 0x11, 0x4E, 0x2B, 0x11, 0x4C, 0x09, 0x12, 0xE9, 0x11,
+    0x67, 0x7A, 0x68, 0x7A, 0x24, 0x49, 0x24, 0x29, 0x8A, 0x52, 0xC7, 0x31, 0x45, 0x29, 0xE3, 0x18, 0x25, 0x21, 0x4D, 0x6B, 0xE4, 0x20, 0x04, 0x21, 0xE4, 0x20, 0x25, 0x29, 0x08, 0x42, 0x04, 0x21, 0xA6, 0x39, 0x45, 0x5A, 0x87, 0xAB, 0x69, 0x4A, 0x04, 0x29, 0x24, 0x29, 0x25, 0x29, 0x66, 0x31, 0xE3, 0x20, 0x86, 0x49, 0x04, 0x29, 0x04, 0x29, 0x65, 0x39, 0x04, 0x31, 0x25, 0x39, 0x25, 0x31,
+    0x25, 0x29, 0xE4, 0x20, 0x25, 0x29, 0x25, 0x29, 0x66, 0x31, 0x46, 0x29, 0xE4, 0x28, 0x2D, 0x5B, 0xE4, 0x18, 0x25, 0x21, 0x45, 0x21, 0x05, 0x19, 0xE5, 0x10, 0x25, 0x19, 0x05, 0x09, 0x05, 0x11, 0xC4, 0x00, 0xE5, 0x10, 0x05, 0x11, 0x05, 0x09, 0xE4, 0x08, 0x4A, 0x2A, 0xE5, 0x08, 0xE5, 0x08, 0x05, 0x09, 0xE5, 0x08, 0x8B, 0x22, 0x4E, 0x4B, 0x25, 0x11, 0xC4, 0x00, 0xC4, 0x00, 0x6B, 0x1A,
+    0x05, 0x09, 0x25, 0x09, 0xE4, 0x00, 0x6A, 0x22, 0x87, 0x11, 0xE5, 0x00, 0xC4, 0x00, 0x25, 0x09, 0x26, 0x09, 0x46, 0x09, 0xA8, 0x11, 0x67, 0x09, 0xA8, 0x09, 0xC8, 0x11, 0xA8, 0x09, 0xE9, 0x11, 0xE8, 0xAA, 0x45, 0x29, 0xC3, 0x18, 0xE4, 0x20, 0xE4, 0x18, 0x82, 0x10, 0xE3, 0x20, 0xE4, 0x18, 0xE4, 0x20, 0xE4, 0x20, 0xE4, 0x20, 0x45, 0x41, 0x04, 0x31, 0x05, 0x29, 0x45, 0x29, 0x25, 0x29,
+    0x0B, 0x6B, 0x66, 0x62, 0x87, 0x72, 0xA9, 0x5A, 0x24, 0x29, 0x04, 0x29, 0x04, 0x31, 0x85, 0x41, 0x45, 0x39, 0xC2, 0x30, 0x45, 0x39, 0x65, 0x39, 0xE7, 0x59, 0x08, 0x4A, 0x86, 0x51, 0x66, 0x39, 0x25, 0x29, 0xE4, 0x20, 0x6A, 0x5A, 0x46, 0x31, 0x45, 0x31, 0x45, 0x29, 0xAC, 0x62, 0xE9, 0x31, 0x25, 0x19, 0x25, 0x19, 0xE4, 0x18, 0x05, 0x11, 0x0D, 0x4B, 0x46, 0x11, 0x05, 0x11, 0x25, 0x11,
+    0x05, 0x11, 0x46, 0x19, 0x05, 0x09, 0x05, 0x09, 0xE4, 0x00, 0xE4, 0x08, 0xA4, 0x00, 0x05, 0x09, 0xE5, 0x08, 0xC4, 0x00, 0xE4, 0x00, 0xC4, 0x08, 0x25, 0x09, 0x46, 0x11, 0xE4, 0x00, 0xC4, 0x00, 0xE5, 0x08, 0x46, 0x11, 0xE5, 0x00, 0x05, 0x09, 0xC4, 0x00, 0x25, 0x09, 0xE5, 0x00, 0xE5, 0x00, 0xE5, 0x00, 0x4B, 0x1A, 0x46, 0x09, 0x47, 0x09, 0x87, 0x09, 0xC8, 0x11, 0x0A, 0x1A, 0xC8, 0x11,
 };
 const lv_img_dsc_t ui_img_fireworks_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_fireworks_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_fireworks_80_png_data
 };
 
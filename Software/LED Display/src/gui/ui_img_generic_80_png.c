@@ -11,1612 +11,212 @@
 
 // IMAGE DATA: assets/Generic_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_generic_80_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x83,0x00,0xFF,0x25,0x01,0xFF,0xE4,0x00,0xFF,
-    0x45,0x01,0xFF,0xA3,0x00,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x04,0x01,0xFF,0xA6,0x01,0xFF,0x66,0x01,0xFF,
-    0xE7,0x01,0xFF,0x45,0x01,0xFF,0xA7,0x01,0xFF,0xA4,0x00,0xFF,
-    0x05,0x01,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xC4,0x00,0xFF,0xA3,0x00,0xFF,
-    0x86,0x01,0xFF,0xA6,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x71,0x04,0xFF,0x28,0x02,0xFF,0x45,0x01,0xFF,
-    0xE7,0x01,0xFF,0xE4,0x00,0xFF,0x86,0x01,0xFF,0xA3,0x00,0xFF,
-    0xC4,0x00,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0xA3,0x00,0xFF,0x65,0x01,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xD3,0x04,0xFF,0x18,0x06,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x86,0x01,0xFF,0x08,0x02,0xFF,0x45,0x01,0xFF,
-    0xC7,0x01,0xFF,0xE4,0x00,0xFF,0x25,0x01,0xFF,0x83,0x08,0xFF,
-    0x63,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,
-    0x45,0x01,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xEB,0x02,0xFF,0x92,0x04,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0x49,0x02,0xFF,0x86,0x01,0xFF,0x08,0x02,0xFF,0x05,0x01,0xFF,
-    0xA6,0x01,0xFF,0xA4,0x00,0xFF,0xE4,0x00,0xFF,0x62,0x08,0xFF,
-    0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x83,0x00,0xFF,0x63,0x00,0xFF,0x45,0x01,0xFF,0xE4,0x00,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0x10,0x04,0xFF,0x71,0x04,0xFF,0x18,0x06,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xA6,0x01,0xFF,
-    0x29,0x02,0xFF,0x45,0x01,0xFF,0xE7,0x01,0xFF,0xE4,0x00,0xFF,
-    0x66,0x01,0xFF,0x83,0x08,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x63,0x00,0xFF,
-    0x25,0x01,0xFF,0xE4,0x00,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xCB,0x02,0xFF,0xD7,0x05,0xFF,
-    0x75,0x05,0xFF,0x28,0x02,0xFF,0x28,0x02,0xFF,0xA6,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x86,0x01,0xFF,
-    0x28,0x02,0xFF,0x46,0x01,0xFF,0xC7,0x01,0xFF,0xE4,0x00,0xFF,
-    0x25,0x01,0xFF,0x83,0x08,0xFF,0x63,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x62,0x08,0xFF,0x04,0x01,0xFF,0xC4,0x00,0xFF,
-    0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0x86,0x01,0xFF,0x86,0x01,0xFF,0x71,0x04,0xFF,0x1C,0x07,0xFF,
-    0x9E,0x07,0xFF,0xA6,0x01,0xFF,0xC7,0x01,0xFF,0x25,0x01,0xFF,
-    0x08,0x02,0xFF,0x66,0x01,0xFF,0x29,0x02,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x29,0x02,0xFF,0x45,0x01,0xFF,
-    0xE8,0x01,0xFF,0x05,0x01,0xFF,0xA6,0x01,0xFF,0xA4,0x00,0xFF,
-    0xE4,0x00,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,
-    0x04,0x01,0xFF,0xE4,0x00,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,0xE4,0x00,0xFF,
-    0xA6,0x01,0xFF,0x28,0x02,0xFF,0x5D,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x83,0x08,0xFF,
-    0x25,0x01,0xFF,0xC4,0x00,0xFF,0xA7,0x01,0xFF,0x25,0x01,0xFF,
-    0x08,0x02,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xA6,0x01,0xFF,0x29,0x02,0xFF,0x45,0x01,0xFF,
-    0xE7,0x01,0xFF,0xE4,0x00,0xFF,0x66,0x01,0xFF,0x83,0x08,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xC4,0x00,0xFF,0xA3,0x00,0xFF,
-    0x65,0x01,0xFF,0xE4,0x00,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xE4,0x00,0xFF,0x45,0x01,0xFF,0x63,0x00,0xFF,
-    0x04,0x01,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x83,0x08,0xFF,
-    0x66,0x01,0xFF,0xE4,0x00,0xFF,0xE7,0x01,0xFF,0x45,0x01,0xFF,
-    0x28,0x02,0xFF,0xA6,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x86,0x01,0xFF,0x08,0x02,0xFF,0x05,0x01,0xFF,
-    0xA7,0x01,0xFF,0xC4,0x00,0xFF,0x25,0x01,0xFF,0x83,0x08,0xFF,
-    0x63,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0xA3,0x00,0xFF,0x65,0x01,0xFF,0x24,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0x45,0x01,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x08,0xFF,0x62,0x08,0xFF,0xE4,0x00,0xFF,0xC3,0x00,0xFF,
-    0xA6,0x01,0xFF,0x25,0x01,0xFF,0x08,0x02,0xFF,0x86,0x01,0xFF,
-    0x49,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0x49,0x02,0xFF,0x66,0x01,0xFF,0xE8,0x01,0xFF,0x05,0x01,0xFF,
-    0x86,0x01,0xFF,0xA4,0x00,0xFF,0xC4,0x00,0xFF,0x62,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,
-    0x45,0x01,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0x65,0x01,0xFF,0xA3,0x00,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x63,0x08,0xFF,0x83,0x08,0xFF,0x25,0x01,0xFF,0xC4,0x00,0xFF,
-    0xA7,0x01,0xFF,0xE4,0x00,0xFF,0x08,0x02,0xFF,0x66,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xA6,0x01,0xFF,
-    0x08,0x02,0xFF,0x45,0x01,0xFF,0xA6,0x01,0xFF,0xE4,0x00,0xFF,
-    0xE4,0x00,0xFF,0x62,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x83,0x00,0xFF,0x63,0x00,0xFF,0x45,0x01,0xFF,0xE4,0x00,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0x86,0x01,0xFF,0xC3,0x00,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0x86,0x01,0xFF,0xE4,0x00,0xFF,
-    0xE7,0x01,0xFF,0x45,0x01,0xFF,0x28,0x02,0xFF,0xA6,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xBE,0x07,0xFF,0xBE,0x07,0xFF,
-    0xB2,0x04,0xFF,0x14,0x05,0xFF,0x65,0x01,0xFF,0x65,0x01,0xFF,
-    0x65,0x01,0xFF,0xE4,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x63,0x00,0xFF,
-    0x25,0x01,0xFF,0xE4,0x00,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x66,0x01,0xFF,0xA3,0x00,0xFF,
-    0xE4,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,
-    0xE4,0x00,0xFF,0xC3,0x00,0xFF,0xA6,0x01,0xFF,0x25,0x01,0xFF,
-    0x08,0x02,0xFF,0x66,0x01,0xFF,0x49,0x02,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xBE,0x07,0xFF,0x96,0x05,0xFF,0x38,0x06,0xFF,
-    0x69,0x02,0xFF,0xCF,0x03,0xFF,0x70,0x04,0xFF,0x34,0x05,0xFF,
-    0x65,0x01,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x08,0xFF,0x63,0x00,0xFF,0x04,0x01,0xFF,0xE4,0x00,0xFF,
-    0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0x86,0x01,0xFF,0xE4,0x00,0xFF,0x04,0x01,0xFF,0x63,0x00,0xFF,
-    0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x63,0x08,0xFF,0x83,0x08,0xFF,
-    0x25,0x01,0xFF,0xE4,0x00,0xFF,0xC7,0x01,0xFF,0x45,0x01,0xFF,
-    0xC7,0x01,0xFF,0x66,0x01,0xFF,0xAA,0x02,0xFF,0x71,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0xCE,0x03,0xFF,0x66,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,
-    0x04,0x01,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,0xE4,0x00,0xFF,
-    0x25,0x01,0xFF,0x63,0x00,0xFF,0x62,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x62,0x08,0xFF,0xC3,0x00,0xFF,0xC3,0x00,0xFF,
-    0x45,0x01,0xFF,0x04,0x01,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x25,0x01,0xFF,0xE4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x83,0x00,0xFF,0xE4,0x00,0xFF,
-    0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xE4,0x00,0xFF,0x45,0x01,0xFF,0x63,0x00,0xFF,
-    0x83,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x00,0xFF,0x62,0x00,0xFF,0xC3,0x00,0xFF,0xA3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x2C,0x03,0xFF,0x86,0x01,0xFF,0x05,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x25,0x01,0xFF,
-    0x66,0x01,0xFF,0xA3,0x00,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x62,0x00,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xA3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x08,0x02,0xFF,0xD2,0x04,0xFF,
-    0x91,0x04,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0x30,0x04,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x0B,0x03,0xFF,0x49,0x02,0xFF,0x04,0x01,0xFF,
-    0x04,0x01,0xFF,0xA3,0x00,0xFF,0xE3,0x00,0xFF,0x83,0x00,0xFF,
-    0x83,0x00,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x08,0xFF,0x62,0x00,0xFF,0xA3,0x00,0xFF,0xA3,0x00,0xFF,
-    0x04,0x01,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xA3,0x00,0xFF,
-    0x70,0x04,0xFF,0xA3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x04,0x01,0xFF,0x65,0x01,0xFF,0xAE,0x03,0xFF,0x17,0x06,0xFF,
-    0x78,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xC4,0x00,0xFF,0x25,0x01,0xFF,
-    0x8E,0x03,0xFF,0xB5,0x05,0xFF,0xFA,0x06,0xFF,0x69,0x02,0xFF,
-    0x28,0x02,0xFF,0xAE,0x03,0xFF,0x6D,0x03,0xFF,0x50,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,
-    0xE4,0x00,0xFF,0xA3,0x00,0xFF,0xC3,0x00,0xFF,0x82,0x00,0xFF,
-    0x83,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x83,0x00,0xFF,0x62,0x00,0xFF,0xE4,0x00,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xA3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,0xA3,0x00,0xFF,
-    0xE4,0x00,0xFF,0x05,0x01,0xFF,0x58,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xD2,0x04,0xFF,0x95,0x05,0xFF,0xAE,0x03,0xFF,0xE7,0x01,0xFF,
-    0x49,0x02,0xFF,0x50,0x04,0xFF,0x50,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xC3,0x00,0xFF,0x04,0x01,0xFF,0xA3,0x00,0xFF,
-    0xE3,0x00,0xFF,0x83,0x00,0xFF,0xA3,0x00,0xFF,0x62,0x00,0xFF,
-    0x62,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0x83,0x00,0xFF,
-    0xE4,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xA3,0x00,0xFF,0xE3,0x00,0xFF,0x62,0x00,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xF7,0x05,0xFF,0x78,0x06,0xFF,0xD6,0x05,0xFF,0x45,0x01,0xFF,
-    0x24,0x01,0xFF,0xC3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xC3,0x00,0xFF,0x04,0x01,0xFF,0x83,0x00,0xFF,
-    0xC3,0x00,0xFF,0x82,0x00,0xFF,0x83,0x00,0xFF,0x62,0x08,0xFF,
-    0xE4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x00,0xFF,0x82,0x00,0xFF,0xE4,0x00,0xFF,0xA3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xA3,0x00,0xFF,
-    0xE3,0x00,0xFF,0x62,0x00,0xFF,0x62,0x00,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x45,0x01,0xFF,0xA3,0x00,0xFF,0xE4,0x00,0xFF,0xC3,0x00,0xFF,
-    0x04,0x01,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x04,0x01,0xFF,0xC3,0x00,0xFF,0xE4,0x00,0xFF,0xA3,0x00,0xFF,
-    0xA6,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x62,0x00,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xC3,0x00,0xFF,0xE3,0x00,0xFF,0x83,0x00,0xFF,
-    0x62,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x62,0x08,0xFF,0x83,0x00,0xFF,0x62,0x00,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x65,0x01,0xFF,0xA6,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x86,0x01,0xFF,0xE4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x00,0xFF,0x62,0x00,0xFF,0xC3,0x00,0xFF,0xA3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xA3,0x00,0xFF,
-    0xE3,0x00,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x00,0xFF,0x62,0x08,0xFF,0xA3,0x00,0xFF,0x83,0x00,0xFF,
-    0xE4,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x2C,0x03,0xFF,0x8A,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0xA6,0x01,0xFF,0x82,0x00,0xFF,
-    0x83,0x00,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x62,0x00,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xA3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0xE4,0x00,0xFF,0xA3,0x00,0xFF,
-    0xA3,0x00,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x83,0x00,0xFF,0x62,0x00,0xFF,0xC3,0x00,0xFF,0xA3,0x00,0xFF,
-    0xE4,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0xCE,0x03,0xFF,0x4C,0x03,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x4C,0x03,0xFF,0x65,0x01,0xFF,0xA3,0x00,0xFF,
-    0xE4,0x00,0xFF,0xA3,0x00,0xFF,0xC3,0x00,0xFF,0x82,0x00,0xFF,
-    0x62,0x00,0xFF,0x62,0x00,0xFF,0xA3,0x00,0xFF,0xA3,0x00,0xFF,
-    0x04,0x01,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xA3,0x00,0xFF,
-    0x70,0x04,0xFF,0xA3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x04,0x01,0xFF,0x83,0x00,0xFF,0xA3,0x00,0xFF,0x62,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,
-    0x83,0x00,0xFF,0x83,0x00,0xFF,0xE3,0x00,0xFF,0xA3,0x00,0xFF,
-    0x04,0x01,0xFF,0xC3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x2C,0x03,0xFF,0x8A,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x8A,0x02,0xFF,0x2C,0x03,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xC3,0x00,0xFF,0x04,0x01,0xFF,0xA3,0x00,0xFF,
-    0xE3,0x00,0xFF,0xC3,0x00,0xFF,0x04,0x01,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xA3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,0xA3,0x00,0xFF,
-    0xC3,0x00,0xFF,0x62,0x00,0xFF,0x62,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x62,0x08,0xFF,
-    0xA3,0x00,0xFF,0x83,0x00,0xFF,0xE4,0x00,0xFF,0xA3,0x00,0xFF,
-    0x65,0x01,0xFF,0xA6,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x4C,0x03,0xFF,0xCE,0x03,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x0F,0x04,0xFF,0x6D,0x03,0xFF,
-    0x04,0x01,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xA3,0x00,0xFF,0xE3,0x00,0xFF,0x62,0x00,0xFF,
-    0x62,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x83,0x00,0xFF,0x62,0x00,0xFF,
-    0xA6,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x8A,0x02,0xFF,0x2C,0x03,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x2C,0x03,0xFF,0x48,0x02,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xA3,0x00,0xFF,
-    0xE3,0x00,0xFF,0x62,0x00,0xFF,0x62,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xE4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xA6,0x01,0xFF,0x45,0x01,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x4C,0x03,0xFF,0x8A,0x02,0xFF,
-    0xAA,0x02,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xA3,0x00,0xFF,0xE3,0x00,0xFF,0x83,0x00,0xFF,
-    0x62,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0xA6,0x01,0xFF,0x83,0x00,0xFF,
-    0xE4,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0x48,0x02,0xFF,0x8D,0x03,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0x04,0x01,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x83,0x00,0xFF,0x62,0x00,0xFF,0xE3,0x00,0xFF,0xE3,0x00,0xFF,
-    0x0B,0x03,0xFF,0x8D,0x03,0xFF,0x49,0x02,0xFF,0xC3,0x00,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0xCE,0x03,0xFF,0x0F,0x04,0xFF,0xAE,0x03,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xC4,0x00,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x86,0x01,0xFF,0x28,0x02,0xFF,0xDB,0x06,0xFF,0x7D,0x07,0xFF,
-    0x1C,0x07,0xFF,0x28,0x02,0xFF,0xA6,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,
-    0x86,0x01,0xFF,0xC7,0x01,0xFF,0x92,0x04,0xFF,0x79,0x06,0xFF,
-    0xB6,0x05,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0xFF,0xC3,0x00,0xFF,
-    0x04,0x01,0xFF,0x62,0x08,0xFF,0x83,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x62,0x08,0xFF,0xE4,0x00,0xFF,0xC4,0x00,0xFF,
-    0x28,0x02,0xFF,0x29,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x2C,0x03,0xFF,0x28,0x02,0xFF,0x45,0x01,0xFF,
-    0xE8,0x01,0xFF,0xE4,0x00,0xFF,0xA6,0x01,0xFF,0x45,0x01,0xFF,
-    0xEF,0x03,0xFF,0x50,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,
-    0xC4,0x00,0xFF,0xC4,0x00,0xFF,0xE7,0x01,0xFF,0x46,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xF3,0x04,0xFF,0x38,0x06,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x86,0x01,0xFF,0x28,0x02,0xFF,0x66,0x01,0xFF,
-    0xCB,0x02,0xFF,0xAE,0x03,0xFF,0x4D,0x03,0xFF,0xE4,0x00,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xC3,0x00,0xFF,0xA3,0x00,0xFF,
-    0xC7,0x01,0xFF,0x46,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x71,0x04,0xFF,0x18,0x06,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0x8A,0x02,0xFF,0x4C,0x03,0xFF,0xAA,0x02,0xFF,0x86,0x01,0xFF,
-    0xA7,0x01,0xFF,0xC3,0x00,0xFF,0xE4,0x00,0xFF,0x62,0x08,0xFF,
-    0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x83,0x00,0xFF,0xA7,0x01,0xFF,0x25,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0x49,0x02,0xFF,0x79,0x06,0xFF,0x7D,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xC7,0x01,0xFF,
-    0x28,0x02,0xFF,0x45,0x01,0xFF,0xE7,0x01,0xFF,0xE4,0x00,0xFF,
-    0x66,0x01,0xFF,0x83,0x08,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,
-    0x86,0x01,0xFF,0x25,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x45,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x28,0x02,0xFF,0x86,0x01,0xFF,
-    0xE8,0x01,0xFF,0x66,0x01,0xFF,0x28,0x02,0xFF,0xA6,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x86,0x01,0xFF,
-    0x28,0x02,0xFF,0x46,0x01,0xFF,0xC7,0x01,0xFF,0xE4,0x00,0xFF,
-    0x25,0x01,0xFF,0x83,0x08,0xFF,0x63,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x08,0xFF,0x63,0x08,0xFF,0x45,0x01,0xFF,0x05,0x01,0xFF,
-    0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x45,0x01,0xFF,
-    0xFF,0x07,0xFF,0x45,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0x08,0x02,0xFF,0x25,0x01,0xFF,0x66,0x01,0xFF,0xA3,0x00,0xFF,
-    0xC4,0x00,0xFF,0xA4,0x00,0xFF,0x86,0x01,0xFF,0x05,0x01,0xFF,
-    0x08,0x02,0xFF,0x66,0x01,0xFF,0x29,0x02,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x28,0x02,0xFF,0x45,0x01,0xFF,
-    0x08,0x02,0xFF,0x25,0x01,0xFF,0xA6,0x01,0xFF,0xC3,0x00,0xFF,
-    0xE4,0x00,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,0x63,0x08,0xFF,
-    0x45,0x01,0xFF,0x25,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x45,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x28,0x02,0xFF,0x25,0x01,0xFF,
-    0x86,0x01,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x63,0x08,0xFF,0x83,0x08,0xFF,
-    0x25,0x01,0xFF,0xC4,0x00,0xFF,0xC7,0x01,0xFF,0x86,0x01,0xFF,
-    0x8A,0x02,0xFF,0x4C,0x03,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xA6,0x01,0xFF,0x28,0x02,0xFF,0x45,0x01,0xFF,
-    0xE7,0x01,0xFF,0xE4,0x00,0xFF,0x66,0x01,0xFF,0x83,0x08,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x04,0x01,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x62,0x08,0xFF,0xE4,0x00,0xFF,0xC4,0x00,0xFF,
-    0xE8,0x01,0xFF,0x25,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x45,0x01,0xFF,0xA7,0x01,0xFF,0x83,0x00,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xC3,0x00,0xFF,0xE4,0x00,0xFF,
-    0x2C,0x03,0xFF,0xAE,0x03,0xFF,0xAA,0x02,0xFF,0x86,0x01,0xFF,
-    0x28,0x02,0xFF,0xA6,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x66,0x01,0xFF,0x08,0x02,0xFF,0x25,0x01,0xFF,
-    0xA7,0x01,0xFF,0xC4,0x00,0xFF,0x25,0x01,0xFF,0x83,0x08,0xFF,
-    0xC3,0x00,0xFF,0x05,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x04,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,
-    0xC4,0x00,0xFF,0xC4,0x00,0xFF,0xE7,0x01,0xFF,0x66,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x46,0x01,0xFF,
-    0xC7,0x01,0xFF,0xA3,0x00,0xFF,0xC3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x50,0x04,0xFF,0x50,0x04,0xFF,0xAE,0x03,0xFF,0x45,0x01,0xFF,
-    0xA7,0x01,0xFF,0x05,0x01,0xFF,0x08,0x02,0xFF,0x86,0x01,0xFF,
-    0x49,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0x29,0x02,0xFF,0x66,0x01,0xFF,0x08,0x02,0xFF,0x25,0x01,0xFF,
-    0xC7,0x01,0xFF,0xA6,0x01,0xFF,0xD6,0x05,0xFF,0xB9,0x06,0xFF,
-    0xFA,0x06,0xFF,0x86,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x05,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0xC3,0x00,0xFF,0xA3,0x00,0xFF,
-    0xC7,0x01,0xFF,0x46,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x45,0x01,0xFF,0xE7,0x01,0xFF,0xC4,0x00,0xFF,
-    0xE4,0x00,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0xA3,0x00,0xFF,0x83,0x08,0xFF,0x25,0x01,0xFF,0xC4,0x00,0xFF,
-    0xA7,0x01,0xFF,0xE4,0x00,0xFF,0x08,0x02,0xFF,0x66,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xA6,0x01,0xFF,
-    0x28,0x02,0xFF,0xA7,0x01,0xFF,0x2C,0x03,0xFF,0x54,0x05,0xFF,
-    0xF2,0x04,0xFF,0x05,0x01,0xFF,0xA3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,
-    0x45,0x01,0xFF,0x83,0x00,0xFF,0xA7,0x01,0xFF,0x25,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0x08,0x02,0xFF,0xE4,0x00,0xFF,0x04,0x01,0xFF,0x62,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,
-    0xC4,0x00,0xFF,0xA3,0x00,0xFF,0x86,0x01,0xFF,0xE4,0x00,0xFF,
-    0xE7,0x01,0xFF,0x45,0x01,0xFF,0x28,0x02,0xFF,0xA6,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xDF,0x07,0xFF,0xDF,0x07,0xFF,
-    0x34,0x05,0xFF,0x79,0x06,0xFF,0x28,0x02,0xFF,0x0F,0x04,0xFF,
-    0x4C,0x03,0xFF,0xA6,0x01,0xFF,0x25,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x05,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x78,0x06,0xFF,0x25,0x01,0xFF,
-    0xA7,0x01,0xFF,0x25,0x01,0xFF,0x28,0x02,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x45,0x01,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xE8,0x01,0xFF,0xC4,0x00,0xFF,
-    0x25,0x01,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,
-    0x04,0x01,0xFF,0xA4,0x00,0xFF,0xA6,0x01,0xFF,0x05,0x01,0xFF,
-    0x08,0x02,0xFF,0x86,0x01,0xFF,0x29,0x02,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xDF,0x07,0xFF,0xB6,0x05,0xFF,0x59,0x06,0xFF,
-    0x0C,0x03,0xFF,0x14,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x66,0x01,0xFF,0x04,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x04,0x01,0xFF,0x86,0x01,0xFF,
-    0x99,0x06,0xFF,0x37,0x06,0xFF,0x50,0x04,0xFF,0xE7,0x01,0xFF,
-    0x28,0x02,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x45,0x01,0xFF,
-    0xFF,0x07,0xFF,0x45,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0x08,0x02,0xFF,0x25,0x01,0xFF,0x66,0x01,0xFF,0x83,0x00,0xFF,
-    0x63,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x63,0x08,0xFF,0x83,0x08,0xFF,
-    0x25,0x01,0xFF,0xE4,0x00,0xFF,0xC7,0x01,0xFF,0x45,0x01,0xFF,
-    0xE7,0x01,0xFF,0x86,0x01,0xFF,0x2C,0x03,0xFF,0xD3,0x04,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xA6,0x01,0xFF,0x25,0x01,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x25,0x01,0xFF,
-    0x13,0x05,0xFF,0x54,0x05,0xFF,0x2C,0x03,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x45,0x01,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x28,0x02,0xFF,0x25,0x01,0xFF,
-    0x86,0x01,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x62,0x08,0xFF,0xE4,0x00,0xFF,0xC4,0x00,0xFF,
-    0xA6,0x01,0xFF,0x65,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x25,0x01,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x24,0x01,0xFF,0xA6,0x01,0xFF,
-    0x0F,0x04,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x45,0x01,0xFF,0xA7,0x01,0xFF,0x83,0x00,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x83,0x00,0xFF,0x63,0x00,0xFF,0x45,0x01,0xFF,0xE4,0x00,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xA6,0x01,0xFF,0x04,0x01,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xE4,0x00,0xFF,0x66,0x01,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0xFF,0x07,0xFF,0xFF,0x07,0xFF,0x66,0x01,0xFF,
-    0xE7,0x01,0xFF,0xC4,0x00,0xFF,0xC3,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x63,0x00,0xFF,
-    0x25,0x01,0xFF,0xE4,0x00,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xA6,0x01,0xFF,0x04,0x01,0xFF,
-    0x04,0x01,0xFF,0x63,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x25,0x01,0xFF,0xA6,0x01,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0xFF,
-    0xFF,0x07,0xFF,0x4D,0x03,0xFF,0xCB,0x02,0xFF,0x25,0x01,0xFF,
-    0x45,0x01,0xFF,0xC3,0x00,0xFF,0xE3,0x00,0xFF,0x83,0x00,0xFF,
-    0x83,0x00,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x08,0xFF,0x63,0x00,0xFF,0x04,0x01,0xFF,0xE4,0x00,0xFF,
-    0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0x86,0x01,0xFF,0xE4,0x00,0xFF,0x04,0x01,0xFF,0x63,0x00,0xFF,
-    0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xC4,0x00,0xFF,0x05,0x01,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0B,0x03,0xFF,
-    0xCA,0x02,0xFF,0xCE,0x03,0xFF,0xAE,0x03,0xFF,0x50,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,
-    0xE3,0x00,0xFF,0xA3,0x00,0xFF,0xC3,0x00,0xFF,0x62,0x00,0xFF,
-    0x83,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xE4,0x00,0xFF,0xA3,0x00,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,0xE4,0x00,0xFF,
-    0x25,0x01,0xFF,0x63,0x00,0xFF,0x62,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x83,0x00,0xFF,0xE4,0x00,0xFF,
-    0xA6,0x01,0xFF,0x86,0x01,0xFF,0xE7,0x01,0xFF,0x4C,0x03,0xFF,
-    0x4D,0x03,0xFF,0x50,0x04,0xFF,0x50,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xC3,0x00,0xFF,0x04,0x01,0xFF,0xA3,0x00,0xFF,
-    0xE3,0x00,0xFF,0x83,0x00,0xFF,0xA3,0x00,0xFF,0x62,0x00,0xFF,
-    0x62,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xC4,0x00,0xFF,0xC3,0x00,0xFF,
-    0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xE4,0x00,0xFF,0x45,0x01,0xFF,0x63,0x00,0xFF,
-    0x83,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,
-    0xE4,0x00,0xFF,0xC3,0x00,0xFF,0x25,0x01,0xFF,0xC3,0x00,0xFF,
-    0x04,0x01,0xFF,0xC3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xC3,0x00,0xFF,0x04,0x01,0xFF,0x83,0x00,0xFF,
-    0xC3,0x00,0xFF,0x62,0x00,0xFF,0x83,0x00,0xFF,0x62,0x08,0xFF,
-    0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x82,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0xA3,0x00,0xFF,0xA3,0x00,0xFF,0x65,0x01,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0x45,0x01,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x82,0x00,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0xE3,0x00,0xFF,0xA3,0x00,0xFF,
-    0x04,0x01,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x04,0x01,0xFF,0xC3,0x00,0xFF,0xE3,0x00,0xFF,0xA3,0x00,0xFF,
-    0xC3,0x00,0xFF,0x62,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,
-    0x45,0x01,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0x65,0x01,0xFF,0xA3,0x00,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x08,0xFF,0x62,0x08,0xFF,0x83,0x00,0xFF,0x82,0x00,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x04,0x01,0xFF,0xA3,0x00,0xFF,0xE3,0x00,0xFF,0x83,0x00,0xFF,
-    0xA3,0x00,0xFF,0x62,0x08,0xFF,0x62,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0xA3,0x00,0xFF,0x63,0x00,0xFF,0x45,0x01,0xFF,0xE4,0x00,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xE4,0x00,0xFF,
-    0x66,0x01,0xFF,0xA3,0x00,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x00,0xFF,0x62,0x08,0xFF,0xA3,0x00,0xFF,0x83,0x00,0xFF,
-    0xE3,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0xC3,0x00,0xFF,
-    0x04,0x01,0xFF,0xA3,0x00,0xFF,0xC3,0x00,0xFF,0x62,0x00,0xFF,
-    0x83,0x00,0xFF,0x62,0x08,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x0F,0x04,0xFF,0x04,0x01,0xFF,
-    0x45,0x01,0xFF,0xE4,0x00,0xFF,0x86,0x01,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,0xE4,0x00,0xFF,
-    0xE4,0x00,0xFF,0x62,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x83,0x00,0xFF,0x82,0x00,0xFF,0xC3,0x00,0xFF,0xA3,0x00,0xFF,
-    0xE3,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,
-    0xE3,0x00,0xFF,0xA3,0x00,0xFF,0xC3,0x00,0xFF,0xC3,0x00,0xFF,
-    0x8D,0x03,0xFF,0xEE,0x03,0xFF,0xEB,0x02,0xFF,0x05,0x01,0xFF,
-    0x86,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0x86,0x01,0xFF,0xC4,0x00,0xFF,0x04,0x01,0xFF,0x62,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x08,0xFF,0x62,0x08,0xFF,
-    0x83,0x00,0xFF,0x83,0x00,0xFF,0xE3,0x00,0xFF,0xA3,0x00,0xFF,
-    0x04,0x01,0xFF,0xC3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0xC3,0x00,0xFF,0x04,0x01,0xFF,0x04,0x01,0xFF,
-    0xE7,0x01,0xFF,0xEB,0x02,0xFF,0x07,0x02,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x86,0x01,0xFF,0xE4,0x00,0xFF,
-    0x25,0x01,0xFF,0x63,0x00,0xFF,0x62,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x62,0x08,0xFF,
-    0xA3,0x00,0xFF,0x83,0x00,0xFF,0xE3,0x00,0xFF,0xA3,0x00,0xFF,
-    0x04,0x01,0xFF,0xC3,0x00,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x30,0x04,0xFF,0xEF,0x03,0xFF,
-    0xA6,0x01,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xE4,0x00,0xFF,0x45,0x01,0xFF,0x63,0x00,0xFF,
-    0x83,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x83,0x00,0xFF,0x82,0x00,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0xE4,0x00,0xFF,0xC3,0x00,0xFF,
-    0x04,0x01,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,0x70,0x04,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0x0F,0x04,0xFF,0xCE,0x03,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0x04,0x01,0xFF,
-    0x45,0x01,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x08,0xFF,0x62,0x08,0xFF,0x83,0x00,0xFF,0x83,0x00,0xFF,
-    0xC3,0x00,0xFF,0xA3,0x00,0xFF,0x04,0x01,0xFF,0xC3,0x00,0xFF,
-    0x70,0x04,0xFF,0x70,0x04,0xFF,0xEF,0x03,0xFF,0xCE,0x03,0xFF,
-    0xEB,0x02,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,0xFA,0x06,0xFF,
-    0xFA,0x06,0xFF,0x04,0x01,0xFF,0x65,0x01,0xFF,0xA3,0x00,0xFF,
-    0xA3,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x66,0x01,0xFF,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x62,0x00,0xFF,0x62,0x00,0xFF,0xA3,0x00,0xFF,0x83,0x00,0xFF,
-    0xE3,0x00,0xFF,0xA3,0x00,0xFF,0x24,0x01,0xFF,0xEF,0x03,0xFF,
-    0xAA,0x02,0xFF,0xCE,0x03,0xFF,0xFA,0x06,0xFF,0x45,0x01,0xFF,
-    0x86,0x01,0xFF,0xA3,0x00,0xFF,0xC4,0x00,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x86,0x01,0xFF,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x83,0x00,0xFF,0x82,0x00,0xFF,0xE3,0x00,0xFF,0xC3,0x00,0xFF,
-    0x25,0x01,0xFF,0x04,0x01,0xFF,0x45,0x01,0xFF,0xC3,0x00,0xFF,
-    0xE4,0x00,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x86,0x01,0xFF,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x62,0x00,0xFF,0x62,0x00,0xFF,
-    0xC4,0x00,0xFF,0xA3,0x00,0xFF,0xC3,0x00,0xFF,0x62,0x00,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x86,0x01,0xFF,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,0x42,0x08,0xFF,
-    0x42,0x08,0xFF,0x42,0x08,0xFF,0x86,0x01,0xFF,0x86,0x01,0xFF,
-    0x86,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,0x66,0x01,0xFF,
-    0x66,0x01,0xFF,0x66,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01,
+    0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01,
+    0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x83, 0x00, 0x25, 0x01, 0xE4, 0x00, 0x45, 0x01, 0xA3, 0x00, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x04, 0x01, 0xA6, 0x01, 0x66, 0x01, 0xE7, 0x01, 0x45, 0x01, 0xA7, 0x01, 0xA4, 0x00, 0x05, 0x01, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE0, 0x07, 0xE0, 0x07,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0xA3, 0x00,
+    0x86, 0x01, 0xA6, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x04, 0x28, 0x02, 0x45, 0x01, 0xE7, 0x01, 0xE4, 0x00, 0x86, 0x01, 0xA3, 0x00, 0xC4, 0x00, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0xA3, 0x00, 0x65, 0x01, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x04, 0x18, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0x86, 0x01, 0x08, 0x02, 0x45, 0x01, 0xC7, 0x01, 0xE4, 0x00, 0x25, 0x01, 0x83, 0x08,
+    0x63, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x83, 0x00, 0x45, 0x01, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06,
+    0xFA, 0x06, 0xFA, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x02, 0x92, 0x04, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x49, 0x02, 0x86, 0x01, 0x08, 0x02, 0x05, 0x01, 0xA6, 0x01, 0xA4, 0x00, 0xE4, 0x00, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x63, 0x00, 0x45, 0x01, 0xE4, 0x00, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x10, 0x04, 0x71, 0x04, 0x18, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xA6, 0x01,
+    0x29, 0x02, 0x45, 0x01, 0xE7, 0x01, 0xE4, 0x00, 0x66, 0x01, 0x83, 0x08, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x63, 0x00, 0x25, 0x01, 0xE4, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01,
+    0xFA, 0x06, 0xFA, 0x06, 0xCB, 0x02, 0xD7, 0x05, 0x75, 0x05, 0x28, 0x02, 0x28, 0x02, 0xA6, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x86, 0x01, 0x28, 0x02, 0x46, 0x01, 0xC7, 0x01, 0xE4, 0x00, 0x25, 0x01, 0x83, 0x08, 0x63, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x04, 0x01, 0xC4, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x86, 0x01, 0x71, 0x04, 0x1C, 0x07, 0x9E, 0x07, 0xA6, 0x01, 0xC7, 0x01, 0x25, 0x01, 0x08, 0x02, 0x66, 0x01, 0x29, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x29, 0x02, 0x45, 0x01, 0xE8, 0x01, 0x05, 0x01, 0xA6, 0x01, 0xA4, 0x00, 0xE4, 0x00, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x04, 0x01, 0xE4, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xE4, 0x00,
+    0xA6, 0x01, 0x28, 0x02, 0x5D, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x83, 0x08, 0x25, 0x01, 0xC4, 0x00, 0xA7, 0x01, 0x25, 0x01, 0x08, 0x02, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xA6, 0x01, 0x29, 0x02, 0x45, 0x01, 0xE7, 0x01, 0xE4, 0x00, 0x66, 0x01, 0x83, 0x08,
+    0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0xA3, 0x00, 0x65, 0x01, 0xE4, 0x00, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xE4, 0x00, 0x45, 0x01, 0x63, 0x00, 0x04, 0x01, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x83, 0x08, 0x66, 0x01, 0xE4, 0x00, 0xE7, 0x01, 0x45, 0x01,
+    0x28, 0x02, 0xA6, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x86, 0x01, 0x08, 0x02, 0x05, 0x01, 0xA7, 0x01, 0xC4, 0x00, 0x25, 0x01, 0x83, 0x08, 0x63, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0xA3, 0x00, 0x65, 0x01, 0x24, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0x45, 0x01, 0x83, 0x00, 0x83, 0x00, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0xE4, 0x00, 0xC3, 0x00, 0xA6, 0x01, 0x25, 0x01, 0x08, 0x02, 0x86, 0x01, 0x49, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0x49, 0x02, 0x66, 0x01, 0xE8, 0x01, 0x05, 0x01, 0x86, 0x01, 0xA4, 0x00, 0xC4, 0x00, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x83, 0x00,
+    0x45, 0x01, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0x65, 0x01, 0xA3, 0x00, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x63, 0x08, 0x83, 0x08, 0x25, 0x01, 0xC4, 0x00, 0xA7, 0x01, 0xE4, 0x00, 0x08, 0x02, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xA6, 0x01, 0x08, 0x02, 0x45, 0x01, 0xA6, 0x01, 0xE4, 0x00, 0xE4, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x63, 0x00, 0x45, 0x01, 0xE4, 0x00, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xC3, 0x00, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0xC3, 0x00, 0xA3, 0x00, 0x86, 0x01, 0xE4, 0x00, 0xE7, 0x01, 0x45, 0x01, 0x28, 0x02, 0xA6, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xBE, 0x07, 0xBE, 0x07, 0xB2, 0x04, 0x14, 0x05, 0x65, 0x01, 0x65, 0x01, 0x65, 0x01, 0xE4, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x63, 0x00, 0x25, 0x01, 0xE4, 0x00, 0x86, 0x01, 0xFA, 0x06,
+    0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x66, 0x01, 0xA3, 0x00, 0xE4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0xE4, 0x00, 0xC3, 0x00, 0xA6, 0x01, 0x25, 0x01, 0x08, 0x02, 0x66, 0x01, 0x49, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xBE, 0x07, 0x96, 0x05, 0x38, 0x06, 0x69, 0x02, 0xCF, 0x03, 0x70, 0x04, 0x34, 0x05, 0x65, 0x01, 0x04, 0x01, 0xC3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x63, 0x00, 0x04, 0x01, 0xE4, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xE4, 0x00, 0x04, 0x01, 0x63, 0x00, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x63, 0x08, 0x83, 0x08, 0x25, 0x01, 0xE4, 0x00, 0xC7, 0x01, 0x45, 0x01,
+    0xC7, 0x01, 0x66, 0x01, 0xAA, 0x02, 0x71, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xCE, 0x03, 0x66, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x04, 0x01, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06,
+    0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xE4, 0x00, 0x25, 0x01, 0x63, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0xC3, 0x00, 0xC3, 0x00, 0x45, 0x01, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x25, 0x01, 0xE4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0xE4, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xE4, 0x00, 0x45, 0x01, 0x63, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x00, 0xC3, 0x00, 0xA3, 0x00,
+    0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x2C, 0x03, 0x86, 0x01, 0x05, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x25, 0x01,
+    0x66, 0x01, 0xA3, 0x00, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x00, 0xC3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x08, 0x02, 0xD2, 0x04, 0x91, 0x04, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0x30, 0x04, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x0B, 0x03, 0x49, 0x02, 0x04, 0x01, 0x04, 0x01, 0xA3, 0x00, 0xE3, 0x00, 0x83, 0x00, 0x83, 0x00, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x00, 0xA3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00,
+    0x70, 0x04, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0x65, 0x01, 0xAE, 0x03, 0x17, 0x06, 0x78, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x25, 0x01, 0x8E, 0x03, 0xB5, 0x05, 0xFA, 0x06, 0x69, 0x02, 0x28, 0x02, 0xAE, 0x03, 0x6D, 0x03, 0x50, 0x04,
+    0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xC3, 0x00, 0xE4, 0x00, 0xA3, 0x00, 0xC3, 0x00, 0x82, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x62, 0x00, 0xE4, 0x00, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0xE4, 0x00, 0x05, 0x01, 0x58, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xD2, 0x04, 0x95, 0x05, 0xAE, 0x03, 0xE7, 0x01, 0x49, 0x02, 0x50, 0x04, 0x50, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x04, 0x01, 0xA3, 0x00, 0xE3, 0x00, 0x83, 0x00, 0xA3, 0x00, 0x62, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0x83, 0x00, 0xE4, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04,
+    0x70, 0x04, 0xA3, 0x00, 0xE3, 0x00, 0x62, 0x00, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xF7, 0x05, 0x78, 0x06, 0xD6, 0x05, 0x45, 0x01, 0x24, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04,
+    0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x04, 0x01, 0x83, 0x00, 0xC3, 0x00, 0x82, 0x00, 0x83, 0x00, 0x62, 0x08, 0xE4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x82, 0x00, 0xE4, 0x00, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0xE3, 0x00, 0x62, 0x00, 0x62, 0x00, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x45, 0x01, 0xA3, 0x00, 0xE4, 0x00, 0xC3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xC3, 0x00, 0xE4, 0x00, 0xA3, 0x00,
+    0xA6, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x00, 0xC3, 0x00, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0xE3, 0x00, 0x83, 0x00,
+    0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x62, 0x08, 0x83, 0x00, 0x62, 0x00,
+    0xC3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x65, 0x01, 0xA6, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x86, 0x01, 0xE4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x62, 0x00, 0x62, 0x00, 0xC3, 0x00, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0xE3, 0x00, 0x83, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x08, 0xA3, 0x00, 0x83, 0x00, 0xE4, 0x00, 0xA3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04,
+    0x2C, 0x03, 0x8A, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0xA6, 0x01, 0x82, 0x00, 0x83, 0x00, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x00, 0xC3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0xE4, 0x00, 0xA3, 0x00, 0xA3, 0x00, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x62, 0x00, 0xC3, 0x00, 0xA3, 0x00, 0xE4, 0x00, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xCE, 0x03, 0x4C, 0x03, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x4C, 0x03, 0x65, 0x01, 0xA3, 0x00, 0xE4, 0x00, 0xA3, 0x00, 0xC3, 0x00, 0x82, 0x00, 0x62, 0x00, 0x62, 0x00, 0xA3, 0x00, 0xA3, 0x00,
+    0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0x70, 0x04, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0x83, 0x00, 0xA3, 0x00, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0x83, 0x00, 0x83, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04,
+    0x2C, 0x03, 0x8A, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x8A, 0x02, 0x2C, 0x03, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x04, 0x01, 0xA3, 0x00, 0xE3, 0x00, 0xC3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0xC3, 0x00, 0x62, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x08, 0xA3, 0x00, 0x83, 0x00, 0xE4, 0x00, 0xA3, 0x00, 0x65, 0x01, 0xA6, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x4C, 0x03, 0xCE, 0x03, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x0F, 0x04, 0x6D, 0x03, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04,
+    0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0xE3, 0x00, 0x62, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x62, 0x00,
+    0xA6, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x8A, 0x02, 0x2C, 0x03, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x2C, 0x03, 0x48, 0x02, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xA3, 0x00, 0xE3, 0x00, 0x62, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xA6, 0x01, 0x45, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x4C, 0x03, 0x8A, 0x02, 0xAA, 0x02, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04,
+    0x70, 0x04, 0xA3, 0x00, 0xE3, 0x00, 0x83, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0xA6, 0x01, 0x83, 0x00, 0xE4, 0x00, 0xA3, 0x00, 0x04, 0x01, 0x86, 0x01, 0x48, 0x02, 0x8D, 0x03, 0x70, 0x04, 0x04, 0x01, 0x04, 0x01, 0x83, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x83, 0x00, 0x62, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0x0B, 0x03, 0x8D, 0x03, 0x49, 0x02, 0xC3, 0x00,
+    0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0xCE, 0x03, 0x0F, 0x04, 0xAE, 0x03, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x86, 0x01, 0x28, 0x02, 0xDB, 0x06, 0x7D, 0x07, 0x1C, 0x07, 0x28, 0x02, 0xA6, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0x86, 0x01, 0xC7, 0x01, 0x92, 0x04, 0x79, 0x06, 0xB6, 0x05, 0xC7, 0x01, 0xC7, 0x01, 0xC3, 0x00, 0x04, 0x01, 0x62, 0x08, 0x83, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0xE4, 0x00, 0xC4, 0x00,
+    0x28, 0x02, 0x29, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x03, 0x28, 0x02, 0x45, 0x01, 0xE8, 0x01, 0xE4, 0x00, 0xA6, 0x01, 0x45, 0x01, 0xEF, 0x03, 0x50, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0xC4, 0x00, 0xC4, 0x00, 0xE7, 0x01, 0x46, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x04, 0x38, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0x86, 0x01, 0x28, 0x02, 0x66, 0x01, 0xCB, 0x02, 0xAE, 0x03, 0x4D, 0x03, 0xE4, 0x00,
+    0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC3, 0x00, 0xA3, 0x00, 0xC7, 0x01, 0x46, 0x01, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x04, 0x18, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x8A, 0x02, 0x4C, 0x03, 0xAA, 0x02, 0x86, 0x01, 0xA7, 0x01, 0xC3, 0x00, 0xE4, 0x00, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x83, 0x00, 0xA7, 0x01, 0x25, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x49, 0x02, 0x79, 0x06, 0x7D, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xC7, 0x01,
+    0x28, 0x02, 0x45, 0x01, 0xE7, 0x01, 0xE4, 0x00, 0x66, 0x01, 0x83, 0x08, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x83, 0x00, 0x86, 0x01, 0x25, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01,
+    0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x86, 0x01, 0xE8, 0x01, 0x66, 0x01, 0x28, 0x02, 0xA6, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x86, 0x01, 0x28, 0x02, 0x46, 0x01, 0xC7, 0x01, 0xE4, 0x00, 0x25, 0x01, 0x83, 0x08, 0x63, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x63, 0x08, 0x45, 0x01, 0x05, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01, 0xFF, 0x07, 0x45, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0x08, 0x02, 0x25, 0x01, 0x66, 0x01, 0xA3, 0x00, 0xC4, 0x00, 0xA4, 0x00, 0x86, 0x01, 0x05, 0x01, 0x08, 0x02, 0x66, 0x01, 0x29, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x45, 0x01, 0x08, 0x02, 0x25, 0x01, 0xA6, 0x01, 0xC3, 0x00, 0xE4, 0x00, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x63, 0x08, 0x45, 0x01, 0x25, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x25, 0x01,
+    0x86, 0x01, 0x83, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x63, 0x08, 0x83, 0x08, 0x25, 0x01, 0xC4, 0x00, 0xC7, 0x01, 0x86, 0x01, 0x8A, 0x02, 0x4C, 0x03, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xA6, 0x01, 0x28, 0x02, 0x45, 0x01, 0xE7, 0x01, 0xE4, 0x00, 0x66, 0x01, 0x83, 0x08,
+    0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x62, 0x08, 0xE4, 0x00, 0xC4, 0x00, 0xE8, 0x01, 0x25, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01, 0xA7, 0x01, 0x83, 0x00, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC3, 0x00, 0xE4, 0x00, 0x2C, 0x03, 0xAE, 0x03, 0xAA, 0x02, 0x86, 0x01,
+    0x28, 0x02, 0xA6, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01, 0x08, 0x02, 0x25, 0x01, 0xA7, 0x01, 0xC4, 0x00, 0x25, 0x01, 0x83, 0x08, 0xC3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0xC4, 0x00, 0xC4, 0x00, 0xE7, 0x01, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x46, 0x01, 0xC7, 0x01, 0xA3, 0x00, 0xC3, 0x00, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x50, 0x04, 0x50, 0x04, 0xAE, 0x03, 0x45, 0x01, 0xA7, 0x01, 0x05, 0x01, 0x08, 0x02, 0x86, 0x01, 0x49, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0x29, 0x02, 0x66, 0x01, 0x08, 0x02, 0x25, 0x01, 0xC7, 0x01, 0xA6, 0x01, 0xD6, 0x05, 0xB9, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0xC3, 0x00, 0xA3, 0x00,
+    0xC7, 0x01, 0x46, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01, 0xE7, 0x01, 0xC4, 0x00, 0xE4, 0x00, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0xA3, 0x00, 0x83, 0x08, 0x25, 0x01, 0xC4, 0x00, 0xA7, 0x01, 0xE4, 0x00, 0x08, 0x02, 0x66, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xA6, 0x01, 0x28, 0x02, 0xA7, 0x01, 0x2C, 0x03, 0x54, 0x05, 0xF2, 0x04, 0x05, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0x45, 0x01, 0x83, 0x00, 0xA7, 0x01, 0x25, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x08, 0x02, 0xE4, 0x00, 0x04, 0x01, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0xC4, 0x00, 0xA3, 0x00, 0x86, 0x01, 0xE4, 0x00, 0xE7, 0x01, 0x45, 0x01, 0x28, 0x02, 0xA6, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xDF, 0x07, 0xDF, 0x07, 0x34, 0x05, 0x79, 0x06, 0x28, 0x02, 0x0F, 0x04, 0x4C, 0x03, 0xA6, 0x01, 0x25, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x05, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x78, 0x06, 0x25, 0x01, 0xA7, 0x01, 0x25, 0x01, 0x28, 0x02, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xE8, 0x01, 0xC4, 0x00, 0x25, 0x01, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0x04, 0x01, 0xA4, 0x00, 0xA6, 0x01, 0x05, 0x01, 0x08, 0x02, 0x86, 0x01, 0x29, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0xDF, 0x07, 0xB6, 0x05, 0x59, 0x06, 0x0C, 0x03, 0x14, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x01, 0x04, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x04, 0x01, 0x86, 0x01, 0x99, 0x06, 0x37, 0x06, 0x50, 0x04, 0xE7, 0x01, 0x28, 0x02, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01, 0xFF, 0x07, 0x45, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0x08, 0x02, 0x25, 0x01, 0x66, 0x01, 0x83, 0x00, 0x63, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x63, 0x08, 0x83, 0x08, 0x25, 0x01, 0xE4, 0x00, 0xC7, 0x01, 0x45, 0x01,
+    0xE7, 0x01, 0x86, 0x01, 0x2C, 0x03, 0xD3, 0x04, 0xFA, 0x06, 0xFA, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x01, 0x25, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x25, 0x01, 0x13, 0x05, 0x54, 0x05, 0x2C, 0x03, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0x28, 0x02, 0x25, 0x01, 0x86, 0x01, 0x83, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0xE4, 0x00, 0xC4, 0x00, 0xA6, 0x01, 0x65, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x25, 0x01, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x24, 0x01, 0xA6, 0x01, 0x0F, 0x04, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x45, 0x01, 0xA7, 0x01, 0x83, 0x00, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x63, 0x00, 0x45, 0x01, 0xE4, 0x00,
+    0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xA6, 0x01, 0x04, 0x01, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE4, 0x00, 0x66, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x66, 0x01,
+    0xE7, 0x01, 0xC4, 0x00, 0xC3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x63, 0x00, 0x25, 0x01, 0xE4, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xA6, 0x01, 0x04, 0x01, 0x04, 0x01, 0x63, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x25, 0x01, 0xA6, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x07, 0x4D, 0x03, 0xCB, 0x02, 0x25, 0x01, 0x45, 0x01, 0xC3, 0x00, 0xE3, 0x00, 0x83, 0x00, 0x83, 0x00, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x63, 0x00, 0x04, 0x01, 0xE4, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01,
+    0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xE4, 0x00, 0x04, 0x01, 0x63, 0x00, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0x05, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x03, 0xCA, 0x02, 0xCE, 0x03, 0xAE, 0x03, 0x50, 0x04,
+    0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xC3, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0xC3, 0x00, 0x62, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE4, 0x00, 0xA3, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xE4, 0x00, 0x25, 0x01, 0x63, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0xE4, 0x00, 0xA6, 0x01, 0x86, 0x01, 0xE7, 0x01, 0x4C, 0x03, 0x4D, 0x03, 0x50, 0x04, 0x50, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x04, 0x01, 0xA3, 0x00, 0xE3, 0x00, 0x83, 0x00, 0xA3, 0x00, 0x62, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xC4, 0x00, 0xC3, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06,
+    0xFA, 0x06, 0xE4, 0x00, 0x45, 0x01, 0x63, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0xE4, 0x00, 0xC3, 0x00, 0x25, 0x01, 0xC3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04,
+    0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x04, 0x01, 0x83, 0x00, 0xC3, 0x00, 0x62, 0x00, 0x83, 0x00, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0x82, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0xA3, 0x00, 0x65, 0x01, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0x45, 0x01, 0x83, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x82, 0x00, 0xC3, 0x00, 0xA3, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xC3, 0x00, 0xE3, 0x00, 0xA3, 0x00,
+    0xC3, 0x00, 0x62, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xA3, 0x00, 0x42, 0x08, 0x83, 0x00, 0x83, 0x00, 0x45, 0x01, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0x65, 0x01, 0xA3, 0x00,
+    0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0x83, 0x00, 0x82, 0x00,
+    0xC3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x04, 0x01, 0xA3, 0x00, 0xE3, 0x00, 0x83, 0x00, 0xA3, 0x00, 0x62, 0x08, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x82, 0x00, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00,
+    0xA3, 0x00, 0x63, 0x00, 0x45, 0x01, 0xE4, 0x00, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xE4, 0x00, 0x66, 0x01, 0xA3, 0x00, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x08, 0xA3, 0x00, 0x83, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04,
+    0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x04, 0x01, 0xA3, 0x00, 0xC3, 0x00, 0x62, 0x00, 0x83, 0x00, 0x62, 0x08, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x0F, 0x04, 0x04, 0x01, 0x45, 0x01, 0xE4, 0x00, 0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xE4, 0x00, 0xE4, 0x00, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x82, 0x00, 0xC3, 0x00, 0xA3, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x04, 0x01, 0xC3, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x8D, 0x03, 0xEE, 0x03, 0xEB, 0x02, 0x05, 0x01,
+    0x86, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xC4, 0x00, 0x04, 0x01, 0x62, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0x83, 0x00, 0x83, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04,
+    0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0xC3, 0x00, 0x04, 0x01, 0x04, 0x01, 0xE7, 0x01, 0xEB, 0x02, 0x07, 0x02, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x86, 0x01, 0xE4, 0x00, 0x25, 0x01, 0x63, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x08, 0xA3, 0x00, 0x83, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x30, 0x04, 0xEF, 0x03, 0xA6, 0x01, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06,
+    0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xE4, 0x00, 0x45, 0x01, 0x63, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x82, 0x00,
+    0xC3, 0x00, 0xA3, 0x00, 0xE4, 0x00, 0xC3, 0x00, 0x04, 0x01, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x70, 0x04, 0x0F, 0x04, 0xCE, 0x03, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06, 0x04, 0x01, 0x45, 0x01, 0x83, 0x00, 0x83, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01, 0x66, 0x01, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0x83, 0x00, 0x83, 0x00, 0xC3, 0x00, 0xA3, 0x00, 0x04, 0x01, 0xC3, 0x00, 0x70, 0x04, 0x70, 0x04, 0xEF, 0x03, 0xCE, 0x03, 0xEB, 0x02, 0xFA, 0x06, 0xFA, 0x06, 0xFA, 0x06,
+    0xFA, 0x06, 0x04, 0x01, 0x65, 0x01, 0xA3, 0x00, 0xA3, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x66, 0x01,
+    0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x00, 0xA3, 0x00, 0x83, 0x00, 0xE3, 0x00, 0xA3, 0x00, 0x24, 0x01, 0xEF, 0x03, 0xAA, 0x02, 0xCE, 0x03, 0xFA, 0x06, 0x45, 0x01, 0x86, 0x01, 0xA3, 0x00, 0xC4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x86, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x83, 0x00, 0x82, 0x00, 0xE3, 0x00, 0xC3, 0x00, 0x25, 0x01, 0x04, 0x01, 0x45, 0x01, 0xC3, 0x00,
+    0xE4, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x86, 0x01, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x62, 0x00, 0x62, 0x00, 0xC4, 0x00, 0xA3, 0x00, 0xC3, 0x00, 0x62, 0x00, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x86, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01,
+    0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01,
+    0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0x66, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
 };
 const lv_img_dsc_t ui_img_generic_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_generic_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED,
     .data = ui_img_generic_80_png_data
 };
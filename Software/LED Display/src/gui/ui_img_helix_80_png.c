@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Helix_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_helix_80_png_data[] = {
-    0x02, 0x31, 0xFF, 0x87, 0x92, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x38, 0xFF, 0x42, 0x41, 0xFF, 0x43, 0x49, 0xFF, 0x22, 0x49, 0xFF, 0x47, 0xBA, 0xFF, 0x23, 0x59, 0xFF, 0x43, 0x69, 0xFF, 0x23, 0x71, 0xFF, 0x64, 0x69, 0xFF, 0x27, 0xCA, 0xFF, 0x84, 0x71, 0xFF, 0x84, 0x71, 0xFF, 0xA4, 0x71, 0xFF, 0xE5, 0x71, 0xFF, 0x64, 0x79, 0xFF, 0x28, 0xFA, 0xFF, 0x64, 0x79, 0xFF, 0xC5, 0x71, 0xFF, 0xFF, 0x87, 0xFF, 0x84, 0x69, 0xFF, 0x64, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x71, 0xFF, 0x84, 0x69, 0xFF, 0x64, 0x69, 0xFF, 0x23, 0x69, 0xFF, 0x8D, 0xFE, 0xFF, 0x65, 0x89, 0xFF, 0x23, 0x61, 0xFF, 0x44, 0x59, 0xFF, 0x64, 0x61, 0xFF, 0x64, 0x69, 0xFF, 0xCF, 0xFF, 0xFF, 0x44, 0x61, 0xFF, 0x03, 0x59, 0xFF, 0x24, 0x59, 0xFF, 0x24, 0x59, 0xFF, 0xA7, 0xF9, 0xFF, 0x24, 0x59, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0x27, 0x92, 0xFF, 0x24, 0x49, 0xFF, 0xE3, 0x40, 0xFF, 0x04, 0x41, 0xFF, 0x04, 0x49, 0xFF, 0xC6, 0x79, 0xFF, 0x04, 0x41, 0xFF, 0x25, 0x49, 0xFF, 0x04, 0x41, 0xFF, 0xE3, 0x40, 0xFF, 0x04, 0x41, 0xFF, 0xC5, 0x81, 0xFF, 0x04, 0x39, 0xFF, 0xC3, 0x38, 0xFF, 0xE3, 0x38, 0xFF, 0xE3, 0x38, 0xFF, 0x85, 0x61, 0xFF, 0xE3, 0x38, 0xFF,
-    0xE3, 0x30, 0xFF, 0x04, 0x39, 0xFF, 0x04, 0x39, 0xFF, 0x04, 0x31, 0xFF, 0x85, 0x79, 0xFF, 0x24, 0x39, 0xFF, 0x45, 0x39, 0xFF, 0x45, 0x39, 0xFF, 0x04, 0x31, 0xFF, 0x65, 0x51, 0xFF, 0x24, 0x39, 0xFF, 0x45, 0x39, 0xFF, 0x24, 0x31, 0xFF, 0xA6, 0x49, 0xFF, 0xE3, 0x30, 0xFF, 0xA5, 0x71, 0xFF, 0x22, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0xE5, 0x81, 0xFF, 0xE2, 0x40, 0xFF, 0xA4, 0x51, 0xFF, 0xC5, 0x59, 0xFF, 0x87, 0xD1, 0xFF, 0xE5, 0xA1, 0xFF, 0x22, 0x61, 0xFF, 0xC6, 0x99, 0xFF, 0x4A, 0xFB, 0xFF, 0xE9, 0x9A, 0xFF, 0x22, 0x79, 0xFF, 0x68, 0xFA, 0xFF, 0x44, 0xA1, 0xFF, 0x44, 0x81, 0xFF, 0x84, 0x79, 0xFF, 0xE5, 0x91, 0xFF, 0x07, 0xF2, 0xFF, 0xE7, 0xE9, 0xFF, 0x48, 0xEA, 0xFF, 0x45, 0x7A, 0xFF, 0x42, 0x61, 0xFF, 0xC5, 0x81, 0xFF, 0xE6, 0xF9, 0xFF, 0xC9, 0xD2, 0xFF, 0x43, 0x71, 0xFF, 0x64, 0x71, 0xFF, 0xE6, 0xA9, 0xFF, 0x85, 0x89, 0xFF, 0x47, 0xA2, 0xFF, 0xA6, 0x79, 0xFF, 0x65, 0x69, 0xFF, 0x84, 0x69, 0xFF, 0x44, 0x69, 0xFF, 0x06, 0xCA, 0xFF, 0x07, 0x92, 0xFF, 0x44, 0x61, 0xFF, 0x24, 0x59, 0xFF, 0x44, 0x69, 0xFF, 0x48, 0xC2, 0xFF, 0x45, 0x69, 0xFF, 0x86, 0x71, 0xFF, 0xA5, 0x61, 0xFF, 0x85, 0x71, 0xFF, 0x03, 0x51, 0xFF, 0x85, 0x71, 0xFF, 0x03, 0x51, 0xFF,
-    0xC6, 0x61, 0xFF, 0x89, 0x8A, 0xFF, 0x24, 0x49, 0xFF, 0x27, 0x8A, 0xFF, 0x04, 0x51, 0xFF, 0x27, 0x7A, 0xFF, 0x4D, 0xC3, 0xFF, 0x65, 0x59, 0xFF, 0xE4, 0x48, 0xFF, 0x24, 0x69, 0xFF, 0xE3, 0x48, 0xFF, 0x04, 0x41, 0xFF, 0xE3, 0x38, 0xFF, 0x04, 0x41, 0xFF, 0xA6, 0x89, 0xFF, 0xE3, 0x48, 0xFF, 0xC2, 0x38, 0xFF, 0xE3, 0x38, 0xFF, 0xE7, 0x61, 0xFF, 0xC3, 0x30, 0xFF, 0x48, 0x72, 0xFF, 0x24, 0x41, 0xFF, 0x24, 0x39, 0xFF, 0x44, 0x39, 0xFF, 0x45, 0x39, 0xFF, 0x6A, 0xBA, 0xFF, 0x28, 0x62, 0xFF, 0x24, 0x39, 0xFF, 0x65, 0x41, 0xFF, 0xC2, 0x30, 0xFF, 0x04, 0x49, 0xFF, 0xC1, 0x38, 0xFF, 0x22, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x41, 0xFF, 0x02, 0x41, 0xFF, 0x83, 0x49, 0xFF, 0x85, 0x61, 0xFF, 0x23, 0x59, 0xFF, 0x43, 0x69, 0xFF, 0x23, 0x71, 0xFF, 0x84, 0x71, 0xFF, 0x03, 0x71, 0xFF, 0x24, 0x81, 0xFF, 0x04, 0xB9, 0xFF, 0x25, 0xF1, 0xFF, 0x64, 0xB1, 0xFF, 0x06, 0x92, 0xFF, 0x85, 0x91, 0xFF, 0x65, 0xA9, 0xFF, 0xA7, 0xF2, 0xFF, 0x85, 0xE9, 0xFF, 0x06, 0x8A, 0xFF, 0xA5, 0x81, 0xFF, 0x64, 0x81, 0xFF, 0x6A, 0xB3, 0xFF, 0x08, 0x83, 0xFF, 0xA5, 0x79, 0xFF, 0xE6, 0x79, 0xFF, 0xFE, 0xAF, 0xFF, 0x64, 0x79, 0xFF, 0xA5, 0x79, 0xFF, 0x64, 0x71, 0xFF,
-    0x44, 0x61, 0xFF, 0x44, 0x69, 0xFF, 0x64, 0x69, 0xFF, 0x44, 0x71, 0xFF, 0x44, 0x69, 0xFF, 0x44, 0x61, 0xFF, 0x24, 0x61, 0xFF, 0x44, 0x69, 0xFF, 0x44, 0x61, 0xFF, 0xE3, 0x58, 0xFF, 0x24, 0x59, 0xFF, 0x24, 0x51, 0xFF, 0x04, 0x59, 0xFF, 0x24, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x04, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x46, 0x59, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0xE3, 0x38, 0xFF, 0xC3, 0x38, 0xFF, 0x04, 0x41, 0xFF, 0xE3, 0x40, 0xFF, 0xE3, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xA2, 0x30, 0xFF, 0xE3, 0x38, 0xFF, 0x24, 0x41, 0xFF, 0x04, 0x31, 0xFF, 0x44, 0x39, 0xFF, 0x24, 0x39, 0xFF, 0x24, 0x31, 0xFF, 0x45, 0x39, 0xFF, 0x24, 0x31, 0xFF, 0x25, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x04, 0x31, 0xFF, 0x24, 0x39, 0xFF, 0x24, 0x41, 0xFF, 0xE3, 0x38, 0xFF, 0x03, 0x41, 0xFF, 0x02, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x66, 0xAA, 0xFF, 0x63, 0x49, 0xFF, 0x02, 0x59, 0xFF, 0x43, 0x61, 0xFF, 0x44, 0x69, 0xFF, 0xC6, 0xF1, 0xFF, 0x85, 0x99, 0xFF, 0xE2, 0x88, 0xFF, 0x64, 0x99, 0xFF, 0x45, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0xC9, 0xFF,
-    0xC5, 0xA9, 0xFF, 0x64, 0x99, 0xFF, 0x26, 0xCA, 0xFF, 0x43, 0xE9, 0xFF, 0x25, 0xE9, 0xFF, 0x86, 0x9A, 0xFF, 0xA5, 0x91, 0xFF, 0x85, 0x91, 0xFF, 0x66, 0xAA, 0xFF, 0xAD, 0xFB, 0xFF, 0x85, 0x91, 0xFF, 0x84, 0x79, 0xFF, 0x85, 0x89, 0xFF, 0xC6, 0x81, 0xFF, 0xC5, 0xA1, 0xFF, 0x65, 0x91, 0xFF, 0x85, 0x81, 0xFF, 0x85, 0x71, 0xFF, 0x44, 0x79, 0xFF, 0x47, 0xA2, 0xFF, 0x65, 0x79, 0xFF, 0x44, 0x69, 0xFF, 0x24, 0x69, 0xFF, 0x65, 0x79, 0xFF, 0x27, 0x92, 0xFF, 0x44, 0x69, 0xFF, 0x24, 0x59, 0xFF, 0x65, 0x59, 0xFF, 0x24, 0x59, 0xFF, 0xC6, 0x79, 0xFF, 0x45, 0x59, 0xFF, 0x24, 0x59, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0x65, 0x59, 0xFF, 0x46, 0x61, 0xFF, 0x45, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x45, 0x49, 0xFF, 0xE7, 0x79, 0xFF, 0xE4, 0x40, 0xFF, 0x04, 0x49, 0xFF, 0xE4, 0x40, 0xFF, 0x04, 0x41, 0xFF, 0xA5, 0x71, 0xFF, 0xC3, 0x40, 0xFF, 0x04, 0x49, 0xFF, 0x45, 0x51, 0xFF, 0xE3, 0x40, 0xFF, 0x85, 0x69, 0xFF, 0x44, 0x41, 0xFF, 0x04, 0x39, 0xFF, 0x04, 0x39, 0xFF, 0x04, 0x39, 0xFF, 0xA5, 0x61, 0xFF, 0x86, 0x51, 0xFF, 0x04, 0x39, 0xFF, 0x24, 0x39, 0xFF, 0xE3, 0x38, 0xFF, 0x44, 0x51, 0xFF, 0xC3, 0x38, 0xFF, 0x44, 0x41, 0xFF, 0xE2, 0x30, 0xFF,
-    0x02, 0x29, 0xFF, 0x02, 0x39, 0xFF, 0x23, 0x41, 0xFF, 0x02, 0x41, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0xC2, 0x58, 0xFF, 0x23, 0x61, 0xFF, 0x65, 0x89, 0xFF, 0x44, 0x99, 0xFF, 0x25, 0xD1, 0xFF, 0x45, 0xC9, 0xFF, 0x44, 0x99, 0xFF, 0x24, 0xB1, 0xFF, 0x44, 0xC1, 0xFF, 0x85, 0xE1, 0xFF, 0xE7, 0xEA, 0xFF, 0x84, 0xA1, 0xFF, 0x64, 0x99, 0xFF, 0x85, 0xB9, 0xFF, 0x45, 0xD9, 0xFF, 0xCB, 0xF2, 0xFF, 0xE5, 0x89, 0xFF, 0x85, 0x99, 0xFF, 0x06, 0xB2, 0xFF, 0xC5, 0xA1, 0xFF, 0xC5, 0x89, 0xFF, 0xA8, 0x8A, 0xFF, 0x87, 0x92, 0xFF, 0xA6, 0xA1, 0xFF, 0xE6, 0x99, 0xFF, 0x06, 0x92, 0xFF, 0x85, 0x79, 0xFF, 0xC6, 0x81, 0xFF, 0xA5, 0x99, 0xFF, 0x85, 0xB1, 0xFF, 0xA5, 0x89, 0xFF, 0xA6, 0x79, 0xFF, 0x64, 0x69, 0xFF, 0x85, 0x81, 0xFF, 0x65, 0x71, 0xFF, 0x44, 0x71, 0xFF, 0x44, 0x69, 0xFF, 0x45, 0x61, 0xFF, 0x44, 0x69, 0xFF, 0x45, 0x61, 0xFF, 0x65, 0x61, 0xFF, 0x24, 0x59, 0xFF, 0x24, 0x51, 0xFF, 0x25, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0xE3, 0x40, 0xFF, 0x04, 0x41, 0xFF, 0x05, 0x41, 0xFF, 0xC3, 0x38, 0xFF, 0xE4, 0x40, 0xFF,
-    0xC3, 0x30, 0xFF, 0x24, 0x41, 0xFF, 0xC3, 0x38, 0xFF, 0x45, 0x41, 0xFF, 0x04, 0x31, 0xFF, 0x45, 0x39, 0xFF, 0x45, 0x39, 0xFF, 0x45, 0x39, 0xFF, 0x45, 0x39, 0xFF, 0x45, 0x39, 0xFF, 0x65, 0x39, 0xFF, 0xE3, 0x30, 0xFF, 0x03, 0x31, 0xFF, 0x44, 0x41, 0xFF, 0x03, 0x39, 0xFF, 0xE3, 0x30, 0xFF, 0x84, 0x49, 0xFF, 0x45, 0x6A, 0xFF, 0xE1, 0x40, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x64, 0x71, 0xFF, 0x48, 0xEA, 0xFF, 0x43, 0x71, 0xFF, 0x8C, 0xFB, 0xFF, 0xE3, 0xC0, 0xFF, 0x26, 0xEA, 0xFF, 0x49, 0xEC, 0xFF, 0xE3, 0xC8, 0xFF, 0x65, 0xE1, 0xFF, 0x64, 0xB1, 0xFF, 0x85, 0xE9, 0xFF, 0x29, 0xF4, 0xFF, 0xA5, 0xB1, 0xFF, 0x64, 0xA1, 0xFF, 0x88, 0xC2, 0xFF, 0x85, 0xC9, 0xFF, 0xE6, 0xB1, 0xFF, 0xE6, 0xA1, 0xFF, 0x65, 0xC9, 0xFF, 0x07, 0xFA, 0xFF, 0x26, 0xCA, 0xFF, 0xC5, 0x91, 0xFF, 0x88, 0x92, 0xFF, 0x29, 0x8B, 0xFF, 0x45, 0xF1, 0xFF, 0x06, 0xDA, 0xFF, 0x77, 0xB7, 0xFF, 0xA5, 0x81, 0xFF, 0xC5, 0x99, 0xFF, 0x66, 0xD9, 0xFF, 0xC7, 0xF9, 0xFF, 0xA6, 0xC1, 0xFF, 0xA5, 0x81, 0xFF, 0x65, 0x79, 0xFF, 0x64, 0x91, 0xFF, 0x06, 0xB2, 0xFF, 0x86, 0xA9, 0xFF, 0x65, 0x71, 0xFF, 0x44, 0x61, 0xFF, 0x24, 0x69, 0xFF, 0xE6, 0x91, 0xFF, 0xA6, 0x91, 0xFF, 0x44, 0x69, 0xFF,
-    0x86, 0x61, 0xFF, 0x45, 0x59, 0xFF, 0x28, 0x82, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0x25, 0x51, 0xFF, 0xC7, 0x79, 0xFF, 0x25, 0x51, 0xFF, 0x25, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0xC3, 0x38, 0xFF, 0xA6, 0x69, 0xFF, 0x25, 0x49, 0xFF, 0xE3, 0x40, 0xFF, 0xC3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0x86, 0x61, 0xFF, 0xE3, 0x38, 0xFF, 0x04, 0x39, 0xFF, 0x24, 0x39, 0xFF, 0x44, 0x41, 0xFF, 0x85, 0x59, 0xFF, 0x45, 0x39, 0xFF, 0x04, 0x31, 0xFF, 0x03, 0x39, 0xFF, 0x44, 0x49, 0xFF, 0x85, 0x51, 0xFF, 0x44, 0x41, 0xFF, 0xE3, 0x38, 0xFF, 0x24, 0x39, 0xFF, 0xE3, 0x38, 0xFF, 0x42, 0x41, 0xFF, 0x05, 0x7A, 0xFF, 0xC8, 0xBA, 0xFF, 0xE2, 0x48, 0xFF, 0x64, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x43, 0x69, 0xFF, 0x26, 0xEA, 0xFF, 0xAA, 0xFA, 0xFF, 0x44, 0xC1, 0xFF, 0x45, 0xD1, 0xFF, 0x28, 0xFA, 0xFF, 0x05, 0xF9, 0xFF, 0x89, 0xF3, 0xFF, 0xA5, 0xA9, 0xFF, 0x44, 0xB1, 0xFF, 0xE9, 0xF2, 0xFF, 0x24, 0xD9, 0xFF, 0xD0, 0xFF, 0xFF, 0x85, 0xC9, 0xFF, 0xA6, 0xC1, 0xFF, 0xA5, 0xD1, 0xFF, 0xA4, 0x99, 0xFF, 0xC6, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0xD1, 0xFF, 0xA5, 0x99, 0xFF, 0xC5, 0x91, 0xFF, 0x27, 0xB2, 0xFF, 0xFD, 0xFF, 0xFF, 0x27, 0xFA, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xC6, 0x89, 0xFF, 0xE6, 0xA1, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0xE9, 0xFF, 0xFF, 0x9F, 0xFF, 0xA6, 0x81, 0xFF, 0x65, 0xB1, 0xFF, 0xFD, 0xFF, 0xFF, 0x45, 0xE1, 0xFF, 0x85, 0x81, 0xFF, 0xC6, 0x71, 0xFF, 0x44, 0x79, 0xFF, 0xA6, 0xB1, 0xFF, 0xFD, 0xFF, 0xFF, 0x45, 0x79, 0xFF, 0x86, 0x61, 0xFF, 0xA6, 0x69, 0xFF, 0x65, 0x61, 0xFF, 0xAA, 0xFC, 0xFF, 0xA7, 0x69, 0xFF, 0x65, 0x59, 0xFF, 0x25, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x24, 0x59, 0xFF, 0xE7, 0xB9, 0xFF, 0x24, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0xE4, 0x40, 0xFF, 0xE3, 0x48, 0xFF, 0x07, 0xA2, 0xFF, 0x04, 0x49, 0xFF, 0xE3, 0x40, 0xFF, 0x04, 0x39, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0xC6, 0x91, 0xFF, 0x45, 0x39, 0xFF, 0x45, 0x41, 0xFF, 0x45, 0x39, 0xFF, 0x24, 0x39, 0xFF, 0x85, 0x89, 0xFF, 0x85, 0x51, 0xFF, 0xE3, 0x38, 0xFF, 0x03, 0x31, 0xFF, 0x03, 0x31, 0xFF, 0x65, 0x59, 0xFF, 0x85, 0x71, 0xFF, 0x43, 0x49, 0xFF, 0x25, 0x5A, 0xFF, 0xC2, 0x59, 0xFF, 0xE8, 0xAA, 0xFF, 0x43, 0x51, 0xFF, 0xE2, 0x60, 0xFF, 0xC2, 0x60, 0xFF, 0x27, 0xEB, 0xFF, 0x82, 0xE0, 0xFF, 0x23, 0xB9, 0xFF, 0xE2, 0xA0, 0xFF, 0x86, 0xE9, 0xFF, 0xDF, 0xFF, 0xFF, 0x28, 0xFA, 0xFF, 0x44, 0xB9, 0xFF, 0x64, 0xA9, 0xFF,
-    0x64, 0xA1, 0xFF, 0x06, 0xCA, 0xFF, 0x47, 0xD2, 0xFF, 0x45, 0xF1, 0xFF, 0x45, 0xF9, 0xFF, 0x26, 0xCA, 0xFF, 0xE5, 0xA9, 0xFF, 0xE6, 0xC1, 0xFF, 0x86, 0xF1, 0xFF, 0x85, 0xD9, 0xFF, 0x06, 0xBA, 0xFF, 0x87, 0x9A, 0xFF, 0x28, 0xA3, 0xFF, 0xA6, 0xE9, 0xFF, 0xE6, 0xE9, 0xFF, 0xC6, 0xC1, 0xFF, 0xA5, 0x89, 0xFF, 0xE5, 0x99, 0xFF, 0x85, 0xD1, 0xFF, 0xE6, 0xF9, 0xFF, 0xE7, 0xB9, 0xFF, 0x07, 0x8A, 0xFF, 0xC6, 0x81, 0xFF, 0x86, 0xC9, 0xFF, 0xC9, 0xFA, 0xFF, 0x86, 0xB1, 0xFF, 0xA6, 0x81, 0xFF, 0x07, 0x72, 0xFF, 0x65, 0x81, 0xFF, 0xE6, 0x99, 0xFF, 0x86, 0x99, 0xFF, 0xC6, 0x91, 0xFF, 0x86, 0x61, 0xFF, 0x86, 0x69, 0xFF, 0x45, 0x61, 0xFF, 0x68, 0xCA, 0xFF, 0x66, 0x61, 0xFF, 0x09, 0x5A, 0xFF, 0xC6, 0x71, 0xFF, 0x25, 0x61, 0xFF, 0x24, 0x61, 0xFF, 0x25, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0xA6, 0x69, 0xFF, 0x05, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x03, 0x61, 0xFF, 0xE4, 0x50, 0xFF, 0xE3, 0x48, 0xFF, 0x04, 0x41, 0xFF, 0xC3, 0x40, 0xFF, 0xC3, 0x40, 0xFF, 0xA9, 0x7A, 0xFF, 0x24, 0x41, 0xFF, 0x65, 0x41, 0xFF, 0x65, 0x41, 0xFF, 0x45, 0x41, 0xFF, 0xA2, 0x40, 0xFF, 0x04, 0x39, 0xFF, 0x24, 0x39, 0xFF, 0x24, 0x41, 0xFF, 0x45, 0x41, 0xFF, 0x64, 0x51, 0xFF, 0x24, 0x49, 0xFF,
-    0xEA, 0xC2, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x41, 0xFF, 0x02, 0x51, 0xFF, 0x09, 0xD3, 0xFF, 0xC1, 0x58, 0xFF, 0x43, 0x61, 0xFF, 0x03, 0x71, 0xFF, 0x64, 0xB1, 0xFF, 0xE7, 0xF1, 0xFF, 0x64, 0x91, 0xFF, 0xA5, 0x99, 0xFF, 0x03, 0xC9, 0xFF, 0x25, 0xF9, 0xFF, 0xFE, 0xFF, 0xFF, 0x64, 0xC1, 0xFF, 0x84, 0xA1, 0xFF, 0x43, 0x99, 0xFF, 0x64, 0xB1, 0xFF, 0xEB, 0xFC, 0xFF, 0xDA, 0xFF, 0xFF, 0x64, 0xD1, 0xFF, 0xC5, 0xA1, 0xFF, 0x84, 0xB1, 0xFF, 0xE7, 0xF9, 0xFF, 0xFE, 0xFF, 0xFF, 0x27, 0xBA, 0xFF, 0x67, 0x9A, 0xFF, 0x26, 0x92, 0xFF, 0xC6, 0xB1, 0xFF, 0xF0, 0xFF, 0xFF, 0x2A, 0xE3, 0xFF, 0xA5, 0x81, 0xFF, 0x47, 0x92, 0xFF, 0x86, 0xA9, 0xFF, 0x27, 0xDA, 0xFF, 0x46, 0x9A, 0xFF, 0x70, 0x84, 0xFF, 0xE6, 0x81, 0xFF, 0x24, 0xB9, 0xFF, 0x27, 0xCA, 0xFF, 0x86, 0x91, 0xFF, 0xE6, 0x81, 0xFF, 0x27, 0x72, 0xFF, 0x85, 0x81, 0xFF, 0xC6, 0x81, 0xFF, 0xC6, 0x81, 0xFF, 0xC6, 0x81, 0xFF, 0x65, 0x69, 0xFF, 0xA6, 0x71, 0xFF, 0x85, 0x69, 0xFF, 0x29, 0xF2, 0xFF, 0x66, 0x59, 0xFF, 0x66, 0x61, 0xFF, 0x87, 0x61, 0xFF, 0x46, 0x61, 0xFF, 0xE8, 0xF9, 0xFF, 0x25, 0x51, 0xFF, 0x25, 0x51, 0xFF, 0x05, 0x49, 0xFF, 0xE4, 0x48, 0xFF, 0xC5, 0x89, 0xFF, 0x04, 0x51, 0xFF, 0xC3, 0x40, 0xFF,
-    0x24, 0x49, 0xFF, 0x03, 0x41, 0xFF, 0xC3, 0x60, 0xFF, 0xE3, 0x40, 0xFF, 0x24, 0x41, 0xFF, 0x85, 0x49, 0xFF, 0x65, 0x41, 0xFF, 0x48, 0x8A, 0xFF, 0x04, 0x41, 0xFF, 0x03, 0x39, 0xFF, 0x04, 0x39, 0xFF, 0x04, 0x39, 0xFF, 0xE6, 0x71, 0xFF, 0x04, 0x49, 0xFF, 0x44, 0x41, 0xFF, 0x64, 0x41, 0xFF, 0xC6, 0xC9, 0xFF, 0x02, 0x31, 0xFF, 0x63, 0x69, 0xFF, 0xA1, 0x38, 0xFF, 0x01, 0x59, 0xFF, 0x64, 0x69, 0xFF, 0x23, 0x51, 0xFF, 0x43, 0x61, 0xFF, 0x64, 0xB1, 0xFF, 0xCC, 0xE4, 0xFF, 0x23, 0x71, 0xFF, 0x44, 0x91, 0xFF, 0x64, 0xA1, 0xFF, 0x84, 0xC1, 0xFF, 0xA5, 0xC1, 0xFF, 0x85, 0xC9, 0xFF, 0x85, 0xC1, 0xFF, 0x43, 0x99, 0xFF, 0x46, 0xB2, 0xFF, 0xA6, 0xE9, 0xFF, 0xC7, 0xF2, 0xFF, 0xA5, 0xC9, 0xFF, 0x88, 0xBA, 0xFF, 0x25, 0x9A, 0xFF, 0xA5, 0xC1, 0xFF, 0xAA, 0xFB, 0xFF, 0xA5, 0xB1, 0xFF, 0xC9, 0xA2, 0xFF, 0x23, 0x91, 0xFF, 0xE6, 0xA9, 0xFF, 0xE4, 0x99, 0xFF, 0xE6, 0xB9, 0xFF, 0xE6, 0x89, 0xFF, 0xE6, 0x81, 0xFF, 0x85, 0x99, 0xFF, 0xC5, 0xA1, 0xFF, 0xA9, 0xA2, 0xFF, 0x6C, 0x7B, 0xFF, 0x07, 0x82, 0xFF, 0x65, 0xB9, 0xFF, 0x88, 0xA2, 0xFF, 0xC6, 0x91, 0xFF, 0xE6, 0x79, 0xFF, 0xA6, 0x71, 0xFF, 0x85, 0x89, 0xFF, 0xE8, 0x89, 0xFF, 0xA6, 0x89, 0xFF, 0xC7, 0xA1, 0xFF,
-    0xA6, 0x71, 0xFF, 0x27, 0x82, 0xFF, 0x04, 0x69, 0xFF, 0x86, 0x71, 0xFF, 0x17, 0x3C, 0xFF, 0x0C, 0x93, 0xFF, 0x86, 0x69, 0xFF, 0x96, 0x7D, 0xFF, 0x45, 0x61, 0xFF, 0x66, 0x59, 0xFF, 0xA5, 0x69, 0xFF, 0xE4, 0x50, 0xFF, 0xAC, 0x7A, 0xFF, 0xE3, 0x58, 0xFF, 0x65, 0x61, 0xFF, 0xC3, 0x50, 0xFF, 0xE3, 0x48, 0xFF, 0xC4, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0x45, 0x59, 0xFF, 0x24, 0x41, 0xFF, 0x03, 0x41, 0xFF, 0x46, 0x41, 0xFF, 0x86, 0x61, 0xFF, 0x24, 0x41, 0xFF, 0xE3, 0x38, 0xFF, 0x44, 0x41, 0xFF, 0x86, 0x41, 0xFF, 0x24, 0x49, 0xFF, 0x04, 0x41, 0xFF, 0x45, 0x41, 0xFF, 0x44, 0x41, 0xFF, 0xE2, 0x30, 0xFF, 0x05, 0x72, 0xFF, 0x22, 0x41, 0xFF, 0x63, 0x59, 0xFF, 0x43, 0x39, 0xFF, 0x69, 0xBA, 0xFF, 0x04, 0x9A, 0xFF, 0x43, 0x51, 0xFF, 0xC5, 0x79, 0xFF, 0x45, 0xC1, 0xFF, 0x27, 0xEA, 0xFF, 0x0C, 0xFE, 0xFF, 0x65, 0x81, 0xFF, 0x23, 0x81, 0xFF, 0x84, 0x81, 0xFF, 0x04, 0xC9, 0xFF, 0xDF, 0xFF, 0xFF, 0x24, 0xA1, 0xFF, 0x63, 0x91, 0xFF, 0x64, 0xC9, 0xFF, 0x06, 0xCA, 0xFF, 0x84, 0xA9, 0xFF, 0x84, 0x91, 0xFF, 0xE5, 0x89, 0xFF, 0x84, 0x91, 0xFF, 0x68, 0xD2, 0xFF, 0x64, 0x91, 0xFF, 0xE5, 0x89, 0xFF, 0x02, 0x79, 0xFF, 0xC5, 0xA9, 0xFF, 0x47, 0xBA, 0xFF, 0xA6, 0xB9, 0xFF,
-    0xE6, 0x89, 0xFF, 0xE6, 0x91, 0xFF, 0x65, 0xC1, 0xFF, 0x27, 0xDA, 0xFF, 0xC6, 0xB1, 0xFF, 0x8B, 0x93, 0xFF, 0x07, 0x8A, 0xFF, 0x65, 0xC1, 0xFF, 0x27, 0xC2, 0xFF, 0xC7, 0xA9, 0xFF, 0x68, 0x92, 0xFF, 0x2C, 0x8B, 0xFF, 0x65, 0x91, 0xFF, 0x27, 0xBA, 0xFF, 0x3D, 0xD7, 0xFF, 0x86, 0xA1, 0xFF, 0xC7, 0x81, 0xFF, 0x28, 0x7A, 0xFF, 0x27, 0x9A, 0xFF, 0xE8, 0x91, 0xFF, 0x0A, 0x6A, 0xFF, 0x08, 0x82, 0xFF, 0x66, 0x59, 0xFF, 0xE7, 0x99, 0xFF, 0x47, 0x49, 0xFF, 0xE8, 0x71, 0xFF, 0x45, 0x51, 0xFF, 0xA9, 0x49, 0xFF, 0xC7, 0x89, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0xE4, 0x48, 0xFF, 0xE4, 0x40, 0xFF, 0xC6, 0x79, 0xFF, 0xE4, 0x48, 0xFF, 0x04, 0x41, 0xFF, 0x65, 0x41, 0xFF, 0x03, 0x41, 0xFF, 0xE8, 0x71, 0xFF, 0x67, 0x41, 0xFF, 0x24, 0x39, 0xFF, 0x04, 0x39, 0xFF, 0x24, 0x51, 0xFF, 0x66, 0x59, 0xFF, 0x65, 0x41, 0xFF, 0x1B, 0x4F, 0xFF, 0x44, 0x41, 0xFF, 0x65, 0x49, 0xFF, 0x01, 0x29, 0xFF, 0x43, 0x39, 0xFF, 0x02, 0x29, 0xFF, 0x27, 0x82, 0xFF, 0x63, 0x39, 0xFF, 0xA4, 0x51, 0xFF, 0xC6, 0x61, 0xFF, 0x44, 0x49, 0xFF, 0x02, 0x51, 0xFF, 0x83, 0x69, 0xFF, 0x23, 0x61, 0xFF, 0x43, 0x69, 0xFF, 0x02, 0x71, 0xFF, 0x43, 0x61, 0xFF, 0x63, 0x61, 0xFF, 0x02, 0x69, 0xFF,
-    0xC5, 0xB9, 0xFF, 0x64, 0x91, 0xFF, 0x64, 0x89, 0xFF, 0xE9, 0xBA, 0xFF, 0x63, 0x99, 0xFF, 0x47, 0xA2, 0xFF, 0xA4, 0x89, 0xFF, 0x87, 0xA2, 0xFF, 0xC7, 0xE9, 0xFF, 0xA4, 0x99, 0xFF, 0xA4, 0x81, 0xFF, 0x84, 0x81, 0xFF, 0x43, 0xA1, 0xFF, 0x86, 0xF1, 0xFF, 0xE7, 0xE9, 0xFF, 0xE5, 0xC1, 0xFF, 0xE6, 0x89, 0xFF, 0xE6, 0xA1, 0xFF, 0x47, 0xF1, 0xFF, 0x96, 0xFF, 0xFF, 0xE7, 0xE9, 0xFF, 0x9D, 0xC7, 0xFF, 0x06, 0x92, 0xFF, 0x66, 0xF1, 0xFF, 0x28, 0xF2, 0xFF, 0xA7, 0xE9, 0xFF, 0xC9, 0x92, 0xFF, 0xDB, 0xB6, 0xFF, 0xC7, 0xA9, 0xFF, 0x4A, 0xFA, 0xFF, 0x6C, 0xFC, 0xFF, 0xA7, 0xE1, 0xFF, 0x08, 0x82, 0xFF, 0xE8, 0x81, 0xFF, 0xC8, 0xA1, 0xFF, 0xA9, 0xF9, 0xFF, 0x09, 0xAA, 0xFF, 0x87, 0x69, 0xFF, 0xC8, 0x69, 0xFF, 0x6C, 0x6A, 0xFF, 0xDF, 0x77, 0xFF, 0xC8, 0x79, 0xFF, 0x86, 0x69, 0xFF, 0xFF, 0x87, 0xFF, 0x05, 0x59, 0xFF, 0x45, 0x61, 0xFF, 0x44, 0x61, 0xFF, 0xE3, 0x50, 0xFF, 0xE4, 0x48, 0xFF, 0x25, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0xE4, 0x38, 0xFF, 0x86, 0x49, 0xFF, 0xA7, 0x41, 0xFF, 0x66, 0x39, 0xFF, 0x7F, 0x0D, 0xFF, 0xE4, 0x38, 0xFF, 0x66, 0x49, 0xFF, 0xA6, 0x41, 0xFF, 0x86, 0x49, 0xFF, 0x03, 0x39, 0xFF, 0x7D, 0x57, 0xFF,
-    0x43, 0x31, 0xFF, 0xA3, 0x49, 0xFF, 0x44, 0x6A, 0xFF, 0x61, 0x51, 0xFF, 0x24, 0x4A, 0xFF, 0x63, 0x41, 0xFF, 0x44, 0x49, 0xFF, 0xC8, 0x9A, 0xFF, 0x26, 0xC2, 0xFF, 0x43, 0x61, 0xFF, 0x26, 0x7A, 0xFF, 0x63, 0x51, 0xFF, 0xA8, 0xA2, 0xFF, 0x87, 0xC2, 0xFF, 0x64, 0x61, 0xFF, 0xE2, 0x60, 0xFF, 0x46, 0xA2, 0xFF, 0xC7, 0xA2, 0xFF, 0x02, 0x91, 0xFF, 0x0A, 0xEB, 0xFF, 0x4A, 0x9B, 0xFF, 0xE5, 0x81, 0xFF, 0xA9, 0xDA, 0xFF, 0xC5, 0xB9, 0xFF, 0xF7, 0xFF, 0xFF, 0x84, 0x99, 0xFF, 0x46, 0x92, 0xFF, 0x84, 0x81, 0xFF, 0x84, 0x91, 0xFF, 0xC9, 0xF3, 0xFF, 0x08, 0xFB, 0xFF, 0x85, 0xC9, 0xFF, 0x67, 0x8A, 0xFF, 0xA5, 0x91, 0xFF, 0x25, 0xF9, 0xFF, 0xFD, 0xFF, 0xFF, 0xE7, 0xF1, 0xFF, 0x27, 0x92, 0xFF, 0x07, 0x92, 0xFF, 0x46, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0xFF, 0x89, 0xAA, 0xFF, 0x89, 0x8A, 0xFF, 0x86, 0xC9, 0xFF, 0x49, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0x25, 0xD1, 0xFF, 0xAA, 0x92, 0xFF, 0xE7, 0x81, 0xFF, 0xA8, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xC2, 0xFF, 0x66, 0x79, 0xFF, 0xC7, 0x89, 0xFF, 0x4F, 0x6B, 0xFF, 0xE9, 0xD9, 0xFF, 0x49, 0xDA, 0xFF, 0x66, 0x71, 0xFF, 0xA6, 0x81, 0xFF, 0xC7, 0x71, 0xFF, 0xE8, 0xC9, 0xFF, 0xE8, 0xE9, 0xFF, 0xC6, 0x71, 0xFF,
-    0x48, 0x7A, 0xFF, 0x04, 0x51, 0xFF, 0x24, 0x61, 0xFF, 0x07, 0xB2, 0xFF, 0x66, 0x91, 0xFF, 0x24, 0x51, 0xFF, 0x45, 0x49, 0xFF, 0x4B, 0x4A, 0xFF, 0x8C, 0x82, 0xFF, 0xB1, 0xFB, 0xFF, 0xE4, 0x38, 0xFF, 0x1A, 0x1E, 0xFF, 0x66, 0x41, 0xFF, 0x85, 0x51, 0xFF, 0x08, 0xA2, 0xFF, 0x24, 0x51, 0xFF, 0x22, 0x29, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0x02, 0x39, 0xFF, 0x62, 0x41, 0xFF, 0x42, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0x42, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0x49, 0x8B, 0xFF, 0xE6, 0x71, 0xFF, 0xE1, 0x40, 0xFF, 0x43, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0xC2, 0x68, 0xFF, 0x07, 0xAA, 0xFF, 0x06, 0x8A, 0xFF, 0x09, 0x93, 0xFF, 0x84, 0x71, 0xFF, 0x64, 0x69, 0xFF, 0x64, 0x69, 0xFF, 0xA4, 0x81, 0xFF, 0xC5, 0x79, 0xFF, 0x84, 0x81, 0xFF, 0xE6, 0x89, 0xFF, 0xA5, 0x71, 0xFF, 0x47, 0x92, 0xFF, 0xA4, 0x81, 0xFF, 0x85, 0xB9, 0xFF, 0xA6, 0xC1, 0xFF, 0x28, 0xFA, 0xFF, 0x67, 0x8A, 0xFF, 0xE6, 0x89, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xE9, 0xFF, 0x48, 0xBA, 0xFF, 0x4E, 0xAC, 0xFF, 0xE7, 0x91, 0xFF, 0x49, 0xFA, 0xFF, 0x08, 0xFA, 0xFF, 0xC7, 0xD1, 0xFF, 0x28, 0x92, 0xFF, 0x0A, 0x93, 0xFF, 0xC6, 0xB1, 0xFF, 0x08, 0xDA, 0xFF, 0xF9, 0xDD, 0xFF, 0x8B, 0xFA, 0xFF,
-    0xE8, 0x81, 0xFF, 0x49, 0x92, 0xFF, 0xA7, 0xD1, 0xFF, 0x2C, 0xF5, 0xFF, 0x4E, 0xB3, 0xFF, 0xC8, 0x79, 0xFF, 0x2A, 0x82, 0xFF, 0x88, 0xA9, 0xFF, 0xCD, 0xFD, 0xFF, 0x86, 0x81, 0xFF, 0xE8, 0x99, 0xFF, 0x04, 0x61, 0xFF, 0x05, 0x69, 0xFF, 0x4D, 0xFF, 0xFF, 0xE4, 0x68, 0xFF, 0xA7, 0x61, 0xFF, 0xE4, 0x50, 0xFF, 0x04, 0x51, 0xFF, 0xE7, 0xA1, 0xFF, 0x45, 0x71, 0xFF, 0x25, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0xC7, 0x79, 0xFF, 0x66, 0x51, 0xFF, 0x87, 0x49, 0xFF, 0x6E, 0x33, 0xFF, 0x65, 0x41, 0xFF, 0x85, 0x61, 0xFF, 0xFF, 0x6F, 0xFF, 0x65, 0x49, 0xFF, 0x24, 0x41, 0xFF, 0x42, 0x29, 0xFF, 0xC5, 0x49, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x31, 0xFF, 0xE7, 0x72, 0xFF, 0xC8, 0x62, 0xFF, 0x42, 0x39, 0xFF, 0x43, 0x41, 0xFF, 0x42, 0x31, 0xFF, 0xE3, 0x49, 0xFF, 0xE4, 0x69, 0xFF, 0x43, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0x84, 0x49, 0xFF, 0x82, 0x51, 0xFF, 0xC8, 0xB2, 0xFF, 0x23, 0x71, 0xFF, 0x84, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0xA5, 0x71, 0xFF, 0xA7, 0xBA, 0xFF, 0x64, 0x61, 0xFF, 0x84, 0x69, 0xFF, 0xA5, 0x91, 0xFF, 0x27, 0x92, 0xFF, 0x8F, 0xFE, 0xFF, 0x84, 0x69, 0xFF, 0xE9, 0x92, 0xFF, 0xA5, 0x79, 0xFF, 0x27, 0xC2, 0xFF, 0x94, 0xFE, 0xFF, 0x07, 0xDA, 0xFF,
-    0xC5, 0x79, 0xFF, 0xC5, 0x79, 0xFF, 0x06, 0xBA, 0xFF, 0x29, 0xE3, 0xFF, 0x68, 0x9A, 0xFF, 0xC7, 0x79, 0xFF, 0xE6, 0x81, 0xFF, 0x07, 0xFA, 0xFF, 0xC9, 0xCA, 0xFF, 0xC6, 0x91, 0xFF, 0x07, 0x82, 0xFF, 0xFF, 0x9F, 0xFF, 0x08, 0xC2, 0xFF, 0xA6, 0xA1, 0xFF, 0xA7, 0xA1, 0xFF, 0x8B, 0xFA, 0xFF, 0xC7, 0x81, 0xFF, 0xE7, 0x89, 0xFF, 0xA7, 0xB1, 0xFF, 0x29, 0xCA, 0xFF, 0xC8, 0x89, 0xFF, 0xA7, 0x81, 0xFF, 0x86, 0x79, 0xFF, 0xC9, 0xF1, 0xFF, 0x88, 0xE1, 0xFF, 0x66, 0x81, 0xFF, 0xC3, 0x70, 0xFF, 0x45, 0x71, 0xFF, 0xE4, 0x78, 0xFF, 0xC8, 0xC9, 0xFF, 0x04, 0x79, 0xFF, 0x04, 0x61, 0xFF, 0xE3, 0x58, 0xFF, 0x04, 0x61, 0xFF, 0x29, 0xBA, 0xFF, 0x45, 0x59, 0xFF, 0x25, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0xC8, 0xA1, 0xFF, 0x45, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0x04, 0x41, 0xFF, 0x45, 0x49, 0xFF, 0x09, 0xAA, 0xFF, 0x44, 0x49, 0xFF, 0x86, 0x51, 0xFF, 0x08, 0x3A, 0xFF, 0x42, 0x21, 0xFF, 0xA3, 0x39, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x31, 0xFF, 0xE5, 0x49, 0xFF, 0x43, 0x29, 0xFF, 0xE6, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0x42, 0x31, 0xFF, 0x01, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0xC8, 0x8A, 0xFF, 0x47, 0x72, 0xFF, 0x84, 0x49, 0xFF, 0x63, 0x51, 0xFF, 0xA7, 0x62, 0xFF,
-    0x04, 0x7A, 0xFF, 0x43, 0x49, 0xFF, 0x06, 0x6A, 0xFF, 0x6D, 0x94, 0xFF, 0x26, 0x72, 0xFF, 0x47, 0x72, 0xFF, 0x63, 0x61, 0xFF, 0x46, 0x8A, 0xFF, 0xE6, 0x69, 0xFF, 0x47, 0x92, 0xFF, 0x84, 0x59, 0xFF, 0xE5, 0x79, 0xFF, 0x84, 0x69, 0xFF, 0xC5, 0x81, 0xFF, 0xE6, 0x79, 0xFF, 0x48, 0xDA, 0xFF, 0xC5, 0x79, 0xFF, 0x47, 0x72, 0xFF, 0x27, 0xCA, 0xFF, 0x47, 0xAA, 0xFF, 0x87, 0x82, 0xFF, 0xC6, 0x79, 0xFF, 0xE6, 0x71, 0xFF, 0x86, 0xD9, 0xFF, 0x88, 0xAA, 0xFF, 0xE6, 0x89, 0xFF, 0xE7, 0x79, 0xFF, 0x07, 0x8A, 0xFF, 0x45, 0xA1, 0xFF, 0x68, 0xB2, 0xFF, 0x85, 0x91, 0xFF, 0x6A, 0xEA, 0xFF, 0xA6, 0x81, 0xFF, 0xA6, 0x81, 0xFF, 0x28, 0xBA, 0xFF, 0x28, 0x9A, 0xFF, 0xA3, 0x70, 0xFF, 0xC7, 0x79, 0xFF, 0x45, 0x81, 0xFF, 0x87, 0xD9, 0xFF, 0x66, 0x91, 0xFF, 0xE8, 0x99, 0xFF, 0x45, 0x81, 0xFF, 0x25, 0x79, 0xFF, 0xEE, 0xFE, 0xFF, 0xCB, 0xAA, 0xFF, 0x86, 0x89, 0xFF, 0xE3, 0x60, 0xFF, 0x04, 0x69, 0xFF, 0xCB, 0xFD, 0xFF, 0xE4, 0x58, 0xFF, 0x24, 0x61, 0xFF, 0x45, 0x59, 0xFF, 0x48, 0x8A, 0xFF, 0x28, 0x92, 0xFF, 0x65, 0x51, 0xFF, 0x25, 0x51, 0xFF, 0x65, 0x59, 0xFF, 0x07, 0x8A, 0xFF, 0x03, 0x51, 0xFF, 0x45, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x65, 0x51, 0xFF, 0x04, 0x49, 0xFF,
-    0x42, 0x29, 0xFF, 0x63, 0x29, 0xFF, 0x63, 0x29, 0xFF, 0x62, 0x29, 0xFF, 0xE5, 0x49, 0xFF, 0x42, 0x29, 0xFF, 0x42, 0x31, 0xFF, 0x26, 0x62, 0xFF, 0xC3, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x41, 0xFF, 0x84, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0x62, 0x41, 0xFF, 0xE5, 0x69, 0xFF, 0x05, 0x62, 0xFF, 0x25, 0x5A, 0xFF, 0xA4, 0x51, 0xFF, 0xA4, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0xA7, 0x62, 0xFF, 0x26, 0x62, 0xFF, 0x43, 0x51, 0xFF, 0x06, 0x82, 0xFF, 0x26, 0x72, 0xFF, 0xE5, 0x71, 0xFF, 0xA4, 0x61, 0xFF, 0x64, 0x61, 0xFF, 0x88, 0x7A, 0xFF, 0x88, 0xCA, 0xFF, 0xA5, 0x61, 0xFF, 0x85, 0xA1, 0xFF, 0x46, 0x82, 0xFF, 0x67, 0x72, 0xFF, 0x07, 0xCA, 0xFF, 0x84, 0x71, 0xFF, 0x67, 0x7A, 0xFF, 0xA5, 0x71, 0xFF, 0xA5, 0x69, 0xFF, 0x07, 0xEA, 0xFF, 0x2A, 0x8B, 0xFF, 0x64, 0x69, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x79, 0xFF, 0x48, 0xBA, 0xFF, 0x27, 0xB2, 0xFF, 0xC6, 0xC1, 0xFF, 0x49, 0xD2, 0xFF, 0x6F, 0xB4, 0xFF, 0xA6, 0x89, 0xFF, 0x66, 0x91, 0xFF, 0xA7, 0xB1, 0xFF, 0x0C, 0xA3, 0xFF, 0x25, 0x79, 0xFF, 0x25, 0x81, 0xFF, 0x25, 0xA9, 0xFF, 0xC7, 0xA1, 0xFF, 0x46, 0x81, 0xFF, 0x24, 0x81, 0xFF, 0xC7, 0xA1, 0xFF, 0x6A, 0x82, 0xFF, 0xE4, 0x78, 0xFF, 0x24, 0x79, 0xFF, 0x03, 0x71, 0xFF,
-    0xEC, 0xA2, 0xFF, 0xE4, 0x60, 0xFF, 0x24, 0x61, 0xFF, 0x25, 0x69, 0xFF, 0xC7, 0x79, 0xFF, 0x04, 0x59, 0xFF, 0x86, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x86, 0x69, 0xFF, 0x24, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x65, 0x59, 0xFF, 0x65, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x42, 0x21, 0xFF, 0x43, 0x29, 0xFF, 0x86, 0x4A, 0xFF, 0x62, 0x21, 0xFF, 0x62, 0x39, 0xFF, 0x83, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0x42, 0x39, 0xFF, 0xA8, 0x5B, 0xFF, 0x27, 0x4B, 0xFF, 0x22, 0x31, 0xFF, 0xC4, 0x51, 0xFF, 0xA3, 0x51, 0xFF, 0x89, 0x83, 0xFF, 0xC4, 0x59, 0xFF, 0x67, 0x82, 0xFF, 0xA3, 0x41, 0xFF, 0xA6, 0x5A, 0xFF, 0x42, 0x49, 0xFF, 0xE4, 0x61, 0xFF, 0x63, 0x41, 0xFF, 0x67, 0x62, 0xFF, 0x05, 0x5A, 0xFF, 0x88, 0xA2, 0xFF, 0x49, 0xAB, 0xFF, 0x06, 0x82, 0xFF, 0x69, 0x7B, 0xFF, 0xA4, 0x61, 0xFF, 0x84, 0x51, 0xFF, 0x2B, 0xDB, 0xFF, 0xC5, 0x69, 0xFF, 0x84, 0x71, 0xFF, 0x05, 0x6A, 0xFF, 0xA5, 0x59, 0xFF, 0xA5, 0x99, 0xFF, 0x88, 0xFA, 0xFF, 0x88, 0x7A, 0xFF, 0xC5, 0x71, 0xFF, 0xE6, 0x61, 0xFF, 0x45, 0xB9, 0xFF, 0xA8, 0xBA, 0xFF, 0x85, 0x71, 0xFF, 0xC6, 0x69, 0xFF, 0xC6, 0x71, 0xFF, 0xA5, 0xB1, 0xFF, 0x49, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD1, 0xFF,
-    0x27, 0x8A, 0xFF, 0x66, 0x91, 0xFF, 0x87, 0x99, 0xFF, 0xFE, 0xFF, 0xFF, 0x26, 0xD1, 0xFF, 0x86, 0x91, 0xFF, 0x4A, 0xB2, 0xFF, 0x87, 0xB1, 0xFF, 0x67, 0xF1, 0xFF, 0xF3, 0xFF, 0xFF, 0x45, 0x91, 0xFF, 0xC9, 0x79, 0xFF, 0x88, 0x91, 0xFF, 0x05, 0xA1, 0xFF, 0xE8, 0xF9, 0xFF, 0xA8, 0x99, 0xFF, 0xE3, 0x68, 0xFF, 0x25, 0x61, 0xFF, 0x86, 0x69, 0xFF, 0x66, 0x89, 0xFF, 0x29, 0xDA, 0xFF, 0x45, 0x59, 0xFF, 0x2A, 0x42, 0xFF, 0xE8, 0x61, 0xFF, 0xA6, 0x69, 0xFF, 0x07, 0xC2, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x07, 0xA2, 0xFF, 0x86, 0x81, 0xFF, 0x83, 0x29, 0xFF, 0x22, 0x21, 0xFF, 0x64, 0x3A, 0xFF, 0x08, 0x53, 0xFF, 0x83, 0x39, 0xFF, 0x85, 0x42, 0xFF, 0xA3, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0xAA, 0xA3, 0xFF, 0xE6, 0x4A, 0xFF, 0x83, 0x29, 0xFF, 0xC4, 0x41, 0xFF, 0x84, 0x49, 0xFF, 0xEB, 0x94, 0xFF, 0x68, 0x6B, 0xFF, 0xA4, 0x51, 0xFF, 0x63, 0x31, 0xFF, 0xA4, 0x41, 0xFF, 0xE7, 0x62, 0xFF, 0x89, 0xAB, 0xFF, 0xA7, 0x6A, 0xFF, 0x83, 0x49, 0xFF, 0x87, 0x6A, 0xFF, 0x46, 0x7A, 0xFF, 0x6A, 0xA3, 0xFF, 0xA9, 0x8A, 0xFF, 0x63, 0x59, 0xFF, 0x46, 0x7A, 0xFF, 0xC5, 0x59, 0xFF, 0x46, 0x92, 0xFF, 0xC4, 0x61, 0xFF, 0x87, 0x82, 0xFF,
-    0xE5, 0x71, 0xFF, 0x06, 0x62, 0xFF, 0x84, 0x71, 0xFF, 0xC9, 0x9A, 0xFF, 0x67, 0x62, 0xFF, 0xC5, 0x69, 0xFF, 0xC6, 0x59, 0xFF, 0x85, 0xA1, 0xFF, 0x6A, 0xCB, 0xFF, 0xC6, 0x81, 0xFF, 0xE6, 0x69, 0xFF, 0x48, 0x7A, 0xFF, 0x28, 0xC2, 0xFF, 0xE7, 0xC9, 0xFF, 0x69, 0xFA, 0xFF, 0x69, 0xE2, 0xFF, 0x86, 0x81, 0xFF, 0x07, 0xA2, 0xFF, 0x67, 0xE9, 0xFF, 0x8B, 0xF4, 0xFF, 0x09, 0xC2, 0xFF, 0x2D, 0xAB, 0xFF, 0x87, 0x99, 0xFF, 0x0B, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0xB9, 0xFF, 0xE8, 0xA9, 0xFF, 0xFE, 0xB6, 0xFF, 0xA9, 0xC9, 0xFF, 0x90, 0xFD, 0xFF, 0x8B, 0xFA, 0xFF, 0x45, 0x99, 0xFF, 0x05, 0x71, 0xFF, 0x05, 0x71, 0xFF, 0xE8, 0x91, 0xFF, 0x46, 0xC1, 0xFF, 0x45, 0x61, 0xFF, 0xB4, 0x4A, 0xFF, 0xE8, 0x61, 0xFF, 0xC8, 0x99, 0xFF, 0x29, 0x5A, 0xFF, 0x7A, 0x54, 0xFF, 0x86, 0x59, 0xFF, 0x65, 0x51, 0xFF, 0xC6, 0x71, 0xFF, 0x65, 0x61, 0xFF, 0x65, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0xA3, 0x29, 0xFF, 0x42, 0x21, 0xFF, 0xC4, 0x29, 0xFF, 0x63, 0x21, 0xFF, 0xC6, 0x5A, 0xFF, 0x45, 0x42, 0xFF, 0x05, 0x4A, 0xFF, 0x24, 0x42, 0xFF, 0x63, 0x29, 0xFF, 0x64, 0x42, 0xFF, 0x48, 0x63, 0xFF, 0x65, 0x4A, 0xFF, 0xA3, 0x39, 0xFF, 0xA3, 0x39, 0xFF, 0x04, 0x52, 0xFF, 0x48, 0x73, 0xFF,
-    0x62, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0xE4, 0x41, 0xFF, 0x66, 0x62, 0xFF, 0x08, 0x73, 0xFF, 0x26, 0x52, 0xFF, 0x28, 0x53, 0xFF, 0xA4, 0x59, 0xFF, 0x05, 0x62, 0xFF, 0xE7, 0x82, 0xFF, 0xC4, 0x51, 0xFF, 0x88, 0x8A, 0xFF, 0xA5, 0x51, 0xFF, 0x46, 0x7A, 0xFF, 0xE7, 0x8A, 0xFF, 0xC5, 0x69, 0xFF, 0x26, 0x72, 0xFF, 0x05, 0x52, 0xFF, 0xA5, 0x79, 0xFF, 0xE8, 0x9A, 0xFF, 0xC8, 0x8A, 0xFF, 0xE5, 0x69, 0xFF, 0xC5, 0x59, 0xFF, 0xE6, 0x91, 0xFF, 0xE9, 0x9A, 0xFF, 0x47, 0x92, 0xFF, 0xA5, 0x59, 0xFF, 0xCE, 0x93, 0xFF, 0xEB, 0xC2, 0xFF, 0x89, 0xB2, 0xFF, 0x28, 0x9A, 0xFF, 0x08, 0xCA, 0xFF, 0x28, 0x82, 0xFF, 0x0C, 0x73, 0xFF, 0x2A, 0xFA, 0xFF, 0x2D, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x92, 0xFF, 0xD0, 0xAB, 0xFF, 0xD1, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xE9, 0xC9, 0xFF, 0x46, 0xA1, 0xFF, 0xA9, 0xB1, 0xFF, 0x2B, 0xFA, 0xFF, 0xFD, 0xFF, 0xFF, 0xC5, 0xD0, 0xFF, 0xA7, 0xA1, 0xFF, 0x05, 0x89, 0xFF, 0x4A, 0xFA, 0xFF, 0xE9, 0xF9, 0xFF, 0x46, 0x91, 0xFF, 0x86, 0x71, 0xFF, 0x87, 0x71, 0xFF, 0xE8, 0x89, 0xFF, 0x37, 0xFD, 0xFF, 0xC8, 0x79, 0xFF, 0x08, 0x5A, 0xFF, 0xA7, 0x61, 0xFF, 0x5D, 0x75, 0xFF, 0xC7, 0xC1, 0xFF, 0x49, 0x7A, 0xFF, 0x08, 0x5A, 0xFF, 0xC6, 0x71, 0xFF,
-    0x83, 0x21, 0xFF, 0x47, 0x43, 0xFF, 0x83, 0x19, 0xFF, 0xA3, 0x29, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x21, 0xFF, 0x85, 0x42, 0xFF, 0x83, 0x29, 0xFF, 0xA6, 0x3A, 0xFF, 0xC4, 0x29, 0xFF, 0xE4, 0x41, 0xFF, 0xA9, 0x63, 0xFF, 0x65, 0x52, 0xFF, 0x83, 0x31, 0xFF, 0xC4, 0x41, 0xFF, 0x83, 0x41, 0xFF, 0x27, 0x63, 0xFF, 0xC4, 0x41, 0xFF, 0xA4, 0x39, 0xFF, 0x87, 0x62, 0xFF, 0x28, 0x53, 0xFF, 0x28, 0x6B, 0xFF, 0x25, 0x4A, 0xFF, 0x05, 0x5A, 0xFF, 0xE4, 0x49, 0xFF, 0x26, 0x52, 0xFF, 0x29, 0x63, 0xFF, 0x26, 0x62, 0xFF, 0xC8, 0x5A, 0xFF, 0xE5, 0x51, 0xFF, 0xA7, 0x4A, 0xFF, 0x83, 0x51, 0xFF, 0xC8, 0x92, 0xFF, 0x67, 0x52, 0xFF, 0x63, 0x51, 0xFF, 0xE5, 0x69, 0xFF, 0xA8, 0x6A, 0xFF, 0xE6, 0x69, 0xFF, 0xE5, 0x51, 0xFF, 0xA5, 0x79, 0xFF, 0x09, 0x83, 0xFF, 0x43, 0x51, 0xFF, 0x07, 0x5A, 0xFF, 0x8D, 0x83, 0xFF, 0xC6, 0x89, 0xFF, 0xCA, 0xA2, 0xFF, 0xB6, 0x9D, 0xFF, 0x89, 0xAA, 0xFF, 0xEB, 0x82, 0xFF, 0xDF, 0xE7, 0xFF, 0x69, 0xBA, 0xFF, 0xA7, 0x89, 0xFF, 0xCB, 0x8A, 0xFF, 0x09, 0x8A, 0xFF, 0x87, 0x91, 0xFF, 0xC8, 0xF9, 0xFF, 0x8B, 0xE2, 0xFF, 0x4B, 0x8A, 0xFF, 0xE9, 0xB9, 0xFF, 0x27, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0xC9, 0xFF, 0xA9, 0xF9, 0xFF, 0x46, 0xB9, 0xFF,
-    0xAB, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x25, 0x89, 0xFF, 0x67, 0xC1, 0xFF, 0x05, 0x81, 0xFF, 0x08, 0xC2, 0xFF, 0xA6, 0x79, 0xFF, 0x09, 0x7A, 0xFF, 0x86, 0x71, 0xFF, 0xE7, 0x69, 0xFF, 0x09, 0xDA, 0xFF, 0xA6, 0x61, 0xFF, 0xE7, 0x61, 0xFF, 0xC7, 0x71, 0xFF, 0x85, 0x61, 0xFF, 0xA6, 0x71, 0xFF, 0x83, 0x19, 0xFF, 0xA3, 0x29, 0xFF, 0x63, 0x19, 0xFF, 0x04, 0x2A, 0xFF, 0x62, 0x29, 0xFF, 0xE4, 0x29, 0xFF, 0xE9, 0x82, 0xFF, 0xA3, 0x29, 0xFF, 0x0A, 0x64, 0xFF, 0x08, 0x43, 0xFF, 0x05, 0x42, 0xFF, 0xC4, 0x39, 0xFF, 0xA2, 0x31, 0xFF, 0x68, 0x4B, 0xFF, 0x04, 0x42, 0xFF, 0xA3, 0x41, 0xFF, 0xA3, 0x29, 0xFF, 0x88, 0x53, 0xFF, 0xC4, 0x41, 0xFF, 0x05, 0x4A, 0xFF, 0xE4, 0x39, 0xFF, 0x28, 0x53, 0xFF, 0xC4, 0x41, 0xFF, 0x05, 0x52, 0xFF, 0xE4, 0x49, 0xFF, 0xC7, 0x52, 0xFF, 0x28, 0x73, 0xFF, 0xE5, 0x49, 0xFF, 0xC4, 0x41, 0xFF, 0x26, 0x52, 0xFF, 0xAD, 0x54, 0xFF, 0x67, 0x72, 0xFF, 0xC5, 0x59, 0xFF, 0x67, 0x62, 0xFF, 0x07, 0x62, 0xFF, 0xE5, 0x59, 0xFF, 0xA8, 0x62, 0xFF, 0xC6, 0x59, 0xFF, 0xE5, 0x51, 0xFF, 0xE6, 0x89, 0xFF, 0x09, 0x73, 0xFF, 0x47, 0x62, 0xFF, 0x06, 0x52, 0xFF, 0xAA, 0x5A, 0xFF, 0x07, 0x8A, 0xFF, 0x88, 0x8A, 0xFF, 0x27, 0x7A, 0xFF, 0xA6, 0x89, 0xFF,
-    0x89, 0x82, 0xFF, 0xA6, 0x69, 0xFF, 0xC7, 0x71, 0xFF, 0x45, 0x69, 0xFF, 0xC7, 0x79, 0xFF, 0xD0, 0x93, 0xFF, 0x69, 0xAA, 0xFF, 0x66, 0x99, 0xFF, 0x8B, 0xD2, 0xFF, 0xA7, 0x89, 0xFF, 0x46, 0x91, 0xFF, 0x08, 0xDA, 0xFF, 0x26, 0xC1, 0xFF, 0x46, 0x99, 0xFF, 0x45, 0xA9, 0xFF, 0x8C, 0xFA, 0xFF, 0x05, 0xD9, 0xFF, 0x25, 0x99, 0xFF, 0x65, 0x81, 0xFF, 0xE4, 0x98, 0xFF, 0x73, 0xF7, 0xFF, 0x45, 0x81, 0xFF, 0x08, 0x6A, 0xFF, 0x86, 0x71, 0xFF, 0x25, 0x79, 0xFF, 0x29, 0xA2, 0xFF, 0x66, 0x61, 0xFF, 0xA7, 0x69, 0xFF, 0xA7, 0x69, 0xFF, 0x86, 0x71, 0xFF, 0xC6, 0x81, 0xFF, 0xE8, 0x89, 0xFF, 0x22, 0x19, 0xFF, 0xC4, 0x31, 0xFF, 0x63, 0x19, 0xFF, 0xA3, 0x31, 0xFF, 0xA3, 0x29, 0xFF, 0x83, 0x21, 0xFF, 0x83, 0x39, 0xFF, 0xA3, 0x29, 0xFF, 0x25, 0x4A, 0xFF, 0xC4, 0x21, 0xFF, 0xE4, 0x31, 0xFF, 0x86, 0x3A, 0xFF, 0xC3, 0x31, 0xFF, 0x70, 0x85, 0xFF, 0x47, 0x4B, 0xFF, 0xE4, 0x41, 0xFF, 0xC4, 0x29, 0xFF, 0x04, 0x3A, 0xFF, 0x68, 0x53, 0xFF, 0xE4, 0x41, 0xFF, 0x05, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x45, 0x6A, 0xFF, 0x25, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x05, 0x4A, 0xFF, 0x66, 0x52, 0xFF, 0xE5, 0x41, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x5A, 0xFF, 0x46, 0x62, 0xFF,
-    0xC5, 0x59, 0xFF, 0x8B, 0x7B, 0xFF, 0xC4, 0x59, 0xFF, 0x26, 0x6A, 0xFF, 0x2A, 0x6B, 0xFF, 0x26, 0x72, 0xFF, 0x26, 0x4A, 0xFF, 0x84, 0x61, 0xFF, 0xC9, 0x62, 0xFF, 0xC5, 0x51, 0xFF, 0x27, 0x4A, 0xFF, 0xEE, 0x83, 0xFF, 0x68, 0x92, 0xFF, 0x88, 0x6A, 0xFF, 0x89, 0x6A, 0xFF, 0xA5, 0x71, 0xFF, 0xA5, 0x59, 0xFF, 0x48, 0x9A, 0xFF, 0xA6, 0x69, 0xFF, 0x4A, 0x7A, 0xFF, 0xFE, 0xAE, 0xFF, 0x69, 0x82, 0xFF, 0x86, 0x79, 0xFF, 0x2A, 0x92, 0xFF, 0xA7, 0xA1, 0xFF, 0x86, 0x81, 0xFF, 0x28, 0xB2, 0xFF, 0x45, 0x89, 0xFF, 0x66, 0x91, 0xFF, 0x25, 0x99, 0xFF, 0xC8, 0xB9, 0xFF, 0x46, 0xA1, 0xFF, 0x04, 0x89, 0xFF, 0x66, 0x89, 0xFF, 0xA8, 0x99, 0xFF, 0xE8, 0xF1, 0xFF, 0x87, 0xA1, 0xFF, 0x66, 0x79, 0xFF, 0xC7, 0x69, 0xFF, 0x29, 0xBA, 0xFF, 0x66, 0x79, 0xFF, 0x86, 0x71, 0xFF, 0x86, 0x59, 0xFF, 0x5A, 0x75, 0xFF, 0xE8, 0x81, 0xFF, 0x85, 0x79, 0xFF, 0x89, 0x7A, 0xFF, 0xA6, 0x81, 0xFF, 0x83, 0x19, 0xFF, 0xE4, 0x29, 0xFF, 0xC8, 0x4B, 0xFF, 0xC6, 0x42, 0xFF, 0xE3, 0x21, 0xFF, 0xCE, 0x74, 0xFF, 0xE4, 0x29, 0xFF, 0xE4, 0x29, 0xFF, 0x87, 0x4B, 0xFF, 0xE3, 0x21, 0xFF, 0x08, 0x4B, 0xFF, 0xC6, 0x3A, 0xFF, 0x27, 0x3B, 0xFF, 0x09, 0x64, 0xFF, 0xA2, 0x21, 0xFF, 0x48, 0x5B, 0xFF,
-    0x86, 0x3A, 0xFF, 0xE4, 0x31, 0xFF, 0xE4, 0x41, 0xFF, 0xA9, 0x6B, 0xFF, 0xC3, 0x31, 0xFF, 0xE4, 0x31, 0xFF, 0xA6, 0x3A, 0xFF, 0x04, 0x4A, 0xFF, 0x88, 0x73, 0xFF, 0xC7, 0x4A, 0xFF, 0x66, 0x4A, 0xFF, 0x25, 0x52, 0xFF, 0x89, 0x53, 0xFF, 0x87, 0x52, 0xFF, 0x6A, 0x83, 0xFF, 0x05, 0x4A, 0xFF, 0xC5, 0x49, 0xFF, 0x47, 0x52, 0xFF, 0xE9, 0x92, 0xFF, 0x08, 0x8B, 0xFF, 0xC9, 0x6A, 0xFF, 0x87, 0x6A, 0xFF, 0x06, 0x42, 0xFF, 0xA4, 0x61, 0xFF, 0x6B, 0x83, 0xFF, 0xA4, 0x49, 0xFF, 0x68, 0x4A, 0xFF, 0xFF, 0x77, 0xFF, 0x4C, 0xB3, 0xFF, 0x4B, 0x7B, 0xFF, 0x09, 0xB3, 0xFF, 0x6C, 0x83, 0xFF, 0x0A, 0x5B, 0xFF, 0xFF, 0xDF, 0xFF, 0x29, 0x6A, 0xFF, 0xC9, 0xD2, 0xFF, 0x35, 0x53, 0xFF, 0x69, 0x92, 0xFF, 0xA9, 0x8A, 0xFF, 0x24, 0x89, 0xFF, 0x8A, 0xF2, 0xFF, 0x69, 0xDA, 0xFF, 0x86, 0x81, 0xFF, 0x65, 0x89, 0xFF, 0xC7, 0xA1, 0xFF, 0x8A, 0xFA, 0xFF, 0x08, 0xFA, 0xFF, 0x6B, 0xD2, 0xFF, 0x46, 0x99, 0xFF, 0x6B, 0xCA, 0xFF, 0xC7, 0xA1, 0xFF, 0x0E, 0xFC, 0xFF, 0x25, 0x89, 0xFF, 0x87, 0x81, 0xFF, 0x45, 0x79, 0xFF, 0x45, 0x81, 0xFF, 0x45, 0x91, 0xFF, 0x27, 0xBA, 0xFF, 0x45, 0x71, 0xFF, 0xE3, 0x60, 0xFF, 0x04, 0x59, 0xFF, 0x66, 0x69, 0xFF, 0xE6, 0x99, 0xFF, 0x61, 0x58, 0xFF,
-    0x03, 0x1A, 0xFF, 0x25, 0x32, 0xFF, 0xA3, 0x19, 0xFF, 0xE3, 0x21, 0xFF, 0x2A, 0x4C, 0xFF, 0x88, 0x43, 0xFF, 0xE3, 0x21, 0xFF, 0xE3, 0x21, 0xFF, 0x85, 0x3A, 0xFF, 0x03, 0x1A, 0xFF, 0xA9, 0x53, 0xFF, 0x24, 0x2A, 0xFF, 0xAB, 0x44, 0xFF, 0x45, 0x32, 0xFF, 0x04, 0x22, 0xFF, 0xE9, 0x53, 0xFF, 0x29, 0x44, 0xFF, 0xA9, 0x43, 0xFF, 0x25, 0x3A, 0xFF, 0x25, 0x42, 0xFF, 0xA9, 0x63, 0xFF, 0xE4, 0x31, 0xFF, 0x05, 0x3A, 0xFF, 0x25, 0x3A, 0xFF, 0x69, 0x63, 0xFF, 0x88, 0x6B, 0xFF, 0x05, 0x3A, 0xFF, 0x4B, 0x5C, 0xFF, 0x49, 0x5B, 0xFF, 0x66, 0x4A, 0xFF, 0x48, 0x6B, 0xFF, 0x05, 0x42, 0xFF, 0xA8, 0x62, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0xC8, 0x6A, 0xFF, 0x09, 0x63, 0xFF, 0x05, 0x4A, 0xFF, 0x27, 0x42, 0xFF, 0x47, 0x5A, 0xFF, 0x6B, 0x63, 0xFF, 0xE6, 0x51, 0xFF, 0x68, 0x42, 0xFF, 0xB5, 0x5D, 0xFF, 0x4B, 0x93, 0xFF, 0x0C, 0x84, 0xFF, 0x48, 0x7A, 0xFF, 0x47, 0x6A, 0xFF, 0x6B, 0x73, 0xFF, 0x23, 0x41, 0xFF, 0xC6, 0x61, 0xFF, 0x48, 0x92, 0xFF, 0x88, 0x7A, 0xFF, 0x89, 0x82, 0xFF, 0x86, 0x69, 0xFF, 0x49, 0xA2, 0xFF, 0x8A, 0xFC, 0xFF, 0xC7, 0x81, 0xFF, 0x45, 0x79, 0xFF, 0xC8, 0xA1, 0xFF, 0x2A, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0xC9, 0xFF, 0xC7, 0xB9, 0xFF,
-    0xC9, 0xD9, 0xFF, 0x48, 0xF9, 0xFF, 0xA9, 0xF9, 0xFF, 0x25, 0x99, 0xFF, 0xC9, 0xE9, 0xFF, 0x86, 0x99, 0xFF, 0xC7, 0x79, 0xFF, 0xE7, 0xC9, 0xFF, 0xE3, 0x70, 0xFF, 0x04, 0x81, 0xFF, 0x04, 0x61, 0xFF, 0x86, 0x71, 0xFF, 0xE7, 0xA9, 0xFF, 0x65, 0x79, 0xFF, 0xA7, 0x79, 0xFF, 0x24, 0x69, 0xFF, 0xC3, 0x19, 0xFF, 0xE3, 0x21, 0xFF, 0xA9, 0x3B, 0xFF, 0xE4, 0x21, 0xFF, 0xE3, 0x19, 0xFF, 0x85, 0x2A, 0xFF, 0x2A, 0x44, 0xFF, 0xCA, 0x5B, 0xFF, 0xA6, 0x32, 0xFF, 0x04, 0x22, 0xFF, 0x23, 0x22, 0xFF, 0x49, 0x4C, 0xFF, 0x45, 0x2A, 0xFF, 0x47, 0x3B, 0xFF, 0xC6, 0x32, 0xFF, 0xE3, 0x31, 0xFF, 0x29, 0x54, 0xFF, 0x2A, 0x44, 0xFF, 0xE7, 0x42, 0xFF, 0x86, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0xC9, 0x5B, 0xFF, 0x25, 0x32, 0xFF, 0x25, 0x3A, 0xFF, 0x0B, 0x64, 0xFF, 0xEA, 0x4B, 0xFF, 0x69, 0x5B, 0xFF, 0xC6, 0x32, 0xFF, 0x46, 0x42, 0xFF, 0x46, 0x42, 0xFF, 0x66, 0x4A, 0xFF, 0xCE, 0x74, 0xFF, 0x09, 0x6B, 0xFF, 0x66, 0x4A, 0xFF, 0x8B, 0x6B, 0xFF, 0xC8, 0x62, 0xFF, 0x67, 0x4A, 0xFF, 0x27, 0x62, 0xFF, 0x47, 0x3A, 0xFF, 0x06, 0x42, 0xFF, 0x0D, 0x5C, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x42, 0xFF, 0xED, 0x63, 0xFF, 0xC5, 0x69, 0xFF, 0xC9, 0x82, 0xFF, 0xE7, 0x59, 0xFF, 0xC6, 0x61, 0xFF,
-    0x07, 0x62, 0xFF, 0xE6, 0x61, 0xFF, 0xA9, 0x9A, 0xFF, 0xA6, 0x81, 0xFF, 0xE2, 0x48, 0xFF, 0x85, 0x69, 0xFF, 0xE7, 0x81, 0xFF, 0x85, 0xA1, 0xFF, 0xA6, 0x89, 0xFF, 0x45, 0x71, 0xFF, 0xA6, 0x91, 0xFF, 0x09, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0xB8, 0xFF, 0x26, 0xC1, 0xFF, 0x48, 0xE9, 0xFF, 0x8F, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF, 0x06, 0xB1, 0xFF, 0x68, 0xD1, 0xFF, 0x68, 0xF1, 0xFF, 0x0B, 0xFA, 0xFF, 0x86, 0x91, 0xFF, 0x46, 0x99, 0xFF, 0x24, 0x81, 0xFF, 0x86, 0x71, 0xFF, 0xA8, 0xD9, 0xFF, 0x61, 0x58, 0xFF, 0xA6, 0x79, 0xFF, 0x45, 0x79, 0xFF, 0xE7, 0x89, 0xFF, 0x04, 0x79, 0xFF, 0xE4, 0x19, 0xFF, 0xDC, 0x3F, 0xFF, 0x04, 0x1A, 0xFF, 0xE3, 0x09, 0xFF, 0x6A, 0x34, 0xFF, 0x04, 0x22, 0xFF, 0xE3, 0x19, 0xFF, 0xE7, 0x4A, 0xFF, 0xA4, 0x1A, 0xFF, 0x65, 0x22, 0xFF, 0x44, 0x22, 0xFF, 0x6B, 0x4C, 0xFF, 0x65, 0x2A, 0xFF, 0x09, 0x44, 0xFF, 0xE3, 0x21, 0xFF, 0x07, 0x53, 0xFF, 0xE6, 0x32, 0xFF, 0x2B, 0x54, 0xFF, 0xF2, 0x76, 0xFF, 0xA5, 0x2A, 0xFF, 0xA6, 0x3A, 0xFF, 0x65, 0x2A, 0xFF, 0x6B, 0x5C, 0xFF, 0x25, 0x3A, 0xFF, 0x65, 0x3A, 0xFF, 0xFE, 0x77, 0xFF, 0x48, 0x5B, 0xFF, 0x07, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x42, 0xFF, 0x66, 0x42, 0xFF, 0x29, 0x5B, 0xFF,
-    0x86, 0x4A, 0xFF, 0x0C, 0x64, 0xFF, 0xFF, 0x9F, 0xFF, 0xE8, 0x4A, 0xFF, 0xA8, 0x4A, 0xFF, 0x6A, 0x6B, 0xFF, 0xE9, 0x42, 0xFF, 0x88, 0x4A, 0xFF, 0xD6, 0x6D, 0xFF, 0x26, 0x52, 0xFF, 0xE9, 0x4A, 0xFF, 0x78, 0x87, 0xFF, 0x67, 0x62, 0xFF, 0xA8, 0x7A, 0xFF, 0xE7, 0x61, 0xFF, 0x67, 0x62, 0xFF, 0x44, 0x49, 0xFF, 0x50, 0x8C, 0xFF, 0x69, 0x82, 0xFF, 0xC6, 0x69, 0xFF, 0x43, 0x61, 0xFF, 0x85, 0x69, 0xFF, 0x48, 0x9A, 0xFF, 0xA6, 0x91, 0xFF, 0x65, 0x79, 0xFF, 0xA6, 0x79, 0xFF, 0xE7, 0x99, 0xFF, 0x2A, 0xD2, 0xFF, 0xE8, 0xC1, 0xFF, 0x04, 0x91, 0xFF, 0x25, 0xC9, 0xFF, 0x73, 0xFD, 0xFF, 0x08, 0xF1, 0xFF, 0x67, 0xC9, 0xFF, 0x48, 0xE9, 0xFF, 0x8B, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0xB9, 0xFF, 0x46, 0x89, 0xFF, 0x46, 0xB9, 0xFF, 0x67, 0xD1, 0xFF, 0x25, 0x89, 0xFF, 0x85, 0x71, 0xFF, 0x44, 0x79, 0xFF, 0xA6, 0x89, 0xFF, 0x46, 0x99, 0xFF, 0xC8, 0xB9, 0xFF, 0x65, 0xA1, 0xFF, 0x86, 0x22, 0xFF, 0x04, 0x22, 0xFF, 0xA6, 0x1A, 0xFF, 0x24, 0x1A, 0xFF, 0xE4, 0x19, 0xFF, 0xEA, 0x3C, 0xFF, 0xC6, 0x2A, 0xFF, 0x65, 0x2A, 0xFF, 0x24, 0x1A, 0xFF, 0xA9, 0x3B, 0xFF, 0x28, 0x24, 0xFF, 0x44, 0x22, 0xFF, 0xC6, 0x32, 0xFF, 0x23, 0x12, 0xFF, 0x09, 0x44, 0xFF, 0xA5, 0x32, 0xFF,
-    0xC4, 0x02, 0xFF, 0x06, 0x2B, 0xFF, 0xAC, 0x64, 0xFF, 0x27, 0x33, 0xFF, 0x85, 0x22, 0xFF, 0x85, 0x2A, 0xFF, 0xC6, 0x32, 0xFF, 0x69, 0x53, 0xFF, 0x86, 0x3A, 0xFF, 0x0B, 0x64, 0xFF, 0x89, 0x5B, 0xFF, 0xE7, 0x3A, 0xFF, 0xAA, 0x4B, 0xFF, 0xE8, 0x42, 0xFF, 0x08, 0x43, 0xFF, 0xA6, 0x42, 0xFF, 0x08, 0x53, 0xFF, 0xFB, 0x87, 0xFF, 0xCF, 0x54, 0xFF, 0xA7, 0x4A, 0xFF, 0xA7, 0x4A, 0xFF, 0x09, 0x63, 0xFF, 0xE9, 0x42, 0xFF, 0x67, 0x42, 0xFF, 0xD0, 0x54, 0xFF, 0xE5, 0x39, 0xFF, 0xCA, 0x42, 0xFF, 0x4F, 0x64, 0xFF, 0x48, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x52, 0xFF, 0x06, 0x62, 0xFF, 0x64, 0x41, 0xFF, 0x48, 0x7A, 0xFF, 0x07, 0x7A, 0xFF, 0x64, 0x59, 0xFF, 0x02, 0x49, 0xFF, 0xCA, 0x8A, 0xFF, 0x85, 0x61, 0xFF, 0xA6, 0x79, 0xFF, 0x85, 0x79, 0xFF, 0xAA, 0xA2, 0xFF, 0x4D, 0xCB, 0xFF, 0xA6, 0x81, 0xFF, 0x65, 0x79, 0xFF, 0x24, 0x91, 0xFF, 0xA9, 0xE1, 0xFF, 0x66, 0xC1, 0xFF, 0x26, 0xB1, 0xFF, 0xE5, 0xD8, 0xFF, 0x28, 0xE9, 0xFF, 0x69, 0xF1, 0xFF, 0x87, 0xC1, 0xFF, 0x67, 0xD1, 0xFF, 0x87, 0xC1, 0xFF, 0x25, 0xC1, 0xFF, 0x46, 0x89, 0xFF, 0x87, 0x89, 0xFF, 0x86, 0x99, 0xFF, 0xE4, 0xA8, 0xFF, 0xC8, 0xB9, 0xFF, 0x25, 0x89, 0xFF, 0x45, 0x89, 0xFF, 0x48, 0xF2, 0xFF,
-    0x86, 0x1A, 0xFF, 0x04, 0x22, 0xFF, 0xE6, 0x1A, 0xFF, 0x86, 0x22, 0xFF, 0x85, 0x12, 0xFF, 0x67, 0x13, 0xFF, 0x67, 0x23, 0xFF, 0x85, 0x0B, 0xFF, 0x36, 0x57, 0xFF, 0x85, 0x1A, 0xFF, 0xA9, 0x43, 0xFF, 0x45, 0x1B, 0xFF, 0xEC, 0x4C, 0xFF, 0x84, 0x22, 0xFF, 0xC5, 0x2A, 0xFF, 0x85, 0x2A, 0xFF, 0xEB, 0x44, 0xFF, 0x26, 0x2B, 0xFF, 0x08, 0x34, 0xFF, 0xC5, 0x32, 0xFF, 0xE9, 0x43, 0xFF, 0xFF, 0xF7, 0xFF, 0x88, 0x3B, 0xFF, 0xA6, 0x32, 0xFF, 0x03, 0x1A, 0xFF, 0x07, 0x3B, 0xFF, 0xA6, 0x42, 0xFF, 0x2A, 0x34, 0xFF, 0x4B, 0x4C, 0xFF, 0x08, 0x3B, 0xFF, 0xA6, 0x42, 0xFF, 0xC6, 0x32, 0xFF, 0x08, 0x53, 0xFF, 0x49, 0x4B, 0xFF, 0x29, 0x63, 0xFF, 0x45, 0x42, 0xFF, 0xAB, 0x63, 0xFF, 0xE5, 0x51, 0xFF, 0xE9, 0x42, 0xFF, 0x66, 0x42, 0xFF, 0x51, 0x6D, 0xFF, 0x64, 0x31, 0xFF, 0xA9, 0x3A, 0xFF, 0x4B, 0x5B, 0xFF, 0xA8, 0x7A, 0xFF, 0xE6, 0x41, 0xFF, 0xC5, 0x49, 0xFF, 0x84, 0x51, 0xFF, 0x88, 0x62, 0xFF, 0xC5, 0x49, 0xFF, 0xA5, 0x51, 0xFF, 0xA5, 0x61, 0xFF, 0x69, 0x82, 0xFF, 0x85, 0x61, 0xFF, 0x65, 0x59, 0xFF, 0xC6, 0x71, 0xFF, 0x89, 0x9A, 0xFF, 0x64, 0x71, 0xFF, 0x04, 0x69, 0xFF, 0x08, 0x8A, 0xFF, 0x86, 0x91, 0xFF, 0x86, 0x99, 0xFF, 0x89, 0xD2, 0xFF, 0x46, 0x99, 0xFF,
-    0xC9, 0xC1, 0xFF, 0x66, 0xA9, 0xFF, 0x67, 0xB1, 0xFF, 0xED, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xA8, 0xB9, 0xFF, 0x66, 0x89, 0xFF, 0x46, 0x91, 0xFF, 0x66, 0x91, 0xFF, 0x67, 0xC2, 0xFF, 0x66, 0x89, 0xFF, 0x25, 0x81, 0xFF, 0xC7, 0x89, 0xFF, 0xA7, 0x99, 0xFF, 0x67, 0xAA, 0xFF, 0x65, 0x89, 0xFF, 0x06, 0x13, 0xFF, 0x7D, 0x57, 0xFF, 0xE6, 0x1A, 0xFF, 0x69, 0x3C, 0xFF, 0xFE, 0x4F, 0xFF, 0x8A, 0x35, 0xFF, 0xA7, 0x23, 0xFF, 0x67, 0x2B, 0xFF, 0x51, 0x4F, 0xFF, 0x25, 0x1B, 0xFF, 0x4B, 0x2D, 0xFF, 0x87, 0x1B, 0xFF, 0xE7, 0x1B, 0xFF, 0x25, 0x13, 0xFF, 0xCB, 0x4C, 0xFF, 0x66, 0x2B, 0xFF, 0x68, 0x2B, 0xFF, 0x2C, 0x45, 0xFF, 0x87, 0x2B, 0xFF, 0xAA, 0x4C, 0xFF, 0xCB, 0x54, 0xFF, 0x8B, 0x44, 0xFF, 0x4D, 0x3D, 0xFF, 0xC5, 0x1A, 0xFF, 0xC5, 0x22, 0xFF, 0x4A, 0x5C, 0xFF, 0x07, 0x3B, 0xFF, 0xCC, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x34, 0xFF, 0x6C, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x4A, 0xFF, 0x49, 0x43, 0xFF, 0x94, 0x5E, 0xFF, 0xEB, 0x6B, 0xFF, 0x08, 0x3B, 0xFF, 0xC5, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xC9, 0x42, 0xFF, 0x2C, 0x6C, 0xFF, 0xA5, 0x39, 0xFF, 0xA8, 0x3A, 0xFF, 0x68, 0x4A, 0xFF, 0x88, 0x72, 0xFF, 0x06, 0x52, 0xFF, 0x0A, 0x9B, 0xFF, 0x26, 0x62, 0xFF,
-    0x07, 0x52, 0xFF, 0x06, 0x52, 0xFF, 0x8C, 0xA3, 0xFF, 0x2A, 0xA3, 0xFF, 0x24, 0x49, 0xFF, 0x64, 0x59, 0xFF, 0x65, 0x51, 0xFF, 0x27, 0x82, 0xFF, 0xE9, 0xB2, 0xFF, 0x64, 0x59, 0xFF, 0xE3, 0x60, 0xFF, 0x65, 0x81, 0xFF, 0xA6, 0x91, 0xFF, 0x89, 0xD2, 0xFF, 0x66, 0xA1, 0xFF, 0x65, 0x99, 0xFF, 0x66, 0x91, 0xFF, 0x66, 0x99, 0xFF, 0x28, 0xF2, 0xFF, 0x09, 0xD2, 0xFF, 0x66, 0x99, 0xFF, 0x87, 0x91, 0xFF, 0x6B, 0xFB, 0xFF, 0x28, 0xCA, 0xFF, 0x45, 0x89, 0xFF, 0xA7, 0x89, 0xFF, 0xC7, 0x91, 0xFF, 0x66, 0x89, 0xFF, 0x07, 0xB2, 0xFF, 0xA6, 0x89, 0xFF, 0xA7, 0x91, 0xFF, 0x65, 0x81, 0xFF, 0x44, 0x12, 0xFF, 0x67, 0x23, 0xFF, 0xAA, 0x3C, 0xFF, 0xA5, 0x1A, 0xFF, 0x47, 0x2B, 0xFF, 0x66, 0x13, 0xFF, 0xA6, 0x1B, 0xFF, 0x0A, 0x35, 0xFF, 0xDA, 0x67, 0xFF, 0xE8, 0x2B, 0xFF, 0x46, 0x13, 0xFF, 0x8C, 0x3D, 0xFF, 0x6E, 0x2E, 0xFF, 0x49, 0x2C, 0xFF, 0x10, 0x66, 0xFF, 0x8B, 0x44, 0xFF, 0x6B, 0x3D, 0xFF, 0x90, 0x5E, 0xFF, 0xA7, 0x2B, 0xFF, 0xCA, 0x24, 0xFF, 0xC9, 0x43, 0xFF, 0xCB, 0x4C, 0xFF, 0x67, 0x23, 0xFF, 0x88, 0x33, 0xFF, 0xC6, 0x22, 0xFF, 0xA6, 0x2A, 0xFF, 0x85, 0x32, 0xFF, 0xE7, 0x3A, 0xFF, 0xEA, 0x3B, 0xFF, 0x68, 0x33, 0xFF, 0x89, 0x4B, 0xFF, 0xEB, 0x53, 0xFF,
-    0x86, 0x3A, 0xFF, 0xE8, 0x42, 0xFF, 0x08, 0x5B, 0xFF, 0x86, 0x42, 0xFF, 0x86, 0x3A, 0xFF, 0xE5, 0x49, 0xFF, 0xE9, 0x3A, 0xFF, 0x66, 0x3A, 0xFF, 0x4A, 0x5B, 0xFF, 0xC5, 0x41, 0xFF, 0x27, 0x3A, 0xFF, 0xC9, 0x52, 0xFF, 0xC5, 0x49, 0xFF, 0x29, 0x83, 0xFF, 0xC5, 0x59, 0xFF, 0x06, 0x5A, 0xFF, 0xE6, 0x49, 0xFF, 0x47, 0x5A, 0xFF, 0xC9, 0x92, 0xFF, 0xA4, 0x61, 0xFF, 0x23, 0x41, 0xFF, 0xA6, 0x61, 0xFF, 0xA9, 0x92, 0xFF, 0xE5, 0x79, 0xFF, 0xA5, 0x69, 0xFF, 0x49, 0x8A, 0xFF, 0x03, 0x59, 0xFF, 0x85, 0x81, 0xFF, 0xAA, 0xCA, 0xFF, 0xE7, 0x99, 0xFF, 0xC6, 0x81, 0xFF, 0xA6, 0x99, 0xFF, 0x0A, 0xE2, 0xFF, 0xC6, 0xB1, 0xFF, 0x66, 0x99, 0xFF, 0xA7, 0xA9, 0xFF, 0xD2, 0xEC, 0xFF, 0x0A, 0xEA, 0xFF, 0x88, 0xB9, 0xFF, 0xA7, 0x91, 0xFF, 0x25, 0x81, 0xFF, 0x86, 0x89, 0xFF, 0x87, 0xC1, 0xFF, 0x86, 0x89, 0xFF, 0x86, 0x89, 0xFF, 0x86, 0x89, 0xFF, 0xC7, 0xA1, 0xFF, 0xA6, 0x91, 0xFF, 0xC5, 0x1A, 0xFF, 0x06, 0x1B, 0xFF, 0x6B, 0x34, 0xFF, 0x8C, 0x2D, 0xFF, 0xDD, 0x9F, 0xFF, 0x48, 0x14, 0xFF, 0xCA, 0x14, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xC7, 0xFF, 0x6B, 0x3D, 0xFF, 0x51, 0x2F, 0xFF, 0xE7, 0x1B, 0xFF, 0xA6, 0x0B, 0xFF, 0xCA, 0x34, 0xFF, 0xCD, 0x4D, 0xFF, 0x87, 0x1B, 0xFF,
-    0x28, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0x97, 0xFF, 0x89, 0x24, 0xFF, 0x2B, 0x35, 0xFF, 0xDE, 0xB7, 0xFF, 0xEC, 0x44, 0xFF, 0x6B, 0x44, 0xFF, 0x6B, 0x34, 0xFF, 0x88, 0x2B, 0xFF, 0x07, 0x33, 0xFF, 0xEA, 0x43, 0xFF, 0xE7, 0x2A, 0xFF, 0xE7, 0x32, 0xFF, 0x2B, 0x4C, 0xFF, 0xE7, 0x42, 0xFF, 0xA6, 0x32, 0xFF, 0x66, 0x32, 0xFF, 0x45, 0x32, 0xFF, 0xC3, 0x31, 0xFF, 0x08, 0x53, 0xFF, 0xA3, 0x39, 0xFF, 0xA8, 0x3A, 0xFF, 0x83, 0x29, 0xFF, 0xCC, 0x63, 0xFF, 0x63, 0x31, 0xFF, 0x26, 0x3A, 0xFF, 0x88, 0x4A, 0xFF, 0x46, 0x52, 0xFF, 0x2A, 0x73, 0xFF, 0xE5, 0x49, 0xFF, 0x84, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0xA8, 0x72, 0xFF, 0xA5, 0x51, 0xFF, 0x44, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0xEA, 0x92, 0xFF, 0x4C, 0xAB, 0xFF, 0xA5, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0x85, 0x69, 0xFF, 0x69, 0xA2, 0xFF, 0x65, 0x69, 0xFF, 0x65, 0x69, 0xFF, 0xA6, 0x81, 0xFF, 0x8A, 0xCA, 0xFF, 0x25, 0x89, 0xFF, 0x45, 0x89, 0xFF, 0x69, 0xE1, 0xFF, 0x50, 0xEB, 0xFF, 0x4D, 0xF1, 0xFF, 0x68, 0xD1, 0xFF, 0x89, 0xD9, 0xFF, 0x8A, 0xE9, 0xFF, 0x2C, 0xFB, 0xFF, 0x06, 0xA1, 0xFF, 0xA8, 0xB1, 0xFF, 0xA8, 0xB1, 0xFF, 0x46, 0xA1, 0xFF, 0x0A, 0xFA, 0xFF, 0xA7, 0x99, 0xFF, 0xA8, 0xA9, 0xFF, 0x8A, 0xE9, 0xFF,
-    0xC5, 0x0A, 0xFF, 0x8D, 0x0C, 0xFF, 0x6C, 0x0E, 0xFF, 0xCB, 0x0C, 0xFF, 0xF8, 0x1F, 0xFF, 0xAA, 0x24, 0xFF, 0x28, 0x04, 0xFF, 0xFF, 0x5F, 0xFF, 0x69, 0x0D, 0xFF, 0xE9, 0x24, 0xFF, 0xEA, 0x1C, 0xFF, 0xFF, 0x67, 0xFF, 0x48, 0x14, 0xFF, 0xCF, 0x4D, 0xFF, 0x89, 0x2C, 0xFF, 0x28, 0x1C, 0xFF, 0x28, 0x1C, 0xFF, 0x08, 0x1C, 0xFF, 0xE7, 0x1B, 0xFF, 0xEC, 0x3C, 0xFF, 0x6A, 0x34, 0xFF, 0x0C, 0x1D, 0xFF, 0x8E, 0x2D, 0xFF, 0xEC, 0x44, 0xFF, 0x0D, 0x55, 0xFF, 0xFF, 0xEF, 0xFF, 0x27, 0x33, 0xFF, 0x69, 0x43, 0xFF, 0xCA, 0x4B, 0xFF, 0xED, 0x44, 0xFF, 0xC6, 0x32, 0xFF, 0xE7, 0x3A, 0xFF, 0xC7, 0x42, 0xFF, 0x04, 0x2A, 0xFF, 0x25, 0x2A, 0xFF, 0xA3, 0x21, 0xFF, 0xE8, 0x4A, 0xFF, 0x83, 0x29, 0xFF, 0xA8, 0x42, 0xFF, 0x83, 0x29, 0xFF, 0xEC, 0x53, 0xFF, 0x63, 0x29, 0xFF, 0xE6, 0x39, 0xFF, 0xC9, 0x52, 0xFF, 0xC4, 0x39, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x42, 0xFF, 0xCC, 0x7B, 0xFF, 0xC9, 0x6A, 0xFF, 0x27, 0x52, 0xFF, 0x88, 0x62, 0xFF, 0x06, 0x52, 0xFF, 0x89, 0x7A, 0xFF, 0xC6, 0x61, 0xFF, 0x84, 0x49, 0xFF, 0xE6, 0x79, 0xFF, 0x89, 0x9A, 0xFF, 0x65, 0x69, 0xFF, 0x24, 0x51, 0xFF, 0x44, 0x61, 0xFF, 0x6A, 0xBA, 0xFF, 0x66, 0x99, 0xFF, 0x66, 0x99, 0xFF, 0x45, 0x91, 0xFF,
-    0x2E, 0xFD, 0xFF, 0x88, 0xC9, 0xFF, 0x49, 0xF1, 0xFF, 0xD1, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xE2, 0xFF, 0x48, 0xD9, 0xFF, 0x68, 0xC9, 0xFF, 0x48, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0xE1, 0xFF, 0xC8, 0xB9, 0xFF, 0xA7, 0x99, 0xFF, 0xED, 0xFB, 0xFF, 0xC8, 0xA1, 0xFF, 0x87, 0xA1, 0xFF, 0x84, 0x0A, 0xFF, 0x05, 0x1B, 0xFF, 0xC7, 0x1B, 0xFF, 0x07, 0x1C, 0xFF, 0x85, 0x0B, 0xFF, 0xD2, 0x16, 0xFF, 0x9B, 0x3F, 0xFF, 0x51, 0x27, 0xFF, 0x30, 0x17, 0xFF, 0x0C, 0x26, 0xFF, 0xDE, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x17, 0xFF, 0x0A, 0x25, 0xFF, 0x47, 0x04, 0xFF, 0x07, 0x0C, 0xFF, 0x2A, 0x1D, 0xFF, 0x27, 0x0C, 0xFF, 0xCD, 0x35, 0xFF, 0x4A, 0x3C, 0xFF, 0xE8, 0x23, 0xFF, 0x0D, 0x4D, 0xFF, 0x29, 0x34, 0xFF, 0xA9, 0x33, 0xFF, 0x2A, 0x3C, 0xFF, 0x26, 0x23, 0xFF, 0x48, 0x43, 0xFF, 0xE6, 0x32, 0xFF, 0xE7, 0x32, 0xFF, 0x2C, 0x54, 0xFF, 0xC7, 0x3A, 0xFF, 0xE7, 0x3A, 0xFF, 0xE7, 0x3A, 0xFF, 0xC3, 0x21, 0xFF, 0x24, 0x32, 0xFF, 0x25, 0x32, 0xFF, 0xCA, 0x53, 0xFF, 0xE4, 0x39, 0xFF, 0x67, 0x3A, 0xFF, 0x25, 0x32, 0xFF, 0x4B, 0x5B, 0xFF, 0xA4, 0x29, 0xFF, 0xE5, 0x39, 0xFF, 0xE5, 0x39, 0xFF, 0x06, 0x52, 0xFF, 0xE5, 0x41, 0xFF, 0x48, 0x82, 0xFF, 0xC4, 0x49, 0xFF,
-    0xC5, 0x49, 0xFF, 0xE5, 0x49, 0xFF, 0xA9, 0x7A, 0xFF, 0x27, 0x62, 0xFF, 0x43, 0x49, 0xFF, 0xC5, 0x61, 0xFF, 0xAA, 0x82, 0xFF, 0xA6, 0x81, 0xFF, 0x44, 0x51, 0xFF, 0xA6, 0x61, 0xFF, 0xC2, 0x60, 0xFF, 0x08, 0x92, 0xFF, 0x65, 0x81, 0xFF, 0x2A, 0xDA, 0xFF, 0x0B, 0xCA, 0xFF, 0x45, 0x91, 0xFF, 0x26, 0xB1, 0xFF, 0x4B, 0xE9, 0xFF, 0xDE, 0xFF, 0xFF, 0x6B, 0xE9, 0xFF, 0x88, 0xC1, 0xFF, 0x6D, 0xFA, 0xFF, 0xBF, 0xFF, 0xFF, 0x88, 0xB1, 0xFF, 0xA8, 0xB1, 0xFF, 0xA8, 0xB1, 0xFF, 0xE9, 0xA9, 0xFF, 0xA7, 0x91, 0xFF, 0xE8, 0xA1, 0xFF, 0xA7, 0x91, 0xFF, 0xE8, 0xA1, 0xFF, 0xC6, 0x91, 0xFF, 0x06, 0x13, 0xFF, 0x84, 0x0A, 0xFF, 0x25, 0x13, 0xFF, 0xCD, 0x4D, 0xFF, 0xAA, 0x2C, 0xFF, 0x48, 0x14, 0xFF, 0x2F, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0x8D, 0x36, 0xFF, 0xFE, 0xA7, 0xFF, 0xFC, 0x3F, 0xFF, 0x30, 0x37, 0xFF, 0xF5, 0x47, 0xFF, 0xFE, 0xB7, 0xFF, 0x2D, 0x36, 0xFF, 0x09, 0x15, 0xFF, 0x90, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x15, 0xFF, 0x0D, 0x46, 0xFF, 0xEC, 0x25, 0xFF, 0x2A, 0x34, 0xFF, 0xE5, 0x12, 0xFF, 0xEE, 0x35, 0xFF, 0x6D, 0x35, 0xFF, 0x4C, 0x55, 0xFF, 0xC7, 0x23, 0xFF, 0x6B, 0x44, 0xFF, 0xE7, 0x2A, 0xFF, 0x86, 0x32, 0xFF, 0xCB, 0x54, 0xFF, 0x65, 0x22, 0xFF,
-    0xCA, 0x5B, 0xFF, 0x25, 0x2A, 0xFF, 0x69, 0x43, 0xFF, 0x2A, 0x5C, 0xFF, 0xC7, 0x42, 0xFF, 0x05, 0x3A, 0xFF, 0xE6, 0x31, 0xFF, 0xA4, 0x31, 0xFF, 0x4C, 0x74, 0xFF, 0x63, 0x29, 0xFF, 0x84, 0x31, 0xFF, 0xA4, 0x31, 0xFF, 0x46, 0x6A, 0xFF, 0xE5, 0x39, 0xFF, 0x89, 0x7B, 0xFF, 0x84, 0x51, 0xFF, 0xA5, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0xA8, 0x72, 0xFF, 0x69, 0x93, 0xFF, 0x64, 0x49, 0xFF, 0x89, 0x82, 0xFF, 0xA5, 0x59, 0xFF, 0xE4, 0x51, 0xFF, 0x8B, 0xC3, 0xFF, 0xC4, 0x69, 0xFF, 0x44, 0x59, 0xFF, 0x86, 0x71, 0xFF, 0xA6, 0x89, 0xFF, 0x29, 0xB3, 0xFF, 0x09, 0xB3, 0xFF, 0x44, 0x79, 0xFF, 0x86, 0x91, 0xFF, 0x66, 0x91, 0xFF, 0xC9, 0xD2, 0xFF, 0xA9, 0xCA, 0xFF, 0x44, 0x79, 0xFF, 0xC7, 0x99, 0xFF, 0xE8, 0xA1, 0xFF, 0xA5, 0x91, 0xFF, 0x66, 0xA1, 0xFF, 0xA9, 0xB2, 0xFF, 0xC7, 0x91, 0xFF, 0xA7, 0x91, 0xFF, 0x67, 0xA2, 0xFF, 0x86, 0x81, 0xFF, 0x47, 0x92, 0xFF, 0xC6, 0x89, 0xFF, 0x2A, 0x2C, 0xFF, 0xE5, 0x12, 0xFF, 0xD3, 0x66, 0xFF, 0xC8, 0x1B, 0xFF, 0x4A, 0x15, 0xFF, 0xF0, 0x46, 0xFF, 0x0C, 0x1E, 0xFF, 0xAE, 0x2E, 0xFF, 0x8D, 0x1E, 0xFF, 0xCA, 0x15, 0xFF, 0x4C, 0x0E, 0xFF, 0xCB, 0x15, 0xFF, 0x6F, 0x1F, 0xFF, 0xB6, 0x4F, 0xFF, 0xEB, 0x34, 0xFF, 0x87, 0x04, 0xFF,
-    0x11, 0x3F, 0xFF, 0x6F, 0x36, 0xFF, 0x0B, 0x25, 0xFF, 0xE8, 0x1B, 0xFF, 0xA7, 0x23, 0xFF, 0x2C, 0x45, 0xFF, 0x8A, 0x3C, 0xFF, 0x46, 0x13, 0xFF, 0xC6, 0x22, 0xFF, 0x06, 0x2B, 0xFF, 0x2A, 0x4C, 0xFF, 0xC8, 0x33, 0xFF, 0xAA, 0x33, 0xFF, 0x28, 0x33, 0xFF, 0x27, 0x33, 0xFF, 0x2B, 0x5C, 0xFF, 0x45, 0x2A, 0xFF, 0xC7, 0x3A, 0xFF, 0xCA, 0x4B, 0xFF, 0x86, 0x3A, 0xFF, 0x0B, 0x74, 0xFF, 0x66, 0x3A, 0xFF, 0x47, 0x32, 0xFF, 0x05, 0x32, 0xFF, 0x09, 0x4B, 0xFF, 0xC4, 0x29, 0xFF, 0x06, 0x3A, 0xFF, 0x83, 0x29, 0xFF, 0x25, 0x3A, 0xFF, 0xC7, 0x62, 0xFF, 0x26, 0x4A, 0xFF, 0x86, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0xE5, 0x49, 0xFF, 0xC8, 0x72, 0xFF, 0x47, 0x62, 0xFF, 0xA4, 0x51, 0xFF, 0xC5, 0x51, 0xFF, 0xC8, 0x7A, 0xFF, 0xE4, 0x59, 0xFF, 0x85, 0x59, 0xFF, 0x85, 0x59, 0xFF, 0xA6, 0x69, 0xFF, 0xA8, 0x9A, 0xFF, 0xA6, 0x79, 0xFF, 0xA5, 0x71, 0xFF, 0x85, 0x79, 0xFF, 0x23, 0x79, 0xFF, 0x86, 0xA9, 0xFF, 0x45, 0x81, 0xFF, 0xC8, 0xA9, 0xFF, 0xC7, 0x91, 0xFF, 0x8B, 0xEA, 0xFF, 0x6A, 0xDA, 0xFF, 0x86, 0x81, 0xFF, 0x24, 0x79, 0xFF, 0x29, 0xC2, 0xFF, 0x04, 0x81, 0xFF, 0x8F, 0xEB, 0xFF, 0xC7, 0x89, 0xFF, 0xE8, 0xA1, 0xFF, 0x86, 0x91, 0xFF, 0xE7, 0xA1, 0xFF, 0xC7, 0x89, 0xFF,
-    0xAE, 0x16, 0xFF, 0x89, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x05, 0xFF, 0x97, 0x57, 0xFF, 0x29, 0x05, 0xFF, 0xF6, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x07, 0xFF, 0xF5, 0x27, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x16, 0xFF, 0x4A, 0x1D, 0xFF, 0xEA, 0x24, 0xFF, 0x88, 0x1C, 0xFF, 0xA9, 0x1C, 0xFF, 0x27, 0x13, 0xFF, 0x69, 0x34, 0xFF, 0x28, 0x1C, 0xFF, 0x4C, 0x3D, 0xFF, 0xC8, 0x2B, 0xFF, 0x47, 0x23, 0xFF, 0x6E, 0x5D, 0xFF, 0x6A, 0x3C, 0xFF, 0x47, 0x33, 0xFF, 0x88, 0x3B, 0xFF, 0xC5, 0x22, 0xFF, 0x4B, 0x54, 0xFF, 0xA6, 0x2A, 0xFF, 0xC7, 0x32, 0xFF, 0xE6, 0x32, 0xFF, 0xAA, 0x53, 0xFF, 0x45, 0x32, 0xFF, 0x68, 0x3B, 0xFF, 0xA6, 0x3A, 0xFF, 0x08, 0x53, 0xFF, 0x46, 0x3A, 0xFF, 0x26, 0x32, 0xFF, 0x05, 0x32, 0xFF, 0xC8, 0x4A, 0xFF, 0xC4, 0x29, 0xFF, 0x06, 0x3A, 0xFF, 0x83, 0x29, 0xFF, 0x45, 0x42, 0xFF, 0x05, 0x42, 0xFF, 0x67, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x09, 0x6B, 0xFF, 0xC5, 0x51, 0xFF, 0xE5, 0x49, 0xFF, 0x46, 0x5A, 0xFF, 0xE6, 0x61, 0xFF, 0xA5, 0x59, 0xFF, 0x64, 0x49, 0xFF, 0xE6, 0x61, 0xFF, 0x48, 0x92, 0xFF, 0xCA, 0x9A, 0xFF, 0xC6, 0x71, 0xFF, 0x07, 0x8A, 0xFF, 0x8A, 0xBA, 0xFF, 0x6A, 0xC2, 0xFF, 0x65, 0x69, 0xFF, 0x45, 0x81, 0xFF,
-    0x0A, 0xDA, 0xFF, 0x4C, 0xFA, 0xFF, 0x4B, 0xF1, 0xFF, 0x6E, 0xF1, 0xFF, 0x30, 0xDB, 0xFF, 0x0C, 0xF2, 0xFF, 0x4C, 0xDA, 0xFF, 0x06, 0x89, 0xFF, 0xC8, 0xA9, 0xFF, 0xAE, 0xE1, 0xFF, 0x09, 0xB2, 0xFF, 0xE8, 0x99, 0xFF, 0xC7, 0x89, 0xFF, 0x08, 0xA2, 0xFF, 0xE7, 0x91, 0xFF, 0xC6, 0x89, 0xFF, 0x88, 0x23, 0xFF, 0x66, 0x13, 0xFF, 0xEC, 0x3C, 0xFF, 0x0B, 0x2D, 0xFF, 0x29, 0x1D, 0xFF, 0xE8, 0x04, 0xFF, 0x74, 0x2F, 0xFF, 0x50, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x0E, 0xFF, 0xB2, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xAB, 0x1D, 0xFF, 0x0A, 0x25, 0xFF, 0xEE, 0x35, 0xFF, 0xAA, 0x1C, 0xFF, 0x87, 0x1B, 0xFF, 0x69, 0x2C, 0xFF, 0x89, 0x24, 0xFF, 0xAA, 0x2C, 0xFF, 0x09, 0x3C, 0xFF, 0x6A, 0x34, 0xFF, 0x09, 0x34, 0xFF, 0x68, 0x23, 0xFF, 0x0A, 0x34, 0xFF, 0xAB, 0x44, 0xFF, 0x88, 0x3B, 0xFF, 0x48, 0x3B, 0xFF, 0x85, 0x22, 0xFF, 0xEA, 0x43, 0xFF, 0xE7, 0x32, 0xFF, 0x85, 0x2A, 0xFF, 0xCB, 0x5B, 0xFF, 0xE7, 0x3A, 0xFF, 0x04, 0x22, 0xFF, 0xC7, 0x42, 0xFF, 0x08, 0x4B, 0xFF, 0x67, 0x32, 0xFF, 0x05, 0x2A, 0xFF, 0x88, 0x4A, 0xFF, 0xA3, 0x29, 0xFF, 0x26, 0x3A, 0xFF, 0x63, 0x21, 0xFF, 0x45, 0x4A, 0xFF, 0x05, 0x42, 0xFF, 0x46, 0x4A, 0xFF, 0xEB, 0x7B, 0xFF,
-    0x84, 0x39, 0xFF, 0xE4, 0x31, 0xFF, 0xA6, 0x59, 0xFF, 0x47, 0x62, 0xFF, 0xE5, 0x51, 0xFF, 0x28, 0x82, 0xFF, 0xB7, 0xFD, 0xFF, 0x27, 0x9A, 0xFF, 0x28, 0x92, 0xFF, 0xAD, 0xD2, 0xFF, 0x45, 0x81, 0xFF, 0x6B, 0xE9, 0xFF, 0x57, 0xFC, 0xFF, 0x70, 0xEB, 0xFF, 0x45, 0x81, 0xFF, 0x0A, 0xDA, 0xFF, 0x73, 0xF3, 0xFF, 0x70, 0xF9, 0xFF, 0xA9, 0xC9, 0xFF, 0xA9, 0xE1, 0xFF, 0x9B, 0xE5, 0xFF, 0x37, 0xED, 0xFF, 0x2E, 0xFA, 0xFF, 0x8E, 0xF1, 0xFF, 0xC9, 0xC9, 0xFF, 0x46, 0x89, 0xFF, 0xC8, 0x91, 0xFF, 0x29, 0x9A, 0xFF, 0xE8, 0x91, 0xFF, 0xE7, 0x91, 0xFF, 0x87, 0x99, 0xFF, 0x07, 0x8A, 0xFF, 0x85, 0x1A, 0xFF, 0xA6, 0x1A, 0xFF, 0x47, 0x23, 0xFF, 0x47, 0x1B, 0xFF, 0x46, 0x13, 0xFF, 0x08, 0x1C, 0xFF, 0x49, 0x24, 0xFF, 0xE7, 0x1B, 0xFF, 0xE6, 0x0B, 0xFF, 0x0B, 0x2D, 0xFF, 0x2B, 0x3D, 0xFF, 0xC9, 0x14, 0xFF, 0xE9, 0x14, 0xFF, 0xCA, 0x24, 0xFF, 0x28, 0x1C, 0xFF, 0xA9, 0x24, 0xFF, 0xE8, 0x1B, 0xFF, 0xE9, 0x23, 0xFF, 0xA7, 0x2B, 0xFF, 0xAA, 0x34, 0xFF, 0xAB, 0x54, 0xFF, 0xE8, 0x2B, 0xFF, 0xA7, 0x2B, 0xFF, 0x8B, 0x44, 0xFF, 0x68, 0x2B, 0xFF, 0x67, 0x2B, 0xFF, 0x67, 0x23, 0xFF, 0x06, 0x23, 0xFF, 0xCA, 0x3B, 0xFF, 0xC6, 0x2A, 0xFF, 0xC6, 0x2A, 0xFF, 0x49, 0x3B, 0xFF,
-    0x84, 0x1A, 0xFF, 0xA6, 0x3A, 0xFF, 0x48, 0x43, 0xFF, 0xA6, 0x32, 0xFF, 0xE7, 0x42, 0xFF, 0x08, 0x53, 0xFF, 0x46, 0x32, 0xFF, 0x66, 0x32, 0xFF, 0xEA, 0x52, 0xFF, 0xC4, 0x29, 0xFF, 0x26, 0x3A, 0xFF, 0x63, 0x29, 0xFF, 0xA6, 0x52, 0xFF, 0x05, 0x42, 0xFF, 0x26, 0x4A, 0xFF, 0x25, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0xE5, 0x49, 0xFF, 0x47, 0x5A, 0xFF, 0x47, 0x62, 0xFF, 0xC5, 0x51, 0xFF, 0x06, 0x5A, 0xFF, 0xE5, 0x61, 0xFF, 0x07, 0x6A, 0xFF, 0x06, 0x6A, 0xFF, 0xA5, 0x69, 0xFF, 0x85, 0x79, 0xFF, 0xE6, 0x89, 0xFF, 0xC6, 0x71, 0xFF, 0x85, 0x59, 0xFF, 0x65, 0x69, 0xFF, 0xC6, 0x89, 0xFF, 0xC7, 0x89, 0xFF, 0xA6, 0x79, 0xFF, 0xC7, 0x79, 0xFF, 0x86, 0x71, 0xFF, 0xC7, 0x81, 0xFF, 0x65, 0x69, 0xFF, 0xA6, 0x71, 0xFF, 0xC7, 0x81, 0xFF, 0x24, 0x69, 0xFF, 0xC7, 0x81, 0xFF, 0xC7, 0x81, 0xFF, 0xE7, 0x81, 0xFF, 0xE7, 0x81, 0xFF, 0xE7, 0x89, 0xFF, 0xE6, 0x79, 0xFF, 0x85, 0x1A, 0xFF, 0xC6, 0x1A, 0xFF, 0xE5, 0x12, 0xFF, 0x05, 0x0B, 0xFF, 0x26, 0x1B, 0xFF, 0x2C, 0x45, 0xFF, 0x08, 0x1C, 0xFF, 0xC7, 0x1B, 0xFF, 0x88, 0x14, 0xFF, 0xE9, 0x14, 0xFF, 0x2A, 0x25, 0xFF, 0x8B, 0x1D, 0xFF, 0x8D, 0x26, 0xFF, 0xCB, 0x25, 0xFF, 0x93, 0x47, 0xFF, 0x69, 0x15, 0xFF,
-    0x0B, 0x1E, 0xFF, 0xA9, 0x1C, 0xFF, 0x08, 0x24, 0xFF, 0xCA, 0x34, 0xFF, 0xCE, 0x26, 0xFF, 0x68, 0x1C, 0xFF, 0x0C, 0x3D, 0xFF, 0x29, 0x34, 0xFF, 0xE8, 0x2B, 0xFF, 0x8F, 0x46, 0xFF, 0x09, 0x3C, 0xFF, 0x47, 0x2B, 0xFF, 0x88, 0x3B, 0xFF, 0xE6, 0x2A, 0xFF, 0x69, 0x34, 0xFF, 0x69, 0x43, 0xFF, 0xE6, 0x32, 0xFF, 0xC7, 0x32, 0xFF, 0xC6, 0x32, 0xFF, 0x07, 0x33, 0xFF, 0xE7, 0x42, 0xFF, 0x86, 0x32, 0xFF, 0x67, 0x32, 0xFF, 0x47, 0x32, 0xFF, 0x66, 0x3A, 0xFF, 0xE4, 0x21, 0xFF, 0x46, 0x42, 0xFF, 0x63, 0x21, 0xFF, 0x25, 0x3A, 0xFF, 0x25, 0x3A, 0xFF, 0xC7, 0x4A, 0xFF, 0xA7, 0x52, 0xFF, 0x05, 0x42, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0x2A, 0x74, 0xFF, 0xE5, 0x51, 0xFF, 0x06, 0x5A, 0xFF, 0xE6, 0x59, 0xFF, 0x68, 0x82, 0xFF, 0xAA, 0x93, 0xFF, 0xC5, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0xC6, 0x71, 0xFF, 0xC6, 0x71, 0xFF, 0xA5, 0x79, 0xFF, 0x89, 0x93, 0xFF, 0x85, 0x61, 0xFF, 0x84, 0x69, 0xFF, 0x65, 0x61, 0xFF, 0xAC, 0xAB, 0xFF, 0x89, 0x8B, 0xFF, 0xA5, 0x69, 0xFF, 0x86, 0x81, 0xFF, 0x44, 0x69, 0xFF, 0x64, 0x59, 0xFF, 0x8C, 0xDB, 0xFF, 0x48, 0x9B, 0xFF, 0xC6, 0x81, 0xFF, 0xC7, 0x81, 0xFF, 0xA8, 0x82, 0xFF, 0xE6, 0x71, 0xFF, 0x28, 0x8B, 0xFF, 0x06, 0x7A, 0xFF,
-    0xAA, 0x2C, 0xFF, 0xAB, 0x15, 0xFF, 0xEC, 0x1D, 0xFF, 0xCC, 0x25, 0xFF, 0x2C, 0x2E, 0xFF, 0x50, 0x47, 0xFF, 0xDE, 0xAF, 0xFF, 0xBC, 0x87, 0xFF, 0xD5, 0x37, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x87, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x27, 0xFF, 0x99, 0x77, 0xFF, 0x10, 0x27, 0xFF, 0xF6, 0x47, 0xFF, 0x49, 0x15, 0xFF, 0x6C, 0x35, 0xFF, 0x0A, 0x2D, 0xFF, 0xE9, 0x24, 0xFF, 0x2B, 0x35, 0xFF, 0x0C, 0x3D, 0xFF, 0xAB, 0x3C, 0xFF, 0x49, 0x34, 0xFF, 0x0C, 0x55, 0xFF, 0x0D, 0x65, 0xFF, 0xE9, 0x3B, 0xFF, 0xA8, 0x33, 0xFF, 0xE9, 0x3B, 0xFF, 0x8C, 0x64, 0xFF, 0x2A, 0x54, 0xFF, 0x48, 0x43, 0xFF, 0x07, 0x33, 0xFF, 0x27, 0x33, 0xFF, 0x0B, 0x6C, 0xFF, 0xA6, 0x32, 0xFF, 0x67, 0x3A, 0xFF, 0x46, 0x32, 0xFF, 0xEB, 0x5B, 0xFF, 0xC7, 0x42, 0xFF, 0x46, 0x3A, 0xFF, 0xE4, 0x31, 0xFF, 0x07, 0x4B, 0xFF, 0x4A, 0x73, 0xFF, 0x46, 0x42, 0xFF, 0xCB, 0x6B, 0xFF, 0x8B, 0x73, 0xFF, 0x09, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0x87, 0x5A, 0xFF, 0x67, 0x7A, 0xFF, 0x6D, 0xAB, 0xFF, 0x4A, 0x8B, 0xFF, 0xE7, 0x99, 0xFF, 0xEA, 0xA2, 0xFF, 0xE9, 0x92, 0xFF, 0xC6, 0x91, 0xFF, 0x6B, 0xD2, 0xFF, 0x8B, 0xD2, 0xFF, 0xEA, 0xBA, 0xFF, 0x88, 0x92, 0xFF, 0xA5, 0x79, 0xFF,
-    0x47, 0x82, 0xFF, 0xE3, 0x70, 0xFF, 0xEA, 0xBA, 0xFF, 0x27, 0x82, 0xFF, 0xE5, 0x79, 0xFF, 0x2A, 0xCA, 0xFF, 0x89, 0x92, 0xFF, 0xE7, 0x91, 0xFF, 0x0C, 0xCB, 0xFF, 0x65, 0x69, 0xFF, 0xE7, 0x89, 0xFF, 0x08, 0x92, 0xFF, 0x48, 0x8A, 0xFF, 0x27, 0x82, 0xFF, 0x27, 0x8A, 0xFF, 0x26, 0x82, 0xFF, 0x45, 0x12, 0xFF, 0x85, 0x1A, 0xFF, 0x85, 0x12, 0xFF, 0xA5, 0x12, 0xFF, 0x06, 0x13, 0xFF, 0x08, 0x1C, 0xFF, 0x87, 0x1B, 0xFF, 0xA7, 0x1B, 0xFF, 0xAB, 0x2D, 0xFF, 0x09, 0x15, 0xFF, 0x2A, 0x1D, 0xFF, 0xA9, 0x1C, 0xFF, 0xE9, 0x1C, 0xFF, 0xC9, 0x24, 0xFF, 0x2B, 0x25, 0xFF, 0xCA, 0x2C, 0xFF, 0x8A, 0x2C, 0xFF, 0x69, 0x2C, 0xFF, 0xCA, 0x2C, 0xFF, 0xA6, 0x13, 0xFF, 0x29, 0x24, 0xFF, 0x49, 0x2C, 0xFF, 0x8B, 0x3C, 0xFF, 0xE8, 0x33, 0xFF, 0xA8, 0x2B, 0xFF, 0x4A, 0x44, 0xFF, 0xA8, 0x33, 0xFF, 0xC9, 0x3B, 0xFF, 0x89, 0x3B, 0xFF, 0xCD, 0x6C, 0xFF, 0x27, 0x2B, 0xFF, 0xAE, 0x64, 0xFF, 0x07, 0x33, 0xFF, 0x69, 0x4B, 0xFF, 0x69, 0x4B, 0xFF, 0x07, 0x3B, 0xFF, 0xAA, 0x53, 0xFF, 0x49, 0x5B, 0xFF, 0xA8, 0x3A, 0xFF, 0x87, 0x32, 0xFF, 0xCB, 0x5A, 0xFF, 0xE4, 0x29, 0xFF, 0x67, 0x42, 0xFF, 0xA4, 0x39, 0xFF, 0x29, 0x5B, 0xFF, 0x87, 0x4A, 0xFF, 0x46, 0x42, 0xFF, 0xA7, 0x52, 0xFF,
-    0x47, 0x4A, 0xFF, 0x05, 0x4A, 0xFF, 0x07, 0x62, 0xFF, 0x8B, 0x73, 0xFF, 0xA8, 0x81, 0xFF, 0x07, 0x62, 0xFF, 0x88, 0x72, 0xFF, 0xED, 0xE1, 0xFF, 0x08, 0x92, 0xFF, 0x06, 0x6A, 0xFF, 0xC7, 0x81, 0xFF, 0xEB, 0xD1, 0xFF, 0xE9, 0x99, 0xFF, 0xC6, 0x61, 0xFF, 0xA5, 0x51, 0xFF, 0x84, 0x51, 0xFF, 0xC5, 0x51, 0xFF, 0xC6, 0x59, 0xFF, 0xA5, 0x51, 0xFF, 0xC6, 0x59, 0xFF, 0xC6, 0x69, 0xFF, 0xA7, 0x79, 0xFF, 0x85, 0x61, 0xFF, 0xE8, 0x79, 0xFF, 0xC7, 0x71, 0xFF, 0x07, 0x72, 0xFF, 0xC6, 0x69, 0xFF, 0x07, 0x72, 0xFF, 0xC5, 0x69, 0xFF, 0x26, 0x6A, 0xFF, 0x26, 0x72, 0xFF, 0xE5, 0x69, 0xFF, 0x07, 0x23, 0xFF, 0x25, 0x1A, 0xFF, 0x65, 0x1A, 0xFF, 0x65, 0x12, 0xFF, 0x44, 0x12, 0xFF, 0xC6, 0x1A, 0xFF, 0x06, 0x1B, 0xFF, 0x26, 0x1B, 0xFF, 0x46, 0x13, 0xFF, 0xC8, 0x1B, 0xFF, 0x49, 0x2C, 0xFF, 0xE7, 0x13, 0xFF, 0xCA, 0x34, 0xFF, 0xC7, 0x13, 0xFF, 0xCA, 0x2C, 0xFF, 0x69, 0x24, 0xFF, 0x08, 0x1C, 0xFF, 0xE7, 0x1B, 0xFF, 0x2A, 0x2D, 0xFF, 0x28, 0x2C, 0xFF, 0x8A, 0x34, 0xFF, 0x89, 0x2C, 0xFF, 0x69, 0x34, 0xFF, 0x09, 0x2C, 0xFF, 0xA8, 0x2B, 0xFF, 0x09, 0x34, 0xFF, 0xC8, 0x2B, 0xFF, 0xE9, 0x33, 0xFF, 0x88, 0x2B, 0xFF, 0xC9, 0x33, 0xFF, 0x67, 0x2B, 0xFF, 0x47, 0x2B, 0xFF,
-    0xA8, 0x33, 0xFF, 0x48, 0x3B, 0xFF, 0x07, 0x33, 0xFF, 0xE6, 0x2A, 0xFF, 0x48, 0x43, 0xFF, 0xE7, 0x3A, 0xFF, 0xA7, 0x3A, 0xFF, 0xA7, 0x32, 0xFF, 0x87, 0x3A, 0xFF, 0x24, 0x2A, 0xFF, 0x66, 0x3A, 0xFF, 0x45, 0x3A, 0xFF, 0xA7, 0x42, 0xFF, 0x86, 0x42, 0xFF, 0x86, 0x42, 0xFF, 0xA7, 0x52, 0xFF, 0x66, 0x4A, 0xFF, 0x46, 0x4A, 0xFF, 0x87, 0x5A, 0xFF, 0x46, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0x68, 0x62, 0xFF, 0x67, 0x6A, 0xFF, 0xC4, 0x49, 0xFF, 0x67, 0x62, 0xFF, 0xE5, 0x59, 0xFF, 0xC5, 0x51, 0xFF, 0xC4, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0xC5, 0x49, 0xFF, 0xA4, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0xE6, 0x51, 0xFF, 0xC5, 0x51, 0xFF, 0x07, 0x5A, 0xFF, 0xA5, 0x59, 0xFF, 0xE6, 0x61, 0xFF, 0xC6, 0x61, 0xFF, 0x27, 0x6A, 0xFF, 0xE6, 0x61, 0xFF, 0x06, 0x6A, 0xFF, 0x27, 0x6A, 0xFF, 0xE5, 0x61, 0xFF, 0x26, 0x6A, 0xFF, 0x25, 0x6A, 0xFF, 0x04, 0x12, 0xFF, 0x65, 0x12, 0xFF, 0x45, 0x12, 0xFF, 0x65, 0x12, 0xFF, 0x85, 0x1A, 0xFF, 0x63, 0x0A, 0xFF, 0xE6, 0x1A, 0xFF, 0xC5, 0x12, 0xFF, 0x46, 0x1B, 0xFF, 0x47, 0x1B, 0xFF, 0xA7, 0x1B, 0xFF, 0x45, 0x0B, 0xFF, 0x0B, 0x35, 0xFF, 0xE7, 0x13, 0xFF, 0x2B, 0x2D, 0xFF, 0xA8, 0x1C, 0xFF,
-    0xC9, 0x1C, 0xFF, 0xA9, 0x1C, 0xFF, 0xAD, 0x2E, 0xFF, 0x2B, 0x2D, 0xFF, 0x4A, 0x1D, 0xFF, 0x8A, 0x25, 0xFF, 0xAD, 0x3D, 0xFF, 0x29, 0x2C, 0xFF, 0x09, 0x24, 0xFF, 0xCB, 0x34, 0xFF, 0x8A, 0x3C, 0xFF, 0xAB, 0x3C, 0xFF, 0xA8, 0x23, 0xFF, 0xAB, 0x3C, 0xFF, 0xE8, 0x2B, 0xFF, 0x46, 0x23, 0xFF, 0xC8, 0x33, 0xFF, 0x89, 0x3B, 0xFF, 0x89, 0x3B, 0xFF, 0x26, 0x2B, 0xFF, 0x89, 0x3B, 0xFF, 0x47, 0x33, 0xFF, 0xC7, 0x3A, 0xFF, 0x64, 0x1A, 0xFF, 0xE8, 0x3A, 0xFF, 0x65, 0x2A, 0xFF, 0xC7, 0x3A, 0xFF, 0x45, 0x32, 0xFF, 0xE7, 0x42, 0xFF, 0x87, 0x42, 0xFF, 0x08, 0x4B, 0xFF, 0x6F, 0x7D, 0xFF, 0x09, 0x5B, 0xFF, 0xA6, 0x4A, 0xFF, 0x68, 0x52, 0xFF, 0xE8, 0x62, 0xFF, 0x68, 0x82, 0xFF, 0x26, 0x52, 0xFF, 0xEB, 0x7B, 0xFF, 0x26, 0x5A, 0xFF, 0x26, 0x5A, 0xFF, 0x05, 0x4A, 0xFF, 0xC5, 0x49, 0xFF, 0xE4, 0x49, 0xFF, 0x05, 0x52, 0xFF, 0xC4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0x84, 0x41, 0xFF, 0xA4, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0xE5, 0x51, 0xFF, 0x06, 0x5A, 0xFF, 0x63, 0x41, 0xFF, 0xE7, 0x61, 0xFF, 0x28, 0x6A, 0xFF, 0xE6, 0x69, 0xFF, 0x07, 0x7A, 0xFF, 0xE6, 0x69, 0xFF, 0x6A, 0x9A, 0xFF, 0x47, 0x72, 0xFF, 0x07, 0x72, 0xFF, 0x27, 0x72, 0xFF,
-    0x45, 0x1A, 0xFF, 0x65, 0x12, 0xFF, 0xA5, 0x12, 0xFF, 0x84, 0x0A, 0xFF, 0x85, 0x0A, 0xFF, 0x6C, 0x35, 0xFF, 0x05, 0x0B, 0xFF, 0x87, 0x13, 0xFF, 0xE4, 0x02, 0xFF, 0xCC, 0x25, 0xFF, 0xCB, 0x2C, 0xFF, 0x0D, 0x26, 0xFF, 0x31, 0x1F, 0xFF, 0xDC, 0x77, 0xFF, 0x6E, 0x26, 0xFF, 0x70, 0x27, 0xFF, 0xF5, 0x2F, 0xFF, 0xF6, 0x3F, 0xFF, 0x8D, 0x26, 0xFF, 0x8F, 0x3E, 0xFF, 0xFF, 0x87, 0xFF, 0xD4, 0x37, 0xFF, 0x90, 0x3F, 0xFF, 0xEC, 0x3C, 0xFF, 0x2E, 0x3E, 0xFF, 0xF7, 0x3F, 0xFF, 0xAE, 0x2E, 0xFF, 0xC9, 0x14, 0xFF, 0xCC, 0x44, 0xFF, 0x2C, 0x2E, 0xFF, 0xEC, 0x3D, 0xFF, 0x4B, 0x35, 0xFF, 0xAB, 0x3C, 0xFF, 0xCC, 0x5C, 0xFF, 0x29, 0x3C, 0xFF, 0x4C, 0x1E, 0xFF, 0x0C, 0x5D, 0xFF, 0xC9, 0x4B, 0xFF, 0x08, 0x3B, 0xFF, 0xC6, 0x1A, 0xFF, 0xEE, 0x74, 0xFF, 0xA8, 0x43, 0xFF, 0xC6, 0x32, 0xFF, 0xE7, 0x42, 0xFF, 0x29, 0x54, 0xFF, 0xCC, 0x6C, 0xFF, 0xC9, 0x53, 0xFF, 0xF3, 0x96, 0xFF, 0x28, 0x63, 0xFF, 0x0A, 0x6C, 0xFF, 0x2B, 0x74, 0xFF, 0x07, 0x5B, 0xFF, 0xA6, 0x6A, 0xFF, 0x8A, 0x73, 0xFF, 0xA8, 0x63, 0xFF, 0xAB, 0x93, 0xFF, 0xAA, 0x7B, 0xFF, 0xAA, 0x7B, 0xFF, 0x86, 0x6A, 0xFF, 0xE7, 0x6A, 0xFF, 0xE8, 0x7A, 0xFF, 0xE6, 0x72, 0xFF, 0xA9, 0x83, 0xFF, 0xCA, 0x83, 0xFF,
-    0xCA, 0x8B, 0xFF, 0xA3, 0x49, 0xFF, 0x07, 0x7B, 0xFF, 0x8E, 0xCC, 0xFF, 0x8A, 0x9B, 0xFF, 0xC6, 0x72, 0xFF, 0xC3, 0x51, 0xFF, 0xE7, 0x7A, 0xFF, 0x66, 0x72, 0xFF, 0xA8, 0x72, 0xFF, 0x24, 0x5A, 0xFF, 0xA8, 0x8A, 0xFF, 0xE3, 0x51, 0xFF, 0x67, 0x7A, 0xFF, 0xA6, 0x6A, 0xFF, 0xE8, 0x82, 0xFF, 0xCC, 0x3C, 0xFF, 0x94, 0x86, 0xFF, 0x05, 0x1A, 0xFF, 0x6C, 0x3D, 0xFF, 0xC9, 0x2B, 0xFF, 0x08, 0x24, 0xFF, 0xA6, 0x1A, 0xFF, 0xA6, 0x1A, 0xFF, 0xC6, 0x1B, 0xFF, 0x2E, 0x3E, 0xFF, 0x08, 0x14, 0xFF, 0x0D, 0x36, 0xFF, 0xEB, 0x0D, 0xFF, 0xEC, 0x2D, 0xFF, 0xD0, 0x27, 0xFF, 0xFD, 0x97, 0xFF, 0xF3, 0x2F, 0xFF, 0x30, 0x3F, 0xFF, 0x2A, 0x25, 0xFF, 0xEE, 0x25, 0xFF, 0xFF, 0xCF, 0xFF, 0x8E, 0x17, 0xFF, 0x2D, 0x36, 0xFF, 0x8A, 0x2C, 0xFF, 0x6B, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x27, 0xFF, 0xAD, 0x45, 0xFF, 0x0A, 0x34, 0xFF, 0x6E, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x35, 0xFF, 0x49, 0x34, 0xFF, 0xC9, 0x33, 0xFF, 0x0A, 0x44, 0xFF, 0x6F, 0x46, 0xFF, 0xCA, 0x3C, 0xFF, 0xE8, 0x3B, 0xFF, 0xAA, 0x43, 0xFF, 0x06, 0x1B, 0xFF, 0x4C, 0x4D, 0xFF, 0x70, 0x4E, 0xFF, 0x08, 0x43, 0xFF, 0xA6, 0x32, 0xFF, 0xC9, 0x43, 0xFF, 0x27, 0x3B, 0xFF, 0xF7, 0x47, 0xFF, 0xC9, 0x4B, 0xFF,
-    0xC7, 0x42, 0xFF, 0x06, 0x3B, 0xFF, 0xC7, 0x42, 0xFF, 0x4B, 0x6D, 0xFF, 0xA7, 0x4A, 0xFF, 0xA6, 0x4A, 0xFF, 0x48, 0x53, 0xFF, 0x86, 0x42, 0xFF, 0xED, 0x84, 0xFF, 0x09, 0x63, 0xFF, 0xA2, 0x29, 0xFF, 0x45, 0x42, 0xFF, 0x05, 0x3A, 0xFF, 0xE4, 0x31, 0xFF, 0x28, 0x53, 0xFF, 0x25, 0x42, 0xFF, 0x24, 0x3A, 0xFF, 0x25, 0x3A, 0xFF, 0x05, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x05, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x25, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x06, 0x52, 0xFF, 0x46, 0x52, 0xFF, 0xA3, 0x41, 0xFF, 0x26, 0x52, 0xFF, 0xA3, 0x39, 0xFF, 0x45, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0xE6, 0x19, 0xFF, 0xC5, 0x19, 0xFF, 0xC4, 0x11, 0xFF, 0x25, 0x1A, 0xFF, 0x04, 0x12, 0xFF, 0x64, 0x12, 0xFF, 0x25, 0x1A, 0xFF, 0x65, 0x1A, 0xFF, 0x0B, 0x4C, 0xFF, 0xEA, 0x3B, 0xFF, 0xE7, 0x22, 0xFF, 0xCB, 0x34, 0xFF, 0x26, 0x0B, 0xFF, 0xCC, 0x44, 0xFF, 0x08, 0x24, 0xFF, 0x0F, 0x56, 0xFF, 0x2A, 0x2D, 0xFF, 0xEA, 0x34, 0xFF, 0x4C, 0x45, 0xFF, 0x08, 0x1C, 0xFF, 0xEA, 0x34, 0xFF, 0x4C, 0x35, 0xFF, 0x0B, 0x3D, 0xFF, 0x29, 0x2C, 0xFF, 0x6B, 0x34, 0xFF, 0xCB, 0x3C, 0xFF, 0xAB, 0x3C, 0xFF, 0xCB, 0x34, 0xFF, 0x0A, 0x3C, 0xFF, 0x0B, 0x3D, 0xFF, 0x6C, 0x45, 0xFF, 0x4A, 0x3C, 0xFF,
-    0xAC, 0x44, 0xFF, 0xEC, 0x5C, 0xFF, 0x2C, 0x54, 0xFF, 0xEA, 0x43, 0xFF, 0x2A, 0x4C, 0xFF, 0x6A, 0x4C, 0xFF, 0x4A, 0x4B, 0xFF, 0x06, 0x23, 0xFF, 0x32, 0x93, 0xFF, 0xCA, 0x53, 0xFF, 0x09, 0x53, 0xFF, 0x87, 0x42, 0xFF, 0xC9, 0x43, 0xFF, 0x6C, 0x73, 0xFF, 0xAB, 0x6B, 0xFF, 0x8C, 0x5C, 0xFF, 0xE8, 0x4A, 0xFF, 0x4A, 0x6C, 0xFF, 0x29, 0x5B, 0xFF, 0x28, 0x4B, 0xFF, 0xA6, 0x3A, 0xFF, 0xE7, 0x52, 0xFF, 0x27, 0x4B, 0xFF, 0x66, 0x42, 0xFF, 0x69, 0x5B, 0xFF, 0x65, 0x3A, 0xFF, 0x04, 0x32, 0xFF, 0x86, 0x42, 0xFF, 0x45, 0x42, 0xFF, 0x25, 0x32, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x86, 0x4A, 0xFF, 0x04, 0x3A, 0xFF, 0x25, 0x3A, 0xFF, 0x25, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0xA7, 0x5A, 0xFF, 0x46, 0x4A, 0xFF, 0x66, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x66, 0x52, 0xFF, 0xA3, 0x39, 0xFF, 0x26, 0x5A, 0xFF, 0x64, 0x41, 0xFF, 0x46, 0x5A, 0xFF, 0xF2, 0xBA, 0xFF, 0x4B, 0x92, 0xFF, 0xA5, 0x21, 0xFF, 0x68, 0x32, 0xFF, 0x29, 0x4B, 0xFF, 0xE6, 0x21, 0xFF, 0x6C, 0x4C, 0xFF, 0x27, 0x1B, 0xFF, 0x26, 0x22, 0xFF, 0x28, 0x33, 0xFF, 0x4C, 0x44, 0xFF, 0xE7, 0x22, 0xFF, 0xC7, 0x22, 0xFF, 0x89, 0x33, 0xFF, 0x68, 0x23, 0xFF, 0xAF, 0x5D, 0xFF, 0x27, 0x1B, 0xFF, 0x0A, 0x34, 0xFF,
-    0x8D, 0x4D, 0xFF, 0x8C, 0x3D, 0xFF, 0xEA, 0x33, 0xFF, 0xCC, 0x44, 0xFF, 0x8C, 0x44, 0xFF, 0xAD, 0x4C, 0xFF, 0x6C, 0x44, 0xFF, 0x6B, 0x34, 0xFF, 0x4F, 0x64, 0xFF, 0x4C, 0x44, 0xFF, 0x2D, 0x4D, 0xFF, 0x8B, 0x3C, 0xFF, 0x50, 0x84, 0xFF, 0x4A, 0x3C, 0xFF, 0xAC, 0x4C, 0xFF, 0xCF, 0x74, 0xFF, 0x2D, 0x4D, 0xFF, 0x6E, 0x5D, 0xFF, 0xCD, 0x7B, 0xFF, 0x2A, 0x44, 0xFF, 0x6B, 0x4C, 0xFF, 0x6B, 0x5C, 0xFF, 0xAA, 0x43, 0xFF, 0xA9, 0x43, 0xFF, 0x0E, 0x94, 0xFF, 0x68, 0x33, 0xFF, 0x69, 0x4B, 0xFF, 0xE6, 0x3A, 0xFF, 0xEB, 0x54, 0xFF, 0xA9, 0x4B, 0xFF, 0x8A, 0x44, 0xFF, 0xAF, 0x8D, 0xFF, 0x48, 0x43, 0xFF, 0x67, 0x43, 0xFF, 0x2D, 0x8C, 0xFF, 0xE8, 0x43, 0xFF, 0x06, 0x3B, 0xFF, 0x88, 0x72, 0xFF, 0xE8, 0x5B, 0xFF, 0xA9, 0x53, 0xFF, 0x46, 0x52, 0xFF, 0x6B, 0x93, 0xFF, 0xC2, 0x29, 0xFF, 0x67, 0x4B, 0xFF, 0x69, 0x73, 0xFF, 0xAB, 0x83, 0xFF, 0x44, 0x3A, 0xFF, 0x65, 0x3A, 0xFF, 0x68, 0x5B, 0xFF, 0xE7, 0x4A, 0xFF, 0x45, 0x3A, 0xFF, 0x45, 0x42, 0xFF, 0x45, 0x42, 0xFF, 0x48, 0x53, 0xFF, 0x46, 0x4A, 0xFF, 0xA7, 0x5A, 0xFF, 0xA7, 0x5A, 0xFF, 0xA7, 0x5A, 0xFF, 0xE4, 0x41, 0xFF, 0x86, 0x5A, 0xFF, 0x04, 0x42, 0xFF, 0xC7, 0x62, 0xFF, 0xE7, 0x62, 0xFF, 0xC6, 0x5A, 0xFF,
-    0x47, 0x2A, 0xFF, 0xE6, 0x21, 0xFF, 0x0B, 0x3C, 0xFF, 0x27, 0x2A, 0xFF, 0x29, 0x33, 0xFF, 0x26, 0x1A, 0xFF, 0x07, 0x22, 0xFF, 0x6B, 0x3C, 0xFF, 0xE8, 0x22, 0xFF, 0xAB, 0x43, 0xFF, 0xEC, 0x43, 0xFF, 0x09, 0x2B, 0xFF, 0x92, 0x5E, 0xFF, 0xCB, 0x2C, 0xFF, 0x0C, 0x44, 0xFF, 0x8A, 0x33, 0xFF, 0x0B, 0x3C, 0xFF, 0xCF, 0x45, 0xFF, 0x8C, 0x44, 0xFF, 0x89, 0x2B, 0xFF, 0xCD, 0x3C, 0xFF, 0xEE, 0x44, 0xFF, 0xEC, 0x44, 0xFF, 0x91, 0x66, 0xFF, 0x2D, 0x4D, 0xFF, 0xEE, 0x54, 0xFF, 0xCF, 0x55, 0xFF, 0x49, 0x2C, 0xFF, 0x0E, 0x55, 0xFF, 0xB0, 0x6D, 0xFF, 0xF6, 0x87, 0xFF, 0x8A, 0x34, 0xFF, 0x2F, 0x4E, 0xFF, 0xE9, 0x33, 0xFF, 0xEC, 0x44, 0xFF, 0xCB, 0x3C, 0xFF, 0x6D, 0x55, 0xFF, 0xAF, 0x56, 0xFF, 0xA9, 0x3B, 0xFF, 0xEA, 0x3B, 0xFF, 0xE8, 0x33, 0xFF, 0xE8, 0x33, 0xFF, 0xCA, 0x43, 0xFF, 0x26, 0x2B, 0xFF, 0xD2, 0x6E, 0xFF, 0xA8, 0x43, 0xFF, 0xAB, 0x4C, 0xFF, 0x73, 0x7F, 0xFF, 0x4B, 0x64, 0xFF, 0x69, 0x64, 0xFF, 0x47, 0x3B, 0xFF, 0x49, 0x44, 0xFF, 0x2A, 0x64, 0xFF, 0x2C, 0x94, 0xFF, 0xAC, 0x4D, 0xFF, 0x87, 0x4B, 0xFF, 0x29, 0x6C, 0xFF, 0x4B, 0x7C, 0xFF, 0x84, 0x2A, 0xFF, 0x67, 0x4B, 0xFF, 0x4A, 0x74, 0xFF, 0x29, 0x74, 0xFF, 0x64, 0x3A, 0xFF, 0x45, 0x3A, 0xFF,
-    0x06, 0x4B, 0xFF, 0x4B, 0x74, 0xFF, 0x2F, 0xC5, 0xFF, 0x85, 0x3A, 0xFF, 0x68, 0x63, 0xFF, 0xC5, 0x42, 0xFF, 0xA9, 0x73, 0xFF, 0x86, 0x4A, 0xFF, 0xC7, 0x5A, 0xFF, 0xA6, 0x4A, 0xFF, 0x08, 0x63, 0xFF, 0xE7, 0x5A, 0xFF, 0xE7, 0x52, 0xFF, 0xA6, 0x52, 0xFF, 0x06, 0x5B, 0xFF, 0xC6, 0x52, 0xFF, 0x65, 0x19, 0xFF, 0x27, 0x2A, 0xFF, 0x05, 0x1A, 0xFF, 0x2C, 0x44, 0xFF, 0x66, 0x1A, 0xFF, 0x2B, 0x4B, 0xFF, 0x6E, 0x54, 0xFF, 0x4C, 0x44, 0xFF, 0xE6, 0x21, 0xFF, 0xCD, 0x44, 0xFF, 0x27, 0x22, 0xFF, 0xE8, 0x2A, 0xFF, 0x4B, 0x2C, 0xFF, 0xEA, 0x23, 0xFF, 0x2E, 0x5C, 0xFF, 0x87, 0x22, 0xFF, 0xAC, 0x44, 0xFF, 0x4D, 0x2D, 0xFF, 0x2E, 0x45, 0xFF, 0xAE, 0x54, 0xFF, 0x8F, 0x56, 0xFF, 0xFA, 0x67, 0xFF, 0xCE, 0x4D, 0xFF, 0x8B, 0x34, 0xFF, 0x2E, 0x5D, 0xFF, 0xD0, 0x46, 0xFF, 0x52, 0x37, 0xFF, 0xCD, 0x45, 0xFF, 0x2F, 0x6C, 0xFF, 0xD0, 0xA5, 0xFF, 0x70, 0x3F, 0xFF, 0xB3, 0x5F, 0xFF, 0xD6, 0x8E, 0xFF, 0x2A, 0x3C, 0xFF, 0xCF, 0x6C, 0xFF, 0x92, 0x5F, 0xFF, 0x2F, 0x4F, 0xFF, 0xCD, 0x5C, 0xFF, 0x4E, 0x5C, 0xFF, 0x8B, 0x3C, 0xFF, 0xBF, 0xFF, 0xFF, 0x8C, 0x4D, 0xFF, 0x89, 0x34, 0xFF, 0xCB, 0x6B, 0xFF, 0x68, 0x2C, 0xFF, 0x8E, 0x56, 0xFF, 0x0C, 0x3E, 0xFF, 0xD3, 0x6F, 0xFF,
-    0xA8, 0x43, 0xFF, 0x69, 0x44, 0xFF, 0xEF, 0x5E, 0xFF, 0x48, 0x3C, 0xFF, 0x09, 0x44, 0xFF, 0xA8, 0x43, 0xFF, 0x2B, 0x5D, 0xFF, 0x2F, 0x67, 0xFF, 0xE8, 0x43, 0xFF, 0x05, 0x33, 0xFF, 0x25, 0x33, 0xFF, 0x69, 0x54, 0xFF, 0x4A, 0x55, 0xFF, 0x06, 0x33, 0xFF, 0xA5, 0x32, 0xFF, 0x69, 0x5C, 0xFF, 0xA2, 0x22, 0xFF, 0x8D, 0x85, 0xFF, 0x65, 0x32, 0xFF, 0xA5, 0x3A, 0xFF, 0xA6, 0x3A, 0xFF, 0x85, 0x43, 0xFF, 0xAA, 0x6C, 0xFF, 0xA6, 0x4A, 0xFF, 0xEA, 0x6B, 0xFF, 0x88, 0x5B, 0xFF, 0x8A, 0x7C, 0xFF, 0x49, 0x6C, 0xFF, 0xC6, 0x4A, 0xFF, 0xC5, 0x4A, 0xFF, 0x07, 0x53, 0xFF, 0x67, 0x5B, 0xFF, 0xAE, 0x4C, 0xFF, 0xED, 0x4A, 0xFF, 0x87, 0x29, 0xFF, 0x4A, 0x3B, 0xFF, 0xED, 0x3C, 0xFF, 0x8D, 0x54, 0xFF, 0x07, 0x32, 0xFF, 0xEA, 0x32, 0xFF, 0x07, 0x23, 0xFF, 0x50, 0x4E, 0xFF, 0x05, 0x1A, 0xFF, 0x06, 0x12, 0xFF, 0x49, 0x33, 0xFF, 0x68, 0x2A, 0xFF, 0x6F, 0x36, 0xFF, 0x48, 0x1B, 0xFF, 0x69, 0x2B, 0xFF, 0xC8, 0x22, 0xFF, 0x8C, 0x43, 0xFF, 0x2C, 0x3C, 0xFF, 0xFF, 0xAF, 0xFF, 0x94, 0x67, 0xFF, 0x38, 0xA4, 0xFF, 0xCA, 0x3B, 0xFF, 0xF1, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x2F, 0xFF, 0xAC, 0x4C, 0xFF, 0xB5, 0xAC, 0xFF, 0x50, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x5F, 0xFF,
-    0xEE, 0x45, 0xFF, 0xAB, 0x3C, 0xFF, 0xD2, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x47, 0xFF, 0x2D, 0x5D, 0xFF, 0x29, 0x2C, 0xFF, 0xEB, 0x3C, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x3D, 0xFF, 0xA7, 0x2B, 0xFF, 0xEB, 0x3C, 0xFF, 0x4D, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x56, 0xFF, 0x08, 0x34, 0xFF, 0xAA, 0x3C, 0xFF, 0xA7, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0x1C, 0xFF, 0x67, 0x43, 0xFF, 0x8A, 0x44, 0xFF, 0x49, 0x44, 0xFF, 0x4B, 0x46, 0xFF, 0x67, 0x3B, 0xFF, 0x25, 0x33, 0xFF, 0x87, 0x3B, 0xFF, 0x87, 0x43, 0xFF, 0xE5, 0x2A, 0xFF, 0x2C, 0x5E, 0xFF, 0x05, 0x3B, 0xFF, 0xE6, 0x32, 0xFF, 0xA5, 0x2A, 0xFF, 0xE6, 0x3A, 0xFF, 0x09, 0x55, 0xFF, 0x84, 0x2A, 0xFF, 0x47, 0x43, 0xFF, 0xE6, 0x42, 0xFF, 0x07, 0x4B, 0xFF, 0x09, 0x6D, 0xFF, 0x26, 0x43, 0xFF, 0xE6, 0x4A, 0xFF, 0x07, 0x53, 0xFF, 0xC6, 0x4A, 0xFF, 0xE9, 0x6C, 0xFF, 0x28, 0x6C, 0xFF, 0x26, 0x4B, 0xFF, 0x31, 0x75, 0xFF, 0xA6, 0x21, 0xFF, 0x85, 0x19, 0xFF, 0x66, 0x21, 0xFF, 0xA6, 0x21, 0xFF, 0xC7, 0x29, 0xFF, 0xC6, 0x21, 0xFF, 0xE6, 0x19, 0xFF, 0xA5, 0x19, 0xFF, 0xC6, 0x21, 0xFF, 0xE7, 0x29, 0xFF, 0x07, 0x22, 0xFF, 0x8B, 0x3A, 0xFF, 0x69, 0x2A, 0xFF, 0x6C, 0x43, 0xFF, 0xEC, 0x42, 0xFF,
-    0x8D, 0x53, 0xFF, 0xE9, 0x2A, 0xFF, 0xEB, 0x42, 0xFF, 0x2C, 0x43, 0xFF, 0x8B, 0x43, 0xFF, 0x09, 0x33, 0xFF, 0xEC, 0x4B, 0xFF, 0x31, 0x74, 0xFF, 0x8C, 0x44, 0xFF, 0xF6, 0x8C, 0xFF, 0xCE, 0x54, 0xFF, 0x2D, 0x4C, 0xFF, 0x2C, 0x44, 0xFF, 0x0D, 0x45, 0xFF, 0x90, 0x4E, 0xFF, 0x4F, 0x4E, 0xFF, 0x0B, 0x45, 0xFF, 0xEF, 0x6C, 0xFF, 0xCB, 0x3C, 0xFF, 0xAC, 0x35, 0xFF, 0x6C, 0x3D, 0xFF, 0x6A, 0x25, 0xFF, 0x08, 0x24, 0xFF, 0xAA, 0x34, 0xFF, 0x2C, 0x36, 0xFF, 0xAD, 0x2E, 0xFF, 0x0B, 0x3D, 0xFF, 0x29, 0x34, 0xFF, 0x4D, 0x5D, 0xFF, 0x0B, 0x45, 0xFF, 0x8E, 0x46, 0xFF, 0xCD, 0x45, 0xFF, 0xE8, 0x3B, 0xFF, 0x0B, 0x45, 0xFF, 0xE7, 0x2B, 0xFF, 0x4D, 0x6D, 0xFF, 0xCC, 0x55, 0xFF, 0xE7, 0x3B, 0xFF, 0xC9, 0x3C, 0xFF, 0x4B, 0x7C, 0xFF, 0x08, 0x3C, 0xFF, 0x07, 0x34, 0xFF, 0xAA, 0x5C, 0xFF, 0xE6, 0x33, 0xFF, 0x46, 0x2B, 0xFF, 0x25, 0x2B, 0xFF, 0x8A, 0x6C, 0xFF, 0xC5, 0x2A, 0xFF, 0x66, 0x2B, 0xFF, 0x4A, 0x54, 0xFF, 0xA7, 0x4B, 0xFF, 0x27, 0x3B, 0xFF, 0x47, 0x43, 0xFF, 0x26, 0x43, 0xFF, 0x87, 0x4B, 0xFF, 0xA9, 0x53, 0xFF, 0xA5, 0x3A, 0xFF, 0x47, 0x4B, 0xFF, 0x06, 0x43, 0xFF, 0x67, 0x53, 0xFF, 0x47, 0x4B, 0xFF, 0x67, 0x53, 0xFF, 0x26, 0x43, 0xFF, 0x88, 0x53, 0xFF,
-    0x44, 0x11, 0xFF, 0xA7, 0x29, 0xFF, 0x86, 0x21, 0xFF, 0x87, 0x29, 0xFF, 0x87, 0x29, 0xFF, 0xEB, 0x51, 0xFF, 0x29, 0x3A, 0xFF, 0xA7, 0x21, 0xFF, 0x8C, 0x43, 0xFF, 0x2E, 0x5B, 0xFF, 0xE8, 0x29, 0xFF, 0xE8, 0x29, 0xFF, 0x4D, 0x43, 0xFF, 0x6F, 0x53, 0xFF, 0x4A, 0x32, 0xFF, 0xA9, 0x2A, 0xFF, 0x0F, 0x5C, 0xFF, 0xAD, 0x4B, 0xFF, 0xEE, 0x5A, 0xFF, 0x0B, 0x43, 0xFF, 0xEE, 0x53, 0xFF, 0xEF, 0x5B, 0xFF, 0x10, 0x6B, 0xFF, 0x8E, 0x63, 0xFF, 0x31, 0x75, 0xFF, 0x13, 0x84, 0xFF, 0x74, 0xAB, 0xFF, 0x2E, 0x5C, 0xFF, 0xF2, 0x7C, 0xFF, 0x74, 0xF5, 0xFF, 0x6E, 0x54, 0xFF, 0x6D, 0x54, 0xFF, 0xB7, 0x9C, 0xFF, 0xAC, 0x4C, 0xFF, 0x0C, 0x4C, 0xFF, 0x29, 0x34, 0xFF, 0x0E, 0x6D, 0xFF, 0xD0, 0x56, 0xFF, 0x29, 0x34, 0xFF, 0x6A, 0x3C, 0xFF, 0xEE, 0x5C, 0xFF, 0x69, 0x2C, 0xFF, 0x28, 0x2C, 0xFF, 0x09, 0x3C, 0xFF, 0xB5, 0x8F, 0xFF, 0x69, 0x34, 0xFF, 0x8D, 0x4D, 0xFF, 0x4E, 0x56, 0xFF, 0x89, 0x44, 0xFF, 0x68, 0x34, 0xFF, 0xC6, 0x23, 0xFF, 0xE9, 0x34, 0xFF, 0xA9, 0x4C, 0xFF, 0x29, 0x44, 0xFF, 0xAB, 0x45, 0xFF, 0x48, 0x34, 0xFF, 0xCA, 0x54, 0xFF, 0x68, 0x44, 0xFF, 0xC9, 0x44, 0xFF, 0x67, 0x24, 0xFF, 0x0A, 0x55, 0xFF, 0x6B, 0x6D, 0xFF, 0x66, 0x33, 0xFF, 0x66, 0x33, 0xFF,
-    0xA5, 0x33, 0xFF, 0xAC, 0x6D, 0xFF, 0x67, 0x3B, 0xFF, 0x46, 0x33, 0xFF, 0x8A, 0x64, 0xFF, 0x27, 0x44, 0xFF, 0x46, 0x43, 0xFF, 0x26, 0x43, 0xFF, 0x87, 0x4B, 0xFF, 0x26, 0x43, 0xFF, 0xA8, 0x4B, 0xFF, 0xA8, 0x53, 0xFF, 0x87, 0x53, 0xFF, 0x26, 0x43, 0xFF, 0xC8, 0x53, 0xFF, 0xE8, 0x53, 0xFF, 0x46, 0x21, 0xFF, 0xA7, 0x29, 0xFF, 0x89, 0x39, 0xFF, 0x4F, 0x59, 0xFF, 0x33, 0x9A, 0xFF, 0x6F, 0x5B, 0xFF, 0x6C, 0x4A, 0xFF, 0x31, 0x6A, 0xFF, 0x30, 0x6C, 0xFF, 0x50, 0x6B, 0xFF, 0xA9, 0x29, 0xFF, 0x51, 0x6B, 0xFF, 0xCC, 0x4A, 0xFF, 0x72, 0x7B, 0xFF, 0x6F, 0x5B, 0xFF, 0xF1, 0x6B, 0xFF, 0x2D, 0x53, 0xFF, 0x4A, 0x3A, 0xFF, 0xF2, 0x7B, 0xFF, 0x31, 0x6C, 0xFF, 0xAC, 0x4A, 0xFF, 0x14, 0xAB, 0xFF, 0xDF, 0xFE, 0xFF, 0x37, 0xA5, 0xFF, 0x52, 0x75, 0xFF, 0x1F, 0xFC, 0xFF, 0xED, 0x5A, 0xFF, 0x6E, 0x5C, 0xFF, 0xB0, 0x64, 0xFF, 0xCC, 0x4B, 0xFF, 0xAC, 0x43, 0xFF, 0xAC, 0x53, 0xFF, 0x0E, 0x5D, 0xFF, 0xEA, 0x3B, 0xFF, 0xF1, 0x9B, 0xFF, 0x6A, 0x3C, 0xFF, 0x0C, 0x4D, 0xFF, 0x6B, 0x2D, 0xFF, 0xC8, 0x2B, 0xFF, 0x29, 0x34, 0xFF, 0x8D, 0x64, 0xFF, 0x07, 0x1C, 0xFF, 0x28, 0x24, 0xFF, 0xE8, 0x23, 0xFF, 0x0D, 0x4E, 0xFF, 0x6C, 0x4D, 0xFF, 0xEE, 0x4D, 0xFF, 0x70, 0x57, 0xFF,
-    0x69, 0x34, 0xFF, 0xCC, 0x4D, 0xFF, 0xE8, 0x24, 0xFF, 0x49, 0x25, 0xFF, 0x69, 0x34, 0xFF, 0x88, 0x34, 0xFF, 0xCD, 0x4E, 0xFF, 0xEB, 0x35, 0xFF, 0x4B, 0x4D, 0xFF, 0x68, 0x34, 0xFF, 0xA8, 0x34, 0xFF, 0x49, 0x2D, 0xFF, 0x26, 0x14, 0xFF, 0xE6, 0x2B, 0xFF, 0x06, 0x34, 0xFF, 0xFF, 0x9F, 0xFF, 0x46, 0x24, 0xFF, 0xEA, 0x44, 0xFF, 0xC8, 0x34, 0xFF, 0x6C, 0x5E, 0xFF, 0xE8, 0x34, 0xFF, 0xA7, 0x3B, 0xFF, 0xA6, 0x43, 0xFF, 0x46, 0x3B, 0xFF, 0xC9, 0x54, 0xFF, 0xA7, 0x43, 0xFF, 0x87, 0x4B, 0xFF, 0xA8, 0x4B, 0xFF, 0xE8, 0x4B, 0xFF, 0xEA, 0x64, 0xFF, 0xE8, 0x53, 0xFF, 0xC7, 0x4B, 0xFF, 0xC7, 0x31, 0xFF, 0x46, 0x19, 0xFF, 0xA9, 0x31, 0xFF, 0x4C, 0x43, 0xFF, 0x86, 0x21, 0xFF, 0x68, 0x31, 0xFF, 0xA8, 0x49, 0xFF, 0x0E, 0x5C, 0xFF, 0xA8, 0x21, 0xFF, 0xA9, 0x31, 0xFF, 0xC9, 0x39, 0xFF, 0x19, 0x97, 0xFF, 0x50, 0x4C, 0xFF, 0x2D, 0x52, 0xFF, 0xB4, 0x7A, 0xFF, 0xCB, 0x3A, 0xFF, 0xAD, 0x53, 0xFF, 0x4F, 0x54, 0xFF, 0x8F, 0x72, 0xFF, 0x4A, 0x3A, 0xFF, 0x70, 0x62, 0xFF, 0xF1, 0x64, 0xFF, 0x4F, 0x54, 0xFF, 0xD9, 0xC4, 0xFF, 0x71, 0x6D, 0xFF, 0xCB, 0x4A, 0xFF, 0xEE, 0x4C, 0xFF, 0x0C, 0x44, 0xFF, 0x8B, 0x43, 0xFF, 0x4A, 0x33, 0xFF, 0xAB, 0x5B, 0xFF, 0x4F, 0x65, 0xFF,
-    0x50, 0x56, 0xFF, 0xEA, 0x3B, 0xFF, 0xEA, 0x33, 0xFF, 0x89, 0x2C, 0xFF, 0x2F, 0x66, 0xFF, 0x4A, 0x25, 0xFF, 0xE8, 0x2B, 0xFF, 0x29, 0x2C, 0xFF, 0x2E, 0x65, 0xFF, 0xA8, 0x24, 0xFF, 0x69, 0x24, 0xFF, 0xE8, 0x2B, 0xFF, 0x6A, 0x35, 0xFF, 0x30, 0x47, 0xFF, 0x6E, 0x37, 0xFF, 0xFA, 0x67, 0xFF, 0x4B, 0x45, 0xFF, 0x6A, 0x1D, 0xFF, 0xFF, 0xDF, 0xFF, 0xF3, 0x37, 0xFF, 0x8A, 0x25, 0xFF, 0x09, 0x35, 0xFF, 0xB6, 0x67, 0xFF, 0xFF, 0xF7, 0xFF, 0xD1, 0x37, 0xFF, 0x8B, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0xAF, 0x2F, 0xFF, 0xFE, 0x87, 0xFF, 0x2C, 0x4F, 0xFF, 0x27, 0x2C, 0xFF, 0x27, 0x2C, 0xFF, 0xDC, 0xA7, 0xFF, 0x50, 0x67, 0xFF, 0x47, 0x3C, 0xFF, 0xC7, 0x33, 0xFF, 0x65, 0x23, 0xFF, 0x2C, 0x66, 0xFF, 0x4B, 0x5E, 0xFF, 0x86, 0x3B, 0xFF, 0x29, 0x54, 0xFF, 0xA6, 0x3B, 0xFF, 0xC7, 0x43, 0xFF, 0xAC, 0x6D, 0xFF, 0xE3, 0x2A, 0xFF, 0xE7, 0x4B, 0xFF, 0xE7, 0x4B, 0xFF, 0xE6, 0x43, 0xFF, 0x87, 0x21, 0xFF, 0x7C, 0x9C, 0xFF, 0xA7, 0x29, 0xFF, 0x06, 0x12, 0xFF, 0xB3, 0x66, 0xFF, 0x47, 0x29, 0xFF, 0x0F, 0x5A, 0xFF, 0xAA, 0x39, 0xFF, 0x88, 0x29, 0xFF, 0xCF, 0x44, 0xFF, 0x48, 0x21, 0xFF, 0x10, 0x5A, 0xFF, 0xAA, 0x31, 0xFF, 0xAA, 0x31, 0xFF, 0xD3, 0x74, 0xFF, 0x6D, 0x4A, 0xFF,
-    0x09, 0x2A, 0xFF, 0xEA, 0x39, 0xFF, 0x51, 0x72, 0xFF, 0xD7, 0x8D, 0xFF, 0xB2, 0x5D, 0xFF, 0xED, 0x4A, 0xFF, 0x72, 0x8B, 0xFF, 0x0C, 0x4B, 0xFF, 0x2C, 0x43, 0xFF, 0xCF, 0x3D, 0xFF, 0xCC, 0x3B, 0xFF, 0xEA, 0x32, 0xFF, 0x4C, 0x4B, 0xFF, 0x8C, 0x4B, 0xFF, 0xF3, 0x27, 0xFF, 0x2A, 0x34, 0xFF, 0xAA, 0x3B, 0xFF, 0x0C, 0x54, 0xFF, 0xCB, 0x3B, 0xFF, 0xFC, 0x77, 0xFF, 0xF7, 0x47, 0xFF, 0xEC, 0x35, 0xFF, 0xC8, 0x23, 0xFF, 0x49, 0x2C, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xC9, 0x1C, 0xFF, 0xE8, 0x23, 0xFF, 0xCD, 0x4D, 0xFF, 0xD0, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x37, 0xFF, 0xC9, 0x3C, 0xFF, 0x6A, 0x3D, 0xFF, 0x2C, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x3F, 0xFF, 0xA8, 0x2C, 0xFF, 0x8C, 0x3E, 0xFF, 0xCF, 0x4F, 0xFF, 0xFF, 0xEF, 0xFF, 0xC8, 0x2C, 0xFF, 0xC8, 0x34, 0xFF, 0x8A, 0x3D, 0xFF, 0x72, 0x57, 0xFF, 0xF9, 0x77, 0xFF, 0xF0, 0x4F, 0xFF, 0x27, 0x34, 0xFF, 0x27, 0x2C, 0xFF, 0x49, 0x3D, 0xFF, 0x08, 0x2D, 0xFF, 0x8C, 0x56, 0xFF, 0x07, 0x34, 0xFF, 0x49, 0x44, 0xFF, 0x08, 0x44, 0xFF, 0xC6, 0x0C, 0xFF, 0x69, 0x55, 0xFF, 0xE7, 0x3B, 0xFF, 0x28, 0x4C, 0xFF, 0x69, 0x54, 0xFF, 0xAA, 0x54, 0xFF, 0xAA, 0x5D, 0xFF, 0xC9, 0x5C, 0xFF, 0x48, 0x4C, 0xFF,
-    0x46, 0x21, 0xFF, 0xA9, 0x39, 0xFF, 0x09, 0x3A, 0xFF, 0x68, 0x29, 0xFF, 0xC9, 0x40, 0xFF, 0xAF, 0x59, 0xFF, 0x6C, 0x59, 0xFF, 0x4E, 0x51, 0xFF, 0x32, 0x7B, 0xFF, 0x99, 0xA2, 0xFF, 0xAC, 0x49, 0xFF, 0xCB, 0x39, 0xFF, 0x6E, 0x52, 0xFF, 0xB3, 0x72, 0xFF, 0xD9, 0xA2, 0xFF, 0x0B, 0x42, 0xFF, 0xF1, 0x62, 0xFF, 0x16, 0x93, 0xFF, 0x9B, 0xB9, 0xFF, 0x19, 0xBA, 0xFF, 0xB3, 0x7B, 0xFF, 0x52, 0x73, 0xFF, 0x5F, 0xEA, 0xFF, 0x74, 0x83, 0xFF, 0xCD, 0x53, 0xFF, 0x52, 0x83, 0xFF, 0xEC, 0x42, 0xFF, 0xCB, 0x3A, 0xFF, 0x0D, 0x5B, 0xFF, 0xE9, 0x32, 0xFF, 0x6C, 0x43, 0xFF, 0x8D, 0x5B, 0xFF, 0xAB, 0x4B, 0xFF, 0x8A, 0x3B, 0xFF, 0xED, 0x63, 0xFF, 0xED, 0x44, 0xFF, 0x6B, 0x44, 0xFF, 0xA9, 0x24, 0xFF, 0xA8, 0x2B, 0xFF, 0x09, 0x2C, 0xFF, 0xED, 0x3D, 0xFF, 0xAD, 0x1E, 0xFF, 0x48, 0x24, 0xFF, 0x86, 0x1B, 0xFF, 0x4B, 0x3D, 0xFF, 0xEC, 0x35, 0xFF, 0x0E, 0x37, 0xFF, 0x4C, 0x36, 0xFF, 0x67, 0x2C, 0xFF, 0x09, 0x2D, 0xFF, 0x09, 0x25, 0xFF, 0xEC, 0x26, 0xFF, 0x49, 0x2D, 0xFF, 0xA9, 0x34, 0xFF, 0x2F, 0x5F, 0xFF, 0x8A, 0x35, 0xFF, 0x69, 0x3D, 0xFF, 0xA7, 0x2C, 0xFF, 0x49, 0x35, 0xFF, 0x29, 0x2D, 0xFF, 0x29, 0x2D, 0xFF, 0xE8, 0x34, 0xFF, 0xA8, 0x34, 0xFF, 0x88, 0x2C, 0xFF,
-    0x8A, 0x45, 0xFF, 0xAE, 0x36, 0xFF, 0x89, 0x3D, 0xFF, 0xA9, 0x44, 0xFF, 0x2A, 0x45, 0xFF, 0xFF, 0xB7, 0xFF, 0x28, 0x44, 0xFF, 0x07, 0x34, 0xFF, 0x06, 0x2C, 0xFF, 0xA9, 0x4C, 0xFF, 0xF2, 0x47, 0xFF, 0x48, 0x4C, 0xFF, 0xC9, 0x54, 0xFF, 0x68, 0x44, 0xFF, 0xAF, 0x3F, 0xFF, 0x47, 0x44, 0xFF, 0x69, 0x39, 0xFF, 0x48, 0x29, 0xFF, 0x07, 0x21, 0xFF, 0x6A, 0x41, 0xFF, 0x89, 0x39, 0xFF, 0x6A, 0x39, 0xFF, 0x90, 0x81, 0xFF, 0x9B, 0x91, 0xFF, 0x6E, 0x61, 0xFF, 0x55, 0x7A, 0xFF, 0x14, 0x71, 0xFF, 0xD8, 0xA3, 0xFF, 0x6D, 0x51, 0xFF, 0x73, 0x69, 0xFF, 0xDE, 0xF4, 0xFF, 0x71, 0x5A, 0xFF, 0x76, 0x8B, 0xFF, 0xFE, 0xFF, 0xFF, 0xDF, 0xFE, 0xFF, 0x14, 0x83, 0xFF, 0x0C, 0x52, 0xFF, 0x8F, 0x62, 0xFF, 0x4D, 0x52, 0xFF, 0x6B, 0x42, 0xFF, 0xE9, 0x32, 0xFF, 0x28, 0x2A, 0xFF, 0x0F, 0x64, 0xFF, 0x6F, 0x6B, 0xFF, 0xCD, 0x4B, 0xFF, 0x0A, 0x3B, 0xFF, 0x29, 0x3B, 0xFF, 0xE9, 0x32, 0xFF, 0x0C, 0x44, 0xFF, 0x08, 0x33, 0xFF, 0xC8, 0x2A, 0xFF, 0x4C, 0x4C, 0xFF, 0x0B, 0x4C, 0xFF, 0x08, 0x1C, 0xFF, 0x67, 0x2B, 0xFF, 0xA8, 0x2B, 0xFF, 0x6B, 0x4C, 0xFF, 0xA7, 0x23, 0xFF, 0xE7, 0x23, 0xFF, 0x66, 0x1B, 0xFF, 0x68, 0x24, 0xFF, 0x48, 0x2C, 0xFF, 0x6B, 0x45, 0xFF, 0x0A, 0x35, 0xFF,
-    0x48, 0x2C, 0xFF, 0x6B, 0x4D, 0xFF, 0x07, 0x24, 0xFF, 0x48, 0x1D, 0xFF, 0x2A, 0x35, 0xFF, 0x6B, 0x4D, 0xFF, 0x53, 0x7F, 0xFF, 0xCC, 0x45, 0xFF, 0xEF, 0x5E, 0xFF, 0xE8, 0x34, 0xFF, 0xCF, 0x56, 0xFF, 0xAD, 0x46, 0xFF, 0xEB, 0x3D, 0xFF, 0x89, 0x35, 0xFF, 0x2E, 0x67, 0xFF, 0x0C, 0x47, 0xFF, 0x2A, 0x3E, 0xFF, 0xEC, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x3E, 0xFF, 0xA9, 0x2D, 0xFF, 0xE9, 0x3C, 0xFF, 0xF7, 0xB7, 0xFF, 0x88, 0x44, 0xFF, 0x67, 0x3C, 0xFF, 0x2D, 0x66, 0xFF, 0x88, 0x44, 0xFF, 0x08, 0x45, 0xFF, 0x05, 0x2C, 0xFF, 0xA8, 0x44, 0xFF, 0xC8, 0x4C, 0xFF, 0xC8, 0x4C, 0xFF, 0x2B, 0x4A, 0xFF, 0x27, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0x4C, 0x52, 0xFF, 0xEC, 0x49, 0xFF, 0x70, 0x5A, 0xFF, 0x4A, 0x39, 0xFF, 0x4C, 0x41, 0xFF, 0x73, 0x81, 0xFF, 0xED, 0x41, 0xFF, 0xEE, 0x51, 0xFF, 0x6F, 0x51, 0xFF, 0xFE, 0xB9, 0xFF, 0xD9, 0xA0, 0xFF, 0xF5, 0x7A, 0xFF, 0x6B, 0x39, 0xFF, 0x2D, 0x52, 0xFF, 0x6E, 0x59, 0xFF, 0x73, 0x73, 0xFF, 0xF6, 0x9A, 0xFF, 0x2B, 0x42, 0xFF, 0x0A, 0x3A, 0xFF, 0xCF, 0x53, 0xFF, 0x4B, 0x3A, 0xFF, 0x48, 0x2A, 0xFF, 0x29, 0x2A, 0xFF, 0xAC, 0x4A, 0xFF, 0x0B, 0x3B, 0xFF, 0x89, 0x32, 0xFF, 0xA9, 0x32, 0xFF, 0x4C, 0x53, 0xFF, 0x2C, 0x4C, 0xFF,
-    0x09, 0x33, 0xFF, 0x8D, 0x53, 0xFF, 0x09, 0x33, 0xFF, 0xA9, 0x33, 0xFF, 0x8D, 0x54, 0xFF, 0x07, 0x1C, 0xFF, 0x06, 0x23, 0xFF, 0x27, 0x23, 0xFF, 0x0A, 0x44, 0xFF, 0x05, 0x1B, 0xFF, 0x86, 0x13, 0xFF, 0x67, 0x23, 0xFF, 0x4D, 0x4D, 0xFF, 0x4D, 0x6D, 0xFF, 0x30, 0x5E, 0xFF, 0xEA, 0x34, 0xFF, 0x48, 0x2C, 0xFF, 0x09, 0x2D, 0xFF, 0x2A, 0x55, 0xFF, 0x6B, 0x4D, 0xFF, 0x6A, 0x3D, 0xFF, 0x68, 0x2C, 0xFF, 0x96, 0x7F, 0xFF, 0x8D, 0x4E, 0xFF, 0xC8, 0x24, 0xFF, 0xC8, 0x2C, 0xFF, 0x4A, 0x2E, 0xFF, 0xFF, 0xCF, 0xFF, 0xEE, 0x47, 0xFF, 0xEA, 0x2D, 0xFF, 0x6C, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x87, 0xFF, 0xAC, 0x4E, 0xFF, 0x8B, 0x46, 0xFF, 0x6B, 0x4E, 0xFF, 0xEA, 0x45, 0xFF, 0xFE, 0xC7, 0xFF, 0x28, 0x45, 0xFF, 0x06, 0x2C, 0xFF, 0xF4, 0x97, 0xFF, 0xA8, 0x44, 0xFF, 0xA9, 0x44, 0xFF, 0x26, 0x34, 0xFF, 0x0A, 0x4D, 0xFF, 0xE9, 0x44, 0xFF, 0x4A, 0x55, 0xFF, 0xC9, 0x39, 0xFF, 0x28, 0x21, 0xFF, 0x28, 0x29, 0xFF, 0x29, 0x29, 0xFF, 0xAA, 0x39, 0xFF, 0x09, 0x31, 0xFF, 0xFD, 0xE9, 0xFF, 0x2B, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x8C, 0x39, 0xFF, 0x90, 0x49, 0xFF, 0xB7, 0x9B, 0xFF, 0x6D, 0x41, 0xFF, 0x2E, 0x49, 0xFF, 0x71, 0x51, 0xFF, 0x8A, 0x31, 0xFF,
-    0x0B, 0x32, 0xFF, 0x69, 0x29, 0xFF, 0x74, 0x6A, 0xFF, 0x32, 0x5A, 0xFF, 0x10, 0x5B, 0xFF, 0xAE, 0x4B, 0xFF, 0x6C, 0x42, 0xFF, 0x09, 0x32, 0xFF, 0x28, 0x2A, 0xFF, 0x6A, 0x3A, 0xFF, 0xED, 0x43, 0xFF, 0x28, 0x22, 0xFF, 0xAB, 0x42, 0xFF, 0x89, 0x3A, 0xFF, 0x67, 0x22, 0xFF, 0x8C, 0x4C, 0xFF, 0x87, 0x22, 0xFF, 0xC9, 0x3A, 0xFF, 0x2B, 0x43, 0xFF, 0x4C, 0x44, 0xFF, 0x8B, 0x44, 0xFF, 0x29, 0x34, 0xFF, 0xC6, 0x1A, 0xFF, 0x07, 0x23, 0xFF, 0x68, 0x33, 0xFF, 0x29, 0x34, 0xFF, 0x46, 0x23, 0xFF, 0x46, 0x1B, 0xFF, 0xE8, 0x3B, 0xFF, 0x4C, 0x55, 0xFF, 0x2C, 0x45, 0xFF, 0xAA, 0x34, 0xFF, 0x0E, 0x85, 0xFF, 0x89, 0x2C, 0xFF, 0xD9, 0x7F, 0xFF, 0xCB, 0x35, 0xFF, 0x2A, 0x55, 0xFF, 0x67, 0x2C, 0xFF, 0xAF, 0x47, 0xFF, 0xFF, 0xDF, 0xFF, 0x2C, 0x37, 0xFF, 0xE8, 0x24, 0xFF, 0xC9, 0x25, 0xFF, 0xD6, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x37, 0xFF, 0x69, 0x35, 0xFF, 0xC9, 0x35, 0xFF, 0xF4, 0x77, 0xFF, 0xF4, 0x6F, 0xFF, 0xFC, 0xD7, 0xFF, 0xFD, 0xD7, 0xFF, 0x8B, 0x4E, 0xFF, 0x89, 0x45, 0xFF, 0x4E, 0x5F, 0xFF, 0xFD, 0xCF, 0xFF, 0xFC, 0xCF, 0xFF, 0x87, 0x34, 0xFF, 0x09, 0x4D, 0xFF, 0x8A, 0x4D, 0xFF, 0x4A, 0x4D, 0xFF, 0xC9, 0x44, 0xFF, 0x6B, 0x5D, 0xFF, 0xE9, 0x4C, 0xFF,
-    0x07, 0x21, 0xFF, 0x4A, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0x4B, 0x31, 0xFF, 0x89, 0x28, 0xFF, 0x8C, 0x40, 0xFF, 0x2C, 0x39, 0xFF, 0xF1, 0x68, 0xFF, 0x0C, 0x39, 0xFF, 0x0C, 0x39, 0xFF, 0xD1, 0x61, 0xFF, 0xF7, 0x81, 0xFF, 0x0D, 0x41, 0xFF, 0x4D, 0x49, 0xFF, 0xD0, 0x59, 0xFF, 0x2D, 0x42, 0xFF, 0x95, 0x59, 0xFF, 0x3F, 0xFF, 0xFF, 0x8F, 0x4B, 0xFF, 0x2F, 0x4C, 0xFF, 0xF0, 0x5A, 0xFF, 0xEA, 0x31, 0xFF, 0xA9, 0x29, 0xFF, 0x0A, 0x32, 0xFF, 0xEF, 0x4C, 0xFF, 0x8C, 0x42, 0xFF, 0xCC, 0x4A, 0xFF, 0x8A, 0x3A, 0xFF, 0xCB, 0x42, 0xFF, 0xAD, 0x44, 0xFF, 0x66, 0x22, 0xFF, 0x48, 0x2A, 0xFF, 0x87, 0x2A, 0xFF, 0xE9, 0x32, 0xFF, 0x49, 0x33, 0xFF, 0x8D, 0x4C, 0xFF, 0x8A, 0x3C, 0xFF, 0x86, 0x1A, 0xFF, 0xC7, 0x22, 0xFF, 0x27, 0x2B, 0xFF, 0x8E, 0x55, 0xFF, 0xA7, 0x2B, 0xFF, 0x06, 0x23, 0xFF, 0x86, 0x23, 0xFF, 0x29, 0x3C, 0xFF, 0x8D, 0x46, 0xFF, 0xA6, 0x14, 0xFF, 0xE7, 0x2B, 0xFF, 0x28, 0x2C, 0xFF, 0x26, 0x24, 0xFF, 0xFF, 0xDF, 0xFF, 0x2F, 0x57, 0xFF, 0xCB, 0x55, 0xFF, 0x2F, 0x5F, 0xFF, 0x0C, 0x2F, 0xFF, 0xB9, 0x77, 0xFF, 0xCA, 0x3D, 0xFF, 0x8A, 0x35, 0xFF, 0xAC, 0x3E, 0xFF, 0xB8, 0xAF, 0xFF, 0xD7, 0x7F, 0xFF, 0x48, 0x25, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x4E, 0xFF, 0x0D, 0x5F, 0xFF, 0xF5, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x45, 0xFF, 0xEC, 0x6E, 0xFF, 0xEA, 0x55, 0xFF, 0xC5, 0x2C, 0xFF, 0xFF, 0xF7, 0xFF, 0x69, 0x4D, 0xFF, 0x6A, 0x4D, 0xFF, 0x8A, 0x55, 0xFF, 0xC8, 0x34, 0xFF, 0x8A, 0x55, 0xFF, 0xA6, 0x18, 0xFF, 0x09, 0x29, 0xFF, 0x0A, 0x31, 0xFF, 0x2A, 0x31, 0xFF, 0x50, 0x5B, 0xFF, 0x78, 0x81, 0xFF, 0x31, 0x62, 0xFF, 0xB9, 0x91, 0xFF, 0xD5, 0x81, 0xFF, 0x77, 0x73, 0xFF, 0x4E, 0x41, 0xFF, 0x17, 0x8A, 0xFF, 0xF6, 0x70, 0xFF, 0xBF, 0xFF, 0xFF, 0xD5, 0x71, 0xFF, 0x94, 0x6A, 0xFF, 0x73, 0x72, 0xFF, 0x8D, 0x39, 0xFF, 0x8B, 0x31, 0xFF, 0x4A, 0x31, 0xFF, 0xB0, 0x4A, 0xFF, 0x69, 0x29, 0xFF, 0xC9, 0x31, 0xFF, 0x8E, 0x5A, 0xFF, 0xEF, 0x5A, 0xFF, 0x28, 0x2A, 0xFF, 0x29, 0x32, 0xFF, 0x28, 0x2A, 0xFF, 0x0C, 0x43, 0xFF, 0x69, 0x32, 0xFF, 0xEC, 0x52, 0xFF, 0x67, 0x2A, 0xFF, 0x4A, 0x43, 0xFF, 0x87, 0x2A, 0xFF, 0x26, 0x1A, 0xFF, 0xEC, 0x4B, 0xFF, 0x2A, 0x43, 0xFF, 0x4B, 0x44, 0xFF, 0xE7, 0x2A, 0xFF, 0xA6, 0x22, 0xFF, 0xE7, 0x2A, 0xFF, 0xC6, 0x22, 0xFF, 0x47, 0x23, 0xFF, 0xC5, 0x1A, 0xFF, 0x87, 0x2B, 0xFF, 0x8B, 0x54, 0xFF, 0xC7, 0x2B, 0xFF, 0xC8, 0x3B, 0xFF,
-    0xC7, 0x23, 0xFF, 0xAA, 0x4C, 0xFF, 0x07, 0x34, 0xFF, 0x4A, 0x35, 0xFF, 0xFC, 0xF7, 0xFF, 0x4B, 0x55, 0xFF, 0x0D, 0x5E, 0xFF, 0xB9, 0xD7, 0xFF, 0xE8, 0x3C, 0xFF, 0xE8, 0x34, 0xFF, 0x29, 0x3D, 0xFF, 0x4A, 0x3D, 0xFF, 0x8A, 0x3D, 0xFF, 0x47, 0x2D, 0xFF, 0x90, 0x6F, 0xFF, 0x68, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x56, 0xFF, 0xED, 0x76, 0xFF, 0xF9, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0x86, 0xFF, 0xA9, 0x4D, 0xFF, 0x66, 0x2C, 0xFF, 0xA9, 0x4D, 0xFF, 0xD5, 0x7F, 0xFF, 0x49, 0x4D, 0xFF, 0x29, 0x4D, 0xFF, 0x25, 0x24, 0xFF, 0x8F, 0x5F, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0x89, 0x28, 0xFF, 0x71, 0x61, 0xFF, 0x71, 0x59, 0xFF, 0x56, 0x81, 0xFF, 0x5F, 0xFF, 0xFF, 0x18, 0xA1, 0xFF, 0xD1, 0x50, 0xFF, 0x7A, 0x89, 0xFF, 0x5F, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x69, 0xFF, 0x75, 0x72, 0xFF, 0x4C, 0x31, 0xFF, 0x4E, 0x4A, 0xFF, 0x0C, 0x42, 0xFF, 0xB0, 0x52, 0xFF, 0x91, 0x62, 0xFF, 0x0B, 0x3A, 0xFF, 0xCA, 0x31, 0xFF, 0x0C, 0x42, 0xFF, 0xEE, 0x4A, 0xFF, 0x4A, 0x32, 0xFF, 0x2A, 0x32, 0xFF, 0x2B, 0x3A, 0xFF, 0x2C, 0x4B, 0xFF, 0x8B, 0x3A, 0xFF, 0x28, 0x2A, 0xFF, 0xE6, 0x21, 0xFF, 0x48, 0x2A, 0xFF,
-    0x67, 0x22, 0xFF, 0xEB, 0x4A, 0xFF, 0xEA, 0x3A, 0xFF, 0xA7, 0x2A, 0xFF, 0xCB, 0x4B, 0xFF, 0x0A, 0x44, 0xFF, 0x66, 0x22, 0xFF, 0x66, 0x22, 0xFF, 0xA6, 0x2A, 0xFF, 0x65, 0x1A, 0xFF, 0x2A, 0x3C, 0xFF, 0xC5, 0x1A, 0xFF, 0xEB, 0x5B, 0xFF, 0x8A, 0x4C, 0xFF, 0x88, 0x2B, 0xFF, 0x67, 0x2B, 0xFF, 0xA7, 0x33, 0xFF, 0x0B, 0x55, 0xFF, 0x45, 0x23, 0xFF, 0x0E, 0x76, 0xFF, 0x07, 0x34, 0xFF, 0x07, 0x2C, 0xFF, 0xED, 0x5D, 0xFF, 0x0A, 0x76, 0xFF, 0xA7, 0x34, 0xFF, 0x88, 0x34, 0xFF, 0x07, 0x2D, 0xFF, 0x6B, 0x66, 0xFF, 0xCB, 0x45, 0xFF, 0xC7, 0x2C, 0xFF, 0xEA, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x4E, 0xFF, 0xCE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x87, 0xFF, 0xCD, 0x76, 0xFF, 0xAC, 0x66, 0xFF, 0xB5, 0xBF, 0xFF, 0x2D, 0x6F, 0xFF, 0x08, 0x45, 0xFF, 0x8A, 0x55, 0xFF, 0x49, 0x4D, 0xFF, 0x29, 0x4D, 0xFF, 0xEB, 0x55, 0xFF, 0xC8, 0x44, 0xFF, 0x28, 0x45, 0xFF, 0xA7, 0x18, 0xFF, 0x4E, 0x49, 0xFF, 0xEB, 0x28, 0xFF, 0xB1, 0x51, 0xFF, 0x0E, 0x49, 0xFF, 0xB0, 0x50, 0xFF, 0x3F, 0xDA, 0xFF, 0x92, 0x59, 0xFF, 0x36, 0x7A, 0xFF, 0xB7, 0x78, 0xFF, 0x5E, 0x91, 0xFF, 0xFB, 0xA0, 0xFF, 0x54, 0x71, 0xFF, 0x39, 0x8A, 0xFF, 0xED, 0x41, 0xFF, 0x10, 0x42, 0xFF,
-    0x8F, 0x52, 0xFF, 0xF2, 0x5A, 0xFF, 0xAF, 0x5A, 0xFF, 0x27, 0x21, 0xFF, 0xEA, 0x39, 0xFF, 0x4C, 0x43, 0xFF, 0x30, 0x4B, 0xFF, 0xEA, 0x31, 0xFF, 0xA7, 0x21, 0xFF, 0x32, 0x93, 0xFF, 0xC8, 0x29, 0xFF, 0xEB, 0x4A, 0xFF, 0x28, 0x32, 0xFF, 0xF1, 0x7A, 0xFF, 0xC6, 0x19, 0xFF, 0xCC, 0x4B, 0xFF, 0xE6, 0x19, 0xFF, 0xEA, 0x42, 0xFF, 0x48, 0x32, 0xFF, 0x87, 0x2A, 0xFF, 0xAB, 0x43, 0xFF, 0x29, 0x2B, 0xFF, 0x25, 0x1A, 0xFF, 0x86, 0x2A, 0xFF, 0x66, 0x22, 0xFF, 0x44, 0x12, 0xFF, 0x2B, 0x4C, 0xFF, 0x35, 0x6F, 0xFF, 0x48, 0x33, 0xFF, 0xAB, 0x4C, 0xFF, 0xA8, 0x33, 0xFF, 0xEC, 0x54, 0xFF, 0x6A, 0x4C, 0xFF, 0x28, 0x3C, 0xFF, 0x4B, 0x55, 0xFF, 0xE7, 0x33, 0xFF, 0xCA, 0x54, 0xFF, 0x84, 0x23, 0xFF, 0x0A, 0x45, 0xFF, 0x67, 0x3C, 0xFF, 0x6A, 0x5D, 0xFF, 0x66, 0x34, 0xFF, 0xE9, 0x44, 0xFF, 0xAC, 0x46, 0xFF, 0xEA, 0x55, 0xFF, 0xA8, 0x34, 0xFF, 0x69, 0x45, 0xFF, 0xFE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x45, 0xFF, 0xCB, 0x66, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x87, 0xFF, 0xCE, 0x6F, 0xFF, 0x68, 0x4D, 0xFF, 0x87, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x5E, 0xFF, 0x93, 0x9F, 0xFF, 0x28, 0x45, 0xFF, 0x4B, 0x5E, 0xFF, 0x49, 0x55, 0xFF, 0x29, 0x55, 0xFF, 0x8A, 0x55, 0xFF,
-    0xE9, 0x28, 0xFF, 0x11, 0x62, 0xFF, 0xCA, 0x28, 0xFF, 0xCC, 0x38, 0xFF, 0xAD, 0x38, 0xFF, 0x0E, 0x41, 0xFF, 0xF8, 0x8A, 0xFF, 0x2E, 0x41, 0xFF, 0x14, 0x69, 0xFF, 0x75, 0x78, 0xFF, 0x77, 0x81, 0xFF, 0xCF, 0x38, 0xFF, 0x7A, 0x9A, 0xFF, 0x4F, 0x41, 0xFF, 0x6C, 0x31, 0xFF, 0xCC, 0x39, 0xFF, 0x11, 0x53, 0xFF, 0x4E, 0x4A, 0xFF, 0x28, 0x21, 0xFF, 0x07, 0x19, 0xFF, 0xC9, 0x29, 0xFF, 0x0F, 0x4B, 0xFF, 0x89, 0x29, 0xFF, 0xA8, 0x31, 0xFF, 0xC8, 0x29, 0xFF, 0x08, 0x2A, 0xFF, 0xAE, 0x4B, 0xFF, 0x67, 0x21, 0xFF, 0x29, 0x32, 0xFF, 0x07, 0x22, 0xFF, 0x4A, 0x32, 0xFF, 0xED, 0x53, 0xFF, 0x27, 0x2A, 0xFF, 0x28, 0x2A, 0xFF, 0x06, 0x22, 0xFF, 0x87, 0x2A, 0xFF, 0x4C, 0x54, 0xFF, 0x65, 0x22, 0xFF, 0x26, 0x22, 0xFF, 0x26, 0x22, 0xFF, 0x05, 0x12, 0xFF, 0x2B, 0x44, 0xFF, 0x69, 0x3B, 0xFF, 0x65, 0x1A, 0xFF, 0x28, 0x2B, 0xFF, 0xE6, 0x22, 0xFF, 0x47, 0x2B, 0xFF, 0xA8, 0x43, 0xFF, 0x26, 0x23, 0xFF, 0x8B, 0x54, 0xFF, 0x4B, 0x4D, 0xFF, 0xE8, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0x3C, 0xFF, 0x87, 0x44, 0xFF, 0xAD, 0x66, 0xFF, 0x08, 0x55, 0xFF, 0x45, 0x34, 0xFF, 0x46, 0x34, 0xFF, 0x88, 0x3C, 0xFF, 0xC9, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x29, 0x4D, 0xFF, 0x69, 0x4D, 0xFF,
-    0xFE, 0xFF, 0xFF, 0x2D, 0x57, 0xFF, 0x08, 0x3D, 0xFF, 0x27, 0x3D, 0xFF, 0xE8, 0x3D, 0xFF, 0xDA, 0xC7, 0xFF, 0x0A, 0x46, 0xFF, 0x65, 0x44, 0xFF, 0xF0, 0x9F, 0xFF, 0xAC, 0x5E, 0xFF, 0x6F, 0x6E, 0xFF, 0x69, 0x4D, 0xFF, 0xE8, 0x44, 0xFF, 0xE8, 0x44, 0xFF, 0xF3, 0x8F, 0xFF, 0x87, 0x3C, 0xFF, 0xC8, 0x20, 0xFF, 0xA9, 0x20, 0xFF, 0xCB, 0x30, 0xFF, 0xEB, 0x30, 0xFF, 0xAB, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xAC, 0x30, 0xFF, 0x74, 0x69, 0xFF, 0xCF, 0x48, 0xFF, 0xCD, 0x38, 0xFF, 0xCE, 0x38, 0xFF, 0xBD, 0xB1, 0xFF, 0x57, 0x81, 0xFF, 0x2E, 0x41, 0xFF, 0x4C, 0x31, 0xFF, 0xF4, 0x62, 0xFF, 0x4A, 0x31, 0xFF, 0x28, 0x21, 0xFF, 0x27, 0x21, 0xFF, 0x52, 0x62, 0xFF, 0x70, 0x53, 0xFF, 0xA9, 0x31, 0xFF, 0x88, 0x29, 0xFF, 0x09, 0x3A, 0xFF, 0x49, 0x32, 0xFF, 0x2E, 0x53, 0xFF, 0x88, 0x29, 0xFF, 0xE7, 0x21, 0xFF, 0xCB, 0x42, 0xFF, 0xA9, 0x3A, 0xFF, 0x08, 0x2A, 0xFF, 0xE8, 0x21, 0xFF, 0x0D, 0x64, 0xFF, 0x26, 0x22, 0xFF, 0x67, 0x2A, 0xFF, 0x06, 0x1A, 0xFF, 0x0B, 0x4C, 0xFF, 0x31, 0xBD, 0xFF, 0x05, 0x1A, 0xFF, 0xE4, 0x11, 0xFF, 0xE3, 0x09, 0xFF, 0xEC, 0x54, 0xFF, 0x68, 0x2B, 0xFF, 0x03, 0x0A, 0xFF, 0x47, 0x33, 0xFF, 0x27, 0x2B, 0xFF, 0xEB, 0x44, 0xFF, 0x06, 0x23, 0xFF,
-    0x84, 0x12, 0xFF, 0xAA, 0x54, 0xFF, 0xDB, 0xBF, 0xFF, 0xAC, 0x5D, 0xFF, 0x23, 0x1B, 0xFF, 0xC9, 0x54, 0xFF, 0x87, 0x34, 0xFF, 0x27, 0x65, 0xFF, 0x4C, 0x5E, 0xFF, 0x25, 0x34, 0xFF, 0x29, 0x55, 0xFF, 0x09, 0x4D, 0xFF, 0x08, 0x34, 0xFF, 0x2B, 0x4E, 0xFF, 0x09, 0x45, 0xFF, 0x4A, 0x4D, 0xFF, 0x12, 0x97, 0xFF, 0xFC, 0xE7, 0xFF, 0xED, 0x66, 0xFF, 0xEB, 0x4D, 0xFF, 0x89, 0x4D, 0xFF, 0x27, 0x45, 0xFF, 0xA6, 0x2C, 0xFF, 0xE5, 0x2B, 0xFF, 0x8B, 0x75, 0xFF, 0xE6, 0x33, 0xFF, 0x44, 0x23, 0xFF, 0xAC, 0x65, 0xFF, 0xC8, 0x44, 0xFF, 0x46, 0x3C, 0xFF, 0x46, 0x34, 0xFF, 0x28, 0x45, 0xFF, 0xA8, 0x20, 0xFF, 0xA8, 0x20, 0xFF, 0xCA, 0x28, 0xFF, 0xAB, 0x28, 0xFF, 0xD0, 0x52, 0xFF, 0xEC, 0x30, 0xFF, 0x35, 0x88, 0xFF, 0xEF, 0x48, 0xFF, 0xED, 0x40, 0xFF, 0x51, 0x49, 0xFF, 0x93, 0x58, 0xFF, 0x3F, 0xFF, 0xFF, 0x93, 0x50, 0xFF, 0x0D, 0x39, 0xFF, 0x50, 0x49, 0xFF, 0x4F, 0x49, 0xFF, 0xE8, 0x20, 0xFF, 0xE7, 0x18, 0xFF, 0x90, 0x51, 0xFF, 0x09, 0x29, 0xFF, 0xF1, 0x5B, 0xFF, 0x8A, 0x29, 0xFF, 0x2B, 0x31, 0xFF, 0xD0, 0x5A, 0xFF, 0x47, 0x21, 0xFF, 0x47, 0x19, 0xFF, 0xCA, 0x39, 0xFF, 0x87, 0x21, 0xFF, 0x2B, 0x3A, 0xFF, 0x65, 0x19, 0xFF, 0x65, 0x19, 0xFF, 0x49, 0x3A, 0xFF,
-    0x0B, 0x43, 0xFF, 0x69, 0x3A, 0xFF, 0x27, 0x32, 0xFF, 0xE6, 0x21, 0xFF, 0x8A, 0x42, 0xFF, 0x46, 0x22, 0xFF, 0xE4, 0x19, 0xFF, 0xA3, 0x11, 0xFF, 0xE4, 0x19, 0xFF, 0xC6, 0x2A, 0xFF, 0xA6, 0x22, 0xFF, 0x03, 0x12, 0xFF, 0x89, 0x43, 0xFF, 0xA9, 0x53, 0xFF, 0xE6, 0x2A, 0xFF, 0x85, 0x1A, 0xFF, 0x44, 0x12, 0xFF, 0x8C, 0x5C, 0xFF, 0x66, 0x33, 0xFF, 0x06, 0x2B, 0xFF, 0xC4, 0x1A, 0xFF, 0xAE, 0x7D, 0xFF, 0xCA, 0x4C, 0xFF, 0xEA, 0x5C, 0xFF, 0x8E, 0x86, 0xFF, 0x8A, 0x4C, 0xFF, 0x27, 0x44, 0xFF, 0x89, 0x5C, 0xFF, 0x85, 0x23, 0xFF, 0x25, 0x1B, 0xFF, 0xEB, 0x5D, 0xFF, 0xC5, 0x23, 0xFF, 0xC6, 0x2B, 0xFF, 0xC6, 0x2B, 0xFF, 0xF9, 0xAF, 0xFF, 0x4E, 0x6F, 0xFF, 0xC5, 0x2B, 0xFF, 0x07, 0x34, 0xFF, 0x47, 0x34, 0xFF, 0x03, 0x1C, 0xFF, 0x06, 0x2C, 0xFF, 0x67, 0x3C, 0xFF, 0x84, 0x23, 0xFF, 0xE8, 0x44, 0xFF, 0x67, 0x3C, 0xFF, 0x6A, 0x55, 0xFF, 0xE8, 0x44, 0xFF, 0xA8, 0x44, 0xFF, 0xAA, 0x28, 0xFF, 0x90, 0x50, 0xFF, 0xCB, 0x30, 0xFF, 0xAA, 0x28, 0xFF, 0x70, 0x40, 0xFF, 0x7A, 0x88, 0xFF, 0xD0, 0x48, 0xFF, 0xCE, 0x38, 0xFF, 0x8E, 0x40, 0xFF, 0x1D, 0xB0, 0xFF, 0x5F, 0xFD, 0xFF, 0x94, 0x60, 0xFF, 0xCE, 0x40, 0xFF, 0xF7, 0x68, 0xFF, 0xD0, 0x48, 0xFF, 0xEC, 0x30, 0xFF,
-    0xC8, 0x18, 0xFF, 0xE9, 0x28, 0xFF, 0x4B, 0x29, 0xFF, 0x69, 0x29, 0xFF, 0x29, 0x29, 0xFF, 0xCE, 0x41, 0xFF, 0xAC, 0x39, 0xFF, 0x27, 0x21, 0xFF, 0xC9, 0x31, 0xFF, 0x68, 0x29, 0xFF, 0x67, 0x21, 0xFF, 0xA7, 0x21, 0xFF, 0xC7, 0x21, 0xFF, 0x4A, 0x42, 0xFF, 0x65, 0x19, 0xFF, 0x65, 0x11, 0xFF, 0x65, 0x11, 0xFF, 0x28, 0x32, 0xFF, 0xA5, 0x19, 0xFF, 0x06, 0x22, 0xFF, 0x4A, 0x4B, 0xFF, 0x47, 0x2A, 0xFF, 0xC4, 0x19, 0xFF, 0xA3, 0x11, 0xFF, 0xE4, 0x11, 0xFF, 0xE4, 0x11, 0xFF, 0x46, 0x22, 0xFF, 0x24, 0x1A, 0xFF, 0xA6, 0x2A, 0xFF, 0x88, 0x43, 0xFF, 0xC6, 0x2A, 0xFF, 0x48, 0x3B, 0xFF, 0x0A, 0x54, 0xFF, 0xA5, 0x22, 0xFF, 0x0D, 0x6D, 0xFF, 0xC6, 0x22, 0xFF, 0x6A, 0x54, 0xFF, 0xA4, 0x1A, 0xFF, 0x86, 0x33, 0xFF, 0x45, 0x2B, 0xFF, 0xCA, 0x54, 0xFF, 0x66, 0x2B, 0xFF, 0xC7, 0x33, 0xFF, 0xE9, 0x54, 0xFF, 0x85, 0x23, 0xFF, 0xC3, 0x12, 0xFF, 0x45, 0x23, 0xFF, 0x05, 0x24, 0xFF, 0xF2, 0x87, 0xFF, 0x45, 0x23, 0xFF, 0x65, 0x23, 0xFF, 0x2D, 0x6E, 0xFF, 0x48, 0x45, 0xFF, 0xE7, 0x33, 0xFF, 0x27, 0x3C, 0xFF, 0x27, 0x3C, 0xFF, 0x8B, 0x5D, 0xFF, 0x28, 0x4D, 0xFF, 0x27, 0x3C, 0xFF, 0xA7, 0x44, 0xFF, 0x09, 0x4D, 0xFF, 0x06, 0x34, 0xFF, 0xA8, 0x44, 0xFF, 0x86, 0x3C, 0xFF,
-    0xEB, 0x30, 0xFF, 0x8A, 0x28, 0xFF, 0xEC, 0x30, 0xFF, 0x78, 0x79, 0xFF, 0x2F, 0x30, 0xFF, 0x90, 0x48, 0xFF, 0xB0, 0x48, 0xFF, 0xAF, 0x40, 0xFF, 0x3F, 0xDA, 0xFF, 0xFF, 0xFA, 0xFF, 0x1A, 0x78, 0xFF, 0x11, 0x48, 0xFF, 0x1B, 0xA8, 0xFF, 0xBF, 0xC1, 0xFF, 0xCD, 0x38, 0xFF, 0x4D, 0x39, 0xFF, 0xCA, 0x20, 0xFF, 0x34, 0x5A, 0xFF, 0xE7, 0x18, 0xFF, 0x69, 0x29, 0xFF, 0x6C, 0x31, 0xFF, 0x29, 0x29, 0xFF, 0xF0, 0x5A, 0xFF, 0x27, 0x21, 0xFF, 0x07, 0x19, 0xFF, 0x25, 0x19, 0xFF, 0x46, 0x19, 0xFF, 0x66, 0x19, 0xFF, 0xC8, 0x29, 0xFF, 0x46, 0x19, 0xFF, 0x08, 0x32, 0xFF, 0x65, 0x19, 0xFF, 0x85, 0x19, 0xFF, 0xA5, 0x19, 0xFF, 0xE6, 0x21, 0xFF, 0xC5, 0x19, 0xFF, 0xA4, 0x19, 0xFF, 0x47, 0x2A, 0xFF, 0xA4, 0x11, 0xFF, 0xA4, 0x11, 0xFF, 0xC4, 0x19, 0xFF, 0xC3, 0x11, 0xFF, 0x66, 0x22, 0xFF, 0x04, 0x1A, 0xFF, 0xA6, 0x2A, 0xFF, 0x24, 0x1A, 0xFF, 0x85, 0x22, 0xFF, 0x24, 0x1A, 0xFF, 0xA5, 0x22, 0xFF, 0x26, 0x33, 0xFF, 0x02, 0x12, 0xFF, 0x47, 0x33, 0xFF, 0x0A, 0x65, 0xFF, 0xE5, 0x22, 0xFF, 0x46, 0x2B, 0xFF, 0x89, 0x44, 0xFF, 0xE4, 0x22, 0xFF, 0x46, 0x2B, 0xFF, 0x6C, 0x6D, 0xFF, 0xC4, 0x1A, 0xFF, 0x04, 0x23, 0xFF, 0xC3, 0x12, 0xFF, 0xC4, 0x1A, 0xFF, 0x04, 0x23, 0xFF,
-    0xE4, 0x2B, 0xFF, 0xA3, 0x12, 0xFF, 0x25, 0x23, 0xFF, 0x45, 0x2B, 0xFF, 0x29, 0x4D, 0xFF, 0xA6, 0x2B, 0xFF, 0x27, 0x44, 0xFF, 0xC6, 0x33, 0xFF, 0x06, 0x3C, 0xFF, 0xA8, 0x44, 0xFF, 0xA9, 0x4C, 0xFF, 0x87, 0x44, 0xFF, 0x68, 0x3C, 0xFF, 0x47, 0x3C, 0xFF, 0x67, 0x3C, 0xFF, 0x26, 0x34, 0xFF, 0x6A, 0x20, 0xFF, 0x2F, 0x41, 0xFF, 0x6F, 0x49, 0xFF, 0x4D, 0x30, 0xFF, 0x6C, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0x56, 0x72, 0xFF, 0x35, 0x61, 0xFF, 0x1B, 0x70, 0xFF, 0x15, 0x61, 0xFF, 0x73, 0x48, 0xFF, 0x98, 0x71, 0xFF, 0xD9, 0x88, 0xFF, 0x11, 0x38, 0xFF, 0x0F, 0x39, 0xFF, 0xF8, 0x69, 0xFF, 0x33, 0x52, 0xFF, 0xE9, 0x20, 0xFF, 0xE8, 0x18, 0xFF, 0x2A, 0x29, 0xFF, 0x4B, 0x29, 0xFF, 0xD0, 0x52, 0xFF, 0x07, 0x19, 0xFF, 0x07, 0x21, 0xFF, 0x2D, 0x52, 0xFF, 0x67, 0x21, 0xFF, 0xED, 0x42, 0xFF, 0x87, 0x21, 0xFF, 0x47, 0x21, 0xFF, 0x45, 0x19, 0xFF, 0x65, 0x19, 0xFF, 0x0B, 0x3B, 0xFF, 0x8A, 0x42, 0xFF, 0x86, 0x19, 0xFF, 0xC6, 0x21, 0xFF, 0xC8, 0x21, 0xFF, 0x6A, 0x43, 0xFF, 0x28, 0x2A, 0xFF, 0x83, 0x11, 0xFF, 0xA4, 0x19, 0xFF, 0x83, 0x09, 0xFF, 0x48, 0x33, 0xFF, 0x26, 0x22, 0xFF, 0xC3, 0x11, 0xFF, 0xA7, 0x32, 0xFF, 0x0B, 0x5C, 0xFF, 0x65, 0x22, 0xFF, 0x04, 0x1A, 0xFF,
-    0x27, 0x33, 0xFF, 0x27, 0x3B, 0xFF, 0xA5, 0x22, 0xFF, 0x4C, 0x7D, 0xFF, 0xF2, 0xDF, 0xFF, 0xC8, 0x43, 0xFF, 0xC5, 0x22, 0xFF, 0xA8, 0x44, 0xFF, 0xC9, 0x5C, 0xFF, 0x45, 0x33, 0xFF, 0x46, 0x2B, 0xFF, 0x25, 0x23, 0xFF, 0xA2, 0x0A, 0xFF, 0x44, 0x23, 0xFF, 0xA7, 0x44, 0xFF, 0xC4, 0x22, 0xFF, 0xC4, 0x1A, 0xFF, 0xAA, 0x4D, 0xFF, 0x27, 0x34, 0xFF, 0x05, 0x23, 0xFF, 0x45, 0x2B, 0xFF, 0x85, 0x2B, 0xFF, 0x49, 0x4D, 0xFF, 0x48, 0x44, 0xFF, 0x47, 0x44, 0xFF, 0x88, 0x4C, 0xFF, 0x48, 0x44, 0xFF, 0x09, 0x4D, 0xFF, 0xE6, 0x33, 0xFF, 0x47, 0x44, 0xFF, 0xC5, 0x2B, 0xFF, 0xA7, 0x44, 0xFF, 0x71, 0x62, 0xFF, 0x78, 0x40, 0xFF, 0x4A, 0x20, 0xFF, 0xCA, 0x28, 0xFF, 0xA9, 0x20, 0xFF, 0xD2, 0x62, 0xFF, 0x8C, 0x30, 0xFF, 0x9A, 0xAA, 0xFF, 0x6E, 0x30, 0xFF, 0xD1, 0x48, 0xFF, 0xF4, 0x51, 0xFF, 0x7F, 0xFF, 0xFF, 0xF1, 0x40, 0xFF, 0x70, 0x38, 0xFF, 0x10, 0x49, 0xFF, 0x72, 0x52, 0xFF, 0xCA, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0x8A, 0x31, 0xFF, 0x2A, 0x21, 0xFF, 0x08, 0x21, 0xFF, 0xCD, 0x49, 0xFF, 0x28, 0x21, 0xFF, 0x27, 0x21, 0xFF, 0x07, 0x19, 0xFF, 0x06, 0x11, 0xFF, 0x67, 0x21, 0xFF, 0xA8, 0x29, 0xFF, 0x45, 0x19, 0xFF, 0xC6, 0x19, 0xFF, 0x65, 0x19, 0xFF,
-    0x45, 0x11, 0xFF, 0x65, 0x19, 0xFF, 0x85, 0x19, 0xFF, 0xA5, 0x19, 0xFF, 0x2A, 0x43, 0xFF, 0x51, 0x75, 0xFF, 0x83, 0x11, 0xFF, 0x84, 0x11, 0xFF, 0x84, 0x11, 0xFF, 0x28, 0x33, 0xFF, 0x05, 0x1A, 0xFF, 0xC4, 0x11, 0xFF, 0xE4, 0x19, 0xFF, 0x2C, 0x5C, 0xFF, 0x8A, 0x54, 0xFF, 0x24, 0x1A, 0xFF, 0xAA, 0x4B, 0xFF, 0x64, 0x22, 0xFF, 0x03, 0x12, 0xFF, 0xAE, 0x7D, 0xFF, 0xD3, 0xD7, 0xFF, 0x26, 0x33, 0xFF, 0xE4, 0x2A, 0xFF, 0xF0, 0xB6, 0xFF, 0x29, 0x4D, 0xFF, 0xA4, 0x22, 0xFF, 0x4B, 0x65, 0xFF, 0xEB, 0x75, 0xFF, 0x83, 0x12, 0xFF, 0x65, 0x2B, 0xFF, 0xA3, 0x1A, 0xFF, 0x28, 0x44, 0xFF, 0xA4, 0x1A, 0xFF, 0x29, 0x44, 0xFF, 0x06, 0x34, 0xFF, 0xC3, 0x1A, 0xFF, 0x66, 0x33, 0xFF, 0x86, 0x33, 0xFF, 0xC6, 0x3B, 0xFF, 0x23, 0x1B, 0xFF, 0xC8, 0x4C, 0xFF, 0x07, 0x3C, 0xFF, 0x85, 0x2B, 0xFF, 0x27, 0x3C, 0xFF, 0xEA, 0x54, 0xFF, 0x47, 0x44, 0xFF, 0xE6, 0x33, 0xFF, 0x85, 0x2B, 0xFF, 0x8D, 0x30, 0xFF, 0x8D, 0x49, 0xFF, 0xA9, 0x20, 0xFF, 0x88, 0x20, 0xFF, 0x73, 0x62, 0xFF, 0x17, 0x71, 0xFF, 0x6A, 0x20, 0xFF, 0x8B, 0x20, 0xFF, 0x6C, 0x28, 0xFF, 0x13, 0x48, 0xFF, 0xBF, 0xF4, 0xFF, 0x32, 0x51, 0xFF, 0x4D, 0x28, 0xFF, 0x70, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x5A, 0xFF,
-    0xCA, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xA9, 0x18, 0xFF, 0xE8, 0x20, 0xFF, 0x11, 0x4B, 0xFF, 0xAE, 0x41, 0xFF, 0xE8, 0x18, 0xFF, 0x4F, 0x4A, 0xFF, 0xE6, 0x10, 0xFF, 0x8C, 0x3A, 0xFF, 0x27, 0x19, 0xFF, 0x88, 0x29, 0xFF, 0xA7, 0x29, 0xFF, 0x0A, 0x3A, 0xFF, 0x46, 0x19, 0xFF, 0x25, 0x11, 0xFF, 0x65, 0x19, 0xFF, 0x44, 0x11, 0xFF, 0x86, 0x21, 0xFF, 0x85, 0x19, 0xFF, 0x68, 0x2A, 0xFF, 0xE6, 0x21, 0xFF, 0x64, 0x11, 0xFF, 0x84, 0x11, 0xFF, 0x84, 0x11, 0xFF, 0x4B, 0x44, 0xFF, 0x05, 0x1A, 0xFF, 0xA3, 0x11, 0xFF, 0xA3, 0x11, 0xFF, 0x89, 0x43, 0xFF, 0x29, 0x44, 0xFF, 0xE3, 0x11, 0xFF, 0x24, 0x1A, 0xFF, 0x44, 0x1A, 0xFF, 0x24, 0x1A, 0xFF, 0x29, 0x44, 0xFF, 0xEC, 0x6C, 0xFF, 0xA4, 0x2A, 0xFF, 0x84, 0x22, 0xFF, 0xF3, 0xF7, 0xFF, 0xAA, 0x5C, 0xFF, 0x63, 0x22, 0xFF, 0xCD, 0x75, 0xFF, 0xCF, 0x9F, 0xFF, 0xC4, 0x1A, 0xFF, 0x84, 0x1A, 0xFF, 0x61, 0x12, 0xFF, 0x82, 0x1A, 0xFF, 0x63, 0x12, 0xFF, 0x84, 0x1A, 0xFF, 0x84, 0x1A, 0xFF, 0xE4, 0x23, 0xFF, 0x66, 0x33, 0xFF, 0xC6, 0x43, 0xFF, 0xA6, 0x3B, 0xFF, 0x47, 0x4C, 0xFF, 0x27, 0x3C, 0xFF, 0xC6, 0x33, 0xFF, 0xC7, 0x3B, 0xFF, 0xA6, 0x33, 0xFF, 0x44, 0x23, 0xFF, 0xC5, 0x33, 0xFF, 0xC6, 0x33, 0xFF, 0xA6, 0x33, 0xFF,
-    0x88, 0x18, 0xFF, 0x4B, 0x31, 0xFF, 0x88, 0x18, 0xFF, 0xCA, 0x28, 0xFF, 0xAB, 0x30, 0xFF, 0x89, 0x20, 0xFF, 0x88, 0x18, 0xFF, 0x8A, 0x20, 0xFF, 0xDF, 0xB1, 0xFF, 0xF4, 0x58, 0xFF, 0x8E, 0x30, 0xFF, 0xB0, 0x38, 0xFF, 0xD2, 0x50, 0xFF, 0xDF, 0xA0, 0xFF, 0x90, 0x30, 0xFF, 0x8C, 0x28, 0xFF, 0xB1, 0x51, 0xFF, 0x93, 0x28, 0xFF, 0xF1, 0x38, 0xFF, 0xC8, 0x18, 0xFF, 0xAE, 0x39, 0xFF, 0xC9, 0x20, 0xFF, 0x13, 0x5A, 0xFF, 0xC8, 0x18, 0xFF, 0x49, 0x29, 0xFF, 0x67, 0x21, 0xFF, 0x07, 0x19, 0xFF, 0x6C, 0x42, 0xFF, 0x46, 0x19, 0xFF, 0x67, 0x21, 0xFF, 0x46, 0x21, 0xFF, 0x29, 0x32, 0xFF, 0x25, 0x19, 0xFF, 0x44, 0x19, 0xFF, 0x65, 0x19, 0xFF, 0x44, 0x11, 0xFF, 0xC9, 0x3A, 0xFF, 0xE6, 0x21, 0xFF, 0x84, 0x19, 0xFF, 0x64, 0x19, 0xFF, 0x84, 0x19, 0xFF, 0xA7, 0x32, 0xFF, 0xE5, 0x19, 0xFF, 0x83, 0x11, 0xFF, 0xA3, 0x11, 0xFF, 0x48, 0x3B, 0xFF, 0x25, 0x22, 0xFF, 0x04, 0x1A, 0xFF, 0xE3, 0x19, 0xFF, 0x24, 0x1A, 0xFF, 0xA8, 0x43, 0xFF, 0x44, 0x22, 0xFF, 0x28, 0x54, 0xFF, 0x63, 0x22, 0xFF, 0xA4, 0x22, 0xFF, 0x69, 0x6D, 0xFF, 0xC6, 0x4B, 0xFF, 0x23, 0x1A, 0xFF, 0xC6, 0x43, 0xFF, 0x28, 0x44, 0xFF, 0x43, 0x12, 0xFF, 0x63, 0x1A, 0xFF, 0xE5, 0x22, 0xFF, 0x46, 0x33, 0xFF,
-    0xA8, 0x4C, 0xFF, 0x43, 0x1A, 0xFF, 0x43, 0x1A, 0xFF, 0x43, 0x1A, 0xFF, 0xA8, 0x44, 0xFF, 0x46, 0x33, 0xFF, 0xA4, 0x22, 0xFF, 0x24, 0x2B, 0xFF, 0x65, 0x2B, 0xFF, 0x88, 0x44, 0xFF, 0x87, 0x33, 0xFF, 0x87, 0x33, 0xFF, 0x86, 0x33, 0xFF, 0x86, 0x33, 0xFF, 0xE6, 0x3B, 0xFF, 0x07, 0x3C, 0xFF, 0xA8, 0x20, 0xFF, 0x88, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x4B, 0x28, 0xFF, 0x88, 0x18, 0xFF, 0x88, 0x20, 0xFF, 0x88, 0x18, 0xFF, 0xA9, 0x20, 0xFF, 0x8E, 0x38, 0xFF, 0x2D, 0x20, 0xFF, 0x8D, 0x28, 0xFF, 0x11, 0x30, 0xFF, 0x70, 0x38, 0xFF, 0x72, 0x30, 0xFF, 0x6E, 0x28, 0xFF, 0x8E, 0x30, 0xFF, 0xCC, 0x28, 0xFF, 0x8B, 0x20, 0xFF, 0xAA, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0xCA, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0x0E, 0x52, 0xFF, 0x28, 0x21, 0xFF, 0x07, 0x19, 0xFF, 0x07, 0x19, 0xFF, 0xAA, 0x31, 0xFF, 0x05, 0x19, 0xFF, 0x25, 0x19, 0xFF, 0x49, 0x3A, 0xFF, 0xE8, 0x29, 0xFF, 0x65, 0x19, 0xFF, 0x44, 0x19, 0xFF, 0x85, 0x19, 0xFF, 0xA5, 0x19, 0xFF, 0xA5, 0x19, 0xFF, 0x64, 0x19, 0xFF, 0x64, 0x19, 0xFF, 0xC5, 0x21, 0xFF, 0x84, 0x19, 0xFF, 0xA4, 0x11, 0xFF, 0x63, 0x11, 0xFF, 0xC4, 0x19, 0xFF, 0x86, 0x32, 0xFF, 0xE4, 0x19, 0xFF, 0xE4, 0x19, 0xFF,
-    0xE3, 0x19, 0xFF, 0x89, 0x4B, 0xFF, 0x24, 0x1A, 0xFF, 0xA5, 0x2A, 0xFF, 0x84, 0x22, 0xFF, 0x88, 0x43, 0xFF, 0xA5, 0x2A, 0xFF, 0xC1, 0x22, 0xFF, 0x8A, 0x75, 0xFF, 0xC1, 0x09, 0xFF, 0xCC, 0x7D, 0xFF, 0xEF, 0xBF, 0xFF, 0x01, 0x0A, 0xFF, 0xC7, 0x3B, 0xFF, 0xC6, 0x33, 0xFF, 0x85, 0x2B, 0xFF, 0x05, 0x2B, 0xFF, 0x67, 0x3C, 0xFF, 0x22, 0x12, 0xFF, 0x43, 0x1A, 0xFF, 0x65, 0x3B, 0xFF, 0x44, 0x2B, 0xFF, 0xC3, 0x22, 0xFF, 0xA6, 0x3B, 0xFF, 0x25, 0x2B, 0xFF, 0xE4, 0x2A, 0xFF, 0x65, 0x33, 0xFF, 0xC4, 0x22, 0xFF, 0x25, 0x2B, 0xFF, 0xA3, 0x1A, 0xFF, 0x45, 0x33, 0xFF, 0xE7, 0x3B, 0xFF, 0xA8, 0x20, 0xFF, 0x8B, 0x20, 0xFF, 0x33, 0x49, 0xFF, 0x16, 0x6A, 0xFF, 0xA9, 0x20, 0xFF, 0x2A, 0x18, 0xFF, 0xD3, 0x61, 0xFF, 0x1C, 0xA0, 0xFF, 0x71, 0x51, 0xFF, 0x9B, 0x81, 0xFF, 0x4F, 0x30, 0xFF, 0x7B, 0x70, 0xFF, 0x0D, 0x28, 0xFF, 0xD2, 0x40, 0xFF, 0x72, 0x38, 0xFF, 0x50, 0x30, 0xFF, 0x1E, 0x93, 0xFF, 0xAC, 0x28, 0xFF, 0xCB, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xCA, 0x20, 0xFF, 0x7F, 0x43, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x18, 0xFF, 0x8B, 0x31, 0xFF, 0x48, 0x29, 0xFF, 0x6E, 0x3A, 0xFF, 0x27, 0x21, 0xFF, 0x48, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0xA8, 0x29, 0xFF, 0xAB, 0x3A, 0xFF,
-    0xA6, 0x29, 0xFF, 0x86, 0x21, 0xFF, 0x24, 0x19, 0xFF, 0x65, 0x19, 0xFF, 0x0A, 0x3B, 0xFF, 0xC5, 0x21, 0xFF, 0x44, 0x19, 0xFF, 0x23, 0x11, 0xFF, 0x64, 0x19, 0xFF, 0xA7, 0x32, 0xFF, 0xA4, 0x19, 0xFF, 0x84, 0x19, 0xFF, 0xC4, 0x19, 0xFF, 0xE5, 0x21, 0xFF, 0xE4, 0x19, 0xFF, 0x83, 0x11, 0xFF, 0xC3, 0x19, 0xFF, 0xE4, 0x19, 0xFF, 0xE4, 0x19, 0xFF, 0xC5, 0x2A, 0xFF, 0x46, 0x3B, 0xFF, 0xA5, 0x32, 0xFF, 0x43, 0x22, 0xFF, 0x26, 0x44, 0xFF, 0x27, 0x54, 0xFF, 0xE5, 0x32, 0xFF, 0xCB, 0x7D, 0xFF, 0xAF, 0xAF, 0xFF, 0x40, 0x0A, 0xFF, 0xA6, 0x3B, 0xFF, 0xA5, 0x2B, 0xFF, 0x47, 0x3C, 0xFF, 0x89, 0x4C, 0xFF, 0x41, 0x0A, 0xFF, 0x23, 0x1A, 0xFF, 0x02, 0x12, 0xFF, 0x04, 0x2B, 0xFF, 0xAA, 0x5C, 0xFF, 0xA6, 0x3B, 0xFF, 0x66, 0x3B, 0xFF, 0xE5, 0x2A, 0xFF, 0xE4, 0x22, 0xFF, 0xC4, 0x22, 0xFF, 0x01, 0x12, 0xFF, 0xE4, 0x22, 0xFF, 0x04, 0x2B, 0xFF, 0x45, 0x2B, 0xFF, 0xE4, 0x22, 0xFF, 0x0B, 0x29, 0xFF, 0x4A, 0x20, 0xFF, 0x6A, 0x20, 0xFF, 0xCA, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xD8, 0x69, 0xFF, 0x6C, 0x30, 0xFF, 0x2F, 0x41, 0xFF, 0xEE, 0x40, 0xFF, 0x57, 0x60, 0xFF, 0x7E, 0xBA, 0xFF, 0x14, 0x40, 0xFF, 0x2F, 0x30, 0xFF, 0x16, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0x50, 0xFF,
-    0x90, 0x38, 0xFF, 0x6E, 0x30, 0xFF, 0x6D, 0x30, 0xFF, 0xB4, 0x51, 0xFF, 0xAB, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xAE, 0x41, 0xFF, 0xE8, 0x20, 0xFF, 0x28, 0x21, 0xFF, 0x07, 0x21, 0xFF, 0x27, 0x21, 0xFF, 0x06, 0x21, 0xFF, 0x26, 0x21, 0xFF, 0x45, 0x19, 0xFF, 0x25, 0x19, 0xFF, 0xCB, 0x42, 0xFF, 0x44, 0x19, 0xFF, 0x24, 0x19, 0xFF, 0x44, 0x19, 0xFF, 0xA8, 0x32, 0xFF, 0xA5, 0x19, 0xFF, 0x23, 0x11, 0xFF, 0x24, 0x19, 0xFF, 0x44, 0x19, 0xFF, 0x05, 0x22, 0xFF, 0xA4, 0x19, 0xFF, 0x63, 0x19, 0xFF, 0xA4, 0x19, 0xFF, 0x28, 0x3B, 0xFF, 0x68, 0x43, 0xFF, 0xA3, 0x11, 0xFF, 0xA3, 0x19, 0xFF, 0x25, 0x22, 0xFF, 0xE3, 0x19, 0xFF, 0x8C, 0x64, 0xFF, 0xC5, 0x32, 0xFF, 0x44, 0x22, 0xFF, 0xE2, 0x11, 0xFF, 0xE6, 0x4B, 0xFF, 0x88, 0x4C, 0xFF, 0x2A, 0x5C, 0xFF, 0xC8, 0x43, 0xFF, 0xAC, 0x96, 0xFF, 0x21, 0x12, 0xFF, 0x88, 0x4C, 0xFF, 0x43, 0x1B, 0xFF, 0xCA, 0x65, 0xFF, 0x29, 0x4D, 0xFF, 0xE3, 0x11, 0xFF, 0x09, 0x44, 0xFF, 0x24, 0x2B, 0xFF, 0x65, 0x33, 0xFF, 0x83, 0x1A, 0xFF, 0xE1, 0x09, 0xFF, 0xE7, 0x3B, 0xFF, 0x83, 0x1A, 0xFF, 0xA4, 0x22, 0xFF, 0x84, 0x22, 0xFF, 0xC2, 0x11, 0xFF, 0xE7, 0x3B, 0xFF, 0x65, 0x33, 0xFF, 0x46, 0x33, 0xFF, 0x84, 0x22, 0xFF,
-    0x4C, 0x39, 0xFF, 0x88, 0x20, 0xFF, 0x68, 0x18, 0xFF, 0x27, 0x10, 0xFF, 0x8D, 0x30, 0xFF, 0xB2, 0x51, 0xFF, 0x6A, 0x28, 0xFF, 0x6C, 0x30, 0xFF, 0x4C, 0x30, 0xFF, 0x30, 0x38, 0xFF, 0xBF, 0xDB, 0xFF, 0x32, 0x40, 0xFF, 0x37, 0x58, 0xFF, 0x1B, 0x60, 0xFF, 0x1C, 0x58, 0xFF, 0xB9, 0x69, 0xFF, 0x50, 0x38, 0xFF, 0x15, 0x50, 0xFF, 0x75, 0x60, 0xFF, 0x70, 0x40, 0xFF, 0xB4, 0x5A, 0xFF, 0xCB, 0x30, 0xFF, 0xAB, 0x38, 0xFF, 0xC8, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xCE, 0x4A, 0xFF, 0xE7, 0x20, 0xFF, 0x2B, 0x42, 0xFF, 0xE5, 0x18, 0xFF, 0xE5, 0x18, 0xFF, 0x06, 0x19, 0xFF, 0x04, 0x19, 0xFF, 0x24, 0x19, 0xFF, 0x24, 0x19, 0xFF, 0x24, 0x19, 0xFF, 0xA6, 0x21, 0xFF, 0xA9, 0x42, 0xFF, 0x85, 0x21, 0xFF, 0x44, 0x19, 0xFF, 0x25, 0x21, 0xFF, 0x44, 0x19, 0xFF, 0x89, 0x3B, 0xFF, 0x84, 0x19, 0xFF, 0x64, 0x21, 0xFF, 0x84, 0x19, 0xFF, 0x43, 0x11, 0xFF, 0xE9, 0x43, 0xFF, 0x83, 0x19, 0xFF, 0xC4, 0x19, 0xFF, 0xC4, 0x19, 0xFF, 0x8B, 0x6C, 0xFF, 0x8A, 0x44, 0xFF, 0x44, 0x2A, 0xFF, 0x03, 0x22, 0xFF, 0x44, 0x22, 0xFF, 0xE5, 0x3A, 0xFF, 0x42, 0x1A, 0xFF, 0x65, 0x2A, 0xFF, 0xAA, 0x5C, 0xFF, 0xE6, 0x43, 0xFF, 0xE0, 0x01, 0xFF, 0x65, 0x33, 0xFF, 0x07, 0x34, 0xFF, 0x26, 0x3C, 0xFF,
-    0x6A, 0x5D, 0xFF, 0xE0, 0x01, 0xFF, 0xA4, 0x22, 0xFF, 0x62, 0x12, 0xFF, 0xC6, 0x43, 0xFF, 0xE3, 0x2A, 0xFF, 0xC1, 0x09, 0xFF, 0x83, 0x1A, 0xFF, 0xE4, 0x2A, 0xFF, 0xE7, 0x43, 0xFF, 0x84, 0x22, 0xFF, 0xE2, 0x11, 0xFF, 0x43, 0x1A, 0xFF, 0x63, 0x1A, 0xFF, 0x26, 0x33, 0xFF, 0x05, 0x33, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xAA, 0x28, 0xFF, 0xF1, 0x48, 0xFF, 0x48, 0x20, 0xFF, 0x4A, 0x28, 0xFF, 0x6B, 0x30, 0xFF, 0x19, 0x79, 0xFF, 0x10, 0x40, 0xFF, 0x12, 0x48, 0xFF, 0x15, 0x58, 0xFF, 0x1E, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x58, 0xFF, 0x34, 0x58, 0xFF, 0x12, 0x40, 0xFF, 0x5F, 0xE6, 0xFF, 0x58, 0x68, 0xFF, 0xAE, 0x48, 0xFF, 0x8A, 0x28, 0xFF, 0x8A, 0x20, 0xFF, 0xF0, 0x49, 0xFF, 0x4E, 0x52, 0xFF, 0xA6, 0x18, 0xFF, 0x29, 0x21, 0xFF, 0xE7, 0x20, 0xFF, 0x2C, 0x3A, 0xFF, 0xE5, 0x20, 0xFF, 0xE5, 0x18, 0xFF, 0x05, 0x19, 0xFF, 0xC4, 0x10, 0xFF, 0x04, 0x11, 0xFF, 0x24, 0x19, 0xFF, 0x03, 0x11, 0xFF, 0x45, 0x21, 0xFF, 0xA9, 0x3A, 0xFF, 0x64, 0x19, 0xFF, 0x24, 0x19, 0xFF, 0x45, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0x03, 0x19, 0xFF, 0x84, 0x19, 0xFF, 0x64, 0x21, 0xFF, 0x64, 0x19, 0xFF, 0x44, 0x19, 0xFF, 0x63, 0x19, 0xFF, 0x84, 0x19, 0xFF,
-    0xA3, 0x19, 0xFF, 0xA3, 0x19, 0xFF, 0x07, 0x3B, 0xFF, 0xE4, 0x19, 0xFF, 0x24, 0x22, 0xFF, 0xE3, 0x21, 0xFF, 0x24, 0x22, 0xFF, 0x04, 0x1A, 0xFF, 0xE2, 0x19, 0xFF, 0x03, 0x1A, 0xFF, 0x03, 0x1A, 0xFF, 0x4C, 0x6D, 0xFF, 0xC1, 0x09, 0xFF, 0x85, 0x33, 0xFF, 0x86, 0x33, 0xFF, 0x69, 0x5D, 0xFF, 0xA9, 0x55, 0xFF, 0x61, 0x0A, 0xFF, 0x87, 0x3B, 0xFF, 0x05, 0x2B, 0xFF, 0x85, 0x2B, 0xFF, 0xA6, 0x3B, 0xFF, 0xA0, 0x01, 0xFF, 0x84, 0x22, 0xFF, 0xA0, 0x09, 0xFF, 0xE2, 0x11, 0xFF, 0x23, 0x1A, 0xFF, 0xC2, 0x11, 0xFF, 0x84, 0x22, 0xFF, 0xA4, 0x22, 0xFF, 0x63, 0x22, 0xFF, 0xA4, 0x22, 0xFF, 0xA6, 0x18, 0xFF, 0x66, 0x10, 0xFF, 0x67, 0x18, 0xFF, 0x67, 0x18, 0xFF, 0x68, 0x20, 0xFF, 0x0A, 0x28, 0xFF, 0x49, 0x28, 0xFF, 0x2F, 0x41, 0xFF, 0x2B, 0x28, 0xFF, 0x4D, 0x30, 0xFF, 0x32, 0x48, 0xFF, 0x17, 0x60, 0xFF, 0x1B, 0x78, 0xFF, 0x1B, 0x70, 0xFF, 0x35, 0x58, 0xFF, 0x31, 0x40, 0xFF, 0x31, 0x40, 0xFF, 0x11, 0x40, 0xFF, 0x10, 0x50, 0xFF, 0xED, 0x48, 0xFF, 0xAB, 0x28, 0xFF, 0xB3, 0x38, 0xFF, 0x8A, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x18, 0xFF, 0x2A, 0x31, 0xFF, 0x28, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0x27, 0x39, 0xFF, 0x05, 0x21, 0xFF, 0x0C, 0x5B, 0xFF,
-    0x05, 0x19, 0xFF, 0x04, 0x19, 0xFF, 0x24, 0x19, 0xFF, 0x45, 0x21, 0xFF, 0xEB, 0x52, 0xFF, 0x64, 0x19, 0xFF, 0x45, 0x21, 0xFF, 0x45, 0x21, 0xFF, 0x03, 0x19, 0xFF, 0x09, 0x43, 0xFF, 0x85, 0x21, 0xFF, 0x44, 0x29, 0xFF, 0x64, 0x19, 0xFF, 0xA4, 0x21, 0xFF, 0xA3, 0x19, 0xFF, 0x63, 0x19, 0xFF, 0x63, 0x11, 0xFF, 0xA4, 0x21, 0xFF, 0x86, 0x2A, 0xFF, 0xC3, 0x19, 0xFF, 0xC4, 0x21, 0xFF, 0xC4, 0x21, 0xFF, 0xE3, 0x21, 0xFF, 0xE9, 0x4B, 0xFF, 0x06, 0x3B, 0xFF, 0x64, 0x2A, 0xFF, 0x43, 0x22, 0xFF, 0x08, 0x4C, 0xFF, 0x80, 0x01, 0xFF, 0x86, 0x3B, 0xFF, 0xA6, 0x2B, 0xFF, 0xE8, 0x4C, 0xFF, 0x47, 0x3C, 0xFF, 0xC7, 0x3B, 0xFF, 0xE7, 0x3B, 0xFF, 0x65, 0x33, 0xFF, 0x25, 0x2B, 0xFF, 0xC2, 0x1A, 0xFF, 0x63, 0x1A, 0xFF, 0x83, 0x22, 0xFF, 0x80, 0x01, 0xFF, 0xE2, 0x11, 0xFF, 0x63, 0x1A, 0xFF, 0x84, 0x22, 0xFF, 0x44, 0x22, 0xFF, 0x84, 0x22, 0xFF, 0x84, 0x22, 0xFF, 0x43, 0x1A, 0xFF, 0x66, 0x10, 0xFF, 0x48, 0x20, 0xFF, 0x70, 0x49, 0xFF, 0x89, 0x28, 0xFF, 0x49, 0x28, 0xFF, 0x6B, 0x30, 0xFF, 0x2E, 0x38, 0xFF, 0xD5, 0x60, 0xFF, 0x2E, 0x48, 0xFF, 0x6D, 0x38, 0xFF, 0x39, 0x70, 0xFF, 0x1E, 0x99, 0xFF, 0x14, 0x50, 0xFF, 0x37, 0x68, 0xFF, 0x76, 0x60, 0xFF, 0x54, 0x58, 0xFF,
-    0xDF, 0xFF, 0xFF, 0x34, 0x60, 0xFF, 0xB0, 0x60, 0xFF, 0xAD, 0x48, 0xFF, 0x8C, 0x30, 0xFF, 0xDF, 0xF6, 0xFF, 0xCB, 0x30, 0xFF, 0xEB, 0x40, 0xFF, 0xCA, 0x38, 0xFF, 0xE8, 0x28, 0xFF, 0xFE, 0x10, 0xFF, 0x0A, 0x49, 0xFF, 0x09, 0x39, 0xFF, 0x27, 0x31, 0xFF, 0x06, 0x21, 0xFF, 0xAB, 0x42, 0xFF, 0x05, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x69, 0x3A, 0xFF, 0x24, 0x19, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x45, 0x21, 0xFF, 0x84, 0x21, 0xFF, 0x64, 0x21, 0xFF, 0x44, 0x29, 0xFF, 0x84, 0x21, 0xFF, 0x43, 0x21, 0xFF, 0x64, 0x21, 0xFF, 0x64, 0x21, 0xFF, 0x63, 0x21, 0xFF, 0x83, 0x21, 0xFF, 0x84, 0x21, 0xFF, 0xA4, 0x21, 0xFF, 0xC4, 0x21, 0xFF, 0xA3, 0x19, 0xFF, 0xA3, 0x19, 0xFF, 0xA2, 0x19, 0xFF, 0x64, 0x2A, 0xFF, 0x64, 0x2A, 0xFF, 0x63, 0x22, 0xFF, 0x84, 0x2A, 0xFF, 0xA1, 0x11, 0xFF, 0xE4, 0x2A, 0xFF, 0x86, 0x33, 0xFF, 0x26, 0x3C, 0xFF, 0xE8, 0x4C, 0xFF, 0xEA, 0x54, 0xFF, 0x06, 0x3C, 0xFF, 0x65, 0x2B, 0xFF, 0x25, 0x2B, 0xFF, 0x24, 0x2B, 0xFF, 0xA4, 0x22, 0xFF, 0x63, 0x22, 0xFF, 0x02, 0x1A, 0xFF, 0x84, 0x22, 0xFF, 0xA1, 0x09, 0xFF, 0xE2, 0x11, 0xFF, 0x03, 0x1A, 0xFF, 0x02, 0x1A, 0xFF, 0x02, 0x1A, 0xFF, 0x64, 0x22, 0xFF,
+    0x02, 0x31, 0x87, 0x92, 0x02, 0x39, 0xE2, 0x38, 0x42, 0x41, 0x43, 0x49, 0x22, 0x49, 0x47, 0xBA, 0x23, 0x59, 0x43, 0x69, 0x23, 0x71, 0x64, 0x69, 0x27, 0xCA, 0x84, 0x71, 0x84, 0x71, 0xA4, 0x71, 0xE5, 0x71, 0x64, 0x79, 0x28, 0xFA, 0x64, 0x79, 0xC5, 0x71, 0xFF, 0x87, 0x84, 0x69, 0x64, 0x99, 0xFF, 0xFF, 0x85, 0x71, 0x84, 0x69, 0x64, 0x69, 0x23, 0x69, 0x8D, 0xFE, 0x65, 0x89, 0x23, 0x61,
+    0x44, 0x59, 0x64, 0x61, 0x64, 0x69, 0xCF, 0xFF, 0x44, 0x61, 0x03, 0x59, 0x24, 0x59, 0x24, 0x59, 0xA7, 0xF9, 0x24, 0x59, 0x24, 0x51, 0x24, 0x49, 0x44, 0x51, 0x04, 0x51, 0x27, 0x92, 0x24, 0x49, 0xE3, 0x40, 0x04, 0x41, 0x04, 0x49, 0xC6, 0x79, 0x04, 0x41, 0x25, 0x49, 0x04, 0x41, 0xE3, 0x40, 0x04, 0x41, 0xC5, 0x81, 0x04, 0x39, 0xC3, 0x38, 0xE3, 0x38, 0xE3, 0x38, 0x85, 0x61, 0xE3, 0x38,
+    0xE3, 0x30, 0x04, 0x39, 0x04, 0x39, 0x04, 0x31, 0x85, 0x79, 0x24, 0x39, 0x45, 0x39, 0x45, 0x39, 0x04, 0x31, 0x65, 0x51, 0x24, 0x39, 0x45, 0x39, 0x24, 0x31, 0xA6, 0x49, 0xE3, 0x30, 0xA5, 0x71, 0x22, 0x31, 0x22, 0x39, 0xE5, 0x81, 0xE2, 0x40, 0xA4, 0x51, 0xC5, 0x59, 0x87, 0xD1, 0xE5, 0xA1, 0x22, 0x61, 0xC6, 0x99, 0x4A, 0xFB, 0xE9, 0x9A, 0x22, 0x79, 0x68, 0xFA, 0x44, 0xA1, 0x44, 0x81,
+    0x84, 0x79, 0xE5, 0x91, 0x07, 0xF2, 0xE7, 0xE9, 0x48, 0xEA, 0x45, 0x7A, 0x42, 0x61, 0xC5, 0x81, 0xE6, 0xF9, 0xC9, 0xD2, 0x43, 0x71, 0x64, 0x71, 0xE6, 0xA9, 0x85, 0x89, 0x47, 0xA2, 0xA6, 0x79, 0x65, 0x69, 0x84, 0x69, 0x44, 0x69, 0x06, 0xCA, 0x07, 0x92, 0x44, 0x61, 0x24, 0x59, 0x44, 0x69, 0x48, 0xC2, 0x45, 0x69, 0x86, 0x71, 0xA5, 0x61, 0x85, 0x71, 0x03, 0x51, 0x85, 0x71, 0x03, 0x51,
+    0xC6, 0x61, 0x89, 0x8A, 0x24, 0x49, 0x27, 0x8A, 0x04, 0x51, 0x27, 0x7A, 0x4D, 0xC3, 0x65, 0x59, 0xE4, 0x48, 0x24, 0x69, 0xE3, 0x48, 0x04, 0x41, 0xE3, 0x38, 0x04, 0x41, 0xA6, 0x89, 0xE3, 0x48, 0xC2, 0x38, 0xE3, 0x38, 0xE7, 0x61, 0xC3, 0x30, 0x48, 0x72, 0x24, 0x41, 0x24, 0x39, 0x44, 0x39, 0x45, 0x39, 0x6A, 0xBA, 0x28, 0x62, 0x24, 0x39, 0x65, 0x41, 0xC2, 0x30, 0x04, 0x49, 0xC1, 0x38,
+    0x22, 0x31, 0x22, 0x39, 0x02, 0x39, 0x02, 0x41, 0x02, 0x41, 0x83, 0x49, 0x85, 0x61, 0x23, 0x59, 0x43, 0x69, 0x23, 0x71, 0x84, 0x71, 0x03, 0x71, 0x24, 0x81, 0x04, 0xB9, 0x25, 0xF1, 0x64, 0xB1, 0x06, 0x92, 0x85, 0x91, 0x65, 0xA9, 0xA7, 0xF2, 0x85, 0xE9, 0x06, 0x8A, 0xA5, 0x81, 0x64, 0x81, 0x6A, 0xB3, 0x08, 0x83, 0xA5, 0x79, 0xE6, 0x79, 0xFE, 0xAF, 0x64, 0x79, 0xA5, 0x79, 0x64, 0x71,
+    0x44, 0x61, 0x44, 0x69, 0x64, 0x69, 0x44, 0x71, 0x44, 0x69, 0x44, 0x61, 0x24, 0x61, 0x44, 0x69, 0x44, 0x61, 0xE3, 0x58, 0x24, 0x59, 0x24, 0x51, 0x04, 0x59, 0x24, 0x59, 0x44, 0x59, 0x04, 0x51, 0x24, 0x51, 0x24, 0x49, 0x24, 0x49, 0x24, 0x49, 0x04, 0x49, 0x24, 0x49, 0x46, 0x59, 0x04, 0x49, 0x04, 0x49, 0x25, 0x49, 0xE3, 0x38, 0xC3, 0x38, 0x04, 0x41, 0xE3, 0x40, 0xE3, 0x38, 0xC2, 0x38,
+    0xA2, 0x30, 0xE3, 0x38, 0x24, 0x41, 0x04, 0x31, 0x44, 0x39, 0x24, 0x39, 0x24, 0x31, 0x45, 0x39, 0x24, 0x31, 0x25, 0x39, 0x44, 0x31, 0x04, 0x31, 0x24, 0x39, 0x24, 0x41, 0xE3, 0x38, 0x03, 0x41, 0x02, 0x31, 0x83, 0x39, 0x02, 0x39, 0x22, 0x41, 0x66, 0xAA, 0x63, 0x49, 0x02, 0x59, 0x43, 0x61, 0x44, 0x69, 0xC6, 0xF1, 0x85, 0x99, 0xE2, 0x88, 0x64, 0x99, 0x45, 0xD1, 0xFF, 0xFF, 0x65, 0xC9,
+    0xC5, 0xA9, 0x64, 0x99, 0x26, 0xCA, 0x43, 0xE9, 0x25, 0xE9, 0x86, 0x9A, 0xA5, 0x91, 0x85, 0x91, 0x66, 0xAA, 0xAD, 0xFB, 0x85, 0x91, 0x84, 0x79, 0x85, 0x89, 0xC6, 0x81, 0xC5, 0xA1, 0x65, 0x91, 0x85, 0x81, 0x85, 0x71, 0x44, 0x79, 0x47, 0xA2, 0x65, 0x79, 0x44, 0x69, 0x24, 0x69, 0x65, 0x79, 0x27, 0x92, 0x44, 0x69, 0x24, 0x59, 0x65, 0x59, 0x24, 0x59, 0xC6, 0x79, 0x45, 0x59, 0x24, 0x59,
+    0x04, 0x51, 0x04, 0x51, 0x65, 0x59, 0x46, 0x61, 0x45, 0x51, 0x04, 0x49, 0x24, 0x49, 0x45, 0x49, 0xE7, 0x79, 0xE4, 0x40, 0x04, 0x49, 0xE4, 0x40, 0x04, 0x41, 0xA5, 0x71, 0xC3, 0x40, 0x04, 0x49, 0x45, 0x51, 0xE3, 0x40, 0x85, 0x69, 0x44, 0x41, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0xA5, 0x61, 0x86, 0x51, 0x04, 0x39, 0x24, 0x39, 0xE3, 0x38, 0x44, 0x51, 0xC3, 0x38, 0x44, 0x41, 0xE2, 0x30,
+    0x02, 0x29, 0x02, 0x39, 0x23, 0x41, 0x02, 0x41, 0x03, 0x49, 0x23, 0x51, 0xC2, 0x58, 0x23, 0x61, 0x65, 0x89, 0x44, 0x99, 0x25, 0xD1, 0x45, 0xC9, 0x44, 0x99, 0x24, 0xB1, 0x44, 0xC1, 0x85, 0xE1, 0xE7, 0xEA, 0x84, 0xA1, 0x64, 0x99, 0x85, 0xB9, 0x45, 0xD9, 0xCB, 0xF2, 0xE5, 0x89, 0x85, 0x99, 0x06, 0xB2, 0xC5, 0xA1, 0xC5, 0x89, 0xA8, 0x8A, 0x87, 0x92, 0xA6, 0xA1, 0xE6, 0x99, 0x06, 0x92,
+    0x85, 0x79, 0xC6, 0x81, 0xA5, 0x99, 0x85, 0xB1, 0xA5, 0x89, 0xA6, 0x79, 0x64, 0x69, 0x85, 0x81, 0x65, 0x71, 0x44, 0x71, 0x44, 0x69, 0x45, 0x61, 0x44, 0x69, 0x45, 0x61, 0x65, 0x61, 0x24, 0x59, 0x24, 0x51, 0x25, 0x59, 0x45, 0x51, 0x45, 0x51, 0x45, 0x51, 0x45, 0x49, 0x25, 0x49, 0x04, 0x49, 0x04, 0x49, 0x04, 0x49, 0x24, 0x49, 0xE3, 0x40, 0x04, 0x41, 0x05, 0x41, 0xC3, 0x38, 0xE4, 0x40,
+    0xC3, 0x30, 0x24, 0x41, 0xC3, 0x38, 0x45, 0x41, 0x04, 0x31, 0x45, 0x39, 0x45, 0x39, 0x45, 0x39, 0x45, 0x39, 0x45, 0x39, 0x65, 0x39, 0xE3, 0x30, 0x03, 0x31, 0x44, 0x41, 0x03, 0x39, 0xE3, 0x30, 0x84, 0x49, 0x45, 0x6A, 0xE1, 0x40, 0x23, 0x49, 0x23, 0x49, 0x64, 0x71, 0x48, 0xEA, 0x43, 0x71, 0x8C, 0xFB, 0xE3, 0xC0, 0x26, 0xEA, 0x49, 0xEC, 0xE3, 0xC8, 0x65, 0xE1, 0x64, 0xB1, 0x85, 0xE9,
+    0x29, 0xF4, 0xA5, 0xB1, 0x64, 0xA1, 0x88, 0xC2, 0x85, 0xC9, 0xE6, 0xB1, 0xE6, 0xA1, 0x65, 0xC9, 0x07, 0xFA, 0x26, 0xCA, 0xC5, 0x91, 0x88, 0x92, 0x29, 0x8B, 0x45, 0xF1, 0x06, 0xDA, 0x77, 0xB7, 0xA5, 0x81, 0xC5, 0x99, 0x66, 0xD9, 0xC7, 0xF9, 0xA6, 0xC1, 0xA5, 0x81, 0x65, 0x79, 0x64, 0x91, 0x06, 0xB2, 0x86, 0xA9, 0x65, 0x71, 0x44, 0x61, 0x24, 0x69, 0xE6, 0x91, 0xA6, 0x91, 0x44, 0x69,
+    0x86, 0x61, 0x45, 0x59, 0x28, 0x82, 0x45, 0x59, 0x45, 0x59, 0x45, 0x51, 0x25, 0x51, 0xC7, 0x79, 0x25, 0x51, 0x25, 0x51, 0x04, 0x49, 0xC3, 0x38, 0xA6, 0x69, 0x25, 0x49, 0xE3, 0x40, 0xC3, 0x40, 0xE3, 0x40, 0x86, 0x61, 0xE3, 0x38, 0x04, 0x39, 0x24, 0x39, 0x44, 0x41, 0x85, 0x59, 0x45, 0x39, 0x04, 0x31, 0x03, 0x39, 0x44, 0x49, 0x85, 0x51, 0x44, 0x41, 0xE3, 0x38, 0x24, 0x39, 0xE3, 0x38,
+    0x42, 0x41, 0x05, 0x7A, 0xC8, 0xBA, 0xE2, 0x48, 0x64, 0x51, 0x23, 0x51, 0x43, 0x69, 0x26, 0xEA, 0xAA, 0xFA, 0x44, 0xC1, 0x45, 0xD1, 0x28, 0xFA, 0x05, 0xF9, 0x89, 0xF3, 0xA5, 0xA9, 0x44, 0xB1, 0xE9, 0xF2, 0x24, 0xD9, 0xD0, 0xFF, 0x85, 0xC9, 0xA6, 0xC1, 0xA5, 0xD1, 0xA4, 0x99, 0xC6, 0xF1, 0xFF, 0xFF, 0xA6, 0xD1, 0xA5, 0x99, 0xC5, 0x91, 0x27, 0xB2, 0xFD, 0xFF, 0x27, 0xFA, 0xFF, 0xF7,
+    0xC6, 0x89, 0xE6, 0xA1, 0xFE, 0xFF, 0xFF, 0xFF, 0xA6, 0xE9, 0xFF, 0x9F, 0xA6, 0x81, 0x65, 0xB1, 0xFD, 0xFF, 0x45, 0xE1, 0x85, 0x81, 0xC6, 0x71, 0x44, 0x79, 0xA6, 0xB1, 0xFD, 0xFF, 0x45, 0x79, 0x86, 0x61, 0xA6, 0x69, 0x65, 0x61, 0xAA, 0xFC, 0xA7, 0x69, 0x65, 0x59, 0x25, 0x51, 0x45, 0x51, 0x24, 0x59, 0xE7, 0xB9, 0x24, 0x51, 0x04, 0x49, 0xE4, 0x40, 0xE3, 0x48, 0x07, 0xA2, 0x04, 0x49,
+    0xE3, 0x40, 0x04, 0x39, 0xE2, 0x40, 0x03, 0x49, 0xC6, 0x91, 0x45, 0x39, 0x45, 0x41, 0x45, 0x39, 0x24, 0x39, 0x85, 0x89, 0x85, 0x51, 0xE3, 0x38, 0x03, 0x31, 0x03, 0x31, 0x65, 0x59, 0x85, 0x71, 0x43, 0x49, 0x25, 0x5A, 0xC2, 0x59, 0xE8, 0xAA, 0x43, 0x51, 0xE2, 0x60, 0xC2, 0x60, 0x27, 0xEB, 0x82, 0xE0, 0x23, 0xB9, 0xE2, 0xA0, 0x86, 0xE9, 0xDF, 0xFF, 0x28, 0xFA, 0x44, 0xB9, 0x64, 0xA9,
+    0x64, 0xA1, 0x06, 0xCA, 0x47, 0xD2, 0x45, 0xF1, 0x45, 0xF9, 0x26, 0xCA, 0xE5, 0xA9, 0xE6, 0xC1, 0x86, 0xF1, 0x85, 0xD9, 0x06, 0xBA, 0x87, 0x9A, 0x28, 0xA3, 0xA6, 0xE9, 0xE6, 0xE9, 0xC6, 0xC1, 0xA5, 0x89, 0xE5, 0x99, 0x85, 0xD1, 0xE6, 0xF9, 0xE7, 0xB9, 0x07, 0x8A, 0xC6, 0x81, 0x86, 0xC9, 0xC9, 0xFA, 0x86, 0xB1, 0xA6, 0x81, 0x07, 0x72, 0x65, 0x81, 0xE6, 0x99, 0x86, 0x99, 0xC6, 0x91,
+    0x86, 0x61, 0x86, 0x69, 0x45, 0x61, 0x68, 0xCA, 0x66, 0x61, 0x09, 0x5A, 0xC6, 0x71, 0x25, 0x61, 0x24, 0x61, 0x25, 0x51, 0x04, 0x51, 0xA6, 0x69, 0x05, 0x49, 0x04, 0x49, 0x03, 0x61, 0xE4, 0x50, 0xE3, 0x48, 0x04, 0x41, 0xC3, 0x40, 0xC3, 0x40, 0xA9, 0x7A, 0x24, 0x41, 0x65, 0x41, 0x65, 0x41, 0x45, 0x41, 0xA2, 0x40, 0x04, 0x39, 0x24, 0x39, 0x24, 0x41, 0x45, 0x41, 0x64, 0x51, 0x24, 0x49,
+    0xEA, 0xC2, 0x02, 0x31, 0x02, 0x41, 0x02, 0x51, 0x09, 0xD3, 0xC1, 0x58, 0x43, 0x61, 0x03, 0x71, 0x64, 0xB1, 0xE7, 0xF1, 0x64, 0x91, 0xA5, 0x99, 0x03, 0xC9, 0x25, 0xF9, 0xFE, 0xFF, 0x64, 0xC1, 0x84, 0xA1, 0x43, 0x99, 0x64, 0xB1, 0xEB, 0xFC, 0xDA, 0xFF, 0x64, 0xD1, 0xC5, 0xA1, 0x84, 0xB1, 0xE7, 0xF9, 0xFE, 0xFF, 0x27, 0xBA, 0x67, 0x9A, 0x26, 0x92, 0xC6, 0xB1, 0xF0, 0xFF, 0x2A, 0xE3,
+    0xA5, 0x81, 0x47, 0x92, 0x86, 0xA9, 0x27, 0xDA, 0x46, 0x9A, 0x70, 0x84, 0xE6, 0x81, 0x24, 0xB9, 0x27, 0xCA, 0x86, 0x91, 0xE6, 0x81, 0x27, 0x72, 0x85, 0x81, 0xC6, 0x81, 0xC6, 0x81, 0xC6, 0x81, 0x65, 0x69, 0xA6, 0x71, 0x85, 0x69, 0x29, 0xF2, 0x66, 0x59, 0x66, 0x61, 0x87, 0x61, 0x46, 0x61, 0xE8, 0xF9, 0x25, 0x51, 0x25, 0x51, 0x05, 0x49, 0xE4, 0x48, 0xC5, 0x89, 0x04, 0x51, 0xC3, 0x40,
+    0x24, 0x49, 0x03, 0x41, 0xC3, 0x60, 0xE3, 0x40, 0x24, 0x41, 0x85, 0x49, 0x65, 0x41, 0x48, 0x8A, 0x04, 0x41, 0x03, 0x39, 0x04, 0x39, 0x04, 0x39, 0xE6, 0x71, 0x04, 0x49, 0x44, 0x41, 0x64, 0x41, 0xC6, 0xC9, 0x02, 0x31, 0x63, 0x69, 0xA1, 0x38, 0x01, 0x59, 0x64, 0x69, 0x23, 0x51, 0x43, 0x61, 0x64, 0xB1, 0xCC, 0xE4, 0x23, 0x71, 0x44, 0x91, 0x64, 0xA1, 0x84, 0xC1, 0xA5, 0xC1, 0x85, 0xC9,
+    0x85, 0xC1, 0x43, 0x99, 0x46, 0xB2, 0xA6, 0xE9, 0xC7, 0xF2, 0xA5, 0xC9, 0x88, 0xBA, 0x25, 0x9A, 0xA5, 0xC1, 0xAA, 0xFB, 0xA5, 0xB1, 0xC9, 0xA2, 0x23, 0x91, 0xE6, 0xA9, 0xE4, 0x99, 0xE6, 0xB9, 0xE6, 0x89, 0xE6, 0x81, 0x85, 0x99, 0xC5, 0xA1, 0xA9, 0xA2, 0x6C, 0x7B, 0x07, 0x82, 0x65, 0xB9, 0x88, 0xA2, 0xC6, 0x91, 0xE6, 0x79, 0xA6, 0x71, 0x85, 0x89, 0xE8, 0x89, 0xA6, 0x89, 0xC7, 0xA1,
+    0xA6, 0x71, 0x27, 0x82, 0x04, 0x69, 0x86, 0x71, 0x17, 0x3C, 0x0C, 0x93, 0x86, 0x69, 0x96, 0x7D, 0x45, 0x61, 0x66, 0x59, 0xA5, 0x69, 0xE4, 0x50, 0xAC, 0x7A, 0xE3, 0x58, 0x65, 0x61, 0xC3, 0x50, 0xE3, 0x48, 0xC4, 0x48, 0xE3, 0x48, 0x45, 0x59, 0x24, 0x41, 0x03, 0x41, 0x46, 0x41, 0x86, 0x61, 0x24, 0x41, 0xE3, 0x38, 0x44, 0x41, 0x86, 0x41, 0x24, 0x49, 0x04, 0x41, 0x45, 0x41, 0x44, 0x41,
+    0xE2, 0x30, 0x05, 0x72, 0x22, 0x41, 0x63, 0x59, 0x43, 0x39, 0x69, 0xBA, 0x04, 0x9A, 0x43, 0x51, 0xC5, 0x79, 0x45, 0xC1, 0x27, 0xEA, 0x0C, 0xFE, 0x65, 0x81, 0x23, 0x81, 0x84, 0x81, 0x04, 0xC9, 0xDF, 0xFF, 0x24, 0xA1, 0x63, 0x91, 0x64, 0xC9, 0x06, 0xCA, 0x84, 0xA9, 0x84, 0x91, 0xE5, 0x89, 0x84, 0x91, 0x68, 0xD2, 0x64, 0x91, 0xE5, 0x89, 0x02, 0x79, 0xC5, 0xA9, 0x47, 0xBA, 0xA6, 0xB9,
+    0xE6, 0x89, 0xE6, 0x91, 0x65, 0xC1, 0x27, 0xDA, 0xC6, 0xB1, 0x8B, 0x93, 0x07, 0x8A, 0x65, 0xC1, 0x27, 0xC2, 0xC7, 0xA9, 0x68, 0x92, 0x2C, 0x8B, 0x65, 0x91, 0x27, 0xBA, 0x3D, 0xD7, 0x86, 0xA1, 0xC7, 0x81, 0x28, 0x7A, 0x27, 0x9A, 0xE8, 0x91, 0x0A, 0x6A, 0x08, 0x82, 0x66, 0x59, 0xE7, 0x99, 0x47, 0x49, 0xE8, 0x71, 0x45, 0x51, 0xA9, 0x49, 0xC7, 0x89, 0x04, 0x51, 0x04, 0x51, 0xE4, 0x48,
+    0xE4, 0x40, 0xC6, 0x79, 0xE4, 0x48, 0x04, 0x41, 0x65, 0x41, 0x03, 0x41, 0xE8, 0x71, 0x67, 0x41, 0x24, 0x39, 0x04, 0x39, 0x24, 0x51, 0x66, 0x59, 0x65, 0x41, 0x1B, 0x4F, 0x44, 0x41, 0x65, 0x49, 0x01, 0x29, 0x43, 0x39, 0x02, 0x29, 0x27, 0x82, 0x63, 0x39, 0xA4, 0x51, 0xC6, 0x61, 0x44, 0x49, 0x02, 0x51, 0x83, 0x69, 0x23, 0x61, 0x43, 0x69, 0x02, 0x71, 0x43, 0x61, 0x63, 0x61, 0x02, 0x69,
+    0xC5, 0xB9, 0x64, 0x91, 0x64, 0x89, 0xE9, 0xBA, 0x63, 0x99, 0x47, 0xA2, 0xA4, 0x89, 0x87, 0xA2, 0xC7, 0xE9, 0xA4, 0x99, 0xA4, 0x81, 0x84, 0x81, 0x43, 0xA1, 0x86, 0xF1, 0xE7, 0xE9, 0xE5, 0xC1, 0xE6, 0x89, 0xE6, 0xA1, 0x47, 0xF1, 0x96, 0xFF, 0xE7, 0xE9, 0x9D, 0xC7, 0x06, 0x92, 0x66, 0xF1, 0x28, 0xF2, 0xA7, 0xE9, 0xC9, 0x92, 0xDB, 0xB6, 0xC7, 0xA9, 0x4A, 0xFA, 0x6C, 0xFC, 0xA7, 0xE1,
+    0x08, 0x82, 0xE8, 0x81, 0xC8, 0xA1, 0xA9, 0xF9, 0x09, 0xAA, 0x87, 0x69, 0xC8, 0x69, 0x6C, 0x6A, 0xDF, 0x77, 0xC8, 0x79, 0x86, 0x69, 0xFF, 0x87, 0x05, 0x59, 0x45, 0x61, 0x44, 0x61, 0xE3, 0x50, 0xE4, 0x48, 0x25, 0x49, 0x04, 0x49, 0x04, 0x51, 0x45, 0x59, 0xE4, 0x38, 0x86, 0x49, 0xA7, 0x41, 0x66, 0x39, 0x7F, 0x0D, 0xE4, 0x38, 0x66, 0x49, 0xA6, 0x41, 0x86, 0x49, 0x03, 0x39, 0x7D, 0x57,
+    0x43, 0x31, 0xA3, 0x49, 0x44, 0x6A, 0x61, 0x51, 0x24, 0x4A, 0x63, 0x41, 0x44, 0x49, 0xC8, 0x9A, 0x26, 0xC2, 0x43, 0x61, 0x26, 0x7A, 0x63, 0x51, 0xA8, 0xA2, 0x87, 0xC2, 0x64, 0x61, 0xE2, 0x60, 0x46, 0xA2, 0xC7, 0xA2, 0x02, 0x91, 0x0A, 0xEB, 0x4A, 0x9B, 0xE5, 0x81, 0xA9, 0xDA, 0xC5, 0xB9, 0xF7, 0xFF, 0x84, 0x99, 0x46, 0x92, 0x84, 0x81, 0x84, 0x91, 0xC9, 0xF3, 0x08, 0xFB, 0x85, 0xC9,
+    0x67, 0x8A, 0xA5, 0x91, 0x25, 0xF9, 0xFD, 0xFF, 0xE7, 0xF1, 0x27, 0x92, 0x07, 0x92, 0x46, 0xF9, 0xFF, 0xFF, 0xC7, 0xF9, 0x89, 0xAA, 0x89, 0x8A, 0x86, 0xC9, 0x49, 0xFA, 0xFE, 0xFF, 0x25, 0xD1, 0xAA, 0x92, 0xE7, 0x81, 0xA8, 0xE1, 0xFF, 0xFF, 0xF1, 0xC2, 0x66, 0x79, 0xC7, 0x89, 0x4F, 0x6B, 0xE9, 0xD9, 0x49, 0xDA, 0x66, 0x71, 0xA6, 0x81, 0xC7, 0x71, 0xE8, 0xC9, 0xE8, 0xE9, 0xC6, 0x71,
+    0x48, 0x7A, 0x04, 0x51, 0x24, 0x61, 0x07, 0xB2, 0x66, 0x91, 0x24, 0x51, 0x45, 0x49, 0x4B, 0x4A, 0x8C, 0x82, 0xB1, 0xFB, 0xE4, 0x38, 0x1A, 0x1E, 0x66, 0x41, 0x85, 0x51, 0x08, 0xA2, 0x24, 0x51, 0x22, 0x29, 0x02, 0x31, 0x22, 0x29, 0x02, 0x39, 0x62, 0x41, 0x42, 0x39, 0x43, 0x39, 0x42, 0x39, 0xE1, 0x30, 0x49, 0x8B, 0xE6, 0x71, 0xE1, 0x40, 0x43, 0x51, 0xC4, 0x51, 0x43, 0x51, 0xC2, 0x68,
+    0x07, 0xAA, 0x06, 0x8A, 0x09, 0x93, 0x84, 0x71, 0x64, 0x69, 0x64, 0x69, 0xA4, 0x81, 0xC5, 0x79, 0x84, 0x81, 0xE6, 0x89, 0xA5, 0x71, 0x47, 0x92, 0xA4, 0x81, 0x85, 0xB9, 0xA6, 0xC1, 0x28, 0xFA, 0x67, 0x8A, 0xE6, 0x89, 0xA6, 0xC9, 0xA6, 0xE9, 0x48, 0xBA, 0x4E, 0xAC, 0xE7, 0x91, 0x49, 0xFA, 0x08, 0xFA, 0xC7, 0xD1, 0x28, 0x92, 0x0A, 0x93, 0xC6, 0xB1, 0x08, 0xDA, 0xF9, 0xDD, 0x8B, 0xFA,
+    0xE8, 0x81, 0x49, 0x92, 0xA7, 0xD1, 0x2C, 0xF5, 0x4E, 0xB3, 0xC8, 0x79, 0x2A, 0x82, 0x88, 0xA9, 0xCD, 0xFD, 0x86, 0x81, 0xE8, 0x99, 0x04, 0x61, 0x05, 0x69, 0x4D, 0xFF, 0xE4, 0x68, 0xA7, 0x61, 0xE4, 0x50, 0x04, 0x51, 0xE7, 0xA1, 0x45, 0x71, 0x25, 0x51, 0x04, 0x49, 0x66, 0x49, 0xC7, 0x79, 0x66, 0x51, 0x87, 0x49, 0x6E, 0x33, 0x65, 0x41, 0x85, 0x61, 0xFF, 0x6F, 0x65, 0x49, 0x24, 0x41,
+    0x42, 0x29, 0xC5, 0x49, 0x43, 0x29, 0x22, 0x31, 0xE7, 0x72, 0xC8, 0x62, 0x42, 0x39, 0x43, 0x41, 0x42, 0x31, 0xE3, 0x49, 0xE4, 0x69, 0x43, 0x51, 0xA4, 0x59, 0x84, 0x49, 0x82, 0x51, 0xC8, 0xB2, 0x23, 0x71, 0x84, 0x59, 0xA4, 0x59, 0xA5, 0x71, 0xA7, 0xBA, 0x64, 0x61, 0x84, 0x69, 0xA5, 0x91, 0x27, 0x92, 0x8F, 0xFE, 0x84, 0x69, 0xE9, 0x92, 0xA5, 0x79, 0x27, 0xC2, 0x94, 0xFE, 0x07, 0xDA,
+    0xC5, 0x79, 0xC5, 0x79, 0x06, 0xBA, 0x29, 0xE3, 0x68, 0x9A, 0xC7, 0x79, 0xE6, 0x81, 0x07, 0xFA, 0xC9, 0xCA, 0xC6, 0x91, 0x07, 0x82, 0xFF, 0x9F, 0x08, 0xC2, 0xA6, 0xA1, 0xA7, 0xA1, 0x8B, 0xFA, 0xC7, 0x81, 0xE7, 0x89, 0xA7, 0xB1, 0x29, 0xCA, 0xC8, 0x89, 0xA7, 0x81, 0x86, 0x79, 0xC9, 0xF1, 0x88, 0xE1, 0x66, 0x81, 0xC3, 0x70, 0x45, 0x71, 0xE4, 0x78, 0xC8, 0xC9, 0x04, 0x79, 0x04, 0x61,
+    0xE3, 0x58, 0x04, 0x61, 0x29, 0xBA, 0x45, 0x59, 0x25, 0x51, 0x04, 0x49, 0x66, 0x49, 0xC8, 0xA1, 0x45, 0x51, 0x86, 0x51, 0x04, 0x41, 0x45, 0x49, 0x09, 0xAA, 0x44, 0x49, 0x86, 0x51, 0x08, 0x3A, 0x42, 0x21, 0xA3, 0x39, 0x43, 0x29, 0x22, 0x31, 0xE5, 0x49, 0x43, 0x29, 0xE6, 0x62, 0x09, 0x73, 0x42, 0x31, 0x01, 0x31, 0x63, 0x39, 0xC8, 0x8A, 0x47, 0x72, 0x84, 0x49, 0x63, 0x51, 0xA7, 0x62,
+    0x04, 0x7A, 0x43, 0x49, 0x06, 0x6A, 0x6D, 0x94, 0x26, 0x72, 0x47, 0x72, 0x63, 0x61, 0x46, 0x8A, 0xE6, 0x69, 0x47, 0x92, 0x84, 0x59, 0xE5, 0x79, 0x84, 0x69, 0xC5, 0x81, 0xE6, 0x79, 0x48, 0xDA, 0xC5, 0x79, 0x47, 0x72, 0x27, 0xCA, 0x47, 0xAA, 0x87, 0x82, 0xC6, 0x79, 0xE6, 0x71, 0x86, 0xD9, 0x88, 0xAA, 0xE6, 0x89, 0xE7, 0x79, 0x07, 0x8A, 0x45, 0xA1, 0x68, 0xB2, 0x85, 0x91, 0x6A, 0xEA,
+    0xA6, 0x81, 0xA6, 0x81, 0x28, 0xBA, 0x28, 0x9A, 0xA3, 0x70, 0xC7, 0x79, 0x45, 0x81, 0x87, 0xD9, 0x66, 0x91, 0xE8, 0x99, 0x45, 0x81, 0x25, 0x79, 0xEE, 0xFE, 0xCB, 0xAA, 0x86, 0x89, 0xE3, 0x60, 0x04, 0x69, 0xCB, 0xFD, 0xE4, 0x58, 0x24, 0x61, 0x45, 0x59, 0x48, 0x8A, 0x28, 0x92, 0x65, 0x51, 0x25, 0x51, 0x65, 0x59, 0x07, 0x8A, 0x03, 0x51, 0x45, 0x49, 0x04, 0x49, 0x65, 0x51, 0x04, 0x49,
+    0x42, 0x29, 0x63, 0x29, 0x63, 0x29, 0x62, 0x29, 0xE5, 0x49, 0x42, 0x29, 0x42, 0x31, 0x26, 0x62, 0xC3, 0x31, 0x83, 0x31, 0x83, 0x41, 0x84, 0x51, 0xC4, 0x51, 0x62, 0x41, 0xE5, 0x69, 0x05, 0x62, 0x25, 0x5A, 0xA4, 0x51, 0xA4, 0x51, 0x83, 0x51, 0xA7, 0x62, 0x26, 0x62, 0x43, 0x51, 0x06, 0x82, 0x26, 0x72, 0xE5, 0x71, 0xA4, 0x61, 0x64, 0x61, 0x88, 0x7A, 0x88, 0xCA, 0xA5, 0x61, 0x85, 0xA1,
+    0x46, 0x82, 0x67, 0x72, 0x07, 0xCA, 0x84, 0x71, 0x67, 0x7A, 0xA5, 0x71, 0xA5, 0x69, 0x07, 0xEA, 0x2A, 0x8B, 0x64, 0x69, 0xC6, 0x69, 0xC6, 0x79, 0x48, 0xBA, 0x27, 0xB2, 0xC6, 0xC1, 0x49, 0xD2, 0x6F, 0xB4, 0xA6, 0x89, 0x66, 0x91, 0xA7, 0xB1, 0x0C, 0xA3, 0x25, 0x79, 0x25, 0x81, 0x25, 0xA9, 0xC7, 0xA1, 0x46, 0x81, 0x24, 0x81, 0xC7, 0xA1, 0x6A, 0x82, 0xE4, 0x78, 0x24, 0x79, 0x03, 0x71,
+    0xEC, 0xA2, 0xE4, 0x60, 0x24, 0x61, 0x25, 0x69, 0xC7, 0x79, 0x04, 0x59, 0x86, 0x51, 0x45, 0x51, 0x24, 0x51, 0x86, 0x69, 0x24, 0x51, 0x65, 0x51, 0x44, 0x51, 0x65, 0x59, 0x65, 0x59, 0x45, 0x59, 0x42, 0x21, 0x43, 0x29, 0x86, 0x4A, 0x62, 0x21, 0x62, 0x39, 0x83, 0x31, 0x22, 0x29, 0x42, 0x39, 0xA8, 0x5B, 0x27, 0x4B, 0x22, 0x31, 0xC4, 0x51, 0xA3, 0x51, 0x89, 0x83, 0xC4, 0x59, 0x67, 0x82,
+    0xA3, 0x41, 0xA6, 0x5A, 0x42, 0x49, 0xE4, 0x61, 0x63, 0x41, 0x67, 0x62, 0x05, 0x5A, 0x88, 0xA2, 0x49, 0xAB, 0x06, 0x82, 0x69, 0x7B, 0xA4, 0x61, 0x84, 0x51, 0x2B, 0xDB, 0xC5, 0x69, 0x84, 0x71, 0x05, 0x6A, 0xA5, 0x59, 0xA5, 0x99, 0x88, 0xFA, 0x88, 0x7A, 0xC5, 0x71, 0xE6, 0x61, 0x45, 0xB9, 0xA8, 0xBA, 0x85, 0x71, 0xC6, 0x69, 0xC6, 0x71, 0xA5, 0xB1, 0x49, 0xFA, 0xFF, 0xFF, 0xE8, 0xD1,
+    0x27, 0x8A, 0x66, 0x91, 0x87, 0x99, 0xFE, 0xFF, 0x26, 0xD1, 0x86, 0x91, 0x4A, 0xB2, 0x87, 0xB1, 0x67, 0xF1, 0xF3, 0xFF, 0x45, 0x91, 0xC9, 0x79, 0x88, 0x91, 0x05, 0xA1, 0xE8, 0xF9, 0xA8, 0x99, 0xE3, 0x68, 0x25, 0x61, 0x86, 0x69, 0x66, 0x89, 0x29, 0xDA, 0x45, 0x59, 0x2A, 0x42, 0xE8, 0x61, 0xA6, 0x69, 0x07, 0xC2, 0x45, 0x51, 0x45, 0x51, 0x45, 0x51, 0x45, 0x59, 0x07, 0xA2, 0x86, 0x81,
+    0x83, 0x29, 0x22, 0x21, 0x64, 0x3A, 0x08, 0x53, 0x83, 0x39, 0x85, 0x42, 0xA3, 0x39, 0xA4, 0x41, 0xAA, 0xA3, 0xE6, 0x4A, 0x83, 0x29, 0xC4, 0x41, 0x84, 0x49, 0xEB, 0x94, 0x68, 0x6B, 0xA4, 0x51, 0x63, 0x31, 0xA4, 0x41, 0xE7, 0x62, 0x89, 0xAB, 0xA7, 0x6A, 0x83, 0x49, 0x87, 0x6A, 0x46, 0x7A, 0x6A, 0xA3, 0xA9, 0x8A, 0x63, 0x59, 0x46, 0x7A, 0xC5, 0x59, 0x46, 0x92, 0xC4, 0x61, 0x87, 0x82,
+    0xE5, 0x71, 0x06, 0x62, 0x84, 0x71, 0xC9, 0x9A, 0x67, 0x62, 0xC5, 0x69, 0xC6, 0x59, 0x85, 0xA1, 0x6A, 0xCB, 0xC6, 0x81, 0xE6, 0x69, 0x48, 0x7A, 0x28, 0xC2, 0xE7, 0xC9, 0x69, 0xFA, 0x69, 0xE2, 0x86, 0x81, 0x07, 0xA2, 0x67, 0xE9, 0x8B, 0xF4, 0x09, 0xC2, 0x2D, 0xAB, 0x87, 0x99, 0x0B, 0xFA, 0xFF, 0xFF, 0xA8, 0xB9, 0xE8, 0xA9, 0xFE, 0xB6, 0xA9, 0xC9, 0x90, 0xFD, 0x8B, 0xFA, 0x45, 0x99,
+    0x05, 0x71, 0x05, 0x71, 0xE8, 0x91, 0x46, 0xC1, 0x45, 0x61, 0xB4, 0x4A, 0xE8, 0x61, 0xC8, 0x99, 0x29, 0x5A, 0x7A, 0x54, 0x86, 0x59, 0x65, 0x51, 0xC6, 0x71, 0x65, 0x61, 0x65, 0x59, 0x65, 0x61, 0xA3, 0x29, 0x42, 0x21, 0xC4, 0x29, 0x63, 0x21, 0xC6, 0x5A, 0x45, 0x42, 0x05, 0x4A, 0x24, 0x42, 0x63, 0x29, 0x64, 0x42, 0x48, 0x63, 0x65, 0x4A, 0xA3, 0x39, 0xA3, 0x39, 0x04, 0x52, 0x48, 0x73,
+    0x62, 0x31, 0xA4, 0x39, 0xE4, 0x41, 0x66, 0x62, 0x08, 0x73, 0x26, 0x52, 0x28, 0x53, 0xA4, 0x59, 0x05, 0x62, 0xE7, 0x82, 0xC4, 0x51, 0x88, 0x8A, 0xA5, 0x51, 0x46, 0x7A, 0xE7, 0x8A, 0xC5, 0x69, 0x26, 0x72, 0x05, 0x52, 0xA5, 0x79, 0xE8, 0x9A, 0xC8, 0x8A, 0xE5, 0x69, 0xC5, 0x59, 0xE6, 0x91, 0xE9, 0x9A, 0x47, 0x92, 0xA5, 0x59, 0xCE, 0x93, 0xEB, 0xC2, 0x89, 0xB2, 0x28, 0x9A, 0x08, 0xCA,
+    0x28, 0x82, 0x0C, 0x73, 0x2A, 0xFA, 0x2D, 0xFB, 0xFF, 0xFF, 0x8B, 0x92, 0xD0, 0xAB, 0xD1, 0xFB, 0xDF, 0xFF, 0xE9, 0xC9, 0x46, 0xA1, 0xA9, 0xB1, 0x2B, 0xFA, 0xFD, 0xFF, 0xC5, 0xD0, 0xA7, 0xA1, 0x05, 0x89, 0x4A, 0xFA, 0xE9, 0xF9, 0x46, 0x91, 0x86, 0x71, 0x87, 0x71, 0xE8, 0x89, 0x37, 0xFD, 0xC8, 0x79, 0x08, 0x5A, 0xA7, 0x61, 0x5D, 0x75, 0xC7, 0xC1, 0x49, 0x7A, 0x08, 0x5A, 0xC6, 0x71,
+    0x83, 0x21, 0x47, 0x43, 0x83, 0x19, 0xA3, 0x29, 0x83, 0x31, 0x83, 0x21, 0x85, 0x42, 0x83, 0x29, 0xA6, 0x3A, 0xC4, 0x29, 0xE4, 0x41, 0xA9, 0x63, 0x65, 0x52, 0x83, 0x31, 0xC4, 0x41, 0x83, 0x41, 0x27, 0x63, 0xC4, 0x41, 0xA4, 0x39, 0x87, 0x62, 0x28, 0x53, 0x28, 0x6B, 0x25, 0x4A, 0x05, 0x5A, 0xE4, 0x49, 0x26, 0x52, 0x29, 0x63, 0x26, 0x62, 0xC8, 0x5A, 0xE5, 0x51, 0xA7, 0x4A, 0x83, 0x51,
+    0xC8, 0x92, 0x67, 0x52, 0x63, 0x51, 0xE5, 0x69, 0xA8, 0x6A, 0xE6, 0x69, 0xE5, 0x51, 0xA5, 0x79, 0x09, 0x83, 0x43, 0x51, 0x07, 0x5A, 0x8D, 0x83, 0xC6, 0x89, 0xCA, 0xA2, 0xB6, 0x9D, 0x89, 0xAA, 0xEB, 0x82, 0xDF, 0xE7, 0x69, 0xBA, 0xA7, 0x89, 0xCB, 0x8A, 0x09, 0x8A, 0x87, 0x91, 0xC8, 0xF9, 0x8B, 0xE2, 0x4B, 0x8A, 0xE9, 0xB9, 0x27, 0xE1, 0xFF, 0xFF, 0x26, 0xC9, 0xA9, 0xF9, 0x46, 0xB9,
+    0xAB, 0xFA, 0xFF, 0xFF, 0x25, 0x89, 0x67, 0xC1, 0x05, 0x81, 0x08, 0xC2, 0xA6, 0x79, 0x09, 0x7A, 0x86, 0x71, 0xE7, 0x69, 0x09, 0xDA, 0xA6, 0x61, 0xE7, 0x61, 0xC7, 0x71, 0x85, 0x61, 0xA6, 0x71, 0x83, 0x19, 0xA3, 0x29, 0x63, 0x19, 0x04, 0x2A, 0x62, 0x29, 0xE4, 0x29, 0xE9, 0x82, 0xA3, 0x29, 0x0A, 0x64, 0x08, 0x43, 0x05, 0x42, 0xC4, 0x39, 0xA2, 0x31, 0x68, 0x4B, 0x04, 0x42, 0xA3, 0x41,
+    0xA3, 0x29, 0x88, 0x53, 0xC4, 0x41, 0x05, 0x4A, 0xE4, 0x39, 0x28, 0x53, 0xC4, 0x41, 0x05, 0x52, 0xE4, 0x49, 0xC7, 0x52, 0x28, 0x73, 0xE5, 0x49, 0xC4, 0x41, 0x26, 0x52, 0xAD, 0x54, 0x67, 0x72, 0xC5, 0x59, 0x67, 0x62, 0x07, 0x62, 0xE5, 0x59, 0xA8, 0x62, 0xC6, 0x59, 0xE5, 0x51, 0xE6, 0x89, 0x09, 0x73, 0x47, 0x62, 0x06, 0x52, 0xAA, 0x5A, 0x07, 0x8A, 0x88, 0x8A, 0x27, 0x7A, 0xA6, 0x89,
+    0x89, 0x82, 0xA6, 0x69, 0xC7, 0x71, 0x45, 0x69, 0xC7, 0x79, 0xD0, 0x93, 0x69, 0xAA, 0x66, 0x99, 0x8B, 0xD2, 0xA7, 0x89, 0x46, 0x91, 0x08, 0xDA, 0x26, 0xC1, 0x46, 0x99, 0x45, 0xA9, 0x8C, 0xFA, 0x05, 0xD9, 0x25, 0x99, 0x65, 0x81, 0xE4, 0x98, 0x73, 0xF7, 0x45, 0x81, 0x08, 0x6A, 0x86, 0x71, 0x25, 0x79, 0x29, 0xA2, 0x66, 0x61, 0xA7, 0x69, 0xA7, 0x69, 0x86, 0x71, 0xC6, 0x81, 0xE8, 0x89,
+    0x22, 0x19, 0xC4, 0x31, 0x63, 0x19, 0xA3, 0x31, 0xA3, 0x29, 0x83, 0x21, 0x83, 0x39, 0xA3, 0x29, 0x25, 0x4A, 0xC4, 0x21, 0xE4, 0x31, 0x86, 0x3A, 0xC3, 0x31, 0x70, 0x85, 0x47, 0x4B, 0xE4, 0x41, 0xC4, 0x29, 0x04, 0x3A, 0x68, 0x53, 0xE4, 0x41, 0x05, 0x42, 0x25, 0x42, 0x25, 0x42, 0x45, 0x6A, 0x25, 0x42, 0x25, 0x42, 0x05, 0x4A, 0x66, 0x52, 0xE5, 0x41, 0x67, 0x52, 0x67, 0x5A, 0x46, 0x62,
+    0xC5, 0x59, 0x8B, 0x7B, 0xC4, 0x59, 0x26, 0x6A, 0x2A, 0x6B, 0x26, 0x72, 0x26, 0x4A, 0x84, 0x61, 0xC9, 0x62, 0xC5, 0x51, 0x27, 0x4A, 0xEE, 0x83, 0x68, 0x92, 0x88, 0x6A, 0x89, 0x6A, 0xA5, 0x71, 0xA5, 0x59, 0x48, 0x9A, 0xA6, 0x69, 0x4A, 0x7A, 0xFE, 0xAE, 0x69, 0x82, 0x86, 0x79, 0x2A, 0x92, 0xA7, 0xA1, 0x86, 0x81, 0x28, 0xB2, 0x45, 0x89, 0x66, 0x91, 0x25, 0x99, 0xC8, 0xB9, 0x46, 0xA1,
+    0x04, 0x89, 0x66, 0x89, 0xA8, 0x99, 0xE8, 0xF1, 0x87, 0xA1, 0x66, 0x79, 0xC7, 0x69, 0x29, 0xBA, 0x66, 0x79, 0x86, 0x71, 0x86, 0x59, 0x5A, 0x75, 0xE8, 0x81, 0x85, 0x79, 0x89, 0x7A, 0xA6, 0x81, 0x83, 0x19, 0xE4, 0x29, 0xC8, 0x4B, 0xC6, 0x42, 0xE3, 0x21, 0xCE, 0x74, 0xE4, 0x29, 0xE4, 0x29, 0x87, 0x4B, 0xE3, 0x21, 0x08, 0x4B, 0xC6, 0x3A, 0x27, 0x3B, 0x09, 0x64, 0xA2, 0x21, 0x48, 0x5B,
+    0x86, 0x3A, 0xE4, 0x31, 0xE4, 0x41, 0xA9, 0x6B, 0xC3, 0x31, 0xE4, 0x31, 0xA6, 0x3A, 0x04, 0x4A, 0x88, 0x73, 0xC7, 0x4A, 0x66, 0x4A, 0x25, 0x52, 0x89, 0x53, 0x87, 0x52, 0x6A, 0x83, 0x05, 0x4A, 0xC5, 0x49, 0x47, 0x52, 0xE9, 0x92, 0x08, 0x8B, 0xC9, 0x6A, 0x87, 0x6A, 0x06, 0x42, 0xA4, 0x61, 0x6B, 0x83, 0xA4, 0x49, 0x68, 0x4A, 0xFF, 0x77, 0x4C, 0xB3, 0x4B, 0x7B, 0x09, 0xB3, 0x6C, 0x83,
+    0x0A, 0x5B, 0xFF, 0xDF, 0x29, 0x6A, 0xC9, 0xD2, 0x35, 0x53, 0x69, 0x92, 0xA9, 0x8A, 0x24, 0x89, 0x8A, 0xF2, 0x69, 0xDA, 0x86, 0x81, 0x65, 0x89, 0xC7, 0xA1, 0x8A, 0xFA, 0x08, 0xFA, 0x6B, 0xD2, 0x46, 0x99, 0x6B, 0xCA, 0xC7, 0xA1, 0x0E, 0xFC, 0x25, 0x89, 0x87, 0x81, 0x45, 0x79, 0x45, 0x81, 0x45, 0x91, 0x27, 0xBA, 0x45, 0x71, 0xE3, 0x60, 0x04, 0x59, 0x66, 0x69, 0xE6, 0x99, 0x61, 0x58,
+    0x03, 0x1A, 0x25, 0x32, 0xA3, 0x19, 0xE3, 0x21, 0x2A, 0x4C, 0x88, 0x43, 0xE3, 0x21, 0xE3, 0x21, 0x85, 0x3A, 0x03, 0x1A, 0xA9, 0x53, 0x24, 0x2A, 0xAB, 0x44, 0x45, 0x32, 0x04, 0x22, 0xE9, 0x53, 0x29, 0x44, 0xA9, 0x43, 0x25, 0x3A, 0x25, 0x42, 0xA9, 0x63, 0xE4, 0x31, 0x05, 0x3A, 0x25, 0x3A, 0x69, 0x63, 0x88, 0x6B, 0x05, 0x3A, 0x4B, 0x5C, 0x49, 0x5B, 0x66, 0x4A, 0x48, 0x6B, 0x05, 0x42,
+    0xA8, 0x62, 0x26, 0x4A, 0x26, 0x4A, 0xC8, 0x6A, 0x09, 0x63, 0x05, 0x4A, 0x27, 0x42, 0x47, 0x5A, 0x6B, 0x63, 0xE6, 0x51, 0x68, 0x42, 0xB5, 0x5D, 0x4B, 0x93, 0x0C, 0x84, 0x48, 0x7A, 0x47, 0x6A, 0x6B, 0x73, 0x23, 0x41, 0xC6, 0x61, 0x48, 0x92, 0x88, 0x7A, 0x89, 0x82, 0x86, 0x69, 0x49, 0xA2, 0x8A, 0xFC, 0xC7, 0x81, 0x45, 0x79, 0xC8, 0xA1, 0x2A, 0xEA, 0xFF, 0xFF, 0x26, 0xC9, 0xC7, 0xB9,
+    0xC9, 0xD9, 0x48, 0xF9, 0xA9, 0xF9, 0x25, 0x99, 0xC9, 0xE9, 0x86, 0x99, 0xC7, 0x79, 0xE7, 0xC9, 0xE3, 0x70, 0x04, 0x81, 0x04, 0x61, 0x86, 0x71, 0xE7, 0xA9, 0x65, 0x79, 0xA7, 0x79, 0x24, 0x69, 0xC3, 0x19, 0xE3, 0x21, 0xA9, 0x3B, 0xE4, 0x21, 0xE3, 0x19, 0x85, 0x2A, 0x2A, 0x44, 0xCA, 0x5B, 0xA6, 0x32, 0x04, 0x22, 0x23, 0x22, 0x49, 0x4C, 0x45, 0x2A, 0x47, 0x3B, 0xC6, 0x32, 0xE3, 0x31,
+    0x29, 0x54, 0x2A, 0x44, 0xE7, 0x42, 0x86, 0x42, 0x25, 0x42, 0xC9, 0x5B, 0x25, 0x32, 0x25, 0x3A, 0x0B, 0x64, 0xEA, 0x4B, 0x69, 0x5B, 0xC6, 0x32, 0x46, 0x42, 0x46, 0x42, 0x66, 0x4A, 0xCE, 0x74, 0x09, 0x6B, 0x66, 0x4A, 0x8B, 0x6B, 0xC8, 0x62, 0x67, 0x4A, 0x27, 0x62, 0x47, 0x3A, 0x06, 0x42, 0x0D, 0x5C, 0x67, 0x5A, 0x88, 0x42, 0xED, 0x63, 0xC5, 0x69, 0xC9, 0x82, 0xE7, 0x59, 0xC6, 0x61,
+    0x07, 0x62, 0xE6, 0x61, 0xA9, 0x9A, 0xA6, 0x81, 0xE2, 0x48, 0x85, 0x69, 0xE7, 0x81, 0x85, 0xA1, 0xA6, 0x89, 0x45, 0x71, 0xA6, 0x91, 0x09, 0xE2, 0xFF, 0xFF, 0xE5, 0xB8, 0x26, 0xC1, 0x48, 0xE9, 0x8F, 0xFB, 0xFE, 0xFF, 0x06, 0xB1, 0x68, 0xD1, 0x68, 0xF1, 0x0B, 0xFA, 0x86, 0x91, 0x46, 0x99, 0x24, 0x81, 0x86, 0x71, 0xA8, 0xD9, 0x61, 0x58, 0xA6, 0x79, 0x45, 0x79, 0xE7, 0x89, 0x04, 0x79,
+    0xE4, 0x19, 0xDC, 0x3F, 0x04, 0x1A, 0xE3, 0x09, 0x6A, 0x34, 0x04, 0x22, 0xE3, 0x19, 0xE7, 0x4A, 0xA4, 0x1A, 0x65, 0x22, 0x44, 0x22, 0x6B, 0x4C, 0x65, 0x2A, 0x09, 0x44, 0xE3, 0x21, 0x07, 0x53, 0xE6, 0x32, 0x2B, 0x54, 0xF2, 0x76, 0xA5, 0x2A, 0xA6, 0x3A, 0x65, 0x2A, 0x6B, 0x5C, 0x25, 0x3A, 0x65, 0x3A, 0xFE, 0x77, 0x48, 0x5B, 0x07, 0x43, 0xFF, 0xFF, 0xA7, 0x42, 0x66, 0x42, 0x29, 0x5B,
+    0x86, 0x4A, 0x0C, 0x64, 0xFF, 0x9F, 0xE8, 0x4A, 0xA8, 0x4A, 0x6A, 0x6B, 0xE9, 0x42, 0x88, 0x4A, 0xD6, 0x6D, 0x26, 0x52, 0xE9, 0x4A, 0x78, 0x87, 0x67, 0x62, 0xA8, 0x7A, 0xE7, 0x61, 0x67, 0x62, 0x44, 0x49, 0x50, 0x8C, 0x69, 0x82, 0xC6, 0x69, 0x43, 0x61, 0x85, 0x69, 0x48, 0x9A, 0xA6, 0x91, 0x65, 0x79, 0xA6, 0x79, 0xE7, 0x99, 0x2A, 0xD2, 0xE8, 0xC1, 0x04, 0x91, 0x25, 0xC9, 0x73, 0xFD,
+    0x08, 0xF1, 0x67, 0xC9, 0x48, 0xE9, 0x8B, 0xF9, 0xFF, 0xFF, 0x26, 0xB9, 0x46, 0x89, 0x46, 0xB9, 0x67, 0xD1, 0x25, 0x89, 0x85, 0x71, 0x44, 0x79, 0xA6, 0x89, 0x46, 0x99, 0xC8, 0xB9, 0x65, 0xA1, 0x86, 0x22, 0x04, 0x22, 0xA6, 0x1A, 0x24, 0x1A, 0xE4, 0x19, 0xEA, 0x3C, 0xC6, 0x2A, 0x65, 0x2A, 0x24, 0x1A, 0xA9, 0x3B, 0x28, 0x24, 0x44, 0x22, 0xC6, 0x32, 0x23, 0x12, 0x09, 0x44, 0xA5, 0x32,
+    0xC4, 0x02, 0x06, 0x2B, 0xAC, 0x64, 0x27, 0x33, 0x85, 0x22, 0x85, 0x2A, 0xC6, 0x32, 0x69, 0x53, 0x86, 0x3A, 0x0B, 0x64, 0x89, 0x5B, 0xE7, 0x3A, 0xAA, 0x4B, 0xE8, 0x42, 0x08, 0x43, 0xA6, 0x42, 0x08, 0x53, 0xFB, 0x87, 0xCF, 0x54, 0xA7, 0x4A, 0xA7, 0x4A, 0x09, 0x63, 0xE9, 0x42, 0x67, 0x42, 0xD0, 0x54, 0xE5, 0x39, 0xCA, 0x42, 0x4F, 0x64, 0x48, 0x62, 0x06, 0x4A, 0x06, 0x52, 0x06, 0x62,
+    0x64, 0x41, 0x48, 0x7A, 0x07, 0x7A, 0x64, 0x59, 0x02, 0x49, 0xCA, 0x8A, 0x85, 0x61, 0xA6, 0x79, 0x85, 0x79, 0xAA, 0xA2, 0x4D, 0xCB, 0xA6, 0x81, 0x65, 0x79, 0x24, 0x91, 0xA9, 0xE1, 0x66, 0xC1, 0x26, 0xB1, 0xE5, 0xD8, 0x28, 0xE9, 0x69, 0xF1, 0x87, 0xC1, 0x67, 0xD1, 0x87, 0xC1, 0x25, 0xC1, 0x46, 0x89, 0x87, 0x89, 0x86, 0x99, 0xE4, 0xA8, 0xC8, 0xB9, 0x25, 0x89, 0x45, 0x89, 0x48, 0xF2,
+    0x86, 0x1A, 0x04, 0x22, 0xE6, 0x1A, 0x86, 0x22, 0x85, 0x12, 0x67, 0x13, 0x67, 0x23, 0x85, 0x0B, 0x36, 0x57, 0x85, 0x1A, 0xA9, 0x43, 0x45, 0x1B, 0xEC, 0x4C, 0x84, 0x22, 0xC5, 0x2A, 0x85, 0x2A, 0xEB, 0x44, 0x26, 0x2B, 0x08, 0x34, 0xC5, 0x32, 0xE9, 0x43, 0xFF, 0xF7, 0x88, 0x3B, 0xA6, 0x32, 0x03, 0x1A, 0x07, 0x3B, 0xA6, 0x42, 0x2A, 0x34, 0x4B, 0x4C, 0x08, 0x3B, 0xA6, 0x42, 0xC6, 0x32,
+    0x08, 0x53, 0x49, 0x4B, 0x29, 0x63, 0x45, 0x42, 0xAB, 0x63, 0xE5, 0x51, 0xE9, 0x42, 0x66, 0x42, 0x51, 0x6D, 0x64, 0x31, 0xA9, 0x3A, 0x4B, 0x5B, 0xA8, 0x7A, 0xE6, 0x41, 0xC5, 0x49, 0x84, 0x51, 0x88, 0x62, 0xC5, 0x49, 0xA5, 0x51, 0xA5, 0x61, 0x69, 0x82, 0x85, 0x61, 0x65, 0x59, 0xC6, 0x71, 0x89, 0x9A, 0x64, 0x71, 0x04, 0x69, 0x08, 0x8A, 0x86, 0x91, 0x86, 0x99, 0x89, 0xD2, 0x46, 0x99,
+    0xC9, 0xC1, 0x66, 0xA9, 0x67, 0xB1, 0xED, 0xFA, 0xFE, 0xFF, 0xA8, 0xB9, 0x66, 0x89, 0x46, 0x91, 0x66, 0x91, 0x67, 0xC2, 0x66, 0x89, 0x25, 0x81, 0xC7, 0x89, 0xA7, 0x99, 0x67, 0xAA, 0x65, 0x89, 0x06, 0x13, 0x7D, 0x57, 0xE6, 0x1A, 0x69, 0x3C, 0xFE, 0x4F, 0x8A, 0x35, 0xA7, 0x23, 0x67, 0x2B, 0x51, 0x4F, 0x25, 0x1B, 0x4B, 0x2D, 0x87, 0x1B, 0xE7, 0x1B, 0x25, 0x13, 0xCB, 0x4C, 0x66, 0x2B,
+    0x68, 0x2B, 0x2C, 0x45, 0x87, 0x2B, 0xAA, 0x4C, 0xCB, 0x54, 0x8B, 0x44, 0x4D, 0x3D, 0xC5, 0x1A, 0xC5, 0x22, 0x4A, 0x5C, 0x07, 0x3B, 0xCC, 0x34, 0xFF, 0xFF, 0x2A, 0x34, 0x6C, 0x6C, 0xFF, 0xFF, 0xE8, 0x4A, 0x49, 0x43, 0x94, 0x5E, 0xEB, 0x6B, 0x08, 0x3B, 0xC5, 0x39, 0xE9, 0x3A, 0xC9, 0x42, 0x2C, 0x6C, 0xA5, 0x39, 0xA8, 0x3A, 0x68, 0x4A, 0x88, 0x72, 0x06, 0x52, 0x0A, 0x9B, 0x26, 0x62,
+    0x07, 0x52, 0x06, 0x52, 0x8C, 0xA3, 0x2A, 0xA3, 0x24, 0x49, 0x64, 0x59, 0x65, 0x51, 0x27, 0x82, 0xE9, 0xB2, 0x64, 0x59, 0xE3, 0x60, 0x65, 0x81, 0xA6, 0x91, 0x89, 0xD2, 0x66, 0xA1, 0x65, 0x99, 0x66, 0x91, 0x66, 0x99, 0x28, 0xF2, 0x09, 0xD2, 0x66, 0x99, 0x87, 0x91, 0x6B, 0xFB, 0x28, 0xCA, 0x45, 0x89, 0xA7, 0x89, 0xC7, 0x91, 0x66, 0x89, 0x07, 0xB2, 0xA6, 0x89, 0xA7, 0x91, 0x65, 0x81,
+    0x44, 0x12, 0x67, 0x23, 0xAA, 0x3C, 0xA5, 0x1A, 0x47, 0x2B, 0x66, 0x13, 0xA6, 0x1B, 0x0A, 0x35, 0xDA, 0x67, 0xE8, 0x2B, 0x46, 0x13, 0x8C, 0x3D, 0x6E, 0x2E, 0x49, 0x2C, 0x10, 0x66, 0x8B, 0x44, 0x6B, 0x3D, 0x90, 0x5E, 0xA7, 0x2B, 0xCA, 0x24, 0xC9, 0x43, 0xCB, 0x4C, 0x67, 0x23, 0x88, 0x33, 0xC6, 0x22, 0xA6, 0x2A, 0x85, 0x32, 0xE7, 0x3A, 0xEA, 0x3B, 0x68, 0x33, 0x89, 0x4B, 0xEB, 0x53,
+    0x86, 0x3A, 0xE8, 0x42, 0x08, 0x5B, 0x86, 0x42, 0x86, 0x3A, 0xE5, 0x49, 0xE9, 0x3A, 0x66, 0x3A, 0x4A, 0x5B, 0xC5, 0x41, 0x27, 0x3A, 0xC9, 0x52, 0xC5, 0x49, 0x29, 0x83, 0xC5, 0x59, 0x06, 0x5A, 0xE6, 0x49, 0x47, 0x5A, 0xC9, 0x92, 0xA4, 0x61, 0x23, 0x41, 0xA6, 0x61, 0xA9, 0x92, 0xE5, 0x79, 0xA5, 0x69, 0x49, 0x8A, 0x03, 0x59, 0x85, 0x81, 0xAA, 0xCA, 0xE7, 0x99, 0xC6, 0x81, 0xA6, 0x99,
+    0x0A, 0xE2, 0xC6, 0xB1, 0x66, 0x99, 0xA7, 0xA9, 0xD2, 0xEC, 0x0A, 0xEA, 0x88, 0xB9, 0xA7, 0x91, 0x25, 0x81, 0x86, 0x89, 0x87, 0xC1, 0x86, 0x89, 0x86, 0x89, 0x86, 0x89, 0xC7, 0xA1, 0xA6, 0x91, 0xC5, 0x1A, 0x06, 0x1B, 0x6B, 0x34, 0x8C, 0x2D, 0xDD, 0x9F, 0x48, 0x14, 0xCA, 0x14, 0xFF, 0xF7, 0xFF, 0xC7, 0x6B, 0x3D, 0x51, 0x2F, 0xE7, 0x1B, 0xA6, 0x0B, 0xCA, 0x34, 0xCD, 0x4D, 0x87, 0x1B,
+    0x28, 0x1C, 0xFF, 0xFF, 0xDC, 0x97, 0x89, 0x24, 0x2B, 0x35, 0xDE, 0xB7, 0xEC, 0x44, 0x6B, 0x44, 0x6B, 0x34, 0x88, 0x2B, 0x07, 0x33, 0xEA, 0x43, 0xE7, 0x2A, 0xE7, 0x32, 0x2B, 0x4C, 0xE7, 0x42, 0xA6, 0x32, 0x66, 0x32, 0x45, 0x32, 0xC3, 0x31, 0x08, 0x53, 0xA3, 0x39, 0xA8, 0x3A, 0x83, 0x29, 0xCC, 0x63, 0x63, 0x31, 0x26, 0x3A, 0x88, 0x4A, 0x46, 0x52, 0x2A, 0x73, 0xE5, 0x49, 0x84, 0x41,
+    0x84, 0x39, 0xA8, 0x72, 0xA5, 0x51, 0x44, 0x41, 0x43, 0x41, 0xEA, 0x92, 0x4C, 0xAB, 0xA5, 0x59, 0x65, 0x61, 0x85, 0x69, 0x69, 0xA2, 0x65, 0x69, 0x65, 0x69, 0xA6, 0x81, 0x8A, 0xCA, 0x25, 0x89, 0x45, 0x89, 0x69, 0xE1, 0x50, 0xEB, 0x4D, 0xF1, 0x68, 0xD1, 0x89, 0xD9, 0x8A, 0xE9, 0x2C, 0xFB, 0x06, 0xA1, 0xA8, 0xB1, 0xA8, 0xB1, 0x46, 0xA1, 0x0A, 0xFA, 0xA7, 0x99, 0xA8, 0xA9, 0x8A, 0xE9,
+    0xC5, 0x0A, 0x8D, 0x0C, 0x6C, 0x0E, 0xCB, 0x0C, 0xF8, 0x1F, 0xAA, 0x24, 0x28, 0x04, 0xFF, 0x5F, 0x69, 0x0D, 0xE9, 0x24, 0xEA, 0x1C, 0xFF, 0x67, 0x48, 0x14, 0xCF, 0x4D, 0x89, 0x2C, 0x28, 0x1C, 0x28, 0x1C, 0x08, 0x1C, 0xE7, 0x1B, 0xEC, 0x3C, 0x6A, 0x34, 0x0C, 0x1D, 0x8E, 0x2D, 0xEC, 0x44, 0x0D, 0x55, 0xFF, 0xEF, 0x27, 0x33, 0x69, 0x43, 0xCA, 0x4B, 0xED, 0x44, 0xC6, 0x32, 0xE7, 0x3A,
+    0xC7, 0x42, 0x04, 0x2A, 0x25, 0x2A, 0xA3, 0x21, 0xE8, 0x4A, 0x83, 0x29, 0xA8, 0x42, 0x83, 0x29, 0xEC, 0x53, 0x63, 0x29, 0xE6, 0x39, 0xC9, 0x52, 0xC4, 0x39, 0x47, 0x52, 0x06, 0x42, 0xCC, 0x7B, 0xC9, 0x6A, 0x27, 0x52, 0x88, 0x62, 0x06, 0x52, 0x89, 0x7A, 0xC6, 0x61, 0x84, 0x49, 0xE6, 0x79, 0x89, 0x9A, 0x65, 0x69, 0x24, 0x51, 0x44, 0x61, 0x6A, 0xBA, 0x66, 0x99, 0x66, 0x99, 0x45, 0x91,
+    0x2E, 0xFD, 0x88, 0xC9, 0x49, 0xF1, 0xD1, 0xF9, 0xFF, 0xFF, 0x2D, 0xE2, 0x48, 0xD9, 0x68, 0xC9, 0x48, 0xC9, 0xFF, 0xFF, 0x8A, 0xE1, 0xC8, 0xB9, 0xA7, 0x99, 0xED, 0xFB, 0xC8, 0xA1, 0x87, 0xA1, 0x84, 0x0A, 0x05, 0x1B, 0xC7, 0x1B, 0x07, 0x1C, 0x85, 0x0B, 0xD2, 0x16, 0x9B, 0x3F, 0x51, 0x27, 0x30, 0x17, 0x0C, 0x26, 0xDE, 0x87, 0xFF, 0xFF, 0x91, 0x17, 0x0A, 0x25, 0x47, 0x04, 0x07, 0x0C,
+    0x2A, 0x1D, 0x27, 0x0C, 0xCD, 0x35, 0x4A, 0x3C, 0xE8, 0x23, 0x0D, 0x4D, 0x29, 0x34, 0xA9, 0x33, 0x2A, 0x3C, 0x26, 0x23, 0x48, 0x43, 0xE6, 0x32, 0xE7, 0x32, 0x2C, 0x54, 0xC7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xC3, 0x21, 0x24, 0x32, 0x25, 0x32, 0xCA, 0x53, 0xE4, 0x39, 0x67, 0x3A, 0x25, 0x32, 0x4B, 0x5B, 0xA4, 0x29, 0xE5, 0x39, 0xE5, 0x39, 0x06, 0x52, 0xE5, 0x41, 0x48, 0x82, 0xC4, 0x49,
+    0xC5, 0x49, 0xE5, 0x49, 0xA9, 0x7A, 0x27, 0x62, 0x43, 0x49, 0xC5, 0x61, 0xAA, 0x82, 0xA6, 0x81, 0x44, 0x51, 0xA6, 0x61, 0xC2, 0x60, 0x08, 0x92, 0x65, 0x81, 0x2A, 0xDA, 0x0B, 0xCA, 0x45, 0x91, 0x26, 0xB1, 0x4B, 0xE9, 0xDE, 0xFF, 0x6B, 0xE9, 0x88, 0xC1, 0x6D, 0xFA, 0xBF, 0xFF, 0x88, 0xB1, 0xA8, 0xB1, 0xA8, 0xB1, 0xE9, 0xA9, 0xA7, 0x91, 0xE8, 0xA1, 0xA7, 0x91, 0xE8, 0xA1, 0xC6, 0x91,
+    0x06, 0x13, 0x84, 0x0A, 0x25, 0x13, 0xCD, 0x4D, 0xAA, 0x2C, 0x48, 0x14, 0x2F, 0x0F, 0xFF, 0x87, 0x8D, 0x36, 0xFE, 0xA7, 0xFC, 0x3F, 0x30, 0x37, 0xF5, 0x47, 0xFE, 0xB7, 0x2D, 0x36, 0x09, 0x15, 0x90, 0x1E, 0xFF, 0xFF, 0x4B, 0x15, 0x0D, 0x46, 0xEC, 0x25, 0x2A, 0x34, 0xE5, 0x12, 0xEE, 0x35, 0x6D, 0x35, 0x4C, 0x55, 0xC7, 0x23, 0x6B, 0x44, 0xE7, 0x2A, 0x86, 0x32, 0xCB, 0x54, 0x65, 0x22,
+    0xCA, 0x5B, 0x25, 0x2A, 0x69, 0x43, 0x2A, 0x5C, 0xC7, 0x42, 0x05, 0x3A, 0xE6, 0x31, 0xA4, 0x31, 0x4C, 0x74, 0x63, 0x29, 0x84, 0x31, 0xA4, 0x31, 0x46, 0x6A, 0xE5, 0x39, 0x89, 0x7B, 0x84, 0x51, 0xA5, 0x41, 0xC5, 0x41, 0xA8, 0x72, 0x69, 0x93, 0x64, 0x49, 0x89, 0x82, 0xA5, 0x59, 0xE4, 0x51, 0x8B, 0xC3, 0xC4, 0x69, 0x44, 0x59, 0x86, 0x71, 0xA6, 0x89, 0x29, 0xB3, 0x09, 0xB3, 0x44, 0x79,
+    0x86, 0x91, 0x66, 0x91, 0xC9, 0xD2, 0xA9, 0xCA, 0x44, 0x79, 0xC7, 0x99, 0xE8, 0xA1, 0xA5, 0x91, 0x66, 0xA1, 0xA9, 0xB2, 0xC7, 0x91, 0xA7, 0x91, 0x67, 0xA2, 0x86, 0x81, 0x47, 0x92, 0xC6, 0x89, 0x2A, 0x2C, 0xE5, 0x12, 0xD3, 0x66, 0xC8, 0x1B, 0x4A, 0x15, 0xF0, 0x46, 0x0C, 0x1E, 0xAE, 0x2E, 0x8D, 0x1E, 0xCA, 0x15, 0x4C, 0x0E, 0xCB, 0x15, 0x6F, 0x1F, 0xB6, 0x4F, 0xEB, 0x34, 0x87, 0x04,
+    0x11, 0x3F, 0x6F, 0x36, 0x0B, 0x25, 0xE8, 0x1B, 0xA7, 0x23, 0x2C, 0x45, 0x8A, 0x3C, 0x46, 0x13, 0xC6, 0x22, 0x06, 0x2B, 0x2A, 0x4C, 0xC8, 0x33, 0xAA, 0x33, 0x28, 0x33, 0x27, 0x33, 0x2B, 0x5C, 0x45, 0x2A, 0xC7, 0x3A, 0xCA, 0x4B, 0x86, 0x3A, 0x0B, 0x74, 0x66, 0x3A, 0x47, 0x32, 0x05, 0x32, 0x09, 0x4B, 0xC4, 0x29, 0x06, 0x3A, 0x83, 0x29, 0x25, 0x3A, 0xC7, 0x62, 0x26, 0x4A, 0x86, 0x52,
+    0xE6, 0x41, 0xE5, 0x49, 0xC8, 0x72, 0x47, 0x62, 0xA4, 0x51, 0xC5, 0x51, 0xC8, 0x7A, 0xE4, 0x59, 0x85, 0x59, 0x85, 0x59, 0xA6, 0x69, 0xA8, 0x9A, 0xA6, 0x79, 0xA5, 0x71, 0x85, 0x79, 0x23, 0x79, 0x86, 0xA9, 0x45, 0x81, 0xC8, 0xA9, 0xC7, 0x91, 0x8B, 0xEA, 0x6A, 0xDA, 0x86, 0x81, 0x24, 0x79, 0x29, 0xC2, 0x04, 0x81, 0x8F, 0xEB, 0xC7, 0x89, 0xE8, 0xA1, 0x86, 0x91, 0xE7, 0xA1, 0xC7, 0x89,
+    0xAE, 0x16, 0x89, 0x14, 0xFF, 0xFF, 0x8A, 0x05, 0x97, 0x57, 0x29, 0x05, 0xF6, 0x47, 0xFF, 0xFF, 0x10, 0x07, 0xF5, 0x27, 0xFF, 0xD7, 0xFF, 0xFF, 0x8C, 0x16, 0x4A, 0x1D, 0xEA, 0x24, 0x88, 0x1C, 0xA9, 0x1C, 0x27, 0x13, 0x69, 0x34, 0x28, 0x1C, 0x4C, 0x3D, 0xC8, 0x2B, 0x47, 0x23, 0x6E, 0x5D, 0x6A, 0x3C, 0x47, 0x33, 0x88, 0x3B, 0xC5, 0x22, 0x4B, 0x54, 0xA6, 0x2A, 0xC7, 0x32, 0xE6, 0x32,
+    0xAA, 0x53, 0x45, 0x32, 0x68, 0x3B, 0xA6, 0x3A, 0x08, 0x53, 0x46, 0x3A, 0x26, 0x32, 0x05, 0x32, 0xC8, 0x4A, 0xC4, 0x29, 0x06, 0x3A, 0x83, 0x29, 0x45, 0x42, 0x05, 0x42, 0x67, 0x4A, 0xE5, 0x41, 0x09, 0x6B, 0xC5, 0x51, 0xE5, 0x49, 0x46, 0x5A, 0xE6, 0x61, 0xA5, 0x59, 0x64, 0x49, 0xE6, 0x61, 0x48, 0x92, 0xCA, 0x9A, 0xC6, 0x71, 0x07, 0x8A, 0x8A, 0xBA, 0x6A, 0xC2, 0x65, 0x69, 0x45, 0x81,
+    0x0A, 0xDA, 0x4C, 0xFA, 0x4B, 0xF1, 0x6E, 0xF1, 0x30, 0xDB, 0x0C, 0xF2, 0x4C, 0xDA, 0x06, 0x89, 0xC8, 0xA9, 0xAE, 0xE1, 0x09, 0xB2, 0xE8, 0x99, 0xC7, 0x89, 0x08, 0xA2, 0xE7, 0x91, 0xC6, 0x89, 0x88, 0x23, 0x66, 0x13, 0xEC, 0x3C, 0x0B, 0x2D, 0x29, 0x1D, 0xE8, 0x04, 0x74, 0x2F, 0x50, 0x1F, 0xFF, 0xFF, 0xAD, 0x0E, 0xB2, 0x2F, 0xFF, 0xFF, 0xFF, 0xF7, 0xAB, 0x1D, 0x0A, 0x25, 0xEE, 0x35,
+    0xAA, 0x1C, 0x87, 0x1B, 0x69, 0x2C, 0x89, 0x24, 0xAA, 0x2C, 0x09, 0x3C, 0x6A, 0x34, 0x09, 0x34, 0x68, 0x23, 0x0A, 0x34, 0xAB, 0x44, 0x88, 0x3B, 0x48, 0x3B, 0x85, 0x22, 0xEA, 0x43, 0xE7, 0x32, 0x85, 0x2A, 0xCB, 0x5B, 0xE7, 0x3A, 0x04, 0x22, 0xC7, 0x42, 0x08, 0x4B, 0x67, 0x32, 0x05, 0x2A, 0x88, 0x4A, 0xA3, 0x29, 0x26, 0x3A, 0x63, 0x21, 0x45, 0x4A, 0x05, 0x42, 0x46, 0x4A, 0xEB, 0x7B,
+    0x84, 0x39, 0xE4, 0x31, 0xA6, 0x59, 0x47, 0x62, 0xE5, 0x51, 0x28, 0x82, 0xB7, 0xFD, 0x27, 0x9A, 0x28, 0x92, 0xAD, 0xD2, 0x45, 0x81, 0x6B, 0xE9, 0x57, 0xFC, 0x70, 0xEB, 0x45, 0x81, 0x0A, 0xDA, 0x73, 0xF3, 0x70, 0xF9, 0xA9, 0xC9, 0xA9, 0xE1, 0x9B, 0xE5, 0x37, 0xED, 0x2E, 0xFA, 0x8E, 0xF1, 0xC9, 0xC9, 0x46, 0x89, 0xC8, 0x91, 0x29, 0x9A, 0xE8, 0x91, 0xE7, 0x91, 0x87, 0x99, 0x07, 0x8A,
+    0x85, 0x1A, 0xA6, 0x1A, 0x47, 0x23, 0x47, 0x1B, 0x46, 0x13, 0x08, 0x1C, 0x49, 0x24, 0xE7, 0x1B, 0xE6, 0x0B, 0x0B, 0x2D, 0x2B, 0x3D, 0xC9, 0x14, 0xE9, 0x14, 0xCA, 0x24, 0x28, 0x1C, 0xA9, 0x24, 0xE8, 0x1B, 0xE9, 0x23, 0xA7, 0x2B, 0xAA, 0x34, 0xAB, 0x54, 0xE8, 0x2B, 0xA7, 0x2B, 0x8B, 0x44, 0x68, 0x2B, 0x67, 0x2B, 0x67, 0x23, 0x06, 0x23, 0xCA, 0x3B, 0xC6, 0x2A, 0xC6, 0x2A, 0x49, 0x3B,
+    0x84, 0x1A, 0xA6, 0x3A, 0x48, 0x43, 0xA6, 0x32, 0xE7, 0x42, 0x08, 0x53, 0x46, 0x32, 0x66, 0x32, 0xEA, 0x52, 0xC4, 0x29, 0x26, 0x3A, 0x63, 0x29, 0xA6, 0x52, 0x05, 0x42, 0x26, 0x4A, 0x25, 0x42, 0x06, 0x4A, 0x27, 0x52, 0xE5, 0x49, 0x47, 0x5A, 0x47, 0x62, 0xC5, 0x51, 0x06, 0x5A, 0xE5, 0x61, 0x07, 0x6A, 0x06, 0x6A, 0xA5, 0x69, 0x85, 0x79, 0xE6, 0x89, 0xC6, 0x71, 0x85, 0x59, 0x65, 0x69,
+    0xC6, 0x89, 0xC7, 0x89, 0xA6, 0x79, 0xC7, 0x79, 0x86, 0x71, 0xC7, 0x81, 0x65, 0x69, 0xA6, 0x71, 0xC7, 0x81, 0x24, 0x69, 0xC7, 0x81, 0xC7, 0x81, 0xE7, 0x81, 0xE7, 0x81, 0xE7, 0x89, 0xE6, 0x79, 0x85, 0x1A, 0xC6, 0x1A, 0xE5, 0x12, 0x05, 0x0B, 0x26, 0x1B, 0x2C, 0x45, 0x08, 0x1C, 0xC7, 0x1B, 0x88, 0x14, 0xE9, 0x14, 0x2A, 0x25, 0x8B, 0x1D, 0x8D, 0x26, 0xCB, 0x25, 0x93, 0x47, 0x69, 0x15,
+    0x0B, 0x1E, 0xA9, 0x1C, 0x08, 0x24, 0xCA, 0x34, 0xCE, 0x26, 0x68, 0x1C, 0x0C, 0x3D, 0x29, 0x34, 0xE8, 0x2B, 0x8F, 0x46, 0x09, 0x3C, 0x47, 0x2B, 0x88, 0x3B, 0xE6, 0x2A, 0x69, 0x34, 0x69, 0x43, 0xE6, 0x32, 0xC7, 0x32, 0xC6, 0x32, 0x07, 0x33, 0xE7, 0x42, 0x86, 0x32, 0x67, 0x32, 0x47, 0x32, 0x66, 0x3A, 0xE4, 0x21, 0x46, 0x42, 0x63, 0x21, 0x25, 0x3A, 0x25, 0x3A, 0xC7, 0x4A, 0xA7, 0x52,
+    0x05, 0x42, 0x06, 0x42, 0x06, 0x4A, 0x2A, 0x74, 0xE5, 0x51, 0x06, 0x5A, 0xE6, 0x59, 0x68, 0x82, 0xAA, 0x93, 0xC5, 0x59, 0x65, 0x61, 0xC6, 0x71, 0xC6, 0x71, 0xA5, 0x79, 0x89, 0x93, 0x85, 0x61, 0x84, 0x69, 0x65, 0x61, 0xAC, 0xAB, 0x89, 0x8B, 0xA5, 0x69, 0x86, 0x81, 0x44, 0x69, 0x64, 0x59, 0x8C, 0xDB, 0x48, 0x9B, 0xC6, 0x81, 0xC7, 0x81, 0xA8, 0x82, 0xE6, 0x71, 0x28, 0x8B, 0x06, 0x7A,
+    0xAA, 0x2C, 0xAB, 0x15, 0xEC, 0x1D, 0xCC, 0x25, 0x2C, 0x2E, 0x50, 0x47, 0xDE, 0xAF, 0xBC, 0x87, 0xD5, 0x37, 0xFF, 0xC7, 0xFF, 0xFF, 0xFB, 0x87, 0xFF, 0xF7, 0xFF, 0xFF, 0x2F, 0x27, 0x99, 0x77, 0x10, 0x27, 0xF6, 0x47, 0x49, 0x15, 0x6C, 0x35, 0x0A, 0x2D, 0xE9, 0x24, 0x2B, 0x35, 0x0C, 0x3D, 0xAB, 0x3C, 0x49, 0x34, 0x0C, 0x55, 0x0D, 0x65, 0xE9, 0x3B, 0xA8, 0x33, 0xE9, 0x3B, 0x8C, 0x64,
+    0x2A, 0x54, 0x48, 0x43, 0x07, 0x33, 0x27, 0x33, 0x0B, 0x6C, 0xA6, 0x32, 0x67, 0x3A, 0x46, 0x32, 0xEB, 0x5B, 0xC7, 0x42, 0x46, 0x3A, 0xE4, 0x31, 0x07, 0x4B, 0x4A, 0x73, 0x46, 0x42, 0xCB, 0x6B, 0x8B, 0x73, 0x09, 0x7B, 0x8B, 0x83, 0x87, 0x5A, 0x67, 0x7A, 0x6D, 0xAB, 0x4A, 0x8B, 0xE7, 0x99, 0xEA, 0xA2, 0xE9, 0x92, 0xC6, 0x91, 0x6B, 0xD2, 0x8B, 0xD2, 0xEA, 0xBA, 0x88, 0x92, 0xA5, 0x79,
+    0x47, 0x82, 0xE3, 0x70, 0xEA, 0xBA, 0x27, 0x82, 0xE5, 0x79, 0x2A, 0xCA, 0x89, 0x92, 0xE7, 0x91, 0x0C, 0xCB, 0x65, 0x69, 0xE7, 0x89, 0x08, 0x92, 0x48, 0x8A, 0x27, 0x82, 0x27, 0x8A, 0x26, 0x82, 0x45, 0x12, 0x85, 0x1A, 0x85, 0x12, 0xA5, 0x12, 0x06, 0x13, 0x08, 0x1C, 0x87, 0x1B, 0xA7, 0x1B, 0xAB, 0x2D, 0x09, 0x15, 0x2A, 0x1D, 0xA9, 0x1C, 0xE9, 0x1C, 0xC9, 0x24, 0x2B, 0x25, 0xCA, 0x2C,
+    0x8A, 0x2C, 0x69, 0x2C, 0xCA, 0x2C, 0xA6, 0x13, 0x29, 0x24, 0x49, 0x2C, 0x8B, 0x3C, 0xE8, 0x33, 0xA8, 0x2B, 0x4A, 0x44, 0xA8, 0x33, 0xC9, 0x3B, 0x89, 0x3B, 0xCD, 0x6C, 0x27, 0x2B, 0xAE, 0x64, 0x07, 0x33, 0x69, 0x4B, 0x69, 0x4B, 0x07, 0x3B, 0xAA, 0x53, 0x49, 0x5B, 0xA8, 0x3A, 0x87, 0x32, 0xCB, 0x5A, 0xE4, 0x29, 0x67, 0x42, 0xA4, 0x39, 0x29, 0x5B, 0x87, 0x4A, 0x46, 0x42, 0xA7, 0x52,
+    0x47, 0x4A, 0x05, 0x4A, 0x07, 0x62, 0x8B, 0x73, 0xA8, 0x81, 0x07, 0x62, 0x88, 0x72, 0xED, 0xE1, 0x08, 0x92, 0x06, 0x6A, 0xC7, 0x81, 0xEB, 0xD1, 0xE9, 0x99, 0xC6, 0x61, 0xA5, 0x51, 0x84, 0x51, 0xC5, 0x51, 0xC6, 0x59, 0xA5, 0x51, 0xC6, 0x59, 0xC6, 0x69, 0xA7, 0x79, 0x85, 0x61, 0xE8, 0x79, 0xC7, 0x71, 0x07, 0x72, 0xC6, 0x69, 0x07, 0x72, 0xC5, 0x69, 0x26, 0x6A, 0x26, 0x72, 0xE5, 0x69,
+    0x07, 0x23, 0x25, 0x1A, 0x65, 0x1A, 0x65, 0x12, 0x44, 0x12, 0xC6, 0x1A, 0x06, 0x1B, 0x26, 0x1B, 0x46, 0x13, 0xC8, 0x1B, 0x49, 0x2C, 0xE7, 0x13, 0xCA, 0x34, 0xC7, 0x13, 0xCA, 0x2C, 0x69, 0x24, 0x08, 0x1C, 0xE7, 0x1B, 0x2A, 0x2D, 0x28, 0x2C, 0x8A, 0x34, 0x89, 0x2C, 0x69, 0x34, 0x09, 0x2C, 0xA8, 0x2B, 0x09, 0x34, 0xC8, 0x2B, 0xE9, 0x33, 0x88, 0x2B, 0xC9, 0x33, 0x67, 0x2B, 0x47, 0x2B,
+    0xA8, 0x33, 0x48, 0x3B, 0x07, 0x33, 0xE6, 0x2A, 0x48, 0x43, 0xE7, 0x3A, 0xA7, 0x3A, 0xA7, 0x32, 0x87, 0x3A, 0x24, 0x2A, 0x66, 0x3A, 0x45, 0x3A, 0xA7, 0x42, 0x86, 0x42, 0x86, 0x42, 0xA7, 0x52, 0x66, 0x4A, 0x46, 0x4A, 0x87, 0x5A, 0x46, 0x52, 0x26, 0x4A, 0x26, 0x52, 0xC9, 0x62, 0x68, 0x62, 0x67, 0x6A, 0xC4, 0x49, 0x67, 0x62, 0xE5, 0x59, 0xC5, 0x51, 0xC4, 0x49, 0xC5, 0x49, 0xA4, 0x41,
+    0xC5, 0x49, 0xA4, 0x49, 0xC5, 0x49, 0xE6, 0x51, 0xC5, 0x51, 0x07, 0x5A, 0xA5, 0x59, 0xE6, 0x61, 0xC6, 0x61, 0x27, 0x6A, 0xE6, 0x61, 0x06, 0x6A, 0x27, 0x6A, 0xE5, 0x61, 0x26, 0x6A, 0x25, 0x6A, 0x04, 0x12, 0x65, 0x12, 0x45, 0x12, 0x65, 0x12, 0x85, 0x1A, 0x63, 0x0A, 0xE6, 0x1A, 0xC5, 0x12, 0x46, 0x1B, 0x47, 0x1B, 0xA7, 0x1B, 0x45, 0x0B, 0x0B, 0x35, 0xE7, 0x13, 0x2B, 0x2D, 0xA8, 0x1C,
+    0xC9, 0x1C, 0xA9, 0x1C, 0xAD, 0x2E, 0x2B, 0x2D, 0x4A, 0x1D, 0x8A, 0x25, 0xAD, 0x3D, 0x29, 0x2C, 0x09, 0x24, 0xCB, 0x34, 0x8A, 0x3C, 0xAB, 0x3C, 0xA8, 0x23, 0xAB, 0x3C, 0xE8, 0x2B, 0x46, 0x23, 0xC8, 0x33, 0x89, 0x3B, 0x89, 0x3B, 0x26, 0x2B, 0x89, 0x3B, 0x47, 0x33, 0xC7, 0x3A, 0x64, 0x1A, 0xE8, 0x3A, 0x65, 0x2A, 0xC7, 0x3A, 0x45, 0x32, 0xE7, 0x42, 0x87, 0x42, 0x08, 0x4B, 0x6F, 0x7D,
+    0x09, 0x5B, 0xA6, 0x4A, 0x68, 0x52, 0xE8, 0x62, 0x68, 0x82, 0x26, 0x52, 0xEB, 0x7B, 0x26, 0x5A, 0x26, 0x5A, 0x05, 0x4A, 0xC5, 0x49, 0xE4, 0x49, 0x05, 0x52, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0x84, 0x41, 0xA4, 0x49, 0xC5, 0x49, 0xE5, 0x51, 0x06, 0x5A, 0x63, 0x41, 0xE7, 0x61, 0x28, 0x6A, 0xE6, 0x69, 0x07, 0x7A, 0xE6, 0x69, 0x6A, 0x9A, 0x47, 0x72, 0x07, 0x72, 0x27, 0x72,
+    0x45, 0x1A, 0x65, 0x12, 0xA5, 0x12, 0x84, 0x0A, 0x85, 0x0A, 0x6C, 0x35, 0x05, 0x0B, 0x87, 0x13, 0xE4, 0x02, 0xCC, 0x25, 0xCB, 0x2C, 0x0D, 0x26, 0x31, 0x1F, 0xDC, 0x77, 0x6E, 0x26, 0x70, 0x27, 0xF5, 0x2F, 0xF6, 0x3F, 0x8D, 0x26, 0x8F, 0x3E, 0xFF, 0x87, 0xD4, 0x37, 0x90, 0x3F, 0xEC, 0x3C, 0x2E, 0x3E, 0xF7, 0x3F, 0xAE, 0x2E, 0xC9, 0x14, 0xCC, 0x44, 0x2C, 0x2E, 0xEC, 0x3D, 0x4B, 0x35,
+    0xAB, 0x3C, 0xCC, 0x5C, 0x29, 0x3C, 0x4C, 0x1E, 0x0C, 0x5D, 0xC9, 0x4B, 0x08, 0x3B, 0xC6, 0x1A, 0xEE, 0x74, 0xA8, 0x43, 0xC6, 0x32, 0xE7, 0x42, 0x29, 0x54, 0xCC, 0x6C, 0xC9, 0x53, 0xF3, 0x96, 0x28, 0x63, 0x0A, 0x6C, 0x2B, 0x74, 0x07, 0x5B, 0xA6, 0x6A, 0x8A, 0x73, 0xA8, 0x63, 0xAB, 0x93, 0xAA, 0x7B, 0xAA, 0x7B, 0x86, 0x6A, 0xE7, 0x6A, 0xE8, 0x7A, 0xE6, 0x72, 0xA9, 0x83, 0xCA, 0x83,
+    0xCA, 0x8B, 0xA3, 0x49, 0x07, 0x7B, 0x8E, 0xCC, 0x8A, 0x9B, 0xC6, 0x72, 0xC3, 0x51, 0xE7, 0x7A, 0x66, 0x72, 0xA8, 0x72, 0x24, 0x5A, 0xA8, 0x8A, 0xE3, 0x51, 0x67, 0x7A, 0xA6, 0x6A, 0xE8, 0x82, 0xCC, 0x3C, 0x94, 0x86, 0x05, 0x1A, 0x6C, 0x3D, 0xC9, 0x2B, 0x08, 0x24, 0xA6, 0x1A, 0xA6, 0x1A, 0xC6, 0x1B, 0x2E, 0x3E, 0x08, 0x14, 0x0D, 0x36, 0xEB, 0x0D, 0xEC, 0x2D, 0xD0, 0x27, 0xFD, 0x97,
+    0xF3, 0x2F, 0x30, 0x3F, 0x2A, 0x25, 0xEE, 0x25, 0xFF, 0xCF, 0x8E, 0x17, 0x2D, 0x36, 0x8A, 0x2C, 0x6B, 0x2D, 0xFF, 0xFF, 0x0F, 0x27, 0xAD, 0x45, 0x0A, 0x34, 0x6E, 0x2E, 0xFF, 0xFF, 0xCB, 0x35, 0x49, 0x34, 0xC9, 0x33, 0x0A, 0x44, 0x6F, 0x46, 0xCA, 0x3C, 0xE8, 0x3B, 0xAA, 0x43, 0x06, 0x1B, 0x4C, 0x4D, 0x70, 0x4E, 0x08, 0x43, 0xA6, 0x32, 0xC9, 0x43, 0x27, 0x3B, 0xF7, 0x47, 0xC9, 0x4B,
+    0xC7, 0x42, 0x06, 0x3B, 0xC7, 0x42, 0x4B, 0x6D, 0xA7, 0x4A, 0xA6, 0x4A, 0x48, 0x53, 0x86, 0x42, 0xED, 0x84, 0x09, 0x63, 0xA2, 0x29, 0x45, 0x42, 0x05, 0x3A, 0xE4, 0x31, 0x28, 0x53, 0x25, 0x42, 0x24, 0x3A, 0x25, 0x3A, 0x05, 0x3A, 0x04, 0x3A, 0x05, 0x42, 0x25, 0x42, 0x25, 0x4A, 0x67, 0x52, 0x06, 0x52, 0x46, 0x52, 0xA3, 0x41, 0x26, 0x52, 0xA3, 0x39, 0x45, 0x52, 0x86, 0x5A, 0x86, 0x5A,
+    0xE6, 0x19, 0xC5, 0x19, 0xC4, 0x11, 0x25, 0x1A, 0x04, 0x12, 0x64, 0x12, 0x25, 0x1A, 0x65, 0x1A, 0x0B, 0x4C, 0xEA, 0x3B, 0xE7, 0x22, 0xCB, 0x34, 0x26, 0x0B, 0xCC, 0x44, 0x08, 0x24, 0x0F, 0x56, 0x2A, 0x2D, 0xEA, 0x34, 0x4C, 0x45, 0x08, 0x1C, 0xEA, 0x34, 0x4C, 0x35, 0x0B, 0x3D, 0x29, 0x2C, 0x6B, 0x34, 0xCB, 0x3C, 0xAB, 0x3C, 0xCB, 0x34, 0x0A, 0x3C, 0x0B, 0x3D, 0x6C, 0x45, 0x4A, 0x3C,
+    0xAC, 0x44, 0xEC, 0x5C, 0x2C, 0x54, 0xEA, 0x43, 0x2A, 0x4C, 0x6A, 0x4C, 0x4A, 0x4B, 0x06, 0x23, 0x32, 0x93, 0xCA, 0x53, 0x09, 0x53, 0x87, 0x42, 0xC9, 0x43, 0x6C, 0x73, 0xAB, 0x6B, 0x8C, 0x5C, 0xE8, 0x4A, 0x4A, 0x6C, 0x29, 0x5B, 0x28, 0x4B, 0xA6, 0x3A, 0xE7, 0x52, 0x27, 0x4B, 0x66, 0x42, 0x69, 0x5B, 0x65, 0x3A, 0x04, 0x32, 0x86, 0x42, 0x45, 0x42, 0x25, 0x32, 0x04, 0x3A, 0x04, 0x3A,
+    0x86, 0x4A, 0x04, 0x3A, 0x25, 0x3A, 0x25, 0x42, 0x25, 0x42, 0xA7, 0x5A, 0x46, 0x4A, 0x66, 0x52, 0x47, 0x52, 0x66, 0x52, 0xA3, 0x39, 0x26, 0x5A, 0x64, 0x41, 0x46, 0x5A, 0xF2, 0xBA, 0x4B, 0x92, 0xA5, 0x21, 0x68, 0x32, 0x29, 0x4B, 0xE6, 0x21, 0x6C, 0x4C, 0x27, 0x1B, 0x26, 0x22, 0x28, 0x33, 0x4C, 0x44, 0xE7, 0x22, 0xC7, 0x22, 0x89, 0x33, 0x68, 0x23, 0xAF, 0x5D, 0x27, 0x1B, 0x0A, 0x34,
+    0x8D, 0x4D, 0x8C, 0x3D, 0xEA, 0x33, 0xCC, 0x44, 0x8C, 0x44, 0xAD, 0x4C, 0x6C, 0x44, 0x6B, 0x34, 0x4F, 0x64, 0x4C, 0x44, 0x2D, 0x4D, 0x8B, 0x3C, 0x50, 0x84, 0x4A, 0x3C, 0xAC, 0x4C, 0xCF, 0x74, 0x2D, 0x4D, 0x6E, 0x5D, 0xCD, 0x7B, 0x2A, 0x44, 0x6B, 0x4C, 0x6B, 0x5C, 0xAA, 0x43, 0xA9, 0x43, 0x0E, 0x94, 0x68, 0x33, 0x69, 0x4B, 0xE6, 0x3A, 0xEB, 0x54, 0xA9, 0x4B, 0x8A, 0x44, 0xAF, 0x8D,
+    0x48, 0x43, 0x67, 0x43, 0x2D, 0x8C, 0xE8, 0x43, 0x06, 0x3B, 0x88, 0x72, 0xE8, 0x5B, 0xA9, 0x53, 0x46, 0x52, 0x6B, 0x93, 0xC2, 0x29, 0x67, 0x4B, 0x69, 0x73, 0xAB, 0x83, 0x44, 0x3A, 0x65, 0x3A, 0x68, 0x5B, 0xE7, 0x4A, 0x45, 0x3A, 0x45, 0x42, 0x45, 0x42, 0x48, 0x53, 0x46, 0x4A, 0xA7, 0x5A, 0xA7, 0x5A, 0xA7, 0x5A, 0xE4, 0x41, 0x86, 0x5A, 0x04, 0x42, 0xC7, 0x62, 0xE7, 0x62, 0xC6, 0x5A,
+    0x47, 0x2A, 0xE6, 0x21, 0x0B, 0x3C, 0x27, 0x2A, 0x29, 0x33, 0x26, 0x1A, 0x07, 0x22, 0x6B, 0x3C, 0xE8, 0x22, 0xAB, 0x43, 0xEC, 0x43, 0x09, 0x2B, 0x92, 0x5E, 0xCB, 0x2C, 0x0C, 0x44, 0x8A, 0x33, 0x0B, 0x3C, 0xCF, 0x45, 0x8C, 0x44, 0x89, 0x2B, 0xCD, 0x3C, 0xEE, 0x44, 0xEC, 0x44, 0x91, 0x66, 0x2D, 0x4D, 0xEE, 0x54, 0xCF, 0x55, 0x49, 0x2C, 0x0E, 0x55, 0xB0, 0x6D, 0xF6, 0x87, 0x8A, 0x34,
+    0x2F, 0x4E, 0xE9, 0x33, 0xEC, 0x44, 0xCB, 0x3C, 0x6D, 0x55, 0xAF, 0x56, 0xA9, 0x3B, 0xEA, 0x3B, 0xE8, 0x33, 0xE8, 0x33, 0xCA, 0x43, 0x26, 0x2B, 0xD2, 0x6E, 0xA8, 0x43, 0xAB, 0x4C, 0x73, 0x7F, 0x4B, 0x64, 0x69, 0x64, 0x47, 0x3B, 0x49, 0x44, 0x2A, 0x64, 0x2C, 0x94, 0xAC, 0x4D, 0x87, 0x4B, 0x29, 0x6C, 0x4B, 0x7C, 0x84, 0x2A, 0x67, 0x4B, 0x4A, 0x74, 0x29, 0x74, 0x64, 0x3A, 0x45, 0x3A,
+    0x06, 0x4B, 0x4B, 0x74, 0x2F, 0xC5, 0x85, 0x3A, 0x68, 0x63, 0xC5, 0x42, 0xA9, 0x73, 0x86, 0x4A, 0xC7, 0x5A, 0xA6, 0x4A, 0x08, 0x63, 0xE7, 0x5A, 0xE7, 0x52, 0xA6, 0x52, 0x06, 0x5B, 0xC6, 0x52, 0x65, 0x19, 0x27, 0x2A, 0x05, 0x1A, 0x2C, 0x44, 0x66, 0x1A, 0x2B, 0x4B, 0x6E, 0x54, 0x4C, 0x44, 0xE6, 0x21, 0xCD, 0x44, 0x27, 0x22, 0xE8, 0x2A, 0x4B, 0x2C, 0xEA, 0x23, 0x2E, 0x5C, 0x87, 0x22,
+    0xAC, 0x44, 0x4D, 0x2D, 0x2E, 0x45, 0xAE, 0x54, 0x8F, 0x56, 0xFA, 0x67, 0xCE, 0x4D, 0x8B, 0x34, 0x2E, 0x5D, 0xD0, 0x46, 0x52, 0x37, 0xCD, 0x45, 0x2F, 0x6C, 0xD0, 0xA5, 0x70, 0x3F, 0xB3, 0x5F, 0xD6, 0x8E, 0x2A, 0x3C, 0xCF, 0x6C, 0x92, 0x5F, 0x2F, 0x4F, 0xCD, 0x5C, 0x4E, 0x5C, 0x8B, 0x3C, 0xBF, 0xFF, 0x8C, 0x4D, 0x89, 0x34, 0xCB, 0x6B, 0x68, 0x2C, 0x8E, 0x56, 0x0C, 0x3E, 0xD3, 0x6F,
+    0xA8, 0x43, 0x69, 0x44, 0xEF, 0x5E, 0x48, 0x3C, 0x09, 0x44, 0xA8, 0x43, 0x2B, 0x5D, 0x2F, 0x67, 0xE8, 0x43, 0x05, 0x33, 0x25, 0x33, 0x69, 0x54, 0x4A, 0x55, 0x06, 0x33, 0xA5, 0x32, 0x69, 0x5C, 0xA2, 0x22, 0x8D, 0x85, 0x65, 0x32, 0xA5, 0x3A, 0xA6, 0x3A, 0x85, 0x43, 0xAA, 0x6C, 0xA6, 0x4A, 0xEA, 0x6B, 0x88, 0x5B, 0x8A, 0x7C, 0x49, 0x6C, 0xC6, 0x4A, 0xC5, 0x4A, 0x07, 0x53, 0x67, 0x5B,
+    0xAE, 0x4C, 0xED, 0x4A, 0x87, 0x29, 0x4A, 0x3B, 0xED, 0x3C, 0x8D, 0x54, 0x07, 0x32, 0xEA, 0x32, 0x07, 0x23, 0x50, 0x4E, 0x05, 0x1A, 0x06, 0x12, 0x49, 0x33, 0x68, 0x2A, 0x6F, 0x36, 0x48, 0x1B, 0x69, 0x2B, 0xC8, 0x22, 0x8C, 0x43, 0x2C, 0x3C, 0xFF, 0xAF, 0x94, 0x67, 0x38, 0xA4, 0xCA, 0x3B, 0xF1, 0x5D, 0xFF, 0xFF, 0xD2, 0x2F, 0xAC, 0x4C, 0xB5, 0xAC, 0x50, 0x46, 0xFF, 0xFF, 0xF7, 0x5F,
+    0xEE, 0x45, 0xAB, 0x3C, 0xD2, 0x95, 0xFF, 0xFF, 0xD7, 0x47, 0x2D, 0x5D, 0x29, 0x2C, 0xEB, 0x3C, 0xFF, 0xBF, 0xFF, 0xFF, 0x6B, 0x3D, 0xA7, 0x2B, 0xEB, 0x3C, 0x4D, 0x3E, 0xFF, 0xFF, 0xEF, 0x56, 0x08, 0x34, 0xAA, 0x3C, 0xA7, 0x33, 0xFF, 0xFF, 0x26, 0x1C, 0x67, 0x43, 0x8A, 0x44, 0x49, 0x44, 0x4B, 0x46, 0x67, 0x3B, 0x25, 0x33, 0x87, 0x3B, 0x87, 0x43, 0xE5, 0x2A, 0x2C, 0x5E, 0x05, 0x3B,
+    0xE6, 0x32, 0xA5, 0x2A, 0xE6, 0x3A, 0x09, 0x55, 0x84, 0x2A, 0x47, 0x43, 0xE6, 0x42, 0x07, 0x4B, 0x09, 0x6D, 0x26, 0x43, 0xE6, 0x4A, 0x07, 0x53, 0xC6, 0x4A, 0xE9, 0x6C, 0x28, 0x6C, 0x26, 0x4B, 0x31, 0x75, 0xA6, 0x21, 0x85, 0x19, 0x66, 0x21, 0xA6, 0x21, 0xC7, 0x29, 0xC6, 0x21, 0xE6, 0x19, 0xA5, 0x19, 0xC6, 0x21, 0xE7, 0x29, 0x07, 0x22, 0x8B, 0x3A, 0x69, 0x2A, 0x6C, 0x43, 0xEC, 0x42,
+    0x8D, 0x53, 0xE9, 0x2A, 0xEB, 0x42, 0x2C, 0x43, 0x8B, 0x43, 0x09, 0x33, 0xEC, 0x4B, 0x31, 0x74, 0x8C, 0x44, 0xF6, 0x8C, 0xCE, 0x54, 0x2D, 0x4C, 0x2C, 0x44, 0x0D, 0x45, 0x90, 0x4E, 0x4F, 0x4E, 0x0B, 0x45, 0xEF, 0x6C, 0xCB, 0x3C, 0xAC, 0x35, 0x6C, 0x3D, 0x6A, 0x25, 0x08, 0x24, 0xAA, 0x34, 0x2C, 0x36, 0xAD, 0x2E, 0x0B, 0x3D, 0x29, 0x34, 0x4D, 0x5D, 0x0B, 0x45, 0x8E, 0x46, 0xCD, 0x45,
+    0xE8, 0x3B, 0x0B, 0x45, 0xE7, 0x2B, 0x4D, 0x6D, 0xCC, 0x55, 0xE7, 0x3B, 0xC9, 0x3C, 0x4B, 0x7C, 0x08, 0x3C, 0x07, 0x34, 0xAA, 0x5C, 0xE6, 0x33, 0x46, 0x2B, 0x25, 0x2B, 0x8A, 0x6C, 0xC5, 0x2A, 0x66, 0x2B, 0x4A, 0x54, 0xA7, 0x4B, 0x27, 0x3B, 0x47, 0x43, 0x26, 0x43, 0x87, 0x4B, 0xA9, 0x53, 0xA5, 0x3A, 0x47, 0x4B, 0x06, 0x43, 0x67, 0x53, 0x47, 0x4B, 0x67, 0x53, 0x26, 0x43, 0x88, 0x53,
+    0x44, 0x11, 0xA7, 0x29, 0x86, 0x21, 0x87, 0x29, 0x87, 0x29, 0xEB, 0x51, 0x29, 0x3A, 0xA7, 0x21, 0x8C, 0x43, 0x2E, 0x5B, 0xE8, 0x29, 0xE8, 0x29, 0x4D, 0x43, 0x6F, 0x53, 0x4A, 0x32, 0xA9, 0x2A, 0x0F, 0x5C, 0xAD, 0x4B, 0xEE, 0x5A, 0x0B, 0x43, 0xEE, 0x53, 0xEF, 0x5B, 0x10, 0x6B, 0x8E, 0x63, 0x31, 0x75, 0x13, 0x84, 0x74, 0xAB, 0x2E, 0x5C, 0xF2, 0x7C, 0x74, 0xF5, 0x6E, 0x54, 0x6D, 0x54,
+    0xB7, 0x9C, 0xAC, 0x4C, 0x0C, 0x4C, 0x29, 0x34, 0x0E, 0x6D, 0xD0, 0x56, 0x29, 0x34, 0x6A, 0x3C, 0xEE, 0x5C, 0x69, 0x2C, 0x28, 0x2C, 0x09, 0x3C, 0xB5, 0x8F, 0x69, 0x34, 0x8D, 0x4D, 0x4E, 0x56, 0x89, 0x44, 0x68, 0x34, 0xC6, 0x23, 0xE9, 0x34, 0xA9, 0x4C, 0x29, 0x44, 0xAB, 0x45, 0x48, 0x34, 0xCA, 0x54, 0x68, 0x44, 0xC9, 0x44, 0x67, 0x24, 0x0A, 0x55, 0x6B, 0x6D, 0x66, 0x33, 0x66, 0x33,
+    0xA5, 0x33, 0xAC, 0x6D, 0x67, 0x3B, 0x46, 0x33, 0x8A, 0x64, 0x27, 0x44, 0x46, 0x43, 0x26, 0x43, 0x87, 0x4B, 0x26, 0x43, 0xA8, 0x4B, 0xA8, 0x53, 0x87, 0x53, 0x26, 0x43, 0xC8, 0x53, 0xE8, 0x53, 0x46, 0x21, 0xA7, 0x29, 0x89, 0x39, 0x4F, 0x59, 0x33, 0x9A, 0x6F, 0x5B, 0x6C, 0x4A, 0x31, 0x6A, 0x30, 0x6C, 0x50, 0x6B, 0xA9, 0x29, 0x51, 0x6B, 0xCC, 0x4A, 0x72, 0x7B, 0x6F, 0x5B, 0xF1, 0x6B,
+    0x2D, 0x53, 0x4A, 0x3A, 0xF2, 0x7B, 0x31, 0x6C, 0xAC, 0x4A, 0x14, 0xAB, 0xDF, 0xFE, 0x37, 0xA5, 0x52, 0x75, 0x1F, 0xFC, 0xED, 0x5A, 0x6E, 0x5C, 0xB0, 0x64, 0xCC, 0x4B, 0xAC, 0x43, 0xAC, 0x53, 0x0E, 0x5D, 0xEA, 0x3B, 0xF1, 0x9B, 0x6A, 0x3C, 0x0C, 0x4D, 0x6B, 0x2D, 0xC8, 0x2B, 0x29, 0x34, 0x8D, 0x64, 0x07, 0x1C, 0x28, 0x24, 0xE8, 0x23, 0x0D, 0x4E, 0x6C, 0x4D, 0xEE, 0x4D, 0x70, 0x57,
+    0x69, 0x34, 0xCC, 0x4D, 0xE8, 0x24, 0x49, 0x25, 0x69, 0x34, 0x88, 0x34, 0xCD, 0x4E, 0xEB, 0x35, 0x4B, 0x4D, 0x68, 0x34, 0xA8, 0x34, 0x49, 0x2D, 0x26, 0x14, 0xE6, 0x2B, 0x06, 0x34, 0xFF, 0x9F, 0x46, 0x24, 0xEA, 0x44, 0xC8, 0x34, 0x6C, 0x5E, 0xE8, 0x34, 0xA7, 0x3B, 0xA6, 0x43, 0x46, 0x3B, 0xC9, 0x54, 0xA7, 0x43, 0x87, 0x4B, 0xA8, 0x4B, 0xE8, 0x4B, 0xEA, 0x64, 0xE8, 0x53, 0xC7, 0x4B,
+    0xC7, 0x31, 0x46, 0x19, 0xA9, 0x31, 0x4C, 0x43, 0x86, 0x21, 0x68, 0x31, 0xA8, 0x49, 0x0E, 0x5C, 0xA8, 0x21, 0xA9, 0x31, 0xC9, 0x39, 0x19, 0x97, 0x50, 0x4C, 0x2D, 0x52, 0xB4, 0x7A, 0xCB, 0x3A, 0xAD, 0x53, 0x4F, 0x54, 0x8F, 0x72, 0x4A, 0x3A, 0x70, 0x62, 0xF1, 0x64, 0x4F, 0x54, 0xD9, 0xC4, 0x71, 0x6D, 0xCB, 0x4A, 0xEE, 0x4C, 0x0C, 0x44, 0x8B, 0x43, 0x4A, 0x33, 0xAB, 0x5B, 0x4F, 0x65,
+    0x50, 0x56, 0xEA, 0x3B, 0xEA, 0x33, 0x89, 0x2C, 0x2F, 0x66, 0x4A, 0x25, 0xE8, 0x2B, 0x29, 0x2C, 0x2E, 0x65, 0xA8, 0x24, 0x69, 0x24, 0xE8, 0x2B, 0x6A, 0x35, 0x30, 0x47, 0x6E, 0x37, 0xFA, 0x67, 0x4B, 0x45, 0x6A, 0x1D, 0xFF, 0xDF, 0xF3, 0x37, 0x8A, 0x25, 0x09, 0x35, 0xB6, 0x67, 0xFF, 0xF7, 0xD1, 0x37, 0x8B, 0x45, 0x49, 0x3D, 0xAF, 0x2F, 0xFE, 0x87, 0x2C, 0x4F, 0x27, 0x2C, 0x27, 0x2C,
+    0xDC, 0xA7, 0x50, 0x67, 0x47, 0x3C, 0xC7, 0x33, 0x65, 0x23, 0x2C, 0x66, 0x4B, 0x5E, 0x86, 0x3B, 0x29, 0x54, 0xA6, 0x3B, 0xC7, 0x43, 0xAC, 0x6D, 0xE3, 0x2A, 0xE7, 0x4B, 0xE7, 0x4B, 0xE6, 0x43, 0x87, 0x21, 0x7C, 0x9C, 0xA7, 0x29, 0x06, 0x12, 0xB3, 0x66, 0x47, 0x29, 0x0F, 0x5A, 0xAA, 0x39, 0x88, 0x29, 0xCF, 0x44, 0x48, 0x21, 0x10, 0x5A, 0xAA, 0x31, 0xAA, 0x31, 0xD3, 0x74, 0x6D, 0x4A,
+    0x09, 0x2A, 0xEA, 0x39, 0x51, 0x72, 0xD7, 0x8D, 0xB2, 0x5D, 0xED, 0x4A, 0x72, 0x8B, 0x0C, 0x4B, 0x2C, 0x43, 0xCF, 0x3D, 0xCC, 0x3B, 0xEA, 0x32, 0x4C, 0x4B, 0x8C, 0x4B, 0xF3, 0x27, 0x2A, 0x34, 0xAA, 0x3B, 0x0C, 0x54, 0xCB, 0x3B, 0xFC, 0x77, 0xF7, 0x47, 0xEC, 0x35, 0xC8, 0x23, 0x49, 0x2C, 0xF4, 0x2F, 0xFF, 0xDF, 0xC9, 0x1C, 0xE8, 0x23, 0xCD, 0x4D, 0xD0, 0x27, 0xFF, 0xFF, 0xD7, 0x37,
+    0xC9, 0x3C, 0x6A, 0x3D, 0x2C, 0x26, 0xFF, 0xFF, 0x74, 0x3F, 0xA8, 0x2C, 0x8C, 0x3E, 0xCF, 0x4F, 0xFF, 0xEF, 0xC8, 0x2C, 0xC8, 0x34, 0x8A, 0x3D, 0x72, 0x57, 0xF9, 0x77, 0xF0, 0x4F, 0x27, 0x34, 0x27, 0x2C, 0x49, 0x3D, 0x08, 0x2D, 0x8C, 0x56, 0x07, 0x34, 0x49, 0x44, 0x08, 0x44, 0xC6, 0x0C, 0x69, 0x55, 0xE7, 0x3B, 0x28, 0x4C, 0x69, 0x54, 0xAA, 0x54, 0xAA, 0x5D, 0xC9, 0x5C, 0x48, 0x4C,
+    0x46, 0x21, 0xA9, 0x39, 0x09, 0x3A, 0x68, 0x29, 0xC9, 0x40, 0xAF, 0x59, 0x6C, 0x59, 0x4E, 0x51, 0x32, 0x7B, 0x99, 0xA2, 0xAC, 0x49, 0xCB, 0x39, 0x6E, 0x52, 0xB3, 0x72, 0xD9, 0xA2, 0x0B, 0x42, 0xF1, 0x62, 0x16, 0x93, 0x9B, 0xB9, 0x19, 0xBA, 0xB3, 0x7B, 0x52, 0x73, 0x5F, 0xEA, 0x74, 0x83, 0xCD, 0x53, 0x52, 0x83, 0xEC, 0x42, 0xCB, 0x3A, 0x0D, 0x5B, 0xE9, 0x32, 0x6C, 0x43, 0x8D, 0x5B,
+    0xAB, 0x4B, 0x8A, 0x3B, 0xED, 0x63, 0xED, 0x44, 0x6B, 0x44, 0xA9, 0x24, 0xA8, 0x2B, 0x09, 0x2C, 0xED, 0x3D, 0xAD, 0x1E, 0x48, 0x24, 0x86, 0x1B, 0x4B, 0x3D, 0xEC, 0x35, 0x0E, 0x37, 0x4C, 0x36, 0x67, 0x2C, 0x09, 0x2D, 0x09, 0x25, 0xEC, 0x26, 0x49, 0x2D, 0xA9, 0x34, 0x2F, 0x5F, 0x8A, 0x35, 0x69, 0x3D, 0xA7, 0x2C, 0x49, 0x35, 0x29, 0x2D, 0x29, 0x2D, 0xE8, 0x34, 0xA8, 0x34, 0x88, 0x2C,
+    0x8A, 0x45, 0xAE, 0x36, 0x89, 0x3D, 0xA9, 0x44, 0x2A, 0x45, 0xFF, 0xB7, 0x28, 0x44, 0x07, 0x34, 0x06, 0x2C, 0xA9, 0x4C, 0xF2, 0x47, 0x48, 0x4C, 0xC9, 0x54, 0x68, 0x44, 0xAF, 0x3F, 0x47, 0x44, 0x69, 0x39, 0x48, 0x29, 0x07, 0x21, 0x6A, 0x41, 0x89, 0x39, 0x6A, 0x39, 0x90, 0x81, 0x9B, 0x91, 0x6E, 0x61, 0x55, 0x7A, 0x14, 0x71, 0xD8, 0xA3, 0x6D, 0x51, 0x73, 0x69, 0xDE, 0xF4, 0x71, 0x5A,
+    0x76, 0x8B, 0xFE, 0xFF, 0xDF, 0xFE, 0x14, 0x83, 0x0C, 0x52, 0x8F, 0x62, 0x4D, 0x52, 0x6B, 0x42, 0xE9, 0x32, 0x28, 0x2A, 0x0F, 0x64, 0x6F, 0x6B, 0xCD, 0x4B, 0x0A, 0x3B, 0x29, 0x3B, 0xE9, 0x32, 0x0C, 0x44, 0x08, 0x33, 0xC8, 0x2A, 0x4C, 0x4C, 0x0B, 0x4C, 0x08, 0x1C, 0x67, 0x2B, 0xA8, 0x2B, 0x6B, 0x4C, 0xA7, 0x23, 0xE7, 0x23, 0x66, 0x1B, 0x68, 0x24, 0x48, 0x2C, 0x6B, 0x45, 0x0A, 0x35,
+    0x48, 0x2C, 0x6B, 0x4D, 0x07, 0x24, 0x48, 0x1D, 0x2A, 0x35, 0x6B, 0x4D, 0x53, 0x7F, 0xCC, 0x45, 0xEF, 0x5E, 0xE8, 0x34, 0xCF, 0x56, 0xAD, 0x46, 0xEB, 0x3D, 0x89, 0x35, 0x2E, 0x67, 0x0C, 0x47, 0x2A, 0x3E, 0xEC, 0x3E, 0xFF, 0xFF, 0x6C, 0x3E, 0xA9, 0x2D, 0xE9, 0x3C, 0xF7, 0xB7, 0x88, 0x44, 0x67, 0x3C, 0x2D, 0x66, 0x88, 0x44, 0x08, 0x45, 0x05, 0x2C, 0xA8, 0x44, 0xC8, 0x4C, 0xC8, 0x4C,
+    0x2B, 0x4A, 0x27, 0x29, 0x28, 0x29, 0x4C, 0x52, 0xEC, 0x49, 0x70, 0x5A, 0x4A, 0x39, 0x4C, 0x41, 0x73, 0x81, 0xED, 0x41, 0xEE, 0x51, 0x6F, 0x51, 0xFE, 0xB9, 0xD9, 0xA0, 0xF5, 0x7A, 0x6B, 0x39, 0x2D, 0x52, 0x6E, 0x59, 0x73, 0x73, 0xF6, 0x9A, 0x2B, 0x42, 0x0A, 0x3A, 0xCF, 0x53, 0x4B, 0x3A, 0x48, 0x2A, 0x29, 0x2A, 0xAC, 0x4A, 0x0B, 0x3B, 0x89, 0x32, 0xA9, 0x32, 0x4C, 0x53, 0x2C, 0x4C,
+    0x09, 0x33, 0x8D, 0x53, 0x09, 0x33, 0xA9, 0x33, 0x8D, 0x54, 0x07, 0x1C, 0x06, 0x23, 0x27, 0x23, 0x0A, 0x44, 0x05, 0x1B, 0x86, 0x13, 0x67, 0x23, 0x4D, 0x4D, 0x4D, 0x6D, 0x30, 0x5E, 0xEA, 0x34, 0x48, 0x2C, 0x09, 0x2D, 0x2A, 0x55, 0x6B, 0x4D, 0x6A, 0x3D, 0x68, 0x2C, 0x96, 0x7F, 0x8D, 0x4E, 0xC8, 0x24, 0xC8, 0x2C, 0x4A, 0x2E, 0xFF, 0xCF, 0xEE, 0x47, 0xEA, 0x2D, 0x6C, 0x46, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB7, 0x87, 0xAC, 0x4E, 0x8B, 0x46, 0x6B, 0x4E, 0xEA, 0x45, 0xFE, 0xC7, 0x28, 0x45, 0x06, 0x2C, 0xF4, 0x97, 0xA8, 0x44, 0xA9, 0x44, 0x26, 0x34, 0x0A, 0x4D, 0xE9, 0x44, 0x4A, 0x55, 0xC9, 0x39, 0x28, 0x21, 0x28, 0x29, 0x29, 0x29, 0xAA, 0x39, 0x09, 0x31, 0xFD, 0xE9, 0x2B, 0x31, 0xE9, 0x28, 0x8C, 0x39, 0x90, 0x49, 0xB7, 0x9B, 0x6D, 0x41, 0x2E, 0x49, 0x71, 0x51, 0x8A, 0x31,
+    0x0B, 0x32, 0x69, 0x29, 0x74, 0x6A, 0x32, 0x5A, 0x10, 0x5B, 0xAE, 0x4B, 0x6C, 0x42, 0x09, 0x32, 0x28, 0x2A, 0x6A, 0x3A, 0xED, 0x43, 0x28, 0x22, 0xAB, 0x42, 0x89, 0x3A, 0x67, 0x22, 0x8C, 0x4C, 0x87, 0x22, 0xC9, 0x3A, 0x2B, 0x43, 0x4C, 0x44, 0x8B, 0x44, 0x29, 0x34, 0xC6, 0x1A, 0x07, 0x23, 0x68, 0x33, 0x29, 0x34, 0x46, 0x23, 0x46, 0x1B, 0xE8, 0x3B, 0x4C, 0x55, 0x2C, 0x45, 0xAA, 0x34,
+    0x0E, 0x85, 0x89, 0x2C, 0xD9, 0x7F, 0xCB, 0x35, 0x2A, 0x55, 0x67, 0x2C, 0xAF, 0x47, 0xFF, 0xDF, 0x2C, 0x37, 0xE8, 0x24, 0xC9, 0x25, 0xD6, 0x6F, 0xFF, 0xFF, 0x8D, 0x37, 0x69, 0x35, 0xC9, 0x35, 0xF4, 0x77, 0xF4, 0x6F, 0xFC, 0xD7, 0xFD, 0xD7, 0x8B, 0x4E, 0x89, 0x45, 0x4E, 0x5F, 0xFD, 0xCF, 0xFC, 0xCF, 0x87, 0x34, 0x09, 0x4D, 0x8A, 0x4D, 0x4A, 0x4D, 0xC9, 0x44, 0x6B, 0x5D, 0xE9, 0x4C,
+    0x07, 0x21, 0x4A, 0x28, 0xE7, 0x20, 0x28, 0x29, 0x4B, 0x31, 0x89, 0x28, 0x8C, 0x40, 0x2C, 0x39, 0xF1, 0x68, 0x0C, 0x39, 0x0C, 0x39, 0xD1, 0x61, 0xF7, 0x81, 0x0D, 0x41, 0x4D, 0x49, 0xD0, 0x59, 0x2D, 0x42, 0x95, 0x59, 0x3F, 0xFF, 0x8F, 0x4B, 0x2F, 0x4C, 0xF0, 0x5A, 0xEA, 0x31, 0xA9, 0x29, 0x0A, 0x32, 0xEF, 0x4C, 0x8C, 0x42, 0xCC, 0x4A, 0x8A, 0x3A, 0xCB, 0x42, 0xAD, 0x44, 0x66, 0x22,
+    0x48, 0x2A, 0x87, 0x2A, 0xE9, 0x32, 0x49, 0x33, 0x8D, 0x4C, 0x8A, 0x3C, 0x86, 0x1A, 0xC7, 0x22, 0x27, 0x2B, 0x8E, 0x55, 0xA7, 0x2B, 0x06, 0x23, 0x86, 0x23, 0x29, 0x3C, 0x8D, 0x46, 0xA6, 0x14, 0xE7, 0x2B, 0x28, 0x2C, 0x26, 0x24, 0xFF, 0xDF, 0x2F, 0x57, 0xCB, 0x55, 0x2F, 0x5F, 0x0C, 0x2F, 0xB9, 0x77, 0xCA, 0x3D, 0x8A, 0x35, 0xAC, 0x3E, 0xB8, 0xAF, 0xD7, 0x7F, 0x48, 0x25, 0xFF, 0xFF,
+    0xF4, 0x7F, 0xFF, 0xFF, 0xAC, 0x4E, 0x0D, 0x5F, 0xF5, 0x87, 0xFF, 0xFF, 0x49, 0x45, 0xEC, 0x6E, 0xEA, 0x55, 0xC5, 0x2C, 0xFF, 0xF7, 0x69, 0x4D, 0x6A, 0x4D, 0x8A, 0x55, 0xC8, 0x34, 0x8A, 0x55, 0xA6, 0x18, 0x09, 0x29, 0x0A, 0x31, 0x2A, 0x31, 0x50, 0x5B, 0x78, 0x81, 0x31, 0x62, 0xB9, 0x91, 0xD5, 0x81, 0x77, 0x73, 0x4E, 0x41, 0x17, 0x8A, 0xF6, 0x70, 0xBF, 0xFF, 0xD5, 0x71, 0x94, 0x6A,
+    0x73, 0x72, 0x8D, 0x39, 0x8B, 0x31, 0x4A, 0x31, 0xB0, 0x4A, 0x69, 0x29, 0xC9, 0x31, 0x8E, 0x5A, 0xEF, 0x5A, 0x28, 0x2A, 0x29, 0x32, 0x28, 0x2A, 0x0C, 0x43, 0x69, 0x32, 0xEC, 0x52, 0x67, 0x2A, 0x4A, 0x43, 0x87, 0x2A, 0x26, 0x1A, 0xEC, 0x4B, 0x2A, 0x43, 0x4B, 0x44, 0xE7, 0x2A, 0xA6, 0x22, 0xE7, 0x2A, 0xC6, 0x22, 0x47, 0x23, 0xC5, 0x1A, 0x87, 0x2B, 0x8B, 0x54, 0xC7, 0x2B, 0xC8, 0x3B,
+    0xC7, 0x23, 0xAA, 0x4C, 0x07, 0x34, 0x4A, 0x35, 0xFC, 0xF7, 0x4B, 0x55, 0x0D, 0x5E, 0xB9, 0xD7, 0xE8, 0x3C, 0xE8, 0x34, 0x29, 0x3D, 0x4A, 0x3D, 0x8A, 0x3D, 0x47, 0x2D, 0x90, 0x6F, 0x68, 0x3D, 0xFF, 0xFF, 0xF7, 0xA7, 0xFF, 0xFF, 0x8C, 0x56, 0xED, 0x76, 0xF9, 0xBF, 0xFF, 0xFF, 0xEE, 0x86, 0xA9, 0x4D, 0x66, 0x2C, 0xA9, 0x4D, 0xD5, 0x7F, 0x49, 0x4D, 0x29, 0x4D, 0x25, 0x24, 0x8F, 0x5F,
+    0xC9, 0x28, 0xC9, 0x28, 0xEA, 0x28, 0x89, 0x28, 0x71, 0x61, 0x71, 0x59, 0x56, 0x81, 0x5F, 0xFF, 0x18, 0xA1, 0xD1, 0x50, 0x7A, 0x89, 0x5F, 0xD9, 0xFF, 0xFF, 0x94, 0x69, 0x75, 0x72, 0x4C, 0x31, 0x4E, 0x4A, 0x0C, 0x42, 0xB0, 0x52, 0x91, 0x62, 0x0B, 0x3A, 0xCA, 0x31, 0x0C, 0x42, 0xEE, 0x4A, 0x4A, 0x32, 0x2A, 0x32, 0x2B, 0x3A, 0x2C, 0x4B, 0x8B, 0x3A, 0x28, 0x2A, 0xE6, 0x21, 0x48, 0x2A,
+    0x67, 0x22, 0xEB, 0x4A, 0xEA, 0x3A, 0xA7, 0x2A, 0xCB, 0x4B, 0x0A, 0x44, 0x66, 0x22, 0x66, 0x22, 0xA6, 0x2A, 0x65, 0x1A, 0x2A, 0x3C, 0xC5, 0x1A, 0xEB, 0x5B, 0x8A, 0x4C, 0x88, 0x2B, 0x67, 0x2B, 0xA7, 0x33, 0x0B, 0x55, 0x45, 0x23, 0x0E, 0x76, 0x07, 0x34, 0x07, 0x2C, 0xED, 0x5D, 0x0A, 0x76, 0xA7, 0x34, 0x88, 0x34, 0x07, 0x2D, 0x6B, 0x66, 0xCB, 0x45, 0xC7, 0x2C, 0xEA, 0x4D, 0xFF, 0xFF,
+    0x2A, 0x4E, 0xCE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x87, 0xCD, 0x76, 0xAC, 0x66, 0xB5, 0xBF, 0x2D, 0x6F, 0x08, 0x45, 0x8A, 0x55, 0x49, 0x4D, 0x29, 0x4D, 0xEB, 0x55, 0xC8, 0x44, 0x28, 0x45, 0xA7, 0x18, 0x4E, 0x49, 0xEB, 0x28, 0xB1, 0x51, 0x0E, 0x49, 0xB0, 0x50, 0x3F, 0xDA, 0x92, 0x59, 0x36, 0x7A, 0xB7, 0x78, 0x5E, 0x91, 0xFB, 0xA0, 0x54, 0x71, 0x39, 0x8A, 0xED, 0x41, 0x10, 0x42,
+    0x8F, 0x52, 0xF2, 0x5A, 0xAF, 0x5A, 0x27, 0x21, 0xEA, 0x39, 0x4C, 0x43, 0x30, 0x4B, 0xEA, 0x31, 0xA7, 0x21, 0x32, 0x93, 0xC8, 0x29, 0xEB, 0x4A, 0x28, 0x32, 0xF1, 0x7A, 0xC6, 0x19, 0xCC, 0x4B, 0xE6, 0x19, 0xEA, 0x42, 0x48, 0x32, 0x87, 0x2A, 0xAB, 0x43, 0x29, 0x2B, 0x25, 0x1A, 0x86, 0x2A, 0x66, 0x22, 0x44, 0x12, 0x2B, 0x4C, 0x35, 0x6F, 0x48, 0x33, 0xAB, 0x4C, 0xA8, 0x33, 0xEC, 0x54,
+    0x6A, 0x4C, 0x28, 0x3C, 0x4B, 0x55, 0xE7, 0x33, 0xCA, 0x54, 0x84, 0x23, 0x0A, 0x45, 0x67, 0x3C, 0x6A, 0x5D, 0x66, 0x34, 0xE9, 0x44, 0xAC, 0x46, 0xEA, 0x55, 0xA8, 0x34, 0x69, 0x45, 0xFE, 0xEF, 0xFF, 0xFF, 0x48, 0x45, 0xCB, 0x66, 0xFF, 0xFF, 0xF0, 0x87, 0xCE, 0x6F, 0x68, 0x4D, 0x87, 0x3D, 0xFF, 0xFF, 0x8C, 0x5E, 0x93, 0x9F, 0x28, 0x45, 0x4B, 0x5E, 0x49, 0x55, 0x29, 0x55, 0x8A, 0x55,
+    0xE9, 0x28, 0x11, 0x62, 0xCA, 0x28, 0xCC, 0x38, 0xAD, 0x38, 0x0E, 0x41, 0xF8, 0x8A, 0x2E, 0x41, 0x14, 0x69, 0x75, 0x78, 0x77, 0x81, 0xCF, 0x38, 0x7A, 0x9A, 0x4F, 0x41, 0x6C, 0x31, 0xCC, 0x39, 0x11, 0x53, 0x4E, 0x4A, 0x28, 0x21, 0x07, 0x19, 0xC9, 0x29, 0x0F, 0x4B, 0x89, 0x29, 0xA8, 0x31, 0xC8, 0x29, 0x08, 0x2A, 0xAE, 0x4B, 0x67, 0x21, 0x29, 0x32, 0x07, 0x22, 0x4A, 0x32, 0xED, 0x53,
+    0x27, 0x2A, 0x28, 0x2A, 0x06, 0x22, 0x87, 0x2A, 0x4C, 0x54, 0x65, 0x22, 0x26, 0x22, 0x26, 0x22, 0x05, 0x12, 0x2B, 0x44, 0x69, 0x3B, 0x65, 0x1A, 0x28, 0x2B, 0xE6, 0x22, 0x47, 0x2B, 0xA8, 0x43, 0x26, 0x23, 0x8B, 0x54, 0x4B, 0x4D, 0xE8, 0x43, 0xFF, 0xFF, 0x27, 0x3C, 0x87, 0x44, 0xAD, 0x66, 0x08, 0x55, 0x45, 0x34, 0x46, 0x34, 0x88, 0x3C, 0xC9, 0x3D, 0x49, 0x45, 0x29, 0x4D, 0x69, 0x4D,
+    0xFE, 0xFF, 0x2D, 0x57, 0x08, 0x3D, 0x27, 0x3D, 0xE8, 0x3D, 0xDA, 0xC7, 0x0A, 0x46, 0x65, 0x44, 0xF0, 0x9F, 0xAC, 0x5E, 0x6F, 0x6E, 0x69, 0x4D, 0xE8, 0x44, 0xE8, 0x44, 0xF3, 0x8F, 0x87, 0x3C, 0xC8, 0x20, 0xA9, 0x20, 0xCB, 0x30, 0xEB, 0x30, 0xAB, 0x28, 0xAA, 0x28, 0xAC, 0x30, 0x74, 0x69, 0xCF, 0x48, 0xCD, 0x38, 0xCE, 0x38, 0xBD, 0xB1, 0x57, 0x81, 0x2E, 0x41, 0x4C, 0x31, 0xF4, 0x62,
+    0x4A, 0x31, 0x28, 0x21, 0x27, 0x21, 0x52, 0x62, 0x70, 0x53, 0xA9, 0x31, 0x88, 0x29, 0x09, 0x3A, 0x49, 0x32, 0x2E, 0x53, 0x88, 0x29, 0xE7, 0x21, 0xCB, 0x42, 0xA9, 0x3A, 0x08, 0x2A, 0xE8, 0x21, 0x0D, 0x64, 0x26, 0x22, 0x67, 0x2A, 0x06, 0x1A, 0x0B, 0x4C, 0x31, 0xBD, 0x05, 0x1A, 0xE4, 0x11, 0xE3, 0x09, 0xEC, 0x54, 0x68, 0x2B, 0x03, 0x0A, 0x47, 0x33, 0x27, 0x2B, 0xEB, 0x44, 0x06, 0x23,
+    0x84, 0x12, 0xAA, 0x54, 0xDB, 0xBF, 0xAC, 0x5D, 0x23, 0x1B, 0xC9, 0x54, 0x87, 0x34, 0x27, 0x65, 0x4C, 0x5E, 0x25, 0x34, 0x29, 0x55, 0x09, 0x4D, 0x08, 0x34, 0x2B, 0x4E, 0x09, 0x45, 0x4A, 0x4D, 0x12, 0x97, 0xFC, 0xE7, 0xED, 0x66, 0xEB, 0x4D, 0x89, 0x4D, 0x27, 0x45, 0xA6, 0x2C, 0xE5, 0x2B, 0x8B, 0x75, 0xE6, 0x33, 0x44, 0x23, 0xAC, 0x65, 0xC8, 0x44, 0x46, 0x3C, 0x46, 0x34, 0x28, 0x45,
+    0xA8, 0x20, 0xA8, 0x20, 0xCA, 0x28, 0xAB, 0x28, 0xD0, 0x52, 0xEC, 0x30, 0x35, 0x88, 0xEF, 0x48, 0xED, 0x40, 0x51, 0x49, 0x93, 0x58, 0x3F, 0xFF, 0x93, 0x50, 0x0D, 0x39, 0x50, 0x49, 0x4F, 0x49, 0xE8, 0x20, 0xE7, 0x18, 0x90, 0x51, 0x09, 0x29, 0xF1, 0x5B, 0x8A, 0x29, 0x2B, 0x31, 0xD0, 0x5A, 0x47, 0x21, 0x47, 0x19, 0xCA, 0x39, 0x87, 0x21, 0x2B, 0x3A, 0x65, 0x19, 0x65, 0x19, 0x49, 0x3A,
+    0x0B, 0x43, 0x69, 0x3A, 0x27, 0x32, 0xE6, 0x21, 0x8A, 0x42, 0x46, 0x22, 0xE4, 0x19, 0xA3, 0x11, 0xE4, 0x19, 0xC6, 0x2A, 0xA6, 0x22, 0x03, 0x12, 0x89, 0x43, 0xA9, 0x53, 0xE6, 0x2A, 0x85, 0x1A, 0x44, 0x12, 0x8C, 0x5C, 0x66, 0x33, 0x06, 0x2B, 0xC4, 0x1A, 0xAE, 0x7D, 0xCA, 0x4C, 0xEA, 0x5C, 0x8E, 0x86, 0x8A, 0x4C, 0x27, 0x44, 0x89, 0x5C, 0x85, 0x23, 0x25, 0x1B, 0xEB, 0x5D, 0xC5, 0x23,
+    0xC6, 0x2B, 0xC6, 0x2B, 0xF9, 0xAF, 0x4E, 0x6F, 0xC5, 0x2B, 0x07, 0x34, 0x47, 0x34, 0x03, 0x1C, 0x06, 0x2C, 0x67, 0x3C, 0x84, 0x23, 0xE8, 0x44, 0x67, 0x3C, 0x6A, 0x55, 0xE8, 0x44, 0xA8, 0x44, 0xAA, 0x28, 0x90, 0x50, 0xCB, 0x30, 0xAA, 0x28, 0x70, 0x40, 0x7A, 0x88, 0xD0, 0x48, 0xCE, 0x38, 0x8E, 0x40, 0x1D, 0xB0, 0x5F, 0xFD, 0x94, 0x60, 0xCE, 0x40, 0xF7, 0x68, 0xD0, 0x48, 0xEC, 0x30,
+    0xC8, 0x18, 0xE9, 0x28, 0x4B, 0x29, 0x69, 0x29, 0x29, 0x29, 0xCE, 0x41, 0xAC, 0x39, 0x27, 0x21, 0xC9, 0x31, 0x68, 0x29, 0x67, 0x21, 0xA7, 0x21, 0xC7, 0x21, 0x4A, 0x42, 0x65, 0x19, 0x65, 0x11, 0x65, 0x11, 0x28, 0x32, 0xA5, 0x19, 0x06, 0x22, 0x4A, 0x4B, 0x47, 0x2A, 0xC4, 0x19, 0xA3, 0x11, 0xE4, 0x11, 0xE4, 0x11, 0x46, 0x22, 0x24, 0x1A, 0xA6, 0x2A, 0x88, 0x43, 0xC6, 0x2A, 0x48, 0x3B,
+    0x0A, 0x54, 0xA5, 0x22, 0x0D, 0x6D, 0xC6, 0x22, 0x6A, 0x54, 0xA4, 0x1A, 0x86, 0x33, 0x45, 0x2B, 0xCA, 0x54, 0x66, 0x2B, 0xC7, 0x33, 0xE9, 0x54, 0x85, 0x23, 0xC3, 0x12, 0x45, 0x23, 0x05, 0x24, 0xF2, 0x87, 0x45, 0x23, 0x65, 0x23, 0x2D, 0x6E, 0x48, 0x45, 0xE7, 0x33, 0x27, 0x3C, 0x27, 0x3C, 0x8B, 0x5D, 0x28, 0x4D, 0x27, 0x3C, 0xA7, 0x44, 0x09, 0x4D, 0x06, 0x34, 0xA8, 0x44, 0x86, 0x3C,
+    0xEB, 0x30, 0x8A, 0x28, 0xEC, 0x30, 0x78, 0x79, 0x2F, 0x30, 0x90, 0x48, 0xB0, 0x48, 0xAF, 0x40, 0x3F, 0xDA, 0xFF, 0xFA, 0x1A, 0x78, 0x11, 0x48, 0x1B, 0xA8, 0xBF, 0xC1, 0xCD, 0x38, 0x4D, 0x39, 0xCA, 0x20, 0x34, 0x5A, 0xE7, 0x18, 0x69, 0x29, 0x6C, 0x31, 0x29, 0x29, 0xF0, 0x5A, 0x27, 0x21, 0x07, 0x19, 0x25, 0x19, 0x46, 0x19, 0x66, 0x19, 0xC8, 0x29, 0x46, 0x19, 0x08, 0x32, 0x65, 0x19,
+    0x85, 0x19, 0xA5, 0x19, 0xE6, 0x21, 0xC5, 0x19, 0xA4, 0x19, 0x47, 0x2A, 0xA4, 0x11, 0xA4, 0x11, 0xC4, 0x19, 0xC3, 0x11, 0x66, 0x22, 0x04, 0x1A, 0xA6, 0x2A, 0x24, 0x1A, 0x85, 0x22, 0x24, 0x1A, 0xA5, 0x22, 0x26, 0x33, 0x02, 0x12, 0x47, 0x33, 0x0A, 0x65, 0xE5, 0x22, 0x46, 0x2B, 0x89, 0x44, 0xE4, 0x22, 0x46, 0x2B, 0x6C, 0x6D, 0xC4, 0x1A, 0x04, 0x23, 0xC3, 0x12, 0xC4, 0x1A, 0x04, 0x23,
+    0xE4, 0x2B, 0xA3, 0x12, 0x25, 0x23, 0x45, 0x2B, 0x29, 0x4D, 0xA6, 0x2B, 0x27, 0x44, 0xC6, 0x33, 0x06, 0x3C, 0xA8, 0x44, 0xA9, 0x4C, 0x87, 0x44, 0x68, 0x3C, 0x47, 0x3C, 0x67, 0x3C, 0x26, 0x34, 0x6A, 0x20, 0x2F, 0x41, 0x6F, 0x49, 0x4D, 0x30, 0x6C, 0x28, 0xAA, 0x28, 0x56, 0x72, 0x35, 0x61, 0x1B, 0x70, 0x15, 0x61, 0x73, 0x48, 0x98, 0x71, 0xD9, 0x88, 0x11, 0x38, 0x0F, 0x39, 0xF8, 0x69,
+    0x33, 0x52, 0xE9, 0x20, 0xE8, 0x18, 0x2A, 0x29, 0x4B, 0x29, 0xD0, 0x52, 0x07, 0x19, 0x07, 0x21, 0x2D, 0x52, 0x67, 0x21, 0xED, 0x42, 0x87, 0x21, 0x47, 0x21, 0x45, 0x19, 0x65, 0x19, 0x0B, 0x3B, 0x8A, 0x42, 0x86, 0x19, 0xC6, 0x21, 0xC8, 0x21, 0x6A, 0x43, 0x28, 0x2A, 0x83, 0x11, 0xA4, 0x19, 0x83, 0x09, 0x48, 0x33, 0x26, 0x22, 0xC3, 0x11, 0xA7, 0x32, 0x0B, 0x5C, 0x65, 0x22, 0x04, 0x1A,
+    0x27, 0x33, 0x27, 0x3B, 0xA5, 0x22, 0x4C, 0x7D, 0xF2, 0xDF, 0xC8, 0x43, 0xC5, 0x22, 0xA8, 0x44, 0xC9, 0x5C, 0x45, 0x33, 0x46, 0x2B, 0x25, 0x23, 0xA2, 0x0A, 0x44, 0x23, 0xA7, 0x44, 0xC4, 0x22, 0xC4, 0x1A, 0xAA, 0x4D, 0x27, 0x34, 0x05, 0x23, 0x45, 0x2B, 0x85, 0x2B, 0x49, 0x4D, 0x48, 0x44, 0x47, 0x44, 0x88, 0x4C, 0x48, 0x44, 0x09, 0x4D, 0xE6, 0x33, 0x47, 0x44, 0xC5, 0x2B, 0xA7, 0x44,
+    0x71, 0x62, 0x78, 0x40, 0x4A, 0x20, 0xCA, 0x28, 0xA9, 0x20, 0xD2, 0x62, 0x8C, 0x30, 0x9A, 0xAA, 0x6E, 0x30, 0xD1, 0x48, 0xF4, 0x51, 0x7F, 0xFF, 0xF1, 0x40, 0x70, 0x38, 0x10, 0x49, 0x72, 0x52, 0xCA, 0x28, 0xE9, 0x20, 0xC8, 0x20, 0x8A, 0x31, 0x2A, 0x21, 0x08, 0x21, 0xCD, 0x49, 0x28, 0x21, 0x27, 0x21, 0x07, 0x19, 0x06, 0x11, 0x67, 0x21, 0xA8, 0x29, 0x45, 0x19, 0xC6, 0x19, 0x65, 0x19,
+    0x45, 0x11, 0x65, 0x19, 0x85, 0x19, 0xA5, 0x19, 0x2A, 0x43, 0x51, 0x75, 0x83, 0x11, 0x84, 0x11, 0x84, 0x11, 0x28, 0x33, 0x05, 0x1A, 0xC4, 0x11, 0xE4, 0x19, 0x2C, 0x5C, 0x8A, 0x54, 0x24, 0x1A, 0xAA, 0x4B, 0x64, 0x22, 0x03, 0x12, 0xAE, 0x7D, 0xD3, 0xD7, 0x26, 0x33, 0xE4, 0x2A, 0xF0, 0xB6, 0x29, 0x4D, 0xA4, 0x22, 0x4B, 0x65, 0xEB, 0x75, 0x83, 0x12, 0x65, 0x2B, 0xA3, 0x1A, 0x28, 0x44,
+    0xA4, 0x1A, 0x29, 0x44, 0x06, 0x34, 0xC3, 0x1A, 0x66, 0x33, 0x86, 0x33, 0xC6, 0x3B, 0x23, 0x1B, 0xC8, 0x4C, 0x07, 0x3C, 0x85, 0x2B, 0x27, 0x3C, 0xEA, 0x54, 0x47, 0x44, 0xE6, 0x33, 0x85, 0x2B, 0x8D, 0x30, 0x8D, 0x49, 0xA9, 0x20, 0x88, 0x20, 0x73, 0x62, 0x17, 0x71, 0x6A, 0x20, 0x8B, 0x20, 0x6C, 0x28, 0x13, 0x48, 0xBF, 0xF4, 0x32, 0x51, 0x4D, 0x28, 0x70, 0x38, 0xFF, 0xFF, 0x34, 0x5A,
+    0xCA, 0x20, 0xEA, 0x28, 0xA9, 0x18, 0xE8, 0x20, 0x11, 0x4B, 0xAE, 0x41, 0xE8, 0x18, 0x4F, 0x4A, 0xE6, 0x10, 0x8C, 0x3A, 0x27, 0x19, 0x88, 0x29, 0xA7, 0x29, 0x0A, 0x3A, 0x46, 0x19, 0x25, 0x11, 0x65, 0x19, 0x44, 0x11, 0x86, 0x21, 0x85, 0x19, 0x68, 0x2A, 0xE6, 0x21, 0x64, 0x11, 0x84, 0x11, 0x84, 0x11, 0x4B, 0x44, 0x05, 0x1A, 0xA3, 0x11, 0xA3, 0x11, 0x89, 0x43, 0x29, 0x44, 0xE3, 0x11,
+    0x24, 0x1A, 0x44, 0x1A, 0x24, 0x1A, 0x29, 0x44, 0xEC, 0x6C, 0xA4, 0x2A, 0x84, 0x22, 0xF3, 0xF7, 0xAA, 0x5C, 0x63, 0x22, 0xCD, 0x75, 0xCF, 0x9F, 0xC4, 0x1A, 0x84, 0x1A, 0x61, 0x12, 0x82, 0x1A, 0x63, 0x12, 0x84, 0x1A, 0x84, 0x1A, 0xE4, 0x23, 0x66, 0x33, 0xC6, 0x43, 0xA6, 0x3B, 0x47, 0x4C, 0x27, 0x3C, 0xC6, 0x33, 0xC7, 0x3B, 0xA6, 0x33, 0x44, 0x23, 0xC5, 0x33, 0xC6, 0x33, 0xA6, 0x33,
+    0x88, 0x18, 0x4B, 0x31, 0x88, 0x18, 0xCA, 0x28, 0xAB, 0x30, 0x89, 0x20, 0x88, 0x18, 0x8A, 0x20, 0xDF, 0xB1, 0xF4, 0x58, 0x8E, 0x30, 0xB0, 0x38, 0xD2, 0x50, 0xDF, 0xA0, 0x90, 0x30, 0x8C, 0x28, 0xB1, 0x51, 0x93, 0x28, 0xF1, 0x38, 0xC8, 0x18, 0xAE, 0x39, 0xC9, 0x20, 0x13, 0x5A, 0xC8, 0x18, 0x49, 0x29, 0x67, 0x21, 0x07, 0x19, 0x6C, 0x42, 0x46, 0x19, 0x67, 0x21, 0x46, 0x21, 0x29, 0x32,
+    0x25, 0x19, 0x44, 0x19, 0x65, 0x19, 0x44, 0x11, 0xC9, 0x3A, 0xE6, 0x21, 0x84, 0x19, 0x64, 0x19, 0x84, 0x19, 0xA7, 0x32, 0xE5, 0x19, 0x83, 0x11, 0xA3, 0x11, 0x48, 0x3B, 0x25, 0x22, 0x04, 0x1A, 0xE3, 0x19, 0x24, 0x1A, 0xA8, 0x43, 0x44, 0x22, 0x28, 0x54, 0x63, 0x22, 0xA4, 0x22, 0x69, 0x6D, 0xC6, 0x4B, 0x23, 0x1A, 0xC6, 0x43, 0x28, 0x44, 0x43, 0x12, 0x63, 0x1A, 0xE5, 0x22, 0x46, 0x33,
+    0xA8, 0x4C, 0x43, 0x1A, 0x43, 0x1A, 0x43, 0x1A, 0xA8, 0x44, 0x46, 0x33, 0xA4, 0x22, 0x24, 0x2B, 0x65, 0x2B, 0x88, 0x44, 0x87, 0x33, 0x87, 0x33, 0x86, 0x33, 0x86, 0x33, 0xE6, 0x3B, 0x07, 0x3C, 0xA8, 0x20, 0x88, 0x20, 0xC9, 0x28, 0x4B, 0x28, 0x88, 0x18, 0x88, 0x20, 0x88, 0x18, 0xA9, 0x20, 0x8E, 0x38, 0x2D, 0x20, 0x8D, 0x28, 0x11, 0x30, 0x70, 0x38, 0x72, 0x30, 0x6E, 0x28, 0x8E, 0x30,
+    0xCC, 0x28, 0x8B, 0x20, 0xAA, 0x20, 0xC8, 0x20, 0xCA, 0x20, 0xE9, 0x20, 0xC8, 0x20, 0xE8, 0x20, 0x0E, 0x52, 0x28, 0x21, 0x07, 0x19, 0x07, 0x19, 0xAA, 0x31, 0x05, 0x19, 0x25, 0x19, 0x49, 0x3A, 0xE8, 0x29, 0x65, 0x19, 0x44, 0x19, 0x85, 0x19, 0xA5, 0x19, 0xA5, 0x19, 0x64, 0x19, 0x64, 0x19, 0xC5, 0x21, 0x84, 0x19, 0xA4, 0x11, 0x63, 0x11, 0xC4, 0x19, 0x86, 0x32, 0xE4, 0x19, 0xE4, 0x19,
+    0xE3, 0x19, 0x89, 0x4B, 0x24, 0x1A, 0xA5, 0x2A, 0x84, 0x22, 0x88, 0x43, 0xA5, 0x2A, 0xC1, 0x22, 0x8A, 0x75, 0xC1, 0x09, 0xCC, 0x7D, 0xEF, 0xBF, 0x01, 0x0A, 0xC7, 0x3B, 0xC6, 0x33, 0x85, 0x2B, 0x05, 0x2B, 0x67, 0x3C, 0x22, 0x12, 0x43, 0x1A, 0x65, 0x3B, 0x44, 0x2B, 0xC3, 0x22, 0xA6, 0x3B, 0x25, 0x2B, 0xE4, 0x2A, 0x65, 0x33, 0xC4, 0x22, 0x25, 0x2B, 0xA3, 0x1A, 0x45, 0x33, 0xE7, 0x3B,
+    0xA8, 0x20, 0x8B, 0x20, 0x33, 0x49, 0x16, 0x6A, 0xA9, 0x20, 0x2A, 0x18, 0xD3, 0x61, 0x1C, 0xA0, 0x71, 0x51, 0x9B, 0x81, 0x4F, 0x30, 0x7B, 0x70, 0x0D, 0x28, 0xD2, 0x40, 0x72, 0x38, 0x50, 0x30, 0x1E, 0x93, 0xAC, 0x28, 0xCB, 0x28, 0xEA, 0x28, 0xCA, 0x20, 0x7F, 0x43, 0xE9, 0x28, 0xA8, 0x18, 0x8B, 0x31, 0x48, 0x29, 0x6E, 0x3A, 0x27, 0x21, 0x48, 0x29, 0x25, 0x21, 0xA8, 0x29, 0xAB, 0x3A,
+    0xA6, 0x29, 0x86, 0x21, 0x24, 0x19, 0x65, 0x19, 0x0A, 0x3B, 0xC5, 0x21, 0x44, 0x19, 0x23, 0x11, 0x64, 0x19, 0xA7, 0x32, 0xA4, 0x19, 0x84, 0x19, 0xC4, 0x19, 0xE5, 0x21, 0xE4, 0x19, 0x83, 0x11, 0xC3, 0x19, 0xE4, 0x19, 0xE4, 0x19, 0xC5, 0x2A, 0x46, 0x3B, 0xA5, 0x32, 0x43, 0x22, 0x26, 0x44, 0x27, 0x54, 0xE5, 0x32, 0xCB, 0x7D, 0xAF, 0xAF, 0x40, 0x0A, 0xA6, 0x3B, 0xA5, 0x2B, 0x47, 0x3C,
+    0x89, 0x4C, 0x41, 0x0A, 0x23, 0x1A, 0x02, 0x12, 0x04, 0x2B, 0xAA, 0x5C, 0xA6, 0x3B, 0x66, 0x3B, 0xE5, 0x2A, 0xE4, 0x22, 0xC4, 0x22, 0x01, 0x12, 0xE4, 0x22, 0x04, 0x2B, 0x45, 0x2B, 0xE4, 0x22, 0x0B, 0x29, 0x4A, 0x20, 0x6A, 0x20, 0xCA, 0x28, 0xA8, 0x20, 0xD8, 0x69, 0x6C, 0x30, 0x2F, 0x41, 0xEE, 0x40, 0x57, 0x60, 0x7E, 0xBA, 0x14, 0x40, 0x2F, 0x30, 0x16, 0x40, 0xFF, 0xFF, 0x79, 0x50,
+    0x90, 0x38, 0x6E, 0x30, 0x6D, 0x30, 0xB4, 0x51, 0xAB, 0x28, 0xAA, 0x28, 0xE8, 0x28, 0xAE, 0x41, 0xE8, 0x20, 0x28, 0x21, 0x07, 0x21, 0x27, 0x21, 0x06, 0x21, 0x26, 0x21, 0x45, 0x19, 0x25, 0x19, 0xCB, 0x42, 0x44, 0x19, 0x24, 0x19, 0x44, 0x19, 0xA8, 0x32, 0xA5, 0x19, 0x23, 0x11, 0x24, 0x19, 0x44, 0x19, 0x05, 0x22, 0xA4, 0x19, 0x63, 0x19, 0xA4, 0x19, 0x28, 0x3B, 0x68, 0x43, 0xA3, 0x11,
+    0xA3, 0x19, 0x25, 0x22, 0xE3, 0x19, 0x8C, 0x64, 0xC5, 0x32, 0x44, 0x22, 0xE2, 0x11, 0xE6, 0x4B, 0x88, 0x4C, 0x2A, 0x5C, 0xC8, 0x43, 0xAC, 0x96, 0x21, 0x12, 0x88, 0x4C, 0x43, 0x1B, 0xCA, 0x65, 0x29, 0x4D, 0xE3, 0x11, 0x09, 0x44, 0x24, 0x2B, 0x65, 0x33, 0x83, 0x1A, 0xE1, 0x09, 0xE7, 0x3B, 0x83, 0x1A, 0xA4, 0x22, 0x84, 0x22, 0xC2, 0x11, 0xE7, 0x3B, 0x65, 0x33, 0x46, 0x33, 0x84, 0x22,
+    0x4C, 0x39, 0x88, 0x20, 0x68, 0x18, 0x27, 0x10, 0x8D, 0x30, 0xB2, 0x51, 0x6A, 0x28, 0x6C, 0x30, 0x4C, 0x30, 0x30, 0x38, 0xBF, 0xDB, 0x32, 0x40, 0x37, 0x58, 0x1B, 0x60, 0x1C, 0x58, 0xB9, 0x69, 0x50, 0x38, 0x15, 0x50, 0x75, 0x60, 0x70, 0x40, 0xB4, 0x5A, 0xCB, 0x30, 0xAB, 0x38, 0xC8, 0x20, 0xC7, 0x20, 0xCE, 0x4A, 0xE7, 0x20, 0x2B, 0x42, 0xE5, 0x18, 0xE5, 0x18, 0x06, 0x19, 0x04, 0x19,
+    0x24, 0x19, 0x24, 0x19, 0x24, 0x19, 0xA6, 0x21, 0xA9, 0x42, 0x85, 0x21, 0x44, 0x19, 0x25, 0x21, 0x44, 0x19, 0x89, 0x3B, 0x84, 0x19, 0x64, 0x21, 0x84, 0x19, 0x43, 0x11, 0xE9, 0x43, 0x83, 0x19, 0xC4, 0x19, 0xC4, 0x19, 0x8B, 0x6C, 0x8A, 0x44, 0x44, 0x2A, 0x03, 0x22, 0x44, 0x22, 0xE5, 0x3A, 0x42, 0x1A, 0x65, 0x2A, 0xAA, 0x5C, 0xE6, 0x43, 0xE0, 0x01, 0x65, 0x33, 0x07, 0x34, 0x26, 0x3C,
+    0x6A, 0x5D, 0xE0, 0x01, 0xA4, 0x22, 0x62, 0x12, 0xC6, 0x43, 0xE3, 0x2A, 0xC1, 0x09, 0x83, 0x1A, 0xE4, 0x2A, 0xE7, 0x43, 0x84, 0x22, 0xE2, 0x11, 0x43, 0x1A, 0x63, 0x1A, 0x26, 0x33, 0x05, 0x33, 0x86, 0x18, 0x86, 0x18, 0x86, 0x18, 0xAA, 0x28, 0xF1, 0x48, 0x48, 0x20, 0x4A, 0x28, 0x6B, 0x30, 0x19, 0x79, 0x10, 0x40, 0x12, 0x48, 0x15, 0x58, 0x1E, 0xB0, 0xFF, 0xFF, 0x38, 0x58, 0x34, 0x58,
+    0x12, 0x40, 0x5F, 0xE6, 0x58, 0x68, 0xAE, 0x48, 0x8A, 0x28, 0x8A, 0x20, 0xF0, 0x49, 0x4E, 0x52, 0xA6, 0x18, 0x29, 0x21, 0xE7, 0x20, 0x2C, 0x3A, 0xE5, 0x20, 0xE5, 0x18, 0x05, 0x19, 0xC4, 0x10, 0x04, 0x11, 0x24, 0x19, 0x03, 0x11, 0x45, 0x21, 0xA9, 0x3A, 0x64, 0x19, 0x24, 0x19, 0x45, 0x29, 0x24, 0x21, 0x03, 0x19, 0x84, 0x19, 0x64, 0x21, 0x64, 0x19, 0x44, 0x19, 0x63, 0x19, 0x84, 0x19,
+    0xA3, 0x19, 0xA3, 0x19, 0x07, 0x3B, 0xE4, 0x19, 0x24, 0x22, 0xE3, 0x21, 0x24, 0x22, 0x04, 0x1A, 0xE2, 0x19, 0x03, 0x1A, 0x03, 0x1A, 0x4C, 0x6D, 0xC1, 0x09, 0x85, 0x33, 0x86, 0x33, 0x69, 0x5D, 0xA9, 0x55, 0x61, 0x0A, 0x87, 0x3B, 0x05, 0x2B, 0x85, 0x2B, 0xA6, 0x3B, 0xA0, 0x01, 0x84, 0x22, 0xA0, 0x09, 0xE2, 0x11, 0x23, 0x1A, 0xC2, 0x11, 0x84, 0x22, 0xA4, 0x22, 0x63, 0x22, 0xA4, 0x22,
+    0xA6, 0x18, 0x66, 0x10, 0x67, 0x18, 0x67, 0x18, 0x68, 0x20, 0x0A, 0x28, 0x49, 0x28, 0x2F, 0x41, 0x2B, 0x28, 0x4D, 0x30, 0x32, 0x48, 0x17, 0x60, 0x1B, 0x78, 0x1B, 0x70, 0x35, 0x58, 0x31, 0x40, 0x31, 0x40, 0x11, 0x40, 0x10, 0x50, 0xED, 0x48, 0xAB, 0x28, 0xB3, 0x38, 0x8A, 0x28, 0xC9, 0x30, 0xE8, 0x28, 0xC7, 0x18, 0x2A, 0x31, 0x28, 0x31, 0xC6, 0x20, 0x27, 0x39, 0x05, 0x21, 0x0C, 0x5B,
+    0x05, 0x19, 0x04, 0x19, 0x24, 0x19, 0x45, 0x21, 0xEB, 0x52, 0x64, 0x19, 0x45, 0x21, 0x45, 0x21, 0x03, 0x19, 0x09, 0x43, 0x85, 0x21, 0x44, 0x29, 0x64, 0x19, 0xA4, 0x21, 0xA3, 0x19, 0x63, 0x19, 0x63, 0x11, 0xA4, 0x21, 0x86, 0x2A, 0xC3, 0x19, 0xC4, 0x21, 0xC4, 0x21, 0xE3, 0x21, 0xE9, 0x4B, 0x06, 0x3B, 0x64, 0x2A, 0x43, 0x22, 0x08, 0x4C, 0x80, 0x01, 0x86, 0x3B, 0xA6, 0x2B, 0xE8, 0x4C,
+    0x47, 0x3C, 0xC7, 0x3B, 0xE7, 0x3B, 0x65, 0x33, 0x25, 0x2B, 0xC2, 0x1A, 0x63, 0x1A, 0x83, 0x22, 0x80, 0x01, 0xE2, 0x11, 0x63, 0x1A, 0x84, 0x22, 0x44, 0x22, 0x84, 0x22, 0x84, 0x22, 0x43, 0x1A, 0x66, 0x10, 0x48, 0x20, 0x70, 0x49, 0x89, 0x28, 0x49, 0x28, 0x6B, 0x30, 0x2E, 0x38, 0xD5, 0x60, 0x2E, 0x48, 0x6D, 0x38, 0x39, 0x70, 0x1E, 0x99, 0x14, 0x50, 0x37, 0x68, 0x76, 0x60, 0x54, 0x58,
+    0xDF, 0xFF, 0x34, 0x60, 0xB0, 0x60, 0xAD, 0x48, 0x8C, 0x30, 0xDF, 0xF6, 0xCB, 0x30, 0xEB, 0x40, 0xCA, 0x38, 0xE8, 0x28, 0xFE, 0x10, 0x0A, 0x49, 0x09, 0x39, 0x27, 0x31, 0x06, 0x21, 0xAB, 0x42, 0x05, 0x29, 0x05, 0x21, 0x05, 0x29, 0x25, 0x29, 0x69, 0x3A, 0x24, 0x19, 0x25, 0x21, 0x25, 0x29, 0x45, 0x21, 0x84, 0x21, 0x64, 0x21, 0x44, 0x29, 0x84, 0x21, 0x43, 0x21, 0x64, 0x21, 0x64, 0x21,
+    0x63, 0x21, 0x83, 0x21, 0x84, 0x21, 0xA4, 0x21, 0xC4, 0x21, 0xA3, 0x19, 0xA3, 0x19, 0xA2, 0x19, 0x64, 0x2A, 0x64, 0x2A, 0x63, 0x22, 0x84, 0x2A, 0xA1, 0x11, 0xE4, 0x2A, 0x86, 0x33, 0x26, 0x3C, 0xE8, 0x4C, 0xEA, 0x54, 0x06, 0x3C, 0x65, 0x2B, 0x25, 0x2B, 0x24, 0x2B, 0xA4, 0x22, 0x63, 0x22, 0x02, 0x1A, 0x84, 0x22, 0xA1, 0x09, 0xE2, 0x11, 0x03, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x64, 0x22,
 };
 const lv_img_dsc_t ui_img_helix_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_helix_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_helix_80_png_data
 };
 
@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Life_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_life_80_png_data[] = {
-    0xA6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xAC, 0x61, 0xFF, 0x85, 0x20, 0xFF, 0xA6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xC6, 0x28, 0xFF, 0x07, 0x31, 0xFF, 0x0E, 0x6A, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xC6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xCC, 0x61, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0x08, 0x39, 0xFF, 0x06, 0x39, 0xFF, 0xCC, 0x61, 0xFF, 0xA7, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0xE7, 0x30, 0xFF, 0xE6, 0x30, 0xFF, 0x32, 0x7A, 0xFF, 0x49, 0x41, 0xFF, 0x28, 0x39, 0xFF, 0x6B, 0x49, 0xFF, 0x4C, 0x49, 0xFF, 0x11, 0x6A, 0xFF, 0xB0, 0x69, 0xFF, 0xCF, 0x61, 0xFF, 0x78, 0x82, 0xFF, 0x76, 0x59, 0xFF, 0x51, 0x59, 0xFF, 0x91, 0x8A, 0xFF, 0x54, 0xED, 0xFF, 0xD5, 0xD4, 0xFF, 0x0B, 0x6A, 0xFF, 0x30, 0x9B, 0xFF, 0xD0, 0x92, 0xFF, 0xAC, 0x7A, 0xFF, 0x4A, 0x72, 0xFF, 0x0A, 0x6A, 0xFF, 0xEA, 0x61, 0xFF, 0xA8, 0x51, 0xFF, 0x2C, 0x72, 0xFF, 0x4B, 0x49, 0xFF, 0x4B, 0x49, 0xFF, 0x4A, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0x52, 0x9B, 0xFF, 0x88, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0xA8, 0x51, 0xFF, 0xC8, 0x59, 0xFF, 0x8D, 0x82, 0xFF, 0x6A, 0x72, 0xFF, 0x4A, 0x6A, 0xFF, 0xCC, 0x8A, 0xFF, 0x2E, 0xAB, 0xFF, 0xD6, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF4, 0xFF,
-    0xEC, 0x92, 0xFF, 0x8B, 0x7A, 0xFF, 0x4A, 0x72, 0xFF, 0x79, 0xFE, 0xFF, 0x8C, 0x82, 0xFF, 0x8B, 0x7A, 0xFF, 0x6A, 0x72, 0xFF, 0x4B, 0x72, 0xFF, 0x0E, 0x72, 0xFF, 0xBE, 0xFD, 0xFF, 0x2E, 0x72, 0xFF, 0x2F, 0x72, 0xFF, 0x95, 0x7A, 0xFF, 0xDD, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x41, 0xFF, 0x85, 0x20, 0xFF, 0xC6, 0x28, 0xFF, 0xC5, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x0C, 0x5A, 0xFF, 0xC6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0x8F, 0x7A, 0xFF, 0x86, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0x86, 0x20, 0xFF, 0xA5, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x2A, 0x49, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0x07, 0x39, 0xFF, 0x4D, 0x72, 0xFF, 0xC8, 0x30, 0xFF, 0x09, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0xE7, 0x38, 0xFF, 0xEB, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x29, 0x41, 0xFF, 0x4A, 0x49, 0xFF, 0x0B, 0x41, 0xFF, 0xF2, 0x61, 0xFF, 0x2F, 0x51, 0xFF, 0x6F, 0x61, 0xFF, 0x3B, 0x82, 0xFF, 0x7E, 0x38, 0xFF, 0xB3, 0x69, 0xFF, 0x77, 0xB3, 0xFF, 0x15, 0xF5, 0xFF, 0xF3, 0xC3, 0xFF, 0x0C, 0x6A, 0xFF, 0x10, 0x93, 0xFF, 0x90, 0x92, 0xFF, 0x2A, 0x6A, 0xFF, 0x09, 0x6A, 0xFF, 0xC9, 0x61, 0xFF, 0x2F, 0x93, 0xFF, 0x69, 0x59, 0xFF, 0x0A, 0x62, 0xFF, 0x69, 0x51, 0xFF,
-    0xCA, 0x59, 0xFF, 0x8A, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0x14, 0x9B, 0xFF, 0xAC, 0x7A, 0xFF, 0xA8, 0x51, 0xFF, 0xA8, 0x59, 0xFF, 0xC8, 0x61, 0xFF, 0x37, 0xCC, 0xFF, 0x70, 0x9B, 0xFF, 0x8A, 0x82, 0xFF, 0x0C, 0x9B, 0xFF, 0xF2, 0xEC, 0xFF, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xE4, 0xFF, 0xAC, 0x8A, 0xFF, 0x6B, 0x7A, 0xFF, 0x6A, 0x72, 0xFF, 0x1D, 0xF7, 0xFF, 0xEC, 0x71, 0xFF, 0x4B, 0x72, 0xFF, 0x8B, 0x7A, 0xFF, 0x6D, 0x7A, 0xFF, 0xAE, 0x82, 0xFF, 0x0E, 0x7A, 0xFF, 0x50, 0x7A, 0xFF, 0x54, 0x7A, 0xFF, 0x19, 0x72, 0xFF, 0x9C, 0x59, 0xFF, 0xFB, 0x38, 0xFF, 0xF4, 0x59, 0xFF, 0xA6, 0x28, 0xFF, 0xC6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xC6, 0x28, 0xFF, 0xE8, 0x38, 0xFF, 0xA6, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0x08, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x18, 0xE5, 0xFF, 0x08, 0x39, 0xFF, 0x09, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x07, 0x39, 0xFF, 0x28, 0x39, 0xFF, 0x2F, 0x72, 0xFF, 0x09, 0x39, 0xFF, 0x4B, 0x49, 0xFF, 0x2D, 0x49, 0xFF, 0x50, 0x51, 0xFF, 0xB5, 0x9A, 0xFF, 0x8F, 0x51, 0xFF,
-    0x7A, 0x51, 0xFF, 0x7C, 0x59, 0xFF, 0xB3, 0x69, 0xFF, 0xD4, 0x9A, 0xFF, 0xFC, 0xFF, 0xFF, 0x74, 0xB3, 0xFF, 0x2E, 0x7A, 0xFF, 0x4C, 0x7A, 0xFF, 0x10, 0x9B, 0xFF, 0x6A, 0x7A, 0xFF, 0xE9, 0x61, 0xFF, 0x2A, 0x6A, 0xFF, 0xE9, 0x61, 0xFF, 0xC8, 0x59, 0xFF, 0xA9, 0x51, 0xFF, 0x8A, 0x51, 0xFF, 0x69, 0x49, 0xFF, 0x69, 0x49, 0xFF, 0xC9, 0x59, 0xFF, 0xCA, 0x59, 0xFF, 0xA9, 0x51, 0xFF, 0xA9, 0x51, 0xFF, 0xE8, 0x59, 0xFF, 0xE8, 0x61, 0xFF, 0x4A, 0x6A, 0xFF, 0xCB, 0x82, 0xFF, 0x4D, 0x9B, 0xFF, 0xF0, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xFD, 0xFF, 0x6D, 0xB3, 0xFF, 0xCD, 0x82, 0xFF, 0x8B, 0x82, 0xFF, 0x76, 0xED, 0xFF, 0xCB, 0x8A, 0xFF, 0x0C, 0x93, 0xFF, 0xCC, 0x8A, 0xFF, 0x8E, 0x7A, 0xFF, 0x98, 0xD4, 0xFF, 0x8F, 0x82, 0xFF, 0x70, 0x82, 0xFF, 0x72, 0x82, 0xFF, 0x39, 0x6A, 0xFF, 0xFF, 0xF7, 0xFF, 0x5E, 0x51, 0xFF, 0xBF, 0xB4, 0xFF, 0x12, 0x62, 0xFF, 0x8B, 0x49, 0xFF, 0xEB, 0x51, 0xFF, 0x48, 0x39, 0xFF, 0x28, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x6A, 0x41, 0xFF, 0xEC, 0x59, 0xFF, 0x89, 0x41, 0xFF, 0x69, 0x41, 0xFF, 0xE6, 0x30, 0xFF, 0xED, 0x61, 0xFF, 0x86, 0x28, 0xFF, 0xE8, 0x38, 0xFF, 0xE7, 0x38, 0xFF, 0xC7, 0x30, 0xFF, 0x71, 0xA3, 0xFF,
-    0x08, 0x39, 0xFF, 0x08, 0x39, 0xFF, 0xE7, 0x30, 0xFF, 0x06, 0x39, 0xFF, 0x4F, 0x82, 0xFF, 0xE8, 0x38, 0xFF, 0xCB, 0x59, 0xFF, 0xCA, 0x51, 0xFF, 0xAA, 0x59, 0xFF, 0x54, 0x82, 0xFF, 0x0A, 0x41, 0xFF, 0x0D, 0x62, 0xFF, 0xB0, 0x59, 0xFF, 0x8A, 0x30, 0xFF, 0x14, 0x82, 0xFF, 0xAF, 0x61, 0xFF, 0xF8, 0x79, 0xFF, 0xDB, 0x48, 0xFF, 0x71, 0x61, 0xFF, 0xF4, 0x9A, 0xFF, 0xFB, 0xF6, 0xFF, 0xD4, 0xCB, 0xFF, 0x70, 0x8A, 0xFF, 0xF0, 0x9A, 0xFF, 0x1C, 0x82, 0xFF, 0x8B, 0x7A, 0xFF, 0xC8, 0x61, 0xFF, 0x09, 0x6A, 0xFF, 0xC8, 0x61, 0xFF, 0xF2, 0xA2, 0xFF, 0xA9, 0x59, 0xFF, 0xAA, 0x59, 0xFF, 0xAA, 0x59, 0xFF, 0xA9, 0x59, 0xFF, 0xF5, 0x9A, 0xFF, 0xA8, 0x59, 0xFF, 0xE9, 0x61, 0xFF, 0xC9, 0x61, 0xFF, 0xC9, 0x61, 0xFF, 0xB4, 0xB3, 0xFF, 0x70, 0xA3, 0xFF, 0x4E, 0xA3, 0xFF, 0x11, 0xC4, 0xFF, 0x92, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xDC, 0xFF, 0x55, 0xDC, 0xFF, 0x15, 0xD5, 0xFF, 0x90, 0xAB, 0xFF, 0x50, 0xA3, 0xFF, 0x8E, 0xB3, 0xFF, 0x8D, 0xAB, 0xFF, 0x54, 0xC4, 0xFF, 0xF4, 0xB3, 0xFF, 0x14, 0x9B, 0xFF, 0x12, 0x9B, 0xFF, 0x75, 0xAB, 0xFF, 0x19, 0xBC, 0xFF, 0x1A, 0x62, 0xFF, 0x1D, 0x7C, 0xFF, 0xBB, 0x82, 0xFF, 0x12, 0x62, 0xFF, 0xF1, 0x61, 0xFF,
-    0xA6, 0x28, 0xFF, 0x08, 0x39, 0xFF, 0xA6, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x25, 0x18, 0xFF, 0xA6, 0x28, 0xFF, 0x09, 0x41, 0xFF, 0xC7, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0xE9, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x70, 0x7A, 0xFF, 0xE7, 0x38, 0xFF, 0x28, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0xC7, 0x38, 0xFF, 0x49, 0x41, 0xFF, 0x0A, 0x41, 0xFF, 0x4B, 0x49, 0xFF, 0x2A, 0x41, 0xFF, 0x0D, 0x41, 0xFF, 0x90, 0x51, 0xFF, 0xF0, 0x48, 0xFF, 0x4E, 0x49, 0xFF, 0x78, 0x59, 0xFF, 0xBF, 0x75, 0xFF, 0xB2, 0x71, 0xFF, 0xB3, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xD4, 0xFF, 0x70, 0x82, 0xFF, 0xB1, 0x8A, 0xFF, 0x51, 0xAB, 0xFF, 0xCC, 0x8A, 0xFF, 0x2A, 0x72, 0xFF, 0x29, 0x6A, 0xFF, 0x2A, 0x6A, 0xFF, 0x0A, 0x6A, 0xFF, 0xCB, 0x59, 0xFF, 0xEB, 0x59, 0xFF, 0x68, 0x49, 0xFF, 0xC9, 0x59, 0xFF, 0x2A, 0x6A, 0xFF, 0xA8, 0x51, 0xFF, 0xA8, 0x51, 0xFF, 0xC8, 0x51, 0xFF, 0x2A, 0x6A, 0xFF, 0x52, 0xDD, 0xFF, 0x4B, 0x82, 0xFF, 0x8F, 0xA3, 0xFF, 0xF4, 0xE4, 0xFF, 0x90, 0xB3, 0xFF, 0x10, 0xD4, 0xFF, 0xD3, 0xCB, 0xFF, 0x16, 0xA3, 0xFF, 0x73, 0x8A, 0xFF,
-    0x6F, 0x82, 0xFF, 0xAD, 0x8A, 0xFF, 0x4D, 0xAB, 0xFF, 0xB0, 0xE4, 0xFF, 0x90, 0xE4, 0xFF, 0x30, 0xAB, 0xFF, 0xD0, 0x92, 0xFF, 0x11, 0xA3, 0xFF, 0x92, 0xBB, 0xFF, 0x71, 0xBB, 0xFF, 0x33, 0xAB, 0xFF, 0x95, 0x8A, 0xFF, 0x74, 0x82, 0xFF, 0x32, 0x72, 0xFF, 0x2F, 0x6A, 0xFF, 0x2F, 0x6A, 0xFF, 0x48, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0x2A, 0x41, 0xFF, 0xC7, 0x30, 0xFF, 0x86, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0x28, 0x39, 0xFF, 0x09, 0x39, 0xFF, 0xAF, 0x72, 0xFF, 0x08, 0x39, 0xFF, 0xE8, 0x30, 0xFF, 0x89, 0x49, 0xFF, 0xA6, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0x86, 0x30, 0xFF, 0x0B, 0x6A, 0xFF, 0x06, 0x39, 0xFF, 0xE8, 0x30, 0xFF, 0x29, 0x41, 0xFF, 0xE7, 0x38, 0xFF, 0x92, 0xB3, 0xFF, 0xE8, 0x30, 0xFF, 0x49, 0x41, 0xFF, 0x8B, 0x59, 0xFF, 0x6D, 0x51, 0xFF, 0xCD, 0x61, 0xFF, 0x0D, 0x5A, 0xFF, 0xAF, 0x61, 0xFF, 0x6F, 0x51, 0xFF, 0xF3, 0x79, 0xFF, 0x70, 0x51, 0xFF, 0xF6, 0x69, 0xFF, 0xFB, 0x8A, 0xFF, 0x31, 0x59, 0xFF, 0x76, 0x9A, 0xFF, 0x1D, 0xAB, 0xFF, 0xB6, 0x9A, 0xFF, 0x31, 0x7A, 0xFF, 0x71, 0x8A, 0xFF, 0xD4, 0xD3, 0xFF, 0x6E, 0xAB, 0xFF, 0x09, 0x6A, 0xFF, 0x2A, 0x6A, 0xFF, 0x2B, 0x6A, 0xFF, 0xDA, 0x9A, 0xFF, 0x89, 0x51, 0xFF, 0x89, 0x51, 0xFF,
-    0xA9, 0x51, 0xFF, 0xC8, 0x59, 0xFF, 0xF2, 0xCB, 0xFF, 0x88, 0x59, 0xFF, 0xC8, 0x61, 0xFF, 0xE9, 0x61, 0xFF, 0x6E, 0x7A, 0xFF, 0x52, 0x9B, 0xFF, 0xCC, 0x69, 0xFF, 0x0E, 0x6A, 0xFF, 0x70, 0x82, 0xFF, 0xB4, 0xBB, 0xFF, 0xF3, 0xAA, 0xFF, 0x59, 0x92, 0xFF, 0x7E, 0x94, 0xFF, 0xD8, 0x9A, 0xFF, 0x16, 0xC4, 0xFF, 0x10, 0xA3, 0xFF, 0x53, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xB7, 0xEC, 0xFF, 0x51, 0xAB, 0xFF, 0xF1, 0xCB, 0xFF, 0xF7, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xEC, 0xFF, 0xD2, 0x8A, 0xFF, 0x71, 0x82, 0xFF, 0xB1, 0x82, 0xFF, 0x51, 0x7A, 0xFF, 0x2E, 0x72, 0xFF, 0xA5, 0x28, 0xFF, 0x65, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xAD, 0x59, 0xFF, 0xC7, 0x28, 0xFF, 0xC6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xE6, 0x30, 0xFF, 0xCA, 0x61, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x0C, 0x6A, 0xFF, 0xE8, 0x38, 0xFF, 0xC7, 0x30, 0xFF, 0xA6, 0x28, 0xFF, 0x07, 0x39, 0xFF, 0x6F, 0x6A, 0xFF, 0x2F, 0x72, 0xFF, 0xA7, 0x30, 0xFF, 0x27, 0x39, 0xFF, 0x49, 0x41, 0xFF, 0x27, 0x39, 0xFF, 0xD1, 0x71, 0xFF, 0x2A, 0x41, 0xFF, 0x29, 0x49, 0xFF, 0x49, 0x41, 0xFF, 0x0B, 0x41, 0xFF, 0x4F, 0x51, 0xFF, 0x55, 0x92, 0xFF, 0x70, 0x59, 0xFF,
-    0x98, 0x9B, 0xFF, 0x72, 0x51, 0xFF, 0x72, 0x61, 0xFF, 0x12, 0x82, 0xFF, 0xFF, 0xF7, 0xFF, 0x5A, 0x8A, 0xFF, 0x94, 0x8A, 0xFF, 0xD4, 0xCB, 0xFF, 0xB7, 0xFD, 0xFF, 0xAE, 0xB3, 0xFF, 0x6A, 0x7A, 0xFF, 0x0A, 0x6A, 0xFF, 0x2A, 0x72, 0xFF, 0xAE, 0x71, 0xFF, 0xAF, 0x8A, 0xFF, 0xEA, 0x61, 0xFF, 0xE9, 0x59, 0xFF, 0x2A, 0x62, 0xFF, 0xA9, 0x51, 0xFF, 0x55, 0xAB, 0xFF, 0xA8, 0x51, 0xFF, 0xA8, 0x51, 0xFF, 0xF4, 0xAB, 0xFF, 0xD1, 0x8A, 0xFF, 0x9F, 0xD4, 0xFF, 0xF1, 0x69, 0xFF, 0x31, 0x7A, 0xFF, 0x73, 0x82, 0xFF, 0x37, 0x7A, 0xFF, 0xBF, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x82, 0xFF, 0x91, 0x92, 0xFF, 0xD1, 0xCB, 0xFF, 0xD9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0xD0, 0xCB, 0xFF, 0xF1, 0xC3, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xC3, 0xFF, 0x90, 0x8A, 0xFF, 0x53, 0xB4, 0xFF, 0x33, 0x82, 0xFF, 0x1F, 0xC4, 0xFF, 0x0E, 0x6A, 0xFF, 0xC6, 0x28, 0xFF, 0xC6, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC6, 0x28, 0xFF, 0xA7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x4A, 0x49, 0xFF, 0xA7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xA6, 0x28, 0xFF, 0x8A, 0x49, 0xFF, 0xEB, 0x61, 0xFF, 0xC7, 0x30, 0xFF, 0x6A, 0x49, 0xFF,
-    0x08, 0x39, 0xFF, 0xC6, 0x30, 0xFF, 0x47, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0xA6, 0x30, 0xFF, 0x07, 0x39, 0xFF, 0x70, 0x82, 0xFF, 0xCC, 0x59, 0xFF, 0x2A, 0x49, 0xFF, 0xE8, 0x38, 0xFF, 0x34, 0x82, 0xFF, 0x4A, 0x51, 0xFF, 0x2E, 0x6A, 0xFF, 0x4F, 0x51, 0xFF, 0x71, 0x59, 0xFF, 0x14, 0x82, 0xFF, 0x16, 0x93, 0xFF, 0x10, 0x49, 0xFF, 0x71, 0x59, 0xFF, 0x39, 0xAB, 0xFF, 0xBE, 0x31, 0xFF, 0xD9, 0x71, 0xFF, 0x52, 0x7A, 0xFF, 0x31, 0xAB, 0xFF, 0xFC, 0xF4, 0xFF, 0xCD, 0x9A, 0xFF, 0x6B, 0x7A, 0xFF, 0x8B, 0x7A, 0xFF, 0x0B, 0x6A, 0xFF, 0x94, 0xB3, 0xFF, 0xC8, 0x59, 0xFF, 0xEA, 0x71, 0xFF, 0x47, 0x49, 0xFF, 0xD3, 0xD4, 0xFF, 0x27, 0x51, 0xFF, 0xEC, 0x61, 0xFF, 0x0A, 0x6A, 0xFF, 0x8E, 0x59, 0xFF, 0x74, 0xAB, 0xFF, 0x12, 0x8B, 0xFF, 0x6E, 0x61, 0xFF, 0xF0, 0x69, 0xFF, 0x94, 0x82, 0xFF, 0x57, 0x82, 0xFF, 0x5E, 0x8A, 0xFF, 0x5F, 0x82, 0xFF, 0xDA, 0x79, 0xFF, 0x5A, 0xBB, 0xFF, 0x73, 0xBB, 0xFF, 0x55, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0xFE, 0xFF, 0x50, 0xE4, 0xFF, 0x90, 0xBB, 0xFF, 0xB7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xD2, 0xDC, 0xFF, 0x12, 0x9B, 0xFF, 0x91, 0x82, 0xFF, 0x95, 0xAB, 0xFF, 0xF4, 0x92, 0xFF, 0x71, 0x7A, 0xFF, 0x6F, 0x7A, 0xFF,
-    0xCC, 0x59, 0xFF, 0xA6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0x85, 0x28, 0xFF, 0xCD, 0x61, 0xFF, 0x45, 0x20, 0xFF, 0xAB, 0x49, 0xFF, 0xCB, 0x51, 0xFF, 0x85, 0x28, 0xFF, 0x4F, 0x7A, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0xC7, 0x38, 0xFF, 0xB2, 0x8A, 0xFF, 0xE8, 0x38, 0xFF, 0xE8, 0x30, 0xFF, 0xAF, 0x72, 0xFF, 0x07, 0x39, 0xFF, 0x0E, 0x7A, 0xFF, 0x08, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0x08, 0x41, 0xFF, 0xE6, 0x30, 0xFF, 0x33, 0x8A, 0xFF, 0x09, 0x41, 0xFF, 0xD4, 0x9A, 0xFF, 0x0A, 0x41, 0xFF, 0x0D, 0x51, 0xFF, 0x34, 0x8A, 0xFF, 0x79, 0xB3, 0xFF, 0x0E, 0x51, 0xFF, 0x51, 0x51, 0xFF, 0x51, 0x59, 0xFF, 0x13, 0x8A, 0xFF, 0xF8, 0x50, 0xFF, 0xB4, 0x61, 0xFF, 0x31, 0x7A, 0xFF, 0xD1, 0x9A, 0xFF, 0x36, 0xBB, 0xFF, 0xED, 0x92, 0xFF, 0x6B, 0x7A, 0xFF, 0x09, 0x6A, 0xFF, 0xEA, 0x69, 0xFF, 0xD6, 0xA2, 0xFF, 0xA8, 0x51, 0xFF, 0x67, 0x49, 0xFF, 0x8D, 0x72, 0xFF, 0x6D, 0x8A, 0xFF, 0x5F, 0xDD, 0xFF, 0x4B, 0x72, 0xFF, 0x68, 0x51, 0xFF, 0x73, 0xA3, 0xFF, 0x0E, 0x6A, 0xFF, 0x5D, 0xAB, 0xFF, 0x6E, 0x59, 0xFF, 0xB1, 0x61, 0xFF, 0x36, 0x82, 0xFF, 0x98, 0x61, 0xFF, 0xBF, 0x9D, 0xFF, 0x3C, 0x9D, 0xFF, 0x79, 0xAB, 0xFF, 0x96, 0xBB, 0xFF,
-    0xB1, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0xD4, 0xFF, 0x14, 0xDD, 0xFF, 0x91, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0xE4, 0xFF, 0x52, 0xAB, 0xFF, 0xB1, 0x92, 0xFF, 0x36, 0x9B, 0xFF, 0xDE, 0xFE, 0xFF, 0xD8, 0xD4, 0xFF, 0x4F, 0x72, 0xFF, 0x6F, 0x72, 0xFF, 0xA6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC6, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0x2C, 0x62, 0xFF, 0xCB, 0x51, 0xFF, 0xA6, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0x08, 0x41, 0xFF, 0x07, 0x39, 0xFF, 0xC8, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x27, 0x41, 0xFF, 0x07, 0x39, 0xFF, 0xC6, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0x07, 0x39, 0xFF, 0x49, 0x51, 0xFF, 0x27, 0x41, 0xFF, 0x09, 0x41, 0xFF, 0xC8, 0x38, 0xFF, 0x0E, 0x51, 0xFF, 0x0A, 0x49, 0xFF, 0x2B, 0x49, 0xFF, 0x0E, 0x49, 0xFF, 0x50, 0x51, 0xFF, 0x2E, 0x49, 0xFF, 0x4F, 0x51, 0xFF, 0x30, 0x59, 0xFF, 0x70, 0x59, 0xFF, 0xD4, 0x69, 0xFF, 0xB4, 0x69, 0xFF, 0x31, 0x72, 0xFF, 0x7A, 0xF5, 0xFF, 0xD2, 0x92, 0xFF, 0x0A, 0x6A, 0xFF, 0xC9, 0x61, 0xFF, 0x88, 0x51, 0xFF, 0x2A, 0x7A, 0xFF, 0x8B, 0x61, 0xFF, 0x88, 0x51, 0xFF, 0x88, 0x51, 0xFF,
-    0x88, 0x49, 0xFF, 0xEA, 0x61, 0xFF, 0x8C, 0x59, 0xFF, 0x50, 0x93, 0xFF, 0x6C, 0x51, 0xFF, 0xC9, 0x48, 0xFF, 0x54, 0xA3, 0xFF, 0xB4, 0x61, 0xFF, 0xAE, 0x59, 0xFF, 0xB0, 0x61, 0xFF, 0x70, 0x59, 0xFF, 0xB5, 0x61, 0xFF, 0x78, 0x61, 0xFF, 0xD6, 0x69, 0xFF, 0x12, 0x72, 0xFF, 0x51, 0x7A, 0xFF, 0x13, 0xAB, 0xFF, 0x52, 0xDC, 0xFF, 0x96, 0xDC, 0xFF, 0x14, 0xA3, 0xFF, 0x95, 0x92, 0xFF, 0xF1, 0x9A, 0xFF, 0x13, 0xD4, 0xFF, 0x92, 0xC3, 0xFF, 0xD1, 0x9A, 0xFF, 0xD3, 0x92, 0xFF, 0x18, 0xBC, 0xFF, 0x52, 0x7A, 0xFF, 0x1C, 0xF6, 0xFF, 0xB1, 0x82, 0xFF, 0x2F, 0x72, 0xFF, 0x2E, 0x62, 0xFF, 0x85, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xAB, 0x51, 0xFF, 0x08, 0x39, 0xFF, 0xA6, 0x28, 0xFF, 0x86, 0x28, 0xFF, 0xE6, 0x30, 0xFF, 0x29, 0x49, 0xFF, 0x66, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xCB, 0x59, 0xFF, 0xC8, 0x38, 0xFF, 0xA7, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0xA8, 0x30, 0xFF, 0x0D, 0x6A, 0xFF, 0xE7, 0x30, 0xFF, 0x49, 0x41, 0xFF, 0xEC, 0x61, 0xFF, 0x0B, 0x62, 0xFF, 0xF0, 0x81, 0xFF, 0x07, 0x39, 0xFF, 0x4A, 0x51, 0xFF, 0x07, 0x39, 0xFF, 0xC9, 0x38, 0xFF, 0x95, 0x9A, 0xFF, 0x0F, 0x72, 0xFF, 0x2A, 0x49, 0xFF, 0x2B, 0x41, 0xFF, 0xEE, 0x50, 0xFF, 0x74, 0x82, 0xFF,
-    0x33, 0x72, 0xFF, 0x2E, 0x51, 0xFF, 0xEE, 0x50, 0xFF, 0xD7, 0x9A, 0xFF, 0x54, 0x92, 0xFF, 0xF2, 0x71, 0xFF, 0xD0, 0x61, 0xFF, 0xD3, 0xB3, 0xFF, 0x5C, 0xBB, 0xFF, 0xAD, 0x8A, 0xFF, 0xC9, 0x61, 0xFF, 0x27, 0x51, 0xFF, 0x6F, 0x8A, 0xFF, 0x7E, 0xA2, 0xFF, 0x67, 0x51, 0xFF, 0x68, 0x51, 0xFF, 0xCB, 0x61, 0xFF, 0x2E, 0x72, 0xFF, 0x13, 0xA3, 0xFF, 0xF1, 0x8A, 0xFF, 0xD0, 0x59, 0xFF, 0x4E, 0x72, 0xFF, 0x94, 0x82, 0xFF, 0xB4, 0x8A, 0xFF, 0x8D, 0x59, 0xFF, 0x52, 0x82, 0xFF, 0xD4, 0x8A, 0xFF, 0x98, 0x92, 0xFF, 0xD2, 0x71, 0xFF, 0xD5, 0x92, 0xFF, 0xD0, 0x61, 0xFF, 0x51, 0x82, 0xFF, 0xB7, 0xBB, 0xFF, 0xF3, 0xA2, 0xFF, 0x96, 0x8A, 0xFF, 0x5A, 0x7A, 0xFF, 0xB8, 0x79, 0xFF, 0xD8, 0xC3, 0xFF, 0xF3, 0xA2, 0xFF, 0x73, 0x82, 0xFF, 0x18, 0x7A, 0xFF, 0x1A, 0x7A, 0xFF, 0x9B, 0xCC, 0xFF, 0xD3, 0x82, 0xFF, 0xD6, 0xB3, 0xFF, 0x57, 0xB4, 0xFF, 0x4F, 0x72, 0xFF, 0x4F, 0x7A, 0xFF, 0xC7, 0x30, 0xFF, 0x85, 0x28, 0xFF, 0x08, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0xC6, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x0E, 0x6A, 0xFF, 0xC7, 0x30, 0xFF, 0x28, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0xEC, 0x59, 0xFF, 0x0D, 0x72, 0xFF, 0x86, 0x28, 0xFF, 0xC7, 0x30, 0xFF,
-    0xED, 0x59, 0xFF, 0xE7, 0x30, 0xFF, 0xEC, 0x59, 0xFF, 0x4E, 0x72, 0xFF, 0x6E, 0x72, 0xFF, 0x48, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x48, 0x49, 0xFF, 0xB3, 0x92, 0xFF, 0x08, 0x41, 0xFF, 0x53, 0x92, 0xFF, 0xAE, 0x61, 0xFF, 0x18, 0x9B, 0xFF, 0x2D, 0x51, 0xFF, 0x91, 0x69, 0xFF, 0x11, 0x8A, 0xFF, 0x58, 0xB3, 0xFF, 0x4E, 0x51, 0xFF, 0x2E, 0x59, 0xFF, 0xB6, 0x9A, 0xFF, 0xDB, 0xFC, 0xFF, 0x77, 0xD4, 0xFF, 0xD1, 0x69, 0xFF, 0x6F, 0x8A, 0xFF, 0x56, 0xBB, 0xFF, 0x88, 0x59, 0xFF, 0x88, 0x51, 0xFF, 0x88, 0x51, 0xFF, 0x2D, 0x8A, 0xFF, 0x53, 0xAB, 0xFF, 0x47, 0x51, 0xFF, 0x27, 0x41, 0xFF, 0x8D, 0x82, 0xFF, 0x0E, 0x7A, 0xFF, 0x6B, 0x51, 0xFF, 0x16, 0x9B, 0xFF, 0x73, 0x9B, 0xFF, 0xCC, 0x61, 0xFF, 0x5B, 0xA3, 0xFF, 0x54, 0x93, 0xFF, 0xB4, 0x92, 0xFF, 0xAE, 0x59, 0xFF, 0xAF, 0x61, 0xFF, 0x11, 0x72, 0xFF, 0xF4, 0x92, 0xFF, 0xB1, 0x61, 0xFF, 0x5F, 0xF6, 0xFF, 0x36, 0xA3, 0xFF, 0xF4, 0x9A, 0xFF, 0x14, 0x7A, 0xFF, 0xBB, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x79, 0xFF, 0x74, 0x82, 0xFF, 0x95, 0x8A, 0xFF, 0xF7, 0x69, 0xFF, 0x7F, 0xDF, 0xFF, 0xFF, 0xCF, 0xFF, 0x3E, 0xE5, 0xFF, 0x51, 0x72, 0xFF, 0xB4, 0x8A, 0xFF, 0x92, 0x7A, 0xFF, 0x5D, 0xC4, 0xFF, 0xEE, 0x61, 0xFF,
-    0xC7, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0xC6, 0x28, 0xFF, 0x0C, 0x62, 0xFF, 0x66, 0x20, 0xFF, 0xA6, 0x28, 0xFF, 0xE7, 0x38, 0xFF, 0x85, 0x20, 0xFF, 0x89, 0x51, 0xFF, 0x8A, 0x49, 0xFF, 0x28, 0x39, 0xFF, 0x8A, 0x49, 0xFF, 0x28, 0x41, 0xFF, 0xA6, 0x30, 0xFF, 0x0C, 0x6A, 0xFF, 0xA7, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0x26, 0x39, 0xFF, 0x48, 0x49, 0xFF, 0x12, 0x72, 0xFF, 0x2D, 0x6A, 0xFF, 0x08, 0x39, 0xFF, 0x8C, 0x61, 0xFF, 0x89, 0x59, 0xFF, 0xCC, 0x40, 0xFF, 0xAB, 0x38, 0xFF, 0x0C, 0x49, 0xFF, 0x4D, 0x51, 0xFF, 0x4C, 0x49, 0xFF, 0x4F, 0x59, 0xFF, 0x4E, 0x71, 0xFF, 0x92, 0x69, 0xFF, 0xBB, 0xCC, 0xFF, 0x70, 0x59, 0xFF, 0x70, 0x61, 0xFF, 0x34, 0x8A, 0xFF, 0xB3, 0x79, 0xFF, 0xB6, 0xB3, 0xFF, 0xB0, 0x69, 0xFF, 0xB1, 0x92, 0xFF, 0x77, 0xC3, 0xFF, 0x2E, 0x7A, 0xFF, 0xA8, 0x59, 0xFF, 0x88, 0x51, 0xFF, 0xAD, 0x69, 0xFF, 0x6C, 0x61, 0xFF, 0x28, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0xA8, 0x51, 0xFF, 0x9B, 0x8A, 0xFF, 0x8C, 0x59, 0xFF, 0x1D, 0x9B, 0xFF, 0xCC, 0x61, 0xFF, 0x2B, 0x49, 0xFF, 0x9D, 0xE5, 0xFF, 0xF2, 0x8A, 0xFF, 0xFA, 0xC3, 0xFF, 0x4C, 0x59, 0xFF, 0x6E, 0x59, 0xFF, 0x6E, 0x59, 0xFF, 0x8F, 0x59, 0xFF, 0x6F, 0x59, 0xFF, 0x35, 0x7A, 0xFF, 0xB0, 0x61, 0xFF,
-    0x18, 0x9B, 0xFF, 0xD8, 0x71, 0xFF, 0xDF, 0x48, 0xFF, 0x3F, 0xF7, 0xFF, 0x1E, 0x72, 0xFF, 0x78, 0x7A, 0xFF, 0x9B, 0x61, 0xFF, 0xFE, 0x48, 0xFF, 0x7F, 0xF7, 0xFF, 0x1E, 0x72, 0xFF, 0x98, 0xAB, 0xFF, 0x31, 0x72, 0xFF, 0x52, 0x72, 0xFF, 0x11, 0x7A, 0xFF, 0x30, 0x6A, 0xFF, 0x0F, 0x6A, 0xFF, 0xEE, 0x61, 0xFF, 0x08, 0x39, 0xFF, 0xA6, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x4E, 0x7A, 0xFF, 0xA6, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x2E, 0x72, 0xFF, 0xCB, 0x51, 0xFF, 0x29, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x2C, 0x6A, 0xFF, 0x2E, 0x7A, 0xFF, 0xE8, 0x38, 0xFF, 0x48, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0x06, 0x39, 0xFF, 0x71, 0x82, 0xFF, 0x0D, 0x62, 0xFF, 0x89, 0x51, 0xFF, 0xB9, 0x7A, 0xFF, 0x92, 0x93, 0xFF, 0xD7, 0xA2, 0xFF, 0xED, 0x48, 0xFF, 0x0F, 0x69, 0xFF, 0x0C, 0x49, 0xFF, 0x2D, 0x51, 0xFF, 0xB6, 0x9A, 0xFF, 0x59, 0xB3, 0xFF, 0xD4, 0x71, 0xFF, 0x33, 0x72, 0xFF, 0xEE, 0x50, 0xFF, 0xB9, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x9A, 0xFF, 0x74, 0x8A, 0xFF, 0xB6, 0xCB, 0xFF, 0xD8, 0xF3, 0xFF, 0x31, 0xB3, 0xFF, 0xC8, 0x59, 0xFF, 0xE8, 0x61, 0xFF, 0x13, 0xA3, 0xFF, 0xFE, 0xD3, 0xFF, 0x68, 0x51, 0xFF, 0x46, 0x49, 0xFF,
-    0xA8, 0x61, 0xFF, 0x12, 0x9B, 0xFF, 0xDE, 0xFF, 0xFF, 0xB7, 0x8A, 0xFF, 0xEC, 0x61, 0xFF, 0xFB, 0xE5, 0xFF, 0xF5, 0xB3, 0xFF, 0x1B, 0xFE, 0xFF, 0xB2, 0x8A, 0xFF, 0xF2, 0x8A, 0xFF, 0x6E, 0x61, 0xFF, 0x10, 0x72, 0xFF, 0x16, 0x93, 0xFF, 0x71, 0x61, 0xFF, 0x14, 0x9B, 0xFF, 0xD2, 0x61, 0xFF, 0xB7, 0x92, 0xFF, 0x3E, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x69, 0xFF, 0x7D, 0x61, 0xFF, 0x59, 0x7A, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x61, 0xFF, 0xF5, 0x69, 0xFF, 0x94, 0x8A, 0xFF, 0xD8, 0xB3, 0xFF, 0x9A, 0xAB, 0xFF, 0x30, 0x72, 0xFF, 0x0F, 0x6A, 0xFF, 0x0F, 0x6A, 0xFF, 0x85, 0x28, 0xFF, 0x69, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0xAB, 0x49, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x86, 0x28, 0xFF, 0x8B, 0x51, 0xFF, 0x86, 0x28, 0xFF, 0x08, 0x39, 0xFF, 0xE6, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0x4A, 0x49, 0xFF, 0x49, 0x41, 0xFF, 0x0B, 0x5A, 0xFF, 0x4E, 0x72, 0xFF, 0xE7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0xE7, 0x40, 0xFF, 0xD0, 0x82, 0xFF, 0x6A, 0x51, 0xFF, 0xB1, 0x7A, 0xFF, 0x8A, 0x51, 0xFF, 0xEA, 0x48, 0xFF, 0x09, 0x41, 0xFF, 0xED, 0x38, 0xFF, 0xF1, 0x79, 0xFF, 0x6D, 0x59, 0xFF, 0x2C, 0x49, 0xFF, 0x77, 0x82, 0xFF, 0x90, 0x61, 0xFF, 0x74, 0x61, 0xFF,
-    0x75, 0x92, 0xFF, 0xBA, 0x92, 0xFF, 0x90, 0x69, 0xFF, 0x37, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x11, 0x7A, 0xFF, 0x95, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xE4, 0xFF, 0xC9, 0x61, 0xFF, 0x4A, 0x82, 0xFF, 0x1D, 0xFF, 0xFF, 0x73, 0xBB, 0xFF, 0x88, 0x51, 0xFF, 0x88, 0x59, 0xFF, 0x52, 0xAB, 0xFF, 0x6B, 0x61, 0xFF, 0xAD, 0x71, 0xFF, 0xB7, 0xD4, 0xFF, 0xEE, 0x71, 0xFF, 0x4B, 0x51, 0xFF, 0xD1, 0x8A, 0xFF, 0xCE, 0x69, 0xFF, 0x30, 0x72, 0xFF, 0x54, 0xA3, 0xFF, 0xCF, 0x69, 0xFF, 0xF0, 0x69, 0xFF, 0x70, 0x59, 0xFF, 0xB3, 0x92, 0xFF, 0x8E, 0x59, 0xFF, 0xB0, 0x59, 0xFF, 0x37, 0x7A, 0xFF, 0x9D, 0x8A, 0xFF, 0xB6, 0x59, 0xFF, 0xF3, 0x61, 0xFF, 0x54, 0x72, 0xFF, 0x5B, 0x82, 0xFF, 0x3D, 0x7A, 0xFF, 0x96, 0x59, 0xFF, 0xD3, 0x61, 0xFF, 0xF2, 0x61, 0xFF, 0x32, 0x7A, 0xFF, 0x10, 0x6A, 0xFF, 0x11, 0x6A, 0xFF, 0x2F, 0x6A, 0xFF, 0x2F, 0x72, 0xFF, 0xEE, 0x69, 0xFF, 0xE7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0x6A, 0x51, 0xFF, 0x49, 0x41, 0xFF, 0x86, 0x20, 0xFF, 0xA6, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x0C, 0x62, 0xFF, 0xA7, 0x30, 0xFF, 0x93, 0x72, 0xFF, 0xC8, 0x30, 0xFF, 0xE6, 0x30, 0xFF, 0xCB, 0x61, 0xFF, 0xD0, 0x7A, 0xFF, 0x6B, 0x49, 0xFF, 0xE7, 0x30, 0xFF,
-    0xCC, 0x59, 0xFF, 0x49, 0x49, 0xFF, 0xC7, 0x38, 0xFF, 0xCA, 0x59, 0xFF, 0x4B, 0x51, 0xFF, 0x11, 0x7A, 0xFF, 0x4B, 0x51, 0xFF, 0x2C, 0x51, 0xFF, 0x96, 0x8A, 0xFF, 0x0D, 0x49, 0xFF, 0xB7, 0x9A, 0xFF, 0x6E, 0x61, 0xFF, 0xBC, 0x9A, 0xFF, 0x4F, 0x51, 0xFF, 0x52, 0x59, 0xFF, 0x34, 0x8A, 0xFF, 0x76, 0xB2, 0xFF, 0x5F, 0xFE, 0xFF, 0x91, 0x69, 0xFF, 0xDF, 0xF4, 0xFF, 0xBD, 0xDB, 0xFF, 0xFE, 0xF4, 0xFF, 0x58, 0xCC, 0xFF, 0x5C, 0xFE, 0xFF, 0x7C, 0xFF, 0xFF, 0x92, 0x92, 0xFF, 0xC8, 0x59, 0xFF, 0xEC, 0x79, 0xFF, 0x1C, 0xB3, 0xFF, 0x54, 0xB3, 0xFF, 0x67, 0x51, 0xFF, 0xEA, 0x69, 0xFF, 0x99, 0xFD, 0xFF, 0xD2, 0xB3, 0xFF, 0x35, 0xA3, 0xFF, 0x6D, 0x7A, 0xFF, 0xD4, 0x92, 0xFF, 0x4B, 0x51, 0xFF, 0xF3, 0x9A, 0xFF, 0x95, 0x8A, 0xFF, 0x35, 0x9B, 0xFF, 0x2E, 0x51, 0xFF, 0x71, 0x82, 0xFF, 0xF0, 0x79, 0xFF, 0x57, 0xAB, 0xFF, 0xCF, 0x61, 0xFF, 0xCE, 0x61, 0xFF, 0x8F, 0x59, 0xFF, 0x5B, 0x8A, 0xFF, 0xF4, 0x79, 0xFF, 0x70, 0x59, 0xFF, 0x72, 0x7A, 0xFF, 0xF1, 0x69, 0xFF, 0x58, 0x82, 0xFF, 0xB2, 0x61, 0xFF, 0xD1, 0x61, 0xFF, 0x8F, 0x59, 0xFF, 0x30, 0x72, 0xFF, 0x32, 0x72, 0xFF, 0x50, 0x6A, 0xFF, 0x30, 0x72, 0xFF, 0x0F, 0x6A, 0xFF, 0x2F, 0x72, 0xFF, 0x70, 0x7A, 0xFF,
-    0xA5, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xCD, 0x61, 0xFF, 0x08, 0x31, 0xFF, 0x29, 0x41, 0xFF, 0xE7, 0x30, 0xFF, 0x2C, 0x62, 0xFF, 0xAF, 0x82, 0xFF, 0xA7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x28, 0x39, 0xFF, 0x69, 0x51, 0xFF, 0x09, 0x41, 0xFF, 0x09, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0xC5, 0x30, 0xFF, 0xCB, 0x61, 0xFF, 0x07, 0x41, 0xFF, 0xE9, 0x40, 0xFF, 0x2C, 0x49, 0xFF, 0x9A, 0x9A, 0xFF, 0x2C, 0x49, 0xFF, 0xD2, 0x82, 0xFF, 0xCD, 0x40, 0xFF, 0x36, 0x8A, 0xFF, 0x2D, 0x51, 0xFF, 0x4E, 0x51, 0xFF, 0x90, 0x61, 0xFF, 0x37, 0x7A, 0xFF, 0xBD, 0xC3, 0xFF, 0x74, 0x79, 0xFF, 0xB9, 0x92, 0xFF, 0x15, 0x82, 0xFF, 0x7E, 0xF5, 0xFF, 0x7D, 0xFD, 0xFF, 0xDA, 0xCB, 0xFF, 0x0F, 0x7A, 0xFF, 0x1C, 0xFE, 0xFF, 0x1D, 0xF6, 0xFF, 0xCD, 0x71, 0xFF, 0xC8, 0x59, 0xFF, 0x8A, 0x61, 0xFF, 0xD4, 0xBB, 0xFF, 0x74, 0xBB, 0xFF, 0x67, 0x51, 0xFF, 0x68, 0x51, 0xFF, 0x8A, 0x59, 0xFF, 0xF2, 0x81, 0xFF, 0xED, 0x69, 0xFF, 0x0E, 0x72, 0xFF, 0x4E, 0x59, 0xFF, 0x6C, 0x59, 0xFF, 0x35, 0xAB, 0xFF, 0x6D, 0x51, 0xFF, 0x4C, 0x51, 0xFF, 0x2E, 0x51, 0xFF, 0x10, 0x72, 0xFF, 0x33, 0x82, 0xFF, 0xEF, 0x69, 0xFF, 0x6C, 0x51, 0xFF, 0x8D, 0x51, 0xFF, 0x57, 0xAB, 0xFF,
-    0x35, 0x7A, 0xFF, 0xB0, 0x61, 0xFF, 0x51, 0x72, 0xFF, 0xF5, 0x9A, 0xFF, 0x6E, 0x59, 0xFF, 0x34, 0x6A, 0xFF, 0xB0, 0x61, 0xFF, 0xAF, 0x61, 0xFF, 0x15, 0xA3, 0xFF, 0xEF, 0x61, 0xFF, 0x31, 0x72, 0xFF, 0x0F, 0x6A, 0xFF, 0x30, 0x72, 0xFF, 0x2F, 0x7A, 0xFF, 0x2F, 0x72, 0xFF, 0x2E, 0x72, 0xFF, 0xC6, 0x28, 0xFF, 0x45, 0x20, 0xFF, 0xA6, 0x30, 0xFF, 0xCE, 0x61, 0xFF, 0xCF, 0x82, 0xFF, 0x29, 0x41, 0xFF, 0xC8, 0x38, 0xFF, 0xC7, 0x30, 0xFF, 0x4F, 0x7A, 0xFF, 0x89, 0x59, 0xFF, 0x6A, 0x51, 0xFF, 0xE8, 0x38, 0xFF, 0x29, 0x41, 0xFF, 0xE6, 0x38, 0xFF, 0x9B, 0xAB, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0x27, 0x41, 0xFF, 0xAA, 0x38, 0xFF, 0x73, 0x82, 0xFF, 0x09, 0x41, 0xFF, 0x0C, 0x49, 0xFF, 0x89, 0x38, 0xFF, 0x1C, 0x93, 0xFF, 0x74, 0x82, 0xFF, 0x7B, 0xB3, 0xFF, 0x0E, 0x59, 0xFF, 0x18, 0xB3, 0xFF, 0xEB, 0x48, 0xFF, 0xDB, 0x92, 0xFF, 0xB7, 0xA2, 0xFF, 0xD2, 0x71, 0xFF, 0xFC, 0x71, 0xFF, 0xBF, 0x79, 0xFF, 0xBC, 0xBB, 0xFF, 0x76, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xEC, 0xFF, 0x90, 0x92, 0xFF, 0xD0, 0x9A, 0xFF, 0x57, 0xB3, 0xFF, 0x90, 0x8A, 0xFF, 0xC8, 0x59, 0xFF, 0xCB, 0x69, 0xFF, 0x2F, 0x92, 0xFF, 0xCD, 0x81, 0xFF, 0x19, 0xCC, 0xFF, 0x8A, 0x59, 0xFF,
-    0x0C, 0x6A, 0xFF, 0x92, 0x9A, 0xFF, 0x4A, 0x49, 0xFF, 0x35, 0xA3, 0xFF, 0x4C, 0x51, 0xFF, 0x74, 0xBB, 0xFF, 0x37, 0x72, 0xFF, 0xEF, 0x69, 0xFF, 0x5A, 0xA3, 0xFF, 0x2B, 0x49, 0xFF, 0x6E, 0x61, 0xFF, 0xAF, 0x69, 0xFF, 0xEF, 0x69, 0xFF, 0xF7, 0x92, 0xFF, 0x78, 0xB3, 0xFF, 0x8D, 0x59, 0xFF, 0x10, 0x6A, 0xFF, 0x4E, 0x51, 0xFF, 0x54, 0x82, 0xFF, 0xDF, 0xBB, 0xFF, 0xAE, 0x59, 0xFF, 0x51, 0x72, 0xFF, 0xAF, 0x69, 0xFF, 0xF0, 0x69, 0xFF, 0xFF, 0xBB, 0xFF, 0xF0, 0x69, 0xFF, 0xCF, 0x61, 0xFF, 0x4F, 0x72, 0xFF, 0x70, 0x7A, 0xFF, 0x58, 0xA3, 0xFF, 0x93, 0x8A, 0xFF, 0x4F, 0x7A, 0xFF, 0xCE, 0x59, 0xFF, 0xA6, 0x28, 0xFF, 0x29, 0x41, 0xFF, 0x86, 0x28, 0xFF, 0xAB, 0x59, 0xFF, 0xCC, 0x61, 0xFF, 0x49, 0x51, 0xFF, 0x29, 0x49, 0xFF, 0x07, 0x39, 0xFF, 0x4A, 0x51, 0xFF, 0xD6, 0xD4, 0xFF, 0xEC, 0x59, 0xFF, 0xE7, 0x38, 0xFF, 0x07, 0x39, 0xFF, 0x07, 0x41, 0xFF, 0x30, 0x7A, 0xFF, 0xE8, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xC8, 0x40, 0xFF, 0xF0, 0x71, 0xFF, 0x73, 0x8A, 0xFF, 0xEC, 0x50, 0xFF, 0xAB, 0x38, 0xFF, 0xEA, 0x40, 0xFF, 0x12, 0x7A, 0xFF, 0x96, 0x92, 0xFF, 0x54, 0x7A, 0xFF, 0x0D, 0x49, 0xFF, 0x2D, 0x51, 0xFF, 0x74, 0x82, 0xFF, 0xFA, 0xA2, 0xFF, 0xD3, 0x81, 0xFF,
-    0x7F, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xDC, 0xFF, 0x17, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xEE, 0xFF, 0x6F, 0x92, 0xFF, 0xF2, 0x9A, 0xFF, 0x56, 0xBB, 0xFF, 0x9A, 0xED, 0xFF, 0x88, 0x59, 0xFF, 0xAF, 0x8A, 0xFF, 0xEF, 0x81, 0xFF, 0xD4, 0xA2, 0xFF, 0x2A, 0x49, 0xFF, 0x0F, 0x72, 0xFF, 0xB4, 0xC3, 0xFF, 0x94, 0x82, 0xFF, 0xF5, 0xD3, 0xFF, 0x2C, 0x59, 0xFF, 0xAC, 0x61, 0xFF, 0x6C, 0x59, 0xFF, 0x31, 0x7A, 0xFF, 0xD4, 0x8A, 0xFF, 0x92, 0x82, 0xFF, 0x76, 0xB3, 0xFF, 0xAD, 0x61, 0xFF, 0x6C, 0x59, 0xFF, 0x34, 0x93, 0xFF, 0x76, 0xB3, 0xFF, 0x4B, 0x49, 0xFF, 0x4C, 0x49, 0xFF, 0xAE, 0x59, 0xFF, 0x16, 0x9B, 0xFF, 0x34, 0x82, 0xFF, 0xAD, 0x61, 0xFF, 0x8D, 0x51, 0xFF, 0x10, 0x7A, 0xFF, 0xD9, 0xB3, 0xFF, 0x17, 0xA3, 0xFF, 0xEF, 0x61, 0xFF, 0xCE, 0x61, 0xFF, 0xB1, 0x82, 0xFF, 0x15, 0x93, 0xFF, 0x14, 0x9B, 0xFF, 0x4E, 0x72, 0xFF, 0x8F, 0x7A, 0xFF, 0x2D, 0x72, 0xFF, 0xC6, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0xBA, 0xD4, 0xFF, 0xA7, 0x28, 0xFF, 0xC7, 0x40, 0xFF, 0xC6, 0x30, 0xFF, 0xAF, 0x7A, 0xFF, 0xE6, 0x38, 0xFF, 0xE6, 0x38, 0xFF, 0x49, 0x49, 0xFF, 0x6E, 0x6A, 0xFF, 0xAA, 0x51, 0xFF, 0x07, 0x41, 0xFF, 0xE7, 0x40, 0xFF, 0x28, 0x41, 0xFF, 0xE7, 0x38, 0xFF,
-    0x89, 0x49, 0xFF, 0xE6, 0x30, 0xFF, 0xE6, 0x38, 0xFF, 0xB8, 0xD4, 0xFF, 0x4E, 0x51, 0xFF, 0x37, 0xBC, 0xFF, 0x2B, 0x49, 0xFF, 0x8E, 0x61, 0xFF, 0x4F, 0x61, 0xFF, 0x4E, 0x51, 0xFF, 0x8E, 0x61, 0xFF, 0x0D, 0x49, 0xFF, 0xFA, 0xA2, 0xFF, 0x70, 0x61, 0xFF, 0xFF, 0xFE, 0xFF, 0x54, 0x8A, 0xFF, 0x9C, 0xCB, 0xFF, 0x7B, 0x92, 0xFF, 0xF9, 0xAA, 0xFF, 0xF4, 0xC2, 0xFF, 0x7F, 0xF6, 0xFF, 0xB6, 0xFC, 0xFF, 0x51, 0xAB, 0xFF, 0x14, 0xA3, 0xFF, 0x1C, 0xF5, 0xFF, 0x71, 0x8A, 0xFF, 0xA9, 0x59, 0xFF, 0x0F, 0x82, 0xFF, 0x10, 0x92, 0xFF, 0x73, 0x9A, 0xFF, 0x6A, 0x51, 0xFF, 0x2A, 0x51, 0xFF, 0x55, 0xB3, 0xFF, 0xCC, 0x61, 0xFF, 0x13, 0xA3, 0xFF, 0x2C, 0x51, 0xFF, 0x74, 0xAB, 0xFF, 0xEA, 0x40, 0xFF, 0xCD, 0x61, 0xFF, 0x71, 0x82, 0xFF, 0x35, 0xA3, 0xFF, 0x8D, 0x59, 0xFF, 0xAD, 0x61, 0xFF, 0xCD, 0x61, 0xFF, 0x34, 0x9B, 0xFF, 0x4B, 0x49, 0xFF, 0x4A, 0x49, 0xFF, 0x2B, 0x49, 0xFF, 0x51, 0x82, 0xFF, 0xCD, 0x61, 0xFF, 0xAC, 0x59, 0xFF, 0xEE, 0x69, 0xFF, 0x4C, 0x51, 0xFF, 0xB2, 0x8A, 0xFF, 0x8C, 0x59, 0xFF, 0xCD, 0x61, 0xFF, 0xCD, 0x61, 0xFF, 0xEE, 0x69, 0xFF, 0xD2, 0x8A, 0xFF, 0x0D, 0x6A, 0xFF, 0x4E, 0x72, 0xFF, 0x2E, 0x72, 0xFF, 0x4E, 0x72, 0xFF, 0x6E, 0x7A, 0xFF,
-    0x86, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x0D, 0x62, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0xC7, 0x30, 0xFF, 0x6E, 0x72, 0xFF, 0x6D, 0x6A, 0xFF, 0xE6, 0x30, 0xFF, 0x08, 0x41, 0xFF, 0x8E, 0x72, 0xFF, 0x6C, 0x6A, 0xFF, 0x93, 0x9B, 0xFF, 0x26, 0x41, 0xFF, 0x48, 0x49, 0xFF, 0xE8, 0x38, 0xFF, 0xE5, 0x30, 0xFF, 0x2A, 0x41, 0xFF, 0xE6, 0x38, 0xFF, 0x2C, 0x6A, 0xFF, 0xE9, 0x38, 0xFF, 0x52, 0x82, 0xFF, 0xE9, 0x40, 0xFF, 0x0B, 0x49, 0xFF, 0x17, 0xB4, 0xFF, 0xB2, 0x69, 0xFF, 0x95, 0x8A, 0xFF, 0x72, 0x61, 0xFF, 0x2D, 0x51, 0xFF, 0x75, 0x82, 0xFF, 0xDB, 0xBB, 0xFF, 0x98, 0xA2, 0xFF, 0x19, 0x92, 0xFF, 0xDB, 0x9A, 0xFF, 0xBC, 0xBB, 0xFF, 0xF7, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xFC, 0xFF, 0x8F, 0x92, 0xFF, 0x57, 0xAB, 0xFF, 0x3F, 0xFE, 0xFF, 0xF2, 0x9A, 0xFF, 0xC9, 0x61, 0xFF, 0x0D, 0x7A, 0xFF, 0x71, 0x9A, 0xFF, 0xEE, 0x79, 0xFF, 0x4B, 0x59, 0xFF, 0x8B, 0x59, 0xFF, 0x2E, 0x7A, 0xFF, 0xEE, 0x69, 0xFF, 0xEC, 0x48, 0xFF, 0x2C, 0x51, 0xFF, 0x2B, 0x51, 0xFF, 0x8C, 0x59, 0xFF, 0x0F, 0x72, 0xFF, 0x6D, 0x59, 0xFF, 0xCD, 0x61, 0xFF, 0x4B, 0x51, 0xFF, 0x8C, 0x59, 0xFF, 0xEF, 0x79, 0xFF, 0x4A, 0x49, 0xFF, 0x4A, 0x49, 0xFF, 0x8C, 0x59, 0xFF, 0x6D, 0x61, 0xFF,
-    0x8B, 0x59, 0xFF, 0xED, 0x61, 0xFF, 0xEC, 0x61, 0xFF, 0x8B, 0x59, 0xFF, 0x4C, 0x51, 0xFF, 0xAD, 0x61, 0xFF, 0xAC, 0x59, 0xFF, 0x0E, 0x72, 0xFF, 0x0E, 0x6A, 0xFF, 0xED, 0x61, 0xFF, 0x2E, 0x72, 0xFF, 0x90, 0x7A, 0xFF, 0x0D, 0x6A, 0xFF, 0x6F, 0x7A, 0xFF, 0x2D, 0x72, 0xFF, 0x8F, 0x82, 0xFF, 0xA6, 0x28, 0xFF, 0x86, 0x28, 0xFF, 0x08, 0x41, 0xFF, 0xE8, 0x30, 0xFF, 0x69, 0x49, 0xFF, 0xE7, 0x30, 0xFF, 0xC8, 0x38, 0xFF, 0xCF, 0x7A, 0xFF, 0xE6, 0x30, 0xFF, 0x4D, 0x72, 0xFF, 0x48, 0x49, 0xFF, 0xEC, 0x59, 0xFF, 0xE7, 0x38, 0xFF, 0x8A, 0x59, 0xFF, 0x27, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0xC8, 0x30, 0xFF, 0x27, 0x41, 0xFF, 0x31, 0x7A, 0xFF, 0x11, 0x83, 0xFF, 0x8A, 0x51, 0xFF, 0x0B, 0x49, 0xFF, 0x93, 0x8A, 0xFF, 0xEA, 0x40, 0xFF, 0xF1, 0x69, 0xFF, 0xEC, 0x40, 0xFF, 0x71, 0x61, 0xFF, 0xAB, 0x48, 0xFF, 0xEB, 0x40, 0xFF, 0x7E, 0x82, 0xFF, 0xF9, 0xA2, 0xFF, 0xD9, 0xCB, 0xFF, 0xFD, 0x89, 0xFF, 0x7D, 0xD6, 0xFF, 0x7F, 0xE4, 0xFF, 0xDC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0xB0, 0xA2, 0xFF, 0xD4, 0xAA, 0xFF, 0xBD, 0xFD, 0xFF, 0x6F, 0x82, 0xFF, 0xA9, 0x61, 0xFF, 0xEC, 0x79, 0xFF, 0xB1, 0x92, 0xFF, 0x95, 0xBB, 0xFF, 0xAC, 0x61, 0xFF, 0xD5, 0xB3, 0xFF,
-    0x0D, 0x72, 0xFF, 0xF3, 0xA2, 0xFF, 0x4A, 0x49, 0xFF, 0x53, 0x9B, 0xFF, 0x6A, 0x51, 0xFF, 0x8C, 0x61, 0xFF, 0xCF, 0x69, 0xFF, 0xCD, 0x61, 0xFF, 0xED, 0x69, 0xFF, 0x6B, 0x59, 0xFF, 0x8E, 0x71, 0xFF, 0x8B, 0x59, 0xFF, 0x69, 0x51, 0xFF, 0x4A, 0x49, 0xFF, 0x92, 0x8A, 0xFF, 0x4B, 0x59, 0xFF, 0x8A, 0x51, 0xFF, 0x0D, 0x6A, 0xFF, 0xED, 0x69, 0xFF, 0xF2, 0x9A, 0xFF, 0x6B, 0x51, 0xFF, 0xAC, 0x59, 0xFF, 0xCD, 0x61, 0xFF, 0xAC, 0x61, 0xFF, 0x8B, 0x61, 0xFF, 0x0D, 0x6A, 0xFF, 0x2D, 0x72, 0xFF, 0x8F, 0x7A, 0xFF, 0x6E, 0x7A, 0xFF, 0xD0, 0x8A, 0xFF, 0x6E, 0x7A, 0xFF, 0x8F, 0x82, 0xFF, 0xC7, 0x30, 0xFF, 0x29, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0xB0, 0x7A, 0xFF, 0xC7, 0x30, 0xFF, 0x85, 0x28, 0xFF, 0x4A, 0x51, 0xFF, 0x2C, 0x62, 0xFF, 0xCB, 0x61, 0xFF, 0x06, 0x39, 0xFF, 0x47, 0x51, 0xFF, 0x89, 0x51, 0xFF, 0x48, 0x49, 0xFF, 0x84, 0x28, 0xFF, 0x30, 0x72, 0xFF, 0xA9, 0x51, 0xFF, 0x48, 0x41, 0xFF, 0xE6, 0x38, 0xFF, 0x87, 0x30, 0xFF, 0x93, 0x82, 0xFF, 0x4D, 0x6A, 0xFF, 0x54, 0xA3, 0xFF, 0x36, 0xA3, 0xFF, 0xF6, 0x9A, 0xFF, 0x4F, 0x59, 0xFF, 0x2E, 0x59, 0xFF, 0xCD, 0x48, 0xFF, 0x34, 0x7A, 0xFF, 0x4E, 0x59, 0xFF, 0xB0, 0x69, 0xFF, 0x1B, 0x9B, 0xFF, 0x96, 0x92, 0xFF,
-    0x9D, 0x9A, 0xFF, 0xDD, 0xB5, 0xFF, 0x3A, 0xB3, 0xFF, 0x96, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xD0, 0xA2, 0xFF, 0x34, 0xB3, 0xFF, 0xD4, 0xCB, 0xFF, 0xD5, 0xD3, 0xFF, 0x0B, 0x6A, 0xFF, 0x0E, 0x82, 0xFF, 0xF1, 0x81, 0xFF, 0xCC, 0x79, 0xFF, 0x2F, 0x7A, 0xFF, 0x4E, 0x82, 0xFF, 0x0F, 0x7A, 0xFF, 0xAC, 0x69, 0xFF, 0x91, 0x82, 0xFF, 0xD4, 0x92, 0xFF, 0x0A, 0x51, 0xFF, 0xD4, 0x9A, 0xFF, 0x0F, 0x72, 0xFF, 0x8C, 0x59, 0xFF, 0x15, 0x9B, 0xFF, 0x50, 0x82, 0xFF, 0xAB, 0x61, 0xFF, 0xA9, 0x59, 0xFF, 0xEC, 0x61, 0xFF, 0x31, 0x82, 0xFF, 0x56, 0xAB, 0xFF, 0x89, 0x51, 0xFF, 0x4D, 0x72, 0xFF, 0xCD, 0x69, 0xFF, 0x6E, 0x82, 0xFF, 0xF5, 0x9A, 0xFF, 0x8A, 0x51, 0xFF, 0xAB, 0x59, 0xFF, 0xB0, 0x8A, 0xFF, 0x6E, 0x72, 0xFF, 0xD4, 0x92, 0xFF, 0x2D, 0x72, 0xFF, 0x4D, 0x72, 0xFF, 0xD1, 0x8A, 0xFF, 0xAF, 0x82, 0xFF, 0x13, 0x93, 0xFF, 0xF2, 0x92, 0xFF, 0x8F, 0x82, 0xFF, 0x2A, 0x49, 0xFF, 0xC7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0xC4, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0x4E, 0x6A, 0xFF, 0xA6, 0x38, 0xFF, 0xA7, 0x30, 0xFF, 0x25, 0x39, 0xFF, 0xC6, 0x38, 0xFF, 0x4C, 0x72, 0xFF, 0xA5, 0x30, 0xFF, 0x06, 0x39, 0xFF, 0xC5, 0x38, 0xFF, 0xAC, 0x61, 0xFF, 0xD1, 0x82, 0xFF,
-    0x06, 0x39, 0xFF, 0x27, 0x39, 0xFF, 0xC5, 0x38, 0xFF, 0xEE, 0x61, 0xFF, 0xCF, 0x69, 0xFF, 0xCC, 0x59, 0xFF, 0xAB, 0x51, 0xFF, 0x8A, 0x38, 0xFF, 0x96, 0x8A, 0xFF, 0x70, 0x69, 0xFF, 0x4C, 0x59, 0xFF, 0x91, 0x61, 0xFF, 0x98, 0x92, 0xFF, 0x0C, 0x49, 0xFF, 0x9A, 0xBB, 0xFF, 0x55, 0x8A, 0xFF, 0x7B, 0xB3, 0xFF, 0xF3, 0x79, 0xFF, 0xD5, 0xA2, 0xFF, 0x58, 0xDC, 0xFF, 0x5E, 0xFE, 0xFF, 0xD6, 0xD3, 0xFF, 0x0E, 0x7A, 0xFF, 0x57, 0xB3, 0xFF, 0x38, 0xD4, 0xFF, 0x93, 0x92, 0xFF, 0x2C, 0x7A, 0xFF, 0x16, 0xCC, 0xFF, 0x31, 0x92, 0xFF, 0xB1, 0xA2, 0xFF, 0x69, 0x51, 0xFF, 0xEE, 0x8A, 0xFF, 0x90, 0xA2, 0xFF, 0xEA, 0x69, 0xFF, 0x96, 0xAB, 0xFF, 0x6D, 0x61, 0xFF, 0x56, 0xA3, 0xFF, 0xEA, 0x48, 0xFF, 0x8C, 0x61, 0xFF, 0xCF, 0x69, 0xFF, 0xD0, 0x81, 0xFF, 0x6C, 0x59, 0xFF, 0x8A, 0x59, 0xFF, 0x8C, 0x61, 0xFF, 0xF0, 0x81, 0xFF, 0xAC, 0x61, 0xFF, 0x6B, 0x51, 0xFF, 0x6A, 0x51, 0xFF, 0x93, 0xB3, 0xFF, 0x54, 0xA3, 0xFF, 0xAC, 0x61, 0xFF, 0x32, 0x9B, 0xFF, 0xAC, 0x61, 0xFF, 0xAC, 0x61, 0xFF, 0x95, 0xAB, 0xFF, 0xED, 0x69, 0xFF, 0xED, 0x69, 0xFF, 0x6C, 0x72, 0xFF, 0x4C, 0x72, 0xFF, 0x12, 0x9B, 0xFF, 0xD0, 0x8A, 0xFF, 0x6E, 0x82, 0xFF, 0x2D, 0x72, 0xFF, 0x8E, 0x82, 0xFF,
-    0xA4, 0x28, 0xFF, 0x47, 0x41, 0xFF, 0xCD, 0x61, 0xFF, 0xC8, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xD5, 0xCC, 0xFF, 0xE7, 0x38, 0xFF, 0x4E, 0x72, 0xFF, 0xA6, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0x68, 0x49, 0xFF, 0xA4, 0x30, 0xFF, 0xEB, 0x61, 0xFF, 0xC6, 0x30, 0xFF, 0x48, 0x49, 0xFF, 0x8A, 0x51, 0xFF, 0x27, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0x70, 0x72, 0xFF, 0x6F, 0x61, 0xFF, 0x48, 0x49, 0xFF, 0x08, 0x49, 0xFF, 0x4D, 0x51, 0xFF, 0x96, 0x8A, 0xFF, 0x4F, 0x61, 0xFF, 0x79, 0xBC, 0xFF, 0x0C, 0x49, 0xFF, 0xB4, 0x69, 0xFF, 0xCF, 0x71, 0xFF, 0xD1, 0x81, 0xFF, 0x13, 0x82, 0xFF, 0x51, 0x69, 0xFF, 0x35, 0xAB, 0xFF, 0x14, 0xA3, 0xFF, 0x7F, 0xFD, 0xFF, 0x56, 0xBB, 0xFF, 0x8D, 0x61, 0xFF, 0xF3, 0x71, 0xFF, 0xDE, 0xEC, 0xFF, 0x75, 0x92, 0xFF, 0xCB, 0x79, 0xFF, 0x31, 0xD3, 0xFF, 0xF4, 0xEC, 0xFF, 0x34, 0xC3, 0xFF, 0xCA, 0x61, 0xFF, 0x88, 0x59, 0xFF, 0x2B, 0x7A, 0xFF, 0xC9, 0x61, 0xFF, 0xD3, 0xA2, 0xFF, 0x77, 0xA3, 0xFF, 0xCD, 0x61, 0xFF, 0x4A, 0x49, 0xFF, 0x30, 0x82, 0xFF, 0x53, 0x92, 0xFF, 0xAC, 0x61, 0xFF, 0x6C, 0x59, 0xFF, 0xCD, 0x69, 0xFF, 0x97, 0xB3, 0xFF, 0x6B, 0x59, 0xFF, 0xCA, 0x61, 0xFF, 0x8A, 0x51, 0xFF, 0x51, 0xAB, 0xFF,
-    0xD3, 0x9A, 0xFF, 0x8C, 0x61, 0xFF, 0xF0, 0x92, 0xFF, 0x6E, 0x7A, 0xFF, 0x8A, 0x59, 0xFF, 0x31, 0xAB, 0xFF, 0xEB, 0x61, 0xFF, 0x4B, 0x72, 0xFF, 0x2A, 0x62, 0xFF, 0x2D, 0x72, 0xFF, 0x8F, 0x82, 0xFF, 0x93, 0xAB, 0xFF, 0xAF, 0x82, 0xFF, 0x8E, 0x82, 0xFF, 0xAE, 0x82, 0xFF, 0xAF, 0x8A, 0xFF, 0xC6, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xEE, 0x61, 0xFF, 0x2D, 0x62, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0x48, 0x49, 0xFF, 0x6F, 0x72, 0xFF, 0xA6, 0x30, 0xFF, 0x28, 0x41, 0xFF, 0xE6, 0x38, 0xFF, 0x8E, 0x82, 0xFF, 0x27, 0x41, 0xFF, 0x0B, 0x62, 0xFF, 0x26, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0x4F, 0x7A, 0xFF, 0xE7, 0x40, 0xFF, 0xCB, 0x59, 0xFF, 0xC9, 0x38, 0xFF, 0xB5, 0x92, 0xFF, 0x6B, 0x51, 0xFF, 0x4B, 0x51, 0xFF, 0x38, 0x9B, 0xFF, 0xCF, 0x58, 0xFF, 0x12, 0x7A, 0xFF, 0x0D, 0x49, 0xFF, 0xB8, 0x8A, 0xFF, 0x51, 0x9A, 0xFF, 0x36, 0xB3, 0xFF, 0x15, 0x9B, 0xFF, 0xB9, 0x92, 0xFF, 0xCE, 0x79, 0xFF, 0x56, 0x71, 0xFF, 0x97, 0x9A, 0xFF, 0x7F, 0xED, 0xFF, 0x71, 0x61, 0xFF, 0x99, 0x79, 0xFF, 0x5C, 0xC6, 0xFF, 0x1E, 0x7A, 0xFF, 0x2D, 0x8A, 0xFF, 0x18, 0xFD, 0xFF, 0xB7, 0xE5, 0xFF, 0x14, 0xBB, 0xFF, 0xC8, 0x61, 0xFF, 0x2F, 0xA3, 0xFF,
-    0xD0, 0x92, 0xFF, 0xD1, 0xAA, 0xFF, 0x6B, 0x51, 0xFF, 0xB1, 0x82, 0xFF, 0x8C, 0x61, 0xFF, 0x2A, 0x51, 0xFF, 0x56, 0xB3, 0xFF, 0x2F, 0x72, 0xFF, 0x6B, 0x59, 0xFF, 0x17, 0xC4, 0xFF, 0x10, 0x8A, 0xFF, 0xAC, 0x61, 0xFF, 0x8C, 0x69, 0xFF, 0xEC, 0x71, 0xFF, 0x56, 0xBC, 0xFF, 0x34, 0xB3, 0xFF, 0xAC, 0x61, 0xFF, 0x0B, 0x72, 0xFF, 0x87, 0x51, 0xFF, 0x50, 0xAB, 0xFF, 0x0C, 0x6A, 0xFF, 0x0B, 0x6A, 0xFF, 0xE9, 0x61, 0xFF, 0xEA, 0x69, 0xFF, 0xAC, 0x71, 0xFF, 0x31, 0x93, 0xFF, 0x8E, 0x7A, 0xFF, 0xCF, 0x8A, 0xFF, 0x10, 0x93, 0xFF, 0x10, 0x9B, 0xFF, 0xCE, 0x8A, 0xFF, 0xAE, 0x8A, 0xFF, 0xA6, 0x28, 0xFF, 0xE8, 0x38, 0xFF, 0xE7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x66, 0x30, 0xFF, 0x0E, 0x62, 0xFF, 0xE8, 0x38, 0xFF, 0x8E, 0x72, 0xFF, 0x06, 0x39, 0xFF, 0x4E, 0x72, 0xFF, 0xA7, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0x68, 0x49, 0xFF, 0xCF, 0x8A, 0xFF, 0x68, 0x49, 0xFF, 0xC6, 0x30, 0xFF, 0xE5, 0x30, 0xFF, 0xF3, 0x92, 0xFF, 0xEE, 0x69, 0xFF, 0x89, 0x51, 0xFF, 0x27, 0x49, 0xFF, 0xCA, 0x48, 0xFF, 0x55, 0x8A, 0xFF, 0x29, 0x49, 0xFF, 0x72, 0x8A, 0xFF, 0xED, 0x48, 0xFF, 0xF8, 0xA2, 0xFF, 0xAC, 0x40, 0xFF, 0xED, 0x48, 0xFF, 0x33, 0x82, 0xFF, 0x31, 0x82, 0xFF,
-    0x31, 0x69, 0xFF, 0x55, 0x92, 0xFF, 0x12, 0x7A, 0xFF, 0xF1, 0x81, 0xFF, 0x3B, 0xBB, 0xFF, 0x56, 0xA3, 0xFF, 0x8D, 0x61, 0xFF, 0x6F, 0x61, 0xFF, 0x7A, 0xBB, 0xFF, 0xF2, 0x79, 0xFF, 0xEC, 0x79, 0xFF, 0x11, 0xC3, 0xFF, 0x4D, 0xB2, 0xFF, 0x2C, 0x82, 0xFF, 0x0A, 0x6A, 0xFF, 0x67, 0x51, 0xFF, 0x0D, 0x7A, 0xFF, 0x33, 0xA3, 0xFF, 0xEE, 0x69, 0xFF, 0x6B, 0x59, 0xFF, 0xAD, 0x61, 0xFF, 0x36, 0xB3, 0xFF, 0x90, 0x92, 0xFF, 0x33, 0x93, 0xFF, 0xB2, 0x8A, 0xFF, 0xD4, 0x9A, 0xFF, 0xCE, 0x79, 0xFF, 0x0E, 0x72, 0xFF, 0xEE, 0x71, 0xFF, 0xCD, 0x71, 0xFF, 0xD5, 0xC3, 0xFF, 0x2D, 0x7A, 0xFF, 0xA9, 0x61, 0xFF, 0xCB, 0x69, 0xFF, 0x33, 0xAB, 0xFF, 0xE9, 0x61, 0xFF, 0xE8, 0x61, 0xFF, 0xE9, 0x61, 0xFF, 0xBD, 0xFF, 0xFF, 0xAA, 0x61, 0xFF, 0xE9, 0x61, 0xFF, 0x2B, 0x72, 0xFF, 0xF0, 0x92, 0xFF, 0x52, 0xA3, 0xFF, 0xF0, 0x92, 0xFF, 0xF0, 0x92, 0xFF, 0x0C, 0x7A, 0xFF, 0xAE, 0x8A, 0xFF, 0xA6, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0x45, 0x28, 0xFF, 0xE5, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0x08, 0x49, 0xFF, 0xE8, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0x06, 0x39, 0xFF, 0xA6, 0x30, 0xFF, 0xAB, 0x59, 0xFF, 0xC5, 0x38, 0xFF, 0xE7, 0x40, 0xFF,
-    0xE6, 0x38, 0xFF, 0x05, 0x39, 0xFF, 0x89, 0x51, 0xFF, 0xC7, 0x38, 0xFF, 0x4B, 0x51, 0xFF, 0xCA, 0x59, 0xFF, 0x26, 0x41, 0xFF, 0xCE, 0x61, 0xFF, 0x13, 0x72, 0xFF, 0x8C, 0x59, 0xFF, 0x34, 0xB4, 0xFF, 0x52, 0x7A, 0xFF, 0xD8, 0x92, 0xFF, 0x0A, 0x49, 0xFF, 0x4F, 0x59, 0xFF, 0xAE, 0x61, 0xFF, 0xF1, 0x79, 0xFF, 0x6C, 0x61, 0xFF, 0x6E, 0x61, 0xFF, 0x6E, 0x61, 0xFF, 0xF9, 0xAA, 0xFF, 0xD3, 0x92, 0xFF, 0x50, 0x7A, 0xFF, 0x4E, 0x59, 0xFF, 0x1D, 0xDC, 0xFF, 0x4B, 0x59, 0xFF, 0xEA, 0x69, 0xFF, 0x2D, 0x82, 0xFF, 0x2F, 0x9A, 0xFF, 0x4C, 0x7A, 0xFF, 0xA9, 0x61, 0xFF, 0x35, 0xCD, 0xFF, 0xEE, 0x81, 0xFF, 0xEC, 0x69, 0xFF, 0x88, 0x59, 0xFF, 0x4B, 0x59, 0xFF, 0x15, 0xA3, 0xFF, 0xCA, 0x48, 0xFF, 0x91, 0x82, 0xFF, 0xEE, 0x69, 0xFF, 0x9C, 0xEC, 0xFF, 0x33, 0x7A, 0xFF, 0x13, 0x7A, 0xFF, 0xF0, 0x79, 0xFF, 0x12, 0xB3, 0xFF, 0x4D, 0x9A, 0xFF, 0x6B, 0x8A, 0xFF, 0x2D, 0x82, 0xFF, 0xED, 0x79, 0xFF, 0xEA, 0x69, 0xFF, 0xA8, 0x59, 0xFF, 0x0A, 0x6A, 0xFF, 0xE9, 0x69, 0xFF, 0xE9, 0x69, 0xFF, 0x29, 0x6A, 0xFF, 0x29, 0x6A, 0xFF, 0xCD, 0x8A, 0xFF, 0x0A, 0x72, 0xFF, 0xCF, 0x92, 0xFF, 0x31, 0x9B, 0xFF, 0x31, 0x9B, 0xFF, 0x8F, 0x8A, 0xFF, 0xAF, 0x8A, 0xFF, 0x6E, 0x7A, 0xFF,
-    0x86, 0x28, 0xFF, 0xE7, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x2D, 0x6A, 0xFF, 0xA7, 0x30, 0xFF, 0xCC, 0x59, 0xFF, 0x08, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0x89, 0x59, 0xFF, 0xD0, 0x92, 0xFF, 0xCB, 0x59, 0xFF, 0x29, 0x41, 0xFF, 0x65, 0x28, 0xFF, 0xC6, 0x38, 0xFF, 0x77, 0xD4, 0xFF, 0xEC, 0x61, 0xFF, 0x06, 0x39, 0xFF, 0xE5, 0x38, 0xFF, 0xEA, 0x61, 0xFF, 0xF0, 0x71, 0xFF, 0x54, 0x82, 0xFF, 0x91, 0x82, 0xFF, 0x88, 0x51, 0xFF, 0xC7, 0x40, 0xFF, 0x0C, 0x49, 0xFF, 0x34, 0x82, 0xFF, 0x4C, 0x51, 0xFF, 0xB5, 0xB3, 0xFF, 0x3A, 0xBC, 0xFF, 0x10, 0x72, 0xFF, 0xB2, 0x9A, 0xFF, 0xB0, 0x82, 0xFF, 0xEA, 0x48, 0xFF, 0xCB, 0x48, 0xFF, 0x0B, 0x51, 0xFF, 0x56, 0x8A, 0xFF, 0xD4, 0x79, 0xFF, 0xB1, 0x92, 0xFF, 0x8A, 0x59, 0xFF, 0x2B, 0x49, 0xFF, 0xB4, 0xA2, 0xFF, 0x90, 0x82, 0xFF, 0xA8, 0x59, 0xFF, 0xAF, 0x8A, 0xFF, 0xAC, 0x79, 0xFF, 0x6C, 0x69, 0xFF, 0x95, 0xB3, 0xFF, 0x6E, 0x82, 0xFF, 0x0C, 0x72, 0xFF, 0xA9, 0x59, 0xFF, 0x31, 0xAB, 0xFF, 0x93, 0x9A, 0xFF, 0x4D, 0x59, 0xFF, 0x4B, 0x49, 0xFF, 0x1E, 0xDD, 0xFF, 0x9D, 0xBB, 0xFF, 0xD7, 0x9A, 0xFF, 0x58, 0x92, 0xFF, 0xFF, 0xE7, 0xFF, 0x1F, 0xFE, 0xFF, 0x76, 0xEC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x92, 0xFF,
-    0x50, 0xA3, 0xFF, 0x73, 0xB3, 0xFF, 0x57, 0xED, 0xFF, 0x72, 0xB3, 0xFF, 0x09, 0x72, 0xFF, 0x29, 0x6A, 0xFF, 0x54, 0xCC, 0xFF, 0x50, 0xAB, 0xFF, 0x32, 0xCC, 0xFF, 0xB8, 0xFE, 0xFF, 0x10, 0xD4, 0xFF, 0x12, 0xA3, 0xFF, 0xB3, 0x8A, 0xFF, 0x5F, 0x9D, 0xFF, 0xB7, 0xB3, 0xFF, 0x36, 0xCC, 0xFF, 0xC4, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0x2E, 0x72, 0xFF, 0xEC, 0x59, 0xFF, 0xE7, 0x38, 0xFF, 0x46, 0x41, 0xFF, 0xE6, 0x38, 0xFF, 0xEC, 0x69, 0xFF, 0xAB, 0x59, 0xFF, 0xE8, 0x38, 0xFF, 0xA8, 0x51, 0xFF, 0xA8, 0x51, 0xFF, 0x6F, 0x82, 0xFF, 0xE8, 0x40, 0xFF, 0x8E, 0x7A, 0xFF, 0x29, 0x49, 0xFF, 0x89, 0x49, 0xFF, 0x90, 0x82, 0xFF, 0xA9, 0x59, 0xFF, 0xEB, 0x61, 0xFF, 0x0B, 0x49, 0xFF, 0x0E, 0x51, 0xFF, 0x0D, 0x6A, 0xFF, 0x28, 0x49, 0xFF, 0x47, 0x49, 0xFF, 0xCB, 0x40, 0xFF, 0xB7, 0x9A, 0xFF, 0x4C, 0x51, 0xFF, 0xCE, 0x69, 0xFF, 0x6D, 0x59, 0xFF, 0x6B, 0x59, 0xFF, 0xF1, 0xA2, 0xFF, 0x08, 0x49, 0xFF, 0xB3, 0x8A, 0xFF, 0x6F, 0x69, 0xFF, 0xD1, 0x69, 0xFF, 0x8D, 0x61, 0xFF, 0x4F, 0x82, 0xFF, 0xAB, 0x61, 0xFF, 0x2A, 0x51, 0xFF, 0x14, 0xAB, 0xFF, 0x89, 0x59, 0xFF, 0xC9, 0x59, 0xFF, 0x2A, 0x51, 0xFF, 0x09, 0x49, 0xFF, 0x72, 0x92, 0xFF, 0x4B, 0x59, 0xFF, 0x71, 0x7A, 0xFF,
-    0xEC, 0x69, 0xFF, 0xB4, 0xBB, 0xFF, 0x55, 0xB3, 0xFF, 0x4F, 0x7A, 0xFF, 0x2C, 0x51, 0xFF, 0xF5, 0x92, 0xFF, 0x9B, 0xBB, 0xFF, 0xF2, 0x81, 0xFF, 0x8F, 0x71, 0xFF, 0xFE, 0xCD, 0xFF, 0xDD, 0x79, 0xFF, 0x78, 0xC3, 0xFF, 0x59, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF4, 0xFF, 0xD1, 0xBB, 0xFF, 0x13, 0xAB, 0xFF, 0x53, 0xBB, 0xFF, 0xA9, 0x61, 0xFF, 0x0A, 0x8A, 0xFF, 0x8E, 0x8A, 0xFF, 0x92, 0xBB, 0xFF, 0x2C, 0x72, 0xFF, 0x0D, 0xA3, 0xFF, 0xDF, 0xFF, 0xFF, 0x8F, 0xA2, 0xFF, 0x71, 0xAB, 0xFF, 0x39, 0xA3, 0xFF, 0xD6, 0x8A, 0xFF, 0xD3, 0x92, 0xFF, 0xF1, 0x92, 0xFF, 0xF1, 0x9A, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xC7, 0x30, 0xFF, 0x8B, 0x59, 0xFF, 0x49, 0x49, 0xFF, 0xC7, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0x8A, 0x51, 0xFF, 0x4E, 0x72, 0xFF, 0x4A, 0x49, 0xFF, 0xCB, 0x59, 0xFF, 0xCA, 0x59, 0xFF, 0xCA, 0x59, 0xFF, 0xAB, 0x59, 0xFF, 0xE8, 0x40, 0xFF, 0x08, 0x41, 0xFF, 0xC9, 0x59, 0xFF, 0xC8, 0x48, 0xFF, 0xC6, 0x38, 0xFF, 0x0B, 0x62, 0xFF, 0xA7, 0x38, 0xFF, 0x0F, 0x51, 0xFF, 0xF5, 0x9A, 0xFF, 0x49, 0x51, 0xFF, 0xE9, 0x40, 0xFF, 0x7A, 0xC4, 0xFF, 0x75, 0x8A, 0xFF, 0x2C, 0x51, 0xFF, 0x8A, 0x38, 0xFF, 0x4B, 0x51, 0xFF, 0x90, 0x9A, 0xFF,
-    0x4A, 0x59, 0xFF, 0xCC, 0x61, 0xFF, 0xEA, 0x48, 0xFF, 0xB0, 0x69, 0xFF, 0xF4, 0x79, 0xFF, 0xD2, 0x71, 0xFF, 0x10, 0x72, 0xFF, 0xE8, 0x48, 0xFF, 0xF3, 0xA2, 0xFF, 0xA9, 0x51, 0xFF, 0x8C, 0x7A, 0xFF, 0x2A, 0x51, 0xFF, 0x8C, 0x61, 0xFF, 0xF4, 0xA2, 0xFF, 0x07, 0x41, 0xFF, 0x29, 0x49, 0xFF, 0x8C, 0x61, 0xFF, 0xD3, 0x9A, 0xFF, 0x6C, 0x59, 0xFF, 0xEE, 0x69, 0xFF, 0x4D, 0x59, 0xFF, 0xF7, 0xAA, 0xFF, 0xB1, 0x71, 0xFF, 0x52, 0x82, 0xFF, 0xF0, 0x79, 0xFF, 0x94, 0x9A, 0xFF, 0xFC, 0xF4, 0xFF, 0xF1, 0xA2, 0xFF, 0x0E, 0xAB, 0xFF, 0x0F, 0xBB, 0xFF, 0x57, 0xE4, 0xFF, 0xEC, 0x79, 0xFF, 0xCB, 0x69, 0xFF, 0xAF, 0x8A, 0xFF, 0x55, 0xDC, 0xFF, 0x59, 0xF6, 0xFF, 0x8F, 0xA3, 0xFF, 0x4A, 0x72, 0xFF, 0x71, 0xBB, 0xFF, 0x6F, 0x8A, 0xFF, 0x6C, 0x82, 0xFF, 0x0B, 0x72, 0xFF, 0x51, 0x9B, 0xFF, 0xF4, 0xBB, 0xFF, 0x31, 0x9B, 0xFF, 0x3B, 0xEE, 0xFF, 0x11, 0x9B, 0xFF, 0x92, 0xB3, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x69, 0x49, 0xFF, 0xE8, 0x38, 0xFF, 0x29, 0x41, 0xFF, 0xA6, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0x49, 0x49, 0xFF, 0x08, 0x39, 0xFF, 0x07, 0x39, 0xFF, 0xAA, 0x51, 0xFF, 0x8B, 0x51, 0xFF, 0x4A, 0x49, 0xFF, 0x69, 0x49, 0xFF, 0x0B, 0x62, 0xFF,
-    0x8E, 0x7A, 0xFF, 0x0D, 0x62, 0xFF, 0xE6, 0x38, 0xFF, 0x2C, 0x6A, 0xFF, 0x8F, 0x82, 0xFF, 0x27, 0x41, 0xFF, 0x29, 0x49, 0xFF, 0x30, 0x72, 0xFF, 0x94, 0x82, 0xFF, 0x0A, 0x49, 0xFF, 0x4D, 0x51, 0xFF, 0xF0, 0x71, 0xFF, 0x55, 0x82, 0xFF, 0x2D, 0x51, 0xFF, 0xEC, 0x40, 0xFF, 0x08, 0x41, 0xFF, 0xCF, 0x8A, 0xFF, 0xAD, 0x61, 0xFF, 0x8C, 0x59, 0xFF, 0x0D, 0x51, 0xFF, 0x76, 0x8A, 0xFF, 0xD0, 0x71, 0xFF, 0x4D, 0x51, 0xFF, 0x4C, 0x51, 0xFF, 0x91, 0x8A, 0xFF, 0x68, 0x51, 0xFF, 0x89, 0x51, 0xFF, 0x68, 0x51, 0xFF, 0x0C, 0x59, 0xFF, 0xCA, 0x61, 0xFF, 0x27, 0x41, 0xFF, 0x07, 0x49, 0xFF, 0xF0, 0x79, 0xFF, 0x4B, 0x51, 0xFF, 0x6C, 0x51, 0xFF, 0x6E, 0x61, 0xFF, 0xD4, 0x79, 0xFF, 0x71, 0x61, 0xFF, 0xF5, 0x71, 0xFF, 0xD5, 0x79, 0xFF, 0x7E, 0xFD, 0xFF, 0xF6, 0xDB, 0xFF, 0x13, 0xFD, 0xFF, 0x52, 0xC3, 0xFF, 0x13, 0xB3, 0xFF, 0x6E, 0x8A, 0xFF, 0x4C, 0x7A, 0xFF, 0xE9, 0x79, 0xFF, 0xEC, 0x81, 0xFF, 0x6C, 0x82, 0xFF, 0xC8, 0x61, 0xFF, 0xF9, 0xFD, 0xFF, 0x09, 0x72, 0xFF, 0xC8, 0x69, 0xFF, 0x2A, 0x72, 0xFF, 0x31, 0xB4, 0xFF, 0xD1, 0xB3, 0xFF, 0x69, 0x61, 0xFF, 0x51, 0x9B, 0xFF, 0x92, 0xAB, 0xFF, 0x91, 0xB3, 0xFF, 0x90, 0xAB, 0xFF, 0xAF, 0x9A, 0xFF, 0xD0, 0x92, 0xFF,
-    0x08, 0x39, 0xFF, 0xC7, 0x30, 0xFF, 0x49, 0x49, 0xFF, 0xE7, 0x30, 0xFF, 0x49, 0x41, 0xFF, 0xE7, 0x38, 0xFF, 0x08, 0x39, 0xFF, 0x6A, 0x49, 0xFF, 0x08, 0x39, 0xFF, 0xE7, 0x38, 0xFF, 0x29, 0x41, 0xFF, 0xE9, 0x40, 0xFF, 0x49, 0x49, 0xFF, 0x48, 0x49, 0xFF, 0x2C, 0x62, 0xFF, 0x0D, 0x62, 0xFF, 0xE7, 0x38, 0xFF, 0xA8, 0x51, 0xFF, 0x07, 0x49, 0xFF, 0x28, 0x49, 0xFF, 0xCA, 0x59, 0xFF, 0xE8, 0x40, 0xFF, 0x89, 0x38, 0xFF, 0x6B, 0x51, 0xFF, 0x0A, 0x41, 0xFF, 0x72, 0x72, 0xFF, 0x11, 0x6A, 0xFF, 0x6D, 0x51, 0xFF, 0x6D, 0x51, 0xFF, 0xF2, 0x69, 0xFF, 0xEB, 0x40, 0xFF, 0x4C, 0x51, 0xFF, 0x8E, 0x72, 0xFF, 0x49, 0x51, 0xFF, 0x8C, 0x51, 0xFF, 0x8A, 0x51, 0xFF, 0xD3, 0x69, 0xFF, 0x4E, 0x59, 0xFF, 0x8E, 0x59, 0xFF, 0x0B, 0x49, 0xFF, 0xD4, 0x8A, 0xFF, 0xAB, 0x61, 0xFF, 0x4A, 0x51, 0xFF, 0x29, 0x49, 0xFF, 0x4C, 0x59, 0xFF, 0xA9, 0x59, 0xFF, 0xE6, 0x40, 0xFF, 0xF5, 0x8A, 0xFF, 0xAD, 0x69, 0xFF, 0xE8, 0x40, 0xFF, 0x30, 0x72, 0xFF, 0x5C, 0x7A, 0xFF, 0xB1, 0x69, 0xFF, 0x3A, 0x59, 0xFF, 0xBE, 0xEF, 0xFF, 0xBE, 0xD4, 0xFF, 0x94, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xDB, 0xFF, 0xAF, 0xA2, 0xFF, 0xD3, 0xBB, 0xFF, 0xCB, 0x71, 0xFF, 0xE9, 0x69, 0xFF,
-    0x2D, 0x7A, 0xFF, 0xB2, 0xB3, 0xFF, 0xD5, 0xD4, 0xFF, 0xAF, 0xA3, 0xFF, 0xEE, 0x9A, 0xFF, 0x0D, 0x8B, 0xFF, 0xCD, 0x82, 0xFF, 0xAD, 0x8A, 0xFF, 0x92, 0x9B, 0xFF, 0x8E, 0x8A, 0xFF, 0x91, 0xA3, 0xFF, 0x35, 0xDD, 0xFF, 0x78, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xBB, 0xFF, 0xFE, 0xE7, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0xAB, 0x51, 0xFF, 0xD2, 0x92, 0xFF, 0x50, 0x7A, 0xFF, 0x08, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0x4D, 0x6A, 0xFF, 0x07, 0x41, 0xFF, 0xD1, 0x8A, 0xFF, 0x08, 0x39, 0xFF, 0xC7, 0x38, 0xFF, 0x29, 0x49, 0xFF, 0xA7, 0x38, 0xFF, 0x92, 0x8A, 0xFF, 0x89, 0x51, 0xFF, 0xE7, 0x38, 0xFF, 0x8B, 0x51, 0xFF, 0x08, 0x41, 0xFF, 0x2A, 0x49, 0xFF, 0x37, 0xA3, 0xFF, 0x29, 0x49, 0xFF, 0x07, 0x41, 0xFF, 0x6B, 0x51, 0xFF, 0x4C, 0x51, 0xFF, 0xB4, 0x92, 0xFF, 0x0B, 0x49, 0xFF, 0x10, 0x6A, 0xFF, 0x96, 0xA3, 0xFF, 0xAC, 0x61, 0xFF, 0x53, 0x82, 0xFF, 0x6C, 0x59, 0xFF, 0x4F, 0x7A, 0xFF, 0x28, 0x49, 0xFF, 0x4B, 0x51, 0xFF, 0xB3, 0x92, 0xFF, 0x6C, 0x51, 0xFF, 0xF3, 0x79, 0xFF, 0x2C, 0x49, 0xFF, 0xE8, 0x48, 0xFF, 0xD2, 0x92, 0xFF, 0x8A, 0x59, 0xFF, 0x6C, 0x59, 0xFF, 0x2D, 0x59, 0xFF, 0xEB, 0x71, 0xFF, 0x2E, 0x7A, 0xFF, 0xCD, 0x71, 0xFF, 0xEC, 0x69, 0xFF,
-    0xAB, 0x61, 0xFF, 0xA9, 0x40, 0xFF, 0x8E, 0x69, 0xFF, 0xD5, 0x9A, 0xFF, 0xD0, 0x69, 0xFF, 0x16, 0x82, 0xFF, 0xB8, 0x69, 0xFF, 0x77, 0x8A, 0xFF, 0x76, 0xCB, 0xFF, 0x76, 0xFD, 0xFF, 0x4F, 0xD3, 0xFF, 0xB3, 0xCB, 0xFF, 0x0E, 0x82, 0xFF, 0x34, 0xAB, 0xFF, 0xB2, 0x9A, 0xFF, 0x92, 0xAB, 0xFF, 0xAE, 0x8A, 0xFF, 0x11, 0xA3, 0xFF, 0x0C, 0x7A, 0xFF, 0x10, 0xA3, 0xFF, 0x08, 0x6A, 0xFF, 0x6E, 0x9B, 0xFF, 0x94, 0xD4, 0xFF, 0x2C, 0x72, 0xFF, 0xD1, 0x92, 0xFF, 0x28, 0x59, 0xFF, 0x51, 0xA3, 0xFF, 0x77, 0xED, 0xFF, 0x8C, 0x8A, 0xFF, 0xF0, 0x9A, 0xFF, 0x2D, 0x82, 0xFF, 0xCF, 0x92, 0xFF, 0x05, 0x39, 0xFF, 0x8C, 0x51, 0xFF, 0x08, 0x49, 0xFF, 0x55, 0x6A, 0xFF, 0x69, 0x51, 0xFF, 0x26, 0x41, 0xFF, 0x97, 0xC4, 0xFF, 0x0C, 0x6A, 0xFF, 0x8D, 0x72, 0xFF, 0x4E, 0x7A, 0xFF, 0x26, 0x41, 0xFF, 0xC6, 0x38, 0xFF, 0x90, 0x82, 0xFF, 0x68, 0x51, 0xFF, 0x8B, 0x59, 0xFF, 0xA9, 0x40, 0xFF, 0x49, 0x51, 0xFF, 0x70, 0x8A, 0xFF, 0x27, 0x49, 0xFF, 0x69, 0x51, 0xFF, 0x2C, 0x51, 0xFF, 0xD2, 0x81, 0xFF, 0x72, 0x8A, 0xFF, 0x49, 0x49, 0xFF, 0x2A, 0x41, 0xFF, 0x31, 0x8B, 0xFF, 0xD2, 0x9A, 0xFF, 0xAE, 0x61, 0xFF, 0xCF, 0x61, 0xFF, 0xEF, 0x61, 0xFF, 0x4A, 0x51, 0xFF, 0x53, 0x8A, 0xFF,
-    0xEB, 0x48, 0xFF, 0xEA, 0x40, 0xFF, 0x0E, 0x6A, 0xFF, 0x29, 0x49, 0xFF, 0x70, 0x82, 0xFF, 0x0A, 0x49, 0xFF, 0x0A, 0x41, 0xFF, 0x49, 0x49, 0xFF, 0xF3, 0x9A, 0xFF, 0xA9, 0x59, 0xFF, 0xEB, 0x40, 0xFF, 0x2A, 0x49, 0xFF, 0xCA, 0x61, 0xFF, 0x72, 0x8A, 0xFF, 0x27, 0x49, 0xFF, 0x48, 0x51, 0xFF, 0xCB, 0x61, 0xFF, 0x9A, 0xD4, 0xFF, 0x11, 0x82, 0xFF, 0xAD, 0x59, 0xFF, 0x6D, 0x61, 0xFF, 0x91, 0x69, 0xFF, 0x5A, 0xBB, 0xFF, 0xD6, 0xA2, 0xFF, 0x0F, 0x8A, 0xFF, 0xF1, 0xB2, 0xFF, 0x16, 0xE4, 0xFF, 0x95, 0xCB, 0xFF, 0xCC, 0x79, 0xFF, 0xCC, 0x69, 0xFF, 0xCC, 0x69, 0xFF, 0xF5, 0xCB, 0xFF, 0x11, 0xAB, 0xFF, 0x4D, 0x82, 0xFF, 0xEC, 0x69, 0xFF, 0x98, 0xAB, 0xFF, 0x2C, 0x82, 0xFF, 0xCC, 0x92, 0xFF, 0x6B, 0x82, 0xFF, 0x30, 0xB4, 0xFF, 0xB3, 0xB3, 0xFF, 0xEE, 0x79, 0xFF, 0x8D, 0x82, 0xFF, 0x30, 0xA3, 0xFF, 0xCA, 0x71, 0xFF, 0x92, 0xB3, 0xFF, 0xAB, 0x69, 0xFF, 0xF1, 0xA2, 0xFF, 0x08, 0x39, 0xFF, 0x29, 0x41, 0xFF, 0xC7, 0x38, 0xFF, 0x09, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x48, 0x41, 0xFF, 0x89, 0x51, 0xFF, 0x48, 0x49, 0xFF, 0x4D, 0x6A, 0xFF, 0xEB, 0x61, 0xFF, 0x26, 0x41, 0xFF, 0x0B, 0x6A, 0xFF, 0xAA, 0x61, 0xFF, 0x28, 0x49, 0xFF, 0xE8, 0x48, 0xFF, 0xAC, 0x61, 0xFF,
-    0xB0, 0x8A, 0xFF, 0xA9, 0x59, 0xFF, 0xEC, 0x69, 0xFF, 0xD4, 0x9A, 0xFF, 0x51, 0x82, 0xFF, 0xEE, 0x69, 0xFF, 0xAE, 0x61, 0xFF, 0xED, 0x50, 0xFF, 0xB5, 0x92, 0xFF, 0x2D, 0x59, 0xFF, 0x2D, 0x6A, 0xFF, 0x69, 0x51, 0xFF, 0x4A, 0x61, 0xFF, 0x8D, 0x59, 0xFF, 0x0B, 0x49, 0xFF, 0x2A, 0x49, 0xFF, 0xB4, 0x8A, 0xFF, 0x8A, 0x38, 0xFF, 0xCF, 0x61, 0xFF, 0x49, 0x51, 0xFF, 0x72, 0x82, 0xFF, 0x6C, 0x61, 0xFF, 0x0A, 0x41, 0xFF, 0x2A, 0x41, 0xFF, 0x96, 0xA3, 0xFF, 0x6B, 0x51, 0xFF, 0xAF, 0x61, 0xFF, 0x29, 0x49, 0xFF, 0x4C, 0x59, 0xFF, 0xCF, 0x8A, 0xFF, 0x28, 0x49, 0xFF, 0x8E, 0x7A, 0xFF, 0xD0, 0x71, 0xFF, 0x0A, 0x49, 0xFF, 0x8C, 0x59, 0xFF, 0x12, 0x72, 0xFF, 0x73, 0x71, 0xFF, 0xB6, 0x69, 0xFF, 0x5B, 0x59, 0xFF, 0x7A, 0x9A, 0xFF, 0x9D, 0xFD, 0xFF, 0x73, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xC3, 0xFF, 0xB1, 0xA2, 0xFF, 0x2E, 0x7A, 0xFF, 0xEC, 0x71, 0xFF, 0xBA, 0xED, 0xFF, 0xAF, 0x92, 0xFF, 0xAB, 0x79, 0xFF, 0x8A, 0x61, 0xFF, 0x18, 0xED, 0xFF, 0x4B, 0x8A, 0xFF, 0x86, 0x61, 0xFF, 0x69, 0x7A, 0xFF, 0xAD, 0x82, 0xFF, 0xB2, 0xAB, 0xFF, 0x14, 0xB4, 0xFF, 0xD3, 0xAB, 0xFF, 0x12, 0xC4, 0xFF, 0x8F, 0xBB, 0xFF, 0xDB, 0xFF, 0xFF, 0x2C, 0x8A, 0xFF, 0xF6, 0x9A, 0xFF,
-    0xE8, 0x38, 0xFF, 0x08, 0x39, 0xFF, 0x08, 0x39, 0xFF, 0x08, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0x08, 0x39, 0xFF, 0x09, 0x41, 0xFF, 0xC7, 0x38, 0xFF, 0x28, 0x41, 0xFF, 0x29, 0x49, 0xFF, 0x27, 0x41, 0xFF, 0xC6, 0x38, 0xFF, 0x28, 0x49, 0xFF, 0x27, 0x41, 0xFF, 0x06, 0x41, 0xFF, 0xAA, 0x59, 0xFF, 0x49, 0x51, 0xFF, 0xEA, 0x61, 0xFF, 0xAB, 0x59, 0xFF, 0xCB, 0x61, 0xFF, 0x8D, 0x61, 0xFF, 0xED, 0x69, 0xFF, 0x2F, 0x6A, 0xFF, 0xCA, 0x48, 0xFF, 0xEB, 0x40, 0xFF, 0x0B, 0x49, 0xFF, 0x8F, 0x61, 0xFF, 0x2C, 0x51, 0xFF, 0x2B, 0x51, 0xFF, 0x52, 0x9B, 0xFF, 0xD1, 0x69, 0xFF, 0xCB, 0x40, 0xFF, 0x6B, 0x51, 0xFF, 0x8C, 0x59, 0xFF, 0xCE, 0x69, 0xFF, 0xA9, 0x38, 0xFF, 0x0A, 0x49, 0xFF, 0x0C, 0x51, 0xFF, 0x0A, 0x41, 0xFF, 0xEB, 0x40, 0xFF, 0xEB, 0x61, 0xFF, 0x6C, 0x51, 0xFF, 0xEC, 0x48, 0xFF, 0x69, 0x51, 0xFF, 0xF0, 0xA2, 0xFF, 0x0E, 0x8B, 0xFF, 0x27, 0x49, 0xFF, 0x8E, 0x61, 0xFF, 0xBE, 0xF5, 0xFF, 0x6B, 0x59, 0xFF, 0xF2, 0x71, 0xFF, 0x55, 0x61, 0xFF, 0x77, 0xAB, 0xFF, 0x3C, 0x8A, 0xFF, 0xBA, 0x59, 0xFF, 0xDA, 0x79, 0xFF, 0x8E, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xF6, 0xFF, 0xD3, 0xDB, 0xFF, 0x53, 0xB3, 0xFF, 0x32, 0xA3, 0xFF, 0xEC, 0x71, 0xFF, 0x0D, 0x82, 0xFF,
-    0xF4, 0xC3, 0xFF, 0x0A, 0x72, 0xFF, 0x0A, 0x6A, 0xFF, 0xCC, 0x8A, 0xFF, 0x10, 0xBC, 0xFF, 0x08, 0x6A, 0xFF, 0xCB, 0x82, 0xFF, 0xCE, 0x8A, 0xFF, 0x6D, 0x82, 0xFF, 0x50, 0x93, 0xFF, 0xD2, 0xB3, 0xFF, 0xBA, 0xF6, 0xFF, 0x11, 0xD4, 0xFF, 0xF1, 0xC3, 0xFF, 0xEC, 0x81, 0xFF, 0xB2, 0x9A, 0xFF, 0xAB, 0x51, 0xFF, 0xE7, 0x38, 0xFF, 0x28, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x08, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xC8, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0x29, 0x41, 0xFF, 0xCC, 0x61, 0xFF, 0xC8, 0x48, 0xFF, 0xEC, 0x61, 0xFF, 0xE9, 0x40, 0xFF, 0xF0, 0x8A, 0xFF, 0x8C, 0x61, 0xFF, 0x4A, 0x59, 0xFF, 0x92, 0xA3, 0xFF, 0x48, 0x51, 0xFF, 0x69, 0x59, 0xFF, 0x6B, 0x59, 0xFF, 0x8D, 0x59, 0xFF, 0x2A, 0x49, 0xFF, 0x0A, 0x49, 0xFF, 0x0C, 0x51, 0xFF, 0x6D, 0x59, 0xFF, 0x0C, 0x49, 0xFF, 0x2D, 0x51, 0xFF, 0x2C, 0x51, 0xFF, 0xEC, 0x48, 0xFF, 0xCA, 0x40, 0xFF, 0xAA, 0x40, 0xFF, 0x0B, 0x49, 0xFF, 0xB2, 0x82, 0xFF, 0xEA, 0x40, 0xFF, 0x2C, 0x49, 0xFF, 0xE9, 0x40, 0xFF, 0xEA, 0x38, 0xFF, 0xEB, 0x40, 0xFF, 0x0B, 0x41, 0xFF, 0xAE, 0x59, 0xFF, 0xCA, 0x40, 0xFF, 0x0A, 0x49, 0xFF, 0xCA, 0x59, 0xFF, 0x69, 0x49, 0xFF, 0x27, 0x41, 0xFF, 0xC6, 0x38, 0xFF,
-    0x47, 0x49, 0xFF, 0x27, 0x49, 0xFF, 0x29, 0x51, 0xFF, 0x2B, 0x49, 0xFF, 0x2F, 0x6A, 0xFF, 0xB0, 0x69, 0xFF, 0xB1, 0x61, 0xFF, 0x70, 0x69, 0xFF, 0x53, 0xAB, 0xFF, 0xED, 0xB2, 0xFF, 0x10, 0xB3, 0xFF, 0x0C, 0x7A, 0xFF, 0xCC, 0x71, 0xFF, 0xC9, 0x61, 0xFF, 0xCC, 0x69, 0xFF, 0x2E, 0x93, 0xFF, 0x4E, 0x9B, 0xFF, 0x09, 0x72, 0xFF, 0x0A, 0x6A, 0xFF, 0x4A, 0x72, 0xFF, 0x2A, 0x72, 0xFF, 0x49, 0x72, 0xFF, 0x6A, 0x7A, 0xFF, 0xC7, 0x61, 0xFF, 0x0C, 0x8B, 0xFF, 0x6F, 0x93, 0xFF, 0x71, 0xA3, 0xFF, 0xB1, 0xAB, 0xFF, 0x91, 0xAB, 0xFF, 0x71, 0xAB, 0xFF, 0x6A, 0x61, 0xFF, 0xAF, 0x92, 0xFF, 0x6A, 0x49, 0xFF, 0x08, 0x39, 0xFF, 0x08, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0xC7, 0x38, 0xFF, 0x08, 0x41, 0xFF, 0x69, 0x51, 0xFF, 0x69, 0x51, 0xFF, 0x07, 0x41, 0xFF, 0xAB, 0x59, 0xFF, 0x28, 0x41, 0xFF, 0xEC, 0x61, 0xFF, 0x49, 0x51, 0xFF, 0xCB, 0x61, 0xFF, 0x0A, 0x51, 0xFF, 0x69, 0x51, 0xFF, 0x2D, 0x72, 0xFF, 0x49, 0x51, 0xFF, 0x2C, 0x72, 0xFF, 0x2B, 0x51, 0xFF, 0x2C, 0x59, 0xFF, 0x2A, 0x59, 0xFF, 0x4B, 0x59, 0xFF, 0x0B, 0x51, 0xFF, 0x2C, 0x51, 0xFF, 0x3F, 0xF5, 0xFF, 0x8D, 0x59, 0xFF, 0x2C, 0x51, 0xFF, 0x4D, 0x51, 0xFF, 0x6D, 0x59, 0xFF, 0x0A, 0x51, 0xFF, 0xED, 0x69, 0xFF,
-    0x0C, 0x51, 0xFF, 0x4D, 0x51, 0xFF, 0xAE, 0x61, 0xFF, 0x2B, 0x49, 0xFF, 0xEF, 0x69, 0xFF, 0xAA, 0x38, 0xFF, 0xEA, 0x40, 0xFF, 0xE8, 0x38, 0xFF, 0x2A, 0x49, 0xFF, 0xAE, 0x61, 0xFF, 0x0C, 0x49, 0xFF, 0x0C, 0x49, 0xFF, 0x6C, 0x51, 0xFF, 0xAA, 0x59, 0xFF, 0x49, 0x49, 0xFF, 0xE8, 0x40, 0xFF, 0x8A, 0x51, 0xFF, 0x26, 0x49, 0xFF, 0x31, 0xA3, 0xFF, 0xAB, 0x69, 0xFF, 0x8D, 0x61, 0xFF, 0xCE, 0x61, 0xFF, 0xAF, 0x61, 0xFF, 0xB5, 0x71, 0xFF, 0xB3, 0x9A, 0xFF, 0x6E, 0x8A, 0xFF, 0x6E, 0x8A, 0xFF, 0xAC, 0x71, 0xFF, 0xDC, 0xF5, 0xFF, 0xDD, 0xF5, 0xFF, 0x30, 0x82, 0xFF, 0x10, 0x9B, 0xFF, 0x70, 0xB3, 0xFF, 0x14, 0xED, 0xFF, 0x8C, 0x92, 0xFF, 0x0F, 0x9B, 0xFF, 0xAA, 0x82, 0xFF, 0xAB, 0x82, 0xFF, 0xD0, 0xB3, 0xFF, 0x86, 0x59, 0xFF, 0xAF, 0x8A, 0xFF, 0xCE, 0x82, 0xFF, 0x4D, 0x7A, 0xFF, 0x38, 0xD5, 0xFF, 0xB1, 0xAB, 0xFF, 0xAF, 0x92, 0xFF, 0xA8, 0x61, 0xFF, 0x4C, 0x82, 0xFF, 0x47, 0x49, 0xFF, 0xAB, 0x61, 0xFF, 0x28, 0x49, 0xFF, 0x0E, 0x72, 0xFF, 0xC6, 0x38, 0xFF, 0x70, 0x82, 0xFF, 0x50, 0x82, 0xFF, 0x69, 0x51, 0xFF, 0xD3, 0x92, 0xFF, 0xF4, 0x79, 0xFF, 0xAA, 0x48, 0xFF, 0xB2, 0x81, 0xFF, 0xF5, 0x9A, 0xFF, 0x4E, 0x61, 0xFF, 0xDA, 0xCB, 0xFF, 0xD9, 0xA2, 0xFF,
-    0x72, 0x71, 0xFF, 0x94, 0x9A, 0xFF, 0xD6, 0x9A, 0xFF, 0x18, 0xC3, 0xFF, 0x92, 0x79, 0xFF, 0xD2, 0x79, 0xFF, 0xB7, 0xA2, 0xFF, 0xB5, 0xA2, 0xFF, 0xB6, 0xCB, 0xFF, 0x6D, 0x71, 0xFF, 0x30, 0x8A, 0xFF, 0x4E, 0x92, 0xFF, 0x51, 0x8A, 0xFF, 0xA9, 0x69, 0xFF, 0x09, 0x51, 0xFF, 0xD7, 0xE4, 0xFF, 0x70, 0xAB, 0xFF, 0x2A, 0x59, 0xFF, 0x6D, 0x59, 0xFF, 0x89, 0x59, 0xFF, 0x30, 0x7A, 0xFF, 0xCB, 0x48, 0xFF, 0xE9, 0x38, 0xFF, 0x68, 0x30, 0xFF, 0x53, 0xA3, 0xFF, 0x4A, 0x59, 0xFF, 0x0B, 0x41, 0xFF, 0x6B, 0x51, 0xFF, 0x2E, 0x72, 0xFF, 0x0B, 0x51, 0xFF, 0x66, 0x49, 0xFF, 0xAF, 0x82, 0xFF, 0xF3, 0x92, 0xFF, 0x12, 0xA3, 0xFF, 0x2B, 0x51, 0xFF, 0x17, 0x9B, 0xFF, 0xD0, 0x81, 0xFF, 0xAF, 0x79, 0xFF, 0x12, 0x82, 0xFF, 0x1A, 0xCC, 0xFF, 0xEF, 0x89, 0xFF, 0x54, 0xBB, 0xFF, 0xB3, 0xA2, 0xFF, 0x5B, 0xDD, 0xFF, 0xFA, 0xA2, 0xFF, 0x9C, 0x82, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xFD, 0xFF, 0x71, 0xB3, 0xFF, 0xDB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xC3, 0xFF, 0x8B, 0x79, 0xFF, 0x75, 0xAB, 0xFF, 0xDF, 0xCE, 0xFF, 0xD4, 0x9A, 0xFF, 0xB3, 0xB3, 0xFF, 0xF3, 0xC3, 0xFF, 0x93, 0xB3, 0xFF, 0x93, 0xB3, 0xFF, 0x11, 0xA3, 0xFF,
-    0x08, 0x41, 0xFF, 0x09, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0x09, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0x0C, 0x62, 0xFF, 0xCC, 0x61, 0xFF, 0x69, 0x51, 0xFF, 0xA9, 0x59, 0xFF, 0x68, 0x49, 0xFF, 0x88, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x48, 0x51, 0xFF, 0x6A, 0x51, 0xFF, 0x6A, 0x59, 0xFF, 0xCC, 0x61, 0xFF, 0x4C, 0x59, 0xFF, 0x4D, 0x59, 0xFF, 0x0B, 0x51, 0xFF, 0x92, 0x8A, 0xFF, 0x2B, 0x51, 0xFF, 0xEF, 0x71, 0xFF, 0xB0, 0x69, 0xFF, 0x6B, 0x59, 0xFF, 0x0C, 0x7A, 0xFF, 0xA9, 0x61, 0xFF, 0xA9, 0x61, 0xFF, 0xC9, 0x61, 0xFF, 0xCA, 0x61, 0xFF, 0x6B, 0x59, 0xFF, 0xEF, 0x69, 0xFF, 0x4A, 0x51, 0xFF, 0x4A, 0x49, 0xFF, 0xAE, 0x61, 0xFF, 0x2C, 0x49, 0xFF, 0xEE, 0x61, 0xFF, 0xCA, 0x38, 0xFF, 0x0A, 0x41, 0xFF, 0x89, 0x30, 0xFF, 0x0B, 0x41, 0xFF, 0x4B, 0x49, 0xFF, 0x0B, 0x41, 0xFF, 0xEA, 0x40, 0xFF, 0x6B, 0x51, 0xFF, 0x8D, 0x51, 0xFF, 0x08, 0x41, 0xFF, 0xC5, 0x30, 0xFF, 0x07, 0x41, 0xFF, 0x69, 0x51, 0xFF, 0x48, 0x49, 0xFF, 0x08, 0x49, 0xFF, 0x6B, 0x51, 0xFF, 0xAF, 0x61, 0xFF, 0x4A, 0x51, 0xFF, 0x91, 0xBC, 0xFF, 0x8B, 0x61, 0xFF, 0xAB, 0x61, 0xFF, 0x8F, 0x8A, 0xFF, 0x6B, 0x59, 0xFF, 0xF2, 0x69, 0xFF, 0x53, 0x59, 0xFF, 0x15, 0x82, 0xFF, 0xEE, 0xA2, 0xFF,
-    0x10, 0xDC, 0xFF, 0x0D, 0xB3, 0xFF, 0x8B, 0x82, 0xFF, 0xCC, 0x8A, 0xFF, 0xAD, 0x8A, 0xFF, 0xED, 0x92, 0xFF, 0xCC, 0x8A, 0xFF, 0xA8, 0x59, 0xFF, 0xF0, 0x82, 0xFF, 0x10, 0x8B, 0xFF, 0x8A, 0x61, 0xFF, 0x71, 0x9B, 0xFF, 0xAE, 0x8A, 0xFF, 0xCE, 0x8A, 0xFF, 0x6D, 0x7A, 0xFF, 0x6C, 0x82, 0xFF, 0x09, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x2A, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x49, 0x49, 0xFF, 0x29, 0x49, 0xFF, 0x29, 0x49, 0xFF, 0x4A, 0x51, 0xFF, 0x2E, 0x72, 0xFF, 0x49, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x6A, 0x59, 0xFF, 0x49, 0x51, 0xFF, 0x4A, 0x51, 0xFF, 0xCB, 0x61, 0xFF, 0x8C, 0x61, 0xFF, 0xCB, 0x69, 0xFF, 0x4C, 0x72, 0xFF, 0x2B, 0x59, 0xFF, 0x10, 0x72, 0xFF, 0x11, 0x7A, 0xFF, 0x6E, 0x61, 0xFF, 0x2E, 0x61, 0xFF, 0x6F, 0x61, 0xFF, 0xAD, 0x61, 0xFF, 0x6C, 0x8A, 0xFF, 0x2B, 0x82, 0xFF, 0x4D, 0x8A, 0xFF, 0x6C, 0x61, 0xFF, 0x8E, 0x61, 0xFF, 0x6D, 0x59, 0xFF, 0x30, 0x72, 0xFF, 0x8E, 0x61, 0xFF, 0x0C, 0x49, 0xFF, 0x4D, 0x51, 0xFF, 0x2C, 0x49, 0xFF, 0x8D, 0x59, 0xFF, 0x0B, 0x49, 0xFF, 0x09, 0x41, 0xFF, 0xA6, 0x28, 0xFF, 0x2A, 0x41, 0xFF, 0x2B, 0x49, 0xFF, 0x2B, 0x41, 0xFF, 0x0B, 0x41, 0xFF, 0x2C, 0x49, 0xFF, 0x2C, 0x49, 0xFF, 0x0A, 0x49, 0xFF, 0xA9, 0x30, 0xFF,
-    0xA6, 0x30, 0xFF, 0x69, 0x49, 0xFF, 0x08, 0x41, 0xFF, 0xC7, 0x38, 0xFF, 0x88, 0x51, 0xFF, 0x88, 0x51, 0xFF, 0x67, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0xA8, 0x59, 0xFF, 0x0A, 0x6A, 0xFF, 0x2A, 0x6A, 0xFF, 0x87, 0x51, 0xFF, 0x69, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x4C, 0x72, 0xFF, 0xCC, 0x8A, 0xFF, 0xAC, 0x8A, 0xFF, 0xC9, 0x61, 0xFF, 0x6C, 0x7A, 0xFF, 0xA9, 0x59, 0xFF, 0x0B, 0x6A, 0xFF, 0x2A, 0x6A, 0xFF, 0x4A, 0x6A, 0xFF, 0xE8, 0x61, 0xFF, 0xAB, 0x7A, 0xFF, 0xEE, 0x82, 0xFF, 0xCA, 0x61, 0xFF, 0x2F, 0x93, 0xFF, 0x4F, 0x9B, 0xFF, 0xED, 0x92, 0xFF, 0xAB, 0x82, 0xFF, 0x6A, 0x7A, 0xFF, 0x09, 0x41, 0xFF, 0x2A, 0x49, 0xFF, 0xCC, 0x61, 0xFF, 0x4A, 0x49, 0xFF, 0x49, 0x49, 0xFF, 0x6A, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0x2A, 0x51, 0xFF, 0xAA, 0x61, 0xFF, 0xEC, 0x69, 0xFF, 0x6B, 0x59, 0xFF, 0x8F, 0x8A, 0xFF, 0x4A, 0x51, 0xFF, 0x8D, 0x61, 0xFF, 0xB2, 0x8A, 0xFF, 0x30, 0x7A, 0xFF, 0xEF, 0x79, 0xFF, 0xD3, 0x92, 0xFF, 0x0F, 0x61, 0xFF, 0xDA, 0xBB, 0xFF, 0x33, 0x8A, 0xFF, 0x6F, 0x61, 0xFF, 0xB7, 0x79, 0xFF, 0xB6, 0x71, 0xFF, 0xD3, 0x81, 0xFF, 0x8F, 0xAA, 0xFF, 0xF3, 0xEC, 0xFF, 0x0F, 0xC3, 0xFF, 0xCA, 0x71, 0xFF, 0x92, 0xAB, 0xFF, 0x8C, 0x61, 0xFF, 0x71, 0xA3, 0xFF,
-    0x0C, 0x72, 0xFF, 0x4C, 0x51, 0xFF, 0x4C, 0x59, 0xFF, 0x2B, 0x49, 0xFF, 0x50, 0x7A, 0xFF, 0x2C, 0x49, 0xFF, 0x09, 0x41, 0xFF, 0xA8, 0x30, 0xFF, 0x0B, 0x41, 0xFF, 0x6D, 0x59, 0xFF, 0xEA, 0x38, 0xFF, 0x4C, 0x49, 0xFF, 0x2C, 0x49, 0xFF, 0x0B, 0x49, 0xFF, 0x4A, 0x49, 0xFF, 0xE7, 0x38, 0xFF, 0x09, 0x41, 0xFF, 0x8A, 0x51, 0xFF, 0xAA, 0x51, 0xFF, 0x28, 0x49, 0xFF, 0x49, 0x51, 0xFF, 0x89, 0x59, 0xFF, 0x67, 0x49, 0xFF, 0x67, 0x51, 0xFF, 0x06, 0x49, 0xFF, 0x88, 0x51, 0xFF, 0x88, 0x59, 0xFF, 0x87, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0x87, 0x51, 0xFF, 0xC8, 0x61, 0xFF, 0x8B, 0x7A, 0xFF, 0x89, 0x59, 0xFF, 0x68, 0x51, 0xFF, 0xEB, 0x61, 0xFF, 0xA9, 0x59, 0xFF, 0xCA, 0x61, 0xFF, 0x2B, 0x6A, 0xFF, 0xE9, 0x61, 0xFF, 0x09, 0x62, 0xFF, 0xAB, 0x7A, 0xFF, 0x0D, 0x83, 0xFF, 0xCD, 0x82, 0xFF, 0x4E, 0x93, 0xFF, 0x0E, 0x93, 0xFF, 0xAB, 0x82, 0xFF, 0xCC, 0x8A, 0xFF, 0xAB, 0x82, 0xFF, 0x68, 0x51, 0xFF, 0x8A, 0x59, 0xFF, 0x69, 0x59, 0xFF, 0xD0, 0x92, 0xFF, 0x8B, 0x61, 0xFF, 0xB1, 0x92, 0xFF, 0x6B, 0x59, 0xFF, 0xA9, 0x48, 0xFF, 0x2D, 0x61, 0xFF, 0x52, 0x92, 0xFF, 0x11, 0x7A, 0xFF, 0xB2, 0x81, 0xFF, 0x34, 0x8A, 0xFF, 0x39, 0xAB, 0xFF, 0xF7, 0xAA, 0xFF, 0x35, 0x92, 0xFF,
-    0xD2, 0x89, 0xFF, 0x1B, 0xB3, 0xFF, 0x37, 0xB3, 0xFF, 0x59, 0xC3, 0xFF, 0x5A, 0xC3, 0xFF, 0x37, 0xB3, 0xFF, 0x9E, 0xA3, 0xFF, 0xBF, 0xFF, 0xFF, 0x36, 0xA2, 0xFF, 0xB5, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFC, 0xFF, 0x3F, 0xFF, 0xFF, 0xD1, 0xBB, 0xFF, 0x2A, 0x82, 0xFF, 0xCF, 0x9A, 0xFF, 0x8C, 0x8A, 0xFF, 0x51, 0x9B, 0xFF, 0xCA, 0x48, 0xFF, 0x46, 0x51, 0xFF, 0xD0, 0x92, 0xFF, 0xD2, 0x8A, 0xFF, 0x09, 0x41, 0xFF, 0x87, 0x28, 0xFF, 0x6C, 0x7A, 0xFF, 0x8B, 0x59, 0xFF, 0x0B, 0x49, 0xFF, 0xCA, 0x61, 0xFF, 0x0A, 0x6A, 0xFF, 0x8E, 0x82, 0xFF, 0x28, 0x49, 0xFF, 0x87, 0x51, 0xFF, 0x91, 0x9B, 0xFF, 0xAE, 0x8A, 0xFF, 0x72, 0xAB, 0xFF, 0x48, 0x51, 0xFF, 0xB0, 0x8A, 0xFF, 0x4B, 0x59, 0xFF, 0xB3, 0x92, 0xFF, 0x96, 0xB3, 0xFF, 0xAD, 0x71, 0xFF, 0x32, 0xA3, 0xFF, 0xD2, 0xA2, 0xFF, 0x51, 0x9B, 0xFF, 0x3D, 0xFE, 0xFF, 0x13, 0xA3, 0xFF, 0x15, 0xA3, 0xFF, 0x6C, 0x71, 0xFF, 0xB0, 0x92, 0xFF, 0xAD, 0x92, 0xFF, 0x8D, 0x92, 0xFF, 0x87, 0x71, 0xFF, 0x3B, 0xFF, 0xFF, 0x86, 0x61, 0xFF, 0x8F, 0xAB, 0xFF, 0xF1, 0xBB, 0xFF, 0xED, 0x92, 0xFF, 0xD1, 0xB3, 0xFF, 0xAE, 0x82, 0xFF, 0x8C, 0x8A, 0xFF, 0xF0, 0x92, 0xFF, 0x30, 0xA3, 0xFF, 0xE9, 0x69, 0xFF, 0x0E, 0x93, 0xFF,
-    0x6D, 0x82, 0xFF, 0x09, 0x51, 0xFF, 0x0B, 0x72, 0xFF, 0xEA, 0x48, 0xFF, 0xB2, 0x92, 0xFF, 0x4C, 0x59, 0xFF, 0x4C, 0x59, 0xFF, 0x6C, 0x61, 0xFF, 0x6D, 0x69, 0xFF, 0xD7, 0xC3, 0xFF, 0x6E, 0x69, 0xFF, 0xF1, 0x79, 0xFF, 0x12, 0x82, 0xFF, 0x0E, 0x82, 0xFF, 0xBB, 0xF5, 0xFF, 0x32, 0x8A, 0xFF, 0x9D, 0xDC, 0xFF, 0x32, 0x82, 0xFF, 0x96, 0xA2, 0xFF, 0xD3, 0x81, 0xFF, 0x9F, 0xFE, 0xFF, 0xB2, 0x81, 0xFF, 0x74, 0x92, 0xFF, 0x12, 0x8A, 0xFF, 0x2F, 0x8A, 0xFF, 0xD2, 0xAA, 0xFF, 0x8E, 0x9A, 0xFF, 0x2B, 0x82, 0xFF, 0xC9, 0x71, 0xFF, 0x6F, 0xA3, 0xFF, 0xAB, 0x69, 0xFF, 0x0A, 0x72, 0xFF, 0xCA, 0x69, 0xFF, 0x48, 0x51, 0xFF, 0x6A, 0x59, 0xFF, 0x46, 0x51, 0xFF, 0x0B, 0x6A, 0xFF, 0x0A, 0x49, 0xFF, 0x08, 0x41, 0xFF, 0x0A, 0x41, 0xFF, 0x69, 0x51, 0xFF, 0x8B, 0x51, 0xFF, 0x2C, 0x49, 0xFF, 0x4B, 0x51, 0xFF, 0x4A, 0x51, 0xFF, 0x26, 0x49, 0xFF, 0x27, 0x49, 0xFF, 0x4B, 0x49, 0xFF, 0xA7, 0x30, 0xFF, 0x89, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0xE6, 0x40, 0xFF, 0x48, 0x49, 0xFF, 0xCA, 0x61, 0xFF, 0x47, 0x49, 0xFF, 0xC9, 0x59, 0xFF, 0x69, 0x59, 0xFF, 0xEB, 0x69, 0xFF, 0x2B, 0x6A, 0xFF, 0x47, 0x49, 0xFF, 0x67, 0x51, 0xFF, 0xCA, 0x69, 0xFF, 0x47, 0x51, 0xFF, 0x47, 0x49, 0xFF,
-    0x67, 0x51, 0xFF, 0x26, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0x67, 0x51, 0xFF, 0x88, 0x51, 0xFF, 0xC9, 0x59, 0xFF, 0x67, 0x51, 0xFF, 0x28, 0x62, 0xFF, 0x49, 0x6A, 0xFF, 0x8A, 0x72, 0xFF, 0xEC, 0x82, 0xFF, 0xAB, 0x82, 0xFF, 0x29, 0x6A, 0xFF, 0x4A, 0x72, 0xFF, 0xCB, 0x82, 0xFF, 0xAA, 0x7A, 0xFF, 0x0B, 0x6A, 0xFF, 0x8A, 0x59, 0xFF, 0xAA, 0x59, 0xFF, 0xCA, 0x61, 0xFF, 0x93, 0xA3, 0xFF, 0x8A, 0x59, 0xFF, 0xAC, 0x61, 0xFF, 0xEE, 0x71, 0xFF, 0xAD, 0x69, 0xFF, 0xCF, 0x79, 0xFF, 0x6D, 0x69, 0xFF, 0x0F, 0x82, 0xFF, 0x16, 0xCC, 0xFF, 0x34, 0xA3, 0xFF, 0x8D, 0x79, 0xFF, 0x12, 0x8A, 0xFF, 0x52, 0x92, 0xFF, 0x13, 0x8A, 0xFF, 0x78, 0xBB, 0xFF, 0xD3, 0x81, 0xFF, 0xB3, 0x79, 0xFF, 0x94, 0xA2, 0xFF, 0xD5, 0xD3, 0xFF, 0xB4, 0xD3, 0xFF, 0xF0, 0xAA, 0xFF, 0x36, 0xCC, 0xFF, 0x6F, 0x92, 0xFF, 0xA8, 0x69, 0xFF, 0xE9, 0x69, 0xFF, 0x6B, 0x82, 0xFF, 0x6C, 0x7A, 0xFF, 0x0B, 0x72, 0xFF, 0xE9, 0x69, 0xFF, 0x8B, 0x61, 0xFF, 0xE7, 0x48, 0xFF, 0x2C, 0x6A, 0xFF, 0x77, 0xC4, 0xFF, 0xE8, 0x48, 0xFF, 0x28, 0x41, 0xFF, 0xE9, 0x40, 0xFF, 0x0B, 0x41, 0xFF, 0xEE, 0x61, 0xFF, 0x0B, 0x41, 0xFF, 0x6D, 0x51, 0xFF, 0x0B, 0x51, 0xFF, 0xEA, 0x40, 0xFF, 0x8B, 0x51, 0xFF, 0xCA, 0x40, 0xFF,
-    0xA6, 0x38, 0xFF, 0x8B, 0x51, 0xFF, 0x2E, 0x72, 0xFF, 0x48, 0x51, 0xFF, 0x08, 0x49, 0xFF, 0x4A, 0x51, 0xFF, 0x49, 0x49, 0xFF, 0x48, 0x49, 0xFF, 0x69, 0x59, 0xFF, 0x8D, 0x72, 0xFF, 0x6D, 0x72, 0xFF, 0x28, 0x49, 0xFF, 0x48, 0x49, 0xFF, 0x48, 0x49, 0xFF, 0x07, 0x49, 0xFF, 0x07, 0x39, 0xFF, 0x89, 0x51, 0xFF, 0x48, 0x49, 0xFF, 0x07, 0x41, 0xFF, 0x68, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0x89, 0x51, 0xFF, 0x68, 0x49, 0xFF, 0xEA, 0x59, 0xFF, 0x4A, 0x6A, 0xFF, 0x8A, 0x6A, 0xFF, 0xCB, 0x7A, 0xFF, 0x8A, 0x7A, 0xFF, 0xAB, 0x7A, 0xFF, 0x8A, 0x7A, 0xFF, 0x8A, 0x7A, 0xFF, 0x69, 0x72, 0xFF, 0xB5, 0x71, 0xFF, 0xB5, 0x61, 0xFF, 0x1D, 0x62, 0xFF, 0x33, 0x9B, 0xFF, 0x54, 0xBB, 0xFF, 0x6E, 0x61, 0xFF, 0xF0, 0x71, 0xFF, 0x36, 0xA3, 0xFF, 0x8F, 0x71, 0xFF, 0x93, 0x9A, 0xFF, 0xD7, 0xC3, 0xFF, 0x14, 0x8A, 0xFF, 0x94, 0xA2, 0xFF, 0x95, 0x9A, 0xFF, 0xD4, 0xAA, 0xFF, 0x74, 0xA2, 0xFF, 0x15, 0xBB, 0xFF, 0xD7, 0xA2, 0xFF, 0x3D, 0xCC, 0xFF, 0xFC, 0x8B, 0xFF, 0x9F, 0xD4, 0xFF, 0xFD, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xE4, 0xFF, 0x71, 0xB3, 0xFF, 0x99, 0xED, 0xFF, 0xB2, 0xC3, 0xFF, 0x0A, 0x7A, 0xFF, 0xAA, 0x71, 0xFF, 0xCF, 0x92, 0xFF, 0x2A, 0x7A, 0xFF,
-    0xA9, 0x69, 0xFF, 0x09, 0x7A, 0xFF, 0xAC, 0x8A, 0xFF, 0x2F, 0xA3, 0xFF, 0xC9, 0x61, 0xFF, 0x48, 0x59, 0xFF, 0x4A, 0x49, 0xFF, 0xEB, 0x40, 0xFF, 0x0D, 0x6A, 0xFF, 0x0C, 0x72, 0xFF, 0x0E, 0x72, 0xFF, 0x6B, 0x51, 0xFF, 0xE7, 0x48, 0xFF, 0x6B, 0x51, 0xFF, 0xCE, 0x82, 0xFF, 0xEC, 0x61, 0xFF, 0x28, 0x49, 0xFF, 0xCA, 0x59, 0xFF, 0x0C, 0x6A, 0xFF, 0x69, 0x51, 0xFF, 0xE7, 0x40, 0xFF, 0x8A, 0x59, 0xFF, 0x4D, 0x6A, 0xFF, 0x07, 0x41, 0xFF, 0xCB, 0x61, 0xFF, 0x8E, 0x7A, 0xFF, 0xCA, 0x59, 0xFF, 0x27, 0x49, 0xFF, 0x28, 0x49, 0xFF, 0xEE, 0x82, 0xFF, 0x07, 0x41, 0xFF, 0x6D, 0x6A, 0xFF, 0x68, 0x49, 0xFF, 0xEA, 0x59, 0xFF, 0x27, 0x41, 0xFF, 0x68, 0x51, 0xFF, 0x89, 0x51, 0xFF, 0xEA, 0x59, 0xFF, 0x89, 0x51, 0xFF, 0xC9, 0x59, 0xFF, 0x6A, 0x6A, 0xFF, 0xAA, 0x72, 0xFF, 0xAA, 0x72, 0xFF, 0x6A, 0x72, 0xFF, 0x8A, 0x7A, 0xFF, 0xAA, 0x7A, 0xFF, 0x49, 0x72, 0xFF, 0x6A, 0x72, 0xFF, 0x31, 0x61, 0xFF, 0xD3, 0x71, 0xFF, 0xCF, 0x69, 0xFF, 0x3A, 0xED, 0xFF, 0xCF, 0x71, 0xFF, 0x90, 0x71, 0xFF, 0x8F, 0x69, 0xFF, 0xF2, 0x81, 0xFF, 0x96, 0x9A, 0xFF, 0x11, 0x8A, 0xFF, 0x95, 0xA2, 0xFF, 0x7B, 0xC3, 0xFF, 0xF9, 0xBA, 0xFF, 0x5A, 0xCB, 0xFF, 0x33, 0xCB, 0xFF, 0x79, 0xF4, 0xFF,
-    0xB8, 0xF4, 0xFF, 0x7F, 0xFD, 0xFF, 0xDB, 0xB2, 0xFF, 0xDD, 0x89, 0xFF, 0xBF, 0xE3, 0xFF, 0x1F, 0xFF, 0xFF, 0x14, 0xFC, 0xFF, 0xB4, 0xFC, 0xFF, 0x54, 0xEC, 0xFF, 0x9F, 0xFF, 0xFF, 0xED, 0x81, 0xFF, 0xED, 0x89, 0xFF, 0x1F, 0xFE, 0xFF, 0xC9, 0x71, 0xFF, 0x9A, 0xFE, 0xFF, 0x47, 0x59, 0xFF, 0xAE, 0xA2, 0xFF, 0x87, 0x59, 0xFF, 0x27, 0x49, 0xFF, 0x6C, 0x7A, 0xFF, 0xD0, 0x92, 0xFF, 0x29, 0x51, 0xFF, 0xC8, 0x38, 0xFF, 0x2A, 0x41, 0xFF, 0xCD, 0x8A, 0xFF, 0xCB, 0x61, 0xFF, 0x4C, 0x51, 0xFF, 0x4A, 0x51, 0xFF, 0xA9, 0x61, 0xFF, 0x09, 0x41, 0xFF, 0xCC, 0x59, 0xFF, 0x28, 0x41, 0xFF, 0x8C, 0x7A, 0xFF, 0x8A, 0x51, 0xFF, 0x0C, 0x6A, 0xFF, 0x2A, 0x6A, 0xFF, 0xEE, 0x8A, 0xFF, 0xCE, 0x8A, 0xFF, 0x26, 0x41, 0xFF, 0x05, 0x41, 0xFF, 0xCC, 0x8A, 0xFF, 0x88, 0x61, 0xFF, 0xA7, 0x51, 0xFF, 0x25, 0x41, 0xFF, 0xA7, 0x59, 0xFF, 0x2B, 0x6A, 0xFF, 0x45, 0x41, 0xFF, 0x46, 0x49, 0xFF, 0x50, 0xA3, 0xFF, 0xEC, 0x8A, 0xFF, 0x46, 0x49, 0xFF, 0x47, 0x51, 0xFF, 0x50, 0x9B, 0xFF, 0xC8, 0x61, 0xFF, 0xED, 0x82, 0xFF, 0xC8, 0x51, 0xFF, 0xC8, 0x59, 0xFF, 0x6A, 0x72, 0xFF, 0x49, 0x6A, 0xFF, 0xEC, 0x82, 0xFF, 0xC7, 0x61, 0xFF, 0xE8, 0x61, 0xFF, 0xAA, 0x7A, 0xFF, 0x8A, 0x7A, 0xFF,
-    0xEE, 0x71, 0xFF, 0xAE, 0x69, 0xFF, 0xCD, 0x69, 0xFF, 0xB3, 0x9A, 0xFF, 0xD5, 0x9A, 0xFF, 0xD6, 0xA2, 0xFF, 0x52, 0x8A, 0xFF, 0x8F, 0x71, 0xFF, 0x9F, 0xFE, 0xFF, 0x70, 0x71, 0xFF, 0x93, 0xA2, 0xFF, 0xD7, 0xCB, 0xFF, 0x38, 0xE4, 0xFF, 0xD6, 0xFC, 0xFF, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xFE, 0xFF, 0xBE, 0xF5, 0xFF, 0x55, 0x9A, 0xFF, 0x34, 0x92, 0xFF, 0x9D, 0xE4, 0xFF, 0xD7, 0xE3, 0xFF, 0xD0, 0xBA, 0xFF, 0xBB, 0xFE, 0xFF, 0x0F, 0x8A, 0xFF, 0x56, 0xBB, 0xFF, 0x0F, 0x8A, 0xFF, 0xAB, 0x69, 0xFF, 0xA8, 0x69, 0xFF, 0x6D, 0x82, 0xFF, 0x13, 0xA3, 0xFF, 0x0A, 0x72, 0xFF, 0xA8, 0x61, 0xFF, 0x07, 0x51, 0xFF, 0xCA, 0x61, 0xFF, 0x52, 0xA3, 0xFF, 0x6A, 0x59, 0xFF, 0xE8, 0x38, 0xFF, 0x0A, 0x41, 0xFF, 0x91, 0xB3, 0xFF, 0x4D, 0x72, 0xFF, 0x6D, 0x59, 0xFF, 0xF3, 0x8A, 0xFF, 0x68, 0x51, 0xFF, 0x4D, 0x7A, 0xFF, 0xEC, 0x61, 0xFF, 0xC9, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0x8B, 0x72, 0xFF, 0xCF, 0x8A, 0xFF, 0xAB, 0x59, 0xFF, 0xE7, 0x40, 0xFF, 0xC8, 0x59, 0xFF, 0xB0, 0x8A, 0xFF, 0x8D, 0x82, 0xFF, 0xC6, 0x40, 0xFF, 0x6C, 0x72, 0xFF, 0x05, 0x41, 0xFF, 0x0E, 0x93, 0xFF, 0xDB, 0xED, 0xFF, 0xC9, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0x04, 0x39, 0xFF,
-    0xAD, 0x8A, 0xFF, 0x4B, 0x7A, 0xFF, 0x27, 0x41, 0xFF, 0x07, 0x49, 0xFF, 0xCE, 0x92, 0xFF, 0x04, 0x41, 0xFF, 0xC8, 0x61, 0xFF, 0x86, 0x51, 0xFF, 0xE8, 0x59, 0xFF, 0x8B, 0x82, 0xFF, 0x6A, 0x72, 0xFF, 0x8A, 0x7A, 0xFF, 0x69, 0x72, 0xFF, 0x49, 0x6A, 0xFF, 0x28, 0x6A, 0xFF, 0xAB, 0x7A, 0xFF, 0x56, 0xAB, 0xFF, 0xD1, 0x79, 0xFF, 0xD0, 0x71, 0xFF, 0x34, 0x8A, 0xFF, 0x7B, 0xDC, 0xFF, 0x16, 0xA3, 0xFF, 0x72, 0x69, 0xFF, 0xB1, 0x71, 0xFF, 0xF8, 0xAA, 0xFF, 0xBE, 0xFD, 0xFF, 0xD4, 0xB2, 0xFF, 0x9B, 0xBB, 0xFF, 0xD4, 0xB2, 0xFF, 0x96, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0xF4, 0xFF, 0xF7, 0xB2, 0xFF, 0xFD, 0xAA, 0xFF, 0x3F, 0xF5, 0xFF, 0x18, 0xBB, 0xFF, 0x93, 0xD3, 0xFF, 0x97, 0xFE, 0xFF, 0xF3, 0xDB, 0xFF, 0x77, 0xBB, 0xFF, 0x70, 0x92, 0xFF, 0x95, 0xAB, 0xFF, 0x6D, 0x61, 0xFF, 0x6E, 0x69, 0xFF, 0x54, 0xAB, 0xFF, 0x6B, 0x61, 0xFF, 0x6D, 0x82, 0xFF, 0xC9, 0x71, 0xFF, 0x87, 0x61, 0xFF, 0xEC, 0x71, 0xFF, 0xEA, 0x69, 0xFF, 0x68, 0x61, 0xFF, 0xE8, 0x38, 0xFF, 0x0B, 0x49, 0xFF, 0x6D, 0x7A, 0xFF, 0xCD, 0x8A, 0xFF, 0xAD, 0x61, 0xFF, 0x4E, 0x72, 0xFF, 0x6A, 0x61, 0xFF, 0xE9, 0x69, 0xFF, 0x54, 0xBC, 0xFF, 0x2B, 0x49, 0xFF,
-    0xA6, 0x38, 0xFF, 0x89, 0x59, 0xFF, 0x4B, 0x6A, 0xFF, 0x31, 0x9B, 0xFF, 0xE7, 0x40, 0xFF, 0xEC, 0x61, 0xFF, 0xE6, 0x38, 0xFF, 0x25, 0x41, 0xFF, 0xEE, 0x8A, 0xFF, 0x8A, 0x51, 0xFF, 0x29, 0x49, 0xFF, 0x89, 0x51, 0xFF, 0xC9, 0x59, 0xFF, 0x8C, 0x82, 0xFF, 0x48, 0x49, 0xFF, 0xAA, 0x51, 0xFF, 0x06, 0x41, 0xFF, 0x88, 0x51, 0xFF, 0x2A, 0x72, 0xFF, 0x89, 0x59, 0xFF, 0x47, 0x41, 0xFF, 0x88, 0x51, 0xFF, 0x06, 0x41, 0xFF, 0x86, 0x51, 0xFF, 0x2D, 0x9B, 0xFF, 0x2A, 0x62, 0xFF, 0x29, 0x62, 0xFF, 0xA8, 0x59, 0xFF, 0xE7, 0x59, 0xFF, 0xAC, 0x82, 0xFF, 0x09, 0x62, 0xFF, 0x49, 0x6A, 0xFF, 0xFF, 0xDF, 0xFF, 0xB3, 0x79, 0xFF, 0x53, 0x82, 0xFF, 0xF3, 0x89, 0xFF, 0x76, 0x92, 0xFF, 0x74, 0xA2, 0xFF, 0xB2, 0x79, 0xFF, 0xB2, 0x79, 0xFF, 0x1A, 0xD4, 0xFF, 0xD2, 0x79, 0xFF, 0x9E, 0xF5, 0xFF, 0x56, 0x9A, 0xFF, 0x58, 0xBB, 0xFF, 0x7C, 0xFD, 0xFF, 0xDD, 0xFE, 0xFF, 0xBC, 0xFD, 0xFF, 0xFC, 0xFC, 0xFF, 0x96, 0xAA, 0xFF, 0x3F, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x9A, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xEC, 0xFF, 0xEE, 0x89, 0xFF, 0xBB, 0xDC, 0xFF, 0xD5, 0xBB, 0xFF, 0xAB, 0x69, 0xFF, 0x3D, 0xFE, 0xFF, 0x94, 0xBB, 0xFF, 0x2A, 0x7A, 0xFF,
-    0x54, 0xC4, 0xFF, 0x68, 0x69, 0xFF, 0xE9, 0x71, 0xFF, 0x66, 0x51, 0xFF, 0x68, 0x61, 0xFF, 0x06, 0x51, 0xFF, 0x0A, 0x41, 0xFF, 0x0B, 0x41, 0xFF, 0x6D, 0x7A, 0xFF, 0x4B, 0x72, 0xFF, 0x4B, 0x51, 0xFF, 0xA9, 0x59, 0xFF, 0x8A, 0x59, 0xFF, 0x4A, 0x51, 0xFF, 0x4C, 0x72, 0xFF, 0x4D, 0x72, 0xFF, 0xC7, 0x38, 0xFF, 0x2B, 0x49, 0xFF, 0xEF, 0x82, 0xFF, 0x4C, 0x72, 0xFF, 0xC8, 0x38, 0xFF, 0x49, 0x49, 0xFF, 0x49, 0x49, 0xFF, 0x8A, 0x59, 0xFF, 0xEB, 0x61, 0xFF, 0xAA, 0x59, 0xFF, 0x8A, 0x51, 0xFF, 0xAA, 0x59, 0xFF, 0x89, 0x51, 0xFF, 0x27, 0x49, 0xFF, 0xAA, 0x59, 0xFF, 0x68, 0x49, 0xFF, 0x06, 0x39, 0xFF, 0xCA, 0x51, 0xFF, 0x4C, 0x6A, 0xFF, 0x68, 0x49, 0xFF, 0x27, 0x41, 0xFF, 0xEA, 0x59, 0xFF, 0x27, 0x41, 0xFF, 0x68, 0x49, 0xFF, 0x88, 0x51, 0xFF, 0xEA, 0x59, 0xFF, 0xE9, 0x59, 0xFF, 0x2A, 0x62, 0xFF, 0x29, 0x62, 0xFF, 0x08, 0x62, 0xFF, 0x49, 0x6A, 0xFF, 0x2A, 0x6A, 0xFF, 0xB2, 0xA2, 0xFF, 0x92, 0x9A, 0xFF, 0x51, 0x8A, 0xFF, 0x33, 0x8A, 0xFF, 0x91, 0x79, 0xFF, 0x58, 0xBB, 0xFF, 0xB6, 0x9A, 0xFF, 0x92, 0x71, 0xFF, 0x35, 0x92, 0xFF, 0xD2, 0x79, 0xFF, 0x39, 0xBB, 0xFF, 0xF5, 0x91, 0xFF, 0x7C, 0xCB, 0xFF, 0x18, 0xBB, 0xFF, 0x95, 0xA2, 0xFF, 0xD6, 0xB2, 0xFF,
-    0x3D, 0xEC, 0xFF, 0xF9, 0xAA, 0xFF, 0x38, 0x8A, 0xFF, 0x9C, 0xBB, 0xFF, 0x7B, 0xCB, 0xFF, 0x13, 0x92, 0xFF, 0x11, 0xB3, 0xFF, 0x93, 0xC3, 0xFF, 0x98, 0xDC, 0xFF, 0xEF, 0x79, 0xFF, 0x8D, 0x71, 0xFF, 0x54, 0xA3, 0xFF, 0x59, 0xEC, 0xFF, 0xEC, 0x89, 0xFF, 0x4D, 0x8A, 0xFF, 0x6C, 0x8A, 0xFF, 0x36, 0xBB, 0xFF, 0x8C, 0x82, 0xFF, 0x71, 0xA3, 0xFF, 0x46, 0x51, 0xFF, 0xD4, 0xC3, 0xFF, 0x67, 0x59, 0xFF, 0x2C, 0x49, 0xFF, 0x2A, 0x49, 0xFF, 0xED, 0x8A, 0xFF, 0x4C, 0x72, 0xFF, 0x2B, 0x49, 0xFF, 0xAB, 0x59, 0xFF, 0x0A, 0x72, 0xFF, 0x49, 0x49, 0xFF, 0xAF, 0x7A, 0xFF, 0x49, 0x49, 0xFF, 0x8C, 0x7A, 0xFF, 0x4E, 0x72, 0xFF, 0x76, 0xBC, 0xFF, 0xCA, 0x59, 0xFF, 0xCD, 0x82, 0xFF, 0xAA, 0x61, 0xFF, 0x28, 0x41, 0xFF, 0x07, 0x41, 0xFF, 0x8B, 0x59, 0xFF, 0xEB, 0x71, 0xFF, 0x07, 0x39, 0xFF, 0xA9, 0x51, 0xFF, 0x28, 0x49, 0xFF, 0xE5, 0x40, 0xFF, 0xC9, 0x59, 0xFF, 0xC9, 0x51, 0xFF, 0x6D, 0x72, 0xFF, 0x48, 0x49, 0xFF, 0x07, 0x39, 0xFF, 0x67, 0x49, 0xFF, 0xAF, 0x7A, 0xFF, 0x27, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x68, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0x0B, 0x62, 0xFF, 0xE9, 0x59, 0xFF, 0x09, 0x62, 0xFF, 0xA7, 0x51, 0xFF, 0x2A, 0x6A, 0xFF, 0xA8, 0x59, 0xFF, 0xA8, 0x51, 0xFF,
-    0x52, 0xCB, 0xFF, 0xB0, 0xDB, 0xFF, 0x0F, 0xBB, 0xFF, 0x73, 0x9A, 0xFF, 0xF1, 0x81, 0xFF, 0x99, 0xCB, 0xFF, 0x38, 0xB3, 0xFF, 0xB1, 0x79, 0xFF, 0xF4, 0x89, 0xFF, 0xF8, 0xAA, 0xFF, 0x5E, 0xE5, 0xFF, 0xB7, 0xA2, 0xFF, 0x36, 0x8A, 0xFF, 0x19, 0xBB, 0xFF, 0xBE, 0xD3, 0xFF, 0xBD, 0xAA, 0xFF, 0x78, 0x79, 0xFF, 0x17, 0x82, 0xFF, 0x9B, 0xCB, 0xFF, 0xB8, 0x9A, 0xFF, 0xFB, 0xA2, 0xFF, 0x15, 0x92, 0xFF, 0x36, 0x9A, 0xFF, 0x1E, 0xFF, 0xFF, 0x99, 0xA2, 0xFF, 0xD1, 0x71, 0xFF, 0x11, 0x82, 0xFF, 0x76, 0xC3, 0xFF, 0xAB, 0x79, 0xFF, 0xAD, 0xAA, 0xFF, 0x91, 0xF4, 0xFF, 0x5E, 0xFE, 0xFF, 0xEE, 0x81, 0xFF, 0x0A, 0x72, 0xFF, 0xF5, 0xB3, 0xFF, 0x67, 0x51, 0xFF, 0x73, 0xB3, 0xFF, 0x67, 0x59, 0xFF, 0x0E, 0x6A, 0xFF, 0x2A, 0x49, 0xFF, 0x4F, 0x9B, 0xFF, 0xD5, 0xE4, 0xFF, 0x4C, 0x51, 0xFF, 0x14, 0xC4, 0xFF, 0x87, 0x59, 0xFF, 0x6E, 0x82, 0xFF, 0x93, 0xA3, 0xFF, 0x8C, 0x61, 0xFF, 0xE6, 0x40, 0xFF, 0xCE, 0x92, 0xFF, 0x51, 0x93, 0xFF, 0x29, 0x49, 0xFF, 0x28, 0x49, 0xFF, 0xCD, 0x82, 0xFF, 0x12, 0x93, 0xFF, 0x89, 0x51, 0xFF, 0xA8, 0x61, 0xFF, 0xE6, 0x40, 0xFF, 0xAF, 0x82, 0xFF, 0x08, 0x41, 0xFF, 0x09, 0x41, 0xFF, 0x28, 0x49, 0xFF, 0x4E, 0x72, 0xFF, 0x26, 0x41, 0xFF,
-    0xE7, 0x30, 0xFF, 0x06, 0x39, 0xFF, 0x06, 0x39, 0xFF, 0x2F, 0x9B, 0xFF, 0xC4, 0x38, 0xFF, 0x27, 0x41, 0xFF, 0x06, 0x39, 0xFF, 0x2C, 0x72, 0xFF, 0x06, 0x41, 0xFF, 0x88, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0x26, 0x41, 0xFF, 0xC9, 0x59, 0xFF, 0x4B, 0x6A, 0xFF, 0x09, 0x62, 0xFF, 0x09, 0x62, 0xFF, 0xD6, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFE, 0xFF, 0x16, 0xDC, 0xFF, 0x52, 0x9A, 0xFF, 0x6F, 0x92, 0xFF, 0xDD, 0xE4, 0xFF, 0xD6, 0xA2, 0xFF, 0xB1, 0x81, 0xFF, 0x13, 0x82, 0xFF, 0xF6, 0xAA, 0xFF, 0xBE, 0xDC, 0xFF, 0xB7, 0xA2, 0xFF, 0x1E, 0xDC, 0xFF, 0xDB, 0x81, 0xFF, 0x9F, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xE5, 0xFF, 0xD6, 0x79, 0xFF, 0x1D, 0xAB, 0xFF, 0x3E, 0xCC, 0xFF, 0x7C, 0xBB, 0xFF, 0x9B, 0x9A, 0xFF, 0x3B, 0xB3, 0xFF, 0x3E, 0xEC, 0xFF, 0xB4, 0x92, 0xFF, 0x1E, 0xAB, 0xFF, 0x7B, 0x8A, 0xFF, 0x0D, 0x8A, 0xFF, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xD3, 0xFF, 0xAD, 0x9A, 0xFF, 0x35, 0xED, 0xFF, 0xF1, 0xB3, 0xFF, 0x2B, 0x7A, 0xFF, 0xB4, 0xB3, 0xFF, 0x69, 0x61, 0xFF, 0xCC, 0x61, 0xFF, 0x4A, 0x51, 0xFF, 0xBF, 0xFE, 0xFF, 0x0F, 0x93, 0xFF, 0x2A, 0x51, 0xFF, 0xAA, 0x61, 0xFF, 0x48, 0x59, 0xFF, 0x0F, 0x93, 0xFF, 0x0B, 0x6A, 0xFF, 0xEB, 0x61, 0xFF,
-    0x07, 0x41, 0xFF, 0x4B, 0x72, 0xFF, 0x0F, 0x93, 0xFF, 0x6A, 0x59, 0xFF, 0xE8, 0x38, 0xFF, 0xA9, 0x59, 0xFF, 0x4A, 0x6A, 0xFF, 0xAF, 0x8A, 0xFF, 0x28, 0x41, 0xFF, 0x69, 0x51, 0xFF, 0xE6, 0x38, 0xFF, 0xEB, 0x69, 0xFF, 0x6D, 0x7A, 0xFF, 0x6A, 0x49, 0xFF, 0xAB, 0x51, 0xFF, 0x47, 0x41, 0xFF, 0x0B, 0x6A, 0xFF, 0x2D, 0x72, 0xFF, 0x06, 0x39, 0xFF, 0x06, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0xAD, 0x7A, 0xFF, 0x68, 0x59, 0xFF, 0x68, 0x49, 0xFF, 0x06, 0x41, 0xFF, 0xA8, 0x51, 0xFF, 0x8B, 0x7A, 0xFF, 0xC5, 0x38, 0xFF, 0xCA, 0x59, 0xFF, 0xC9, 0x59, 0xFF, 0xE9, 0x59, 0xFF, 0xC9, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x34, 0xFC, 0xFF, 0x30, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xDD, 0xFF, 0xF6, 0xAA, 0xFF, 0x1A, 0xD4, 0xFF, 0x13, 0x82, 0xFF, 0x1F, 0xFF, 0xFF, 0x7F, 0xFE, 0xFF, 0x37, 0x92, 0xFF, 0xB7, 0x9A, 0xFF, 0x9C, 0xC3, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9B, 0x69, 0xFF, 0x1F, 0xD4, 0xFF, 0x95, 0x92, 0xFF, 0x5F, 0xD4, 0xFF, 0x5B, 0xD4, 0xFF, 0x9F, 0xE4, 0xFF, 0xD2, 0x79, 0xFF, 0xDB, 0xDC, 0xFF, 0x99, 0xC3, 0xFF, 0xF7, 0x81, 0xFF, 0x70, 0x69, 0xFF, 0x8F, 0x9A, 0xFF, 0xBC, 0xF5, 0xFF, 0xD7, 0xF4, 0xFF, 0xCD, 0x9A, 0xFF,
-    0x8F, 0xB3, 0xFF, 0xE9, 0x79, 0xFF, 0xAD, 0x82, 0xFF, 0x28, 0x51, 0xFF, 0xCF, 0x92, 0xFF, 0xEB, 0x69, 0xFF, 0x9A, 0x59, 0xFF, 0x49, 0x49, 0xFF, 0x6F, 0x8A, 0xFF, 0xA9, 0x61, 0xFF, 0x0A, 0x49, 0xFF, 0x8A, 0x61, 0xFF, 0x8B, 0x61, 0xFF, 0x66, 0x51, 0xFF, 0x6E, 0x82, 0xFF, 0x0C, 0x6A, 0xFF, 0x2D, 0x72, 0xFF, 0x6A, 0x51, 0xFF, 0xCE, 0x7A, 0xFF, 0x91, 0xA3, 0xFF, 0x2C, 0x6A, 0xFF, 0x2A, 0x49, 0xFF, 0x06, 0x39, 0xFF, 0x29, 0x6A, 0xFF, 0xF0, 0x8A, 0xFF, 0x8C, 0x51, 0xFF, 0xE8, 0x38, 0xFF, 0x07, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x2E, 0x93, 0xFF, 0x07, 0x41, 0xFF, 0xEC, 0x59, 0xFF, 0xC7, 0x30, 0xFF, 0x06, 0x39, 0xFF, 0xAC, 0x82, 0xFF, 0x68, 0x51, 0xFF, 0x06, 0x39, 0xFF, 0x27, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x8C, 0x7A, 0xFF, 0x0F, 0x93, 0xFF, 0x27, 0x41, 0xFF, 0xC9, 0x51, 0xFF, 0xA4, 0x30, 0xFF, 0xA7, 0x51, 0xFF, 0x8D, 0x82, 0xFF, 0xA9, 0x51, 0xFF, 0xC9, 0x51, 0xFF, 0xD5, 0xFC, 0xFF, 0x71, 0xD3, 0xFF, 0x91, 0xAA, 0xFF, 0x92, 0xA2, 0xFF, 0xD2, 0xA2, 0xFF, 0x52, 0x92, 0xFF, 0x36, 0xAB, 0xFF, 0x7F, 0xFE, 0xFF, 0x19, 0xB3, 0xFF, 0x15, 0x92, 0xFF, 0xF5, 0x91, 0xFF, 0xB7, 0xAA, 0xFF, 0x5A, 0xBB, 0xFF, 0x39, 0xB3, 0xFF, 0xDB, 0x89, 0xFF, 0x3F, 0xB3, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xB4, 0x71, 0xFF, 0xF3, 0x79, 0xFF, 0xF2, 0x79, 0xFF, 0xDB, 0xCB, 0xFF, 0x8F, 0x71, 0xFF, 0xB1, 0x69, 0xFF, 0x11, 0x7A, 0xFF, 0x53, 0x9A, 0xFF, 0xD1, 0x8A, 0xFF, 0x51, 0x7A, 0xFF, 0x8C, 0x69, 0xFF, 0x77, 0xBB, 0xFF, 0x4F, 0xB3, 0xFF, 0x4B, 0x82, 0xFF, 0x4B, 0x82, 0xFF, 0x6F, 0xBB, 0xFF, 0x0A, 0x6A, 0xFF, 0x6C, 0x7A, 0xFF, 0x88, 0x59, 0xFF, 0x10, 0x9B, 0xFF, 0x6D, 0x82, 0xFF, 0x2A, 0x49, 0xFF, 0x4A, 0x49, 0xFF, 0xE9, 0x69, 0xFF, 0x6D, 0x7A, 0xFF, 0x4B, 0x51, 0xFF, 0xCA, 0x61, 0xFF, 0x0B, 0x6A, 0xFF, 0x89, 0x59, 0xFF, 0xB0, 0x82, 0xFF, 0x49, 0x51, 0xFF, 0x2A, 0x72, 0xFF, 0xAA, 0x59, 0xFF, 0x8E, 0x7A, 0xFF, 0xAA, 0x59, 0xFF, 0x2B, 0x72, 0xFF, 0x28, 0x49, 0xFF, 0xE9, 0x38, 0xFF, 0xEA, 0x59, 0xFF, 0x69, 0x51, 0xFF, 0x08, 0x41, 0xFF, 0x09, 0x39, 0xFF, 0x49, 0x49, 0xFF, 0xCB, 0x59, 0xFF, 0x07, 0x39, 0xFF, 0xEA, 0x40, 0xFF, 0xC6, 0x30, 0xFF, 0xA9, 0x51, 0xFF, 0x09, 0x39, 0xFF, 0xE8, 0x38, 0xFF, 0x06, 0x39, 0xFF, 0x0B, 0x62, 0xFF, 0x47, 0x41, 0xFF, 0x26, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0xA8, 0x49, 0xFF, 0x88, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0xEA, 0x59, 0xFF, 0x89, 0x51, 0xFF, 0xA9, 0x51, 0xFF,
-    0xB4, 0xAA, 0xFF, 0x55, 0x9A, 0xFF, 0x77, 0x9A, 0xFF, 0x54, 0x92, 0xFF, 0x74, 0x9A, 0xFF, 0xD3, 0xB2, 0xFF, 0x5F, 0xFE, 0xFF, 0xDF, 0xFE, 0xFF, 0x94, 0xA2, 0xFF, 0x96, 0xA2, 0xFF, 0x98, 0xAA, 0xFF, 0x39, 0xC3, 0xFF, 0xD7, 0xA2, 0xFF, 0xB6, 0x9A, 0xFF, 0xDE, 0xF5, 0xFF, 0x3F, 0xFE, 0xFF, 0x13, 0x7A, 0xFF, 0xF3, 0x79, 0xFF, 0xB2, 0x71, 0xFF, 0x34, 0x8A, 0xFF, 0xDF, 0xFD, 0xFF, 0x74, 0x8A, 0xFF, 0x90, 0x69, 0xFF, 0x54, 0xBB, 0xFF, 0x4F, 0x8A, 0xFF, 0x8B, 0x61, 0xFF, 0xB1, 0x8A, 0xFF, 0x9E, 0xF5, 0xFF, 0x6F, 0x82, 0xFF, 0xCD, 0x8A, 0xFF, 0x2F, 0x9B, 0xFF, 0x89, 0x69, 0xFF, 0x4D, 0x8A, 0xFF, 0x09, 0x6A, 0xFF, 0x0B, 0x6A, 0xFF, 0x09, 0x6A, 0xFF, 0xF1, 0x92, 0xFF, 0x10, 0x93, 0xFF, 0x4B, 0x51, 0xFF, 0x69, 0x49, 0xFF, 0xAD, 0x8A, 0xFF, 0x73, 0xBC, 0xFF, 0x4B, 0x51, 0xFF, 0x0B, 0x6A, 0xFF, 0x2A, 0x72, 0xFF, 0x8D, 0x7A, 0xFF, 0x4C, 0x72, 0xFF, 0xCB, 0x61, 0xFF, 0x47, 0x51, 0xFF, 0x4F, 0x9B, 0xFF, 0xCE, 0x8A, 0xFF, 0xEC, 0x61, 0xFF, 0x48, 0x49, 0xFF, 0x2C, 0x72, 0xFF, 0x2A, 0x49, 0xFF, 0x6B, 0x51, 0xFF, 0x27, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0x8D, 0x7A, 0xFF, 0xE9, 0x38, 0xFF, 0x8B, 0x51, 0xFF, 0x6C, 0x6A, 0xFF, 0x0C, 0x62, 0xFF, 0xA8, 0x30, 0xFF,
-    0x09, 0x39, 0xFF, 0xE6, 0x30, 0xFF, 0xE6, 0x38, 0xFF, 0xA5, 0x38, 0xFF, 0x28, 0x41, 0xFF, 0x88, 0x49, 0xFF, 0x26, 0x39, 0xFF, 0xAE, 0x7A, 0xFF, 0x47, 0x41, 0xFF, 0x88, 0x49, 0xFF, 0x88, 0x49, 0xFF, 0xC9, 0x51, 0xFF, 0x88, 0x49, 0xFF, 0x88, 0x51, 0xFF, 0xC9, 0x59, 0xFF, 0x88, 0x51, 0xFF, 0xF6, 0x89, 0xFF, 0x97, 0x71, 0xFF, 0x38, 0x8A, 0xFF, 0x5C, 0xC3, 0xFF, 0xF6, 0xBA, 0xFF, 0xD3, 0xDB, 0xFF, 0x5E, 0xFE, 0xFF, 0xD8, 0xFC, 0xFF, 0x7D, 0xEC, 0xFF, 0x14, 0xBB, 0xFF, 0xD5, 0xDB, 0xFF, 0xF5, 0xE3, 0xFF, 0x59, 0xEC, 0xFF, 0x5F, 0xFE, 0xFF, 0x3C, 0xD4, 0xFF, 0x3F, 0xFF, 0xFF, 0x34, 0x82, 0xFF, 0x1A, 0xB3, 0xFF, 0x77, 0x92, 0xFF, 0x74, 0x8A, 0xFF, 0x57, 0xA3, 0xFF, 0x54, 0x8A, 0xFF, 0xB9, 0xA2, 0xFF, 0x12, 0x82, 0xFF, 0xF0, 0x71, 0xFF, 0xAE, 0x69, 0xFF, 0xFB, 0xA2, 0xFF, 0x56, 0xAB, 0xFF, 0xCB, 0x69, 0xFF, 0x4F, 0x8A, 0xFF, 0x0D, 0x7A, 0xFF, 0x54, 0xB3, 0xFF, 0x6B, 0x7A, 0xFF, 0xF2, 0xBB, 0xFF, 0x2B, 0x72, 0xFF, 0x87, 0x59, 0xFF, 0x11, 0x9B, 0xFF, 0x75, 0xCC, 0xFF, 0x6C, 0x51, 0xFF, 0x89, 0x51, 0xFF, 0x8E, 0x82, 0xFF, 0xE9, 0x69, 0xFF, 0xCB, 0x61, 0xFF, 0x0B, 0x72, 0xFF, 0xED, 0x8A, 0xFF, 0x50, 0xA3, 0xFF, 0xB1, 0xAB, 0xFF, 0x0B, 0x6A, 0xFF,
-    0xEA, 0x69, 0xFF, 0xE8, 0x69, 0xFF, 0xF2, 0xB3, 0xFF, 0x0C, 0x6A, 0xFF, 0x68, 0x51, 0xFF, 0x88, 0x51, 0xFF, 0xAE, 0x8A, 0xFF, 0x28, 0x49, 0xFF, 0x6A, 0x51, 0xFF, 0x68, 0x49, 0xFF, 0x47, 0x49, 0xFF, 0x4D, 0x7A, 0xFF, 0x29, 0x41, 0xFF, 0x07, 0x39, 0xFF, 0x68, 0x51, 0xFF, 0x2C, 0x6A, 0xFF, 0x48, 0x49, 0xFF, 0xA6, 0x28, 0xFF, 0xE6, 0x38, 0xFF, 0x06, 0x39, 0xFF, 0x4B, 0x72, 0xFF, 0x47, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x6C, 0x6A, 0xFF, 0x88, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0xA9, 0x51, 0xFF, 0x68, 0x49, 0xFF, 0xCA, 0x59, 0xFF, 0x88, 0x51, 0xFF, 0x5F, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xC5, 0xFF, 0xF8, 0xBA, 0xFF, 0xD6, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF, 0xD5, 0xF4, 0xFF, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFC, 0xFF, 0x97, 0xC3, 0xFF, 0xFA, 0xAA, 0xFF, 0xDC, 0xD4, 0xFF, 0x3E, 0xCC, 0xFF, 0x92, 0x71, 0xFF, 0x13, 0x7A, 0xFF, 0x95, 0x92, 0xFF, 0x31, 0x7A, 0xFF, 0x1A, 0xA3, 0xFF, 0x97, 0x92, 0xFF, 0xB1, 0x69, 0xFF, 0xB3, 0x69, 0xFF, 0xB8, 0xBB, 0xFF, 0x37, 0xAB, 0xFF, 0x4B, 0x59, 0xFF, 0xCD, 0x69, 0xFF, 0x0E, 0x8A, 0xFF, 0x6C, 0x61, 0xFF, 0x53, 0xA3, 0xFF,
-    0xEF, 0x92, 0xFF, 0x67, 0x59, 0xFF, 0x0A, 0x6A, 0xFF, 0x47, 0x51, 0xFF, 0xCC, 0x71, 0xFF, 0x74, 0xCC, 0xFF, 0x6C, 0x51, 0xFF, 0xA9, 0x59, 0xFF, 0xF1, 0x92, 0xFF, 0xA9, 0x61, 0xFF, 0xAA, 0x61, 0xFF, 0x4C, 0x7A, 0xFF, 0x50, 0xA3, 0xFF, 0xF1, 0xBB, 0xFF, 0x6C, 0x82, 0xFF, 0xAA, 0x61, 0xFF, 0x4D, 0x82, 0xFF, 0xEA, 0x69, 0xFF, 0x91, 0xA3, 0xFF, 0x4C, 0x72, 0xFF, 0x68, 0x51, 0xFF, 0x68, 0x51, 0xFF, 0x26, 0x49, 0xFF, 0xCE, 0x8A, 0xFF, 0xE7, 0x40, 0xFF, 0xE8, 0x40, 0xFF, 0x07, 0x41, 0xFF, 0x2B, 0x62, 0xFF, 0x6E, 0x7A, 0xFF, 0x08, 0x41, 0xFF, 0xC7, 0x38, 0xFF, 0xCA, 0x59, 0xFF, 0x06, 0x39, 0xFF, 0x4C, 0x6A, 0xFF, 0x06, 0x39, 0xFF, 0x0B, 0x62, 0xFF, 0x47, 0x41, 0xFF, 0x4B, 0x6A, 0xFF, 0x8D, 0x7A, 0xFF, 0x47, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x41, 0xFF, 0x6C, 0x72, 0xFF, 0x88, 0x49, 0xFF, 0xA9, 0x51, 0xFF, 0x88, 0x49, 0xFF, 0x88, 0x49, 0xFF, 0xA8, 0x51, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xAA, 0xFF, 0xDB, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xFD, 0xFF, 0xB5, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xB6, 0xE3, 0xFF, 0x56, 0x9A, 0xFF, 0xB7, 0xA2, 0xFF, 0x3F, 0xFE, 0xFF,
-    0x9A, 0xB3, 0xFF, 0x90, 0x69, 0xFF, 0xD0, 0x69, 0xFF, 0x75, 0x82, 0xFF, 0x9E, 0xB3, 0xFF, 0xD8, 0x9A, 0xFF, 0x70, 0x61, 0xFF, 0x54, 0x82, 0xFF, 0x53, 0x92, 0xFF, 0x79, 0xAB, 0xFF, 0xCE, 0x71, 0xFF, 0x31, 0x7A, 0xFF, 0xF0, 0x81, 0xFF, 0xED, 0x69, 0xFF, 0x38, 0xC4, 0xFF, 0xA9, 0x61, 0xFF, 0x50, 0xA3, 0xFF, 0x88, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x49, 0x59, 0xFF, 0x51, 0xA3, 0xFF, 0x2A, 0x7A, 0xFF, 0x8B, 0x59, 0xFF, 0xC9, 0x59, 0xFF, 0xED, 0x71, 0xFF, 0x67, 0x61, 0xFF, 0xCA, 0x61, 0xFF, 0x0B, 0x72, 0xFF, 0x12, 0xC4, 0xFF, 0x0A, 0x7A, 0xFF, 0xAD, 0xA2, 0xFF, 0xEB, 0x69, 0xFF, 0x88, 0x61, 0xFF, 0x89, 0x61, 0xFF, 0xB0, 0xA3, 0xFF, 0x73, 0xC4, 0xFF, 0x47, 0x51, 0xFF, 0x68, 0x51, 0xFF, 0x48, 0x49, 0xFF, 0xC5, 0x40, 0xFF, 0x51, 0x93, 0xFF, 0xE7, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x27, 0x41, 0xFF, 0x0B, 0x62, 0xFF, 0xEF, 0x8A, 0xFF, 0x11, 0x83, 0xFF, 0x29, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0xA4, 0x28, 0xFF, 0xEF, 0x8A, 0xFF, 0x05, 0x39, 0xFF, 0x0E, 0x83, 0xFF, 0x06, 0x39, 0xFF, 0x26, 0x41, 0xFF, 0xAD, 0x82, 0xFF, 0x4B, 0x6A, 0xFF, 0x88, 0x49, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0x6B, 0x72, 0xFF, 0xEE, 0x82, 0xFF, 0x88, 0x51, 0xFF, 0x88, 0x49, 0xFF,
-    0x1F, 0x8A, 0xFF, 0x9C, 0x9A, 0xFF, 0xB9, 0xAA, 0xFF, 0x1E, 0xF4, 0xFF, 0x98, 0xF5, 0xFF, 0x77, 0xFC, 0xFF, 0x33, 0xC3, 0xFF, 0x1D, 0xE4, 0xFF, 0x55, 0xD3, 0xFF, 0xBA, 0xFE, 0xFF, 0xDA, 0xFE, 0xFF, 0xBC, 0xFC, 0xFF, 0x97, 0xA2, 0xFF, 0xD5, 0x81, 0xFF, 0x37, 0x8A, 0xFF, 0x55, 0x8A, 0xFF, 0xF3, 0x79, 0xFF, 0xB0, 0x69, 0xFF, 0x8F, 0x61, 0xFF, 0x54, 0x82, 0xFF, 0x50, 0x61, 0xFF, 0xB1, 0x69, 0xFF, 0x51, 0x7A, 0xFF, 0xB2, 0x71, 0xFF, 0xB3, 0x71, 0xFF, 0x2E, 0x59, 0xFF, 0x52, 0x82, 0xFF, 0xF1, 0x79, 0xFF, 0xF1, 0x92, 0xFF, 0xCD, 0x69, 0xFF, 0x6E, 0x82, 0xFF, 0xAA, 0x61, 0xFF, 0x31, 0xA3, 0xFF, 0x0E, 0x93, 0xFF, 0x2B, 0x72, 0xFF, 0x46, 0x51, 0xFF, 0x32, 0xAB, 0xFF, 0x91, 0xAB, 0xFF, 0x8A, 0x59, 0xFF, 0xCA, 0x61, 0xFF, 0x8C, 0x82, 0xFF, 0x8C, 0x82, 0xFF, 0xCA, 0x69, 0xFF, 0x4D, 0x82, 0xFF, 0x9B, 0xFE, 0xFF, 0x2B, 0x8A, 0xFF, 0x0D, 0xA3, 0xFF, 0x8D, 0x8A, 0xFF, 0xE9, 0x69, 0xFF, 0x4C, 0x7A, 0xFF, 0x6D, 0x82, 0xFF, 0x6D, 0x82, 0xFF, 0x68, 0x51, 0xFF, 0xCA, 0x61, 0xFF, 0xCA, 0x61, 0xFF, 0x07, 0x49, 0xFF, 0x4A, 0x72, 0xFF, 0xAA, 0x59, 0xFF, 0x08, 0x41, 0xFF, 0x09, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0xE6, 0x40, 0xFF, 0xA4, 0x40, 0xFF, 0x09, 0x41, 0xFF,
-    0x08, 0x41, 0xFF, 0xC5, 0x30, 0xFF, 0xC5, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0x4A, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0x07, 0x39, 0xFF, 0x26, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x68, 0x49, 0xFF, 0x27, 0x41, 0xFF, 0x88, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0xA8, 0x51, 0xFF, 0x98, 0x79, 0xFF, 0x97, 0x71, 0xFF, 0x57, 0x92, 0xFF, 0xFF, 0xC3, 0xFF, 0xB8, 0xAA, 0xFF, 0x5B, 0xC3, 0xFF, 0xB8, 0xA2, 0xFF, 0x78, 0x9A, 0xFF, 0x98, 0xAA, 0xFF, 0xD9, 0xBA, 0xFF, 0x3A, 0xCB, 0xFF, 0xD9, 0xAA, 0xFF, 0x15, 0x8A, 0xFF, 0x75, 0x92, 0xFF, 0xF8, 0xB2, 0xFF, 0x79, 0x8A, 0xFF, 0xB1, 0x69, 0xFF, 0xB0, 0x61, 0xFF, 0x54, 0x8A, 0xFF, 0x99, 0x8A, 0xFF, 0x4F, 0x59, 0xFF, 0x8F, 0x61, 0xFF, 0x34, 0x82, 0xFF, 0x6F, 0x69, 0xFF, 0x90, 0x61, 0xFF, 0x8D, 0x61, 0xFF, 0x8D, 0x61, 0xFF, 0xEE, 0x79, 0xFF, 0xEA, 0x69, 0xFF, 0x70, 0x8A, 0xFF, 0xCA, 0x69, 0xFF, 0xF2, 0xAB, 0xFF, 0x0A, 0x72, 0xFF, 0x70, 0xA3, 0xFF, 0x0A, 0x72, 0xFF, 0xA8, 0x61, 0xFF, 0x73, 0xA3, 0xFF, 0x73, 0xCC, 0xFF, 0xAB, 0x61, 0xFF, 0xEB, 0x69, 0xFF, 0xCE, 0x8A, 0xFF, 0xEA, 0x71, 0xFF, 0xEB, 0x71, 0xFF, 0x4D, 0x8A, 0xFF, 0xFB, 0xFE, 0xFF, 0xF2, 0xD3, 0xFF, 0x0E, 0xB3, 0xFF, 0x2A, 0x82, 0xFF,
-    0x09, 0x72, 0xFF, 0x2A, 0x7A, 0xFF, 0xEE, 0x8A, 0xFF, 0x4C, 0x7A, 0xFF, 0xA9, 0x59, 0xFF, 0x2A, 0x6A, 0xFF, 0xF0, 0x8A, 0xFF, 0x07, 0x49, 0xFF, 0x06, 0x49, 0xFF, 0xE5, 0x38, 0xFF, 0x6D, 0x72, 0xFF, 0x48, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0xC7, 0x30, 0xFF, 0x68, 0x49, 0xFF, 0x69, 0x49, 0xFF, 0x8A, 0x49, 0xFF, 0xE6, 0x38, 0xFF, 0x6C, 0x6A, 0xFF, 0xEA, 0x61, 0xFF, 0x8A, 0x51, 0xFF, 0x29, 0x41, 0xFF, 0x26, 0x41, 0xFF, 0x6C, 0x6A, 0xFF, 0x88, 0x49, 0xFF, 0x27, 0x41, 0xFF, 0x88, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x88, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x88, 0x51, 0xFF, 0x87, 0x49, 0xFF, 0x94, 0x69, 0xFF, 0xB6, 0x79, 0xFF, 0xF5, 0x79, 0xFF, 0x5D, 0x92, 0xFF, 0x16, 0x82, 0xFF, 0x98, 0x81, 0xFF, 0xBC, 0x81, 0xFF, 0xBD, 0x81, 0xFF, 0x9F, 0xC3, 0xFF, 0x19, 0x8A, 0xFF, 0x7F, 0x9A, 0xFF, 0x3E, 0x71, 0xFF, 0x9A, 0x69, 0xFF, 0x3B, 0xAB, 0xFF, 0xF4, 0x79, 0xFF, 0xB2, 0x69, 0xFF, 0xB0, 0x61, 0xFF, 0x33, 0x82, 0xFF, 0x70, 0x61, 0xFF, 0x76, 0x82, 0xFF, 0x50, 0x59, 0xFF, 0x77, 0x92, 0xFF, 0x78, 0xB3, 0xFF, 0x8E, 0x61, 0xFF, 0xF1, 0x69, 0xFF, 0x55, 0xB3, 0xFF, 0xAD, 0x69, 0xFF, 0x8F, 0x82, 0xFF, 0xEB, 0x69, 0xFF, 0x90, 0x8A, 0xFF, 0xCB, 0x69, 0xFF, 0x8C, 0x71, 0xFF,
-    0x4C, 0x7A, 0xFF, 0x09, 0x6A, 0xFF, 0xC8, 0x61, 0xFF, 0xA9, 0x61, 0xFF, 0xEB, 0x71, 0xFF, 0xED, 0x92, 0xFF, 0xCB, 0x61, 0xFF, 0x2D, 0x72, 0xFF, 0x4D, 0x82, 0xFF, 0x0A, 0x72, 0xFF, 0x2C, 0x82, 0xFF, 0x8E, 0x9A, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xF6, 0xFF, 0x74, 0xF5, 0xFF, 0x0D, 0xAB, 0xFF, 0x6C, 0x8A, 0xFF, 0x0A, 0x7A, 0xFF, 0x6E, 0x82, 0xFF, 0xEB, 0x69, 0xFF, 0x89, 0x61, 0xFF, 0x2C, 0x72, 0xFF, 0x47, 0x51, 0xFF, 0x28, 0x49, 0xFF, 0xAA, 0x59, 0xFF, 0xE6, 0x38, 0xFF, 0xE6, 0x38, 0xFF, 0xCF, 0x82, 0xFF, 0x08, 0x41, 0xFF, 0xC9, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x48, 0x51, 0xFF, 0xA6, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x28, 0x39, 0xFF, 0x88, 0x49, 0xFF, 0x47, 0x49, 0xFF, 0xE9, 0x59, 0xFF, 0x28, 0x41, 0xFF, 0x27, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x26, 0x41, 0xFF, 0x88, 0x49, 0xFF, 0x87, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x26, 0x41, 0xFF, 0x88, 0x49, 0xFF, 0x93, 0x69, 0xFF, 0xDF, 0x9A, 0xFF, 0x3F, 0xB3, 0xFF, 0xD9, 0x81, 0xFF, 0x5C, 0x69, 0xFF, 0xBF, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x6B, 0xFF, 0x1B, 0x69, 0xFF, 0x5D, 0x69, 0xFF, 0xFE, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x50, 0xFF, 0xD7, 0x79, 0xFF, 0x52, 0x61, 0xFF, 0xB2, 0x69, 0xFF,
-    0x9D, 0xB3, 0xFF, 0x70, 0x59, 0xFF, 0x4F, 0x51, 0xFF, 0x90, 0x61, 0xFF, 0xD3, 0x71, 0xFF, 0x59, 0xB3, 0xFF, 0x32, 0x7A, 0xFF, 0x6E, 0x61, 0xFF, 0x8D, 0x69, 0xFF, 0x8D, 0x61, 0xFF, 0xF7, 0xBB, 0xFF, 0xEB, 0x69, 0xFF, 0xAE, 0x79, 0xFF, 0x2B, 0x7A, 0xFF, 0x70, 0x82, 0xFF, 0x4E, 0x82, 0xFF, 0x4E, 0x82, 0xFF, 0x09, 0x6A, 0xFF, 0x09, 0x6A, 0xFF, 0xAB, 0x61, 0xFF, 0xED, 0x71, 0xFF, 0xCD, 0x8A, 0xFF, 0xCB, 0x69, 0xFF, 0x0B, 0x6A, 0xFF, 0xCC, 0x71, 0xFF, 0x4A, 0x7A, 0xFF, 0x4D, 0x82, 0xFF, 0xCC, 0xA2, 0xFF, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x6F, 0xCB, 0xFF, 0x4D, 0x8A, 0xFF, 0x4B, 0x7A, 0xFF, 0x16, 0xBC, 0xFF, 0x0B, 0x72, 0xFF, 0x68, 0x59, 0xFF, 0x89, 0x59, 0xFF, 0x27, 0x49, 0xFF, 0x50, 0x9B, 0xFF, 0xAB, 0x59, 0xFF, 0xC7, 0x40, 0xFF, 0xE7, 0x38, 0xFF, 0x27, 0x41, 0xFF, 0x8F, 0x7A, 0xFF, 0xC7, 0x30, 0xFF, 0xCF, 0x7A, 0xFF, 0xC8, 0x38, 0xFF, 0xA9, 0x51, 0xFF, 0x4D, 0x72, 0xFF, 0xE8, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xE5, 0x38, 0xFF, 0x88, 0x51, 0xFF, 0x07, 0x39, 0xFF, 0x28, 0x41, 0xFF, 0x67, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x4B, 0x6A, 0xFF, 0x67, 0x41, 0xFF, 0x87, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0xA8, 0x51, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xDB, 0x92, 0xFF, 0x77, 0x69, 0xFF, 0x5A, 0x69, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDD, 0xFF, 0xFD, 0x89, 0xFF, 0x1D, 0x8A, 0xFF, 0x9D, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xDE, 0xFF, 0xBB, 0x71, 0xFF, 0x17, 0x7A, 0xFF, 0x51, 0x61, 0xFF, 0x9E, 0xB3, 0xFF, 0x90, 0x69, 0xFF, 0x4F, 0x51, 0xFF, 0x2F, 0x51, 0xFF, 0xD4, 0x8A, 0xFF, 0xFC, 0xBB, 0xFF, 0x0F, 0x51, 0xFF, 0x90, 0x69, 0xFF, 0x6D, 0x51, 0xFF, 0x34, 0xA3, 0xFF, 0xDB, 0xDC, 0xFF, 0x8C, 0x61, 0xFF, 0x0B, 0x72, 0xFF, 0x11, 0xA3, 0xFF, 0x8E, 0x8A, 0xFF, 0x3E, 0xFE, 0xFF, 0x2C, 0x82, 0xFF, 0x54, 0xBB, 0xFF, 0xCD, 0x92, 0xFF, 0x4B, 0x7A, 0xFF, 0x8B, 0x71, 0xFF, 0x13, 0xAB, 0xFF, 0x4F, 0xA3, 0xFF, 0xCB, 0x69, 0xFF, 0x0B, 0x6A, 0xFF, 0x2F, 0x82, 0xFF, 0x2D, 0x82, 0xFF, 0x2B, 0x82, 0xFF, 0xCD, 0xA2, 0xFF, 0x38, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xDB, 0xFF, 0x0C, 0x82, 0xFF, 0x2B, 0x82, 0xFF, 0x31, 0x9B, 0xFF, 0x1B, 0xE5, 0xFF, 0x66, 0x51, 0xFF, 0xE9, 0x61, 0xFF, 0x28, 0x49, 0xFF, 0x27, 0x49, 0xFF, 0x72, 0x9B, 0xFF, 0xCE, 0x82, 0xFF, 0x08, 0x41, 0xFF, 0x09, 0x39, 0xFF, 0x06, 0x39, 0xFF, 0x8D, 0x7A, 0xFF, 0x0E, 0x62, 0xFF, 0x09, 0x41, 0xFF,
-    0x66, 0x28, 0xFF, 0xC9, 0x59, 0xFF, 0xCF, 0x82, 0xFF, 0xE7, 0x38, 0xFF, 0x28, 0x41, 0xFF, 0x06, 0x39, 0xFF, 0x05, 0x39, 0xFF, 0xEE, 0x8A, 0xFF, 0x48, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x8C, 0x7A, 0xFF, 0xA8, 0x51, 0xFF, 0x87, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x73, 0x61, 0xFF, 0x94, 0x61, 0xFF, 0x54, 0x59, 0xFF, 0x59, 0x61, 0xFF, 0x3E, 0x38, 0xFF, 0x5F, 0x61, 0xFF, 0x58, 0x61, 0xFF, 0x57, 0x61, 0xFF, 0xBF, 0xB3, 0xFF, 0x1E, 0x40, 0xFF, 0x7F, 0x7A, 0xFF, 0x7C, 0x61, 0xFF, 0x35, 0x59, 0xFF, 0x93, 0x61, 0xFF, 0xF8, 0x9A, 0xFF, 0x70, 0x61, 0xFF, 0x70, 0x59, 0xFF, 0xB0, 0x59, 0xFF, 0x2E, 0x51, 0xFF, 0xF4, 0x79, 0xFF, 0x91, 0x59, 0xFF, 0x70, 0x61, 0xFF, 0x6D, 0x61, 0xFF, 0xD6, 0xA2, 0xFF, 0xEC, 0x69, 0xFF, 0xEB, 0x71, 0xFF, 0xCA, 0x61, 0xFF, 0x55, 0xB3, 0xFF, 0xAD, 0x92, 0xFF, 0x4F, 0x8A, 0xFF, 0x4C, 0x82, 0xFF, 0xCE, 0x9A, 0xFF, 0x4E, 0x92, 0xFF, 0x4A, 0x7A, 0xFF, 0x6C, 0x7A, 0xFF, 0x0C, 0x72, 0xFF, 0x95, 0xBB, 0xFF, 0xB1, 0x9A, 0xFF, 0xEB, 0x69, 0xFF, 0x2A, 0x72, 0xFF, 0x4F, 0x8A, 0xFF, 0x0E, 0x82, 0xFF, 0x2B, 0x7A, 0xFF, 0x6D, 0x92, 0xFF, 0x78, 0xE4, 0xFF, 0x58, 0xFD, 0xFF, 0x57, 0xF5, 0xFF, 0x0F, 0xBB, 0xFF,
-    0x4F, 0x8A, 0xFF, 0x33, 0xAB, 0xFF, 0x90, 0xAB, 0xFF, 0x0D, 0x72, 0xFF, 0x67, 0x51, 0xFF, 0x89, 0x59, 0xFF, 0x47, 0x49, 0xFF, 0x68, 0x59, 0xFF, 0x28, 0x49, 0xFF, 0xA7, 0x38, 0xFF, 0x6D, 0x72, 0xFF, 0x48, 0x49, 0xFF, 0xC8, 0x30, 0xFF, 0xA5, 0x28, 0xFF, 0x6A, 0x51, 0xFF, 0x8B, 0x49, 0xFF, 0x87, 0x28, 0xFF, 0xA7, 0x30, 0xFF, 0x68, 0x51, 0xFF, 0xA6, 0x30, 0xFF, 0x29, 0x41, 0xFF, 0xE8, 0x30, 0xFF, 0xA9, 0x51, 0xFF, 0x06, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x88, 0x49, 0xFF, 0x67, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x51, 0x51, 0xFF, 0x52, 0x59, 0xFF, 0x32, 0x51, 0xFF, 0x97, 0x71, 0xFF, 0xD9, 0x71, 0xFF, 0xB7, 0x69, 0xFF, 0x55, 0x59, 0xFF, 0x55, 0x59, 0xFF, 0x1A, 0x82, 0xFF, 0xF5, 0x58, 0xFF, 0x98, 0x61, 0xFF, 0x14, 0x51, 0xFF, 0x57, 0x82, 0xFF, 0x19, 0xA3, 0xFF, 0xDC, 0xD4, 0xFF, 0x2F, 0x51, 0xFF, 0xB0, 0x61, 0xFF, 0xD1, 0x61, 0xFF, 0xF3, 0x69, 0xFF, 0x0E, 0x51, 0xFF, 0xF2, 0x69, 0xFF, 0x30, 0x59, 0xFF, 0xB6, 0x9A, 0xFF, 0x8E, 0x61, 0xFF, 0xCA, 0x61, 0xFF, 0x0E, 0x93, 0xFF, 0xED, 0x71, 0xFF, 0x95, 0xB3, 0xFF, 0xEF, 0x9A, 0xFF, 0xAD, 0x92, 0xFF, 0x8F, 0xC3, 0xFF, 0xD9, 0xFD, 0xFF,
-    0xCB, 0xA2, 0xFF, 0x6C, 0x8A, 0xFF, 0x6C, 0x82, 0xFF, 0x0C, 0x7A, 0xFF, 0xD7, 0xC3, 0xFF, 0xB4, 0xBB, 0xFF, 0x2B, 0x72, 0xFF, 0x4B, 0x7A, 0xFF, 0x33, 0xA3, 0xFF, 0xCD, 0x79, 0xFF, 0x2E, 0x82, 0xFF, 0x2F, 0x8A, 0xFF, 0xDF, 0xEC, 0xFF, 0xBC, 0xD3, 0xFF, 0xF6, 0xA2, 0xFF, 0x30, 0x8A, 0xFF, 0x91, 0x8A, 0xFF, 0xAE, 0x71, 0xFF, 0x2F, 0x82, 0xFF, 0xED, 0x61, 0xFF, 0x0C, 0x72, 0xFF, 0x67, 0x51, 0xFF, 0xB0, 0x8A, 0xFF, 0x07, 0x41, 0xFF, 0xC6, 0x40, 0xFF, 0x4B, 0x51, 0xFF, 0x07, 0x39, 0xFF, 0x4D, 0x72, 0xFF, 0x6B, 0x51, 0xFF, 0xA8, 0x30, 0xFF, 0xCD, 0x61, 0xFF, 0xEB, 0x61, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0xC5, 0x38, 0xFF, 0x0B, 0x6A, 0xFF, 0xE8, 0x30, 0xFF, 0x09, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0xA8, 0x59, 0xFF, 0x28, 0x41, 0xFF, 0x48, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x46, 0x41, 0xFF, 0xE5, 0x30, 0xFF, 0xA8, 0x51, 0xFF, 0x67, 0x49, 0xFF, 0x30, 0x51, 0xFF, 0x31, 0x51, 0xFF, 0x32, 0x59, 0xFF, 0x74, 0x59, 0xFF, 0x54, 0x59, 0xFF, 0x53, 0x59, 0xFF, 0x32, 0x51, 0xFF, 0x95, 0x61, 0xFF, 0x18, 0x7A, 0xFF, 0x99, 0x82, 0xFF, 0x33, 0x59, 0xFF, 0x32, 0x51, 0xFF, 0x32, 0x51, 0xFF, 0x13, 0x6A, 0xFF, 0xBD, 0xE5, 0xFF, 0x2E, 0x51, 0xFF,
-    0xD0, 0x69, 0xFF, 0x6E, 0x51, 0xFF, 0x4D, 0x49, 0xFF, 0x2F, 0x51, 0xFF, 0x71, 0x59, 0xFF, 0xD3, 0x69, 0xFF, 0xEE, 0x50, 0xFF, 0xD0, 0x69, 0xFF, 0xA9, 0x61, 0xFF, 0x70, 0x82, 0xFF, 0xFF, 0xD4, 0xFF, 0x8C, 0x8A, 0xFF, 0xB6, 0xC3, 0xFF, 0x31, 0xBB, 0xFF, 0x79, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xCE, 0x9A, 0xFF, 0x6B, 0x82, 0xFF, 0x4E, 0x82, 0xFF, 0x16, 0xC4, 0xFF, 0x35, 0xC4, 0xFF, 0x4B, 0x7A, 0xFF, 0x4E, 0x7A, 0xFF, 0x2F, 0x82, 0xFF, 0x10, 0x82, 0xFF, 0xF1, 0x79, 0xFF, 0x10, 0x7A, 0xFF, 0x3F, 0xCC, 0xFF, 0x3E, 0xD7, 0xFF, 0x5D, 0xAB, 0xFF, 0x56, 0x8A, 0xFF, 0xAE, 0x71, 0xFF, 0x90, 0x69, 0xFF, 0x78, 0xAB, 0xFF, 0xED, 0x71, 0xFF, 0x2D, 0x51, 0xFF, 0x47, 0x49, 0xFF, 0xC9, 0x61, 0xFF, 0x8E, 0x82, 0xFF, 0xEB, 0x61, 0xFF, 0xE6, 0x40, 0xFF, 0x07, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0x07, 0x49, 0xFF, 0x2A, 0x49, 0xFF, 0x12, 0x93, 0xFF, 0x07, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x4A, 0x49, 0xFF, 0x08, 0x39, 0xFF, 0xC8, 0x38, 0xFF, 0x47, 0x41, 0xFF, 0x6B, 0x72, 0xFF, 0xCA, 0x59, 0xFF, 0x29, 0x41, 0xFF, 0x49, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x8C, 0x7A, 0xFF, 0x48, 0x49, 0xFF, 0x47, 0x41, 0xFF, 0x46, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0x87, 0x49, 0xFF,
-    0x2F, 0x49, 0xFF, 0xB4, 0x69, 0xFF, 0xD6, 0x69, 0xFF, 0x72, 0x59, 0xFF, 0x11, 0x49, 0xFF, 0x31, 0x51, 0xFF, 0x96, 0x61, 0xFF, 0x36, 0x7A, 0xFF, 0x52, 0x59, 0xFF, 0x79, 0x82, 0xFF, 0x31, 0x51, 0xFF, 0xBC, 0x92, 0xFF, 0x10, 0x51, 0xFF, 0x50, 0x59, 0xFF, 0xB9, 0xA3, 0xFF, 0xD1, 0x69, 0xFF, 0xD9, 0x92, 0xFF, 0x4D, 0x49, 0xFF, 0x2D, 0x49, 0xFF, 0xEE, 0x50, 0xFF, 0xB0, 0x61, 0xFF, 0x31, 0x59, 0xFF, 0xD3, 0x69, 0xFF, 0xB0, 0x69, 0xFF, 0xD3, 0x9A, 0xFF, 0x36, 0xBC, 0xFF, 0x51, 0x8A, 0xFF, 0x8E, 0x8A, 0xFF, 0x3B, 0xD4, 0xFF, 0xD2, 0xDB, 0xFF, 0xF8, 0xFE, 0xFF, 0xFD, 0xFF, 0xFF, 0xF4, 0xFC, 0xFF, 0x30, 0xAB, 0xFF, 0x8C, 0x8A, 0xFF, 0x6E, 0x8A, 0xFF, 0x54, 0xB3, 0xFF, 0x9E, 0xF6, 0xFF, 0x6C, 0x82, 0xFF, 0x70, 0x82, 0xFF, 0xB1, 0x92, 0xFF, 0x30, 0x82, 0xFF, 0x31, 0x82, 0xFF, 0x52, 0x82, 0xFF, 0x9F, 0xF5, 0xFF, 0x5E, 0x8C, 0xFF, 0x5B, 0x59, 0xFF, 0xB6, 0x71, 0xFF, 0xAF, 0x69, 0xFF, 0x90, 0x69, 0xFF, 0xF2, 0x71, 0xFF, 0xCB, 0x69, 0xFF, 0x4A, 0x51, 0xFF, 0x28, 0x49, 0xFF, 0x48, 0x49, 0xFF, 0x68, 0x59, 0xFF, 0xE7, 0x38, 0xFF, 0x4D, 0x72, 0xFF, 0x4A, 0x49, 0xFF, 0x07, 0x39, 0xFF, 0xC6, 0x38, 0xFF, 0xCB, 0x59, 0xFF, 0x0E, 0x62, 0xFF, 0x09, 0x41, 0xFF,
-    0xC6, 0x30, 0xFF, 0x2B, 0x6A, 0xFF, 0xC8, 0x30, 0xFF, 0x6A, 0x49, 0xFF, 0xC8, 0x38, 0xFF, 0xC9, 0x59, 0xFF, 0x26, 0x39, 0xFF, 0x28, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0x47, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0x87, 0x49, 0xFF, 0x87, 0x49, 0xFF, 0xA8, 0x51, 0xFF, 0xDC, 0x9A, 0xFF, 0xD3, 0x61, 0xFF, 0x2F, 0x49, 0xFF, 0x2F, 0x49, 0xFF, 0x35, 0x72, 0xFF, 0xFE, 0x9A, 0xFF, 0x32, 0x59, 0xFF, 0x30, 0x51, 0xFF, 0x72, 0x59, 0xFF, 0x52, 0x51, 0xFF, 0x3D, 0x8A, 0xFF, 0x38, 0x7A, 0xFF, 0xD1, 0x61, 0xFF, 0x0E, 0x49, 0xFF, 0x13, 0x72, 0xFF, 0xDC, 0x92, 0xFF, 0x6E, 0x59, 0xFF, 0xF0, 0x61, 0xFF, 0x11, 0x6A, 0xFF, 0x95, 0x8A, 0xFF, 0xFE, 0xBB, 0xFF, 0x33, 0x7A, 0xFF, 0x2E, 0x51, 0xFF, 0x76, 0x92, 0xFF, 0x8C, 0x61, 0xFF, 0xFF, 0xFD, 0xFF, 0xB2, 0x92, 0xFF, 0xF3, 0xA2, 0xFF, 0xB7, 0xBB, 0xFF, 0x16, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xE4, 0xFF, 0x52, 0xAB, 0xFF, 0xAF, 0x92, 0xFF, 0xAF, 0x9A, 0xFF, 0x32, 0xAB, 0xFF, 0xD9, 0xE4, 0xFF, 0x8F, 0x8A, 0xFF, 0x70, 0x8A, 0xFF, 0x36, 0xAB, 0xFF, 0x5C, 0xED, 0xFF, 0x51, 0x82, 0xFF, 0x31, 0x7A, 0xFF, 0xFF, 0xFE, 0xFF, 0x5E, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x71, 0xFF,
-    0x32, 0x7A, 0xFF, 0x72, 0x82, 0xFF, 0xD1, 0x69, 0xFF, 0x5C, 0xCC, 0xFF, 0x89, 0x59, 0xFF, 0xEC, 0x69, 0xFF, 0x48, 0x49, 0xFF, 0x2D, 0x6A, 0xFF, 0x72, 0x9B, 0xFF, 0xC6, 0x38, 0xFF, 0x0C, 0x62, 0xFF, 0x6B, 0x49, 0xFF, 0xE7, 0x38, 0xFF, 0xCE, 0x82, 0xFF, 0x69, 0x51, 0xFF, 0x8B, 0x51, 0xFF, 0xA7, 0x30, 0xFF, 0x06, 0x39, 0xFF, 0xEF, 0x8A, 0xFF, 0x49, 0x49, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0x0C, 0x83, 0xFF, 0xAF, 0xA3, 0xFF, 0x48, 0x41, 0xFF, 0x49, 0x41, 0xFF, 0x48, 0x41, 0xFF, 0x87, 0x51, 0xFF, 0x2E, 0x93, 0xFF, 0x67, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0xA7, 0x51, 0xFF, 0xCD, 0x40, 0xFF, 0x0E, 0x49, 0xFF, 0x0E, 0x41, 0xFF, 0xCD, 0x40, 0xFF, 0x55, 0x72, 0xFF, 0x0E, 0x49, 0xFF, 0x2E, 0x49, 0xFF, 0x2F, 0x49, 0xFF, 0x4F, 0x51, 0xFF, 0x11, 0x51, 0xFF, 0x2F, 0x49, 0xFF, 0x2E, 0x49, 0xFF, 0xB0, 0x59, 0xFF, 0x73, 0x7A, 0xFF, 0xD4, 0x69, 0xFF, 0x0D, 0x49, 0xFF, 0x6D, 0x51, 0xFF, 0x2D, 0x49, 0xFF, 0x4D, 0x51, 0xFF, 0x2F, 0x51, 0xFF, 0x2E, 0x51, 0xFF, 0x4F, 0x59, 0xFF, 0xD1, 0x61, 0xFF, 0x70, 0x61, 0xFF, 0xEC, 0x69, 0xFF, 0x3E, 0xA3, 0xFF, 0x30, 0x7A, 0xFF, 0xB2, 0x92, 0xFF, 0x75, 0xB3, 0xFF, 0xD3, 0xD3, 0xFF, 0xDC, 0xFF, 0xFF, 0x37, 0xFE, 0xFF,
-    0x33, 0xB3, 0xFF, 0xB1, 0x9A, 0xFF, 0xD1, 0xA2, 0xFF, 0xF1, 0xA2, 0xFF, 0x37, 0xDC, 0xFF, 0xB6, 0xC3, 0xFF, 0xB1, 0x92, 0xFF, 0xB1, 0x9A, 0xFF, 0xD2, 0xA2, 0xFF, 0xF2, 0xAA, 0xFF, 0x70, 0x92, 0xFF, 0x51, 0x8A, 0xFF, 0x1F, 0xF6, 0xFF, 0x1E, 0xA3, 0xFF, 0xFA, 0x58, 0xFF, 0x93, 0x69, 0xFF, 0x52, 0x82, 0xFF, 0x10, 0x72, 0xFF, 0xEE, 0x69, 0xFF, 0xCD, 0x61, 0xFF, 0x4B, 0x72, 0xFF, 0x0A, 0x62, 0xFF, 0xAE, 0x82, 0xFF, 0x88, 0x51, 0xFF, 0x88, 0x59, 0xFF, 0xC7, 0x38, 0xFF, 0x27, 0x41, 0xFF, 0x06, 0x39, 0xFF, 0x4A, 0x49, 0xFF, 0xC6, 0x30, 0xFF, 0x0C, 0x62, 0xFF, 0x6A, 0x51, 0xFF, 0x87, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE5, 0x30, 0xFF, 0x69, 0x49, 0xFF, 0x86, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0x05, 0x41, 0xFF, 0x6B, 0x72, 0xFF, 0xE7, 0x38, 0xFF, 0x49, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0x87, 0x49, 0xFF, 0xA7, 0x49, 0xFF, 0x2B, 0x41, 0xFF, 0x4E, 0x49, 0xFF, 0xED, 0x40, 0xFF, 0x4F, 0x49, 0xFF, 0x0F, 0x51, 0xFF, 0x2E, 0x49, 0xFF, 0x2E, 0x49, 0xFF, 0x2E, 0x49, 0xFF, 0x35, 0x7A, 0xFF, 0xEE, 0x40, 0xFF, 0x2E, 0x49, 0xFF, 0x0D, 0x41, 0xFF, 0x6E, 0x51, 0xFF, 0x33, 0x7A, 0xFF, 0x71, 0x51, 0xFF, 0x4D, 0x49, 0xFF,
-    0x6E, 0x51, 0xFF, 0x2D, 0x49, 0xFF, 0x2D, 0x49, 0xFF, 0x2D, 0x49, 0xFF, 0x2D, 0x51, 0xFF, 0x6E, 0x51, 0xFF, 0x58, 0xAB, 0xFF, 0x91, 0x61, 0xFF, 0x90, 0x61, 0xFF, 0x19, 0x9B, 0xFF, 0xD0, 0x69, 0xFF, 0x97, 0x92, 0xFF, 0xD5, 0x9A, 0xFF, 0xD4, 0xA2, 0xFF, 0xD8, 0xAA, 0xFF, 0xBA, 0xAA, 0xFF, 0xF7, 0xA2, 0xFF, 0xB2, 0x9A, 0xFF, 0x31, 0xB3, 0xFF, 0x33, 0xF4, 0xFF, 0xF4, 0xF4, 0xFF, 0x96, 0xCB, 0xFF, 0xF2, 0xA2, 0xFF, 0x12, 0xAB, 0xFF, 0x32, 0xE4, 0xFF, 0x33, 0xE4, 0xFF, 0xD1, 0xAA, 0xFF, 0xB2, 0x92, 0xFF, 0xDF, 0xED, 0xFF, 0x3A, 0xAB, 0xFF, 0xB4, 0x69, 0xFF, 0xCF, 0x69, 0xFF, 0xAF, 0x69, 0xFF, 0xAD, 0x61, 0xFF, 0x2F, 0x72, 0xFF, 0x8A, 0x59, 0xFF, 0x68, 0x51, 0xFF, 0x67, 0x49, 0xFF, 0x69, 0x51, 0xFF, 0xAA, 0x59, 0xFF, 0xE7, 0x40, 0xFF, 0xA9, 0x38, 0xFF, 0xE7, 0x38, 0xFF, 0xAE, 0x7A, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x6C, 0x51, 0xFF, 0x47, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x09, 0x39, 0xFF, 0x08, 0x39, 0xFF, 0x49, 0x49, 0xFF, 0x68, 0x51, 0xFF, 0xE7, 0x38, 0xFF, 0x08, 0x39, 0xFF, 0x28, 0x41, 0xFF, 0x46, 0x41, 0xFF, 0x05, 0x41, 0xFF, 0x67, 0x49, 0xFF, 0x88, 0x49, 0xFF, 0x88, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0xA7, 0x51, 0xFF, 0x87, 0x49, 0xFF,
-    0x0A, 0x41, 0xFF, 0xAF, 0x59, 0xFF, 0xD6, 0x8A, 0xFF, 0x4E, 0x51, 0xFF, 0xEC, 0x40, 0xFF, 0x2C, 0x41, 0xFF, 0x0D, 0x41, 0xFF, 0x5B, 0xBC, 0xFF, 0x90, 0x59, 0xFF, 0x0D, 0x41, 0xFF, 0x4E, 0x51, 0xFF, 0xEE, 0x48, 0xFF, 0x55, 0x82, 0xFF, 0xD3, 0x7A, 0xFF, 0x6D, 0x51, 0xFF, 0x4D, 0x49, 0xFF, 0x90, 0x59, 0xFF, 0x10, 0x6A, 0xFF, 0x4B, 0x49, 0xFF, 0x4E, 0x51, 0xFF, 0xB1, 0x61, 0xFF, 0x77, 0x82, 0xFF, 0x50, 0x59, 0xFF, 0x91, 0x59, 0xFF, 0x94, 0x8A, 0xFF, 0x18, 0x9B, 0xFF, 0x5D, 0xAB, 0xFF, 0xF3, 0x79, 0xFF, 0x97, 0x92, 0xFF, 0x55, 0x8A, 0xFF, 0x1F, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xB3, 0xFF, 0x93, 0x9A, 0xFF, 0x93, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0xEC, 0xFF, 0x12, 0xAB, 0xFF, 0xB2, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFF, 0xFF, 0x30, 0xB3, 0xFF, 0x71, 0x8A, 0xFF, 0xD8, 0xB3, 0xFF, 0xFC, 0xC3, 0xFF, 0x70, 0x61, 0xFF, 0xCF, 0x69, 0xFF, 0xAE, 0x61, 0xFF, 0xEF, 0x71, 0xFF, 0xF6, 0x92, 0xFF, 0x6B, 0x59, 0xFF, 0x49, 0x49, 0xFF, 0x68, 0x49, 0xFF, 0x89, 0x51, 0xFF, 0x4F, 0x72, 0xFF, 0x28, 0x41, 0xFF, 0xAB, 0x59, 0xFF, 0xE9, 0x38, 0xFF, 0xE7, 0x38, 0xFF, 0xEB, 0x59, 0xFF, 0xAB, 0x59, 0xFF, 0xCD, 0x59, 0xFF, 0x8E, 0x7A, 0xFF,
-    0x0E, 0x83, 0xFF, 0x89, 0x59, 0xFF, 0xC7, 0x30, 0xFF, 0x49, 0x41, 0xFF, 0xE6, 0x38, 0xFF, 0x0D, 0x8B, 0xFF, 0xE6, 0x38, 0xFF, 0x08, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0x65, 0x49, 0xFF, 0xCF, 0xA3, 0xFF, 0xA8, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0x09, 0x39, 0xFF, 0x2D, 0x49, 0xFF, 0xEC, 0x38, 0xFF, 0x4B, 0x41, 0xFF, 0x0A, 0x41, 0xFF, 0x0C, 0x41, 0xFF, 0x94, 0x7A, 0xFF, 0x0D, 0x49, 0xFF, 0xEB, 0x40, 0xFF, 0x0D, 0x41, 0xFF, 0x2E, 0x49, 0xFF, 0x0D, 0x41, 0xFF, 0x4C, 0x49, 0xFF, 0x8B, 0x51, 0xFF, 0x4D, 0x51, 0xFF, 0x2D, 0x49, 0xFF, 0x2D, 0x49, 0xFF, 0x4B, 0x49, 0xFF, 0x4B, 0x49, 0xFF, 0xB0, 0x61, 0xFF, 0x8F, 0x59, 0xFF, 0x2F, 0x51, 0xFF, 0x4E, 0x51, 0xFF, 0xB2, 0x69, 0xFF, 0x51, 0x59, 0xFF, 0x5E, 0x82, 0xFF, 0xD0, 0x69, 0xFF, 0xD2, 0x71, 0xFF, 0x36, 0x8A, 0xFF, 0x37, 0x7A, 0xFF, 0x3F, 0x69, 0xFF, 0xBF, 0x69, 0xFF, 0xFD, 0xA2, 0xFF, 0xD4, 0xA2, 0xFF, 0x14, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xF4, 0xFF, 0x33, 0xB3, 0xFF, 0xF3, 0xDB, 0xFF, 0x1A, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0xD1, 0xDB, 0xFF, 0xB1, 0x92, 0xFF, 0x9A, 0xB3, 0xFF, 0x73, 0x8A, 0xFF, 0x12, 0x7A, 0xFF, 0xF0, 0x71, 0xFF,
-    0xCF, 0x69, 0xFF, 0xB5, 0x92, 0xFF, 0x71, 0x7A, 0xFF, 0x8B, 0x59, 0xFF, 0x68, 0x49, 0xFF, 0x2B, 0x6A, 0xFF, 0x48, 0x49, 0xFF, 0x0A, 0x62, 0xFF, 0xE9, 0x38, 0xFF, 0xC9, 0x38, 0xFF, 0xED, 0x59, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x0D, 0x6A, 0xFF, 0x0C, 0x62, 0xFF, 0x49, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0xEB, 0x61, 0xFF, 0x0C, 0x62, 0xFF, 0xE7, 0x38, 0xFF, 0xE6, 0x38, 0xFF, 0x26, 0x41, 0xFF, 0xEA, 0x61, 0xFF, 0x47, 0x41, 0xFF, 0xE8, 0x61, 0xFF, 0xA7, 0x51, 0xFF, 0xA7, 0x59, 0xFF, 0xE8, 0x59, 0xFF, 0xA7, 0x51, 0xFF, 0xC7, 0x51, 0xFF, 0xE8, 0x59, 0xFF, 0x3A, 0x9B, 0xFF, 0x6B, 0x49, 0xFF, 0x09, 0x39, 0xFF, 0x4A, 0x41, 0xFF, 0x0C, 0x41, 0xFF, 0x99, 0xBC, 0xFF, 0x6A, 0x30, 0xFF, 0x4A, 0x49, 0xFF, 0x2A, 0x41, 0xFF, 0xEC, 0x40, 0xFF, 0xFA, 0x92, 0xFF, 0x2C, 0x41, 0xFF, 0xAC, 0x59, 0xFF, 0x4A, 0x49, 0xFF, 0x52, 0x7A, 0xFF, 0xD7, 0x92, 0xFF, 0xEB, 0x40, 0xFF, 0x4A, 0x49, 0xFF, 0x2C, 0x49, 0xFF, 0x6F, 0x59, 0xFF, 0xD9, 0x92, 0xFF, 0x2E, 0x51, 0xFF, 0x4F, 0x51, 0xFF, 0x55, 0x82, 0xFF, 0x6F, 0x59, 0xFF, 0x5B, 0xA3, 0xFF, 0x6F, 0x61, 0xFF, 0xD2, 0x71, 0xFF, 0xD3, 0x71, 0xFF, 0xD8, 0x71, 0xFF, 0x7F, 0xC7, 0xFF, 0x5E, 0x7C, 0xFF,
-    0xF8, 0x79, 0xFF, 0x95, 0x9A, 0xFF, 0x94, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xDB, 0xFF, 0x13, 0xAB, 0xFF, 0xB4, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xE4, 0xFF, 0xB2, 0x92, 0xFF, 0x5D, 0xAB, 0xFF, 0x11, 0x7A, 0xFF, 0xFD, 0xC3, 0xFF, 0xCF, 0x69, 0xFF, 0xAD, 0x61, 0xFF, 0x4E, 0x59, 0xFF, 0xCE, 0x61, 0xFF, 0x57, 0x9B, 0xFF, 0x47, 0x49, 0xFF, 0x27, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0x2A, 0x5A, 0xFF, 0xD0, 0x82, 0xFF, 0x07, 0x39, 0xFF, 0xE8, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0x6E, 0x72, 0xFF, 0x29, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0x05, 0x31, 0xFF, 0x4F, 0x93, 0xFF, 0x91, 0x9B, 0xFF, 0xE7, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0x04, 0x39, 0xFF, 0xD1, 0xCC, 0xFF, 0x26, 0x49, 0xFF, 0x09, 0x62, 0xFF, 0xC7, 0x51, 0xFF, 0x86, 0x59, 0xFF, 0x52, 0xF5, 0xFF, 0xC7, 0x59, 0xFF, 0xE8, 0x59, 0xFF, 0xE8, 0x59, 0xFF, 0x08, 0x39, 0xFF, 0x29, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x09, 0x39, 0xFF, 0x13, 0x72, 0xFF, 0xAF, 0x59, 0xFF, 0x49, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0xCB, 0x38, 0xFF, 0x12, 0x6A, 0xFF, 0xEC, 0x40, 0xFF, 0x2A, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x32, 0x72, 0xFF, 0xCD, 0x59, 0xFF, 0x0C, 0x41, 0xFF,
-    0x4A, 0x49, 0xFF, 0x2C, 0x49, 0xFF, 0x53, 0x7A, 0xFF, 0x6D, 0x51, 0xFF, 0x6F, 0x51, 0xFF, 0x2F, 0x51, 0xFF, 0x36, 0x7A, 0xFF, 0x71, 0x59, 0xFF, 0x8E, 0x59, 0xFF, 0xF1, 0x69, 0xFF, 0x91, 0x61, 0xFF, 0xD7, 0x92, 0xFF, 0xD3, 0x71, 0xFF, 0x96, 0x69, 0xFF, 0xFE, 0x58, 0xFF, 0x1F, 0x82, 0xFF, 0xD7, 0x71, 0xFF, 0x54, 0x8A, 0xFF, 0x35, 0xBB, 0xFF, 0xBB, 0xFD, 0xFF, 0xDD, 0xFD, 0xFF, 0x39, 0xBB, 0xFF, 0xD4, 0xA2, 0xFF, 0x75, 0xBB, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xEC, 0xFF, 0x71, 0x8A, 0xFF, 0xFE, 0xA2, 0xFF, 0xF6, 0x9A, 0xFF, 0xF2, 0x71, 0xFF, 0xAE, 0x61, 0xFF, 0xCE, 0x61, 0xFF, 0x4E, 0x59, 0xFF, 0xAD, 0x59, 0xFF, 0x4A, 0x51, 0xFF, 0x48, 0x49, 0xFF, 0x47, 0x41, 0xFF, 0x4C, 0x72, 0xFF, 0x69, 0x49, 0xFF, 0x07, 0x39, 0xFF, 0xC9, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xAD, 0x59, 0xFF, 0xC9, 0x30, 0xFF, 0xE6, 0x30, 0xFF, 0x4A, 0x41, 0xFF, 0x89, 0x51, 0xFF, 0x09, 0x41, 0xFF, 0xE8, 0x38, 0xFF, 0x07, 0x39, 0xFF, 0x4C, 0x8B, 0xFF, 0xAC, 0x72, 0xFF, 0xE7, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0x25, 0x41, 0xFF, 0x8A, 0x82, 0xFF, 0xCA, 0x8A, 0xFF, 0x69, 0x7A, 0xFF, 0xE7, 0x69, 0xFF, 0xC7, 0x61, 0xFF, 0xE7, 0x59, 0xFF, 0x29, 0x6A, 0xFF, 0x28, 0x6A, 0xFF,
-    0xE8, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x09, 0x39, 0xFF, 0x09, 0x39, 0xFF, 0x08, 0x39, 0xFF, 0xCB, 0x51, 0xFF, 0x08, 0x39, 0xFF, 0x0B, 0x41, 0xFF, 0x0A, 0x41, 0xFF, 0x4A, 0x41, 0xFF, 0x28, 0x39, 0xFF, 0x6A, 0x49, 0xFF, 0x2A, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x4A, 0x49, 0xFF, 0x2B, 0x49, 0xFF, 0x4B, 0x49, 0xFF, 0x8D, 0x51, 0xFF, 0x6E, 0x51, 0xFF, 0x4F, 0x49, 0xFF, 0x30, 0x51, 0xFF, 0x2F, 0x51, 0xFF, 0x50, 0x51, 0xFF, 0xB3, 0x69, 0xFF, 0x92, 0x61, 0xFF, 0xB1, 0x61, 0xFF, 0xD2, 0x71, 0xFF, 0xB3, 0x69, 0xFF, 0xD5, 0x71, 0xFF, 0xB5, 0x69, 0xFF, 0xD5, 0x71, 0xFF, 0x75, 0x8A, 0xFF, 0x76, 0x92, 0xFF, 0x7B, 0xA2, 0xFF, 0x1F, 0x92, 0xFF, 0x7B, 0x92, 0xFF, 0x95, 0x92, 0xFF, 0xB8, 0xA2, 0xFF, 0x3F, 0xC3, 0xFF, 0x5B, 0xBB, 0xFF, 0x75, 0x9A, 0xFF, 0x32, 0x7A, 0xFF, 0x78, 0x8A, 0xFF, 0xD0, 0x69, 0xFF, 0x8E, 0x59, 0xFF, 0x4E, 0x51, 0xFF, 0x8D, 0x59, 0xFF, 0x6D, 0x51, 0xFF, 0xCC, 0x59, 0xFF, 0x48, 0x49, 0xFF, 0x47, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0xAB, 0x51, 0xFF, 0xCA, 0x38, 0xFF, 0xCA, 0x30, 0xFF, 0xE9, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xE9, 0x38, 0xFF, 0xE9, 0x30, 0xFF,
-    0x29, 0x41, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0x08, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x26, 0x41, 0xFF, 0x27, 0x41, 0xFF, 0x47, 0x41, 0xFF, 0xE7, 0x69, 0xFF, 0x8B, 0xBB, 0xFF, 0xD6, 0xF6, 0xFF, 0x0D, 0xCC, 0xFF, 0xE9, 0x92, 0xFF, 0x69, 0x7A, 0xFF, 0xA9, 0x82, 0xFF, 0xAA, 0x8A, 0xFF, 0xE8, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0x33, 0x7A, 0xFF, 0xC7, 0x30, 0xFF, 0x08, 0x39, 0xFF, 0x29, 0x39, 0xFF, 0x09, 0x39, 0xFF, 0xDB, 0xD4, 0xFF, 0x29, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x49, 0x41, 0xFF, 0x0A, 0x39, 0xFF, 0x93, 0x82, 0xFF, 0x29, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x0C, 0x41, 0xFF, 0x2C, 0x49, 0xFF, 0x6A, 0x49, 0xFF, 0x8C, 0x51, 0xFF, 0x4D, 0x49, 0xFF, 0x97, 0x82, 0xFF, 0x71, 0x51, 0xFF, 0x50, 0x51, 0xFF, 0x50, 0x51, 0xFF, 0x71, 0x59, 0xFF, 0xD9, 0x92, 0xFF, 0xB2, 0x61, 0xFF, 0xD3, 0x69, 0xFF, 0xD2, 0x69, 0xFF, 0xF4, 0x79, 0xFF, 0xDF, 0xBB, 0xFF, 0xF5, 0x79, 0xFF, 0xB5, 0x79, 0xFF, 0x36, 0x82, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x82, 0xFF, 0x18, 0x82, 0xFF, 0x38, 0x7A, 0xFF, 0xBE, 0x85, 0xFF, 0x3E, 0x61, 0xFF, 0xD6, 0x79, 0xFF, 0x12, 0x72, 0xFF, 0x56, 0x82, 0xFF, 0x18, 0x93, 0xFF, 0x10, 0x6A, 0xFF, 0x6E, 0x51, 0xFF,
-    0x6D, 0x51, 0xFF, 0x6C, 0x51, 0xFF, 0x76, 0xA3, 0xFF, 0x48, 0x41, 0xFF, 0x47, 0x49, 0xFF, 0x29, 0x41, 0xFF, 0x27, 0x39, 0xFF, 0x6D, 0x72, 0xFF, 0xEA, 0x38, 0xFF, 0xCA, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xD1, 0x7A, 0xFF, 0xC8, 0x30, 0xFF, 0x0A, 0x39, 0xFF, 0xC8, 0x30, 0xFF, 0x27, 0x41, 0xFF, 0x08, 0x41, 0xFF, 0xE7, 0x30, 0xFF, 0x08, 0x41, 0xFF, 0x28, 0x39, 0xFF, 0x2F, 0xAC, 0xFF, 0xA8, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0x49, 0x7A, 0xFF, 0x8E, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xFE, 0xFF, 0x8B, 0xBB, 0xFF, 0x2A, 0xA3, 0xFF, 0xE9, 0x8A, 0xFF, 0xEC, 0xBB, 0xFF, 0xA7, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0x4A, 0x41, 0xFF, 0xC7, 0x30, 0xFF, 0x28, 0x39, 0xFF, 0x08, 0x39, 0xFF, 0x6A, 0x49, 0xFF, 0x09, 0x39, 0xFF, 0x28, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x48, 0x41, 0xFF, 0x29, 0x41, 0xFF, 0x2B, 0x41, 0xFF, 0x4A, 0x41, 0xFF, 0x2A, 0x41, 0xFF, 0x4D, 0x49, 0xFF, 0x4C, 0x49, 0xFF, 0x2F, 0x51, 0xFF, 0x2E, 0x49, 0xFF, 0x70, 0x51, 0xFF, 0x70, 0x59, 0xFF, 0x92, 0x61, 0xFF, 0x72, 0x59, 0xFF, 0x92, 0x61, 0xFF, 0xB3, 0x69, 0xFF, 0xB3, 0x69, 0xFF, 0x13, 0x72, 0xFF, 0xF4, 0x71, 0xFF,
-    0xF4, 0x71, 0xFF, 0xF6, 0x79, 0xFF, 0xF7, 0x79, 0xFF, 0x3E, 0x61, 0xFF, 0xBF, 0x48, 0xFF, 0xFC, 0x79, 0xFF, 0x16, 0x7A, 0xFF, 0xF8, 0x71, 0xFF, 0x5E, 0x59, 0xFF, 0x1F, 0x59, 0xFF, 0xB6, 0x69, 0xFF, 0xD2, 0x69, 0xFF, 0xD5, 0x69, 0xFF, 0xAF, 0x59, 0xFF, 0x11, 0x6A, 0xFF, 0x6D, 0x51, 0xFF, 0x6D, 0x51, 0xFF, 0x4B, 0x49, 0xFF, 0x4A, 0x49, 0xFF, 0x47, 0x41, 0xFF, 0x28, 0x41, 0xFF, 0x09, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x49, 0x41, 0xFF, 0xC9, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0x08, 0x39, 0xFF, 0xE7, 0x38, 0xFF, 0x89, 0x49, 0xFF, 0x67, 0x49, 0xFF, 0xC7, 0x59, 0xFF, 0x0A, 0xA3, 0xFF, 0xFC, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x6D, 0xE4, 0xFF, 0xEA, 0x92, 0xFF, 0x88, 0x82, 0xFF, 0xD7, 0x8A, 0xFF, 0xEC, 0x59, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x96, 0x82, 0xFF, 0xE9, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0x08, 0x39, 0xFF, 0xE8, 0x38, 0xFF, 0xF6, 0x92, 0xFF, 0x08, 0x41, 0xFF, 0x08, 0x39, 0xFF, 0x28, 0x39, 0xFF, 0x29, 0x41, 0xFF, 0x38, 0x9B, 0xFF,
-    0x0B, 0x41, 0xFF, 0x2A, 0x41, 0xFF, 0x4A, 0x49, 0xFF, 0x51, 0x6A, 0xFF, 0x38, 0x9B, 0xFF, 0xEE, 0x48, 0xFF, 0x2E, 0x49, 0xFF, 0x50, 0x51, 0xFF, 0x71, 0x59, 0xFF, 0xB1, 0x61, 0xFF, 0xF4, 0x71, 0xFF, 0x91, 0x61, 0xFF, 0xB4, 0x69, 0xFF, 0xD4, 0x71, 0xFF, 0xF4, 0x71, 0xFF, 0xD3, 0x71, 0xFF, 0xF6, 0x71, 0xFF, 0xF5, 0x71, 0xFF, 0xB7, 0x69, 0xFF, 0xDF, 0x8E, 0xFF, 0xFC, 0x38, 0xFF, 0x19, 0x72, 0xFF, 0xF6, 0x71, 0xFF, 0xD7, 0x69, 0xFF, 0x1E, 0x49, 0xFF, 0xFF, 0xF7, 0xFF, 0xD9, 0x69, 0xFF, 0xB2, 0x61, 0xFF, 0xF3, 0x69, 0xFF, 0x90, 0x59, 0xFF, 0x1B, 0x9B, 0xFF, 0x6E, 0x51, 0xFF, 0x4C, 0x49, 0xFF, 0x4A, 0x49, 0xFF, 0x4B, 0x49, 0xFF, 0x0E, 0x6A, 0xFF, 0x48, 0x41, 0xFF, 0x09, 0x39, 0xFF, 0xEB, 0x38, 0xFF, 0x06, 0x39, 0xFF, 0xAF, 0x7A, 0xFF, 0xCA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x2C, 0x6A, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0x0D, 0x83, 0xFF, 0xE7, 0x38, 0xFF, 0xE7, 0x30, 0xFF, 0x07, 0x39, 0xFF, 0xC7, 0x59, 0xFF, 0xAF, 0xC4, 0xFF, 0xA7, 0x51, 0xFF, 0x48, 0x7A, 0xFF, 0xE9, 0x9A, 0xFF, 0xD2, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0xF5, 0xFF, 0xA9, 0x9A, 0xFF, 0x88, 0x82, 0xFF,
+    0xA6, 0x28, 0xA6, 0x28, 0xAC, 0x61, 0x85, 0x20, 0xA6, 0x28, 0xA6, 0x28, 0xC6, 0x28, 0x07, 0x31, 0x0E, 0x6A, 0xC7, 0x28, 0xE7, 0x30, 0xC6, 0x28, 0xA6, 0x28, 0xCC, 0x61, 0xC7, 0x30, 0xE7, 0x30, 0xC7, 0x28, 0x08, 0x39, 0x06, 0x39, 0xCC, 0x61, 0xA7, 0x30, 0xE8, 0x38, 0xE7, 0x30, 0xE6, 0x30, 0x32, 0x7A, 0x49, 0x41, 0x28, 0x39, 0x6B, 0x49, 0x4C, 0x49, 0x11, 0x6A, 0xB0, 0x69, 0xCF, 0x61,
+    0x78, 0x82, 0x76, 0x59, 0x51, 0x59, 0x91, 0x8A, 0x54, 0xED, 0xD5, 0xD4, 0x0B, 0x6A, 0x30, 0x9B, 0xD0, 0x92, 0xAC, 0x7A, 0x4A, 0x72, 0x0A, 0x6A, 0xEA, 0x61, 0xA8, 0x51, 0x2C, 0x72, 0x4B, 0x49, 0x4B, 0x49, 0x4A, 0x49, 0x68, 0x49, 0x52, 0x9B, 0x88, 0x51, 0x87, 0x51, 0xA8, 0x51, 0xC8, 0x59, 0x8D, 0x82, 0x6A, 0x72, 0x4A, 0x6A, 0xCC, 0x8A, 0x2E, 0xAB, 0xD6, 0xF6, 0xFF, 0xFF, 0xD2, 0xF4,
+    0xEC, 0x92, 0x8B, 0x7A, 0x4A, 0x72, 0x79, 0xFE, 0x8C, 0x82, 0x8B, 0x7A, 0x6A, 0x72, 0x4B, 0x72, 0x0E, 0x72, 0xBE, 0xFD, 0x2E, 0x72, 0x2F, 0x72, 0x95, 0x7A, 0xDD, 0x42, 0xFF, 0xFF, 0x3D, 0x41, 0x85, 0x20, 0xC6, 0x28, 0xC5, 0x28, 0xC7, 0x28, 0x0C, 0x5A, 0xC6, 0x28, 0xA6, 0x28, 0xC6, 0x30, 0x8F, 0x7A, 0x86, 0x28, 0xA6, 0x28, 0xE7, 0x30, 0x86, 0x20, 0xA5, 0x30, 0xC7, 0x30, 0x2A, 0x49,
+    0xE8, 0x30, 0xE8, 0x30, 0x07, 0x39, 0x4D, 0x72, 0xC8, 0x30, 0x09, 0x41, 0x08, 0x39, 0xE7, 0x38, 0xEB, 0x38, 0xE8, 0x38, 0x29, 0x41, 0x4A, 0x49, 0x0B, 0x41, 0xF2, 0x61, 0x2F, 0x51, 0x6F, 0x61, 0x3B, 0x82, 0x7E, 0x38, 0xB3, 0x69, 0x77, 0xB3, 0x15, 0xF5, 0xF3, 0xC3, 0x0C, 0x6A, 0x10, 0x93, 0x90, 0x92, 0x2A, 0x6A, 0x09, 0x6A, 0xC9, 0x61, 0x2F, 0x93, 0x69, 0x59, 0x0A, 0x62, 0x69, 0x51,
+    0xCA, 0x59, 0x8A, 0x51, 0x87, 0x51, 0x14, 0x9B, 0xAC, 0x7A, 0xA8, 0x51, 0xA8, 0x59, 0xC8, 0x61, 0x37, 0xCC, 0x70, 0x9B, 0x8A, 0x82, 0x0C, 0x9B, 0xF2, 0xEC, 0x57, 0xF7, 0xFF, 0xFF, 0x31, 0xE4, 0xAC, 0x8A, 0x6B, 0x7A, 0x6A, 0x72, 0x1D, 0xF7, 0xEC, 0x71, 0x4B, 0x72, 0x8B, 0x7A, 0x6D, 0x7A, 0xAE, 0x82, 0x0E, 0x7A, 0x50, 0x7A, 0x54, 0x7A, 0x19, 0x72, 0x9C, 0x59, 0xFB, 0x38, 0xF4, 0x59,
+    0xA6, 0x28, 0xC6, 0x28, 0xA6, 0x28, 0xC6, 0x28, 0xE8, 0x38, 0xA6, 0x28, 0xC7, 0x28, 0xC7, 0x28, 0xE7, 0x30, 0xA8, 0x30, 0xC7, 0x28, 0xA6, 0x28, 0x08, 0x39, 0xC7, 0x30, 0xA7, 0x30, 0xC7, 0x30, 0xE8, 0x30, 0xC7, 0x30, 0x18, 0xE5, 0x08, 0x39, 0x09, 0x41, 0xE8, 0x38, 0xE8, 0x38, 0x07, 0x39, 0x28, 0x39, 0x2F, 0x72, 0x09, 0x39, 0x4B, 0x49, 0x2D, 0x49, 0x50, 0x51, 0xB5, 0x9A, 0x8F, 0x51,
+    0x7A, 0x51, 0x7C, 0x59, 0xB3, 0x69, 0xD4, 0x9A, 0xFC, 0xFF, 0x74, 0xB3, 0x2E, 0x7A, 0x4C, 0x7A, 0x10, 0x9B, 0x6A, 0x7A, 0xE9, 0x61, 0x2A, 0x6A, 0xE9, 0x61, 0xC8, 0x59, 0xA9, 0x51, 0x8A, 0x51, 0x69, 0x49, 0x69, 0x49, 0xC9, 0x59, 0xCA, 0x59, 0xA9, 0x51, 0xA9, 0x51, 0xE8, 0x59, 0xE8, 0x61, 0x4A, 0x6A, 0xCB, 0x82, 0x4D, 0x9B, 0xF0, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xFD, 0x6D, 0xB3,
+    0xCD, 0x82, 0x8B, 0x82, 0x76, 0xED, 0xCB, 0x8A, 0x0C, 0x93, 0xCC, 0x8A, 0x8E, 0x7A, 0x98, 0xD4, 0x8F, 0x82, 0x70, 0x82, 0x72, 0x82, 0x39, 0x6A, 0xFF, 0xF7, 0x5E, 0x51, 0xBF, 0xB4, 0x12, 0x62, 0x8B, 0x49, 0xEB, 0x51, 0x48, 0x39, 0x28, 0x39, 0x07, 0x39, 0x6A, 0x41, 0xEC, 0x59, 0x89, 0x41, 0x69, 0x41, 0xE6, 0x30, 0xED, 0x61, 0x86, 0x28, 0xE8, 0x38, 0xE7, 0x38, 0xC7, 0x30, 0x71, 0xA3,
+    0x08, 0x39, 0x08, 0x39, 0xE7, 0x30, 0x06, 0x39, 0x4F, 0x82, 0xE8, 0x38, 0xCB, 0x59, 0xCA, 0x51, 0xAA, 0x59, 0x54, 0x82, 0x0A, 0x41, 0x0D, 0x62, 0xB0, 0x59, 0x8A, 0x30, 0x14, 0x82, 0xAF, 0x61, 0xF8, 0x79, 0xDB, 0x48, 0x71, 0x61, 0xF4, 0x9A, 0xFB, 0xF6, 0xD4, 0xCB, 0x70, 0x8A, 0xF0, 0x9A, 0x1C, 0x82, 0x8B, 0x7A, 0xC8, 0x61, 0x09, 0x6A, 0xC8, 0x61, 0xF2, 0xA2, 0xA9, 0x59, 0xAA, 0x59,
+    0xAA, 0x59, 0xA9, 0x59, 0xF5, 0x9A, 0xA8, 0x59, 0xE9, 0x61, 0xC9, 0x61, 0xC9, 0x61, 0xB4, 0xB3, 0x70, 0xA3, 0x4E, 0xA3, 0x11, 0xC4, 0x92, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xDC, 0x55, 0xDC, 0x15, 0xD5, 0x90, 0xAB, 0x50, 0xA3, 0x8E, 0xB3, 0x8D, 0xAB, 0x54, 0xC4, 0xF4, 0xB3, 0x14, 0x9B, 0x12, 0x9B, 0x75, 0xAB, 0x19, 0xBC, 0x1A, 0x62, 0x1D, 0x7C, 0xBB, 0x82, 0x12, 0x62, 0xF1, 0x61,
+    0xA6, 0x28, 0x08, 0x39, 0xA6, 0x28, 0xC7, 0x30, 0x25, 0x18, 0xA6, 0x28, 0x09, 0x41, 0xC7, 0x28, 0xA6, 0x28, 0xC7, 0x30, 0xE8, 0x30, 0xC7, 0x30, 0xC7, 0x28, 0xC7, 0x30, 0xC7, 0x28, 0xC7, 0x30, 0xE7, 0x38, 0xE9, 0x38, 0xE8, 0x38, 0x70, 0x7A, 0xE7, 0x38, 0x28, 0x41, 0x29, 0x41, 0xC7, 0x38, 0x49, 0x41, 0x0A, 0x41, 0x4B, 0x49, 0x2A, 0x41, 0x0D, 0x41, 0x90, 0x51, 0xF0, 0x48, 0x4E, 0x49,
+    0x78, 0x59, 0xBF, 0x75, 0xB2, 0x71, 0xB3, 0x9A, 0xFF, 0xFF, 0x14, 0xD4, 0x70, 0x82, 0xB1, 0x8A, 0x51, 0xAB, 0xCC, 0x8A, 0x2A, 0x72, 0x29, 0x6A, 0x2A, 0x6A, 0x0A, 0x6A, 0xCB, 0x59, 0xEB, 0x59, 0x68, 0x49, 0xC9, 0x59, 0x2A, 0x6A, 0xA8, 0x51, 0xA8, 0x51, 0xC8, 0x51, 0x2A, 0x6A, 0x52, 0xDD, 0x4B, 0x82, 0x8F, 0xA3, 0xF4, 0xE4, 0x90, 0xB3, 0x10, 0xD4, 0xD3, 0xCB, 0x16, 0xA3, 0x73, 0x8A,
+    0x6F, 0x82, 0xAD, 0x8A, 0x4D, 0xAB, 0xB0, 0xE4, 0x90, 0xE4, 0x30, 0xAB, 0xD0, 0x92, 0x11, 0xA3, 0x92, 0xBB, 0x71, 0xBB, 0x33, 0xAB, 0x95, 0x8A, 0x74, 0x82, 0x32, 0x72, 0x2F, 0x6A, 0x2F, 0x6A, 0x48, 0x41, 0xE8, 0x38, 0x2A, 0x41, 0xC7, 0x30, 0x86, 0x28, 0xA6, 0x28, 0x28, 0x39, 0x09, 0x39, 0xAF, 0x72, 0x08, 0x39, 0xE8, 0x30, 0x89, 0x49, 0xA6, 0x30, 0xE7, 0x30, 0xA7, 0x28, 0x86, 0x30,
+    0x0B, 0x6A, 0x06, 0x39, 0xE8, 0x30, 0x29, 0x41, 0xE7, 0x38, 0x92, 0xB3, 0xE8, 0x30, 0x49, 0x41, 0x8B, 0x59, 0x6D, 0x51, 0xCD, 0x61, 0x0D, 0x5A, 0xAF, 0x61, 0x6F, 0x51, 0xF3, 0x79, 0x70, 0x51, 0xF6, 0x69, 0xFB, 0x8A, 0x31, 0x59, 0x76, 0x9A, 0x1D, 0xAB, 0xB6, 0x9A, 0x31, 0x7A, 0x71, 0x8A, 0xD4, 0xD3, 0x6E, 0xAB, 0x09, 0x6A, 0x2A, 0x6A, 0x2B, 0x6A, 0xDA, 0x9A, 0x89, 0x51, 0x89, 0x51,
+    0xA9, 0x51, 0xC8, 0x59, 0xF2, 0xCB, 0x88, 0x59, 0xC8, 0x61, 0xE9, 0x61, 0x6E, 0x7A, 0x52, 0x9B, 0xCC, 0x69, 0x0E, 0x6A, 0x70, 0x82, 0xB4, 0xBB, 0xF3, 0xAA, 0x59, 0x92, 0x7E, 0x94, 0xD8, 0x9A, 0x16, 0xC4, 0x10, 0xA3, 0x53, 0xF5, 0xFF, 0xFF, 0xFD, 0xFF, 0xB7, 0xEC, 0x51, 0xAB, 0xF1, 0xCB, 0xF7, 0xF6, 0xFF, 0xFF, 0xD7, 0xEC, 0xD2, 0x8A, 0x71, 0x82, 0xB1, 0x82, 0x51, 0x7A, 0x2E, 0x72,
+    0xA5, 0x28, 0x65, 0x28, 0xC6, 0x30, 0xAD, 0x59, 0xC7, 0x28, 0xC6, 0x28, 0xA6, 0x28, 0xE6, 0x30, 0xCA, 0x61, 0xC7, 0x30, 0xC7, 0x30, 0xA7, 0x28, 0xA7, 0x28, 0x0C, 0x6A, 0xE8, 0x38, 0xC7, 0x30, 0xA6, 0x28, 0x07, 0x39, 0x6F, 0x6A, 0x2F, 0x72, 0xA7, 0x30, 0x27, 0x39, 0x49, 0x41, 0x27, 0x39, 0xD1, 0x71, 0x2A, 0x41, 0x29, 0x49, 0x49, 0x41, 0x0B, 0x41, 0x4F, 0x51, 0x55, 0x92, 0x70, 0x59,
+    0x98, 0x9B, 0x72, 0x51, 0x72, 0x61, 0x12, 0x82, 0xFF, 0xF7, 0x5A, 0x8A, 0x94, 0x8A, 0xD4, 0xCB, 0xB7, 0xFD, 0xAE, 0xB3, 0x6A, 0x7A, 0x0A, 0x6A, 0x2A, 0x72, 0xAE, 0x71, 0xAF, 0x8A, 0xEA, 0x61, 0xE9, 0x59, 0x2A, 0x62, 0xA9, 0x51, 0x55, 0xAB, 0xA8, 0x51, 0xA8, 0x51, 0xF4, 0xAB, 0xD1, 0x8A, 0x9F, 0xD4, 0xF1, 0x69, 0x31, 0x7A, 0x73, 0x82, 0x37, 0x7A, 0xBF, 0x71, 0xFF, 0xFF, 0x59, 0x82,
+    0x91, 0x92, 0xD1, 0xCB, 0xD9, 0xF6, 0xFF, 0xFF, 0x38, 0xFF, 0xD0, 0xCB, 0xF1, 0xC3, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xC3, 0x90, 0x8A, 0x53, 0xB4, 0x33, 0x82, 0x1F, 0xC4, 0x0E, 0x6A, 0xC6, 0x28, 0xC6, 0x28, 0xC7, 0x28, 0xC6, 0x28, 0xA7, 0x30, 0x08, 0x39, 0xC7, 0x30, 0xC7, 0x30, 0x4A, 0x49, 0xA7, 0x30, 0xC7, 0x30, 0xA6, 0x28, 0x8A, 0x49, 0xEB, 0x61, 0xC7, 0x30, 0x6A, 0x49,
+    0x08, 0x39, 0xC6, 0x30, 0x47, 0x49, 0x68, 0x49, 0xA6, 0x30, 0x07, 0x39, 0x70, 0x82, 0xCC, 0x59, 0x2A, 0x49, 0xE8, 0x38, 0x34, 0x82, 0x4A, 0x51, 0x2E, 0x6A, 0x4F, 0x51, 0x71, 0x59, 0x14, 0x82, 0x16, 0x93, 0x10, 0x49, 0x71, 0x59, 0x39, 0xAB, 0xBE, 0x31, 0xD9, 0x71, 0x52, 0x7A, 0x31, 0xAB, 0xFC, 0xF4, 0xCD, 0x9A, 0x6B, 0x7A, 0x8B, 0x7A, 0x0B, 0x6A, 0x94, 0xB3, 0xC8, 0x59, 0xEA, 0x71,
+    0x47, 0x49, 0xD3, 0xD4, 0x27, 0x51, 0xEC, 0x61, 0x0A, 0x6A, 0x8E, 0x59, 0x74, 0xAB, 0x12, 0x8B, 0x6E, 0x61, 0xF0, 0x69, 0x94, 0x82, 0x57, 0x82, 0x5E, 0x8A, 0x5F, 0x82, 0xDA, 0x79, 0x5A, 0xBB, 0x73, 0xBB, 0x55, 0xFD, 0xFF, 0xFF, 0x58, 0xFE, 0x50, 0xE4, 0x90, 0xBB, 0xB7, 0xFE, 0xFF, 0xFF, 0x7A, 0xFF, 0xD2, 0xDC, 0x12, 0x9B, 0x91, 0x82, 0x95, 0xAB, 0xF4, 0x92, 0x71, 0x7A, 0x6F, 0x7A,
+    0xCC, 0x59, 0xA6, 0x28, 0xA6, 0x28, 0xA6, 0x28, 0x85, 0x28, 0xCD, 0x61, 0x45, 0x20, 0xAB, 0x49, 0xCB, 0x51, 0x85, 0x28, 0x4F, 0x7A, 0xC7, 0x30, 0xC7, 0x30, 0x08, 0x39, 0xC7, 0x38, 0xB2, 0x8A, 0xE8, 0x38, 0xE8, 0x30, 0xAF, 0x72, 0x07, 0x39, 0x0E, 0x7A, 0x08, 0x39, 0x07, 0x39, 0x08, 0x41, 0xE6, 0x30, 0x33, 0x8A, 0x09, 0x41, 0xD4, 0x9A, 0x0A, 0x41, 0x0D, 0x51, 0x34, 0x8A, 0x79, 0xB3,
+    0x0E, 0x51, 0x51, 0x51, 0x51, 0x59, 0x13, 0x8A, 0xF8, 0x50, 0xB4, 0x61, 0x31, 0x7A, 0xD1, 0x9A, 0x36, 0xBB, 0xED, 0x92, 0x6B, 0x7A, 0x09, 0x6A, 0xEA, 0x69, 0xD6, 0xA2, 0xA8, 0x51, 0x67, 0x49, 0x8D, 0x72, 0x6D, 0x8A, 0x5F, 0xDD, 0x4B, 0x72, 0x68, 0x51, 0x73, 0xA3, 0x0E, 0x6A, 0x5D, 0xAB, 0x6E, 0x59, 0xB1, 0x61, 0x36, 0x82, 0x98, 0x61, 0xBF, 0x9D, 0x3C, 0x9D, 0x79, 0xAB, 0x96, 0xBB,
+    0xB1, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0xD4, 0x14, 0xDD, 0x91, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0xE4, 0x52, 0xAB, 0xB1, 0x92, 0x36, 0x9B, 0xDE, 0xFE, 0xD8, 0xD4, 0x4F, 0x72, 0x6F, 0x72, 0xA6, 0x28, 0xA6, 0x28, 0xA6, 0x28, 0xC7, 0x30, 0xC6, 0x28, 0xE7, 0x30, 0xE7, 0x30, 0x2C, 0x62, 0xCB, 0x51, 0xA6, 0x28, 0xC7, 0x30, 0xC7, 0x30, 0xA7, 0x28, 0xE8, 0x30, 0x08, 0x41, 0x07, 0x39,
+    0xC8, 0x38, 0xE8, 0x38, 0x27, 0x41, 0x07, 0x39, 0xC6, 0x30, 0xE7, 0x30, 0x07, 0x39, 0x49, 0x51, 0x27, 0x41, 0x09, 0x41, 0xC8, 0x38, 0x0E, 0x51, 0x0A, 0x49, 0x2B, 0x49, 0x0E, 0x49, 0x50, 0x51, 0x2E, 0x49, 0x4F, 0x51, 0x30, 0x59, 0x70, 0x59, 0xD4, 0x69, 0xB4, 0x69, 0x31, 0x72, 0x7A, 0xF5, 0xD2, 0x92, 0x0A, 0x6A, 0xC9, 0x61, 0x88, 0x51, 0x2A, 0x7A, 0x8B, 0x61, 0x88, 0x51, 0x88, 0x51,
+    0x88, 0x49, 0xEA, 0x61, 0x8C, 0x59, 0x50, 0x93, 0x6C, 0x51, 0xC9, 0x48, 0x54, 0xA3, 0xB4, 0x61, 0xAE, 0x59, 0xB0, 0x61, 0x70, 0x59, 0xB5, 0x61, 0x78, 0x61, 0xD6, 0x69, 0x12, 0x72, 0x51, 0x7A, 0x13, 0xAB, 0x52, 0xDC, 0x96, 0xDC, 0x14, 0xA3, 0x95, 0x92, 0xF1, 0x9A, 0x13, 0xD4, 0x92, 0xC3, 0xD1, 0x9A, 0xD3, 0x92, 0x18, 0xBC, 0x52, 0x7A, 0x1C, 0xF6, 0xB1, 0x82, 0x2F, 0x72, 0x2E, 0x62,
+    0x85, 0x28, 0xE7, 0x30, 0xAB, 0x51, 0x08, 0x39, 0xA6, 0x28, 0x86, 0x28, 0xE6, 0x30, 0x29, 0x49, 0x66, 0x28, 0xC7, 0x30, 0xC7, 0x30, 0xCB, 0x59, 0xC8, 0x38, 0xA7, 0x30, 0xE7, 0x38, 0xA8, 0x30, 0x0D, 0x6A, 0xE7, 0x30, 0x49, 0x41, 0xEC, 0x61, 0x0B, 0x62, 0xF0, 0x81, 0x07, 0x39, 0x4A, 0x51, 0x07, 0x39, 0xC9, 0x38, 0x95, 0x9A, 0x0F, 0x72, 0x2A, 0x49, 0x2B, 0x41, 0xEE, 0x50, 0x74, 0x82,
+    0x33, 0x72, 0x2E, 0x51, 0xEE, 0x50, 0xD7, 0x9A, 0x54, 0x92, 0xF2, 0x71, 0xD0, 0x61, 0xD3, 0xB3, 0x5C, 0xBB, 0xAD, 0x8A, 0xC9, 0x61, 0x27, 0x51, 0x6F, 0x8A, 0x7E, 0xA2, 0x67, 0x51, 0x68, 0x51, 0xCB, 0x61, 0x2E, 0x72, 0x13, 0xA3, 0xF1, 0x8A, 0xD0, 0x59, 0x4E, 0x72, 0x94, 0x82, 0xB4, 0x8A, 0x8D, 0x59, 0x52, 0x82, 0xD4, 0x8A, 0x98, 0x92, 0xD2, 0x71, 0xD5, 0x92, 0xD0, 0x61, 0x51, 0x82,
+    0xB7, 0xBB, 0xF3, 0xA2, 0x96, 0x8A, 0x5A, 0x7A, 0xB8, 0x79, 0xD8, 0xC3, 0xF3, 0xA2, 0x73, 0x82, 0x18, 0x7A, 0x1A, 0x7A, 0x9B, 0xCC, 0xD3, 0x82, 0xD6, 0xB3, 0x57, 0xB4, 0x4F, 0x72, 0x4F, 0x7A, 0xC7, 0x30, 0x85, 0x28, 0x08, 0x39, 0xC7, 0x30, 0x08, 0x39, 0xC6, 0x28, 0xC7, 0x30, 0xC7, 0x30, 0x0E, 0x6A, 0xC7, 0x30, 0x28, 0x39, 0xC7, 0x30, 0xEC, 0x59, 0x0D, 0x72, 0x86, 0x28, 0xC7, 0x30,
+    0xED, 0x59, 0xE7, 0x30, 0xEC, 0x59, 0x4E, 0x72, 0x6E, 0x72, 0x48, 0x41, 0x27, 0x41, 0x48, 0x49, 0xB3, 0x92, 0x08, 0x41, 0x53, 0x92, 0xAE, 0x61, 0x18, 0x9B, 0x2D, 0x51, 0x91, 0x69, 0x11, 0x8A, 0x58, 0xB3, 0x4E, 0x51, 0x2E, 0x59, 0xB6, 0x9A, 0xDB, 0xFC, 0x77, 0xD4, 0xD1, 0x69, 0x6F, 0x8A, 0x56, 0xBB, 0x88, 0x59, 0x88, 0x51, 0x88, 0x51, 0x2D, 0x8A, 0x53, 0xAB, 0x47, 0x51, 0x27, 0x41,
+    0x8D, 0x82, 0x0E, 0x7A, 0x6B, 0x51, 0x16, 0x9B, 0x73, 0x9B, 0xCC, 0x61, 0x5B, 0xA3, 0x54, 0x93, 0xB4, 0x92, 0xAE, 0x59, 0xAF, 0x61, 0x11, 0x72, 0xF4, 0x92, 0xB1, 0x61, 0x5F, 0xF6, 0x36, 0xA3, 0xF4, 0x9A, 0x14, 0x7A, 0xBB, 0x61, 0xFF, 0xFF, 0xFE, 0x79, 0x74, 0x82, 0x95, 0x8A, 0xF7, 0x69, 0x7F, 0xDF, 0xFF, 0xCF, 0x3E, 0xE5, 0x51, 0x72, 0xB4, 0x8A, 0x92, 0x7A, 0x5D, 0xC4, 0xEE, 0x61,
+    0xC7, 0x30, 0xC6, 0x30, 0xC6, 0x28, 0x0C, 0x62, 0x66, 0x20, 0xA6, 0x28, 0xE7, 0x38, 0x85, 0x20, 0x89, 0x51, 0x8A, 0x49, 0x28, 0x39, 0x8A, 0x49, 0x28, 0x41, 0xA6, 0x30, 0x0C, 0x6A, 0xA7, 0x30, 0xE8, 0x38, 0x26, 0x39, 0x48, 0x49, 0x12, 0x72, 0x2D, 0x6A, 0x08, 0x39, 0x8C, 0x61, 0x89, 0x59, 0xCC, 0x40, 0xAB, 0x38, 0x0C, 0x49, 0x4D, 0x51, 0x4C, 0x49, 0x4F, 0x59, 0x4E, 0x71, 0x92, 0x69,
+    0xBB, 0xCC, 0x70, 0x59, 0x70, 0x61, 0x34, 0x8A, 0xB3, 0x79, 0xB6, 0xB3, 0xB0, 0x69, 0xB1, 0x92, 0x77, 0xC3, 0x2E, 0x7A, 0xA8, 0x59, 0x88, 0x51, 0xAD, 0x69, 0x6C, 0x61, 0x28, 0x49, 0x67, 0x49, 0xA8, 0x51, 0x9B, 0x8A, 0x8C, 0x59, 0x1D, 0x9B, 0xCC, 0x61, 0x2B, 0x49, 0x9D, 0xE5, 0xF2, 0x8A, 0xFA, 0xC3, 0x4C, 0x59, 0x6E, 0x59, 0x6E, 0x59, 0x8F, 0x59, 0x6F, 0x59, 0x35, 0x7A, 0xB0, 0x61,
+    0x18, 0x9B, 0xD8, 0x71, 0xDF, 0x48, 0x3F, 0xF7, 0x1E, 0x72, 0x78, 0x7A, 0x9B, 0x61, 0xFE, 0x48, 0x7F, 0xF7, 0x1E, 0x72, 0x98, 0xAB, 0x31, 0x72, 0x52, 0x72, 0x11, 0x7A, 0x30, 0x6A, 0x0F, 0x6A, 0xEE, 0x61, 0x08, 0x39, 0xA6, 0x28, 0xA6, 0x28, 0xC7, 0x30, 0x4E, 0x7A, 0xA6, 0x30, 0xC6, 0x30, 0xE7, 0x30, 0xC7, 0x30, 0x2E, 0x72, 0xCB, 0x51, 0x29, 0x41, 0x08, 0x39, 0x2C, 0x6A, 0x2E, 0x7A,
+    0xE8, 0x38, 0x48, 0x41, 0xE8, 0x38, 0x06, 0x39, 0x71, 0x82, 0x0D, 0x62, 0x89, 0x51, 0xB9, 0x7A, 0x92, 0x93, 0xD7, 0xA2, 0xED, 0x48, 0x0F, 0x69, 0x0C, 0x49, 0x2D, 0x51, 0xB6, 0x9A, 0x59, 0xB3, 0xD4, 0x71, 0x33, 0x72, 0xEE, 0x50, 0xB9, 0xA2, 0xFF, 0xFF, 0xBB, 0x9A, 0x74, 0x8A, 0xB6, 0xCB, 0xD8, 0xF3, 0x31, 0xB3, 0xC8, 0x59, 0xE8, 0x61, 0x13, 0xA3, 0xFE, 0xD3, 0x68, 0x51, 0x46, 0x49,
+    0xA8, 0x61, 0x12, 0x9B, 0xDE, 0xFF, 0xB7, 0x8A, 0xEC, 0x61, 0xFB, 0xE5, 0xF5, 0xB3, 0x1B, 0xFE, 0xB2, 0x8A, 0xF2, 0x8A, 0x6E, 0x61, 0x10, 0x72, 0x16, 0x93, 0x71, 0x61, 0x14, 0x9B, 0xD2, 0x61, 0xB7, 0x92, 0x3E, 0xA5, 0xFF, 0xFF, 0xF8, 0x69, 0x7D, 0x61, 0x59, 0x7A, 0xFF, 0xBD, 0xFF, 0xFF, 0xB9, 0x61, 0xF5, 0x69, 0x94, 0x8A, 0xD8, 0xB3, 0x9A, 0xAB, 0x30, 0x72, 0x0F, 0x6A, 0x0F, 0x6A,
+    0x85, 0x28, 0x69, 0x41, 0x08, 0x39, 0xAB, 0x49, 0xE7, 0x30, 0xC7, 0x30, 0x86, 0x28, 0x8B, 0x51, 0x86, 0x28, 0x08, 0x39, 0xE6, 0x30, 0xE8, 0x38, 0x4A, 0x49, 0x49, 0x41, 0x0B, 0x5A, 0x4E, 0x72, 0xE7, 0x30, 0x08, 0x39, 0xE7, 0x40, 0xD0, 0x82, 0x6A, 0x51, 0xB1, 0x7A, 0x8A, 0x51, 0xEA, 0x48, 0x09, 0x41, 0xED, 0x38, 0xF1, 0x79, 0x6D, 0x59, 0x2C, 0x49, 0x77, 0x82, 0x90, 0x61, 0x74, 0x61,
+    0x75, 0x92, 0xBA, 0x92, 0x90, 0x69, 0x37, 0x92, 0xFF, 0xFF, 0xDF, 0xFF, 0x11, 0x7A, 0x95, 0xEC, 0xFF, 0xFF, 0xF5, 0xE4, 0xC9, 0x61, 0x4A, 0x82, 0x1D, 0xFF, 0x73, 0xBB, 0x88, 0x51, 0x88, 0x59, 0x52, 0xAB, 0x6B, 0x61, 0xAD, 0x71, 0xB7, 0xD4, 0xEE, 0x71, 0x4B, 0x51, 0xD1, 0x8A, 0xCE, 0x69, 0x30, 0x72, 0x54, 0xA3, 0xCF, 0x69, 0xF0, 0x69, 0x70, 0x59, 0xB3, 0x92, 0x8E, 0x59, 0xB0, 0x59,
+    0x37, 0x7A, 0x9D, 0x8A, 0xB6, 0x59, 0xF3, 0x61, 0x54, 0x72, 0x5B, 0x82, 0x3D, 0x7A, 0x96, 0x59, 0xD3, 0x61, 0xF2, 0x61, 0x32, 0x7A, 0x10, 0x6A, 0x11, 0x6A, 0x2F, 0x6A, 0x2F, 0x72, 0xEE, 0x69, 0xE7, 0x30, 0x08, 0x39, 0x6A, 0x51, 0x49, 0x41, 0x86, 0x20, 0xA6, 0x28, 0xC7, 0x30, 0x0C, 0x62, 0xA7, 0x30, 0x93, 0x72, 0xC8, 0x30, 0xE6, 0x30, 0xCB, 0x61, 0xD0, 0x7A, 0x6B, 0x49, 0xE7, 0x30,
+    0xCC, 0x59, 0x49, 0x49, 0xC7, 0x38, 0xCA, 0x59, 0x4B, 0x51, 0x11, 0x7A, 0x4B, 0x51, 0x2C, 0x51, 0x96, 0x8A, 0x0D, 0x49, 0xB7, 0x9A, 0x6E, 0x61, 0xBC, 0x9A, 0x4F, 0x51, 0x52, 0x59, 0x34, 0x8A, 0x76, 0xB2, 0x5F, 0xFE, 0x91, 0x69, 0xDF, 0xF4, 0xBD, 0xDB, 0xFE, 0xF4, 0x58, 0xCC, 0x5C, 0xFE, 0x7C, 0xFF, 0x92, 0x92, 0xC8, 0x59, 0xEC, 0x79, 0x1C, 0xB3, 0x54, 0xB3, 0x67, 0x51, 0xEA, 0x69,
+    0x99, 0xFD, 0xD2, 0xB3, 0x35, 0xA3, 0x6D, 0x7A, 0xD4, 0x92, 0x4B, 0x51, 0xF3, 0x9A, 0x95, 0x8A, 0x35, 0x9B, 0x2E, 0x51, 0x71, 0x82, 0xF0, 0x79, 0x57, 0xAB, 0xCF, 0x61, 0xCE, 0x61, 0x8F, 0x59, 0x5B, 0x8A, 0xF4, 0x79, 0x70, 0x59, 0x72, 0x7A, 0xF1, 0x69, 0x58, 0x82, 0xB2, 0x61, 0xD1, 0x61, 0x8F, 0x59, 0x30, 0x72, 0x32, 0x72, 0x50, 0x6A, 0x30, 0x72, 0x0F, 0x6A, 0x2F, 0x72, 0x70, 0x7A,
+    0xA5, 0x28, 0xC6, 0x30, 0xC7, 0x28, 0xC7, 0x30, 0xCD, 0x61, 0x08, 0x31, 0x29, 0x41, 0xE7, 0x30, 0x2C, 0x62, 0xAF, 0x82, 0xA7, 0x28, 0xC8, 0x30, 0x28, 0x39, 0x69, 0x51, 0x09, 0x41, 0x09, 0x39, 0x27, 0x39, 0xC5, 0x30, 0xCB, 0x61, 0x07, 0x41, 0xE9, 0x40, 0x2C, 0x49, 0x9A, 0x9A, 0x2C, 0x49, 0xD2, 0x82, 0xCD, 0x40, 0x36, 0x8A, 0x2D, 0x51, 0x4E, 0x51, 0x90, 0x61, 0x37, 0x7A, 0xBD, 0xC3,
+    0x74, 0x79, 0xB9, 0x92, 0x15, 0x82, 0x7E, 0xF5, 0x7D, 0xFD, 0xDA, 0xCB, 0x0F, 0x7A, 0x1C, 0xFE, 0x1D, 0xF6, 0xCD, 0x71, 0xC8, 0x59, 0x8A, 0x61, 0xD4, 0xBB, 0x74, 0xBB, 0x67, 0x51, 0x68, 0x51, 0x8A, 0x59, 0xF2, 0x81, 0xED, 0x69, 0x0E, 0x72, 0x4E, 0x59, 0x6C, 0x59, 0x35, 0xAB, 0x6D, 0x51, 0x4C, 0x51, 0x2E, 0x51, 0x10, 0x72, 0x33, 0x82, 0xEF, 0x69, 0x6C, 0x51, 0x8D, 0x51, 0x57, 0xAB,
+    0x35, 0x7A, 0xB0, 0x61, 0x51, 0x72, 0xF5, 0x9A, 0x6E, 0x59, 0x34, 0x6A, 0xB0, 0x61, 0xAF, 0x61, 0x15, 0xA3, 0xEF, 0x61, 0x31, 0x72, 0x0F, 0x6A, 0x30, 0x72, 0x2F, 0x7A, 0x2F, 0x72, 0x2E, 0x72, 0xC6, 0x28, 0x45, 0x20, 0xA6, 0x30, 0xCE, 0x61, 0xCF, 0x82, 0x29, 0x41, 0xC8, 0x38, 0xC7, 0x30, 0x4F, 0x7A, 0x89, 0x59, 0x6A, 0x51, 0xE8, 0x38, 0x29, 0x41, 0xE6, 0x38, 0x9B, 0xAB, 0xC7, 0x30,
+    0xE8, 0x38, 0x27, 0x41, 0xAA, 0x38, 0x73, 0x82, 0x09, 0x41, 0x0C, 0x49, 0x89, 0x38, 0x1C, 0x93, 0x74, 0x82, 0x7B, 0xB3, 0x0E, 0x59, 0x18, 0xB3, 0xEB, 0x48, 0xDB, 0x92, 0xB7, 0xA2, 0xD2, 0x71, 0xFC, 0x71, 0xBF, 0x79, 0xBC, 0xBB, 0x76, 0xC3, 0xFF, 0xFF, 0x95, 0xEC, 0x90, 0x92, 0xD0, 0x9A, 0x57, 0xB3, 0x90, 0x8A, 0xC8, 0x59, 0xCB, 0x69, 0x2F, 0x92, 0xCD, 0x81, 0x19, 0xCC, 0x8A, 0x59,
+    0x0C, 0x6A, 0x92, 0x9A, 0x4A, 0x49, 0x35, 0xA3, 0x4C, 0x51, 0x74, 0xBB, 0x37, 0x72, 0xEF, 0x69, 0x5A, 0xA3, 0x2B, 0x49, 0x6E, 0x61, 0xAF, 0x69, 0xEF, 0x69, 0xF7, 0x92, 0x78, 0xB3, 0x8D, 0x59, 0x10, 0x6A, 0x4E, 0x51, 0x54, 0x82, 0xDF, 0xBB, 0xAE, 0x59, 0x51, 0x72, 0xAF, 0x69, 0xF0, 0x69, 0xFF, 0xBB, 0xF0, 0x69, 0xCF, 0x61, 0x4F, 0x72, 0x70, 0x7A, 0x58, 0xA3, 0x93, 0x8A, 0x4F, 0x7A,
+    0xCE, 0x59, 0xA6, 0x28, 0x29, 0x41, 0x86, 0x28, 0xAB, 0x59, 0xCC, 0x61, 0x49, 0x51, 0x29, 0x49, 0x07, 0x39, 0x4A, 0x51, 0xD6, 0xD4, 0xEC, 0x59, 0xE7, 0x38, 0x07, 0x39, 0x07, 0x41, 0x30, 0x7A, 0xE8, 0x30, 0xE7, 0x30, 0xC8, 0x40, 0xF0, 0x71, 0x73, 0x8A, 0xEC, 0x50, 0xAB, 0x38, 0xEA, 0x40, 0x12, 0x7A, 0x96, 0x92, 0x54, 0x7A, 0x0D, 0x49, 0x2D, 0x51, 0x74, 0x82, 0xFA, 0xA2, 0xD3, 0x81,
+    0x7F, 0x71, 0xFF, 0xFF, 0x9E, 0xDC, 0x17, 0xCB, 0xFF, 0xFF, 0xBB, 0xEE, 0x6F, 0x92, 0xF2, 0x9A, 0x56, 0xBB, 0x9A, 0xED, 0x88, 0x59, 0xAF, 0x8A, 0xEF, 0x81, 0xD4, 0xA2, 0x2A, 0x49, 0x0F, 0x72, 0xB4, 0xC3, 0x94, 0x82, 0xF5, 0xD3, 0x2C, 0x59, 0xAC, 0x61, 0x6C, 0x59, 0x31, 0x7A, 0xD4, 0x8A, 0x92, 0x82, 0x76, 0xB3, 0xAD, 0x61, 0x6C, 0x59, 0x34, 0x93, 0x76, 0xB3, 0x4B, 0x49, 0x4C, 0x49,
+    0xAE, 0x59, 0x16, 0x9B, 0x34, 0x82, 0xAD, 0x61, 0x8D, 0x51, 0x10, 0x7A, 0xD9, 0xB3, 0x17, 0xA3, 0xEF, 0x61, 0xCE, 0x61, 0xB1, 0x82, 0x15, 0x93, 0x14, 0x9B, 0x4E, 0x72, 0x8F, 0x7A, 0x2D, 0x72, 0xC6, 0x30, 0xA6, 0x30, 0xBA, 0xD4, 0xA7, 0x28, 0xC7, 0x40, 0xC6, 0x30, 0xAF, 0x7A, 0xE6, 0x38, 0xE6, 0x38, 0x49, 0x49, 0x6E, 0x6A, 0xAA, 0x51, 0x07, 0x41, 0xE7, 0x40, 0x28, 0x41, 0xE7, 0x38,
+    0x89, 0x49, 0xE6, 0x30, 0xE6, 0x38, 0xB8, 0xD4, 0x4E, 0x51, 0x37, 0xBC, 0x2B, 0x49, 0x8E, 0x61, 0x4F, 0x61, 0x4E, 0x51, 0x8E, 0x61, 0x0D, 0x49, 0xFA, 0xA2, 0x70, 0x61, 0xFF, 0xFE, 0x54, 0x8A, 0x9C, 0xCB, 0x7B, 0x92, 0xF9, 0xAA, 0xF4, 0xC2, 0x7F, 0xF6, 0xB6, 0xFC, 0x51, 0xAB, 0x14, 0xA3, 0x1C, 0xF5, 0x71, 0x8A, 0xA9, 0x59, 0x0F, 0x82, 0x10, 0x92, 0x73, 0x9A, 0x6A, 0x51, 0x2A, 0x51,
+    0x55, 0xB3, 0xCC, 0x61, 0x13, 0xA3, 0x2C, 0x51, 0x74, 0xAB, 0xEA, 0x40, 0xCD, 0x61, 0x71, 0x82, 0x35, 0xA3, 0x8D, 0x59, 0xAD, 0x61, 0xCD, 0x61, 0x34, 0x9B, 0x4B, 0x49, 0x4A, 0x49, 0x2B, 0x49, 0x51, 0x82, 0xCD, 0x61, 0xAC, 0x59, 0xEE, 0x69, 0x4C, 0x51, 0xB2, 0x8A, 0x8C, 0x59, 0xCD, 0x61, 0xCD, 0x61, 0xEE, 0x69, 0xD2, 0x8A, 0x0D, 0x6A, 0x4E, 0x72, 0x2E, 0x72, 0x4E, 0x72, 0x6E, 0x7A,
+    0x86, 0x28, 0xC7, 0x30, 0x0D, 0x62, 0xC7, 0x30, 0xE8, 0x38, 0xC7, 0x30, 0x6E, 0x72, 0x6D, 0x6A, 0xE6, 0x30, 0x08, 0x41, 0x8E, 0x72, 0x6C, 0x6A, 0x93, 0x9B, 0x26, 0x41, 0x48, 0x49, 0xE8, 0x38, 0xE5, 0x30, 0x2A, 0x41, 0xE6, 0x38, 0x2C, 0x6A, 0xE9, 0x38, 0x52, 0x82, 0xE9, 0x40, 0x0B, 0x49, 0x17, 0xB4, 0xB2, 0x69, 0x95, 0x8A, 0x72, 0x61, 0x2D, 0x51, 0x75, 0x82, 0xDB, 0xBB, 0x98, 0xA2,
+    0x19, 0x92, 0xDB, 0x9A, 0xBC, 0xBB, 0xF7, 0xDB, 0xFF, 0xFF, 0x96, 0xFC, 0x8F, 0x92, 0x57, 0xAB, 0x3F, 0xFE, 0xF2, 0x9A, 0xC9, 0x61, 0x0D, 0x7A, 0x71, 0x9A, 0xEE, 0x79, 0x4B, 0x59, 0x8B, 0x59, 0x2E, 0x7A, 0xEE, 0x69, 0xEC, 0x48, 0x2C, 0x51, 0x2B, 0x51, 0x8C, 0x59, 0x0F, 0x72, 0x6D, 0x59, 0xCD, 0x61, 0x4B, 0x51, 0x8C, 0x59, 0xEF, 0x79, 0x4A, 0x49, 0x4A, 0x49, 0x8C, 0x59, 0x6D, 0x61,
+    0x8B, 0x59, 0xED, 0x61, 0xEC, 0x61, 0x8B, 0x59, 0x4C, 0x51, 0xAD, 0x61, 0xAC, 0x59, 0x0E, 0x72, 0x0E, 0x6A, 0xED, 0x61, 0x2E, 0x72, 0x90, 0x7A, 0x0D, 0x6A, 0x6F, 0x7A, 0x2D, 0x72, 0x8F, 0x82, 0xA6, 0x28, 0x86, 0x28, 0x08, 0x41, 0xE8, 0x30, 0x69, 0x49, 0xE7, 0x30, 0xC8, 0x38, 0xCF, 0x7A, 0xE6, 0x30, 0x4D, 0x72, 0x48, 0x49, 0xEC, 0x59, 0xE7, 0x38, 0x8A, 0x59, 0x27, 0x41, 0x28, 0x41,
+    0xC8, 0x30, 0x27, 0x41, 0x31, 0x7A, 0x11, 0x83, 0x8A, 0x51, 0x0B, 0x49, 0x93, 0x8A, 0xEA, 0x40, 0xF1, 0x69, 0xEC, 0x40, 0x71, 0x61, 0xAB, 0x48, 0xEB, 0x40, 0x7E, 0x82, 0xF9, 0xA2, 0xD9, 0xCB, 0xFD, 0x89, 0x7D, 0xD6, 0x7F, 0xE4, 0xDC, 0xFC, 0xFF, 0xFF, 0x9A, 0xFF, 0xB0, 0xA2, 0xD4, 0xAA, 0xBD, 0xFD, 0x6F, 0x82, 0xA9, 0x61, 0xEC, 0x79, 0xB1, 0x92, 0x95, 0xBB, 0xAC, 0x61, 0xD5, 0xB3,
+    0x0D, 0x72, 0xF3, 0xA2, 0x4A, 0x49, 0x53, 0x9B, 0x6A, 0x51, 0x8C, 0x61, 0xCF, 0x69, 0xCD, 0x61, 0xED, 0x69, 0x6B, 0x59, 0x8E, 0x71, 0x8B, 0x59, 0x69, 0x51, 0x4A, 0x49, 0x92, 0x8A, 0x4B, 0x59, 0x8A, 0x51, 0x0D, 0x6A, 0xED, 0x69, 0xF2, 0x9A, 0x6B, 0x51, 0xAC, 0x59, 0xCD, 0x61, 0xAC, 0x61, 0x8B, 0x61, 0x0D, 0x6A, 0x2D, 0x72, 0x8F, 0x7A, 0x6E, 0x7A, 0xD0, 0x8A, 0x6E, 0x7A, 0x8F, 0x82,
+    0xC7, 0x30, 0x29, 0x41, 0xE8, 0x38, 0xB0, 0x7A, 0xC7, 0x30, 0x85, 0x28, 0x4A, 0x51, 0x2C, 0x62, 0xCB, 0x61, 0x06, 0x39, 0x47, 0x51, 0x89, 0x51, 0x48, 0x49, 0x84, 0x28, 0x30, 0x72, 0xA9, 0x51, 0x48, 0x41, 0xE6, 0x38, 0x87, 0x30, 0x93, 0x82, 0x4D, 0x6A, 0x54, 0xA3, 0x36, 0xA3, 0xF6, 0x9A, 0x4F, 0x59, 0x2E, 0x59, 0xCD, 0x48, 0x34, 0x7A, 0x4E, 0x59, 0xB0, 0x69, 0x1B, 0x9B, 0x96, 0x92,
+    0x9D, 0x9A, 0xDD, 0xB5, 0x3A, 0xB3, 0x96, 0xCB, 0xFF, 0xFF, 0x3E, 0xFF, 0xD0, 0xA2, 0x34, 0xB3, 0xD4, 0xCB, 0xD5, 0xD3, 0x0B, 0x6A, 0x0E, 0x82, 0xF1, 0x81, 0xCC, 0x79, 0x2F, 0x7A, 0x4E, 0x82, 0x0F, 0x7A, 0xAC, 0x69, 0x91, 0x82, 0xD4, 0x92, 0x0A, 0x51, 0xD4, 0x9A, 0x0F, 0x72, 0x8C, 0x59, 0x15, 0x9B, 0x50, 0x82, 0xAB, 0x61, 0xA9, 0x59, 0xEC, 0x61, 0x31, 0x82, 0x56, 0xAB, 0x89, 0x51,
+    0x4D, 0x72, 0xCD, 0x69, 0x6E, 0x82, 0xF5, 0x9A, 0x8A, 0x51, 0xAB, 0x59, 0xB0, 0x8A, 0x6E, 0x72, 0xD4, 0x92, 0x2D, 0x72, 0x4D, 0x72, 0xD1, 0x8A, 0xAF, 0x82, 0x13, 0x93, 0xF2, 0x92, 0x8F, 0x82, 0x2A, 0x49, 0xC7, 0x30, 0x08, 0x39, 0xC4, 0x30, 0xC7, 0x38, 0x4E, 0x6A, 0xA6, 0x38, 0xA7, 0x30, 0x25, 0x39, 0xC6, 0x38, 0x4C, 0x72, 0xA5, 0x30, 0x06, 0x39, 0xC5, 0x38, 0xAC, 0x61, 0xD1, 0x82,
+    0x06, 0x39, 0x27, 0x39, 0xC5, 0x38, 0xEE, 0x61, 0xCF, 0x69, 0xCC, 0x59, 0xAB, 0x51, 0x8A, 0x38, 0x96, 0x8A, 0x70, 0x69, 0x4C, 0x59, 0x91, 0x61, 0x98, 0x92, 0x0C, 0x49, 0x9A, 0xBB, 0x55, 0x8A, 0x7B, 0xB3, 0xF3, 0x79, 0xD5, 0xA2, 0x58, 0xDC, 0x5E, 0xFE, 0xD6, 0xD3, 0x0E, 0x7A, 0x57, 0xB3, 0x38, 0xD4, 0x93, 0x92, 0x2C, 0x7A, 0x16, 0xCC, 0x31, 0x92, 0xB1, 0xA2, 0x69, 0x51, 0xEE, 0x8A,
+    0x90, 0xA2, 0xEA, 0x69, 0x96, 0xAB, 0x6D, 0x61, 0x56, 0xA3, 0xEA, 0x48, 0x8C, 0x61, 0xCF, 0x69, 0xD0, 0x81, 0x6C, 0x59, 0x8A, 0x59, 0x8C, 0x61, 0xF0, 0x81, 0xAC, 0x61, 0x6B, 0x51, 0x6A, 0x51, 0x93, 0xB3, 0x54, 0xA3, 0xAC, 0x61, 0x32, 0x9B, 0xAC, 0x61, 0xAC, 0x61, 0x95, 0xAB, 0xED, 0x69, 0xED, 0x69, 0x6C, 0x72, 0x4C, 0x72, 0x12, 0x9B, 0xD0, 0x8A, 0x6E, 0x82, 0x2D, 0x72, 0x8E, 0x82,
+    0xA4, 0x28, 0x47, 0x41, 0xCD, 0x61, 0xC8, 0x30, 0xE7, 0x30, 0xD5, 0xCC, 0xE7, 0x38, 0x4E, 0x72, 0xA6, 0x30, 0xA6, 0x30, 0x68, 0x49, 0xA4, 0x30, 0xEB, 0x61, 0xC6, 0x30, 0x48, 0x49, 0x8A, 0x51, 0x27, 0x41, 0x08, 0x41, 0x27, 0x41, 0x28, 0x41, 0x70, 0x72, 0x6F, 0x61, 0x48, 0x49, 0x08, 0x49, 0x4D, 0x51, 0x96, 0x8A, 0x4F, 0x61, 0x79, 0xBC, 0x0C, 0x49, 0xB4, 0x69, 0xCF, 0x71, 0xD1, 0x81,
+    0x13, 0x82, 0x51, 0x69, 0x35, 0xAB, 0x14, 0xA3, 0x7F, 0xFD, 0x56, 0xBB, 0x8D, 0x61, 0xF3, 0x71, 0xDE, 0xEC, 0x75, 0x92, 0xCB, 0x79, 0x31, 0xD3, 0xF4, 0xEC, 0x34, 0xC3, 0xCA, 0x61, 0x88, 0x59, 0x2B, 0x7A, 0xC9, 0x61, 0xD3, 0xA2, 0x77, 0xA3, 0xCD, 0x61, 0x4A, 0x49, 0x30, 0x82, 0x53, 0x92, 0xAC, 0x61, 0x6C, 0x59, 0xCD, 0x69, 0x97, 0xB3, 0x6B, 0x59, 0xCA, 0x61, 0x8A, 0x51, 0x51, 0xAB,
+    0xD3, 0x9A, 0x8C, 0x61, 0xF0, 0x92, 0x6E, 0x7A, 0x8A, 0x59, 0x31, 0xAB, 0xEB, 0x61, 0x4B, 0x72, 0x2A, 0x62, 0x2D, 0x72, 0x8F, 0x82, 0x93, 0xAB, 0xAF, 0x82, 0x8E, 0x82, 0xAE, 0x82, 0xAF, 0x8A, 0xC6, 0x30, 0xA6, 0x30, 0xC6, 0x30, 0xC7, 0x30, 0xEE, 0x61, 0x2D, 0x62, 0xC7, 0x30, 0xE7, 0x38, 0x48, 0x49, 0x6F, 0x72, 0xA6, 0x30, 0x28, 0x41, 0xE6, 0x38, 0x8E, 0x82, 0x27, 0x41, 0x0B, 0x62,
+    0x26, 0x39, 0xC7, 0x30, 0x4F, 0x7A, 0xE7, 0x40, 0xCB, 0x59, 0xC9, 0x38, 0xB5, 0x92, 0x6B, 0x51, 0x4B, 0x51, 0x38, 0x9B, 0xCF, 0x58, 0x12, 0x7A, 0x0D, 0x49, 0xB8, 0x8A, 0x51, 0x9A, 0x36, 0xB3, 0x15, 0x9B, 0xB9, 0x92, 0xCE, 0x79, 0x56, 0x71, 0x97, 0x9A, 0x7F, 0xED, 0x71, 0x61, 0x99, 0x79, 0x5C, 0xC6, 0x1E, 0x7A, 0x2D, 0x8A, 0x18, 0xFD, 0xB7, 0xE5, 0x14, 0xBB, 0xC8, 0x61, 0x2F, 0xA3,
+    0xD0, 0x92, 0xD1, 0xAA, 0x6B, 0x51, 0xB1, 0x82, 0x8C, 0x61, 0x2A, 0x51, 0x56, 0xB3, 0x2F, 0x72, 0x6B, 0x59, 0x17, 0xC4, 0x10, 0x8A, 0xAC, 0x61, 0x8C, 0x69, 0xEC, 0x71, 0x56, 0xBC, 0x34, 0xB3, 0xAC, 0x61, 0x0B, 0x72, 0x87, 0x51, 0x50, 0xAB, 0x0C, 0x6A, 0x0B, 0x6A, 0xE9, 0x61, 0xEA, 0x69, 0xAC, 0x71, 0x31, 0x93, 0x8E, 0x7A, 0xCF, 0x8A, 0x10, 0x93, 0x10, 0x9B, 0xCE, 0x8A, 0xAE, 0x8A,
+    0xA6, 0x28, 0xE8, 0x38, 0xE7, 0x30, 0xC7, 0x30, 0xC7, 0x30, 0x66, 0x30, 0x0E, 0x62, 0xE8, 0x38, 0x8E, 0x72, 0x06, 0x39, 0x4E, 0x72, 0xA7, 0x30, 0xA7, 0x30, 0x68, 0x49, 0xCF, 0x8A, 0x68, 0x49, 0xC6, 0x30, 0xE5, 0x30, 0xF3, 0x92, 0xEE, 0x69, 0x89, 0x51, 0x27, 0x49, 0xCA, 0x48, 0x55, 0x8A, 0x29, 0x49, 0x72, 0x8A, 0xED, 0x48, 0xF8, 0xA2, 0xAC, 0x40, 0xED, 0x48, 0x33, 0x82, 0x31, 0x82,
+    0x31, 0x69, 0x55, 0x92, 0x12, 0x7A, 0xF1, 0x81, 0x3B, 0xBB, 0x56, 0xA3, 0x8D, 0x61, 0x6F, 0x61, 0x7A, 0xBB, 0xF2, 0x79, 0xEC, 0x79, 0x11, 0xC3, 0x4D, 0xB2, 0x2C, 0x82, 0x0A, 0x6A, 0x67, 0x51, 0x0D, 0x7A, 0x33, 0xA3, 0xEE, 0x69, 0x6B, 0x59, 0xAD, 0x61, 0x36, 0xB3, 0x90, 0x92, 0x33, 0x93, 0xB2, 0x8A, 0xD4, 0x9A, 0xCE, 0x79, 0x0E, 0x72, 0xEE, 0x71, 0xCD, 0x71, 0xD5, 0xC3, 0x2D, 0x7A,
+    0xA9, 0x61, 0xCB, 0x69, 0x33, 0xAB, 0xE9, 0x61, 0xE8, 0x61, 0xE9, 0x61, 0xBD, 0xFF, 0xAA, 0x61, 0xE9, 0x61, 0x2B, 0x72, 0xF0, 0x92, 0x52, 0xA3, 0xF0, 0x92, 0xF0, 0x92, 0x0C, 0x7A, 0xAE, 0x8A, 0xA6, 0x28, 0xC7, 0x30, 0x86, 0x30, 0xE7, 0x30, 0xA7, 0x30, 0x45, 0x28, 0xE5, 0x30, 0xE7, 0x38, 0x08, 0x49, 0xE8, 0x38, 0xC6, 0x38, 0x06, 0x39, 0xA6, 0x30, 0xAB, 0x59, 0xC5, 0x38, 0xE7, 0x40,
+    0xE6, 0x38, 0x05, 0x39, 0x89, 0x51, 0xC7, 0x38, 0x4B, 0x51, 0xCA, 0x59, 0x26, 0x41, 0xCE, 0x61, 0x13, 0x72, 0x8C, 0x59, 0x34, 0xB4, 0x52, 0x7A, 0xD8, 0x92, 0x0A, 0x49, 0x4F, 0x59, 0xAE, 0x61, 0xF1, 0x79, 0x6C, 0x61, 0x6E, 0x61, 0x6E, 0x61, 0xF9, 0xAA, 0xD3, 0x92, 0x50, 0x7A, 0x4E, 0x59, 0x1D, 0xDC, 0x4B, 0x59, 0xEA, 0x69, 0x2D, 0x82, 0x2F, 0x9A, 0x4C, 0x7A, 0xA9, 0x61, 0x35, 0xCD,
+    0xEE, 0x81, 0xEC, 0x69, 0x88, 0x59, 0x4B, 0x59, 0x15, 0xA3, 0xCA, 0x48, 0x91, 0x82, 0xEE, 0x69, 0x9C, 0xEC, 0x33, 0x7A, 0x13, 0x7A, 0xF0, 0x79, 0x12, 0xB3, 0x4D, 0x9A, 0x6B, 0x8A, 0x2D, 0x82, 0xED, 0x79, 0xEA, 0x69, 0xA8, 0x59, 0x0A, 0x6A, 0xE9, 0x69, 0xE9, 0x69, 0x29, 0x6A, 0x29, 0x6A, 0xCD, 0x8A, 0x0A, 0x72, 0xCF, 0x92, 0x31, 0x9B, 0x31, 0x9B, 0x8F, 0x8A, 0xAF, 0x8A, 0x6E, 0x7A,
+    0x86, 0x28, 0xE7, 0x38, 0xE8, 0x38, 0x2D, 0x6A, 0xA7, 0x30, 0xCC, 0x59, 0x08, 0x39, 0xC7, 0x30, 0x89, 0x59, 0xD0, 0x92, 0xCB, 0x59, 0x29, 0x41, 0x65, 0x28, 0xC6, 0x38, 0x77, 0xD4, 0xEC, 0x61, 0x06, 0x39, 0xE5, 0x38, 0xEA, 0x61, 0xF0, 0x71, 0x54, 0x82, 0x91, 0x82, 0x88, 0x51, 0xC7, 0x40, 0x0C, 0x49, 0x34, 0x82, 0x4C, 0x51, 0xB5, 0xB3, 0x3A, 0xBC, 0x10, 0x72, 0xB2, 0x9A, 0xB0, 0x82,
+    0xEA, 0x48, 0xCB, 0x48, 0x0B, 0x51, 0x56, 0x8A, 0xD4, 0x79, 0xB1, 0x92, 0x8A, 0x59, 0x2B, 0x49, 0xB4, 0xA2, 0x90, 0x82, 0xA8, 0x59, 0xAF, 0x8A, 0xAC, 0x79, 0x6C, 0x69, 0x95, 0xB3, 0x6E, 0x82, 0x0C, 0x72, 0xA9, 0x59, 0x31, 0xAB, 0x93, 0x9A, 0x4D, 0x59, 0x4B, 0x49, 0x1E, 0xDD, 0x9D, 0xBB, 0xD7, 0x9A, 0x58, 0x92, 0xFF, 0xE7, 0x1F, 0xFE, 0x76, 0xEC, 0xFB, 0xFF, 0xFF, 0xFF, 0x4B, 0x92,
+    0x50, 0xA3, 0x73, 0xB3, 0x57, 0xED, 0x72, 0xB3, 0x09, 0x72, 0x29, 0x6A, 0x54, 0xCC, 0x50, 0xAB, 0x32, 0xCC, 0xB8, 0xFE, 0x10, 0xD4, 0x12, 0xA3, 0xB3, 0x8A, 0x5F, 0x9D, 0xB7, 0xB3, 0x36, 0xCC, 0xC4, 0x30, 0xE8, 0x38, 0x2E, 0x72, 0xEC, 0x59, 0xE7, 0x38, 0x46, 0x41, 0xE6, 0x38, 0xEC, 0x69, 0xAB, 0x59, 0xE8, 0x38, 0xA8, 0x51, 0xA8, 0x51, 0x6F, 0x82, 0xE8, 0x40, 0x8E, 0x7A, 0x29, 0x49,
+    0x89, 0x49, 0x90, 0x82, 0xA9, 0x59, 0xEB, 0x61, 0x0B, 0x49, 0x0E, 0x51, 0x0D, 0x6A, 0x28, 0x49, 0x47, 0x49, 0xCB, 0x40, 0xB7, 0x9A, 0x4C, 0x51, 0xCE, 0x69, 0x6D, 0x59, 0x6B, 0x59, 0xF1, 0xA2, 0x08, 0x49, 0xB3, 0x8A, 0x6F, 0x69, 0xD1, 0x69, 0x8D, 0x61, 0x4F, 0x82, 0xAB, 0x61, 0x2A, 0x51, 0x14, 0xAB, 0x89, 0x59, 0xC9, 0x59, 0x2A, 0x51, 0x09, 0x49, 0x72, 0x92, 0x4B, 0x59, 0x71, 0x7A,
+    0xEC, 0x69, 0xB4, 0xBB, 0x55, 0xB3, 0x4F, 0x7A, 0x2C, 0x51, 0xF5, 0x92, 0x9B, 0xBB, 0xF2, 0x81, 0x8F, 0x71, 0xFE, 0xCD, 0xDD, 0x79, 0x78, 0xC3, 0x59, 0xFE, 0xFF, 0xFF, 0xD2, 0xF4, 0xD1, 0xBB, 0x13, 0xAB, 0x53, 0xBB, 0xA9, 0x61, 0x0A, 0x8A, 0x8E, 0x8A, 0x92, 0xBB, 0x2C, 0x72, 0x0D, 0xA3, 0xDF, 0xFF, 0x8F, 0xA2, 0x71, 0xAB, 0x39, 0xA3, 0xD6, 0x8A, 0xD3, 0x92, 0xF1, 0x92, 0xF1, 0x9A,
+    0xE7, 0x30, 0xE7, 0x38, 0xC7, 0x38, 0xC7, 0x30, 0x8B, 0x59, 0x49, 0x49, 0xC7, 0x38, 0xA6, 0x30, 0x8A, 0x51, 0x4E, 0x72, 0x4A, 0x49, 0xCB, 0x59, 0xCA, 0x59, 0xCA, 0x59, 0xAB, 0x59, 0xE8, 0x40, 0x08, 0x41, 0xC9, 0x59, 0xC8, 0x48, 0xC6, 0x38, 0x0B, 0x62, 0xA7, 0x38, 0x0F, 0x51, 0xF5, 0x9A, 0x49, 0x51, 0xE9, 0x40, 0x7A, 0xC4, 0x75, 0x8A, 0x2C, 0x51, 0x8A, 0x38, 0x4B, 0x51, 0x90, 0x9A,
+    0x4A, 0x59, 0xCC, 0x61, 0xEA, 0x48, 0xB0, 0x69, 0xF4, 0x79, 0xD2, 0x71, 0x10, 0x72, 0xE8, 0x48, 0xF3, 0xA2, 0xA9, 0x51, 0x8C, 0x7A, 0x2A, 0x51, 0x8C, 0x61, 0xF4, 0xA2, 0x07, 0x41, 0x29, 0x49, 0x8C, 0x61, 0xD3, 0x9A, 0x6C, 0x59, 0xEE, 0x69, 0x4D, 0x59, 0xF7, 0xAA, 0xB1, 0x71, 0x52, 0x82, 0xF0, 0x79, 0x94, 0x9A, 0xFC, 0xF4, 0xF1, 0xA2, 0x0E, 0xAB, 0x0F, 0xBB, 0x57, 0xE4, 0xEC, 0x79,
+    0xCB, 0x69, 0xAF, 0x8A, 0x55, 0xDC, 0x59, 0xF6, 0x8F, 0xA3, 0x4A, 0x72, 0x71, 0xBB, 0x6F, 0x8A, 0x6C, 0x82, 0x0B, 0x72, 0x51, 0x9B, 0xF4, 0xBB, 0x31, 0x9B, 0x3B, 0xEE, 0x11, 0x9B, 0x92, 0xB3, 0xC7, 0x30, 0xC8, 0x30, 0x69, 0x49, 0xE8, 0x38, 0x29, 0x41, 0xA6, 0x30, 0xE7, 0x38, 0xE8, 0x40, 0x49, 0x49, 0x08, 0x39, 0x07, 0x39, 0xAA, 0x51, 0x8B, 0x51, 0x4A, 0x49, 0x69, 0x49, 0x0B, 0x62,
+    0x8E, 0x7A, 0x0D, 0x62, 0xE6, 0x38, 0x2C, 0x6A, 0x8F, 0x82, 0x27, 0x41, 0x29, 0x49, 0x30, 0x72, 0x94, 0x82, 0x0A, 0x49, 0x4D, 0x51, 0xF0, 0x71, 0x55, 0x82, 0x2D, 0x51, 0xEC, 0x40, 0x08, 0x41, 0xCF, 0x8A, 0xAD, 0x61, 0x8C, 0x59, 0x0D, 0x51, 0x76, 0x8A, 0xD0, 0x71, 0x4D, 0x51, 0x4C, 0x51, 0x91, 0x8A, 0x68, 0x51, 0x89, 0x51, 0x68, 0x51, 0x0C, 0x59, 0xCA, 0x61, 0x27, 0x41, 0x07, 0x49,
+    0xF0, 0x79, 0x4B, 0x51, 0x6C, 0x51, 0x6E, 0x61, 0xD4, 0x79, 0x71, 0x61, 0xF5, 0x71, 0xD5, 0x79, 0x7E, 0xFD, 0xF6, 0xDB, 0x13, 0xFD, 0x52, 0xC3, 0x13, 0xB3, 0x6E, 0x8A, 0x4C, 0x7A, 0xE9, 0x79, 0xEC, 0x81, 0x6C, 0x82, 0xC8, 0x61, 0xF9, 0xFD, 0x09, 0x72, 0xC8, 0x69, 0x2A, 0x72, 0x31, 0xB4, 0xD1, 0xB3, 0x69, 0x61, 0x51, 0x9B, 0x92, 0xAB, 0x91, 0xB3, 0x90, 0xAB, 0xAF, 0x9A, 0xD0, 0x92,
+    0x08, 0x39, 0xC7, 0x30, 0x49, 0x49, 0xE7, 0x30, 0x49, 0x41, 0xE7, 0x38, 0x08, 0x39, 0x6A, 0x49, 0x08, 0x39, 0xE7, 0x38, 0x29, 0x41, 0xE9, 0x40, 0x49, 0x49, 0x48, 0x49, 0x2C, 0x62, 0x0D, 0x62, 0xE7, 0x38, 0xA8, 0x51, 0x07, 0x49, 0x28, 0x49, 0xCA, 0x59, 0xE8, 0x40, 0x89, 0x38, 0x6B, 0x51, 0x0A, 0x41, 0x72, 0x72, 0x11, 0x6A, 0x6D, 0x51, 0x6D, 0x51, 0xF2, 0x69, 0xEB, 0x40, 0x4C, 0x51,
+    0x8E, 0x72, 0x49, 0x51, 0x8C, 0x51, 0x8A, 0x51, 0xD3, 0x69, 0x4E, 0x59, 0x8E, 0x59, 0x0B, 0x49, 0xD4, 0x8A, 0xAB, 0x61, 0x4A, 0x51, 0x29, 0x49, 0x4C, 0x59, 0xA9, 0x59, 0xE6, 0x40, 0xF5, 0x8A, 0xAD, 0x69, 0xE8, 0x40, 0x30, 0x72, 0x5C, 0x7A, 0xB1, 0x69, 0x3A, 0x59, 0xBE, 0xEF, 0xBE, 0xD4, 0x94, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xDB, 0xAF, 0xA2, 0xD3, 0xBB, 0xCB, 0x71, 0xE9, 0x69,
+    0x2D, 0x7A, 0xB2, 0xB3, 0xD5, 0xD4, 0xAF, 0xA3, 0xEE, 0x9A, 0x0D, 0x8B, 0xCD, 0x82, 0xAD, 0x8A, 0x92, 0x9B, 0x8E, 0x8A, 0x91, 0xA3, 0x35, 0xDD, 0x78, 0xF6, 0xFF, 0xFF, 0xB3, 0xBB, 0xFE, 0xE7, 0xE7, 0x30, 0xE7, 0x38, 0xAB, 0x51, 0xD2, 0x92, 0x50, 0x7A, 0x08, 0x41, 0x08, 0x41, 0x4D, 0x6A, 0x07, 0x41, 0xD1, 0x8A, 0x08, 0x39, 0xC7, 0x38, 0x29, 0x49, 0xA7, 0x38, 0x92, 0x8A, 0x89, 0x51,
+    0xE7, 0x38, 0x8B, 0x51, 0x08, 0x41, 0x2A, 0x49, 0x37, 0xA3, 0x29, 0x49, 0x07, 0x41, 0x6B, 0x51, 0x4C, 0x51, 0xB4, 0x92, 0x0B, 0x49, 0x10, 0x6A, 0x96, 0xA3, 0xAC, 0x61, 0x53, 0x82, 0x6C, 0x59, 0x4F, 0x7A, 0x28, 0x49, 0x4B, 0x51, 0xB3, 0x92, 0x6C, 0x51, 0xF3, 0x79, 0x2C, 0x49, 0xE8, 0x48, 0xD2, 0x92, 0x8A, 0x59, 0x6C, 0x59, 0x2D, 0x59, 0xEB, 0x71, 0x2E, 0x7A, 0xCD, 0x71, 0xEC, 0x69,
+    0xAB, 0x61, 0xA9, 0x40, 0x8E, 0x69, 0xD5, 0x9A, 0xD0, 0x69, 0x16, 0x82, 0xB8, 0x69, 0x77, 0x8A, 0x76, 0xCB, 0x76, 0xFD, 0x4F, 0xD3, 0xB3, 0xCB, 0x0E, 0x82, 0x34, 0xAB, 0xB2, 0x9A, 0x92, 0xAB, 0xAE, 0x8A, 0x11, 0xA3, 0x0C, 0x7A, 0x10, 0xA3, 0x08, 0x6A, 0x6E, 0x9B, 0x94, 0xD4, 0x2C, 0x72, 0xD1, 0x92, 0x28, 0x59, 0x51, 0xA3, 0x77, 0xED, 0x8C, 0x8A, 0xF0, 0x9A, 0x2D, 0x82, 0xCF, 0x92,
+    0x05, 0x39, 0x8C, 0x51, 0x08, 0x49, 0x55, 0x6A, 0x69, 0x51, 0x26, 0x41, 0x97, 0xC4, 0x0C, 0x6A, 0x8D, 0x72, 0x4E, 0x7A, 0x26, 0x41, 0xC6, 0x38, 0x90, 0x82, 0x68, 0x51, 0x8B, 0x59, 0xA9, 0x40, 0x49, 0x51, 0x70, 0x8A, 0x27, 0x49, 0x69, 0x51, 0x2C, 0x51, 0xD2, 0x81, 0x72, 0x8A, 0x49, 0x49, 0x2A, 0x41, 0x31, 0x8B, 0xD2, 0x9A, 0xAE, 0x61, 0xCF, 0x61, 0xEF, 0x61, 0x4A, 0x51, 0x53, 0x8A,
+    0xEB, 0x48, 0xEA, 0x40, 0x0E, 0x6A, 0x29, 0x49, 0x70, 0x82, 0x0A, 0x49, 0x0A, 0x41, 0x49, 0x49, 0xF3, 0x9A, 0xA9, 0x59, 0xEB, 0x40, 0x2A, 0x49, 0xCA, 0x61, 0x72, 0x8A, 0x27, 0x49, 0x48, 0x51, 0xCB, 0x61, 0x9A, 0xD4, 0x11, 0x82, 0xAD, 0x59, 0x6D, 0x61, 0x91, 0x69, 0x5A, 0xBB, 0xD6, 0xA2, 0x0F, 0x8A, 0xF1, 0xB2, 0x16, 0xE4, 0x95, 0xCB, 0xCC, 0x79, 0xCC, 0x69, 0xCC, 0x69, 0xF5, 0xCB,
+    0x11, 0xAB, 0x4D, 0x82, 0xEC, 0x69, 0x98, 0xAB, 0x2C, 0x82, 0xCC, 0x92, 0x6B, 0x82, 0x30, 0xB4, 0xB3, 0xB3, 0xEE, 0x79, 0x8D, 0x82, 0x30, 0xA3, 0xCA, 0x71, 0x92, 0xB3, 0xAB, 0x69, 0xF1, 0xA2, 0x08, 0x39, 0x29, 0x41, 0xC7, 0x38, 0x09, 0x41, 0x27, 0x41, 0x48, 0x41, 0x89, 0x51, 0x48, 0x49, 0x4D, 0x6A, 0xEB, 0x61, 0x26, 0x41, 0x0B, 0x6A, 0xAA, 0x61, 0x28, 0x49, 0xE8, 0x48, 0xAC, 0x61,
+    0xB0, 0x8A, 0xA9, 0x59, 0xEC, 0x69, 0xD4, 0x9A, 0x51, 0x82, 0xEE, 0x69, 0xAE, 0x61, 0xED, 0x50, 0xB5, 0x92, 0x2D, 0x59, 0x2D, 0x6A, 0x69, 0x51, 0x4A, 0x61, 0x8D, 0x59, 0x0B, 0x49, 0x2A, 0x49, 0xB4, 0x8A, 0x8A, 0x38, 0xCF, 0x61, 0x49, 0x51, 0x72, 0x82, 0x6C, 0x61, 0x0A, 0x41, 0x2A, 0x41, 0x96, 0xA3, 0x6B, 0x51, 0xAF, 0x61, 0x29, 0x49, 0x4C, 0x59, 0xCF, 0x8A, 0x28, 0x49, 0x8E, 0x7A,
+    0xD0, 0x71, 0x0A, 0x49, 0x8C, 0x59, 0x12, 0x72, 0x73, 0x71, 0xB6, 0x69, 0x5B, 0x59, 0x7A, 0x9A, 0x9D, 0xFD, 0x73, 0xF4, 0xFF, 0xFF, 0x10, 0xC3, 0xB1, 0xA2, 0x2E, 0x7A, 0xEC, 0x71, 0xBA, 0xED, 0xAF, 0x92, 0xAB, 0x79, 0x8A, 0x61, 0x18, 0xED, 0x4B, 0x8A, 0x86, 0x61, 0x69, 0x7A, 0xAD, 0x82, 0xB2, 0xAB, 0x14, 0xB4, 0xD3, 0xAB, 0x12, 0xC4, 0x8F, 0xBB, 0xDB, 0xFF, 0x2C, 0x8A, 0xF6, 0x9A,
+    0xE8, 0x38, 0x08, 0x39, 0x08, 0x39, 0x08, 0x41, 0xE8, 0x38, 0x08, 0x39, 0x09, 0x41, 0xC7, 0x38, 0x28, 0x41, 0x29, 0x49, 0x27, 0x41, 0xC6, 0x38, 0x28, 0x49, 0x27, 0x41, 0x06, 0x41, 0xAA, 0x59, 0x49, 0x51, 0xEA, 0x61, 0xAB, 0x59, 0xCB, 0x61, 0x8D, 0x61, 0xED, 0x69, 0x2F, 0x6A, 0xCA, 0x48, 0xEB, 0x40, 0x0B, 0x49, 0x8F, 0x61, 0x2C, 0x51, 0x2B, 0x51, 0x52, 0x9B, 0xD1, 0x69, 0xCB, 0x40,
+    0x6B, 0x51, 0x8C, 0x59, 0xCE, 0x69, 0xA9, 0x38, 0x0A, 0x49, 0x0C, 0x51, 0x0A, 0x41, 0xEB, 0x40, 0xEB, 0x61, 0x6C, 0x51, 0xEC, 0x48, 0x69, 0x51, 0xF0, 0xA2, 0x0E, 0x8B, 0x27, 0x49, 0x8E, 0x61, 0xBE, 0xF5, 0x6B, 0x59, 0xF2, 0x71, 0x55, 0x61, 0x77, 0xAB, 0x3C, 0x8A, 0xBA, 0x59, 0xDA, 0x79, 0x8E, 0xA2, 0xFF, 0xFF, 0xB8, 0xF6, 0xD3, 0xDB, 0x53, 0xB3, 0x32, 0xA3, 0xEC, 0x71, 0x0D, 0x82,
+    0xF4, 0xC3, 0x0A, 0x72, 0x0A, 0x6A, 0xCC, 0x8A, 0x10, 0xBC, 0x08, 0x6A, 0xCB, 0x82, 0xCE, 0x8A, 0x6D, 0x82, 0x50, 0x93, 0xD2, 0xB3, 0xBA, 0xF6, 0x11, 0xD4, 0xF1, 0xC3, 0xEC, 0x81, 0xB2, 0x9A, 0xAB, 0x51, 0xE7, 0x38, 0x28, 0x41, 0x08, 0x39, 0x08, 0x41, 0xE8, 0x38, 0xC7, 0x38, 0xC8, 0x38, 0xE8, 0x38, 0xA7, 0x38, 0x29, 0x41, 0xCC, 0x61, 0xC8, 0x48, 0xEC, 0x61, 0xE9, 0x40, 0xF0, 0x8A,
+    0x8C, 0x61, 0x4A, 0x59, 0x92, 0xA3, 0x48, 0x51, 0x69, 0x59, 0x6B, 0x59, 0x8D, 0x59, 0x2A, 0x49, 0x0A, 0x49, 0x0C, 0x51, 0x6D, 0x59, 0x0C, 0x49, 0x2D, 0x51, 0x2C, 0x51, 0xEC, 0x48, 0xCA, 0x40, 0xAA, 0x40, 0x0B, 0x49, 0xB2, 0x82, 0xEA, 0x40, 0x2C, 0x49, 0xE9, 0x40, 0xEA, 0x38, 0xEB, 0x40, 0x0B, 0x41, 0xAE, 0x59, 0xCA, 0x40, 0x0A, 0x49, 0xCA, 0x59, 0x69, 0x49, 0x27, 0x41, 0xC6, 0x38,
+    0x47, 0x49, 0x27, 0x49, 0x29, 0x51, 0x2B, 0x49, 0x2F, 0x6A, 0xB0, 0x69, 0xB1, 0x61, 0x70, 0x69, 0x53, 0xAB, 0xED, 0xB2, 0x10, 0xB3, 0x0C, 0x7A, 0xCC, 0x71, 0xC9, 0x61, 0xCC, 0x69, 0x2E, 0x93, 0x4E, 0x9B, 0x09, 0x72, 0x0A, 0x6A, 0x4A, 0x72, 0x2A, 0x72, 0x49, 0x72, 0x6A, 0x7A, 0xC7, 0x61, 0x0C, 0x8B, 0x6F, 0x93, 0x71, 0xA3, 0xB1, 0xAB, 0x91, 0xAB, 0x71, 0xAB, 0x6A, 0x61, 0xAF, 0x92,
+    0x6A, 0x49, 0x08, 0x39, 0x08, 0x41, 0x08, 0x41, 0xC7, 0x38, 0x08, 0x41, 0x69, 0x51, 0x69, 0x51, 0x07, 0x41, 0xAB, 0x59, 0x28, 0x41, 0xEC, 0x61, 0x49, 0x51, 0xCB, 0x61, 0x0A, 0x51, 0x69, 0x51, 0x2D, 0x72, 0x49, 0x51, 0x2C, 0x72, 0x2B, 0x51, 0x2C, 0x59, 0x2A, 0x59, 0x4B, 0x59, 0x0B, 0x51, 0x2C, 0x51, 0x3F, 0xF5, 0x8D, 0x59, 0x2C, 0x51, 0x4D, 0x51, 0x6D, 0x59, 0x0A, 0x51, 0xED, 0x69,
+    0x0C, 0x51, 0x4D, 0x51, 0xAE, 0x61, 0x2B, 0x49, 0xEF, 0x69, 0xAA, 0x38, 0xEA, 0x40, 0xE8, 0x38, 0x2A, 0x49, 0xAE, 0x61, 0x0C, 0x49, 0x0C, 0x49, 0x6C, 0x51, 0xAA, 0x59, 0x49, 0x49, 0xE8, 0x40, 0x8A, 0x51, 0x26, 0x49, 0x31, 0xA3, 0xAB, 0x69, 0x8D, 0x61, 0xCE, 0x61, 0xAF, 0x61, 0xB5, 0x71, 0xB3, 0x9A, 0x6E, 0x8A, 0x6E, 0x8A, 0xAC, 0x71, 0xDC, 0xF5, 0xDD, 0xF5, 0x30, 0x82, 0x10, 0x9B,
+    0x70, 0xB3, 0x14, 0xED, 0x8C, 0x92, 0x0F, 0x9B, 0xAA, 0x82, 0xAB, 0x82, 0xD0, 0xB3, 0x86, 0x59, 0xAF, 0x8A, 0xCE, 0x82, 0x4D, 0x7A, 0x38, 0xD5, 0xB1, 0xAB, 0xAF, 0x92, 0xA8, 0x61, 0x4C, 0x82, 0x47, 0x49, 0xAB, 0x61, 0x28, 0x49, 0x0E, 0x72, 0xC6, 0x38, 0x70, 0x82, 0x50, 0x82, 0x69, 0x51, 0xD3, 0x92, 0xF4, 0x79, 0xAA, 0x48, 0xB2, 0x81, 0xF5, 0x9A, 0x4E, 0x61, 0xDA, 0xCB, 0xD9, 0xA2,
+    0x72, 0x71, 0x94, 0x9A, 0xD6, 0x9A, 0x18, 0xC3, 0x92, 0x79, 0xD2, 0x79, 0xB7, 0xA2, 0xB5, 0xA2, 0xB6, 0xCB, 0x6D, 0x71, 0x30, 0x8A, 0x4E, 0x92, 0x51, 0x8A, 0xA9, 0x69, 0x09, 0x51, 0xD7, 0xE4, 0x70, 0xAB, 0x2A, 0x59, 0x6D, 0x59, 0x89, 0x59, 0x30, 0x7A, 0xCB, 0x48, 0xE9, 0x38, 0x68, 0x30, 0x53, 0xA3, 0x4A, 0x59, 0x0B, 0x41, 0x6B, 0x51, 0x2E, 0x72, 0x0B, 0x51, 0x66, 0x49, 0xAF, 0x82,
+    0xF3, 0x92, 0x12, 0xA3, 0x2B, 0x51, 0x17, 0x9B, 0xD0, 0x81, 0xAF, 0x79, 0x12, 0x82, 0x1A, 0xCC, 0xEF, 0x89, 0x54, 0xBB, 0xB3, 0xA2, 0x5B, 0xDD, 0xFA, 0xA2, 0x9C, 0x82, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xFD, 0x71, 0xB3, 0xDB, 0xFE, 0xFF, 0xFF, 0xD0, 0xC3, 0x8B, 0x79, 0x75, 0xAB, 0xDF, 0xCE, 0xD4, 0x9A, 0xB3, 0xB3, 0xF3, 0xC3, 0x93, 0xB3, 0x93, 0xB3, 0x11, 0xA3,
+    0x08, 0x41, 0x09, 0x41, 0x08, 0x41, 0x09, 0x41, 0x08, 0x41, 0x08, 0x41, 0x0C, 0x62, 0xCC, 0x61, 0x69, 0x51, 0xA9, 0x59, 0x68, 0x49, 0x88, 0x51, 0x49, 0x51, 0x48, 0x51, 0x6A, 0x51, 0x6A, 0x59, 0xCC, 0x61, 0x4C, 0x59, 0x4D, 0x59, 0x0B, 0x51, 0x92, 0x8A, 0x2B, 0x51, 0xEF, 0x71, 0xB0, 0x69, 0x6B, 0x59, 0x0C, 0x7A, 0xA9, 0x61, 0xA9, 0x61, 0xC9, 0x61, 0xCA, 0x61, 0x6B, 0x59, 0xEF, 0x69,
+    0x4A, 0x51, 0x4A, 0x49, 0xAE, 0x61, 0x2C, 0x49, 0xEE, 0x61, 0xCA, 0x38, 0x0A, 0x41, 0x89, 0x30, 0x0B, 0x41, 0x4B, 0x49, 0x0B, 0x41, 0xEA, 0x40, 0x6B, 0x51, 0x8D, 0x51, 0x08, 0x41, 0xC5, 0x30, 0x07, 0x41, 0x69, 0x51, 0x48, 0x49, 0x08, 0x49, 0x6B, 0x51, 0xAF, 0x61, 0x4A, 0x51, 0x91, 0xBC, 0x8B, 0x61, 0xAB, 0x61, 0x8F, 0x8A, 0x6B, 0x59, 0xF2, 0x69, 0x53, 0x59, 0x15, 0x82, 0xEE, 0xA2,
+    0x10, 0xDC, 0x0D, 0xB3, 0x8B, 0x82, 0xCC, 0x8A, 0xAD, 0x8A, 0xED, 0x92, 0xCC, 0x8A, 0xA8, 0x59, 0xF0, 0x82, 0x10, 0x8B, 0x8A, 0x61, 0x71, 0x9B, 0xAE, 0x8A, 0xCE, 0x8A, 0x6D, 0x7A, 0x6C, 0x82, 0x09, 0x41, 0x29, 0x41, 0x2A, 0x41, 0x29, 0x41, 0x49, 0x49, 0x29, 0x49, 0x29, 0x49, 0x4A, 0x51, 0x2E, 0x72, 0x49, 0x51, 0x49, 0x51, 0x6A, 0x59, 0x49, 0x51, 0x4A, 0x51, 0xCB, 0x61, 0x8C, 0x61,
+    0xCB, 0x69, 0x4C, 0x72, 0x2B, 0x59, 0x10, 0x72, 0x11, 0x7A, 0x6E, 0x61, 0x2E, 0x61, 0x6F, 0x61, 0xAD, 0x61, 0x6C, 0x8A, 0x2B, 0x82, 0x4D, 0x8A, 0x6C, 0x61, 0x8E, 0x61, 0x6D, 0x59, 0x30, 0x72, 0x8E, 0x61, 0x0C, 0x49, 0x4D, 0x51, 0x2C, 0x49, 0x8D, 0x59, 0x0B, 0x49, 0x09, 0x41, 0xA6, 0x28, 0x2A, 0x41, 0x2B, 0x49, 0x2B, 0x41, 0x0B, 0x41, 0x2C, 0x49, 0x2C, 0x49, 0x0A, 0x49, 0xA9, 0x30,
+    0xA6, 0x30, 0x69, 0x49, 0x08, 0x41, 0xC7, 0x38, 0x88, 0x51, 0x88, 0x51, 0x67, 0x51, 0x87, 0x51, 0xA8, 0x59, 0x0A, 0x6A, 0x2A, 0x6A, 0x87, 0x51, 0x69, 0x51, 0x49, 0x51, 0x4C, 0x72, 0xCC, 0x8A, 0xAC, 0x8A, 0xC9, 0x61, 0x6C, 0x7A, 0xA9, 0x59, 0x0B, 0x6A, 0x2A, 0x6A, 0x4A, 0x6A, 0xE8, 0x61, 0xAB, 0x7A, 0xEE, 0x82, 0xCA, 0x61, 0x2F, 0x93, 0x4F, 0x9B, 0xED, 0x92, 0xAB, 0x82, 0x6A, 0x7A,
+    0x09, 0x41, 0x2A, 0x49, 0xCC, 0x61, 0x4A, 0x49, 0x49, 0x49, 0x6A, 0x51, 0x49, 0x51, 0x2A, 0x51, 0xAA, 0x61, 0xEC, 0x69, 0x6B, 0x59, 0x8F, 0x8A, 0x4A, 0x51, 0x8D, 0x61, 0xB2, 0x8A, 0x30, 0x7A, 0xEF, 0x79, 0xD3, 0x92, 0x0F, 0x61, 0xDA, 0xBB, 0x33, 0x8A, 0x6F, 0x61, 0xB7, 0x79, 0xB6, 0x71, 0xD3, 0x81, 0x8F, 0xAA, 0xF3, 0xEC, 0x0F, 0xC3, 0xCA, 0x71, 0x92, 0xAB, 0x8C, 0x61, 0x71, 0xA3,
+    0x0C, 0x72, 0x4C, 0x51, 0x4C, 0x59, 0x2B, 0x49, 0x50, 0x7A, 0x2C, 0x49, 0x09, 0x41, 0xA8, 0x30, 0x0B, 0x41, 0x6D, 0x59, 0xEA, 0x38, 0x4C, 0x49, 0x2C, 0x49, 0x0B, 0x49, 0x4A, 0x49, 0xE7, 0x38, 0x09, 0x41, 0x8A, 0x51, 0xAA, 0x51, 0x28, 0x49, 0x49, 0x51, 0x89, 0x59, 0x67, 0x49, 0x67, 0x51, 0x06, 0x49, 0x88, 0x51, 0x88, 0x59, 0x87, 0x51, 0x87, 0x59, 0x87, 0x51, 0xC8, 0x61, 0x8B, 0x7A,
+    0x89, 0x59, 0x68, 0x51, 0xEB, 0x61, 0xA9, 0x59, 0xCA, 0x61, 0x2B, 0x6A, 0xE9, 0x61, 0x09, 0x62, 0xAB, 0x7A, 0x0D, 0x83, 0xCD, 0x82, 0x4E, 0x93, 0x0E, 0x93, 0xAB, 0x82, 0xCC, 0x8A, 0xAB, 0x82, 0x68, 0x51, 0x8A, 0x59, 0x69, 0x59, 0xD0, 0x92, 0x8B, 0x61, 0xB1, 0x92, 0x6B, 0x59, 0xA9, 0x48, 0x2D, 0x61, 0x52, 0x92, 0x11, 0x7A, 0xB2, 0x81, 0x34, 0x8A, 0x39, 0xAB, 0xF7, 0xAA, 0x35, 0x92,
+    0xD2, 0x89, 0x1B, 0xB3, 0x37, 0xB3, 0x59, 0xC3, 0x5A, 0xC3, 0x37, 0xB3, 0x9E, 0xA3, 0xBF, 0xFF, 0x36, 0xA2, 0xB5, 0xD3, 0xFF, 0xFF, 0x55, 0xFC, 0x3F, 0xFF, 0xD1, 0xBB, 0x2A, 0x82, 0xCF, 0x9A, 0x8C, 0x8A, 0x51, 0x9B, 0xCA, 0x48, 0x46, 0x51, 0xD0, 0x92, 0xD2, 0x8A, 0x09, 0x41, 0x87, 0x28, 0x6C, 0x7A, 0x8B, 0x59, 0x0B, 0x49, 0xCA, 0x61, 0x0A, 0x6A, 0x8E, 0x82, 0x28, 0x49, 0x87, 0x51,
+    0x91, 0x9B, 0xAE, 0x8A, 0x72, 0xAB, 0x48, 0x51, 0xB0, 0x8A, 0x4B, 0x59, 0xB3, 0x92, 0x96, 0xB3, 0xAD, 0x71, 0x32, 0xA3, 0xD2, 0xA2, 0x51, 0x9B, 0x3D, 0xFE, 0x13, 0xA3, 0x15, 0xA3, 0x6C, 0x71, 0xB0, 0x92, 0xAD, 0x92, 0x8D, 0x92, 0x87, 0x71, 0x3B, 0xFF, 0x86, 0x61, 0x8F, 0xAB, 0xF1, 0xBB, 0xED, 0x92, 0xD1, 0xB3, 0xAE, 0x82, 0x8C, 0x8A, 0xF0, 0x92, 0x30, 0xA3, 0xE9, 0x69, 0x0E, 0x93,
+    0x6D, 0x82, 0x09, 0x51, 0x0B, 0x72, 0xEA, 0x48, 0xB2, 0x92, 0x4C, 0x59, 0x4C, 0x59, 0x6C, 0x61, 0x6D, 0x69, 0xD7, 0xC3, 0x6E, 0x69, 0xF1, 0x79, 0x12, 0x82, 0x0E, 0x82, 0xBB, 0xF5, 0x32, 0x8A, 0x9D, 0xDC, 0x32, 0x82, 0x96, 0xA2, 0xD3, 0x81, 0x9F, 0xFE, 0xB2, 0x81, 0x74, 0x92, 0x12, 0x8A, 0x2F, 0x8A, 0xD2, 0xAA, 0x8E, 0x9A, 0x2B, 0x82, 0xC9, 0x71, 0x6F, 0xA3, 0xAB, 0x69, 0x0A, 0x72,
+    0xCA, 0x69, 0x48, 0x51, 0x6A, 0x59, 0x46, 0x51, 0x0B, 0x6A, 0x0A, 0x49, 0x08, 0x41, 0x0A, 0x41, 0x69, 0x51, 0x8B, 0x51, 0x2C, 0x49, 0x4B, 0x51, 0x4A, 0x51, 0x26, 0x49, 0x27, 0x49, 0x4B, 0x49, 0xA7, 0x30, 0x89, 0x51, 0x87, 0x51, 0xE6, 0x40, 0x48, 0x49, 0xCA, 0x61, 0x47, 0x49, 0xC9, 0x59, 0x69, 0x59, 0xEB, 0x69, 0x2B, 0x6A, 0x47, 0x49, 0x67, 0x51, 0xCA, 0x69, 0x47, 0x51, 0x47, 0x49,
+    0x67, 0x51, 0x26, 0x41, 0x67, 0x49, 0x67, 0x51, 0x88, 0x51, 0xC9, 0x59, 0x67, 0x51, 0x28, 0x62, 0x49, 0x6A, 0x8A, 0x72, 0xEC, 0x82, 0xAB, 0x82, 0x29, 0x6A, 0x4A, 0x72, 0xCB, 0x82, 0xAA, 0x7A, 0x0B, 0x6A, 0x8A, 0x59, 0xAA, 0x59, 0xCA, 0x61, 0x93, 0xA3, 0x8A, 0x59, 0xAC, 0x61, 0xEE, 0x71, 0xAD, 0x69, 0xCF, 0x79, 0x6D, 0x69, 0x0F, 0x82, 0x16, 0xCC, 0x34, 0xA3, 0x8D, 0x79, 0x12, 0x8A,
+    0x52, 0x92, 0x13, 0x8A, 0x78, 0xBB, 0xD3, 0x81, 0xB3, 0x79, 0x94, 0xA2, 0xD5, 0xD3, 0xB4, 0xD3, 0xF0, 0xAA, 0x36, 0xCC, 0x6F, 0x92, 0xA8, 0x69, 0xE9, 0x69, 0x6B, 0x82, 0x6C, 0x7A, 0x0B, 0x72, 0xE9, 0x69, 0x8B, 0x61, 0xE7, 0x48, 0x2C, 0x6A, 0x77, 0xC4, 0xE8, 0x48, 0x28, 0x41, 0xE9, 0x40, 0x0B, 0x41, 0xEE, 0x61, 0x0B, 0x41, 0x6D, 0x51, 0x0B, 0x51, 0xEA, 0x40, 0x8B, 0x51, 0xCA, 0x40,
+    0xA6, 0x38, 0x8B, 0x51, 0x2E, 0x72, 0x48, 0x51, 0x08, 0x49, 0x4A, 0x51, 0x49, 0x49, 0x48, 0x49, 0x69, 0x59, 0x8D, 0x72, 0x6D, 0x72, 0x28, 0x49, 0x48, 0x49, 0x48, 0x49, 0x07, 0x49, 0x07, 0x39, 0x89, 0x51, 0x48, 0x49, 0x07, 0x41, 0x68, 0x49, 0x68, 0x49, 0x89, 0x51, 0x68, 0x49, 0xEA, 0x59, 0x4A, 0x6A, 0x8A, 0x6A, 0xCB, 0x7A, 0x8A, 0x7A, 0xAB, 0x7A, 0x8A, 0x7A, 0x8A, 0x7A, 0x69, 0x72,
+    0xB5, 0x71, 0xB5, 0x61, 0x1D, 0x62, 0x33, 0x9B, 0x54, 0xBB, 0x6E, 0x61, 0xF0, 0x71, 0x36, 0xA3, 0x8F, 0x71, 0x93, 0x9A, 0xD7, 0xC3, 0x14, 0x8A, 0x94, 0xA2, 0x95, 0x9A, 0xD4, 0xAA, 0x74, 0xA2, 0x15, 0xBB, 0xD7, 0xA2, 0x3D, 0xCC, 0xFC, 0x8B, 0x9F, 0xD4, 0xFD, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xE4, 0x71, 0xB3, 0x99, 0xED, 0xB2, 0xC3, 0x0A, 0x7A, 0xAA, 0x71, 0xCF, 0x92, 0x2A, 0x7A,
+    0xA9, 0x69, 0x09, 0x7A, 0xAC, 0x8A, 0x2F, 0xA3, 0xC9, 0x61, 0x48, 0x59, 0x4A, 0x49, 0xEB, 0x40, 0x0D, 0x6A, 0x0C, 0x72, 0x0E, 0x72, 0x6B, 0x51, 0xE7, 0x48, 0x6B, 0x51, 0xCE, 0x82, 0xEC, 0x61, 0x28, 0x49, 0xCA, 0x59, 0x0C, 0x6A, 0x69, 0x51, 0xE7, 0x40, 0x8A, 0x59, 0x4D, 0x6A, 0x07, 0x41, 0xCB, 0x61, 0x8E, 0x7A, 0xCA, 0x59, 0x27, 0x49, 0x28, 0x49, 0xEE, 0x82, 0x07, 0x41, 0x6D, 0x6A,
+    0x68, 0x49, 0xEA, 0x59, 0x27, 0x41, 0x68, 0x51, 0x89, 0x51, 0xEA, 0x59, 0x89, 0x51, 0xC9, 0x59, 0x6A, 0x6A, 0xAA, 0x72, 0xAA, 0x72, 0x6A, 0x72, 0x8A, 0x7A, 0xAA, 0x7A, 0x49, 0x72, 0x6A, 0x72, 0x31, 0x61, 0xD3, 0x71, 0xCF, 0x69, 0x3A, 0xED, 0xCF, 0x71, 0x90, 0x71, 0x8F, 0x69, 0xF2, 0x81, 0x96, 0x9A, 0x11, 0x8A, 0x95, 0xA2, 0x7B, 0xC3, 0xF9, 0xBA, 0x5A, 0xCB, 0x33, 0xCB, 0x79, 0xF4,
+    0xB8, 0xF4, 0x7F, 0xFD, 0xDB, 0xB2, 0xDD, 0x89, 0xBF, 0xE3, 0x1F, 0xFF, 0x14, 0xFC, 0xB4, 0xFC, 0x54, 0xEC, 0x9F, 0xFF, 0xED, 0x81, 0xED, 0x89, 0x1F, 0xFE, 0xC9, 0x71, 0x9A, 0xFE, 0x47, 0x59, 0xAE, 0xA2, 0x87, 0x59, 0x27, 0x49, 0x6C, 0x7A, 0xD0, 0x92, 0x29, 0x51, 0xC8, 0x38, 0x2A, 0x41, 0xCD, 0x8A, 0xCB, 0x61, 0x4C, 0x51, 0x4A, 0x51, 0xA9, 0x61, 0x09, 0x41, 0xCC, 0x59, 0x28, 0x41,
+    0x8C, 0x7A, 0x8A, 0x51, 0x0C, 0x6A, 0x2A, 0x6A, 0xEE, 0x8A, 0xCE, 0x8A, 0x26, 0x41, 0x05, 0x41, 0xCC, 0x8A, 0x88, 0x61, 0xA7, 0x51, 0x25, 0x41, 0xA7, 0x59, 0x2B, 0x6A, 0x45, 0x41, 0x46, 0x49, 0x50, 0xA3, 0xEC, 0x8A, 0x46, 0x49, 0x47, 0x51, 0x50, 0x9B, 0xC8, 0x61, 0xED, 0x82, 0xC8, 0x51, 0xC8, 0x59, 0x6A, 0x72, 0x49, 0x6A, 0xEC, 0x82, 0xC7, 0x61, 0xE8, 0x61, 0xAA, 0x7A, 0x8A, 0x7A,
+    0xEE, 0x71, 0xAE, 0x69, 0xCD, 0x69, 0xB3, 0x9A, 0xD5, 0x9A, 0xD6, 0xA2, 0x52, 0x8A, 0x8F, 0x71, 0x9F, 0xFE, 0x70, 0x71, 0x93, 0xA2, 0xD7, 0xCB, 0x38, 0xE4, 0xD6, 0xFC, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xFE, 0xBE, 0xF5, 0x55, 0x9A, 0x34, 0x92, 0x9D, 0xE4, 0xD7, 0xE3, 0xD0, 0xBA, 0xBB, 0xFE, 0x0F, 0x8A, 0x56, 0xBB, 0x0F, 0x8A, 0xAB, 0x69, 0xA8, 0x69, 0x6D, 0x82, 0x13, 0xA3,
+    0x0A, 0x72, 0xA8, 0x61, 0x07, 0x51, 0xCA, 0x61, 0x52, 0xA3, 0x6A, 0x59, 0xE8, 0x38, 0x0A, 0x41, 0x91, 0xB3, 0x4D, 0x72, 0x6D, 0x59, 0xF3, 0x8A, 0x68, 0x51, 0x4D, 0x7A, 0xEC, 0x61, 0xC9, 0x38, 0xA6, 0x38, 0x8B, 0x72, 0xCF, 0x8A, 0xAB, 0x59, 0xE7, 0x40, 0xC8, 0x59, 0xB0, 0x8A, 0x8D, 0x82, 0xC6, 0x40, 0x6C, 0x72, 0x05, 0x41, 0x0E, 0x93, 0xDB, 0xED, 0xC9, 0x51, 0xA7, 0x51, 0x04, 0x39,
+    0xAD, 0x8A, 0x4B, 0x7A, 0x27, 0x41, 0x07, 0x49, 0xCE, 0x92, 0x04, 0x41, 0xC8, 0x61, 0x86, 0x51, 0xE8, 0x59, 0x8B, 0x82, 0x6A, 0x72, 0x8A, 0x7A, 0x69, 0x72, 0x49, 0x6A, 0x28, 0x6A, 0xAB, 0x7A, 0x56, 0xAB, 0xD1, 0x79, 0xD0, 0x71, 0x34, 0x8A, 0x7B, 0xDC, 0x16, 0xA3, 0x72, 0x69, 0xB1, 0x71, 0xF8, 0xAA, 0xBE, 0xFD, 0xD4, 0xB2, 0x9B, 0xBB, 0xD4, 0xB2, 0x96, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xD8, 0xF4, 0xF7, 0xB2, 0xFD, 0xAA, 0x3F, 0xF5, 0x18, 0xBB, 0x93, 0xD3, 0x97, 0xFE, 0xF3, 0xDB, 0x77, 0xBB, 0x70, 0x92, 0x95, 0xAB, 0x6D, 0x61, 0x6E, 0x69, 0x54, 0xAB, 0x6B, 0x61, 0x6D, 0x82, 0xC9, 0x71, 0x87, 0x61, 0xEC, 0x71, 0xEA, 0x69, 0x68, 0x61, 0xE8, 0x38, 0x0B, 0x49, 0x6D, 0x7A, 0xCD, 0x8A, 0xAD, 0x61, 0x4E, 0x72, 0x6A, 0x61, 0xE9, 0x69, 0x54, 0xBC, 0x2B, 0x49,
+    0xA6, 0x38, 0x89, 0x59, 0x4B, 0x6A, 0x31, 0x9B, 0xE7, 0x40, 0xEC, 0x61, 0xE6, 0x38, 0x25, 0x41, 0xEE, 0x8A, 0x8A, 0x51, 0x29, 0x49, 0x89, 0x51, 0xC9, 0x59, 0x8C, 0x82, 0x48, 0x49, 0xAA, 0x51, 0x06, 0x41, 0x88, 0x51, 0x2A, 0x72, 0x89, 0x59, 0x47, 0x41, 0x88, 0x51, 0x06, 0x41, 0x86, 0x51, 0x2D, 0x9B, 0x2A, 0x62, 0x29, 0x62, 0xA8, 0x59, 0xE7, 0x59, 0xAC, 0x82, 0x09, 0x62, 0x49, 0x6A,
+    0xFF, 0xDF, 0xB3, 0x79, 0x53, 0x82, 0xF3, 0x89, 0x76, 0x92, 0x74, 0xA2, 0xB2, 0x79, 0xB2, 0x79, 0x1A, 0xD4, 0xD2, 0x79, 0x9E, 0xF5, 0x56, 0x9A, 0x58, 0xBB, 0x7C, 0xFD, 0xDD, 0xFE, 0xBC, 0xFD, 0xFC, 0xFC, 0x96, 0xAA, 0x3F, 0xED, 0xFF, 0xFF, 0x3B, 0x9A, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xEC, 0xEE, 0x89, 0xBB, 0xDC, 0xD5, 0xBB, 0xAB, 0x69, 0x3D, 0xFE, 0x94, 0xBB, 0x2A, 0x7A,
+    0x54, 0xC4, 0x68, 0x69, 0xE9, 0x71, 0x66, 0x51, 0x68, 0x61, 0x06, 0x51, 0x0A, 0x41, 0x0B, 0x41, 0x6D, 0x7A, 0x4B, 0x72, 0x4B, 0x51, 0xA9, 0x59, 0x8A, 0x59, 0x4A, 0x51, 0x4C, 0x72, 0x4D, 0x72, 0xC7, 0x38, 0x2B, 0x49, 0xEF, 0x82, 0x4C, 0x72, 0xC8, 0x38, 0x49, 0x49, 0x49, 0x49, 0x8A, 0x59, 0xEB, 0x61, 0xAA, 0x59, 0x8A, 0x51, 0xAA, 0x59, 0x89, 0x51, 0x27, 0x49, 0xAA, 0x59, 0x68, 0x49,
+    0x06, 0x39, 0xCA, 0x51, 0x4C, 0x6A, 0x68, 0x49, 0x27, 0x41, 0xEA, 0x59, 0x27, 0x41, 0x68, 0x49, 0x88, 0x51, 0xEA, 0x59, 0xE9, 0x59, 0x2A, 0x62, 0x29, 0x62, 0x08, 0x62, 0x49, 0x6A, 0x2A, 0x6A, 0xB2, 0xA2, 0x92, 0x9A, 0x51, 0x8A, 0x33, 0x8A, 0x91, 0x79, 0x58, 0xBB, 0xB6, 0x9A, 0x92, 0x71, 0x35, 0x92, 0xD2, 0x79, 0x39, 0xBB, 0xF5, 0x91, 0x7C, 0xCB, 0x18, 0xBB, 0x95, 0xA2, 0xD6, 0xB2,
+    0x3D, 0xEC, 0xF9, 0xAA, 0x38, 0x8A, 0x9C, 0xBB, 0x7B, 0xCB, 0x13, 0x92, 0x11, 0xB3, 0x93, 0xC3, 0x98, 0xDC, 0xEF, 0x79, 0x8D, 0x71, 0x54, 0xA3, 0x59, 0xEC, 0xEC, 0x89, 0x4D, 0x8A, 0x6C, 0x8A, 0x36, 0xBB, 0x8C, 0x82, 0x71, 0xA3, 0x46, 0x51, 0xD4, 0xC3, 0x67, 0x59, 0x2C, 0x49, 0x2A, 0x49, 0xED, 0x8A, 0x4C, 0x72, 0x2B, 0x49, 0xAB, 0x59, 0x0A, 0x72, 0x49, 0x49, 0xAF, 0x7A, 0x49, 0x49,
+    0x8C, 0x7A, 0x4E, 0x72, 0x76, 0xBC, 0xCA, 0x59, 0xCD, 0x82, 0xAA, 0x61, 0x28, 0x41, 0x07, 0x41, 0x8B, 0x59, 0xEB, 0x71, 0x07, 0x39, 0xA9, 0x51, 0x28, 0x49, 0xE5, 0x40, 0xC9, 0x59, 0xC9, 0x51, 0x6D, 0x72, 0x48, 0x49, 0x07, 0x39, 0x67, 0x49, 0xAF, 0x7A, 0x27, 0x41, 0x27, 0x41, 0x68, 0x49, 0x68, 0x49, 0x0B, 0x62, 0xE9, 0x59, 0x09, 0x62, 0xA7, 0x51, 0x2A, 0x6A, 0xA8, 0x59, 0xA8, 0x51,
+    0x52, 0xCB, 0xB0, 0xDB, 0x0F, 0xBB, 0x73, 0x9A, 0xF1, 0x81, 0x99, 0xCB, 0x38, 0xB3, 0xB1, 0x79, 0xF4, 0x89, 0xF8, 0xAA, 0x5E, 0xE5, 0xB7, 0xA2, 0x36, 0x8A, 0x19, 0xBB, 0xBE, 0xD3, 0xBD, 0xAA, 0x78, 0x79, 0x17, 0x82, 0x9B, 0xCB, 0xB8, 0x9A, 0xFB, 0xA2, 0x15, 0x92, 0x36, 0x9A, 0x1E, 0xFF, 0x99, 0xA2, 0xD1, 0x71, 0x11, 0x82, 0x76, 0xC3, 0xAB, 0x79, 0xAD, 0xAA, 0x91, 0xF4, 0x5E, 0xFE,
+    0xEE, 0x81, 0x0A, 0x72, 0xF5, 0xB3, 0x67, 0x51, 0x73, 0xB3, 0x67, 0x59, 0x0E, 0x6A, 0x2A, 0x49, 0x4F, 0x9B, 0xD5, 0xE4, 0x4C, 0x51, 0x14, 0xC4, 0x87, 0x59, 0x6E, 0x82, 0x93, 0xA3, 0x8C, 0x61, 0xE6, 0x40, 0xCE, 0x92, 0x51, 0x93, 0x29, 0x49, 0x28, 0x49, 0xCD, 0x82, 0x12, 0x93, 0x89, 0x51, 0xA8, 0x61, 0xE6, 0x40, 0xAF, 0x82, 0x08, 0x41, 0x09, 0x41, 0x28, 0x49, 0x4E, 0x72, 0x26, 0x41,
+    0xE7, 0x30, 0x06, 0x39, 0x06, 0x39, 0x2F, 0x9B, 0xC4, 0x38, 0x27, 0x41, 0x06, 0x39, 0x2C, 0x72, 0x06, 0x41, 0x88, 0x49, 0x68, 0x49, 0x26, 0x41, 0xC9, 0x59, 0x4B, 0x6A, 0x09, 0x62, 0x09, 0x62, 0xD6, 0xFD, 0xFF, 0xFF, 0xDA, 0xFE, 0x16, 0xDC, 0x52, 0x9A, 0x6F, 0x92, 0xDD, 0xE4, 0xD6, 0xA2, 0xB1, 0x81, 0x13, 0x82, 0xF6, 0xAA, 0xBE, 0xDC, 0xB7, 0xA2, 0x1E, 0xDC, 0xDB, 0x81, 0x9F, 0xD5,
+    0xFF, 0xFF, 0x1E, 0xE5, 0xD6, 0x79, 0x1D, 0xAB, 0x3E, 0xCC, 0x7C, 0xBB, 0x9B, 0x9A, 0x3B, 0xB3, 0x3E, 0xEC, 0xB4, 0x92, 0x1E, 0xAB, 0x7B, 0x8A, 0x0D, 0x8A, 0x59, 0xFF, 0xFF, 0xFF, 0xB4, 0xD3, 0xAD, 0x9A, 0x35, 0xED, 0xF1, 0xB3, 0x2B, 0x7A, 0xB4, 0xB3, 0x69, 0x61, 0xCC, 0x61, 0x4A, 0x51, 0xBF, 0xFE, 0x0F, 0x93, 0x2A, 0x51, 0xAA, 0x61, 0x48, 0x59, 0x0F, 0x93, 0x0B, 0x6A, 0xEB, 0x61,
+    0x07, 0x41, 0x4B, 0x72, 0x0F, 0x93, 0x6A, 0x59, 0xE8, 0x38, 0xA9, 0x59, 0x4A, 0x6A, 0xAF, 0x8A, 0x28, 0x41, 0x69, 0x51, 0xE6, 0x38, 0xEB, 0x69, 0x6D, 0x7A, 0x6A, 0x49, 0xAB, 0x51, 0x47, 0x41, 0x0B, 0x6A, 0x2D, 0x72, 0x06, 0x39, 0x06, 0x39, 0x47, 0x41, 0xAD, 0x7A, 0x68, 0x59, 0x68, 0x49, 0x06, 0x41, 0xA8, 0x51, 0x8B, 0x7A, 0xC5, 0x38, 0xCA, 0x59, 0xC9, 0x59, 0xE9, 0x59, 0xC9, 0x59,
+    0xFF, 0xFF, 0xDF, 0xFF, 0x34, 0xFC, 0x30, 0xBB, 0xFF, 0xFF, 0x38, 0xDD, 0xF6, 0xAA, 0x1A, 0xD4, 0x13, 0x82, 0x1F, 0xFF, 0x7F, 0xFE, 0x37, 0x92, 0xB7, 0x9A, 0x9C, 0xC3, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9B, 0x69, 0x1F, 0xD4, 0x95, 0x92, 0x5F, 0xD4, 0x5B, 0xD4, 0x9F, 0xE4, 0xD2, 0x79, 0xDB, 0xDC, 0x99, 0xC3, 0xF7, 0x81, 0x70, 0x69, 0x8F, 0x9A, 0xBC, 0xF5, 0xD7, 0xF4, 0xCD, 0x9A,
+    0x8F, 0xB3, 0xE9, 0x79, 0xAD, 0x82, 0x28, 0x51, 0xCF, 0x92, 0xEB, 0x69, 0x9A, 0x59, 0x49, 0x49, 0x6F, 0x8A, 0xA9, 0x61, 0x0A, 0x49, 0x8A, 0x61, 0x8B, 0x61, 0x66, 0x51, 0x6E, 0x82, 0x0C, 0x6A, 0x2D, 0x72, 0x6A, 0x51, 0xCE, 0x7A, 0x91, 0xA3, 0x2C, 0x6A, 0x2A, 0x49, 0x06, 0x39, 0x29, 0x6A, 0xF0, 0x8A, 0x8C, 0x51, 0xE8, 0x38, 0x07, 0x41, 0x27, 0x41, 0x2E, 0x93, 0x07, 0x41, 0xEC, 0x59,
+    0xC7, 0x30, 0x06, 0x39, 0xAC, 0x82, 0x68, 0x51, 0x06, 0x39, 0x27, 0x41, 0x27, 0x41, 0x8C, 0x7A, 0x0F, 0x93, 0x27, 0x41, 0xC9, 0x51, 0xA4, 0x30, 0xA7, 0x51, 0x8D, 0x82, 0xA9, 0x51, 0xC9, 0x51, 0xD5, 0xFC, 0x71, 0xD3, 0x91, 0xAA, 0x92, 0xA2, 0xD2, 0xA2, 0x52, 0x92, 0x36, 0xAB, 0x7F, 0xFE, 0x19, 0xB3, 0x15, 0x92, 0xF5, 0x91, 0xB7, 0xAA, 0x5A, 0xBB, 0x39, 0xB3, 0xDB, 0x89, 0x3F, 0xB3,
+    0xFF, 0xD3, 0xB4, 0x71, 0xF3, 0x79, 0xF2, 0x79, 0xDB, 0xCB, 0x8F, 0x71, 0xB1, 0x69, 0x11, 0x7A, 0x53, 0x9A, 0xD1, 0x8A, 0x51, 0x7A, 0x8C, 0x69, 0x77, 0xBB, 0x4F, 0xB3, 0x4B, 0x82, 0x4B, 0x82, 0x6F, 0xBB, 0x0A, 0x6A, 0x6C, 0x7A, 0x88, 0x59, 0x10, 0x9B, 0x6D, 0x82, 0x2A, 0x49, 0x4A, 0x49, 0xE9, 0x69, 0x6D, 0x7A, 0x4B, 0x51, 0xCA, 0x61, 0x0B, 0x6A, 0x89, 0x59, 0xB0, 0x82, 0x49, 0x51,
+    0x2A, 0x72, 0xAA, 0x59, 0x8E, 0x7A, 0xAA, 0x59, 0x2B, 0x72, 0x28, 0x49, 0xE9, 0x38, 0xEA, 0x59, 0x69, 0x51, 0x08, 0x41, 0x09, 0x39, 0x49, 0x49, 0xCB, 0x59, 0x07, 0x39, 0xEA, 0x40, 0xC6, 0x30, 0xA9, 0x51, 0x09, 0x39, 0xE8, 0x38, 0x06, 0x39, 0x0B, 0x62, 0x47, 0x41, 0x26, 0x41, 0x47, 0x41, 0x67, 0x49, 0xA8, 0x49, 0x88, 0x49, 0x67, 0x49, 0x68, 0x49, 0xEA, 0x59, 0x89, 0x51, 0xA9, 0x51,
+    0xB4, 0xAA, 0x55, 0x9A, 0x77, 0x9A, 0x54, 0x92, 0x74, 0x9A, 0xD3, 0xB2, 0x5F, 0xFE, 0xDF, 0xFE, 0x94, 0xA2, 0x96, 0xA2, 0x98, 0xAA, 0x39, 0xC3, 0xD7, 0xA2, 0xB6, 0x9A, 0xDE, 0xF5, 0x3F, 0xFE, 0x13, 0x7A, 0xF3, 0x79, 0xB2, 0x71, 0x34, 0x8A, 0xDF, 0xFD, 0x74, 0x8A, 0x90, 0x69, 0x54, 0xBB, 0x4F, 0x8A, 0x8B, 0x61, 0xB1, 0x8A, 0x9E, 0xF5, 0x6F, 0x82, 0xCD, 0x8A, 0x2F, 0x9B, 0x89, 0x69,
+    0x4D, 0x8A, 0x09, 0x6A, 0x0B, 0x6A, 0x09, 0x6A, 0xF1, 0x92, 0x10, 0x93, 0x4B, 0x51, 0x69, 0x49, 0xAD, 0x8A, 0x73, 0xBC, 0x4B, 0x51, 0x0B, 0x6A, 0x2A, 0x72, 0x8D, 0x7A, 0x4C, 0x72, 0xCB, 0x61, 0x47, 0x51, 0x4F, 0x9B, 0xCE, 0x8A, 0xEC, 0x61, 0x48, 0x49, 0x2C, 0x72, 0x2A, 0x49, 0x6B, 0x51, 0x27, 0x49, 0x68, 0x49, 0x8D, 0x7A, 0xE9, 0x38, 0x8B, 0x51, 0x6C, 0x6A, 0x0C, 0x62, 0xA8, 0x30,
+    0x09, 0x39, 0xE6, 0x30, 0xE6, 0x38, 0xA5, 0x38, 0x28, 0x41, 0x88, 0x49, 0x26, 0x39, 0xAE, 0x7A, 0x47, 0x41, 0x88, 0x49, 0x88, 0x49, 0xC9, 0x51, 0x88, 0x49, 0x88, 0x51, 0xC9, 0x59, 0x88, 0x51, 0xF6, 0x89, 0x97, 0x71, 0x38, 0x8A, 0x5C, 0xC3, 0xF6, 0xBA, 0xD3, 0xDB, 0x5E, 0xFE, 0xD8, 0xFC, 0x7D, 0xEC, 0x14, 0xBB, 0xD5, 0xDB, 0xF5, 0xE3, 0x59, 0xEC, 0x5F, 0xFE, 0x3C, 0xD4, 0x3F, 0xFF,
+    0x34, 0x82, 0x1A, 0xB3, 0x77, 0x92, 0x74, 0x8A, 0x57, 0xA3, 0x54, 0x8A, 0xB9, 0xA2, 0x12, 0x82, 0xF0, 0x71, 0xAE, 0x69, 0xFB, 0xA2, 0x56, 0xAB, 0xCB, 0x69, 0x4F, 0x8A, 0x0D, 0x7A, 0x54, 0xB3, 0x6B, 0x7A, 0xF2, 0xBB, 0x2B, 0x72, 0x87, 0x59, 0x11, 0x9B, 0x75, 0xCC, 0x6C, 0x51, 0x89, 0x51, 0x8E, 0x82, 0xE9, 0x69, 0xCB, 0x61, 0x0B, 0x72, 0xED, 0x8A, 0x50, 0xA3, 0xB1, 0xAB, 0x0B, 0x6A,
+    0xEA, 0x69, 0xE8, 0x69, 0xF2, 0xB3, 0x0C, 0x6A, 0x68, 0x51, 0x88, 0x51, 0xAE, 0x8A, 0x28, 0x49, 0x6A, 0x51, 0x68, 0x49, 0x47, 0x49, 0x4D, 0x7A, 0x29, 0x41, 0x07, 0x39, 0x68, 0x51, 0x2C, 0x6A, 0x48, 0x49, 0xA6, 0x28, 0xE6, 0x38, 0x06, 0x39, 0x4B, 0x72, 0x47, 0x41, 0x47, 0x41, 0x27, 0x41, 0x47, 0x41, 0x6C, 0x6A, 0x88, 0x49, 0x68, 0x49, 0xA9, 0x51, 0x68, 0x49, 0xCA, 0x59, 0x88, 0x51,
+    0x5F, 0x71, 0xFF, 0xFF, 0xDE, 0xC5, 0xF8, 0xBA, 0xD6, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xD5, 0xF4, 0xDC, 0xFE, 0xFF, 0xFF, 0xD5, 0xFC, 0x97, 0xC3, 0xFA, 0xAA, 0xDC, 0xD4, 0x3E, 0xCC, 0x92, 0x71, 0x13, 0x7A, 0x95, 0x92, 0x31, 0x7A, 0x1A, 0xA3, 0x97, 0x92, 0xB1, 0x69, 0xB3, 0x69, 0xB8, 0xBB, 0x37, 0xAB, 0x4B, 0x59, 0xCD, 0x69, 0x0E, 0x8A, 0x6C, 0x61, 0x53, 0xA3,
+    0xEF, 0x92, 0x67, 0x59, 0x0A, 0x6A, 0x47, 0x51, 0xCC, 0x71, 0x74, 0xCC, 0x6C, 0x51, 0xA9, 0x59, 0xF1, 0x92, 0xA9, 0x61, 0xAA, 0x61, 0x4C, 0x7A, 0x50, 0xA3, 0xF1, 0xBB, 0x6C, 0x82, 0xAA, 0x61, 0x4D, 0x82, 0xEA, 0x69, 0x91, 0xA3, 0x4C, 0x72, 0x68, 0x51, 0x68, 0x51, 0x26, 0x49, 0xCE, 0x8A, 0xE7, 0x40, 0xE8, 0x40, 0x07, 0x41, 0x2B, 0x62, 0x6E, 0x7A, 0x08, 0x41, 0xC7, 0x38, 0xCA, 0x59,
+    0x06, 0x39, 0x4C, 0x6A, 0x06, 0x39, 0x0B, 0x62, 0x47, 0x41, 0x4B, 0x6A, 0x8D, 0x7A, 0x47, 0x41, 0x47, 0x41, 0x67, 0x41, 0x6C, 0x72, 0x88, 0x49, 0xA9, 0x51, 0x88, 0x49, 0x88, 0x49, 0xA8, 0x51, 0xBF, 0xFF, 0xFF, 0xFF, 0x9E, 0xAA, 0xDB, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xFD, 0xB5, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xB6, 0xE3, 0x56, 0x9A, 0xB7, 0xA2, 0x3F, 0xFE,
+    0x9A, 0xB3, 0x90, 0x69, 0xD0, 0x69, 0x75, 0x82, 0x9E, 0xB3, 0xD8, 0x9A, 0x70, 0x61, 0x54, 0x82, 0x53, 0x92, 0x79, 0xAB, 0xCE, 0x71, 0x31, 0x7A, 0xF0, 0x81, 0xED, 0x69, 0x38, 0xC4, 0xA9, 0x61, 0x50, 0xA3, 0x88, 0x59, 0x87, 0x59, 0x49, 0x59, 0x51, 0xA3, 0x2A, 0x7A, 0x8B, 0x59, 0xC9, 0x59, 0xED, 0x71, 0x67, 0x61, 0xCA, 0x61, 0x0B, 0x72, 0x12, 0xC4, 0x0A, 0x7A, 0xAD, 0xA2, 0xEB, 0x69,
+    0x88, 0x61, 0x89, 0x61, 0xB0, 0xA3, 0x73, 0xC4, 0x47, 0x51, 0x68, 0x51, 0x48, 0x49, 0xC5, 0x40, 0x51, 0x93, 0xE7, 0x38, 0xE8, 0x38, 0x27, 0x41, 0x0B, 0x62, 0xEF, 0x8A, 0x11, 0x83, 0x29, 0x41, 0x47, 0x41, 0xA4, 0x28, 0xEF, 0x8A, 0x05, 0x39, 0x0E, 0x83, 0x06, 0x39, 0x26, 0x41, 0xAD, 0x82, 0x4B, 0x6A, 0x88, 0x49, 0x47, 0x41, 0x67, 0x49, 0x6B, 0x72, 0xEE, 0x82, 0x88, 0x51, 0x88, 0x49,
+    0x1F, 0x8A, 0x9C, 0x9A, 0xB9, 0xAA, 0x1E, 0xF4, 0x98, 0xF5, 0x77, 0xFC, 0x33, 0xC3, 0x1D, 0xE4, 0x55, 0xD3, 0xBA, 0xFE, 0xDA, 0xFE, 0xBC, 0xFC, 0x97, 0xA2, 0xD5, 0x81, 0x37, 0x8A, 0x55, 0x8A, 0xF3, 0x79, 0xB0, 0x69, 0x8F, 0x61, 0x54, 0x82, 0x50, 0x61, 0xB1, 0x69, 0x51, 0x7A, 0xB2, 0x71, 0xB3, 0x71, 0x2E, 0x59, 0x52, 0x82, 0xF1, 0x79, 0xF1, 0x92, 0xCD, 0x69, 0x6E, 0x82, 0xAA, 0x61,
+    0x31, 0xA3, 0x0E, 0x93, 0x2B, 0x72, 0x46, 0x51, 0x32, 0xAB, 0x91, 0xAB, 0x8A, 0x59, 0xCA, 0x61, 0x8C, 0x82, 0x8C, 0x82, 0xCA, 0x69, 0x4D, 0x82, 0x9B, 0xFE, 0x2B, 0x8A, 0x0D, 0xA3, 0x8D, 0x8A, 0xE9, 0x69, 0x4C, 0x7A, 0x6D, 0x82, 0x6D, 0x82, 0x68, 0x51, 0xCA, 0x61, 0xCA, 0x61, 0x07, 0x49, 0x4A, 0x72, 0xAA, 0x59, 0x08, 0x41, 0x09, 0x41, 0x29, 0x41, 0xE6, 0x40, 0xA4, 0x40, 0x09, 0x41,
+    0x08, 0x41, 0xC5, 0x30, 0xC5, 0x30, 0xE8, 0x38, 0x4A, 0x49, 0x68, 0x49, 0x07, 0x39, 0x26, 0x39, 0x47, 0x41, 0x47, 0x41, 0x68, 0x49, 0x27, 0x41, 0x88, 0x49, 0x67, 0x49, 0x67, 0x49, 0xA8, 0x51, 0x98, 0x79, 0x97, 0x71, 0x57, 0x92, 0xFF, 0xC3, 0xB8, 0xAA, 0x5B, 0xC3, 0xB8, 0xA2, 0x78, 0x9A, 0x98, 0xAA, 0xD9, 0xBA, 0x3A, 0xCB, 0xD9, 0xAA, 0x15, 0x8A, 0x75, 0x92, 0xF8, 0xB2, 0x79, 0x8A,
+    0xB1, 0x69, 0xB0, 0x61, 0x54, 0x8A, 0x99, 0x8A, 0x4F, 0x59, 0x8F, 0x61, 0x34, 0x82, 0x6F, 0x69, 0x90, 0x61, 0x8D, 0x61, 0x8D, 0x61, 0xEE, 0x79, 0xEA, 0x69, 0x70, 0x8A, 0xCA, 0x69, 0xF2, 0xAB, 0x0A, 0x72, 0x70, 0xA3, 0x0A, 0x72, 0xA8, 0x61, 0x73, 0xA3, 0x73, 0xCC, 0xAB, 0x61, 0xEB, 0x69, 0xCE, 0x8A, 0xEA, 0x71, 0xEB, 0x71, 0x4D, 0x8A, 0xFB, 0xFE, 0xF2, 0xD3, 0x0E, 0xB3, 0x2A, 0x82,
+    0x09, 0x72, 0x2A, 0x7A, 0xEE, 0x8A, 0x4C, 0x7A, 0xA9, 0x59, 0x2A, 0x6A, 0xF0, 0x8A, 0x07, 0x49, 0x06, 0x49, 0xE5, 0x38, 0x6D, 0x72, 0x48, 0x41, 0xE8, 0x38, 0xC7, 0x30, 0x68, 0x49, 0x69, 0x49, 0x8A, 0x49, 0xE6, 0x38, 0x6C, 0x6A, 0xEA, 0x61, 0x8A, 0x51, 0x29, 0x41, 0x26, 0x41, 0x6C, 0x6A, 0x88, 0x49, 0x27, 0x41, 0x88, 0x49, 0x67, 0x49, 0x88, 0x49, 0x67, 0x49, 0x88, 0x51, 0x87, 0x49,
+    0x94, 0x69, 0xB6, 0x79, 0xF5, 0x79, 0x5D, 0x92, 0x16, 0x82, 0x98, 0x81, 0xBC, 0x81, 0xBD, 0x81, 0x9F, 0xC3, 0x19, 0x8A, 0x7F, 0x9A, 0x3E, 0x71, 0x9A, 0x69, 0x3B, 0xAB, 0xF4, 0x79, 0xB2, 0x69, 0xB0, 0x61, 0x33, 0x82, 0x70, 0x61, 0x76, 0x82, 0x50, 0x59, 0x77, 0x92, 0x78, 0xB3, 0x8E, 0x61, 0xF1, 0x69, 0x55, 0xB3, 0xAD, 0x69, 0x8F, 0x82, 0xEB, 0x69, 0x90, 0x8A, 0xCB, 0x69, 0x8C, 0x71,
+    0x4C, 0x7A, 0x09, 0x6A, 0xC8, 0x61, 0xA9, 0x61, 0xEB, 0x71, 0xED, 0x92, 0xCB, 0x61, 0x2D, 0x72, 0x4D, 0x82, 0x0A, 0x72, 0x2C, 0x82, 0x8E, 0x9A, 0xDE, 0xFF, 0xF7, 0xF6, 0x74, 0xF5, 0x0D, 0xAB, 0x6C, 0x8A, 0x0A, 0x7A, 0x6E, 0x82, 0xEB, 0x69, 0x89, 0x61, 0x2C, 0x72, 0x47, 0x51, 0x28, 0x49, 0xAA, 0x59, 0xE6, 0x38, 0xE6, 0x38, 0xCF, 0x82, 0x08, 0x41, 0xC9, 0x38, 0xE8, 0x38, 0x48, 0x51,
+    0xA6, 0x30, 0xA8, 0x30, 0x28, 0x39, 0x88, 0x49, 0x47, 0x49, 0xE9, 0x59, 0x28, 0x41, 0x27, 0x39, 0x47, 0x41, 0x27, 0x41, 0x26, 0x41, 0x88, 0x49, 0x87, 0x49, 0x67, 0x49, 0x26, 0x41, 0x88, 0x49, 0x93, 0x69, 0xDF, 0x9A, 0x3F, 0xB3, 0xD9, 0x81, 0x5C, 0x69, 0xBF, 0x71, 0xFF, 0xFF, 0x1D, 0x6B, 0x1B, 0x69, 0x5D, 0x69, 0xFE, 0x58, 0xFF, 0xFF, 0x9F, 0x50, 0xD7, 0x79, 0x52, 0x61, 0xB2, 0x69,
+    0x9D, 0xB3, 0x70, 0x59, 0x4F, 0x51, 0x90, 0x61, 0xD3, 0x71, 0x59, 0xB3, 0x32, 0x7A, 0x6E, 0x61, 0x8D, 0x69, 0x8D, 0x61, 0xF7, 0xBB, 0xEB, 0x69, 0xAE, 0x79, 0x2B, 0x7A, 0x70, 0x82, 0x4E, 0x82, 0x4E, 0x82, 0x09, 0x6A, 0x09, 0x6A, 0xAB, 0x61, 0xED, 0x71, 0xCD, 0x8A, 0xCB, 0x69, 0x0B, 0x6A, 0xCC, 0x71, 0x4A, 0x7A, 0x4D, 0x82, 0xCC, 0xA2, 0x1B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x6F, 0xCB,
+    0x4D, 0x8A, 0x4B, 0x7A, 0x16, 0xBC, 0x0B, 0x72, 0x68, 0x59, 0x89, 0x59, 0x27, 0x49, 0x50, 0x9B, 0xAB, 0x59, 0xC7, 0x40, 0xE7, 0x38, 0x27, 0x41, 0x8F, 0x7A, 0xC7, 0x30, 0xCF, 0x7A, 0xC8, 0x38, 0xA9, 0x51, 0x4D, 0x72, 0xE8, 0x38, 0xC8, 0x30, 0xA5, 0x30, 0xE5, 0x38, 0x88, 0x51, 0x07, 0x39, 0x28, 0x41, 0x67, 0x41, 0x47, 0x41, 0x4B, 0x6A, 0x67, 0x41, 0x87, 0x49, 0x67, 0x49, 0xA8, 0x51,
+    0xFF, 0xC3, 0xDB, 0x92, 0x77, 0x69, 0x5A, 0x69, 0xFF, 0xC7, 0xFF, 0xFF, 0xDF, 0xDD, 0xFD, 0x89, 0x1D, 0x8A, 0x9D, 0x51, 0xFF, 0xFF, 0x5F, 0xDE, 0xBB, 0x71, 0x17, 0x7A, 0x51, 0x61, 0x9E, 0xB3, 0x90, 0x69, 0x4F, 0x51, 0x2F, 0x51, 0xD4, 0x8A, 0xFC, 0xBB, 0x0F, 0x51, 0x90, 0x69, 0x6D, 0x51, 0x34, 0xA3, 0xDB, 0xDC, 0x8C, 0x61, 0x0B, 0x72, 0x11, 0xA3, 0x8E, 0x8A, 0x3E, 0xFE, 0x2C, 0x82,
+    0x54, 0xBB, 0xCD, 0x92, 0x4B, 0x7A, 0x8B, 0x71, 0x13, 0xAB, 0x4F, 0xA3, 0xCB, 0x69, 0x0B, 0x6A, 0x2F, 0x82, 0x2D, 0x82, 0x2B, 0x82, 0xCD, 0xA2, 0x38, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xDB, 0x0C, 0x82, 0x2B, 0x82, 0x31, 0x9B, 0x1B, 0xE5, 0x66, 0x51, 0xE9, 0x61, 0x28, 0x49, 0x27, 0x49, 0x72, 0x9B, 0xCE, 0x82, 0x08, 0x41, 0x09, 0x39, 0x06, 0x39, 0x8D, 0x7A, 0x0E, 0x62, 0x09, 0x41,
+    0x66, 0x28, 0xC9, 0x59, 0xCF, 0x82, 0xE7, 0x38, 0x28, 0x41, 0x06, 0x39, 0x05, 0x39, 0xEE, 0x8A, 0x48, 0x41, 0x29, 0x41, 0x47, 0x41, 0x47, 0x41, 0x8C, 0x7A, 0xA8, 0x51, 0x87, 0x49, 0x67, 0x49, 0x73, 0x61, 0x94, 0x61, 0x54, 0x59, 0x59, 0x61, 0x3E, 0x38, 0x5F, 0x61, 0x58, 0x61, 0x57, 0x61, 0xBF, 0xB3, 0x1E, 0x40, 0x7F, 0x7A, 0x7C, 0x61, 0x35, 0x59, 0x93, 0x61, 0xF8, 0x9A, 0x70, 0x61,
+    0x70, 0x59, 0xB0, 0x59, 0x2E, 0x51, 0xF4, 0x79, 0x91, 0x59, 0x70, 0x61, 0x6D, 0x61, 0xD6, 0xA2, 0xEC, 0x69, 0xEB, 0x71, 0xCA, 0x61, 0x55, 0xB3, 0xAD, 0x92, 0x4F, 0x8A, 0x4C, 0x82, 0xCE, 0x9A, 0x4E, 0x92, 0x4A, 0x7A, 0x6C, 0x7A, 0x0C, 0x72, 0x95, 0xBB, 0xB1, 0x9A, 0xEB, 0x69, 0x2A, 0x72, 0x4F, 0x8A, 0x0E, 0x82, 0x2B, 0x7A, 0x6D, 0x92, 0x78, 0xE4, 0x58, 0xFD, 0x57, 0xF5, 0x0F, 0xBB,
+    0x4F, 0x8A, 0x33, 0xAB, 0x90, 0xAB, 0x0D, 0x72, 0x67, 0x51, 0x89, 0x59, 0x47, 0x49, 0x68, 0x59, 0x28, 0x49, 0xA7, 0x38, 0x6D, 0x72, 0x48, 0x49, 0xC8, 0x30, 0xA5, 0x28, 0x6A, 0x51, 0x8B, 0x49, 0x87, 0x28, 0xA7, 0x30, 0x68, 0x51, 0xA6, 0x30, 0x29, 0x41, 0xE8, 0x30, 0xA9, 0x51, 0x06, 0x41, 0x29, 0x41, 0x29, 0x41, 0x47, 0x41, 0x47, 0x41, 0x88, 0x49, 0x67, 0x41, 0x67, 0x49, 0x67, 0x49,
+    0x51, 0x51, 0x52, 0x59, 0x32, 0x51, 0x97, 0x71, 0xD9, 0x71, 0xB7, 0x69, 0x55, 0x59, 0x55, 0x59, 0x1A, 0x82, 0xF5, 0x58, 0x98, 0x61, 0x14, 0x51, 0x57, 0x82, 0x19, 0xA3, 0xDC, 0xD4, 0x2F, 0x51, 0xB0, 0x61, 0xD1, 0x61, 0xF3, 0x69, 0x0E, 0x51, 0xF2, 0x69, 0x30, 0x59, 0xB6, 0x9A, 0x8E, 0x61, 0xCA, 0x61, 0x0E, 0x93, 0xED, 0x71, 0x95, 0xB3, 0xEF, 0x9A, 0xAD, 0x92, 0x8F, 0xC3, 0xD9, 0xFD,
+    0xCB, 0xA2, 0x6C, 0x8A, 0x6C, 0x82, 0x0C, 0x7A, 0xD7, 0xC3, 0xB4, 0xBB, 0x2B, 0x72, 0x4B, 0x7A, 0x33, 0xA3, 0xCD, 0x79, 0x2E, 0x82, 0x2F, 0x8A, 0xDF, 0xEC, 0xBC, 0xD3, 0xF6, 0xA2, 0x30, 0x8A, 0x91, 0x8A, 0xAE, 0x71, 0x2F, 0x82, 0xED, 0x61, 0x0C, 0x72, 0x67, 0x51, 0xB0, 0x8A, 0x07, 0x41, 0xC6, 0x40, 0x4B, 0x51, 0x07, 0x39, 0x4D, 0x72, 0x6B, 0x51, 0xA8, 0x30, 0xCD, 0x61, 0xEB, 0x61,
+    0xA8, 0x30, 0xA8, 0x30, 0x08, 0x39, 0xC5, 0x38, 0x0B, 0x6A, 0xE8, 0x30, 0x09, 0x41, 0x28, 0x41, 0xA8, 0x59, 0x28, 0x41, 0x48, 0x41, 0x47, 0x41, 0x46, 0x41, 0xE5, 0x30, 0xA8, 0x51, 0x67, 0x49, 0x30, 0x51, 0x31, 0x51, 0x32, 0x59, 0x74, 0x59, 0x54, 0x59, 0x53, 0x59, 0x32, 0x51, 0x95, 0x61, 0x18, 0x7A, 0x99, 0x82, 0x33, 0x59, 0x32, 0x51, 0x32, 0x51, 0x13, 0x6A, 0xBD, 0xE5, 0x2E, 0x51,
+    0xD0, 0x69, 0x6E, 0x51, 0x4D, 0x49, 0x2F, 0x51, 0x71, 0x59, 0xD3, 0x69, 0xEE, 0x50, 0xD0, 0x69, 0xA9, 0x61, 0x70, 0x82, 0xFF, 0xD4, 0x8C, 0x8A, 0xB6, 0xC3, 0x31, 0xBB, 0x79, 0xF6, 0xFF, 0xFF, 0xFD, 0xFF, 0xCE, 0x9A, 0x6B, 0x82, 0x4E, 0x82, 0x16, 0xC4, 0x35, 0xC4, 0x4B, 0x7A, 0x4E, 0x7A, 0x2F, 0x82, 0x10, 0x82, 0xF1, 0x79, 0x10, 0x7A, 0x3F, 0xCC, 0x3E, 0xD7, 0x5D, 0xAB, 0x56, 0x8A,
+    0xAE, 0x71, 0x90, 0x69, 0x78, 0xAB, 0xED, 0x71, 0x2D, 0x51, 0x47, 0x49, 0xC9, 0x61, 0x8E, 0x82, 0xEB, 0x61, 0xE6, 0x40, 0x07, 0x39, 0x47, 0x41, 0x07, 0x49, 0x2A, 0x49, 0x12, 0x93, 0x07, 0x41, 0x27, 0x41, 0x4A, 0x49, 0x08, 0x39, 0xC8, 0x38, 0x47, 0x41, 0x6B, 0x72, 0xCA, 0x59, 0x29, 0x41, 0x49, 0x49, 0x67, 0x49, 0x8C, 0x7A, 0x48, 0x49, 0x47, 0x41, 0x46, 0x41, 0x47, 0x41, 0x87, 0x49,
+    0x2F, 0x49, 0xB4, 0x69, 0xD6, 0x69, 0x72, 0x59, 0x11, 0x49, 0x31, 0x51, 0x96, 0x61, 0x36, 0x7A, 0x52, 0x59, 0x79, 0x82, 0x31, 0x51, 0xBC, 0x92, 0x10, 0x51, 0x50, 0x59, 0xB9, 0xA3, 0xD1, 0x69, 0xD9, 0x92, 0x4D, 0x49, 0x2D, 0x49, 0xEE, 0x50, 0xB0, 0x61, 0x31, 0x59, 0xD3, 0x69, 0xB0, 0x69, 0xD3, 0x9A, 0x36, 0xBC, 0x51, 0x8A, 0x8E, 0x8A, 0x3B, 0xD4, 0xD2, 0xDB, 0xF8, 0xFE, 0xFD, 0xFF,
+    0xF4, 0xFC, 0x30, 0xAB, 0x8C, 0x8A, 0x6E, 0x8A, 0x54, 0xB3, 0x9E, 0xF6, 0x6C, 0x82, 0x70, 0x82, 0xB1, 0x92, 0x30, 0x82, 0x31, 0x82, 0x52, 0x82, 0x9F, 0xF5, 0x5E, 0x8C, 0x5B, 0x59, 0xB6, 0x71, 0xAF, 0x69, 0x90, 0x69, 0xF2, 0x71, 0xCB, 0x69, 0x4A, 0x51, 0x28, 0x49, 0x48, 0x49, 0x68, 0x59, 0xE7, 0x38, 0x4D, 0x72, 0x4A, 0x49, 0x07, 0x39, 0xC6, 0x38, 0xCB, 0x59, 0x0E, 0x62, 0x09, 0x41,
+    0xC6, 0x30, 0x2B, 0x6A, 0xC8, 0x30, 0x6A, 0x49, 0xC8, 0x38, 0xC9, 0x59, 0x26, 0x39, 0x28, 0x41, 0x08, 0x39, 0x47, 0x41, 0x67, 0x49, 0x47, 0x41, 0x67, 0x49, 0x87, 0x49, 0x87, 0x49, 0xA8, 0x51, 0xDC, 0x9A, 0xD3, 0x61, 0x2F, 0x49, 0x2F, 0x49, 0x35, 0x72, 0xFE, 0x9A, 0x32, 0x59, 0x30, 0x51, 0x72, 0x59, 0x52, 0x51, 0x3D, 0x8A, 0x38, 0x7A, 0xD1, 0x61, 0x0E, 0x49, 0x13, 0x72, 0xDC, 0x92,
+    0x6E, 0x59, 0xF0, 0x61, 0x11, 0x6A, 0x95, 0x8A, 0xFE, 0xBB, 0x33, 0x7A, 0x2E, 0x51, 0x76, 0x92, 0x8C, 0x61, 0xFF, 0xFD, 0xB2, 0x92, 0xF3, 0xA2, 0xB7, 0xBB, 0x16, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xE4, 0x52, 0xAB, 0xAF, 0x92, 0xAF, 0x9A, 0x32, 0xAB, 0xD9, 0xE4, 0x8F, 0x8A, 0x70, 0x8A, 0x36, 0xAB, 0x5C, 0xED, 0x51, 0x82, 0x31, 0x7A, 0xFF, 0xFE, 0x5E, 0x83, 0xFF, 0xFF, 0xD5, 0x71,
+    0x32, 0x7A, 0x72, 0x82, 0xD1, 0x69, 0x5C, 0xCC, 0x89, 0x59, 0xEC, 0x69, 0x48, 0x49, 0x2D, 0x6A, 0x72, 0x9B, 0xC6, 0x38, 0x0C, 0x62, 0x6B, 0x49, 0xE7, 0x38, 0xCE, 0x82, 0x69, 0x51, 0x8B, 0x51, 0xA7, 0x30, 0x06, 0x39, 0xEF, 0x8A, 0x49, 0x49, 0xC7, 0x30, 0xE8, 0x38, 0x0C, 0x83, 0xAF, 0xA3, 0x48, 0x41, 0x49, 0x41, 0x48, 0x41, 0x87, 0x51, 0x2E, 0x93, 0x67, 0x49, 0x67, 0x49, 0xA7, 0x51,
+    0xCD, 0x40, 0x0E, 0x49, 0x0E, 0x41, 0xCD, 0x40, 0x55, 0x72, 0x0E, 0x49, 0x2E, 0x49, 0x2F, 0x49, 0x4F, 0x51, 0x11, 0x51, 0x2F, 0x49, 0x2E, 0x49, 0xB0, 0x59, 0x73, 0x7A, 0xD4, 0x69, 0x0D, 0x49, 0x6D, 0x51, 0x2D, 0x49, 0x4D, 0x51, 0x2F, 0x51, 0x2E, 0x51, 0x4F, 0x59, 0xD1, 0x61, 0x70, 0x61, 0xEC, 0x69, 0x3E, 0xA3, 0x30, 0x7A, 0xB2, 0x92, 0x75, 0xB3, 0xD3, 0xD3, 0xDC, 0xFF, 0x37, 0xFE,
+    0x33, 0xB3, 0xB1, 0x9A, 0xD1, 0xA2, 0xF1, 0xA2, 0x37, 0xDC, 0xB6, 0xC3, 0xB1, 0x92, 0xB1, 0x9A, 0xD2, 0xA2, 0xF2, 0xAA, 0x70, 0x92, 0x51, 0x8A, 0x1F, 0xF6, 0x1E, 0xA3, 0xFA, 0x58, 0x93, 0x69, 0x52, 0x82, 0x10, 0x72, 0xEE, 0x69, 0xCD, 0x61, 0x4B, 0x72, 0x0A, 0x62, 0xAE, 0x82, 0x88, 0x51, 0x88, 0x59, 0xC7, 0x38, 0x27, 0x41, 0x06, 0x39, 0x4A, 0x49, 0xC6, 0x30, 0x0C, 0x62, 0x6A, 0x51,
+    0x87, 0x30, 0xC8, 0x30, 0xE5, 0x30, 0x69, 0x49, 0x86, 0x30, 0xC8, 0x30, 0x08, 0x39, 0x05, 0x41, 0x6B, 0x72, 0xE7, 0x38, 0x49, 0x41, 0x67, 0x49, 0x67, 0x49, 0x66, 0x49, 0x87, 0x49, 0xA7, 0x49, 0x2B, 0x41, 0x4E, 0x49, 0xED, 0x40, 0x4F, 0x49, 0x0F, 0x51, 0x2E, 0x49, 0x2E, 0x49, 0x2E, 0x49, 0x35, 0x7A, 0xEE, 0x40, 0x2E, 0x49, 0x0D, 0x41, 0x6E, 0x51, 0x33, 0x7A, 0x71, 0x51, 0x4D, 0x49,
+    0x6E, 0x51, 0x2D, 0x49, 0x2D, 0x49, 0x2D, 0x49, 0x2D, 0x51, 0x6E, 0x51, 0x58, 0xAB, 0x91, 0x61, 0x90, 0x61, 0x19, 0x9B, 0xD0, 0x69, 0x97, 0x92, 0xD5, 0x9A, 0xD4, 0xA2, 0xD8, 0xAA, 0xBA, 0xAA, 0xF7, 0xA2, 0xB2, 0x9A, 0x31, 0xB3, 0x33, 0xF4, 0xF4, 0xF4, 0x96, 0xCB, 0xF2, 0xA2, 0x12, 0xAB, 0x32, 0xE4, 0x33, 0xE4, 0xD1, 0xAA, 0xB2, 0x92, 0xDF, 0xED, 0x3A, 0xAB, 0xB4, 0x69, 0xCF, 0x69,
+    0xAF, 0x69, 0xAD, 0x61, 0x2F, 0x72, 0x8A, 0x59, 0x68, 0x51, 0x67, 0x49, 0x69, 0x51, 0xAA, 0x59, 0xE7, 0x40, 0xA9, 0x38, 0xE7, 0x38, 0xAE, 0x7A, 0xC9, 0x30, 0xC9, 0x30, 0x6C, 0x51, 0x47, 0x41, 0x08, 0x39, 0x09, 0x39, 0x08, 0x39, 0x49, 0x49, 0x68, 0x51, 0xE7, 0x38, 0x08, 0x39, 0x28, 0x41, 0x46, 0x41, 0x05, 0x41, 0x67, 0x49, 0x88, 0x49, 0x88, 0x49, 0x66, 0x49, 0xA7, 0x51, 0x87, 0x49,
+    0x0A, 0x41, 0xAF, 0x59, 0xD6, 0x8A, 0x4E, 0x51, 0xEC, 0x40, 0x2C, 0x41, 0x0D, 0x41, 0x5B, 0xBC, 0x90, 0x59, 0x0D, 0x41, 0x4E, 0x51, 0xEE, 0x48, 0x55, 0x82, 0xD3, 0x7A, 0x6D, 0x51, 0x4D, 0x49, 0x90, 0x59, 0x10, 0x6A, 0x4B, 0x49, 0x4E, 0x51, 0xB1, 0x61, 0x77, 0x82, 0x50, 0x59, 0x91, 0x59, 0x94, 0x8A, 0x18, 0x9B, 0x5D, 0xAB, 0xF3, 0x79, 0x97, 0x92, 0x55, 0x8A, 0x1F, 0xB4, 0xFF, 0xFF,
+    0x1D, 0xB3, 0x93, 0x9A, 0x93, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0xEC, 0x12, 0xAB, 0xB2, 0xD3, 0xFF, 0xFF, 0xBC, 0xFF, 0x30, 0xB3, 0x71, 0x8A, 0xD8, 0xB3, 0xFC, 0xC3, 0x70, 0x61, 0xCF, 0x69, 0xAE, 0x61, 0xEF, 0x71, 0xF6, 0x92, 0x6B, 0x59, 0x49, 0x49, 0x68, 0x49, 0x89, 0x51, 0x4F, 0x72, 0x28, 0x41, 0xAB, 0x59, 0xE9, 0x38, 0xE7, 0x38, 0xEB, 0x59, 0xAB, 0x59, 0xCD, 0x59, 0x8E, 0x7A,
+    0x0E, 0x83, 0x89, 0x59, 0xC7, 0x30, 0x49, 0x41, 0xE6, 0x38, 0x0D, 0x8B, 0xE6, 0x38, 0x08, 0x41, 0x28, 0x41, 0x65, 0x49, 0xCF, 0xA3, 0xA8, 0x51, 0xA7, 0x51, 0xA7, 0x51, 0xA7, 0x51, 0xA7, 0x51, 0x09, 0x39, 0x2D, 0x49, 0xEC, 0x38, 0x4B, 0x41, 0x0A, 0x41, 0x0C, 0x41, 0x94, 0x7A, 0x0D, 0x49, 0xEB, 0x40, 0x0D, 0x41, 0x2E, 0x49, 0x0D, 0x41, 0x4C, 0x49, 0x8B, 0x51, 0x4D, 0x51, 0x2D, 0x49,
+    0x2D, 0x49, 0x4B, 0x49, 0x4B, 0x49, 0xB0, 0x61, 0x8F, 0x59, 0x2F, 0x51, 0x4E, 0x51, 0xB2, 0x69, 0x51, 0x59, 0x5E, 0x82, 0xD0, 0x69, 0xD2, 0x71, 0x36, 0x8A, 0x37, 0x7A, 0x3F, 0x69, 0xBF, 0x69, 0xFD, 0xA2, 0xD4, 0xA2, 0x14, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xF4, 0x33, 0xB3, 0xF3, 0xDB, 0x1A, 0xFF, 0x3A, 0xFF, 0xD1, 0xDB, 0xB1, 0x92, 0x9A, 0xB3, 0x73, 0x8A, 0x12, 0x7A, 0xF0, 0x71,
+    0xCF, 0x69, 0xB5, 0x92, 0x71, 0x7A, 0x8B, 0x59, 0x68, 0x49, 0x2B, 0x6A, 0x48, 0x49, 0x0A, 0x62, 0xE9, 0x38, 0xC9, 0x38, 0xED, 0x59, 0xE8, 0x30, 0xC8, 0x30, 0xA8, 0x30, 0x0D, 0x6A, 0x0C, 0x62, 0x49, 0x41, 0x08, 0x39, 0xEB, 0x61, 0x0C, 0x62, 0xE7, 0x38, 0xE6, 0x38, 0x26, 0x41, 0xEA, 0x61, 0x47, 0x41, 0xE8, 0x61, 0xA7, 0x51, 0xA7, 0x59, 0xE8, 0x59, 0xA7, 0x51, 0xC7, 0x51, 0xE8, 0x59,
+    0x3A, 0x9B, 0x6B, 0x49, 0x09, 0x39, 0x4A, 0x41, 0x0C, 0x41, 0x99, 0xBC, 0x6A, 0x30, 0x4A, 0x49, 0x2A, 0x41, 0xEC, 0x40, 0xFA, 0x92, 0x2C, 0x41, 0xAC, 0x59, 0x4A, 0x49, 0x52, 0x7A, 0xD7, 0x92, 0xEB, 0x40, 0x4A, 0x49, 0x2C, 0x49, 0x6F, 0x59, 0xD9, 0x92, 0x2E, 0x51, 0x4F, 0x51, 0x55, 0x82, 0x6F, 0x59, 0x5B, 0xA3, 0x6F, 0x61, 0xD2, 0x71, 0xD3, 0x71, 0xD8, 0x71, 0x7F, 0xC7, 0x5E, 0x7C,
+    0xF8, 0x79, 0x95, 0x9A, 0x94, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xDB, 0x13, 0xAB, 0xB4, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xE4, 0xB2, 0x92, 0x5D, 0xAB, 0x11, 0x7A, 0xFD, 0xC3, 0xCF, 0x69, 0xAD, 0x61, 0x4E, 0x59, 0xCE, 0x61, 0x57, 0x9B, 0x47, 0x49, 0x27, 0x41, 0x28, 0x41, 0x2A, 0x5A, 0xD0, 0x82, 0x07, 0x39, 0xE8, 0x38, 0xC9, 0x30, 0xE7, 0x30, 0x6E, 0x72, 0x29, 0x41, 0x29, 0x41,
+    0xE8, 0x38, 0x05, 0x31, 0x4F, 0x93, 0x91, 0x9B, 0xE7, 0x30, 0xE7, 0x30, 0x04, 0x39, 0xD1, 0xCC, 0x26, 0x49, 0x09, 0x62, 0xC7, 0x51, 0x86, 0x59, 0x52, 0xF5, 0xC7, 0x59, 0xE8, 0x59, 0xE8, 0x59, 0x08, 0x39, 0x29, 0x41, 0x08, 0x39, 0x09, 0x39, 0x13, 0x72, 0xAF, 0x59, 0x49, 0x41, 0x29, 0x41, 0xCB, 0x38, 0x12, 0x6A, 0xEC, 0x40, 0x2A, 0x41, 0x29, 0x41, 0x32, 0x72, 0xCD, 0x59, 0x0C, 0x41,
+    0x4A, 0x49, 0x2C, 0x49, 0x53, 0x7A, 0x6D, 0x51, 0x6F, 0x51, 0x2F, 0x51, 0x36, 0x7A, 0x71, 0x59, 0x8E, 0x59, 0xF1, 0x69, 0x91, 0x61, 0xD7, 0x92, 0xD3, 0x71, 0x96, 0x69, 0xFE, 0x58, 0x1F, 0x82, 0xD7, 0x71, 0x54, 0x8A, 0x35, 0xBB, 0xBB, 0xFD, 0xDD, 0xFD, 0x39, 0xBB, 0xD4, 0xA2, 0x75, 0xBB, 0xDE, 0xFF, 0xFF, 0xFF, 0xF8, 0xEC, 0x71, 0x8A, 0xFE, 0xA2, 0xF6, 0x9A, 0xF2, 0x71, 0xAE, 0x61,
+    0xCE, 0x61, 0x4E, 0x59, 0xAD, 0x59, 0x4A, 0x51, 0x48, 0x49, 0x47, 0x41, 0x4C, 0x72, 0x69, 0x49, 0x07, 0x39, 0xC9, 0x38, 0xC6, 0x38, 0xAD, 0x59, 0xC9, 0x30, 0xE6, 0x30, 0x4A, 0x41, 0x89, 0x51, 0x09, 0x41, 0xE8, 0x38, 0x07, 0x39, 0x4C, 0x8B, 0xAC, 0x72, 0xE7, 0x38, 0x84, 0x30, 0x25, 0x41, 0x8A, 0x82, 0xCA, 0x8A, 0x69, 0x7A, 0xE7, 0x69, 0xC7, 0x61, 0xE7, 0x59, 0x29, 0x6A, 0x28, 0x6A,
+    0xE8, 0x30, 0xE8, 0x38, 0xE8, 0x38, 0x09, 0x39, 0x09, 0x39, 0x08, 0x39, 0xCB, 0x51, 0x08, 0x39, 0x0B, 0x41, 0x0A, 0x41, 0x4A, 0x41, 0x28, 0x39, 0x6A, 0x49, 0x2A, 0x41, 0x28, 0x41, 0x08, 0x39, 0x4A, 0x49, 0x2B, 0x49, 0x4B, 0x49, 0x8D, 0x51, 0x6E, 0x51, 0x4F, 0x49, 0x30, 0x51, 0x2F, 0x51, 0x50, 0x51, 0xB3, 0x69, 0x92, 0x61, 0xB1, 0x61, 0xD2, 0x71, 0xB3, 0x69, 0xD5, 0x71, 0xB5, 0x69,
+    0xD5, 0x71, 0x75, 0x8A, 0x76, 0x92, 0x7B, 0xA2, 0x1F, 0x92, 0x7B, 0x92, 0x95, 0x92, 0xB8, 0xA2, 0x3F, 0xC3, 0x5B, 0xBB, 0x75, 0x9A, 0x32, 0x7A, 0x78, 0x8A, 0xD0, 0x69, 0x8E, 0x59, 0x4E, 0x51, 0x8D, 0x59, 0x6D, 0x51, 0xCC, 0x59, 0x48, 0x49, 0x47, 0x41, 0x29, 0x41, 0x28, 0x41, 0xAB, 0x51, 0xCA, 0x38, 0xCA, 0x30, 0xE9, 0x38, 0xC8, 0x30, 0xC9, 0x30, 0xA8, 0x30, 0xE9, 0x38, 0xE9, 0x30,
+    0x29, 0x41, 0xC8, 0x30, 0xE8, 0x38, 0x08, 0x41, 0x08, 0x39, 0x26, 0x41, 0x27, 0x41, 0x47, 0x41, 0xE7, 0x69, 0x8B, 0xBB, 0xD6, 0xF6, 0x0D, 0xCC, 0xE9, 0x92, 0x69, 0x7A, 0xA9, 0x82, 0xAA, 0x8A, 0xE8, 0x30, 0x08, 0x39, 0x33, 0x7A, 0xC7, 0x30, 0x08, 0x39, 0x29, 0x39, 0x09, 0x39, 0xDB, 0xD4, 0x29, 0x41, 0x08, 0x39, 0x49, 0x41, 0x0A, 0x39, 0x93, 0x82, 0x29, 0x41, 0x28, 0x41, 0x29, 0x41,
+    0x0C, 0x41, 0x2C, 0x49, 0x6A, 0x49, 0x8C, 0x51, 0x4D, 0x49, 0x97, 0x82, 0x71, 0x51, 0x50, 0x51, 0x50, 0x51, 0x71, 0x59, 0xD9, 0x92, 0xB2, 0x61, 0xD3, 0x69, 0xD2, 0x69, 0xF4, 0x79, 0xDF, 0xBB, 0xF5, 0x79, 0xB5, 0x79, 0x36, 0x82, 0xFF, 0xBB, 0xFF, 0xFF, 0x1E, 0x82, 0x18, 0x82, 0x38, 0x7A, 0xBE, 0x85, 0x3E, 0x61, 0xD6, 0x79, 0x12, 0x72, 0x56, 0x82, 0x18, 0x93, 0x10, 0x6A, 0x6E, 0x51,
+    0x6D, 0x51, 0x6C, 0x51, 0x76, 0xA3, 0x48, 0x41, 0x47, 0x49, 0x29, 0x41, 0x27, 0x39, 0x6D, 0x72, 0xEA, 0x38, 0xCA, 0x30, 0xCA, 0x30, 0xE7, 0x30, 0xD1, 0x7A, 0xC8, 0x30, 0x0A, 0x39, 0xC8, 0x30, 0x27, 0x41, 0x08, 0x41, 0xE7, 0x30, 0x08, 0x41, 0x28, 0x39, 0x2F, 0xAC, 0xA8, 0x51, 0xA7, 0x51, 0x49, 0x7A, 0x8E, 0xDC, 0xFF, 0xFF, 0x95, 0xFE, 0x8B, 0xBB, 0x2A, 0xA3, 0xE9, 0x8A, 0xEC, 0xBB,
+    0xA7, 0x30, 0xE8, 0x38, 0xE8, 0x30, 0xE8, 0x30, 0xC8, 0x30, 0xE7, 0x30, 0x4A, 0x41, 0xC7, 0x30, 0x28, 0x39, 0x08, 0x39, 0x6A, 0x49, 0x09, 0x39, 0x28, 0x41, 0x29, 0x41, 0x48, 0x41, 0x29, 0x41, 0x2B, 0x41, 0x4A, 0x41, 0x2A, 0x41, 0x4D, 0x49, 0x4C, 0x49, 0x2F, 0x51, 0x2E, 0x49, 0x70, 0x51, 0x70, 0x59, 0x92, 0x61, 0x72, 0x59, 0x92, 0x61, 0xB3, 0x69, 0xB3, 0x69, 0x13, 0x72, 0xF4, 0x71,
+    0xF4, 0x71, 0xF6, 0x79, 0xF7, 0x79, 0x3E, 0x61, 0xBF, 0x48, 0xFC, 0x79, 0x16, 0x7A, 0xF8, 0x71, 0x5E, 0x59, 0x1F, 0x59, 0xB6, 0x69, 0xD2, 0x69, 0xD5, 0x69, 0xAF, 0x59, 0x11, 0x6A, 0x6D, 0x51, 0x6D, 0x51, 0x4B, 0x49, 0x4A, 0x49, 0x47, 0x41, 0x28, 0x41, 0x09, 0x41, 0x08, 0x39, 0x49, 0x41, 0xC9, 0x30, 0xCA, 0x30, 0xA9, 0x30, 0xA9, 0x30, 0xA9, 0x30, 0xC8, 0x30, 0xA8, 0x30, 0xE8, 0x30,
+    0xC8, 0x30, 0xC7, 0x30, 0xC7, 0x30, 0xE7, 0x38, 0x08, 0x39, 0xE7, 0x38, 0x89, 0x49, 0x67, 0x49, 0xC7, 0x59, 0x0A, 0xA3, 0xFC, 0xFF, 0x98, 0xFF, 0xF9, 0xFF, 0x6D, 0xE4, 0xEA, 0x92, 0x88, 0x82, 0xD7, 0x8A, 0xEC, 0x59, 0xC8, 0x30, 0xC7, 0x30, 0xC8, 0x30, 0x96, 0x82, 0xE9, 0x38, 0xE8, 0x38, 0x08, 0x39, 0xE8, 0x38, 0xF6, 0x92, 0x08, 0x41, 0x08, 0x39, 0x28, 0x39, 0x29, 0x41, 0x38, 0x9B,
+    0x0B, 0x41, 0x2A, 0x41, 0x4A, 0x49, 0x51, 0x6A, 0x38, 0x9B, 0xEE, 0x48, 0x2E, 0x49, 0x50, 0x51, 0x71, 0x59, 0xB1, 0x61, 0xF4, 0x71, 0x91, 0x61, 0xB4, 0x69, 0xD4, 0x71, 0xF4, 0x71, 0xD3, 0x71, 0xF6, 0x71, 0xF5, 0x71, 0xB7, 0x69, 0xDF, 0x8E, 0xFC, 0x38, 0x19, 0x72, 0xF6, 0x71, 0xD7, 0x69, 0x1E, 0x49, 0xFF, 0xF7, 0xD9, 0x69, 0xB2, 0x61, 0xF3, 0x69, 0x90, 0x59, 0x1B, 0x9B, 0x6E, 0x51,
+    0x4C, 0x49, 0x4A, 0x49, 0x4B, 0x49, 0x0E, 0x6A, 0x48, 0x41, 0x09, 0x39, 0xEB, 0x38, 0x06, 0x39, 0xAF, 0x7A, 0xCA, 0x30, 0xA9, 0x30, 0xA9, 0x30, 0xC8, 0x30, 0x2C, 0x6A, 0xC8, 0x30, 0xE8, 0x30, 0xC7, 0x30, 0xC6, 0x30, 0x0D, 0x83, 0xE7, 0x38, 0xE7, 0x30, 0x07, 0x39, 0xC7, 0x59, 0xAF, 0xC4, 0xA7, 0x51, 0x48, 0x7A, 0xE9, 0x9A, 0xD2, 0xFD, 0xFF, 0xFF, 0x50, 0xF5, 0xA9, 0x9A, 0x88, 0x82,
 };
 const lv_img_dsc_t ui_img_life_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_life_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_life_80_png_data
 };
 
@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Plasma_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_plasma_80_png_data[] = {
-    0xA2, 0x30, 0xFF, 0xC2, 0x40, 0xFF, 0x66, 0xDA, 0xFF, 0xE3, 0x58, 0xFF, 0xE3, 0x40, 0xFF, 0xE2, 0x38, 0xFF, 0xA3, 0x59, 0xFF, 0x48, 0xC3, 0xFF, 0x02, 0x49, 0xFF, 0x63, 0x89, 0xFF, 0x23, 0x41, 0xFF, 0xB2, 0xFF, 0xFF, 0x23, 0x49, 0xFF, 0xE7, 0xEA, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x41, 0xFF, 0xE6, 0x90, 0xFF, 0xE3, 0x38, 0xFF, 0x04, 0x51, 0xFF, 0xBF, 0xC7, 0xFF, 0x04, 0x41, 0xFF, 0x04, 0x41, 0xFF, 0x24, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0xE5, 0x90, 0xFF, 0x25, 0x41, 0xFF, 0x04, 0x41, 0xFF, 0x24, 0x49, 0xFF, 0x03, 0x39, 0xFF, 0x04, 0x41, 0xFF, 0x04, 0x41, 0xFF, 0x25, 0x51, 0xFF, 0x25, 0x49, 0xFF, 0x45, 0x49, 0xFF, 0x44, 0x49, 0xFF, 0x45, 0x61, 0xFF, 0x45, 0x49, 0xFF, 0x45, 0x49, 0xFF, 0x45, 0x49, 0xFF, 0x86, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0xA6, 0x51, 0xFF, 0xA6, 0x59, 0xFF, 0x27, 0x82, 0xFF, 0x85, 0x69, 0xFF, 0x86, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0x86, 0x59, 0xFF, 0x65, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0x65, 0x59, 0xFF, 0x86, 0x59, 0xFF, 0xCA, 0xF2, 0xFF, 0x86, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0xCB, 0xFB, 0xFF, 0x66, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0x66, 0x41, 0xFF, 0x86, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x66, 0x41, 0xFF,
-    0x46, 0x69, 0xFF, 0x45, 0x49, 0xFF, 0x25, 0x81, 0xFF, 0x66, 0x41, 0xFF, 0x66, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0x66, 0x49, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x41, 0xFF, 0x66, 0x49, 0xFF, 0x86, 0x51, 0xFF, 0x86, 0x49, 0xFF, 0xC7, 0x59, 0xFF, 0x86, 0x41, 0xFF, 0x66, 0x49, 0xFF, 0x65, 0x41, 0xFF, 0xC2, 0x40, 0xFF, 0xC1, 0x40, 0xFF, 0x43, 0xB1, 0xFF, 0x44, 0x69, 0xFF, 0xE2, 0x38, 0xFF, 0xA1, 0x60, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x61, 0xFF, 0x87, 0xC2, 0xFF, 0x64, 0x59, 0xFF, 0xE4, 0x71, 0xFF, 0x03, 0x51, 0xFF, 0xA1, 0x48, 0xFF, 0xD2, 0xFF, 0xFF, 0x83, 0x61, 0xFF, 0x2D, 0xD5, 0xFF, 0x03, 0x41, 0xFF, 0x03, 0x49, 0xFF, 0xA5, 0x81, 0xFF, 0xC6, 0x89, 0xFF, 0xA5, 0xB1, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x86, 0xB9, 0xFF, 0x44, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x05, 0xA9, 0xFF, 0xC2, 0x40, 0xFF, 0x65, 0x79, 0xFF, 0x45, 0x69, 0xFF, 0x25, 0x69, 0xFF, 0x66, 0x79, 0xFF, 0xC4, 0xA9, 0xFF, 0x24, 0x49, 0xFF, 0x2B, 0xFB, 0xFF, 0x90, 0xE6, 0xFF, 0x65, 0x49, 0xFF, 0x65, 0x49, 0xFF, 0xF0, 0xE5, 0xFF, 0x68, 0xFA, 0xFF, 0x86, 0x59, 0xFF, 0xD1, 0xFD, 0xFF, 0xA7, 0xA1, 0xFF, 0x48, 0xA2, 0xFF, 0xAB, 0xFB, 0xFF, 0x86, 0x59, 0xFF, 0xA6, 0x61, 0xFF,
-    0x86, 0xB1, 0xFF, 0x86, 0x61, 0xFF, 0x08, 0x8A, 0xFF, 0xA6, 0x71, 0xFF, 0x28, 0xFB, 0xFF, 0x86, 0x59, 0xFF, 0x86, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0xCC, 0xFB, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x49, 0xFF, 0x66, 0x59, 0xFF, 0xAB, 0xEA, 0xFF, 0x66, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0x25, 0x51, 0xFF, 0xC7, 0x59, 0xFF, 0xEC, 0xB2, 0xFF, 0x86, 0x51, 0xFF, 0x66, 0x49, 0xFF, 0x86, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0x8C, 0xD2, 0xFF, 0x86, 0x49, 0xFF, 0x66, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0xC7, 0x59, 0xFF, 0x8B, 0xB2, 0xFF, 0xC7, 0x61, 0xFF, 0x65, 0x41, 0xFF, 0xE2, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0x04, 0x7A, 0xFF, 0x23, 0x61, 0xFF, 0xE2, 0x40, 0xFF, 0xE3, 0x50, 0xFF, 0x23, 0x49, 0xFF, 0x84, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0xE6, 0xF2, 0xFF, 0xC2, 0x40, 0xFF, 0x24, 0x59, 0xFF, 0x0C, 0x8B, 0xFF, 0x23, 0x61, 0xFF, 0x67, 0xBA, 0xFF, 0x34, 0x93, 0xFF, 0x04, 0xA9, 0xFF, 0x03, 0x49, 0xFF, 0xA5, 0x89, 0xFF, 0x24, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x41, 0xFF, 0x24, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x04, 0x41, 0xFF, 0xC3, 0x68, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x26, 0xBA, 0xFF, 0x45, 0x51, 0xFF,
-    0x24, 0x49, 0xFF, 0x69, 0xCB, 0xFF, 0x45, 0x49, 0xFF, 0x65, 0x69, 0xFF, 0x27, 0x8A, 0xFF, 0x65, 0x49, 0xFF, 0x85, 0x51, 0xFF, 0xD0, 0xEE, 0xFF, 0x85, 0x69, 0xFF, 0x85, 0x59, 0xFF, 0x69, 0x9A, 0xFF, 0x86, 0x59, 0xFF, 0xC6, 0x69, 0xFF, 0x06, 0x9A, 0xFF, 0xA7, 0x69, 0xFF, 0x86, 0x59, 0xFF, 0xC6, 0x69, 0xFF, 0x86, 0x61, 0xFF, 0xE7, 0x79, 0xFF, 0xA6, 0x59, 0xFF, 0xC7, 0x61, 0xFF, 0x86, 0x51, 0xFF, 0xA6, 0x59, 0xFF, 0xA6, 0x61, 0xFF, 0xA7, 0x61, 0xFF, 0xE7, 0x79, 0xFF, 0x86, 0x49, 0xFF, 0x87, 0x59, 0xFF, 0x86, 0x51, 0xFF, 0x28, 0x72, 0xFF, 0x67, 0x51, 0xFF, 0x66, 0x41, 0xFF, 0x66, 0x49, 0xFF, 0x05, 0x71, 0xFF, 0xA6, 0x59, 0xFF, 0x86, 0x51, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x49, 0xFF, 0x87, 0x51, 0xFF, 0x66, 0x49, 0xFF, 0x67, 0x61, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x51, 0xFF, 0xA7, 0x69, 0xFF, 0x66, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0xE8, 0x69, 0xFF, 0x86, 0x49, 0xFF, 0xE2, 0x48, 0xFF, 0x23, 0x51, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0xFC, 0xFF, 0xFF, 0x43, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0xE2, 0xA8, 0xFF, 0x23, 0x49, 0xFF, 0xFD, 0xFF, 0xFF, 0x22, 0x51, 0xFF, 0x63, 0x99, 0xFF, 0x64, 0x61, 0xFF, 0x6D, 0xFD, 0xFF, 0xED, 0xF4, 0xFF, 0x63, 0x51, 0xFF,
-    0xE4, 0x90, 0xFF, 0xE3, 0x40, 0xFF, 0x64, 0x69, 0xFF, 0x64, 0x69, 0xFF, 0xE5, 0xA1, 0xFF, 0x04, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0xC3, 0x60, 0xFF, 0x04, 0x51, 0xFF, 0xEB, 0xFC, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0xF3, 0xFF, 0xFF, 0x24, 0x51, 0xFF, 0x46, 0x69, 0xFF, 0x65, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0xEE, 0xFD, 0xFF, 0x6C, 0x9B, 0xFF, 0x65, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0x07, 0x8A, 0xFF, 0xFC, 0xFF, 0xFF, 0xE7, 0x69, 0xFF, 0xA6, 0x59, 0xFF, 0xA6, 0x61, 0xFF, 0xA6, 0x69, 0xFF, 0xF8, 0xFF, 0xFF, 0xA6, 0x61, 0xFF, 0xA5, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0xC7, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x69, 0xFF, 0xA6, 0x59, 0xFF, 0x46, 0x69, 0xFF, 0xC7, 0x61, 0xFF, 0x53, 0xFF, 0xFF, 0xC7, 0x69, 0xFF, 0xA6, 0x59, 0xFF, 0x86, 0x49, 0xFF, 0x6A, 0x8A, 0xFF, 0xFD, 0xFF, 0xFF, 0x87, 0x51, 0xFF, 0x67, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0x46, 0x49, 0xFF, 0xA9, 0xEA, 0xFF, 0x66, 0x51, 0xFF, 0x66, 0x49, 0xFF, 0x66, 0x51, 0xFF, 0x86, 0x49, 0xFF, 0xF3, 0xFF, 0xFF, 0x87, 0x51, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x51, 0xFF, 0x66, 0x49, 0xFF, 0x69, 0xF2, 0xFF, 0x66, 0x51, 0xFF, 0xE8, 0x61, 0xFF, 0x66, 0x49, 0xFF, 0x86, 0x49, 0xFF,
-    0x23, 0x61, 0xFF, 0x03, 0x49, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0xE5, 0x59, 0xFF, 0x02, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x64, 0xB9, 0xFF, 0x22, 0x59, 0xFF, 0x43, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0xE2, 0x50, 0xFF, 0x2B, 0xFC, 0xFF, 0x24, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0x24, 0x69, 0xFF, 0xE4, 0xB8, 0xFF, 0x03, 0x51, 0xFF, 0x44, 0x61, 0xFF, 0x23, 0x61, 0xFF, 0x24, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x51, 0xFF, 0xC6, 0x79, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x8A, 0x82, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x08, 0x8A, 0xFF, 0x4C, 0xDC, 0xFF, 0x65, 0x51, 0xFF, 0x85, 0x59, 0xFF, 0xEB, 0xDB, 0xFF, 0x85, 0x71, 0xFF, 0x86, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0xA6, 0x61, 0xFF, 0xE7, 0x71, 0xFF, 0x48, 0xA2, 0xFF, 0xE7, 0x71, 0xFF, 0xA6, 0x59, 0xFF, 0xC6, 0x61, 0xFF, 0x28, 0x82, 0xFF, 0x28, 0x9A, 0xFF, 0xE7, 0x69, 0xFF, 0xE8, 0x61, 0xFF, 0x07, 0x6A, 0xFF, 0x07, 0x72, 0xFF, 0x0F, 0xD4, 0xFF, 0xE7, 0x69, 0xFF, 0xC7, 0x59, 0xFF, 0x86, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0x66, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0x66, 0x61, 0xFF, 0x66, 0x49, 0xFF,
-    0x67, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0x87, 0xB1, 0xFF, 0x66, 0x49, 0xFF, 0x87, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0x87, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0xA7, 0x69, 0xFF, 0x69, 0x82, 0xFF, 0x86, 0x49, 0xFF, 0x66, 0x49, 0xFF, 0xA7, 0x51, 0xFF, 0xE2, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0x81, 0x38, 0xFF, 0x43, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0xE3, 0x40, 0xFF, 0x85, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xF3, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x59, 0xFF, 0x37, 0xF7, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x27, 0x7A, 0xFF, 0x6C, 0xFD, 0xFF, 0x24, 0x49, 0xFF, 0x25, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x04, 0x81, 0xFF, 0xF8, 0xFF, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x45, 0x59, 0xFF, 0x24, 0x49, 0xFF, 0xF7, 0xFF, 0xFF, 0x24, 0x51, 0xFF, 0x45, 0x49, 0xFF, 0x0A, 0xB3, 0xFF, 0x65, 0x61, 0xFF, 0xFD, 0xFF, 0xFF, 0x49, 0xC3, 0xFF, 0x65, 0x51, 0xFF, 0x44, 0x59, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xE7, 0x71, 0xFF, 0x6C, 0xD4, 0xFF, 0x07, 0x7A, 0xFF, 0x67, 0xA2, 0xFF, 0xDE, 0xFF, 0xFF, 0x68, 0x8A, 0xFF, 0xE7, 0x69, 0xFF,
-    0xC6, 0x61, 0xFF, 0x68, 0xD2, 0xFF, 0xE8, 0xBA, 0xFF, 0x07, 0x6A, 0xFF, 0xC7, 0x59, 0xFF, 0x08, 0x7A, 0xFF, 0xFE, 0xFF, 0xFF, 0x68, 0x82, 0xFF, 0x08, 0x72, 0xFF, 0xA7, 0x59, 0xFF, 0xE7, 0x69, 0xFF, 0xFB, 0xFF, 0xFF, 0x87, 0x51, 0xFF, 0xC7, 0x69, 0xFF, 0x87, 0x49, 0xFF, 0x87, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0x66, 0x49, 0xFF, 0x86, 0x59, 0xFF, 0xCE, 0xFC, 0xFF, 0x86, 0x51, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x51, 0xFF, 0x4F, 0xD5, 0xFF, 0xE7, 0x91, 0xFF, 0xC7, 0x79, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x49, 0xFF, 0x50, 0xFF, 0xFF, 0x02, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x85, 0xF9, 0xFF, 0x63, 0x51, 0xFF, 0x02, 0x41, 0xFF, 0xE2, 0x40, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0xA7, 0xF9, 0xFF, 0x03, 0x71, 0xFF, 0xC5, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0x63, 0x51, 0xFF, 0x07, 0xF3, 0xFF, 0xE3, 0x68, 0xFF, 0x43, 0x51, 0xFF, 0x02, 0x61, 0xFF, 0xE3, 0x68, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x59, 0xFF, 0x03, 0x49, 0xFF, 0x44, 0x61, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0xA8, 0xFA, 0xFF, 0x04, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0xE7, 0xA9, 0xFF, 0x45, 0x79, 0xFF, 0x25, 0x51, 0xFF,
-    0x45, 0x49, 0xFF, 0xA4, 0x59, 0xFF, 0x65, 0x59, 0xFF, 0xC8, 0xE9, 0xFF, 0xC6, 0x71, 0xFF, 0x86, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0x8A, 0xBB, 0xFF, 0x07, 0x92, 0xFF, 0x07, 0x7A, 0xFF, 0xA6, 0x72, 0xFF, 0xE6, 0x69, 0xFF, 0x27, 0x8A, 0xFF, 0xCA, 0xE2, 0xFF, 0xE6, 0x71, 0xFF, 0xC7, 0x61, 0xFF, 0x48, 0x92, 0xFF, 0xA9, 0xA2, 0xFF, 0x07, 0x7A, 0xFF, 0x08, 0x7A, 0xFF, 0xE8, 0x61, 0xFF, 0x07, 0x62, 0xFF, 0x4F, 0xC4, 0xFF, 0x48, 0x82, 0xFF, 0x90, 0xFB, 0xFF, 0xE7, 0x61, 0xFF, 0xC7, 0x59, 0xFF, 0x0B, 0x8B, 0xFF, 0x87, 0x51, 0xFF, 0xA9, 0x91, 0xFF, 0x67, 0x49, 0xFF, 0x87, 0x51, 0xFF, 0x87, 0x49, 0xFF, 0x87, 0x51, 0xFF, 0xA8, 0x69, 0xFF, 0xE9, 0xA1, 0xFF, 0x86, 0x59, 0xFF, 0x66, 0x51, 0xFF, 0x66, 0x49, 0xFF, 0x87, 0x51, 0xFF, 0x2D, 0xBB, 0xFF, 0x2B, 0xA3, 0xFF, 0x0B, 0x8B, 0xFF, 0x86, 0x49, 0xFF, 0x87, 0x49, 0xFF, 0x47, 0x79, 0xFF, 0x86, 0x49, 0xFF, 0x28, 0x62, 0xFF, 0xE2, 0x40, 0xFF, 0x06, 0x6A, 0xFF, 0x02, 0x41, 0xFF, 0xDA, 0xFF, 0xFF, 0x02, 0x51, 0xFF, 0x22, 0x49, 0xFF, 0xA4, 0x59, 0xFF, 0xE2, 0x50, 0xFF, 0xCF, 0xA4, 0xFF, 0x23, 0x59, 0xFF, 0x83, 0x69, 0xFF, 0xC2, 0xD0, 0xFF, 0xFC, 0xF7, 0xFF, 0xC4, 0x79, 0xFF, 0x0B, 0xF4, 0xFF, 0xC2, 0x48, 0xFF,
-    0x23, 0x51, 0xFF, 0xFB, 0xFF, 0xFF, 0x07, 0x8A, 0xFF, 0xCA, 0xB2, 0xFF, 0x23, 0x59, 0xFF, 0xFB, 0xFF, 0xFF, 0x03, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0xC5, 0x91, 0xFF, 0x44, 0x59, 0xFF, 0xAC, 0xFC, 0xFF, 0x25, 0x71, 0xFF, 0x04, 0x49, 0xFF, 0xE3, 0x58, 0xFF, 0x48, 0xEC, 0xFF, 0x04, 0x59, 0xFF, 0x65, 0x51, 0xFF, 0xC5, 0x69, 0xFF, 0x65, 0x59, 0xFF, 0xCB, 0xEB, 0xFF, 0x25, 0x71, 0xFF, 0xA7, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0x30, 0xE4, 0xFF, 0xCA, 0xE2, 0xFF, 0x89, 0x8A, 0xFF, 0x07, 0x72, 0xFF, 0xE6, 0x69, 0xFF, 0xFD, 0xFF, 0xFF, 0x0E, 0xDC, 0xFF, 0x07, 0x7A, 0xFF, 0x07, 0x72, 0xFF, 0x68, 0x92, 0xFF, 0xDC, 0xFF, 0xFF, 0xF2, 0xFC, 0xFF, 0x6A, 0x82, 0xFF, 0x08, 0x6A, 0xFF, 0x14, 0xEE, 0xFF, 0x28, 0x72, 0xFF, 0x6D, 0xA3, 0xFF, 0x13, 0xC4, 0xFF, 0x49, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x59, 0xFF, 0x66, 0x59, 0xFF, 0x93, 0xC4, 0xFF, 0xA7, 0x61, 0xFF, 0x8D, 0xC4, 0xFF, 0xA8, 0x79, 0xFF, 0x87, 0x51, 0xFF, 0xB0, 0xC3, 0xFF, 0xFE, 0xFF, 0xFF, 0xA7, 0x71, 0xFF, 0x87, 0x49, 0xFF, 0x87, 0x59, 0xFF, 0xA8, 0x69, 0xFF, 0xB3, 0xFD, 0xFF, 0x86, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0xA7, 0x59, 0xFF, 0xEC, 0xAA, 0xFF, 0x87, 0x49, 0xFF, 0x28, 0x5A, 0xFF,
-    0xE3, 0x48, 0xFF, 0x02, 0x49, 0xFF, 0xE2, 0x38, 0xFF, 0x23, 0x51, 0xFF, 0x8D, 0xFD, 0xFF, 0x63, 0x59, 0xFF, 0x44, 0x51, 0xFF, 0xE2, 0x48, 0xFF, 0x23, 0x79, 0xFF, 0xD0, 0xF5, 0xFF, 0x63, 0x69, 0xFF, 0x23, 0x59, 0xFF, 0x2D, 0xFE, 0xFF, 0x64, 0x59, 0xFF, 0x03, 0x61, 0xFF, 0x02, 0x61, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0xC2, 0x60, 0xFF, 0x83, 0xB1, 0xFF, 0x24, 0x51, 0xFF, 0xE3, 0x58, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x07, 0x9A, 0xFF, 0x04, 0x51, 0xFF, 0x25, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x65, 0x59, 0xFF, 0x0B, 0xFC, 0xFF, 0x44, 0x59, 0xFF, 0x86, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x65, 0x59, 0xFF, 0x4C, 0xFB, 0xFF, 0x86, 0x71, 0xFF, 0xA6, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0x52, 0xFE, 0xFF, 0xD7, 0xFF, 0xFF, 0xE6, 0x71, 0xFF, 0x4A, 0x9A, 0xFF, 0x07, 0x7A, 0xFF, 0xC8, 0xC2, 0xFF, 0x71, 0xFE, 0xFF, 0x48, 0x82, 0xFF, 0x08, 0x6A, 0xFF, 0x47, 0x82, 0xFF, 0x88, 0x8A, 0xFF, 0xFE, 0xFF, 0xFF, 0x28, 0x72, 0xFF, 0xEA, 0x8A, 0xFF, 0x0E, 0xBC, 0xFF, 0x48, 0x72, 0xFF, 0x96, 0xFE, 0xFF, 0x09, 0x6A, 0xFF, 0xE7, 0x61, 0xFF, 0xE8, 0x61, 0xFF, 0xC7, 0x59, 0xFF, 0xFE, 0xFF, 0xFF, 0x08, 0x6A, 0xFF, 0xE8, 0x61, 0xFF, 0xA7, 0x51, 0xFF,
-    0xA7, 0x51, 0xFF, 0x90, 0xFC, 0xFF, 0xE8, 0x61, 0xFF, 0xC7, 0x59, 0xFF, 0x87, 0x49, 0xFF, 0x87, 0x51, 0xFF, 0x6E, 0xFC, 0xFF, 0xA7, 0x69, 0xFF, 0x86, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0xAB, 0xFA, 0xFF, 0xA7, 0x51, 0xFF, 0xC7, 0x51, 0xFF, 0xC7, 0x59, 0xFF, 0xC8, 0x59, 0xFF, 0x67, 0x7A, 0xFF, 0x23, 0x51, 0xFF, 0xE2, 0x38, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x08, 0x8B, 0xFF, 0xA5, 0x69, 0xFF, 0xA4, 0x61, 0xFF, 0x44, 0x51, 0xFF, 0x3D, 0xEF, 0xFF, 0x43, 0x69, 0xFF, 0x03, 0x49, 0xFF, 0x22, 0x51, 0xFF, 0xA3, 0xA1, 0xFF, 0x64, 0x69, 0xFF, 0xC8, 0xB2, 0xFF, 0x03, 0x59, 0xFF, 0xE2, 0x48, 0xFF, 0xA9, 0xCB, 0xFF, 0x69, 0x82, 0xFF, 0x47, 0x9A, 0xFF, 0x23, 0x51, 0xFF, 0xDA, 0xFF, 0xFF, 0x44, 0x59, 0xFF, 0x24, 0x59, 0xFF, 0x28, 0x9A, 0xFF, 0x04, 0x51, 0xFF, 0x45, 0x69, 0xFF, 0x24, 0x49, 0xFF, 0x85, 0x61, 0xFF, 0xCA, 0xB2, 0xFF, 0x07, 0x92, 0xFF, 0x65, 0x51, 0xFF, 0x85, 0xB9, 0xFF, 0xE3, 0x50, 0xFF, 0x0C, 0xD3, 0xFF, 0xA6, 0x71, 0xFF, 0xA6, 0x59, 0xFF, 0xC7, 0x61, 0xFF, 0xAC, 0xC3, 0xFF, 0xCC, 0xDB, 0xFF, 0xC6, 0x79, 0xFF, 0x95, 0xFF, 0xFF, 0xAA, 0xA2, 0xFF, 0xB2, 0xFD, 0xFF, 0x70, 0xF5, 0xFF, 0x68, 0x8A, 0xFF, 0x07, 0x72, 0xFF,
-    0xAB, 0xEB, 0xFF, 0xA9, 0x92, 0xFF, 0x93, 0xF5, 0xFF, 0x49, 0x7A, 0xFF, 0xEB, 0xAA, 0xFF, 0x48, 0x7A, 0xFF, 0x8E, 0xA3, 0xFF, 0x33, 0xE5, 0xFF, 0xCC, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x59, 0xFF, 0x8F, 0xA3, 0xFF, 0x95, 0xD4, 0xFF, 0xA9, 0xA2, 0xFF, 0xC8, 0x61, 0xFF, 0xA8, 0x51, 0xFF, 0x46, 0x49, 0xFF, 0xCE, 0xCB, 0xFF, 0xAC, 0xBB, 0xFF, 0xA7, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0x2D, 0xFC, 0xFF, 0xE8, 0x61, 0xFF, 0x86, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0x86, 0x59, 0xFF, 0x6C, 0xDB, 0xFF, 0x87, 0x51, 0xFF, 0xA7, 0x59, 0xFF, 0xA7, 0x51, 0xFF, 0x08, 0x6A, 0xFF, 0x44, 0x69, 0xFF, 0x6D, 0xFC, 0xFF, 0xCA, 0xB3, 0xFF, 0x43, 0x61, 0xFF, 0x63, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x51, 0xF7, 0xFF, 0xC4, 0x69, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x6D, 0xCC, 0xFF, 0xFA, 0xFF, 0xFF, 0x23, 0x49, 0xFF, 0x43, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0xA2, 0x60, 0xFF, 0x44, 0x59, 0xFF, 0x63, 0x99, 0xFF, 0x66, 0xD9, 0xFF, 0xAB, 0xFC, 0xFF, 0x44, 0x59, 0xFF, 0xA3, 0xB8, 0xFF, 0x25, 0x49, 0xFF, 0x45, 0x51, 0xFF, 0x91, 0xFE, 0xFF, 0x6B, 0xFB, 0xFF,
-    0x24, 0x49, 0xFF, 0xFE, 0xFF, 0xFF, 0x65, 0x59, 0xFF, 0xFE, 0xFF, 0xFF, 0xA6, 0x69, 0xFF, 0xA7, 0x51, 0xFF, 0xA7, 0x59, 0xFF, 0x95, 0xE5, 0xFF, 0xFB, 0xFF, 0xFF, 0x27, 0x82, 0xFF, 0xFA, 0xFF, 0xFF, 0x27, 0x7A, 0xFF, 0x4E, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0x28, 0x7A, 0xFF, 0x28, 0x72, 0xFF, 0xFC, 0xFF, 0xFF, 0xB0, 0xFD, 0xFF, 0xE9, 0x9A, 0xFF, 0xCB, 0x8A, 0xFF, 0x6B, 0xEB, 0xFF, 0x49, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x92, 0xFF, 0xAB, 0xCB, 0xFF, 0x08, 0x62, 0xFF, 0x49, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x6A, 0xFF, 0x09, 0x6A, 0xFF, 0xC8, 0x51, 0xFF, 0x08, 0x5A, 0xFF, 0xDF, 0xFF, 0xFF, 0xC8, 0x59, 0xFF, 0xC8, 0x59, 0xFF, 0xA8, 0x51, 0xFF, 0xE8, 0x91, 0xFF, 0xA9, 0xB2, 0xFF, 0xC8, 0x61, 0xFF, 0xC8, 0x59, 0xFF, 0xA7, 0x51, 0xFF, 0xFE, 0xFF, 0xFF, 0x86, 0x59, 0xFF, 0xA7, 0x51, 0xFF, 0xC7, 0x51, 0xFF, 0xC7, 0x59, 0xFF, 0xE8, 0x71, 0xFF, 0x50, 0xFF, 0xFF, 0xC2, 0x38, 0xFF, 0xC6, 0x61, 0xFF, 0x23, 0x49, 0xFF, 0xC4, 0x61, 0xFF, 0x03, 0x49, 0xFF, 0xE2, 0x40, 0xFF, 0x23, 0x51, 0xFF, 0x43, 0x59, 0xFF, 0x22, 0x41, 0xFF, 0x43, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x43, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x51, 0xFF, 0xA5, 0x69, 0xFF,
-    0x02, 0x49, 0xFF, 0x23, 0x61, 0xFF, 0x03, 0x49, 0xFF, 0x84, 0x71, 0xFF, 0x24, 0x71, 0xFF, 0xC6, 0x71, 0xFF, 0x24, 0x59, 0xFF, 0x64, 0x69, 0xFF, 0x03, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x65, 0x61, 0xFF, 0x24, 0x49, 0xFF, 0x86, 0x61, 0xFF, 0x65, 0x61, 0xFF, 0x45, 0x59, 0xFF, 0x66, 0x51, 0xFF, 0x7F, 0xF7, 0xFF, 0x86, 0x59, 0xFF, 0x45, 0x71, 0xFF, 0x33, 0xAB, 0xFF, 0xA7, 0x51, 0xFF, 0xA6, 0x59, 0xFF, 0xB1, 0xFD, 0xFF, 0xEB, 0x92, 0xFF, 0xA9, 0x92, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7, 0x71, 0xFF, 0x68, 0x8A, 0xFF, 0x89, 0x92, 0xFF, 0x48, 0x7A, 0xFF, 0xE7, 0x61, 0xFF, 0x89, 0x82, 0xFF, 0x6A, 0xA3, 0xFF, 0x49, 0x82, 0xFF, 0xCB, 0x8A, 0xFF, 0xEB, 0x82, 0xFF, 0x69, 0x6A, 0xFF, 0x8A, 0x7A, 0xFF, 0xCA, 0x82, 0xFF, 0xCB, 0x8A, 0xFF, 0x29, 0x62, 0xFF, 0x2A, 0x7B, 0xFF, 0x6A, 0x6A, 0xFF, 0x49, 0x72, 0xFF, 0x2A, 0x6A, 0xFF, 0xE8, 0x59, 0xFF, 0xE8, 0x59, 0xFF, 0xE8, 0x61, 0xFF, 0xC8, 0x51, 0xFF, 0xE8, 0x69, 0xFF, 0xE8, 0x69, 0xFF, 0x48, 0x7A, 0xFF, 0x87, 0x51, 0xFF, 0xA8, 0x59, 0xFF, 0xC8, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0xA7, 0x61, 0xFF, 0xA7, 0x59, 0xFF, 0xA7, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0xA8, 0x59, 0xFF, 0x29, 0x6A, 0xFF, 0xE8, 0x59, 0xFF,
-    0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0xC8, 0xAA, 0xFF, 0x42, 0x59, 0xFF, 0xC1, 0x48, 0xFF, 0xC2, 0x40, 0xFF, 0xE2, 0x48, 0xFF, 0xAC, 0xFD, 0xFF, 0x83, 0x79, 0xFF, 0x85, 0x61, 0xFF, 0x43, 0x51, 0xFF, 0x26, 0x72, 0xFF, 0xE6, 0xC9, 0xFF, 0xE5, 0x79, 0xFF, 0x24, 0x71, 0xFF, 0xC6, 0x71, 0xFF, 0xFD, 0xFF, 0xFF, 0x03, 0x59, 0xFF, 0xA7, 0xF9, 0xFF, 0x24, 0x69, 0xFF, 0xC9, 0xE3, 0xFF, 0x44, 0x61, 0xFF, 0x24, 0x59, 0xFF, 0x66, 0xF9, 0xFF, 0x86, 0x61, 0xFF, 0x46, 0xBA, 0xFF, 0x44, 0x69, 0xFF, 0xE3, 0x48, 0xFF, 0x86, 0xB1, 0xFF, 0xE7, 0xB1, 0xFF, 0x08, 0x7A, 0xFF, 0x45, 0x51, 0xFF, 0xE6, 0xB9, 0xFF, 0x86, 0x69, 0xFF, 0x8F, 0xFC, 0xFF, 0x85, 0x79, 0xFF, 0xA7, 0x51, 0xFF, 0xA7, 0x59, 0xFF, 0xAE, 0xFD, 0xFF, 0xCD, 0xFB, 0xFF, 0x48, 0x82, 0xFF, 0xF6, 0xFF, 0xFF, 0x07, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFD, 0xFF, 0xA9, 0x8A, 0xFF, 0xE8, 0x69, 0xFF, 0xCA, 0xD2, 0xFF, 0xFD, 0xFF, 0xFF, 0x91, 0xEC, 0xFF, 0x6E, 0xB3, 0xFF, 0xEB, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x72, 0xFF, 0x91, 0xD4, 0xFF, 0x54, 0xFD, 0xFF, 0xCA, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x8A, 0xFF, 0x2A, 0x62, 0xFF, 0x55, 0xFD, 0xFF, 0x11, 0xDD, 0xFF, 0x4C, 0xDB, 0xFF,
-    0xC8, 0x51, 0xFF, 0xC9, 0x59, 0xFF, 0xB5, 0xF5, 0xFF, 0xFC, 0xFF, 0xFF, 0x88, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0xC8, 0x59, 0xFF, 0x11, 0xDC, 0xFF, 0x50, 0xEB, 0xFF, 0xA7, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0xA8, 0x51, 0xFF, 0x68, 0xB9, 0xFF, 0xED, 0xFA, 0xFF, 0xC9, 0x59, 0xFF, 0xE8, 0x59, 0xFF, 0xE7, 0x9A, 0xFF, 0xC4, 0xB9, 0xFF, 0xE2, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0xE1, 0x50, 0xFF, 0xAF, 0xED, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x48, 0xFF, 0xE2, 0x48, 0xFF, 0xFE, 0xFF, 0xFF, 0xC2, 0x68, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x09, 0xD3, 0xFF, 0xE2, 0x48, 0xFF, 0x44, 0x61, 0xFF, 0x03, 0x69, 0xFF, 0x43, 0x59, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0x50, 0xFF, 0x25, 0xC1, 0xFF, 0x24, 0x59, 0xFF, 0x62, 0xB1, 0xFF, 0x44, 0x51, 0xFF, 0xA3, 0xB0, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x04, 0xA9, 0xFF, 0xA7, 0x81, 0xFF, 0x85, 0x59, 0xFF, 0x6E, 0xFD, 0xFF, 0xE9, 0xFA, 0xFF, 0x45, 0x49, 0xFF, 0xFC, 0xFF, 0xFF, 0x65, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x82, 0xFF, 0x86, 0x49, 0xFF, 0x86, 0x51, 0xFF, 0xFD, 0xFF, 0xFF, 0xCB, 0xD3, 0xFF, 0x27, 0x7A, 0xFF, 0xFD, 0xFF, 0xFF, 0xC9, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0xDB, 0xFF, 0x6A, 0x7A, 0xFF, 0xAB, 0x82, 0xFF,
-    0xD2, 0xED, 0xFF, 0xAC, 0xAB, 0xFF, 0x13, 0xF6, 0xFF, 0xEC, 0x8A, 0xFF, 0xAE, 0xAC, 0xFF, 0x14, 0xEE, 0xFF, 0x4A, 0x6A, 0xFF, 0xD0, 0xC3, 0xFF, 0x2A, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x6A, 0xFF, 0x2B, 0x62, 0xFF, 0x8F, 0xE4, 0xFF, 0xD6, 0xF6, 0xFF, 0x2A, 0xCA, 0xFF, 0xE8, 0x59, 0xFF, 0xC9, 0x51, 0xFF, 0x8C, 0xB2, 0xFF, 0x8C, 0xD2, 0xFF, 0xC8, 0x51, 0xFF, 0xA8, 0x51, 0xFF, 0xA8, 0x51, 0xFF, 0x34, 0xFF, 0xFF, 0x47, 0x59, 0xFF, 0xA8, 0x59, 0xFF, 0xA8, 0x51, 0xFF, 0x2A, 0xB2, 0xFF, 0xAF, 0xFC, 0xFF, 0xA8, 0x59, 0xFF, 0xC8, 0x51, 0xFF, 0xE9, 0x71, 0xFF, 0xCA, 0xC2, 0xFF, 0x85, 0x79, 0xFF, 0xC2, 0x48, 0xFF, 0xE4, 0xF8, 0xFF, 0xA2, 0x40, 0xFF, 0xE3, 0x50, 0xFF, 0x05, 0xA2, 0xFF, 0x85, 0xF9, 0xFF, 0x03, 0x49, 0xFF, 0xE2, 0x48, 0xFF, 0x64, 0x59, 0xFF, 0x46, 0xC2, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0xE6, 0x89, 0xFF, 0x44, 0x81, 0xFF, 0x85, 0x61, 0xFF, 0x04, 0x99, 0xFF, 0xA4, 0x61, 0xFF, 0x64, 0x59, 0xFF, 0xA7, 0xC9, 0xFF, 0x66, 0xC9, 0xFF, 0x04, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0xC6, 0x61, 0xFF, 0x6B, 0xFB, 0xFF, 0x23, 0x49, 0xFF, 0x45, 0x59, 0xFF, 0x04, 0x49, 0xFF, 0x64, 0x51, 0xFF, 0x0A, 0xF3, 0xFF, 0x64, 0x61, 0xFF,
-    0x45, 0x51, 0xFF, 0x29, 0x4A, 0xFF, 0x65, 0x59, 0xFF, 0xFD, 0xFF, 0xFF, 0xC7, 0x69, 0xFF, 0xA7, 0x51, 0xFF, 0xC7, 0x51, 0xFF, 0x54, 0xBD, 0xFF, 0xAF, 0xF4, 0xFF, 0x28, 0x7A, 0xFF, 0x26, 0x5A, 0xFF, 0x69, 0x82, 0xFF, 0x2E, 0xCC, 0xFF, 0xB9, 0xFF, 0xFF, 0xCB, 0x8A, 0xFF, 0x8A, 0x82, 0xFF, 0xCE, 0xEC, 0xFF, 0x2B, 0x9B, 0xFF, 0x3B, 0xFF, 0xFF, 0x2D, 0x8B, 0xFF, 0x6D, 0xB3, 0xFF, 0xAC, 0x6A, 0xFF, 0xF1, 0x9B, 0xFF, 0xBF, 0xFF, 0xFF, 0xAC, 0x82, 0xFF, 0x6C, 0x7A, 0xFF, 0x6C, 0x6A, 0xFF, 0x2F, 0x83, 0xFF, 0x96, 0xE5, 0xFF, 0x8B, 0x82, 0xFF, 0x2A, 0x62, 0xFF, 0x2A, 0x62, 0xFF, 0xCD, 0x7A, 0xFF, 0xB2, 0xC4, 0xFF, 0xC9, 0x59, 0xFF, 0xC9, 0x59, 0xFF, 0xA8, 0x51, 0xFF, 0x0A, 0x92, 0xFF, 0x0C, 0xDB, 0xFF, 0xC8, 0x59, 0xFF, 0xC8, 0x59, 0xFF, 0xA8, 0x81, 0xFF, 0x6B, 0x82, 0xFF, 0x6A, 0x8A, 0xFF, 0xC8, 0x51, 0xFF, 0x09, 0x62, 0xFF, 0xE9, 0x61, 0xFF, 0x29, 0x62, 0xFF, 0x04, 0xA9, 0xFF, 0x02, 0x61, 0xFF, 0xC5, 0x89, 0xFF, 0xA2, 0x38, 0xFF, 0xC2, 0x50, 0xFF, 0x23, 0x49, 0xFF, 0x04, 0x92, 0xFF, 0x45, 0xB2, 0xFF, 0x44, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x59, 0xFF, 0xF0, 0xFE, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0xA5, 0x69, 0xFF, 0x44, 0x61, 0xFF,
-    0x6B, 0xFC, 0xFF, 0x44, 0x51, 0xFF, 0xE3, 0x78, 0xFF, 0x47, 0x82, 0xFF, 0x44, 0x51, 0xFF, 0xE7, 0x89, 0xFF, 0x44, 0x51, 0xFF, 0x85, 0x71, 0xFF, 0x23, 0x51, 0xFF, 0x28, 0x92, 0xFF, 0x44, 0x49, 0xFF, 0x85, 0x81, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x28, 0xFA, 0xFF, 0x89, 0x92, 0xFF, 0x66, 0x59, 0xFF, 0x45, 0x49, 0xFF, 0x65, 0x51, 0xFF, 0xF6, 0xFF, 0xFF, 0xC6, 0x69, 0xFF, 0xE8, 0x61, 0xFF, 0xA7, 0x51, 0xFF, 0xE7, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x7A, 0xFF, 0xE7, 0x59, 0xFF, 0xCA, 0x8A, 0xFF, 0x2C, 0xB4, 0xFF, 0xFD, 0xFF, 0xFF, 0xAD, 0xA3, 0xFF, 0x49, 0x72, 0xFF, 0x8A, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xA4, 0xFF, 0xAB, 0x82, 0xFF, 0xF1, 0xB3, 0xFF, 0xEF, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x93, 0xFF, 0x8F, 0xBB, 0xFF, 0xEF, 0x7A, 0xFF, 0x30, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xA2, 0xFF, 0x8C, 0x7A, 0xFF, 0x4B, 0x6A, 0xFF, 0x4E, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x83, 0xFF, 0xE9, 0x59, 0xFF, 0xA9, 0x59, 0xFF, 0xB4, 0xFD, 0xFF, 0x6A, 0x8A, 0xFF, 0xC8, 0x59, 0xFF, 0xC8, 0x59, 0xFF, 0xE9, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0x61, 0xFF, 0xC9, 0x59, 0xFF, 0xC9, 0x51, 0xFF, 0x09, 0x62, 0xFF, 0xC8, 0x61, 0xFF, 0x10, 0xFE, 0xFF,
-    0xE3, 0x40, 0xFF, 0xC3, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0x43, 0x59, 0xFF, 0xE2, 0x48, 0xFF, 0x42, 0xE0, 0xFF, 0xC2, 0x40, 0xFF, 0x02, 0x49, 0xFF, 0x23, 0x9A, 0xFF, 0x03, 0x51, 0xFF, 0xE3, 0x48, 0xFF, 0x44, 0x59, 0xFF, 0x46, 0x9A, 0xFF, 0x03, 0x51, 0xFF, 0x44, 0x59, 0xFF, 0x23, 0x69, 0xFF, 0x67, 0x8A, 0xFF, 0x64, 0x61, 0xFF, 0x44, 0x59, 0xFF, 0x85, 0x71, 0xFF, 0x84, 0x61, 0xFF, 0x25, 0x51, 0xFF, 0x45, 0x69, 0xFF, 0x64, 0x59, 0xFF, 0x44, 0x61, 0xFF, 0xE4, 0x48, 0xFF, 0x04, 0x59, 0xFF, 0x25, 0x59, 0xFF, 0x24, 0x51, 0xFF, 0xA6, 0x61, 0xFF, 0x25, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x65, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x69, 0xAA, 0xFF, 0x28, 0x7A, 0xFF, 0x86, 0x49, 0xFF, 0xA7, 0x51, 0xFF, 0xCA, 0x92, 0xFF, 0x50, 0xCD, 0xFF, 0x2B, 0x93, 0xFF, 0xA7, 0x51, 0xFF, 0x08, 0x6A, 0xFF, 0xAE, 0xCC, 0xFF, 0xA9, 0x7A, 0xFF, 0xEC, 0x8A, 0xFF, 0x8A, 0x8A, 0xFF, 0xAD, 0x93, 0xFF, 0xFE, 0xFF, 0xFF, 0xAB, 0x72, 0xFF, 0x8F, 0xB3, 0xFF, 0x0F, 0x83, 0xFF, 0x9E, 0xC5, 0xFF, 0x14, 0x7B, 0xFF, 0xB4, 0xE4, 0xFF, 0xF0, 0xD2, 0xFF, 0x77, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xAA, 0xFF, 0x8D, 0x6A, 0xFF, 0xCD, 0x6A, 0xFF, 0x6E, 0x93, 0xFF, 0x0D, 0xDB, 0xFF,
-    0x0A, 0x5A, 0xFF, 0xEA, 0x59, 0xFF, 0x0A, 0x62, 0xFF, 0x4F, 0xF5, 0xFF, 0xC9, 0x61, 0xFF, 0x2A, 0x72, 0xFF, 0xE9, 0x59, 0xFF, 0xE9, 0x69, 0xFF, 0xC8, 0x81, 0xFF, 0xC9, 0x59, 0xFF, 0xE9, 0x61, 0xFF, 0x09, 0x62, 0xFF, 0x4B, 0xD2, 0xFF, 0xC8, 0x79, 0xFF, 0xE9, 0x59, 0xFF, 0x0A, 0x62, 0xFF, 0xC2, 0x40, 0xFF, 0x73, 0xFF, 0xFF, 0xC2, 0x40, 0xFF, 0x86, 0xD1, 0xFF, 0x27, 0x82, 0xFF, 0x46, 0xBA, 0xFF, 0x00, 0xA0, 0xFF, 0x02, 0x49, 0xFF, 0x06, 0xA2, 0xFF, 0xF6, 0xFF, 0xFF, 0x03, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0xC2, 0x50, 0xFF, 0xAB, 0xC3, 0xFF, 0x85, 0x69, 0xFF, 0x23, 0x59, 0xFF, 0xE2, 0xA0, 0xFF, 0x84, 0x91, 0xFF, 0xA4, 0x59, 0xFF, 0x85, 0x69, 0xFF, 0xC2, 0x70, 0xFF, 0x24, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x86, 0xA9, 0xFF, 0xC6, 0x69, 0xFF, 0xC7, 0x71, 0xFF, 0x64, 0x51, 0xFF, 0x4A, 0xF3, 0xFF, 0x24, 0x59, 0xFF, 0x45, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x86, 0x61, 0xFF, 0x45, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0x4D, 0xFC, 0xFF, 0xE7, 0x81, 0xFF, 0xA7, 0x51, 0xFF, 0x87, 0x51, 0xFF, 0x6A, 0xC2, 0xFF, 0xEB, 0xC2, 0xFF, 0x2B, 0x8B, 0xFF, 0xE7, 0x51, 0xFF, 0x0B, 0x8B, 0xFF, 0xF9, 0xFF, 0xFF, 0x6F, 0xF5, 0xFF, 0xCC, 0x8A, 0xFF, 0x8B, 0x8A, 0xFF,
-    0xB1, 0xB4, 0xFF, 0xD0, 0x9B, 0xFF, 0x6B, 0x7A, 0xFF, 0xEE, 0x82, 0xFF, 0xF8, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x6A, 0xFF, 0x56, 0xAC, 0xFF, 0x93, 0xFC, 0xFF, 0x55, 0x83, 0xFF, 0x58, 0x93, 0xFF, 0x8E, 0x6A, 0xFF, 0x8E, 0x6A, 0xFF, 0x35, 0xF4, 0xFF, 0x55, 0xCE, 0xFF, 0xEE, 0x72, 0xFF, 0x0A, 0x52, 0xFF, 0x2B, 0x62, 0xFF, 0x8D, 0xE2, 0xFF, 0xCA, 0x71, 0xFF, 0xC9, 0x59, 0xFF, 0xC9, 0x69, 0xFF, 0x0A, 0x7A, 0xFF, 0x8F, 0xD3, 0xFF, 0x0E, 0x9B, 0xFF, 0xE9, 0x59, 0xFF, 0x0A, 0xA2, 0xFF, 0xCC, 0x7A, 0xFF, 0x2A, 0x6A, 0xFF, 0xCE, 0xFA, 0xFF, 0x0A, 0x7A, 0xFF, 0x09, 0x62, 0xFF, 0xC2, 0x48, 0xFF, 0x65, 0x79, 0xFF, 0x03, 0x61, 0xFF, 0x64, 0x71, 0xFF, 0x45, 0xD1, 0xFF, 0x68, 0xBB, 0xFF, 0x69, 0xE4, 0xFF, 0xC2, 0x80, 0xFF, 0xC2, 0x50, 0xFF, 0xC2, 0x50, 0xFF, 0xEF, 0xEC, 0xFF, 0x43, 0x59, 0xFF, 0xE3, 0x50, 0xFF, 0x43, 0x61, 0xFF, 0xE6, 0x89, 0xFF, 0x44, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0xE8, 0xEB, 0xFF, 0x07, 0x7A, 0xFF, 0xE7, 0x99, 0xFF, 0x88, 0xFA, 0xFF, 0xE7, 0xF9, 0xFF, 0x03, 0x51, 0xFF, 0x44, 0x59, 0xFF, 0x85, 0x69, 0xFF, 0x89, 0x92, 0xFF, 0x24, 0x49, 0xFF, 0xE7, 0x79, 0xFF, 0x65, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0xA9, 0x92, 0xFF,
-    0xA6, 0x71, 0xFF, 0x65, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x2F, 0xB3, 0xFF, 0x07, 0xCA, 0xFF, 0x87, 0x51, 0xFF, 0xA7, 0x51, 0xFF, 0x53, 0xFF, 0xFF, 0x6E, 0xDC, 0xFF, 0xCA, 0x8A, 0xFF, 0x4A, 0xBA, 0xFF, 0x4C, 0x9B, 0xFF, 0x10, 0xE5, 0xFF, 0x14, 0xF5, 0xFF, 0x6E, 0x93, 0xFF, 0x6A, 0x72, 0xFF, 0xFC, 0xFF, 0xFF, 0x8E, 0x93, 0xFF, 0x39, 0xFF, 0xFF, 0x70, 0x93, 0xFF, 0x57, 0xBD, 0xFF, 0xB4, 0x93, 0xFF, 0x10, 0x7B, 0xFF, 0x93, 0xBC, 0xFF, 0x11, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x7A, 0xFF, 0xAF, 0x6A, 0xFF, 0xD0, 0xAB, 0xFF, 0xDC, 0xED, 0xFF, 0x0F, 0x7B, 0xFF, 0x8D, 0x6A, 0xFF, 0x0B, 0x5A, 0xFF, 0x70, 0xDB, 0xFF, 0xDA, 0xD4, 0xFF, 0x13, 0xA4, 0xFF, 0xEA, 0x59, 0xFF, 0x8C, 0xA2, 0xFF, 0x05, 0x89, 0xFF, 0x34, 0xBC, 0xFF, 0x4E, 0x8B, 0xFF, 0x2A, 0x72, 0xFF, 0xE9, 0x59, 0xFF, 0xC8, 0x91, 0xFF, 0x2A, 0x72, 0xFF, 0x0A, 0x62, 0xFF, 0x2B, 0x8A, 0xFF, 0xAA, 0x7A, 0xFF, 0x47, 0xAA, 0xFF, 0x44, 0x59, 0xFF, 0x43, 0x61, 0xFF, 0xE3, 0x48, 0xFF, 0xC2, 0x58, 0xFF, 0xA4, 0xA1, 0xFF, 0x23, 0x59, 0xFF, 0x87, 0xAA, 0xFF, 0x64, 0x61, 0xFF, 0x23, 0x59, 0xFF, 0x06, 0xC2, 0xFF, 0x86, 0x8A, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0x06, 0xDA, 0xFF,
-    0x64, 0x61, 0xFF, 0x24, 0x61, 0xFF, 0x64, 0x79, 0xFF, 0xAE, 0xEC, 0xFF, 0xC6, 0x71, 0xFF, 0x65, 0x69, 0xFF, 0xA6, 0x69, 0xFF, 0x28, 0xCA, 0xFF, 0x04, 0x59, 0xFF, 0xC7, 0x79, 0xFF, 0x85, 0x59, 0xFF, 0x4B, 0xFB, 0xFF, 0x08, 0x6A, 0xFF, 0x85, 0x61, 0xFF, 0x29, 0xAA, 0xFF, 0xA7, 0x99, 0xFF, 0x85, 0x61, 0xFF, 0xED, 0xCB, 0xFF, 0x65, 0x51, 0xFF, 0xD1, 0xFE, 0xFF, 0x86, 0x69, 0xFF, 0x87, 0x51, 0xFF, 0xA7, 0x59, 0xFF, 0x15, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x8A, 0x7A, 0xFF, 0x4E, 0xBC, 0xFF, 0x4C, 0x9B, 0xFF, 0xCC, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x8B, 0xFF, 0x4D, 0x93, 0xFF, 0xCE, 0xEB, 0xFF, 0x70, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0x7B, 0xFF, 0x59, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x72, 0xFF, 0x91, 0x62, 0xFF, 0xB9, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x6A, 0xFF, 0xCF, 0x72, 0xFF, 0xAE, 0x6A, 0xFF, 0x73, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x5A, 0xFF, 0x0B, 0x5A, 0xFF, 0x8E, 0xE3, 0xFF, 0xEE, 0x8A, 0xFF, 0x96, 0xFF, 0xFF, 0xEA, 0x61, 0xFF, 0x2A, 0x62, 0xFF, 0xAD, 0xFA, 0xFF, 0x0D, 0x93, 0xFF, 0x0D, 0xC4, 0xFF, 0x0A, 0x62, 0xFF, 0xC9, 0x81, 0xFF, 0x2A, 0x62, 0xFF, 0x29, 0x62, 0xFF,
-    0x43, 0x51, 0xFF, 0x82, 0x40, 0xFF, 0x23, 0xC1, 0xFF, 0x02, 0x51, 0xFF, 0xA5, 0x69, 0xFF, 0x03, 0x59, 0xFF, 0x85, 0x79, 0xFF, 0x0A, 0xD3, 0xFF, 0xFB, 0xFF, 0xFF, 0xA4, 0x79, 0xFF, 0xA5, 0x61, 0xFF, 0x67, 0xDA, 0xFF, 0x87, 0x9A, 0xFF, 0x43, 0x71, 0xFF, 0xA5, 0x71, 0xFF, 0x85, 0x69, 0xFF, 0xE6, 0xC9, 0xFF, 0x23, 0x59, 0xFF, 0x85, 0x69, 0xFF, 0x64, 0x71, 0xFF, 0x47, 0x8A, 0xFF, 0x07, 0x82, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x59, 0xFF, 0x69, 0x82, 0xFF, 0x65, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0x45, 0x51, 0xFF, 0x65, 0x61, 0xFF, 0x24, 0x49, 0xFF, 0x08, 0x7A, 0xFF, 0xA7, 0x61, 0xFF, 0x66, 0x59, 0xFF, 0x4B, 0x7B, 0xFF, 0x86, 0x51, 0xFF, 0x8B, 0xFA, 0xFF, 0xA8, 0x71, 0xFF, 0xA7, 0x51, 0xFF, 0xC7, 0x51, 0xFF, 0x37, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x82, 0xFF, 0x69, 0x72, 0xFF, 0x48, 0x7A, 0xFF, 0xEF, 0xAC, 0xFF, 0x4E, 0xB4, 0xFF, 0x8F, 0x9B, 0xFF, 0xAD, 0xAA, 0xFF, 0x72, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x8B, 0xFF, 0x34, 0xCC, 0xFF, 0x72, 0x8B, 0xFF, 0x17, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xEC, 0xFF, 0xB1, 0x6A, 0xFF, 0x56, 0x83, 0xFF, 0xFA, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x6A, 0xFF, 0xCF, 0x6A, 0xFF, 0xB6, 0x93, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xB7, 0xD5, 0xFF, 0x8D, 0x6A, 0xFF, 0x4C, 0x62, 0xFF, 0x6D, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x7A, 0xFF, 0x0A, 0x62, 0xFF, 0x0A, 0x62, 0xFF, 0x2A, 0x72, 0xFF, 0xFE, 0xFF, 0xFF, 0x2A, 0x6A, 0xFF, 0x0A, 0x6A, 0xFF, 0x6C, 0xBA, 0xFF, 0x2A, 0x6A, 0xFF, 0x8B, 0x82, 0xFF, 0x4F, 0xFC, 0xFF, 0xE3, 0x40, 0xFF, 0x22, 0x5A, 0xFF, 0xE2, 0x50, 0xFF, 0xE2, 0x48, 0xFF, 0xC6, 0xDA, 0xFF, 0x01, 0x61, 0xFF, 0x64, 0x61, 0xFF, 0x66, 0xB9, 0xFF, 0xD0, 0xFE, 0xFF, 0xC7, 0xAB, 0xFF, 0x68, 0x9A, 0xFF, 0x02, 0x59, 0xFF, 0x84, 0x61, 0xFF, 0xFA, 0xFF, 0xFF, 0xC5, 0x91, 0xFF, 0x64, 0x61, 0xFF, 0x44, 0x61, 0xFF, 0x27, 0xDA, 0xFF, 0x45, 0x59, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x79, 0xFF, 0x24, 0x61, 0xFF, 0x24, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x89, 0x8A, 0xFF, 0xC6, 0x69, 0xFF, 0x08, 0x7A, 0xFF, 0x45, 0x51, 0xFF, 0xA7, 0x89, 0xFF, 0x25, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0x28, 0x72, 0xFF, 0xCB, 0x9A, 0xFF, 0x45, 0x61, 0xFF, 0x86, 0x51, 0xFF, 0xCB, 0x9A, 0xFF, 0x94, 0xED, 0xFF, 0xA7, 0x51, 0xFF, 0xC7, 0x59, 0xFF, 0x8C, 0xC3, 0xFF, 0xFE, 0xFF, 0xFF, 0x8E, 0x93, 0xFF, 0xC9, 0x8A, 0xFF, 0xCB, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x7B, 0xFF, 0x35, 0xA4, 0xFF, 0xEE, 0x8A, 0xFF,
-    0xBB, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x83, 0xFF, 0x32, 0x7B, 0xFF, 0x56, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x73, 0xFF, 0x1B, 0x8C, 0xFF, 0x72, 0x62, 0xFF, 0x79, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x72, 0xFF, 0x50, 0x62, 0xFF, 0x33, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x7B, 0xFF, 0x2E, 0x5A, 0xFF, 0x4D, 0x62, 0xFF, 0x2E, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x62, 0xFF, 0xCD, 0x7A, 0xFF, 0x6E, 0xDA, 0xFF, 0xFC, 0xFF, 0xFF, 0x0A, 0x6A, 0xFF, 0x8C, 0x72, 0xFF, 0x2A, 0x72, 0xFF, 0x0A, 0x62, 0xFF, 0x4B, 0x72, 0xFF, 0xAD, 0xFB, 0xFF, 0x6B, 0x8A, 0xFF, 0x2A, 0x62, 0xFF, 0xE5, 0xC9, 0xFF, 0xE2, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0x64, 0x59, 0xFF, 0x61, 0x60, 0xFF, 0xCB, 0xFC, 0xFF, 0xA5, 0x71, 0xFF, 0xE4, 0x91, 0xFF, 0x64, 0x61, 0xFF, 0x65, 0x8A, 0xFF, 0x25, 0x8A, 0xFF, 0x6D, 0xCC, 0xFF, 0x64, 0x71, 0xFF, 0xA5, 0x71, 0xFF, 0x8A, 0xDC, 0xFF, 0x84, 0xA9, 0xFF, 0x64, 0x69, 0xFF, 0x85, 0x69, 0xFF, 0x45, 0xB2, 0xFF, 0x44, 0x51, 0xFF, 0xE3, 0x48, 0xFF, 0x04, 0x61, 0xFF, 0xE7, 0x71, 0xFF, 0x03, 0x49, 0xFF, 0x65, 0x69, 0xFF, 0x28, 0x92, 0xFF, 0x25, 0x49, 0xFF, 0x29, 0xA2, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x59, 0xFF, 0x45, 0x81, 0xFF, 0xCB, 0x8A, 0xFF,
-    0x46, 0x81, 0xFF, 0xB7, 0xFF, 0xFF, 0xA6, 0x51, 0xFF, 0xAB, 0xB2, 0xFF, 0xBE, 0xFF, 0xFF, 0xC7, 0x51, 0xFF, 0xC7, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x9B, 0xFF, 0x2D, 0x8B, 0xFF, 0xFE, 0xFF, 0xFF, 0xEB, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0x13, 0xA4, 0xFF, 0x4F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x9C, 0xFF, 0xCF, 0x7A, 0xFF, 0xF2, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x9B, 0xFF, 0xF8, 0x8B, 0xFF, 0x76, 0x83, 0xFF, 0xF4, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6A, 0xFF, 0xF3, 0x72, 0xFF, 0x90, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x8B, 0xFF, 0xB6, 0x83, 0xFF, 0x2E, 0x62, 0xFF, 0x72, 0xEC, 0xFF, 0x6C, 0x7A, 0xFF, 0x0B, 0x62, 0xFF, 0x2C, 0x62, 0xFF, 0x6D, 0x7A, 0xFF, 0x75, 0xFF, 0xFF, 0x0B, 0x62, 0xFF, 0x2A, 0x6A, 0xFF, 0xCD, 0x72, 0xFF, 0x2B, 0x6A, 0xFF, 0x2C, 0xF3, 0xFF, 0x2B, 0x62, 0xFF, 0x0A, 0x62, 0xFF, 0x4A, 0x62, 0xFF, 0xAE, 0xED, 0xFF, 0xE3, 0x40, 0xFF, 0xA2, 0x40, 0xFF, 0x22, 0xA1, 0xFF, 0x44, 0x69, 0xFF, 0xC2, 0x50, 0xFF, 0xE2, 0xC8, 0xFF, 0x44, 0x69, 0xFF, 0x0A, 0xE4, 0xFF, 0xE7, 0xA9, 0xFF, 0x0A, 0xB3, 0xFF, 0x23, 0x61, 0xFF, 0xF9, 0xFF, 0xFF, 0x64, 0xB9, 0xFF, 0xC8, 0xBA, 0xFF, 0x8A, 0x9A, 0xFF, 0xBB, 0xFF, 0xFF,
-    0x63, 0x91, 0xFF, 0x64, 0x59, 0xFF, 0xC2, 0x48, 0xFF, 0xC6, 0x71, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x59, 0xFF, 0xC2, 0x58, 0xFF, 0x25, 0x59, 0xFF, 0x07, 0x8A, 0xFF, 0xA6, 0x61, 0xFF, 0x08, 0x6A, 0xFF, 0x24, 0x59, 0xFF, 0x44, 0x51, 0xFF, 0x28, 0xBA, 0xFF, 0x2B, 0xB3, 0xFF, 0x04, 0x49, 0xFF, 0x66, 0x59, 0xFF, 0x19, 0xAD, 0xFF, 0xA6, 0x59, 0xFF, 0x90, 0xFE, 0xFF, 0x74, 0xFE, 0xFF, 0x6A, 0x72, 0xFF, 0xC8, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x7A, 0xFF, 0x79, 0x8B, 0xFF, 0xCC, 0x8A, 0xFF, 0xD9, 0xEE, 0xFF, 0xFE, 0xFF, 0xFF, 0xAE, 0xEA, 0xFF, 0x0E, 0x8B, 0xFF, 0x3B, 0xF7, 0xFF, 0x0F, 0x83, 0xFF, 0xFB, 0xF6, 0xFF, 0xF0, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x72, 0xFF, 0x95, 0x8B, 0xFF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x6A, 0xFF, 0xB2, 0x62, 0xFF, 0xD2, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x62, 0xFF, 0x37, 0xA4, 0xFF, 0xBE, 0xFF, 0xFF, 0x6D, 0x72, 0xFF, 0x7D, 0xFE, 0xFF, 0xF3, 0xAB, 0xFF, 0xD0, 0xFB, 0xFF, 0x4D, 0x6A, 0xFF, 0xCD, 0x8A, 0xFF, 0x9D, 0xE5, 0xFF, 0x6C, 0x72, 0xFF, 0x2B, 0xE2, 0xFF, 0x2A, 0x6A, 0xFF, 0x0A, 0x62, 0xFF, 0x34, 0xBC, 0xFF, 0x6D, 0xF3, 0xFF, 0x4A, 0x62, 0xFF, 0x4B, 0x62, 0xFF,
-    0x22, 0x69, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x40, 0xFF, 0xC1, 0x40, 0xFF, 0xC1, 0x48, 0xFF, 0xA7, 0xFA, 0xFF, 0xE2, 0x60, 0xFF, 0xC1, 0x58, 0xFF, 0x0A, 0xE4, 0xFF, 0xE2, 0x60, 0xFF, 0x03, 0xB1, 0xFF, 0x63, 0x69, 0xFF, 0xD4, 0xF6, 0xFF, 0xE5, 0x91, 0xFF, 0x02, 0x69, 0xFF, 0xC6, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x71, 0xFF, 0x24, 0x51, 0xFF, 0x65, 0x61, 0xFF, 0xA5, 0x79, 0xFF, 0x86, 0x61, 0xFF, 0x04, 0x49, 0xFF, 0xA6, 0x61, 0xFF, 0xE3, 0x48, 0xFF, 0xE7, 0x71, 0xFF, 0x45, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0xA6, 0x61, 0xFF, 0xAA, 0x7A, 0xFF, 0x49, 0x7A, 0xFF, 0xC7, 0x61, 0xFF, 0xC7, 0x69, 0xFF, 0x09, 0x7A, 0xFF, 0x66, 0x51, 0xFF, 0x2F, 0xFD, 0xFF, 0xD4, 0xE5, 0xFF, 0xC8, 0x51, 0xFF, 0xC7, 0x51, 0xFF, 0xB2, 0xCC, 0xFF, 0xFB, 0xFF, 0xFF, 0x6A, 0x72, 0xFF, 0x4B, 0x72, 0xFF, 0x2A, 0x7A, 0xFF, 0x6D, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x7A, 0xFF, 0x0E, 0xBB, 0xFF, 0x33, 0xB4, 0xFF, 0x14, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xCC, 0xFF, 0xF5, 0x9B, 0xFF, 0x75, 0x83, 0xFF, 0xFC, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0x83, 0xFF, 0x71, 0x62, 0xFF, 0xF5, 0x72, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x83, 0xFF, 0x14, 0x83, 0xFF, 0xB8, 0xCC, 0xFF,
-    0x39, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x7A, 0xFF, 0x50, 0xF3, 0xFF, 0x2F, 0x83, 0xFF, 0xD9, 0xDD, 0xFF, 0xFB, 0xFF, 0xFF, 0x0A, 0x62, 0xFF, 0x4B, 0x72, 0xFF, 0x2A, 0x6A, 0xFF, 0xD4, 0xD4, 0xFF, 0xB3, 0xD5, 0xFF, 0x0A, 0x7A, 0xFF, 0x0A, 0x5A, 0xFF, 0x6A, 0x62, 0xFF, 0x6A, 0x6A, 0xFF, 0xC2, 0x40, 0xFF, 0x02, 0x41, 0xFF, 0xA5, 0xC1, 0xFF, 0x43, 0x61, 0xFF, 0xE3, 0x58, 0xFF, 0x23, 0x51, 0xFF, 0x07, 0xCB, 0xFF, 0x05, 0xC2, 0xFF, 0x03, 0x69, 0xFF, 0x22, 0x61, 0xFF, 0x66, 0xCA, 0xFF, 0x84, 0x81, 0xFF, 0xE8, 0xC2, 0xFF, 0x63, 0x81, 0xFF, 0x57, 0xFF, 0xFF, 0xE4, 0x99, 0xFF, 0x88, 0xBA, 0xFF, 0xE6, 0x99, 0xFF, 0x24, 0x71, 0xFF, 0x07, 0x72, 0xFF, 0xE2, 0x48, 0xFF, 0xE7, 0x79, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x25, 0x59, 0xFF, 0x65, 0x89, 0xFF, 0x69, 0x82, 0xFF, 0x86, 0x61, 0xFF, 0x66, 0x61, 0xFF, 0xE8, 0x61, 0xFF, 0x49, 0xBA, 0xFF, 0xE7, 0x61, 0xFF, 0xC8, 0xA1, 0xFF, 0x16, 0xFF, 0xFF, 0xE8, 0x61, 0xFF, 0xAB, 0x8A, 0xFF, 0xFD, 0xFF, 0xFF, 0x87, 0x49, 0xFF, 0xA7, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xCB, 0x7A, 0xFF, 0xBA, 0xFF, 0xFF, 0xAB, 0xDA, 0xFF, 0x6C, 0x8B, 0xFF, 0x9B, 0xFF, 0xFF, 0x37, 0xC5, 0xFF, 0x30, 0x93, 0xFF,
-    0x3D, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x7A, 0xFF, 0x33, 0x93, 0xFF, 0x1C, 0xB5, 0xFF, 0x9D, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x83, 0xFF, 0xD3, 0x6A, 0xFF, 0x37, 0x7B, 0xFF, 0x5E, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x83, 0xFF, 0x9B, 0xA4, 0xFF, 0x1D, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x8B, 0xFF, 0x32, 0x73, 0xFF, 0xD0, 0x6A, 0xFF, 0xB3, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0x9C, 0xFF, 0x0A, 0x6A, 0xFF, 0x8C, 0x72, 0xFF, 0x28, 0x62, 0xFF, 0x39, 0xF7, 0xFF, 0x4A, 0x62, 0xFF, 0x4A, 0x6A, 0xFF, 0x2A, 0x5A, 0xFF, 0x8C, 0x6A, 0xFF, 0x0D, 0x8B, 0xFF, 0xB1, 0xAC, 0xFF, 0xA2, 0x58, 0xFF, 0x23, 0x51, 0xFF, 0x4C, 0xE4, 0xFF, 0xE3, 0x50, 0xFF, 0xC5, 0xA1, 0xFF, 0x82, 0x60, 0xFF, 0x85, 0x69, 0xFF, 0xC2, 0x60, 0xFF, 0x02, 0x69, 0xFF, 0x03, 0x79, 0xFF, 0x65, 0x79, 0xFF, 0xE4, 0x89, 0xFF, 0x85, 0x79, 0xFF, 0x66, 0xB2, 0xFF, 0x85, 0x79, 0xFF, 0xBB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE6, 0x99, 0xFF, 0x02, 0x81, 0xFF, 0x2F, 0xE5, 0xFF, 0x08, 0x72, 0xFF, 0x64, 0x59, 0xFF, 0x89, 0x9A, 0xFF, 0x86, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x29, 0x7A, 0xFF, 0xE7, 0x69, 0xFF, 0xA6, 0x61, 0xFF, 0xEC, 0x92, 0xFF, 0x65, 0x61, 0xFF, 0xA7, 0x59, 0xFF,
-    0x49, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x72, 0xFF, 0x0E, 0x9B, 0xFF, 0x3F, 0xFF, 0xFF, 0xE8, 0x51, 0xFF, 0xC8, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xC4, 0xFF, 0x0E, 0x83, 0xFF, 0x5A, 0xA4, 0xFF, 0x8A, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x6A, 0xFF, 0x13, 0xB4, 0xFF, 0xEE, 0x82, 0xFF, 0xDF, 0xFF, 0xFF, 0x7A, 0xB4, 0xFF, 0x2E, 0x72, 0xFF, 0x4F, 0x62, 0xFF, 0x1F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x9C, 0xFF, 0xB4, 0x62, 0xFF, 0x96, 0x8B, 0xFF, 0x9D, 0xCE, 0xFF, 0x9B, 0x8B, 0xFF, 0xD5, 0x6A, 0xFF, 0xF3, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x94, 0xFF, 0x91, 0x6A, 0xFF, 0x52, 0x83, 0xFF, 0xB9, 0xAD, 0xFF, 0x11, 0x83, 0xFF, 0x50, 0x83, 0xFF, 0x2F, 0x83, 0xFF, 0x11, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x62, 0xFF, 0x0A, 0x5A, 0xFF, 0xEC, 0xBA, 0xFF, 0x8B, 0x7A, 0xFF, 0x0C, 0x83, 0xFF, 0x0E, 0xC5, 0xFF, 0x6B, 0x62, 0xFF, 0xEB, 0x7A, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0xAD, 0xFD, 0xFF, 0x03, 0x59, 0xFF, 0xE3, 0x48, 0xFF, 0xE3, 0x50, 0xFF, 0xE7, 0x91, 0xFF, 0xFD, 0xFF, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x71, 0xFF, 0x83, 0x81, 0xFF, 0x94, 0xEE, 0xFF, 0xA4, 0x79, 0xFF, 0xCB, 0xE3, 0xFF, 0xA6, 0x89, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0x69, 0xFF, 0x03, 0x61, 0xFF, 0x85, 0x69, 0xFF, 0x0B, 0xFD, 0xFF, 0xC7, 0x79, 0xFF, 0xA6, 0x61, 0xFF, 0x24, 0x49, 0xFF, 0x08, 0xAA, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x49, 0xFF, 0xA7, 0x59, 0xFF, 0x8A, 0x82, 0xFF, 0xA6, 0x59, 0xFF, 0xCC, 0x7A, 0xFF, 0xA7, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0xA6, 0x61, 0xFF, 0x28, 0x82, 0xFF, 0xC8, 0x59, 0xFF, 0x29, 0x72, 0xFF, 0xFD, 0xFF, 0xFF, 0xE8, 0x59, 0xFF, 0xC8, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x93, 0xFF, 0xB2, 0x8B, 0xFF, 0x6A, 0x72, 0xFF, 0x0E, 0x8B, 0xFF, 0x96, 0xE6, 0xFF, 0x2A, 0x62, 0xFF, 0x33, 0xBC, 0xFF, 0x72, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0xC4, 0xFF, 0x4D, 0x62, 0xFF, 0xCF, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x72, 0xFF, 0x9D, 0xC5, 0xFF, 0x12, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x73, 0xFF, 0xD3, 0x6A, 0xFF, 0xD2, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x72, 0xFF, 0x54, 0x83, 0xFF, 0xD7, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x62, 0xFF, 0x71, 0x8B, 0xFF, 0x10, 0x7B, 0xFF, 0x71, 0xFC, 0xFF, 0x0F, 0x83, 0xFF, 0x2B, 0x62, 0xFF, 0x2B, 0x5A, 0xFF, 0x2B, 0x62, 0xFF, 0x8C, 0xD2, 0xFF, 0x4B, 0x6A, 0xFF, 0x2A, 0x62, 0xFF, 0x4B, 0x62, 0xFF, 0xFE, 0xFF, 0xFF, 0x6B, 0x6A, 0xFF, 0x8B, 0x7A, 0xFF,
-    0x84, 0x79, 0xFF, 0xE2, 0x50, 0xFF, 0xE2, 0x48, 0xFF, 0xA6, 0xA1, 0xFF, 0x41, 0x81, 0xFF, 0x64, 0x81, 0xFF, 0x44, 0x61, 0xFF, 0xE3, 0x58, 0xFF, 0xFA, 0xFF, 0xFF, 0xA8, 0xC2, 0xFF, 0xA5, 0x79, 0xFF, 0xC5, 0x81, 0xFF, 0xB4, 0xF6, 0xFF, 0xA4, 0x89, 0xFF, 0xC6, 0x91, 0xFF, 0x08, 0xB3, 0xFF, 0xFF, 0xF7, 0xFF, 0x66, 0xC2, 0xFF, 0x43, 0x99, 0xFF, 0xE7, 0x91, 0xFF, 0x45, 0xB2, 0xFF, 0x24, 0x61, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x89, 0xA2, 0xFF, 0x24, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0x6F, 0xFB, 0xFF, 0xE8, 0x69, 0xFF, 0xCB, 0x8A, 0xFF, 0xEB, 0xCA, 0xFF, 0x46, 0x51, 0xFF, 0x86, 0x59, 0xFF, 0xB9, 0xFF, 0xFF, 0xEE, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xE8, 0x51, 0xFF, 0xC8, 0x59, 0xFF, 0xFE, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0x75, 0xAC, 0xFF, 0xDC, 0xFF, 0xFF, 0x4C, 0x8A, 0xFF, 0x0D, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x8B, 0xFF, 0xCE, 0xCA, 0xFF, 0x94, 0xEC, 0xFF, 0xEF, 0x82, 0xFF, 0xFE, 0xFF, 0xFF, 0x32, 0xD4, 0xFF, 0x30, 0x83, 0xFF, 0x6E, 0x6A, 0xFF, 0x55, 0xAC, 0xFF, 0xDF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xD2, 0x72, 0xFF, 0xD2, 0x6A, 0xFF, 0xDF, 0xFF, 0xFF, 0x92, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x6A, 0xFF, 0x9B, 0xFF, 0xFF,
-    0xD1, 0x72, 0xFF, 0x6E, 0x62, 0xFF, 0xFC, 0xFF, 0xFF, 0x90, 0xD3, 0xFF, 0x6E, 0x62, 0xFF, 0x8D, 0x72, 0xFF, 0x2A, 0x62, 0xFF, 0x9A, 0xFE, 0xFF, 0x8D, 0x82, 0xFF, 0x2B, 0x6A, 0xFF, 0x2A, 0x62, 0xFF, 0x4A, 0x72, 0xFF, 0xB2, 0xBB, 0xFF, 0x90, 0xF3, 0xFF, 0x6B, 0x6A, 0xFF, 0x6A, 0x62, 0xFF, 0x85, 0x79, 0xFF, 0x24, 0x61, 0xFF, 0xA1, 0x70, 0xFF, 0x03, 0x59, 0xFF, 0xA2, 0x50, 0xFF, 0xC6, 0xE9, 0xFF, 0xA6, 0xD2, 0xFF, 0x23, 0x89, 0xFF, 0x43, 0x61, 0xFF, 0xE6, 0x79, 0xFF, 0xA6, 0xD1, 0xFF, 0xE6, 0x91, 0xFF, 0x85, 0x71, 0xFF, 0x43, 0x69, 0xFF, 0x95, 0xFF, 0xFF, 0xC7, 0xE9, 0xFF, 0x70, 0xA4, 0xFF, 0x69, 0x9A, 0xFF, 0xE6, 0x99, 0xFF, 0xBB, 0xFF, 0xFF, 0xE7, 0x81, 0xFF, 0x64, 0x81, 0xFF, 0xD5, 0xFE, 0xFF, 0x08, 0x6A, 0xFF, 0x04, 0x49, 0xFF, 0x07, 0x7A, 0xFF, 0xE8, 0x61, 0xFF, 0xCC, 0x82, 0xFF, 0xE7, 0x71, 0xFF, 0x6B, 0x7A, 0xFF, 0xC8, 0xF1, 0xFF, 0x25, 0x51, 0xFF, 0xCD, 0xFB, 0xFF, 0xC8, 0x7A, 0xFF, 0x50, 0x93, 0xFF, 0xF7, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0xE8, 0x59, 0xFF, 0xE8, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE9, 0x61, 0xFF, 0xAC, 0x9B, 0xFF, 0x0B, 0xDB, 0xFF, 0xAA, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xBB, 0xFF, 0x8C, 0x82, 0xFF,
-    0x2B, 0x6A, 0xFF, 0xCF, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x6A, 0xFF, 0xAE, 0x72, 0xFF, 0x0D, 0xF3, 0xFF, 0x78, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xD3, 0xFF, 0xF3, 0x7A, 0xFF, 0x37, 0x83, 0xFF, 0x3D, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x82, 0xFF, 0xF3, 0x9A, 0xFF, 0x7D, 0xA5, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0x7B, 0xFF, 0xD0, 0x7A, 0xFF, 0xBA, 0x9B, 0xFF, 0x9A, 0xCD, 0xFF, 0xFA, 0xF6, 0xFF, 0x6C, 0xA2, 0xFF, 0xED, 0x7A, 0xFF, 0xEE, 0x9B, 0xFF, 0x34, 0xE5, 0xFF, 0x0D, 0xAC, 0xFF, 0x4B, 0x62, 0xFF, 0x29, 0x62, 0xFF, 0xAB, 0x6A, 0xFF, 0x0D, 0x73, 0xFF, 0xC2, 0x48, 0xFF, 0x03, 0x49, 0xFF, 0xE4, 0x50, 0xFF, 0x04, 0x51, 0xFF, 0xD3, 0xFF, 0xFF, 0x29, 0x8A, 0xFF, 0xE2, 0x58, 0xFF, 0x82, 0x58, 0xFF, 0x64, 0xB1, 0xFF, 0x07, 0xAA, 0xFF, 0x24, 0x61, 0xFF, 0x03, 0x59, 0xFF, 0xAC, 0xEB, 0xFF, 0xFE, 0xFF, 0xFF, 0x65, 0x69, 0xFF, 0x03, 0x59, 0xFF, 0x44, 0x91, 0xFF, 0x24, 0x89, 0xFF, 0x85, 0x71, 0xFF, 0x49, 0xCA, 0xFF, 0x04, 0x59, 0xFF, 0xCA, 0xBA, 0xFF, 0xEB, 0xAA, 0xFF, 0xC7, 0x61, 0xFF, 0x65, 0x51, 0xFF, 0x25, 0x49, 0xFF, 0x4D, 0xAB, 0xFF, 0x65, 0x51, 0xFF, 0xE7, 0x61, 0xFF, 0x6B, 0x82, 0xFF, 0x66, 0x51, 0xFF, 0x87, 0x61, 0xFF,
-    0xC7, 0x69, 0xFF, 0x6A, 0x92, 0xFF, 0xCC, 0x82, 0xFF, 0x4F, 0xBB, 0xFF, 0xDD, 0xFF, 0xFF, 0xE8, 0x59, 0xFF, 0x66, 0x41, 0xFF, 0xDF, 0xFF, 0xFF, 0xB2, 0xD4, 0xFF, 0xEC, 0x8A, 0xFF, 0x49, 0x6A, 0xFF, 0x6A, 0x7A, 0xFF, 0xDD, 0xFF, 0xFF, 0xEC, 0x92, 0xFF, 0xFE, 0xFF, 0xFF, 0x2A, 0x6A, 0xFF, 0x6C, 0x9B, 0xFF, 0xFD, 0xFF, 0xFF, 0xAB, 0x72, 0xFF, 0x0A, 0x62, 0xFF, 0x8F, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xD6, 0xFF, 0xD0, 0x7A, 0xFF, 0xF2, 0x82, 0xFF, 0xFE, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x83, 0xFF, 0x92, 0x6A, 0xFF, 0x37, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xD6, 0xFF, 0x36, 0x7B, 0xFF, 0x50, 0x62, 0xFF, 0xFB, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x7B, 0xFF, 0xCF, 0x6A, 0xFF, 0x8D, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xC5, 0xFF, 0x8B, 0x72, 0xFF, 0x4A, 0x62, 0xFF, 0x4B, 0x62, 0xFF, 0x2F, 0x83, 0xFF, 0x8D, 0x82, 0xFF, 0xAF, 0x8B, 0xFF, 0xAD, 0x7A, 0xFF, 0xC2, 0x60, 0xFF, 0xE3, 0x70, 0xFF, 0x28, 0xFB, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0x64, 0x89, 0xFF, 0x06, 0xBA, 0xFF, 0xDE, 0xFF, 0xFF, 0x04, 0x61, 0xFF, 0x07, 0x9A, 0xFF, 0x4D, 0xF5, 0xFF, 0xEA, 0xDB, 0xFF, 0x84, 0x79, 0xFF, 0x24, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE6, 0x81, 0xFF, 0xA5, 0x71, 0xFF, 0x69, 0xF3, 0xFF, 0xAA, 0xEB, 0xFF, 0x44, 0x59, 0xFF, 0x8C, 0xFB, 0xFF, 0x66, 0x51, 0xFF, 0x46, 0xA1, 0xFF, 0x69, 0x9A, 0xFF, 0x25, 0x49, 0xFF, 0xAB, 0x7A, 0xFF, 0x24, 0x61, 0xFF, 0xA6, 0x61, 0xFF, 0x29, 0x72, 0xFF, 0x8A, 0xD2, 0xFF, 0x29, 0x82, 0xFF, 0x86, 0x59, 0xFF, 0x8F, 0xDC, 0xFF, 0x49, 0x72, 0xFF, 0xB0, 0xAB, 0xFF, 0x30, 0xD5, 0xFF, 0xE8, 0x59, 0xFF, 0x66, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xA3, 0xFF, 0x4D, 0x93, 0xFF, 0xEF, 0xD4, 0xFF, 0xAB, 0x8A, 0xFF, 0xFB, 0xFF, 0xFF, 0xAD, 0xBB, 0xFF, 0x6D, 0x72, 0xFF, 0xEB, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x8B, 0xFF, 0x2F, 0x83, 0xFF, 0x4E, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xB4, 0xFF, 0x34, 0xCC, 0xFF, 0xAE, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xEE, 0xFF, 0xD2, 0x72, 0xFF, 0xB0, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x6A, 0xFF, 0x34, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x95, 0x83, 0xFF, 0x8F, 0x82, 0xFF, 0x71, 0xBC, 0xFF, 0xD3, 0xD5, 0xFF, 0xD0, 0xAB, 0xFF, 0x0E, 0x7B, 0xFF, 0x8C, 0x6A, 0xFF, 0x6C, 0xBB, 0xFF, 0xAA, 0x7A, 0xFF, 0x8B, 0x6A, 0xFF, 0x0D, 0xC3, 0xFF, 0xFE, 0xFF, 0xFF, 0x4B, 0x62, 0xFF, 0x18, 0xDE, 0xFF,
-    0x02, 0x71, 0xFF, 0x84, 0x89, 0xFF, 0x8A, 0xAB, 0xFF, 0x03, 0x59, 0xFF, 0xED, 0xCC, 0xFF, 0xCE, 0xF5, 0xFF, 0x03, 0x59, 0xFF, 0x69, 0x9A, 0xFF, 0x89, 0xD2, 0xFF, 0xA5, 0xA9, 0xFF, 0xC5, 0xA1, 0xFF, 0xE2, 0x68, 0xFF, 0x2A, 0x9B, 0xFF, 0x97, 0xFF, 0xFF, 0x85, 0x79, 0xFF, 0x85, 0x71, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x59, 0xFF, 0xFE, 0xFF, 0xFF, 0x72, 0xFE, 0xFF, 0xA6, 0x79, 0xFF, 0x15, 0xDE, 0xFF, 0xA6, 0x71, 0xFF, 0x0C, 0xD3, 0xFF, 0x23, 0x49, 0xFF, 0x28, 0x6A, 0xFF, 0xA6, 0x59, 0xFF, 0xA3, 0x70, 0xFF, 0xC8, 0x69, 0xFF, 0x66, 0x59, 0xFF, 0x29, 0x6A, 0xFF, 0x10, 0xFC, 0xFF, 0x48, 0x6A, 0xFF, 0x0B, 0x8B, 0xFF, 0xC8, 0x69, 0xFF, 0xFE, 0xFF, 0xFF, 0xC8, 0x59, 0xFF, 0xA7, 0x51, 0xFF, 0x96, 0xFF, 0xFF, 0xE9, 0x69, 0xFF, 0x8D, 0x7A, 0xFF, 0x11, 0xDD, 0xFF, 0xD0, 0xDB, 0xFF, 0x29, 0x72, 0xFF, 0x0A, 0x6A, 0xFF, 0xE9, 0x69, 0xFF, 0x72, 0xEC, 0xFF, 0xAC, 0x82, 0xFF, 0xCD, 0x82, 0xFF, 0x4B, 0xA2, 0xFF, 0xF3, 0xE4, 0xFF, 0xCD, 0x82, 0xFF, 0x15, 0xFF, 0xFF, 0x50, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x9A, 0xFF, 0x6E, 0x72, 0xFF, 0x92, 0xF3, 0xFF, 0x97, 0xE6, 0xFF, 0x8E, 0x6A, 0xFF, 0x0E, 0x5A, 0xFF, 0x50, 0xFB, 0xFF, 0x54, 0xB5, 0xFF,
-    0x6D, 0x6A, 0xFF, 0x50, 0xAB, 0xFF, 0x8E, 0x6A, 0xFF, 0xCA, 0x61, 0xFF, 0x13, 0xA4, 0xFF, 0x2B, 0x62, 0xFF, 0x4B, 0x62, 0xFF, 0x8C, 0x7A, 0xFF, 0x4A, 0x62, 0xFF, 0x2A, 0x62, 0xFF, 0xAB, 0x92, 0xFF, 0x4A, 0x6A, 0xFF, 0x2A, 0x62, 0xFF, 0x2A, 0x62, 0xFF, 0xAC, 0x92, 0xFF, 0x4A, 0x62, 0xFF, 0xC2, 0x48, 0xFF, 0x23, 0x51, 0xFF, 0x85, 0x61, 0xFF, 0xE3, 0x50, 0xFF, 0x06, 0xFA, 0xFF, 0xC2, 0x58, 0xFF, 0x03, 0x51, 0xFF, 0xC6, 0x71, 0xFF, 0x86, 0x69, 0xFF, 0xE3, 0x68, 0xFF, 0xC6, 0x81, 0xFF, 0xE6, 0x89, 0xFF, 0x64, 0x79, 0xFF, 0x03, 0x61, 0xFF, 0x44, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0xE3, 0xFF, 0x08, 0x8A, 0xFF, 0x24, 0x69, 0xFF, 0x45, 0x71, 0xFF, 0x24, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0x2A, 0xD2, 0xFF, 0x49, 0x82, 0xFF, 0x86, 0x61, 0xFF, 0xA6, 0x61, 0xFF, 0x66, 0x59, 0xFF, 0x87, 0x61, 0xFF, 0x45, 0x51, 0xFF, 0x46, 0xA1, 0xFF, 0x86, 0x59, 0xFF, 0x29, 0x72, 0xFF, 0xA7, 0x81, 0xFF, 0x25, 0x61, 0xFF, 0x0E, 0x8B, 0xFF, 0x0F, 0xAC, 0xFF, 0xDE, 0xFF, 0xFF, 0xE9, 0x59, 0xFF, 0xC8, 0x51, 0xFF, 0x1B, 0xBD, 0xFF, 0x4B, 0x6A, 0xFF, 0x2A, 0x72, 0xFF, 0xCD, 0x82, 0xFF, 0x51, 0xAC, 0xFF, 0x8B, 0x82, 0xFF, 0x4D, 0xBC, 0xFF, 0x91, 0xE4, 0xFF, 0x4B, 0x7A, 0xFF,
-    0x0A, 0x72, 0xFF, 0x4D, 0xBB, 0xFF, 0x8C, 0xB2, 0xFF, 0xCC, 0x8A, 0xFF, 0x6C, 0x82, 0xFF, 0x6C, 0xEA, 0xFF, 0x4B, 0x82, 0xFF, 0x4C, 0x8A, 0xFF, 0xAE, 0xCA, 0xFF, 0x4C, 0x82, 0xFF, 0x2C, 0x6A, 0xFF, 0xCB, 0x71, 0xFF, 0x8D, 0x92, 0xFF, 0xF1, 0xCA, 0xFF, 0x0C, 0x5A, 0xFF, 0x4B, 0x72, 0xFF, 0xAE, 0x7A, 0xFF, 0xAD, 0x7A, 0xFF, 0x15, 0xED, 0xFF, 0x0B, 0x62, 0xFF, 0x6B, 0x6A, 0xFF, 0x4A, 0x62, 0xFF, 0x4B, 0x7A, 0xFF, 0xCE, 0x8A, 0xFF, 0x6A, 0x6A, 0xFF, 0x2A, 0x62, 0xFF, 0x29, 0x62, 0xFF, 0x2A, 0x72, 0xFF, 0x4E, 0xA3, 0xFF, 0x6B, 0x92, 0xFF, 0x6B, 0x6A, 0xFF, 0x2A, 0x62, 0xFF, 0x07, 0xA2, 0xFF, 0x4B, 0xCB, 0xFF, 0x28, 0xEA, 0xFF, 0x23, 0x51, 0xFF, 0xA2, 0x68, 0xFF, 0xE7, 0xF9, 0xFF, 0xE6, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x61, 0xFF, 0xE8, 0xC2, 0xFF, 0x09, 0xEB, 0xFF, 0x23, 0x71, 0xFF, 0x6E, 0xFC, 0xFF, 0x85, 0x71, 0xFF, 0xAB, 0xFC, 0xFF, 0x28, 0xFA, 0xFF, 0xA5, 0x91, 0xFF, 0x04, 0x71, 0xFF, 0xCD, 0xEB, 0xFF, 0x27, 0x61, 0xFF, 0x89, 0xBA, 0xFF, 0x6D, 0xEB, 0xFF, 0x25, 0x51, 0xFF, 0x2E, 0x93, 0xFF, 0x09, 0xB2, 0xFF, 0x6A, 0xF2, 0xFF, 0x65, 0x69, 0xFF, 0xEA, 0x99, 0xFF, 0x25, 0x49, 0xFF, 0x25, 0x51, 0xFF, 0xEF, 0xDB, 0xFF, 0xED, 0x92, 0xFF,
-    0xE9, 0x69, 0xFF, 0xFD, 0xFF, 0xFF, 0xE8, 0x69, 0xFF, 0x58, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x59, 0xFF, 0xA8, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x82, 0xFF, 0x2D, 0xBB, 0xFF, 0xD4, 0xED, 0xFF, 0xC7, 0x71, 0xFF, 0x0A, 0x6A, 0xFF, 0xAB, 0xE2, 0xFF, 0x51, 0xF4, 0xFF, 0x53, 0xED, 0xFF, 0x8E, 0xFB, 0xFF, 0xC9, 0x79, 0xFF, 0xC9, 0x79, 0xFF, 0xDB, 0xF6, 0xFF, 0x19, 0xF6, 0xFF, 0x0A, 0x7A, 0xFF, 0x94, 0xFF, 0xFF, 0x0E, 0xC3, 0xFF, 0x34, 0xF5, 0xFF, 0x79, 0xFF, 0xFF, 0xC9, 0x99, 0xFF, 0x8B, 0x7A, 0xFF, 0xBB, 0xFF, 0xFF, 0x98, 0xF5, 0xFF, 0xB6, 0xE5, 0xFF, 0x8E, 0x7A, 0xFF, 0xED, 0xB2, 0xFF, 0xBE, 0xFF, 0xFF, 0x55, 0xDD, 0xFF, 0xEC, 0xD2, 0xFF, 0x71, 0xA3, 0xFF, 0x0F, 0xAD, 0xFF, 0x74, 0xF6, 0xFF, 0xDF, 0xFF, 0xFF, 0x6A, 0x7A, 0xFF, 0xAC, 0xDA, 0xFF, 0xD0, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xFD, 0xFF, 0xE6, 0x81, 0xFF, 0xE5, 0xD9, 0xFF, 0xA7, 0x99, 0xFF, 0x04, 0x59, 0xFF, 0xE6, 0xC1, 0xFF, 0xA5, 0x89, 0xFF, 0xE7, 0xEA, 0xFF, 0x87, 0xD2, 0xFF, 0x02, 0x79, 0xFF, 0x8A, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xDC, 0xFF, 0x07, 0x8A, 0xFF, 0xED, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xD5, 0xFF,
-    0x45, 0x71, 0xFF, 0x44, 0x69, 0xFF, 0xCC, 0xFC, 0xFF, 0x66, 0x91, 0xFF, 0x09, 0x7A, 0xFF, 0xE7, 0x79, 0xFF, 0xC7, 0xE1, 0xFF, 0x6A, 0xBA, 0xFF, 0x87, 0x61, 0xFF, 0xA8, 0x51, 0xFF, 0x45, 0x69, 0xFF, 0xCB, 0xFA, 0xFF, 0x89, 0x59, 0xFF, 0x05, 0x49, 0xFF, 0x46, 0x51, 0xFF, 0x70, 0xC3, 0xFF, 0x6A, 0x7A, 0xFF, 0x67, 0x51, 0xFF, 0x08, 0x72, 0xFF, 0x8B, 0xF2, 0xFF, 0x85, 0x71, 0xFF, 0xC8, 0x51, 0xFF, 0xA8, 0x51, 0xFF, 0x4C, 0x8A, 0xFF, 0xB0, 0xE3, 0xFF, 0x6A, 0x8A, 0xFF, 0xA9, 0x61, 0xFF, 0xC9, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x69, 0xFF, 0x87, 0x61, 0xFF, 0xC9, 0x79, 0xFF, 0xFC, 0xFF, 0xFF, 0x4A, 0xA2, 0xFF, 0x4A, 0x92, 0xFF, 0xAC, 0xA2, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xBB, 0xFF, 0x0A, 0x8A, 0xFF, 0xEF, 0xE3, 0xFF, 0x97, 0xF6, 0xFF, 0xAB, 0xA2, 0xFF, 0x0A, 0x82, 0xFF, 0xD4, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x92, 0xFF, 0x55, 0xDE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xD6, 0xFF, 0xCC, 0x82, 0xFF, 0xCC, 0x8B, 0xFF, 0xFE, 0xFF, 0xFF, 0x8F, 0x8B, 0xFF, 0xFF, 0xF7, 0xFF, 0xCE, 0x9B, 0xFF, 0x28, 0x6A, 0xFF, 0xFD, 0xFF, 0xFF, 0x2F, 0x9C, 0xFF, 0xFF, 0xF7, 0xFF, 0x99, 0xEF, 0xFF, 0xAD, 0x7B, 0xFF, 0xD7, 0xFF, 0xFF,
-    0x86, 0x71, 0xFF, 0xC4, 0x89, 0xFF, 0x44, 0x89, 0xFF, 0xD7, 0xFF, 0xFF, 0xC4, 0x89, 0xFF, 0xE7, 0xE2, 0xFF, 0x49, 0xBB, 0xFF, 0x85, 0x81, 0xFF, 0xE6, 0xA1, 0xFF, 0x29, 0xBB, 0xFF, 0xC5, 0xD2, 0xFF, 0x2A, 0xBB, 0xFF, 0xC6, 0x89, 0xFF, 0x93, 0xF5, 0xFF, 0xFE, 0xFF, 0xFF, 0x44, 0x81, 0xFF, 0x26, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0xE3, 0xFF, 0x24, 0x59, 0xFF, 0xC9, 0xC2, 0xFF, 0x67, 0xEA, 0xFF, 0x25, 0x51, 0xFF, 0x68, 0x92, 0xFF, 0x49, 0xAA, 0xFF, 0xC8, 0xE1, 0xFF, 0x65, 0x61, 0xFF, 0x04, 0x59, 0xFF, 0x6A, 0xE2, 0xFF, 0x86, 0x71, 0xFF, 0x46, 0x51, 0xFF, 0x46, 0x59, 0xFF, 0x54, 0xFE, 0xFF, 0x86, 0x59, 0xFF, 0x6A, 0x92, 0xFF, 0x4B, 0x7A, 0xFF, 0xEE, 0x92, 0xFF, 0xC9, 0x59, 0xFF, 0xA8, 0x51, 0xFF, 0xD2, 0x82, 0xFF, 0xEA, 0x61, 0xFF, 0xAC, 0x8A, 0xFF, 0x6D, 0x72, 0xFF, 0xD8, 0xEE, 0xFF, 0xAC, 0x92, 0xFF, 0x4A, 0x7A, 0xFF, 0x8D, 0xBB, 0xFF, 0x31, 0xFC, 0xFF, 0x09, 0x7A, 0xFF, 0x29, 0x7A, 0xFF, 0x2D, 0xFB, 0xFF, 0xE9, 0x89, 0xFF, 0xE9, 0x79, 0xFF, 0x68, 0x81, 0xFF, 0x2A, 0xD2, 0xFF, 0x4D, 0xB3, 0xFF, 0x4B, 0x82, 0xFF, 0x8A, 0xBA, 0xFF, 0x99, 0xFF, 0xFF, 0x46, 0x69, 0xFF, 0x09, 0x6A, 0xFF, 0xED, 0xA2, 0xFF, 0xCC, 0xA2, 0xFF, 0xC9, 0x61, 0xFF,
-    0x8B, 0x7A, 0xFF, 0x6B, 0x8A, 0xFF, 0x0A, 0x62, 0xFF, 0xE9, 0x61, 0xFF, 0x29, 0x6A, 0xFF, 0x29, 0x6A, 0xFF, 0x6A, 0x72, 0xFF, 0xE9, 0x69, 0xFF, 0x4A, 0x6A, 0xFF, 0x09, 0x62, 0xFF, 0xAA, 0x82, 0xFF, 0x4A, 0x72, 0xFF, 0xCA, 0xE2, 0xFF, 0x09, 0x62, 0xFF, 0x49, 0x9A, 0xFF, 0x09, 0x6A, 0xFF, 0xC3, 0x88, 0xFF, 0x03, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0xA6, 0x79, 0xFF, 0x83, 0x61, 0xFF, 0x66, 0x69, 0xFF, 0x85, 0x61, 0xFF, 0xEF, 0xBB, 0xFF, 0x86, 0x69, 0xFF, 0xC5, 0x79, 0xFF, 0xE8, 0x89, 0xFF, 0x4A, 0x8A, 0xFF, 0xA4, 0x69, 0xFF, 0x86, 0x69, 0xFF, 0xCC, 0xEB, 0xFF, 0xFE, 0xFF, 0xFF, 0xA6, 0x69, 0xFF, 0x49, 0x9A, 0xFF, 0x70, 0xFD, 0xFF, 0x25, 0x59, 0xFF, 0x6A, 0xDA, 0xFF, 0xAC, 0xD4, 0xFF, 0x67, 0x59, 0xFF, 0x49, 0x8A, 0xFF, 0x10, 0xEC, 0xFF, 0x51, 0xA3, 0xFF, 0x26, 0x51, 0xFF, 0xED, 0xDA, 0xFF, 0xEA, 0x69, 0xFF, 0x2A, 0x7A, 0xFF, 0xF8, 0xFF, 0xFF, 0x51, 0x9B, 0xFF, 0x27, 0x59, 0xFF, 0xF9, 0xF6, 0xFF, 0xA9, 0x71, 0xFF, 0xBB, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x59, 0xFF, 0xA9, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0x83, 0xFF, 0x8D, 0x8A, 0xFF, 0xFE, 0xFF, 0xFF, 0x70, 0x7A, 0xFF, 0xAD, 0x8A, 0xFF, 0xDD, 0xFF, 0xFF, 0x2A, 0x72, 0xFF, 0xE9, 0x69, 0xFF,
-    0xAE, 0xF3, 0xFF, 0x6A, 0xBA, 0xFF, 0x0A, 0x8A, 0xFF, 0x09, 0xD2, 0xFF, 0x6F, 0xEB, 0xFF, 0xC8, 0x91, 0xFF, 0x2F, 0xF4, 0xFF, 0xEF, 0xF5, 0xFF, 0xA8, 0x79, 0xFF, 0xBC, 0xFF, 0xFF, 0x8B, 0xC2, 0xFF, 0x88, 0x79, 0xFF, 0x78, 0xFF, 0xFF, 0xE6, 0xA1, 0xFF, 0xC8, 0x69, 0xFF, 0xA8, 0x61, 0xFF, 0x6C, 0x92, 0xFF, 0xE9, 0x71, 0xFF, 0xA7, 0x69, 0xFF, 0x6E, 0xBB, 0xFF, 0xCC, 0xCA, 0xFF, 0x28, 0x9A, 0xFF, 0xC8, 0xC1, 0xFF, 0xE9, 0xB9, 0xFF, 0x66, 0x89, 0xFF, 0x8C, 0xFB, 0xFF, 0x33, 0xFF, 0xFF, 0xA8, 0x61, 0xFF, 0x2A, 0xCA, 0xFF, 0x66, 0x89, 0xFF, 0x49, 0x6A, 0xFF, 0xAA, 0xD2, 0xFF, 0xE3, 0x40, 0xFF, 0x04, 0x41, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0xA6, 0x61, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0xC6, 0x69, 0xFF, 0x45, 0x51, 0xFF, 0x86, 0x69, 0xFF, 0x69, 0x82, 0xFF, 0x86, 0x69, 0xFF, 0xA6, 0x69, 0xFF, 0x24, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x66, 0x59, 0xFF, 0x0D, 0x93, 0xFF, 0x45, 0x59, 0xFF, 0x86, 0x61, 0xFF, 0x25, 0x59, 0xFF, 0x04, 0x49, 0xFF, 0xC8, 0x61, 0xFF, 0x87, 0x61, 0xFF, 0x46, 0x59, 0xFF, 0xA8, 0x69, 0xFF, 0x66, 0x51, 0xFF, 0x08, 0x72, 0xFF, 0x66, 0x59, 0xFF, 0x25, 0x51, 0xFF, 0xE4, 0x48, 0xFF, 0xC8, 0x61, 0xFF,
-    0xE9, 0x71, 0xFF, 0x67, 0x59, 0xFF, 0x87, 0x61, 0xFF, 0x2A, 0x7A, 0xFF, 0x2A, 0x62, 0xFF, 0x88, 0x51, 0xFF, 0x67, 0x49, 0xFF, 0xEB, 0x59, 0xFF, 0x0B, 0x6A, 0xFF, 0xC9, 0x61, 0xFF, 0xA9, 0x59, 0xFF, 0xEA, 0x69, 0xFF, 0x4A, 0x7A, 0xFF, 0x4A, 0x8A, 0xFF, 0x67, 0x61, 0xFF, 0xE9, 0x69, 0xFF, 0xA8, 0x69, 0xFF, 0xC8, 0x71, 0xFF, 0xA8, 0x71, 0xFF, 0x87, 0x69, 0xFF, 0xC8, 0x71, 0xFF, 0xC8, 0x69, 0xFF, 0xA8, 0x69, 0xFF, 0xA8, 0x71, 0xFF, 0xA8, 0x69, 0xFF, 0xE9, 0x71, 0xFF, 0x67, 0x61, 0xFF, 0x46, 0x59, 0xFF, 0x87, 0x61, 0xFF, 0x87, 0x59, 0xFF, 0xE9, 0x69, 0xFF, 0xA8, 0x61, 0xFF, 0xE8, 0x61, 0xFF, 0xC8, 0x61, 0xFF, 0xC8, 0x69, 0xFF, 0xC8, 0x69, 0xFF, 0xE8, 0x61, 0xFF, 0xE8, 0x69, 0xFF, 0xC8, 0x61, 0xFF, 0xE8, 0x69, 0xFF, 0xA7, 0x59, 0xFF, 0x09, 0x62, 0xFF, 0x0A, 0x62, 0xFF, 0x87, 0x59, 0xFF, 0x29, 0x6A, 0xFF, 0xA7, 0x51, 0xFF, 0x29, 0x62, 0xFF, 0x29, 0x62, 0xFF, 0xA1, 0x40, 0xFF, 0x45, 0xBA, 0xFF, 0x48, 0xB2, 0xFF, 0xA4, 0x99, 0xFF, 0x47, 0xD2, 0xFF, 0xEA, 0xDA, 0xFF, 0x29, 0xDB, 0xFF, 0x86, 0xDB, 0xFF, 0xE5, 0x91, 0xFF, 0xB0, 0xFF, 0xFF, 0x77, 0xFF, 0xFF, 0x8D, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x68, 0xFA, 0xFF, 0x6B, 0xFC, 0xFF,
-    0xA4, 0x99, 0xFF, 0xA8, 0xC2, 0xFF, 0x2F, 0xEC, 0xFF, 0x85, 0x89, 0xFF, 0x27, 0xC2, 0xFF, 0x41, 0x80, 0xFF, 0x4A, 0xFB, 0xFF, 0xA6, 0x81, 0xFF, 0x65, 0x59, 0xFF, 0xCB, 0xF3, 0xFF, 0xCC, 0xFB, 0xFF, 0x69, 0x9A, 0xFF, 0x45, 0x51, 0xFF, 0x25, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0xFC, 0xFF, 0x25, 0x51, 0xFF, 0x66, 0x59, 0xFF, 0x0D, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x61, 0xFF, 0x87, 0x51, 0xFF, 0x87, 0x49, 0xFF, 0x6C, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x79, 0xFF, 0xA8, 0x59, 0xFF, 0xC9, 0x69, 0xFF, 0xD4, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x82, 0xFF, 0xA8, 0x61, 0xFF, 0x0D, 0x9B, 0xFF, 0xCC, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x79, 0xFF, 0x0D, 0xE3, 0xFF, 0xAC, 0xCA, 0xFF, 0x8D, 0xDA, 0xFF, 0x0E, 0xE3, 0xFF, 0x67, 0x71, 0xFF, 0x2E, 0xCB, 0xFF, 0xE8, 0xC1, 0xFF, 0x2F, 0xE3, 0xFF, 0xE4, 0x98, 0xFF, 0x34, 0xFE, 0xFF, 0xF9, 0xFF, 0xFF, 0xC7, 0xC9, 0xFF, 0xD0, 0xE3, 0xFF, 0xD9, 0xFF, 0xFF, 0x39, 0xFF, 0xFF, 0xCD, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xF5, 0xFF, 0x68, 0x82, 0xFF, 0x50, 0xF5, 0xFF, 0x2B, 0xBC, 0xFF, 0x2A, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x62, 0xFF, 0xAC, 0xDB, 0xFF, 0x07, 0x62, 0xFF, 0xFA, 0xFF, 0xFF, 0xCA, 0x92, 0xFF,
-    0xE2, 0x60, 0xFF, 0x64, 0xA9, 0xFF, 0x88, 0xA2, 0xFF, 0xE0, 0x80, 0xFF, 0x06, 0x93, 0xFF, 0x05, 0x61, 0xFF, 0x66, 0x7A, 0xFF, 0x62, 0x69, 0xFF, 0x88, 0x92, 0xFF, 0xC9, 0xE3, 0xFF, 0x89, 0xBB, 0xFF, 0x6F, 0xBC, 0xFF, 0x08, 0xAB, 0xFF, 0x45, 0x92, 0xFF, 0x66, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFE, 0xFF, 0xE5, 0xA9, 0xFF, 0x9C, 0xFF, 0xFF, 0xCC, 0xDA, 0xFF, 0x48, 0xDC, 0xFF, 0x38, 0xFF, 0xFF, 0x93, 0xF4, 0xFF, 0x09, 0xB2, 0xFF, 0x04, 0xA1, 0xFF, 0x0D, 0xDB, 0xFF, 0xD1, 0xFD, 0xFF, 0x4F, 0xD3, 0xFF, 0x26, 0x59, 0xFF, 0x94, 0xFE, 0xFF, 0x36, 0xFF, 0xFF, 0xA7, 0x69, 0xFF, 0xEF, 0xE3, 0xFF, 0xFE, 0xFF, 0xFF, 0x46, 0x79, 0xFF, 0xEF, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x6A, 0xFF, 0x67, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x8B, 0xFF, 0x2E, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xD3, 0xFF, 0x8B, 0x8A, 0xFF, 0xFD, 0xFF, 0xFF, 0x1A, 0xF7, 0xFF, 0x46, 0x61, 0xFF, 0x93, 0xF4, 0xFF, 0xF7, 0xFF, 0xFF, 0xED, 0xF2, 0xFF, 0xB3, 0xFD, 0xFF, 0x68, 0xCA, 0xFF, 0x4D, 0xFB, 0xFF, 0xAA, 0xF2, 0xFF, 0x92, 0xFE, 0xFF, 0x09, 0xE2, 0xFF, 0xCC, 0xF2, 0xFF, 0x09, 0xC3, 0xFF, 0xDC, 0xFF, 0xFF, 0xEF, 0xF4, 0xFF, 0xAE, 0xEB, 0xFF, 0x08, 0x9A, 0xFF, 0x49, 0x9A, 0xFF,
-    0x86, 0x71, 0xFF, 0x68, 0x92, 0xFF, 0x49, 0xA2, 0xFF, 0xAA, 0xB2, 0xFF, 0x27, 0x92, 0xFF, 0xCA, 0xBA, 0xFF, 0x2C, 0xBB, 0xFF, 0x08, 0x92, 0xFF, 0x86, 0x89, 0xFF, 0x29, 0xD2, 0xFF, 0x4E, 0xFD, 0xFF, 0x08, 0x92, 0xFF, 0x09, 0x92, 0xFF, 0x0F, 0xFC, 0xFF, 0xE8, 0x69, 0xFF, 0x8A, 0xAA, 0xFF, 0xE2, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x41, 0xFF, 0x24, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0x24, 0x51, 0xFF, 0xA6, 0x69, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0x03, 0x51, 0xFF, 0x85, 0x61, 0xFF, 0xA6, 0x61, 0xFF, 0x45, 0x59, 0xFF, 0x86, 0x61, 0xFF, 0x86, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x86, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x66, 0x59, 0xFF, 0x26, 0x51, 0xFF, 0xA7, 0x61, 0xFF, 0x66, 0x59, 0xFF, 0x66, 0x59, 0xFF, 0x66, 0x51, 0xFF, 0x46, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0xA8, 0x61, 0xFF, 0x8D, 0x72, 0xFF, 0x67, 0x49, 0xFF, 0x66, 0x41, 0xFF, 0xA9, 0x51, 0xFF, 0x88, 0x51, 0xFF, 0xA8, 0x59, 0xFF, 0x88, 0x51, 0xFF, 0xC8, 0x61, 0xFF, 0xA7, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x86, 0x61, 0xFF, 0xA8, 0x69, 0xFF,
-    0x86, 0x61, 0xFF, 0x87, 0x61, 0xFF, 0x87, 0x61, 0xFF, 0x46, 0x59, 0xFF, 0x46, 0x59, 0xFF, 0x87, 0x69, 0xFF, 0xE8, 0x71, 0xFF, 0x87, 0x61, 0xFF, 0x66, 0x59, 0xFF, 0x67, 0x61, 0xFF, 0x66, 0x61, 0xFF, 0x66, 0x59, 0xFF, 0x46, 0x51, 0xFF, 0x46, 0x51, 0xFF, 0x46, 0x51, 0xFF, 0x46, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0xC7, 0x61, 0xFF, 0xA7, 0x61, 0xFF, 0x87, 0x51, 0xFF, 0xC7, 0x61, 0xFF, 0xA7, 0x59, 0xFF, 0xA7, 0x59, 0xFF, 0xA7, 0x59, 0xFF, 0xA7, 0x51, 0xFF, 0xC8, 0x59, 0xFF, 0xC8, 0x59, 0xFF, 0xC8, 0x59, 0xFF, 0xE8, 0x59, 0xFF, 0xE3, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x41, 0xFF, 0x03, 0x41, 0xFF, 0xE3, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x24, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x65, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x65, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x25, 0x49, 0xFF, 0x65, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x86, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0x66, 0x51, 0xFF,
-    0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x25, 0x49, 0xFF, 0xC7, 0x61, 0xFF, 0x87, 0x51, 0xFF, 0x46, 0x49, 0xFF, 0x05, 0x39, 0xFF, 0x67, 0x51, 0xFF, 0x67, 0x51, 0xFF, 0x67, 0x51, 0xFF, 0x26, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x46, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0x66, 0x59, 0xFF, 0x25, 0x51, 0xFF, 0x66, 0x59, 0xFF, 0x46, 0x59, 0xFF, 0x05, 0x49, 0xFF, 0x66, 0x59, 0xFF, 0x66, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0x46, 0x51, 0xFF, 0x46, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0x46, 0x51, 0xFF, 0x46, 0x49, 0xFF, 0x26, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x46, 0x51, 0xFF, 0x66, 0x59, 0xFF, 0x66, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0xA7, 0x61, 0xFF, 0x66, 0x51, 0xFF, 0x87, 0x59, 0xFF, 0xA7, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0xA7, 0x59, 0xFF, 0xC7, 0x59, 0xFF, 0xA7, 0x51, 0xFF, 0xC8, 0x59, 0xFF, 0xC8, 0x59, 0xFF, 0x2C, 0xFC, 0xFF, 0xAA, 0xDB, 0xFF, 0x64, 0x59, 0xFF, 0x26, 0x8A, 0xFF, 0x27, 0xDC, 0xFF, 0xA6, 0x61, 0xFF, 0x84, 0x59, 0xFF, 0x63, 0x59, 0xFF, 0x61, 0x49, 0xFF, 0x05, 0x72, 0xFF, 0x66, 0x6A, 0xFF, 0x83, 0x61, 0xFF, 0x24, 0x72, 0xFF, 0x25, 0x82, 0xFF, 0xC8, 0x8A, 0xFF, 0x88, 0xB3, 0xFF,
-    0xB5, 0xEE, 0xFF, 0x25, 0xAA, 0xFF, 0x24, 0x81, 0xFF, 0x63, 0x99, 0xFF, 0xCA, 0xC3, 0xFF, 0xE5, 0x99, 0xFF, 0x90, 0xDD, 0xFF, 0x6D, 0xC3, 0xFF, 0x85, 0xA1, 0xFF, 0xD4, 0xE4, 0xFF, 0xA7, 0x91, 0xFF, 0x65, 0xA1, 0xFF, 0xFD, 0xFF, 0xFF, 0xEB, 0xCA, 0xFF, 0x31, 0xF5, 0xFF, 0x45, 0x69, 0xFF, 0x65, 0x81, 0xFF, 0x54, 0xFE, 0xFF, 0x24, 0x59, 0xFF, 0x0B, 0xA3, 0xFF, 0x9B, 0xFF, 0xFF, 0x46, 0x51, 0xFF, 0xE4, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x8B, 0xFF, 0xE8, 0x71, 0xFF, 0xFE, 0xFF, 0xFF, 0xB6, 0xDC, 0xFF, 0x87, 0x69, 0xFF, 0x90, 0xE5, 0xFF, 0xFE, 0xFF, 0xFF, 0x09, 0x8A, 0xFF, 0xD1, 0xF4, 0xFF, 0x8D, 0xE4, 0xFF, 0x88, 0xDA, 0xFF, 0x56, 0xF6, 0xFF, 0x05, 0x99, 0xFF, 0xC4, 0xD9, 0xFF, 0x8B, 0xE3, 0xFF, 0xCC, 0xE2, 0xFF, 0x0C, 0xEB, 0xFF, 0x03, 0x81, 0xFF, 0x56, 0xF6, 0xFF, 0x6D, 0xE4, 0xFF, 0x2C, 0xDC, 0xFF, 0xAA, 0xB2, 0xFF, 0x31, 0xF5, 0xFF, 0xE7, 0x91, 0xFF, 0x05, 0x69, 0xFF, 0x6B, 0xD3, 0xFF, 0x85, 0x91, 0xFF, 0x86, 0x69, 0xFF, 0xA6, 0x89, 0xFF, 0xE7, 0xA1, 0xFF, 0x25, 0x61, 0xFF, 0x90, 0xE5, 0xFF, 0xE8, 0x89, 0xFF, 0xE8, 0xE1, 0xFF, 0x0D, 0xF3, 0xFF, 0x8A, 0xCA, 0xFF, 0x67, 0x89, 0xFF, 0x91, 0xF5, 0xFF, 0xCC, 0xE2, 0xFF, 0x08, 0x72, 0xFF,
-    0x03, 0x59, 0xFF, 0xE7, 0xC1, 0xFF, 0x0D, 0xDC, 0xFF, 0xE6, 0x81, 0xFF, 0xF7, 0xFF, 0xFF, 0x03, 0x59, 0xFF, 0xA7, 0xAA, 0xFF, 0xC1, 0x50, 0xFF, 0x23, 0x59, 0xFF, 0xFB, 0xFF, 0xFF, 0xA5, 0x71, 0xFF, 0xEC, 0xDB, 0xFF, 0xD5, 0xF6, 0xFF, 0x44, 0x61, 0xFF, 0x49, 0xFB, 0xFF, 0x23, 0x71, 0xFF, 0x8C, 0xCB, 0xFF, 0xA1, 0x60, 0xFF, 0x27, 0xA2, 0xFF, 0x82, 0x70, 0xFF, 0x6C, 0xFD, 0xFF, 0x64, 0x69, 0xFF, 0x65, 0x71, 0xFF, 0xC3, 0x48, 0xFF, 0x04, 0x51, 0xFF, 0x4A, 0xF4, 0xFF, 0x83, 0x68, 0xFF, 0x24, 0x49, 0xFF, 0x65, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x50, 0xFF, 0x25, 0x51, 0xFF, 0x65, 0x61, 0xFF, 0x25, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x61, 0xFF, 0x45, 0x49, 0xFF, 0xE4, 0x38, 0xFF, 0xC8, 0x71, 0xFF, 0xFE, 0xFF, 0xFF, 0xA7, 0x69, 0xFF, 0xC7, 0x61, 0xFF, 0xA7, 0x61, 0xFF, 0x0D, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x71, 0xFF, 0xE8, 0x71, 0xFF, 0x25, 0x51, 0xFF, 0xCC, 0x9A, 0xFF, 0xF6, 0xFF, 0xFF, 0xA7, 0x69, 0xFF, 0xE4, 0x48, 0xFF, 0x46, 0x51, 0xFF, 0xAB, 0xA2, 0xFF, 0x8C, 0xFA, 0xFF, 0xA8, 0x69, 0xFF, 0x04, 0x49, 0xFF, 0x6E, 0xB3, 0xFF, 0xC8, 0x69, 0xFF, 0xAB, 0xA2, 0xFF, 0xED, 0xDA, 0xFF, 0x05, 0x49, 0xFF, 0x2F, 0xE3, 0xFF,
-    0x6E, 0xE3, 0xFF, 0xA3, 0x48, 0xFF, 0xAB, 0xFA, 0xFF, 0x25, 0x59, 0xFF, 0x44, 0x71, 0xFF, 0x8C, 0xFB, 0xFF, 0x26, 0x59, 0xFF, 0x4E, 0xFC, 0xFF, 0x69, 0x9A, 0xFF, 0x66, 0x51, 0xFF, 0xFC, 0xFF, 0xFF, 0x86, 0x59, 0xFF, 0x29, 0xFA, 0xFF, 0xC7, 0x59, 0xFF, 0xA6, 0x51, 0xFF, 0xC8, 0x59, 0xFF, 0x03, 0x41, 0xFF, 0x03, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0xE2, 0x48, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x64, 0x59, 0xFF, 0x03, 0x49, 0xFF, 0x44, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x59, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0xE3, 0x48, 0xFF, 0x45, 0x51, 0xFF, 0x65, 0x59, 0xFF, 0x65, 0x59, 0xFF, 0x04, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x66, 0x61, 0xFF, 0x65, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0xE4, 0x38, 0xFF, 0x65, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x25, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x66, 0x59, 0xFF, 0x46, 0x59, 0xFF, 0x25, 0x51, 0xFF, 0x25, 0x51, 0xFF, 0x65, 0x59, 0xFF,
-    0x65, 0x59, 0xFF, 0xE3, 0x40, 0xFF, 0x25, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x25, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x25, 0x59, 0xFF, 0x25, 0x51, 0xFF, 0x25, 0x51, 0xFF, 0x05, 0x49, 0xFF, 0x05, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x66, 0x59, 0xFF, 0x86, 0x59, 0xFF, 0x05, 0x49, 0xFF, 0x86, 0x59, 0xFF, 0x86, 0x59, 0xFF, 0x46, 0x51, 0xFF, 0x86, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0xA7, 0x59, 0xFF, 0xA7, 0x59, 0xFF, 0xA7, 0x59, 0xFF, 0xC7, 0x59, 0xFF, 0xA2, 0x78, 0xFF, 0x84, 0x79, 0xFF, 0x23, 0x59, 0xFF, 0xA1, 0x60, 0xFF, 0xE8, 0xF2, 0xFF, 0x04, 0x82, 0xFF, 0x0B, 0xBB, 0xFF, 0xA9, 0xFB, 0xFF, 0x21, 0x69, 0xFF, 0x02, 0x51, 0xFF, 0x62, 0x91, 0xFF, 0xA0, 0x58, 0xFF, 0xA8, 0xA2, 0xFF, 0x23, 0x71, 0xFF, 0x24, 0x59, 0xFF, 0x23, 0x69, 0xFF, 0x2A, 0xFC, 0xFF, 0x44, 0x69, 0xFF, 0xA1, 0x60, 0xFF, 0x11, 0xFE, 0xFF, 0x68, 0x8A, 0xFF, 0xA4, 0x79, 0xFF, 0xA1, 0x78, 0xFF, 0x03, 0x49, 0xFF, 0xE2, 0x80, 0xFF, 0x22, 0x81, 0xFF, 0xE3, 0x48, 0xFF, 0x65, 0x99, 0xFF, 0x26, 0x92, 0xFF, 0x06, 0x7A, 0xFF, 0x07, 0xD2, 0xFF, 0xC2, 0x50, 0xFF,
-    0xA5, 0x71, 0xFF, 0x4D, 0xEC, 0xFF, 0x44, 0x61, 0xFF, 0xA5, 0x71, 0xFF, 0xFE, 0xFF, 0xFF, 0x24, 0x49, 0xFF, 0x25, 0x49, 0xFF, 0xFC, 0xFF, 0xFF, 0x85, 0x59, 0xFF, 0xA6, 0x69, 0xFF, 0xCD, 0xBC, 0xFF, 0x44, 0x61, 0xFF, 0x25, 0x59, 0xFF, 0x4D, 0xE4, 0xFF, 0x04, 0x51, 0xFF, 0x03, 0x71, 0xFF, 0x2F, 0xED, 0xFF, 0x04, 0x51, 0xFF, 0x03, 0xC1, 0xFF, 0x08, 0xCA, 0xFF, 0x04, 0x59, 0xFF, 0xE5, 0xC1, 0xFF, 0x0A, 0xEB, 0xFF, 0x05, 0x61, 0xFF, 0xEC, 0xE3, 0xFF, 0x46, 0xA9, 0xFF, 0x24, 0xA1, 0xFF, 0xE7, 0xE2, 0xFF, 0x82, 0x60, 0xFF, 0x25, 0x59, 0xFF, 0x45, 0xB9, 0xFF, 0x24, 0x61, 0xFF, 0x23, 0x71, 0xFF, 0x24, 0x69, 0xFF, 0x08, 0x92, 0xFF, 0x24, 0x61, 0xFF, 0x44, 0x61, 0xFF, 0x86, 0x61, 0xFF, 0x45, 0x61, 0xFF, 0xA7, 0x69, 0xFF, 0x66, 0x69, 0xFF, 0x29, 0xAA, 0xFF, 0xA7, 0x91, 0xFF, 0x86, 0x61, 0xFF, 0xA7, 0x69, 0xFF, 0x69, 0xC2, 0xFF, 0xA6, 0x61, 0xFF, 0xC7, 0x61, 0xFF, 0x22, 0x79, 0xFF, 0x43, 0x59, 0xFF, 0xC4, 0xCA, 0xFF, 0x42, 0x89, 0xFF, 0x48, 0xA3, 0xFF, 0x43, 0x61, 0xFF, 0x44, 0x82, 0xFF, 0x84, 0x61, 0xFF, 0x63, 0x69, 0xFF, 0x2A, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x83, 0x79, 0xFF, 0xC9, 0xC3, 0xFF, 0x27, 0xA3, 0xFF, 0x01, 0x59, 0xFF,
-    0xC1, 0x60, 0xFF, 0xE5, 0xB9, 0xFF, 0xF6, 0xFF, 0xFF, 0xE3, 0x60, 0xFF, 0xE2, 0x78, 0xFF, 0xEE, 0xFD, 0xFF, 0x03, 0x79, 0xFF, 0xE4, 0x50, 0xFF, 0x28, 0xC2, 0xFF, 0x86, 0xB1, 0xFF, 0x24, 0x51, 0xFF, 0xE3, 0x48, 0xFF, 0xEA, 0xFA, 0xFF, 0x24, 0x81, 0xFF, 0x04, 0x51, 0xFF, 0x24, 0x59, 0xFF, 0x2D, 0xEB, 0xFF, 0x24, 0x61, 0xFF, 0x24, 0x59, 0xFF, 0x28, 0x82, 0xFF, 0xCF, 0xF3, 0xFF, 0x24, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0xCC, 0x9A, 0xFF, 0x24, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x04, 0x49, 0xFF, 0xB1, 0xDB, 0xFF, 0x04, 0x51, 0xFF, 0x25, 0x59, 0xFF, 0xC7, 0x69, 0xFF, 0x08, 0x7A, 0xFF, 0xE4, 0x50, 0xFF, 0x05, 0x49, 0xFF, 0x24, 0x61, 0xFF, 0x29, 0x8A, 0xFF, 0x25, 0x49, 0xFF, 0x45, 0x59, 0xFF, 0x08, 0x82, 0xFF, 0xC4, 0x48, 0xFF, 0xE4, 0x50, 0xFF, 0x2A, 0xDA, 0xFF, 0x06, 0x71, 0xFF, 0x04, 0x51, 0xFF, 0xC4, 0x48, 0xFF, 0xC7, 0x91, 0xFF, 0xC8, 0x81, 0xFF, 0xC4, 0x48, 0xFF, 0xA8, 0x69, 0xFF, 0x49, 0xCA, 0xFF, 0xE7, 0x91, 0xFF, 0x25, 0x59, 0xFF, 0x45, 0x61, 0xFF, 0x45, 0x59, 0xFF, 0x86, 0x61, 0xFF, 0xAD, 0xE4, 0xFF, 0xA8, 0xDA, 0xFF, 0x86, 0x61, 0xFF, 0x86, 0x59, 0xFF, 0xC7, 0xA9, 0xFF, 0xA7, 0x69, 0xFF, 0x09, 0xA2, 0xFF, 0xA7, 0x59, 0xFF, 0xC7, 0x69, 0xFF,
-    0xC2, 0x48, 0xFF, 0x50, 0xFE, 0xFF, 0xE1, 0x40, 0xFF, 0xA6, 0xCA, 0xFF, 0x02, 0x61, 0xFF, 0xA7, 0xCA, 0xFF, 0x92, 0xED, 0xFF, 0x21, 0x71, 0xFF, 0x68, 0xBA, 0xFF, 0xFE, 0xFF, 0xFF, 0xE2, 0x60, 0xFF, 0x02, 0x61, 0xFF, 0xEC, 0xFC, 0xFF, 0x69, 0xDB, 0xFF, 0xA4, 0x89, 0xFF, 0x80, 0x58, 0xFF, 0xA2, 0x58, 0xFF, 0x4B, 0xEC, 0xFF, 0x48, 0xFB, 0xFF, 0x65, 0x89, 0xFF, 0xE3, 0x58, 0xFF, 0xC2, 0x60, 0xFF, 0x24, 0x81, 0xFF, 0xE7, 0xE9, 0xFF, 0x04, 0x59, 0xFF, 0x03, 0x51, 0xFF, 0xA6, 0xF1, 0xFF, 0x49, 0x9A, 0xFF, 0x03, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0xE3, 0x58, 0xFF, 0xEC, 0xCA, 0xFF, 0x23, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x86, 0x69, 0xFF, 0xA7, 0xE1, 0xFF, 0x03, 0x51, 0xFF, 0xE3, 0x40, 0xFF, 0x24, 0x49, 0xFF, 0xE8, 0x71, 0xFF, 0xE8, 0xA9, 0xFF, 0x24, 0x59, 0xFF, 0xC3, 0x40, 0xFF, 0x65, 0x59, 0xFF, 0x12, 0xC4, 0xFF, 0x24, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x6A, 0x9A, 0xFF, 0xA8, 0x79, 0xFF, 0x25, 0x51, 0xFF, 0xA3, 0x40, 0xFF, 0x25, 0x51, 0xFF, 0x0A, 0x82, 0xFF, 0xE4, 0x50, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0x09, 0x72, 0xFF, 0x09, 0x92, 0xFF, 0x05, 0x41, 0xFF, 0x05, 0x41, 0xFF, 0xC8, 0x61, 0xFF, 0x8B, 0x92, 0xFF, 0xAC, 0xCA, 0xFF,
-    0x04, 0x49, 0xFF, 0xA2, 0x58, 0xFF, 0x04, 0xA1, 0xFF, 0xAB, 0xAA, 0xFF, 0x46, 0x59, 0xFF, 0xE5, 0x70, 0xFF, 0x48, 0xC2, 0xFF, 0x65, 0x71, 0xFF, 0xDE, 0xFF, 0xFF, 0x86, 0x61, 0xFF, 0x28, 0x92, 0xFF, 0x66, 0x59, 0xFF, 0x29, 0xFB, 0xFF, 0xA7, 0x61, 0xFF, 0x0A, 0xE3, 0xFF, 0x66, 0x59, 0xFF, 0xA1, 0x58, 0xFF, 0x45, 0xE1, 0xFF, 0xA2, 0x48, 0xFF, 0x24, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x60, 0xFF, 0x8A, 0xC3, 0xFF, 0x04, 0xA1, 0xFF, 0xE2, 0x50, 0xFF, 0x4C, 0xFD, 0xFF, 0x23, 0x81, 0xFF, 0x40, 0x60, 0xFF, 0x81, 0x88, 0xFF, 0xA5, 0x89, 0xFF, 0x08, 0xFB, 0xFF, 0xC6, 0xA9, 0xFF, 0x07, 0xE2, 0xFF, 0xE2, 0x58, 0xFF, 0x64, 0x71, 0xFF, 0x86, 0x91, 0xFF, 0xC7, 0xFA, 0xFF, 0x03, 0x69, 0xFF, 0x66, 0xD1, 0xFF, 0xE3, 0x48, 0xFF, 0x24, 0x71, 0xFF, 0x69, 0xFB, 0xFF, 0xE3, 0x50, 0xFF, 0x45, 0x79, 0xFF, 0x03, 0x59, 0xFF, 0x44, 0x61, 0xFF, 0xD1, 0xFF, 0xFF, 0xE3, 0x50, 0xFF, 0x65, 0x69, 0xFF, 0x66, 0xC2, 0xFF, 0x45, 0x61, 0xFF, 0x52, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xA2, 0x38, 0xFF, 0x24, 0x49, 0xFF, 0x6F, 0xC4, 0xFF, 0x51, 0xFF, 0xFF, 0xA6, 0x71, 0xFF, 0x29, 0xA4, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x59, 0xFF, 0xD2, 0xFF, 0xFF, 0x24, 0x59, 0xFF, 0x04, 0x51, 0xFF,
-    0x0A, 0xDB, 0xFF, 0x25, 0x51, 0xFF, 0x2A, 0xFB, 0xFF, 0xE7, 0x99, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0xA7, 0x91, 0xFF, 0xE9, 0xA9, 0xFF, 0x03, 0x81, 0xFF, 0x04, 0x71, 0xFF, 0xE4, 0x50, 0xFF, 0x46, 0x61, 0xFF, 0xE8, 0x89, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0xE3, 0x58, 0xFF, 0xE4, 0x70, 0xFF, 0x69, 0x92, 0xFF, 0x69, 0xB2, 0xFF, 0x25, 0x51, 0xFF, 0x25, 0x59, 0xFF, 0xA3, 0x58, 0xFF, 0x08, 0x82, 0xFF, 0x2A, 0xE2, 0xFF, 0x66, 0x61, 0xFF, 0x46, 0x61, 0xFF, 0x82, 0x60, 0xFF, 0x45, 0x61, 0xFF, 0xEA, 0xFA, 0xFF, 0xA7, 0x71, 0xFF, 0xA6, 0x51, 0xFF, 0x86, 0x59, 0xFF, 0xA2, 0x40, 0xFF, 0xC7, 0xFA, 0xFF, 0xC2, 0x48, 0xFF, 0xA1, 0x48, 0xFF, 0xC2, 0x50, 0xFF, 0x23, 0x61, 0xFF, 0x60, 0x50, 0xFF, 0x64, 0x61, 0xFF, 0x25, 0xBB, 0xFF, 0x89, 0xAB, 0xFF, 0x02, 0x51, 0xFF, 0x64, 0x69, 0xFF, 0xB3, 0xFF, 0xFF, 0x51, 0xEE, 0xFF, 0x64, 0x69, 0xFF, 0xE2, 0x78, 0xFF, 0xC2, 0x60, 0xFF, 0x03, 0x61, 0xFF, 0x64, 0x69, 0xFF, 0xFC, 0xFF, 0xFF, 0xE2, 0x58, 0xFF, 0xE3, 0x58, 0xFF, 0x29, 0x92, 0xFF, 0xC7, 0xA9, 0xFF, 0x24, 0x59, 0xFF, 0x23, 0x51, 0xFF, 0xC7, 0xC1, 0xFF, 0xE3, 0x48, 0xFF, 0x03, 0x51, 0xFF, 0x07, 0xAA, 0xFF, 0xE4, 0x50, 0xFF, 0x04, 0x51, 0xFF,
-    0x24, 0x59, 0xFF, 0xA6, 0x71, 0xFF, 0x04, 0x59, 0xFF, 0x48, 0x82, 0xFF, 0xCC, 0xF3, 0xFF, 0xA2, 0x38, 0xFF, 0x04, 0x49, 0xFF, 0xE5, 0x99, 0xFF, 0xE3, 0x58, 0xFF, 0x24, 0x59, 0xFF, 0xC3, 0x48, 0xFF, 0x2C, 0xD3, 0xFF, 0x03, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0x8A, 0xFA, 0xFF, 0x04, 0x51, 0xFF, 0xE4, 0x48, 0xFF, 0x86, 0x71, 0xFF, 0x05, 0x59, 0xFF, 0x04, 0x49, 0xFF, 0xE4, 0x48, 0xFF, 0x65, 0x69, 0xFF, 0x04, 0x49, 0xFF, 0x05, 0x49, 0xFF, 0x4B, 0xFB, 0xFF, 0xA3, 0x58, 0xFF, 0xE4, 0x40, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0xC4, 0x40, 0xFF, 0x87, 0x69, 0xFF, 0xC4, 0x40, 0xFF, 0xE4, 0x40, 0xFF, 0x05, 0x49, 0xFF, 0x25, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0xE4, 0x48, 0xFF, 0x45, 0x51, 0xFF, 0xE7, 0x71, 0xFF, 0x66, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0x6A, 0x92, 0xFF, 0x66, 0x59, 0xFF, 0x66, 0x51, 0xFF, 0x66, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0x86, 0x51, 0xFF, 0xE2, 0x50, 0xFF, 0x64, 0x69, 0xFF, 0x01, 0x59, 0xFF, 0xE1, 0x50, 0xFF, 0xE3, 0x91, 0xFF, 0x03, 0x51, 0xFF, 0xA1, 0x50, 0xFF, 0x68, 0x92, 0xFF, 0x43, 0x71, 0xFF, 0xB5, 0xF6, 0xFF, 0xE3, 0x81, 0xFF, 0x88, 0xAA, 0xFF, 0x88, 0xAA, 0xFF, 0x76, 0xFF, 0xFF, 0x23, 0x69, 0xFF, 0x03, 0x61, 0xFF,
-    0x44, 0x81, 0xFF, 0xC2, 0x78, 0xFF, 0x24, 0x69, 0xFF, 0x03, 0x59, 0xFF, 0x89, 0xAA, 0xFF, 0xC2, 0x68, 0xFF, 0xC3, 0x50, 0xFF, 0xE3, 0x48, 0xFF, 0x07, 0x8A, 0xFF, 0x23, 0x51, 0xFF, 0x24, 0x59, 0xFF, 0xC3, 0x48, 0xFF, 0xC7, 0x81, 0xFF, 0x24, 0x59, 0xFF, 0xC3, 0x48, 0xFF, 0x03, 0x59, 0xFF, 0x89, 0xDA, 0xFF, 0x24, 0x61, 0xFF, 0x03, 0x59, 0xFF, 0x04, 0x59, 0xFF, 0x82, 0x68, 0xFF, 0xA2, 0x40, 0xFF, 0x04, 0x49, 0xFF, 0x03, 0xA1, 0xFF, 0xC2, 0x50, 0xFF, 0x04, 0x59, 0xFF, 0xA2, 0x50, 0xFF, 0xAA, 0xB2, 0xFF, 0x04, 0x59, 0xFF, 0x24, 0x59, 0xFF, 0x24, 0x59, 0xFF, 0x49, 0x92, 0xFF, 0xC3, 0x48, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x59, 0xFF, 0x69, 0x92, 0xFF, 0x25, 0x59, 0xFF, 0x04, 0x51, 0xFF, 0xE4, 0x48, 0xFF, 0xA7, 0x69, 0xFF, 0x04, 0x49, 0xFF, 0x04, 0x49, 0xFF, 0xC4, 0x50, 0xFF, 0x25, 0x59, 0xFF, 0xC3, 0x40, 0xFF, 0xC4, 0x48, 0xFF, 0xC7, 0x89, 0xFF, 0x04, 0x61, 0xFF, 0xC4, 0x40, 0xFF, 0x85, 0x71, 0xFF, 0xCE, 0xDC, 0xFF, 0xE4, 0x58, 0xFF, 0x25, 0x51, 0xFF, 0xE4, 0x48, 0xFF, 0x25, 0x59, 0xFF, 0x2C, 0xF3, 0xFF, 0x45, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0x45, 0x51, 0xFF, 0x67, 0xB1, 0xFF, 0x66, 0x61, 0xFF, 0x66, 0x59, 0xFF, 0x87, 0x59, 0xFF, 0x86, 0x59, 0xFF,
-    0xC2, 0x48, 0xFF, 0xC7, 0xE2, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x50, 0xFF, 0xC2, 0x50, 0xFF, 0xC1, 0x68, 0xFF, 0xCB, 0xFB, 0xFF, 0xA1, 0x58, 0xFF, 0xE2, 0x58, 0xFF, 0x81, 0x90, 0xFF, 0xC3, 0x60, 0xFF, 0xA9, 0xBA, 0xFF, 0x46, 0xE9, 0xFF, 0xE3, 0x68, 0xFF, 0xA1, 0x70, 0xFF, 0xAA, 0xFB, 0xFF, 0x81, 0x68, 0xFF, 0xC2, 0x58, 0xFF, 0x89, 0xBA, 0xFF, 0xA5, 0xB1, 0xFF, 0x44, 0x61, 0xFF, 0xA3, 0x58, 0xFF, 0xC3, 0x50, 0xFF, 0xC7, 0x81, 0xFF, 0x44, 0x69, 0xFF, 0xC3, 0x50, 0xFF, 0x23, 0x51, 0xFF, 0x69, 0x9A, 0xFF, 0xE3, 0x50, 0xFF, 0xC2, 0x50, 0xFF, 0x61, 0x58, 0xFF, 0xA6, 0x79, 0xFF, 0xA2, 0x48, 0xFF, 0xA2, 0xA0, 0xFF, 0x04, 0x59, 0xFF, 0xE7, 0xA9, 0xFF, 0x55, 0xEE, 0xFF, 0xE3, 0x48, 0xFF, 0xE4, 0x50, 0xFF, 0x06, 0xC3, 0xFF, 0xAB, 0xA2, 0xFF, 0x24, 0x59, 0xFF, 0x03, 0xA2, 0xFF, 0x04, 0x51, 0xFF, 0xA8, 0x81, 0xFF, 0x05, 0x69, 0xFF, 0x03, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0xCA, 0x9A, 0xFF, 0xE3, 0x48, 0xFF, 0x25, 0x51, 0xFF, 0xE4, 0x60, 0xFF, 0x28, 0x82, 0xFF, 0x04, 0x51, 0xFF, 0x86, 0x81, 0xFF, 0xE4, 0x48, 0xFF, 0x29, 0x8A, 0xFF, 0x48, 0x9A, 0xFF, 0xE4, 0x48, 0xFF, 0x04, 0x49, 0xFF, 0xC7, 0x89, 0xFF, 0xE4, 0x48, 0xFF, 0xE4, 0x48, 0xFF, 0xAA, 0xB2, 0xFF,
-    0x62, 0x48, 0xFF, 0x25, 0x59, 0xFF, 0x63, 0x78, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x81, 0x98, 0xFF, 0x29, 0x9A, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0x41, 0x70, 0xFF, 0x04, 0x59, 0xFF, 0x45, 0x69, 0xFF, 0x66, 0x59, 0xFF, 0x09, 0xE2, 0xFF, 0x65, 0x59, 0xFF, 0x81, 0x40, 0xFF, 0x82, 0x58, 0xFF, 0xC2, 0x48, 0xFF, 0xEF, 0xFE, 0xFF, 0x03, 0x59, 0xFF, 0xE3, 0x60, 0xFF, 0x0D, 0xED, 0xFF, 0xC2, 0x60, 0xFF, 0xC4, 0xB1, 0xFF, 0x42, 0x91, 0xFF, 0xE3, 0x60, 0xFF, 0x05, 0xAA, 0xFF, 0x6C, 0xFD, 0xFF, 0xE8, 0xE3, 0xFF, 0xC1, 0x68, 0xFF, 0x03, 0x69, 0xFF, 0xC2, 0x80, 0xFF, 0x86, 0xE1, 0xFF, 0xE3, 0x58, 0xFF, 0x43, 0x81, 0xFF, 0x83, 0x89, 0xFF, 0xA6, 0xA1, 0xFF, 0x23, 0x69, 0xFF, 0x2F, 0xFE, 0xFF, 0x44, 0x61, 0xFF, 0xC2, 0x48, 0xFF, 0x0A, 0xAB, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x50, 0xFF, 0xE3, 0x50, 0xFF, 0xC4, 0x78, 0xFF, 0x45, 0x71, 0xFF, 0xE3, 0x50, 0xFF, 0x03, 0xA1, 0xFF, 0xE3, 0x50, 0xFF, 0x25, 0xE1, 0xFF, 0x88, 0xCA, 0xFF, 0xE3, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0xB3, 0xFE, 0xFF, 0xC8, 0xCA, 0xFF, 0x61, 0x48, 0xFF, 0xA3, 0x48, 0xFF, 0x03, 0x51, 0xFF, 0x24, 0x71, 0xFF, 0xE4, 0x58, 0xFF, 0xA2, 0x68, 0xFF, 0x24, 0x51, 0xFF,
-    0x82, 0x40, 0xFF, 0xCB, 0xA2, 0xFF, 0x24, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0xC7, 0xB9, 0xFF, 0xA3, 0x50, 0xFF, 0xC8, 0x89, 0xFF, 0xC4, 0x40, 0xFF, 0xA7, 0x71, 0xFF, 0xC3, 0x40, 0xFF, 0x08, 0x7A, 0xFF, 0x49, 0x92, 0xFF, 0xC3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xA7, 0x89, 0xFF, 0x08, 0x7A, 0xFF, 0x45, 0x61, 0xFF, 0x04, 0x49, 0xFF, 0x25, 0x59, 0xFF, 0x07, 0xBA, 0xFF, 0x86, 0x69, 0xFF, 0x42, 0x68, 0xFF, 0x25, 0x59, 0xFF, 0xC4, 0x48, 0xFF, 0xE6, 0xE9, 0xFF, 0xE7, 0x91, 0xFF, 0xA3, 0x50, 0xFF, 0x45, 0x51, 0xFF, 0x86, 0x61, 0xFF, 0x86, 0x61, 0xFF, 0x66, 0x79, 0xFF, 0x86, 0x61, 0xFF, 0x0E, 0xFD, 0xFF, 0x40, 0x38, 0xFF, 0x81, 0x50, 0xFF, 0x84, 0xA1, 0xFF, 0xF5, 0xFF, 0xFF, 0xE2, 0x80, 0xFF, 0x21, 0x79, 0xFF, 0xED, 0xFD, 0xFF, 0xE2, 0x60, 0xFF, 0xE5, 0xE1, 0xFF, 0xC8, 0xE2, 0xFF, 0x05, 0xC2, 0xFF, 0xC2, 0x58, 0xFF, 0xE3, 0x58, 0xFF, 0xC5, 0xA9, 0xFF, 0x64, 0x99, 0xFF, 0xC2, 0x50, 0xFF, 0x03, 0x69, 0xFF, 0xE1, 0x98, 0xFF, 0x03, 0x69, 0xFF, 0x45, 0xF9, 0xFF, 0xA0, 0x58, 0xFF, 0x6A, 0xFA, 0xFF, 0xE3, 0x50, 0xFF, 0xE3, 0x58, 0xFF, 0xA6, 0xF9, 0xFF, 0xE3, 0x50, 0xFF, 0xE3, 0x48, 0xFF, 0x87, 0xB9, 0xFF, 0x65, 0x69, 0xFF, 0x0C, 0xFD, 0xFF, 0x45, 0x99, 0xFF,
-    0xAB, 0xFA, 0xFF, 0x24, 0x69, 0xFF, 0xE3, 0x58, 0xFF, 0x6A, 0xFB, 0xFF, 0x47, 0xDA, 0xFF, 0xC3, 0x50, 0xFF, 0x04, 0x51, 0xFF, 0x16, 0xF6, 0xFF, 0x29, 0xFB, 0xFF, 0x45, 0x69, 0xFF, 0xA1, 0x80, 0xFF, 0xC9, 0xFA, 0xFF, 0x04, 0x69, 0xFF, 0x4B, 0xFC, 0xFF, 0x04, 0x59, 0xFF, 0x4D, 0xF5, 0xFF, 0xA2, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0xE8, 0xB9, 0xFF, 0x65, 0x61, 0xFF, 0x04, 0x51, 0xFF, 0xE3, 0x60, 0xFF, 0x86, 0x79, 0xFF, 0xA7, 0x69, 0xFF, 0x25, 0x61, 0xFF, 0x4A, 0xD2, 0xFF, 0x00, 0xA0, 0xFF, 0xE4, 0x48, 0xFF, 0xEC, 0x9A, 0xFF, 0x04, 0x69, 0xFF, 0xC3, 0x48, 0xFF, 0x05, 0x51, 0xFF, 0x04, 0x59, 0xFF, 0x66, 0x71, 0xFF, 0xA6, 0x79, 0xFF, 0x45, 0x79, 0xFF, 0x25, 0x59, 0xFF, 0xC3, 0x48, 0xFF, 0xC7, 0x89, 0xFF, 0xC7, 0xA9, 0xFF, 0x40, 0x58, 0xFF, 0x04, 0x71, 0xFF, 0x03, 0x51, 0xFF, 0xE7, 0x81, 0xFF, 0xC8, 0xF1, 0xFF, 0x66, 0x59, 0xFF, 0x66, 0x59, 0xFF, 0x25, 0x61, 0xFF, 0xA1, 0x40, 0xFF, 0x23, 0x59, 0xFF, 0xC2, 0x48, 0xFF, 0xE3, 0x58, 0xFF, 0xE1, 0x58, 0xFF, 0xC2, 0x58, 0xFF, 0xC3, 0x70, 0xFF, 0xC2, 0x50, 0xFF, 0xA4, 0x99, 0xFF, 0x73, 0xFF, 0xFF, 0x24, 0x69, 0xFF, 0xA1, 0x50, 0xFF, 0x06, 0xAA, 0xFF, 0x40, 0x78, 0xFF, 0x44, 0x69, 0xFF, 0xE3, 0x60, 0xFF,
-    0x61, 0x60, 0xFF, 0xC1, 0x60, 0xFF, 0x01, 0x71, 0xFF, 0x03, 0x61, 0xFF, 0x68, 0xAA, 0xFF, 0x03, 0x61, 0xFF, 0xE3, 0x50, 0xFF, 0xC2, 0x48, 0xFF, 0x07, 0x8A, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x50, 0xFF, 0x03, 0x61, 0xFF, 0x68, 0x9A, 0xFF, 0xE3, 0x50, 0xFF, 0xA2, 0x70, 0xFF, 0x24, 0x59, 0xFF, 0xA6, 0x99, 0xFF, 0x85, 0xD1, 0xFF, 0xE3, 0x58, 0xFF, 0xE3, 0x60, 0xFF, 0xFA, 0xFF, 0xFF, 0xA3, 0x48, 0xFF, 0xE3, 0x50, 0xFF, 0x8A, 0xEB, 0xFF, 0x82, 0x58, 0xFF, 0xE3, 0x58, 0xFF, 0x6A, 0xCB, 0xFF, 0xE3, 0x58, 0xFF, 0x24, 0x59, 0xFF, 0xA3, 0x70, 0xFF, 0x04, 0x51, 0xFF, 0xA7, 0x89, 0xFF, 0xE3, 0x58, 0xFF, 0x03, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0x07, 0x8A, 0xFF, 0x24, 0x51, 0xFF, 0xE4, 0x48, 0xFF, 0xE3, 0x68, 0xFF, 0xC2, 0x50, 0xFF, 0x65, 0x59, 0xFF, 0x65, 0x69, 0xFF, 0xC3, 0x40, 0xFF, 0xE3, 0x50, 0xFF, 0x07, 0x7A, 0xFF, 0xE4, 0x48, 0xFF, 0x87, 0x79, 0xFF, 0x27, 0x8A, 0xFF, 0x45, 0x59, 0xFF, 0x04, 0x49, 0xFF, 0x0B, 0xF3, 0xFF, 0xC7, 0x91, 0xFF, 0x04, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x45, 0x59, 0xFF, 0xC3, 0x50, 0xFF, 0x04, 0x51, 0xFF, 0x66, 0x59, 0xFF, 0x66, 0x59, 0xFF, 0x45, 0x61, 0xFF, 0x05, 0x71, 0xFF, 0x65, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x66, 0x59, 0xFF,
-    0xC2, 0x48, 0xFF, 0xE3, 0x88, 0xFF, 0x23, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x81, 0x68, 0xFF, 0xC2, 0x50, 0xFF, 0x00, 0x81, 0xFF, 0xE5, 0xA1, 0xFF, 0xA2, 0x50, 0xFF, 0xA2, 0x50, 0xFF, 0x40, 0x70, 0xFF, 0xA4, 0xA1, 0xFF, 0x23, 0x61, 0xFF, 0xE2, 0x68, 0xFF, 0xC2, 0x90, 0xFF, 0x27, 0xFA, 0xFF, 0x01, 0x69, 0xFF, 0x04, 0xBA, 0xFF, 0xC2, 0x58, 0xFF, 0xC6, 0x89, 0xFF, 0xE7, 0xD2, 0xFF, 0x23, 0x69, 0xFF, 0x24, 0x61, 0xFF, 0xE7, 0x81, 0xFF, 0xA5, 0x79, 0xFF, 0xC2, 0x50, 0xFF, 0x03, 0x81, 0xFF, 0x07, 0x82, 0xFF, 0x44, 0x61, 0xFF, 0xE3, 0x50, 0xFF, 0x81, 0x60, 0xFF, 0xE7, 0x91, 0xFF, 0x03, 0x61, 0xFF, 0xC6, 0xD9, 0xFF, 0xE3, 0x58, 0xFF, 0xC3, 0x60, 0xFF, 0xF9, 0xFF, 0xFF, 0xC3, 0x50, 0xFF, 0xE3, 0x50, 0xFF, 0xA9, 0xDB, 0xFF, 0xC2, 0x58, 0xFF, 0x03, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0xC3, 0x58, 0xFF, 0x8A, 0xBA, 0xFF, 0x04, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0xE3, 0x50, 0xFF, 0x69, 0x92, 0xFF, 0x27, 0xC2, 0xFF, 0x03, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x07, 0x7A, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x04, 0x61, 0xFF, 0xE7, 0x79, 0xFF, 0xC3, 0x48, 0xFF, 0xC3, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0xE7, 0x79, 0xFF, 0xA5, 0x61, 0xFF, 0xB0, 0xE5, 0xFF, 0xE3, 0x40, 0xFF,
-    0xAA, 0x9A, 0xFF, 0x48, 0x7A, 0xFF, 0x83, 0x61, 0xFF, 0x25, 0x59, 0xFF, 0xE3, 0x50, 0xFF, 0xE9, 0xF2, 0xFF, 0x45, 0x59, 0xFF, 0xE3, 0x48, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0xA7, 0xA9, 0xFF, 0x65, 0x59, 0xFF, 0x65, 0x69, 0xFF, 0x45, 0x59, 0xFF, 0x25, 0x81, 0xFF, 0x65, 0x59, 0xFF, 0xA1, 0x50, 0xFF, 0x03, 0x69, 0xFF, 0xA2, 0x48, 0xFF, 0x80, 0x58, 0xFF, 0xC1, 0x50, 0xFF, 0xA4, 0x99, 0xFF, 0xA1, 0x50, 0xFF, 0xA1, 0x58, 0xFF, 0x85, 0xB9, 0xFF, 0xA9, 0xFA, 0xFF, 0xA1, 0x60, 0xFF, 0xA7, 0xE9, 0xFF, 0x67, 0xBA, 0xFF, 0xC2, 0x58, 0xFF, 0xC2, 0x60, 0xFF, 0x86, 0xAA, 0xFF, 0xE7, 0xA2, 0xFF, 0xA6, 0xC1, 0xFF, 0xE6, 0xB9, 0xFF, 0xC6, 0xBA, 0xFF, 0x20, 0x70, 0xFF, 0xA5, 0x79, 0xFF, 0x27, 0x9A, 0xFF, 0xC2, 0x50, 0xFF, 0x23, 0x69, 0xFF, 0x64, 0xA9, 0xFF, 0xA6, 0x81, 0xFF, 0x23, 0x51, 0xFF, 0xE3, 0x58, 0xFF, 0xCD, 0xFC, 0xFF, 0xC2, 0x50, 0xFF, 0xE7, 0xA9, 0xFF, 0xE3, 0x68, 0xFF, 0x61, 0x58, 0xFF, 0x04, 0x61, 0xFF, 0xE8, 0xE1, 0xFF, 0xDB, 0xFF, 0xFF, 0xE3, 0x58, 0xFF, 0x04, 0x51, 0xFF, 0x2E, 0xEC, 0xFF, 0xE7, 0xB1, 0xFF, 0x04, 0x69, 0xFF, 0xA3, 0x90, 0xFF, 0xEA, 0xE3, 0xFF, 0x48, 0xAA, 0xFF, 0xE3, 0x68, 0xFF, 0xC3, 0x70, 0xFF, 0x23, 0x81, 0xFF,
-    0x07, 0x7A, 0xFF, 0xE6, 0x81, 0xFF, 0xE2, 0xA0, 0xFF, 0x03, 0x59, 0xFF, 0x85, 0x61, 0xFF, 0x07, 0x8A, 0xFF, 0xC2, 0x48, 0xFF, 0x04, 0x51, 0xFF, 0x46, 0xBA, 0xFF, 0x69, 0xA2, 0xFF, 0xCB, 0xB2, 0xFF, 0xC2, 0x50, 0xFF, 0x44, 0x61, 0xFF, 0x24, 0x51, 0xFF, 0xE3, 0x50, 0xFF, 0xE2, 0x40, 0xFF, 0x23, 0x59, 0xFF, 0xA3, 0x58, 0xFF, 0xA7, 0x91, 0xFF, 0x08, 0x8A, 0xFF, 0x03, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x23, 0x91, 0xFF, 0x44, 0x79, 0xFF, 0x03, 0x91, 0xFF, 0x04, 0x59, 0xFF, 0x2C, 0xDB, 0xFF, 0x66, 0x69, 0xFF, 0x45, 0x71, 0xFF, 0x25, 0x79, 0xFF, 0x44, 0x59, 0xFF, 0x65, 0x71, 0xFF, 0xC2, 0x48, 0xFF, 0x20, 0x98, 0xFF, 0x22, 0xA1, 0xFF, 0x81, 0x48, 0xFF, 0xA1, 0x48, 0xFF, 0xE3, 0x58, 0xFF, 0xA8, 0xFA, 0xFF, 0x24, 0x71, 0xFF, 0x81, 0x50, 0xFF, 0x43, 0x99, 0xFF, 0x07, 0xB2, 0xFF, 0x8F, 0xFE, 0xFF, 0x23, 0x79, 0xFF, 0xC2, 0x60, 0xFF, 0xFD, 0xFF, 0xFF, 0x64, 0x81, 0xFF, 0xE7, 0xF9, 0xFF, 0x44, 0x79, 0xFF, 0xC7, 0xD2, 0xFF, 0x44, 0x79, 0xFF, 0xA1, 0x50, 0xFF, 0xC6, 0xF9, 0xFF, 0xC2, 0x50, 0xFF, 0x85, 0x69, 0xFF, 0x44, 0x89, 0xFF, 0x8A, 0xC2, 0xFF, 0x27, 0xCA, 0xFF, 0xE4, 0xB0, 0xFF, 0x23, 0x79, 0xFF, 0xA2, 0x50, 0xFF, 0xE3, 0x90, 0xFF, 0x65, 0x71, 0xFF,
-    0x86, 0xB1, 0xFF, 0xC7, 0xF1, 0xFF, 0xA2, 0x50, 0xFF, 0x26, 0xEA, 0xFF, 0xEA, 0xFC, 0xFF, 0xC3, 0x50, 0xFF, 0xE3, 0x50, 0xFF, 0x47, 0xD2, 0xFF, 0xE4, 0xF0, 0xFF, 0xE2, 0x58, 0xFF, 0x07, 0xEA, 0xFF, 0x31, 0xF5, 0xFF, 0xC2, 0x50, 0xFF, 0x82, 0x80, 0xFF, 0x44, 0x61, 0xFF, 0x88, 0xCA, 0xFF, 0xCB, 0xAA, 0xFF, 0x68, 0xA2, 0xFF, 0x61, 0x70, 0xFF, 0x84, 0xB9, 0xFF, 0x64, 0x61, 0xFF, 0x44, 0x59, 0xFF, 0xA6, 0x71, 0xFF, 0xE3, 0x48, 0xFF, 0x04, 0x51, 0xFF, 0x83, 0x71, 0xFF, 0x07, 0x72, 0xFF, 0xE7, 0x71, 0xFF, 0xA3, 0x48, 0xFF, 0xE3, 0xC0, 0xFF, 0x04, 0x49, 0xFF, 0x06, 0x62, 0xFF, 0xA7, 0x81, 0xFF, 0x8C, 0xFB, 0xFF, 0x04, 0x51, 0xFF, 0x2C, 0xCC, 0xFF, 0xA7, 0x81, 0xFF, 0xE9, 0xF9, 0xFF, 0x43, 0x61, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0xA8, 0xB1, 0xFF, 0x05, 0x61, 0xFF, 0x45, 0x51, 0xFF, 0x65, 0x59, 0xFF, 0xC8, 0xC1, 0xFF, 0x46, 0x59, 0xFF, 0x67, 0xF1, 0xFF, 0xA4, 0xB1, 0xFF, 0x20, 0x70, 0xFF, 0xC2, 0x48, 0xFF, 0x81, 0x80, 0xFF, 0x25, 0xF2, 0xFF, 0x84, 0xB9, 0xFF, 0xA2, 0x60, 0xFF, 0xF1, 0xFE, 0xFF, 0xE5, 0xD1, 0xFF, 0xC3, 0x78, 0xFF, 0xA4, 0xA1, 0xFF, 0x03, 0x61, 0xFF, 0x41, 0xB0, 0xFF, 0xC2, 0x60, 0xFF, 0x46, 0xD2, 0xFF, 0xA4, 0xB1, 0xFF,
-    0x68, 0xD2, 0xFF, 0x63, 0x99, 0xFF, 0x44, 0x69, 0xFF, 0xA1, 0x50, 0xFF, 0x06, 0xFA, 0xFF, 0x43, 0x61, 0xFF, 0x02, 0x59, 0xFF, 0xC6, 0xB1, 0xFF, 0x47, 0x9A, 0xFF, 0x85, 0xF9, 0xFF, 0xE3, 0x68, 0xFF, 0x43, 0x61, 0xFF, 0xE6, 0x99, 0xFF, 0x65, 0x69, 0xFF, 0x8D, 0xFD, 0xFF, 0x85, 0x81, 0xFF, 0x68, 0xC2, 0xFF, 0x81, 0x80, 0xFF, 0xA2, 0x58, 0xFF, 0xE8, 0xFA, 0xFF, 0xC7, 0xE2, 0xFF, 0xE3, 0x58, 0xFF, 0xE3, 0x50, 0xFF, 0x65, 0xA9, 0xFF, 0xA6, 0xF9, 0xFF, 0x85, 0x79, 0xFF, 0xC2, 0x58, 0xFF, 0xC3, 0x78, 0xFF, 0x04, 0x69, 0xFF, 0xC8, 0xD9, 0xFF, 0x44, 0x69, 0xFF, 0x68, 0xC2, 0xFF, 0x65, 0x71, 0xFF, 0xE3, 0x58, 0xFF, 0xC7, 0x79, 0xFF, 0x45, 0x89, 0xFF, 0xE6, 0x91, 0xFF, 0x03, 0x51, 0xFF, 0x65, 0x61, 0xFF, 0xC7, 0x71, 0xFF, 0x48, 0x7A, 0xFF, 0x24, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0x03, 0x51, 0xFF, 0x8A, 0x9A, 0xFF, 0x45, 0x51, 0xFF, 0xE3, 0x48, 0xFF, 0xE7, 0x89, 0xFF, 0xE4, 0x48, 0xFF, 0xC7, 0x79, 0xFF, 0xC6, 0x61, 0xFF, 0xA7, 0xA9, 0xFF, 0xE3, 0x48, 0xFF, 0xE7, 0x69, 0xFF, 0xA7, 0x89, 0xFF, 0xC4, 0x60, 0xFF, 0x86, 0x91, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0xA7, 0x89, 0xFF, 0x83, 0x78, 0xFF, 0x45, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x65, 0x59, 0xFF,
-    0xC2, 0x48, 0xFF, 0xC2, 0x50, 0xFF, 0xE3, 0x58, 0xFF, 0xE3, 0x50, 0xFF, 0x03, 0x59, 0xFF, 0xFA, 0xFF, 0xFF, 0x03, 0x59, 0xFF, 0x44, 0x91, 0xFF, 0xA6, 0xCA, 0xFF, 0xE3, 0x58, 0xFF, 0xE2, 0xA0, 0xFF, 0x27, 0xE2, 0xFF, 0x22, 0x81, 0xFF, 0xE3, 0xC8, 0xFF, 0xC2, 0x58, 0xFF, 0x64, 0xC1, 0xFF, 0x5A, 0xFF, 0xFF, 0x85, 0x79, 0xFF, 0xC6, 0x79, 0xFF, 0xE6, 0xC1, 0xFF, 0x22, 0x61, 0xFF, 0x44, 0x69, 0xFF, 0x08, 0xF3, 0xFF, 0xA6, 0x99, 0xFF, 0xC2, 0x58, 0xFF, 0x28, 0xFA, 0xFF, 0xF9, 0xFF, 0xFF, 0x24, 0x71, 0xFF, 0xA7, 0xA9, 0xFF, 0xC9, 0xFA, 0xFF, 0x03, 0x69, 0xFF, 0xE3, 0x80, 0xFF, 0x03, 0x71, 0xFF, 0xA1, 0x58, 0xFF, 0x03, 0x61, 0xFF, 0xE3, 0x70, 0xFF, 0xF6, 0xFF, 0xFF, 0xC2, 0x50, 0xFF, 0x03, 0x51, 0xFF, 0xD9, 0xFF, 0xFF, 0xA1, 0x68, 0xFF, 0x24, 0x69, 0xFF, 0x8B, 0xE3, 0xFF, 0xA1, 0x60, 0xFF, 0xCC, 0xFB, 0xFF, 0x24, 0x99, 0xFF, 0x82, 0xB8, 0xFF, 0x24, 0x61, 0xFF, 0x2B, 0xFC, 0xFF, 0x47, 0xCA, 0xFF, 0x22, 0x81, 0xFF, 0x64, 0x69, 0xFF, 0x6A, 0xFA, 0xFF, 0xFC, 0xFF, 0xFF, 0x44, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x07, 0x82, 0xFF, 0x64, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x44, 0x69, 0xFF, 0xE3, 0x50, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x81, 0xFF, 0xE2, 0x49, 0xFF,
-    0xC6, 0x79, 0xFF, 0xF8, 0xFF, 0xFF, 0x24, 0x49, 0xFF, 0xF3, 0xFE, 0xFF, 0x65, 0x79, 0xFF, 0x65, 0x59, 0xFF, 0x85, 0x59, 0xFF, 0xA7, 0xEA, 0xFF, 0x65, 0x59, 0xFF, 0xA6, 0x61, 0xFF, 0xA6, 0x79, 0xFF, 0x45, 0x59, 0xFF, 0x45, 0x59, 0xFF, 0x88, 0xB2, 0xFF, 0xA6, 0x69, 0xFF, 0x24, 0x59, 0xFF, 0xA2, 0x79, 0xFF, 0xC2, 0x40, 0xFF, 0xE2, 0x48, 0xFF, 0xC6, 0x81, 0xFF, 0xE3, 0x50, 0xFF, 0x87, 0xFA, 0xFF, 0x80, 0x58, 0xFF, 0x2F, 0xFE, 0xFF, 0x07, 0x8A, 0xFF, 0x66, 0xF1, 0xFF, 0xE2, 0x68, 0xFF, 0xA1, 0x70, 0xFF, 0x81, 0x60, 0xFF, 0xA1, 0x48, 0xFF, 0x02, 0xA1, 0xFF, 0x21, 0x81, 0xFF, 0x03, 0x61, 0xFF, 0x44, 0x71, 0xFF, 0xA6, 0xE1, 0xFF, 0x03, 0x69, 0xFF, 0x23, 0x61, 0xFF, 0xA0, 0x98, 0xFF, 0xE8, 0xD2, 0xFF, 0x86, 0x71, 0xFF, 0x8C, 0xEB, 0xFF, 0x27, 0xBA, 0xFF, 0xC2, 0x58, 0xFF, 0x24, 0xC1, 0xFF, 0x24, 0x61, 0xFF, 0xA2, 0x60, 0xFF, 0x85, 0x89, 0xFF, 0xC7, 0xD1, 0xFF, 0x49, 0xD3, 0xFF, 0xA5, 0x89, 0xFF, 0x03, 0x61, 0xFF, 0x81, 0x68, 0xFF, 0x88, 0xFA, 0xFF, 0xC3, 0x50, 0xFF, 0x04, 0x51, 0xFF, 0x29, 0xF3, 0xFF, 0x8C, 0xFB, 0xFF, 0x64, 0x71, 0xFF, 0xEB, 0xF2, 0xFF, 0xF8, 0xFE, 0xFF, 0x6D, 0xFD, 0xFF, 0x29, 0xFA, 0xFF, 0x06, 0x82, 0xFF, 0x47, 0x82, 0xFF,
-    0x0C, 0xFB, 0xFF, 0x03, 0x51, 0xFF, 0x09, 0xDB, 0xFF, 0x51, 0xF6, 0xFF, 0x44, 0x61, 0xFF, 0x44, 0x81, 0xFF, 0xFD, 0xFF, 0xFF, 0xA6, 0x69, 0xFF, 0xA6, 0x69, 0xFF, 0xE7, 0x79, 0xFF, 0x25, 0x59, 0xFF, 0x87, 0x61, 0xFF, 0x0F, 0x51, 0xFF, 0xEF, 0xD3, 0xFF, 0xE4, 0x40, 0xFF, 0x25, 0x49, 0xFF, 0xFF, 0xF7, 0xFF, 0x05, 0x49, 0xFF, 0x88, 0xD1, 0xFF, 0xBC, 0xC4, 0xFF, 0x85, 0x61, 0xFF, 0x65, 0x59, 0xFF, 0x11, 0xFF, 0xFF, 0x64, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0xA5, 0x91, 0xFF, 0x03, 0x49, 0xFF, 0x85, 0x61, 0xFF, 0x86, 0xA1, 0xFF, 0x45, 0x51, 0xFF, 0x44, 0x59, 0xFF, 0x04, 0x61, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x78, 0xFF, 0xE2, 0x48, 0xFF, 0x44, 0xE9, 0xFF, 0x2A, 0xFC, 0xFF, 0x23, 0x61, 0xFF, 0x64, 0x69, 0xFF, 0x81, 0xB1, 0xFF, 0x27, 0xFA, 0xFF, 0x65, 0x79, 0xFF, 0xA1, 0x80, 0xFF, 0x81, 0x50, 0xFF, 0x61, 0x68, 0xFF, 0xA8, 0xFB, 0xFF, 0xAD, 0xFC, 0xFF, 0x23, 0x69, 0xFF, 0xE2, 0x58, 0xFF, 0x86, 0xF1, 0xFF, 0x84, 0x79, 0xFF, 0xC1, 0x58, 0xFF, 0x84, 0x91, 0xFF, 0x03, 0x91, 0xFF, 0xA5, 0x99, 0xFF, 0x02, 0x71, 0xFF, 0x23, 0x91, 0xFF, 0x24, 0x89, 0xFF, 0xC6, 0xA1, 0xFF, 0x03, 0x81, 0xFF, 0x87, 0xEA, 0xFF, 0xA6, 0x79, 0xFF, 0x85, 0xE9, 0xFF, 0x43, 0xC1, 0xFF,
-    0x12, 0xFF, 0xFF, 0x45, 0x81, 0xFF, 0x24, 0x71, 0xFF, 0x24, 0x89, 0xFF, 0x88, 0xE2, 0xFF, 0xE3, 0x58, 0xFF, 0x24, 0x59, 0xFF, 0xF4, 0xFF, 0xFF, 0xAA, 0xF2, 0xFF, 0x64, 0x71, 0xFF, 0xA2, 0x70, 0xFF, 0x37, 0xF7, 0xFF, 0xE2, 0x68, 0xFF, 0x48, 0x8A, 0xFF, 0xC6, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x71, 0xFF, 0x48, 0xBA, 0xFF, 0xAA, 0xFA, 0xFF, 0x7B, 0xFF, 0xFF, 0xA5, 0x91, 0xFF, 0x03, 0x71, 0xFF, 0x23, 0x61, 0xFF, 0xA7, 0xBA, 0xFF, 0x07, 0x7A, 0xFF, 0x04, 0x51, 0xFF, 0xE7, 0x79, 0xFF, 0x04, 0x49, 0xFF, 0x45, 0x51, 0xFF, 0x38, 0x54, 0xFF, 0x86, 0x79, 0xFF, 0x45, 0x59, 0xFF, 0x12, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xE4, 0x90, 0xFF, 0x27, 0xE3, 0xFF, 0x7E, 0xBC, 0xFF, 0x66, 0x59, 0xFF, 0xA7, 0xC9, 0xFF, 0x6C, 0xAB, 0xFF, 0x09, 0xFA, 0xFF, 0xA6, 0x89, 0xFF, 0xE3, 0x50, 0xFF, 0x44, 0x59, 0xFF, 0xE2, 0x50, 0xFF, 0xC5, 0xC8, 0xFF, 0x08, 0xC2, 0xFF, 0x25, 0x61, 0xFF, 0xC2, 0x48, 0xFF, 0x86, 0xD1, 0xFF, 0xA5, 0x89, 0xFF, 0x20, 0x70, 0xFF, 0x23, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0xE8, 0xFA, 0xFF, 0x60, 0x50, 0xFF, 0x41, 0xD8, 0xFF, 0xC1, 0x50, 0xFF, 0x23, 0x89, 0xFF, 0x68, 0xFB, 0xFF, 0x65, 0xF9, 0xFF, 0xC7, 0xFA, 0xFF, 0x81, 0x50, 0xFF, 0xC2, 0x58, 0xFF,
-    0xAC, 0xFD, 0xFF, 0x43, 0x71, 0xFF, 0xA5, 0x79, 0xFF, 0xE6, 0xAA, 0xFF, 0xA6, 0xE1, 0xFF, 0x45, 0xF1, 0xFF, 0x62, 0x91, 0xFF, 0xE2, 0x80, 0xFF, 0x68, 0xEA, 0xFF, 0x65, 0x91, 0xFF, 0x7A, 0xFF, 0xFF, 0xC6, 0x89, 0xFF, 0xA3, 0xB8, 0xFF, 0x82, 0x68, 0xFF, 0x04, 0x89, 0xFF, 0xA1, 0x60, 0xFF, 0x05, 0xDA, 0xFF, 0x61, 0x50, 0xFF, 0x03, 0x69, 0xFF, 0xA6, 0xF1, 0xFF, 0xC9, 0xFB, 0xFF, 0xE3, 0x50, 0xFF, 0x03, 0x51, 0xFF, 0x81, 0x98, 0xFF, 0xE7, 0xA9, 0xFF, 0x44, 0x71, 0xFF, 0xC6, 0x91, 0xFF, 0xA4, 0x91, 0xFF, 0x43, 0x61, 0xFF, 0x65, 0x79, 0xFF, 0x06, 0xCA, 0xFF, 0xE4, 0x79, 0xFF, 0x44, 0x69, 0xFF, 0x06, 0xBA, 0xFF, 0xE3, 0x68, 0xFF, 0x92, 0xE5, 0xFF, 0x88, 0x9A, 0xFF, 0xE2, 0x88, 0xFF, 0x07, 0x8A, 0xFF, 0xEA, 0xEA, 0xFF, 0x33, 0xEE, 0xFF, 0x44, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0xC7, 0x79, 0xFF, 0x04, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x03, 0x51, 0xFF, 0xE7, 0xA1, 0xFF, 0x46, 0xF1, 0xFF, 0xB1, 0xE5, 0xFF, 0x23, 0x41, 0xFF, 0x41, 0x70, 0xFF, 0xC6, 0x81, 0xFF, 0xC9, 0xF1, 0xFF, 0xC8, 0x7A, 0xFF, 0x23, 0x71, 0xFF, 0x85, 0x81, 0xFF, 0x19, 0xFF, 0xFF, 0x03, 0x61, 0xFF, 0x04, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x12, 0xFF, 0xFF, 0x45, 0x59, 0xFF, 0xA8, 0xFB, 0xFF,
-    0x63, 0xB1, 0xFF, 0xC2, 0x50, 0xFF, 0xE2, 0x60, 0xFF, 0xA1, 0x48, 0xFF, 0xA5, 0xAA, 0xFF, 0xE4, 0xC1, 0xFF, 0xA2, 0x50, 0xFF, 0x43, 0x91, 0xFF, 0x60, 0x50, 0xFF, 0xC2, 0x60, 0xFF, 0x0A, 0xFC, 0xFF, 0x24, 0xC9, 0xFF, 0x60, 0x68, 0xFF, 0xC2, 0x58, 0xFF, 0x81, 0x50, 0xFF, 0x50, 0xFE, 0xFF, 0xE1, 0x70, 0xFF, 0x43, 0x69, 0xFF, 0xC4, 0xA9, 0xFF, 0x64, 0x89, 0xFF, 0xE9, 0xFB, 0xFF, 0x24, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x90, 0xFF, 0x27, 0xD2, 0xFF, 0xE9, 0xFB, 0xFF, 0x43, 0x79, 0xFF, 0x44, 0xA9, 0xFF, 0xE7, 0x89, 0xFF, 0xF9, 0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0x44, 0x91, 0xFF, 0x86, 0xA1, 0xFF, 0x22, 0x69, 0xFF, 0xC2, 0x60, 0xFF, 0xA6, 0xF9, 0xFF, 0xFE, 0xFF, 0xFF, 0xC2, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0x64, 0xA9, 0xFF, 0xC7, 0xB9, 0xFF, 0x44, 0x69, 0xFF, 0x06, 0x72, 0xFF, 0xDE, 0xFF, 0xFF, 0xB6, 0xEE, 0xFF, 0xE6, 0x81, 0xFF, 0xDD, 0xFF, 0xFF, 0x86, 0x69, 0xFF, 0xDD, 0xFF, 0xFF, 0x03, 0x51, 0xFF, 0xC7, 0x81, 0xFF, 0x78, 0xFF, 0xFF, 0x72, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE7, 0x79, 0xFF, 0xCC, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x48, 0xFF, 0x65, 0x59, 0xFF, 0x08, 0xBA, 0xFF, 0xC3, 0x40, 0xFF, 0xE4, 0x48, 0xFF, 0xA6, 0x61, 0xFF,
-    0x46, 0x99, 0xFF, 0xC6, 0xC1, 0xFF, 0x04, 0x49, 0xFF, 0xAB, 0x48, 0xFF, 0x28, 0x9A, 0xFF, 0xC3, 0x48, 0xFF, 0x28, 0xEB, 0xFF, 0xC2, 0x48, 0xFF, 0x85, 0x69, 0xFF, 0x65, 0x69, 0xFF, 0x65, 0x59, 0xFF, 0x4F, 0xF6, 0xFF, 0xA2, 0x68, 0xFF, 0x65, 0x59, 0xFF, 0xA6, 0x71, 0xFF, 0xE7, 0xA1, 0xFF, 0xE2, 0x50, 0xFF, 0x61, 0x98, 0xFF, 0x84, 0x91, 0xFF, 0xE1, 0x58, 0xFF, 0x06, 0xEA, 0xFF, 0x44, 0xA1, 0xFF, 0x41, 0xD1, 0xFF, 0x43, 0x81, 0xFF, 0x61, 0x48, 0xFF, 0x60, 0x48, 0xFF, 0xC6, 0xA9, 0xFF, 0xE9, 0xCA, 0xFF, 0xA2, 0x50, 0xFF, 0x24, 0x61, 0xFF, 0xA4, 0x99, 0xFF, 0x44, 0x71, 0xFF, 0xA1, 0x40, 0xFF, 0xC2, 0x70, 0xFF, 0xE6, 0xE1, 0xFF, 0x44, 0x69, 0xFF, 0xA1, 0x60, 0xFF, 0xC1, 0xA8, 0xFF, 0xA2, 0x58, 0xFF, 0x03, 0x91, 0xFF, 0x64, 0xA9, 0xFF, 0xC5, 0xE2, 0xFF, 0x85, 0x81, 0xFF, 0xE8, 0xF9, 0xFF, 0xA6, 0x81, 0xFF, 0xC3, 0x68, 0xFF, 0x24, 0x89, 0xFF, 0xCC, 0xFD, 0xFF, 0x8F, 0xF5, 0xFF, 0x24, 0x69, 0xFF, 0xC3, 0x68, 0xFF, 0x35, 0xFF, 0xFF, 0xF5, 0xE5, 0xFF, 0x45, 0x59, 0xFF, 0xE3, 0x48, 0xFF, 0x87, 0x8A, 0xFF, 0x97, 0xFF, 0xFF, 0x03, 0x61, 0xFF, 0x24, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xE7, 0x71, 0xFF, 0x89, 0x59, 0xFF, 0xEB, 0x69, 0xFF,
-    0x8D, 0xE3, 0xFF, 0xE2, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x71, 0xFF, 0x07, 0x92, 0xFF, 0x60, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0x61, 0xFF, 0xC5, 0x69, 0xFF, 0x4C, 0xF4, 0xFF, 0x44, 0x61, 0xFF, 0x24, 0x51, 0xFF, 0x04, 0x49, 0xFF, 0xA6, 0x89, 0xFF, 0xA2, 0x40, 0xFF, 0x04, 0x49, 0xFF, 0xAA, 0x9A, 0xFF, 0x74, 0xB4, 0xFF, 0xE4, 0x48, 0xFF, 0x25, 0x51, 0xFF, 0x5E, 0xF7, 0xFF, 0x65, 0x61, 0xFF, 0x61, 0xA0, 0xFF, 0x2F, 0xCE, 0xFF, 0x65, 0x59, 0xFF, 0xC8, 0xF1, 0xFF, 0x24, 0x59, 0xFF, 0x65, 0x69, 0xFF, 0x65, 0x61, 0xFF, 0x86, 0x91, 0xFF, 0x24, 0x61, 0xFF, 0x44, 0x69, 0xFF, 0x40, 0x40, 0xFF, 0x00, 0x80, 0xFF, 0x81, 0x40, 0xFF, 0xAD, 0xEC, 0xFF, 0x03, 0x59, 0xFF, 0x63, 0x99, 0xFF, 0x43, 0x89, 0xFF, 0xA1, 0x40, 0xFF, 0x64, 0x89, 0xFF, 0xA0, 0x80, 0xFF, 0x02, 0x61, 0xFF, 0x03, 0x61, 0xFF, 0x27, 0x92, 0xFF, 0xE6, 0xE1, 0xFF, 0x84, 0x71, 0xFF, 0xC2, 0x58, 0xFF, 0x81, 0x48, 0xFF, 0x44, 0xE1, 0xFF, 0x80, 0x58, 0xFF, 0x85, 0x79, 0xFF, 0xB9, 0xFF, 0xFF, 0x03, 0x71, 0xFF, 0xA4, 0xB9, 0xFF, 0x03, 0x71, 0xFF, 0x85, 0x89, 0xFF, 0x03, 0x69, 0xFF, 0x88, 0xFA, 0xFF, 0x44, 0x81, 0xFF, 0x24, 0xE1, 0xFF, 0xA2, 0x58, 0xFF, 0xE2, 0x60, 0xFF, 0x0A, 0xFC, 0xFF,
-    0xDD, 0xFF, 0xFF, 0x60, 0x48, 0xFF, 0x03, 0x69, 0xFF, 0xE6, 0xE9, 0xFF, 0x44, 0x91, 0xFF, 0xC2, 0x48, 0xFF, 0x03, 0x51, 0xFF, 0x84, 0x79, 0xFF, 0x87, 0xEA, 0xFF, 0x48, 0x8A, 0xFF, 0x24, 0x59, 0xFF, 0x8A, 0x69, 0xFF, 0x4C, 0xE3, 0xFF, 0xC6, 0x79, 0xFF, 0xA8, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x61, 0xFF, 0x89, 0xFA, 0xFF, 0x24, 0x61, 0xFF, 0xA8, 0x92, 0xFF, 0xC6, 0x91, 0xFF, 0xA9, 0xCA, 0xFF, 0xC2, 0x68, 0xFF, 0x64, 0x79, 0xFF, 0xE6, 0x79, 0xFF, 0xA2, 0x48, 0xFF, 0xE7, 0xB1, 0xFF, 0x63, 0x61, 0xFF, 0xE3, 0x40, 0xFF, 0xA2, 0x40, 0xFF, 0x47, 0x9A, 0xFF, 0x45, 0x59, 0xFF, 0xC3, 0x40, 0xFF, 0x04, 0x49, 0xFF, 0x29, 0xB2, 0xFF, 0xC7, 0xE1, 0xFF, 0x25, 0x49, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x50, 0xFF, 0x82, 0x80, 0xFF, 0xA6, 0x79, 0xFF, 0x64, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0x24, 0x51, 0xFF, 0x45, 0x61, 0xFF, 0x2D, 0xFD, 0xFF, 0x65, 0x79, 0xFF, 0x45, 0x61, 0xFF, 0x81, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0x81, 0x40, 0xFF, 0xE4, 0x90, 0xFF, 0xE2, 0x58, 0xFF, 0x24, 0x72, 0xFF, 0xC2, 0x48, 0xFF, 0x89, 0x92, 0xFF, 0xA5, 0xE1, 0xFF, 0x24, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0xE3, 0x60, 0xFF, 0x05, 0xF9, 0xFF, 0x24, 0x61, 0xFF, 0x03, 0x61, 0xFF, 0x03, 0x59, 0xFF,
-    0x45, 0xF9, 0xFF, 0xE2, 0x58, 0xFF, 0xA1, 0x50, 0xFF, 0x85, 0x79, 0xFF, 0x08, 0xFA, 0xFF, 0xC6, 0xB1, 0xFF, 0x61, 0x60, 0xFF, 0xE3, 0x68, 0xFF, 0x47, 0xFA, 0xFF, 0xC2, 0x68, 0xFF, 0x89, 0xD2, 0xFF, 0xE6, 0x81, 0xFF, 0xA3, 0xD1, 0xFF, 0x44, 0x99, 0xFF, 0xE3, 0x78, 0xFF, 0x44, 0x79, 0xFF, 0x6C, 0xF4, 0xFF, 0x60, 0x48, 0xFF, 0xC2, 0x68, 0xFF, 0x48, 0xDA, 0xFF, 0xC7, 0xDA, 0xFF, 0xE3, 0x50, 0xFF, 0xE3, 0x50, 0xFF, 0xC5, 0x99, 0xFF, 0xA9, 0xBA, 0xFF, 0x44, 0x69, 0xFF, 0xA6, 0x79, 0xFF, 0xE7, 0xBA, 0xFF, 0x47, 0x82, 0xFF, 0xC6, 0x79, 0xFF, 0x48, 0x92, 0xFF, 0x06, 0x72, 0xFF, 0xA6, 0x69, 0xFF, 0xCE, 0xDB, 0xFF, 0xC2, 0x70, 0xFF, 0x98, 0xEE, 0xFF, 0x88, 0x92, 0xFF, 0x06, 0xB2, 0xFF, 0xCA, 0xAA, 0xFF, 0xEF, 0xFB, 0xFF, 0x87, 0x9A, 0xFF, 0xC3, 0x50, 0xFF, 0x24, 0x51, 0xFF, 0x68, 0xEA, 0xFF, 0x02, 0x51, 0xFF, 0xC3, 0x48, 0xFF, 0x44, 0x59, 0xFF, 0x86, 0x99, 0xFF, 0xA3, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x29, 0xDA, 0xFF, 0xAA, 0xB2, 0xFF, 0x24, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0x04, 0x51, 0xFF, 0x45, 0x91, 0xFF, 0xC5, 0xB1, 0xFF, 0x24, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x24, 0x51, 0xFF, 0x85, 0x69, 0xFF, 0xA5, 0x81, 0xFF,
-    0x60, 0x38, 0xFF, 0x60, 0x50, 0xFF, 0xC2, 0x58, 0xFF, 0xA1, 0x40, 0xFF, 0x03, 0x61, 0xFF, 0x24, 0x59, 0xFF, 0x26, 0xD1, 0xFF, 0x22, 0x99, 0xFF, 0xA5, 0x71, 0xFF, 0x85, 0x69, 0xFF, 0xA2, 0x50, 0xFF, 0x45, 0xE1, 0xFF, 0x03, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x69, 0xFF, 0x23, 0x99, 0xFF, 0x27, 0xFB, 0xFF, 0xC2, 0x58, 0xFF, 0x03, 0x71, 0xFF, 0xE3, 0xC0, 0xFF, 0x64, 0x79, 0xFF, 0x81, 0x60, 0xFF, 0xC2, 0x68, 0xFF, 0x81, 0x68, 0xFF, 0xC6, 0x89, 0xFF, 0xC2, 0x80, 0xFF, 0x23, 0x69, 0xFF, 0x65, 0xA1, 0xFF, 0xC3, 0x78, 0xFF, 0x82, 0x68, 0xFF, 0xC3, 0x60, 0xFF, 0xE2, 0x88, 0xFF, 0x65, 0xB1, 0xFF, 0x64, 0x81, 0xFF, 0xE3, 0x60, 0xFF, 0x23, 0x99, 0xFF, 0x47, 0xDA, 0xFF, 0xC3, 0x50, 0xFF, 0xE3, 0x50, 0xFF, 0xE6, 0xC1, 0xFF, 0xCF, 0xD4, 0xFF, 0xC6, 0x81, 0xFF, 0x85, 0x81, 0xFF, 0xD5, 0xEE, 0xFF, 0x76, 0xF6, 0xFF, 0x85, 0x71, 0xFF, 0xC5, 0x69, 0xFF, 0x27, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x51, 0xFF, 0x4C, 0xCC, 0xFF, 0xE6, 0x89, 0xFF, 0xEF, 0xD4, 0xFF, 0xE6, 0xA9, 0xFF, 0x86, 0x81, 0xFF, 0x24, 0x69, 0xFF, 0xCF, 0xFD, 0xFF, 0xA6, 0x71, 0xFF, 0x65, 0x61, 0xFF, 0xE8, 0xA1, 0xFF, 0x28, 0xFA, 0xFF, 0xE3, 0x58, 0xFF, 0x65, 0x59, 0xFF, 0xC2, 0x40, 0xFF,
-    0x66, 0xD9, 0xFF, 0x25, 0x51, 0xFF, 0x85, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0x67, 0xEA, 0xFF, 0x24, 0x61, 0xFF, 0x24, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x44, 0x79, 0xFF, 0x84, 0x61, 0xFF, 0x64, 0x61, 0xFF, 0x64, 0x61, 0xFF, 0x45, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x64, 0x71, 0xFF, 0x8F, 0xFE, 0xFF, 0xC2, 0x40, 0xFF, 0xA2, 0x38, 0xFF, 0x81, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0xAE, 0xFE, 0xFF, 0xA1, 0x58, 0xFF, 0xA1, 0x40, 0xFF, 0xE3, 0x50, 0xFF, 0xC2, 0x48, 0xFF, 0x6A, 0xFD, 0xFF, 0xC2, 0x50, 0xFF, 0xA2, 0x48, 0xFF, 0xA2, 0x50, 0xFF, 0xE3, 0x78, 0xFF, 0xF7, 0xFF, 0xFF, 0xE3, 0x70, 0xFF, 0xA1, 0x60, 0xFF, 0xA1, 0x70, 0xFF, 0xE2, 0x60, 0xFF, 0xFA, 0xFF, 0xFF, 0xEA, 0xBA, 0xFF, 0xC2, 0x60, 0xFF, 0x07, 0xAA, 0xFF, 0x23, 0x71, 0xFF, 0xF5, 0xFF, 0xFF, 0x48, 0x92, 0xFF, 0xC6, 0xB9, 0xFF, 0x61, 0x68, 0xFF, 0xE3, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xFF, 0xFF, 0xC6, 0xB1, 0xFF, 0xA2, 0x50, 0xFF, 0x03, 0x69, 0xFF, 0x6A, 0xFB, 0xFF, 0x43, 0x89, 0xFF, 0x03, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x43, 0x81, 0xFF, 0x07, 0xEA, 0xFF, 0x24, 0x69, 0xFF, 0x65, 0x71, 0xFF, 0x98, 0xCD, 0xFF, 0x54, 0xFE, 0xFF, 0xE7, 0x81, 0xFF, 0x67, 0x59, 0xFF, 0x1F, 0xC5, 0xFF,
-    0x8C, 0xD3, 0xFF, 0xE3, 0x58, 0xFF, 0xE7, 0x81, 0xFF, 0xA9, 0xA2, 0xFF, 0x86, 0x81, 0xFF, 0x64, 0x89, 0xFF, 0xCA, 0xBB, 0xFF, 0xC6, 0x79, 0xFF, 0x48, 0x82, 0xFF, 0xA8, 0xB9, 0xFF, 0x86, 0x71, 0xFF, 0xC7, 0x59, 0xFF, 0x29, 0xFB, 0xFF, 0xC3, 0x58, 0xFF, 0xC3, 0x40, 0xFF, 0x04, 0x41, 0xFF, 0x45, 0x59, 0xFF, 0xD5, 0xFF, 0xFF, 0xA2, 0x40, 0xFF, 0x46, 0x51, 0xFF, 0x45, 0x51, 0xFF, 0x45, 0x59, 0xFF, 0xFE, 0xFF, 0xFF, 0x44, 0x59, 0xFF, 0x04, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x59, 0xFF, 0x03, 0x49, 0xFF, 0x44, 0x59, 0xFF, 0x85, 0x69, 0xFF, 0x81, 0x38, 0xFF, 0x04, 0x69, 0xFF, 0x81, 0x30, 0xFF, 0xA1, 0x38, 0xFF, 0x61, 0x40, 0xFF, 0x41, 0x50, 0xFF, 0x81, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0x81, 0x40, 0xFF, 0x81, 0x50, 0xFF, 0xA2, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0x81, 0x40, 0xFF, 0x40, 0x80, 0xFF, 0xE3, 0x60, 0xFF, 0xC2, 0x68, 0xFF, 0xC2, 0x68, 0xFF, 0x07, 0xFA, 0xFF, 0x23, 0x79, 0xFF, 0xA2, 0x60, 0xFF, 0x23, 0x71, 0xFF, 0xC2, 0x70, 0xFF, 0xC6, 0x91, 0xFF, 0xC2, 0x58, 0xFF, 0xE3, 0x70, 0xFF, 0xA2, 0x58, 0xFF, 0xA2, 0x58, 0xFF, 0xC2, 0x68, 0xFF, 0xC2, 0x60, 0xFF, 0x23, 0x61, 0xFF, 0xC2, 0x58, 0xFF, 0xA5, 0xA1, 0xFF,
-    0xA5, 0x81, 0xFF, 0xE3, 0x58, 0xFF, 0xE2, 0x58, 0xFF, 0xC2, 0x78, 0xFF, 0x23, 0x79, 0xFF, 0xE3, 0x58, 0xFF, 0x03, 0x59, 0xFF, 0xE5, 0x81, 0xFF, 0x84, 0x69, 0xFF, 0x03, 0x61, 0xFF, 0x45, 0x69, 0xFF, 0x87, 0x59, 0xFF, 0x85, 0x81, 0xFF, 0x65, 0x69, 0xFF, 0x25, 0x51, 0xFF, 0x4C, 0x6A, 0xFF, 0x44, 0x69, 0xFF, 0x03, 0x61, 0xFF, 0x45, 0x69, 0xFF, 0x47, 0x8A, 0xFF, 0xC2, 0x60, 0xFF, 0x43, 0x81, 0xFF, 0x28, 0xA3, 0xFF, 0x67, 0x8A, 0xFF, 0xA5, 0x69, 0xFF, 0x71, 0x93, 0xFF, 0xCA, 0x82, 0xFF, 0x4A, 0x6A, 0xFF, 0x6F, 0x5A, 0xFF, 0x05, 0x41, 0xFF, 0x65, 0x69, 0xFF, 0xE4, 0x40, 0xFF, 0x27, 0x49, 0xFF, 0x45, 0x51, 0xFF, 0xE3, 0x48, 0xFF, 0x26, 0x51, 0xFF, 0x65, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x61, 0xFF, 0x63, 0x81, 0xFF, 0x23, 0x59, 0xFF, 0x23, 0x51, 0xFF, 0x25, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x24, 0x59, 0xFF, 0x44, 0x61, 0xFF, 0xA5, 0x69, 0xFF, 0x81, 0x30, 0xFF, 0xC3, 0x40, 0xFF, 0x81, 0x30, 0xFF, 0x82, 0x78, 0xFF, 0xC2, 0x50, 0xFF, 0x81, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0x81, 0x38, 0xFF, 0x45, 0xC9, 0xFF, 0xC2, 0x50, 0xFF, 0x81, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0x46, 0xF9, 0xFF, 0xC2, 0x80, 0xFF, 0x03, 0x61, 0xFF, 0xC2, 0x58, 0xFF,
-    0x64, 0xA9, 0xFF, 0x45, 0xD9, 0xFF, 0xA2, 0x60, 0xFF, 0x81, 0x48, 0xFF, 0x82, 0xD8, 0xFF, 0xE3, 0x70, 0xFF, 0x06, 0xCA, 0xFF, 0xA2, 0x58, 0xFF, 0xA2, 0xC0, 0xFF, 0xA2, 0x50, 0xFF, 0x21, 0x78, 0xFF, 0x24, 0x79, 0xFF, 0x69, 0xFC, 0xFF, 0x03, 0x61, 0xFF, 0xC3, 0x58, 0xFF, 0x61, 0x70, 0xFF, 0xC2, 0xA8, 0xFF, 0xE3, 0x50, 0xFF, 0xC2, 0x58, 0xFF, 0x23, 0x71, 0xFF, 0x26, 0x9A, 0xFF, 0x03, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x64, 0x81, 0xFF, 0x88, 0xFA, 0xFF, 0x23, 0x61, 0xFF, 0x65, 0x79, 0xFF, 0xC5, 0x69, 0xFF, 0xC5, 0x71, 0xFF, 0x44, 0x69, 0xFF, 0x25, 0x59, 0xFF, 0x45, 0x61, 0xFF, 0x65, 0x71, 0xFF, 0x49, 0xE2, 0xFF, 0x24, 0x69, 0xFF, 0xC4, 0x81, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x69, 0xFF, 0x68, 0x7A, 0xFF, 0x8C, 0xFB, 0xFF, 0x44, 0x59, 0xFF, 0x89, 0x51, 0xFF, 0xA9, 0xFA, 0xFF, 0xC8, 0xE9, 0xFF, 0x8A, 0x49, 0xFF, 0xA3, 0x38, 0xFF, 0xE2, 0x48, 0xFF, 0x85, 0x79, 0xFF, 0xA4, 0x38, 0xFF, 0xC4, 0x38, 0xFF, 0xE3, 0x48, 0xFF, 0xCE, 0xFD, 0xFF, 0x44, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x69, 0xFF, 0xA2, 0x58, 0xFF, 0x44, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0xC6, 0xA1, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x59, 0xFF,
-    0x81, 0x30, 0xFF, 0x41, 0x30, 0xFF, 0x85, 0x79, 0xFF, 0xE2, 0x48, 0xFF, 0xA2, 0x38, 0xFF, 0xA1, 0x38, 0xFF, 0x40, 0x38, 0xFF, 0x44, 0x81, 0xFF, 0x61, 0x40, 0xFF, 0x81, 0x40, 0xFF, 0x81, 0x48, 0xFF, 0xC2, 0x78, 0xFF, 0xE2, 0x70, 0xFF, 0x44, 0x71, 0xFF, 0xE2, 0x58, 0xFF, 0xE6, 0xC9, 0xFF, 0x64, 0xC1, 0xFF, 0xA4, 0x99, 0xFF, 0x03, 0x81, 0xFF, 0x41, 0x98, 0xFF, 0xA1, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x70, 0xFF, 0xA2, 0x70, 0xFF, 0xC2, 0x60, 0xFF, 0x81, 0x60, 0xFF, 0x27, 0xE3, 0xFF, 0xC3, 0x78, 0xFF, 0xA2, 0x60, 0xFF, 0x24, 0x69, 0xFF, 0xE3, 0xB0, 0xFF, 0xC2, 0x70, 0xFF, 0xE3, 0x68, 0xFF, 0x03, 0x59, 0xFF, 0xE3, 0x58, 0xFF, 0x89, 0xFC, 0xFF, 0xE3, 0x70, 0xFF, 0x03, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x44, 0x89, 0xFF, 0xE9, 0xFB, 0xFF, 0x03, 0x61, 0xFF, 0x24, 0x71, 0xFF, 0x64, 0x71, 0xFF, 0x6E, 0xDC, 0xFF, 0xA5, 0x89, 0xFF, 0x44, 0x79, 0xFF, 0x24, 0x61, 0xFF, 0x9C, 0xFF, 0xFF, 0x2B, 0xC3, 0xFF, 0x44, 0x69, 0xFF, 0x85, 0x79, 0xFF, 0x09, 0xD4, 0xFF, 0xC5, 0x81, 0xFF, 0xC7, 0xF1, 0xFF, 0xA8, 0x8A, 0xFF, 0x66, 0xEB, 0xFF, 0x06, 0x49, 0xFF, 0x68, 0x72, 0xFF, 0x6A, 0xFB, 0xFF, 0x8B, 0xFC, 0xFF, 0xE4, 0x40, 0xFF, 0xA5, 0x59, 0xFF, 0x64, 0x91, 0xFF,
-    0x00, 0xA0, 0xFF, 0x04, 0x41, 0xFF, 0xE3, 0x40, 0xFF, 0x24, 0x49, 0xFF, 0x79, 0xFF, 0xFF, 0x44, 0x51, 0xFF, 0x43, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x61, 0xFF, 0x24, 0xAA, 0xFF, 0x82, 0x38, 0xFF, 0x61, 0x30, 0xFF, 0xA1, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0xA2, 0x40, 0xFF, 0x61, 0x38, 0xFF, 0xA1, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x50, 0xFF, 0xA1, 0x50, 0xFF, 0x03, 0x79, 0xFF, 0x43, 0x71, 0xFF, 0xC2, 0x60, 0xFF, 0x84, 0x99, 0xFF, 0xE4, 0xA9, 0xFF, 0x83, 0x91, 0xFF, 0x43, 0x89, 0xFF, 0x23, 0x89, 0xFF, 0x60, 0x60, 0xFF, 0x23, 0x81, 0xFF, 0x44, 0x99, 0xFF, 0xC3, 0x78, 0xFF, 0xC3, 0x60, 0xFF, 0x04, 0x69, 0xFF, 0xE3, 0x78, 0xFF, 0x61, 0x68, 0xFF, 0x03, 0x61, 0xFF, 0x44, 0x69, 0xFF, 0xC2, 0x60, 0xFF, 0x07, 0xCA, 0xFF, 0xC2, 0x60, 0xFF, 0x03, 0x51, 0xFF, 0xE3, 0x58, 0xFF, 0x03, 0x79, 0xFF, 0x07, 0x8A, 0xFF, 0x44, 0x59, 0xFF, 0xE3, 0x60, 0xFF, 0x24, 0x99, 0xFF, 0x24, 0x81, 0xFF, 0x24, 0x69, 0xFF, 0x44, 0x71, 0xFF, 0x06, 0xB2, 0xFF, 0x4C, 0xB3, 0xFF, 0xA3, 0x58, 0xFF, 0x47, 0xBA, 0xFF, 0x23, 0x61, 0xFF,
-    0x89, 0x92, 0xFF, 0x65, 0x89, 0xFF, 0x85, 0x79, 0xFF, 0x24, 0x69, 0xFF, 0xA1, 0x58, 0xFF, 0xE5, 0x99, 0xFF, 0x02, 0x51, 0xFF, 0x47, 0x7A, 0xFF, 0xE2, 0x58, 0xFF, 0x45, 0x69, 0xFF, 0x69, 0x72, 0xFF, 0x88, 0x7A, 0xFF, 0x0A, 0x72, 0xFF, 0x24, 0x49, 0xFF, 0x22, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0xE4, 0x40, 0xFF, 0xA6, 0x81, 0xFF, 0x65, 0x51, 0xFF, 0x03, 0x41, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x02, 0x49, 0xFF, 0xC4, 0x69, 0xFF, 0x62, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0x43, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x09, 0xFC, 0xFF, 0x61, 0x30, 0xFF, 0x82, 0x38, 0xFF, 0xE3, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0xE5, 0xF9, 0xFF, 0x81, 0x40, 0xFF, 0x81, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0xA2, 0x48, 0xFF, 0x2D, 0xFE, 0xFF, 0xE2, 0x68, 0xFF, 0x44, 0x89, 0xFF, 0x23, 0x71, 0xFF, 0x81, 0x58, 0xFF, 0xF1, 0xFE, 0xFF, 0xC4, 0x91, 0xFF, 0xA4, 0x89, 0xFF, 0x64, 0xA9, 0xFF, 0x05, 0xA2, 0xFF, 0xFE, 0xFF, 0xFF, 0x64, 0x89, 0xFF, 0x81, 0x88, 0xFF, 0x03, 0x71, 0xFF, 0x82, 0x50, 0xFF, 0x92, 0xFF, 0xFF, 0xE3, 0x68, 0xFF, 0x42, 0x78, 0xFF, 0xE3, 0x50, 0xFF, 0x24, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x70, 0xFF,
-    0xC3, 0x58, 0xFF, 0x24, 0x59, 0xFF, 0xE3, 0x50, 0xFF, 0x49, 0xFB, 0xFF, 0x44, 0x81, 0xFF, 0x24, 0x59, 0xFF, 0x24, 0x61, 0xFF, 0x25, 0xAA, 0xFF, 0x87, 0xF1, 0xFF, 0x44, 0x61, 0xFF, 0x64, 0x71, 0xFF, 0xAA, 0xC3, 0xFF, 0x29, 0xAB, 0xFF, 0xA6, 0x81, 0xFF, 0x29, 0xA3, 0xFF, 0x27, 0x7A, 0xFF, 0xA6, 0x69, 0xFF, 0x64, 0x81, 0xFF, 0xA6, 0x71, 0xFF, 0x43, 0x61, 0xFF, 0xE2, 0x60, 0xFF, 0x84, 0x81, 0xFF, 0x23, 0x59, 0xFF, 0x86, 0xA1, 0xFF, 0xA1, 0x48, 0xFF, 0x45, 0x89, 0xFF, 0xE6, 0x61, 0xFF, 0xC5, 0x59, 0xFF, 0xC8, 0xFA, 0xFF, 0x04, 0x51, 0xFF, 0xE2, 0x48, 0xFF, 0x64, 0x59, 0xFF, 0xC3, 0x48, 0xFF, 0x73, 0xFF, 0xFF, 0xC3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0xFD, 0xFF, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x61, 0x30, 0xFF, 0x61, 0x30, 0xFF, 0x81, 0x38, 0xFF, 0x81, 0x38, 0xFF, 0x65, 0x71, 0xFF, 0x60, 0x38, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0xE2, 0x50, 0xFF, 0xC2, 0x50, 0xFF, 0xC2, 0x50, 0xFF, 0x44, 0x81, 0xFF, 0x44, 0x81, 0xFF, 0xA6, 0x91, 0xFF, 0x81, 0x58, 0xFF, 0xC4, 0xA1, 0xFF,
-    0xC4, 0x91, 0xFF, 0x45, 0xE1, 0xFF, 0xA4, 0xA9, 0xFF, 0x46, 0xAA, 0xFF, 0x83, 0x89, 0xFF, 0x23, 0x79, 0xFF, 0x28, 0xFB, 0xFF, 0x03, 0x61, 0xFF, 0xA2, 0x50, 0xFF, 0xC3, 0x58, 0xFF, 0xA2, 0x88, 0xFF, 0xC3, 0x60, 0xFF, 0xA2, 0x48, 0xFF, 0xC3, 0x58, 0xFF, 0xC2, 0x58, 0xFF, 0xE9, 0xFB, 0xFF, 0x81, 0x48, 0xFF, 0x03, 0x51, 0xFF, 0xE2, 0x50, 0xFF, 0xE3, 0xA8, 0xFF, 0x84, 0x81, 0xFF, 0x64, 0x61, 0xFF, 0x43, 0x69, 0xFF, 0xA6, 0xAA, 0xFF, 0x48, 0xFA, 0xFF, 0x24, 0x61, 0xFF, 0x65, 0x71, 0xFF, 0x72, 0xCC, 0xFF, 0x28, 0xAA, 0xFF, 0xE3, 0x58, 0xFF, 0x27, 0x7A, 0xFF, 0x8D, 0x7A, 0xFF, 0x45, 0x61, 0xFF, 0xC7, 0xF9, 0xFF, 0xA6, 0x9A, 0xFF, 0x43, 0x61, 0xFF, 0xE2, 0x60, 0xFF, 0xC7, 0xF9, 0xFF, 0x84, 0x99, 0xFF, 0x84, 0x61, 0xFF, 0x81, 0x48, 0xFF, 0xA6, 0x81, 0xFF, 0x07, 0xF9, 0xFF, 0xC5, 0x61, 0xFF, 0x85, 0x69, 0xFF, 0xE4, 0x40, 0xFF, 0x41, 0x80, 0xFF, 0x44, 0x59, 0xFF, 0xE3, 0x48, 0xFF, 0x04, 0x49, 0xFF, 0x03, 0x51, 0xFF, 0x8B, 0xFD, 0xFF, 0x02, 0x41, 0xFF, 0xE2, 0x48, 0xFF, 0x23, 0x49, 0xFF, 0xFE, 0xFF, 0xFF, 0xE2, 0x48, 0xFF, 0x03, 0x49, 0xFF, 0xC2, 0x40, 0xFF, 0x23, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x88, 0xFB, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF,
-    0xA2, 0x38, 0xFF, 0x82, 0x30, 0xFF, 0xA1, 0x38, 0xFF, 0x61, 0x30, 0xFF, 0xA1, 0x38, 0xFF, 0xE2, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0x81, 0x40, 0xFF, 0xC2, 0x60, 0xFF, 0x23, 0x71, 0xFF, 0x64, 0x81, 0xFF, 0x23, 0x71, 0xFF, 0x60, 0x50, 0xFF, 0xC4, 0x91, 0xFF, 0x04, 0x9A, 0xFF, 0xA4, 0x89, 0xFF, 0xA4, 0xA1, 0xFF, 0x46, 0xA2, 0xFF, 0x05, 0x9A, 0xFF, 0xE2, 0x70, 0xFF, 0xE3, 0x68, 0xFF, 0xE3, 0x68, 0xFF, 0xC2, 0x50, 0xFF, 0xC2, 0x58, 0xFF, 0x65, 0x79, 0xFF, 0xC2, 0x50, 0xFF, 0xA2, 0x50, 0xFF, 0xC3, 0x58, 0xFF, 0xE3, 0x58, 0xFF, 0xE2, 0x50, 0xFF, 0x82, 0x58, 0xFF, 0xC2, 0x50, 0xFF, 0xE3, 0x50, 0xFF, 0x23, 0x61, 0xFF, 0xA4, 0x99, 0xFF, 0x23, 0x51, 0xFF, 0x64, 0x69, 0xFF, 0x28, 0xB3, 0xFF, 0x46, 0x82, 0xFF, 0x44, 0x59, 0xFF, 0xA6, 0x79, 0xFF, 0x75, 0xC4, 0xFF, 0x8C, 0x72, 0xFF, 0x25, 0x59, 0xFF, 0x29, 0x7A, 0xFF, 0x77, 0x8B, 0xFF, 0x05, 0x51, 0xFF, 0x44, 0x69, 0xFF, 0x65, 0x8A, 0xFF, 0x02, 0x51, 0xFF, 0x03, 0x59, 0xFF, 0x85, 0x89, 0xFF, 0x43, 0x61, 0xFF, 0x23, 0x59, 0xFF, 0x81, 0x40, 0xFF, 0x86, 0x71, 0xFF, 0x85, 0x69, 0xFF, 0xC6, 0x61, 0xFF, 0x65, 0x59, 0xFF, 0x82, 0x30, 0xFF, 0xA2, 0x30, 0xFF, 0xE3, 0x48, 0xFF,
-    0xE4, 0x48, 0xFF, 0xE3, 0x40, 0xFF, 0x03, 0x41, 0xFF, 0xE2, 0x38, 0xFF, 0xA1, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0xE3, 0x38, 0xFF, 0xE3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x43, 0x51, 0xFF, 0x61, 0x30, 0xFF, 0x81, 0x30, 0xFF, 0xA3, 0xE0, 0xFF, 0x81, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0xA1, 0x38, 0xFF, 0xE2, 0x48, 0xFF, 0x05, 0xF1, 0xFF, 0x81, 0x40, 0xFF, 0x82, 0x48, 0xFF, 0xE2, 0x58, 0xFF, 0x03, 0x81, 0xFF, 0xC2, 0x60, 0xFF, 0xE2, 0x60, 0xFF, 0xE2, 0x68, 0xFF, 0xE4, 0x91, 0xFF, 0xEA, 0xFB, 0xFF, 0x83, 0x89, 0xFF, 0xA4, 0x91, 0xFF, 0x25, 0xA2, 0xFF, 0xA4, 0x89, 0xFF, 0xC8, 0xFA, 0xFF, 0x03, 0x79, 0xFF, 0x03, 0x81, 0xFF, 0x64, 0x81, 0xFF, 0xC2, 0x78, 0xFF, 0xD3, 0xFF, 0xFF, 0xA2, 0x58, 0xFF, 0x82, 0x60, 0xFF, 0xA2, 0x60, 0xFF, 0x62, 0x78, 0xFF, 0xE3, 0x68, 0xFF, 0xA2, 0x80, 0xFF, 0xE3, 0x70, 0xFF, 0x44, 0x61, 0xFF, 0x65, 0xE9, 0xFF, 0x66, 0xCA, 0xFF, 0x44, 0x69, 0xFF, 0x84, 0x69, 0xFF, 0xA8, 0xB3, 0xFF, 0xE7, 0xA1, 0xFF, 0xC6, 0x69, 0xFF, 0xC8, 0x71, 0xFF, 0xB3, 0xA3, 0xFF, 0xAC, 0x72, 0xFF, 0x66, 0x61, 0xFF, 0x6B, 0x7A, 0xFF, 0x8D, 0x72, 0xFF,
-    0xA7, 0x59, 0xFF, 0xC6, 0x71, 0xFF, 0x66, 0x8A, 0xFF, 0xA1, 0x48, 0xFF, 0x03, 0x61, 0xFF, 0x64, 0x81, 0xFF, 0x66, 0xD1, 0xFF, 0x81, 0x50, 0xFF, 0x81, 0x48, 0xFF, 0x43, 0x69, 0xFF, 0x85, 0x69, 0xFF, 0x85, 0xD9, 0xFF, 0x45, 0x59, 0xFF, 0x82, 0x30, 0xFF, 0x81, 0x30, 0xFF, 0xE3, 0x40, 0xFF, 0x04, 0x41, 0xFF, 0xE3, 0x40, 0xFF, 0x24, 0x49, 0xFF, 0xE2, 0x38, 0xFF, 0x4F, 0xFE, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0x02, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x39, 0xFF, 0x03, 0x39, 0xFF, 0xE3, 0x38, 0xFF, 0xE3, 0x40, 0xFF, 0x44, 0x49, 0xFF, 0xA5, 0x59, 0xFF, 0x61, 0x30, 0xFF, 0x82, 0x30, 0xFF, 0x61, 0x30, 0xFF, 0x81, 0x30, 0xFF, 0xA1, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0x81, 0x40, 0xFF, 0x81, 0x40, 0xFF, 0xA1, 0x48, 0xFF, 0xA2, 0x50, 0xFF, 0xC2, 0x50, 0xFF, 0xE2, 0x68, 0xFF, 0x40, 0x48, 0xFF, 0x60, 0x48, 0xFF, 0x43, 0x71, 0xFF, 0xC4, 0x91, 0xFF, 0xA4, 0x89, 0xFF, 0x83, 0x81, 0xFF, 0x84, 0x91, 0xFF, 0x05, 0x9A, 0xFF, 0x23, 0x81, 0xFF, 0x03, 0x71, 0xFF, 0xA1, 0x70, 0xFF, 0x23, 0x89, 0xFF, 0xA2, 0x60, 0xFF, 0xC3, 0x80, 0xFF, 0xA2, 0x68, 0xFF, 0xC2, 0x60, 0xFF, 0x82, 0x78, 0xFF, 0xA2, 0x70, 0xFF, 0xC3, 0x70, 0xFF, 0x03, 0x71, 0xFF,
-    0xA2, 0x80, 0xFF, 0xE3, 0x70, 0xFF, 0x24, 0x61, 0xFF, 0x06, 0xA2, 0xFF, 0xA4, 0xB1, 0xFF, 0x64, 0x71, 0xFF, 0xA4, 0x71, 0xFF, 0xC9, 0xB3, 0xFF, 0x02, 0x69, 0xFF, 0x65, 0x61, 0xFF, 0xE7, 0x71, 0xFF, 0x55, 0xB4, 0xFF, 0xCC, 0x82, 0xFF, 0x45, 0x61, 0xFF, 0x6B, 0x7A, 0xFF, 0x91, 0x8B, 0xFF, 0x44, 0x51, 0xFF, 0x85, 0x69, 0xFF, 0x46, 0x8A, 0xFF, 0xC2, 0x50, 0xFF, 0x84, 0x79, 0xFF, 0x44, 0x81, 0xFF, 0xC6, 0x99, 0xFF, 0x40, 0x58, 0xFF, 0xA1, 0x48, 0xFF, 0x23, 0x69, 0xFF, 0x23, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x25, 0x59, 0xFF, 0x61, 0x30, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xC3, 0x48, 0xFF, 0xA3, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0x44, 0x49, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x30, 0xFF, 0xE2, 0x38, 0xFF, 0xA1, 0x30, 0xFF, 0x84, 0x62, 0xFF, 0x23, 0x41, 0xFF, 0xC2, 0x30, 0xFF, 0xE2, 0x38, 0xFF, 0xE3, 0x40, 0xFF, 0x44, 0x49, 0xFF, 0x24, 0xF1, 0xFF, 0x61, 0x28, 0xFF, 0xA2, 0x38, 0xFF, 0x40, 0x28, 0xFF, 0xA2, 0x38, 0xFF, 0xA4, 0xE0, 0xFF, 0x81, 0x38, 0xFF, 0x40, 0x38, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0xE8, 0xFA, 0xFF, 0xE2, 0x68, 0xFF, 0x61, 0x40, 0xFF, 0x20, 0x48, 0xFF, 0x02, 0x69, 0xFF, 0xA5, 0xF9, 0xFF,
-    0xA3, 0x89, 0xFF, 0x63, 0x79, 0xFF, 0x84, 0x89, 0xFF, 0xC4, 0x81, 0xFF, 0xFD, 0xFF, 0xFF, 0x61, 0x48, 0xFF, 0x40, 0x40, 0xFF, 0x03, 0x71, 0xFF, 0xE3, 0x68, 0xFF, 0xAE, 0xFD, 0xFF, 0xC3, 0x68, 0xFF, 0xC2, 0x60, 0xFF, 0xC3, 0x80, 0xFF, 0xC2, 0x68, 0xFF, 0xFD, 0xFF, 0xFF, 0x03, 0x71, 0xFF, 0xC2, 0x60, 0xFF, 0x03, 0x71, 0xFF, 0x24, 0x59, 0xFF, 0x06, 0xF9, 0xFF, 0x05, 0xBA, 0xFF, 0x84, 0x71, 0xFF, 0xA5, 0x71, 0xFF, 0x87, 0x9A, 0xFF, 0x86, 0xE9, 0xFF, 0x44, 0x59, 0xFF, 0x29, 0x7A, 0xFF, 0x13, 0xAC, 0xFF, 0x2C, 0x9B, 0xFF, 0xC6, 0x79, 0xFF, 0x6B, 0x7A, 0xFF, 0x51, 0x8B, 0xFF, 0xC2, 0x40, 0xFF, 0x84, 0x69, 0xFF, 0xE7, 0x71, 0xFF, 0x20, 0x40, 0xFF, 0x23, 0x61, 0xFF, 0x43, 0x79, 0xFF, 0x85, 0x81, 0xFF, 0x85, 0x69, 0xFF, 0xA2, 0x50, 0xFF, 0x23, 0x69, 0xFF, 0x03, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x65, 0x91, 0xFF, 0xC3, 0x38, 0xFF, 0xA1, 0x30, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0x26, 0xA2, 0xFF, 0xA3, 0x38, 0xFF, 0xC3, 0x40, 0xFF, 0xA2, 0x48, 0xFF, 0xC2, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x30, 0xFF, 0xA2, 0x30, 0xFF, 0xA2, 0x30, 0xFF, 0xA1, 0x30, 0xFF, 0x6D, 0xCD, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x30, 0xFF, 0xC2, 0x38, 0xFF, 0x03, 0x41, 0xFF,
+    0xA2, 0x30, 0xC2, 0x40, 0x66, 0xDA, 0xE3, 0x58, 0xE3, 0x40, 0xE2, 0x38, 0xA3, 0x59, 0x48, 0xC3, 0x02, 0x49, 0x63, 0x89, 0x23, 0x41, 0xB2, 0xFF, 0x23, 0x49, 0xE7, 0xEA, 0x23, 0x51, 0x03, 0x41, 0xE6, 0x90, 0xE3, 0x38, 0x04, 0x51, 0xBF, 0xC7, 0x04, 0x41, 0x04, 0x41, 0x24, 0x49, 0x04, 0x49, 0xE5, 0x90, 0x25, 0x41, 0x04, 0x41, 0x24, 0x49, 0x03, 0x39, 0x04, 0x41, 0x04, 0x41, 0x25, 0x51,
+    0x25, 0x49, 0x45, 0x49, 0x44, 0x49, 0x45, 0x61, 0x45, 0x49, 0x45, 0x49, 0x45, 0x49, 0x86, 0x51, 0x45, 0x51, 0x65, 0x51, 0xA6, 0x51, 0xA6, 0x59, 0x27, 0x82, 0x85, 0x69, 0x86, 0x51, 0x86, 0x51, 0x86, 0x59, 0x65, 0x51, 0x86, 0x51, 0x65, 0x59, 0x86, 0x59, 0xCA, 0xF2, 0x86, 0x51, 0x86, 0x51, 0xCB, 0xFB, 0x66, 0x49, 0x66, 0x49, 0x66, 0x41, 0x86, 0x49, 0x66, 0x49, 0x25, 0x49, 0x66, 0x41,
+    0x46, 0x69, 0x45, 0x49, 0x25, 0x81, 0x66, 0x41, 0x66, 0x51, 0x66, 0x51, 0x66, 0x49, 0x86, 0x49, 0x86, 0x41, 0x66, 0x49, 0x86, 0x51, 0x86, 0x49, 0xC7, 0x59, 0x86, 0x41, 0x66, 0x49, 0x65, 0x41, 0xC2, 0x40, 0xC1, 0x40, 0x43, 0xB1, 0x44, 0x69, 0xE2, 0x38, 0xA1, 0x60, 0x62, 0x49, 0x22, 0x61, 0x87, 0xC2, 0x64, 0x59, 0xE4, 0x71, 0x03, 0x51, 0xA1, 0x48, 0xD2, 0xFF, 0x83, 0x61, 0x2D, 0xD5,
+    0x03, 0x41, 0x03, 0x49, 0xA5, 0x81, 0xC6, 0x89, 0xA5, 0xB1, 0x04, 0x51, 0x04, 0x49, 0x24, 0x49, 0x86, 0xB9, 0x44, 0x51, 0x04, 0x49, 0x05, 0xA9, 0xC2, 0x40, 0x65, 0x79, 0x45, 0x69, 0x25, 0x69, 0x66, 0x79, 0xC4, 0xA9, 0x24, 0x49, 0x2B, 0xFB, 0x90, 0xE6, 0x65, 0x49, 0x65, 0x49, 0xF0, 0xE5, 0x68, 0xFA, 0x86, 0x59, 0xD1, 0xFD, 0xA7, 0xA1, 0x48, 0xA2, 0xAB, 0xFB, 0x86, 0x59, 0xA6, 0x61,
+    0x86, 0xB1, 0x86, 0x61, 0x08, 0x8A, 0xA6, 0x71, 0x28, 0xFB, 0x86, 0x59, 0x86, 0x51, 0x66, 0x51, 0xCC, 0xFB, 0x86, 0x49, 0x86, 0x49, 0x86, 0x49, 0x66, 0x59, 0xAB, 0xEA, 0x66, 0x49, 0x66, 0x49, 0x66, 0x49, 0x25, 0x51, 0xC7, 0x59, 0xEC, 0xB2, 0x86, 0x51, 0x66, 0x49, 0x86, 0x49, 0x66, 0x49, 0x8C, 0xD2, 0x86, 0x49, 0x66, 0x51, 0x86, 0x51, 0xC7, 0x59, 0x8B, 0xB2, 0xC7, 0x61, 0x65, 0x41,
+    0xE2, 0x40, 0xC2, 0x38, 0xC2, 0x40, 0x04, 0x7A, 0x23, 0x61, 0xE2, 0x40, 0xE3, 0x50, 0x23, 0x49, 0x84, 0x61, 0xA4, 0x61, 0xE6, 0xF2, 0xC2, 0x40, 0x24, 0x59, 0x0C, 0x8B, 0x23, 0x61, 0x67, 0xBA, 0x34, 0x93, 0x04, 0xA9, 0x03, 0x49, 0xA5, 0x89, 0x24, 0x51, 0x04, 0x51, 0x04, 0x41, 0x24, 0x49, 0x44, 0x51, 0x03, 0x49, 0x04, 0x41, 0xC3, 0x68, 0x24, 0x49, 0x24, 0x49, 0x26, 0xBA, 0x45, 0x51,
+    0x24, 0x49, 0x69, 0xCB, 0x45, 0x49, 0x65, 0x69, 0x27, 0x8A, 0x65, 0x49, 0x85, 0x51, 0xD0, 0xEE, 0x85, 0x69, 0x85, 0x59, 0x69, 0x9A, 0x86, 0x59, 0xC6, 0x69, 0x06, 0x9A, 0xA7, 0x69, 0x86, 0x59, 0xC6, 0x69, 0x86, 0x61, 0xE7, 0x79, 0xA6, 0x59, 0xC7, 0x61, 0x86, 0x51, 0xA6, 0x59, 0xA6, 0x61, 0xA7, 0x61, 0xE7, 0x79, 0x86, 0x49, 0x87, 0x59, 0x86, 0x51, 0x28, 0x72, 0x67, 0x51, 0x66, 0x41,
+    0x66, 0x49, 0x05, 0x71, 0xA6, 0x59, 0x86, 0x51, 0x86, 0x49, 0x86, 0x49, 0x87, 0x51, 0x66, 0x49, 0x67, 0x61, 0x86, 0x49, 0x86, 0x51, 0xA7, 0x69, 0x66, 0x49, 0x66, 0x49, 0xE8, 0x69, 0x86, 0x49, 0xE2, 0x48, 0x23, 0x51, 0xE2, 0x40, 0x03, 0x49, 0xFC, 0xFF, 0x43, 0x51, 0x23, 0x51, 0xE2, 0xA8, 0x23, 0x49, 0xFD, 0xFF, 0x22, 0x51, 0x63, 0x99, 0x64, 0x61, 0x6D, 0xFD, 0xED, 0xF4, 0x63, 0x51,
+    0xE4, 0x90, 0xE3, 0x40, 0x64, 0x69, 0x64, 0x69, 0xE5, 0xA1, 0x04, 0x49, 0x23, 0x49, 0xC3, 0x60, 0x04, 0x51, 0xEB, 0xFC, 0x04, 0x49, 0x24, 0x51, 0x24, 0x49, 0x24, 0x51, 0xF3, 0xFF, 0x24, 0x51, 0x46, 0x69, 0x65, 0x51, 0x45, 0x51, 0xEE, 0xFD, 0x6C, 0x9B, 0x65, 0x51, 0x65, 0x51, 0x07, 0x8A, 0xFC, 0xFF, 0xE7, 0x69, 0xA6, 0x59, 0xA6, 0x61, 0xA6, 0x69, 0xF8, 0xFF, 0xA6, 0x61, 0xA5, 0x59,
+    0xA6, 0x59, 0xC7, 0x71, 0xFF, 0xFF, 0xC6, 0x69, 0xA6, 0x59, 0x46, 0x69, 0xC7, 0x61, 0x53, 0xFF, 0xC7, 0x69, 0xA6, 0x59, 0x86, 0x49, 0x6A, 0x8A, 0xFD, 0xFF, 0x87, 0x51, 0x67, 0x51, 0x86, 0x51, 0x46, 0x49, 0xA9, 0xEA, 0x66, 0x51, 0x66, 0x49, 0x66, 0x51, 0x86, 0x49, 0xF3, 0xFF, 0x87, 0x51, 0x86, 0x49, 0x86, 0x51, 0x66, 0x49, 0x69, 0xF2, 0x66, 0x51, 0xE8, 0x61, 0x66, 0x49, 0x86, 0x49,
+    0x23, 0x61, 0x03, 0x49, 0xE2, 0x38, 0xE2, 0x40, 0x23, 0x51, 0x23, 0x49, 0xE5, 0x59, 0x02, 0x49, 0x23, 0x51, 0x64, 0xB9, 0x22, 0x59, 0x43, 0x51, 0x03, 0x51, 0xE2, 0x50, 0x2B, 0xFC, 0x24, 0x51, 0x03, 0x51, 0x24, 0x69, 0xE4, 0xB8, 0x03, 0x51, 0x44, 0x61, 0x23, 0x61, 0x24, 0x49, 0x04, 0x49, 0x04, 0x51, 0xC6, 0x79, 0x24, 0x51, 0x24, 0x51, 0x24, 0x49, 0x24, 0x49, 0x8A, 0x82, 0x45, 0x51,
+    0x45, 0x51, 0x45, 0x59, 0x45, 0x59, 0x08, 0x8A, 0x4C, 0xDC, 0x65, 0x51, 0x85, 0x59, 0xEB, 0xDB, 0x85, 0x71, 0x86, 0x61, 0xC5, 0x61, 0xA6, 0x61, 0xE7, 0x71, 0x48, 0xA2, 0xE7, 0x71, 0xA6, 0x59, 0xC6, 0x61, 0x28, 0x82, 0x28, 0x9A, 0xE7, 0x69, 0xE8, 0x61, 0x07, 0x6A, 0x07, 0x72, 0x0F, 0xD4, 0xE7, 0x69, 0xC7, 0x59, 0x86, 0x51, 0x87, 0x59, 0x66, 0x51, 0x86, 0x51, 0x66, 0x61, 0x66, 0x49,
+    0x67, 0x51, 0x66, 0x51, 0x87, 0xB1, 0x66, 0x49, 0x87, 0x49, 0x66, 0x49, 0x87, 0x49, 0x66, 0x49, 0x86, 0x49, 0x86, 0x51, 0x66, 0x51, 0xA7, 0x69, 0x69, 0x82, 0x86, 0x49, 0x66, 0x49, 0xA7, 0x51, 0xE2, 0x40, 0xFF, 0xFF, 0xE1, 0x40, 0xE3, 0x40, 0x81, 0x38, 0x43, 0x49, 0xFF, 0xFF, 0x43, 0x51, 0x23, 0x51, 0xE3, 0x40, 0x85, 0xD9, 0xFF, 0xFF, 0x8B, 0xF3, 0x03, 0x51, 0x03, 0x51, 0x23, 0x59,
+    0x37, 0xF7, 0x23, 0x51, 0x03, 0x49, 0x27, 0x7A, 0x6C, 0xFD, 0x24, 0x49, 0x25, 0x51, 0x24, 0x49, 0x04, 0x81, 0xF8, 0xFF, 0x04, 0x49, 0x24, 0x49, 0x45, 0x59, 0x24, 0x49, 0xF7, 0xFF, 0x24, 0x51, 0x45, 0x49, 0x0A, 0xB3, 0x65, 0x61, 0xFD, 0xFF, 0x49, 0xC3, 0x65, 0x51, 0x44, 0x59, 0xF4, 0xFF, 0xFD, 0xFF, 0xE7, 0x71, 0x6C, 0xD4, 0x07, 0x7A, 0x67, 0xA2, 0xDE, 0xFF, 0x68, 0x8A, 0xE7, 0x69,
+    0xC6, 0x61, 0x68, 0xD2, 0xE8, 0xBA, 0x07, 0x6A, 0xC7, 0x59, 0x08, 0x7A, 0xFE, 0xFF, 0x68, 0x82, 0x08, 0x72, 0xA7, 0x59, 0xE7, 0x69, 0xFB, 0xFF, 0x87, 0x51, 0xC7, 0x69, 0x87, 0x49, 0x87, 0x51, 0xFF, 0xFF, 0x66, 0x51, 0x87, 0x51, 0x66, 0x49, 0x86, 0x59, 0xCE, 0xFC, 0x86, 0x51, 0x86, 0x49, 0x86, 0x51, 0x4F, 0xD5, 0xE7, 0x91, 0xC7, 0x79, 0x86, 0x49, 0x86, 0x49, 0x86, 0x49, 0x50, 0xFF,
+    0x02, 0x41, 0x23, 0x49, 0x85, 0xF9, 0x63, 0x51, 0x02, 0x41, 0xE2, 0x40, 0x23, 0x49, 0x23, 0x51, 0xA7, 0xF9, 0x03, 0x71, 0xC5, 0x61, 0xC5, 0x61, 0x63, 0x51, 0x07, 0xF3, 0xE3, 0x68, 0x43, 0x51, 0x02, 0x61, 0xE3, 0x68, 0x23, 0x49, 0x23, 0x59, 0x03, 0x49, 0x44, 0x61, 0x04, 0x49, 0x24, 0x49, 0xA8, 0xFA, 0x04, 0x51, 0x24, 0x51, 0x24, 0x49, 0x24, 0x49, 0xE7, 0xA9, 0x45, 0x79, 0x25, 0x51,
+    0x45, 0x49, 0xA4, 0x59, 0x65, 0x59, 0xC8, 0xE9, 0xC6, 0x71, 0x86, 0x59, 0xA6, 0x59, 0x8A, 0xBB, 0x07, 0x92, 0x07, 0x7A, 0xA6, 0x72, 0xE6, 0x69, 0x27, 0x8A, 0xCA, 0xE2, 0xE6, 0x71, 0xC7, 0x61, 0x48, 0x92, 0xA9, 0xA2, 0x07, 0x7A, 0x08, 0x7A, 0xE8, 0x61, 0x07, 0x62, 0x4F, 0xC4, 0x48, 0x82, 0x90, 0xFB, 0xE7, 0x61, 0xC7, 0x59, 0x0B, 0x8B, 0x87, 0x51, 0xA9, 0x91, 0x67, 0x49, 0x87, 0x51,
+    0x87, 0x49, 0x87, 0x51, 0xA8, 0x69, 0xE9, 0xA1, 0x86, 0x59, 0x66, 0x51, 0x66, 0x49, 0x87, 0x51, 0x2D, 0xBB, 0x2B, 0xA3, 0x0B, 0x8B, 0x86, 0x49, 0x87, 0x49, 0x47, 0x79, 0x86, 0x49, 0x28, 0x62, 0xE2, 0x40, 0x06, 0x6A, 0x02, 0x41, 0xDA, 0xFF, 0x02, 0x51, 0x22, 0x49, 0xA4, 0x59, 0xE2, 0x50, 0xCF, 0xA4, 0x23, 0x59, 0x83, 0x69, 0xC2, 0xD0, 0xFC, 0xF7, 0xC4, 0x79, 0x0B, 0xF4, 0xC2, 0x48,
+    0x23, 0x51, 0xFB, 0xFF, 0x07, 0x8A, 0xCA, 0xB2, 0x23, 0x59, 0xFB, 0xFF, 0x03, 0x49, 0x44, 0x51, 0xC5, 0x91, 0x44, 0x59, 0xAC, 0xFC, 0x25, 0x71, 0x04, 0x49, 0xE3, 0x58, 0x48, 0xEC, 0x04, 0x59, 0x65, 0x51, 0xC5, 0x69, 0x65, 0x59, 0xCB, 0xEB, 0x25, 0x71, 0xA7, 0x59, 0xA6, 0x59, 0x30, 0xE4, 0xCA, 0xE2, 0x89, 0x8A, 0x07, 0x72, 0xE6, 0x69, 0xFD, 0xFF, 0x0E, 0xDC, 0x07, 0x7A, 0x07, 0x72,
+    0x68, 0x92, 0xDC, 0xFF, 0xF2, 0xFC, 0x6A, 0x82, 0x08, 0x6A, 0x14, 0xEE, 0x28, 0x72, 0x6D, 0xA3, 0x13, 0xC4, 0x49, 0x72, 0xFF, 0xFF, 0xC7, 0x59, 0x66, 0x59, 0x93, 0xC4, 0xA7, 0x61, 0x8D, 0xC4, 0xA8, 0x79, 0x87, 0x51, 0xB0, 0xC3, 0xFE, 0xFF, 0xA7, 0x71, 0x87, 0x49, 0x87, 0x59, 0xA8, 0x69, 0xB3, 0xFD, 0x86, 0x51, 0xA7, 0x51, 0x86, 0x51, 0xA7, 0x59, 0xEC, 0xAA, 0x87, 0x49, 0x28, 0x5A,
+    0xE3, 0x48, 0x02, 0x49, 0xE2, 0x38, 0x23, 0x51, 0x8D, 0xFD, 0x63, 0x59, 0x44, 0x51, 0xE2, 0x48, 0x23, 0x79, 0xD0, 0xF5, 0x63, 0x69, 0x23, 0x59, 0x2D, 0xFE, 0x64, 0x59, 0x03, 0x61, 0x02, 0x61, 0x03, 0x51, 0x23, 0x51, 0x43, 0x51, 0xC2, 0x60, 0x83, 0xB1, 0x24, 0x51, 0xE3, 0x58, 0x44, 0x51, 0x24, 0x49, 0x07, 0x9A, 0x04, 0x51, 0x25, 0x51, 0x04, 0x49, 0x65, 0x59, 0x0B, 0xFC, 0x44, 0x59,
+    0x86, 0x51, 0x45, 0x59, 0x65, 0x59, 0x4C, 0xFB, 0x86, 0x71, 0xA6, 0x59, 0xA6, 0x59, 0x52, 0xFE, 0xD7, 0xFF, 0xE6, 0x71, 0x4A, 0x9A, 0x07, 0x7A, 0xC8, 0xC2, 0x71, 0xFE, 0x48, 0x82, 0x08, 0x6A, 0x47, 0x82, 0x88, 0x8A, 0xFE, 0xFF, 0x28, 0x72, 0xEA, 0x8A, 0x0E, 0xBC, 0x48, 0x72, 0x96, 0xFE, 0x09, 0x6A, 0xE7, 0x61, 0xE8, 0x61, 0xC7, 0x59, 0xFE, 0xFF, 0x08, 0x6A, 0xE8, 0x61, 0xA7, 0x51,
+    0xA7, 0x51, 0x90, 0xFC, 0xE8, 0x61, 0xC7, 0x59, 0x87, 0x49, 0x87, 0x51, 0x6E, 0xFC, 0xA7, 0x69, 0x86, 0x51, 0x87, 0x51, 0xA7, 0x51, 0xAB, 0xFA, 0xA7, 0x51, 0xC7, 0x51, 0xC7, 0x59, 0xC8, 0x59, 0x67, 0x7A, 0x23, 0x51, 0xE2, 0x38, 0x23, 0x49, 0x03, 0x49, 0x08, 0x8B, 0xA5, 0x69, 0xA4, 0x61, 0x44, 0x51, 0x3D, 0xEF, 0x43, 0x69, 0x03, 0x49, 0x22, 0x51, 0xA3, 0xA1, 0x64, 0x69, 0xC8, 0xB2,
+    0x03, 0x59, 0xE2, 0x48, 0xA9, 0xCB, 0x69, 0x82, 0x47, 0x9A, 0x23, 0x51, 0xDA, 0xFF, 0x44, 0x59, 0x24, 0x59, 0x28, 0x9A, 0x04, 0x51, 0x45, 0x69, 0x24, 0x49, 0x85, 0x61, 0xCA, 0xB2, 0x07, 0x92, 0x65, 0x51, 0x85, 0xB9, 0xE3, 0x50, 0x0C, 0xD3, 0xA6, 0x71, 0xA6, 0x59, 0xC7, 0x61, 0xAC, 0xC3, 0xCC, 0xDB, 0xC6, 0x79, 0x95, 0xFF, 0xAA, 0xA2, 0xB2, 0xFD, 0x70, 0xF5, 0x68, 0x8A, 0x07, 0x72,
+    0xAB, 0xEB, 0xA9, 0x92, 0x93, 0xF5, 0x49, 0x7A, 0xEB, 0xAA, 0x48, 0x7A, 0x8E, 0xA3, 0x33, 0xE5, 0xCC, 0xA2, 0xFF, 0xFF, 0xE7, 0x59, 0x8F, 0xA3, 0x95, 0xD4, 0xA9, 0xA2, 0xC8, 0x61, 0xA8, 0x51, 0x46, 0x49, 0xCE, 0xCB, 0xAC, 0xBB, 0xA7, 0x51, 0x87, 0x51, 0x66, 0x51, 0x2D, 0xFC, 0xE8, 0x61, 0x86, 0x51, 0x87, 0x51, 0x86, 0x59, 0x6C, 0xDB, 0x87, 0x51, 0xA7, 0x59, 0xA7, 0x51, 0x08, 0x6A,
+    0x44, 0x69, 0x6D, 0xFC, 0xCA, 0xB3, 0x43, 0x61, 0x63, 0x51, 0x23, 0x49, 0x51, 0xF7, 0xC4, 0x69, 0x23, 0x51, 0x03, 0x49, 0x6D, 0xCC, 0xFA, 0xFF, 0x23, 0x49, 0x43, 0x61, 0x84, 0x61, 0x84, 0x61, 0xFF, 0xFF, 0x04, 0x51, 0x03, 0x49, 0x23, 0x59, 0x23, 0x61, 0xA2, 0x60, 0x44, 0x59, 0x63, 0x99, 0x66, 0xD9, 0xAB, 0xFC, 0x44, 0x59, 0xA3, 0xB8, 0x25, 0x49, 0x45, 0x51, 0x91, 0xFE, 0x6B, 0xFB,
+    0x24, 0x49, 0xFE, 0xFF, 0x65, 0x59, 0xFE, 0xFF, 0xA6, 0x69, 0xA7, 0x51, 0xA7, 0x59, 0x95, 0xE5, 0xFB, 0xFF, 0x27, 0x82, 0xFA, 0xFF, 0x27, 0x7A, 0x4E, 0xFD, 0xFD, 0xFF, 0x28, 0x7A, 0x28, 0x72, 0xFC, 0xFF, 0xB0, 0xFD, 0xE9, 0x9A, 0xCB, 0x8A, 0x6B, 0xEB, 0x49, 0x72, 0xFF, 0xFF, 0xEB, 0x92, 0xAB, 0xCB, 0x08, 0x62, 0x49, 0x6A, 0xFF, 0xFF, 0x08, 0x6A, 0x09, 0x6A, 0xC8, 0x51, 0x08, 0x5A,
+    0xDF, 0xFF, 0xC8, 0x59, 0xC8, 0x59, 0xA8, 0x51, 0xE8, 0x91, 0xA9, 0xB2, 0xC8, 0x61, 0xC8, 0x59, 0xA7, 0x51, 0xFE, 0xFF, 0x86, 0x59, 0xA7, 0x51, 0xC7, 0x51, 0xC7, 0x59, 0xE8, 0x71, 0x50, 0xFF, 0xC2, 0x38, 0xC6, 0x61, 0x23, 0x49, 0xC4, 0x61, 0x03, 0x49, 0xE2, 0x40, 0x23, 0x51, 0x43, 0x59, 0x22, 0x41, 0x43, 0x51, 0x03, 0x49, 0x03, 0x49, 0x43, 0x49, 0x03, 0x49, 0x03, 0x51, 0xA5, 0x69,
+    0x02, 0x49, 0x23, 0x61, 0x03, 0x49, 0x84, 0x71, 0x24, 0x71, 0xC6, 0x71, 0x24, 0x59, 0x64, 0x69, 0x03, 0x51, 0x04, 0x49, 0x03, 0x49, 0x65, 0x61, 0x24, 0x49, 0x86, 0x61, 0x65, 0x61, 0x45, 0x59, 0x66, 0x51, 0x7F, 0xF7, 0x86, 0x59, 0x45, 0x71, 0x33, 0xAB, 0xA7, 0x51, 0xA6, 0x59, 0xB1, 0xFD, 0xEB, 0x92, 0xA9, 0x92, 0xDF, 0xFF, 0xE7, 0x71, 0x68, 0x8A, 0x89, 0x92, 0x48, 0x7A, 0xE7, 0x61,
+    0x89, 0x82, 0x6A, 0xA3, 0x49, 0x82, 0xCB, 0x8A, 0xEB, 0x82, 0x69, 0x6A, 0x8A, 0x7A, 0xCA, 0x82, 0xCB, 0x8A, 0x29, 0x62, 0x2A, 0x7B, 0x6A, 0x6A, 0x49, 0x72, 0x2A, 0x6A, 0xE8, 0x59, 0xE8, 0x59, 0xE8, 0x61, 0xC8, 0x51, 0xE8, 0x69, 0xE8, 0x69, 0x48, 0x7A, 0x87, 0x51, 0xA8, 0x59, 0xC8, 0x59, 0x87, 0x59, 0xA7, 0x61, 0xA7, 0x59, 0xA7, 0x51, 0xA7, 0x51, 0xA8, 0x59, 0x29, 0x6A, 0xE8, 0x59,
+    0xC2, 0x38, 0xC2, 0x38, 0xE2, 0x40, 0xC8, 0xAA, 0x42, 0x59, 0xC1, 0x48, 0xC2, 0x40, 0xE2, 0x48, 0xAC, 0xFD, 0x83, 0x79, 0x85, 0x61, 0x43, 0x51, 0x26, 0x72, 0xE6, 0xC9, 0xE5, 0x79, 0x24, 0x71, 0xC6, 0x71, 0xFD, 0xFF, 0x03, 0x59, 0xA7, 0xF9, 0x24, 0x69, 0xC9, 0xE3, 0x44, 0x61, 0x24, 0x59, 0x66, 0xF9, 0x86, 0x61, 0x46, 0xBA, 0x44, 0x69, 0xE3, 0x48, 0x86, 0xB1, 0xE7, 0xB1, 0x08, 0x7A,
+    0x45, 0x51, 0xE6, 0xB9, 0x86, 0x69, 0x8F, 0xFC, 0x85, 0x79, 0xA7, 0x51, 0xA7, 0x59, 0xAE, 0xFD, 0xCD, 0xFB, 0x48, 0x82, 0xF6, 0xFF, 0x07, 0x72, 0xFF, 0xFF, 0x10, 0xFD, 0xA9, 0x8A, 0xE8, 0x69, 0xCA, 0xD2, 0xFD, 0xFF, 0x91, 0xEC, 0x6E, 0xB3, 0xEB, 0x82, 0xFF, 0xFF, 0xCA, 0x72, 0x91, 0xD4, 0x54, 0xFD, 0xCA, 0x72, 0xFF, 0xFF, 0x8B, 0x8A, 0x2A, 0x62, 0x55, 0xFD, 0x11, 0xDD, 0x4C, 0xDB,
+    0xC8, 0x51, 0xC9, 0x59, 0xB5, 0xF5, 0xFC, 0xFF, 0x88, 0x51, 0x87, 0x51, 0xC8, 0x59, 0x11, 0xDC, 0x50, 0xEB, 0xA7, 0x51, 0xA7, 0x51, 0xA8, 0x51, 0x68, 0xB9, 0xED, 0xFA, 0xC9, 0x59, 0xE8, 0x59, 0xE7, 0x9A, 0xC4, 0xB9, 0xE2, 0x40, 0xC2, 0x48, 0xE1, 0x50, 0xAF, 0xED, 0xC2, 0x40, 0xE3, 0x48, 0xE2, 0x48, 0xFE, 0xFF, 0xC2, 0x68, 0x23, 0x51, 0x03, 0x49, 0x09, 0xD3, 0xE2, 0x48, 0x44, 0x61,
+    0x03, 0x69, 0x43, 0x59, 0xF9, 0xFF, 0xE3, 0x50, 0x25, 0xC1, 0x24, 0x59, 0x62, 0xB1, 0x44, 0x51, 0xA3, 0xB0, 0x04, 0x49, 0x24, 0x51, 0x04, 0xA9, 0xA7, 0x81, 0x85, 0x59, 0x6E, 0xFD, 0xE9, 0xFA, 0x45, 0x49, 0xFC, 0xFF, 0x65, 0x51, 0xFF, 0xFF, 0xA6, 0x82, 0x86, 0x49, 0x86, 0x51, 0xFD, 0xFF, 0xCB, 0xD3, 0x27, 0x7A, 0xFD, 0xFF, 0xC9, 0x8A, 0xFF, 0xFF, 0x6A, 0xDB, 0x6A, 0x7A, 0xAB, 0x82,
+    0xD2, 0xED, 0xAC, 0xAB, 0x13, 0xF6, 0xEC, 0x8A, 0xAE, 0xAC, 0x14, 0xEE, 0x4A, 0x6A, 0xD0, 0xC3, 0x2A, 0x6A, 0xFF, 0xFF, 0x6A, 0x6A, 0x2B, 0x62, 0x8F, 0xE4, 0xD6, 0xF6, 0x2A, 0xCA, 0xE8, 0x59, 0xC9, 0x51, 0x8C, 0xB2, 0x8C, 0xD2, 0xC8, 0x51, 0xA8, 0x51, 0xA8, 0x51, 0x34, 0xFF, 0x47, 0x59, 0xA8, 0x59, 0xA8, 0x51, 0x2A, 0xB2, 0xAF, 0xFC, 0xA8, 0x59, 0xC8, 0x51, 0xE9, 0x71, 0xCA, 0xC2,
+    0x85, 0x79, 0xC2, 0x48, 0xE4, 0xF8, 0xA2, 0x40, 0xE3, 0x50, 0x05, 0xA2, 0x85, 0xF9, 0x03, 0x49, 0xE2, 0x48, 0x64, 0x59, 0x46, 0xC2, 0x03, 0x51, 0x23, 0x51, 0x03, 0x49, 0xE6, 0x89, 0x44, 0x81, 0x85, 0x61, 0x04, 0x99, 0xA4, 0x61, 0x64, 0x59, 0xA7, 0xC9, 0x66, 0xC9, 0x04, 0x49, 0x44, 0x51, 0xC6, 0x61, 0x6B, 0xFB, 0x23, 0x49, 0x45, 0x59, 0x04, 0x49, 0x64, 0x51, 0x0A, 0xF3, 0x64, 0x61,
+    0x45, 0x51, 0x29, 0x4A, 0x65, 0x59, 0xFD, 0xFF, 0xC7, 0x69, 0xA7, 0x51, 0xC7, 0x51, 0x54, 0xBD, 0xAF, 0xF4, 0x28, 0x7A, 0x26, 0x5A, 0x69, 0x82, 0x2E, 0xCC, 0xB9, 0xFF, 0xCB, 0x8A, 0x8A, 0x82, 0xCE, 0xEC, 0x2B, 0x9B, 0x3B, 0xFF, 0x2D, 0x8B, 0x6D, 0xB3, 0xAC, 0x6A, 0xF1, 0x9B, 0xBF, 0xFF, 0xAC, 0x82, 0x6C, 0x7A, 0x6C, 0x6A, 0x2F, 0x83, 0x96, 0xE5, 0x8B, 0x82, 0x2A, 0x62, 0x2A, 0x62,
+    0xCD, 0x7A, 0xB2, 0xC4, 0xC9, 0x59, 0xC9, 0x59, 0xA8, 0x51, 0x0A, 0x92, 0x0C, 0xDB, 0xC8, 0x59, 0xC8, 0x59, 0xA8, 0x81, 0x6B, 0x82, 0x6A, 0x8A, 0xC8, 0x51, 0x09, 0x62, 0xE9, 0x61, 0x29, 0x62, 0x04, 0xA9, 0x02, 0x61, 0xC5, 0x89, 0xA2, 0x38, 0xC2, 0x50, 0x23, 0x49, 0x04, 0x92, 0x45, 0xB2, 0x44, 0x51, 0x03, 0x49, 0x23, 0x59, 0xF0, 0xFE, 0x03, 0x49, 0x23, 0x51, 0xA5, 0x69, 0x44, 0x61,
+    0x6B, 0xFC, 0x44, 0x51, 0xE3, 0x78, 0x47, 0x82, 0x44, 0x51, 0xE7, 0x89, 0x44, 0x51, 0x85, 0x71, 0x23, 0x51, 0x28, 0x92, 0x44, 0x49, 0x85, 0x81, 0x04, 0x49, 0x24, 0x51, 0x28, 0xFA, 0x89, 0x92, 0x66, 0x59, 0x45, 0x49, 0x65, 0x51, 0xF6, 0xFF, 0xC6, 0x69, 0xE8, 0x61, 0xA7, 0x51, 0xE7, 0x69, 0xFF, 0xFF, 0x48, 0x7A, 0xE7, 0x59, 0xCA, 0x8A, 0x2C, 0xB4, 0xFD, 0xFF, 0xAD, 0xA3, 0x49, 0x72,
+    0x8A, 0x82, 0xFF, 0xFF, 0x4F, 0xA4, 0xAB, 0x82, 0xF1, 0xB3, 0xEF, 0x6A, 0xFF, 0xFF, 0x90, 0x93, 0x8F, 0xBB, 0xEF, 0x7A, 0x30, 0x7B, 0xFF, 0xFF, 0xCD, 0xA2, 0x8C, 0x7A, 0x4B, 0x6A, 0x4E, 0xA4, 0xFF, 0xFF, 0x2E, 0x83, 0xE9, 0x59, 0xA9, 0x59, 0xB4, 0xFD, 0x6A, 0x8A, 0xC8, 0x59, 0xC8, 0x59, 0xE9, 0x61, 0xFF, 0xFF, 0xC9, 0x61, 0xC9, 0x59, 0xC9, 0x51, 0x09, 0x62, 0xC8, 0x61, 0x10, 0xFE,
+    0xE3, 0x40, 0xC3, 0x38, 0xE2, 0x40, 0x43, 0x59, 0xE2, 0x48, 0x42, 0xE0, 0xC2, 0x40, 0x02, 0x49, 0x23, 0x9A, 0x03, 0x51, 0xE3, 0x48, 0x44, 0x59, 0x46, 0x9A, 0x03, 0x51, 0x44, 0x59, 0x23, 0x69, 0x67, 0x8A, 0x64, 0x61, 0x44, 0x59, 0x85, 0x71, 0x84, 0x61, 0x25, 0x51, 0x45, 0x69, 0x64, 0x59, 0x44, 0x61, 0xE4, 0x48, 0x04, 0x59, 0x25, 0x59, 0x24, 0x51, 0xA6, 0x61, 0x25, 0x59, 0x44, 0x59,
+    0x65, 0x51, 0x65, 0x51, 0x45, 0x51, 0x69, 0xAA, 0x28, 0x7A, 0x86, 0x49, 0xA7, 0x51, 0xCA, 0x92, 0x50, 0xCD, 0x2B, 0x93, 0xA7, 0x51, 0x08, 0x6A, 0xAE, 0xCC, 0xA9, 0x7A, 0xEC, 0x8A, 0x8A, 0x8A, 0xAD, 0x93, 0xFE, 0xFF, 0xAB, 0x72, 0x8F, 0xB3, 0x0F, 0x83, 0x9E, 0xC5, 0x14, 0x7B, 0xB4, 0xE4, 0xF0, 0xD2, 0x77, 0x83, 0xFF, 0xFF, 0xCF, 0xAA, 0x8D, 0x6A, 0xCD, 0x6A, 0x6E, 0x93, 0x0D, 0xDB,
+    0x0A, 0x5A, 0xEA, 0x59, 0x0A, 0x62, 0x4F, 0xF5, 0xC9, 0x61, 0x2A, 0x72, 0xE9, 0x59, 0xE9, 0x69, 0xC8, 0x81, 0xC9, 0x59, 0xE9, 0x61, 0x09, 0x62, 0x4B, 0xD2, 0xC8, 0x79, 0xE9, 0x59, 0x0A, 0x62, 0xC2, 0x40, 0x73, 0xFF, 0xC2, 0x40, 0x86, 0xD1, 0x27, 0x82, 0x46, 0xBA, 0x00, 0xA0, 0x02, 0x49, 0x06, 0xA2, 0xF6, 0xFF, 0x03, 0x59, 0x44, 0x59, 0xC2, 0x50, 0xAB, 0xC3, 0x85, 0x69, 0x23, 0x59,
+    0xE2, 0xA0, 0x84, 0x91, 0xA4, 0x59, 0x85, 0x69, 0xC2, 0x70, 0x24, 0x51, 0x04, 0x49, 0x44, 0x51, 0x86, 0xA9, 0xC6, 0x69, 0xC7, 0x71, 0x64, 0x51, 0x4A, 0xF3, 0x24, 0x59, 0x45, 0x49, 0x24, 0x51, 0x86, 0x61, 0x45, 0x51, 0x65, 0x51, 0x4D, 0xFC, 0xE7, 0x81, 0xA7, 0x51, 0x87, 0x51, 0x6A, 0xC2, 0xEB, 0xC2, 0x2B, 0x8B, 0xE7, 0x51, 0x0B, 0x8B, 0xF9, 0xFF, 0x6F, 0xF5, 0xCC, 0x8A, 0x8B, 0x8A,
+    0xB1, 0xB4, 0xD0, 0x9B, 0x6B, 0x7A, 0xEE, 0x82, 0xF8, 0xAC, 0xFF, 0xFF, 0xD3, 0x6A, 0x56, 0xAC, 0x93, 0xFC, 0x55, 0x83, 0x58, 0x93, 0x8E, 0x6A, 0x8E, 0x6A, 0x35, 0xF4, 0x55, 0xCE, 0xEE, 0x72, 0x0A, 0x52, 0x2B, 0x62, 0x8D, 0xE2, 0xCA, 0x71, 0xC9, 0x59, 0xC9, 0x69, 0x0A, 0x7A, 0x8F, 0xD3, 0x0E, 0x9B, 0xE9, 0x59, 0x0A, 0xA2, 0xCC, 0x7A, 0x2A, 0x6A, 0xCE, 0xFA, 0x0A, 0x7A, 0x09, 0x62,
+    0xC2, 0x48, 0x65, 0x79, 0x03, 0x61, 0x64, 0x71, 0x45, 0xD1, 0x68, 0xBB, 0x69, 0xE4, 0xC2, 0x80, 0xC2, 0x50, 0xC2, 0x50, 0xEF, 0xEC, 0x43, 0x59, 0xE3, 0x50, 0x43, 0x61, 0xE6, 0x89, 0x44, 0x59, 0x44, 0x59, 0xE8, 0xEB, 0x07, 0x7A, 0xE7, 0x99, 0x88, 0xFA, 0xE7, 0xF9, 0x03, 0x51, 0x44, 0x59, 0x85, 0x69, 0x89, 0x92, 0x24, 0x49, 0xE7, 0x79, 0x65, 0x51, 0x04, 0x49, 0x24, 0x51, 0xA9, 0x92,
+    0xA6, 0x71, 0x65, 0x51, 0x45, 0x51, 0x2F, 0xB3, 0x07, 0xCA, 0x87, 0x51, 0xA7, 0x51, 0x53, 0xFF, 0x6E, 0xDC, 0xCA, 0x8A, 0x4A, 0xBA, 0x4C, 0x9B, 0x10, 0xE5, 0x14, 0xF5, 0x6E, 0x93, 0x6A, 0x72, 0xFC, 0xFF, 0x8E, 0x93, 0x39, 0xFF, 0x70, 0x93, 0x57, 0xBD, 0xB4, 0x93, 0x10, 0x7B, 0x93, 0xBC, 0x11, 0x93, 0xFF, 0xFF, 0xB1, 0x7A, 0xAF, 0x6A, 0xD0, 0xAB, 0xDC, 0xED, 0x0F, 0x7B, 0x8D, 0x6A,
+    0x0B, 0x5A, 0x70, 0xDB, 0xDA, 0xD4, 0x13, 0xA4, 0xEA, 0x59, 0x8C, 0xA2, 0x05, 0x89, 0x34, 0xBC, 0x4E, 0x8B, 0x2A, 0x72, 0xE9, 0x59, 0xC8, 0x91, 0x2A, 0x72, 0x0A, 0x62, 0x2B, 0x8A, 0xAA, 0x7A, 0x47, 0xAA, 0x44, 0x59, 0x43, 0x61, 0xE3, 0x48, 0xC2, 0x58, 0xA4, 0xA1, 0x23, 0x59, 0x87, 0xAA, 0x64, 0x61, 0x23, 0x59, 0x06, 0xC2, 0x86, 0x8A, 0x03, 0x59, 0x23, 0x59, 0x23, 0x61, 0x06, 0xDA,
+    0x64, 0x61, 0x24, 0x61, 0x64, 0x79, 0xAE, 0xEC, 0xC6, 0x71, 0x65, 0x69, 0xA6, 0x69, 0x28, 0xCA, 0x04, 0x59, 0xC7, 0x79, 0x85, 0x59, 0x4B, 0xFB, 0x08, 0x6A, 0x85, 0x61, 0x29, 0xAA, 0xA7, 0x99, 0x85, 0x61, 0xED, 0xCB, 0x65, 0x51, 0xD1, 0xFE, 0x86, 0x69, 0x87, 0x51, 0xA7, 0x59, 0x15, 0xFF, 0xF8, 0xFF, 0x8A, 0x7A, 0x4E, 0xBC, 0x4C, 0x9B, 0xCC, 0xC3, 0xFF, 0xFF, 0x4D, 0x8B, 0x4D, 0x93,
+    0xCE, 0xEB, 0x70, 0x9B, 0xFF, 0xFF, 0xF2, 0xAB, 0xFF, 0xFF, 0x12, 0x7B, 0x59, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x72, 0x91, 0x62, 0xB9, 0x93, 0xFF, 0xFF, 0x6E, 0x6A, 0xCF, 0x72, 0xAE, 0x6A, 0x73, 0xCC, 0xFF, 0xFF, 0x0B, 0x5A, 0x0B, 0x5A, 0x8E, 0xE3, 0xEE, 0x8A, 0x96, 0xFF, 0xEA, 0x61, 0x2A, 0x62, 0xAD, 0xFA, 0x0D, 0x93, 0x0D, 0xC4, 0x0A, 0x62, 0xC9, 0x81, 0x2A, 0x62, 0x29, 0x62,
+    0x43, 0x51, 0x82, 0x40, 0x23, 0xC1, 0x02, 0x51, 0xA5, 0x69, 0x03, 0x59, 0x85, 0x79, 0x0A, 0xD3, 0xFB, 0xFF, 0xA4, 0x79, 0xA5, 0x61, 0x67, 0xDA, 0x87, 0x9A, 0x43, 0x71, 0xA5, 0x71, 0x85, 0x69, 0xE6, 0xC9, 0x23, 0x59, 0x85, 0x69, 0x64, 0x71, 0x47, 0x8A, 0x07, 0x82, 0x24, 0x51, 0x24, 0x59, 0x69, 0x82, 0x65, 0x59, 0x65, 0x61, 0x45, 0x51, 0x65, 0x61, 0x24, 0x49, 0x08, 0x7A, 0xA7, 0x61,
+    0x66, 0x59, 0x4B, 0x7B, 0x86, 0x51, 0x8B, 0xFA, 0xA8, 0x71, 0xA7, 0x51, 0xC7, 0x51, 0x37, 0xCE, 0xFF, 0xFF, 0xCB, 0x82, 0x69, 0x72, 0x48, 0x7A, 0xEF, 0xAC, 0x4E, 0xB4, 0x8F, 0x9B, 0xAD, 0xAA, 0x72, 0x93, 0xFF, 0xFF, 0xD4, 0x8B, 0x34, 0xCC, 0x72, 0x8B, 0x17, 0x73, 0xFF, 0xFF, 0xF8, 0xEC, 0xB1, 0x6A, 0x56, 0x83, 0xFA, 0x93, 0xFF, 0xFF, 0xB2, 0x6A, 0xCF, 0x6A, 0xB6, 0x93, 0xFF, 0xFF,
+    0xB7, 0xD5, 0x8D, 0x6A, 0x4C, 0x62, 0x6D, 0xEA, 0xFF, 0xFF, 0xAC, 0x7A, 0x0A, 0x62, 0x0A, 0x62, 0x2A, 0x72, 0xFE, 0xFF, 0x2A, 0x6A, 0x0A, 0x6A, 0x6C, 0xBA, 0x2A, 0x6A, 0x8B, 0x82, 0x4F, 0xFC, 0xE3, 0x40, 0x22, 0x5A, 0xE2, 0x50, 0xE2, 0x48, 0xC6, 0xDA, 0x01, 0x61, 0x64, 0x61, 0x66, 0xB9, 0xD0, 0xFE, 0xC7, 0xAB, 0x68, 0x9A, 0x02, 0x59, 0x84, 0x61, 0xFA, 0xFF, 0xC5, 0x91, 0x64, 0x61,
+    0x44, 0x61, 0x27, 0xDA, 0x45, 0x59, 0x23, 0x51, 0x44, 0x79, 0x24, 0x61, 0x24, 0x51, 0x45, 0x59, 0x89, 0x8A, 0xC6, 0x69, 0x08, 0x7A, 0x45, 0x51, 0xA7, 0x89, 0x25, 0x51, 0x86, 0x51, 0x28, 0x72, 0xCB, 0x9A, 0x45, 0x61, 0x86, 0x51, 0xCB, 0x9A, 0x94, 0xED, 0xA7, 0x51, 0xC7, 0x59, 0x8C, 0xC3, 0xFE, 0xFF, 0x8E, 0x93, 0xC9, 0x8A, 0xCB, 0x8A, 0xFF, 0xFF, 0x0C, 0x7B, 0x35, 0xA4, 0xEE, 0x8A,
+    0xBB, 0x9C, 0xFF, 0xFF, 0x53, 0x83, 0x32, 0x7B, 0x56, 0x7B, 0xFF, 0xFF, 0x3A, 0x73, 0x1B, 0x8C, 0x72, 0x62, 0x79, 0x7B, 0xFF, 0xFF, 0xF5, 0x72, 0x50, 0x62, 0x33, 0x7B, 0xFF, 0xFF, 0x9D, 0x7B, 0x2E, 0x5A, 0x4D, 0x62, 0x2E, 0xC3, 0xFF, 0xFF, 0x0B, 0x62, 0xCD, 0x7A, 0x6E, 0xDA, 0xFC, 0xFF, 0x0A, 0x6A, 0x8C, 0x72, 0x2A, 0x72, 0x0A, 0x62, 0x4B, 0x72, 0xAD, 0xFB, 0x6B, 0x8A, 0x2A, 0x62,
+    0xE5, 0xC9, 0xE2, 0x48, 0xE3, 0x48, 0x64, 0x59, 0x61, 0x60, 0xCB, 0xFC, 0xA5, 0x71, 0xE4, 0x91, 0x64, 0x61, 0x65, 0x8A, 0x25, 0x8A, 0x6D, 0xCC, 0x64, 0x71, 0xA5, 0x71, 0x8A, 0xDC, 0x84, 0xA9, 0x64, 0x69, 0x85, 0x69, 0x45, 0xB2, 0x44, 0x51, 0xE3, 0x48, 0x04, 0x61, 0xE7, 0x71, 0x03, 0x49, 0x65, 0x69, 0x28, 0x92, 0x25, 0x49, 0x29, 0xA2, 0x24, 0x49, 0x24, 0x59, 0x45, 0x81, 0xCB, 0x8A,
+    0x46, 0x81, 0xB7, 0xFF, 0xA6, 0x51, 0xAB, 0xB2, 0xBE, 0xFF, 0xC7, 0x51, 0xC7, 0x59, 0xFF, 0xFF, 0x6D, 0x9B, 0x2D, 0x8B, 0xFE, 0xFF, 0xEB, 0x92, 0xFF, 0xFF, 0xD9, 0xFF, 0x13, 0xA4, 0x4F, 0x83, 0xFF, 0xFF, 0x55, 0x9C, 0xCF, 0x7A, 0xF2, 0x8A, 0xFF, 0xFF, 0xFB, 0x9B, 0xF8, 0x8B, 0x76, 0x83, 0xF4, 0x7A, 0xFF, 0xFF, 0xF4, 0x6A, 0xF3, 0x72, 0x90, 0x6A, 0xFF, 0xFF, 0x96, 0x8B, 0xB6, 0x83,
+    0x2E, 0x62, 0x72, 0xEC, 0x6C, 0x7A, 0x0B, 0x62, 0x2C, 0x62, 0x6D, 0x7A, 0x75, 0xFF, 0x0B, 0x62, 0x2A, 0x6A, 0xCD, 0x72, 0x2B, 0x6A, 0x2C, 0xF3, 0x2B, 0x62, 0x0A, 0x62, 0x4A, 0x62, 0xAE, 0xED, 0xE3, 0x40, 0xA2, 0x40, 0x22, 0xA1, 0x44, 0x69, 0xC2, 0x50, 0xE2, 0xC8, 0x44, 0x69, 0x0A, 0xE4, 0xE7, 0xA9, 0x0A, 0xB3, 0x23, 0x61, 0xF9, 0xFF, 0x64, 0xB9, 0xC8, 0xBA, 0x8A, 0x9A, 0xBB, 0xFF,
+    0x63, 0x91, 0x64, 0x59, 0xC2, 0x48, 0xC6, 0x71, 0x24, 0x51, 0x24, 0x59, 0xC2, 0x58, 0x25, 0x59, 0x07, 0x8A, 0xA6, 0x61, 0x08, 0x6A, 0x24, 0x59, 0x44, 0x51, 0x28, 0xBA, 0x2B, 0xB3, 0x04, 0x49, 0x66, 0x59, 0x19, 0xAD, 0xA6, 0x59, 0x90, 0xFE, 0x74, 0xFE, 0x6A, 0x72, 0xC8, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x7A, 0x79, 0x8B, 0xCC, 0x8A, 0xD9, 0xEE, 0xFE, 0xFF, 0xAE, 0xEA, 0x0E, 0x8B,
+    0x3B, 0xF7, 0x0F, 0x83, 0xFB, 0xF6, 0xF0, 0x8A, 0xFF, 0xFF, 0xD3, 0x72, 0x95, 0x8B, 0xDF, 0xFE, 0xFF, 0xFF, 0xB2, 0x6A, 0xB2, 0x62, 0xD2, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x62, 0x37, 0xA4, 0xBE, 0xFF, 0x6D, 0x72, 0x7D, 0xFE, 0xF3, 0xAB, 0xD0, 0xFB, 0x4D, 0x6A, 0xCD, 0x8A, 0x9D, 0xE5, 0x6C, 0x72, 0x2B, 0xE2, 0x2A, 0x6A, 0x0A, 0x62, 0x34, 0xBC, 0x6D, 0xF3, 0x4A, 0x62, 0x4B, 0x62,
+    0x22, 0x69, 0xC2, 0x48, 0xC2, 0x40, 0xC1, 0x40, 0xC1, 0x48, 0xA7, 0xFA, 0xE2, 0x60, 0xC1, 0x58, 0x0A, 0xE4, 0xE2, 0x60, 0x03, 0xB1, 0x63, 0x69, 0xD4, 0xF6, 0xE5, 0x91, 0x02, 0x69, 0xC6, 0xE1, 0xFF, 0xFF, 0x03, 0x71, 0x24, 0x51, 0x65, 0x61, 0xA5, 0x79, 0x86, 0x61, 0x04, 0x49, 0xA6, 0x61, 0xE3, 0x48, 0xE7, 0x71, 0x45, 0x51, 0x24, 0x49, 0xA6, 0x61, 0xAA, 0x7A, 0x49, 0x7A, 0xC7, 0x61,
+    0xC7, 0x69, 0x09, 0x7A, 0x66, 0x51, 0x2F, 0xFD, 0xD4, 0xE5, 0xC8, 0x51, 0xC7, 0x51, 0xB2, 0xCC, 0xFB, 0xFF, 0x6A, 0x72, 0x4B, 0x72, 0x2A, 0x7A, 0x6D, 0x9B, 0xFF, 0xFF, 0xCD, 0x7A, 0x0E, 0xBB, 0x33, 0xB4, 0x14, 0xB4, 0xFF, 0xFF, 0x54, 0xCC, 0xF5, 0x9B, 0x75, 0x83, 0xFC, 0xBC, 0xFF, 0xFF, 0x33, 0x83, 0x71, 0x62, 0xF5, 0x72, 0x9F, 0xFF, 0xFF, 0xFF, 0x53, 0x83, 0x14, 0x83, 0xB8, 0xCC,
+    0x39, 0x9C, 0xFF, 0xFF, 0xCF, 0x7A, 0x50, 0xF3, 0x2F, 0x83, 0xD9, 0xDD, 0xFB, 0xFF, 0x0A, 0x62, 0x4B, 0x72, 0x2A, 0x6A, 0xD4, 0xD4, 0xB3, 0xD5, 0x0A, 0x7A, 0x0A, 0x5A, 0x6A, 0x62, 0x6A, 0x6A, 0xC2, 0x40, 0x02, 0x41, 0xA5, 0xC1, 0x43, 0x61, 0xE3, 0x58, 0x23, 0x51, 0x07, 0xCB, 0x05, 0xC2, 0x03, 0x69, 0x22, 0x61, 0x66, 0xCA, 0x84, 0x81, 0xE8, 0xC2, 0x63, 0x81, 0x57, 0xFF, 0xE4, 0x99,
+    0x88, 0xBA, 0xE6, 0x99, 0x24, 0x71, 0x07, 0x72, 0xE2, 0x48, 0xE7, 0x79, 0x04, 0x49, 0x24, 0x51, 0x25, 0x59, 0x65, 0x89, 0x69, 0x82, 0x86, 0x61, 0x66, 0x61, 0xE8, 0x61, 0x49, 0xBA, 0xE7, 0x61, 0xC8, 0xA1, 0x16, 0xFF, 0xE8, 0x61, 0xAB, 0x8A, 0xFD, 0xFF, 0x87, 0x49, 0xA7, 0x49, 0xFF, 0xFF, 0xFE, 0xFF, 0xCB, 0x7A, 0xBA, 0xFF, 0xAB, 0xDA, 0x6C, 0x8B, 0x9B, 0xFF, 0x37, 0xC5, 0x30, 0x93,
+    0x3D, 0xC5, 0xFF, 0xFF, 0xF3, 0x7A, 0x33, 0x93, 0x1C, 0xB5, 0x9D, 0x83, 0xFF, 0xFF, 0x77, 0x83, 0xD3, 0x6A, 0x37, 0x7B, 0x5E, 0xB5, 0xFF, 0xFF, 0x97, 0x83, 0x9B, 0xA4, 0x1D, 0x8C, 0xFF, 0xFF, 0xDB, 0x8B, 0x32, 0x73, 0xD0, 0x6A, 0xB3, 0x93, 0xFF, 0xFF, 0x33, 0x9C, 0x0A, 0x6A, 0x8C, 0x72, 0x28, 0x62, 0x39, 0xF7, 0x4A, 0x62, 0x4A, 0x6A, 0x2A, 0x5A, 0x8C, 0x6A, 0x0D, 0x8B, 0xB1, 0xAC,
+    0xA2, 0x58, 0x23, 0x51, 0x4C, 0xE4, 0xE3, 0x50, 0xC5, 0xA1, 0x82, 0x60, 0x85, 0x69, 0xC2, 0x60, 0x02, 0x69, 0x03, 0x79, 0x65, 0x79, 0xE4, 0x89, 0x85, 0x79, 0x66, 0xB2, 0x85, 0x79, 0xBB, 0xFF, 0xFE, 0xFF, 0xE6, 0x99, 0x02, 0x81, 0x2F, 0xE5, 0x08, 0x72, 0x64, 0x59, 0x89, 0x9A, 0x86, 0x59, 0x45, 0x59, 0x45, 0x59, 0x29, 0x7A, 0xE7, 0x69, 0xA6, 0x61, 0xEC, 0x92, 0x65, 0x61, 0xA7, 0x59,
+    0x49, 0x82, 0xFF, 0xFF, 0x6A, 0x72, 0x0E, 0x9B, 0x3F, 0xFF, 0xE8, 0x51, 0xC8, 0x51, 0xFF, 0xFF, 0x10, 0xC4, 0x0E, 0x83, 0x5A, 0xA4, 0x8A, 0x8A, 0xFF, 0xFF, 0xAA, 0x6A, 0x13, 0xB4, 0xEE, 0x82, 0xDF, 0xFF, 0x7A, 0xB4, 0x2E, 0x72, 0x4F, 0x62, 0x1F, 0xC7, 0xFF, 0xFF, 0x7D, 0x9C, 0xB4, 0x62, 0x96, 0x8B, 0x9D, 0xCE, 0x9B, 0x8B, 0xD5, 0x6A, 0xF3, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x94,
+    0x91, 0x6A, 0x52, 0x83, 0xB9, 0xAD, 0x11, 0x83, 0x50, 0x83, 0x2F, 0x83, 0x11, 0xBC, 0xFF, 0xFF, 0x2A, 0x62, 0x0A, 0x5A, 0xEC, 0xBA, 0x8B, 0x7A, 0x0C, 0x83, 0x0E, 0xC5, 0x6B, 0x62, 0xEB, 0x7A, 0x03, 0x51, 0x03, 0x51, 0xAD, 0xFD, 0x03, 0x59, 0xE3, 0x48, 0xE3, 0x50, 0xE7, 0x91, 0xFD, 0xFF, 0x03, 0x59, 0x23, 0x71, 0x83, 0x81, 0x94, 0xEE, 0xA4, 0x79, 0xCB, 0xE3, 0xA6, 0x89, 0xFF, 0xFF,
+    0x03, 0x69, 0x03, 0x61, 0x85, 0x69, 0x0B, 0xFD, 0xC7, 0x79, 0xA6, 0x61, 0x24, 0x49, 0x08, 0xAA, 0x45, 0x51, 0x45, 0x49, 0xA7, 0x59, 0x8A, 0x82, 0xA6, 0x59, 0xCC, 0x7A, 0xA7, 0x51, 0x87, 0x59, 0xA6, 0x61, 0x28, 0x82, 0xC8, 0x59, 0x29, 0x72, 0xFD, 0xFF, 0xE8, 0x59, 0xC8, 0x51, 0xFF, 0xFF, 0x0D, 0x93, 0xB2, 0x8B, 0x6A, 0x72, 0x0E, 0x8B, 0x96, 0xE6, 0x2A, 0x62, 0x33, 0xBC, 0x72, 0xB4,
+    0xFF, 0xFF, 0xD9, 0xC4, 0x4D, 0x62, 0xCF, 0x7A, 0xFF, 0xFF, 0xF2, 0x72, 0x9D, 0xC5, 0x12, 0x83, 0xFF, 0xFF, 0x59, 0x73, 0xD3, 0x6A, 0xD2, 0x72, 0xFF, 0xFF, 0xB4, 0x72, 0x54, 0x83, 0xD7, 0x8B, 0xFF, 0xFF, 0x6C, 0x62, 0x71, 0x8B, 0x10, 0x7B, 0x71, 0xFC, 0x0F, 0x83, 0x2B, 0x62, 0x2B, 0x5A, 0x2B, 0x62, 0x8C, 0xD2, 0x4B, 0x6A, 0x2A, 0x62, 0x4B, 0x62, 0xFE, 0xFF, 0x6B, 0x6A, 0x8B, 0x7A,
+    0x84, 0x79, 0xE2, 0x50, 0xE2, 0x48, 0xA6, 0xA1, 0x41, 0x81, 0x64, 0x81, 0x44, 0x61, 0xE3, 0x58, 0xFA, 0xFF, 0xA8, 0xC2, 0xA5, 0x79, 0xC5, 0x81, 0xB4, 0xF6, 0xA4, 0x89, 0xC6, 0x91, 0x08, 0xB3, 0xFF, 0xF7, 0x66, 0xC2, 0x43, 0x99, 0xE7, 0x91, 0x45, 0xB2, 0x24, 0x61, 0x45, 0x51, 0x45, 0x59, 0x89, 0xA2, 0x24, 0x59, 0xA6, 0x59, 0x6F, 0xFB, 0xE8, 0x69, 0xCB, 0x8A, 0xEB, 0xCA, 0x46, 0x51,
+    0x86, 0x59, 0xB9, 0xFF, 0xEE, 0x82, 0xFF, 0xFF, 0xFD, 0xFF, 0xE8, 0x51, 0xC8, 0x59, 0xFE, 0xFF, 0xFA, 0xFF, 0x75, 0xAC, 0xDC, 0xFF, 0x4C, 0x8A, 0x0D, 0x93, 0xFF, 0xFF, 0x0E, 0x8B, 0xCE, 0xCA, 0x94, 0xEC, 0xEF, 0x82, 0xFE, 0xFF, 0x32, 0xD4, 0x30, 0x83, 0x6E, 0x6A, 0x55, 0xAC, 0xDF, 0xFF, 0xDE, 0xFF, 0xD2, 0x72, 0xD2, 0x6A, 0xDF, 0xFF, 0x92, 0xCB, 0xFF, 0xFF, 0x70, 0x6A, 0x9B, 0xFF,
+    0xD1, 0x72, 0x6E, 0x62, 0xFC, 0xFF, 0x90, 0xD3, 0x6E, 0x62, 0x8D, 0x72, 0x2A, 0x62, 0x9A, 0xFE, 0x8D, 0x82, 0x2B, 0x6A, 0x2A, 0x62, 0x4A, 0x72, 0xB2, 0xBB, 0x90, 0xF3, 0x6B, 0x6A, 0x6A, 0x62, 0x85, 0x79, 0x24, 0x61, 0xA1, 0x70, 0x03, 0x59, 0xA2, 0x50, 0xC6, 0xE9, 0xA6, 0xD2, 0x23, 0x89, 0x43, 0x61, 0xE6, 0x79, 0xA6, 0xD1, 0xE6, 0x91, 0x85, 0x71, 0x43, 0x69, 0x95, 0xFF, 0xC7, 0xE9,
+    0x70, 0xA4, 0x69, 0x9A, 0xE6, 0x99, 0xBB, 0xFF, 0xE7, 0x81, 0x64, 0x81, 0xD5, 0xFE, 0x08, 0x6A, 0x04, 0x49, 0x07, 0x7A, 0xE8, 0x61, 0xCC, 0x82, 0xE7, 0x71, 0x6B, 0x7A, 0xC8, 0xF1, 0x25, 0x51, 0xCD, 0xFB, 0xC8, 0x7A, 0x50, 0x93, 0xF7, 0xFF, 0xBA, 0xFF, 0xE8, 0x59, 0xE8, 0x59, 0xFF, 0xFF, 0xFC, 0xFF, 0xE9, 0x61, 0xAC, 0x9B, 0x0B, 0xDB, 0xAA, 0x8A, 0xFF, 0xFF, 0xF1, 0xBB, 0x8C, 0x82,
+    0x2B, 0x6A, 0xCF, 0xAB, 0xFF, 0xFF, 0x4C, 0x6A, 0xAE, 0x72, 0x0D, 0xF3, 0x78, 0xEE, 0xFF, 0xFF, 0x12, 0xD3, 0xF3, 0x7A, 0x37, 0x83, 0x3D, 0xCE, 0xFF, 0xFF, 0xF2, 0x82, 0xF3, 0x9A, 0x7D, 0xA5, 0xDF, 0xFF, 0xFF, 0xFF, 0x32, 0x7B, 0xD0, 0x7A, 0xBA, 0x9B, 0x9A, 0xCD, 0xFA, 0xF6, 0x6C, 0xA2, 0xED, 0x7A, 0xEE, 0x9B, 0x34, 0xE5, 0x0D, 0xAC, 0x4B, 0x62, 0x29, 0x62, 0xAB, 0x6A, 0x0D, 0x73,
+    0xC2, 0x48, 0x03, 0x49, 0xE4, 0x50, 0x04, 0x51, 0xD3, 0xFF, 0x29, 0x8A, 0xE2, 0x58, 0x82, 0x58, 0x64, 0xB1, 0x07, 0xAA, 0x24, 0x61, 0x03, 0x59, 0xAC, 0xEB, 0xFE, 0xFF, 0x65, 0x69, 0x03, 0x59, 0x44, 0x91, 0x24, 0x89, 0x85, 0x71, 0x49, 0xCA, 0x04, 0x59, 0xCA, 0xBA, 0xEB, 0xAA, 0xC7, 0x61, 0x65, 0x51, 0x25, 0x49, 0x4D, 0xAB, 0x65, 0x51, 0xE7, 0x61, 0x6B, 0x82, 0x66, 0x51, 0x87, 0x61,
+    0xC7, 0x69, 0x6A, 0x92, 0xCC, 0x82, 0x4F, 0xBB, 0xDD, 0xFF, 0xE8, 0x59, 0x66, 0x41, 0xDF, 0xFF, 0xB2, 0xD4, 0xEC, 0x8A, 0x49, 0x6A, 0x6A, 0x7A, 0xDD, 0xFF, 0xEC, 0x92, 0xFE, 0xFF, 0x2A, 0x6A, 0x6C, 0x9B, 0xFD, 0xFF, 0xAB, 0x72, 0x0A, 0x62, 0x8F, 0x8B, 0xFF, 0xFF, 0x3A, 0xD6, 0xD0, 0x7A, 0xF2, 0x82, 0xFE, 0x8B, 0xFF, 0xFF, 0x9B, 0x83, 0x92, 0x6A, 0x37, 0x7B, 0xFF, 0xFF, 0x5F, 0xD6,
+    0x36, 0x7B, 0x50, 0x62, 0xFB, 0x94, 0xFF, 0xFF, 0xF5, 0x7B, 0xCF, 0x6A, 0x8D, 0x72, 0xFF, 0xFF, 0xBA, 0xC5, 0x8B, 0x72, 0x4A, 0x62, 0x4B, 0x62, 0x2F, 0x83, 0x8D, 0x82, 0xAF, 0x8B, 0xAD, 0x7A, 0xC2, 0x60, 0xE3, 0x70, 0x28, 0xFB, 0x03, 0x51, 0x03, 0x51, 0x64, 0x89, 0x06, 0xBA, 0xDE, 0xFF, 0x04, 0x61, 0x07, 0x9A, 0x4D, 0xF5, 0xEA, 0xDB, 0x84, 0x79, 0x24, 0x69, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE6, 0x81, 0xA5, 0x71, 0x69, 0xF3, 0xAA, 0xEB, 0x44, 0x59, 0x8C, 0xFB, 0x66, 0x51, 0x46, 0xA1, 0x69, 0x9A, 0x25, 0x49, 0xAB, 0x7A, 0x24, 0x61, 0xA6, 0x61, 0x29, 0x72, 0x8A, 0xD2, 0x29, 0x82, 0x86, 0x59, 0x8F, 0xDC, 0x49, 0x72, 0xB0, 0xAB, 0x30, 0xD5, 0xE8, 0x59, 0x66, 0x41, 0xFF, 0xFF, 0xB0, 0xA3, 0x4D, 0x93, 0xEF, 0xD4, 0xAB, 0x8A, 0xFB, 0xFF, 0xAD, 0xBB, 0x6D, 0x72, 0xEB, 0x8A,
+    0xFF, 0xFF, 0x4F, 0x8B, 0x2F, 0x83, 0x4E, 0xE3, 0xFF, 0xFF, 0xF4, 0xB4, 0x34, 0xCC, 0xAE, 0x7A, 0xFF, 0xFF, 0x1D, 0xEE, 0xD2, 0x72, 0xB0, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x6A, 0x34, 0x7B, 0xFF, 0xFF, 0xFF, 0xF7, 0x95, 0x83, 0x8F, 0x82, 0x71, 0xBC, 0xD3, 0xD5, 0xD0, 0xAB, 0x0E, 0x7B, 0x8C, 0x6A, 0x6C, 0xBB, 0xAA, 0x7A, 0x8B, 0x6A, 0x0D, 0xC3, 0xFE, 0xFF, 0x4B, 0x62, 0x18, 0xDE,
+    0x02, 0x71, 0x84, 0x89, 0x8A, 0xAB, 0x03, 0x59, 0xED, 0xCC, 0xCE, 0xF5, 0x03, 0x59, 0x69, 0x9A, 0x89, 0xD2, 0xA5, 0xA9, 0xC5, 0xA1, 0xE2, 0x68, 0x2A, 0x9B, 0x97, 0xFF, 0x85, 0x79, 0x85, 0x71, 0xDD, 0xFF, 0xFF, 0xFF, 0x04, 0x59, 0xFE, 0xFF, 0x72, 0xFE, 0xA6, 0x79, 0x15, 0xDE, 0xA6, 0x71, 0x0C, 0xD3, 0x23, 0x49, 0x28, 0x6A, 0xA6, 0x59, 0xA3, 0x70, 0xC8, 0x69, 0x66, 0x59, 0x29, 0x6A,
+    0x10, 0xFC, 0x48, 0x6A, 0x0B, 0x8B, 0xC8, 0x69, 0xFE, 0xFF, 0xC8, 0x59, 0xA7, 0x51, 0x96, 0xFF, 0xE9, 0x69, 0x8D, 0x7A, 0x11, 0xDD, 0xD0, 0xDB, 0x29, 0x72, 0x0A, 0x6A, 0xE9, 0x69, 0x72, 0xEC, 0xAC, 0x82, 0xCD, 0x82, 0x4B, 0xA2, 0xF3, 0xE4, 0xCD, 0x82, 0x15, 0xFF, 0x50, 0xAB, 0xFF, 0xFF, 0x6D, 0x9A, 0x6E, 0x72, 0x92, 0xF3, 0x97, 0xE6, 0x8E, 0x6A, 0x0E, 0x5A, 0x50, 0xFB, 0x54, 0xB5,
+    0x6D, 0x6A, 0x50, 0xAB, 0x8E, 0x6A, 0xCA, 0x61, 0x13, 0xA4, 0x2B, 0x62, 0x4B, 0x62, 0x8C, 0x7A, 0x4A, 0x62, 0x2A, 0x62, 0xAB, 0x92, 0x4A, 0x6A, 0x2A, 0x62, 0x2A, 0x62, 0xAC, 0x92, 0x4A, 0x62, 0xC2, 0x48, 0x23, 0x51, 0x85, 0x61, 0xE3, 0x50, 0x06, 0xFA, 0xC2, 0x58, 0x03, 0x51, 0xC6, 0x71, 0x86, 0x69, 0xE3, 0x68, 0xC6, 0x81, 0xE6, 0x89, 0x64, 0x79, 0x03, 0x61, 0x44, 0x89, 0xFF, 0xFF,
+    0x29, 0xE3, 0x08, 0x8A, 0x24, 0x69, 0x45, 0x71, 0x24, 0x59, 0x65, 0x61, 0x2A, 0xD2, 0x49, 0x82, 0x86, 0x61, 0xA6, 0x61, 0x66, 0x59, 0x87, 0x61, 0x45, 0x51, 0x46, 0xA1, 0x86, 0x59, 0x29, 0x72, 0xA7, 0x81, 0x25, 0x61, 0x0E, 0x8B, 0x0F, 0xAC, 0xDE, 0xFF, 0xE9, 0x59, 0xC8, 0x51, 0x1B, 0xBD, 0x4B, 0x6A, 0x2A, 0x72, 0xCD, 0x82, 0x51, 0xAC, 0x8B, 0x82, 0x4D, 0xBC, 0x91, 0xE4, 0x4B, 0x7A,
+    0x0A, 0x72, 0x4D, 0xBB, 0x8C, 0xB2, 0xCC, 0x8A, 0x6C, 0x82, 0x6C, 0xEA, 0x4B, 0x82, 0x4C, 0x8A, 0xAE, 0xCA, 0x4C, 0x82, 0x2C, 0x6A, 0xCB, 0x71, 0x8D, 0x92, 0xF1, 0xCA, 0x0C, 0x5A, 0x4B, 0x72, 0xAE, 0x7A, 0xAD, 0x7A, 0x15, 0xED, 0x0B, 0x62, 0x6B, 0x6A, 0x4A, 0x62, 0x4B, 0x7A, 0xCE, 0x8A, 0x6A, 0x6A, 0x2A, 0x62, 0x29, 0x62, 0x2A, 0x72, 0x4E, 0xA3, 0x6B, 0x92, 0x6B, 0x6A, 0x2A, 0x62,
+    0x07, 0xA2, 0x4B, 0xCB, 0x28, 0xEA, 0x23, 0x51, 0xA2, 0x68, 0xE7, 0xF9, 0xE6, 0x91, 0xFF, 0xFF, 0x23, 0x61, 0xE8, 0xC2, 0x09, 0xEB, 0x23, 0x71, 0x6E, 0xFC, 0x85, 0x71, 0xAB, 0xFC, 0x28, 0xFA, 0xA5, 0x91, 0x04, 0x71, 0xCD, 0xEB, 0x27, 0x61, 0x89, 0xBA, 0x6D, 0xEB, 0x25, 0x51, 0x2E, 0x93, 0x09, 0xB2, 0x6A, 0xF2, 0x65, 0x69, 0xEA, 0x99, 0x25, 0x49, 0x25, 0x51, 0xEF, 0xDB, 0xED, 0x92,
+    0xE9, 0x69, 0xFD, 0xFF, 0xE8, 0x69, 0x58, 0xF7, 0xFF, 0xFF, 0xE9, 0x59, 0xA8, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x69, 0xFF, 0xFF, 0x8D, 0x82, 0x2D, 0xBB, 0xD4, 0xED, 0xC7, 0x71, 0x0A, 0x6A, 0xAB, 0xE2, 0x51, 0xF4, 0x53, 0xED, 0x8E, 0xFB, 0xC9, 0x79, 0xC9, 0x79, 0xDB, 0xF6, 0x19, 0xF6, 0x0A, 0x7A, 0x94, 0xFF, 0x0E, 0xC3, 0x34, 0xF5, 0x79, 0xFF, 0xC9, 0x99, 0x8B, 0x7A, 0xBB, 0xFF,
+    0x98, 0xF5, 0xB6, 0xE5, 0x8E, 0x7A, 0xED, 0xB2, 0xBE, 0xFF, 0x55, 0xDD, 0xEC, 0xD2, 0x71, 0xA3, 0x0F, 0xAD, 0x74, 0xF6, 0xDF, 0xFF, 0x6A, 0x7A, 0xAC, 0xDA, 0xD0, 0xA3, 0xFF, 0xFF, 0x51, 0xFD, 0xE6, 0x81, 0xE5, 0xD9, 0xA7, 0x99, 0x04, 0x59, 0xE6, 0xC1, 0xA5, 0x89, 0xE7, 0xEA, 0x87, 0xD2, 0x02, 0x79, 0x8A, 0xF3, 0xFF, 0xFF, 0x0C, 0xDC, 0x07, 0x8A, 0xED, 0xF4, 0xFF, 0xFF, 0x10, 0xD5,
+    0x45, 0x71, 0x44, 0x69, 0xCC, 0xFC, 0x66, 0x91, 0x09, 0x7A, 0xE7, 0x79, 0xC7, 0xE1, 0x6A, 0xBA, 0x87, 0x61, 0xA8, 0x51, 0x45, 0x69, 0xCB, 0xFA, 0x89, 0x59, 0x05, 0x49, 0x46, 0x51, 0x70, 0xC3, 0x6A, 0x7A, 0x67, 0x51, 0x08, 0x72, 0x8B, 0xF2, 0x85, 0x71, 0xC8, 0x51, 0xA8, 0x51, 0x4C, 0x8A, 0xB0, 0xE3, 0x6A, 0x8A, 0xA9, 0x61, 0xC9, 0x71, 0xFF, 0xFF, 0x88, 0x69, 0x87, 0x61, 0xC9, 0x79,
+    0xFC, 0xFF, 0x4A, 0xA2, 0x4A, 0x92, 0xAC, 0xA2, 0xFD, 0xFF, 0xFF, 0xFF, 0x2C, 0xBB, 0x0A, 0x8A, 0xEF, 0xE3, 0x97, 0xF6, 0xAB, 0xA2, 0x0A, 0x82, 0xD4, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x92, 0x55, 0xDE, 0xDF, 0xFF, 0xBE, 0xD6, 0xCC, 0x82, 0xCC, 0x8B, 0xFE, 0xFF, 0x8F, 0x8B, 0xFF, 0xF7, 0xCE, 0x9B, 0x28, 0x6A, 0xFD, 0xFF, 0x2F, 0x9C, 0xFF, 0xF7, 0x99, 0xEF, 0xAD, 0x7B, 0xD7, 0xFF,
+    0x86, 0x71, 0xC4, 0x89, 0x44, 0x89, 0xD7, 0xFF, 0xC4, 0x89, 0xE7, 0xE2, 0x49, 0xBB, 0x85, 0x81, 0xE6, 0xA1, 0x29, 0xBB, 0xC5, 0xD2, 0x2A, 0xBB, 0xC6, 0x89, 0x93, 0xF5, 0xFE, 0xFF, 0x44, 0x81, 0x26, 0xC2, 0xFF, 0xFF, 0xA9, 0xE3, 0x24, 0x59, 0xC9, 0xC2, 0x67, 0xEA, 0x25, 0x51, 0x68, 0x92, 0x49, 0xAA, 0xC8, 0xE1, 0x65, 0x61, 0x04, 0x59, 0x6A, 0xE2, 0x86, 0x71, 0x46, 0x51, 0x46, 0x59,
+    0x54, 0xFE, 0x86, 0x59, 0x6A, 0x92, 0x4B, 0x7A, 0xEE, 0x92, 0xC9, 0x59, 0xA8, 0x51, 0xD2, 0x82, 0xEA, 0x61, 0xAC, 0x8A, 0x6D, 0x72, 0xD8, 0xEE, 0xAC, 0x92, 0x4A, 0x7A, 0x8D, 0xBB, 0x31, 0xFC, 0x09, 0x7A, 0x29, 0x7A, 0x2D, 0xFB, 0xE9, 0x89, 0xE9, 0x79, 0x68, 0x81, 0x2A, 0xD2, 0x4D, 0xB3, 0x4B, 0x82, 0x8A, 0xBA, 0x99, 0xFF, 0x46, 0x69, 0x09, 0x6A, 0xED, 0xA2, 0xCC, 0xA2, 0xC9, 0x61,
+    0x8B, 0x7A, 0x6B, 0x8A, 0x0A, 0x62, 0xE9, 0x61, 0x29, 0x6A, 0x29, 0x6A, 0x6A, 0x72, 0xE9, 0x69, 0x4A, 0x6A, 0x09, 0x62, 0xAA, 0x82, 0x4A, 0x72, 0xCA, 0xE2, 0x09, 0x62, 0x49, 0x9A, 0x09, 0x6A, 0xC3, 0x88, 0x03, 0x51, 0x24, 0x51, 0xA6, 0x79, 0x83, 0x61, 0x66, 0x69, 0x85, 0x61, 0xEF, 0xBB, 0x86, 0x69, 0xC5, 0x79, 0xE8, 0x89, 0x4A, 0x8A, 0xA4, 0x69, 0x86, 0x69, 0xCC, 0xEB, 0xFE, 0xFF,
+    0xA6, 0x69, 0x49, 0x9A, 0x70, 0xFD, 0x25, 0x59, 0x6A, 0xDA, 0xAC, 0xD4, 0x67, 0x59, 0x49, 0x8A, 0x10, 0xEC, 0x51, 0xA3, 0x26, 0x51, 0xED, 0xDA, 0xEA, 0x69, 0x2A, 0x7A, 0xF8, 0xFF, 0x51, 0x9B, 0x27, 0x59, 0xF9, 0xF6, 0xA9, 0x71, 0xBB, 0xC4, 0xFF, 0xFF, 0xE9, 0x59, 0xA9, 0x51, 0xFF, 0xFF, 0x35, 0x83, 0x8D, 0x8A, 0xFE, 0xFF, 0x70, 0x7A, 0xAD, 0x8A, 0xDD, 0xFF, 0x2A, 0x72, 0xE9, 0x69,
+    0xAE, 0xF3, 0x6A, 0xBA, 0x0A, 0x8A, 0x09, 0xD2, 0x6F, 0xEB, 0xC8, 0x91, 0x2F, 0xF4, 0xEF, 0xF5, 0xA8, 0x79, 0xBC, 0xFF, 0x8B, 0xC2, 0x88, 0x79, 0x78, 0xFF, 0xE6, 0xA1, 0xC8, 0x69, 0xA8, 0x61, 0x6C, 0x92, 0xE9, 0x71, 0xA7, 0x69, 0x6E, 0xBB, 0xCC, 0xCA, 0x28, 0x9A, 0xC8, 0xC1, 0xE9, 0xB9, 0x66, 0x89, 0x8C, 0xFB, 0x33, 0xFF, 0xA8, 0x61, 0x2A, 0xCA, 0x66, 0x89, 0x49, 0x6A, 0xAA, 0xD2,
+    0xE3, 0x40, 0x04, 0x41, 0x04, 0x49, 0x04, 0x49, 0xA6, 0x61, 0x24, 0x51, 0x24, 0x51, 0xC6, 0x69, 0x45, 0x51, 0x86, 0x69, 0x69, 0x82, 0x86, 0x69, 0xA6, 0x69, 0x24, 0x59, 0x45, 0x59, 0x45, 0x59, 0x66, 0x59, 0x0D, 0x93, 0x45, 0x59, 0x86, 0x61, 0x25, 0x59, 0x04, 0x49, 0xC8, 0x61, 0x87, 0x61, 0x46, 0x59, 0xA8, 0x69, 0x66, 0x51, 0x08, 0x72, 0x66, 0x59, 0x25, 0x51, 0xE4, 0x48, 0xC8, 0x61,
+    0xE9, 0x71, 0x67, 0x59, 0x87, 0x61, 0x2A, 0x7A, 0x2A, 0x62, 0x88, 0x51, 0x67, 0x49, 0xEB, 0x59, 0x0B, 0x6A, 0xC9, 0x61, 0xA9, 0x59, 0xEA, 0x69, 0x4A, 0x7A, 0x4A, 0x8A, 0x67, 0x61, 0xE9, 0x69, 0xA8, 0x69, 0xC8, 0x71, 0xA8, 0x71, 0x87, 0x69, 0xC8, 0x71, 0xC8, 0x69, 0xA8, 0x69, 0xA8, 0x71, 0xA8, 0x69, 0xE9, 0x71, 0x67, 0x61, 0x46, 0x59, 0x87, 0x61, 0x87, 0x59, 0xE9, 0x69, 0xA8, 0x61,
+    0xE8, 0x61, 0xC8, 0x61, 0xC8, 0x69, 0xC8, 0x69, 0xE8, 0x61, 0xE8, 0x69, 0xC8, 0x61, 0xE8, 0x69, 0xA7, 0x59, 0x09, 0x62, 0x0A, 0x62, 0x87, 0x59, 0x29, 0x6A, 0xA7, 0x51, 0x29, 0x62, 0x29, 0x62, 0xA1, 0x40, 0x45, 0xBA, 0x48, 0xB2, 0xA4, 0x99, 0x47, 0xD2, 0xEA, 0xDA, 0x29, 0xDB, 0x86, 0xDB, 0xE5, 0x91, 0xB0, 0xFF, 0x77, 0xFF, 0x8D, 0xFC, 0xFC, 0xFF, 0xD7, 0xFF, 0x68, 0xFA, 0x6B, 0xFC,
+    0xA4, 0x99, 0xA8, 0xC2, 0x2F, 0xEC, 0x85, 0x89, 0x27, 0xC2, 0x41, 0x80, 0x4A, 0xFB, 0xA6, 0x81, 0x65, 0x59, 0xCB, 0xF3, 0xCC, 0xFB, 0x69, 0x9A, 0x45, 0x51, 0x25, 0x61, 0xFF, 0xFF, 0x32, 0xFC, 0x25, 0x51, 0x66, 0x59, 0x0D, 0x93, 0xFF, 0xFF, 0xE9, 0x61, 0x87, 0x51, 0x87, 0x49, 0x6C, 0x82, 0xFF, 0xFF, 0xE8, 0x79, 0xA8, 0x59, 0xC9, 0x69, 0xD4, 0xF3, 0xFF, 0xFF, 0x09, 0x82, 0xA8, 0x61,
+    0x0D, 0x9B, 0xCC, 0xE2, 0xFF, 0xFF, 0xA8, 0x79, 0x0D, 0xE3, 0xAC, 0xCA, 0x8D, 0xDA, 0x0E, 0xE3, 0x67, 0x71, 0x2E, 0xCB, 0xE8, 0xC1, 0x2F, 0xE3, 0xE4, 0x98, 0x34, 0xFE, 0xF9, 0xFF, 0xC7, 0xC9, 0xD0, 0xE3, 0xD9, 0xFF, 0x39, 0xFF, 0xCD, 0xBB, 0xFF, 0xFF, 0xB3, 0xF5, 0x68, 0x82, 0x50, 0xF5, 0x2B, 0xBC, 0x2A, 0xA3, 0xFF, 0xFF, 0x08, 0x62, 0xAC, 0xDB, 0x07, 0x62, 0xFA, 0xFF, 0xCA, 0x92,
+    0xE2, 0x60, 0x64, 0xA9, 0x88, 0xA2, 0xE0, 0x80, 0x06, 0x93, 0x05, 0x61, 0x66, 0x7A, 0x62, 0x69, 0x88, 0x92, 0xC9, 0xE3, 0x89, 0xBB, 0x6F, 0xBC, 0x08, 0xAB, 0x45, 0x92, 0x66, 0x92, 0xFF, 0xFF, 0xD0, 0xFE, 0xE5, 0xA9, 0x9C, 0xFF, 0xCC, 0xDA, 0x48, 0xDC, 0x38, 0xFF, 0x93, 0xF4, 0x09, 0xB2, 0x04, 0xA1, 0x0D, 0xDB, 0xD1, 0xFD, 0x4F, 0xD3, 0x26, 0x59, 0x94, 0xFE, 0x36, 0xFF, 0xA7, 0x69,
+    0xEF, 0xE3, 0xFE, 0xFF, 0x46, 0x79, 0xEF, 0x92, 0xFF, 0xFF, 0x6B, 0x6A, 0x67, 0x49, 0xFF, 0xFF, 0x76, 0x8B, 0x2E, 0xA3, 0xFF, 0xFF, 0xB0, 0xD3, 0x8B, 0x8A, 0xFD, 0xFF, 0x1A, 0xF7, 0x46, 0x61, 0x93, 0xF4, 0xF7, 0xFF, 0xED, 0xF2, 0xB3, 0xFD, 0x68, 0xCA, 0x4D, 0xFB, 0xAA, 0xF2, 0x92, 0xFE, 0x09, 0xE2, 0xCC, 0xF2, 0x09, 0xC3, 0xDC, 0xFF, 0xEF, 0xF4, 0xAE, 0xEB, 0x08, 0x9A, 0x49, 0x9A,
+    0x86, 0x71, 0x68, 0x92, 0x49, 0xA2, 0xAA, 0xB2, 0x27, 0x92, 0xCA, 0xBA, 0x2C, 0xBB, 0x08, 0x92, 0x86, 0x89, 0x29, 0xD2, 0x4E, 0xFD, 0x08, 0x92, 0x09, 0x92, 0x0F, 0xFC, 0xE8, 0x69, 0x8A, 0xAA, 0xE2, 0x40, 0xE3, 0x40, 0xE3, 0x40, 0x03, 0x49, 0x03, 0x41, 0x24, 0x49, 0x23, 0x49, 0x03, 0x49, 0x44, 0x51, 0x24, 0x51, 0x44, 0x51, 0x64, 0x59, 0x24, 0x51, 0xA6, 0x69, 0x44, 0x51, 0x24, 0x51,
+    0x64, 0x59, 0x03, 0x51, 0x85, 0x61, 0xA6, 0x61, 0x45, 0x59, 0x86, 0x61, 0x86, 0x59, 0x45, 0x51, 0x24, 0x51, 0x86, 0x59, 0x45, 0x59, 0x66, 0x59, 0x26, 0x51, 0xA7, 0x61, 0x66, 0x59, 0x66, 0x59, 0x66, 0x51, 0x46, 0x51, 0x66, 0x51, 0xA8, 0x61, 0x8D, 0x72, 0x67, 0x49, 0x66, 0x41, 0xA9, 0x51, 0x88, 0x51, 0xA8, 0x59, 0x88, 0x51, 0xC8, 0x61, 0xA7, 0x59, 0x87, 0x59, 0x86, 0x61, 0xA8, 0x69,
+    0x86, 0x61, 0x87, 0x61, 0x87, 0x61, 0x46, 0x59, 0x46, 0x59, 0x87, 0x69, 0xE8, 0x71, 0x87, 0x61, 0x66, 0x59, 0x67, 0x61, 0x66, 0x61, 0x66, 0x59, 0x46, 0x51, 0x46, 0x51, 0x46, 0x51, 0x46, 0x51, 0x66, 0x51, 0x66, 0x51, 0x87, 0x59, 0x87, 0x59, 0xC7, 0x61, 0xA7, 0x61, 0x87, 0x51, 0xC7, 0x61, 0xA7, 0x59, 0xA7, 0x59, 0xA7, 0x59, 0xA7, 0x51, 0xC8, 0x59, 0xC8, 0x59, 0xC8, 0x59, 0xE8, 0x59,
+    0xE3, 0x40, 0xE2, 0x40, 0x03, 0x41, 0x03, 0x41, 0xE3, 0x40, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x44, 0x51, 0x23, 0x49, 0x03, 0x49, 0x44, 0x51, 0x23, 0x51, 0x03, 0x51, 0x24, 0x49, 0x24, 0x49, 0x24, 0x51, 0x24, 0x59, 0x44, 0x59, 0x65, 0x59, 0x44, 0x59, 0x65, 0x59, 0x45, 0x51, 0x45, 0x51, 0x04, 0x49, 0x24, 0x51, 0x25, 0x49, 0x65, 0x51, 0x45, 0x51, 0x86, 0x59, 0xA6, 0x59, 0x66, 0x51,
+    0x45, 0x51, 0x45, 0x51, 0x25, 0x49, 0xC7, 0x61, 0x87, 0x51, 0x46, 0x49, 0x05, 0x39, 0x67, 0x51, 0x67, 0x51, 0x67, 0x51, 0x26, 0x51, 0x87, 0x59, 0x87, 0x59, 0x87, 0x59, 0x46, 0x51, 0x87, 0x59, 0x66, 0x59, 0x25, 0x51, 0x66, 0x59, 0x46, 0x59, 0x05, 0x49, 0x66, 0x59, 0x66, 0x59, 0x45, 0x51, 0x46, 0x51, 0x46, 0x51, 0x66, 0x51, 0x46, 0x51, 0x46, 0x49, 0x26, 0x49, 0x25, 0x49, 0x25, 0x49,
+    0x25, 0x49, 0x46, 0x51, 0x66, 0x59, 0x66, 0x51, 0x87, 0x59, 0xA7, 0x61, 0x66, 0x51, 0x87, 0x59, 0xA7, 0x59, 0x87, 0x59, 0x87, 0x59, 0xA7, 0x59, 0xC7, 0x59, 0xA7, 0x51, 0xC8, 0x59, 0xC8, 0x59, 0x2C, 0xFC, 0xAA, 0xDB, 0x64, 0x59, 0x26, 0x8A, 0x27, 0xDC, 0xA6, 0x61, 0x84, 0x59, 0x63, 0x59, 0x61, 0x49, 0x05, 0x72, 0x66, 0x6A, 0x83, 0x61, 0x24, 0x72, 0x25, 0x82, 0xC8, 0x8A, 0x88, 0xB3,
+    0xB5, 0xEE, 0x25, 0xAA, 0x24, 0x81, 0x63, 0x99, 0xCA, 0xC3, 0xE5, 0x99, 0x90, 0xDD, 0x6D, 0xC3, 0x85, 0xA1, 0xD4, 0xE4, 0xA7, 0x91, 0x65, 0xA1, 0xFD, 0xFF, 0xEB, 0xCA, 0x31, 0xF5, 0x45, 0x69, 0x65, 0x81, 0x54, 0xFE, 0x24, 0x59, 0x0B, 0xA3, 0x9B, 0xFF, 0x46, 0x51, 0xE4, 0x40, 0xFF, 0xFF, 0x0D, 0x8B, 0xE8, 0x71, 0xFE, 0xFF, 0xB6, 0xDC, 0x87, 0x69, 0x90, 0xE5, 0xFE, 0xFF, 0x09, 0x8A,
+    0xD1, 0xF4, 0x8D, 0xE4, 0x88, 0xDA, 0x56, 0xF6, 0x05, 0x99, 0xC4, 0xD9, 0x8B, 0xE3, 0xCC, 0xE2, 0x0C, 0xEB, 0x03, 0x81, 0x56, 0xF6, 0x6D, 0xE4, 0x2C, 0xDC, 0xAA, 0xB2, 0x31, 0xF5, 0xE7, 0x91, 0x05, 0x69, 0x6B, 0xD3, 0x85, 0x91, 0x86, 0x69, 0xA6, 0x89, 0xE7, 0xA1, 0x25, 0x61, 0x90, 0xE5, 0xE8, 0x89, 0xE8, 0xE1, 0x0D, 0xF3, 0x8A, 0xCA, 0x67, 0x89, 0x91, 0xF5, 0xCC, 0xE2, 0x08, 0x72,
+    0x03, 0x59, 0xE7, 0xC1, 0x0D, 0xDC, 0xE6, 0x81, 0xF7, 0xFF, 0x03, 0x59, 0xA7, 0xAA, 0xC1, 0x50, 0x23, 0x59, 0xFB, 0xFF, 0xA5, 0x71, 0xEC, 0xDB, 0xD5, 0xF6, 0x44, 0x61, 0x49, 0xFB, 0x23, 0x71, 0x8C, 0xCB, 0xA1, 0x60, 0x27, 0xA2, 0x82, 0x70, 0x6C, 0xFD, 0x64, 0x69, 0x65, 0x71, 0xC3, 0x48, 0x04, 0x51, 0x4A, 0xF4, 0x83, 0x68, 0x24, 0x49, 0x65, 0x59, 0x45, 0x59, 0xFF, 0xFF, 0xC4, 0x50,
+    0x25, 0x51, 0x65, 0x61, 0x25, 0x59, 0xFF, 0xFF, 0xA7, 0x61, 0x45, 0x49, 0xE4, 0x38, 0xC8, 0x71, 0xFE, 0xFF, 0xA7, 0x69, 0xC7, 0x61, 0xA7, 0x61, 0x0D, 0xA3, 0xFF, 0xFF, 0xA7, 0x71, 0xE8, 0x71, 0x25, 0x51, 0xCC, 0x9A, 0xF6, 0xFF, 0xA7, 0x69, 0xE4, 0x48, 0x46, 0x51, 0xAB, 0xA2, 0x8C, 0xFA, 0xA8, 0x69, 0x04, 0x49, 0x6E, 0xB3, 0xC8, 0x69, 0xAB, 0xA2, 0xED, 0xDA, 0x05, 0x49, 0x2F, 0xE3,
+    0x6E, 0xE3, 0xA3, 0x48, 0xAB, 0xFA, 0x25, 0x59, 0x44, 0x71, 0x8C, 0xFB, 0x26, 0x59, 0x4E, 0xFC, 0x69, 0x9A, 0x66, 0x51, 0xFC, 0xFF, 0x86, 0x59, 0x29, 0xFA, 0xC7, 0x59, 0xA6, 0x51, 0xC8, 0x59, 0x03, 0x41, 0x03, 0x41, 0x23, 0x49, 0x24, 0x51, 0x03, 0x49, 0xE2, 0x48, 0x23, 0x51, 0x03, 0x49, 0x24, 0x51, 0x03, 0x49, 0x64, 0x59, 0x03, 0x49, 0x44, 0x59, 0x44, 0x59, 0x23, 0x51, 0x03, 0x49,
+    0x03, 0x49, 0x23, 0x59, 0x03, 0x51, 0x03, 0x51, 0x03, 0x51, 0x24, 0x51, 0x03, 0x49, 0x24, 0x51, 0x45, 0x51, 0x04, 0x51, 0x24, 0x51, 0xE3, 0x48, 0x45, 0x51, 0x65, 0x59, 0x65, 0x59, 0x04, 0x51, 0x24, 0x51, 0x45, 0x51, 0x24, 0x51, 0x66, 0x61, 0x65, 0x51, 0x24, 0x49, 0xE4, 0x38, 0x65, 0x51, 0x45, 0x59, 0x25, 0x51, 0x04, 0x49, 0x66, 0x59, 0x46, 0x59, 0x25, 0x51, 0x25, 0x51, 0x65, 0x59,
+    0x65, 0x59, 0xE3, 0x40, 0x25, 0x51, 0x04, 0x49, 0x25, 0x51, 0x45, 0x59, 0x25, 0x59, 0x25, 0x51, 0x25, 0x51, 0x05, 0x49, 0x05, 0x49, 0x25, 0x49, 0x25, 0x49, 0x04, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x49, 0x45, 0x51, 0x45, 0x51, 0x45, 0x51, 0x66, 0x59, 0x86, 0x59, 0x05, 0x49, 0x86, 0x59, 0x86, 0x59, 0x46, 0x51, 0x86, 0x59, 0xA6, 0x59, 0xA7, 0x59, 0xA7, 0x59, 0xA7, 0x59, 0xC7, 0x59,
+    0xA2, 0x78, 0x84, 0x79, 0x23, 0x59, 0xA1, 0x60, 0xE8, 0xF2, 0x04, 0x82, 0x0B, 0xBB, 0xA9, 0xFB, 0x21, 0x69, 0x02, 0x51, 0x62, 0x91, 0xA0, 0x58, 0xA8, 0xA2, 0x23, 0x71, 0x24, 0x59, 0x23, 0x69, 0x2A, 0xFC, 0x44, 0x69, 0xA1, 0x60, 0x11, 0xFE, 0x68, 0x8A, 0xA4, 0x79, 0xA1, 0x78, 0x03, 0x49, 0xE2, 0x80, 0x22, 0x81, 0xE3, 0x48, 0x65, 0x99, 0x26, 0x92, 0x06, 0x7A, 0x07, 0xD2, 0xC2, 0x50,
+    0xA5, 0x71, 0x4D, 0xEC, 0x44, 0x61, 0xA5, 0x71, 0xFE, 0xFF, 0x24, 0x49, 0x25, 0x49, 0xFC, 0xFF, 0x85, 0x59, 0xA6, 0x69, 0xCD, 0xBC, 0x44, 0x61, 0x25, 0x59, 0x4D, 0xE4, 0x04, 0x51, 0x03, 0x71, 0x2F, 0xED, 0x04, 0x51, 0x03, 0xC1, 0x08, 0xCA, 0x04, 0x59, 0xE5, 0xC1, 0x0A, 0xEB, 0x05, 0x61, 0xEC, 0xE3, 0x46, 0xA9, 0x24, 0xA1, 0xE7, 0xE2, 0x82, 0x60, 0x25, 0x59, 0x45, 0xB9, 0x24, 0x61,
+    0x23, 0x71, 0x24, 0x69, 0x08, 0x92, 0x24, 0x61, 0x44, 0x61, 0x86, 0x61, 0x45, 0x61, 0xA7, 0x69, 0x66, 0x69, 0x29, 0xAA, 0xA7, 0x91, 0x86, 0x61, 0xA7, 0x69, 0x69, 0xC2, 0xA6, 0x61, 0xC7, 0x61, 0x22, 0x79, 0x43, 0x59, 0xC4, 0xCA, 0x42, 0x89, 0x48, 0xA3, 0x43, 0x61, 0x44, 0x82, 0x84, 0x61, 0x63, 0x69, 0x2A, 0xB4, 0xFF, 0xFF, 0xFE, 0xFF, 0x83, 0x79, 0xC9, 0xC3, 0x27, 0xA3, 0x01, 0x59,
+    0xC1, 0x60, 0xE5, 0xB9, 0xF6, 0xFF, 0xE3, 0x60, 0xE2, 0x78, 0xEE, 0xFD, 0x03, 0x79, 0xE4, 0x50, 0x28, 0xC2, 0x86, 0xB1, 0x24, 0x51, 0xE3, 0x48, 0xEA, 0xFA, 0x24, 0x81, 0x04, 0x51, 0x24, 0x59, 0x2D, 0xEB, 0x24, 0x61, 0x24, 0x59, 0x28, 0x82, 0xCF, 0xF3, 0x24, 0x49, 0x24, 0x49, 0xCC, 0x9A, 0x24, 0x59, 0x44, 0x59, 0x04, 0x49, 0xB1, 0xDB, 0x04, 0x51, 0x25, 0x59, 0xC7, 0x69, 0x08, 0x7A,
+    0xE4, 0x50, 0x05, 0x49, 0x24, 0x61, 0x29, 0x8A, 0x25, 0x49, 0x45, 0x59, 0x08, 0x82, 0xC4, 0x48, 0xE4, 0x50, 0x2A, 0xDA, 0x06, 0x71, 0x04, 0x51, 0xC4, 0x48, 0xC7, 0x91, 0xC8, 0x81, 0xC4, 0x48, 0xA8, 0x69, 0x49, 0xCA, 0xE7, 0x91, 0x25, 0x59, 0x45, 0x61, 0x45, 0x59, 0x86, 0x61, 0xAD, 0xE4, 0xA8, 0xDA, 0x86, 0x61, 0x86, 0x59, 0xC7, 0xA9, 0xA7, 0x69, 0x09, 0xA2, 0xA7, 0x59, 0xC7, 0x69,
+    0xC2, 0x48, 0x50, 0xFE, 0xE1, 0x40, 0xA6, 0xCA, 0x02, 0x61, 0xA7, 0xCA, 0x92, 0xED, 0x21, 0x71, 0x68, 0xBA, 0xFE, 0xFF, 0xE2, 0x60, 0x02, 0x61, 0xEC, 0xFC, 0x69, 0xDB, 0xA4, 0x89, 0x80, 0x58, 0xA2, 0x58, 0x4B, 0xEC, 0x48, 0xFB, 0x65, 0x89, 0xE3, 0x58, 0xC2, 0x60, 0x24, 0x81, 0xE7, 0xE9, 0x04, 0x59, 0x03, 0x51, 0xA6, 0xF1, 0x49, 0x9A, 0x03, 0x51, 0x04, 0x51, 0xE3, 0x58, 0xEC, 0xCA,
+    0x23, 0x59, 0x45, 0x59, 0x86, 0x69, 0xA7, 0xE1, 0x03, 0x51, 0xE3, 0x40, 0x24, 0x49, 0xE8, 0x71, 0xE8, 0xA9, 0x24, 0x59, 0xC3, 0x40, 0x65, 0x59, 0x12, 0xC4, 0x24, 0x51, 0x45, 0x59, 0x45, 0x59, 0x6A, 0x9A, 0xA8, 0x79, 0x25, 0x51, 0xA3, 0x40, 0x25, 0x51, 0x0A, 0x82, 0xE4, 0x50, 0x04, 0x49, 0x04, 0x49, 0x09, 0x72, 0x09, 0x92, 0x05, 0x41, 0x05, 0x41, 0xC8, 0x61, 0x8B, 0x92, 0xAC, 0xCA,
+    0x04, 0x49, 0xA2, 0x58, 0x04, 0xA1, 0xAB, 0xAA, 0x46, 0x59, 0xE5, 0x70, 0x48, 0xC2, 0x65, 0x71, 0xDE, 0xFF, 0x86, 0x61, 0x28, 0x92, 0x66, 0x59, 0x29, 0xFB, 0xA7, 0x61, 0x0A, 0xE3, 0x66, 0x59, 0xA1, 0x58, 0x45, 0xE1, 0xA2, 0x48, 0x24, 0x71, 0xFF, 0xFF, 0xC1, 0x60, 0x8A, 0xC3, 0x04, 0xA1, 0xE2, 0x50, 0x4C, 0xFD, 0x23, 0x81, 0x40, 0x60, 0x81, 0x88, 0xA5, 0x89, 0x08, 0xFB, 0xC6, 0xA9,
+    0x07, 0xE2, 0xE2, 0x58, 0x64, 0x71, 0x86, 0x91, 0xC7, 0xFA, 0x03, 0x69, 0x66, 0xD1, 0xE3, 0x48, 0x24, 0x71, 0x69, 0xFB, 0xE3, 0x50, 0x45, 0x79, 0x03, 0x59, 0x44, 0x61, 0xD1, 0xFF, 0xE3, 0x50, 0x65, 0x69, 0x66, 0xC2, 0x45, 0x61, 0x52, 0xFF, 0xFE, 0xFF, 0xA2, 0x38, 0x24, 0x49, 0x6F, 0xC4, 0x51, 0xFF, 0xA6, 0x71, 0x29, 0xA4, 0x04, 0x51, 0x04, 0x59, 0xD2, 0xFF, 0x24, 0x59, 0x04, 0x51,
+    0x0A, 0xDB, 0x25, 0x51, 0x2A, 0xFB, 0xE7, 0x99, 0x04, 0x51, 0x04, 0x51, 0xA7, 0x91, 0xE9, 0xA9, 0x03, 0x81, 0x04, 0x71, 0xE4, 0x50, 0x46, 0x61, 0xE8, 0x89, 0x04, 0x51, 0x04, 0x49, 0xE3, 0x58, 0xE4, 0x70, 0x69, 0x92, 0x69, 0xB2, 0x25, 0x51, 0x25, 0x59, 0xA3, 0x58, 0x08, 0x82, 0x2A, 0xE2, 0x66, 0x61, 0x46, 0x61, 0x82, 0x60, 0x45, 0x61, 0xEA, 0xFA, 0xA7, 0x71, 0xA6, 0x51, 0x86, 0x59,
+    0xA2, 0x40, 0xC7, 0xFA, 0xC2, 0x48, 0xA1, 0x48, 0xC2, 0x50, 0x23, 0x61, 0x60, 0x50, 0x64, 0x61, 0x25, 0xBB, 0x89, 0xAB, 0x02, 0x51, 0x64, 0x69, 0xB3, 0xFF, 0x51, 0xEE, 0x64, 0x69, 0xE2, 0x78, 0xC2, 0x60, 0x03, 0x61, 0x64, 0x69, 0xFC, 0xFF, 0xE2, 0x58, 0xE3, 0x58, 0x29, 0x92, 0xC7, 0xA9, 0x24, 0x59, 0x23, 0x51, 0xC7, 0xC1, 0xE3, 0x48, 0x03, 0x51, 0x07, 0xAA, 0xE4, 0x50, 0x04, 0x51,
+    0x24, 0x59, 0xA6, 0x71, 0x04, 0x59, 0x48, 0x82, 0xCC, 0xF3, 0xA2, 0x38, 0x04, 0x49, 0xE5, 0x99, 0xE3, 0x58, 0x24, 0x59, 0xC3, 0x48, 0x2C, 0xD3, 0x03, 0x51, 0x04, 0x51, 0x8A, 0xFA, 0x04, 0x51, 0xE4, 0x48, 0x86, 0x71, 0x05, 0x59, 0x04, 0x49, 0xE4, 0x48, 0x65, 0x69, 0x04, 0x49, 0x05, 0x49, 0x4B, 0xFB, 0xA3, 0x58, 0xE4, 0x40, 0x04, 0x49, 0x04, 0x51, 0x04, 0x49, 0xC4, 0x40, 0x87, 0x69,
+    0xC4, 0x40, 0xE4, 0x40, 0x05, 0x49, 0x25, 0x59, 0x45, 0x51, 0xE4, 0x48, 0x45, 0x51, 0xE7, 0x71, 0x66, 0x59, 0x45, 0x51, 0x6A, 0x92, 0x66, 0x59, 0x66, 0x51, 0x66, 0x51, 0x86, 0x51, 0x86, 0x51, 0xE2, 0x50, 0x64, 0x69, 0x01, 0x59, 0xE1, 0x50, 0xE3, 0x91, 0x03, 0x51, 0xA1, 0x50, 0x68, 0x92, 0x43, 0x71, 0xB5, 0xF6, 0xE3, 0x81, 0x88, 0xAA, 0x88, 0xAA, 0x76, 0xFF, 0x23, 0x69, 0x03, 0x61,
+    0x44, 0x81, 0xC2, 0x78, 0x24, 0x69, 0x03, 0x59, 0x89, 0xAA, 0xC2, 0x68, 0xC3, 0x50, 0xE3, 0x48, 0x07, 0x8A, 0x23, 0x51, 0x24, 0x59, 0xC3, 0x48, 0xC7, 0x81, 0x24, 0x59, 0xC3, 0x48, 0x03, 0x59, 0x89, 0xDA, 0x24, 0x61, 0x03, 0x59, 0x04, 0x59, 0x82, 0x68, 0xA2, 0x40, 0x04, 0x49, 0x03, 0xA1, 0xC2, 0x50, 0x04, 0x59, 0xA2, 0x50, 0xAA, 0xB2, 0x04, 0x59, 0x24, 0x59, 0x24, 0x59, 0x49, 0x92,
+    0xC3, 0x48, 0x04, 0x51, 0x04, 0x59, 0x69, 0x92, 0x25, 0x59, 0x04, 0x51, 0xE4, 0x48, 0xA7, 0x69, 0x04, 0x49, 0x04, 0x49, 0xC4, 0x50, 0x25, 0x59, 0xC3, 0x40, 0xC4, 0x48, 0xC7, 0x89, 0x04, 0x61, 0xC4, 0x40, 0x85, 0x71, 0xCE, 0xDC, 0xE4, 0x58, 0x25, 0x51, 0xE4, 0x48, 0x25, 0x59, 0x2C, 0xF3, 0x45, 0x59, 0x65, 0x61, 0x45, 0x51, 0x67, 0xB1, 0x66, 0x61, 0x66, 0x59, 0x87, 0x59, 0x86, 0x59,
+    0xC2, 0x48, 0xC7, 0xE2, 0xC2, 0x48, 0xC2, 0x50, 0xC2, 0x50, 0xC1, 0x68, 0xCB, 0xFB, 0xA1, 0x58, 0xE2, 0x58, 0x81, 0x90, 0xC3, 0x60, 0xA9, 0xBA, 0x46, 0xE9, 0xE3, 0x68, 0xA1, 0x70, 0xAA, 0xFB, 0x81, 0x68, 0xC2, 0x58, 0x89, 0xBA, 0xA5, 0xB1, 0x44, 0x61, 0xA3, 0x58, 0xC3, 0x50, 0xC7, 0x81, 0x44, 0x69, 0xC3, 0x50, 0x23, 0x51, 0x69, 0x9A, 0xE3, 0x50, 0xC2, 0x50, 0x61, 0x58, 0xA6, 0x79,
+    0xA2, 0x48, 0xA2, 0xA0, 0x04, 0x59, 0xE7, 0xA9, 0x55, 0xEE, 0xE3, 0x48, 0xE4, 0x50, 0x06, 0xC3, 0xAB, 0xA2, 0x24, 0x59, 0x03, 0xA2, 0x04, 0x51, 0xA8, 0x81, 0x05, 0x69, 0x03, 0x51, 0x04, 0x51, 0xCA, 0x9A, 0xE3, 0x48, 0x25, 0x51, 0xE4, 0x60, 0x28, 0x82, 0x04, 0x51, 0x86, 0x81, 0xE4, 0x48, 0x29, 0x8A, 0x48, 0x9A, 0xE4, 0x48, 0x04, 0x49, 0xC7, 0x89, 0xE4, 0x48, 0xE4, 0x48, 0xAA, 0xB2,
+    0x62, 0x48, 0x25, 0x59, 0x63, 0x78, 0x45, 0x59, 0x45, 0x59, 0x81, 0x98, 0x29, 0x9A, 0x45, 0x59, 0x45, 0x51, 0x45, 0x59, 0x41, 0x70, 0x04, 0x59, 0x45, 0x69, 0x66, 0x59, 0x09, 0xE2, 0x65, 0x59, 0x81, 0x40, 0x82, 0x58, 0xC2, 0x48, 0xEF, 0xFE, 0x03, 0x59, 0xE3, 0x60, 0x0D, 0xED, 0xC2, 0x60, 0xC4, 0xB1, 0x42, 0x91, 0xE3, 0x60, 0x05, 0xAA, 0x6C, 0xFD, 0xE8, 0xE3, 0xC1, 0x68, 0x03, 0x69,
+    0xC2, 0x80, 0x86, 0xE1, 0xE3, 0x58, 0x43, 0x81, 0x83, 0x89, 0xA6, 0xA1, 0x23, 0x69, 0x2F, 0xFE, 0x44, 0x61, 0xC2, 0x48, 0x0A, 0xAB, 0xC2, 0x48, 0xC2, 0x50, 0xE3, 0x50, 0xC4, 0x78, 0x45, 0x71, 0xE3, 0x50, 0x03, 0xA1, 0xE3, 0x50, 0x25, 0xE1, 0x88, 0xCA, 0xE3, 0x48, 0xE3, 0x48, 0xB3, 0xFE, 0xC8, 0xCA, 0x61, 0x48, 0xA3, 0x48, 0x03, 0x51, 0x24, 0x71, 0xE4, 0x58, 0xA2, 0x68, 0x24, 0x51,
+    0x82, 0x40, 0xCB, 0xA2, 0x24, 0x51, 0x04, 0x51, 0xC7, 0xB9, 0xA3, 0x50, 0xC8, 0x89, 0xC4, 0x40, 0xA7, 0x71, 0xC3, 0x40, 0x08, 0x7A, 0x49, 0x92, 0xC3, 0x40, 0xE3, 0x40, 0xA7, 0x89, 0x08, 0x7A, 0x45, 0x61, 0x04, 0x49, 0x25, 0x59, 0x07, 0xBA, 0x86, 0x69, 0x42, 0x68, 0x25, 0x59, 0xC4, 0x48, 0xE6, 0xE9, 0xE7, 0x91, 0xA3, 0x50, 0x45, 0x51, 0x86, 0x61, 0x86, 0x61, 0x66, 0x79, 0x86, 0x61,
+    0x0E, 0xFD, 0x40, 0x38, 0x81, 0x50, 0x84, 0xA1, 0xF5, 0xFF, 0xE2, 0x80, 0x21, 0x79, 0xED, 0xFD, 0xE2, 0x60, 0xE5, 0xE1, 0xC8, 0xE2, 0x05, 0xC2, 0xC2, 0x58, 0xE3, 0x58, 0xC5, 0xA9, 0x64, 0x99, 0xC2, 0x50, 0x03, 0x69, 0xE1, 0x98, 0x03, 0x69, 0x45, 0xF9, 0xA0, 0x58, 0x6A, 0xFA, 0xE3, 0x50, 0xE3, 0x58, 0xA6, 0xF9, 0xE3, 0x50, 0xE3, 0x48, 0x87, 0xB9, 0x65, 0x69, 0x0C, 0xFD, 0x45, 0x99,
+    0xAB, 0xFA, 0x24, 0x69, 0xE3, 0x58, 0x6A, 0xFB, 0x47, 0xDA, 0xC3, 0x50, 0x04, 0x51, 0x16, 0xF6, 0x29, 0xFB, 0x45, 0x69, 0xA1, 0x80, 0xC9, 0xFA, 0x04, 0x69, 0x4B, 0xFC, 0x04, 0x59, 0x4D, 0xF5, 0xA2, 0x48, 0xE3, 0x48, 0xE8, 0xB9, 0x65, 0x61, 0x04, 0x51, 0xE3, 0x60, 0x86, 0x79, 0xA7, 0x69, 0x25, 0x61, 0x4A, 0xD2, 0x00, 0xA0, 0xE4, 0x48, 0xEC, 0x9A, 0x04, 0x69, 0xC3, 0x48, 0x05, 0x51,
+    0x04, 0x59, 0x66, 0x71, 0xA6, 0x79, 0x45, 0x79, 0x25, 0x59, 0xC3, 0x48, 0xC7, 0x89, 0xC7, 0xA9, 0x40, 0x58, 0x04, 0x71, 0x03, 0x51, 0xE7, 0x81, 0xC8, 0xF1, 0x66, 0x59, 0x66, 0x59, 0x25, 0x61, 0xA1, 0x40, 0x23, 0x59, 0xC2, 0x48, 0xE3, 0x58, 0xE1, 0x58, 0xC2, 0x58, 0xC3, 0x70, 0xC2, 0x50, 0xA4, 0x99, 0x73, 0xFF, 0x24, 0x69, 0xA1, 0x50, 0x06, 0xAA, 0x40, 0x78, 0x44, 0x69, 0xE3, 0x60,
+    0x61, 0x60, 0xC1, 0x60, 0x01, 0x71, 0x03, 0x61, 0x68, 0xAA, 0x03, 0x61, 0xE3, 0x50, 0xC2, 0x48, 0x07, 0x8A, 0xC2, 0x48, 0xC2, 0x50, 0x03, 0x61, 0x68, 0x9A, 0xE3, 0x50, 0xA2, 0x70, 0x24, 0x59, 0xA6, 0x99, 0x85, 0xD1, 0xE3, 0x58, 0xE3, 0x60, 0xFA, 0xFF, 0xA3, 0x48, 0xE3, 0x50, 0x8A, 0xEB, 0x82, 0x58, 0xE3, 0x58, 0x6A, 0xCB, 0xE3, 0x58, 0x24, 0x59, 0xA3, 0x70, 0x04, 0x51, 0xA7, 0x89,
+    0xE3, 0x58, 0x03, 0x51, 0x04, 0x49, 0x07, 0x8A, 0x24, 0x51, 0xE4, 0x48, 0xE3, 0x68, 0xC2, 0x50, 0x65, 0x59, 0x65, 0x69, 0xC3, 0x40, 0xE3, 0x50, 0x07, 0x7A, 0xE4, 0x48, 0x87, 0x79, 0x27, 0x8A, 0x45, 0x59, 0x04, 0x49, 0x0B, 0xF3, 0xC7, 0x91, 0x04, 0x49, 0x03, 0x49, 0x45, 0x59, 0xC3, 0x50, 0x04, 0x51, 0x66, 0x59, 0x66, 0x59, 0x45, 0x61, 0x05, 0x71, 0x65, 0x51, 0x45, 0x51, 0x66, 0x59,
+    0xC2, 0x48, 0xE3, 0x88, 0x23, 0x59, 0x03, 0x59, 0x81, 0x68, 0xC2, 0x50, 0x00, 0x81, 0xE5, 0xA1, 0xA2, 0x50, 0xA2, 0x50, 0x40, 0x70, 0xA4, 0xA1, 0x23, 0x61, 0xE2, 0x68, 0xC2, 0x90, 0x27, 0xFA, 0x01, 0x69, 0x04, 0xBA, 0xC2, 0x58, 0xC6, 0x89, 0xE7, 0xD2, 0x23, 0x69, 0x24, 0x61, 0xE7, 0x81, 0xA5, 0x79, 0xC2, 0x50, 0x03, 0x81, 0x07, 0x82, 0x44, 0x61, 0xE3, 0x50, 0x81, 0x60, 0xE7, 0x91,
+    0x03, 0x61, 0xC6, 0xD9, 0xE3, 0x58, 0xC3, 0x60, 0xF9, 0xFF, 0xC3, 0x50, 0xE3, 0x50, 0xA9, 0xDB, 0xC2, 0x58, 0x03, 0x59, 0x03, 0x59, 0xC3, 0x58, 0x8A, 0xBA, 0x04, 0x51, 0x03, 0x51, 0xE3, 0x50, 0x69, 0x92, 0x27, 0xC2, 0x03, 0x51, 0x24, 0x51, 0x07, 0x7A, 0x03, 0x49, 0x03, 0x49, 0x04, 0x61, 0xE7, 0x79, 0xC3, 0x48, 0xC3, 0x48, 0xE3, 0x48, 0xE7, 0x79, 0xA5, 0x61, 0xB0, 0xE5, 0xE3, 0x40,
+    0xAA, 0x9A, 0x48, 0x7A, 0x83, 0x61, 0x25, 0x59, 0xE3, 0x50, 0xE9, 0xF2, 0x45, 0x59, 0xE3, 0x48, 0x45, 0x59, 0x45, 0x59, 0xA7, 0xA9, 0x65, 0x59, 0x65, 0x69, 0x45, 0x59, 0x25, 0x81, 0x65, 0x59, 0xA1, 0x50, 0x03, 0x69, 0xA2, 0x48, 0x80, 0x58, 0xC1, 0x50, 0xA4, 0x99, 0xA1, 0x50, 0xA1, 0x58, 0x85, 0xB9, 0xA9, 0xFA, 0xA1, 0x60, 0xA7, 0xE9, 0x67, 0xBA, 0xC2, 0x58, 0xC2, 0x60, 0x86, 0xAA,
+    0xE7, 0xA2, 0xA6, 0xC1, 0xE6, 0xB9, 0xC6, 0xBA, 0x20, 0x70, 0xA5, 0x79, 0x27, 0x9A, 0xC2, 0x50, 0x23, 0x69, 0x64, 0xA9, 0xA6, 0x81, 0x23, 0x51, 0xE3, 0x58, 0xCD, 0xFC, 0xC2, 0x50, 0xE7, 0xA9, 0xE3, 0x68, 0x61, 0x58, 0x04, 0x61, 0xE8, 0xE1, 0xDB, 0xFF, 0xE3, 0x58, 0x04, 0x51, 0x2E, 0xEC, 0xE7, 0xB1, 0x04, 0x69, 0xA3, 0x90, 0xEA, 0xE3, 0x48, 0xAA, 0xE3, 0x68, 0xC3, 0x70, 0x23, 0x81,
+    0x07, 0x7A, 0xE6, 0x81, 0xE2, 0xA0, 0x03, 0x59, 0x85, 0x61, 0x07, 0x8A, 0xC2, 0x48, 0x04, 0x51, 0x46, 0xBA, 0x69, 0xA2, 0xCB, 0xB2, 0xC2, 0x50, 0x44, 0x61, 0x24, 0x51, 0xE3, 0x50, 0xE2, 0x40, 0x23, 0x59, 0xA3, 0x58, 0xA7, 0x91, 0x08, 0x8A, 0x03, 0x59, 0x45, 0x59, 0x23, 0x91, 0x44, 0x79, 0x03, 0x91, 0x04, 0x59, 0x2C, 0xDB, 0x66, 0x69, 0x45, 0x71, 0x25, 0x79, 0x44, 0x59, 0x65, 0x71,
+    0xC2, 0x48, 0x20, 0x98, 0x22, 0xA1, 0x81, 0x48, 0xA1, 0x48, 0xE3, 0x58, 0xA8, 0xFA, 0x24, 0x71, 0x81, 0x50, 0x43, 0x99, 0x07, 0xB2, 0x8F, 0xFE, 0x23, 0x79, 0xC2, 0x60, 0xFD, 0xFF, 0x64, 0x81, 0xE7, 0xF9, 0x44, 0x79, 0xC7, 0xD2, 0x44, 0x79, 0xA1, 0x50, 0xC6, 0xF9, 0xC2, 0x50, 0x85, 0x69, 0x44, 0x89, 0x8A, 0xC2, 0x27, 0xCA, 0xE4, 0xB0, 0x23, 0x79, 0xA2, 0x50, 0xE3, 0x90, 0x65, 0x71,
+    0x86, 0xB1, 0xC7, 0xF1, 0xA2, 0x50, 0x26, 0xEA, 0xEA, 0xFC, 0xC3, 0x50, 0xE3, 0x50, 0x47, 0xD2, 0xE4, 0xF0, 0xE2, 0x58, 0x07, 0xEA, 0x31, 0xF5, 0xC2, 0x50, 0x82, 0x80, 0x44, 0x61, 0x88, 0xCA, 0xCB, 0xAA, 0x68, 0xA2, 0x61, 0x70, 0x84, 0xB9, 0x64, 0x61, 0x44, 0x59, 0xA6, 0x71, 0xE3, 0x48, 0x04, 0x51, 0x83, 0x71, 0x07, 0x72, 0xE7, 0x71, 0xA3, 0x48, 0xE3, 0xC0, 0x04, 0x49, 0x06, 0x62,
+    0xA7, 0x81, 0x8C, 0xFB, 0x04, 0x51, 0x2C, 0xCC, 0xA7, 0x81, 0xE9, 0xF9, 0x43, 0x61, 0x45, 0x59, 0x45, 0x59, 0xA8, 0xB1, 0x05, 0x61, 0x45, 0x51, 0x65, 0x59, 0xC8, 0xC1, 0x46, 0x59, 0x67, 0xF1, 0xA4, 0xB1, 0x20, 0x70, 0xC2, 0x48, 0x81, 0x80, 0x25, 0xF2, 0x84, 0xB9, 0xA2, 0x60, 0xF1, 0xFE, 0xE5, 0xD1, 0xC3, 0x78, 0xA4, 0xA1, 0x03, 0x61, 0x41, 0xB0, 0xC2, 0x60, 0x46, 0xD2, 0xA4, 0xB1,
+    0x68, 0xD2, 0x63, 0x99, 0x44, 0x69, 0xA1, 0x50, 0x06, 0xFA, 0x43, 0x61, 0x02, 0x59, 0xC6, 0xB1, 0x47, 0x9A, 0x85, 0xF9, 0xE3, 0x68, 0x43, 0x61, 0xE6, 0x99, 0x65, 0x69, 0x8D, 0xFD, 0x85, 0x81, 0x68, 0xC2, 0x81, 0x80, 0xA2, 0x58, 0xE8, 0xFA, 0xC7, 0xE2, 0xE3, 0x58, 0xE3, 0x50, 0x65, 0xA9, 0xA6, 0xF9, 0x85, 0x79, 0xC2, 0x58, 0xC3, 0x78, 0x04, 0x69, 0xC8, 0xD9, 0x44, 0x69, 0x68, 0xC2,
+    0x65, 0x71, 0xE3, 0x58, 0xC7, 0x79, 0x45, 0x89, 0xE6, 0x91, 0x03, 0x51, 0x65, 0x61, 0xC7, 0x71, 0x48, 0x7A, 0x24, 0x51, 0x84, 0x59, 0x03, 0x51, 0x8A, 0x9A, 0x45, 0x51, 0xE3, 0x48, 0xE7, 0x89, 0xE4, 0x48, 0xC7, 0x79, 0xC6, 0x61, 0xA7, 0xA9, 0xE3, 0x48, 0xE7, 0x69, 0xA7, 0x89, 0xC4, 0x60, 0x86, 0x91, 0x45, 0x59, 0x45, 0x59, 0xA7, 0x89, 0x83, 0x78, 0x45, 0x51, 0x44, 0x51, 0x65, 0x59,
+    0xC2, 0x48, 0xC2, 0x50, 0xE3, 0x58, 0xE3, 0x50, 0x03, 0x59, 0xFA, 0xFF, 0x03, 0x59, 0x44, 0x91, 0xA6, 0xCA, 0xE3, 0x58, 0xE2, 0xA0, 0x27, 0xE2, 0x22, 0x81, 0xE3, 0xC8, 0xC2, 0x58, 0x64, 0xC1, 0x5A, 0xFF, 0x85, 0x79, 0xC6, 0x79, 0xE6, 0xC1, 0x22, 0x61, 0x44, 0x69, 0x08, 0xF3, 0xA6, 0x99, 0xC2, 0x58, 0x28, 0xFA, 0xF9, 0xFF, 0x24, 0x71, 0xA7, 0xA9, 0xC9, 0xFA, 0x03, 0x69, 0xE3, 0x80,
+    0x03, 0x71, 0xA1, 0x58, 0x03, 0x61, 0xE3, 0x70, 0xF6, 0xFF, 0xC2, 0x50, 0x03, 0x51, 0xD9, 0xFF, 0xA1, 0x68, 0x24, 0x69, 0x8B, 0xE3, 0xA1, 0x60, 0xCC, 0xFB, 0x24, 0x99, 0x82, 0xB8, 0x24, 0x61, 0x2B, 0xFC, 0x47, 0xCA, 0x22, 0x81, 0x64, 0x69, 0x6A, 0xFA, 0xFC, 0xFF, 0x44, 0x59, 0x44, 0x59, 0x07, 0x82, 0x64, 0x59, 0x45, 0x59, 0x44, 0x69, 0xE3, 0x50, 0x44, 0x51, 0x23, 0x81, 0xE2, 0x49,
+    0xC6, 0x79, 0xF8, 0xFF, 0x24, 0x49, 0xF3, 0xFE, 0x65, 0x79, 0x65, 0x59, 0x85, 0x59, 0xA7, 0xEA, 0x65, 0x59, 0xA6, 0x61, 0xA6, 0x79, 0x45, 0x59, 0x45, 0x59, 0x88, 0xB2, 0xA6, 0x69, 0x24, 0x59, 0xA2, 0x79, 0xC2, 0x40, 0xE2, 0x48, 0xC6, 0x81, 0xE3, 0x50, 0x87, 0xFA, 0x80, 0x58, 0x2F, 0xFE, 0x07, 0x8A, 0x66, 0xF1, 0xE2, 0x68, 0xA1, 0x70, 0x81, 0x60, 0xA1, 0x48, 0x02, 0xA1, 0x21, 0x81,
+    0x03, 0x61, 0x44, 0x71, 0xA6, 0xE1, 0x03, 0x69, 0x23, 0x61, 0xA0, 0x98, 0xE8, 0xD2, 0x86, 0x71, 0x8C, 0xEB, 0x27, 0xBA, 0xC2, 0x58, 0x24, 0xC1, 0x24, 0x61, 0xA2, 0x60, 0x85, 0x89, 0xC7, 0xD1, 0x49, 0xD3, 0xA5, 0x89, 0x03, 0x61, 0x81, 0x68, 0x88, 0xFA, 0xC3, 0x50, 0x04, 0x51, 0x29, 0xF3, 0x8C, 0xFB, 0x64, 0x71, 0xEB, 0xF2, 0xF8, 0xFE, 0x6D, 0xFD, 0x29, 0xFA, 0x06, 0x82, 0x47, 0x82,
+    0x0C, 0xFB, 0x03, 0x51, 0x09, 0xDB, 0x51, 0xF6, 0x44, 0x61, 0x44, 0x81, 0xFD, 0xFF, 0xA6, 0x69, 0xA6, 0x69, 0xE7, 0x79, 0x25, 0x59, 0x87, 0x61, 0x0F, 0x51, 0xEF, 0xD3, 0xE4, 0x40, 0x25, 0x49, 0xFF, 0xF7, 0x05, 0x49, 0x88, 0xD1, 0xBC, 0xC4, 0x85, 0x61, 0x65, 0x59, 0x11, 0xFF, 0x64, 0x59, 0x65, 0x61, 0xA5, 0x91, 0x03, 0x49, 0x85, 0x61, 0x86, 0xA1, 0x45, 0x51, 0x44, 0x59, 0x04, 0x61,
+    0xC2, 0x48, 0xC2, 0x78, 0xE2, 0x48, 0x44, 0xE9, 0x2A, 0xFC, 0x23, 0x61, 0x64, 0x69, 0x81, 0xB1, 0x27, 0xFA, 0x65, 0x79, 0xA1, 0x80, 0x81, 0x50, 0x61, 0x68, 0xA8, 0xFB, 0xAD, 0xFC, 0x23, 0x69, 0xE2, 0x58, 0x86, 0xF1, 0x84, 0x79, 0xC1, 0x58, 0x84, 0x91, 0x03, 0x91, 0xA5, 0x99, 0x02, 0x71, 0x23, 0x91, 0x24, 0x89, 0xC6, 0xA1, 0x03, 0x81, 0x87, 0xEA, 0xA6, 0x79, 0x85, 0xE9, 0x43, 0xC1,
+    0x12, 0xFF, 0x45, 0x81, 0x24, 0x71, 0x24, 0x89, 0x88, 0xE2, 0xE3, 0x58, 0x24, 0x59, 0xF4, 0xFF, 0xAA, 0xF2, 0x64, 0x71, 0xA2, 0x70, 0x37, 0xF7, 0xE2, 0x68, 0x48, 0x8A, 0xC6, 0x79, 0xFF, 0xFF, 0xA5, 0x71, 0x48, 0xBA, 0xAA, 0xFA, 0x7B, 0xFF, 0xA5, 0x91, 0x03, 0x71, 0x23, 0x61, 0xA7, 0xBA, 0x07, 0x7A, 0x04, 0x51, 0xE7, 0x79, 0x04, 0x49, 0x45, 0x51, 0x38, 0x54, 0x86, 0x79, 0x45, 0x59,
+    0x12, 0xFF, 0xDF, 0xFF, 0xE4, 0x90, 0x27, 0xE3, 0x7E, 0xBC, 0x66, 0x59, 0xA7, 0xC9, 0x6C, 0xAB, 0x09, 0xFA, 0xA6, 0x89, 0xE3, 0x50, 0x44, 0x59, 0xE2, 0x50, 0xC5, 0xC8, 0x08, 0xC2, 0x25, 0x61, 0xC2, 0x48, 0x86, 0xD1, 0xA5, 0x89, 0x20, 0x70, 0x23, 0x59, 0x23, 0x61, 0xE8, 0xFA, 0x60, 0x50, 0x41, 0xD8, 0xC1, 0x50, 0x23, 0x89, 0x68, 0xFB, 0x65, 0xF9, 0xC7, 0xFA, 0x81, 0x50, 0xC2, 0x58,
+    0xAC, 0xFD, 0x43, 0x71, 0xA5, 0x79, 0xE6, 0xAA, 0xA6, 0xE1, 0x45, 0xF1, 0x62, 0x91, 0xE2, 0x80, 0x68, 0xEA, 0x65, 0x91, 0x7A, 0xFF, 0xC6, 0x89, 0xA3, 0xB8, 0x82, 0x68, 0x04, 0x89, 0xA1, 0x60, 0x05, 0xDA, 0x61, 0x50, 0x03, 0x69, 0xA6, 0xF1, 0xC9, 0xFB, 0xE3, 0x50, 0x03, 0x51, 0x81, 0x98, 0xE7, 0xA9, 0x44, 0x71, 0xC6, 0x91, 0xA4, 0x91, 0x43, 0x61, 0x65, 0x79, 0x06, 0xCA, 0xE4, 0x79,
+    0x44, 0x69, 0x06, 0xBA, 0xE3, 0x68, 0x92, 0xE5, 0x88, 0x9A, 0xE2, 0x88, 0x07, 0x8A, 0xEA, 0xEA, 0x33, 0xEE, 0x44, 0x51, 0x03, 0x51, 0xC7, 0x79, 0x04, 0x49, 0x24, 0x49, 0x03, 0x51, 0xE7, 0xA1, 0x46, 0xF1, 0xB1, 0xE5, 0x23, 0x41, 0x41, 0x70, 0xC6, 0x81, 0xC9, 0xF1, 0xC8, 0x7A, 0x23, 0x71, 0x85, 0x81, 0x19, 0xFF, 0x03, 0x61, 0x04, 0x59, 0x03, 0x59, 0x12, 0xFF, 0x45, 0x59, 0xA8, 0xFB,
+    0x63, 0xB1, 0xC2, 0x50, 0xE2, 0x60, 0xA1, 0x48, 0xA5, 0xAA, 0xE4, 0xC1, 0xA2, 0x50, 0x43, 0x91, 0x60, 0x50, 0xC2, 0x60, 0x0A, 0xFC, 0x24, 0xC9, 0x60, 0x68, 0xC2, 0x58, 0x81, 0x50, 0x50, 0xFE, 0xE1, 0x70, 0x43, 0x69, 0xC4, 0xA9, 0x64, 0x89, 0xE9, 0xFB, 0x24, 0xB9, 0xFF, 0xFF, 0x81, 0x90, 0x27, 0xD2, 0xE9, 0xFB, 0x43, 0x79, 0x44, 0xA9, 0xE7, 0x89, 0xF9, 0xFF, 0x31, 0xFF, 0x44, 0x91,
+    0x86, 0xA1, 0x22, 0x69, 0xC2, 0x60, 0xA6, 0xF9, 0xFE, 0xFF, 0xC2, 0x48, 0xE3, 0x48, 0x64, 0xA9, 0xC7, 0xB9, 0x44, 0x69, 0x06, 0x72, 0xDE, 0xFF, 0xB6, 0xEE, 0xE6, 0x81, 0xDD, 0xFF, 0x86, 0x69, 0xDD, 0xFF, 0x03, 0x51, 0xC7, 0x81, 0x78, 0xFF, 0x72, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xE7, 0x79, 0xCC, 0xF3, 0xFF, 0xFF, 0xE4, 0x48, 0x65, 0x59, 0x08, 0xBA, 0xC3, 0x40, 0xE4, 0x48, 0xA6, 0x61,
+    0x46, 0x99, 0xC6, 0xC1, 0x04, 0x49, 0xAB, 0x48, 0x28, 0x9A, 0xC3, 0x48, 0x28, 0xEB, 0xC2, 0x48, 0x85, 0x69, 0x65, 0x69, 0x65, 0x59, 0x4F, 0xF6, 0xA2, 0x68, 0x65, 0x59, 0xA6, 0x71, 0xE7, 0xA1, 0xE2, 0x50, 0x61, 0x98, 0x84, 0x91, 0xE1, 0x58, 0x06, 0xEA, 0x44, 0xA1, 0x41, 0xD1, 0x43, 0x81, 0x61, 0x48, 0x60, 0x48, 0xC6, 0xA9, 0xE9, 0xCA, 0xA2, 0x50, 0x24, 0x61, 0xA4, 0x99, 0x44, 0x71,
+    0xA1, 0x40, 0xC2, 0x70, 0xE6, 0xE1, 0x44, 0x69, 0xA1, 0x60, 0xC1, 0xA8, 0xA2, 0x58, 0x03, 0x91, 0x64, 0xA9, 0xC5, 0xE2, 0x85, 0x81, 0xE8, 0xF9, 0xA6, 0x81, 0xC3, 0x68, 0x24, 0x89, 0xCC, 0xFD, 0x8F, 0xF5, 0x24, 0x69, 0xC3, 0x68, 0x35, 0xFF, 0xF5, 0xE5, 0x45, 0x59, 0xE3, 0x48, 0x87, 0x8A, 0x97, 0xFF, 0x03, 0x61, 0x24, 0x51, 0xFF, 0xFF, 0xFD, 0xFF, 0xE7, 0x71, 0x89, 0x59, 0xEB, 0x69,
+    0x8D, 0xE3, 0xE2, 0x50, 0xFF, 0xFF, 0xC5, 0x71, 0x07, 0x92, 0x60, 0x68, 0xFF, 0xFF, 0x82, 0x61, 0xC5, 0x69, 0x4C, 0xF4, 0x44, 0x61, 0x24, 0x51, 0x04, 0x49, 0xA6, 0x89, 0xA2, 0x40, 0x04, 0x49, 0xAA, 0x9A, 0x74, 0xB4, 0xE4, 0x48, 0x25, 0x51, 0x5E, 0xF7, 0x65, 0x61, 0x61, 0xA0, 0x2F, 0xCE, 0x65, 0x59, 0xC8, 0xF1, 0x24, 0x59, 0x65, 0x69, 0x65, 0x61, 0x86, 0x91, 0x24, 0x61, 0x44, 0x69,
+    0x40, 0x40, 0x00, 0x80, 0x81, 0x40, 0xAD, 0xEC, 0x03, 0x59, 0x63, 0x99, 0x43, 0x89, 0xA1, 0x40, 0x64, 0x89, 0xA0, 0x80, 0x02, 0x61, 0x03, 0x61, 0x27, 0x92, 0xE6, 0xE1, 0x84, 0x71, 0xC2, 0x58, 0x81, 0x48, 0x44, 0xE1, 0x80, 0x58, 0x85, 0x79, 0xB9, 0xFF, 0x03, 0x71, 0xA4, 0xB9, 0x03, 0x71, 0x85, 0x89, 0x03, 0x69, 0x88, 0xFA, 0x44, 0x81, 0x24, 0xE1, 0xA2, 0x58, 0xE2, 0x60, 0x0A, 0xFC,
+    0xDD, 0xFF, 0x60, 0x48, 0x03, 0x69, 0xE6, 0xE9, 0x44, 0x91, 0xC2, 0x48, 0x03, 0x51, 0x84, 0x79, 0x87, 0xEA, 0x48, 0x8A, 0x24, 0x59, 0x8A, 0x69, 0x4C, 0xE3, 0xC6, 0x79, 0xA8, 0x71, 0xFF, 0xFF, 0x87, 0x61, 0x89, 0xFA, 0x24, 0x61, 0xA8, 0x92, 0xC6, 0x91, 0xA9, 0xCA, 0xC2, 0x68, 0x64, 0x79, 0xE6, 0x79, 0xA2, 0x48, 0xE7, 0xB1, 0x63, 0x61, 0xE3, 0x40, 0xA2, 0x40, 0x47, 0x9A, 0x45, 0x59,
+    0xC3, 0x40, 0x04, 0x49, 0x29, 0xB2, 0xC7, 0xE1, 0x25, 0x49, 0xC2, 0x40, 0xE3, 0x50, 0x82, 0x80, 0xA6, 0x79, 0x64, 0x59, 0x65, 0x61, 0x24, 0x51, 0x45, 0x61, 0x2D, 0xFD, 0x65, 0x79, 0x45, 0x61, 0x81, 0x38, 0xA2, 0x40, 0x81, 0x40, 0xE4, 0x90, 0xE2, 0x58, 0x24, 0x72, 0xC2, 0x48, 0x89, 0x92, 0xA5, 0xE1, 0x24, 0x59, 0x23, 0x61, 0xE3, 0x60, 0x05, 0xF9, 0x24, 0x61, 0x03, 0x61, 0x03, 0x59,
+    0x45, 0xF9, 0xE2, 0x58, 0xA1, 0x50, 0x85, 0x79, 0x08, 0xFA, 0xC6, 0xB1, 0x61, 0x60, 0xE3, 0x68, 0x47, 0xFA, 0xC2, 0x68, 0x89, 0xD2, 0xE6, 0x81, 0xA3, 0xD1, 0x44, 0x99, 0xE3, 0x78, 0x44, 0x79, 0x6C, 0xF4, 0x60, 0x48, 0xC2, 0x68, 0x48, 0xDA, 0xC7, 0xDA, 0xE3, 0x50, 0xE3, 0x50, 0xC5, 0x99, 0xA9, 0xBA, 0x44, 0x69, 0xA6, 0x79, 0xE7, 0xBA, 0x47, 0x82, 0xC6, 0x79, 0x48, 0x92, 0x06, 0x72,
+    0xA6, 0x69, 0xCE, 0xDB, 0xC2, 0x70, 0x98, 0xEE, 0x88, 0x92, 0x06, 0xB2, 0xCA, 0xAA, 0xEF, 0xFB, 0x87, 0x9A, 0xC3, 0x50, 0x24, 0x51, 0x68, 0xEA, 0x02, 0x51, 0xC3, 0x48, 0x44, 0x59, 0x86, 0x99, 0xA3, 0x40, 0x03, 0x49, 0x03, 0x49, 0x29, 0xDA, 0xAA, 0xB2, 0x24, 0x51, 0x04, 0x51, 0x04, 0x51, 0x45, 0x91, 0xC5, 0xB1, 0x24, 0x59, 0x03, 0x59, 0x44, 0x59, 0x24, 0x51, 0x85, 0x69, 0xA5, 0x81,
+    0x60, 0x38, 0x60, 0x50, 0xC2, 0x58, 0xA1, 0x40, 0x03, 0x61, 0x24, 0x59, 0x26, 0xD1, 0x22, 0x99, 0xA5, 0x71, 0x85, 0x69, 0xA2, 0x50, 0x45, 0xE1, 0x03, 0x59, 0x03, 0x59, 0x23, 0x69, 0x23, 0x99, 0x27, 0xFB, 0xC2, 0x58, 0x03, 0x71, 0xE3, 0xC0, 0x64, 0x79, 0x81, 0x60, 0xC2, 0x68, 0x81, 0x68, 0xC6, 0x89, 0xC2, 0x80, 0x23, 0x69, 0x65, 0xA1, 0xC3, 0x78, 0x82, 0x68, 0xC3, 0x60, 0xE2, 0x88,
+    0x65, 0xB1, 0x64, 0x81, 0xE3, 0x60, 0x23, 0x99, 0x47, 0xDA, 0xC3, 0x50, 0xE3, 0x50, 0xE6, 0xC1, 0xCF, 0xD4, 0xC6, 0x81, 0x85, 0x81, 0xD5, 0xEE, 0x76, 0xF6, 0x85, 0x71, 0xC5, 0x69, 0x27, 0x82, 0xFF, 0xFF, 0x24, 0x51, 0x4C, 0xCC, 0xE6, 0x89, 0xEF, 0xD4, 0xE6, 0xA9, 0x86, 0x81, 0x24, 0x69, 0xCF, 0xFD, 0xA6, 0x71, 0x65, 0x61, 0xE8, 0xA1, 0x28, 0xFA, 0xE3, 0x58, 0x65, 0x59, 0xC2, 0x40,
+    0x66, 0xD9, 0x25, 0x51, 0x85, 0x59, 0x45, 0x51, 0x67, 0xEA, 0x24, 0x61, 0x24, 0x51, 0x03, 0x49, 0x24, 0x51, 0x44, 0x79, 0x84, 0x61, 0x64, 0x61, 0x64, 0x61, 0x45, 0x59, 0x44, 0x59, 0x64, 0x71, 0x8F, 0xFE, 0xC2, 0x40, 0xA2, 0x38, 0x81, 0x38, 0xA2, 0x40, 0xAE, 0xFE, 0xA1, 0x58, 0xA1, 0x40, 0xE3, 0x50, 0xC2, 0x48, 0x6A, 0xFD, 0xC2, 0x50, 0xA2, 0x48, 0xA2, 0x50, 0xE3, 0x78, 0xF7, 0xFF,
+    0xE3, 0x70, 0xA1, 0x60, 0xA1, 0x70, 0xE2, 0x60, 0xFA, 0xFF, 0xEA, 0xBA, 0xC2, 0x60, 0x07, 0xAA, 0x23, 0x71, 0xF5, 0xFF, 0x48, 0x92, 0xC6, 0xB9, 0x61, 0x68, 0xE3, 0x70, 0xFF, 0xFF, 0x79, 0xFF, 0xC6, 0xB1, 0xA2, 0x50, 0x03, 0x69, 0x6A, 0xFB, 0x43, 0x89, 0x03, 0x59, 0x03, 0x59, 0x43, 0x81, 0x07, 0xEA, 0x24, 0x69, 0x65, 0x71, 0x98, 0xCD, 0x54, 0xFE, 0xE7, 0x81, 0x67, 0x59, 0x1F, 0xC5,
+    0x8C, 0xD3, 0xE3, 0x58, 0xE7, 0x81, 0xA9, 0xA2, 0x86, 0x81, 0x64, 0x89, 0xCA, 0xBB, 0xC6, 0x79, 0x48, 0x82, 0xA8, 0xB9, 0x86, 0x71, 0xC7, 0x59, 0x29, 0xFB, 0xC3, 0x58, 0xC3, 0x40, 0x04, 0x41, 0x45, 0x59, 0xD5, 0xFF, 0xA2, 0x40, 0x46, 0x51, 0x45, 0x51, 0x45, 0x59, 0xFE, 0xFF, 0x44, 0x59, 0x04, 0x51, 0x44, 0x51, 0x24, 0x51, 0xFF, 0xFF, 0x24, 0x59, 0x03, 0x49, 0x44, 0x59, 0x85, 0x69,
+    0x81, 0x38, 0x04, 0x69, 0x81, 0x30, 0xA1, 0x38, 0x61, 0x40, 0x41, 0x50, 0x81, 0x38, 0xA2, 0x38, 0x81, 0x40, 0x81, 0x50, 0xA2, 0x40, 0xC2, 0x48, 0x81, 0x40, 0x40, 0x80, 0xE3, 0x60, 0xC2, 0x68, 0xC2, 0x68, 0x07, 0xFA, 0x23, 0x79, 0xA2, 0x60, 0x23, 0x71, 0xC2, 0x70, 0xC6, 0x91, 0xC2, 0x58, 0xE3, 0x70, 0xA2, 0x58, 0xA2, 0x58, 0xC2, 0x68, 0xC2, 0x60, 0x23, 0x61, 0xC2, 0x58, 0xA5, 0xA1,
+    0xA5, 0x81, 0xE3, 0x58, 0xE2, 0x58, 0xC2, 0x78, 0x23, 0x79, 0xE3, 0x58, 0x03, 0x59, 0xE5, 0x81, 0x84, 0x69, 0x03, 0x61, 0x45, 0x69, 0x87, 0x59, 0x85, 0x81, 0x65, 0x69, 0x25, 0x51, 0x4C, 0x6A, 0x44, 0x69, 0x03, 0x61, 0x45, 0x69, 0x47, 0x8A, 0xC2, 0x60, 0x43, 0x81, 0x28, 0xA3, 0x67, 0x8A, 0xA5, 0x69, 0x71, 0x93, 0xCA, 0x82, 0x4A, 0x6A, 0x6F, 0x5A, 0x05, 0x41, 0x65, 0x69, 0xE4, 0x40,
+    0x27, 0x49, 0x45, 0x51, 0xE3, 0x48, 0x26, 0x51, 0x65, 0x49, 0x44, 0x51, 0x24, 0x61, 0x63, 0x81, 0x23, 0x59, 0x23, 0x51, 0x25, 0x51, 0x24, 0x51, 0x03, 0x49, 0x24, 0x59, 0x44, 0x61, 0xA5, 0x69, 0x81, 0x30, 0xC3, 0x40, 0x81, 0x30, 0x82, 0x78, 0xC2, 0x50, 0x81, 0x38, 0xA2, 0x40, 0x81, 0x38, 0x45, 0xC9, 0xC2, 0x50, 0x81, 0x40, 0xC2, 0x48, 0x46, 0xF9, 0xC2, 0x80, 0x03, 0x61, 0xC2, 0x58,
+    0x64, 0xA9, 0x45, 0xD9, 0xA2, 0x60, 0x81, 0x48, 0x82, 0xD8, 0xE3, 0x70, 0x06, 0xCA, 0xA2, 0x58, 0xA2, 0xC0, 0xA2, 0x50, 0x21, 0x78, 0x24, 0x79, 0x69, 0xFC, 0x03, 0x61, 0xC3, 0x58, 0x61, 0x70, 0xC2, 0xA8, 0xE3, 0x50, 0xC2, 0x58, 0x23, 0x71, 0x26, 0x9A, 0x03, 0x59, 0x03, 0x59, 0x64, 0x81, 0x88, 0xFA, 0x23, 0x61, 0x65, 0x79, 0xC5, 0x69, 0xC5, 0x71, 0x44, 0x69, 0x25, 0x59, 0x45, 0x61,
+    0x65, 0x71, 0x49, 0xE2, 0x24, 0x69, 0xC4, 0x81, 0x03, 0x59, 0x23, 0x69, 0x68, 0x7A, 0x8C, 0xFB, 0x44, 0x59, 0x89, 0x51, 0xA9, 0xFA, 0xC8, 0xE9, 0x8A, 0x49, 0xA3, 0x38, 0xE2, 0x48, 0x85, 0x79, 0xA4, 0x38, 0xC4, 0x38, 0xE3, 0x48, 0xCE, 0xFD, 0x44, 0x49, 0x03, 0x49, 0x23, 0x49, 0x03, 0x69, 0xA2, 0x58, 0x44, 0x51, 0x03, 0x49, 0x24, 0x51, 0x44, 0x51, 0xC6, 0xA1, 0x23, 0x51, 0x44, 0x59,
+    0x81, 0x30, 0x41, 0x30, 0x85, 0x79, 0xE2, 0x48, 0xA2, 0x38, 0xA1, 0x38, 0x40, 0x38, 0x44, 0x81, 0x61, 0x40, 0x81, 0x40, 0x81, 0x48, 0xC2, 0x78, 0xE2, 0x70, 0x44, 0x71, 0xE2, 0x58, 0xE6, 0xC9, 0x64, 0xC1, 0xA4, 0x99, 0x03, 0x81, 0x41, 0x98, 0xA1, 0x60, 0xFF, 0xFF, 0xE3, 0x70, 0xA2, 0x70, 0xC2, 0x60, 0x81, 0x60, 0x27, 0xE3, 0xC3, 0x78, 0xA2, 0x60, 0x24, 0x69, 0xE3, 0xB0, 0xC2, 0x70,
+    0xE3, 0x68, 0x03, 0x59, 0xE3, 0x58, 0x89, 0xFC, 0xE3, 0x70, 0x03, 0x59, 0x03, 0x59, 0x44, 0x89, 0xE9, 0xFB, 0x03, 0x61, 0x24, 0x71, 0x64, 0x71, 0x6E, 0xDC, 0xA5, 0x89, 0x44, 0x79, 0x24, 0x61, 0x9C, 0xFF, 0x2B, 0xC3, 0x44, 0x69, 0x85, 0x79, 0x09, 0xD4, 0xC5, 0x81, 0xC7, 0xF1, 0xA8, 0x8A, 0x66, 0xEB, 0x06, 0x49, 0x68, 0x72, 0x6A, 0xFB, 0x8B, 0xFC, 0xE4, 0x40, 0xA5, 0x59, 0x64, 0x91,
+    0x00, 0xA0, 0x04, 0x41, 0xE3, 0x40, 0x24, 0x49, 0x79, 0xFF, 0x44, 0x51, 0x43, 0x49, 0x23, 0x49, 0x03, 0x49, 0xFF, 0xFF, 0x63, 0x51, 0x43, 0x51, 0x23, 0x51, 0x44, 0x51, 0x44, 0x61, 0x24, 0xAA, 0x82, 0x38, 0x61, 0x30, 0xA1, 0x38, 0xA2, 0x38, 0xA2, 0x40, 0xA2, 0x40, 0x61, 0x38, 0xA1, 0x40, 0xC2, 0x48, 0xC2, 0x48, 0xC2, 0x50, 0xA1, 0x50, 0x03, 0x79, 0x43, 0x71, 0xC2, 0x60, 0x84, 0x99,
+    0xE4, 0xA9, 0x83, 0x91, 0x43, 0x89, 0x23, 0x89, 0x60, 0x60, 0x23, 0x81, 0x44, 0x99, 0xC3, 0x78, 0xC3, 0x60, 0x04, 0x69, 0xE3, 0x78, 0x61, 0x68, 0x03, 0x61, 0x44, 0x69, 0xC2, 0x60, 0x07, 0xCA, 0xC2, 0x60, 0x03, 0x51, 0xE3, 0x58, 0x03, 0x79, 0x07, 0x8A, 0x44, 0x59, 0xE3, 0x60, 0x24, 0x99, 0x24, 0x81, 0x24, 0x69, 0x44, 0x71, 0x06, 0xB2, 0x4C, 0xB3, 0xA3, 0x58, 0x47, 0xBA, 0x23, 0x61,
+    0x89, 0x92, 0x65, 0x89, 0x85, 0x79, 0x24, 0x69, 0xA1, 0x58, 0xE5, 0x99, 0x02, 0x51, 0x47, 0x7A, 0xE2, 0x58, 0x45, 0x69, 0x69, 0x72, 0x88, 0x7A, 0x0A, 0x72, 0x24, 0x49, 0x22, 0x49, 0x44, 0x51, 0xE4, 0x40, 0xA6, 0x81, 0x65, 0x51, 0x03, 0x41, 0x03, 0x49, 0x23, 0x49, 0x44, 0x51, 0x03, 0x49, 0x02, 0x49, 0xC4, 0x69, 0x62, 0x51, 0xA4, 0x59, 0x43, 0x51, 0x23, 0x49, 0x23, 0x51, 0x44, 0x51,
+    0x09, 0xFC, 0x61, 0x30, 0x82, 0x38, 0xE3, 0x40, 0xC2, 0x48, 0xE5, 0xF9, 0x81, 0x40, 0x81, 0x40, 0xC2, 0x48, 0xA2, 0x48, 0x2D, 0xFE, 0xE2, 0x68, 0x44, 0x89, 0x23, 0x71, 0x81, 0x58, 0xF1, 0xFE, 0xC4, 0x91, 0xA4, 0x89, 0x64, 0xA9, 0x05, 0xA2, 0xFE, 0xFF, 0x64, 0x89, 0x81, 0x88, 0x03, 0x71, 0x82, 0x50, 0x92, 0xFF, 0xE3, 0x68, 0x42, 0x78, 0xE3, 0x50, 0x24, 0x69, 0xFF, 0xFF, 0xC3, 0x70,
+    0xC3, 0x58, 0x24, 0x59, 0xE3, 0x50, 0x49, 0xFB, 0x44, 0x81, 0x24, 0x59, 0x24, 0x61, 0x25, 0xAA, 0x87, 0xF1, 0x44, 0x61, 0x64, 0x71, 0xAA, 0xC3, 0x29, 0xAB, 0xA6, 0x81, 0x29, 0xA3, 0x27, 0x7A, 0xA6, 0x69, 0x64, 0x81, 0xA6, 0x71, 0x43, 0x61, 0xE2, 0x60, 0x84, 0x81, 0x23, 0x59, 0x86, 0xA1, 0xA1, 0x48, 0x45, 0x89, 0xE6, 0x61, 0xC5, 0x59, 0xC8, 0xFA, 0x04, 0x51, 0xE2, 0x48, 0x64, 0x59,
+    0xC3, 0x48, 0x73, 0xFF, 0xC3, 0x40, 0xE3, 0x40, 0xE2, 0x40, 0x03, 0x41, 0xFF, 0xFF, 0x23, 0x49, 0x03, 0x49, 0x03, 0x41, 0x23, 0x49, 0xFD, 0xFF, 0x23, 0x49, 0x23, 0x51, 0x44, 0x51, 0x44, 0x51, 0x61, 0x30, 0x61, 0x30, 0x81, 0x38, 0x81, 0x38, 0x65, 0x71, 0x60, 0x38, 0xC2, 0x48, 0xC2, 0x48, 0xE2, 0x50, 0xC2, 0x50, 0xC2, 0x50, 0x44, 0x81, 0x44, 0x81, 0xA6, 0x91, 0x81, 0x58, 0xC4, 0xA1,
+    0xC4, 0x91, 0x45, 0xE1, 0xA4, 0xA9, 0x46, 0xAA, 0x83, 0x89, 0x23, 0x79, 0x28, 0xFB, 0x03, 0x61, 0xA2, 0x50, 0xC3, 0x58, 0xA2, 0x88, 0xC3, 0x60, 0xA2, 0x48, 0xC3, 0x58, 0xC2, 0x58, 0xE9, 0xFB, 0x81, 0x48, 0x03, 0x51, 0xE2, 0x50, 0xE3, 0xA8, 0x84, 0x81, 0x64, 0x61, 0x43, 0x69, 0xA6, 0xAA, 0x48, 0xFA, 0x24, 0x61, 0x65, 0x71, 0x72, 0xCC, 0x28, 0xAA, 0xE3, 0x58, 0x27, 0x7A, 0x8D, 0x7A,
+    0x45, 0x61, 0xC7, 0xF9, 0xA6, 0x9A, 0x43, 0x61, 0xE2, 0x60, 0xC7, 0xF9, 0x84, 0x99, 0x84, 0x61, 0x81, 0x48, 0xA6, 0x81, 0x07, 0xF9, 0xC5, 0x61, 0x85, 0x69, 0xE4, 0x40, 0x41, 0x80, 0x44, 0x59, 0xE3, 0x48, 0x04, 0x49, 0x03, 0x51, 0x8B, 0xFD, 0x02, 0x41, 0xE2, 0x48, 0x23, 0x49, 0xFE, 0xFF, 0xE2, 0x48, 0x03, 0x49, 0xC2, 0x40, 0x23, 0x49, 0x44, 0x51, 0x88, 0xFB, 0x23, 0x51, 0x44, 0x51,
+    0xA2, 0x38, 0x82, 0x30, 0xA1, 0x38, 0x61, 0x30, 0xA1, 0x38, 0xE2, 0x48, 0xE3, 0x48, 0xC2, 0x48, 0xC2, 0x48, 0x81, 0x40, 0xC2, 0x60, 0x23, 0x71, 0x64, 0x81, 0x23, 0x71, 0x60, 0x50, 0xC4, 0x91, 0x04, 0x9A, 0xA4, 0x89, 0xA4, 0xA1, 0x46, 0xA2, 0x05, 0x9A, 0xE2, 0x70, 0xE3, 0x68, 0xE3, 0x68, 0xC2, 0x50, 0xC2, 0x58, 0x65, 0x79, 0xC2, 0x50, 0xA2, 0x50, 0xC3, 0x58, 0xE3, 0x58, 0xE2, 0x50,
+    0x82, 0x58, 0xC2, 0x50, 0xE3, 0x50, 0x23, 0x61, 0xA4, 0x99, 0x23, 0x51, 0x64, 0x69, 0x28, 0xB3, 0x46, 0x82, 0x44, 0x59, 0xA6, 0x79, 0x75, 0xC4, 0x8C, 0x72, 0x25, 0x59, 0x29, 0x7A, 0x77, 0x8B, 0x05, 0x51, 0x44, 0x69, 0x65, 0x8A, 0x02, 0x51, 0x03, 0x59, 0x85, 0x89, 0x43, 0x61, 0x23, 0x59, 0x81, 0x40, 0x86, 0x71, 0x85, 0x69, 0xC6, 0x61, 0x65, 0x59, 0x82, 0x30, 0xA2, 0x30, 0xE3, 0x48,
+    0xE4, 0x48, 0xE3, 0x40, 0x03, 0x41, 0xE2, 0x38, 0xA1, 0x40, 0xC2, 0x38, 0xE2, 0x38, 0xE2, 0x40, 0x03, 0x41, 0x23, 0x49, 0xE3, 0x38, 0xE3, 0x40, 0xE3, 0x40, 0x03, 0x49, 0x03, 0x49, 0x43, 0x51, 0x61, 0x30, 0x81, 0x30, 0xA3, 0xE0, 0x81, 0x38, 0xC2, 0x40, 0xA1, 0x38, 0xE2, 0x48, 0x05, 0xF1, 0x81, 0x40, 0x82, 0x48, 0xE2, 0x58, 0x03, 0x81, 0xC2, 0x60, 0xE2, 0x60, 0xE2, 0x68, 0xE4, 0x91,
+    0xEA, 0xFB, 0x83, 0x89, 0xA4, 0x91, 0x25, 0xA2, 0xA4, 0x89, 0xC8, 0xFA, 0x03, 0x79, 0x03, 0x81, 0x64, 0x81, 0xC2, 0x78, 0xD3, 0xFF, 0xA2, 0x58, 0x82, 0x60, 0xA2, 0x60, 0x62, 0x78, 0xE3, 0x68, 0xA2, 0x80, 0xE3, 0x70, 0x44, 0x61, 0x65, 0xE9, 0x66, 0xCA, 0x44, 0x69, 0x84, 0x69, 0xA8, 0xB3, 0xE7, 0xA1, 0xC6, 0x69, 0xC8, 0x71, 0xB3, 0xA3, 0xAC, 0x72, 0x66, 0x61, 0x6B, 0x7A, 0x8D, 0x72,
+    0xA7, 0x59, 0xC6, 0x71, 0x66, 0x8A, 0xA1, 0x48, 0x03, 0x61, 0x64, 0x81, 0x66, 0xD1, 0x81, 0x50, 0x81, 0x48, 0x43, 0x69, 0x85, 0x69, 0x85, 0xD9, 0x45, 0x59, 0x82, 0x30, 0x81, 0x30, 0xE3, 0x40, 0x04, 0x41, 0xE3, 0x40, 0x24, 0x49, 0xE2, 0x38, 0x4F, 0xFE, 0xC2, 0x38, 0xC2, 0x38, 0xE2, 0x38, 0x02, 0x41, 0xFF, 0xFF, 0x02, 0x39, 0x03, 0x39, 0xE3, 0x38, 0xE3, 0x40, 0x44, 0x49, 0xA5, 0x59,
+    0x61, 0x30, 0x82, 0x30, 0x61, 0x30, 0x81, 0x30, 0xA1, 0x38, 0xC2, 0x40, 0x81, 0x40, 0x81, 0x40, 0xA1, 0x48, 0xA2, 0x50, 0xC2, 0x50, 0xE2, 0x68, 0x40, 0x48, 0x60, 0x48, 0x43, 0x71, 0xC4, 0x91, 0xA4, 0x89, 0x83, 0x81, 0x84, 0x91, 0x05, 0x9A, 0x23, 0x81, 0x03, 0x71, 0xA1, 0x70, 0x23, 0x89, 0xA2, 0x60, 0xC3, 0x80, 0xA2, 0x68, 0xC2, 0x60, 0x82, 0x78, 0xA2, 0x70, 0xC3, 0x70, 0x03, 0x71,
+    0xA2, 0x80, 0xE3, 0x70, 0x24, 0x61, 0x06, 0xA2, 0xA4, 0xB1, 0x64, 0x71, 0xA4, 0x71, 0xC9, 0xB3, 0x02, 0x69, 0x65, 0x61, 0xE7, 0x71, 0x55, 0xB4, 0xCC, 0x82, 0x45, 0x61, 0x6B, 0x7A, 0x91, 0x8B, 0x44, 0x51, 0x85, 0x69, 0x46, 0x8A, 0xC2, 0x50, 0x84, 0x79, 0x44, 0x81, 0xC6, 0x99, 0x40, 0x58, 0xA1, 0x48, 0x23, 0x69, 0x23, 0x59, 0x44, 0x59, 0x25, 0x59, 0x61, 0x30, 0xA2, 0x38, 0xA2, 0x38,
+    0xA2, 0x38, 0xC3, 0x48, 0xA3, 0x38, 0xA2, 0x38, 0xC2, 0x38, 0x44, 0x49, 0xC2, 0x38, 0xC2, 0x30, 0xE2, 0x38, 0xA1, 0x30, 0x84, 0x62, 0x23, 0x41, 0xC2, 0x30, 0xE2, 0x38, 0xE3, 0x40, 0x44, 0x49, 0x24, 0xF1, 0x61, 0x28, 0xA2, 0x38, 0x40, 0x28, 0xA2, 0x38, 0xA4, 0xE0, 0x81, 0x38, 0x40, 0x38, 0xC2, 0x48, 0xC2, 0x48, 0xE8, 0xFA, 0xE2, 0x68, 0x61, 0x40, 0x20, 0x48, 0x02, 0x69, 0xA5, 0xF9,
+    0xA3, 0x89, 0x63, 0x79, 0x84, 0x89, 0xC4, 0x81, 0xFD, 0xFF, 0x61, 0x48, 0x40, 0x40, 0x03, 0x71, 0xE3, 0x68, 0xAE, 0xFD, 0xC3, 0x68, 0xC2, 0x60, 0xC3, 0x80, 0xC2, 0x68, 0xFD, 0xFF, 0x03, 0x71, 0xC2, 0x60, 0x03, 0x71, 0x24, 0x59, 0x06, 0xF9, 0x05, 0xBA, 0x84, 0x71, 0xA5, 0x71, 0x87, 0x9A, 0x86, 0xE9, 0x44, 0x59, 0x29, 0x7A, 0x13, 0xAC, 0x2C, 0x9B, 0xC6, 0x79, 0x6B, 0x7A, 0x51, 0x8B,
+    0xC2, 0x40, 0x84, 0x69, 0xE7, 0x71, 0x20, 0x40, 0x23, 0x61, 0x43, 0x79, 0x85, 0x81, 0x85, 0x69, 0xA2, 0x50, 0x23, 0x69, 0x03, 0x59, 0x44, 0x59, 0x65, 0x91, 0xC3, 0x38, 0xA1, 0x30, 0xA2, 0x38, 0xA2, 0x40, 0x26, 0xA2, 0xA3, 0x38, 0xC3, 0x40, 0xA2, 0x48, 0xC2, 0x38, 0xFF, 0xFF, 0xC2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA1, 0x30, 0x6D, 0xCD, 0xC2, 0x38, 0xC2, 0x30, 0xC2, 0x38, 0x03, 0x41,
 };
 const lv_img_dsc_t ui_img_plasma_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_plasma_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_plasma_80_png_data
 };
 
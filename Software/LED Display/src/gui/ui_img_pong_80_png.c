@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Pong_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_pong_80_png_data[] = {
-    0x44, 0x38, 0xFF, 0x24, 0x30, 0xFF, 0x24, 0x38, 0xFF, 0x65, 0x40, 0xFF, 0x44, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x44, 0x28, 0xFF, 0x24, 0x38, 0xFF, 0x44, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0x64, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x84, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0xC5, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0x64, 0x30, 0xFF, 0x86, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x64, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x49, 0x51, 0xFF, 0xCF, 0x71, 0xFF, 0x65, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xC6, 0x40, 0xFF, 0x11, 0x82, 0xFF, 0x64, 0x38, 0xFF, 0x44, 0x48, 0xFF, 0x85, 0x50, 0xFF, 0xC6, 0x48, 0xFF, 0x0B, 0x69, 0xFF, 0x44, 0x38, 0xFF, 0x08, 0x89, 0xFF, 0xA6, 0x70, 0xFF, 0x44, 0x40, 0xFF, 0xE9, 0x60, 0xFF, 0x86, 0x48, 0xFF, 0x44, 0x38, 0xFF, 0x85, 0x40, 0xFF, 0x65, 0x38, 0xFF, 0x44, 0x38, 0xFF, 0xC8, 0x60, 0xFF, 0x64, 0x38, 0xFF,
-    0x84, 0x40, 0xFF, 0xA5, 0x48, 0xFF, 0x64, 0x40, 0xFF, 0x0A, 0x71, 0xFF, 0x85, 0x48, 0xFF, 0x03, 0x38, 0xFF, 0x44, 0x38, 0xFF, 0x44, 0x40, 0xFF, 0xC7, 0x68, 0xFF, 0x64, 0x48, 0xFF, 0x64, 0x50, 0xFF, 0x65, 0x48, 0xFF, 0x65, 0x48, 0xFF, 0xC8, 0x70, 0xFF, 0x45, 0x40, 0xFF, 0x66, 0x48, 0xFF, 0x44, 0x30, 0xFF, 0xC6, 0x40, 0xFF, 0x85, 0x38, 0xFF, 0xA5, 0x40, 0xFF, 0x65, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0x08, 0x49, 0xFF, 0x85, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x06, 0x41, 0xFF, 0xE9, 0x40, 0xFF, 0x44, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x09, 0x49, 0xFF, 0x84, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x06, 0x41, 0xFF, 0x83, 0x28, 0xFF, 0x4B, 0x51, 0xFF, 0x64, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x2A, 0x49, 0xFF, 0x64, 0x28, 0xFF, 0xA5, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x4B, 0x49, 0xFF, 0xA5, 0x30, 0xFF, 0xC6, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x38, 0xFF, 0x09, 0x51, 0xFF, 0xA6, 0x38, 0xFF, 0x0B, 0x39, 0xFF, 0x91, 0x6A, 0xFF, 0x85, 0x38, 0xFF, 0x2B, 0x51, 0xFF, 0x85, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0xA5, 0x40, 0xFF, 0xC6, 0x40, 0xFF, 0x8E, 0x69, 0xFF, 0x85, 0x38, 0xFF,
-    0xA5, 0x40, 0xFF, 0x84, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x2A, 0x61, 0xFF, 0x85, 0x40, 0xFF, 0x24, 0x38, 0xFF, 0x65, 0x40, 0xFF, 0x65, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x08, 0x71, 0xFF, 0xA6, 0x60, 0xFF, 0x65, 0x38, 0xFF, 0x64, 0x38, 0xFF, 0x64, 0x38, 0xFF, 0x64, 0x40, 0xFF, 0x84, 0x38, 0xFF, 0x84, 0x38, 0xFF, 0x84, 0x40, 0xFF, 0x44, 0x38, 0xFF, 0x44, 0x40, 0xFF, 0x45, 0x40, 0xFF, 0x44, 0x40, 0xFF, 0x64, 0x48, 0xFF, 0x24, 0x40, 0xFF, 0x65, 0x48, 0xFF, 0x45, 0x40, 0xFF, 0x45, 0x40, 0xFF, 0x65, 0x48, 0xFF, 0x86, 0x48, 0xFF, 0x86, 0x50, 0xFF, 0x86, 0x50, 0xFF, 0xA5, 0x40, 0xFF, 0x83, 0x30, 0xFF, 0x0A, 0x51, 0xFF, 0x86, 0x38, 0xFF, 0x44, 0x38, 0xFF, 0x85, 0x40, 0xFF, 0x44, 0x30, 0xFF, 0x63, 0x28, 0xFF, 0x65, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0xA4, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xD0, 0x61, 0xFF, 0x64, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0x64, 0x28, 0xFF, 0x84, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x87, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x85, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xC6, 0x38, 0xFF, 0xA9, 0x30, 0xFF, 0x85, 0x30, 0xFF,
-    0xE6, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xA5, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0x86, 0x38, 0xFF, 0x25, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x64, 0x30, 0xFF, 0xC7, 0x40, 0xFF, 0xA5, 0x40, 0xFF, 0x65, 0x40, 0xFF, 0xA5, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0xA6, 0x48, 0xFF, 0x64, 0x38, 0xFF, 0x85, 0x58, 0xFF, 0xC6, 0x58, 0xFF, 0x85, 0x40, 0xFF, 0xE6, 0x50, 0xFF, 0x85, 0x40, 0xFF, 0x65, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x2A, 0x69, 0xFF, 0xC6, 0x50, 0xFF, 0xA5, 0x58, 0xFF, 0xC5, 0x50, 0xFF, 0xC5, 0x48, 0xFF, 0x4A, 0x71, 0xFF, 0x85, 0x40, 0xFF, 0x84, 0x40, 0xFF, 0x44, 0x40, 0xFF, 0x64, 0x40, 0xFF, 0xE9, 0x78, 0xFF, 0x64, 0x48, 0xFF, 0x24, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0x86, 0x50, 0xFF, 0xC7, 0x70, 0xFF, 0x65, 0x48, 0xFF, 0x45, 0x40, 0xFF, 0x86, 0x48, 0xFF, 0xA6, 0x50, 0xFF, 0xC6, 0x40, 0xFF, 0xC5, 0x38, 0xFF, 0x63, 0x28, 0xFF, 0x63, 0x30, 0xFF, 0x44, 0x30, 0xFF, 0xC6, 0x48, 0xFF, 0xA5, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x6B, 0x51, 0xFF, 0x84, 0x30, 0xFF, 0xC6, 0x38, 0xFF, 0xE6, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0x08, 0x41, 0xFF, 0xA5, 0x30, 0xFF,
-    0x43, 0x28, 0xFF, 0xA7, 0x38, 0xFF, 0x44, 0x28, 0xFF, 0x2C, 0x49, 0xFF, 0x84, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x08, 0x49, 0xFF, 0x43, 0x28, 0xFF, 0x44, 0x28, 0xFF, 0x11, 0x62, 0xFF, 0xE8, 0x40, 0xFF, 0xE6, 0x40, 0xFF, 0x84, 0x30, 0xFF, 0x29, 0x49, 0xFF, 0xD2, 0x59, 0xFF, 0x0B, 0x49, 0xFF, 0x07, 0x41, 0xFF, 0xC6, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0x4C, 0x59, 0xFF, 0xC7, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xF2, 0x69, 0xFF, 0xA6, 0x40, 0xFF, 0x64, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0xA9, 0x48, 0xFF, 0xE7, 0x48, 0xFF, 0xA5, 0x40, 0xFF, 0x64, 0x38, 0xFF, 0x4B, 0x69, 0xFF, 0x85, 0x40, 0xFF, 0xB0, 0x79, 0xFF, 0xE6, 0x48, 0xFF, 0x64, 0x40, 0xFF, 0x44, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x66, 0x40, 0xFF, 0x65, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x64, 0x38, 0xFF, 0x85, 0x40, 0xFF, 0x4E, 0x81, 0xFF, 0x85, 0x40, 0xFF, 0xA5, 0x48, 0xFF, 0x64, 0x40, 0xFF, 0x44, 0x38, 0xFF, 0x24, 0x40, 0xFF, 0x24, 0x40, 0xFF, 0x43, 0x40, 0xFF, 0x44, 0x48, 0xFF, 0x65, 0x48, 0xFF, 0x45, 0x40, 0xFF, 0x4C, 0x89, 0xFF, 0x45, 0x48, 0xFF, 0x65, 0x48, 0xFF, 0x86, 0x48, 0xFF, 0x86, 0x50, 0xFF, 0xA7, 0x58, 0xFF,
-    0x64, 0x38, 0xFF, 0xC6, 0x40, 0xFF, 0x85, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0x09, 0x49, 0xFF, 0x85, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0xC6, 0x38, 0xFF, 0x64, 0x28, 0xFF, 0x09, 0x49, 0xFF, 0xA5, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x23, 0x20, 0xFF, 0xA5, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x06, 0x41, 0xFF, 0x84, 0x30, 0xFF, 0xA4, 0x30, 0xFF, 0xE7, 0x40, 0xFF, 0xA5, 0x30, 0xFF, 0x30, 0x72, 0xFF, 0x84, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0xC5, 0x38, 0xFF, 0xE7, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xC6, 0x38, 0xFF, 0xA5, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0x85, 0x38, 0xFF, 0x2D, 0x49, 0xFF, 0x85, 0x38, 0xFF, 0x44, 0x30, 0xFF, 0x65, 0x38, 0xFF, 0xE7, 0x48, 0xFF, 0x86, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x85, 0x40, 0xFF, 0x65, 0x38, 0xFF, 0x85, 0x40, 0xFF, 0xC5, 0x40, 0xFF, 0x66, 0x40, 0xFF, 0x27, 0x51, 0xFF, 0xC6, 0x48, 0xFF, 0x85, 0x40, 0xFF, 0x65, 0x40, 0xFF, 0x8E, 0x79, 0xFF, 0xC7, 0x58, 0xFF, 0xC7, 0x50, 0xFF, 0x85, 0x40, 0xFF, 0xA6, 0x50, 0xFF, 0xA6, 0x58, 0xFF, 0x4A, 0x71, 0xFF,
-    0xE8, 0x58, 0xFF, 0x84, 0x40, 0xFF, 0xA5, 0x48, 0xFF, 0x85, 0x48, 0xFF, 0x0B, 0x81, 0xFF, 0xC7, 0x58, 0xFF, 0xA6, 0x60, 0xFF, 0x44, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0x0A, 0x79, 0xFF, 0x65, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0x65, 0x48, 0xFF, 0x86, 0x58, 0xFF, 0x0A, 0x79, 0xFF, 0x64, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x44, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x63, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0xA5, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0xA4, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x23, 0x28, 0xFF, 0x45, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x23, 0x28, 0xFF, 0xA5, 0x30, 0xFF, 0x24, 0x28, 0xFF, 0x8C, 0x59, 0xFF, 0xA5, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x23, 0x28, 0xFF, 0x08, 0x41, 0xFF, 0x44, 0x28, 0xFF, 0x6A, 0x51, 0xFF, 0xC6, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0x8D, 0x59, 0xFF, 0xC6, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xAF, 0x69, 0xFF, 0xA6, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0x45, 0x30, 0xFF, 0xD0, 0x71, 0xFF, 0xE7, 0x48, 0xFF, 0x07, 0x49, 0xFF, 0xA6, 0x40, 0xFF, 0xC8, 0x50, 0xFF, 0xD2, 0x79, 0xFF, 0xE7, 0x48, 0xFF,
-    0xA6, 0x40, 0xFF, 0x09, 0x59, 0xFF, 0x85, 0x40, 0xFF, 0x6F, 0x79, 0xFF, 0xA6, 0x48, 0xFF, 0xC6, 0x48, 0xFF, 0x2B, 0x69, 0xFF, 0x85, 0x40, 0xFF, 0x4C, 0x71, 0xFF, 0x65, 0x40, 0xFF, 0xC7, 0x50, 0xFF, 0xA5, 0x48, 0xFF, 0x65, 0x40, 0xFF, 0x64, 0x40, 0xFF, 0xC7, 0x58, 0xFF, 0x0A, 0x71, 0xFF, 0x85, 0x40, 0xFF, 0x64, 0x40, 0xFF, 0xA4, 0x40, 0xFF, 0x0B, 0x81, 0xFF, 0x44, 0x48, 0xFF, 0x24, 0x48, 0xFF, 0x85, 0x48, 0xFF, 0x64, 0x48, 0xFF, 0x6C, 0x91, 0xFF, 0x45, 0x48, 0xFF, 0x65, 0x48, 0xFF, 0x66, 0x48, 0xFF, 0x86, 0x50, 0xFF, 0x2A, 0x89, 0xFF, 0x65, 0x48, 0xFF, 0xA7, 0x58, 0xFF, 0x43, 0x28, 0xFF, 0xC6, 0x38, 0xFF, 0x64, 0x30, 0xFF, 0x65, 0x38, 0xFF, 0x23, 0x30, 0xFF, 0x83, 0x28, 0xFF, 0xC7, 0x40, 0xFF, 0x64, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x23, 0x20, 0xFF, 0xE8, 0x40, 0xFF, 0x84, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0x2C, 0x51, 0xFF, 0xA4, 0x30, 0xFF, 0xC5, 0x38, 0xFF, 0x29, 0x49, 0xFF, 0x64, 0x30, 0xFF, 0x6E, 0x51, 0xFF, 0xA5, 0x30, 0xFF, 0x49, 0x51, 0xFF, 0x85, 0x38, 0xFF, 0x64, 0x28, 0xFF, 0x8E, 0x59, 0xFF, 0x85, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x8E, 0x59, 0xFF,
-    0xC6, 0x40, 0xFF, 0xA5, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x0A, 0x59, 0xFF, 0xC7, 0x40, 0xFF, 0xC6, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0x86, 0x38, 0xFF, 0x0B, 0x51, 0xFF, 0xC6, 0x40, 0xFF, 0xC6, 0x40, 0xFF, 0x65, 0x38, 0xFF, 0x08, 0x51, 0xFF, 0x66, 0x40, 0xFF, 0x85, 0x38, 0xFF, 0xA5, 0x40, 0xFF, 0x2B, 0x69, 0xFF, 0x45, 0x38, 0xFF, 0x65, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0xC6, 0x48, 0xFF, 0x64, 0x38, 0xFF, 0xC6, 0x50, 0xFF, 0xF9, 0xC3, 0xFF, 0x64, 0x40, 0xFF, 0xA5, 0x48, 0xFF, 0x85, 0x40, 0xFF, 0xC5, 0x48, 0xFF, 0x65, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0xA5, 0x48, 0xFF, 0xA5, 0x48, 0xFF, 0x64, 0x40, 0xFF, 0x64, 0x48, 0xFF, 0x44, 0x40, 0xFF, 0x65, 0x50, 0xFF, 0x44, 0x40, 0xFF, 0x65, 0x48, 0xFF, 0x24, 0x40, 0xFF, 0x85, 0x50, 0xFF, 0x65, 0x48, 0xFF, 0x65, 0x48, 0xFF, 0x86, 0x50, 0xFF, 0x46, 0x50, 0xFF, 0x66, 0x50, 0xFF, 0x86, 0x50, 0xFF, 0xC7, 0x58, 0xFF, 0x24, 0x38, 0xFF, 0x64, 0x30, 0xFF, 0x43, 0x28, 0xFF, 0x08, 0x49, 0xFF, 0xA5, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x63, 0x28, 0xFF, 0x63, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xA4, 0x30, 0xFF, 0x63, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x85, 0x30, 0xFF,
-    0xC6, 0x38, 0xFF, 0xA4, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xE7, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x4B, 0x51, 0xFF, 0x64, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0xC7, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0xE9, 0x48, 0xFF, 0xC7, 0x40, 0xFF, 0xC8, 0x38, 0xFF, 0x66, 0x28, 0xFF, 0x65, 0x38, 0xFF, 0x2B, 0x51, 0xFF, 0xA6, 0x40, 0xFF, 0x65, 0x38, 0xFF, 0xC6, 0x40, 0xFF, 0xC6, 0x40, 0xFF, 0x86, 0x40, 0xFF, 0xA5, 0x40, 0xFF, 0x84, 0x38, 0xFF, 0xA6, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x49, 0x61, 0xFF, 0x65, 0x40, 0xFF, 0xE6, 0x50, 0xFF, 0xE6, 0x50, 0xFF, 0x8C, 0x71, 0xFF, 0xA5, 0x48, 0xFF, 0x84, 0x48, 0xFF, 0xA6, 0x48, 0xFF, 0x48, 0x61, 0xFF, 0xC8, 0x60, 0xFF, 0xA6, 0x50, 0xFF, 0x85, 0x40, 0xFF, 0xA5, 0x48, 0xFF, 0xE7, 0x58, 0xFF, 0xA7, 0x60, 0xFF, 0xA6, 0x50, 0xFF, 0x86, 0x50, 0xFF, 0x65, 0x48, 0xFF, 0x85, 0x50, 0xFF, 0x4B, 0x89, 0xFF, 0x85, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0x86, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0xA8, 0x70, 0xFF, 0xA6, 0x58, 0xFF, 0x66, 0x50, 0xFF, 0x66, 0x50, 0xFF, 0xC8, 0x60, 0xFF,
-    0x44, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x4C, 0x51, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0xC5, 0x38, 0xFF, 0x43, 0x28, 0xFF, 0x2C, 0x51, 0xFF, 0x64, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xA4, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x90, 0x61, 0xFF, 0x43, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0x54, 0x62, 0xFF, 0xA5, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0x4B, 0x51, 0xFF, 0x84, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x87, 0x30, 0xFF, 0x09, 0x49, 0xFF, 0x07, 0x49, 0xFF, 0xA5, 0x30, 0xFF, 0x07, 0x41, 0xFF, 0x5C, 0x73, 0xFF, 0x4E, 0x51, 0xFF, 0xC7, 0x40, 0xFF, 0x85, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0x86, 0x38, 0xFF, 0xC9, 0x48, 0xFF, 0xC7, 0x40, 0xFF, 0x65, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0xA8, 0x40, 0xFF, 0x07, 0x49, 0xFF, 0x85, 0x38, 0xFF, 0xA6, 0x40, 0xFF, 0x6C, 0x61, 0xFF, 0x65, 0x38, 0xFF, 0xA6, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x65, 0x38, 0xFF, 0x8E, 0x79, 0xFF, 0xA6, 0x48, 0xFF, 0x44, 0x38, 0xFF, 0xC6, 0x50, 0xFF, 0xA5, 0x48, 0xFF, 0x64, 0x40, 0xFF, 0x27, 0x59, 0xFF, 0xA6, 0x48, 0xFF, 0x24, 0x38, 0xFF, 0x65, 0x48, 0xFF, 0xC6, 0x50, 0xFF, 0x86, 0x48, 0xFF, 0x85, 0x40, 0xFF, 0x64, 0x40, 0xFF,
-    0x4B, 0x79, 0xFF, 0x85, 0x48, 0xFF, 0xA6, 0x50, 0xFF, 0x24, 0x40, 0xFF, 0x24, 0x48, 0xFF, 0x44, 0x48, 0xFF, 0x44, 0x48, 0xFF, 0x44, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0x66, 0x50, 0xFF, 0x65, 0x50, 0xFF, 0x86, 0x50, 0xFF, 0x45, 0x48, 0xFF, 0x66, 0x50, 0xFF, 0xC7, 0x58, 0xFF, 0xA7, 0x58, 0xFF, 0x64, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x86, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x63, 0x28, 0xFF, 0xA4, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0xE8, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0x11, 0x6A, 0xFF, 0x86, 0x30, 0xFF, 0x2B, 0x51, 0xFF, 0x44, 0x28, 0xFF, 0x87, 0x38, 0xFF, 0xD7, 0x5A, 0xFF, 0xAC, 0x51, 0xFF, 0xC7, 0x40, 0xFF, 0xA6, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x66, 0x30, 0xFF, 0x91, 0x69, 0xFF, 0xC7, 0x40, 0xFF, 0xA6, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0x87, 0x40, 0xFF, 0x96, 0x7A, 0xFF, 0x08, 0x49, 0xFF, 0xC6, 0x40, 0xFF, 0x28, 0x51, 0xFF, 0xE8, 0x50, 0xFF, 0xD1, 0x69, 0xFF, 0x85, 0x38, 0xFF,
-    0xE8, 0x50, 0xFF, 0x64, 0x38, 0xFF, 0x85, 0x40, 0xFF, 0x65, 0x40, 0xFF, 0x33, 0x82, 0xFF, 0x65, 0x40, 0xFF, 0x08, 0x59, 0xFF, 0xA5, 0x40, 0xFF, 0x08, 0x59, 0xFF, 0xB1, 0x81, 0xFF, 0x65, 0x40, 0xFF, 0xC6, 0x50, 0xFF, 0x65, 0x40, 0xFF, 0xC6, 0x50, 0xFF, 0x86, 0x50, 0xFF, 0x6E, 0x89, 0xFF, 0x64, 0x40, 0xFF, 0xC6, 0x50, 0xFF, 0x85, 0x48, 0xFF, 0x85, 0x48, 0xFF, 0x0C, 0x89, 0xFF, 0x25, 0x48, 0xFF, 0x65, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0x65, 0x50, 0xFF, 0x2C, 0x89, 0xFF, 0xC8, 0x68, 0xFF, 0x86, 0x50, 0xFF, 0x66, 0x50, 0xFF, 0x86, 0x50, 0xFF, 0xC8, 0x60, 0xFF, 0x2C, 0x99, 0xFF, 0x84, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x44, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0xE6, 0x38, 0xFF, 0x84, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0x4D, 0x51, 0xFF, 0xA5, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xAE, 0x61, 0xFF, 0x64, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x2A, 0x49, 0xFF, 0xB1, 0x59, 0xFF, 0xC7, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0x28, 0x49, 0xFF, 0x64, 0x28, 0xFF, 0x4C, 0x49, 0xFF, 0x67, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xE7, 0x40, 0xFF, 0xA6, 0x38, 0xFF, 0x0B, 0x41, 0xFF,
-    0xA6, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xF3, 0x71, 0xFF, 0x08, 0x49, 0xFF, 0x24, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0xC7, 0x40, 0xFF, 0x15, 0x72, 0xFF, 0x08, 0x51, 0xFF, 0x65, 0x38, 0xFF, 0xC7, 0x48, 0xFF, 0x85, 0x40, 0xFF, 0x34, 0x7A, 0xFF, 0x86, 0x40, 0xFF, 0xA6, 0x40, 0xFF, 0xA6, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x34, 0x92, 0xFF, 0x85, 0x40, 0xFF, 0xA6, 0x48, 0xFF, 0xC7, 0x50, 0xFF, 0xC7, 0x50, 0xFF, 0xA8, 0x58, 0xFF, 0x85, 0x48, 0xFF, 0x6A, 0x71, 0xFF, 0xC8, 0x58, 0xFF, 0x85, 0x48, 0xFF, 0xC6, 0x50, 0xFF, 0x85, 0x50, 0xFF, 0xA5, 0x50, 0xFF, 0xC5, 0x50, 0xFF, 0x64, 0x48, 0xFF, 0xE7, 0x60, 0xFF, 0xC8, 0x70, 0xFF, 0x24, 0x40, 0xFF, 0x66, 0x48, 0xFF, 0x25, 0x48, 0xFF, 0xC9, 0x70, 0xFF, 0x86, 0x50, 0xFF, 0x66, 0x58, 0xFF, 0x88, 0x50, 0xFF, 0x66, 0x50, 0xFF, 0x86, 0x58, 0xFF, 0x66, 0x58, 0xFF, 0x67, 0x60, 0xFF, 0xC8, 0x60, 0xFF, 0x43, 0x28, 0xFF, 0x08, 0x41, 0xFF, 0x64, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x09, 0x41, 0xFF, 0xE7, 0x40, 0xFF, 0x84, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x2B, 0x49, 0xFF, 0xA4, 0x30, 0xFF, 0xA4, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xE6, 0x38, 0xFF,
-    0x6E, 0x59, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xF1, 0x61, 0xFF, 0x85, 0x30, 0xFF, 0xC6, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xC6, 0x40, 0xFF, 0x33, 0x6A, 0xFF, 0xC7, 0x40, 0xFF, 0x2A, 0x49, 0xFF, 0xE7, 0x48, 0xFF, 0xA6, 0x38, 0xFF, 0x0B, 0x41, 0xFF, 0xC7, 0x40, 0xFF, 0xA6, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0x66, 0x38, 0xFF, 0x0A, 0x51, 0xFF, 0xE7, 0x48, 0xFF, 0x86, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0x09, 0x51, 0xFF, 0x04, 0x28, 0xFF, 0x49, 0x51, 0xFF, 0x85, 0x38, 0xFF, 0xE7, 0x48, 0xFF, 0xC6, 0x40, 0xFF, 0x25, 0x30, 0xFF, 0xA6, 0x40, 0xFF, 0xA6, 0x48, 0xFF, 0xC7, 0x48, 0xFF, 0x86, 0x40, 0xFF, 0x0A, 0x69, 0xFF, 0xA6, 0x48, 0xFF, 0x29, 0x61, 0xFF, 0xA6, 0x48, 0xFF, 0x65, 0x40, 0xFF, 0xB0, 0x91, 0xFF, 0xE8, 0x58, 0xFF, 0x08, 0x61, 0xFF, 0xA6, 0x48, 0xFF, 0x85, 0x48, 0xFF, 0x87, 0x58, 0xFF, 0x85, 0x50, 0xFF, 0xA5, 0x50, 0xFF, 0x85, 0x48, 0xFF, 0xC6, 0x58, 0xFF, 0x2B, 0x81, 0xFF, 0x65, 0x48, 0xFF, 0x45, 0x48, 0xFF, 0x85, 0x50, 0xFF, 0x45, 0x58, 0xFF, 0x4C, 0x89, 0xFF, 0x45, 0x50, 0xFF, 0xA6, 0x58, 0xFF, 0x86, 0x58, 0xFF, 0x65, 0x50, 0xFF, 0x0B, 0x91, 0xFF, 0xA8, 0x68, 0xFF, 0x66, 0x58, 0xFF, 0xE9, 0x68, 0xFF,
-    0x84, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x09, 0x41, 0xFF, 0x84, 0x30, 0xFF, 0x44, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x06, 0x41, 0xFF, 0xE9, 0x40, 0xFF, 0xC6, 0x38, 0xFF, 0x64, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0x06, 0x41, 0xFF, 0xE6, 0x38, 0xFF, 0xE6, 0x40, 0xFF, 0x64, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0x49, 0x51, 0xFF, 0xC6, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0xE7, 0x40, 0xFF, 0x65, 0x30, 0xFF, 0xE7, 0x40, 0xFF, 0xA6, 0x38, 0xFF, 0xB1, 0x59, 0xFF, 0xA8, 0x40, 0xFF, 0xC7, 0x40, 0xFF, 0x65, 0x30, 0xFF, 0x08, 0x49, 0xFF, 0x89, 0x48, 0xFF, 0xE8, 0x50, 0xFF, 0x65, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0xA6, 0x40, 0xFF, 0x8E, 0x61, 0xFF, 0xE8, 0x48, 0xFF, 0x85, 0x38, 0xFF, 0xE7, 0x48, 0xFF, 0xC6, 0x40, 0xFF, 0x86, 0x40, 0xFF, 0xC7, 0x48, 0xFF, 0xC7, 0x50, 0xFF, 0xE7, 0x48, 0xFF, 0x8B, 0x61, 0xFF, 0x8A, 0x69, 0xFF, 0x29, 0x61, 0xFF, 0x85, 0x48, 0xFF, 0x29, 0x61, 0xFF, 0x6F, 0x79, 0xFF, 0xA6, 0x50, 0xFF, 0xA7, 0x50, 0xFF, 0xA6, 0x48, 0xFF, 0xC7, 0x58, 0xFF, 0x6C, 0x81, 0xFF, 0x85, 0x50, 0xFF, 0xC6, 0x50, 0xFF, 0x64, 0x48, 0xFF,
-    0xC7, 0x60, 0xFF, 0x4C, 0x89, 0xFF, 0xC5, 0x50, 0xFF, 0x65, 0x50, 0xFF, 0xA7, 0x60, 0xFF, 0xA6, 0x58, 0xFF, 0x0A, 0x81, 0xFF, 0x65, 0x50, 0xFF, 0x45, 0x50, 0xFF, 0x65, 0x50, 0xFF, 0xC8, 0x68, 0xFF, 0x4B, 0x89, 0xFF, 0x66, 0x58, 0xFF, 0xA7, 0x60, 0xFF, 0x87, 0x58, 0xFF, 0x87, 0x58, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x84, 0x28, 0xFF, 0x84, 0x28, 0xFF, 0xC5, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0xA4, 0x30, 0xFF, 0x47, 0x49, 0xFF, 0x84, 0x30, 0xFF, 0xC6, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0xC5, 0x38, 0xFF, 0x84, 0x30, 0xFF, 0xE6, 0x40, 0xFF, 0xC7, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xE6, 0x38, 0xFF, 0x08, 0x41, 0xFF, 0xA6, 0x38, 0xFF, 0x8E, 0x59, 0xFF, 0xE7, 0x40, 0xFF, 0x44, 0x28, 0xFF, 0xE8, 0x40, 0xFF, 0x65, 0x30, 0xFF, 0xE7, 0x40, 0xFF, 0xC7, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0x8B, 0x59, 0xFF, 0x33, 0x6A, 0xFF, 0xE8, 0x40, 0xFF, 0xA7, 0x40, 0xFF, 0x86, 0x38, 0xFF, 0xCE, 0x69, 0xFF, 0xCA, 0x50, 0xFF, 0xC7, 0x48, 0xFF, 0x65, 0x38, 0xFF, 0xA6, 0x40, 0xFF, 0x47, 0x38, 0xFF, 0xEA, 0x48, 0xFF, 0xC7, 0x40, 0xFF, 0x65, 0x38, 0xFF, 0xE7, 0x48, 0xFF, 0x2E, 0x59, 0xFF, 0xC7, 0x48, 0xFF, 0xC7, 0x48, 0xFF,
-    0x87, 0x48, 0xFF, 0xA6, 0x48, 0xFF, 0xD1, 0x81, 0xFF, 0x44, 0x38, 0xFF, 0xE7, 0x50, 0xFF, 0xC7, 0x50, 0xFF, 0x4C, 0x69, 0xFF, 0x65, 0x48, 0xFF, 0x08, 0x59, 0xFF, 0xA6, 0x48, 0xFF, 0xA6, 0x50, 0xFF, 0x0B, 0x79, 0xFF, 0xC6, 0x50, 0xFF, 0x64, 0x48, 0xFF, 0x64, 0x48, 0xFF, 0xE7, 0x58, 0xFF, 0x6C, 0x89, 0xFF, 0x85, 0x48, 0xFF, 0xC6, 0x50, 0xFF, 0x66, 0x58, 0xFF, 0xC9, 0x68, 0xFF, 0xA6, 0x58, 0xFF, 0xA6, 0x58, 0xFF, 0x45, 0x50, 0xFF, 0xA6, 0x58, 0xFF, 0xA8, 0x70, 0xFF, 0xA7, 0x60, 0xFF, 0xC7, 0x60, 0xFF, 0xA7, 0x60, 0xFF, 0xA7, 0x60, 0xFF, 0xC8, 0x60, 0xFF, 0xC9, 0x68, 0xFF, 0x44, 0x28, 0xFF, 0x27, 0x49, 0xFF, 0x44, 0x28, 0xFF, 0x4D, 0x59, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0x64, 0x28, 0xFF, 0x43, 0x28, 0xFF, 0x6F, 0x59, 0xFF, 0xA5, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xA4, 0x30, 0xFF, 0x45, 0x28, 0xFF, 0xF2, 0x61, 0xFF, 0xA6, 0x38, 0xFF, 0xA5, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0x07, 0x41, 0xFF, 0x35, 0x62, 0xFF, 0xE7, 0x40, 0xFF, 0xE6, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xCE, 0x61, 0xFF, 0xC6, 0x38, 0xFF, 0x76, 0x62, 0xFF, 0x45, 0x28, 0xFF, 0x4B, 0x51, 0xFF, 0xE7, 0x40, 0xFF, 0xE8, 0x48, 0xFF, 0x7E, 0x6B, 0xFF, 0xA7, 0x38, 0xFF,
-    0xE9, 0x48, 0xFF, 0x86, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0xEA, 0x50, 0xFF, 0xED, 0x48, 0xFF, 0xE8, 0x50, 0xFF, 0x86, 0x38, 0xFF, 0xA7, 0x40, 0xFF, 0x48, 0x38, 0xFF, 0xF9, 0x72, 0xFF, 0xE8, 0x50, 0xFF, 0x86, 0x40, 0xFF, 0x29, 0x59, 0xFF, 0x8E, 0x69, 0xFF, 0x89, 0x40, 0xFF, 0x66, 0x40, 0xFF, 0xA6, 0x40, 0xFF, 0x4E, 0x69, 0xFF, 0xA6, 0x48, 0xFF, 0xE8, 0x50, 0xFF, 0x88, 0x48, 0xFF, 0xA6, 0x48, 0xFF, 0x6B, 0x71, 0xFF, 0xE7, 0x58, 0xFF, 0xA6, 0x50, 0xFF, 0xA7, 0x50, 0xFF, 0x0B, 0x69, 0xFF, 0x85, 0x50, 0xFF, 0xA6, 0x50, 0xFF, 0x85, 0x50, 0xFF, 0x86, 0x50, 0xFF, 0x44, 0x48, 0xFF, 0x85, 0x48, 0xFF, 0x85, 0x48, 0xFF, 0xE7, 0x60, 0xFF, 0x0B, 0x81, 0xFF, 0x65, 0x50, 0xFF, 0x66, 0x50, 0xFF, 0xC7, 0x60, 0xFF, 0x25, 0x58, 0xFF, 0x86, 0x58, 0xFF, 0x86, 0x58, 0xFF, 0x45, 0x50, 0xFF, 0xC7, 0x60, 0xFF, 0x87, 0x58, 0xFF, 0xA7, 0x60, 0xFF, 0xC8, 0x68, 0xFF, 0xA8, 0x68, 0xFF, 0xB0, 0x7A, 0xFF, 0xE6, 0x38, 0xFF, 0x64, 0x28, 0xFF, 0xC5, 0x38, 0xFF, 0xC8, 0x40, 0xFF, 0x2D, 0x51, 0xFF, 0xA5, 0x30, 0xFF, 0xC5, 0x38, 0xFF, 0xE6, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0x8F, 0x59, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0x64, 0x28, 0xFF, 0x49, 0x49, 0xFF, 0xB0, 0x59, 0xFF,
-    0x85, 0x38, 0xFF, 0x64, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x86, 0x38, 0xFF, 0xF4, 0x61, 0xFF, 0xA5, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0xC8, 0x38, 0xFF, 0xC8, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xE9, 0x38, 0xFF, 0xC9, 0x40, 0xFF, 0xA9, 0x40, 0xFF, 0xE8, 0x48, 0xFF, 0x86, 0x40, 0xFF, 0xC8, 0x48, 0xFF, 0x8F, 0x61, 0xFF, 0xE9, 0x50, 0xFF, 0x66, 0x38, 0xFF, 0x86, 0x40, 0xFF, 0x6D, 0x59, 0xFF, 0x1B, 0x73, 0xFF, 0x31, 0x62, 0xFF, 0x86, 0x38, 0xFF, 0xA7, 0x40, 0xFF, 0x87, 0x40, 0xFF, 0x57, 0x7A, 0xFF, 0xC8, 0x48, 0xFF, 0x86, 0x40, 0xFF, 0x0B, 0x61, 0xFF, 0x86, 0x48, 0xFF, 0x26, 0x40, 0xFF, 0xEC, 0x58, 0xFF, 0x2B, 0x61, 0xFF, 0xC7, 0x50, 0xFF, 0x85, 0x48, 0xFF, 0x86, 0x48, 0xFF, 0xD1, 0x91, 0xFF, 0x11, 0x8B, 0xFF, 0xA6, 0x50, 0xFF, 0xA6, 0x50, 0xFF, 0x87, 0x58, 0xFF, 0x6E, 0x89, 0xFF, 0xC7, 0x60, 0xFF, 0x44, 0x48, 0xFF, 0x85, 0x48, 0xFF, 0x85, 0x50, 0xFF, 0x24, 0x50, 0xFF, 0x2D, 0x99, 0xFF, 0x65, 0x50, 0xFF, 0x86, 0x58, 0xFF, 0x45, 0x50, 0xFF, 0xE9, 0x78, 0xFF, 0xEC, 0x90, 0xFF, 0x86, 0x60, 0xFF, 0xA7, 0x60, 0xFF, 0xA8, 0x68, 0xFF, 0xA7, 0x68, 0xFF, 0x2C, 0xA1, 0xFF, 0xA9, 0x78, 0xFF,
-    0x63, 0x28, 0xFF, 0xC6, 0x38, 0xFF, 0x6B, 0x51, 0xFF, 0x84, 0x30, 0xFF, 0x44, 0x28, 0xFF, 0xA5, 0x30, 0xFF, 0x4A, 0x51, 0xFF, 0xE9, 0x40, 0xFF, 0xA5, 0x38, 0xFF, 0xE6, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xD0, 0x61, 0xFF, 0xA6, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0x69, 0x51, 0xFF, 0x65, 0x30, 0xFF, 0x70, 0x59, 0xFF, 0x45, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0x34, 0x6A, 0xFF, 0x65, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0x29, 0x49, 0xFF, 0x86, 0x30, 0xFF, 0x34, 0x6A, 0xFF, 0xC8, 0x40, 0xFF, 0x6B, 0x51, 0xFF, 0x29, 0x49, 0xFF, 0x09, 0x49, 0xFF, 0x0B, 0x31, 0xFF, 0x2B, 0x51, 0xFF, 0x09, 0x51, 0xFF, 0xA7, 0x40, 0xFF, 0x08, 0x51, 0xFF, 0xB2, 0x69, 0xFF, 0x2A, 0x59, 0xFF, 0x66, 0x40, 0xFF, 0x66, 0x38, 0xFF, 0x67, 0x48, 0xFF, 0xFF, 0xB4, 0xFF, 0x6A, 0x61, 0xFF, 0x86, 0x38, 0xFF, 0xC8, 0x48, 0xFF, 0x88, 0x40, 0xFF, 0xD8, 0x82, 0xFF, 0xE8, 0x50, 0xFF, 0xC9, 0x50, 0xFF, 0x66, 0x40, 0xFF, 0x86, 0x48, 0xFF, 0x34, 0x92, 0xFF, 0x2B, 0x61, 0xFF, 0x09, 0x61, 0xFF, 0x85, 0x48, 0xFF, 0xC7, 0x58, 0xFF, 0x12, 0x9A, 0xFF, 0x5D, 0x8C, 0xFF, 0x85, 0x48, 0xFF, 0xC6, 0x50, 0xFF, 0xE8, 0x68, 0xFF, 0x4D, 0x89, 0xFF, 0x99, 0x83, 0xFF, 0x45, 0x48, 0xFF,
-    0xA7, 0x60, 0xFF, 0x66, 0x58, 0xFF, 0xAF, 0x91, 0xFF, 0x08, 0x71, 0xFF, 0x25, 0x50, 0xFF, 0x86, 0x58, 0xFF, 0x86, 0x60, 0xFF, 0x2D, 0x99, 0xFF, 0xA8, 0x60, 0xFF, 0xA7, 0x60, 0xFF, 0x46, 0x58, 0xFF, 0x86, 0x60, 0xFF, 0x4D, 0xA1, 0xFF, 0x87, 0x68, 0xFF, 0xA8, 0x68, 0xFF, 0xC9, 0x70, 0xFF, 0x43, 0x28, 0xFF, 0x64, 0x30, 0xFF, 0x84, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0x08, 0x41, 0xFF, 0x43, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0xC8, 0x40, 0xFF, 0x65, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x8D, 0x59, 0xFF, 0xE8, 0x40, 0xFF, 0xA6, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x45, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0xC7, 0x40, 0xFF, 0xE9, 0x40, 0xFF, 0x86, 0x30, 0xFF, 0xC6, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0x88, 0x30, 0xFF, 0xA8, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0x09, 0x49, 0xFF, 0x49, 0x51, 0xFF, 0x7C, 0x74, 0xFF, 0x6C, 0x59, 0xFF, 0xA7, 0x40, 0xFF, 0x87, 0x40, 0xFF, 0xE8, 0x48, 0xFF, 0xAA, 0x48, 0xFF, 0x0A, 0x59, 0xFF, 0x87, 0x48, 0xFF, 0xA7, 0x40, 0xFF, 0xC9, 0x50, 0xFF, 0xCA, 0x48, 0xFF, 0x0A, 0x59, 0xFF, 0xE8, 0x48, 0xFF, 0xC9, 0x50, 0xFF, 0xE8, 0x48, 0xFF, 0x46, 0x38, 0xFF, 0x29, 0x59, 0xFF,
-    0xA7, 0x48, 0xFF, 0xA7, 0x48, 0xFF, 0xD0, 0x79, 0xFF, 0xAB, 0x71, 0xFF, 0x09, 0x59, 0xFF, 0xC7, 0x50, 0xFF, 0x66, 0x50, 0xFF, 0xB0, 0x81, 0xFF, 0xA9, 0x48, 0xFF, 0xC7, 0x58, 0xFF, 0x65, 0x48, 0xFF, 0x29, 0x71, 0xFF, 0x2E, 0x89, 0xFF, 0x86, 0x58, 0xFF, 0x66, 0x50, 0xFF, 0xA8, 0x60, 0xFF, 0x86, 0x58, 0xFF, 0x6E, 0x99, 0xFF, 0xA6, 0x58, 0xFF, 0x87, 0x60, 0xFF, 0x24, 0x50, 0xFF, 0x6C, 0x89, 0xFF, 0x0E, 0xAA, 0xFF, 0x66, 0x58, 0xFF, 0x66, 0x60, 0xFF, 0x86, 0x68, 0xFF, 0x0B, 0x91, 0xFF, 0x66, 0x68, 0xFF, 0xA7, 0x68, 0xFF, 0x46, 0x60, 0xFF, 0xC8, 0x70, 0xFF, 0xA8, 0x70, 0xFF, 0x84, 0x30, 0xFF, 0x43, 0x28, 0xFF, 0x63, 0x30, 0xFF, 0x44, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0x09, 0x49, 0xFF, 0x65, 0x28, 0xFF, 0x84, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xC8, 0x40, 0xFF, 0x86, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x07, 0x41, 0xFF, 0xC9, 0x40, 0xFF, 0xA6, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x6E, 0x51, 0xFF, 0x86, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0xA8, 0x40, 0xFF, 0x6D, 0x51, 0xFF, 0xC7, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0xE8, 0x40, 0xFF, 0x6F, 0x51, 0xFF, 0xC7, 0x38, 0xFF, 0xC8, 0x40, 0xFF, 0xAB, 0x59, 0xFF, 0xA8, 0x38, 0xFF,
-    0x0A, 0x49, 0xFF, 0xE9, 0x48, 0xFF, 0xA8, 0x40, 0xFF, 0xC9, 0x48, 0xFF, 0x76, 0x82, 0xFF, 0x2A, 0x59, 0xFF, 0x66, 0x40, 0xFF, 0xA7, 0x48, 0xFF, 0xE9, 0x50, 0xFF, 0xA7, 0x40, 0xFF, 0x29, 0x51, 0xFF, 0xA7, 0x40, 0xFF, 0x2A, 0x59, 0xFF, 0xF4, 0x71, 0xFF, 0x86, 0x40, 0xFF, 0x0A, 0x59, 0xFF, 0x09, 0x51, 0xFF, 0xA8, 0x48, 0xFF, 0xC9, 0x58, 0xFF, 0xA6, 0x48, 0xFF, 0x08, 0x59, 0xFF, 0x08, 0x59, 0xFF, 0x50, 0x81, 0xFF, 0x66, 0x50, 0xFF, 0xA7, 0x58, 0xFF, 0x08, 0x61, 0xFF, 0xA7, 0x60, 0xFF, 0x0C, 0x79, 0xFF, 0x45, 0x50, 0xFF, 0x86, 0x58, 0xFF, 0x66, 0x58, 0xFF, 0xEA, 0x70, 0xFF, 0xE8, 0x70, 0xFF, 0x65, 0x50, 0xFF, 0xC8, 0x60, 0xFF, 0x45, 0x58, 0xFF, 0x8D, 0x99, 0xFF, 0x66, 0x60, 0xFF, 0x87, 0x60, 0xFF, 0x86, 0x60, 0xFF, 0xE9, 0x80, 0xFF, 0x09, 0x89, 0xFF, 0x86, 0x68, 0xFF, 0x87, 0x68, 0xFF, 0x87, 0x68, 0xFF, 0x87, 0x68, 0xFF, 0xEA, 0x80, 0xFF, 0xA8, 0x78, 0xFF, 0x64, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0xA5, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0x64, 0x28, 0xFF, 0xC6, 0x38, 0xFF, 0xA5, 0x38, 0xFF, 0x29, 0x49, 0xFF, 0x89, 0x38, 0xFF, 0x24, 0x28, 0xFF, 0x29, 0x51, 0xFF, 0xE9, 0x48, 0xFF, 0xE8, 0x40, 0xFF, 0x08, 0x49, 0xFF, 0x66, 0x28, 0xFF, 0x4B, 0x59, 0xFF,
-    0x65, 0x30, 0xFF, 0x45, 0x28, 0xFF, 0xA6, 0x30, 0xFF, 0x0C, 0x51, 0xFF, 0xE8, 0x50, 0xFF, 0xC8, 0x40, 0xFF, 0xA6, 0x30, 0xFF, 0xE9, 0x40, 0xFF, 0x86, 0x30, 0xFF, 0xA8, 0x40, 0xFF, 0x86, 0x30, 0xFF, 0x09, 0x41, 0xFF, 0x0A, 0x49, 0xFF, 0x2A, 0x49, 0xFF, 0x8B, 0x59, 0xFF, 0xC8, 0x38, 0xFF, 0x4D, 0x51, 0xFF, 0xA8, 0x40, 0xFF, 0x87, 0x40, 0xFF, 0xC9, 0x48, 0xFF, 0xB0, 0x69, 0xFF, 0x0A, 0x59, 0xFF, 0x87, 0x48, 0xFF, 0x87, 0x40, 0xFF, 0x0B, 0x51, 0xFF, 0x66, 0x38, 0xFF, 0x2A, 0x51, 0xFF, 0x66, 0x38, 0xFF, 0xA7, 0x40, 0xFF, 0x66, 0x40, 0xFF, 0x87, 0x40, 0xFF, 0x09, 0x59, 0xFF, 0xA7, 0x48, 0xFF, 0x0B, 0x61, 0xFF, 0x47, 0x48, 0xFF, 0xA7, 0x48, 0xFF, 0x6A, 0x61, 0xFF, 0x0C, 0x69, 0xFF, 0x86, 0x48, 0xFF, 0x66, 0x50, 0xFF, 0x45, 0x48, 0xFF, 0x0A, 0x71, 0xFF, 0x2B, 0x71, 0xFF, 0x24, 0x48, 0xFF, 0xA7, 0x58, 0xFF, 0x09, 0x69, 0xFF, 0x4B, 0x71, 0xFF, 0x09, 0x71, 0xFF, 0x45, 0x50, 0xFF, 0x85, 0x50, 0xFF, 0xC7, 0x60, 0xFF, 0x87, 0x60, 0xFF, 0x66, 0x60, 0xFF, 0x45, 0x60, 0xFF, 0x66, 0x60, 0xFF, 0xA8, 0x78, 0xFF, 0x66, 0x60, 0xFF, 0xA7, 0x68, 0xFF, 0xA7, 0x68, 0xFF, 0xA7, 0x70, 0xFF, 0x68, 0x70, 0xFF, 0xA8, 0x70, 0xFF, 0xE9, 0x78, 0xFF, 0x67, 0x70, 0xFF,
-    0x4C, 0x49, 0xFF, 0x85, 0x30, 0xFF, 0x44, 0x28, 0xFF, 0xA8, 0x40, 0xFF, 0x84, 0x28, 0xFF, 0x11, 0x6A, 0xFF, 0x64, 0x28, 0xFF, 0xA5, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0x4A, 0x49, 0xFF, 0xB1, 0x51, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0x35, 0x62, 0xFF, 0x12, 0x62, 0xFF, 0xC8, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0x86, 0x38, 0xFF, 0x88, 0x28, 0xFF, 0x71, 0x49, 0xFF, 0x9A, 0x73, 0xFF, 0xE9, 0x40, 0xFF, 0xA7, 0x38, 0xFF, 0x0A, 0x41, 0xFF, 0x7A, 0x4A, 0xFF, 0x0A, 0x41, 0xFF, 0x6C, 0x51, 0xFF, 0x8D, 0x51, 0xFF, 0x37, 0x93, 0xFF, 0xFF, 0x5B, 0xFF, 0xCA, 0x38, 0xFF, 0xF0, 0x59, 0xFF, 0xF1, 0x59, 0xFF, 0xCF, 0x51, 0xFF, 0x13, 0x5A, 0xFF, 0x3D, 0x73, 0xFF, 0x2B, 0x59, 0xFF, 0xA8, 0x48, 0xFF, 0x4A, 0x51, 0xFF, 0x6E, 0x59, 0xFF, 0x3F, 0x7C, 0xFF, 0x0A, 0x51, 0xFF, 0xC8, 0x48, 0xFF, 0x2C, 0x59, 0xFF, 0xC9, 0x48, 0xFF, 0x5E, 0x8B, 0xFF, 0x0A, 0x59, 0xFF, 0x2A, 0x69, 0xFF, 0x6B, 0x69, 0xFF, 0xA7, 0x48, 0xFF, 0xED, 0x58, 0xFF, 0x34, 0x92, 0xFF, 0x29, 0x61, 0xFF, 0x65, 0x48, 0xFF, 0x86, 0x50, 0xFF, 0xC9, 0x60, 0xFF, 0x36, 0x9A, 0xFF, 0x29, 0x69, 0xFF, 0x45, 0x50, 0xFF, 0xE8, 0x68, 0xFF, 0xC7, 0x60, 0xFF, 0x35, 0xAA, 0xFF, 0xA7, 0x60, 0xFF,
-    0xC7, 0x70, 0xFF, 0xA7, 0x68, 0xFF, 0x86, 0x58, 0xFF, 0x26, 0x60, 0xFF, 0xB1, 0xC1, 0xFF, 0xC8, 0x78, 0xFF, 0x66, 0x68, 0xFF, 0x66, 0x60, 0xFF, 0x86, 0x68, 0xFF, 0x2E, 0xB9, 0xFF, 0xC8, 0x78, 0xFF, 0xA7, 0x70, 0xFF, 0xA8, 0x70, 0xFF, 0x88, 0x70, 0xFF, 0x0C, 0xA1, 0xFF, 0xA8, 0x78, 0xFF, 0x64, 0x30, 0xFF, 0x86, 0x28, 0xFF, 0x0C, 0x41, 0xFF, 0x64, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xAF, 0x59, 0xFF, 0xA5, 0x38, 0xFF, 0xAB, 0x59, 0xFF, 0xEC, 0x61, 0xFF, 0xA9, 0x38, 0xFF, 0x0C, 0x41, 0xFF, 0x28, 0x49, 0xFF, 0xA8, 0x38, 0xFF, 0x66, 0x28, 0xFF, 0x55, 0x62, 0xFF, 0x29, 0x49, 0xFF, 0xE8, 0x40, 0xFF, 0x66, 0x30, 0xFF, 0x28, 0x49, 0xFF, 0x71, 0x51, 0xFF, 0x0A, 0x41, 0xFF, 0xC7, 0x38, 0xFF, 0x28, 0x49, 0xFF, 0x2B, 0x41, 0xFF, 0xD9, 0x62, 0xFF, 0x2A, 0x49, 0xFF, 0x0A, 0x49, 0xFF, 0x6D, 0x51, 0xFF, 0xCF, 0x59, 0xFF, 0x3F, 0x84, 0xFF, 0xF7, 0x82, 0xFF, 0xB0, 0x49, 0xFF, 0x79, 0x6B, 0xFF, 0x8F, 0x49, 0xFF, 0xDC, 0x62, 0xFF, 0x6D, 0x61, 0xFF, 0xA8, 0x48, 0xFF, 0xE9, 0x50, 0xFF, 0xF3, 0x61, 0xFF, 0xFC, 0x62, 0xFF, 0x6D, 0x59, 0xFF, 0xB3, 0x8A, 0xFF, 0x72, 0x82, 0xFF, 0x46, 0x38, 0xFF, 0x7C, 0x93, 0xFF, 0xEA, 0x58, 0xFF,
-    0xEE, 0x91, 0xFF, 0x2F, 0xA2, 0xFF, 0x4A, 0x61, 0xFF, 0xF9, 0xB2, 0xFF, 0x2A, 0x69, 0xFF, 0xC8, 0x98, 0xFF, 0x46, 0x68, 0xFF, 0xE9, 0x68, 0xFF, 0x35, 0xA2, 0xFF, 0x09, 0x61, 0xFF, 0x2A, 0x69, 0xFF, 0xA8, 0x68, 0xFF, 0xE8, 0x68, 0xFF, 0x34, 0xAA, 0xFF, 0xC9, 0x70, 0xFF, 0xA8, 0x70, 0xFF, 0x66, 0x50, 0xFF, 0x65, 0x58, 0xFF, 0x8B, 0x88, 0xFF, 0xA8, 0x80, 0xFF, 0x86, 0x68, 0xFF, 0x66, 0x68, 0xFF, 0x65, 0x68, 0xFF, 0xB0, 0xB1, 0xFF, 0x66, 0x68, 0xFF, 0x67, 0x70, 0xFF, 0xA8, 0x80, 0xFF, 0x88, 0x78, 0xFF, 0x2D, 0xB1, 0xFF, 0xA8, 0x78, 0xFF, 0x27, 0x70, 0xFF, 0xA8, 0x80, 0xFF, 0x43, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0x6C, 0x51, 0xFF, 0xC7, 0x38, 0xFF, 0x85, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x2B, 0x49, 0xFF, 0x6B, 0x51, 0xFF, 0x49, 0x51, 0xFF, 0xA6, 0x38, 0xFF, 0xAB, 0x59, 0xFF, 0x8E, 0x51, 0xFF, 0x09, 0x41, 0xFF, 0x65, 0x30, 0xFF, 0xC7, 0x40, 0xFF, 0xA6, 0x30, 0xFF, 0xB0, 0x59, 0xFF, 0xA7, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0x8C, 0x51, 0xFF, 0x33, 0x62, 0xFF, 0xA8, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0x70, 0x6A, 0xFF, 0xE8, 0x38, 0xFF, 0x8E, 0x51, 0xFF, 0xA8, 0x38, 0xFF, 0x4C, 0x51, 0xFF, 0x8C, 0x51, 0xFF, 0xFC, 0x5A, 0xFF,
-    0x8E, 0x51, 0xFF, 0x0B, 0x49, 0xFF, 0xA9, 0x40, 0xFF, 0x2B, 0x51, 0xFF, 0xEF, 0x40, 0xFF, 0x4D, 0x59, 0xFF, 0xC8, 0x48, 0xFF, 0xA8, 0x48, 0xFF, 0xEA, 0x50, 0xFF, 0x28, 0x28, 0xFF, 0x2C, 0x51, 0xFF, 0xE9, 0x50, 0xFF, 0xA9, 0x48, 0xFF, 0xF9, 0x82, 0xFF, 0x87, 0x40, 0xFF, 0x6D, 0x69, 0xFF, 0x87, 0x48, 0xFF, 0x4B, 0x61, 0xFF, 0x75, 0x8A, 0xFF, 0xC9, 0x60, 0xFF, 0xE9, 0x60, 0xFF, 0x87, 0x50, 0xFF, 0x68, 0x58, 0xFF, 0x90, 0x89, 0xFF, 0x2C, 0x71, 0xFF, 0xC8, 0x60, 0xFF, 0x4B, 0x71, 0xFF, 0x87, 0x60, 0xFF, 0x4E, 0x91, 0xFF, 0x6B, 0x89, 0xFF, 0xA7, 0x68, 0xFF, 0xAD, 0x79, 0xFF, 0x66, 0x60, 0xFF, 0x2B, 0x99, 0xFF, 0xA7, 0x70, 0xFF, 0xC8, 0x78, 0xFF, 0x29, 0x89, 0xFF, 0x2E, 0xA1, 0xFF, 0x67, 0x78, 0xFF, 0x67, 0x78, 0xFF, 0x46, 0x70, 0xFF, 0x2A, 0x91, 0xFF, 0x4D, 0xB1, 0xFF, 0x88, 0x78, 0xFF, 0x67, 0x70, 0xFF, 0x88, 0x78, 0xFF, 0xC9, 0x80, 0xFF, 0xC9, 0x80, 0xFF, 0x64, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0xE7, 0x38, 0xFF, 0x44, 0x28, 0xFF, 0xA6, 0x38, 0xFF, 0x64, 0x28, 0xFF, 0x64, 0x30, 0xFF, 0x4A, 0x51, 0xFF, 0x65, 0x30, 0xFF, 0xC8, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0xCA, 0x48, 0xFF, 0x29, 0x49, 0xFF, 0x8C, 0x59, 0xFF, 0xA9, 0x38, 0xFF, 0x6D, 0x51, 0xFF,
-    0xA6, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x6E, 0x51, 0xFF, 0xC8, 0x38, 0xFF, 0x09, 0x41, 0xFF, 0xEC, 0x61, 0xFF, 0xF1, 0x61, 0xFF, 0xA8, 0x40, 0xFF, 0x8C, 0x51, 0xFF, 0xA8, 0x38, 0xFF, 0xAF, 0x59, 0xFF, 0xAA, 0x38, 0xFF, 0x2B, 0x49, 0xFF, 0x31, 0x62, 0xFF, 0xEA, 0x38, 0xFF, 0xD0, 0x59, 0xFF, 0xCB, 0x38, 0xFF, 0x2D, 0x49, 0xFF, 0x2D, 0x51, 0xFF, 0xD9, 0x72, 0xFF, 0x8E, 0x61, 0xFF, 0xC9, 0x48, 0xFF, 0xC9, 0x48, 0xFF, 0x71, 0x41, 0xFF, 0xAA, 0x40, 0xFF, 0xCE, 0x61, 0xFF, 0x51, 0x7A, 0xFF, 0x27, 0x38, 0xFF, 0x35, 0x82, 0xFF, 0x0B, 0x59, 0xFF, 0xEA, 0x58, 0xFF, 0xEA, 0x58, 0xFF, 0xB3, 0x79, 0xFF, 0x4B, 0x69, 0xFF, 0xE8, 0x58, 0xFF, 0xC8, 0x58, 0xFF, 0xB1, 0x81, 0xFF, 0x66, 0x58, 0xFF, 0x87, 0x58, 0xFF, 0x8C, 0x79, 0xFF, 0x87, 0x60, 0xFF, 0x6E, 0x89, 0xFF, 0xA7, 0x60, 0xFF, 0x86, 0x60, 0xFF, 0x86, 0x60, 0xFF, 0xCA, 0x78, 0xFF, 0xC9, 0x78, 0xFF, 0x66, 0x60, 0xFF, 0x45, 0x58, 0xFF, 0x67, 0x68, 0xFF, 0xC8, 0x78, 0xFF, 0x46, 0x68, 0xFF, 0x46, 0x68, 0xFF, 0x66, 0x70, 0xFF, 0x6C, 0xA1, 0xFF, 0x4B, 0x99, 0xFF, 0xA8, 0x78, 0xFF, 0xA8, 0x78, 0xFF, 0xC8, 0x80, 0xFF, 0xC9, 0x80, 0xFF, 0xA9, 0x80, 0xFF, 0x0B, 0x91, 0xFF, 0xCA, 0x90, 0xFF,
-    0x44, 0x30, 0xFF, 0x44, 0x28, 0xFF, 0xE6, 0x38, 0xFF, 0x64, 0x30, 0xFF, 0x8A, 0x51, 0xFF, 0xA6, 0x38, 0xFF, 0x07, 0x41, 0xFF, 0x64, 0x30, 0xFF, 0x66, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0x87, 0x40, 0xFF, 0xAB, 0x59, 0xFF, 0xA7, 0x38, 0xFF, 0xA8, 0x38, 0xFF, 0x66, 0x30, 0xFF, 0xA5, 0x40, 0xFF, 0x09, 0x49, 0xFF, 0x4B, 0x51, 0xFF, 0xA7, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0x6C, 0x71, 0xFF, 0x89, 0x38, 0xFF, 0x8C, 0x51, 0xFF, 0xA7, 0x38, 0xFF, 0x2C, 0x49, 0xFF, 0xCB, 0x48, 0xFF, 0xC8, 0x38, 0xFF, 0x8D, 0x59, 0xFF, 0x4D, 0x49, 0xFF, 0xEA, 0x40, 0xFF, 0x6E, 0x51, 0xFF, 0xEC, 0x40, 0xFF, 0x8F, 0x51, 0xFF, 0x0E, 0x41, 0xFF, 0xCF, 0x59, 0xFF, 0x90, 0x59, 0xFF, 0x33, 0x72, 0xFF, 0x8E, 0x59, 0xFF, 0xCA, 0x48, 0xFF, 0xC9, 0x40, 0xFF, 0x90, 0x61, 0xFF, 0xCA, 0x48, 0xFF, 0x6D, 0x59, 0xFF, 0xEB, 0x50, 0xFF, 0x8F, 0x69, 0xFF, 0xCA, 0x50, 0xFF, 0x47, 0x40, 0xFF, 0xAA, 0x58, 0xFF, 0x6E, 0x71, 0xFF, 0x88, 0x50, 0xFF, 0x6C, 0x71, 0xFF, 0xC7, 0x58, 0xFF, 0x8E, 0x79, 0xFF, 0x87, 0x58, 0xFF, 0x86, 0x58, 0xFF, 0xE9, 0x68, 0xFF, 0x2C, 0x81, 0xFF, 0x2A, 0x79, 0xFF, 0xC8, 0x60, 0xFF, 0x86, 0x58, 0xFF, 0x6C, 0x91, 0xFF, 0x4B, 0x89, 0xFF, 0xC7, 0x68, 0xFF, 0x66, 0x68, 0xFF,
-    0x0A, 0x81, 0xFF, 0x2A, 0x89, 0xFF, 0x66, 0x68, 0xFF, 0x46, 0x68, 0xFF, 0x0A, 0x91, 0xFF, 0xAA, 0x90, 0xFF, 0x66, 0x70, 0xFF, 0x87, 0x70, 0xFF, 0x66, 0x70, 0xFF, 0x67, 0x78, 0xFF, 0xE9, 0x88, 0xFF, 0xA8, 0x80, 0xFF, 0xA8, 0x80, 0xFF, 0xA9, 0x80, 0xFF, 0xA9, 0x88, 0xFF, 0xEA, 0x90, 0xFF, 0xA5, 0x38, 0xFF, 0x07, 0x41, 0xFF, 0xA7, 0x48, 0xFF, 0x32, 0x7A, 0xFF, 0xE8, 0x40, 0xFF, 0xA6, 0x30, 0xFF, 0x08, 0x41, 0xFF, 0x45, 0x30, 0xFF, 0x16, 0x6A, 0xFF, 0x76, 0x6A, 0xFF, 0x86, 0x30, 0xFF, 0x08, 0x41, 0xFF, 0xA7, 0x38, 0xFF, 0xA9, 0x38, 0xFF, 0x78, 0x6A, 0xFF, 0xC8, 0x40, 0xFF, 0xA6, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0xAA, 0x38, 0xFF, 0x98, 0x5A, 0xFF, 0xC9, 0x38, 0xFF, 0xEE, 0x61, 0xFF, 0x87, 0x30, 0xFF, 0xA9, 0x38, 0xFF, 0x1F, 0x6C, 0xFF, 0xA9, 0x38, 0xFF, 0x6C, 0x49, 0xFF, 0xA9, 0x38, 0xFF, 0xEB, 0x40, 0xFF, 0xBE, 0x4C, 0xFF, 0xEB, 0x38, 0xFF, 0xCF, 0x51, 0xFF, 0x6E, 0x51, 0xFF, 0xCB, 0x38, 0xFF, 0xEC, 0x40, 0xFF, 0x6F, 0x51, 0xFF, 0x11, 0x6A, 0xFF, 0xCA, 0x48, 0xFF, 0xAA, 0x40, 0xFF, 0x4D, 0x59, 0xFF, 0x4D, 0x49, 0xFF, 0x2C, 0x51, 0xFF, 0xCA, 0x48, 0xFF, 0xCA, 0x48, 0xFF, 0x68, 0x48, 0xFF, 0x48, 0x40, 0xFF, 0xAA, 0x58, 0xFF,
-    0x67, 0x48, 0xFF, 0x2B, 0x69, 0xFF, 0x4B, 0x69, 0xFF, 0x0B, 0x69, 0xFF, 0x87, 0x50, 0xFF, 0x86, 0x58, 0xFF, 0x46, 0x50, 0xFF, 0x2B, 0x79, 0xFF, 0x2B, 0x79, 0xFF, 0x87, 0x60, 0xFF, 0xA9, 0x70, 0xFF, 0x0A, 0x79, 0xFF, 0xA6, 0x68, 0xFF, 0x86, 0x60, 0xFF, 0x2B, 0x89, 0xFF, 0xA8, 0x70, 0xFF, 0x66, 0x68, 0xFF, 0x86, 0x68, 0xFF, 0xC8, 0x78, 0xFF, 0x67, 0x70, 0xFF, 0x46, 0x70, 0xFF, 0x46, 0x70, 0xFF, 0x87, 0x78, 0xFF, 0x87, 0x78, 0xFF, 0xA8, 0x78, 0xFF, 0x88, 0x80, 0xFF, 0x88, 0x80, 0xFF, 0xA8, 0x80, 0xFF, 0xA9, 0x80, 0xFF, 0x88, 0x80, 0xFF, 0xEA, 0x90, 0xFF, 0x89, 0x88, 0xFF, 0x44, 0x28, 0xFF, 0xEC, 0x69, 0xFF, 0x2C, 0x49, 0xFF, 0xA5, 0x38, 0xFF, 0xA8, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0xEC, 0x59, 0xFF, 0x4F, 0x49, 0xFF, 0xC7, 0x38, 0xFF, 0x87, 0x38, 0xFF, 0xE9, 0x40, 0xFF, 0x86, 0x30, 0xFF, 0x15, 0x5A, 0xFF, 0xC9, 0x40, 0xFF, 0x86, 0x38, 0xFF, 0x2C, 0x41, 0xFF, 0x89, 0x28, 0xFF, 0xB0, 0x51, 0xFF, 0x67, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0xC8, 0x38, 0xFF, 0x3C, 0x73, 0xFF, 0xEF, 0x51, 0xFF, 0xA7, 0x38, 0xFF, 0x68, 0x30, 0xFF, 0xAF, 0x49, 0xFF, 0x5F, 0x7C, 0xFF, 0x34, 0x5A, 0xFF, 0xCA, 0x38, 0xFF, 0xCA, 0x40, 0xFF, 0xB3, 0x41, 0xFF, 0x5D, 0x2D, 0xFF,
-    0x73, 0x62, 0xFF, 0x2D, 0x41, 0xFF, 0xAB, 0x38, 0xFF, 0x51, 0x41, 0xFF, 0xFF, 0x67, 0xFF, 0x35, 0x72, 0xFF, 0x0C, 0x51, 0xFF, 0xCA, 0x40, 0xFF, 0x4F, 0x51, 0xFF, 0xDF, 0x97, 0xFF, 0x95, 0x62, 0xFF, 0x0B, 0x51, 0xFF, 0x89, 0x40, 0xFF, 0xAB, 0x48, 0xFF, 0x1F, 0x84, 0xFF, 0x0A, 0x59, 0xFF, 0x67, 0x48, 0xFF, 0xC9, 0x58, 0xFF, 0xD0, 0x79, 0xFF, 0x1D, 0x93, 0xFF, 0xC8, 0x58, 0xFF, 0xC8, 0x60, 0xFF, 0xE9, 0x60, 0xFF, 0xAD, 0x89, 0xFF, 0x79, 0xAA, 0xFF, 0xEB, 0x88, 0xFF, 0x66, 0x60, 0xFF, 0xE8, 0x78, 0xFF, 0xC9, 0x78, 0xFF, 0x15, 0xC2, 0xFF, 0x14, 0xCA, 0xFF, 0x0A, 0x79, 0xFF, 0xE8, 0x78, 0xFF, 0xC7, 0x70, 0xFF, 0xB1, 0xC1, 0xFF, 0xB3, 0xB9, 0xFF, 0xC8, 0x88, 0xFF, 0x67, 0x78, 0xFF, 0x67, 0x70, 0xFF, 0x4F, 0xC1, 0xFF, 0x69, 0x88, 0xFF, 0xD0, 0xD1, 0xFF, 0x88, 0x80, 0xFF, 0xA8, 0x88, 0xFF, 0x2D, 0xC1, 0xFF, 0x48, 0x88, 0xFF, 0x2E, 0xC9, 0xFF, 0xA9, 0x90, 0xFF, 0xC6, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0xE8, 0x40, 0xFF, 0xA6, 0x38, 0xFF, 0xA7, 0x38, 0xFF, 0x2B, 0x49, 0xFF, 0x45, 0x28, 0xFF, 0x08, 0x41, 0xFF, 0x65, 0x30, 0xFF, 0xCD, 0x61, 0xFF, 0x0C, 0x49, 0xFF, 0xA6, 0x30, 0xFF, 0x25, 0x28, 0xFF, 0x0B, 0x49, 0xFF, 0x90, 0x51, 0xFF, 0xA7, 0x38, 0xFF,
-    0xA6, 0x30, 0xFF, 0x66, 0x30, 0xFF, 0x70, 0x49, 0xFF, 0x88, 0x30, 0xFF, 0x2A, 0x49, 0xFF, 0xE9, 0x38, 0xFF, 0x51, 0x39, 0xFF, 0x34, 0x62, 0xFF, 0x88, 0x30, 0xFF, 0x0B, 0x41, 0xFF, 0xCB, 0x38, 0xFF, 0x17, 0x4A, 0xFF, 0xEC, 0x40, 0xFF, 0xCA, 0x38, 0xFF, 0x51, 0x41, 0xFF, 0x1E, 0x4B, 0xFF, 0x34, 0x5A, 0xFF, 0x2D, 0x41, 0xFF, 0xEC, 0x38, 0xFF, 0x5C, 0x53, 0xFF, 0x9F, 0x97, 0xFF, 0x76, 0x6A, 0xFF, 0x2D, 0x51, 0xFF, 0xAA, 0x38, 0xFF, 0xD0, 0x38, 0xFF, 0x1D, 0x94, 0xFF, 0x70, 0x51, 0xFF, 0xCA, 0x48, 0xFF, 0x6A, 0x40, 0xFF, 0x5E, 0x73, 0xFF, 0xF7, 0x62, 0xFF, 0x0B, 0x59, 0xFF, 0x87, 0x50, 0xFF, 0x6B, 0x50, 0xFF, 0xF4, 0x91, 0xFF, 0x88, 0x58, 0xFF, 0x8C, 0x79, 0xFF, 0x46, 0x58, 0xFF, 0xF4, 0x91, 0xFF, 0x4E, 0x79, 0xFF, 0x26, 0x58, 0xFF, 0xA8, 0x68, 0xFF, 0xC8, 0x70, 0xFF, 0x92, 0xA1, 0xFF, 0x05, 0x60, 0xFF, 0xA6, 0x70, 0xFF, 0x45, 0x68, 0xFF, 0x8F, 0x99, 0xFF, 0xCA, 0x78, 0xFF, 0x87, 0x70, 0xFF, 0xA7, 0x78, 0xFF, 0x05, 0x68, 0xFF, 0x4E, 0xB1, 0xFF, 0x2D, 0xB9, 0xFF, 0x2A, 0x99, 0xFF, 0x88, 0x80, 0xFF, 0x0B, 0xA9, 0xFF, 0x47, 0x80, 0xFF, 0xAF, 0xC9, 0xFF, 0xA9, 0x90, 0xFF, 0x69, 0x88, 0xFF, 0xA9, 0x88, 0xFF, 0xEB, 0xA0, 0xFF, 0x0B, 0xA1, 0xFF,
-    0x64, 0x30, 0xFF, 0xC7, 0x38, 0xFF, 0x45, 0x28, 0xFF, 0x07, 0x41, 0xFF, 0x45, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0x45, 0x28, 0xFF, 0x85, 0x30, 0xFF, 0x45, 0x28, 0xFF, 0x4B, 0x51, 0xFF, 0xA8, 0x38, 0xFF, 0x66, 0x30, 0xFF, 0x87, 0x38, 0xFF, 0x0A, 0x49, 0xFF, 0xE9, 0x40, 0xFF, 0xE7, 0x40, 0xFF, 0xA8, 0x38, 0xFF, 0x2C, 0x49, 0xFF, 0x4C, 0x49, 0xFF, 0x92, 0x6A, 0xFF, 0x0C, 0x41, 0xFF, 0x4C, 0x49, 0xFF, 0x0D, 0x39, 0xFF, 0x88, 0x38, 0xFF, 0x90, 0x51, 0xFF, 0xD0, 0x59, 0xFF, 0xAF, 0x51, 0xFF, 0x2E, 0x39, 0xFF, 0x92, 0x51, 0xFF, 0x8F, 0x51, 0xFF, 0xAD, 0x30, 0xFF, 0x0F, 0x31, 0xFF, 0xF4, 0x49, 0xFF, 0x2E, 0x39, 0xFF, 0x8F, 0x49, 0xFF, 0x39, 0x73, 0xFF, 0x38, 0x52, 0xFF, 0xB9, 0x5A, 0xFF, 0x0E, 0x41, 0xFF, 0x2E, 0x39, 0xFF, 0xF4, 0x59, 0xFF, 0x2D, 0x49, 0xFF, 0xD1, 0x61, 0xFF, 0x0C, 0x51, 0xFF, 0xD3, 0x69, 0xFF, 0xD0, 0x69, 0xFF, 0xF1, 0x69, 0xFF, 0x0C, 0x61, 0xFF, 0xD2, 0x89, 0xFF, 0xA9, 0x58, 0xFF, 0x0A, 0x69, 0xFF, 0xCA, 0x60, 0xFF, 0x70, 0x81, 0xFF, 0xC7, 0x68, 0xFF, 0xC9, 0x68, 0xFF, 0x30, 0x92, 0xFF, 0xAE, 0x99, 0xFF, 0xAD, 0x91, 0xFF, 0xA8, 0x70, 0xFF, 0x87, 0x68, 0xFF, 0x4C, 0x99, 0xFF, 0xAE, 0xA9, 0xFF, 0x46, 0x68, 0xFF, 0x4B, 0x89, 0xFF,
-    0xCA, 0x88, 0xFF, 0x49, 0x80, 0xFF, 0xA9, 0x80, 0xFF, 0x47, 0x78, 0xFF, 0x27, 0x78, 0xFF, 0x0B, 0xA1, 0xFF, 0xC8, 0x90, 0xFF, 0x88, 0x80, 0xFF, 0xA9, 0x88, 0xFF, 0x68, 0x88, 0xFF, 0xA9, 0x90, 0xFF, 0xCA, 0x90, 0xFF, 0x89, 0x90, 0xFF, 0xCA, 0x98, 0xFF, 0x0C, 0xA1, 0xFF, 0xAA, 0x98, 0xFF, 0x64, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xAA, 0x51, 0xFF, 0x86, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xC8, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xE9, 0x40, 0xFF, 0x86, 0x38, 0xFF, 0x66, 0x30, 0xFF, 0x24, 0x28, 0xFF, 0x26, 0x28, 0xFF, 0xA7, 0x38, 0xFF, 0x65, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0x4A, 0x51, 0xFF, 0x30, 0x62, 0xFF, 0xF0, 0x59, 0xFF, 0x2B, 0x61, 0xFF, 0x4D, 0x49, 0xFF, 0x0B, 0x39, 0xFF, 0x0A, 0x41, 0xFF, 0x88, 0x30, 0xFF, 0xCA, 0x48, 0xFF, 0x8E, 0x51, 0xFF, 0x4E, 0x41, 0xFF, 0xAB, 0x30, 0xFF, 0x4E, 0x49, 0xFF, 0xEF, 0x38, 0xFF, 0x2E, 0x31, 0xFF, 0x14, 0x4A, 0xFF, 0xD3, 0x49, 0xFF, 0x50, 0x39, 0xFF, 0x37, 0x42, 0xFF, 0x15, 0x4A, 0xFF, 0xFB, 0x52, 0xFF, 0x70, 0x49, 0xFF, 0x50, 0x41, 0xFF, 0xD2, 0x61, 0xFF, 0xD3, 0x59, 0xFF, 0xB3, 0x59, 0xFF, 0xAC, 0x48, 0xFF, 0x8B, 0x40, 0xFF, 0x8E, 0x69, 0xFF, 0xD6, 0x7A, 0xFF, 0x4E, 0x69, 0xFF,
-    0x68, 0x50, 0xFF, 0x89, 0x50, 0xFF, 0xA9, 0x60, 0xFF, 0xAA, 0x60, 0xFF, 0xAD, 0x81, 0xFF, 0x87, 0x68, 0xFF, 0x0C, 0x71, 0xFF, 0xEC, 0x70, 0xFF, 0xE9, 0x70, 0xFF, 0xC8, 0x78, 0xFF, 0x09, 0x81, 0xFF, 0x46, 0x68, 0xFF, 0x86, 0x70, 0xFF, 0x09, 0x91, 0xFF, 0x29, 0x91, 0xFF, 0x4B, 0x91, 0xFF, 0x09, 0x89, 0xFF, 0xC8, 0x88, 0xFF, 0x67, 0x78, 0xFF, 0x87, 0x80, 0xFF, 0x66, 0x80, 0xFF, 0x67, 0x80, 0xFF, 0xA9, 0x90, 0xFF, 0x88, 0x88, 0xFF, 0xA8, 0x90, 0xFF, 0x88, 0x88, 0xFF, 0x0A, 0x99, 0xFF, 0x88, 0x90, 0xFF, 0x89, 0x90, 0xFF, 0xEA, 0xA0, 0xFF, 0xCA, 0xA0, 0xFF, 0xCA, 0xA0, 0xFF, 0x43, 0x28, 0xFF, 0x65, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x87, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0x66, 0x30, 0xFF, 0x2A, 0x49, 0xFF, 0x85, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0xEA, 0x40, 0xFF, 0x45, 0x28, 0xFF, 0x66, 0x30, 0xFF, 0x87, 0x30, 0xFF, 0x26, 0x28, 0xFF, 0xE8, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0x08, 0x41, 0xFF, 0x72, 0x6A, 0xFF, 0x6C, 0x49, 0xFF, 0x8A, 0x30, 0xFF, 0x95, 0x6A, 0xFF, 0x0C, 0x41, 0xFF, 0x88, 0x38, 0xFF, 0xAA, 0x38, 0xFF, 0x2D, 0x49, 0xFF, 0x76, 0x4A, 0xFF, 0x91, 0x41, 0xFF, 0x30, 0x31, 0xFF, 0x2D, 0x41, 0xFF, 0x30, 0x39, 0xFF, 0x77, 0x52, 0xFF,
-    0xF5, 0x41, 0xFF, 0x57, 0x4A, 0xFF, 0x51, 0x39, 0xFF, 0x37, 0x32, 0xFF, 0x35, 0x42, 0xFF, 0x9E, 0x53, 0xFF, 0xB2, 0x41, 0xFF, 0xEF, 0x28, 0xFF, 0x51, 0x49, 0xFF, 0xB3, 0x59, 0xFF, 0x36, 0x6A, 0xFF, 0xAC, 0x48, 0xFF, 0x0F, 0x49, 0xFF, 0xB1, 0x69, 0xFF, 0x18, 0x8B, 0xFF, 0x4D, 0x69, 0xFF, 0xCA, 0x60, 0xFF, 0x89, 0x58, 0xFF, 0x68, 0x58, 0xFF, 0xD0, 0x71, 0xFF, 0xCA, 0x68, 0xFF, 0xA7, 0x68, 0xFF, 0x0B, 0x71, 0xFF, 0x48, 0x58, 0xFF, 0x88, 0x68, 0xFF, 0x87, 0x70, 0xFF, 0x87, 0x70, 0xFF, 0xA7, 0x78, 0xFF, 0xC7, 0x80, 0xFF, 0x86, 0x78, 0xFF, 0x66, 0x78, 0xFF, 0x4B, 0x91, 0xFF, 0x87, 0x78, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0x09, 0x91, 0xFF, 0x87, 0x88, 0xFF, 0x67, 0x88, 0xFF, 0x47, 0x80, 0xFF, 0xA8, 0x90, 0xFF, 0x6C, 0x99, 0xFF, 0x88, 0x90, 0xFF, 0x47, 0x88, 0xFF, 0x2B, 0xA9, 0xFF, 0x69, 0x90, 0xFF, 0xEA, 0xA0, 0xFF, 0xEB, 0xA8, 0xFF, 0xA9, 0xA0, 0xFF, 0x87, 0x38, 0xFF, 0x66, 0x30, 0xFF, 0x2B, 0x51, 0xFF, 0x86, 0x30, 0xFF, 0x4C, 0x59, 0xFF, 0x0B, 0x41, 0xFF, 0x2F, 0x7A, 0xFF, 0xAF, 0x61, 0xFF, 0x66, 0x38, 0xFF, 0xD1, 0x61, 0xFF, 0xF1, 0x61, 0xFF, 0x27, 0x28, 0xFF, 0x71, 0x51, 0xFF, 0x59, 0x83, 0xFF, 0x0D, 0x49, 0xFF, 0x98, 0x72, 0xFF,
-    0x87, 0x30, 0xFF, 0xF9, 0x62, 0xFF, 0x50, 0x49, 0xFF, 0x0B, 0x41, 0xFF, 0x9F, 0x83, 0xFF, 0x7D, 0x73, 0xFF, 0x13, 0x31, 0xFF, 0xC9, 0x38, 0xFF, 0xAD, 0x38, 0xFF, 0x5F, 0x5B, 0xFF, 0x5D, 0x35, 0xFF, 0x56, 0x32, 0xFF, 0xD7, 0x42, 0xFF, 0x6F, 0x41, 0xFF, 0xBF, 0x5F, 0xFF, 0xFF, 0xAF, 0xFF, 0x1F, 0x87, 0xFF, 0x15, 0x42, 0xFF, 0x78, 0x42, 0xFF, 0x3E, 0x1C, 0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0x5C, 0xFF, 0x36, 0x4A, 0xFF, 0x17, 0x2A, 0xFF, 0xDF, 0x4C, 0xFF, 0xFF, 0x97, 0xFF, 0x36, 0x62, 0xFF, 0xEE, 0x48, 0xFF, 0xB8, 0x4A, 0xFF, 0x3C, 0x7B, 0xFF, 0xBF, 0xAD, 0xFF, 0x4E, 0x69, 0xFF, 0xC9, 0x58, 0xFF, 0x69, 0x58, 0xFF, 0x93, 0x99, 0xFF, 0xFF, 0xB3, 0xFF, 0xA9, 0x68, 0xFF, 0x88, 0x68, 0xFF, 0x8E, 0x89, 0xFF, 0xFE, 0xE5, 0xFF, 0xBA, 0xAA, 0xFF, 0x3D, 0xD3, 0xFF, 0xA8, 0x70, 0xFF, 0x87, 0x70, 0xFF, 0x87, 0x78, 0xFF, 0xB5, 0xFA, 0xFF, 0x56, 0xE2, 0xFF, 0xC9, 0x88, 0xFF, 0xA8, 0x80, 0xFF, 0x87, 0x78, 0xFF, 0x2D, 0xD1, 0xFF, 0xD3, 0xD9, 0xFF, 0x26, 0x80, 0xFF, 0xA8, 0x90, 0xFF, 0x68, 0x90, 0xFF, 0xA8, 0xA0, 0xFF, 0xB1, 0xE9, 0xFF, 0x8F, 0xE1, 0xFF, 0xA8, 0xA0, 0xFF, 0x48, 0x98, 0xFF, 0x89, 0xA8, 0xFF, 0x70, 0xD1, 0xFF, 0x0D, 0xE9, 0xFF, 0xEA, 0xB0, 0xFF,
-    0x85, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0xA6, 0x38, 0xFF, 0xA7, 0x30, 0xFF, 0x89, 0x20, 0xFF, 0xB2, 0x21, 0xFF, 0xA9, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x74, 0x5A, 0xFF, 0x58, 0x73, 0xFF, 0x88, 0x38, 0xFF, 0xCA, 0x38, 0xFF, 0x1F, 0x7D, 0xFF, 0xEA, 0x48, 0xFF, 0xC8, 0x48, 0xFF, 0x67, 0x38, 0xFF, 0xEB, 0x38, 0xFF, 0x1A, 0x5C, 0xFF, 0x4E, 0x39, 0xFF, 0xED, 0x38, 0xFF, 0xB7, 0x62, 0xFF, 0x0E, 0x31, 0xFF, 0xAB, 0x40, 0xFF, 0x10, 0x41, 0xFF, 0x6F, 0x51, 0xFF, 0x38, 0x53, 0xFF, 0xB3, 0x41, 0xFF, 0xDD, 0x7B, 0xFF, 0xD3, 0x51, 0xFF, 0x73, 0x21, 0xFF, 0x3F, 0x7E, 0xFF, 0xBD, 0x43, 0xFF, 0xB9, 0x42, 0xFF, 0x57, 0x42, 0xFF, 0x1E, 0x26, 0xFF, 0xFF, 0xD7, 0xFF, 0xBE, 0x5D, 0xFF, 0xF5, 0x41, 0xFF, 0x18, 0x3A, 0xFF, 0x1F, 0x25, 0xFF, 0x3A, 0x4A, 0xFF, 0x9F, 0x63, 0xFF, 0x2F, 0x51, 0xFF, 0x3F, 0xA7, 0xFF, 0xFC, 0x92, 0xFF, 0xB8, 0x6A, 0xFF, 0x91, 0x89, 0xFF, 0xB8, 0x9A, 0xFF, 0x78, 0xA2, 0xFF, 0xAA, 0x68, 0xFF, 0xDF, 0xC6, 0xFF, 0x30, 0x89, 0xFF, 0xD4, 0xA1, 0xFF, 0x35, 0x8A, 0xFF, 0x5E, 0xB7, 0xFF, 0x6E, 0xB1, 0xFF, 0xED, 0x98, 0xFF, 0x49, 0x78, 0xFF, 0x26, 0x70, 0xFF, 0x2B, 0xB1, 0xFF, 0x0D, 0xB9, 0xFF, 0x2C, 0xC1, 0xFF, 0x4E, 0xA1, 0xFF,
-    0x49, 0x88, 0xFF, 0x2B, 0xB1, 0xFF, 0x6E, 0xA9, 0xFF, 0xCB, 0xB0, 0xFF, 0x07, 0x88, 0xFF, 0x11, 0xDA, 0xFF, 0xEC, 0xB8, 0xFF, 0x0B, 0xB9, 0xFF, 0x8E, 0xD1, 0xFF, 0x2B, 0xB1, 0xFF, 0x49, 0x98, 0xFF, 0xA9, 0xA8, 0xFF, 0x69, 0xA0, 0xFF, 0xCB, 0xB0, 0xFF, 0x89, 0xA8, 0xFF, 0xCA, 0xB8, 0xFF, 0xA5, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xA6, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0xA6, 0x30, 0xFF, 0x52, 0x62, 0xFF, 0x87, 0x20, 0xFF, 0xAC, 0x49, 0xFF, 0x85, 0x30, 0xFF, 0x74, 0x5A, 0xFF, 0x74, 0x62, 0xFF, 0x0A, 0x41, 0xFF, 0xC9, 0x30, 0xFF, 0xD0, 0x49, 0xFF, 0xA6, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0x86, 0x30, 0xFF, 0x8B, 0x20, 0xFF, 0x4D, 0x41, 0xFF, 0x2D, 0x41, 0xFF, 0x8A, 0x30, 0xFF, 0xAC, 0x28, 0xFF, 0x8A, 0x30, 0xFF, 0xCA, 0x38, 0xFF, 0x98, 0x52, 0xFF, 0xAC, 0x30, 0xFF, 0xEF, 0x30, 0xFF, 0x0F, 0x39, 0xFF, 0x3F, 0x8C, 0xFF, 0x70, 0x41, 0xFF, 0xFE, 0x53, 0xFF, 0x79, 0x3A, 0xFF, 0xDB, 0x3A, 0xFF, 0x98, 0x52, 0xFF, 0xF6, 0x41, 0xFF, 0xBE, 0x33, 0xFF, 0x3F, 0x44, 0xFF, 0x5F, 0x4C, 0xFF, 0xD4, 0x41, 0xFF, 0xD5, 0x39, 0xFF, 0xB5, 0x51, 0xFF, 0xB9, 0x62, 0xFF, 0xFB, 0x6A, 0xFF, 0x0F, 0x51, 0xFF, 0xDC, 0x83, 0xFF, 0x12, 0x7A, 0xFF, 0x72, 0x61, 0xFF, 0xAD, 0x58, 0xFF,
-    0xCA, 0x60, 0xFF, 0xAB, 0x60, 0xFF, 0x88, 0x60, 0xFF, 0xFD, 0x8B, 0xFF, 0xEC, 0x80, 0xFF, 0xC9, 0x80, 0xFF, 0xF4, 0x81, 0xFF, 0x74, 0x92, 0xFF, 0x89, 0x70, 0xFF, 0xE9, 0x88, 0xFF, 0x67, 0x78, 0xFF, 0x67, 0x80, 0xFF, 0xA6, 0x80, 0xFF, 0x25, 0x80, 0xFF, 0xC8, 0x90, 0xFF, 0x2B, 0x91, 0xFF, 0xAA, 0x80, 0xFF, 0x46, 0x80, 0xFF, 0xED, 0xB9, 0xFF, 0x67, 0x90, 0xFF, 0x47, 0x90, 0xFF, 0xF6, 0xC2, 0xFF, 0x88, 0x98, 0xFF, 0xC9, 0xA0, 0xFF, 0xA9, 0xA0, 0xFF, 0x89, 0xA0, 0xFF, 0xEA, 0xB0, 0xFF, 0xA9, 0xA8, 0xFF, 0xEC, 0xB0, 0xFF, 0x89, 0xA8, 0xFF, 0xCA, 0xB0, 0xFF, 0xCA, 0xB0, 0xFF, 0x85, 0x30, 0xFF, 0x85, 0x28, 0xFF, 0xA6, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0x87, 0x38, 0xFF, 0x56, 0x8B, 0xFF, 0x86, 0x30, 0xFF, 0x50, 0x62, 0xFF, 0x86, 0x30, 0xFF, 0x74, 0x62, 0xFF, 0x33, 0x5A, 0xFF, 0x2D, 0x41, 0xFF, 0xCB, 0x30, 0xFF, 0xCC, 0x30, 0xFF, 0x66, 0x38, 0xFF, 0x66, 0x30, 0xFF, 0xE8, 0x40, 0xFF, 0x2E, 0x39, 0xFF, 0x89, 0x30, 0xFF, 0x89, 0x28, 0xFF, 0xAC, 0x38, 0xFF, 0xEE, 0x28, 0xFF, 0xCB, 0x38, 0xFF, 0x4D, 0x49, 0xFF, 0x19, 0x5B, 0xFF, 0x0D, 0x61, 0xFF, 0x51, 0x39, 0xFF, 0x2E, 0x39, 0xFF, 0x7F, 0x84, 0xFF, 0xD2, 0x49, 0xFF, 0x5C, 0x53, 0xFF, 0x1D, 0x43, 0xFF,
-    0x79, 0x42, 0xFF, 0xD9, 0x52, 0xFF, 0xF6, 0x39, 0xFF, 0xBC, 0x32, 0xFF, 0xDC, 0x2A, 0xFF, 0x5F, 0x44, 0xFF, 0x58, 0x4A, 0xFF, 0x94, 0x31, 0xFF, 0x16, 0x5A, 0xFF, 0xF6, 0x59, 0xFF, 0x1A, 0x7B, 0xFF, 0x51, 0x51, 0xFF, 0xDF, 0xA4, 0xFF, 0xF2, 0x71, 0xFF, 0x73, 0x59, 0xFF, 0x8B, 0x58, 0xFF, 0x8A, 0x60, 0xFF, 0xD1, 0x79, 0xFF, 0xCA, 0x68, 0xFF, 0xD8, 0x92, 0xFF, 0x0C, 0x79, 0xFF, 0xC8, 0x78, 0xFF, 0xEF, 0x68, 0xFF, 0xB3, 0x89, 0xFF, 0x10, 0x9A, 0xFF, 0xEB, 0x80, 0xFF, 0x69, 0x70, 0xFF, 0x46, 0x78, 0xFF, 0x87, 0x88, 0xFF, 0x66, 0x88, 0xFF, 0xA8, 0x88, 0xFF, 0xA8, 0x88, 0xFF, 0xEE, 0xA9, 0xFF, 0x0A, 0x91, 0xFF, 0x2A, 0x99, 0xFF, 0x88, 0x90, 0xFF, 0xA9, 0x90, 0xFF, 0xCB, 0x98, 0xFF, 0xA8, 0x98, 0xFF, 0xEB, 0xA0, 0xFF, 0xA9, 0xA0, 0xFF, 0xCA, 0xA8, 0xFF, 0x88, 0xA0, 0xFF, 0xEA, 0xB0, 0xFF, 0x0B, 0xB1, 0xFF, 0xCA, 0xB0, 0xFF, 0xCA, 0xB8, 0xFF, 0xCA, 0xB8, 0xFF, 0x85, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0x85, 0x30, 0xFF, 0x66, 0x30, 0xFF, 0xF1, 0x59, 0xFF, 0xA7, 0x38, 0xFF, 0x12, 0x52, 0xFF, 0xA6, 0x38, 0xFF, 0x32, 0x5A, 0xFF, 0x4D, 0x49, 0xFF, 0x8A, 0x28, 0xFF, 0x8C, 0x18, 0xFF, 0xEB, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0x25, 0x28, 0xFF,
-    0xA7, 0x38, 0xFF, 0x57, 0x73, 0xFF, 0x0E, 0x41, 0xFF, 0xEB, 0x48, 0xFF, 0x13, 0x3A, 0xFF, 0xD4, 0x31, 0xFF, 0xAB, 0x30, 0xFF, 0x89, 0x38, 0xFF, 0x9E, 0x8D, 0xFF, 0x0D, 0x39, 0xFF, 0x13, 0x29, 0xFF, 0xD0, 0x28, 0xFF, 0x7C, 0x5C, 0xFF, 0x51, 0x39, 0xFF, 0x1D, 0x7D, 0xFF, 0x1F, 0x64, 0xFF, 0x1E, 0x2D, 0xFF, 0xDF, 0x5B, 0xFF, 0x59, 0x42, 0xFF, 0xFD, 0x2B, 0xFF, 0x5F, 0x2C, 0xFF, 0xDE, 0x44, 0xFF, 0xDC, 0x53, 0xFF, 0x18, 0x3A, 0xFF, 0x39, 0x52, 0xFF, 0xD7, 0x49, 0xFF, 0x5E, 0x6B, 0xFF, 0x36, 0x6A, 0xFF, 0x7F, 0xA5, 0xFF, 0xB2, 0x71, 0xFF, 0xF4, 0x61, 0xFF, 0x4F, 0x69, 0xFF, 0x6C, 0x58, 0xFF, 0xF5, 0x61, 0xFF, 0xEA, 0x70, 0xFF, 0x56, 0x8A, 0xFF, 0x4D, 0x81, 0xFF, 0x88, 0x78, 0xFF, 0xD6, 0x92, 0xFF, 0x95, 0x82, 0xFF, 0x5D, 0xBC, 0xFF, 0x89, 0x80, 0xFF, 0x4D, 0x91, 0xFF, 0xA8, 0x80, 0xFF, 0x26, 0x80, 0xFF, 0x25, 0x80, 0xFF, 0x46, 0x88, 0xFF, 0xE8, 0xA0, 0xFF, 0xCE, 0xB1, 0xFF, 0x94, 0xBA, 0xFF, 0xA8, 0xA0, 0xFF, 0x67, 0x90, 0xFF, 0xC8, 0xA0, 0xFF, 0x88, 0x98, 0xFF, 0x48, 0x98, 0xFF, 0x68, 0x98, 0xFF, 0x0A, 0xB1, 0xFF, 0xA9, 0xA8, 0xFF, 0xA9, 0xA8, 0xFF, 0xAA, 0xB0, 0xFF, 0xC9, 0xB0, 0xFF, 0x89, 0xB0, 0xFF, 0x68, 0xB0, 0xFF, 0xCA, 0xC0, 0xFF,
-    0xE9, 0x50, 0xFF, 0x65, 0x30, 0xFF, 0x45, 0x30, 0xFF, 0x4D, 0x71, 0xFF, 0x4E, 0x69, 0xFF, 0x07, 0x40, 0xFF, 0x09, 0x49, 0xFF, 0xC8, 0x40, 0xFF, 0x65, 0x30, 0xFF, 0x92, 0x81, 0xFF, 0x0C, 0x59, 0xFF, 0xAB, 0x40, 0xFF, 0x33, 0x4A, 0xFF, 0xAD, 0x61, 0xFF, 0xF5, 0x81, 0xFF, 0x4C, 0x51, 0xFF, 0x94, 0x82, 0xFF, 0xB1, 0x61, 0xFF, 0x6F, 0x59, 0xFF, 0x6D, 0x59, 0xFF, 0xDC, 0x82, 0xFF, 0x79, 0x62, 0xFF, 0xFC, 0x72, 0xFF, 0xB7, 0x62, 0xFF, 0xEB, 0x58, 0xFF, 0xFF, 0x73, 0xFF, 0xFF, 0x74, 0xFF, 0x7B, 0x52, 0xFF, 0x57, 0x62, 0xFF, 0x96, 0x62, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x8E, 0xFF, 0x5F, 0x53, 0xFF, 0x94, 0x49, 0xFF, 0x5E, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xD6, 0x49, 0xFF, 0x3A, 0x3A, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xAF, 0xFF, 0x3F, 0xA7, 0xFF, 0x91, 0x71, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xCC, 0xFF, 0xD5, 0x81, 0xFF, 0xF5, 0x91, 0xFF, 0xFA, 0x9A, 0xFF, 0x1E, 0xAB, 0xFF, 0x5A, 0xE2, 0xFF, 0xD6, 0xF2, 0xFF, 0x92, 0xC1, 0xFF, 0x1F, 0xEF, 0xFF, 0xF5, 0xB1, 0xFF, 0x15, 0xCA, 0xFF, 0xD0, 0xC1, 0xFF, 0x6D, 0xC1, 0xFF, 0x33, 0xD2, 0xFF, 0xED, 0xB0, 0xFF, 0xAA, 0xB8, 0xFF, 0xB0, 0xF9, 0xFF, 0x4B, 0xC9, 0xFF,
-    0xF0, 0xD9, 0xFF, 0x4D, 0xD9, 0xFF, 0xAA, 0xD8, 0xFF, 0x0E, 0xF9, 0xFF, 0x67, 0xA8, 0xFF, 0xEB, 0xE0, 0xFF, 0xEB, 0xE0, 0xFF, 0x26, 0xA0, 0xFF, 0x2C, 0xE9, 0xFF, 0xA9, 0xC8, 0xFF, 0x67, 0xC0, 0xFF, 0x4D, 0xF9, 0xFF, 0x89, 0xC0, 0xFF, 0xEB, 0xE0, 0xFF, 0x89, 0xC8, 0xFF, 0xAA, 0xC8, 0xFF, 0x65, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0x65, 0x30, 0xFF, 0xC8, 0x40, 0xFF, 0x4B, 0x51, 0xFF, 0x25, 0x28, 0xFF, 0x26, 0x28, 0xFF, 0x66, 0x38, 0xFF, 0x0A, 0x49, 0xFF, 0x68, 0x38, 0xFF, 0x92, 0x72, 0xFF, 0xD3, 0x82, 0xFF, 0xA9, 0x40, 0xFF, 0x86, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0x67, 0x38, 0xFF, 0x50, 0x31, 0xFF, 0x0B, 0x51, 0xFF, 0xCA, 0x38, 0xFF, 0xB5, 0x7A, 0xFF, 0xB0, 0x59, 0xFF, 0x49, 0x30, 0xFF, 0xCB, 0x38, 0xFF, 0x34, 0x62, 0xFF, 0xAA, 0x38, 0xFF, 0x10, 0x31, 0xFF, 0x4F, 0x49, 0xFF, 0xEF, 0x40, 0xFF, 0x53, 0x6A, 0xFF, 0xBF, 0xA5, 0xFF, 0x1C, 0x53, 0xFF, 0x79, 0x42, 0xFF, 0x79, 0x5A, 0xFF, 0x5E, 0x33, 0xFF, 0x7D, 0x43, 0xFF, 0xDB, 0x42, 0xFF, 0x3E, 0x4C, 0xFF, 0x37, 0x52, 0xFF, 0x38, 0x42, 0xFF, 0xFD, 0x4A, 0xFF, 0xD6, 0x59, 0xFF, 0x1B, 0x83, 0xFF, 0xF3, 0x81, 0xFF, 0xDD, 0x8B, 0xFF, 0xCD, 0x68, 0xFF, 0x8A, 0x68, 0xFF, 0xAB, 0x70, 0xFF,
-    0x71, 0x71, 0xFF, 0xDD, 0x9B, 0xFF, 0x8B, 0x78, 0xFF, 0x0D, 0x81, 0xFF, 0xAB, 0x88, 0xFF, 0x67, 0x88, 0xFF, 0xD7, 0xB2, 0xFF, 0x1B, 0xBC, 0xFF, 0xD1, 0x91, 0xFF, 0x8D, 0xB9, 0xFF, 0x0B, 0xA9, 0xFF, 0x2B, 0xB1, 0xFF, 0x26, 0x90, 0xFF, 0x46, 0x90, 0xFF, 0x87, 0xA0, 0xFF, 0x26, 0x90, 0xFF, 0x88, 0x98, 0xFF, 0x2B, 0xB1, 0xFF, 0x68, 0xB0, 0xFF, 0x67, 0xA8, 0xFF, 0x67, 0xA8, 0xFF, 0x47, 0xA8, 0xFF, 0x48, 0xA8, 0xFF, 0x68, 0xB8, 0xFF, 0x88, 0xC0, 0xFF, 0x88, 0xC0, 0xFF, 0x68, 0xB8, 0xFF, 0xA9, 0xC0, 0xFF, 0x68, 0xC0, 0xFF, 0x8A, 0xD0, 0xFF, 0x89, 0xD0, 0xFF, 0x89, 0xD0, 0xFF, 0x85, 0x38, 0xFF, 0x24, 0x28, 0xFF, 0x04, 0x28, 0xFF, 0x85, 0x38, 0xFF, 0x66, 0x38, 0xFF, 0xCD, 0x69, 0xFF, 0x46, 0x30, 0xFF, 0xA9, 0x48, 0xFF, 0x45, 0x30, 0xFF, 0x66, 0x30, 0xFF, 0x86, 0x38, 0xFF, 0x92, 0x7A, 0xFF, 0x71, 0x7A, 0xFF, 0xA9, 0x40, 0xFF, 0x86, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0x65, 0x38, 0xFF, 0xAD, 0x40, 0xFF, 0x70, 0x59, 0xFF, 0x68, 0x30, 0xFF, 0x4E, 0x51, 0xFF, 0xAE, 0x61, 0xFF, 0x6A, 0x38, 0xFF, 0x2D, 0x49, 0xFF, 0x4F, 0x51, 0xFF, 0xEC, 0x48, 0xFF, 0x10, 0x41, 0xFF, 0x0E, 0x51, 0xFF, 0xED, 0x48, 0xFF, 0x12, 0x6A, 0xFF, 0xDF, 0xAC, 0xFF, 0x57, 0x62, 0xFF,
-    0x15, 0x52, 0xFF, 0xD4, 0x51, 0xFF, 0xB4, 0x41, 0xFF, 0x3E, 0x5B, 0xFF, 0xBC, 0x52, 0xFF, 0x5D, 0x63, 0xFF, 0x73, 0x61, 0xFF, 0x32, 0x49, 0xFF, 0xD5, 0x61, 0xFF, 0x73, 0x61, 0xFF, 0x98, 0x82, 0xFF, 0xF2, 0x89, 0xFF, 0x36, 0x82, 0xFF, 0xAB, 0x70, 0xFF, 0x8A, 0x78, 0xFF, 0x6A, 0x70, 0xFF, 0xD7, 0x92, 0xFF, 0x14, 0x92, 0xFF, 0x48, 0x78, 0xFF, 0x68, 0x80, 0xFF, 0xEB, 0x90, 0xFF, 0x88, 0x88, 0xFF, 0x12, 0xB2, 0xFF, 0x17, 0xCB, 0xFF, 0x1E, 0xCD, 0xFF, 0x4D, 0xB1, 0xFF, 0x0A, 0xB1, 0xFF, 0x0B, 0xB1, 0xFF, 0x67, 0x98, 0xFF, 0x66, 0xA0, 0xFF, 0x46, 0xA0, 0xFF, 0x67, 0xA0, 0xFF, 0x47, 0xA0, 0xFF, 0xC9, 0xA8, 0xFF, 0x47, 0xA8, 0xFF, 0xA8, 0xB0, 0xFF, 0xA9, 0xB8, 0xFF, 0x88, 0xB0, 0xFF, 0x47, 0xA8, 0xFF, 0x68, 0xB8, 0xFF, 0x68, 0xB8, 0xFF, 0x69, 0xB8, 0xFF, 0x69, 0xC0, 0xFF, 0xA9, 0xC0, 0xFF, 0xCA, 0xC8, 0xFF, 0x8A, 0xC8, 0xFF, 0x89, 0xC8, 0xFF, 0xAA, 0xD0, 0xFF, 0x24, 0x30, 0xFF, 0x64, 0x30, 0xFF, 0xED, 0x69, 0xFF, 0x65, 0x38, 0xFF, 0x04, 0x20, 0xFF, 0x87, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0xB2, 0x8A, 0xFF, 0x46, 0x30, 0xFF, 0xC7, 0x40, 0xFF, 0x86, 0x38, 0xFF, 0x32, 0x7A, 0xFF, 0x31, 0x7A, 0xFF, 0xA9, 0x40, 0xFF, 0x87, 0x40, 0xFF, 0x66, 0x38, 0xFF,
-    0x87, 0x40, 0xFF, 0x32, 0x72, 0xFF, 0x6A, 0x38, 0xFF, 0xEA, 0x50, 0xFF, 0x0C, 0x51, 0xFF, 0xCA, 0x48, 0xFF, 0x2C, 0x59, 0xFF, 0x94, 0x7A, 0xFF, 0xCC, 0x48, 0xFF, 0x4E, 0x59, 0xFF, 0x71, 0x59, 0xFF, 0x4F, 0x59, 0xFF, 0x8B, 0x40, 0xFF, 0x12, 0x72, 0xFF, 0x5F, 0xAC, 0xFF, 0xD8, 0x72, 0xFF, 0x12, 0x59, 0xFF, 0xF5, 0x61, 0xFF, 0x71, 0x61, 0xFF, 0xBA, 0x6A, 0xFF, 0xD5, 0x51, 0xFF, 0x1C, 0x83, 0xFF, 0x50, 0x61, 0xFF, 0xB3, 0x69, 0xFF, 0x92, 0x69, 0xFF, 0xF0, 0x58, 0xFF, 0x76, 0x9A, 0xFF, 0xF1, 0x89, 0xFF, 0xF4, 0x91, 0xFF, 0xAC, 0x78, 0xFF, 0x0C, 0x91, 0xFF, 0x8A, 0x78, 0xFF, 0x38, 0xC3, 0xFF, 0x37, 0xA2, 0xFF, 0xEB, 0x88, 0xFF, 0xCA, 0x90, 0xFF, 0xEC, 0xA0, 0xFF, 0x47, 0x98, 0xFF, 0xCC, 0x98, 0xFF, 0x0C, 0xA9, 0xFF, 0x8A, 0x98, 0xFF, 0x0A, 0xB9, 0xFF, 0xA9, 0xA8, 0xFF, 0xC9, 0xB0, 0xFF, 0x68, 0xA8, 0xFF, 0x26, 0xA0, 0xFF, 0x46, 0xA8, 0xFF, 0xE9, 0xB8, 0xFF, 0x26, 0xA8, 0xFF, 0x46, 0xA8, 0xFF, 0x27, 0xB0, 0xFF, 0x67, 0xB8, 0xFF, 0x89, 0xB8, 0xFF, 0x68, 0xB8, 0xFF, 0x67, 0xB8, 0xFF, 0x89, 0xC0, 0xFF, 0x89, 0xC8, 0xFF, 0x0B, 0xD1, 0xFF, 0xCA, 0xC8, 0xFF, 0x8A, 0xC8, 0xFF, 0xAB, 0xD0, 0xFF, 0x8A, 0xC8, 0xFF, 0x89, 0xC8, 0xFF, 0xCA, 0xD8, 0xFF,
-    0x67, 0x38, 0xFF, 0xC7, 0x40, 0xFF, 0x6F, 0x7A, 0xFF, 0x71, 0x7A, 0xFF, 0x8E, 0x69, 0xFF, 0x87, 0x40, 0xFF, 0x2B, 0x51, 0xFF, 0x51, 0x7A, 0xFF, 0x04, 0x30, 0xFF, 0xD0, 0x69, 0xFF, 0x2C, 0x59, 0xFF, 0x4D, 0x59, 0xFF, 0x2D, 0x59, 0xFF, 0xA9, 0x48, 0xFF, 0xA8, 0x40, 0xFF, 0xD0, 0x69, 0xFF, 0x4D, 0x61, 0xFF, 0x11, 0x72, 0xFF, 0x13, 0x6A, 0xFF, 0x70, 0x59, 0xFF, 0x4E, 0x59, 0xFF, 0xCB, 0x50, 0xFF, 0x4C, 0x59, 0xFF, 0x9B, 0x9B, 0xFF, 0x30, 0x59, 0xFF, 0xD7, 0x8A, 0xFF, 0x6E, 0x61, 0xFF, 0xB9, 0x62, 0xFF, 0xBB, 0x7A, 0xFF, 0x11, 0x6A, 0xFF, 0xFF, 0xBD, 0xFF, 0x1B, 0x73, 0xFF, 0xBD, 0x82, 0xFF, 0x15, 0x62, 0xFF, 0xF4, 0x69, 0xFF, 0x7E, 0x6C, 0xFF, 0xDC, 0x65, 0xFF, 0xBF, 0x9B, 0xFF, 0x0F, 0x71, 0xFF, 0x51, 0x71, 0xFF, 0x3F, 0xA4, 0xFF, 0x53, 0x71, 0xFF, 0xD9, 0xAA, 0xFF, 0xF2, 0x91, 0xFF, 0x37, 0xAA, 0xFF, 0xCB, 0x80, 0xFF, 0x2D, 0x99, 0xFF, 0x7C, 0xB3, 0xFF, 0x7F, 0xEC, 0xFF, 0x7D, 0xE4, 0xFF, 0x8F, 0xB9, 0xFF, 0x35, 0xDB, 0xFF, 0x10, 0xC1, 0xFF, 0xEF, 0xA8, 0xFF, 0x69, 0xB8, 0xFF, 0x4E, 0xC1, 0xFF, 0x4E, 0xC1, 0xFF, 0x69, 0xB8, 0xFF, 0xEB, 0xD0, 0xFF, 0xAA, 0xC8, 0xFF, 0xAF, 0xD9, 0xFF, 0x68, 0xC8, 0xFF, 0x2B, 0xD9, 0xFF, 0xCA, 0xD0, 0xFF,
-    0x06, 0xB8, 0xFF, 0x89, 0xD8, 0xFF, 0xCA, 0xD8, 0xFF, 0xCA, 0xD8, 0xFF, 0xA9, 0xD0, 0xFF, 0x67, 0xC0, 0xFF, 0x47, 0xC0, 0xFF, 0x48, 0xC8, 0xFF, 0x49, 0xD0, 0xFF, 0x6A, 0xD8, 0xFF, 0x89, 0xD0, 0xFF, 0x8B, 0xD8, 0xFF, 0x8B, 0xD8, 0xFF, 0x8A, 0xD8, 0xFF, 0x8B, 0xE8, 0xFF, 0x8A, 0xE8, 0xFF, 0xD3, 0x9A, 0xFF, 0x6B, 0x59, 0xFF, 0xC7, 0x50, 0xFF, 0x04, 0x30, 0xFF, 0x71, 0x79, 0xFF, 0xAF, 0x71, 0xFF, 0x0C, 0x59, 0xFF, 0x29, 0x61, 0xFF, 0x30, 0xA2, 0xFF, 0xB2, 0x79, 0xFF, 0x47, 0x40, 0xFF, 0xB0, 0x79, 0xFF, 0x89, 0x50, 0xFF, 0xA8, 0x50, 0xFF, 0xD9, 0x9A, 0xFF, 0x26, 0x38, 0xFF, 0xD8, 0x8A, 0xFF, 0x2C, 0x59, 0xFF, 0xAF, 0x69, 0xFF, 0x3F, 0xBF, 0xFF, 0xBB, 0x7A, 0xFF, 0x1E, 0x83, 0xFF, 0x6D, 0x69, 0xFF, 0x14, 0xA3, 0xFF, 0x8A, 0x50, 0xFF, 0xDF, 0x8B, 0xFF, 0x9F, 0x8C, 0xFF, 0x4D, 0x61, 0xFF, 0xAA, 0x50, 0xFF, 0x0C, 0x59, 0xFF, 0x3F, 0x84, 0xFF, 0x7F, 0x8F, 0xFF, 0x71, 0x79, 0xFF, 0x0F, 0x59, 0xFF, 0x50, 0x69, 0xFF, 0x7B, 0x5C, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x7C, 0xFF, 0xED, 0x70, 0xFF, 0x93, 0x71, 0xFF, 0x79, 0x6A, 0xFF, 0x9C, 0xAD, 0xFF, 0x39, 0xC3, 0xFF, 0xD7, 0xAA, 0xFF, 0xD6, 0xA2, 0xFF, 0x3F, 0xBD, 0xFF, 0x4E, 0x80, 0xFF, 0x2E, 0xB1, 0xFF,
-    0x11, 0xD2, 0xFF, 0xF7, 0xBA, 0xFF, 0xDE, 0xF3, 0xFF, 0xED, 0xD8, 0xFF, 0x69, 0xC0, 0xFF, 0x68, 0xC0, 0xFF, 0x73, 0xC9, 0xFF, 0xDB, 0xFA, 0xFF, 0xCB, 0xC0, 0xFF, 0x06, 0xA8, 0xFF, 0xAB, 0xC8, 0xFF, 0xF3, 0xF9, 0xFF, 0x72, 0xE9, 0xFF, 0x67, 0xE0, 0xFF, 0x26, 0xC8, 0xFF, 0x46, 0xC8, 0xFF, 0x2F, 0xF9, 0xFF, 0xB3, 0xF9, 0xFF, 0x07, 0xD8, 0xFF, 0x2C, 0xF9, 0xFF, 0x0B, 0xF1, 0xFF, 0x4F, 0xF9, 0xFF, 0x50, 0xF9, 0xFF, 0x88, 0xE8, 0xFF, 0x47, 0xD8, 0xFF, 0x8B, 0xF0, 0xFF, 0x07, 0xD0, 0xFF, 0xED, 0xF8, 0xFF, 0x69, 0xD8, 0xFF, 0xCB, 0xE8, 0xFF, 0xAA, 0xE0, 0xFF, 0x2D, 0xF9, 0xFF, 0x08, 0x71, 0xFF, 0x64, 0x38, 0xFF, 0xA6, 0x48, 0xFF, 0x65, 0x40, 0xFF, 0x49, 0x61, 0xFF, 0x65, 0x40, 0xFF, 0xE7, 0x50, 0xFF, 0x24, 0x40, 0xFF, 0x0D, 0x9A, 0xFF, 0x65, 0x40, 0xFF, 0xC7, 0x58, 0xFF, 0x24, 0x38, 0xFF, 0x46, 0x48, 0xFF, 0x87, 0x50, 0xFF, 0xC7, 0x58, 0xFF, 0x66, 0x48, 0xFF, 0x04, 0x40, 0xFF, 0xA8, 0x58, 0xFF, 0xAD, 0x81, 0xFF, 0x88, 0x58, 0xFF, 0x2A, 0x69, 0xFF, 0xA9, 0x60, 0xFF, 0x87, 0x50, 0xFF, 0xCE, 0x81, 0xFF, 0xA9, 0x60, 0xFF, 0xCE, 0x81, 0xFF, 0x8E, 0x89, 0xFF, 0x6D, 0x79, 0xFF, 0x89, 0x58, 0xFF, 0xEB, 0x60, 0xFF, 0x52, 0x9A, 0xFF, 0x6F, 0x71, 0xFF,
-    0xCC, 0x68, 0xFF, 0xED, 0x68, 0xFF, 0x2D, 0x81, 0xFF, 0xD2, 0x99, 0xFF, 0x2E, 0x81, 0xFF, 0x71, 0xA1, 0xFF, 0x8A, 0x70, 0xFF, 0xAC, 0x78, 0xFF, 0xEE, 0x98, 0xFF, 0xEE, 0x98, 0xFF, 0x4E, 0xB1, 0xFF, 0x0C, 0x99, 0xFF, 0x6A, 0x80, 0xFF, 0x8F, 0xB1, 0xFF, 0xCD, 0x98, 0xFF, 0x89, 0xA0, 0xFF, 0xAF, 0xC9, 0xFF, 0xF1, 0xD1, 0xFF, 0xCA, 0xB0, 0xFF, 0x2F, 0xC1, 0xFF, 0x26, 0xB0, 0xFF, 0x48, 0xB0, 0xFF, 0x27, 0xA8, 0xFF, 0x67, 0xB8, 0xFF, 0x8C, 0xC0, 0xFF, 0x2D, 0xC9, 0xFF, 0x06, 0xB8, 0xFF, 0x27, 0xC8, 0xFF, 0x88, 0xD8, 0xFF, 0x26, 0xC8, 0xFF, 0x6A, 0xD0, 0xFF, 0x26, 0xC8, 0xFF, 0xA7, 0xD0, 0xFF, 0x25, 0xC0, 0xFF, 0x26, 0xD0, 0xFF, 0xD7, 0xFA, 0xFF, 0x47, 0xD8, 0xFF, 0x26, 0xD0, 0xFF, 0x68, 0xD8, 0xFF, 0x89, 0xE0, 0xFF, 0xB2, 0xF9, 0xFF, 0x68, 0xE0, 0xFF, 0x48, 0xD8, 0xFF, 0x49, 0xD8, 0xFF, 0x6A, 0xE8, 0xFF, 0xED, 0xF8, 0xFF, 0xCA, 0xF8, 0xFF, 0x8A, 0xE8, 0xFF, 0xA6, 0x58, 0xFF, 0x64, 0x38, 0xFF, 0x64, 0x40, 0xFF, 0x64, 0x40, 0xFF, 0xA6, 0x50, 0xFF, 0x65, 0x40, 0xFF, 0xC6, 0x50, 0xFF, 0x65, 0x48, 0xFF, 0x29, 0x71, 0xFF, 0x45, 0x40, 0xFF, 0x29, 0x61, 0xFF, 0xA8, 0x50, 0xFF, 0x87, 0x50, 0xFF, 0xE8, 0x60, 0xFF, 0xC8, 0x60, 0xFF, 0xC7, 0x58, 0xFF,
-    0x46, 0x50, 0xFF, 0x0A, 0x69, 0xFF, 0xEA, 0x68, 0xFF, 0xEA, 0x68, 0xFF, 0xC8, 0x68, 0xFF, 0x2B, 0x71, 0xFF, 0xEA, 0x68, 0xFF, 0xCA, 0x68, 0xFF, 0x0A, 0x79, 0xFF, 0x2C, 0x79, 0xFF, 0x12, 0xA2, 0xFF, 0x6B, 0x71, 0xFF, 0x47, 0x50, 0xFF, 0x0C, 0x71, 0xFF, 0x11, 0xA2, 0xFF, 0x2D, 0x81, 0xFF, 0x6B, 0x68, 0xFF, 0x90, 0x89, 0xFF, 0x6D, 0xA1, 0xFF, 0x90, 0x91, 0xFF, 0x4E, 0x91, 0xFF, 0x4F, 0xA1, 0xFF, 0xAA, 0x80, 0xFF, 0xCB, 0x88, 0xFF, 0x0D, 0xA1, 0xFF, 0xCC, 0x98, 0xFF, 0x2C, 0xB9, 0xFF, 0x0B, 0xA1, 0xFF, 0x08, 0x88, 0xFF, 0x68, 0x98, 0xFF, 0xEB, 0xB0, 0xFF, 0x8E, 0xD1, 0xFF, 0x92, 0xFA, 0xFF, 0x4C, 0xC9, 0xFF, 0xCA, 0xC0, 0xFF, 0xA9, 0xC0, 0xFF, 0x06, 0xB8, 0xFF, 0xAA, 0xD0, 0xFF, 0x89, 0xD0, 0xFF, 0x06, 0xC0, 0xFF, 0xAA, 0xE0, 0xFF, 0xA9, 0xE0, 0xFF, 0x67, 0xD8, 0xFF, 0x0A, 0xE9, 0xFF, 0x06, 0xD8, 0xFF, 0x88, 0xE0, 0xFF, 0x47, 0xD8, 0xFF, 0xC9, 0xE8, 0xFF, 0x68, 0xE0, 0xFF, 0x26, 0xD0, 0xFF, 0x26, 0xD8, 0xFF, 0x67, 0xE0, 0xFF, 0x67, 0xE0, 0xFF, 0x27, 0xD8, 0xFF, 0xA9, 0xF0, 0xFF, 0x68, 0xE0, 0xFF, 0x47, 0xE0, 0xFF, 0x69, 0xE8, 0xFF, 0x89, 0xE8, 0xFF, 0x69, 0xE8, 0xFF, 0x69, 0xE0, 0xFF, 0x69, 0xE8, 0xFF, 0x69, 0xE8, 0xFF, 0xAA, 0xF0, 0xFF,
-    0x44, 0x40, 0xFF, 0x65, 0x40, 0xFF, 0x24, 0x40, 0xFF, 0x85, 0x40, 0xFF, 0x25, 0x40, 0xFF, 0x44, 0x40, 0xFF, 0xA7, 0x50, 0xFF, 0x45, 0x40, 0xFF, 0x05, 0x48, 0xFF, 0x45, 0x40, 0xFF, 0x87, 0x50, 0xFF, 0x46, 0x48, 0xFF, 0xE9, 0x60, 0xFF, 0xE7, 0x68, 0xFF, 0xA8, 0x68, 0xFF, 0xEC, 0x60, 0xFF, 0x8D, 0x81, 0xFF, 0xEA, 0x70, 0xFF, 0x67, 0x50, 0xFF, 0x0D, 0x69, 0xFF, 0xEB, 0x68, 0xFF, 0xCD, 0x91, 0xFF, 0x67, 0x58, 0xFF, 0xA9, 0x60, 0xFF, 0xF1, 0x91, 0xFF, 0x2F, 0xAA, 0xFF, 0x10, 0x9A, 0xFF, 0xEB, 0x68, 0xFF, 0x14, 0x92, 0xFF, 0x0A, 0x79, 0xFF, 0xF0, 0xA1, 0xFF, 0x2C, 0x89, 0xFF, 0xF3, 0x99, 0xFF, 0x0C, 0x89, 0xFF, 0xCA, 0x90, 0xFF, 0xF4, 0x89, 0xFF, 0xB9, 0xAA, 0xFF, 0xCC, 0x98, 0xFF, 0xA8, 0x78, 0xFF, 0xAA, 0x88, 0xFF, 0xF6, 0xB9, 0xFF, 0x4D, 0xB1, 0xFF, 0x0B, 0xB9, 0xFF, 0x48, 0x98, 0xFF, 0xB2, 0xD1, 0xFF, 0x69, 0xA8, 0xFF, 0x27, 0xA0, 0xFF, 0x0B, 0xC9, 0xFF, 0xD2, 0xF1, 0xFF, 0xAE, 0xE9, 0xFF, 0x69, 0xC0, 0xFF, 0x70, 0xEA, 0xFF, 0x6F, 0xF1, 0xFF, 0xCF, 0xF9, 0xFF, 0x47, 0xC8, 0xFF, 0x27, 0xC8, 0xFF, 0xAB, 0xE8, 0xFF, 0x0F, 0xFA, 0xFF, 0x6B, 0xF9, 0xFF, 0xC9, 0xF0, 0xFF, 0xAA, 0xF0, 0xFF, 0xA8, 0xE0, 0xFF, 0x68, 0xE8, 0xFF, 0x89, 0xF0, 0xFF,
-    0xEB, 0xF8, 0xFF, 0x88, 0xF0, 0xFF, 0x06, 0xE0, 0xFF, 0xA9, 0xF8, 0xFF, 0xC9, 0xF8, 0xFF, 0x47, 0xE0, 0xFF, 0x27, 0xE8, 0xFF, 0x68, 0xE8, 0xFF, 0x48, 0xE8, 0xFF, 0x49, 0xF0, 0xFF, 0x68, 0xF0, 0xFF, 0xAA, 0xF8, 0xFF, 0xAA, 0xF8, 0xFF, 0x8A, 0xF8, 0xFF, 0x8A, 0xF8, 0xFF, 0x8A, 0xF8, 0xFF, 0x44, 0x48, 0xFF, 0x65, 0x40, 0xFF, 0x25, 0x40, 0xFF, 0x4D, 0x71, 0xFF, 0x67, 0x48, 0xFF, 0x65, 0x40, 0xFF, 0x85, 0x50, 0xFF, 0x8B, 0x71, 0xFF, 0x46, 0x50, 0xFF, 0x0B, 0x61, 0xFF, 0x65, 0x50, 0xFF, 0x66, 0x50, 0xFF, 0x8F, 0x71, 0xFF, 0x45, 0x48, 0xFF, 0xCC, 0xA1, 0xFF, 0x46, 0x50, 0xFF, 0x92, 0xB2, 0xFF, 0x91, 0x71, 0xFF, 0xB3, 0x79, 0xFF, 0xE9, 0x88, 0xFF, 0x47, 0x68, 0xFF, 0xAF, 0x89, 0xFF, 0xB7, 0x8A, 0xFF, 0xC9, 0x68, 0xFF, 0x87, 0x60, 0xFF, 0xC9, 0x70, 0xFF, 0x11, 0xAA, 0xFF, 0x59, 0x8A, 0xFF, 0x26, 0x70, 0xFF, 0xA8, 0x60, 0xFF, 0x91, 0x81, 0xFF, 0x7F, 0x8B, 0xFF, 0x8A, 0x80, 0xFF, 0x89, 0x78, 0xFF, 0xEA, 0x98, 0xFF, 0x30, 0x91, 0xFF, 0x7F, 0xB3, 0xFF, 0xCB, 0x98, 0xFF, 0xA9, 0x88, 0xFF, 0xAA, 0x98, 0xFF, 0xD7, 0xA9, 0xFF, 0x4D, 0xB9, 0xFF, 0xEB, 0xC0, 0xFF, 0x89, 0xA8, 0xFF, 0xD1, 0xC9, 0xFF, 0x1F, 0xE3, 0xFF, 0x48, 0xA8, 0xFF, 0x6D, 0xD9, 0xFF,
-    0x31, 0xFA, 0xFF, 0xD5, 0xF1, 0xFF, 0x6E, 0xF9, 0xFF, 0xEA, 0xD8, 0xFF, 0x27, 0xD0, 0xFF, 0x90, 0xF9, 0xFF, 0x8A, 0xE0, 0xFF, 0x26, 0xD0, 0xFF, 0xA9, 0xF8, 0xFF, 0x48, 0xE8, 0xFF, 0x51, 0xF9, 0xFF, 0xA9, 0xF0, 0xFF, 0xC8, 0xF8, 0xFF, 0x68, 0xF0, 0xFF, 0x2E, 0xF9, 0xFF, 0x4B, 0xF9, 0xFF, 0x05, 0xE0, 0xFF, 0x87, 0xF8, 0xFF, 0x68, 0xF8, 0xFF, 0xAC, 0xF8, 0xFF, 0x05, 0xE0, 0xFF, 0xC9, 0xF8, 0xFF, 0xAA, 0xF8, 0xFF, 0xCC, 0xF8, 0xFF, 0x68, 0xF8, 0xFF, 0x49, 0xF8, 0xFF, 0x48, 0xF8, 0xFF, 0x69, 0xF8, 0xFF, 0x69, 0xF8, 0xFF, 0xAA, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0xAB, 0xF8, 0xFF, 0xA6, 0x50, 0xFF, 0xAD, 0x71, 0xFF, 0x44, 0x48, 0xFF, 0x46, 0x48, 0xFF, 0xCB, 0x60, 0xFF, 0x45, 0x50, 0xFF, 0x4D, 0x71, 0xFF, 0x65, 0x48, 0xFF, 0xA6, 0x58, 0xFF, 0xEA, 0x60, 0xFF, 0x25, 0x48, 0xFF, 0xD1, 0x81, 0xFF, 0x86, 0x58, 0xFF, 0x24, 0x50, 0xFF, 0x29, 0x99, 0xFF, 0x88, 0x60, 0xFF, 0x4F, 0x89, 0xFF, 0xAC, 0xB9, 0xFF, 0x24, 0x58, 0xFF, 0xAE, 0xB9, 0xFF, 0x55, 0x9A, 0xFF, 0x78, 0x9A, 0xFF, 0x87, 0x60, 0xFF, 0xA8, 0x78, 0xFF, 0x88, 0x68, 0xFF, 0x2F, 0x71, 0xFF, 0x7F, 0x9B, 0xFF, 0x88, 0x80, 0xFF, 0x27, 0x78, 0xFF, 0x68, 0x68, 0xFF, 0x90, 0x91, 0xFF, 0x7F, 0xBC, 0xFF,
-    0x89, 0x90, 0xFF, 0x0C, 0xA1, 0xFF, 0x2A, 0xA9, 0xFF, 0xAF, 0xB9, 0xFF, 0xDA, 0xBA, 0xFF, 0x69, 0x90, 0xFF, 0xA8, 0x90, 0xFF, 0xA9, 0xA0, 0xFF, 0xEB, 0xA0, 0xFF, 0x51, 0xD1, 0xFF, 0xCA, 0xC0, 0xFF, 0x48, 0xB0, 0xFF, 0x6D, 0xD9, 0xFF, 0x9F, 0xFB, 0xFF, 0x49, 0xC0, 0xFF, 0x8D, 0xF1, 0xFF, 0x06, 0xD0, 0xFF, 0x75, 0xFB, 0xFF, 0xBB, 0xFA, 0xFF, 0x0B, 0xF1, 0xFF, 0x67, 0xD8, 0xFF, 0xCE, 0xF9, 0xFF, 0x48, 0xE0, 0xFF, 0x78, 0xFA, 0xFF, 0x26, 0xE8, 0xFF, 0x88, 0xF0, 0xFF, 0x47, 0xF0, 0xFF, 0xCB, 0xF0, 0xFF, 0xD3, 0xF9, 0xFF, 0xCF, 0xF9, 0xFF, 0x88, 0xF8, 0xFF, 0xC9, 0xF8, 0xFF, 0x27, 0xF0, 0xFF, 0xEE, 0xF8, 0xFF, 0xA8, 0xF8, 0xFF, 0x88, 0xF8, 0xFF, 0x27, 0xF0, 0xFF, 0x27, 0xF0, 0xFF, 0x50, 0xF9, 0xFF, 0x48, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0xEC, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0xCD, 0xF8, 0xFF, 0x69, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x8A, 0xF8, 0xFF, 0xAB, 0xF8, 0xFF, 0x45, 0x60, 0xFF, 0x44, 0x40, 0xFF, 0x44, 0x40, 0xFF, 0x24, 0x60, 0xFF, 0x86, 0x50, 0xFF, 0x64, 0x48, 0xFF, 0x23, 0x40, 0xFF, 0x44, 0x48, 0xFF, 0x44, 0x50, 0xFF, 0x26, 0x40, 0xFF, 0x87, 0x58, 0xFF, 0x29, 0x89, 0xFF, 0x24, 0x40, 0xFF, 0x28, 0x79, 0xFF, 0xC8, 0x80, 0xFF, 0x2A, 0x99, 0xFF,
-    0x25, 0x88, 0xFF, 0x6B, 0xA1, 0xFF, 0x46, 0x60, 0xFF, 0xC8, 0xA8, 0xFF, 0x26, 0x68, 0xFF, 0xEA, 0x80, 0xFF, 0x66, 0x68, 0xFF, 0x87, 0x68, 0xFF, 0x46, 0x68, 0xFF, 0x4B, 0x91, 0xFF, 0xAD, 0xC9, 0xFF, 0x67, 0x78, 0xFF, 0x48, 0x78, 0xFF, 0xEB, 0x90, 0xFF, 0x88, 0x90, 0xFF, 0x0A, 0xA9, 0xFF, 0x89, 0x98, 0xFF, 0x48, 0x88, 0xFF, 0xEA, 0xA8, 0xFF, 0x6D, 0xC1, 0xFF, 0x0C, 0xA9, 0xFF, 0xCA, 0xB8, 0xFF, 0xA8, 0x98, 0xFF, 0xA9, 0xA0, 0xFF, 0x0D, 0xB1, 0xFF, 0x34, 0xF2, 0xFF, 0x46, 0xB0, 0xFF, 0x27, 0xA8, 0xFF, 0x48, 0xB8, 0xFF, 0x88, 0xC8, 0xFF, 0x3F, 0xFD, 0xFF, 0x6D, 0xF9, 0xFF, 0x07, 0xE0, 0xFF, 0xC9, 0xE8, 0xFF, 0x88, 0xE8, 0xFF, 0xFD, 0xFA, 0xFF, 0xC8, 0xF0, 0xFF, 0x2B, 0xF9, 0xFF, 0x68, 0xF8, 0xFF, 0xA9, 0xF8, 0xFF, 0x17, 0xFA, 0xFF, 0x88, 0xF8, 0xFF, 0x68, 0xF8, 0xFF, 0xA8, 0xF8, 0xFF, 0xA9, 0xF8, 0xFF, 0x57, 0xFA, 0xFF, 0x48, 0xF0, 0xFF, 0x47, 0xF8, 0xFF, 0x05, 0xF0, 0xFF, 0xA9, 0xF8, 0xFF, 0xAB, 0xF8, 0xFF, 0x73, 0xF9, 0xFF, 0x27, 0xF8, 0xFF, 0x27, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x27, 0xF0, 0xFF, 0x10, 0xF9, 0xFF, 0x48, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x49, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0xEF, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF,
-    0x03, 0x60, 0xFF, 0x44, 0x40, 0xFF, 0x23, 0x48, 0xFF, 0x8E, 0xDA, 0xFF, 0x44, 0x48, 0xFF, 0x64, 0x48, 0xFF, 0x85, 0x60, 0xFF, 0x44, 0x48, 0xFF, 0xC8, 0x60, 0xFF, 0x01, 0x40, 0xFF, 0x44, 0x50, 0xFF, 0x8A, 0xA9, 0xFF, 0xC9, 0x68, 0xFF, 0x2D, 0xC2, 0xFF, 0x24, 0x68, 0xFF, 0x06, 0x60, 0xFF, 0x26, 0x80, 0xFF, 0xA8, 0xA8, 0xFF, 0x45, 0x68, 0xFF, 0x4B, 0x99, 0xFF, 0x0B, 0x81, 0xFF, 0x87, 0x78, 0xFF, 0x66, 0x68, 0xFF, 0x86, 0x68, 0xFF, 0x6D, 0x91, 0xFF, 0x66, 0x78, 0xFF, 0x6C, 0xC9, 0xFF, 0xC9, 0x88, 0xFF, 0xB1, 0x99, 0xFF, 0x26, 0x78, 0xFF, 0xA9, 0xA0, 0xFF, 0xEA, 0x98, 0xFF, 0xB0, 0xB9, 0xFF, 0x47, 0x98, 0xFF, 0xA8, 0xA8, 0xFF, 0xEB, 0xC0, 0xFF, 0x91, 0xB1, 0xFF, 0x48, 0xB8, 0xFF, 0x67, 0x90, 0xFF, 0x0A, 0xB9, 0xFF, 0x91, 0xD1, 0xFF, 0xE9, 0xD0, 0xFF, 0x67, 0xC0, 0xFF, 0x47, 0xC8, 0xFF, 0xD0, 0xF9, 0xFF, 0x6B, 0xF1, 0xFF, 0x27, 0xC8, 0xFF, 0xCD, 0xF9, 0xFF, 0x2E, 0xF9, 0xFF, 0x47, 0xE0, 0xFF, 0x0A, 0xF9, 0xFF, 0x4A, 0xF9, 0xFF, 0xAC, 0xF0, 0xFF, 0xA9, 0xF8, 0xFF, 0x47, 0xF0, 0xFF, 0x4D, 0xF9, 0xFF, 0x4D, 0xF9, 0xFF, 0x06, 0xE8, 0xFF, 0x47, 0xF8, 0xFF, 0xA9, 0xF8, 0xFF, 0xAA, 0xF8, 0xFF, 0x88, 0xF8, 0xFF, 0x4A, 0xF9, 0xFF, 0x48, 0xF0, 0xFF,
-    0xCB, 0xF8, 0xFF, 0xA9, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x89, 0xF8, 0xFF, 0x68, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x48, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0x27, 0xF0, 0xFF, 0x29, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x69, 0xF8, 0xFF, 0x8A, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x64, 0x58, 0xFF, 0x23, 0x38, 0xFF, 0x85, 0x50, 0xFF, 0xCB, 0xA1, 0xFF, 0x04, 0x40, 0xFF, 0x4C, 0x71, 0xFF, 0xEC, 0x81, 0xFF, 0x03, 0x40, 0xFF, 0x85, 0x48, 0xFF, 0x68, 0x50, 0xFF, 0x24, 0x48, 0xFF, 0xC8, 0x98, 0xFF, 0x44, 0x58, 0xFF, 0x09, 0x79, 0xFF, 0x11, 0x92, 0xFF, 0x4A, 0xA9, 0xFF, 0x25, 0x80, 0xFF, 0xA8, 0x80, 0xFF, 0x6E, 0x79, 0xFF, 0xCD, 0xD1, 0xFF, 0x25, 0x68, 0xFF, 0x46, 0x70, 0xFF, 0x26, 0x70, 0xFF, 0x90, 0x99, 0xFF, 0x46, 0x70, 0xFF, 0x25, 0x68, 0xFF, 0x0C, 0x81, 0xFF, 0xF4, 0x91, 0xFF, 0x0A, 0xA1, 0xFF, 0x46, 0x68, 0xFF, 0x89, 0xA0, 0xFF, 0x0C, 0xA1, 0xFF, 0x89, 0xB0, 0xFF, 0x88, 0xA0, 0xFF, 0x06, 0x98, 0xFF, 0x10, 0xCA, 0xFF, 0xB4, 0xC1, 0xFF, 0x06, 0xB0, 0xFF, 0x87, 0x98, 0xFF, 0x0A, 0xB9, 0xFF, 0xB1, 0xD1, 0xFF, 0x92, 0xFA, 0xFF, 0x26, 0xB8, 0xFF, 0x88, 0xC8, 0xFF, 0x89, 0xD0, 0xFF, 0xAE, 0xF9, 0xFF, 0x47, 0xD0, 0xFF, 0x6B, 0xF9, 0xFF,
-    0x0A, 0xF9, 0xFF, 0x2F, 0xF1, 0xFF, 0xB3, 0xFA, 0xFF, 0x47, 0xF0, 0xFF, 0xC9, 0xF8, 0xFF, 0xCC, 0xF0, 0xFF, 0x88, 0xF8, 0xFF, 0xA8, 0xF8, 0xFF, 0xC9, 0xF8, 0xFF, 0x90, 0xF9, 0xFF, 0x89, 0xF8, 0xFF, 0x47, 0xF8, 0xFF, 0x47, 0xF8, 0xFF, 0x49, 0xF0, 0xFF, 0x27, 0xF0, 0xFF, 0x06, 0xF0, 0xFF, 0x88, 0xF8, 0xFF, 0x89, 0xF8, 0xFF, 0x06, 0xE8, 0xFF, 0x27, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x49, 0xF8, 0xFF, 0xAA, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x89, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x8A, 0xF8, 0xFF, 0x69, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x8B, 0xF8, 0xFF, 0x28, 0x79, 0xFF, 0x44, 0x40, 0xFF, 0x2D, 0xCA, 0xFF, 0x69, 0x58, 0xFF, 0x44, 0x48, 0xFF, 0xA5, 0x58, 0xFF, 0xEB, 0xB1, 0xFF, 0xE9, 0x70, 0xFF, 0x87, 0x58, 0xFF, 0xEC, 0xA1, 0xFF, 0x44, 0x48, 0xFF, 0x87, 0x80, 0xFF, 0x90, 0x81, 0xFF, 0x65, 0x68, 0xFF, 0xAB, 0xC1, 0xFF, 0x66, 0xA8, 0xFF, 0xA7, 0x78, 0xFF, 0x92, 0x81, 0xFF, 0x08, 0x79, 0xFF, 0x8C, 0xC9, 0xFF, 0x25, 0x68, 0xFF, 0x68, 0x60, 0xFF, 0x92, 0x99, 0xFF, 0x05, 0x60, 0xFF, 0x04, 0x60, 0xFF, 0x05, 0x70, 0xFF, 0xCC, 0x80, 0xFF, 0x67, 0x98, 0xFF, 0x0A, 0xA1, 0xFF, 0xA8, 0x80, 0xFF, 0xA8, 0xB8, 0xFF, 0xDB, 0xB2, 0xFF,
-    0x88, 0xA8, 0xFF, 0x68, 0xA8, 0xFF, 0x2A, 0xC1, 0xFF, 0x2B, 0xE9, 0xFF, 0x34, 0xD2, 0xFF, 0x26, 0xB8, 0xFF, 0x67, 0x98, 0xFF, 0x0A, 0xB9, 0xFF, 0x2C, 0xC1, 0xFF, 0xEA, 0xE8, 0xFF, 0x04, 0xA8, 0xFF, 0x88, 0xD0, 0xFF, 0xA9, 0xE0, 0xFF, 0x78, 0xFA, 0xFF, 0xE9, 0xF8, 0xFF, 0x4B, 0xF9, 0xFF, 0xA8, 0xF8, 0xFF, 0x06, 0xE0, 0xFF, 0xB6, 0xFA, 0xFF, 0x05, 0xE8, 0xFF, 0xC9, 0xF8, 0xFF, 0x05, 0xF0, 0xFF, 0xD3, 0xF9, 0xFF, 0x88, 0xE8, 0xFF, 0x2B, 0xF9, 0xFF, 0x68, 0xF8, 0xFF, 0x68, 0xF0, 0xFF, 0xB4, 0xF9, 0xFF, 0x06, 0xF0, 0xFF, 0xC9, 0xF8, 0xFF, 0x06, 0xE8, 0xFF, 0x0D, 0xF9, 0xFF, 0xCC, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x26, 0xF8, 0xFF, 0x05, 0xE8, 0xFF, 0xCE, 0xF8, 0xFF, 0xCB, 0xF8, 0xFF, 0x48, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x6F, 0xF9, 0xFF, 0x4B, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x69, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x8B, 0xF8, 0xFF, 0xED, 0xF8, 0xFF, 0x29, 0xA1, 0xFF, 0xE9, 0x58, 0xFF, 0x69, 0xA1, 0xFF, 0x44, 0x48, 0xFF, 0x45, 0x40, 0xFF, 0x03, 0x48, 0xFF, 0xCA, 0x68, 0xFF, 0x69, 0x89, 0xFF, 0x85, 0x58, 0xFF, 0x2D, 0xCA, 0xFF, 0x24, 0x48, 0xFF, 0x6B, 0xA9, 0xFF, 0x03, 0x38, 0xFF, 0xC8, 0x70, 0xFF, 0xAB, 0xA9, 0xFF, 0xCF, 0xA1, 0xFF,
-    0xF0, 0xA9, 0xFF, 0x88, 0x68, 0xFF, 0x49, 0x89, 0xFF, 0x8B, 0xB9, 0xFF, 0x89, 0x88, 0xFF, 0xCA, 0x88, 0xFF, 0x25, 0x70, 0xFF, 0x45, 0x68, 0xFF, 0x45, 0x70, 0xFF, 0x49, 0x78, 0xFF, 0x49, 0x90, 0xFF, 0x25, 0x70, 0xFF, 0x09, 0xB1, 0xFF, 0x26, 0x70, 0xFF, 0x27, 0x98, 0xFF, 0x67, 0xA0, 0xFF, 0xA9, 0xB8, 0xFF, 0x26, 0x98, 0xFF, 0x67, 0x98, 0xFF, 0xAE, 0xE9, 0xFF, 0xEB, 0xB0, 0xFF, 0x88, 0xD8, 0xFF, 0x46, 0x98, 0xFF, 0x6C, 0xD9, 0xFF, 0x0D, 0xC9, 0xFF, 0x88, 0xD0, 0xFF, 0x26, 0xC0, 0xFF, 0x2B, 0xF1, 0xFF, 0xAA, 0xE8, 0xFF, 0xD3, 0xF9, 0xFF, 0x47, 0xD8, 0xFF, 0x69, 0xE0, 0xFF, 0x88, 0xF8, 0xFF, 0x48, 0xF8, 0xFF, 0xF6, 0xF9, 0xFF, 0x89, 0xF8, 0xFF, 0x8C, 0xF9, 0xFF, 0x26, 0xF0, 0xFF, 0x48, 0xF8, 0xFF, 0xF5, 0xF9, 0xFF, 0xAA, 0xF8, 0xFF, 0x0A, 0xF9, 0xFF, 0x89, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0x33, 0xFA, 0xFF, 0x0B, 0xF9, 0xFF, 0x28, 0xF0, 0xFF, 0x28, 0xF8, 0xFF, 0x27, 0xF0, 0xFF, 0x11, 0xFA, 0xFF, 0xAA, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF0, 0xFF, 0x0D, 0xF1, 0xFF, 0x4F, 0xF9, 0xFF, 0x28, 0xF8, 0xFF, 0x29, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x4F, 0xF9, 0xFF, 0x2A, 0xF8, 0xFF, 0x2A, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x6C, 0xF8, 0xFF,
-    0x85, 0x78, 0xFF, 0x44, 0x40, 0xFF, 0xA5, 0x70, 0xFF, 0x45, 0x50, 0xFF, 0xEB, 0x70, 0xFF, 0x49, 0xA1, 0xFF, 0x65, 0x70, 0xFF, 0xE7, 0x68, 0xFF, 0xA8, 0x60, 0xFF, 0xF1, 0x91, 0xFF, 0x63, 0x70, 0xFF, 0x6D, 0xFA, 0xFF, 0xA8, 0x70, 0xFF, 0x24, 0x58, 0xFF, 0x86, 0x70, 0xFF, 0x29, 0xA9, 0xFF, 0xA8, 0x88, 0xFF, 0x49, 0xA9, 0xFF, 0x69, 0x99, 0xFF, 0x0C, 0xE2, 0xFF, 0x8E, 0xB9, 0xFF, 0x25, 0x80, 0xFF, 0x66, 0x80, 0xFF, 0x04, 0x68, 0xFF, 0xEB, 0x90, 0xFF, 0x26, 0x88, 0xFF, 0x06, 0x98, 0xFF, 0x46, 0x78, 0xFF, 0x2E, 0x99, 0xFF, 0x46, 0x78, 0xFF, 0x06, 0xA0, 0xFF, 0x26, 0x88, 0xFF, 0x0C, 0xB9, 0xFF, 0x06, 0x98, 0xFF, 0xC8, 0xA8, 0xFF, 0xC9, 0xB0, 0xFF, 0x4E, 0xC1, 0xFF, 0x47, 0xD8, 0xFF, 0x46, 0xA0, 0xFF, 0xA9, 0xC8, 0xFF, 0x70, 0xD9, 0xFF, 0x08, 0xC8, 0xFF, 0x46, 0xC8, 0xFF, 0xC9, 0xE8, 0xFF, 0x49, 0xE0, 0xFF, 0x4A, 0xF9, 0xFF, 0x1E, 0xFC, 0xFF, 0x45, 0xD8, 0xFF, 0xED, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x67, 0xF0, 0xFF, 0xB9, 0xF2, 0xFF, 0x4E, 0xF9, 0xFF, 0x07, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x27, 0xF8, 0xFF, 0x15, 0xF3, 0xFF, 0x69, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0xEC, 0xF8, 0xFF, 0x15, 0xFC, 0xFF, 0x05, 0xE0, 0xFF, 0x68, 0xF8, 0xFF,
-    0xAB, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0xD3, 0xFB, 0xFF, 0xCB, 0xF0, 0xFF, 0x49, 0xF0, 0xFF, 0x07, 0xF0, 0xFF, 0x08, 0xF0, 0xFF, 0x92, 0xFB, 0xFF, 0x72, 0xFB, 0xFF, 0x09, 0xF8, 0xFF, 0x49, 0xF8, 0xFF, 0x09, 0xF0, 0xFF, 0xD2, 0xFA, 0xFF, 0xB0, 0xFA, 0xFF, 0x6B, 0xF8, 0xFF, 0x4B, 0xF8, 0xFF, 0x23, 0x48, 0xFF, 0x64, 0x40, 0xFF, 0x22, 0x48, 0xFF, 0x02, 0x40, 0xFF, 0x44, 0x40, 0xFF, 0xED, 0xC1, 0xFF, 0x03, 0x48, 0xFF, 0x45, 0x58, 0xFF, 0x44, 0x48, 0xFF, 0x86, 0x78, 0xFF, 0x08, 0xA1, 0xFF, 0xE8, 0xB0, 0xFF, 0x24, 0x58, 0xFF, 0x03, 0x48, 0xFF, 0x05, 0x60, 0xFF, 0x46, 0x88, 0xFF, 0x45, 0x70, 0xFF, 0xE8, 0x90, 0xFF, 0xE7, 0x78, 0xFF, 0x0F, 0xEA, 0xFF, 0x8C, 0xE9, 0xFF, 0x25, 0x70, 0xFF, 0x25, 0x78, 0xFF, 0x67, 0x80, 0xFF, 0x25, 0x70, 0xFF, 0x25, 0x78, 0xFF, 0x88, 0x88, 0xFF, 0x4C, 0x91, 0xFF, 0x6B, 0xB9, 0xFF, 0x45, 0x80, 0xFF, 0x87, 0xB0, 0xFF, 0x46, 0x88, 0xFF, 0x49, 0xB8, 0xFF, 0x67, 0xA8, 0xFF, 0xA7, 0xA8, 0xFF, 0x67, 0xB0, 0xFF, 0x2E, 0xC1, 0xFF, 0x26, 0xE0, 0xFF, 0x46, 0xA0, 0xFF, 0x88, 0xC0, 0xFF, 0xAB, 0xC0, 0xFF, 0x06, 0xD0, 0xFF, 0x05, 0xC8, 0xFF, 0xC9, 0xF0, 0xFF, 0xC8, 0xE8, 0xFF, 0x2A, 0xF9, 0xFF, 0x0A, 0xF1, 0xFF, 0x05, 0xE0, 0xFF,
-    0x87, 0xF8, 0xFF, 0x47, 0xF8, 0xFF, 0x48, 0xF0, 0xFF, 0x27, 0xF8, 0xFF, 0x8F, 0xFA, 0xFF, 0x48, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x93, 0xFC, 0xFF, 0xEC, 0xF0, 0xFF, 0x27, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x49, 0xF8, 0xFF, 0x2D, 0xF9, 0xFF, 0x28, 0xF0, 0xFF, 0x27, 0xF0, 0xFF, 0x08, 0xF8, 0xFF, 0xCC, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0xEC, 0xF9, 0xFF, 0xED, 0xF8, 0xFF, 0x6D, 0xF9, 0xFF, 0x08, 0xF0, 0xFF, 0x29, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x2A, 0xF8, 0xFF, 0x29, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x2A, 0xF8, 0xFF, 0x4B, 0xF8, 0xFF, 0x6C, 0xF8, 0xFF, 0x84, 0x48, 0xFF, 0x44, 0x40, 0xFF, 0x64, 0x48, 0xFF, 0xC8, 0x58, 0xFF, 0x64, 0x50, 0xFF, 0x28, 0x79, 0xFF, 0x02, 0x58, 0xFF, 0x23, 0x48, 0xFF, 0x2A, 0x69, 0xFF, 0x45, 0x60, 0xFF, 0x6A, 0xA1, 0xFF, 0x24, 0x70, 0xFF, 0x28, 0x79, 0xFF, 0x03, 0x50, 0xFF, 0x45, 0x70, 0xFF, 0x09, 0xD9, 0xFF, 0x65, 0x68, 0xFF, 0xC9, 0x68, 0xFF, 0xEA, 0x80, 0xFF, 0x8B, 0xE1, 0xFF, 0xAB, 0xC1, 0xFF, 0x09, 0x89, 0xFF, 0xF3, 0xA1, 0xFF, 0x25, 0x70, 0xFF, 0x45, 0x70, 0xFF, 0xC9, 0x90, 0xFF, 0x46, 0x90, 0xFF, 0x46, 0x78, 0xFF, 0xC8, 0x98, 0xFF, 0xA8, 0x90, 0xFF, 0xA7, 0xA0, 0xFF, 0xB2, 0xA9, 0xFF,
-    0x47, 0xB8, 0xFF, 0x05, 0x98, 0xFF, 0xA7, 0x98, 0xFF, 0xEF, 0xE9, 0xFF, 0x50, 0xC9, 0xFF, 0x67, 0xE8, 0xFF, 0x45, 0xA0, 0xFF, 0x87, 0xC8, 0xFF, 0x89, 0xC0, 0xFF, 0x05, 0xD8, 0xFF, 0x26, 0xC8, 0xFF, 0xAC, 0xF9, 0xFF, 0x88, 0xE8, 0xFF, 0xB1, 0xF9, 0xFF, 0x4A, 0xE9, 0xFF, 0x68, 0xF0, 0xFF, 0x26, 0xF8, 0xFF, 0x4E, 0xF9, 0xFF, 0x47, 0xF0, 0xFF, 0xA9, 0xF8, 0xFF, 0x2D, 0xFA, 0xFF, 0x06, 0xF0, 0xFF, 0x28, 0xF0, 0xFF, 0x27, 0xF0, 0xFF, 0x70, 0xF4, 0xFF, 0x92, 0xFB, 0xFF, 0xB0, 0xF9, 0xFF, 0x28, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x89, 0xF8, 0xFF, 0x4C, 0xF9, 0xFF, 0x2E, 0xFA, 0xFF, 0x08, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x6A, 0xF8, 0xFF, 0x28, 0xF0, 0xFF, 0x2E, 0xFB, 0xFF, 0x08, 0xF0, 0xFF, 0x4A, 0xF8, 0xFF, 0x4D, 0xF9, 0xFF, 0x6B, 0xF8, 0xFF, 0x29, 0xF8, 0xFF, 0x2A, 0xF8, 0xFF, 0x4C, 0xF9, 0xFF, 0x4B, 0xF8, 0xFF, 0x0A, 0xF0, 0xFF, 0x2A, 0xF8, 0xFF, 0x6C, 0xF8, 0xFF, 0x84, 0x48, 0xFF, 0x85, 0x40, 0xFF, 0x43, 0x40, 0xFF, 0x44, 0x38, 0xFF, 0xA5, 0x78, 0xFF, 0x84, 0x58, 0xFF, 0x45, 0x68, 0xFF, 0x44, 0x50, 0xFF, 0x03, 0x40, 0xFF, 0x66, 0x60, 0xFF, 0xA6, 0xA8, 0xFF, 0x66, 0x70, 0xFF, 0xAB, 0x99, 0xFF, 0xA8, 0x78, 0xFF, 0x03, 0x58, 0xFF, 0x66, 0x98, 0xFF,
-    0x46, 0x58, 0xFF, 0xC9, 0x80, 0xFF, 0x44, 0x70, 0xFF, 0x09, 0xC9, 0xFF, 0x2D, 0xC2, 0xFF, 0xD1, 0xA1, 0xFF, 0x2B, 0x99, 0xFF, 0x45, 0x70, 0xFF, 0x25, 0x78, 0xFF, 0x27, 0x80, 0xFF, 0xD3, 0xA9, 0xFF, 0xE8, 0x90, 0xFF, 0x8A, 0xC9, 0xFF, 0x45, 0x80, 0xFF, 0x87, 0xA0, 0xFF, 0xF5, 0xC9, 0xFF, 0xA9, 0xB0, 0xFF, 0x04, 0x98, 0xFF, 0x66, 0xA0, 0xFF, 0xC9, 0xD8, 0xFF, 0x2D, 0xC9, 0xFF, 0xA8, 0xF0, 0xFF, 0x66, 0xA8, 0xFF, 0x67, 0xD8, 0xFF, 0x0D, 0xE1, 0xFF, 0x06, 0xD8, 0xFF, 0x05, 0xC8, 0xFF, 0x67, 0xE0, 0xFF, 0x2B, 0xF1, 0xFF, 0x0E, 0xF1, 0xFF, 0xCC, 0xF9, 0xFF, 0x26, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x47, 0xF8, 0xFF, 0x13, 0xFA, 0xFF, 0x49, 0xF8, 0xFF, 0xAA, 0xD2, 0xFF, 0x47, 0xF0, 0xFF, 0x6A, 0xF0, 0xFF, 0x8E, 0xF2, 0xFF, 0x2C, 0xFA, 0xFF, 0xB3, 0xFE, 0xFF, 0x8A, 0xF8, 0xFF, 0xB1, 0xFA, 0xFF, 0x8A, 0xF8, 0xFF, 0xA9, 0xF8, 0xFF, 0x8E, 0xFB, 0xFF, 0x8C, 0xF9, 0xFF, 0x49, 0xF8, 0xFF, 0xC9, 0xF0, 0xFF, 0x4B, 0xF9, 0xFF, 0x08, 0xF0, 0xFF, 0x8F, 0xFA, 0xFF, 0x48, 0xF0, 0xFF, 0x68, 0xE8, 0xFF, 0x6E, 0xFA, 0xFF, 0x8A, 0xF0, 0xFF, 0x8A, 0xF8, 0xFF, 0x0A, 0xF8, 0xFF, 0x2C, 0xF9, 0xFF, 0x6B, 0xF8, 0xFF, 0x69, 0xE8, 0xFF, 0x8C, 0xF8, 0xFF, 0x8D, 0xF8, 0xFF,
-    0x64, 0x48, 0xFF, 0x03, 0x38, 0xFF, 0x03, 0x48, 0xFF, 0x44, 0x40, 0xFF, 0x69, 0x89, 0xFF, 0x03, 0x58, 0xFF, 0x4D, 0xD2, 0xFF, 0x44, 0x50, 0xFF, 0x45, 0x50, 0xFF, 0x02, 0x48, 0xFF, 0x6D, 0xA2, 0xFF, 0x25, 0x58, 0xFF, 0x6B, 0x91, 0xFF, 0x43, 0x50, 0xFF, 0x03, 0x58, 0xFF, 0xCB, 0x88, 0xFF, 0xC9, 0x78, 0xFF, 0x65, 0x70, 0xFF, 0x24, 0x70, 0xFF, 0xC7, 0x98, 0xFF, 0x0F, 0xD2, 0xFF, 0x04, 0x80, 0xFF, 0x86, 0x80, 0xFF, 0x45, 0x78, 0xFF, 0xC9, 0x98, 0xFF, 0x46, 0x90, 0xFF, 0x25, 0x90, 0xFF, 0x04, 0x78, 0xFF, 0x0D, 0xA9, 0xFF, 0x05, 0x88, 0xFF, 0x05, 0xA0, 0xFF, 0x25, 0x90, 0xFF, 0x89, 0xC0, 0xFF, 0xA7, 0xB0, 0xFF, 0x66, 0x98, 0xFF, 0x87, 0xC0, 0xFF, 0x0B, 0xC9, 0xFF, 0x46, 0xC8, 0xFF, 0x45, 0xB0, 0xFF, 0xA7, 0xD0, 0xFF, 0x4E, 0xE9, 0xFF, 0x05, 0xE0, 0xFF, 0x05, 0xC8, 0xFF, 0x6B, 0xF9, 0xFF, 0x6D, 0xF1, 0xFF, 0x0A, 0xF9, 0xFF, 0x4E, 0xFA, 0xFF, 0x05, 0xF8, 0xFF, 0xEC, 0xF8, 0xFF, 0x26, 0xF8, 0xFF, 0x27, 0xF0, 0xFF, 0x48, 0xF8, 0xFF, 0xAB, 0xE9, 0xFF, 0x49, 0xF8, 0xFF, 0x0B, 0xF9, 0xFF, 0xF5, 0xFD, 0xFF, 0xF6, 0xFF, 0xFF, 0x70, 0xFD, 0xFF, 0xA9, 0xF8, 0xFF, 0x89, 0xF8, 0xFF, 0x53, 0xFD, 0xFF, 0x2D, 0xFC, 0xFF, 0xAB, 0xE4, 0xFF, 0xEB, 0xF9, 0xFF,
-    0xCB, 0xF9, 0xFF, 0x14, 0xFD, 0xFF, 0xAD, 0xFC, 0xFF, 0x6C, 0xFB, 0xFF, 0x4B, 0xF2, 0xFF, 0xCB, 0xF1, 0xFF, 0x6B, 0xF2, 0xFF, 0xB0, 0xFC, 0xFF, 0xEC, 0xFA, 0xFF, 0x4B, 0xF9, 0xFF, 0xCD, 0xF9, 0xFF, 0x8C, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x54, 0xFF, 0xFF, 0x0C, 0xF9, 0xFF, 0x8C, 0xF8, 0xFF, 0x44, 0x50, 0xFF, 0x44, 0x48, 0xFF, 0x43, 0x40, 0xFF, 0x23, 0x38, 0xFF, 0x6D, 0x79, 0xFF, 0x24, 0x60, 0xFF, 0xAB, 0xC9, 0xFF, 0x44, 0x50, 0xFF, 0x64, 0x48, 0xFF, 0x45, 0x50, 0xFF, 0xA6, 0xA0, 0xFF, 0xC7, 0x70, 0xFF, 0x43, 0x60, 0xFF, 0x03, 0x48, 0xFF, 0x03, 0x58, 0xFF, 0x90, 0xCA, 0xFF, 0x23, 0x48, 0xFF, 0x65, 0x70, 0xFF, 0x45, 0x60, 0xFF, 0xA9, 0xB0, 0xFF, 0x14, 0xBA, 0xFF, 0x03, 0x78, 0xFF, 0xA7, 0x88, 0xFF, 0x46, 0x70, 0xFF, 0x03, 0x78, 0xFF, 0x45, 0x90, 0xFF, 0x25, 0x88, 0xFF, 0x65, 0x88, 0xFF, 0xA8, 0x98, 0xFF, 0x46, 0x88, 0xFF, 0x66, 0xB0, 0xFF, 0x26, 0x98, 0xFF, 0x68, 0xD0, 0xFF, 0x05, 0xA8, 0xFF, 0x45, 0x98, 0xFF, 0xA7, 0xC8, 0xFF, 0x0C, 0xD1, 0xFF, 0x67, 0xD8, 0xFF, 0x25, 0xA8, 0xFF, 0x67, 0xC8, 0xFF, 0x4E, 0xF1, 0xFF, 0x27, 0xE8, 0xFF, 0x04, 0xC8, 0xFF, 0x87, 0xF8, 0xFF, 0x76, 0xFC, 0xFF, 0x2A, 0xF9, 0xFF, 0x53, 0xFA, 0xFF, 0x27, 0xF8, 0xFF,
-    0x06, 0xF8, 0xFF, 0x47, 0xF8, 0xFF, 0x06, 0xE8, 0xFF, 0xF7, 0xFB, 0xFF, 0x29, 0xE1, 0xFF, 0xAA, 0xF8, 0xFF, 0x89, 0xF8, 0xFF, 0x91, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF5, 0xFF, 0x4A, 0xF9, 0xFF, 0x09, 0xF9, 0xFF, 0x2D, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x08, 0xEA, 0xFF, 0x49, 0xE9, 0xFF, 0xAE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x6B, 0xFA, 0xFF, 0x8D, 0xFA, 0xFF, 0x4C, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x2C, 0xFA, 0xFF, 0x6C, 0xF9, 0xFF, 0x2C, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x2D, 0xFA, 0xFF, 0xAC, 0xF8, 0xFF, 0x44, 0x50, 0xFF, 0x22, 0x48, 0xFF, 0x64, 0x48, 0xFF, 0x43, 0x38, 0xFF, 0x63, 0x40, 0xFF, 0xC8, 0x70, 0xFF, 0x85, 0x78, 0xFF, 0x02, 0x38, 0xFF, 0x03, 0x40, 0xFF, 0x0A, 0x79, 0xFF, 0xC7, 0xA0, 0xFF, 0x23, 0x50, 0xFF, 0x23, 0x50, 0xFF, 0x03, 0x48, 0xFF, 0x88, 0x80, 0xFF, 0xEB, 0xE9, 0xFF, 0x23, 0x50, 0xFF, 0x03, 0x58, 0xFF, 0x2D, 0x89, 0xFF, 0x65, 0xB8, 0xFF, 0x66, 0x88, 0xFF, 0x03, 0x68, 0xFF, 0x03, 0x68, 0xFF, 0x46, 0x80, 0xFF, 0x04, 0x80, 0xFF, 0xC8, 0xA0, 0xFF, 0x04, 0x80, 0xFF, 0x50, 0xB1, 0xFF, 0x87, 0x98, 0xFF, 0xA7, 0x98, 0xFF, 0x25, 0x98, 0xFF, 0x04, 0x88, 0xFF,
-    0x05, 0xC0, 0xFF, 0x46, 0xA0, 0xFF, 0x24, 0x98, 0xFF, 0x48, 0xD9, 0xFF, 0x4C, 0xD9, 0xFF, 0x87, 0xC8, 0xFF, 0x65, 0xB0, 0xFF, 0x24, 0xC8, 0xFF, 0x8F, 0xF9, 0xFF, 0x46, 0xE8, 0xFF, 0x05, 0xD0, 0xFF, 0xC9, 0xF8, 0xFF, 0x10, 0xFB, 0xFF, 0x06, 0xF8, 0xFF, 0x51, 0xFB, 0xFF, 0x68, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x30, 0xF9, 0xFF, 0x05, 0xF0, 0xFF, 0x07, 0xF8, 0xFF, 0x6A, 0xE9, 0xFF, 0x90, 0xF9, 0xFF, 0x4A, 0xF8, 0xFF, 0x0E, 0xFC, 0xFF, 0x6B, 0xF3, 0xFF, 0xAA, 0xEA, 0xFF, 0x4A, 0xF9, 0xFF, 0x09, 0xF9, 0xFF, 0x8A, 0xFA, 0xFF, 0x10, 0xFE, 0xFF, 0xCD, 0xF4, 0xFF, 0xC8, 0xE1, 0xFF, 0x48, 0xE9, 0xFF, 0xAD, 0xFB, 0xFF, 0x10, 0xFD, 0xFF, 0x6D, 0xFC, 0xFF, 0x8A, 0xF9, 0xFF, 0x8A, 0xF9, 0xFF, 0x0B, 0xFA, 0xFF, 0xAE, 0xF4, 0xFF, 0x6F, 0xFC, 0xFF, 0xCB, 0xF9, 0xFF, 0xEB, 0xF8, 0xFF, 0xAB, 0xF1, 0xFF, 0xEF, 0xFB, 0xFF, 0xCF, 0xFB, 0xFF, 0x4C, 0xF9, 0xFF, 0xAC, 0xF8, 0xFF, 0x43, 0x48, 0xFF, 0xE6, 0x78, 0xFF, 0x63, 0x40, 0xFF, 0xE9, 0x60, 0xFF, 0x64, 0x48, 0xFF, 0x44, 0x48, 0xFF, 0x23, 0x48, 0xFF, 0x02, 0x38, 0xFF, 0x0B, 0x79, 0xFF, 0x64, 0x50, 0xFF, 0xE6, 0x88, 0xFF, 0x22, 0x48, 0xFF, 0x65, 0x58, 0xFF, 0x09, 0x81, 0xFF, 0x02, 0x60, 0xFF, 0xE7, 0xA8, 0xFF,
-    0x65, 0x58, 0xFF, 0x4D, 0x91, 0xFF, 0x03, 0x58, 0xFF, 0x45, 0x88, 0xFF, 0xA7, 0x98, 0xFF, 0x65, 0x80, 0xFF, 0xF1, 0xB9, 0xFF, 0x45, 0x70, 0xFF, 0xA6, 0xA8, 0xFF, 0x45, 0x88, 0xFF, 0x24, 0x80, 0xFF, 0x04, 0x78, 0xFF, 0x86, 0x98, 0xFF, 0x44, 0x80, 0xFF, 0x46, 0xA8, 0xFF, 0xD3, 0xC1, 0xFF, 0x04, 0xB0, 0xFF, 0x46, 0xB0, 0xFF, 0x44, 0xA0, 0xFF, 0x09, 0xE1, 0xFF, 0xCA, 0xC8, 0xFF, 0x88, 0xE8, 0xFF, 0x24, 0xA8, 0xFF, 0x26, 0xC8, 0xFF, 0x0D, 0xE9, 0xFF, 0x67, 0xF0, 0xFF, 0x05, 0xD8, 0xFF, 0x67, 0xF8, 0xFF, 0x91, 0xFB, 0xFF, 0xB2, 0xF9, 0xFF, 0x6E, 0xFA, 0xFF, 0x25, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0xCC, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x07, 0xF0, 0xFF, 0x6B, 0xF9, 0xFF, 0x07, 0xF0, 0xFF, 0x12, 0xFB, 0xFF, 0x4C, 0xFA, 0xFF, 0x4A, 0xF9, 0xFF, 0xA8, 0xF0, 0xFF, 0x88, 0xF8, 0xFF, 0x0E, 0xFB, 0xFF, 0xA9, 0xF1, 0xFF, 0x88, 0xF1, 0xFF, 0x0E, 0xFC, 0xFF, 0x0D, 0xF3, 0xFF, 0xAF, 0xFB, 0xFF, 0x0B, 0xFA, 0xFF, 0x4B, 0xFA, 0xFF, 0xAF, 0xFB, 0xFF, 0x6C, 0xF2, 0xFF, 0x8B, 0xF9, 0xFF, 0xCB, 0xF9, 0xFF, 0xEB, 0xF9, 0xFF, 0x0F, 0xFC, 0xFF, 0x2E, 0xFB, 0xFF, 0xCB, 0xF8, 0xFF, 0x2B, 0xF9, 0xFF, 0x4B, 0xF9, 0xFF, 0x8C, 0xF9, 0xFF, 0x2C, 0xF9, 0xFF, 0xAB, 0xF8, 0xFF,
-    0x43, 0x40, 0xFF, 0x0C, 0x9A, 0xFF, 0x06, 0x51, 0xFF, 0x44, 0x40, 0xFF, 0x43, 0x48, 0xFF, 0x64, 0x48, 0xFF, 0x07, 0x69, 0xFF, 0xC6, 0x68, 0xFF, 0xE7, 0x60, 0xFF, 0x44, 0x48, 0xFF, 0x85, 0x50, 0xFF, 0x0A, 0x79, 0xFF, 0xA6, 0x68, 0xFF, 0xA5, 0x60, 0xFF, 0x65, 0x70, 0xFF, 0x23, 0x50, 0xFF, 0x2C, 0x89, 0xFF, 0xA6, 0x68, 0xFF, 0x23, 0x60, 0xFF, 0x45, 0x80, 0xFF, 0x89, 0x90, 0xFF, 0x90, 0xA9, 0xFF, 0x24, 0x70, 0xFF, 0x45, 0x70, 0xFF, 0x2E, 0xEA, 0xFF, 0xA7, 0xA0, 0xFF, 0xF2, 0xC1, 0xFF, 0x24, 0x68, 0xFF, 0x2B, 0xB1, 0xFF, 0x86, 0x88, 0xFF, 0x04, 0x90, 0xFF, 0xB2, 0xD1, 0xFF, 0x47, 0xB8, 0xFF, 0xA6, 0xB0, 0xFF, 0x24, 0xA0, 0xFF, 0x26, 0xB0, 0xFF, 0x2D, 0xE9, 0xFF, 0x88, 0xF0, 0xFF, 0x45, 0xB0, 0xFF, 0x86, 0xD0, 0xFF, 0x6F, 0xF9, 0xFF, 0x05, 0xE8, 0xFF, 0x88, 0xD8, 0xFF, 0xA9, 0xE8, 0xFF, 0xA9, 0xF0, 0xFF, 0x92, 0xF9, 0xFF, 0xC9, 0xF8, 0xFF, 0xC9, 0xF8, 0xFF, 0x8A, 0xF8, 0xFF, 0x05, 0xF0, 0xFF, 0x52, 0xFA, 0xFF, 0x2B, 0xF9, 0xFF, 0xB0, 0xFB, 0xFF, 0x14, 0xFE, 0xFF, 0x68, 0xF0, 0xFF, 0x51, 0xFC, 0xFF, 0xCD, 0xFA, 0xFF, 0x48, 0xF1, 0xFF, 0x88, 0xF8, 0xFF, 0xE8, 0xF8, 0xFF, 0xCE, 0xFB, 0xFF, 0x89, 0xF9, 0xFF, 0xF2, 0xFD, 0xFF, 0xED, 0xFA, 0xFF,
-    0x4E, 0xFB, 0xFF, 0x8B, 0xF3, 0xFF, 0x68, 0xE9, 0xFF, 0x73, 0xFE, 0xFF, 0x29, 0xF9, 0xFF, 0x92, 0xFC, 0xFF, 0x2C, 0xFB, 0xFF, 0x49, 0xF1, 0xFF, 0x4C, 0xFB, 0xFF, 0x0C, 0xFA, 0xFF, 0x8F, 0xFB, 0xFF, 0x4B, 0xF9, 0xFF, 0x6C, 0xF9, 0xFF, 0x4C, 0xF9, 0xFF, 0xCC, 0xF8, 0xFF, 0xEC, 0xF8, 0xFF, 0x84, 0x38, 0xFF, 0x08, 0x89, 0xFF, 0x22, 0x40, 0xFF, 0x23, 0x38, 0xFF, 0x43, 0x48, 0xFF, 0xE8, 0x60, 0xFF, 0x43, 0x48, 0xFF, 0xAA, 0x81, 0xFF, 0x64, 0x50, 0xFF, 0x23, 0x40, 0xFF, 0xC8, 0x68, 0xFF, 0xA7, 0x68, 0xFF, 0x02, 0x40, 0xFF, 0x43, 0x50, 0xFF, 0x49, 0xB1, 0xFF, 0x4C, 0xA9, 0xFF, 0x22, 0x40, 0xFF, 0x03, 0x50, 0xFF, 0x66, 0x68, 0xFF, 0x25, 0x78, 0xFF, 0x24, 0x78, 0xFF, 0xAA, 0xC9, 0xFF, 0x03, 0x70, 0xFF, 0x03, 0x68, 0xFF, 0x29, 0xB9, 0xFF, 0x26, 0x88, 0xFF, 0x24, 0x80, 0xFF, 0x25, 0x88, 0xFF, 0x87, 0x88, 0xFF, 0xC8, 0x98, 0xFF, 0x25, 0x98, 0xFF, 0x03, 0x88, 0xFF, 0x48, 0xC8, 0xFF, 0x24, 0xA0, 0xFF, 0x24, 0x98, 0xFF, 0x45, 0xC0, 0xFF, 0xCB, 0xD8, 0xFF, 0x87, 0xE0, 0xFF, 0x24, 0xB0, 0xFF, 0x25, 0xD0, 0xFF, 0x4D, 0xF9, 0xFF, 0x26, 0xE8, 0xFF, 0x24, 0xD8, 0xFF, 0xA7, 0xF8, 0xFF, 0xD0, 0xFA, 0xFF, 0x04, 0xF0, 0xFF, 0x25, 0xE8, 0xFF, 0x67, 0xF8, 0xFF,
-    0x47, 0xF8, 0xFF, 0x26, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x28, 0xF0, 0xFF, 0x0F, 0xFB, 0xFF, 0x07, 0xF8, 0xFF, 0xC9, 0xF8, 0xFF, 0x4D, 0xF4, 0xFF, 0x73, 0xFF, 0xFF, 0x0A, 0xF3, 0xFF, 0xAA, 0xF9, 0xFF, 0x29, 0xF9, 0xFF, 0x2B, 0xFB, 0xFF, 0x4F, 0xFD, 0xFF, 0xB0, 0xFD, 0xFF, 0x0D, 0xFC, 0xFF, 0x2D, 0xFB, 0xFF, 0x6E, 0xFC, 0xFF, 0xAE, 0xFD, 0xFF, 0x72, 0xFE, 0xFF, 0xCA, 0xF9, 0xFF, 0x2D, 0xFB, 0xFF, 0x72, 0xFD, 0xFF, 0x2C, 0xFC, 0xFF, 0x2B, 0xF3, 0xFF, 0xAB, 0xF1, 0xFF, 0xEC, 0xF9, 0xFF, 0x4D, 0xF3, 0xFF, 0x4E, 0xF4, 0xFF, 0x6C, 0xFA, 0xFF, 0x8C, 0xF9, 0xFF, 0x0C, 0xF9, 0xFF, 0x84, 0x48, 0xFF, 0x23, 0x48, 0xFF, 0x43, 0x38, 0xFF, 0x22, 0x38, 0xFF, 0x44, 0x48, 0xFF, 0xA7, 0x60, 0xFF, 0x43, 0x48, 0xFF, 0x06, 0x69, 0xFF, 0xE5, 0x58, 0xFF, 0x64, 0x48, 0xFF, 0x09, 0x89, 0xFF, 0x64, 0x48, 0xFF, 0x43, 0x48, 0xFF, 0x68, 0x79, 0xFF, 0x09, 0xA1, 0xFF, 0xCE, 0xA1, 0xFF, 0x22, 0x40, 0xFF, 0x86, 0x68, 0xFF, 0xA8, 0x78, 0xFF, 0x03, 0x70, 0xFF, 0x92, 0xC1, 0xFF, 0x49, 0xB1, 0xFF, 0x66, 0x88, 0xFF, 0xCA, 0xA0, 0xFF, 0xC6, 0xB8, 0xFF, 0x26, 0x90, 0xFF, 0x03, 0x70, 0xFF, 0xEC, 0xA8, 0xFF, 0x45, 0x90, 0xFF, 0x24, 0x80, 0xFF, 0x86, 0xA8, 0xFF, 0x04, 0x88, 0xFF,
-    0x26, 0xC8, 0xFF, 0x04, 0xA0, 0xFF, 0x65, 0xA0, 0xFF, 0x24, 0xB8, 0xFF, 0xEA, 0xE0, 0xFF, 0x67, 0xE0, 0xFF, 0x24, 0xB0, 0xFF, 0x45, 0xC8, 0xFF, 0x4C, 0xF9, 0xFF, 0x07, 0xE0, 0xFF, 0x04, 0xD8, 0xFF, 0x66, 0xF0, 0xFF, 0x88, 0xE8, 0xFF, 0x05, 0xF8, 0xFF, 0x89, 0xE8, 0xFF, 0x67, 0xF8, 0xFF, 0xC9, 0xF8, 0xFF, 0x0C, 0xF9, 0xFF, 0x05, 0xF8, 0xFF, 0xB5, 0xFC, 0xFF, 0xA9, 0xF8, 0xFF, 0x4D, 0xF9, 0xFF, 0xC8, 0xE8, 0xFF, 0x4F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFC, 0xFF, 0x09, 0xEA, 0xFF, 0xEA, 0xF9, 0xFF, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xFE, 0xFF, 0xEC, 0xFB, 0xFF, 0x6C, 0xFB, 0xFF, 0x8D, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFE, 0xFF, 0x4A, 0xFA, 0xFF, 0x0B, 0xFA, 0xFF, 0xF3, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFD, 0xFF, 0xEB, 0xF9, 0xFF, 0x6A, 0xF9, 0xFF, 0xAC, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFC, 0xFF, 0x2D, 0xFA, 0xFF, 0x4C, 0xF9, 0xFF, 0x43, 0x38, 0xFF, 0x43, 0x40, 0xFF, 0x84, 0x40, 0xFF, 0x22, 0x38, 0xFF, 0x22, 0x38, 0xFF, 0x02, 0x38, 0xFF, 0xC5, 0x58, 0xFF, 0x84, 0x50, 0xFF, 0xE7, 0x68, 0xFF, 0x43, 0x40, 0xFF, 0x64, 0x60, 0xFF, 0x43, 0x48, 0xFF, 0x43, 0x48, 0xFF, 0x08, 0x79, 0xFF, 0xC6, 0xA0, 0xFF, 0x02, 0x48, 0xFF,
-    0x84, 0x58, 0xFF, 0x03, 0x50, 0xFF, 0x44, 0x68, 0xFF, 0x24, 0x68, 0xFF, 0x03, 0x70, 0xFF, 0xD0, 0x99, 0xFF, 0x4C, 0xA9, 0xFF, 0x45, 0x80, 0xFF, 0x85, 0x98, 0xFF, 0x23, 0x78, 0xFF, 0xA6, 0x90, 0xFF, 0x09, 0xA9, 0xFF, 0x45, 0x88, 0xFF, 0x24, 0x80, 0xFF, 0x24, 0x88, 0xFF, 0x2D, 0xC1, 0xFF, 0x86, 0xD8, 0xFF, 0x24, 0xA0, 0xFF, 0x65, 0xA8, 0xFF, 0x45, 0xB8, 0xFF, 0x6D, 0xF9, 0xFF, 0x66, 0xD8, 0xFF, 0x44, 0xB0, 0xFF, 0x05, 0xD0, 0xFF, 0xAA, 0xE0, 0xFF, 0x86, 0xF0, 0xFF, 0x04, 0xD8, 0xFF, 0x04, 0xE8, 0xFF, 0x87, 0xE0, 0xFF, 0x4D, 0xF9, 0xFF, 0x05, 0xE8, 0xFF, 0x26, 0xF8, 0xFF, 0x67, 0xF8, 0xFF, 0x88, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x09, 0xEA, 0xFF, 0xEC, 0xF9, 0xFF, 0x07, 0xF0, 0xFF, 0x0D, 0xFA, 0xFF, 0x49, 0xF2, 0xFF, 0xEC, 0xFB, 0xFF, 0x4A, 0xFA, 0xFF, 0x09, 0xF9, 0xFF, 0x49, 0xF9, 0xFF, 0xCA, 0xFA, 0xFF, 0xAF, 0xFD, 0xFF, 0xAB, 0xFB, 0xFF, 0x6A, 0xF2, 0xFF, 0x4A, 0xFA, 0xFF, 0x8A, 0xFA, 0xFF, 0x8D, 0xFC, 0xFF, 0xCC, 0xF3, 0xFF, 0xCA, 0xF9, 0xFF, 0xA9, 0xF9, 0xFF, 0xCC, 0xFB, 0xFF, 0xAE, 0xFC, 0xFF, 0xEB, 0xFA, 0xFF, 0xCB, 0xF9, 0xFF, 0x2C, 0xF9, 0xFF, 0xCB, 0xF9, 0xFF, 0x0D, 0xFB, 0xFF, 0x0C, 0xFA, 0xFF, 0x8C, 0xF9, 0xFF, 0x0C, 0xF9, 0xFF,
-    0x63, 0x40, 0xFF, 0x43, 0x40, 0xFF, 0x42, 0x38, 0xFF, 0x85, 0x50, 0xFF, 0x22, 0x38, 0xFF, 0x22, 0x38, 0xFF, 0x84, 0x50, 0xFF, 0x22, 0x40, 0xFF, 0x03, 0x48, 0xFF, 0x02, 0x38, 0xFF, 0x64, 0x60, 0xFF, 0x42, 0x40, 0xFF, 0x85, 0x60, 0xFF, 0x26, 0x71, 0xFF, 0xE6, 0x88, 0xFF, 0xA6, 0x70, 0xFF, 0x65, 0x58, 0xFF, 0x23, 0x50, 0xFF, 0x23, 0x58, 0xFF, 0x44, 0x78, 0xFF, 0x45, 0x78, 0xFF, 0x49, 0xA1, 0xFF, 0x45, 0x80, 0xFF, 0x03, 0x68, 0xFF, 0xA8, 0xA0, 0xFF, 0x23, 0x78, 0xFF, 0x26, 0x90, 0xFF, 0x03, 0x70, 0xFF, 0xE9, 0xA8, 0xFF, 0x03, 0x78, 0xFF, 0x03, 0x98, 0xFF, 0x24, 0x90, 0xFF, 0xA8, 0xC8, 0xFF, 0x03, 0x98, 0xFF, 0x24, 0x98, 0xFF, 0x24, 0xB0, 0xFF, 0xA8, 0xD0, 0xFF, 0x66, 0xD8, 0xFF, 0x24, 0xB8, 0xFF, 0x66, 0xD8, 0xFF, 0x66, 0xD0, 0xFF, 0x45, 0xE0, 0xFF, 0x24, 0xE0, 0xFF, 0x04, 0xE8, 0xFF, 0x26, 0xE8, 0xFF, 0x05, 0xE8, 0xFF, 0x05, 0xF0, 0xFF, 0x05, 0xF8, 0xFF, 0x26, 0xF0, 0xFF, 0x26, 0xF8, 0xFF, 0x47, 0xF8, 0xFF, 0x0B, 0xFA, 0xFF, 0xEC, 0xF9, 0xFF, 0x07, 0xF8, 0xFF, 0x67, 0xE0, 0xFF, 0xC8, 0xF8, 0xFF, 0x68, 0xF9, 0xFF, 0xA9, 0xF9, 0xFF, 0xA8, 0xF8, 0xFF, 0x28, 0xF9, 0xFF, 0xA9, 0xF9, 0xFF, 0xEA, 0xF9, 0xFF, 0xE8, 0xF1, 0xFF, 0xCC, 0xFA, 0xFF,
-    0x69, 0xF1, 0xFF, 0xCA, 0xF9, 0xFF, 0xC8, 0xF1, 0xFF, 0xC9, 0xF1, 0xFF, 0x89, 0xF9, 0xFF, 0x4B, 0xFA, 0xFF, 0xE9, 0xF1, 0xFF, 0xAA, 0xF9, 0xFF, 0x0D, 0xFB, 0xFF, 0x8B, 0xF9, 0xFF, 0x49, 0xE9, 0xFF, 0x2C, 0xFA, 0xFF, 0x8B, 0xF9, 0xFF, 0x4B, 0xF9, 0xFF, 0x4B, 0xF9, 0xFF, 0x0B, 0xF9, 0xFF, 0x22, 0x30, 0xFF, 0x48, 0x69, 0xFF, 0xC7, 0x58, 0xFF, 0xC9, 0x89, 0xFF, 0x22, 0x38, 0xFF, 0x42, 0x38, 0xFF, 0x29, 0x71, 0xFF, 0xA6, 0x68, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x22, 0x40, 0xFF, 0x2B, 0x81, 0xFF, 0x03, 0x48, 0xFF, 0x06, 0x71, 0xFF, 0xE6, 0x90, 0xFF, 0xE8, 0x80, 0xFF, 0x0C, 0x91, 0xFF, 0x02, 0x48, 0xFF, 0x85, 0x68, 0xFF, 0xA7, 0x90, 0xFF, 0x03, 0x60, 0xFF, 0x2D, 0xA9, 0xFF, 0x44, 0x78, 0xFF, 0x23, 0x68, 0xFF, 0x04, 0x88, 0xFF, 0x65, 0x90, 0xFF, 0x4F, 0xC1, 0xFF, 0x03, 0x70, 0xFF, 0x24, 0x88, 0xFF, 0x86, 0xA0, 0xFF, 0x03, 0x90, 0xFF, 0xB0, 0xE9, 0xFF, 0x66, 0xC0, 0xFF, 0x03, 0x98, 0xFF, 0x44, 0x98, 0xFF, 0x04, 0xA8, 0xFF, 0xAA, 0xE8, 0xFF, 0x45, 0xD0, 0xFF, 0x44, 0xB8, 0xFF, 0x25, 0xD0, 0xFF, 0xCC, 0xF0, 0xFF, 0x25, 0xE8, 0xFF, 0x04, 0xD8, 0xFF, 0x04, 0xE0, 0xFF, 0xC9, 0xF8, 0xFF, 0x91, 0xF9, 0xFF, 0x05, 0xF0, 0xFF, 0x88, 0xF8, 0xFF,
-    0xCA, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x30, 0xFA, 0xFF, 0x6C, 0xFA, 0xFF, 0xC9, 0xE8, 0xFF, 0x07, 0xF8, 0xFF, 0x08, 0xE9, 0xFF, 0xF2, 0xFC, 0xFF, 0xCA, 0xF9, 0xFF, 0x49, 0xF9, 0xFF, 0x09, 0xF1, 0xFF, 0xEF, 0xFB, 0xFF, 0x88, 0xF9, 0xFF, 0x8B, 0xFA, 0xFF, 0x88, 0xE9, 0xFF, 0xAA, 0xF9, 0xFF, 0xD0, 0xFC, 0xFF, 0xEB, 0xFA, 0xFF, 0x4A, 0xFA, 0xFF, 0xC9, 0xF9, 0xFF, 0x89, 0xF1, 0xFF, 0x10, 0xFD, 0xFF, 0xE9, 0xF1, 0xFF, 0x0A, 0xFA, 0xFF, 0xA9, 0xF9, 0xFF, 0x6B, 0xFA, 0xFF, 0x56, 0xFF, 0xFF, 0x6C, 0xFA, 0xFF, 0x0B, 0xFA, 0xFF, 0xAC, 0xF9, 0xFF, 0x6C, 0xF9, 0xFF, 0x4B, 0xF9, 0xFF, 0x07, 0x61, 0xFF, 0x63, 0x48, 0xFF, 0x42, 0x38, 0xFF, 0x27, 0x69, 0xFF, 0x93, 0xC3, 0xFF, 0x29, 0x79, 0xFF, 0x22, 0x40, 0xFF, 0x42, 0x40, 0xFF, 0x83, 0x50, 0xFF, 0x07, 0x69, 0xFF, 0xC8, 0x70, 0xFF, 0xC5, 0x60, 0xFF, 0x22, 0x40, 0xFF, 0x64, 0x58, 0xFF, 0x6A, 0xA1, 0xFF, 0x6B, 0x89, 0xFF, 0x23, 0x48, 0xFF, 0x86, 0x60, 0xFF, 0x85, 0x68, 0xFF, 0x85, 0x78, 0xFF, 0x02, 0x58, 0xFF, 0x45, 0x80, 0xFF, 0x64, 0x70, 0xFF, 0x2C, 0xA9, 0xFF, 0x87, 0x88, 0xFF, 0x27, 0x90, 0xFF, 0x24, 0x78, 0xFF, 0x2B, 0xB1, 0xFF, 0x86, 0x90, 0xFF, 0x24, 0x80, 0xFF, 0x03, 0x88, 0xFF, 0x25, 0x98, 0xFF,
-    0x86, 0xC8, 0xFF, 0x03, 0x90, 0xFF, 0x03, 0x98, 0xFF, 0xA7, 0xD0, 0xFF, 0xEA, 0xE8, 0xFF, 0x66, 0xD8, 0xFF, 0x24, 0xB0, 0xFF, 0x46, 0xE0, 0xFF, 0x0B, 0xF9, 0xFF, 0x87, 0xF0, 0xFF, 0x24, 0xD8, 0xFF, 0x05, 0xE8, 0xFF, 0x26, 0xE0, 0xFF, 0x09, 0xF9, 0xFF, 0x05, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x04, 0xF0, 0xFF, 0xAA, 0xF8, 0xFF, 0x46, 0xF8, 0xFF, 0x13, 0xFD, 0xFF, 0x27, 0xF0, 0xFF, 0x2D, 0xF9, 0xFF, 0x0D, 0xFB, 0xFF, 0x8D, 0xFC, 0xFF, 0xF1, 0xFE, 0xFF, 0xAB, 0xFA, 0xFF, 0xE7, 0xE1, 0xFF, 0x0A, 0xFA, 0xFF, 0x2C, 0xFC, 0xFF, 0x4E, 0xFD, 0xFF, 0x8A, 0xE3, 0xFF, 0x0A, 0xFA, 0xFF, 0x4A, 0xFA, 0xFF, 0x6B, 0xF4, 0xFF, 0x51, 0xFE, 0xFF, 0xA9, 0xF2, 0xFF, 0x2A, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xCE, 0xFD, 0xFF, 0x4E, 0xFD, 0xFF, 0xEA, 0xF2, 0xFF, 0x0B, 0xFA, 0xFF, 0x14, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC, 0xF9, 0xFF, 0x6B, 0xF9, 0xFF, 0x22, 0x30, 0xFF, 0x22, 0x38, 0xFF, 0x22, 0x30, 0xFF, 0xE5, 0x58, 0xFF, 0x02, 0x38, 0xFF, 0x02, 0x38, 0xFF, 0x63, 0x48, 0xFF, 0x22, 0x38, 0xFF, 0xE5, 0x70, 0xFF, 0x67, 0x79, 0xFF, 0x2A, 0x81, 0xFF, 0x23, 0x48, 0xFF, 0x01, 0x40, 0xFF, 0x23, 0x50, 0xFF, 0x06, 0x99, 0xFF, 0xAE, 0x99, 0xFF,
-    0x23, 0x48, 0xFF, 0x23, 0x50, 0xFF, 0x22, 0x48, 0xFF, 0x02, 0x58, 0xFF, 0x4F, 0xC1, 0xFF, 0x65, 0x78, 0xFF, 0x85, 0x80, 0xFF, 0x23, 0x68, 0xFF, 0x24, 0x80, 0xFF, 0x25, 0x88, 0xFF, 0x23, 0x78, 0xFF, 0x44, 0x78, 0xFF, 0x03, 0x80, 0xFF, 0x24, 0x80, 0xFF, 0x86, 0xA0, 0xFF, 0x23, 0x90, 0xFF, 0xEC, 0xF9, 0xFF, 0x24, 0xA0, 0xFF, 0x03, 0x98, 0xFF, 0x24, 0xB8, 0xFF, 0x67, 0xC8, 0xFF, 0x24, 0xC0, 0xFF, 0x44, 0xB8, 0xFF, 0x66, 0xD8, 0xFF, 0xC9, 0xF0, 0xFF, 0x05, 0xF0, 0xFF, 0x24, 0xD8, 0xFF, 0x86, 0xF8, 0xFF, 0x26, 0xF0, 0xFF, 0x04, 0xF0, 0xFF, 0x05, 0xE8, 0xFF, 0x26, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x26, 0xF8, 0xFF, 0x26, 0xF8, 0xFF, 0xF0, 0xFB, 0xFF, 0xA9, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0xCA, 0xF9, 0xFF, 0xF1, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFB, 0xFF, 0xED, 0xF3, 0xFF, 0x0A, 0xFA, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0xFC, 0xFF, 0x4A, 0xFA, 0xFF, 0x89, 0xFA, 0xFF, 0x2F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0xFC, 0xFF, 0x4A, 0xFA, 0xFF, 0xCA, 0xF2, 0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0xFC, 0xFF, 0x6B, 0xFA, 0xFF, 0x0B, 0xFB, 0xFF, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0xFB, 0xFF, 0xEC, 0xF9, 0xFF, 0x4B, 0xF9, 0xFF,
-    0x43, 0x38, 0xFF, 0x23, 0x40, 0xFF, 0x22, 0x38, 0xFF, 0xA5, 0x58, 0xFF, 0x22, 0x40, 0xFF, 0x22, 0x38, 0xFF, 0x02, 0x40, 0xFF, 0x22, 0x38, 0xFF, 0x25, 0x58, 0xFF, 0x68, 0x81, 0xFF, 0x84, 0x50, 0xFF, 0x84, 0x50, 0xFF, 0x23, 0x48, 0xFF, 0x09, 0x89, 0xFF, 0x27, 0x91, 0xFF, 0x02, 0x40, 0xFF, 0x03, 0x48, 0xFF, 0x2A, 0x91, 0xFF, 0x23, 0x50, 0xFF, 0x23, 0x60, 0xFF, 0x02, 0x60, 0xFF, 0x23, 0x70, 0xFF, 0x0D, 0xA9, 0xFF, 0x23, 0x68, 0xFF, 0x23, 0x78, 0xFF, 0x23, 0x70, 0xFF, 0x02, 0x68, 0xFF, 0x03, 0x78, 0xFF, 0x03, 0x88, 0xFF, 0x23, 0x80, 0xFF, 0x03, 0x88, 0xFF, 0x4E, 0xD9, 0xFF, 0xA6, 0xC8, 0xFF, 0x03, 0x98, 0xFF, 0x24, 0x98, 0xFF, 0x03, 0xA8, 0xFF, 0x04, 0xB0, 0xFF, 0x24, 0xB8, 0xFF, 0x24, 0xB8, 0xFF, 0x66, 0xD8, 0xFF, 0x4D, 0xF9, 0xFF, 0x66, 0xE8, 0xFF, 0x24, 0xD8, 0xFF, 0x45, 0xF0, 0xFF, 0x05, 0xF0, 0xFF, 0x90, 0xF9, 0xFF, 0x25, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x05, 0xF0, 0xFF, 0x2C, 0xF9, 0xFF, 0x06, 0xF8, 0xFF, 0xCB, 0xF9, 0xFF, 0x06, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0xAF, 0xFA, 0xFF, 0x4A, 0xFA, 0xFF, 0x4A, 0xFB, 0xFF, 0xC9, 0xF9, 0xFF, 0xCD, 0xFA, 0xFF, 0x49, 0xF9, 0xFF, 0x4B, 0xFB, 0xFF, 0xCF, 0xFD, 0xFF, 0xAA, 0xFA, 0xFF, 0xEE, 0xFB, 0xFF,
-    0xE9, 0xF9, 0xFF, 0xED, 0xFB, 0xFF, 0xCD, 0xFC, 0xFF, 0x0E, 0xFC, 0xFF, 0x89, 0xF9, 0xFF, 0x4F, 0xFC, 0xFF, 0x8C, 0xFB, 0xFF, 0xEC, 0xFB, 0xFF, 0x0D, 0xFC, 0xFF, 0x8A, 0xF9, 0xFF, 0xAB, 0xF9, 0xFF, 0x8B, 0xFA, 0xFF, 0x2D, 0xFB, 0xFF, 0x0B, 0xFA, 0xFF, 0x4B, 0xF9, 0xFF, 0x0B, 0xF9, 0xFF, 0x01, 0x38, 0xFF, 0x43, 0x48, 0xFF, 0x22, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0xC5, 0x60, 0xFF, 0x42, 0x40, 0xFF, 0x22, 0x38, 0xFF, 0xF6, 0xB3, 0xFF, 0x63, 0x50, 0xFF, 0x84, 0x60, 0xFF, 0x23, 0x40, 0xFF, 0x45, 0x60, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x84, 0x70, 0xFF, 0xA7, 0x78, 0xFF, 0x02, 0x48, 0xFF, 0x23, 0x50, 0xFF, 0x23, 0x50, 0xFF, 0x85, 0x78, 0xFF, 0x03, 0x58, 0xFF, 0xC7, 0x80, 0xFF, 0x45, 0x80, 0xFF, 0x02, 0x60, 0xFF, 0x24, 0x90, 0xFF, 0x03, 0x70, 0xFF, 0x0B, 0xA9, 0xFF, 0x02, 0x70, 0xFF, 0x86, 0x98, 0xFF, 0x03, 0x80, 0xFF, 0x03, 0x88, 0xFF, 0xEA, 0xC0, 0xFF, 0xAC, 0xF1, 0xFF, 0x03, 0x98, 0xFF, 0x03, 0x90, 0xFF, 0x24, 0xB0, 0xFF, 0xA9, 0xE0, 0xFF, 0x04, 0xC8, 0xFF, 0x65, 0xC0, 0xFF, 0x04, 0xD0, 0xFF, 0xC9, 0xF8, 0xFF, 0x46, 0xE0, 0xFF, 0x04, 0xD8, 0xFF, 0x05, 0xE8, 0xFF, 0x69, 0xF0, 0xFF, 0xD2, 0xF9, 0xFF, 0x05, 0xF8, 0xFF, 0x25, 0xF8, 0xFF,
-    0xAA, 0xF8, 0xFF, 0x25, 0xF8, 0xFF, 0x48, 0xF0, 0xFF, 0x4A, 0xF9, 0xFF, 0x69, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x89, 0xF8, 0xFF, 0x68, 0xF8, 0xFF, 0x09, 0xF9, 0xFF, 0x09, 0xF9, 0xFF, 0xAB, 0xF9, 0xFF, 0x48, 0xE1, 0xFF, 0xCA, 0xF9, 0xFF, 0x09, 0xFA, 0xFF, 0xE9, 0xF9, 0xFF, 0x69, 0xF9, 0xFF, 0x4A, 0xF2, 0xFF, 0x2B, 0xFB, 0xFF, 0xEA, 0xF9, 0xFF, 0x8A, 0xF9, 0xFF, 0xCA, 0xF9, 0xFF, 0xB0, 0xFD, 0xFF, 0x6E, 0xFB, 0xFF, 0xAA, 0xF9, 0xFF, 0x4D, 0xFB, 0xFF, 0xC9, 0xF1, 0xFF, 0x8A, 0xF9, 0xFF, 0x6A, 0xF9, 0xFF, 0x6B, 0xF9, 0xFF, 0x2A, 0xF9, 0xFF, 0x2B, 0xF9, 0xFF, 0xEA, 0xF0, 0xFF, 0x02, 0x40, 0xFF, 0xC7, 0x60, 0xFF, 0x22, 0x38, 0xFF, 0x02, 0x40, 0xFF, 0xC6, 0x70, 0xFF, 0xC5, 0x50, 0xFF, 0x03, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x43, 0x58, 0xFF, 0x84, 0x50, 0xFF, 0x4A, 0x81, 0xFF, 0x02, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0xE6, 0x80, 0xFF, 0x01, 0x40, 0xFF, 0x2B, 0x99, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x50, 0xFF, 0x22, 0x58, 0xFF, 0x8D, 0xA9, 0xFF, 0x02, 0x60, 0xFF, 0xE9, 0xA0, 0xFF, 0x02, 0x70, 0xFF, 0x02, 0x68, 0xFF, 0xEF, 0xD1, 0xFF, 0x03, 0x80, 0xFF, 0x03, 0x80, 0xFF, 0x03, 0x80, 0xFF, 0x03, 0x88, 0xFF, 0x04, 0x88, 0xFF,
-    0xA6, 0xC0, 0xFF, 0x43, 0x98, 0xFF, 0x23, 0x98, 0xFF, 0x03, 0xA8, 0xFF, 0x46, 0xC8, 0xFF, 0x03, 0xB8, 0xFF, 0x04, 0xC0, 0xFF, 0x25, 0xD0, 0xFF, 0xA9, 0xF0, 0xFF, 0x04, 0xE0, 0xFF, 0x04, 0xD8, 0xFF, 0x66, 0xF0, 0xFF, 0x04, 0xE8, 0xFF, 0x90, 0xF9, 0xFF, 0x04, 0xF8, 0xFF, 0x25, 0xF8, 0xFF, 0x66, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0xF0, 0xF9, 0xFF, 0xA7, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x2A, 0xF8, 0xFF, 0x68, 0xF8, 0xFF, 0xCD, 0xFA, 0xFF, 0x29, 0xF9, 0xFF, 0xAB, 0xF9, 0xFF, 0xEA, 0xF9, 0xFF, 0x29, 0xF9, 0xFF, 0xA8, 0xF9, 0xFF, 0x09, 0xFA, 0xFF, 0x88, 0xF9, 0xFF, 0x49, 0xF9, 0xFF, 0xB0, 0xFD, 0xFF, 0xEB, 0xF3, 0xFF, 0xE9, 0xF9, 0xFF, 0x89, 0xF9, 0xFF, 0x8A, 0xF9, 0xFF, 0x2F, 0xFD, 0xFF, 0xCB, 0xFA, 0xFF, 0xAA, 0xF9, 0xFF, 0x2B, 0xFA, 0xFF, 0x09, 0xF9, 0xFF, 0xE9, 0xF1, 0xFF, 0x4B, 0xFA, 0xFF, 0xAA, 0xF1, 0xFF, 0xEA, 0xF8, 0xFF, 0xCA, 0xF8, 0xFF, 0xA9, 0xF0, 0xFF, 0x86, 0x68, 0xFF, 0x01, 0x38, 0xFF, 0x02, 0x38, 0xFF, 0x02, 0x40, 0xFF, 0x22, 0x40, 0xFF, 0x4A, 0x81, 0xFF, 0x01, 0x30, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x85, 0x58, 0xFF, 0xA8, 0x70, 0xFF, 0x22, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x02, 0x48, 0xFF, 0x65, 0x70, 0xFF, 0x6C, 0xA1, 0xFF,
-    0x02, 0x48, 0xFF, 0x23, 0x48, 0xFF, 0x02, 0x48, 0xFF, 0x23, 0x50, 0xFF, 0x24, 0x60, 0xFF, 0x01, 0x50, 0xFF, 0x02, 0x68, 0xFF, 0x86, 0x88, 0xFF, 0x23, 0x68, 0xFF, 0x6B, 0xA9, 0xFF, 0x02, 0x68, 0xFF, 0x25, 0x88, 0xFF, 0x03, 0x78, 0xFF, 0x23, 0x80, 0xFF, 0x2A, 0xB1, 0xFF, 0x03, 0x80, 0xFF, 0xE7, 0xC8, 0xFF, 0x23, 0x98, 0xFF, 0x23, 0xA0, 0xFF, 0x67, 0xC8, 0xFF, 0x05, 0xB0, 0xFF, 0x23, 0xB0, 0xFF, 0x03, 0xB0, 0xFF, 0x04, 0xC8, 0xFF, 0x48, 0xF0, 0xFF, 0x25, 0xE0, 0xFF, 0x04, 0xD0, 0xFF, 0x45, 0xE8, 0xFF, 0x04, 0xE8, 0xFF, 0x06, 0xF0, 0xFF, 0x04, 0xF8, 0xFF, 0x25, 0xF8, 0xFF, 0x87, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x26, 0xE8, 0xFF, 0x06, 0xF8, 0xFF, 0x69, 0xF8, 0xFF, 0x08, 0xF0, 0xFF, 0x6F, 0xF5, 0xFF, 0x92, 0xFE, 0xFF, 0x0A, 0xFA, 0xFF, 0xA9, 0xF9, 0xFF, 0xAA, 0xF9, 0xFF, 0xAE, 0xFD, 0xFF, 0x6F, 0xFE, 0xFF, 0x6A, 0xFA, 0xFF, 0x89, 0xF9, 0xFF, 0x8A, 0xEB, 0xFF, 0x93, 0xFF, 0xFF, 0xF2, 0xFE, 0xFF, 0x29, 0xFA, 0xFF, 0xEA, 0xF9, 0xFF, 0x71, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xCD, 0xFC, 0xFF, 0x2C, 0xFB, 0xFF, 0x6A, 0xF9, 0xFF, 0x4A, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xFE, 0xFF, 0x0B, 0xFA, 0xFF, 0x4B, 0xF9, 0xFF, 0x4A, 0xF9, 0xFF,
-    0x01, 0x28, 0xFF, 0x02, 0x40, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0x44, 0x58, 0xFF, 0x08, 0x71, 0xFF, 0x01, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x23, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0xA6, 0x60, 0xFF, 0x22, 0x40, 0xFF, 0xA5, 0x68, 0xFF, 0xC7, 0x80, 0xFF, 0x22, 0x58, 0xFF, 0x6C, 0xA1, 0xFF, 0x22, 0x48, 0xFF, 0x02, 0x48, 0xFF, 0xE6, 0x70, 0xFF, 0x02, 0x50, 0xFF, 0xCE, 0xC1, 0xFF, 0x03, 0x58, 0xFF, 0xCA, 0x98, 0xFF, 0x64, 0x78, 0xFF, 0x02, 0x68, 0xFF, 0x02, 0x78, 0xFF, 0x02, 0x68, 0xFF, 0xC9, 0xB8, 0xFF, 0x02, 0x70, 0xFF, 0x44, 0x88, 0xFF, 0xC7, 0xA0, 0xFF, 0x8A, 0xB8, 0xFF, 0xA6, 0xD0, 0xFF, 0x02, 0x90, 0xFF, 0x03, 0x90, 0xFF, 0x24, 0xA8, 0xFF, 0x87, 0xD0, 0xFF, 0x03, 0xB0, 0xFF, 0x03, 0xA8, 0xFF, 0x24, 0xD0, 0xFF, 0xAA, 0xF8, 0xFF, 0x04, 0xD8, 0xFF, 0x04, 0xD8, 0xFF, 0x25, 0xE0, 0xFF, 0x04, 0xE8, 0xFF, 0xAA, 0xF8, 0xFF, 0x04, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0xAB, 0xF8, 0xFF, 0x26, 0xF0, 0xFF, 0x47, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x47, 0xF8, 0xFF, 0xCC, 0xF1, 0xFF, 0xF0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xFB, 0xFF, 0x0C, 0xFB, 0xFF,
-    0xAE, 0xFC, 0xFF, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xFB, 0xFF, 0x4B, 0xFA, 0xFF, 0x09, 0xF2, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xFA, 0xFF, 0x0A, 0xF9, 0xFF, 0xEA, 0xF9, 0xFF, 0xF2, 0xFE, 0xFF, 0xD1, 0xFE, 0xFF, 0xEA, 0xF9, 0xFF, 0xCA, 0xF8, 0xFF, 0xAA, 0xF8, 0xFF, 0x22, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x02, 0x38, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x01, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0xA5, 0x68, 0xFF, 0x02, 0x38, 0xFF, 0x02, 0x40, 0xFF, 0x22, 0x48, 0xFF, 0x63, 0x58, 0xFF, 0x22, 0x58, 0xFF, 0x01, 0x40, 0xFF, 0x22, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x43, 0x48, 0xFF, 0x02, 0x50, 0xFF, 0x02, 0x50, 0xFF, 0x22, 0x58, 0xFF, 0x43, 0x70, 0xFF, 0x02, 0x60, 0xFF, 0x23, 0x70, 0xFF, 0x02, 0x70, 0xFF, 0x03, 0x70, 0xFF, 0x02, 0x70, 0xFF, 0x03, 0x78, 0xFF, 0x03, 0x78, 0xFF, 0x03, 0x80, 0xFF, 0x03, 0x88, 0xFF, 0xC7, 0xC8, 0xFF, 0x03, 0xA0, 0xFF, 0x44, 0x98, 0xFF, 0x03, 0xA0, 0xFF, 0x23, 0xA8, 0xFF, 0x03, 0xA8, 0xFF, 0x03, 0xB0, 0xFF, 0x25, 0xC8, 0xFF, 0x03, 0xC0, 0xFF, 0x24, 0xD0, 0xFF, 0x45, 0xD8, 0xFF, 0x25, 0xE0, 0xFF, 0x04, 0xE8, 0xFF, 0x05, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x25, 0xF8, 0xFF,
-    0xC8, 0xF8, 0xFF, 0x05, 0xF0, 0xFF, 0x26, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x27, 0xF0, 0xFF, 0xE9, 0xF8, 0xFF, 0x8A, 0xF9, 0xFF, 0xC9, 0xF8, 0xFF, 0x68, 0xF0, 0xFF, 0x09, 0xF9, 0xFF, 0xA9, 0xF2, 0xFF, 0x0B, 0xFC, 0xFF, 0xC9, 0xF9, 0xFF, 0xC9, 0xF8, 0xFF, 0xAE, 0xFB, 0xFF, 0x69, 0xF2, 0xFF, 0x6A, 0xFA, 0xFF, 0x89, 0xF9, 0xFF, 0xA8, 0xF0, 0xFF, 0xE9, 0xF8, 0xFF, 0x4A, 0xFA, 0xFF, 0x0E, 0xFC, 0xFF, 0xC8, 0xF8, 0xFF, 0x49, 0xF8, 0xFF, 0x2A, 0xF9, 0xFF, 0xCB, 0xF9, 0xFF, 0x4F, 0xFC, 0xFF, 0xCA, 0xF8, 0xFF, 0x4A, 0xF8, 0xFF, 0x2A, 0xF8, 0xFF, 0x42, 0x30, 0xFF, 0x84, 0x58, 0xFF, 0x88, 0x70, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x6E, 0xB2, 0xFF, 0xC8, 0x78, 0xFF, 0x01, 0x30, 0xFF, 0x07, 0x79, 0xFF, 0x22, 0x40, 0xFF, 0x23, 0x48, 0xFF, 0x29, 0x89, 0xFF, 0xC5, 0x60, 0xFF, 0x01, 0x48, 0xFF, 0x02, 0x40, 0xFF, 0x85, 0x60, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x50, 0xFF, 0x02, 0x58, 0xFF, 0xEA, 0xA0, 0xFF, 0x86, 0x98, 0xFF, 0x02, 0x60, 0xFF, 0x85, 0x88, 0xFF, 0xC6, 0x98, 0xFF, 0xCA, 0xB0, 0xFF, 0x23, 0x78, 0xFF, 0x03, 0x78, 0xFF, 0x24, 0x80, 0xFF, 0x65, 0x90, 0xFF, 0xEB, 0xD8, 0xFF,
-    0x24, 0xA8, 0xFF, 0x04, 0xA0, 0xFF, 0x23, 0x90, 0xFF, 0x05, 0xA8, 0xFF, 0x45, 0xC0, 0xFF, 0x03, 0xB0, 0xFF, 0x24, 0xB0, 0xFF, 0x26, 0xC8, 0xFF, 0xEB, 0xF8, 0xFF, 0x02, 0xC0, 0xFF, 0x03, 0xC8, 0xFF, 0x04, 0xD0, 0xFF, 0x04, 0xE8, 0xFF, 0x8B, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x66, 0xF8, 0xFF, 0xA8, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x4C, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x6A, 0xE9, 0xFF, 0x08, 0xF8, 0xFF, 0x68, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x2C, 0xFA, 0xFF, 0x4D, 0xFB, 0xFF, 0x49, 0xF9, 0xFF, 0xE8, 0xF8, 0xFF, 0x68, 0xF0, 0xFF, 0xA9, 0xF8, 0xFF, 0x8F, 0xFC, 0xFF, 0x49, 0xF1, 0xFF, 0x09, 0xF9, 0xFF, 0xA8, 0xF8, 0xFF, 0x0A, 0xFA, 0xFF, 0x88, 0xF8, 0xFF, 0xE9, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0x67, 0xE8, 0xFF, 0xEC, 0xFA, 0xFF, 0x29, 0xF1, 0xFF, 0xC9, 0xF8, 0xFF, 0xEE, 0xFB, 0xFF, 0x49, 0xF8, 0xFF, 0x2A, 0xF8, 0xFF, 0x8A, 0xF8, 0xFF, 0x21, 0x30, 0xFF, 0x63, 0x48, 0xFF, 0x22, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x00, 0x30, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x84, 0x58, 0xFF, 0x43, 0x48, 0xFF, 0x22, 0x48, 0xFF, 0x43, 0x48, 0xFF,
-    0x02, 0x48, 0xFF, 0x43, 0x50, 0xFF, 0x02, 0x48, 0xFF, 0x22, 0x50, 0xFF, 0x23, 0x50, 0xFF, 0x23, 0x58, 0xFF, 0x02, 0x60, 0xFF, 0x23, 0x60, 0xFF, 0x23, 0x68, 0xFF, 0x65, 0x80, 0xFF, 0x03, 0x68, 0xFF, 0x03, 0x70, 0xFF, 0x03, 0x78, 0xFF, 0x04, 0x88, 0xFF, 0x03, 0x88, 0xFF, 0x03, 0x88, 0xFF, 0xC7, 0xB8, 0xFF, 0x64, 0x98, 0xFF, 0x24, 0x98, 0xFF, 0x24, 0xA0, 0xFF, 0x03, 0xA0, 0xFF, 0x24, 0xB0, 0xFF, 0x24, 0xB0, 0xFF, 0x04, 0xB8, 0xFF, 0x04, 0xC0, 0xFF, 0x04, 0xC8, 0xFF, 0x24, 0xC8, 0xFF, 0x25, 0xD0, 0xFF, 0x05, 0xE0, 0xFF, 0x04, 0xE8, 0xFF, 0x04, 0xE8, 0xFF, 0x25, 0xF8, 0xFF, 0x46, 0xF8, 0xFF, 0x25, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x8B, 0xF3, 0xFF, 0xE9, 0xF9, 0xFF, 0xC9, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x46, 0xE0, 0xFF, 0x89, 0xF9, 0xFF, 0xA9, 0xF9, 0xFF, 0x68, 0xF8, 0xFF, 0x07, 0xF0, 0xFF, 0xC7, 0xE1, 0xFF, 0x89, 0xF2, 0xFF, 0x89, 0xF9, 0xFF, 0xA8, 0xF0, 0xFF, 0x49, 0xF8, 0xFF, 0x29, 0xF9, 0xFF, 0xCA, 0xF9, 0xFF, 0x66, 0xF0, 0xFF, 0x08, 0xF8, 0xFF, 0x49, 0xF8, 0xFF, 0xAA, 0xF9, 0xFF, 0x6B, 0xFA, 0xFF, 0x71, 0xFD, 0xFF, 0x09, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x09, 0xF8, 0xFF,
-    0x66, 0x70, 0xFF, 0xC5, 0x50, 0xFF, 0x01, 0x30, 0xFF, 0xA9, 0x89, 0xFF, 0x02, 0x40, 0xFF, 0xC7, 0x70, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0x01, 0x38, 0xFF, 0x4A, 0x91, 0xFF, 0x02, 0x48, 0xFF, 0x23, 0x68, 0xFF, 0x22, 0x48, 0xFF, 0x22, 0x48, 0xFF, 0xE9, 0x98, 0xFF, 0xA5, 0x60, 0xFF, 0x02, 0x40, 0xFF, 0x23, 0x48, 0xFF, 0x02, 0x58, 0xFF, 0x65, 0x60, 0xFF, 0xE7, 0x90, 0xFF, 0x02, 0x60, 0xFF, 0x03, 0x60, 0xFF, 0x03, 0x70, 0xFF, 0x44, 0x88, 0xFF, 0xE8, 0xA0, 0xFF, 0x03, 0x78, 0xFF, 0x44, 0x80, 0xFF, 0x45, 0x88, 0xFF, 0x88, 0xA0, 0xFF, 0x03, 0x90, 0xFF, 0xE7, 0xB0, 0xFF, 0x24, 0x90, 0xFF, 0x44, 0x98, 0xFF, 0x86, 0xB8, 0xFF, 0x87, 0xC0, 0xFF, 0x44, 0xA8, 0xFF, 0x45, 0xB0, 0xFF, 0x65, 0xC0, 0xFF, 0xE8, 0xE8, 0xFF, 0xA7, 0xD8, 0xFF, 0x05, 0xC8, 0xFF, 0x04, 0xD0, 0xFF, 0x04, 0xD8, 0xFF, 0x49, 0xF8, 0xFF, 0x04, 0xE8, 0xFF, 0x04, 0xE8, 0xFF, 0x46, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x2F, 0xFA, 0xFF, 0x05, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x4B, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0xA8, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x09, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0xFE, 0xFF, 0x69, 0xF9, 0xFF, 0x69, 0xF8, 0xFF,
-    0x87, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0xF5, 0xFF, 0x2C, 0xFB, 0xFF, 0x2B, 0xFA, 0xFF, 0x6F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xF5, 0xFF, 0x08, 0xF1, 0xFF, 0x48, 0xF8, 0xFF, 0x6C, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xAB, 0xF9, 0xFF, 0x29, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x01, 0x38, 0xFF, 0x43, 0x40, 0xFF, 0x22, 0x30, 0xFF, 0x01, 0x30, 0xFF, 0x01, 0x38, 0xFF, 0x22, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0x86, 0x60, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x50, 0xFF, 0x02, 0x48, 0xFF, 0x23, 0x50, 0xFF, 0x43, 0x48, 0xFF, 0x22, 0x48, 0xFF, 0x22, 0x48, 0xFF, 0x23, 0x50, 0xFF, 0x03, 0x60, 0xFF, 0x23, 0x58, 0xFF, 0x03, 0x58, 0xFF, 0x23, 0x60, 0xFF, 0x03, 0x70, 0xFF, 0x85, 0x88, 0xFF, 0x03, 0x68, 0xFF, 0x24, 0x80, 0xFF, 0x24, 0x78, 0xFF, 0x24, 0x80, 0xFF, 0x03, 0x80, 0xFF, 0x24, 0x88, 0xFF, 0x85, 0xA0, 0xFF, 0x24, 0x88, 0xFF, 0x44, 0x98, 0xFF, 0x03, 0x90, 0xFF, 0x44, 0xA0, 0xFF, 0x03, 0xA8, 0xFF, 0x45, 0xB0, 0xFF, 0x04, 0xB0, 0xFF, 0x24, 0xB8, 0xFF, 0x04, 0xC0, 0xFF, 0x04, 0xC0, 0xFF, 0x05, 0xC8, 0xFF, 0x02, 0xC8, 0xFF, 0x04, 0xD8, 0xFF, 0x04, 0xE8, 0xFF, 0x05, 0xF0, 0xFF,
-    0x04, 0xF8, 0xFF, 0x87, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x27, 0xF8, 0xFF, 0xCA, 0xF8, 0xFF, 0xCF, 0xFD, 0xFF, 0x8F, 0xFD, 0xFF, 0x88, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0xAB, 0xFA, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xF9, 0xFF, 0x08, 0xF8, 0xFF, 0xC8, 0xF0, 0xFF, 0xB1, 0xFE, 0xFF, 0x4E, 0xF5, 0xFF, 0xCB, 0xF9, 0xFF, 0x29, 0xF8, 0xFF, 0x4A, 0xF9, 0xFF, 0xFB, 0xFF, 0xFF, 0xAF, 0xFD, 0xFF, 0x48, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0x69, 0xF9, 0xFF, 0x50, 0xFE, 0xFF, 0x2E, 0xFD, 0xFF, 0x8A, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x01, 0x28, 0xFF, 0x63, 0x40, 0xFF, 0x22, 0x30, 0xFF, 0x01, 0x30, 0xFF, 0x02, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x43, 0x48, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x22, 0x58, 0xFF, 0x03, 0x50, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x48, 0xFF, 0x23, 0x48, 0xFF, 0x02, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x23, 0x58, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x58, 0xFF, 0x02, 0x60, 0xFF, 0x02, 0x68, 0xFF, 0x4E, 0xFA, 0xFF, 0x04, 0x78, 0xFF, 0x04, 0x80, 0xFF, 0x04, 0x80, 0xFF, 0x24, 0x78, 0xFF, 0x44, 0x80, 0xFF, 0x45, 0x88, 0xFF,
-    0x0D, 0xF2, 0xFF, 0x04, 0x80, 0xFF, 0x65, 0x90, 0xFF, 0x45, 0x98, 0xFF, 0x65, 0xA0, 0xFF, 0x24, 0xA8, 0xFF, 0x24, 0xA8, 0xFF, 0x66, 0xC0, 0xFF, 0x05, 0xB8, 0xFF, 0x04, 0xC0, 0xFF, 0x05, 0xC8, 0xFF, 0x45, 0xD0, 0xFF, 0x04, 0xD0, 0xFF, 0x24, 0xD8, 0xFF, 0x05, 0xF0, 0xFF, 0x05, 0xF0, 0xFF, 0x05, 0xF8, 0xFF, 0xE8, 0xF8, 0xFF, 0x04, 0xF8, 0xFF, 0x26, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0xC9, 0xF8, 0xFF, 0xEA, 0xF8, 0xFF, 0x69, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x28, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x2B, 0xF9, 0xFF, 0xCC, 0xFA, 0xFF, 0xA9, 0xF9, 0xFF, 0x69, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x88, 0xF8, 0xFF, 0xC8, 0xF8, 0xFF, 0x4C, 0xFA, 0xFF, 0x07, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x4A, 0xF9, 0xFF, 0x2B, 0xFA, 0xFF, 0x09, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x47, 0xF0, 0xFF, 0x08, 0xF0, 0xFF, 0xE9, 0xF8, 0xFF, 0x09, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x21, 0x30, 0xFF, 0x01, 0x30, 0xFF, 0x01, 0x30, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x01, 0x38, 0xFF, 0x02, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0x01, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x40, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x48, 0xFF, 0x02, 0x50, 0xFF, 0x02, 0x50, 0xFF,
-    0x02, 0x48, 0xFF, 0x02, 0x48, 0xFF, 0x23, 0x48, 0xFF, 0x23, 0x50, 0xFF, 0x02, 0x50, 0xFF, 0x02, 0x58, 0xFF, 0x02, 0x60, 0xFF, 0x03, 0x60, 0xFF, 0x23, 0x70, 0xFF, 0x03, 0x70, 0xFF, 0x03, 0x70, 0xFF, 0x23, 0x78, 0xFF, 0x04, 0x80, 0xFF, 0x24, 0x78, 0xFF, 0x03, 0x78, 0xFF, 0x04, 0x80, 0xFF, 0x45, 0x88, 0xFF, 0x86, 0x90, 0xFF, 0x45, 0x90, 0xFF, 0x24, 0x90, 0xFF, 0x45, 0x98, 0xFF, 0x24, 0xA0, 0xFF, 0x24, 0xA8, 0xFF, 0x04, 0xA8, 0xFF, 0x04, 0xB8, 0xFF, 0x04, 0xC0, 0xFF, 0x25, 0xC0, 0xFF, 0x25, 0xC8, 0xFF, 0x45, 0xD8, 0xFF, 0x04, 0xD0, 0xFF, 0x25, 0xE0, 0xFF, 0x25, 0xE8, 0xFF, 0x25, 0xF0, 0xFF, 0x29, 0xF9, 0xFF, 0x25, 0xF8, 0xFF, 0x05, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x47, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x27, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x68, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x08, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x49, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x06, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x06, 0xF0, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xF8, 0xFF, 0x08, 0xF8, 0xFF,
+    0x44, 0x38, 0x24, 0x30, 0x24, 0x38, 0x65, 0x40, 0x44, 0x30, 0x64, 0x28, 0x44, 0x28, 0x24, 0x38, 0x44, 0x30, 0x84, 0x30, 0x64, 0x28, 0x64, 0x28, 0x64, 0x30, 0x64, 0x28, 0x84, 0x30, 0x84, 0x30, 0x84, 0x28, 0x85, 0x30, 0x64, 0x28, 0xC5, 0x38, 0x84, 0x30, 0x64, 0x30, 0xA5, 0x30, 0x84, 0x30, 0xA5, 0x30, 0x64, 0x28, 0x85, 0x30, 0x85, 0x30, 0x85, 0x30, 0x64, 0x30, 0x85, 0x30, 0x84, 0x30,
+    0xA5, 0x30, 0xA5, 0x38, 0xC6, 0x38, 0x64, 0x30, 0x86, 0x38, 0x85, 0x38, 0x64, 0x30, 0x85, 0x30, 0x49, 0x51, 0xCF, 0x71, 0x65, 0x38, 0x85, 0x38, 0x65, 0x30, 0xC6, 0x40, 0x11, 0x82, 0x64, 0x38, 0x44, 0x48, 0x85, 0x50, 0xC6, 0x48, 0x0B, 0x69, 0x44, 0x38, 0x08, 0x89, 0xA6, 0x70, 0x44, 0x40, 0xE9, 0x60, 0x86, 0x48, 0x44, 0x38, 0x85, 0x40, 0x65, 0x38, 0x44, 0x38, 0xC8, 0x60, 0x64, 0x38,
+    0x84, 0x40, 0xA5, 0x48, 0x64, 0x40, 0x0A, 0x71, 0x85, 0x48, 0x03, 0x38, 0x44, 0x38, 0x44, 0x40, 0xC7, 0x68, 0x64, 0x48, 0x64, 0x50, 0x65, 0x48, 0x65, 0x48, 0xC8, 0x70, 0x45, 0x40, 0x66, 0x48, 0x44, 0x30, 0xC6, 0x40, 0x85, 0x38, 0xA5, 0x40, 0x65, 0x40, 0x85, 0x30, 0x08, 0x49, 0x85, 0x30, 0x64, 0x30, 0x64, 0x28, 0x06, 0x41, 0xE9, 0x40, 0x44, 0x28, 0x64, 0x28, 0x85, 0x30, 0xA5, 0x38,
+    0x09, 0x49, 0x84, 0x30, 0xA5, 0x30, 0x06, 0x41, 0x83, 0x28, 0x4B, 0x51, 0x64, 0x30, 0x64, 0x30, 0x85, 0x30, 0x84, 0x30, 0x2A, 0x49, 0x64, 0x28, 0xA5, 0x30, 0x64, 0x28, 0x85, 0x30, 0x4B, 0x49, 0xA5, 0x30, 0xC6, 0x38, 0x85, 0x30, 0x85, 0x38, 0x09, 0x51, 0xA6, 0x38, 0x0B, 0x39, 0x91, 0x6A, 0x85, 0x38, 0x2B, 0x51, 0x85, 0x38, 0x85, 0x38, 0xA5, 0x40, 0xC6, 0x40, 0x8E, 0x69, 0x85, 0x38,
+    0xA5, 0x40, 0x84, 0x38, 0x85, 0x38, 0x2A, 0x61, 0x85, 0x40, 0x24, 0x38, 0x65, 0x40, 0x65, 0x40, 0x85, 0x40, 0x85, 0x40, 0x08, 0x71, 0xA6, 0x60, 0x65, 0x38, 0x64, 0x38, 0x64, 0x38, 0x64, 0x40, 0x84, 0x38, 0x84, 0x38, 0x84, 0x40, 0x44, 0x38, 0x44, 0x40, 0x45, 0x40, 0x44, 0x40, 0x64, 0x48, 0x24, 0x40, 0x65, 0x48, 0x45, 0x40, 0x45, 0x40, 0x65, 0x48, 0x86, 0x48, 0x86, 0x50, 0x86, 0x50,
+    0xA5, 0x40, 0x83, 0x30, 0x0A, 0x51, 0x86, 0x38, 0x44, 0x38, 0x85, 0x40, 0x44, 0x30, 0x63, 0x28, 0x65, 0x28, 0x64, 0x28, 0x85, 0x30, 0xA4, 0x30, 0x85, 0x30, 0xD0, 0x61, 0x64, 0x28, 0xA5, 0x38, 0x64, 0x28, 0x84, 0x28, 0x85, 0x30, 0x87, 0x30, 0x84, 0x30, 0x84, 0x30, 0x85, 0x30, 0x64, 0x30, 0xA5, 0x30, 0x85, 0x28, 0xA5, 0x38, 0xA5, 0x30, 0x84, 0x30, 0xC6, 0x38, 0xA9, 0x30, 0x85, 0x30,
+    0xE6, 0x38, 0xA5, 0x30, 0xA5, 0x38, 0x65, 0x30, 0xA5, 0x38, 0xC6, 0x38, 0xA5, 0x38, 0x85, 0x30, 0x86, 0x38, 0x25, 0x30, 0xA5, 0x38, 0x85, 0x38, 0x85, 0x38, 0x64, 0x30, 0xC7, 0x40, 0xA5, 0x40, 0x65, 0x40, 0xA5, 0x38, 0x85, 0x38, 0xA6, 0x48, 0x64, 0x38, 0x85, 0x58, 0xC6, 0x58, 0x85, 0x40, 0xE6, 0x50, 0x85, 0x40, 0x65, 0x40, 0x85, 0x40, 0x2A, 0x69, 0xC6, 0x50, 0xA5, 0x58, 0xC5, 0x50,
+    0xC5, 0x48, 0x4A, 0x71, 0x85, 0x40, 0x84, 0x40, 0x44, 0x40, 0x64, 0x40, 0xE9, 0x78, 0x64, 0x48, 0x24, 0x48, 0x45, 0x48, 0x86, 0x50, 0xC7, 0x70, 0x65, 0x48, 0x45, 0x40, 0x86, 0x48, 0xA6, 0x50, 0xC6, 0x40, 0xC5, 0x38, 0x63, 0x28, 0x63, 0x30, 0x44, 0x30, 0xC6, 0x48, 0xA5, 0x30, 0x64, 0x28, 0x6B, 0x51, 0x84, 0x30, 0xC6, 0x38, 0xE6, 0x38, 0xC5, 0x38, 0xA6, 0x30, 0x08, 0x41, 0xA5, 0x30,
+    0x43, 0x28, 0xA7, 0x38, 0x44, 0x28, 0x2C, 0x49, 0x84, 0x30, 0x85, 0x30, 0x08, 0x49, 0x43, 0x28, 0x44, 0x28, 0x11, 0x62, 0xE8, 0x40, 0xE6, 0x40, 0x84, 0x30, 0x29, 0x49, 0xD2, 0x59, 0x0B, 0x49, 0x07, 0x41, 0xC6, 0x38, 0xA6, 0x38, 0xA7, 0x38, 0x4C, 0x59, 0xC7, 0x38, 0x85, 0x38, 0x86, 0x30, 0xA5, 0x38, 0xF2, 0x69, 0xA6, 0x40, 0x64, 0x38, 0x85, 0x38, 0x85, 0x38, 0xA9, 0x48, 0xE7, 0x48,
+    0xA5, 0x40, 0x64, 0x38, 0x4B, 0x69, 0x85, 0x40, 0xB0, 0x79, 0xE6, 0x48, 0x64, 0x40, 0x44, 0x40, 0x85, 0x40, 0x66, 0x40, 0x65, 0x40, 0x85, 0x40, 0x85, 0x40, 0x64, 0x38, 0x85, 0x40, 0x4E, 0x81, 0x85, 0x40, 0xA5, 0x48, 0x64, 0x40, 0x44, 0x38, 0x24, 0x40, 0x24, 0x40, 0x43, 0x40, 0x44, 0x48, 0x65, 0x48, 0x45, 0x40, 0x4C, 0x89, 0x45, 0x48, 0x65, 0x48, 0x86, 0x48, 0x86, 0x50, 0xA7, 0x58,
+    0x64, 0x38, 0xC6, 0x40, 0x85, 0x38, 0x84, 0x30, 0x09, 0x49, 0x85, 0x38, 0x84, 0x30, 0xC6, 0x38, 0x64, 0x28, 0x09, 0x49, 0xA5, 0x30, 0xA5, 0x30, 0x23, 0x20, 0xA5, 0x30, 0x64, 0x28, 0x06, 0x41, 0x84, 0x30, 0xA4, 0x30, 0xE7, 0x40, 0xA5, 0x30, 0x30, 0x72, 0x84, 0x30, 0xA5, 0x30, 0xA5, 0x30, 0x64, 0x28, 0x84, 0x30, 0x85, 0x30, 0xC7, 0x38, 0x84, 0x30, 0xA5, 0x38, 0xA5, 0x30, 0xC5, 0x38,
+    0xE7, 0x40, 0x85, 0x30, 0xA6, 0x38, 0x85, 0x30, 0xA5, 0x30, 0xC6, 0x38, 0xA5, 0x38, 0xA6, 0x30, 0x85, 0x38, 0x2D, 0x49, 0x85, 0x38, 0x44, 0x30, 0x65, 0x38, 0xE7, 0x48, 0x86, 0x38, 0x85, 0x38, 0x85, 0x40, 0x65, 0x38, 0x85, 0x40, 0xC5, 0x40, 0x66, 0x40, 0x27, 0x51, 0xC6, 0x48, 0x85, 0x40, 0x65, 0x40, 0x8E, 0x79, 0xC7, 0x58, 0xC7, 0x50, 0x85, 0x40, 0xA6, 0x50, 0xA6, 0x58, 0x4A, 0x71,
+    0xE8, 0x58, 0x84, 0x40, 0xA5, 0x48, 0x85, 0x48, 0x0B, 0x81, 0xC7, 0x58, 0xA6, 0x60, 0x44, 0x48, 0x45, 0x48, 0x0A, 0x79, 0x65, 0x48, 0x45, 0x48, 0x45, 0x48, 0x65, 0x48, 0x86, 0x58, 0x0A, 0x79, 0x64, 0x30, 0xA5, 0x30, 0x44, 0x30, 0x64, 0x28, 0x63, 0x28, 0x64, 0x28, 0x64, 0x28, 0x64, 0x28, 0xA5, 0x30, 0x84, 0x30, 0x64, 0x30, 0xA4, 0x30, 0x64, 0x28, 0x84, 0x30, 0x23, 0x28, 0x45, 0x30,
+    0x84, 0x30, 0x23, 0x28, 0xA5, 0x30, 0x24, 0x28, 0x8C, 0x59, 0xA5, 0x30, 0x64, 0x28, 0x85, 0x30, 0x23, 0x28, 0x08, 0x41, 0x44, 0x28, 0x6A, 0x51, 0xC6, 0x38, 0xC6, 0x38, 0xE8, 0x40, 0x8D, 0x59, 0xC6, 0x40, 0x85, 0x30, 0xA6, 0x38, 0x65, 0x30, 0xAF, 0x69, 0xA6, 0x38, 0x85, 0x30, 0x86, 0x30, 0x45, 0x30, 0xD0, 0x71, 0xE7, 0x48, 0x07, 0x49, 0xA6, 0x40, 0xC8, 0x50, 0xD2, 0x79, 0xE7, 0x48,
+    0xA6, 0x40, 0x09, 0x59, 0x85, 0x40, 0x6F, 0x79, 0xA6, 0x48, 0xC6, 0x48, 0x2B, 0x69, 0x85, 0x40, 0x4C, 0x71, 0x65, 0x40, 0xC7, 0x50, 0xA5, 0x48, 0x65, 0x40, 0x64, 0x40, 0xC7, 0x58, 0x0A, 0x71, 0x85, 0x40, 0x64, 0x40, 0xA4, 0x40, 0x0B, 0x81, 0x44, 0x48, 0x24, 0x48, 0x85, 0x48, 0x64, 0x48, 0x6C, 0x91, 0x45, 0x48, 0x65, 0x48, 0x66, 0x48, 0x86, 0x50, 0x2A, 0x89, 0x65, 0x48, 0xA7, 0x58,
+    0x43, 0x28, 0xC6, 0x38, 0x64, 0x30, 0x65, 0x38, 0x23, 0x30, 0x83, 0x28, 0xC7, 0x40, 0x64, 0x28, 0x85, 0x30, 0x84, 0x30, 0x23, 0x20, 0xE8, 0x40, 0x84, 0x30, 0x84, 0x30, 0x84, 0x30, 0xA6, 0x38, 0x2C, 0x51, 0xA4, 0x30, 0xC5, 0x38, 0x29, 0x49, 0x64, 0x30, 0x6E, 0x51, 0xA5, 0x30, 0x49, 0x51, 0x85, 0x38, 0x64, 0x28, 0x8E, 0x59, 0x85, 0x30, 0x65, 0x30, 0x85, 0x30, 0x65, 0x30, 0x8E, 0x59,
+    0xC6, 0x40, 0xA5, 0x30, 0x85, 0x30, 0xA5, 0x38, 0x0A, 0x59, 0xC7, 0x40, 0xC6, 0x40, 0x85, 0x30, 0x86, 0x38, 0x0B, 0x51, 0xC6, 0x40, 0xC6, 0x40, 0x65, 0x38, 0x08, 0x51, 0x66, 0x40, 0x85, 0x38, 0xA5, 0x40, 0x2B, 0x69, 0x45, 0x38, 0x65, 0x40, 0x85, 0x40, 0xC6, 0x48, 0x64, 0x38, 0xC6, 0x50, 0xF9, 0xC3, 0x64, 0x40, 0xA5, 0x48, 0x85, 0x40, 0xC5, 0x48, 0x65, 0x40, 0x85, 0x40, 0xA5, 0x48,
+    0xA5, 0x48, 0x64, 0x40, 0x64, 0x48, 0x44, 0x40, 0x65, 0x50, 0x44, 0x40, 0x65, 0x48, 0x24, 0x40, 0x85, 0x50, 0x65, 0x48, 0x65, 0x48, 0x86, 0x50, 0x46, 0x50, 0x66, 0x50, 0x86, 0x50, 0xC7, 0x58, 0x24, 0x38, 0x64, 0x30, 0x43, 0x28, 0x08, 0x49, 0xA5, 0x38, 0x84, 0x30, 0x84, 0x30, 0x64, 0x28, 0x84, 0x30, 0x63, 0x28, 0x63, 0x30, 0x84, 0x30, 0xA4, 0x30, 0x63, 0x28, 0x84, 0x30, 0x85, 0x30,
+    0xC6, 0x38, 0xA4, 0x30, 0x64, 0x28, 0x85, 0x30, 0xC7, 0x38, 0xC5, 0x38, 0x65, 0x30, 0xA5, 0x38, 0xE7, 0x40, 0x85, 0x30, 0x85, 0x30, 0x65, 0x30, 0x4B, 0x51, 0x64, 0x30, 0x85, 0x30, 0x65, 0x30, 0xC7, 0x40, 0x85, 0x30, 0x85, 0x30, 0x64, 0x30, 0xE9, 0x48, 0xC7, 0x40, 0xC8, 0x38, 0x66, 0x28, 0x65, 0x38, 0x2B, 0x51, 0xA6, 0x40, 0x65, 0x38, 0xC6, 0x40, 0xC6, 0x40, 0x86, 0x40, 0xA5, 0x40,
+    0x84, 0x38, 0xA6, 0x40, 0x85, 0x40, 0x49, 0x61, 0x65, 0x40, 0xE6, 0x50, 0xE6, 0x50, 0x8C, 0x71, 0xA5, 0x48, 0x84, 0x48, 0xA6, 0x48, 0x48, 0x61, 0xC8, 0x60, 0xA6, 0x50, 0x85, 0x40, 0xA5, 0x48, 0xE7, 0x58, 0xA7, 0x60, 0xA6, 0x50, 0x86, 0x50, 0x65, 0x48, 0x85, 0x50, 0x4B, 0x89, 0x85, 0x48, 0x45, 0x48, 0x86, 0x48, 0x45, 0x48, 0xA8, 0x70, 0xA6, 0x58, 0x66, 0x50, 0x66, 0x50, 0xC8, 0x60,
+    0x44, 0x30, 0x64, 0x28, 0x4C, 0x51, 0x85, 0x30, 0x85, 0x30, 0x64, 0x28, 0xC5, 0x38, 0x43, 0x28, 0x2C, 0x51, 0x64, 0x30, 0x84, 0x30, 0xA4, 0x30, 0x84, 0x30, 0x90, 0x61, 0x43, 0x28, 0x85, 0x30, 0xA5, 0x30, 0xC7, 0x38, 0x85, 0x30, 0x54, 0x62, 0xA5, 0x38, 0x65, 0x30, 0x4B, 0x51, 0x84, 0x30, 0x85, 0x30, 0x87, 0x30, 0x09, 0x49, 0x07, 0x49, 0xA5, 0x30, 0x07, 0x41, 0x5C, 0x73, 0x4E, 0x51,
+    0xC7, 0x40, 0x85, 0x38, 0x85, 0x30, 0x86, 0x38, 0xC9, 0x48, 0xC7, 0x40, 0x65, 0x38, 0x65, 0x30, 0x65, 0x30, 0xA8, 0x40, 0x07, 0x49, 0x85, 0x38, 0xA6, 0x40, 0x6C, 0x61, 0x65, 0x38, 0xA6, 0x40, 0x85, 0x40, 0x65, 0x38, 0x8E, 0x79, 0xA6, 0x48, 0x44, 0x38, 0xC6, 0x50, 0xA5, 0x48, 0x64, 0x40, 0x27, 0x59, 0xA6, 0x48, 0x24, 0x38, 0x65, 0x48, 0xC6, 0x50, 0x86, 0x48, 0x85, 0x40, 0x64, 0x40,
+    0x4B, 0x79, 0x85, 0x48, 0xA6, 0x50, 0x24, 0x40, 0x24, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x48, 0x45, 0x48, 0x66, 0x50, 0x65, 0x50, 0x86, 0x50, 0x45, 0x48, 0x66, 0x50, 0xC7, 0x58, 0xA7, 0x58, 0x64, 0x28, 0x64, 0x28, 0x84, 0x30, 0x84, 0x30, 0xC7, 0x38, 0xC7, 0x38, 0xC5, 0x38, 0x84, 0x30, 0x64, 0x28, 0x86, 0x30, 0xA5, 0x38, 0x63, 0x28, 0xA4, 0x30, 0x64, 0x30, 0xA7, 0x38, 0xC6, 0x38,
+    0xC5, 0x38, 0x85, 0x30, 0xE8, 0x40, 0xE8, 0x38, 0xE8, 0x38, 0xC6, 0x38, 0xA5, 0x30, 0xE8, 0x40, 0x85, 0x30, 0x11, 0x6A, 0x86, 0x30, 0x2B, 0x51, 0x44, 0x28, 0x87, 0x38, 0xD7, 0x5A, 0xAC, 0x51, 0xC7, 0x40, 0xA6, 0x38, 0x85, 0x38, 0x66, 0x30, 0x91, 0x69, 0xC7, 0x40, 0xA6, 0x38, 0x65, 0x30, 0x87, 0x40, 0x96, 0x7A, 0x08, 0x49, 0xC6, 0x40, 0x28, 0x51, 0xE8, 0x50, 0xD1, 0x69, 0x85, 0x38,
+    0xE8, 0x50, 0x64, 0x38, 0x85, 0x40, 0x65, 0x40, 0x33, 0x82, 0x65, 0x40, 0x08, 0x59, 0xA5, 0x40, 0x08, 0x59, 0xB1, 0x81, 0x65, 0x40, 0xC6, 0x50, 0x65, 0x40, 0xC6, 0x50, 0x86, 0x50, 0x6E, 0x89, 0x64, 0x40, 0xC6, 0x50, 0x85, 0x48, 0x85, 0x48, 0x0C, 0x89, 0x25, 0x48, 0x65, 0x48, 0x45, 0x48, 0x65, 0x50, 0x2C, 0x89, 0xC8, 0x68, 0x86, 0x50, 0x66, 0x50, 0x86, 0x50, 0xC8, 0x60, 0x2C, 0x99,
+    0x84, 0x30, 0xA5, 0x30, 0x44, 0x30, 0x64, 0x30, 0x64, 0x28, 0x64, 0x28, 0x84, 0x30, 0xE6, 0x38, 0x84, 0x28, 0xA5, 0x38, 0x4D, 0x51, 0xA5, 0x30, 0x84, 0x30, 0xA5, 0x30, 0xA5, 0x30, 0xAE, 0x61, 0x64, 0x30, 0x64, 0x30, 0x85, 0x30, 0x2A, 0x49, 0xB1, 0x59, 0xC7, 0x38, 0x85, 0x30, 0x28, 0x49, 0x64, 0x28, 0x4C, 0x49, 0x67, 0x30, 0xA6, 0x38, 0x85, 0x30, 0xE7, 0x40, 0xA6, 0x38, 0x0B, 0x41,
+    0xA6, 0x38, 0xA6, 0x38, 0x65, 0x30, 0xA6, 0x38, 0xF3, 0x71, 0x08, 0x49, 0x24, 0x30, 0x65, 0x30, 0xC7, 0x40, 0x15, 0x72, 0x08, 0x51, 0x65, 0x38, 0xC7, 0x48, 0x85, 0x40, 0x34, 0x7A, 0x86, 0x40, 0xA6, 0x40, 0xA6, 0x40, 0x85, 0x40, 0x34, 0x92, 0x85, 0x40, 0xA6, 0x48, 0xC7, 0x50, 0xC7, 0x50, 0xA8, 0x58, 0x85, 0x48, 0x6A, 0x71, 0xC8, 0x58, 0x85, 0x48, 0xC6, 0x50, 0x85, 0x50, 0xA5, 0x50,
+    0xC5, 0x50, 0x64, 0x48, 0xE7, 0x60, 0xC8, 0x70, 0x24, 0x40, 0x66, 0x48, 0x25, 0x48, 0xC9, 0x70, 0x86, 0x50, 0x66, 0x58, 0x88, 0x50, 0x66, 0x50, 0x86, 0x58, 0x66, 0x58, 0x67, 0x60, 0xC8, 0x60, 0x43, 0x28, 0x08, 0x41, 0x64, 0x30, 0x85, 0x30, 0x84, 0x30, 0x84, 0x30, 0x09, 0x41, 0xE7, 0x40, 0x84, 0x30, 0x64, 0x30, 0x84, 0x30, 0x2B, 0x49, 0xA4, 0x30, 0xA4, 0x30, 0x85, 0x30, 0xE6, 0x38,
+    0x6E, 0x59, 0x85, 0x30, 0x85, 0x30, 0xA6, 0x38, 0xC7, 0x38, 0xF1, 0x61, 0x85, 0x30, 0xC6, 0x38, 0x65, 0x30, 0xC6, 0x40, 0x33, 0x6A, 0xC7, 0x40, 0x2A, 0x49, 0xE7, 0x48, 0xA6, 0x38, 0x0B, 0x41, 0xC7, 0x40, 0xA6, 0x38, 0x86, 0x38, 0x66, 0x38, 0x0A, 0x51, 0xE7, 0x48, 0x86, 0x38, 0x86, 0x38, 0x09, 0x51, 0x04, 0x28, 0x49, 0x51, 0x85, 0x38, 0xE7, 0x48, 0xC6, 0x40, 0x25, 0x30, 0xA6, 0x40,
+    0xA6, 0x48, 0xC7, 0x48, 0x86, 0x40, 0x0A, 0x69, 0xA6, 0x48, 0x29, 0x61, 0xA6, 0x48, 0x65, 0x40, 0xB0, 0x91, 0xE8, 0x58, 0x08, 0x61, 0xA6, 0x48, 0x85, 0x48, 0x87, 0x58, 0x85, 0x50, 0xA5, 0x50, 0x85, 0x48, 0xC6, 0x58, 0x2B, 0x81, 0x65, 0x48, 0x45, 0x48, 0x85, 0x50, 0x45, 0x58, 0x4C, 0x89, 0x45, 0x50, 0xA6, 0x58, 0x86, 0x58, 0x65, 0x50, 0x0B, 0x91, 0xA8, 0x68, 0x66, 0x58, 0xE9, 0x68,
+    0x84, 0x30, 0x64, 0x28, 0x84, 0x30, 0x09, 0x41, 0x84, 0x30, 0x44, 0x28, 0x84, 0x30, 0x06, 0x41, 0xE9, 0x40, 0xC6, 0x38, 0x64, 0x30, 0x84, 0x30, 0x64, 0x28, 0x06, 0x41, 0xE6, 0x38, 0xE6, 0x40, 0x64, 0x28, 0xA5, 0x38, 0x85, 0x30, 0xA6, 0x38, 0x49, 0x51, 0xC6, 0x38, 0x85, 0x30, 0xA6, 0x38, 0x85, 0x30, 0xA6, 0x38, 0xE8, 0x40, 0xE7, 0x40, 0x65, 0x30, 0xE7, 0x40, 0xA6, 0x38, 0xB1, 0x59,
+    0xA8, 0x40, 0xC7, 0x40, 0x65, 0x30, 0x08, 0x49, 0x89, 0x48, 0xE8, 0x50, 0x65, 0x38, 0xA6, 0x38, 0xA6, 0x40, 0x8E, 0x61, 0xE8, 0x48, 0x85, 0x38, 0xE7, 0x48, 0xC6, 0x40, 0x86, 0x40, 0xC7, 0x48, 0xC7, 0x50, 0xE7, 0x48, 0x8B, 0x61, 0x8A, 0x69, 0x29, 0x61, 0x85, 0x48, 0x29, 0x61, 0x6F, 0x79, 0xA6, 0x50, 0xA7, 0x50, 0xA6, 0x48, 0xC7, 0x58, 0x6C, 0x81, 0x85, 0x50, 0xC6, 0x50, 0x64, 0x48,
+    0xC7, 0x60, 0x4C, 0x89, 0xC5, 0x50, 0x65, 0x50, 0xA7, 0x60, 0xA6, 0x58, 0x0A, 0x81, 0x65, 0x50, 0x45, 0x50, 0x65, 0x50, 0xC8, 0x68, 0x4B, 0x89, 0x66, 0x58, 0xA7, 0x60, 0x87, 0x58, 0x87, 0x58, 0x85, 0x30, 0x85, 0x30, 0x84, 0x28, 0x84, 0x28, 0xC5, 0x38, 0x84, 0x30, 0xA4, 0x30, 0x47, 0x49, 0x84, 0x30, 0xC6, 0x38, 0xA5, 0x30, 0xC5, 0x38, 0x84, 0x30, 0xE6, 0x40, 0xC7, 0x40, 0x85, 0x30,
+    0xA5, 0x38, 0x86, 0x30, 0x85, 0x30, 0xE6, 0x38, 0x08, 0x41, 0xA6, 0x38, 0x8E, 0x59, 0xE7, 0x40, 0x44, 0x28, 0xE8, 0x40, 0x65, 0x30, 0xE7, 0x40, 0xC7, 0x38, 0xA7, 0x38, 0x8B, 0x59, 0x33, 0x6A, 0xE8, 0x40, 0xA7, 0x40, 0x86, 0x38, 0xCE, 0x69, 0xCA, 0x50, 0xC7, 0x48, 0x65, 0x38, 0xA6, 0x40, 0x47, 0x38, 0xEA, 0x48, 0xC7, 0x40, 0x65, 0x38, 0xE7, 0x48, 0x2E, 0x59, 0xC7, 0x48, 0xC7, 0x48,
+    0x87, 0x48, 0xA6, 0x48, 0xD1, 0x81, 0x44, 0x38, 0xE7, 0x50, 0xC7, 0x50, 0x4C, 0x69, 0x65, 0x48, 0x08, 0x59, 0xA6, 0x48, 0xA6, 0x50, 0x0B, 0x79, 0xC6, 0x50, 0x64, 0x48, 0x64, 0x48, 0xE7, 0x58, 0x6C, 0x89, 0x85, 0x48, 0xC6, 0x50, 0x66, 0x58, 0xC9, 0x68, 0xA6, 0x58, 0xA6, 0x58, 0x45, 0x50, 0xA6, 0x58, 0xA8, 0x70, 0xA7, 0x60, 0xC7, 0x60, 0xA7, 0x60, 0xA7, 0x60, 0xC8, 0x60, 0xC9, 0x68,
+    0x44, 0x28, 0x27, 0x49, 0x44, 0x28, 0x4D, 0x59, 0x85, 0x30, 0xA6, 0x38, 0x64, 0x28, 0x43, 0x28, 0x6F, 0x59, 0xA5, 0x30, 0x84, 0x30, 0xA5, 0x30, 0xA4, 0x30, 0x45, 0x28, 0xF2, 0x61, 0xA6, 0x38, 0xA5, 0x38, 0x85, 0x30, 0x07, 0x41, 0x35, 0x62, 0xE7, 0x40, 0xE6, 0x38, 0xC7, 0x38, 0xCE, 0x61, 0xC6, 0x38, 0x76, 0x62, 0x45, 0x28, 0x4B, 0x51, 0xE7, 0x40, 0xE8, 0x48, 0x7E, 0x6B, 0xA7, 0x38,
+    0xE9, 0x48, 0x86, 0x38, 0x86, 0x38, 0xEA, 0x50, 0xED, 0x48, 0xE8, 0x50, 0x86, 0x38, 0xA7, 0x40, 0x48, 0x38, 0xF9, 0x72, 0xE8, 0x50, 0x86, 0x40, 0x29, 0x59, 0x8E, 0x69, 0x89, 0x40, 0x66, 0x40, 0xA6, 0x40, 0x4E, 0x69, 0xA6, 0x48, 0xE8, 0x50, 0x88, 0x48, 0xA6, 0x48, 0x6B, 0x71, 0xE7, 0x58, 0xA6, 0x50, 0xA7, 0x50, 0x0B, 0x69, 0x85, 0x50, 0xA6, 0x50, 0x85, 0x50, 0x86, 0x50, 0x44, 0x48,
+    0x85, 0x48, 0x85, 0x48, 0xE7, 0x60, 0x0B, 0x81, 0x65, 0x50, 0x66, 0x50, 0xC7, 0x60, 0x25, 0x58, 0x86, 0x58, 0x86, 0x58, 0x45, 0x50, 0xC7, 0x60, 0x87, 0x58, 0xA7, 0x60, 0xC8, 0x68, 0xA8, 0x68, 0xB0, 0x7A, 0xE6, 0x38, 0x64, 0x28, 0xC5, 0x38, 0xC8, 0x40, 0x2D, 0x51, 0xA5, 0x30, 0xC5, 0x38, 0xE6, 0x38, 0x85, 0x30, 0x8F, 0x59, 0x85, 0x30, 0xA6, 0x38, 0x64, 0x28, 0x49, 0x49, 0xB0, 0x59,
+    0x85, 0x38, 0x64, 0x30, 0x85, 0x30, 0x86, 0x38, 0xF4, 0x61, 0xA5, 0x38, 0x85, 0x30, 0xA7, 0x38, 0xA6, 0x30, 0xE8, 0x40, 0xC8, 0x38, 0xC8, 0x38, 0xA7, 0x38, 0xC7, 0x38, 0xE9, 0x38, 0xC9, 0x40, 0xA9, 0x40, 0xE8, 0x48, 0x86, 0x40, 0xC8, 0x48, 0x8F, 0x61, 0xE9, 0x50, 0x66, 0x38, 0x86, 0x40, 0x6D, 0x59, 0x1B, 0x73, 0x31, 0x62, 0x86, 0x38, 0xA7, 0x40, 0x87, 0x40, 0x57, 0x7A, 0xC8, 0x48,
+    0x86, 0x40, 0x0B, 0x61, 0x86, 0x48, 0x26, 0x40, 0xEC, 0x58, 0x2B, 0x61, 0xC7, 0x50, 0x85, 0x48, 0x86, 0x48, 0xD1, 0x91, 0x11, 0x8B, 0xA6, 0x50, 0xA6, 0x50, 0x87, 0x58, 0x6E, 0x89, 0xC7, 0x60, 0x44, 0x48, 0x85, 0x48, 0x85, 0x50, 0x24, 0x50, 0x2D, 0x99, 0x65, 0x50, 0x86, 0x58, 0x45, 0x50, 0xE9, 0x78, 0xEC, 0x90, 0x86, 0x60, 0xA7, 0x60, 0xA8, 0x68, 0xA7, 0x68, 0x2C, 0xA1, 0xA9, 0x78,
+    0x63, 0x28, 0xC6, 0x38, 0x6B, 0x51, 0x84, 0x30, 0x44, 0x28, 0xA5, 0x30, 0x4A, 0x51, 0xE9, 0x40, 0xA5, 0x38, 0xE6, 0x38, 0x85, 0x30, 0xD0, 0x61, 0xA6, 0x38, 0x86, 0x30, 0x69, 0x51, 0x65, 0x30, 0x70, 0x59, 0x45, 0x30, 0xA6, 0x38, 0xA6, 0x30, 0x86, 0x30, 0x34, 0x6A, 0x65, 0x30, 0xC7, 0x38, 0x29, 0x49, 0x86, 0x30, 0x34, 0x6A, 0xC8, 0x40, 0x6B, 0x51, 0x29, 0x49, 0x09, 0x49, 0x0B, 0x31,
+    0x2B, 0x51, 0x09, 0x51, 0xA7, 0x40, 0x08, 0x51, 0xB2, 0x69, 0x2A, 0x59, 0x66, 0x40, 0x66, 0x38, 0x67, 0x48, 0xFF, 0xB4, 0x6A, 0x61, 0x86, 0x38, 0xC8, 0x48, 0x88, 0x40, 0xD8, 0x82, 0xE8, 0x50, 0xC9, 0x50, 0x66, 0x40, 0x86, 0x48, 0x34, 0x92, 0x2B, 0x61, 0x09, 0x61, 0x85, 0x48, 0xC7, 0x58, 0x12, 0x9A, 0x5D, 0x8C, 0x85, 0x48, 0xC6, 0x50, 0xE8, 0x68, 0x4D, 0x89, 0x99, 0x83, 0x45, 0x48,
+    0xA7, 0x60, 0x66, 0x58, 0xAF, 0x91, 0x08, 0x71, 0x25, 0x50, 0x86, 0x58, 0x86, 0x60, 0x2D, 0x99, 0xA8, 0x60, 0xA7, 0x60, 0x46, 0x58, 0x86, 0x60, 0x4D, 0xA1, 0x87, 0x68, 0xA8, 0x68, 0xC9, 0x70, 0x43, 0x28, 0x64, 0x30, 0x84, 0x30, 0xE8, 0x40, 0x08, 0x41, 0x43, 0x28, 0x85, 0x30, 0x64, 0x28, 0xC8, 0x40, 0x65, 0x30, 0xE8, 0x40, 0x85, 0x30, 0x85, 0x30, 0x8D, 0x59, 0xE8, 0x40, 0xA6, 0x30,
+    0x65, 0x30, 0x45, 0x28, 0x85, 0x30, 0xA6, 0x38, 0xA6, 0x30, 0xC7, 0x40, 0xE9, 0x40, 0x86, 0x30, 0xC6, 0x38, 0xE8, 0x40, 0x88, 0x30, 0xA8, 0x38, 0xE8, 0x40, 0x09, 0x49, 0x49, 0x51, 0x7C, 0x74, 0x6C, 0x59, 0xA7, 0x40, 0x87, 0x40, 0xE8, 0x48, 0xAA, 0x48, 0x0A, 0x59, 0x87, 0x48, 0xA7, 0x40, 0xC9, 0x50, 0xCA, 0x48, 0x0A, 0x59, 0xE8, 0x48, 0xC9, 0x50, 0xE8, 0x48, 0x46, 0x38, 0x29, 0x59,
+    0xA7, 0x48, 0xA7, 0x48, 0xD0, 0x79, 0xAB, 0x71, 0x09, 0x59, 0xC7, 0x50, 0x66, 0x50, 0xB0, 0x81, 0xA9, 0x48, 0xC7, 0x58, 0x65, 0x48, 0x29, 0x71, 0x2E, 0x89, 0x86, 0x58, 0x66, 0x50, 0xA8, 0x60, 0x86, 0x58, 0x6E, 0x99, 0xA6, 0x58, 0x87, 0x60, 0x24, 0x50, 0x6C, 0x89, 0x0E, 0xAA, 0x66, 0x58, 0x66, 0x60, 0x86, 0x68, 0x0B, 0x91, 0x66, 0x68, 0xA7, 0x68, 0x46, 0x60, 0xC8, 0x70, 0xA8, 0x70,
+    0x84, 0x30, 0x43, 0x28, 0x63, 0x30, 0x44, 0x30, 0x64, 0x30, 0x09, 0x49, 0x65, 0x28, 0x84, 0x30, 0x85, 0x30, 0xC8, 0x40, 0x86, 0x30, 0x85, 0x30, 0x65, 0x30, 0x07, 0x41, 0xC9, 0x40, 0xA6, 0x38, 0xA5, 0x30, 0xA5, 0x30, 0x6E, 0x51, 0x86, 0x38, 0xA6, 0x38, 0xA7, 0x38, 0xA8, 0x40, 0x6D, 0x51, 0xC7, 0x38, 0xE8, 0x40, 0xE8, 0x40, 0x6F, 0x51, 0xC7, 0x38, 0xC8, 0x40, 0xAB, 0x59, 0xA8, 0x38,
+    0x0A, 0x49, 0xE9, 0x48, 0xA8, 0x40, 0xC9, 0x48, 0x76, 0x82, 0x2A, 0x59, 0x66, 0x40, 0xA7, 0x48, 0xE9, 0x50, 0xA7, 0x40, 0x29, 0x51, 0xA7, 0x40, 0x2A, 0x59, 0xF4, 0x71, 0x86, 0x40, 0x0A, 0x59, 0x09, 0x51, 0xA8, 0x48, 0xC9, 0x58, 0xA6, 0x48, 0x08, 0x59, 0x08, 0x59, 0x50, 0x81, 0x66, 0x50, 0xA7, 0x58, 0x08, 0x61, 0xA7, 0x60, 0x0C, 0x79, 0x45, 0x50, 0x86, 0x58, 0x66, 0x58, 0xEA, 0x70,
+    0xE8, 0x70, 0x65, 0x50, 0xC8, 0x60, 0x45, 0x58, 0x8D, 0x99, 0x66, 0x60, 0x87, 0x60, 0x86, 0x60, 0xE9, 0x80, 0x09, 0x89, 0x86, 0x68, 0x87, 0x68, 0x87, 0x68, 0x87, 0x68, 0xEA, 0x80, 0xA8, 0x78, 0x64, 0x30, 0x64, 0x28, 0xA5, 0x30, 0x86, 0x30, 0x64, 0x28, 0xC6, 0x38, 0xA5, 0x38, 0x29, 0x49, 0x89, 0x38, 0x24, 0x28, 0x29, 0x51, 0xE9, 0x48, 0xE8, 0x40, 0x08, 0x49, 0x66, 0x28, 0x4B, 0x59,
+    0x65, 0x30, 0x45, 0x28, 0xA6, 0x30, 0x0C, 0x51, 0xE8, 0x50, 0xC8, 0x40, 0xA6, 0x30, 0xE9, 0x40, 0x86, 0x30, 0xA8, 0x40, 0x86, 0x30, 0x09, 0x41, 0x0A, 0x49, 0x2A, 0x49, 0x8B, 0x59, 0xC8, 0x38, 0x4D, 0x51, 0xA8, 0x40, 0x87, 0x40, 0xC9, 0x48, 0xB0, 0x69, 0x0A, 0x59, 0x87, 0x48, 0x87, 0x40, 0x0B, 0x51, 0x66, 0x38, 0x2A, 0x51, 0x66, 0x38, 0xA7, 0x40, 0x66, 0x40, 0x87, 0x40, 0x09, 0x59,
+    0xA7, 0x48, 0x0B, 0x61, 0x47, 0x48, 0xA7, 0x48, 0x6A, 0x61, 0x0C, 0x69, 0x86, 0x48, 0x66, 0x50, 0x45, 0x48, 0x0A, 0x71, 0x2B, 0x71, 0x24, 0x48, 0xA7, 0x58, 0x09, 0x69, 0x4B, 0x71, 0x09, 0x71, 0x45, 0x50, 0x85, 0x50, 0xC7, 0x60, 0x87, 0x60, 0x66, 0x60, 0x45, 0x60, 0x66, 0x60, 0xA8, 0x78, 0x66, 0x60, 0xA7, 0x68, 0xA7, 0x68, 0xA7, 0x70, 0x68, 0x70, 0xA8, 0x70, 0xE9, 0x78, 0x67, 0x70,
+    0x4C, 0x49, 0x85, 0x30, 0x44, 0x28, 0xA8, 0x40, 0x84, 0x28, 0x11, 0x6A, 0x64, 0x28, 0xA5, 0x30, 0x86, 0x30, 0x4A, 0x49, 0xB1, 0x51, 0x85, 0x30, 0xA6, 0x38, 0xE8, 0x40, 0x35, 0x62, 0x12, 0x62, 0xC8, 0x38, 0xE8, 0x40, 0x86, 0x38, 0x88, 0x28, 0x71, 0x49, 0x9A, 0x73, 0xE9, 0x40, 0xA7, 0x38, 0x0A, 0x41, 0x7A, 0x4A, 0x0A, 0x41, 0x6C, 0x51, 0x8D, 0x51, 0x37, 0x93, 0xFF, 0x5B, 0xCA, 0x38,
+    0xF0, 0x59, 0xF1, 0x59, 0xCF, 0x51, 0x13, 0x5A, 0x3D, 0x73, 0x2B, 0x59, 0xA8, 0x48, 0x4A, 0x51, 0x6E, 0x59, 0x3F, 0x7C, 0x0A, 0x51, 0xC8, 0x48, 0x2C, 0x59, 0xC9, 0x48, 0x5E, 0x8B, 0x0A, 0x59, 0x2A, 0x69, 0x6B, 0x69, 0xA7, 0x48, 0xED, 0x58, 0x34, 0x92, 0x29, 0x61, 0x65, 0x48, 0x86, 0x50, 0xC9, 0x60, 0x36, 0x9A, 0x29, 0x69, 0x45, 0x50, 0xE8, 0x68, 0xC7, 0x60, 0x35, 0xAA, 0xA7, 0x60,
+    0xC7, 0x70, 0xA7, 0x68, 0x86, 0x58, 0x26, 0x60, 0xB1, 0xC1, 0xC8, 0x78, 0x66, 0x68, 0x66, 0x60, 0x86, 0x68, 0x2E, 0xB9, 0xC8, 0x78, 0xA7, 0x70, 0xA8, 0x70, 0x88, 0x70, 0x0C, 0xA1, 0xA8, 0x78, 0x64, 0x30, 0x86, 0x28, 0x0C, 0x41, 0x64, 0x30, 0x85, 0x30, 0xA5, 0x30, 0xA6, 0x38, 0xAF, 0x59, 0xA5, 0x38, 0xAB, 0x59, 0xEC, 0x61, 0xA9, 0x38, 0x0C, 0x41, 0x28, 0x49, 0xA8, 0x38, 0x66, 0x28,
+    0x55, 0x62, 0x29, 0x49, 0xE8, 0x40, 0x66, 0x30, 0x28, 0x49, 0x71, 0x51, 0x0A, 0x41, 0xC7, 0x38, 0x28, 0x49, 0x2B, 0x41, 0xD9, 0x62, 0x2A, 0x49, 0x0A, 0x49, 0x6D, 0x51, 0xCF, 0x59, 0x3F, 0x84, 0xF7, 0x82, 0xB0, 0x49, 0x79, 0x6B, 0x8F, 0x49, 0xDC, 0x62, 0x6D, 0x61, 0xA8, 0x48, 0xE9, 0x50, 0xF3, 0x61, 0xFC, 0x62, 0x6D, 0x59, 0xB3, 0x8A, 0x72, 0x82, 0x46, 0x38, 0x7C, 0x93, 0xEA, 0x58,
+    0xEE, 0x91, 0x2F, 0xA2, 0x4A, 0x61, 0xF9, 0xB2, 0x2A, 0x69, 0xC8, 0x98, 0x46, 0x68, 0xE9, 0x68, 0x35, 0xA2, 0x09, 0x61, 0x2A, 0x69, 0xA8, 0x68, 0xE8, 0x68, 0x34, 0xAA, 0xC9, 0x70, 0xA8, 0x70, 0x66, 0x50, 0x65, 0x58, 0x8B, 0x88, 0xA8, 0x80, 0x86, 0x68, 0x66, 0x68, 0x65, 0x68, 0xB0, 0xB1, 0x66, 0x68, 0x67, 0x70, 0xA8, 0x80, 0x88, 0x78, 0x2D, 0xB1, 0xA8, 0x78, 0x27, 0x70, 0xA8, 0x80,
+    0x43, 0x28, 0x85, 0x30, 0x85, 0x30, 0x64, 0x30, 0x6C, 0x51, 0xC7, 0x38, 0x85, 0x30, 0xA5, 0x38, 0x2B, 0x49, 0x6B, 0x51, 0x49, 0x51, 0xA6, 0x38, 0xAB, 0x59, 0x8E, 0x51, 0x09, 0x41, 0x65, 0x30, 0xC7, 0x40, 0xA6, 0x30, 0xB0, 0x59, 0xA7, 0x38, 0xC7, 0x38, 0x8C, 0x51, 0x33, 0x62, 0xA8, 0x38, 0xE8, 0x40, 0x70, 0x6A, 0xE8, 0x38, 0x8E, 0x51, 0xA8, 0x38, 0x4C, 0x51, 0x8C, 0x51, 0xFC, 0x5A,
+    0x8E, 0x51, 0x0B, 0x49, 0xA9, 0x40, 0x2B, 0x51, 0xEF, 0x40, 0x4D, 0x59, 0xC8, 0x48, 0xA8, 0x48, 0xEA, 0x50, 0x28, 0x28, 0x2C, 0x51, 0xE9, 0x50, 0xA9, 0x48, 0xF9, 0x82, 0x87, 0x40, 0x6D, 0x69, 0x87, 0x48, 0x4B, 0x61, 0x75, 0x8A, 0xC9, 0x60, 0xE9, 0x60, 0x87, 0x50, 0x68, 0x58, 0x90, 0x89, 0x2C, 0x71, 0xC8, 0x60, 0x4B, 0x71, 0x87, 0x60, 0x4E, 0x91, 0x6B, 0x89, 0xA7, 0x68, 0xAD, 0x79,
+    0x66, 0x60, 0x2B, 0x99, 0xA7, 0x70, 0xC8, 0x78, 0x29, 0x89, 0x2E, 0xA1, 0x67, 0x78, 0x67, 0x78, 0x46, 0x70, 0x2A, 0x91, 0x4D, 0xB1, 0x88, 0x78, 0x67, 0x70, 0x88, 0x78, 0xC9, 0x80, 0xC9, 0x80, 0x64, 0x30, 0x64, 0x30, 0xE7, 0x38, 0x44, 0x28, 0xA6, 0x38, 0x64, 0x28, 0x64, 0x30, 0x4A, 0x51, 0x65, 0x30, 0xC8, 0x38, 0xE8, 0x40, 0xCA, 0x48, 0x29, 0x49, 0x8C, 0x59, 0xA9, 0x38, 0x6D, 0x51,
+    0xA6, 0x38, 0x86, 0x30, 0x65, 0x30, 0x6E, 0x51, 0xC8, 0x38, 0x09, 0x41, 0xEC, 0x61, 0xF1, 0x61, 0xA8, 0x40, 0x8C, 0x51, 0xA8, 0x38, 0xAF, 0x59, 0xAA, 0x38, 0x2B, 0x49, 0x31, 0x62, 0xEA, 0x38, 0xD0, 0x59, 0xCB, 0x38, 0x2D, 0x49, 0x2D, 0x51, 0xD9, 0x72, 0x8E, 0x61, 0xC9, 0x48, 0xC9, 0x48, 0x71, 0x41, 0xAA, 0x40, 0xCE, 0x61, 0x51, 0x7A, 0x27, 0x38, 0x35, 0x82, 0x0B, 0x59, 0xEA, 0x58,
+    0xEA, 0x58, 0xB3, 0x79, 0x4B, 0x69, 0xE8, 0x58, 0xC8, 0x58, 0xB1, 0x81, 0x66, 0x58, 0x87, 0x58, 0x8C, 0x79, 0x87, 0x60, 0x6E, 0x89, 0xA7, 0x60, 0x86, 0x60, 0x86, 0x60, 0xCA, 0x78, 0xC9, 0x78, 0x66, 0x60, 0x45, 0x58, 0x67, 0x68, 0xC8, 0x78, 0x46, 0x68, 0x46, 0x68, 0x66, 0x70, 0x6C, 0xA1, 0x4B, 0x99, 0xA8, 0x78, 0xA8, 0x78, 0xC8, 0x80, 0xC9, 0x80, 0xA9, 0x80, 0x0B, 0x91, 0xCA, 0x90,
+    0x44, 0x30, 0x44, 0x28, 0xE6, 0x38, 0x64, 0x30, 0x8A, 0x51, 0xA6, 0x38, 0x07, 0x41, 0x64, 0x30, 0x66, 0x30, 0xE8, 0x40, 0x87, 0x40, 0xAB, 0x59, 0xA7, 0x38, 0xA8, 0x38, 0x66, 0x30, 0xA5, 0x40, 0x09, 0x49, 0x4B, 0x51, 0xA7, 0x38, 0xE8, 0x40, 0x6C, 0x71, 0x89, 0x38, 0x8C, 0x51, 0xA7, 0x38, 0x2C, 0x49, 0xCB, 0x48, 0xC8, 0x38, 0x8D, 0x59, 0x4D, 0x49, 0xEA, 0x40, 0x6E, 0x51, 0xEC, 0x40,
+    0x8F, 0x51, 0x0E, 0x41, 0xCF, 0x59, 0x90, 0x59, 0x33, 0x72, 0x8E, 0x59, 0xCA, 0x48, 0xC9, 0x40, 0x90, 0x61, 0xCA, 0x48, 0x6D, 0x59, 0xEB, 0x50, 0x8F, 0x69, 0xCA, 0x50, 0x47, 0x40, 0xAA, 0x58, 0x6E, 0x71, 0x88, 0x50, 0x6C, 0x71, 0xC7, 0x58, 0x8E, 0x79, 0x87, 0x58, 0x86, 0x58, 0xE9, 0x68, 0x2C, 0x81, 0x2A, 0x79, 0xC8, 0x60, 0x86, 0x58, 0x6C, 0x91, 0x4B, 0x89, 0xC7, 0x68, 0x66, 0x68,
+    0x0A, 0x81, 0x2A, 0x89, 0x66, 0x68, 0x46, 0x68, 0x0A, 0x91, 0xAA, 0x90, 0x66, 0x70, 0x87, 0x70, 0x66, 0x70, 0x67, 0x78, 0xE9, 0x88, 0xA8, 0x80, 0xA8, 0x80, 0xA9, 0x80, 0xA9, 0x88, 0xEA, 0x90, 0xA5, 0x38, 0x07, 0x41, 0xA7, 0x48, 0x32, 0x7A, 0xE8, 0x40, 0xA6, 0x30, 0x08, 0x41, 0x45, 0x30, 0x16, 0x6A, 0x76, 0x6A, 0x86, 0x30, 0x08, 0x41, 0xA7, 0x38, 0xA9, 0x38, 0x78, 0x6A, 0xC8, 0x40,
+    0xA6, 0x38, 0xA7, 0x38, 0xE8, 0x40, 0xAA, 0x38, 0x98, 0x5A, 0xC9, 0x38, 0xEE, 0x61, 0x87, 0x30, 0xA9, 0x38, 0x1F, 0x6C, 0xA9, 0x38, 0x6C, 0x49, 0xA9, 0x38, 0xEB, 0x40, 0xBE, 0x4C, 0xEB, 0x38, 0xCF, 0x51, 0x6E, 0x51, 0xCB, 0x38, 0xEC, 0x40, 0x6F, 0x51, 0x11, 0x6A, 0xCA, 0x48, 0xAA, 0x40, 0x4D, 0x59, 0x4D, 0x49, 0x2C, 0x51, 0xCA, 0x48, 0xCA, 0x48, 0x68, 0x48, 0x48, 0x40, 0xAA, 0x58,
+    0x67, 0x48, 0x2B, 0x69, 0x4B, 0x69, 0x0B, 0x69, 0x87, 0x50, 0x86, 0x58, 0x46, 0x50, 0x2B, 0x79, 0x2B, 0x79, 0x87, 0x60, 0xA9, 0x70, 0x0A, 0x79, 0xA6, 0x68, 0x86, 0x60, 0x2B, 0x89, 0xA8, 0x70, 0x66, 0x68, 0x86, 0x68, 0xC8, 0x78, 0x67, 0x70, 0x46, 0x70, 0x46, 0x70, 0x87, 0x78, 0x87, 0x78, 0xA8, 0x78, 0x88, 0x80, 0x88, 0x80, 0xA8, 0x80, 0xA9, 0x80, 0x88, 0x80, 0xEA, 0x90, 0x89, 0x88,
+    0x44, 0x28, 0xEC, 0x69, 0x2C, 0x49, 0xA5, 0x38, 0xA8, 0x38, 0xA6, 0x30, 0xEC, 0x59, 0x4F, 0x49, 0xC7, 0x38, 0x87, 0x38, 0xE9, 0x40, 0x86, 0x30, 0x15, 0x5A, 0xC9, 0x40, 0x86, 0x38, 0x2C, 0x41, 0x89, 0x28, 0xB0, 0x51, 0x67, 0x30, 0xE8, 0x40, 0xC8, 0x38, 0x3C, 0x73, 0xEF, 0x51, 0xA7, 0x38, 0x68, 0x30, 0xAF, 0x49, 0x5F, 0x7C, 0x34, 0x5A, 0xCA, 0x38, 0xCA, 0x40, 0xB3, 0x41, 0x5D, 0x2D,
+    0x73, 0x62, 0x2D, 0x41, 0xAB, 0x38, 0x51, 0x41, 0xFF, 0x67, 0x35, 0x72, 0x0C, 0x51, 0xCA, 0x40, 0x4F, 0x51, 0xDF, 0x97, 0x95, 0x62, 0x0B, 0x51, 0x89, 0x40, 0xAB, 0x48, 0x1F, 0x84, 0x0A, 0x59, 0x67, 0x48, 0xC9, 0x58, 0xD0, 0x79, 0x1D, 0x93, 0xC8, 0x58, 0xC8, 0x60, 0xE9, 0x60, 0xAD, 0x89, 0x79, 0xAA, 0xEB, 0x88, 0x66, 0x60, 0xE8, 0x78, 0xC9, 0x78, 0x15, 0xC2, 0x14, 0xCA, 0x0A, 0x79,
+    0xE8, 0x78, 0xC7, 0x70, 0xB1, 0xC1, 0xB3, 0xB9, 0xC8, 0x88, 0x67, 0x78, 0x67, 0x70, 0x4F, 0xC1, 0x69, 0x88, 0xD0, 0xD1, 0x88, 0x80, 0xA8, 0x88, 0x2D, 0xC1, 0x48, 0x88, 0x2E, 0xC9, 0xA9, 0x90, 0xC6, 0x38, 0xA6, 0x38, 0xE8, 0x40, 0xA6, 0x38, 0xA7, 0x38, 0x2B, 0x49, 0x45, 0x28, 0x08, 0x41, 0x65, 0x30, 0xCD, 0x61, 0x0C, 0x49, 0xA6, 0x30, 0x25, 0x28, 0x0B, 0x49, 0x90, 0x51, 0xA7, 0x38,
+    0xA6, 0x30, 0x66, 0x30, 0x70, 0x49, 0x88, 0x30, 0x2A, 0x49, 0xE9, 0x38, 0x51, 0x39, 0x34, 0x62, 0x88, 0x30, 0x0B, 0x41, 0xCB, 0x38, 0x17, 0x4A, 0xEC, 0x40, 0xCA, 0x38, 0x51, 0x41, 0x1E, 0x4B, 0x34, 0x5A, 0x2D, 0x41, 0xEC, 0x38, 0x5C, 0x53, 0x9F, 0x97, 0x76, 0x6A, 0x2D, 0x51, 0xAA, 0x38, 0xD0, 0x38, 0x1D, 0x94, 0x70, 0x51, 0xCA, 0x48, 0x6A, 0x40, 0x5E, 0x73, 0xF7, 0x62, 0x0B, 0x59,
+    0x87, 0x50, 0x6B, 0x50, 0xF4, 0x91, 0x88, 0x58, 0x8C, 0x79, 0x46, 0x58, 0xF4, 0x91, 0x4E, 0x79, 0x26, 0x58, 0xA8, 0x68, 0xC8, 0x70, 0x92, 0xA1, 0x05, 0x60, 0xA6, 0x70, 0x45, 0x68, 0x8F, 0x99, 0xCA, 0x78, 0x87, 0x70, 0xA7, 0x78, 0x05, 0x68, 0x4E, 0xB1, 0x2D, 0xB9, 0x2A, 0x99, 0x88, 0x80, 0x0B, 0xA9, 0x47, 0x80, 0xAF, 0xC9, 0xA9, 0x90, 0x69, 0x88, 0xA9, 0x88, 0xEB, 0xA0, 0x0B, 0xA1,
+    0x64, 0x30, 0xC7, 0x38, 0x45, 0x28, 0x07, 0x41, 0x45, 0x28, 0xA5, 0x38, 0x45, 0x28, 0x85, 0x30, 0x45, 0x28, 0x4B, 0x51, 0xA8, 0x38, 0x66, 0x30, 0x87, 0x38, 0x0A, 0x49, 0xE9, 0x40, 0xE7, 0x40, 0xA8, 0x38, 0x2C, 0x49, 0x4C, 0x49, 0x92, 0x6A, 0x0C, 0x41, 0x4C, 0x49, 0x0D, 0x39, 0x88, 0x38, 0x90, 0x51, 0xD0, 0x59, 0xAF, 0x51, 0x2E, 0x39, 0x92, 0x51, 0x8F, 0x51, 0xAD, 0x30, 0x0F, 0x31,
+    0xF4, 0x49, 0x2E, 0x39, 0x8F, 0x49, 0x39, 0x73, 0x38, 0x52, 0xB9, 0x5A, 0x0E, 0x41, 0x2E, 0x39, 0xF4, 0x59, 0x2D, 0x49, 0xD1, 0x61, 0x0C, 0x51, 0xD3, 0x69, 0xD0, 0x69, 0xF1, 0x69, 0x0C, 0x61, 0xD2, 0x89, 0xA9, 0x58, 0x0A, 0x69, 0xCA, 0x60, 0x70, 0x81, 0xC7, 0x68, 0xC9, 0x68, 0x30, 0x92, 0xAE, 0x99, 0xAD, 0x91, 0xA8, 0x70, 0x87, 0x68, 0x4C, 0x99, 0xAE, 0xA9, 0x46, 0x68, 0x4B, 0x89,
+    0xCA, 0x88, 0x49, 0x80, 0xA9, 0x80, 0x47, 0x78, 0x27, 0x78, 0x0B, 0xA1, 0xC8, 0x90, 0x88, 0x80, 0xA9, 0x88, 0x68, 0x88, 0xA9, 0x90, 0xCA, 0x90, 0x89, 0x90, 0xCA, 0x98, 0x0C, 0xA1, 0xAA, 0x98, 0x64, 0x30, 0x65, 0x30, 0x85, 0x30, 0xAA, 0x51, 0x86, 0x38, 0x65, 0x30, 0xC8, 0x38, 0x85, 0x38, 0x65, 0x30, 0xE9, 0x40, 0x86, 0x38, 0x66, 0x30, 0x24, 0x28, 0x26, 0x28, 0xA7, 0x38, 0x65, 0x30,
+    0xA7, 0x38, 0x4A, 0x51, 0x30, 0x62, 0xF0, 0x59, 0x2B, 0x61, 0x4D, 0x49, 0x0B, 0x39, 0x0A, 0x41, 0x88, 0x30, 0xCA, 0x48, 0x8E, 0x51, 0x4E, 0x41, 0xAB, 0x30, 0x4E, 0x49, 0xEF, 0x38, 0x2E, 0x31, 0x14, 0x4A, 0xD3, 0x49, 0x50, 0x39, 0x37, 0x42, 0x15, 0x4A, 0xFB, 0x52, 0x70, 0x49, 0x50, 0x41, 0xD2, 0x61, 0xD3, 0x59, 0xB3, 0x59, 0xAC, 0x48, 0x8B, 0x40, 0x8E, 0x69, 0xD6, 0x7A, 0x4E, 0x69,
+    0x68, 0x50, 0x89, 0x50, 0xA9, 0x60, 0xAA, 0x60, 0xAD, 0x81, 0x87, 0x68, 0x0C, 0x71, 0xEC, 0x70, 0xE9, 0x70, 0xC8, 0x78, 0x09, 0x81, 0x46, 0x68, 0x86, 0x70, 0x09, 0x91, 0x29, 0x91, 0x4B, 0x91, 0x09, 0x89, 0xC8, 0x88, 0x67, 0x78, 0x87, 0x80, 0x66, 0x80, 0x67, 0x80, 0xA9, 0x90, 0x88, 0x88, 0xA8, 0x90, 0x88, 0x88, 0x0A, 0x99, 0x88, 0x90, 0x89, 0x90, 0xEA, 0xA0, 0xCA, 0xA0, 0xCA, 0xA0,
+    0x43, 0x28, 0x65, 0x30, 0xA5, 0x38, 0x87, 0x38, 0xA6, 0x38, 0x66, 0x30, 0x2A, 0x49, 0x85, 0x30, 0x65, 0x30, 0xEA, 0x40, 0x45, 0x28, 0x66, 0x30, 0x87, 0x30, 0x26, 0x28, 0xE8, 0x38, 0xA6, 0x38, 0x86, 0x30, 0x08, 0x41, 0x72, 0x6A, 0x6C, 0x49, 0x8A, 0x30, 0x95, 0x6A, 0x0C, 0x41, 0x88, 0x38, 0xAA, 0x38, 0x2D, 0x49, 0x76, 0x4A, 0x91, 0x41, 0x30, 0x31, 0x2D, 0x41, 0x30, 0x39, 0x77, 0x52,
+    0xF5, 0x41, 0x57, 0x4A, 0x51, 0x39, 0x37, 0x32, 0x35, 0x42, 0x9E, 0x53, 0xB2, 0x41, 0xEF, 0x28, 0x51, 0x49, 0xB3, 0x59, 0x36, 0x6A, 0xAC, 0x48, 0x0F, 0x49, 0xB1, 0x69, 0x18, 0x8B, 0x4D, 0x69, 0xCA, 0x60, 0x89, 0x58, 0x68, 0x58, 0xD0, 0x71, 0xCA, 0x68, 0xA7, 0x68, 0x0B, 0x71, 0x48, 0x58, 0x88, 0x68, 0x87, 0x70, 0x87, 0x70, 0xA7, 0x78, 0xC7, 0x80, 0x86, 0x78, 0x66, 0x78, 0x4B, 0x91,
+    0x87, 0x78, 0xA7, 0x80, 0xA7, 0x80, 0x09, 0x91, 0x87, 0x88, 0x67, 0x88, 0x47, 0x80, 0xA8, 0x90, 0x6C, 0x99, 0x88, 0x90, 0x47, 0x88, 0x2B, 0xA9, 0x69, 0x90, 0xEA, 0xA0, 0xEB, 0xA8, 0xA9, 0xA0, 0x87, 0x38, 0x66, 0x30, 0x2B, 0x51, 0x86, 0x30, 0x4C, 0x59, 0x0B, 0x41, 0x2F, 0x7A, 0xAF, 0x61, 0x66, 0x38, 0xD1, 0x61, 0xF1, 0x61, 0x27, 0x28, 0x71, 0x51, 0x59, 0x83, 0x0D, 0x49, 0x98, 0x72,
+    0x87, 0x30, 0xF9, 0x62, 0x50, 0x49, 0x0B, 0x41, 0x9F, 0x83, 0x7D, 0x73, 0x13, 0x31, 0xC9, 0x38, 0xAD, 0x38, 0x5F, 0x5B, 0x5D, 0x35, 0x56, 0x32, 0xD7, 0x42, 0x6F, 0x41, 0xBF, 0x5F, 0xFF, 0xAF, 0x1F, 0x87, 0x15, 0x42, 0x78, 0x42, 0x3E, 0x1C, 0xFF, 0xC7, 0x7F, 0x5C, 0x36, 0x4A, 0x17, 0x2A, 0xDF, 0x4C, 0xFF, 0x97, 0x36, 0x62, 0xEE, 0x48, 0xB8, 0x4A, 0x3C, 0x7B, 0xBF, 0xAD, 0x4E, 0x69,
+    0xC9, 0x58, 0x69, 0x58, 0x93, 0x99, 0xFF, 0xB3, 0xA9, 0x68, 0x88, 0x68, 0x8E, 0x89, 0xFE, 0xE5, 0xBA, 0xAA, 0x3D, 0xD3, 0xA8, 0x70, 0x87, 0x70, 0x87, 0x78, 0xB5, 0xFA, 0x56, 0xE2, 0xC9, 0x88, 0xA8, 0x80, 0x87, 0x78, 0x2D, 0xD1, 0xD3, 0xD9, 0x26, 0x80, 0xA8, 0x90, 0x68, 0x90, 0xA8, 0xA0, 0xB1, 0xE9, 0x8F, 0xE1, 0xA8, 0xA0, 0x48, 0x98, 0x89, 0xA8, 0x70, 0xD1, 0x0D, 0xE9, 0xEA, 0xB0,
+    0x85, 0x30, 0xA6, 0x38, 0xE8, 0x38, 0xA6, 0x38, 0xA7, 0x30, 0x89, 0x20, 0xB2, 0x21, 0xA9, 0x30, 0x85, 0x30, 0x74, 0x5A, 0x58, 0x73, 0x88, 0x38, 0xCA, 0x38, 0x1F, 0x7D, 0xEA, 0x48, 0xC8, 0x48, 0x67, 0x38, 0xEB, 0x38, 0x1A, 0x5C, 0x4E, 0x39, 0xED, 0x38, 0xB7, 0x62, 0x0E, 0x31, 0xAB, 0x40, 0x10, 0x41, 0x6F, 0x51, 0x38, 0x53, 0xB3, 0x41, 0xDD, 0x7B, 0xD3, 0x51, 0x73, 0x21, 0x3F, 0x7E,
+    0xBD, 0x43, 0xB9, 0x42, 0x57, 0x42, 0x1E, 0x26, 0xFF, 0xD7, 0xBE, 0x5D, 0xF5, 0x41, 0x18, 0x3A, 0x1F, 0x25, 0x3A, 0x4A, 0x9F, 0x63, 0x2F, 0x51, 0x3F, 0xA7, 0xFC, 0x92, 0xB8, 0x6A, 0x91, 0x89, 0xB8, 0x9A, 0x78, 0xA2, 0xAA, 0x68, 0xDF, 0xC6, 0x30, 0x89, 0xD4, 0xA1, 0x35, 0x8A, 0x5E, 0xB7, 0x6E, 0xB1, 0xED, 0x98, 0x49, 0x78, 0x26, 0x70, 0x2B, 0xB1, 0x0D, 0xB9, 0x2C, 0xC1, 0x4E, 0xA1,
+    0x49, 0x88, 0x2B, 0xB1, 0x6E, 0xA9, 0xCB, 0xB0, 0x07, 0x88, 0x11, 0xDA, 0xEC, 0xB8, 0x0B, 0xB9, 0x8E, 0xD1, 0x2B, 0xB1, 0x49, 0x98, 0xA9, 0xA8, 0x69, 0xA0, 0xCB, 0xB0, 0x89, 0xA8, 0xCA, 0xB8, 0xA5, 0x30, 0xA6, 0x38, 0xA6, 0x30, 0x85, 0x30, 0xA6, 0x30, 0x52, 0x62, 0x87, 0x20, 0xAC, 0x49, 0x85, 0x30, 0x74, 0x5A, 0x74, 0x62, 0x0A, 0x41, 0xC9, 0x30, 0xD0, 0x49, 0xA6, 0x38, 0x86, 0x38,
+    0x86, 0x30, 0x8B, 0x20, 0x4D, 0x41, 0x2D, 0x41, 0x8A, 0x30, 0xAC, 0x28, 0x8A, 0x30, 0xCA, 0x38, 0x98, 0x52, 0xAC, 0x30, 0xEF, 0x30, 0x0F, 0x39, 0x3F, 0x8C, 0x70, 0x41, 0xFE, 0x53, 0x79, 0x3A, 0xDB, 0x3A, 0x98, 0x52, 0xF6, 0x41, 0xBE, 0x33, 0x3F, 0x44, 0x5F, 0x4C, 0xD4, 0x41, 0xD5, 0x39, 0xB5, 0x51, 0xB9, 0x62, 0xFB, 0x6A, 0x0F, 0x51, 0xDC, 0x83, 0x12, 0x7A, 0x72, 0x61, 0xAD, 0x58,
+    0xCA, 0x60, 0xAB, 0x60, 0x88, 0x60, 0xFD, 0x8B, 0xEC, 0x80, 0xC9, 0x80, 0xF4, 0x81, 0x74, 0x92, 0x89, 0x70, 0xE9, 0x88, 0x67, 0x78, 0x67, 0x80, 0xA6, 0x80, 0x25, 0x80, 0xC8, 0x90, 0x2B, 0x91, 0xAA, 0x80, 0x46, 0x80, 0xED, 0xB9, 0x67, 0x90, 0x47, 0x90, 0xF6, 0xC2, 0x88, 0x98, 0xC9, 0xA0, 0xA9, 0xA0, 0x89, 0xA0, 0xEA, 0xB0, 0xA9, 0xA8, 0xEC, 0xB0, 0x89, 0xA8, 0xCA, 0xB0, 0xCA, 0xB0,
+    0x85, 0x30, 0x85, 0x28, 0xA6, 0x30, 0x86, 0x30, 0x87, 0x38, 0x56, 0x8B, 0x86, 0x30, 0x50, 0x62, 0x86, 0x30, 0x74, 0x62, 0x33, 0x5A, 0x2D, 0x41, 0xCB, 0x30, 0xCC, 0x30, 0x66, 0x38, 0x66, 0x30, 0xE8, 0x40, 0x2E, 0x39, 0x89, 0x30, 0x89, 0x28, 0xAC, 0x38, 0xEE, 0x28, 0xCB, 0x38, 0x4D, 0x49, 0x19, 0x5B, 0x0D, 0x61, 0x51, 0x39, 0x2E, 0x39, 0x7F, 0x84, 0xD2, 0x49, 0x5C, 0x53, 0x1D, 0x43,
+    0x79, 0x42, 0xD9, 0x52, 0xF6, 0x39, 0xBC, 0x32, 0xDC, 0x2A, 0x5F, 0x44, 0x58, 0x4A, 0x94, 0x31, 0x16, 0x5A, 0xF6, 0x59, 0x1A, 0x7B, 0x51, 0x51, 0xDF, 0xA4, 0xF2, 0x71, 0x73, 0x59, 0x8B, 0x58, 0x8A, 0x60, 0xD1, 0x79, 0xCA, 0x68, 0xD8, 0x92, 0x0C, 0x79, 0xC8, 0x78, 0xEF, 0x68, 0xB3, 0x89, 0x10, 0x9A, 0xEB, 0x80, 0x69, 0x70, 0x46, 0x78, 0x87, 0x88, 0x66, 0x88, 0xA8, 0x88, 0xA8, 0x88,
+    0xEE, 0xA9, 0x0A, 0x91, 0x2A, 0x99, 0x88, 0x90, 0xA9, 0x90, 0xCB, 0x98, 0xA8, 0x98, 0xEB, 0xA0, 0xA9, 0xA0, 0xCA, 0xA8, 0x88, 0xA0, 0xEA, 0xB0, 0x0B, 0xB1, 0xCA, 0xB0, 0xCA, 0xB8, 0xCA, 0xB8, 0x85, 0x30, 0x65, 0x30, 0x86, 0x30, 0x85, 0x30, 0x66, 0x30, 0xF1, 0x59, 0xA7, 0x38, 0x12, 0x52, 0xA6, 0x38, 0x32, 0x5A, 0x4D, 0x49, 0x8A, 0x28, 0x8C, 0x18, 0xEB, 0x38, 0x86, 0x38, 0x25, 0x28,
+    0xA7, 0x38, 0x57, 0x73, 0x0E, 0x41, 0xEB, 0x48, 0x13, 0x3A, 0xD4, 0x31, 0xAB, 0x30, 0x89, 0x38, 0x9E, 0x8D, 0x0D, 0x39, 0x13, 0x29, 0xD0, 0x28, 0x7C, 0x5C, 0x51, 0x39, 0x1D, 0x7D, 0x1F, 0x64, 0x1E, 0x2D, 0xDF, 0x5B, 0x59, 0x42, 0xFD, 0x2B, 0x5F, 0x2C, 0xDE, 0x44, 0xDC, 0x53, 0x18, 0x3A, 0x39, 0x52, 0xD7, 0x49, 0x5E, 0x6B, 0x36, 0x6A, 0x7F, 0xA5, 0xB2, 0x71, 0xF4, 0x61, 0x4F, 0x69,
+    0x6C, 0x58, 0xF5, 0x61, 0xEA, 0x70, 0x56, 0x8A, 0x4D, 0x81, 0x88, 0x78, 0xD6, 0x92, 0x95, 0x82, 0x5D, 0xBC, 0x89, 0x80, 0x4D, 0x91, 0xA8, 0x80, 0x26, 0x80, 0x25, 0x80, 0x46, 0x88, 0xE8, 0xA0, 0xCE, 0xB1, 0x94, 0xBA, 0xA8, 0xA0, 0x67, 0x90, 0xC8, 0xA0, 0x88, 0x98, 0x48, 0x98, 0x68, 0x98, 0x0A, 0xB1, 0xA9, 0xA8, 0xA9, 0xA8, 0xAA, 0xB0, 0xC9, 0xB0, 0x89, 0xB0, 0x68, 0xB0, 0xCA, 0xC0,
+    0xE9, 0x50, 0x65, 0x30, 0x45, 0x30, 0x4D, 0x71, 0x4E, 0x69, 0x07, 0x40, 0x09, 0x49, 0xC8, 0x40, 0x65, 0x30, 0x92, 0x81, 0x0C, 0x59, 0xAB, 0x40, 0x33, 0x4A, 0xAD, 0x61, 0xF5, 0x81, 0x4C, 0x51, 0x94, 0x82, 0xB1, 0x61, 0x6F, 0x59, 0x6D, 0x59, 0xDC, 0x82, 0x79, 0x62, 0xFC, 0x72, 0xB7, 0x62, 0xEB, 0x58, 0xFF, 0x73, 0xFF, 0x74, 0x7B, 0x52, 0x57, 0x62, 0x96, 0x62, 0xFF, 0x7F, 0xFF, 0xD7,
+    0xFF, 0x8E, 0x5F, 0x53, 0x94, 0x49, 0x5E, 0x87, 0xFF, 0xFF, 0xFF, 0xDF, 0xD6, 0x49, 0x3A, 0x3A, 0xFF, 0xF7, 0xFF, 0xAF, 0x3F, 0xA7, 0x91, 0x71, 0xFF, 0xC7, 0xFF, 0xFF, 0xDE, 0xCC, 0xD5, 0x81, 0xF5, 0x91, 0xFA, 0x9A, 0x1E, 0xAB, 0x5A, 0xE2, 0xD6, 0xF2, 0x92, 0xC1, 0x1F, 0xEF, 0xF5, 0xB1, 0x15, 0xCA, 0xD0, 0xC1, 0x6D, 0xC1, 0x33, 0xD2, 0xED, 0xB0, 0xAA, 0xB8, 0xB0, 0xF9, 0x4B, 0xC9,
+    0xF0, 0xD9, 0x4D, 0xD9, 0xAA, 0xD8, 0x0E, 0xF9, 0x67, 0xA8, 0xEB, 0xE0, 0xEB, 0xE0, 0x26, 0xA0, 0x2C, 0xE9, 0xA9, 0xC8, 0x67, 0xC0, 0x4D, 0xF9, 0x89, 0xC0, 0xEB, 0xE0, 0x89, 0xC8, 0xAA, 0xC8, 0x65, 0x30, 0x65, 0x30, 0x65, 0x30, 0x65, 0x30, 0xC8, 0x40, 0x4B, 0x51, 0x25, 0x28, 0x26, 0x28, 0x66, 0x38, 0x0A, 0x49, 0x68, 0x38, 0x92, 0x72, 0xD3, 0x82, 0xA9, 0x40, 0x86, 0x38, 0x86, 0x38,
+    0x67, 0x38, 0x50, 0x31, 0x0B, 0x51, 0xCA, 0x38, 0xB5, 0x7A, 0xB0, 0x59, 0x49, 0x30, 0xCB, 0x38, 0x34, 0x62, 0xAA, 0x38, 0x10, 0x31, 0x4F, 0x49, 0xEF, 0x40, 0x53, 0x6A, 0xBF, 0xA5, 0x1C, 0x53, 0x79, 0x42, 0x79, 0x5A, 0x5E, 0x33, 0x7D, 0x43, 0xDB, 0x42, 0x3E, 0x4C, 0x37, 0x52, 0x38, 0x42, 0xFD, 0x4A, 0xD6, 0x59, 0x1B, 0x83, 0xF3, 0x81, 0xDD, 0x8B, 0xCD, 0x68, 0x8A, 0x68, 0xAB, 0x70,
+    0x71, 0x71, 0xDD, 0x9B, 0x8B, 0x78, 0x0D, 0x81, 0xAB, 0x88, 0x67, 0x88, 0xD7, 0xB2, 0x1B, 0xBC, 0xD1, 0x91, 0x8D, 0xB9, 0x0B, 0xA9, 0x2B, 0xB1, 0x26, 0x90, 0x46, 0x90, 0x87, 0xA0, 0x26, 0x90, 0x88, 0x98, 0x2B, 0xB1, 0x68, 0xB0, 0x67, 0xA8, 0x67, 0xA8, 0x47, 0xA8, 0x48, 0xA8, 0x68, 0xB8, 0x88, 0xC0, 0x88, 0xC0, 0x68, 0xB8, 0xA9, 0xC0, 0x68, 0xC0, 0x8A, 0xD0, 0x89, 0xD0, 0x89, 0xD0,
+    0x85, 0x38, 0x24, 0x28, 0x04, 0x28, 0x85, 0x38, 0x66, 0x38, 0xCD, 0x69, 0x46, 0x30, 0xA9, 0x48, 0x45, 0x30, 0x66, 0x30, 0x86, 0x38, 0x92, 0x7A, 0x71, 0x7A, 0xA9, 0x40, 0x86, 0x38, 0x86, 0x38, 0x65, 0x38, 0xAD, 0x40, 0x70, 0x59, 0x68, 0x30, 0x4E, 0x51, 0xAE, 0x61, 0x6A, 0x38, 0x2D, 0x49, 0x4F, 0x51, 0xEC, 0x48, 0x10, 0x41, 0x0E, 0x51, 0xED, 0x48, 0x12, 0x6A, 0xDF, 0xAC, 0x57, 0x62,
+    0x15, 0x52, 0xD4, 0x51, 0xB4, 0x41, 0x3E, 0x5B, 0xBC, 0x52, 0x5D, 0x63, 0x73, 0x61, 0x32, 0x49, 0xD5, 0x61, 0x73, 0x61, 0x98, 0x82, 0xF2, 0x89, 0x36, 0x82, 0xAB, 0x70, 0x8A, 0x78, 0x6A, 0x70, 0xD7, 0x92, 0x14, 0x92, 0x48, 0x78, 0x68, 0x80, 0xEB, 0x90, 0x88, 0x88, 0x12, 0xB2, 0x17, 0xCB, 0x1E, 0xCD, 0x4D, 0xB1, 0x0A, 0xB1, 0x0B, 0xB1, 0x67, 0x98, 0x66, 0xA0, 0x46, 0xA0, 0x67, 0xA0,
+    0x47, 0xA0, 0xC9, 0xA8, 0x47, 0xA8, 0xA8, 0xB0, 0xA9, 0xB8, 0x88, 0xB0, 0x47, 0xA8, 0x68, 0xB8, 0x68, 0xB8, 0x69, 0xB8, 0x69, 0xC0, 0xA9, 0xC0, 0xCA, 0xC8, 0x8A, 0xC8, 0x89, 0xC8, 0xAA, 0xD0, 0x24, 0x30, 0x64, 0x30, 0xED, 0x69, 0x65, 0x38, 0x04, 0x20, 0x87, 0x38, 0x85, 0x38, 0xB2, 0x8A, 0x46, 0x30, 0xC7, 0x40, 0x86, 0x38, 0x32, 0x7A, 0x31, 0x7A, 0xA9, 0x40, 0x87, 0x40, 0x66, 0x38,
+    0x87, 0x40, 0x32, 0x72, 0x6A, 0x38, 0xEA, 0x50, 0x0C, 0x51, 0xCA, 0x48, 0x2C, 0x59, 0x94, 0x7A, 0xCC, 0x48, 0x4E, 0x59, 0x71, 0x59, 0x4F, 0x59, 0x8B, 0x40, 0x12, 0x72, 0x5F, 0xAC, 0xD8, 0x72, 0x12, 0x59, 0xF5, 0x61, 0x71, 0x61, 0xBA, 0x6A, 0xD5, 0x51, 0x1C, 0x83, 0x50, 0x61, 0xB3, 0x69, 0x92, 0x69, 0xF0, 0x58, 0x76, 0x9A, 0xF1, 0x89, 0xF4, 0x91, 0xAC, 0x78, 0x0C, 0x91, 0x8A, 0x78,
+    0x38, 0xC3, 0x37, 0xA2, 0xEB, 0x88, 0xCA, 0x90, 0xEC, 0xA0, 0x47, 0x98, 0xCC, 0x98, 0x0C, 0xA9, 0x8A, 0x98, 0x0A, 0xB9, 0xA9, 0xA8, 0xC9, 0xB0, 0x68, 0xA8, 0x26, 0xA0, 0x46, 0xA8, 0xE9, 0xB8, 0x26, 0xA8, 0x46, 0xA8, 0x27, 0xB0, 0x67, 0xB8, 0x89, 0xB8, 0x68, 0xB8, 0x67, 0xB8, 0x89, 0xC0, 0x89, 0xC8, 0x0B, 0xD1, 0xCA, 0xC8, 0x8A, 0xC8, 0xAB, 0xD0, 0x8A, 0xC8, 0x89, 0xC8, 0xCA, 0xD8,
+    0x67, 0x38, 0xC7, 0x40, 0x6F, 0x7A, 0x71, 0x7A, 0x8E, 0x69, 0x87, 0x40, 0x2B, 0x51, 0x51, 0x7A, 0x04, 0x30, 0xD0, 0x69, 0x2C, 0x59, 0x4D, 0x59, 0x2D, 0x59, 0xA9, 0x48, 0xA8, 0x40, 0xD0, 0x69, 0x4D, 0x61, 0x11, 0x72, 0x13, 0x6A, 0x70, 0x59, 0x4E, 0x59, 0xCB, 0x50, 0x4C, 0x59, 0x9B, 0x9B, 0x30, 0x59, 0xD7, 0x8A, 0x6E, 0x61, 0xB9, 0x62, 0xBB, 0x7A, 0x11, 0x6A, 0xFF, 0xBD, 0x1B, 0x73,
+    0xBD, 0x82, 0x15, 0x62, 0xF4, 0x69, 0x7E, 0x6C, 0xDC, 0x65, 0xBF, 0x9B, 0x0F, 0x71, 0x51, 0x71, 0x3F, 0xA4, 0x53, 0x71, 0xD9, 0xAA, 0xF2, 0x91, 0x37, 0xAA, 0xCB, 0x80, 0x2D, 0x99, 0x7C, 0xB3, 0x7F, 0xEC, 0x7D, 0xE4, 0x8F, 0xB9, 0x35, 0xDB, 0x10, 0xC1, 0xEF, 0xA8, 0x69, 0xB8, 0x4E, 0xC1, 0x4E, 0xC1, 0x69, 0xB8, 0xEB, 0xD0, 0xAA, 0xC8, 0xAF, 0xD9, 0x68, 0xC8, 0x2B, 0xD9, 0xCA, 0xD0,
+    0x06, 0xB8, 0x89, 0xD8, 0xCA, 0xD8, 0xCA, 0xD8, 0xA9, 0xD0, 0x67, 0xC0, 0x47, 0xC0, 0x48, 0xC8, 0x49, 0xD0, 0x6A, 0xD8, 0x89, 0xD0, 0x8B, 0xD8, 0x8B, 0xD8, 0x8A, 0xD8, 0x8B, 0xE8, 0x8A, 0xE8, 0xD3, 0x9A, 0x6B, 0x59, 0xC7, 0x50, 0x04, 0x30, 0x71, 0x79, 0xAF, 0x71, 0x0C, 0x59, 0x29, 0x61, 0x30, 0xA2, 0xB2, 0x79, 0x47, 0x40, 0xB0, 0x79, 0x89, 0x50, 0xA8, 0x50, 0xD9, 0x9A, 0x26, 0x38,
+    0xD8, 0x8A, 0x2C, 0x59, 0xAF, 0x69, 0x3F, 0xBF, 0xBB, 0x7A, 0x1E, 0x83, 0x6D, 0x69, 0x14, 0xA3, 0x8A, 0x50, 0xDF, 0x8B, 0x9F, 0x8C, 0x4D, 0x61, 0xAA, 0x50, 0x0C, 0x59, 0x3F, 0x84, 0x7F, 0x8F, 0x71, 0x79, 0x0F, 0x59, 0x50, 0x69, 0x7B, 0x5C, 0xFF, 0xC7, 0xFE, 0x7C, 0xED, 0x70, 0x93, 0x71, 0x79, 0x6A, 0x9C, 0xAD, 0x39, 0xC3, 0xD7, 0xAA, 0xD6, 0xA2, 0x3F, 0xBD, 0x4E, 0x80, 0x2E, 0xB1,
+    0x11, 0xD2, 0xF7, 0xBA, 0xDE, 0xF3, 0xED, 0xD8, 0x69, 0xC0, 0x68, 0xC0, 0x73, 0xC9, 0xDB, 0xFA, 0xCB, 0xC0, 0x06, 0xA8, 0xAB, 0xC8, 0xF3, 0xF9, 0x72, 0xE9, 0x67, 0xE0, 0x26, 0xC8, 0x46, 0xC8, 0x2F, 0xF9, 0xB3, 0xF9, 0x07, 0xD8, 0x2C, 0xF9, 0x0B, 0xF1, 0x4F, 0xF9, 0x50, 0xF9, 0x88, 0xE8, 0x47, 0xD8, 0x8B, 0xF0, 0x07, 0xD0, 0xED, 0xF8, 0x69, 0xD8, 0xCB, 0xE8, 0xAA, 0xE0, 0x2D, 0xF9,
+    0x08, 0x71, 0x64, 0x38, 0xA6, 0x48, 0x65, 0x40, 0x49, 0x61, 0x65, 0x40, 0xE7, 0x50, 0x24, 0x40, 0x0D, 0x9A, 0x65, 0x40, 0xC7, 0x58, 0x24, 0x38, 0x46, 0x48, 0x87, 0x50, 0xC7, 0x58, 0x66, 0x48, 0x04, 0x40, 0xA8, 0x58, 0xAD, 0x81, 0x88, 0x58, 0x2A, 0x69, 0xA9, 0x60, 0x87, 0x50, 0xCE, 0x81, 0xA9, 0x60, 0xCE, 0x81, 0x8E, 0x89, 0x6D, 0x79, 0x89, 0x58, 0xEB, 0x60, 0x52, 0x9A, 0x6F, 0x71,
+    0xCC, 0x68, 0xED, 0x68, 0x2D, 0x81, 0xD2, 0x99, 0x2E, 0x81, 0x71, 0xA1, 0x8A, 0x70, 0xAC, 0x78, 0xEE, 0x98, 0xEE, 0x98, 0x4E, 0xB1, 0x0C, 0x99, 0x6A, 0x80, 0x8F, 0xB1, 0xCD, 0x98, 0x89, 0xA0, 0xAF, 0xC9, 0xF1, 0xD1, 0xCA, 0xB0, 0x2F, 0xC1, 0x26, 0xB0, 0x48, 0xB0, 0x27, 0xA8, 0x67, 0xB8, 0x8C, 0xC0, 0x2D, 0xC9, 0x06, 0xB8, 0x27, 0xC8, 0x88, 0xD8, 0x26, 0xC8, 0x6A, 0xD0, 0x26, 0xC8,
+    0xA7, 0xD0, 0x25, 0xC0, 0x26, 0xD0, 0xD7, 0xFA, 0x47, 0xD8, 0x26, 0xD0, 0x68, 0xD8, 0x89, 0xE0, 0xB2, 0xF9, 0x68, 0xE0, 0x48, 0xD8, 0x49, 0xD8, 0x6A, 0xE8, 0xED, 0xF8, 0xCA, 0xF8, 0x8A, 0xE8, 0xA6, 0x58, 0x64, 0x38, 0x64, 0x40, 0x64, 0x40, 0xA6, 0x50, 0x65, 0x40, 0xC6, 0x50, 0x65, 0x48, 0x29, 0x71, 0x45, 0x40, 0x29, 0x61, 0xA8, 0x50, 0x87, 0x50, 0xE8, 0x60, 0xC8, 0x60, 0xC7, 0x58,
+    0x46, 0x50, 0x0A, 0x69, 0xEA, 0x68, 0xEA, 0x68, 0xC8, 0x68, 0x2B, 0x71, 0xEA, 0x68, 0xCA, 0x68, 0x0A, 0x79, 0x2C, 0x79, 0x12, 0xA2, 0x6B, 0x71, 0x47, 0x50, 0x0C, 0x71, 0x11, 0xA2, 0x2D, 0x81, 0x6B, 0x68, 0x90, 0x89, 0x6D, 0xA1, 0x90, 0x91, 0x4E, 0x91, 0x4F, 0xA1, 0xAA, 0x80, 0xCB, 0x88, 0x0D, 0xA1, 0xCC, 0x98, 0x2C, 0xB9, 0x0B, 0xA1, 0x08, 0x88, 0x68, 0x98, 0xEB, 0xB0, 0x8E, 0xD1,
+    0x92, 0xFA, 0x4C, 0xC9, 0xCA, 0xC0, 0xA9, 0xC0, 0x06, 0xB8, 0xAA, 0xD0, 0x89, 0xD0, 0x06, 0xC0, 0xAA, 0xE0, 0xA9, 0xE0, 0x67, 0xD8, 0x0A, 0xE9, 0x06, 0xD8, 0x88, 0xE0, 0x47, 0xD8, 0xC9, 0xE8, 0x68, 0xE0, 0x26, 0xD0, 0x26, 0xD8, 0x67, 0xE0, 0x67, 0xE0, 0x27, 0xD8, 0xA9, 0xF0, 0x68, 0xE0, 0x47, 0xE0, 0x69, 0xE8, 0x89, 0xE8, 0x69, 0xE8, 0x69, 0xE0, 0x69, 0xE8, 0x69, 0xE8, 0xAA, 0xF0,
+    0x44, 0x40, 0x65, 0x40, 0x24, 0x40, 0x85, 0x40, 0x25, 0x40, 0x44, 0x40, 0xA7, 0x50, 0x45, 0x40, 0x05, 0x48, 0x45, 0x40, 0x87, 0x50, 0x46, 0x48, 0xE9, 0x60, 0xE7, 0x68, 0xA8, 0x68, 0xEC, 0x60, 0x8D, 0x81, 0xEA, 0x70, 0x67, 0x50, 0x0D, 0x69, 0xEB, 0x68, 0xCD, 0x91, 0x67, 0x58, 0xA9, 0x60, 0xF1, 0x91, 0x2F, 0xAA, 0x10, 0x9A, 0xEB, 0x68, 0x14, 0x92, 0x0A, 0x79, 0xF0, 0xA1, 0x2C, 0x89,
+    0xF3, 0x99, 0x0C, 0x89, 0xCA, 0x90, 0xF4, 0x89, 0xB9, 0xAA, 0xCC, 0x98, 0xA8, 0x78, 0xAA, 0x88, 0xF6, 0xB9, 0x4D, 0xB1, 0x0B, 0xB9, 0x48, 0x98, 0xB2, 0xD1, 0x69, 0xA8, 0x27, 0xA0, 0x0B, 0xC9, 0xD2, 0xF1, 0xAE, 0xE9, 0x69, 0xC0, 0x70, 0xEA, 0x6F, 0xF1, 0xCF, 0xF9, 0x47, 0xC8, 0x27, 0xC8, 0xAB, 0xE8, 0x0F, 0xFA, 0x6B, 0xF9, 0xC9, 0xF0, 0xAA, 0xF0, 0xA8, 0xE0, 0x68, 0xE8, 0x89, 0xF0,
+    0xEB, 0xF8, 0x88, 0xF0, 0x06, 0xE0, 0xA9, 0xF8, 0xC9, 0xF8, 0x47, 0xE0, 0x27, 0xE8, 0x68, 0xE8, 0x48, 0xE8, 0x49, 0xF0, 0x68, 0xF0, 0xAA, 0xF8, 0xAA, 0xF8, 0x8A, 0xF8, 0x8A, 0xF8, 0x8A, 0xF8, 0x44, 0x48, 0x65, 0x40, 0x25, 0x40, 0x4D, 0x71, 0x67, 0x48, 0x65, 0x40, 0x85, 0x50, 0x8B, 0x71, 0x46, 0x50, 0x0B, 0x61, 0x65, 0x50, 0x66, 0x50, 0x8F, 0x71, 0x45, 0x48, 0xCC, 0xA1, 0x46, 0x50,
+    0x92, 0xB2, 0x91, 0x71, 0xB3, 0x79, 0xE9, 0x88, 0x47, 0x68, 0xAF, 0x89, 0xB7, 0x8A, 0xC9, 0x68, 0x87, 0x60, 0xC9, 0x70, 0x11, 0xAA, 0x59, 0x8A, 0x26, 0x70, 0xA8, 0x60, 0x91, 0x81, 0x7F, 0x8B, 0x8A, 0x80, 0x89, 0x78, 0xEA, 0x98, 0x30, 0x91, 0x7F, 0xB3, 0xCB, 0x98, 0xA9, 0x88, 0xAA, 0x98, 0xD7, 0xA9, 0x4D, 0xB9, 0xEB, 0xC0, 0x89, 0xA8, 0xD1, 0xC9, 0x1F, 0xE3, 0x48, 0xA8, 0x6D, 0xD9,
+    0x31, 0xFA, 0xD5, 0xF1, 0x6E, 0xF9, 0xEA, 0xD8, 0x27, 0xD0, 0x90, 0xF9, 0x8A, 0xE0, 0x26, 0xD0, 0xA9, 0xF8, 0x48, 0xE8, 0x51, 0xF9, 0xA9, 0xF0, 0xC8, 0xF8, 0x68, 0xF0, 0x2E, 0xF9, 0x4B, 0xF9, 0x05, 0xE0, 0x87, 0xF8, 0x68, 0xF8, 0xAC, 0xF8, 0x05, 0xE0, 0xC9, 0xF8, 0xAA, 0xF8, 0xCC, 0xF8, 0x68, 0xF8, 0x49, 0xF8, 0x48, 0xF8, 0x69, 0xF8, 0x69, 0xF8, 0xAA, 0xF8, 0x6A, 0xF8, 0xAB, 0xF8,
+    0xA6, 0x50, 0xAD, 0x71, 0x44, 0x48, 0x46, 0x48, 0xCB, 0x60, 0x45, 0x50, 0x4D, 0x71, 0x65, 0x48, 0xA6, 0x58, 0xEA, 0x60, 0x25, 0x48, 0xD1, 0x81, 0x86, 0x58, 0x24, 0x50, 0x29, 0x99, 0x88, 0x60, 0x4F, 0x89, 0xAC, 0xB9, 0x24, 0x58, 0xAE, 0xB9, 0x55, 0x9A, 0x78, 0x9A, 0x87, 0x60, 0xA8, 0x78, 0x88, 0x68, 0x2F, 0x71, 0x7F, 0x9B, 0x88, 0x80, 0x27, 0x78, 0x68, 0x68, 0x90, 0x91, 0x7F, 0xBC,
+    0x89, 0x90, 0x0C, 0xA1, 0x2A, 0xA9, 0xAF, 0xB9, 0xDA, 0xBA, 0x69, 0x90, 0xA8, 0x90, 0xA9, 0xA0, 0xEB, 0xA0, 0x51, 0xD1, 0xCA, 0xC0, 0x48, 0xB0, 0x6D, 0xD9, 0x9F, 0xFB, 0x49, 0xC0, 0x8D, 0xF1, 0x06, 0xD0, 0x75, 0xFB, 0xBB, 0xFA, 0x0B, 0xF1, 0x67, 0xD8, 0xCE, 0xF9, 0x48, 0xE0, 0x78, 0xFA, 0x26, 0xE8, 0x88, 0xF0, 0x47, 0xF0, 0xCB, 0xF0, 0xD3, 0xF9, 0xCF, 0xF9, 0x88, 0xF8, 0xC9, 0xF8,
+    0x27, 0xF0, 0xEE, 0xF8, 0xA8, 0xF8, 0x88, 0xF8, 0x27, 0xF0, 0x27, 0xF0, 0x50, 0xF9, 0x48, 0xF8, 0x07, 0xF8, 0xEC, 0xF8, 0x09, 0xF8, 0xCD, 0xF8, 0x69, 0xF8, 0x6A, 0xF8, 0x8A, 0xF8, 0xAB, 0xF8, 0x45, 0x60, 0x44, 0x40, 0x44, 0x40, 0x24, 0x60, 0x86, 0x50, 0x64, 0x48, 0x23, 0x40, 0x44, 0x48, 0x44, 0x50, 0x26, 0x40, 0x87, 0x58, 0x29, 0x89, 0x24, 0x40, 0x28, 0x79, 0xC8, 0x80, 0x2A, 0x99,
+    0x25, 0x88, 0x6B, 0xA1, 0x46, 0x60, 0xC8, 0xA8, 0x26, 0x68, 0xEA, 0x80, 0x66, 0x68, 0x87, 0x68, 0x46, 0x68, 0x4B, 0x91, 0xAD, 0xC9, 0x67, 0x78, 0x48, 0x78, 0xEB, 0x90, 0x88, 0x90, 0x0A, 0xA9, 0x89, 0x98, 0x48, 0x88, 0xEA, 0xA8, 0x6D, 0xC1, 0x0C, 0xA9, 0xCA, 0xB8, 0xA8, 0x98, 0xA9, 0xA0, 0x0D, 0xB1, 0x34, 0xF2, 0x46, 0xB0, 0x27, 0xA8, 0x48, 0xB8, 0x88, 0xC8, 0x3F, 0xFD, 0x6D, 0xF9,
+    0x07, 0xE0, 0xC9, 0xE8, 0x88, 0xE8, 0xFD, 0xFA, 0xC8, 0xF0, 0x2B, 0xF9, 0x68, 0xF8, 0xA9, 0xF8, 0x17, 0xFA, 0x88, 0xF8, 0x68, 0xF8, 0xA8, 0xF8, 0xA9, 0xF8, 0x57, 0xFA, 0x48, 0xF0, 0x47, 0xF8, 0x05, 0xF0, 0xA9, 0xF8, 0xAB, 0xF8, 0x73, 0xF9, 0x27, 0xF8, 0x27, 0xF8, 0x06, 0xF0, 0x27, 0xF0, 0x10, 0xF9, 0x48, 0xF8, 0x6A, 0xF8, 0x49, 0xF8, 0x6A, 0xF8, 0xEF, 0xF8, 0x6A, 0xF8, 0x6A, 0xF8,
+    0x03, 0x60, 0x44, 0x40, 0x23, 0x48, 0x8E, 0xDA, 0x44, 0x48, 0x64, 0x48, 0x85, 0x60, 0x44, 0x48, 0xC8, 0x60, 0x01, 0x40, 0x44, 0x50, 0x8A, 0xA9, 0xC9, 0x68, 0x2D, 0xC2, 0x24, 0x68, 0x06, 0x60, 0x26, 0x80, 0xA8, 0xA8, 0x45, 0x68, 0x4B, 0x99, 0x0B, 0x81, 0x87, 0x78, 0x66, 0x68, 0x86, 0x68, 0x6D, 0x91, 0x66, 0x78, 0x6C, 0xC9, 0xC9, 0x88, 0xB1, 0x99, 0x26, 0x78, 0xA9, 0xA0, 0xEA, 0x98,
+    0xB0, 0xB9, 0x47, 0x98, 0xA8, 0xA8, 0xEB, 0xC0, 0x91, 0xB1, 0x48, 0xB8, 0x67, 0x90, 0x0A, 0xB9, 0x91, 0xD1, 0xE9, 0xD0, 0x67, 0xC0, 0x47, 0xC8, 0xD0, 0xF9, 0x6B, 0xF1, 0x27, 0xC8, 0xCD, 0xF9, 0x2E, 0xF9, 0x47, 0xE0, 0x0A, 0xF9, 0x4A, 0xF9, 0xAC, 0xF0, 0xA9, 0xF8, 0x47, 0xF0, 0x4D, 0xF9, 0x4D, 0xF9, 0x06, 0xE8, 0x47, 0xF8, 0xA9, 0xF8, 0xAA, 0xF8, 0x88, 0xF8, 0x4A, 0xF9, 0x48, 0xF0,
+    0xCB, 0xF8, 0xA9, 0xF8, 0x06, 0xF0, 0x89, 0xF8, 0x68, 0xF8, 0x07, 0xF8, 0x48, 0xF8, 0x07, 0xF8, 0x28, 0xF8, 0x27, 0xF0, 0x29, 0xF8, 0x6A, 0xF8, 0x69, 0xF8, 0x8A, 0xF8, 0x6A, 0xF8, 0x6A, 0xF8, 0x64, 0x58, 0x23, 0x38, 0x85, 0x50, 0xCB, 0xA1, 0x04, 0x40, 0x4C, 0x71, 0xEC, 0x81, 0x03, 0x40, 0x85, 0x48, 0x68, 0x50, 0x24, 0x48, 0xC8, 0x98, 0x44, 0x58, 0x09, 0x79, 0x11, 0x92, 0x4A, 0xA9,
+    0x25, 0x80, 0xA8, 0x80, 0x6E, 0x79, 0xCD, 0xD1, 0x25, 0x68, 0x46, 0x70, 0x26, 0x70, 0x90, 0x99, 0x46, 0x70, 0x25, 0x68, 0x0C, 0x81, 0xF4, 0x91, 0x0A, 0xA1, 0x46, 0x68, 0x89, 0xA0, 0x0C, 0xA1, 0x89, 0xB0, 0x88, 0xA0, 0x06, 0x98, 0x10, 0xCA, 0xB4, 0xC1, 0x06, 0xB0, 0x87, 0x98, 0x0A, 0xB9, 0xB1, 0xD1, 0x92, 0xFA, 0x26, 0xB8, 0x88, 0xC8, 0x89, 0xD0, 0xAE, 0xF9, 0x47, 0xD0, 0x6B, 0xF9,
+    0x0A, 0xF9, 0x2F, 0xF1, 0xB3, 0xFA, 0x47, 0xF0, 0xC9, 0xF8, 0xCC, 0xF0, 0x88, 0xF8, 0xA8, 0xF8, 0xC9, 0xF8, 0x90, 0xF9, 0x89, 0xF8, 0x47, 0xF8, 0x47, 0xF8, 0x49, 0xF0, 0x27, 0xF0, 0x06, 0xF0, 0x88, 0xF8, 0x89, 0xF8, 0x06, 0xE8, 0x27, 0xF8, 0x06, 0xF8, 0x49, 0xF8, 0xAA, 0xF8, 0x28, 0xF8, 0x07, 0xF8, 0x89, 0xF8, 0x4A, 0xF8, 0x8A, 0xF8, 0x69, 0xF8, 0x4A, 0xF8, 0x4A, 0xF8, 0x8B, 0xF8,
+    0x28, 0x79, 0x44, 0x40, 0x2D, 0xCA, 0x69, 0x58, 0x44, 0x48, 0xA5, 0x58, 0xEB, 0xB1, 0xE9, 0x70, 0x87, 0x58, 0xEC, 0xA1, 0x44, 0x48, 0x87, 0x80, 0x90, 0x81, 0x65, 0x68, 0xAB, 0xC1, 0x66, 0xA8, 0xA7, 0x78, 0x92, 0x81, 0x08, 0x79, 0x8C, 0xC9, 0x25, 0x68, 0x68, 0x60, 0x92, 0x99, 0x05, 0x60, 0x04, 0x60, 0x05, 0x70, 0xCC, 0x80, 0x67, 0x98, 0x0A, 0xA1, 0xA8, 0x80, 0xA8, 0xB8, 0xDB, 0xB2,
+    0x88, 0xA8, 0x68, 0xA8, 0x2A, 0xC1, 0x2B, 0xE9, 0x34, 0xD2, 0x26, 0xB8, 0x67, 0x98, 0x0A, 0xB9, 0x2C, 0xC1, 0xEA, 0xE8, 0x04, 0xA8, 0x88, 0xD0, 0xA9, 0xE0, 0x78, 0xFA, 0xE9, 0xF8, 0x4B, 0xF9, 0xA8, 0xF8, 0x06, 0xE0, 0xB6, 0xFA, 0x05, 0xE8, 0xC9, 0xF8, 0x05, 0xF0, 0xD3, 0xF9, 0x88, 0xE8, 0x2B, 0xF9, 0x68, 0xF8, 0x68, 0xF0, 0xB4, 0xF9, 0x06, 0xF0, 0xC9, 0xF8, 0x06, 0xE8, 0x0D, 0xF9,
+    0xCC, 0xF8, 0x07, 0xF8, 0x26, 0xF8, 0x05, 0xE8, 0xCE, 0xF8, 0xCB, 0xF8, 0x48, 0xF8, 0x08, 0xF8, 0x6F, 0xF9, 0x4B, 0xF8, 0x6A, 0xF8, 0x69, 0xF8, 0x4A, 0xF8, 0x4A, 0xF8, 0x8B, 0xF8, 0xED, 0xF8, 0x29, 0xA1, 0xE9, 0x58, 0x69, 0xA1, 0x44, 0x48, 0x45, 0x40, 0x03, 0x48, 0xCA, 0x68, 0x69, 0x89, 0x85, 0x58, 0x2D, 0xCA, 0x24, 0x48, 0x6B, 0xA9, 0x03, 0x38, 0xC8, 0x70, 0xAB, 0xA9, 0xCF, 0xA1,
+    0xF0, 0xA9, 0x88, 0x68, 0x49, 0x89, 0x8B, 0xB9, 0x89, 0x88, 0xCA, 0x88, 0x25, 0x70, 0x45, 0x68, 0x45, 0x70, 0x49, 0x78, 0x49, 0x90, 0x25, 0x70, 0x09, 0xB1, 0x26, 0x70, 0x27, 0x98, 0x67, 0xA0, 0xA9, 0xB8, 0x26, 0x98, 0x67, 0x98, 0xAE, 0xE9, 0xEB, 0xB0, 0x88, 0xD8, 0x46, 0x98, 0x6C, 0xD9, 0x0D, 0xC9, 0x88, 0xD0, 0x26, 0xC0, 0x2B, 0xF1, 0xAA, 0xE8, 0xD3, 0xF9, 0x47, 0xD8, 0x69, 0xE0,
+    0x88, 0xF8, 0x48, 0xF8, 0xF6, 0xF9, 0x89, 0xF8, 0x8C, 0xF9, 0x26, 0xF0, 0x48, 0xF8, 0xF5, 0xF9, 0xAA, 0xF8, 0x0A, 0xF9, 0x89, 0xF8, 0x28, 0xF8, 0x33, 0xFA, 0x0B, 0xF9, 0x28, 0xF0, 0x28, 0xF8, 0x27, 0xF0, 0x11, 0xFA, 0xAA, 0xF8, 0x07, 0xF8, 0x07, 0xF0, 0x0D, 0xF1, 0x4F, 0xF9, 0x28, 0xF8, 0x29, 0xF8, 0x09, 0xF8, 0x4F, 0xF9, 0x2A, 0xF8, 0x2A, 0xF8, 0x6A, 0xF8, 0x4A, 0xF8, 0x6C, 0xF8,
+    0x85, 0x78, 0x44, 0x40, 0xA5, 0x70, 0x45, 0x50, 0xEB, 0x70, 0x49, 0xA1, 0x65, 0x70, 0xE7, 0x68, 0xA8, 0x60, 0xF1, 0x91, 0x63, 0x70, 0x6D, 0xFA, 0xA8, 0x70, 0x24, 0x58, 0x86, 0x70, 0x29, 0xA9, 0xA8, 0x88, 0x49, 0xA9, 0x69, 0x99, 0x0C, 0xE2, 0x8E, 0xB9, 0x25, 0x80, 0x66, 0x80, 0x04, 0x68, 0xEB, 0x90, 0x26, 0x88, 0x06, 0x98, 0x46, 0x78, 0x2E, 0x99, 0x46, 0x78, 0x06, 0xA0, 0x26, 0x88,
+    0x0C, 0xB9, 0x06, 0x98, 0xC8, 0xA8, 0xC9, 0xB0, 0x4E, 0xC1, 0x47, 0xD8, 0x46, 0xA0, 0xA9, 0xC8, 0x70, 0xD9, 0x08, 0xC8, 0x46, 0xC8, 0xC9, 0xE8, 0x49, 0xE0, 0x4A, 0xF9, 0x1E, 0xFC, 0x45, 0xD8, 0xED, 0xF8, 0x06, 0xF0, 0x67, 0xF0, 0xB9, 0xF2, 0x4E, 0xF9, 0x07, 0xF8, 0x06, 0xF8, 0x27, 0xF8, 0x15, 0xF3, 0x69, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0xEC, 0xF8, 0x15, 0xFC, 0x05, 0xE0, 0x68, 0xF8,
+    0xAB, 0xF8, 0x07, 0xF8, 0xD3, 0xFB, 0xCB, 0xF0, 0x49, 0xF0, 0x07, 0xF0, 0x08, 0xF0, 0x92, 0xFB, 0x72, 0xFB, 0x09, 0xF8, 0x49, 0xF8, 0x09, 0xF0, 0xD2, 0xFA, 0xB0, 0xFA, 0x6B, 0xF8, 0x4B, 0xF8, 0x23, 0x48, 0x64, 0x40, 0x22, 0x48, 0x02, 0x40, 0x44, 0x40, 0xED, 0xC1, 0x03, 0x48, 0x45, 0x58, 0x44, 0x48, 0x86, 0x78, 0x08, 0xA1, 0xE8, 0xB0, 0x24, 0x58, 0x03, 0x48, 0x05, 0x60, 0x46, 0x88,
+    0x45, 0x70, 0xE8, 0x90, 0xE7, 0x78, 0x0F, 0xEA, 0x8C, 0xE9, 0x25, 0x70, 0x25, 0x78, 0x67, 0x80, 0x25, 0x70, 0x25, 0x78, 0x88, 0x88, 0x4C, 0x91, 0x6B, 0xB9, 0x45, 0x80, 0x87, 0xB0, 0x46, 0x88, 0x49, 0xB8, 0x67, 0xA8, 0xA7, 0xA8, 0x67, 0xB0, 0x2E, 0xC1, 0x26, 0xE0, 0x46, 0xA0, 0x88, 0xC0, 0xAB, 0xC0, 0x06, 0xD0, 0x05, 0xC8, 0xC9, 0xF0, 0xC8, 0xE8, 0x2A, 0xF9, 0x0A, 0xF1, 0x05, 0xE0,
+    0x87, 0xF8, 0x47, 0xF8, 0x48, 0xF0, 0x27, 0xF8, 0x8F, 0xFA, 0x48, 0xF8, 0x06, 0xF8, 0x06, 0xF0, 0x93, 0xFC, 0xEC, 0xF0, 0x27, 0xF8, 0x07, 0xF8, 0x49, 0xF8, 0x2D, 0xF9, 0x28, 0xF0, 0x27, 0xF0, 0x08, 0xF8, 0xCC, 0xF8, 0x09, 0xF8, 0x28, 0xF8, 0xEC, 0xF9, 0xED, 0xF8, 0x6D, 0xF9, 0x08, 0xF0, 0x29, 0xF8, 0x4A, 0xF8, 0x2A, 0xF8, 0x29, 0xF8, 0x4A, 0xF8, 0x2A, 0xF8, 0x4B, 0xF8, 0x6C, 0xF8,
+    0x84, 0x48, 0x44, 0x40, 0x64, 0x48, 0xC8, 0x58, 0x64, 0x50, 0x28, 0x79, 0x02, 0x58, 0x23, 0x48, 0x2A, 0x69, 0x45, 0x60, 0x6A, 0xA1, 0x24, 0x70, 0x28, 0x79, 0x03, 0x50, 0x45, 0x70, 0x09, 0xD9, 0x65, 0x68, 0xC9, 0x68, 0xEA, 0x80, 0x8B, 0xE1, 0xAB, 0xC1, 0x09, 0x89, 0xF3, 0xA1, 0x25, 0x70, 0x45, 0x70, 0xC9, 0x90, 0x46, 0x90, 0x46, 0x78, 0xC8, 0x98, 0xA8, 0x90, 0xA7, 0xA0, 0xB2, 0xA9,
+    0x47, 0xB8, 0x05, 0x98, 0xA7, 0x98, 0xEF, 0xE9, 0x50, 0xC9, 0x67, 0xE8, 0x45, 0xA0, 0x87, 0xC8, 0x89, 0xC0, 0x05, 0xD8, 0x26, 0xC8, 0xAC, 0xF9, 0x88, 0xE8, 0xB1, 0xF9, 0x4A, 0xE9, 0x68, 0xF0, 0x26, 0xF8, 0x4E, 0xF9, 0x47, 0xF0, 0xA9, 0xF8, 0x2D, 0xFA, 0x06, 0xF0, 0x28, 0xF0, 0x27, 0xF0, 0x70, 0xF4, 0x92, 0xFB, 0xB0, 0xF9, 0x28, 0xF8, 0x08, 0xF8, 0x89, 0xF8, 0x4C, 0xF9, 0x2E, 0xFA,
+    0x08, 0xF8, 0x09, 0xF8, 0x6A, 0xF8, 0x28, 0xF0, 0x2E, 0xFB, 0x08, 0xF0, 0x4A, 0xF8, 0x4D, 0xF9, 0x6B, 0xF8, 0x29, 0xF8, 0x2A, 0xF8, 0x4C, 0xF9, 0x4B, 0xF8, 0x0A, 0xF0, 0x2A, 0xF8, 0x6C, 0xF8, 0x84, 0x48, 0x85, 0x40, 0x43, 0x40, 0x44, 0x38, 0xA5, 0x78, 0x84, 0x58, 0x45, 0x68, 0x44, 0x50, 0x03, 0x40, 0x66, 0x60, 0xA6, 0xA8, 0x66, 0x70, 0xAB, 0x99, 0xA8, 0x78, 0x03, 0x58, 0x66, 0x98,
+    0x46, 0x58, 0xC9, 0x80, 0x44, 0x70, 0x09, 0xC9, 0x2D, 0xC2, 0xD1, 0xA1, 0x2B, 0x99, 0x45, 0x70, 0x25, 0x78, 0x27, 0x80, 0xD3, 0xA9, 0xE8, 0x90, 0x8A, 0xC9, 0x45, 0x80, 0x87, 0xA0, 0xF5, 0xC9, 0xA9, 0xB0, 0x04, 0x98, 0x66, 0xA0, 0xC9, 0xD8, 0x2D, 0xC9, 0xA8, 0xF0, 0x66, 0xA8, 0x67, 0xD8, 0x0D, 0xE1, 0x06, 0xD8, 0x05, 0xC8, 0x67, 0xE0, 0x2B, 0xF1, 0x0E, 0xF1, 0xCC, 0xF9, 0x26, 0xF8,
+    0x06, 0xF0, 0x47, 0xF8, 0x13, 0xFA, 0x49, 0xF8, 0xAA, 0xD2, 0x47, 0xF0, 0x6A, 0xF0, 0x8E, 0xF2, 0x2C, 0xFA, 0xB3, 0xFE, 0x8A, 0xF8, 0xB1, 0xFA, 0x8A, 0xF8, 0xA9, 0xF8, 0x8E, 0xFB, 0x8C, 0xF9, 0x49, 0xF8, 0xC9, 0xF0, 0x4B, 0xF9, 0x08, 0xF0, 0x8F, 0xFA, 0x48, 0xF0, 0x68, 0xE8, 0x6E, 0xFA, 0x8A, 0xF0, 0x8A, 0xF8, 0x0A, 0xF8, 0x2C, 0xF9, 0x6B, 0xF8, 0x69, 0xE8, 0x8C, 0xF8, 0x8D, 0xF8,
+    0x64, 0x48, 0x03, 0x38, 0x03, 0x48, 0x44, 0x40, 0x69, 0x89, 0x03, 0x58, 0x4D, 0xD2, 0x44, 0x50, 0x45, 0x50, 0x02, 0x48, 0x6D, 0xA2, 0x25, 0x58, 0x6B, 0x91, 0x43, 0x50, 0x03, 0x58, 0xCB, 0x88, 0xC9, 0x78, 0x65, 0x70, 0x24, 0x70, 0xC7, 0x98, 0x0F, 0xD2, 0x04, 0x80, 0x86, 0x80, 0x45, 0x78, 0xC9, 0x98, 0x46, 0x90, 0x25, 0x90, 0x04, 0x78, 0x0D, 0xA9, 0x05, 0x88, 0x05, 0xA0, 0x25, 0x90,
+    0x89, 0xC0, 0xA7, 0xB0, 0x66, 0x98, 0x87, 0xC0, 0x0B, 0xC9, 0x46, 0xC8, 0x45, 0xB0, 0xA7, 0xD0, 0x4E, 0xE9, 0x05, 0xE0, 0x05, 0xC8, 0x6B, 0xF9, 0x6D, 0xF1, 0x0A, 0xF9, 0x4E, 0xFA, 0x05, 0xF8, 0xEC, 0xF8, 0x26, 0xF8, 0x27, 0xF0, 0x48, 0xF8, 0xAB, 0xE9, 0x49, 0xF8, 0x0B, 0xF9, 0xF5, 0xFD, 0xF6, 0xFF, 0x70, 0xFD, 0xA9, 0xF8, 0x89, 0xF8, 0x53, 0xFD, 0x2D, 0xFC, 0xAB, 0xE4, 0xEB, 0xF9,
+    0xCB, 0xF9, 0x14, 0xFD, 0xAD, 0xFC, 0x6C, 0xFB, 0x4B, 0xF2, 0xCB, 0xF1, 0x6B, 0xF2, 0xB0, 0xFC, 0xEC, 0xFA, 0x4B, 0xF9, 0xCD, 0xF9, 0x8C, 0xF2, 0x0D, 0xF4, 0x54, 0xFF, 0x0C, 0xF9, 0x8C, 0xF8, 0x44, 0x50, 0x44, 0x48, 0x43, 0x40, 0x23, 0x38, 0x6D, 0x79, 0x24, 0x60, 0xAB, 0xC9, 0x44, 0x50, 0x64, 0x48, 0x45, 0x50, 0xA6, 0xA0, 0xC7, 0x70, 0x43, 0x60, 0x03, 0x48, 0x03, 0x58, 0x90, 0xCA,
+    0x23, 0x48, 0x65, 0x70, 0x45, 0x60, 0xA9, 0xB0, 0x14, 0xBA, 0x03, 0x78, 0xA7, 0x88, 0x46, 0x70, 0x03, 0x78, 0x45, 0x90, 0x25, 0x88, 0x65, 0x88, 0xA8, 0x98, 0x46, 0x88, 0x66, 0xB0, 0x26, 0x98, 0x68, 0xD0, 0x05, 0xA8, 0x45, 0x98, 0xA7, 0xC8, 0x0C, 0xD1, 0x67, 0xD8, 0x25, 0xA8, 0x67, 0xC8, 0x4E, 0xF1, 0x27, 0xE8, 0x04, 0xC8, 0x87, 0xF8, 0x76, 0xFC, 0x2A, 0xF9, 0x53, 0xFA, 0x27, 0xF8,
+    0x06, 0xF8, 0x47, 0xF8, 0x06, 0xE8, 0xF7, 0xFB, 0x29, 0xE1, 0xAA, 0xF8, 0x89, 0xF8, 0x91, 0xFE, 0xFF, 0xFF, 0x4F, 0xF5, 0x4A, 0xF9, 0x09, 0xF9, 0x2D, 0xFC, 0xFF, 0xFF, 0xF5, 0xFF, 0x08, 0xEA, 0x49, 0xE9, 0xAE, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0x6B, 0xFA, 0x8D, 0xFA, 0x4C, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0x2C, 0xFA, 0x6C, 0xF9, 0x2C, 0xFB, 0xFF, 0xFF, 0xFD, 0xFF, 0x2D, 0xFA, 0xAC, 0xF8,
+    0x44, 0x50, 0x22, 0x48, 0x64, 0x48, 0x43, 0x38, 0x63, 0x40, 0xC8, 0x70, 0x85, 0x78, 0x02, 0x38, 0x03, 0x40, 0x0A, 0x79, 0xC7, 0xA0, 0x23, 0x50, 0x23, 0x50, 0x03, 0x48, 0x88, 0x80, 0xEB, 0xE9, 0x23, 0x50, 0x03, 0x58, 0x2D, 0x89, 0x65, 0xB8, 0x66, 0x88, 0x03, 0x68, 0x03, 0x68, 0x46, 0x80, 0x04, 0x80, 0xC8, 0xA0, 0x04, 0x80, 0x50, 0xB1, 0x87, 0x98, 0xA7, 0x98, 0x25, 0x98, 0x04, 0x88,
+    0x05, 0xC0, 0x46, 0xA0, 0x24, 0x98, 0x48, 0xD9, 0x4C, 0xD9, 0x87, 0xC8, 0x65, 0xB0, 0x24, 0xC8, 0x8F, 0xF9, 0x46, 0xE8, 0x05, 0xD0, 0xC9, 0xF8, 0x10, 0xFB, 0x06, 0xF8, 0x51, 0xFB, 0x68, 0xF8, 0x05, 0xF8, 0x30, 0xF9, 0x05, 0xF0, 0x07, 0xF8, 0x6A, 0xE9, 0x90, 0xF9, 0x4A, 0xF8, 0x0E, 0xFC, 0x6B, 0xF3, 0xAA, 0xEA, 0x4A, 0xF9, 0x09, 0xF9, 0x8A, 0xFA, 0x10, 0xFE, 0xCD, 0xF4, 0xC8, 0xE1,
+    0x48, 0xE9, 0xAD, 0xFB, 0x10, 0xFD, 0x6D, 0xFC, 0x8A, 0xF9, 0x8A, 0xF9, 0x0B, 0xFA, 0xAE, 0xF4, 0x6F, 0xFC, 0xCB, 0xF9, 0xEB, 0xF8, 0xAB, 0xF1, 0xEF, 0xFB, 0xCF, 0xFB, 0x4C, 0xF9, 0xAC, 0xF8, 0x43, 0x48, 0xE6, 0x78, 0x63, 0x40, 0xE9, 0x60, 0x64, 0x48, 0x44, 0x48, 0x23, 0x48, 0x02, 0x38, 0x0B, 0x79, 0x64, 0x50, 0xE6, 0x88, 0x22, 0x48, 0x65, 0x58, 0x09, 0x81, 0x02, 0x60, 0xE7, 0xA8,
+    0x65, 0x58, 0x4D, 0x91, 0x03, 0x58, 0x45, 0x88, 0xA7, 0x98, 0x65, 0x80, 0xF1, 0xB9, 0x45, 0x70, 0xA6, 0xA8, 0x45, 0x88, 0x24, 0x80, 0x04, 0x78, 0x86, 0x98, 0x44, 0x80, 0x46, 0xA8, 0xD3, 0xC1, 0x04, 0xB0, 0x46, 0xB0, 0x44, 0xA0, 0x09, 0xE1, 0xCA, 0xC8, 0x88, 0xE8, 0x24, 0xA8, 0x26, 0xC8, 0x0D, 0xE9, 0x67, 0xF0, 0x05, 0xD8, 0x67, 0xF8, 0x91, 0xFB, 0xB2, 0xF9, 0x6E, 0xFA, 0x25, 0xF8,
+    0x07, 0xF8, 0xCC, 0xF8, 0x06, 0xF0, 0x07, 0xF0, 0x6B, 0xF9, 0x07, 0xF0, 0x12, 0xFB, 0x4C, 0xFA, 0x4A, 0xF9, 0xA8, 0xF0, 0x88, 0xF8, 0x0E, 0xFB, 0xA9, 0xF1, 0x88, 0xF1, 0x0E, 0xFC, 0x0D, 0xF3, 0xAF, 0xFB, 0x0B, 0xFA, 0x4B, 0xFA, 0xAF, 0xFB, 0x6C, 0xF2, 0x8B, 0xF9, 0xCB, 0xF9, 0xEB, 0xF9, 0x0F, 0xFC, 0x2E, 0xFB, 0xCB, 0xF8, 0x2B, 0xF9, 0x4B, 0xF9, 0x8C, 0xF9, 0x2C, 0xF9, 0xAB, 0xF8,
+    0x43, 0x40, 0x0C, 0x9A, 0x06, 0x51, 0x44, 0x40, 0x43, 0x48, 0x64, 0x48, 0x07, 0x69, 0xC6, 0x68, 0xE7, 0x60, 0x44, 0x48, 0x85, 0x50, 0x0A, 0x79, 0xA6, 0x68, 0xA5, 0x60, 0x65, 0x70, 0x23, 0x50, 0x2C, 0x89, 0xA6, 0x68, 0x23, 0x60, 0x45, 0x80, 0x89, 0x90, 0x90, 0xA9, 0x24, 0x70, 0x45, 0x70, 0x2E, 0xEA, 0xA7, 0xA0, 0xF2, 0xC1, 0x24, 0x68, 0x2B, 0xB1, 0x86, 0x88, 0x04, 0x90, 0xB2, 0xD1,
+    0x47, 0xB8, 0xA6, 0xB0, 0x24, 0xA0, 0x26, 0xB0, 0x2D, 0xE9, 0x88, 0xF0, 0x45, 0xB0, 0x86, 0xD0, 0x6F, 0xF9, 0x05, 0xE8, 0x88, 0xD8, 0xA9, 0xE8, 0xA9, 0xF0, 0x92, 0xF9, 0xC9, 0xF8, 0xC9, 0xF8, 0x8A, 0xF8, 0x05, 0xF0, 0x52, 0xFA, 0x2B, 0xF9, 0xB0, 0xFB, 0x14, 0xFE, 0x68, 0xF0, 0x51, 0xFC, 0xCD, 0xFA, 0x48, 0xF1, 0x88, 0xF8, 0xE8, 0xF8, 0xCE, 0xFB, 0x89, 0xF9, 0xF2, 0xFD, 0xED, 0xFA,
+    0x4E, 0xFB, 0x8B, 0xF3, 0x68, 0xE9, 0x73, 0xFE, 0x29, 0xF9, 0x92, 0xFC, 0x2C, 0xFB, 0x49, 0xF1, 0x4C, 0xFB, 0x0C, 0xFA, 0x8F, 0xFB, 0x4B, 0xF9, 0x6C, 0xF9, 0x4C, 0xF9, 0xCC, 0xF8, 0xEC, 0xF8, 0x84, 0x38, 0x08, 0x89, 0x22, 0x40, 0x23, 0x38, 0x43, 0x48, 0xE8, 0x60, 0x43, 0x48, 0xAA, 0x81, 0x64, 0x50, 0x23, 0x40, 0xC8, 0x68, 0xA7, 0x68, 0x02, 0x40, 0x43, 0x50, 0x49, 0xB1, 0x4C, 0xA9,
+    0x22, 0x40, 0x03, 0x50, 0x66, 0x68, 0x25, 0x78, 0x24, 0x78, 0xAA, 0xC9, 0x03, 0x70, 0x03, 0x68, 0x29, 0xB9, 0x26, 0x88, 0x24, 0x80, 0x25, 0x88, 0x87, 0x88, 0xC8, 0x98, 0x25, 0x98, 0x03, 0x88, 0x48, 0xC8, 0x24, 0xA0, 0x24, 0x98, 0x45, 0xC0, 0xCB, 0xD8, 0x87, 0xE0, 0x24, 0xB0, 0x25, 0xD0, 0x4D, 0xF9, 0x26, 0xE8, 0x24, 0xD8, 0xA7, 0xF8, 0xD0, 0xFA, 0x04, 0xF0, 0x25, 0xE8, 0x67, 0xF8,
+    0x47, 0xF8, 0x26, 0xF8, 0x06, 0xF8, 0x28, 0xF0, 0x0F, 0xFB, 0x07, 0xF8, 0xC9, 0xF8, 0x4D, 0xF4, 0x73, 0xFF, 0x0A, 0xF3, 0xAA, 0xF9, 0x29, 0xF9, 0x2B, 0xFB, 0x4F, 0xFD, 0xB0, 0xFD, 0x0D, 0xFC, 0x2D, 0xFB, 0x6E, 0xFC, 0xAE, 0xFD, 0x72, 0xFE, 0xCA, 0xF9, 0x2D, 0xFB, 0x72, 0xFD, 0x2C, 0xFC, 0x2B, 0xF3, 0xAB, 0xF1, 0xEC, 0xF9, 0x4D, 0xF3, 0x4E, 0xF4, 0x6C, 0xFA, 0x8C, 0xF9, 0x0C, 0xF9,
+    0x84, 0x48, 0x23, 0x48, 0x43, 0x38, 0x22, 0x38, 0x44, 0x48, 0xA7, 0x60, 0x43, 0x48, 0x06, 0x69, 0xE5, 0x58, 0x64, 0x48, 0x09, 0x89, 0x64, 0x48, 0x43, 0x48, 0x68, 0x79, 0x09, 0xA1, 0xCE, 0xA1, 0x22, 0x40, 0x86, 0x68, 0xA8, 0x78, 0x03, 0x70, 0x92, 0xC1, 0x49, 0xB1, 0x66, 0x88, 0xCA, 0xA0, 0xC6, 0xB8, 0x26, 0x90, 0x03, 0x70, 0xEC, 0xA8, 0x45, 0x90, 0x24, 0x80, 0x86, 0xA8, 0x04, 0x88,
+    0x26, 0xC8, 0x04, 0xA0, 0x65, 0xA0, 0x24, 0xB8, 0xEA, 0xE0, 0x67, 0xE0, 0x24, 0xB0, 0x45, 0xC8, 0x4C, 0xF9, 0x07, 0xE0, 0x04, 0xD8, 0x66, 0xF0, 0x88, 0xE8, 0x05, 0xF8, 0x89, 0xE8, 0x67, 0xF8, 0xC9, 0xF8, 0x0C, 0xF9, 0x05, 0xF8, 0xB5, 0xFC, 0xA9, 0xF8, 0x4D, 0xF9, 0xC8, 0xE8, 0x4F, 0xFE, 0xFF, 0xFF, 0xAF, 0xFC, 0x09, 0xEA, 0xEA, 0xF9, 0x93, 0xFF, 0xFF, 0xFF, 0xD2, 0xFE, 0xEC, 0xFB,
+    0x6C, 0xFB, 0x8D, 0xFC, 0xFF, 0xFF, 0xD1, 0xFE, 0x4A, 0xFA, 0x0B, 0xFA, 0xF3, 0xFE, 0xFF, 0xFF, 0x2F, 0xFD, 0xEB, 0xF9, 0x6A, 0xF9, 0xAC, 0xF3, 0xFF, 0xFF, 0x2F, 0xFC, 0x2D, 0xFA, 0x4C, 0xF9, 0x43, 0x38, 0x43, 0x40, 0x84, 0x40, 0x22, 0x38, 0x22, 0x38, 0x02, 0x38, 0xC5, 0x58, 0x84, 0x50, 0xE7, 0x68, 0x43, 0x40, 0x64, 0x60, 0x43, 0x48, 0x43, 0x48, 0x08, 0x79, 0xC6, 0xA0, 0x02, 0x48,
+    0x84, 0x58, 0x03, 0x50, 0x44, 0x68, 0x24, 0x68, 0x03, 0x70, 0xD0, 0x99, 0x4C, 0xA9, 0x45, 0x80, 0x85, 0x98, 0x23, 0x78, 0xA6, 0x90, 0x09, 0xA9, 0x45, 0x88, 0x24, 0x80, 0x24, 0x88, 0x2D, 0xC1, 0x86, 0xD8, 0x24, 0xA0, 0x65, 0xA8, 0x45, 0xB8, 0x6D, 0xF9, 0x66, 0xD8, 0x44, 0xB0, 0x05, 0xD0, 0xAA, 0xE0, 0x86, 0xF0, 0x04, 0xD8, 0x04, 0xE8, 0x87, 0xE0, 0x4D, 0xF9, 0x05, 0xE8, 0x26, 0xF8,
+    0x67, 0xF8, 0x88, 0xF8, 0x06, 0xF8, 0x09, 0xEA, 0xEC, 0xF9, 0x07, 0xF0, 0x0D, 0xFA, 0x49, 0xF2, 0xEC, 0xFB, 0x4A, 0xFA, 0x09, 0xF9, 0x49, 0xF9, 0xCA, 0xFA, 0xAF, 0xFD, 0xAB, 0xFB, 0x6A, 0xF2, 0x4A, 0xFA, 0x8A, 0xFA, 0x8D, 0xFC, 0xCC, 0xF3, 0xCA, 0xF9, 0xA9, 0xF9, 0xCC, 0xFB, 0xAE, 0xFC, 0xEB, 0xFA, 0xCB, 0xF9, 0x2C, 0xF9, 0xCB, 0xF9, 0x0D, 0xFB, 0x0C, 0xFA, 0x8C, 0xF9, 0x0C, 0xF9,
+    0x63, 0x40, 0x43, 0x40, 0x42, 0x38, 0x85, 0x50, 0x22, 0x38, 0x22, 0x38, 0x84, 0x50, 0x22, 0x40, 0x03, 0x48, 0x02, 0x38, 0x64, 0x60, 0x42, 0x40, 0x85, 0x60, 0x26, 0x71, 0xE6, 0x88, 0xA6, 0x70, 0x65, 0x58, 0x23, 0x50, 0x23, 0x58, 0x44, 0x78, 0x45, 0x78, 0x49, 0xA1, 0x45, 0x80, 0x03, 0x68, 0xA8, 0xA0, 0x23, 0x78, 0x26, 0x90, 0x03, 0x70, 0xE9, 0xA8, 0x03, 0x78, 0x03, 0x98, 0x24, 0x90,
+    0xA8, 0xC8, 0x03, 0x98, 0x24, 0x98, 0x24, 0xB0, 0xA8, 0xD0, 0x66, 0xD8, 0x24, 0xB8, 0x66, 0xD8, 0x66, 0xD0, 0x45, 0xE0, 0x24, 0xE0, 0x04, 0xE8, 0x26, 0xE8, 0x05, 0xE8, 0x05, 0xF0, 0x05, 0xF8, 0x26, 0xF0, 0x26, 0xF8, 0x47, 0xF8, 0x0B, 0xFA, 0xEC, 0xF9, 0x07, 0xF8, 0x67, 0xE0, 0xC8, 0xF8, 0x68, 0xF9, 0xA9, 0xF9, 0xA8, 0xF8, 0x28, 0xF9, 0xA9, 0xF9, 0xEA, 0xF9, 0xE8, 0xF1, 0xCC, 0xFA,
+    0x69, 0xF1, 0xCA, 0xF9, 0xC8, 0xF1, 0xC9, 0xF1, 0x89, 0xF9, 0x4B, 0xFA, 0xE9, 0xF1, 0xAA, 0xF9, 0x0D, 0xFB, 0x8B, 0xF9, 0x49, 0xE9, 0x2C, 0xFA, 0x8B, 0xF9, 0x4B, 0xF9, 0x4B, 0xF9, 0x0B, 0xF9, 0x22, 0x30, 0x48, 0x69, 0xC7, 0x58, 0xC9, 0x89, 0x22, 0x38, 0x42, 0x38, 0x29, 0x71, 0xA6, 0x68, 0x02, 0x40, 0x01, 0x38, 0x22, 0x40, 0x2B, 0x81, 0x03, 0x48, 0x06, 0x71, 0xE6, 0x90, 0xE8, 0x80,
+    0x0C, 0x91, 0x02, 0x48, 0x85, 0x68, 0xA7, 0x90, 0x03, 0x60, 0x2D, 0xA9, 0x44, 0x78, 0x23, 0x68, 0x04, 0x88, 0x65, 0x90, 0x4F, 0xC1, 0x03, 0x70, 0x24, 0x88, 0x86, 0xA0, 0x03, 0x90, 0xB0, 0xE9, 0x66, 0xC0, 0x03, 0x98, 0x44, 0x98, 0x04, 0xA8, 0xAA, 0xE8, 0x45, 0xD0, 0x44, 0xB8, 0x25, 0xD0, 0xCC, 0xF0, 0x25, 0xE8, 0x04, 0xD8, 0x04, 0xE0, 0xC9, 0xF8, 0x91, 0xF9, 0x05, 0xF0, 0x88, 0xF8,
+    0xCA, 0xF8, 0x06, 0xF8, 0x30, 0xFA, 0x6C, 0xFA, 0xC9, 0xE8, 0x07, 0xF8, 0x08, 0xE9, 0xF2, 0xFC, 0xCA, 0xF9, 0x49, 0xF9, 0x09, 0xF1, 0xEF, 0xFB, 0x88, 0xF9, 0x8B, 0xFA, 0x88, 0xE9, 0xAA, 0xF9, 0xD0, 0xFC, 0xEB, 0xFA, 0x4A, 0xFA, 0xC9, 0xF9, 0x89, 0xF1, 0x10, 0xFD, 0xE9, 0xF1, 0x0A, 0xFA, 0xA9, 0xF9, 0x6B, 0xFA, 0x56, 0xFF, 0x6C, 0xFA, 0x0B, 0xFA, 0xAC, 0xF9, 0x6C, 0xF9, 0x4B, 0xF9,
+    0x07, 0x61, 0x63, 0x48, 0x42, 0x38, 0x27, 0x69, 0x93, 0xC3, 0x29, 0x79, 0x22, 0x40, 0x42, 0x40, 0x83, 0x50, 0x07, 0x69, 0xC8, 0x70, 0xC5, 0x60, 0x22, 0x40, 0x64, 0x58, 0x6A, 0xA1, 0x6B, 0x89, 0x23, 0x48, 0x86, 0x60, 0x85, 0x68, 0x85, 0x78, 0x02, 0x58, 0x45, 0x80, 0x64, 0x70, 0x2C, 0xA9, 0x87, 0x88, 0x27, 0x90, 0x24, 0x78, 0x2B, 0xB1, 0x86, 0x90, 0x24, 0x80, 0x03, 0x88, 0x25, 0x98,
+    0x86, 0xC8, 0x03, 0x90, 0x03, 0x98, 0xA7, 0xD0, 0xEA, 0xE8, 0x66, 0xD8, 0x24, 0xB0, 0x46, 0xE0, 0x0B, 0xF9, 0x87, 0xF0, 0x24, 0xD8, 0x05, 0xE8, 0x26, 0xE0, 0x09, 0xF9, 0x05, 0xF8, 0x06, 0xF8, 0x04, 0xF0, 0xAA, 0xF8, 0x46, 0xF8, 0x13, 0xFD, 0x27, 0xF0, 0x2D, 0xF9, 0x0D, 0xFB, 0x8D, 0xFC, 0xF1, 0xFE, 0xAB, 0xFA, 0xE7, 0xE1, 0x0A, 0xFA, 0x2C, 0xFC, 0x4E, 0xFD, 0x8A, 0xE3, 0x0A, 0xFA,
+    0x4A, 0xFA, 0x6B, 0xF4, 0x51, 0xFE, 0xA9, 0xF2, 0x2A, 0xFA, 0xAA, 0xFA, 0xCE, 0xFD, 0x4E, 0xFD, 0xEA, 0xF2, 0x0B, 0xFA, 0x14, 0xFF, 0xF8, 0xFF, 0x94, 0xFF, 0xAC, 0xFA, 0xCC, 0xF9, 0x6B, 0xF9, 0x22, 0x30, 0x22, 0x38, 0x22, 0x30, 0xE5, 0x58, 0x02, 0x38, 0x02, 0x38, 0x63, 0x48, 0x22, 0x38, 0xE5, 0x70, 0x67, 0x79, 0x2A, 0x81, 0x23, 0x48, 0x01, 0x40, 0x23, 0x50, 0x06, 0x99, 0xAE, 0x99,
+    0x23, 0x48, 0x23, 0x50, 0x22, 0x48, 0x02, 0x58, 0x4F, 0xC1, 0x65, 0x78, 0x85, 0x80, 0x23, 0x68, 0x24, 0x80, 0x25, 0x88, 0x23, 0x78, 0x44, 0x78, 0x03, 0x80, 0x24, 0x80, 0x86, 0xA0, 0x23, 0x90, 0xEC, 0xF9, 0x24, 0xA0, 0x03, 0x98, 0x24, 0xB8, 0x67, 0xC8, 0x24, 0xC0, 0x44, 0xB8, 0x66, 0xD8, 0xC9, 0xF0, 0x05, 0xF0, 0x24, 0xD8, 0x86, 0xF8, 0x26, 0xF0, 0x04, 0xF0, 0x05, 0xE8, 0x26, 0xF8,
+    0x06, 0xF0, 0x26, 0xF8, 0x26, 0xF8, 0xF0, 0xFB, 0xA9, 0xF8, 0x28, 0xF8, 0xCA, 0xF9, 0xF1, 0xFE, 0xFF, 0xFF, 0x8B, 0xFB, 0xED, 0xF3, 0x0A, 0xFA, 0xB3, 0xFF, 0xFF, 0xFF, 0x8D, 0xFC, 0x4A, 0xFA, 0x89, 0xFA, 0x2F, 0xFE, 0xFF, 0xFF, 0x8D, 0xFC, 0x4A, 0xFA, 0xCA, 0xF2, 0x94, 0xFF, 0xFF, 0xFF, 0x6D, 0xFC, 0x6B, 0xFA, 0x0B, 0xFB, 0x12, 0xFF, 0xFF, 0xFF, 0x4C, 0xFB, 0xEC, 0xF9, 0x4B, 0xF9,
+    0x43, 0x38, 0x23, 0x40, 0x22, 0x38, 0xA5, 0x58, 0x22, 0x40, 0x22, 0x38, 0x02, 0x40, 0x22, 0x38, 0x25, 0x58, 0x68, 0x81, 0x84, 0x50, 0x84, 0x50, 0x23, 0x48, 0x09, 0x89, 0x27, 0x91, 0x02, 0x40, 0x03, 0x48, 0x2A, 0x91, 0x23, 0x50, 0x23, 0x60, 0x02, 0x60, 0x23, 0x70, 0x0D, 0xA9, 0x23, 0x68, 0x23, 0x78, 0x23, 0x70, 0x02, 0x68, 0x03, 0x78, 0x03, 0x88, 0x23, 0x80, 0x03, 0x88, 0x4E, 0xD9,
+    0xA6, 0xC8, 0x03, 0x98, 0x24, 0x98, 0x03, 0xA8, 0x04, 0xB0, 0x24, 0xB8, 0x24, 0xB8, 0x66, 0xD8, 0x4D, 0xF9, 0x66, 0xE8, 0x24, 0xD8, 0x45, 0xF0, 0x05, 0xF0, 0x90, 0xF9, 0x25, 0xF8, 0x05, 0xF8, 0x05, 0xF0, 0x2C, 0xF9, 0x06, 0xF8, 0xCB, 0xF9, 0x06, 0xF8, 0x28, 0xF8, 0xAF, 0xFA, 0x4A, 0xFA, 0x4A, 0xFB, 0xC9, 0xF9, 0xCD, 0xFA, 0x49, 0xF9, 0x4B, 0xFB, 0xCF, 0xFD, 0xAA, 0xFA, 0xEE, 0xFB,
+    0xE9, 0xF9, 0xED, 0xFB, 0xCD, 0xFC, 0x0E, 0xFC, 0x89, 0xF9, 0x4F, 0xFC, 0x8C, 0xFB, 0xEC, 0xFB, 0x0D, 0xFC, 0x8A, 0xF9, 0xAB, 0xF9, 0x8B, 0xFA, 0x2D, 0xFB, 0x0B, 0xFA, 0x4B, 0xF9, 0x0B, 0xF9, 0x01, 0x38, 0x43, 0x48, 0x22, 0x40, 0x01, 0x40, 0xC5, 0x60, 0x42, 0x40, 0x22, 0x38, 0xF6, 0xB3, 0x63, 0x50, 0x84, 0x60, 0x23, 0x40, 0x45, 0x60, 0x01, 0x40, 0x02, 0x48, 0x84, 0x70, 0xA7, 0x78,
+    0x02, 0x48, 0x23, 0x50, 0x23, 0x50, 0x85, 0x78, 0x03, 0x58, 0xC7, 0x80, 0x45, 0x80, 0x02, 0x60, 0x24, 0x90, 0x03, 0x70, 0x0B, 0xA9, 0x02, 0x70, 0x86, 0x98, 0x03, 0x80, 0x03, 0x88, 0xEA, 0xC0, 0xAC, 0xF1, 0x03, 0x98, 0x03, 0x90, 0x24, 0xB0, 0xA9, 0xE0, 0x04, 0xC8, 0x65, 0xC0, 0x04, 0xD0, 0xC9, 0xF8, 0x46, 0xE0, 0x04, 0xD8, 0x05, 0xE8, 0x69, 0xF0, 0xD2, 0xF9, 0x05, 0xF8, 0x25, 0xF8,
+    0xAA, 0xF8, 0x25, 0xF8, 0x48, 0xF0, 0x4A, 0xF9, 0x69, 0xF8, 0x07, 0xF8, 0x89, 0xF8, 0x68, 0xF8, 0x09, 0xF9, 0x09, 0xF9, 0xAB, 0xF9, 0x48, 0xE1, 0xCA, 0xF9, 0x09, 0xFA, 0xE9, 0xF9, 0x69, 0xF9, 0x4A, 0xF2, 0x2B, 0xFB, 0xEA, 0xF9, 0x8A, 0xF9, 0xCA, 0xF9, 0xB0, 0xFD, 0x6E, 0xFB, 0xAA, 0xF9, 0x4D, 0xFB, 0xC9, 0xF1, 0x8A, 0xF9, 0x6A, 0xF9, 0x6B, 0xF9, 0x2A, 0xF9, 0x2B, 0xF9, 0xEA, 0xF0,
+    0x02, 0x40, 0xC7, 0x60, 0x22, 0x38, 0x02, 0x40, 0xC6, 0x70, 0xC5, 0x50, 0x03, 0x40, 0x01, 0x38, 0x01, 0x38, 0x43, 0x58, 0x84, 0x50, 0x4A, 0x81, 0x02, 0x40, 0x02, 0x48, 0xE6, 0x80, 0x01, 0x40, 0x2B, 0x99, 0x02, 0x48, 0x02, 0x48, 0x02, 0x50, 0x22, 0x58, 0x8D, 0xA9, 0x02, 0x60, 0xE9, 0xA0, 0x02, 0x70, 0x02, 0x68, 0xEF, 0xD1, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x88, 0x04, 0x88,
+    0xA6, 0xC0, 0x43, 0x98, 0x23, 0x98, 0x03, 0xA8, 0x46, 0xC8, 0x03, 0xB8, 0x04, 0xC0, 0x25, 0xD0, 0xA9, 0xF0, 0x04, 0xE0, 0x04, 0xD8, 0x66, 0xF0, 0x04, 0xE8, 0x90, 0xF9, 0x04, 0xF8, 0x25, 0xF8, 0x66, 0xF8, 0x06, 0xF8, 0xF0, 0xF9, 0xA7, 0xF8, 0x06, 0xF8, 0x2A, 0xF8, 0x68, 0xF8, 0xCD, 0xFA, 0x29, 0xF9, 0xAB, 0xF9, 0xEA, 0xF9, 0x29, 0xF9, 0xA8, 0xF9, 0x09, 0xFA, 0x88, 0xF9, 0x49, 0xF9,
+    0xB0, 0xFD, 0xEB, 0xF3, 0xE9, 0xF9, 0x89, 0xF9, 0x8A, 0xF9, 0x2F, 0xFD, 0xCB, 0xFA, 0xAA, 0xF9, 0x2B, 0xFA, 0x09, 0xF9, 0xE9, 0xF1, 0x4B, 0xFA, 0xAA, 0xF1, 0xEA, 0xF8, 0xCA, 0xF8, 0xA9, 0xF0, 0x86, 0x68, 0x01, 0x38, 0x02, 0x38, 0x02, 0x40, 0x22, 0x40, 0x4A, 0x81, 0x01, 0x30, 0x01, 0x38, 0x01, 0x38, 0x85, 0x58, 0xA8, 0x70, 0x22, 0x40, 0x01, 0x38, 0x02, 0x48, 0x65, 0x70, 0x6C, 0xA1,
+    0x02, 0x48, 0x23, 0x48, 0x02, 0x48, 0x23, 0x50, 0x24, 0x60, 0x01, 0x50, 0x02, 0x68, 0x86, 0x88, 0x23, 0x68, 0x6B, 0xA9, 0x02, 0x68, 0x25, 0x88, 0x03, 0x78, 0x23, 0x80, 0x2A, 0xB1, 0x03, 0x80, 0xE7, 0xC8, 0x23, 0x98, 0x23, 0xA0, 0x67, 0xC8, 0x05, 0xB0, 0x23, 0xB0, 0x03, 0xB0, 0x04, 0xC8, 0x48, 0xF0, 0x25, 0xE0, 0x04, 0xD0, 0x45, 0xE8, 0x04, 0xE8, 0x06, 0xF0, 0x04, 0xF8, 0x25, 0xF8,
+    0x87, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x26, 0xE8, 0x06, 0xF8, 0x69, 0xF8, 0x08, 0xF0, 0x6F, 0xF5, 0x92, 0xFE, 0x0A, 0xFA, 0xA9, 0xF9, 0xAA, 0xF9, 0xAE, 0xFD, 0x6F, 0xFE, 0x6A, 0xFA, 0x89, 0xF9, 0x8A, 0xEB, 0x93, 0xFF, 0xF2, 0xFE, 0x29, 0xFA, 0xEA, 0xF9, 0x71, 0xFE, 0xFE, 0xFF, 0xCD, 0xFC, 0x2C, 0xFB, 0x6A, 0xF9, 0x4A, 0xE3, 0xFF, 0xFF, 0xB2, 0xFE, 0x0B, 0xFA, 0x4B, 0xF9, 0x4A, 0xF9,
+    0x01, 0x28, 0x02, 0x40, 0x02, 0x40, 0x01, 0x40, 0x44, 0x58, 0x08, 0x71, 0x01, 0x40, 0x01, 0x38, 0x23, 0x40, 0x02, 0x48, 0xA6, 0x60, 0x22, 0x40, 0xA5, 0x68, 0xC7, 0x80, 0x22, 0x58, 0x6C, 0xA1, 0x22, 0x48, 0x02, 0x48, 0xE6, 0x70, 0x02, 0x50, 0xCE, 0xC1, 0x03, 0x58, 0xCA, 0x98, 0x64, 0x78, 0x02, 0x68, 0x02, 0x78, 0x02, 0x68, 0xC9, 0xB8, 0x02, 0x70, 0x44, 0x88, 0xC7, 0xA0, 0x8A, 0xB8,
+    0xA6, 0xD0, 0x02, 0x90, 0x03, 0x90, 0x24, 0xA8, 0x87, 0xD0, 0x03, 0xB0, 0x03, 0xA8, 0x24, 0xD0, 0xAA, 0xF8, 0x04, 0xD8, 0x04, 0xD8, 0x25, 0xE0, 0x04, 0xE8, 0xAA, 0xF8, 0x04, 0xF8, 0x05, 0xF8, 0x05, 0xF8, 0xAB, 0xF8, 0x26, 0xF0, 0x47, 0xF8, 0x06, 0xF8, 0x47, 0xF8, 0xCC, 0xF1, 0xF0, 0xFD, 0xFF, 0xFF, 0x8B, 0xFA, 0xAD, 0xFA, 0xCC, 0xFA, 0xF3, 0xFF, 0xFF, 0xFF, 0xCC, 0xFB, 0x0C, 0xFB,
+    0xAE, 0xFC, 0x72, 0xFF, 0xFF, 0xFF, 0xED, 0xFB, 0x4B, 0xFA, 0x09, 0xF2, 0xF6, 0xFF, 0xFF, 0xFF, 0xEC, 0xFA, 0x0A, 0xF9, 0xEA, 0xF9, 0xF2, 0xFE, 0xD1, 0xFE, 0xEA, 0xF9, 0xCA, 0xF8, 0xAA, 0xF8, 0x22, 0x38, 0x01, 0x38, 0x02, 0x38, 0x01, 0x40, 0x02, 0x48, 0x01, 0x40, 0x01, 0x40, 0x01, 0x38, 0x01, 0x38, 0xA5, 0x68, 0x02, 0x38, 0x02, 0x40, 0x22, 0x48, 0x63, 0x58, 0x22, 0x58, 0x01, 0x40,
+    0x22, 0x40, 0x02, 0x48, 0x43, 0x48, 0x02, 0x50, 0x02, 0x50, 0x22, 0x58, 0x43, 0x70, 0x02, 0x60, 0x23, 0x70, 0x02, 0x70, 0x03, 0x70, 0x02, 0x70, 0x03, 0x78, 0x03, 0x78, 0x03, 0x80, 0x03, 0x88, 0xC7, 0xC8, 0x03, 0xA0, 0x44, 0x98, 0x03, 0xA0, 0x23, 0xA8, 0x03, 0xA8, 0x03, 0xB0, 0x25, 0xC8, 0x03, 0xC0, 0x24, 0xD0, 0x45, 0xD8, 0x25, 0xE0, 0x04, 0xE8, 0x05, 0xF8, 0x05, 0xF8, 0x25, 0xF8,
+    0xC8, 0xF8, 0x05, 0xF0, 0x26, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x27, 0xF0, 0xE9, 0xF8, 0x8A, 0xF9, 0xC9, 0xF8, 0x68, 0xF0, 0x09, 0xF9, 0xA9, 0xF2, 0x0B, 0xFC, 0xC9, 0xF9, 0xC9, 0xF8, 0xAE, 0xFB, 0x69, 0xF2, 0x6A, 0xFA, 0x89, 0xF9, 0xA8, 0xF0, 0xE9, 0xF8, 0x4A, 0xFA, 0x0E, 0xFC, 0xC8, 0xF8, 0x49, 0xF8, 0x2A, 0xF9, 0xCB, 0xF9, 0x4F, 0xFC, 0xCA, 0xF8, 0x4A, 0xF8, 0x2A, 0xF8,
+    0x42, 0x30, 0x84, 0x58, 0x88, 0x70, 0x02, 0x40, 0x01, 0x38, 0x01, 0x38, 0x6E, 0xB2, 0xC8, 0x78, 0x01, 0x30, 0x07, 0x79, 0x22, 0x40, 0x23, 0x48, 0x29, 0x89, 0xC5, 0x60, 0x01, 0x48, 0x02, 0x40, 0x85, 0x60, 0x02, 0x48, 0x02, 0x48, 0x02, 0x50, 0x02, 0x58, 0xEA, 0xA0, 0x86, 0x98, 0x02, 0x60, 0x85, 0x88, 0xC6, 0x98, 0xCA, 0xB0, 0x23, 0x78, 0x03, 0x78, 0x24, 0x80, 0x65, 0x90, 0xEB, 0xD8,
+    0x24, 0xA8, 0x04, 0xA0, 0x23, 0x90, 0x05, 0xA8, 0x45, 0xC0, 0x03, 0xB0, 0x24, 0xB0, 0x26, 0xC8, 0xEB, 0xF8, 0x02, 0xC0, 0x03, 0xC8, 0x04, 0xD0, 0x04, 0xE8, 0x8B, 0xF8, 0x05, 0xF8, 0x66, 0xF8, 0xA8, 0xF8, 0x06, 0xF0, 0x4C, 0xF8, 0x06, 0xF8, 0x05, 0xF8, 0x06, 0xF8, 0x6A, 0xE9, 0x08, 0xF8, 0x68, 0xF8, 0x07, 0xF8, 0x2C, 0xFA, 0x4D, 0xFB, 0x49, 0xF9, 0xE8, 0xF8, 0x68, 0xF0, 0xA9, 0xF8,
+    0x8F, 0xFC, 0x49, 0xF1, 0x09, 0xF9, 0xA8, 0xF8, 0x0A, 0xFA, 0x88, 0xF8, 0xE9, 0xF8, 0x28, 0xF8, 0x67, 0xE8, 0xEC, 0xFA, 0x29, 0xF1, 0xC9, 0xF8, 0xEE, 0xFB, 0x49, 0xF8, 0x2A, 0xF8, 0x8A, 0xF8, 0x21, 0x30, 0x63, 0x48, 0x22, 0x40, 0x01, 0x38, 0x00, 0x30, 0x02, 0x40, 0x01, 0x40, 0x01, 0x38, 0x01, 0x38, 0x01, 0x40, 0x02, 0x40, 0x01, 0x38, 0x84, 0x58, 0x43, 0x48, 0x22, 0x48, 0x43, 0x48,
+    0x02, 0x48, 0x43, 0x50, 0x02, 0x48, 0x22, 0x50, 0x23, 0x50, 0x23, 0x58, 0x02, 0x60, 0x23, 0x60, 0x23, 0x68, 0x65, 0x80, 0x03, 0x68, 0x03, 0x70, 0x03, 0x78, 0x04, 0x88, 0x03, 0x88, 0x03, 0x88, 0xC7, 0xB8, 0x64, 0x98, 0x24, 0x98, 0x24, 0xA0, 0x03, 0xA0, 0x24, 0xB0, 0x24, 0xB0, 0x04, 0xB8, 0x04, 0xC0, 0x04, 0xC8, 0x24, 0xC8, 0x25, 0xD0, 0x05, 0xE0, 0x04, 0xE8, 0x04, 0xE8, 0x25, 0xF8,
+    0x46, 0xF8, 0x25, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x8B, 0xF3, 0xE9, 0xF9, 0xC9, 0xF8, 0x08, 0xF8, 0x07, 0xF8, 0x46, 0xE0, 0x89, 0xF9, 0xA9, 0xF9, 0x68, 0xF8, 0x07, 0xF0, 0xC7, 0xE1, 0x89, 0xF2, 0x89, 0xF9, 0xA8, 0xF0, 0x49, 0xF8, 0x29, 0xF9, 0xCA, 0xF9, 0x66, 0xF0, 0x08, 0xF8, 0x49, 0xF8, 0xAA, 0xF9, 0x6B, 0xFA, 0x71, 0xFD, 0x09, 0xF8, 0x09, 0xF8, 0x09, 0xF8,
+    0x66, 0x70, 0xC5, 0x50, 0x01, 0x30, 0xA9, 0x89, 0x02, 0x40, 0xC7, 0x70, 0x01, 0x40, 0x02, 0x40, 0x01, 0x40, 0x01, 0x38, 0x4A, 0x91, 0x02, 0x48, 0x23, 0x68, 0x22, 0x48, 0x22, 0x48, 0xE9, 0x98, 0xA5, 0x60, 0x02, 0x40, 0x23, 0x48, 0x02, 0x58, 0x65, 0x60, 0xE7, 0x90, 0x02, 0x60, 0x03, 0x60, 0x03, 0x70, 0x44, 0x88, 0xE8, 0xA0, 0x03, 0x78, 0x44, 0x80, 0x45, 0x88, 0x88, 0xA0, 0x03, 0x90,
+    0xE7, 0xB0, 0x24, 0x90, 0x44, 0x98, 0x86, 0xB8, 0x87, 0xC0, 0x44, 0xA8, 0x45, 0xB0, 0x65, 0xC0, 0xE8, 0xE8, 0xA7, 0xD8, 0x05, 0xC8, 0x04, 0xD0, 0x04, 0xD8, 0x49, 0xF8, 0x04, 0xE8, 0x04, 0xE8, 0x46, 0xF8, 0x05, 0xF8, 0x2F, 0xFA, 0x05, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x4B, 0xFA, 0xFF, 0xFF, 0xB6, 0xFF, 0xA8, 0xF8, 0x07, 0xF8, 0x09, 0xEA, 0xFF, 0xFF, 0x92, 0xFE, 0x69, 0xF9, 0x69, 0xF8,
+    0x87, 0xE1, 0xFF, 0xFF, 0x6E, 0xF5, 0x2C, 0xFB, 0x2B, 0xFA, 0x6F, 0xFC, 0xFF, 0xFF, 0x2E, 0xF5, 0x08, 0xF1, 0x48, 0xF8, 0x6C, 0xFB, 0xFF, 0xFF, 0xB3, 0xFF, 0xAB, 0xF9, 0x29, 0xF8, 0x09, 0xF8, 0x01, 0x38, 0x43, 0x40, 0x22, 0x30, 0x01, 0x30, 0x01, 0x38, 0x22, 0x40, 0x02, 0x48, 0x01, 0x40, 0x02, 0x40, 0x01, 0x40, 0x86, 0x60, 0x01, 0x40, 0x02, 0x48, 0x02, 0x50, 0x02, 0x48, 0x23, 0x50,
+    0x43, 0x48, 0x22, 0x48, 0x22, 0x48, 0x23, 0x50, 0x03, 0x60, 0x23, 0x58, 0x03, 0x58, 0x23, 0x60, 0x03, 0x70, 0x85, 0x88, 0x03, 0x68, 0x24, 0x80, 0x24, 0x78, 0x24, 0x80, 0x03, 0x80, 0x24, 0x88, 0x85, 0xA0, 0x24, 0x88, 0x44, 0x98, 0x03, 0x90, 0x44, 0xA0, 0x03, 0xA8, 0x45, 0xB0, 0x04, 0xB0, 0x24, 0xB8, 0x04, 0xC0, 0x04, 0xC0, 0x05, 0xC8, 0x02, 0xC8, 0x04, 0xD8, 0x04, 0xE8, 0x05, 0xF0,
+    0x04, 0xF8, 0x87, 0xF8, 0x05, 0xF8, 0x05, 0xF8, 0x06, 0xF8, 0x27, 0xF8, 0xCA, 0xF8, 0xCF, 0xFD, 0x8F, 0xFD, 0x88, 0xF8, 0x07, 0xF8, 0xAB, 0xFA, 0xD4, 0xFF, 0xFF, 0xFF, 0xE9, 0xF9, 0x08, 0xF8, 0xC8, 0xF0, 0xB1, 0xFE, 0x4E, 0xF5, 0xCB, 0xF9, 0x29, 0xF8, 0x4A, 0xF9, 0xFB, 0xFF, 0xAF, 0xFD, 0x48, 0xF8, 0x28, 0xF8, 0x69, 0xF9, 0x50, 0xFE, 0x2E, 0xFD, 0x8A, 0xF8, 0x09, 0xF8, 0x09, 0xF8,
+    0x01, 0x28, 0x63, 0x40, 0x22, 0x30, 0x01, 0x30, 0x02, 0x38, 0x01, 0x38, 0x02, 0x40, 0x01, 0x40, 0x02, 0x40, 0x02, 0x48, 0x43, 0x48, 0x01, 0x40, 0x02, 0x48, 0x22, 0x58, 0x03, 0x50, 0x02, 0x48, 0x02, 0x48, 0x23, 0x48, 0x02, 0x40, 0x02, 0x48, 0x23, 0x58, 0x02, 0x48, 0x02, 0x58, 0x02, 0x60, 0x02, 0x68, 0x4E, 0xFA, 0x04, 0x78, 0x04, 0x80, 0x04, 0x80, 0x24, 0x78, 0x44, 0x80, 0x45, 0x88,
+    0x0D, 0xF2, 0x04, 0x80, 0x65, 0x90, 0x45, 0x98, 0x65, 0xA0, 0x24, 0xA8, 0x24, 0xA8, 0x66, 0xC0, 0x05, 0xB8, 0x04, 0xC0, 0x05, 0xC8, 0x45, 0xD0, 0x04, 0xD0, 0x24, 0xD8, 0x05, 0xF0, 0x05, 0xF0, 0x05, 0xF8, 0xE8, 0xF8, 0x04, 0xF8, 0x26, 0xF8, 0x06, 0xF8, 0xC9, 0xF8, 0xEA, 0xF8, 0x69, 0xF8, 0x08, 0xF8, 0x28, 0xF8, 0x07, 0xF8, 0x2B, 0xF9, 0xCC, 0xFA, 0xA9, 0xF9, 0x69, 0xF8, 0x07, 0xF8,
+    0x07, 0xF8, 0x88, 0xF8, 0xC8, 0xF8, 0x4C, 0xFA, 0x07, 0xF8, 0x09, 0xF8, 0x4A, 0xF9, 0x2B, 0xFA, 0x09, 0xF8, 0x08, 0xF8, 0x47, 0xF0, 0x08, 0xF0, 0xE9, 0xF8, 0x09, 0xF8, 0x07, 0xF8, 0x08, 0xF8, 0x21, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x38, 0x01, 0x38, 0x01, 0x38, 0x01, 0x38, 0x02, 0x40, 0x01, 0x40, 0x01, 0x40, 0x02, 0x48, 0x02, 0x40, 0x02, 0x48, 0x02, 0x48, 0x02, 0x50, 0x02, 0x50,
+    0x02, 0x48, 0x02, 0x48, 0x23, 0x48, 0x23, 0x50, 0x02, 0x50, 0x02, 0x58, 0x02, 0x60, 0x03, 0x60, 0x23, 0x70, 0x03, 0x70, 0x03, 0x70, 0x23, 0x78, 0x04, 0x80, 0x24, 0x78, 0x03, 0x78, 0x04, 0x80, 0x45, 0x88, 0x86, 0x90, 0x45, 0x90, 0x24, 0x90, 0x45, 0x98, 0x24, 0xA0, 0x24, 0xA8, 0x04, 0xA8, 0x04, 0xB8, 0x04, 0xC0, 0x25, 0xC0, 0x25, 0xC8, 0x45, 0xD8, 0x04, 0xD0, 0x25, 0xE0, 0x25, 0xE8,
+    0x25, 0xF0, 0x29, 0xF9, 0x25, 0xF8, 0x05, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x47, 0xF8, 0x06, 0xF8, 0x06, 0xF8, 0x27, 0xF8, 0x06, 0xF8, 0x68, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x08, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x08, 0xF8, 0x07, 0xF8, 0x49, 0xF8, 0x07, 0xF8, 0x06, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x06, 0xF0, 0x07, 0xF8, 0x07, 0xF8, 0x08, 0xF8,
 };
 const lv_img_dsc_t ui_img_pong_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_pong_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_pong_80_png_data
 };
 
@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Scroller_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_scroller_80_png_data[] = {
-    0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xCB, 0x5A, 0xFF, 0xE4, 0x18, 0xFF, 0x04, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x0C, 0x5B, 0xFF, 0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x25, 0x29, 0xFF, 0xA7, 0x31, 0xFF, 0xE4, 0x20, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x8D, 0x6B, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0xCC, 0x5A, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0xED, 0x5A, 0xFF, 0x25, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0xC4, 0x18, 0xFF, 0x05, 0x21, 0xFF, 0xE4, 0x18, 0xFF, 0xE4, 0x18, 0xFF, 0xC4, 0x18, 0xFF, 0xE5, 0x20, 0xFF, 0x6A, 0x4A, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x2E, 0x5B, 0xFF, 0x25, 0x21, 0xFF, 0xE5, 0x18, 0xFF, 0x05, 0x21, 0xFF, 0xE5, 0x18, 0xFF, 0xE4, 0x18, 0xFF, 0x05, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x26, 0x21, 0xFF, 0x8F, 0x63, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x04, 0x19, 0xFF, 0xE4, 0x18, 0xFF, 0x6B, 0x4A, 0xFF, 0x45, 0x29, 0xFF,
-    0x25, 0x21, 0xFF, 0xC3, 0x18, 0xFF, 0x45, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x0C, 0x5B, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0xCB, 0x52, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x45, 0x21, 0xFF, 0xEB, 0x5A, 0xFF, 0x86, 0x31, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xD3, 0x9C, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x20, 0xFF, 0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0xA7, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x65, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x8A, 0x52, 0xFF, 0xC4, 0x18, 0xFF, 0x05, 0x21, 0xFF, 0xE4, 0x18, 0xFF, 0x4E, 0x6B, 0xFF, 0xC4, 0x18, 0xFF, 0xE4, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0x26, 0x21, 0xFF, 0xD5, 0x94, 0xFF, 0x06, 0x21, 0xFF,
-    0x67, 0x29, 0xFF, 0x67, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x31, 0xFF, 0x04, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x66, 0x31, 0xFF, 0xE4, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xF2, 0x7B, 0xFF, 0xE4, 0x18, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x08, 0x3A, 0xFF, 0x08, 0x42, 0xFF, 0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x03, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x31, 0xFF, 0x04, 0x21, 0xFF, 0xAE, 0x73, 0xFF, 0x25, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0xCF, 0x73, 0xFF, 0x4D, 0x6B, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0xAE, 0x73, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x05, 0x21, 0xFF,
-    0xE4, 0x18, 0xFF, 0xE4, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x18, 0xFF, 0xA8, 0x39, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0xCD, 0x52, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0xAF, 0x6B, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x90, 0x6B, 0xFF, 0x05, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0xF0, 0x7B, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x18, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x86, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x86, 0x29, 0xFF, 0x2C, 0x63, 0xFF, 0xE3, 0x20, 0xFF, 0x8A, 0x52, 0xFF, 0xC7, 0x39, 0xFF, 0x6E, 0x73, 0xFF, 0x2D, 0x63, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0xD3, 0x9C, 0xFF, 0x76, 0xAD, 0xFF, 0x45, 0x29, 0xFF, 0xA6, 0x31, 0xFF, 0xAE, 0x7B, 0xFF, 0x04, 0x21, 0xFF, 0xCC, 0x52, 0xFF,
-    0x45, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x6A, 0x52, 0xFF, 0x08, 0x42, 0xFF, 0x25, 0x29, 0xFF, 0xC3, 0x18, 0xFF, 0x41, 0x08, 0xFF, 0x45, 0x29, 0xFF, 0x8B, 0x52, 0xFF, 0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x08, 0x42, 0xFF, 0x4A, 0x4A, 0xFF, 0x66, 0x29, 0xFF, 0xC3, 0x18, 0xFF, 0x46, 0x29, 0xFF, 0x8B, 0x52, 0xFF, 0x8B, 0x4A, 0xFF, 0x4A, 0x4A, 0xFF, 0xE4, 0x18, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x8B, 0x52, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x31, 0xFF, 0xA8, 0x31, 0xFF, 0xE9, 0x39, 0xFF, 0x4B, 0x42, 0xFF, 0x25, 0x21, 0xFF, 0xC8, 0x18, 0xFF, 0xC4, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0xF5, 0x5A, 0xFF, 0xE4, 0x18, 0xFF, 0xA6, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0xB1, 0x52, 0xFF, 0x26, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0x6E, 0x6B, 0xFF, 0x08, 0x42, 0xFF, 0x66, 0x29, 0xFF, 0xE4, 0x20, 0xFF, 0x0D, 0x63, 0xFF, 0x66, 0x31, 0xFF, 0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0xCC, 0x5A, 0xFF, 0x8D, 0x63, 0xFF, 0x87, 0x31, 0xFF, 0x65, 0x29, 0xFF, 0xA7, 0x31, 0xFF, 0x4D, 0x63, 0xFF, 0xE7, 0x39, 0xFF, 0x86, 0x29, 0xFF, 0x86, 0x31, 0xFF,
-    0x24, 0x21, 0xFF, 0x24, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x25, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x86, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0xC8, 0x39, 0xFF, 0xE4, 0x18, 0xFF, 0xE5, 0x20, 0xFF, 0x25, 0x21, 0xFF, 0xC4, 0x18, 0xFF, 0x46, 0x29, 0xFF, 0xE4, 0x20, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0xE5, 0x18, 0xFF, 0x46, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x26, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x7A, 0xC6, 0xFF, 0x26, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x21, 0xFF,
-    0x04, 0x21, 0xFF, 0xD0, 0x73, 0xFF, 0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x08, 0x3A, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x65, 0x29, 0xFF, 0x45, 0x21, 0xFF, 0xA6, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x8D, 0x6B, 0xFF, 0xEC, 0x5A, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x04, 0x21, 0xFF, 0xF0, 0x7B, 0xFF, 0x6E, 0x6B, 0xFF, 0xA6, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x0C, 0x63, 0xFF, 0x86, 0x31, 0xFF, 0xE7, 0x41, 0xFF, 0x8D, 0x73, 0xFF, 0x45, 0x29, 0xFF, 0xA7, 0x31, 0xFF, 0x65, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x25, 0x21, 0xFF, 0x29, 0x42, 0xFF, 0x86, 0x31, 0xFF, 0x2A, 0x6B, 0xFF, 0x6C, 0x73, 0xFF, 0x05, 0x21, 0xFF, 0xAF, 0x6B, 0xFF, 0x4D, 0x6B, 0xFF, 0xE4, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x4E, 0x63, 0xFF, 0xA7, 0x39, 0xFF, 0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0xE8, 0x39, 0xFF, 0x25, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0xE9, 0x39, 0xFF, 0x66, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0xEE, 0x5A, 0xFF, 0xA7, 0x31, 0xFF,
-    0xC5, 0x18, 0xFF, 0xE9, 0x39, 0xFF, 0x87, 0x29, 0xFF, 0xE9, 0x41, 0xFF, 0x66, 0x29, 0xFF, 0x8A, 0x52, 0xFF, 0x25, 0x29, 0xFF, 0x4F, 0x5B, 0xFF, 0x09, 0x42, 0xFF, 0x66, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x4F, 0x63, 0xFF, 0x25, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x04, 0x21, 0xFF, 0x2A, 0x42, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0xC7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0xD5, 0x52, 0xFF, 0xA7, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0xC7, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0x04, 0x21, 0xFF, 0xC7, 0x39, 0xFF, 0x65, 0x31, 0xFF, 0xB1, 0x94, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x2C, 0x63, 0xFF, 0x8B, 0x52, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x08, 0x42, 0xFF, 0x2D, 0x63, 0xFF, 0x46, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x51, 0x8C, 0xFF, 0xC7, 0x39, 0xFF, 0x66, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x31, 0x84, 0xFF, 0x66, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x8E, 0x6B, 0xFF, 0xEC, 0x5A, 0xFF,
-    0x66, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0xC9, 0x39, 0xFF, 0x66, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x67, 0x29, 0xFF, 0x6E, 0x63, 0xFF, 0x46, 0x29, 0xFF, 0x26, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x90, 0x63, 0xFF, 0x26, 0x29, 0xFF, 0x26, 0x21, 0xFF, 0x26, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0xAF, 0x6B, 0xFF, 0x67, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x90, 0x6B, 0xFF, 0x05, 0x21, 0xFF, 0xED, 0x5A, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0xF0, 0x7B, 0xFF, 0x05, 0x21, 0xFF, 0xE4, 0x18, 0xFF, 0x25, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x0F, 0x5B, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0xE7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0x2C, 0x63, 0xFF, 0x45, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0xD7, 0xD6, 0xFF, 0x86, 0x31, 0xFF, 0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0x49, 0x4A, 0xFF, 0x25, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x24, 0x21, 0xFF, 0xC7, 0x39, 0xFF, 0x25, 0x21, 0xFF, 0x0C, 0x63, 0xFF, 0x24, 0x29, 0xFF, 0x66, 0x31, 0xFF,
-    0x66, 0x31, 0xFF, 0xEB, 0x5A, 0xFF, 0x6A, 0x4A, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0xA7, 0x31, 0xFF, 0x2D, 0x63, 0xFF, 0x46, 0x29, 0xFF, 0x24, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x6E, 0x73, 0xFF, 0x66, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x29, 0x4A, 0xFF, 0x86, 0x31, 0xFF, 0x0D, 0x63, 0xFF, 0x87, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0x05, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0xE5, 0x18, 0xFF, 0x8B, 0x52, 0xFF, 0xCF, 0x52, 0xFF, 0x2B, 0x42, 0xFF, 0x67, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0x0A, 0x42, 0xFF, 0x87, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0x0F, 0x5B, 0xFF, 0x67, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0xA7, 0x31, 0xFF, 0x6B, 0x4A, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0xC7, 0x39, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0xC7, 0x39, 0xFF, 0x8A, 0x4A, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0xAA, 0x52, 0xFF, 0xE8, 0x39, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x29, 0x42, 0xFF, 0xE8, 0x39, 0xFF,
-    0xAE, 0x73, 0xFF, 0x66, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0xEF, 0x7B, 0xFF, 0x08, 0x42, 0xFF, 0x66, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0xCF, 0x7B, 0xFF, 0xA6, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0xED, 0x52, 0xFF, 0x50, 0x84, 0xFF, 0x65, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0x65, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x4D, 0x63, 0xFF, 0x25, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x4E, 0x63, 0xFF, 0x87, 0x31, 0xFF, 0xA7, 0x39, 0xFF, 0x87, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x2E, 0x63, 0xFF, 0x25, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x0E, 0x5B, 0xFF, 0x66, 0x31, 0xFF, 0x25, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x0F, 0x5B, 0xFF, 0x67, 0x31, 0xFF, 0x06, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x8C, 0x4A, 0xFF, 0x54, 0x84, 0xFF, 0x87, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x09, 0x42, 0xFF, 0x87, 0x31, 0xFF, 0x76, 0x8C, 0xFF, 0xA7, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x05, 0x19, 0xFF, 0x25, 0x29, 0xFF, 0x51, 0x7C, 0xFF, 0x87, 0x31, 0xFF, 0xCD, 0x52, 0xFF, 0x25, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x6F, 0x63, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF,
-    0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x10, 0x7C, 0xFF, 0x87, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x90, 0x6B, 0xFF, 0x69, 0x4A, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x78, 0x63, 0xFF, 0x86, 0x29, 0xFF, 0xA7, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0x04, 0x21, 0xFF, 0x24, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0xC7, 0x39, 0xFF, 0x65, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0x45, 0x31, 0xFF, 0x86, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x29, 0x4A, 0xFF, 0x86, 0x31, 0xFF, 0x65, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x25, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0xA7, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x08, 0x42, 0xFF, 0x66, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x05, 0x21, 0xFF, 0x86, 0x31, 0xFF, 0x25, 0x21, 0xFF, 0x25, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0xCD, 0x5A, 0xFF, 0x66, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x46, 0x21, 0xFF, 0x67, 0x31, 0xFF, 0x26, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x87, 0x31, 0xFF,
-    0x46, 0x29, 0xFF, 0x67, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x26, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0xC8, 0x39, 0xFF, 0x46, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0xA7, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x25, 0x21, 0xFF, 0xC7, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0x86, 0x29, 0xFF, 0xA7, 0x39, 0xFF, 0x04, 0x29, 0xFF, 0xAB, 0x5A, 0xFF, 0x8A, 0x52, 0xFF, 0x66, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x7B, 0x6B, 0xFF, 0x1E, 0x84, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0x29, 0x42, 0xFF, 0x10, 0x7C, 0xFF, 0x66, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0x8B, 0x52, 0xFF, 0x69, 0x4A, 0xFF, 0xAE, 0x6B, 0xFF, 0x69, 0x52, 0xFF, 0x86, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0x49, 0x4A, 0xFF, 0x86, 0x31, 0xFF, 0x25, 0x29, 0xFF, 0x29, 0x42, 0xFF, 0x4A, 0x4A, 0xFF, 0xED, 0x5A, 0xFF, 0xC8, 0x39, 0xFF, 0x6B, 0x4A, 0xFF, 0x66, 0x31, 0xFF, 0xA7, 0x39, 0xFF, 0x4E, 0x63, 0xFF,
-    0x87, 0x31, 0xFF, 0x05, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0x26, 0x21, 0xFF, 0x0E, 0x5B, 0xFF, 0xA7, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x2A, 0x42, 0xFF, 0xEE, 0x5A, 0xFF, 0x67, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0xC8, 0x39, 0xFF, 0x47, 0x29, 0xFF, 0x6E, 0x4A, 0xFF, 0xC9, 0x39, 0xFF, 0x47, 0x29, 0xFF, 0xEA, 0x41, 0xFF, 0xE9, 0x39, 0xFF, 0x53, 0x8C, 0xFF, 0x66, 0x29, 0xFF, 0xEA, 0x39, 0xFF, 0x67, 0x31, 0xFF, 0xBA, 0x42, 0xFF, 0x8B, 0x52, 0xFF, 0xAD, 0x52, 0xFF, 0xA7, 0x31, 0xFF, 0x45, 0x29, 0xFF, 0x90, 0x6B, 0xFF, 0x6B, 0x52, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0x0D, 0x63, 0xFF, 0x86, 0x31, 0xFF, 0xA7, 0x39, 0xFF, 0x45, 0x29, 0xFF, 0xCB, 0x52, 0xFF, 0x87, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0xCC, 0x52, 0xFF, 0x87, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0xE7, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xC8, 0x39, 0xFF, 0x86, 0x39, 0xFF, 0x65, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x12, 0xA5, 0xFF, 0xAF, 0x73, 0xFF, 0x45, 0x29, 0xFF, 0xC7, 0x39, 0xFF, 0x66, 0x31, 0xFF, 0x8B, 0x52, 0xFF, 0x66, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x8B, 0x52, 0xFF, 0xEF, 0x7B, 0xFF, 0xD3, 0x9C, 0xFF, 0x66, 0x29, 0xFF,
-    0x8B, 0x4A, 0xFF, 0xA7, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xAB, 0x5A, 0xFF, 0xA7, 0x31, 0xFF, 0xAF, 0x73, 0xFF, 0x86, 0x31, 0xFF, 0xCC, 0x5A, 0xFF, 0x72, 0x8C, 0xFF, 0x66, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0x8C, 0x52, 0xFF, 0x66, 0x29, 0xFF, 0x73, 0x8C, 0xFF, 0x2F, 0x5B, 0xFF, 0xA8, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x4B, 0x42, 0xFF, 0x87, 0x31, 0xFF, 0x67, 0x31, 0xFF, 0x67, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0x67, 0x29, 0xFF, 0x71, 0x63, 0xFF, 0xD5, 0x94, 0xFF, 0x88, 0x31, 0xFF, 0x67, 0x31, 0xFF, 0xA8, 0x39, 0xFF, 0xC9, 0x39, 0xFF, 0x67, 0x29, 0xFF, 0xC9, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0xAE, 0x52, 0xFF, 0x87, 0x31, 0xFF, 0x87, 0x29, 0xFF, 0x15, 0x9D, 0xFF, 0x67, 0x31, 0xFF, 0xD1, 0x73, 0xFF, 0x66, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0x93, 0x8C, 0xFF, 0x25, 0x21, 0xFF, 0x66, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x49, 0x42, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0x71, 0x8C, 0xFF, 0xA7, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0x29, 0x42, 0xFF, 0xCF, 0x73, 0xFF, 0xA7, 0x31, 0xFF,
-    0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x25, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0xE8, 0x41, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0xA6, 0x39, 0xFF, 0x53, 0x8C, 0xFF, 0xA9, 0x5A, 0xFF, 0xA7, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x6A, 0x4A, 0xFF, 0x54, 0xAD, 0xFF, 0x47, 0x4A, 0xFF, 0x86, 0x31, 0xFF, 0x09, 0x42, 0xFF, 0xB3, 0x94, 0xFF, 0x51, 0x8C, 0xFF, 0x90, 0x8C, 0xFF, 0xC7, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x88, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0xF5, 0x9C, 0xFF, 0x29, 0x42, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0x33, 0x84, 0xFF, 0x25, 0x21, 0xFF, 0x87, 0x31, 0xFF, 0x25, 0x21, 0xFF, 0x46, 0x29, 0xFF, 0x66, 0x29, 0xFF, 0x07, 0x19, 0xFF, 0x87, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x67, 0x29, 0xFF, 0x90, 0x6B, 0xFF, 0xBA, 0x73, 0xFF, 0x09, 0x42, 0xFF, 0x46, 0x29, 0xFF, 0xC9, 0x39, 0xFF, 0x51, 0x63, 0xFF, 0x75, 0x8C, 0xFF, 0x8C, 0x52, 0xFF, 0x0A, 0x42, 0xFF, 0xA8, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x53, 0x8C, 0xFF, 0x53, 0x8C, 0xFF, 0xC9, 0x39, 0xFF, 0xAD, 0x52, 0xFF, 0x67, 0x29, 0xFF, 0x09, 0x42, 0xFF, 0x6F, 0x6B, 0xFF, 0x87, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x35, 0xA5, 0xFF, 0x34, 0xA5, 0xFF,
-    0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x92, 0x8C, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xA7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0xE8, 0x39, 0xFF, 0x08, 0x3A, 0xFF, 0xE8, 0x39, 0xFF, 0x08, 0x3A, 0xFF, 0x0F, 0x84, 0xFF, 0xE8, 0x39, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0xAA, 0x5A, 0xFF, 0xEC, 0x5A, 0xFF, 0xA6, 0x39, 0xFF, 0x66, 0x31, 0xFF, 0x29, 0x42, 0xFF, 0x91, 0x94, 0xFF, 0xE8, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0xEC, 0x5A, 0xFF, 0x14, 0xA5, 0xFF, 0xE8, 0x41, 0xFF, 0xC8, 0x39, 0xFF, 0x09, 0x42, 0xFF, 0x8F, 0x6B, 0xFF, 0xC7, 0x39, 0xFF, 0xCF, 0x7B, 0xFF, 0xA7, 0x39, 0xFF, 0x4F, 0x63, 0xFF, 0x6A, 0x4A, 0xFF, 0x29, 0x42, 0xFF, 0xD0, 0x73, 0xFF, 0x66, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0xA8, 0x39, 0xFF, 0x66, 0x29, 0xFF, 0x11, 0x7C, 0xFF, 0x6A, 0x4A, 0xFF, 0x26, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0xA8, 0x39, 0xFF, 0xF2, 0x6B, 0xFF, 0x67, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0xF2, 0x73, 0xFF, 0x87, 0x31, 0xFF, 0x67, 0x29, 0xFF, 0x69, 0x29, 0xFF, 0xF2, 0x52, 0xFF, 0xD2, 0x73, 0xFF, 0x87, 0x31, 0xFF,
-    0xA8, 0x31, 0xFF, 0x8D, 0x4A, 0xFF, 0x0A, 0x42, 0xFF, 0x11, 0x7C, 0xFF, 0x67, 0x29, 0xFF, 0xA9, 0x31, 0xFF, 0x87, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0x53, 0x84, 0xFF, 0x4E, 0x6B, 0xFF, 0x0E, 0x5B, 0xFF, 0xA8, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x12, 0x7C, 0xFF, 0xC8, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0xF0, 0x73, 0xFF, 0xC8, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x29, 0xFF, 0xA7, 0x39, 0xFF, 0x49, 0x42, 0xFF, 0x86, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0x8F, 0x6B, 0xFF, 0xE8, 0x39, 0xFF, 0x29, 0x42, 0xFF, 0x8A, 0x4A, 0xFF, 0x66, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x6A, 0x4A, 0xFF, 0xC8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0xC8, 0x41, 0xFF, 0x8A, 0x52, 0xFF, 0xE8, 0x41, 0xFF, 0xA7, 0x39, 0xFF, 0x8B, 0x52, 0xFF, 0xA8, 0x39, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x39, 0xFF, 0x49, 0x4A, 0xFF, 0xA7, 0x39, 0xFF, 0x18, 0xC6, 0xFF, 0x6A, 0x4A, 0xFF, 0xA7, 0x39, 0xFF, 0x29, 0x42, 0xFF, 0xA7, 0x31, 0xFF, 0x19, 0xBE, 0xFF, 0xA7, 0x31, 0xFF, 0x0E, 0x5B, 0xFF, 0xA8, 0x39, 0xFF, 0x87, 0x31, 0xFF, 0xA7, 0x31, 0xFF,
-    0xED, 0x5A, 0xFF, 0xA8, 0x39, 0xFF, 0x46, 0x29, 0xFF, 0x67, 0x31, 0xFF, 0x6C, 0x42, 0xFF, 0xC9, 0x39, 0xFF, 0x47, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x67, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x09, 0x42, 0xFF, 0x26, 0x29, 0xFF, 0xA9, 0x31, 0xFF, 0x0B, 0x42, 0xFF, 0x67, 0x29, 0xFF, 0x88, 0x31, 0xFF, 0xA8, 0x31, 0xFF, 0x2C, 0x42, 0xFF, 0xEA, 0x41, 0xFF, 0x88, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0xEF, 0x52, 0xFF, 0xA8, 0x31, 0xFF, 0x4B, 0x42, 0xFF, 0xC9, 0x39, 0xFF, 0x71, 0x63, 0xFF, 0x87, 0x31, 0xFF, 0xA7, 0x31, 0xFF, 0x29, 0x42, 0xFF, 0x6B, 0x4A, 0xFF, 0xA7, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0xEC, 0x5A, 0xFF, 0x87, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x29, 0x42, 0xFF, 0xC8, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0x29, 0x42, 0xFF, 0xC8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0x2A, 0x42, 0xFF, 0x4A, 0x42, 0xFF, 0x66, 0x31, 0xFF, 0xA7, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x6E, 0x73, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x86, 0x39, 0xFF, 0x31, 0x8C, 0xFF, 0x4E, 0x6B, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x0B, 0x63, 0xFF, 0x30, 0x8C, 0xFF, 0xC7, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0xE8, 0x41, 0xFF,
-    0xAB, 0x5A, 0xFF, 0x29, 0x42, 0xFF, 0xE8, 0x39, 0xFF, 0x29, 0x4A, 0xFF, 0x08, 0x42, 0xFF, 0x8B, 0x52, 0xFF, 0x6E, 0x6B, 0xFF, 0xE8, 0x39, 0xFF, 0x6B, 0x4A, 0xFF, 0xA7, 0x39, 0xFF, 0x33, 0x7C, 0xFF, 0x2D, 0x6B, 0xFF, 0x0D, 0x5B, 0xFF, 0xC8, 0x39, 0xFF, 0xA8, 0x31, 0xFF, 0xB1, 0x6B, 0xFF, 0x0D, 0x63, 0xFF, 0x67, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x67, 0x31, 0xFF, 0xD3, 0x6B, 0xFF, 0xC8, 0x39, 0xFF, 0x46, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x67, 0x29, 0xFF, 0xD0, 0x52, 0xFF, 0x09, 0x42, 0xFF, 0x67, 0x31, 0xFF, 0xA9, 0x31, 0xFF, 0x48, 0x29, 0xFF, 0x68, 0x29, 0xFF, 0xC9, 0x39, 0xFF, 0xE9, 0x39, 0xFF, 0xC9, 0x39, 0xFF, 0xAE, 0x52, 0xFF, 0x89, 0x29, 0xFF, 0x88, 0x29, 0xFF, 0x88, 0x31, 0xFF, 0xE9, 0x39, 0xFF, 0xD6, 0xAD, 0xFF, 0x4F, 0x6B, 0xFF, 0xE8, 0x39, 0xFF, 0x2A, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0x54, 0x84, 0xFF, 0xE8, 0x39, 0xFF, 0xC8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xC8, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0x6A, 0x4A, 0xFF, 0x11, 0x7C, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0xE8, 0x41, 0xFF, 0x8F, 0x6B, 0xFF, 0x29, 0x42, 0xFF, 0xE8, 0x39, 0xFF, 0x09, 0x42, 0xFF, 0x09, 0x3A, 0xFF, 0x6B, 0x4A, 0xFF,
-    0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xE8, 0x41, 0xFF, 0xA7, 0x39, 0xFF, 0x51, 0x8C, 0xFF, 0x86, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0x49, 0x4A, 0xFF, 0x29, 0x42, 0xFF, 0xF2, 0x7B, 0xFF, 0xE7, 0x39, 0xFF, 0x8A, 0x52, 0xFF, 0x29, 0x4A, 0xFF, 0x75, 0xB5, 0xFF, 0x08, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x86, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0x92, 0x84, 0xFF, 0x08, 0x42, 0xFF, 0x29, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0xB3, 0x94, 0xFF, 0x09, 0x42, 0xFF, 0xC8, 0x39, 0xFF, 0x09, 0x42, 0xFF, 0xA8, 0x39, 0xFF, 0x90, 0x73, 0xFF, 0x87, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0xE9, 0x41, 0xFF, 0x13, 0x7C, 0xFF, 0xA7, 0x31, 0xFF, 0x67, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0xB2, 0x73, 0xFF, 0x67, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x68, 0x31, 0xFF, 0x8E, 0x52, 0xFF, 0xE9, 0x39, 0xFF, 0x06, 0x21, 0xFF, 0xEA, 0x41, 0xFF, 0x94, 0x63, 0xFF, 0x88, 0x31, 0xFF, 0x0A, 0x42, 0xFF, 0xAD, 0x52, 0xFF, 0x0B, 0x42, 0xFF, 0x8E, 0x52, 0xFF, 0x68, 0x31, 0xFF, 0x0A, 0x42, 0xFF, 0xEA, 0x39, 0xFF, 0x56, 0x7C, 0xFF, 0xE9, 0x39, 0xFF, 0x4B, 0x4A, 0xFF, 0x09, 0x42, 0xFF, 0xE9, 0x39, 0xFF, 0x73, 0x84, 0xFF, 0xE8, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0x13, 0x74, 0xFF,
-    0xE8, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xF0, 0x73, 0xFF, 0xC7, 0x39, 0xFF, 0xA7, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0x90, 0x6B, 0xFF, 0xE8, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0x09, 0x42, 0xFF, 0x09, 0x42, 0xFF, 0x6A, 0x4A, 0xFF, 0xAC, 0x4A, 0xFF, 0x6A, 0x4A, 0xFF, 0x86, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0x12, 0xA5, 0xFF, 0x91, 0x94, 0xFF, 0x49, 0x4A, 0xFF, 0xC8, 0x41, 0xFF, 0x6A, 0x52, 0xFF, 0xCB, 0x62, 0xFF, 0x91, 0x94, 0xFF, 0xB6, 0xAD, 0xFF, 0x49, 0x4A, 0xFF, 0x08, 0x42, 0xFF, 0x28, 0x4A, 0xFF, 0x33, 0xA5, 0xFF, 0x28, 0x42, 0xFF, 0xC7, 0x39, 0xFF, 0x29, 0x4A, 0xFF, 0x28, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0xB1, 0x94, 0xFF, 0x29, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0xD5, 0x8C, 0xFF, 0xE8, 0x39, 0xFF, 0x93, 0x94, 0xFF, 0x29, 0x42, 0xFF, 0xE9, 0x41, 0xFF, 0xE9, 0x41, 0xFF, 0xA8, 0x39, 0xFF, 0xB3, 0x94, 0xFF, 0x67, 0x31, 0xFF, 0x70, 0x63, 0xFF, 0xC9, 0x39, 0xFF, 0x67, 0x31, 0xFF, 0xA8, 0x39, 0xFF, 0xB1, 0x73, 0xFF, 0xC8, 0x39, 0xFF, 0x67, 0x31, 0xFF, 0x47, 0x29, 0xFF, 0x48, 0x29, 0xFF, 0x32, 0x84, 0xFF, 0xEA, 0x41, 0xFF, 0x27, 0x21, 0xFF, 0x0B, 0x42, 0xFF, 0x54, 0x5B, 0xFF, 0xF3, 0x7B, 0xFF, 0x0A, 0x42, 0xFF,
-    0xCA, 0x39, 0xFF, 0x70, 0x42, 0xFF, 0xCA, 0x39, 0xFF, 0x32, 0x84, 0xFF, 0xC8, 0x31, 0xFF, 0x0A, 0x42, 0xFF, 0x0A, 0x42, 0xFF, 0x0A, 0x3A, 0xFF, 0xAC, 0x52, 0xFF, 0xD5, 0x9C, 0xFF, 0xB5, 0x84, 0xFF, 0x2A, 0x42, 0xFF, 0xC7, 0x39, 0xFF, 0x8A, 0x52, 0xFF, 0x74, 0x8C, 0xFF, 0x08, 0x42, 0xFF, 0x09, 0x42, 0xFF, 0xA7, 0x31, 0xFF, 0x6A, 0x4A, 0xFF, 0xD2, 0x9C, 0xFF, 0xC8, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0x09, 0x42, 0xFF, 0xB1, 0x94, 0xFF, 0x30, 0x84, 0xFF, 0x09, 0x42, 0xFF, 0x09, 0x42, 0xFF, 0xAC, 0x4A, 0xFF, 0xCC, 0x52, 0xFF, 0xF0, 0x7B, 0xFF, 0x4A, 0x42, 0xFF, 0xD3, 0xA4, 0xFF, 0xC8, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0x29, 0x4A, 0xFF, 0xD5, 0xC5, 0xFF, 0x09, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0xCB, 0x62, 0xFF, 0xE8, 0x41, 0xFF, 0x8A, 0x52, 0xFF, 0x09, 0x42, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x52, 0xFF, 0x29, 0x4A, 0xFF, 0x69, 0x52, 0xFF, 0x08, 0x42, 0xFF, 0x29, 0x42, 0xFF, 0xE7, 0x39, 0xFF, 0xB3, 0x94, 0xFF, 0xAC, 0x5A, 0xFF, 0x08, 0x4A, 0xFF, 0x09, 0x42, 0xFF, 0x09, 0x42, 0xFF, 0xA8, 0x39, 0xFF, 0x09, 0x42, 0xFF, 0xCC, 0x5A, 0xFF, 0xE9, 0x41, 0xFF, 0xCE, 0x5A, 0xFF, 0xC8, 0x39, 0xFF, 0x0A, 0x42, 0xFF, 0x88, 0x31, 0xFF,
-    0x70, 0x73, 0xFF, 0xE9, 0x39, 0xFF, 0x87, 0x31, 0xFF, 0xC8, 0x39, 0xFF, 0xEE, 0x5A, 0xFF, 0x09, 0x42, 0xFF, 0x47, 0x29, 0xFF, 0x68, 0x31, 0xFF, 0x88, 0x31, 0xFF, 0x96, 0x94, 0xFF, 0xEA, 0x41, 0xFF, 0x68, 0x29, 0xFF, 0x0B, 0x42, 0xFF, 0x13, 0x63, 0xFF, 0x75, 0x84, 0xFF, 0xEA, 0x39, 0xFF, 0xEA, 0x39, 0xFF, 0x4E, 0x42, 0xFF, 0x2B, 0x42, 0xFF, 0xD6, 0x94, 0xFF, 0xEA, 0x39, 0xFF, 0x37, 0x7C, 0xFF, 0xEA, 0x39, 0xFF, 0xEA, 0x39, 0xFF, 0x36, 0xA5, 0xFF, 0xF5, 0x8C, 0xFF, 0x4A, 0x4A, 0xFF, 0xC8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0x54, 0xA5, 0xFF, 0x09, 0x42, 0xFF, 0x29, 0x4A, 0xFF, 0xE8, 0x41, 0xFF, 0xC8, 0x31, 0xFF, 0x54, 0xA5, 0xFF, 0xC8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0xC8, 0x39, 0xFF, 0xF2, 0x94, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0x29, 0x42, 0xFF, 0x29, 0x42, 0xFF, 0xCF, 0x73, 0xFF, 0x6A, 0x4A, 0xFF, 0x6B, 0x4A, 0xFF, 0xAC, 0x4A, 0xFF, 0x09, 0x42, 0xFF, 0x78, 0xCE, 0xFF, 0x09, 0x42, 0xFF, 0x4A, 0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0xA7, 0x39, 0xFF, 0x96, 0xB5, 0xFF, 0x09, 0x4A, 0xFF, 0xAB, 0x5A, 0xFF, 0xE8, 0x41, 0xFF, 0xAB, 0x5A, 0xFF, 0xF4, 0xCD, 0xFF, 0x0C, 0x63, 0xFF, 0xCB, 0x5A, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x4A, 0xFF,
-    0x12, 0x9D, 0xFF, 0x28, 0x42, 0xFF, 0x6A, 0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0x8F, 0x73, 0xFF, 0x95, 0xB5, 0xFF, 0x2A, 0x4A, 0xFF, 0x6B, 0x52, 0xFF, 0xB1, 0x73, 0xFF, 0x4A, 0x52, 0xFF, 0x56, 0xA5, 0xFF, 0x2A, 0x4A, 0xFF, 0x2A, 0x42, 0xFF, 0xE9, 0x41, 0xFF, 0x0A, 0x42, 0xFF, 0x2F, 0x63, 0xFF, 0xC9, 0x39, 0xFF, 0xC9, 0x39, 0xFF, 0x88, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0xB4, 0x6B, 0xFF, 0x0A, 0x42, 0xFF, 0x48, 0x29, 0xFF, 0x68, 0x31, 0xFF, 0xEA, 0x39, 0xFF, 0x28, 0x29, 0xFF, 0x4C, 0x4A, 0xFF, 0x68, 0x31, 0xFF, 0x0B, 0x42, 0xFF, 0x89, 0x31, 0xFF, 0xEC, 0x41, 0xFF, 0x2C, 0x42, 0xFF, 0xEC, 0x41, 0xFF, 0x4D, 0x4A, 0xFF, 0x8E, 0x52, 0xFF, 0xEB, 0x39, 0xFF, 0xEC, 0x39, 0xFF, 0x0A, 0x42, 0xFF, 0x4B, 0x4A, 0xFF, 0xF2, 0x7B, 0xFF, 0xAD, 0x52, 0xFF, 0x8C, 0x52, 0xFF, 0x6A, 0x4A, 0xFF, 0x09, 0x42, 0xFF, 0x74, 0xAD, 0xFF, 0x6A, 0x4A, 0xFF, 0x29, 0x4A, 0xFF, 0x6A, 0x4A, 0xFF, 0x6A, 0x4A, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0x8B, 0x4A, 0xFF, 0x29, 0x42, 0xFF, 0x09, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0x29, 0x42, 0xFF, 0x10, 0x7C, 0xFF, 0x4A, 0x42, 0xFF, 0x29, 0x42, 0xFF, 0x8C, 0x4A, 0xFF, 0x8B, 0x4A, 0xFF, 0xAC, 0x52, 0xFF,
-    0xE8, 0x41, 0xFF, 0xA8, 0x39, 0xFF, 0xC9, 0x39, 0xFF, 0x90, 0x8C, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0x09, 0x42, 0xFF, 0x29, 0x4A, 0xFF, 0x28, 0x4A, 0xFF, 0x4A, 0x4A, 0xFF, 0xCB, 0x5A, 0xFF, 0xAB, 0x5A, 0xFF, 0xB7, 0xBD, 0xFF, 0x55, 0xAD, 0xFF, 0x0F, 0x63, 0xFF, 0xEB, 0x62, 0xFF, 0xEB, 0x62, 0xFF, 0x54, 0xC6, 0xFF, 0xCB, 0x5A, 0xFF, 0x6A, 0x4A, 0xFF, 0x8B, 0x52, 0xFF, 0x2E, 0x52, 0xFF, 0xB3, 0x94, 0xFF, 0x11, 0x84, 0xFF, 0x6B, 0x52, 0xFF, 0xEE, 0x5A, 0xFF, 0xE9, 0x39, 0xFF, 0x6B, 0x4A, 0xFF, 0x6B, 0x52, 0xFF, 0xAD, 0x5A, 0xFF, 0x2A, 0x42, 0xFF, 0xD4, 0x8C, 0xFF, 0x26, 0x29, 0xFF, 0xA8, 0x39, 0xFF, 0xA8, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0xB5, 0x73, 0xFF, 0xAC, 0x5A, 0xFF, 0x88, 0x31, 0xFF, 0x89, 0x31, 0xFF, 0xCA, 0x39, 0xFF, 0x10, 0x63, 0xFF, 0x4C, 0x4A, 0xFF, 0x48, 0x29, 0xFF, 0x0C, 0x42, 0xFF, 0x8A, 0x31, 0xFF, 0x8B, 0x31, 0xFF, 0x2D, 0x4A, 0xFF, 0x50, 0x42, 0xFF, 0x6F, 0x52, 0xFF, 0x73, 0x6B, 0xFF, 0xCC, 0x39, 0xFF, 0xFD, 0x49, 0xFF, 0x8D, 0x52, 0xFF, 0x4B, 0x4A, 0xFF, 0xCF, 0x73, 0xFF, 0x0E, 0x5B, 0xFF, 0x29, 0x42, 0xFF, 0x8A, 0x4A, 0xFF, 0xAB, 0x52, 0xFF, 0xAB, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0xAB, 0x52, 0xFF, 0xAB, 0x52, 0xFF,
-    0xEC, 0x5A, 0xFF, 0x09, 0x42, 0xFF, 0x4A, 0x4A, 0xFF, 0xEC, 0x5A, 0xFF, 0x29, 0x42, 0xFF, 0x54, 0xA5, 0xFF, 0xF9, 0xDE, 0xFF, 0xE8, 0x39, 0xFF, 0xE8, 0x39, 0xFF, 0x2A, 0x42, 0xFF, 0x09, 0x42, 0xFF, 0x8B, 0x4A, 0xFF, 0x4A, 0x42, 0xFF, 0x6B, 0x4A, 0xFF, 0xCC, 0x52, 0xFF, 0xCC, 0x52, 0xFF, 0xE7, 0x41, 0xFF, 0xC8, 0x39, 0xFF, 0xE9, 0x41, 0xFF, 0x29, 0x42, 0xFF, 0x6A, 0x52, 0xFF, 0x51, 0x8C, 0xFF, 0xA7, 0x39, 0xFF, 0x8B, 0x52, 0xFF, 0x8A, 0x5A, 0xFF, 0xFC, 0xFF, 0xFF, 0x0C, 0x63, 0xFF, 0xB0, 0x73, 0xFF, 0x6E, 0x73, 0xFF, 0x31, 0x8C, 0xFF, 0xB6, 0xB5, 0xFF, 0x2C, 0x63, 0xFF, 0xEE, 0x7B, 0xFF, 0xCB, 0x5A, 0xFF, 0xF2, 0xBD, 0xFF, 0xCB, 0x5A, 0xFF, 0xCC, 0x5A, 0xFF, 0x4E, 0x6B, 0xFF, 0xAF, 0x73, 0xFF, 0xED, 0x62, 0xFF, 0xCD, 0x5A, 0xFF, 0x6C, 0x52, 0xFF, 0x2B, 0x4A, 0xFF, 0x54, 0x84, 0xFF, 0x6B, 0x4A, 0xFF, 0x4B, 0x4A, 0xFF, 0x4A, 0x4A, 0xFF, 0x0A, 0x42, 0xFF, 0xEA, 0x41, 0xFF, 0x4B, 0x4A, 0xFF, 0xC9, 0x39, 0xFF, 0x0F, 0x6B, 0xFF, 0x73, 0x6B, 0xFF, 0xAD, 0x5A, 0xFF, 0x89, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x2D, 0x4A, 0xFF, 0x53, 0x6B, 0xFF, 0x4C, 0x4A, 0xFF, 0xA9, 0x31, 0xFF, 0x6E, 0x4A, 0xFF, 0x97, 0x6B, 0xFF, 0xAC, 0x31, 0xFF, 0x8F, 0x52, 0xFF,
-    0x0F, 0x42, 0xFF, 0x71, 0x52, 0xFF, 0x6F, 0x4A, 0xFF, 0x4F, 0x4A, 0xFF, 0xAE, 0x52, 0xFF, 0x91, 0x73, 0xFF, 0xFC, 0xD6, 0xFF, 0x30, 0x63, 0xFF, 0x0E, 0x5B, 0xFF, 0x6B, 0x4A, 0xFF, 0xCC, 0x5A, 0xFF, 0x6A, 0x4A, 0xFF, 0x0D, 0x5B, 0xFF, 0xAB, 0x52, 0xFF, 0xEC, 0x5A, 0xFF, 0xCE, 0x7B, 0xFF, 0xEC, 0x5A, 0xFF, 0x09, 0x42, 0xFF, 0xAB, 0x52, 0xFF, 0xE9, 0x41, 0xFF, 0x29, 0x4A, 0xFF, 0x29, 0x42, 0xFF, 0x6A, 0x52, 0xFF, 0x09, 0x42, 0xFF, 0x6F, 0x6B, 0xFF, 0x4A, 0x4A, 0xFF, 0x6A, 0x4A, 0xFF, 0x4A, 0x4A, 0xFF, 0x09, 0x42, 0xFF, 0x6B, 0x4A, 0xFF, 0xCD, 0x52, 0xFF, 0xCC, 0x52, 0xFF, 0x29, 0x4A, 0xFF, 0xAD, 0x5A, 0xFF, 0xAC, 0x5A, 0xFF, 0xE9, 0x41, 0xFF, 0x09, 0x42, 0xFF, 0x6B, 0x52, 0xFF, 0x74, 0x8C, 0xFF, 0x2A, 0x4A, 0xFF, 0x8B, 0x52, 0xFF, 0x0D, 0x6B, 0xFF, 0xB4, 0x94, 0xFF, 0x4C, 0x6B, 0xFF, 0xCF, 0x7B, 0xFF, 0x6D, 0x73, 0xFF, 0x91, 0x9C, 0xFF, 0xD4, 0xBD, 0xFF, 0x4E, 0x94, 0xFF, 0x4D, 0x94, 0xFF, 0x0F, 0x84, 0xFF, 0x74, 0xAD, 0xFF, 0xD0, 0x7B, 0xFF, 0x2E, 0x6B, 0xFF, 0x8C, 0x52, 0xFF, 0xCF, 0x5A, 0xFF, 0xCF, 0x5A, 0xFF, 0x6F, 0x73, 0xFF, 0x8C, 0x52, 0xFF, 0x4B, 0x4A, 0xFF, 0x4C, 0x4A, 0xFF, 0xE9, 0x39, 0xFF, 0x6C, 0x52, 0xFF, 0x09, 0x42, 0xFF,
-    0xB2, 0x73, 0xFF, 0x94, 0x94, 0xFF, 0xEA, 0x41, 0xFF, 0xA9, 0x39, 0xFF, 0x74, 0x73, 0xFF, 0x8D, 0x52, 0xFF, 0xA9, 0x39, 0xFF, 0xCA, 0x39, 0xFF, 0xAA, 0x39, 0xFF, 0xCB, 0x39, 0xFF, 0x4C, 0x4A, 0xFF, 0xEC, 0x39, 0xFF, 0x4E, 0x4A, 0xFF, 0x95, 0x52, 0xFF, 0x76, 0x8C, 0xFF, 0x70, 0x4A, 0xFF, 0x91, 0x31, 0xFF, 0x57, 0x52, 0xFF, 0xD3, 0x5A, 0xFF, 0xB0, 0x52, 0xFF, 0xAE, 0x52, 0xFF, 0xD4, 0x7B, 0xFF, 0xCD, 0x5A, 0xFF, 0x8C, 0x4A, 0xFF, 0x6F, 0x6B, 0xFF, 0x10, 0x84, 0xFF, 0x13, 0x95, 0xFF, 0xAB, 0x52, 0xFF, 0xAF, 0x73, 0xFF, 0x4E, 0x63, 0xFF, 0x75, 0xAD, 0xFF, 0xAB, 0x52, 0xFF, 0x0E, 0x5B, 0xFF, 0x8D, 0x52, 0xFF, 0x0D, 0x5B, 0xFF, 0x55, 0xAD, 0xFF, 0x8A, 0x4A, 0xFF, 0x29, 0x42, 0xFF, 0xEB, 0x5A, 0xFF, 0x09, 0x42, 0xFF, 0xCF, 0x7B, 0xFF, 0x4D, 0x6B, 0xFF, 0x6A, 0x4A, 0xFF, 0x8B, 0x4A, 0xFF, 0x4B, 0x4A, 0xFF, 0x6B, 0x4A, 0xFF, 0xD3, 0x94, 0xFF, 0x2E, 0x5B, 0xFF, 0x71, 0xB5, 0xFF, 0x6B, 0x52, 0xFF, 0xC9, 0x39, 0xFF, 0x74, 0x5A, 0xFF, 0x19, 0xAD, 0xFF, 0x4B, 0x52, 0xFF, 0x90, 0x73, 0xFF, 0xCD, 0x5A, 0xFF, 0x7D, 0x5B, 0xFF, 0x1F, 0x84, 0xFF, 0x14, 0xA5, 0xFF, 0x33, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xE6, 0xFF, 0x93, 0x9C, 0xFF, 0xD0, 0xAC, 0xFF,
-    0xF0, 0xDD, 0xFF, 0x6F, 0xDE, 0xFF, 0x2F, 0x8C, 0xFF, 0x14, 0xA5, 0xFF, 0x39, 0xC6, 0xFF, 0x75, 0xA5, 0xFF, 0xF3, 0x83, 0xFF, 0x11, 0x6B, 0xFF, 0xBA, 0x5A, 0xFF, 0x9F, 0xB5, 0xFF, 0x2B, 0x4A, 0xFF, 0x2B, 0x4A, 0xFF, 0xD3, 0x7B, 0xFF, 0xA9, 0x39, 0xFF, 0x0B, 0x4A, 0xFF, 0xE9, 0x41, 0xFF, 0xEF, 0x5A, 0xFF, 0x4C, 0x4A, 0xFF, 0xC9, 0x39, 0xFF, 0xEA, 0x41, 0xFF, 0xB9, 0x7B, 0xFF, 0x0E, 0x63, 0xFF, 0xEB, 0x41, 0xFF, 0xCA, 0x39, 0xFF, 0x0C, 0x4A, 0xFF, 0x77, 0x94, 0xFF, 0x4F, 0x6B, 0xFF, 0x8B, 0x31, 0xFF, 0x8F, 0x52, 0xFF, 0xCD, 0x39, 0xFF, 0x99, 0x94, 0xFF, 0x97, 0x5A, 0xFF, 0xFE, 0x00, 0xFF, 0x7E, 0x10, 0xFF, 0xD4, 0x5A, 0xFF, 0x39, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0x94, 0xFF, 0xCE, 0x5A, 0xFF, 0xCD, 0x52, 0xFF, 0xFC, 0xFF, 0xFF, 0x31, 0x9D, 0xFF, 0x4E, 0x6B, 0xFF, 0x2D, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xBD, 0xFF, 0xD1, 0x7B, 0xFF, 0x4F, 0x63, 0xFF, 0xFC, 0x4D, 0xFF, 0x12, 0x42, 0xFF, 0x95, 0xB5, 0xFF, 0x11, 0x42, 0xFF, 0xD2, 0x62, 0xFF, 0x0F, 0x63, 0xFF, 0x2F, 0x6B, 0xFF, 0x34, 0xA5, 0xFF, 0x09, 0x42, 0xFF, 0x4A, 0x4A, 0xFF, 0xED, 0x5A, 0xFF, 0x8C, 0x4A, 0xFF, 0xF2, 0x7B, 0xFF, 0xBC, 0x01, 0xFF, 0xAE, 0x52, 0xFF, 0xED, 0x52, 0xFF,
-    0x2C, 0x6B, 0xFF, 0x94, 0x94, 0xFF, 0xDF, 0xA6, 0xFF, 0xB1, 0x5A, 0xFF, 0x4F, 0x4A, 0xFF, 0x0E, 0x4A, 0xFF, 0x3A, 0xAD, 0xFF, 0x8C, 0x5A, 0xFF, 0x57, 0x94, 0xFF, 0x1A, 0x42, 0xFF, 0x7E, 0x76, 0xFF, 0xB3, 0xC5, 0xFF, 0xB3, 0x9C, 0xFF, 0x99, 0xAD, 0xFF, 0xFF, 0xEF, 0xFF, 0xFA, 0xFF, 0xFF, 0x51, 0xBD, 0xFF, 0xDA, 0xFF, 0xFF, 0xF8, 0xBD, 0xFF, 0x7A, 0xBE, 0xFF, 0xB7, 0xB5, 0xFF, 0x9D, 0xC5, 0xFF, 0xD0, 0x62, 0xFF, 0xAC, 0x5A, 0xFF, 0x70, 0x52, 0xFF, 0x5F, 0x6E, 0xFF, 0xBB, 0x94, 0xFF, 0x0B, 0x42, 0xFF, 0x6C, 0x52, 0xFF, 0x2F, 0x63, 0xFF, 0xA9, 0x39, 0xFF, 0x1B, 0xEF, 0xFF, 0xEA, 0x41, 0xFF, 0xCE, 0x5A, 0xFF, 0x0B, 0x4A, 0xFF, 0xAD, 0x5A, 0xFF, 0x16, 0xA5, 0xFF, 0x51, 0x73, 0xFF, 0xCA, 0x39, 0xFF, 0xAA, 0x39, 0xFF, 0xEB, 0x41, 0xFF, 0xF6, 0x83, 0xFF, 0xCF, 0x62, 0xFF, 0xEC, 0x41, 0xFF, 0xB0, 0x39, 0xFF, 0x30, 0x42, 0xFF, 0x52, 0x31, 0xFF, 0xBE, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x63, 0xFF, 0xD6, 0x5A, 0xFF, 0xD4, 0x5A, 0xFF, 0xDF, 0xEF, 0xFF, 0xD9, 0x7B, 0xFF, 0xEF, 0x5A, 0xFF, 0xDC, 0xB5, 0xFF, 0x5C, 0x73, 0xFF, 0xD1, 0x6B, 0xFF, 0x4F, 0x63, 0xFF, 0x5A, 0xBE, 0xFF, 0x37, 0xC6, 0xFF, 0xB3, 0x6B, 0xFF, 0xB1, 0x73, 0xFF, 0xD0, 0x5A, 0xFF,
-    0x73, 0x6B, 0xFF, 0x4B, 0x52, 0xFF, 0xD1, 0x73, 0xFF, 0x0F, 0x63, 0xFF, 0x6B, 0x4A, 0xFF, 0x72, 0x8C, 0xFF, 0x52, 0x6B, 0xFF, 0x8A, 0x52, 0xFF, 0x4A, 0x4A, 0xFF, 0x6A, 0x4A, 0xFF, 0xB3, 0x8C, 0xFF, 0x2E, 0x63, 0xFF, 0xAD, 0x52, 0xFF, 0x6C, 0x4A, 0xFF, 0xCD, 0x52, 0xFF, 0x50, 0x63, 0xFF, 0x09, 0x4A, 0xFF, 0x0A, 0x4A, 0xFF, 0xCF, 0x62, 0xFF, 0x72, 0x73, 0xFF, 0x8C, 0x52, 0xFF, 0x6D, 0x5A, 0xFF, 0xAD, 0x5A, 0xFF, 0x6C, 0x52, 0xFF, 0x79, 0xD6, 0xFF, 0xD7, 0xBD, 0xFF, 0xAD, 0x5A, 0xFF, 0xF0, 0x8B, 0xFF, 0x8E, 0x7B, 0xFF, 0x73, 0x94, 0xFF, 0x94, 0x9C, 0xFF, 0x13, 0xA5, 0xFF, 0xAF, 0x9C, 0xFF, 0xD1, 0x9C, 0xFF, 0x78, 0xD6, 0xFF, 0x94, 0x94, 0xFF, 0x32, 0x94, 0xFF, 0x0F, 0x6B, 0xFF, 0xF9, 0xC5, 0xFF, 0x8C, 0x52, 0xFF, 0x6D, 0x52, 0xFF, 0xD0, 0x5A, 0xFF, 0x30, 0x6B, 0xFF, 0xD6, 0x94, 0xFF, 0xEC, 0x41, 0xFF, 0xEA, 0x41, 0xFF, 0xAE, 0x5A, 0xFF, 0x8E, 0x52, 0xFF, 0xCB, 0x41, 0xFF, 0xCF, 0x5A, 0xFF, 0xEA, 0x41, 0xFF, 0xCB, 0x41, 0xFF, 0xD5, 0x94, 0xFF, 0x8F, 0x5A, 0xFF, 0xEB, 0x41, 0xFF, 0xEB, 0x41, 0xFF, 0x0C, 0x42, 0xFF, 0xED, 0x41, 0xFF, 0x51, 0x6B, 0xFF, 0xCC, 0x39, 0xFF, 0xD1, 0x5A, 0xFF, 0x1B, 0x7C, 0xFF, 0x10, 0x42, 0xFF, 0xF6, 0x62, 0xFF,
-    0xF7, 0x41, 0xFF, 0xB8, 0x5A, 0xFF, 0x76, 0x6B, 0xFF, 0x13, 0x63, 0xFF, 0x32, 0x6B, 0xFF, 0xF0, 0x62, 0xFF, 0xFA, 0xAD, 0xFF, 0x91, 0x73, 0xFF, 0x8E, 0x6B, 0xFF, 0x90, 0x84, 0xFF, 0x4F, 0x84, 0xFF, 0x96, 0xD6, 0xFF, 0xB2, 0x73, 0xFF, 0x0F, 0x8C, 0xFF, 0xCE, 0x7B, 0xFF, 0xF3, 0x7B, 0xFF, 0x4E, 0x6B, 0xFF, 0x8D, 0x52, 0xFF, 0x91, 0x6B, 0xFF, 0x6A, 0x52, 0xFF, 0x55, 0xA5, 0xFF, 0x8B, 0x52, 0xFF, 0x0C, 0x5B, 0xFF, 0x49, 0x4A, 0xFF, 0x14, 0x74, 0xFF, 0x6A, 0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0xAB, 0x4A, 0xFF, 0xCF, 0x5A, 0xFF, 0xEF, 0x5A, 0xFF, 0xEF, 0x5A, 0xFF, 0xEE, 0x5A, 0xFF, 0x8E, 0x7B, 0xFF, 0x10, 0x63, 0xFF, 0xF2, 0x83, 0xFF, 0x73, 0x73, 0xFF, 0x6C, 0x52, 0xFF, 0xD1, 0x7B, 0xFF, 0x9B, 0x94, 0xFF, 0x31, 0x4A, 0xFF, 0x91, 0x5A, 0xFF, 0xF1, 0x83, 0xFF, 0x93, 0xC5, 0xFF, 0xD1, 0xB4, 0xFF, 0xF0, 0xBC, 0xFF, 0x52, 0xB5, 0xFF, 0xD1, 0xBD, 0xFF, 0x75, 0xE7, 0xFF, 0xEF, 0xCE, 0xFF, 0x53, 0xAD, 0xFF, 0x50, 0x94, 0xFF, 0x53, 0xBD, 0xFF, 0xD3, 0xB4, 0xFF, 0x6F, 0x7B, 0xFF, 0x0F, 0x73, 0xFF, 0x3B, 0x9D, 0xFF, 0x56, 0x52, 0xFF, 0x52, 0x73, 0xFF, 0x95, 0x94, 0xFF, 0xAD, 0x62, 0xFF, 0xD6, 0x73, 0xFF, 0x2B, 0x4A, 0xFF, 0x4D, 0x52, 0xFF, 0x8D, 0x52, 0xFF,
-    0x36, 0x7C, 0xFF, 0x30, 0x6B, 0xFF, 0x2C, 0x4A, 0xFF, 0xAD, 0x39, 0xFF, 0x5E, 0x63, 0xFF, 0x94, 0x5A, 0xFF, 0x0C, 0x4A, 0xFF, 0xCB, 0x39, 0xFF, 0xEC, 0x41, 0xFF, 0x50, 0x4A, 0xFF, 0x10, 0x63, 0xFF, 0xEC, 0x41, 0xFF, 0x74, 0x73, 0xFF, 0x7C, 0x63, 0xFF, 0xD3, 0x5A, 0xFF, 0x15, 0x63, 0xFF, 0xDC, 0x39, 0xFF, 0x9E, 0x42, 0xFF, 0xD5, 0x5A, 0xFF, 0xB1, 0x5A, 0xFF, 0x31, 0x73, 0xFF, 0x9E, 0xF7, 0xFF, 0xB0, 0x73, 0xFF, 0xD0, 0x7B, 0xFF, 0x0F, 0x8D, 0xFF, 0xFD, 0xFF, 0xFF, 0x96, 0xE7, 0xFF, 0x91, 0x94, 0xFF, 0x6F, 0x94, 0xFF, 0xD2, 0xFE, 0xFF, 0xD6, 0xDE, 0xFF, 0x8F, 0x73, 0xFF, 0xB2, 0x73, 0xFF, 0x1D, 0x3A, 0xFF, 0x3F, 0x74, 0xFF, 0x2B, 0x42, 0xFF, 0xCC, 0x5A, 0xFF, 0x29, 0x42, 0xFF, 0x50, 0x6B, 0xFF, 0xEE, 0x5A, 0xFF, 0x49, 0x4A, 0xFF, 0x6A, 0x4A, 0xFF, 0xAB, 0x52, 0xFF, 0x0F, 0x5B, 0xFF, 0xCD, 0x5A, 0xFF, 0xEE, 0x5A, 0xFF, 0x9A, 0x4A, 0xFF, 0xF3, 0x52, 0xFF, 0xD3, 0xCD, 0xFF, 0xB0, 0x7B, 0xFF, 0x6F, 0x7B, 0xFF, 0x3E, 0x8F, 0xFF, 0x31, 0x52, 0xFF, 0x75, 0xC5, 0xFF, 0xAF, 0x62, 0xFF, 0x7E, 0x4A, 0xFF, 0x7C, 0x5C, 0xFF, 0xB7, 0x83, 0xFF, 0x9C, 0xFF, 0xFF, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF2, 0xCD, 0xFF, 0xF6, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x31, 0xBE, 0xFF, 0x52, 0xB5, 0xFF, 0x52, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x9C, 0xFF, 0xD2, 0x83, 0xFF, 0x91, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x73, 0xFF, 0x96, 0x9C, 0xFF, 0x8E, 0x5A, 0xFF, 0xB6, 0x7B, 0xFF, 0xAE, 0x5A, 0xFF, 0x10, 0x63, 0xFF, 0x31, 0x6B, 0xFF, 0xBF, 0x4B, 0xFF, 0x0D, 0x4A, 0xFF, 0xCF, 0x62, 0xFF, 0x10, 0x4A, 0xFF, 0xBF, 0x8E, 0xFF, 0x59, 0x31, 0xFF, 0x0D, 0x4A, 0xFF, 0x0C, 0x4A, 0xFF, 0x0C, 0x4A, 0xFF, 0x31, 0x6B, 0xFF, 0xF7, 0x62, 0xFF, 0xEC, 0x41, 0xFF, 0xF5, 0x62, 0xFF, 0xEF, 0x41, 0xFF, 0xF0, 0x41, 0xFF, 0x3E, 0xE7, 0xFF, 0x7C, 0x4A, 0xFF, 0x1F, 0xBE, 0xFF, 0x96, 0x73, 0xFF, 0x8F, 0x52, 0xFF, 0xD3, 0x83, 0xFF, 0x98, 0xDE, 0xFF, 0x11, 0x84, 0xFF, 0xD3, 0x73, 0xFF, 0x0F, 0x95, 0xFF, 0xFE, 0xFF, 0xFF, 0x2E, 0xA5, 0xFF, 0x2E, 0x84, 0xFF, 0x50, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x94, 0xFF, 0xEF, 0x83, 0xFF, 0x5A, 0x8C, 0xFF, 0x1F, 0x5C, 0xFF, 0xD2, 0x52, 0xFF, 0x8B, 0x52, 0xFF, 0x2F, 0x63, 0xFF, 0xB4, 0x73, 0xFF, 0xCB, 0x5A, 0xFF, 0x6A, 0x4A, 0xFF, 0x6A, 0x4A, 0xFF, 0x8B, 0x52, 0xFF, 0xCC, 0x5A, 0xFF, 0xAC, 0x52, 0xFF, 0xAC, 0x52, 0xFF, 0xCE, 0x5A, 0xFF, 0xD3, 0x52, 0xFF, 0xCE, 0x52, 0xFF,
-    0xCE, 0x7B, 0xFF, 0x4B, 0x4A, 0xFF, 0x8C, 0x5A, 0xFF, 0x4B, 0x52, 0xFF, 0x12, 0xAD, 0xFF, 0x8E, 0x73, 0xFF, 0xEE, 0x62, 0xFF, 0x1A, 0xBE, 0xFF, 0xAE, 0x5A, 0xFF, 0xB5, 0xC5, 0xFF, 0x39, 0xEF, 0xFF, 0xB3, 0xBD, 0xFF, 0x6F, 0xA4, 0xFF, 0xB1, 0xA4, 0xFF, 0x52, 0xBD, 0xFF, 0x13, 0xCE, 0xFF, 0xEE, 0xAC, 0xFF, 0x6F, 0x94, 0xFF, 0xF1, 0xA4, 0xFF, 0x50, 0x9C, 0xFF, 0x15, 0xD6, 0xFF, 0xB1, 0x93, 0xFF, 0x90, 0x73, 0xFF, 0xCF, 0x62, 0xFF, 0xB0, 0x62, 0xFF, 0xD7, 0xC5, 0xFF, 0xB3, 0x94, 0xFF, 0x6D, 0x52, 0xFF, 0x0B, 0x4A, 0xFF, 0x72, 0x73, 0xFF, 0x4F, 0x73, 0xFF, 0x78, 0xB5, 0xFF, 0xB1, 0x7B, 0xFF, 0x71, 0x73, 0xFF, 0xD3, 0x7B, 0xFF, 0x30, 0x6B, 0xFF, 0x58, 0xAD, 0xFF, 0x90, 0x62, 0xFF, 0x2C, 0x4A, 0xFF, 0x0B, 0x4A, 0xFF, 0x0C, 0x52, 0xFF, 0x56, 0xAD, 0xFF, 0x2F, 0x6B, 0xFF, 0x8E, 0x52, 0xFF, 0xD1, 0x62, 0xFF, 0x33, 0x6B, 0xFF, 0xD8, 0x94, 0xFF, 0x95, 0x73, 0xFF, 0xD8, 0x5A, 0xFF, 0x76, 0x6B, 0xFF, 0x15, 0x84, 0xFF, 0x59, 0xAD, 0xFF, 0x2F, 0x6B, 0xFF, 0xD1, 0x7B, 0xFF, 0x6F, 0x6B, 0xFF, 0x11, 0x84, 0xFF, 0xB8, 0xBD, 0xFF, 0xD2, 0xBD, 0xFF, 0x90, 0x94, 0xFF, 0x70, 0x8C, 0xFF, 0x2F, 0x8C, 0xFF, 0x11, 0xB5, 0xFF, 0x52, 0xBD, 0xFF, 0xAD, 0x73, 0xFF,
-    0x11, 0x8C, 0xFF, 0x73, 0x8C, 0xFF, 0xEC, 0x62, 0xFF, 0x74, 0xB5, 0xFF, 0x10, 0x84, 0xFF, 0x6D, 0x6B, 0xFF, 0xAF, 0x73, 0xFF, 0x6D, 0x6B, 0xFF, 0x33, 0xA5, 0xFF, 0x91, 0x94, 0xFF, 0xCB, 0x52, 0xFF, 0xCC, 0x52, 0xFF, 0x4E, 0x6B, 0xFF, 0x13, 0x9D, 0xFF, 0x8A, 0x4A, 0xFF, 0x2D, 0x63, 0xFF, 0x29, 0x4A, 0xFF, 0x32, 0x8C, 0xFF, 0xAC, 0x5A, 0xFF, 0x94, 0x94, 0xFF, 0xB4, 0x9C, 0xFF, 0xED, 0x62, 0xFF, 0x36, 0xAD, 0xFF, 0xEF, 0x62, 0xFF, 0xFB, 0xC5, 0xFF, 0x4D, 0x73, 0xFF, 0x6E, 0x94, 0xFF, 0x90, 0xBD, 0xFF, 0x2D, 0x94, 0xFF, 0x8E, 0x9C, 0xFF, 0xEF, 0xB4, 0xFF, 0xD1, 0xCD, 0xFF, 0x52, 0xD6, 0xFF, 0xD5, 0xE6, 0xFF, 0x4F, 0x9C, 0xFF, 0x6E, 0xA4, 0xFF, 0x33, 0xBD, 0xFF, 0xD7, 0xEE, 0xFF, 0xB7, 0xBD, 0xFF, 0x72, 0x7B, 0xFF, 0x90, 0x5A, 0xFF, 0x13, 0xA5, 0xFF, 0x37, 0xAD, 0xFF, 0xD2, 0x83, 0xFF, 0xAD, 0x52, 0xFF, 0xAD, 0x5A, 0xFF, 0x1B, 0xE7, 0xFF, 0xF6, 0xC5, 0xFF, 0xD1, 0x8B, 0xFF, 0xEE, 0x6A, 0xFF, 0xCE, 0x6A, 0xFF, 0x35, 0xBD, 0xFF, 0x78, 0xDE, 0xFF, 0x4F, 0x7B, 0xFF, 0x6C, 0x52, 0xFF, 0x2C, 0x4A, 0xFF, 0x2C, 0x4A, 0xFF, 0x38, 0xAD, 0xFF, 0x53, 0x8C, 0xFF, 0x2D, 0x4A, 0xFF, 0x15, 0x84, 0xFF, 0xF0, 0x41, 0xFF, 0xBA, 0x73, 0xFF, 0xD0, 0x5A, 0xFF,
-    0x15, 0x63, 0xFF, 0x14, 0x63, 0xFF, 0xBB, 0x94, 0xFF, 0xF0, 0x5A, 0xFF, 0xAE, 0x5A, 0xFF, 0x53, 0x94, 0xFF, 0x11, 0x8C, 0xFF, 0x7A, 0xCE, 0xFF, 0x8D, 0x73, 0xFF, 0xB0, 0x9C, 0xFF, 0x8C, 0x94, 0xFF, 0x6E, 0x94, 0xFF, 0x94, 0xDE, 0xFF, 0x0D, 0x8C, 0xFF, 0x2C, 0x8C, 0xFF, 0x4D, 0x94, 0xFF, 0x36, 0xE7, 0xFF, 0xAE, 0x83, 0xFF, 0x6C, 0x52, 0xFF, 0xED, 0x5A, 0xFF, 0x0C, 0x63, 0xFF, 0x53, 0xA5, 0xFF, 0xAA, 0x52, 0xFF, 0x6A, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0xAD, 0x52, 0xFF, 0x31, 0x84, 0xFF, 0x6A, 0x4A, 0xFF, 0xAB, 0x52, 0xFF, 0xCC, 0x5A, 0xFF, 0xCC, 0x5A, 0xFF, 0x90, 0x6B, 0xFF, 0x2C, 0x4A, 0xFF, 0xD3, 0x39, 0xFF, 0x2D, 0x4A, 0xFF, 0x4A, 0x4A, 0xFF, 0x6C, 0x52, 0xFF, 0xD8, 0x9C, 0xFF, 0xF8, 0x41, 0xFF, 0xF4, 0x62, 0xFF, 0xAD, 0x62, 0xFF, 0x18, 0xF7, 0xFF, 0xD4, 0xC5, 0xFF, 0x51, 0xC5, 0xFF, 0x10, 0xAD, 0xFF, 0x70, 0xCD, 0xFF, 0xF6, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0xAD, 0xB4, 0xFF, 0x2D, 0x94, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x50, 0xD5, 0xFF, 0xB2, 0xA4, 0xFF, 0x14, 0x8C, 0xFF, 0x1F, 0xB6, 0xFF, 0x1A, 0x63, 0xFF, 0xD2, 0x83, 0xFF, 0xEF, 0x62, 0xFF, 0x3C, 0x9D, 0xFF, 0x9B, 0x7B, 0xFF, 0xEE, 0x62, 0xFF, 0x4F, 0x73, 0xFF, 0x12, 0x9C, 0xFF,
-    0x5E, 0xF7, 0xFF, 0x4F, 0x73, 0xFF, 0x71, 0x73, 0xFF, 0xB0, 0x8B, 0xFF, 0x9A, 0xFF, 0xFF, 0x11, 0xCD, 0xFF, 0x8D, 0x5A, 0xFF, 0x0C, 0x4A, 0xFF, 0x32, 0x52, 0xFF, 0x7F, 0x5B, 0xFF, 0x33, 0x8C, 0xFF, 0x2C, 0x4A, 0xFF, 0x78, 0x94, 0xFF, 0xFE, 0x94, 0xFF, 0x0E, 0x42, 0xFF, 0xB0, 0x52, 0xFF, 0xB8, 0x52, 0xFF, 0x9E, 0x86, 0xFF, 0x9B, 0x4A, 0xFF, 0x6F, 0x52, 0xFF, 0x70, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xEE, 0xFF, 0xDE, 0xFF, 0xFF, 0xAD, 0x83, 0xFF, 0xD0, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xA4, 0xFF, 0x0C, 0x8C, 0xFF, 0x8D, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xC5, 0xFF, 0x4D, 0x9C, 0xFF, 0xAE, 0x7B, 0xFF, 0x5D, 0x2A, 0xFF, 0xDC, 0x52, 0xFF, 0x34, 0xAD, 0xFF, 0x71, 0x94, 0xFF, 0xED, 0x5A, 0xFF, 0xCC, 0x5A, 0xFF, 0x32, 0x7C, 0xFF, 0x6A, 0x52, 0xFF, 0x8A, 0x4A, 0xFF, 0xEC, 0x5A, 0xFF, 0x4D, 0x6B, 0xFF, 0x90, 0x6B, 0xFF, 0xCC, 0x52, 0xFF, 0x0D, 0x5B, 0xFF, 0x2B, 0x4A, 0xFF, 0x59, 0x31, 0xFF, 0x72, 0x52, 0xFF, 0x8D, 0x5A, 0xFF, 0xCB, 0x62, 0xFF, 0x6E, 0x5A, 0xFF, 0xB9, 0x41, 0xFF, 0xBD, 0x9C, 0xFF, 0x74, 0x8C, 0xFF, 0xAE, 0x7B, 0xFF, 0x6F, 0x9C, 0xFF, 0x14, 0xD6, 0xFF, 0xFA, 0xF7, 0xFF, 0x97, 0xDE, 0xFF, 0x12, 0xEE, 0xFF, 0xF9, 0xFF, 0xFF,
-    0x53, 0xD6, 0xFF, 0xF0, 0xAC, 0xFF, 0x8E, 0xAC, 0xFF, 0x32, 0xF6, 0xFF, 0x54, 0xDE, 0xFF, 0x53, 0xBD, 0xFF, 0xF1, 0x8B, 0xFF, 0x5B, 0x8C, 0xFF, 0xFE, 0xBD, 0xFF, 0xD7, 0xB4, 0xFF, 0xAD, 0x62, 0xFF, 0x8E, 0x5A, 0xFF, 0x9B, 0xC5, 0xFF, 0xD7, 0xA4, 0xFF, 0x90, 0x7B, 0xFF, 0x55, 0xB5, 0xFF, 0x56, 0xE6, 0xFF, 0x92, 0xA4, 0xFF, 0xF2, 0x8B, 0xFF, 0x59, 0x9C, 0xFF, 0x35, 0xCD, 0xFF, 0x91, 0xBC, 0xFF, 0x8D, 0x5A, 0xFF, 0x0C, 0x4A, 0xFF, 0xB9, 0x9C, 0xFF, 0x1A, 0x84, 0xFF, 0xF8, 0xA4, 0xFF, 0x4D, 0x4A, 0xFF, 0x3D, 0xE7, 0xFF, 0x6F, 0x4A, 0xFF, 0x2E, 0x4A, 0xFF, 0xB0, 0x62, 0xFF, 0x9D, 0x73, 0xFF, 0xBB, 0x5A, 0xFF, 0x97, 0x7B, 0xFF, 0x36, 0x8C, 0xFF, 0x58, 0xAD, 0xFF, 0x54, 0xA5, 0xFF, 0xEF, 0x8B, 0xFF, 0x57, 0xAD, 0xFF, 0xD6, 0xBD, 0xFF, 0x33, 0xBE, 0xFF, 0x0E, 0xCE, 0xFF, 0x6C, 0x94, 0xFF, 0x11, 0xA5, 0xFF, 0x92, 0xAD, 0xFF, 0xCC, 0xB4, 0xFF, 0xAA, 0x83, 0xFF, 0x0E, 0x84, 0xFF, 0xD0, 0x73, 0xFF, 0xAF, 0x52, 0xFF, 0x37, 0xA5, 0xFF, 0xF0, 0x7B, 0xFF, 0x2E, 0x63, 0xFF, 0xAA, 0x52, 0xFF, 0x69, 0x4A, 0xFF, 0x8A, 0x52, 0xFF, 0x2C, 0x63, 0xFF, 0xEB, 0x5A, 0xFF, 0xCB, 0x5A, 0xFF, 0xCB, 0x5A, 0xFF, 0xEC, 0x5A, 0xFF, 0x0D, 0x63, 0xFF, 0x0D, 0x5B, 0xFF,
-    0xC8, 0x41, 0xFF, 0x09, 0x42, 0xFF, 0x2A, 0x52, 0xFF, 0xE9, 0x49, 0xFF, 0x6A, 0x52, 0xFF, 0x6A, 0x52, 0xFF, 0x8B, 0x52, 0xFF, 0x35, 0xB5, 0xFF, 0xAB, 0x62, 0xFF, 0x2C, 0x73, 0xFF, 0x10, 0x8C, 0xFF, 0xCD, 0x8B, 0xFF, 0x4F, 0x9C, 0xFF, 0x8E, 0x9C, 0xFF, 0xF3, 0xD5, 0xFF, 0xEE, 0xB4, 0xFF, 0x6D, 0x9C, 0xFF, 0x4E, 0x9C, 0xFF, 0xAF, 0xA4, 0xFF, 0xF1, 0xB4, 0xFF, 0xED, 0x93, 0xFF, 0x51, 0x94, 0xFF, 0x52, 0x94, 0xFF, 0x52, 0x73, 0xFF, 0xD6, 0x9C, 0xFF, 0xD5, 0xA4, 0xFF, 0x70, 0x7B, 0xFF, 0x2D, 0x6B, 0xFF, 0xF7, 0xA4, 0xFF, 0x11, 0x84, 0xFF, 0x93, 0x9C, 0xFF, 0xAB, 0x62, 0xFF, 0x31, 0x8C, 0xFF, 0xD0, 0x83, 0xFF, 0x0D, 0x6B, 0xFF, 0x53, 0xB5, 0xFF, 0xD4, 0xA4, 0xFF, 0x0D, 0x6B, 0xFF, 0x8D, 0x5A, 0xFF, 0x6C, 0x5A, 0xFF, 0x2C, 0x4A, 0xFF, 0xCB, 0x41, 0xFF, 0x92, 0x9C, 0xFF, 0x2C, 0x4A, 0xFF, 0x34, 0x84, 0xFF, 0x6E, 0x52, 0xFF, 0x4E, 0x4A, 0xFF, 0x2E, 0x4A, 0xFF, 0x95, 0x7B, 0xFF, 0x0F, 0x42, 0xFF, 0xD2, 0x62, 0xFF, 0x31, 0x6B, 0xFF, 0xEE, 0x62, 0xFF, 0x92, 0x94, 0xFF, 0x4E, 0x73, 0xFF, 0x98, 0xB5, 0xFF, 0x6C, 0x7B, 0xFF, 0xB0, 0xA4, 0xFF, 0x6E, 0x94, 0xFF, 0x8E, 0x9C, 0xFF, 0xEC, 0x8B, 0xFF, 0xEC, 0x83, 0xFF, 0x2E, 0x8C, 0xFF, 0xCD, 0x83, 0xFF,
-    0x8B, 0x73, 0xFF, 0x0B, 0x63, 0xFF, 0xAB, 0x5A, 0xFF, 0xD3, 0x9C, 0xFF, 0x6D, 0x73, 0xFF, 0x4B, 0x6B, 0xFF, 0xEB, 0x62, 0xFF, 0xEB, 0x5A, 0xFF, 0x69, 0x4A, 0xFF, 0x0C, 0x63, 0xFF, 0xCB, 0x5A, 0xFF, 0xAB, 0x52, 0xFF, 0xCB, 0x5A, 0xFF, 0x0C, 0x5B, 0xFF, 0xCC, 0x5A, 0xFF, 0x0C, 0x5B, 0xFF, 0xE8, 0x41, 0xFF, 0x09, 0x4A, 0xFF, 0x4A, 0x4A, 0xFF, 0x09, 0x4A, 0xFF, 0xD3, 0xCD, 0xFF, 0xE8, 0x41, 0xFF, 0xEB, 0x62, 0xFF, 0xD2, 0xA4, 0xFF, 0xAA, 0x62, 0xFF, 0x6D, 0x7B, 0xFF, 0x79, 0xF7, 0xFF, 0x6C, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0x4D, 0x9C, 0xFF, 0x71, 0xC5, 0xFF, 0xD5, 0xEE, 0xFF, 0x2D, 0x9C, 0xFF, 0x4D, 0x9C, 0xFF, 0x8E, 0xAC, 0xFF, 0x2E, 0xA4, 0xFF, 0xD3, 0xCD, 0xFF, 0xAE, 0x83, 0xFF, 0x2E, 0x73, 0xFF, 0x2F, 0x6B, 0xFF, 0x94, 0x94, 0xFF, 0xB1, 0x83, 0xFF, 0xCE, 0x6A, 0xFF, 0xB0, 0x83, 0xFF, 0xB2, 0x9C, 0xFF, 0x52, 0x94, 0xFF, 0x91, 0x9C, 0xFF, 0xBE, 0xFF, 0xFF, 0x51, 0x9C, 0xFF, 0x2D, 0x73, 0xFF, 0x4D, 0x83, 0xFF, 0x12, 0xAD, 0xFF, 0x98, 0xE6, 0xFF, 0x4E, 0x73, 0xFF, 0xCD, 0x62, 0xFF, 0x6C, 0x5A, 0xFF, 0x6D, 0x52, 0xFF, 0xD8, 0xC5, 0xFF, 0x11, 0x8C, 0xFF, 0x4C, 0x4A, 0xFF, 0x1B, 0xCE, 0xFF, 0x2E, 0x4A, 0xFF, 0xBA, 0xBD, 0xFF, 0x4E, 0x52, 0xFF,
-    0x12, 0x63, 0xFF, 0x11, 0x4A, 0xFF, 0xFA, 0xA4, 0xFF, 0xBB, 0xBD, 0xFF, 0x0E, 0x6B, 0xFF, 0x51, 0x94, 0xFF, 0xEF, 0x8B, 0xFF, 0x76, 0xBD, 0xFF, 0x5F, 0xF7, 0xFF, 0x52, 0xB5, 0xFF, 0x4F, 0xB5, 0xFF, 0x4D, 0xBD, 0xFF, 0x6C, 0x9C, 0xFF, 0x10, 0xB5, 0xFF, 0x15, 0xD6, 0xFF, 0xAB, 0x7B, 0xFF, 0x2C, 0x8C, 0xFF, 0x2A, 0x6B, 0xFF, 0x0E, 0x8C, 0xFF, 0xB3, 0xC5, 0xFF, 0xEB, 0x62, 0xFF, 0x2C, 0x6B, 0xFF, 0xA9, 0x62, 0xFF, 0xEB, 0x62, 0xFF, 0x52, 0xAD, 0xFF, 0x2C, 0x6B, 0xFF, 0xAA, 0x52, 0xFF, 0xED, 0x5A, 0xFF, 0xEB, 0x5A, 0xFF, 0x32, 0xA5, 0xFF, 0x4D, 0x6B, 0xFF, 0xEC, 0x5A, 0xFF, 0x08, 0x4A, 0xFF, 0xB2, 0x9C, 0xFF, 0x08, 0x42, 0xFF, 0xF4, 0xA4, 0xFF, 0x69, 0x5A, 0xFF, 0xCE, 0x6A, 0xFF, 0xB3, 0xC5, 0xFF, 0x0E, 0x8C, 0xFF, 0x56, 0xDE, 0xFF, 0x12, 0xAC, 0xFF, 0xF3, 0xB4, 0xFF, 0x54, 0xDE, 0xFF, 0xEB, 0x8B, 0xFF, 0xF9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xAC, 0xBC, 0xFF, 0xB3, 0xE6, 0xFF, 0xF8, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xAD, 0xDD, 0xFF, 0x2D, 0x9C, 0xFF, 0xD2, 0xC5, 0xFF, 0x9E, 0xCE, 0xFF, 0x5C, 0x62, 0xFF, 0xB6, 0x9C, 0xFF, 0x4F, 0x73, 0xFF, 0x99, 0xD6, 0xFF, 0xFA, 0xCD, 0xFF, 0xD3, 0xA4, 0xFF, 0xAF, 0x83, 0xFF, 0x70, 0x9C, 0xFF, 0x14, 0xDE, 0xFF,
-    0xB1, 0xF5, 0xFF, 0x4C, 0x7B, 0xFF, 0xEB, 0x62, 0xFF, 0xF5, 0xEE, 0xFF, 0xD8, 0xFF, 0xFF, 0x4D, 0x94, 0xFF, 0xAB, 0x62, 0xFF, 0xAC, 0x62, 0xFF, 0xF3, 0xAC, 0xFF, 0xD5, 0xD5, 0xFF, 0x72, 0xA4, 0xFF, 0x4C, 0x52, 0xFF, 0xF6, 0x83, 0xFF, 0x3D, 0x53, 0xFF, 0x5B, 0x73, 0xFF, 0x4E, 0x52, 0xFF, 0xF4, 0x5A, 0xFF, 0x3F, 0x85, 0xFF, 0x7F, 0x9D, 0xFF, 0xB2, 0x5A, 0xFF, 0xEF, 0x6A, 0xFF, 0xB1, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0xDE, 0xFF, 0xED, 0x8B, 0xFF, 0x6D, 0x9C, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xD6, 0xFF, 0xCB, 0x83, 0xFF, 0x4E, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0xF7, 0xFF, 0xB4, 0xDE, 0xFF, 0xCA, 0x5A, 0xFF, 0x3E, 0x53, 0xFF, 0x39, 0x9C, 0xFF, 0xF3, 0x9C, 0xFF, 0x69, 0x4A, 0xFF, 0xAA, 0x5A, 0xFF, 0xB0, 0x73, 0xFF, 0xB1, 0x8C, 0xFF, 0x30, 0x84, 0xFF, 0xAA, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x0C, 0x5B, 0xFF, 0x0C, 0x5B, 0xFF, 0x8E, 0x6B, 0xFF, 0x07, 0x42, 0xFF, 0x49, 0x52, 0xFF, 0x28, 0x42, 0xFF, 0x8A, 0x5A, 0xFF, 0x69, 0x52, 0xFF, 0xD1, 0xAC, 0xFF, 0x92, 0xBD, 0xFF, 0x90, 0x94, 0xFF, 0x70, 0x9C, 0xFF, 0x92, 0xB4, 0xFF, 0x18, 0xD6, 0xFF, 0x50, 0xAD, 0xFF, 0xF0, 0xA4, 0xFF, 0x2B, 0xAD, 0xFF, 0x8F, 0xEE, 0xFF, 0x52, 0xDE, 0xFF,
-    0x4F, 0xB5, 0xFF, 0xEE, 0xBC, 0xFF, 0x51, 0xFF, 0xFF, 0x8F, 0xEE, 0xFF, 0xF1, 0xB4, 0xFF, 0x2E, 0x94, 0xFF, 0xF2, 0x6A, 0xFF, 0x1A, 0x4A, 0xFF, 0xD6, 0x9C, 0xFF, 0x6E, 0x7B, 0xFF, 0x2D, 0x73, 0xFF, 0x56, 0xBD, 0xFF, 0xB7, 0xBD, 0xFF, 0x54, 0xB5, 0xFF, 0xB4, 0xAC, 0xFF, 0x8C, 0x8B, 0xFF, 0xF3, 0xDD, 0xFF, 0x0A, 0x6B, 0xFF, 0x2C, 0x73, 0xFF, 0xB5, 0xC5, 0xFF, 0xF7, 0xFF, 0xFF, 0xF3, 0xE6, 0xFF, 0xAB, 0x5A, 0xFF, 0xCC, 0x62, 0xFF, 0xCC, 0x6A, 0xFF, 0x31, 0x94, 0xFF, 0xDA, 0xDE, 0xFF, 0x4D, 0x52, 0xFF, 0x5A, 0xAD, 0xFF, 0xBD, 0x52, 0xFF, 0x12, 0x4A, 0xFF, 0x6E, 0x5A, 0xFF, 0x35, 0x73, 0xFF, 0x39, 0x63, 0xFF, 0x7B, 0x9C, 0xFF, 0x35, 0x94, 0xFF, 0xF5, 0xA4, 0xFF, 0xB2, 0xA4, 0xFF, 0xD0, 0xE5, 0xFF, 0x7A, 0xF7, 0xFF, 0xD2, 0xA4, 0xFF, 0x52, 0xB5, 0xFF, 0x6D, 0xC5, 0xFF, 0x8C, 0xCD, 0xFF, 0x10, 0xB5, 0xFF, 0x10, 0xA5, 0xFF, 0xCB, 0x83, 0xFF, 0xCD, 0x9C, 0xFF, 0x72, 0xB5, 0xFF, 0x8F, 0x94, 0xFF, 0x6C, 0x73, 0xFF, 0x6E, 0x73, 0xFF, 0x6D, 0x7B, 0xFF, 0xEE, 0x7B, 0xFF, 0x68, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0xAE, 0x7B, 0xFF, 0xEA, 0x62, 0xFF, 0xEB, 0x5A, 0xFF, 0xAA, 0x52, 0xFF, 0xAA, 0x5A, 0xFF, 0xCB, 0x5A, 0xFF, 0xEB, 0x5A, 0xFF, 0xEC, 0x5A, 0xFF,
-    0x08, 0x42, 0xFF, 0x69, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x89, 0x52, 0xFF, 0x30, 0x94, 0xFF, 0xCA, 0x6A, 0xFF, 0x0B, 0x6B, 0xFF, 0x74, 0xBD, 0xFF, 0x0A, 0x73, 0xFF, 0x4F, 0x9C, 0xFF, 0x10, 0xAD, 0xFF, 0xEC, 0x8B, 0xFF, 0xEF, 0xAC, 0xFF, 0xCA, 0x8B, 0xFF, 0xCE, 0xAC, 0xFF, 0x4D, 0x9C, 0xFF, 0xEC, 0x93, 0xFF, 0x4C, 0x9C, 0xFF, 0x8E, 0xAC, 0xFF, 0xED, 0x8B, 0xFF, 0x0F, 0x94, 0xFF, 0x10, 0x94, 0xFF, 0x93, 0x9C, 0xFF, 0xD2, 0xA4, 0xFF, 0x0C, 0x6B, 0xFF, 0x37, 0xCE, 0xFF, 0xAE, 0x83, 0xFF, 0x4C, 0x73, 0xFF, 0xEC, 0x6A, 0xFF, 0x91, 0x9C, 0xFF, 0xEB, 0x6A, 0xFF, 0x2F, 0x94, 0xFF, 0x4D, 0x73, 0xFF, 0xAF, 0x83, 0xFF, 0xD3, 0xC5, 0xFF, 0x0F, 0x8C, 0xFF, 0xAE, 0x83, 0xFF, 0xCC, 0x62, 0xFF, 0xAC, 0x5A, 0xFF, 0x4B, 0x52, 0xFF, 0xAB, 0x5A, 0xFF, 0xB5, 0xBD, 0xFF, 0xCE, 0x62, 0xFF, 0x97, 0xBD, 0xFF, 0xCF, 0x62, 0xFF, 0x6E, 0x52, 0xFF, 0xCE, 0x5A, 0xFF, 0x6E, 0x52, 0xFF, 0x2E, 0x52, 0xFF, 0x95, 0x9C, 0xFF, 0x33, 0x8C, 0xFF, 0x0D, 0x63, 0xFF, 0x6D, 0x7B, 0xFF, 0xCE, 0x8B, 0xFF, 0x32, 0xAD, 0xFF, 0xD0, 0xA4, 0xFF, 0x2D, 0x94, 0xFF, 0x4D, 0x9C, 0xFF, 0x0C, 0x94, 0xFF, 0xEF, 0xAC, 0xFF, 0x0C, 0x84, 0xFF, 0x6A, 0x73, 0xFF, 0x8B, 0x7B, 0xFF,
-    0xD0, 0xA4, 0xFF, 0xCC, 0x83, 0xFF, 0xAD, 0x7B, 0xFF, 0xA9, 0x5A, 0xFF, 0x2B, 0x6B, 0xFF, 0xCD, 0x83, 0xFF, 0xAA, 0x5A, 0xFF, 0xAA, 0x5A, 0xFF, 0x50, 0x8C, 0xFF, 0x8C, 0x73, 0xFF, 0xAA, 0x52, 0xFF, 0xAA, 0x52, 0xFF, 0x0B, 0x63, 0xFF, 0xCA, 0x52, 0xFF, 0x4C, 0x6B, 0xFF, 0x0C, 0x63, 0xFF, 0xA7, 0x39, 0xFF, 0xC7, 0x41, 0xFF, 0x8D, 0x73, 0xFF, 0x8C, 0x73, 0xFF, 0x28, 0x4A, 0xFF, 0xD1, 0xA4, 0xFF, 0xED, 0x8B, 0xFF, 0xCB, 0x6A, 0xFF, 0x0B, 0x73, 0xFF, 0x2B, 0x73, 0xFF, 0x2E, 0x94, 0xFF, 0x93, 0xC5, 0xFF, 0x0C, 0x94, 0xFF, 0x6D, 0x9C, 0xFF, 0x6C, 0x9C, 0xFF, 0xCB, 0x8B, 0xFF, 0x0B, 0x94, 0xFF, 0x4C, 0x9C, 0xFF, 0x2C, 0x94, 0xFF, 0xEC, 0x8B, 0xFF, 0x8C, 0x83, 0xFF, 0xEE, 0x8B, 0xFF, 0xD2, 0xA4, 0xFF, 0x8E, 0x7B, 0xFF, 0x8E, 0x7B, 0xFF, 0x2C, 0x73, 0xFF, 0x90, 0x9C, 0xFF, 0x4F, 0x94, 0xFF, 0x4C, 0x73, 0xFF, 0x4D, 0x73, 0xFF, 0x0F, 0x8C, 0xFF, 0xCB, 0x62, 0xFF, 0x4C, 0x73, 0xFF, 0x8A, 0x5A, 0xFF, 0xCC, 0x62, 0xFF, 0xB0, 0xA4, 0xFF, 0x91, 0x94, 0xFF, 0xEC, 0x6A, 0xFF, 0xAB, 0x62, 0xFF, 0x6B, 0x5A, 0xFF, 0xAC, 0x5A, 0xFF, 0x8B, 0x52, 0xFF, 0xF3, 0xA4, 0xFF, 0x8C, 0x5A, 0xFF, 0x33, 0x8C, 0xFF, 0xEE, 0x62, 0xFF, 0x6D, 0x52, 0xFF, 0xEE, 0x62, 0xFF,
-    0x8E, 0x5A, 0xFF, 0xB0, 0x62, 0xFF, 0xF3, 0x8B, 0xFF, 0xF1, 0x83, 0xFF, 0x0D, 0x6B, 0xFF, 0x2C, 0x73, 0xFF, 0x2E, 0x94, 0xFF, 0x6E, 0x9C, 0xFF, 0x6E, 0x9C, 0xFF, 0xAB, 0x83, 0xFF, 0xEB, 0x8B, 0xFF, 0xCD, 0xAC, 0xFF, 0x4C, 0x9C, 0xFF, 0xCB, 0x83, 0xFF, 0x6A, 0x73, 0xFF, 0x4A, 0x73, 0xFF, 0xAC, 0x83, 0xFF, 0x0E, 0x8C, 0xFF, 0x6F, 0x94, 0xFF, 0x0A, 0x63, 0xFF, 0xC9, 0x62, 0xFF, 0xCE, 0x83, 0xFF, 0xA9, 0x5A, 0xFF, 0x4C, 0x6B, 0xFF, 0x6C, 0x6B, 0xFF, 0xCD, 0x7B, 0xFF, 0x89, 0x52, 0xFF, 0xAA, 0x52, 0xFF, 0x6D, 0x6B, 0xFF, 0xAA, 0x52, 0xFF, 0x6D, 0x6B, 0xFF, 0xCA, 0x52, 0xFF, 0x07, 0x42, 0xFF, 0xEB, 0x62, 0xFF, 0xAE, 0x7B, 0xFF, 0x94, 0xBD, 0xFF, 0x27, 0x4A, 0xFF, 0x88, 0x5A, 0xFF, 0x50, 0x9C, 0xFF, 0xCD, 0x6A, 0xFF, 0x33, 0x9C, 0xFF, 0x2C, 0x73, 0xFF, 0x0D, 0x94, 0xFF, 0xCE, 0xAC, 0xFF, 0xEB, 0xBC, 0xFF, 0x6C, 0xC5, 0xFF, 0xF0, 0xD5, 0xFF, 0x2B, 0x9C, 0xFF, 0x4B, 0x9C, 0xFF, 0x2F, 0xE7, 0xFF, 0x0F, 0xD6, 0xFF, 0x0C, 0x94, 0xFF, 0x6C, 0x7B, 0xFF, 0x0E, 0x94, 0xFF, 0x35, 0xBD, 0xFF, 0x11, 0x8C, 0xFF, 0xEF, 0x8B, 0xFF, 0x4D, 0x7B, 0xFF, 0x0D, 0x94, 0xFF, 0x2D, 0xB5, 0xFF, 0x6F, 0x9C, 0xFF, 0x2D, 0x73, 0xFF, 0x0E, 0x8C, 0xFF, 0xAD, 0x83, 0xFF,
-    0xCD, 0x83, 0xFF, 0x2B, 0x73, 0xFF, 0x6A, 0x52, 0xFF, 0xD0, 0xA4, 0xFF, 0x11, 0xAD, 0xFF, 0x0C, 0x6B, 0xFF, 0x8B, 0x5A, 0xFF, 0x8B, 0x5A, 0xFF, 0x6A, 0x5A, 0xFF, 0x13, 0xA5, 0xFF, 0xB4, 0xB5, 0xFF, 0x8C, 0x5A, 0xFF, 0xD4, 0xA4, 0xFF, 0x51, 0x73, 0xFF, 0x8E, 0x5A, 0xFF, 0x8D, 0x5A, 0xFF, 0xAE, 0x5A, 0xFF, 0x90, 0x5A, 0xFF, 0x77, 0x7B, 0xFF, 0xF3, 0x83, 0xFF, 0x6F, 0x7B, 0xFF, 0x8D, 0x7B, 0xFF, 0x4E, 0xBD, 0xFF, 0x93, 0xFF, 0xFF, 0x4D, 0x9C, 0xFF, 0xCB, 0x83, 0xFF, 0x4B, 0x9C, 0xFF, 0xAF, 0xFE, 0xFF, 0x8D, 0xEE, 0xFF, 0x0A, 0x9C, 0xFF, 0xB6, 0xE6, 0xFF, 0xCC, 0x83, 0xFF, 0xB7, 0xCD, 0xFF, 0x74, 0xBD, 0xFF, 0x4E, 0x94, 0xFF, 0xD3, 0xCD, 0xFF, 0xC9, 0x62, 0xFF, 0xEC, 0x62, 0xFF, 0xDA, 0xBD, 0xFF, 0xEB, 0x62, 0xFF, 0x37, 0xCE, 0xFF, 0xCA, 0x62, 0xFF, 0x89, 0x52, 0xFF, 0x92, 0x8C, 0xFF, 0x4C, 0x6B, 0xFF, 0xD7, 0x9C, 0xFF, 0xAA, 0x52, 0xFF, 0xEB, 0x5A, 0xFF, 0x3A, 0xEF, 0xFF, 0x74, 0xBD, 0xFF, 0xD3, 0x9C, 0xFF, 0xB0, 0xA4, 0xFF, 0x15, 0xC6, 0xFF, 0x55, 0xDE, 0xFF, 0xAF, 0x83, 0xFF, 0x9B, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0xD6, 0xFF, 0xD6, 0xEE, 0xFF, 0xAC, 0xA4, 0xFF, 0xF0, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD6, 0xFF, 0x77, 0xFF, 0xFF,
-    0xB3, 0xDE, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x13, 0xC6, 0xFF, 0xEC, 0x8B, 0xFF, 0x2E, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0xC6, 0xFF, 0xF3, 0xA4, 0xFF, 0xF2, 0xA4, 0xFF, 0x10, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0xBD, 0xFF, 0xCD, 0x83, 0xFF, 0x8B, 0x83, 0xFF, 0xFD, 0xFF, 0xFF, 0xDB, 0xF7, 0xFF, 0x2F, 0x8C, 0xFF, 0x0B, 0x6B, 0xFF, 0x77, 0xF7, 0xFF, 0xF9, 0xE6, 0xFF, 0x2B, 0x73, 0xFF, 0xAB, 0x62, 0xFF, 0x6A, 0x5A, 0xFF, 0x91, 0xA4, 0xFF, 0x9B, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0x0E, 0x6B, 0xFF, 0x18, 0xC6, 0xFF, 0x1D, 0xA5, 0xFF, 0x73, 0x9C, 0xFF, 0xCD, 0x6A, 0xFF, 0xB5, 0x9C, 0xFF, 0x9B, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x94, 0xFF, 0x51, 0x94, 0xFF, 0xB1, 0x94, 0xFF, 0xF8, 0xDE, 0xFF, 0xD9, 0xFF, 0xFF, 0xCF, 0xAC, 0xFF, 0x90, 0x9C, 0xFF, 0xB1, 0xC5, 0xFF, 0xF6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x0F, 0xAD, 0xFF, 0xD0, 0x9C, 0xFF, 0xB3, 0xB5, 0xFF, 0x12, 0x9C, 0xFF, 0x10, 0xA5, 0xFF, 0xD1, 0xA4, 0xFF, 0x12, 0x9D, 0xFF, 0xC9, 0x62, 0xFF, 0x4F, 0x6B, 0xFF, 0xAE, 0x73, 0xFF, 0x89, 0x5A, 0xFF, 0xEA, 0x62, 0xFF, 0x0A, 0x6B, 0xFF, 0xCA, 0x5A, 0xFF, 0xCA, 0x5A, 0xFF, 0x0F, 0x84, 0xFF, 0x0B, 0x63, 0xFF, 0x6C, 0x6B, 0xFF, 0xEB, 0x5A, 0xFF,
-    0x2C, 0x6B, 0xFF, 0x48, 0x52, 0xFF, 0x07, 0x42, 0xFF, 0x48, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0x50, 0x94, 0xFF, 0x89, 0x5A, 0xFF, 0x30, 0x94, 0xFF, 0xB5, 0xCD, 0xFF, 0x68, 0x5A, 0xFF, 0x2A, 0x73, 0xFF, 0x49, 0x7B, 0xFF, 0xAC, 0xAC, 0xFF, 0x6A, 0x9C, 0xFF, 0x4B, 0x9C, 0xFF, 0xEB, 0x8B, 0xFF, 0xEB, 0x8B, 0xFF, 0x4C, 0xA4, 0xFF, 0xEB, 0x93, 0xFF, 0x6D, 0x9C, 0xFF, 0x8F, 0x9C, 0xFF, 0xCE, 0x8B, 0xFF, 0xD1, 0xA4, 0xFF, 0xEF, 0x8B, 0xFF, 0x0F, 0x94, 0xFF, 0x0F, 0x94, 0xFF, 0xCB, 0x83, 0xFF, 0xAD, 0x8B, 0xFF, 0xED, 0x8B, 0xFF, 0xEB, 0x6A, 0xFF, 0x8D, 0x7B, 0xFF, 0x0F, 0x8C, 0xFF, 0x8D, 0x7B, 0xFF, 0x34, 0xAD, 0xFF, 0xCC, 0x62, 0xFF, 0x4D, 0x8C, 0xFF, 0xB1, 0x9C, 0xFF, 0xAC, 0x62, 0xFF, 0xAC, 0x62, 0xFF, 0x6B, 0x5A, 0xFF, 0xAA, 0x5A, 0xFF, 0xCE, 0x83, 0xFF, 0x94, 0xB5, 0xFF, 0x8B, 0x5A, 0xFF, 0xD4, 0xA4, 0xFF, 0xED, 0x6A, 0xFF, 0x6E, 0x73, 0xFF, 0xAC, 0x62, 0xFF, 0x8C, 0x5A, 0xFF, 0xAE, 0x62, 0xFF, 0x51, 0x6B, 0xFF, 0x52, 0x94, 0xFF, 0xAE, 0x83, 0xFF, 0xAD, 0x83, 0xFF, 0xAC, 0x83, 0xFF, 0x6E, 0x9C, 0xFF, 0x0C, 0x8C, 0xFF, 0xEC, 0x83, 0xFF, 0xEA, 0x8B, 0xFF, 0x4D, 0xBD, 0xFF, 0x4A, 0x9C, 0xFF, 0x0B, 0x94, 0xFF, 0x6A, 0x73, 0xFF, 0x4A, 0x73, 0xFF,
-    0x4A, 0x73, 0xFF, 0xB0, 0x9C, 0xFF, 0x8B, 0x7B, 0xFF, 0xEA, 0x62, 0xFF, 0xA8, 0x5A, 0xFF, 0x68, 0x52, 0xFF, 0x89, 0x5A, 0xFF, 0xCA, 0x62, 0xFF, 0x89, 0x52, 0xFF, 0x88, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0xAA, 0x52, 0xFF, 0x89, 0x4A, 0xFF, 0xCA, 0x5A, 0xFF, 0xC7, 0x41, 0xFF, 0xE7, 0x41, 0xFF, 0xC7, 0x39, 0xFF, 0x08, 0x4A, 0xFF, 0x28, 0x4A, 0xFF, 0x6C, 0x73, 0xFF, 0x89, 0x5A, 0xFF, 0xEB, 0x6A, 0xFF, 0x6C, 0x73, 0xFF, 0x88, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x73, 0xFF, 0x30, 0xB5, 0xFF, 0x2D, 0x94, 0xFF, 0xEC, 0x8B, 0xFF, 0x8A, 0x7B, 0xFF, 0x6E, 0x9C, 0xFF, 0xCB, 0x8B, 0xFF, 0xCB, 0x8B, 0xFF, 0x10, 0xB5, 0xFF, 0xF0, 0xAC, 0xFF, 0xCD, 0x8B, 0xFF, 0xAD, 0x83, 0xFF, 0x4B, 0x7B, 0xFF, 0xCE, 0x8B, 0xFF, 0xAD, 0x83, 0xFF, 0x2E, 0x94, 0xFF, 0x4C, 0x73, 0xFF, 0x4C, 0x7B, 0xFF, 0x6D, 0x7B, 0xFF, 0x51, 0x94, 0xFF, 0x8E, 0x7B, 0xFF, 0xCC, 0x62, 0xFF, 0x52, 0x94, 0xFF, 0xED, 0x62, 0xFF, 0x6D, 0x73, 0xFF, 0x8E, 0x7B, 0xFF, 0x8C, 0x5A, 0xFF, 0x4A, 0x52, 0xFF, 0x6B, 0x52, 0xFF, 0x6B, 0x5A, 0xFF, 0x6E, 0x7B, 0xFF, 0x13, 0xA5, 0xFF, 0xEC, 0x62, 0xFF, 0x72, 0x9C, 0xFF, 0x2E, 0x73, 0xFF, 0x8E, 0x7B, 0xFF, 0xEC, 0x6A, 0xFF,
-    0x6B, 0x5A, 0xFF, 0x2D, 0x73, 0xFF, 0x8F, 0x7B, 0xFF, 0xCF, 0x83, 0xFF, 0xEF, 0x8B, 0xFF, 0x4B, 0x7B, 0xFF, 0x4A, 0x73, 0xFF, 0xEC, 0x8B, 0xFF, 0xAF, 0xA4, 0xFF, 0x8A, 0x7B, 0xFF, 0xCB, 0x8B, 0xFF, 0xAD, 0xA4, 0xFF, 0xA9, 0x83, 0xFF, 0x8A, 0x83, 0xFF, 0x29, 0x73, 0xFF, 0x29, 0x73, 0xFF, 0x2A, 0x73, 0xFF, 0x6F, 0x9C, 0xFF, 0x2A, 0x6B, 0xFF, 0xC9, 0x62, 0xFF, 0x88, 0x5A, 0xFF, 0x88, 0x5A, 0xFF, 0x68, 0x52, 0xFF, 0x88, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x88, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0xCA, 0x5A, 0xFF, 0xA6, 0x39, 0xFF, 0x48, 0x52, 0xFF, 0xC7, 0x39, 0xFF, 0x07, 0x4A, 0xFF, 0x28, 0x4A, 0xFF, 0x89, 0x5A, 0xFF, 0x69, 0x5A, 0xFF, 0x6E, 0x7B, 0xFF, 0xCB, 0x6A, 0xFF, 0x93, 0xC5, 0xFF, 0xEA, 0x6A, 0xFF, 0xEA, 0x72, 0xFF, 0xAE, 0xA4, 0xFF, 0xAE, 0xAC, 0xFF, 0x8A, 0x83, 0xFF, 0x8A, 0x7B, 0xFF, 0xAA, 0x83, 0xFF, 0x0B, 0x94, 0xFF, 0x0A, 0x94, 0xFF, 0xD4, 0xEE, 0xFF, 0x51, 0xBD, 0xFF, 0x2E, 0x94, 0xFF, 0x8C, 0x83, 0xFF, 0x2D, 0x94, 0xFF, 0x4B, 0x7B, 0xFF, 0x2A, 0x73, 0xFF, 0x92, 0xBD, 0xFF, 0xED, 0x8B, 0xFF, 0xAC, 0x83, 0xFF, 0x10, 0x8C, 0xFF, 0x38, 0xCE, 0xFF, 0x6F, 0x7B, 0xFF,
-    0x4D, 0x5A, 0xFF, 0xF5, 0xAC, 0xFF, 0x15, 0xAD, 0xFF, 0x0D, 0x6B, 0xFF, 0xB3, 0x9C, 0xFF, 0xAD, 0x5A, 0xFF, 0x4B, 0x52, 0xFF, 0x6B, 0x52, 0xFF, 0xCB, 0x62, 0xFF, 0x71, 0x94, 0xFF, 0x32, 0xAD, 0xFF, 0x8B, 0x5A, 0xFF, 0x14, 0xAD, 0xFF, 0xCD, 0x83, 0xFF, 0x4C, 0x73, 0xFF, 0xEC, 0x6A, 0xFF, 0x6A, 0x5A, 0xFF, 0x0C, 0x73, 0xFF, 0x2E, 0x73, 0xFF, 0x6D, 0x7B, 0xFF, 0x33, 0xB5, 0xFF, 0x8C, 0x83, 0xFF, 0x8D, 0x9C, 0xFF, 0x6B, 0x9C, 0xFF, 0xAE, 0xA4, 0xFF, 0xCB, 0x8B, 0xFF, 0xC9, 0x83, 0xFF, 0x0D, 0xB5, 0xFF, 0xEC, 0xB4, 0xFF, 0xAA, 0x83, 0xFF, 0x29, 0x73, 0xFF, 0x2A, 0x73, 0xFF, 0xEB, 0x6A, 0xFF, 0xAD, 0x83, 0xFF, 0x2A, 0x6B, 0xFF, 0xA9, 0x62, 0xFF, 0x67, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x69, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x89, 0x5A, 0xFF, 0x89, 0x5A, 0xFF, 0x89, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0xAA, 0x5A, 0xFF, 0xAA, 0x5A, 0xFF, 0xAA, 0x52, 0xFF, 0xA7, 0x39, 0xFF, 0x08, 0x4A, 0xFF, 0xE7, 0x41, 0xFF, 0x29, 0x52, 0xFF, 0x07, 0x4A, 0xFF, 0x8A, 0x5A, 0xFF, 0x49, 0x52, 0xFF, 0x0E, 0x73, 0xFF, 0x5C, 0xA5, 0xFF, 0x98, 0xDE, 0xFF, 0xAE, 0x83, 0xFF, 0x2F, 0x94, 0xFF, 0x4D, 0xC5, 0xFF, 0x96, 0xF7, 0xFF, 0xCC, 0xC4, 0xFF, 0x0C, 0x94, 0xFF,
-    0x8C, 0xA4, 0xFF, 0xB1, 0xF7, 0xFF, 0xF5, 0xFF, 0xFF, 0xB2, 0xE6, 0xFF, 0xD3, 0xCD, 0xFF, 0x95, 0xE6, 0xFF, 0x92, 0xFE, 0xFF, 0xD9, 0xFF, 0xFF, 0x4E, 0x94, 0xFF, 0x2F, 0x94, 0xFF, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xAC, 0xFF, 0x11, 0x8C, 0xFF, 0xD0, 0x8B, 0xFF, 0x38, 0x94, 0xFF, 0xDF, 0x73, 0xFF, 0x92, 0x7B, 0xFF, 0xB2, 0x83, 0xFF, 0x18, 0xAD, 0xFF, 0x99, 0xA5, 0xFF, 0xB1, 0x83, 0xFF, 0x6C, 0x5A, 0xFF, 0xAC, 0x62, 0xFF, 0x8E, 0x93, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x4E, 0x7B, 0xFF, 0x7A, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF, 0xF0, 0xC4, 0xFF, 0xD0, 0x8B, 0xFF, 0x8E, 0x7B, 0xFF, 0x55, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x8B, 0xFF, 0x90, 0x9C, 0xFF, 0xF1, 0xAC, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x56, 0xD6, 0xFF, 0x30, 0xB5, 0xFF, 0x8E, 0xBD, 0xFF, 0xFB, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xEE, 0xAC, 0xFF, 0x6F, 0x9C, 0xFF, 0xD4, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xCE, 0xFF, 0xEE, 0x83, 0xFF, 0x2F, 0x8C, 0xFF, 0x8C, 0x7B, 0xFF, 0x19, 0x84, 0xFF, 0xF3, 0xA4, 0xFF, 0x2F, 0x8C, 0xFF, 0xAE, 0x7B, 0xFF, 0x0F, 0x84, 0xFF, 0xCA, 0x5A, 0xFF, 0xEF, 0x7B, 0xFF, 0xAA, 0x52, 0xFF, 0x0F, 0x84, 0xFF, 0x89, 0x52, 0xFF, 0x0B, 0x63, 0xFF,
-    0xB4, 0x9C, 0xFF, 0xC8, 0x49, 0xFF, 0xB3, 0x94, 0xFF, 0x08, 0x4A, 0xFF, 0xE6, 0x49, 0xFF, 0x95, 0xBD, 0xFF, 0x4A, 0x52, 0xFF, 0xB7, 0xBD, 0xFF, 0xD2, 0x72, 0xFF, 0x2D, 0x7B, 0xFF, 0x34, 0xDE, 0xFF, 0x8B, 0x8B, 0xFF, 0xAC, 0xC5, 0xFF, 0x2D, 0xE6, 0xFF, 0x0B, 0x9C, 0xFF, 0x76, 0xFF, 0xFF, 0x29, 0xA4, 0xFF, 0x51, 0xE6, 0xFF, 0x12, 0xFF, 0xFF, 0xCD, 0xB4, 0xFF, 0x92, 0xCD, 0xFF, 0x74, 0xE6, 0xFF, 0x6E, 0xCD, 0xFF, 0x73, 0xDE, 0xFF, 0x6C, 0x83, 0xFF, 0x0A, 0x73, 0xFF, 0xF5, 0xCD, 0xFF, 0x2F, 0xCD, 0xFF, 0xAD, 0x8B, 0xFF, 0x4E, 0x7B, 0xFF, 0x2F, 0x73, 0xFF, 0x1C, 0xD6, 0xFF, 0x1D, 0x84, 0xFF, 0x11, 0x73, 0xFF, 0x34, 0x94, 0xFF, 0x35, 0x94, 0xFF, 0xDC, 0xC5, 0xFF, 0x6D, 0x52, 0xFF, 0x4B, 0x52, 0xFF, 0x6B, 0x52, 0xFF, 0xEC, 0x72, 0xFF, 0x7A, 0xDE, 0xFF, 0x74, 0xB5, 0xFF, 0xEC, 0x6A, 0xFF, 0x92, 0xA4, 0xFF, 0xCD, 0x8B, 0xFF, 0x79, 0xD6, 0xFF, 0x0B, 0x73, 0xFF, 0xEB, 0x72, 0xFF, 0x0D, 0x73, 0xFF, 0x71, 0x83, 0xFF, 0xBC, 0xFF, 0xFF, 0x8F, 0xA4, 0xFF, 0x0D, 0x94, 0xFF, 0x32, 0xDE, 0xFF, 0x4B, 0xAC, 0xFF, 0xF6, 0xEE, 0xFF, 0xFD, 0xFF, 0xFF, 0xCD, 0xAC, 0xFF, 0x4C, 0xD6, 0xFF, 0xEC, 0xC5, 0xFF, 0xEA, 0x93, 0xFF, 0x4C, 0x9C, 0xFF, 0x4B, 0x7B, 0xFF,
-    0x8E, 0x83, 0xFF, 0xCA, 0x6A, 0xFF, 0x8C, 0x83, 0xFF, 0xC9, 0x62, 0xFF, 0x0A, 0x73, 0xFF, 0x89, 0x5A, 0xFF, 0x88, 0x5A, 0xFF, 0x6C, 0x7B, 0xFF, 0x69, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0xA9, 0x5A, 0xFF, 0x89, 0x52, 0xFF, 0xAA, 0x5A, 0xFF, 0x89, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x66, 0x39, 0xFF, 0x8E, 0x7B, 0xFF, 0x87, 0x39, 0xFF, 0xCB, 0x62, 0xFF, 0x50, 0x94, 0xFF, 0xE8, 0x49, 0xFF, 0x49, 0x52, 0xFF, 0xE8, 0x51, 0xFF, 0x6A, 0x62, 0xFF, 0xEB, 0x72, 0xFF, 0xCA, 0x6A, 0xFF, 0x2F, 0x9C, 0xFF, 0x4A, 0x83, 0xFF, 0x4A, 0x83, 0xFF, 0xCF, 0xB4, 0xFF, 0x6A, 0x83, 0xFF, 0x2A, 0x7B, 0xFF, 0x8A, 0x8B, 0xFF, 0xAE, 0xAC, 0xFF, 0x6A, 0x83, 0xFF, 0xAC, 0x8B, 0xFF, 0x12, 0xBD, 0xFF, 0xED, 0x9B, 0xFF, 0x8F, 0xA4, 0xFF, 0x2C, 0x7B, 0xFF, 0xCE, 0x8B, 0xFF, 0xCE, 0x8B, 0xFF, 0x6E, 0x7B, 0xFF, 0xCC, 0x6A, 0xFF, 0xAC, 0x62, 0xFF, 0x8C, 0x62, 0xFF, 0x34, 0x94, 0xFF, 0x93, 0x83, 0xFF, 0xAE, 0x5A, 0xFF, 0x10, 0x73, 0xFF, 0xB2, 0x83, 0xFF, 0x53, 0x94, 0xFF, 0x6D, 0x5A, 0xFF, 0x4C, 0x5A, 0xFF, 0x4C, 0x52, 0xFF, 0xAC, 0x62, 0xFF, 0x2D, 0x73, 0xFF, 0x14, 0xAD, 0xFF, 0xAB, 0x62, 0xFF, 0xB3, 0xA4, 0xFF, 0x0C, 0x73, 0xFF, 0xCB, 0x6A, 0xFF, 0xEB, 0x72, 0xFF,
-    0xEC, 0x6A, 0xFF, 0xEB, 0x72, 0xFF, 0xAA, 0x6A, 0xFF, 0x0F, 0x94, 0xFF, 0x4F, 0x9C, 0xFF, 0x8B, 0x83, 0xFF, 0x71, 0xBD, 0xFF, 0x49, 0x7B, 0xFF, 0x6A, 0x83, 0xFF, 0x49, 0x7B, 0xFF, 0x0E, 0xB5, 0xFF, 0x2B, 0x9C, 0xFF, 0x0B, 0x94, 0xFF, 0x69, 0x83, 0xFF, 0x29, 0x73, 0xFF, 0x2A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x73, 0xFF, 0x88, 0x62, 0xFF, 0x88, 0x62, 0xFF, 0x8C, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x48, 0x52, 0xFF, 0x8C, 0x7B, 0xFF, 0x68, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x6C, 0x73, 0xFF, 0x48, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x86, 0x31, 0xFF, 0x4C, 0x73, 0xFF, 0xA8, 0x41, 0xFF, 0xB3, 0xA4, 0xFF, 0x55, 0xB5, 0xFF, 0x09, 0x4A, 0xFF, 0x29, 0x52, 0xFF, 0xAF, 0x83, 0xFF, 0x4A, 0x5A, 0xFF, 0x69, 0x5A, 0xFF, 0x0B, 0x73, 0xFF, 0xC9, 0x72, 0xFF, 0x2A, 0x7B, 0xFF, 0xAC, 0x93, 0xFF, 0x4B, 0x83, 0xFF, 0x6B, 0x8B, 0xFF, 0x4B, 0x83, 0xFF, 0x4B, 0x83, 0xFF, 0xB0, 0xB4, 0xFF, 0xED, 0x93, 0xFF, 0x8C, 0x8B, 0xFF, 0x52, 0xC5, 0xFF, 0x4F, 0xA4, 0xFF, 0x0E, 0x9C, 0xFF, 0x2C, 0x7B, 0xFF, 0xCF, 0x8B, 0xFF, 0xCB, 0x6A, 0xFF, 0xED, 0x6A, 0xFF, 0x4F, 0x7B, 0xFF, 0xCD, 0x6A, 0xFF, 0x4D, 0x5A, 0xFF, 0x74, 0x9C, 0xFF,
-    0x72, 0x7B, 0xFF, 0x4D, 0x5A, 0xFF, 0x6D, 0x5A, 0xFF, 0x91, 0x7B, 0xFF, 0x10, 0x6B, 0xFF, 0x8E, 0x5A, 0xFF, 0x2C, 0x52, 0xFF, 0x6D, 0x5A, 0xFF, 0xCD, 0x6A, 0xFF, 0xED, 0x6A, 0xFF, 0xF6, 0xD5, 0xFF, 0xED, 0x6A, 0xFF, 0x18, 0xD6, 0xFF, 0x6D, 0x83, 0xFF, 0x2C, 0x7B, 0xFF, 0xEB, 0x72, 0xFF, 0x0C, 0x73, 0xFF, 0x0B, 0x73, 0xFF, 0x0B, 0x7B, 0xFF, 0x4F, 0xA4, 0xFF, 0x2E, 0x9C, 0xFF, 0x8C, 0x8B, 0xFF, 0xB4, 0xD5, 0xFF, 0x6D, 0xA4, 0xFF, 0xAB, 0x8B, 0xFF, 0x6A, 0x83, 0xFF, 0x50, 0xC5, 0xFF, 0xCA, 0x8B, 0xFF, 0x54, 0xDE, 0xFF, 0x8A, 0x83, 0xFF, 0x6A, 0x7B, 0xFF, 0x2A, 0x73, 0xFF, 0x0A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0xEA, 0x6A, 0xFF, 0x88, 0x62, 0xFF, 0x6B, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0x68, 0x5A, 0xFF, 0x68, 0x52, 0xFF, 0xA9, 0x5A, 0xFF, 0x89, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0xA9, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x87, 0x39, 0xFF, 0xE8, 0x49, 0xFF, 0xA7, 0x39, 0xFF, 0xAB, 0x62, 0xFF, 0x0D, 0x73, 0xFF, 0x0A, 0x4A, 0xFF, 0xE9, 0x49, 0xFF, 0x36, 0xB5, 0xFF, 0x4A, 0x5A, 0xFF, 0x2C, 0x7B, 0xFF, 0xC9, 0x6A, 0xFF, 0xAC, 0x93, 0xFF, 0xAB, 0x93, 0xFF, 0xCD, 0x9B, 0xFF, 0x8D, 0x8B, 0xFF, 0x4B, 0x8B, 0xFF,
-    0x2A, 0x8B, 0xFF, 0xAD, 0x9B, 0xFF, 0x93, 0xDD, 0xFF, 0x70, 0xAC, 0xFF, 0xAD, 0x9B, 0xFF, 0x8E, 0xB4, 0xFF, 0xEF, 0xC4, 0xFF, 0xD1, 0xBC, 0xFF, 0x0D, 0x7B, 0xFF, 0xAF, 0x8B, 0xFF, 0x11, 0x9C, 0xFF, 0x2F, 0x7B, 0xFF, 0x6C, 0x5A, 0xFF, 0x71, 0x7B, 0xFF, 0xEC, 0x51, 0xFF, 0xDA, 0xAC, 0xFF, 0xD3, 0x6A, 0xFF, 0xD1, 0x6A, 0xFF, 0x4D, 0x5A, 0xFF, 0x57, 0xBD, 0xFF, 0xD2, 0x62, 0xFF, 0x97, 0x9C, 0xFF, 0x4D, 0x5A, 0xFF, 0x6D, 0x5A, 0xFF, 0xEF, 0x72, 0xFF, 0xB4, 0xAC, 0xFF, 0x9F, 0xFF, 0xFF, 0xCD, 0x72, 0xFF, 0xB6, 0xCD, 0xFF, 0x0F, 0x9C, 0xFF, 0x8C, 0x93, 0xFF, 0x6D, 0x8B, 0xFF, 0xF3, 0xBC, 0xFF, 0x0E, 0x94, 0xFF, 0xAB, 0x9B, 0xFF, 0xD1, 0xD5, 0xFF, 0x6E, 0xAC, 0xFF, 0x0D, 0x9C, 0xFF, 0x98, 0xFF, 0xFF, 0x0E, 0xCD, 0xFF, 0xAD, 0xBC, 0xFF, 0xCB, 0x93, 0xFF, 0x90, 0xCD, 0xFF, 0x4B, 0xA4, 0xFF, 0x10, 0xE6, 0xFF, 0x6B, 0xAC, 0xFF, 0x69, 0x83, 0xFF, 0x29, 0x7B, 0xFF, 0xAC, 0x8B, 0xFF, 0x4C, 0x7B, 0xFF, 0x8D, 0x83, 0xFF, 0xCA, 0x6A, 0xFF, 0x0A, 0x6B, 0xFF, 0xCA, 0x62, 0xFF, 0x2B, 0x73, 0xFF, 0x88, 0x5A, 0xFF, 0x69, 0x5A, 0xFF, 0xA9, 0x5A, 0xFF, 0x48, 0x52, 0xFF, 0x89, 0x5A, 0xFF, 0x48, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x6A, 0x52, 0xFF, 0xAA, 0x52, 0xFF,
-    0xC8, 0x41, 0xFF, 0xC9, 0x41, 0xFF, 0xE9, 0x49, 0xFF, 0xC9, 0x41, 0xFF, 0xAF, 0x7B, 0xFF, 0x0C, 0x4A, 0xFF, 0x16, 0x6B, 0xFF, 0x3C, 0x39, 0xFF, 0xD0, 0x6A, 0xFF, 0xD1, 0xA4, 0xFF, 0x6E, 0xA4, 0xFF, 0x6C, 0xE6, 0xFF, 0xFD, 0xFF, 0xFF, 0xD1, 0xCD, 0xFF, 0x4B, 0x83, 0xFF, 0x2E, 0xB4, 0xFF, 0x8C, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0x11, 0xDE, 0xFF, 0x30, 0xC5, 0xFF, 0x0C, 0xA4, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0xE6, 0xFF, 0x2C, 0x7B, 0xFF, 0xD3, 0x8B, 0xFF, 0x38, 0xE5, 0xFF, 0xDF, 0xFF, 0xFF, 0x7B, 0xB5, 0xFF, 0xAE, 0x6A, 0xFF, 0xB4, 0x49, 0xFF, 0xFF, 0xD7, 0xFF, 0x1E, 0x84, 0xFF, 0xEE, 0x49, 0xFF, 0xCD, 0x49, 0xFF, 0xBF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x49, 0xFF, 0x4F, 0x5A, 0xFF, 0x8F, 0x62, 0xFF, 0xF4, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0xBD, 0xFF, 0xEE, 0x7A, 0xFF, 0x72, 0xAC, 0xFF, 0xF1, 0xF5, 0xFF, 0xFE, 0xFF, 0xFF, 0xAC, 0x9B, 0xFF, 0x4C, 0x83, 0xFF, 0xEE, 0x9B, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xCC, 0xA3, 0xFF, 0x4A, 0x8B, 0xFF, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x2B, 0xAC, 0xFF, 0xEC, 0xB4, 0xFF, 0xAD, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xCA, 0x9B, 0xFF, 0x09, 0x7B, 0xFF,
-    0xB3, 0xA4, 0xFF, 0xDF, 0xFF, 0xFF, 0xD8, 0x8B, 0xFF, 0x69, 0x5A, 0xFF, 0x8C, 0x7B, 0xFF, 0xEA, 0x6A, 0xFF, 0x31, 0x94, 0xFF, 0x69, 0x5A, 0xFF, 0x48, 0x52, 0xFF, 0x6D, 0x73, 0xFF, 0x07, 0x4A, 0xFF, 0x8D, 0x73, 0xFF, 0x48, 0x4A, 0xFF, 0x49, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0xAA, 0x52, 0xFF, 0xF4, 0x83, 0xFF, 0x4B, 0x52, 0xFF, 0x69, 0x39, 0xFF, 0xEA, 0x49, 0xFF, 0xEA, 0x49, 0xFF, 0xDA, 0xAC, 0xFF, 0x79, 0x83, 0xFF, 0xFD, 0x28, 0xFF, 0x35, 0x7B, 0xFF, 0x8B, 0x62, 0xFF, 0xF9, 0xFF, 0xFF, 0xCF, 0xE6, 0xFF, 0x2E, 0xEE, 0xFF, 0x6A, 0x9B, 0xFF, 0x90, 0xB4, 0xFF, 0xFA, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xB8, 0xFF, 0xFF, 0x71, 0xDD, 0xFF, 0x6C, 0x93, 0xFF, 0x6C, 0x93, 0xFF, 0xFA, 0xFF, 0xFF, 0xAF, 0xF5, 0xFF, 0x4C, 0x9B, 0xFF, 0xEC, 0x72, 0xFF, 0x0E, 0x7B, 0xFF, 0x7F, 0xFF, 0xFF, 0xB5, 0x9C, 0xFF, 0x31, 0x7B, 0xFF, 0x2D, 0x52, 0xFF, 0x0E, 0x52, 0xFF, 0x5F, 0xAD, 0xFF, 0xB4, 0x62, 0xFF, 0xF3, 0x72, 0xFF, 0x0E, 0x52, 0xFF, 0x35, 0x73, 0xFF, 0x3F, 0xAD, 0xFF, 0x32, 0x52, 0xFF, 0x6F, 0x5A, 0xFF, 0x4E, 0x5A, 0xFF, 0xF0, 0x7A, 0xFF, 0x9F, 0xFF, 0xFF, 0x94, 0xB4, 0xFF, 0xCE, 0x72, 0xFF, 0x97, 0xD5, 0xFF, 0x6E, 0xBC, 0xFF, 0xFD, 0xFF, 0xFF, 0x6C, 0x8B, 0xFF,
-    0x4C, 0x8B, 0xFF, 0x6C, 0x8B, 0xFF, 0xEC, 0xAB, 0xFF, 0xF9, 0xFF, 0xFF, 0x6B, 0x93, 0xFF, 0x8B, 0x93, 0xFF, 0x70, 0xDD, 0xFF, 0x4E, 0xFE, 0xFF, 0xFA, 0xFF, 0xFF, 0x6D, 0xB4, 0xFF, 0x0B, 0xA4, 0xFF, 0xA9, 0x9B, 0xFF, 0x4B, 0xDD, 0xFF, 0x4D, 0xCD, 0xFF, 0x49, 0x8B, 0xFF, 0x0A, 0x7B, 0xFF, 0xCA, 0x6A, 0xFF, 0x2A, 0x5A, 0xFF, 0x8A, 0x62, 0xFF, 0xCE, 0x93, 0xFF, 0xA9, 0x6A, 0xFF, 0x68, 0x5A, 0xFF, 0xAA, 0x62, 0xFF, 0x89, 0x62, 0xFF, 0xCA, 0x62, 0xFF, 0x28, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x47, 0x31, 0xFF, 0x88, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0xA9, 0x41, 0xFF, 0xEB, 0x49, 0xFF, 0xD5, 0x8B, 0xFF, 0x2C, 0x5A, 0xFF, 0xCD, 0x72, 0xFF, 0xAB, 0x62, 0xFF, 0x51, 0xAC, 0xFF, 0xAA, 0x7A, 0xFF, 0x0B, 0x83, 0xFF, 0x4B, 0x8B, 0xFF, 0x4B, 0x8B, 0xFF, 0xCA, 0x7A, 0xFF, 0xCD, 0xAB, 0xFF, 0x70, 0xB4, 0xFF, 0xEF, 0xA3, 0xFF, 0x4C, 0x8B, 0xFF, 0x6E, 0x93, 0xFF, 0x4C, 0x8B, 0xFF, 0x6D, 0x93, 0xFF, 0x8E, 0x8B, 0xFF, 0xAC, 0x72, 0xFF, 0x8C, 0x6A, 0xFF, 0x2F, 0x7B, 0xFF, 0x71, 0x7B, 0xFF, 0x75, 0xA4, 0xFF, 0x0D, 0x52, 0xFF, 0x52, 0x7B, 0xFF, 0x2E, 0x52, 0xFF,
-    0xD0, 0x6A, 0xFF, 0x72, 0x83, 0xFF, 0xB0, 0x6A, 0xFF, 0x32, 0x73, 0xFF, 0x53, 0x7B, 0xFF, 0x90, 0x62, 0xFF, 0x6F, 0x5A, 0xFF, 0x2E, 0x5A, 0xFF, 0x6E, 0x62, 0xFF, 0xCF, 0x6A, 0xFF, 0x16, 0xC5, 0xFF, 0x8D, 0x6A, 0xFF, 0x73, 0xAC, 0xFF, 0xD0, 0x9B, 0xFF, 0xCB, 0x7A, 0xFF, 0x0C, 0x83, 0xFF, 0x4D, 0x83, 0xFF, 0xCF, 0x9B, 0xFF, 0x0B, 0x83, 0xFF, 0xB5, 0xDD, 0xFF, 0x6C, 0x93, 0xFF, 0x2B, 0x83, 0xFF, 0x90, 0xB4, 0xFF, 0x0D, 0xA4, 0xFF, 0x6A, 0x93, 0xFF, 0x4E, 0xAC, 0xFF, 0xCB, 0x9B, 0xFF, 0x49, 0x8B, 0xFF, 0x4C, 0xAC, 0xFF, 0xCB, 0x9B, 0xFF, 0x6A, 0x83, 0xFF, 0xAC, 0x8B, 0xFF, 0xE9, 0x72, 0xFF, 0x2B, 0x7B, 0xFF, 0x90, 0xA4, 0xFF, 0x8D, 0x8B, 0xFF, 0x68, 0x62, 0xFF, 0x68, 0x5A, 0xFF, 0x4B, 0x73, 0xFF, 0x68, 0x5A, 0xFF, 0x28, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0xE6, 0x49, 0xFF, 0x69, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x46, 0x31, 0xFF, 0x67, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0xA8, 0x41, 0xFF, 0xEA, 0x49, 0xFF, 0x91, 0x83, 0xFF, 0x70, 0x8B, 0xFF, 0xEA, 0x51, 0xFF, 0x2A, 0x52, 0xFF, 0x0D, 0x73, 0xFF, 0xEB, 0x72, 0xFF, 0x6A, 0x6A, 0xFF, 0x6E, 0x93, 0xFF, 0x2C, 0x83, 0xFF, 0x2C, 0x83, 0xFF, 0x8D, 0x93, 0xFF,
-    0xAE, 0xA3, 0xFF, 0x70, 0xC4, 0xFF, 0xF2, 0xCC, 0xFF, 0x4D, 0x8B, 0xFF, 0x2D, 0x8B, 0xFF, 0x6E, 0x93, 0xFF, 0x0D, 0x83, 0xFF, 0xCD, 0x7A, 0xFF, 0x8D, 0x6A, 0xFF, 0xCE, 0x72, 0xFF, 0x4E, 0x62, 0xFF, 0x2E, 0x52, 0xFF, 0x3B, 0xC5, 0xFF, 0xB0, 0x62, 0xFF, 0xF7, 0xB4, 0xFF, 0x0F, 0x52, 0xFF, 0x0E, 0x52, 0xFF, 0x76, 0x9C, 0xFF, 0xED, 0x49, 0xFF, 0xD3, 0x9B, 0xFF, 0x32, 0x73, 0xFF, 0xB0, 0x62, 0xFF, 0x2E, 0x5A, 0xFF, 0x2E, 0x52, 0xFF, 0x70, 0x62, 0xFF, 0x73, 0x7B, 0xFF, 0xD9, 0xBC, 0xFF, 0x8D, 0x6A, 0xFF, 0xF2, 0x93, 0xFF, 0x2F, 0x83, 0xFF, 0x8B, 0x72, 0xFF, 0x0D, 0x7B, 0xFF, 0x0C, 0x7B, 0xFF, 0x6E, 0x93, 0xFF, 0x0B, 0x8B, 0xFF, 0x99, 0xF6, 0xFF, 0x2B, 0x83, 0xFF, 0xEE, 0x9B, 0xFF, 0x72, 0xDD, 0xFF, 0x8F, 0xB4, 0xFF, 0x6B, 0x93, 0xFF, 0x2E, 0xAC, 0xFF, 0x08, 0x8B, 0xFF, 0x6A, 0x93, 0xFF, 0x4D, 0xB4, 0xFF, 0x09, 0x83, 0xFF, 0x09, 0x7B, 0xFF, 0xE9, 0x7A, 0xFF, 0x2B, 0x7B, 0xFF, 0x70, 0xA4, 0xFF, 0xB1, 0xAC, 0xFF, 0x32, 0xBD, 0xFF, 0xEA, 0x6A, 0xFF, 0x48, 0x5A, 0xFF, 0x2B, 0x73, 0xFF, 0x2B, 0x6B, 0xFF, 0x68, 0x5A, 0xFF, 0x48, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0x88, 0x62, 0xFF, 0xCB, 0x62, 0xFF, 0x48, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x69, 0x52, 0xFF,
-    0x67, 0x31, 0xFF, 0x67, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0xA8, 0x41, 0xFF, 0x8D, 0x62, 0xFF, 0x0E, 0x6B, 0xFF, 0xAA, 0x49, 0xFF, 0x0E, 0x5A, 0xFF, 0x6B, 0x62, 0xFF, 0x6D, 0x83, 0xFF, 0x77, 0xF6, 0xFF, 0x58, 0xFE, 0xFF, 0x4B, 0x8B, 0xFF, 0xE9, 0x72, 0xFF, 0xEF, 0xA3, 0xFF, 0xCE, 0xB3, 0xFF, 0x70, 0xCC, 0xFF, 0x2D, 0x9B, 0xFF, 0x30, 0xAC, 0xFF, 0x92, 0xBC, 0xFF, 0x6D, 0x9B, 0xFF, 0xB1, 0xCC, 0xFF, 0xB0, 0x9B, 0xFF, 0xCE, 0x72, 0xFF, 0x70, 0x62, 0xFF, 0x52, 0x62, 0xFF, 0xB6, 0x6A, 0xFF, 0xD7, 0xA4, 0xFF, 0xB5, 0x83, 0xFF, 0xB8, 0xB4, 0xFF, 0x10, 0x52, 0xFF, 0x53, 0x73, 0xFF, 0x74, 0x83, 0xFF, 0x2E, 0x52, 0xFF, 0x52, 0x5A, 0xFF, 0x73, 0x5A, 0xFF, 0x0F, 0x52, 0xFF, 0x2F, 0x52, 0xFF, 0x0F, 0x52, 0xFF, 0x32, 0x5A, 0xFF, 0x5A, 0x7B, 0xFF, 0xD8, 0x93, 0xFF, 0x6E, 0x62, 0xFF, 0x71, 0x8B, 0xFF, 0xB4, 0xBC, 0xFF, 0x6E, 0x93, 0xFF, 0x0D, 0x83, 0xFF, 0x2D, 0x83, 0xFF, 0xEF, 0x9B, 0xFF, 0xCE, 0xCC, 0xFF, 0xD1, 0xFD, 0xFF, 0x4B, 0x9B, 0xFF, 0x4A, 0x8B, 0xFF, 0x56, 0xEF, 0xFF, 0x90, 0xED, 0xFF, 0xEB, 0xB3, 0xFF, 0xEC, 0xAB, 0xFF, 0x2D, 0xA4, 0xFF, 0x8D, 0xB4, 0xFF, 0xAA, 0xCC, 0xFF, 0xC8, 0xAB, 0xFF, 0x29, 0x83, 0xFF, 0xED, 0x9B, 0xFF,
-    0xA9, 0x72, 0xFF, 0xF1, 0xC4, 0xFF, 0xEE, 0x93, 0xFF, 0x6C, 0x7B, 0xFF, 0x4B, 0x7B, 0xFF, 0x48, 0x5A, 0xFF, 0x2D, 0x9C, 0xFF, 0x74, 0xC5, 0xFF, 0x48, 0x52, 0xFF, 0x8A, 0x62, 0xFF, 0x48, 0x52, 0xFF, 0x4C, 0x73, 0xFF, 0x69, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x49, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x47, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x50, 0x73, 0xFF, 0xAB, 0x41, 0xFF, 0x14, 0x39, 0xFF, 0xFF, 0xF7, 0xFF, 0xD5, 0x49, 0xFF, 0xAD, 0x6A, 0xFF, 0xCB, 0x7A, 0xFF, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xBC, 0xFF, 0xEB, 0x82, 0xFF, 0x4D, 0xA3, 0xFF, 0xCF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xDD, 0xFF, 0x8E, 0x9B, 0xFF, 0x0B, 0x93, 0xFF, 0x33, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xAB, 0xFF, 0x72, 0x93, 0xFF, 0xBC, 0x93, 0xFF, 0x1E, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x52, 0xFF, 0x98, 0xAC, 0xFF, 0xD7, 0x6A, 0xFF, 0x9D, 0x42, 0xFF, 0x51, 0x31, 0xFF, 0x32, 0x83, 0xFF, 0x4F, 0x5A, 0xFF, 0x54, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0x52, 0xFF, 0x0F, 0x52, 0xFF, 0x10, 0x4A, 0xFF, 0x3F, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x93, 0xFF, 0x6F, 0x62, 0xFF, 0xF4, 0xA3, 0xFF, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x93, 0xFF,
-    0xED, 0x7A, 0xFF, 0x8E, 0x9B, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xA3, 0xFF, 0x4B, 0x93, 0xFF, 0xD2, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xFE, 0xFF, 0xEB, 0xAB, 0xFF, 0x6A, 0x93, 0xFF, 0x2C, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xF5, 0xFF, 0x28, 0x8B, 0xFF, 0x0A, 0x83, 0xFF, 0xCB, 0x7A, 0xFF, 0x77, 0x95, 0xFF, 0x6F, 0x6A, 0xFF, 0xAA, 0x6A, 0xFF, 0x48, 0x5A, 0xFF, 0x48, 0x5A, 0xFF, 0x8E, 0x83, 0xFF, 0x0F, 0x8C, 0xFF, 0x07, 0x52, 0xFF, 0x69, 0x52, 0xFF, 0x2C, 0x6B, 0xFF, 0x08, 0x4A, 0xFF, 0x48, 0x52, 0xFF, 0x28, 0x4A, 0xFF, 0x28, 0x4A, 0xFF, 0x49, 0x52, 0xFF, 0x52, 0x73, 0xFF, 0x2F, 0x6B, 0xFF, 0xB3, 0x83, 0xFF, 0x88, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0xFB, 0xAC, 0xFF, 0x9F, 0xB5, 0xFF, 0x1F, 0xB5, 0xFF, 0xB0, 0x49, 0xFF, 0x0B, 0x5A, 0xFF, 0xB1, 0xB4, 0xFF, 0xDD, 0xFF, 0xFF, 0xCE, 0xD4, 0xFF, 0xCD, 0xAB, 0xFF, 0xAB, 0x7A, 0xFF, 0x8D, 0x9B, 0xFF, 0xFA, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0x8D, 0xB3, 0xFF, 0x2E, 0x8B, 0xFF, 0x2B, 0x72, 0xFF, 0xFD, 0xFF, 0xFF, 0xAF, 0xB3, 0xFF, 0x8E, 0x7A, 0xFF, 0xD4, 0x9B, 0xFF, 0xF5, 0x9B, 0xFF, 0x9F, 0xBD, 0xFF, 0xD6, 0x49, 0xFF, 0x35, 0x7B, 0xFF, 0x79, 0xA4, 0xFF, 0x32, 0x7B, 0xFF, 0xBE, 0x9C, 0xFF,
-    0xCE, 0x49, 0xFF, 0x16, 0xA4, 0xFF, 0x6F, 0x5A, 0xFF, 0x10, 0x5A, 0xFF, 0x9E, 0x8C, 0xFF, 0x50, 0x5A, 0xFF, 0x0F, 0x4A, 0xFF, 0xCE, 0x49, 0xFF, 0xF2, 0x49, 0xFF, 0xDF, 0xC5, 0xFF, 0x7A, 0xB4, 0xFF, 0x2E, 0x5A, 0xFF, 0x11, 0x83, 0xFF, 0x6F, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0x7A, 0xFF, 0x2E, 0x83, 0xFF, 0x6E, 0x93, 0xFF, 0xAD, 0xAB, 0xFF, 0xFC, 0xFF, 0xFF, 0x6C, 0x93, 0xFF, 0x0B, 0x8B, 0xFF, 0x8C, 0xA3, 0xFF, 0xAC, 0xD4, 0xFF, 0x77, 0xF7, 0xFF, 0x0A, 0x8B, 0xFF, 0x0A, 0x8B, 0xFF, 0x09, 0x93, 0xFF, 0xC9, 0xB3, 0xFF, 0xF6, 0xFF, 0xFF, 0xC9, 0x82, 0xFF, 0xEA, 0x7A, 0xFF, 0x89, 0x6A, 0xFF, 0xCB, 0x72, 0xFF, 0xEB, 0x7A, 0xFF, 0x6C, 0x83, 0xFF, 0x28, 0x5A, 0xFF, 0x27, 0x5A, 0xFF, 0x4C, 0x7B, 0xFF, 0xE7, 0x49, 0xFF, 0x30, 0x8C, 0xFF, 0xEF, 0x93, 0xFF, 0x28, 0x52, 0xFF, 0xC6, 0x41, 0xFF, 0x07, 0x4A, 0xFF, 0x6A, 0x5A, 0xFF, 0x28, 0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0x88, 0x39, 0xFF, 0x47, 0x31, 0xFF, 0x55, 0x9C, 0xFF, 0x47, 0x31, 0xFF, 0x68, 0x39, 0xFF, 0x89, 0x41, 0xFF, 0x8B, 0x41, 0xFF, 0x2D, 0x5A, 0xFF, 0xAA, 0x51, 0xFF, 0x8C, 0x62, 0xFF, 0x6A, 0x62, 0xFF, 0x0D, 0x83, 0xFF, 0x8B, 0x72, 0xFF, 0x2D, 0x83, 0xFF, 0x4A, 0x6A, 0xFF, 0xAB, 0x7A, 0xFF,
-    0x8F, 0xA3, 0xFF, 0x6E, 0x9B, 0xFF, 0xAC, 0x82, 0xFF, 0xED, 0x82, 0xFF, 0xAE, 0x72, 0xFF, 0x0F, 0x83, 0xFF, 0x8F, 0x72, 0xFF, 0x4E, 0x6A, 0xFF, 0x97, 0xB4, 0xFF, 0xD6, 0x93, 0xFF, 0x70, 0x62, 0xFF, 0x93, 0x62, 0xFF, 0x36, 0x7B, 0xFF, 0xD1, 0x6A, 0xFF, 0x91, 0x93, 0xFF, 0xCE, 0x49, 0xFF, 0xED, 0x49, 0xFF, 0x98, 0x83, 0xFF, 0x2E, 0x52, 0xFF, 0x4F, 0x8B, 0xFF, 0xEE, 0x49, 0xFF, 0x4E, 0x52, 0xFF, 0xCD, 0x49, 0xFF, 0xCD, 0x49, 0xFF, 0xAE, 0x49, 0xFF, 0x0F, 0x52, 0xFF, 0xF4, 0x7A, 0xFF, 0x0E, 0x5A, 0xFF, 0xD0, 0x7A, 0xFF, 0x8E, 0x72, 0xFF, 0x6E, 0x6A, 0xFF, 0x6E, 0x72, 0xFF, 0x8D, 0x72, 0xFF, 0x2E, 0x83, 0xFF, 0x0D, 0x8B, 0xFF, 0x39, 0xEE, 0xFF, 0xEC, 0x82, 0xFF, 0xAF, 0x93, 0xFF, 0xCB, 0x8A, 0xFF, 0x0B, 0x93, 0xFF, 0x2B, 0x93, 0xFF, 0xEA, 0x8A, 0xFF, 0x0A, 0x83, 0xFF, 0xEA, 0x8A, 0xFF, 0x68, 0x7A, 0xFF, 0xCA, 0x82, 0xFF, 0xC9, 0x7A, 0xFF, 0x89, 0x72, 0xFF, 0xCA, 0x72, 0xFF, 0x8A, 0x6A, 0xFF, 0x8E, 0x8B, 0xFF, 0x28, 0x5A, 0xFF, 0xAA, 0x6A, 0xFF, 0x48, 0x5A, 0xFF, 0x28, 0x5A, 0xFF, 0x69, 0x5A, 0xFF, 0x07, 0x52, 0xFF, 0xEB, 0x72, 0xFF, 0x28, 0x4A, 0xFF, 0xE7, 0x51, 0xFF, 0x08, 0x4A, 0xFF, 0xE7, 0x49, 0xFF, 0xE8, 0x49, 0xFF, 0x28, 0x4A, 0xFF,
-    0x25, 0x29, 0xFF, 0x6B, 0x5A, 0xFF, 0xC9, 0x51, 0xFF, 0x2A, 0x4A, 0xFF, 0x06, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x6D, 0x5A, 0xFF, 0xAA, 0x49, 0xFF, 0x4E, 0x83, 0xFF, 0x2A, 0x5A, 0xFF, 0x4A, 0x62, 0xFF, 0xAD, 0x7A, 0xFF, 0x0D, 0x83, 0xFF, 0xAB, 0x72, 0xFF, 0x6B, 0x72, 0xFF, 0x6F, 0x93, 0xFF, 0xB5, 0xCC, 0xFF, 0xAC, 0x82, 0xFF, 0xAC, 0x82, 0xFF, 0x6C, 0x72, 0xFF, 0x52, 0x8B, 0xFF, 0x2E, 0x62, 0xFF, 0x2F, 0x62, 0xFF, 0x4F, 0x6A, 0xFF, 0x94, 0x8B, 0xFF, 0x13, 0x73, 0xFF, 0xCE, 0x51, 0xFF, 0xEF, 0x49, 0xFF, 0xF6, 0x93, 0xFF, 0x94, 0x7B, 0xFF, 0x57, 0xAC, 0xFF, 0xED, 0x49, 0xFF, 0xD0, 0x62, 0xFF, 0x2F, 0x52, 0xFF, 0xED, 0x49, 0xFF, 0x1A, 0xBD, 0xFF, 0x8C, 0x39, 0xFF, 0xCC, 0x49, 0xFF, 0xAC, 0x41, 0xFF, 0xAD, 0x41, 0xFF, 0x8D, 0x41, 0xFF, 0x91, 0x62, 0xFF, 0xB6, 0x62, 0xFF, 0x2E, 0x5A, 0xFF, 0x4F, 0x62, 0xFF, 0x11, 0x7B, 0xFF, 0x90, 0x6A, 0xFF, 0x6E, 0x6A, 0xFF, 0x8D, 0x72, 0xFF, 0x2F, 0x83, 0xFF, 0x8C, 0x82, 0xFF, 0x91, 0xBC, 0xFF, 0xCC, 0x82, 0xFF, 0xCC, 0x82, 0xFF, 0x8E, 0xA3, 0xFF, 0x38, 0xFF, 0xFF, 0x0B, 0x93, 0xFF, 0x6C, 0x9B, 0xFF, 0xAD, 0x9B, 0xFF, 0x90, 0xBC, 0xFF, 0x88, 0x82, 0xFF, 0x88, 0x82, 0xFF, 0xA9, 0x7A, 0xFF, 0x0B, 0x83, 0xFF,
-    0x89, 0x6A, 0xFF, 0x49, 0x62, 0xFF, 0x08, 0x5A, 0xFF, 0xCB, 0x72, 0xFF, 0x08, 0x52, 0xFF, 0x07, 0x52, 0xFF, 0x27, 0x62, 0xFF, 0xAA, 0x62, 0xFF, 0x08, 0x52, 0xFF, 0xE7, 0x49, 0xFF, 0x08, 0x4A, 0xFF, 0xC7, 0x49, 0xFF, 0x28, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0x08, 0x4A, 0xFF, 0x08, 0x4A, 0xFF, 0x46, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0xA8, 0x49, 0xFF, 0xA8, 0x39, 0xFF, 0xF1, 0x83, 0xFF, 0x69, 0x39, 0xFF, 0xA9, 0x49, 0xFF, 0x0C, 0x5A, 0xFF, 0xB1, 0x8B, 0xFF, 0x4E, 0x7B, 0xFF, 0x4A, 0x6A, 0xFF, 0x2D, 0x8B, 0xFF, 0x8D, 0x9B, 0xFF, 0xCF, 0xA3, 0xFF, 0x51, 0xBC, 0xFF, 0xEE, 0x8A, 0xFF, 0x3D, 0xFF, 0xFF, 0x8D, 0xBB, 0xFF, 0x73, 0xBC, 0xFF, 0xD1, 0xA3, 0xFF, 0x33, 0x8B, 0xFF, 0xB2, 0x61, 0xFF, 0xD8, 0x82, 0xFF, 0xB5, 0x8B, 0xFF, 0xF1, 0x7A, 0xFF, 0x7A, 0xD5, 0xFF, 0xCF, 0x49, 0xFF, 0xF7, 0x6A, 0xFF, 0x73, 0x5A, 0xFF, 0xAD, 0x41, 0xFF, 0xDB, 0x93, 0xFF, 0x8D, 0x41, 0xFF, 0x33, 0x6B, 0xFF, 0x8D, 0x41, 0xFF, 0x8C, 0x39, 0xFF, 0x7B, 0x83, 0xFF, 0xCE, 0x41, 0xFF, 0xCD, 0x49, 0xFF, 0x8C, 0x41, 0xFF, 0x8C, 0x41, 0xFF, 0xAF, 0x41, 0xFF, 0xB8, 0x62, 0xFF, 0xF3, 0x49, 0xFF, 0xCD, 0x49, 0xFF, 0x4F, 0x62, 0xFF, 0x13, 0x62, 0xFF, 0x3A, 0x62, 0xFF, 0x31, 0x6A, 0xFF,
-    0x8E, 0x72, 0xFF, 0x50, 0x93, 0xFF, 0xB5, 0xFE, 0xFF, 0x91, 0xDC, 0xFF, 0xED, 0x92, 0xFF, 0xCC, 0x82, 0xFF, 0x6B, 0xA3, 0xFF, 0xCC, 0xEC, 0xFF, 0xCB, 0xCB, 0xFF, 0x0A, 0x9B, 0xFF, 0x2B, 0x9B, 0xFF, 0x90, 0xC4, 0xFF, 0xEC, 0xEC, 0xFF, 0x29, 0xAB, 0xFF, 0xAA, 0x82, 0xFF, 0x68, 0x72, 0xFF, 0x8E, 0x8B, 0xFF, 0x6C, 0x72, 0xFF, 0xE8, 0x59, 0xFF, 0x29, 0x62, 0xFF, 0x4D, 0x7B, 0xFF, 0x49, 0x62, 0xFF, 0x07, 0x5A, 0xFF, 0xE8, 0x51, 0xFF, 0x08, 0x52, 0xFF, 0xCB, 0x6A, 0xFF, 0x08, 0x52, 0xFF, 0xC7, 0x49, 0xFF, 0xE8, 0x49, 0xFF, 0xE8, 0x49, 0xFF, 0x49, 0x52, 0xFF, 0x08, 0x4A, 0xFF, 0x06, 0x29, 0xFF, 0x47, 0x31, 0xFF, 0xEA, 0x49, 0xFF, 0x8D, 0x5A, 0xFF, 0x10, 0x6B, 0xFF, 0x89, 0x39, 0xFF, 0x89, 0x41, 0xFF, 0x1F, 0x76, 0xFF, 0xEF, 0x59, 0xFF, 0x4B, 0x6A, 0xFF, 0x0A, 0x93, 0xFF, 0x17, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0xAB, 0xFF, 0xD1, 0xAB, 0xFF, 0x4E, 0xB3, 0xFF, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xBC, 0xFF, 0x6E, 0x7A, 0xFF, 0xBA, 0x8A, 0xFF, 0xBE, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x13, 0x62, 0xFF, 0xCF, 0x51, 0xFF, 0x9D, 0x8B, 0xFF, 0x95, 0x41, 0xFF, 0xFF, 0xF7, 0xFF, 0xD0, 0x49, 0xFF, 0x6C, 0x39, 0xFF, 0x0F, 0x52, 0xFF, 0x8E, 0x39, 0xFF,
-    0x8D, 0x41, 0xFF, 0x2F, 0x52, 0xFF, 0xED, 0x49, 0xFF, 0x70, 0x5A, 0xFF, 0x3C, 0x5B, 0xFF, 0xED, 0x49, 0xFF, 0x8C, 0x41, 0xFF, 0x8C, 0x39, 0xFF, 0x4F, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x49, 0xFF, 0xAD, 0x49, 0xFF, 0x30, 0x5A, 0xFF, 0x1A, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x36, 0x62, 0xFF, 0xAF, 0x72, 0xFF, 0xEF, 0x82, 0xFF, 0x15, 0xF6, 0xFF, 0xDB, 0xF5, 0xFF, 0x54, 0xA3, 0xFF, 0xED, 0x8A, 0xFF, 0x6D, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xEB, 0xE3, 0xFF, 0x0B, 0x9B, 0xFF, 0x4B, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xDC, 0xFF, 0x0A, 0xB3, 0xFF, 0xCB, 0x82, 0xFF, 0x4A, 0x6A, 0xFF, 0xFF, 0xEF, 0xFF, 0x4F, 0x6A, 0xFF, 0x09, 0x5A, 0xFF, 0xC8, 0x51, 0xFF, 0x29, 0x5A, 0xFF, 0xAF, 0x83, 0xFF, 0x07, 0x52, 0xFF, 0xE7, 0x49, 0xFF, 0xE7, 0x49, 0xFF, 0xC7, 0x49, 0xFF, 0xC7, 0x41, 0xFF, 0x6A, 0x52, 0xFF, 0xE8, 0x49, 0xFF, 0xC7, 0x41, 0xFF, 0xE8, 0x49, 0xFF, 0x48, 0x31, 0xFF, 0x10, 0x6B, 0xFF, 0xEA, 0x49, 0xFF, 0x48, 0x31, 0xFF, 0xCB, 0x41, 0xFF, 0x8D, 0x41, 0xFF, 0x58, 0xA4, 0xFF, 0x6F, 0x62, 0xFF, 0xCC, 0x51, 0xFF, 0xAC, 0x7A, 0xFF, 0x73, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xB3, 0xFF, 0x4E, 0x9B, 0xFF, 0x0E, 0x8B, 0xFF, 0xBA, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x32, 0xED, 0xFF, 0x0E, 0x9B, 0xFF, 0x0F, 0x6A, 0xFF, 0xD9, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x49, 0xFF, 0xD1, 0x51, 0xFF, 0xAE, 0x49, 0xFF, 0x51, 0x5A, 0xFF, 0x7F, 0x86, 0xFF, 0x11, 0x4A, 0xFF, 0x8D, 0x41, 0xFF, 0x4E, 0x52, 0xFF, 0x0D, 0x52, 0xFF, 0xF9, 0x7B, 0xFF, 0xAC, 0x41, 0xFF, 0x0E, 0x52, 0xFF, 0xAB, 0x41, 0xFF, 0x2F, 0x52, 0xFF, 0x3A, 0x84, 0xFF, 0x4E, 0x5A, 0xFF, 0x8B, 0x39, 0xFF, 0x6B, 0x39, 0xFF, 0x6D, 0x41, 0xFF, 0xFF, 0xA7, 0xFF, 0xAF, 0x49, 0xFF, 0x8C, 0x41, 0xFF, 0xEE, 0x51, 0xFF, 0xD2, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x62, 0xFF, 0x2E, 0x62, 0xFF, 0x6E, 0x72, 0xFF, 0xD1, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x82, 0xFF, 0xEF, 0x82, 0xFF, 0xED, 0x92, 0xFF, 0xAC, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xEC, 0xFF, 0xEB, 0x9A, 0xFF, 0xEB, 0x92, 0xFF, 0x0A, 0xAB, 0xFF, 0xFE, 0xFF, 0xFF, 0x8E, 0xFC, 0xFF, 0x8A, 0x82, 0xFF, 0x29, 0x62, 0xFF, 0x09, 0x5A, 0xFF, 0x6C, 0x51, 0xFF, 0xCC, 0x51, 0xFF, 0xC8, 0x51, 0xFF, 0x28, 0x5A, 0xFF, 0xC7, 0x49, 0xFF, 0xA7, 0x49, 0xFF, 0xA7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xC8, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xE8, 0x49, 0xFF,
-    0x06, 0x29, 0xFF, 0x06, 0x29, 0xFF, 0x27, 0x31, 0xFF, 0x68, 0x39, 0xFF, 0x29, 0x31, 0xFF, 0x48, 0x39, 0xFF, 0x69, 0x39, 0xFF, 0x89, 0x41, 0xFF, 0x6C, 0x62, 0xFF, 0x4B, 0x6A, 0xFF, 0x8D, 0xA3, 0xFF, 0xCE, 0xB3, 0xFF, 0x0E, 0x8B, 0xFF, 0x4C, 0x6A, 0xFF, 0x8D, 0x7A, 0xFF, 0xB3, 0xAB, 0xFF, 0x72, 0xBB, 0xFF, 0xCE, 0x8A, 0xFF, 0x0D, 0x6A, 0xFF, 0x0F, 0x62, 0xFF, 0x54, 0x62, 0xFF, 0x9B, 0x72, 0xFF, 0x90, 0x41, 0xFF, 0xAF, 0x49, 0xFF, 0x8D, 0x49, 0xFF, 0xCF, 0x49, 0xFF, 0xCE, 0x49, 0xFF, 0x0F, 0x52, 0xFF, 0x2B, 0x31, 0xFF, 0x6B, 0x39, 0xFF, 0x70, 0x62, 0xFF, 0x6B, 0x39, 0xFF, 0xCC, 0x41, 0xFF, 0x2A, 0x31, 0xFF, 0x6A, 0x39, 0xFF, 0x50, 0x5A, 0xFF, 0x6B, 0x39, 0xFF, 0x8B, 0x39, 0xFF, 0x8B, 0x39, 0xFF, 0x4A, 0x39, 0xFF, 0x6B, 0x39, 0xFF, 0x0E, 0x52, 0xFF, 0xAE, 0x49, 0xFF, 0x6B, 0x41, 0xFF, 0xCD, 0x49, 0xFF, 0x2F, 0x5A, 0xFF, 0xAE, 0x49, 0xFF, 0xCD, 0x51, 0xFF, 0x0D, 0x5A, 0xFF, 0x4D, 0x62, 0xFF, 0x2E, 0x6A, 0xFF, 0xD2, 0x7A, 0xFF, 0x4E, 0x72, 0xFF, 0x6D, 0x72, 0xFF, 0x8D, 0x7A, 0xFF, 0x8C, 0x8A, 0xFF, 0xEC, 0xA2, 0xFF, 0xAB, 0x92, 0xFF, 0x4E, 0x9B, 0xFF, 0x8B, 0x82, 0xFF, 0xAB, 0x8A, 0xFF, 0xED, 0xA2, 0xFF, 0xAA, 0x8A, 0xFF, 0x49, 0x72, 0xFF,
-    0x29, 0x62, 0xFF, 0x2A, 0x62, 0xFF, 0x09, 0x5A, 0xFF, 0xC8, 0x51, 0xFF, 0xC8, 0x51, 0xFF, 0x29, 0x5A, 0xFF, 0xA7, 0x49, 0xFF, 0xC8, 0x49, 0xFF, 0xE8, 0x49, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xC8, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0x06, 0x29, 0xFF, 0x27, 0x31, 0xFF, 0x28, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0xC8, 0x20, 0xFF, 0x2C, 0x52, 0xFF, 0x69, 0x41, 0xFF, 0xCB, 0x51, 0xFF, 0x8A, 0x49, 0xFF, 0xCA, 0x59, 0xFF, 0x2C, 0x62, 0xFF, 0x6E, 0x6A, 0xFF, 0xEC, 0x59, 0xFF, 0x52, 0x83, 0xFF, 0xF1, 0x82, 0xFF, 0xEE, 0x61, 0xFF, 0xED, 0x61, 0xFF, 0xCD, 0x51, 0xFF, 0x32, 0x83, 0xFF, 0x51, 0x5A, 0xFF, 0xB4, 0x6A, 0xFF, 0x8E, 0x41, 0xFF, 0x0E, 0x52, 0xFF, 0x8C, 0x41, 0xFF, 0xCE, 0x49, 0xFF, 0xCD, 0x49, 0xFF, 0xEE, 0x49, 0xFF, 0x4B, 0x39, 0xFF, 0x4B, 0x39, 0xFF, 0xCD, 0x49, 0xFF, 0x09, 0x31, 0xFF, 0x8F, 0x5A, 0xFF, 0x09, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0xEE, 0x49, 0xFF, 0x2D, 0x52, 0xFF, 0xEC, 0x49, 0xFF, 0x4A, 0x39, 0xFF, 0x4A, 0x31, 0xFF, 0x4B, 0x39, 0xFF, 0xD0, 0x62, 0xFF, 0x8C, 0x41, 0xFF, 0x4A, 0x39, 0xFF, 0xEE, 0x51, 0xFF, 0x70, 0x62, 0xFF, 0x8C, 0x49, 0xFF, 0x8C, 0x49, 0xFF,
-    0xCB, 0x51, 0xFF, 0x31, 0x83, 0xFF, 0x31, 0x83, 0xFF, 0x4E, 0x6A, 0xFF, 0x0A, 0x5A, 0xFF, 0x2D, 0x6A, 0xFF, 0x10, 0x83, 0xFF, 0x8D, 0x82, 0xFF, 0x8C, 0x7A, 0xFF, 0x2C, 0x72, 0xFF, 0x6C, 0x7A, 0xFF, 0x4F, 0x8B, 0xFF, 0x4C, 0x72, 0xFF, 0xCD, 0x82, 0xFF, 0x4A, 0x72, 0xFF, 0xED, 0x82, 0xFF, 0xC8, 0x59, 0xFF, 0xE9, 0x59, 0xFF, 0xC9, 0x59, 0xFF, 0x09, 0x5A, 0xFF, 0xCC, 0x6A, 0xFF, 0x09, 0x52, 0xFF, 0xA7, 0x49, 0xFF, 0x6A, 0x5A, 0xFF, 0x29, 0x52, 0xFF, 0xA7, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0xC7, 0x41, 0xFF, 0x87, 0x39, 0xFF, 0xC8, 0x41, 0xFF, 0xC8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xC5, 0x20, 0xFF, 0xE6, 0x28, 0xFF, 0x27, 0x31, 0xFF, 0x27, 0x31, 0xFF, 0xCA, 0x41, 0xFF, 0x0A, 0x31, 0xFF, 0x89, 0x41, 0xFF, 0x69, 0x39, 0xFF, 0xAA, 0x49, 0xFF, 0x10, 0x73, 0xFF, 0x4C, 0x41, 0xFF, 0x0D, 0x5A, 0xFF, 0xED, 0x59, 0xFF, 0xCC, 0x51, 0xFF, 0xCD, 0x51, 0xFF, 0xF4, 0x61, 0xFF, 0xCE, 0x51, 0xFF, 0xAD, 0x51, 0xFF, 0x90, 0x6A, 0xFF, 0x8D, 0x49, 0xFF, 0xF0, 0x51, 0xFF, 0xCE, 0x49, 0xFF, 0xB2, 0x6A, 0xFF, 0x4C, 0x39, 0xFF, 0x6C, 0x39, 0xFF, 0xAF, 0x41, 0xFF, 0x6B, 0x39, 0xFF, 0xF2, 0x6A, 0xFF, 0x0A, 0x31, 0xFF, 0x4A, 0x31, 0xFF, 0x8D, 0x41, 0xFF, 0x6A, 0x39, 0xFF,
-    0x2A, 0x29, 0xFF, 0xCC, 0x41, 0xFF, 0x69, 0x31, 0xFF, 0xCD, 0x41, 0xFF, 0x4E, 0x52, 0xFF, 0xAB, 0x41, 0xFF, 0x49, 0x31, 0xFF, 0x29, 0x31, 0xFF, 0x4A, 0x31, 0xFF, 0x73, 0x73, 0xFF, 0x6C, 0x41, 0xFF, 0x4A, 0x39, 0xFF, 0x6B, 0x39, 0xFF, 0xAC, 0x41, 0xFF, 0x12, 0x6B, 0xFF, 0x8B, 0x41, 0xFF, 0xAB, 0x49, 0xFF, 0x8B, 0x49, 0xFF, 0xEE, 0x59, 0xFF, 0xF6, 0x9B, 0xFF, 0x8B, 0x51, 0xFF, 0xAB, 0x59, 0xFF, 0x0C, 0x62, 0xFF, 0x33, 0xA4, 0xFF, 0x92, 0x9B, 0xFF, 0x0C, 0x6A, 0xFF, 0x2C, 0x6A, 0xFF, 0x4C, 0x6A, 0xFF, 0x71, 0x93, 0xFF, 0xEE, 0x82, 0xFF, 0x2B, 0x6A, 0xFF, 0x0A, 0x62, 0xFF, 0x89, 0x51, 0xFF, 0x8D, 0x6A, 0xFF, 0x68, 0x49, 0xFF, 0xE9, 0x59, 0xFF, 0xA8, 0x49, 0xFF, 0x2A, 0x52, 0xFF, 0x29, 0x5A, 0xFF, 0x87, 0x41, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x39, 0xFF, 0xAB, 0x62, 0xFF, 0x87, 0x41, 0xFF, 0xA7, 0x39, 0xFF, 0xA7, 0x41, 0xFF, 0x86, 0x39, 0xFF, 0xC7, 0x41, 0xFF, 0xCA, 0x41, 0xFF, 0xE6, 0x28, 0xFF, 0x07, 0x29, 0xFF, 0xAF, 0x62, 0xFF, 0x08, 0x29, 0xFF, 0x8D, 0x5A, 0xFF, 0xCD, 0x49, 0xFF, 0x10, 0x73, 0xFF, 0xEC, 0x51, 0xFF, 0xED, 0x59, 0xFF, 0x97, 0x9B, 0xFF, 0x32, 0x72, 0xFF, 0xD6, 0x93, 0xFF, 0x2E, 0x62, 0xFF, 0xCF, 0x51, 0xFF, 0x5F, 0xAC, 0xFF,
-    0xB7, 0x59, 0xFF, 0xB8, 0x8B, 0xFF, 0x6D, 0x41, 0xFF, 0x6D, 0x41, 0xFF, 0x2E, 0x39, 0xFF, 0x12, 0x52, 0xFF, 0xB0, 0x41, 0xFF, 0x8D, 0x41, 0xFF, 0x8B, 0x41, 0xFF, 0xEE, 0x49, 0xFF, 0x6A, 0x39, 0xFF, 0x8B, 0x39, 0xFF, 0x29, 0x31, 0xFF, 0x0C, 0x4A, 0xFF, 0x4A, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x29, 0x31, 0xFF, 0xEC, 0x49, 0xFF, 0x49, 0x31, 0xFF, 0x0E, 0x4A, 0xFF, 0x29, 0x29, 0xFF, 0xCB, 0x41, 0xFF, 0x49, 0x31, 0xFF, 0x29, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0x8B, 0x39, 0xFF, 0xAC, 0x41, 0xFF, 0x4A, 0x39, 0xFF, 0x6B, 0x41, 0xFF, 0xAC, 0x41, 0xFF, 0xB8, 0x8B, 0xFF, 0xCD, 0x51, 0xFF, 0x8B, 0x49, 0xFF, 0xAC, 0x49, 0xFF, 0xCE, 0x51, 0xFF, 0xB9, 0x9B, 0xFF, 0xD0, 0x59, 0xFF, 0xAC, 0x51, 0xFF, 0x0D, 0x62, 0xFF, 0xCF, 0x61, 0xFF, 0x5F, 0xFF, 0xFF, 0x73, 0x92, 0xFF, 0x2D, 0x6A, 0xFF, 0x0C, 0x6A, 0xFF, 0x8F, 0x82, 0xFF, 0xF4, 0xC3, 0xFF, 0x4F, 0x7A, 0xFF, 0x0B, 0x5A, 0xFF, 0xA9, 0x51, 0xFF, 0xA9, 0x51, 0xFF, 0xAC, 0x51, 0xFF, 0x89, 0x49, 0xFF, 0x0A, 0x5A, 0xFF, 0xA8, 0x49, 0xFF, 0x67, 0x41, 0xFF, 0x6B, 0x62, 0xFF, 0x87, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0xA8, 0x41, 0xFF, 0xAC, 0x62, 0xFF, 0xA7, 0x41, 0xFF, 0x87, 0x39, 0xFF, 0xA7, 0x41, 0xFF,
-    0x28, 0x31, 0xFF, 0xAF, 0x5A, 0xFF, 0xC7, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0xE8, 0x28, 0xFF, 0x4A, 0x39, 0xFF, 0xB5, 0x83, 0xFF, 0x49, 0x39, 0xFF, 0xEC, 0x51, 0xFF, 0x8D, 0x51, 0xFF, 0x79, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x7A, 0xFF, 0xAF, 0x51, 0xFF, 0x6F, 0x49, 0xFF, 0xBF, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x49, 0xFF, 0x4D, 0x39, 0xFF, 0x4C, 0x39, 0xFF, 0x91, 0x39, 0xFF, 0xFF, 0xF7, 0xFF, 0x53, 0x39, 0xFF, 0x2B, 0x31, 0xFF, 0x2A, 0x31, 0xFF, 0x6C, 0x39, 0xFF, 0x79, 0x7B, 0xFF, 0x6B, 0x39, 0xFF, 0x09, 0x29, 0xFF, 0x09, 0x31, 0xFF, 0xAA, 0x20, 0xFF, 0x74, 0x6B, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x70, 0x41, 0xFF, 0xAC, 0x41, 0xFF, 0x69, 0x31, 0xFF, 0x28, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0xA9, 0x20, 0xFF, 0x96, 0x7B, 0xFF, 0x6B, 0x39, 0xFF, 0x08, 0x31, 0xFF, 0x8B, 0x41, 0xFF, 0xAC, 0x41, 0xFF, 0x3F, 0x8D, 0xFF, 0x6B, 0x39, 0xFF, 0x6A, 0x41, 0xFF, 0x6B, 0x41, 0xFF, 0x4D, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x41, 0xFF, 0x8C, 0x51, 0xFF, 0x8C, 0x49, 0xFF, 0xCF, 0x61, 0xFF, 0x9F, 0xFF, 0xFF, 0x53, 0x92, 0xFF, 0xCC, 0x61, 0xFF, 0xCC, 0x59, 0xFF, 0x4E, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x9B, 0xFF, 0xCC, 0x59, 0xFF,
-    0x48, 0x41, 0xFF, 0x69, 0x41, 0xFF, 0x6A, 0x41, 0xFF, 0x69, 0x41, 0xFF, 0xED, 0x51, 0xFF, 0x67, 0x41, 0xFF, 0x67, 0x39, 0xFF, 0x66, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0x46, 0x31, 0xFF, 0x87, 0x39, 0xFF, 0x87, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x87, 0x39, 0xFF, 0xC8, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0x28, 0x31, 0xFF, 0xC7, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0xAB, 0x41, 0xFF, 0x09, 0x31, 0xFF, 0x2A, 0x39, 0xFF, 0xEF, 0x51, 0xFF, 0xF1, 0x69, 0xFF, 0xD4, 0x82, 0xFF, 0xAF, 0x51, 0xFF, 0x2D, 0x39, 0xFF, 0x6E, 0x41, 0xFF, 0xF4, 0x59, 0xFF, 0x32, 0x41, 0xFF, 0x2D, 0x39, 0xFF, 0x0C, 0x31, 0xFF, 0xCE, 0x49, 0xFF, 0xEC, 0x28, 0xFF, 0x2F, 0x31, 0xFF, 0x6D, 0x39, 0xFF, 0x2B, 0x31, 0xFF, 0xED, 0x49, 0xFF, 0x6D, 0x39, 0xFF, 0x09, 0x29, 0xFF, 0x29, 0x31, 0xFF, 0x6E, 0x52, 0xFF, 0x08, 0x29, 0xFF, 0x89, 0x20, 0xFF, 0x29, 0x31, 0xFF, 0x49, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0x27, 0x29, 0xFF, 0x6A, 0x31, 0xFF, 0x4D, 0x52, 0xFF, 0x6A, 0x39, 0xFF, 0x08, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0x0C, 0x4A, 0xFF, 0xAB, 0x41, 0xFF, 0x08, 0x29, 0xFF, 0x49, 0x31, 0xFF, 0xAC, 0x41, 0xFF, 0x29, 0x39, 0xFF, 0x29, 0x31, 0xFF,
-    0xCB, 0x49, 0xFF, 0x49, 0x39, 0xFF, 0x6B, 0x41, 0xFF, 0xAE, 0x49, 0xFF, 0xAD, 0x51, 0xFF, 0x8C, 0x49, 0xFF, 0xCD, 0x59, 0xFF, 0x8C, 0x51, 0xFF, 0xAD, 0x59, 0xFF, 0x4C, 0x51, 0xFF, 0x90, 0x72, 0xFF, 0xAB, 0x51, 0xFF, 0xCC, 0x61, 0xFF, 0x0E, 0x6A, 0xFF, 0xED, 0x61, 0xFF, 0xAA, 0x49, 0xFF, 0x69, 0x41, 0xFF, 0x48, 0x39, 0xFF, 0x88, 0x41, 0xFF, 0x0A, 0x4A, 0xFF, 0xC9, 0x49, 0xFF, 0x67, 0x39, 0xFF, 0x47, 0x39, 0xFF, 0xE9, 0x49, 0xFF, 0x8B, 0x41, 0xFF, 0x46, 0x31, 0xFF, 0x67, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0x46, 0x31, 0xFF, 0x67, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0xC8, 0x39, 0xFF, 0xA7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x28, 0x31, 0xFF, 0xC7, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xCD, 0x41, 0xFF, 0x29, 0x31, 0xFF, 0x08, 0x29, 0xFF, 0x09, 0x31, 0xFF, 0x8D, 0x41, 0xFF, 0xCF, 0x51, 0xFF, 0x4D, 0x39, 0xFF, 0x4D, 0x39, 0xFF, 0x2C, 0x39, 0xFF, 0x32, 0x52, 0xFF, 0x71, 0x41, 0xFF, 0x0D, 0x31, 0xFF, 0x2D, 0x31, 0xFF, 0x8D, 0x39, 0xFF, 0x0B, 0x31, 0xFF, 0x0C, 0x31, 0xFF, 0x0B, 0x31, 0xFF, 0x2B, 0x31, 0xFF, 0x4F, 0x52, 0xFF, 0x4A, 0x31, 0xFF, 0x2B, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0x4A, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0x28, 0x29, 0xFF,
-    0x6D, 0x52, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0xE7, 0x28, 0xFF, 0x28, 0x29, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0x29, 0x29, 0xFF, 0x8E, 0x5A, 0xFF, 0x49, 0x39, 0xFF, 0xE7, 0x28, 0xFF, 0x49, 0x31, 0xFF, 0x8A, 0x41, 0xFF, 0xE8, 0x28, 0xFF, 0x69, 0x39, 0xFF, 0x29, 0x31, 0xFF, 0x8A, 0x41, 0xFF, 0xD0, 0x6A, 0xFF, 0x8B, 0x41, 0xFF, 0x8C, 0x41, 0xFF, 0xED, 0x51, 0xFF, 0x6B, 0x41, 0xFF, 0x4B, 0x41, 0xFF, 0x6C, 0x49, 0xFF, 0x6B, 0x49, 0xFF, 0x8C, 0x49, 0xFF, 0xAF, 0x6A, 0xFF, 0xAC, 0x51, 0xFF, 0xCD, 0x51, 0xFF, 0x6B, 0x41, 0xFF, 0x4A, 0x41, 0xFF, 0xAA, 0x41, 0xFF, 0x28, 0x39, 0xFF, 0x48, 0x39, 0xFF, 0x28, 0x31, 0xFF, 0x88, 0x41, 0xFF, 0x26, 0x31, 0xFF, 0x46, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x67, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0x47, 0x31, 0xFF, 0x46, 0x31, 0xFF, 0x67, 0x39, 0xFF, 0x67, 0x39, 0xFF, 0x87, 0x39, 0xFF, 0x87, 0x39, 0xFF, 0xC6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x29, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x4E, 0x52, 0xFF, 0x4B, 0x31, 0xFF, 0x2D, 0x31, 0xFF, 0x0D, 0x31, 0xFF, 0x0D, 0x31, 0xFF, 0x8E, 0x39, 0xFF, 0xAF, 0x41, 0xFF, 0xB0, 0x20, 0xFF,
-    0x0E, 0x29, 0xFF, 0x6F, 0x39, 0xFF, 0x55, 0x5A, 0xFF, 0x0A, 0x29, 0xFF, 0x2C, 0x31, 0xFF, 0x6C, 0x39, 0xFF, 0x51, 0x52, 0xFF, 0xE9, 0x28, 0xFF, 0x2A, 0x31, 0xFF, 0xAB, 0x39, 0xFF, 0x09, 0x29, 0xFF, 0x8F, 0x52, 0xFF, 0xE8, 0x28, 0xFF, 0xAA, 0x41, 0xFF, 0xC6, 0x20, 0xFF, 0x8B, 0x39, 0xFF, 0xEC, 0x41, 0xFF, 0x08, 0x29, 0xFF, 0xC6, 0x20, 0xFF, 0x8A, 0x39, 0xFF, 0x0C, 0x4A, 0xFF, 0x28, 0x31, 0xFF, 0xE7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x29, 0x29, 0xFF, 0x8E, 0x5A, 0xFF, 0x29, 0x31, 0xFF, 0xE7, 0x28, 0xFF, 0xA9, 0x39, 0xFF, 0x49, 0x31, 0xFF, 0xAF, 0x62, 0xFF, 0x08, 0x31, 0xFF, 0x08, 0x31, 0xFF, 0xAA, 0x41, 0xFF, 0x8B, 0x41, 0xFF, 0x6B, 0x41, 0xFF, 0x2A, 0x31, 0xFF, 0xCC, 0x49, 0xFF, 0x0B, 0x39, 0xFF, 0xB2, 0x62, 0xFF, 0x6E, 0x41, 0xFF, 0xAE, 0x49, 0xFF, 0x8C, 0x49, 0xFF, 0x6B, 0x41, 0xFF, 0x72, 0x62, 0xFF, 0x6D, 0x41, 0xFF, 0x8C, 0x41, 0xFF, 0x2A, 0x39, 0xFF, 0x29, 0x31, 0xFF, 0x8F, 0x5A, 0xFF, 0x08, 0x31, 0xFF, 0x07, 0x31, 0xFF, 0x68, 0x39, 0xFF, 0x6D, 0x5A, 0xFF, 0x06, 0x31, 0xFF, 0x26, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x27, 0x31, 0xFF, 0x2A, 0x4A, 0xFF, 0x47, 0x31, 0xFF, 0x26, 0x31, 0xFF, 0x46, 0x31, 0xFF, 0x66, 0x31, 0xFF, 0x66, 0x31, 0xFF,
-    0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xC6, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xC7, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x6C, 0x39, 0xFF, 0xCA, 0x20, 0xFF, 0xD0, 0x28, 0xFF, 0x56, 0x20, 0xFF, 0x35, 0x31, 0xFF, 0x10, 0x31, 0xFF, 0x0F, 0x29, 0xFF, 0x54, 0x20, 0xFF, 0x1B, 0x31, 0xFF, 0x92, 0x20, 0xFF, 0xCC, 0x28, 0xFF, 0x0B, 0x29, 0xFF, 0x0B, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x0A, 0x29, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x49, 0x31, 0xFF, 0x08, 0x21, 0xFF, 0xC7, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0xAF, 0x62, 0xFF, 0x89, 0x39, 0xFF, 0xC7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xEC, 0x49, 0xFF, 0x08, 0x29, 0xFF, 0x49, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xC7, 0x28, 0xFF, 0x10, 0x6B, 0xFF, 0xE7, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0xBA, 0x83, 0xFF, 0x09, 0x31, 0xFF, 0x0A, 0x31, 0xFF, 0xEA, 0x30, 0xFF, 0x50, 0x41, 0xFF, 0xFF, 0xB5, 0xFF, 0xD1, 0x38, 0xFF, 0x4C, 0x39, 0xFF, 0x4B, 0x41, 0xFF, 0x10, 0x39, 0xFF, 0xFF, 0xA4, 0xFF, 0xF4, 0x30, 0xFF, 0x0B, 0x31, 0xFF,
-    0x2A, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0x95, 0x5A, 0xFF, 0x08, 0x31, 0xFF, 0x28, 0x31, 0xFF, 0x07, 0x31, 0xFF, 0x0A, 0x52, 0xFF, 0x8D, 0x5A, 0xFF, 0x06, 0x31, 0xFF, 0x06, 0x29, 0xFF, 0x26, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x2B, 0x52, 0xFF, 0x46, 0x31, 0xFF, 0x46, 0x31, 0xFF, 0x46, 0x31, 0xFF, 0xA5, 0x18, 0xFF, 0x0C, 0x4A, 0xFF, 0xA6, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x18, 0xFF, 0x52, 0x52, 0xFF, 0x4B, 0x31, 0xFF, 0xA9, 0x20, 0xFF, 0xCA, 0x28, 0xFF, 0x93, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x08, 0xFF, 0xF0, 0x30, 0xFF, 0x10, 0x31, 0xFF, 0x98, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0x18, 0xFF, 0xCB, 0x20, 0xFF, 0xC9, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xFE, 0x3A, 0xFF, 0x6A, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0xEC, 0x41, 0xFF, 0xC8, 0x20, 0xFF, 0xAD, 0x39, 0xFF, 0xA7, 0x20, 0xFF, 0xEC, 0x41, 0xFF, 0xC6, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0x49, 0x31, 0xFF, 0xC7, 0x20, 0xFF, 0x27, 0x29, 0xFF, 0xC6, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0x48, 0x31, 0xFF, 0x69, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0xA6, 0x18, 0xFF, 0x28, 0x29, 0xFF, 0x31, 0x6B, 0xFF, 0xE7, 0x28, 0xFF, 0xC6, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x2C, 0x4A, 0xFF, 0x29, 0x29, 0xFF, 0xE7, 0x28, 0xFF,
-    0x89, 0x39, 0xFF, 0xE8, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xFE, 0x6C, 0xFF, 0x4C, 0x39, 0xFF, 0xE9, 0x30, 0xFF, 0xEE, 0x49, 0xFF, 0xEE, 0x30, 0xFF, 0xFD, 0x51, 0xFF, 0xD0, 0x30, 0xFF, 0xCD, 0x41, 0xFF, 0x2C, 0x39, 0xFF, 0x10, 0x39, 0xFF, 0xFF, 0xCD, 0xFF, 0x1E, 0x20, 0xFF, 0x4D, 0x39, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x6A, 0x39, 0xFF, 0xE7, 0x28, 0xFF, 0xE6, 0x28, 0xFF, 0x06, 0x29, 0xFF, 0x88, 0x39, 0xFF, 0x06, 0x29, 0xFF, 0x26, 0x29, 0xFF, 0x06, 0x29, 0xFF, 0x06, 0x29, 0xFF, 0x46, 0x31, 0xFF, 0x46, 0x31, 0xFF, 0x46, 0x31, 0xFF, 0x46, 0x31, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xC6, 0x20, 0xFF, 0xA5, 0x18, 0xFF, 0xC6, 0x20, 0xFF, 0xA6, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0x0A, 0x29, 0xFF, 0xC9, 0x20, 0xFF, 0xCA, 0x20, 0xFF, 0xEE, 0x28, 0xFF, 0x73, 0x18, 0xFF, 0x8F, 0x20, 0xFF, 0xEE, 0x28, 0xFF, 0xEE, 0x28, 0xFF, 0x8D, 0x20, 0xFF, 0x90, 0x20, 0xFF, 0x8C, 0x20, 0xFF, 0x6D, 0x39, 0xFF, 0xEA, 0x28, 0xFF, 0xA9, 0x20, 0xFF, 0xC9, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0xCC, 0x39, 0xFF, 0x49, 0x31, 0xFF, 0xA7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0x8A, 0x39, 0xFF, 0xE7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xE6, 0x20, 0xFF,
-    0xCB, 0x39, 0xFF, 0x48, 0x31, 0xFF, 0x28, 0x29, 0xFF, 0xE6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x69, 0x31, 0xFF, 0xA6, 0x20, 0xFF, 0xA5, 0x18, 0xFF, 0x08, 0x29, 0xFF, 0x8A, 0x39, 0xFF, 0xCF, 0x62, 0xFF, 0xC6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xA6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x07, 0x31, 0xFF, 0xE7, 0x28, 0xFF, 0x2D, 0x52, 0xFF, 0xE8, 0x28, 0xFF, 0x4A, 0x39, 0xFF, 0xE8, 0x28, 0xFF, 0x2E, 0x52, 0xFF, 0xCA, 0x28, 0xFF, 0x0C, 0x31, 0xFF, 0xCB, 0x28, 0xFF, 0x2A, 0x31, 0xFF, 0xCD, 0x41, 0xFF, 0x4B, 0x31, 0xFF, 0xCD, 0x28, 0xFF, 0xCD, 0x28, 0xFF, 0xCE, 0x49, 0xFF, 0x2A, 0x31, 0xFF, 0xA6, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0x29, 0x31, 0xFF, 0xCA, 0x41, 0xFF, 0xE6, 0x28, 0xFF, 0xE6, 0x28, 0xFF, 0xE6, 0x28, 0xFF, 0xA9, 0x41, 0xFF, 0xE6, 0x28, 0xFF, 0xE5, 0x28, 0xFF, 0x06, 0x29, 0xFF, 0xE5, 0x28, 0xFF, 0x46, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xE7, 0x20, 0xFF, 0xA7, 0x18, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x2B, 0x29, 0xFF, 0xAA, 0x20, 0xFF, 0x8B, 0x18, 0xFF, 0xAB, 0x20, 0xFF, 0xAB, 0x20, 0xFF, 0x4D, 0x31, 0xFF, 0xAB, 0x20, 0xFF,
-    0xAB, 0x18, 0xFF, 0x8A, 0x20, 0xFF, 0xA9, 0x18, 0xFF, 0xA8, 0x20, 0xFF, 0xA8, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0xA8, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0xA6, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x08, 0x29, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xC6, 0x18, 0xFF, 0xC6, 0x20, 0xFF, 0xA5, 0x18, 0xFF, 0x07, 0x29, 0xFF, 0xE6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xA5, 0x20, 0xFF, 0xE6, 0x28, 0xFF, 0x48, 0x31, 0xFF, 0x85, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0x28, 0x31, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xD1, 0x6A, 0xFF, 0x0B, 0x31, 0xFF, 0x6C, 0x39, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0x4C, 0x39, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0x29, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0x6F, 0x41, 0xFF, 0x07, 0x29, 0xFF, 0xEA, 0x41, 0xFF, 0xE6, 0x28, 0xFF, 0xE6, 0x28, 0xFF, 0xE5, 0x20, 0xFF, 0x06, 0x29, 0xFF, 0xE9, 0x41, 0xFF, 0xE5, 0x28, 0xFF, 0x05, 0x29, 0xFF, 0x05, 0x29, 0xFF, 0x26, 0x29, 0xFF, 0x46, 0x31, 0xFF,
-    0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xAB, 0x39, 0xFF, 0x65, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xA8, 0x18, 0xFF, 0x6F, 0x31, 0xFF, 0xA8, 0x20, 0xFF, 0x89, 0x18, 0xFF, 0x8B, 0x18, 0xFF, 0x4E, 0x31, 0xFF, 0xD1, 0x41, 0xFF, 0xCA, 0x20, 0xFF, 0xAB, 0x20, 0xFF, 0xCB, 0x20, 0xFF, 0xAF, 0x39, 0xFF, 0x68, 0x18, 0xFF, 0x88, 0x18, 0xFF, 0xA8, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0x50, 0x4A, 0xFF, 0xA7, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0xE7, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x2E, 0x4A, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x07, 0x29, 0xFF, 0x84, 0x18, 0xFF, 0xC6, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x07, 0x29, 0xFF, 0x4C, 0x4A, 0xFF, 0x07, 0x29, 0xFF, 0xA5, 0x18, 0xFF, 0xC6, 0x20, 0xFF, 0xA5, 0x20, 0xFF, 0x8E, 0x5A, 0xFF, 0xA6, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x10, 0x4A, 0xFF, 0xAB, 0x20, 0xFF, 0xAA, 0x20, 0xFF, 0xC9, 0x28, 0xFF,
-    0x86, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0x86, 0x20, 0xFF, 0x69, 0x39, 0xFF, 0xA5, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xA5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0x06, 0x29, 0xFF, 0x05, 0x29, 0xFF, 0x06, 0x29, 0xFF, 0x26, 0x29, 0xFF, 0x26, 0x29, 0xFF, 0x44, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0x73, 0x94, 0xFF, 0xC6, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0xA6, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xEA, 0x20, 0xFF, 0xA9, 0x20, 0xFF, 0x8C, 0x18, 0xFF, 0x57, 0x10, 0xFF, 0x18, 0x00, 0xFF, 0x70, 0x18, 0xFF, 0xAA, 0x18, 0xFF, 0x6A, 0x18, 0xFF, 0x94, 0x28, 0xFF, 0x8B, 0x18, 0xFF, 0xA9, 0x18, 0xFF, 0x2A, 0x31, 0xFF, 0x8B, 0x39, 0xFF, 0xA7, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x8A, 0x31, 0xFF, 0x86, 0x18, 0xFF, 0x6E, 0x52, 0xFF, 0xA6, 0x18, 0xFF, 0x69, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0x69, 0x31, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0xEC, 0x41, 0xFF, 0x0B, 0x4A, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x27, 0x29, 0xFF, 0x8E, 0x5A, 0xFF, 0xE6, 0x20, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xE7, 0x20, 0xFF, 0xAF, 0x5A, 0xFF, 0xC5, 0x20, 0xFF,
-    0xC6, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0xEF, 0x6A, 0xFF, 0x90, 0x5A, 0xFF, 0x66, 0x18, 0xFF, 0x86, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x8A, 0x20, 0xFF, 0xFA, 0x30, 0xFF, 0xAA, 0x20, 0xFF, 0x6B, 0x39, 0xFF, 0xC9, 0x20, 0xFF, 0xAF, 0x20, 0xFF, 0x7F, 0x3B, 0xFF, 0xD3, 0x20, 0xFF, 0x89, 0x20, 0xFF, 0xA8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xB6, 0x41, 0xFF, 0x87, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xAA, 0x39, 0xFF, 0xA5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xEA, 0x41, 0xFF, 0xE5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0x05, 0x21, 0xFF, 0x85, 0x10, 0xFF, 0xEC, 0x39, 0xFF, 0x85, 0x10, 0xFF, 0xE7, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0x51, 0x52, 0xFF, 0xC7, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0xC9, 0x20, 0xFF, 0x4D, 0x10, 0xFF, 0xFF, 0xF7, 0xFF, 0x1A, 0x00, 0xFF, 0x8C, 0x20, 0xFF, 0x69, 0x18, 0xFF, 0x8A, 0x18, 0xFF, 0xFF, 0x87, 0xFF, 0x8A, 0x10, 0xFF, 0x87, 0x18, 0xFF, 0xA8, 0x20, 0xFF, 0x87, 0x18, 0xFF, 0x4C, 0x31, 0xFF, 0xA6, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x85, 0x18, 0xFF,
-    0xC5, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0xC6, 0x20, 0xFF, 0x2C, 0x4A, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xC6, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xCA, 0x41, 0xFF, 0xC7, 0x28, 0xFF, 0xC6, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xAB, 0x39, 0xFF, 0xA8, 0x20, 0xFF, 0xAA, 0x20, 0xFF, 0x88, 0x20, 0xFF, 0x0C, 0x4A, 0xFF, 0xC8, 0x20, 0xFF, 0x4A, 0x18, 0xFF, 0x1C, 0x00, 0xFF, 0x16, 0x08, 0xFF, 0x8C, 0x39, 0xFF, 0x46, 0x10, 0xFF, 0xC7, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x44, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x20, 0xFF, 0x68, 0x31, 0xFF, 0xA4, 0x18, 0xFF, 0xA4, 0x18, 0xFF, 0xC5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0x05, 0x29, 0xFF, 0x85, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0xC7, 0x20, 0xFF, 0x85, 0x10, 0xFF, 0x8A, 0x31, 0xFF, 0x86, 0x18, 0xFF, 0x66, 0x10, 0xFF, 0x88, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0x8E, 0x39, 0xFF, 0x4D, 0x18, 0xFF, 0x6B, 0x18, 0xFF, 0xA9, 0x18, 0xFF, 0x6D, 0x31, 0xFF, 0x88, 0x18, 0xFF,
-    0x88, 0x18, 0xFF, 0x67, 0x10, 0xFF, 0x87, 0x18, 0xFF, 0xC8, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0x0C, 0x42, 0xFF, 0x85, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xCA, 0x39, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0xC5, 0x20, 0xFF, 0x0B, 0x42, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA6, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0x87, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0xAB, 0x41, 0xFF, 0xA8, 0x20, 0xFF, 0x69, 0x18, 0xFF, 0xAA, 0x20, 0xFF, 0x87, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0xC5, 0x20, 0xFF, 0x84, 0x18, 0xFF, 0xA4, 0x18, 0xFF, 0xA5, 0x20, 0xFF, 0xA4, 0x18, 0xFF, 0xC5, 0x20, 0xFF, 0xC4, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0xE5, 0x20, 0xFF,
-    0x44, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0xA6, 0x18, 0xFF, 0x64, 0x08, 0xFF, 0x65, 0x10, 0xFF, 0x86, 0x10, 0xFF, 0x86, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0x47, 0x10, 0xFF, 0x88, 0x18, 0xFF, 0x88, 0x18, 0xFF, 0x50, 0x52, 0xFF, 0x67, 0x10, 0xFF, 0x87, 0x18, 0xFF, 0x66, 0x10, 0xFF, 0x87, 0x10, 0xFF, 0x46, 0x10, 0xFF, 0x86, 0x10, 0xFF, 0xC7, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x49, 0x31, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x07, 0x29, 0xFF, 0x0C, 0x42, 0xFF, 0xC5, 0x20, 0xFF, 0x06, 0x29, 0xFF, 0xC6, 0x20, 0xFF, 0x64, 0x10, 0xFF, 0x0B, 0x42, 0xFF, 0x85, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0xC5, 0x20, 0xFF, 0xEB, 0x41, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0xA4, 0x18, 0xFF, 0x48, 0x31, 0xFF, 0xCB, 0x39, 0xFF, 0x64, 0x10, 0xFF, 0x64, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x48, 0x31, 0xFF, 0xA6, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x6A, 0x39, 0xFF, 0xCB, 0x39, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x6C, 0x31, 0xFF, 0x66, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0x87, 0x18, 0xFF,
-    0x6A, 0x39, 0xFF, 0xA6, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x89, 0x39, 0xFF, 0xC5, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x88, 0x39, 0xFF, 0xA4, 0x18, 0xFF, 0xC4, 0x18, 0xFF, 0xC4, 0x20, 0xFF, 0xC4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x64, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x85, 0x10, 0xFF, 0x28, 0x29, 0xFF, 0x85, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0x86, 0x18, 0xFF, 0xEC, 0x39, 0xFF, 0x86, 0x10, 0xFF, 0x87, 0x18, 0xFF, 0x87, 0x10, 0xFF, 0xC8, 0x18, 0xFF, 0x4B, 0x29, 0xFF, 0x87, 0x18, 0xFF, 0x66, 0x10, 0xFF, 0x46, 0x10, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x10, 0xFF, 0x86, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0x85, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0xC6, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0xC5, 0x20, 0xFF, 0xA5, 0x18, 0xFF, 0xA4, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x43, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x85, 0x18, 0xFF,
-    0xA4, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x45, 0x10, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x66, 0x18, 0xFF, 0x66, 0x18, 0xFF, 0x47, 0x10, 0xFF, 0x66, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0xA4, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x63, 0x10, 0xFF, 0xC4, 0x18, 0xFF, 0x26, 0x29, 0xFF, 0xA4, 0x18, 0xFF, 0xC4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x64, 0x10, 0xFF, 0x44, 0x10, 0xFF, 0x24, 0x08, 0xFF, 0x64, 0x10, 0xFF, 0x44, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0x8A, 0x39, 0xFF, 0xAC, 0x39, 0xFF, 0x86, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0x66, 0x10, 0xFF, 0xEC, 0x20, 0xFF, 0xD2, 0x28, 0xFF, 0xA8, 0x18, 0xFF, 0x86, 0x10, 0xFF, 0x86, 0x18, 0xFF, 0xB1, 0x39, 0xFF, 0x4B, 0x31, 0xFF, 0xA6, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0x08, 0x29, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0x86, 0x18, 0xFF, 0x89, 0x39, 0xFF, 0x48, 0x39, 0xFF, 0x85, 0x18, 0xFF, 0x47, 0x31, 0xFF, 0x49, 0x29, 0xFF,
-    0x26, 0x29, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x0C, 0x42, 0xFF, 0x84, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0xC5, 0x18, 0xFF, 0x2C, 0x4A, 0xFF, 0xC6, 0x20, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x2C, 0x4A, 0xFF, 0x27, 0x31, 0xFF, 0x84, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0xA5, 0x20, 0xFF, 0x6A, 0x31, 0xFF, 0xE6, 0x20, 0xFF, 0x44, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0x65, 0x18, 0xFF, 0x5C, 0x0C, 0xFF, 0x66, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0x87, 0x18, 0xFF, 0xBC, 0x00, 0xFF, 0xAA, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0xEB, 0x41, 0xFF, 0x64, 0x10, 0xFF, 0x5A, 0x31, 0xFF, 0x64, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0xA9, 0x39, 0xFF, 0x63, 0x10, 0xFF, 0x43, 0x10, 0xFF, 0xE5, 0x20, 0xFF, 0x87, 0x39, 0xFF, 0x89, 0x31, 0xFF, 0xA4, 0x18, 0xFF, 0xE4, 0x20, 0xFF, 0xC4, 0x18, 0xFF, 0x23, 0x08, 0xFF, 0x0C, 0x4A, 0xFF, 0x64, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x44, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x10, 0xFF, 0x85, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0x86, 0x10, 0xFF, 0x45, 0x08, 0xFF, 0x17, 0x00, 0xFF, 0x6C, 0x08, 0xFF, 0xA7, 0x18, 0xFF, 0x65, 0x10, 0xFF, 0x86, 0x18, 0xFF,
-    0x88, 0x10, 0xFF, 0x86, 0x18, 0xFF, 0x86, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0x85, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0xA5, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0xA4, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x63, 0x10, 0xFF, 0xA4, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x10, 0xFF, 0x83, 0x10, 0xFF, 0x83, 0x10, 0xFF, 0xA4, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x85, 0x18, 0xFF, 0x65, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0x65, 0x10, 0xFF, 0x68, 0x10, 0xFF, 0x66, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x85, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x43, 0x10, 0xFF, 0x64, 0x10, 0xFF, 0x63, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x63, 0x10, 0xFF, 0x84, 0x18, 0xFF, 0x83, 0x10, 0xFF, 0x83, 0x10, 0xFF, 0xA4, 0x18, 0xFF, 0x83, 0x10, 0xFF, 0x83, 0x18, 0xFF,
+    0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xCB, 0x5A, 0xE4, 0x18, 0x04, 0x21, 0x25, 0x29, 0x45, 0x29, 0x0C, 0x5B, 0x25, 0x21, 0x04, 0x21, 0x45, 0x29, 0x25, 0x29, 0x86, 0x31, 0x25, 0x29, 0xA7, 0x31, 0xE4, 0x20, 0x66, 0x29, 0x66, 0x29, 0x8D, 0x6B, 0x04, 0x21, 0x45, 0x29, 0x86, 0x31, 0x25, 0x21, 0x05, 0x21, 0xCC, 0x5A, 0x45, 0x29, 0x25, 0x21, 0x05, 0x21, 0x66, 0x29, 0xED, 0x5A, 0x25, 0x29,
+    0x04, 0x21, 0x45, 0x29, 0x25, 0x21, 0xC4, 0x18, 0x05, 0x21, 0xE4, 0x18, 0xE4, 0x18, 0xC4, 0x18, 0xE5, 0x20, 0x6A, 0x4A, 0x05, 0x21, 0x05, 0x21, 0x05, 0x21, 0x05, 0x21, 0x2E, 0x5B, 0x25, 0x21, 0xE5, 0x18, 0x05, 0x21, 0xE5, 0x18, 0xE4, 0x18, 0x05, 0x21, 0x46, 0x29, 0x25, 0x21, 0x05, 0x21, 0x26, 0x21, 0x8F, 0x63, 0x25, 0x21, 0x05, 0x21, 0x04, 0x19, 0xE4, 0x18, 0x6B, 0x4A, 0x45, 0x29,
+    0x25, 0x21, 0xC3, 0x18, 0x45, 0x21, 0x05, 0x21, 0x0C, 0x5B, 0x25, 0x21, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0xCB, 0x52, 0x66, 0x29, 0x66, 0x31, 0x86, 0x31, 0x45, 0x21, 0xEB, 0x5A, 0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xD3, 0x9C, 0x04, 0x21, 0xE4, 0x20, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0xE4, 0x20, 0xE4, 0x20, 0x45, 0x29, 0x45, 0x29, 0x25, 0x29, 0xA7, 0x31, 0xC7, 0x39,
+    0x45, 0x29, 0x25, 0x29, 0x65, 0x31, 0x66, 0x29, 0x45, 0x29, 0x05, 0x21, 0x25, 0x29, 0x24, 0x21, 0x45, 0x29, 0x25, 0x21, 0x04, 0x21, 0x25, 0x29, 0x45, 0x29, 0x45, 0x29, 0x46, 0x29, 0x25, 0x21, 0x45, 0x29, 0x05, 0x21, 0x25, 0x21, 0x25, 0x21, 0x46, 0x29, 0x8A, 0x52, 0xC4, 0x18, 0x05, 0x21, 0xE4, 0x18, 0x4E, 0x6B, 0xC4, 0x18, 0xE4, 0x18, 0x25, 0x21, 0x26, 0x21, 0xD5, 0x94, 0x06, 0x21,
+    0x67, 0x29, 0x67, 0x29, 0x46, 0x29, 0x25, 0x21, 0x25, 0x21, 0x66, 0x31, 0x04, 0x21, 0x05, 0x21, 0x05, 0x21, 0x05, 0x21, 0x66, 0x31, 0xE4, 0x18, 0x25, 0x21, 0x04, 0x21, 0xF2, 0x7B, 0xE4, 0x18, 0x04, 0x21, 0x04, 0x21, 0x05, 0x21, 0x04, 0x21, 0x25, 0x21, 0x66, 0x29, 0x25, 0x21, 0x25, 0x21, 0x45, 0x29, 0x25, 0x21, 0x25, 0x21, 0x45, 0x29, 0x66, 0x29, 0x66, 0x29, 0x08, 0x3A, 0x08, 0x42,
+    0x24, 0x21, 0x04, 0x21, 0x24, 0x21, 0x25, 0x21, 0x25, 0x21, 0x03, 0x21, 0x25, 0x21, 0x25, 0x21, 0x66, 0x31, 0x04, 0x21, 0xAE, 0x73, 0x25, 0x29, 0x66, 0x29, 0x24, 0x21, 0x45, 0x29, 0xCF, 0x73, 0x4D, 0x6B, 0x25, 0x21, 0x45, 0x29, 0x24, 0x21, 0xAE, 0x73, 0x04, 0x21, 0x45, 0x29, 0x04, 0x21, 0x45, 0x29, 0x66, 0x29, 0x25, 0x21, 0x46, 0x29, 0x05, 0x21, 0x25, 0x21, 0x46, 0x29, 0x05, 0x21,
+    0xE4, 0x18, 0xE4, 0x18, 0x25, 0x21, 0x04, 0x21, 0xE4, 0x18, 0xA8, 0x39, 0x05, 0x21, 0x05, 0x21, 0x05, 0x21, 0x05, 0x21, 0x05, 0x21, 0x05, 0x21, 0x46, 0x29, 0x05, 0x21, 0xCD, 0x52, 0x25, 0x21, 0x05, 0x21, 0x05, 0x21, 0x05, 0x21, 0xAF, 0x6B, 0x05, 0x21, 0x05, 0x21, 0x25, 0x21, 0x45, 0x29, 0x90, 0x6B, 0x05, 0x21, 0x25, 0x29, 0x25, 0x21, 0x66, 0x29, 0xF0, 0x7B, 0x04, 0x21, 0xE4, 0x18,
+    0x04, 0x21, 0x04, 0x21, 0x25, 0x21, 0x45, 0x29, 0x66, 0x29, 0x04, 0x21, 0x24, 0x21, 0x25, 0x21, 0x25, 0x21, 0x45, 0x21, 0x66, 0x29, 0x66, 0x29, 0x86, 0x29, 0x45, 0x29, 0x45, 0x29, 0x86, 0x29, 0x2C, 0x63, 0xE3, 0x20, 0x8A, 0x52, 0xC7, 0x39, 0x6E, 0x73, 0x2D, 0x63, 0x25, 0x21, 0x45, 0x29, 0x47, 0x29, 0xD3, 0x9C, 0x76, 0xAD, 0x45, 0x29, 0xA6, 0x31, 0xAE, 0x7B, 0x04, 0x21, 0xCC, 0x52,
+    0x45, 0x29, 0x46, 0x29, 0x45, 0x29, 0x6A, 0x52, 0x08, 0x42, 0x25, 0x29, 0xC3, 0x18, 0x41, 0x08, 0x45, 0x29, 0x8B, 0x52, 0x25, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x08, 0x42, 0x4A, 0x4A, 0x66, 0x29, 0xC3, 0x18, 0x46, 0x29, 0x8B, 0x52, 0x8B, 0x4A, 0x4A, 0x4A, 0xE4, 0x18, 0x05, 0x21, 0x05, 0x21, 0x8B, 0x52, 0x25, 0x21, 0x66, 0x31, 0xA8, 0x31, 0xE9, 0x39, 0x4B, 0x42, 0x25, 0x21,
+    0xC8, 0x18, 0xC4, 0x18, 0x25, 0x21, 0xF5, 0x5A, 0xE4, 0x18, 0xA6, 0x31, 0xA6, 0x31, 0x45, 0x29, 0xB1, 0x52, 0x26, 0x29, 0x46, 0x29, 0x05, 0x21, 0x66, 0x29, 0x6E, 0x6B, 0x08, 0x42, 0x66, 0x29, 0xE4, 0x20, 0x0D, 0x63, 0x66, 0x31, 0x25, 0x21, 0x04, 0x21, 0x45, 0x29, 0x25, 0x21, 0xCC, 0x5A, 0x8D, 0x63, 0x87, 0x31, 0x65, 0x29, 0xA7, 0x31, 0x4D, 0x63, 0xE7, 0x39, 0x86, 0x29, 0x86, 0x31,
+    0x24, 0x21, 0x24, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x45, 0x29, 0x45, 0x29, 0x86, 0x31, 0x66, 0x29, 0x04, 0x21, 0x25, 0x21, 0x45, 0x29, 0x25, 0x29, 0x45, 0x29, 0x86, 0x31, 0xA7, 0x31, 0x45, 0x29, 0x25, 0x21, 0x25, 0x29, 0x86, 0x31, 0x25, 0x29, 0x25, 0x21, 0x66, 0x29, 0x66, 0x29, 0x86, 0x29, 0x25, 0x21, 0x45, 0x29, 0x46, 0x29, 0x46, 0x29, 0x25, 0x21,
+    0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x46, 0x29, 0xC8, 0x39, 0xE4, 0x18, 0xE5, 0x20, 0x25, 0x21, 0xC4, 0x18, 0x46, 0x29, 0xE4, 0x20, 0x25, 0x21, 0x25, 0x21, 0xE5, 0x18, 0x46, 0x29, 0x46, 0x29, 0x25, 0x21, 0x46, 0x29, 0x26, 0x21, 0x46, 0x29, 0x05, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x45, 0x29, 0x7A, 0xC6, 0x26, 0x21, 0x25, 0x21, 0x45, 0x29, 0x25, 0x21,
+    0x04, 0x21, 0xD0, 0x73, 0x24, 0x21, 0x04, 0x21, 0x24, 0x21, 0x25, 0x29, 0x08, 0x3A, 0x45, 0x29, 0x66, 0x29, 0x45, 0x29, 0x65, 0x29, 0x66, 0x31, 0x65, 0x29, 0x45, 0x21, 0xA6, 0x31, 0xC7, 0x39, 0x24, 0x21, 0x04, 0x21, 0x8D, 0x6B, 0xEC, 0x5A, 0x45, 0x29, 0x45, 0x29, 0x04, 0x21, 0xF0, 0x7B, 0x6E, 0x6B, 0xA6, 0x31, 0x45, 0x29, 0x86, 0x31, 0x0C, 0x63, 0x86, 0x31, 0xE7, 0x41, 0x8D, 0x73,
+    0x45, 0x29, 0xA7, 0x31, 0x65, 0x29, 0x66, 0x31, 0x25, 0x21, 0x29, 0x42, 0x86, 0x31, 0x2A, 0x6B, 0x6C, 0x73, 0x05, 0x21, 0xAF, 0x6B, 0x4D, 0x6B, 0xE4, 0x18, 0x25, 0x21, 0x46, 0x29, 0x4E, 0x63, 0xA7, 0x39, 0x25, 0x21, 0x04, 0x21, 0x25, 0x21, 0xE8, 0x39, 0x25, 0x29, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0xE9, 0x39, 0x66, 0x29, 0x05, 0x21, 0x25, 0x21, 0x25, 0x21, 0xEE, 0x5A, 0xA7, 0x31,
+    0xC5, 0x18, 0xE9, 0x39, 0x87, 0x29, 0xE9, 0x41, 0x66, 0x29, 0x8A, 0x52, 0x25, 0x29, 0x4F, 0x5B, 0x09, 0x42, 0x66, 0x29, 0x25, 0x21, 0x05, 0x21, 0x4F, 0x63, 0x25, 0x29, 0x86, 0x31, 0x87, 0x31, 0x04, 0x21, 0x2A, 0x42, 0x25, 0x21, 0x66, 0x29, 0xC7, 0x39, 0xE7, 0x39, 0xA7, 0x31, 0x66, 0x29, 0x45, 0x29, 0x46, 0x29, 0xD5, 0x52, 0xA7, 0x31, 0x66, 0x29, 0x66, 0x29, 0xC7, 0x31, 0xE8, 0x39,
+    0x04, 0x21, 0xC7, 0x39, 0x65, 0x31, 0xB1, 0x94, 0x45, 0x29, 0x25, 0x21, 0x45, 0x29, 0x45, 0x29, 0x2C, 0x63, 0x8B, 0x52, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x08, 0x42, 0x2D, 0x63, 0x46, 0x29, 0x45, 0x29, 0x25, 0x29, 0x46, 0x29, 0x51, 0x8C, 0xC7, 0x39, 0x66, 0x29, 0x46, 0x29, 0x25, 0x21, 0x25, 0x21, 0x31, 0x84, 0x66, 0x29, 0x46, 0x29, 0x25, 0x29, 0x46, 0x29, 0x8E, 0x6B, 0xEC, 0x5A,
+    0x66, 0x29, 0x46, 0x29, 0x25, 0x29, 0x05, 0x21, 0xC9, 0x39, 0x66, 0x29, 0x25, 0x21, 0x05, 0x21, 0x67, 0x29, 0x6E, 0x63, 0x46, 0x29, 0x26, 0x21, 0x46, 0x29, 0x47, 0x29, 0x90, 0x63, 0x26, 0x29, 0x26, 0x21, 0x26, 0x29, 0x05, 0x21, 0xAF, 0x6B, 0x67, 0x31, 0x26, 0x29, 0x66, 0x29, 0x25, 0x29, 0x46, 0x29, 0x90, 0x6B, 0x05, 0x21, 0xED, 0x5A, 0x25, 0x21, 0x45, 0x29, 0xF0, 0x7B, 0x05, 0x21,
+    0xE4, 0x18, 0x25, 0x21, 0x24, 0x21, 0x0F, 0x5B, 0x25, 0x21, 0x45, 0x29, 0x45, 0x29, 0xE7, 0x39, 0xA7, 0x31, 0x2C, 0x63, 0x45, 0x29, 0x46, 0x29, 0x86, 0x31, 0x66, 0x29, 0xD7, 0xD6, 0x86, 0x31, 0x25, 0x29, 0x45, 0x29, 0xC7, 0x39, 0xA7, 0x31, 0x49, 0x4A, 0x25, 0x29, 0x65, 0x29, 0x65, 0x29, 0x66, 0x31, 0x87, 0x31, 0x24, 0x21, 0xC7, 0x39, 0x25, 0x21, 0x0C, 0x63, 0x24, 0x29, 0x66, 0x31,
+    0x66, 0x31, 0xEB, 0x5A, 0x6A, 0x4A, 0x08, 0x42, 0x08, 0x42, 0xA7, 0x31, 0x2D, 0x63, 0x46, 0x29, 0x24, 0x29, 0x05, 0x21, 0x6E, 0x73, 0x66, 0x31, 0x45, 0x29, 0x29, 0x4A, 0x86, 0x31, 0x0D, 0x63, 0x87, 0x31, 0x46, 0x29, 0x25, 0x21, 0x25, 0x21, 0x05, 0x21, 0x46, 0x29, 0x46, 0x29, 0x66, 0x29, 0x87, 0x31, 0x05, 0x21, 0x66, 0x29, 0xE5, 0x18, 0x8B, 0x52, 0xCF, 0x52, 0x2B, 0x42, 0x67, 0x29,
+    0x28, 0x29, 0x0A, 0x42, 0x87, 0x31, 0xC8, 0x39, 0x86, 0x31, 0xA7, 0x31, 0x0F, 0x5B, 0x67, 0x29, 0x87, 0x31, 0x66, 0x29, 0xA7, 0x31, 0x6B, 0x4A, 0x45, 0x29, 0x45, 0x29, 0x25, 0x29, 0xC7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x66, 0x29, 0xC7, 0x39, 0x8A, 0x4A, 0x45, 0x29, 0x66, 0x29, 0xAA, 0x52, 0xE8, 0x39, 0x66, 0x29, 0x66, 0x31, 0x66, 0x29, 0x86, 0x31, 0x86, 0x31, 0x29, 0x42, 0xE8, 0x39,
+    0xAE, 0x73, 0x66, 0x31, 0x86, 0x31, 0x66, 0x31, 0x45, 0x29, 0xEF, 0x7B, 0x08, 0x42, 0x66, 0x31, 0x45, 0x29, 0x66, 0x31, 0xCF, 0x7B, 0xA6, 0x31, 0x66, 0x31, 0x66, 0x31, 0xED, 0x52, 0x50, 0x84, 0x65, 0x29, 0x86, 0x31, 0xE8, 0x39, 0x86, 0x31, 0xC8, 0x39, 0x65, 0x29, 0x66, 0x31, 0x4D, 0x63, 0x25, 0x29, 0x66, 0x31, 0x4E, 0x63, 0x87, 0x31, 0xA7, 0x39, 0x87, 0x31, 0x46, 0x29, 0x2E, 0x63,
+    0x25, 0x29, 0x25, 0x21, 0x46, 0x29, 0x25, 0x21, 0x0E, 0x5B, 0x66, 0x31, 0x25, 0x21, 0x46, 0x29, 0x46, 0x29, 0x0F, 0x5B, 0x67, 0x31, 0x06, 0x21, 0x46, 0x29, 0x8C, 0x4A, 0x54, 0x84, 0x87, 0x31, 0x46, 0x29, 0x09, 0x42, 0x87, 0x31, 0x76, 0x8C, 0xA7, 0x31, 0x87, 0x31, 0x05, 0x19, 0x25, 0x29, 0x51, 0x7C, 0x87, 0x31, 0xCD, 0x52, 0x25, 0x29, 0x46, 0x29, 0x6F, 0x63, 0x25, 0x21, 0x45, 0x29,
+    0x45, 0x29, 0x45, 0x29, 0x10, 0x7C, 0x87, 0x31, 0x66, 0x29, 0x86, 0x31, 0x86, 0x31, 0x90, 0x6B, 0x69, 0x4A, 0x66, 0x31, 0x66, 0x29, 0x66, 0x29, 0x78, 0x63, 0x86, 0x29, 0xA7, 0x31, 0xA6, 0x31, 0x04, 0x21, 0x24, 0x29, 0x24, 0x21, 0xC7, 0x39, 0x65, 0x29, 0x65, 0x29, 0x45, 0x31, 0x86, 0x39, 0x86, 0x31, 0x66, 0x29, 0x29, 0x4A, 0x86, 0x31, 0x65, 0x29, 0x86, 0x31, 0x86, 0x31, 0x25, 0x29,
+    0x25, 0x29, 0x86, 0x31, 0xA7, 0x39, 0xA7, 0x39, 0x86, 0x31, 0x46, 0x29, 0x08, 0x42, 0x66, 0x31, 0x86, 0x31, 0x46, 0x29, 0x66, 0x31, 0x87, 0x31, 0x45, 0x29, 0x66, 0x31, 0x66, 0x29, 0x05, 0x21, 0x86, 0x31, 0x25, 0x21, 0x25, 0x21, 0x45, 0x29, 0xCD, 0x5A, 0x66, 0x31, 0x46, 0x29, 0x87, 0x31, 0x66, 0x29, 0x46, 0x21, 0x67, 0x31, 0x26, 0x21, 0x46, 0x29, 0x47, 0x29, 0x46, 0x29, 0x87, 0x31,
+    0x46, 0x29, 0x67, 0x31, 0x87, 0x31, 0x26, 0x21, 0x46, 0x29, 0xC8, 0x39, 0x46, 0x29, 0x46, 0x29, 0x66, 0x29, 0x66, 0x29, 0x25, 0x21, 0x66, 0x31, 0x66, 0x29, 0x66, 0x29, 0xA7, 0x31, 0x66, 0x29, 0x25, 0x21, 0xC7, 0x31, 0x45, 0x29, 0x86, 0x31, 0x45, 0x29, 0x65, 0x29, 0x65, 0x29, 0x46, 0x29, 0x86, 0x31, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0xA7, 0x31, 0xA6, 0x31, 0xE8, 0x39, 0x86, 0x29,
+    0xA7, 0x39, 0x04, 0x29, 0xAB, 0x5A, 0x8A, 0x52, 0x66, 0x31, 0x45, 0x29, 0x86, 0x31, 0x7B, 0x6B, 0x1E, 0x84, 0xC7, 0x39, 0xA7, 0x31, 0x29, 0x42, 0x10, 0x7C, 0x66, 0x31, 0xA7, 0x31, 0x8B, 0x52, 0x69, 0x4A, 0xAE, 0x6B, 0x69, 0x52, 0x86, 0x31, 0xA7, 0x31, 0x49, 0x4A, 0x86, 0x31, 0x25, 0x29, 0x29, 0x42, 0x4A, 0x4A, 0xED, 0x5A, 0xC8, 0x39, 0x6B, 0x4A, 0x66, 0x31, 0xA7, 0x39, 0x4E, 0x63,
+    0x87, 0x31, 0x05, 0x21, 0x05, 0x21, 0x26, 0x21, 0x0E, 0x5B, 0xA7, 0x31, 0x66, 0x31, 0x46, 0x29, 0x2A, 0x42, 0xEE, 0x5A, 0x67, 0x31, 0x46, 0x29, 0xC8, 0x39, 0x47, 0x29, 0x6E, 0x4A, 0xC9, 0x39, 0x47, 0x29, 0xEA, 0x41, 0xE9, 0x39, 0x53, 0x8C, 0x66, 0x29, 0xEA, 0x39, 0x67, 0x31, 0xBA, 0x42, 0x8B, 0x52, 0xAD, 0x52, 0xA7, 0x31, 0x45, 0x29, 0x90, 0x6B, 0x6B, 0x52, 0x86, 0x31, 0x86, 0x31,
+    0x66, 0x31, 0x0D, 0x63, 0x86, 0x31, 0xA7, 0x39, 0x45, 0x29, 0xCB, 0x52, 0x87, 0x31, 0xA7, 0x31, 0x66, 0x29, 0x66, 0x31, 0xCC, 0x52, 0x87, 0x31, 0xA7, 0x31, 0xE7, 0x39, 0xE8, 0x39, 0xC8, 0x39, 0x86, 0x39, 0x65, 0x29, 0x45, 0x29, 0x12, 0xA5, 0xAF, 0x73, 0x45, 0x29, 0xC7, 0x39, 0x66, 0x31, 0x8B, 0x52, 0x66, 0x31, 0xE8, 0x39, 0x86, 0x31, 0x8B, 0x52, 0xEF, 0x7B, 0xD3, 0x9C, 0x66, 0x29,
+    0x8B, 0x4A, 0xA7, 0x31, 0x87, 0x31, 0xC7, 0x39, 0xAB, 0x5A, 0xA7, 0x31, 0xAF, 0x73, 0x86, 0x31, 0xCC, 0x5A, 0x72, 0x8C, 0x66, 0x31, 0x26, 0x29, 0x8C, 0x52, 0x66, 0x29, 0x73, 0x8C, 0x2F, 0x5B, 0xA8, 0x31, 0x66, 0x29, 0x25, 0x29, 0x46, 0x29, 0x4B, 0x42, 0x87, 0x31, 0x67, 0x31, 0x67, 0x31, 0x26, 0x29, 0x47, 0x29, 0x87, 0x31, 0x26, 0x29, 0x67, 0x29, 0x71, 0x63, 0xD5, 0x94, 0x88, 0x31,
+    0x67, 0x31, 0xA8, 0x39, 0xC9, 0x39, 0x67, 0x29, 0xC9, 0x31, 0x87, 0x31, 0xAE, 0x52, 0x87, 0x31, 0x87, 0x29, 0x15, 0x9D, 0x67, 0x31, 0xD1, 0x73, 0x66, 0x29, 0x87, 0x31, 0x93, 0x8C, 0x25, 0x21, 0x66, 0x29, 0x46, 0x29, 0x45, 0x29, 0x66, 0x31, 0x49, 0x42, 0x66, 0x31, 0x66, 0x29, 0x86, 0x31, 0x66, 0x31, 0x71, 0x8C, 0xA7, 0x31, 0x87, 0x31, 0xC8, 0x39, 0x29, 0x42, 0xCF, 0x73, 0xA7, 0x31,
+    0x45, 0x29, 0x45, 0x29, 0x86, 0x31, 0x25, 0x29, 0x87, 0x31, 0xE8, 0x41, 0x86, 0x31, 0x66, 0x29, 0xA6, 0x39, 0x53, 0x8C, 0xA9, 0x5A, 0xA7, 0x39, 0x86, 0x31, 0x6A, 0x4A, 0x54, 0xAD, 0x47, 0x4A, 0x86, 0x31, 0x09, 0x42, 0xB3, 0x94, 0x51, 0x8C, 0x90, 0x8C, 0xC7, 0x39, 0x86, 0x31, 0x88, 0x31, 0x66, 0x29, 0xF5, 0x9C, 0x29, 0x42, 0x66, 0x31, 0x66, 0x29, 0x87, 0x31, 0x33, 0x84, 0x25, 0x21,
+    0x87, 0x31, 0x25, 0x21, 0x46, 0x29, 0x66, 0x29, 0x07, 0x19, 0x87, 0x31, 0x46, 0x29, 0x67, 0x29, 0x90, 0x6B, 0xBA, 0x73, 0x09, 0x42, 0x46, 0x29, 0xC9, 0x39, 0x51, 0x63, 0x75, 0x8C, 0x8C, 0x52, 0x0A, 0x42, 0xA8, 0x31, 0x87, 0x31, 0x53, 0x8C, 0x53, 0x8C, 0xC9, 0x39, 0xAD, 0x52, 0x67, 0x29, 0x09, 0x42, 0x6F, 0x6B, 0x87, 0x31, 0x87, 0x31, 0x87, 0x31, 0x87, 0x31, 0x35, 0xA5, 0x34, 0xA5,
+    0x66, 0x31, 0x66, 0x29, 0x46, 0x29, 0x92, 0x8C, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xA7, 0x39, 0xA7, 0x31, 0xC7, 0x39, 0xC7, 0x39, 0x86, 0x31, 0xE8, 0x39, 0x08, 0x3A, 0xE8, 0x39, 0x08, 0x3A, 0x0F, 0x84, 0xE8, 0x39, 0x66, 0x31, 0x66, 0x29, 0x86, 0x31, 0xAA, 0x5A, 0xEC, 0x5A, 0xA6, 0x39, 0x66, 0x31, 0x29, 0x42, 0x91, 0x94, 0xE8, 0x39, 0xC7, 0x39, 0x08, 0x42, 0xEC, 0x5A, 0x14, 0xA5,
+    0xE8, 0x41, 0xC8, 0x39, 0x09, 0x42, 0x8F, 0x6B, 0xC7, 0x39, 0xCF, 0x7B, 0xA7, 0x39, 0x4F, 0x63, 0x6A, 0x4A, 0x29, 0x42, 0xD0, 0x73, 0x66, 0x29, 0x46, 0x29, 0xA8, 0x39, 0x66, 0x29, 0x11, 0x7C, 0x6A, 0x4A, 0x26, 0x29, 0x46, 0x29, 0xA8, 0x39, 0xF2, 0x6B, 0x67, 0x31, 0x26, 0x29, 0x46, 0x29, 0x47, 0x29, 0xF2, 0x73, 0x87, 0x31, 0x67, 0x29, 0x69, 0x29, 0xF2, 0x52, 0xD2, 0x73, 0x87, 0x31,
+    0xA8, 0x31, 0x8D, 0x4A, 0x0A, 0x42, 0x11, 0x7C, 0x67, 0x29, 0xA9, 0x31, 0x87, 0x29, 0x87, 0x31, 0x53, 0x84, 0x4E, 0x6B, 0x0E, 0x5B, 0xA8, 0x31, 0x87, 0x31, 0x12, 0x7C, 0xC8, 0x39, 0xA7, 0x31, 0x66, 0x31, 0x66, 0x29, 0xF0, 0x73, 0xC8, 0x39, 0x86, 0x31, 0x66, 0x29, 0xA7, 0x39, 0x49, 0x42, 0x86, 0x31, 0xC7, 0x39, 0xE8, 0x39, 0xE8, 0x39, 0x8F, 0x6B, 0xE8, 0x39, 0x29, 0x42, 0x8A, 0x4A,
+    0x66, 0x31, 0xA6, 0x31, 0xC7, 0x39, 0xA7, 0x31, 0x86, 0x31, 0xC7, 0x39, 0xA7, 0x39, 0x6A, 0x4A, 0xC8, 0x39, 0xE8, 0x39, 0xA7, 0x39, 0xC8, 0x41, 0x8A, 0x52, 0xE8, 0x41, 0xA7, 0x39, 0x8B, 0x52, 0xA8, 0x39, 0xE8, 0x41, 0xE8, 0x39, 0x49, 0x4A, 0xA7, 0x39, 0x18, 0xC6, 0x6A, 0x4A, 0xA7, 0x39, 0x29, 0x42, 0xA7, 0x31, 0x19, 0xBE, 0xA7, 0x31, 0x0E, 0x5B, 0xA8, 0x39, 0x87, 0x31, 0xA7, 0x31,
+    0xED, 0x5A, 0xA8, 0x39, 0x46, 0x29, 0x67, 0x31, 0x6C, 0x42, 0xC9, 0x39, 0x47, 0x29, 0x46, 0x29, 0x67, 0x31, 0x68, 0x31, 0x09, 0x42, 0x26, 0x29, 0xA9, 0x31, 0x0B, 0x42, 0x67, 0x29, 0x88, 0x31, 0xA8, 0x31, 0x2C, 0x42, 0xEA, 0x41, 0x88, 0x31, 0x87, 0x31, 0xEF, 0x52, 0xA8, 0x31, 0x4B, 0x42, 0xC9, 0x39, 0x71, 0x63, 0x87, 0x31, 0xA7, 0x31, 0x29, 0x42, 0x6B, 0x4A, 0xA7, 0x39, 0xA7, 0x39,
+    0x86, 0x31, 0xEC, 0x5A, 0x87, 0x31, 0x86, 0x31, 0x87, 0x31, 0x29, 0x42, 0xC8, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0x29, 0x42, 0xC8, 0x39, 0xE8, 0x39, 0xE8, 0x39, 0x2A, 0x42, 0x4A, 0x42, 0x66, 0x31, 0xA7, 0x39, 0x86, 0x31, 0x6E, 0x73, 0xC7, 0x39, 0xA7, 0x39, 0x86, 0x39, 0x31, 0x8C, 0x4E, 0x6B, 0xC7, 0x39, 0xA7, 0x39, 0x0B, 0x63, 0x30, 0x8C, 0xC7, 0x39, 0x08, 0x42, 0xE8, 0x41,
+    0xAB, 0x5A, 0x29, 0x42, 0xE8, 0x39, 0x29, 0x4A, 0x08, 0x42, 0x8B, 0x52, 0x6E, 0x6B, 0xE8, 0x39, 0x6B, 0x4A, 0xA7, 0x39, 0x33, 0x7C, 0x2D, 0x6B, 0x0D, 0x5B, 0xC8, 0x39, 0xA8, 0x31, 0xB1, 0x6B, 0x0D, 0x63, 0x67, 0x29, 0x47, 0x29, 0x67, 0x31, 0xD3, 0x6B, 0xC8, 0x39, 0x46, 0x29, 0x46, 0x29, 0x67, 0x29, 0xD0, 0x52, 0x09, 0x42, 0x67, 0x31, 0xA9, 0x31, 0x48, 0x29, 0x68, 0x29, 0xC9, 0x39,
+    0xE9, 0x39, 0xC9, 0x39, 0xAE, 0x52, 0x89, 0x29, 0x88, 0x29, 0x88, 0x31, 0xE9, 0x39, 0xD6, 0xAD, 0x4F, 0x6B, 0xE8, 0x39, 0x2A, 0x42, 0xE8, 0x41, 0x54, 0x84, 0xE8, 0x39, 0xC8, 0x39, 0xE8, 0x39, 0xC8, 0x39, 0xA7, 0x31, 0x86, 0x31, 0xC7, 0x39, 0x6A, 0x4A, 0x11, 0x7C, 0xC7, 0x39, 0xC7, 0x39, 0xA7, 0x31, 0xE8, 0x41, 0x8F, 0x6B, 0x29, 0x42, 0xE8, 0x39, 0x09, 0x42, 0x09, 0x3A, 0x6B, 0x4A,
+    0x86, 0x31, 0x86, 0x31, 0xE8, 0x41, 0xA7, 0x39, 0x51, 0x8C, 0x86, 0x31, 0xC7, 0x39, 0x49, 0x4A, 0x29, 0x42, 0xF2, 0x7B, 0xE7, 0x39, 0x8A, 0x52, 0x29, 0x4A, 0x75, 0xB5, 0x08, 0x42, 0x28, 0x42, 0x86, 0x31, 0xC8, 0x39, 0x92, 0x84, 0x08, 0x42, 0x29, 0x42, 0xE8, 0x41, 0xB3, 0x94, 0x09, 0x42, 0xC8, 0x39, 0x09, 0x42, 0xA8, 0x39, 0x90, 0x73, 0x87, 0x31, 0xC8, 0x39, 0xE9, 0x41, 0x13, 0x7C,
+    0xA7, 0x31, 0x67, 0x29, 0x47, 0x29, 0x87, 0x31, 0xB2, 0x73, 0x67, 0x31, 0x26, 0x29, 0x47, 0x29, 0x68, 0x31, 0x8E, 0x52, 0xE9, 0x39, 0x06, 0x21, 0xEA, 0x41, 0x94, 0x63, 0x88, 0x31, 0x0A, 0x42, 0xAD, 0x52, 0x0B, 0x42, 0x8E, 0x52, 0x68, 0x31, 0x0A, 0x42, 0xEA, 0x39, 0x56, 0x7C, 0xE9, 0x39, 0x4B, 0x4A, 0x09, 0x42, 0xE9, 0x39, 0x73, 0x84, 0xE8, 0x39, 0x08, 0x42, 0xE8, 0x41, 0x13, 0x74,
+    0xE8, 0x39, 0x86, 0x31, 0xC7, 0x39, 0xC7, 0x39, 0xF0, 0x73, 0xC7, 0x39, 0xA7, 0x31, 0xC8, 0x39, 0x90, 0x6B, 0xE8, 0x39, 0x08, 0x42, 0x09, 0x42, 0x09, 0x42, 0x6A, 0x4A, 0xAC, 0x4A, 0x6A, 0x4A, 0x86, 0x31, 0xC8, 0x39, 0x08, 0x42, 0x12, 0xA5, 0x91, 0x94, 0x49, 0x4A, 0xC8, 0x41, 0x6A, 0x52, 0xCB, 0x62, 0x91, 0x94, 0xB6, 0xAD, 0x49, 0x4A, 0x08, 0x42, 0x28, 0x4A, 0x33, 0xA5, 0x28, 0x42,
+    0xC7, 0x39, 0x29, 0x4A, 0x28, 0x42, 0xE8, 0x41, 0xB1, 0x94, 0x29, 0x42, 0xE8, 0x41, 0xD5, 0x8C, 0xE8, 0x39, 0x93, 0x94, 0x29, 0x42, 0xE9, 0x41, 0xE9, 0x41, 0xA8, 0x39, 0xB3, 0x94, 0x67, 0x31, 0x70, 0x63, 0xC9, 0x39, 0x67, 0x31, 0xA8, 0x39, 0xB1, 0x73, 0xC8, 0x39, 0x67, 0x31, 0x47, 0x29, 0x48, 0x29, 0x32, 0x84, 0xEA, 0x41, 0x27, 0x21, 0x0B, 0x42, 0x54, 0x5B, 0xF3, 0x7B, 0x0A, 0x42,
+    0xCA, 0x39, 0x70, 0x42, 0xCA, 0x39, 0x32, 0x84, 0xC8, 0x31, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x3A, 0xAC, 0x52, 0xD5, 0x9C, 0xB5, 0x84, 0x2A, 0x42, 0xC7, 0x39, 0x8A, 0x52, 0x74, 0x8C, 0x08, 0x42, 0x09, 0x42, 0xA7, 0x31, 0x6A, 0x4A, 0xD2, 0x9C, 0xC8, 0x39, 0xA7, 0x39, 0xE7, 0x39, 0x09, 0x42, 0xB1, 0x94, 0x30, 0x84, 0x09, 0x42, 0x09, 0x42, 0xAC, 0x4A, 0xCC, 0x52, 0xF0, 0x7B, 0x4A, 0x42,
+    0xD3, 0xA4, 0xC8, 0x39, 0x86, 0x31, 0xC7, 0x39, 0x29, 0x4A, 0xD5, 0xC5, 0x09, 0x42, 0xE8, 0x41, 0xCB, 0x62, 0xE8, 0x41, 0x8A, 0x52, 0x09, 0x42, 0x49, 0x4A, 0x49, 0x52, 0x29, 0x4A, 0x69, 0x52, 0x08, 0x42, 0x29, 0x42, 0xE7, 0x39, 0xB3, 0x94, 0xAC, 0x5A, 0x08, 0x4A, 0x09, 0x42, 0x09, 0x42, 0xA8, 0x39, 0x09, 0x42, 0xCC, 0x5A, 0xE9, 0x41, 0xCE, 0x5A, 0xC8, 0x39, 0x0A, 0x42, 0x88, 0x31,
+    0x70, 0x73, 0xE9, 0x39, 0x87, 0x31, 0xC8, 0x39, 0xEE, 0x5A, 0x09, 0x42, 0x47, 0x29, 0x68, 0x31, 0x88, 0x31, 0x96, 0x94, 0xEA, 0x41, 0x68, 0x29, 0x0B, 0x42, 0x13, 0x63, 0x75, 0x84, 0xEA, 0x39, 0xEA, 0x39, 0x4E, 0x42, 0x2B, 0x42, 0xD6, 0x94, 0xEA, 0x39, 0x37, 0x7C, 0xEA, 0x39, 0xEA, 0x39, 0x36, 0xA5, 0xF5, 0x8C, 0x4A, 0x4A, 0xC8, 0x39, 0xE8, 0x39, 0x54, 0xA5, 0x09, 0x42, 0x29, 0x4A,
+    0xE8, 0x41, 0xC8, 0x31, 0x54, 0xA5, 0xC8, 0x39, 0xE8, 0x39, 0xE8, 0x39, 0xC8, 0x39, 0xF2, 0x94, 0xE8, 0x39, 0xE8, 0x39, 0x29, 0x42, 0x29, 0x42, 0xCF, 0x73, 0x6A, 0x4A, 0x6B, 0x4A, 0xAC, 0x4A, 0x09, 0x42, 0x78, 0xCE, 0x09, 0x42, 0x4A, 0x4A, 0x49, 0x4A, 0xA7, 0x39, 0x96, 0xB5, 0x09, 0x4A, 0xAB, 0x5A, 0xE8, 0x41, 0xAB, 0x5A, 0xF4, 0xCD, 0x0C, 0x63, 0xCB, 0x5A, 0x49, 0x4A, 0x49, 0x4A,
+    0x12, 0x9D, 0x28, 0x42, 0x6A, 0x4A, 0x49, 0x4A, 0x8F, 0x73, 0x95, 0xB5, 0x2A, 0x4A, 0x6B, 0x52, 0xB1, 0x73, 0x4A, 0x52, 0x56, 0xA5, 0x2A, 0x4A, 0x2A, 0x42, 0xE9, 0x41, 0x0A, 0x42, 0x2F, 0x63, 0xC9, 0x39, 0xC9, 0x39, 0x88, 0x31, 0x89, 0x39, 0xB4, 0x6B, 0x0A, 0x42, 0x48, 0x29, 0x68, 0x31, 0xEA, 0x39, 0x28, 0x29, 0x4C, 0x4A, 0x68, 0x31, 0x0B, 0x42, 0x89, 0x31, 0xEC, 0x41, 0x2C, 0x42,
+    0xEC, 0x41, 0x4D, 0x4A, 0x8E, 0x52, 0xEB, 0x39, 0xEC, 0x39, 0x0A, 0x42, 0x4B, 0x4A, 0xF2, 0x7B, 0xAD, 0x52, 0x8C, 0x52, 0x6A, 0x4A, 0x09, 0x42, 0x74, 0xAD, 0x6A, 0x4A, 0x29, 0x4A, 0x6A, 0x4A, 0x6A, 0x4A, 0xE8, 0x39, 0xE8, 0x39, 0x08, 0x42, 0x8B, 0x4A, 0x29, 0x42, 0x09, 0x42, 0x08, 0x42, 0xE8, 0x41, 0x29, 0x42, 0x10, 0x7C, 0x4A, 0x42, 0x29, 0x42, 0x8C, 0x4A, 0x8B, 0x4A, 0xAC, 0x52,
+    0xE8, 0x41, 0xA8, 0x39, 0xC9, 0x39, 0x90, 0x8C, 0xE8, 0x41, 0xE8, 0x41, 0x09, 0x42, 0x29, 0x4A, 0x28, 0x4A, 0x4A, 0x4A, 0xCB, 0x5A, 0xAB, 0x5A, 0xB7, 0xBD, 0x55, 0xAD, 0x0F, 0x63, 0xEB, 0x62, 0xEB, 0x62, 0x54, 0xC6, 0xCB, 0x5A, 0x6A, 0x4A, 0x8B, 0x52, 0x2E, 0x52, 0xB3, 0x94, 0x11, 0x84, 0x6B, 0x52, 0xEE, 0x5A, 0xE9, 0x39, 0x6B, 0x4A, 0x6B, 0x52, 0xAD, 0x5A, 0x2A, 0x42, 0xD4, 0x8C,
+    0x26, 0x29, 0xA8, 0x39, 0xA8, 0x31, 0x68, 0x31, 0xB5, 0x73, 0xAC, 0x5A, 0x88, 0x31, 0x89, 0x31, 0xCA, 0x39, 0x10, 0x63, 0x4C, 0x4A, 0x48, 0x29, 0x0C, 0x42, 0x8A, 0x31, 0x8B, 0x31, 0x2D, 0x4A, 0x50, 0x42, 0x6F, 0x52, 0x73, 0x6B, 0xCC, 0x39, 0xFD, 0x49, 0x8D, 0x52, 0x4B, 0x4A, 0xCF, 0x73, 0x0E, 0x5B, 0x29, 0x42, 0x8A, 0x4A, 0xAB, 0x52, 0xAB, 0x52, 0x8A, 0x52, 0xAB, 0x52, 0xAB, 0x52,
+    0xEC, 0x5A, 0x09, 0x42, 0x4A, 0x4A, 0xEC, 0x5A, 0x29, 0x42, 0x54, 0xA5, 0xF9, 0xDE, 0xE8, 0x39, 0xE8, 0x39, 0x2A, 0x42, 0x09, 0x42, 0x8B, 0x4A, 0x4A, 0x42, 0x6B, 0x4A, 0xCC, 0x52, 0xCC, 0x52, 0xE7, 0x41, 0xC8, 0x39, 0xE9, 0x41, 0x29, 0x42, 0x6A, 0x52, 0x51, 0x8C, 0xA7, 0x39, 0x8B, 0x52, 0x8A, 0x5A, 0xFC, 0xFF, 0x0C, 0x63, 0xB0, 0x73, 0x6E, 0x73, 0x31, 0x8C, 0xB6, 0xB5, 0x2C, 0x63,
+    0xEE, 0x7B, 0xCB, 0x5A, 0xF2, 0xBD, 0xCB, 0x5A, 0xCC, 0x5A, 0x4E, 0x6B, 0xAF, 0x73, 0xED, 0x62, 0xCD, 0x5A, 0x6C, 0x52, 0x2B, 0x4A, 0x54, 0x84, 0x6B, 0x4A, 0x4B, 0x4A, 0x4A, 0x4A, 0x0A, 0x42, 0xEA, 0x41, 0x4B, 0x4A, 0xC9, 0x39, 0x0F, 0x6B, 0x73, 0x6B, 0xAD, 0x5A, 0x89, 0x31, 0x89, 0x39, 0x2D, 0x4A, 0x53, 0x6B, 0x4C, 0x4A, 0xA9, 0x31, 0x6E, 0x4A, 0x97, 0x6B, 0xAC, 0x31, 0x8F, 0x52,
+    0x0F, 0x42, 0x71, 0x52, 0x6F, 0x4A, 0x4F, 0x4A, 0xAE, 0x52, 0x91, 0x73, 0xFC, 0xD6, 0x30, 0x63, 0x0E, 0x5B, 0x6B, 0x4A, 0xCC, 0x5A, 0x6A, 0x4A, 0x0D, 0x5B, 0xAB, 0x52, 0xEC, 0x5A, 0xCE, 0x7B, 0xEC, 0x5A, 0x09, 0x42, 0xAB, 0x52, 0xE9, 0x41, 0x29, 0x4A, 0x29, 0x42, 0x6A, 0x52, 0x09, 0x42, 0x6F, 0x6B, 0x4A, 0x4A, 0x6A, 0x4A, 0x4A, 0x4A, 0x09, 0x42, 0x6B, 0x4A, 0xCD, 0x52, 0xCC, 0x52,
+    0x29, 0x4A, 0xAD, 0x5A, 0xAC, 0x5A, 0xE9, 0x41, 0x09, 0x42, 0x6B, 0x52, 0x74, 0x8C, 0x2A, 0x4A, 0x8B, 0x52, 0x0D, 0x6B, 0xB4, 0x94, 0x4C, 0x6B, 0xCF, 0x7B, 0x6D, 0x73, 0x91, 0x9C, 0xD4, 0xBD, 0x4E, 0x94, 0x4D, 0x94, 0x0F, 0x84, 0x74, 0xAD, 0xD0, 0x7B, 0x2E, 0x6B, 0x8C, 0x52, 0xCF, 0x5A, 0xCF, 0x5A, 0x6F, 0x73, 0x8C, 0x52, 0x4B, 0x4A, 0x4C, 0x4A, 0xE9, 0x39, 0x6C, 0x52, 0x09, 0x42,
+    0xB2, 0x73, 0x94, 0x94, 0xEA, 0x41, 0xA9, 0x39, 0x74, 0x73, 0x8D, 0x52, 0xA9, 0x39, 0xCA, 0x39, 0xAA, 0x39, 0xCB, 0x39, 0x4C, 0x4A, 0xEC, 0x39, 0x4E, 0x4A, 0x95, 0x52, 0x76, 0x8C, 0x70, 0x4A, 0x91, 0x31, 0x57, 0x52, 0xD3, 0x5A, 0xB0, 0x52, 0xAE, 0x52, 0xD4, 0x7B, 0xCD, 0x5A, 0x8C, 0x4A, 0x6F, 0x6B, 0x10, 0x84, 0x13, 0x95, 0xAB, 0x52, 0xAF, 0x73, 0x4E, 0x63, 0x75, 0xAD, 0xAB, 0x52,
+    0x0E, 0x5B, 0x8D, 0x52, 0x0D, 0x5B, 0x55, 0xAD, 0x8A, 0x4A, 0x29, 0x42, 0xEB, 0x5A, 0x09, 0x42, 0xCF, 0x7B, 0x4D, 0x6B, 0x6A, 0x4A, 0x8B, 0x4A, 0x4B, 0x4A, 0x6B, 0x4A, 0xD3, 0x94, 0x2E, 0x5B, 0x71, 0xB5, 0x6B, 0x52, 0xC9, 0x39, 0x74, 0x5A, 0x19, 0xAD, 0x4B, 0x52, 0x90, 0x73, 0xCD, 0x5A, 0x7D, 0x5B, 0x1F, 0x84, 0x14, 0xA5, 0x33, 0xAD, 0xFF, 0xFF, 0x96, 0xE6, 0x93, 0x9C, 0xD0, 0xAC,
+    0xF0, 0xDD, 0x6F, 0xDE, 0x2F, 0x8C, 0x14, 0xA5, 0x39, 0xC6, 0x75, 0xA5, 0xF3, 0x83, 0x11, 0x6B, 0xBA, 0x5A, 0x9F, 0xB5, 0x2B, 0x4A, 0x2B, 0x4A, 0xD3, 0x7B, 0xA9, 0x39, 0x0B, 0x4A, 0xE9, 0x41, 0xEF, 0x5A, 0x4C, 0x4A, 0xC9, 0x39, 0xEA, 0x41, 0xB9, 0x7B, 0x0E, 0x63, 0xEB, 0x41, 0xCA, 0x39, 0x0C, 0x4A, 0x77, 0x94, 0x4F, 0x6B, 0x8B, 0x31, 0x8F, 0x52, 0xCD, 0x39, 0x99, 0x94, 0x97, 0x5A,
+    0xFE, 0x00, 0x7E, 0x10, 0xD4, 0x5A, 0x39, 0xA5, 0xFF, 0xFF, 0x32, 0x94, 0xCE, 0x5A, 0xCD, 0x52, 0xFC, 0xFF, 0x31, 0x9D, 0x4E, 0x6B, 0x2D, 0x63, 0xFF, 0xFF, 0xD6, 0xBD, 0xD1, 0x7B, 0x4F, 0x63, 0xFC, 0x4D, 0x12, 0x42, 0x95, 0xB5, 0x11, 0x42, 0xD2, 0x62, 0x0F, 0x63, 0x2F, 0x6B, 0x34, 0xA5, 0x09, 0x42, 0x4A, 0x4A, 0xED, 0x5A, 0x8C, 0x4A, 0xF2, 0x7B, 0xBC, 0x01, 0xAE, 0x52, 0xED, 0x52,
+    0x2C, 0x6B, 0x94, 0x94, 0xDF, 0xA6, 0xB1, 0x5A, 0x4F, 0x4A, 0x0E, 0x4A, 0x3A, 0xAD, 0x8C, 0x5A, 0x57, 0x94, 0x1A, 0x42, 0x7E, 0x76, 0xB3, 0xC5, 0xB3, 0x9C, 0x99, 0xAD, 0xFF, 0xEF, 0xFA, 0xFF, 0x51, 0xBD, 0xDA, 0xFF, 0xF8, 0xBD, 0x7A, 0xBE, 0xB7, 0xB5, 0x9D, 0xC5, 0xD0, 0x62, 0xAC, 0x5A, 0x70, 0x52, 0x5F, 0x6E, 0xBB, 0x94, 0x0B, 0x42, 0x6C, 0x52, 0x2F, 0x63, 0xA9, 0x39, 0x1B, 0xEF,
+    0xEA, 0x41, 0xCE, 0x5A, 0x0B, 0x4A, 0xAD, 0x5A, 0x16, 0xA5, 0x51, 0x73, 0xCA, 0x39, 0xAA, 0x39, 0xEB, 0x41, 0xF6, 0x83, 0xCF, 0x62, 0xEC, 0x41, 0xB0, 0x39, 0x30, 0x42, 0x52, 0x31, 0xBE, 0x73, 0xFF, 0xFF, 0x1B, 0x63, 0xD6, 0x5A, 0xD4, 0x5A, 0xDF, 0xEF, 0xD9, 0x7B, 0xEF, 0x5A, 0xDC, 0xB5, 0x5C, 0x73, 0xD1, 0x6B, 0x4F, 0x63, 0x5A, 0xBE, 0x37, 0xC6, 0xB3, 0x6B, 0xB1, 0x73, 0xD0, 0x5A,
+    0x73, 0x6B, 0x4B, 0x52, 0xD1, 0x73, 0x0F, 0x63, 0x6B, 0x4A, 0x72, 0x8C, 0x52, 0x6B, 0x8A, 0x52, 0x4A, 0x4A, 0x6A, 0x4A, 0xB3, 0x8C, 0x2E, 0x63, 0xAD, 0x52, 0x6C, 0x4A, 0xCD, 0x52, 0x50, 0x63, 0x09, 0x4A, 0x0A, 0x4A, 0xCF, 0x62, 0x72, 0x73, 0x8C, 0x52, 0x6D, 0x5A, 0xAD, 0x5A, 0x6C, 0x52, 0x79, 0xD6, 0xD7, 0xBD, 0xAD, 0x5A, 0xF0, 0x8B, 0x8E, 0x7B, 0x73, 0x94, 0x94, 0x9C, 0x13, 0xA5,
+    0xAF, 0x9C, 0xD1, 0x9C, 0x78, 0xD6, 0x94, 0x94, 0x32, 0x94, 0x0F, 0x6B, 0xF9, 0xC5, 0x8C, 0x52, 0x6D, 0x52, 0xD0, 0x5A, 0x30, 0x6B, 0xD6, 0x94, 0xEC, 0x41, 0xEA, 0x41, 0xAE, 0x5A, 0x8E, 0x52, 0xCB, 0x41, 0xCF, 0x5A, 0xEA, 0x41, 0xCB, 0x41, 0xD5, 0x94, 0x8F, 0x5A, 0xEB, 0x41, 0xEB, 0x41, 0x0C, 0x42, 0xED, 0x41, 0x51, 0x6B, 0xCC, 0x39, 0xD1, 0x5A, 0x1B, 0x7C, 0x10, 0x42, 0xF6, 0x62,
+    0xF7, 0x41, 0xB8, 0x5A, 0x76, 0x6B, 0x13, 0x63, 0x32, 0x6B, 0xF0, 0x62, 0xFA, 0xAD, 0x91, 0x73, 0x8E, 0x6B, 0x90, 0x84, 0x4F, 0x84, 0x96, 0xD6, 0xB2, 0x73, 0x0F, 0x8C, 0xCE, 0x7B, 0xF3, 0x7B, 0x4E, 0x6B, 0x8D, 0x52, 0x91, 0x6B, 0x6A, 0x52, 0x55, 0xA5, 0x8B, 0x52, 0x0C, 0x5B, 0x49, 0x4A, 0x14, 0x74, 0x6A, 0x4A, 0x49, 0x4A, 0xAB, 0x4A, 0xCF, 0x5A, 0xEF, 0x5A, 0xEF, 0x5A, 0xEE, 0x5A,
+    0x8E, 0x7B, 0x10, 0x63, 0xF2, 0x83, 0x73, 0x73, 0x6C, 0x52, 0xD1, 0x7B, 0x9B, 0x94, 0x31, 0x4A, 0x91, 0x5A, 0xF1, 0x83, 0x93, 0xC5, 0xD1, 0xB4, 0xF0, 0xBC, 0x52, 0xB5, 0xD1, 0xBD, 0x75, 0xE7, 0xEF, 0xCE, 0x53, 0xAD, 0x50, 0x94, 0x53, 0xBD, 0xD3, 0xB4, 0x6F, 0x7B, 0x0F, 0x73, 0x3B, 0x9D, 0x56, 0x52, 0x52, 0x73, 0x95, 0x94, 0xAD, 0x62, 0xD6, 0x73, 0x2B, 0x4A, 0x4D, 0x52, 0x8D, 0x52,
+    0x36, 0x7C, 0x30, 0x6B, 0x2C, 0x4A, 0xAD, 0x39, 0x5E, 0x63, 0x94, 0x5A, 0x0C, 0x4A, 0xCB, 0x39, 0xEC, 0x41, 0x50, 0x4A, 0x10, 0x63, 0xEC, 0x41, 0x74, 0x73, 0x7C, 0x63, 0xD3, 0x5A, 0x15, 0x63, 0xDC, 0x39, 0x9E, 0x42, 0xD5, 0x5A, 0xB1, 0x5A, 0x31, 0x73, 0x9E, 0xF7, 0xB0, 0x73, 0xD0, 0x7B, 0x0F, 0x8D, 0xFD, 0xFF, 0x96, 0xE7, 0x91, 0x94, 0x6F, 0x94, 0xD2, 0xFE, 0xD6, 0xDE, 0x8F, 0x73,
+    0xB2, 0x73, 0x1D, 0x3A, 0x3F, 0x74, 0x2B, 0x42, 0xCC, 0x5A, 0x29, 0x42, 0x50, 0x6B, 0xEE, 0x5A, 0x49, 0x4A, 0x6A, 0x4A, 0xAB, 0x52, 0x0F, 0x5B, 0xCD, 0x5A, 0xEE, 0x5A, 0x9A, 0x4A, 0xF3, 0x52, 0xD3, 0xCD, 0xB0, 0x7B, 0x6F, 0x7B, 0x3E, 0x8F, 0x31, 0x52, 0x75, 0xC5, 0xAF, 0x62, 0x7E, 0x4A, 0x7C, 0x5C, 0xB7, 0x83, 0x9C, 0xFF, 0x75, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xF2, 0xCD, 0xF6, 0xFF,
+    0xFF, 0xFF, 0x31, 0xBE, 0x52, 0xB5, 0x52, 0xCD, 0xFF, 0xFF, 0x53, 0x9C, 0xD2, 0x83, 0x91, 0x5A, 0xFF, 0xFF, 0x55, 0x73, 0x96, 0x9C, 0x8E, 0x5A, 0xB6, 0x7B, 0xAE, 0x5A, 0x10, 0x63, 0x31, 0x6B, 0xBF, 0x4B, 0x0D, 0x4A, 0xCF, 0x62, 0x10, 0x4A, 0xBF, 0x8E, 0x59, 0x31, 0x0D, 0x4A, 0x0C, 0x4A, 0x0C, 0x4A, 0x31, 0x6B, 0xF7, 0x62, 0xEC, 0x41, 0xF5, 0x62, 0xEF, 0x41, 0xF0, 0x41, 0x3E, 0xE7,
+    0x7C, 0x4A, 0x1F, 0xBE, 0x96, 0x73, 0x8F, 0x52, 0xD3, 0x83, 0x98, 0xDE, 0x11, 0x84, 0xD3, 0x73, 0x0F, 0x95, 0xFE, 0xFF, 0x2E, 0xA5, 0x2E, 0x84, 0x50, 0xAD, 0xFF, 0xFF, 0x4F, 0x94, 0xEF, 0x83, 0x5A, 0x8C, 0x1F, 0x5C, 0xD2, 0x52, 0x8B, 0x52, 0x2F, 0x63, 0xB4, 0x73, 0xCB, 0x5A, 0x6A, 0x4A, 0x6A, 0x4A, 0x8B, 0x52, 0xCC, 0x5A, 0xAC, 0x52, 0xAC, 0x52, 0xCE, 0x5A, 0xD3, 0x52, 0xCE, 0x52,
+    0xCE, 0x7B, 0x4B, 0x4A, 0x8C, 0x5A, 0x4B, 0x52, 0x12, 0xAD, 0x8E, 0x73, 0xEE, 0x62, 0x1A, 0xBE, 0xAE, 0x5A, 0xB5, 0xC5, 0x39, 0xEF, 0xB3, 0xBD, 0x6F, 0xA4, 0xB1, 0xA4, 0x52, 0xBD, 0x13, 0xCE, 0xEE, 0xAC, 0x6F, 0x94, 0xF1, 0xA4, 0x50, 0x9C, 0x15, 0xD6, 0xB1, 0x93, 0x90, 0x73, 0xCF, 0x62, 0xB0, 0x62, 0xD7, 0xC5, 0xB3, 0x94, 0x6D, 0x52, 0x0B, 0x4A, 0x72, 0x73, 0x4F, 0x73, 0x78, 0xB5,
+    0xB1, 0x7B, 0x71, 0x73, 0xD3, 0x7B, 0x30, 0x6B, 0x58, 0xAD, 0x90, 0x62, 0x2C, 0x4A, 0x0B, 0x4A, 0x0C, 0x52, 0x56, 0xAD, 0x2F, 0x6B, 0x8E, 0x52, 0xD1, 0x62, 0x33, 0x6B, 0xD8, 0x94, 0x95, 0x73, 0xD8, 0x5A, 0x76, 0x6B, 0x15, 0x84, 0x59, 0xAD, 0x2F, 0x6B, 0xD1, 0x7B, 0x6F, 0x6B, 0x11, 0x84, 0xB8, 0xBD, 0xD2, 0xBD, 0x90, 0x94, 0x70, 0x8C, 0x2F, 0x8C, 0x11, 0xB5, 0x52, 0xBD, 0xAD, 0x73,
+    0x11, 0x8C, 0x73, 0x8C, 0xEC, 0x62, 0x74, 0xB5, 0x10, 0x84, 0x6D, 0x6B, 0xAF, 0x73, 0x6D, 0x6B, 0x33, 0xA5, 0x91, 0x94, 0xCB, 0x52, 0xCC, 0x52, 0x4E, 0x6B, 0x13, 0x9D, 0x8A, 0x4A, 0x2D, 0x63, 0x29, 0x4A, 0x32, 0x8C, 0xAC, 0x5A, 0x94, 0x94, 0xB4, 0x9C, 0xED, 0x62, 0x36, 0xAD, 0xEF, 0x62, 0xFB, 0xC5, 0x4D, 0x73, 0x6E, 0x94, 0x90, 0xBD, 0x2D, 0x94, 0x8E, 0x9C, 0xEF, 0xB4, 0xD1, 0xCD,
+    0x52, 0xD6, 0xD5, 0xE6, 0x4F, 0x9C, 0x6E, 0xA4, 0x33, 0xBD, 0xD7, 0xEE, 0xB7, 0xBD, 0x72, 0x7B, 0x90, 0x5A, 0x13, 0xA5, 0x37, 0xAD, 0xD2, 0x83, 0xAD, 0x52, 0xAD, 0x5A, 0x1B, 0xE7, 0xF6, 0xC5, 0xD1, 0x8B, 0xEE, 0x6A, 0xCE, 0x6A, 0x35, 0xBD, 0x78, 0xDE, 0x4F, 0x7B, 0x6C, 0x52, 0x2C, 0x4A, 0x2C, 0x4A, 0x38, 0xAD, 0x53, 0x8C, 0x2D, 0x4A, 0x15, 0x84, 0xF0, 0x41, 0xBA, 0x73, 0xD0, 0x5A,
+    0x15, 0x63, 0x14, 0x63, 0xBB, 0x94, 0xF0, 0x5A, 0xAE, 0x5A, 0x53, 0x94, 0x11, 0x8C, 0x7A, 0xCE, 0x8D, 0x73, 0xB0, 0x9C, 0x8C, 0x94, 0x6E, 0x94, 0x94, 0xDE, 0x0D, 0x8C, 0x2C, 0x8C, 0x4D, 0x94, 0x36, 0xE7, 0xAE, 0x83, 0x6C, 0x52, 0xED, 0x5A, 0x0C, 0x63, 0x53, 0xA5, 0xAA, 0x52, 0x6A, 0x52, 0x8A, 0x52, 0xAD, 0x52, 0x31, 0x84, 0x6A, 0x4A, 0xAB, 0x52, 0xCC, 0x5A, 0xCC, 0x5A, 0x90, 0x6B,
+    0x2C, 0x4A, 0xD3, 0x39, 0x2D, 0x4A, 0x4A, 0x4A, 0x6C, 0x52, 0xD8, 0x9C, 0xF8, 0x41, 0xF4, 0x62, 0xAD, 0x62, 0x18, 0xF7, 0xD4, 0xC5, 0x51, 0xC5, 0x10, 0xAD, 0x70, 0xCD, 0xF6, 0xFF, 0x92, 0xFF, 0xAD, 0xB4, 0x2D, 0x94, 0xF8, 0xFF, 0xFE, 0xFF, 0x50, 0xD5, 0xB2, 0xA4, 0x14, 0x8C, 0x1F, 0xB6, 0x1A, 0x63, 0xD2, 0x83, 0xEF, 0x62, 0x3C, 0x9D, 0x9B, 0x7B, 0xEE, 0x62, 0x4F, 0x73, 0x12, 0x9C,
+    0x5E, 0xF7, 0x4F, 0x73, 0x71, 0x73, 0xB0, 0x8B, 0x9A, 0xFF, 0x11, 0xCD, 0x8D, 0x5A, 0x0C, 0x4A, 0x32, 0x52, 0x7F, 0x5B, 0x33, 0x8C, 0x2C, 0x4A, 0x78, 0x94, 0xFE, 0x94, 0x0E, 0x42, 0xB0, 0x52, 0xB8, 0x52, 0x9E, 0x86, 0x9B, 0x4A, 0x6F, 0x52, 0x70, 0x73, 0xFF, 0xFF, 0xDA, 0xEE, 0xDE, 0xFF, 0xAD, 0x83, 0xD0, 0xDD, 0xFF, 0xFF, 0xCD, 0xA4, 0x0C, 0x8C, 0x8D, 0xA4, 0xFF, 0xFF, 0x4F, 0xC5,
+    0x4D, 0x9C, 0xAE, 0x7B, 0x5D, 0x2A, 0xDC, 0x52, 0x34, 0xAD, 0x71, 0x94, 0xED, 0x5A, 0xCC, 0x5A, 0x32, 0x7C, 0x6A, 0x52, 0x8A, 0x4A, 0xEC, 0x5A, 0x4D, 0x6B, 0x90, 0x6B, 0xCC, 0x52, 0x0D, 0x5B, 0x2B, 0x4A, 0x59, 0x31, 0x72, 0x52, 0x8D, 0x5A, 0xCB, 0x62, 0x6E, 0x5A, 0xB9, 0x41, 0xBD, 0x9C, 0x74, 0x8C, 0xAE, 0x7B, 0x6F, 0x9C, 0x14, 0xD6, 0xFA, 0xF7, 0x97, 0xDE, 0x12, 0xEE, 0xF9, 0xFF,
+    0x53, 0xD6, 0xF0, 0xAC, 0x8E, 0xAC, 0x32, 0xF6, 0x54, 0xDE, 0x53, 0xBD, 0xF1, 0x8B, 0x5B, 0x8C, 0xFE, 0xBD, 0xD7, 0xB4, 0xAD, 0x62, 0x8E, 0x5A, 0x9B, 0xC5, 0xD7, 0xA4, 0x90, 0x7B, 0x55, 0xB5, 0x56, 0xE6, 0x92, 0xA4, 0xF2, 0x8B, 0x59, 0x9C, 0x35, 0xCD, 0x91, 0xBC, 0x8D, 0x5A, 0x0C, 0x4A, 0xB9, 0x9C, 0x1A, 0x84, 0xF8, 0xA4, 0x4D, 0x4A, 0x3D, 0xE7, 0x6F, 0x4A, 0x2E, 0x4A, 0xB0, 0x62,
+    0x9D, 0x73, 0xBB, 0x5A, 0x97, 0x7B, 0x36, 0x8C, 0x58, 0xAD, 0x54, 0xA5, 0xEF, 0x8B, 0x57, 0xAD, 0xD6, 0xBD, 0x33, 0xBE, 0x0E, 0xCE, 0x6C, 0x94, 0x11, 0xA5, 0x92, 0xAD, 0xCC, 0xB4, 0xAA, 0x83, 0x0E, 0x84, 0xD0, 0x73, 0xAF, 0x52, 0x37, 0xA5, 0xF0, 0x7B, 0x2E, 0x63, 0xAA, 0x52, 0x69, 0x4A, 0x8A, 0x52, 0x2C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xEC, 0x5A, 0x0D, 0x63, 0x0D, 0x5B,
+    0xC8, 0x41, 0x09, 0x42, 0x2A, 0x52, 0xE9, 0x49, 0x6A, 0x52, 0x6A, 0x52, 0x8B, 0x52, 0x35, 0xB5, 0xAB, 0x62, 0x2C, 0x73, 0x10, 0x8C, 0xCD, 0x8B, 0x4F, 0x9C, 0x8E, 0x9C, 0xF3, 0xD5, 0xEE, 0xB4, 0x6D, 0x9C, 0x4E, 0x9C, 0xAF, 0xA4, 0xF1, 0xB4, 0xED, 0x93, 0x51, 0x94, 0x52, 0x94, 0x52, 0x73, 0xD6, 0x9C, 0xD5, 0xA4, 0x70, 0x7B, 0x2D, 0x6B, 0xF7, 0xA4, 0x11, 0x84, 0x93, 0x9C, 0xAB, 0x62,
+    0x31, 0x8C, 0xD0, 0x83, 0x0D, 0x6B, 0x53, 0xB5, 0xD4, 0xA4, 0x0D, 0x6B, 0x8D, 0x5A, 0x6C, 0x5A, 0x2C, 0x4A, 0xCB, 0x41, 0x92, 0x9C, 0x2C, 0x4A, 0x34, 0x84, 0x6E, 0x52, 0x4E, 0x4A, 0x2E, 0x4A, 0x95, 0x7B, 0x0F, 0x42, 0xD2, 0x62, 0x31, 0x6B, 0xEE, 0x62, 0x92, 0x94, 0x4E, 0x73, 0x98, 0xB5, 0x6C, 0x7B, 0xB0, 0xA4, 0x6E, 0x94, 0x8E, 0x9C, 0xEC, 0x8B, 0xEC, 0x83, 0x2E, 0x8C, 0xCD, 0x83,
+    0x8B, 0x73, 0x0B, 0x63, 0xAB, 0x5A, 0xD3, 0x9C, 0x6D, 0x73, 0x4B, 0x6B, 0xEB, 0x62, 0xEB, 0x5A, 0x69, 0x4A, 0x0C, 0x63, 0xCB, 0x5A, 0xAB, 0x52, 0xCB, 0x5A, 0x0C, 0x5B, 0xCC, 0x5A, 0x0C, 0x5B, 0xE8, 0x41, 0x09, 0x4A, 0x4A, 0x4A, 0x09, 0x4A, 0xD3, 0xCD, 0xE8, 0x41, 0xEB, 0x62, 0xD2, 0xA4, 0xAA, 0x62, 0x6D, 0x7B, 0x79, 0xF7, 0x6C, 0x7B, 0x8B, 0x83, 0x4D, 0x9C, 0x71, 0xC5, 0xD5, 0xEE,
+    0x2D, 0x9C, 0x4D, 0x9C, 0x8E, 0xAC, 0x2E, 0xA4, 0xD3, 0xCD, 0xAE, 0x83, 0x2E, 0x73, 0x2F, 0x6B, 0x94, 0x94, 0xB1, 0x83, 0xCE, 0x6A, 0xB0, 0x83, 0xB2, 0x9C, 0x52, 0x94, 0x91, 0x9C, 0xBE, 0xFF, 0x51, 0x9C, 0x2D, 0x73, 0x4D, 0x83, 0x12, 0xAD, 0x98, 0xE6, 0x4E, 0x73, 0xCD, 0x62, 0x6C, 0x5A, 0x6D, 0x52, 0xD8, 0xC5, 0x11, 0x8C, 0x4C, 0x4A, 0x1B, 0xCE, 0x2E, 0x4A, 0xBA, 0xBD, 0x4E, 0x52,
+    0x12, 0x63, 0x11, 0x4A, 0xFA, 0xA4, 0xBB, 0xBD, 0x0E, 0x6B, 0x51, 0x94, 0xEF, 0x8B, 0x76, 0xBD, 0x5F, 0xF7, 0x52, 0xB5, 0x4F, 0xB5, 0x4D, 0xBD, 0x6C, 0x9C, 0x10, 0xB5, 0x15, 0xD6, 0xAB, 0x7B, 0x2C, 0x8C, 0x2A, 0x6B, 0x0E, 0x8C, 0xB3, 0xC5, 0xEB, 0x62, 0x2C, 0x6B, 0xA9, 0x62, 0xEB, 0x62, 0x52, 0xAD, 0x2C, 0x6B, 0xAA, 0x52, 0xED, 0x5A, 0xEB, 0x5A, 0x32, 0xA5, 0x4D, 0x6B, 0xEC, 0x5A,
+    0x08, 0x4A, 0xB2, 0x9C, 0x08, 0x42, 0xF4, 0xA4, 0x69, 0x5A, 0xCE, 0x6A, 0xB3, 0xC5, 0x0E, 0x8C, 0x56, 0xDE, 0x12, 0xAC, 0xF3, 0xB4, 0x54, 0xDE, 0xEB, 0x8B, 0xF9, 0xFF, 0xF9, 0xFF, 0xAC, 0xBC, 0xB3, 0xE6, 0xF8, 0xFF, 0xF4, 0xFF, 0xAD, 0xDD, 0x2D, 0x9C, 0xD2, 0xC5, 0x9E, 0xCE, 0x5C, 0x62, 0xB6, 0x9C, 0x4F, 0x73, 0x99, 0xD6, 0xFA, 0xCD, 0xD3, 0xA4, 0xAF, 0x83, 0x70, 0x9C, 0x14, 0xDE,
+    0xB1, 0xF5, 0x4C, 0x7B, 0xEB, 0x62, 0xF5, 0xEE, 0xD8, 0xFF, 0x4D, 0x94, 0xAB, 0x62, 0xAC, 0x62, 0xF3, 0xAC, 0xD5, 0xD5, 0x72, 0xA4, 0x4C, 0x52, 0xF6, 0x83, 0x3D, 0x53, 0x5B, 0x73, 0x4E, 0x52, 0xF4, 0x5A, 0x3F, 0x85, 0x7F, 0x9D, 0xB2, 0x5A, 0xEF, 0x6A, 0xB1, 0xB4, 0xFF, 0xFF, 0x37, 0xDE, 0xED, 0x8B, 0x6D, 0x9C, 0xF4, 0xFF, 0xFF, 0xFF, 0x70, 0xD6, 0xCB, 0x83, 0x4E, 0x9D, 0xFF, 0xFF,
+    0x36, 0xF7, 0xB4, 0xDE, 0xCA, 0x5A, 0x3E, 0x53, 0x39, 0x9C, 0xF3, 0x9C, 0x69, 0x4A, 0xAA, 0x5A, 0xB0, 0x73, 0xB1, 0x8C, 0x30, 0x84, 0xAA, 0x52, 0x8A, 0x52, 0x0C, 0x5B, 0x0C, 0x5B, 0x8E, 0x6B, 0x07, 0x42, 0x49, 0x52, 0x28, 0x42, 0x8A, 0x5A, 0x69, 0x52, 0xD1, 0xAC, 0x92, 0xBD, 0x90, 0x94, 0x70, 0x9C, 0x92, 0xB4, 0x18, 0xD6, 0x50, 0xAD, 0xF0, 0xA4, 0x2B, 0xAD, 0x8F, 0xEE, 0x52, 0xDE,
+    0x4F, 0xB5, 0xEE, 0xBC, 0x51, 0xFF, 0x8F, 0xEE, 0xF1, 0xB4, 0x2E, 0x94, 0xF2, 0x6A, 0x1A, 0x4A, 0xD6, 0x9C, 0x6E, 0x7B, 0x2D, 0x73, 0x56, 0xBD, 0xB7, 0xBD, 0x54, 0xB5, 0xB4, 0xAC, 0x8C, 0x8B, 0xF3, 0xDD, 0x0A, 0x6B, 0x2C, 0x73, 0xB5, 0xC5, 0xF7, 0xFF, 0xF3, 0xE6, 0xAB, 0x5A, 0xCC, 0x62, 0xCC, 0x6A, 0x31, 0x94, 0xDA, 0xDE, 0x4D, 0x52, 0x5A, 0xAD, 0xBD, 0x52, 0x12, 0x4A, 0x6E, 0x5A,
+    0x35, 0x73, 0x39, 0x63, 0x7B, 0x9C, 0x35, 0x94, 0xF5, 0xA4, 0xB2, 0xA4, 0xD0, 0xE5, 0x7A, 0xF7, 0xD2, 0xA4, 0x52, 0xB5, 0x6D, 0xC5, 0x8C, 0xCD, 0x10, 0xB5, 0x10, 0xA5, 0xCB, 0x83, 0xCD, 0x9C, 0x72, 0xB5, 0x8F, 0x94, 0x6C, 0x73, 0x6E, 0x73, 0x6D, 0x7B, 0xEE, 0x7B, 0x68, 0x52, 0x69, 0x52, 0xAE, 0x7B, 0xEA, 0x62, 0xEB, 0x5A, 0xAA, 0x52, 0xAA, 0x5A, 0xCB, 0x5A, 0xEB, 0x5A, 0xEC, 0x5A,
+    0x08, 0x42, 0x69, 0x52, 0x8A, 0x52, 0x06, 0x4A, 0x89, 0x52, 0x30, 0x94, 0xCA, 0x6A, 0x0B, 0x6B, 0x74, 0xBD, 0x0A, 0x73, 0x4F, 0x9C, 0x10, 0xAD, 0xEC, 0x8B, 0xEF, 0xAC, 0xCA, 0x8B, 0xCE, 0xAC, 0x4D, 0x9C, 0xEC, 0x93, 0x4C, 0x9C, 0x8E, 0xAC, 0xED, 0x8B, 0x0F, 0x94, 0x10, 0x94, 0x93, 0x9C, 0xD2, 0xA4, 0x0C, 0x6B, 0x37, 0xCE, 0xAE, 0x83, 0x4C, 0x73, 0xEC, 0x6A, 0x91, 0x9C, 0xEB, 0x6A,
+    0x2F, 0x94, 0x4D, 0x73, 0xAF, 0x83, 0xD3, 0xC5, 0x0F, 0x8C, 0xAE, 0x83, 0xCC, 0x62, 0xAC, 0x5A, 0x4B, 0x52, 0xAB, 0x5A, 0xB5, 0xBD, 0xCE, 0x62, 0x97, 0xBD, 0xCF, 0x62, 0x6E, 0x52, 0xCE, 0x5A, 0x6E, 0x52, 0x2E, 0x52, 0x95, 0x9C, 0x33, 0x8C, 0x0D, 0x63, 0x6D, 0x7B, 0xCE, 0x8B, 0x32, 0xAD, 0xD0, 0xA4, 0x2D, 0x94, 0x4D, 0x9C, 0x0C, 0x94, 0xEF, 0xAC, 0x0C, 0x84, 0x6A, 0x73, 0x8B, 0x7B,
+    0xD0, 0xA4, 0xCC, 0x83, 0xAD, 0x7B, 0xA9, 0x5A, 0x2B, 0x6B, 0xCD, 0x83, 0xAA, 0x5A, 0xAA, 0x5A, 0x50, 0x8C, 0x8C, 0x73, 0xAA, 0x52, 0xAA, 0x52, 0x0B, 0x63, 0xCA, 0x52, 0x4C, 0x6B, 0x0C, 0x63, 0xA7, 0x39, 0xC7, 0x41, 0x8D, 0x73, 0x8C, 0x73, 0x28, 0x4A, 0xD1, 0xA4, 0xED, 0x8B, 0xCB, 0x6A, 0x0B, 0x73, 0x2B, 0x73, 0x2E, 0x94, 0x93, 0xC5, 0x0C, 0x94, 0x6D, 0x9C, 0x6C, 0x9C, 0xCB, 0x8B,
+    0x0B, 0x94, 0x4C, 0x9C, 0x2C, 0x94, 0xEC, 0x8B, 0x8C, 0x83, 0xEE, 0x8B, 0xD2, 0xA4, 0x8E, 0x7B, 0x8E, 0x7B, 0x2C, 0x73, 0x90, 0x9C, 0x4F, 0x94, 0x4C, 0x73, 0x4D, 0x73, 0x0F, 0x8C, 0xCB, 0x62, 0x4C, 0x73, 0x8A, 0x5A, 0xCC, 0x62, 0xB0, 0xA4, 0x91, 0x94, 0xEC, 0x6A, 0xAB, 0x62, 0x6B, 0x5A, 0xAC, 0x5A, 0x8B, 0x52, 0xF3, 0xA4, 0x8C, 0x5A, 0x33, 0x8C, 0xEE, 0x62, 0x6D, 0x52, 0xEE, 0x62,
+    0x8E, 0x5A, 0xB0, 0x62, 0xF3, 0x8B, 0xF1, 0x83, 0x0D, 0x6B, 0x2C, 0x73, 0x2E, 0x94, 0x6E, 0x9C, 0x6E, 0x9C, 0xAB, 0x83, 0xEB, 0x8B, 0xCD, 0xAC, 0x4C, 0x9C, 0xCB, 0x83, 0x6A, 0x73, 0x4A, 0x73, 0xAC, 0x83, 0x0E, 0x8C, 0x6F, 0x94, 0x0A, 0x63, 0xC9, 0x62, 0xCE, 0x83, 0xA9, 0x5A, 0x4C, 0x6B, 0x6C, 0x6B, 0xCD, 0x7B, 0x89, 0x52, 0xAA, 0x52, 0x6D, 0x6B, 0xAA, 0x52, 0x6D, 0x6B, 0xCA, 0x52,
+    0x07, 0x42, 0xEB, 0x62, 0xAE, 0x7B, 0x94, 0xBD, 0x27, 0x4A, 0x88, 0x5A, 0x50, 0x9C, 0xCD, 0x6A, 0x33, 0x9C, 0x2C, 0x73, 0x0D, 0x94, 0xCE, 0xAC, 0xEB, 0xBC, 0x6C, 0xC5, 0xF0, 0xD5, 0x2B, 0x9C, 0x4B, 0x9C, 0x2F, 0xE7, 0x0F, 0xD6, 0x0C, 0x94, 0x6C, 0x7B, 0x0E, 0x94, 0x35, 0xBD, 0x11, 0x8C, 0xEF, 0x8B, 0x4D, 0x7B, 0x0D, 0x94, 0x2D, 0xB5, 0x6F, 0x9C, 0x2D, 0x73, 0x0E, 0x8C, 0xAD, 0x83,
+    0xCD, 0x83, 0x2B, 0x73, 0x6A, 0x52, 0xD0, 0xA4, 0x11, 0xAD, 0x0C, 0x6B, 0x8B, 0x5A, 0x8B, 0x5A, 0x6A, 0x5A, 0x13, 0xA5, 0xB4, 0xB5, 0x8C, 0x5A, 0xD4, 0xA4, 0x51, 0x73, 0x8E, 0x5A, 0x8D, 0x5A, 0xAE, 0x5A, 0x90, 0x5A, 0x77, 0x7B, 0xF3, 0x83, 0x6F, 0x7B, 0x8D, 0x7B, 0x4E, 0xBD, 0x93, 0xFF, 0x4D, 0x9C, 0xCB, 0x83, 0x4B, 0x9C, 0xAF, 0xFE, 0x8D, 0xEE, 0x0A, 0x9C, 0xB6, 0xE6, 0xCC, 0x83,
+    0xB7, 0xCD, 0x74, 0xBD, 0x4E, 0x94, 0xD3, 0xCD, 0xC9, 0x62, 0xEC, 0x62, 0xDA, 0xBD, 0xEB, 0x62, 0x37, 0xCE, 0xCA, 0x62, 0x89, 0x52, 0x92, 0x8C, 0x4C, 0x6B, 0xD7, 0x9C, 0xAA, 0x52, 0xEB, 0x5A, 0x3A, 0xEF, 0x74, 0xBD, 0xD3, 0x9C, 0xB0, 0xA4, 0x15, 0xC6, 0x55, 0xDE, 0xAF, 0x83, 0x9B, 0xDE, 0xFF, 0xFF, 0x17, 0xD6, 0xD6, 0xEE, 0xAC, 0xA4, 0xF0, 0xEE, 0xFF, 0xFF, 0x4F, 0xD6, 0x77, 0xFF,
+    0xB3, 0xDE, 0xF9, 0xFF, 0xFE, 0xFF, 0x13, 0xC6, 0xEC, 0x8B, 0x2E, 0x8C, 0xFF, 0xFF, 0x19, 0xC6, 0xF3, 0xA4, 0xF2, 0xA4, 0x10, 0xBD, 0xFF, 0xFF, 0x52, 0xBD, 0xCD, 0x83, 0x8B, 0x83, 0xFD, 0xFF, 0xDB, 0xF7, 0x2F, 0x8C, 0x0B, 0x6B, 0x77, 0xF7, 0xF9, 0xE6, 0x2B, 0x73, 0xAB, 0x62, 0x6A, 0x5A, 0x91, 0xA4, 0x9B, 0xFF, 0xDC, 0xFF, 0x0E, 0x6B, 0x18, 0xC6, 0x1D, 0xA5, 0x73, 0x9C, 0xCD, 0x6A,
+    0xB5, 0x9C, 0x9B, 0x94, 0xFF, 0xFF, 0x3E, 0x94, 0x51, 0x94, 0xB1, 0x94, 0xF8, 0xDE, 0xD9, 0xFF, 0xCF, 0xAC, 0x90, 0x9C, 0xB1, 0xC5, 0xF6, 0xFF, 0xF6, 0xFF, 0x0F, 0xAD, 0xD0, 0x9C, 0xB3, 0xB5, 0x12, 0x9C, 0x10, 0xA5, 0xD1, 0xA4, 0x12, 0x9D, 0xC9, 0x62, 0x4F, 0x6B, 0xAE, 0x73, 0x89, 0x5A, 0xEA, 0x62, 0x0A, 0x6B, 0xCA, 0x5A, 0xCA, 0x5A, 0x0F, 0x84, 0x0B, 0x63, 0x6C, 0x6B, 0xEB, 0x5A,
+    0x2C, 0x6B, 0x48, 0x52, 0x07, 0x42, 0x48, 0x52, 0x08, 0x4A, 0x50, 0x94, 0x89, 0x5A, 0x30, 0x94, 0xB5, 0xCD, 0x68, 0x5A, 0x2A, 0x73, 0x49, 0x7B, 0xAC, 0xAC, 0x6A, 0x9C, 0x4B, 0x9C, 0xEB, 0x8B, 0xEB, 0x8B, 0x4C, 0xA4, 0xEB, 0x93, 0x6D, 0x9C, 0x8F, 0x9C, 0xCE, 0x8B, 0xD1, 0xA4, 0xEF, 0x8B, 0x0F, 0x94, 0x0F, 0x94, 0xCB, 0x83, 0xAD, 0x8B, 0xED, 0x8B, 0xEB, 0x6A, 0x8D, 0x7B, 0x0F, 0x8C,
+    0x8D, 0x7B, 0x34, 0xAD, 0xCC, 0x62, 0x4D, 0x8C, 0xB1, 0x9C, 0xAC, 0x62, 0xAC, 0x62, 0x6B, 0x5A, 0xAA, 0x5A, 0xCE, 0x83, 0x94, 0xB5, 0x8B, 0x5A, 0xD4, 0xA4, 0xED, 0x6A, 0x6E, 0x73, 0xAC, 0x62, 0x8C, 0x5A, 0xAE, 0x62, 0x51, 0x6B, 0x52, 0x94, 0xAE, 0x83, 0xAD, 0x83, 0xAC, 0x83, 0x6E, 0x9C, 0x0C, 0x8C, 0xEC, 0x83, 0xEA, 0x8B, 0x4D, 0xBD, 0x4A, 0x9C, 0x0B, 0x94, 0x6A, 0x73, 0x4A, 0x73,
+    0x4A, 0x73, 0xB0, 0x9C, 0x8B, 0x7B, 0xEA, 0x62, 0xA8, 0x5A, 0x68, 0x52, 0x89, 0x5A, 0xCA, 0x62, 0x89, 0x52, 0x88, 0x52, 0x68, 0x52, 0x89, 0x52, 0x69, 0x52, 0xAA, 0x52, 0x89, 0x4A, 0xCA, 0x5A, 0xC7, 0x41, 0xE7, 0x41, 0xC7, 0x39, 0x08, 0x4A, 0x28, 0x4A, 0x6C, 0x73, 0x89, 0x5A, 0xEB, 0x6A, 0x6C, 0x73, 0x88, 0x5A, 0xE9, 0x6A, 0x2A, 0x73, 0x30, 0xB5, 0x2D, 0x94, 0xEC, 0x8B, 0x8A, 0x7B,
+    0x6E, 0x9C, 0xCB, 0x8B, 0xCB, 0x8B, 0x10, 0xB5, 0xF0, 0xAC, 0xCD, 0x8B, 0xAD, 0x83, 0x4B, 0x7B, 0xCE, 0x8B, 0xAD, 0x83, 0x2E, 0x94, 0x4C, 0x73, 0x4C, 0x7B, 0x6D, 0x7B, 0x51, 0x94, 0x8E, 0x7B, 0xCC, 0x62, 0x52, 0x94, 0xED, 0x62, 0x6D, 0x73, 0x8E, 0x7B, 0x8C, 0x5A, 0x4A, 0x52, 0x6B, 0x52, 0x6B, 0x5A, 0x6E, 0x7B, 0x13, 0xA5, 0xEC, 0x62, 0x72, 0x9C, 0x2E, 0x73, 0x8E, 0x7B, 0xEC, 0x6A,
+    0x6B, 0x5A, 0x2D, 0x73, 0x8F, 0x7B, 0xCF, 0x83, 0xEF, 0x8B, 0x4B, 0x7B, 0x4A, 0x73, 0xEC, 0x8B, 0xAF, 0xA4, 0x8A, 0x7B, 0xCB, 0x8B, 0xAD, 0xA4, 0xA9, 0x83, 0x8A, 0x83, 0x29, 0x73, 0x29, 0x73, 0x2A, 0x73, 0x6F, 0x9C, 0x2A, 0x6B, 0xC9, 0x62, 0x88, 0x5A, 0x88, 0x5A, 0x68, 0x52, 0x88, 0x52, 0x68, 0x52, 0x88, 0x52, 0x69, 0x52, 0x89, 0x52, 0x89, 0x52, 0x89, 0x52, 0x89, 0x52, 0xCA, 0x5A,
+    0xA6, 0x39, 0x48, 0x52, 0xC7, 0x39, 0x07, 0x4A, 0x28, 0x4A, 0x89, 0x5A, 0x69, 0x5A, 0x6E, 0x7B, 0xCB, 0x6A, 0x93, 0xC5, 0xEA, 0x6A, 0xEA, 0x72, 0xAE, 0xA4, 0xAE, 0xAC, 0x8A, 0x83, 0x8A, 0x7B, 0xAA, 0x83, 0x0B, 0x94, 0x0A, 0x94, 0xD4, 0xEE, 0x51, 0xBD, 0x2E, 0x94, 0x8C, 0x83, 0x2D, 0x94, 0x4B, 0x7B, 0x2A, 0x73, 0x92, 0xBD, 0xED, 0x8B, 0xAC, 0x83, 0x10, 0x8C, 0x38, 0xCE, 0x6F, 0x7B,
+    0x4D, 0x5A, 0xF5, 0xAC, 0x15, 0xAD, 0x0D, 0x6B, 0xB3, 0x9C, 0xAD, 0x5A, 0x4B, 0x52, 0x6B, 0x52, 0xCB, 0x62, 0x71, 0x94, 0x32, 0xAD, 0x8B, 0x5A, 0x14, 0xAD, 0xCD, 0x83, 0x4C, 0x73, 0xEC, 0x6A, 0x6A, 0x5A, 0x0C, 0x73, 0x2E, 0x73, 0x6D, 0x7B, 0x33, 0xB5, 0x8C, 0x83, 0x8D, 0x9C, 0x6B, 0x9C, 0xAE, 0xA4, 0xCB, 0x8B, 0xC9, 0x83, 0x0D, 0xB5, 0xEC, 0xB4, 0xAA, 0x83, 0x29, 0x73, 0x2A, 0x73,
+    0xEB, 0x6A, 0xAD, 0x83, 0x2A, 0x6B, 0xA9, 0x62, 0x67, 0x52, 0x68, 0x52, 0x69, 0x5A, 0x67, 0x52, 0x89, 0x5A, 0x89, 0x5A, 0x89, 0x52, 0x69, 0x52, 0x68, 0x52, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x52, 0xA7, 0x39, 0x08, 0x4A, 0xE7, 0x41, 0x29, 0x52, 0x07, 0x4A, 0x8A, 0x5A, 0x49, 0x52, 0x0E, 0x73, 0x5C, 0xA5, 0x98, 0xDE, 0xAE, 0x83, 0x2F, 0x94, 0x4D, 0xC5, 0x96, 0xF7, 0xCC, 0xC4, 0x0C, 0x94,
+    0x8C, 0xA4, 0xB1, 0xF7, 0xF5, 0xFF, 0xB2, 0xE6, 0xD3, 0xCD, 0x95, 0xE6, 0x92, 0xFE, 0xD9, 0xFF, 0x4E, 0x94, 0x2F, 0x94, 0xD9, 0xFF, 0xFF, 0xFF, 0xD0, 0xAC, 0x11, 0x8C, 0xD0, 0x8B, 0x38, 0x94, 0xDF, 0x73, 0x92, 0x7B, 0xB2, 0x83, 0x18, 0xAD, 0x99, 0xA5, 0xB1, 0x83, 0x6C, 0x5A, 0xAC, 0x62, 0x8E, 0x93, 0xFD, 0xFF, 0xFC, 0xFF, 0x4E, 0x7B, 0x7A, 0xF7, 0xFB, 0xFF, 0xF0, 0xC4, 0xD0, 0x8B,
+    0x8E, 0x7B, 0x55, 0xA4, 0xFF, 0xFF, 0xEF, 0x8B, 0x90, 0x9C, 0xF1, 0xAC, 0xF9, 0xFF, 0xFE, 0xFF, 0x56, 0xD6, 0x30, 0xB5, 0x8E, 0xBD, 0xFB, 0xFF, 0xF8, 0xFF, 0xEE, 0xAC, 0x6F, 0x9C, 0xD4, 0x9C, 0xFF, 0xFF, 0x1C, 0xCE, 0xEE, 0x83, 0x2F, 0x8C, 0x8C, 0x7B, 0x19, 0x84, 0xF3, 0xA4, 0x2F, 0x8C, 0xAE, 0x7B, 0x0F, 0x84, 0xCA, 0x5A, 0xEF, 0x7B, 0xAA, 0x52, 0x0F, 0x84, 0x89, 0x52, 0x0B, 0x63,
+    0xB4, 0x9C, 0xC8, 0x49, 0xB3, 0x94, 0x08, 0x4A, 0xE6, 0x49, 0x95, 0xBD, 0x4A, 0x52, 0xB7, 0xBD, 0xD2, 0x72, 0x2D, 0x7B, 0x34, 0xDE, 0x8B, 0x8B, 0xAC, 0xC5, 0x2D, 0xE6, 0x0B, 0x9C, 0x76, 0xFF, 0x29, 0xA4, 0x51, 0xE6, 0x12, 0xFF, 0xCD, 0xB4, 0x92, 0xCD, 0x74, 0xE6, 0x6E, 0xCD, 0x73, 0xDE, 0x6C, 0x83, 0x0A, 0x73, 0xF5, 0xCD, 0x2F, 0xCD, 0xAD, 0x8B, 0x4E, 0x7B, 0x2F, 0x73, 0x1C, 0xD6,
+    0x1D, 0x84, 0x11, 0x73, 0x34, 0x94, 0x35, 0x94, 0xDC, 0xC5, 0x6D, 0x52, 0x4B, 0x52, 0x6B, 0x52, 0xEC, 0x72, 0x7A, 0xDE, 0x74, 0xB5, 0xEC, 0x6A, 0x92, 0xA4, 0xCD, 0x8B, 0x79, 0xD6, 0x0B, 0x73, 0xEB, 0x72, 0x0D, 0x73, 0x71, 0x83, 0xBC, 0xFF, 0x8F, 0xA4, 0x0D, 0x94, 0x32, 0xDE, 0x4B, 0xAC, 0xF6, 0xEE, 0xFD, 0xFF, 0xCD, 0xAC, 0x4C, 0xD6, 0xEC, 0xC5, 0xEA, 0x93, 0x4C, 0x9C, 0x4B, 0x7B,
+    0x8E, 0x83, 0xCA, 0x6A, 0x8C, 0x83, 0xC9, 0x62, 0x0A, 0x73, 0x89, 0x5A, 0x88, 0x5A, 0x6C, 0x7B, 0x69, 0x52, 0x89, 0x52, 0xA9, 0x5A, 0x89, 0x52, 0xAA, 0x5A, 0x89, 0x52, 0x89, 0x52, 0x89, 0x52, 0x66, 0x39, 0x8E, 0x7B, 0x87, 0x39, 0xCB, 0x62, 0x50, 0x94, 0xE8, 0x49, 0x49, 0x52, 0xE8, 0x51, 0x6A, 0x62, 0xEB, 0x72, 0xCA, 0x6A, 0x2F, 0x9C, 0x4A, 0x83, 0x4A, 0x83, 0xCF, 0xB4, 0x6A, 0x83,
+    0x2A, 0x7B, 0x8A, 0x8B, 0xAE, 0xAC, 0x6A, 0x83, 0xAC, 0x8B, 0x12, 0xBD, 0xED, 0x9B, 0x8F, 0xA4, 0x2C, 0x7B, 0xCE, 0x8B, 0xCE, 0x8B, 0x6E, 0x7B, 0xCC, 0x6A, 0xAC, 0x62, 0x8C, 0x62, 0x34, 0x94, 0x93, 0x83, 0xAE, 0x5A, 0x10, 0x73, 0xB2, 0x83, 0x53, 0x94, 0x6D, 0x5A, 0x4C, 0x5A, 0x4C, 0x52, 0xAC, 0x62, 0x2D, 0x73, 0x14, 0xAD, 0xAB, 0x62, 0xB3, 0xA4, 0x0C, 0x73, 0xCB, 0x6A, 0xEB, 0x72,
+    0xEC, 0x6A, 0xEB, 0x72, 0xAA, 0x6A, 0x0F, 0x94, 0x4F, 0x9C, 0x8B, 0x83, 0x71, 0xBD, 0x49, 0x7B, 0x6A, 0x83, 0x49, 0x7B, 0x0E, 0xB5, 0x2B, 0x9C, 0x0B, 0x94, 0x69, 0x83, 0x29, 0x73, 0x2A, 0x73, 0xE9, 0x6A, 0x2A, 0x73, 0x88, 0x62, 0x88, 0x62, 0x8C, 0x7B, 0x88, 0x5A, 0x48, 0x52, 0x8C, 0x7B, 0x68, 0x52, 0x68, 0x52, 0x6C, 0x73, 0x48, 0x52, 0x69, 0x52, 0x69, 0x52, 0x8A, 0x52, 0x8A, 0x52,
+    0x86, 0x31, 0x4C, 0x73, 0xA8, 0x41, 0xB3, 0xA4, 0x55, 0xB5, 0x09, 0x4A, 0x29, 0x52, 0xAF, 0x83, 0x4A, 0x5A, 0x69, 0x5A, 0x0B, 0x73, 0xC9, 0x72, 0x2A, 0x7B, 0xAC, 0x93, 0x4B, 0x83, 0x6B, 0x8B, 0x4B, 0x83, 0x4B, 0x83, 0xB0, 0xB4, 0xED, 0x93, 0x8C, 0x8B, 0x52, 0xC5, 0x4F, 0xA4, 0x0E, 0x9C, 0x2C, 0x7B, 0xCF, 0x8B, 0xCB, 0x6A, 0xED, 0x6A, 0x4F, 0x7B, 0xCD, 0x6A, 0x4D, 0x5A, 0x74, 0x9C,
+    0x72, 0x7B, 0x4D, 0x5A, 0x6D, 0x5A, 0x91, 0x7B, 0x10, 0x6B, 0x8E, 0x5A, 0x2C, 0x52, 0x6D, 0x5A, 0xCD, 0x6A, 0xED, 0x6A, 0xF6, 0xD5, 0xED, 0x6A, 0x18, 0xD6, 0x6D, 0x83, 0x2C, 0x7B, 0xEB, 0x72, 0x0C, 0x73, 0x0B, 0x73, 0x0B, 0x7B, 0x4F, 0xA4, 0x2E, 0x9C, 0x8C, 0x8B, 0xB4, 0xD5, 0x6D, 0xA4, 0xAB, 0x8B, 0x6A, 0x83, 0x50, 0xC5, 0xCA, 0x8B, 0x54, 0xDE, 0x8A, 0x83, 0x6A, 0x7B, 0x2A, 0x73,
+    0x0A, 0x73, 0xE9, 0x6A, 0xEA, 0x6A, 0x88, 0x62, 0x6B, 0x7B, 0x88, 0x5A, 0x47, 0x52, 0xC9, 0x62, 0x68, 0x5A, 0x68, 0x52, 0xA9, 0x5A, 0x89, 0x52, 0x68, 0x52, 0x69, 0x52, 0xA9, 0x52, 0x89, 0x52, 0x87, 0x39, 0xE8, 0x49, 0xA7, 0x39, 0xAB, 0x62, 0x0D, 0x73, 0x0A, 0x4A, 0xE9, 0x49, 0x36, 0xB5, 0x4A, 0x5A, 0x2C, 0x7B, 0xC9, 0x6A, 0xAC, 0x93, 0xAB, 0x93, 0xCD, 0x9B, 0x8D, 0x8B, 0x4B, 0x8B,
+    0x2A, 0x8B, 0xAD, 0x9B, 0x93, 0xDD, 0x70, 0xAC, 0xAD, 0x9B, 0x8E, 0xB4, 0xEF, 0xC4, 0xD1, 0xBC, 0x0D, 0x7B, 0xAF, 0x8B, 0x11, 0x9C, 0x2F, 0x7B, 0x6C, 0x5A, 0x71, 0x7B, 0xEC, 0x51, 0xDA, 0xAC, 0xD3, 0x6A, 0xD1, 0x6A, 0x4D, 0x5A, 0x57, 0xBD, 0xD2, 0x62, 0x97, 0x9C, 0x4D, 0x5A, 0x6D, 0x5A, 0xEF, 0x72, 0xB4, 0xAC, 0x9F, 0xFF, 0xCD, 0x72, 0xB6, 0xCD, 0x0F, 0x9C, 0x8C, 0x93, 0x6D, 0x8B,
+    0xF3, 0xBC, 0x0E, 0x94, 0xAB, 0x9B, 0xD1, 0xD5, 0x6E, 0xAC, 0x0D, 0x9C, 0x98, 0xFF, 0x0E, 0xCD, 0xAD, 0xBC, 0xCB, 0x93, 0x90, 0xCD, 0x4B, 0xA4, 0x10, 0xE6, 0x6B, 0xAC, 0x69, 0x83, 0x29, 0x7B, 0xAC, 0x8B, 0x4C, 0x7B, 0x8D, 0x83, 0xCA, 0x6A, 0x0A, 0x6B, 0xCA, 0x62, 0x2B, 0x73, 0x88, 0x5A, 0x69, 0x5A, 0xA9, 0x5A, 0x48, 0x52, 0x89, 0x5A, 0x48, 0x52, 0x89, 0x52, 0x6A, 0x52, 0xAA, 0x52,
+    0xC8, 0x41, 0xC9, 0x41, 0xE9, 0x49, 0xC9, 0x41, 0xAF, 0x7B, 0x0C, 0x4A, 0x16, 0x6B, 0x3C, 0x39, 0xD0, 0x6A, 0xD1, 0xA4, 0x6E, 0xA4, 0x6C, 0xE6, 0xFD, 0xFF, 0xD1, 0xCD, 0x4B, 0x83, 0x2E, 0xB4, 0x8C, 0xFD, 0xFD, 0xFF, 0x11, 0xDE, 0x30, 0xC5, 0x0C, 0xA4, 0xF5, 0xFF, 0xFF, 0xFF, 0x94, 0xE6, 0x2C, 0x7B, 0xD3, 0x8B, 0x38, 0xE5, 0xDF, 0xFF, 0x7B, 0xB5, 0xAE, 0x6A, 0xB4, 0x49, 0xFF, 0xD7,
+    0x1E, 0x84, 0xEE, 0x49, 0xCD, 0x49, 0xBF, 0x83, 0xFF, 0xFF, 0xB5, 0x49, 0x4F, 0x5A, 0x8F, 0x62, 0xF4, 0x9B, 0xFF, 0xFF, 0x15, 0xBD, 0xEE, 0x7A, 0x72, 0xAC, 0xF1, 0xF5, 0xFE, 0xFF, 0xAC, 0x9B, 0x4C, 0x83, 0xEE, 0x9B, 0xFE, 0xFF, 0xFE, 0xFF, 0xCC, 0xA3, 0x4A, 0x8B, 0x34, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x2B, 0xAC, 0xEC, 0xB4, 0xAD, 0xCD, 0xFF, 0xFF, 0xF2, 0xFF, 0xCA, 0x9B, 0x09, 0x7B,
+    0xB3, 0xA4, 0xDF, 0xFF, 0xD8, 0x8B, 0x69, 0x5A, 0x8C, 0x7B, 0xEA, 0x6A, 0x31, 0x94, 0x69, 0x5A, 0x48, 0x52, 0x6D, 0x73, 0x07, 0x4A, 0x8D, 0x73, 0x48, 0x4A, 0x49, 0x52, 0x89, 0x52, 0xAA, 0x52, 0xF4, 0x83, 0x4B, 0x52, 0x69, 0x39, 0xEA, 0x49, 0xEA, 0x49, 0xDA, 0xAC, 0x79, 0x83, 0xFD, 0x28, 0x35, 0x7B, 0x8B, 0x62, 0xF9, 0xFF, 0xCF, 0xE6, 0x2E, 0xEE, 0x6A, 0x9B, 0x90, 0xB4, 0xFA, 0xFF,
+    0xFC, 0xFF, 0xB8, 0xFF, 0x71, 0xDD, 0x6C, 0x93, 0x6C, 0x93, 0xFA, 0xFF, 0xAF, 0xF5, 0x4C, 0x9B, 0xEC, 0x72, 0x0E, 0x7B, 0x7F, 0xFF, 0xB5, 0x9C, 0x31, 0x7B, 0x2D, 0x52, 0x0E, 0x52, 0x5F, 0xAD, 0xB4, 0x62, 0xF3, 0x72, 0x0E, 0x52, 0x35, 0x73, 0x3F, 0xAD, 0x32, 0x52, 0x6F, 0x5A, 0x4E, 0x5A, 0xF0, 0x7A, 0x9F, 0xFF, 0x94, 0xB4, 0xCE, 0x72, 0x97, 0xD5, 0x6E, 0xBC, 0xFD, 0xFF, 0x6C, 0x8B,
+    0x4C, 0x8B, 0x6C, 0x8B, 0xEC, 0xAB, 0xF9, 0xFF, 0x6B, 0x93, 0x8B, 0x93, 0x70, 0xDD, 0x4E, 0xFE, 0xFA, 0xFF, 0x6D, 0xB4, 0x0B, 0xA4, 0xA9, 0x9B, 0x4B, 0xDD, 0x4D, 0xCD, 0x49, 0x8B, 0x0A, 0x7B, 0xCA, 0x6A, 0x2A, 0x5A, 0x8A, 0x62, 0xCE, 0x93, 0xA9, 0x6A, 0x68, 0x5A, 0xAA, 0x62, 0x89, 0x62, 0xCA, 0x62, 0x28, 0x52, 0x48, 0x52, 0x48, 0x52, 0x48, 0x52, 0x49, 0x52, 0x49, 0x52, 0x69, 0x52,
+    0x47, 0x31, 0x88, 0x39, 0x88, 0x39, 0x88, 0x39, 0xA9, 0x41, 0xEB, 0x49, 0xD5, 0x8B, 0x2C, 0x5A, 0xCD, 0x72, 0xAB, 0x62, 0x51, 0xAC, 0xAA, 0x7A, 0x0B, 0x83, 0x4B, 0x8B, 0x4B, 0x8B, 0xCA, 0x7A, 0xCD, 0xAB, 0x70, 0xB4, 0xEF, 0xA3, 0x4C, 0x8B, 0x6E, 0x93, 0x4C, 0x8B, 0x6D, 0x93, 0x8E, 0x8B, 0xAC, 0x72, 0x8C, 0x6A, 0x2F, 0x7B, 0x71, 0x7B, 0x75, 0xA4, 0x0D, 0x52, 0x52, 0x7B, 0x2E, 0x52,
+    0xD0, 0x6A, 0x72, 0x83, 0xB0, 0x6A, 0x32, 0x73, 0x53, 0x7B, 0x90, 0x62, 0x6F, 0x5A, 0x2E, 0x5A, 0x6E, 0x62, 0xCF, 0x6A, 0x16, 0xC5, 0x8D, 0x6A, 0x73, 0xAC, 0xD0, 0x9B, 0xCB, 0x7A, 0x0C, 0x83, 0x4D, 0x83, 0xCF, 0x9B, 0x0B, 0x83, 0xB5, 0xDD, 0x6C, 0x93, 0x2B, 0x83, 0x90, 0xB4, 0x0D, 0xA4, 0x6A, 0x93, 0x4E, 0xAC, 0xCB, 0x9B, 0x49, 0x8B, 0x4C, 0xAC, 0xCB, 0x9B, 0x6A, 0x83, 0xAC, 0x8B,
+    0xE9, 0x72, 0x2B, 0x7B, 0x90, 0xA4, 0x8D, 0x8B, 0x68, 0x62, 0x68, 0x5A, 0x4B, 0x73, 0x68, 0x5A, 0x28, 0x52, 0x48, 0x52, 0x48, 0x52, 0xE6, 0x49, 0x69, 0x52, 0x48, 0x52, 0x69, 0x52, 0x69, 0x52, 0x46, 0x31, 0x67, 0x39, 0x88, 0x39, 0xA8, 0x41, 0xEA, 0x49, 0x91, 0x83, 0x70, 0x8B, 0xEA, 0x51, 0x2A, 0x52, 0x0D, 0x73, 0xEB, 0x72, 0x6A, 0x6A, 0x6E, 0x93, 0x2C, 0x83, 0x2C, 0x83, 0x8D, 0x93,
+    0xAE, 0xA3, 0x70, 0xC4, 0xF2, 0xCC, 0x4D, 0x8B, 0x2D, 0x8B, 0x6E, 0x93, 0x0D, 0x83, 0xCD, 0x7A, 0x8D, 0x6A, 0xCE, 0x72, 0x4E, 0x62, 0x2E, 0x52, 0x3B, 0xC5, 0xB0, 0x62, 0xF7, 0xB4, 0x0F, 0x52, 0x0E, 0x52, 0x76, 0x9C, 0xED, 0x49, 0xD3, 0x9B, 0x32, 0x73, 0xB0, 0x62, 0x2E, 0x5A, 0x2E, 0x52, 0x70, 0x62, 0x73, 0x7B, 0xD9, 0xBC, 0x8D, 0x6A, 0xF2, 0x93, 0x2F, 0x83, 0x8B, 0x72, 0x0D, 0x7B,
+    0x0C, 0x7B, 0x6E, 0x93, 0x0B, 0x8B, 0x99, 0xF6, 0x2B, 0x83, 0xEE, 0x9B, 0x72, 0xDD, 0x8F, 0xB4, 0x6B, 0x93, 0x2E, 0xAC, 0x08, 0x8B, 0x6A, 0x93, 0x4D, 0xB4, 0x09, 0x83, 0x09, 0x7B, 0xE9, 0x7A, 0x2B, 0x7B, 0x70, 0xA4, 0xB1, 0xAC, 0x32, 0xBD, 0xEA, 0x6A, 0x48, 0x5A, 0x2B, 0x73, 0x2B, 0x6B, 0x68, 0x5A, 0x48, 0x52, 0x48, 0x52, 0x88, 0x62, 0xCB, 0x62, 0x48, 0x52, 0x69, 0x52, 0x69, 0x52,
+    0x67, 0x31, 0x67, 0x39, 0x88, 0x39, 0x88, 0x39, 0xA8, 0x41, 0x8D, 0x62, 0x0E, 0x6B, 0xAA, 0x49, 0x0E, 0x5A, 0x6B, 0x62, 0x6D, 0x83, 0x77, 0xF6, 0x58, 0xFE, 0x4B, 0x8B, 0xE9, 0x72, 0xEF, 0xA3, 0xCE, 0xB3, 0x70, 0xCC, 0x2D, 0x9B, 0x30, 0xAC, 0x92, 0xBC, 0x6D, 0x9B, 0xB1, 0xCC, 0xB0, 0x9B, 0xCE, 0x72, 0x70, 0x62, 0x52, 0x62, 0xB6, 0x6A, 0xD7, 0xA4, 0xB5, 0x83, 0xB8, 0xB4, 0x10, 0x52,
+    0x53, 0x73, 0x74, 0x83, 0x2E, 0x52, 0x52, 0x5A, 0x73, 0x5A, 0x0F, 0x52, 0x2F, 0x52, 0x0F, 0x52, 0x32, 0x5A, 0x5A, 0x7B, 0xD8, 0x93, 0x6E, 0x62, 0x71, 0x8B, 0xB4, 0xBC, 0x6E, 0x93, 0x0D, 0x83, 0x2D, 0x83, 0xEF, 0x9B, 0xCE, 0xCC, 0xD1, 0xFD, 0x4B, 0x9B, 0x4A, 0x8B, 0x56, 0xEF, 0x90, 0xED, 0xEB, 0xB3, 0xEC, 0xAB, 0x2D, 0xA4, 0x8D, 0xB4, 0xAA, 0xCC, 0xC8, 0xAB, 0x29, 0x83, 0xED, 0x9B,
+    0xA9, 0x72, 0xF1, 0xC4, 0xEE, 0x93, 0x6C, 0x7B, 0x4B, 0x7B, 0x48, 0x5A, 0x2D, 0x9C, 0x74, 0xC5, 0x48, 0x52, 0x8A, 0x62, 0x48, 0x52, 0x4C, 0x73, 0x69, 0x52, 0x69, 0x52, 0x49, 0x52, 0x69, 0x52, 0x47, 0x31, 0x47, 0x31, 0x48, 0x31, 0x89, 0x39, 0x50, 0x73, 0xAB, 0x41, 0x14, 0x39, 0xFF, 0xF7, 0xD5, 0x49, 0xAD, 0x6A, 0xCB, 0x7A, 0x77, 0xFF, 0xFF, 0xFF, 0xAF, 0xBC, 0xEB, 0x82, 0x4D, 0xA3,
+    0xCF, 0xF5, 0xFF, 0xFF, 0x8F, 0xDD, 0x8E, 0x9B, 0x0B, 0x93, 0x33, 0xEE, 0xFF, 0xFF, 0x4E, 0xAB, 0x72, 0x93, 0xBC, 0x93, 0x1E, 0x83, 0xFF, 0xFF, 0x15, 0x52, 0x98, 0xAC, 0xD7, 0x6A, 0x9D, 0x42, 0x51, 0x31, 0x32, 0x83, 0x4F, 0x5A, 0x54, 0x5A, 0xFF, 0xFF, 0x32, 0x52, 0x0F, 0x52, 0x10, 0x4A, 0x3F, 0x7B, 0xFF, 0xFF, 0x99, 0x93, 0x6F, 0x62, 0xF4, 0xA3, 0xBC, 0xFF, 0xFF, 0xFF, 0x8F, 0x93,
+    0xED, 0x7A, 0x8E, 0x9B, 0xFE, 0xFF, 0xFC, 0xFF, 0x8B, 0xA3, 0x4B, 0x93, 0xD2, 0xF6, 0xFF, 0xFF, 0xCE, 0xFE, 0xEB, 0xAB, 0x6A, 0x93, 0x2C, 0xCD, 0xFF, 0xFF, 0xEC, 0xF5, 0x28, 0x8B, 0x0A, 0x83, 0xCB, 0x7A, 0x77, 0x95, 0x6F, 0x6A, 0xAA, 0x6A, 0x48, 0x5A, 0x48, 0x5A, 0x8E, 0x83, 0x0F, 0x8C, 0x07, 0x52, 0x69, 0x52, 0x2C, 0x6B, 0x08, 0x4A, 0x48, 0x52, 0x28, 0x4A, 0x28, 0x4A, 0x49, 0x52,
+    0x52, 0x73, 0x2F, 0x6B, 0xB3, 0x83, 0x88, 0x39, 0x88, 0x39, 0xFB, 0xAC, 0x9F, 0xB5, 0x1F, 0xB5, 0xB0, 0x49, 0x0B, 0x5A, 0xB1, 0xB4, 0xDD, 0xFF, 0xCE, 0xD4, 0xCD, 0xAB, 0xAB, 0x7A, 0x8D, 0x9B, 0xFA, 0xFF, 0xD6, 0xFF, 0x8D, 0xB3, 0x2E, 0x8B, 0x2B, 0x72, 0xFD, 0xFF, 0xAF, 0xB3, 0x8E, 0x7A, 0xD4, 0x9B, 0xF5, 0x9B, 0x9F, 0xBD, 0xD6, 0x49, 0x35, 0x7B, 0x79, 0xA4, 0x32, 0x7B, 0xBE, 0x9C,
+    0xCE, 0x49, 0x16, 0xA4, 0x6F, 0x5A, 0x10, 0x5A, 0x9E, 0x8C, 0x50, 0x5A, 0x0F, 0x4A, 0xCE, 0x49, 0xF2, 0x49, 0xDF, 0xC5, 0x7A, 0xB4, 0x2E, 0x5A, 0x11, 0x83, 0x6F, 0x9B, 0xFF, 0xFF, 0xEE, 0x7A, 0x2E, 0x83, 0x6E, 0x93, 0xAD, 0xAB, 0xFC, 0xFF, 0x6C, 0x93, 0x0B, 0x8B, 0x8C, 0xA3, 0xAC, 0xD4, 0x77, 0xF7, 0x0A, 0x8B, 0x0A, 0x8B, 0x09, 0x93, 0xC9, 0xB3, 0xF6, 0xFF, 0xC9, 0x82, 0xEA, 0x7A,
+    0x89, 0x6A, 0xCB, 0x72, 0xEB, 0x7A, 0x6C, 0x83, 0x28, 0x5A, 0x27, 0x5A, 0x4C, 0x7B, 0xE7, 0x49, 0x30, 0x8C, 0xEF, 0x93, 0x28, 0x52, 0xC6, 0x41, 0x07, 0x4A, 0x6A, 0x5A, 0x28, 0x4A, 0x49, 0x4A, 0x88, 0x39, 0x47, 0x31, 0x55, 0x9C, 0x47, 0x31, 0x68, 0x39, 0x89, 0x41, 0x8B, 0x41, 0x2D, 0x5A, 0xAA, 0x51, 0x8C, 0x62, 0x6A, 0x62, 0x0D, 0x83, 0x8B, 0x72, 0x2D, 0x83, 0x4A, 0x6A, 0xAB, 0x7A,
+    0x8F, 0xA3, 0x6E, 0x9B, 0xAC, 0x82, 0xED, 0x82, 0xAE, 0x72, 0x0F, 0x83, 0x8F, 0x72, 0x4E, 0x6A, 0x97, 0xB4, 0xD6, 0x93, 0x70, 0x62, 0x93, 0x62, 0x36, 0x7B, 0xD1, 0x6A, 0x91, 0x93, 0xCE, 0x49, 0xED, 0x49, 0x98, 0x83, 0x2E, 0x52, 0x4F, 0x8B, 0xEE, 0x49, 0x4E, 0x52, 0xCD, 0x49, 0xCD, 0x49, 0xAE, 0x49, 0x0F, 0x52, 0xF4, 0x7A, 0x0E, 0x5A, 0xD0, 0x7A, 0x8E, 0x72, 0x6E, 0x6A, 0x6E, 0x72,
+    0x8D, 0x72, 0x2E, 0x83, 0x0D, 0x8B, 0x39, 0xEE, 0xEC, 0x82, 0xAF, 0x93, 0xCB, 0x8A, 0x0B, 0x93, 0x2B, 0x93, 0xEA, 0x8A, 0x0A, 0x83, 0xEA, 0x8A, 0x68, 0x7A, 0xCA, 0x82, 0xC9, 0x7A, 0x89, 0x72, 0xCA, 0x72, 0x8A, 0x6A, 0x8E, 0x8B, 0x28, 0x5A, 0xAA, 0x6A, 0x48, 0x5A, 0x28, 0x5A, 0x69, 0x5A, 0x07, 0x52, 0xEB, 0x72, 0x28, 0x4A, 0xE7, 0x51, 0x08, 0x4A, 0xE7, 0x49, 0xE8, 0x49, 0x28, 0x4A,
+    0x25, 0x29, 0x6B, 0x5A, 0xC9, 0x51, 0x2A, 0x4A, 0x06, 0x31, 0x89, 0x39, 0x6D, 0x5A, 0xAA, 0x49, 0x4E, 0x83, 0x2A, 0x5A, 0x4A, 0x62, 0xAD, 0x7A, 0x0D, 0x83, 0xAB, 0x72, 0x6B, 0x72, 0x6F, 0x93, 0xB5, 0xCC, 0xAC, 0x82, 0xAC, 0x82, 0x6C, 0x72, 0x52, 0x8B, 0x2E, 0x62, 0x2F, 0x62, 0x4F, 0x6A, 0x94, 0x8B, 0x13, 0x73, 0xCE, 0x51, 0xEF, 0x49, 0xF6, 0x93, 0x94, 0x7B, 0x57, 0xAC, 0xED, 0x49,
+    0xD0, 0x62, 0x2F, 0x52, 0xED, 0x49, 0x1A, 0xBD, 0x8C, 0x39, 0xCC, 0x49, 0xAC, 0x41, 0xAD, 0x41, 0x8D, 0x41, 0x91, 0x62, 0xB6, 0x62, 0x2E, 0x5A, 0x4F, 0x62, 0x11, 0x7B, 0x90, 0x6A, 0x6E, 0x6A, 0x8D, 0x72, 0x2F, 0x83, 0x8C, 0x82, 0x91, 0xBC, 0xCC, 0x82, 0xCC, 0x82, 0x8E, 0xA3, 0x38, 0xFF, 0x0B, 0x93, 0x6C, 0x9B, 0xAD, 0x9B, 0x90, 0xBC, 0x88, 0x82, 0x88, 0x82, 0xA9, 0x7A, 0x0B, 0x83,
+    0x89, 0x6A, 0x49, 0x62, 0x08, 0x5A, 0xCB, 0x72, 0x08, 0x52, 0x07, 0x52, 0x27, 0x62, 0xAA, 0x62, 0x08, 0x52, 0xE7, 0x49, 0x08, 0x4A, 0xC7, 0x49, 0x28, 0x52, 0x08, 0x4A, 0x08, 0x4A, 0x08, 0x4A, 0x46, 0x31, 0x26, 0x29, 0xA8, 0x49, 0xA8, 0x39, 0xF1, 0x83, 0x69, 0x39, 0xA9, 0x49, 0x0C, 0x5A, 0xB1, 0x8B, 0x4E, 0x7B, 0x4A, 0x6A, 0x2D, 0x8B, 0x8D, 0x9B, 0xCF, 0xA3, 0x51, 0xBC, 0xEE, 0x8A,
+    0x3D, 0xFF, 0x8D, 0xBB, 0x73, 0xBC, 0xD1, 0xA3, 0x33, 0x8B, 0xB2, 0x61, 0xD8, 0x82, 0xB5, 0x8B, 0xF1, 0x7A, 0x7A, 0xD5, 0xCF, 0x49, 0xF7, 0x6A, 0x73, 0x5A, 0xAD, 0x41, 0xDB, 0x93, 0x8D, 0x41, 0x33, 0x6B, 0x8D, 0x41, 0x8C, 0x39, 0x7B, 0x83, 0xCE, 0x41, 0xCD, 0x49, 0x8C, 0x41, 0x8C, 0x41, 0xAF, 0x41, 0xB8, 0x62, 0xF3, 0x49, 0xCD, 0x49, 0x4F, 0x62, 0x13, 0x62, 0x3A, 0x62, 0x31, 0x6A,
+    0x8E, 0x72, 0x50, 0x93, 0xB5, 0xFE, 0x91, 0xDC, 0xED, 0x92, 0xCC, 0x82, 0x6B, 0xA3, 0xCC, 0xEC, 0xCB, 0xCB, 0x0A, 0x9B, 0x2B, 0x9B, 0x90, 0xC4, 0xEC, 0xEC, 0x29, 0xAB, 0xAA, 0x82, 0x68, 0x72, 0x8E, 0x8B, 0x6C, 0x72, 0xE8, 0x59, 0x29, 0x62, 0x4D, 0x7B, 0x49, 0x62, 0x07, 0x5A, 0xE8, 0x51, 0x08, 0x52, 0xCB, 0x6A, 0x08, 0x52, 0xC7, 0x49, 0xE8, 0x49, 0xE8, 0x49, 0x49, 0x52, 0x08, 0x4A,
+    0x06, 0x29, 0x47, 0x31, 0xEA, 0x49, 0x8D, 0x5A, 0x10, 0x6B, 0x89, 0x39, 0x89, 0x41, 0x1F, 0x76, 0xEF, 0x59, 0x4B, 0x6A, 0x0A, 0x93, 0x17, 0xF7, 0xFF, 0xFF, 0x8C, 0xAB, 0xD1, 0xAB, 0x4E, 0xB3, 0xBA, 0xFF, 0xFF, 0xFF, 0x0F, 0xBC, 0x6E, 0x7A, 0xBA, 0x8A, 0xBE, 0x72, 0xFF, 0xFF, 0x13, 0x62, 0xCF, 0x51, 0x9D, 0x8B, 0x95, 0x41, 0xFF, 0xF7, 0xD0, 0x49, 0x6C, 0x39, 0x0F, 0x52, 0x8E, 0x39,
+    0x8D, 0x41, 0x2F, 0x52, 0xED, 0x49, 0x70, 0x5A, 0x3C, 0x5B, 0xED, 0x49, 0x8C, 0x41, 0x8C, 0x39, 0x4F, 0x39, 0xFF, 0xFF, 0xB1, 0x49, 0xAD, 0x49, 0x30, 0x5A, 0x1A, 0x6A, 0xFF, 0xFF, 0x36, 0x62, 0xAF, 0x72, 0xEF, 0x82, 0x15, 0xF6, 0xDB, 0xF5, 0x54, 0xA3, 0xED, 0x8A, 0x6D, 0xB3, 0xFF, 0xFF, 0xD5, 0xFF, 0xEB, 0xE3, 0x0B, 0x9B, 0x4B, 0xB3, 0xFF, 0xFF, 0x0A, 0xDC, 0x0A, 0xB3, 0xCB, 0x82,
+    0x4A, 0x6A, 0xFF, 0xEF, 0x4F, 0x6A, 0x09, 0x5A, 0xC8, 0x51, 0x29, 0x5A, 0xAF, 0x83, 0x07, 0x52, 0xE7, 0x49, 0xE7, 0x49, 0xC7, 0x49, 0xC7, 0x41, 0x6A, 0x52, 0xE8, 0x49, 0xC7, 0x41, 0xE8, 0x49, 0x48, 0x31, 0x10, 0x6B, 0xEA, 0x49, 0x48, 0x31, 0xCB, 0x41, 0x8D, 0x41, 0x58, 0xA4, 0x6F, 0x62, 0xCC, 0x51, 0xAC, 0x7A, 0x73, 0xFE, 0xFF, 0xFF, 0xEE, 0xB3, 0x4E, 0x9B, 0x0E, 0x8B, 0xBA, 0xFD,
+    0xFF, 0xFF, 0x32, 0xED, 0x0E, 0x9B, 0x0F, 0x6A, 0xD9, 0x61, 0xFF, 0xFF, 0x5B, 0x49, 0xD1, 0x51, 0xAE, 0x49, 0x51, 0x5A, 0x7F, 0x86, 0x11, 0x4A, 0x8D, 0x41, 0x4E, 0x52, 0x0D, 0x52, 0xF9, 0x7B, 0xAC, 0x41, 0x0E, 0x52, 0xAB, 0x41, 0x2F, 0x52, 0x3A, 0x84, 0x4E, 0x5A, 0x8B, 0x39, 0x6B, 0x39, 0x6D, 0x41, 0xFF, 0xA7, 0xAF, 0x49, 0x8C, 0x41, 0xEE, 0x51, 0xD2, 0x51, 0xFF, 0xFF, 0x11, 0x62,
+    0x2E, 0x62, 0x6E, 0x72, 0xD1, 0x8A, 0xFF, 0xFF, 0xB6, 0x82, 0xEF, 0x82, 0xED, 0x92, 0xAC, 0xCB, 0xFF, 0xFF, 0x0C, 0xEC, 0xEB, 0x9A, 0xEB, 0x92, 0x0A, 0xAB, 0xFE, 0xFF, 0x8E, 0xFC, 0x8A, 0x82, 0x29, 0x62, 0x09, 0x5A, 0x6C, 0x51, 0xCC, 0x51, 0xC8, 0x51, 0x28, 0x5A, 0xC7, 0x49, 0xA7, 0x49, 0xA7, 0x41, 0xC7, 0x41, 0xA7, 0x41, 0xA7, 0x41, 0xC7, 0x41, 0xC8, 0x41, 0xC7, 0x41, 0xE8, 0x49,
+    0x06, 0x29, 0x06, 0x29, 0x27, 0x31, 0x68, 0x39, 0x29, 0x31, 0x48, 0x39, 0x69, 0x39, 0x89, 0x41, 0x6C, 0x62, 0x4B, 0x6A, 0x8D, 0xA3, 0xCE, 0xB3, 0x0E, 0x8B, 0x4C, 0x6A, 0x8D, 0x7A, 0xB3, 0xAB, 0x72, 0xBB, 0xCE, 0x8A, 0x0D, 0x6A, 0x0F, 0x62, 0x54, 0x62, 0x9B, 0x72, 0x90, 0x41, 0xAF, 0x49, 0x8D, 0x49, 0xCF, 0x49, 0xCE, 0x49, 0x0F, 0x52, 0x2B, 0x31, 0x6B, 0x39, 0x70, 0x62, 0x6B, 0x39,
+    0xCC, 0x41, 0x2A, 0x31, 0x6A, 0x39, 0x50, 0x5A, 0x6B, 0x39, 0x8B, 0x39, 0x8B, 0x39, 0x4A, 0x39, 0x6B, 0x39, 0x0E, 0x52, 0xAE, 0x49, 0x6B, 0x41, 0xCD, 0x49, 0x2F, 0x5A, 0xAE, 0x49, 0xCD, 0x51, 0x0D, 0x5A, 0x4D, 0x62, 0x2E, 0x6A, 0xD2, 0x7A, 0x4E, 0x72, 0x6D, 0x72, 0x8D, 0x7A, 0x8C, 0x8A, 0xEC, 0xA2, 0xAB, 0x92, 0x4E, 0x9B, 0x8B, 0x82, 0xAB, 0x8A, 0xED, 0xA2, 0xAA, 0x8A, 0x49, 0x72,
+    0x29, 0x62, 0x2A, 0x62, 0x09, 0x5A, 0xC8, 0x51, 0xC8, 0x51, 0x29, 0x5A, 0xA7, 0x49, 0xC8, 0x49, 0xE8, 0x49, 0xA7, 0x41, 0xA7, 0x41, 0xC7, 0x41, 0xC7, 0x41, 0xC8, 0x41, 0xC7, 0x41, 0xE8, 0x41, 0x06, 0x29, 0x27, 0x31, 0x28, 0x31, 0x47, 0x31, 0x48, 0x31, 0xC8, 0x20, 0x2C, 0x52, 0x69, 0x41, 0xCB, 0x51, 0x8A, 0x49, 0xCA, 0x59, 0x2C, 0x62, 0x6E, 0x6A, 0xEC, 0x59, 0x52, 0x83, 0xF1, 0x82,
+    0xEE, 0x61, 0xED, 0x61, 0xCD, 0x51, 0x32, 0x83, 0x51, 0x5A, 0xB4, 0x6A, 0x8E, 0x41, 0x0E, 0x52, 0x8C, 0x41, 0xCE, 0x49, 0xCD, 0x49, 0xEE, 0x49, 0x4B, 0x39, 0x4B, 0x39, 0xCD, 0x49, 0x09, 0x31, 0x8F, 0x5A, 0x09, 0x31, 0x09, 0x29, 0xEE, 0x49, 0x2D, 0x52, 0xEC, 0x49, 0x4A, 0x39, 0x4A, 0x31, 0x4B, 0x39, 0xD0, 0x62, 0x8C, 0x41, 0x4A, 0x39, 0xEE, 0x51, 0x70, 0x62, 0x8C, 0x49, 0x8C, 0x49,
+    0xCB, 0x51, 0x31, 0x83, 0x31, 0x83, 0x4E, 0x6A, 0x0A, 0x5A, 0x2D, 0x6A, 0x10, 0x83, 0x8D, 0x82, 0x8C, 0x7A, 0x2C, 0x72, 0x6C, 0x7A, 0x4F, 0x8B, 0x4C, 0x72, 0xCD, 0x82, 0x4A, 0x72, 0xED, 0x82, 0xC8, 0x59, 0xE9, 0x59, 0xC9, 0x59, 0x09, 0x5A, 0xCC, 0x6A, 0x09, 0x52, 0xA7, 0x49, 0x6A, 0x5A, 0x29, 0x52, 0xA7, 0x41, 0xA7, 0x41, 0xC7, 0x41, 0x87, 0x39, 0xC8, 0x41, 0xC8, 0x41, 0xE8, 0x41,
+    0xC5, 0x20, 0xE6, 0x28, 0x27, 0x31, 0x27, 0x31, 0xCA, 0x41, 0x0A, 0x31, 0x89, 0x41, 0x69, 0x39, 0xAA, 0x49, 0x10, 0x73, 0x4C, 0x41, 0x0D, 0x5A, 0xED, 0x59, 0xCC, 0x51, 0xCD, 0x51, 0xF4, 0x61, 0xCE, 0x51, 0xAD, 0x51, 0x90, 0x6A, 0x8D, 0x49, 0xF0, 0x51, 0xCE, 0x49, 0xB2, 0x6A, 0x4C, 0x39, 0x6C, 0x39, 0xAF, 0x41, 0x6B, 0x39, 0xF2, 0x6A, 0x0A, 0x31, 0x4A, 0x31, 0x8D, 0x41, 0x6A, 0x39,
+    0x2A, 0x29, 0xCC, 0x41, 0x69, 0x31, 0xCD, 0x41, 0x4E, 0x52, 0xAB, 0x41, 0x49, 0x31, 0x29, 0x31, 0x4A, 0x31, 0x73, 0x73, 0x6C, 0x41, 0x4A, 0x39, 0x6B, 0x39, 0xAC, 0x41, 0x12, 0x6B, 0x8B, 0x41, 0xAB, 0x49, 0x8B, 0x49, 0xEE, 0x59, 0xF6, 0x9B, 0x8B, 0x51, 0xAB, 0x59, 0x0C, 0x62, 0x33, 0xA4, 0x92, 0x9B, 0x0C, 0x6A, 0x2C, 0x6A, 0x4C, 0x6A, 0x71, 0x93, 0xEE, 0x82, 0x2B, 0x6A, 0x0A, 0x62,
+    0x89, 0x51, 0x8D, 0x6A, 0x68, 0x49, 0xE9, 0x59, 0xA8, 0x49, 0x2A, 0x52, 0x29, 0x5A, 0x87, 0x41, 0xA7, 0x41, 0x87, 0x39, 0xAB, 0x62, 0x87, 0x41, 0xA7, 0x39, 0xA7, 0x41, 0x86, 0x39, 0xC7, 0x41, 0xCA, 0x41, 0xE6, 0x28, 0x07, 0x29, 0xAF, 0x62, 0x08, 0x29, 0x8D, 0x5A, 0xCD, 0x49, 0x10, 0x73, 0xEC, 0x51, 0xED, 0x59, 0x97, 0x9B, 0x32, 0x72, 0xD6, 0x93, 0x2E, 0x62, 0xCF, 0x51, 0x5F, 0xAC,
+    0xB7, 0x59, 0xB8, 0x8B, 0x6D, 0x41, 0x6D, 0x41, 0x2E, 0x39, 0x12, 0x52, 0xB0, 0x41, 0x8D, 0x41, 0x8B, 0x41, 0xEE, 0x49, 0x6A, 0x39, 0x8B, 0x39, 0x29, 0x31, 0x0C, 0x4A, 0x4A, 0x31, 0xE9, 0x28, 0x29, 0x31, 0xEC, 0x49, 0x49, 0x31, 0x0E, 0x4A, 0x29, 0x29, 0xCB, 0x41, 0x49, 0x31, 0x29, 0x31, 0xE8, 0x28, 0x8B, 0x39, 0xAC, 0x41, 0x4A, 0x39, 0x6B, 0x41, 0xAC, 0x41, 0xB8, 0x8B, 0xCD, 0x51,
+    0x8B, 0x49, 0xAC, 0x49, 0xCE, 0x51, 0xB9, 0x9B, 0xD0, 0x59, 0xAC, 0x51, 0x0D, 0x62, 0xCF, 0x61, 0x5F, 0xFF, 0x73, 0x92, 0x2D, 0x6A, 0x0C, 0x6A, 0x8F, 0x82, 0xF4, 0xC3, 0x4F, 0x7A, 0x0B, 0x5A, 0xA9, 0x51, 0xA9, 0x51, 0xAC, 0x51, 0x89, 0x49, 0x0A, 0x5A, 0xA8, 0x49, 0x67, 0x41, 0x6B, 0x62, 0x87, 0x39, 0x67, 0x39, 0x67, 0x39, 0xA8, 0x41, 0xAC, 0x62, 0xA7, 0x41, 0x87, 0x39, 0xA7, 0x41,
+    0x28, 0x31, 0xAF, 0x5A, 0xC7, 0x20, 0x28, 0x29, 0xE8, 0x28, 0x4A, 0x39, 0xB5, 0x83, 0x49, 0x39, 0xEC, 0x51, 0x8D, 0x51, 0x79, 0xBB, 0xFF, 0xFF, 0x74, 0x7A, 0xAF, 0x51, 0x6F, 0x49, 0xBF, 0x61, 0xFF, 0xFF, 0x73, 0x49, 0x4D, 0x39, 0x4C, 0x39, 0x91, 0x39, 0xFF, 0xF7, 0x53, 0x39, 0x2B, 0x31, 0x2A, 0x31, 0x6C, 0x39, 0x79, 0x7B, 0x6B, 0x39, 0x09, 0x29, 0x09, 0x31, 0xAA, 0x20, 0x74, 0x6B,
+    0x08, 0x29, 0x08, 0x29, 0x08, 0x29, 0x70, 0x41, 0xAC, 0x41, 0x69, 0x31, 0x28, 0x29, 0x08, 0x29, 0xA9, 0x20, 0x96, 0x7B, 0x6B, 0x39, 0x08, 0x31, 0x8B, 0x41, 0xAC, 0x41, 0x3F, 0x8D, 0x6B, 0x39, 0x6A, 0x41, 0x6B, 0x41, 0x4D, 0x41, 0xFF, 0xFF, 0x53, 0x41, 0x8C, 0x51, 0x8C, 0x49, 0xCF, 0x61, 0x9F, 0xFF, 0x53, 0x92, 0xCC, 0x61, 0xCC, 0x59, 0x4E, 0x82, 0xFF, 0xFF, 0x59, 0x9B, 0xCC, 0x59,
+    0x48, 0x41, 0x69, 0x41, 0x6A, 0x41, 0x69, 0x41, 0xED, 0x51, 0x67, 0x41, 0x67, 0x39, 0x66, 0x39, 0x67, 0x39, 0x46, 0x31, 0x87, 0x39, 0x87, 0x39, 0x67, 0x39, 0x88, 0x39, 0xA7, 0x39, 0x87, 0x39, 0xC8, 0x20, 0xE7, 0x28, 0x28, 0x31, 0xC7, 0x20, 0x08, 0x29, 0xE9, 0x28, 0xAB, 0x41, 0x09, 0x31, 0x2A, 0x39, 0xEF, 0x51, 0xF1, 0x69, 0xD4, 0x82, 0xAF, 0x51, 0x2D, 0x39, 0x6E, 0x41, 0xF4, 0x59,
+    0x32, 0x41, 0x2D, 0x39, 0x0C, 0x31, 0xCE, 0x49, 0xEC, 0x28, 0x2F, 0x31, 0x6D, 0x39, 0x2B, 0x31, 0xED, 0x49, 0x6D, 0x39, 0x09, 0x29, 0x29, 0x31, 0x6E, 0x52, 0x08, 0x29, 0x89, 0x20, 0x29, 0x31, 0x49, 0x31, 0xE8, 0x28, 0x27, 0x29, 0x6A, 0x31, 0x4D, 0x52, 0x6A, 0x39, 0x08, 0x29, 0xE7, 0x20, 0xE8, 0x20, 0x0C, 0x4A, 0xAB, 0x41, 0x08, 0x29, 0x49, 0x31, 0xAC, 0x41, 0x29, 0x39, 0x29, 0x31,
+    0xCB, 0x49, 0x49, 0x39, 0x6B, 0x41, 0xAE, 0x49, 0xAD, 0x51, 0x8C, 0x49, 0xCD, 0x59, 0x8C, 0x51, 0xAD, 0x59, 0x4C, 0x51, 0x90, 0x72, 0xAB, 0x51, 0xCC, 0x61, 0x0E, 0x6A, 0xED, 0x61, 0xAA, 0x49, 0x69, 0x41, 0x48, 0x39, 0x88, 0x41, 0x0A, 0x4A, 0xC9, 0x49, 0x67, 0x39, 0x47, 0x39, 0xE9, 0x49, 0x8B, 0x41, 0x46, 0x31, 0x67, 0x39, 0x67, 0x39, 0x46, 0x31, 0x67, 0x39, 0xA7, 0x39, 0xC8, 0x39,
+    0xA7, 0x20, 0xC6, 0x20, 0x28, 0x31, 0xC7, 0x20, 0x08, 0x29, 0xCD, 0x41, 0x29, 0x31, 0x08, 0x29, 0x09, 0x31, 0x8D, 0x41, 0xCF, 0x51, 0x4D, 0x39, 0x4D, 0x39, 0x2C, 0x39, 0x32, 0x52, 0x71, 0x41, 0x0D, 0x31, 0x2D, 0x31, 0x8D, 0x39, 0x0B, 0x31, 0x0C, 0x31, 0x0B, 0x31, 0x2B, 0x31, 0x4F, 0x52, 0x4A, 0x31, 0x2B, 0x31, 0xE8, 0x28, 0x4A, 0x31, 0xE8, 0x28, 0xE8, 0x28, 0xE7, 0x20, 0x28, 0x29,
+    0x6D, 0x52, 0x08, 0x29, 0x08, 0x29, 0x09, 0x29, 0xE7, 0x28, 0x28, 0x29, 0xE7, 0x28, 0xE7, 0x20, 0x29, 0x29, 0x8E, 0x5A, 0x49, 0x39, 0xE7, 0x28, 0x49, 0x31, 0x8A, 0x41, 0xE8, 0x28, 0x69, 0x39, 0x29, 0x31, 0x8A, 0x41, 0xD0, 0x6A, 0x8B, 0x41, 0x8C, 0x41, 0xED, 0x51, 0x6B, 0x41, 0x4B, 0x41, 0x6C, 0x49, 0x6B, 0x49, 0x8C, 0x49, 0xAF, 0x6A, 0xAC, 0x51, 0xCD, 0x51, 0x6B, 0x41, 0x4A, 0x41,
+    0xAA, 0x41, 0x28, 0x39, 0x48, 0x39, 0x28, 0x31, 0x88, 0x41, 0x26, 0x31, 0x46, 0x31, 0x47, 0x31, 0x67, 0x39, 0x67, 0x39, 0x47, 0x31, 0x46, 0x31, 0x67, 0x39, 0x67, 0x39, 0x87, 0x39, 0x87, 0x39, 0xC6, 0x20, 0xC6, 0x20, 0x86, 0x18, 0x29, 0x29, 0x08, 0x29, 0x09, 0x29, 0xC8, 0x28, 0xE9, 0x28, 0x4E, 0x52, 0x4B, 0x31, 0x2D, 0x31, 0x0D, 0x31, 0x0D, 0x31, 0x8E, 0x39, 0xAF, 0x41, 0xB0, 0x20,
+    0x0E, 0x29, 0x6F, 0x39, 0x55, 0x5A, 0x0A, 0x29, 0x2C, 0x31, 0x6C, 0x39, 0x51, 0x52, 0xE9, 0x28, 0x2A, 0x31, 0xAB, 0x39, 0x09, 0x29, 0x8F, 0x52, 0xE8, 0x28, 0xAA, 0x41, 0xC6, 0x20, 0x8B, 0x39, 0xEC, 0x41, 0x08, 0x29, 0xC6, 0x20, 0x8A, 0x39, 0x0C, 0x4A, 0x28, 0x31, 0xE7, 0x20, 0xC6, 0x20, 0x29, 0x29, 0x8E, 0x5A, 0x29, 0x31, 0xE7, 0x28, 0xA9, 0x39, 0x49, 0x31, 0xAF, 0x62, 0x08, 0x31,
+    0x08, 0x31, 0xAA, 0x41, 0x8B, 0x41, 0x6B, 0x41, 0x2A, 0x31, 0xCC, 0x49, 0x0B, 0x39, 0xB2, 0x62, 0x6E, 0x41, 0xAE, 0x49, 0x8C, 0x49, 0x6B, 0x41, 0x72, 0x62, 0x6D, 0x41, 0x8C, 0x41, 0x2A, 0x39, 0x29, 0x31, 0x8F, 0x5A, 0x08, 0x31, 0x07, 0x31, 0x68, 0x39, 0x6D, 0x5A, 0x06, 0x31, 0x26, 0x31, 0x47, 0x31, 0x27, 0x31, 0x2A, 0x4A, 0x47, 0x31, 0x26, 0x31, 0x46, 0x31, 0x66, 0x31, 0x66, 0x31,
+    0xA5, 0x18, 0xA5, 0x18, 0xC6, 0x20, 0xC7, 0x20, 0x08, 0x29, 0xC7, 0x20, 0xC8, 0x20, 0xE8, 0x28, 0x6C, 0x39, 0xCA, 0x20, 0xD0, 0x28, 0x56, 0x20, 0x35, 0x31, 0x10, 0x31, 0x0F, 0x29, 0x54, 0x20, 0x1B, 0x31, 0x92, 0x20, 0xCC, 0x28, 0x0B, 0x29, 0x0B, 0x31, 0xE9, 0x28, 0x0A, 0x29, 0x09, 0x31, 0xC8, 0x20, 0xE9, 0x28, 0x08, 0x29, 0xE8, 0x28, 0xC7, 0x20, 0xC6, 0x20, 0x49, 0x31, 0x08, 0x21,
+    0xC7, 0x20, 0xE6, 0x20, 0xC6, 0x20, 0x28, 0x29, 0xAF, 0x62, 0x89, 0x39, 0xC7, 0x20, 0xC6, 0x20, 0xEC, 0x49, 0x08, 0x29, 0x49, 0x31, 0xC6, 0x20, 0x08, 0x29, 0xC7, 0x28, 0x10, 0x6B, 0xE7, 0x28, 0x08, 0x31, 0x09, 0x31, 0xE9, 0x28, 0xBA, 0x83, 0x09, 0x31, 0x0A, 0x31, 0xEA, 0x30, 0x50, 0x41, 0xFF, 0xB5, 0xD1, 0x38, 0x4C, 0x39, 0x4B, 0x41, 0x10, 0x39, 0xFF, 0xA4, 0xF4, 0x30, 0x0B, 0x31,
+    0x2A, 0x31, 0xC8, 0x28, 0x95, 0x5A, 0x08, 0x31, 0x28, 0x31, 0x07, 0x31, 0x0A, 0x52, 0x8D, 0x5A, 0x06, 0x31, 0x06, 0x29, 0x26, 0x31, 0x47, 0x31, 0x2B, 0x52, 0x46, 0x31, 0x46, 0x31, 0x46, 0x31, 0xA5, 0x18, 0x0C, 0x4A, 0xA6, 0x18, 0xA6, 0x18, 0xE8, 0x28, 0xA7, 0x18, 0x52, 0x52, 0x4B, 0x31, 0xA9, 0x20, 0xCA, 0x28, 0x93, 0x28, 0xFF, 0xFF, 0x1B, 0x08, 0xF0, 0x30, 0x10, 0x31, 0x98, 0x20,
+    0xFF, 0xFF, 0x52, 0x18, 0xCB, 0x20, 0xC9, 0x20, 0xEA, 0x28, 0xFE, 0x3A, 0x6A, 0x31, 0xE9, 0x28, 0xEC, 0x41, 0xC8, 0x20, 0xAD, 0x39, 0xA7, 0x20, 0xEC, 0x41, 0xC6, 0x20, 0xE6, 0x20, 0x49, 0x31, 0xC7, 0x20, 0x27, 0x29, 0xC6, 0x20, 0xE6, 0x20, 0x48, 0x31, 0x69, 0x31, 0xC6, 0x20, 0xA6, 0x18, 0x28, 0x29, 0x31, 0x6B, 0xE7, 0x28, 0xC6, 0x20, 0xA6, 0x20, 0x2C, 0x4A, 0x29, 0x29, 0xE7, 0x28,
+    0x89, 0x39, 0xE8, 0x30, 0xE9, 0x28, 0xFE, 0x6C, 0x4C, 0x39, 0xE9, 0x30, 0xEE, 0x49, 0xEE, 0x30, 0xFD, 0x51, 0xD0, 0x30, 0xCD, 0x41, 0x2C, 0x39, 0x10, 0x39, 0xFF, 0xCD, 0x1E, 0x20, 0x4D, 0x39, 0x09, 0x31, 0xE8, 0x28, 0xE9, 0x28, 0x6A, 0x39, 0xE7, 0x28, 0xE6, 0x28, 0x06, 0x29, 0x88, 0x39, 0x06, 0x29, 0x26, 0x29, 0x06, 0x29, 0x06, 0x29, 0x46, 0x31, 0x46, 0x31, 0x46, 0x31, 0x46, 0x31,
+    0x85, 0x18, 0x85, 0x18, 0xC6, 0x20, 0xA5, 0x18, 0xC6, 0x20, 0xA6, 0x18, 0xA7, 0x20, 0x0A, 0x29, 0xC9, 0x20, 0xCA, 0x20, 0xEE, 0x28, 0x73, 0x18, 0x8F, 0x20, 0xEE, 0x28, 0xEE, 0x28, 0x8D, 0x20, 0x90, 0x20, 0x8C, 0x20, 0x6D, 0x39, 0xEA, 0x28, 0xA9, 0x20, 0xC9, 0x20, 0xC8, 0x20, 0xCC, 0x39, 0x49, 0x31, 0xA7, 0x20, 0xC7, 0x20, 0xE7, 0x20, 0x8A, 0x39, 0xE7, 0x20, 0xE7, 0x28, 0xE6, 0x20,
+    0xCB, 0x39, 0x48, 0x31, 0x28, 0x29, 0xE6, 0x20, 0xC6, 0x20, 0x69, 0x31, 0xA6, 0x20, 0xA5, 0x18, 0x08, 0x29, 0x8A, 0x39, 0xCF, 0x62, 0xC6, 0x20, 0xC6, 0x20, 0xE8, 0x28, 0xA6, 0x20, 0xC6, 0x20, 0x07, 0x31, 0xE7, 0x28, 0x2D, 0x52, 0xE8, 0x28, 0x4A, 0x39, 0xE8, 0x28, 0x2E, 0x52, 0xCA, 0x28, 0x0C, 0x31, 0xCB, 0x28, 0x2A, 0x31, 0xCD, 0x41, 0x4B, 0x31, 0xCD, 0x28, 0xCD, 0x28, 0xCE, 0x49,
+    0x2A, 0x31, 0xA6, 0x20, 0xC7, 0x20, 0x29, 0x31, 0xCA, 0x41, 0xE6, 0x28, 0xE6, 0x28, 0xE6, 0x28, 0xA9, 0x41, 0xE6, 0x28, 0xE5, 0x28, 0x06, 0x29, 0xE5, 0x28, 0x46, 0x31, 0x47, 0x31, 0x26, 0x29, 0x85, 0x18, 0x85, 0x18, 0x85, 0x18, 0x65, 0x18, 0x86, 0x18, 0xE7, 0x20, 0xA7, 0x18, 0xE9, 0x28, 0xC8, 0x20, 0x2B, 0x29, 0xAA, 0x20, 0x8B, 0x18, 0xAB, 0x20, 0xAB, 0x20, 0x4D, 0x31, 0xAB, 0x20,
+    0xAB, 0x18, 0x8A, 0x20, 0xA9, 0x18, 0xA8, 0x20, 0xA8, 0x18, 0xA7, 0x18, 0xA8, 0x18, 0xC7, 0x20, 0x86, 0x18, 0xC7, 0x20, 0x66, 0x18, 0xC7, 0x20, 0xA6, 0x18, 0x85, 0x18, 0xA5, 0x18, 0x08, 0x29, 0xA5, 0x18, 0x85, 0x18, 0x85, 0x18, 0xA5, 0x18, 0xA5, 0x18, 0xC6, 0x18, 0xC6, 0x20, 0xA5, 0x18, 0x07, 0x29, 0xE6, 0x20, 0xC6, 0x20, 0xA5, 0x20, 0xE6, 0x28, 0x48, 0x31, 0x85, 0x20, 0xC6, 0x20,
+    0xE7, 0x28, 0x28, 0x31, 0xE7, 0x28, 0xE8, 0x28, 0xC7, 0x28, 0x09, 0x31, 0xC8, 0x28, 0xD1, 0x6A, 0x0B, 0x31, 0x6C, 0x39, 0xC9, 0x28, 0xC9, 0x28, 0xEA, 0x28, 0x4C, 0x39, 0xCA, 0x28, 0xC9, 0x20, 0xC8, 0x28, 0x29, 0x31, 0xC7, 0x28, 0x6F, 0x41, 0x07, 0x29, 0xEA, 0x41, 0xE6, 0x28, 0xE6, 0x28, 0xE5, 0x20, 0x06, 0x29, 0xE9, 0x41, 0xE5, 0x28, 0x05, 0x29, 0x05, 0x29, 0x26, 0x29, 0x46, 0x31,
+    0x85, 0x18, 0x85, 0x18, 0x85, 0x18, 0xAB, 0x39, 0x65, 0x18, 0xA6, 0x18, 0x86, 0x18, 0xA8, 0x18, 0x6F, 0x31, 0xA8, 0x20, 0x89, 0x18, 0x8B, 0x18, 0x4E, 0x31, 0xD1, 0x41, 0xCA, 0x20, 0xAB, 0x20, 0xCB, 0x20, 0xAF, 0x39, 0x68, 0x18, 0x88, 0x18, 0xA8, 0x18, 0xA7, 0x20, 0x50, 0x4A, 0xA7, 0x18, 0xA6, 0x18, 0xE7, 0x20, 0x86, 0x18, 0x2E, 0x4A, 0xA5, 0x18, 0x85, 0x18, 0xA5, 0x18, 0x07, 0x29,
+    0x84, 0x18, 0xC6, 0x20, 0x85, 0x18, 0xA5, 0x18, 0xA5, 0x18, 0x85, 0x18, 0x85, 0x18, 0xA5, 0x18, 0x07, 0x29, 0x4C, 0x4A, 0x07, 0x29, 0xA5, 0x18, 0xC6, 0x20, 0xA5, 0x20, 0x8E, 0x5A, 0xA6, 0x20, 0xA6, 0x20, 0xE7, 0x28, 0xC7, 0x28, 0xA7, 0x20, 0xC6, 0x20, 0xC7, 0x28, 0xE8, 0x28, 0xE9, 0x28, 0xC9, 0x28, 0xC9, 0x28, 0xC9, 0x28, 0xC8, 0x28, 0x10, 0x4A, 0xAB, 0x20, 0xAA, 0x20, 0xC9, 0x28,
+    0x86, 0x20, 0xC7, 0x20, 0x86, 0x20, 0x69, 0x39, 0xA5, 0x20, 0xC6, 0x20, 0xA5, 0x20, 0xC5, 0x20, 0xC5, 0x20, 0xE5, 0x20, 0xE5, 0x20, 0x06, 0x29, 0x05, 0x29, 0x06, 0x29, 0x26, 0x29, 0x26, 0x29, 0x44, 0x10, 0x85, 0x18, 0x73, 0x94, 0xC6, 0x18, 0x85, 0x10, 0xA6, 0x18, 0xA7, 0x20, 0x09, 0x29, 0xEA, 0x20, 0xA9, 0x20, 0x8C, 0x18, 0x57, 0x10, 0x18, 0x00, 0x70, 0x18, 0xAA, 0x18, 0x6A, 0x18,
+    0x94, 0x28, 0x8B, 0x18, 0xA9, 0x18, 0x2A, 0x31, 0x8B, 0x39, 0xA7, 0x18, 0x87, 0x18, 0x86, 0x18, 0x8A, 0x31, 0x86, 0x18, 0x6E, 0x52, 0xA6, 0x18, 0x69, 0x31, 0xC6, 0x20, 0x85, 0x18, 0x69, 0x31, 0xA5, 0x18, 0x84, 0x18, 0xA5, 0x18, 0x84, 0x18, 0xEC, 0x41, 0x0B, 0x4A, 0xA5, 0x18, 0x84, 0x18, 0x27, 0x29, 0x8E, 0x5A, 0xE6, 0x20, 0xA5, 0x18, 0xA5, 0x18, 0xE7, 0x20, 0xAF, 0x5A, 0xC5, 0x20,
+    0xC6, 0x20, 0xE7, 0x20, 0xEF, 0x6A, 0x90, 0x5A, 0x66, 0x18, 0x86, 0x20, 0xE8, 0x28, 0x8A, 0x20, 0xFA, 0x30, 0xAA, 0x20, 0x6B, 0x39, 0xC9, 0x20, 0xAF, 0x20, 0x7F, 0x3B, 0xD3, 0x20, 0x89, 0x20, 0xA8, 0x20, 0xE8, 0x28, 0xB6, 0x41, 0x87, 0x20, 0xA6, 0x20, 0xA5, 0x18, 0xA5, 0x18, 0xAA, 0x39, 0xA5, 0x20, 0xC5, 0x20, 0xC5, 0x20, 0xC5, 0x20, 0xEA, 0x41, 0xE5, 0x20, 0xE5, 0x20, 0x05, 0x21,
+    0x85, 0x10, 0xEC, 0x39, 0x85, 0x10, 0xE7, 0x20, 0x85, 0x18, 0xA6, 0x18, 0x51, 0x52, 0xC7, 0x20, 0xC8, 0x20, 0xC9, 0x20, 0x4D, 0x10, 0xFF, 0xF7, 0x1A, 0x00, 0x8C, 0x20, 0x69, 0x18, 0x8A, 0x18, 0xFF, 0x87, 0x8A, 0x10, 0x87, 0x18, 0xA8, 0x20, 0x87, 0x18, 0x4C, 0x31, 0xA6, 0x18, 0x86, 0x18, 0x86, 0x18, 0x85, 0x18, 0x86, 0x18, 0xA5, 0x18, 0x85, 0x10, 0x85, 0x18, 0x84, 0x18, 0x85, 0x18,
+    0xC5, 0x18, 0x64, 0x10, 0x84, 0x10, 0x84, 0x10, 0x85, 0x18, 0x84, 0x10, 0x64, 0x10, 0x64, 0x10, 0xC6, 0x20, 0x2C, 0x4A, 0xA5, 0x18, 0xA5, 0x18, 0x85, 0x18, 0x85, 0x18, 0xC6, 0x20, 0x85, 0x18, 0xA5, 0x18, 0x85, 0x18, 0xCA, 0x41, 0xC7, 0x28, 0xC6, 0x20, 0xC7, 0x20, 0xAB, 0x39, 0xA8, 0x20, 0xAA, 0x20, 0x88, 0x20, 0x0C, 0x4A, 0xC8, 0x20, 0x4A, 0x18, 0x1C, 0x00, 0x16, 0x08, 0x8C, 0x39,
+    0x46, 0x10, 0xC7, 0x20, 0xA7, 0x20, 0xC6, 0x20, 0x44, 0x10, 0x85, 0x18, 0xA5, 0x18, 0xA5, 0x20, 0x68, 0x31, 0xA4, 0x18, 0xA4, 0x18, 0xC5, 0x20, 0xE5, 0x20, 0xE5, 0x20, 0xE5, 0x20, 0x05, 0x29, 0x85, 0x18, 0x64, 0x10, 0x65, 0x10, 0xC7, 0x20, 0x85, 0x10, 0x8A, 0x31, 0x86, 0x18, 0x66, 0x10, 0x88, 0x18, 0x87, 0x18, 0x8E, 0x39, 0x4D, 0x18, 0x6B, 0x18, 0xA9, 0x18, 0x6D, 0x31, 0x88, 0x18,
+    0x88, 0x18, 0x67, 0x10, 0x87, 0x18, 0xC8, 0x20, 0x86, 0x18, 0xA7, 0x18, 0x85, 0x10, 0x0C, 0x42, 0x85, 0x18, 0x65, 0x18, 0xA6, 0x18, 0x85, 0x10, 0x84, 0x18, 0x84, 0x18, 0x84, 0x18, 0x85, 0x18, 0xCA, 0x39, 0x64, 0x10, 0x84, 0x18, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x18, 0x84, 0x18, 0xC5, 0x20, 0x0B, 0x42, 0xA5, 0x18, 0x84, 0x18, 0x85, 0x18, 0x84, 0x18, 0xA5, 0x18, 0x85, 0x18,
+    0xA5, 0x18, 0xA5, 0x18, 0xA6, 0x20, 0xA6, 0x20, 0xA6, 0x20, 0x86, 0x18, 0x86, 0x18, 0xA6, 0x18, 0xA7, 0x20, 0x87, 0x18, 0x87, 0x18, 0xAB, 0x41, 0xA8, 0x20, 0x69, 0x18, 0xAA, 0x20, 0x87, 0x18, 0x86, 0x18, 0x86, 0x18, 0x86, 0x18, 0xA5, 0x18, 0xA5, 0x18, 0x84, 0x18, 0xC5, 0x20, 0x84, 0x18, 0xA4, 0x18, 0xA5, 0x20, 0xA4, 0x18, 0xC5, 0x20, 0xC4, 0x20, 0xE5, 0x20, 0xE5, 0x20, 0xE5, 0x20,
+    0x44, 0x10, 0x64, 0x10, 0x64, 0x10, 0xA6, 0x18, 0x64, 0x08, 0x65, 0x10, 0x86, 0x10, 0x86, 0x18, 0x87, 0x18, 0x87, 0x18, 0x47, 0x10, 0x88, 0x18, 0x88, 0x18, 0x50, 0x52, 0x67, 0x10, 0x87, 0x18, 0x66, 0x10, 0x87, 0x10, 0x46, 0x10, 0x86, 0x10, 0xC7, 0x18, 0x86, 0x18, 0x86, 0x18, 0x49, 0x31, 0x85, 0x18, 0x85, 0x18, 0x07, 0x29, 0x0C, 0x42, 0xC5, 0x20, 0x06, 0x29, 0xC6, 0x20, 0x64, 0x10,
+    0x0B, 0x42, 0x85, 0x18, 0x84, 0x10, 0x84, 0x10, 0x85, 0x18, 0xA5, 0x18, 0x84, 0x10, 0x64, 0x10, 0xC5, 0x20, 0xEB, 0x41, 0xA5, 0x18, 0x84, 0x18, 0xA4, 0x18, 0x48, 0x31, 0xCB, 0x39, 0x64, 0x10, 0x64, 0x18, 0x84, 0x18, 0x48, 0x31, 0xA6, 0x18, 0x85, 0x18, 0x85, 0x18, 0x6A, 0x39, 0xCB, 0x39, 0x86, 0x18, 0x86, 0x18, 0x86, 0x18, 0x86, 0x18, 0x6C, 0x31, 0x66, 0x18, 0x87, 0x18, 0x87, 0x18,
+    0x6A, 0x39, 0xA6, 0x20, 0x85, 0x18, 0x85, 0x18, 0xA5, 0x18, 0x89, 0x39, 0xC5, 0x18, 0x84, 0x18, 0x84, 0x18, 0x84, 0x18, 0x88, 0x39, 0xA4, 0x18, 0xC4, 0x18, 0xC4, 0x20, 0xC4, 0x20, 0xE4, 0x20, 0x64, 0x10, 0x64, 0x10, 0x85, 0x10, 0x28, 0x29, 0x85, 0x10, 0x65, 0x10, 0x65, 0x10, 0x86, 0x18, 0xEC, 0x39, 0x86, 0x10, 0x87, 0x18, 0x87, 0x10, 0xC8, 0x18, 0x4B, 0x29, 0x87, 0x18, 0x66, 0x10,
+    0x46, 0x10, 0x86, 0x18, 0x86, 0x10, 0x86, 0x10, 0x65, 0x10, 0x85, 0x10, 0x85, 0x18, 0xC6, 0x18, 0xA5, 0x18, 0x85, 0x18, 0xA5, 0x18, 0xA6, 0x18, 0x85, 0x18, 0x64, 0x10, 0x84, 0x18, 0xA5, 0x18, 0x84, 0x10, 0xA5, 0x18, 0x84, 0x10, 0x84, 0x10, 0x84, 0x18, 0x84, 0x10, 0x64, 0x10, 0x84, 0x10, 0xC5, 0x20, 0xA5, 0x18, 0xA4, 0x18, 0x84, 0x18, 0x43, 0x10, 0x64, 0x10, 0x84, 0x18, 0x85, 0x18,
+    0xA4, 0x18, 0x84, 0x18, 0x85, 0x18, 0xA5, 0x18, 0xA5, 0x18, 0x85, 0x18, 0x85, 0x18, 0x85, 0x18, 0x86, 0x18, 0x45, 0x10, 0x86, 0x18, 0x86, 0x18, 0x66, 0x18, 0x66, 0x18, 0x47, 0x10, 0x66, 0x18, 0x65, 0x18, 0x65, 0x18, 0x85, 0x18, 0x64, 0x10, 0x84, 0x10, 0x64, 0x10, 0xA4, 0x18, 0x84, 0x18, 0x84, 0x18, 0x63, 0x10, 0xC4, 0x18, 0x26, 0x29, 0xA4, 0x18, 0xC4, 0x20, 0xE4, 0x20, 0xE4, 0x20,
+    0x64, 0x10, 0x44, 0x10, 0x24, 0x08, 0x64, 0x10, 0x44, 0x10, 0x65, 0x10, 0x8A, 0x39, 0xAC, 0x39, 0x86, 0x18, 0x85, 0x10, 0x66, 0x10, 0xEC, 0x20, 0xD2, 0x28, 0xA8, 0x18, 0x86, 0x10, 0x86, 0x18, 0xB1, 0x39, 0x4B, 0x31, 0xA6, 0x18, 0xA6, 0x18, 0x86, 0x18, 0x85, 0x10, 0x08, 0x29, 0xA5, 0x18, 0xA5, 0x18, 0x85, 0x10, 0x86, 0x18, 0x89, 0x39, 0x48, 0x39, 0x85, 0x18, 0x47, 0x31, 0x49, 0x29,
+    0x26, 0x29, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x0C, 0x42, 0x84, 0x10, 0x64, 0x10, 0x84, 0x10, 0xC5, 0x18, 0x2C, 0x4A, 0xC6, 0x20, 0x84, 0x10, 0x84, 0x18, 0x84, 0x10, 0x2C, 0x4A, 0x27, 0x31, 0x84, 0x18, 0x64, 0x10, 0xA5, 0x20, 0x6A, 0x31, 0xE6, 0x20, 0x44, 0x10, 0x85, 0x18, 0x65, 0x18, 0x5C, 0x0C, 0x66, 0x18, 0x86, 0x18, 0x85, 0x10, 0x87, 0x18, 0xBC, 0x00, 0xAA, 0x20, 0x85, 0x18,
+    0xEB, 0x41, 0x64, 0x10, 0x5A, 0x31, 0x64, 0x18, 0x84, 0x18, 0x64, 0x10, 0x84, 0x18, 0xA9, 0x39, 0x63, 0x10, 0x43, 0x10, 0xE5, 0x20, 0x87, 0x39, 0x89, 0x31, 0xA4, 0x18, 0xE4, 0x20, 0xC4, 0x18, 0x23, 0x08, 0x0C, 0x4A, 0x64, 0x10, 0x64, 0x10, 0x44, 0x10, 0x85, 0x18, 0x85, 0x10, 0x85, 0x10, 0x65, 0x10, 0x86, 0x10, 0x45, 0x08, 0x17, 0x00, 0x6C, 0x08, 0xA7, 0x18, 0x65, 0x10, 0x86, 0x18,
+    0x88, 0x10, 0x86, 0x18, 0x86, 0x10, 0x65, 0x10, 0x85, 0x10, 0x85, 0x18, 0xA5, 0x18, 0xA5, 0x18, 0x85, 0x18, 0xA5, 0x18, 0xA5, 0x18, 0x84, 0x10, 0xA5, 0x18, 0x84, 0x10, 0x84, 0x10, 0xA5, 0x18, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0xA4, 0x18, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x63, 0x10, 0xA4, 0x18, 0x84, 0x10, 0x84, 0x10, 0x83, 0x10, 0x83, 0x10, 0xA4, 0x18, 0x84, 0x18, 0x64, 0x10,
+    0x84, 0x18, 0x84, 0x18, 0x84, 0x18, 0x84, 0x10, 0x84, 0x18, 0xA5, 0x18, 0x85, 0x18, 0x85, 0x18, 0x85, 0x18, 0x85, 0x18, 0x65, 0x10, 0x65, 0x10, 0x65, 0x10, 0x68, 0x10, 0x66, 0x18, 0xA6, 0x18, 0x64, 0x10, 0x64, 0x10, 0x85, 0x18, 0x64, 0x10, 0x64, 0x10, 0x43, 0x10, 0x64, 0x10, 0x63, 0x10, 0x84, 0x18, 0x63, 0x10, 0x84, 0x18, 0x83, 0x10, 0x83, 0x10, 0xA4, 0x18, 0x83, 0x10, 0x83, 0x18,
 };
 const lv_img_dsc_t ui_img_scroller_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_scroller_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_scroller_80_png_data
 };
 
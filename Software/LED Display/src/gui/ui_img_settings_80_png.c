@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Settings_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_settings_80_png_data[] = {
-    0x00, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF,
-    0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x41, 0x10, 0xFF,
-    0x41, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF,
-    0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF,
-    0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x28, 0xFF,
-    0xA1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF,
-    0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF,
-    0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF,
-    0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xC3, 0x61, 0xFF, 0x04, 0x6A, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x69, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF,
-    0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF,
-    0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x62, 0x49, 0xFF, 0xA3, 0x59, 0xFF, 0x04, 0x6A, 0xFF, 0x85, 0x82, 0xFF, 0xE6, 0x9A, 0xFF, 0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x06, 0xA3, 0xFF, 0xA5, 0x92, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0x04, 0x6A, 0xFF, 0xE3, 0x61, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF,
-    0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0xE4, 0x61, 0xFF, 0x65, 0x82, 0xFF, 0xA5, 0x92, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x65, 0x7A, 0xFF, 0x67, 0xBB, 0xFF, 0xE6, 0x9A, 0xFF, 0x85, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x69, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF,
-    0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0x04, 0x6A, 0xFF, 0xA5, 0x92, 0xFF, 0xC1, 0x28, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xE9, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0xC5, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x08, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x62, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x51, 0xFF, 0xA3, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0xC3, 0x59, 0xFF, 0xC3, 0x61, 0xFF, 0xE3, 0x61, 0xFF, 0x24, 0x72, 0xFF, 0xA5, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0x18, 0xFF, 0xE9, 0xCB, 0xFF, 0x46, 0xB3, 0xFF,
-    0xC5, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x63, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x41, 0xFF, 0x62, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0xC3, 0x61, 0xFF, 0xE3, 0x61, 0xFF, 0x04, 0x6A, 0xFF, 0x24, 0x72, 0xFF, 0x24, 0x72, 0xFF, 0x24, 0x72, 0xFF, 0x24, 0x7A, 0xFF, 0x24, 0x72, 0xFF, 0x24, 0x7A, 0xFF, 0x44, 0x7A, 0xFF, 0x45, 0x7A, 0xFF,
-    0x64, 0x82, 0xFF, 0xA5, 0x92, 0xFF, 0x47, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x8C, 0xD4, 0xFF, 0xA8, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0xA5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF,
-    0x22, 0x39, 0xFF, 0x63, 0x49, 0xFF, 0xC3, 0x61, 0xFF, 0x24, 0x72, 0xFF, 0x65, 0x82, 0xFF, 0x85, 0x8A, 0xFF, 0xC5, 0x92, 0xFF, 0xE6, 0x9A, 0xFF, 0x06, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x06, 0xA3, 0xFF, 0x06, 0xA3, 0xFF, 0x06, 0xA3, 0xFF, 0x46, 0xB3, 0xFF, 0xE9, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x45, 0x72, 0xFF, 0x0A, 0xCC, 0xFF, 0x67, 0xBB, 0xFF, 0xC5, 0x9A, 0xFF, 0x64, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF,
-    0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x83, 0x51, 0xFF, 0x04, 0x6A, 0xFF, 0x85, 0x8A, 0xFF, 0x06, 0xA3, 0xFF, 0x67, 0xBB, 0xFF, 0xA8, 0xC3, 0xFF, 0xE9, 0xCB, 0xFF, 0x2A, 0xCC, 0xFF, 0xE9, 0xC3, 0xFF, 0x89, 0xAB, 0xFF, 0xA9, 0xAB, 0xFF, 0xA9, 0xB3, 0xFF, 0x6C, 0xCC, 0xFF, 0x6B, 0xCC, 0xFF, 0x4B, 0xCC, 0xFF, 0xE9, 0xCB, 0xFF, 0xA8, 0xC3, 0xFF, 0xE9, 0xC3, 0xFF, 0xE7, 0x8A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0x18, 0xFF, 0x4B, 0xCC, 0xFF, 0x67, 0xBB, 0xFF, 0xE6, 0x9A, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x83, 0x51, 0xFF, 0x04, 0x72, 0xFF, 0xC5, 0x9A, 0xFF, 0x87, 0xC3, 0xFF, 0xC4, 0x59, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x8C, 0xD4, 0xFF, 0x6C, 0xCC, 0xFF, 0x89, 0xA3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0x18, 0xFF, 0x4B, 0xCC, 0xFF,
-    0x67, 0xBB, 0xFF, 0xC5, 0x9A, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x04, 0x6A, 0xFF, 0xA3, 0x59, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x2F, 0xDD, 0xFF, 0xCE, 0xD4, 0xFF, 0x0F, 0xD5, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCA, 0xAB, 0xFF, 0x2A, 0xCC, 0xFF, 0x46, 0xB3, 0xFF, 0xA5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0xA3, 0x59, 0xFF, 0xC3, 0x59, 0xFF, 0xC3, 0x59, 0xFF, 0xC3, 0x61, 0xFF, 0x45, 0x7A, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEC, 0xA3, 0xFF, 0x0F, 0xDD, 0xFF, 0x0F, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCE, 0xD4, 0xFF, 0xC8, 0xC3, 0xFF, 0x06, 0xA3, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF,
-    0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0x24, 0x72, 0xFF, 0x85, 0x8A, 0xFF, 0x85, 0x8A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0x65, 0x82, 0xFF, 0x81, 0x18, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x51, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0x30, 0xD5, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x69, 0xA3, 0xFF, 0x4B, 0xCC, 0xFF, 0x67, 0xBB, 0xFF, 0xE6, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x04, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x18, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x49, 0xFF, 0xC3, 0x61, 0xFF, 0x65, 0x82, 0xFF, 0x26, 0xAB, 0xFF, 0x40, 0x10, 0xFF, 0x87, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0xA5, 0x92, 0xFF, 0x85, 0x8A, 0xFF, 0x06, 0xA3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x2C, 0xB4, 0xFF, 0x50, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0xEF, 0xD4, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x08, 0x8B, 0xFF, 0x8C, 0xD4, 0xFF, 0xE9, 0xC3, 0xFF, 0x46, 0xB3, 0xFF,
-    0xC5, 0x92, 0xFF, 0x64, 0x82, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x62, 0x49, 0xFF, 0xE3, 0x61, 0xFF, 0xA5, 0x8A, 0xFF, 0x67, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0A, 0xCC, 0xFF, 0x67, 0xB3, 0xFF, 0xC5, 0x9A, 0xFF, 0xA5, 0x92, 0xFF, 0x04, 0x72, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x92, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0xC4, 0x51, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x22, 0x39, 0xFF, 0x30, 0xDD, 0xFF, 0xAD, 0xD4, 0xFF, 0x2A, 0xCC, 0xFF, 0xA7, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0xC5, 0x92, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xE3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x49, 0xFF, 0xE4, 0x61, 0xFF, 0xA5, 0x92, 0xFF, 0xA8, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x2B, 0xC4, 0xFF, 0x2A, 0xCC, 0xFF, 0x06, 0xAB, 0xFF,
-    0x85, 0x8A, 0xFF, 0xE6, 0x9A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x51, 0xD5, 0xFF, 0x71, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0xEE, 0xD4, 0xFF, 0x8C, 0xD4, 0xFF, 0x0A, 0xCC, 0xFF, 0xA7, 0xC3, 0xFF, 0x46, 0xB3, 0xFF, 0xE5, 0x9A, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF,
-    0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x42, 0x41, 0xFF, 0xC3, 0x61, 0xFF, 0xA5, 0x8A, 0xFF, 0xA7, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xAD, 0xD4, 0xFF, 0xA7, 0xC3, 0xFF, 0xA5, 0x8A, 0xFF, 0x85, 0x8A, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC2, 0x28, 0xFF, 0x92, 0xDD, 0xFF, 0x71, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0x08, 0x8B, 0xFF, 0x8C, 0xD4, 0xFF, 0x09, 0xCC, 0xFF, 0x87, 0xC3, 0xFF, 0x06, 0xAB, 0xFF, 0xA5, 0x92, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0x65, 0x82, 0xFF, 0x67, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x46, 0x6A, 0xFF, 0x6C, 0xCC, 0xFF, 0x06, 0xA3, 0xFF, 0x64, 0x82, 0xFF, 0xC5, 0x9A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xA1, 0x20, 0xFF, 0x02, 0x31, 0xFF, 0xC1, 0x28, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x69, 0x93, 0xFF, 0xAD, 0xD4, 0xFF, 0xE9, 0xC3, 0xFF,
-    0x67, 0xBB, 0xFF, 0x06, 0xA3, 0xFF, 0xC5, 0x92, 0xFF, 0x44, 0x82, 0xFF, 0x04, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x61, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x83, 0x51, 0xFF, 0x24, 0x72, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0F, 0xD5, 0xFF, 0xE9, 0xC3, 0xFF, 0xC5, 0x92, 0xFF, 0x85, 0x82, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0F, 0xD5, 0xFF, 0x8C, 0xD4, 0xFF, 0xC8, 0xC3, 0xFF, 0x67, 0xB3, 0xFF, 0xE6, 0xA2, 0xFF, 0x85, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x63, 0x49, 0xFF, 0xE4, 0x69, 0xFF, 0xE6, 0x9A, 0xFF, 0xC4, 0x59, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0x18, 0xFF,
-    0xCE, 0xD4, 0xFF, 0x87, 0xBB, 0xFF, 0x85, 0x8A, 0xFF, 0x85, 0x8A, 0xFF, 0xA1, 0x20, 0xFF, 0x20, 0x00, 0xFF, 0x88, 0xBB, 0xFF, 0x2A, 0xCC, 0xFF, 0x2A, 0xCC, 0xFF, 0xE9, 0xC3, 0xFF, 0xA8, 0xC3, 0xFF, 0x87, 0xBB, 0xFF, 0x67, 0xBB, 0xFF, 0x87, 0xBB, 0xFF, 0x83, 0x51, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0F, 0xDD, 0xFF, 0x6B, 0xCC, 0xFF, 0xA7, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0xC5, 0x92, 0xFF, 0x65, 0x82, 0xFF, 0x04, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF,
-    0x22, 0x39, 0xFF, 0x62, 0x49, 0xFF, 0xC3, 0x61, 0xFF, 0x85, 0x8A, 0xFF, 0xA8, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0F, 0xD5, 0xFF, 0x4B, 0xCC, 0xFF, 0xE6, 0x9A, 0xFF, 0x24, 0x72, 0xFF, 0x44, 0x7A, 0xFF, 0x85, 0x8A, 0xFF, 0xA5, 0x92, 0xFF, 0xC5, 0x92, 0xFF, 0xC6, 0x9A, 0xFF, 0xA5, 0x8A, 0xFF, 0x45, 0x7A, 0xFF, 0x44, 0x7A, 0xFF, 0x24, 0x7A, 0xFF, 0x65, 0x82, 0xFF, 0xC5, 0x92, 0xFF, 0x26, 0xAB, 0xFF, 0xA8, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0x18, 0xFF, 0xCE, 0xD4, 0xFF, 0x09, 0xCC, 0xFF, 0x67, 0xB3, 0xFF, 0xE6, 0x9A, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x7A, 0xFF, 0xE4, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF,
-    0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x44, 0x7A, 0xFF, 0x47, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x6B, 0xCC, 0xFF, 0x06, 0xAB, 0xFF, 0xE4, 0x69, 0xFF, 0xC3, 0x61, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x69, 0xFF, 0xE3, 0x61, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0xC3, 0x59, 0xFF, 0xE4, 0x69, 0xFF, 0x44, 0x7A, 0xFF, 0xA5, 0x92, 0xFF, 0x47, 0xB3, 0xFF, 0x07, 0x9B, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x30, 0xDD, 0xFF, 0x6B, 0xCC, 0xFF, 0xA8, 0xC3, 0xFF, 0x06, 0xAB, 0xFF, 0xC5, 0x92, 0xFF, 0x65, 0x82, 0xFF, 0x04, 0x6A, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0x62, 0x49, 0xFF, 0xC3, 0x61, 0xFF, 0xC5, 0x92, 0xFF, 0xE9, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x22, 0x41, 0xFF, 0x2A, 0xCC, 0xFF, 0x26, 0xAB, 0xFF, 0xE3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF,
-    0xE4, 0x61, 0xFF, 0x44, 0x7A, 0xFF, 0xE6, 0x9A, 0xFF, 0xA8, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCE, 0xD4, 0xFF, 0x09, 0xCC, 0xFF, 0x47, 0xB3, 0xFF, 0xC5, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x24, 0x72, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x46, 0x6A, 0xFF,
-    0xAD, 0xD4, 0xFF, 0xA7, 0xC3, 0xFF, 0x06, 0xA3, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0xE4, 0x69, 0xFF, 0x85, 0x8A, 0xFF, 0x67, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0xDD, 0xFF, 0x4B, 0xCC, 0xFF, 0x87, 0xBB, 0xFF, 0x06, 0xA3, 0xFF, 0x85, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x51, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x62, 0x49, 0xFF,
-    0xA3, 0x59, 0xFF, 0x65, 0x82, 0xFF, 0xA7, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC2, 0x20, 0xFF, 0xEE, 0xD4, 0xFF, 0x09, 0xCC, 0xFF, 0xC5, 0x92, 0xFF, 0x24, 0x72, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x62, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xE3, 0x61, 0xFF, 0x85, 0x82, 0xFF, 0x67, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x61, 0x18, 0xFF, 0x8C, 0xD4, 0xFF, 0xA8, 0xC3, 0xFF, 0x06, 0xAB, 0xFF, 0xA5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF,
-    0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0x04, 0x6A, 0xFF, 0xC5, 0x92, 0xFF, 0x83, 0x51, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x30, 0xDD, 0xFF, 0xE9, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0xE4, 0x61, 0xFF, 0xA5, 0x8A, 0xFF, 0x65, 0x82, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCE, 0xD4, 0xFF, 0xE9, 0xC3, 0xFF, 0x46, 0xB3, 0xFF, 0xE6, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x42, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0xE4, 0x69, 0xFF, 0x24, 0x72, 0xFF, 0x44, 0x7A, 0xFF, 0x65, 0x82, 0xFF, 0x65, 0x82, 0xFF, 0x85, 0x8A, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0xD5, 0xFF, 0xCE, 0xD4, 0xFF, 0x46, 0xB3, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF,
-    0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x04, 0x6A, 0xFF, 0xE6, 0x9A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEE, 0xD4, 0xFF, 0x2A, 0xCC, 0xFF, 0x67, 0xBB, 0xFF, 0xE6, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x41, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x62, 0x49, 0xFF, 0xE4, 0x69, 0xFF, 0x85, 0x8A, 0xFF, 0x26, 0xAB, 0xFF, 0x67, 0xBB, 0xFF, 0xA8, 0xC3, 0xFF, 0xA8, 0xC3, 0xFF, 0x87, 0xBB, 0xFF, 0x67, 0xBB, 0xFF, 0x67, 0xBB, 0xFF, 0xE9, 0xC3, 0xFF, 0x63, 0x41, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x30, 0xDD, 0xFF, 0x8C, 0xCC, 0xFF, 0xE6, 0x9A, 0xFF,
-    0x04, 0x6A, 0xFF, 0xE4, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x44, 0x7A, 0xFF, 0x46, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0x39, 0xFF, 0x6B, 0xCC, 0xFF, 0x87, 0xBB, 0xFF, 0x06, 0xA3, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x41, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x63, 0x49, 0xFF, 0x24, 0x72, 0xFF, 0x06, 0xA3, 0xFF, 0x62, 0x49, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x43, 0x41, 0xFF, 0x4B, 0xCC, 0xFF, 0x2A, 0xCC, 0xFF, 0x8C, 0xD4, 0xFF, 0x20, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xCC, 0xFF, 0xEE, 0xD4, 0xFF, 0x2A, 0xCC, 0xFF, 0x65, 0x82, 0xFF, 0xE4, 0x61, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x49, 0xFF, 0xE4, 0x61, 0xFF, 0xC5, 0x9A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x8C, 0xD4, 0xFF, 0xA8, 0xC3, 0xFF, 0x06, 0xA3, 0xFF, 0xA5, 0x92, 0xFF, 0x24, 0x7A, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF,
-    0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xE1, 0x30, 0xFF, 0x42, 0x49, 0xFF, 0x24, 0x72, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCE, 0xD4, 0xFF, 0x8D, 0xD4, 0xFF, 0x0F, 0xD5, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x51, 0xDD, 0xFF, 0xAD, 0xD4, 0xFF, 0x26, 0xAB, 0xFF, 0xE3, 0x69, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x64, 0x82, 0xFF, 0xE2, 0x30, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x6C, 0xCC, 0xFF, 0x87, 0xBB, 0xFF, 0xE6, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x51, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0x22, 0x39, 0xFF, 0xE4, 0x69, 0xFF, 0x06, 0xA3, 0xFF, 0xC1, 0x28, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0x18, 0xFF, 0xEF, 0xD4, 0xFF, 0xEF, 0xD4, 0xFF, 0x06, 0x62, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0F, 0xDD, 0xFF, 0x09, 0xCC, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x69, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF,
-    0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x62, 0x49, 0xFF, 0x04, 0x6A, 0xFF, 0xE6, 0x9A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0A, 0xCC, 0xFF, 0x26, 0xAB, 0xFF, 0xA5, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x51, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xE2, 0x28, 0xFF, 0x63, 0x49, 0xFF, 0x85, 0x8A, 0xFF, 0xA8, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x51, 0xDD, 0xFF, 0x0F, 0xD5, 0xFF, 0x51, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0x31, 0xFF, 0x8C, 0xD4, 0xFF, 0x46, 0xB3, 0xFF, 0x04, 0x72, 0xFF, 0xE4, 0x69, 0xFF,
-    0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0x44, 0x7A, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x47, 0xB3, 0xFF, 0xC5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xE1, 0x28, 0xFF, 0xA3, 0x59, 0xFF, 0xE6, 0x9A, 0xFF, 0x07, 0x9B, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xAB, 0x9B, 0xFF, 0x30, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEC, 0x9B, 0xFF, 0x6C, 0xD4, 0xFF, 0xA5, 0x92, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x61, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x62, 0x49, 0xFF, 0xC3, 0x59, 0xFF, 0x24, 0x72, 0xFF, 0x85, 0x8A, 0xFF, 0xC5, 0x9A, 0xFF, 0xE6, 0xA2, 0xFF, 0x06, 0xA3, 0xFF, 0x06, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x06, 0xA3, 0xFF, 0xE6, 0x9A, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF,
-    0x61, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xE2, 0x30, 0xFF, 0xC3, 0x61, 0xFF, 0x26, 0xA3, 0xFF, 0x04, 0x72, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x43, 0x41, 0xFF, 0x50, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x6E, 0xB4, 0xFF, 0x87, 0xC3, 0xFF, 0x24, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x61, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0xA3, 0x59, 0xFF, 0xE4, 0x61, 0xFF, 0x04, 0x72, 0xFF, 0x24, 0x72, 0xFF, 0x24, 0x7A, 0xFF, 0x24, 0x7A, 0xFF, 0x44, 0x7A, 0xFF,
-    0x44, 0x7A, 0xFF, 0x44, 0x7A, 0xFF, 0x24, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xE2, 0x30, 0xFF, 0xC3, 0x61, 0xFF, 0x26, 0xAB, 0xFF, 0xA6, 0x82, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x45, 0x72, 0xFF, 0x50, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x2E, 0xAC, 0xFF, 0x6C, 0xCC, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xE3, 0x61, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF,
-    0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0xC3, 0x61, 0xFF, 0x04, 0x72, 0xFF, 0x44, 0x7A, 0xFF, 0x44, 0x7A, 0xFF, 0x65, 0x82, 0xFF, 0x65, 0x82, 0xFF, 0x64, 0x82, 0xFF, 0x85, 0x82, 0xFF, 0x65, 0x82, 0xFF, 0x45, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0x02, 0x31, 0xFF, 0xC3, 0x59, 0xFF, 0xE6, 0xA2, 0xFF, 0x0A, 0xCC, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0F, 0xD5, 0xFF, 0x30, 0xDD, 0xFF, 0x71, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x86, 0x82, 0xFF, 0xAE, 0xD4, 0xFF, 0xA5, 0x8A, 0xFF, 0x04, 0x6A, 0xFF, 0xE4, 0x61, 0xFF,
-    0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x63, 0x49, 0xFF, 0x04, 0x6A, 0xFF, 0x85, 0x8A, 0xFF, 0xE6, 0x9A, 0xFF, 0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x46, 0xB3, 0xFF, 0x46, 0xB3, 0xFF, 0x67, 0xB3, 0xFF, 0x67, 0xBB, 0xFF, 0x47, 0xB3, 0xFF, 0x06, 0xA3, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0x02, 0x31, 0xFF, 0xA3, 0x51, 0xFF, 0xA5, 0x92, 0xFF, 0xA7, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x50, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0xEF, 0xCC, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x10, 0xFF, 0x30, 0xDD, 0xFF, 0x87, 0xBB, 0xFF, 0x24, 0x72, 0xFF, 0xE3, 0x61, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x42, 0x41, 0xFF, 0xC3, 0x61, 0xFF, 0x85, 0x8A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x26, 0xAB, 0xFF, 0x85, 0x82, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF,
-    0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xC1, 0x20, 0xFF, 0xE1, 0x30, 0xFF, 0x63, 0x49, 0xFF, 0x44, 0x7A, 0xFF, 0x06, 0xA3, 0xFF, 0xC8, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x30, 0xD5, 0xFF, 0xEF, 0xD4, 0xFF, 0x30, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x51, 0xDD, 0xFF, 0x4B, 0xCC, 0xFF, 0x85, 0x8A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x63, 0x49, 0xFF, 0x04, 0x72, 0xFF, 0x44, 0x7A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xC3, 0xFF, 0xC5, 0x9A, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xE1, 0x28, 0xFF, 0x22, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0x24, 0x72, 0xFF, 0xE6, 0x9A, 0xFF, 0xA8, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEF, 0xD4, 0xFF, 0xEE, 0xD4, 0xFF, 0xCE, 0xD4, 0xFF, 0x8E, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x72, 0xDD, 0xFF, 0xCE, 0xD4, 0xFF, 0x46, 0xB3, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF,
-    0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0xA3, 0x59, 0xFF, 0x85, 0x82, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC8, 0xC3, 0xFF, 0x06, 0xA3, 0xFF, 0x85, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x83, 0x49, 0xFF, 0xE4, 0x69, 0xFF, 0x85, 0x8A, 0xFF, 0x46, 0xAB, 0xFF, 0x85, 0x8A, 0xFF, 0x20, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x28, 0x9B, 0xFF, 0x6B, 0xCC, 0xFF, 0x4B, 0xCC, 0xFF, 0x8C, 0xD4, 0xFF, 0xEF, 0xD4, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0x31, 0xFF, 0x0F, 0xDD, 0xFF, 0xE9, 0xC3, 0xFF, 0x85, 0x82, 0xFF,
-    0xE4, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x49, 0xFF, 0x04, 0x6A, 0xFF, 0xE6, 0xA2, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC8, 0xC3, 0xFF, 0x06, 0xA3, 0xFF, 0x85, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0x04, 0x72, 0xFF, 0x85, 0x82, 0xFF, 0xC6, 0x9A, 0xFF, 0x06, 0xA3, 0xFF, 0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF,
-    0x46, 0xB3, 0xFF, 0xA7, 0xC3, 0xFF, 0x0A, 0xC4, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x51, 0xDD, 0xFF, 0x8C, 0xD4, 0xFF, 0x26, 0xAB, 0xFF, 0x04, 0x72, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0x85, 0x82, 0xFF, 0xE2, 0x30, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x08, 0x93, 0xFF, 0xC8, 0xC3, 0xFF, 0x06, 0xA3, 0xFF, 0x85, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF,
-    0x41, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xC3, 0x59, 0xFF, 0xE4, 0x61, 0xFF, 0x04, 0x6A, 0xFF, 0x24, 0x72, 0xFF, 0x65, 0x82, 0xFF, 0x06, 0xA3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0x18, 0xFF, 0x0F, 0xD5, 0xFF, 0xA7, 0xC3, 0xFF, 0x65, 0x82, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x24, 0x72, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCD, 0xD4, 0xFF, 0xA7, 0xC3, 0xFF, 0xE6, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x51, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xE4, 0x69, 0xFF, 0xA5, 0x92, 0xFF, 0xA8, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xCC, 0xFF, 0x8C, 0xD4, 0xFF, 0x06, 0xA3, 0xFF, 0x24, 0x72, 0xFF, 0xC4, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF,
-    0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x04, 0x72, 0xFF, 0xE5, 0x9A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x6C, 0xCC, 0xFF, 0x47, 0xB3, 0xFF, 0xA5, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0xC3, 0x59, 0xFF, 0x65, 0x82, 0xFF, 0x67, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x30, 0xDD, 0xFF,
-    0x2A, 0xCC, 0xFF, 0x06, 0xAB, 0xFF, 0x44, 0x7A, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0x04, 0x6A, 0xFF, 0xC5, 0x92, 0xFF, 0x81, 0x18, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCA, 0xB3, 0xFF, 0x09, 0xCC, 0xFF, 0x06, 0xA3, 0xFF, 0x65, 0x82, 0xFF, 0x04, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF,
-    0x83, 0x51, 0xFF, 0x04, 0x6A, 0xFF, 0xE6, 0xA2, 0xFF, 0xE4, 0x61, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEE, 0xD4, 0xFF, 0x09, 0xCC, 0xFF, 0xC6, 0x92, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xC3, 0x59, 0xFF, 0x24, 0x72, 0xFF, 0xE6, 0x9A, 0xFF, 0xC1, 0x28, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xAD, 0xD4, 0xFF, 0x87, 0xC3, 0xFF, 0xC5, 0x9A, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xC3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF,
-    0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x62, 0x49, 0xFF, 0xA3, 0x59, 0xFF, 0x65, 0x82, 0xFF, 0x87, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x4B, 0xCC, 0xFF, 0x06, 0xA3, 0xFF, 0xE4, 0x69, 0xFF, 0xC3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0xC3, 0x61, 0xFF, 0x04, 0x72, 0xFF, 0x85, 0x8A, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x08, 0x8B, 0xFF, 0x4B, 0xCC, 0xFF, 0x47, 0xB3, 0xFF, 0xC5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x63, 0x51, 0xFF, 0xE4, 0x69, 0xFF, 0xC6, 0x9A, 0xFF, 0xC6, 0x92, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xA7, 0x7A, 0xFF, 0x6C, 0xCC, 0xFF, 0x06, 0xAB, 0xFF, 0x24, 0x72, 0xFF, 0x04, 0x72, 0xFF, 0x24, 0x7A, 0xFF, 0x24, 0x72, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x69, 0xFF, 0x04, 0x6A, 0xFF, 0x24, 0x72, 0xFF, 0x44, 0x7A, 0xFF, 0xA5, 0x8A, 0xFF,
-    0x06, 0xA3, 0xFF, 0x06, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCE, 0xD4, 0xFF, 0xC8, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0xA5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x24, 0x72, 0xFF, 0x26, 0xAB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0xEF, 0xD4, 0xFF, 0xE9, 0xCB, 0xFF, 0xE6, 0x9A, 0xFF, 0x85, 0x82, 0xFF, 0x85, 0x82, 0xFF, 0x06, 0xA3, 0xFF, 0x26, 0xAB, 0xFF, 0x06, 0xAB, 0xFF, 0xE6, 0x9A, 0xFF, 0xE6, 0x9A, 0xFF, 0x06, 0xA3, 0xFF, 0x06, 0xA3, 0xFF, 0x06, 0xA3, 0xFF, 0x26, 0xAB, 0xFF, 0x87, 0xBB, 0xFF, 0x27, 0xA3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEE, 0xD4, 0xFF, 0x4B, 0xCC, 0xFF, 0x87, 0xC3, 0xFF, 0x06, 0xA3, 0xFF, 0xA5, 0x92, 0xFF, 0x44, 0x82, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF,
-    0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0x65, 0x82, 0xFF, 0x87, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCE, 0xCC, 0xFF, 0x8C, 0xD4, 0xFF, 0x67, 0xBB, 0xFF, 0xC5, 0x92, 0xFF, 0xE6, 0xA2, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x63, 0x49, 0xFF, 0xA7, 0x82, 0xFF, 0xC7, 0x82, 0xFF, 0x04, 0x6A, 0xFF, 0x61, 0x10, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0x39, 0xFF, 0xAD, 0xD4, 0xFF, 0xE9, 0xCB, 0xFF, 0x47, 0xB3, 0xFF, 0xE6, 0xA2, 0xFF, 0xA5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x61, 0x18, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x49, 0xFF, 0xE4, 0x61, 0xFF, 0xC5, 0x92, 0xFF, 0x67, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEE, 0xD4, 0xFF, 0x0A, 0xCC, 0xFF, 0x26, 0xAB, 0xFF, 0xE6, 0x9A, 0xFF, 0xC3, 0x61, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEE, 0xD4, 0xFF, 0x2A, 0xCC, 0xFF,
-    0xA7, 0xC3, 0xFF, 0x46, 0xB3, 0xFF, 0xE6, 0xA2, 0xFF, 0x85, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x61, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x83, 0x51, 0xFF, 0x24, 0x72, 0xFF, 0x06, 0xA3, 0xFF, 0x04, 0x6A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x0F, 0xD5, 0xFF, 0x6C, 0xD4, 0xFF, 0x87, 0xC3, 0xFF, 0x06, 0xA3, 0xFF, 0x46, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x03, 0x31, 0xFF, 0x92, 0xDD, 0xFF, 0x71, 0xDD, 0xFF, 0x71, 0xDD, 0xFF, 0x71, 0xDD, 0xFF, 0x92, 0xDD, 0xFF, 0xE5, 0x59, 0xFF, 0x00, 0x00, 0xFF, 0xEE, 0xD4, 0xFF, 0x4B, 0xCC, 0xFF, 0xC8, 0xC3, 0xFF, 0x47, 0xB3, 0xFF, 0x06, 0xA3, 0xFF, 0xC5, 0x9A, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0xA3, 0x59, 0xFF, 0x65, 0x82, 0xFF, 0x46, 0xB3, 0xFF, 0x63, 0x49, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xE2, 0x28, 0xFF, 0x8D, 0xD4, 0xFF, 0xE9, 0xC3, 0xFF,
-    0x26, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x60, 0x10, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x71, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0x0F, 0xD5, 0xFF, 0xCD, 0xD4, 0xFF, 0x4B, 0xCC, 0xFF, 0xC8, 0xC3, 0xFF, 0x67, 0xBB, 0xFF, 0x26, 0xAB, 0xFF, 0xE6, 0x9A, 0xFF, 0xA5, 0x8A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF,
-    0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x63, 0x49, 0xFF, 0xE4, 0x61, 0xFF, 0xA5, 0x8A, 0xFF, 0x67, 0xB3, 0xFF, 0x65, 0x7A, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCD, 0xD4, 0xFF, 0x0A, 0xCC, 0xFF, 0x67, 0xBB, 0xFF, 0x26, 0xAB, 0xFF, 0x87, 0xBB, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x63, 0x41, 0xFF, 0x71, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x71, 0xDD, 0xFF, 0x10, 0xCD, 0xFF, 0x28, 0x93, 0xFF, 0x8D, 0xC4, 0xFF, 0x51, 0xDD, 0xFF, 0x0F, 0xD5, 0xFF, 0x8D, 0xD4, 0xFF, 0x2A, 0xCC, 0xFF, 0x87, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0xE6, 0xA2, 0xFF, 0xC5, 0x92, 0xFF, 0x85, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x04, 0x6A, 0xFF, 0xA5, 0x8A, 0xFF, 0x46, 0xB3, 0xFF, 0x68, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0xE7, 0x92, 0xFF, 0xE9, 0xCB, 0xFF, 0x67, 0xBB, 0xFF, 0x06, 0xA3, 0xFF, 0x46, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x10, 0xFF, 0x71, 0xDD, 0xFF, 0x50, 0xDD, 0xFF, 0x71, 0xDD, 0xFF, 0xE2, 0x28, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0xEF, 0xD4, 0xFF, 0x4B, 0xCC, 0xFF, 0x87, 0xC3, 0xFF, 0x06, 0xAB, 0xFF,
-    0xA5, 0x92, 0xFF, 0x85, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x72, 0xFF, 0xE4, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0x04, 0x6A, 0xFF, 0x85, 0x8A, 0xFF, 0xE6, 0xA2, 0xFF, 0x46, 0xB3, 0xFF, 0x87, 0xBB, 0xFF, 0x26, 0xAB, 0xFF, 0xC5, 0x9A, 0xFF, 0xC5, 0x9A, 0xFF, 0x06, 0xA3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x71, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0x51, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xCE, 0xD4, 0xFF, 0xE9, 0xC3, 0xFF, 0x26, 0xAB, 0xFF, 0xA5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0x24, 0x72, 0xFF, 0xE3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x83, 0x51, 0xFF, 0xE4, 0x61, 0xFF, 0x24, 0x72, 0xFF, 0x85, 0x8A, 0xFF, 0xA5, 0x92, 0xFF, 0x85, 0x8A, 0xFF, 0x64, 0x82, 0xFF, 0xA5, 0x92, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC1, 0x20, 0xFF, 0x50, 0xDD, 0xFF, 0x30, 0xDD, 0xFF, 0xE2, 0x28, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x4B, 0xCC, 0xFF, 0x67, 0xBB, 0xFF, 0xC5, 0x92, 0xFF, 0x44, 0x7A, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF,
-    0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x69, 0xFF, 0xE4, 0x61, 0xFF, 0xE4, 0x69, 0xFF, 0xC3, 0x61, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x51, 0xDD, 0xFF, 0x0F, 0xD5, 0xFF, 0x50, 0xDD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x8D, 0xCC, 0xFF, 0xA8, 0xC3, 0xFF, 0xE6, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x04, 0x6A, 0xFF, 0xC3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE2, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x10, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0xE4, 0x69, 0xFF, 0x85, 0x8A, 0xFF, 0x46, 0xAB, 0xFF, 0x20, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xEE, 0xD4, 0xFF, 0xCE, 0xD4, 0xFF, 0x8D, 0xCC, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x43, 0x39, 0xFF, 0xE9, 0xCB, 0xFF,
-    0x06, 0xA3, 0xFF, 0x85, 0x82, 0xFF, 0x04, 0x72, 0xFF, 0xC3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xE2, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0xC4, 0x61, 0xFF, 0x65, 0x82, 0xFF, 0x26, 0xAB, 0xFF, 0xC8, 0xC3, 0xFF, 0x2A, 0xCC, 0xFF, 0x48, 0xA3, 0xFF, 0xA1, 0x20, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x60, 0x10, 0xFF, 0x45, 0x72, 0xFF, 0x4B, 0xCC, 0xFF,
-    0x4B, 0xCC, 0xFF, 0x4B, 0xCC, 0xFF, 0x29, 0x93, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0x18, 0xFF, 0x0A, 0xCC, 0xFF, 0x26, 0xAB, 0xFF, 0x85, 0x8A, 0xFF, 0x04, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF,
-    0x63, 0x49, 0xFF, 0xC3, 0x61, 0xFF, 0x44, 0x7A, 0xFF, 0xC5, 0x92, 0xFF, 0xE6, 0xA2, 0xFF, 0x06, 0xAB, 0xFF, 0x26, 0xAB, 0xFF, 0x47, 0xB3, 0xFF, 0x87, 0xBB, 0xFF, 0xA7, 0xC3, 0xFF, 0xE9, 0xC3, 0xFF, 0x2A, 0xCC, 0xFF, 0x2A, 0xCC, 0xFF, 0x2A, 0xCC, 0xFF, 0x09, 0xCC, 0xFF, 0xA8, 0xC3, 0xFF, 0x67, 0xBB, 0xFF, 0xA8, 0xC3, 0xFF, 0xA9, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xA2, 0x18, 0xFF, 0x2A, 0xCC, 0xFF, 0x26, 0xAB, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xC4, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF,
-    0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x22, 0x39, 0xFF, 0x63, 0x49, 0xFF, 0xC3, 0x59, 0xFF, 0xE4, 0x69, 0xFF, 0x04, 0x72, 0xFF, 0x04, 0x72, 0xFF, 0x24, 0x72, 0xFF, 0x44, 0x7A, 0xFF, 0x65, 0x82, 0xFF, 0x85, 0x8A, 0xFF, 0xC5, 0x9A, 0xFF, 0x26, 0xA3, 0xFF, 0x46, 0xB3, 0xFF, 0x46, 0xB3, 0xFF, 0x26, 0xAB, 0xFF, 0x06, 0xA3, 0xFF, 0xE6, 0x9A, 0xFF, 0x26, 0xAB, 0xFF, 0xE9, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x4C, 0xBC, 0xFF, 0xE9, 0xCB, 0xFF, 0x26, 0xAB, 0xFF, 0xA5, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x41, 0xFF, 0x62, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0xE3, 0x61, 0xFF, 0x04, 0x72, 0xFF, 0x65, 0x82, 0xFF, 0xA5, 0x8A, 0xFF, 0xA5, 0x92, 0xFF, 0x85, 0x8A, 0xFF, 0x65, 0x82, 0xFF, 0x65, 0x82, 0xFF, 0xA5, 0x8A, 0xFF, 0x46, 0xB3, 0xFF, 0x20, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x8C, 0xCC, 0xFF, 0xA7, 0xC3, 0xFF,
-    0x06, 0xA3, 0xFF, 0x85, 0x8A, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0xE4, 0x69, 0xFF, 0x24, 0x72, 0xFF, 0x44, 0x7A, 0xFF, 0x24, 0x72, 0xFF, 0x04, 0x6A, 0xFF,
-    0x04, 0x6A, 0xFF, 0x24, 0x72, 0xFF, 0xA5, 0x8A, 0xFF, 0x67, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xAD, 0xD4, 0xFF, 0xE9, 0xCB, 0xFF, 0x46, 0xB3, 0xFF, 0xE5, 0x9A, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xC3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF,
-    0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0xA3, 0x59, 0xFF, 0xC3, 0x59, 0xFF, 0xC3, 0x61, 0xFF, 0xC3, 0x61, 0xFF, 0xC3, 0x59, 0xFF, 0xC3, 0x59, 0xFF, 0xC3, 0x61, 0xFF, 0x04, 0x72, 0xFF, 0x85, 0x8A, 0xFF, 0x46, 0xB3, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x6C, 0xCC, 0xFF, 0xE9, 0xCB, 0xFF, 0x67, 0xBB, 0xFF, 0x06, 0xA3, 0xFF, 0xA5, 0x8A, 0xFF, 0x44, 0x7A, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF,
-    0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0xC3, 0x61, 0xFF, 0x44, 0x82, 0xFF, 0xE6, 0x9A, 0xFF, 0x67, 0xB3, 0xFF, 0x22, 0x41, 0xFF, 0x60, 0x10, 0xFF, 0x22, 0x39, 0xFF, 0x2B, 0xC4, 0xFF, 0x0A, 0xCC, 0xFF, 0x87, 0xC3, 0xFF, 0x46, 0xB3, 0xFF, 0xE6, 0xA2, 0xFF, 0xA5, 0x92, 0xFF, 0x65, 0x82, 0xFF, 0x24, 0x72, 0xFF, 0xE4, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x42, 0x49, 0xFF, 0x22, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x08, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0xA3, 0x59, 0xFF, 0x04, 0x6A, 0xFF, 0x65, 0x82, 0xFF, 0xC6, 0x92, 0xFF, 0x06, 0xA3, 0xFF, 0x46, 0xAB, 0xFF, 0x46, 0xB3, 0xFF, 0x26, 0xAB, 0xFF, 0xE6, 0xA2, 0xFF, 0xA5, 0x92, 0xFF, 0x85, 0x8A, 0xFF, 0x64, 0x7A, 0xFF,
-    0x24, 0x72, 0xFF, 0xE4, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF,
-    0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0xA3, 0x59, 0xFF, 0xE4, 0x69, 0xFF, 0x24, 0x72, 0xFF, 0x44, 0x7A, 0xFF, 0x65, 0x82, 0xFF, 0x65, 0x82, 0xFF, 0x65, 0x82, 0xFF, 0x44, 0x7A, 0xFF, 0x24, 0x72, 0xFF, 0x04, 0x6A, 0xFF, 0xE4, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF,
-    0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xA3, 0x59, 0xFF, 0xC3, 0x61, 0xFF, 0xE4, 0x69, 0xFF, 0x04, 0x6A, 0xFF, 0xE3, 0x69, 0xFF, 0xC3, 0x61, 0xFF, 0xA3, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0xE2, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x41, 0xFF, 0x62, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF,
-    0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x42, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x22, 0x39, 0xFF,
-    0x22, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF,
-    0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xE1, 0x28, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0xE1, 0x30, 0xFF, 0xE1, 0x30, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF,
-    0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x41, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xC1, 0x28, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF,
-    0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x20, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x61, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x80, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0xA1, 0x20, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x18, 0xFF, 0x81, 0x18, 0xFF, 0x61, 0x18, 0xFF, 0x60, 0x18, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x60, 0x10, 0xFF, 0x40, 0x10, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x20, 0x08, 0xFF,
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10,
+    0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x41, 0x10, 0x41, 0x10,
+    0x41, 0x10, 0x41, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x81, 0x18, 0x80, 0x18, 0x80, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x41, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08,
+    0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x41, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x60, 0x18, 0x60, 0x18, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18,
+    0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x61, 0x18, 0x60, 0x18, 0x61, 0x10, 0x40, 0x10, 0x41, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x60, 0x18, 0x60, 0x18,
+    0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x60, 0x18, 0x61, 0x10, 0x60, 0x10, 0x41, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x08,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10,
+    0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xA1, 0x28, 0xA1, 0x28, 0xA1, 0x28, 0xA1, 0x28, 0xA1, 0x28,
+    0xA1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x61, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0x81, 0x20, 0xA1, 0x20,
+    0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE2, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x60, 0x10, 0x60, 0x10, 0x41, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10,
+    0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x80, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x31, 0x02, 0x31, 0x02, 0x39, 0x02, 0x39, 0x02, 0x39, 0x02, 0x39,
+    0x02, 0x39, 0x02, 0x31, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x61, 0x18, 0x61, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28,
+    0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x39, 0x22, 0x39, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x61, 0x18, 0x61, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08,
+    0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18,
+    0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE2, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0x02, 0x31, 0x02, 0x39, 0x22, 0x39, 0x42, 0x49, 0x83, 0x51, 0xC3, 0x61, 0x04, 0x6A, 0xE4, 0x69, 0xE4, 0x69, 0xC3, 0x61, 0xA3, 0x59, 0xA3, 0x51, 0x83, 0x51, 0x83, 0x51,
+    0x83, 0x51, 0x63, 0x49, 0x42, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x61, 0x18, 0x60, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0xE1, 0x30, 0x02, 0x31, 0x02, 0x31, 0x02, 0x39,
+    0x02, 0x39, 0x22, 0x39, 0x22, 0x41, 0x62, 0x49, 0xA3, 0x59, 0x04, 0x6A, 0x85, 0x82, 0xE6, 0x9A, 0x26, 0xAB, 0x26, 0xAB, 0x06, 0xA3, 0xA5, 0x92, 0x65, 0x82, 0x24, 0x72, 0x04, 0x6A, 0xE3, 0x61, 0xC3, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x31, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x61, 0x18, 0x61, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20,
+    0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0x02, 0x31, 0x02, 0x39, 0x02, 0x39, 0x02, 0x39, 0x22, 0x39, 0x22, 0x39, 0x22, 0x41, 0x22, 0x41, 0x42, 0x41, 0x42, 0x41, 0x83, 0x51, 0xE4, 0x61, 0x65, 0x82, 0xA5, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x7A, 0x67, 0xBB, 0xE6, 0x9A, 0x85, 0x8A, 0x44, 0x7A,
+    0x24, 0x72, 0xE4, 0x69, 0xC3, 0x61, 0x83, 0x51, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x61, 0x10, 0x61, 0x10, 0x40, 0x10, 0x40, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x30, 0xE1, 0x30, 0x02, 0x31, 0x02, 0x31, 0x02, 0x39, 0x02, 0x39, 0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x49, 0x62, 0x49, 0x63, 0x49, 0x63, 0x51,
+    0x83, 0x51, 0xA3, 0x59, 0x04, 0x6A, 0xA5, 0x92, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xC3, 0x26, 0xAB, 0xC5, 0x9A, 0x65, 0x82, 0x24, 0x7A, 0x04, 0x6A, 0xA3, 0x59, 0x63, 0x49, 0x22, 0x41, 0x02, 0x31, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28,
+    0xE2, 0x30, 0x02, 0x39, 0x22, 0x41, 0x42, 0x41, 0x42, 0x41, 0x62, 0x49, 0x63, 0x49, 0x63, 0x51, 0x83, 0x51, 0xA3, 0x51, 0xA3, 0x51, 0xA3, 0x59, 0xA3, 0x59, 0xA3, 0x59, 0xC3, 0x59, 0xC3, 0x61, 0xE3, 0x61, 0x24, 0x72, 0xA5, 0x8A, 0x44, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0xE9, 0xCB, 0x46, 0xB3,
+    0xC5, 0x9A, 0x65, 0x82, 0x24, 0x72, 0xC3, 0x61, 0x63, 0x51, 0x42, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08,
+    0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x30, 0x22, 0x41, 0x62, 0x49, 0x83, 0x51, 0xA3, 0x59, 0xC3, 0x61, 0xE3, 0x61, 0x04, 0x6A, 0x24, 0x72, 0x24, 0x72, 0x24, 0x72, 0x24, 0x7A, 0x24, 0x72, 0x24, 0x7A, 0x44, 0x7A, 0x45, 0x7A,
+    0x64, 0x82, 0xA5, 0x92, 0x47, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xD4, 0xA8, 0xC3, 0x26, 0xAB, 0xA5, 0x92, 0x44, 0x7A, 0xE4, 0x61, 0x83, 0x51, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xE1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x60, 0x10, 0x61, 0x10, 0x40, 0x10,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE2, 0x30,
+    0x22, 0x39, 0x63, 0x49, 0xC3, 0x61, 0x24, 0x72, 0x65, 0x82, 0x85, 0x8A, 0xC5, 0x92, 0xE6, 0x9A, 0x06, 0xAB, 0x26, 0xAB, 0x26, 0xAB, 0x26, 0xAB, 0x26, 0xAB, 0x26, 0xAB, 0x06, 0xA3, 0x06, 0xA3, 0x06, 0xA3, 0x46, 0xB3, 0xE9, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x72, 0x0A, 0xCC,
+    0x67, 0xBB, 0xC5, 0x9A, 0x64, 0x7A, 0xE4, 0x69, 0x83, 0x51, 0x42, 0x41, 0x02, 0x39, 0x02, 0x31, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x61, 0x18, 0x60, 0x10, 0x60, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10,
+    0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0x22, 0x39, 0x83, 0x51, 0x04, 0x6A, 0x85, 0x8A, 0x06, 0xA3, 0x67, 0xBB, 0xA8, 0xC3, 0xE9, 0xCB, 0x2A, 0xCC, 0xE9, 0xC3, 0x89, 0xAB, 0xA9, 0xAB, 0xA9, 0xB3, 0x6C, 0xCC, 0x6B, 0xCC, 0x4B, 0xCC, 0xE9, 0xCB,
+    0xA8, 0xC3, 0xE9, 0xC3, 0xE7, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0x4B, 0xCC, 0x67, 0xBB, 0xE6, 0x9A, 0x44, 0x7A, 0xE4, 0x61, 0x83, 0x51, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x10, 0x60, 0x10,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x31, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x39, 0x83, 0x51,
+    0x04, 0x72, 0xC5, 0x9A, 0x87, 0xC3, 0xC4, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xD4, 0x6C, 0xCC, 0x89, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0x4B, 0xCC,
+    0x67, 0xBB, 0xC5, 0x9A, 0x44, 0x7A, 0xE4, 0x61, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xE1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x10, 0x60, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10,
+    0x61, 0x10, 0x60, 0x10, 0x60, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x28, 0xE2, 0x30, 0x22, 0x39, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x63, 0x49, 0x04, 0x6A, 0xA3, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xDD, 0xCE, 0xD4, 0x0F, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xAB, 0x2A, 0xCC, 0x46, 0xB3, 0xA5, 0x92, 0x44, 0x7A, 0xC3, 0x61, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x60, 0x18, 0x60, 0x10,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0x22, 0x41, 0x63, 0x49, 0xA3, 0x59, 0xC3, 0x59, 0xC3, 0x59, 0xC3, 0x61, 0x45, 0x7A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xA3, 0x0F, 0xDD, 0x0F, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xD4, 0xC8, 0xC3,
+    0x06, 0xA3, 0x85, 0x8A, 0x24, 0x72, 0xE4, 0x61, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10,
+    0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0x02, 0x39, 0x42, 0x41, 0xA3, 0x59, 0x24, 0x72, 0x85, 0x8A, 0x85, 0x8A, 0x65, 0x82, 0x24, 0x72, 0x65, 0x82, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x51, 0xDD, 0x30, 0xDD, 0x30, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xA3, 0x4B, 0xCC, 0x67, 0xBB, 0xE6, 0x9A, 0x65, 0x82, 0x04, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x63, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x18,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0x02, 0x39, 0x42, 0x49, 0xC3, 0x61, 0x65, 0x82, 0x26, 0xAB, 0x40, 0x10, 0x87, 0xC3, 0x26, 0xAB, 0xA5, 0x92, 0x85, 0x8A,
+    0x06, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xB4, 0x50, 0xDD, 0x30, 0xDD, 0xEF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8B, 0x8C, 0xD4, 0xE9, 0xC3, 0x46, 0xB3,
+    0xC5, 0x92, 0x64, 0x82, 0x04, 0x6A, 0xC3, 0x61, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x18, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18,
+    0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x62, 0x49, 0xE3, 0x61, 0xA5, 0x8A, 0x67, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCC, 0x67, 0xB3, 0xC5, 0x9A, 0xA5, 0x92, 0x04, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x92, 0xDD, 0x51, 0xDD, 0x50, 0xDD, 0x51, 0xDD, 0xC4, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x39, 0x30, 0xDD, 0xAD, 0xD4, 0x2A, 0xCC, 0xA7, 0xC3, 0x26, 0xAB, 0xC5, 0x92, 0x65, 0x82, 0x24, 0x72, 0xE3, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x62, 0x49, 0x42, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x61, 0x18,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x42, 0x49, 0xE4, 0x61, 0xA5, 0x92, 0xA8, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xC4, 0x2A, 0xCC, 0x06, 0xAB,
+    0x85, 0x8A, 0xE6, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xD5, 0x71, 0xDD, 0x50, 0xDD, 0x50, 0xDD, 0x51, 0xDD, 0x51, 0xDD, 0x50, 0xDD, 0x30, 0xDD, 0xEE, 0xD4, 0x8C, 0xD4, 0x0A, 0xCC, 0xA7, 0xC3, 0x46, 0xB3,
+    0xE5, 0x9A, 0x85, 0x8A, 0x24, 0x72, 0x04, 0x6A, 0xC3, 0x61, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x61, 0x18, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20,
+    0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x31, 0x42, 0x41, 0xC3, 0x61, 0xA5, 0x8A, 0xA7, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xD4, 0xA7, 0xC3, 0xA5, 0x8A, 0x85, 0x8A, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x28, 0x92, 0xDD, 0x71, 0xDD, 0x51, 0xDD, 0x51, 0xDD, 0x50, 0xDD, 0x51, 0xDD, 0x30, 0xDD, 0x08, 0x8B, 0x8C, 0xD4, 0x09, 0xCC, 0x87, 0xC3, 0x06, 0xAB, 0xA5, 0x92, 0x65, 0x82, 0x24, 0x72, 0xE4, 0x69, 0xA3, 0x59, 0x83, 0x51, 0x42, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x61, 0x18,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0x22, 0x41, 0xA3, 0x59, 0x65, 0x82, 0x67, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x6A, 0x6C, 0xCC,
+    0x06, 0xA3, 0x64, 0x82, 0xC5, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x20, 0x02, 0x31, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x93, 0xAD, 0xD4, 0xE9, 0xC3,
+    0x67, 0xBB, 0x06, 0xA3, 0xC5, 0x92, 0x44, 0x82, 0x04, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x63, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x61, 0x18, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28,
+    0xE1, 0x28, 0xE2, 0x30, 0x02, 0x39, 0x83, 0x51, 0x24, 0x72, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD5, 0xE9, 0xC3, 0xC5, 0x92, 0x85, 0x82, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD5, 0x8C, 0xD4, 0xC8, 0xC3, 0x67, 0xB3, 0xE6, 0xA2, 0x85, 0x8A, 0x44, 0x7A, 0xE4, 0x69, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18,
+    0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x28, 0xE2, 0x30, 0x02, 0x39, 0x63, 0x49, 0xE4, 0x69, 0xE6, 0x9A, 0xC4, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18,
+    0xCE, 0xD4, 0x87, 0xBB, 0x85, 0x8A, 0x85, 0x8A, 0xA1, 0x20, 0x20, 0x00, 0x88, 0xBB, 0x2A, 0xCC, 0x2A, 0xCC, 0xE9, 0xC3, 0xA8, 0xC3, 0x87, 0xBB, 0x67, 0xBB, 0x87, 0xBB, 0x83, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xDD,
+    0x6B, 0xCC, 0xA7, 0xC3, 0x26, 0xAB, 0xC5, 0x92, 0x65, 0x82, 0x04, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE2, 0x30,
+    0x22, 0x39, 0x62, 0x49, 0xC3, 0x61, 0x85, 0x8A, 0xA8, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD5, 0x4B, 0xCC, 0xE6, 0x9A, 0x24, 0x72, 0x44, 0x7A, 0x85, 0x8A, 0xA5, 0x92, 0xC5, 0x92, 0xC6, 0x9A, 0xA5, 0x8A, 0x45, 0x7A, 0x44, 0x7A, 0x24, 0x7A, 0x65, 0x82, 0xC5, 0x92, 0x26, 0xAB,
+    0xA8, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0xCE, 0xD4, 0x09, 0xCC, 0x67, 0xB3, 0xE6, 0x9A, 0x85, 0x8A, 0x24, 0x7A, 0xE4, 0x61, 0xA3, 0x59, 0x63, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18,
+    0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x22, 0x41, 0x83, 0x51, 0x44, 0x7A, 0x47, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6B, 0xCC, 0x06, 0xAB, 0xE4, 0x69, 0xC3, 0x61, 0xE4, 0x69, 0xE4, 0x69, 0xE4, 0x69, 0xE3, 0x61, 0xC3, 0x59, 0xA3, 0x59, 0xA3, 0x59, 0xA3, 0x59, 0xC3, 0x59, 0xE4, 0x69, 0x44, 0x7A, 0xA5, 0x92, 0x47, 0xB3, 0x07, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xDD, 0x6B, 0xCC, 0xA8, 0xC3, 0x06, 0xAB, 0xC5, 0x92, 0x65, 0x82, 0x04, 0x6A, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE2, 0x30, 0x02, 0x31, 0x22, 0x39,
+    0x62, 0x49, 0xC3, 0x61, 0xC5, 0x92, 0xE9, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x41, 0x2A, 0xCC, 0x26, 0xAB, 0xE3, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51, 0x63, 0x49, 0x63, 0x49, 0x63, 0x49, 0x63, 0x49, 0x63, 0x49, 0x83, 0x51, 0xA3, 0x59,
+    0xE4, 0x61, 0x44, 0x7A, 0xE6, 0x9A, 0xA8, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xD4, 0x09, 0xCC, 0x47, 0xB3, 0xC5, 0x9A, 0x65, 0x82, 0x24, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x42, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x18,
+    0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE2, 0x30, 0x02, 0x31, 0x22, 0x39, 0x22, 0x41, 0x83, 0x51, 0x24, 0x72, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x6A,
+    0xAD, 0xD4, 0xA7, 0xC3, 0x06, 0xA3, 0xC3, 0x61, 0x83, 0x51, 0x83, 0x51, 0x63, 0x51, 0x63, 0x49, 0x63, 0x49, 0x62, 0x49, 0x62, 0x49, 0x63, 0x49, 0x42, 0x49, 0x62, 0x49, 0x42, 0x49, 0x62, 0x49, 0x83, 0x51, 0xA3, 0x59, 0xE4, 0x69, 0x85, 0x8A, 0x67, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xDD, 0x4B, 0xCC, 0x87, 0xBB, 0x06, 0xA3, 0x85, 0x8A, 0x44, 0x7A, 0xC3, 0x61, 0xA3, 0x51, 0x42, 0x49, 0x22, 0x41, 0x02, 0x31, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0x02, 0x39, 0x02, 0x39, 0x22, 0x41, 0x62, 0x49,
+    0xA3, 0x59, 0x65, 0x82, 0xA7, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x20, 0xEE, 0xD4, 0x09, 0xCC, 0xC5, 0x92, 0x24, 0x72, 0xA3, 0x59, 0x83, 0x51, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x62, 0x49, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41,
+    0x42, 0x41, 0x62, 0x49, 0x83, 0x51, 0xE3, 0x61, 0x85, 0x82, 0x67, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x18, 0x8C, 0xD4, 0xA8, 0xC3, 0x06, 0xAB, 0xA5, 0x92, 0x44, 0x7A, 0xE4, 0x69, 0xA3, 0x59, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20,
+    0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x22, 0x41, 0x42, 0x41, 0x63, 0x49, 0x83, 0x51, 0xA3, 0x59, 0x04, 0x6A, 0xC5, 0x92, 0x83, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xDD, 0xE9, 0xC3,
+    0x26, 0xAB, 0x24, 0x72, 0xC3, 0x59, 0xA3, 0x51, 0x83, 0x51, 0x63, 0x49, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x42, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x42, 0x41, 0x42, 0x41, 0x63, 0x49, 0xE4, 0x61, 0xA5, 0x8A, 0x65, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCE, 0xD4, 0xE9, 0xC3, 0x46, 0xB3, 0xE6, 0x9A, 0x65, 0x82, 0x04, 0x6A, 0xC3, 0x59, 0x63, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x30, 0x42, 0x41, 0xA3, 0x59, 0xE4, 0x69, 0x24, 0x72, 0x44, 0x7A, 0x65, 0x82, 0x65, 0x82,
+    0x85, 0x8A, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD5, 0xCE, 0xD4, 0x46, 0xB3, 0x44, 0x7A, 0x04, 0x6A, 0xA3, 0x59, 0xA3, 0x51, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x39, 0x22, 0x39, 0x22, 0x39, 0x22, 0x39, 0x22, 0x39, 0x22, 0x39,
+    0x02, 0x39, 0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x83, 0x51, 0x04, 0x6A, 0xE6, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xD4, 0x2A, 0xCC, 0x67, 0xBB, 0xE6, 0x9A, 0x65, 0x82, 0x24, 0x72, 0xC3, 0x61, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20,
+    0x41, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x30, 0x62, 0x49, 0xE4, 0x69, 0x85, 0x8A, 0x26, 0xAB, 0x67, 0xBB, 0xA8, 0xC3, 0xA8, 0xC3, 0x87, 0xBB, 0x67, 0xBB, 0x67, 0xBB, 0xE9, 0xC3, 0x63, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xDD, 0x8C, 0xCC, 0xE6, 0x9A,
+    0x04, 0x6A, 0xE4, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0x22, 0x39, 0x02, 0x39, 0x02, 0x39, 0x02, 0x31, 0x02, 0x31, 0x02, 0x39, 0x02, 0x39, 0x02, 0x39, 0x22, 0x39, 0x22, 0x39, 0x42, 0x41, 0x83, 0x51, 0x44, 0x7A, 0x46, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x39, 0x6B, 0xCC, 0x87, 0xBB, 0x06, 0xA3, 0x85, 0x8A, 0x24, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x41, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x30, 0x63, 0x49, 0x24, 0x72, 0x06, 0xA3, 0x62, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x43, 0x41, 0x4B, 0xCC, 0x2A, 0xCC, 0x8C, 0xD4, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xCC, 0xEE, 0xD4, 0x2A, 0xCC, 0x65, 0x82, 0xE4, 0x61, 0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39, 0x02, 0x39, 0x02, 0x39, 0x02, 0x31, 0xE2, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30,
+    0xE2, 0x30, 0x02, 0x31, 0x02, 0x39, 0x02, 0x39, 0x22, 0x39, 0x42, 0x49, 0xE4, 0x61, 0xC5, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xD4, 0xA8, 0xC3, 0x06, 0xA3, 0xA5, 0x92, 0x24, 0x7A, 0xC3, 0x61, 0x83, 0x51, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20,
+    0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0xA1, 0x18, 0xA1, 0x20, 0xE1, 0x30, 0x42, 0x49, 0x24, 0x72, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xD4, 0x8D, 0xD4, 0x0F, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xDD, 0xAD, 0xD4, 0x26, 0xAB, 0xE3, 0x69,
+    0xC3, 0x61, 0xA3, 0x59, 0xA3, 0x51, 0x83, 0x51, 0x63, 0x49, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39, 0x22, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x31, 0x02, 0x39, 0x22, 0x41, 0x83, 0x51, 0x64, 0x82, 0xE2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xCC, 0x87, 0xBB, 0xE6, 0x9A, 0x65, 0x82, 0x24, 0x72, 0xA3, 0x59, 0x63, 0x51, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x60, 0x10, 0x60, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xC1, 0x28, 0x22, 0x39, 0xE4, 0x69, 0x06, 0xA3, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0xEF, 0xD4, 0xEF, 0xD4, 0x06, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xDD, 0x09, 0xCC, 0x24, 0x72, 0xE4, 0x69, 0xC3, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x02, 0x39, 0x02, 0x39, 0x02, 0x31, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28,
+    0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0xE2, 0x30, 0x02, 0x31, 0x02, 0x39, 0x62, 0x49, 0x04, 0x6A, 0xE6, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCC, 0x26, 0xAB, 0xA5, 0x8A, 0x44, 0x7A, 0xE4, 0x69, 0xA3, 0x51, 0x42, 0x49, 0x22, 0x39, 0x02, 0x31, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20,
+    0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xE2, 0x28, 0x63, 0x49, 0x85, 0x8A, 0xA8, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xDD, 0x0F, 0xD5, 0x51, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0x8C, 0xD4, 0x46, 0xB3, 0x04, 0x72, 0xE4, 0x69,
+    0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39, 0x02, 0x31, 0xE2, 0x30, 0xE1, 0x30, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x41, 0xA3, 0x59, 0x44, 0x7A, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10,
+    0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x47, 0xB3, 0xC5, 0x92, 0x44, 0x7A, 0xE4, 0x69, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x31, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x61, 0x10, 0x60, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xE1, 0x28, 0xA3, 0x59, 0xE6, 0x9A, 0x07, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x9B, 0x30, 0xDD, 0x51, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x9B, 0x6C, 0xD4, 0xA5, 0x92, 0xE4, 0x69, 0xE4, 0x61, 0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x63, 0x49, 0x42, 0x41, 0x22, 0x41, 0x02, 0x39, 0x02, 0x31, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28,
+    0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0x22, 0x39, 0x62, 0x49, 0xC3, 0x59, 0x24, 0x72, 0x85, 0x8A, 0xC5, 0x9A, 0xE6, 0xA2, 0x06, 0xA3, 0x06, 0xAB, 0x26, 0xAB, 0x26, 0xAB, 0x06, 0xA3, 0xE6, 0x9A, 0x85, 0x8A, 0x24, 0x72, 0xE4, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20,
+    0x61, 0x10, 0x60, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xE2, 0x30, 0xC3, 0x61, 0x26, 0xA3, 0x04, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x41, 0x50, 0xDD, 0x51, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xB4, 0x87, 0xC3, 0x24, 0x7A, 0xE4, 0x69, 0xE4, 0x61,
+    0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x42, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0x02, 0x39, 0x42, 0x41, 0x63, 0x49, 0xA3, 0x59, 0xE4, 0x61, 0x04, 0x72, 0x24, 0x72, 0x24, 0x7A, 0x24, 0x7A, 0x44, 0x7A,
+    0x44, 0x7A, 0x44, 0x7A, 0x24, 0x7A, 0x04, 0x6A, 0xC3, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xE2, 0x30, 0xC3, 0x61, 0x26, 0xAB, 0xA6, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x72, 0x50, 0xDD, 0x51, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xAC, 0x6C, 0xCC, 0x44, 0x7A, 0xE4, 0x69, 0xE3, 0x61, 0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x42, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x28,
+    0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0xE2, 0x30, 0x02, 0x39, 0x42, 0x41, 0x83, 0x51, 0xC3, 0x61, 0x04, 0x72, 0x44, 0x7A, 0x44, 0x7A, 0x65, 0x82, 0x65, 0x82, 0x64, 0x82, 0x85, 0x82, 0x65, 0x82, 0x45, 0x7A, 0x04, 0x6A, 0xC3, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x62, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20,
+    0x60, 0x10, 0x60, 0x18, 0x81, 0x18, 0xA1, 0x20, 0x02, 0x31, 0xC3, 0x59, 0xE6, 0xA2, 0x0A, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD5, 0x30, 0xDD, 0x71, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x82, 0xAE, 0xD4, 0xA5, 0x8A, 0x04, 0x6A, 0xE4, 0x61,
+    0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0x02, 0x31, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0x22, 0x39, 0x63, 0x49, 0x04, 0x6A, 0x85, 0x8A, 0xE6, 0x9A, 0x26, 0xAB, 0x26, 0xAB, 0x46, 0xB3, 0x46, 0xB3, 0x67, 0xB3,
+    0x67, 0xBB, 0x47, 0xB3, 0x06, 0xA3, 0x85, 0x8A, 0x24, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x63, 0x49, 0x42, 0x41, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0xA1, 0x20, 0x02, 0x31, 0xA3, 0x51, 0xA5, 0x92, 0xA7, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xDD, 0x30, 0xDD, 0xEF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x30, 0xDD, 0x87, 0xBB, 0x24, 0x72, 0xE3, 0x61, 0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x02, 0x39, 0x02, 0x31, 0xE1, 0x30, 0xE1, 0x30, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xA1, 0x28,
+    0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x31, 0x42, 0x41, 0xC3, 0x61, 0x85, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xAB, 0x85, 0x82, 0x04, 0x6A, 0xC3, 0x61, 0xA3, 0x59, 0x63, 0x49, 0x22, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20,
+    0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0xC1, 0x20, 0xE1, 0x30, 0x63, 0x49, 0x44, 0x7A, 0x06, 0xA3, 0xC8, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xD5, 0xEF, 0xD4, 0x30, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xDD, 0x4B, 0xCC, 0x85, 0x8A, 0x04, 0x6A,
+    0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x39, 0x63, 0x49, 0x04, 0x72, 0x44, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xC3, 0xC5, 0x9A, 0x44, 0x7A, 0x04, 0x6A, 0xC3, 0x61, 0x83, 0x51, 0x42, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xE1, 0x28, 0x22, 0x41, 0xA3, 0x59, 0x24, 0x72, 0xE6, 0x9A, 0xA8, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xD4, 0xEE, 0xD4, 0xCE, 0xD4, 0x8E, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xDD, 0xCE, 0xD4, 0x46, 0xB3, 0x24, 0x72, 0xC3, 0x61, 0xA3, 0x59, 0xA3, 0x51, 0x83, 0x51, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x02, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28,
+    0xE1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0xE2, 0x30, 0x02, 0x31, 0x22, 0x39, 0xA3, 0x59, 0x85, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xC3, 0x06, 0xA3, 0x85, 0x82, 0x24, 0x72, 0xE4, 0x69, 0xA3, 0x59, 0x63, 0x49, 0x22, 0x39, 0x02, 0x31, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20,
+    0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x30, 0x22, 0x39, 0x83, 0x49, 0xE4, 0x69, 0x85, 0x8A, 0x46, 0xAB, 0x85, 0x8A, 0x20, 0x08, 0x00, 0x00, 0x20, 0x08, 0x28, 0x9B, 0x6B, 0xCC, 0x4B, 0xCC, 0x8C, 0xD4, 0xEF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0x0F, 0xDD, 0xE9, 0xC3, 0x85, 0x82,
+    0xE4, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x83, 0x51, 0x63, 0x49, 0x42, 0x49, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE1, 0x30, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x39, 0x42, 0x49, 0x04, 0x6A, 0xE6, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xC3, 0x06, 0xA3, 0x85, 0x8A, 0x44, 0x7A, 0x04, 0x6A, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x60, 0x10, 0x61, 0x10, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x42, 0x41, 0xA3, 0x59, 0x04, 0x72, 0x85, 0x82, 0xC6, 0x9A, 0x06, 0xA3, 0x26, 0xAB, 0x26, 0xAB,
+    0x46, 0xB3, 0xA7, 0xC3, 0x0A, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xDD, 0x8C, 0xD4, 0x26, 0xAB, 0x04, 0x72, 0xC3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39, 0x22, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0xE1, 0x30, 0xE2, 0x30,
+    0xE2, 0x30, 0x02, 0x31, 0x02, 0x39, 0x02, 0x39, 0x42, 0x41, 0xA3, 0x59, 0x85, 0x82, 0xE2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x93, 0xC8, 0xC3, 0x06, 0xA3, 0x85, 0x8A, 0x44, 0x7A, 0xE4, 0x69, 0xA3, 0x59, 0x63, 0x49, 0x22, 0x41, 0x02, 0x31, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20,
+    0x41, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0x02, 0x31, 0x22, 0x39, 0x42, 0x49, 0x83, 0x51, 0xC3, 0x59, 0xE4, 0x61, 0x04, 0x6A, 0x24, 0x72, 0x65, 0x82, 0x06, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0x0F, 0xD5, 0xA7, 0xC3,
+    0x65, 0x82, 0xC3, 0x61, 0xA3, 0x59, 0xA3, 0x51, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39, 0x22, 0x39, 0x02, 0x39, 0x02, 0x39, 0x02, 0x39, 0x02, 0x39, 0x02, 0x39, 0x02, 0x39, 0x22, 0x39, 0x02, 0x39, 0x42, 0x41, 0x83, 0x51, 0x24, 0x72, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCD, 0xD4, 0xA7, 0xC3, 0xE6, 0x9A, 0x65, 0x82, 0x24, 0x72, 0xC3, 0x61, 0xA3, 0x51, 0x42, 0x49, 0x22, 0x41, 0x02, 0x31, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x63, 0x49, 0x83, 0x51,
+    0xE4, 0x69, 0xA5, 0x92, 0xA8, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xCC, 0x8C, 0xD4, 0x06, 0xA3, 0x24, 0x72, 0xC4, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x42, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x39, 0x02, 0x39, 0x02, 0x39, 0x22, 0x39, 0x22, 0x39,
+    0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x83, 0x51, 0x04, 0x72, 0xE5, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xCC, 0x47, 0xB3, 0xA5, 0x8A, 0x24, 0x72, 0xE4, 0x69, 0xA3, 0x59, 0x83, 0x51, 0x42, 0x41, 0x22, 0x39, 0x02, 0x31, 0xE1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18,
+    0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x39, 0x22, 0x39, 0x42, 0x41, 0x63, 0x49, 0xC3, 0x59, 0x65, 0x82, 0x67, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xDD,
+    0x2A, 0xCC, 0x06, 0xAB, 0x44, 0x7A, 0xA3, 0x59, 0xA3, 0x51, 0x83, 0x51, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x42, 0x41, 0x42, 0x49, 0x83, 0x51, 0x04, 0x6A, 0xC5, 0x92, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCA, 0xB3, 0x09, 0xCC, 0x06, 0xA3, 0x65, 0x82, 0x04, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x62, 0x49, 0x42, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x40, 0x08, 0x40, 0x08, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x22, 0x39, 0x42, 0x41,
+    0x83, 0x51, 0x04, 0x6A, 0xE6, 0xA2, 0xE4, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xD4, 0x09, 0xCC, 0xC6, 0x92, 0xC3, 0x61, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51, 0x63, 0x49, 0x63, 0x49, 0x62, 0x49, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x49, 0x62, 0x49,
+    0x83, 0x51, 0xC3, 0x59, 0x24, 0x72, 0xE6, 0x9A, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xD4, 0x87, 0xC3, 0xC5, 0x9A, 0x44, 0x7A, 0xE4, 0x69, 0xC3, 0x59, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18,
+    0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x41, 0x62, 0x49, 0xA3, 0x59, 0x65, 0x82, 0x87, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xCC, 0x06, 0xA3, 0xE4, 0x69, 0xC3, 0x59, 0xA3, 0x59, 0xA3, 0x59, 0xA3, 0x59, 0x83, 0x51, 0x83, 0x51, 0x63, 0x49, 0x63, 0x51, 0x83, 0x51, 0x83, 0x51, 0xA3, 0x59, 0xC3, 0x61, 0x04, 0x72, 0x85, 0x8A, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x8B, 0x4B, 0xCC, 0x47, 0xB3, 0xC5, 0x92, 0x44, 0x7A, 0xE4, 0x69, 0xA3, 0x59, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0x02, 0x39,
+    0x22, 0x41, 0x63, 0x51, 0xE4, 0x69, 0xC6, 0x9A, 0xC6, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x7A, 0x6C, 0xCC, 0x06, 0xAB, 0x24, 0x72, 0x04, 0x72, 0x24, 0x7A, 0x24, 0x72, 0x24, 0x72, 0xE4, 0x69, 0xE4, 0x69, 0xE4, 0x69, 0xE4, 0x69, 0x04, 0x6A, 0x24, 0x72, 0x44, 0x7A, 0xA5, 0x8A,
+    0x06, 0xA3, 0x06, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xD4, 0xC8, 0xC3, 0x26, 0xAB, 0xA5, 0x92, 0x44, 0x7A, 0x04, 0x6A, 0xC3, 0x59, 0x83, 0x51, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18,
+    0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x31, 0x02, 0x39, 0x42, 0x41, 0x83, 0x51, 0x24, 0x72, 0x26, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0xD4, 0xE9, 0xCB, 0xE6, 0x9A, 0x85, 0x82, 0x85, 0x82, 0x06, 0xA3, 0x26, 0xAB, 0x06, 0xAB, 0xE6, 0x9A, 0xE6, 0x9A, 0x06, 0xA3, 0x06, 0xA3, 0x06, 0xA3, 0x26, 0xAB, 0x87, 0xBB, 0x27, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xD4,
+    0x4B, 0xCC, 0x87, 0xC3, 0x06, 0xA3, 0xA5, 0x92, 0x44, 0x82, 0x04, 0x6A, 0xC3, 0x59, 0x83, 0x51, 0x42, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30,
+    0x02, 0x31, 0x02, 0x39, 0x42, 0x41, 0xA3, 0x59, 0x65, 0x82, 0x87, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xCC, 0x8C, 0xD4, 0x67, 0xBB, 0xC5, 0x92, 0xE6, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x63, 0x49, 0xA7, 0x82, 0xC7, 0x82, 0x04, 0x6A, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x39, 0xAD, 0xD4, 0xE9, 0xCB, 0x47, 0xB3, 0xE6, 0xA2, 0xA5, 0x92, 0x44, 0x7A, 0x04, 0x6A, 0xC3, 0x59, 0x83, 0x51, 0x42, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x61, 0x18,
+    0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x31, 0x22, 0x39, 0x42, 0x49, 0xE4, 0x61, 0xC5, 0x92, 0x67, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xD4,
+    0x0A, 0xCC, 0x26, 0xAB, 0xE6, 0x9A, 0xC3, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xD4, 0x2A, 0xCC,
+    0xA7, 0xC3, 0x46, 0xB3, 0xE6, 0xA2, 0x85, 0x8A, 0x44, 0x7A, 0x04, 0x6A, 0xC3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xC1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x61, 0x18, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28,
+    0xC1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0x22, 0x39, 0x83, 0x51, 0x24, 0x72, 0x06, 0xA3, 0x04, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD5, 0x6C, 0xD4, 0x87, 0xC3, 0x06, 0xA3, 0x46, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x92, 0xDD, 0x71, 0xDD, 0x71, 0xDD, 0x71, 0xDD, 0x92, 0xDD, 0xE5, 0x59, 0x00, 0x00, 0xEE, 0xD4, 0x4B, 0xCC, 0xC8, 0xC3, 0x47, 0xB3, 0x06, 0xA3, 0xC5, 0x9A, 0x85, 0x8A, 0x24, 0x72, 0xE4, 0x69, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x61, 0x18,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x42, 0x41, 0xA3, 0x59, 0x65, 0x82, 0x46, 0xB3, 0x63, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x28, 0x8D, 0xD4, 0xE9, 0xC3,
+    0x26, 0xAB, 0x26, 0xAB, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x71, 0xDD, 0x51, 0xDD, 0x50, 0xDD, 0x50, 0xDD, 0x50, 0xDD, 0x30, 0xDD, 0x30, 0xDD, 0x0F, 0xD5, 0xCD, 0xD4, 0x4B, 0xCC, 0xC8, 0xC3, 0x67, 0xBB,
+    0x26, 0xAB, 0xE6, 0x9A, 0xA5, 0x8A, 0x65, 0x82, 0x24, 0x72, 0xE4, 0x61, 0xA3, 0x59, 0x63, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x61, 0x18, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20,
+    0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0x22, 0x39, 0x63, 0x49, 0xE4, 0x61, 0xA5, 0x8A, 0x67, 0xB3, 0x65, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xD4, 0x0A, 0xCC, 0x67, 0xBB, 0x26, 0xAB, 0x87, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x63, 0x41, 0x71, 0xDD, 0x50, 0xDD, 0x51, 0xDD, 0x71, 0xDD, 0x10, 0xCD, 0x28, 0x93, 0x8D, 0xC4, 0x51, 0xDD, 0x0F, 0xD5, 0x8D, 0xD4, 0x2A, 0xCC, 0x87, 0xC3, 0x26, 0xAB, 0xE6, 0xA2, 0xC5, 0x92, 0x85, 0x8A, 0x44, 0x7A, 0x04, 0x6A, 0xC3, 0x61, 0x83, 0x51, 0x62, 0x49, 0x22, 0x39, 0xE2, 0x30, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x61, 0x18,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE1, 0x28, 0x02, 0x31, 0x22, 0x41, 0x83, 0x51, 0x04, 0x6A, 0xA5, 0x8A, 0x46, 0xB3, 0x68, 0xB3, 0x00, 0x00, 0xE7, 0x92, 0xE9, 0xCB, 0x67, 0xBB, 0x06, 0xA3,
+    0x46, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x71, 0xDD, 0x50, 0xDD, 0x71, 0xDD, 0xE2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xEF, 0xD4, 0x4B, 0xCC, 0x87, 0xC3, 0x06, 0xAB,
+    0xA5, 0x92, 0x85, 0x8A, 0x44, 0x7A, 0x04, 0x72, 0xE4, 0x61, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xC1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x80, 0x18, 0x60, 0x18, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18,
+    0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x30, 0x02, 0x39, 0x42, 0x41, 0x83, 0x51, 0x04, 0x6A, 0x85, 0x8A, 0xE6, 0xA2, 0x46, 0xB3, 0x87, 0xBB, 0x26, 0xAB, 0xC5, 0x9A, 0xC5, 0x9A, 0x06, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x71, 0xDD, 0x30, 0xDD, 0x51, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xD4, 0xE9, 0xC3, 0x26, 0xAB, 0xA5, 0x92, 0x44, 0x7A, 0x24, 0x72, 0xE3, 0x61, 0xA3, 0x59, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x22, 0x39, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x18,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x42, 0x41, 0x83, 0x51, 0xE4, 0x61, 0x24, 0x72, 0x85, 0x8A, 0xA5, 0x92, 0x85, 0x8A, 0x64, 0x82, 0xA5, 0x92,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x20, 0x50, 0xDD, 0x30, 0xDD, 0xE2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xCC, 0x67, 0xBB,
+    0xC5, 0x92, 0x44, 0x7A, 0x04, 0x6A, 0xC3, 0x61, 0x83, 0x51, 0x63, 0x49, 0x42, 0x41, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10,
+    0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x39, 0x22, 0x41, 0x63, 0x49, 0x83, 0x51, 0xE4, 0x69, 0xE4, 0x69, 0xE4, 0x61, 0xE4, 0x69, 0xC3, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x51, 0xDD, 0x0F, 0xD5, 0x50, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xCC, 0xA8, 0xC3, 0xE6, 0x9A, 0x65, 0x82, 0x04, 0x6A, 0xC3, 0x59, 0x83, 0x51, 0x63, 0x49, 0x42, 0x41, 0x22, 0x39, 0x02, 0x31, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x10,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0x22, 0x39, 0x42, 0x41, 0x63, 0x51, 0x63, 0x51, 0x63, 0x51, 0x83, 0x51, 0xE4, 0x69,
+    0x85, 0x8A, 0x46, 0xAB, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xD4, 0xCE, 0xD4, 0x8D, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x39, 0xE9, 0xCB,
+    0x06, 0xA3, 0x85, 0x82, 0x04, 0x72, 0xC3, 0x59, 0x83, 0x51, 0x62, 0x49, 0x22, 0x41, 0x02, 0x39, 0x02, 0x31, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x60, 0x18, 0x61, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10,
+    0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xE2, 0x28, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x39, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x63, 0x49, 0xC4, 0x61, 0x65, 0x82, 0x26, 0xAB, 0xC8, 0xC3, 0x2A, 0xCC, 0x48, 0xA3, 0xA1, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x10, 0x45, 0x72, 0x4B, 0xCC,
+    0x4B, 0xCC, 0x4B, 0xCC, 0x29, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0x0A, 0xCC, 0x26, 0xAB, 0x85, 0x8A, 0x04, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x42, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xE1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x10, 0x61, 0x10,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x39,
+    0x63, 0x49, 0xC3, 0x61, 0x44, 0x7A, 0xC5, 0x92, 0xE6, 0xA2, 0x06, 0xAB, 0x26, 0xAB, 0x47, 0xB3, 0x87, 0xBB, 0xA7, 0xC3, 0xE9, 0xC3, 0x2A, 0xCC, 0x2A, 0xCC, 0x2A, 0xCC, 0x09, 0xCC, 0xA8, 0xC3, 0x67, 0xBB, 0xA8, 0xC3, 0xA9, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x18, 0x2A, 0xCC,
+    0x26, 0xAB, 0x85, 0x8A, 0x24, 0x72, 0xC4, 0x61, 0x83, 0x51, 0x42, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x80, 0x18, 0x60, 0x10, 0x60, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10,
+    0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0xE2, 0x30, 0x22, 0x39, 0x63, 0x49, 0xC3, 0x59, 0xE4, 0x69, 0x04, 0x72, 0x04, 0x72, 0x24, 0x72, 0x44, 0x7A, 0x65, 0x82, 0x85, 0x8A, 0xC5, 0x9A, 0x26, 0xA3, 0x46, 0xB3, 0x46, 0xB3, 0x26, 0xAB, 0x06, 0xA3,
+    0xE6, 0x9A, 0x26, 0xAB, 0xE9, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xBC, 0xE9, 0xCB, 0x26, 0xAB, 0xA5, 0x8A, 0x24, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x42, 0x41, 0x22, 0x39, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x61, 0x18, 0x60, 0x10, 0x60, 0x10,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30,
+    0x02, 0x31, 0x22, 0x41, 0x62, 0x49, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51, 0xA3, 0x51, 0xA3, 0x59, 0xE3, 0x61, 0x04, 0x72, 0x65, 0x82, 0xA5, 0x8A, 0xA5, 0x92, 0x85, 0x8A, 0x65, 0x82, 0x65, 0x82, 0xA5, 0x8A, 0x46, 0xB3, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xCC, 0xA7, 0xC3,
+    0x06, 0xA3, 0x85, 0x8A, 0x24, 0x72, 0xC3, 0x61, 0x83, 0x51, 0x42, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08,
+    0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0x02, 0x31, 0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x63, 0x49, 0x83, 0x51, 0xA3, 0x59, 0xE4, 0x69, 0x24, 0x72, 0x44, 0x7A, 0x24, 0x72, 0x04, 0x6A,
+    0x04, 0x6A, 0x24, 0x72, 0xA5, 0x8A, 0x67, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xD4, 0xE9, 0xCB, 0x46, 0xB3, 0xE5, 0x9A, 0x65, 0x82, 0x24, 0x72, 0xC3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x80, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28,
+    0xC1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0x02, 0x31, 0x02, 0x39, 0x02, 0x31, 0x02, 0x39, 0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x63, 0x49, 0xA3, 0x59, 0xC3, 0x59, 0xC3, 0x61, 0xC3, 0x61, 0xC3, 0x59, 0xC3, 0x59, 0xC3, 0x61, 0x04, 0x72, 0x85, 0x8A, 0x46, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xCC, 0xE9, 0xCB, 0x67, 0xBB, 0x06, 0xA3,
+    0xA5, 0x8A, 0x44, 0x7A, 0xE4, 0x69, 0xA3, 0x59, 0x63, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x60, 0x10, 0x60, 0x10, 0x40, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x60, 0x18, 0x81, 0x18, 0x81, 0x18, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x63, 0x49, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51,
+    0x83, 0x51, 0x83, 0x51, 0xA3, 0x59, 0xC3, 0x61, 0x44, 0x82, 0xE6, 0x9A, 0x67, 0xB3, 0x22, 0x41, 0x60, 0x10, 0x22, 0x39, 0x2B, 0xC4, 0x0A, 0xCC, 0x87, 0xC3, 0x46, 0xB3, 0xE6, 0xA2, 0xA5, 0x92, 0x65, 0x82, 0x24, 0x72, 0xE4, 0x61, 0x83, 0x51, 0x42, 0x49, 0x22, 0x39, 0x02, 0x31, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x60, 0x18, 0x61, 0x10, 0x60, 0x10, 0x40, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20,
+    0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x31, 0x22, 0x39, 0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x41, 0x42, 0x49, 0x63, 0x49, 0xA3, 0x59, 0x04, 0x6A, 0x65, 0x82, 0xC6, 0x92, 0x06, 0xA3, 0x46, 0xAB, 0x46, 0xB3, 0x26, 0xAB, 0xE6, 0xA2, 0xA5, 0x92, 0x85, 0x8A, 0x64, 0x7A,
+    0x24, 0x72, 0xE4, 0x69, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x61, 0x10, 0x61, 0x10, 0x40, 0x10, 0x40, 0x08, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x28, 0xE2, 0x30, 0x02, 0x31, 0x02, 0x31, 0x02, 0x39, 0x02, 0x39,
+    0x22, 0x39, 0x22, 0x39, 0x22, 0x39, 0x22, 0x39, 0x42, 0x41, 0x63, 0x49, 0xA3, 0x59, 0xE4, 0x69, 0x24, 0x72, 0x44, 0x7A, 0x65, 0x82, 0x65, 0x82, 0x65, 0x82, 0x44, 0x7A, 0x24, 0x72, 0x04, 0x6A, 0xE4, 0x61, 0xA3, 0x59, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE1, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x61, 0x10, 0x60, 0x10, 0x40, 0x08, 0x40, 0x08,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18,
+    0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x39, 0x42, 0x41, 0x63, 0x49, 0x83, 0x51, 0xA3, 0x59, 0xC3, 0x61, 0xE4, 0x69, 0x04, 0x6A, 0xE3, 0x69, 0xC3, 0x61, 0xA3, 0x59,
+    0x83, 0x51, 0x63, 0x49, 0x42, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x61, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x61, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x60, 0x10, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28,
+    0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0x02, 0x39, 0x22, 0x39, 0x42, 0x41, 0x62, 0x49, 0x63, 0x49, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51, 0x83, 0x51, 0x63, 0x49, 0x42, 0x41, 0x42, 0x41, 0x02, 0x39, 0xE2, 0x30, 0xE1, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x60, 0x18, 0x61, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10,
+    0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x39, 0x22, 0x39, 0x22, 0x39, 0x22, 0x41, 0x42, 0x41, 0x42, 0x41, 0x22, 0x41, 0x22, 0x39,
+    0x22, 0x39, 0x02, 0x31, 0xE1, 0x30, 0xC1, 0x28, 0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x61, 0x18, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20,
+    0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE1, 0x28, 0xE1, 0x30, 0xE1, 0x30, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0xE1, 0x30, 0xE1, 0x30, 0xC1, 0x28, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08,
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10,
+    0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x41, 0x10, 0x41, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x80, 0x18, 0x80, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 0xC1, 0x28,
+    0xC1, 0x28, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x18, 0x81, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08,
+    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x61, 0x10, 0x61, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18,
+    0x60, 0x18, 0x80, 0x18, 0x80, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x20, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x08,
 };
 const lv_img_dsc_t ui_img_settings_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_settings_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_settings_80_png_data
 };
 
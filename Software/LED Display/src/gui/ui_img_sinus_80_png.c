@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Sinus_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_sinus_80_png_data[] = {
-    0xC1, 0x18, 0xFF, 0xE4, 0x41, 0xFF, 0xC2, 0x18, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x02, 0x21, 0xFF, 0xE5, 0x41, 0xFF, 0x02, 0x21, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x66, 0x52, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x21, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x21, 0xFF, 0x22, 0x29, 0xFF, 0x45, 0x4A, 0xFF, 0x22, 0x29, 0xFF, 0xE2, 0x38, 0xFF, 0x23, 0x39, 0xFF, 0x23, 0x31, 0xFF, 0x86, 0x52, 0xFF, 0x23, 0x41, 0xFF, 0xC2, 0x48, 0xFF, 0x63, 0x31, 0xFF, 0x23, 0x41, 0xFF, 0x63, 0x29, 0xFF, 0x46, 0x52, 0xFF, 0x63, 0x29, 0xFF, 0xA4, 0x31, 0xFF, 0x83, 0x29, 0xFF, 0xA4, 0x31, 0xFF, 0xC7, 0x5A, 0xFF, 0x83, 0x31, 0xFF, 0xA4, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0xE8, 0x5A, 0xFF, 0x63, 0x41, 0xFF, 0x24, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x44, 0x41, 0xFF, 0xA3, 0x31, 0xFF, 0x08, 0x73, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x41, 0xFF, 0xE3, 0x50, 0xFF, 0xA7, 0x62, 0xFF, 0x43, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x23, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x22, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0xE6, 0x79, 0xFF, 0x43, 0x31, 0xFF, 0x02, 0x29, 0xFF,
-    0x42, 0x31, 0xFF, 0x02, 0x29, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x25, 0x62, 0xFF, 0x83, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x25, 0x62, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0xC1, 0x18, 0xFF, 0xC2, 0x20, 0xFF, 0xC5, 0x39, 0xFF, 0xE1, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x02, 0x21, 0xFF, 0xC1, 0x18, 0xFF, 0x25, 0x42, 0xFF, 0x63, 0x31, 0xFF, 0xE1, 0x20, 0xFF, 0x22, 0x21, 0xFF, 0xE1, 0x20, 0xFF, 0x42, 0x29, 0xFF, 0xE8, 0x5A, 0xFF, 0x42, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x21, 0xFF, 0x02, 0x29, 0xFF, 0xE7, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x63, 0x29, 0xFF, 0x02, 0x31, 0xFF, 0x02, 0x31, 0xFF, 0x42, 0x29, 0xFF, 0x42, 0x29, 0xFF, 0xA3, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0xA4, 0x31, 0xFF, 0xC7, 0x5A, 0xFF, 0xE5, 0x41, 0xFF, 0x83, 0x29, 0xFF, 0xC4, 0x31, 0xFF, 0xA3, 0x31, 0xFF, 0x28, 0x63, 0xFF, 0xE6, 0x5A, 0xFF, 0x63, 0x29, 0xFF, 0xA3, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x86, 0x5A, 0xFF, 0x83, 0x31, 0xFF, 0x09, 0x6B, 0xFF, 0x49, 0x6B, 0xFF, 0x66, 0x5A, 0xFF, 0xA3, 0x31, 0xFF, 0xA6, 0x5A, 0xFF, 0x23, 0x41, 0xFF, 0x6B, 0x93, 0xFF,
-    0xA8, 0x8A, 0xFF, 0x62, 0x31, 0xFF, 0x6C, 0x8C, 0xFF, 0x03, 0x51, 0xFF, 0xE6, 0x81, 0xFF, 0x28, 0xA2, 0xFF, 0x04, 0x69, 0xFF, 0x45, 0x5A, 0xFF, 0x83, 0x59, 0xFF, 0x63, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x03, 0x49, 0xFF, 0x05, 0x5A, 0xFF, 0x43, 0x39, 0xFF, 0xE2, 0x30, 0xFF, 0x43, 0x39, 0xFF, 0x22, 0x31, 0xFF, 0x05, 0x62, 0xFF, 0x87, 0x6A, 0xFF, 0x22, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x03, 0x49, 0xFF, 0xA5, 0x59, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x42, 0x39, 0xFF, 0x43, 0x41, 0xFF, 0xA5, 0x61, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0xC1, 0x18, 0xFF, 0x02, 0x21, 0xFF, 0xE2, 0x20, 0xFF, 0x80, 0x10, 0xFF, 0xC1, 0x18, 0xFF, 0xC1, 0x18, 0xFF, 0xE2, 0x20, 0xFF, 0x23, 0x29, 0xFF, 0xE2, 0x20, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0x43, 0x29, 0xFF, 0x83, 0x31, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0x44, 0x41, 0xFF, 0x63, 0x31, 0xFF, 0x62, 0x29, 0xFF, 0xA4, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x42, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0xE4, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x84, 0x31, 0xFF,
-    0xA4, 0x31, 0xFF, 0xC4, 0x39, 0xFF, 0xA4, 0x31, 0xFF, 0xA3, 0x31, 0xFF, 0x83, 0x29, 0xFF, 0x83, 0x31, 0xFF, 0xC7, 0x62, 0xFF, 0xA4, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x03, 0x49, 0xFF, 0xE3, 0x50, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0xE3, 0x58, 0xFF, 0x43, 0x39, 0xFF, 0x23, 0x41, 0xFF, 0xE3, 0x58, 0xFF, 0x03, 0x49, 0xFF, 0xC3, 0x50, 0xFF, 0x22, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x03, 0x41, 0xFF, 0x42, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x22, 0x31, 0xFF, 0x87, 0x62, 0xFF, 0x43, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x05, 0x52, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0xA4, 0x41, 0xFF, 0x22, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0xA1, 0x18, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x05, 0x3A, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x23, 0x29, 0xFF, 0xE2, 0x20, 0xFF, 0x45, 0x4A, 0xFF, 0xC5, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0xE4, 0x39, 0xFF, 0x22, 0x21, 0xFF,
-    0x22, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0x69, 0x5B, 0xFF, 0x29, 0x63, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x39, 0xFF, 0x02, 0x29, 0xFF, 0x46, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x41, 0xFF, 0x22, 0x29, 0xFF, 0x45, 0x4A, 0xFF, 0x8B, 0x6B, 0xFF, 0x63, 0x39, 0xFF, 0xC3, 0x39, 0xFF, 0x42, 0x31, 0xFF, 0x05, 0x42, 0xFF, 0xEA, 0x6B, 0xFF, 0xA4, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0x26, 0x52, 0xFF, 0x46, 0x52, 0xFF, 0xA9, 0x63, 0xFF, 0xA4, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0x25, 0x4A, 0xFF, 0x86, 0x52, 0xFF, 0x83, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0x05, 0x4A, 0xFF, 0x86, 0x5A, 0xFF, 0xC5, 0x61, 0xFF, 0x25, 0x79, 0xFF, 0x23, 0x51, 0xFF, 0x83, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0xC2, 0x50, 0xFF, 0x22, 0x31, 0xFF, 0x23, 0x39, 0xFF, 0x23, 0x49, 0xFF, 0x84, 0x61, 0xFF, 0x23, 0x39, 0xFF, 0xE2, 0x38, 0xFF, 0x02, 0x39, 0xFF, 0x23, 0x41, 0xFF, 0x05, 0x5A, 0xFF, 0x84, 0x41, 0xFF, 0x22, 0x39, 0xFF, 0x42, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0xE6, 0x59, 0xFF, 0x21, 0x31, 0xFF, 0x83, 0x41, 0xFF, 0x63, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0xE5, 0x61, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x39, 0xFF,
-    0xC1, 0x18, 0xFF, 0xC1, 0x18, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0xE2, 0x20, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x43, 0x29, 0xFF, 0xE2, 0x20, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x63, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x42, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0xA3, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0xC4, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0xC4, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0xA4, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0x03, 0x51, 0xFF, 0x63, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0xE3, 0x60, 0xFF, 0x64, 0x61, 0xFF, 0x03, 0x59, 0xFF, 0x02, 0x49, 0xFF, 0x22, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x23, 0x39, 0xFF, 0x22, 0x31, 0xFF,
-    0x22, 0x31, 0xFF, 0x43, 0x39, 0xFF, 0x02, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x42, 0x31, 0xFF, 0x43, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0x83, 0x39, 0xFF, 0x42, 0x29, 0xFF, 0xE5, 0x39, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0xE1, 0x20, 0xFF, 0xA3, 0x31, 0xFF, 0xC1, 0x18, 0xFF, 0xE2, 0x20, 0xFF, 0x23, 0x29, 0xFF, 0xA4, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x02, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0xE5, 0x39, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x83, 0x31, 0xFF, 0x46, 0x42, 0xFF, 0x42, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0xC4, 0x39, 0xFF, 0x86, 0x52, 0xFF, 0x43, 0x31, 0xFF, 0xC4, 0x41, 0xFF, 0xA4, 0x39, 0xFF, 0x87, 0x52, 0xFF, 0xE5, 0x41, 0xFF, 0xE4, 0x41, 0xFF, 0x04, 0x42, 0xFF, 0x22, 0x31, 0xFF, 0x25, 0x4A, 0xFF, 0xC4, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x86, 0x52, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x42, 0x31, 0xFF, 0xA7, 0x5A, 0xFF, 0xC4, 0x39, 0xFF, 0x84, 0x41, 0xFF, 0xC4, 0x41, 0xFF,
-    0x83, 0x39, 0xFF, 0xC7, 0x5A, 0xFF, 0x42, 0x31, 0xFF, 0x83, 0x41, 0xFF, 0x84, 0x51, 0xFF, 0x83, 0x39, 0xFF, 0x05, 0x4A, 0xFF, 0x42, 0x39, 0xFF, 0xE3, 0x50, 0xFF, 0xE3, 0x50, 0xFF, 0x23, 0x41, 0xFF, 0xA4, 0x59, 0xFF, 0x43, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x23, 0x39, 0xFF, 0x84, 0x61, 0xFF, 0x22, 0x31, 0xFF, 0x23, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0x26, 0x62, 0xFF, 0x63, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0x42, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0xE4, 0x49, 0xFF, 0x43, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0x02, 0x21, 0xFF, 0xE1, 0x28, 0xFF, 0x05, 0x42, 0xFF, 0xE2, 0x20, 0xFF, 0xE1, 0x20, 0xFF, 0x02, 0x21, 0xFF, 0xE2, 0x20, 0xFF, 0x45, 0x4A, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x29, 0xFF, 0xC8, 0x5A, 0xFF, 0xA3, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x86, 0x52, 0xFF, 0x42, 0x31, 0xFF, 0x42, 0x29, 0xFF, 0x83, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x46, 0x52, 0xFF, 0x83, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0xC6, 0x62, 0xFF, 0xA4, 0x39, 0xFF, 0x83, 0x39, 0xFF,
-    0xA3, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0x07, 0x6B, 0xFF, 0xC4, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0xA3, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0xC7, 0x62, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x07, 0x73, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0xE7, 0x72, 0xFF, 0x43, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x87, 0x72, 0xFF, 0x23, 0x41, 0xFF, 0xE2, 0x50, 0xFF, 0xE3, 0x50, 0xFF, 0x02, 0x41, 0xFF, 0x23, 0x39, 0xFF, 0x87, 0x7A, 0xFF, 0x22, 0x39, 0xFF, 0x22, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x43, 0x39, 0xFF, 0xA7, 0x72, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x43, 0x39, 0xFF, 0x83, 0x41, 0xFF, 0x46, 0x6A, 0xFF, 0xC2, 0x50, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x23, 0x51, 0xFF, 0xA5, 0x79, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0x02, 0x29, 0xFF, 0xE1, 0x20, 0xFF, 0xC1, 0x20, 0xFF, 0xC4, 0x39, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0xC1, 0x20, 0xFF, 0x66, 0x4A, 0xFF, 0x01, 0x21, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF,
-    0x02, 0x29, 0xFF, 0xA4, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x86, 0x4A, 0xFF, 0x02, 0x29, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0xC4, 0x39, 0xFF, 0xC4, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0xCB, 0x83, 0xFF, 0xC6, 0x52, 0xFF, 0x83, 0x39, 0xFF, 0x0F, 0x95, 0xFF, 0x8F, 0x94, 0xFF, 0x45, 0x42, 0xFF, 0xA3, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x45, 0x4A, 0xFF, 0x0B, 0x7C, 0xFF, 0xA3, 0x39, 0xFF, 0xE5, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0xA6, 0x52, 0xFF, 0x83, 0x41, 0xFF, 0xE4, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0x87, 0x62, 0xFF, 0xC4, 0x51, 0xFF, 0xE5, 0x51, 0xFF, 0x63, 0x41, 0xFF, 0x08, 0x6B, 0xFF, 0x63, 0x41, 0xFF, 0xE9, 0x82, 0xFF, 0x63, 0x39, 0xFF, 0x23, 0x49, 0xFF, 0xA4, 0x49, 0xFF, 0xE3, 0x60, 0xFF, 0x63, 0x49, 0xFF, 0xC2, 0x48, 0xFF, 0x02, 0x49, 0xFF, 0x84, 0x41, 0xFF, 0x43, 0x39, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x41, 0xFF, 0xA4, 0x49, 0xFF, 0x43, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x05, 0x52, 0xFF, 0x83, 0x41, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0xA4, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0xA3, 0x41, 0xFF,
-    0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0xC1, 0x20, 0xFF, 0x25, 0x42, 0xFF, 0x23, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0xE2, 0x20, 0xFF, 0x25, 0x42, 0xFF, 0x02, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0x46, 0x4A, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x29, 0xFF, 0x42, 0x31, 0xFF, 0xC6, 0x52, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0xE8, 0x5A, 0xFF, 0x63, 0x39, 0xFF, 0x08, 0x5B, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x08, 0x6B, 0xFF, 0xA4, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0x45, 0x52, 0xFF, 0x08, 0x63, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x05, 0x4A, 0xFF, 0x83, 0x41, 0xFF, 0xC4, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0x46, 0x52, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0x83, 0x39, 0xFF, 0xC7, 0x5A, 0xFF, 0xE5, 0x49, 0xFF, 0x84, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x41, 0xFF, 0xE4, 0x51, 0xFF, 0x83, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x87, 0x5A, 0xFF, 0xC3, 0x58, 0xFF, 0x43, 0x41, 0xFF, 0x86, 0x6A, 0xFF, 0x43, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x43, 0x39, 0xFF,
-    0x02, 0x41, 0xFF, 0x26, 0x72, 0xFF, 0x63, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0x63, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0xE5, 0x69, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x41, 0xFF, 0x83, 0x39, 0xFF, 0x03, 0x51, 0xFF, 0xA5, 0x71, 0xFF, 0x83, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xC4, 0x49, 0xFF, 0xA3, 0x41, 0xFF, 0x43, 0x31, 0xFF, 0xC1, 0x18, 0xFF, 0x43, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x02, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0xE2, 0x20, 0xFF, 0x05, 0x42, 0xFF, 0x02, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0xC5, 0x41, 0xFF, 0x43, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x42, 0x29, 0xFF, 0xC4, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0xC4, 0x41, 0xFF, 0xA7, 0x52, 0xFF, 0x43, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0xA4, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x05, 0x42, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0x83, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x41, 0xFF,
-    0x83, 0x41, 0xFF, 0xC4, 0x49, 0xFF, 0x63, 0x41, 0xFF, 0x84, 0x41, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x41, 0xFF, 0xA3, 0x49, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE3, 0x50, 0xFF, 0x43, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x42, 0x39, 0xFF, 0xA4, 0x49, 0xFF, 0x43, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x83, 0x41, 0xFF, 0x83, 0x41, 0xFF, 0x83, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xA3, 0x41, 0xFF, 0xC3, 0x41, 0xFF, 0xC1, 0x20, 0xFF, 0xC4, 0x39, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0xE1, 0x20, 0xFF, 0x25, 0x42, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0xC4, 0x39, 0xFF, 0x45, 0x42, 0xFF, 0x22, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0x05, 0x42, 0xFF, 0x63, 0x31, 0xFF, 0xC4, 0x39, 0xFF, 0x42, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x42, 0x31, 0xFF, 0xA6, 0x52, 0xFF, 0x63, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x83, 0x31, 0xFF, 0xE8, 0x62, 0xFF, 0xE7, 0x5A, 0xFF, 0x43, 0x31, 0xFF, 0x66, 0x4A, 0xFF, 0x83, 0x39, 0xFF, 0xE7, 0x4A, 0xFF, 0xA6, 0x5A, 0xFF, 0x66, 0x52, 0xFF,
-    0xA3, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0xA7, 0x62, 0xFF, 0xA7, 0x5A, 0xFF, 0x05, 0x4A, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xE8, 0x6A, 0xFF, 0x08, 0x6B, 0xFF, 0xA4, 0x41, 0xFF, 0x67, 0x5A, 0xFF, 0xC4, 0x51, 0xFF, 0x08, 0x6B, 0xFF, 0x0A, 0x83, 0xFF, 0x84, 0x49, 0xFF, 0x84, 0x41, 0xFF, 0xE4, 0x51, 0xFF, 0x48, 0x73, 0xFF, 0xC5, 0x61, 0xFF, 0xA4, 0x49, 0xFF, 0x25, 0x52, 0xFF, 0x05, 0x5A, 0xFF, 0x66, 0x6A, 0xFF, 0xA4, 0x59, 0xFF, 0x66, 0x6A, 0xFF, 0x43, 0x41, 0xFF, 0x25, 0x62, 0xFF, 0x22, 0x41, 0xFF, 0x05, 0x5A, 0xFF, 0x43, 0x49, 0xFF, 0x02, 0x51, 0xFF, 0x45, 0x62, 0xFF, 0xE5, 0x51, 0xFF, 0x43, 0x41, 0xFF, 0x44, 0x51, 0xFF, 0x43, 0x59, 0xFF, 0x46, 0x72, 0xFF, 0x43, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x63, 0x39, 0xFF, 0x83, 0x49, 0xFF, 0xE5, 0x61, 0xFF, 0x83, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xC4, 0x49, 0xFF, 0xE4, 0x49, 0xFF, 0xE4, 0x51, 0xFF, 0xE1, 0x20, 0xFF, 0x02, 0x21, 0xFF, 0x03, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0xC8, 0x5A, 0xFF, 0x64, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x23, 0x31, 0xFF, 0x25, 0x4A, 0xFF, 0x43, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x22, 0x29, 0xFF,
-    0x43, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x05, 0x4A, 0xFF, 0x63, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x42, 0x31, 0xFF, 0x87, 0x62, 0xFF, 0x63, 0x39, 0xFF, 0xC4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0xE8, 0x5A, 0xFF, 0x83, 0x39, 0xFF, 0x08, 0x73, 0xFF, 0x68, 0x63, 0xFF, 0x86, 0x52, 0xFF, 0xA4, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xFE, 0xFF, 0xFF, 0x07, 0x5B, 0xFF, 0xA4, 0x41, 0xFF, 0xE9, 0x5A, 0xFF, 0xC4, 0x49, 0xFF, 0xC5, 0x99, 0xFF, 0x85, 0x59, 0xFF, 0xA5, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0xC6, 0x49, 0xFF, 0x69, 0x93, 0xFF, 0x9C, 0xFF, 0xFF, 0x85, 0x59, 0xFF, 0xA5, 0x49, 0xFF, 0xA4, 0x49, 0xFF, 0xA4, 0x59, 0xFF, 0xFC, 0xFF, 0xFF, 0xA5, 0x61, 0xFF, 0x84, 0x49, 0xFF, 0x49, 0x7B, 0xFF, 0xA4, 0x59, 0xFF, 0xAE, 0xFC, 0xFF, 0xE4, 0xD8, 0xFF, 0x43, 0x51, 0xFF, 0xA6, 0x62, 0xFF, 0x63, 0x49, 0xFF, 0x43, 0x61, 0xFF, 0xFA, 0xFF, 0xFF, 0x42, 0x51, 0xFF, 0x43, 0x49, 0xFF, 0x23, 0x41, 0xFF, 0x23, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0xA2, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x41, 0xFF, 0xC5, 0x59, 0xFF, 0xA4, 0x81, 0xFF, 0x83, 0x41, 0xFF, 0x84, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0xA3, 0x39, 0xFF, 0x66, 0x8A, 0xFF, 0xC4, 0x49, 0xFF, 0xC4, 0x49, 0xFF,
-    0xE1, 0x20, 0xFF, 0xC2, 0x28, 0xFF, 0x86, 0x52, 0xFF, 0x43, 0x31, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x83, 0x39, 0xFF, 0xE4, 0x41, 0xFF, 0xA5, 0x41, 0xFF, 0x22, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0xC1, 0x20, 0xFF, 0x2B, 0x6C, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0x25, 0x4A, 0xFF, 0xA7, 0x5A, 0xFF, 0x84, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0x8A, 0x6B, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x04, 0x4A, 0xFF, 0xE5, 0x49, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x41, 0xFF, 0xC8, 0x73, 0xFF, 0x29, 0x6B, 0xFF, 0xA4, 0x41, 0xFF, 0x84, 0x41, 0xFF, 0xE4, 0x51, 0xFF, 0x2A, 0x9C, 0xFF, 0xA4, 0x41, 0xFF, 0xA5, 0x41, 0xFF, 0xA5, 0x41, 0xFF, 0xC5, 0x51, 0xFF, 0xCA, 0xEB, 0xFF, 0xE5, 0x71, 0xFF, 0xC5, 0x49, 0xFF, 0xA6, 0x49, 0xFF, 0xC5, 0x51, 0xFF, 0x45, 0x6A, 0xFF, 0x6A, 0xC3, 0xFF, 0x26, 0x7A, 0xFF, 0x85, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0x43, 0x71, 0xFF, 0x97, 0xFF, 0xFF, 0x26, 0x82, 0xFF, 0xA4, 0x49, 0xFF, 0xE4, 0x51, 0xFF, 0x07, 0x8A, 0xFF, 0x0A, 0xE4, 0xFF, 0xEA, 0xBA, 0xFF, 0x63, 0x51, 0xFF, 0x43, 0x49, 0xFF, 0x83, 0x49, 0xFF, 0x43, 0x69, 0xFF, 0xC8, 0xC2, 0xFF, 0xE6, 0x69, 0xFF, 0x22, 0x49, 0xFF,
-    0x22, 0x41, 0xFF, 0x43, 0x51, 0xFF, 0x87, 0xD2, 0xFF, 0x26, 0x82, 0xFF, 0x43, 0x41, 0xFF, 0x83, 0x49, 0xFF, 0x83, 0x41, 0xFF, 0xA7, 0x92, 0xFF, 0x42, 0x51, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x51, 0xFF, 0x03, 0x61, 0xFF, 0xE4, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0x64, 0x31, 0xFF, 0x05, 0x42, 0xFF, 0x84, 0x39, 0xFF, 0x22, 0x29, 0xFF, 0xE1, 0x20, 0xFF, 0x43, 0x31, 0xFF, 0x66, 0x52, 0xFF, 0x02, 0x29, 0xFF, 0x23, 0x31, 0xFF, 0xC5, 0x41, 0xFF, 0x05, 0x42, 0xFF, 0xE7, 0x5A, 0xFF, 0x43, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0xA3, 0x31, 0xFF, 0x69, 0x6B, 0xFF, 0x84, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x28, 0x5B, 0xFF, 0xC4, 0x41, 0xFF, 0xC7, 0x5A, 0xFF, 0xA4, 0x41, 0xFF, 0x66, 0x52, 0xFF, 0xC4, 0x41, 0xFF, 0x05, 0x4A, 0xFF, 0x04, 0x4A, 0xFF, 0xA4, 0x41, 0xFF, 0xC4, 0x49, 0xFF, 0x84, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xE4, 0x49, 0xFF, 0xE7, 0x5A, 0xFF, 0xA5, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0xA5, 0x51, 0xFF, 0x25, 0x5A, 0xFF, 0xC4, 0x49, 0xFF, 0xA5, 0x49, 0xFF, 0x85, 0x49, 0xFF, 0xE5, 0x51, 0xFF, 0xC7, 0x72, 0xFF, 0xC4, 0x51, 0xFF, 0x26, 0x7A, 0xFF, 0x46, 0x62, 0xFF,
-    0xC7, 0x5A, 0xFF, 0xA4, 0x61, 0xFF, 0xA4, 0x89, 0xFF, 0xC4, 0x51, 0xFF, 0xA7, 0x62, 0xFF, 0x84, 0x51, 0xFF, 0xA3, 0x51, 0xFF, 0xE4, 0x69, 0xFF, 0x63, 0x51, 0xFF, 0x66, 0x5A, 0xFF, 0xA4, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0x49, 0x93, 0xFF, 0x46, 0x5A, 0xFF, 0x63, 0x51, 0xFF, 0x43, 0x49, 0xFF, 0x64, 0x51, 0xFF, 0xC7, 0x82, 0xFF, 0xA4, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x43, 0x49, 0xFF, 0x63, 0x51, 0xFF, 0x87, 0x7A, 0xFF, 0xA4, 0x49, 0xFF, 0x63, 0x41, 0xFF, 0xA4, 0x49, 0xFF, 0xC5, 0x61, 0xFF, 0x43, 0x69, 0xFF, 0xC4, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0x05, 0x52, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0xC4, 0x39, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x84, 0x39, 0xFF, 0x26, 0x42, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x05, 0x42, 0xFF, 0x42, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0xC4, 0x41, 0xFF, 0x42, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0xC4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0xC7, 0x5A, 0xFF, 0xE5, 0x49, 0xFF, 0xE4, 0x49, 0xFF, 0x86, 0x52, 0xFF, 0xE4, 0x49, 0xFF,
-    0xE5, 0x41, 0xFF, 0xC5, 0x51, 0xFF, 0x83, 0x41, 0xFF, 0x28, 0x63, 0xFF, 0xA6, 0x49, 0xFF, 0xA5, 0x49, 0xFF, 0xA5, 0x51, 0xFF, 0xE4, 0x49, 0xFF, 0xE5, 0x51, 0xFF, 0xC4, 0x49, 0xFF, 0xA5, 0x49, 0xFF, 0x46, 0x5A, 0xFF, 0x04, 0x4A, 0xFF, 0xE4, 0x51, 0xFF, 0xE5, 0x69, 0xFF, 0xA3, 0x49, 0xFF, 0xA3, 0x41, 0xFF, 0x04, 0x5A, 0xFF, 0x25, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0x89, 0x62, 0xFF, 0xC4, 0x51, 0xFF, 0x25, 0x62, 0xFF, 0x64, 0x51, 0xFF, 0xA7, 0x62, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0x45, 0x5A, 0xFF, 0x83, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0x46, 0x62, 0xFF, 0x43, 0x49, 0xFF, 0x43, 0x49, 0xFF, 0x84, 0x59, 0xFF, 0xC4, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0x43, 0x51, 0xFF, 0x83, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0xA3, 0x49, 0xFF, 0x24, 0x61, 0xFF, 0xA3, 0x49, 0xFF, 0x83, 0x41, 0xFF, 0xC4, 0x51, 0xFF, 0xE4, 0x51, 0xFF, 0x05, 0x5A, 0xFF, 0x02, 0x21, 0xFF, 0xC5, 0x39, 0xFF, 0x83, 0x31, 0xFF, 0x02, 0x21, 0xFF, 0x02, 0x21, 0xFF, 0x22, 0x29, 0xFF, 0x45, 0x4A, 0xFF, 0xA4, 0x39, 0xFF, 0x02, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0xA2, 0x31, 0xFF, 0xA6, 0x4A, 0xFF, 0x43, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0xE5, 0x41, 0xFF,
-    0xA7, 0x52, 0xFF, 0x84, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0x63, 0x31, 0xFF, 0xC7, 0x5A, 0xFF, 0x83, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0xC3, 0x39, 0xFF, 0xC8, 0x6A, 0xFF, 0xE4, 0x49, 0xFF, 0x45, 0x52, 0xFF, 0xA7, 0x52, 0xFF, 0xC5, 0x49, 0xFF, 0xC5, 0x51, 0xFF, 0x69, 0x73, 0xFF, 0xC4, 0x51, 0xFF, 0xC5, 0x49, 0xFF, 0xC6, 0x51, 0xFF, 0xE4, 0x51, 0xFF, 0x68, 0x73, 0xFF, 0xC5, 0x49, 0xFF, 0xE5, 0x49, 0xFF, 0xC5, 0x51, 0xFF, 0xE4, 0x51, 0xFF, 0xE7, 0x6A, 0xFF, 0xC4, 0x51, 0xFF, 0xE5, 0x59, 0xFF, 0x25, 0x5A, 0xFF, 0xA9, 0x7B, 0xFF, 0xE4, 0x59, 0xFF, 0xE5, 0x61, 0xFF, 0x46, 0x5A, 0xFF, 0x63, 0x49, 0xFF, 0x8B, 0x8C, 0xFF, 0xEB, 0x93, 0xFF, 0xC4, 0x51, 0xFF, 0xA6, 0x51, 0xFF, 0x05, 0x5A, 0xFF, 0xA8, 0x7A, 0xFF, 0x85, 0x59, 0xFF, 0x64, 0x59, 0xFF, 0xC4, 0x59, 0xFF, 0x42, 0x49, 0xFF, 0xC4, 0x59, 0xFF, 0x63, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0xC7, 0x72, 0xFF, 0x05, 0x62, 0xFF, 0x43, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0xA5, 0x69, 0xFF, 0xC7, 0x7A, 0xFF, 0xE5, 0x59, 0xFF, 0x83, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0x63, 0x59, 0xFF, 0xC4, 0x49, 0xFF, 0xA4, 0x51, 0xFF, 0xE4, 0x51, 0xFF, 0xC4, 0x59, 0xFF, 0x05, 0x5A, 0xFF, 0xE4, 0x51, 0xFF,
-    0x01, 0x21, 0xFF, 0xE1, 0x20, 0xFF, 0x22, 0x29, 0xFF, 0x05, 0x42, 0xFF, 0x43, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x66, 0x4A, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0xA6, 0x4A, 0xFF, 0x63, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0xC3, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0x63, 0x39, 0xFF, 0x07, 0x63, 0xFF, 0x83, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xE4, 0x49, 0xFF, 0xA4, 0x49, 0xFF, 0x25, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0x26, 0x6A, 0xFF, 0x05, 0x72, 0xFF, 0x68, 0x73, 0xFF, 0x88, 0x62, 0xFF, 0xA4, 0x49, 0xFF, 0x05, 0x6A, 0xFF, 0xC7, 0x9A, 0xFF, 0x85, 0x62, 0xFF, 0xE4, 0x51, 0xFF, 0xE4, 0x51, 0xFF, 0xE4, 0x59, 0xFF, 0x05, 0x72, 0xFF, 0x05, 0x6A, 0xFF, 0xC5, 0x59, 0xFF, 0x63, 0x51, 0xFF, 0xE5, 0x59, 0xFF, 0xCA, 0x93, 0xFF, 0x26, 0x92, 0xFF, 0x26, 0x72, 0xFF, 0xC4, 0x51, 0xFF, 0xE4, 0x59, 0xFF, 0x04, 0x5A, 0xFF, 0xC4, 0x69, 0xFF, 0xC4, 0x51, 0xFF, 0xC6, 0x59, 0xFF, 0x29, 0x7B, 0xFF, 0x84, 0x61, 0xFF, 0x06, 0xA2, 0xFF, 0xE6, 0x79, 0xFF, 0x84, 0x59, 0xFF, 0x29, 0x83, 0xFF, 0xA4, 0x59, 0xFF, 0x24, 0x69, 0xFF, 0x64, 0x89, 0xFF, 0xC8, 0x82, 0xFF, 0x62, 0x59, 0xFF,
-    0x43, 0x51, 0xFF, 0x84, 0x61, 0xFF, 0xA4, 0xB9, 0xFF, 0xC4, 0x79, 0xFF, 0x63, 0x59, 0xFF, 0x84, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0x86, 0x92, 0xFF, 0x64, 0x71, 0xFF, 0x83, 0x59, 0xFF, 0xA4, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0xE5, 0x79, 0xFF, 0x65, 0xC9, 0xFF, 0xE5, 0x69, 0xFF, 0xE4, 0x51, 0xFF, 0x02, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0x25, 0x4A, 0xFF, 0x02, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0xE1, 0x20, 0xFF, 0xA7, 0x5A, 0xFF, 0x46, 0x4A, 0xFF, 0xA3, 0x39, 0xFF, 0x22, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x84, 0x39, 0xFF, 0xE7, 0x5A, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0x69, 0x7B, 0xFF, 0x43, 0x39, 0xFF, 0xC4, 0x49, 0xFF, 0x83, 0x41, 0xFF, 0x28, 0x5B, 0xFF, 0x65, 0x72, 0xFF, 0x48, 0x83, 0xFF, 0xC5, 0x49, 0xFF, 0xAA, 0x73, 0xFF, 0xC6, 0x49, 0xFF, 0x26, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x5A, 0xFF, 0x87, 0x62, 0xFF, 0xE4, 0x51, 0xFF, 0x26, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xA4, 0xFF, 0x25, 0x5A, 0xFF, 0xE5, 0x59, 0xFF, 0x05, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xB2, 0xFF, 0xE5, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0xA7, 0x7A, 0xFF, 0x69, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0x7A, 0xFF, 0xC4, 0x51, 0xFF,
-    0xA9, 0x7B, 0xFF, 0x26, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x61, 0xFF, 0x04, 0x52, 0xFF, 0xA4, 0x59, 0xFF, 0xA4, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0xB1, 0xFF, 0x29, 0x7B, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x79, 0xFF, 0x26, 0xE2, 0xFF, 0xDF, 0xFF, 0xFF, 0x64, 0x69, 0xFF, 0x83, 0x61, 0xFF, 0x63, 0x59, 0xFF, 0x05, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0x81, 0xFF, 0x63, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xC4, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0xA1, 0xFF, 0x83, 0x59, 0xFF, 0xA4, 0x51, 0xFF, 0xA4, 0x79, 0xFF, 0xA8, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xE4, 0x69, 0xFF, 0x25, 0x5A, 0xFF, 0xE1, 0x20, 0xFF, 0x02, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x66, 0x4A, 0xFF, 0x02, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0xE8, 0x62, 0xFF, 0x63, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x68, 0x6B, 0xFF, 0x83, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0x22, 0x29, 0xFF, 0xA4, 0x41, 0xFF, 0x83, 0x41, 0xFF, 0x83, 0x39, 0xFF, 0x84, 0x41, 0xFF, 0xA5, 0x41, 0xFF, 0x05, 0x4A, 0xFF, 0xC5, 0x51, 0xFF, 0xA5, 0x49, 0xFF, 0x25, 0x4A, 0xFF, 0xE4, 0x59, 0xFF, 0x48, 0xB3, 0xFF, 0x25, 0x6A, 0xFF, 0x46, 0x5A, 0xFF,
-    0xC7, 0x62, 0xFF, 0xCB, 0xC3, 0xFF, 0xE8, 0xB2, 0xFF, 0xC9, 0x93, 0xFF, 0x25, 0x62, 0xFF, 0x05, 0x5A, 0xFF, 0x25, 0x72, 0xFF, 0xFE, 0xFF, 0xFF, 0x6A, 0xD3, 0xFF, 0x26, 0x62, 0xFF, 0xC4, 0x51, 0xFF, 0xA7, 0x7A, 0xFF, 0x33, 0xEE, 0xFF, 0x69, 0xCB, 0xFF, 0x87, 0x9A, 0xFF, 0xE5, 0x59, 0xFF, 0x66, 0x6A, 0xFF, 0xD1, 0xFD, 0xFF, 0x96, 0xF6, 0xFF, 0xC4, 0x59, 0xFF, 0x85, 0x62, 0xFF, 0xA4, 0x69, 0xFF, 0x67, 0xE2, 0xFF, 0x8C, 0xF4, 0xFF, 0xE8, 0x8A, 0xFF, 0xA5, 0x59, 0xFF, 0xA5, 0x61, 0xFF, 0xC9, 0xDA, 0xFF, 0xFE, 0xFF, 0xFF, 0xC6, 0x79, 0xFF, 0x03, 0x69, 0xFF, 0x83, 0x61, 0xFF, 0x05, 0x92, 0xFF, 0xFD, 0xFF, 0xFF, 0x84, 0x69, 0xFF, 0x84, 0x71, 0xFF, 0x83, 0x59, 0xFF, 0x43, 0x59, 0xFF, 0xF9, 0xFF, 0xFF, 0xA5, 0x69, 0xFF, 0x84, 0x61, 0xFF, 0x63, 0x51, 0xFF, 0x46, 0x62, 0xFF, 0x47, 0xCA, 0xFF, 0xE5, 0x61, 0xFF, 0xE5, 0x61, 0xFF, 0x04, 0x52, 0xFF, 0x05, 0x5A, 0xFF, 0xA1, 0x38, 0xFF, 0x43, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x02, 0x21, 0xFF, 0x23, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0xA4, 0x41, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0x42, 0x31, 0xFF,
-    0xC4, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x25, 0x52, 0xFF, 0xA3, 0x41, 0xFF, 0x05, 0x52, 0xFF, 0x83, 0x39, 0xFF, 0x4A, 0x6B, 0xFF, 0x05, 0x52, 0xFF, 0xE4, 0x51, 0xFF, 0xE5, 0x49, 0xFF, 0x86, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0x85, 0x62, 0xFF, 0x25, 0x5A, 0xFF, 0x28, 0x73, 0xFF, 0x04, 0x52, 0xFF, 0x28, 0x9B, 0xFF, 0xE8, 0xA2, 0xFF, 0xA9, 0x9B, 0xFF, 0xA7, 0x6A, 0xFF, 0x25, 0x5A, 0xFF, 0x65, 0x6A, 0xFF, 0x49, 0xAB, 0xFF, 0xC7, 0x92, 0xFF, 0x25, 0x5A, 0xFF, 0xC4, 0x51, 0xFF, 0x65, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x9B, 0xFF, 0xA7, 0x82, 0xFF, 0x05, 0x52, 0xFF, 0x87, 0x6A, 0xFF, 0xBD, 0xFF, 0xFF, 0x25, 0x6A, 0xFF, 0xC3, 0x51, 0xFF, 0xE4, 0x59, 0xFF, 0xE4, 0x71, 0xFF, 0xDC, 0xFF, 0xFF, 0xC4, 0x71, 0xFF, 0x26, 0x6A, 0xFF, 0x85, 0x59, 0xFF, 0x45, 0x81, 0xFF, 0xE4, 0x99, 0xFF, 0x05, 0x91, 0xFF, 0x05, 0x79, 0xFF, 0x44, 0x59, 0xFF, 0xA4, 0x61, 0xFF, 0xA3, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x69, 0xFF, 0xE5, 0x61, 0xFF, 0x84, 0x59, 0xFF, 0xC4, 0x51, 0xFF, 0xA4, 0x51, 0xFF, 0xA4, 0x51, 0xFF, 0xE4, 0x59, 0xFF, 0xC4, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0xE5, 0x59, 0xFF, 0xC4, 0x51, 0xFF, 0x05, 0x5A, 0xFF, 0xE5, 0x69, 0xFF,
-    0xE2, 0x30, 0xFF, 0x02, 0x29, 0xFF, 0xE2, 0x28, 0xFF, 0x22, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x22, 0x29, 0xFF, 0x84, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0xA3, 0x39, 0xFF, 0xC7, 0x52, 0xFF, 0x63, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x28, 0x5B, 0xFF, 0xC4, 0x49, 0xFF, 0x63, 0x39, 0xFF, 0xE4, 0x49, 0xFF, 0x06, 0x5A, 0xFF, 0x87, 0x6A, 0xFF, 0xC5, 0x41, 0xFF, 0x06, 0x52, 0xFF, 0x46, 0x62, 0xFF, 0x89, 0x7B, 0xFF, 0x26, 0x62, 0xFF, 0x06, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0xC4, 0x51, 0xFF, 0x2D, 0x95, 0xFF, 0x04, 0x5A, 0xFF, 0x25, 0x52, 0xFF, 0x66, 0x72, 0xFF, 0xA7, 0x7A, 0xFF, 0x44, 0x62, 0xFF, 0x86, 0x62, 0xFF, 0x05, 0x52, 0xFF, 0x45, 0x62, 0xFF, 0xE7, 0x82, 0xFF, 0x66, 0x6A, 0xFF, 0x25, 0x5A, 0xFF, 0xE4, 0x51, 0xFF, 0xE7, 0x82, 0xFF, 0x94, 0xEE, 0xFF, 0x08, 0x8B, 0xFF, 0xA6, 0x8A, 0xFF, 0x69, 0x73, 0xFF, 0x65, 0x6A, 0xFF, 0xF4, 0xFE, 0xFF, 0x03, 0x5A, 0xFF, 0xE4, 0x51, 0xFF, 0x26, 0x5A, 0xFF, 0x45, 0x72, 0xFF, 0xE5, 0x81, 0xFF, 0x04, 0x62, 0xFF, 0xA4, 0x59, 0xFF, 0x84, 0x51, 0xFF, 0x24, 0x71, 0xFF, 0x85, 0x71, 0xFF, 0x85, 0x59, 0xFF, 0x65, 0x51, 0xFF, 0x66, 0x6A, 0xFF, 0x67, 0x82, 0xFF,
-    0x84, 0x59, 0xFF, 0x63, 0x51, 0xFF, 0xC5, 0x51, 0xFF, 0x84, 0x69, 0xFF, 0xE5, 0x69, 0xFF, 0xC5, 0x61, 0xFF, 0xA4, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0xA4, 0x51, 0xFF, 0x44, 0x71, 0xFF, 0xE4, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0xE5, 0x59, 0xFF, 0xE5, 0x69, 0xFF, 0xA5, 0x81, 0xFF, 0x64, 0x79, 0xFF, 0x81, 0x38, 0xFF, 0x23, 0x29, 0xFF, 0xC2, 0x40, 0xFF, 0x22, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0x63, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x45, 0x42, 0xFF, 0x23, 0x31, 0xFF, 0xE4, 0x41, 0xFF, 0x63, 0x31, 0xFF, 0x62, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0xC4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x41, 0xFF, 0xC7, 0x5A, 0xFF, 0x63, 0x39, 0xFF, 0xE4, 0x49, 0xFF, 0x2A, 0x93, 0xFF, 0x66, 0x62, 0xFF, 0xC6, 0x51, 0xFF, 0xE5, 0x59, 0xFF, 0x26, 0x72, 0xFF, 0x87, 0x62, 0xFF, 0x49, 0x83, 0xFF, 0x05, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x46, 0x62, 0xFF, 0x4C, 0x84, 0xFF, 0x05, 0x52, 0xFF, 0x69, 0x63, 0xFF, 0x66, 0x62, 0xFF, 0x2F, 0xA5, 0xFF, 0x28, 0x63, 0xFF, 0x66, 0x5A, 0xFF, 0x25, 0x52, 0xFF, 0x45, 0x5A, 0xFF, 0x2B, 0x94, 0xFF, 0x46, 0x62, 0xFF, 0x25, 0x52, 0xFF, 0x04, 0x52, 0xFF, 0xCA, 0x9B, 0xFF, 0xFE, 0xFF, 0xFF, 0x8A, 0x8B, 0xFF, 0xC7, 0x82, 0xFF, 0x25, 0x5A, 0xFF,
-    0x24, 0x5A, 0xFF, 0x45, 0x62, 0xFF, 0xA6, 0x6A, 0xFF, 0xC4, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0x6C, 0xAC, 0xFF, 0x86, 0x72, 0xFF, 0xC4, 0x59, 0xFF, 0xC4, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0xA3, 0x61, 0xFF, 0x25, 0x62, 0xFF, 0x84, 0x51, 0xFF, 0x26, 0x62, 0xFF, 0x6A, 0x83, 0xFF, 0xE5, 0x71, 0xFF, 0xA4, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0xA3, 0x49, 0xFF, 0xA3, 0x59, 0xFF, 0xC4, 0x69, 0xFF, 0xC4, 0x59, 0xFF, 0xC4, 0x51, 0xFF, 0x66, 0x6A, 0xFF, 0x24, 0x79, 0xFF, 0x84, 0x69, 0xFF, 0xE4, 0x59, 0xFF, 0xE5, 0x59, 0xFF, 0x25, 0x6A, 0xFF, 0xE6, 0x69, 0xFF, 0xE5, 0x69, 0xFF, 0xE5, 0x69, 0xFF, 0x43, 0x31, 0xFF, 0x02, 0x29, 0xFF, 0x66, 0x52, 0xFF, 0x22, 0x29, 0xFF, 0xA4, 0x41, 0xFF, 0x25, 0x42, 0xFF, 0x22, 0x29, 0xFF, 0x83, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x66, 0x4A, 0xFF, 0x83, 0x39, 0xFF, 0xC4, 0x39, 0xFF, 0x42, 0x31, 0xFF, 0x83, 0x41, 0xFF, 0x25, 0x42, 0xFF, 0x25, 0x4A, 0xFF, 0xC4, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0x28, 0xA3, 0xFF, 0xC4, 0x59, 0xFF, 0x0B, 0x83, 0xFF, 0xC5, 0x59, 0xFF, 0x28, 0x6B, 0xFF, 0x49, 0xBB, 0xFF, 0x74, 0xFE, 0xFF, 0x46, 0x72, 0xFF, 0xAB, 0x93, 0xFF, 0xE4, 0x49, 0xFF, 0x05, 0x72, 0xFF, 0xF6, 0xF6, 0xFF, 0x86, 0x6A, 0xFF, 0xCD, 0x94, 0xFF,
-    0xA6, 0x5A, 0xFF, 0x86, 0x62, 0xFF, 0xB2, 0xD5, 0xFF, 0x71, 0xA6, 0xFF, 0x28, 0x6B, 0xFF, 0xA7, 0x62, 0xFF, 0x86, 0x5A, 0xFF, 0x65, 0x5A, 0xFF, 0x25, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x26, 0x52, 0xFF, 0x28, 0x83, 0xFF, 0xA6, 0x5A, 0xFF, 0x89, 0x8B, 0xFF, 0xA7, 0x82, 0xFF, 0xA7, 0x62, 0xFF, 0x8F, 0xAD, 0xFF, 0x24, 0x52, 0xFF, 0xEA, 0x9B, 0xFF, 0xA3, 0x41, 0xFF, 0xA9, 0x73, 0xFF, 0xE7, 0x7A, 0xFF, 0x45, 0x62, 0xFF, 0x45, 0x72, 0xFF, 0x05, 0x5A, 0xFF, 0xE3, 0x51, 0xFF, 0x84, 0x71, 0xFF, 0xE4, 0x61, 0xFF, 0x24, 0x62, 0xFF, 0xEA, 0xC3, 0xFF, 0x83, 0x51, 0xFF, 0xA6, 0x69, 0xFF, 0xC5, 0x59, 0xFF, 0xE8, 0x7A, 0xFF, 0xFE, 0xFF, 0xFF, 0x83, 0x59, 0xFF, 0xA4, 0x61, 0xFF, 0x05, 0x6A, 0xFF, 0xA3, 0x61, 0xFF, 0x56, 0xFF, 0xFF, 0xE4, 0x91, 0xFF, 0xE5, 0x59, 0xFF, 0xE4, 0x59, 0xFF, 0x05, 0x62, 0xFF, 0xC9, 0xFA, 0xFF, 0xFD, 0xFF, 0xFF, 0x05, 0x6A, 0xFF, 0x05, 0x5A, 0xFF, 0xA2, 0x40, 0xFF, 0x02, 0x31, 0xFF, 0x43, 0x29, 0xFF, 0x83, 0x31, 0xFF, 0xE5, 0x41, 0xFF, 0x63, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x28, 0x6B, 0xFF, 0x83, 0x39, 0xFF, 0xA3, 0x39, 0xFF, 0x25, 0x4A, 0xFF, 0x83, 0x41, 0xFF, 0xAA, 0x7B, 0xFF, 0xE8, 0x62, 0xFF, 0x65, 0x4A, 0xFF,
-    0xC4, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0xA3, 0x81, 0xFF, 0xC9, 0x9B, 0xFF, 0xC8, 0x82, 0xFF, 0xC4, 0x51, 0xFF, 0x08, 0x6B, 0xFF, 0xC9, 0x93, 0xFF, 0x10, 0xFE, 0xFF, 0x87, 0x9A, 0xFF, 0xE8, 0x7A, 0xFF, 0x2B, 0x7C, 0xFF, 0x86, 0x6A, 0xFF, 0x96, 0xFF, 0xFF, 0x89, 0xBB, 0xFF, 0xCD, 0x94, 0xFF, 0x24, 0x52, 0xFF, 0xC7, 0x72, 0xFF, 0x27, 0xA3, 0xFF, 0xAB, 0x8C, 0xFF, 0x65, 0x52, 0xFF, 0x45, 0x52, 0xFF, 0x66, 0x5A, 0xFF, 0xE9, 0x8A, 0xFF, 0x04, 0x52, 0xFF, 0x45, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0xE7, 0x7A, 0xFF, 0x46, 0x5A, 0xFF, 0xE9, 0x93, 0xFF, 0xA7, 0x6A, 0xFF, 0x25, 0x52, 0xFF, 0x66, 0x5A, 0xFF, 0x86, 0x6A, 0xFF, 0x32, 0xE6, 0xFF, 0x86, 0x5A, 0xFF, 0x46, 0x5A, 0xFF, 0x87, 0x72, 0xFF, 0x45, 0x82, 0xFF, 0x2B, 0xB4, 0xFF, 0xE4, 0x51, 0xFF, 0x63, 0x59, 0xFF, 0xE5, 0x71, 0xFF, 0x49, 0xC3, 0xFF, 0xDC, 0xFF, 0xFF, 0xA3, 0x59, 0xFF, 0xA4, 0x51, 0xFF, 0x05, 0x82, 0xFF, 0x45, 0xBA, 0xFF, 0x96, 0xF6, 0xFF, 0xC4, 0x69, 0xFF, 0xA4, 0x71, 0xFF, 0xE5, 0x71, 0xFF, 0x05, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x79, 0xFF, 0xC4, 0x71, 0xFF, 0xE4, 0x61, 0xFF, 0x06, 0xC2, 0xFF, 0xB8, 0xFF, 0xFF, 0x46, 0x8A, 0xFF, 0xE5, 0x71, 0xFF, 0x25, 0x62, 0xFF, 0xE5, 0x69, 0xFF,
-    0x02, 0x21, 0xFF, 0x46, 0x4A, 0xFF, 0x22, 0x29, 0xFF, 0xE5, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xA3, 0x39, 0xFF, 0xC7, 0x5A, 0xFF, 0x43, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0x66, 0x4A, 0xFF, 0x42, 0x39, 0xFF, 0x87, 0x62, 0xFF, 0x66, 0x5A, 0xFF, 0x05, 0x4A, 0xFF, 0xC4, 0x41, 0xFF, 0xE4, 0x41, 0xFF, 0xE4, 0x41, 0xFF, 0x27, 0x52, 0xFF, 0x06, 0x52, 0xFF, 0xC4, 0x51, 0xFF, 0x65, 0x6A, 0xFF, 0x05, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0x25, 0x5A, 0xFF, 0xA6, 0x82, 0xFF, 0xFE, 0xFF, 0xFF, 0x48, 0x8B, 0xFF, 0x87, 0x62, 0xFF, 0xCA, 0x7B, 0xFF, 0x8A, 0xA3, 0xFF, 0xFE, 0xFF, 0xFF, 0xC6, 0x72, 0xFF, 0xA6, 0x5A, 0xFF, 0x69, 0x83, 0xFF, 0xAA, 0xA3, 0xFF, 0x6C, 0xB4, 0xFF, 0x07, 0x63, 0xFF, 0x66, 0x5A, 0xFF, 0x45, 0x5A, 0xFF, 0x49, 0x93, 0xFF, 0x27, 0x7B, 0xFF, 0x66, 0x52, 0xFF, 0x05, 0x4A, 0xFF, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x7B, 0xFF, 0x86, 0x6A, 0xFF, 0xEA, 0x73, 0xFF, 0xE7, 0x72, 0xFF, 0xFE, 0xFF, 0xFF, 0xC7, 0x72, 0xFF, 0xC3, 0x51, 0xFF, 0x86, 0x62, 0xFF, 0x69, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x86, 0x72, 0xFF, 0x25, 0x5A, 0xFF, 0x05, 0x62, 0xFF, 0x29, 0xD3, 0xFF, 0x56, 0xF6, 0xFF, 0xA5, 0x71, 0xFF, 0x05, 0x5A, 0xFF, 0xA6, 0x72, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x4D, 0xE4, 0xFF, 0xA4, 0x89, 0xFF, 0x06, 0x72, 0xFF, 0x64, 0x71, 0xFF, 0x8E, 0xFD, 0xFF, 0xE6, 0x81, 0xFF, 0xE6, 0x79, 0xFF, 0x44, 0x79, 0xFF, 0x43, 0x71, 0xFF, 0x09, 0x8B, 0xFF, 0x47, 0x72, 0xFF, 0x06, 0x6A, 0xFF, 0x05, 0x62, 0xFF, 0xE5, 0x61, 0xFF, 0x26, 0x6A, 0xFF, 0x25, 0x62, 0xFF, 0xC3, 0x50, 0xFF, 0xE5, 0x49, 0xFF, 0xC5, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x41, 0x31, 0xFF, 0x42, 0x31, 0xFF, 0xA7, 0x62, 0xFF, 0x63, 0x39, 0xFF, 0x66, 0x52, 0xFF, 0x63, 0x31, 0xFF, 0xA3, 0x39, 0xFF, 0x66, 0x5A, 0xFF, 0x49, 0x83, 0xFF, 0x84, 0x41, 0xFF, 0x25, 0x4A, 0xFF, 0x05, 0x4A, 0xFF, 0xE7, 0x6A, 0xFF, 0x8A, 0x73, 0xFF, 0x27, 0x52, 0xFF, 0xC5, 0x49, 0xFF, 0xC4, 0x59, 0xFF, 0x2B, 0x84, 0xFF, 0x05, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x87, 0x6A, 0xFF, 0xCA, 0x83, 0xFF, 0x48, 0x8B, 0xFF, 0xC7, 0x6A, 0xFF, 0x86, 0x6A, 0xFF, 0x8C, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x93, 0xFF, 0x89, 0x63, 0xFF, 0xAA, 0x7B, 0xFF, 0xCA, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x94, 0xFF, 0x66, 0x5A, 0xFF, 0xC7, 0x62, 0xFF, 0xBA, 0xF7, 0xFF, 0xAA, 0x9B, 0xFF, 0xA7, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0x8C, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x93, 0xFF, 0x07, 0x7B, 0xFF, 0xA6, 0x62, 0xFF,
-    0xDA, 0xFF, 0xFF, 0x0A, 0xBC, 0xFF, 0xB0, 0xC5, 0xFF, 0x85, 0x5A, 0xFF, 0x29, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x82, 0xFF, 0x25, 0x5A, 0xFF, 0x45, 0x62, 0xFF, 0xE7, 0x92, 0xFF, 0xDF, 0xFF, 0xFF, 0x86, 0x82, 0xFF, 0xC4, 0x59, 0xFF, 0x05, 0x62, 0xFF, 0xFA, 0xFF, 0xFF, 0x25, 0x8A, 0xFF, 0xE5, 0x79, 0xFF, 0xA4, 0x59, 0xFF, 0xA7, 0x72, 0xFF, 0xC4, 0x61, 0xFF, 0x85, 0x71, 0xFF, 0xC4, 0x59, 0xFF, 0xA4, 0x51, 0xFF, 0xA7, 0x72, 0xFF, 0xE5, 0x69, 0xFF, 0xA5, 0x71, 0xFF, 0x65, 0x79, 0xFF, 0xC5, 0x81, 0xFF, 0x46, 0x6A, 0xFF, 0x05, 0x5A, 0xFF, 0x25, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0xC3, 0x50, 0xFF, 0x84, 0x49, 0xFF, 0xE3, 0x40, 0xFF, 0x63, 0x39, 0xFF, 0x22, 0x31, 0xFF, 0xE4, 0x41, 0xFF, 0x26, 0x5A, 0xFF, 0x43, 0x31, 0xFF, 0x63, 0x39, 0xFF, 0xC7, 0x52, 0xFF, 0x43, 0x39, 0xFF, 0x2A, 0x83, 0xFF, 0x4A, 0x83, 0xFF, 0xC4, 0x39, 0xFF, 0xC7, 0x5A, 0xFF, 0xC4, 0x41, 0xFF, 0xC9, 0x7A, 0xFF, 0xC4, 0x41, 0xFF, 0x89, 0x6B, 0xFF, 0x46, 0x5A, 0xFF, 0xE4, 0x51, 0xFF, 0xE5, 0x51, 0xFF, 0x4A, 0x84, 0xFF, 0x05, 0x52, 0xFF, 0x25, 0x5A, 0xFF, 0x08, 0x73, 0xFF, 0x06, 0x73, 0xFF, 0x6C, 0x94, 0xFF, 0x28, 0x7B, 0xFF, 0x48, 0x73, 0xFF, 0xA9, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE6, 0x62, 0xFF, 0x07, 0x6B, 0xFF, 0xA9, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x7C, 0xFF, 0x86, 0x52, 0xFF, 0xC7, 0x5A, 0xFF, 0x12, 0xEE, 0xFF, 0xEA, 0x8B, 0xFF, 0x86, 0x52, 0xFF, 0xA6, 0x5A, 0xFF, 0x8F, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xBD, 0xFF, 0xE9, 0x9B, 0xFF, 0x8B, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x6B, 0xFF, 0x97, 0xFF, 0xFF, 0x28, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE5, 0xFF, 0x29, 0x8B, 0xFF, 0x05, 0x5A, 0xFF, 0xC6, 0x6A, 0xFF, 0xDD, 0xFF, 0xFF, 0xE7, 0x8A, 0xFF, 0x66, 0x72, 0xFF, 0x87, 0x72, 0xFF, 0x28, 0x73, 0xFF, 0xC4, 0x51, 0xFF, 0xC4, 0x71, 0xFF, 0x06, 0x6A, 0xFF, 0x08, 0x73, 0xFF, 0xC5, 0x51, 0xFF, 0xA5, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0xC7, 0x6A, 0xFF, 0xE4, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0x05, 0x62, 0xFF, 0x05, 0x52, 0xFF, 0x45, 0x5A, 0xFF, 0x25, 0x5A, 0xFF, 0xE5, 0x61, 0xFF, 0x25, 0x5A, 0xFF, 0x25, 0x5A, 0xFF, 0x45, 0x62, 0xFF, 0xA3, 0x50, 0xFF, 0xA2, 0x58, 0xFF, 0x22, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0xC4, 0x51, 0xFF, 0x45, 0x4A, 0xFF, 0xE9, 0x6A, 0xFF, 0x63, 0x39, 0xFF, 0x6A, 0x7B, 0xFF, 0xA7, 0x62, 0xFF, 0x29, 0x7B, 0xFF, 0xA4, 0x59, 0xFF, 0xA9, 0x62, 0xFF, 0x08, 0x5B, 0xFF,
-    0x6B, 0x8B, 0xFF, 0x05, 0x62, 0xFF, 0xE4, 0x69, 0xFF, 0x88, 0x7B, 0xFF, 0x25, 0x62, 0xFF, 0xE4, 0x51, 0xFF, 0xA7, 0x6A, 0xFF, 0xED, 0x7C, 0xFF, 0x85, 0x72, 0xFF, 0x45, 0x5A, 0xFF, 0xA6, 0x6A, 0xFF, 0x0A, 0x6C, 0xFF, 0x0B, 0x8C, 0xFF, 0x0A, 0x8C, 0xFF, 0xA9, 0x73, 0xFF, 0xFE, 0xFF, 0xFF, 0x88, 0x6B, 0xFF, 0x68, 0x63, 0xFF, 0xA9, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x7C, 0xFF, 0x86, 0x52, 0xFF, 0xC7, 0x5A, 0xFF, 0x6C, 0x9C, 0xFF, 0x48, 0x6B, 0xFF, 0xA6, 0x52, 0xFF, 0x86, 0x52, 0xFF, 0xFB, 0xFF, 0xFF, 0xED, 0xA4, 0xFF, 0x6F, 0xB5, 0xFF, 0xA9, 0x93, 0xFF, 0x6C, 0x94, 0xFF, 0x28, 0x73, 0xFF, 0xC6, 0x5A, 0xFF, 0xD1, 0xCD, 0xFF, 0xEE, 0x9C, 0xFF, 0x86, 0x5A, 0xFF, 0x0B, 0xA4, 0xFF, 0xC7, 0x72, 0xFF, 0x89, 0x6B, 0xFF, 0xA6, 0x62, 0xFF, 0xC4, 0x51, 0xFF, 0xA7, 0x72, 0xFF, 0xAA, 0x8B, 0xFF, 0x86, 0x5A, 0xFF, 0x05, 0x5A, 0xFF, 0xA4, 0x51, 0xFF, 0x25, 0x6A, 0xFF, 0x45, 0x62, 0xFF, 0xA4, 0x51, 0xFF, 0x05, 0x62, 0xFF, 0x06, 0x62, 0xFF, 0x25, 0x62, 0xFF, 0xC5, 0x59, 0xFF, 0xC6, 0x51, 0xFF, 0xE6, 0x51, 0xFF, 0x06, 0x72, 0xFF, 0x05, 0x62, 0xFF, 0xA5, 0x79, 0xFF, 0xA5, 0x79, 0xFF, 0xE6, 0x69, 0xFF, 0xA6, 0x79, 0xFF, 0xE6, 0x69, 0xFF, 0x46, 0x5A, 0xFF,
-    0xA2, 0x48, 0xFF, 0x22, 0x39, 0xFF, 0xA7, 0x5A, 0xFF, 0x65, 0x4A, 0xFF, 0x43, 0x29, 0xFF, 0x67, 0x52, 0xFF, 0x83, 0x41, 0xFF, 0xC7, 0x6A, 0xFF, 0x71, 0xB5, 0xFF, 0x26, 0x52, 0xFF, 0x26, 0x52, 0xFF, 0xC4, 0x41, 0xFF, 0x64, 0x59, 0xFF, 0xFE, 0xFF, 0xFF, 0x66, 0x72, 0xFF, 0xC8, 0x62, 0xFF, 0xAB, 0x8B, 0xFF, 0x86, 0x5A, 0xFF, 0x6D, 0xFC, 0xFF, 0xFD, 0xFF, 0xFF, 0xC8, 0xAA, 0xFF, 0x86, 0x62, 0xFF, 0x49, 0x7B, 0xFF, 0x45, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xA3, 0xFF, 0xE7, 0x6A, 0xFF, 0xA6, 0x5A, 0xFF, 0xA6, 0x62, 0xFF, 0xAC, 0xAC, 0xFF, 0x47, 0x63, 0xFF, 0x89, 0x73, 0xFF, 0x8F, 0x85, 0xFF, 0xE7, 0x5A, 0xFF, 0x2D, 0xB5, 0xFF, 0xA9, 0x7B, 0xFF, 0xAD, 0x8C, 0xFF, 0x86, 0x4A, 0xFF, 0xA6, 0x52, 0xFF, 0x12, 0xC6, 0xFF, 0x67, 0x63, 0xFF, 0xE7, 0x5A, 0xFF, 0x28, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0xFF, 0x4B, 0x9C, 0xFF, 0xC7, 0x62, 0xFF, 0xAC, 0x74, 0xFF, 0xA6, 0x5A, 0xFF, 0xC6, 0x62, 0xFF, 0x0A, 0x94, 0xFF, 0xEB, 0x83, 0xFF, 0x65, 0x52, 0xFF, 0xA9, 0x8B, 0xFF, 0x85, 0x5A, 0xFF, 0x52, 0xB6, 0xFF, 0x87, 0x72, 0xFF, 0xA6, 0x62, 0xFF, 0xE7, 0x6A, 0xFF, 0x69, 0x7B, 0xFF, 0x68, 0x83, 0xFF, 0xA4, 0x69, 0xFF, 0xC7, 0x6A, 0xFF, 0xAB, 0xA3, 0xFF,
-    0x25, 0x92, 0xFF, 0xE4, 0x69, 0xFF, 0x89, 0xBB, 0xFF, 0xE5, 0x69, 0xFF, 0xE5, 0x69, 0xFF, 0x87, 0xCA, 0xFF, 0x25, 0xCA, 0xFF, 0xCE, 0xF4, 0xFF, 0xA5, 0x71, 0xFF, 0x06, 0x7A, 0xFF, 0x49, 0xEB, 0xFF, 0x87, 0xCA, 0xFF, 0x49, 0xD3, 0xFF, 0x8B, 0xAB, 0xFF, 0x66, 0x62, 0xFF, 0x06, 0x6A, 0xFF, 0xA6, 0x52, 0xFF, 0x63, 0x31, 0xFF, 0x86, 0x52, 0xFF, 0x42, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0x08, 0x63, 0xFF, 0xA7, 0x5A, 0xFF, 0x01, 0x29, 0xFF, 0x46, 0x52, 0xFF, 0x83, 0x39, 0xFF, 0x8A, 0x73, 0xFF, 0x86, 0x5A, 0xFF, 0xE4, 0x69, 0xFF, 0x42, 0x39, 0xFF, 0x45, 0x52, 0xFF, 0x70, 0xAD, 0xFF, 0x85, 0x62, 0xFF, 0xE4, 0x49, 0xFF, 0x65, 0x62, 0xFF, 0x49, 0x93, 0xFF, 0x33, 0xF6, 0xFF, 0x89, 0x8B, 0xFF, 0xEB, 0x83, 0xFF, 0x66, 0x5A, 0xFF, 0xE6, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xAC, 0xFF, 0x68, 0x73, 0xFF, 0x07, 0x6B, 0xFF, 0xED, 0x94, 0xFF, 0xFB, 0xFF, 0xFF, 0x48, 0x6B, 0xFF, 0x68, 0x5B, 0xFF, 0x0A, 0x6C, 0xFF, 0xE6, 0x52, 0xFF, 0xD7, 0xDF, 0xFF, 0x8F, 0x7D, 0xFF, 0xA6, 0x4A, 0xFF, 0xA6, 0x4A, 0xFF, 0xA6, 0x4A, 0xFF, 0x85, 0x42, 0xFF, 0x46, 0x4A, 0xFF, 0x28, 0x53, 0xFF, 0x27, 0x63, 0xFF, 0xCC, 0x8C, 0xFF, 0x8A, 0x83, 0xFF, 0x07, 0x5B, 0xFF, 0x49, 0x63, 0xFF,
-    0x45, 0x52, 0xFF, 0xEC, 0x9C, 0xFF, 0x89, 0x73, 0xFF, 0xAA, 0x7B, 0xFF, 0x25, 0x4A, 0xFF, 0xC7, 0x6A, 0xFF, 0x6F, 0xB5, 0xFF, 0xA7, 0x62, 0xFF, 0x66, 0x5A, 0xFF, 0x07, 0x83, 0xFF, 0x48, 0xA3, 0xFF, 0x86, 0x72, 0xFF, 0x66, 0x5A, 0xFF, 0x25, 0x62, 0xFF, 0x89, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x92, 0xFF, 0x86, 0x72, 0xFF, 0x25, 0x6A, 0xFF, 0xC4, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x8A, 0xFF, 0xE5, 0x61, 0xFF, 0x67, 0x72, 0xFF, 0x6A, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x92, 0xFF, 0x45, 0x72, 0xFF, 0x46, 0x5A, 0xFF, 0x06, 0x6A, 0xFF, 0xFE, 0xFF, 0xFF, 0x87, 0xCA, 0xFF, 0xE3, 0x50, 0xFF, 0x43, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x63, 0x31, 0xFF, 0x65, 0x4A, 0xFF, 0xE5, 0x49, 0xFF, 0xA7, 0x62, 0xFF, 0x01, 0x31, 0xFF, 0xA6, 0x52, 0xFF, 0x83, 0x39, 0xFF, 0x66, 0x5A, 0xFF, 0x84, 0x49, 0xFF, 0xA4, 0x51, 0xFF, 0x69, 0x6B, 0xFF, 0xC7, 0x62, 0xFF, 0x08, 0x7B, 0xFF, 0x25, 0x6A, 0xFF, 0xCA, 0x7B, 0xFF, 0xE7, 0x6A, 0xFF, 0x6A, 0x83, 0xFF, 0xC7, 0x62, 0xFF, 0x0A, 0x9C, 0xFF, 0xEE, 0xAC, 0xFF, 0x07, 0x5B, 0xFF, 0xA7, 0x62, 0xFF, 0xB4, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x48, 0x73, 0xFF, 0x2A, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xC5, 0xFF,
-    0xCA, 0x73, 0xFF, 0x0A, 0x64, 0xFF, 0xEA, 0x73, 0xFF, 0xCF, 0x9D, 0xFF, 0x6B, 0x6C, 0xFF, 0xA7, 0x4A, 0xFF, 0x86, 0x4A, 0xFF, 0x28, 0x53, 0xFF, 0x85, 0x42, 0xFF, 0x66, 0x42, 0xFF, 0x66, 0x42, 0xFF, 0xEA, 0x7B, 0xFF, 0x2E, 0x95, 0xFF, 0x27, 0x63, 0xFF, 0xE7, 0x62, 0xFF, 0x28, 0x63, 0xFF, 0x33, 0xD6, 0xFF, 0xC7, 0x5A, 0xFF, 0x07, 0x6B, 0xFF, 0x69, 0x7B, 0xFF, 0xDF, 0xFF, 0xFF, 0x70, 0xBD, 0xFF, 0xE7, 0x6A, 0xFF, 0xA7, 0x5A, 0xFF, 0xA9, 0x93, 0xFF, 0xFD, 0xFF, 0xFF, 0xE8, 0x9A, 0xFF, 0x66, 0x6A, 0xFF, 0xE5, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x82, 0xFF, 0xC4, 0x61, 0xFF, 0x0C, 0xA4, 0xFF, 0xEA, 0xA3, 0xFF, 0xE4, 0x61, 0xFF, 0x67, 0x7A, 0xFF, 0xA7, 0x72, 0xFF, 0x05, 0x62, 0xFF, 0xE8, 0x82, 0xFF, 0x69, 0x8A, 0xFF, 0x26, 0x62, 0xFF, 0x66, 0x62, 0xFF, 0x26, 0x62, 0xFF, 0x86, 0x62, 0xFF, 0x25, 0x62, 0xFF, 0x46, 0x5A, 0xFF, 0x87, 0x62, 0xFF, 0xC3, 0x50, 0xFF, 0x22, 0x31, 0xFF, 0x43, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0x22, 0x31, 0xFF, 0x85, 0x52, 0xFF, 0xE8, 0x72, 0xFF, 0x64, 0x39, 0xFF, 0x84, 0x41, 0xFF, 0xC7, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0x69, 0x7B, 0xFF, 0x4C, 0x9C, 0xFF,
-    0xC4, 0x49, 0xFF, 0x87, 0x62, 0xFF, 0x09, 0x6B, 0xFF, 0xCA, 0x6B, 0xFF, 0x46, 0x52, 0xFF, 0x08, 0x6B, 0xFF, 0x28, 0x7B, 0xFF, 0xAC, 0x7C, 0xFF, 0xA6, 0x5A, 0xFF, 0xEE, 0xAC, 0xFF, 0xA9, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x94, 0xFF, 0x0A, 0x8C, 0xFF, 0x26, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x9D, 0xFF, 0x48, 0x5B, 0xFF, 0xE7, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x84, 0xFF, 0xC6, 0x4A, 0xFF, 0xE7, 0x52, 0xFF, 0xEA, 0x6B, 0xFF, 0x07, 0x53, 0xFF, 0xA6, 0x42, 0xFF, 0xC7, 0x52, 0xFF, 0xF7, 0xCE, 0xFF, 0xAC, 0x8C, 0xFF, 0x4B, 0x8C, 0xFF, 0xCE, 0xAC, 0xFF, 0xFE, 0xFF, 0xFF, 0x4C, 0x94, 0xFF, 0xE7, 0x62, 0xFF, 0x2A, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x8C, 0xFF, 0x48, 0x7B, 0xFF, 0x8D, 0x9C, 0xFF, 0x4B, 0x84, 0xFF, 0x32, 0xBD, 0xFF, 0xCA, 0x93, 0xFF, 0x86, 0x6A, 0xFF, 0x08, 0x73, 0xFF, 0xE8, 0x6A, 0xFF, 0x05, 0x5A, 0xFF, 0x05, 0x5A, 0xFF, 0x08, 0x7B, 0xFF, 0x66, 0x6A, 0xFF, 0x49, 0x83, 0xFF, 0xC4, 0x51, 0xFF, 0x86, 0x6A, 0xFF, 0x66, 0x6A, 0xFF, 0xE6, 0x51, 0xFF, 0xC5, 0x49, 0xFF, 0xA8, 0x72, 0xFF, 0x88, 0x7A, 0xFF, 0x26, 0x5A, 0xFF, 0x25, 0x62, 0xFF, 0x05, 0x5A, 0xFF, 0x46, 0x5A, 0xFF, 0x66, 0x62, 0xFF, 0x66, 0x5A, 0xFF, 0x86, 0x62, 0xFF,
-    0xC2, 0x40, 0xFF, 0xA1, 0x38, 0xFF, 0x03, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x49, 0x6B, 0xFF, 0x68, 0x5A, 0xFF, 0xA5, 0x39, 0xFF, 0x05, 0x42, 0xFF, 0x83, 0x41, 0xFF, 0x05, 0x52, 0xFF, 0x50, 0xBD, 0xFF, 0x2C, 0x9C, 0xFF, 0x4B, 0x94, 0xFF, 0xE4, 0x51, 0xFF, 0xC7, 0x52, 0xFF, 0x07, 0x63, 0xFF, 0x66, 0x62, 0xFF, 0xEB, 0x83, 0xFF, 0x2B, 0x7C, 0xFF, 0xC7, 0x62, 0xFF, 0xAA, 0x73, 0xFF, 0xA6, 0x4A, 0xFF, 0xAF, 0x95, 0xFF, 0xA9, 0x73, 0xFF, 0x07, 0x5B, 0xFF, 0xFF, 0xF7, 0xFF, 0x4A, 0x6C, 0xFF, 0x89, 0x6B, 0xFF, 0xCC, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0x53, 0xFF, 0x48, 0x5B, 0xFF, 0xCF, 0x8D, 0xFF, 0xFA, 0xF7, 0xFF, 0xE6, 0x4A, 0xFF, 0x07, 0x4B, 0xFF, 0x37, 0xBF, 0xFF, 0x2B, 0x64, 0xFF, 0xA6, 0x42, 0xFF, 0x0B, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xAE, 0xFF, 0xF2, 0xB5, 0xFF, 0xEA, 0x73, 0xFF, 0x7B, 0xEF, 0xFF, 0x0E, 0xA5, 0xFF, 0x45, 0x4A, 0xFF, 0x88, 0x6B, 0xFF, 0x47, 0x5B, 0xFF, 0x44, 0x52, 0xFF, 0xC9, 0x7B, 0xFF, 0x68, 0x63, 0xFF, 0xE8, 0x62, 0xFF, 0x65, 0x5A, 0xFF, 0x2B, 0x8C, 0xFF, 0x45, 0x52, 0xFF, 0x09, 0x73, 0xFF, 0x04, 0x52, 0xFF, 0xE7, 0x62, 0xFF, 0xC4, 0x49, 0xFF, 0xC4, 0x49, 0xFF,
-    0xC7, 0x6A, 0xFF, 0xA7, 0x6A, 0xFF, 0xE4, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0xC8, 0x72, 0xFF, 0x46, 0x5A, 0xFF, 0xE4, 0x51, 0xFF, 0xC8, 0x72, 0xFF, 0xE8, 0x72, 0xFF, 0x46, 0x5A, 0xFF, 0x45, 0x5A, 0xFF, 0x25, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0xA7, 0x62, 0xFF, 0x86, 0x62, 0xFF, 0x66, 0x5A, 0xFF, 0xE2, 0x38, 0xFF, 0x87, 0x52, 0xFF, 0x84, 0x39, 0xFF, 0xE8, 0x6A, 0xFF, 0x63, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0xC8, 0x6A, 0xFF, 0xE7, 0x7A, 0xFF, 0xA5, 0x41, 0xFF, 0xE4, 0x41, 0xFF, 0xE3, 0x41, 0xFF, 0xE4, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0xA3, 0xFF, 0xEA, 0x83, 0xFF, 0x66, 0x5A, 0xFF, 0x89, 0x6B, 0xFF, 0x85, 0x82, 0xFF, 0xFD, 0xFF, 0xFF, 0x6F, 0xDD, 0xFF, 0x0B, 0x94, 0xFF, 0xE7, 0x62, 0xFF, 0xCD, 0x9C, 0xFF, 0x6C, 0xA4, 0xFF, 0xA9, 0x6B, 0xFF, 0x72, 0x9E, 0xFF, 0xCD, 0x74, 0xFF, 0xE7, 0x5A, 0xFF, 0x8C, 0x94, 0xFF, 0xCA, 0x5B, 0xFF, 0xC9, 0x63, 0xFF, 0x09, 0x4C, 0xFF, 0xFF, 0xEF, 0xFF, 0x68, 0x5B, 0xFF, 0x72, 0x76, 0xFF, 0xFD, 0xB7, 0xFF, 0xE7, 0x4A, 0xFF, 0xC7, 0x4A, 0xFF, 0x4B, 0x44, 0xFF, 0x47, 0x43, 0xFF, 0x86, 0x42, 0xFF, 0x27, 0x3B, 0xFF, 0x2B, 0x74, 0xFF, 0xD1, 0x8D, 0xFF, 0x4B, 0x8C, 0xFF, 0x49, 0x63, 0xFF, 0x8A, 0x63, 0xFF,
-    0x8A, 0x6B, 0xFF, 0x28, 0x53, 0xFF, 0x0A, 0x84, 0xFF, 0xA6, 0x52, 0xFF, 0x07, 0x5B, 0xFF, 0x69, 0x73, 0xFF, 0x66, 0x5A, 0xFF, 0x6B, 0x9C, 0xFF, 0x44, 0x52, 0xFF, 0x28, 0x73, 0xFF, 0x66, 0x5A, 0xFF, 0xA6, 0x5A, 0xFF, 0x6E, 0xCD, 0xFF, 0x0B, 0xA4, 0xFF, 0x25, 0x5A, 0xFF, 0xE4, 0x49, 0xFF, 0x85, 0x5A, 0xFF, 0x87, 0x82, 0xFF, 0xA9, 0xAB, 0xFF, 0x25, 0x5A, 0xFF, 0x86, 0x72, 0xFF, 0x07, 0x93, 0xFF, 0xE4, 0x59, 0xFF, 0x49, 0xA3, 0xFF, 0x66, 0x8A, 0xFF, 0x86, 0x82, 0xFF, 0xA7, 0xDA, 0xFF, 0x86, 0x8A, 0xFF, 0xEB, 0xBB, 0xFF, 0x86, 0x7A, 0xFF, 0x66, 0x6A, 0xFF, 0xC7, 0x6A, 0xFF, 0x25, 0x4A, 0xFF, 0x82, 0x39, 0xFF, 0x86, 0x4A, 0xFF, 0x63, 0x31, 0xFF, 0x22, 0x31, 0xFF, 0xA7, 0x5A, 0xFF, 0xC3, 0x41, 0xFF, 0xAF, 0xC4, 0xFF, 0x8A, 0x7B, 0xFF, 0x83, 0x39, 0xFF, 0x29, 0x7B, 0xFF, 0x89, 0x73, 0xFF, 0x05, 0x5A, 0xFF, 0x86, 0x72, 0xFF, 0x66, 0x7A, 0xFF, 0x50, 0xDD, 0xFF, 0x93, 0xFE, 0xFF, 0x49, 0x73, 0xFF, 0x25, 0x52, 0xFF, 0xA6, 0x8A, 0xFF, 0xF5, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0xAC, 0xFF, 0xCD, 0x8C, 0xFF, 0x28, 0x5B, 0xFF, 0x10, 0xB6, 0xFF, 0x90, 0xB5, 0xFF, 0x4F, 0x9D, 0xFF, 0xE7, 0x5A, 0xFF, 0xEE, 0x94, 0xFF, 0x96, 0xC7, 0xFF, 0x2B, 0x74, 0xFF,
-    0xE6, 0x42, 0xFF, 0x27, 0x43, 0xFF, 0x6C, 0x64, 0xFF, 0xD9, 0xDF, 0xFF, 0x89, 0x5B, 0xFF, 0xC7, 0x3A, 0xFF, 0xA6, 0x42, 0xFF, 0xA6, 0x3A, 0xFF, 0xA8, 0x53, 0xFF, 0xA6, 0x42, 0xFF, 0xC6, 0x42, 0xFF, 0x69, 0x63, 0xFF, 0xCC, 0x7C, 0xFF, 0x08, 0x5B, 0xFF, 0xC7, 0x52, 0xFF, 0x28, 0x5B, 0xFF, 0x49, 0x6B, 0xFF, 0x8C, 0x8C, 0xFF, 0x48, 0x63, 0xFF, 0xA6, 0x52, 0xFF, 0x66, 0x4A, 0xFF, 0x2B, 0x84, 0xFF, 0xCD, 0x9C, 0xFF, 0x44, 0x4A, 0xFF, 0x28, 0x7B, 0xFF, 0xEA, 0x8B, 0xFF, 0x4B, 0x94, 0xFF, 0x45, 0x62, 0xFF, 0x65, 0x5A, 0xFF, 0xD0, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0xAC, 0xFF, 0xE4, 0x71, 0xFF, 0x85, 0x72, 0xFF, 0xFD, 0xFF, 0xFF, 0x66, 0xB2, 0xFF, 0x9F, 0xFF, 0xFF, 0x25, 0x5A, 0xFF, 0x86, 0x6A, 0xFF, 0x8C, 0xF4, 0xFF, 0x25, 0xCA, 0xFF, 0x4C, 0xE3, 0xFF, 0x67, 0x82, 0xFF, 0xC8, 0x8A, 0xFF, 0x0A, 0xE3, 0xFF, 0xAB, 0xBB, 0xFF, 0x77, 0xFF, 0xFF, 0xA6, 0x8A, 0xFF, 0x03, 0x49, 0xFF, 0xA7, 0x62, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0xE4, 0x41, 0xFF, 0x83, 0x31, 0xFF, 0x29, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF, 0x23, 0x31, 0xFF, 0x08, 0x63, 0xFF, 0x28, 0x63, 0xFF, 0x04, 0x4A, 0xFF, 0xA7, 0x62, 0xFF, 0xC7, 0x6A, 0xFF, 0x06, 0x73, 0xFF,
-    0xE7, 0x62, 0xFF, 0x69, 0x73, 0xFF, 0x69, 0x6B, 0xFF, 0x6B, 0x7C, 0xFF, 0x48, 0x6B, 0xFF, 0x8C, 0x9C, 0xFF, 0xD1, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x8D, 0xFF, 0x89, 0x73, 0xFF, 0x4B, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xED, 0x84, 0xFF, 0xE9, 0x6B, 0xFF, 0x51, 0x96, 0xFF, 0xEC, 0x7C, 0xFF, 0x27, 0x43, 0xFF, 0x07, 0x4B, 0xFF, 0xFA, 0xAF, 0xFF, 0xAA, 0x73, 0xFF, 0xC6, 0x3A, 0xFF, 0x86, 0x42, 0xFF, 0xC7, 0x42, 0xFF, 0x69, 0x4B, 0xFF, 0xA6, 0x3A, 0xFF, 0x86, 0x42, 0xFF, 0x4B, 0x64, 0xFF, 0xA9, 0x53, 0xFF, 0xEA, 0x73, 0xFF, 0x8C, 0x8C, 0xFF, 0xF7, 0xDE, 0xFF, 0x0A, 0x74, 0xFF, 0x45, 0x42, 0xFF, 0x73, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x52, 0xFF, 0xB0, 0xCD, 0xFF, 0x28, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x7B, 0xFF, 0x29, 0x73, 0xFF, 0xA6, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x92, 0xFF, 0x25, 0x62, 0xFF, 0x68, 0x73, 0xFF, 0x69, 0x8B, 0xFF, 0xC6, 0x7A, 0xFF, 0x25, 0x6A, 0xFF, 0x66, 0x6A, 0xFF, 0x86, 0x6A, 0xFF, 0x06, 0x52, 0xFF, 0x0A, 0x7B, 0xFF, 0x06, 0x62, 0xFF, 0x05, 0x6A, 0xFF, 0x86, 0x6A, 0xFF, 0x66, 0x5A, 0xFF, 0xCB, 0x93, 0xFF, 0x65, 0x5A, 0xFF, 0x29, 0x7B, 0xFF, 0xE7, 0x62, 0xFF, 0x08, 0x63, 0xFF,
-    0xE3, 0x50, 0xFF, 0xC4, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x29, 0x6B, 0xFF, 0x42, 0x29, 0xFF, 0xA3, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0xE4, 0x39, 0xFF, 0x04, 0x4A, 0xFF, 0x65, 0x4A, 0xFF, 0x45, 0x52, 0xFF, 0x89, 0x73, 0xFF, 0x25, 0x4A, 0xFF, 0x66, 0x5A, 0xFF, 0x45, 0x52, 0xFF, 0x86, 0x52, 0xFF, 0x66, 0x5A, 0xFF, 0x66, 0x52, 0xFF, 0x48, 0x5B, 0xFF, 0x07, 0x5B, 0xFF, 0xAD, 0x8C, 0xFF, 0x48, 0x5B, 0xFF, 0xCA, 0x6B, 0xFF, 0x4B, 0x6C, 0xFF, 0x85, 0x4A, 0xFF, 0xCC, 0x6C, 0xFF, 0x8B, 0x54, 0xFF, 0xEA, 0x6B, 0xFF, 0x6C, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x5D, 0xFF, 0xB3, 0x96, 0xFF, 0xBC, 0xA7, 0xFF, 0xDE, 0xA7, 0xFF, 0x07, 0x33, 0xFF, 0xF9, 0x9F, 0xFF, 0x4F, 0x5D, 0xFF, 0xAA, 0x53, 0xFF, 0x86, 0x3A, 0xFF, 0xF2, 0x4D, 0xFF, 0x48, 0x43, 0xFF, 0xA6, 0x42, 0xFF, 0x0D, 0x55, 0xFF, 0xFE, 0xEF, 0xFF, 0x0A, 0x5C, 0xFF, 0x6C, 0x7C, 0xFF, 0x79, 0xB7, 0xFF, 0x8C, 0x6C, 0xFF, 0xEB, 0x6B, 0xFF, 0xA5, 0x3A, 0xFF, 0xA9, 0x6B, 0xFF, 0xE7, 0x5A, 0xFF, 0x45, 0x4A, 0xFF, 0x8A, 0x73, 0xFF, 0x45, 0x4A, 0xFF, 0xA9, 0x6B, 0xFF, 0x28, 0x63, 0xFF, 0x69, 0x73, 0xFF, 0x08, 0x63, 0xFF, 0x66, 0x52, 0xFF, 0x87, 0x62, 0xFF, 0x25, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x25, 0x4A, 0xFF,
-    0x86, 0x62, 0xFF, 0x04, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0xC4, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0x25, 0x52, 0xFF, 0x87, 0x62, 0xFF, 0xE4, 0x51, 0xFF, 0x04, 0x52, 0xFF, 0x45, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0x25, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0xC7, 0x62, 0xFF, 0x24, 0x51, 0xFF, 0x63, 0x29, 0xFF, 0xC4, 0x31, 0xFF, 0x6A, 0x6B, 0xFF, 0xC4, 0x39, 0xFF, 0x05, 0x3A, 0xFF, 0xC5, 0x41, 0xFF, 0xC4, 0x39, 0xFF, 0xA3, 0x41, 0xFF, 0x2D, 0x7C, 0xFF, 0xCA, 0x6B, 0xFF, 0xE4, 0x39, 0xFF, 0xC3, 0x49, 0xFF, 0x87, 0x62, 0xFF, 0x05, 0x5A, 0xFF, 0x66, 0x62, 0xFF, 0x04, 0x52, 0xFF, 0x65, 0x4A, 0xFF, 0xCE, 0x7C, 0xFF, 0x65, 0x4A, 0xFF, 0x28, 0x5B, 0xFF, 0x89, 0x5B, 0xFF, 0xA9, 0x53, 0xFF, 0x27, 0x5B, 0xFF, 0xA6, 0x4A, 0xFF, 0x27, 0x53, 0xFF, 0xC6, 0x3A, 0xFF, 0xEA, 0x53, 0xFF, 0x48, 0x53, 0xFF, 0x47, 0x43, 0xFF, 0x0E, 0x75, 0xFF, 0xAC, 0x64, 0xFF, 0x70, 0x8D, 0xFF, 0xCD, 0x44, 0xFF, 0xCA, 0x4B, 0xFF, 0xE9, 0x4B, 0xFF, 0x0A, 0x4C, 0xFF, 0x27, 0x33, 0xFF, 0x86, 0x3A, 0xFF, 0xC7, 0x32, 0xFF, 0xCA, 0x43, 0xFF, 0x86, 0x3A, 0xFF, 0xA6, 0x3A, 0xFF, 0x28, 0x4B, 0xFF, 0x69, 0x5B, 0xFF, 0x28, 0x53, 0xFF, 0xE7, 0x4A, 0xFF, 0x29, 0x53, 0xFF,
-    0xE7, 0x52, 0xFF, 0x65, 0x42, 0xFF, 0x86, 0x4A, 0xFF, 0x45, 0x4A, 0xFF, 0x24, 0x3A, 0xFF, 0x08, 0x63, 0xFF, 0x25, 0x4A, 0xFF, 0xEB, 0x7B, 0xFF, 0x66, 0x52, 0xFF, 0x25, 0x4A, 0xFF, 0x49, 0x73, 0xFF, 0x25, 0x52, 0xFF, 0xC4, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0xC4, 0x41, 0xFF, 0xE4, 0x49, 0xFF, 0x05, 0x52, 0xFF, 0xE4, 0x49, 0xFF, 0x86, 0x5A, 0xFF, 0xE4, 0x49, 0xFF, 0xE4, 0x49, 0xFF, 0x05, 0x4A, 0xFF, 0x66, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x66, 0x5A, 0xFF, 0x86, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0x86, 0x52, 0xFF, 0xA3, 0x49, 0xFF, 0x86, 0x5A, 0xFF, 0xA6, 0x62, 0xFF, 0xA4, 0x31, 0xFF, 0x83, 0x29, 0xFF, 0xC4, 0x39, 0xFF, 0xC4, 0x41, 0xFF, 0xA4, 0x39, 0xFF, 0x83, 0x39, 0xFF, 0x25, 0x4A, 0xFF, 0xE5, 0x51, 0xFF, 0xE4, 0x91, 0xFF, 0x66, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x05, 0x52, 0xFF, 0x87, 0x72, 0xFF, 0xD0, 0xF4, 0xFF, 0x87, 0xA2, 0xFF, 0xC7, 0x9A, 0xFF, 0xE7, 0x82, 0xFF, 0xA7, 0x62, 0xFF, 0x4C, 0x7C, 0xFF, 0x68, 0x7B, 0xFF, 0x28, 0x93, 0xFF, 0x89, 0x73, 0xFF, 0x07, 0x63, 0xFF, 0x68, 0x73, 0xFF, 0x27, 0x63, 0xFF, 0x68, 0x63, 0xFF, 0x28, 0x53, 0xFF, 0xC6, 0x42, 0xFF, 0x28, 0x53, 0xFF, 0xE7, 0x42, 0xFF, 0xEB, 0x5B, 0xFF, 0x68, 0x53, 0xFF,
-    0xAD, 0x64, 0xFF, 0x89, 0x4B, 0xFF, 0xC6, 0x3A, 0xFF, 0x2A, 0x54, 0xFF, 0x08, 0x53, 0xFF, 0xC6, 0x32, 0xFF, 0x66, 0x3A, 0xFF, 0x04, 0x2A, 0xFF, 0x08, 0x4B, 0xFF, 0x86, 0x3A, 0xFF, 0x86, 0x3A, 0xFF, 0xE7, 0x52, 0xFF, 0x28, 0x53, 0xFF, 0xC7, 0x52, 0xFF, 0x65, 0x42, 0xFF, 0xA7, 0x4A, 0xFF, 0x86, 0x4A, 0xFF, 0x45, 0x42, 0xFF, 0x0C, 0x84, 0xFF, 0x86, 0x52, 0xFF, 0x25, 0x42, 0xFF, 0xA7, 0x5A, 0xFF, 0x65, 0x52, 0xFF, 0xCD, 0xAC, 0xFF, 0x66, 0x52, 0xFF, 0x05, 0x4A, 0xFF, 0xE8, 0x6A, 0xFF, 0x45, 0x62, 0xFF, 0x56, 0xF7, 0xFF, 0x65, 0x62, 0xFF, 0x25, 0x4A, 0xFF, 0x04, 0x4A, 0xFF, 0xA9, 0x93, 0xFF, 0x65, 0x5A, 0xFF, 0x89, 0xA3, 0xFF, 0xE3, 0x51, 0xFF, 0x25, 0x52, 0xFF, 0x8D, 0xDC, 0xFF, 0xE4, 0x59, 0xFF, 0xC7, 0xA2, 0xFF, 0x66, 0x92, 0xFF, 0x45, 0x7A, 0xFF, 0x8A, 0xAB, 0xFF, 0xE4, 0x51, 0xFF, 0xE7, 0xA2, 0xFF, 0x62, 0x49, 0xFF, 0xA6, 0x92, 0xFF, 0xA6, 0x62, 0xFF, 0x05, 0x4A, 0xFF, 0x83, 0x31, 0xFF, 0xC7, 0x6A, 0xFF, 0x42, 0x31, 0xFF, 0xAB, 0x83, 0xFF, 0x46, 0x5A, 0xFF, 0xC6, 0x5A, 0xFF, 0xA7, 0x72, 0xFF, 0x11, 0xE5, 0xFF, 0x82, 0x51, 0xFF, 0x07, 0x6B, 0xFF, 0x24, 0x4A, 0xFF, 0x6A, 0x8B, 0xFF, 0xCA, 0xC3, 0xFF, 0xCA, 0xC3, 0xFF, 0x74, 0xEE, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF7, 0xFF, 0x0A, 0x9C, 0xFF, 0x88, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xE7, 0xFF, 0xAF, 0x9D, 0xFF, 0x14, 0xEF, 0xFF, 0x51, 0x9D, 0xFF, 0x91, 0x75, 0xFF, 0x13, 0xA7, 0xFF, 0xAF, 0x85, 0xFF, 0xF6, 0x8E, 0xFF, 0x89, 0x3B, 0xFF, 0x28, 0x4B, 0xFF, 0x15, 0x97, 0xFF, 0x49, 0x63, 0xFF, 0x07, 0x3B, 0xFF, 0x45, 0x3A, 0xFF, 0x88, 0x5B, 0xFF, 0x47, 0x43, 0xFF, 0x46, 0x42, 0xFF, 0x86, 0x3A, 0xFF, 0x2B, 0x6C, 0xFF, 0x75, 0xB7, 0xFF, 0x47, 0x53, 0xFF, 0xFE, 0xCF, 0xFF, 0xAC, 0x64, 0xFF, 0x2A, 0x64, 0xFF, 0x78, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x8C, 0xFF, 0xEE, 0x9C, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0x48, 0x6B, 0xFF, 0x67, 0x6B, 0xFF, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x89, 0x7B, 0xFF, 0x49, 0x73, 0xFF, 0x4C, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xDC, 0xFF, 0xA5, 0x72, 0xFF, 0x28, 0x73, 0xFF, 0x48, 0x7B, 0xFF, 0xE4, 0x81, 0xFF, 0x2D, 0xAC, 0xFF, 0x66, 0x82, 0xFF, 0x87, 0x7A, 0xFF, 0xA6, 0x62, 0xFF, 0x86, 0x62, 0xFF, 0x2F, 0xC4, 0xFF, 0x25, 0x62, 0xFF, 0x49, 0x73, 0xFF, 0x68, 0x93, 0xFF,
-    0x02, 0x39, 0xFF, 0x63, 0x31, 0xFF, 0x6A, 0x6B, 0xFF, 0x43, 0x31, 0xFF, 0xCB, 0x7B, 0xFF, 0x83, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0x88, 0x52, 0xFF, 0x84, 0x39, 0xFF, 0xC4, 0x49, 0xFF, 0xC3, 0x39, 0xFF, 0xA3, 0x41, 0xFF, 0x69, 0x73, 0xFF, 0x62, 0x41, 0xFF, 0xE4, 0x59, 0xFF, 0x87, 0x72, 0xFF, 0x05, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0xC7, 0x52, 0xFF, 0xEA, 0x73, 0xFF, 0xA7, 0x5A, 0xFF, 0x48, 0x63, 0xFF, 0x4B, 0x7C, 0xFF, 0x69, 0x73, 0xFF, 0x28, 0x53, 0xFF, 0x4B, 0x64, 0xFF, 0x28, 0x53, 0xFF, 0x48, 0x4B, 0xFF, 0xA9, 0x53, 0xFF, 0xA9, 0x43, 0xFF, 0x0E, 0x5D, 0xFF, 0x07, 0x43, 0xFF, 0x8C, 0x64, 0xFF, 0xE9, 0x33, 0xFF, 0x48, 0x4B, 0xFF, 0x6C, 0x5C, 0xFF, 0xCA, 0x5B, 0xFF, 0xCA, 0x43, 0xFF, 0x25, 0x3A, 0xFF, 0x27, 0x3B, 0xFF, 0xE7, 0x3A, 0xFF, 0x65, 0x3A, 0xFF, 0xC6, 0x32, 0xFF, 0x27, 0x43, 0xFF, 0x08, 0x53, 0xFF, 0x08, 0x53, 0xFF, 0xC7, 0x42, 0xFF, 0x49, 0x53, 0xFF, 0x86, 0x4A, 0xFF, 0x04, 0x3A, 0xFF, 0xAA, 0x6B, 0xFF, 0x45, 0x42, 0xFF, 0x04, 0x3A, 0xFF, 0x08, 0x63, 0xFF, 0x66, 0x4A, 0xFF, 0x28, 0x6B, 0xFF, 0x86, 0x52, 0xFF, 0x05, 0x4A, 0xFF, 0x45, 0x4A, 0xFF, 0x05, 0x4A, 0xFF, 0x46, 0x52, 0xFF, 0xE4, 0x41, 0xFF, 0xC3, 0x41, 0xFF, 0x66, 0x5A, 0xFF,
-    0x04, 0x52, 0xFF, 0xC8, 0x62, 0xFF, 0x05, 0x4A, 0xFF, 0x25, 0x52, 0xFF, 0x04, 0x42, 0xFF, 0x05, 0x4A, 0xFF, 0xE4, 0x51, 0xFF, 0x45, 0x5A, 0xFF, 0x45, 0x52, 0xFF, 0x66, 0x52, 0xFF, 0x66, 0x52, 0xFF, 0x66, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0xA6, 0x62, 0xFF, 0xA6, 0x62, 0xFF, 0x42, 0x29, 0xFF, 0xC3, 0x50, 0xFF, 0xC3, 0x58, 0xFF, 0x03, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0x43, 0x31, 0xFF, 0x23, 0x31, 0xFF, 0x68, 0x5A, 0xFF, 0x65, 0x41, 0xFF, 0x47, 0x5A, 0xFF, 0xA3, 0x41, 0xFF, 0xA3, 0x41, 0xFF, 0xA3, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0xE4, 0x51, 0xFF, 0x26, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0x45, 0x52, 0xFF, 0xE8, 0x6A, 0xFF, 0xA6, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0x66, 0x52, 0xFF, 0x49, 0x6B, 0xFF, 0xE7, 0x62, 0xFF, 0xA6, 0x52, 0xFF, 0x69, 0x5B, 0xFF, 0xC7, 0x52, 0xFF, 0x48, 0x5B, 0xFF, 0x49, 0x5B, 0xFF, 0xC7, 0x42, 0xFF, 0x07, 0x43, 0xFF, 0xE7, 0x4A, 0xFF, 0xE8, 0x4A, 0xFF, 0x86, 0x32, 0xFF, 0x28, 0x5B, 0xFF, 0x89, 0x5B, 0xFF, 0xE7, 0x52, 0xFF, 0x08, 0x43, 0xFF, 0x46, 0x3A, 0xFF, 0x25, 0x3A, 0xFF, 0xA7, 0x42, 0xFF, 0x45, 0x3A, 0xFF, 0x25, 0x32, 0xFF, 0x86, 0x4A, 0xFF, 0x08, 0x53, 0xFF, 0x45, 0x3A, 0xFF, 0x65, 0x42, 0xFF, 0x46, 0x42, 0xFF,
-    0x86, 0x4A, 0xFF, 0x65, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x66, 0x4A, 0xFF, 0x05, 0x3A, 0xFF, 0xA7, 0x5A, 0xFF, 0xE8, 0x62, 0xFF, 0x66, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0x25, 0x4A, 0xFF, 0xE4, 0x49, 0xFF, 0x04, 0x4A, 0xFF, 0xC4, 0x49, 0xFF, 0xC4, 0x41, 0xFF, 0xC4, 0x41, 0xFF, 0x46, 0x52, 0xFF, 0x26, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0xE4, 0x49, 0xFF, 0x46, 0x52, 0xFF, 0xE4, 0x49, 0xFF, 0x04, 0x4A, 0xFF, 0xC4, 0x51, 0xFF, 0x05, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x45, 0x52, 0xFF, 0x66, 0x52, 0xFF, 0x46, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0x45, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0x86, 0x62, 0xFF, 0x43, 0x31, 0xFF, 0xA2, 0x50, 0xFF, 0xA2, 0x48, 0xFF, 0x23, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0xC5, 0x49, 0xFF, 0x69, 0x62, 0xFF, 0x84, 0x41, 0xFF, 0x09, 0x73, 0xFF, 0xA3, 0x41, 0xFF, 0xA6, 0x5A, 0xFF, 0xA2, 0x41, 0xFF, 0xC7, 0x62, 0xFF, 0x45, 0x62, 0xFF, 0x25, 0x62, 0xFF, 0x46, 0x62, 0xFF, 0x87, 0x62, 0xFF, 0xE8, 0x6A, 0xFF, 0x86, 0x5A, 0xFF, 0xA7, 0x62, 0xFF, 0x86, 0x52, 0xFF, 0xE7, 0x5A, 0xFF, 0xC6, 0x62, 0xFF, 0xE7, 0x5A, 0xFF, 0x0E, 0x8D, 0xFF, 0x48, 0x5B, 0xFF, 0x8D, 0x84, 0xFF, 0x4C, 0x7C, 0xFF, 0x88, 0x4B, 0xFF, 0xC6, 0x3A, 0xFF, 0x68, 0x53, 0xFF,
-    0x48, 0x4B, 0xFF, 0x07, 0x43, 0xFF, 0x28, 0x5B, 0xFF, 0x8D, 0x74, 0xFF, 0xA7, 0x4A, 0xFF, 0xCA, 0x53, 0xFF, 0x25, 0x3A, 0xFF, 0x45, 0x3A, 0xFF, 0x09, 0x4B, 0xFF, 0x45, 0x3A, 0xFF, 0x66, 0x3A, 0xFF, 0x86, 0x42, 0xFF, 0x69, 0x63, 0xFF, 0x28, 0x5B, 0xFF, 0x48, 0x5B, 0xFF, 0xE7, 0x4A, 0xFF, 0xC7, 0x52, 0xFF, 0xA7, 0x52, 0xFF, 0x45, 0x42, 0xFF, 0xC7, 0x52, 0xFF, 0x45, 0x4A, 0xFF, 0x66, 0x52, 0xFF, 0x69, 0x6B, 0xFF, 0xA6, 0x5A, 0xFF, 0x45, 0x4A, 0xFF, 0x25, 0x52, 0xFF, 0x25, 0x4A, 0xFF, 0x66, 0x5A, 0xFF, 0x25, 0x52, 0xFF, 0xE4, 0x41, 0xFF, 0xE4, 0x49, 0xFF, 0x05, 0x4A, 0xFF, 0x05, 0x52, 0xFF, 0x46, 0x5A, 0xFF, 0xC4, 0x49, 0xFF, 0x66, 0x5A, 0xFF, 0x04, 0x4A, 0xFF, 0x05, 0x52, 0xFF, 0x25, 0x5A, 0xFF, 0x66, 0x5A, 0xFF, 0xA6, 0x5A, 0xFF, 0xA7, 0x5A, 0xFF, 0x66, 0x52, 0xFF, 0x66, 0x5A, 0xFF, 0x65, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0xC7, 0x62, 0xFF, 0xC7, 0x62, 0xFF, 0x43, 0x41, 0xFF, 0x83, 0x31, 0xFF, 0x63, 0x41, 0xFF, 0x83, 0x31, 0xFF, 0x83, 0x41, 0xFF, 0x05, 0x52, 0xFF, 0x08, 0x73, 0xFF, 0xA7, 0x72, 0xFF, 0xE5, 0x71, 0xFF, 0x8A, 0xA3, 0xFF, 0x29, 0x9B, 0xFF, 0x08, 0x6B, 0xFF, 0x65, 0x62, 0xFF, 0x2F, 0xDD, 0xFF, 0x8D, 0xD4, 0xFF, 0xCB, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x2E, 0xE5, 0xFF, 0x2F, 0xAD, 0xFF, 0x8B, 0x9C, 0xFF, 0x4E, 0xAD, 0xFF, 0xCD, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xB6, 0xFF, 0x14, 0xB7, 0xFF, 0xED, 0x84, 0xFF, 0x9D, 0xF7, 0xFF, 0x2E, 0x7D, 0xFF, 0x72, 0x9E, 0xFF, 0xD3, 0x8E, 0xFF, 0x6E, 0x5D, 0xFF, 0x38, 0x8F, 0xFF, 0xA6, 0x42, 0xFF, 0xD0, 0x7D, 0xFF, 0xC6, 0x4A, 0xFF, 0x27, 0x2B, 0xFF, 0xE5, 0x31, 0xFF, 0x4C, 0x6C, 0xFF, 0xA5, 0x2A, 0xFF, 0x25, 0x42, 0xFF, 0x8D, 0x7C, 0xFF, 0x48, 0x53, 0xFF, 0xD0, 0x7D, 0xFF, 0x07, 0x5B, 0xFF, 0xE6, 0x42, 0xFF, 0xCC, 0x6C, 0xFF, 0x0A, 0x64, 0xFF, 0x93, 0xB6, 0xFF, 0xDC, 0xFF, 0xFF, 0x0E, 0x9D, 0xFF, 0xEC, 0x8C, 0xFF, 0x4E, 0x9D, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0x73, 0xFF, 0xD1, 0xB5, 0xFF, 0xED, 0xA4, 0xFF, 0x2E, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xAD, 0xAC, 0xFF, 0xC9, 0x9B, 0xFF, 0xCA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0x7A, 0xFF, 0x48, 0x8B, 0xFF, 0xEA, 0xD3, 0xFF, 0xE3, 0x89, 0xFF, 0xFE, 0xFF, 0xFF, 0xD7, 0xFE, 0xFF, 0xAB, 0xBB, 0xFF, 0x08, 0xAB, 0xFF, 0x86, 0x6A, 0xFF, 0xDC, 0xFF, 0xFF, 0xE7, 0x82, 0xFF, 0x74, 0xFF, 0xFF, 0x8A, 0xB3, 0xFF,
-    0xE5, 0x49, 0xFF, 0x22, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x86, 0x72, 0xFF, 0x63, 0x41, 0xFF, 0xC4, 0x49, 0xFF, 0xC8, 0x6A, 0xFF, 0x84, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0x89, 0xFF, 0x86, 0xA9, 0xFF, 0x46, 0x5A, 0xFF, 0xA7, 0x72, 0xFF, 0x09, 0xD3, 0xFF, 0xB3, 0xFE, 0xFF, 0xEB, 0xD3, 0xFF, 0xE7, 0x7A, 0xFF, 0xC8, 0x7A, 0xFF, 0x45, 0x6A, 0xFF, 0x2B, 0xAC, 0xFF, 0xC7, 0x5A, 0xFF, 0xC7, 0x5A, 0xFF, 0xA6, 0x5A, 0xFF, 0x08, 0x63, 0xFF, 0xE7, 0x62, 0xFF, 0xE6, 0x52, 0xFF, 0xC7, 0x5A, 0xFF, 0x08, 0x5B, 0xFF, 0x89, 0x63, 0xFF, 0x28, 0x53, 0xFF, 0x27, 0x53, 0xFF, 0xA6, 0x42, 0xFF, 0x07, 0x53, 0xFF, 0x49, 0x5B, 0xFF, 0x08, 0x53, 0xFF, 0x89, 0x5B, 0xFF, 0xC7, 0x5A, 0xFF, 0x89, 0x5B, 0xFF, 0xE4, 0x39, 0xFF, 0x86, 0x42, 0xFF, 0xAC, 0x7C, 0xFF, 0x25, 0x42, 0xFF, 0x45, 0x3A, 0xFF, 0x86, 0x52, 0xFF, 0x08, 0x53, 0xFF, 0xCE, 0x94, 0xFF, 0x65, 0x4A, 0xFF, 0x45, 0x42, 0xFF, 0x87, 0x4A, 0xFF, 0x05, 0x3A, 0xFF, 0xCE, 0x9C, 0xFF, 0xC7, 0x5A, 0xFF, 0xE8, 0x62, 0xFF, 0x86, 0x52, 0xFF, 0x24, 0x42, 0xFF, 0xAB, 0x7B, 0xFF, 0x0A, 0x84, 0xFF, 0xA6, 0x5A, 0xFF, 0x45, 0x52, 0xFF, 0x04, 0x4A, 0xFF, 0xE4, 0x49, 0xFF, 0xC3, 0x41, 0xFF, 0x25, 0x4A, 0xFF, 0xE4, 0x49, 0xFF,
-    0x46, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x45, 0x52, 0xFF, 0xA3, 0x41, 0xFF, 0x25, 0x42, 0xFF, 0x25, 0x4A, 0xFF, 0xA3, 0x41, 0xFF, 0x05, 0x4A, 0xFF, 0x25, 0x52, 0xFF, 0xE4, 0x49, 0xFF, 0x66, 0x52, 0xFF, 0x65, 0x52, 0xFF, 0x86, 0x52, 0xFF, 0xA6, 0x62, 0xFF, 0xA6, 0x62, 0xFF, 0xA6, 0x62, 0xFF, 0xA3, 0x50, 0xFF, 0xE2, 0x48, 0xFF, 0x83, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0x83, 0x39, 0xFF, 0x42, 0x31, 0xFF, 0xC6, 0x51, 0xFF, 0x63, 0x49, 0xFF, 0xA8, 0x8A, 0xFF, 0xA4, 0x59, 0xFF, 0x87, 0x72, 0xFF, 0xC4, 0x49, 0xFF, 0xC7, 0x62, 0xFF, 0x85, 0x62, 0xFF, 0x66, 0x72, 0xFF, 0xE4, 0x59, 0xFF, 0xE5, 0x59, 0xFF, 0x05, 0x52, 0xFF, 0x46, 0x5A, 0xFF, 0x2C, 0x7C, 0xFF, 0x04, 0x4A, 0xFF, 0x08, 0x6B, 0xFF, 0x86, 0x52, 0xFF, 0x66, 0x52, 0xFF, 0xE8, 0x62, 0xFF, 0xA6, 0x42, 0xFF, 0xA6, 0x52, 0xFF, 0x28, 0x63, 0xFF, 0x48, 0x5B, 0xFF, 0x6C, 0x74, 0xFF, 0x65, 0x42, 0xFF, 0xA6, 0x42, 0xFF, 0x06, 0x43, 0xFF, 0x2F, 0x85, 0xFF, 0xE7, 0x52, 0xFF, 0x2B, 0x6C, 0xFF, 0xC7, 0x52, 0xFF, 0xCD, 0x74, 0xFF, 0xE4, 0x39, 0xFF, 0x46, 0x3A, 0xFF, 0x66, 0x3A, 0xFF, 0x05, 0x3A, 0xFF, 0x45, 0x3A, 0xFF, 0xC7, 0x52, 0xFF, 0xE8, 0x52, 0xFF, 0xE8, 0x5A, 0xFF, 0xC7, 0x52, 0xFF, 0x86, 0x4A, 0xFF,
-    0xC7, 0x5A, 0xFF, 0x05, 0x3A, 0xFF, 0x66, 0x4A, 0xFF, 0x8A, 0x73, 0xFF, 0x29, 0x63, 0xFF, 0x45, 0x4A, 0xFF, 0x25, 0x4A, 0xFF, 0x66, 0x52, 0xFF, 0x04, 0x42, 0xFF, 0x05, 0x4A, 0xFF, 0x66, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0x25, 0x4A, 0xFF, 0xC4, 0x41, 0xFF, 0x66, 0x5A, 0xFF, 0xA4, 0x41, 0xFF, 0x66, 0x5A, 0xFF, 0xE4, 0x49, 0xFF, 0xA3, 0x41, 0xFF, 0x45, 0x52, 0xFF, 0xE4, 0x49, 0xFF, 0xE4, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0x45, 0x52, 0xFF, 0x25, 0x4A, 0xFF, 0x04, 0x4A, 0xFF, 0x66, 0x5A, 0xFF, 0x66, 0x52, 0xFF, 0x86, 0x52, 0xFF, 0xA7, 0x62, 0xFF, 0xA6, 0x62, 0xFF, 0xC7, 0x62, 0xFF, 0xE2, 0x40, 0xFF, 0x04, 0x49, 0xFF, 0x44, 0x39, 0xFF, 0x44, 0x41, 0xFF, 0x64, 0x39, 0xFF, 0x22, 0x31, 0xFF, 0x65, 0x41, 0xFF, 0x84, 0x41, 0xFF, 0x46, 0x5A, 0xFF, 0xA3, 0x49, 0xFF, 0x05, 0x62, 0xFF, 0xA4, 0x49, 0xFF, 0x05, 0x52, 0xFF, 0x85, 0x5A, 0xFF, 0x45, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0x86, 0x62, 0xFF, 0x66, 0x5A, 0xFF, 0xE8, 0x5A, 0xFF, 0x2C, 0x5B, 0xFF, 0x2A, 0x6B, 0xFF, 0x64, 0x42, 0xFF, 0xCA, 0x6B, 0xFF, 0x2A, 0x7C, 0xFF, 0x08, 0x5B, 0xFF, 0xC9, 0x53, 0xFF, 0x2A, 0x6C, 0xFF, 0x09, 0x64, 0xFF, 0xFF, 0xF7, 0xFF, 0x6B, 0x5C, 0xFF, 0xA6, 0x3A, 0xFF,
-    0xAF, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x7C, 0xFF, 0xD0, 0x75, 0xFF, 0x75, 0xA6, 0xFF, 0xA9, 0x3B, 0xFF, 0xE4, 0x39, 0xFF, 0x72, 0x76, 0xFF, 0x68, 0x43, 0xFF, 0x45, 0x42, 0xFF, 0x4B, 0x54, 0xFF, 0x51, 0x85, 0xFF, 0x4F, 0x8D, 0xFF, 0x68, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x64, 0xFF, 0xC5, 0x4A, 0xFF, 0x89, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xA5, 0xFF, 0x48, 0x63, 0xFF, 0x6D, 0x8C, 0xFF, 0x6C, 0x8C, 0xFF, 0x07, 0x63, 0xFF, 0xA7, 0x52, 0xFF, 0xE7, 0x5A, 0xFF, 0x66, 0x5A, 0xFF, 0xE7, 0x6A, 0xFF, 0xE8, 0x6A, 0xFF, 0xE4, 0x41, 0xFF, 0x66, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0xA7, 0x6A, 0xFF, 0xC7, 0x6A, 0xFF, 0xC4, 0x49, 0xFF, 0x46, 0x62, 0xFF, 0x05, 0x4A, 0xFF, 0x04, 0x52, 0xFF, 0x05, 0x5A, 0xFF, 0x45, 0x5A, 0xFF, 0x66, 0x52, 0xFF, 0xC3, 0x41, 0xFF, 0x86, 0x5A, 0xFF, 0xA6, 0x5A, 0xFF, 0xA6, 0x62, 0xFF, 0xA6, 0x62, 0xFF, 0xE7, 0x62, 0xFF, 0x07, 0x6B, 0xFF, 0xC3, 0x50, 0xFF, 0x02, 0x49, 0xFF, 0x43, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0x63, 0x39, 0xFF, 0x43, 0x49, 0xFF, 0x22, 0x41, 0xFF, 0xE6, 0x51, 0xFF, 0xE5, 0x51, 0xFF, 0xA7, 0x62, 0xFF, 0x45, 0x72, 0xFF, 0xC4, 0x51, 0xFF, 0x62, 0x41, 0xFF, 0x86, 0x6A, 0xFF, 0xE4, 0x61, 0xFF, 0xA7, 0x72, 0xFF,
-    0x24, 0x62, 0xFF, 0x25, 0x72, 0xFF, 0xC7, 0x7A, 0xFF, 0xA6, 0x6A, 0xFF, 0x6C, 0x84, 0xFF, 0x49, 0x7B, 0xFF, 0x07, 0x73, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x6B, 0xFF, 0xAC, 0x8C, 0xFF, 0x0D, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x8C, 0xFF, 0xA5, 0x42, 0xFF, 0xF6, 0xBE, 0xFF, 0xB4, 0xB6, 0xFF, 0xEA, 0x6B, 0xFF, 0xC6, 0x52, 0xFF, 0x27, 0x43, 0xFF, 0xE7, 0x62, 0xFF, 0xE7, 0x52, 0xFF, 0xE4, 0x31, 0xFF, 0x66, 0x3A, 0xFF, 0x66, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x66, 0x4A, 0xFF, 0x27, 0x5B, 0xFF, 0x12, 0xB6, 0xFF, 0x69, 0x6B, 0xFF, 0x45, 0x4A, 0xFF, 0x89, 0x63, 0xFF, 0xA6, 0x52, 0xFF, 0x87, 0x52, 0xFF, 0x86, 0x4A, 0xFF, 0x28, 0x63, 0xFF, 0xCC, 0x8C, 0xFF, 0xC7, 0x5A, 0xFF, 0x48, 0x73, 0xFF, 0xFD, 0xFF, 0xFF, 0x70, 0xAD, 0xFF, 0x25, 0x4A, 0xFF, 0xC7, 0x62, 0xFF, 0xC6, 0x72, 0xFF, 0xB6, 0xDE, 0xFF, 0xE4, 0x49, 0xFF, 0x66, 0x52, 0xFF, 0x85, 0x62, 0xFF, 0xF0, 0xDC, 0xFF, 0xFE, 0xFF, 0xFF, 0x69, 0x93, 0xFF, 0x86, 0x72, 0xFF, 0x29, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0x92, 0xFF, 0x66, 0x72, 0xFF, 0xA6, 0x5A, 0xFF, 0x66, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0x86, 0x6A, 0xFF, 0x08, 0x83, 0xFF, 0xCE, 0xC4, 0xFF, 0xEE, 0xC4, 0xFF, 0xE7, 0x92, 0xFF,
-    0x42, 0x31, 0xFF, 0x22, 0x29, 0xFF, 0x46, 0x5A, 0xFF, 0x63, 0x39, 0xFF, 0x25, 0x52, 0xFF, 0xCC, 0xB3, 0xFF, 0x83, 0x41, 0xFF, 0xC7, 0x72, 0xFF, 0x44, 0x61, 0xFF, 0x08, 0x8B, 0xFF, 0xCF, 0xE4, 0xFF, 0x84, 0x61, 0xFF, 0xE9, 0x93, 0xFF, 0x65, 0x6A, 0xFF, 0xC4, 0x79, 0xFF, 0x6E, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0xF6, 0xFF, 0x86, 0x82, 0xFF, 0x25, 0x5A, 0xFF, 0x8C, 0xA4, 0xFF, 0x93, 0xFE, 0xFF, 0xD9, 0xFF, 0xFF, 0x0A, 0x84, 0xFF, 0x48, 0x7B, 0xFF, 0x6B, 0x8C, 0xFF, 0x90, 0xAD, 0xFF, 0x86, 0x52, 0xFF, 0xA6, 0x52, 0xFF, 0xA9, 0x6B, 0xFF, 0x2B, 0x7C, 0xFF, 0x48, 0x6B, 0xFF, 0xE8, 0x5A, 0xFF, 0x2C, 0x7C, 0xFF, 0xC7, 0x52, 0xFF, 0x0D, 0x7D, 0xFF, 0xC8, 0x62, 0xFF, 0x89, 0x5B, 0xFF, 0x25, 0x42, 0xFF, 0xE8, 0x4A, 0xFF, 0xAD, 0x84, 0xFF, 0x26, 0x4A, 0xFF, 0x66, 0x4A, 0xFF, 0xE8, 0x62, 0xFF, 0x2D, 0x85, 0xFF, 0x09, 0x63, 0xFF, 0x66, 0x4A, 0xFF, 0x05, 0x42, 0xFF, 0x88, 0x52, 0xFF, 0xB4, 0xA6, 0xFF, 0xEC, 0x83, 0xFF, 0xE8, 0x62, 0xFF, 0x66, 0x52, 0xFF, 0xF0, 0xBD, 0xFF, 0x94, 0xCE, 0xFF, 0xC6, 0x5A, 0xFF, 0xE4, 0x41, 0xFF, 0x86, 0x5A, 0xFF, 0x0B, 0x94, 0xFF, 0x4B, 0x94, 0xFF, 0x03, 0x42, 0xFF, 0x04, 0x4A, 0xFF, 0xE4, 0x41, 0xFF, 0x0A, 0xA4, 0xFF,
-    0xC3, 0x61, 0xFF, 0x46, 0x6A, 0xFF, 0x09, 0x83, 0xFF, 0x2C, 0xC4, 0xFF, 0xC4, 0x59, 0xFF, 0x8A, 0xAB, 0xFF, 0xA7, 0xA2, 0xFF, 0xA6, 0x7A, 0xFF, 0x69, 0xAB, 0xFF, 0xC4, 0x49, 0xFF, 0xE8, 0x92, 0xFF, 0x86, 0x62, 0xFF, 0x46, 0x7A, 0xFF, 0xA6, 0x62, 0xFF, 0x08, 0x7B, 0xFF, 0x85, 0x5A, 0xFF, 0x22, 0x31, 0xFF, 0x23, 0x31, 0xFF, 0xC4, 0x51, 0xFF, 0x73, 0xFE, 0xFF, 0xEC, 0xB3, 0xFF, 0x4A, 0x9B, 0xFF, 0x63, 0x49, 0xFF, 0x84, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFD, 0xFF, 0xE5, 0x99, 0xFF, 0xA4, 0x59, 0xFF, 0xC7, 0x6A, 0xFF, 0x46, 0x7A, 0xFF, 0xFE, 0xFF, 0xFF, 0xE8, 0xB2, 0xFF, 0x46, 0x7A, 0xFF, 0x66, 0x6A, 0xFF, 0x25, 0x62, 0xFF, 0x4B, 0xB4, 0xFF, 0xC6, 0x62, 0xFF, 0xA6, 0x5A, 0xFF, 0x49, 0x73, 0xFF, 0x08, 0x63, 0xFF, 0xED, 0x94, 0xFF, 0x45, 0x4A, 0xFF, 0x66, 0x4A, 0xFF, 0x08, 0x63, 0xFF, 0xC7, 0x52, 0xFF, 0xA9, 0x63, 0xFF, 0x47, 0x4B, 0xFF, 0xC7, 0x5A, 0xFF, 0x28, 0x5B, 0xFF, 0x8E, 0x6D, 0xFF, 0xC7, 0x52, 0xFF, 0x87, 0x4B, 0xFF, 0xAA, 0x63, 0xFF, 0xE6, 0x42, 0xFF, 0x46, 0x42, 0xFF, 0x8C, 0x54, 0xFF, 0xB4, 0xC6, 0xFF, 0xE8, 0x62, 0xFF, 0xC7, 0x52, 0xFF, 0xEA, 0x73, 0xFF, 0x8E, 0x84, 0xFF, 0xA9, 0x7B, 0xFF, 0x86, 0x52, 0xFF, 0x04, 0x3A, 0xFF,
-    0x86, 0x5A, 0xFF, 0xC7, 0x4A, 0xFF, 0x0A, 0x84, 0xFF, 0x08, 0x6B, 0xFF, 0x44, 0x42, 0xFF, 0x6A, 0x7B, 0xFF, 0x25, 0x4A, 0xFF, 0xA9, 0x83, 0xFF, 0xE4, 0x49, 0xFF, 0x46, 0x52, 0xFF, 0x08, 0x6B, 0xFF, 0x25, 0x52, 0xFF, 0xE9, 0x93, 0xFF, 0xE4, 0x41, 0xFF, 0x66, 0x52, 0xFF, 0xC4, 0x41, 0xFF, 0xE4, 0x49, 0xFF, 0xC3, 0x51, 0xFF, 0x8A, 0x93, 0xFF, 0x08, 0x73, 0xFF, 0xE4, 0x49, 0xFF, 0xA7, 0x6A, 0xFF, 0xA6, 0x6A, 0xFF, 0x29, 0x9B, 0xFF, 0x65, 0x52, 0xFF, 0x86, 0x52, 0xFF, 0x45, 0x52, 0xFF, 0x86, 0x52, 0xFF, 0x07, 0x83, 0xFF, 0xA6, 0x5A, 0xFF, 0xC7, 0x62, 0xFF, 0xA6, 0x62, 0xFF, 0x02, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x8A, 0xAA, 0xFF, 0x25, 0x61, 0xFF, 0x26, 0x5A, 0xFF, 0x64, 0x49, 0xFF, 0x64, 0x41, 0xFF, 0x84, 0x51, 0xFF, 0x63, 0x61, 0xFF, 0x64, 0x69, 0xFF, 0x83, 0x51, 0xFF, 0x26, 0x62, 0xFF, 0xC8, 0x72, 0xFF, 0xE5, 0x59, 0xFF, 0x86, 0x62, 0xFF, 0xA6, 0x6A, 0xFF, 0xC4, 0x59, 0xFF, 0xE5, 0x59, 0xFF, 0x28, 0x6B, 0xFF, 0x04, 0x4A, 0xFF, 0x25, 0x52, 0xFF, 0xA7, 0x62, 0xFF, 0x6C, 0x8C, 0xFF, 0x49, 0x73, 0xFF, 0x6C, 0x94, 0xFF, 0xCD, 0x7C, 0xFF, 0x25, 0x4A, 0xFF, 0x07, 0x63, 0xFF, 0xCF, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0x86, 0x4A, 0xFF, 0x4C, 0x84, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x95, 0xFF, 0x07, 0x5B, 0xFF, 0x2A, 0x6C, 0xFF, 0x8C, 0x94, 0xFF, 0xE7, 0x52, 0xFF, 0x25, 0x42, 0xFF, 0x0B, 0x5C, 0xFF, 0xE7, 0x42, 0xFF, 0xE8, 0x6A, 0xFF, 0x67, 0x4A, 0xFF, 0x0D, 0x8D, 0xFF, 0x0E, 0x95, 0xFF, 0x8D, 0x94, 0xFF, 0x0B, 0x94, 0xFF, 0xF4, 0xB5, 0xFF, 0x66, 0x5A, 0xFF, 0x05, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x8B, 0xFF, 0x04, 0x4A, 0xFF, 0x2B, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0x73, 0xFF, 0x45, 0x52, 0xFF, 0x28, 0x63, 0xFF, 0x49, 0x7B, 0xFF, 0xA3, 0x49, 0xFF, 0xE4, 0x49, 0xFF, 0xE7, 0x5A, 0xFF, 0xA7, 0x62, 0xFF, 0xA4, 0x49, 0xFF, 0x05, 0x5A, 0xFF, 0x82, 0x49, 0xFF, 0x05, 0x5A, 0xFF, 0x66, 0x6A, 0xFF, 0xE4, 0x49, 0xFF, 0xA8, 0x72, 0xFF, 0x67, 0x6A, 0xFF, 0x25, 0x52, 0xFF, 0x66, 0x52, 0xFF, 0x46, 0x5A, 0xFF, 0x66, 0x5A, 0xFF, 0x45, 0x5A, 0xFF, 0x66, 0x5A, 0xFF, 0xA6, 0x62, 0xFF, 0xA7, 0x62, 0xFF, 0xE7, 0x6A, 0xFF, 0x45, 0x69, 0xFF, 0x44, 0x51, 0xFF, 0xA8, 0x91, 0xFF, 0x24, 0x61, 0xFF, 0x26, 0x6A, 0xFF, 0x22, 0x41, 0xFF, 0x24, 0x41, 0xFF, 0x44, 0x41, 0xFF, 0x05, 0x62, 0xFF, 0x83, 0x49, 0xFF, 0x62, 0x49, 0xFF, 0x05, 0x5A, 0xFF, 0xC7, 0x6A, 0xFF, 0xA4, 0x51, 0xFF, 0xA7, 0x72, 0xFF, 0x05, 0x6A, 0xFF,
-    0xCA, 0x83, 0xFF, 0x66, 0x6A, 0xFF, 0x25, 0x62, 0xFF, 0x65, 0x6A, 0xFF, 0xA9, 0x7B, 0xFF, 0x24, 0x5A, 0xFF, 0xD6, 0xF6, 0xFF, 0x6F, 0xD5, 0xFF, 0xFE, 0xFF, 0xFF, 0xC7, 0x5A, 0xFF, 0x45, 0x52, 0xFF, 0xAC, 0xAC, 0xFF, 0x99, 0xF7, 0xFF, 0xAA, 0x7B, 0xFF, 0xC6, 0x52, 0xFF, 0x28, 0x63, 0xFF, 0xC7, 0x5A, 0xFF, 0xA7, 0x5A, 0xFF, 0xC7, 0x5A, 0xFF, 0xA6, 0x4A, 0xFF, 0xA6, 0x62, 0xFF, 0x08, 0x5B, 0xFF, 0x25, 0x42, 0xFF, 0x65, 0x42, 0xFF, 0x25, 0x3A, 0xFF, 0x46, 0x4A, 0xFF, 0x46, 0x42, 0xFF, 0x08, 0x63, 0xFF, 0xE7, 0x5A, 0xFF, 0x29, 0x73, 0xFF, 0x66, 0x52, 0xFF, 0x05, 0x42, 0xFF, 0xC6, 0x62, 0xFF, 0x66, 0x52, 0xFF, 0x25, 0x4A, 0xFF, 0xA6, 0x62, 0xFF, 0x0E, 0xA5, 0xFF, 0xE7, 0x6A, 0xFF, 0xA6, 0x62, 0xFF, 0x6B, 0x94, 0xFF, 0x70, 0xB5, 0xFF, 0x86, 0x5A, 0xFF, 0x24, 0x52, 0xFF, 0xAA, 0xA3, 0xFF, 0x06, 0x83, 0xFF, 0xC4, 0x49, 0xFF, 0xA3, 0x49, 0xFF, 0xAA, 0x93, 0xFF, 0x86, 0x9A, 0xFF, 0x66, 0x92, 0xFF, 0xC4, 0x61, 0xFF, 0xA7, 0x72, 0xFF, 0x04, 0x5A, 0xFF, 0x52, 0xFD, 0xFF, 0x49, 0x93, 0xFF, 0x25, 0x5A, 0xFF, 0x66, 0x5A, 0xFF, 0x46, 0x5A, 0xFF, 0x8B, 0xB3, 0xFF, 0x86, 0x62, 0xFF, 0x65, 0x62, 0xFF, 0xCA, 0x9B, 0xFF, 0xA6, 0x92, 0xFF, 0xE7, 0x72, 0xFF,
-    0xA9, 0x92, 0xFF, 0x63, 0x39, 0xFF, 0xE5, 0x61, 0xFF, 0x02, 0x39, 0xFF, 0x4A, 0x83, 0xFF, 0x02, 0x41, 0xFF, 0x01, 0x39, 0xFF, 0x63, 0x49, 0xFF, 0x2A, 0x83, 0xFF, 0x29, 0x83, 0xFF, 0x63, 0x59, 0xFF, 0x22, 0x49, 0xFF, 0x04, 0x62, 0xFF, 0x89, 0x8B, 0xFF, 0x28, 0x8B, 0xFF, 0xE8, 0x7A, 0xFF, 0x28, 0x83, 0xFF, 0x4B, 0xD4, 0xFF, 0x92, 0xEE, 0xFF, 0x86, 0x6A, 0xFF, 0xC7, 0x6A, 0xFF, 0xA7, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0xB5, 0xFF, 0x2C, 0x9C, 0xFF, 0x66, 0x52, 0xFF, 0x12, 0xC6, 0xFF, 0xA6, 0x52, 0xFF, 0x86, 0x5A, 0xFF, 0x86, 0x5A, 0xFF, 0x07, 0x53, 0xFF, 0xC9, 0x7B, 0xFF, 0xA6, 0x5A, 0xFF, 0x27, 0x53, 0xFF, 0x24, 0x4A, 0xFF, 0x4E, 0x85, 0xFF, 0x66, 0x5A, 0xFF, 0x04, 0x42, 0xFF, 0x05, 0x42, 0xFF, 0xE8, 0x5A, 0xFF, 0x6C, 0x84, 0xFF, 0x25, 0x4A, 0xFF, 0x05, 0x42, 0xFF, 0xE8, 0x62, 0xFF, 0x31, 0xA6, 0xFF, 0x67, 0x5A, 0xFF, 0x66, 0x52, 0xFF, 0xE4, 0x41, 0xFF, 0x85, 0x52, 0xFF, 0xA6, 0x5A, 0xFF, 0x04, 0x42, 0xFF, 0x87, 0x62, 0xFF, 0x86, 0x5A, 0xFF, 0xED, 0x9C, 0xFF, 0x04, 0x42, 0xFF, 0xC7, 0x62, 0xFF, 0x49, 0x7B, 0xFF, 0x4B, 0x94, 0xFF, 0xA5, 0x6A, 0xFF, 0x25, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0x45, 0x5A, 0xFF, 0xE7, 0x7A, 0xFF, 0x05, 0x5A, 0xFF,
-    0xC5, 0x61, 0xFF, 0x87, 0x82, 0xFF, 0xC4, 0x71, 0xFF, 0x89, 0x9B, 0xFF, 0x05, 0x52, 0xFF, 0xE5, 0x71, 0xFF, 0x6D, 0xFC, 0xFF, 0x87, 0xA2, 0xFF, 0xA6, 0x8A, 0xFF, 0x26, 0x5A, 0xFF, 0x87, 0x72, 0xFF, 0x66, 0x62, 0xFF, 0xBF, 0xFF, 0xFF, 0x86, 0x62, 0xFF, 0xC7, 0x6A, 0xFF, 0xC7, 0x6A, 0xFF, 0xA4, 0x59, 0xFF, 0x45, 0x62, 0xFF, 0x62, 0x41, 0xFF, 0x02, 0x49, 0xFF, 0x47, 0x72, 0xFF, 0x22, 0x49, 0xFF, 0xE0, 0x38, 0xFF, 0x25, 0x6A, 0xFF, 0xA9, 0x8A, 0xFF, 0x26, 0x8A, 0xFF, 0xBC, 0xFF, 0xFF, 0xC4, 0x99, 0xFF, 0x67, 0x7A, 0xFF, 0x01, 0x41, 0xFF, 0xA7, 0x82, 0xFF, 0xDE, 0xFF, 0xFF, 0xAA, 0xB3, 0xFF, 0xA7, 0x8A, 0xFF, 0x25, 0x6A, 0xFF, 0x49, 0x7B, 0xFF, 0x6B, 0xB4, 0xFF, 0x26, 0x5A, 0xFF, 0x28, 0x73, 0xFF, 0x65, 0x5A, 0xFF, 0xC7, 0x6A, 0xFF, 0x6B, 0xA4, 0xFF, 0x69, 0x6B, 0xFF, 0x25, 0x52, 0xFF, 0x86, 0x52, 0xFF, 0xE8, 0x6A, 0xFF, 0x6C, 0x94, 0xFF, 0x4C, 0x94, 0xFF, 0x2F, 0xAD, 0xFF, 0xC6, 0x4A, 0xFF, 0xA6, 0x5A, 0xFF, 0x6B, 0x8C, 0xFF, 0x57, 0xB6, 0xFF, 0x49, 0x73, 0xFF, 0x05, 0x42, 0xFF, 0x8A, 0x6B, 0xFF, 0xF1, 0xC5, 0xFF, 0x46, 0x52, 0xFF, 0x25, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xAD, 0xFF, 0x86, 0x62, 0xFF, 0xC6, 0x62, 0xFF, 0xC6, 0x62, 0xFF,
-    0x04, 0x52, 0xFF, 0x2B, 0x8C, 0xFF, 0xA9, 0x6B, 0xFF, 0x4A, 0x83, 0xFF, 0xC3, 0x41, 0xFF, 0x28, 0x6B, 0xFF, 0x0A, 0x8C, 0xFF, 0x66, 0x5A, 0xFF, 0x08, 0x73, 0xFF, 0x86, 0x5A, 0xFF, 0x49, 0x83, 0xFF, 0x69, 0x8B, 0xFF, 0xE8, 0x6A, 0xFF, 0xE5, 0x49, 0xFF, 0xC8, 0x6A, 0xFF, 0x85, 0x62, 0xFF, 0x49, 0x93, 0xFF, 0x66, 0x6A, 0xFF, 0x05, 0x5A, 0xFF, 0xC4, 0x51, 0xFF, 0x46, 0x6A, 0xFF, 0x83, 0x61, 0xFF, 0x05, 0x62, 0xFF, 0x45, 0x5A, 0xFF, 0x86, 0x62, 0xFF, 0xEB, 0xBB, 0xFF, 0x66, 0x7A, 0xFF, 0x86, 0x5A, 0xFF, 0x87, 0x62, 0xFF, 0x86, 0x5A, 0xFF, 0xA6, 0x62, 0xFF, 0xC7, 0x72, 0xFF, 0x43, 0x51, 0xFF, 0xE2, 0x48, 0xFF, 0x23, 0x49, 0xFF, 0xA7, 0xD2, 0xFF, 0xA8, 0xDA, 0xFF, 0x63, 0x59, 0xFF, 0xA3, 0x51, 0xFF, 0x85, 0x69, 0xFF, 0x4B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0xAA, 0xFF, 0xA9, 0xA2, 0xFF, 0xC4, 0x59, 0xFF, 0xE8, 0x8A, 0xFF, 0x89, 0xD3, 0xFF, 0x26, 0x9A, 0xFF, 0x46, 0x72, 0xFF, 0xE7, 0x6A, 0xFF, 0xC4, 0x59, 0xFF, 0x2B, 0xB4, 0xFF, 0xCE, 0xB4, 0xFF, 0xCA, 0x7B, 0xFF, 0x65, 0x62, 0xFF, 0x86, 0x62, 0xFF, 0x65, 0x5A, 0xFF, 0xC9, 0x73, 0xFF, 0xE4, 0x49, 0xFF, 0x86, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x84, 0xFF, 0xC6, 0x62, 0xFF, 0x69, 0x7B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE6, 0x5A, 0xFF, 0xA6, 0x62, 0xFF, 0xAD, 0x9C, 0xFF, 0x89, 0x7B, 0xFF, 0xA7, 0x5A, 0xFF, 0x05, 0x42, 0xFF, 0x91, 0xA5, 0xFF, 0xEA, 0x83, 0xFF, 0x26, 0x4A, 0xFF, 0x25, 0x42, 0xFF, 0xAA, 0x7B, 0xFF, 0x4F, 0x9D, 0xFF, 0xEA, 0x8B, 0xFF, 0xE7, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x6A, 0xFF, 0x62, 0x39, 0xFF, 0x0A, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x49, 0xFF, 0x6A, 0x7B, 0xFF, 0x8F, 0xC5, 0xFF, 0x0C, 0xCC, 0xFF, 0x86, 0x6A, 0xFF, 0x04, 0x4A, 0xFF, 0x49, 0x7B, 0xFF, 0x49, 0x8B, 0xFF, 0xCA, 0x9B, 0xFF, 0xE4, 0x49, 0xFF, 0xC7, 0x6A, 0xFF, 0x87, 0x6A, 0xFF, 0xA4, 0x51, 0xFF, 0xAA, 0xA3, 0xFF, 0xAA, 0x9B, 0xFF, 0xE5, 0x51, 0xFF, 0xE4, 0x51, 0xFF, 0x62, 0x49, 0xFF, 0x25, 0x7A, 0xFF, 0x6A, 0xA3, 0xFF, 0x67, 0x6A, 0xFF, 0x46, 0x5A, 0xFF, 0x83, 0x49, 0xFF, 0x25, 0x62, 0xFF, 0x08, 0x93, 0xFF, 0xA6, 0x62, 0xFF, 0xA7, 0x62, 0xFF, 0x2E, 0xBD, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x02, 0x41, 0xFF, 0x63, 0x51, 0xFF, 0xA2, 0x70, 0xFF, 0x23, 0x49, 0xFF, 0x63, 0x51, 0xFF, 0x0A, 0x9B, 0xFF, 0xE9, 0xA2, 0xFF, 0x83, 0x79, 0xFF, 0xE3, 0x78, 0xFF, 0x29, 0x93, 0xFF, 0x86, 0x6A, 0xFF, 0x4A, 0x93, 0xFF, 0x04, 0x62, 0xFF, 0x45, 0x62, 0xFF,
-    0x69, 0x7B, 0xFF, 0xC4, 0x61, 0xFF, 0xCB, 0xA3, 0xFF, 0x0B, 0xA4, 0xFF, 0x8D, 0xA4, 0xFF, 0x26, 0x62, 0xFF, 0x65, 0x6A, 0xFF, 0x2A, 0xAC, 0xFF, 0xD4, 0xEE, 0xFF, 0x04, 0x52, 0xFF, 0x25, 0x5A, 0xFF, 0xAA, 0x93, 0xFF, 0xFE, 0xFF, 0xFF, 0xC7, 0x72, 0xFF, 0xCA, 0x83, 0xFF, 0x28, 0x73, 0xFF, 0x47, 0x73, 0xFF, 0x66, 0x5A, 0xFF, 0x46, 0x5A, 0xFF, 0x07, 0x5B, 0xFF, 0x66, 0x62, 0xFF, 0x86, 0x5A, 0xFF, 0x05, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x05, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0xC8, 0x6A, 0xFF, 0xE8, 0x6A, 0xFF, 0xA7, 0x62, 0xFF, 0x66, 0x62, 0xFF, 0xE5, 0x49, 0xFF, 0x66, 0x62, 0xFF, 0x66, 0x5A, 0xFF, 0x04, 0x42, 0xFF, 0x25, 0x62, 0xFF, 0x91, 0xBD, 0xFF, 0x25, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x28, 0x83, 0xFF, 0x6B, 0xA4, 0xFF, 0xC4, 0x49, 0xFF, 0x08, 0x73, 0xFF, 0x68, 0xA3, 0xFF, 0x0B, 0xAC, 0xFF, 0x87, 0x62, 0xFF, 0xA7, 0x6A, 0xFF, 0xE8, 0x72, 0xFF, 0x27, 0x7A, 0xFF, 0xA7, 0x82, 0xFF, 0xC4, 0x59, 0xFF, 0x46, 0x62, 0xFF, 0xE6, 0x61, 0xFF, 0x46, 0x91, 0xFF, 0x05, 0x62, 0xFF, 0xE4, 0x59, 0xFF, 0x09, 0x7B, 0xFF, 0x68, 0x62, 0xFF, 0x45, 0x61, 0xFF, 0x26, 0x62, 0xFF, 0x66, 0x5A, 0xFF, 0x86, 0x6A, 0xFF, 0x08, 0x8B, 0xFF, 0x86, 0x72, 0xFF,
-    0x23, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0xE2, 0x38, 0xFF, 0x02, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x0D, 0x94, 0xFF, 0x46, 0x6A, 0xFF, 0xE8, 0x9A, 0xFF, 0x01, 0x59, 0xFF, 0x68, 0x7A, 0xFF, 0x64, 0x51, 0xFF, 0x6C, 0xB3, 0xFF, 0x01, 0x49, 0xFF, 0xC8, 0x8A, 0xFF, 0xA3, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x25, 0x6A, 0xFF, 0xE3, 0x69, 0xFF, 0x12, 0xEE, 0xFF, 0xEB, 0xA3, 0xFF, 0x86, 0x72, 0xFF, 0x45, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x72, 0xFF, 0x25, 0x5A, 0xFF, 0x27, 0x73, 0xFF, 0x0A, 0x8C, 0xFF, 0x69, 0x73, 0xFF, 0xE8, 0x72, 0xFF, 0x4B, 0x94, 0xFF, 0x68, 0x73, 0xFF, 0xE7, 0x62, 0xFF, 0xE7, 0x52, 0xFF, 0xA7, 0x62, 0xFF, 0xCC, 0x8C, 0xFF, 0x25, 0x52, 0xFF, 0x25, 0x52, 0xFF, 0x05, 0x42, 0xFF, 0x86, 0x52, 0xFF, 0x71, 0xAD, 0xFF, 0xE5, 0x49, 0xFF, 0xA7, 0x5A, 0xFF, 0x08, 0x6B, 0xFF, 0xAA, 0x7B, 0xFF, 0xA8, 0x6A, 0xFF, 0x87, 0x62, 0xFF, 0x05, 0x4A, 0xFF, 0xE6, 0x6A, 0xFF, 0xE4, 0x49, 0xFF, 0x25, 0x4A, 0xFF, 0x87, 0x6A, 0xFF, 0x45, 0x52, 0xFF, 0x66, 0x62, 0xFF, 0xE5, 0x49, 0xFF, 0x66, 0x5A, 0xFF, 0x66, 0x62, 0xFF, 0xCD, 0xB4, 0xFF, 0x05, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0xA8, 0x72, 0xFF, 0x24, 0x6A, 0xFF, 0x05, 0x5A, 0xFF, 0x25, 0x62, 0xFF,
-    0x05, 0x6A, 0xFF, 0xE8, 0x8A, 0xFF, 0xB7, 0xF6, 0xFF, 0x05, 0x5A, 0xFF, 0xC5, 0x59, 0xFF, 0x66, 0x89, 0xFF, 0x8C, 0xFB, 0xFF, 0x64, 0x89, 0xFF, 0xE6, 0x69, 0xFF, 0x08, 0x72, 0xFF, 0xC6, 0x69, 0xFF, 0xA8, 0x8A, 0xFF, 0xEF, 0xFC, 0xFF, 0x66, 0x62, 0xFF, 0xC7, 0x72, 0xFF, 0x86, 0x72, 0xFF, 0x43, 0x39, 0xFF, 0x02, 0x39, 0xFF, 0x64, 0x51, 0xFF, 0x86, 0x72, 0xFF, 0x43, 0x49, 0xFF, 0x64, 0x51, 0xFF, 0xE1, 0x48, 0xFF, 0x66, 0x8A, 0xFF, 0x46, 0x92, 0xFF, 0x46, 0x7A, 0xFF, 0x64, 0x59, 0xFF, 0x43, 0x69, 0xFF, 0x49, 0xB3, 0xFF, 0xC5, 0x79, 0xFF, 0x83, 0x59, 0xFF, 0xA7, 0x8A, 0xFF, 0x49, 0xC3, 0xFF, 0xB9, 0xFF, 0xFF, 0x6D, 0xD4, 0xFF, 0x45, 0x7A, 0xFF, 0xC4, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xA3, 0xFF, 0x45, 0x6A, 0xFF, 0x05, 0x52, 0xFF, 0xA9, 0x6B, 0xFF, 0xCD, 0xAC, 0xFF, 0x87, 0x6A, 0xFF, 0x66, 0x52, 0xFF, 0xCA, 0x83, 0xFF, 0x28, 0x73, 0xFF, 0x2B, 0x94, 0xFF, 0x8C, 0x94, 0xFF, 0x65, 0x4A, 0xFF, 0x08, 0x6B, 0xFF, 0xAC, 0x9C, 0xFF, 0x8A, 0x8B, 0xFF, 0x05, 0x52, 0xFF, 0x05, 0x42, 0xFF, 0x66, 0x4A, 0xFF, 0x12, 0xC6, 0xFF, 0xA7, 0x62, 0xFF, 0x45, 0x4A, 0xFF, 0xFE, 0xFF, 0xFF, 0x4B, 0x94, 0xFF, 0x08, 0x7B, 0xFF, 0xC7, 0x72, 0xFF, 0x4C, 0x9C, 0xFF,
-    0xC7, 0x72, 0xFF, 0x0A, 0x8C, 0xFF, 0x07, 0x5B, 0xFF, 0x28, 0x7B, 0xFF, 0x05, 0x5A, 0xFF, 0x0E, 0xBD, 0xFF, 0x08, 0x63, 0xFF, 0x87, 0x6A, 0xFF, 0x87, 0x6A, 0xFF, 0xE4, 0x49, 0xFF, 0xAA, 0x9B, 0xFF, 0x83, 0x49, 0xFF, 0x46, 0x62, 0xFF, 0xA7, 0x5A, 0xFF, 0xE3, 0x59, 0xFF, 0xEA, 0xB3, 0xFF, 0x26, 0x62, 0xFF, 0xC4, 0x49, 0xFF, 0xA4, 0x51, 0xFF, 0xC9, 0xAB, 0xFF, 0x05, 0x72, 0xFF, 0xA4, 0x61, 0xFF, 0xC6, 0x81, 0xFF, 0xA6, 0x89, 0xFF, 0x41, 0x71, 0xFF, 0x27, 0x62, 0xFF, 0x27, 0x5A, 0xFF, 0x06, 0x62, 0xFF, 0x48, 0x72, 0xFF, 0xE8, 0x7A, 0xFF, 0x87, 0x6A, 0xFF, 0x86, 0x6A, 0xFF, 0x06, 0x6A, 0xFF, 0x46, 0x72, 0xFF, 0xC5, 0x69, 0xFF, 0x02, 0x49, 0xFF, 0x43, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xA7, 0x82, 0xFF, 0xC5, 0x79, 0xFF, 0x2E, 0xFC, 0xFF, 0xC5, 0x79, 0xFF, 0x17, 0xFE, 0xFF, 0x29, 0xD3, 0xFF, 0x48, 0x92, 0xFF, 0x67, 0xAA, 0xFF, 0x84, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x89, 0xFF, 0xE8, 0x8A, 0xFF, 0xA8, 0x92, 0xFF, 0x45, 0x7A, 0xFF, 0xAC, 0xC4, 0xFF, 0xA7, 0x72, 0xFF, 0x05, 0x62, 0xFF, 0x26, 0x62, 0xFF, 0x86, 0x62, 0xFF, 0x8C, 0xB4, 0xFF, 0xC7, 0x72, 0xFF, 0xC7, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x72, 0xFF, 0x2A, 0x94, 0xFF, 0xEA, 0x93, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x04, 0x4A, 0xFF, 0xCB, 0x8B, 0xFF, 0x6B, 0xA4, 0xFF, 0x31, 0xDD, 0xFF, 0x66, 0x5A, 0xFF, 0x05, 0x42, 0xFF, 0x49, 0x6B, 0xFF, 0x44, 0x52, 0xFF, 0x87, 0x6A, 0xFF, 0xE4, 0x41, 0xFF, 0x10, 0xBD, 0xFF, 0x69, 0x83, 0xFF, 0xE8, 0x72, 0xFF, 0xCB, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x8B, 0xFF, 0x4B, 0x9C, 0xFF, 0x25, 0x52, 0xFF, 0xDF, 0xFF, 0xFF, 0xE8, 0x8A, 0xFF, 0xE4, 0x59, 0xFF, 0xEA, 0x9B, 0xFF, 0xD4, 0xCD, 0xFF, 0xA7, 0x82, 0xFF, 0xA3, 0x59, 0xFF, 0x25, 0x5A, 0xFF, 0x89, 0x9B, 0xFF, 0x05, 0x6A, 0xFF, 0xC4, 0x51, 0xFF, 0x07, 0x6B, 0xFF, 0xE4, 0x59, 0xFF, 0x69, 0xAB, 0xFF, 0x83, 0x49, 0xFF, 0xE8, 0x72, 0xFF, 0xA4, 0x51, 0xFF, 0xE4, 0x61, 0xFF, 0x8A, 0xB3, 0xFF, 0xE5, 0x59, 0xFF, 0x47, 0x6A, 0xFF, 0xE5, 0x51, 0xFF, 0x45, 0x72, 0xFF, 0x67, 0x6A, 0xFF, 0x67, 0x62, 0xFF, 0x06, 0x5A, 0xFF, 0x66, 0x5A, 0xFF, 0x66, 0x62, 0xFF, 0x08, 0x8B, 0xFF, 0x02, 0x41, 0xFF, 0x02, 0x41, 0xFF, 0x47, 0x82, 0xFF, 0x44, 0xA9, 0xFF, 0xFE, 0xFF, 0xFF, 0x64, 0x69, 0xFF, 0x67, 0x7A, 0xFF, 0x23, 0x59, 0xFF, 0x85, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xB1, 0xFF, 0x84, 0x79, 0xFF, 0xE9, 0x92, 0xFF, 0xE5, 0x79, 0xFF, 0xCD, 0xFC, 0xFF, 0xE4, 0x89, 0xFF,
-    0x69, 0x9B, 0xFF, 0xE5, 0x69, 0xFF, 0x05, 0x82, 0xFF, 0x0B, 0xC4, 0xFF, 0xA6, 0x82, 0xFF, 0xA3, 0x51, 0xFF, 0x26, 0x6A, 0xFF, 0x86, 0x72, 0xFF, 0xA9, 0x93, 0xFF, 0xC6, 0x7A, 0xFF, 0xAB, 0x93, 0xFF, 0x68, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x72, 0xFF, 0x4B, 0xA4, 0xFF, 0xA6, 0x7A, 0xFF, 0xCE, 0xB4, 0xFF, 0x48, 0x6B, 0xFF, 0x66, 0x6A, 0xFF, 0xEE, 0xB4, 0xFF, 0x66, 0x62, 0xFF, 0x25, 0x52, 0xFF, 0x05, 0x4A, 0xFF, 0x25, 0x4A, 0xFF, 0xEA, 0x8B, 0xFF, 0xE5, 0x51, 0xFF, 0xC4, 0x41, 0xFF, 0x66, 0x62, 0xFF, 0x08, 0x6B, 0xFF, 0xC9, 0x8B, 0xFF, 0x25, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0x66, 0x6A, 0xFF, 0x66, 0x5A, 0xFF, 0xA9, 0x8B, 0xFF, 0x86, 0x7A, 0xFF, 0xA6, 0x72, 0xFF, 0xC3, 0x51, 0xFF, 0xA3, 0x49, 0xFF, 0xA9, 0x9B, 0xFF, 0x2B, 0xBC, 0xFF, 0x04, 0x5A, 0xFF, 0xA4, 0x61, 0xFF, 0x25, 0x8A, 0xFF, 0xAA, 0xAB, 0xFF, 0x22, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0x46, 0x72, 0xFF, 0xA4, 0x71, 0xFF, 0xAD, 0xC4, 0xFF, 0x84, 0x59, 0xFF, 0xE4, 0x59, 0xFF, 0xE5, 0x61, 0xFF, 0xC5, 0x69, 0xFF, 0xC7, 0xAA, 0xFF, 0x4A, 0xAB, 0xFF, 0x05, 0x5A, 0xFF, 0xE5, 0x61, 0xFF, 0xE6, 0x69, 0xFF, 0xE8, 0xB2, 0xFF, 0x2B, 0xA3, 0xFF, 0x47, 0x6A, 0xFF, 0x47, 0x72, 0xFF, 0x66, 0x6A, 0xFF,
-    0xC1, 0x40, 0xFF, 0x43, 0x49, 0xFF, 0x06, 0x72, 0xFF, 0xC9, 0xA2, 0xFF, 0x03, 0x59, 0xFF, 0x02, 0x49, 0xFF, 0x05, 0x72, 0xFF, 0x23, 0x59, 0xFF, 0x64, 0x89, 0xFF, 0x65, 0xA1, 0xFF, 0x43, 0x61, 0xFF, 0x42, 0x61, 0xFF, 0x47, 0x8A, 0xFF, 0x06, 0x72, 0xFF, 0x43, 0x59, 0xFF, 0xA7, 0x72, 0xFF, 0x67, 0x9A, 0xFF, 0x68, 0xB2, 0xFF, 0x26, 0x8A, 0xFF, 0x08, 0x8B, 0xFF, 0xC4, 0x59, 0xFF, 0x83, 0x61, 0xFF, 0x69, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x62, 0xFF, 0x66, 0x6A, 0xFF, 0x86, 0x82, 0xFF, 0xFE, 0xFF, 0xFF, 0x66, 0x6A, 0xFF, 0x65, 0x72, 0xFF, 0xE8, 0x72, 0xFF, 0xA4, 0x62, 0xFF, 0xA6, 0x62, 0xFF, 0x27, 0x6B, 0xFF, 0x67, 0x6A, 0xFF, 0x0E, 0xAD, 0xFF, 0xE4, 0x59, 0xFF, 0xC4, 0x49, 0xFF, 0xE4, 0x41, 0xFF, 0x05, 0x42, 0xFF, 0x26, 0x52, 0xFF, 0x26, 0x62, 0xFF, 0xA4, 0x41, 0xFF, 0x49, 0x73, 0xFF, 0x48, 0x6B, 0xFF, 0xC8, 0x72, 0xFF, 0x04, 0x5A, 0xFF, 0xA4, 0x49, 0xFF, 0x85, 0x6A, 0xFF, 0x45, 0x52, 0xFF, 0xE8, 0x62, 0xFF, 0x67, 0x72, 0xFF, 0x66, 0x6A, 0xFF, 0x25, 0x5A, 0xFF, 0x46, 0x5A, 0xFF, 0x05, 0x6A, 0xFF, 0xA7, 0x7A, 0xFF, 0x66, 0x6A, 0xFF, 0xA4, 0x59, 0xFF, 0xA4, 0x61, 0xFF, 0x05, 0x82, 0xFF, 0x04, 0x72, 0xFF, 0x62, 0x49, 0xFF, 0x26, 0x6A, 0xFF,
-    0xC7, 0xA1, 0xFF, 0x46, 0x8A, 0xFF, 0xC5, 0x71, 0xFF, 0xA5, 0x59, 0xFF, 0xA8, 0x8A, 0xFF, 0xC6, 0x79, 0xFF, 0xA4, 0x79, 0xFF, 0xE8, 0xB1, 0xFF, 0xE6, 0x61, 0xFF, 0xE6, 0x59, 0xFF, 0xE6, 0x61, 0xFF, 0xE6, 0x79, 0xFF, 0xC6, 0x71, 0xFF, 0xE6, 0x79, 0xFF, 0x26, 0x72, 0xFF, 0x67, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0xE2, 0x40, 0xFF, 0x23, 0x49, 0xFF, 0x06, 0x7A, 0xFF, 0xE2, 0x48, 0xFF, 0xC5, 0x59, 0xFF, 0x63, 0x59, 0xFF, 0x02, 0x51, 0xFF, 0x43, 0x61, 0xFF, 0x87, 0x7A, 0xFF, 0x22, 0x51, 0xFF, 0x43, 0x61, 0xFF, 0xA5, 0x81, 0xFF, 0xE9, 0x8A, 0xFF, 0x83, 0x61, 0xFF, 0x85, 0x81, 0xFF, 0xE9, 0xBA, 0xFF, 0xA5, 0x92, 0xFF, 0xDC, 0xFF, 0xFF, 0xE5, 0x71, 0xFF, 0x85, 0x79, 0xFF, 0x45, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x72, 0xFF, 0x05, 0x5A, 0xFF, 0xCB, 0x93, 0xFF, 0x26, 0x9B, 0xFF, 0x66, 0x62, 0xFF, 0x25, 0x52, 0xFF, 0x87, 0x6A, 0xFF, 0x05, 0x5A, 0xFF, 0x24, 0x62, 0xFF, 0x69, 0x7B, 0xFF, 0x86, 0x62, 0xFF, 0xC4, 0x59, 0xFF, 0xD4, 0xDE, 0xFF, 0x65, 0x62, 0xFF, 0x05, 0x52, 0xFF, 0xE4, 0x41, 0xFF, 0x05, 0x42, 0xFF, 0xE3, 0x41, 0xFF, 0x46, 0x6A, 0xFF, 0xA4, 0x41, 0xFF, 0x70, 0xCD, 0xFF, 0x90, 0xB5, 0xFF, 0x09, 0x83, 0xFF, 0x66, 0x6A, 0xFF, 0x04, 0x52, 0xFF,
-    0x25, 0x6A, 0xFF, 0x04, 0x62, 0xFF, 0xE4, 0x41, 0xFF, 0x09, 0x8B, 0xFF, 0x4A, 0x83, 0xFF, 0x50, 0xC5, 0xFF, 0x08, 0x6B, 0xFF, 0xE4, 0x59, 0xFF, 0x08, 0x8B, 0xFF, 0x29, 0x83, 0xFF, 0x63, 0x51, 0xFF, 0xA4, 0x61, 0xFF, 0x83, 0x51, 0xFF, 0x66, 0x62, 0xFF, 0x42, 0x49, 0xFF, 0x84, 0x51, 0xFF, 0x83, 0x59, 0xFF, 0x67, 0x6A, 0xFF, 0xF2, 0xFD, 0xFF, 0xC8, 0x92, 0xFF, 0x89, 0x8A, 0xFF, 0x46, 0x71, 0xFF, 0xEB, 0xDA, 0xFF, 0x84, 0x71, 0xFF, 0x46, 0x81, 0xFF, 0x06, 0x62, 0xFF, 0xC6, 0x61, 0xFF, 0x05, 0x72, 0xFF, 0x68, 0xB2, 0xFF, 0xA9, 0xA2, 0xFF, 0x67, 0x6A, 0xFF, 0x67, 0x72, 0xFF, 0xE6, 0x71, 0xFF, 0x02, 0x41, 0xFF, 0xE2, 0x48, 0xFF, 0x43, 0x89, 0xFF, 0x02, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x02, 0x59, 0xFF, 0xE8, 0x8A, 0xFF, 0x02, 0x59, 0xFF, 0xA4, 0x69, 0xFF, 0x43, 0x61, 0xFF, 0x84, 0x69, 0xFF, 0xC7, 0xA2, 0xFF, 0x05, 0x6A, 0xFF, 0xC5, 0x79, 0xFF, 0xA5, 0x99, 0xFF, 0xE9, 0xBA, 0xFF, 0x05, 0x9A, 0xFF, 0x44, 0x91, 0xFF, 0x87, 0x82, 0xFF, 0xB5, 0xFE, 0xFF, 0x9C, 0xFF, 0xFF, 0xE5, 0x79, 0xFF, 0xA4, 0x59, 0xFF, 0xE4, 0x51, 0xFF, 0xA7, 0x7A, 0xFF, 0x46, 0x6A, 0xFF, 0xC5, 0x51, 0xFF, 0x0B, 0x84, 0xFF, 0x67, 0x72, 0xFF, 0x77, 0xF7, 0xFF, 0x25, 0x62, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x08, 0x73, 0xFF, 0xA7, 0x7A, 0xFF, 0x09, 0x8C, 0xFF, 0x08, 0x9B, 0xFF, 0x25, 0x5A, 0xFF, 0xE4, 0x49, 0xFF, 0x86, 0x5A, 0xFF, 0x86, 0x52, 0xFF, 0x87, 0x82, 0xFF, 0xA4, 0x41, 0xFF, 0x07, 0x8B, 0xFF, 0xC7, 0x6A, 0xFF, 0x0B, 0xA4, 0xFF, 0x45, 0x6A, 0xFF, 0x7A, 0xF7, 0xFF, 0x86, 0x82, 0xFF, 0xAD, 0xAC, 0xFF, 0xC4, 0x49, 0xFF, 0x27, 0x9B, 0xFF, 0xC8, 0x8A, 0xFF, 0x87, 0x6A, 0xFF, 0xA4, 0x51, 0xFF, 0x45, 0x7A, 0xFF, 0x46, 0x82, 0xFF, 0xE9, 0x82, 0xFF, 0x62, 0x51, 0xFF, 0x83, 0x61, 0xFF, 0x63, 0x59, 0xFF, 0x22, 0x49, 0xFF, 0xE4, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0xA4, 0x61, 0xFF, 0x84, 0x49, 0xFF, 0xC4, 0x59, 0xFF, 0x63, 0x51, 0xFF, 0xE5, 0x71, 0xFF, 0xA5, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x84, 0x61, 0xFF, 0xA8, 0x9A, 0xFF, 0xCD, 0xB3, 0xFF, 0x06, 0x62, 0xFF, 0xC5, 0x69, 0xFF, 0x46, 0x5A, 0xFF, 0x46, 0x62, 0xFF, 0x88, 0x82, 0xFF, 0xA1, 0x40, 0xFF, 0x25, 0x72, 0xFF, 0x03, 0x51, 0xFF, 0xE2, 0x60, 0xFF, 0x64, 0x71, 0xFF, 0xE2, 0x50, 0xFF, 0xE8, 0x92, 0xFF, 0x02, 0x51, 0xFF, 0xA5, 0x81, 0xFF, 0xE2, 0x70, 0xFF, 0xE7, 0xD1, 0xFF, 0x09, 0xE3, 0xFF, 0x05, 0x7A, 0xFF, 0x43, 0x59, 0xFF, 0xE5, 0x79, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x25, 0xB2, 0xFF, 0x68, 0xC2, 0xFF, 0xA4, 0x79, 0xFF, 0x85, 0x7A, 0xFF, 0x46, 0x7A, 0xFF, 0x46, 0x7A, 0xFF, 0xE5, 0x61, 0xFF, 0x45, 0x6A, 0xFF, 0x08, 0x73, 0xFF, 0x07, 0x8B, 0xFF, 0x87, 0x7A, 0xFF, 0x26, 0x6A, 0xFF, 0xD1, 0xBD, 0xFF, 0x46, 0x72, 0xFF, 0xEA, 0x9B, 0xFF, 0xA7, 0x7A, 0xFF, 0xCB, 0xAB, 0xFF, 0x66, 0x62, 0xFF, 0xE8, 0x82, 0xFF, 0x69, 0x9B, 0xFF, 0x92, 0xC5, 0xFF, 0x05, 0x52, 0xFF, 0xC4, 0x49, 0xFF, 0x26, 0x52, 0xFF, 0x04, 0x4A, 0xFF, 0xE5, 0x61, 0xFF, 0xA4, 0x49, 0xFF, 0xC7, 0x7A, 0xFF, 0x87, 0x6A, 0xFF, 0xE7, 0x7A, 0xFF, 0x66, 0x72, 0xFF, 0x05, 0x5A, 0xFF, 0x25, 0x7A, 0xFF, 0x84, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0xE7, 0x92, 0xFF, 0x85, 0x82, 0xFF, 0xA4, 0x51, 0xFF, 0xEC, 0xA3, 0xFF, 0xC8, 0x9A, 0xFF, 0xA7, 0xA2, 0xFF, 0xE9, 0x92, 0xFF, 0x63, 0x51, 0xFF, 0x69, 0x9B, 0xFF, 0x83, 0x71, 0xFF, 0x63, 0x61, 0xFF, 0x22, 0x49, 0xFF, 0xA4, 0x59, 0xFF, 0x49, 0xB3, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0x83, 0x51, 0xFF, 0x84, 0x69, 0xFF, 0x2A, 0xAB, 0xFF, 0x84, 0x59, 0xFF, 0x43, 0x69, 0xFF, 0xE4, 0x51, 0xFF, 0xA5, 0x59, 0xFF, 0xC5, 0x69, 0xFF, 0xE5, 0x59, 0xFF, 0xC5, 0x59, 0xFF, 0x25, 0x62, 0xFF, 0xC6, 0x81, 0xFF, 0x47, 0x72, 0xFF,
-    0x43, 0x61, 0xFF, 0x03, 0x49, 0xFF, 0xC2, 0x48, 0xFF, 0xE3, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0xA1, 0xFF, 0xE2, 0x58, 0xFF, 0x64, 0x69, 0xFF, 0x23, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xC1, 0xFF, 0x05, 0x7A, 0xFF, 0x64, 0x69, 0xFF, 0x43, 0x59, 0xFF, 0x70, 0xFD, 0xFF, 0xA7, 0x9A, 0xFF, 0x03, 0x81, 0xFF, 0xC5, 0xA9, 0xFF, 0xC5, 0x71, 0xFF, 0x28, 0x93, 0xFF, 0x10, 0xF5, 0xFF, 0x47, 0x82, 0xFF, 0xA4, 0x61, 0xFF, 0xCC, 0xD4, 0xFF, 0xC3, 0x59, 0xFF, 0x4C, 0xCC, 0xFF, 0x66, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x61, 0xFF, 0x46, 0x72, 0xFF, 0xEF, 0xCC, 0xFF, 0x93, 0xDD, 0xFF, 0x46, 0x6A, 0xFF, 0xE4, 0x51, 0xFF, 0x46, 0x6A, 0xFF, 0x0A, 0xA4, 0xFF, 0xA7, 0x72, 0xFF, 0xE5, 0x51, 0xFF, 0x83, 0x41, 0xFF, 0xA4, 0x39, 0xFF, 0xA9, 0x93, 0xFF, 0xC5, 0x69, 0xFF, 0x83, 0x41, 0xFF, 0x07, 0x73, 0xFF, 0x65, 0x5A, 0xFF, 0x89, 0x93, 0xFF, 0x46, 0x6A, 0xFF, 0xE4, 0x41, 0xFF, 0x25, 0x6A, 0xFF, 0x83, 0x49, 0xFF, 0x69, 0x8B, 0xFF, 0x05, 0x62, 0xFF, 0x24, 0x7A, 0xFF, 0xA4, 0x51, 0xFF, 0x83, 0x41, 0xFF, 0x48, 0x9B, 0xFF, 0xF2, 0xD4, 0xFF, 0x0A, 0x93, 0xFF, 0x84, 0x59, 0xFF, 0x01, 0x51, 0xFF, 0x08, 0x9B, 0xFF, 0x67, 0x82, 0xFF, 0x42, 0x51, 0xFF, 0x43, 0x49, 0xFF,
-    0xE6, 0x99, 0xFF, 0xC8, 0xAA, 0xFF, 0x24, 0x69, 0xFF, 0x64, 0x69, 0xFF, 0x63, 0x69, 0xFF, 0x24, 0x71, 0xFF, 0xAB, 0xD3, 0xFF, 0xC4, 0x69, 0xFF, 0xC4, 0x51, 0xFF, 0xE4, 0x51, 0xFF, 0x07, 0x92, 0xFF, 0xE8, 0xA2, 0xFF, 0xE6, 0x89, 0xFF, 0xC5, 0x71, 0xFF, 0x69, 0xAA, 0xFF, 0xE6, 0x79, 0xFF, 0xE2, 0x50, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x48, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x81, 0xFF, 0x05, 0x82, 0xFF, 0x02, 0x51, 0xFF, 0x02, 0x59, 0xFF, 0x43, 0x71, 0xFF, 0x26, 0xC2, 0xFF, 0x03, 0x69, 0xFF, 0x22, 0x61, 0xFF, 0xE2, 0x60, 0xFF, 0x02, 0x51, 0xFF, 0x67, 0x7A, 0xFF, 0x43, 0x61, 0xFF, 0x23, 0x71, 0xFF, 0x47, 0xA2, 0xFF, 0x28, 0x93, 0xFF, 0xA4, 0x69, 0xFF, 0xA4, 0x61, 0xFF, 0xCE, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0x82, 0xFF, 0x83, 0x51, 0xFF, 0x85, 0x9A, 0xFF, 0xC7, 0xB2, 0xFF, 0x94, 0xCD, 0xFF, 0xC4, 0x51, 0xFF, 0x66, 0x7A, 0xFF, 0x08, 0x8B, 0xFF, 0x84, 0x9A, 0xFF, 0x28, 0x73, 0xFF, 0x87, 0x62, 0xFF, 0x05, 0x72, 0xFF, 0x89, 0x83, 0xFF, 0x25, 0x62, 0xFF, 0xE5, 0x51, 0xFF, 0x83, 0x41, 0xFF, 0x82, 0x39, 0xFF, 0x0B, 0x9C, 0xFF, 0x06, 0x72, 0xFF, 0x63, 0x41, 0xFF, 0x8B, 0x9B, 0xFF, 0x6C, 0xB4, 0xFF, 0xC8, 0x82, 0xFF, 0x87, 0x82, 0xFF, 0x8A, 0x73, 0xFF,
-    0xC4, 0x69, 0xFF, 0x26, 0x62, 0xFF, 0x83, 0x49, 0xFF, 0x26, 0x72, 0xFF, 0x26, 0x72, 0xFF, 0x0C, 0xAC, 0xFF, 0x63, 0x49, 0xFF, 0xA4, 0x69, 0xFF, 0x27, 0x7A, 0xFF, 0xCA, 0xB3, 0xFF, 0x01, 0x41, 0xFF, 0x43, 0x59, 0xFF, 0x22, 0x49, 0xFF, 0x0D, 0xDC, 0xFF, 0x46, 0x6A, 0xFF, 0x02, 0x49, 0xFF, 0xA5, 0x61, 0xFF, 0x63, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0x81, 0xFF, 0x84, 0x61, 0xFF, 0xC4, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0xAA, 0xFF, 0xC4, 0x51, 0xFF, 0xC4, 0x51, 0xFF, 0x88, 0x8A, 0xFF, 0x87, 0x8A, 0xFF, 0xAE, 0xFC, 0xFF, 0xA5, 0x79, 0xFF, 0x66, 0x7A, 0xFF, 0xC7, 0x91, 0xFF, 0xA1, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0x02, 0x49, 0xFF, 0xE5, 0x71, 0xFF, 0x64, 0x69, 0xFF, 0x47, 0x9A, 0xFF, 0x02, 0x51, 0xFF, 0x64, 0x69, 0xFF, 0xE4, 0x71, 0xFF, 0xA5, 0x81, 0xFF, 0x23, 0x61, 0xFF, 0x64, 0x71, 0xFF, 0x66, 0x82, 0xFF, 0xE5, 0x71, 0xFF, 0x64, 0x69, 0xFF, 0x23, 0x61, 0xFF, 0x43, 0x81, 0xFF, 0xD3, 0xDD, 0xFF, 0x06, 0x8A, 0xFF, 0x63, 0x61, 0xFF, 0x64, 0x71, 0xFF, 0x35, 0xF6, 0xFF, 0x66, 0xB2, 0xFF, 0xC4, 0x71, 0xFF, 0x83, 0x51, 0xFF, 0x06, 0x7A, 0xFF, 0xCD, 0xD4, 0xFF, 0xE4, 0x59, 0xFF, 0x66, 0x62, 0xFF, 0x05, 0x72, 0xFF, 0x08, 0x8B, 0xFF, 0xE4, 0x69, 0xFF,
-    0xA3, 0x49, 0xFF, 0x05, 0x5A, 0xFF, 0xE5, 0x69, 0xFF, 0x2B, 0xAC, 0xFF, 0x26, 0x72, 0xFF, 0x84, 0x49, 0xFF, 0x63, 0x41, 0xFF, 0xA4, 0x49, 0xFF, 0xC9, 0xA3, 0xFF, 0x63, 0x69, 0xFF, 0x83, 0x49, 0xFF, 0x86, 0x8A, 0xFF, 0xEA, 0xAB, 0xFF, 0x6A, 0xA3, 0xFF, 0xC8, 0x8A, 0xFF, 0x05, 0x7A, 0xFF, 0xE4, 0x79, 0xFF, 0xE7, 0x92, 0xFF, 0x63, 0x49, 0xFF, 0x05, 0x8A, 0xFF, 0x4A, 0xA3, 0xFF, 0x28, 0x9B, 0xFF, 0x63, 0x51, 0xFF, 0x05, 0x7A, 0xFF, 0x09, 0xA3, 0xFF, 0x0A, 0x9B, 0xFF, 0x07, 0x9B, 0xFF, 0x67, 0x8A, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0x86, 0x9A, 0xFF, 0x88, 0x8A, 0xFF, 0x64, 0x59, 0xFF, 0x22, 0x49, 0xFF, 0x43, 0x51, 0xFF, 0xA8, 0xD1, 0xFF, 0x63, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0x83, 0x61, 0xFF, 0xA9, 0xAA, 0xFF, 0x6C, 0xDB, 0xFF, 0xC4, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0x05, 0x5A, 0xFF, 0x22, 0x41, 0xFF, 0x47, 0x7A, 0xFF, 0xA5, 0x71, 0xFF, 0xC6, 0x81, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x40, 0xFF, 0x23, 0x51, 0xFF, 0xE2, 0x58, 0xFF, 0x84, 0x71, 0xFF, 0xE2, 0x50, 0xFF, 0x02, 0x51, 0xFF, 0xC4, 0x71, 0xFF, 0x06, 0x92, 0xFF, 0xE2, 0x68, 0xFF, 0xA4, 0x99, 0xFF, 0x06, 0x7A, 0xFF, 0x02, 0x59, 0xFF, 0x44, 0x71, 0xFF, 0x84, 0x99, 0xFF,
-    0x83, 0x99, 0xFF, 0x05, 0xAA, 0xFF, 0x64, 0x61, 0xFF, 0xA4, 0x69, 0xFF, 0xE5, 0x81, 0xFF, 0xE4, 0x99, 0xFF, 0xE4, 0x79, 0xFF, 0x84, 0x59, 0xFF, 0xE8, 0x7A, 0xFF, 0x25, 0x82, 0xFF, 0xC4, 0x71, 0xFF, 0xE4, 0x59, 0xFF, 0x45, 0x62, 0xFF, 0x05, 0x6A, 0xFF, 0x4F, 0xD5, 0xFF, 0x26, 0x7A, 0xFF, 0xE5, 0x61, 0xFF, 0xE4, 0x51, 0xFF, 0xE4, 0x61, 0xFF, 0x32, 0xDE, 0xFF, 0xA7, 0x9A, 0xFF, 0xC4, 0x51, 0xFF, 0x84, 0x49, 0xFF, 0xA3, 0x41, 0xFF, 0xCA, 0xB3, 0xFF, 0x83, 0x71, 0xFF, 0xA4, 0x51, 0xFF, 0x28, 0x93, 0xFF, 0xA5, 0x82, 0xFF, 0x08, 0x93, 0xFF, 0xC8, 0x92, 0xFF, 0xC5, 0x61, 0xFF, 0x87, 0x9A, 0xFF, 0xF0, 0xED, 0xFF, 0xC3, 0x49, 0xFF, 0x05, 0x82, 0xFF, 0x67, 0xA2, 0xFF, 0x46, 0x6A, 0xFF, 0xED, 0xCC, 0xFF, 0x06, 0x8A, 0xFF, 0x88, 0xA2, 0xFF, 0x2A, 0xA3, 0xFF, 0xC1, 0x48, 0xFF, 0x08, 0xAB, 0xFF, 0xA4, 0x89, 0xFF, 0x84, 0x71, 0xFF, 0xA5, 0x71, 0xFF, 0xA1, 0x40, 0xFF, 0x22, 0x79, 0xFF, 0x02, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x05, 0x7A, 0xFF, 0xC9, 0xD2, 0xFF, 0x23, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0xA4, 0x61, 0xFF, 0xA4, 0x51, 0xFF, 0x2D, 0xEC, 0xFF, 0x42, 0x51, 0xFF, 0xE4, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0xA5, 0x71, 0xFF, 0xA6, 0x81, 0xFF, 0x06, 0x8A, 0xFF,
-    0xA1, 0x50, 0xFF, 0xE5, 0x79, 0xFF, 0xE2, 0x48, 0xFF, 0xE3, 0x58, 0xFF, 0xC2, 0x68, 0xFF, 0xE2, 0x70, 0xFF, 0x27, 0x92, 0xFF, 0xE4, 0x69, 0xFF, 0xE2, 0x68, 0xFF, 0x25, 0x91, 0xFF, 0x84, 0xA1, 0xFF, 0x06, 0xAA, 0xFF, 0x22, 0x69, 0xFF, 0xE2, 0x58, 0xFF, 0x43, 0x79, 0xFF, 0x2B, 0xFB, 0xFF, 0x85, 0xB9, 0xFF, 0x64, 0x89, 0xFF, 0xC4, 0x61, 0xFF, 0xE7, 0x7A, 0xFF, 0x64, 0x69, 0xFF, 0x06, 0x82, 0xFF, 0x43, 0x61, 0xFF, 0x28, 0x8B, 0xFF, 0x63, 0x51, 0xFF, 0x83, 0x69, 0xFF, 0x05, 0x82, 0xFF, 0x33, 0xFE, 0xFF, 0x84, 0x61, 0xFF, 0xE5, 0x71, 0xFF, 0xEC, 0xCB, 0xFF, 0xD4, 0xED, 0xFF, 0xA6, 0x82, 0xFF, 0xC5, 0x59, 0xFF, 0xA4, 0x69, 0xFF, 0x45, 0x92, 0xFF, 0x28, 0xAB, 0xFF, 0xC5, 0x59, 0xFF, 0x63, 0x49, 0xFF, 0xE4, 0x59, 0xFF, 0x0C, 0x8C, 0xFF, 0x84, 0x69, 0xFF, 0x63, 0x49, 0xFF, 0x09, 0x93, 0xFF, 0xD0, 0xEC, 0xFF, 0x87, 0x7A, 0xFF, 0x26, 0x72, 0xFF, 0xC4, 0x61, 0xFF, 0xDD, 0xFF, 0xFF, 0x22, 0x51, 0xFF, 0x83, 0x49, 0xFF, 0x06, 0x82, 0xFF, 0x1A, 0xFF, 0xFF, 0x83, 0x59, 0xFF, 0x86, 0x62, 0xFF, 0x83, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x82, 0xFF, 0xE1, 0x48, 0xFF, 0x06, 0x82, 0xFF, 0xA6, 0xC1, 0xFF, 0x84, 0x91, 0xFF, 0x84, 0x71, 0xFF, 0xE2, 0x48, 0xFF,
-    0x25, 0xA1, 0xFF, 0x02, 0x61, 0xFF, 0x03, 0x51, 0xFF, 0x64, 0x69, 0xFF, 0x03, 0x59, 0xFF, 0x43, 0x59, 0xFF, 0x43, 0x59, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x49, 0xFF, 0xE4, 0x51, 0xFF, 0x43, 0x61, 0xFF, 0xA4, 0x69, 0xFF, 0xA4, 0x59, 0xFF, 0xE5, 0x59, 0xFF, 0x4D, 0xF4, 0xFF, 0xA5, 0x71, 0xFF, 0xC3, 0xA8, 0xFF, 0xE2, 0x50, 0xFF, 0xE2, 0x50, 0xFF, 0xC3, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0xA9, 0xFF, 0x24, 0x69, 0xFF, 0xC2, 0x58, 0xFF, 0x05, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0xD1, 0xFF, 0x03, 0x71, 0xFF, 0x23, 0x69, 0xFF, 0x22, 0x61, 0xFF, 0xFE, 0xFF, 0xFF, 0xE3, 0x78, 0xFF, 0xC5, 0x91, 0xFF, 0x84, 0x81, 0xFF, 0x29, 0x93, 0xFF, 0xA4, 0x71, 0xFF, 0x07, 0xD3, 0xFF, 0x64, 0x79, 0xFF, 0xA7, 0xBA, 0xFF, 0x43, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0x8A, 0xDB, 0xFF, 0x88, 0xB2, 0xFF, 0xB7, 0xFE, 0xFF, 0xC3, 0x59, 0xFF, 0xC8, 0xA2, 0xFF, 0x28, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x7A, 0xFF, 0xE9, 0x7A, 0xFF, 0xC4, 0x61, 0xFF, 0xCC, 0xEB, 0xFF, 0xC8, 0x82, 0xFF, 0xA4, 0x51, 0xFF, 0x64, 0x49, 0xFF, 0xC3, 0x49, 0xFF, 0x89, 0x9B, 0xFF, 0x63, 0x61, 0xFF, 0x63, 0x49, 0xFF, 0x26, 0x72, 0xFF, 0x0A, 0xB4, 0xFF, 0x68, 0x9B, 0xFF, 0x26, 0x72, 0xFF, 0x28, 0x73, 0xFF,
-    0x25, 0x8A, 0xFF, 0xE5, 0x61, 0xFF, 0x49, 0x9B, 0xFF, 0x62, 0x59, 0xFF, 0x0A, 0x93, 0xFF, 0x09, 0xA3, 0xFF, 0x23, 0x41, 0xFF, 0x08, 0x9B, 0xFF, 0x06, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x62, 0xFF, 0x84, 0x71, 0xFF, 0x66, 0xAA, 0xFF, 0x55, 0xFE, 0xFF, 0xE5, 0x81, 0xFF, 0x23, 0x59, 0xFF, 0xC2, 0x48, 0xFF, 0x06, 0xBA, 0xFF, 0x89, 0xEA, 0xFF, 0xC2, 0x70, 0xFF, 0xC3, 0x58, 0xFF, 0x24, 0x79, 0xFF, 0x2A, 0xEB, 0xFF, 0x24, 0x79, 0xFF, 0x84, 0x51, 0xFF, 0xA4, 0x51, 0xFF, 0x64, 0x61, 0xFF, 0xE7, 0x99, 0xFF, 0x45, 0xB9, 0xFF, 0xC4, 0x59, 0xFF, 0x25, 0x6A, 0xFF, 0xE2, 0x80, 0xFF, 0xC2, 0x60, 0xFF, 0xC2, 0x50, 0xFF, 0xA2, 0x50, 0xFF, 0xC3, 0x60, 0xFF, 0xC3, 0x80, 0xFF, 0x82, 0x60, 0xFF, 0xC2, 0x60, 0xFF, 0xC2, 0x58, 0xFF, 0x25, 0x71, 0xFF, 0x05, 0xA1, 0xFF, 0xE3, 0x88, 0xFF, 0xA1, 0x70, 0xFF, 0x43, 0x61, 0xFF, 0xE2, 0x58, 0xFF, 0xE3, 0x60, 0xFF, 0xE2, 0x58, 0xFF, 0x84, 0x89, 0xFF, 0xA5, 0x89, 0xFF, 0x84, 0x69, 0xFF, 0x63, 0x61, 0xFF, 0x84, 0x69, 0xFF, 0x87, 0xC9, 0xFF, 0x09, 0xDB, 0xFF, 0x85, 0x69, 0xFF, 0x43, 0x69, 0xFF, 0x83, 0x79, 0xFF, 0xCF, 0xFC, 0xFF, 0xE5, 0x81, 0xFF, 0xA7, 0x7A, 0xFF, 0x47, 0xA2, 0xFF, 0x69, 0x93, 0xFF, 0xEB, 0xCB, 0xFF,
-    0xC8, 0x7A, 0xFF, 0xA4, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x4C, 0xCC, 0xFF, 0xC4, 0x69, 0xFF, 0x83, 0x49, 0xFF, 0x84, 0x49, 0xFF, 0xA3, 0x41, 0xFF, 0xE7, 0x7A, 0xFF, 0xC5, 0x79, 0xFF, 0x83, 0x49, 0xFF, 0x63, 0x59, 0xFF, 0x6C, 0xBC, 0xFF, 0x26, 0x82, 0xFF, 0x06, 0x7A, 0xFF, 0x87, 0x6A, 0xFF, 0x66, 0x82, 0xFF, 0x2C, 0xCC, 0xFF, 0x43, 0x51, 0xFF, 0x84, 0x71, 0xFF, 0xA7, 0x8A, 0xFF, 0x89, 0xB3, 0xFF, 0x42, 0x41, 0xFF, 0xE5, 0x71, 0xFF, 0x47, 0x8A, 0xFF, 0x25, 0x72, 0xFF, 0x48, 0xBB, 0xFF, 0xA4, 0x61, 0xFF, 0x22, 0x61, 0xFF, 0x84, 0x71, 0xFF, 0xAB, 0xE3, 0xFF, 0xA4, 0x61, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0x86, 0x79, 0xFF, 0x24, 0x91, 0xFF, 0x23, 0x49, 0xFF, 0x45, 0x61, 0xFF, 0x85, 0x91, 0xFF, 0x01, 0x70, 0xFF, 0xE5, 0x59, 0xFF, 0xA4, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0xC4, 0x59, 0xFF, 0xC5, 0x61, 0xFF, 0x27, 0x7A, 0xFF, 0xC4, 0x59, 0xFF, 0xC5, 0x79, 0xFF, 0xA1, 0x48, 0xFF, 0xC2, 0x50, 0xFF, 0x03, 0x59, 0xFF, 0x05, 0x7A, 0xFF, 0xC3, 0x58, 0xFF, 0xA3, 0x58, 0xFF, 0xE3, 0x78, 0xFF, 0xC2, 0x58, 0xFF, 0x26, 0x8A, 0xFF, 0xC3, 0x60, 0xFF, 0x85, 0x81, 0xFF, 0xE2, 0x70, 0xFF, 0xE8, 0x9A, 0xFF, 0x03, 0x61, 0xFF, 0x03, 0x61, 0xFF, 0x23, 0x71, 0xFF,
-    0x64, 0x99, 0xFF, 0x4B, 0xF3, 0xFF, 0x23, 0x59, 0xFF, 0x63, 0x61, 0xFF, 0xA4, 0x79, 0xFF, 0xE7, 0xE1, 0xFF, 0xE7, 0xB1, 0xFF, 0x23, 0x59, 0xFF, 0xA3, 0x59, 0xFF, 0x64, 0x71, 0xFF, 0xE8, 0xBA, 0xFF, 0xA4, 0x69, 0xFF, 0x42, 0x51, 0xFF, 0xE6, 0x79, 0xFF, 0x46, 0x82, 0xFF, 0xC5, 0x69, 0xFF, 0x84, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0x63, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0xC5, 0x71, 0xFF, 0x42, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x51, 0xFF, 0xC4, 0x71, 0xFF, 0x63, 0x49, 0xFF, 0x42, 0x61, 0xFF, 0x45, 0x82, 0xFF, 0xAB, 0xB3, 0xFF, 0xC5, 0x71, 0xFF, 0x84, 0x59, 0xFF, 0x2B, 0xBB, 0xFF, 0x87, 0x72, 0xFF, 0x63, 0x49, 0xFF, 0x23, 0x71, 0xFF, 0xA5, 0x89, 0xFF, 0x84, 0x61, 0xFF, 0x23, 0x49, 0xFF, 0x43, 0x61, 0xFF, 0x05, 0x92, 0xFF, 0x06, 0x7A, 0xFF, 0xE5, 0x79, 0xFF, 0xC6, 0x81, 0xFF, 0x63, 0x79, 0xFF, 0x23, 0x61, 0xFF, 0xE2, 0x50, 0xFF, 0x64, 0x61, 0xFF, 0xC2, 0x40, 0xFF, 0x64, 0x61, 0xFF, 0xA2, 0x48, 0xFF, 0x45, 0x59, 0xFF, 0xE2, 0x48, 0xFF, 0x84, 0x59, 0xFF, 0x23, 0x59, 0xFF, 0x24, 0x49, 0xFF, 0x84, 0x49, 0xFF, 0xA4, 0x51, 0xFF, 0x63, 0x51, 0xFF, 0x84, 0x51, 0xFF, 0xC5, 0x51, 0xFF, 0xE5, 0x59, 0xFF, 0xC5, 0x59, 0xFF, 0xC5, 0x69, 0xFF,
-    0xA3, 0x58, 0xFF, 0x05, 0xA1, 0xFF, 0xE7, 0x89, 0xFF, 0xA3, 0x50, 0xFF, 0xC3, 0x58, 0xFF, 0x82, 0x58, 0xFF, 0xAA, 0xCA, 0xFF, 0x84, 0x79, 0xFF, 0xC3, 0x58, 0xFF, 0xC2, 0x60, 0xFF, 0x69, 0xB2, 0xFF, 0xE9, 0xEA, 0xFF, 0xC2, 0x60, 0xFF, 0x03, 0x61, 0xFF, 0x03, 0x71, 0xFF, 0x27, 0xDA, 0xFF, 0x0C, 0xFC, 0xFF, 0xA6, 0x91, 0xFF, 0x03, 0x59, 0xFF, 0x87, 0x82, 0xFF, 0x25, 0xC1, 0xFF, 0x48, 0xEA, 0xFF, 0x84, 0x81, 0xFF, 0xE5, 0x71, 0xFF, 0x83, 0x51, 0xFF, 0xE8, 0xBA, 0xFF, 0xA4, 0x71, 0xFF, 0x84, 0x59, 0xFF, 0x43, 0x61, 0xFF, 0x05, 0x72, 0xFF, 0x49, 0xB3, 0xFF, 0xA4, 0x79, 0xFF, 0x63, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0x64, 0x61, 0xFF, 0x8A, 0xBB, 0xFF, 0x26, 0x92, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0xA4, 0x51, 0xFF, 0x07, 0xAB, 0xFF, 0x06, 0x82, 0xFF, 0x63, 0x49, 0xFF, 0x63, 0x61, 0xFF, 0x98, 0xFE, 0xFF, 0x67, 0x9A, 0xFF, 0x47, 0x82, 0xFF, 0x64, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xAB, 0xFF, 0x43, 0x49, 0xFF, 0x44, 0x69, 0xFF, 0x78, 0xE6, 0xFF, 0x02, 0x51, 0xFF, 0x08, 0xA3, 0xFF, 0x43, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x71, 0xFF, 0x22, 0x59, 0xFF, 0xA7, 0xA2, 0xFF, 0xD1, 0xED, 0xFF, 0xE2, 0x68, 0xFF, 0x02, 0x61, 0xFF, 0xA3, 0x60, 0xFF,
-    0xD4, 0xED, 0xFF, 0x24, 0x61, 0xFF, 0xE3, 0x58, 0xFF, 0x03, 0x51, 0xFF, 0x67, 0xC2, 0xFF, 0x02, 0x49, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x43, 0x49, 0xFF, 0x88, 0xB2, 0xFF, 0x44, 0x69, 0xFF, 0x84, 0x51, 0xFF, 0xA4, 0x51, 0xFF, 0xC5, 0x51, 0xFF, 0x68, 0xFA, 0xFF, 0x89, 0xA2, 0xFF, 0x82, 0x70, 0xFF, 0x0B, 0xEB, 0xFF, 0xA3, 0x58, 0xFF, 0xA3, 0x60, 0xFF, 0x04, 0x71, 0xFF, 0x05, 0x79, 0xFF, 0x46, 0xA9, 0xFF, 0x66, 0x79, 0xFF, 0xC4, 0x60, 0xFF, 0x05, 0x81, 0xFF, 0x87, 0xB1, 0xFF, 0x86, 0xB1, 0xFF, 0xC2, 0x60, 0xFF, 0x82, 0x58, 0xFF, 0x47, 0x92, 0xFF, 0x45, 0xC9, 0xFF, 0x64, 0xB9, 0xFF, 0xE4, 0x68, 0xFF, 0xE5, 0x71, 0xFF, 0x02, 0x59, 0xFF, 0x23, 0x79, 0xFF, 0x86, 0x91, 0xFF, 0xA4, 0x79, 0xFF, 0xC4, 0x71, 0xFF, 0x84, 0x51, 0xFF, 0xE4, 0x79, 0xFF, 0x44, 0x79, 0xFF, 0x48, 0xC3, 0xFF, 0xC5, 0x71, 0xFF, 0x63, 0x69, 0xFF, 0x43, 0x71, 0xFF, 0xFD, 0xFF, 0xFF, 0x42, 0x69, 0xFF, 0x84, 0x51, 0xFF, 0x84, 0x81, 0xFF, 0xB1, 0xFD, 0xFF, 0x67, 0xA2, 0xFF, 0x63, 0x51, 0xFF, 0x84, 0x51, 0xFF, 0x63, 0x61, 0xFF, 0x0F, 0xFD, 0xFF, 0xC8, 0xA2, 0xFF, 0x63, 0x49, 0xFF, 0xB0, 0xF4, 0xFF, 0x56, 0xFF, 0xFF, 0xE6, 0x71, 0xFF, 0xE5, 0x69, 0xFF, 0x84, 0x59, 0xFF,
-    0x26, 0xD2, 0xFF, 0x43, 0x61, 0xFF, 0x43, 0x49, 0xFF, 0x85, 0x69, 0xFF, 0x6A, 0xDA, 0xFF, 0x23, 0x71, 0xFF, 0x43, 0x49, 0xFF, 0x02, 0x49, 0xFF, 0x43, 0x79, 0xFF, 0x3A, 0xFF, 0xFF, 0x23, 0x51, 0xFF, 0xA1, 0x48, 0xFF, 0xE6, 0x99, 0xFF, 0xCB, 0xF3, 0xFF, 0x03, 0x79, 0xFF, 0xE2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0x2A, 0xFB, 0xFF, 0xE4, 0x90, 0xFF, 0xE3, 0x50, 0xFF, 0xE2, 0x48, 0xFF, 0x49, 0xA2, 0xFF, 0x64, 0xA1, 0xFF, 0x02, 0x49, 0xFF, 0x43, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x43, 0x59, 0xFF, 0xA6, 0xB1, 0xFF, 0xA5, 0x61, 0xFF, 0xC5, 0x59, 0xFF, 0xA5, 0x61, 0xFF, 0xAC, 0xFB, 0xFF, 0x41, 0xB0, 0xFF, 0x41, 0x60, 0xFF, 0x83, 0x58, 0xFF, 0xA3, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0xE9, 0xFF, 0xE4, 0x78, 0xFF, 0x04, 0x69, 0xFF, 0xC3, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0xF1, 0xFF, 0x44, 0x91, 0xFF, 0xE2, 0x60, 0xFF, 0x03, 0x69, 0xFF, 0x5A, 0xFF, 0xFF, 0x04, 0xC1, 0xFF, 0xC8, 0xA1, 0xFF, 0x03, 0x61, 0xFF, 0x43, 0x61, 0xFF, 0x23, 0x61, 0xFF, 0x87, 0xD2, 0xFF, 0xC7, 0x91, 0xFF, 0x85, 0x81, 0xFF, 0x44, 0x61, 0xFF, 0x83, 0x59, 0xFF, 0x51, 0xF5, 0xFF, 0x46, 0x91, 0xFF, 0xA6, 0x89, 0xFF, 0xA4, 0x61, 0xFF, 0xE5, 0x69, 0xFF, 0xCA, 0xD3, 0xFF, 0x06, 0xB2, 0xFF,
-    0xA4, 0x61, 0xFF, 0xA4, 0x51, 0xFF, 0xC4, 0x61, 0xFF, 0x69, 0xC3, 0xFF, 0xC9, 0x9A, 0xFF, 0x84, 0x51, 0xFF, 0x84, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0x08, 0x9B, 0xFF, 0xA4, 0x59, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x44, 0x99, 0xFF, 0x48, 0x9B, 0xFF, 0x83, 0x51, 0xFF, 0x83, 0x49, 0xFF, 0x66, 0x81, 0xFF, 0x63, 0x51, 0xFF, 0xE8, 0x92, 0xFF, 0x23, 0x51, 0xFF, 0xA4, 0x69, 0xFF, 0xA6, 0x91, 0xFF, 0x43, 0x41, 0xFF, 0xE7, 0x92, 0xFF, 0x83, 0x59, 0xFF, 0x02, 0x71, 0xFF, 0x43, 0x51, 0xFF, 0x02, 0x41, 0xFF, 0xA8, 0x9A, 0xFF, 0x43, 0x71, 0xFF, 0x46, 0xA2, 0xFF, 0x02, 0x49, 0xFF, 0xE2, 0x40, 0xFF, 0x46, 0x92, 0xFF, 0xE4, 0x58, 0xFF, 0xE2, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x41, 0xFF, 0x47, 0x92, 0xFF, 0x02, 0x49, 0xFF, 0x02, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x68, 0x82, 0xFF, 0x83, 0x49, 0xFF, 0x84, 0x51, 0xFF, 0xA5, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0x83, 0x70, 0xFF, 0x82, 0x60, 0xFF, 0x82, 0x58, 0xFF, 0x25, 0x71, 0xFF, 0x04, 0x91, 0xFF, 0xE4, 0x78, 0xFF, 0xC3, 0x78, 0xFF, 0xC3, 0x60, 0xFF, 0x27, 0x92, 0xFF, 0xA2, 0x90, 0xFF, 0xC3, 0x88, 0xFF, 0x66, 0xA9, 0xFF, 0xE2, 0x60, 0xFF, 0x23, 0x61, 0xFF, 0x03, 0x69, 0xFF, 0xE3, 0x70, 0xFF,
-    0xAB, 0xC2, 0xFF, 0x87, 0x92, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x59, 0xFF, 0xC6, 0x81, 0xFF, 0x46, 0xD9, 0xFF, 0x4C, 0xEB, 0xFF, 0x64, 0x61, 0xFF, 0x84, 0x59, 0xFF, 0xC5, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x91, 0xFF, 0x84, 0x71, 0xFF, 0xE5, 0x71, 0xFF, 0xC4, 0xA1, 0xFF, 0x7D, 0xFF, 0xFF, 0xE5, 0x59, 0xFF, 0xE4, 0x51, 0xFF, 0xA3, 0x51, 0xFF, 0xAB, 0xFB, 0xFF, 0xE5, 0x69, 0xFF, 0xA4, 0x59, 0xFF, 0x83, 0x41, 0xFF, 0xA4, 0x49, 0xFF, 0x8A, 0xAB, 0xFF, 0xA4, 0x59, 0xFF, 0x63, 0x41, 0xFF, 0x63, 0x49, 0xFF, 0x45, 0x82, 0xFF, 0xC5, 0x59, 0xFF, 0x84, 0x51, 0xFF, 0x84, 0x49, 0xFF, 0x06, 0x62, 0xFF, 0xCB, 0xC3, 0xFF, 0x43, 0x41, 0xFF, 0x64, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0x29, 0xAB, 0xFF, 0x43, 0x49, 0xFF, 0x02, 0x49, 0xFF, 0x63, 0x51, 0xFF, 0x02, 0x49, 0xFF, 0x87, 0xB2, 0xFF, 0xE2, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0x22, 0x51, 0xFF, 0x03, 0x59, 0xFF, 0x02, 0x41, 0xFF, 0xE2, 0x48, 0xFF, 0x03, 0x59, 0xFF, 0xA3, 0x38, 0xFF, 0x68, 0xBA, 0xFF, 0xA1, 0x30, 0xFF, 0xC1, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0x81, 0x40, 0xFF, 0x02, 0x49, 0xFF, 0x43, 0x39, 0xFF, 0x43, 0x41, 0xFF, 0x63, 0x41, 0xFF, 0x84, 0x49, 0xFF, 0xE6, 0x71, 0xFF, 0xA4, 0x59, 0xFF, 0xC4, 0x59, 0xFF,
-    0xC4, 0x58, 0xFF, 0x86, 0x91, 0xFF, 0xE4, 0x70, 0xFF, 0xA2, 0x58, 0xFF, 0xA2, 0x58, 0xFF, 0xA3, 0x60, 0xFF, 0x86, 0xA1, 0xFF, 0xC3, 0x70, 0xFF, 0xA2, 0x60, 0xFF, 0xE3, 0x68, 0xFF, 0xC2, 0x70, 0xFF, 0x24, 0xA1, 0xFF, 0x03, 0x69, 0xFF, 0x23, 0x69, 0xFF, 0x03, 0x61, 0xFF, 0xC3, 0x78, 0xFF, 0x45, 0xA1, 0xFF, 0x03, 0x69, 0xFF, 0x24, 0x59, 0xFF, 0x04, 0x59, 0xFF, 0x65, 0x81, 0xFF, 0xCC, 0xF3, 0xFF, 0xA4, 0xA1, 0xFF, 0x44, 0x61, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x71, 0xFF, 0x84, 0x79, 0xFF, 0x84, 0x69, 0xFF, 0xE4, 0x90, 0xFF, 0x84, 0x61, 0xFF, 0xA5, 0x71, 0xFF, 0x84, 0x69, 0xFF, 0x84, 0x59, 0xFF, 0xA4, 0x49, 0xFF, 0xC4, 0x51, 0xFF, 0x2B, 0xC4, 0xFF, 0xA4, 0x51, 0xFF, 0x83, 0x49, 0xFF, 0xC4, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0xC4, 0x49, 0xFF, 0x64, 0x59, 0xFF, 0xA4, 0x49, 0xFF, 0x84, 0x51, 0xFF, 0xA4, 0x49, 0xFF, 0xA5, 0x51, 0xFF, 0x84, 0x51, 0xFF, 0x65, 0x49, 0xFF, 0x84, 0x59, 0xFF, 0x42, 0x41, 0xFF, 0x44, 0x41, 0xFF, 0x43, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0x43, 0x49, 0xFF, 0x02, 0x49, 0xFF, 0x06, 0x6A, 0xFF, 0x23, 0x49, 0xFF, 0x02, 0x41, 0xFF, 0x22, 0x41, 0xFF, 0x02, 0x49, 0xFF, 0xE2, 0x38, 0xFF, 0x03, 0x49, 0xFF, 0x22, 0x49, 0xFF, 0xC1, 0x38, 0xFF,
-    0x60, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0x88, 0xB2, 0xFF, 0x60, 0x38, 0xFF, 0xC1, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0x02, 0x39, 0xFF, 0x84, 0x69, 0xFF, 0x22, 0x39, 0xFF, 0x84, 0x41, 0xFF, 0x84, 0x41, 0xFF, 0x83, 0x49, 0xFF, 0x83, 0x51, 0xFF, 0xC6, 0x61, 0xFF, 0xA3, 0x60, 0xFF, 0x76, 0xF6, 0xFF, 0x69, 0xE2, 0xFF, 0xC3, 0x60, 0xFF, 0xC2, 0x58, 0xFF, 0x83, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0xA0, 0xFF, 0xC3, 0x60, 0xFF, 0xC3, 0x68, 0xFF, 0xA2, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x68, 0xFF, 0x0A, 0xA3, 0xFF, 0x03, 0x69, 0xFF, 0x25, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x71, 0xFF, 0x03, 0x59, 0xFF, 0x43, 0x69, 0xFF, 0x44, 0xA9, 0xFF, 0xDD, 0xFF, 0xFF, 0x04, 0x69, 0xFF, 0x45, 0x61, 0xFF, 0x43, 0x59, 0xFF, 0xF9, 0xFE, 0xFF, 0xA4, 0x81, 0xFF, 0x63, 0x51, 0xFF, 0x04, 0x81, 0xFF, 0x44, 0x79, 0xFF, 0x69, 0xBB, 0xFF, 0xA4, 0x51, 0xFF, 0x84, 0x61, 0xFF, 0xA4, 0x49, 0xFF, 0x63, 0x49, 0xFF, 0xAA, 0xAB, 0xFF, 0x84, 0x59, 0xFF, 0xA4, 0x51, 0xFF, 0xA4, 0x49, 0xFF, 0xC4, 0x51, 0xFF, 0x89, 0xAB, 0xFF, 0xA4, 0x59, 0xFF, 0x84, 0x49, 0xFF, 0xA4, 0x59, 0xFF, 0x44, 0x69, 0xFF, 0xA3, 0x59, 0xFF, 0xA4, 0x51, 0xFF, 0x86, 0x51, 0xFF,
-    0x85, 0x51, 0xFF, 0x83, 0x49, 0xFF, 0x44, 0x49, 0xFF, 0x84, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0x23, 0x49, 0xFF, 0x28, 0x9B, 0xFF, 0x43, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xC8, 0x9A, 0xFF, 0x02, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x22, 0x49, 0xFF, 0xE2, 0x38, 0xFF, 0x02, 0x41, 0xFF, 0x02, 0x39, 0xFF, 0xE2, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xC3, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0x22, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0x22, 0x39, 0xFF, 0x83, 0x41, 0xFF, 0x83, 0x49, 0xFF, 0xA5, 0x59, 0xFF, 0xE4, 0x78, 0xFF, 0x45, 0xB1, 0xFF, 0xC3, 0x68, 0xFF, 0x25, 0x71, 0xFF, 0xE5, 0x80, 0xFF, 0xC4, 0x98, 0xFF, 0x62, 0x98, 0xFF, 0xC3, 0x78, 0xFF, 0xE3, 0x68, 0xFF, 0xC2, 0x78, 0xFF, 0xD0, 0xFC, 0xFF, 0xE7, 0xC9, 0xFF, 0x02, 0x61, 0xFF, 0x03, 0x61, 0xFF, 0xE3, 0x70, 0xFF, 0x6A, 0xDB, 0xFF, 0xA6, 0xB9, 0xFF, 0x03, 0x61, 0xFF, 0x23, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0xE6, 0xA9, 0xFF, 0x24, 0x71, 0xFF, 0x04, 0x59, 0xFF, 0x63, 0x61, 0xFF, 0x44, 0x59, 0xFF, 0xA7, 0x9A, 0xFF, 0x44, 0x59, 0xFF, 0x63, 0x51, 0xFF, 0x44, 0x59, 0xFF, 0x64, 0x59, 0xFF, 0x41, 0x51, 0xFF, 0x84, 0x51, 0xFF,
-    0xA4, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x51, 0xFF, 0x26, 0x7A, 0xFF, 0x05, 0x7A, 0xFF, 0xC5, 0x51, 0xFF, 0xE5, 0x51, 0xFF, 0x25, 0x6A, 0xFF, 0xE7, 0x92, 0xFF, 0xA4, 0x61, 0xFF, 0xC4, 0x51, 0xFF, 0x87, 0x82, 0xFF, 0x87, 0xBA, 0xFF, 0xC4, 0x59, 0xFF, 0xE5, 0x61, 0xFF, 0xE6, 0x69, 0xFF, 0xA1, 0x60, 0xFF, 0xA4, 0x59, 0xFF, 0x84, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x41, 0x98, 0xFF, 0xE3, 0x60, 0xFF, 0x02, 0x51, 0xFF, 0x02, 0x49, 0xFF, 0xA1, 0x60, 0xFF, 0x02, 0x49, 0xFF, 0x02, 0x41, 0xFF, 0x02, 0x41, 0xFF, 0x04, 0x79, 0xFF, 0xE2, 0x48, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0xA1, 0x40, 0xFF, 0x23, 0x59, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0xE3, 0x58, 0xFF, 0x47, 0x7A, 0xFF, 0xE2, 0x40, 0xFF, 0xE2, 0x38, 0xFF, 0x02, 0x39, 0xFF, 0xC1, 0x30, 0xFF, 0xA9, 0x7A, 0xFF, 0x64, 0x51, 0xFF, 0x22, 0x39, 0xFF, 0x43, 0x41, 0xFF, 0x43, 0x41, 0xFF, 0x84, 0x49, 0xFF, 0x65, 0xB9, 0xFF, 0x04, 0x71, 0xFF, 0xC2, 0x50, 0xFF, 0x09, 0xA2, 0xFF, 0xDD, 0xFF, 0xFF, 0x09, 0xFA, 0xFF, 0xC3, 0x68, 0xFF, 0xA1, 0x58, 0xFF, 0xC3, 0x78, 0xFF, 0x9C, 0xFF, 0xFF, 0x69, 0xFA, 0xFF, 0xC3, 0x78, 0xFF, 0xE2, 0x58, 0xFF, 0x02, 0x61, 0xFF, 0x44, 0xD1, 0xFF, 0xC6, 0xE1, 0xFF,
-    0x44, 0x71, 0xFF, 0x23, 0x59, 0xFF, 0x23, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0xA9, 0xCA, 0xFF, 0x24, 0x51, 0xFF, 0x44, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0x63, 0x51, 0xFF, 0x08, 0xB3, 0xFF, 0x04, 0x61, 0xFF, 0x63, 0x59, 0xFF, 0x63, 0x51, 0xFF, 0x83, 0x51, 0xFF, 0x49, 0xAB, 0xFF, 0x85, 0x61, 0xFF, 0xC4, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0xC5, 0x59, 0xFF, 0x48, 0xA3, 0xFF, 0x47, 0x92, 0xFF, 0xE5, 0x59, 0xFF, 0x25, 0x5A, 0xFF, 0xE7, 0x92, 0xFF, 0x08, 0x93, 0xFF, 0xA4, 0x61, 0xFF, 0x25, 0x5A, 0xFF, 0x25, 0x72, 0xFF, 0x6A, 0xEB, 0xFF, 0x08, 0x9B, 0xFF, 0x43, 0x59, 0xFF, 0x25, 0x82, 0xFF, 0x60, 0x70, 0xFF, 0xA4, 0x69, 0xFF, 0x08, 0x93, 0xFF, 0x24, 0x89, 0xFF, 0x61, 0x88, 0xFF, 0xE4, 0x80, 0xFF, 0x23, 0x51, 0xFF, 0xA8, 0x8A, 0xFF, 0x40, 0x70, 0xFF, 0x44, 0x69, 0xFF, 0x02, 0x49, 0xFF, 0x44, 0x59, 0xFF, 0x47, 0x8A, 0xFF, 0x03, 0x51, 0xFF, 0xE2, 0x48, 0xFF, 0xE2, 0x40, 0xFF, 0xE2, 0x60, 0xFF, 0x48, 0x92, 0xFF, 0xE2, 0x48, 0xFF, 0xE2, 0x40, 0xFF, 0xE5, 0x68, 0xFF, 0xC4, 0x50, 0xFF, 0x27, 0x8A, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0xE2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0x68, 0x82, 0xFF, 0x22, 0x39, 0xFF, 0x43, 0x41, 0xFF, 0x84, 0x41, 0xFF, 0x83, 0x49, 0xFF,
+    0xC1, 0x18, 0xE4, 0x41, 0xC2, 0x18, 0xE2, 0x20, 0xE2, 0x20, 0xE2, 0x20, 0x02, 0x21, 0xE5, 0x41, 0x02, 0x21, 0x23, 0x29, 0x23, 0x29, 0x43, 0x29, 0x66, 0x52, 0x22, 0x29, 0x22, 0x21, 0x43, 0x29, 0x22, 0x21, 0x22, 0x29, 0x45, 0x4A, 0x22, 0x29, 0xE2, 0x38, 0x23, 0x39, 0x23, 0x31, 0x86, 0x52, 0x23, 0x41, 0xC2, 0x48, 0x63, 0x31, 0x23, 0x41, 0x63, 0x29, 0x46, 0x52, 0x63, 0x29, 0xA4, 0x31,
+    0x83, 0x29, 0xA4, 0x31, 0xC7, 0x5A, 0x83, 0x31, 0xA4, 0x31, 0x64, 0x39, 0x43, 0x39, 0xE8, 0x5A, 0x63, 0x41, 0x24, 0x49, 0x03, 0x49, 0x44, 0x41, 0xA3, 0x31, 0x08, 0x73, 0x23, 0x49, 0x03, 0x51, 0x03, 0x41, 0xE3, 0x50, 0xA7, 0x62, 0x43, 0x39, 0x43, 0x31, 0x42, 0x31, 0x43, 0x31, 0x23, 0x41, 0x23, 0x49, 0x22, 0x31, 0x43, 0x31, 0x22, 0x31, 0x43, 0x31, 0xE6, 0x79, 0x43, 0x31, 0x02, 0x29,
+    0x42, 0x31, 0x02, 0x29, 0x63, 0x39, 0x83, 0x39, 0x43, 0x31, 0x42, 0x31, 0x63, 0x31, 0x83, 0x31, 0x25, 0x62, 0x83, 0x39, 0xA4, 0x39, 0x83, 0x39, 0x63, 0x31, 0x25, 0x62, 0x83, 0x39, 0x63, 0x31, 0xC1, 0x18, 0xC2, 0x20, 0xC5, 0x39, 0xE1, 0x20, 0xE2, 0x20, 0x02, 0x21, 0xC1, 0x18, 0x25, 0x42, 0x63, 0x31, 0xE1, 0x20, 0x22, 0x21, 0xE1, 0x20, 0x42, 0x29, 0xE8, 0x5A, 0x42, 0x29, 0x02, 0x21,
+    0x22, 0x21, 0x02, 0x29, 0xE7, 0x52, 0x47, 0x52, 0x63, 0x29, 0x02, 0x31, 0x02, 0x31, 0x42, 0x29, 0x42, 0x29, 0xA3, 0x39, 0x63, 0x31, 0x83, 0x31, 0xA4, 0x31, 0xC7, 0x5A, 0xE5, 0x41, 0x83, 0x29, 0xC4, 0x31, 0xA3, 0x31, 0x28, 0x63, 0xE6, 0x5A, 0x63, 0x29, 0xA3, 0x31, 0x63, 0x31, 0x86, 0x5A, 0x83, 0x31, 0x09, 0x6B, 0x49, 0x6B, 0x66, 0x5A, 0xA3, 0x31, 0xA6, 0x5A, 0x23, 0x41, 0x6B, 0x93,
+    0xA8, 0x8A, 0x62, 0x31, 0x6C, 0x8C, 0x03, 0x51, 0xE6, 0x81, 0x28, 0xA2, 0x04, 0x69, 0x45, 0x5A, 0x83, 0x59, 0x63, 0x31, 0x22, 0x31, 0x43, 0x31, 0x03, 0x49, 0x05, 0x5A, 0x43, 0x39, 0xE2, 0x30, 0x43, 0x39, 0x22, 0x31, 0x05, 0x62, 0x87, 0x6A, 0x22, 0x31, 0x63, 0x31, 0x42, 0x31, 0x03, 0x49, 0xA5, 0x59, 0x83, 0x39, 0x63, 0x39, 0x42, 0x39, 0x43, 0x41, 0xA5, 0x61, 0x83, 0x39, 0x83, 0x39,
+    0xC1, 0x18, 0x02, 0x21, 0xE2, 0x20, 0x80, 0x10, 0xC1, 0x18, 0xC1, 0x18, 0xE2, 0x20, 0x23, 0x29, 0xE2, 0x20, 0x02, 0x21, 0x22, 0x21, 0x02, 0x21, 0x02, 0x21, 0x22, 0x29, 0x43, 0x29, 0x22, 0x29, 0x22, 0x29, 0x63, 0x31, 0x43, 0x29, 0x83, 0x31, 0xE2, 0x38, 0xE2, 0x40, 0x44, 0x41, 0x63, 0x31, 0x62, 0x29, 0xA4, 0x31, 0x63, 0x31, 0x42, 0x29, 0x63, 0x31, 0xE4, 0x39, 0x63, 0x31, 0x84, 0x31,
+    0xA4, 0x31, 0xC4, 0x39, 0xA4, 0x31, 0xA3, 0x31, 0x83, 0x29, 0x83, 0x31, 0xC7, 0x62, 0xA4, 0x39, 0x63, 0x31, 0x83, 0x31, 0x83, 0x31, 0x83, 0x31, 0x83, 0x31, 0x83, 0x31, 0x63, 0x39, 0x03, 0x49, 0xE3, 0x50, 0x63, 0x31, 0x83, 0x39, 0xE3, 0x58, 0x43, 0x39, 0x23, 0x41, 0xE3, 0x58, 0x03, 0x49, 0xC3, 0x50, 0x22, 0x31, 0x43, 0x31, 0x03, 0x41, 0x42, 0x31, 0x43, 0x31, 0x22, 0x31, 0x63, 0x39,
+    0x22, 0x31, 0x87, 0x62, 0x43, 0x31, 0x43, 0x31, 0x42, 0x31, 0x63, 0x31, 0x05, 0x52, 0x63, 0x31, 0x83, 0x31, 0x63, 0x31, 0x63, 0x31, 0xA4, 0x41, 0x22, 0x31, 0x63, 0x39, 0x83, 0x39, 0x83, 0x39, 0xA1, 0x18, 0xE2, 0x20, 0xE2, 0x20, 0xE2, 0x20, 0x05, 0x3A, 0xE2, 0x20, 0xE2, 0x20, 0x23, 0x29, 0xE2, 0x20, 0x45, 0x4A, 0xC5, 0x39, 0x23, 0x29, 0x02, 0x21, 0x02, 0x21, 0xE4, 0x39, 0x22, 0x21,
+    0x22, 0x29, 0x43, 0x29, 0x02, 0x21, 0x69, 0x5B, 0x29, 0x63, 0x22, 0x29, 0x43, 0x39, 0x02, 0x29, 0x46, 0x4A, 0x67, 0x52, 0x83, 0x31, 0x83, 0x41, 0x22, 0x29, 0x45, 0x4A, 0x8B, 0x6B, 0x63, 0x39, 0xC3, 0x39, 0x42, 0x31, 0x05, 0x42, 0xEA, 0x6B, 0xA4, 0x31, 0x84, 0x31, 0x26, 0x52, 0x46, 0x52, 0xA9, 0x63, 0xA4, 0x39, 0xC4, 0x41, 0xC4, 0x41, 0x25, 0x4A, 0x86, 0x52, 0x83, 0x39, 0xC4, 0x41,
+    0xA4, 0x41, 0x05, 0x4A, 0x86, 0x5A, 0xC5, 0x61, 0x25, 0x79, 0x23, 0x51, 0x83, 0x39, 0xA4, 0x41, 0xC2, 0x50, 0x22, 0x31, 0x23, 0x39, 0x23, 0x49, 0x84, 0x61, 0x23, 0x39, 0xE2, 0x38, 0x02, 0x39, 0x23, 0x41, 0x05, 0x5A, 0x84, 0x41, 0x22, 0x39, 0x42, 0x39, 0x43, 0x39, 0xE6, 0x59, 0x21, 0x31, 0x83, 0x41, 0x63, 0x39, 0x43, 0x31, 0xE5, 0x61, 0x63, 0x39, 0x63, 0x39, 0x63, 0x39, 0x83, 0x39,
+    0xC1, 0x18, 0xC1, 0x18, 0xE2, 0x20, 0xE2, 0x20, 0x02, 0x21, 0x22, 0x21, 0x02, 0x21, 0xE2, 0x20, 0x02, 0x21, 0x02, 0x21, 0x43, 0x29, 0xE2, 0x20, 0x02, 0x21, 0x02, 0x21, 0x22, 0x29, 0x23, 0x29, 0x63, 0x29, 0x43, 0x29, 0x22, 0x29, 0x43, 0x31, 0x63, 0x31, 0x63, 0x31, 0x63, 0x31, 0x42, 0x29, 0x63, 0x31, 0xA3, 0x31, 0x63, 0x31, 0x63, 0x31, 0x63, 0x31, 0x83, 0x31, 0x83, 0x31, 0xA4, 0x39,
+    0xA4, 0x31, 0x83, 0x39, 0xC4, 0x39, 0x84, 0x31, 0xC4, 0x31, 0x83, 0x31, 0x63, 0x39, 0xA4, 0x31, 0x63, 0x39, 0x83, 0x39, 0x63, 0x31, 0xA4, 0x39, 0x83, 0x39, 0x83, 0x39, 0x83, 0x39, 0x83, 0x39, 0x63, 0x39, 0x63, 0x39, 0x63, 0x39, 0x43, 0x39, 0x03, 0x51, 0x63, 0x39, 0x43, 0x31, 0x42, 0x31, 0xE3, 0x60, 0x64, 0x61, 0x03, 0x59, 0x02, 0x49, 0x22, 0x31, 0x22, 0x31, 0x23, 0x39, 0x22, 0x31,
+    0x22, 0x31, 0x43, 0x39, 0x02, 0x31, 0x42, 0x31, 0x42, 0x31, 0x63, 0x39, 0x43, 0x39, 0x63, 0x39, 0x63, 0x39, 0x83, 0x39, 0x42, 0x31, 0x43, 0x39, 0x63, 0x31, 0x83, 0x39, 0xA4, 0x41, 0x83, 0x39, 0x42, 0x29, 0xE5, 0x39, 0xE2, 0x20, 0xE2, 0x20, 0xE2, 0x20, 0xE1, 0x20, 0xA3, 0x31, 0xC1, 0x18, 0xE2, 0x20, 0x23, 0x29, 0xA4, 0x39, 0x63, 0x31, 0x02, 0x29, 0x22, 0x29, 0x22, 0x29, 0xE5, 0x39,
+    0x43, 0x29, 0x22, 0x29, 0x22, 0x29, 0x83, 0x31, 0x46, 0x42, 0x42, 0x31, 0x42, 0x31, 0x63, 0x39, 0xC4, 0x39, 0x86, 0x52, 0x43, 0x31, 0xC4, 0x41, 0xA4, 0x39, 0x87, 0x52, 0xE5, 0x41, 0xE4, 0x41, 0x04, 0x42, 0x22, 0x31, 0x25, 0x4A, 0xC4, 0x39, 0xA4, 0x39, 0xA4, 0x39, 0x83, 0x39, 0x86, 0x52, 0x63, 0x31, 0x63, 0x39, 0x63, 0x39, 0x42, 0x31, 0xA7, 0x5A, 0xC4, 0x39, 0x84, 0x41, 0xC4, 0x41,
+    0x83, 0x39, 0xC7, 0x5A, 0x42, 0x31, 0x83, 0x41, 0x84, 0x51, 0x83, 0x39, 0x05, 0x4A, 0x42, 0x39, 0xE3, 0x50, 0xE3, 0x50, 0x23, 0x41, 0xA4, 0x59, 0x43, 0x39, 0x22, 0x39, 0x23, 0x39, 0x84, 0x61, 0x22, 0x31, 0x23, 0x39, 0x22, 0x39, 0x43, 0x39, 0x26, 0x62, 0x63, 0x39, 0x43, 0x39, 0x42, 0x39, 0x63, 0x39, 0xE4, 0x49, 0x43, 0x31, 0x63, 0x39, 0x84, 0x39, 0x63, 0x39, 0xA4, 0x41, 0xC4, 0x41,
+    0x02, 0x21, 0xE1, 0x28, 0x05, 0x42, 0xE2, 0x20, 0xE1, 0x20, 0x02, 0x21, 0xE2, 0x20, 0x45, 0x4A, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x22, 0x29, 0xC8, 0x5A, 0xA3, 0x31, 0x22, 0x29, 0x43, 0x29, 0x22, 0x29, 0x22, 0x29, 0x86, 0x52, 0x42, 0x31, 0x42, 0x29, 0x83, 0x31, 0x63, 0x31, 0x46, 0x52, 0x83, 0x31, 0x63, 0x31, 0x83, 0x31, 0x83, 0x31, 0x83, 0x39, 0xC6, 0x62, 0xA4, 0x39, 0x83, 0x39,
+    0xA3, 0x31, 0x83, 0x39, 0x07, 0x6B, 0xC4, 0x39, 0xA4, 0x39, 0xA3, 0x39, 0x83, 0x39, 0xC7, 0x62, 0x63, 0x39, 0x83, 0x39, 0x83, 0x39, 0x83, 0x39, 0x84, 0x39, 0x07, 0x73, 0x83, 0x39, 0x63, 0x39, 0x83, 0x39, 0x63, 0x39, 0xE7, 0x72, 0x43, 0x39, 0x63, 0x39, 0x63, 0x39, 0x63, 0x39, 0x87, 0x72, 0x23, 0x41, 0xE2, 0x50, 0xE3, 0x50, 0x02, 0x41, 0x23, 0x39, 0x87, 0x7A, 0x22, 0x39, 0x22, 0x31,
+    0x22, 0x31, 0x43, 0x39, 0xA7, 0x72, 0x63, 0x39, 0x63, 0x31, 0x43, 0x39, 0x83, 0x41, 0x46, 0x6A, 0xC2, 0x50, 0x63, 0x39, 0x63, 0x39, 0x63, 0x39, 0x23, 0x51, 0xA5, 0x79, 0xA4, 0x41, 0xA4, 0x41, 0x02, 0x29, 0xE1, 0x20, 0xC1, 0x20, 0xC4, 0x39, 0x02, 0x21, 0x02, 0x21, 0x43, 0x29, 0x22, 0x29, 0x22, 0x29, 0x63, 0x31, 0x84, 0x31, 0xC1, 0x20, 0x66, 0x4A, 0x01, 0x21, 0x63, 0x31, 0x63, 0x31,
+    0x02, 0x29, 0xA4, 0x39, 0x63, 0x31, 0x63, 0x31, 0x43, 0x31, 0x86, 0x4A, 0x02, 0x29, 0x83, 0x39, 0x63, 0x31, 0xC4, 0x39, 0xC4, 0x39, 0xC4, 0x41, 0xC4, 0x41, 0xCB, 0x83, 0xC6, 0x52, 0x83, 0x39, 0x0F, 0x95, 0x8F, 0x94, 0x45, 0x42, 0xA3, 0x39, 0xA4, 0x39, 0xA4, 0x39, 0x63, 0x31, 0x45, 0x4A, 0x0B, 0x7C, 0xA3, 0x39, 0xE5, 0x49, 0xA4, 0x41, 0xA6, 0x52, 0x83, 0x41, 0xE4, 0x49, 0xA4, 0x41,
+    0xC4, 0x41, 0x87, 0x62, 0xC4, 0x51, 0xE5, 0x51, 0x63, 0x41, 0x08, 0x6B, 0x63, 0x41, 0xE9, 0x82, 0x63, 0x39, 0x23, 0x49, 0xA4, 0x49, 0xE3, 0x60, 0x63, 0x49, 0xC2, 0x48, 0x02, 0x49, 0x84, 0x41, 0x43, 0x39, 0x03, 0x51, 0x03, 0x41, 0xA4, 0x49, 0x43, 0x41, 0x63, 0x41, 0x63, 0x41, 0x05, 0x52, 0x83, 0x41, 0x63, 0x39, 0x63, 0x39, 0x83, 0x41, 0x22, 0x41, 0xA4, 0x49, 0xA4, 0x41, 0xA3, 0x41,
+    0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0xC1, 0x20, 0x25, 0x42, 0x23, 0x29, 0x02, 0x29, 0x02, 0x21, 0xE2, 0x20, 0x25, 0x42, 0x02, 0x29, 0x02, 0x29, 0x43, 0x31, 0xA4, 0x39, 0x46, 0x4A, 0x22, 0x29, 0x43, 0x31, 0x42, 0x29, 0x42, 0x31, 0xC6, 0x52, 0x43, 0x31, 0x42, 0x29, 0x43, 0x31, 0x43, 0x31, 0xE8, 0x5A, 0x63, 0x39, 0x08, 0x5B, 0x63, 0x31, 0x63, 0x31, 0x08, 0x6B, 0xA4, 0x39, 0x84, 0x39,
+    0xA4, 0x39, 0xA4, 0x41, 0x45, 0x52, 0x08, 0x63, 0xA4, 0x39, 0xA4, 0x39, 0x83, 0x39, 0x05, 0x4A, 0x83, 0x41, 0xC4, 0x39, 0xA4, 0x39, 0xA4, 0x41, 0x46, 0x52, 0xA4, 0x41, 0xA4, 0x41, 0x83, 0x39, 0xC7, 0x5A, 0xE5, 0x49, 0x84, 0x41, 0x63, 0x41, 0x63, 0x39, 0x63, 0x41, 0xE4, 0x51, 0x83, 0x41, 0x63, 0x41, 0x87, 0x5A, 0xC3, 0x58, 0x43, 0x41, 0x86, 0x6A, 0x43, 0x39, 0x22, 0x39, 0x43, 0x39,
+    0x02, 0x41, 0x26, 0x72, 0x63, 0x39, 0x43, 0x39, 0x63, 0x41, 0x23, 0x49, 0xE5, 0x69, 0x63, 0x39, 0x83, 0x41, 0x83, 0x39, 0x03, 0x51, 0xA5, 0x71, 0x83, 0x41, 0xA4, 0x41, 0xC4, 0x49, 0xA3, 0x41, 0x43, 0x31, 0xC1, 0x18, 0x43, 0x29, 0x02, 0x21, 0xE2, 0x20, 0xE2, 0x20, 0x02, 0x29, 0x02, 0x21, 0xE2, 0x20, 0x05, 0x42, 0x02, 0x29, 0x22, 0x29, 0x43, 0x31, 0x84, 0x31, 0xC5, 0x41, 0x43, 0x29,
+    0x02, 0x29, 0x42, 0x29, 0xC4, 0x39, 0x43, 0x31, 0x43, 0x31, 0xC4, 0x41, 0xA7, 0x52, 0x43, 0x31, 0x63, 0x39, 0x83, 0x39, 0x63, 0x31, 0x84, 0x31, 0x63, 0x31, 0x63, 0x39, 0x84, 0x39, 0x84, 0x39, 0xC4, 0x41, 0xA4, 0x39, 0x84, 0x39, 0x05, 0x42, 0xA4, 0x39, 0xA4, 0x39, 0xA4, 0x41, 0xC4, 0x41, 0x83, 0x39, 0xC4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xA4, 0x49, 0xA4, 0x41, 0xA4, 0x41,
+    0x83, 0x41, 0xC4, 0x49, 0x63, 0x41, 0x84, 0x41, 0x63, 0x39, 0x63, 0x41, 0xA3, 0x49, 0x63, 0x41, 0x63, 0x41, 0x63, 0x41, 0x43, 0x41, 0x43, 0x41, 0x23, 0x49, 0xC4, 0x49, 0x22, 0x41, 0x02, 0x39, 0xE3, 0x50, 0x43, 0x41, 0x43, 0x41, 0x43, 0x41, 0x43, 0x41, 0x42, 0x39, 0xA4, 0x49, 0x43, 0x41, 0x63, 0x41, 0x83, 0x41, 0x83, 0x41, 0x83, 0x41, 0xA4, 0x41, 0xA4, 0x41, 0xA3, 0x41, 0xC3, 0x41,
+    0xC1, 0x20, 0xC4, 0x39, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0xE1, 0x20, 0x25, 0x42, 0x02, 0x21, 0x02, 0x29, 0x02, 0x29, 0xC4, 0x39, 0x45, 0x42, 0x22, 0x29, 0x63, 0x31, 0x05, 0x42, 0x63, 0x31, 0xC4, 0x39, 0x42, 0x31, 0x84, 0x39, 0x42, 0x31, 0xA6, 0x52, 0x63, 0x31, 0x43, 0x31, 0x83, 0x31, 0xE8, 0x62, 0xE7, 0x5A, 0x43, 0x31, 0x66, 0x4A, 0x83, 0x39, 0xE7, 0x4A, 0xA6, 0x5A, 0x66, 0x52,
+    0xA3, 0x39, 0xA4, 0x41, 0xA7, 0x62, 0xA7, 0x5A, 0x05, 0x4A, 0xA4, 0x41, 0xA4, 0x41, 0xE8, 0x6A, 0x08, 0x6B, 0xA4, 0x41, 0x67, 0x5A, 0xC4, 0x51, 0x08, 0x6B, 0x0A, 0x83, 0x84, 0x49, 0x84, 0x41, 0xE4, 0x51, 0x48, 0x73, 0xC5, 0x61, 0xA4, 0x49, 0x25, 0x52, 0x05, 0x5A, 0x66, 0x6A, 0xA4, 0x59, 0x66, 0x6A, 0x43, 0x41, 0x25, 0x62, 0x22, 0x41, 0x05, 0x5A, 0x43, 0x49, 0x02, 0x51, 0x45, 0x62,
+    0xE5, 0x51, 0x43, 0x41, 0x44, 0x51, 0x43, 0x59, 0x46, 0x72, 0x43, 0x41, 0x43, 0x41, 0x63, 0x39, 0x83, 0x49, 0xE5, 0x61, 0x83, 0x41, 0x63, 0x41, 0xA4, 0x41, 0xC4, 0x49, 0xE4, 0x49, 0xE4, 0x51, 0xE1, 0x20, 0x02, 0x21, 0x03, 0x29, 0x22, 0x29, 0x23, 0x29, 0x22, 0x29, 0x02, 0x29, 0xC8, 0x5A, 0x64, 0x31, 0x22, 0x29, 0x02, 0x29, 0x23, 0x31, 0x25, 0x4A, 0x43, 0x29, 0x43, 0x31, 0x22, 0x29,
+    0x43, 0x31, 0x43, 0x31, 0x05, 0x4A, 0x63, 0x31, 0xA4, 0x39, 0x83, 0x39, 0x42, 0x31, 0x87, 0x62, 0x63, 0x39, 0xC4, 0x39, 0x83, 0x39, 0xE8, 0x5A, 0x83, 0x39, 0x08, 0x73, 0x68, 0x63, 0x86, 0x52, 0xA4, 0x39, 0xC5, 0x41, 0xFE, 0xFF, 0x07, 0x5B, 0xA4, 0x41, 0xE9, 0x5A, 0xC4, 0x49, 0xC5, 0x99, 0x85, 0x59, 0xA5, 0x49, 0xA5, 0x41, 0xC6, 0x49, 0x69, 0x93, 0x9C, 0xFF, 0x85, 0x59, 0xA5, 0x49,
+    0xA4, 0x49, 0xA4, 0x59, 0xFC, 0xFF, 0xA5, 0x61, 0x84, 0x49, 0x49, 0x7B, 0xA4, 0x59, 0xAE, 0xFC, 0xE4, 0xD8, 0x43, 0x51, 0xA6, 0x62, 0x63, 0x49, 0x43, 0x61, 0xFA, 0xFF, 0x42, 0x51, 0x43, 0x49, 0x23, 0x41, 0x23, 0x51, 0xFF, 0xFF, 0xA8, 0xA2, 0x42, 0x41, 0x63, 0x49, 0x63, 0x41, 0xC5, 0x59, 0xA4, 0x81, 0x83, 0x41, 0x84, 0x41, 0x43, 0x41, 0xA3, 0x39, 0x66, 0x8A, 0xC4, 0x49, 0xC4, 0x49,
+    0xE1, 0x20, 0xC2, 0x28, 0x86, 0x52, 0x43, 0x31, 0x02, 0x21, 0x22, 0x29, 0x22, 0x29, 0x83, 0x39, 0xE4, 0x41, 0xA5, 0x41, 0x22, 0x29, 0x02, 0x29, 0xC1, 0x20, 0x2B, 0x6C, 0x22, 0x29, 0x43, 0x31, 0x22, 0x29, 0x25, 0x4A, 0xA7, 0x5A, 0x84, 0x39, 0xC4, 0x41, 0x8A, 0x6B, 0x63, 0x31, 0x63, 0x39, 0x04, 0x4A, 0xE5, 0x49, 0x83, 0x39, 0x83, 0x39, 0x83, 0x41, 0xC8, 0x73, 0x29, 0x6B, 0xA4, 0x41,
+    0x84, 0x41, 0xE4, 0x51, 0x2A, 0x9C, 0xA4, 0x41, 0xA5, 0x41, 0xA5, 0x41, 0xC5, 0x51, 0xCA, 0xEB, 0xE5, 0x71, 0xC5, 0x49, 0xA6, 0x49, 0xC5, 0x51, 0x45, 0x6A, 0x6A, 0xC3, 0x26, 0x7A, 0x85, 0x49, 0xC5, 0x49, 0x43, 0x71, 0x97, 0xFF, 0x26, 0x82, 0xA4, 0x49, 0xE4, 0x51, 0x07, 0x8A, 0x0A, 0xE4, 0xEA, 0xBA, 0x63, 0x51, 0x43, 0x49, 0x83, 0x49, 0x43, 0x69, 0xC8, 0xC2, 0xE6, 0x69, 0x22, 0x49,
+    0x22, 0x41, 0x43, 0x51, 0x87, 0xD2, 0x26, 0x82, 0x43, 0x41, 0x83, 0x49, 0x83, 0x41, 0xA7, 0x92, 0x42, 0x51, 0x63, 0x41, 0x63, 0x41, 0x63, 0x41, 0x63, 0x51, 0x03, 0x61, 0xE4, 0x49, 0xC4, 0x49, 0x22, 0x29, 0x22, 0x29, 0x02, 0x21, 0x64, 0x31, 0x05, 0x42, 0x84, 0x39, 0x22, 0x29, 0xE1, 0x20, 0x43, 0x31, 0x66, 0x52, 0x02, 0x29, 0x23, 0x31, 0xC5, 0x41, 0x05, 0x42, 0xE7, 0x5A, 0x43, 0x31,
+    0x63, 0x31, 0x42, 0x31, 0xA3, 0x31, 0x69, 0x6B, 0x84, 0x39, 0x63, 0x39, 0x28, 0x5B, 0xC4, 0x41, 0xC7, 0x5A, 0xA4, 0x41, 0x66, 0x52, 0xC4, 0x41, 0x05, 0x4A, 0x04, 0x4A, 0xA4, 0x41, 0xC4, 0x49, 0x84, 0x41, 0xA4, 0x41, 0xE4, 0x49, 0xE7, 0x5A, 0xA5, 0x49, 0xA5, 0x41, 0xA5, 0x51, 0x25, 0x5A, 0xC4, 0x49, 0xA5, 0x49, 0x85, 0x49, 0xE5, 0x51, 0xC7, 0x72, 0xC4, 0x51, 0x26, 0x7A, 0x46, 0x62,
+    0xC7, 0x5A, 0xA4, 0x61, 0xA4, 0x89, 0xC4, 0x51, 0xA7, 0x62, 0x84, 0x51, 0xA3, 0x51, 0xE4, 0x69, 0x63, 0x51, 0x66, 0x5A, 0xA4, 0x51, 0x63, 0x51, 0x49, 0x93, 0x46, 0x5A, 0x63, 0x51, 0x43, 0x49, 0x64, 0x51, 0xC7, 0x82, 0xA4, 0x51, 0x43, 0x51, 0x43, 0x49, 0x63, 0x51, 0x87, 0x7A, 0xA4, 0x49, 0x63, 0x41, 0xA4, 0x49, 0xC5, 0x61, 0x43, 0x69, 0xC4, 0x49, 0xC4, 0x49, 0xC4, 0x49, 0x05, 0x52,
+    0x22, 0x29, 0x43, 0x29, 0x22, 0x21, 0x02, 0x21, 0x22, 0x29, 0x64, 0x31, 0xC4, 0x39, 0x22, 0x29, 0x22, 0x29, 0x84, 0x39, 0x26, 0x42, 0x22, 0x29, 0x43, 0x31, 0x84, 0x39, 0x05, 0x42, 0x42, 0x31, 0x22, 0x29, 0xC4, 0x41, 0x42, 0x31, 0x83, 0x39, 0x63, 0x39, 0xC4, 0x39, 0x83, 0x39, 0x83, 0x39, 0x83, 0x41, 0xC4, 0x41, 0xC4, 0x41, 0xC7, 0x5A, 0xE5, 0x49, 0xE4, 0x49, 0x86, 0x52, 0xE4, 0x49,
+    0xE5, 0x41, 0xC5, 0x51, 0x83, 0x41, 0x28, 0x63, 0xA6, 0x49, 0xA5, 0x49, 0xA5, 0x51, 0xE4, 0x49, 0xE5, 0x51, 0xC4, 0x49, 0xA5, 0x49, 0x46, 0x5A, 0x04, 0x4A, 0xE4, 0x51, 0xE5, 0x69, 0xA3, 0x49, 0xA3, 0x41, 0x04, 0x5A, 0x25, 0x5A, 0x05, 0x52, 0x89, 0x62, 0xC4, 0x51, 0x25, 0x62, 0x64, 0x51, 0xA7, 0x62, 0x83, 0x51, 0x63, 0x49, 0x83, 0x51, 0x45, 0x5A, 0x83, 0x51, 0x43, 0x51, 0x63, 0x51,
+    0x46, 0x62, 0x43, 0x49, 0x43, 0x49, 0x84, 0x59, 0xC4, 0x59, 0x63, 0x49, 0x43, 0x51, 0x83, 0x49, 0x62, 0x49, 0xA3, 0x49, 0x24, 0x61, 0xA3, 0x49, 0x83, 0x41, 0xC4, 0x51, 0xE4, 0x51, 0x05, 0x5A, 0x02, 0x21, 0xC5, 0x39, 0x83, 0x31, 0x02, 0x21, 0x02, 0x21, 0x22, 0x29, 0x45, 0x4A, 0xA4, 0x39, 0x02, 0x29, 0x63, 0x31, 0xA2, 0x31, 0xA6, 0x4A, 0x43, 0x31, 0x63, 0x31, 0x63, 0x31, 0xE5, 0x41,
+    0xA7, 0x52, 0x84, 0x39, 0xC4, 0x41, 0x63, 0x31, 0xC7, 0x5A, 0x83, 0x39, 0xC4, 0x41, 0xC3, 0x39, 0xC8, 0x6A, 0xE4, 0x49, 0x45, 0x52, 0xA7, 0x52, 0xC5, 0x49, 0xC5, 0x51, 0x69, 0x73, 0xC4, 0x51, 0xC5, 0x49, 0xC6, 0x51, 0xE4, 0x51, 0x68, 0x73, 0xC5, 0x49, 0xE5, 0x49, 0xC5, 0x51, 0xE4, 0x51, 0xE7, 0x6A, 0xC4, 0x51, 0xE5, 0x59, 0x25, 0x5A, 0xA9, 0x7B, 0xE4, 0x59, 0xE5, 0x61, 0x46, 0x5A,
+    0x63, 0x49, 0x8B, 0x8C, 0xEB, 0x93, 0xC4, 0x51, 0xA6, 0x51, 0x05, 0x5A, 0xA8, 0x7A, 0x85, 0x59, 0x64, 0x59, 0xC4, 0x59, 0x42, 0x49, 0xC4, 0x59, 0x63, 0x51, 0x43, 0x51, 0x84, 0x59, 0xC7, 0x72, 0x05, 0x62, 0x43, 0x51, 0x63, 0x51, 0xA5, 0x69, 0xC7, 0x7A, 0xE5, 0x59, 0x83, 0x49, 0x83, 0x51, 0x63, 0x51, 0x63, 0x59, 0xC4, 0x49, 0xA4, 0x51, 0xE4, 0x51, 0xC4, 0x59, 0x05, 0x5A, 0xE4, 0x51,
+    0x01, 0x21, 0xE1, 0x20, 0x22, 0x29, 0x05, 0x42, 0x43, 0x29, 0x22, 0x29, 0x22, 0x29, 0x43, 0x31, 0x66, 0x4A, 0x22, 0x29, 0x22, 0x29, 0x43, 0x31, 0xA6, 0x4A, 0x63, 0x31, 0x43, 0x31, 0x22, 0x31, 0x42, 0x31, 0xC3, 0x39, 0x63, 0x39, 0xC4, 0x41, 0x63, 0x39, 0x07, 0x63, 0x83, 0x41, 0xA4, 0x41, 0xE4, 0x49, 0xA4, 0x49, 0x25, 0x4A, 0x27, 0x52, 0x26, 0x6A, 0x05, 0x72, 0x68, 0x73, 0x88, 0x62,
+    0xA4, 0x49, 0x05, 0x6A, 0xC7, 0x9A, 0x85, 0x62, 0xE4, 0x51, 0xE4, 0x51, 0xE4, 0x59, 0x05, 0x72, 0x05, 0x6A, 0xC5, 0x59, 0x63, 0x51, 0xE5, 0x59, 0xCA, 0x93, 0x26, 0x92, 0x26, 0x72, 0xC4, 0x51, 0xE4, 0x59, 0x04, 0x5A, 0xC4, 0x69, 0xC4, 0x51, 0xC6, 0x59, 0x29, 0x7B, 0x84, 0x61, 0x06, 0xA2, 0xE6, 0x79, 0x84, 0x59, 0x29, 0x83, 0xA4, 0x59, 0x24, 0x69, 0x64, 0x89, 0xC8, 0x82, 0x62, 0x59,
+    0x43, 0x51, 0x84, 0x61, 0xA4, 0xB9, 0xC4, 0x79, 0x63, 0x59, 0x84, 0x51, 0xA4, 0x59, 0x86, 0x92, 0x64, 0x71, 0x83, 0x59, 0xA4, 0x51, 0xA4, 0x59, 0xE5, 0x79, 0x65, 0xC9, 0xE5, 0x69, 0xE4, 0x51, 0x02, 0x29, 0x02, 0x21, 0x25, 0x4A, 0x02, 0x29, 0x22, 0x29, 0x43, 0x31, 0xE1, 0x20, 0xA7, 0x5A, 0x46, 0x4A, 0xA3, 0x39, 0x22, 0x29, 0x22, 0x29, 0x84, 0x39, 0xE7, 0x5A, 0x43, 0x31, 0x42, 0x31,
+    0x22, 0x31, 0x83, 0x39, 0x69, 0x7B, 0x43, 0x39, 0xC4, 0x49, 0x83, 0x41, 0x28, 0x5B, 0x65, 0x72, 0x48, 0x83, 0xC5, 0x49, 0xAA, 0x73, 0xC6, 0x49, 0x26, 0x92, 0xFF, 0xFF, 0x04, 0x5A, 0x87, 0x62, 0xE4, 0x51, 0x26, 0x82, 0xFF, 0xFF, 0x4B, 0xA4, 0x25, 0x5A, 0xE5, 0x59, 0x05, 0x6A, 0xFF, 0xFF, 0x87, 0xB2, 0xE5, 0x59, 0xA4, 0x59, 0xA7, 0x7A, 0x69, 0xBB, 0xFF, 0xFF, 0x26, 0x7A, 0xC4, 0x51,
+    0xA9, 0x7B, 0x26, 0x82, 0xFF, 0xFF, 0xE4, 0x61, 0x04, 0x52, 0xA4, 0x59, 0xA4, 0x81, 0xFF, 0xFF, 0x65, 0xB1, 0x29, 0x7B, 0x64, 0x59, 0x84, 0x79, 0x26, 0xE2, 0xDF, 0xFF, 0x64, 0x69, 0x83, 0x61, 0x63, 0x59, 0x05, 0xA2, 0xFF, 0xFF, 0x63, 0x81, 0x63, 0x59, 0x84, 0x59, 0xC4, 0x81, 0xFF, 0xFF, 0x44, 0xA1, 0x83, 0x59, 0xA4, 0x51, 0xA4, 0x79, 0xA8, 0xFA, 0xFE, 0xFF, 0xE4, 0x69, 0x25, 0x5A,
+    0xE1, 0x20, 0x02, 0x29, 0x02, 0x29, 0x02, 0x29, 0x66, 0x4A, 0x02, 0x29, 0x23, 0x29, 0x43, 0x29, 0x63, 0x31, 0xE8, 0x62, 0x63, 0x31, 0x22, 0x29, 0x43, 0x31, 0x63, 0x31, 0x68, 0x6B, 0x83, 0x39, 0xA4, 0x41, 0xA4, 0x41, 0x22, 0x29, 0xA4, 0x41, 0x83, 0x41, 0x83, 0x39, 0x84, 0x41, 0xA5, 0x41, 0x05, 0x4A, 0xC5, 0x51, 0xA5, 0x49, 0x25, 0x4A, 0xE4, 0x59, 0x48, 0xB3, 0x25, 0x6A, 0x46, 0x5A,
+    0xC7, 0x62, 0xCB, 0xC3, 0xE8, 0xB2, 0xC9, 0x93, 0x25, 0x62, 0x05, 0x5A, 0x25, 0x72, 0xFE, 0xFF, 0x6A, 0xD3, 0x26, 0x62, 0xC4, 0x51, 0xA7, 0x7A, 0x33, 0xEE, 0x69, 0xCB, 0x87, 0x9A, 0xE5, 0x59, 0x66, 0x6A, 0xD1, 0xFD, 0x96, 0xF6, 0xC4, 0x59, 0x85, 0x62, 0xA4, 0x69, 0x67, 0xE2, 0x8C, 0xF4, 0xE8, 0x8A, 0xA5, 0x59, 0xA5, 0x61, 0xC9, 0xDA, 0xFE, 0xFF, 0xC6, 0x79, 0x03, 0x69, 0x83, 0x61,
+    0x05, 0x92, 0xFD, 0xFF, 0x84, 0x69, 0x84, 0x71, 0x83, 0x59, 0x43, 0x59, 0xF9, 0xFF, 0xA5, 0x69, 0x84, 0x61, 0x63, 0x51, 0x46, 0x62, 0x47, 0xCA, 0xE5, 0x61, 0xE5, 0x61, 0x04, 0x52, 0x05, 0x5A, 0xA1, 0x38, 0x43, 0x29, 0x02, 0x29, 0x02, 0x21, 0x23, 0x29, 0x22, 0x29, 0x02, 0x29, 0x22, 0x29, 0x63, 0x31, 0x63, 0x31, 0xA4, 0x41, 0x43, 0x31, 0x42, 0x31, 0x63, 0x31, 0x83, 0x39, 0x42, 0x31,
+    0xC4, 0x41, 0x84, 0x39, 0x83, 0x39, 0x25, 0x52, 0xA3, 0x41, 0x05, 0x52, 0x83, 0x39, 0x4A, 0x6B, 0x05, 0x52, 0xE4, 0x51, 0xE5, 0x49, 0x86, 0x52, 0x05, 0x52, 0x85, 0x62, 0x25, 0x5A, 0x28, 0x73, 0x04, 0x52, 0x28, 0x9B, 0xE8, 0xA2, 0xA9, 0x9B, 0xA7, 0x6A, 0x25, 0x5A, 0x65, 0x6A, 0x49, 0xAB, 0xC7, 0x92, 0x25, 0x5A, 0xC4, 0x51, 0x65, 0x72, 0xFF, 0xFF, 0x08, 0x9B, 0xA7, 0x82, 0x05, 0x52,
+    0x87, 0x6A, 0xBD, 0xFF, 0x25, 0x6A, 0xC3, 0x51, 0xE4, 0x59, 0xE4, 0x71, 0xDC, 0xFF, 0xC4, 0x71, 0x26, 0x6A, 0x85, 0x59, 0x45, 0x81, 0xE4, 0x99, 0x05, 0x91, 0x05, 0x79, 0x44, 0x59, 0xA4, 0x61, 0xA3, 0x61, 0x84, 0x61, 0x84, 0x59, 0x84, 0x69, 0xE5, 0x61, 0x84, 0x59, 0xC4, 0x51, 0xA4, 0x51, 0xA4, 0x51, 0xE4, 0x59, 0xC4, 0x51, 0xA4, 0x59, 0xE5, 0x59, 0xC4, 0x51, 0x05, 0x5A, 0xE5, 0x69,
+    0xE2, 0x30, 0x02, 0x29, 0xE2, 0x28, 0x22, 0x29, 0x02, 0x29, 0x22, 0x29, 0x84, 0x39, 0x63, 0x39, 0x63, 0x31, 0x43, 0x31, 0xA3, 0x39, 0xC7, 0x52, 0x63, 0x31, 0x63, 0x39, 0x84, 0x39, 0x83, 0x39, 0x28, 0x5B, 0xC4, 0x49, 0x63, 0x39, 0xE4, 0x49, 0x06, 0x5A, 0x87, 0x6A, 0xC5, 0x41, 0x06, 0x52, 0x46, 0x62, 0x89, 0x7B, 0x26, 0x62, 0x06, 0x52, 0x05, 0x52, 0xC4, 0x51, 0x2D, 0x95, 0x04, 0x5A,
+    0x25, 0x52, 0x66, 0x72, 0xA7, 0x7A, 0x44, 0x62, 0x86, 0x62, 0x05, 0x52, 0x45, 0x62, 0xE7, 0x82, 0x66, 0x6A, 0x25, 0x5A, 0xE4, 0x51, 0xE7, 0x82, 0x94, 0xEE, 0x08, 0x8B, 0xA6, 0x8A, 0x69, 0x73, 0x65, 0x6A, 0xF4, 0xFE, 0x03, 0x5A, 0xE4, 0x51, 0x26, 0x5A, 0x45, 0x72, 0xE5, 0x81, 0x04, 0x62, 0xA4, 0x59, 0x84, 0x51, 0x24, 0x71, 0x85, 0x71, 0x85, 0x59, 0x65, 0x51, 0x66, 0x6A, 0x67, 0x82,
+    0x84, 0x59, 0x63, 0x51, 0xC5, 0x51, 0x84, 0x69, 0xE5, 0x69, 0xC5, 0x61, 0xA4, 0x51, 0xC4, 0x51, 0xA4, 0x51, 0x44, 0x71, 0xE4, 0x51, 0xC4, 0x51, 0xE5, 0x59, 0xE5, 0x69, 0xA5, 0x81, 0x64, 0x79, 0x81, 0x38, 0x23, 0x29, 0xC2, 0x40, 0x22, 0x29, 0x43, 0x31, 0x22, 0x29, 0x63, 0x31, 0x84, 0x39, 0x45, 0x42, 0x23, 0x31, 0xE4, 0x41, 0x63, 0x31, 0x62, 0x39, 0x63, 0x39, 0xC4, 0x39, 0x83, 0x39,
+    0x83, 0x41, 0xC7, 0x5A, 0x63, 0x39, 0xE4, 0x49, 0x2A, 0x93, 0x66, 0x62, 0xC6, 0x51, 0xE5, 0x59, 0x26, 0x72, 0x87, 0x62, 0x49, 0x83, 0x05, 0x52, 0x25, 0x52, 0x46, 0x62, 0x4C, 0x84, 0x05, 0x52, 0x69, 0x63, 0x66, 0x62, 0x2F, 0xA5, 0x28, 0x63, 0x66, 0x5A, 0x25, 0x52, 0x45, 0x5A, 0x2B, 0x94, 0x46, 0x62, 0x25, 0x52, 0x04, 0x52, 0xCA, 0x9B, 0xFE, 0xFF, 0x8A, 0x8B, 0xC7, 0x82, 0x25, 0x5A,
+    0x24, 0x5A, 0x45, 0x62, 0xA6, 0x6A, 0xC4, 0x51, 0xC4, 0x51, 0x6C, 0xAC, 0x86, 0x72, 0xC4, 0x59, 0xC4, 0x51, 0xC4, 0x51, 0xA3, 0x61, 0x25, 0x62, 0x84, 0x51, 0x26, 0x62, 0x6A, 0x83, 0xE5, 0x71, 0xA4, 0x59, 0xA4, 0x59, 0xA3, 0x49, 0xA3, 0x59, 0xC4, 0x69, 0xC4, 0x59, 0xC4, 0x51, 0x66, 0x6A, 0x24, 0x79, 0x84, 0x69, 0xE4, 0x59, 0xE5, 0x59, 0x25, 0x6A, 0xE6, 0x69, 0xE5, 0x69, 0xE5, 0x69,
+    0x43, 0x31, 0x02, 0x29, 0x66, 0x52, 0x22, 0x29, 0xA4, 0x41, 0x25, 0x42, 0x22, 0x29, 0x83, 0x39, 0x63, 0x31, 0x66, 0x4A, 0x83, 0x39, 0xC4, 0x39, 0x42, 0x31, 0x83, 0x41, 0x25, 0x42, 0x25, 0x4A, 0xC4, 0x49, 0xA4, 0x41, 0x28, 0xA3, 0xC4, 0x59, 0x0B, 0x83, 0xC5, 0x59, 0x28, 0x6B, 0x49, 0xBB, 0x74, 0xFE, 0x46, 0x72, 0xAB, 0x93, 0xE4, 0x49, 0x05, 0x72, 0xF6, 0xF6, 0x86, 0x6A, 0xCD, 0x94,
+    0xA6, 0x5A, 0x86, 0x62, 0xB2, 0xD5, 0x71, 0xA6, 0x28, 0x6B, 0xA7, 0x62, 0x86, 0x5A, 0x65, 0x5A, 0x25, 0x52, 0x25, 0x52, 0x26, 0x52, 0x28, 0x83, 0xA6, 0x5A, 0x89, 0x8B, 0xA7, 0x82, 0xA7, 0x62, 0x8F, 0xAD, 0x24, 0x52, 0xEA, 0x9B, 0xA3, 0x41, 0xA9, 0x73, 0xE7, 0x7A, 0x45, 0x62, 0x45, 0x72, 0x05, 0x5A, 0xE3, 0x51, 0x84, 0x71, 0xE4, 0x61, 0x24, 0x62, 0xEA, 0xC3, 0x83, 0x51, 0xA6, 0x69,
+    0xC5, 0x59, 0xE8, 0x7A, 0xFE, 0xFF, 0x83, 0x59, 0xA4, 0x61, 0x05, 0x6A, 0xA3, 0x61, 0x56, 0xFF, 0xE4, 0x91, 0xE5, 0x59, 0xE4, 0x59, 0x05, 0x62, 0xC9, 0xFA, 0xFD, 0xFF, 0x05, 0x6A, 0x05, 0x5A, 0xA2, 0x40, 0x02, 0x31, 0x43, 0x29, 0x83, 0x31, 0xE5, 0x41, 0x63, 0x31, 0x22, 0x31, 0x63, 0x31, 0x28, 0x6B, 0x83, 0x39, 0xA3, 0x39, 0x25, 0x4A, 0x83, 0x41, 0xAA, 0x7B, 0xE8, 0x62, 0x65, 0x4A,
+    0xC4, 0x49, 0xA5, 0x41, 0xA3, 0x81, 0xC9, 0x9B, 0xC8, 0x82, 0xC4, 0x51, 0x08, 0x6B, 0xC9, 0x93, 0x10, 0xFE, 0x87, 0x9A, 0xE8, 0x7A, 0x2B, 0x7C, 0x86, 0x6A, 0x96, 0xFF, 0x89, 0xBB, 0xCD, 0x94, 0x24, 0x52, 0xC7, 0x72, 0x27, 0xA3, 0xAB, 0x8C, 0x65, 0x52, 0x45, 0x52, 0x66, 0x5A, 0xE9, 0x8A, 0x04, 0x52, 0x45, 0x52, 0x05, 0x52, 0xE7, 0x7A, 0x46, 0x5A, 0xE9, 0x93, 0xA7, 0x6A, 0x25, 0x52,
+    0x66, 0x5A, 0x86, 0x6A, 0x32, 0xE6, 0x86, 0x5A, 0x46, 0x5A, 0x87, 0x72, 0x45, 0x82, 0x2B, 0xB4, 0xE4, 0x51, 0x63, 0x59, 0xE5, 0x71, 0x49, 0xC3, 0xDC, 0xFF, 0xA3, 0x59, 0xA4, 0x51, 0x05, 0x82, 0x45, 0xBA, 0x96, 0xF6, 0xC4, 0x69, 0xA4, 0x71, 0xE5, 0x71, 0x05, 0xC2, 0xFF, 0xFF, 0xA4, 0x79, 0xC4, 0x71, 0xE4, 0x61, 0x06, 0xC2, 0xB8, 0xFF, 0x46, 0x8A, 0xE5, 0x71, 0x25, 0x62, 0xE5, 0x69,
+    0x02, 0x21, 0x46, 0x4A, 0x22, 0x29, 0xE5, 0x41, 0xA4, 0x41, 0xA3, 0x39, 0xC7, 0x5A, 0x43, 0x31, 0x42, 0x31, 0x66, 0x4A, 0x42, 0x39, 0x87, 0x62, 0x66, 0x5A, 0x05, 0x4A, 0xC4, 0x41, 0xE4, 0x41, 0xE4, 0x41, 0x27, 0x52, 0x06, 0x52, 0xC4, 0x51, 0x65, 0x6A, 0x05, 0x52, 0x05, 0x52, 0x25, 0x5A, 0xA6, 0x82, 0xFE, 0xFF, 0x48, 0x8B, 0x87, 0x62, 0xCA, 0x7B, 0x8A, 0xA3, 0xFE, 0xFF, 0xC6, 0x72,
+    0xA6, 0x5A, 0x69, 0x83, 0xAA, 0xA3, 0x6C, 0xB4, 0x07, 0x63, 0x66, 0x5A, 0x45, 0x5A, 0x49, 0x93, 0x27, 0x7B, 0x66, 0x52, 0x05, 0x4A, 0xAA, 0x83, 0xFF, 0xFF, 0x28, 0x7B, 0x86, 0x6A, 0xEA, 0x73, 0xE7, 0x72, 0xFE, 0xFF, 0xC7, 0x72, 0xC3, 0x51, 0x86, 0x62, 0x69, 0x9B, 0xFF, 0xFF, 0x86, 0x72, 0x25, 0x5A, 0x05, 0x62, 0x29, 0xD3, 0x56, 0xF6, 0xA5, 0x71, 0x05, 0x5A, 0xA6, 0x72, 0xFF, 0xFF,
+    0x4D, 0xE4, 0xA4, 0x89, 0x06, 0x72, 0x64, 0x71, 0x8E, 0xFD, 0xE6, 0x81, 0xE6, 0x79, 0x44, 0x79, 0x43, 0x71, 0x09, 0x8B, 0x47, 0x72, 0x06, 0x6A, 0x05, 0x62, 0xE5, 0x61, 0x26, 0x6A, 0x25, 0x62, 0xC3, 0x50, 0xE5, 0x49, 0xC5, 0x39, 0x83, 0x39, 0x41, 0x31, 0x42, 0x31, 0xA7, 0x62, 0x63, 0x39, 0x66, 0x52, 0x63, 0x31, 0xA3, 0x39, 0x66, 0x5A, 0x49, 0x83, 0x84, 0x41, 0x25, 0x4A, 0x05, 0x4A,
+    0xE7, 0x6A, 0x8A, 0x73, 0x27, 0x52, 0xC5, 0x49, 0xC4, 0x59, 0x2B, 0x84, 0x05, 0x52, 0x25, 0x52, 0x87, 0x6A, 0xCA, 0x83, 0x48, 0x8B, 0xC7, 0x6A, 0x86, 0x6A, 0x8C, 0x9C, 0xFF, 0xFF, 0xCA, 0x93, 0x89, 0x63, 0xAA, 0x7B, 0xCA, 0x9B, 0xFF, 0xFF, 0x4C, 0x94, 0x66, 0x5A, 0xC7, 0x62, 0xBA, 0xF7, 0xAA, 0x9B, 0xA7, 0x52, 0x86, 0x5A, 0x8C, 0x9C, 0xFF, 0xFF, 0xCA, 0x93, 0x07, 0x7B, 0xA6, 0x62,
+    0xDA, 0xFF, 0x0A, 0xBC, 0xB0, 0xC5, 0x85, 0x5A, 0x29, 0x83, 0xFF, 0xFF, 0xE7, 0x82, 0x25, 0x5A, 0x45, 0x62, 0xE7, 0x92, 0xDF, 0xFF, 0x86, 0x82, 0xC4, 0x59, 0x05, 0x62, 0xFA, 0xFF, 0x25, 0x8A, 0xE5, 0x79, 0xA4, 0x59, 0xA7, 0x72, 0xC4, 0x61, 0x85, 0x71, 0xC4, 0x59, 0xA4, 0x51, 0xA7, 0x72, 0xE5, 0x69, 0xA5, 0x71, 0x65, 0x79, 0xC5, 0x81, 0x46, 0x6A, 0x05, 0x5A, 0x25, 0x5A, 0x05, 0x52,
+    0xC3, 0x50, 0x84, 0x49, 0xE3, 0x40, 0x63, 0x39, 0x22, 0x31, 0xE4, 0x41, 0x26, 0x5A, 0x43, 0x31, 0x63, 0x39, 0xC7, 0x52, 0x43, 0x39, 0x2A, 0x83, 0x4A, 0x83, 0xC4, 0x39, 0xC7, 0x5A, 0xC4, 0x41, 0xC9, 0x7A, 0xC4, 0x41, 0x89, 0x6B, 0x46, 0x5A, 0xE4, 0x51, 0xE5, 0x51, 0x4A, 0x84, 0x05, 0x52, 0x25, 0x5A, 0x08, 0x73, 0x06, 0x73, 0x6C, 0x94, 0x28, 0x7B, 0x48, 0x73, 0xA9, 0x83, 0xFF, 0xFF,
+    0xE6, 0x62, 0x07, 0x6B, 0xA9, 0x83, 0xFF, 0xFF, 0x4B, 0x7C, 0x86, 0x52, 0xC7, 0x5A, 0x12, 0xEE, 0xEA, 0x8B, 0x86, 0x52, 0xA6, 0x5A, 0x8F, 0xCD, 0xFF, 0xFF, 0x2E, 0xBD, 0xE9, 0x9B, 0x8B, 0x94, 0xFF, 0xFF, 0x07, 0x6B, 0x97, 0xFF, 0x28, 0x73, 0xFF, 0xFF, 0xB0, 0xE5, 0x29, 0x8B, 0x05, 0x5A, 0xC6, 0x6A, 0xDD, 0xFF, 0xE7, 0x8A, 0x66, 0x72, 0x87, 0x72, 0x28, 0x73, 0xC4, 0x51, 0xC4, 0x71,
+    0x06, 0x6A, 0x08, 0x73, 0xC5, 0x51, 0xA5, 0x59, 0xA3, 0x59, 0xC7, 0x6A, 0xE4, 0x51, 0xC4, 0x51, 0x05, 0x62, 0x05, 0x52, 0x45, 0x5A, 0x25, 0x5A, 0xE5, 0x61, 0x25, 0x5A, 0x25, 0x5A, 0x45, 0x62, 0xA3, 0x50, 0xA2, 0x58, 0x22, 0x31, 0x22, 0x31, 0x22, 0x31, 0xA4, 0x39, 0xC4, 0x51, 0x45, 0x4A, 0xE9, 0x6A, 0x63, 0x39, 0x6A, 0x7B, 0xA7, 0x62, 0x29, 0x7B, 0xA4, 0x59, 0xA9, 0x62, 0x08, 0x5B,
+    0x6B, 0x8B, 0x05, 0x62, 0xE4, 0x69, 0x88, 0x7B, 0x25, 0x62, 0xE4, 0x51, 0xA7, 0x6A, 0xED, 0x7C, 0x85, 0x72, 0x45, 0x5A, 0xA6, 0x6A, 0x0A, 0x6C, 0x0B, 0x8C, 0x0A, 0x8C, 0xA9, 0x73, 0xFE, 0xFF, 0x88, 0x6B, 0x68, 0x63, 0xA9, 0x7B, 0xFF, 0xFF, 0x0A, 0x7C, 0x86, 0x52, 0xC7, 0x5A, 0x6C, 0x9C, 0x48, 0x6B, 0xA6, 0x52, 0x86, 0x52, 0xFB, 0xFF, 0xED, 0xA4, 0x6F, 0xB5, 0xA9, 0x93, 0x6C, 0x94,
+    0x28, 0x73, 0xC6, 0x5A, 0xD1, 0xCD, 0xEE, 0x9C, 0x86, 0x5A, 0x0B, 0xA4, 0xC7, 0x72, 0x89, 0x6B, 0xA6, 0x62, 0xC4, 0x51, 0xA7, 0x72, 0xAA, 0x8B, 0x86, 0x5A, 0x05, 0x5A, 0xA4, 0x51, 0x25, 0x6A, 0x45, 0x62, 0xA4, 0x51, 0x05, 0x62, 0x06, 0x62, 0x25, 0x62, 0xC5, 0x59, 0xC6, 0x51, 0xE6, 0x51, 0x06, 0x72, 0x05, 0x62, 0xA5, 0x79, 0xA5, 0x79, 0xE6, 0x69, 0xA6, 0x79, 0xE6, 0x69, 0x46, 0x5A,
+    0xA2, 0x48, 0x22, 0x39, 0xA7, 0x5A, 0x65, 0x4A, 0x43, 0x29, 0x67, 0x52, 0x83, 0x41, 0xC7, 0x6A, 0x71, 0xB5, 0x26, 0x52, 0x26, 0x52, 0xC4, 0x41, 0x64, 0x59, 0xFE, 0xFF, 0x66, 0x72, 0xC8, 0x62, 0xAB, 0x8B, 0x86, 0x5A, 0x6D, 0xFC, 0xFD, 0xFF, 0xC8, 0xAA, 0x86, 0x62, 0x49, 0x7B, 0x45, 0x6A, 0xFF, 0xFF, 0xCA, 0xA3, 0xE7, 0x6A, 0xA6, 0x5A, 0xA6, 0x62, 0xAC, 0xAC, 0x47, 0x63, 0x89, 0x73,
+    0x8F, 0x85, 0xE7, 0x5A, 0x2D, 0xB5, 0xA9, 0x7B, 0xAD, 0x8C, 0x86, 0x4A, 0xA6, 0x52, 0x12, 0xC6, 0x67, 0x63, 0xE7, 0x5A, 0x28, 0x5B, 0xFF, 0xFF, 0x8C, 0x8C, 0x4B, 0x9C, 0xC7, 0x62, 0xAC, 0x74, 0xA6, 0x5A, 0xC6, 0x62, 0x0A, 0x94, 0xEB, 0x83, 0x65, 0x52, 0xA9, 0x8B, 0x85, 0x5A, 0x52, 0xB6, 0x87, 0x72, 0xA6, 0x62, 0xE7, 0x6A, 0x69, 0x7B, 0x68, 0x83, 0xA4, 0x69, 0xC7, 0x6A, 0xAB, 0xA3,
+    0x25, 0x92, 0xE4, 0x69, 0x89, 0xBB, 0xE5, 0x69, 0xE5, 0x69, 0x87, 0xCA, 0x25, 0xCA, 0xCE, 0xF4, 0xA5, 0x71, 0x06, 0x7A, 0x49, 0xEB, 0x87, 0xCA, 0x49, 0xD3, 0x8B, 0xAB, 0x66, 0x62, 0x06, 0x6A, 0xA6, 0x52, 0x63, 0x31, 0x86, 0x52, 0x42, 0x31, 0x83, 0x39, 0x08, 0x63, 0xA7, 0x5A, 0x01, 0x29, 0x46, 0x52, 0x83, 0x39, 0x8A, 0x73, 0x86, 0x5A, 0xE4, 0x69, 0x42, 0x39, 0x45, 0x52, 0x70, 0xAD,
+    0x85, 0x62, 0xE4, 0x49, 0x65, 0x62, 0x49, 0x93, 0x33, 0xF6, 0x89, 0x8B, 0xEB, 0x83, 0x66, 0x5A, 0xE6, 0x82, 0xFF, 0xFF, 0x2B, 0xAC, 0x68, 0x73, 0x07, 0x6B, 0xED, 0x94, 0xFB, 0xFF, 0x48, 0x6B, 0x68, 0x5B, 0x0A, 0x6C, 0xE6, 0x52, 0xD7, 0xDF, 0x8F, 0x7D, 0xA6, 0x4A, 0xA6, 0x4A, 0xA6, 0x4A, 0x85, 0x42, 0x46, 0x4A, 0x28, 0x53, 0x27, 0x63, 0xCC, 0x8C, 0x8A, 0x83, 0x07, 0x5B, 0x49, 0x63,
+    0x45, 0x52, 0xEC, 0x9C, 0x89, 0x73, 0xAA, 0x7B, 0x25, 0x4A, 0xC7, 0x6A, 0x6F, 0xB5, 0xA7, 0x62, 0x66, 0x5A, 0x07, 0x83, 0x48, 0xA3, 0x86, 0x72, 0x66, 0x5A, 0x25, 0x62, 0x89, 0xB3, 0xFF, 0xFF, 0x44, 0x92, 0x86, 0x72, 0x25, 0x6A, 0xC4, 0x81, 0xFF, 0xFF, 0x06, 0x8A, 0xE5, 0x61, 0x67, 0x72, 0x6A, 0xE3, 0xFF, 0xFF, 0x66, 0x92, 0x45, 0x72, 0x46, 0x5A, 0x06, 0x6A, 0xFE, 0xFF, 0x87, 0xCA,
+    0xE3, 0x50, 0x43, 0x31, 0x43, 0x31, 0x63, 0x31, 0x65, 0x4A, 0xE5, 0x49, 0xA7, 0x62, 0x01, 0x31, 0xA6, 0x52, 0x83, 0x39, 0x66, 0x5A, 0x84, 0x49, 0xA4, 0x51, 0x69, 0x6B, 0xC7, 0x62, 0x08, 0x7B, 0x25, 0x6A, 0xCA, 0x7B, 0xE7, 0x6A, 0x6A, 0x83, 0xC7, 0x62, 0x0A, 0x9C, 0xEE, 0xAC, 0x07, 0x5B, 0xA7, 0x62, 0xB4, 0xEE, 0xFF, 0xFF, 0x95, 0xFF, 0x48, 0x73, 0x2A, 0x94, 0xFF, 0xFF, 0xB0, 0xC5,
+    0xCA, 0x73, 0x0A, 0x64, 0xEA, 0x73, 0xCF, 0x9D, 0x6B, 0x6C, 0xA7, 0x4A, 0x86, 0x4A, 0x28, 0x53, 0x85, 0x42, 0x66, 0x42, 0x66, 0x42, 0xEA, 0x7B, 0x2E, 0x95, 0x27, 0x63, 0xE7, 0x62, 0x28, 0x63, 0x33, 0xD6, 0xC7, 0x5A, 0x07, 0x6B, 0x69, 0x7B, 0xDF, 0xFF, 0x70, 0xBD, 0xE7, 0x6A, 0xA7, 0x5A, 0xA9, 0x93, 0xFD, 0xFF, 0xE8, 0x9A, 0x66, 0x6A, 0xE5, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x82,
+    0xC4, 0x61, 0x0C, 0xA4, 0xEA, 0xA3, 0xE4, 0x61, 0x67, 0x7A, 0xA7, 0x72, 0x05, 0x62, 0xE8, 0x82, 0x69, 0x8A, 0x26, 0x62, 0x66, 0x62, 0x26, 0x62, 0x86, 0x62, 0x25, 0x62, 0x46, 0x5A, 0x87, 0x62, 0xC3, 0x50, 0x22, 0x31, 0x43, 0x39, 0x63, 0x31, 0x43, 0x31, 0xA4, 0x39, 0x22, 0x31, 0x85, 0x52, 0xE8, 0x72, 0x64, 0x39, 0x84, 0x41, 0xC7, 0x52, 0x05, 0x52, 0x86, 0x5A, 0x69, 0x7B, 0x4C, 0x9C,
+    0xC4, 0x49, 0x87, 0x62, 0x09, 0x6B, 0xCA, 0x6B, 0x46, 0x52, 0x08, 0x6B, 0x28, 0x7B, 0xAC, 0x7C, 0xA6, 0x5A, 0xEE, 0xAC, 0xA9, 0x7B, 0xFF, 0xFF, 0x6B, 0x94, 0x0A, 0x8C, 0x26, 0x63, 0xFF, 0xFF, 0xAF, 0x9D, 0x48, 0x5B, 0xE7, 0x52, 0xFF, 0xFF, 0x8C, 0x84, 0xC6, 0x4A, 0xE7, 0x52, 0xEA, 0x6B, 0x07, 0x53, 0xA6, 0x42, 0xC7, 0x52, 0xF7, 0xCE, 0xAC, 0x8C, 0x4B, 0x8C, 0xCE, 0xAC, 0xFE, 0xFF,
+    0x4C, 0x94, 0xE7, 0x62, 0x2A, 0x8C, 0xFF, 0xFF, 0x4C, 0x8C, 0x48, 0x7B, 0x8D, 0x9C, 0x4B, 0x84, 0x32, 0xBD, 0xCA, 0x93, 0x86, 0x6A, 0x08, 0x73, 0xE8, 0x6A, 0x05, 0x5A, 0x05, 0x5A, 0x08, 0x7B, 0x66, 0x6A, 0x49, 0x83, 0xC4, 0x51, 0x86, 0x6A, 0x66, 0x6A, 0xE6, 0x51, 0xC5, 0x49, 0xA8, 0x72, 0x88, 0x7A, 0x26, 0x5A, 0x25, 0x62, 0x05, 0x5A, 0x46, 0x5A, 0x66, 0x62, 0x66, 0x5A, 0x86, 0x62,
+    0xC2, 0x40, 0xA1, 0x38, 0x03, 0x31, 0x84, 0x39, 0x63, 0x31, 0x83, 0x39, 0x83, 0x39, 0x49, 0x6B, 0x68, 0x5A, 0xA5, 0x39, 0x05, 0x42, 0x83, 0x41, 0x05, 0x52, 0x50, 0xBD, 0x2C, 0x9C, 0x4B, 0x94, 0xE4, 0x51, 0xC7, 0x52, 0x07, 0x63, 0x66, 0x62, 0xEB, 0x83, 0x2B, 0x7C, 0xC7, 0x62, 0xAA, 0x73, 0xA6, 0x4A, 0xAF, 0x95, 0xA9, 0x73, 0x07, 0x5B, 0xFF, 0xF7, 0x4A, 0x6C, 0x89, 0x6B, 0xCC, 0x7C,
+    0xFF, 0xFF, 0xC9, 0x53, 0x48, 0x5B, 0xCF, 0x8D, 0xFA, 0xF7, 0xE6, 0x4A, 0x07, 0x4B, 0x37, 0xBF, 0x2B, 0x64, 0xA6, 0x42, 0x0B, 0x5C, 0xFF, 0xFF, 0xF4, 0xAE, 0xF2, 0xB5, 0xEA, 0x73, 0x7B, 0xEF, 0x0E, 0xA5, 0x45, 0x4A, 0x88, 0x6B, 0x47, 0x5B, 0x44, 0x52, 0xC9, 0x7B, 0x68, 0x63, 0xE8, 0x62, 0x65, 0x5A, 0x2B, 0x8C, 0x45, 0x52, 0x09, 0x73, 0x04, 0x52, 0xE7, 0x62, 0xC4, 0x49, 0xC4, 0x49,
+    0xC7, 0x6A, 0xA7, 0x6A, 0xE4, 0x51, 0xC4, 0x51, 0xC8, 0x72, 0x46, 0x5A, 0xE4, 0x51, 0xC8, 0x72, 0xE8, 0x72, 0x46, 0x5A, 0x45, 0x5A, 0x25, 0x5A, 0x86, 0x5A, 0xA7, 0x62, 0x86, 0x62, 0x66, 0x5A, 0xE2, 0x38, 0x87, 0x52, 0x84, 0x39, 0xE8, 0x6A, 0x63, 0x31, 0xA4, 0x39, 0x63, 0x39, 0xC8, 0x6A, 0xE7, 0x7A, 0xA5, 0x41, 0xE4, 0x41, 0xE3, 0x41, 0xE4, 0x61, 0xFF, 0xFF, 0x8A, 0xA3, 0xEA, 0x83,
+    0x66, 0x5A, 0x89, 0x6B, 0x85, 0x82, 0xFD, 0xFF, 0x6F, 0xDD, 0x0B, 0x94, 0xE7, 0x62, 0xCD, 0x9C, 0x6C, 0xA4, 0xA9, 0x6B, 0x72, 0x9E, 0xCD, 0x74, 0xE7, 0x5A, 0x8C, 0x94, 0xCA, 0x5B, 0xC9, 0x63, 0x09, 0x4C, 0xFF, 0xEF, 0x68, 0x5B, 0x72, 0x76, 0xFD, 0xB7, 0xE7, 0x4A, 0xC7, 0x4A, 0x4B, 0x44, 0x47, 0x43, 0x86, 0x42, 0x27, 0x3B, 0x2B, 0x74, 0xD1, 0x8D, 0x4B, 0x8C, 0x49, 0x63, 0x8A, 0x63,
+    0x8A, 0x6B, 0x28, 0x53, 0x0A, 0x84, 0xA6, 0x52, 0x07, 0x5B, 0x69, 0x73, 0x66, 0x5A, 0x6B, 0x9C, 0x44, 0x52, 0x28, 0x73, 0x66, 0x5A, 0xA6, 0x5A, 0x6E, 0xCD, 0x0B, 0xA4, 0x25, 0x5A, 0xE4, 0x49, 0x85, 0x5A, 0x87, 0x82, 0xA9, 0xAB, 0x25, 0x5A, 0x86, 0x72, 0x07, 0x93, 0xE4, 0x59, 0x49, 0xA3, 0x66, 0x8A, 0x86, 0x82, 0xA7, 0xDA, 0x86, 0x8A, 0xEB, 0xBB, 0x86, 0x7A, 0x66, 0x6A, 0xC7, 0x6A,
+    0x25, 0x4A, 0x82, 0x39, 0x86, 0x4A, 0x63, 0x31, 0x22, 0x31, 0xA7, 0x5A, 0xC3, 0x41, 0xAF, 0xC4, 0x8A, 0x7B, 0x83, 0x39, 0x29, 0x7B, 0x89, 0x73, 0x05, 0x5A, 0x86, 0x72, 0x66, 0x7A, 0x50, 0xDD, 0x93, 0xFE, 0x49, 0x73, 0x25, 0x52, 0xA6, 0x8A, 0xF5, 0xF6, 0xFF, 0xFF, 0x8C, 0xAC, 0xCD, 0x8C, 0x28, 0x5B, 0x10, 0xB6, 0x90, 0xB5, 0x4F, 0x9D, 0xE7, 0x5A, 0xEE, 0x94, 0x96, 0xC7, 0x2B, 0x74,
+    0xE6, 0x42, 0x27, 0x43, 0x6C, 0x64, 0xD9, 0xDF, 0x89, 0x5B, 0xC7, 0x3A, 0xA6, 0x42, 0xA6, 0x3A, 0xA8, 0x53, 0xA6, 0x42, 0xC6, 0x42, 0x69, 0x63, 0xCC, 0x7C, 0x08, 0x5B, 0xC7, 0x52, 0x28, 0x5B, 0x49, 0x6B, 0x8C, 0x8C, 0x48, 0x63, 0xA6, 0x52, 0x66, 0x4A, 0x2B, 0x84, 0xCD, 0x9C, 0x44, 0x4A, 0x28, 0x7B, 0xEA, 0x8B, 0x4B, 0x94, 0x45, 0x62, 0x65, 0x5A, 0xD0, 0xC5, 0xFF, 0xFF, 0x2C, 0xAC,
+    0xE4, 0x71, 0x85, 0x72, 0xFD, 0xFF, 0x66, 0xB2, 0x9F, 0xFF, 0x25, 0x5A, 0x86, 0x6A, 0x8C, 0xF4, 0x25, 0xCA, 0x4C, 0xE3, 0x67, 0x82, 0xC8, 0x8A, 0x0A, 0xE3, 0xAB, 0xBB, 0x77, 0xFF, 0xA6, 0x8A, 0x03, 0x49, 0xA7, 0x62, 0x83, 0x39, 0x83, 0x39, 0x83, 0x39, 0xE4, 0x41, 0x83, 0x31, 0x29, 0x7B, 0x4A, 0x7B, 0x23, 0x31, 0x08, 0x63, 0x28, 0x63, 0x04, 0x4A, 0xA7, 0x62, 0xC7, 0x6A, 0x06, 0x73,
+    0xE7, 0x62, 0x69, 0x73, 0x69, 0x6B, 0x6B, 0x7C, 0x48, 0x6B, 0x8C, 0x9C, 0xD1, 0xD5, 0xFF, 0xFF, 0x4E, 0x8D, 0x89, 0x73, 0x4B, 0x84, 0xFF, 0xFF, 0xDB, 0xFF, 0xED, 0x84, 0xE9, 0x6B, 0x51, 0x96, 0xEC, 0x7C, 0x27, 0x43, 0x07, 0x4B, 0xFA, 0xAF, 0xAA, 0x73, 0xC6, 0x3A, 0x86, 0x42, 0xC7, 0x42, 0x69, 0x4B, 0xA6, 0x3A, 0x86, 0x42, 0x4B, 0x64, 0xA9, 0x53, 0xEA, 0x73, 0x8C, 0x8C, 0xF7, 0xDE,
+    0x0A, 0x74, 0x45, 0x42, 0x73, 0xCE, 0xFF, 0xFF, 0xC5, 0x52, 0xB0, 0xCD, 0x28, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x7B, 0x29, 0x73, 0xA6, 0x62, 0xFF, 0xFF, 0xA7, 0x92, 0x25, 0x62, 0x68, 0x73, 0x69, 0x8B, 0xC6, 0x7A, 0x25, 0x6A, 0x66, 0x6A, 0x86, 0x6A, 0x06, 0x52, 0x0A, 0x7B, 0x06, 0x62, 0x05, 0x6A, 0x86, 0x6A, 0x66, 0x5A, 0xCB, 0x93, 0x65, 0x5A, 0x29, 0x7B, 0xE7, 0x62, 0x08, 0x63,
+    0xE3, 0x50, 0xC4, 0x39, 0x63, 0x31, 0x29, 0x6B, 0x42, 0x29, 0xA3, 0x39, 0xC5, 0x39, 0xE4, 0x39, 0x04, 0x4A, 0x65, 0x4A, 0x45, 0x52, 0x89, 0x73, 0x25, 0x4A, 0x66, 0x5A, 0x45, 0x52, 0x86, 0x52, 0x66, 0x5A, 0x66, 0x52, 0x48, 0x5B, 0x07, 0x5B, 0xAD, 0x8C, 0x48, 0x5B, 0xCA, 0x6B, 0x4B, 0x6C, 0x85, 0x4A, 0xCC, 0x6C, 0x8B, 0x54, 0xEA, 0x6B, 0x6C, 0x74, 0xFF, 0xFF, 0x2E, 0x5D, 0xB3, 0x96,
+    0xBC, 0xA7, 0xDE, 0xA7, 0x07, 0x33, 0xF9, 0x9F, 0x4F, 0x5D, 0xAA, 0x53, 0x86, 0x3A, 0xF2, 0x4D, 0x48, 0x43, 0xA6, 0x42, 0x0D, 0x55, 0xFE, 0xEF, 0x0A, 0x5C, 0x6C, 0x7C, 0x79, 0xB7, 0x8C, 0x6C, 0xEB, 0x6B, 0xA5, 0x3A, 0xA9, 0x6B, 0xE7, 0x5A, 0x45, 0x4A, 0x8A, 0x73, 0x45, 0x4A, 0xA9, 0x6B, 0x28, 0x63, 0x69, 0x73, 0x08, 0x63, 0x66, 0x52, 0x87, 0x62, 0x25, 0x52, 0x25, 0x52, 0x25, 0x4A,
+    0x86, 0x62, 0x04, 0x52, 0x25, 0x52, 0xC4, 0x49, 0xC4, 0x49, 0x25, 0x52, 0x87, 0x62, 0xE4, 0x51, 0x04, 0x52, 0x45, 0x52, 0x86, 0x5A, 0x86, 0x5A, 0x86, 0x5A, 0x25, 0x52, 0x86, 0x5A, 0xC7, 0x62, 0x24, 0x51, 0x63, 0x29, 0xC4, 0x31, 0x6A, 0x6B, 0xC4, 0x39, 0x05, 0x3A, 0xC5, 0x41, 0xC4, 0x39, 0xA3, 0x41, 0x2D, 0x7C, 0xCA, 0x6B, 0xE4, 0x39, 0xC3, 0x49, 0x87, 0x62, 0x05, 0x5A, 0x66, 0x62,
+    0x04, 0x52, 0x65, 0x4A, 0xCE, 0x7C, 0x65, 0x4A, 0x28, 0x5B, 0x89, 0x5B, 0xA9, 0x53, 0x27, 0x5B, 0xA6, 0x4A, 0x27, 0x53, 0xC6, 0x3A, 0xEA, 0x53, 0x48, 0x53, 0x47, 0x43, 0x0E, 0x75, 0xAC, 0x64, 0x70, 0x8D, 0xCD, 0x44, 0xCA, 0x4B, 0xE9, 0x4B, 0x0A, 0x4C, 0x27, 0x33, 0x86, 0x3A, 0xC7, 0x32, 0xCA, 0x43, 0x86, 0x3A, 0xA6, 0x3A, 0x28, 0x4B, 0x69, 0x5B, 0x28, 0x53, 0xE7, 0x4A, 0x29, 0x53,
+    0xE7, 0x52, 0x65, 0x42, 0x86, 0x4A, 0x45, 0x4A, 0x24, 0x3A, 0x08, 0x63, 0x25, 0x4A, 0xEB, 0x7B, 0x66, 0x52, 0x25, 0x4A, 0x49, 0x73, 0x25, 0x52, 0xC4, 0x49, 0xC4, 0x49, 0xC4, 0x41, 0xE4, 0x49, 0x05, 0x52, 0xE4, 0x49, 0x86, 0x5A, 0xE4, 0x49, 0xE4, 0x49, 0x05, 0x4A, 0x66, 0x5A, 0x05, 0x52, 0x25, 0x52, 0x66, 0x5A, 0x86, 0x52, 0x05, 0x52, 0x86, 0x52, 0xA3, 0x49, 0x86, 0x5A, 0xA6, 0x62,
+    0xA4, 0x31, 0x83, 0x29, 0xC4, 0x39, 0xC4, 0x41, 0xA4, 0x39, 0x83, 0x39, 0x25, 0x4A, 0xE5, 0x51, 0xE4, 0x91, 0x66, 0x5A, 0xE9, 0x6A, 0x05, 0x52, 0x87, 0x72, 0xD0, 0xF4, 0x87, 0xA2, 0xC7, 0x9A, 0xE7, 0x82, 0xA7, 0x62, 0x4C, 0x7C, 0x68, 0x7B, 0x28, 0x93, 0x89, 0x73, 0x07, 0x63, 0x68, 0x73, 0x27, 0x63, 0x68, 0x63, 0x28, 0x53, 0xC6, 0x42, 0x28, 0x53, 0xE7, 0x42, 0xEB, 0x5B, 0x68, 0x53,
+    0xAD, 0x64, 0x89, 0x4B, 0xC6, 0x3A, 0x2A, 0x54, 0x08, 0x53, 0xC6, 0x32, 0x66, 0x3A, 0x04, 0x2A, 0x08, 0x4B, 0x86, 0x3A, 0x86, 0x3A, 0xE7, 0x52, 0x28, 0x53, 0xC7, 0x52, 0x65, 0x42, 0xA7, 0x4A, 0x86, 0x4A, 0x45, 0x42, 0x0C, 0x84, 0x86, 0x52, 0x25, 0x42, 0xA7, 0x5A, 0x65, 0x52, 0xCD, 0xAC, 0x66, 0x52, 0x05, 0x4A, 0xE8, 0x6A, 0x45, 0x62, 0x56, 0xF7, 0x65, 0x62, 0x25, 0x4A, 0x04, 0x4A,
+    0xA9, 0x93, 0x65, 0x5A, 0x89, 0xA3, 0xE3, 0x51, 0x25, 0x52, 0x8D, 0xDC, 0xE4, 0x59, 0xC7, 0xA2, 0x66, 0x92, 0x45, 0x7A, 0x8A, 0xAB, 0xE4, 0x51, 0xE7, 0xA2, 0x62, 0x49, 0xA6, 0x92, 0xA6, 0x62, 0x05, 0x4A, 0x83, 0x31, 0xC7, 0x6A, 0x42, 0x31, 0xAB, 0x83, 0x46, 0x5A, 0xC6, 0x5A, 0xA7, 0x72, 0x11, 0xE5, 0x82, 0x51, 0x07, 0x6B, 0x24, 0x4A, 0x6A, 0x8B, 0xCA, 0xC3, 0xCA, 0xC3, 0x74, 0xEE,
+    0xFE, 0xFF, 0xFF, 0xFF, 0x96, 0xF7, 0x0A, 0x9C, 0x88, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xE7, 0xAF, 0x9D, 0x14, 0xEF, 0x51, 0x9D, 0x91, 0x75, 0x13, 0xA7, 0xAF, 0x85, 0xF6, 0x8E, 0x89, 0x3B, 0x28, 0x4B, 0x15, 0x97, 0x49, 0x63, 0x07, 0x3B, 0x45, 0x3A, 0x88, 0x5B, 0x47, 0x43, 0x46, 0x42, 0x86, 0x3A, 0x2B, 0x6C, 0x75, 0xB7, 0x47, 0x53, 0xFE, 0xCF, 0xAC, 0x64,
+    0x2A, 0x64, 0x78, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x8C, 0xEE, 0x9C, 0xBF, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0x48, 0x6B, 0x67, 0x6B, 0x5B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x89, 0x7B, 0x49, 0x73, 0x4C, 0xB4, 0xFF, 0xFF, 0xEE, 0xDC, 0xA5, 0x72, 0x28, 0x73, 0x48, 0x7B, 0xE4, 0x81, 0x2D, 0xAC, 0x66, 0x82, 0x87, 0x7A, 0xA6, 0x62, 0x86, 0x62, 0x2F, 0xC4, 0x25, 0x62, 0x49, 0x73, 0x68, 0x93,
+    0x02, 0x39, 0x63, 0x31, 0x6A, 0x6B, 0x43, 0x31, 0xCB, 0x7B, 0x83, 0x31, 0xA4, 0x39, 0x88, 0x52, 0x84, 0x39, 0xC4, 0x49, 0xC3, 0x39, 0xA3, 0x41, 0x69, 0x73, 0x62, 0x41, 0xE4, 0x59, 0x87, 0x72, 0x05, 0x52, 0x25, 0x52, 0xC7, 0x52, 0xEA, 0x73, 0xA7, 0x5A, 0x48, 0x63, 0x4B, 0x7C, 0x69, 0x73, 0x28, 0x53, 0x4B, 0x64, 0x28, 0x53, 0x48, 0x4B, 0xA9, 0x53, 0xA9, 0x43, 0x0E, 0x5D, 0x07, 0x43,
+    0x8C, 0x64, 0xE9, 0x33, 0x48, 0x4B, 0x6C, 0x5C, 0xCA, 0x5B, 0xCA, 0x43, 0x25, 0x3A, 0x27, 0x3B, 0xE7, 0x3A, 0x65, 0x3A, 0xC6, 0x32, 0x27, 0x43, 0x08, 0x53, 0x08, 0x53, 0xC7, 0x42, 0x49, 0x53, 0x86, 0x4A, 0x04, 0x3A, 0xAA, 0x6B, 0x45, 0x42, 0x04, 0x3A, 0x08, 0x63, 0x66, 0x4A, 0x28, 0x6B, 0x86, 0x52, 0x05, 0x4A, 0x45, 0x4A, 0x05, 0x4A, 0x46, 0x52, 0xE4, 0x41, 0xC3, 0x41, 0x66, 0x5A,
+    0x04, 0x52, 0xC8, 0x62, 0x05, 0x4A, 0x25, 0x52, 0x04, 0x42, 0x05, 0x4A, 0xE4, 0x51, 0x45, 0x5A, 0x45, 0x52, 0x66, 0x52, 0x66, 0x52, 0x66, 0x5A, 0x86, 0x5A, 0x05, 0x52, 0xA6, 0x62, 0xA6, 0x62, 0x42, 0x29, 0xC3, 0x50, 0xC3, 0x58, 0x03, 0x49, 0xA4, 0x41, 0x43, 0x31, 0x23, 0x31, 0x68, 0x5A, 0x65, 0x41, 0x47, 0x5A, 0xA3, 0x41, 0xA3, 0x41, 0xA3, 0x49, 0xC4, 0x49, 0xE4, 0x51, 0x26, 0x5A,
+    0x05, 0x52, 0x45, 0x52, 0xE8, 0x6A, 0xA6, 0x5A, 0x86, 0x5A, 0x66, 0x52, 0x49, 0x6B, 0xE7, 0x62, 0xA6, 0x52, 0x69, 0x5B, 0xC7, 0x52, 0x48, 0x5B, 0x49, 0x5B, 0xC7, 0x42, 0x07, 0x43, 0xE7, 0x4A, 0xE8, 0x4A, 0x86, 0x32, 0x28, 0x5B, 0x89, 0x5B, 0xE7, 0x52, 0x08, 0x43, 0x46, 0x3A, 0x25, 0x3A, 0xA7, 0x42, 0x45, 0x3A, 0x25, 0x32, 0x86, 0x4A, 0x08, 0x53, 0x45, 0x3A, 0x65, 0x42, 0x46, 0x42,
+    0x86, 0x4A, 0x65, 0x42, 0x25, 0x42, 0x66, 0x4A, 0x05, 0x3A, 0xA7, 0x5A, 0xE8, 0x62, 0x66, 0x52, 0x26, 0x4A, 0x25, 0x4A, 0xE4, 0x49, 0x04, 0x4A, 0xC4, 0x49, 0xC4, 0x41, 0xC4, 0x41, 0x46, 0x52, 0x26, 0x5A, 0x05, 0x52, 0xE4, 0x49, 0x46, 0x52, 0xE4, 0x49, 0x04, 0x4A, 0xC4, 0x51, 0x05, 0x52, 0x25, 0x52, 0x45, 0x52, 0x66, 0x52, 0x46, 0x5A, 0x86, 0x5A, 0x45, 0x5A, 0x86, 0x5A, 0x86, 0x62,
+    0x43, 0x31, 0xA2, 0x50, 0xA2, 0x48, 0x23, 0x41, 0x84, 0x39, 0x63, 0x39, 0xC5, 0x49, 0x69, 0x62, 0x84, 0x41, 0x09, 0x73, 0xA3, 0x41, 0xA6, 0x5A, 0xA2, 0x41, 0xC7, 0x62, 0x45, 0x62, 0x25, 0x62, 0x46, 0x62, 0x87, 0x62, 0xE8, 0x6A, 0x86, 0x5A, 0xA7, 0x62, 0x86, 0x52, 0xE7, 0x5A, 0xC6, 0x62, 0xE7, 0x5A, 0x0E, 0x8D, 0x48, 0x5B, 0x8D, 0x84, 0x4C, 0x7C, 0x88, 0x4B, 0xC6, 0x3A, 0x68, 0x53,
+    0x48, 0x4B, 0x07, 0x43, 0x28, 0x5B, 0x8D, 0x74, 0xA7, 0x4A, 0xCA, 0x53, 0x25, 0x3A, 0x45, 0x3A, 0x09, 0x4B, 0x45, 0x3A, 0x66, 0x3A, 0x86, 0x42, 0x69, 0x63, 0x28, 0x5B, 0x48, 0x5B, 0xE7, 0x4A, 0xC7, 0x52, 0xA7, 0x52, 0x45, 0x42, 0xC7, 0x52, 0x45, 0x4A, 0x66, 0x52, 0x69, 0x6B, 0xA6, 0x5A, 0x45, 0x4A, 0x25, 0x52, 0x25, 0x4A, 0x66, 0x5A, 0x25, 0x52, 0xE4, 0x41, 0xE4, 0x49, 0x05, 0x4A,
+    0x05, 0x52, 0x46, 0x5A, 0xC4, 0x49, 0x66, 0x5A, 0x04, 0x4A, 0x05, 0x52, 0x25, 0x5A, 0x66, 0x5A, 0xA6, 0x5A, 0xA7, 0x5A, 0x66, 0x52, 0x66, 0x5A, 0x65, 0x52, 0x86, 0x5A, 0xC7, 0x62, 0xC7, 0x62, 0x43, 0x41, 0x83, 0x31, 0x63, 0x41, 0x83, 0x31, 0x83, 0x41, 0x05, 0x52, 0x08, 0x73, 0xA7, 0x72, 0xE5, 0x71, 0x8A, 0xA3, 0x29, 0x9B, 0x08, 0x6B, 0x65, 0x62, 0x2F, 0xDD, 0x8D, 0xD4, 0xCB, 0xD3,
+    0xFF, 0xFF, 0x2E, 0xE5, 0x2F, 0xAD, 0x8B, 0x9C, 0x4E, 0xAD, 0xCD, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xB6, 0x14, 0xB7, 0xED, 0x84, 0x9D, 0xF7, 0x2E, 0x7D, 0x72, 0x9E, 0xD3, 0x8E, 0x6E, 0x5D, 0x38, 0x8F, 0xA6, 0x42, 0xD0, 0x7D, 0xC6, 0x4A, 0x27, 0x2B, 0xE5, 0x31, 0x4C, 0x6C, 0xA5, 0x2A, 0x25, 0x42, 0x8D, 0x7C, 0x48, 0x53, 0xD0, 0x7D, 0x07, 0x5B, 0xE6, 0x42, 0xCC, 0x6C,
+    0x0A, 0x64, 0x93, 0xB6, 0xDC, 0xFF, 0x0E, 0x9D, 0xEC, 0x8C, 0x4E, 0x9D, 0xFE, 0xFF, 0xFF, 0xFF, 0x67, 0x73, 0xD1, 0xB5, 0xED, 0xA4, 0x2E, 0xBD, 0xFF, 0xFF, 0xFE, 0xFF, 0xAD, 0xAC, 0xC9, 0x9B, 0xCA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0x7A, 0x48, 0x8B, 0xEA, 0xD3, 0xE3, 0x89, 0xFE, 0xFF, 0xD7, 0xFE, 0xAB, 0xBB, 0x08, 0xAB, 0x86, 0x6A, 0xDC, 0xFF, 0xE7, 0x82, 0x74, 0xFF, 0x8A, 0xB3,
+    0xE5, 0x49, 0x22, 0x31, 0x43, 0x31, 0x86, 0x72, 0x63, 0x41, 0xC4, 0x49, 0xC8, 0x6A, 0x84, 0x59, 0xFF, 0xFF, 0xA3, 0x89, 0x86, 0xA9, 0x46, 0x5A, 0xA7, 0x72, 0x09, 0xD3, 0xB3, 0xFE, 0xEB, 0xD3, 0xE7, 0x7A, 0xC8, 0x7A, 0x45, 0x6A, 0x2B, 0xAC, 0xC7, 0x5A, 0xC7, 0x5A, 0xA6, 0x5A, 0x08, 0x63, 0xE7, 0x62, 0xE6, 0x52, 0xC7, 0x5A, 0x08, 0x5B, 0x89, 0x63, 0x28, 0x53, 0x27, 0x53, 0xA6, 0x42,
+    0x07, 0x53, 0x49, 0x5B, 0x08, 0x53, 0x89, 0x5B, 0xC7, 0x5A, 0x89, 0x5B, 0xE4, 0x39, 0x86, 0x42, 0xAC, 0x7C, 0x25, 0x42, 0x45, 0x3A, 0x86, 0x52, 0x08, 0x53, 0xCE, 0x94, 0x65, 0x4A, 0x45, 0x42, 0x87, 0x4A, 0x05, 0x3A, 0xCE, 0x9C, 0xC7, 0x5A, 0xE8, 0x62, 0x86, 0x52, 0x24, 0x42, 0xAB, 0x7B, 0x0A, 0x84, 0xA6, 0x5A, 0x45, 0x52, 0x04, 0x4A, 0xE4, 0x49, 0xC3, 0x41, 0x25, 0x4A, 0xE4, 0x49,
+    0x46, 0x52, 0x25, 0x52, 0x45, 0x52, 0xA3, 0x41, 0x25, 0x42, 0x25, 0x4A, 0xA3, 0x41, 0x05, 0x4A, 0x25, 0x52, 0xE4, 0x49, 0x66, 0x52, 0x65, 0x52, 0x86, 0x52, 0xA6, 0x62, 0xA6, 0x62, 0xA6, 0x62, 0xA3, 0x50, 0xE2, 0x48, 0x83, 0x39, 0x43, 0x31, 0x83, 0x39, 0x42, 0x31, 0xC6, 0x51, 0x63, 0x49, 0xA8, 0x8A, 0xA4, 0x59, 0x87, 0x72, 0xC4, 0x49, 0xC7, 0x62, 0x85, 0x62, 0x66, 0x72, 0xE4, 0x59,
+    0xE5, 0x59, 0x05, 0x52, 0x46, 0x5A, 0x2C, 0x7C, 0x04, 0x4A, 0x08, 0x6B, 0x86, 0x52, 0x66, 0x52, 0xE8, 0x62, 0xA6, 0x42, 0xA6, 0x52, 0x28, 0x63, 0x48, 0x5B, 0x6C, 0x74, 0x65, 0x42, 0xA6, 0x42, 0x06, 0x43, 0x2F, 0x85, 0xE7, 0x52, 0x2B, 0x6C, 0xC7, 0x52, 0xCD, 0x74, 0xE4, 0x39, 0x46, 0x3A, 0x66, 0x3A, 0x05, 0x3A, 0x45, 0x3A, 0xC7, 0x52, 0xE8, 0x52, 0xE8, 0x5A, 0xC7, 0x52, 0x86, 0x4A,
+    0xC7, 0x5A, 0x05, 0x3A, 0x66, 0x4A, 0x8A, 0x73, 0x29, 0x63, 0x45, 0x4A, 0x25, 0x4A, 0x66, 0x52, 0x04, 0x42, 0x05, 0x4A, 0x66, 0x52, 0x86, 0x5A, 0x25, 0x4A, 0xC4, 0x41, 0x66, 0x5A, 0xA4, 0x41, 0x66, 0x5A, 0xE4, 0x49, 0xA3, 0x41, 0x45, 0x52, 0xE4, 0x49, 0xE4, 0x49, 0xC4, 0x49, 0x45, 0x52, 0x25, 0x4A, 0x04, 0x4A, 0x66, 0x5A, 0x66, 0x52, 0x86, 0x52, 0xA7, 0x62, 0xA6, 0x62, 0xC7, 0x62,
+    0xE2, 0x40, 0x04, 0x49, 0x44, 0x39, 0x44, 0x41, 0x64, 0x39, 0x22, 0x31, 0x65, 0x41, 0x84, 0x41, 0x46, 0x5A, 0xA3, 0x49, 0x05, 0x62, 0xA4, 0x49, 0x05, 0x52, 0x85, 0x5A, 0x45, 0x5A, 0x05, 0x52, 0x05, 0x52, 0x86, 0x62, 0x66, 0x5A, 0xE8, 0x5A, 0x2C, 0x5B, 0x2A, 0x6B, 0x64, 0x42, 0xCA, 0x6B, 0x2A, 0x7C, 0x08, 0x5B, 0xC9, 0x53, 0x2A, 0x6C, 0x09, 0x64, 0xFF, 0xF7, 0x6B, 0x5C, 0xA6, 0x3A,
+    0xAF, 0x75, 0xFF, 0xFF, 0x8D, 0x7C, 0xD0, 0x75, 0x75, 0xA6, 0xA9, 0x3B, 0xE4, 0x39, 0x72, 0x76, 0x68, 0x43, 0x45, 0x42, 0x4B, 0x54, 0x51, 0x85, 0x4F, 0x8D, 0x68, 0x5B, 0xFF, 0xFF, 0x2B, 0x64, 0xC5, 0x4A, 0x89, 0x5B, 0xFF, 0xFF, 0x70, 0xA5, 0x48, 0x63, 0x6D, 0x8C, 0x6C, 0x8C, 0x07, 0x63, 0xA7, 0x52, 0xE7, 0x5A, 0x66, 0x5A, 0xE7, 0x6A, 0xE8, 0x6A, 0xE4, 0x41, 0x66, 0x52, 0x86, 0x5A,
+    0xA7, 0x6A, 0xC7, 0x6A, 0xC4, 0x49, 0x46, 0x62, 0x05, 0x4A, 0x04, 0x52, 0x05, 0x5A, 0x45, 0x5A, 0x66, 0x52, 0xC3, 0x41, 0x86, 0x5A, 0xA6, 0x5A, 0xA6, 0x62, 0xA6, 0x62, 0xE7, 0x62, 0x07, 0x6B, 0xC3, 0x50, 0x02, 0x49, 0x43, 0x39, 0xA4, 0x41, 0x63, 0x39, 0x43, 0x49, 0x22, 0x41, 0xE6, 0x51, 0xE5, 0x51, 0xA7, 0x62, 0x45, 0x72, 0xC4, 0x51, 0x62, 0x41, 0x86, 0x6A, 0xE4, 0x61, 0xA7, 0x72,
+    0x24, 0x62, 0x25, 0x72, 0xC7, 0x7A, 0xA6, 0x6A, 0x6C, 0x84, 0x49, 0x7B, 0x07, 0x73, 0xFD, 0xFF, 0xFF, 0xFF, 0x89, 0x6B, 0xAC, 0x8C, 0x0D, 0x95, 0xFF, 0xFF, 0xAD, 0x8C, 0xA5, 0x42, 0xF6, 0xBE, 0xB4, 0xB6, 0xEA, 0x6B, 0xC6, 0x52, 0x27, 0x43, 0xE7, 0x62, 0xE7, 0x52, 0xE4, 0x31, 0x66, 0x3A, 0x66, 0x42, 0x25, 0x42, 0x66, 0x4A, 0x27, 0x5B, 0x12, 0xB6, 0x69, 0x6B, 0x45, 0x4A, 0x89, 0x63,
+    0xA6, 0x52, 0x87, 0x52, 0x86, 0x4A, 0x28, 0x63, 0xCC, 0x8C, 0xC7, 0x5A, 0x48, 0x73, 0xFD, 0xFF, 0x70, 0xAD, 0x25, 0x4A, 0xC7, 0x62, 0xC6, 0x72, 0xB6, 0xDE, 0xE4, 0x49, 0x66, 0x52, 0x85, 0x62, 0xF0, 0xDC, 0xFE, 0xFF, 0x69, 0x93, 0x86, 0x72, 0x29, 0x8B, 0xFF, 0xFF, 0x67, 0x92, 0x66, 0x72, 0xA6, 0x5A, 0x66, 0x62, 0xFF, 0xFF, 0x86, 0x6A, 0x08, 0x83, 0xCE, 0xC4, 0xEE, 0xC4, 0xE7, 0x92,
+    0x42, 0x31, 0x22, 0x29, 0x46, 0x5A, 0x63, 0x39, 0x25, 0x52, 0xCC, 0xB3, 0x83, 0x41, 0xC7, 0x72, 0x44, 0x61, 0x08, 0x8B, 0xCF, 0xE4, 0x84, 0x61, 0xE9, 0x93, 0x65, 0x6A, 0xC4, 0x79, 0x6E, 0xE4, 0xFF, 0xFF, 0x94, 0xF6, 0x86, 0x82, 0x25, 0x5A, 0x8C, 0xA4, 0x93, 0xFE, 0xD9, 0xFF, 0x0A, 0x84, 0x48, 0x7B, 0x6B, 0x8C, 0x90, 0xAD, 0x86, 0x52, 0xA6, 0x52, 0xA9, 0x6B, 0x2B, 0x7C, 0x48, 0x6B,
+    0xE8, 0x5A, 0x2C, 0x7C, 0xC7, 0x52, 0x0D, 0x7D, 0xC8, 0x62, 0x89, 0x5B, 0x25, 0x42, 0xE8, 0x4A, 0xAD, 0x84, 0x26, 0x4A, 0x66, 0x4A, 0xE8, 0x62, 0x2D, 0x85, 0x09, 0x63, 0x66, 0x4A, 0x05, 0x42, 0x88, 0x52, 0xB4, 0xA6, 0xEC, 0x83, 0xE8, 0x62, 0x66, 0x52, 0xF0, 0xBD, 0x94, 0xCE, 0xC6, 0x5A, 0xE4, 0x41, 0x86, 0x5A, 0x0B, 0x94, 0x4B, 0x94, 0x03, 0x42, 0x04, 0x4A, 0xE4, 0x41, 0x0A, 0xA4,
+    0xC3, 0x61, 0x46, 0x6A, 0x09, 0x83, 0x2C, 0xC4, 0xC4, 0x59, 0x8A, 0xAB, 0xA7, 0xA2, 0xA6, 0x7A, 0x69, 0xAB, 0xC4, 0x49, 0xE8, 0x92, 0x86, 0x62, 0x46, 0x7A, 0xA6, 0x62, 0x08, 0x7B, 0x85, 0x5A, 0x22, 0x31, 0x23, 0x31, 0xC4, 0x51, 0x73, 0xFE, 0xEC, 0xB3, 0x4A, 0x9B, 0x63, 0x49, 0x84, 0x51, 0xFF, 0xFF, 0xB0, 0xFD, 0xE5, 0x99, 0xA4, 0x59, 0xC7, 0x6A, 0x46, 0x7A, 0xFE, 0xFF, 0xE8, 0xB2,
+    0x46, 0x7A, 0x66, 0x6A, 0x25, 0x62, 0x4B, 0xB4, 0xC6, 0x62, 0xA6, 0x5A, 0x49, 0x73, 0x08, 0x63, 0xED, 0x94, 0x45, 0x4A, 0x66, 0x4A, 0x08, 0x63, 0xC7, 0x52, 0xA9, 0x63, 0x47, 0x4B, 0xC7, 0x5A, 0x28, 0x5B, 0x8E, 0x6D, 0xC7, 0x52, 0x87, 0x4B, 0xAA, 0x63, 0xE6, 0x42, 0x46, 0x42, 0x8C, 0x54, 0xB4, 0xC6, 0xE8, 0x62, 0xC7, 0x52, 0xEA, 0x73, 0x8E, 0x84, 0xA9, 0x7B, 0x86, 0x52, 0x04, 0x3A,
+    0x86, 0x5A, 0xC7, 0x4A, 0x0A, 0x84, 0x08, 0x6B, 0x44, 0x42, 0x6A, 0x7B, 0x25, 0x4A, 0xA9, 0x83, 0xE4, 0x49, 0x46, 0x52, 0x08, 0x6B, 0x25, 0x52, 0xE9, 0x93, 0xE4, 0x41, 0x66, 0x52, 0xC4, 0x41, 0xE4, 0x49, 0xC3, 0x51, 0x8A, 0x93, 0x08, 0x73, 0xE4, 0x49, 0xA7, 0x6A, 0xA6, 0x6A, 0x29, 0x9B, 0x65, 0x52, 0x86, 0x52, 0x45, 0x52, 0x86, 0x52, 0x07, 0x83, 0xA6, 0x5A, 0xC7, 0x62, 0xA6, 0x62,
+    0x02, 0x41, 0x23, 0x49, 0x8A, 0xAA, 0x25, 0x61, 0x26, 0x5A, 0x64, 0x49, 0x64, 0x41, 0x84, 0x51, 0x63, 0x61, 0x64, 0x69, 0x83, 0x51, 0x26, 0x62, 0xC8, 0x72, 0xE5, 0x59, 0x86, 0x62, 0xA6, 0x6A, 0xC4, 0x59, 0xE5, 0x59, 0x28, 0x6B, 0x04, 0x4A, 0x25, 0x52, 0xA7, 0x62, 0x6C, 0x8C, 0x49, 0x73, 0x6C, 0x94, 0xCD, 0x7C, 0x25, 0x4A, 0x07, 0x63, 0xCF, 0xB5, 0xFF, 0xFF, 0x86, 0x4A, 0x4C, 0x84,
+    0xFF, 0xFF, 0xD0, 0x95, 0x07, 0x5B, 0x2A, 0x6C, 0x8C, 0x94, 0xE7, 0x52, 0x25, 0x42, 0x0B, 0x5C, 0xE7, 0x42, 0xE8, 0x6A, 0x67, 0x4A, 0x0D, 0x8D, 0x0E, 0x95, 0x8D, 0x94, 0x0B, 0x94, 0xF4, 0xB5, 0x66, 0x5A, 0x05, 0x4A, 0xFF, 0xFF, 0xE9, 0x8B, 0x04, 0x4A, 0x2B, 0x8C, 0xFF, 0xFF, 0x27, 0x73, 0x45, 0x52, 0x28, 0x63, 0x49, 0x7B, 0xA3, 0x49, 0xE4, 0x49, 0xE7, 0x5A, 0xA7, 0x62, 0xA4, 0x49,
+    0x05, 0x5A, 0x82, 0x49, 0x05, 0x5A, 0x66, 0x6A, 0xE4, 0x49, 0xA8, 0x72, 0x67, 0x6A, 0x25, 0x52, 0x66, 0x52, 0x46, 0x5A, 0x66, 0x5A, 0x45, 0x5A, 0x66, 0x5A, 0xA6, 0x62, 0xA7, 0x62, 0xE7, 0x6A, 0x45, 0x69, 0x44, 0x51, 0xA8, 0x91, 0x24, 0x61, 0x26, 0x6A, 0x22, 0x41, 0x24, 0x41, 0x44, 0x41, 0x05, 0x62, 0x83, 0x49, 0x62, 0x49, 0x05, 0x5A, 0xC7, 0x6A, 0xA4, 0x51, 0xA7, 0x72, 0x05, 0x6A,
+    0xCA, 0x83, 0x66, 0x6A, 0x25, 0x62, 0x65, 0x6A, 0xA9, 0x7B, 0x24, 0x5A, 0xD6, 0xF6, 0x6F, 0xD5, 0xFE, 0xFF, 0xC7, 0x5A, 0x45, 0x52, 0xAC, 0xAC, 0x99, 0xF7, 0xAA, 0x7B, 0xC6, 0x52, 0x28, 0x63, 0xC7, 0x5A, 0xA7, 0x5A, 0xC7, 0x5A, 0xA6, 0x4A, 0xA6, 0x62, 0x08, 0x5B, 0x25, 0x42, 0x65, 0x42, 0x25, 0x3A, 0x46, 0x4A, 0x46, 0x42, 0x08, 0x63, 0xE7, 0x5A, 0x29, 0x73, 0x66, 0x52, 0x05, 0x42,
+    0xC6, 0x62, 0x66, 0x52, 0x25, 0x4A, 0xA6, 0x62, 0x0E, 0xA5, 0xE7, 0x6A, 0xA6, 0x62, 0x6B, 0x94, 0x70, 0xB5, 0x86, 0x5A, 0x24, 0x52, 0xAA, 0xA3, 0x06, 0x83, 0xC4, 0x49, 0xA3, 0x49, 0xAA, 0x93, 0x86, 0x9A, 0x66, 0x92, 0xC4, 0x61, 0xA7, 0x72, 0x04, 0x5A, 0x52, 0xFD, 0x49, 0x93, 0x25, 0x5A, 0x66, 0x5A, 0x46, 0x5A, 0x8B, 0xB3, 0x86, 0x62, 0x65, 0x62, 0xCA, 0x9B, 0xA6, 0x92, 0xE7, 0x72,
+    0xA9, 0x92, 0x63, 0x39, 0xE5, 0x61, 0x02, 0x39, 0x4A, 0x83, 0x02, 0x41, 0x01, 0x39, 0x63, 0x49, 0x2A, 0x83, 0x29, 0x83, 0x63, 0x59, 0x22, 0x49, 0x04, 0x62, 0x89, 0x8B, 0x28, 0x8B, 0xE8, 0x7A, 0x28, 0x83, 0x4B, 0xD4, 0x92, 0xEE, 0x86, 0x6A, 0xC7, 0x6A, 0xA7, 0x6A, 0xFF, 0xFF, 0x0E, 0xB5, 0x2C, 0x9C, 0x66, 0x52, 0x12, 0xC6, 0xA6, 0x52, 0x86, 0x5A, 0x86, 0x5A, 0x07, 0x53, 0xC9, 0x7B,
+    0xA6, 0x5A, 0x27, 0x53, 0x24, 0x4A, 0x4E, 0x85, 0x66, 0x5A, 0x04, 0x42, 0x05, 0x42, 0xE8, 0x5A, 0x6C, 0x84, 0x25, 0x4A, 0x05, 0x42, 0xE8, 0x62, 0x31, 0xA6, 0x67, 0x5A, 0x66, 0x52, 0xE4, 0x41, 0x85, 0x52, 0xA6, 0x5A, 0x04, 0x42, 0x87, 0x62, 0x86, 0x5A, 0xED, 0x9C, 0x04, 0x42, 0xC7, 0x62, 0x49, 0x7B, 0x4B, 0x94, 0xA5, 0x6A, 0x25, 0x52, 0x05, 0x52, 0x45, 0x5A, 0xE7, 0x7A, 0x05, 0x5A,
+    0xC5, 0x61, 0x87, 0x82, 0xC4, 0x71, 0x89, 0x9B, 0x05, 0x52, 0xE5, 0x71, 0x6D, 0xFC, 0x87, 0xA2, 0xA6, 0x8A, 0x26, 0x5A, 0x87, 0x72, 0x66, 0x62, 0xBF, 0xFF, 0x86, 0x62, 0xC7, 0x6A, 0xC7, 0x6A, 0xA4, 0x59, 0x45, 0x62, 0x62, 0x41, 0x02, 0x49, 0x47, 0x72, 0x22, 0x49, 0xE0, 0x38, 0x25, 0x6A, 0xA9, 0x8A, 0x26, 0x8A, 0xBC, 0xFF, 0xC4, 0x99, 0x67, 0x7A, 0x01, 0x41, 0xA7, 0x82, 0xDE, 0xFF,
+    0xAA, 0xB3, 0xA7, 0x8A, 0x25, 0x6A, 0x49, 0x7B, 0x6B, 0xB4, 0x26, 0x5A, 0x28, 0x73, 0x65, 0x5A, 0xC7, 0x6A, 0x6B, 0xA4, 0x69, 0x6B, 0x25, 0x52, 0x86, 0x52, 0xE8, 0x6A, 0x6C, 0x94, 0x4C, 0x94, 0x2F, 0xAD, 0xC6, 0x4A, 0xA6, 0x5A, 0x6B, 0x8C, 0x57, 0xB6, 0x49, 0x73, 0x05, 0x42, 0x8A, 0x6B, 0xF1, 0xC5, 0x46, 0x52, 0x25, 0x42, 0xFF, 0xFF, 0xB0, 0xAD, 0x86, 0x62, 0xC6, 0x62, 0xC6, 0x62,
+    0x04, 0x52, 0x2B, 0x8C, 0xA9, 0x6B, 0x4A, 0x83, 0xC3, 0x41, 0x28, 0x6B, 0x0A, 0x8C, 0x66, 0x5A, 0x08, 0x73, 0x86, 0x5A, 0x49, 0x83, 0x69, 0x8B, 0xE8, 0x6A, 0xE5, 0x49, 0xC8, 0x6A, 0x85, 0x62, 0x49, 0x93, 0x66, 0x6A, 0x05, 0x5A, 0xC4, 0x51, 0x46, 0x6A, 0x83, 0x61, 0x05, 0x62, 0x45, 0x5A, 0x86, 0x62, 0xEB, 0xBB, 0x66, 0x7A, 0x86, 0x5A, 0x87, 0x62, 0x86, 0x5A, 0xA6, 0x62, 0xC7, 0x72,
+    0x43, 0x51, 0xE2, 0x48, 0x23, 0x49, 0xA7, 0xD2, 0xA8, 0xDA, 0x63, 0x59, 0xA3, 0x51, 0x85, 0x69, 0x4B, 0xFB, 0xFF, 0xFF, 0x67, 0xAA, 0xA9, 0xA2, 0xC4, 0x59, 0xE8, 0x8A, 0x89, 0xD3, 0x26, 0x9A, 0x46, 0x72, 0xE7, 0x6A, 0xC4, 0x59, 0x2B, 0xB4, 0xCE, 0xB4, 0xCA, 0x7B, 0x65, 0x62, 0x86, 0x62, 0x65, 0x5A, 0xC9, 0x73, 0xE4, 0x49, 0x86, 0x5A, 0xFF, 0xFF, 0x0A, 0x84, 0xC6, 0x62, 0x69, 0x7B,
+    0xFF, 0xFF, 0xE6, 0x5A, 0xA6, 0x62, 0xAD, 0x9C, 0x89, 0x7B, 0xA7, 0x5A, 0x05, 0x42, 0x91, 0xA5, 0xEA, 0x83, 0x26, 0x4A, 0x25, 0x42, 0xAA, 0x7B, 0x4F, 0x9D, 0xEA, 0x8B, 0xE7, 0x6A, 0xFF, 0xFF, 0xA6, 0x6A, 0x62, 0x39, 0x0A, 0x8C, 0xFF, 0xFF, 0xC3, 0x49, 0x6A, 0x7B, 0x8F, 0xC5, 0x0C, 0xCC, 0x86, 0x6A, 0x04, 0x4A, 0x49, 0x7B, 0x49, 0x8B, 0xCA, 0x9B, 0xE4, 0x49, 0xC7, 0x6A, 0x87, 0x6A,
+    0xA4, 0x51, 0xAA, 0xA3, 0xAA, 0x9B, 0xE5, 0x51, 0xE4, 0x51, 0x62, 0x49, 0x25, 0x7A, 0x6A, 0xA3, 0x67, 0x6A, 0x46, 0x5A, 0x83, 0x49, 0x25, 0x62, 0x08, 0x93, 0xA6, 0x62, 0xA7, 0x62, 0x2E, 0xBD, 0x02, 0x39, 0x02, 0x39, 0x02, 0x41, 0x63, 0x51, 0xA2, 0x70, 0x23, 0x49, 0x63, 0x51, 0x0A, 0x9B, 0xE9, 0xA2, 0x83, 0x79, 0xE3, 0x78, 0x29, 0x93, 0x86, 0x6A, 0x4A, 0x93, 0x04, 0x62, 0x45, 0x62,
+    0x69, 0x7B, 0xC4, 0x61, 0xCB, 0xA3, 0x0B, 0xA4, 0x8D, 0xA4, 0x26, 0x62, 0x65, 0x6A, 0x2A, 0xAC, 0xD4, 0xEE, 0x04, 0x52, 0x25, 0x5A, 0xAA, 0x93, 0xFE, 0xFF, 0xC7, 0x72, 0xCA, 0x83, 0x28, 0x73, 0x47, 0x73, 0x66, 0x5A, 0x46, 0x5A, 0x07, 0x5B, 0x66, 0x62, 0x86, 0x5A, 0x05, 0x42, 0x25, 0x42, 0x25, 0x42, 0x05, 0x4A, 0xE5, 0x41, 0xC8, 0x6A, 0xE8, 0x6A, 0xA7, 0x62, 0x66, 0x62, 0xE5, 0x49,
+    0x66, 0x62, 0x66, 0x5A, 0x04, 0x42, 0x25, 0x62, 0x91, 0xBD, 0x25, 0x52, 0x25, 0x52, 0x28, 0x83, 0x6B, 0xA4, 0xC4, 0x49, 0x08, 0x73, 0x68, 0xA3, 0x0B, 0xAC, 0x87, 0x62, 0xA7, 0x6A, 0xE8, 0x72, 0x27, 0x7A, 0xA7, 0x82, 0xC4, 0x59, 0x46, 0x62, 0xE6, 0x61, 0x46, 0x91, 0x05, 0x62, 0xE4, 0x59, 0x09, 0x7B, 0x68, 0x62, 0x45, 0x61, 0x26, 0x62, 0x66, 0x5A, 0x86, 0x6A, 0x08, 0x8B, 0x86, 0x72,
+    0x23, 0x41, 0x43, 0x41, 0xE2, 0x38, 0x02, 0x41, 0x23, 0x49, 0x0D, 0x94, 0x46, 0x6A, 0xE8, 0x9A, 0x01, 0x59, 0x68, 0x7A, 0x64, 0x51, 0x6C, 0xB3, 0x01, 0x49, 0xC8, 0x8A, 0xA3, 0x59, 0xA3, 0x59, 0x25, 0x6A, 0xE3, 0x69, 0x12, 0xEE, 0xEB, 0xA3, 0x86, 0x72, 0x45, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x72, 0x25, 0x5A, 0x27, 0x73, 0x0A, 0x8C, 0x69, 0x73, 0xE8, 0x72, 0x4B, 0x94, 0x68, 0x73,
+    0xE7, 0x62, 0xE7, 0x52, 0xA7, 0x62, 0xCC, 0x8C, 0x25, 0x52, 0x25, 0x52, 0x05, 0x42, 0x86, 0x52, 0x71, 0xAD, 0xE5, 0x49, 0xA7, 0x5A, 0x08, 0x6B, 0xAA, 0x7B, 0xA8, 0x6A, 0x87, 0x62, 0x05, 0x4A, 0xE6, 0x6A, 0xE4, 0x49, 0x25, 0x4A, 0x87, 0x6A, 0x45, 0x52, 0x66, 0x62, 0xE5, 0x49, 0x66, 0x5A, 0x66, 0x62, 0xCD, 0xB4, 0x05, 0x62, 0x09, 0x73, 0xA8, 0x72, 0x24, 0x6A, 0x05, 0x5A, 0x25, 0x62,
+    0x05, 0x6A, 0xE8, 0x8A, 0xB7, 0xF6, 0x05, 0x5A, 0xC5, 0x59, 0x66, 0x89, 0x8C, 0xFB, 0x64, 0x89, 0xE6, 0x69, 0x08, 0x72, 0xC6, 0x69, 0xA8, 0x8A, 0xEF, 0xFC, 0x66, 0x62, 0xC7, 0x72, 0x86, 0x72, 0x43, 0x39, 0x02, 0x39, 0x64, 0x51, 0x86, 0x72, 0x43, 0x49, 0x64, 0x51, 0xE1, 0x48, 0x66, 0x8A, 0x46, 0x92, 0x46, 0x7A, 0x64, 0x59, 0x43, 0x69, 0x49, 0xB3, 0xC5, 0x79, 0x83, 0x59, 0xA7, 0x8A,
+    0x49, 0xC3, 0xB9, 0xFF, 0x6D, 0xD4, 0x45, 0x7A, 0xC4, 0x61, 0xFF, 0xFF, 0xAA, 0xA3, 0x45, 0x6A, 0x05, 0x52, 0xA9, 0x6B, 0xCD, 0xAC, 0x87, 0x6A, 0x66, 0x52, 0xCA, 0x83, 0x28, 0x73, 0x2B, 0x94, 0x8C, 0x94, 0x65, 0x4A, 0x08, 0x6B, 0xAC, 0x9C, 0x8A, 0x8B, 0x05, 0x52, 0x05, 0x42, 0x66, 0x4A, 0x12, 0xC6, 0xA7, 0x62, 0x45, 0x4A, 0xFE, 0xFF, 0x4B, 0x94, 0x08, 0x7B, 0xC7, 0x72, 0x4C, 0x9C,
+    0xC7, 0x72, 0x0A, 0x8C, 0x07, 0x5B, 0x28, 0x7B, 0x05, 0x5A, 0x0E, 0xBD, 0x08, 0x63, 0x87, 0x6A, 0x87, 0x6A, 0xE4, 0x49, 0xAA, 0x9B, 0x83, 0x49, 0x46, 0x62, 0xA7, 0x5A, 0xE3, 0x59, 0xEA, 0xB3, 0x26, 0x62, 0xC4, 0x49, 0xA4, 0x51, 0xC9, 0xAB, 0x05, 0x72, 0xA4, 0x61, 0xC6, 0x81, 0xA6, 0x89, 0x41, 0x71, 0x27, 0x62, 0x27, 0x5A, 0x06, 0x62, 0x48, 0x72, 0xE8, 0x7A, 0x87, 0x6A, 0x86, 0x6A,
+    0x06, 0x6A, 0x46, 0x72, 0xC5, 0x69, 0x02, 0x49, 0x43, 0x59, 0x84, 0x59, 0xA7, 0x82, 0xC5, 0x79, 0x2E, 0xFC, 0xC5, 0x79, 0x17, 0xFE, 0x29, 0xD3, 0x48, 0x92, 0x67, 0xAA, 0x84, 0x69, 0xFF, 0xFF, 0xE3, 0x89, 0xE8, 0x8A, 0xA8, 0x92, 0x45, 0x7A, 0xAC, 0xC4, 0xA7, 0x72, 0x05, 0x62, 0x26, 0x62, 0x86, 0x62, 0x8C, 0xB4, 0xC7, 0x72, 0xC7, 0x6A, 0xFF, 0xFF, 0xC7, 0x72, 0x2A, 0x94, 0xEA, 0x93,
+    0xFF, 0xFF, 0x04, 0x4A, 0xCB, 0x8B, 0x6B, 0xA4, 0x31, 0xDD, 0x66, 0x5A, 0x05, 0x42, 0x49, 0x6B, 0x44, 0x52, 0x87, 0x6A, 0xE4, 0x41, 0x10, 0xBD, 0x69, 0x83, 0xE8, 0x72, 0xCB, 0x9B, 0xFF, 0xFF, 0x49, 0x8B, 0x4B, 0x9C, 0x25, 0x52, 0xDF, 0xFF, 0xE8, 0x8A, 0xE4, 0x59, 0xEA, 0x9B, 0xD4, 0xCD, 0xA7, 0x82, 0xA3, 0x59, 0x25, 0x5A, 0x89, 0x9B, 0x05, 0x6A, 0xC4, 0x51, 0x07, 0x6B, 0xE4, 0x59,
+    0x69, 0xAB, 0x83, 0x49, 0xE8, 0x72, 0xA4, 0x51, 0xE4, 0x61, 0x8A, 0xB3, 0xE5, 0x59, 0x47, 0x6A, 0xE5, 0x51, 0x45, 0x72, 0x67, 0x6A, 0x67, 0x62, 0x06, 0x5A, 0x66, 0x5A, 0x66, 0x62, 0x08, 0x8B, 0x02, 0x41, 0x02, 0x41, 0x47, 0x82, 0x44, 0xA9, 0xFE, 0xFF, 0x64, 0x69, 0x67, 0x7A, 0x23, 0x59, 0x85, 0xB9, 0xFF, 0xFF, 0xE6, 0xB1, 0x84, 0x79, 0xE9, 0x92, 0xE5, 0x79, 0xCD, 0xFC, 0xE4, 0x89,
+    0x69, 0x9B, 0xE5, 0x69, 0x05, 0x82, 0x0B, 0xC4, 0xA6, 0x82, 0xA3, 0x51, 0x26, 0x6A, 0x86, 0x72, 0xA9, 0x93, 0xC6, 0x7A, 0xAB, 0x93, 0x68, 0x93, 0xFF, 0xFF, 0x66, 0x72, 0x4B, 0xA4, 0xA6, 0x7A, 0xCE, 0xB4, 0x48, 0x6B, 0x66, 0x6A, 0xEE, 0xB4, 0x66, 0x62, 0x25, 0x52, 0x05, 0x4A, 0x25, 0x4A, 0xEA, 0x8B, 0xE5, 0x51, 0xC4, 0x41, 0x66, 0x62, 0x08, 0x6B, 0xC9, 0x8B, 0x25, 0x5A, 0x05, 0x52,
+    0x66, 0x6A, 0x66, 0x5A, 0xA9, 0x8B, 0x86, 0x7A, 0xA6, 0x72, 0xC3, 0x51, 0xA3, 0x49, 0xA9, 0x9B, 0x2B, 0xBC, 0x04, 0x5A, 0xA4, 0x61, 0x25, 0x8A, 0xAA, 0xAB, 0x22, 0x59, 0xA4, 0x59, 0x46, 0x72, 0xA4, 0x71, 0xAD, 0xC4, 0x84, 0x59, 0xE4, 0x59, 0xE5, 0x61, 0xC5, 0x69, 0xC7, 0xAA, 0x4A, 0xAB, 0x05, 0x5A, 0xE5, 0x61, 0xE6, 0x69, 0xE8, 0xB2, 0x2B, 0xA3, 0x47, 0x6A, 0x47, 0x72, 0x66, 0x6A,
+    0xC1, 0x40, 0x43, 0x49, 0x06, 0x72, 0xC9, 0xA2, 0x03, 0x59, 0x02, 0x49, 0x05, 0x72, 0x23, 0x59, 0x64, 0x89, 0x65, 0xA1, 0x43, 0x61, 0x42, 0x61, 0x47, 0x8A, 0x06, 0x72, 0x43, 0x59, 0xA7, 0x72, 0x67, 0x9A, 0x68, 0xB2, 0x26, 0x8A, 0x08, 0x8B, 0xC4, 0x59, 0x83, 0x61, 0x69, 0xA3, 0xFF, 0xFF, 0x46, 0x62, 0x66, 0x6A, 0x86, 0x82, 0xFE, 0xFF, 0x66, 0x6A, 0x65, 0x72, 0xE8, 0x72, 0xA4, 0x62,
+    0xA6, 0x62, 0x27, 0x6B, 0x67, 0x6A, 0x0E, 0xAD, 0xE4, 0x59, 0xC4, 0x49, 0xE4, 0x41, 0x05, 0x42, 0x26, 0x52, 0x26, 0x62, 0xA4, 0x41, 0x49, 0x73, 0x48, 0x6B, 0xC8, 0x72, 0x04, 0x5A, 0xA4, 0x49, 0x85, 0x6A, 0x45, 0x52, 0xE8, 0x62, 0x67, 0x72, 0x66, 0x6A, 0x25, 0x5A, 0x46, 0x5A, 0x05, 0x6A, 0xA7, 0x7A, 0x66, 0x6A, 0xA4, 0x59, 0xA4, 0x61, 0x05, 0x82, 0x04, 0x72, 0x62, 0x49, 0x26, 0x6A,
+    0xC7, 0xA1, 0x46, 0x8A, 0xC5, 0x71, 0xA5, 0x59, 0xA8, 0x8A, 0xC6, 0x79, 0xA4, 0x79, 0xE8, 0xB1, 0xE6, 0x61, 0xE6, 0x59, 0xE6, 0x61, 0xE6, 0x79, 0xC6, 0x71, 0xE6, 0x79, 0x26, 0x72, 0x67, 0x7A, 0x06, 0x7A, 0xE2, 0x40, 0x23, 0x49, 0x06, 0x7A, 0xE2, 0x48, 0xC5, 0x59, 0x63, 0x59, 0x02, 0x51, 0x43, 0x61, 0x87, 0x7A, 0x22, 0x51, 0x43, 0x61, 0xA5, 0x81, 0xE9, 0x8A, 0x83, 0x61, 0x85, 0x81,
+    0xE9, 0xBA, 0xA5, 0x92, 0xDC, 0xFF, 0xE5, 0x71, 0x85, 0x79, 0x45, 0x8A, 0xFF, 0xFF, 0x04, 0x72, 0x05, 0x5A, 0xCB, 0x93, 0x26, 0x9B, 0x66, 0x62, 0x25, 0x52, 0x87, 0x6A, 0x05, 0x5A, 0x24, 0x62, 0x69, 0x7B, 0x86, 0x62, 0xC4, 0x59, 0xD4, 0xDE, 0x65, 0x62, 0x05, 0x52, 0xE4, 0x41, 0x05, 0x42, 0xE3, 0x41, 0x46, 0x6A, 0xA4, 0x41, 0x70, 0xCD, 0x90, 0xB5, 0x09, 0x83, 0x66, 0x6A, 0x04, 0x52,
+    0x25, 0x6A, 0x04, 0x62, 0xE4, 0x41, 0x09, 0x8B, 0x4A, 0x83, 0x50, 0xC5, 0x08, 0x6B, 0xE4, 0x59, 0x08, 0x8B, 0x29, 0x83, 0x63, 0x51, 0xA4, 0x61, 0x83, 0x51, 0x66, 0x62, 0x42, 0x49, 0x84, 0x51, 0x83, 0x59, 0x67, 0x6A, 0xF2, 0xFD, 0xC8, 0x92, 0x89, 0x8A, 0x46, 0x71, 0xEB, 0xDA, 0x84, 0x71, 0x46, 0x81, 0x06, 0x62, 0xC6, 0x61, 0x05, 0x72, 0x68, 0xB2, 0xA9, 0xA2, 0x67, 0x6A, 0x67, 0x72,
+    0xE6, 0x71, 0x02, 0x41, 0xE2, 0x48, 0x43, 0x89, 0x02, 0x51, 0x23, 0x49, 0x02, 0x59, 0xE8, 0x8A, 0x02, 0x59, 0xA4, 0x69, 0x43, 0x61, 0x84, 0x69, 0xC7, 0xA2, 0x05, 0x6A, 0xC5, 0x79, 0xA5, 0x99, 0xE9, 0xBA, 0x05, 0x9A, 0x44, 0x91, 0x87, 0x82, 0xB5, 0xFE, 0x9C, 0xFF, 0xE5, 0x79, 0xA4, 0x59, 0xE4, 0x51, 0xA7, 0x7A, 0x46, 0x6A, 0xC5, 0x51, 0x0B, 0x84, 0x67, 0x72, 0x77, 0xF7, 0x25, 0x62,
+    0xFF, 0xFF, 0x08, 0x73, 0xA7, 0x7A, 0x09, 0x8C, 0x08, 0x9B, 0x25, 0x5A, 0xE4, 0x49, 0x86, 0x5A, 0x86, 0x52, 0x87, 0x82, 0xA4, 0x41, 0x07, 0x8B, 0xC7, 0x6A, 0x0B, 0xA4, 0x45, 0x6A, 0x7A, 0xF7, 0x86, 0x82, 0xAD, 0xAC, 0xC4, 0x49, 0x27, 0x9B, 0xC8, 0x8A, 0x87, 0x6A, 0xA4, 0x51, 0x45, 0x7A, 0x46, 0x82, 0xE9, 0x82, 0x62, 0x51, 0x83, 0x61, 0x63, 0x59, 0x22, 0x49, 0xE4, 0x59, 0x63, 0x49,
+    0xA4, 0x61, 0x84, 0x49, 0xC4, 0x59, 0x63, 0x51, 0xE5, 0x71, 0xA5, 0x51, 0xA4, 0x59, 0xA3, 0x59, 0x84, 0x61, 0xA8, 0x9A, 0xCD, 0xB3, 0x06, 0x62, 0xC5, 0x69, 0x46, 0x5A, 0x46, 0x62, 0x88, 0x82, 0xA1, 0x40, 0x25, 0x72, 0x03, 0x51, 0xE2, 0x60, 0x64, 0x71, 0xE2, 0x50, 0xE8, 0x92, 0x02, 0x51, 0xA5, 0x81, 0xE2, 0x70, 0xE7, 0xD1, 0x09, 0xE3, 0x05, 0x7A, 0x43, 0x59, 0xE5, 0x79, 0xFF, 0xFF,
+    0x25, 0xB2, 0x68, 0xC2, 0xA4, 0x79, 0x85, 0x7A, 0x46, 0x7A, 0x46, 0x7A, 0xE5, 0x61, 0x45, 0x6A, 0x08, 0x73, 0x07, 0x8B, 0x87, 0x7A, 0x26, 0x6A, 0xD1, 0xBD, 0x46, 0x72, 0xEA, 0x9B, 0xA7, 0x7A, 0xCB, 0xAB, 0x66, 0x62, 0xE8, 0x82, 0x69, 0x9B, 0x92, 0xC5, 0x05, 0x52, 0xC4, 0x49, 0x26, 0x52, 0x04, 0x4A, 0xE5, 0x61, 0xA4, 0x49, 0xC7, 0x7A, 0x87, 0x6A, 0xE7, 0x7A, 0x66, 0x72, 0x05, 0x5A,
+    0x25, 0x7A, 0x84, 0x49, 0xC5, 0x49, 0xE7, 0x92, 0x85, 0x82, 0xA4, 0x51, 0xEC, 0xA3, 0xC8, 0x9A, 0xA7, 0xA2, 0xE9, 0x92, 0x63, 0x51, 0x69, 0x9B, 0x83, 0x71, 0x63, 0x61, 0x22, 0x49, 0xA4, 0x59, 0x49, 0xB3, 0x64, 0x59, 0x84, 0x59, 0x83, 0x51, 0x84, 0x69, 0x2A, 0xAB, 0x84, 0x59, 0x43, 0x69, 0xE4, 0x51, 0xA5, 0x59, 0xC5, 0x69, 0xE5, 0x59, 0xC5, 0x59, 0x25, 0x62, 0xC6, 0x81, 0x47, 0x72,
+    0x43, 0x61, 0x03, 0x49, 0xC2, 0x48, 0xE3, 0xA0, 0xFF, 0xFF, 0xA6, 0xA1, 0xE2, 0x58, 0x64, 0x69, 0x23, 0x91, 0xFF, 0xFF, 0xC6, 0xC1, 0x05, 0x7A, 0x64, 0x69, 0x43, 0x59, 0x70, 0xFD, 0xA7, 0x9A, 0x03, 0x81, 0xC5, 0xA9, 0xC5, 0x71, 0x28, 0x93, 0x10, 0xF5, 0x47, 0x82, 0xA4, 0x61, 0xCC, 0xD4, 0xC3, 0x59, 0x4C, 0xCC, 0x66, 0x82, 0xFF, 0xFF, 0xE5, 0x61, 0x46, 0x72, 0xEF, 0xCC, 0x93, 0xDD,
+    0x46, 0x6A, 0xE4, 0x51, 0x46, 0x6A, 0x0A, 0xA4, 0xA7, 0x72, 0xE5, 0x51, 0x83, 0x41, 0xA4, 0x39, 0xA9, 0x93, 0xC5, 0x69, 0x83, 0x41, 0x07, 0x73, 0x65, 0x5A, 0x89, 0x93, 0x46, 0x6A, 0xE4, 0x41, 0x25, 0x6A, 0x83, 0x49, 0x69, 0x8B, 0x05, 0x62, 0x24, 0x7A, 0xA4, 0x51, 0x83, 0x41, 0x48, 0x9B, 0xF2, 0xD4, 0x0A, 0x93, 0x84, 0x59, 0x01, 0x51, 0x08, 0x9B, 0x67, 0x82, 0x42, 0x51, 0x43, 0x49,
+    0xE6, 0x99, 0xC8, 0xAA, 0x24, 0x69, 0x64, 0x69, 0x63, 0x69, 0x24, 0x71, 0xAB, 0xD3, 0xC4, 0x69, 0xC4, 0x51, 0xE4, 0x51, 0x07, 0x92, 0xE8, 0xA2, 0xE6, 0x89, 0xC5, 0x71, 0x69, 0xAA, 0xE6, 0x79, 0xE2, 0x50, 0xC2, 0x40, 0xE3, 0x48, 0x03, 0x59, 0x23, 0x81, 0x05, 0x82, 0x02, 0x51, 0x02, 0x59, 0x43, 0x71, 0x26, 0xC2, 0x03, 0x69, 0x22, 0x61, 0xE2, 0x60, 0x02, 0x51, 0x67, 0x7A, 0x43, 0x61,
+    0x23, 0x71, 0x47, 0xA2, 0x28, 0x93, 0xA4, 0x69, 0xA4, 0x61, 0xCE, 0xEB, 0xFF, 0xFF, 0x26, 0x82, 0x83, 0x51, 0x85, 0x9A, 0xC7, 0xB2, 0x94, 0xCD, 0xC4, 0x51, 0x66, 0x7A, 0x08, 0x8B, 0x84, 0x9A, 0x28, 0x73, 0x87, 0x62, 0x05, 0x72, 0x89, 0x83, 0x25, 0x62, 0xE5, 0x51, 0x83, 0x41, 0x82, 0x39, 0x0B, 0x9C, 0x06, 0x72, 0x63, 0x41, 0x8B, 0x9B, 0x6C, 0xB4, 0xC8, 0x82, 0x87, 0x82, 0x8A, 0x73,
+    0xC4, 0x69, 0x26, 0x62, 0x83, 0x49, 0x26, 0x72, 0x26, 0x72, 0x0C, 0xAC, 0x63, 0x49, 0xA4, 0x69, 0x27, 0x7A, 0xCA, 0xB3, 0x01, 0x41, 0x43, 0x59, 0x22, 0x49, 0x0D, 0xDC, 0x46, 0x6A, 0x02, 0x49, 0xA5, 0x61, 0x63, 0x61, 0xFF, 0xFF, 0x65, 0x81, 0x84, 0x61, 0xC4, 0x59, 0xFF, 0xFF, 0x26, 0xAA, 0xC4, 0x51, 0xC4, 0x51, 0x88, 0x8A, 0x87, 0x8A, 0xAE, 0xFC, 0xA5, 0x79, 0x66, 0x7A, 0xC7, 0x91,
+    0xA1, 0x40, 0xE2, 0x40, 0x02, 0x49, 0xE5, 0x71, 0x64, 0x69, 0x47, 0x9A, 0x02, 0x51, 0x64, 0x69, 0xE4, 0x71, 0xA5, 0x81, 0x23, 0x61, 0x64, 0x71, 0x66, 0x82, 0xE5, 0x71, 0x64, 0x69, 0x23, 0x61, 0x43, 0x81, 0xD3, 0xDD, 0x06, 0x8A, 0x63, 0x61, 0x64, 0x71, 0x35, 0xF6, 0x66, 0xB2, 0xC4, 0x71, 0x83, 0x51, 0x06, 0x7A, 0xCD, 0xD4, 0xE4, 0x59, 0x66, 0x62, 0x05, 0x72, 0x08, 0x8B, 0xE4, 0x69,
+    0xA3, 0x49, 0x05, 0x5A, 0xE5, 0x69, 0x2B, 0xAC, 0x26, 0x72, 0x84, 0x49, 0x63, 0x41, 0xA4, 0x49, 0xC9, 0xA3, 0x63, 0x69, 0x83, 0x49, 0x86, 0x8A, 0xEA, 0xAB, 0x6A, 0xA3, 0xC8, 0x8A, 0x05, 0x7A, 0xE4, 0x79, 0xE7, 0x92, 0x63, 0x49, 0x05, 0x8A, 0x4A, 0xA3, 0x28, 0x9B, 0x63, 0x51, 0x05, 0x7A, 0x09, 0xA3, 0x0A, 0x9B, 0x07, 0x9B, 0x67, 0x8A, 0x84, 0x61, 0x84, 0x61, 0x86, 0x9A, 0x88, 0x8A,
+    0x64, 0x59, 0x22, 0x49, 0x43, 0x51, 0xA8, 0xD1, 0x63, 0x51, 0x63, 0x51, 0x83, 0x61, 0xA9, 0xAA, 0x6C, 0xDB, 0xC4, 0x51, 0xA4, 0x59, 0x05, 0x5A, 0x22, 0x41, 0x47, 0x7A, 0xA5, 0x71, 0xC6, 0x81, 0xC2, 0x40, 0xC2, 0x48, 0xC2, 0x40, 0x23, 0x51, 0xE2, 0x58, 0x84, 0x71, 0xE2, 0x50, 0x02, 0x51, 0xC4, 0x71, 0x06, 0x92, 0xE2, 0x68, 0xA4, 0x99, 0x06, 0x7A, 0x02, 0x59, 0x44, 0x71, 0x84, 0x99,
+    0x83, 0x99, 0x05, 0xAA, 0x64, 0x61, 0xA4, 0x69, 0xE5, 0x81, 0xE4, 0x99, 0xE4, 0x79, 0x84, 0x59, 0xE8, 0x7A, 0x25, 0x82, 0xC4, 0x71, 0xE4, 0x59, 0x45, 0x62, 0x05, 0x6A, 0x4F, 0xD5, 0x26, 0x7A, 0xE5, 0x61, 0xE4, 0x51, 0xE4, 0x61, 0x32, 0xDE, 0xA7, 0x9A, 0xC4, 0x51, 0x84, 0x49, 0xA3, 0x41, 0xCA, 0xB3, 0x83, 0x71, 0xA4, 0x51, 0x28, 0x93, 0xA5, 0x82, 0x08, 0x93, 0xC8, 0x92, 0xC5, 0x61,
+    0x87, 0x9A, 0xF0, 0xED, 0xC3, 0x49, 0x05, 0x82, 0x67, 0xA2, 0x46, 0x6A, 0xED, 0xCC, 0x06, 0x8A, 0x88, 0xA2, 0x2A, 0xA3, 0xC1, 0x48, 0x08, 0xAB, 0xA4, 0x89, 0x84, 0x71, 0xA5, 0x71, 0xA1, 0x40, 0x22, 0x79, 0x02, 0x51, 0x03, 0x49, 0x05, 0x7A, 0xC9, 0xD2, 0x23, 0x51, 0x83, 0x51, 0xA4, 0x61, 0xA4, 0x51, 0x2D, 0xEC, 0x42, 0x51, 0xE4, 0x51, 0x43, 0x51, 0xA5, 0x71, 0xA6, 0x81, 0x06, 0x8A,
+    0xA1, 0x50, 0xE5, 0x79, 0xE2, 0x48, 0xE3, 0x58, 0xC2, 0x68, 0xE2, 0x70, 0x27, 0x92, 0xE4, 0x69, 0xE2, 0x68, 0x25, 0x91, 0x84, 0xA1, 0x06, 0xAA, 0x22, 0x69, 0xE2, 0x58, 0x43, 0x79, 0x2B, 0xFB, 0x85, 0xB9, 0x64, 0x89, 0xC4, 0x61, 0xE7, 0x7A, 0x64, 0x69, 0x06, 0x82, 0x43, 0x61, 0x28, 0x8B, 0x63, 0x51, 0x83, 0x69, 0x05, 0x82, 0x33, 0xFE, 0x84, 0x61, 0xE5, 0x71, 0xEC, 0xCB, 0xD4, 0xED,
+    0xA6, 0x82, 0xC5, 0x59, 0xA4, 0x69, 0x45, 0x92, 0x28, 0xAB, 0xC5, 0x59, 0x63, 0x49, 0xE4, 0x59, 0x0C, 0x8C, 0x84, 0x69, 0x63, 0x49, 0x09, 0x93, 0xD0, 0xEC, 0x87, 0x7A, 0x26, 0x72, 0xC4, 0x61, 0xDD, 0xFF, 0x22, 0x51, 0x83, 0x49, 0x06, 0x82, 0x1A, 0xFF, 0x83, 0x59, 0x86, 0x62, 0x83, 0x69, 0xFF, 0xFF, 0x46, 0x82, 0xE1, 0x48, 0x06, 0x82, 0xA6, 0xC1, 0x84, 0x91, 0x84, 0x71, 0xE2, 0x48,
+    0x25, 0xA1, 0x02, 0x61, 0x03, 0x51, 0x64, 0x69, 0x03, 0x59, 0x43, 0x59, 0x43, 0x59, 0x84, 0x61, 0x84, 0x49, 0xE4, 0x51, 0x43, 0x61, 0xA4, 0x69, 0xA4, 0x59, 0xE5, 0x59, 0x4D, 0xF4, 0xA5, 0x71, 0xC3, 0xA8, 0xE2, 0x50, 0xE2, 0x50, 0xC3, 0x68, 0xFF, 0xFF, 0x24, 0xA9, 0x24, 0x69, 0xC2, 0x58, 0x05, 0x89, 0xFF, 0xFF, 0x45, 0xD1, 0x03, 0x71, 0x23, 0x69, 0x22, 0x61, 0xFE, 0xFF, 0xE3, 0x78,
+    0xC5, 0x91, 0x84, 0x81, 0x29, 0x93, 0xA4, 0x71, 0x07, 0xD3, 0x64, 0x79, 0xA7, 0xBA, 0x43, 0x61, 0xA4, 0x61, 0x8A, 0xDB, 0x88, 0xB2, 0xB7, 0xFE, 0xC3, 0x59, 0xC8, 0xA2, 0x28, 0xB3, 0xFF, 0xFF, 0xE8, 0x7A, 0xE9, 0x7A, 0xC4, 0x61, 0xCC, 0xEB, 0xC8, 0x82, 0xA4, 0x51, 0x64, 0x49, 0xC3, 0x49, 0x89, 0x9B, 0x63, 0x61, 0x63, 0x49, 0x26, 0x72, 0x0A, 0xB4, 0x68, 0x9B, 0x26, 0x72, 0x28, 0x73,
+    0x25, 0x8A, 0xE5, 0x61, 0x49, 0x9B, 0x62, 0x59, 0x0A, 0x93, 0x09, 0xA3, 0x23, 0x41, 0x08, 0x9B, 0x06, 0x72, 0xFF, 0xFF, 0x05, 0x62, 0x84, 0x71, 0x66, 0xAA, 0x55, 0xFE, 0xE5, 0x81, 0x23, 0x59, 0xC2, 0x48, 0x06, 0xBA, 0x89, 0xEA, 0xC2, 0x70, 0xC3, 0x58, 0x24, 0x79, 0x2A, 0xEB, 0x24, 0x79, 0x84, 0x51, 0xA4, 0x51, 0x64, 0x61, 0xE7, 0x99, 0x45, 0xB9, 0xC4, 0x59, 0x25, 0x6A, 0xE2, 0x80,
+    0xC2, 0x60, 0xC2, 0x50, 0xA2, 0x50, 0xC3, 0x60, 0xC3, 0x80, 0x82, 0x60, 0xC2, 0x60, 0xC2, 0x58, 0x25, 0x71, 0x05, 0xA1, 0xE3, 0x88, 0xA1, 0x70, 0x43, 0x61, 0xE2, 0x58, 0xE3, 0x60, 0xE2, 0x58, 0x84, 0x89, 0xA5, 0x89, 0x84, 0x69, 0x63, 0x61, 0x84, 0x69, 0x87, 0xC9, 0x09, 0xDB, 0x85, 0x69, 0x43, 0x69, 0x83, 0x79, 0xCF, 0xFC, 0xE5, 0x81, 0xA7, 0x7A, 0x47, 0xA2, 0x69, 0x93, 0xEB, 0xCB,
+    0xC8, 0x7A, 0xA4, 0x51, 0x83, 0x51, 0x4C, 0xCC, 0xC4, 0x69, 0x83, 0x49, 0x84, 0x49, 0xA3, 0x41, 0xE7, 0x7A, 0xC5, 0x79, 0x83, 0x49, 0x63, 0x59, 0x6C, 0xBC, 0x26, 0x82, 0x06, 0x7A, 0x87, 0x6A, 0x66, 0x82, 0x2C, 0xCC, 0x43, 0x51, 0x84, 0x71, 0xA7, 0x8A, 0x89, 0xB3, 0x42, 0x41, 0xE5, 0x71, 0x47, 0x8A, 0x25, 0x72, 0x48, 0xBB, 0xA4, 0x61, 0x22, 0x61, 0x84, 0x71, 0xAB, 0xE3, 0xA4, 0x61,
+    0xC2, 0x40, 0xC2, 0x48, 0x86, 0x79, 0x24, 0x91, 0x23, 0x49, 0x45, 0x61, 0x85, 0x91, 0x01, 0x70, 0xE5, 0x59, 0xA4, 0x51, 0x63, 0x51, 0xC4, 0x59, 0xC5, 0x61, 0x27, 0x7A, 0xC4, 0x59, 0xC5, 0x79, 0xA1, 0x48, 0xC2, 0x50, 0x03, 0x59, 0x05, 0x7A, 0xC3, 0x58, 0xA3, 0x58, 0xE3, 0x78, 0xC2, 0x58, 0x26, 0x8A, 0xC3, 0x60, 0x85, 0x81, 0xE2, 0x70, 0xE8, 0x9A, 0x03, 0x61, 0x03, 0x61, 0x23, 0x71,
+    0x64, 0x99, 0x4B, 0xF3, 0x23, 0x59, 0x63, 0x61, 0xA4, 0x79, 0xE7, 0xE1, 0xE7, 0xB1, 0x23, 0x59, 0xA3, 0x59, 0x64, 0x71, 0xE8, 0xBA, 0xA4, 0x69, 0x42, 0x51, 0xE6, 0x79, 0x46, 0x82, 0xC5, 0x69, 0x84, 0x51, 0xA4, 0x59, 0x63, 0x61, 0xA4, 0x61, 0xC5, 0x71, 0x42, 0x41, 0x63, 0x49, 0x63, 0x49, 0x63, 0x51, 0xC4, 0x71, 0x63, 0x49, 0x42, 0x61, 0x45, 0x82, 0xAB, 0xB3, 0xC5, 0x71, 0x84, 0x59,
+    0x2B, 0xBB, 0x87, 0x72, 0x63, 0x49, 0x23, 0x71, 0xA5, 0x89, 0x84, 0x61, 0x23, 0x49, 0x43, 0x61, 0x05, 0x92, 0x06, 0x7A, 0xE5, 0x79, 0xC6, 0x81, 0x63, 0x79, 0x23, 0x61, 0xE2, 0x50, 0x64, 0x61, 0xC2, 0x40, 0x64, 0x61, 0xA2, 0x48, 0x45, 0x59, 0xE2, 0x48, 0x84, 0x59, 0x23, 0x59, 0x24, 0x49, 0x84, 0x49, 0xA4, 0x51, 0x63, 0x51, 0x84, 0x51, 0xC5, 0x51, 0xE5, 0x59, 0xC5, 0x59, 0xC5, 0x69,
+    0xA3, 0x58, 0x05, 0xA1, 0xE7, 0x89, 0xA3, 0x50, 0xC3, 0x58, 0x82, 0x58, 0xAA, 0xCA, 0x84, 0x79, 0xC3, 0x58, 0xC2, 0x60, 0x69, 0xB2, 0xE9, 0xEA, 0xC2, 0x60, 0x03, 0x61, 0x03, 0x71, 0x27, 0xDA, 0x0C, 0xFC, 0xA6, 0x91, 0x03, 0x59, 0x87, 0x82, 0x25, 0xC1, 0x48, 0xEA, 0x84, 0x81, 0xE5, 0x71, 0x83, 0x51, 0xE8, 0xBA, 0xA4, 0x71, 0x84, 0x59, 0x43, 0x61, 0x05, 0x72, 0x49, 0xB3, 0xA4, 0x79,
+    0x63, 0x51, 0x84, 0x59, 0x64, 0x61, 0x8A, 0xBB, 0x26, 0x92, 0x63, 0x49, 0x63, 0x49, 0xA4, 0x51, 0x07, 0xAB, 0x06, 0x82, 0x63, 0x49, 0x63, 0x61, 0x98, 0xFE, 0x67, 0x9A, 0x47, 0x82, 0x64, 0x79, 0xFF, 0xFF, 0x28, 0xAB, 0x43, 0x49, 0x44, 0x69, 0x78, 0xE6, 0x02, 0x51, 0x08, 0xA3, 0x43, 0x59, 0xFF, 0xFF, 0x84, 0x71, 0x22, 0x59, 0xA7, 0xA2, 0xD1, 0xED, 0xE2, 0x68, 0x02, 0x61, 0xA3, 0x60,
+    0xD4, 0xED, 0x24, 0x61, 0xE3, 0x58, 0x03, 0x51, 0x67, 0xC2, 0x02, 0x49, 0x03, 0x51, 0x03, 0x49, 0x43, 0x49, 0x88, 0xB2, 0x44, 0x69, 0x84, 0x51, 0xA4, 0x51, 0xC5, 0x51, 0x68, 0xFA, 0x89, 0xA2, 0x82, 0x70, 0x0B, 0xEB, 0xA3, 0x58, 0xA3, 0x60, 0x04, 0x71, 0x05, 0x79, 0x46, 0xA9, 0x66, 0x79, 0xC4, 0x60, 0x05, 0x81, 0x87, 0xB1, 0x86, 0xB1, 0xC2, 0x60, 0x82, 0x58, 0x47, 0x92, 0x45, 0xC9,
+    0x64, 0xB9, 0xE4, 0x68, 0xE5, 0x71, 0x02, 0x59, 0x23, 0x79, 0x86, 0x91, 0xA4, 0x79, 0xC4, 0x71, 0x84, 0x51, 0xE4, 0x79, 0x44, 0x79, 0x48, 0xC3, 0xC5, 0x71, 0x63, 0x69, 0x43, 0x71, 0xFD, 0xFF, 0x42, 0x69, 0x84, 0x51, 0x84, 0x81, 0xB1, 0xFD, 0x67, 0xA2, 0x63, 0x51, 0x84, 0x51, 0x63, 0x61, 0x0F, 0xFD, 0xC8, 0xA2, 0x63, 0x49, 0xB0, 0xF4, 0x56, 0xFF, 0xE6, 0x71, 0xE5, 0x69, 0x84, 0x59,
+    0x26, 0xD2, 0x43, 0x61, 0x43, 0x49, 0x85, 0x69, 0x6A, 0xDA, 0x23, 0x71, 0x43, 0x49, 0x02, 0x49, 0x43, 0x79, 0x3A, 0xFF, 0x23, 0x51, 0xA1, 0x48, 0xE6, 0x99, 0xCB, 0xF3, 0x03, 0x79, 0xE2, 0x48, 0xC2, 0x48, 0x2A, 0xFB, 0xE4, 0x90, 0xE3, 0x50, 0xE2, 0x48, 0x49, 0xA2, 0x64, 0xA1, 0x02, 0x49, 0x43, 0x41, 0x22, 0x41, 0x43, 0x59, 0xA6, 0xB1, 0xA5, 0x61, 0xC5, 0x59, 0xA5, 0x61, 0xAC, 0xFB,
+    0x41, 0xB0, 0x41, 0x60, 0x83, 0x58, 0xA3, 0x68, 0xFF, 0xFF, 0x67, 0xE9, 0xE4, 0x78, 0x04, 0x69, 0xC3, 0x78, 0xFF, 0xFF, 0x67, 0xF1, 0x44, 0x91, 0xE2, 0x60, 0x03, 0x69, 0x5A, 0xFF, 0x04, 0xC1, 0xC8, 0xA1, 0x03, 0x61, 0x43, 0x61, 0x23, 0x61, 0x87, 0xD2, 0xC7, 0x91, 0x85, 0x81, 0x44, 0x61, 0x83, 0x59, 0x51, 0xF5, 0x46, 0x91, 0xA6, 0x89, 0xA4, 0x61, 0xE5, 0x69, 0xCA, 0xD3, 0x06, 0xB2,
+    0xA4, 0x61, 0xA4, 0x51, 0xC4, 0x61, 0x69, 0xC3, 0xC9, 0x9A, 0x84, 0x51, 0x84, 0x51, 0xA4, 0x59, 0x08, 0x9B, 0xA4, 0x59, 0x63, 0x41, 0x63, 0x49, 0x44, 0x99, 0x48, 0x9B, 0x83, 0x51, 0x83, 0x49, 0x66, 0x81, 0x63, 0x51, 0xE8, 0x92, 0x23, 0x51, 0xA4, 0x69, 0xA6, 0x91, 0x43, 0x41, 0xE7, 0x92, 0x83, 0x59, 0x02, 0x71, 0x43, 0x51, 0x02, 0x41, 0xA8, 0x9A, 0x43, 0x71, 0x46, 0xA2, 0x02, 0x49,
+    0xE2, 0x40, 0x46, 0x92, 0xE4, 0x58, 0xE2, 0x40, 0xE2, 0x40, 0x03, 0x41, 0x47, 0x92, 0x02, 0x49, 0x02, 0x41, 0x43, 0x41, 0x43, 0x41, 0x68, 0x82, 0x83, 0x49, 0x84, 0x51, 0xA5, 0x59, 0x65, 0x61, 0x83, 0x70, 0x82, 0x60, 0x82, 0x58, 0x25, 0x71, 0x04, 0x91, 0xE4, 0x78, 0xC3, 0x78, 0xC3, 0x60, 0x27, 0x92, 0xA2, 0x90, 0xC3, 0x88, 0x66, 0xA9, 0xE2, 0x60, 0x23, 0x61, 0x03, 0x69, 0xE3, 0x70,
+    0xAB, 0xC2, 0x87, 0x92, 0x03, 0x59, 0x23, 0x59, 0xC6, 0x81, 0x46, 0xD9, 0x4C, 0xEB, 0x64, 0x61, 0x84, 0x59, 0xC5, 0x89, 0xFF, 0xFF, 0x85, 0x91, 0x84, 0x71, 0xE5, 0x71, 0xC4, 0xA1, 0x7D, 0xFF, 0xE5, 0x59, 0xE4, 0x51, 0xA3, 0x51, 0xAB, 0xFB, 0xE5, 0x69, 0xA4, 0x59, 0x83, 0x41, 0xA4, 0x49, 0x8A, 0xAB, 0xA4, 0x59, 0x63, 0x41, 0x63, 0x49, 0x45, 0x82, 0xC5, 0x59, 0x84, 0x51, 0x84, 0x49,
+    0x06, 0x62, 0xCB, 0xC3, 0x43, 0x41, 0x64, 0x51, 0x64, 0x59, 0x29, 0xAB, 0x43, 0x49, 0x02, 0x49, 0x63, 0x51, 0x02, 0x49, 0x87, 0xB2, 0xE2, 0x40, 0xE2, 0x40, 0x22, 0x51, 0x03, 0x59, 0x02, 0x41, 0xE2, 0x48, 0x03, 0x59, 0xA3, 0x38, 0x68, 0xBA, 0xA1, 0x30, 0xC1, 0x38, 0xC2, 0x40, 0x81, 0x40, 0x02, 0x49, 0x43, 0x39, 0x43, 0x41, 0x63, 0x41, 0x84, 0x49, 0xE6, 0x71, 0xA4, 0x59, 0xC4, 0x59,
+    0xC4, 0x58, 0x86, 0x91, 0xE4, 0x70, 0xA2, 0x58, 0xA2, 0x58, 0xA3, 0x60, 0x86, 0xA1, 0xC3, 0x70, 0xA2, 0x60, 0xE3, 0x68, 0xC2, 0x70, 0x24, 0xA1, 0x03, 0x69, 0x23, 0x69, 0x03, 0x61, 0xC3, 0x78, 0x45, 0xA1, 0x03, 0x69, 0x24, 0x59, 0x04, 0x59, 0x65, 0x81, 0xCC, 0xF3, 0xA4, 0xA1, 0x44, 0x61, 0x64, 0x59, 0x84, 0x71, 0x84, 0x79, 0x84, 0x69, 0xE4, 0x90, 0x84, 0x61, 0xA5, 0x71, 0x84, 0x69,
+    0x84, 0x59, 0xA4, 0x49, 0xC4, 0x51, 0x2B, 0xC4, 0xA4, 0x51, 0x83, 0x49, 0xC4, 0x49, 0xA4, 0x41, 0xC4, 0x49, 0x64, 0x59, 0xA4, 0x49, 0x84, 0x51, 0xA4, 0x49, 0xA5, 0x51, 0x84, 0x51, 0x65, 0x49, 0x84, 0x59, 0x42, 0x41, 0x44, 0x41, 0x43, 0x51, 0x64, 0x51, 0x43, 0x49, 0x02, 0x49, 0x06, 0x6A, 0x23, 0x49, 0x02, 0x41, 0x22, 0x41, 0x02, 0x49, 0xE2, 0x38, 0x03, 0x49, 0x22, 0x49, 0xC1, 0x38,
+    0x60, 0x38, 0xC2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0x88, 0xB2, 0x60, 0x38, 0xC1, 0x38, 0xE2, 0x38, 0x02, 0x39, 0x84, 0x69, 0x22, 0x39, 0x84, 0x41, 0x84, 0x41, 0x83, 0x49, 0x83, 0x51, 0xC6, 0x61, 0xA3, 0x60, 0x76, 0xF6, 0x69, 0xE2, 0xC3, 0x60, 0xC2, 0x58, 0x83, 0x70, 0xFF, 0xFF, 0xC4, 0xA0, 0xC3, 0x60, 0xC3, 0x68, 0xA2, 0x78, 0xFF, 0xFF, 0xE3, 0x68, 0x0A, 0xA3, 0x03, 0x69, 0x25, 0xC9,
+    0xFF, 0xFF, 0x03, 0x71, 0x03, 0x59, 0x43, 0x69, 0x44, 0xA9, 0xDD, 0xFF, 0x04, 0x69, 0x45, 0x61, 0x43, 0x59, 0xF9, 0xFE, 0xA4, 0x81, 0x63, 0x51, 0x04, 0x81, 0x44, 0x79, 0x69, 0xBB, 0xA4, 0x51, 0x84, 0x61, 0xA4, 0x49, 0x63, 0x49, 0xAA, 0xAB, 0x84, 0x59, 0xA4, 0x51, 0xA4, 0x49, 0xC4, 0x51, 0x89, 0xAB, 0xA4, 0x59, 0x84, 0x49, 0xA4, 0x59, 0x44, 0x69, 0xA3, 0x59, 0xA4, 0x51, 0x86, 0x51,
+    0x85, 0x51, 0x83, 0x49, 0x44, 0x49, 0x84, 0x51, 0x64, 0x59, 0x23, 0x49, 0x28, 0x9B, 0x43, 0x49, 0x23, 0x49, 0x23, 0x41, 0x02, 0x39, 0xC8, 0x9A, 0x02, 0x49, 0x03, 0x49, 0x22, 0x49, 0xE2, 0x38, 0x02, 0x41, 0x02, 0x39, 0xE2, 0x40, 0xC2, 0x38, 0xC3, 0x40, 0xC2, 0x38, 0xE2, 0x38, 0xE2, 0x38, 0xE2, 0x38, 0xE2, 0x38, 0x22, 0x39, 0x43, 0x39, 0x22, 0x39, 0x83, 0x41, 0x83, 0x49, 0xA5, 0x59,
+    0xE4, 0x78, 0x45, 0xB1, 0xC3, 0x68, 0x25, 0x71, 0xE5, 0x80, 0xC4, 0x98, 0x62, 0x98, 0xC3, 0x78, 0xE3, 0x68, 0xC2, 0x78, 0xD0, 0xFC, 0xE7, 0xC9, 0x02, 0x61, 0x03, 0x61, 0xE3, 0x70, 0x6A, 0xDB, 0xA6, 0xB9, 0x03, 0x61, 0x23, 0x59, 0x03, 0x59, 0xE6, 0xA9, 0x24, 0x71, 0x04, 0x59, 0x63, 0x61, 0x44, 0x59, 0xA7, 0x9A, 0x44, 0x59, 0x63, 0x51, 0x44, 0x59, 0x64, 0x59, 0x41, 0x51, 0x84, 0x51,
+    0xA4, 0x59, 0x84, 0x59, 0x84, 0x51, 0x26, 0x7A, 0x05, 0x7A, 0xC5, 0x51, 0xE5, 0x51, 0x25, 0x6A, 0xE7, 0x92, 0xA4, 0x61, 0xC4, 0x51, 0x87, 0x82, 0x87, 0xBA, 0xC4, 0x59, 0xE5, 0x61, 0xE6, 0x69, 0xA1, 0x60, 0xA4, 0x59, 0x84, 0x51, 0x23, 0x51, 0x41, 0x98, 0xE3, 0x60, 0x02, 0x51, 0x02, 0x49, 0xA1, 0x60, 0x02, 0x49, 0x02, 0x41, 0x02, 0x41, 0x04, 0x79, 0xE2, 0x48, 0xE2, 0x38, 0xE2, 0x40,
+    0xA1, 0x40, 0x23, 0x59, 0xE2, 0x38, 0xE2, 0x40, 0xE3, 0x58, 0x47, 0x7A, 0xE2, 0x40, 0xE2, 0x38, 0x02, 0x39, 0xC1, 0x30, 0xA9, 0x7A, 0x64, 0x51, 0x22, 0x39, 0x43, 0x41, 0x43, 0x41, 0x84, 0x49, 0x65, 0xB9, 0x04, 0x71, 0xC2, 0x50, 0x09, 0xA2, 0xDD, 0xFF, 0x09, 0xFA, 0xC3, 0x68, 0xA1, 0x58, 0xC3, 0x78, 0x9C, 0xFF, 0x69, 0xFA, 0xC3, 0x78, 0xE2, 0x58, 0x02, 0x61, 0x44, 0xD1, 0xC6, 0xE1,
+    0x44, 0x71, 0x23, 0x59, 0x23, 0x51, 0x43, 0x51, 0xA9, 0xCA, 0x24, 0x51, 0x44, 0x59, 0xA4, 0x59, 0x63, 0x51, 0x08, 0xB3, 0x04, 0x61, 0x63, 0x59, 0x63, 0x51, 0x83, 0x51, 0x49, 0xAB, 0x85, 0x61, 0xC4, 0x59, 0xA4, 0x59, 0xC5, 0x59, 0x48, 0xA3, 0x47, 0x92, 0xE5, 0x59, 0x25, 0x5A, 0xE7, 0x92, 0x08, 0x93, 0xA4, 0x61, 0x25, 0x5A, 0x25, 0x72, 0x6A, 0xEB, 0x08, 0x9B, 0x43, 0x59, 0x25, 0x82,
+    0x60, 0x70, 0xA4, 0x69, 0x08, 0x93, 0x24, 0x89, 0x61, 0x88, 0xE4, 0x80, 0x23, 0x51, 0xA8, 0x8A, 0x40, 0x70, 0x44, 0x69, 0x02, 0x49, 0x44, 0x59, 0x47, 0x8A, 0x03, 0x51, 0xE2, 0x48, 0xE2, 0x40, 0xE2, 0x60, 0x48, 0x92, 0xE2, 0x48, 0xE2, 0x40, 0xE5, 0x68, 0xC4, 0x50, 0x27, 0x8A, 0xE2, 0x38, 0xE2, 0x38, 0xE2, 0x38, 0xC2, 0x38, 0x68, 0x82, 0x22, 0x39, 0x43, 0x41, 0x84, 0x41, 0x83, 0x49,
 };
 const lv_img_dsc_t ui_img_sinus_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_sinus_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_sinus_80_png_data
 };
 
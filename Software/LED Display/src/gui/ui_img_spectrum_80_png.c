@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Spectrum_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_spectrum_80_png_data[] = {
-    0xC2, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xC5, 0x79, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0x23, 0x59, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0xE3, 0x48, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x24, 0x49, 0xFF, 0x84, 0x51, 0xFF, 0x84, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0xA5, 0x59, 0xFF, 0xE5, 0x61, 0xFF, 0xC5, 0x59, 0xFF, 0xA5, 0x59, 0xFF, 0xC6, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0x62, 0xFF, 0xE6, 0x61, 0xFF, 0xE6, 0x59, 0xFF, 0x8F, 0x62, 0xFF, 0x06, 0x62, 0xFF, 0xE6, 0x59, 0xFF, 0xC6, 0x59, 0xFF, 0xE6, 0x59, 0xFF, 0x27, 0x62, 0xFF, 0xE6, 0x59, 0xFF, 0xA6, 0x51, 0xFF, 0xC6, 0x59, 0xFF, 0x07, 0x5A, 0xFF, 0xE7, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0x85, 0x51, 0xFF, 0x85, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x64, 0x51, 0xFF, 0x44, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x44, 0x49, 0xFF, 0x44, 0x49, 0xFF, 0x03, 0x41, 0xFF, 0x23, 0x41, 0xFF, 0x03, 0x41, 0xFF,
-    0x43, 0x49, 0xFF, 0x03, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x41, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x64, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0xA2, 0x38, 0xFF, 0x84, 0x71, 0xFF, 0x23, 0x51, 0xFF, 0x81, 0x38, 0xFF, 0xE3, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0x64, 0x61, 0xFF, 0xC2, 0x40, 0xFF, 0x03, 0x59, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0x65, 0x59, 0xFF, 0xC5, 0x71, 0xFF, 0xA1, 0x38, 0xFF, 0xE3, 0x50, 0xFF, 0xE3, 0x48, 0xFF, 0x24, 0x51, 0xFF, 0x87, 0x92, 0xFF, 0x03, 0x49, 0xFF, 0xE3, 0x40, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x67, 0x8A, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x09, 0x93, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x51, 0xFF, 0xA5, 0x59, 0xFF, 0xA5, 0x59, 0xFF, 0x2C, 0xBC, 0xFF, 0x26, 0x6A, 0xFF, 0x06, 0x62, 0xFF, 0xE5, 0x59, 0xFF, 0xE6, 0x59, 0xFF, 0xCB, 0xAB, 0xFF, 0x26, 0x62, 0xFF, 0xE6, 0x59, 0xFF, 0xC5, 0x59, 0xFF, 0xE6, 0x59, 0xFF, 0x4D, 0xBC, 0xFF, 0xE7, 0x61, 0xFF, 0xE6, 0x59, 0xFF, 0xC6, 0x59, 0xFF, 0xC7, 0x59, 0xFF,
-    0xE8, 0x59, 0xFF, 0xA4, 0x61, 0xFF, 0xA6, 0x51, 0xFF, 0x85, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0x65, 0x51, 0xFF, 0x2A, 0xA3, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x44, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0xE8, 0x9A, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x41, 0xFF, 0x03, 0x41, 0xFF, 0x23, 0x41, 0xFF, 0x03, 0x41, 0xFF, 0x63, 0x59, 0xFF, 0x03, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x02, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x87, 0x92, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x59, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0xE2, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0xC3, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0xC2, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0xC5, 0x61, 0xFF, 0xA5, 0x59, 0xFF, 0xC5, 0x61, 0xFF,
-    0xC5, 0x61, 0xFF, 0x71, 0xE5, 0xFF, 0x33, 0x6B, 0xFF, 0x26, 0x6A, 0xFF, 0x06, 0x62, 0xFF, 0x06, 0x62, 0xFF, 0xA8, 0x8A, 0xFF, 0x48, 0x6A, 0xFF, 0x06, 0x62, 0xFF, 0x07, 0x62, 0xFF, 0xCA, 0x82, 0xFF, 0x10, 0xCD, 0xFF, 0xE6, 0x59, 0xFF, 0xE7, 0x61, 0xFF, 0xE7, 0x61, 0xFF, 0x27, 0x62, 0xFF, 0x2A, 0x62, 0xFF, 0xA5, 0x71, 0xFF, 0xE8, 0x69, 0xFF, 0xC6, 0x61, 0xFF, 0x86, 0x59, 0xFF, 0x85, 0x59, 0xFF, 0xA5, 0x61, 0xFF, 0x84, 0x59, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x43, 0x49, 0xFF, 0xE8, 0x9A, 0xFF, 0x64, 0x61, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0xE5, 0x69, 0xFF, 0xE5, 0x69, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0xC6, 0x61, 0xFF, 0x88, 0x7A, 0xFF, 0x03, 0x49, 0xFF, 0xE5, 0x79, 0xFF, 0x85, 0x59, 0xFF, 0x23, 0x49, 0xFF, 0x64, 0x61, 0xFF, 0x44, 0x51, 0xFF, 0x09, 0xAB, 0xFF, 0xE2, 0x48, 0xFF, 0x23, 0x51, 0xFF, 0x64, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0x03, 0x41, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0x86, 0x81, 0xFF, 0xE3, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xE6, 0x89, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0x64, 0x69, 0xFF, 0xE3, 0x40, 0xFF, 0xE2, 0x48, 0xFF,
-    0xE3, 0x48, 0xFF, 0x03, 0x49, 0xFF, 0x06, 0x7A, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x43, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0xC7, 0x92, 0xFF, 0x44, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0xA5, 0x59, 0xFF, 0x64, 0x51, 0xFF, 0x8A, 0xA3, 0xFF, 0xE6, 0x61, 0xFF, 0xC5, 0x59, 0xFF, 0xC5, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0xC9, 0x9B, 0xFF, 0x06, 0x6A, 0xFF, 0x06, 0x62, 0xFF, 0x06, 0x62, 0xFF, 0x26, 0x62, 0xFF, 0x2C, 0xAC, 0xFF, 0x27, 0x62, 0xFF, 0x27, 0x62, 0xFF, 0x27, 0x62, 0xFF, 0x47, 0x6A, 0xFF, 0xB4, 0xDD, 0xFF, 0x29, 0x62, 0xFF, 0x08, 0x5A, 0xFF, 0x28, 0x62, 0xFF, 0x28, 0x62, 0xFF, 0x34, 0xC5, 0xFF, 0x29, 0x62, 0xFF, 0x08, 0x5A, 0xFF, 0xA6, 0x59, 0xFF, 0xA6, 0x59, 0xFF, 0x0A, 0x93, 0xFF, 0x65, 0x51, 0xFF, 0x65, 0x59, 0xFF, 0x44, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x49, 0xFF, 0xA5, 0x61, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x41, 0xFF, 0x03, 0x41, 0xFF, 0xE2, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0xE3, 0x48, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x84, 0x59, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF,
-    0xE3, 0x40, 0xFF, 0xA2, 0x30, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x63, 0x59, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xC6, 0x61, 0xFF, 0xE6, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0xE5, 0x61, 0xFF, 0xE5, 0x61, 0xFF, 0x27, 0x6A, 0xFF, 0x27, 0x6A, 0xFF, 0x06, 0x62, 0xFF, 0x06, 0x62, 0xFF, 0x67, 0x6A, 0xFF, 0xF0, 0xBC, 0xFF, 0x68, 0x6A, 0xFF, 0x28, 0x62, 0xFF, 0x49, 0x62, 0xFF, 0xEC, 0x7A, 0xFF, 0xB4, 0xCD, 0xFF, 0x6C, 0x6A, 0xFF, 0xE8, 0x61, 0xFF, 0x07, 0x72, 0xFF, 0xAF, 0x93, 0xFF, 0xF9, 0xCD, 0xFF, 0xAD, 0x6A, 0xFF, 0xEB, 0x8A, 0xFF, 0x69, 0x82, 0xFF, 0xC6, 0x61, 0xFF, 0x6B, 0xA3, 0xFF, 0x44, 0x51, 0xFF, 0xA5, 0x79, 0xFF, 0xA5, 0x71, 0xFF, 0xA5, 0x69, 0xFF, 0xC8, 0x92, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x26, 0x7A, 0xFF,
-    0x84, 0x61, 0xFF, 0x64, 0x61, 0xFF, 0x64, 0x61, 0xFF, 0x03, 0x49, 0xFF, 0x67, 0x82, 0xFF, 0xA5, 0x59, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x66, 0x82, 0xFF, 0x43, 0x59, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x67, 0x82, 0xFF, 0x23, 0x51, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xA2, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0x64, 0x69, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x48, 0xFF, 0xE3, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0xC6, 0x79, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE3, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0xC5, 0x69, 0xFF, 0x03, 0x49, 0xFF, 0x24, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x46, 0x82, 0xFF, 0x24, 0x59, 0xFF, 0x44, 0x51, 0xFF, 0x03, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0xA7, 0x82, 0xFF, 0x64, 0x59, 0xFF, 0x64, 0x51, 0xFF, 0xA4, 0x59, 0xFF, 0xA5, 0x61, 0xFF, 0x06, 0x6A, 0xFF, 0xA5, 0x59, 0xFF, 0xC5, 0x61, 0xFF, 0x06, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x6A, 0xFF, 0x06, 0x62, 0xFF, 0x27, 0x6A, 0xFF, 0x0F, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xBD, 0xFF, 0xAC, 0xA3, 0xFF, 0xAA, 0x7A, 0xFF, 0xF1, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x72, 0xFF, 0x6A, 0x62, 0xFF, 0xAE, 0x6A, 0xFF, 0x94, 0x73, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF1, 0x72, 0xFF, 0x2A, 0x62, 0xFF, 0xE7, 0x61, 0xFF, 0xC6, 0x59, 0xFF, 0xE6, 0x61, 0xFF, 0x84, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x84, 0x61, 0xFF, 0x44, 0x59, 0xFF, 0x43, 0x59, 0xFF, 0x43, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x41, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0xA2, 0x40, 0xFF, 0xA5, 0x89, 0xFF, 0xA2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xA2, 0x40, 0xFF, 0x85, 0x81, 0xFF, 0xE2, 0x40, 0xFF, 0x44, 0x51, 0xFF, 0xE3, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xE6, 0x81, 0xFF, 0x85, 0x61, 0xFF, 0xE3, 0x40, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x51, 0xFF, 0x65, 0x59, 0xFF, 0xA9, 0x9A, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x09, 0xAB, 0xFF, 0x63, 0x51, 0xFF, 0x83, 0x61, 0xFF, 0x64, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0xA7, 0x92, 0xFF, 0xA5, 0x61, 0xFF, 0x26, 0x6A, 0xFF, 0xC5, 0x61, 0xFF, 0xE5, 0x61, 0xFF,
-    0x88, 0x72, 0xFF, 0x2D, 0xC4, 0xFF, 0x67, 0x6A, 0xFF, 0x47, 0x6A, 0xFF, 0x47, 0x6A, 0xFF, 0xA9, 0x72, 0xFF, 0x31, 0xE5, 0xFF, 0x88, 0x72, 0xFF, 0x69, 0x6A, 0xFF, 0xCC, 0x72, 0xFF, 0x52, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x6A, 0xFF, 0x8B, 0x72, 0xFF, 0x6C, 0x6A, 0xFF, 0xB6, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x6A, 0xFF, 0x2E, 0x93, 0xFF, 0xEB, 0x8A, 0xFF, 0xC6, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0xE6, 0x71, 0xFF, 0x65, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0xC8, 0x8A, 0xFF, 0x44, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0x64, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x26, 0x7A, 0xFF, 0x44, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0x8B, 0xA3, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0xE6, 0x69, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x05, 0x72, 0xFF, 0x23, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0xE3, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xA2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xA2, 0x40, 0xFF, 0x85, 0x71, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0xE3, 0x48, 0xFF, 0x03, 0x51, 0xFF, 0x0A, 0xAB, 0xFF, 0xE2, 0x48, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF,
-    0x23, 0x61, 0xFF, 0x85, 0x81, 0xFF, 0x23, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0x43, 0x59, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x64, 0x61, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0xA5, 0x61, 0xFF, 0x8B, 0x9B, 0xFF, 0xA4, 0x59, 0xFF, 0xE5, 0x69, 0xFF, 0xA8, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xAB, 0xFF, 0x47, 0x72, 0xFF, 0x67, 0x72, 0xFF, 0xC9, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xC4, 0xFF, 0xCA, 0x72, 0xFF, 0x0C, 0x73, 0xFF, 0xB6, 0xAC, 0xFF, 0x3D, 0xF7, 0xFF, 0xCC, 0x72, 0xFF, 0xAB, 0x72, 0xFF, 0xCD, 0x72, 0xFF, 0x7C, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x6A, 0xFF, 0x28, 0x6A, 0xFF, 0x08, 0x62, 0xFF, 0xE7, 0x61, 0xFF, 0x27, 0x7A, 0xFF, 0x6B, 0xA3, 0xFF, 0x85, 0x59, 0xFF, 0x85, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xC5, 0x69, 0xFF, 0xA8, 0x9A, 0xFF, 0x85, 0x59, 0xFF, 0x23, 0x49, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0xC8, 0x9A, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x06, 0x72, 0xFF, 0x09, 0xA3, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x46, 0x92, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x51, 0xFF,
-    0xA2, 0x38, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xC5, 0x81, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x48, 0xFF, 0xC6, 0x81, 0xFF, 0x03, 0x51, 0xFF, 0xE3, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0x03, 0x49, 0xFF, 0xE6, 0x81, 0xFF, 0xE2, 0x40, 0xFF, 0x64, 0x59, 0xFF, 0x43, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x47, 0x92, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x29, 0xAB, 0xFF, 0x64, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0xC5, 0x61, 0xFF, 0x6C, 0xC4, 0xFF, 0x88, 0x7A, 0xFF, 0xE5, 0x61, 0xFF, 0x06, 0x6A, 0xFF, 0xE9, 0x7A, 0xFF, 0xF3, 0xFE, 0xFF, 0xA8, 0x7A, 0xFF, 0x67, 0x72, 0xFF, 0x67, 0x72, 0xFF, 0xEA, 0x82, 0xFF, 0xB8, 0xFF, 0xFF, 0xCC, 0x8B, 0xFF, 0xC9, 0x72, 0xFF, 0x0B, 0x7B, 0xFF, 0x57, 0x94, 0xFF, 0xBE, 0xF7, 0xFF, 0xAD, 0x83, 0xFF, 0xEA, 0x72, 0xFF, 0xAA, 0x72, 0xFF, 0xD7, 0x9C, 0xFF, 0x54, 0x9C, 0xFF, 0x4C, 0x8B, 0xFF, 0xE9, 0x82, 0xFF, 0x68, 0x72, 0xFF, 0xC9, 0x82, 0xFF, 0x27, 0x82, 0xFF, 0x27, 0x82, 0xFF, 0x26, 0x72, 0xFF, 0xA8, 0x8A, 0xFF, 0x06, 0x6A, 0xFF, 0x64, 0x59, 0xFF, 0x47, 0x6A, 0xFF, 0xE6, 0x61, 0xFF, 0x05, 0x72, 0xFF, 0xA5, 0x61, 0xFF, 0x43, 0x59, 0xFF,
-    0x64, 0x59, 0xFF, 0x46, 0x7A, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x61, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x8C, 0xA3, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0xE2, 0x40, 0xFF, 0xE2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0x64, 0x59, 0xFF, 0x03, 0x51, 0xFF, 0x03, 0x49, 0xFF, 0xE2, 0x48, 0xFF, 0xA5, 0x69, 0xFF, 0x03, 0x51, 0xFF, 0x64, 0x61, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x69, 0xFF, 0xE3, 0x58, 0xFF, 0x23, 0x59, 0xFF, 0x23, 0x51, 0xFF, 0xE6, 0x79, 0xFF, 0x64, 0x59, 0xFF, 0x06, 0x62, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xA4, 0x61, 0xFF, 0x66, 0x82, 0xFF, 0x25, 0x72, 0xFF, 0x6A, 0x93, 0xFF, 0x06, 0x6A, 0xFF, 0x68, 0x93, 0xFF, 0xF5, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x7A, 0xFF, 0xA7, 0x7A, 0xFF, 0xD8, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xAF, 0xAC, 0xFF, 0x09, 0x83, 0xFF, 0x2A, 0x83, 0xFF, 0xB3, 0xCD, 0xFF, 0xFD, 0xFF, 0xFF, 0x0C, 0x9C, 0xFF, 0x0A, 0x83, 0xFF, 0x0A, 0x7B, 0xFF, 0x10, 0xBD, 0xFF,
-    0xFE, 0xFF, 0xFF, 0x49, 0x8B, 0xFF, 0xA8, 0x72, 0xFF, 0x47, 0x6A, 0xFF, 0x06, 0x6A, 0xFF, 0x2E, 0xC4, 0xFF, 0x52, 0xDD, 0xFF, 0x27, 0x72, 0xFF, 0x85, 0x59, 0xFF, 0x85, 0x59, 0xFF, 0xC8, 0x9A, 0xFF, 0xA5, 0x61, 0xFF, 0x28, 0x6A, 0xFF, 0x44, 0x51, 0xFF, 0x24, 0x51, 0xFF, 0x66, 0x8A, 0xFF, 0x64, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0xA4, 0x71, 0xFF, 0x44, 0x51, 0xFF, 0x43, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x25, 0x82, 0xFF, 0x44, 0x59, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0xA7, 0x9A, 0xFF, 0x64, 0x59, 0xFF, 0xC2, 0x40, 0xFF, 0xE3, 0x48, 0xFF, 0xC2, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0xE2, 0x40, 0xFF, 0x64, 0x69, 0xFF, 0x03, 0x51, 0xFF, 0xE2, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0x0A, 0xA3, 0xFF, 0x06, 0x92, 0xFF, 0xE2, 0x48, 0xFF, 0xE3, 0x48, 0xFF, 0x03, 0x49, 0xFF, 0x45, 0x69, 0xFF, 0x06, 0x82, 0xFF, 0x64, 0x59, 0xFF, 0x64, 0x59, 0xFF, 0x07, 0x7A, 0xFF, 0x88, 0x92, 0xFF, 0x24, 0x59, 0xFF, 0x44, 0x51, 0xFF, 0xA5, 0x69, 0xFF, 0x84, 0x59, 0xFF, 0x08, 0x9B, 0xFF, 0xA5, 0x61, 0xFF, 0xA5, 0x61, 0xFF, 0xA5, 0x61, 0xFF, 0xC8, 0x82, 0xFF, 0x26, 0x72, 0xFF, 0xE5, 0x69, 0xFF, 0x46, 0x72, 0xFF,
-    0x0B, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0xAD, 0xFF, 0xE8, 0x7A, 0xFF, 0xC7, 0x7A, 0xFF, 0xC9, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x9C, 0xFF, 0xE8, 0x7A, 0xFF, 0xE8, 0x7A, 0xFF, 0xCB, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x94, 0xFF, 0x6B, 0x8B, 0xFF, 0x09, 0x7B, 0xFF, 0x10, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x8B, 0xFF, 0x87, 0x72, 0xFF, 0x06, 0x6A, 0xFF, 0x06, 0x6A, 0xFF, 0xE6, 0x69, 0xFF, 0x27, 0x72, 0xFF, 0x27, 0x72, 0xFF, 0x85, 0x59, 0xFF, 0x85, 0x59, 0xFF, 0x45, 0x51, 0xFF, 0xE6, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0x84, 0x59, 0xFF, 0x43, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0xE5, 0x61, 0xFF, 0xE6, 0x61, 0xFF, 0x23, 0x49, 0xFF, 0x03, 0x49, 0xFF, 0x23, 0x49, 0xFF, 0xC5, 0x61, 0xFF, 0x64, 0x59, 0xFF, 0x27, 0x72, 0xFF, 0x03, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x44, 0x51, 0xFF, 0x64, 0x59, 0xFF, 0xA5, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0xC1, 0x40, 0xFF, 0x06, 0x9A, 0xFF, 0xC3, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0x68, 0xB2, 0xFF, 0x85, 0x69, 0xFF, 0xE2, 0x48, 0xFF, 0x64, 0x61, 0xFF, 0xE2, 0x48, 0xFF, 0x23, 0x69, 0xFF, 0xE3, 0x50, 0xFF, 0x03, 0x49, 0xFF, 0xE3, 0x50, 0xFF, 0x44, 0x61, 0xFF,
-    0x85, 0x61, 0xFF, 0x44, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x51, 0xFF, 0x23, 0x59, 0xFF, 0x44, 0x59, 0xFF, 0x84, 0x69, 0xFF, 0x84, 0x59, 0xFF, 0xA4, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0xC4, 0x69, 0xFF, 0xA4, 0x69, 0xFF, 0xE8, 0x82, 0xFF, 0xE4, 0x69, 0xFF, 0x26, 0x72, 0xFF, 0x66, 0x72, 0xFF, 0x6F, 0xCD, 0xFF, 0x0F, 0xCE, 0xFF, 0x71, 0xBD, 0xFF, 0x08, 0x8B, 0xFF, 0x66, 0x7A, 0xFF, 0xEA, 0x9B, 0xFF, 0x36, 0xEF, 0xFF, 0xCE, 0xB4, 0xFF, 0xE8, 0x7A, 0xFF, 0xC8, 0x7A, 0xFF, 0xCB, 0x93, 0xFF, 0xFE, 0xFF, 0xFF, 0xEA, 0x8B, 0xFF, 0xC8, 0x7A, 0xFF, 0x6A, 0x8B, 0xFF, 0x6B, 0xA4, 0xFF, 0xAC, 0xB4, 0xFF, 0x4A, 0x93, 0xFF, 0x46, 0x72, 0xFF, 0x88, 0x82, 0xFF, 0xE5, 0x69, 0xFF, 0xA5, 0x69, 0xFF, 0x2A, 0x93, 0xFF, 0x27, 0x72, 0xFF, 0xA5, 0x61, 0xFF, 0x29, 0x9B, 0xFF, 0x6A, 0xA3, 0xFF, 0x06, 0x72, 0xFF, 0xC5, 0x59, 0xFF, 0x43, 0x51, 0xFF, 0x87, 0x92, 0xFF, 0x84, 0x59, 0xFF, 0xA5, 0x59, 0xFF, 0x03, 0x49, 0xFF, 0x63, 0x59, 0xFF, 0x26, 0x72, 0xFF, 0x43, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0xE5, 0x69, 0xFF, 0xE8, 0x92, 0xFF, 0x43, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x61, 0xFF, 0x86, 0x8A, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x61, 0xFF,
-    0xA2, 0x48, 0xFF, 0xC2, 0x50, 0xFF, 0xC2, 0x48, 0xFF, 0xC2, 0x48, 0xFF, 0xE2, 0x48, 0xFF, 0xE2, 0x48, 0xFF, 0xE3, 0x50, 0xFF, 0xE3, 0x60, 0xFF, 0xE2, 0x50, 0xFF, 0x85, 0x61, 0xFF, 0xE3, 0x48, 0xFF, 0x02, 0x59, 0xFF, 0x87, 0xAA, 0xFF, 0x83, 0x69, 0xFF, 0x24, 0x59, 0xFF, 0x64, 0x69, 0xFF, 0x23, 0x71, 0xFF, 0x68, 0xBA, 0xFF, 0x23, 0x59, 0xFF, 0xA5, 0x71, 0xFF, 0x23, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0xC8, 0xAA, 0xFF, 0x47, 0x82, 0xFF, 0x84, 0x61, 0xFF, 0xC7, 0x8A, 0xFF, 0xC4, 0x61, 0xFF, 0x66, 0x8A, 0xFF, 0x85, 0x8A, 0xFF, 0xEA, 0xAB, 0xFF, 0xA7, 0x82, 0xFF, 0x66, 0x7A, 0xFF, 0x0F, 0xED, 0xFF, 0xB6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x08, 0x8B, 0xFF, 0xC7, 0x82, 0xFF, 0xE7, 0x8A, 0xFF, 0xED, 0xDC, 0xFF, 0x2B, 0xA4, 0xFF, 0x08, 0x83, 0xFF, 0x08, 0x83, 0xFF, 0xEA, 0x93, 0xFF, 0xD3, 0xFE, 0xFF, 0xC8, 0x8B, 0xFF, 0xA7, 0x7A, 0xFF, 0x49, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xFF, 0xFF, 0x66, 0x7A, 0xFF, 0x26, 0x72, 0xFF, 0x47, 0x72, 0xFF, 0xCB, 0xA3, 0xFF, 0x26, 0x6A, 0xFF, 0x6D, 0xD4, 0xFF, 0xE6, 0x69, 0xFF, 0xE9, 0x92, 0xFF, 0x27, 0x72, 0xFF, 0xC6, 0x69, 0xFF, 0x49, 0xBB, 0xFF, 0xC5, 0x61, 0xFF, 0xE8, 0x9A, 0xFF, 0x64, 0x59, 0xFF, 0x85, 0x59, 0xFF,
-    0x29, 0xAB, 0xFF, 0x64, 0x51, 0xFF, 0x64, 0x51, 0xFF, 0x23, 0x49, 0xFF, 0x84, 0x59, 0xFF, 0xE5, 0x69, 0xFF, 0x29, 0xAB, 0xFF, 0x43, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0x85, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0x87, 0xAA, 0xFF, 0x64, 0x59, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0xC2, 0x48, 0xFF, 0x03, 0x49, 0xFF, 0xE2, 0x48, 0xFF, 0x26, 0x9A, 0xFF, 0x03, 0x59, 0xFF, 0xE2, 0x50, 0xFF, 0x03, 0x51, 0xFF, 0xE2, 0x50, 0xFF, 0x87, 0xAA, 0xFF, 0xC5, 0x71, 0xFF, 0x02, 0x51, 0xFF, 0x23, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0x88, 0xAA, 0xFF, 0x24, 0x59, 0xFF, 0x65, 0x61, 0xFF, 0xA6, 0x69, 0xFF, 0xC6, 0x79, 0xFF, 0xA8, 0xAA, 0xFF, 0x44, 0x59, 0xFF, 0x84, 0x69, 0xFF, 0x47, 0x8A, 0xFF, 0xA5, 0x61, 0xFF, 0x8A, 0xBB, 0xFF, 0xA4, 0x61, 0xFF, 0x84, 0x69, 0xFF, 0xC5, 0x69, 0xFF, 0x25, 0x72, 0xFF, 0x89, 0xB3, 0xFF, 0x25, 0x72, 0xFF, 0x05, 0x6A, 0xFF, 0xC8, 0x8A, 0xFF, 0xEE, 0xC4, 0xFF, 0x4D, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x93, 0xFF, 0xC7, 0x82, 0xFF, 0x07, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0xFF, 0xA7, 0x82, 0xFF, 0xC8, 0x82, 0xFF, 0x08, 0x83, 0xFF, 0xE8, 0xAB, 0xFF, 0x86, 0x83, 0xFF, 0x87, 0x7A, 0xFF, 0x27, 0x83, 0xFF, 0x6C, 0xBC, 0xFF,
-    0x89, 0x9B, 0xFF, 0x86, 0x7A, 0xFF, 0x46, 0x7A, 0xFF, 0x66, 0x72, 0xFF, 0x05, 0x6A, 0xFF, 0xC5, 0x69, 0xFF, 0x4A, 0x9B, 0xFF, 0x06, 0x72, 0xFF, 0x84, 0x59, 0xFF, 0xA4, 0x61, 0xFF, 0x2A, 0x93, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x59, 0xFF, 0x64, 0x59, 0xFF, 0x42, 0x69, 0xFF, 0x46, 0x82, 0xFF, 0xA4, 0x59, 0xFF, 0x64, 0x51, 0xFF, 0x85, 0x59, 0xFF, 0xA4, 0x71, 0xFF, 0x85, 0x61, 0xFF, 0x64, 0x59, 0xFF, 0xA5, 0x61, 0xFF, 0xE6, 0x69, 0xFF, 0x69, 0x9B, 0xFF, 0x2A, 0xA3, 0xFF, 0x85, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0xA5, 0x61, 0xFF, 0xE2, 0x50, 0xFF, 0xE2, 0x50, 0xFF, 0x02, 0x51, 0xFF, 0xE2, 0x58, 0xFF, 0x03, 0x59, 0xFF, 0xB3, 0xFF, 0xFF, 0x23, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x59, 0xFF, 0xA5, 0x69, 0xFF, 0x43, 0x7A, 0xFF, 0x23, 0x61, 0xFF, 0x23, 0x59, 0xFF, 0x02, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0x64, 0x61, 0xFF, 0xE6, 0x71, 0xFF, 0xC5, 0x71, 0xFF, 0x23, 0x61, 0xFF, 0x44, 0x61, 0xFF, 0x64, 0x59, 0xFF, 0x63, 0x59, 0xFF, 0xA5, 0x61, 0xFF, 0x83, 0x59, 0xFF, 0x05, 0x72, 0xFF, 0xA4, 0x69, 0xFF, 0x05, 0x72, 0xFF, 0xC4, 0x69, 0xFF, 0xE9, 0xB3, 0xFF, 0x25, 0x72, 0xFF, 0x45, 0x6A, 0xFF, 0x46, 0x7A, 0xFF,
-    0xC8, 0xB3, 0xFF, 0x97, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0x67, 0x93, 0xFF, 0xE7, 0x82, 0xFF, 0x51, 0xEE, 0xFF, 0xFA, 0xFF, 0xFF, 0x0F, 0xDE, 0xFF, 0x69, 0x93, 0xFF, 0x8A, 0x9B, 0xFF, 0x0B, 0xB4, 0xFF, 0xF7, 0xFF, 0xFF, 0x28, 0x9C, 0xFF, 0xC7, 0x82, 0xFF, 0x27, 0x8B, 0xFF, 0xEB, 0xBC, 0xFF, 0x74, 0xFF, 0xFF, 0x88, 0xA3, 0xFF, 0x87, 0x7A, 0xFF, 0xC8, 0x92, 0xFF, 0xE8, 0x92, 0xFF, 0xAA, 0xBB, 0xFF, 0x26, 0x7A, 0xFF, 0x26, 0x72, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0x69, 0xBB, 0xFF, 0x88, 0x8A, 0xFF, 0x45, 0x82, 0xFF, 0xC5, 0x69, 0xFF, 0xA4, 0x59, 0xFF, 0xA7, 0xA2, 0xFF, 0xE4, 0x71, 0xFF, 0x84, 0x61, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xC8, 0x9A, 0xFF, 0xED, 0x51, 0xFF, 0x84, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xC5, 0x59, 0xFF, 0xE4, 0x79, 0xFF, 0xA4, 0x61, 0xFF, 0x27, 0x72, 0xFF, 0xA5, 0x61, 0xFF, 0xC5, 0x69, 0xFF, 0xA7, 0x9A, 0xFF, 0xC5, 0x69, 0xFF, 0x03, 0x59, 0xFF, 0x03, 0x51, 0xFF, 0x23, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0x84, 0x69, 0xFF, 0x63, 0x61, 0xFF, 0xA4, 0x69, 0xFF, 0x43, 0x61, 0xFF, 0xCA, 0xDB, 0xFF, 0x02, 0x69, 0xFF, 0x43, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0x64, 0x71, 0xFF, 0x87, 0xA2, 0xFF,
-    0xA5, 0x69, 0xFF, 0x06, 0x72, 0xFF, 0x44, 0x69, 0xFF, 0xC6, 0x79, 0xFF, 0x64, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0xE6, 0x81, 0xFF, 0x46, 0x7A, 0xFF, 0x48, 0xAB, 0xFF, 0xC4, 0x61, 0xFF, 0x66, 0x92, 0xFF, 0x05, 0x72, 0xFF, 0xB1, 0xE5, 0xFF, 0xF0, 0xE5, 0xFF, 0x69, 0xA3, 0xFF, 0x45, 0x7A, 0xFF, 0xB3, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xC9, 0xAB, 0xFF, 0x69, 0x9B, 0xFF, 0xA8, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xE6, 0xFF, 0xE7, 0x8A, 0xFF, 0x08, 0x93, 0xFF, 0xCD, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xC4, 0xFF, 0xA7, 0x82, 0xFF, 0xD3, 0xE6, 0xFF, 0x90, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0xE6, 0xFF, 0xC8, 0x8A, 0xFF, 0xC8, 0x92, 0xFF, 0x45, 0x7A, 0xFF, 0x06, 0x7A, 0xFF, 0x05, 0x6A, 0xFF, 0x88, 0x82, 0xFF, 0x27, 0x72, 0xFF, 0x8A, 0xB3, 0xFF, 0x09, 0x8B, 0xFF, 0x46, 0x8A, 0xFF, 0xC5, 0x71, 0xFF, 0x84, 0x61, 0xFF, 0x6A, 0xB3, 0xFF, 0x67, 0x82, 0xFF, 0xC5, 0x69, 0xFF, 0x06, 0x6A, 0xFF, 0x64, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x59, 0xFF, 0xA4, 0x59, 0xFF, 0x84, 0x59, 0xFF, 0xDD, 0xE6, 0xFF, 0xE6, 0x69, 0xFF, 0xC5, 0x61, 0xFF, 0xC5, 0x69, 0xFF, 0xC5, 0x69, 0xFF, 0x99, 0xDD, 0xFF, 0xE5, 0x69, 0xFF, 0xC5, 0x69, 0xFF, 0xE5, 0x71, 0xFF,
-    0xC2, 0x50, 0xFF, 0x06, 0xA2, 0xFF, 0x43, 0x61, 0xFF, 0xE2, 0x58, 0xFF, 0xE2, 0x58, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0xFE, 0xFF, 0xFF, 0x66, 0x8A, 0xFF, 0xC4, 0x71, 0xFF, 0x23, 0x61, 0xFF, 0x14, 0xFF, 0xFF, 0xC5, 0x79, 0xFF, 0x23, 0x61, 0xFF, 0x44, 0x61, 0xFF, 0x64, 0x69, 0xFF, 0xA7, 0x92, 0xFF, 0xA4, 0x61, 0xFF, 0x23, 0x59, 0xFF, 0xA5, 0x79, 0xFF, 0x06, 0x82, 0xFF, 0x64, 0x61, 0xFF, 0x06, 0x7A, 0xFF, 0x87, 0x82, 0xFF, 0xA5, 0x69, 0xFF, 0x84, 0x69, 0xFF, 0x46, 0x7A, 0xFF, 0x45, 0x82, 0xFF, 0xEC, 0xAB, 0xFF, 0x6B, 0xCC, 0xFF, 0x66, 0x7A, 0xFF, 0x25, 0x7A, 0xFF, 0x90, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF6, 0xFF, 0x27, 0x93, 0xFF, 0x08, 0x93, 0xFF, 0x88, 0xA3, 0xFF, 0xFE, 0xFF, 0xFF, 0x8B, 0xBC, 0xFF, 0x08, 0x93, 0xFF, 0xC7, 0x8A, 0xFF, 0xCB, 0xBC, 0xFF, 0xFE, 0xFF, 0xFF, 0xB5, 0xF7, 0xFF, 0xE7, 0x8A, 0xFF, 0x6F, 0xD5, 0xFF, 0x8E, 0xE5, 0xFF, 0x88, 0xA3, 0xFF, 0xCD, 0xCC, 0xFF, 0xE8, 0x92, 0xFF, 0x08, 0x8B, 0xFF, 0xE8, 0x92, 0xFF, 0xE5, 0x69, 0xFF, 0xA6, 0x8A, 0xFF, 0xA5, 0x61, 0xFF, 0xE5, 0x71, 0xFF, 0x87, 0x82, 0xFF, 0x05, 0x7A, 0xFF, 0xA5, 0x69, 0xFF, 0xA4, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0x26, 0x8A, 0xFF, 0xA5, 0x71, 0xFF,
-    0x84, 0x59, 0xFF, 0x67, 0x72, 0xFF, 0xA4, 0x69, 0xFF, 0xC4, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0x84, 0x61, 0xFF, 0xC9, 0xB3, 0xFF, 0x29, 0x93, 0xFF, 0xC5, 0x69, 0xFF, 0xC5, 0x69, 0xFF, 0xC5, 0x69, 0xFF, 0x27, 0xAB, 0xFF, 0xC5, 0x69, 0xFF, 0xE5, 0x69, 0xFF, 0xE5, 0x71, 0xFF, 0x03, 0x59, 0xFF, 0x47, 0xB2, 0xFF, 0x84, 0x71, 0xFF, 0x43, 0x69, 0xFF, 0x03, 0x61, 0xFF, 0x24, 0x61, 0xFF, 0x98, 0xFF, 0xFF, 0xA7, 0xA2, 0xFF, 0x46, 0x8A, 0xFF, 0xA4, 0x71, 0xFF, 0x63, 0x69, 0xFF, 0x26, 0x9A, 0xFF, 0xE8, 0xC2, 0xFF, 0x63, 0x69, 0xFF, 0xA5, 0x71, 0xFF, 0xC5, 0x71, 0xFF, 0x09, 0xA3, 0xFF, 0xC8, 0xCA, 0xFF, 0x44, 0x61, 0xFF, 0x43, 0x61, 0xFF, 0x84, 0x71, 0xFF, 0x23, 0x61, 0xFF, 0x4A, 0xCB, 0xFF, 0x83, 0x61, 0xFF, 0xC4, 0x69, 0xFF, 0x84, 0x69, 0xFF, 0xE5, 0x79, 0xFF, 0x2C, 0xE4, 0xFF, 0x88, 0x9B, 0xFF, 0x05, 0x7A, 0xFF, 0x66, 0x7A, 0xFF, 0xC7, 0x9A, 0xFF, 0x89, 0xA3, 0xFF, 0xD7, 0xFF, 0xFF, 0x6B, 0xD4, 0xFF, 0x27, 0x93, 0xFF, 0x08, 0x93, 0xFF, 0x4A, 0xB4, 0xFF, 0x91, 0xFE, 0xFF, 0x8D, 0xDD, 0xFF, 0xC6, 0x8A, 0xFF, 0xC7, 0x8A, 0xFF, 0x26, 0x93, 0xFF, 0x12, 0xFF, 0xFF, 0xB1, 0xF6, 0xFF, 0xA7, 0x82, 0xFF, 0x0C, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x72, 0xFE, 0xFF, 0x0E, 0xD5, 0xFF, 0x67, 0x8A, 0xFF, 0xF2, 0xED, 0xFF, 0x2C, 0xBC, 0xFF, 0x05, 0x72, 0xFF, 0x26, 0x7A, 0xFF, 0xE5, 0x71, 0xFF, 0x08, 0xA3, 0xFF, 0x66, 0x82, 0xFF, 0x46, 0x72, 0xFF, 0x05, 0x92, 0xFF, 0xA4, 0x61, 0xFF, 0xC7, 0x9A, 0xFF, 0xC5, 0x69, 0xFF, 0x63, 0x59, 0xFF, 0x83, 0x61, 0xFF, 0x08, 0x93, 0xFF, 0x26, 0x72, 0xFF, 0xC5, 0x61, 0xFF, 0xC5, 0x61, 0xFF, 0xE3, 0x61, 0xFF, 0x2B, 0xDD, 0xFF, 0xC5, 0x61, 0xFF, 0x46, 0x72, 0xFF, 0x05, 0x72, 0xFF, 0x69, 0xBC, 0xFF, 0xE5, 0x71, 0xFF, 0xA4, 0x69, 0xFF, 0xC5, 0x71, 0xFF, 0x06, 0x72, 0xFF, 0x05, 0x72, 0xFF, 0x03, 0x59, 0xFF, 0x23, 0x61, 0xFF, 0x23, 0x59, 0xFF, 0x28, 0xDB, 0xFF, 0x23, 0x69, 0xFF, 0x43, 0x71, 0xFF, 0x64, 0x71, 0xFF, 0x64, 0x69, 0xFF, 0x69, 0xD3, 0xFF, 0x45, 0x92, 0xFF, 0x45, 0x8A, 0xFF, 0x84, 0x79, 0xFF, 0x43, 0x61, 0xFF, 0x09, 0xCB, 0xFF, 0x64, 0x71, 0xFF, 0xE5, 0x71, 0xFF, 0xEC, 0xB3, 0xFF, 0x26, 0x92, 0xFF, 0xC9, 0xC2, 0xFF, 0x64, 0x69, 0xFF, 0x64, 0x69, 0xFF, 0x43, 0x71, 0xFF, 0x84, 0x71, 0xFF, 0x29, 0xB3, 0xFF, 0xC5, 0x79, 0xFF, 0xA5, 0x69, 0xFF, 0x84, 0x69, 0xFF, 0x25, 0x7A, 0xFF, 0x4D, 0xCC, 0xFF, 0xE5, 0x71, 0xFF, 0xA6, 0x8A, 0xFF, 0x66, 0x82, 0xFF,
-    0xE6, 0x92, 0xFF, 0xC8, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0xDD, 0xFF, 0xC8, 0x92, 0xFF, 0x48, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0xA7, 0x8A, 0xFF, 0xC7, 0x92, 0xFF, 0xE7, 0x9A, 0xFF, 0xB6, 0xFF, 0xFF, 0xAC, 0xCC, 0xFF, 0xE7, 0x92, 0xFF, 0x6F, 0xDD, 0xFF, 0x4B, 0xC4, 0xFF, 0xD7, 0xFF, 0xFF, 0xCA, 0xB3, 0xFF, 0x66, 0x7A, 0xFF, 0xAE, 0xCC, 0xFF, 0x87, 0x8A, 0xFF, 0x66, 0x9A, 0xFF, 0xC3, 0x71, 0xFF, 0xE8, 0x92, 0xFF, 0xA5, 0x69, 0xFF, 0x4D, 0xAC, 0xFF, 0x05, 0x72, 0xFF, 0xC3, 0x81, 0xFF, 0xC8, 0x9A, 0xFF, 0x05, 0x72, 0xFF, 0x83, 0x59, 0xFF, 0xA4, 0x61, 0xFF, 0xF2, 0xFD, 0xFF, 0x83, 0x69, 0xFF, 0x05, 0x6A, 0xFF, 0x86, 0x72, 0xFF, 0xFC, 0xFF, 0xFF, 0xCC, 0xEC, 0xFF, 0xC4, 0x71, 0xFF, 0xE4, 0x69, 0xFF, 0x4A, 0xBD, 0xFF, 0xD7, 0xFF, 0xFF, 0x67, 0xBB, 0xFF, 0xC5, 0x71, 0xFF, 0x05, 0x72, 0xFF, 0x85, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0x86, 0x8A, 0xFF, 0x87, 0x9A, 0xFF, 0x43, 0x61, 0xFF, 0x03, 0x59, 0xFF, 0xA4, 0x81, 0xFF, 0xA4, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x81, 0xFF, 0x26, 0x92, 0xFF, 0x8D, 0xDC, 0xFF, 0xE7, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xA2, 0xFF, 0xE5, 0x81, 0xFF, 0x43, 0x69, 0xFF, 0x47, 0x9A, 0xFF, 0x26, 0x8A, 0xFF,
-    0x2C, 0xBC, 0xFF, 0x43, 0x61, 0xFF, 0xE5, 0x91, 0xFF, 0x23, 0x71, 0xFF, 0x84, 0x69, 0xFF, 0xC6, 0x79, 0xFF, 0x06, 0x9A, 0xFF, 0x42, 0x69, 0xFF, 0x84, 0x69, 0xFF, 0xC5, 0x79, 0xFF, 0x67, 0x9A, 0xFF, 0x45, 0x92, 0xFF, 0x0B, 0xDC, 0xFF, 0xE5, 0x79, 0xFF, 0x08, 0xA3, 0xFF, 0x04, 0x7A, 0xFF, 0x68, 0xAB, 0xFF, 0x13, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xC4, 0xFF, 0xE8, 0x92, 0xFF, 0x10, 0xF6, 0xFF, 0xF7, 0xFF, 0xFF, 0x50, 0xFE, 0xFF, 0xE8, 0x92, 0xFF, 0xA7, 0x92, 0xFF, 0xEA, 0xCB, 0xFF, 0x54, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0xA6, 0x8A, 0xFF, 0x4B, 0xBC, 0xFF, 0x6B, 0xD4, 0xFF, 0x54, 0xFF, 0xFF, 0x28, 0xAB, 0xFF, 0xE5, 0x79, 0xFF, 0x48, 0x9B, 0xFF, 0x28, 0xA3, 0xFF, 0x0A, 0xD4, 0xFF, 0xE5, 0x71, 0xFF, 0x67, 0x8A, 0xFF, 0x05, 0x7A, 0xFF, 0x2D, 0xB4, 0xFF, 0x8A, 0xCB, 0xFF, 0x86, 0x9A, 0xFF, 0xA4, 0x69, 0xFF, 0x84, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0x48, 0xC3, 0xFF, 0x83, 0x61, 0xFF, 0xA6, 0x7A, 0xFF, 0x84, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0xD4, 0xFF, 0x23, 0x6A, 0xFF, 0xE4, 0x69, 0xFF, 0xF8, 0xFF, 0xFF, 0xCB, 0xC4, 0xFF, 0x88, 0xCB, 0xFF, 0xE4, 0x71, 0xFF, 0xE4, 0x71, 0xFF, 0x25, 0x93, 0xFF, 0xC6, 0x8A, 0xFF, 0x68, 0xB3, 0xFF, 0x45, 0x82, 0xFF,
-    0x83, 0x71, 0xFF, 0xFE, 0xFF, 0xFF, 0x64, 0x69, 0xFF, 0x64, 0x71, 0xFF, 0x63, 0x71, 0xFF, 0x25, 0x92, 0xFF, 0x86, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xC3, 0xFF, 0xCA, 0xC3, 0xFF, 0x66, 0xA2, 0xFF, 0x08, 0xC3, 0xFF, 0x25, 0x92, 0xFF, 0x63, 0x71, 0xFF, 0x88, 0x92, 0xFF, 0xC4, 0x91, 0xFF, 0xC8, 0x9A, 0xFF, 0x43, 0x69, 0xFF, 0x64, 0x69, 0xFF, 0x07, 0xA2, 0xFF, 0x84, 0x79, 0xFF, 0x64, 0x69, 0xFF, 0xC5, 0x79, 0xFF, 0xCD, 0xE3, 0xFF, 0x29, 0xCB, 0xFF, 0x87, 0x9A, 0xFF, 0xC4, 0x71, 0xFF, 0x45, 0x8A, 0xFF, 0x71, 0xE5, 0xFF, 0x6F, 0xF5, 0xFF, 0x04, 0x7A, 0xFF, 0x49, 0xAB, 0xFF, 0xC6, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0xD4, 0xFF, 0x89, 0xAB, 0xFF, 0xE8, 0x9A, 0xFF, 0xAC, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0xD4, 0xFF, 0xA7, 0x92, 0xFF, 0xC7, 0x92, 0xFF, 0xAF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0xFE, 0xFF, 0xE7, 0x9A, 0xFF, 0xA9, 0xB3, 0xFF, 0xFB, 0xFF, 0xFF, 0xAF, 0xED, 0xFF, 0xE7, 0xA2, 0xFF, 0xC8, 0x9A, 0xFF, 0xC7, 0x8A, 0xFF, 0x29, 0xD4, 0xFF, 0x46, 0x82, 0xFF, 0x87, 0x92, 0xFF, 0xE5, 0x69, 0xFF, 0xA5, 0x71, 0xFF, 0xFE, 0xFF, 0xFF, 0x87, 0x92, 0xFF, 0x83, 0x69, 0xFF, 0xC4, 0x69, 0xFF, 0xA4, 0x61, 0xFF, 0x8A, 0xC3, 0xFF, 0x83, 0x61, 0xFF,
-    0xA4, 0x61, 0xFF, 0x28, 0x93, 0xFF, 0xAC, 0xCC, 0xFF, 0x88, 0x9B, 0xFF, 0x05, 0x72, 0xFF, 0x45, 0x7A, 0xFF, 0x24, 0x72, 0xFF, 0x70, 0xE6, 0xFF, 0x66, 0x82, 0xFF, 0xE4, 0x71, 0xFF, 0xE5, 0x71, 0xFF, 0x25, 0x7A, 0xFF, 0x2A, 0xCC, 0xFF, 0x25, 0x7A, 0xFF, 0x65, 0x82, 0xFF, 0x45, 0x82, 0xFF, 0x23, 0x61, 0xFF, 0xA4, 0x71, 0xFF, 0x64, 0x71, 0xFF, 0x43, 0x69, 0xFF, 0x23, 0x69, 0xFF, 0x64, 0x71, 0xFF, 0xC4, 0x81, 0xFF, 0x06, 0xAB, 0xFF, 0x8A, 0xC3, 0xFF, 0xA6, 0xA2, 0xFF, 0xA4, 0x81, 0xFF, 0x46, 0xAA, 0xFF, 0x64, 0x9A, 0xFF, 0x64, 0x79, 0xFF, 0xE8, 0x9A, 0xFF, 0x46, 0x92, 0xFF, 0x87, 0xC2, 0xFF, 0x63, 0x79, 0xFF, 0x84, 0x71, 0xFF, 0x84, 0x71, 0xFF, 0x23, 0x91, 0xFF, 0x22, 0x71, 0xFF, 0x43, 0x61, 0xFF, 0x23, 0x79, 0xFF, 0x64, 0x79, 0xFF, 0x4A, 0xC3, 0xFF, 0xA4, 0x71, 0xFF, 0x45, 0x8A, 0xFF, 0x66, 0x8A, 0xFF, 0x2B, 0xDC, 0xFF, 0x86, 0x9A, 0xFF, 0xA7, 0x9A, 0xFF, 0x45, 0x92, 0xFF, 0xFB, 0xFF, 0xFF, 0xAE, 0xED, 0xFF, 0xCA, 0xBB, 0xFF, 0xE7, 0x9A, 0xFF, 0x68, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xED, 0xFF, 0x86, 0x92, 0xFF, 0xC7, 0x9A, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x51, 0xFE, 0xFF, 0xE8, 0x9A, 0xFF, 0x89, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x07, 0xAB, 0xFF, 0x2B, 0xC4, 0xFF, 0xA7, 0x92, 0xFF, 0xC6, 0x92, 0xFF, 0xE7, 0xAA, 0xFF, 0x04, 0x7A, 0xFF, 0x62, 0x69, 0xFF, 0xE4, 0x71, 0xFF, 0x8D, 0xED, 0xFF, 0xE8, 0x9A, 0xFF, 0xE4, 0x71, 0xFF, 0xA3, 0x69, 0xFF, 0xA4, 0x69, 0xFF, 0xA6, 0x9A, 0xFF, 0xA4, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0xA4, 0x61, 0xFF, 0x25, 0x82, 0xFF, 0xE4, 0x71, 0xFF, 0xE4, 0x71, 0xFF, 0x04, 0x72, 0xFF, 0x86, 0x82, 0xFF, 0x04, 0x7A, 0xFF, 0xC3, 0x69, 0xFF, 0x25, 0x7A, 0xFF, 0xE4, 0x71, 0xFF, 0x25, 0x7A, 0xFF, 0xE4, 0x79, 0xFF, 0x05, 0x7A, 0xFF, 0x25, 0x7A, 0xFF, 0x25, 0x7A, 0xFF, 0x25, 0x7A, 0xFF, 0x03, 0x61, 0xFF, 0x27, 0xC2, 0xFF, 0x02, 0x61, 0xFF, 0x43, 0x71, 0xFF, 0x44, 0x71, 0xFF, 0x23, 0x71, 0xFF, 0xE9, 0xEA, 0xFF, 0xA4, 0x91, 0xFF, 0xA8, 0xB2, 0xFF, 0x05, 0x9A, 0xFF, 0x64, 0x79, 0xFF, 0x05, 0xB2, 0xFF, 0x8E, 0xF4, 0xFF, 0x4A, 0xD3, 0xFF, 0xA8, 0xA2, 0xFF, 0x09, 0xA3, 0xFF, 0x87, 0xA2, 0xFF, 0xC8, 0xD2, 0xFF, 0xA5, 0x89, 0xFF, 0x26, 0x8A, 0xFF, 0x64, 0x71, 0xFF, 0x0A, 0xCB, 0xFF, 0xEA, 0xE2, 0xFF, 0x63, 0x69, 0xFF, 0xA4, 0x71, 0xFF, 0x03, 0x79, 0xFF, 0xA4, 0x79, 0xFF, 0x46, 0xAA, 0xFF, 0x8E, 0xDC, 0xFF, 0xE5, 0x89, 0xFF, 0x4B, 0xDC, 0xFF, 0x05, 0x8A, 0xFF,
-    0x04, 0x8A, 0xFF, 0x52, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0xD4, 0xFF, 0xA7, 0x9A, 0xFF, 0xE7, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xA7, 0x92, 0xFF, 0xC7, 0x9A, 0xFF, 0xCD, 0xE4, 0xFF, 0xE7, 0xA2, 0xFF, 0x6B, 0xD4, 0xFF, 0x66, 0x92, 0xFF, 0xA6, 0x9A, 0xFF, 0xEC, 0xEC, 0xFF, 0xC7, 0xA2, 0xFF, 0xA7, 0x9A, 0xFF, 0xE5, 0x71, 0xFF, 0x69, 0xBB, 0xFF, 0x66, 0x92, 0xFF, 0x26, 0x8A, 0xFF, 0x26, 0x7A, 0xFF, 0x66, 0x82, 0xFF, 0x84, 0x71, 0xFF, 0x65, 0x82, 0xFF, 0xC4, 0x69, 0xFF, 0xA5, 0x71, 0xFF, 0x04, 0x8A, 0xFF, 0xA3, 0x69, 0xFF, 0x84, 0x61, 0xFF, 0x83, 0x69, 0xFF, 0x6E, 0xCD, 0xFF, 0x05, 0x7A, 0xFF, 0x24, 0x7A, 0xFF, 0x24, 0x72, 0xFF, 0xC8, 0xBB, 0xFF, 0xC9, 0xBB, 0xFF, 0xE4, 0x79, 0xFF, 0x65, 0x82, 0xFF, 0xE7, 0xA3, 0xFF, 0xA4, 0x8A, 0xFF, 0x52, 0xFF, 0xFF, 0x25, 0x7A, 0xFF, 0x05, 0x7A, 0xFF, 0xA6, 0x92, 0xFF, 0x85, 0x8A, 0xFF, 0xA5, 0x92, 0xFF, 0x03, 0x61, 0xFF, 0x03, 0x61, 0xFF, 0x03, 0x61, 0xFF, 0x6A, 0xEB, 0xFF, 0x43, 0x81, 0xFF, 0xC3, 0x91, 0xFF, 0x64, 0x81, 0xFF, 0x63, 0x79, 0xFF, 0x49, 0xE3, 0xFF, 0x46, 0xA2, 0xFF, 0x05, 0xB2, 0xFF, 0x23, 0x79, 0xFF, 0x63, 0x81, 0xFF, 0x4A, 0xE3, 0xFF, 0x8B, 0xCB, 0xFF, 0x46, 0x92, 0xFF,
-    0x28, 0xB3, 0xFF, 0x23, 0x89, 0xFF, 0xEA, 0xE2, 0xFF, 0xA5, 0x89, 0xFF, 0x64, 0x79, 0xFF, 0x43, 0x71, 0xFF, 0x27, 0xB2, 0xFF, 0x67, 0xBA, 0xFF, 0xC5, 0x79, 0xFF, 0xC5, 0x81, 0xFF, 0x4C, 0xFC, 0xFF, 0x46, 0xA2, 0xFF, 0x71, 0xFD, 0xFF, 0xA4, 0x81, 0xFF, 0xF9, 0xFF, 0xFF, 0x46, 0x92, 0xFF, 0x25, 0x9A, 0xFF, 0x07, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xCB, 0xFF, 0xC8, 0xA2, 0xFF, 0xE7, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0xFE, 0xFF, 0x52, 0xFE, 0xFF, 0x67, 0x92, 0xFF, 0x32, 0xEE, 0xFF, 0x2E, 0xED, 0xFF, 0x48, 0xBB, 0xFF, 0xA8, 0xAA, 0xFF, 0x09, 0xCB, 0xFF, 0x25, 0x9A, 0xFF, 0xAD, 0xEC, 0xFF, 0x26, 0xA2, 0xFF, 0x88, 0xB2, 0xFF, 0xA8, 0xBA, 0xFF, 0x25, 0x92, 0xFF, 0x97, 0xFF, 0xFF, 0x66, 0x92, 0xFF, 0xE5, 0x91, 0xFF, 0xE5, 0x91, 0xFF, 0x45, 0x8A, 0xFF, 0x08, 0xBB, 0xFF, 0xB4, 0xFF, 0xFF, 0x06, 0x82, 0xFF, 0xA3, 0x69, 0xFF, 0x84, 0x69, 0xFF, 0x06, 0xBB, 0xFF, 0xE8, 0xD2, 0xFF, 0xE4, 0x79, 0xFF, 0x45, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0xBC, 0xFF, 0x69, 0xDB, 0xFF, 0x04, 0x7A, 0xFF, 0x29, 0xCC, 0xFF, 0xF9, 0xFF, 0xFF, 0xAB, 0xCC, 0xFF, 0x68, 0xCB, 0xFF, 0x66, 0xA2, 0xFF, 0x85, 0x92, 0xFF, 0x49, 0xBC, 0xFF, 0x65, 0x8A, 0xFF, 0x2B, 0xD4, 0xFF,
-    0x08, 0xCB, 0xFF, 0x42, 0x71, 0xFF, 0x03, 0x69, 0xFF, 0x23, 0x71, 0xFF, 0x43, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xA2, 0xFF, 0xC4, 0xA1, 0xFF, 0x09, 0xC3, 0xFF, 0x0C, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x99, 0xFF, 0x05, 0x9A, 0xFF, 0x43, 0x79, 0xFF, 0xE8, 0xD2, 0xFF, 0x6A, 0xEB, 0xFF, 0xAA, 0xCB, 0xFF, 0x26, 0x9A, 0xFF, 0xC5, 0x89, 0xFF, 0xFE, 0xFF, 0xFF, 0x26, 0xA2, 0xFF, 0x44, 0x79, 0xFF, 0xA5, 0x89, 0xFF, 0xC5, 0xA9, 0xFF, 0xA5, 0x89, 0xFF, 0x84, 0x71, 0xFF, 0xC5, 0x79, 0xFF, 0x06, 0x9A, 0xFF, 0x0C, 0xFC, 0xFF, 0xE5, 0x89, 0xFF, 0x05, 0x8A, 0xFF, 0xE4, 0x89, 0xFF, 0xAE, 0xE4, 0xFF, 0xD3, 0xF6, 0xFF, 0x6A, 0xD3, 0xFF, 0xCC, 0xE3, 0xFF, 0xA8, 0xAA, 0xFF, 0x07, 0xC3, 0xFF, 0x33, 0xFF, 0xFF, 0x71, 0xFD, 0xFF, 0x67, 0x92, 0xFF, 0x67, 0x92, 0xFF, 0xCB, 0xE3, 0xFF, 0x14, 0xEF, 0xFF, 0x48, 0xCB, 0xFF, 0xC8, 0xAA, 0xFF, 0x2A, 0xDB, 0xFF, 0xCE, 0xE4, 0xFF, 0x76, 0xFF, 0xFF, 0x49, 0xBB, 0xFF, 0x4A, 0xD3, 0xFF, 0x09, 0xBB, 0xFF, 0x46, 0xAA, 0xFF, 0xEE, 0xFC, 0xFF, 0xE4, 0x91, 0xFF, 0xC5, 0x99, 0xFF, 0xE4, 0x91, 0xFF, 0x23, 0x9A, 0xFF, 0x4C, 0xF4, 0xFF, 0xA4, 0x71, 0xFF, 0xC4, 0x71, 0xFF, 0x83, 0x69, 0xFF, 0x85, 0xA2, 0xFF, 0x89, 0xDB, 0xFF,
-    0xA3, 0x69, 0xFF, 0x25, 0x82, 0xFF, 0x85, 0x92, 0xFF, 0xE5, 0xA2, 0xFF, 0xCA, 0xEB, 0xFF, 0x86, 0x8A, 0xFF, 0x44, 0x8A, 0xFF, 0x2A, 0xB4, 0xFF, 0xAB, 0xD4, 0xFF, 0xA9, 0xE3, 0xFF, 0x05, 0x7A, 0xFF, 0x65, 0x82, 0xFF, 0x23, 0x7A, 0xFF, 0xEF, 0xFD, 0xFF, 0x48, 0xCB, 0xFF, 0x45, 0x8A, 0xFF, 0x23, 0x71, 0xFF, 0xFC, 0xFF, 0xFF, 0xA7, 0xB2, 0xFF, 0x23, 0x71, 0xFF, 0xC2, 0x70, 0xFF, 0x63, 0x91, 0xFF, 0x05, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0xEB, 0xFF, 0xEF, 0xFC, 0xFF, 0xE5, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xDC, 0xFF, 0x43, 0x81, 0xFF, 0x68, 0xA2, 0xFF, 0x29, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xD3, 0xFF, 0x85, 0x81, 0xFF, 0xA5, 0x91, 0xFF, 0xF3, 0xFE, 0xFF, 0x85, 0x89, 0xFF, 0x23, 0x79, 0xFF, 0x02, 0x79, 0xFF, 0xCD, 0xF3, 0xFF, 0x64, 0x81, 0xFF, 0xA5, 0x79, 0xFF, 0x26, 0x9A, 0xFF, 0xEC, 0xCB, 0xFF, 0x63, 0x91, 0xFF, 0xC5, 0x91, 0xFF, 0x26, 0x9A, 0xFF, 0x26, 0xAA, 0xFF, 0xFD, 0xFF, 0xFF, 0x8D, 0xFC, 0xFF, 0x6A, 0xCB, 0xFF, 0x25, 0x92, 0xFF, 0x86, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFD, 0xFF, 0x67, 0x92, 0xFF, 0x87, 0x9A, 0xFF, 0x4C, 0xE4, 0xFF, 0xFE, 0xFF, 0xFF, 0x90, 0xFD, 0xFF, 0x4A, 0xC3, 0xFF, 0x69, 0xCB, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xCE, 0xFC, 0xFF, 0xA7, 0xB2, 0xFF, 0x09, 0xCB, 0xFF, 0xC4, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xDC, 0xFF, 0x66, 0xA2, 0xFF, 0x05, 0x9A, 0xFF, 0x28, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0x82, 0xFF, 0xE5, 0x79, 0xFF, 0xE4, 0x79, 0xFF, 0xEB, 0xDB, 0xFF, 0x42, 0x79, 0xFF, 0x84, 0x69, 0xFF, 0xA4, 0x71, 0xFF, 0x66, 0x92, 0xFF, 0x11, 0xF6, 0xFF, 0xC4, 0x79, 0xFF, 0x45, 0x8A, 0xFF, 0x24, 0x82, 0xFF, 0x05, 0x82, 0xFF, 0x23, 0xA2, 0xFF, 0x04, 0x82, 0xFF, 0x45, 0x8A, 0xFF, 0xE4, 0x81, 0xFF, 0xA6, 0x92, 0xFF, 0x88, 0xD3, 0xFF, 0x25, 0x8A, 0xFF, 0x46, 0x8A, 0xFF, 0x25, 0x8A, 0xFF, 0xE2, 0x60, 0xFF, 0x23, 0x69, 0xFF, 0x24, 0x71, 0xFF, 0x43, 0x79, 0xFF, 0x65, 0x81, 0xFF, 0x23, 0x79, 0xFF, 0x23, 0x81, 0xFF, 0x84, 0x89, 0xFF, 0x06, 0xB2, 0xFF, 0x06, 0xAA, 0xFF, 0x44, 0x89, 0xFF, 0x64, 0x91, 0xFF, 0xA7, 0xCA, 0xFF, 0x48, 0xC2, 0xFF, 0x06, 0x9A, 0xFF, 0x09, 0xCB, 0xFF, 0xA8, 0xBA, 0xFF, 0xA8, 0xCA, 0xFF, 0x85, 0x99, 0xFF, 0x06, 0xA2, 0xFF, 0xE5, 0x99, 0xFF, 0xA9, 0xDA, 0xFF, 0x64, 0x89, 0xFF, 0x43, 0x81, 0xFF, 0xC6, 0x91, 0xFF, 0x6B, 0xE3, 0xFF, 0xA5, 0x91, 0xFF, 0x25, 0x9A, 0xFF, 0x29, 0xC3, 0xFF, 0x84, 0x91, 0xFF, 0x05, 0xB2, 0xFF, 0x67, 0xA2, 0xFF,
-    0x09, 0xC3, 0xFF, 0x49, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0xBA, 0xFF, 0x05, 0x92, 0xFF, 0x86, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFD, 0xFF, 0x27, 0x92, 0xFF, 0x67, 0x9A, 0xFF, 0x49, 0xCB, 0xFF, 0xAB, 0xE3, 0xFF, 0xAA, 0xDB, 0xFF, 0x66, 0x9A, 0xFF, 0xEB, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xDC, 0xFF, 0x46, 0xAA, 0xFF, 0xA4, 0x81, 0xFF, 0x4D, 0xEC, 0xFF, 0xA5, 0x99, 0xFF, 0xC8, 0xCA, 0xFF, 0x08, 0xC3, 0xFF, 0xC4, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0xF4, 0xFF, 0xA3, 0x79, 0xFF, 0x05, 0x8A, 0xFF, 0x0A, 0xDC, 0xFF, 0xC4, 0x89, 0xFF, 0xE4, 0x89, 0xFF, 0x83, 0x79, 0xFF, 0x64, 0x9A, 0xFF, 0x0A, 0xDC, 0xFF, 0xA6, 0xA2, 0xFF, 0x45, 0x8A, 0xFF, 0xC6, 0xAA, 0xFF, 0x0D, 0xEE, 0xFF, 0x25, 0x92, 0xFF, 0x45, 0x8A, 0xFF, 0x05, 0x9B, 0xFF, 0xA5, 0x9A, 0xFF, 0x6D, 0xFD, 0xFF, 0x05, 0x8A, 0xFF, 0xE4, 0x81, 0xFF, 0x45, 0x92, 0xFF, 0xA6, 0x9A, 0xFF, 0xC8, 0xC3, 0xFF, 0xC2, 0x60, 0xFF, 0x07, 0xCA, 0xFF, 0xE3, 0x68, 0xFF, 0x23, 0x81, 0xFF, 0xE3, 0x70, 0xFF, 0x03, 0x79, 0xFF, 0xAA, 0xF2, 0xFF, 0x23, 0x89, 0xFF, 0x4A, 0xCB, 0xFF, 0x84, 0x91, 0xFF, 0x48, 0xC2, 0xFF, 0xA5, 0xA1, 0xFF, 0x03, 0x89, 0xFF, 0x44, 0x81, 0xFF, 0xC9, 0xDA, 0xFF, 0x88, 0xC2, 0xFF,
-    0xA8, 0xCA, 0xFF, 0xC4, 0xB9, 0xFF, 0xCA, 0xEA, 0xFF, 0x07, 0xDA, 0xFF, 0xC9, 0xDA, 0xFF, 0xC6, 0xA1, 0xFF, 0x27, 0xD2, 0xFF, 0x49, 0xE3, 0xFF, 0x06, 0x9A, 0xFF, 0x85, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0xB2, 0xFF, 0x08, 0xBB, 0xFF, 0xE6, 0xA1, 0xFF, 0xFE, 0xFF, 0xFF, 0xC5, 0x91, 0xFF, 0xC5, 0x99, 0xFF, 0x05, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xE4, 0xFF, 0x05, 0x9A, 0xFF, 0x86, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xE3, 0xFF, 0x47, 0x92, 0xFF, 0x47, 0x9A, 0xFF, 0x46, 0xB2, 0xFF, 0x25, 0x9A, 0xFF, 0x87, 0xB2, 0xFF, 0x46, 0x92, 0xFF, 0xC4, 0x91, 0xFF, 0x09, 0xB3, 0xFF, 0x0C, 0xD4, 0xFF, 0x46, 0x9A, 0xFF, 0x46, 0x92, 0xFF, 0xA4, 0x89, 0xFF, 0xE5, 0x91, 0xFF, 0x45, 0x9A, 0xFF, 0xC4, 0x81, 0xFF, 0xE9, 0xBA, 0xFF, 0x25, 0xA2, 0xFF, 0x49, 0xC3, 0xFF, 0x25, 0x92, 0xFF, 0xB9, 0xFF, 0xFF, 0xC3, 0x91, 0xFF, 0x63, 0x71, 0xFF, 0x05, 0x8A, 0xFF, 0xA6, 0xCA, 0xFF, 0x18, 0xF7, 0xFF, 0x45, 0x9A, 0xFF, 0xA5, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xCC, 0xFF, 0xEA, 0xD3, 0xFF, 0x08, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0xC3, 0xFF, 0x4C, 0xDC, 0xFF, 0x25, 0x92, 0xFF, 0x45, 0x9A, 0xFF, 0xFD, 0xFF, 0xFF, 0xA7, 0xB3, 0xFF, 0x45, 0x92, 0xFF,
-    0xE2, 0x68, 0xFF, 0x03, 0x81, 0xFF, 0x03, 0x71, 0xFF, 0xE9, 0xF2, 0xFF, 0xC2, 0x88, 0xFF, 0x65, 0xB9, 0xFF, 0x24, 0x91, 0xFF, 0xE3, 0x88, 0xFF, 0x0A, 0xEB, 0xFF, 0xC4, 0xB1, 0xFF, 0x06, 0xD2, 0xFF, 0x44, 0x91, 0xFF, 0xC9, 0xEA, 0xFF, 0xCC, 0xFB, 0xFF, 0xEA, 0xE2, 0xFF, 0xC9, 0xD2, 0xFF, 0x4B, 0xEB, 0xFF, 0x88, 0xDA, 0xFF, 0x6B, 0xF3, 0xFF, 0xA8, 0xEA, 0xFF, 0xFE, 0xFF, 0xFF, 0x85, 0x99, 0xFF, 0xF1, 0xFC, 0xFF, 0xCB, 0xF2, 0xFF, 0xC5, 0x99, 0xFF, 0xE3, 0x80, 0xFF, 0x44, 0x89, 0xFF, 0x27, 0xC2, 0xFF, 0x09, 0xCB, 0xFF, 0x85, 0x89, 0xFF, 0xC8, 0xBA, 0xFF, 0xC6, 0x99, 0xFF, 0x27, 0xB2, 0xFF, 0x50, 0xED, 0xFF, 0xCC, 0xEB, 0xFF, 0x67, 0xB2, 0xFF, 0xC5, 0x91, 0xFF, 0x88, 0xC2, 0xFF, 0x0E, 0xED, 0xFF, 0x67, 0xB2, 0xFF, 0x06, 0x92, 0xFF, 0x27, 0x92, 0xFF, 0xA8, 0xC2, 0xFF, 0xEF, 0xF4, 0xFF, 0x67, 0xB2, 0xFF, 0x26, 0x9A, 0xFF, 0x25, 0xAA, 0xFF, 0x29, 0xC3, 0xFF, 0xAE, 0xF4, 0xFF, 0x47, 0xAA, 0xFF, 0x87, 0xBA, 0xFF, 0x06, 0x9A, 0xFF, 0x26, 0xA2, 0xFF, 0x2C, 0xE4, 0xFF, 0x87, 0xB2, 0xFF, 0xA5, 0x89, 0xFF, 0xC7, 0xB2, 0xFF, 0x46, 0xA2, 0xFF, 0xAD, 0xFC, 0xFF, 0xC8, 0xC2, 0xFF, 0x04, 0x8A, 0xFF, 0xC5, 0x81, 0xFF, 0xA7, 0xAA, 0xFF, 0xC4, 0x89, 0xFF,
-    0x6A, 0xEB, 0xFF, 0x05, 0x8A, 0xFF, 0xA6, 0xA2, 0xFF, 0x65, 0xA2, 0xFF, 0x28, 0xB3, 0xFF, 0x29, 0xE3, 0xFF, 0x65, 0xA2, 0xFF, 0xA9, 0xBB, 0xFF, 0x45, 0x92, 0xFF, 0x86, 0x9A, 0xFF, 0x4D, 0xF4, 0xFF, 0x25, 0x9A, 0xFF, 0xAA, 0xB3, 0xFF, 0x05, 0x92, 0xFF, 0x45, 0x92, 0xFF, 0xE4, 0x99, 0xFF, 0xE5, 0xB1, 0xFF, 0x58, 0xFF, 0xFF, 0x04, 0x81, 0xFF, 0x03, 0x81, 0xFF, 0x24, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0xBA, 0xFF, 0xFE, 0xFF, 0xFF, 0xED, 0xFB, 0xFF, 0x89, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFB, 0xFF, 0x43, 0xA9, 0xFF, 0x24, 0x99, 0xFF, 0x91, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xEC, 0xF3, 0xFF, 0xEA, 0xF2, 0xFF, 0xA6, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0xEA, 0xFF, 0xC7, 0xC1, 0xFF, 0xA5, 0xA9, 0xFF, 0x27, 0xB2, 0xFF, 0x0B, 0xF3, 0xFF, 0x48, 0xBA, 0xFF, 0xA6, 0x91, 0xFF, 0xC5, 0xB1, 0xFF, 0x4F, 0xFC, 0xFF, 0x43, 0x99, 0xFF, 0xE9, 0xC2, 0xFF, 0xC6, 0xA1, 0xFF, 0x84, 0xA9, 0xFF, 0xB7, 0xFF, 0xFF, 0x4A, 0xEB, 0xFF, 0x47, 0xB2, 0xFF, 0xC9, 0xBA, 0xFF, 0x4B, 0xEB, 0xFF, 0x52, 0xF6, 0xFF, 0xE8, 0xDA, 0xFF, 0x06, 0x92, 0xFF, 0x47, 0x9A, 0xFF, 0x6B, 0xF3, 0xFF, 0xFD, 0xFF, 0xFF, 0x88, 0xBA, 0xFF, 0x06, 0x92, 0xFF, 0xC5, 0xA1, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xEE, 0xF4, 0xFF, 0x06, 0xAA, 0xFF, 0x06, 0x92, 0xFF, 0xE5, 0xA9, 0xFF, 0x10, 0xE6, 0xFF, 0xE8, 0xDA, 0xFF, 0xA4, 0x91, 0xFF, 0xC5, 0x91, 0xFF, 0x86, 0xC2, 0xFF, 0xCE, 0xDD, 0xFF, 0xC7, 0xC2, 0xFF, 0xA4, 0x91, 0xFF, 0xA7, 0xAA, 0xFF, 0xC7, 0xB2, 0xFF, 0xCC, 0xFC, 0xFF, 0xE8, 0xD2, 0xFF, 0x87, 0xA2, 0xFF, 0xA3, 0x81, 0xFF, 0xA6, 0xA2, 0xFF, 0x4A, 0xF4, 0xFF, 0xC7, 0xCA, 0xFF, 0xC4, 0x81, 0xFF, 0xE4, 0x91, 0xFF, 0xC4, 0x89, 0xFF, 0x6B, 0xF4, 0xFF, 0x86, 0xBA, 0xFF, 0xA3, 0x89, 0xFF, 0xC4, 0x89, 0xFF, 0x05, 0x92, 0xFF, 0xF3, 0xFE, 0xFF, 0x25, 0xAA, 0xFF, 0xC4, 0x99, 0xFF, 0x03, 0x79, 0xFF, 0xE3, 0x78, 0xFF, 0xE4, 0x78, 0xFF, 0x04, 0x89, 0xFF, 0x04, 0x81, 0xFF, 0xE3, 0x88, 0xFF, 0x03, 0x91, 0xFF, 0xA6, 0xB9, 0xFF, 0xEA, 0xEA, 0xFF, 0x47, 0xD2, 0xFF, 0x44, 0x99, 0xFF, 0x47, 0xD2, 0xFF, 0x07, 0xD2, 0xFF, 0x48, 0xE2, 0xFF, 0x27, 0xC2, 0xFF, 0xCD, 0xFB, 0xFF, 0xBC, 0xFF, 0xFF, 0x2C, 0xFB, 0xFF, 0xE6, 0xB9, 0xFF, 0x28, 0xE2, 0xFF, 0xFD, 0xFF, 0xFF, 0x28, 0xDA, 0xFF, 0x48, 0xCA, 0xFF, 0x67, 0xCA, 0xFF, 0x27, 0xCA, 0xFF, 0xB8, 0xFF, 0xFF, 0x27, 0xCA, 0xFF, 0x47, 0xCA, 0xFF, 0x27, 0xBA, 0xFF, 0xCE, 0xF4, 0xFF, 0xAC, 0xEB, 0xFF, 0x85, 0x99, 0xFF,
-    0xA6, 0xA9, 0xFF, 0xBE, 0xFF, 0xFF, 0xF0, 0xFC, 0xFF, 0x06, 0xB2, 0xFF, 0xC5, 0x99, 0xFF, 0xE8, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xEB, 0xFF, 0xE6, 0x91, 0xFF, 0x06, 0x9A, 0xFF, 0xBD, 0xFF, 0xFF, 0xAB, 0xEB, 0xFF, 0x2A, 0xEB, 0xFF, 0x06, 0xA2, 0xFF, 0x0C, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xEB, 0xFF, 0xC5, 0x99, 0xFF, 0xE5, 0x99, 0xFF, 0xD9, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xCB, 0xEB, 0xFF, 0x47, 0xAA, 0xFF, 0x46, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0xDB, 0xFF, 0xE5, 0xA1, 0xFF, 0x25, 0xAA, 0xFF, 0x68, 0xCB, 0xFF, 0x47, 0xD3, 0xFF, 0x67, 0xB2, 0xFF, 0xE5, 0x91, 0xFF, 0x46, 0xAA, 0xFF, 0xA6, 0xB2, 0xFF, 0x84, 0xC2, 0xFF, 0x25, 0xB2, 0xFF, 0xE4, 0x91, 0xFF, 0xE4, 0x91, 0xFF, 0xE4, 0x99, 0xFF, 0x2B, 0xF4, 0xFF, 0x04, 0x9A, 0xFF, 0xE5, 0x91, 0xFF, 0x46, 0xAA, 0xFF, 0xCA, 0xEB, 0xFF, 0x45, 0xBA, 0xFF, 0xE5, 0x91, 0xFF, 0xE5, 0x91, 0xFF, 0x05, 0x9A, 0xFF, 0xC2, 0x60, 0xFF, 0xC3, 0x80, 0xFF, 0xE3, 0x70, 0xFF, 0x25, 0xA1, 0xFF, 0xC3, 0x70, 0xFF, 0x03, 0x89, 0xFF, 0x03, 0x79, 0xFF, 0x44, 0xA1, 0xFF, 0xAD, 0xFB, 0xFF, 0xA5, 0xB1, 0xFF, 0xC8, 0xC1, 0xFF, 0x08, 0xEA, 0xFF, 0x23, 0xA1, 0xFF, 0xE4, 0x90, 0xFF, 0xAA, 0xF2, 0xFF, 0xC9, 0xEA, 0xFF,
-    0xAC, 0xFB, 0xFF, 0x65, 0xB1, 0xFF, 0x8A, 0xEA, 0xFF, 0x57, 0xF6, 0xFF, 0x06, 0xD2, 0xFF, 0x86, 0xA9, 0xFF, 0x4B, 0xEB, 0xFF, 0x13, 0xFE, 0xFF, 0xC6, 0xB1, 0xFF, 0xC7, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0xE2, 0xFF, 0xAD, 0xFB, 0xFF, 0x85, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0xA1, 0xFF, 0x85, 0xA1, 0xFF, 0xA5, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0xA9, 0xFF, 0xE6, 0xA1, 0xFF, 0x8B, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xDA, 0xFF, 0xC6, 0x91, 0xFF, 0xC6, 0x91, 0xFF, 0xB9, 0xFF, 0xFF, 0x27, 0xC2, 0xFF, 0xA9, 0xD2, 0xFF, 0xE6, 0xA1, 0xFF, 0x8C, 0xF4, 0xFF, 0x8A, 0xEB, 0xFF, 0x0A, 0xCB, 0xFF, 0x85, 0xA1, 0xFF, 0x84, 0xA1, 0xFF, 0xAB, 0xF3, 0xFF, 0x27, 0xB2, 0xFF, 0xE8, 0xD2, 0xFF, 0x0A, 0xCB, 0xFF, 0x49, 0xE3, 0xFF, 0xED, 0xF4, 0xFF, 0x2D, 0xFC, 0xFF, 0xEA, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0xF4, 0xFF, 0x8A, 0xE3, 0xFF, 0x05, 0xA2, 0xFF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x91, 0xFF, 0xA7, 0xB2, 0xFF, 0x2E, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xA1, 0xFF, 0x86, 0xC2, 0xFF, 0x65, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xBA, 0xFF, 0xC4, 0x99, 0xFF, 0x83, 0x89, 0xFF, 0x05, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0xC2, 0xFF, 0xE7, 0xD2, 0xFF,
-    0xC3, 0x78, 0xFF, 0x82, 0x80, 0xFF, 0xE3, 0x78, 0xFF, 0xC3, 0x70, 0xFF, 0xC3, 0x78, 0xFF, 0x04, 0x89, 0xFF, 0xA6, 0xB1, 0xFF, 0x04, 0x91, 0xFF, 0x69, 0xCA, 0xFF, 0x07, 0xC2, 0xFF, 0xE3, 0x88, 0xFF, 0x25, 0x91, 0xFF, 0x28, 0xCA, 0xFF, 0x04, 0xA1, 0xFF, 0x48, 0xD2, 0xFF, 0x28, 0xD2, 0xFF, 0xAC, 0xFB, 0xFF, 0x45, 0xD1, 0xFF, 0x28, 0xCA, 0xFF, 0x28, 0xE2, 0xFF, 0xDD, 0xFF, 0xFF, 0x65, 0xA9, 0xFF, 0x4B, 0xF3, 0xFF, 0xD2, 0xFD, 0xFF, 0x89, 0xDA, 0xFF, 0x44, 0xA1, 0xFF, 0x85, 0xA9, 0xFF, 0x88, 0xDA, 0xFF, 0x6C, 0xF3, 0xFF, 0x65, 0x99, 0xFF, 0x27, 0xC2, 0xFF, 0x07, 0xC2, 0xFF, 0x65, 0x99, 0xFF, 0x85, 0xA1, 0xFF, 0x88, 0xCA, 0xFF, 0xA4, 0xB1, 0xFF, 0xE6, 0xA1, 0xFF, 0x4B, 0xE3, 0xFF, 0x88, 0xD2, 0xFF, 0xC5, 0xB1, 0xFF, 0xC6, 0x91, 0xFF, 0xE6, 0x91, 0xFF, 0x07, 0xBA, 0xFF, 0xE6, 0xA9, 0xFF, 0xC8, 0xD2, 0xFF, 0xE6, 0xA1, 0xFF, 0x08, 0xDB, 0xFF, 0xA5, 0x99, 0xFF, 0xC5, 0x99, 0xFF, 0x43, 0x91, 0xFF, 0xC5, 0xB9, 0xFF, 0x63, 0xA1, 0xFF, 0xA4, 0x91, 0xFF, 0xE5, 0xA9, 0xFF, 0x67, 0xBA, 0xFF, 0xA5, 0x99, 0xFF, 0x29, 0xE3, 0xFF, 0xC8, 0xDA, 0xFF, 0xA7, 0xCA, 0xFF, 0xC7, 0xD2, 0xFF, 0xA7, 0xC2, 0xFF, 0x67, 0xC2, 0xFF, 0xC4, 0xB1, 0xFF, 0x08, 0xCB, 0xFF,
-    0xC4, 0x99, 0xFF, 0x45, 0xAA, 0xFF, 0x05, 0xAA, 0xFF, 0x07, 0xCB, 0xFF, 0xE4, 0xA1, 0xFF, 0xA7, 0xB2, 0xFF, 0x8C, 0xF4, 0xFF, 0x2C, 0xBC, 0xFF, 0xE5, 0xA1, 0xFF, 0xC4, 0x99, 0xFF, 0x05, 0xA2, 0xFF, 0x48, 0xCB, 0xFF, 0xD9, 0xFF, 0xFF, 0x05, 0x9A, 0xFF, 0xE5, 0xA1, 0xFF, 0xE5, 0x99, 0xFF, 0x65, 0x99, 0xFF, 0xC3, 0x78, 0xFF, 0xA2, 0x70, 0xFF, 0x8A, 0xEA, 0xFF, 0xA6, 0xC1, 0xFF, 0xFD, 0xFF, 0xFF, 0x24, 0x99, 0xFF, 0x4C, 0xF3, 0xFF, 0x0A, 0xEB, 0xFF, 0x09, 0xE2, 0xFF, 0x71, 0xED, 0xFF, 0xA6, 0xB9, 0xFF, 0xEE, 0xF3, 0xFF, 0x0B, 0xEB, 0xFF, 0xC8, 0xE1, 0xFF, 0x7B, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x11, 0xE5, 0xFF, 0x6D, 0xFB, 0xFF, 0x53, 0xEE, 0xFF, 0xE7, 0xD9, 0xFF, 0x04, 0xA1, 0xFF, 0x0C, 0xEB, 0xFF, 0xEC, 0xF2, 0xFF, 0x65, 0xA9, 0xFF, 0x66, 0xB9, 0xFF, 0x65, 0xA1, 0xFF, 0x8D, 0xFB, 0xFF, 0xE6, 0xB9, 0xFF, 0x24, 0x99, 0xFF, 0xC6, 0xB1, 0xFF, 0x04, 0x91, 0xFF, 0xA6, 0xA9, 0xFF, 0xD4, 0xFE, 0xFF, 0x48, 0xBA, 0xFF, 0xA5, 0xA9, 0xFF, 0x89, 0xCA, 0xFF, 0xC9, 0xD2, 0xFF, 0xD4, 0xFE, 0xFF, 0xC5, 0xC1, 0xFF, 0x86, 0x91, 0xFF, 0x48, 0xBA, 0xFF, 0xA6, 0xA1, 0xFF, 0x68, 0xC2, 0xFF, 0x07, 0xB2, 0xFF, 0x48, 0xB2, 0xFF, 0x4B, 0xE3, 0xFF, 0x85, 0x99, 0xFF,
-    0x0D, 0xF4, 0xFF, 0x64, 0xA1, 0xFF, 0x84, 0x99, 0xFF, 0x0A, 0xDB, 0xFF, 0xC5, 0xA9, 0xFF, 0x2D, 0xEC, 0xFF, 0xA4, 0x91, 0xFF, 0x84, 0x91, 0xFF, 0x67, 0xCA, 0xFF, 0x67, 0xC2, 0xFF, 0xC3, 0xA1, 0xFF, 0x26, 0xB2, 0xFF, 0x26, 0xAA, 0xFF, 0xE5, 0xA1, 0xFF, 0xA4, 0x91, 0xFF, 0xA4, 0x99, 0xFF, 0xE4, 0xB1, 0xFF, 0x83, 0x81, 0xFF, 0x67, 0xAA, 0xFF, 0x05, 0xA2, 0xFF, 0xA4, 0x91, 0xFF, 0x84, 0x99, 0xFF, 0x09, 0xC3, 0xFF, 0xA4, 0x91, 0xFF, 0xA4, 0x91, 0xFF, 0x63, 0x91, 0xFF, 0xA4, 0x91, 0xFF, 0xC5, 0x99, 0xFF, 0xC5, 0x99, 0xFF, 0xA4, 0x99, 0xFF, 0x05, 0xA2, 0xFF, 0xE5, 0xA1, 0xFF, 0xE3, 0x80, 0xFF, 0x8D, 0xFC, 0xFF, 0x08, 0xCA, 0xFF, 0x04, 0x89, 0xFF, 0xA3, 0x88, 0xFF, 0x04, 0xB9, 0xFF, 0x25, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0xF2, 0xFF, 0xEB, 0xF2, 0xFF, 0x66, 0xC9, 0xFF, 0xFE, 0xFF, 0xFF, 0x30, 0xFD, 0xFF, 0xC4, 0xA8, 0xFF, 0xC7, 0xD9, 0xFF, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFA, 0xFF, 0x4A, 0xE2, 0xFF, 0x15, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0xC1, 0xFF, 0x07, 0xD2, 0xFF, 0xC8, 0xD9, 0xFF, 0x2C, 0xEB, 0xFF, 0x08, 0xDA, 0xFF, 0x66, 0xB1, 0xFF, 0xA6, 0xC9, 0xFF, 0x44, 0xA9, 0xFF, 0x70, 0xFC, 0xFF, 0xE7, 0xC1, 0xFF, 0x04, 0x91, 0xFF,
-    0xCA, 0xE2, 0xFF, 0xFE, 0xFF, 0xFF, 0x27, 0xD2, 0xFF, 0x44, 0xA1, 0xFF, 0x07, 0xAA, 0xFF, 0x69, 0xEA, 0xFF, 0x9A, 0xFF, 0xFF, 0xC6, 0xC9, 0xFF, 0x65, 0x91, 0xFF, 0x65, 0x99, 0xFF, 0xCB, 0xE3, 0xFF, 0xAF, 0xE4, 0xFF, 0xCA, 0xDA, 0xFF, 0xCA, 0xCA, 0xFF, 0x09, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0xA9, 0xFF, 0xA5, 0xA9, 0xFF, 0x67, 0xC2, 0xFF, 0xEB, 0xE3, 0xFF, 0xFC, 0xFF, 0xFF, 0x43, 0xA1, 0xFF, 0xE6, 0xB1, 0xFF, 0x85, 0xA9, 0xFF, 0x8A, 0xE3, 0xFF, 0x31, 0xF6, 0xFF, 0x88, 0xDA, 0xFF, 0xA4, 0xA1, 0xFF, 0xE5, 0xA9, 0xFF, 0x46, 0xC2, 0xFF, 0xAB, 0xEB, 0xFF, 0x07, 0xC2, 0xFF, 0xA4, 0xA1, 0xFF, 0xE5, 0xA1, 0xFF, 0x67, 0xCA, 0xFF, 0x89, 0xE3, 0xFF, 0xC5, 0xA9, 0xFF, 0x01, 0x89, 0xFF, 0xC5, 0xA9, 0xFF, 0x84, 0xA1, 0xFF, 0x0A, 0xDC, 0xFF, 0x63, 0x99, 0xFF, 0x0B, 0xE5, 0xFF, 0x05, 0xBA, 0xFF, 0xA5, 0x99, 0xFF, 0x49, 0xEB, 0xFF, 0x23, 0x99, 0xFF, 0xE8, 0xE2, 0xFF, 0xC3, 0x90, 0xFF, 0x8E, 0xC3, 0xFF, 0xA3, 0x70, 0xFF, 0x87, 0xF1, 0xFF, 0x62, 0x88, 0xFF, 0xC3, 0x90, 0xFF, 0xC4, 0x90, 0xFF, 0x6F, 0xFE, 0xFF, 0xEA, 0xFA, 0xFF, 0x04, 0xB1, 0xFF, 0x2A, 0xEA, 0xFF, 0xFD, 0xFF, 0xFF, 0xAB, 0xFA, 0xFF, 0xC3, 0x98, 0xFF, 0xE9, 0xE9, 0xFF, 0xFD, 0xFF, 0xFF,
-    0x2C, 0xFB, 0xFF, 0xE4, 0xB8, 0xFF, 0x8B, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xE9, 0xFF, 0xE4, 0xA8, 0xFF, 0x4C, 0xEB, 0xFF, 0x32, 0xF5, 0xFF, 0xE8, 0xD1, 0xFF, 0x08, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xF3, 0xFF, 0xAA, 0xF2, 0xFF, 0x45, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0x25, 0xA1, 0xFF, 0x24, 0xA1, 0xFF, 0xC7, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xCA, 0xFF, 0x49, 0xBA, 0xFF, 0xCA, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xE3, 0xFF, 0x65, 0x91, 0xFF, 0x45, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0xB9, 0xFF, 0x4C, 0xF3, 0xFF, 0xE7, 0xA9, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0xA1, 0xFF, 0x0A, 0xEB, 0xFF, 0x6D, 0xF4, 0xFF, 0xD6, 0xF6, 0xFF, 0xC8, 0xEA, 0xFF, 0x64, 0xA1, 0xFF, 0x84, 0xB1, 0xFF, 0xF3, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF, 0x4B, 0xF3, 0xFF, 0xA7, 0xDA, 0xFF, 0x96, 0xFF, 0xFF, 0xAD, 0xFC, 0xFF, 0x43, 0xA9, 0xFF, 0x26, 0xD2, 0xFF, 0x87, 0xE2, 0xFF, 0xBA, 0xFF, 0xFF, 0x8E, 0xFD, 0xFF, 0x44, 0x99, 0xFF, 0x26, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE5, 0xC1, 0xFF, 0xE5, 0xB9, 0xFF, 0xFE, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0x2D, 0xF5, 0xFF, 0x46, 0xCA, 0xFF, 0x68, 0xDA, 0xFF, 0x0F, 0xED, 0xFF, 0x64, 0xA1, 0xFF, 0x87, 0xE3, 0xFF,
-    0x83, 0x70, 0xFF, 0x83, 0x68, 0xFF, 0x83, 0x70, 0xFF, 0xA3, 0x78, 0xFF, 0xC4, 0x80, 0xFF, 0xC3, 0x88, 0xFF, 0xA3, 0x88, 0xFF, 0x45, 0xA1, 0xFF, 0x16, 0xF6, 0xFF, 0x25, 0xB9, 0xFF, 0x62, 0x88, 0xFF, 0x05, 0xB9, 0xFF, 0xAB, 0xFA, 0xFF, 0xC4, 0x98, 0xFF, 0xC4, 0xA8, 0xFF, 0x6C, 0xD3, 0xFF, 0x2D, 0xFB, 0xFF, 0x87, 0xE1, 0xFF, 0xC8, 0xE1, 0xFF, 0xC8, 0xE1, 0xFF, 0x06, 0xD9, 0xFF, 0xA8, 0xE1, 0xFF, 0x29, 0xEA, 0xFF, 0xAA, 0xF2, 0xFF, 0xA8, 0xE1, 0xFF, 0xC7, 0xC9, 0xFF, 0x25, 0xB1, 0xFF, 0x29, 0xE2, 0xFF, 0xC7, 0xD1, 0xFF, 0x25, 0xA9, 0xFF, 0x25, 0xA9, 0xFF, 0xA7, 0xC1, 0xFF, 0x24, 0xA1, 0xFF, 0xC8, 0xC1, 0xFF, 0xC7, 0xC9, 0xFF, 0x86, 0xB1, 0xFF, 0x28, 0xB2, 0xFF, 0x68, 0xDA, 0xFF, 0x08, 0xD2, 0xFF, 0x07, 0xD2, 0xFF, 0x25, 0x89, 0xFF, 0x24, 0x91, 0xFF, 0x08, 0xCA, 0xFF, 0x03, 0xA9, 0xFF, 0x48, 0xCA, 0xFF, 0x86, 0xB1, 0xFF, 0xC9, 0xDA, 0xFF, 0xA5, 0xB1, 0xFF, 0x85, 0x99, 0xFF, 0x2B, 0xF3, 0xFF, 0x8C, 0xF3, 0xFF, 0x09, 0xEB, 0xFF, 0xC6, 0xB1, 0xFF, 0xE6, 0xC1, 0xFF, 0xA5, 0xA1, 0xFF, 0x85, 0xA9, 0xFF, 0x43, 0xA9, 0xFF, 0x68, 0xD2, 0xFF, 0x68, 0xDA, 0xFF, 0x64, 0xB1, 0xFF, 0x84, 0xA9, 0xFF, 0xE1, 0xA0, 0xFF, 0x87, 0xDA, 0xFF, 0xC5, 0xC1, 0xFF,
-    0x84, 0xA9, 0xFF, 0x47, 0xC2, 0xFF, 0x84, 0xA9, 0xFF, 0xA4, 0xB9, 0xFF, 0x29, 0xE3, 0xFF, 0x46, 0xC2, 0xFF, 0x64, 0xD2, 0xFF, 0x25, 0xC2, 0xFF, 0x63, 0xB1, 0xFF, 0xA4, 0xA9, 0xFF, 0xA5, 0xA9, 0xFF, 0x05, 0xC2, 0xFF, 0x8B, 0xE4, 0xFF, 0xA5, 0xA1, 0xFF, 0x06, 0xC2, 0xFF, 0x25, 0xB2, 0xFF, 0x83, 0x68, 0xFF, 0x87, 0xB9, 0xFF, 0x62, 0x68, 0xFF, 0x62, 0x70, 0xFF, 0xA3, 0x78, 0xFF, 0xC4, 0x88, 0xFF, 0xC4, 0x88, 0xFF, 0xA3, 0x88, 0xFF, 0xC7, 0xB1, 0xFF, 0xE4, 0xA0, 0xFF, 0xA3, 0x98, 0xFF, 0xE4, 0x98, 0xFF, 0x09, 0xCA, 0xFF, 0xC4, 0x90, 0xFF, 0xA3, 0x98, 0xFF, 0x87, 0xC1, 0xFF, 0x29, 0xDA, 0xFF, 0xE5, 0xA8, 0xFF, 0xC8, 0xD1, 0xFF, 0xC4, 0xC0, 0xFF, 0xE5, 0xB0, 0xFF, 0xC4, 0xA0, 0xFF, 0x29, 0xDA, 0xFF, 0xC8, 0xC9, 0xFF, 0x05, 0xB1, 0xFF, 0xA3, 0x98, 0xFF, 0x05, 0xA1, 0xFF, 0x49, 0xD2, 0xFF, 0xE4, 0xA0, 0xFF, 0x05, 0xA9, 0xFF, 0x4A, 0xDA, 0xFF, 0xE4, 0x90, 0xFF, 0xE4, 0x98, 0xFF, 0x25, 0xA1, 0xFF, 0xE4, 0x98, 0xFF, 0x66, 0xB1, 0xFF, 0x65, 0xA1, 0xFF, 0xC7, 0xC1, 0xFF, 0xC7, 0xA9, 0xFF, 0x86, 0xB9, 0xFF, 0x05, 0x89, 0xFF, 0x25, 0x99, 0xFF, 0x04, 0x91, 0xFF, 0x65, 0xA9, 0xFF, 0x66, 0xA1, 0xFF, 0x04, 0x99, 0xFF, 0x44, 0xA9, 0xFF, 0xE4, 0x98, 0xFF,
-    0x87, 0xA9, 0xFF, 0xA6, 0xB9, 0xFF, 0x69, 0xD2, 0xFF, 0x27, 0xD2, 0xFF, 0x48, 0xD2, 0xFF, 0x03, 0x99, 0xFF, 0x85, 0xA9, 0xFF, 0x64, 0xB1, 0xFF, 0x24, 0xA1, 0xFF, 0x03, 0x99, 0xFF, 0x47, 0xCA, 0xFF, 0x24, 0x99, 0xFF, 0xE2, 0x90, 0xFF, 0x03, 0x99, 0xFF, 0x85, 0xA9, 0xFF, 0x64, 0xA1, 0xFF, 0x44, 0x99, 0xFF, 0x85, 0xA1, 0xFF, 0x44, 0x99, 0xFF, 0x03, 0x91, 0xFF, 0x26, 0xBA, 0xFF, 0x64, 0x91, 0xFF, 0x64, 0xA1, 0xFF, 0x64, 0x99, 0xFF, 0x64, 0x99, 0xFF, 0xC6, 0xA9, 0xFF, 0x64, 0x99, 0xFF, 0xA5, 0xA1, 0xFF, 0xA5, 0xA1, 0xFF, 0x85, 0x99, 0xFF, 0x84, 0xA1, 0xFF, 0xA5, 0xA1, 0xFF, 0x26, 0xB9, 0xFF, 0xA8, 0xD9, 0xFF, 0xC3, 0x90, 0xFF, 0x0A, 0xEA, 0xFF, 0xAB, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0xF2, 0xFF, 0xFE, 0xFF, 0xFF, 0x46, 0xD1, 0xFF, 0xC4, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xD8, 0xFF, 0x8A, 0xD2, 0xFF, 0x06, 0xC9, 0xFF, 0x6A, 0xEA, 0xFF, 0xB6, 0xFD, 0xFF, 0xCA, 0xF1, 0xFF, 0xEA, 0xE9, 0xFF, 0x2B, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0xE1, 0xFF, 0x06, 0xB9, 0xFF, 0x8C, 0xEA, 0xFF, 0x6B, 0xEA, 0xFF, 0x88, 0xC9, 0xFF, 0xA4, 0xA0, 0xFF, 0xE4, 0xA8, 0xFF, 0x6B, 0xF2, 0xFF, 0x8B, 0xE2, 0xFF, 0xC4, 0x98, 0xFF, 0xC8, 0xC1, 0xFF, 0xC5, 0x90, 0xFF,
-    0x26, 0xA1, 0xFF, 0xC7, 0xC1, 0xFF, 0x25, 0xA1, 0xFF, 0x05, 0xB1, 0xFF, 0xC8, 0xB9, 0xFF, 0x66, 0xB1, 0xFF, 0x25, 0x99, 0xFF, 0x86, 0xC1, 0xFF, 0xE4, 0x80, 0xFF, 0x05, 0x91, 0xFF, 0x25, 0x89, 0xFF, 0x86, 0xA9, 0xFF, 0xC3, 0x88, 0xFF, 0xE3, 0x98, 0xFF, 0xC3, 0x90, 0xFF, 0xA7, 0xB9, 0xFF, 0x25, 0x91, 0xFF, 0x66, 0xB1, 0xFF, 0x44, 0xB1, 0xFF, 0xE8, 0xD9, 0xFF, 0x45, 0xB9, 0xFF, 0x65, 0xA1, 0xFF, 0x24, 0xA1, 0xFF, 0xE7, 0xD1, 0xFF, 0x65, 0xB9, 0xFF, 0x24, 0xA9, 0xFF, 0xC5, 0xB9, 0xFF, 0x24, 0x99, 0xFF, 0xC3, 0x90, 0xFF, 0x64, 0xA1, 0xFF, 0x44, 0xA1, 0xFF, 0x85, 0xA1, 0xFF, 0x85, 0xA1, 0xFF, 0x24, 0x89, 0xFF, 0x85, 0x99, 0xFF, 0x23, 0x91, 0xFF, 0x64, 0xA1, 0xFF, 0x44, 0x91, 0xFF, 0x64, 0xA1, 0xFF, 0x64, 0x99, 0xFF, 0xC6, 0xB1, 0xFF, 0x64, 0xA1, 0xFF, 0x64, 0x99, 0xFF, 0x85, 0xA9, 0xFF, 0xC6, 0xB1, 0xFF, 0x64, 0xA1, 0xFF, 0x85, 0xA1, 0xFF, 0x84, 0xA1, 0xFF, 0x63, 0x80, 0xFF, 0x5D, 0xFF, 0xFF, 0x63, 0x80, 0xFF, 0x49, 0xD9, 0xFF, 0x93, 0xFA, 0xFF, 0x64, 0xB0, 0xFF, 0x68, 0xD1, 0xFF, 0xFF, 0xF7, 0xFF, 0x95, 0xCD, 0xFF, 0xA5, 0xD0, 0xFF, 0x69, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xE3, 0xFF, 0xA9, 0xE9, 0xFF, 0xEB, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xF6, 0xFF, 0x0B, 0xEA, 0xFF, 0x2B, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xEA, 0xFF, 0xEA, 0xE1, 0xFF, 0x19, 0xF7, 0xFF, 0x27, 0xD1, 0xFF, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFB, 0xFF, 0x47, 0xC1, 0xFF, 0x4E, 0xF3, 0xFF, 0xDF, 0xFF, 0xFF, 0x06, 0xB9, 0xFF, 0x88, 0xC9, 0xFF, 0x9D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x05, 0xC1, 0xFF, 0x66, 0xA1, 0xFF, 0xA8, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xEA, 0xFF, 0xE5, 0x88, 0xFF, 0x66, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xF2, 0xFF, 0xA3, 0x98, 0xFF, 0xC4, 0xA0, 0xFF, 0x31, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0xDA, 0xFF, 0xC8, 0xD1, 0xFF, 0x30, 0xF5, 0xFF, 0xDF, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x11, 0xFD, 0xFF, 0x45, 0xD1, 0xFF, 0xDA, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x70, 0xFD, 0xFF, 0x2C, 0xE4, 0xFF, 0xE5, 0xD1, 0xFF, 0xC7, 0xDA, 0xFF, 0x8B, 0xF3, 0xFF, 0x26, 0xD2, 0xFF, 0x6D, 0xF4, 0xFF, 0x85, 0xD9, 0xFF, 0x68, 0xDA, 0xFF, 0x25, 0xCA, 0xFF, 0x69, 0xE3, 0xFF, 0x08, 0xE2, 0xFF, 0xFC, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0xEA, 0xEB, 0xFF, 0x84, 0xC9, 0xFF, 0xE9, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0xC9, 0xFF, 0xE8, 0xE2, 0xFF, 0x64, 0xA9, 0xFF, 0x27, 0xDA, 0xFF,
-    0x83, 0x60, 0xFF, 0x63, 0x60, 0xFF, 0x63, 0x60, 0xFF, 0x42, 0x70, 0xFF, 0x43, 0x68, 0xFF, 0x42, 0x70, 0xFF, 0x84, 0x78, 0xFF, 0xE5, 0x88, 0xFF, 0x84, 0x88, 0xFF, 0x64, 0x88, 0xFF, 0x63, 0x88, 0xFF, 0x84, 0x90, 0xFF, 0x06, 0xB1, 0xFF, 0xA5, 0x90, 0xFF, 0x84, 0x98, 0xFF, 0x06, 0xC1, 0xFF, 0xC9, 0xD9, 0xFF, 0xC6, 0xB8, 0xFF, 0x27, 0xC9, 0xFF, 0x07, 0xE1, 0xFF, 0x06, 0xC9, 0xFF, 0xA4, 0xA0, 0xFF, 0x88, 0xD9, 0xFF, 0xA9, 0xD9, 0xFF, 0xE6, 0xB8, 0xFF, 0xA4, 0xA0, 0xFF, 0xE5, 0xA8, 0xFF, 0xC9, 0xD9, 0xFF, 0xC5, 0xA0, 0xFF, 0x06, 0xB1, 0xFF, 0xE9, 0xE1, 0xFF, 0xC4, 0x90, 0xFF, 0xC5, 0xA8, 0xFF, 0xC4, 0xA8, 0xFF, 0xC4, 0xB0, 0xFF, 0xA4, 0xA0, 0xFF, 0xE4, 0x98, 0xFF, 0xE5, 0xB8, 0xFF, 0x05, 0xA1, 0xFF, 0x26, 0xB1, 0xFF, 0xE5, 0x88, 0xFF, 0x46, 0xB1, 0xFF, 0x26, 0xA9, 0xFF, 0xE9, 0xC9, 0xFF, 0xA3, 0x90, 0xFF, 0x46, 0xB9, 0xFF, 0x25, 0xC9, 0xFF, 0xE8, 0xD1, 0xFF, 0xA3, 0xA0, 0xFF, 0x49, 0xE2, 0xFF, 0xC3, 0xB0, 0xFF, 0xA7, 0xE1, 0xFF, 0x89, 0xEA, 0xFF, 0x08, 0xDA, 0xFF, 0x45, 0xC9, 0xFF, 0xEB, 0xF2, 0xFF, 0xE7, 0xE1, 0xFF, 0x45, 0xC1, 0xFF, 0x69, 0xF2, 0xFF, 0x28, 0xF2, 0xFF, 0x28, 0xEA, 0xFF, 0x65, 0xC1, 0xFF, 0x47, 0xEA, 0xFF, 0x27, 0xEA, 0xFF,
-    0x85, 0xC9, 0xFF, 0xC5, 0xC9, 0xFF, 0xE6, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0x27, 0xE2, 0xFF, 0xC9, 0xF2, 0xFF, 0x0B, 0xF5, 0xFF, 0x26, 0xDA, 0xFF, 0x26, 0xD2, 0xFF, 0x06, 0xD2, 0xFF, 0xC5, 0xD1, 0xFF, 0x39, 0xFF, 0xFF, 0xC5, 0xD1, 0xFF, 0x89, 0xDB, 0xFF, 0xC5, 0xC1, 0xFF, 0xE7, 0xD9, 0xFF, 0x63, 0x58, 0xFF, 0x63, 0x60, 0xFF, 0x63, 0x60, 0xFF, 0x23, 0x70, 0xFF, 0x64, 0x70, 0xFF, 0x42, 0x70, 0xFF, 0x63, 0x70, 0xFF, 0xC5, 0x88, 0xFF, 0x63, 0x80, 0xFF, 0x63, 0x80, 0xFF, 0x84, 0x88, 0xFF, 0x84, 0x80, 0xFF, 0x06, 0xA1, 0xFF, 0x84, 0x80, 0xFF, 0x64, 0x88, 0xFF, 0xE6, 0xA8, 0xFF, 0xC9, 0xC9, 0xFF, 0x26, 0xB1, 0xFF, 0xC5, 0xA8, 0xFF, 0x84, 0x98, 0xFF, 0x84, 0x98, 0xFF, 0xA4, 0x98, 0xFF, 0x06, 0xB1, 0xFF, 0x06, 0xA9, 0xFF, 0xA4, 0xA0, 0xFF, 0xC5, 0x98, 0xFF, 0xE6, 0xA8, 0xFF, 0x06, 0xA9, 0xFF, 0xA4, 0x98, 0xFF, 0xA4, 0x98, 0xFF, 0x26, 0xA9, 0xFF, 0xA4, 0x88, 0xFF, 0xC5, 0x98, 0xFF, 0x27, 0xB1, 0xFF, 0xA4, 0x98, 0xFF, 0xE5, 0xA8, 0xFF, 0x63, 0x88, 0xFF, 0x26, 0xB9, 0xFF, 0xC5, 0x90, 0xFF, 0x67, 0xC1, 0xFF, 0xC4, 0x80, 0xFF, 0x26, 0xA9, 0xFF, 0x05, 0x99, 0xFF, 0x26, 0xA9, 0xFF, 0xE4, 0x90, 0xFF, 0x46, 0xB1, 0xFF, 0x26, 0xA9, 0xFF, 0x87, 0xB9, 0xFF,
-    0xC4, 0x90, 0xFF, 0x45, 0xA9, 0xFF, 0xE4, 0xA0, 0xFF, 0x05, 0xA9, 0xFF, 0xA7, 0xC9, 0xFF, 0x25, 0xA9, 0xFF, 0xE4, 0xA8, 0xFF, 0xA7, 0xC9, 0xFF, 0xC3, 0x98, 0xFF, 0xE3, 0x98, 0xFF, 0xA2, 0x98, 0xFF, 0x82, 0x98, 0xFF, 0x66, 0xB1, 0xFF, 0x04, 0xA9, 0xFF, 0x45, 0xB1, 0xFF, 0x04, 0xA9, 0xFF, 0x86, 0xB1, 0xFF, 0xA3, 0x88, 0xFF, 0x04, 0x99, 0xFF, 0xE3, 0x98, 0xFF, 0x24, 0xA9, 0xFF, 0x03, 0xA1, 0xFF, 0x24, 0xA1, 0xFF, 0x24, 0xA9, 0xFF, 0x86, 0xB9, 0xFF, 0x04, 0xA1, 0xFF, 0x24, 0xA9, 0xFF, 0x24, 0xA1, 0xFF, 0x24, 0xA1, 0xFF, 0x44, 0xA1, 0xFF, 0x45, 0xA1, 0xFF, 0x45, 0xA1, 0xFF, 0x63, 0x60, 0xFF, 0x84, 0x68, 0xFF, 0x43, 0x68, 0xFF, 0x84, 0x80, 0xFF, 0xA5, 0x88, 0xFF, 0x84, 0x98, 0xFF, 0x44, 0x80, 0xFF, 0x85, 0x98, 0xFF, 0x63, 0x88, 0xFF, 0xA5, 0x98, 0xFF, 0x84, 0xA0, 0xFF, 0x64, 0x88, 0xFF, 0x27, 0xB9, 0xFF, 0x84, 0x88, 0xFF, 0x23, 0x88, 0xFF, 0xC6, 0xB0, 0xFF, 0x89, 0xD1, 0xFF, 0xA5, 0xA0, 0xFF, 0x85, 0xA0, 0xFF, 0x85, 0xA8, 0xFF, 0xC6, 0xC0, 0xFF, 0xA5, 0xA0, 0xFF, 0x07, 0xB9, 0xFF, 0x06, 0xB1, 0xFF, 0xA5, 0xA8, 0xFF, 0x84, 0x90, 0xFF, 0x63, 0x90, 0xFF, 0xC5, 0xA0, 0xFF, 0x64, 0x98, 0xFF, 0xA4, 0x90, 0xFF, 0xA5, 0x90, 0xFF, 0xA4, 0x88, 0xFF,
-    0xA4, 0x90, 0xFF, 0x06, 0xA9, 0xFF, 0x84, 0x98, 0xFF, 0xC5, 0xA0, 0xFF, 0xA4, 0x88, 0xFF, 0xC5, 0xA8, 0xFF, 0xA4, 0x88, 0xFF, 0xE5, 0xA0, 0xFF, 0xC4, 0x80, 0xFF, 0xC5, 0xA0, 0xFF, 0xA4, 0x90, 0xFF, 0xE5, 0xA0, 0xFF, 0xE5, 0x88, 0xFF, 0x47, 0xB1, 0xFF, 0x05, 0xA9, 0xFF, 0xC8, 0xC1, 0xFF, 0xC4, 0x98, 0xFF, 0x46, 0xB1, 0xFF, 0x25, 0xA9, 0xFF, 0x63, 0x90, 0xFF, 0x87, 0xC9, 0xFF, 0xA4, 0x90, 0xFF, 0x05, 0xA9, 0xFF, 0x66, 0xB9, 0xFF, 0xE4, 0xA0, 0xFF, 0x66, 0xC1, 0xFF, 0xC3, 0x98, 0xFF, 0x05, 0xA9, 0xFF, 0x25, 0xA9, 0xFF, 0xC3, 0xA0, 0xFF, 0x66, 0xB9, 0xFF, 0xE4, 0xA0, 0xFF, 0x24, 0xA9, 0xFF, 0xA3, 0x88, 0xFF, 0xA3, 0x90, 0xFF, 0x25, 0xA1, 0xFF, 0x05, 0xA1, 0xFF, 0x04, 0xA1, 0xFF, 0xE4, 0x98, 0xFF, 0x25, 0xA9, 0xFF, 0x04, 0xA1, 0xFF, 0x04, 0xA1, 0xFF, 0x04, 0xA1, 0xFF, 0x04, 0xA1, 0xFF, 0x24, 0xA1, 0xFF, 0x24, 0xA1, 0xFF, 0x45, 0xA1, 0xFF, 0x45, 0xA1, 0xFF, 0x84, 0x90, 0xFF, 0x48, 0xD1, 0xFF, 0x89, 0xD1, 0xFF, 0x64, 0x98, 0xFF, 0x4C, 0xEA, 0xFF, 0xDD, 0xFF, 0xFF, 0xAA, 0xE9, 0xFF, 0x2C, 0xF2, 0xFF, 0x84, 0xA8, 0xFF, 0x23, 0xA0, 0xFF, 0xB6, 0xED, 0xFF, 0xF8, 0xFD, 0xFF, 0xAA, 0xD9, 0xFF, 0x0C, 0xEA, 0xFF, 0x69, 0xE9, 0xFF, 0xCD, 0xE1, 0xFF,
-    0xA9, 0xC9, 0xFF, 0x0D, 0xE3, 0xFF, 0xEC, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0xE9, 0xFF, 0xCB, 0xE9, 0xFF, 0xEC, 0xE9, 0xFF, 0xC7, 0xC8, 0xFF, 0x6C, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0xF2, 0xFF, 0xCB, 0xE9, 0xFF, 0x8D, 0xF2, 0xFF, 0x9E, 0xFF, 0xFF, 0x07, 0xC1, 0xFF, 0x28, 0xC9, 0xFF, 0xEF, 0xE2, 0xFF, 0x79, 0xEE, 0xFF, 0xAA, 0xF1, 0xFF, 0xA4, 0x90, 0xFF, 0x48, 0xE1, 0xFF, 0x5A, 0xFF, 0xFF, 0xA9, 0xD9, 0xFF, 0xA4, 0x80, 0xFF, 0x07, 0xC9, 0xFF, 0xDC, 0xFF, 0xFF, 0x88, 0xE9, 0xFF, 0xE5, 0x90, 0xFF, 0x2A, 0xEA, 0xFF, 0x2C, 0xD3, 0xFF, 0x4E, 0xDB, 0xFF, 0x47, 0xD1, 0xFF, 0x05, 0xB9, 0xFF, 0xBC, 0xFF, 0xFF, 0xA6, 0xD1, 0xFF, 0x4A, 0xF2, 0xFF, 0xC4, 0x98, 0xFF, 0x86, 0xD9, 0xFF, 0x67, 0xE1, 0xFF, 0x87, 0xE9, 0xFF, 0x49, 0xEA, 0xFF, 0xC4, 0xC0, 0xFF, 0xE8, 0xF1, 0xFF, 0x83, 0xA8, 0xFF, 0x25, 0xB1, 0xFF, 0x06, 0xC1, 0xFF, 0x66, 0xC9, 0xFF, 0x04, 0xB9, 0xFF, 0x04, 0xA1, 0xFF, 0xC3, 0x98, 0xFF, 0xE4, 0xA8, 0xFF, 0x66, 0xB9, 0xFF, 0x66, 0xC1, 0xFF, 0xE4, 0x98, 0xFF, 0x65, 0xB9, 0xFF, 0xE4, 0xA0, 0xFF, 0x04, 0xA1, 0xFF, 0x25, 0xB1, 0xFF, 0x24, 0xB1, 0xFF, 0x04, 0xA9, 0xFF, 0x24, 0xA1, 0xFF, 0x45, 0xA1, 0xFF, 0x44, 0xA9, 0xFF,
-    0x43, 0x58, 0xFF, 0x64, 0x60, 0xFF, 0x84, 0x68, 0xFF, 0x28, 0x99, 0xFF, 0x64, 0x78, 0xFF, 0xE6, 0x98, 0xFF, 0x44, 0x78, 0xFF, 0x64, 0x80, 0xFF, 0x02, 0x78, 0xFF, 0x64, 0x88, 0xFF, 0xC6, 0xA0, 0xFF, 0x64, 0x78, 0xFF, 0x44, 0x90, 0xFF, 0x65, 0x78, 0xFF, 0x44, 0x90, 0xFF, 0xE7, 0xA8, 0xFF, 0xE7, 0xB0, 0xFF, 0x44, 0x90, 0xFF, 0x65, 0x98, 0xFF, 0x24, 0x90, 0xFF, 0x85, 0xA0, 0xFF, 0x86, 0xA0, 0xFF, 0xC6, 0xA8, 0xFF, 0x07, 0xB1, 0xFF, 0x65, 0x98, 0xFF, 0xC6, 0xA0, 0xFF, 0x64, 0x98, 0xFF, 0x44, 0x88, 0xFF, 0x85, 0x98, 0xFF, 0x64, 0x90, 0xFF, 0x44, 0x90, 0xFF, 0xA6, 0x88, 0xFF, 0xA5, 0x98, 0xFF, 0xC6, 0xB0, 0xFF, 0x85, 0xA0, 0xFF, 0xA5, 0x98, 0xFF, 0x44, 0x90, 0xFF, 0xA5, 0xA8, 0xFF, 0xA5, 0x90, 0xFF, 0x64, 0xA8, 0xFF, 0x84, 0x80, 0xFF, 0x43, 0x98, 0xFF, 0xE6, 0xC0, 0xFF, 0xC5, 0xD0, 0xFF, 0xA4, 0x88, 0xFF, 0xE6, 0xA8, 0xFF, 0x27, 0xD1, 0xFF, 0x65, 0xC8, 0xFF, 0xD0, 0xFD, 0xFF, 0xA4, 0xA0, 0xFF, 0xE5, 0xB8, 0xFF, 0xC4, 0xC0, 0xFF, 0x46, 0xD1, 0xFF, 0x0C, 0xEB, 0xFF, 0x06, 0xD9, 0xFF, 0xA4, 0xD0, 0xFF, 0x88, 0xCA, 0xFF, 0x4B, 0xE3, 0xFF, 0x8A, 0xE2, 0xFF, 0x06, 0xCA, 0xFF, 0x28, 0xDA, 0xFF, 0x48, 0xEA, 0xFF, 0x49, 0xEA, 0xFF, 0xC9, 0xD2, 0xFF,
-    0xA6, 0xD1, 0xFF, 0x66, 0xC1, 0xFF, 0xEB, 0xF2, 0xFF, 0x62, 0xB0, 0xFF, 0xCF, 0xFC, 0xFF, 0x0A, 0xE3, 0xFF, 0x8C, 0xE4, 0xFF, 0x07, 0xE2, 0xFF, 0x43, 0xC9, 0xFF, 0x79, 0xFF, 0xFF, 0x70, 0xFE, 0xFF, 0xFD, 0xFF, 0xFF, 0x83, 0xB8, 0xFF, 0xA5, 0xC2, 0xFF, 0xE7, 0xE1, 0xFF, 0xFD, 0xFF, 0xFF, 0x23, 0x58, 0xFF, 0x43, 0x60, 0xFF, 0x85, 0x70, 0xFF, 0x28, 0xA1, 0xFF, 0x44, 0x70, 0xFF, 0x48, 0xB1, 0xFF, 0x23, 0x70, 0xFF, 0x85, 0x80, 0xFF, 0x03, 0x80, 0xFF, 0x24, 0x80, 0xFF, 0x28, 0xB1, 0xFF, 0x24, 0x78, 0xFF, 0x24, 0x90, 0xFF, 0x44, 0x70, 0xFF, 0x44, 0x78, 0xFF, 0xC6, 0xA8, 0xFF, 0x69, 0xC9, 0xFF, 0x03, 0x80, 0xFF, 0x24, 0x90, 0xFF, 0x03, 0x90, 0xFF, 0x65, 0x98, 0xFF, 0x24, 0x90, 0xFF, 0xC6, 0xB8, 0xFF, 0x07, 0xB1, 0xFF, 0x85, 0xA0, 0xFF, 0x85, 0x98, 0xFF, 0x44, 0x90, 0xFF, 0x44, 0x88, 0xFF, 0x44, 0x98, 0xFF, 0x45, 0x98, 0xFF, 0x24, 0x90, 0xFF, 0x65, 0x88, 0xFF, 0xA6, 0x98, 0xFF, 0xA6, 0xA8, 0xFF, 0x65, 0x90, 0xFF, 0xA5, 0x98, 0xFF, 0x44, 0x90, 0xFF, 0x85, 0xB8, 0xFF, 0xE6, 0xA0, 0xFF, 0x28, 0xD9, 0xFF, 0x64, 0x78, 0xFF, 0x65, 0xA8, 0xFF, 0xA5, 0x98, 0xFF, 0xE6, 0xB8, 0xFF, 0x64, 0x88, 0xFF, 0xC6, 0xB0, 0xFF, 0x48, 0xC9, 0xFF, 0x43, 0x90, 0xFF,
-    0xC6, 0xB8, 0xFF, 0x84, 0xA0, 0xFF, 0x84, 0xA0, 0xFF, 0x84, 0x98, 0xFF, 0x84, 0xB0, 0xFF, 0x07, 0xB9, 0xFF, 0xE5, 0xB8, 0xFF, 0xC5, 0xB8, 0xFF, 0xE5, 0xB8, 0xFF, 0xA4, 0xA8, 0xFF, 0xC5, 0xB8, 0xFF, 0x63, 0xA0, 0xFF, 0xC4, 0xA0, 0xFF, 0xA4, 0xA8, 0xFF, 0xE5, 0xA8, 0xFF, 0xE5, 0xB8, 0xFF, 0x43, 0x98, 0xFF, 0xE4, 0xA8, 0xFF, 0xA3, 0x98, 0xFF, 0xA3, 0xA0, 0xFF, 0xC4, 0xA8, 0xFF, 0xC4, 0xA0, 0xFF, 0xC4, 0x98, 0xFF, 0x25, 0xB9, 0xFF, 0xA4, 0xA8, 0xFF, 0xC4, 0xA0, 0xFF, 0xC4, 0xA8, 0xFF, 0x04, 0xA1, 0xFF, 0x05, 0xA9, 0xFF, 0xE4, 0xA8, 0xFF, 0x25, 0xA9, 0xFF, 0x25, 0xA9, 0xFF, 0x44, 0x70, 0xFF, 0x05, 0x98, 0xFF, 0x65, 0x80, 0xFF, 0xC7, 0xB0, 0xFF, 0x65, 0x88, 0xFF, 0xAB, 0xE1, 0xFF, 0x24, 0x90, 0xFF, 0x66, 0x98, 0xFF, 0x6C, 0xE9, 0xFF, 0x48, 0xC0, 0xFF, 0xED, 0xF1, 0xFF, 0x49, 0xC0, 0xFF, 0x07, 0xD0, 0xFF, 0x24, 0x90, 0xFF, 0x45, 0x88, 0xFF, 0xEB, 0xD1, 0xFF, 0x38, 0xF4, 0xFF, 0x67, 0xC0, 0xFF, 0x48, 0xD8, 0xFF, 0x0E, 0xE2, 0xFF, 0xAA, 0xF0, 0xFF, 0x05, 0xA0, 0xFF, 0xCA, 0xE0, 0xFF, 0xEA, 0xE0, 0xFF, 0x65, 0xA0, 0xFF, 0x66, 0xA8, 0xFF, 0x45, 0xA8, 0xFF, 0x03, 0x98, 0xFF, 0x45, 0xA0, 0xFF, 0x65, 0xA0, 0xFF, 0x25, 0xA8, 0xFF, 0x65, 0x90, 0xFF,
-    0xA7, 0xC0, 0xFF, 0xA6, 0xB8, 0xFF, 0x65, 0xB0, 0xFF, 0x66, 0xB0, 0xFF, 0x44, 0x90, 0xFF, 0x67, 0xD8, 0xFF, 0xC7, 0xB0, 0xFF, 0x08, 0xD9, 0xFF, 0x44, 0x80, 0xFF, 0x86, 0xD0, 0xFF, 0x65, 0xA8, 0xFF, 0x86, 0xC8, 0xFF, 0x64, 0x90, 0xFF, 0x24, 0xA8, 0xFF, 0x28, 0xD9, 0xFF, 0x44, 0xA0, 0xFF, 0x27, 0xC9, 0xFF, 0x43, 0x98, 0xFF, 0x23, 0xA0, 0xFF, 0x84, 0x98, 0xFF, 0x63, 0xA0, 0xFF, 0xA4, 0x98, 0xFF, 0x65, 0xC8, 0xFF, 0x84, 0xA8, 0xFF, 0x83, 0xA0, 0xFF, 0x63, 0xB0, 0xFF, 0x27, 0xD1, 0xFF, 0xC5, 0xB8, 0xFF, 0xE5, 0xB8, 0xFF, 0x63, 0xB0, 0xFF, 0x84, 0xA8, 0xFF, 0xC5, 0xB8, 0xFF, 0x26, 0xC1, 0xFF, 0x63, 0x98, 0xFF, 0x63, 0x98, 0xFF, 0xA4, 0xA8, 0xFF, 0x83, 0xA0, 0xFF, 0x83, 0x98, 0xFF, 0xA4, 0xA0, 0xFF, 0x83, 0xB0, 0xFF, 0xE4, 0xA8, 0xFF, 0xC4, 0xA0, 0xFF, 0xC4, 0xA8, 0xFF, 0xC4, 0xA8, 0xFF, 0xE4, 0xA8, 0xFF, 0xE5, 0xA8, 0xFF, 0x05, 0xB1, 0xFF, 0x05, 0xA9, 0xFF, 0x24, 0xA0, 0xFF, 0xE6, 0xD8, 0xFF, 0x06, 0xA8, 0xFF, 0x64, 0x98, 0xFF, 0x45, 0x88, 0xFF, 0x0E, 0xEB, 0xFF, 0x23, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xC8, 0xFF, 0x47, 0xC8, 0xFF, 0x4F, 0xDB, 0xFF, 0x89, 0xD9, 0xFF, 0x0A, 0xE9, 0xFF, 0xEA, 0xE0, 0xFF, 0x27, 0xC8, 0xFF, 0x09, 0xD0, 0xFF,
-    0x54, 0xDC, 0xFF, 0x96, 0xFE, 0xFF, 0x34, 0xFD, 0xFF, 0x7C, 0xF6, 0xFF, 0x69, 0xE0, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xCE, 0xF1, 0xFF, 0x47, 0xC0, 0xFF, 0x06, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0xD8, 0xFF, 0x45, 0xA8, 0xFF, 0x06, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xE1, 0xFF, 0xA8, 0xD8, 0xFF, 0x69, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0xE0, 0xFF, 0x45, 0x98, 0xFF, 0x2A, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0xD8, 0xFF, 0x65, 0x88, 0xFF, 0x29, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xD8, 0xFF, 0x65, 0x98, 0xFF, 0x04, 0xC0, 0xFF, 0xBE, 0xFF, 0xFF, 0x04, 0xB8, 0xFF, 0x8A, 0xF1, 0xFF, 0xC7, 0xE0, 0xFF, 0xDD, 0xFF, 0xFF, 0x64, 0xB8, 0xFF, 0x65, 0xC8, 0xFF, 0xE7, 0xE0, 0xFF, 0xE9, 0xD1, 0xFF, 0x47, 0xE1, 0xFF, 0x30, 0xFE, 0xFF, 0x64, 0xC0, 0xFF, 0xC9, 0xE9, 0xFF, 0x46, 0xE9, 0xFF, 0xE5, 0xD8, 0xFF, 0x02, 0xC0, 0xFF, 0x94, 0xED, 0xFF, 0x0A, 0xB4, 0xFF, 0x47, 0xF1, 0xFF, 0xE5, 0xE0, 0xFF, 0xE4, 0xD8, 0xFF, 0x26, 0xE1, 0xFF, 0x63, 0xB0, 0xFF, 0xC4, 0xB0, 0xFF, 0xF5, 0xFF, 0xFF, 0x23, 0xC1, 0xFF, 0xC6, 0xD8, 0xFF, 0x69, 0xDB, 0xFF, 0xC4, 0xC0, 0xFF, 0xA4, 0xC0, 0xFF, 0xE5, 0xC0, 0xFF, 0x67, 0xE9, 0xFF, 0xE5, 0xC0, 0xFF, 0xE5, 0xB8, 0xFF,
-    0x44, 0x60, 0xFF, 0xE9, 0xD0, 0xFF, 0x67, 0xC0, 0xFF, 0x02, 0x80, 0xFF, 0x88, 0xB0, 0xFF, 0xC7, 0xB8, 0xFF, 0x29, 0xE1, 0xFF, 0xA9, 0xE0, 0xFF, 0xE8, 0xC0, 0xFF, 0x04, 0x88, 0xFF, 0xE9, 0xC0, 0xFF, 0x48, 0xB9, 0xFF, 0x4B, 0xE9, 0xFF, 0x2B, 0xE9, 0xFF, 0x26, 0xA8, 0xFF, 0x87, 0xB8, 0xFF, 0x4F, 0xFA, 0xFF, 0x8B, 0xE1, 0xFF, 0x6C, 0xE9, 0xFF, 0x29, 0xC0, 0xFF, 0x06, 0xB8, 0xFF, 0x05, 0xA0, 0xFF, 0xAC, 0xE9, 0xFF, 0x6C, 0xE9, 0xFF, 0xEF, 0xF9, 0xFF, 0x05, 0x90, 0xFF, 0x24, 0x90, 0xFF, 0xEA, 0xD0, 0xFF, 0x8C, 0xE9, 0xFF, 0x25, 0x98, 0xFF, 0x05, 0x98, 0xFF, 0x45, 0x80, 0xFF, 0x46, 0xB0, 0xFF, 0x2F, 0xEA, 0xFF, 0x04, 0xB8, 0xFF, 0xC7, 0xB0, 0xFF, 0x45, 0x98, 0xFF, 0x88, 0xD0, 0xFF, 0xEC, 0xD1, 0xFF, 0xC8, 0xD8, 0xFF, 0x45, 0x88, 0xFF, 0xA8, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xE8, 0xFF, 0x85, 0xA0, 0xFF, 0x25, 0xA8, 0xFF, 0xE9, 0xE0, 0xFF, 0xDF, 0xFF, 0xFF, 0x4D, 0xFA, 0xFF, 0x65, 0xB8, 0xFF, 0x25, 0xC8, 0xFF, 0xDE, 0xFF, 0xFF, 0xB2, 0xF4, 0xFF, 0x44, 0xA8, 0xFF, 0x07, 0xE1, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xD0, 0xFF, 0xE6, 0xD8, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xE3, 0xFF, 0x05, 0xC9, 0xFF, 0x98, 0xFE, 0xFF,
-    0xE8, 0xDA, 0xFF, 0x08, 0xEA, 0xFF, 0x45, 0xD1, 0xFF, 0xB4, 0xEE, 0xFF, 0x69, 0xEA, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xEA, 0xFF, 0xF2, 0xE5, 0xFF, 0x4D, 0xDC, 0xFF, 0xA5, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xE1, 0xFF, 0x73, 0xFF, 0xFF, 0x27, 0xD9, 0xFF, 0xD6, 0xFF, 0xFF, 0x44, 0x60, 0xFF, 0x64, 0x60, 0xFF, 0x65, 0x70, 0xFF, 0x03, 0x70, 0xFF, 0x85, 0x78, 0xFF, 0xE8, 0xB0, 0xFF, 0x44, 0x70, 0xFF, 0x04, 0x78, 0xFF, 0x6F, 0xF3, 0xFF, 0x2A, 0xC0, 0xFF, 0x46, 0xA0, 0xFF, 0x45, 0x88, 0xFF, 0x27, 0xB0, 0xFF, 0x25, 0x80, 0xFF, 0x26, 0xA0, 0xFF, 0x68, 0xC8, 0xFF, 0xDB, 0xFC, 0xFF, 0x67, 0xA0, 0xFF, 0x47, 0xA8, 0xFF, 0x07, 0xD0, 0xFF, 0x88, 0xB8, 0xFF, 0x26, 0x90, 0xFF, 0x0A, 0xC9, 0xFF, 0x0A, 0xC1, 0xFF, 0x66, 0x98, 0xFF, 0x04, 0x80, 0xFF, 0x05, 0x90, 0xFF, 0x03, 0x80, 0xFF, 0x26, 0x90, 0xFF, 0x26, 0x98, 0xFF, 0x05, 0x98, 0xFF, 0x25, 0x88, 0xFF, 0x87, 0xA8, 0xFF, 0x67, 0xA8, 0xFF, 0x46, 0xA8, 0xFF, 0x87, 0xB8, 0xFF, 0x66, 0x98, 0xFF, 0xCA, 0xE8, 0xFF, 0xA7, 0xA8, 0xFF, 0xE9, 0xE0, 0xFF, 0x65, 0x90, 0xFF, 0x47, 0xD0, 0xFF, 0x6B, 0xE1, 0xFF, 0xEB, 0xE0, 0xFF, 0x86, 0xA8, 0xFF, 0x04, 0xA8, 0xFF, 0x25, 0xB0, 0xFF, 0x48, 0xE0, 0xFF,
-    0x9E, 0xFF, 0xFF, 0x66, 0xC0, 0xFF, 0x66, 0xB8, 0xFF, 0x65, 0xB0, 0xFF, 0x44, 0xA8, 0xFF, 0xAC, 0xE2, 0xFF, 0xE8, 0xE8, 0xFF, 0x86, 0xC8, 0xFF, 0x24, 0xB8, 0xFF, 0x45, 0xC8, 0xFF, 0x2A, 0xE2, 0xFF, 0xA5, 0xC0, 0xFF, 0x44, 0xA8, 0xFF, 0x85, 0xB8, 0xFF, 0x4A, 0xEA, 0xFF, 0xAA, 0xDA, 0xFF, 0x01, 0xA0, 0xFF, 0x84, 0xB0, 0xFF, 0xA5, 0xC0, 0xFF, 0xCB, 0xF2, 0xFF, 0x0F, 0xFC, 0xFF, 0xC5, 0xC8, 0xFF, 0xA4, 0xD0, 0xFF, 0xC6, 0xD8, 0xFF, 0xAF, 0xCB, 0xFF, 0xB1, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0x0E, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x86, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x68, 0xFF, 0x04, 0x80, 0xFF, 0x25, 0x70, 0xFF, 0xD2, 0xEA, 0xFF, 0x09, 0xA8, 0xFF, 0xA8, 0xC0, 0xFF, 0x24, 0x78, 0xFF, 0x27, 0xA0, 0xFF, 0x58, 0xF4, 0xFF, 0x04, 0x90, 0xFF, 0x47, 0xB8, 0xFF, 0x06, 0x98, 0xFF, 0x2C, 0xC8, 0xFF, 0x29, 0xC0, 0xFF, 0x06, 0x88, 0xFF, 0x6D, 0xD8, 0xFF, 0x1B, 0xEE, 0xFF, 0x29, 0xC8, 0xFF, 0x28, 0xB8, 0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x98, 0xFF, 0x28, 0xD0, 0xFF, 0xAA, 0xE0, 0xFF, 0x49, 0xB8, 0xFF, 0x26, 0x90, 0xFF, 0x06, 0x98, 0xFF, 0x06, 0xA8, 0xFF, 0x68, 0xB8, 0xFF, 0x26, 0xA0, 0xFF, 0x05, 0x88, 0xFF, 0x88, 0xB0, 0xFF,
-    0xE9, 0xD8, 0xFF, 0x47, 0xA8, 0xFF, 0x69, 0xE8, 0xFF, 0x47, 0xC8, 0xFF, 0xC8, 0xB0, 0xFF, 0xCA, 0xE8, 0xFF, 0x8A, 0xE0, 0xFF, 0x26, 0xC0, 0xFF, 0x45, 0x90, 0xFF, 0x68, 0xE0, 0xFF, 0xA9, 0xD1, 0xFF, 0x88, 0xE0, 0xFF, 0x46, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xC0, 0xFF, 0x04, 0xA8, 0xFF, 0x86, 0xD8, 0xFF, 0x25, 0xC8, 0xFF, 0xA7, 0xC8, 0xFF, 0x24, 0xB0, 0xFF, 0xE7, 0xD1, 0xFF, 0x45, 0xC8, 0xFF, 0x87, 0xE8, 0xFF, 0xFF, 0xF7, 0xFF, 0xA7, 0xE8, 0xFF, 0x08, 0xE9, 0xFF, 0x86, 0xE0, 0xFF, 0x86, 0xE8, 0xFF, 0x03, 0xB8, 0xFF, 0xA5, 0xC8, 0xFF, 0x33, 0xFD, 0xFF, 0x44, 0xB0, 0xFF, 0x43, 0xB0, 0xFF, 0xA5, 0xC8, 0xFF, 0x23, 0xC8, 0xFF, 0x85, 0xB8, 0xFF, 0xA5, 0xB8, 0xFF, 0x64, 0xA0, 0xFF, 0x64, 0xB0, 0xFF, 0x64, 0xC8, 0xFF, 0x64, 0xB8, 0xFF, 0xA5, 0xC8, 0xFF, 0xC5, 0xC8, 0xFF, 0x85, 0xC0, 0xFF, 0xC5, 0xC8, 0xFF, 0xA5, 0xC0, 0xFF, 0xC5, 0xC8, 0xFF, 0xC5, 0xC8, 0xFF, 0x06, 0x78, 0xFF, 0x04, 0x70, 0xFF, 0x66, 0x88, 0xFF, 0x05, 0x80, 0xFF, 0xCC, 0xD9, 0xFF, 0x0A, 0xC9, 0xFF, 0x24, 0x70, 0xFF, 0x46, 0xA0, 0xFF, 0x88, 0xA8, 0xFF, 0x0D, 0xD0, 0xFF, 0x08, 0xB0, 0xFF, 0x06, 0x98, 0xFF, 0x06, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xCB, 0xD8, 0xFF,
-    0x0D, 0xF9, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0x07, 0xA8, 0xFF, 0x3C, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0xC8, 0xFF, 0x88, 0xA0, 0xFF, 0x06, 0xA8, 0xFF, 0xFF, 0xF7, 0xFF, 0x06, 0x98, 0xFF, 0x27, 0xB0, 0xFF, 0x29, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xA0, 0xFF, 0x2C, 0xE9, 0xFF, 0x49, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xC0, 0xFF, 0xC8, 0xB0, 0xFF, 0x8A, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0xD0, 0xFF, 0x45, 0x90, 0xFF, 0xAB, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0xE0, 0xFF, 0x87, 0xA8, 0xFF, 0x47, 0xD0, 0xFF, 0xFF, 0xF7, 0xFF, 0x04, 0xB0, 0xFF, 0x66, 0xC8, 0xFF, 0x24, 0xB8, 0xFF, 0xDE, 0xFF, 0xFF, 0x45, 0xB8, 0xFF, 0x44, 0xA8, 0xFF, 0xA7, 0xE0, 0xFF, 0x08, 0xE1, 0xFF, 0x25, 0xC0, 0xFF, 0xA7, 0xE0, 0xFF, 0xA7, 0xE0, 0xFF, 0x24, 0xD0, 0xFF, 0x25, 0xD8, 0xFF, 0x85, 0xE0, 0xFF, 0x86, 0xE0, 0xFF, 0x44, 0xB0, 0xFF, 0xC8, 0xB9, 0xFF, 0xE6, 0xE8, 0xFF, 0x03, 0xC8, 0xFF, 0x64, 0xD0, 0xFF, 0x0B, 0xEC, 0xFF, 0xA6, 0xD8, 0xFF, 0x64, 0xA8, 0xFF, 0x23, 0xB0, 0xFF, 0x26, 0xE1, 0xFF, 0x44, 0xC8, 0xFF, 0x84, 0xB0, 0xFF, 0x85, 0xD0, 0xFF, 0x65, 0xD0, 0xFF, 0x85, 0xC8, 0xFF, 0x64, 0xC0, 0xFF, 0x8C, 0xE4, 0xFF, 0xA5, 0xC0, 0xFF,
-    0x18, 0xFF, 0xFF, 0x64, 0x58, 0xFF, 0x03, 0x68, 0xFF, 0x86, 0x90, 0xFF, 0x05, 0x88, 0xFF, 0xFE, 0xFF, 0xFF, 0x47, 0xD0, 0xFF, 0x04, 0x78, 0xFF, 0xE9, 0xB8, 0xFF, 0x8D, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x98, 0xFF, 0x48, 0xB0, 0xFF, 0x25, 0x80, 0xFF, 0x08, 0xC8, 0xFF, 0xD4, 0xE9, 0xFF, 0xD2, 0xE8, 0xFF, 0x89, 0xC0, 0xFF, 0x48, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x06, 0x98, 0xFF, 0xA9, 0xC0, 0xFF, 0x8F, 0xEA, 0xFF, 0xED, 0xE8, 0xFF, 0x2E, 0xF1, 0xFF, 0x06, 0x88, 0xFF, 0x25, 0x80, 0xFF, 0xAA, 0xB8, 0xFF, 0x2E, 0xE9, 0xFF, 0x05, 0x90, 0xFF, 0x46, 0x88, 0xFF, 0xAA, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xE8, 0xFF, 0x07, 0xB0, 0xFF, 0x67, 0x98, 0xFF, 0x6C, 0xE8, 0xFF, 0x51, 0xD2, 0xFF, 0x89, 0xC8, 0xFF, 0x45, 0x90, 0xFF, 0x49, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0xE0, 0xFF, 0x25, 0x98, 0xFF, 0xA8, 0xC0, 0xFF, 0x8C, 0xC1, 0xFF, 0x89, 0xE0, 0xFF, 0x47, 0xC8, 0xFF, 0x05, 0xA8, 0xFF, 0xCB, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xB0, 0xFF, 0x6B, 0xF9, 0xFF, 0x88, 0xD9, 0xFF, 0x4E, 0xDB, 0xFF, 0x66, 0xC8, 0xFF, 0x69, 0xE9, 0xFF, 0x25, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x86, 0xE0, 0xFF, 0x24, 0xB0, 0xFF, 0x04, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE8, 0xE8, 0xFF, 0x08, 0xF1, 0xFF, 0x24, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0xD8, 0xFF, 0x64, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0xEA, 0xFF, 0x44, 0xD8, 0xFF, 0x65, 0xC8, 0xFF, 0x64, 0xB8, 0xFF, 0xF8, 0xFF, 0xFF, 0x85, 0xD8, 0xFF, 0x64, 0xD0, 0xFF, 0xA5, 0xC0, 0xFF, 0x2A, 0xDC, 0xFF, 0x24, 0x60, 0xFF, 0x09, 0xB1, 0xFF, 0x88, 0xC0, 0xFF, 0x45, 0x70, 0xFF, 0x04, 0x60, 0xFF, 0x66, 0x80, 0xFF, 0x25, 0x70, 0xFF, 0xCA, 0xD8, 0xFF, 0x67, 0xA8, 0xFF, 0x04, 0x70, 0xFF, 0x05, 0x80, 0xFF, 0x29, 0xB1, 0xFF, 0xAF, 0xF9, 0xFF, 0x2D, 0xF1, 0xFF, 0x05, 0x78, 0xFF, 0xA9, 0xA8, 0xFF, 0x8B, 0xC1, 0xFF, 0x2F, 0xDA, 0xFF, 0xED, 0xE8, 0xFF, 0x28, 0x98, 0xFF, 0x28, 0x98, 0xFF, 0x89, 0xC8, 0xFF, 0x10, 0xFA, 0xFF, 0x2D, 0xE1, 0xFF, 0x47, 0xA0, 0xFF, 0x27, 0xB0, 0xFF, 0x26, 0x80, 0xFF, 0x26, 0xA0, 0xFF, 0x0D, 0xF1, 0xFF, 0x06, 0x90, 0xFF, 0x05, 0x80, 0xFF, 0x67, 0x98, 0xFF, 0xCB, 0xE0, 0xFF, 0x52, 0xF2, 0xFF, 0xAA, 0xC8, 0xFF, 0x7B, 0xFF, 0xFF, 0x67, 0x98, 0xFF, 0x6B, 0xE8, 0xFF, 0xFE, 0xFF, 0xFF, 0xAA, 0xE0, 0xFF, 0x25, 0x88, 0xFF, 0x2A, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xE8, 0xFF, 0x47, 0xA8, 0xFF, 0x68, 0xE0, 0xFF, 0x05, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0A, 0xE1, 0xFF, 0x25, 0xB0, 0xFF, 0x05, 0xB8, 0xFF, 0x67, 0xE0, 0xFF, 0xCB, 0xD9, 0xFF, 0x67, 0xC8, 0xFF, 0x67, 0xE0, 0xFF, 0x05, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xFB, 0xFF, 0x03, 0xB0, 0xFF, 0x03, 0xB8, 0xFF, 0x26, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xA8, 0xFF, 0x24, 0xA8, 0xFF, 0x05, 0xC8, 0xFF, 0xEB, 0xE2, 0xFF, 0x47, 0xD1, 0xFF, 0x24, 0xC0, 0xFF, 0x66, 0xD0, 0xFF, 0x24, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0xD0, 0xFF, 0x25, 0xD0, 0xFF, 0xDF, 0xFF, 0xFF, 0x6A, 0xE2, 0xFF, 0xBC, 0xFF, 0xFF, 0x85, 0xC8, 0xFF, 0x65, 0xC8, 0xFF, 0x06, 0xC9, 0xFF, 0x26, 0xE9, 0xFF, 0x03, 0x50, 0xFF, 0x45, 0x60, 0xFF, 0x46, 0x68, 0xFF, 0x56, 0xF9, 0xFF, 0x05, 0x58, 0xFF, 0x67, 0x90, 0xFF, 0x25, 0x60, 0xFF, 0x5B, 0xFC, 0xFF, 0xCC, 0xB8, 0xFF, 0x05, 0x70, 0xFF, 0x07, 0x88, 0xFF, 0x8C, 0xB8, 0xFF, 0x08, 0x90, 0xFF, 0x26, 0x70, 0xFF, 0x26, 0x70, 0xFF, 0xDF, 0xF6, 0xFF, 0x3E, 0xFE, 0xFF, 0x07, 0x88, 0xFF, 0x28, 0x88, 0xFF, 0xFF, 0xF7, 0xFF, 0xD5, 0xE2, 0xFF, 0x06, 0x80, 0xFF, 0x49, 0xB0, 0xFF, 0x8F, 0xE8, 0xFF, 0x06, 0x88, 0xFF, 0x06, 0x78, 0xFF, 0x06, 0x78, 0xFF, 0x2C, 0xF1, 0xFF, 0xCB, 0xC0, 0xFF, 0x68, 0xA0, 0xFF, 0x06, 0x88, 0xFF, 0x6B, 0xE1, 0xFF,
-    0x6A, 0xC0, 0xFF, 0x68, 0xA8, 0xFF, 0x6C, 0xE8, 0xFF, 0x07, 0xB0, 0xFF, 0x47, 0x90, 0xFF, 0x29, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0xB8, 0xFF, 0x26, 0x90, 0xFF, 0x6A, 0xE0, 0xFF, 0x9B, 0xFE, 0xFF, 0x09, 0xD8, 0xFF, 0x05, 0x98, 0xFF, 0x28, 0xD8, 0xFF, 0x05, 0xB0, 0xFF, 0xCD, 0xD8, 0xFF, 0x8B, 0xE9, 0xFF, 0xFE, 0xFF, 0xFF, 0x05, 0xB0, 0xFF, 0x25, 0xA8, 0xFF, 0xFE, 0xFF, 0xFF, 0x4D, 0xEA, 0xFF, 0x67, 0xE0, 0xFF, 0x05, 0xB8, 0xFF, 0x27, 0xD1, 0xFF, 0x88, 0xE0, 0xFF, 0xEB, 0xE9, 0xFF, 0xFD, 0xFF, 0xFF, 0x86, 0xC0, 0xFF, 0x24, 0xA0, 0xFF, 0x23, 0xA8, 0xFF, 0x8A, 0xE9, 0xFF, 0x69, 0xE1, 0xFF, 0xC5, 0xD0, 0xFF, 0xA8, 0xF1, 0xFF, 0x24, 0xC0, 0xFF, 0xEA, 0xE1, 0xFF, 0x24, 0xA8, 0xFF, 0x84, 0xD0, 0xFF, 0x25, 0xD8, 0xFF, 0xD0, 0xE3, 0xFF, 0x4F, 0xE3, 0xFF, 0x88, 0xD8, 0xFF, 0x65, 0xC0, 0xFF, 0x0E, 0xF3, 0xFF, 0xEA, 0xE0, 0xFF, 0x4F, 0xE3, 0xFF, 0x27, 0xD9, 0xFF, 0x27, 0x68, 0xFF, 0x25, 0x58, 0xFF, 0x24, 0x58, 0xFF, 0xCD, 0xB0, 0xFF, 0x07, 0x88, 0xFF, 0x05, 0x78, 0xFF, 0xF1, 0xE9, 0xFF, 0x06, 0x70, 0xFF, 0xC8, 0x98, 0xFF, 0x0D, 0xD0, 0xFF, 0x8D, 0xA8, 0xFF, 0x26, 0x70, 0xFF, 0x06, 0x80, 0xFF, 0xDD, 0xFD, 0xFF, 0x1D, 0xFE, 0xFF, 0xAA, 0xA8, 0xFF,
-    0x4B, 0xB8, 0xFF, 0x52, 0xE1, 0xFF, 0xFF, 0xFE, 0xFF, 0x08, 0x80, 0xFF, 0x28, 0x88, 0xFF, 0x0D, 0xC8, 0xFF, 0x5E, 0xFF, 0xFF, 0xFA, 0xFD, 0xFF, 0x89, 0x98, 0xFF, 0x07, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x80, 0xFF, 0x8B, 0xC8, 0xFF, 0x29, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x98, 0xFF, 0xAC, 0xD0, 0xFF, 0xAB, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x98, 0xFF, 0x07, 0x90, 0xFF, 0xAC, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xB0, 0xFF, 0x26, 0x88, 0xFF, 0x0A, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0x26, 0x98, 0xFF, 0xEA, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0xE0, 0xFF, 0x06, 0xB8, 0xFF, 0x06, 0xC8, 0xFF, 0x7E, 0xFF, 0xFF, 0x05, 0xA8, 0xFF, 0x25, 0xA0, 0xFF, 0x49, 0xE9, 0xFF, 0xC9, 0xD0, 0xFF, 0x05, 0xA8, 0xFF, 0x87, 0xD0, 0xFF, 0xC8, 0xE8, 0xFF, 0x04, 0xC0, 0xFF, 0x04, 0xB0, 0xFF, 0x45, 0xB0, 0xFF, 0x87, 0xE8, 0xFF, 0x24, 0xA0, 0xFF, 0x24, 0x98, 0xFF, 0x25, 0xC0, 0xFF, 0xC8, 0xE8, 0xFF, 0x03, 0xB0, 0xFF, 0x03, 0xB0, 0xFF, 0x03, 0xB8, 0xFF, 0x44, 0xA0, 0xFF, 0x45, 0xC0, 0xFF, 0x44, 0xB0, 0xFF, 0x45, 0xC0, 0xFF, 0x66, 0xD8, 0xFF, 0x66, 0xC8, 0xFF, 0x65, 0xB8, 0xFF, 0x65, 0xC0, 0xFF, 0x85, 0xC0, 0xFF, 0x65, 0xB8, 0xFF, 0x66, 0xD8, 0xFF,
-    0x68, 0x90, 0xFF, 0x25, 0x68, 0xFF, 0x06, 0x78, 0xFF, 0x25, 0x60, 0xFF, 0x06, 0x60, 0xFF, 0x26, 0x90, 0xFF, 0x2F, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x90, 0xFF, 0x26, 0x78, 0xFF, 0x08, 0xA0, 0xFF, 0x72, 0xEB, 0xFF, 0x29, 0xA8, 0xFF, 0x27, 0x70, 0xFF, 0x08, 0x70, 0xFF, 0x09, 0x88, 0xFF, 0xBF, 0xFF, 0xFF, 0x28, 0x88, 0xFF, 0x2F, 0x98, 0xFF, 0x09, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x98, 0xFF, 0x11, 0xC8, 0xFF, 0x06, 0x78, 0xFF, 0x49, 0x98, 0xFF, 0xB2, 0xE8, 0xFF, 0x07, 0x80, 0xFF, 0x06, 0x78, 0xFF, 0x07, 0x98, 0xFF, 0x8F, 0xEA, 0xFF, 0x07, 0x90, 0xFF, 0x28, 0x90, 0xFF, 0x4E, 0xE9, 0xFF, 0x9F, 0xFF, 0xFF, 0x8B, 0xD0, 0xFF, 0x09, 0xC0, 0xFF, 0x27, 0x90, 0xFF, 0x09, 0xC0, 0xFF, 0xD2, 0xE0, 0xFF, 0x06, 0xA0, 0xFF, 0x26, 0x88, 0xFF, 0x2B, 0xD8, 0xFF, 0xF7, 0xDB, 0xFF, 0x07, 0xC0, 0xFF, 0x06, 0x98, 0xFF, 0x28, 0xB8, 0xFF, 0xDF, 0xFF, 0xFF, 0x08, 0xC8, 0xFF, 0x8A, 0xE2, 0xFF, 0x26, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xC9, 0xFF, 0x05, 0xB0, 0xFF, 0x27, 0xC8, 0xFF, 0x6F, 0xD2, 0xFF, 0x05, 0xB0, 0xFF, 0x88, 0xE0, 0xFF, 0x06, 0xC0, 0xFF, 0x05, 0xC0, 0xFF, 0xB1, 0xDB, 0xFF, 0x24, 0xB8, 0xFF, 0x24, 0xA0, 0xFF, 0x04, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x04, 0xC0, 0xFF, 0x01, 0xA0, 0xFF, 0x64, 0xC0, 0xFF, 0x19, 0xFF, 0xFF, 0x04, 0xA8, 0xFF, 0x44, 0xA8, 0xFF, 0xB8, 0xFE, 0xFF, 0x09, 0xE3, 0xFF, 0x24, 0xC8, 0xFF, 0xA7, 0xD8, 0xFF, 0x44, 0xB0, 0xFF, 0xD6, 0xFF, 0xFF, 0xA6, 0xE0, 0xFF, 0xC7, 0xD8, 0xFF, 0x65, 0xB0, 0xFF, 0x07, 0xDA, 0xFF, 0x24, 0x50, 0xFF, 0x2A, 0x68, 0xFF, 0x04, 0x48, 0xFF, 0x05, 0x60, 0xFF, 0x4E, 0xE1, 0xFF, 0x47, 0x98, 0xFF, 0x26, 0x60, 0xFF, 0x25, 0x58, 0xFF, 0x8F, 0xC0, 0xFF, 0x0C, 0x80, 0xFF, 0x07, 0x88, 0xFF, 0x27, 0x68, 0xFF, 0x29, 0x78, 0xFF, 0x09, 0x98, 0xFF, 0x08, 0x88, 0xFF, 0xAD, 0xB0, 0xFF, 0x0A, 0x90, 0xFF, 0xDB, 0xD8, 0xFF, 0x08, 0x80, 0xFF, 0x1F, 0xFC, 0xFF, 0x0E, 0xB8, 0xFF, 0x09, 0x90, 0xFF, 0x6A, 0xA0, 0xFF, 0xB4, 0xF1, 0xFF, 0xB6, 0xEA, 0xFF, 0x07, 0x68, 0xFF, 0x07, 0x78, 0xFF, 0x09, 0x98, 0xFF, 0xCD, 0xD8, 0xFF, 0x28, 0x90, 0xFF, 0x07, 0x80, 0xFF, 0x09, 0x98, 0xFF, 0x08, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0xB0, 0xFF, 0x07, 0xA8, 0xFF, 0x07, 0x88, 0xFF, 0x10, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x98, 0xFF, 0x47, 0x88, 0xFF, 0x2B, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0xD8, 0xFF, 0x06, 0x90, 0xFF, 0x3C, 0xFF, 0xFF, 0x2A, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x06, 0xC8, 0xFF, 0x27, 0xC0, 0xFF, 0x8E, 0xF9, 0xFF, 0xF1, 0xE2, 0xFF, 0x47, 0xE0, 0xFF, 0x46, 0xC0, 0xFF, 0x06, 0xB8, 0xFF, 0xDF, 0xFF, 0xFF, 0x76, 0xED, 0xFF, 0x05, 0xB0, 0xFF, 0x48, 0xE1, 0xFF, 0x26, 0xE0, 0xFF, 0x6B, 0xE2, 0xFF, 0x04, 0xB0, 0xFF, 0x59, 0xFF, 0xFF, 0x04, 0xA0, 0xFF, 0xDF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF, 0x46, 0xC8, 0xFF, 0x66, 0xD8, 0xFF, 0xC9, 0xE1, 0xFF, 0x04, 0xD8, 0xFF, 0x04, 0xB8, 0xFF, 0x24, 0xB0, 0xFF, 0x09, 0xE9, 0xFF, 0x37, 0xD6, 0xFF, 0x24, 0xB8, 0xFF, 0x44, 0xB8, 0xFF, 0x65, 0xB8, 0xFF, 0x45, 0xC8, 0xFF, 0x46, 0xD1, 0xFF, 0x86, 0xC8, 0xFF, 0xF7, 0xF9, 0xFF, 0x05, 0x58, 0xFF, 0x0C, 0xE1, 0xFF, 0x0A, 0x68, 0xFF, 0x46, 0x58, 0xFF, 0x06, 0x68, 0xFF, 0x07, 0x68, 0xFF, 0x8F, 0xF1, 0xFF, 0x89, 0x78, 0xFF, 0x07, 0x68, 0xFF, 0x09, 0x78, 0xFF, 0x36, 0xD9, 0xFF, 0xAD, 0xE0, 0xFF, 0x08, 0x60, 0xFF, 0x08, 0x68, 0xFF, 0xDA, 0xC9, 0xFF, 0x09, 0x88, 0xFF, 0xCF, 0xE8, 0xFF, 0x08, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x88, 0xFF, 0x08, 0x78, 0xFF, 0x76, 0xF1, 0xFF, 0x12, 0xC8, 0xFF, 0x07, 0x70, 0xFF, 0x07, 0x70, 0xFF, 0x9F, 0xF0, 0xFF, 0x5A, 0xE9, 0xFF, 0x6F, 0xC8, 0xFF, 0x09, 0x90, 0xFF, 0xF8, 0xD9, 0xFF, 0x8B, 0xB0, 0xFF,
-    0x0B, 0xC8, 0xFF, 0x2B, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0xA8, 0xFF, 0xEF, 0xC9, 0xFF, 0x8C, 0xD0, 0xFF, 0x3A, 0xED, 0xFF, 0x48, 0x98, 0xFF, 0x06, 0x80, 0xFF, 0x09, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xB8, 0xFF, 0x06, 0x98, 0xFF, 0x49, 0xB8, 0xFF, 0x28, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xA8, 0xFF, 0x6E, 0xDB, 0xFF, 0x49, 0xD0, 0xFF, 0x07, 0xC0, 0xFF, 0xCE, 0xE9, 0xFF, 0x27, 0xC8, 0xFF, 0x06, 0xB0, 0xFF, 0x05, 0xA8, 0xFF, 0x28, 0xD8, 0xFF, 0x8F, 0xFA, 0xFF, 0x25, 0xA8, 0xFF, 0x06, 0xB8, 0xFF, 0x67, 0xE0, 0xFF, 0x05, 0xD8, 0xFF, 0xAA, 0xE1, 0xFF, 0x22, 0xB0, 0xFF, 0x24, 0xB8, 0xFF, 0x25, 0xC8, 0xFF, 0x06, 0xD9, 0xFF, 0x85, 0xD0, 0xFF, 0x04, 0x98, 0xFF, 0x04, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF2, 0xFF, 0x25, 0xC0, 0xFF, 0x05, 0xB8, 0xFF, 0x2A, 0xDB, 0xFF, 0xC6, 0xD8, 0xFF, 0xAA, 0xE9, 0xFF, 0x25, 0xC0, 0xFF, 0x07, 0xE1, 0xFF, 0x04, 0xB0, 0xFF, 0x27, 0x50, 0xFF, 0x25, 0x50, 0xFF, 0x68, 0x68, 0xFF, 0x06, 0x50, 0xFF, 0x09, 0x68, 0xFF, 0x09, 0x50, 0xFF, 0x25, 0x48, 0xFF, 0x26, 0x48, 0xFF, 0x29, 0x78, 0xFF, 0x0B, 0x80, 0xFF, 0x09, 0x70, 0xFF, 0x0F, 0x58, 0xFF, 0x09, 0x60, 0xFF, 0x91, 0xC0, 0xFF, 0x08, 0x58, 0xFF, 0x6D, 0x90, 0xFF,
-    0x4C, 0x90, 0xFF, 0x0B, 0x80, 0xFF, 0x97, 0xB8, 0xFF, 0x0B, 0x78, 0xFF, 0x08, 0x60, 0xFF, 0x0A, 0x88, 0xFF, 0x77, 0xBA, 0xFF, 0x08, 0x70, 0xFF, 0x08, 0x70, 0xFF, 0x5F, 0xE1, 0xFF, 0xDF, 0xFF, 0xFF, 0x0A, 0x80, 0xFF, 0xCF, 0xB0, 0xFF, 0x0B, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0x98, 0xFF, 0x0C, 0xA8, 0xFF, 0x09, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xE1, 0xFF, 0x07, 0x78, 0xFF, 0x4B, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0x88, 0xFF, 0x26, 0x78, 0xFF, 0x09, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xC8, 0xFF, 0x06, 0x98, 0xFF, 0x27, 0xA8, 0xFF, 0x9F, 0xFF, 0xFF, 0x9B, 0xF3, 0xFF, 0x07, 0xC8, 0xFF, 0x28, 0xC8, 0xFF, 0x4B, 0xC1, 0xFF, 0x89, 0xD8, 0xFF, 0xCF, 0xF1, 0xFF, 0x07, 0xC8, 0xFF, 0x07, 0xC0, 0xFF, 0x06, 0xA0, 0xFF, 0xAA, 0xD8, 0xFF, 0x27, 0xD8, 0xFF, 0x6C, 0xE9, 0xFF, 0x05, 0xA8, 0xFF, 0xC8, 0xF0, 0xFF, 0xC8, 0xD8, 0xFF, 0x04, 0xA8, 0xFF, 0x4A, 0xE1, 0xFF, 0x86, 0xB0, 0xFF, 0x64, 0xC0, 0xFF, 0x66, 0xC0, 0xFF, 0x69, 0xD9, 0xFF, 0x6B, 0xEA, 0xFF, 0x04, 0xC0, 0xFF, 0x24, 0xA8, 0xFF, 0x05, 0xB0, 0xFF, 0x04, 0xB8, 0xFF, 0x0F, 0xDB, 0xFF, 0x25, 0xB8, 0xFF, 0x25, 0xB0, 0xFF, 0x07, 0xD8, 0xFF, 0x6F, 0xFC, 0xFF, 0x4F, 0xF2, 0xFF, 0x66, 0xC0, 0xFF,
-    0x25, 0x48, 0xFF, 0x45, 0x50, 0xFF, 0x1C, 0xEB, 0xFF, 0x26, 0x48, 0xFF, 0x26, 0x48, 0xFF, 0x06, 0x50, 0xFF, 0x5E, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x60, 0xFF, 0x0B, 0x68, 0xFF, 0x48, 0x70, 0xFF, 0x07, 0x60, 0xFF, 0xAD, 0x98, 0xFF, 0x69, 0x78, 0xFF, 0x09, 0x60, 0xFF, 0x8C, 0x80, 0xFF, 0x32, 0xC0, 0xFF, 0x12, 0x88, 0xFF, 0x0C, 0x60, 0xFF, 0x08, 0x58, 0xFF, 0x2D, 0x90, 0xFF, 0x0A, 0x70, 0xFF, 0x8C, 0x88, 0xFF, 0x08, 0x68, 0xFF, 0x33, 0xA0, 0xFF, 0x0C, 0xA0, 0xFF, 0x09, 0x78, 0xFF, 0x09, 0x78, 0xFF, 0x2E, 0x98, 0xFF, 0x54, 0xE8, 0xFF, 0x70, 0xB8, 0xFF, 0x6D, 0x98, 0xFF, 0x08, 0x78, 0xFF, 0x53, 0xD8, 0xFF, 0x09, 0x88, 0xFF, 0x4C, 0x98, 0xFF, 0x08, 0x80, 0xFF, 0x4E, 0xB0, 0xFF, 0x7C, 0xEC, 0xFF, 0x07, 0x80, 0xFF, 0x07, 0x78, 0xFF, 0x0B, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xD0, 0xFF, 0xB3, 0xFD, 0xFF, 0xDF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0x4A, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0xA8, 0xFF, 0x3C, 0xEF, 0xFF, 0x07, 0xB0, 0xFF, 0x28, 0xB8, 0xFF, 0x05, 0xA0, 0xFF, 0x9F, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x69, 0xD0, 0xFF, 0x06, 0x98, 0xFF, 0x67, 0xD8, 0xFF, 0x05, 0xB8, 0xFF, 0xD0, 0xEC, 0xFF, 0x25, 0xB0, 0xFF, 0xA8, 0xE0, 0xFF, 0x04, 0xC8, 0xFF,
-    0x25, 0xC0, 0xFF, 0x05, 0xA8, 0xFF, 0x46, 0xD0, 0xFF, 0x45, 0xD0, 0xFF, 0x24, 0xA0, 0xFF, 0x87, 0xD0, 0xFF, 0x01, 0xA8, 0xFF, 0x28, 0xE9, 0xFF, 0x04, 0xD1, 0xFF, 0x06, 0xD8, 0xFF, 0x46, 0xB8, 0xFF, 0x06, 0xE1, 0xFF, 0x45, 0xB0, 0xFF, 0x45, 0xA8, 0xFF, 0xA7, 0xD8, 0xFF, 0x25, 0xC8, 0xFF, 0xB6, 0xFC, 0xFF, 0x25, 0x40, 0xFF, 0x25, 0x40, 0xFF, 0x07, 0x48, 0xFF, 0x09, 0x40, 0xFF, 0x0F, 0xC2, 0xFF, 0x6D, 0x80, 0xFF, 0x27, 0x50, 0xFF, 0x0F, 0x50, 0xFF, 0x08, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0x70, 0xFF, 0x09, 0x58, 0xFF, 0x0C, 0x60, 0xFF, 0x08, 0x58, 0xFF, 0x14, 0xC0, 0xFF, 0x10, 0x78, 0xFF, 0x91, 0x98, 0xFF, 0x6E, 0x91, 0xFF, 0xBF, 0xFE, 0xFF, 0x3C, 0xC9, 0xFF, 0x0A, 0x70, 0xFF, 0x4B, 0x80, 0xFF, 0x31, 0xB8, 0xFF, 0x16, 0xD8, 0xFF, 0x8C, 0x88, 0xFF, 0xFF, 0xFA, 0xFF, 0xFC, 0xDA, 0xFF, 0x17, 0xC0, 0xFF, 0x2F, 0xB8, 0xFF, 0x09, 0x80, 0xFF, 0x0C, 0x80, 0xFF, 0x59, 0xF9, 0xFF, 0x77, 0xC2, 0xFF, 0x7B, 0xD9, 0xFF, 0x2D, 0xC9, 0xFF, 0x29, 0x88, 0xFF, 0x0E, 0xB8, 0xFF, 0x9C, 0xEB, 0xFF, 0x07, 0x78, 0xFF, 0x07, 0x78, 0xFF, 0x2B, 0xC8, 0xFF, 0x52, 0xD1, 0xFF, 0x2A, 0xA8, 0xFF, 0x06, 0xA8, 0xFF, 0x4A, 0xD0, 0xFF, 0xF0, 0xE8, 0xFF, 0x4A, 0xC8, 0xFF,
-    0x08, 0xA0, 0xFF, 0x07, 0xB8, 0xFF, 0x2C, 0xE8, 0xFF, 0x3F, 0xFF, 0xFF, 0x2E, 0xE4, 0xFF, 0x47, 0xC8, 0xFF, 0x26, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD8, 0xFF, 0x05, 0x90, 0xFF, 0x06, 0xA0, 0xFF, 0x30, 0xEA, 0xFF, 0x05, 0xB8, 0xFF, 0x03, 0x98, 0xFF, 0x24, 0xC0, 0xFF, 0x25, 0xB8, 0xFF, 0x54, 0xD3, 0xFF, 0x45, 0xC8, 0xFF, 0xEB, 0xE2, 0xFF, 0x06, 0xC0, 0xFF, 0x6A, 0xE1, 0xFF, 0x04, 0xB0, 0xFF, 0x45, 0xB8, 0xFF, 0x05, 0xB0, 0xFF, 0x04, 0xA8, 0xFF, 0x66, 0xB0, 0xFF, 0x24, 0xB8, 0xFF, 0x25, 0xA8, 0xFF, 0x24, 0xA0, 0xFF, 0x65, 0xB0, 0xFF, 0x25, 0xB0, 0xFF, 0x04, 0xA8, 0xFF, 0x25, 0x38, 0xFF, 0x0A, 0x48, 0xFF, 0x2E, 0x40, 0xFF, 0x05, 0x68, 0xFF, 0x6B, 0x90, 0xFF, 0x09, 0x50, 0xFF, 0x47, 0x48, 0xFF, 0x06, 0x48, 0xFF, 0x8C, 0x98, 0xFF, 0x09, 0x60, 0xFF, 0x08, 0x68, 0xFF, 0x0E, 0x58, 0xFF, 0x2A, 0x58, 0xFF, 0xF0, 0xC0, 0xFF, 0x09, 0x58, 0xFF, 0xBA, 0x90, 0xFF, 0xF7, 0x98, 0xFF, 0x28, 0x60, 0xFF, 0x72, 0xE8, 0xFF, 0xD7, 0x88, 0xFF, 0x29, 0x58, 0xFF, 0x2A, 0x70, 0xFF, 0x30, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x70, 0xFF, 0x31, 0x88, 0xFF, 0x4D, 0x98, 0xFF, 0x0C, 0x80, 0xFF, 0x55, 0xD0, 0xFF, 0x0B, 0x88, 0xFF, 0x1E, 0xEA, 0xFF, 0x8C, 0x90, 0xFF,
-    0x11, 0x90, 0xFF, 0x99, 0xF0, 0xFF, 0x5F, 0xFF, 0xFF, 0x0F, 0x98, 0xFF, 0x29, 0x80, 0xFF, 0x0A, 0x98, 0xFF, 0x3C, 0xF1, 0xFF, 0x07, 0x70, 0xFF, 0x07, 0x70, 0xFF, 0x2E, 0xC8, 0xFF, 0x9C, 0xED, 0xFF, 0x2B, 0xA8, 0xFF, 0x07, 0x88, 0xFF, 0x07, 0x98, 0xFF, 0x2B, 0xC0, 0xFF, 0x09, 0xB8, 0xFF, 0x08, 0x98, 0xFF, 0xF8, 0xFD, 0xFF, 0x6A, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xD8, 0xF5, 0xFF, 0x05, 0x90, 0xFF, 0x07, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xE9, 0xFF, 0x06, 0xA0, 0xFF, 0x06, 0xA0, 0xFF, 0x8C, 0xD2, 0xFF, 0x2B, 0xD0, 0xFF, 0x25, 0x98, 0xFF, 0x24, 0xD0, 0xFF, 0x06, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xD0, 0xFF, 0xF8, 0xF6, 0xFF, 0x05, 0xA8, 0xFF, 0x05, 0xC8, 0xFF, 0xCD, 0xC9, 0xFF, 0xE7, 0xB8, 0xFF, 0xCA, 0xF2, 0xFF, 0x46, 0xC0, 0xFF, 0xA9, 0xD8, 0xFF, 0x09, 0xE9, 0xFF, 0x04, 0xB0, 0xFF, 0x45, 0xA0, 0xFF, 0x04, 0xA0, 0xFF, 0xE8, 0xE8, 0xFF, 0x08, 0x40, 0xFF, 0x26, 0x40, 0xFF, 0xAB, 0xC0, 0xFF, 0xA9, 0x58, 0xFF, 0x47, 0x48, 0xFF, 0x06, 0x40, 0xFF, 0x09, 0x50, 0xFF, 0xAC, 0xC0, 0xFF, 0x27, 0x50, 0xFF, 0x6A, 0x68, 0xFF, 0xEE, 0x78, 0xFF, 0x0B, 0x50, 0xFF, 0x6C, 0xC0, 0xFF, 0x4E, 0x80, 0xFF, 0x0E, 0x40, 0xFF, 0x29, 0x58, 0xFF,
-    0xEC, 0x80, 0xFF, 0x12, 0xE9, 0xFF, 0x9F, 0xD7, 0xFF, 0x0A, 0x50, 0xFF, 0x2B, 0x58, 0xFF, 0x19, 0x60, 0xFF, 0x38, 0xE0, 0xFF, 0x0A, 0x68, 0xFF, 0x0C, 0x60, 0xFF, 0x10, 0x68, 0xFF, 0x78, 0xB9, 0xFF, 0xBA, 0xE0, 0xFF, 0xFB, 0xC9, 0xFF, 0x0B, 0x70, 0xFF, 0x3F, 0xFF, 0xFF, 0x0B, 0x70, 0xFF, 0x0E, 0x90, 0xFF, 0x0A, 0x70, 0xFF, 0x9F, 0xFC, 0xFF, 0x0C, 0x78, 0xFF, 0x08, 0x70, 0xFF, 0x0B, 0x88, 0xFF, 0xDF, 0xFF, 0xFF, 0x07, 0x68, 0xFF, 0x07, 0x68, 0xFF, 0x0D, 0xB8, 0xFF, 0x5E, 0xFE, 0xFF, 0x2D, 0xA8, 0xFF, 0x4A, 0xB8, 0xFF, 0x0A, 0xA0, 0xFF, 0xB9, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xC0, 0xFF, 0x08, 0x98, 0xFF, 0x0A, 0xC0, 0xFF, 0x2A, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0xC0, 0xFF, 0x05, 0x98, 0xFF, 0x08, 0xD0, 0xFF, 0x09, 0xC0, 0xFF, 0xBF, 0xFF, 0xFF, 0x0A, 0xF1, 0xFF, 0x06, 0x98, 0xFF, 0x8A, 0xC0, 0xFF, 0x50, 0xE1, 0xFF, 0x06, 0xB8, 0xFF, 0x05, 0x90, 0xFF, 0xA8, 0xC3, 0xFF, 0x88, 0xD0, 0xFF, 0xD0, 0xE1, 0xFF, 0x07, 0xB0, 0xFF, 0x0D, 0xFC, 0xFF, 0x05, 0xB0, 0xFF, 0x04, 0xA8, 0xFF, 0x52, 0xDA, 0xFF, 0x26, 0xB8, 0xFF, 0x43, 0xB0, 0xFF, 0x05, 0xA8, 0xFF, 0x04, 0xB8, 0xFF, 0xBF, 0xFE, 0xFF, 0x6B, 0xE3, 0xFF, 0x29, 0xE9, 0xFF, 0x45, 0x98, 0xFF,
-    0x08, 0x40, 0xFF, 0x29, 0x40, 0xFF, 0x47, 0x48, 0xFF, 0x26, 0x38, 0xFF, 0x28, 0x40, 0xFF, 0x07, 0x38, 0xFF, 0x27, 0x38, 0xFF, 0x08, 0x40, 0xFF, 0x2A, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x07, 0x40, 0xFF, 0x06, 0x40, 0xFF, 0x09, 0x48, 0xFF, 0x13, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x07, 0x40, 0xFF, 0x0B, 0x60, 0xFF, 0x16, 0x50, 0xFF, 0x08, 0x40, 0xFF, 0x2A, 0x48, 0xFF, 0x1A, 0x50, 0xFF, 0x0F, 0x60, 0xFF, 0x94, 0xC2, 0xFF, 0x9F, 0xE0, 0xFF, 0xDD, 0x78, 0xFF, 0x11, 0x78, 0xFF, 0x15, 0x50, 0xFF, 0x0D, 0x80, 0xFF, 0x0C, 0x68, 0xFF, 0x34, 0x98, 0xFF, 0x2C, 0x60, 0xFF, 0x5A, 0x90, 0xFF, 0x79, 0xC9, 0xFF, 0x0B, 0x68, 0xFF, 0x0D, 0x78, 0xFF, 0x3A, 0xEA, 0xFF, 0x0A, 0x70, 0xFF, 0x7A, 0xD1, 0xFF, 0x7F, 0xFC, 0xFF, 0x07, 0x60, 0xFF, 0x07, 0x68, 0xFF, 0x0B, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x98, 0xFF, 0x19, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0xD4, 0xFF, 0x7F, 0xFF, 0xFF, 0x2B, 0xB8, 0xFF, 0x08, 0x88, 0xFF, 0xDF, 0xFF, 0xFF, 0x29, 0x98, 0xFF, 0xD4, 0xF1, 0xFF, 0x0B, 0xD0, 0xFF, 0xDF, 0xFF, 0xFF, 0x49, 0xC0, 0xFF, 0x07, 0xB0, 0xFF, 0x92, 0xF1, 0xFF, 0x96, 0xE4, 0xFF, 0x06, 0xB0, 0xFF, 0x47, 0x98, 0xFF, 0x05, 0x80, 0xFF, 0x05, 0xC0, 0xFF, 0xF2, 0xE1, 0xFF,
-    0x05, 0x98, 0xFF, 0x3F, 0xFF, 0xFF, 0x05, 0xA0, 0xFF, 0x0B, 0xE9, 0xFF, 0xB0, 0xE2, 0xFF, 0x05, 0xB0, 0xFF, 0x05, 0xA0, 0xFF, 0x6E, 0xFB, 0xFF, 0xC9, 0xD0, 0xFF, 0xAD, 0xF1, 0xFF, 0xC9, 0xF0, 0xFF, 0x25, 0xA8, 0xFF, 0x7B, 0xFC, 0xFF, 0xAA, 0xC8, 0xFF, 0xCB, 0xE8, 0xFF, 0x26, 0xA8, 0xFF, 0x66, 0x40, 0xFF, 0x25, 0x38, 0xFF, 0x7B, 0x40, 0xFF, 0x79, 0x38, 0xFF, 0x26, 0x38, 0xFF, 0x15, 0x40, 0xFF, 0x06, 0x38, 0xFF, 0x0A, 0x40, 0xFF, 0x0F, 0x40, 0xFF, 0x26, 0x38, 0xFF, 0x08, 0x40, 0xFF, 0x09, 0x48, 0xFF, 0x2B, 0x50, 0xFF, 0x28, 0x40, 0xFF, 0x08, 0x40, 0xFF, 0x0F, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x2B, 0x58, 0xFF, 0x08, 0x40, 0xFF, 0x10, 0x68, 0xFF, 0xDF, 0xF4, 0xFF, 0x4C, 0x60, 0xFF, 0x2E, 0x58, 0xFF, 0x0E, 0x58, 0xFF, 0x0C, 0x50, 0xFF, 0x0C, 0x50, 0xFF, 0x0B, 0x58, 0xFF, 0x12, 0x50, 0xFF, 0x2D, 0x58, 0xFF, 0x99, 0xA2, 0xFF, 0x0A, 0x58, 0xFF, 0x0B, 0x60, 0xFF, 0x18, 0x90, 0xFF, 0x7E, 0xFC, 0xFF, 0x0F, 0x70, 0xFF, 0x58, 0xA8, 0xFF, 0x0A, 0x68, 0xFF, 0x0B, 0x70, 0xFF, 0x7D, 0xE3, 0xFF, 0x07, 0x58, 0xFF, 0x06, 0x58, 0xFF, 0x0D, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x88, 0xFF, 0x07, 0x68, 0xFF, 0x5F, 0xFF, 0xFF, 0xB4, 0xD0, 0xFF, 0x08, 0x80, 0xFF,
-    0x4C, 0x98, 0xFF, 0x6A, 0xA0, 0xFF, 0x2A, 0xA8, 0xFF, 0x6C, 0xC0, 0xFF, 0x0D, 0xC0, 0xFF, 0x29, 0xA0, 0xFF, 0x47, 0x98, 0xFF, 0x11, 0xD9, 0xFF, 0xED, 0xD8, 0xFF, 0x06, 0x88, 0xFF, 0x07, 0x98, 0xFF, 0x4F, 0xF1, 0xFF, 0x07, 0xA0, 0xFF, 0x04, 0x70, 0xFF, 0x27, 0x98, 0xFF, 0x0B, 0xE0, 0xFF, 0x06, 0x90, 0xFF, 0x05, 0x80, 0xFF, 0xC8, 0xB8, 0xFF, 0x05, 0xA0, 0xFF, 0x06, 0xA0, 0xFF, 0x05, 0xA8, 0xFF, 0x05, 0x90, 0xFF, 0x47, 0xB0, 0xFF, 0x06, 0xA8, 0xFF, 0xD8, 0xF4, 0xFF, 0xA7, 0xD0, 0xFF, 0x25, 0x90, 0xFF, 0x29, 0xD0, 0xFF, 0x26, 0x98, 0xFF, 0x4F, 0xD1, 0xFF, 0x26, 0xA0, 0xFF, 0x11, 0x28, 0xFF, 0x0D, 0x38, 0xFF, 0x25, 0x30, 0xFF, 0x45, 0x38, 0xFF, 0x33, 0x30, 0xFF, 0x4C, 0x58, 0xFF, 0x26, 0x38, 0xFF, 0x1E, 0x50, 0xFF, 0x27, 0x40, 0xFF, 0x06, 0x40, 0xFF, 0xBF, 0xD2, 0xFF, 0x49, 0x50, 0xFF, 0x09, 0x40, 0xFF, 0x28, 0x40, 0xFF, 0x0F, 0x68, 0xFF, 0x0B, 0x40, 0xFF, 0x08, 0x38, 0xFF, 0x0B, 0x50, 0xFF, 0x17, 0x68, 0xFF, 0x1F, 0xFA, 0xFF, 0x2A, 0x50, 0xFF, 0x36, 0x50, 0xFF, 0x0C, 0x58, 0xFF, 0x0B, 0x58, 0xFF, 0x9F, 0xFF, 0xFF, 0x0D, 0x58, 0xFF, 0x2C, 0x60, 0xFF, 0x0A, 0x50, 0xFF, 0xFC, 0xD2, 0xFF, 0x2D, 0x68, 0xFF, 0x0F, 0x58, 0xFF, 0x0B, 0x60, 0xFF,
-    0x0B, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0x78, 0xFF, 0x0A, 0x58, 0xFF, 0x0B, 0x68, 0xFF, 0x35, 0x70, 0xFF, 0x0F, 0x80, 0xFF, 0x07, 0x58, 0xFF, 0x07, 0x58, 0xFF, 0x0B, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x90, 0xFF, 0x07, 0x68, 0xFF, 0x09, 0x60, 0xFF, 0x2D, 0x90, 0xFF, 0x0A, 0x90, 0xFF, 0x0C, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xB8, 0xFF, 0x0E, 0xC8, 0xFF, 0x06, 0x70, 0xFF, 0xFA, 0xD3, 0xFF, 0xDE, 0xFF, 0xFF, 0x8B, 0xB8, 0xFF, 0x08, 0x98, 0xFF, 0x2D, 0xA8, 0xFF, 0x06, 0x88, 0xFF, 0x06, 0x90, 0xFF, 0x07, 0xA8, 0xFF, 0x05, 0x80, 0xFF, 0x05, 0x80, 0xFF, 0x05, 0x80, 0xFF, 0x0D, 0xD0, 0xFF, 0x26, 0x98, 0xFF, 0x04, 0x78, 0xFF, 0x26, 0x98, 0xFF, 0x5D, 0xFC, 0xFF, 0x2B, 0xE1, 0xFF, 0x05, 0x88, 0xFF, 0x04, 0x88, 0xFF, 0x06, 0xA8, 0xFF, 0x0E, 0xB0, 0xFF, 0x06, 0x98, 0xFF, 0x46, 0x90, 0xFF, 0x05, 0x90, 0xFF, 0x45, 0x90, 0xFF, 0xDC, 0xE5, 0xFF, 0x06, 0xB0, 0xFF, 0x26, 0x38, 0xFF, 0x25, 0x30, 0xFF, 0x14, 0x20, 0xFF, 0x30, 0xC5, 0xFF, 0x0B, 0x71, 0xFF, 0x26, 0x38, 0xFF, 0x1B, 0x18, 0xFF, 0x25, 0x38, 0xFF, 0xD7, 0xFF, 0xFF, 0x0F, 0x48, 0xFF, 0x07, 0x40, 0xFF, 0x06, 0x30, 0xFF, 0x29, 0x40, 0xFF, 0xDF, 0xFF, 0xFF, 0x0D, 0x40, 0xFF, 0x07, 0x38, 0xFF,
-    0x09, 0x38, 0xFF, 0x34, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x40, 0xFF, 0x2B, 0x48, 0xFF, 0x4F, 0x60, 0xFF, 0x0E, 0x48, 0xFF, 0x5F, 0xFF, 0xFF, 0xDB, 0x79, 0xFF, 0x0C, 0x50, 0xFF, 0x15, 0x60, 0xFF, 0x0B, 0x58, 0xFF, 0x5E, 0xE4, 0xFF, 0x2C, 0x60, 0xFF, 0x39, 0x7A, 0xFF, 0x11, 0x68, 0xFF, 0xD8, 0x88, 0xFF, 0x0C, 0x60, 0xFF, 0x13, 0x78, 0xFF, 0x09, 0x50, 0xFF, 0x2B, 0x68, 0xFF, 0x78, 0xD0, 0xFF, 0x18, 0xAA, 0xFF, 0x07, 0x50, 0xFF, 0x07, 0x50, 0xFF, 0x0C, 0x80, 0xFF, 0x18, 0xE0, 0xFF, 0x0B, 0x78, 0xFF, 0x07, 0x60, 0xFF, 0x09, 0x70, 0xFF, 0x10, 0x80, 0xFF, 0xB8, 0xF8, 0xFF, 0x0A, 0x88, 0xFF, 0x08, 0x80, 0xFF, 0x07, 0x70, 0xFF, 0x0A, 0x98, 0xFF, 0x08, 0x88, 0xFF, 0x09, 0x98, 0xFF, 0x05, 0x70, 0xFF, 0x09, 0x98, 0xFF, 0x2A, 0x90, 0xFF, 0x08, 0x88, 0xFF, 0xB1, 0xC9, 0xFF, 0x06, 0x80, 0xFF, 0x69, 0xA8, 0xFF, 0x4C, 0xD0, 0xFF, 0x48, 0xA0, 0xFF, 0x05, 0x78, 0xFF, 0x05, 0x80, 0xFF, 0x1F, 0xFD, 0xFF, 0x26, 0x90, 0xFF, 0x05, 0x78, 0xFF, 0x05, 0x80, 0xFF, 0x2A, 0xE0, 0xFF, 0x0C, 0xA8, 0xFF, 0x05, 0x80, 0xFF, 0x06, 0x90, 0xFF, 0x06, 0x88, 0xFF, 0xDF, 0xFF, 0xFF, 0x05, 0x90, 0xFF, 0x06, 0xA8, 0xFF, 0x45, 0x90, 0xFF, 0x45, 0x90, 0xFF, 0x47, 0xA0, 0xFF,
-    0x24, 0x30, 0xFF, 0x68, 0x38, 0xFF, 0x6B, 0x89, 0xFF, 0x46, 0x38, 0xFF, 0x1C, 0x18, 0xFF, 0x07, 0x38, 0xFF, 0x45, 0x38, 0xFF, 0x69, 0x99, 0xFF, 0x16, 0x38, 0xFF, 0x27, 0x38, 0xFF, 0x06, 0x38, 0xFF, 0x68, 0x58, 0xFF, 0xB0, 0xB0, 0xFF, 0x0D, 0x40, 0xFF, 0x08, 0x40, 0xFF, 0x07, 0x38, 0xFF, 0x16, 0x60, 0xFF, 0x33, 0xC1, 0xFF, 0x0A, 0x40, 0xFF, 0x0C, 0x48, 0xFF, 0x12, 0x50, 0xFF, 0x5C, 0x78, 0xFF, 0x73, 0xB8, 0xFF, 0x0C, 0x58, 0xFF, 0x2C, 0x50, 0xFF, 0x57, 0x68, 0xFF, 0x0D, 0x68, 0xFF, 0x37, 0xC8, 0xFF, 0x0A, 0x50, 0xFF, 0x19, 0x48, 0xFF, 0x0D, 0x60, 0xFF, 0x0C, 0x70, 0xFF, 0x0E, 0x70, 0xFF, 0x0E, 0x60, 0xFF, 0x12, 0x60, 0xFF, 0x6D, 0x78, 0xFF, 0x4D, 0x70, 0xFF, 0x0D, 0x68, 0xFF, 0x51, 0x90, 0xFF, 0x07, 0x50, 0xFF, 0x07, 0x50, 0xFF, 0x6D, 0x98, 0xFF, 0xBE, 0xF5, 0xFF, 0x0B, 0x70, 0xFF, 0x07, 0x60, 0xFF, 0x2D, 0x80, 0xFF, 0xD8, 0xC0, 0xFF, 0x9D, 0xE3, 0xFF, 0x2A, 0x88, 0xFF, 0x06, 0x70, 0xFF, 0x3F, 0xFF, 0xFF, 0x2B, 0x88, 0xFF, 0x70, 0xA0, 0xFF, 0x08, 0x78, 0xFF, 0xBF, 0xFE, 0xFF, 0x08, 0xA0, 0xFF, 0x2B, 0xA8, 0xFF, 0x51, 0x88, 0xFF, 0x08, 0xA0, 0xFF, 0xAF, 0xC8, 0xFF, 0x06, 0x80, 0xFF, 0x12, 0xD0, 0xFF, 0x26, 0xA0, 0xFF, 0x05, 0x78, 0xFF,
-    0x05, 0x70, 0xFF, 0x05, 0x78, 0xFF, 0xDF, 0xFF, 0xFF, 0x06, 0x80, 0xFF, 0x25, 0x80, 0xFF, 0x05, 0x80, 0xFF, 0x04, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x88, 0xFF, 0x25, 0x80, 0xFF, 0x27, 0xC8, 0xFF, 0x06, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0xE1, 0xFF, 0x25, 0x88, 0xFF, 0x05, 0x90, 0xFF, 0x24, 0x30, 0xFF, 0x25, 0x38, 0xFF, 0x05, 0x30, 0xFF, 0x7C, 0x20, 0xFF, 0x25, 0x30, 0xFF, 0x26, 0x38, 0xFF, 0x0B, 0x30, 0xFF, 0x9E, 0xCB, 0xFF, 0x26, 0x38, 0xFF, 0x26, 0x38, 0xFF, 0x07, 0x38, 0xFF, 0x6C, 0x50, 0xFF, 0x2A, 0x40, 0xFF, 0x07, 0x30, 0xFF, 0x69, 0x48, 0xFF, 0xFF, 0xEF, 0xFF, 0x5A, 0x98, 0xFF, 0x2B, 0x48, 0xFF, 0x0B, 0x38, 0xFF, 0x17, 0x50, 0xFF, 0x3F, 0xFD, 0xFF, 0x2C, 0x50, 0xFF, 0x7F, 0xFC, 0xFF, 0x0F, 0x50, 0xFF, 0x0E, 0x48, 0xFF, 0x11, 0x58, 0xFF, 0x4E, 0x68, 0xFF, 0x13, 0x78, 0xFF, 0x0A, 0x48, 0xFF, 0x1F, 0xF7, 0xFF, 0x11, 0x58, 0xFF, 0x6D, 0x68, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x70, 0xFF, 0x0A, 0x60, 0xFF, 0x2C, 0x60, 0xFF, 0x1E, 0xFD, 0xFF, 0x0C, 0x78, 0xFF, 0x07, 0x50, 0xFF, 0x07, 0x50, 0xFF, 0x2B, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x78, 0xFF, 0x28, 0x70, 0xFF, 0x08, 0x68, 0xFF, 0x0B, 0x78, 0xFF, 0x5F, 0xFF, 0xFF,
-    0x4C, 0x80, 0xFF, 0x07, 0x68, 0xFF, 0x07, 0x70, 0xFF, 0x09, 0x78, 0xFF, 0x9B, 0xE3, 0xFF, 0x09, 0x98, 0xFF, 0x06, 0x68, 0xFF, 0x08, 0x80, 0xFF, 0x0E, 0x98, 0xFF, 0x35, 0xE0, 0xFF, 0x48, 0xB0, 0xFF, 0x06, 0x78, 0xFF, 0x07, 0x80, 0xFF, 0x07, 0x88, 0xFF, 0x0E, 0xD9, 0xFF, 0x9F, 0xFD, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x88, 0xFF, 0x75, 0xF1, 0xFF, 0x07, 0xA8, 0xFF, 0x05, 0x78, 0xFF, 0x25, 0x78, 0xFF, 0x06, 0xA8, 0xFF, 0x89, 0xC8, 0xFF, 0x06, 0x90, 0xFF, 0x25, 0x80, 0xFF, 0xD3, 0xF2, 0xFF, 0x8E, 0xE0, 0xFF, 0xCA, 0xC0, 0xFF, 0x06, 0xA0, 0xFF, 0x27, 0xA0, 0xFF, 0x38, 0xDC, 0xFF, 0x33, 0x28, 0xFF, 0x25, 0x30, 0xFF, 0x25, 0x30, 0xFF, 0x25, 0x30, 0xFF, 0x53, 0x9A, 0xFF, 0x89, 0x48, 0xFF, 0x25, 0x30, 0xFF, 0x05, 0x30, 0xFF, 0x26, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x40, 0xFF, 0x29, 0x38, 0xFF, 0x07, 0x30, 0xFF, 0x0F, 0x48, 0xFF, 0x32, 0x68, 0xFF, 0x0A, 0x38, 0xFF, 0x2C, 0x48, 0xFF, 0x15, 0x58, 0xFF, 0xDD, 0xB3, 0xFF, 0xCE, 0x68, 0xFF, 0x0A, 0x40, 0xFF, 0x52, 0x68, 0xFF, 0x0C, 0x50, 0xFF, 0x17, 0x80, 0xFF, 0x0B, 0x50, 0xFF, 0x70, 0x70, 0xFF, 0x0A, 0x48, 0xFF, 0x5C, 0x78, 0xFF, 0x0D, 0x58, 0xFF, 0x2D, 0x58, 0xFF, 0x4B, 0x58, 0xFF,
-    0x93, 0xA9, 0xFF, 0x17, 0xA0, 0xFF, 0x2D, 0x60, 0xFF, 0x0A, 0x58, 0xFF, 0x2C, 0x60, 0xFF, 0x0F, 0x70, 0xFF, 0x0C, 0x68, 0xFF, 0x07, 0x50, 0xFF, 0x07, 0x50, 0xFF, 0x4C, 0x80, 0xFF, 0x09, 0x60, 0xFF, 0x2A, 0x68, 0xFF, 0x28, 0x68, 0xFF, 0x08, 0x68, 0xFF, 0x0B, 0x78, 0xFF, 0x0A, 0x70, 0xFF, 0x29, 0x68, 0xFF, 0x58, 0xC1, 0xFF, 0x08, 0x78, 0xFF, 0x29, 0x70, 0xFF, 0x09, 0x80, 0xFF, 0x9D, 0xF0, 0xFF, 0x06, 0x78, 0xFF, 0x3F, 0xF3, 0xFF, 0x09, 0x78, 0xFF, 0x1B, 0xDA, 0xFF, 0x06, 0x78, 0xFF, 0x0C, 0x98, 0xFF, 0x08, 0x88, 0xFF, 0x06, 0x80, 0xFF, 0x06, 0x80, 0xFF, 0x0B, 0x90, 0xFF, 0xDF, 0xFE, 0xFF, 0x05, 0x68, 0xFF, 0x05, 0x78, 0xFF, 0x26, 0x80, 0xFF, 0xDB, 0xDB, 0xFF, 0x04, 0x70, 0xFF, 0x05, 0x78, 0xFF, 0x05, 0x78, 0xFF, 0x0F, 0xE1, 0xFF, 0x1B, 0xEB, 0xFF, 0x05, 0x80, 0xFF, 0x25, 0x78, 0xFF, 0x46, 0x88, 0xFF, 0x06, 0x90, 0xFF, 0x18, 0xEB, 0xFF, 0x25, 0x90, 0xFF, 0x04, 0x28, 0xFF, 0x04, 0x28, 0xFF, 0x25, 0x30, 0xFF, 0x45, 0x30, 0xFF, 0xC8, 0x70, 0xFF, 0x46, 0x38, 0xFF, 0x05, 0x30, 0xFF, 0x25, 0x30, 0xFF, 0x46, 0x38, 0xFF, 0x09, 0x50, 0xFF, 0x27, 0x38, 0xFF, 0x07, 0x30, 0xFF, 0x28, 0x40, 0xFF, 0x08, 0x38, 0xFF, 0x09, 0x38, 0xFF, 0x09, 0x38, 0xFF,
-    0x0A, 0x38, 0xFF, 0x0A, 0x48, 0xFF, 0x0C, 0x38, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x38, 0xFF, 0x0A, 0x40, 0xFF, 0x0D, 0x38, 0xFF, 0x0B, 0x58, 0xFF, 0x0B, 0x48, 0xFF, 0x0B, 0x48, 0xFF, 0x0C, 0x48, 0xFF, 0x09, 0x40, 0xFF, 0x0B, 0x48, 0xFF, 0x0B, 0x50, 0xFF, 0x0F, 0x40, 0xFF, 0x2B, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x2D, 0x58, 0xFF, 0x0A, 0x58, 0xFF, 0x2B, 0x58, 0xFF, 0x0C, 0x58, 0xFF, 0x0D, 0x50, 0xFF, 0x07, 0x48, 0xFF, 0x08, 0x50, 0xFF, 0x0B, 0x68, 0xFF, 0x7F, 0xFF, 0xFF, 0x2A, 0x60, 0xFF, 0x08, 0x68, 0xFF, 0x2A, 0x60, 0xFF, 0x0C, 0x60, 0xFF, 0x0A, 0x68, 0xFF, 0x29, 0x68, 0xFF, 0x07, 0x60, 0xFF, 0x08, 0x70, 0xFF, 0xFF, 0xFE, 0xFF, 0x08, 0x70, 0xFF, 0x08, 0x78, 0xFF, 0x07, 0x80, 0xFF, 0x09, 0x70, 0xFF, 0x0A, 0x78, 0xFF, 0x2A, 0x88, 0xFF, 0x06, 0x70, 0xFF, 0x06, 0x70, 0xFF, 0x15, 0xDA, 0xFF, 0x2B, 0xA0, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x70, 0xFF, 0xFF, 0xF7, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x70, 0xFF, 0x25, 0x78, 0xFF, 0x0D, 0xE0, 0xFF, 0x88, 0xA0, 0xFF, 0x05, 0x78, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x78, 0xFF, 0xB9, 0xF4, 0xFF, 0x05, 0x80, 0xFF, 0x25, 0x78, 0xFF, 0x25, 0x78, 0xFF, 0x46, 0x88, 0xFF, 0x47, 0x98, 0xFF,
-    0x44, 0x30, 0xFF, 0x24, 0x28, 0xFF, 0x45, 0x30, 0xFF, 0xCC, 0x82, 0xFF, 0x45, 0x30, 0xFF, 0x25, 0x30, 0xFF, 0x45, 0x38, 0xFF, 0x25, 0x30, 0xFF, 0xB4, 0xE6, 0xFF, 0x27, 0x30, 0xFF, 0x27, 0x38, 0xFF, 0x07, 0x30, 0xFF, 0x29, 0x38, 0xFF, 0xBC, 0xA1, 0xFF, 0x09, 0x30, 0xFF, 0x09, 0x38, 0xFF, 0x0A, 0x38, 0xFF, 0x9B, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x38, 0xFF, 0x0A, 0x38, 0xFF, 0x3F, 0x79, 0xFF, 0x0B, 0x40, 0xFF, 0x1D, 0xC8, 0xFF, 0x0B, 0x48, 0xFF, 0x36, 0x78, 0xFF, 0x0B, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x13, 0x50, 0xFF, 0x19, 0x61, 0xFF, 0x4B, 0x58, 0xFF, 0x0B, 0x50, 0xFF, 0x7E, 0xD4, 0xFF, 0x0D, 0x60, 0xFF, 0x0B, 0x50, 0xFF, 0x09, 0x50, 0xFF, 0x0B, 0x50, 0xFF, 0x9F, 0xFD, 0xFF, 0x0C, 0x58, 0xFF, 0x07, 0x48, 0xFF, 0x07, 0x48, 0xFF, 0x0B, 0x78, 0xFF, 0xFF, 0xF7, 0xFF, 0x0A, 0x60, 0xFF, 0x08, 0x68, 0xFF, 0x09, 0x60, 0xFF, 0x33, 0xA8, 0xFF, 0x78, 0xB9, 0xFF, 0x09, 0x68, 0xFF, 0x07, 0x60, 0xFF, 0x39, 0xC1, 0xFF, 0x0A, 0x78, 0xFF, 0x09, 0x80, 0xFF, 0x07, 0x70, 0xFF, 0x11, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0C, 0x80, 0xFF, 0x07, 0x78, 0xFF, 0x09, 0xA0, 0xFF, 0x06, 0x70, 0xFF, 0x06, 0x78, 0xFF, 0xB1, 0xD8, 0xFF, 0x69, 0xA0, 0xFF, 0x05, 0x68, 0xFF,
-    0x05, 0x68, 0xFF, 0x05, 0x68, 0xFF, 0x07, 0x98, 0xFF, 0x05, 0x68, 0xFF, 0x04, 0x68, 0xFF, 0x05, 0x70, 0xFF, 0xA8, 0x98, 0xFF, 0x05, 0x78, 0xFF, 0x04, 0x68, 0xFF, 0x04, 0x68, 0xFF, 0x25, 0x70, 0xFF, 0x49, 0xA8, 0xFF, 0x05, 0x78, 0xFF, 0x25, 0x80, 0xFF, 0x25, 0x78, 0xFF, 0x25, 0x80, 0xFF, 0x24, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0x0B, 0x8A, 0xFF, 0x24, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x45, 0x30, 0xFF, 0x65, 0x38, 0xFF, 0xEC, 0x8A, 0xFF, 0x86, 0x40, 0xFF, 0x26, 0x30, 0xFF, 0x67, 0x38, 0xFF, 0x47, 0x40, 0xFF, 0xF3, 0x88, 0xFF, 0xAA, 0x50, 0xFF, 0x0A, 0x30, 0xFF, 0x09, 0x30, 0xFF, 0x2F, 0x60, 0xFF, 0xD3, 0xB1, 0xFF, 0x0A, 0x38, 0xFF, 0x0A, 0x38, 0xFF, 0x5C, 0xB9, 0xFF, 0xF3, 0xA9, 0xFF, 0xB4, 0xB8, 0xFF, 0x0A, 0x40, 0xFF, 0x31, 0x58, 0xFF, 0x0D, 0x50, 0xFF, 0x6F, 0x89, 0xFF, 0x14, 0xA0, 0xFF, 0x0A, 0x50, 0xFF, 0x56, 0x70, 0xFF, 0x09, 0x48, 0xFF, 0x0B, 0x50, 0xFF, 0x0C, 0x58, 0xFF, 0x18, 0x78, 0xFF, 0x2C, 0x58, 0xFF, 0x09, 0x48, 0xFF, 0x0A, 0x50, 0xFF, 0x0E, 0x78, 0xFF, 0x0B, 0x60, 0xFF, 0x07, 0x48, 0xFF, 0x07, 0x48, 0xFF, 0x0B, 0x68, 0xFF, 0x0B, 0x68, 0xFF, 0x09, 0x58, 0xFF, 0x08, 0x60, 0xFF, 0x0A, 0x60, 0xFF, 0x8D, 0x90, 0xFF, 0x0B, 0x78, 0xFF,
-    0x09, 0x68, 0xFF, 0x68, 0x68, 0xFF, 0x08, 0x70, 0xFF, 0x09, 0x70, 0xFF, 0x09, 0x70, 0xFF, 0x06, 0x70, 0xFF, 0x07, 0x80, 0xFF, 0x08, 0x78, 0xFF, 0x2A, 0x80, 0xFF, 0x08, 0x70, 0xFF, 0x07, 0x78, 0xFF, 0x26, 0x70, 0xFF, 0x06, 0x70, 0xFF, 0x08, 0x80, 0xFF, 0x06, 0x70, 0xFF, 0x05, 0x68, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x68, 0xFF, 0xDD, 0xEA, 0xFF, 0x26, 0x68, 0xFF, 0x04, 0x60, 0xFF, 0x05, 0x60, 0xFF, 0x05, 0x70, 0xFF, 0x33, 0xB8, 0xFF, 0x25, 0x70, 0xFF, 0x04, 0x68, 0xFF, 0x04, 0x68, 0xFF, 0x05, 0x70, 0xFF, 0xFD, 0xE2, 0xFF, 0x05, 0x78, 0xFF, 0x25, 0x78, 0xFF, 0x25, 0x78, 0xFF, 0x86, 0x38, 0xFF, 0x85, 0x38, 0xFF, 0x44, 0x30, 0xFF, 0x44, 0x30, 0xFF, 0x24, 0x28, 0xFF, 0x66, 0x40, 0xFF, 0x45, 0x30, 0xFF, 0x25, 0x30, 0xFF, 0x46, 0x30, 0xFF, 0x46, 0x30, 0xFF, 0x27, 0x40, 0xFF, 0x07, 0x30, 0xFF, 0x28, 0x30, 0xFF, 0x09, 0x30, 0xFF, 0x09, 0x30, 0xFF, 0x09, 0x30, 0xFF, 0x0B, 0x38, 0xFF, 0x2B, 0x40, 0xFF, 0x0A, 0x30, 0xFF, 0x0B, 0x38, 0xFF, 0x0E, 0x48, 0xFF, 0x09, 0x40, 0xFF, 0xDF, 0xFB, 0xFF, 0x0C, 0x40, 0xFF, 0x0B, 0x48, 0xFF, 0x0A, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0xBF, 0xA8, 0xFF, 0x0A, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x0A, 0x48, 0xFF,
-    0x5F, 0xFE, 0xFF, 0x0A, 0x40, 0xFF, 0x09, 0x48, 0xFF, 0x08, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x9F, 0xFD, 0xFF, 0x0A, 0x50, 0xFF, 0x07, 0x48, 0xFF, 0x07, 0x48, 0xFF, 0x0B, 0x60, 0xFF, 0xDF, 0xFF, 0xFF, 0x09, 0x50, 0xFF, 0x07, 0x58, 0xFF, 0x2A, 0x60, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x70, 0xFF, 0x07, 0x60, 0xFF, 0x08, 0x60, 0xFF, 0x09, 0x70, 0xFF, 0x7E, 0xF5, 0xFF, 0x07, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x7F, 0xFE, 0xFF, 0x27, 0x70, 0xFF, 0x16, 0xB8, 0xFF, 0x07, 0x68, 0xFF, 0x5F, 0xFE, 0xFF, 0x05, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x2E, 0xA8, 0xFF, 0x0D, 0xA0, 0xFF, 0x06, 0x78, 0xFF, 0x05, 0x68, 0xFF, 0x06, 0x68, 0xFF, 0x8E, 0xB8, 0xFF, 0xAF, 0xB0, 0xFF, 0x04, 0x58, 0xFF, 0x04, 0x58, 0xFF, 0x05, 0x70, 0xFF, 0x2D, 0xD0, 0xFF, 0x05, 0x68, 0xFF, 0x24, 0x68, 0xFF, 0x24, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x31, 0xE0, 0xFF, 0x25, 0x78, 0xFF, 0x05, 0x78, 0xFF, 0x24, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x25, 0x28, 0xFF, 0x65, 0x20, 0xFF, 0x25, 0x30, 0xFF, 0x25, 0x30, 0xFF, 0x4B, 0x61, 0xFF, 0x67, 0x40, 0xFF, 0xF4, 0x69, 0xFF, 0x28, 0x30, 0xFF, 0x29, 0x40, 0xFF, 0x09, 0x30, 0xFF, 0x0C, 0x38, 0xFF, 0x0C, 0x30, 0xFF,
-    0x09, 0x38, 0xFF, 0x2A, 0x48, 0xFF, 0x0A, 0x30, 0xFF, 0x1F, 0x99, 0xFF, 0x0D, 0x38, 0xFF, 0x0A, 0x40, 0xFF, 0x0B, 0x40, 0xFF, 0x2E, 0x40, 0xFF, 0x3D, 0xB5, 0xFF, 0x08, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x1F, 0xC4, 0xFF, 0x09, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x48, 0xFF, 0x08, 0x48, 0xFF, 0x0A, 0x50, 0xFF, 0x7B, 0x71, 0xFF, 0x0A, 0x48, 0xFF, 0x07, 0x40, 0xFF, 0x07, 0x48, 0xFF, 0x0B, 0x68, 0xFF, 0xF8, 0x88, 0xFF, 0x08, 0x50, 0xFF, 0x08, 0x60, 0xFF, 0x0A, 0x60, 0xFF, 0x31, 0x70, 0xFF, 0x08, 0x68, 0xFF, 0x0A, 0x78, 0xFF, 0x08, 0x68, 0xFF, 0x06, 0x60, 0xFF, 0x15, 0xA8, 0xFF, 0x08, 0x60, 0xFF, 0x07, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x0D, 0x78, 0xFF, 0x29, 0x78, 0xFF, 0x07, 0x68, 0xFF, 0x06, 0x68, 0xFF, 0x88, 0x88, 0xFF, 0xAD, 0xC0, 0xFF, 0x06, 0x68, 0xFF, 0x06, 0x68, 0xFF, 0x0C, 0x78, 0xFF, 0x06, 0x78, 0xFF, 0x05, 0x68, 0xFF, 0x04, 0x60, 0xFF, 0x05, 0x60, 0xFF, 0x05, 0x60, 0xFF, 0x04, 0x60, 0xFF, 0x04, 0x60, 0xFF, 0x04, 0x60, 0xFF, 0x04, 0x60, 0xFF, 0x0A, 0x78, 0xFF, 0x24, 0x68, 0xFF, 0x04, 0x60, 0xFF, 0x24, 0x68, 0xFF, 0x25, 0x70, 0xFF, 0x4C, 0xB0, 0xFF, 0x25, 0x78, 0xFF,
-    0x44, 0x28, 0xFF, 0x23, 0x28, 0xFF, 0x44, 0x28, 0xFF, 0x49, 0x61, 0xFF, 0x8A, 0x69, 0xFF, 0x24, 0x30, 0xFF, 0x25, 0x30, 0xFF, 0x04, 0x28, 0xFF, 0x6A, 0x61, 0xFF, 0x29, 0x59, 0xFF, 0x47, 0x38, 0xFF, 0x08, 0x30, 0xFF, 0x08, 0x30, 0xFF, 0xED, 0x50, 0xFF, 0x08, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x09, 0x30, 0xFF, 0x29, 0x48, 0xFF, 0xF2, 0x88, 0xFF, 0x0B, 0x40, 0xFF, 0x08, 0x38, 0xFF, 0x08, 0x38, 0xFF, 0x09, 0x30, 0xFF, 0x33, 0x90, 0xFF, 0x0A, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x09, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x09, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x09, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x48, 0xFF, 0x07, 0x40, 0xFF, 0x07, 0x48, 0xFF, 0x2B, 0x60, 0xFF, 0x0C, 0x78, 0xFF, 0x08, 0x50, 0xFF, 0x08, 0x58, 0xFF, 0x2B, 0x68, 0xFF, 0x09, 0x58, 0xFF, 0x08, 0x60, 0xFF, 0x09, 0x78, 0xFF, 0x29, 0x70, 0xFF, 0x07, 0x60, 0xFF, 0x08, 0x68, 0xFF, 0x08, 0x60, 0xFF, 0x07, 0x70, 0xFF, 0x06, 0x68, 0xFF, 0x07, 0x68, 0xFF, 0x07, 0x60, 0xFF, 0x06, 0x68, 0xFF, 0x05, 0x68, 0xFF, 0x04, 0x60, 0xFF, 0x38, 0xC9, 0xFF, 0x06, 0x60, 0xFF, 0x05, 0x68, 0xFF, 0x05, 0x68, 0xFF,
-    0x05, 0x70, 0xFF, 0x0D, 0x98, 0xFF, 0x05, 0x68, 0xFF, 0x87, 0x78, 0xFF, 0x04, 0x60, 0xFF, 0xD5, 0xC1, 0xFF, 0x24, 0x58, 0xFF, 0x04, 0x58, 0xFF, 0x24, 0x58, 0xFF, 0x24, 0x58, 0xFF, 0x76, 0xD8, 0xFF, 0x24, 0x60, 0xFF, 0x24, 0x60, 0xFF, 0x24, 0x68, 0xFF, 0x24, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x23, 0x28, 0xFF, 0x43, 0x28, 0xFF, 0x44, 0x28, 0xFF, 0x44, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x25, 0x28, 0xFF, 0x04, 0x28, 0xFF, 0x04, 0x28, 0xFF, 0x86, 0x30, 0xFF, 0x46, 0x30, 0xFF, 0x47, 0x30, 0xFF, 0x09, 0x30, 0xFF, 0x09, 0x30, 0xFF, 0x09, 0x30, 0xFF, 0x0B, 0x30, 0xFF, 0x0B, 0x38, 0xFF, 0x0A, 0x38, 0xFF, 0x08, 0x38, 0xFF, 0x7F, 0xD7, 0xFF, 0x0C, 0x38, 0xFF, 0x0A, 0x38, 0xFF, 0x0B, 0x40, 0xFF, 0x2C, 0x40, 0xFF, 0x0E, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x48, 0xFF, 0x0B, 0x48, 0xFF, 0x09, 0x48, 0xFF, 0x0B, 0x40, 0xFF, 0x0B, 0x48, 0xFF, 0xFF, 0x91, 0xFF, 0x0B, 0x48, 0xFF, 0x4C, 0x60, 0xFF, 0x08, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x3F, 0xFD, 0xFF, 0x0C, 0x58, 0xFF, 0x08, 0x48, 0xFF, 0x07, 0x50, 0xFF, 0x2C, 0x68, 0xFF, 0xBF, 0xFD, 0xFF, 0x07, 0x50, 0xFF, 0x07, 0x58, 0xFF, 0x0A, 0x68, 0xFF, 0x09, 0x58, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x08, 0x78, 0xFF, 0x09, 0x78, 0xFF, 0x06, 0x70, 0xFF, 0x0C, 0x80, 0xFF, 0x0A, 0x68, 0xFF, 0x08, 0x68, 0xFF, 0x06, 0x68, 0xFF, 0x07, 0x60, 0xFF, 0x14, 0xA8, 0xFF, 0x08, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x06, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x0D, 0x88, 0xFF, 0x06, 0x60, 0xFF, 0x05, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x26, 0x80, 0xFF, 0x32, 0x98, 0xFF, 0x05, 0x58, 0xFF, 0x04, 0x50, 0xFF, 0x04, 0x50, 0xFF, 0x05, 0x60, 0xFF, 0xA7, 0x80, 0xFF, 0x04, 0x50, 0xFF, 0x03, 0x50, 0xFF, 0x24, 0x58, 0xFF, 0x06, 0x78, 0xFF, 0x05, 0x60, 0xFF, 0x24, 0x60, 0xFF, 0x24, 0x60, 0xFF, 0x24, 0x68, 0xFF, 0x44, 0x28, 0xFF, 0xC4, 0x28, 0xFF, 0xAA, 0x61, 0xFF, 0x03, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x25, 0x28, 0xFF, 0x44, 0x30, 0xFF, 0x4E, 0x7B, 0xFF, 0x05, 0x30, 0xFF, 0x27, 0x28, 0xFF, 0x48, 0x30, 0xFF, 0x08, 0x38, 0xFF, 0xF0, 0x70, 0xFF, 0x49, 0x40, 0xFF, 0x0A, 0x30, 0xFF, 0x0B, 0x38, 0xFF, 0x0A, 0x38, 0xFF, 0x11, 0x81, 0xFF, 0x70, 0x69, 0xFF, 0x0B, 0x38, 0xFF, 0x0B, 0x40, 0xFF, 0x0A, 0x40, 0xFF, 0x53, 0x90, 0xFF, 0x0C, 0x48, 0xFF, 0x0A, 0x40, 0xFF, 0x0B, 0x40, 0xFF, 0xF0, 0x78, 0xFF, 0xB5, 0xA0, 0xFF, 0x0A, 0x48, 0xFF, 0x0A, 0x40, 0xFF, 0x0D, 0x48, 0xFF, 0x09, 0x48, 0xFF,
-    0x0F, 0x78, 0xFF, 0x0B, 0x40, 0xFF, 0x2C, 0x50, 0xFF, 0x08, 0x48, 0xFF, 0x08, 0x40, 0xFF, 0x0C, 0x68, 0xFF, 0x0C, 0x50, 0xFF, 0x07, 0x48, 0xFF, 0x07, 0x48, 0xFF, 0x0B, 0x60, 0xFF, 0xF4, 0xB9, 0xFF, 0x07, 0x50, 0xFF, 0x07, 0x58, 0xFF, 0x0A, 0x68, 0xFF, 0x08, 0x58, 0xFF, 0x4A, 0x88, 0xFF, 0x08, 0x78, 0xFF, 0x09, 0x70, 0xFF, 0x07, 0x68, 0xFF, 0x07, 0x78, 0xFF, 0x09, 0x70, 0xFF, 0x08, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x06, 0x70, 0xFF, 0x08, 0x78, 0xFF, 0x08, 0x60, 0xFF, 0x06, 0x78, 0xFF, 0x05, 0x68, 0xFF, 0x06, 0x70, 0xFF, 0x06, 0x68, 0xFF, 0x06, 0x60, 0xFF, 0x05, 0x70, 0xFF, 0x25, 0x70, 0xFF, 0x05, 0x70, 0xFF, 0x06, 0x70, 0xFF, 0x05, 0x60, 0xFF, 0x04, 0x60, 0xFF, 0x04, 0x58, 0xFF, 0x04, 0x58, 0xFF, 0x05, 0x58, 0xFF, 0x23, 0x50, 0xFF, 0x23, 0x50, 0xFF, 0x24, 0x50, 0xFF, 0x25, 0x60, 0xFF, 0xDC, 0xC8, 0xFF, 0x24, 0x60, 0xFF, 0x44, 0x68, 0xFF, 0x24, 0x68, 0xFF, 0x43, 0x28, 0xFF, 0x64, 0x28, 0xFF, 0x44, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x24, 0x28, 0xFF, 0x24, 0x30, 0xFF, 0x45, 0x30, 0xFF, 0x25, 0x30, 0xFF, 0x07, 0x28, 0xFF, 0x27, 0x30, 0xFF, 0x28, 0x30, 0xFF, 0x2A, 0x30, 0xFF, 0x09, 0x30, 0xFF, 0x0A, 0x38, 0xFF, 0x0A, 0x38, 0xFF,
-    0x0A, 0x38, 0xFF, 0x0A, 0x38, 0xFF, 0x2B, 0x40, 0xFF, 0x0B, 0x38, 0xFF, 0x0B, 0x38, 0xFF, 0x0C, 0x38, 0xFF, 0x98, 0x7A, 0xFF, 0x0A, 0x40, 0xFF, 0x09, 0x40, 0xFF, 0x0C, 0x40, 0xFF, 0x0C, 0x48, 0xFF, 0x7F, 0xA0, 0xFF, 0x09, 0x48, 0xFF, 0x0D, 0x48, 0xFF, 0x0C, 0x40, 0xFF, 0x0A, 0x48, 0xFF, 0x1F, 0xFF, 0xFF, 0x0B, 0x48, 0xFF, 0x09, 0x50, 0xFF, 0x08, 0x50, 0xFF, 0x08, 0x40, 0xFF, 0x5F, 0xF3, 0xFF, 0x0B, 0x50, 0xFF, 0x07, 0x48, 0xFF, 0x07, 0x48, 0xFF, 0x0A, 0x60, 0xFF, 0x5F, 0xFF, 0xFF, 0x08, 0x50, 0xFF, 0x07, 0x60, 0xFF, 0x09, 0x60, 0xFF, 0x0A, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFF, 0x09, 0x70, 0xFF, 0x09, 0x78, 0xFF, 0x07, 0x70, 0xFF, 0xDF, 0xFF, 0xFF, 0x09, 0x68, 0xFF, 0x08, 0x78, 0xFF, 0x26, 0x70, 0xFF, 0x07, 0x70, 0xFF, 0xBF, 0xE4, 0xFF, 0x07, 0x78, 0xFF, 0x05, 0x70, 0xFF, 0x06, 0x70, 0xFF, 0x05, 0x60, 0xFF, 0x4F, 0xA0, 0xFF, 0x27, 0x80, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x70, 0xFF, 0x05, 0x68, 0xFF, 0x11, 0xB0, 0xFF, 0x05, 0x60, 0xFF, 0x04, 0x58, 0xFF, 0x25, 0x58, 0xFF, 0x04, 0x50, 0xFF, 0x2D, 0xB0, 0xFF, 0x24, 0x50, 0xFF, 0x23, 0x50, 0xFF, 0x24, 0x50, 0xFF, 0x03, 0x58, 0xFF, 0x2D, 0xA8, 0xFF, 0x03, 0x60, 0xFF, 0x23, 0x58, 0xFF,
+    0xC2, 0x38, 0xA2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0xA2, 0x38, 0xC2, 0x38, 0xC5, 0x79, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x40, 0x23, 0x59, 0xC2, 0x40, 0xE3, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0x03, 0x49, 0xE3, 0x48, 0xE2, 0x40, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x24, 0x51, 0x44, 0x51, 0x23, 0x49, 0x24, 0x49, 0x84, 0x51, 0x84, 0x51, 0x84, 0x59, 0xA5, 0x59, 0xE5, 0x61, 0xC5, 0x59,
+    0xA5, 0x59, 0xC6, 0x59, 0xFF, 0xFF, 0x27, 0x62, 0xE6, 0x61, 0xE6, 0x59, 0x8F, 0x62, 0x06, 0x62, 0xE6, 0x59, 0xC6, 0x59, 0xE6, 0x59, 0x27, 0x62, 0xE6, 0x59, 0xA6, 0x51, 0xC6, 0x59, 0x07, 0x5A, 0xE7, 0x59, 0xA6, 0x59, 0x85, 0x51, 0x85, 0x51, 0x65, 0x51, 0x24, 0x49, 0x44, 0x51, 0x24, 0x49, 0x64, 0x51, 0x44, 0x49, 0x23, 0x49, 0x44, 0x49, 0x44, 0x49, 0x03, 0x41, 0x23, 0x41, 0x03, 0x41,
+    0x43, 0x49, 0x03, 0x41, 0x23, 0x49, 0x23, 0x49, 0x03, 0x41, 0x44, 0x51, 0x24, 0x49, 0x03, 0x49, 0x23, 0x49, 0x64, 0x51, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x23, 0x51, 0x43, 0x51, 0x23, 0x51, 0xA2, 0x38, 0x84, 0x71, 0x23, 0x51, 0x81, 0x38, 0xE3, 0x48, 0xE3, 0x48, 0x64, 0x61, 0xC2, 0x40, 0x03, 0x59, 0xC2, 0x48, 0xC2, 0x48, 0x65, 0x59, 0xC5, 0x71, 0xA1, 0x38, 0xE3, 0x50, 0xE3, 0x48,
+    0x24, 0x51, 0x87, 0x92, 0x03, 0x49, 0xE3, 0x40, 0x03, 0x51, 0x23, 0x49, 0x67, 0x8A, 0x23, 0x51, 0x44, 0x51, 0x23, 0x51, 0x64, 0x59, 0x44, 0x59, 0x09, 0x93, 0x84, 0x59, 0x84, 0x51, 0xA5, 0x59, 0xA5, 0x59, 0x2C, 0xBC, 0x26, 0x6A, 0x06, 0x62, 0xE5, 0x59, 0xE6, 0x59, 0xCB, 0xAB, 0x26, 0x62, 0xE6, 0x59, 0xC5, 0x59, 0xE6, 0x59, 0x4D, 0xBC, 0xE7, 0x61, 0xE6, 0x59, 0xC6, 0x59, 0xC7, 0x59,
+    0xE8, 0x59, 0xA4, 0x61, 0xA6, 0x51, 0x85, 0x51, 0x65, 0x51, 0x65, 0x51, 0x2A, 0xA3, 0x44, 0x51, 0x24, 0x49, 0x44, 0x49, 0x23, 0x49, 0xE8, 0x9A, 0x23, 0x49, 0x23, 0x41, 0x03, 0x41, 0x23, 0x41, 0x03, 0x41, 0x63, 0x59, 0x03, 0x41, 0x23, 0x49, 0x02, 0x41, 0x23, 0x49, 0x87, 0x92, 0x23, 0x49, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x23, 0x59, 0x23, 0x49, 0x23, 0x51, 0x23, 0x51, 0x64, 0x59,
+    0xE2, 0x40, 0xC2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x40, 0xC3, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0x03, 0x49, 0xC2, 0x40, 0xE2, 0x40, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x23, 0x49, 0x23, 0x49, 0x44, 0x51, 0x23, 0x49, 0x44, 0x51, 0x44, 0x51, 0x64, 0x51, 0x64, 0x51, 0x84, 0x59, 0xC5, 0x61, 0xA5, 0x59, 0xC5, 0x61,
+    0xC5, 0x61, 0x71, 0xE5, 0x33, 0x6B, 0x26, 0x6A, 0x06, 0x62, 0x06, 0x62, 0xA8, 0x8A, 0x48, 0x6A, 0x06, 0x62, 0x07, 0x62, 0xCA, 0x82, 0x10, 0xCD, 0xE6, 0x59, 0xE7, 0x61, 0xE7, 0x61, 0x27, 0x62, 0x2A, 0x62, 0xA5, 0x71, 0xE8, 0x69, 0xC6, 0x61, 0x86, 0x59, 0x85, 0x59, 0xA5, 0x61, 0x84, 0x59, 0x23, 0x51, 0x44, 0x51, 0x43, 0x49, 0xE8, 0x9A, 0x64, 0x61, 0x23, 0x49, 0x23, 0x49, 0xE5, 0x69,
+    0xE5, 0x69, 0x23, 0x51, 0x23, 0x49, 0xC6, 0x61, 0x88, 0x7A, 0x03, 0x49, 0xE5, 0x79, 0x85, 0x59, 0x23, 0x49, 0x64, 0x61, 0x44, 0x51, 0x09, 0xAB, 0xE2, 0x48, 0x23, 0x51, 0x64, 0x61, 0x84, 0x61, 0x03, 0x41, 0xA2, 0x38, 0xA2, 0x38, 0x86, 0x81, 0xE3, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xE6, 0x89, 0xC2, 0x40, 0xE3, 0x40, 0xE3, 0x40, 0xE3, 0x40, 0x64, 0x69, 0xE3, 0x40, 0xE2, 0x48,
+    0xE3, 0x48, 0x03, 0x49, 0x06, 0x7A, 0x23, 0x49, 0x23, 0x49, 0x43, 0x51, 0x23, 0x51, 0xC7, 0x92, 0x44, 0x51, 0x64, 0x51, 0xA5, 0x59, 0x64, 0x51, 0x8A, 0xA3, 0xE6, 0x61, 0xC5, 0x59, 0xC5, 0x61, 0xC5, 0x61, 0xC9, 0x9B, 0x06, 0x6A, 0x06, 0x62, 0x06, 0x62, 0x26, 0x62, 0x2C, 0xAC, 0x27, 0x62, 0x27, 0x62, 0x27, 0x62, 0x47, 0x6A, 0xB4, 0xDD, 0x29, 0x62, 0x08, 0x5A, 0x28, 0x62, 0x28, 0x62,
+    0x34, 0xC5, 0x29, 0x62, 0x08, 0x5A, 0xA6, 0x59, 0xA6, 0x59, 0x0A, 0x93, 0x65, 0x51, 0x65, 0x59, 0x44, 0x51, 0x43, 0x51, 0x44, 0x51, 0x44, 0x49, 0xA5, 0x61, 0x23, 0x49, 0x03, 0x49, 0x23, 0x49, 0x23, 0x49, 0x03, 0x41, 0x03, 0x41, 0xE2, 0x40, 0x03, 0x49, 0x23, 0x49, 0x23, 0x49, 0x03, 0x49, 0xE3, 0x48, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x23, 0x49, 0x84, 0x59, 0x03, 0x49, 0x23, 0x49,
+    0xE3, 0x40, 0xA2, 0x30, 0xA2, 0x38, 0xA2, 0x38, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x38, 0xE2, 0x40, 0xC2, 0x40, 0xE3, 0x40, 0xE2, 0x40, 0xE3, 0x40, 0xE3, 0x40, 0xE3, 0x40, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x23, 0x49, 0x23, 0x51, 0x63, 0x59, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x84, 0x59, 0x84, 0x59, 0xC6, 0x61, 0xE6, 0x61, 0xC5, 0x61, 0xE5, 0x61,
+    0xE5, 0x61, 0x27, 0x6A, 0x27, 0x6A, 0x06, 0x62, 0x06, 0x62, 0x67, 0x6A, 0xF0, 0xBC, 0x68, 0x6A, 0x28, 0x62, 0x49, 0x62, 0xEC, 0x7A, 0xB4, 0xCD, 0x6C, 0x6A, 0xE8, 0x61, 0x07, 0x72, 0xAF, 0x93, 0xF9, 0xCD, 0xAD, 0x6A, 0xEB, 0x8A, 0x69, 0x82, 0xC6, 0x61, 0x6B, 0xA3, 0x44, 0x51, 0xA5, 0x79, 0xA5, 0x71, 0xA5, 0x69, 0xC8, 0x92, 0x44, 0x51, 0x44, 0x51, 0x24, 0x49, 0x44, 0x51, 0x26, 0x7A,
+    0x84, 0x61, 0x64, 0x61, 0x64, 0x61, 0x03, 0x49, 0x67, 0x82, 0xA5, 0x59, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x66, 0x82, 0x43, 0x59, 0x03, 0x51, 0x23, 0x51, 0x23, 0x51, 0x67, 0x82, 0x23, 0x51, 0xC2, 0x40, 0xC2, 0x40, 0xA2, 0x38, 0xA2, 0x40, 0xC2, 0x40, 0x64, 0x69, 0xC2, 0x40, 0xE3, 0x48, 0xE3, 0x40, 0x03, 0x49, 0xC6, 0x79, 0xC2, 0x40, 0xE3, 0x40, 0xE3, 0x40, 0xE2, 0x40, 0xC5, 0x69,
+    0x03, 0x49, 0x24, 0x51, 0x03, 0x49, 0x46, 0x82, 0x24, 0x59, 0x44, 0x51, 0x03, 0x51, 0x64, 0x51, 0xA7, 0x82, 0x64, 0x59, 0x64, 0x51, 0xA4, 0x59, 0xA5, 0x61, 0x06, 0x6A, 0xA5, 0x59, 0xC5, 0x61, 0x06, 0x6A, 0xFF, 0xFF, 0x48, 0x6A, 0x06, 0x62, 0x27, 0x6A, 0x0F, 0x9C, 0xFF, 0xFF, 0x12, 0xBD, 0xAC, 0xA3, 0xAA, 0x7A, 0xF1, 0x7A, 0xFF, 0xFF, 0xD1, 0x72, 0x6A, 0x62, 0xAE, 0x6A, 0x94, 0x73,
+    0xFF, 0xFF, 0xF1, 0x72, 0x2A, 0x62, 0xE7, 0x61, 0xC6, 0x59, 0xE6, 0x61, 0x84, 0x51, 0x64, 0x51, 0x64, 0x51, 0x44, 0x51, 0x44, 0x51, 0x84, 0x61, 0x44, 0x59, 0x43, 0x59, 0x43, 0x49, 0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 0x03, 0x49, 0x03, 0x41, 0x23, 0x49, 0x23, 0x49, 0x03, 0x49, 0x23, 0x49, 0x03, 0x49, 0x03, 0x49, 0x23, 0x49, 0x23, 0x51, 0x23, 0x51, 0x03, 0x49, 0x23, 0x51, 0x23, 0x51,
+    0xA2, 0x40, 0xA5, 0x89, 0xA2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xA2, 0x40, 0x85, 0x81, 0xE2, 0x40, 0x44, 0x51, 0xE3, 0x40, 0xC2, 0x40, 0xE6, 0x81, 0x85, 0x61, 0xE3, 0x40, 0x03, 0x49, 0x03, 0x51, 0x65, 0x59, 0xA9, 0x9A, 0x03, 0x49, 0x23, 0x49, 0x23, 0x51, 0x24, 0x51, 0x09, 0xAB, 0x63, 0x51, 0x83, 0x61, 0x64, 0x51, 0x84, 0x59, 0xA7, 0x92, 0xA5, 0x61, 0x26, 0x6A, 0xC5, 0x61, 0xE5, 0x61,
+    0x88, 0x72, 0x2D, 0xC4, 0x67, 0x6A, 0x47, 0x6A, 0x47, 0x6A, 0xA9, 0x72, 0x31, 0xE5, 0x88, 0x72, 0x69, 0x6A, 0xCC, 0x72, 0x52, 0x7B, 0xFF, 0xFF, 0xAE, 0x6A, 0x8B, 0x72, 0x6C, 0x6A, 0xB6, 0x83, 0xFF, 0xFF, 0xAE, 0x6A, 0x2E, 0x93, 0xEB, 0x8A, 0xC6, 0x61, 0xC5, 0x61, 0xE6, 0x71, 0x65, 0x61, 0x84, 0x61, 0xC8, 0x8A, 0x44, 0x51, 0x64, 0x59, 0x64, 0x51, 0x23, 0x49, 0x26, 0x7A, 0x44, 0x51,
+    0x03, 0x49, 0x23, 0x51, 0x64, 0x59, 0x8B, 0xA3, 0x23, 0x49, 0x03, 0x49, 0x03, 0x49, 0xE6, 0x69, 0x03, 0x51, 0x23, 0x51, 0x23, 0x51, 0x03, 0x49, 0x05, 0x72, 0x23, 0x51, 0x43, 0x51, 0x43, 0x51, 0xE3, 0x40, 0xC2, 0x40, 0xA2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xA2, 0x40, 0x85, 0x71, 0x44, 0x51, 0x23, 0x51, 0xE3, 0x48, 0x03, 0x51, 0x0A, 0xAB, 0xE2, 0x48, 0x03, 0x49, 0x23, 0x49,
+    0x23, 0x61, 0x85, 0x81, 0x23, 0x51, 0x03, 0x49, 0x43, 0x59, 0x23, 0x51, 0x23, 0x49, 0x64, 0x61, 0x64, 0x59, 0x84, 0x59, 0x84, 0x59, 0xA4, 0x59, 0xA5, 0x61, 0x8B, 0x9B, 0xA4, 0x59, 0xE5, 0x69, 0xA8, 0x7A, 0xFF, 0xFF, 0xCD, 0xAB, 0x47, 0x72, 0x67, 0x72, 0xC9, 0x7A, 0xFF, 0xFF, 0x2F, 0xC4, 0xCA, 0x72, 0x0C, 0x73, 0xB6, 0xAC, 0x3D, 0xF7, 0xCC, 0x72, 0xAB, 0x72, 0xCD, 0x72, 0x7C, 0xAC,
+    0xFF, 0xFF, 0x49, 0x6A, 0x28, 0x6A, 0x08, 0x62, 0xE7, 0x61, 0x27, 0x7A, 0x6B, 0xA3, 0x85, 0x59, 0x85, 0x59, 0x84, 0x59, 0xC5, 0x69, 0xA8, 0x9A, 0x85, 0x59, 0x23, 0x49, 0x44, 0x51, 0x44, 0x51, 0xC8, 0x9A, 0x23, 0x49, 0x03, 0x49, 0x03, 0x49, 0x23, 0x49, 0x06, 0x72, 0x09, 0xA3, 0x03, 0x49, 0x23, 0x49, 0x23, 0x51, 0x23, 0x51, 0x46, 0x92, 0x03, 0x51, 0x23, 0x51, 0x44, 0x51, 0x23, 0x51,
+    0xA2, 0x38, 0xC2, 0x40, 0xC2, 0x38, 0xC5, 0x81, 0xC2, 0x48, 0xC2, 0x40, 0xC2, 0x40, 0xE3, 0x48, 0xC6, 0x81, 0x03, 0x51, 0xE3, 0x48, 0xE3, 0x48, 0x03, 0x49, 0xE6, 0x81, 0xE2, 0x40, 0x64, 0x59, 0x43, 0x51, 0x43, 0x51, 0x47, 0x92, 0x03, 0x51, 0x23, 0x51, 0x44, 0x51, 0x44, 0x51, 0x29, 0xAB, 0x64, 0x59, 0xA4, 0x59, 0xA4, 0x59, 0xC5, 0x61, 0x6C, 0xC4, 0x88, 0x7A, 0xE5, 0x61, 0x06, 0x6A,
+    0xE9, 0x7A, 0xF3, 0xFE, 0xA8, 0x7A, 0x67, 0x72, 0x67, 0x72, 0xEA, 0x82, 0xB8, 0xFF, 0xCC, 0x8B, 0xC9, 0x72, 0x0B, 0x7B, 0x57, 0x94, 0xBE, 0xF7, 0xAD, 0x83, 0xEA, 0x72, 0xAA, 0x72, 0xD7, 0x9C, 0x54, 0x9C, 0x4C, 0x8B, 0xE9, 0x82, 0x68, 0x72, 0xC9, 0x82, 0x27, 0x82, 0x27, 0x82, 0x26, 0x72, 0xA8, 0x8A, 0x06, 0x6A, 0x64, 0x59, 0x47, 0x6A, 0xE6, 0x61, 0x05, 0x72, 0xA5, 0x61, 0x43, 0x59,
+    0x64, 0x59, 0x46, 0x7A, 0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 0x64, 0x59, 0x84, 0x61, 0x23, 0x51, 0x23, 0x51, 0x23, 0x51, 0x8C, 0xA3, 0x23, 0x51, 0x23, 0x51, 0x44, 0x51, 0x44, 0x51, 0x43, 0x51, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x48, 0xC2, 0x48, 0xC2, 0x48, 0xE2, 0x40, 0xE2, 0x48, 0xC2, 0x48, 0x64, 0x59, 0x03, 0x51, 0x03, 0x49, 0xE2, 0x48, 0xA5, 0x69, 0x03, 0x51, 0x64, 0x61,
+    0x64, 0x59, 0x84, 0x69, 0xE3, 0x58, 0x23, 0x59, 0x23, 0x51, 0xE6, 0x79, 0x64, 0x59, 0x06, 0x62, 0x84, 0x59, 0x84, 0x59, 0x84, 0x59, 0xA4, 0x61, 0x66, 0x82, 0x25, 0x72, 0x6A, 0x93, 0x06, 0x6A, 0x68, 0x93, 0xF5, 0xF6, 0xFF, 0xFF, 0xA8, 0x7A, 0xA7, 0x7A, 0xD8, 0xFF, 0xFD, 0xFF, 0xAF, 0xAC, 0x09, 0x83, 0x2A, 0x83, 0xB3, 0xCD, 0xFD, 0xFF, 0x0C, 0x9C, 0x0A, 0x83, 0x0A, 0x7B, 0x10, 0xBD,
+    0xFE, 0xFF, 0x49, 0x8B, 0xA8, 0x72, 0x47, 0x6A, 0x06, 0x6A, 0x2E, 0xC4, 0x52, 0xDD, 0x27, 0x72, 0x85, 0x59, 0x85, 0x59, 0xC8, 0x9A, 0xA5, 0x61, 0x28, 0x6A, 0x44, 0x51, 0x24, 0x51, 0x66, 0x8A, 0x64, 0x51, 0x23, 0x49, 0x23, 0x49, 0x03, 0x49, 0xA4, 0x71, 0x44, 0x51, 0x43, 0x51, 0x23, 0x51, 0x23, 0x51, 0x25, 0x82, 0x44, 0x59, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0xA7, 0x9A, 0x64, 0x59,
+    0xC2, 0x40, 0xE3, 0x48, 0xC2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0x64, 0x69, 0x03, 0x51, 0xE2, 0x48, 0xE3, 0x48, 0x0A, 0xA3, 0x06, 0x92, 0xE2, 0x48, 0xE3, 0x48, 0x03, 0x49, 0x45, 0x69, 0x06, 0x82, 0x64, 0x59, 0x64, 0x59, 0x07, 0x7A, 0x88, 0x92, 0x24, 0x59, 0x44, 0x51, 0xA5, 0x69, 0x84, 0x59, 0x08, 0x9B, 0xA5, 0x61, 0xA5, 0x61, 0xA5, 0x61, 0xC8, 0x82, 0x26, 0x72, 0xE5, 0x69, 0x46, 0x72,
+    0x0B, 0xA4, 0xFF, 0xFF, 0x71, 0xAD, 0xE8, 0x7A, 0xC7, 0x7A, 0xC9, 0x8B, 0xFF, 0xFF, 0x2C, 0x9C, 0xE8, 0x7A, 0xE8, 0x7A, 0xCB, 0x93, 0xFF, 0xFF, 0x0C, 0x94, 0x6B, 0x8B, 0x09, 0x7B, 0x10, 0xBE, 0xFF, 0xFF, 0x29, 0x8B, 0x87, 0x72, 0x06, 0x6A, 0x06, 0x6A, 0xE6, 0x69, 0x27, 0x72, 0x27, 0x72, 0x85, 0x59, 0x85, 0x59, 0x45, 0x51, 0xE6, 0x61, 0xC5, 0x61, 0x84, 0x59, 0x43, 0x51, 0x64, 0x51,
+    0xE5, 0x61, 0xE6, 0x61, 0x23, 0x49, 0x03, 0x49, 0x23, 0x49, 0xC5, 0x61, 0x64, 0x59, 0x27, 0x72, 0x03, 0x51, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x44, 0x51, 0x64, 0x59, 0xA5, 0x61, 0x84, 0x61, 0xC1, 0x40, 0x06, 0x9A, 0xC3, 0x40, 0xC2, 0x40, 0xC2, 0x48, 0xC2, 0x48, 0x68, 0xB2, 0x85, 0x69, 0xE2, 0x48, 0x64, 0x61, 0xE2, 0x48, 0x23, 0x69, 0xE3, 0x50, 0x03, 0x49, 0xE3, 0x50, 0x44, 0x61,
+    0x85, 0x61, 0x44, 0x51, 0x23, 0x51, 0x23, 0x51, 0x23, 0x59, 0x44, 0x59, 0x84, 0x69, 0x84, 0x59, 0xA4, 0x61, 0xA4, 0x61, 0xC4, 0x69, 0xA4, 0x69, 0xE8, 0x82, 0xE4, 0x69, 0x26, 0x72, 0x66, 0x72, 0x6F, 0xCD, 0x0F, 0xCE, 0x71, 0xBD, 0x08, 0x8B, 0x66, 0x7A, 0xEA, 0x9B, 0x36, 0xEF, 0xCE, 0xB4, 0xE8, 0x7A, 0xC8, 0x7A, 0xCB, 0x93, 0xFE, 0xFF, 0xEA, 0x8B, 0xC8, 0x7A, 0x6A, 0x8B, 0x6B, 0xA4,
+    0xAC, 0xB4, 0x4A, 0x93, 0x46, 0x72, 0x88, 0x82, 0xE5, 0x69, 0xA5, 0x69, 0x2A, 0x93, 0x27, 0x72, 0xA5, 0x61, 0x29, 0x9B, 0x6A, 0xA3, 0x06, 0x72, 0xC5, 0x59, 0x43, 0x51, 0x87, 0x92, 0x84, 0x59, 0xA5, 0x59, 0x03, 0x49, 0x63, 0x59, 0x26, 0x72, 0x43, 0x51, 0x84, 0x59, 0xE5, 0x69, 0xE8, 0x92, 0x43, 0x51, 0x84, 0x59, 0x64, 0x59, 0x84, 0x61, 0x86, 0x8A, 0x64, 0x59, 0x84, 0x61, 0x84, 0x61,
+    0xA2, 0x48, 0xC2, 0x50, 0xC2, 0x48, 0xC2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE3, 0x50, 0xE3, 0x60, 0xE2, 0x50, 0x85, 0x61, 0xE3, 0x48, 0x02, 0x59, 0x87, 0xAA, 0x83, 0x69, 0x24, 0x59, 0x64, 0x69, 0x23, 0x71, 0x68, 0xBA, 0x23, 0x59, 0xA5, 0x71, 0x23, 0x61, 0x84, 0x61, 0xC8, 0xAA, 0x47, 0x82, 0x84, 0x61, 0xC7, 0x8A, 0xC4, 0x61, 0x66, 0x8A, 0x85, 0x8A, 0xEA, 0xAB, 0xA7, 0x82, 0x66, 0x7A,
+    0x0F, 0xED, 0xB6, 0xFF, 0xF6, 0xFF, 0x08, 0x8B, 0xC7, 0x82, 0xE7, 0x8A, 0xED, 0xDC, 0x2B, 0xA4, 0x08, 0x83, 0x08, 0x83, 0xEA, 0x93, 0xD3, 0xFE, 0xC8, 0x8B, 0xA7, 0x7A, 0x49, 0x8B, 0xFF, 0xFF, 0x34, 0xFF, 0x66, 0x7A, 0x26, 0x72, 0x47, 0x72, 0xCB, 0xA3, 0x26, 0x6A, 0x6D, 0xD4, 0xE6, 0x69, 0xE9, 0x92, 0x27, 0x72, 0xC6, 0x69, 0x49, 0xBB, 0xC5, 0x61, 0xE8, 0x9A, 0x64, 0x59, 0x85, 0x59,
+    0x29, 0xAB, 0x64, 0x51, 0x64, 0x51, 0x23, 0x49, 0x84, 0x59, 0xE5, 0x69, 0x29, 0xAB, 0x43, 0x51, 0x84, 0x59, 0x85, 0x59, 0x84, 0x59, 0x87, 0xAA, 0x64, 0x59, 0x84, 0x61, 0x84, 0x61, 0xA4, 0x61, 0xC2, 0x48, 0x03, 0x49, 0xE2, 0x48, 0x26, 0x9A, 0x03, 0x59, 0xE2, 0x50, 0x03, 0x51, 0xE2, 0x50, 0x87, 0xAA, 0xC5, 0x71, 0x02, 0x51, 0x23, 0x59, 0x23, 0x61, 0x88, 0xAA, 0x24, 0x59, 0x65, 0x61,
+    0xA6, 0x69, 0xC6, 0x79, 0xA8, 0xAA, 0x44, 0x59, 0x84, 0x69, 0x47, 0x8A, 0xA5, 0x61, 0x8A, 0xBB, 0xA4, 0x61, 0x84, 0x69, 0xC5, 0x69, 0x25, 0x72, 0x89, 0xB3, 0x25, 0x72, 0x05, 0x6A, 0xC8, 0x8A, 0xEE, 0xC4, 0x4D, 0xD5, 0xFF, 0xFF, 0x48, 0x93, 0xC7, 0x82, 0x07, 0x83, 0xFF, 0xFF, 0xEF, 0xCD, 0xA7, 0x82, 0xC8, 0x82, 0x08, 0x83, 0xE8, 0xAB, 0x86, 0x83, 0x87, 0x7A, 0x27, 0x83, 0x6C, 0xBC,
+    0x89, 0x9B, 0x86, 0x7A, 0x46, 0x7A, 0x66, 0x72, 0x05, 0x6A, 0xC5, 0x69, 0x4A, 0x9B, 0x06, 0x72, 0x84, 0x59, 0xA4, 0x61, 0x2A, 0x93, 0x84, 0x61, 0x84, 0x61, 0x84, 0x61, 0x84, 0x59, 0x64, 0x59, 0x42, 0x69, 0x46, 0x82, 0xA4, 0x59, 0x64, 0x51, 0x85, 0x59, 0xA4, 0x71, 0x85, 0x61, 0x64, 0x59, 0xA5, 0x61, 0xE6, 0x69, 0x69, 0x9B, 0x2A, 0xA3, 0x85, 0x61, 0x84, 0x61, 0xC5, 0x61, 0xA5, 0x61,
+    0xE2, 0x50, 0xE2, 0x50, 0x02, 0x51, 0xE2, 0x58, 0x03, 0x59, 0xB3, 0xFF, 0x23, 0x59, 0x03, 0x59, 0x23, 0x59, 0xA5, 0x69, 0x43, 0x7A, 0x23, 0x61, 0x23, 0x59, 0x02, 0x59, 0x23, 0x61, 0x64, 0x61, 0xE6, 0x71, 0xC5, 0x71, 0x23, 0x61, 0x44, 0x61, 0x64, 0x59, 0x63, 0x59, 0xA5, 0x61, 0x83, 0x59, 0x05, 0x72, 0xA4, 0x69, 0x05, 0x72, 0xC4, 0x69, 0xE9, 0xB3, 0x25, 0x72, 0x45, 0x6A, 0x46, 0x7A,
+    0xC8, 0xB3, 0x97, 0xFF, 0x74, 0xFF, 0x67, 0x93, 0xE7, 0x82, 0x51, 0xEE, 0xFA, 0xFF, 0x0F, 0xDE, 0x69, 0x93, 0x8A, 0x9B, 0x0B, 0xB4, 0xF7, 0xFF, 0x28, 0x9C, 0xC7, 0x82, 0x27, 0x8B, 0xEB, 0xBC, 0x74, 0xFF, 0x88, 0xA3, 0x87, 0x7A, 0xC8, 0x92, 0xE8, 0x92, 0xAA, 0xBB, 0x26, 0x7A, 0x26, 0x72, 0x84, 0x61, 0x84, 0x61, 0x69, 0xBB, 0x88, 0x8A, 0x45, 0x82, 0xC5, 0x69, 0xA4, 0x59, 0xA7, 0xA2,
+    0xE4, 0x71, 0x84, 0x61, 0x84, 0x59, 0x84, 0x59, 0xC8, 0x9A, 0xED, 0x51, 0x84, 0x59, 0x84, 0x59, 0xC5, 0x59, 0xE4, 0x79, 0xA4, 0x61, 0x27, 0x72, 0xA5, 0x61, 0xC5, 0x69, 0xA7, 0x9A, 0xC5, 0x69, 0x03, 0x59, 0x03, 0x51, 0x23, 0x59, 0x03, 0x59, 0x03, 0x59, 0x23, 0x61, 0x84, 0x69, 0x63, 0x61, 0xA4, 0x69, 0x43, 0x61, 0xCA, 0xDB, 0x02, 0x69, 0x43, 0x59, 0x23, 0x61, 0x64, 0x71, 0x87, 0xA2,
+    0xA5, 0x69, 0x06, 0x72, 0x44, 0x69, 0xC6, 0x79, 0x64, 0x61, 0x84, 0x61, 0xE6, 0x81, 0x46, 0x7A, 0x48, 0xAB, 0xC4, 0x61, 0x66, 0x92, 0x05, 0x72, 0xB1, 0xE5, 0xF0, 0xE5, 0x69, 0xA3, 0x45, 0x7A, 0xB3, 0xF6, 0xFF, 0xFF, 0xFE, 0xFF, 0xC9, 0xAB, 0x69, 0x9B, 0xA8, 0x9B, 0xFF, 0xFF, 0x70, 0xE6, 0xE7, 0x8A, 0x08, 0x93, 0xCD, 0xD4, 0xFF, 0xFF, 0xCC, 0xC4, 0xA7, 0x82, 0xD3, 0xE6, 0x90, 0xE6,
+    0xFF, 0xFF, 0x93, 0xE6, 0xC8, 0x8A, 0xC8, 0x92, 0x45, 0x7A, 0x06, 0x7A, 0x05, 0x6A, 0x88, 0x82, 0x27, 0x72, 0x8A, 0xB3, 0x09, 0x8B, 0x46, 0x8A, 0xC5, 0x71, 0x84, 0x61, 0x6A, 0xB3, 0x67, 0x82, 0xC5, 0x69, 0x06, 0x6A, 0x64, 0x59, 0xFF, 0xFF, 0xA5, 0x59, 0xA4, 0x59, 0x84, 0x59, 0xDD, 0xE6, 0xE6, 0x69, 0xC5, 0x61, 0xC5, 0x69, 0xC5, 0x69, 0x99, 0xDD, 0xE5, 0x69, 0xC5, 0x69, 0xE5, 0x71,
+    0xC2, 0x50, 0x06, 0xA2, 0x43, 0x61, 0xE2, 0x58, 0xE2, 0x58, 0x03, 0x59, 0x23, 0x61, 0xFE, 0xFF, 0x66, 0x8A, 0xC4, 0x71, 0x23, 0x61, 0x14, 0xFF, 0xC5, 0x79, 0x23, 0x61, 0x44, 0x61, 0x64, 0x69, 0xA7, 0x92, 0xA4, 0x61, 0x23, 0x59, 0xA5, 0x79, 0x06, 0x82, 0x64, 0x61, 0x06, 0x7A, 0x87, 0x82, 0xA5, 0x69, 0x84, 0x69, 0x46, 0x7A, 0x45, 0x82, 0xEC, 0xAB, 0x6B, 0xCC, 0x66, 0x7A, 0x25, 0x7A,
+    0x90, 0xDD, 0xFF, 0xFF, 0x2F, 0xF6, 0x27, 0x93, 0x08, 0x93, 0x88, 0xA3, 0xFE, 0xFF, 0x8B, 0xBC, 0x08, 0x93, 0xC7, 0x8A, 0xCB, 0xBC, 0xFE, 0xFF, 0xB5, 0xF7, 0xE7, 0x8A, 0x6F, 0xD5, 0x8E, 0xE5, 0x88, 0xA3, 0xCD, 0xCC, 0xE8, 0x92, 0x08, 0x8B, 0xE8, 0x92, 0xE5, 0x69, 0xA6, 0x8A, 0xA5, 0x61, 0xE5, 0x71, 0x87, 0x82, 0x05, 0x7A, 0xA5, 0x69, 0xA4, 0x61, 0x84, 0x61, 0x26, 0x8A, 0xA5, 0x71,
+    0x84, 0x59, 0x67, 0x72, 0xA4, 0x69, 0xC4, 0x61, 0xC5, 0x61, 0xA4, 0x61, 0x84, 0x61, 0xC9, 0xB3, 0x29, 0x93, 0xC5, 0x69, 0xC5, 0x69, 0xC5, 0x69, 0x27, 0xAB, 0xC5, 0x69, 0xE5, 0x69, 0xE5, 0x71, 0x03, 0x59, 0x47, 0xB2, 0x84, 0x71, 0x43, 0x69, 0x03, 0x61, 0x24, 0x61, 0x98, 0xFF, 0xA7, 0xA2, 0x46, 0x8A, 0xA4, 0x71, 0x63, 0x69, 0x26, 0x9A, 0xE8, 0xC2, 0x63, 0x69, 0xA5, 0x71, 0xC5, 0x71,
+    0x09, 0xA3, 0xC8, 0xCA, 0x44, 0x61, 0x43, 0x61, 0x84, 0x71, 0x23, 0x61, 0x4A, 0xCB, 0x83, 0x61, 0xC4, 0x69, 0x84, 0x69, 0xE5, 0x79, 0x2C, 0xE4, 0x88, 0x9B, 0x05, 0x7A, 0x66, 0x7A, 0xC7, 0x9A, 0x89, 0xA3, 0xD7, 0xFF, 0x6B, 0xD4, 0x27, 0x93, 0x08, 0x93, 0x4A, 0xB4, 0x91, 0xFE, 0x8D, 0xDD, 0xC6, 0x8A, 0xC7, 0x8A, 0x26, 0x93, 0x12, 0xFF, 0xB1, 0xF6, 0xA7, 0x82, 0x0C, 0xC5, 0xFF, 0xFF,
+    0x72, 0xFE, 0x0E, 0xD5, 0x67, 0x8A, 0xF2, 0xED, 0x2C, 0xBC, 0x05, 0x72, 0x26, 0x7A, 0xE5, 0x71, 0x08, 0xA3, 0x66, 0x82, 0x46, 0x72, 0x05, 0x92, 0xA4, 0x61, 0xC7, 0x9A, 0xC5, 0x69, 0x63, 0x59, 0x83, 0x61, 0x08, 0x93, 0x26, 0x72, 0xC5, 0x61, 0xC5, 0x61, 0xE3, 0x61, 0x2B, 0xDD, 0xC5, 0x61, 0x46, 0x72, 0x05, 0x72, 0x69, 0xBC, 0xE5, 0x71, 0xA4, 0x69, 0xC5, 0x71, 0x06, 0x72, 0x05, 0x72,
+    0x03, 0x59, 0x23, 0x61, 0x23, 0x59, 0x28, 0xDB, 0x23, 0x69, 0x43, 0x71, 0x64, 0x71, 0x64, 0x69, 0x69, 0xD3, 0x45, 0x92, 0x45, 0x8A, 0x84, 0x79, 0x43, 0x61, 0x09, 0xCB, 0x64, 0x71, 0xE5, 0x71, 0xEC, 0xB3, 0x26, 0x92, 0xC9, 0xC2, 0x64, 0x69, 0x64, 0x69, 0x43, 0x71, 0x84, 0x71, 0x29, 0xB3, 0xC5, 0x79, 0xA5, 0x69, 0x84, 0x69, 0x25, 0x7A, 0x4D, 0xCC, 0xE5, 0x71, 0xA6, 0x8A, 0x66, 0x82,
+    0xE6, 0x92, 0xC8, 0xBB, 0xFF, 0xFF, 0x6D, 0xDD, 0xC8, 0x92, 0x48, 0x9B, 0xFF, 0xFF, 0x12, 0xFF, 0xA7, 0x8A, 0xC7, 0x92, 0xE7, 0x9A, 0xB6, 0xFF, 0xAC, 0xCC, 0xE7, 0x92, 0x6F, 0xDD, 0x4B, 0xC4, 0xD7, 0xFF, 0xCA, 0xB3, 0x66, 0x7A, 0xAE, 0xCC, 0x87, 0x8A, 0x66, 0x9A, 0xC3, 0x71, 0xE8, 0x92, 0xA5, 0x69, 0x4D, 0xAC, 0x05, 0x72, 0xC3, 0x81, 0xC8, 0x9A, 0x05, 0x72, 0x83, 0x59, 0xA4, 0x61,
+    0xF2, 0xFD, 0x83, 0x69, 0x05, 0x6A, 0x86, 0x72, 0xFC, 0xFF, 0xCC, 0xEC, 0xC4, 0x71, 0xE4, 0x69, 0x4A, 0xBD, 0xD7, 0xFF, 0x67, 0xBB, 0xC5, 0x71, 0x05, 0x72, 0x85, 0x7A, 0xFF, 0xFF, 0x86, 0x8A, 0x87, 0x9A, 0x43, 0x61, 0x03, 0x59, 0xA4, 0x81, 0xA4, 0x81, 0xFF, 0xFF, 0xC4, 0x81, 0x26, 0x92, 0x8D, 0xDC, 0xE7, 0xAA, 0xFF, 0xFF, 0x87, 0xA2, 0xE5, 0x81, 0x43, 0x69, 0x47, 0x9A, 0x26, 0x8A,
+    0x2C, 0xBC, 0x43, 0x61, 0xE5, 0x91, 0x23, 0x71, 0x84, 0x69, 0xC6, 0x79, 0x06, 0x9A, 0x42, 0x69, 0x84, 0x69, 0xC5, 0x79, 0x67, 0x9A, 0x45, 0x92, 0x0B, 0xDC, 0xE5, 0x79, 0x08, 0xA3, 0x04, 0x7A, 0x68, 0xAB, 0x13, 0xF7, 0xFF, 0xFF, 0x8B, 0xC4, 0xE8, 0x92, 0x10, 0xF6, 0xF7, 0xFF, 0x50, 0xFE, 0xE8, 0x92, 0xA7, 0x92, 0xEA, 0xCB, 0x54, 0xFF, 0xB6, 0xFF, 0xA6, 0x8A, 0x4B, 0xBC, 0x6B, 0xD4,
+    0x54, 0xFF, 0x28, 0xAB, 0xE5, 0x79, 0x48, 0x9B, 0x28, 0xA3, 0x0A, 0xD4, 0xE5, 0x71, 0x67, 0x8A, 0x05, 0x7A, 0x2D, 0xB4, 0x8A, 0xCB, 0x86, 0x9A, 0xA4, 0x69, 0x84, 0x61, 0xA4, 0x61, 0x48, 0xC3, 0x83, 0x61, 0xA6, 0x7A, 0x84, 0x72, 0xFF, 0xFF, 0x09, 0xD4, 0x23, 0x6A, 0xE4, 0x69, 0xF8, 0xFF, 0xCB, 0xC4, 0x88, 0xCB, 0xE4, 0x71, 0xE4, 0x71, 0x25, 0x93, 0xC6, 0x8A, 0x68, 0xB3, 0x45, 0x82,
+    0x83, 0x71, 0xFE, 0xFF, 0x64, 0x69, 0x64, 0x71, 0x63, 0x71, 0x25, 0x92, 0x86, 0xA2, 0xFF, 0xFF, 0xCA, 0xC3, 0xCA, 0xC3, 0x66, 0xA2, 0x08, 0xC3, 0x25, 0x92, 0x63, 0x71, 0x88, 0x92, 0xC4, 0x91, 0xC8, 0x9A, 0x43, 0x69, 0x64, 0x69, 0x07, 0xA2, 0x84, 0x79, 0x64, 0x69, 0xC5, 0x79, 0xCD, 0xE3, 0x29, 0xCB, 0x87, 0x9A, 0xC4, 0x71, 0x45, 0x8A, 0x71, 0xE5, 0x6F, 0xF5, 0x04, 0x7A, 0x49, 0xAB,
+    0xC6, 0x9A, 0xFF, 0xFF, 0x6A, 0xD4, 0x89, 0xAB, 0xE8, 0x9A, 0xAC, 0xDC, 0xFF, 0xFF, 0x8A, 0xD4, 0xA7, 0x92, 0xC7, 0x92, 0xAF, 0xFD, 0xFF, 0xFF, 0x30, 0xFE, 0xE7, 0x9A, 0xA9, 0xB3, 0xFB, 0xFF, 0xAF, 0xED, 0xE7, 0xA2, 0xC8, 0x9A, 0xC7, 0x8A, 0x29, 0xD4, 0x46, 0x82, 0x87, 0x92, 0xE5, 0x69, 0xA5, 0x71, 0xFE, 0xFF, 0x87, 0x92, 0x83, 0x69, 0xC4, 0x69, 0xA4, 0x61, 0x8A, 0xC3, 0x83, 0x61,
+    0xA4, 0x61, 0x28, 0x93, 0xAC, 0xCC, 0x88, 0x9B, 0x05, 0x72, 0x45, 0x7A, 0x24, 0x72, 0x70, 0xE6, 0x66, 0x82, 0xE4, 0x71, 0xE5, 0x71, 0x25, 0x7A, 0x2A, 0xCC, 0x25, 0x7A, 0x65, 0x82, 0x45, 0x82, 0x23, 0x61, 0xA4, 0x71, 0x64, 0x71, 0x43, 0x69, 0x23, 0x69, 0x64, 0x71, 0xC4, 0x81, 0x06, 0xAB, 0x8A, 0xC3, 0xA6, 0xA2, 0xA4, 0x81, 0x46, 0xAA, 0x64, 0x9A, 0x64, 0x79, 0xE8, 0x9A, 0x46, 0x92,
+    0x87, 0xC2, 0x63, 0x79, 0x84, 0x71, 0x84, 0x71, 0x23, 0x91, 0x22, 0x71, 0x43, 0x61, 0x23, 0x79, 0x64, 0x79, 0x4A, 0xC3, 0xA4, 0x71, 0x45, 0x8A, 0x66, 0x8A, 0x2B, 0xDC, 0x86, 0x9A, 0xA7, 0x9A, 0x45, 0x92, 0xFB, 0xFF, 0xAE, 0xED, 0xCA, 0xBB, 0xE7, 0x9A, 0x68, 0xBB, 0xFF, 0xFF, 0xEF, 0xED, 0x86, 0x92, 0xC7, 0x9A, 0xF9, 0xFF, 0xFE, 0xFF, 0x51, 0xFE, 0xE8, 0x9A, 0x89, 0xBB, 0xFF, 0xFF,
+    0x07, 0xAB, 0x2B, 0xC4, 0xA7, 0x92, 0xC6, 0x92, 0xE7, 0xAA, 0x04, 0x7A, 0x62, 0x69, 0xE4, 0x71, 0x8D, 0xED, 0xE8, 0x9A, 0xE4, 0x71, 0xA3, 0x69, 0xA4, 0x69, 0xA6, 0x9A, 0xA4, 0x61, 0xA4, 0x61, 0xA4, 0x61, 0x25, 0x82, 0xE4, 0x71, 0xE4, 0x71, 0x04, 0x72, 0x86, 0x82, 0x04, 0x7A, 0xC3, 0x69, 0x25, 0x7A, 0xE4, 0x71, 0x25, 0x7A, 0xE4, 0x79, 0x05, 0x7A, 0x25, 0x7A, 0x25, 0x7A, 0x25, 0x7A,
+    0x03, 0x61, 0x27, 0xC2, 0x02, 0x61, 0x43, 0x71, 0x44, 0x71, 0x23, 0x71, 0xE9, 0xEA, 0xA4, 0x91, 0xA8, 0xB2, 0x05, 0x9A, 0x64, 0x79, 0x05, 0xB2, 0x8E, 0xF4, 0x4A, 0xD3, 0xA8, 0xA2, 0x09, 0xA3, 0x87, 0xA2, 0xC8, 0xD2, 0xA5, 0x89, 0x26, 0x8A, 0x64, 0x71, 0x0A, 0xCB, 0xEA, 0xE2, 0x63, 0x69, 0xA4, 0x71, 0x03, 0x79, 0xA4, 0x79, 0x46, 0xAA, 0x8E, 0xDC, 0xE5, 0x89, 0x4B, 0xDC, 0x05, 0x8A,
+    0x04, 0x8A, 0x52, 0xFE, 0xFF, 0xFF, 0x4C, 0xD4, 0xA7, 0x9A, 0xE7, 0xA2, 0xFF, 0xFF, 0xD5, 0xFF, 0xA7, 0x92, 0xC7, 0x9A, 0xCD, 0xE4, 0xE7, 0xA2, 0x6B, 0xD4, 0x66, 0x92, 0xA6, 0x9A, 0xEC, 0xEC, 0xC7, 0xA2, 0xA7, 0x9A, 0xE5, 0x71, 0x69, 0xBB, 0x66, 0x92, 0x26, 0x8A, 0x26, 0x7A, 0x66, 0x82, 0x84, 0x71, 0x65, 0x82, 0xC4, 0x69, 0xA5, 0x71, 0x04, 0x8A, 0xA3, 0x69, 0x84, 0x61, 0x83, 0x69,
+    0x6E, 0xCD, 0x05, 0x7A, 0x24, 0x7A, 0x24, 0x72, 0xC8, 0xBB, 0xC9, 0xBB, 0xE4, 0x79, 0x65, 0x82, 0xE7, 0xA3, 0xA4, 0x8A, 0x52, 0xFF, 0x25, 0x7A, 0x05, 0x7A, 0xA6, 0x92, 0x85, 0x8A, 0xA5, 0x92, 0x03, 0x61, 0x03, 0x61, 0x03, 0x61, 0x6A, 0xEB, 0x43, 0x81, 0xC3, 0x91, 0x64, 0x81, 0x63, 0x79, 0x49, 0xE3, 0x46, 0xA2, 0x05, 0xB2, 0x23, 0x79, 0x63, 0x81, 0x4A, 0xE3, 0x8B, 0xCB, 0x46, 0x92,
+    0x28, 0xB3, 0x23, 0x89, 0xEA, 0xE2, 0xA5, 0x89, 0x64, 0x79, 0x43, 0x71, 0x27, 0xB2, 0x67, 0xBA, 0xC5, 0x79, 0xC5, 0x81, 0x4C, 0xFC, 0x46, 0xA2, 0x71, 0xFD, 0xA4, 0x81, 0xF9, 0xFF, 0x46, 0x92, 0x25, 0x9A, 0x07, 0xBB, 0xFF, 0xFF, 0xCA, 0xCB, 0xC8, 0xA2, 0xE7, 0xAA, 0xFF, 0xFF, 0xB5, 0xFE, 0x52, 0xFE, 0x67, 0x92, 0x32, 0xEE, 0x2E, 0xED, 0x48, 0xBB, 0xA8, 0xAA, 0x09, 0xCB, 0x25, 0x9A,
+    0xAD, 0xEC, 0x26, 0xA2, 0x88, 0xB2, 0xA8, 0xBA, 0x25, 0x92, 0x97, 0xFF, 0x66, 0x92, 0xE5, 0x91, 0xE5, 0x91, 0x45, 0x8A, 0x08, 0xBB, 0xB4, 0xFF, 0x06, 0x82, 0xA3, 0x69, 0x84, 0x69, 0x06, 0xBB, 0xE8, 0xD2, 0xE4, 0x79, 0x45, 0x82, 0xFF, 0xFF, 0xAB, 0xBC, 0x69, 0xDB, 0x04, 0x7A, 0x29, 0xCC, 0xF9, 0xFF, 0xAB, 0xCC, 0x68, 0xCB, 0x66, 0xA2, 0x85, 0x92, 0x49, 0xBC, 0x65, 0x8A, 0x2B, 0xD4,
+    0x08, 0xCB, 0x42, 0x71, 0x03, 0x69, 0x23, 0x71, 0x43, 0x81, 0xFF, 0xFF, 0x05, 0xA2, 0xC4, 0xA1, 0x09, 0xC3, 0x0C, 0xEC, 0xFF, 0xFF, 0xC5, 0x99, 0x05, 0x9A, 0x43, 0x79, 0xE8, 0xD2, 0x6A, 0xEB, 0xAA, 0xCB, 0x26, 0x9A, 0xC5, 0x89, 0xFE, 0xFF, 0x26, 0xA2, 0x44, 0x79, 0xA5, 0x89, 0xC5, 0xA9, 0xA5, 0x89, 0x84, 0x71, 0xC5, 0x79, 0x06, 0x9A, 0x0C, 0xFC, 0xE5, 0x89, 0x05, 0x8A, 0xE4, 0x89,
+    0xAE, 0xE4, 0xD3, 0xF6, 0x6A, 0xD3, 0xCC, 0xE3, 0xA8, 0xAA, 0x07, 0xC3, 0x33, 0xFF, 0x71, 0xFD, 0x67, 0x92, 0x67, 0x92, 0xCB, 0xE3, 0x14, 0xEF, 0x48, 0xCB, 0xC8, 0xAA, 0x2A, 0xDB, 0xCE, 0xE4, 0x76, 0xFF, 0x49, 0xBB, 0x4A, 0xD3, 0x09, 0xBB, 0x46, 0xAA, 0xEE, 0xFC, 0xE4, 0x91, 0xC5, 0x99, 0xE4, 0x91, 0x23, 0x9A, 0x4C, 0xF4, 0xA4, 0x71, 0xC4, 0x71, 0x83, 0x69, 0x85, 0xA2, 0x89, 0xDB,
+    0xA3, 0x69, 0x25, 0x82, 0x85, 0x92, 0xE5, 0xA2, 0xCA, 0xEB, 0x86, 0x8A, 0x44, 0x8A, 0x2A, 0xB4, 0xAB, 0xD4, 0xA9, 0xE3, 0x05, 0x7A, 0x65, 0x82, 0x23, 0x7A, 0xEF, 0xFD, 0x48, 0xCB, 0x45, 0x8A, 0x23, 0x71, 0xFC, 0xFF, 0xA7, 0xB2, 0x23, 0x71, 0xC2, 0x70, 0x63, 0x91, 0x05, 0xAA, 0xFF, 0xFF, 0x89, 0xEB, 0xEF, 0xFC, 0xE5, 0xA9, 0xFF, 0xFF, 0x2B, 0xDC, 0x43, 0x81, 0x68, 0xA2, 0x29, 0xCB,
+    0xFF, 0xFF, 0x8B, 0xD3, 0x85, 0x81, 0xA5, 0x91, 0xF3, 0xFE, 0x85, 0x89, 0x23, 0x79, 0x02, 0x79, 0xCD, 0xF3, 0x64, 0x81, 0xA5, 0x79, 0x26, 0x9A, 0xEC, 0xCB, 0x63, 0x91, 0xC5, 0x91, 0x26, 0x9A, 0x26, 0xAA, 0xFD, 0xFF, 0x8D, 0xFC, 0x6A, 0xCB, 0x25, 0x92, 0x86, 0xB2, 0xFF, 0xFF, 0x2F, 0xFD, 0x67, 0x92, 0x87, 0x9A, 0x4C, 0xE4, 0xFE, 0xFF, 0x90, 0xFD, 0x4A, 0xC3, 0x69, 0xCB, 0xDF, 0xFF,
+    0xCE, 0xFC, 0xA7, 0xB2, 0x09, 0xCB, 0xC4, 0x91, 0xFF, 0xFF, 0x4D, 0xDC, 0x66, 0xA2, 0x05, 0x9A, 0x28, 0xCB, 0xFF, 0xFF, 0x26, 0x82, 0xE5, 0x79, 0xE4, 0x79, 0xEB, 0xDB, 0x42, 0x79, 0x84, 0x69, 0xA4, 0x71, 0x66, 0x92, 0x11, 0xF6, 0xC4, 0x79, 0x45, 0x8A, 0x24, 0x82, 0x05, 0x82, 0x23, 0xA2, 0x04, 0x82, 0x45, 0x8A, 0xE4, 0x81, 0xA6, 0x92, 0x88, 0xD3, 0x25, 0x8A, 0x46, 0x8A, 0x25, 0x8A,
+    0xE2, 0x60, 0x23, 0x69, 0x24, 0x71, 0x43, 0x79, 0x65, 0x81, 0x23, 0x79, 0x23, 0x81, 0x84, 0x89, 0x06, 0xB2, 0x06, 0xAA, 0x44, 0x89, 0x64, 0x91, 0xA7, 0xCA, 0x48, 0xC2, 0x06, 0x9A, 0x09, 0xCB, 0xA8, 0xBA, 0xA8, 0xCA, 0x85, 0x99, 0x06, 0xA2, 0xE5, 0x99, 0xA9, 0xDA, 0x64, 0x89, 0x43, 0x81, 0xC6, 0x91, 0x6B, 0xE3, 0xA5, 0x91, 0x25, 0x9A, 0x29, 0xC3, 0x84, 0x91, 0x05, 0xB2, 0x67, 0xA2,
+    0x09, 0xC3, 0x49, 0xDB, 0xFF, 0xFF, 0xC8, 0xBA, 0x05, 0x92, 0x86, 0xB2, 0xFF, 0xFF, 0x2F, 0xFD, 0x27, 0x92, 0x67, 0x9A, 0x49, 0xCB, 0xAB, 0xE3, 0xAA, 0xDB, 0x66, 0x9A, 0xEB, 0xD3, 0xFF, 0xFF, 0xAD, 0xDC, 0x46, 0xAA, 0xA4, 0x81, 0x4D, 0xEC, 0xA5, 0x99, 0xC8, 0xCA, 0x08, 0xC3, 0xC4, 0x91, 0xFF, 0xFF, 0x6E, 0xF4, 0xA3, 0x79, 0x05, 0x8A, 0x0A, 0xDC, 0xC4, 0x89, 0xE4, 0x89, 0x83, 0x79,
+    0x64, 0x9A, 0x0A, 0xDC, 0xA6, 0xA2, 0x45, 0x8A, 0xC6, 0xAA, 0x0D, 0xEE, 0x25, 0x92, 0x45, 0x8A, 0x05, 0x9B, 0xA5, 0x9A, 0x6D, 0xFD, 0x05, 0x8A, 0xE4, 0x81, 0x45, 0x92, 0xA6, 0x9A, 0xC8, 0xC3, 0xC2, 0x60, 0x07, 0xCA, 0xE3, 0x68, 0x23, 0x81, 0xE3, 0x70, 0x03, 0x79, 0xAA, 0xF2, 0x23, 0x89, 0x4A, 0xCB, 0x84, 0x91, 0x48, 0xC2, 0xA5, 0xA1, 0x03, 0x89, 0x44, 0x81, 0xC9, 0xDA, 0x88, 0xC2,
+    0xA8, 0xCA, 0xC4, 0xB9, 0xCA, 0xEA, 0x07, 0xDA, 0xC9, 0xDA, 0xC6, 0xA1, 0x27, 0xD2, 0x49, 0xE3, 0x06, 0x9A, 0x85, 0x99, 0xFF, 0xFF, 0x45, 0xB2, 0x08, 0xBB, 0xE6, 0xA1, 0xFE, 0xFF, 0xC5, 0x91, 0xC5, 0x99, 0x05, 0xAA, 0xFF, 0xFF, 0x0C, 0xE4, 0x05, 0x9A, 0x86, 0xB2, 0xFF, 0xFF, 0xAA, 0xE3, 0x47, 0x92, 0x47, 0x9A, 0x46, 0xB2, 0x25, 0x9A, 0x87, 0xB2, 0x46, 0x92, 0xC4, 0x91, 0x09, 0xB3,
+    0x0C, 0xD4, 0x46, 0x9A, 0x46, 0x92, 0xA4, 0x89, 0xE5, 0x91, 0x45, 0x9A, 0xC4, 0x81, 0xE9, 0xBA, 0x25, 0xA2, 0x49, 0xC3, 0x25, 0x92, 0xB9, 0xFF, 0xC3, 0x91, 0x63, 0x71, 0x05, 0x8A, 0xA6, 0xCA, 0x18, 0xF7, 0x45, 0x9A, 0xA5, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xCC, 0xEA, 0xD3, 0x08, 0xD4, 0xFF, 0xFF, 0xA7, 0xC3, 0x4C, 0xDC, 0x25, 0x92, 0x45, 0x9A, 0xFD, 0xFF, 0xA7, 0xB3, 0x45, 0x92,
+    0xE2, 0x68, 0x03, 0x81, 0x03, 0x71, 0xE9, 0xF2, 0xC2, 0x88, 0x65, 0xB9, 0x24, 0x91, 0xE3, 0x88, 0x0A, 0xEB, 0xC4, 0xB1, 0x06, 0xD2, 0x44, 0x91, 0xC9, 0xEA, 0xCC, 0xFB, 0xEA, 0xE2, 0xC9, 0xD2, 0x4B, 0xEB, 0x88, 0xDA, 0x6B, 0xF3, 0xA8, 0xEA, 0xFE, 0xFF, 0x85, 0x99, 0xF1, 0xFC, 0xCB, 0xF2, 0xC5, 0x99, 0xE3, 0x80, 0x44, 0x89, 0x27, 0xC2, 0x09, 0xCB, 0x85, 0x89, 0xC8, 0xBA, 0xC6, 0x99,
+    0x27, 0xB2, 0x50, 0xED, 0xCC, 0xEB, 0x67, 0xB2, 0xC5, 0x91, 0x88, 0xC2, 0x0E, 0xED, 0x67, 0xB2, 0x06, 0x92, 0x27, 0x92, 0xA8, 0xC2, 0xEF, 0xF4, 0x67, 0xB2, 0x26, 0x9A, 0x25, 0xAA, 0x29, 0xC3, 0xAE, 0xF4, 0x47, 0xAA, 0x87, 0xBA, 0x06, 0x9A, 0x26, 0xA2, 0x2C, 0xE4, 0x87, 0xB2, 0xA5, 0x89, 0xC7, 0xB2, 0x46, 0xA2, 0xAD, 0xFC, 0xC8, 0xC2, 0x04, 0x8A, 0xC5, 0x81, 0xA7, 0xAA, 0xC4, 0x89,
+    0x6A, 0xEB, 0x05, 0x8A, 0xA6, 0xA2, 0x65, 0xA2, 0x28, 0xB3, 0x29, 0xE3, 0x65, 0xA2, 0xA9, 0xBB, 0x45, 0x92, 0x86, 0x9A, 0x4D, 0xF4, 0x25, 0x9A, 0xAA, 0xB3, 0x05, 0x92, 0x45, 0x92, 0xE4, 0x99, 0xE5, 0xB1, 0x58, 0xFF, 0x04, 0x81, 0x03, 0x81, 0x24, 0x91, 0xFF, 0xFF, 0x45, 0xBA, 0xFE, 0xFF, 0xED, 0xFB, 0x89, 0xDA, 0xFF, 0xFF, 0x4B, 0xFB, 0x43, 0xA9, 0x24, 0x99, 0x91, 0xFD, 0xFD, 0xFF,
+    0xEC, 0xF3, 0xEA, 0xF2, 0xA6, 0xB9, 0xFF, 0xFF, 0x89, 0xEA, 0xC7, 0xC1, 0xA5, 0xA9, 0x27, 0xB2, 0x0B, 0xF3, 0x48, 0xBA, 0xA6, 0x91, 0xC5, 0xB1, 0x4F, 0xFC, 0x43, 0x99, 0xE9, 0xC2, 0xC6, 0xA1, 0x84, 0xA9, 0xB7, 0xFF, 0x4A, 0xEB, 0x47, 0xB2, 0xC9, 0xBA, 0x4B, 0xEB, 0x52, 0xF6, 0xE8, 0xDA, 0x06, 0x92, 0x47, 0x9A, 0x6B, 0xF3, 0xFD, 0xFF, 0x88, 0xBA, 0x06, 0x92, 0xC5, 0xA1, 0xFC, 0xFF,
+    0xEE, 0xF4, 0x06, 0xAA, 0x06, 0x92, 0xE5, 0xA9, 0x10, 0xE6, 0xE8, 0xDA, 0xA4, 0x91, 0xC5, 0x91, 0x86, 0xC2, 0xCE, 0xDD, 0xC7, 0xC2, 0xA4, 0x91, 0xA7, 0xAA, 0xC7, 0xB2, 0xCC, 0xFC, 0xE8, 0xD2, 0x87, 0xA2, 0xA3, 0x81, 0xA6, 0xA2, 0x4A, 0xF4, 0xC7, 0xCA, 0xC4, 0x81, 0xE4, 0x91, 0xC4, 0x89, 0x6B, 0xF4, 0x86, 0xBA, 0xA3, 0x89, 0xC4, 0x89, 0x05, 0x92, 0xF3, 0xFE, 0x25, 0xAA, 0xC4, 0x99,
+    0x03, 0x79, 0xE3, 0x78, 0xE4, 0x78, 0x04, 0x89, 0x04, 0x81, 0xE3, 0x88, 0x03, 0x91, 0xA6, 0xB9, 0xEA, 0xEA, 0x47, 0xD2, 0x44, 0x99, 0x47, 0xD2, 0x07, 0xD2, 0x48, 0xE2, 0x27, 0xC2, 0xCD, 0xFB, 0xBC, 0xFF, 0x2C, 0xFB, 0xE6, 0xB9, 0x28, 0xE2, 0xFD, 0xFF, 0x28, 0xDA, 0x48, 0xCA, 0x67, 0xCA, 0x27, 0xCA, 0xB8, 0xFF, 0x27, 0xCA, 0x47, 0xCA, 0x27, 0xBA, 0xCE, 0xF4, 0xAC, 0xEB, 0x85, 0x99,
+    0xA6, 0xA9, 0xBE, 0xFF, 0xF0, 0xFC, 0x06, 0xB2, 0xC5, 0x99, 0xE8, 0xDA, 0xFF, 0xFF, 0xCB, 0xEB, 0xE6, 0x91, 0x06, 0x9A, 0xBD, 0xFF, 0xAB, 0xEB, 0x2A, 0xEB, 0x06, 0xA2, 0x0C, 0xDC, 0xFF, 0xFF, 0x8B, 0xEB, 0xC5, 0x99, 0xE5, 0x99, 0xD9, 0xFF, 0xFE, 0xFF, 0xCB, 0xEB, 0x47, 0xAA, 0x46, 0xC2, 0xFF, 0xFF, 0x48, 0xDB, 0xE5, 0xA1, 0x25, 0xAA, 0x68, 0xCB, 0x47, 0xD3, 0x67, 0xB2, 0xE5, 0x91,
+    0x46, 0xAA, 0xA6, 0xB2, 0x84, 0xC2, 0x25, 0xB2, 0xE4, 0x91, 0xE4, 0x91, 0xE4, 0x99, 0x2B, 0xF4, 0x04, 0x9A, 0xE5, 0x91, 0x46, 0xAA, 0xCA, 0xEB, 0x45, 0xBA, 0xE5, 0x91, 0xE5, 0x91, 0x05, 0x9A, 0xC2, 0x60, 0xC3, 0x80, 0xE3, 0x70, 0x25, 0xA1, 0xC3, 0x70, 0x03, 0x89, 0x03, 0x79, 0x44, 0xA1, 0xAD, 0xFB, 0xA5, 0xB1, 0xC8, 0xC1, 0x08, 0xEA, 0x23, 0xA1, 0xE4, 0x90, 0xAA, 0xF2, 0xC9, 0xEA,
+    0xAC, 0xFB, 0x65, 0xB1, 0x8A, 0xEA, 0x57, 0xF6, 0x06, 0xD2, 0x86, 0xA9, 0x4B, 0xEB, 0x13, 0xFE, 0xC6, 0xB1, 0xC7, 0xD1, 0xFF, 0xFF, 0xA8, 0xE2, 0xAD, 0xFB, 0x85, 0xB1, 0xFF, 0xFF, 0x85, 0xA1, 0x85, 0xA1, 0xA5, 0xB1, 0xFF, 0xFF, 0xC4, 0xA9, 0xE6, 0xA1, 0x8B, 0xEB, 0xFF, 0xFF, 0xC7, 0xDA, 0xC6, 0x91, 0xC6, 0x91, 0xB9, 0xFF, 0x27, 0xC2, 0xA9, 0xD2, 0xE6, 0xA1, 0x8C, 0xF4, 0x8A, 0xEB,
+    0x0A, 0xCB, 0x85, 0xA1, 0x84, 0xA1, 0xAB, 0xF3, 0x27, 0xB2, 0xE8, 0xD2, 0x0A, 0xCB, 0x49, 0xE3, 0xED, 0xF4, 0x2D, 0xFC, 0xEA, 0xEB, 0xFF, 0xFF, 0x8C, 0xF4, 0x8A, 0xE3, 0x05, 0xA2, 0x94, 0xFF, 0xFF, 0xFF, 0xC4, 0x91, 0xA7, 0xB2, 0x2E, 0xF6, 0xFF, 0xFF, 0xE4, 0xA1, 0x86, 0xC2, 0x65, 0xB2, 0xFF, 0xFF, 0xE6, 0xBA, 0xC4, 0x99, 0x83, 0x89, 0x05, 0x9A, 0xFF, 0xFF, 0xE5, 0xC2, 0xE7, 0xD2,
+    0xC3, 0x78, 0x82, 0x80, 0xE3, 0x78, 0xC3, 0x70, 0xC3, 0x78, 0x04, 0x89, 0xA6, 0xB1, 0x04, 0x91, 0x69, 0xCA, 0x07, 0xC2, 0xE3, 0x88, 0x25, 0x91, 0x28, 0xCA, 0x04, 0xA1, 0x48, 0xD2, 0x28, 0xD2, 0xAC, 0xFB, 0x45, 0xD1, 0x28, 0xCA, 0x28, 0xE2, 0xDD, 0xFF, 0x65, 0xA9, 0x4B, 0xF3, 0xD2, 0xFD, 0x89, 0xDA, 0x44, 0xA1, 0x85, 0xA9, 0x88, 0xDA, 0x6C, 0xF3, 0x65, 0x99, 0x27, 0xC2, 0x07, 0xC2,
+    0x65, 0x99, 0x85, 0xA1, 0x88, 0xCA, 0xA4, 0xB1, 0xE6, 0xA1, 0x4B, 0xE3, 0x88, 0xD2, 0xC5, 0xB1, 0xC6, 0x91, 0xE6, 0x91, 0x07, 0xBA, 0xE6, 0xA9, 0xC8, 0xD2, 0xE6, 0xA1, 0x08, 0xDB, 0xA5, 0x99, 0xC5, 0x99, 0x43, 0x91, 0xC5, 0xB9, 0x63, 0xA1, 0xA4, 0x91, 0xE5, 0xA9, 0x67, 0xBA, 0xA5, 0x99, 0x29, 0xE3, 0xC8, 0xDA, 0xA7, 0xCA, 0xC7, 0xD2, 0xA7, 0xC2, 0x67, 0xC2, 0xC4, 0xB1, 0x08, 0xCB,
+    0xC4, 0x99, 0x45, 0xAA, 0x05, 0xAA, 0x07, 0xCB, 0xE4, 0xA1, 0xA7, 0xB2, 0x8C, 0xF4, 0x2C, 0xBC, 0xE5, 0xA1, 0xC4, 0x99, 0x05, 0xA2, 0x48, 0xCB, 0xD9, 0xFF, 0x05, 0x9A, 0xE5, 0xA1, 0xE5, 0x99, 0x65, 0x99, 0xC3, 0x78, 0xA2, 0x70, 0x8A, 0xEA, 0xA6, 0xC1, 0xFD, 0xFF, 0x24, 0x99, 0x4C, 0xF3, 0x0A, 0xEB, 0x09, 0xE2, 0x71, 0xED, 0xA6, 0xB9, 0xEE, 0xF3, 0x0B, 0xEB, 0xC8, 0xE1, 0x7B, 0xFF,
+    0xBD, 0xFF, 0x11, 0xE5, 0x6D, 0xFB, 0x53, 0xEE, 0xE7, 0xD9, 0x04, 0xA1, 0x0C, 0xEB, 0xEC, 0xF2, 0x65, 0xA9, 0x66, 0xB9, 0x65, 0xA1, 0x8D, 0xFB, 0xE6, 0xB9, 0x24, 0x99, 0xC6, 0xB1, 0x04, 0x91, 0xA6, 0xA9, 0xD4, 0xFE, 0x48, 0xBA, 0xA5, 0xA9, 0x89, 0xCA, 0xC9, 0xD2, 0xD4, 0xFE, 0xC5, 0xC1, 0x86, 0x91, 0x48, 0xBA, 0xA6, 0xA1, 0x68, 0xC2, 0x07, 0xB2, 0x48, 0xB2, 0x4B, 0xE3, 0x85, 0x99,
+    0x0D, 0xF4, 0x64, 0xA1, 0x84, 0x99, 0x0A, 0xDB, 0xC5, 0xA9, 0x2D, 0xEC, 0xA4, 0x91, 0x84, 0x91, 0x67, 0xCA, 0x67, 0xC2, 0xC3, 0xA1, 0x26, 0xB2, 0x26, 0xAA, 0xE5, 0xA1, 0xA4, 0x91, 0xA4, 0x99, 0xE4, 0xB1, 0x83, 0x81, 0x67, 0xAA, 0x05, 0xA2, 0xA4, 0x91, 0x84, 0x99, 0x09, 0xC3, 0xA4, 0x91, 0xA4, 0x91, 0x63, 0x91, 0xA4, 0x91, 0xC5, 0x99, 0xC5, 0x99, 0xA4, 0x99, 0x05, 0xA2, 0xE5, 0xA1,
+    0xE3, 0x80, 0x8D, 0xFC, 0x08, 0xCA, 0x04, 0x89, 0xA3, 0x88, 0x04, 0xB9, 0x25, 0xB1, 0xFF, 0xFF, 0x69, 0xF2, 0xEB, 0xF2, 0x66, 0xC9, 0xFE, 0xFF, 0x30, 0xFD, 0xC4, 0xA8, 0xC7, 0xD9, 0xB8, 0xFE, 0xFF, 0xFF, 0xEB, 0xFA, 0x4A, 0xE2, 0x15, 0xED, 0xFF, 0xFF, 0x45, 0xC1, 0x07, 0xD2, 0xC8, 0xD9, 0x2C, 0xEB, 0x08, 0xDA, 0x66, 0xB1, 0xA6, 0xC9, 0x44, 0xA9, 0x70, 0xFC, 0xE7, 0xC1, 0x04, 0x91,
+    0xCA, 0xE2, 0xFE, 0xFF, 0x27, 0xD2, 0x44, 0xA1, 0x07, 0xAA, 0x69, 0xEA, 0x9A, 0xFF, 0xC6, 0xC9, 0x65, 0x91, 0x65, 0x99, 0xCB, 0xE3, 0xAF, 0xE4, 0xCA, 0xDA, 0xCA, 0xCA, 0x09, 0xE3, 0xFF, 0xFF, 0xA5, 0xA9, 0xA5, 0xA9, 0x67, 0xC2, 0xEB, 0xE3, 0xFC, 0xFF, 0x43, 0xA1, 0xE6, 0xB1, 0x85, 0xA9, 0x8A, 0xE3, 0x31, 0xF6, 0x88, 0xDA, 0xA4, 0xA1, 0xE5, 0xA9, 0x46, 0xC2, 0xAB, 0xEB, 0x07, 0xC2,
+    0xA4, 0xA1, 0xE5, 0xA1, 0x67, 0xCA, 0x89, 0xE3, 0xC5, 0xA9, 0x01, 0x89, 0xC5, 0xA9, 0x84, 0xA1, 0x0A, 0xDC, 0x63, 0x99, 0x0B, 0xE5, 0x05, 0xBA, 0xA5, 0x99, 0x49, 0xEB, 0x23, 0x99, 0xE8, 0xE2, 0xC3, 0x90, 0x8E, 0xC3, 0xA3, 0x70, 0x87, 0xF1, 0x62, 0x88, 0xC3, 0x90, 0xC4, 0x90, 0x6F, 0xFE, 0xEA, 0xFA, 0x04, 0xB1, 0x2A, 0xEA, 0xFD, 0xFF, 0xAB, 0xFA, 0xC3, 0x98, 0xE9, 0xE9, 0xFD, 0xFF,
+    0x2C, 0xFB, 0xE4, 0xB8, 0x8B, 0xEA, 0xFF, 0xFF, 0xC7, 0xE9, 0xE4, 0xA8, 0x4C, 0xEB, 0x32, 0xF5, 0xE8, 0xD1, 0x08, 0xE2, 0xFF, 0xFF, 0x6C, 0xF3, 0xAA, 0xF2, 0x45, 0xB9, 0xFF, 0xFF, 0x25, 0xA1, 0x24, 0xA1, 0xC7, 0xD9, 0xFF, 0xFF, 0x28, 0xCA, 0x49, 0xBA, 0xCA, 0xEA, 0xFF, 0xFF, 0x0A, 0xE3, 0x65, 0x91, 0x45, 0x91, 0xFF, 0xFF, 0x65, 0xB9, 0x4C, 0xF3, 0xE7, 0xA9, 0xDB, 0xFF, 0xFF, 0xFF,
+    0xA6, 0xA1, 0x0A, 0xEB, 0x6D, 0xF4, 0xD6, 0xF6, 0xC8, 0xEA, 0x64, 0xA1, 0x84, 0xB1, 0xF3, 0xFF, 0x7B, 0xFF, 0x4B, 0xF3, 0xA7, 0xDA, 0x96, 0xFF, 0xAD, 0xFC, 0x43, 0xA9, 0x26, 0xD2, 0x87, 0xE2, 0xBA, 0xFF, 0x8E, 0xFD, 0x44, 0x99, 0x26, 0xDA, 0xFF, 0xFF, 0xFC, 0xFF, 0xE5, 0xC1, 0xE5, 0xB9, 0xFE, 0xFF, 0xB6, 0xFF, 0x2D, 0xF5, 0x46, 0xCA, 0x68, 0xDA, 0x0F, 0xED, 0x64, 0xA1, 0x87, 0xE3,
+    0x83, 0x70, 0x83, 0x68, 0x83, 0x70, 0xA3, 0x78, 0xC4, 0x80, 0xC3, 0x88, 0xA3, 0x88, 0x45, 0xA1, 0x16, 0xF6, 0x25, 0xB9, 0x62, 0x88, 0x05, 0xB9, 0xAB, 0xFA, 0xC4, 0x98, 0xC4, 0xA8, 0x6C, 0xD3, 0x2D, 0xFB, 0x87, 0xE1, 0xC8, 0xE1, 0xC8, 0xE1, 0x06, 0xD9, 0xA8, 0xE1, 0x29, 0xEA, 0xAA, 0xF2, 0xA8, 0xE1, 0xC7, 0xC9, 0x25, 0xB1, 0x29, 0xE2, 0xC7, 0xD1, 0x25, 0xA9, 0x25, 0xA9, 0xA7, 0xC1,
+    0x24, 0xA1, 0xC8, 0xC1, 0xC7, 0xC9, 0x86, 0xB1, 0x28, 0xB2, 0x68, 0xDA, 0x08, 0xD2, 0x07, 0xD2, 0x25, 0x89, 0x24, 0x91, 0x08, 0xCA, 0x03, 0xA9, 0x48, 0xCA, 0x86, 0xB1, 0xC9, 0xDA, 0xA5, 0xB1, 0x85, 0x99, 0x2B, 0xF3, 0x8C, 0xF3, 0x09, 0xEB, 0xC6, 0xB1, 0xE6, 0xC1, 0xA5, 0xA1, 0x85, 0xA9, 0x43, 0xA9, 0x68, 0xD2, 0x68, 0xDA, 0x64, 0xB1, 0x84, 0xA9, 0xE1, 0xA0, 0x87, 0xDA, 0xC5, 0xC1,
+    0x84, 0xA9, 0x47, 0xC2, 0x84, 0xA9, 0xA4, 0xB9, 0x29, 0xE3, 0x46, 0xC2, 0x64, 0xD2, 0x25, 0xC2, 0x63, 0xB1, 0xA4, 0xA9, 0xA5, 0xA9, 0x05, 0xC2, 0x8B, 0xE4, 0xA5, 0xA1, 0x06, 0xC2, 0x25, 0xB2, 0x83, 0x68, 0x87, 0xB9, 0x62, 0x68, 0x62, 0x70, 0xA3, 0x78, 0xC4, 0x88, 0xC4, 0x88, 0xA3, 0x88, 0xC7, 0xB1, 0xE4, 0xA0, 0xA3, 0x98, 0xE4, 0x98, 0x09, 0xCA, 0xC4, 0x90, 0xA3, 0x98, 0x87, 0xC1,
+    0x29, 0xDA, 0xE5, 0xA8, 0xC8, 0xD1, 0xC4, 0xC0, 0xE5, 0xB0, 0xC4, 0xA0, 0x29, 0xDA, 0xC8, 0xC9, 0x05, 0xB1, 0xA3, 0x98, 0x05, 0xA1, 0x49, 0xD2, 0xE4, 0xA0, 0x05, 0xA9, 0x4A, 0xDA, 0xE4, 0x90, 0xE4, 0x98, 0x25, 0xA1, 0xE4, 0x98, 0x66, 0xB1, 0x65, 0xA1, 0xC7, 0xC1, 0xC7, 0xA9, 0x86, 0xB9, 0x05, 0x89, 0x25, 0x99, 0x04, 0x91, 0x65, 0xA9, 0x66, 0xA1, 0x04, 0x99, 0x44, 0xA9, 0xE4, 0x98,
+    0x87, 0xA9, 0xA6, 0xB9, 0x69, 0xD2, 0x27, 0xD2, 0x48, 0xD2, 0x03, 0x99, 0x85, 0xA9, 0x64, 0xB1, 0x24, 0xA1, 0x03, 0x99, 0x47, 0xCA, 0x24, 0x99, 0xE2, 0x90, 0x03, 0x99, 0x85, 0xA9, 0x64, 0xA1, 0x44, 0x99, 0x85, 0xA1, 0x44, 0x99, 0x03, 0x91, 0x26, 0xBA, 0x64, 0x91, 0x64, 0xA1, 0x64, 0x99, 0x64, 0x99, 0xC6, 0xA9, 0x64, 0x99, 0xA5, 0xA1, 0xA5, 0xA1, 0x85, 0x99, 0x84, 0xA1, 0xA5, 0xA1,
+    0x26, 0xB9, 0xA8, 0xD9, 0xC3, 0x90, 0x0A, 0xEA, 0xAB, 0xE2, 0xFF, 0xFF, 0x29, 0xF2, 0xFE, 0xFF, 0x46, 0xD1, 0xC4, 0xB8, 0xFF, 0xFF, 0xE6, 0xD8, 0x8A, 0xD2, 0x06, 0xC9, 0x6A, 0xEA, 0xB6, 0xFD, 0xCA, 0xF1, 0xEA, 0xE9, 0x2B, 0xF2, 0xFF, 0xFF, 0x27, 0xE1, 0x06, 0xB9, 0x8C, 0xEA, 0x6B, 0xEA, 0x88, 0xC9, 0xA4, 0xA0, 0xE4, 0xA8, 0x6B, 0xF2, 0x8B, 0xE2, 0xC4, 0x98, 0xC8, 0xC1, 0xC5, 0x90,
+    0x26, 0xA1, 0xC7, 0xC1, 0x25, 0xA1, 0x05, 0xB1, 0xC8, 0xB9, 0x66, 0xB1, 0x25, 0x99, 0x86, 0xC1, 0xE4, 0x80, 0x05, 0x91, 0x25, 0x89, 0x86, 0xA9, 0xC3, 0x88, 0xE3, 0x98, 0xC3, 0x90, 0xA7, 0xB9, 0x25, 0x91, 0x66, 0xB1, 0x44, 0xB1, 0xE8, 0xD9, 0x45, 0xB9, 0x65, 0xA1, 0x24, 0xA1, 0xE7, 0xD1, 0x65, 0xB9, 0x24, 0xA9, 0xC5, 0xB9, 0x24, 0x99, 0xC3, 0x90, 0x64, 0xA1, 0x44, 0xA1, 0x85, 0xA1,
+    0x85, 0xA1, 0x24, 0x89, 0x85, 0x99, 0x23, 0x91, 0x64, 0xA1, 0x44, 0x91, 0x64, 0xA1, 0x64, 0x99, 0xC6, 0xB1, 0x64, 0xA1, 0x64, 0x99, 0x85, 0xA9, 0xC6, 0xB1, 0x64, 0xA1, 0x85, 0xA1, 0x84, 0xA1, 0x63, 0x80, 0x5D, 0xFF, 0x63, 0x80, 0x49, 0xD9, 0x93, 0xFA, 0x64, 0xB0, 0x68, 0xD1, 0xFF, 0xF7, 0x95, 0xCD, 0xA5, 0xD0, 0x69, 0xE9, 0xFF, 0xFF, 0x10, 0xE3, 0xA9, 0xE9, 0xEB, 0xF1, 0xFF, 0xFF,
+    0xFC, 0xF6, 0x0B, 0xEA, 0x2B, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xEA, 0xEA, 0xE1, 0x19, 0xF7, 0x27, 0xD1, 0x9C, 0xFF, 0xFF, 0xFF, 0xF1, 0xFB, 0x47, 0xC1, 0x4E, 0xF3, 0xDF, 0xFF, 0x06, 0xB9, 0x88, 0xC9, 0x9D, 0xFF, 0xDF, 0xFF, 0x05, 0xC1, 0x66, 0xA1, 0xA8, 0xE1, 0xFF, 0xFF, 0x8B, 0xEA, 0xE5, 0x88, 0x66, 0xA1, 0xFF, 0xFF, 0x8B, 0xF2, 0xA3, 0x98, 0xC4, 0xA0, 0x31, 0xED, 0xFF, 0xFF,
+    0x49, 0xDA, 0xC8, 0xD1, 0x30, 0xF5, 0xDF, 0xFF, 0x9B, 0xFF, 0x11, 0xFD, 0x45, 0xD1, 0xDA, 0xFF, 0xFD, 0xFF, 0x70, 0xFD, 0x2C, 0xE4, 0xE5, 0xD1, 0xC7, 0xDA, 0x8B, 0xF3, 0x26, 0xD2, 0x6D, 0xF4, 0x85, 0xD9, 0x68, 0xDA, 0x25, 0xCA, 0x69, 0xE3, 0x08, 0xE2, 0xFC, 0xFF, 0xF5, 0xFF, 0x9B, 0xFF, 0xEA, 0xEB, 0x84, 0xC9, 0xE9, 0xE2, 0xFF, 0xFF, 0x84, 0xC9, 0xE8, 0xE2, 0x64, 0xA9, 0x27, 0xDA,
+    0x83, 0x60, 0x63, 0x60, 0x63, 0x60, 0x42, 0x70, 0x43, 0x68, 0x42, 0x70, 0x84, 0x78, 0xE5, 0x88, 0x84, 0x88, 0x64, 0x88, 0x63, 0x88, 0x84, 0x90, 0x06, 0xB1, 0xA5, 0x90, 0x84, 0x98, 0x06, 0xC1, 0xC9, 0xD9, 0xC6, 0xB8, 0x27, 0xC9, 0x07, 0xE1, 0x06, 0xC9, 0xA4, 0xA0, 0x88, 0xD9, 0xA9, 0xD9, 0xE6, 0xB8, 0xA4, 0xA0, 0xE5, 0xA8, 0xC9, 0xD9, 0xC5, 0xA0, 0x06, 0xB1, 0xE9, 0xE1, 0xC4, 0x90,
+    0xC5, 0xA8, 0xC4, 0xA8, 0xC4, 0xB0, 0xA4, 0xA0, 0xE4, 0x98, 0xE5, 0xB8, 0x05, 0xA1, 0x26, 0xB1, 0xE5, 0x88, 0x46, 0xB1, 0x26, 0xA9, 0xE9, 0xC9, 0xA3, 0x90, 0x46, 0xB9, 0x25, 0xC9, 0xE8, 0xD1, 0xA3, 0xA0, 0x49, 0xE2, 0xC3, 0xB0, 0xA7, 0xE1, 0x89, 0xEA, 0x08, 0xDA, 0x45, 0xC9, 0xEB, 0xF2, 0xE7, 0xE1, 0x45, 0xC1, 0x69, 0xF2, 0x28, 0xF2, 0x28, 0xEA, 0x65, 0xC1, 0x47, 0xEA, 0x27, 0xEA,
+    0x85, 0xC9, 0xC5, 0xC9, 0xE6, 0xD1, 0xA6, 0xD9, 0x27, 0xE2, 0xC9, 0xF2, 0x0B, 0xF5, 0x26, 0xDA, 0x26, 0xD2, 0x06, 0xD2, 0xC5, 0xD1, 0x39, 0xFF, 0xC5, 0xD1, 0x89, 0xDB, 0xC5, 0xC1, 0xE7, 0xD9, 0x63, 0x58, 0x63, 0x60, 0x63, 0x60, 0x23, 0x70, 0x64, 0x70, 0x42, 0x70, 0x63, 0x70, 0xC5, 0x88, 0x63, 0x80, 0x63, 0x80, 0x84, 0x88, 0x84, 0x80, 0x06, 0xA1, 0x84, 0x80, 0x64, 0x88, 0xE6, 0xA8,
+    0xC9, 0xC9, 0x26, 0xB1, 0xC5, 0xA8, 0x84, 0x98, 0x84, 0x98, 0xA4, 0x98, 0x06, 0xB1, 0x06, 0xA9, 0xA4, 0xA0, 0xC5, 0x98, 0xE6, 0xA8, 0x06, 0xA9, 0xA4, 0x98, 0xA4, 0x98, 0x26, 0xA9, 0xA4, 0x88, 0xC5, 0x98, 0x27, 0xB1, 0xA4, 0x98, 0xE5, 0xA8, 0x63, 0x88, 0x26, 0xB9, 0xC5, 0x90, 0x67, 0xC1, 0xC4, 0x80, 0x26, 0xA9, 0x05, 0x99, 0x26, 0xA9, 0xE4, 0x90, 0x46, 0xB1, 0x26, 0xA9, 0x87, 0xB9,
+    0xC4, 0x90, 0x45, 0xA9, 0xE4, 0xA0, 0x05, 0xA9, 0xA7, 0xC9, 0x25, 0xA9, 0xE4, 0xA8, 0xA7, 0xC9, 0xC3, 0x98, 0xE3, 0x98, 0xA2, 0x98, 0x82, 0x98, 0x66, 0xB1, 0x04, 0xA9, 0x45, 0xB1, 0x04, 0xA9, 0x86, 0xB1, 0xA3, 0x88, 0x04, 0x99, 0xE3, 0x98, 0x24, 0xA9, 0x03, 0xA1, 0x24, 0xA1, 0x24, 0xA9, 0x86, 0xB9, 0x04, 0xA1, 0x24, 0xA9, 0x24, 0xA1, 0x24, 0xA1, 0x44, 0xA1, 0x45, 0xA1, 0x45, 0xA1,
+    0x63, 0x60, 0x84, 0x68, 0x43, 0x68, 0x84, 0x80, 0xA5, 0x88, 0x84, 0x98, 0x44, 0x80, 0x85, 0x98, 0x63, 0x88, 0xA5, 0x98, 0x84, 0xA0, 0x64, 0x88, 0x27, 0xB9, 0x84, 0x88, 0x23, 0x88, 0xC6, 0xB0, 0x89, 0xD1, 0xA5, 0xA0, 0x85, 0xA0, 0x85, 0xA8, 0xC6, 0xC0, 0xA5, 0xA0, 0x07, 0xB9, 0x06, 0xB1, 0xA5, 0xA8, 0x84, 0x90, 0x63, 0x90, 0xC5, 0xA0, 0x64, 0x98, 0xA4, 0x90, 0xA5, 0x90, 0xA4, 0x88,
+    0xA4, 0x90, 0x06, 0xA9, 0x84, 0x98, 0xC5, 0xA0, 0xA4, 0x88, 0xC5, 0xA8, 0xA4, 0x88, 0xE5, 0xA0, 0xC4, 0x80, 0xC5, 0xA0, 0xA4, 0x90, 0xE5, 0xA0, 0xE5, 0x88, 0x47, 0xB1, 0x05, 0xA9, 0xC8, 0xC1, 0xC4, 0x98, 0x46, 0xB1, 0x25, 0xA9, 0x63, 0x90, 0x87, 0xC9, 0xA4, 0x90, 0x05, 0xA9, 0x66, 0xB9, 0xE4, 0xA0, 0x66, 0xC1, 0xC3, 0x98, 0x05, 0xA9, 0x25, 0xA9, 0xC3, 0xA0, 0x66, 0xB9, 0xE4, 0xA0,
+    0x24, 0xA9, 0xA3, 0x88, 0xA3, 0x90, 0x25, 0xA1, 0x05, 0xA1, 0x04, 0xA1, 0xE4, 0x98, 0x25, 0xA9, 0x04, 0xA1, 0x04, 0xA1, 0x04, 0xA1, 0x04, 0xA1, 0x24, 0xA1, 0x24, 0xA1, 0x45, 0xA1, 0x45, 0xA1, 0x84, 0x90, 0x48, 0xD1, 0x89, 0xD1, 0x64, 0x98, 0x4C, 0xEA, 0xDD, 0xFF, 0xAA, 0xE9, 0x2C, 0xF2, 0x84, 0xA8, 0x23, 0xA0, 0xB6, 0xED, 0xF8, 0xFD, 0xAA, 0xD9, 0x0C, 0xEA, 0x69, 0xE9, 0xCD, 0xE1,
+    0xA9, 0xC9, 0x0D, 0xE3, 0xEC, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0xE9, 0xCB, 0xE9, 0xEC, 0xE9, 0xC7, 0xC8, 0x6C, 0xF2, 0xFF, 0xFF, 0x4C, 0xF2, 0xCB, 0xE9, 0x8D, 0xF2, 0x9E, 0xFF, 0x07, 0xC1, 0x28, 0xC9, 0xEF, 0xE2, 0x79, 0xEE, 0xAA, 0xF1, 0xA4, 0x90, 0x48, 0xE1, 0x5A, 0xFF, 0xA9, 0xD9, 0xA4, 0x80, 0x07, 0xC9, 0xDC, 0xFF, 0x88, 0xE9, 0xE5, 0x90, 0x2A, 0xEA, 0x2C, 0xD3, 0x4E, 0xDB,
+    0x47, 0xD1, 0x05, 0xB9, 0xBC, 0xFF, 0xA6, 0xD1, 0x4A, 0xF2, 0xC4, 0x98, 0x86, 0xD9, 0x67, 0xE1, 0x87, 0xE9, 0x49, 0xEA, 0xC4, 0xC0, 0xE8, 0xF1, 0x83, 0xA8, 0x25, 0xB1, 0x06, 0xC1, 0x66, 0xC9, 0x04, 0xB9, 0x04, 0xA1, 0xC3, 0x98, 0xE4, 0xA8, 0x66, 0xB9, 0x66, 0xC1, 0xE4, 0x98, 0x65, 0xB9, 0xE4, 0xA0, 0x04, 0xA1, 0x25, 0xB1, 0x24, 0xB1, 0x04, 0xA9, 0x24, 0xA1, 0x45, 0xA1, 0x44, 0xA9,
+    0x43, 0x58, 0x64, 0x60, 0x84, 0x68, 0x28, 0x99, 0x64, 0x78, 0xE6, 0x98, 0x44, 0x78, 0x64, 0x80, 0x02, 0x78, 0x64, 0x88, 0xC6, 0xA0, 0x64, 0x78, 0x44, 0x90, 0x65, 0x78, 0x44, 0x90, 0xE7, 0xA8, 0xE7, 0xB0, 0x44, 0x90, 0x65, 0x98, 0x24, 0x90, 0x85, 0xA0, 0x86, 0xA0, 0xC6, 0xA8, 0x07, 0xB1, 0x65, 0x98, 0xC6, 0xA0, 0x64, 0x98, 0x44, 0x88, 0x85, 0x98, 0x64, 0x90, 0x44, 0x90, 0xA6, 0x88,
+    0xA5, 0x98, 0xC6, 0xB0, 0x85, 0xA0, 0xA5, 0x98, 0x44, 0x90, 0xA5, 0xA8, 0xA5, 0x90, 0x64, 0xA8, 0x84, 0x80, 0x43, 0x98, 0xE6, 0xC0, 0xC5, 0xD0, 0xA4, 0x88, 0xE6, 0xA8, 0x27, 0xD1, 0x65, 0xC8, 0xD0, 0xFD, 0xA4, 0xA0, 0xE5, 0xB8, 0xC4, 0xC0, 0x46, 0xD1, 0x0C, 0xEB, 0x06, 0xD9, 0xA4, 0xD0, 0x88, 0xCA, 0x4B, 0xE3, 0x8A, 0xE2, 0x06, 0xCA, 0x28, 0xDA, 0x48, 0xEA, 0x49, 0xEA, 0xC9, 0xD2,
+    0xA6, 0xD1, 0x66, 0xC1, 0xEB, 0xF2, 0x62, 0xB0, 0xCF, 0xFC, 0x0A, 0xE3, 0x8C, 0xE4, 0x07, 0xE2, 0x43, 0xC9, 0x79, 0xFF, 0x70, 0xFE, 0xFD, 0xFF, 0x83, 0xB8, 0xA5, 0xC2, 0xE7, 0xE1, 0xFD, 0xFF, 0x23, 0x58, 0x43, 0x60, 0x85, 0x70, 0x28, 0xA1, 0x44, 0x70, 0x48, 0xB1, 0x23, 0x70, 0x85, 0x80, 0x03, 0x80, 0x24, 0x80, 0x28, 0xB1, 0x24, 0x78, 0x24, 0x90, 0x44, 0x70, 0x44, 0x78, 0xC6, 0xA8,
+    0x69, 0xC9, 0x03, 0x80, 0x24, 0x90, 0x03, 0x90, 0x65, 0x98, 0x24, 0x90, 0xC6, 0xB8, 0x07, 0xB1, 0x85, 0xA0, 0x85, 0x98, 0x44, 0x90, 0x44, 0x88, 0x44, 0x98, 0x45, 0x98, 0x24, 0x90, 0x65, 0x88, 0xA6, 0x98, 0xA6, 0xA8, 0x65, 0x90, 0xA5, 0x98, 0x44, 0x90, 0x85, 0xB8, 0xE6, 0xA0, 0x28, 0xD9, 0x64, 0x78, 0x65, 0xA8, 0xA5, 0x98, 0xE6, 0xB8, 0x64, 0x88, 0xC6, 0xB0, 0x48, 0xC9, 0x43, 0x90,
+    0xC6, 0xB8, 0x84, 0xA0, 0x84, 0xA0, 0x84, 0x98, 0x84, 0xB0, 0x07, 0xB9, 0xE5, 0xB8, 0xC5, 0xB8, 0xE5, 0xB8, 0xA4, 0xA8, 0xC5, 0xB8, 0x63, 0xA0, 0xC4, 0xA0, 0xA4, 0xA8, 0xE5, 0xA8, 0xE5, 0xB8, 0x43, 0x98, 0xE4, 0xA8, 0xA3, 0x98, 0xA3, 0xA0, 0xC4, 0xA8, 0xC4, 0xA0, 0xC4, 0x98, 0x25, 0xB9, 0xA4, 0xA8, 0xC4, 0xA0, 0xC4, 0xA8, 0x04, 0xA1, 0x05, 0xA9, 0xE4, 0xA8, 0x25, 0xA9, 0x25, 0xA9,
+    0x44, 0x70, 0x05, 0x98, 0x65, 0x80, 0xC7, 0xB0, 0x65, 0x88, 0xAB, 0xE1, 0x24, 0x90, 0x66, 0x98, 0x6C, 0xE9, 0x48, 0xC0, 0xED, 0xF1, 0x49, 0xC0, 0x07, 0xD0, 0x24, 0x90, 0x45, 0x88, 0xEB, 0xD1, 0x38, 0xF4, 0x67, 0xC0, 0x48, 0xD8, 0x0E, 0xE2, 0xAA, 0xF0, 0x05, 0xA0, 0xCA, 0xE0, 0xEA, 0xE0, 0x65, 0xA0, 0x66, 0xA8, 0x45, 0xA8, 0x03, 0x98, 0x45, 0xA0, 0x65, 0xA0, 0x25, 0xA8, 0x65, 0x90,
+    0xA7, 0xC0, 0xA6, 0xB8, 0x65, 0xB0, 0x66, 0xB0, 0x44, 0x90, 0x67, 0xD8, 0xC7, 0xB0, 0x08, 0xD9, 0x44, 0x80, 0x86, 0xD0, 0x65, 0xA8, 0x86, 0xC8, 0x64, 0x90, 0x24, 0xA8, 0x28, 0xD9, 0x44, 0xA0, 0x27, 0xC9, 0x43, 0x98, 0x23, 0xA0, 0x84, 0x98, 0x63, 0xA0, 0xA4, 0x98, 0x65, 0xC8, 0x84, 0xA8, 0x83, 0xA0, 0x63, 0xB0, 0x27, 0xD1, 0xC5, 0xB8, 0xE5, 0xB8, 0x63, 0xB0, 0x84, 0xA8, 0xC5, 0xB8,
+    0x26, 0xC1, 0x63, 0x98, 0x63, 0x98, 0xA4, 0xA8, 0x83, 0xA0, 0x83, 0x98, 0xA4, 0xA0, 0x83, 0xB0, 0xE4, 0xA8, 0xC4, 0xA0, 0xC4, 0xA8, 0xC4, 0xA8, 0xE4, 0xA8, 0xE5, 0xA8, 0x05, 0xB1, 0x05, 0xA9, 0x24, 0xA0, 0xE6, 0xD8, 0x06, 0xA8, 0x64, 0x98, 0x45, 0x88, 0x0E, 0xEB, 0x23, 0x90, 0xFF, 0xFF, 0xE8, 0xC8, 0x47, 0xC8, 0x4F, 0xDB, 0x89, 0xD9, 0x0A, 0xE9, 0xEA, 0xE0, 0x27, 0xC8, 0x09, 0xD0,
+    0x54, 0xDC, 0x96, 0xFE, 0x34, 0xFD, 0x7C, 0xF6, 0x69, 0xE0, 0xFF, 0xFD, 0xDF, 0xFF, 0xCE, 0xF1, 0x47, 0xC0, 0x06, 0xC8, 0xFF, 0xFF, 0xC9, 0xD8, 0x45, 0xA8, 0x06, 0xB8, 0xFF, 0xFF, 0x8B, 0xE1, 0xA8, 0xD8, 0x69, 0xD8, 0xFF, 0xFF, 0xA8, 0xE0, 0x45, 0x98, 0x2A, 0xF1, 0xFF, 0xFF, 0xA7, 0xD8, 0x65, 0x88, 0x29, 0xD9, 0xFF, 0xFF, 0x87, 0xD8, 0x65, 0x98, 0x04, 0xC0, 0xBE, 0xFF, 0x04, 0xB8,
+    0x8A, 0xF1, 0xC7, 0xE0, 0xDD, 0xFF, 0x64, 0xB8, 0x65, 0xC8, 0xE7, 0xE0, 0xE9, 0xD1, 0x47, 0xE1, 0x30, 0xFE, 0x64, 0xC0, 0xC9, 0xE9, 0x46, 0xE9, 0xE5, 0xD8, 0x02, 0xC0, 0x94, 0xED, 0x0A, 0xB4, 0x47, 0xF1, 0xE5, 0xE0, 0xE4, 0xD8, 0x26, 0xE1, 0x63, 0xB0, 0xC4, 0xB0, 0xF5, 0xFF, 0x23, 0xC1, 0xC6, 0xD8, 0x69, 0xDB, 0xC4, 0xC0, 0xA4, 0xC0, 0xE5, 0xC0, 0x67, 0xE9, 0xE5, 0xC0, 0xE5, 0xB8,
+    0x44, 0x60, 0xE9, 0xD0, 0x67, 0xC0, 0x02, 0x80, 0x88, 0xB0, 0xC7, 0xB8, 0x29, 0xE1, 0xA9, 0xE0, 0xE8, 0xC0, 0x04, 0x88, 0xE9, 0xC0, 0x48, 0xB9, 0x4B, 0xE9, 0x2B, 0xE9, 0x26, 0xA8, 0x87, 0xB8, 0x4F, 0xFA, 0x8B, 0xE1, 0x6C, 0xE9, 0x29, 0xC0, 0x06, 0xB8, 0x05, 0xA0, 0xAC, 0xE9, 0x6C, 0xE9, 0xEF, 0xF9, 0x05, 0x90, 0x24, 0x90, 0xEA, 0xD0, 0x8C, 0xE9, 0x25, 0x98, 0x05, 0x98, 0x45, 0x80,
+    0x46, 0xB0, 0x2F, 0xEA, 0x04, 0xB8, 0xC7, 0xB0, 0x45, 0x98, 0x88, 0xD0, 0xEC, 0xD1, 0xC8, 0xD8, 0x45, 0x88, 0xA8, 0xD0, 0xFF, 0xFF, 0xE9, 0xE8, 0x85, 0xA0, 0x25, 0xA8, 0xE9, 0xE0, 0xDF, 0xFF, 0x4D, 0xFA, 0x65, 0xB8, 0x25, 0xC8, 0xDE, 0xFF, 0xB2, 0xF4, 0x44, 0xA8, 0x07, 0xE1, 0xDE, 0xFF, 0xFF, 0xFF, 0xC6, 0xD0, 0xE6, 0xD8, 0xBF, 0xFF, 0xFF, 0xFF, 0xEA, 0xE3, 0x05, 0xC9, 0x98, 0xFE,
+    0xE8, 0xDA, 0x08, 0xEA, 0x45, 0xD1, 0xB4, 0xEE, 0x69, 0xEA, 0xFD, 0xFF, 0xFF, 0xFF, 0x88, 0xEA, 0xF2, 0xE5, 0x4D, 0xDC, 0xA5, 0xD8, 0xFF, 0xFF, 0x46, 0xE1, 0x73, 0xFF, 0x27, 0xD9, 0xD6, 0xFF, 0x44, 0x60, 0x64, 0x60, 0x65, 0x70, 0x03, 0x70, 0x85, 0x78, 0xE8, 0xB0, 0x44, 0x70, 0x04, 0x78, 0x6F, 0xF3, 0x2A, 0xC0, 0x46, 0xA0, 0x45, 0x88, 0x27, 0xB0, 0x25, 0x80, 0x26, 0xA0, 0x68, 0xC8,
+    0xDB, 0xFC, 0x67, 0xA0, 0x47, 0xA8, 0x07, 0xD0, 0x88, 0xB8, 0x26, 0x90, 0x0A, 0xC9, 0x0A, 0xC1, 0x66, 0x98, 0x04, 0x80, 0x05, 0x90, 0x03, 0x80, 0x26, 0x90, 0x26, 0x98, 0x05, 0x98, 0x25, 0x88, 0x87, 0xA8, 0x67, 0xA8, 0x46, 0xA8, 0x87, 0xB8, 0x66, 0x98, 0xCA, 0xE8, 0xA7, 0xA8, 0xE9, 0xE0, 0x65, 0x90, 0x47, 0xD0, 0x6B, 0xE1, 0xEB, 0xE0, 0x86, 0xA8, 0x04, 0xA8, 0x25, 0xB0, 0x48, 0xE0,
+    0x9E, 0xFF, 0x66, 0xC0, 0x66, 0xB8, 0x65, 0xB0, 0x44, 0xA8, 0xAC, 0xE2, 0xE8, 0xE8, 0x86, 0xC8, 0x24, 0xB8, 0x45, 0xC8, 0x2A, 0xE2, 0xA5, 0xC0, 0x44, 0xA8, 0x85, 0xB8, 0x4A, 0xEA, 0xAA, 0xDA, 0x01, 0xA0, 0x84, 0xB0, 0xA5, 0xC0, 0xCB, 0xF2, 0x0F, 0xFC, 0xC5, 0xC8, 0xA4, 0xD0, 0xC6, 0xD8, 0xAF, 0xCB, 0xB1, 0xEC, 0xFF, 0xFF, 0xAB, 0xEA, 0x0E, 0xF4, 0xFF, 0xFF, 0x86, 0xC1, 0xFF, 0xFF,
+    0x44, 0x68, 0x04, 0x80, 0x25, 0x70, 0xD2, 0xEA, 0x09, 0xA8, 0xA8, 0xC0, 0x24, 0x78, 0x27, 0xA0, 0x58, 0xF4, 0x04, 0x90, 0x47, 0xB8, 0x06, 0x98, 0x2C, 0xC8, 0x29, 0xC0, 0x06, 0x88, 0x6D, 0xD8, 0x1B, 0xEE, 0x29, 0xC8, 0x28, 0xB8, 0x07, 0xC0, 0xFF, 0xFF, 0x05, 0x98, 0x28, 0xD0, 0xAA, 0xE0, 0x49, 0xB8, 0x26, 0x90, 0x06, 0x98, 0x06, 0xA8, 0x68, 0xB8, 0x26, 0xA0, 0x05, 0x88, 0x88, 0xB0,
+    0xE9, 0xD8, 0x47, 0xA8, 0x69, 0xE8, 0x47, 0xC8, 0xC8, 0xB0, 0xCA, 0xE8, 0x8A, 0xE0, 0x26, 0xC0, 0x45, 0x90, 0x68, 0xE0, 0xA9, 0xD1, 0x88, 0xE0, 0x46, 0xB8, 0xFF, 0xFF, 0x05, 0xC0, 0x04, 0xA8, 0x86, 0xD8, 0x25, 0xC8, 0xA7, 0xC8, 0x24, 0xB0, 0xE7, 0xD1, 0x45, 0xC8, 0x87, 0xE8, 0xFF, 0xF7, 0xA7, 0xE8, 0x08, 0xE9, 0x86, 0xE0, 0x86, 0xE8, 0x03, 0xB8, 0xA5, 0xC8, 0x33, 0xFD, 0x44, 0xB0,
+    0x43, 0xB0, 0xA5, 0xC8, 0x23, 0xC8, 0x85, 0xB8, 0xA5, 0xB8, 0x64, 0xA0, 0x64, 0xB0, 0x64, 0xC8, 0x64, 0xB8, 0xA5, 0xC8, 0xC5, 0xC8, 0x85, 0xC0, 0xC5, 0xC8, 0xA5, 0xC0, 0xC5, 0xC8, 0xC5, 0xC8, 0x06, 0x78, 0x04, 0x70, 0x66, 0x88, 0x05, 0x80, 0xCC, 0xD9, 0x0A, 0xC9, 0x24, 0x70, 0x46, 0xA0, 0x88, 0xA8, 0x0D, 0xD0, 0x08, 0xB0, 0x06, 0x98, 0x06, 0xA0, 0xFF, 0xFF, 0xDF, 0xFF, 0xCB, 0xD8,
+    0x0D, 0xF9, 0xDF, 0xFF, 0xDF, 0xFF, 0x07, 0xB0, 0x07, 0xA8, 0x3C, 0xF4, 0xFF, 0xFF, 0xA9, 0xC8, 0x88, 0xA0, 0x06, 0xA8, 0xFF, 0xF7, 0x06, 0x98, 0x27, 0xB0, 0x29, 0xB8, 0xFF, 0xFF, 0x28, 0xA0, 0x2C, 0xE9, 0x49, 0xD0, 0xFF, 0xFF, 0x47, 0xC0, 0xC8, 0xB0, 0x8A, 0xE8, 0xFF, 0xFF, 0x68, 0xD0, 0x45, 0x90, 0xAB, 0xE8, 0xFF, 0xFF, 0xA9, 0xE0, 0x87, 0xA8, 0x47, 0xD0, 0xFF, 0xF7, 0x04, 0xB0,
+    0x66, 0xC8, 0x24, 0xB8, 0xDE, 0xFF, 0x45, 0xB8, 0x44, 0xA8, 0xA7, 0xE0, 0x08, 0xE1, 0x25, 0xC0, 0xA7, 0xE0, 0xA7, 0xE0, 0x24, 0xD0, 0x25, 0xD8, 0x85, 0xE0, 0x86, 0xE0, 0x44, 0xB0, 0xC8, 0xB9, 0xE6, 0xE8, 0x03, 0xC8, 0x64, 0xD0, 0x0B, 0xEC, 0xA6, 0xD8, 0x64, 0xA8, 0x23, 0xB0, 0x26, 0xE1, 0x44, 0xC8, 0x84, 0xB0, 0x85, 0xD0, 0x65, 0xD0, 0x85, 0xC8, 0x64, 0xC0, 0x8C, 0xE4, 0xA5, 0xC0,
+    0x18, 0xFF, 0x64, 0x58, 0x03, 0x68, 0x86, 0x90, 0x05, 0x88, 0xFE, 0xFF, 0x47, 0xD0, 0x04, 0x78, 0xE9, 0xB8, 0x8D, 0xC8, 0xFF, 0xFF, 0x05, 0x98, 0x48, 0xB0, 0x25, 0x80, 0x08, 0xC8, 0xD4, 0xE9, 0xD2, 0xE8, 0x89, 0xC0, 0x48, 0xA0, 0xFF, 0xFF, 0xFF, 0xF7, 0x06, 0x98, 0xA9, 0xC0, 0x8F, 0xEA, 0xED, 0xE8, 0x2E, 0xF1, 0x06, 0x88, 0x25, 0x80, 0xAA, 0xB8, 0x2E, 0xE9, 0x05, 0x90, 0x46, 0x88,
+    0xAA, 0xD0, 0xFF, 0xFF, 0xEB, 0xE8, 0x07, 0xB0, 0x67, 0x98, 0x6C, 0xE8, 0x51, 0xD2, 0x89, 0xC8, 0x45, 0x90, 0x49, 0xD8, 0xFF, 0xFF, 0xCA, 0xE0, 0x25, 0x98, 0xA8, 0xC0, 0x8C, 0xC1, 0x89, 0xE0, 0x47, 0xC8, 0x05, 0xA8, 0xCB, 0xD9, 0xFF, 0xFF, 0x46, 0xB0, 0x6B, 0xF9, 0x88, 0xD9, 0x4E, 0xDB, 0x66, 0xC8, 0x69, 0xE9, 0x25, 0xD0, 0xFF, 0xFF, 0x86, 0xE0, 0x24, 0xB0, 0x04, 0xC0, 0xFF, 0xFF,
+    0xE8, 0xE8, 0x08, 0xF1, 0x24, 0xC9, 0xFF, 0xFF, 0x65, 0xD8, 0x64, 0xB8, 0xFF, 0xFF, 0xA8, 0xEA, 0x44, 0xD8, 0x65, 0xC8, 0x64, 0xB8, 0xF8, 0xFF, 0x85, 0xD8, 0x64, 0xD0, 0xA5, 0xC0, 0x2A, 0xDC, 0x24, 0x60, 0x09, 0xB1, 0x88, 0xC0, 0x45, 0x70, 0x04, 0x60, 0x66, 0x80, 0x25, 0x70, 0xCA, 0xD8, 0x67, 0xA8, 0x04, 0x70, 0x05, 0x80, 0x29, 0xB1, 0xAF, 0xF9, 0x2D, 0xF1, 0x05, 0x78, 0xA9, 0xA8,
+    0x8B, 0xC1, 0x2F, 0xDA, 0xED, 0xE8, 0x28, 0x98, 0x28, 0x98, 0x89, 0xC8, 0x10, 0xFA, 0x2D, 0xE1, 0x47, 0xA0, 0x27, 0xB0, 0x26, 0x80, 0x26, 0xA0, 0x0D, 0xF1, 0x06, 0x90, 0x05, 0x80, 0x67, 0x98, 0xCB, 0xE0, 0x52, 0xF2, 0xAA, 0xC8, 0x7B, 0xFF, 0x67, 0x98, 0x6B, 0xE8, 0xFE, 0xFF, 0xAA, 0xE0, 0x25, 0x88, 0x2A, 0xE8, 0xFF, 0xFF, 0xAA, 0xE8, 0x47, 0xA8, 0x68, 0xE0, 0x05, 0xB8, 0xFF, 0xFF,
+    0x0A, 0xE1, 0x25, 0xB0, 0x05, 0xB8, 0x67, 0xE0, 0xCB, 0xD9, 0x67, 0xC8, 0x67, 0xE0, 0x05, 0xD8, 0xFF, 0xFF, 0x2E, 0xFB, 0x03, 0xB0, 0x03, 0xB8, 0x26, 0xD8, 0xFF, 0xFF, 0x03, 0xA8, 0x24, 0xA8, 0x05, 0xC8, 0xEB, 0xE2, 0x47, 0xD1, 0x24, 0xC0, 0x66, 0xD0, 0x24, 0xD0, 0xFF, 0xFF, 0x44, 0xD0, 0x25, 0xD0, 0xDF, 0xFF, 0x6A, 0xE2, 0xBC, 0xFF, 0x85, 0xC8, 0x65, 0xC8, 0x06, 0xC9, 0x26, 0xE9,
+    0x03, 0x50, 0x45, 0x60, 0x46, 0x68, 0x56, 0xF9, 0x05, 0x58, 0x67, 0x90, 0x25, 0x60, 0x5B, 0xFC, 0xCC, 0xB8, 0x05, 0x70, 0x07, 0x88, 0x8C, 0xB8, 0x08, 0x90, 0x26, 0x70, 0x26, 0x70, 0xDF, 0xF6, 0x3E, 0xFE, 0x07, 0x88, 0x28, 0x88, 0xFF, 0xF7, 0xD5, 0xE2, 0x06, 0x80, 0x49, 0xB0, 0x8F, 0xE8, 0x06, 0x88, 0x06, 0x78, 0x06, 0x78, 0x2C, 0xF1, 0xCB, 0xC0, 0x68, 0xA0, 0x06, 0x88, 0x6B, 0xE1,
+    0x6A, 0xC0, 0x68, 0xA8, 0x6C, 0xE8, 0x07, 0xB0, 0x47, 0x90, 0x29, 0xD0, 0xFF, 0xFF, 0x48, 0xB8, 0x26, 0x90, 0x6A, 0xE0, 0x9B, 0xFE, 0x09, 0xD8, 0x05, 0x98, 0x28, 0xD8, 0x05, 0xB0, 0xCD, 0xD8, 0x8B, 0xE9, 0xFE, 0xFF, 0x05, 0xB0, 0x25, 0xA8, 0xFE, 0xFF, 0x4D, 0xEA, 0x67, 0xE0, 0x05, 0xB8, 0x27, 0xD1, 0x88, 0xE0, 0xEB, 0xE9, 0xFD, 0xFF, 0x86, 0xC0, 0x24, 0xA0, 0x23, 0xA8, 0x8A, 0xE9,
+    0x69, 0xE1, 0xC5, 0xD0, 0xA8, 0xF1, 0x24, 0xC0, 0xEA, 0xE1, 0x24, 0xA8, 0x84, 0xD0, 0x25, 0xD8, 0xD0, 0xE3, 0x4F, 0xE3, 0x88, 0xD8, 0x65, 0xC0, 0x0E, 0xF3, 0xEA, 0xE0, 0x4F, 0xE3, 0x27, 0xD9, 0x27, 0x68, 0x25, 0x58, 0x24, 0x58, 0xCD, 0xB0, 0x07, 0x88, 0x05, 0x78, 0xF1, 0xE9, 0x06, 0x70, 0xC8, 0x98, 0x0D, 0xD0, 0x8D, 0xA8, 0x26, 0x70, 0x06, 0x80, 0xDD, 0xFD, 0x1D, 0xFE, 0xAA, 0xA8,
+    0x4B, 0xB8, 0x52, 0xE1, 0xFF, 0xFE, 0x08, 0x80, 0x28, 0x88, 0x0D, 0xC8, 0x5E, 0xFF, 0xFA, 0xFD, 0x89, 0x98, 0x07, 0x88, 0xFF, 0xFF, 0x06, 0x80, 0x8B, 0xC8, 0x29, 0xA8, 0xFF, 0xFF, 0x28, 0x98, 0xAC, 0xD0, 0xAB, 0xC0, 0xFF, 0xFF, 0x06, 0x98, 0x07, 0x90, 0xAC, 0xE0, 0xFF, 0xFF, 0x28, 0xB0, 0x26, 0x88, 0x0A, 0xE0, 0xFF, 0xFF, 0x07, 0xC0, 0x26, 0x98, 0xEA, 0xD8, 0xFF, 0xFF, 0x8A, 0xE0,
+    0x06, 0xB8, 0x06, 0xC8, 0x7E, 0xFF, 0x05, 0xA8, 0x25, 0xA0, 0x49, 0xE9, 0xC9, 0xD0, 0x05, 0xA8, 0x87, 0xD0, 0xC8, 0xE8, 0x04, 0xC0, 0x04, 0xB0, 0x45, 0xB0, 0x87, 0xE8, 0x24, 0xA0, 0x24, 0x98, 0x25, 0xC0, 0xC8, 0xE8, 0x03, 0xB0, 0x03, 0xB0, 0x03, 0xB8, 0x44, 0xA0, 0x45, 0xC0, 0x44, 0xB0, 0x45, 0xC0, 0x66, 0xD8, 0x66, 0xC8, 0x65, 0xB8, 0x65, 0xC0, 0x85, 0xC0, 0x65, 0xB8, 0x66, 0xD8,
+    0x68, 0x90, 0x25, 0x68, 0x06, 0x78, 0x25, 0x60, 0x06, 0x60, 0x26, 0x90, 0x2F, 0xDA, 0xFF, 0xFF, 0xEA, 0x90, 0x26, 0x78, 0x08, 0xA0, 0x72, 0xEB, 0x29, 0xA8, 0x27, 0x70, 0x08, 0x70, 0x09, 0x88, 0xBF, 0xFF, 0x28, 0x88, 0x2F, 0x98, 0x09, 0x98, 0xFF, 0xFF, 0x0A, 0x98, 0x11, 0xC8, 0x06, 0x78, 0x49, 0x98, 0xB2, 0xE8, 0x07, 0x80, 0x06, 0x78, 0x07, 0x98, 0x8F, 0xEA, 0x07, 0x90, 0x28, 0x90,
+    0x4E, 0xE9, 0x9F, 0xFF, 0x8B, 0xD0, 0x09, 0xC0, 0x27, 0x90, 0x09, 0xC0, 0xD2, 0xE0, 0x06, 0xA0, 0x26, 0x88, 0x2B, 0xD8, 0xF7, 0xDB, 0x07, 0xC0, 0x06, 0x98, 0x28, 0xB8, 0xDF, 0xFF, 0x08, 0xC8, 0x8A, 0xE2, 0x26, 0xB0, 0xFF, 0xFF, 0x28, 0xC9, 0x05, 0xB0, 0x27, 0xC8, 0x6F, 0xD2, 0x05, 0xB0, 0x88, 0xE0, 0x06, 0xC0, 0x05, 0xC0, 0xB1, 0xDB, 0x24, 0xB8, 0x24, 0xA0, 0x04, 0xC0, 0xFF, 0xFF,
+    0x04, 0xC0, 0x01, 0xA0, 0x64, 0xC0, 0x19, 0xFF, 0x04, 0xA8, 0x44, 0xA8, 0xB8, 0xFE, 0x09, 0xE3, 0x24, 0xC8, 0xA7, 0xD8, 0x44, 0xB0, 0xD6, 0xFF, 0xA6, 0xE0, 0xC7, 0xD8, 0x65, 0xB0, 0x07, 0xDA, 0x24, 0x50, 0x2A, 0x68, 0x04, 0x48, 0x05, 0x60, 0x4E, 0xE1, 0x47, 0x98, 0x26, 0x60, 0x25, 0x58, 0x8F, 0xC0, 0x0C, 0x80, 0x07, 0x88, 0x27, 0x68, 0x29, 0x78, 0x09, 0x98, 0x08, 0x88, 0xAD, 0xB0,
+    0x0A, 0x90, 0xDB, 0xD8, 0x08, 0x80, 0x1F, 0xFC, 0x0E, 0xB8, 0x09, 0x90, 0x6A, 0xA0, 0xB4, 0xF1, 0xB6, 0xEA, 0x07, 0x68, 0x07, 0x78, 0x09, 0x98, 0xCD, 0xD8, 0x28, 0x90, 0x07, 0x80, 0x09, 0x98, 0x08, 0x90, 0xFF, 0xFF, 0x29, 0xB0, 0x07, 0xA8, 0x07, 0x88, 0x10, 0xE0, 0xFF, 0xFF, 0x28, 0x98, 0x47, 0x88, 0x2B, 0xD8, 0xFF, 0xFF, 0x4A, 0xD8, 0x06, 0x90, 0x3C, 0xFF, 0x2A, 0xD8, 0xFF, 0xFF,
+    0x06, 0xC8, 0x27, 0xC0, 0x8E, 0xF9, 0xF1, 0xE2, 0x47, 0xE0, 0x46, 0xC0, 0x06, 0xB8, 0xDF, 0xFF, 0x76, 0xED, 0x05, 0xB0, 0x48, 0xE1, 0x26, 0xE0, 0x6B, 0xE2, 0x04, 0xB0, 0x59, 0xFF, 0x04, 0xA0, 0xDF, 0xF7, 0xFB, 0xFF, 0x46, 0xC8, 0x66, 0xD8, 0xC9, 0xE1, 0x04, 0xD8, 0x04, 0xB8, 0x24, 0xB0, 0x09, 0xE9, 0x37, 0xD6, 0x24, 0xB8, 0x44, 0xB8, 0x65, 0xB8, 0x45, 0xC8, 0x46, 0xD1, 0x86, 0xC8,
+    0xF7, 0xF9, 0x05, 0x58, 0x0C, 0xE1, 0x0A, 0x68, 0x46, 0x58, 0x06, 0x68, 0x07, 0x68, 0x8F, 0xF1, 0x89, 0x78, 0x07, 0x68, 0x09, 0x78, 0x36, 0xD9, 0xAD, 0xE0, 0x08, 0x60, 0x08, 0x68, 0xDA, 0xC9, 0x09, 0x88, 0xCF, 0xE8, 0x08, 0x80, 0xFF, 0xFF, 0x0F, 0x88, 0x08, 0x78, 0x76, 0xF1, 0x12, 0xC8, 0x07, 0x70, 0x07, 0x70, 0x9F, 0xF0, 0x5A, 0xE9, 0x6F, 0xC8, 0x09, 0x90, 0xF8, 0xD9, 0x8B, 0xB0,
+    0x0B, 0xC8, 0x2B, 0xB0, 0xFF, 0xFF, 0x4B, 0xA8, 0xEF, 0xC9, 0x8C, 0xD0, 0x3A, 0xED, 0x48, 0x98, 0x06, 0x80, 0x09, 0xB8, 0xFF, 0xFF, 0x08, 0xB8, 0x06, 0x98, 0x49, 0xB8, 0x28, 0xB8, 0xFF, 0xFF, 0x06, 0xA8, 0x6E, 0xDB, 0x49, 0xD0, 0x07, 0xC0, 0xCE, 0xE9, 0x27, 0xC8, 0x06, 0xB0, 0x05, 0xA8, 0x28, 0xD8, 0x8F, 0xFA, 0x25, 0xA8, 0x06, 0xB8, 0x67, 0xE0, 0x05, 0xD8, 0xAA, 0xE1, 0x22, 0xB0,
+    0x24, 0xB8, 0x25, 0xC8, 0x06, 0xD9, 0x85, 0xD0, 0x04, 0x98, 0x04, 0xB0, 0xFF, 0xFF, 0x8F, 0xF2, 0x25, 0xC0, 0x05, 0xB8, 0x2A, 0xDB, 0xC6, 0xD8, 0xAA, 0xE9, 0x25, 0xC0, 0x07, 0xE1, 0x04, 0xB0, 0x27, 0x50, 0x25, 0x50, 0x68, 0x68, 0x06, 0x50, 0x09, 0x68, 0x09, 0x50, 0x25, 0x48, 0x26, 0x48, 0x29, 0x78, 0x0B, 0x80, 0x09, 0x70, 0x0F, 0x58, 0x09, 0x60, 0x91, 0xC0, 0x08, 0x58, 0x6D, 0x90,
+    0x4C, 0x90, 0x0B, 0x80, 0x97, 0xB8, 0x0B, 0x78, 0x08, 0x60, 0x0A, 0x88, 0x77, 0xBA, 0x08, 0x70, 0x08, 0x70, 0x5F, 0xE1, 0xDF, 0xFF, 0x0A, 0x80, 0xCF, 0xB0, 0x0B, 0x90, 0xFF, 0xFF, 0xAB, 0x98, 0x0C, 0xA8, 0x09, 0x80, 0xFF, 0xFF, 0x96, 0xE1, 0x07, 0x78, 0x4B, 0xB0, 0xFF, 0xFF, 0x27, 0x88, 0x26, 0x78, 0x09, 0xB8, 0xFF, 0xFF, 0x0A, 0xC8, 0x06, 0x98, 0x27, 0xA8, 0x9F, 0xFF, 0x9B, 0xF3,
+    0x07, 0xC8, 0x28, 0xC8, 0x4B, 0xC1, 0x89, 0xD8, 0xCF, 0xF1, 0x07, 0xC8, 0x07, 0xC0, 0x06, 0xA0, 0xAA, 0xD8, 0x27, 0xD8, 0x6C, 0xE9, 0x05, 0xA8, 0xC8, 0xF0, 0xC8, 0xD8, 0x04, 0xA8, 0x4A, 0xE1, 0x86, 0xB0, 0x64, 0xC0, 0x66, 0xC0, 0x69, 0xD9, 0x6B, 0xEA, 0x04, 0xC0, 0x24, 0xA8, 0x05, 0xB0, 0x04, 0xB8, 0x0F, 0xDB, 0x25, 0xB8, 0x25, 0xB0, 0x07, 0xD8, 0x6F, 0xFC, 0x4F, 0xF2, 0x66, 0xC0,
+    0x25, 0x48, 0x45, 0x50, 0x1C, 0xEB, 0x26, 0x48, 0x26, 0x48, 0x06, 0x50, 0x5E, 0x58, 0xFF, 0xFF, 0x49, 0x60, 0x0B, 0x68, 0x48, 0x70, 0x07, 0x60, 0xAD, 0x98, 0x69, 0x78, 0x09, 0x60, 0x8C, 0x80, 0x32, 0xC0, 0x12, 0x88, 0x0C, 0x60, 0x08, 0x58, 0x2D, 0x90, 0x0A, 0x70, 0x8C, 0x88, 0x08, 0x68, 0x33, 0xA0, 0x0C, 0xA0, 0x09, 0x78, 0x09, 0x78, 0x2E, 0x98, 0x54, 0xE8, 0x70, 0xB8, 0x6D, 0x98,
+    0x08, 0x78, 0x53, 0xD8, 0x09, 0x88, 0x4C, 0x98, 0x08, 0x80, 0x4E, 0xB0, 0x7C, 0xEC, 0x07, 0x80, 0x07, 0x78, 0x0B, 0xD8, 0xFF, 0xFF, 0xCD, 0xD0, 0xB3, 0xFD, 0xDF, 0xFE, 0xDF, 0xFF, 0x4A, 0xB0, 0xFF, 0xFF, 0x27, 0xA8, 0x3C, 0xEF, 0x07, 0xB0, 0x28, 0xB8, 0x05, 0xA0, 0x9F, 0xFF, 0x7D, 0xFF, 0x69, 0xD0, 0x06, 0x98, 0x67, 0xD8, 0x05, 0xB8, 0xD0, 0xEC, 0x25, 0xB0, 0xA8, 0xE0, 0x04, 0xC8,
+    0x25, 0xC0, 0x05, 0xA8, 0x46, 0xD0, 0x45, 0xD0, 0x24, 0xA0, 0x87, 0xD0, 0x01, 0xA8, 0x28, 0xE9, 0x04, 0xD1, 0x06, 0xD8, 0x46, 0xB8, 0x06, 0xE1, 0x45, 0xB0, 0x45, 0xA8, 0xA7, 0xD8, 0x25, 0xC8, 0xB6, 0xFC, 0x25, 0x40, 0x25, 0x40, 0x07, 0x48, 0x09, 0x40, 0x0F, 0xC2, 0x6D, 0x80, 0x27, 0x50, 0x0F, 0x50, 0x08, 0x50, 0xFF, 0xFF, 0xA9, 0x70, 0x09, 0x58, 0x0C, 0x60, 0x08, 0x58, 0x14, 0xC0,
+    0x10, 0x78, 0x91, 0x98, 0x6E, 0x91, 0xBF, 0xFE, 0x3C, 0xC9, 0x0A, 0x70, 0x4B, 0x80, 0x31, 0xB8, 0x16, 0xD8, 0x8C, 0x88, 0xFF, 0xFA, 0xFC, 0xDA, 0x17, 0xC0, 0x2F, 0xB8, 0x09, 0x80, 0x0C, 0x80, 0x59, 0xF9, 0x77, 0xC2, 0x7B, 0xD9, 0x2D, 0xC9, 0x29, 0x88, 0x0E, 0xB8, 0x9C, 0xEB, 0x07, 0x78, 0x07, 0x78, 0x2B, 0xC8, 0x52, 0xD1, 0x2A, 0xA8, 0x06, 0xA8, 0x4A, 0xD0, 0xF0, 0xE8, 0x4A, 0xC8,
+    0x08, 0xA0, 0x07, 0xB8, 0x2C, 0xE8, 0x3F, 0xFF, 0x2E, 0xE4, 0x47, 0xC8, 0x26, 0xA8, 0xFF, 0xFF, 0x07, 0xD8, 0x05, 0x90, 0x06, 0xA0, 0x30, 0xEA, 0x05, 0xB8, 0x03, 0x98, 0x24, 0xC0, 0x25, 0xB8, 0x54, 0xD3, 0x45, 0xC8, 0xEB, 0xE2, 0x06, 0xC0, 0x6A, 0xE1, 0x04, 0xB0, 0x45, 0xB8, 0x05, 0xB0, 0x04, 0xA8, 0x66, 0xB0, 0x24, 0xB8, 0x25, 0xA8, 0x24, 0xA0, 0x65, 0xB0, 0x25, 0xB0, 0x04, 0xA8,
+    0x25, 0x38, 0x0A, 0x48, 0x2E, 0x40, 0x05, 0x68, 0x6B, 0x90, 0x09, 0x50, 0x47, 0x48, 0x06, 0x48, 0x8C, 0x98, 0x09, 0x60, 0x08, 0x68, 0x0E, 0x58, 0x2A, 0x58, 0xF0, 0xC0, 0x09, 0x58, 0xBA, 0x90, 0xF7, 0x98, 0x28, 0x60, 0x72, 0xE8, 0xD7, 0x88, 0x29, 0x58, 0x2A, 0x70, 0x30, 0xA8, 0xFF, 0xFF, 0x0B, 0x70, 0x31, 0x88, 0x4D, 0x98, 0x0C, 0x80, 0x55, 0xD0, 0x0B, 0x88, 0x1E, 0xEA, 0x8C, 0x90,
+    0x11, 0x90, 0x99, 0xF0, 0x5F, 0xFF, 0x0F, 0x98, 0x29, 0x80, 0x0A, 0x98, 0x3C, 0xF1, 0x07, 0x70, 0x07, 0x70, 0x2E, 0xC8, 0x9C, 0xED, 0x2B, 0xA8, 0x07, 0x88, 0x07, 0x98, 0x2B, 0xC0, 0x09, 0xB8, 0x08, 0x98, 0xF8, 0xFD, 0x6A, 0xC0, 0xFF, 0xFF, 0x07, 0xB0, 0xD8, 0xF5, 0x05, 0x90, 0x07, 0xA8, 0xFF, 0xFF, 0xEB, 0xE9, 0x06, 0xA0, 0x06, 0xA0, 0x8C, 0xD2, 0x2B, 0xD0, 0x25, 0x98, 0x24, 0xD0,
+    0x06, 0xC0, 0xFF, 0xFF, 0x88, 0xD0, 0xF8, 0xF6, 0x05, 0xA8, 0x05, 0xC8, 0xCD, 0xC9, 0xE7, 0xB8, 0xCA, 0xF2, 0x46, 0xC0, 0xA9, 0xD8, 0x09, 0xE9, 0x04, 0xB0, 0x45, 0xA0, 0x04, 0xA0, 0xE8, 0xE8, 0x08, 0x40, 0x26, 0x40, 0xAB, 0xC0, 0xA9, 0x58, 0x47, 0x48, 0x06, 0x40, 0x09, 0x50, 0xAC, 0xC0, 0x27, 0x50, 0x6A, 0x68, 0xEE, 0x78, 0x0B, 0x50, 0x6C, 0xC0, 0x4E, 0x80, 0x0E, 0x40, 0x29, 0x58,
+    0xEC, 0x80, 0x12, 0xE9, 0x9F, 0xD7, 0x0A, 0x50, 0x2B, 0x58, 0x19, 0x60, 0x38, 0xE0, 0x0A, 0x68, 0x0C, 0x60, 0x10, 0x68, 0x78, 0xB9, 0xBA, 0xE0, 0xFB, 0xC9, 0x0B, 0x70, 0x3F, 0xFF, 0x0B, 0x70, 0x0E, 0x90, 0x0A, 0x70, 0x9F, 0xFC, 0x0C, 0x78, 0x08, 0x70, 0x0B, 0x88, 0xDF, 0xFF, 0x07, 0x68, 0x07, 0x68, 0x0D, 0xB8, 0x5E, 0xFE, 0x2D, 0xA8, 0x4A, 0xB8, 0x0A, 0xA0, 0xB9, 0xDB, 0xFF, 0xFF,
+    0x0C, 0xC0, 0x08, 0x98, 0x0A, 0xC0, 0x2A, 0xB8, 0xFF, 0xFF, 0x29, 0xC0, 0x05, 0x98, 0x08, 0xD0, 0x09, 0xC0, 0xBF, 0xFF, 0x0A, 0xF1, 0x06, 0x98, 0x8A, 0xC0, 0x50, 0xE1, 0x06, 0xB8, 0x05, 0x90, 0xA8, 0xC3, 0x88, 0xD0, 0xD0, 0xE1, 0x07, 0xB0, 0x0D, 0xFC, 0x05, 0xB0, 0x04, 0xA8, 0x52, 0xDA, 0x26, 0xB8, 0x43, 0xB0, 0x05, 0xA8, 0x04, 0xB8, 0xBF, 0xFE, 0x6B, 0xE3, 0x29, 0xE9, 0x45, 0x98,
+    0x08, 0x40, 0x29, 0x40, 0x47, 0x48, 0x26, 0x38, 0x28, 0x40, 0x07, 0x38, 0x27, 0x38, 0x08, 0x40, 0x2A, 0x40, 0x09, 0x40, 0x07, 0x40, 0x06, 0x40, 0x09, 0x48, 0x13, 0x48, 0x08, 0x40, 0x07, 0x40, 0x0B, 0x60, 0x16, 0x50, 0x08, 0x40, 0x2A, 0x48, 0x1A, 0x50, 0x0F, 0x60, 0x94, 0xC2, 0x9F, 0xE0, 0xDD, 0x78, 0x11, 0x78, 0x15, 0x50, 0x0D, 0x80, 0x0C, 0x68, 0x34, 0x98, 0x2C, 0x60, 0x5A, 0x90,
+    0x79, 0xC9, 0x0B, 0x68, 0x0D, 0x78, 0x3A, 0xEA, 0x0A, 0x70, 0x7A, 0xD1, 0x7F, 0xFC, 0x07, 0x60, 0x07, 0x68, 0x0B, 0xA8, 0xFF, 0xFF, 0x0C, 0x98, 0x19, 0xD9, 0xFF, 0xFF, 0xD9, 0xD4, 0x7F, 0xFF, 0x2B, 0xB8, 0x08, 0x88, 0xDF, 0xFF, 0x29, 0x98, 0xD4, 0xF1, 0x0B, 0xD0, 0xDF, 0xFF, 0x49, 0xC0, 0x07, 0xB0, 0x92, 0xF1, 0x96, 0xE4, 0x06, 0xB0, 0x47, 0x98, 0x05, 0x80, 0x05, 0xC0, 0xF2, 0xE1,
+    0x05, 0x98, 0x3F, 0xFF, 0x05, 0xA0, 0x0B, 0xE9, 0xB0, 0xE2, 0x05, 0xB0, 0x05, 0xA0, 0x6E, 0xFB, 0xC9, 0xD0, 0xAD, 0xF1, 0xC9, 0xF0, 0x25, 0xA8, 0x7B, 0xFC, 0xAA, 0xC8, 0xCB, 0xE8, 0x26, 0xA8, 0x66, 0x40, 0x25, 0x38, 0x7B, 0x40, 0x79, 0x38, 0x26, 0x38, 0x15, 0x40, 0x06, 0x38, 0x0A, 0x40, 0x0F, 0x40, 0x26, 0x38, 0x08, 0x40, 0x09, 0x48, 0x2B, 0x50, 0x28, 0x40, 0x08, 0x40, 0x0F, 0x40,
+    0x0A, 0x48, 0x2B, 0x58, 0x08, 0x40, 0x10, 0x68, 0xDF, 0xF4, 0x4C, 0x60, 0x2E, 0x58, 0x0E, 0x58, 0x0C, 0x50, 0x0C, 0x50, 0x0B, 0x58, 0x12, 0x50, 0x2D, 0x58, 0x99, 0xA2, 0x0A, 0x58, 0x0B, 0x60, 0x18, 0x90, 0x7E, 0xFC, 0x0F, 0x70, 0x58, 0xA8, 0x0A, 0x68, 0x0B, 0x70, 0x7D, 0xE3, 0x07, 0x58, 0x06, 0x58, 0x0D, 0x90, 0xFF, 0xFF, 0x0B, 0x88, 0x07, 0x68, 0x5F, 0xFF, 0xB4, 0xD0, 0x08, 0x80,
+    0x4C, 0x98, 0x6A, 0xA0, 0x2A, 0xA8, 0x6C, 0xC0, 0x0D, 0xC0, 0x29, 0xA0, 0x47, 0x98, 0x11, 0xD9, 0xED, 0xD8, 0x06, 0x88, 0x07, 0x98, 0x4F, 0xF1, 0x07, 0xA0, 0x04, 0x70, 0x27, 0x98, 0x0B, 0xE0, 0x06, 0x90, 0x05, 0x80, 0xC8, 0xB8, 0x05, 0xA0, 0x06, 0xA0, 0x05, 0xA8, 0x05, 0x90, 0x47, 0xB0, 0x06, 0xA8, 0xD8, 0xF4, 0xA7, 0xD0, 0x25, 0x90, 0x29, 0xD0, 0x26, 0x98, 0x4F, 0xD1, 0x26, 0xA0,
+    0x11, 0x28, 0x0D, 0x38, 0x25, 0x30, 0x45, 0x38, 0x33, 0x30, 0x4C, 0x58, 0x26, 0x38, 0x1E, 0x50, 0x27, 0x40, 0x06, 0x40, 0xBF, 0xD2, 0x49, 0x50, 0x09, 0x40, 0x28, 0x40, 0x0F, 0x68, 0x0B, 0x40, 0x08, 0x38, 0x0B, 0x50, 0x17, 0x68, 0x1F, 0xFA, 0x2A, 0x50, 0x36, 0x50, 0x0C, 0x58, 0x0B, 0x58, 0x9F, 0xFF, 0x0D, 0x58, 0x2C, 0x60, 0x0A, 0x50, 0xFC, 0xD2, 0x2D, 0x68, 0x0F, 0x58, 0x0B, 0x60,
+    0x0B, 0x60, 0xFF, 0xFF, 0x33, 0x78, 0x0A, 0x58, 0x0B, 0x68, 0x35, 0x70, 0x0F, 0x80, 0x07, 0x58, 0x07, 0x58, 0x0B, 0x80, 0xFF, 0xFF, 0x2D, 0x90, 0x07, 0x68, 0x09, 0x60, 0x2D, 0x90, 0x0A, 0x90, 0x0C, 0x88, 0xFF, 0xFF, 0xCB, 0xB8, 0x0E, 0xC8, 0x06, 0x70, 0xFA, 0xD3, 0xDE, 0xFF, 0x8B, 0xB8, 0x08, 0x98, 0x2D, 0xA8, 0x06, 0x88, 0x06, 0x90, 0x07, 0xA8, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80,
+    0x0D, 0xD0, 0x26, 0x98, 0x04, 0x78, 0x26, 0x98, 0x5D, 0xFC, 0x2B, 0xE1, 0x05, 0x88, 0x04, 0x88, 0x06, 0xA8, 0x0E, 0xB0, 0x06, 0x98, 0x46, 0x90, 0x05, 0x90, 0x45, 0x90, 0xDC, 0xE5, 0x06, 0xB0, 0x26, 0x38, 0x25, 0x30, 0x14, 0x20, 0x30, 0xC5, 0x0B, 0x71, 0x26, 0x38, 0x1B, 0x18, 0x25, 0x38, 0xD7, 0xFF, 0x0F, 0x48, 0x07, 0x40, 0x06, 0x30, 0x29, 0x40, 0xDF, 0xFF, 0x0D, 0x40, 0x07, 0x38,
+    0x09, 0x38, 0x34, 0x30, 0xFF, 0xFF, 0x0A, 0x40, 0x2B, 0x48, 0x4F, 0x60, 0x0E, 0x48, 0x5F, 0xFF, 0xDB, 0x79, 0x0C, 0x50, 0x15, 0x60, 0x0B, 0x58, 0x5E, 0xE4, 0x2C, 0x60, 0x39, 0x7A, 0x11, 0x68, 0xD8, 0x88, 0x0C, 0x60, 0x13, 0x78, 0x09, 0x50, 0x2B, 0x68, 0x78, 0xD0, 0x18, 0xAA, 0x07, 0x50, 0x07, 0x50, 0x0C, 0x80, 0x18, 0xE0, 0x0B, 0x78, 0x07, 0x60, 0x09, 0x70, 0x10, 0x80, 0xB8, 0xF8,
+    0x0A, 0x88, 0x08, 0x80, 0x07, 0x70, 0x0A, 0x98, 0x08, 0x88, 0x09, 0x98, 0x05, 0x70, 0x09, 0x98, 0x2A, 0x90, 0x08, 0x88, 0xB1, 0xC9, 0x06, 0x80, 0x69, 0xA8, 0x4C, 0xD0, 0x48, 0xA0, 0x05, 0x78, 0x05, 0x80, 0x1F, 0xFD, 0x26, 0x90, 0x05, 0x78, 0x05, 0x80, 0x2A, 0xE0, 0x0C, 0xA8, 0x05, 0x80, 0x06, 0x90, 0x06, 0x88, 0xDF, 0xFF, 0x05, 0x90, 0x06, 0xA8, 0x45, 0x90, 0x45, 0x90, 0x47, 0xA0,
+    0x24, 0x30, 0x68, 0x38, 0x6B, 0x89, 0x46, 0x38, 0x1C, 0x18, 0x07, 0x38, 0x45, 0x38, 0x69, 0x99, 0x16, 0x38, 0x27, 0x38, 0x06, 0x38, 0x68, 0x58, 0xB0, 0xB0, 0x0D, 0x40, 0x08, 0x40, 0x07, 0x38, 0x16, 0x60, 0x33, 0xC1, 0x0A, 0x40, 0x0C, 0x48, 0x12, 0x50, 0x5C, 0x78, 0x73, 0xB8, 0x0C, 0x58, 0x2C, 0x50, 0x57, 0x68, 0x0D, 0x68, 0x37, 0xC8, 0x0A, 0x50, 0x19, 0x48, 0x0D, 0x60, 0x0C, 0x70,
+    0x0E, 0x70, 0x0E, 0x60, 0x12, 0x60, 0x6D, 0x78, 0x4D, 0x70, 0x0D, 0x68, 0x51, 0x90, 0x07, 0x50, 0x07, 0x50, 0x6D, 0x98, 0xBE, 0xF5, 0x0B, 0x70, 0x07, 0x60, 0x2D, 0x80, 0xD8, 0xC0, 0x9D, 0xE3, 0x2A, 0x88, 0x06, 0x70, 0x3F, 0xFF, 0x2B, 0x88, 0x70, 0xA0, 0x08, 0x78, 0xBF, 0xFE, 0x08, 0xA0, 0x2B, 0xA8, 0x51, 0x88, 0x08, 0xA0, 0xAF, 0xC8, 0x06, 0x80, 0x12, 0xD0, 0x26, 0xA0, 0x05, 0x78,
+    0x05, 0x70, 0x05, 0x78, 0xDF, 0xFF, 0x06, 0x80, 0x25, 0x80, 0x05, 0x80, 0x04, 0x90, 0xFF, 0xFF, 0x05, 0x88, 0x25, 0x80, 0x27, 0xC8, 0x06, 0x90, 0xFF, 0xFF, 0x0D, 0xE1, 0x25, 0x88, 0x05, 0x90, 0x24, 0x30, 0x25, 0x38, 0x05, 0x30, 0x7C, 0x20, 0x25, 0x30, 0x26, 0x38, 0x0B, 0x30, 0x9E, 0xCB, 0x26, 0x38, 0x26, 0x38, 0x07, 0x38, 0x6C, 0x50, 0x2A, 0x40, 0x07, 0x30, 0x69, 0x48, 0xFF, 0xEF,
+    0x5A, 0x98, 0x2B, 0x48, 0x0B, 0x38, 0x17, 0x50, 0x3F, 0xFD, 0x2C, 0x50, 0x7F, 0xFC, 0x0F, 0x50, 0x0E, 0x48, 0x11, 0x58, 0x4E, 0x68, 0x13, 0x78, 0x0A, 0x48, 0x1F, 0xF7, 0x11, 0x58, 0x6D, 0x68, 0x7F, 0xFF, 0xFF, 0xFF, 0x10, 0x70, 0x0A, 0x60, 0x2C, 0x60, 0x1E, 0xFD, 0x0C, 0x78, 0x07, 0x50, 0x07, 0x50, 0x2B, 0x80, 0xFF, 0xFF, 0x0C, 0x78, 0x28, 0x70, 0x08, 0x68, 0x0B, 0x78, 0x5F, 0xFF,
+    0x4C, 0x80, 0x07, 0x68, 0x07, 0x70, 0x09, 0x78, 0x9B, 0xE3, 0x09, 0x98, 0x06, 0x68, 0x08, 0x80, 0x0E, 0x98, 0x35, 0xE0, 0x48, 0xB0, 0x06, 0x78, 0x07, 0x80, 0x07, 0x88, 0x0E, 0xD9, 0x9F, 0xFD, 0x05, 0x70, 0x05, 0x70, 0x05, 0x88, 0x75, 0xF1, 0x07, 0xA8, 0x05, 0x78, 0x25, 0x78, 0x06, 0xA8, 0x89, 0xC8, 0x06, 0x90, 0x25, 0x80, 0xD3, 0xF2, 0x8E, 0xE0, 0xCA, 0xC0, 0x06, 0xA0, 0x27, 0xA0,
+    0x38, 0xDC, 0x33, 0x28, 0x25, 0x30, 0x25, 0x30, 0x25, 0x30, 0x53, 0x9A, 0x89, 0x48, 0x25, 0x30, 0x05, 0x30, 0x26, 0x30, 0xFF, 0xFF, 0x28, 0x40, 0x29, 0x38, 0x07, 0x30, 0x0F, 0x48, 0x32, 0x68, 0x0A, 0x38, 0x2C, 0x48, 0x15, 0x58, 0xDD, 0xB3, 0xCE, 0x68, 0x0A, 0x40, 0x52, 0x68, 0x0C, 0x50, 0x17, 0x80, 0x0B, 0x50, 0x70, 0x70, 0x0A, 0x48, 0x5C, 0x78, 0x0D, 0x58, 0x2D, 0x58, 0x4B, 0x58,
+    0x93, 0xA9, 0x17, 0xA0, 0x2D, 0x60, 0x0A, 0x58, 0x2C, 0x60, 0x0F, 0x70, 0x0C, 0x68, 0x07, 0x50, 0x07, 0x50, 0x4C, 0x80, 0x09, 0x60, 0x2A, 0x68, 0x28, 0x68, 0x08, 0x68, 0x0B, 0x78, 0x0A, 0x70, 0x29, 0x68, 0x58, 0xC1, 0x08, 0x78, 0x29, 0x70, 0x09, 0x80, 0x9D, 0xF0, 0x06, 0x78, 0x3F, 0xF3, 0x09, 0x78, 0x1B, 0xDA, 0x06, 0x78, 0x0C, 0x98, 0x08, 0x88, 0x06, 0x80, 0x06, 0x80, 0x0B, 0x90,
+    0xDF, 0xFE, 0x05, 0x68, 0x05, 0x78, 0x26, 0x80, 0xDB, 0xDB, 0x04, 0x70, 0x05, 0x78, 0x05, 0x78, 0x0F, 0xE1, 0x1B, 0xEB, 0x05, 0x80, 0x25, 0x78, 0x46, 0x88, 0x06, 0x90, 0x18, 0xEB, 0x25, 0x90, 0x04, 0x28, 0x04, 0x28, 0x25, 0x30, 0x45, 0x30, 0xC8, 0x70, 0x46, 0x38, 0x05, 0x30, 0x25, 0x30, 0x46, 0x38, 0x09, 0x50, 0x27, 0x38, 0x07, 0x30, 0x28, 0x40, 0x08, 0x38, 0x09, 0x38, 0x09, 0x38,
+    0x0A, 0x38, 0x0A, 0x48, 0x0C, 0x38, 0x0A, 0x40, 0x0A, 0x38, 0x0A, 0x40, 0x0D, 0x38, 0x0B, 0x58, 0x0B, 0x48, 0x0B, 0x48, 0x0C, 0x48, 0x09, 0x40, 0x0B, 0x48, 0x0B, 0x50, 0x0F, 0x40, 0x2B, 0x50, 0x0B, 0x50, 0x0B, 0x50, 0x2D, 0x58, 0x0A, 0x58, 0x2B, 0x58, 0x0C, 0x58, 0x0D, 0x50, 0x07, 0x48, 0x08, 0x50, 0x0B, 0x68, 0x7F, 0xFF, 0x2A, 0x60, 0x08, 0x68, 0x2A, 0x60, 0x0C, 0x60, 0x0A, 0x68,
+    0x29, 0x68, 0x07, 0x60, 0x08, 0x70, 0xFF, 0xFE, 0x08, 0x70, 0x08, 0x78, 0x07, 0x80, 0x09, 0x70, 0x0A, 0x78, 0x2A, 0x88, 0x06, 0x70, 0x06, 0x70, 0x15, 0xDA, 0x2B, 0xA0, 0x05, 0x70, 0x05, 0x70, 0x05, 0x70, 0xFF, 0xF7, 0x05, 0x70, 0x05, 0x70, 0x25, 0x78, 0x0D, 0xE0, 0x88, 0xA0, 0x05, 0x78, 0x05, 0x70, 0x05, 0x78, 0xB9, 0xF4, 0x05, 0x80, 0x25, 0x78, 0x25, 0x78, 0x46, 0x88, 0x47, 0x98,
+    0x44, 0x30, 0x24, 0x28, 0x45, 0x30, 0xCC, 0x82, 0x45, 0x30, 0x25, 0x30, 0x45, 0x38, 0x25, 0x30, 0xB4, 0xE6, 0x27, 0x30, 0x27, 0x38, 0x07, 0x30, 0x29, 0x38, 0xBC, 0xA1, 0x09, 0x30, 0x09, 0x38, 0x0A, 0x38, 0x9B, 0x58, 0xFF, 0xFF, 0x0B, 0x38, 0x0A, 0x38, 0x3F, 0x79, 0x0B, 0x40, 0x1D, 0xC8, 0x0B, 0x48, 0x36, 0x78, 0x0B, 0x48, 0x09, 0x48, 0x13, 0x50, 0x19, 0x61, 0x4B, 0x58, 0x0B, 0x50,
+    0x7E, 0xD4, 0x0D, 0x60, 0x0B, 0x50, 0x09, 0x50, 0x0B, 0x50, 0x9F, 0xFD, 0x0C, 0x58, 0x07, 0x48, 0x07, 0x48, 0x0B, 0x78, 0xFF, 0xF7, 0x0A, 0x60, 0x08, 0x68, 0x09, 0x60, 0x33, 0xA8, 0x78, 0xB9, 0x09, 0x68, 0x07, 0x60, 0x39, 0xC1, 0x0A, 0x78, 0x09, 0x80, 0x07, 0x70, 0x11, 0xB0, 0x07, 0x70, 0x0C, 0x80, 0x07, 0x78, 0x09, 0xA0, 0x06, 0x70, 0x06, 0x78, 0xB1, 0xD8, 0x69, 0xA0, 0x05, 0x68,
+    0x05, 0x68, 0x05, 0x68, 0x07, 0x98, 0x05, 0x68, 0x04, 0x68, 0x05, 0x70, 0xA8, 0x98, 0x05, 0x78, 0x04, 0x68, 0x04, 0x68, 0x25, 0x70, 0x49, 0xA8, 0x05, 0x78, 0x25, 0x80, 0x25, 0x78, 0x25, 0x80, 0x24, 0x28, 0xA5, 0x38, 0x0B, 0x8A, 0x24, 0x28, 0x24, 0x28, 0x45, 0x30, 0x65, 0x38, 0xEC, 0x8A, 0x86, 0x40, 0x26, 0x30, 0x67, 0x38, 0x47, 0x40, 0xF3, 0x88, 0xAA, 0x50, 0x0A, 0x30, 0x09, 0x30,
+    0x2F, 0x60, 0xD3, 0xB1, 0x0A, 0x38, 0x0A, 0x38, 0x5C, 0xB9, 0xF3, 0xA9, 0xB4, 0xB8, 0x0A, 0x40, 0x31, 0x58, 0x0D, 0x50, 0x6F, 0x89, 0x14, 0xA0, 0x0A, 0x50, 0x56, 0x70, 0x09, 0x48, 0x0B, 0x50, 0x0C, 0x58, 0x18, 0x78, 0x2C, 0x58, 0x09, 0x48, 0x0A, 0x50, 0x0E, 0x78, 0x0B, 0x60, 0x07, 0x48, 0x07, 0x48, 0x0B, 0x68, 0x0B, 0x68, 0x09, 0x58, 0x08, 0x60, 0x0A, 0x60, 0x8D, 0x90, 0x0B, 0x78,
+    0x09, 0x68, 0x68, 0x68, 0x08, 0x70, 0x09, 0x70, 0x09, 0x70, 0x06, 0x70, 0x07, 0x80, 0x08, 0x78, 0x2A, 0x80, 0x08, 0x70, 0x07, 0x78, 0x26, 0x70, 0x06, 0x70, 0x08, 0x80, 0x06, 0x70, 0x05, 0x68, 0x05, 0x70, 0x05, 0x68, 0xDD, 0xEA, 0x26, 0x68, 0x04, 0x60, 0x05, 0x60, 0x05, 0x70, 0x33, 0xB8, 0x25, 0x70, 0x04, 0x68, 0x04, 0x68, 0x05, 0x70, 0xFD, 0xE2, 0x05, 0x78, 0x25, 0x78, 0x25, 0x78,
+    0x86, 0x38, 0x85, 0x38, 0x44, 0x30, 0x44, 0x30, 0x24, 0x28, 0x66, 0x40, 0x45, 0x30, 0x25, 0x30, 0x46, 0x30, 0x46, 0x30, 0x27, 0x40, 0x07, 0x30, 0x28, 0x30, 0x09, 0x30, 0x09, 0x30, 0x09, 0x30, 0x0B, 0x38, 0x2B, 0x40, 0x0A, 0x30, 0x0B, 0x38, 0x0E, 0x48, 0x09, 0x40, 0xDF, 0xFB, 0x0C, 0x40, 0x0B, 0x48, 0x0A, 0x40, 0x09, 0x40, 0xBF, 0xA8, 0x0A, 0x40, 0x09, 0x40, 0x09, 0x40, 0x0A, 0x48,
+    0x5F, 0xFE, 0x0A, 0x40, 0x09, 0x48, 0x08, 0x48, 0x0A, 0x48, 0x9F, 0xFD, 0x0A, 0x50, 0x07, 0x48, 0x07, 0x48, 0x0B, 0x60, 0xDF, 0xFF, 0x09, 0x50, 0x07, 0x58, 0x2A, 0x60, 0xFF, 0xFC, 0xFF, 0xFF, 0x0A, 0x70, 0x07, 0x60, 0x08, 0x60, 0x09, 0x70, 0x7E, 0xF5, 0x07, 0x68, 0x06, 0x70, 0x7F, 0xFE, 0x27, 0x70, 0x16, 0xB8, 0x07, 0x68, 0x5F, 0xFE, 0x05, 0x68, 0x06, 0x70, 0x2E, 0xA8, 0x0D, 0xA0,
+    0x06, 0x78, 0x05, 0x68, 0x06, 0x68, 0x8E, 0xB8, 0xAF, 0xB0, 0x04, 0x58, 0x04, 0x58, 0x05, 0x70, 0x2D, 0xD0, 0x05, 0x68, 0x24, 0x68, 0x24, 0x68, 0x06, 0x70, 0x31, 0xE0, 0x25, 0x78, 0x05, 0x78, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x25, 0x28, 0x65, 0x20, 0x25, 0x30, 0x25, 0x30, 0x4B, 0x61, 0x67, 0x40, 0xF4, 0x69, 0x28, 0x30, 0x29, 0x40, 0x09, 0x30, 0x0C, 0x38, 0x0C, 0x30,
+    0x09, 0x38, 0x2A, 0x48, 0x0A, 0x30, 0x1F, 0x99, 0x0D, 0x38, 0x0A, 0x40, 0x0B, 0x40, 0x2E, 0x40, 0x3D, 0xB5, 0x08, 0x40, 0x09, 0x40, 0x09, 0x40, 0x1F, 0xC4, 0x09, 0x40, 0x09, 0x40, 0x09, 0x40, 0x0A, 0x48, 0xFF, 0xFF, 0x08, 0x48, 0x08, 0x48, 0x0A, 0x50, 0x7B, 0x71, 0x0A, 0x48, 0x07, 0x40, 0x07, 0x48, 0x0B, 0x68, 0xF8, 0x88, 0x08, 0x50, 0x08, 0x60, 0x0A, 0x60, 0x31, 0x70, 0x08, 0x68,
+    0x0A, 0x78, 0x08, 0x68, 0x06, 0x60, 0x15, 0xA8, 0x08, 0x60, 0x07, 0x68, 0x06, 0x70, 0x0D, 0x78, 0x29, 0x78, 0x07, 0x68, 0x06, 0x68, 0x88, 0x88, 0xAD, 0xC0, 0x06, 0x68, 0x06, 0x68, 0x0C, 0x78, 0x06, 0x78, 0x05, 0x68, 0x04, 0x60, 0x05, 0x60, 0x05, 0x60, 0x04, 0x60, 0x04, 0x60, 0x04, 0x60, 0x04, 0x60, 0x0A, 0x78, 0x24, 0x68, 0x04, 0x60, 0x24, 0x68, 0x25, 0x70, 0x4C, 0xB0, 0x25, 0x78,
+    0x44, 0x28, 0x23, 0x28, 0x44, 0x28, 0x49, 0x61, 0x8A, 0x69, 0x24, 0x30, 0x25, 0x30, 0x04, 0x28, 0x6A, 0x61, 0x29, 0x59, 0x47, 0x38, 0x08, 0x30, 0x08, 0x30, 0xED, 0x50, 0x08, 0x38, 0x0C, 0x38, 0x09, 0x30, 0x29, 0x48, 0xF2, 0x88, 0x0B, 0x40, 0x08, 0x38, 0x08, 0x38, 0x09, 0x30, 0x33, 0x90, 0x0A, 0x48, 0x08, 0x40, 0x09, 0x40, 0x09, 0x40, 0x0A, 0x48, 0x08, 0x40, 0x09, 0x48, 0x09, 0x48,
+    0x09, 0x48, 0x08, 0x40, 0x09, 0x48, 0x08, 0x40, 0x09, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x07, 0x40, 0x07, 0x48, 0x2B, 0x60, 0x0C, 0x78, 0x08, 0x50, 0x08, 0x58, 0x2B, 0x68, 0x09, 0x58, 0x08, 0x60, 0x09, 0x78, 0x29, 0x70, 0x07, 0x60, 0x08, 0x68, 0x08, 0x60, 0x07, 0x70, 0x06, 0x68, 0x07, 0x68, 0x07, 0x60, 0x06, 0x68, 0x05, 0x68, 0x04, 0x60, 0x38, 0xC9, 0x06, 0x60, 0x05, 0x68, 0x05, 0x68,
+    0x05, 0x70, 0x0D, 0x98, 0x05, 0x68, 0x87, 0x78, 0x04, 0x60, 0xD5, 0xC1, 0x24, 0x58, 0x04, 0x58, 0x24, 0x58, 0x24, 0x58, 0x76, 0xD8, 0x24, 0x60, 0x24, 0x60, 0x24, 0x68, 0x24, 0x68, 0x06, 0x70, 0x23, 0x28, 0x43, 0x28, 0x44, 0x28, 0x44, 0x28, 0x24, 0x28, 0x25, 0x28, 0x04, 0x28, 0x04, 0x28, 0x86, 0x30, 0x46, 0x30, 0x47, 0x30, 0x09, 0x30, 0x09, 0x30, 0x09, 0x30, 0x0B, 0x30, 0x0B, 0x38,
+    0x0A, 0x38, 0x08, 0x38, 0x7F, 0xD7, 0x0C, 0x38, 0x0A, 0x38, 0x0B, 0x40, 0x2C, 0x40, 0x0E, 0x40, 0x0A, 0x40, 0x0A, 0x40, 0x0C, 0x40, 0x0C, 0x48, 0x0B, 0x48, 0x09, 0x48, 0x0B, 0x40, 0x0B, 0x48, 0xFF, 0x91, 0x0B, 0x48, 0x4C, 0x60, 0x08, 0x48, 0x08, 0x40, 0x3F, 0xFD, 0x0C, 0x58, 0x08, 0x48, 0x07, 0x50, 0x2C, 0x68, 0xBF, 0xFD, 0x07, 0x50, 0x07, 0x58, 0x0A, 0x68, 0x09, 0x58, 0xFF, 0xFF,
+    0x08, 0x78, 0x09, 0x78, 0x06, 0x70, 0x0C, 0x80, 0x0A, 0x68, 0x08, 0x68, 0x06, 0x68, 0x07, 0x60, 0x14, 0xA8, 0x08, 0x68, 0x06, 0x70, 0x06, 0x68, 0x06, 0x70, 0x0D, 0x88, 0x06, 0x60, 0x05, 0x68, 0x06, 0x70, 0x26, 0x80, 0x32, 0x98, 0x05, 0x58, 0x04, 0x50, 0x04, 0x50, 0x05, 0x60, 0xA7, 0x80, 0x04, 0x50, 0x03, 0x50, 0x24, 0x58, 0x06, 0x78, 0x05, 0x60, 0x24, 0x60, 0x24, 0x60, 0x24, 0x68,
+    0x44, 0x28, 0xC4, 0x28, 0xAA, 0x61, 0x03, 0x28, 0x24, 0x28, 0x25, 0x28, 0x44, 0x30, 0x4E, 0x7B, 0x05, 0x30, 0x27, 0x28, 0x48, 0x30, 0x08, 0x38, 0xF0, 0x70, 0x49, 0x40, 0x0A, 0x30, 0x0B, 0x38, 0x0A, 0x38, 0x11, 0x81, 0x70, 0x69, 0x0B, 0x38, 0x0B, 0x40, 0x0A, 0x40, 0x53, 0x90, 0x0C, 0x48, 0x0A, 0x40, 0x0B, 0x40, 0xF0, 0x78, 0xB5, 0xA0, 0x0A, 0x48, 0x0A, 0x40, 0x0D, 0x48, 0x09, 0x48,
+    0x0F, 0x78, 0x0B, 0x40, 0x2C, 0x50, 0x08, 0x48, 0x08, 0x40, 0x0C, 0x68, 0x0C, 0x50, 0x07, 0x48, 0x07, 0x48, 0x0B, 0x60, 0xF4, 0xB9, 0x07, 0x50, 0x07, 0x58, 0x0A, 0x68, 0x08, 0x58, 0x4A, 0x88, 0x08, 0x78, 0x09, 0x70, 0x07, 0x68, 0x07, 0x78, 0x09, 0x70, 0x08, 0x68, 0x06, 0x70, 0x06, 0x70, 0x08, 0x78, 0x08, 0x60, 0x06, 0x78, 0x05, 0x68, 0x06, 0x70, 0x06, 0x68, 0x06, 0x60, 0x05, 0x70,
+    0x25, 0x70, 0x05, 0x70, 0x06, 0x70, 0x05, 0x60, 0x04, 0x60, 0x04, 0x58, 0x04, 0x58, 0x05, 0x58, 0x23, 0x50, 0x23, 0x50, 0x24, 0x50, 0x25, 0x60, 0xDC, 0xC8, 0x24, 0x60, 0x44, 0x68, 0x24, 0x68, 0x43, 0x28, 0x64, 0x28, 0x44, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x30, 0x45, 0x30, 0x25, 0x30, 0x07, 0x28, 0x27, 0x30, 0x28, 0x30, 0x2A, 0x30, 0x09, 0x30, 0x0A, 0x38, 0x0A, 0x38,
+    0x0A, 0x38, 0x0A, 0x38, 0x2B, 0x40, 0x0B, 0x38, 0x0B, 0x38, 0x0C, 0x38, 0x98, 0x7A, 0x0A, 0x40, 0x09, 0x40, 0x0C, 0x40, 0x0C, 0x48, 0x7F, 0xA0, 0x09, 0x48, 0x0D, 0x48, 0x0C, 0x40, 0x0A, 0x48, 0x1F, 0xFF, 0x0B, 0x48, 0x09, 0x50, 0x08, 0x50, 0x08, 0x40, 0x5F, 0xF3, 0x0B, 0x50, 0x07, 0x48, 0x07, 0x48, 0x0A, 0x60, 0x5F, 0xFF, 0x08, 0x50, 0x07, 0x60, 0x09, 0x60, 0x0A, 0x60, 0xFF, 0xFF,
+    0x08, 0x80, 0x09, 0x70, 0x09, 0x78, 0x07, 0x70, 0xDF, 0xFF, 0x09, 0x68, 0x08, 0x78, 0x26, 0x70, 0x07, 0x70, 0xBF, 0xE4, 0x07, 0x78, 0x05, 0x70, 0x06, 0x70, 0x05, 0x60, 0x4F, 0xA0, 0x27, 0x80, 0x05, 0x70, 0x05, 0x70, 0x05, 0x68, 0x11, 0xB0, 0x05, 0x60, 0x04, 0x58, 0x25, 0x58, 0x04, 0x50, 0x2D, 0xB0, 0x24, 0x50, 0x23, 0x50, 0x24, 0x50, 0x03, 0x58, 0x2D, 0xA8, 0x03, 0x60, 0x23, 0x58,
 };
 const lv_img_dsc_t ui_img_spectrum_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_spectrum_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_spectrum_80_png_data
 };
 
@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Starfield_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_starfield_80_png_data[] = {
-    0xE2, 0x31, 0xFF, 0x23, 0x42, 0xFF, 0x24, 0x42, 0xFF, 0x23, 0x3A, 0xFF, 0xE3, 0x39, 0xFF, 0x03, 0x42, 0xFF, 0xE3, 0x39, 0xFF, 0x23, 0x42, 0xFF, 0x44, 0x42, 0xFF, 0xA4, 0x4A, 0xFF, 0xA5, 0x52, 0xFF, 0x43, 0x42, 0xFF, 0x63, 0x4A, 0xFF, 0xE4, 0x5A, 0xFF, 0x0D, 0xBE, 0xFF, 0xB2, 0xE7, 0xFF, 0x65, 0x6B, 0xFF, 0xE7, 0x73, 0xFF, 0x86, 0x6B, 0xFF, 0xC4, 0x52, 0xFF, 0x2D, 0xC6, 0xFF, 0xE8, 0x7B, 0xFF, 0x86, 0x73, 0xFF, 0x28, 0x8C, 0xFF, 0xE8, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xC5, 0xFF, 0xCD, 0xBD, 0xFF, 0x28, 0x84, 0xFF, 0x6E, 0xCE, 0xFF, 0xA7, 0x9C, 0xFF, 0x6B, 0xB5, 0xFF, 0x27, 0x8C, 0xFF, 0x07, 0x84, 0xFF, 0x48, 0x94, 0xFF, 0xA9, 0x9C, 0xFF, 0x6F, 0xF7, 0xFF, 0xAB, 0xB5, 0xFF, 0xE7, 0x7B, 0xFF, 0xE7, 0x73, 0xFF, 0x08, 0x7C, 0xFF, 0x8D, 0xD6, 0xFF, 0x07, 0x7C, 0xFF, 0x27, 0x7C, 0xFF, 0x48, 0x84, 0xFF, 0x07, 0x7C, 0xFF, 0x8D, 0xCE, 0xFF, 0x2A, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xBD, 0xFF, 0x09, 0x9D, 0xFF, 0xCE, 0xDE, 0xFF, 0xFA, 0xF7, 0xFF, 0xC6, 0x73, 0xFF, 0xE7, 0x7B, 0xFF, 0xE7, 0x73, 0xFF, 0x8D, 0xD6, 0xFF, 0xC7, 0x73, 0xFF, 0x05, 0x5B, 0xFF, 0x05, 0x5B, 0xFF, 0x06, 0x5B, 0xFF, 0xA4, 0x4A, 0xFF, 0x8B, 0xA5, 0xFF,
-    0xA5, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0xE7, 0x7B, 0xFF, 0x88, 0x8C, 0xFF, 0xE5, 0x52, 0xFF, 0xE4, 0x4A, 0xFF, 0xA4, 0x4A, 0xFF, 0xE5, 0x4A, 0xFF, 0xAF, 0xCE, 0xFF, 0x25, 0x5B, 0xFF, 0xC5, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0xE4, 0x52, 0xFF, 0xE4, 0x52, 0xFF, 0x67, 0x84, 0xFF, 0x03, 0x3A, 0xFF, 0x03, 0x3A, 0xFF, 0xA4, 0x4A, 0xFF, 0x24, 0x42, 0xFF, 0x44, 0x42, 0xFF, 0xE8, 0x7B, 0xFF, 0x43, 0x42, 0xFF, 0x44, 0x42, 0xFF, 0xC6, 0x52, 0xFF, 0x84, 0x4A, 0xFF, 0x2C, 0xA5, 0xFF, 0xA5, 0x52, 0xFF, 0xE5, 0x5A, 0xFF, 0xE5, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0x08, 0x7C, 0xFF, 0xC6, 0x6B, 0xFF, 0x46, 0x63, 0xFF, 0x05, 0x5B, 0xFF, 0x66, 0x6B, 0xFF, 0x46, 0x63, 0xFF, 0x25, 0x5B, 0xFF, 0x46, 0x6B, 0xFF, 0x46, 0x6B, 0xFF, 0xE6, 0x7B, 0xFF, 0xA8, 0x94, 0xFF, 0xA9, 0x9C, 0xFF, 0xA6, 0x73, 0xFF, 0x86, 0x73, 0xFF, 0xC6, 0x73, 0xFF, 0xC7, 0x73, 0xFF, 0x07, 0x84, 0xFF, 0x48, 0x8C, 0xFF, 0x07, 0x7C, 0xFF, 0x68, 0x84, 0xFF, 0xCA, 0x9C, 0xFF, 0xF4, 0xFF, 0xFF, 0x6A, 0xB5, 0xFF, 0x48, 0x84, 0xFF, 0x28, 0x7C, 0xFF, 0x27, 0x84, 0xFF, 0x91, 0xEF, 0xFF, 0x07, 0x7C, 0xFF, 0x07, 0x7C, 0xFF, 0x28, 0x7C, 0xFF, 0x88, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0x8B, 0xAD, 0xFF,
-    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0xAD, 0xFF, 0xA9, 0x8C, 0xFF, 0x48, 0x84, 0xFF, 0xE9, 0x9C, 0xFF, 0x07, 0x7C, 0xFF, 0xE7, 0x73, 0xFF, 0xC6, 0x73, 0xFF, 0xC6, 0x73, 0xFF, 0x65, 0x63, 0xFF, 0x25, 0x5B, 0xFF, 0x05, 0x5B, 0xFF, 0xE4, 0x5A, 0xFF, 0xA4, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0xA5, 0x4A, 0xFF, 0x06, 0x5B, 0xFF, 0xA4, 0x4A, 0xFF, 0xA4, 0x4A, 0xFF, 0x83, 0x42, 0xFF, 0xC4, 0x4A, 0xFF, 0xE5, 0x52, 0xFF, 0xE4, 0x52, 0xFF, 0xA3, 0x42, 0xFF, 0x05, 0x5B, 0xFF, 0xC4, 0x52, 0xFF, 0xC4, 0x4A, 0xFF, 0xC5, 0x4A, 0xFF, 0x08, 0x74, 0xFF, 0x84, 0x4A, 0xFF, 0xE7, 0x73, 0xFF, 0x44, 0x42, 0xFF, 0x85, 0x52, 0xFF, 0x64, 0x4A, 0xFF, 0x05, 0x5B, 0xFF, 0xC7, 0x73, 0xFF, 0x63, 0x4A, 0xFF, 0x85, 0x52, 0xFF, 0x64, 0x4A, 0xFF, 0x64, 0x4A, 0xFF, 0x6A, 0x8C, 0xFF, 0xC9, 0x7B, 0xFF, 0xE5, 0x5A, 0xFF, 0xA9, 0x74, 0xFF, 0x08, 0x7C, 0xFF, 0xA9, 0x94, 0xFF, 0x29, 0xA5, 0xFF, 0xC7, 0x6B, 0xFF, 0x46, 0x63, 0xFF, 0x25, 0x63, 0xFF, 0x45, 0x63, 0xFF, 0xD5, 0xFF, 0xFF, 0x46, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0x65, 0x6B, 0xFF, 0xFE, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0x7B, 0xFF, 0xE7, 0x7B, 0xFF, 0xA6, 0x7B, 0xFF, 0xC6, 0x73, 0xFF, 0x2F, 0xEF, 0xFF,
-    0x28, 0x84, 0xFF, 0x67, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0x88, 0x8C, 0xFF, 0xED, 0xE6, 0xFF, 0x6B, 0xBD, 0xFF, 0x68, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0x69, 0x84, 0xFF, 0xAE, 0xD6, 0xFF, 0x48, 0x84, 0xFF, 0x88, 0x8C, 0xFF, 0xA9, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0x8D, 0xCE, 0xFF, 0x0C, 0xBE, 0xFF, 0xDF, 0xFF, 0xFF, 0xCC, 0xCE, 0xFF, 0x8A, 0xAD, 0xFF, 0x4E, 0xEF, 0xFF, 0x88, 0x8C, 0xFF, 0xA9, 0x94, 0xFF, 0x48, 0x84, 0xFF, 0x07, 0x7C, 0xFF, 0x09, 0x9D, 0xFF, 0x12, 0xDF, 0xFF, 0xA6, 0x73, 0xFF, 0x25, 0x5B, 0xFF, 0x05, 0x5B, 0xFF, 0xE4, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0x84, 0x4A, 0xFF, 0x06, 0x5B, 0xFF, 0xA5, 0x4A, 0xFF, 0xA5, 0x4A, 0xFF, 0x28, 0x7C, 0xFF, 0x05, 0x53, 0xFF, 0xA4, 0x4A, 0xFF, 0xE5, 0x4A, 0xFF, 0xE4, 0x4A, 0xFF, 0x28, 0x74, 0xFF, 0x05, 0x5B, 0xFF, 0xE4, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0xC4, 0x4A, 0xFF, 0x86, 0x63, 0xFF, 0xA4, 0x4A, 0xFF, 0xE4, 0x4A, 0xFF, 0x03, 0x3A, 0xFF, 0xA3, 0x62, 0xFF, 0x64, 0x4A, 0xFF, 0x44, 0x42, 0xFF, 0xC5, 0x52, 0xFF, 0x85, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0x64, 0x4A, 0xFF, 0x85, 0x52, 0xFF, 0x06, 0x63, 0xFF, 0xE5, 0x5A, 0xFF, 0xE5, 0x5A, 0xFF, 0x65, 0x6B, 0xFF, 0x88, 0x84, 0xFF, 0x07, 0x74, 0xFF,
-    0xCA, 0x8C, 0xFF, 0x87, 0x6B, 0xFF, 0x45, 0x63, 0xFF, 0xA8, 0x73, 0xFF, 0x46, 0x6B, 0xFF, 0x46, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0xC7, 0x7B, 0xFF, 0x0A, 0x9D, 0xFF, 0x48, 0x84, 0xFF, 0x89, 0x8C, 0xFF, 0x69, 0x8C, 0xFF, 0xE7, 0x7B, 0xFF, 0x07, 0x84, 0xFF, 0x71, 0xEF, 0xFF, 0x07, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0x88, 0x8C, 0xFF, 0x0A, 0xA5, 0xFF, 0xF8, 0xFF, 0xFF, 0x8A, 0xBD, 0xFF, 0x68, 0x8C, 0xFF, 0x69, 0x84, 0xFF, 0x88, 0x8C, 0xFF, 0xEC, 0xBD, 0xFF, 0x27, 0x84, 0xFF, 0xFC, 0xFF, 0xFF, 0x88, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0x6E, 0xC6, 0xFF, 0x69, 0xA5, 0xFF, 0x4C, 0xCE, 0xFF, 0x2C, 0xBE, 0xFF, 0x8A, 0xAD, 0xFF, 0xF3, 0xFF, 0xFF, 0xC9, 0xA4, 0xFF, 0x2A, 0xAD, 0xFF, 0x68, 0x8C, 0xFF, 0x28, 0x84, 0xFF, 0xAD, 0xD6, 0xFF, 0xA6, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0x45, 0x63, 0xFF, 0xE4, 0x52, 0xFF, 0xA6, 0x73, 0xFF, 0xA5, 0x52, 0xFF, 0xA4, 0x52, 0xFF, 0xC5, 0x52, 0xFF, 0x26, 0x5B, 0xFF, 0xA3, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0xC4, 0x4A, 0xFF, 0xC4, 0x52, 0xFF, 0xA4, 0x4A, 0xFF, 0x48, 0x7C, 0xFF, 0x05, 0x53, 0xFF, 0xE4, 0x52, 0xFF, 0xC4, 0x52, 0xFF, 0xA4, 0x4A, 0xFF, 0xA9, 0x8C, 0xFF, 0xA3, 0x4A, 0xFF, 0xC4, 0x52, 0xFF, 0xE5, 0x52, 0xFF,
-    0xE3, 0x39, 0xFF, 0xE2, 0x39, 0xFF, 0x46, 0x6B, 0xFF, 0xC5, 0x52, 0xFF, 0x84, 0x4A, 0xFF, 0xA5, 0x52, 0xFF, 0xE9, 0x73, 0xFF, 0x67, 0x8C, 0xFF, 0xC5, 0x52, 0xFF, 0xC6, 0x5A, 0xFF, 0x85, 0x52, 0xFF, 0xAB, 0x8C, 0xFF, 0xE9, 0x94, 0xFF, 0xE8, 0x7B, 0xFF, 0x86, 0x6B, 0xFF, 0x2C, 0xAD, 0xFF, 0xE6, 0x7B, 0xFF, 0x0B, 0xA5, 0xFF, 0x25, 0x5B, 0xFF, 0x26, 0x5B, 0xFF, 0xFE, 0xFF, 0xFF, 0x4B, 0xAD, 0xFF, 0x25, 0x6B, 0xFF, 0x87, 0x73, 0xFF, 0x86, 0x73, 0xFF, 0x27, 0x84, 0xFF, 0x2E, 0xBE, 0xFF, 0xA7, 0x73, 0xFF, 0xE7, 0x7B, 0xFF, 0x07, 0x84, 0xFF, 0x48, 0x8C, 0xFF, 0x50, 0xEF, 0xFF, 0x8C, 0xB5, 0xFF, 0xA8, 0x8C, 0xFF, 0xE9, 0x9C, 0xFF, 0xA8, 0x94, 0xFF, 0x8E, 0xD6, 0xFF, 0xC9, 0x9C, 0xFF, 0x68, 0x8C, 0xFF, 0x27, 0x84, 0xFF, 0xA9, 0x94, 0xFF, 0xEE, 0xE6, 0xFF, 0x88, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x94, 0xFF, 0xC9, 0x94, 0xFF, 0xCE, 0xDE, 0xFF, 0x6B, 0xAD, 0xFF, 0x2D, 0xC6, 0xFF, 0xEB, 0xB5, 0xFF, 0xAB, 0xB5, 0xFF, 0xF2, 0xFF, 0xFF, 0x0D, 0xCE, 0xFF, 0x2A, 0xAD, 0xFF, 0x89, 0x8C, 0xFF, 0x06, 0x7C, 0xFF, 0xC6, 0x73, 0xFF, 0x27, 0x84, 0xFF, 0x86, 0x6B, 0xFF, 0x65, 0x63, 0xFF, 0x85, 0x6B, 0xFF, 0xE5, 0x5A, 0xFF, 0xC4, 0x52, 0xFF, 0xE5, 0x52, 0xFF,
-    0xC4, 0x52, 0xFF, 0xEA, 0x94, 0xFF, 0xA4, 0x4A, 0xFF, 0xC4, 0x52, 0xFF, 0xC4, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0xCA, 0x8C, 0xFF, 0xE5, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0x05, 0x53, 0xFF, 0xA4, 0x4A, 0xFF, 0xA4, 0x4A, 0xFF, 0xC4, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0xE5, 0x52, 0xFF, 0x05, 0x53, 0xFF, 0xE3, 0x39, 0xFF, 0x23, 0x42, 0xFF, 0xE2, 0x31, 0xFF, 0xE7, 0x73, 0xFF, 0x05, 0x5B, 0xFF, 0xC5, 0x52, 0xFF, 0x06, 0x5B, 0xFF, 0xA5, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0x89, 0x8C, 0xFF, 0xA5, 0x52, 0xFF, 0xC5, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0x87, 0x6B, 0xFF, 0x29, 0xA5, 0xFF, 0x13, 0xDF, 0xFF, 0x28, 0x7C, 0xFF, 0x66, 0x63, 0xFF, 0x66, 0x63, 0xFF, 0x46, 0x6B, 0xFF, 0x4E, 0xC6, 0xFF, 0x46, 0x63, 0xFF, 0x86, 0x73, 0xFF, 0x86, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0x6F, 0xF7, 0xFF, 0x68, 0x84, 0xFF, 0xC6, 0x73, 0xFF, 0x07, 0x7C, 0xFF, 0x48, 0x8C, 0xFF, 0xFB, 0xFF, 0xFF, 0x4B, 0xBD, 0xFF, 0xC9, 0x9C, 0xFF, 0xC9, 0x9C, 0xFF, 0x2A, 0xA5, 0xFF, 0xA8, 0x94, 0xFF, 0xF2, 0xFF, 0xFF, 0x49, 0xAD, 0xFF, 0x89, 0x94, 0xFF, 0xA9, 0x94, 0xFF, 0x09, 0x9D, 0xFF, 0x91, 0xF7, 0xFF, 0xA9, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x8C, 0xFF, 0xC9, 0x94, 0xFF, 0x09, 0x9D, 0xFF, 0xAB, 0xB5, 0xFF,
-    0xEC, 0xBD, 0xFF, 0x6D, 0xCE, 0xFF, 0x4F, 0xEF, 0xFF, 0x90, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAD, 0xFF, 0x0A, 0x9D, 0xFF, 0x87, 0x94, 0xFF, 0x28, 0x7C, 0xFF, 0x8A, 0xAD, 0xFF, 0xA6, 0x73, 0xFF, 0x46, 0x63, 0xFF, 0xCA, 0xAD, 0xFF, 0x08, 0x7C, 0xFF, 0x46, 0x63, 0xFF, 0x45, 0x63, 0xFF, 0xE5, 0x52, 0xFF, 0x08, 0x74, 0xFF, 0x06, 0x5B, 0xFF, 0xC4, 0x4A, 0xFF, 0x48, 0x84, 0xFF, 0xC4, 0x4A, 0xFF, 0x67, 0x63, 0xFF, 0xC4, 0x52, 0xFF, 0x06, 0x5B, 0xFF, 0x43, 0x42, 0xFF, 0x07, 0x7C, 0xFF, 0x05, 0x53, 0xFF, 0xE5, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0x05, 0x53, 0xFF, 0x86, 0x6B, 0xFF, 0x03, 0x42, 0xFF, 0x44, 0x42, 0xFF, 0x43, 0x42, 0xFF, 0xC5, 0x52, 0xFF, 0xE8, 0x73, 0xFF, 0xE5, 0x52, 0xFF, 0xE5, 0x5A, 0xFF, 0x84, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0xA8, 0x94, 0xFF, 0x43, 0x4A, 0xFF, 0x06, 0x63, 0xFF, 0x05, 0x5B, 0xFF, 0xC6, 0x73, 0xFF, 0xCB, 0x9C, 0xFF, 0xE9, 0x9C, 0xFF, 0x0C, 0xBE, 0xFF, 0xEB, 0x9C, 0xFF, 0xCA, 0x9C, 0xFF, 0x8C, 0xAD, 0xFF, 0x29, 0xA5, 0xFF, 0xA7, 0x73, 0xFF, 0x0A, 0xA5, 0xFF, 0xC7, 0x7B, 0xFF, 0xC7, 0x7B, 0xFF, 0xA6, 0x73, 0xFF, 0x28, 0x84, 0xFF, 0x6E, 0xCE, 0xFF, 0x48, 0x8C, 0xFF, 0x89, 0x94, 0xFF, 0xCB, 0xC5, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xCC, 0xCD, 0xFF, 0x8B, 0xB5, 0xFF, 0x0C, 0xBE, 0xFF, 0x4A, 0xAD, 0xFF, 0xF4, 0xFF, 0xFF, 0x8B, 0xB5, 0xFF, 0xA9, 0x94, 0xFF, 0xEA, 0x9C, 0xFF, 0x2A, 0xA5, 0xFF, 0xF2, 0xFF, 0xFF, 0x6B, 0xAD, 0xFF, 0x0A, 0x9D, 0xFF, 0xEA, 0x94, 0xFF, 0xAB, 0xB5, 0xFF, 0xF3, 0xFF, 0xFF, 0x4D, 0xCE, 0xFF, 0x0C, 0xC6, 0xFF, 0x4F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xC6, 0xFF, 0x4B, 0xAD, 0xFF, 0x68, 0x84, 0xFF, 0xEB, 0xB5, 0xFF, 0x8E, 0xEF, 0xFF, 0x28, 0x84, 0xFF, 0xAB, 0xAD, 0xFF, 0x25, 0x63, 0xFF, 0xC7, 0x73, 0xFF, 0xEC, 0xB5, 0xFF, 0xC4, 0x52, 0xFF, 0x6B, 0xA5, 0xFF, 0xC5, 0x52, 0xFF, 0xA3, 0x4A, 0xFF, 0xE4, 0x52, 0xFF, 0xC9, 0x94, 0xFF, 0xE5, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0x26, 0x5B, 0xFF, 0x49, 0x7C, 0xFF, 0x8A, 0xA5, 0xFF, 0xC4, 0x52, 0xFF, 0xC4, 0x52, 0xFF, 0xC4, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0xE9, 0x94, 0xFF, 0x66, 0x63, 0xFF, 0x86, 0x6B, 0xFF, 0x85, 0x4A, 0xFF, 0x43, 0x42, 0xFF, 0x85, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0x07, 0x7C, 0xFF, 0x05, 0x5B, 0xFF, 0xE5, 0x52, 0xFF, 0xA4, 0x4A, 0xFF, 0xE5, 0x52, 0xFF, 0xCA, 0x94, 0xFF, 0x46, 0x63, 0xFF, 0xC4, 0x5A, 0xFF, 0x86, 0x6B, 0xFF, 0xA6, 0x73, 0xFF, 0xE9, 0x94, 0xFF,
-    0xEF, 0xCE, 0xFF, 0xCA, 0x8C, 0xFF, 0xC7, 0x6B, 0xFF, 0xC7, 0x73, 0xFF, 0x66, 0x6B, 0xFF, 0xCC, 0xBD, 0xFF, 0x66, 0x6B, 0xFF, 0xC8, 0x7B, 0xFF, 0xA6, 0x73, 0xFF, 0x08, 0x7C, 0xFF, 0x6F, 0xEF, 0xFF, 0x28, 0x84, 0xFF, 0xA9, 0x94, 0xFF, 0xC9, 0xA4, 0xFF, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xE6, 0xFF, 0xEC, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xA5, 0xFF, 0xF3, 0xFF, 0xFF, 0x8E, 0xD6, 0xFF, 0x0A, 0x9D, 0xFF, 0x0A, 0xA5, 0xFF, 0x8B, 0xB5, 0xFF, 0xF1, 0xFF, 0xFF, 0xC9, 0x9C, 0xFF, 0x09, 0x95, 0xFF, 0x0A, 0x9D, 0xFF, 0x2A, 0xAD, 0xFF, 0xF2, 0xFF, 0xFF, 0xCC, 0xBD, 0xFF, 0xEC, 0xC5, 0xFF, 0xF2, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x0F, 0xF7, 0xFF, 0x0B, 0xBE, 0xFF, 0xCA, 0x94, 0xFF, 0x88, 0x8C, 0xFF, 0xC7, 0x84, 0xFF, 0x65, 0x6B, 0xFF, 0x44, 0x63, 0xFF, 0xA7, 0x73, 0xFF, 0xA7, 0x73, 0xFF, 0x25, 0x5B, 0xFF, 0xC5, 0x52, 0xFF, 0xA4, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0x65, 0x53, 0xFF, 0xE4, 0x52, 0xFF, 0x08, 0x7C, 0xFF, 0xA4, 0x4A, 0xFF, 0x46, 0x5B, 0xFF, 0x26, 0x5B, 0xFF, 0x86, 0x63, 0xFF, 0xC4, 0x52, 0xFF, 0xA4, 0x4A, 0xFF, 0x05, 0x5B, 0xFF, 0x25, 0x5B, 0xFF, 0x05, 0x53, 0xFF, 0x86, 0x63, 0xFF, 0x86, 0x63, 0xFF,
-    0x23, 0x42, 0xFF, 0x84, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0x85, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0x84, 0x52, 0xFF, 0xC3, 0x52, 0xFF, 0xA2, 0x4A, 0xFF, 0xE5, 0x52, 0xFF, 0xE5, 0x5A, 0xFF, 0x08, 0x7C, 0xFF, 0xE8, 0x73, 0xFF, 0x05, 0x5B, 0xFF, 0x45, 0x63, 0xFF, 0xE7, 0x73, 0xFF, 0x0A, 0x9D, 0xFF, 0xAA, 0xA5, 0xFF, 0xA8, 0x94, 0xFF, 0x89, 0x8C, 0xFF, 0xEC, 0xBD, 0xFF, 0x66, 0x6B, 0xFF, 0x67, 0x8C, 0xFF, 0x86, 0x6B, 0xFF, 0x2B, 0xA5, 0xFF, 0x6B, 0xAD, 0xFF, 0x07, 0x84, 0xFF, 0xE9, 0x9C, 0xFF, 0x89, 0x94, 0xFF, 0x8A, 0xAD, 0xFF, 0x09, 0xB5, 0xFF, 0xF3, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xEC, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0xBD, 0xFF, 0xFC, 0xFF, 0xFF, 0xAE, 0xDE, 0xFF, 0x2A, 0xA5, 0xFF, 0x4A, 0xAD, 0xFF, 0xAB, 0xBD, 0xFF, 0xD1, 0xFF, 0xFF, 0x4B, 0xAD, 0xFF, 0x29, 0x9D, 0xFF, 0xAB, 0xB5, 0xFF, 0x8D, 0xD6, 0xFF, 0xD1, 0xFF, 0xFF, 0x8D, 0xDE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x4C, 0xD6, 0xFF, 0xAF, 0xDE, 0xFF, 0xAC, 0xB5, 0xFF, 0x70, 0xEF, 0xFF, 0xCC, 0xB5, 0xFF, 0x4C, 0xBE, 0xFF, 0x86, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0xEC, 0xBD, 0xFF, 0x85, 0x6B, 0xFF, 0x04, 0x5B, 0xFF,
-    0xE5, 0x5A, 0xFF, 0xAB, 0x8C, 0xFF, 0x72, 0xE7, 0xFF, 0x68, 0x84, 0xFF, 0x05, 0x53, 0xFF, 0xC4, 0x52, 0xFF, 0x46, 0x63, 0xFF, 0xF5, 0xF7, 0xFF, 0x45, 0x5B, 0xFF, 0xE5, 0x52, 0xFF, 0x06, 0x5B, 0xFF, 0x66, 0x63, 0xFF, 0xCC, 0xB5, 0xFF, 0x46, 0x5B, 0xFF, 0xA6, 0x63, 0xFF, 0x65, 0x63, 0xFF, 0x04, 0x42, 0xFF, 0x43, 0x4A, 0xFF, 0x47, 0x63, 0xFF, 0x06, 0x63, 0xFF, 0x84, 0x4A, 0xFF, 0xA4, 0x4A, 0xFF, 0x84, 0x52, 0xFF, 0x69, 0x8C, 0xFF, 0xE6, 0x5A, 0xFF, 0x83, 0x4A, 0xFF, 0xC5, 0x5A, 0xFF, 0x86, 0x6B, 0xFF, 0x68, 0x8C, 0xFF, 0x46, 0x63, 0xFF, 0x26, 0x5B, 0xFF, 0xA6, 0x6B, 0xFF, 0xE6, 0x73, 0xFF, 0xE7, 0x83, 0xFF, 0x65, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0xC6, 0x73, 0xFF, 0xA6, 0x6B, 0xFF, 0x8B, 0xAD, 0xFF, 0x86, 0x73, 0xFF, 0x2E, 0xC6, 0xFF, 0xC7, 0x7B, 0xFF, 0x30, 0xE7, 0xFF, 0xA9, 0x94, 0xFF, 0x2D, 0xBE, 0xFF, 0x4B, 0xB5, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCC, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xB5, 0xFF, 0xF6, 0xF7, 0xFF, 0x4F, 0xF7, 0xFF, 0x2A, 0xAD, 0xFF, 0x2A, 0xAD, 0xFF, 0x49, 0xA5, 0xFF, 0xD1, 0xFF, 0xFF, 0x6A, 0xAD, 0xFF, 0x2A, 0xA5, 0xFF, 0x2A, 0xA5, 0xFF, 0xCE, 0xDE, 0xFF, 0xF2, 0xFF, 0xFF, 0x2D, 0xCE, 0xFF,
-    0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0x2B, 0xBE, 0xFF, 0x6A, 0xA5, 0xFF, 0xE9, 0x9C, 0xFF, 0x89, 0x8C, 0xFF, 0x07, 0x7C, 0xFF, 0x06, 0x84, 0xFF, 0xA7, 0x6B, 0xFF, 0x0D, 0xBE, 0xFF, 0xA7, 0x73, 0xFF, 0x25, 0x63, 0xFF, 0x05, 0x5B, 0xFF, 0x05, 0x5B, 0xFF, 0x8B, 0xAD, 0xFF, 0xE5, 0x52, 0xFF, 0xE4, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0xC4, 0x52, 0xFF, 0xA9, 0x8C, 0xFF, 0xA4, 0x4A, 0xFF, 0xE5, 0x52, 0xFF, 0x05, 0x53, 0xFF, 0xC4, 0x4A, 0xFF, 0x05, 0x5B, 0xFF, 0x86, 0x63, 0xFF, 0x25, 0x5B, 0xFF, 0x86, 0x63, 0xFF, 0x24, 0x5B, 0xFF, 0x08, 0x84, 0xFF, 0x44, 0x4A, 0xFF, 0xA4, 0x52, 0xFF, 0xAB, 0xAD, 0xFF, 0x29, 0x84, 0xFF, 0x46, 0x63, 0xFF, 0xC4, 0x52, 0xFF, 0xC8, 0x73, 0xFF, 0x84, 0x52, 0xFF, 0xA3, 0x52, 0xFF, 0x26, 0x63, 0xFF, 0xA7, 0x6B, 0xFF, 0x86, 0x6B, 0xFF, 0x86, 0x6B, 0xFF, 0x65, 0x73, 0xFF, 0x86, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0xA7, 0x73, 0xFF, 0xA6, 0x73, 0xFF, 0x86, 0x6B, 0xFF, 0xE7, 0x7B, 0xFF, 0x69, 0x8C, 0xFF, 0xC7, 0x73, 0xFF, 0x48, 0x8C, 0xFF, 0x90, 0xCE, 0xFF, 0x47, 0x8C, 0xFF, 0x27, 0x84, 0xFF, 0x89, 0x94, 0xFF, 0x0C, 0xBE, 0xFF, 0xCB, 0xC5, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0x2F, 0xF7, 0xFF, 0xAB, 0xC5, 0xFF, 0x8B, 0xB5, 0xFF, 0xAB, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x8B, 0xB5, 0xFF, 0x2A, 0xAD, 0xFF, 0x8B, 0xAD, 0xFF, 0x30, 0xE7, 0xFF, 0xB0, 0xFF, 0xFF, 0x09, 0x9D, 0xFF, 0x30, 0xEF, 0xFF, 0x51, 0xF7, 0xFF, 0x4A, 0xA5, 0xFF, 0x0C, 0xC6, 0xFF, 0xB2, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x6D, 0xD6, 0xFF, 0x4C, 0xC6, 0xFF, 0xAC, 0xB5, 0xFF, 0x6C, 0xCE, 0xFF, 0x4A, 0xA5, 0xFF, 0xAB, 0xAD, 0xFF, 0xA5, 0x73, 0xFF, 0xE8, 0x7B, 0xFF, 0xCD, 0xB5, 0xFF, 0x89, 0x8C, 0xFF, 0x04, 0x5B, 0xFF, 0x05, 0x5B, 0xFF, 0x67, 0x63, 0xFF, 0x28, 0x7C, 0xFF, 0x29, 0x7C, 0xFF, 0x05, 0x5B, 0xFF, 0x25, 0x5B, 0xFF, 0xC7, 0x6B, 0xFF, 0x25, 0x5B, 0xFF, 0x25, 0x5B, 0xFF, 0x87, 0x63, 0xFF, 0x05, 0x53, 0xFF, 0xC6, 0x6B, 0xFF, 0x86, 0x6B, 0xFF, 0x85, 0x63, 0xFF, 0x45, 0x5B, 0xFF, 0xA6, 0x6B, 0xFF, 0xC6, 0x6B, 0xFF, 0x24, 0x42, 0xFF, 0x44, 0x4A, 0xFF, 0x84, 0x52, 0xFF, 0x83, 0x4A, 0xFF, 0xE5, 0x5A, 0xFF, 0xEE, 0xB5, 0xFF, 0xC5, 0x52, 0xFF, 0x25, 0x63, 0xFF, 0xE4, 0x5A, 0xFF, 0xAE, 0xCE, 0xFF, 0x66, 0x73, 0xFF, 0xE7, 0x73, 0xFF, 0xAA, 0x94, 0xFF, 0x86, 0x7B, 0xFF, 0x2D, 0xC6, 0xFF, 0x86, 0x73, 0xFF,
-    0x45, 0x6B, 0xFF, 0x68, 0x94, 0xFF, 0xEC, 0xC5, 0xFF, 0x24, 0x73, 0xFF, 0x30, 0xE7, 0xFF, 0x89, 0x8C, 0xFF, 0x0C, 0xC6, 0xFF, 0x89, 0x8C, 0xFF, 0x53, 0xEF, 0xFF, 0xEE, 0xE6, 0xFF, 0x47, 0x8C, 0xFF, 0x0E, 0xDF, 0xFF, 0x8B, 0xAD, 0xFF, 0x0A, 0x9D, 0xFF, 0x72, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0x0D, 0xD6, 0xFF, 0xEC, 0xC5, 0xFF, 0xF0, 0xE6, 0xFF, 0x2F, 0xEF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x8B, 0xBD, 0xFF, 0x6A, 0xAD, 0xFF, 0x4A, 0xA5, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0xEF, 0xFF, 0x0A, 0x9D, 0xFF, 0x6B, 0xB5, 0xFF, 0x0F, 0xE7, 0xFF, 0xF4, 0xFF, 0xFF, 0xAE, 0xDE, 0xFF, 0x4D, 0xCE, 0xFF, 0xCD, 0xDE, 0xFF, 0xF4, 0xFF, 0xFF, 0x8D, 0xD6, 0xFF, 0xF5, 0xFF, 0xFF, 0x2A, 0xA5, 0xFF, 0x70, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x8C, 0xFF, 0x4F, 0xE7, 0xFF, 0x89, 0x8C, 0xFF, 0xCB, 0xAD, 0xFF, 0xA6, 0x73, 0xFF, 0x86, 0x6B, 0xFF, 0x0E, 0xD7, 0xFF, 0x66, 0x6B, 0xFF, 0xC9, 0x8C, 0xFF, 0x05, 0x5B, 0xFF, 0x73, 0xEF, 0xFF, 0x05, 0x5B, 0xFF, 0xCB, 0xAD, 0xFF, 0xE5, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0xF3, 0xBF, 0xFF, 0x24, 0x5B, 0xFF, 0xAA, 0xAD, 0xFF, 0x45, 0x5B, 0xFF, 0x45, 0x5B, 0xFF, 0x86, 0x63, 0xFF, 0x86, 0x63, 0xFF, 0x8B, 0xAD, 0xFF, 0xC5, 0x6B, 0xFF,
-    0x28, 0x7C, 0xFF, 0x46, 0x63, 0xFF, 0x69, 0x84, 0xFF, 0x25, 0x5B, 0xFF, 0x83, 0x52, 0xFF, 0x0A, 0xA5, 0xFF, 0x88, 0x84, 0xFF, 0x66, 0x6B, 0xFF, 0x25, 0x63, 0xFF, 0x24, 0x63, 0xFF, 0xEC, 0xC5, 0xFF, 0x85, 0x7B, 0xFF, 0x4C, 0xB5, 0xFF, 0x28, 0x94, 0xFF, 0xFE, 0xFF, 0xFF, 0x88, 0xA4, 0xFF, 0x6B, 0xB5, 0xFF, 0x48, 0x8C, 0xFF, 0x27, 0x84, 0xFF, 0x8E, 0xDE, 0xFF, 0xC7, 0x7B, 0xFF, 0x46, 0x84, 0xFF, 0xC6, 0x73, 0xFF, 0x6D, 0xC6, 0xFF, 0x2B, 0xA5, 0xFF, 0xA9, 0x94, 0xFF, 0x88, 0x94, 0xFF, 0x07, 0x84, 0xFF, 0x2A, 0xA5, 0xFF, 0x0C, 0xBE, 0xFF, 0x28, 0xAD, 0xFF, 0x33, 0xEF, 0xFF, 0xF2, 0xFF, 0xFF, 0x0C, 0xCE, 0xFF, 0x6A, 0xAD, 0xFF, 0x8A, 0xBD, 0xFF, 0xF4, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0x4A, 0xB5, 0xFF, 0x2A, 0xAD, 0xFF, 0x6B, 0xAD, 0xFF, 0xF3, 0xFF, 0xFF, 0x8B, 0xBD, 0xFF, 0x2A, 0xA5, 0xFF, 0x2D, 0xC6, 0xFF, 0x2E, 0xE7, 0xFF, 0x6D, 0xCE, 0xFF, 0x8A, 0xAD, 0xFF, 0xD1, 0xF7, 0xFF, 0xEC, 0xC5, 0xFF, 0x4A, 0xB5, 0xFF, 0xCB, 0xC5, 0xFF, 0xAD, 0xD6, 0xFF, 0xCB, 0xBD, 0xFF, 0x4C, 0xBE, 0xFF, 0xA8, 0x94, 0xFF, 0x0A, 0x9D, 0xFF, 0xE6, 0x7B, 0xFF, 0x47, 0x84, 0xFF, 0xB1, 0xCE, 0xFF, 0xA7, 0x73, 0xFF, 0xA7, 0x73, 0xFF, 0x88, 0x8C, 0xFF, 0x05, 0x5B, 0xFF,
-    0x05, 0x5B, 0xFF, 0xE5, 0x52, 0xFF, 0x87, 0x6B, 0xFF, 0x04, 0x5B, 0xFF, 0x86, 0x63, 0xFF, 0x45, 0x63, 0xFF, 0xF8, 0xFF, 0xFF, 0x45, 0x5B, 0xFF, 0x28, 0x7C, 0xFF, 0x86, 0x63, 0xFF, 0x86, 0x63, 0xFF, 0x65, 0x5B, 0xFF, 0xA6, 0x63, 0xFF, 0x85, 0x63, 0xFF, 0x85, 0x63, 0xFF, 0x47, 0x7C, 0xFF, 0x83, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0xE3, 0x5A, 0xFF, 0x32, 0xDF, 0xFF, 0x86, 0x6B, 0xFF, 0x68, 0x9C, 0xFF, 0xE7, 0x7B, 0xFF, 0x0D, 0xCE, 0xFF, 0x48, 0x94, 0xFF, 0xA7, 0x7B, 0xFF, 0x25, 0x6B, 0xFF, 0xCC, 0xBD, 0xFF, 0xCC, 0xC5, 0xFF, 0x6F, 0xD6, 0xFF, 0x2D, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x4B, 0xBD, 0xFF, 0x6F, 0xCE, 0xFF, 0x07, 0x84, 0xFF, 0xE7, 0x83, 0xFF, 0x0C, 0xC6, 0xFF, 0x2A, 0x9D, 0xFF, 0x6C, 0xA5, 0xFF, 0x6C, 0xAD, 0xFF, 0xA8, 0x94, 0xFF, 0xF1, 0xF7, 0xFF, 0x68, 0x8C, 0xFF, 0x8A, 0xB5, 0xFF, 0xA8, 0x9C, 0xFF, 0xEB, 0xC5, 0xFF, 0xF5, 0xFF, 0xFF, 0xAB, 0xBD, 0xFF, 0xEC, 0xC5, 0xFF, 0x6A, 0xB5, 0xFF, 0xCF, 0xE6, 0xFF, 0xF4, 0xFF, 0xFF, 0xB1, 0xFF, 0xFF, 0xCB, 0xC5, 0xFF, 0x6B, 0xB5, 0xFF, 0xCF, 0xDE, 0xFF, 0xF3, 0xFF, 0xFF, 0xEC, 0xC5, 0xFF, 0x2A, 0xA5, 0xFF, 0x8E, 0xCE, 0xFF, 0x8E, 0xD6, 0xFF, 0xF3, 0xFF, 0xFF, 0xCB, 0xBD, 0xFF,
-    0x10, 0xE7, 0xFF, 0x0C, 0xD6, 0xFF, 0x4D, 0xD6, 0xFF, 0xF5, 0xFF, 0xFF, 0xCF, 0xDE, 0xFF, 0x2C, 0xC6, 0xFF, 0xFD, 0xFF, 0xFF, 0x88, 0x8C, 0xFF, 0x6F, 0xE7, 0xFF, 0xED, 0xBD, 0xFF, 0x6E, 0xC6, 0xFF, 0x69, 0x8C, 0xFF, 0xC6, 0x73, 0xFF, 0x30, 0xE7, 0xFF, 0xA6, 0x6B, 0xFF, 0x05, 0x5B, 0xFF, 0x05, 0x5B, 0xFF, 0x25, 0x5B, 0xFF, 0x87, 0x84, 0xFF, 0xC7, 0x73, 0xFF, 0x45, 0x63, 0xFF, 0xFE, 0xFF, 0xFF, 0x65, 0x63, 0xFF, 0x4D, 0xBE, 0xFF, 0xE4, 0x52, 0xFF, 0x04, 0x5B, 0xFF, 0x45, 0x63, 0xFF, 0xC6, 0x6B, 0xFF, 0xCB, 0xB5, 0xFF, 0x24, 0x5B, 0xFF, 0xC6, 0x6B, 0xFF, 0xE6, 0x73, 0xFF, 0x46, 0x63, 0xFF, 0x05, 0x53, 0xFF, 0xE4, 0x5A, 0xFF, 0xE8, 0x7B, 0xFF, 0xF7, 0xFF, 0xFF, 0x71, 0xF7, 0xFF, 0x68, 0x8C, 0xFF, 0x8E, 0xDE, 0xFF, 0x8B, 0xCD, 0xFF, 0xE6, 0x8B, 0xFF, 0xE7, 0x8B, 0xFF, 0x07, 0x8C, 0xFF, 0x29, 0xAD, 0xFF, 0x0E, 0xCE, 0xFF, 0xF3, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEB, 0xAC, 0xFF, 0x0C, 0xB6, 0xFF, 0x8F, 0xE7, 0xFF, 0x2F, 0xC6, 0xFF, 0x8D, 0xCE, 0xFF, 0x4B, 0xA5, 0xFF, 0x4D, 0xBE, 0xFF, 0x07, 0x84, 0xFF, 0xAE, 0xD6, 0xFF, 0x88, 0x94, 0xFF, 0xAB, 0xB5, 0xFF, 0x88, 0x94, 0xFF, 0x4A, 0xB5, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xAE, 0xDE, 0xFF, 0xEC, 0xC5, 0xFF, 0x8A, 0xC5, 0xFF, 0x6D, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xFF, 0xFF, 0x4D, 0xD6, 0xFF, 0x6B, 0xB5, 0xFF, 0x6A, 0xAD, 0xFF, 0xF3, 0xFF, 0xFF, 0x0F, 0xE7, 0xFF, 0x2A, 0xA5, 0xFF, 0xEC, 0xC5, 0xFF, 0x6E, 0xD6, 0xFF, 0xF3, 0xFF, 0xFF, 0xEC, 0xCD, 0xFF, 0x2C, 0xD6, 0xFF, 0xB2, 0xF7, 0xFF, 0x4A, 0xAD, 0xFF, 0xAB, 0xB5, 0xFF, 0x6A, 0xAD, 0xFF, 0xB3, 0xF7, 0xFF, 0xC9, 0x94, 0xFF, 0xAE, 0xD6, 0xFF, 0x4B, 0xA5, 0xFF, 0x0F, 0xD7, 0xFF, 0x8C, 0xAD, 0xFF, 0xA7, 0x73, 0xFF, 0x4C, 0xC6, 0xFF, 0xAA, 0x94, 0xFF, 0x48, 0x84, 0xFF, 0x46, 0x63, 0xFF, 0x04, 0x5B, 0xFF, 0x0C, 0xBE, 0xFF, 0x87, 0x6B, 0xFF, 0x46, 0x63, 0xFF, 0x86, 0x63, 0xFF, 0xA8, 0x8C, 0xFF, 0xCA, 0x8C, 0xFF, 0x86, 0x63, 0xFF, 0xA7, 0x6B, 0xFF, 0x86, 0x63, 0xFF, 0xE7, 0x73, 0xFF, 0x65, 0x63, 0xFF, 0x85, 0x63, 0xFF, 0x65, 0x63, 0xFF, 0x07, 0x74, 0xFF, 0x48, 0x7C, 0xFF, 0x27, 0x63, 0xFF, 0x63, 0x4A, 0xFF, 0x8B, 0xAD, 0xFF, 0x66, 0x6B, 0xFF, 0x2A, 0xA5, 0xFF, 0x10, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0xF6, 0xFF, 0xEF, 0xFE, 0xFF, 0xF2, 0xFF, 0xFF, 0x6C, 0xCD, 0xFF, 0x68, 0x94, 0xFF, 0x07, 0x84, 0xFF, 0x8E, 0xCE, 0xFF, 0xD1, 0xF7, 0xFF, 0x55, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xC7, 0x83, 0xFF, 0xCF, 0xD6, 0xFF, 0x68, 0x94, 0xFF, 0x6A, 0xAD, 0xFF, 0x4B, 0xA5, 0xFF, 0x0D, 0xBE, 0xFF, 0x8B, 0xAD, 0xFF, 0xE8, 0x7B, 0xFF, 0x8D, 0xCE, 0xFF, 0xAC, 0xB5, 0xFF, 0xC8, 0x9C, 0xFF, 0x0B, 0xC6, 0xFF, 0x49, 0xAD, 0xFF, 0xEC, 0xC5, 0xFF, 0x2D, 0xD6, 0xFF, 0x6D, 0xE6, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x0C, 0xD6, 0xFF, 0x6B, 0xB5, 0xFF, 0x8A, 0xB5, 0xFF, 0x6D, 0xCE, 0xFF, 0xEC, 0xC5, 0xFF, 0x0A, 0xA5, 0xFF, 0x0C, 0xCE, 0xFF, 0xB1, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xAE, 0xE6, 0xFF, 0x29, 0xA5, 0xFF, 0xC9, 0x9C, 0xFF, 0xF4, 0xFF, 0xFF, 0x2A, 0xA5, 0xFF, 0xE9, 0x9C, 0xFF, 0x47, 0x84, 0xFF, 0x0A, 0x9D, 0xFF, 0x2B, 0xA5, 0xFF, 0x2B, 0x9D, 0xFF, 0x07, 0x7C, 0xFF, 0xEA, 0x94, 0xFF, 0xE7, 0x7B, 0xFF, 0x86, 0x6B, 0xFF, 0x86, 0x6B, 0xFF, 0x68, 0x84, 0xFF, 0x05, 0x5B, 0xFF, 0x66, 0x63, 0xFF, 0x86, 0x6B, 0xFF, 0xE6, 0x73, 0xFF, 0x47, 0x7C, 0xFF, 0x66, 0x63, 0xFF, 0x66, 0x63, 0xFF, 0xA6, 0x6B, 0xFF, 0xE7, 0x73, 0xFF, 0xC6, 0x6B, 0xFF, 0xA6, 0x6B, 0xFF, 0xE7, 0x73, 0xFF, 0xC6, 0x6B, 0xFF, 0x27, 0x74, 0xFF, 0xC6, 0x73, 0xFF,
-    0x43, 0x42, 0xFF, 0xA4, 0x52, 0xFF, 0xE8, 0x73, 0xFF, 0x2D, 0xBE, 0xFF, 0x6E, 0xC6, 0xFF, 0xEA, 0x9C, 0xFF, 0x27, 0x8C, 0xFF, 0xF7, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x4B, 0xB5, 0xFF, 0x68, 0x94, 0xFF, 0xC6, 0x73, 0xFF, 0x71, 0xE7, 0xFF, 0x68, 0x94, 0xFF, 0x2C, 0xD6, 0xFF, 0x6F, 0xEF, 0xFF, 0xF3, 0xFF, 0xFF, 0x88, 0x8C, 0xFF, 0x6E, 0xCE, 0xFF, 0x8B, 0xAD, 0xFF, 0x48, 0x8C, 0xFF, 0x2A, 0x9D, 0xFF, 0xED, 0xB5, 0xFF, 0x30, 0xE7, 0xFF, 0x88, 0x8C, 0xFF, 0x6B, 0xAD, 0xFF, 0xAB, 0xB5, 0xFF, 0xAB, 0xBD, 0xFF, 0xAA, 0xB5, 0xFF, 0x69, 0xBD, 0xFF, 0x2C, 0xCE, 0xFF, 0xAE, 0xE6, 0xFF, 0xEF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xEF, 0xF6, 0xFF, 0x8A, 0xB5, 0xFF, 0x4D, 0xCE, 0xFF, 0xF4, 0xFF, 0xFF, 0xCF, 0xEE, 0xFF, 0x4A, 0xAD, 0xFF, 0x4F, 0xEF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xE6, 0xFF, 0xF5, 0xFF, 0xFF, 0xC9, 0x9C, 0xFF, 0x2F, 0xE7, 0xFF, 0xEC, 0xBD, 0xFF, 0x50, 0xEF, 0xFF, 0x28, 0x84, 0xFF, 0x8B, 0xAD, 0xFF, 0x8E, 0xCE, 0xFF, 0xEA, 0x9C, 0xFF, 0xEC, 0xB5, 0xFF, 0xE7, 0x73, 0xFF, 0x28, 0x84, 0xFF, 0xA6, 0x73, 0xFF, 0x6B, 0xA5, 0xFF,
-    0x05, 0x5B, 0xFF, 0x05, 0x5B, 0xFF, 0x66, 0x63, 0xFF, 0x89, 0x84, 0xFF, 0x07, 0x7C, 0xFF, 0x66, 0x63, 0xFF, 0xA6, 0x6B, 0xFF, 0x24, 0x5B, 0xFF, 0x27, 0x7C, 0xFF, 0xEA, 0x94, 0xFF, 0x86, 0x63, 0xFF, 0xC6, 0x6B, 0xFF, 0xE7, 0x73, 0xFF, 0x07, 0x74, 0xFF, 0xA7, 0x84, 0xFF, 0xC5, 0x6B, 0xFF, 0x68, 0x8C, 0xFF, 0x84, 0x4A, 0xFF, 0x4A, 0x84, 0xFF, 0x05, 0x5B, 0xFF, 0xE9, 0x7B, 0xFF, 0xCC, 0xB5, 0xFF, 0x89, 0x9C, 0xFF, 0x2A, 0xB5, 0xFF, 0xF5, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xA9, 0x9C, 0xFF, 0xE6, 0x83, 0xFF, 0x69, 0x94, 0xFF, 0x2F, 0xDF, 0xFF, 0xEC, 0xBD, 0xFF, 0x48, 0x8C, 0xFF, 0xE9, 0x9C, 0xFF, 0x8E, 0xD6, 0xFF, 0x67, 0x94, 0xFF, 0x0A, 0x9D, 0xFF, 0x4A, 0x9D, 0xFF, 0x4B, 0x9D, 0xFF, 0xED, 0xBD, 0xFF, 0xA7, 0x94, 0xFF, 0x8B, 0xAD, 0xFF, 0x06, 0x84, 0xFF, 0xA7, 0x94, 0xFF, 0xA8, 0x94, 0xFF, 0x49, 0xAD, 0xFF, 0x09, 0xA5, 0xFF, 0xF6, 0xFF, 0xFF, 0x4C, 0xD6, 0xFF, 0x8E, 0xE6, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0x2C, 0xDE, 0xFF, 0x8B, 0xB5, 0xFF, 0x2D, 0xCE, 0xFF, 0xF6, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0x8B, 0xAD, 0xFF, 0x2F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x0C, 0xBE, 0xFF, 0x8D, 0xCE, 0xFF, 0x6A, 0xAD, 0xFF, 0xAB, 0xBD, 0xFF, 0x08, 0x84, 0xFF, 0xCB, 0xAD, 0xFF, 0xCC, 0xA5, 0xFF, 0x70, 0xEF, 0xFF, 0xE9, 0x9C, 0xFF, 0xA6, 0x73, 0xFF, 0xC7, 0x73, 0xFF, 0x28, 0x84, 0xFF, 0xAD, 0xD6, 0xFF, 0xC7, 0x73, 0xFF, 0x46, 0x63, 0xFF, 0x46, 0x5B, 0xFF, 0x67, 0x84, 0xFF, 0xCB, 0xB5, 0xFF, 0xE6, 0x73, 0xFF, 0x86, 0x63, 0xFF, 0xE7, 0x73, 0xFF, 0x68, 0x84, 0xFF, 0xC5, 0x6B, 0xFF, 0x08, 0x95, 0xFF, 0x07, 0x74, 0xFF, 0xA5, 0x6B, 0xFF, 0x88, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0x2D, 0xE7, 0xFF, 0xE7, 0x7B, 0xFF, 0x83, 0x4A, 0xFF, 0x26, 0x6B, 0xFF, 0x8A, 0x84, 0xFF, 0xE5, 0x52, 0xFF, 0xE8, 0x7B, 0xFF, 0x05, 0x5B, 0xFF, 0xEA, 0x9C, 0xFF, 0x85, 0x7B, 0xFF, 0xE9, 0xB4, 0xFF, 0xA8, 0xB4, 0xFF, 0x8E, 0xE6, 0xFF, 0xF7, 0xFF, 0xFF, 0xCA, 0xBD, 0xFF, 0xA6, 0x7B, 0xFF, 0xE7, 0x7B, 0xFF, 0x0A, 0xA5, 0xFF, 0xED, 0xDE, 0xFF, 0xE7, 0x83, 0xFF, 0xCA, 0x9C, 0xFF, 0x2B, 0xA5, 0xFF, 0x69, 0xAD, 0xFF, 0xEB, 0xBD, 0xFF, 0x28, 0x84, 0xFF, 0xA8, 0x8C, 0xFF, 0x2C, 0xB6, 0xFF, 0xED, 0xBD, 0xFF, 0xAD, 0xD6, 0xFF, 0x0C, 0xBE, 0xFF, 0x2C, 0xBE, 0xFF, 0x2A, 0xA5, 0xFF, 0x69, 0xB5, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xF9, 0xFF, 0xFF, 0xEB, 0xC5, 0xFF, 0xAD, 0xE6, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x2C, 0xD6, 0xFF, 0x8B, 0xB5, 0xFF, 0x6E, 0xD6, 0xFF, 0xF2, 0xFF, 0xFF, 0xEF, 0xE6, 0xFF, 0x6B, 0xB5, 0xFF, 0x30, 0xEF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0x50, 0xF7, 0xFF, 0xB2, 0xFF, 0xFF, 0xEC, 0xBD, 0xFF, 0xFC, 0xFF, 0xFF, 0x2E, 0xC6, 0xFF, 0xEF, 0xDE, 0xFF, 0x8B, 0xA5, 0xFF, 0xFB, 0xFF, 0xFF, 0xEE, 0xD6, 0xFF, 0xC8, 0x94, 0xFF, 0x30, 0xE7, 0xFF, 0xA6, 0x73, 0xFF, 0x89, 0x8C, 0xFF, 0x8D, 0xD6, 0xFF, 0x69, 0x8C, 0xFF, 0xA7, 0x73, 0xFF, 0x28, 0x7C, 0xFF, 0xAC, 0xAD, 0xFF, 0x0A, 0x9D, 0xFF, 0x07, 0x74, 0xFF, 0x66, 0x63, 0xFF, 0x0A, 0x95, 0xFF, 0xC6, 0x73, 0xFF, 0xCB, 0xB5, 0xFF, 0xA6, 0x6B, 0xFF, 0xE7, 0x73, 0xFF, 0xA9, 0x8C, 0xFF, 0x48, 0x7C, 0xFF, 0x8C, 0xCE, 0xFF, 0x67, 0x84, 0xFF, 0xA8, 0x84, 0xFF, 0xA8, 0x8C, 0xFF, 0x22, 0x3A, 0xFF, 0xA5, 0x52, 0xFF, 0x66, 0x6B, 0xFF, 0xAB, 0x94, 0xFF, 0x87, 0x6B, 0xFF, 0x04, 0x5B, 0xFF, 0x05, 0x63, 0xFF, 0x65, 0x7B, 0xFF, 0xCC, 0xC5, 0xFF, 0x2A, 0xA5, 0xFF, 0x49, 0x94, 0xFF, 0xAA, 0x94, 0xFF, 0xD0, 0xDE, 0xFF, 0xE9, 0x9C, 0xFF, 0x2B, 0xA5, 0xFF, 0x0B, 0xA5, 0xFF,
-    0x09, 0x9D, 0xFF, 0x49, 0xAD, 0xFF, 0x69, 0x94, 0xFF, 0x8A, 0x94, 0xFF, 0x2A, 0xA5, 0xFF, 0xA8, 0x94, 0xFF, 0xEC, 0xBD, 0xFF, 0x48, 0x84, 0xFF, 0xF1, 0xDE, 0xFF, 0xA8, 0x8C, 0xFF, 0xE9, 0x9C, 0xFF, 0x29, 0xA5, 0xFF, 0x47, 0x8C, 0xFF, 0x88, 0x94, 0xFF, 0x87, 0x94, 0xFF, 0x2F, 0xE7, 0xFF, 0xD4, 0xFF, 0xFF, 0xAE, 0xE6, 0xFF, 0x4F, 0xEF, 0xFF, 0xCF, 0xF6, 0xFF, 0xFC, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xCB, 0xC5, 0xFF, 0x6B, 0xB5, 0xFF, 0x4E, 0xCE, 0xFF, 0xF2, 0xFF, 0xFF, 0x8D, 0xDE, 0xFF, 0xC9, 0x9C, 0xFF, 0xE8, 0xA4, 0xFF, 0x0E, 0xEF, 0xFF, 0xF2, 0xFF, 0xFF, 0x6E, 0xE6, 0xFF, 0x89, 0xB5, 0xFF, 0x8B, 0xB5, 0xFF, 0x71, 0xEF, 0xFF, 0x68, 0x8C, 0xFF, 0x50, 0xE7, 0xFF, 0x0D, 0xBE, 0xFF, 0x8D, 0xBE, 0xFF, 0x2F, 0xDF, 0xFF, 0xAB, 0xB5, 0xFF, 0x4E, 0xBE, 0xFF, 0x2D, 0xBE, 0xFF, 0x85, 0x6B, 0xFF, 0xCB, 0xBD, 0xFF, 0x07, 0x7C, 0xFF, 0x86, 0x6B, 0xFF, 0x85, 0x6B, 0xFF, 0x6A, 0xA5, 0xFF, 0x4D, 0xC6, 0xFF, 0xE8, 0x73, 0xFF, 0xE7, 0x73, 0xFF, 0xA5, 0x73, 0xFF, 0xCB, 0xAD, 0xFF, 0xEB, 0x9D, 0xFF, 0x28, 0x7C, 0xFF, 0xC6, 0x6B, 0xFF, 0x68, 0x84, 0xFF, 0x2C, 0xBE, 0xFF, 0x48, 0x7C, 0xFF, 0x68, 0x84, 0xFF, 0xE9, 0x8C, 0xFF, 0x49, 0xA5, 0xFF, 0xC9, 0x8C, 0xFF,
-    0x63, 0x42, 0xFF, 0xA5, 0x52, 0xFF, 0x64, 0x63, 0xFF, 0xE5, 0x52, 0xFF, 0x82, 0x4A, 0xFF, 0x25, 0x63, 0xFF, 0x05, 0x5B, 0xFF, 0xE4, 0x5A, 0xFF, 0x0B, 0xA5, 0xFF, 0x89, 0x94, 0xFF, 0x45, 0x6B, 0xFF, 0xAC, 0xB5, 0xFF, 0xCA, 0x9C, 0xFF, 0x86, 0x73, 0xFF, 0x8A, 0xAD, 0xFF, 0x2B, 0xA5, 0xFF, 0xCB, 0xBD, 0xFF, 0x07, 0x7C, 0xFF, 0xEC, 0xB5, 0xFF, 0x68, 0x8C, 0xFF, 0x8B, 0xB5, 0xFF, 0xEA, 0x9C, 0xFF, 0x09, 0x9D, 0xFF, 0xE7, 0x7B, 0xFF, 0xAB, 0xAD, 0xFF, 0x0A, 0xA5, 0xFF, 0x90, 0xD6, 0xFF, 0xCD, 0xD6, 0xFF, 0xA9, 0x94, 0xFF, 0x8E, 0xCE, 0xFF, 0xA8, 0x9C, 0xFF, 0xCC, 0xBD, 0xFF, 0xEE, 0xDE, 0xFF, 0x2E, 0xE7, 0xFF, 0xFD, 0xFF, 0xFF, 0x4C, 0xDE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xAA, 0xBD, 0xFF, 0x4A, 0xAD, 0xFF, 0x8B, 0xB5, 0xFF, 0xF2, 0xFF, 0xFF, 0x6A, 0xBD, 0xFF, 0x89, 0x94, 0xFF, 0x2C, 0xCE, 0xFF, 0x91, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0xEB, 0xBD, 0xFF, 0xF2, 0xFF, 0xFF, 0x6B, 0xB5, 0xFF, 0x71, 0xEF, 0xFF, 0x68, 0x8C, 0xFF, 0x2C, 0xC6, 0xFF, 0x0E, 0xC6, 0xFF, 0xB1, 0xE7, 0xFF, 0x2B, 0x9D, 0xFF, 0x8A, 0xA5, 0xFF, 0x0D, 0xBE, 0xFF, 0xD6, 0xF7, 0xFF, 0x6D, 0xCE, 0xFF, 0x08, 0x84, 0xFF, 0xA6, 0x73, 0xFF, 0xCA, 0x94, 0xFF, 0xA8, 0x8C, 0xFF,
-    0x86, 0x6B, 0xFF, 0x25, 0x5B, 0xFF, 0xE7, 0x73, 0xFF, 0x68, 0x84, 0xFF, 0x0D, 0xBE, 0xFF, 0xA6, 0x6B, 0xFF, 0xE6, 0x73, 0xFF, 0x68, 0x84, 0xFF, 0xE6, 0x73, 0xFF, 0x68, 0x84, 0xFF, 0x68, 0x84, 0xFF, 0xE9, 0x94, 0xFF, 0xC9, 0x94, 0xFF, 0xE9, 0x94, 0xFF, 0x4A, 0xA5, 0xFF, 0xE9, 0x9C, 0xFF, 0xE5, 0x52, 0xFF, 0xC5, 0x52, 0xFF, 0x83, 0x4A, 0xFF, 0x64, 0x4A, 0xFF, 0x62, 0x4A, 0xFF, 0x26, 0x5B, 0xFF, 0x06, 0x74, 0xFF, 0x04, 0x5B, 0xFF, 0x0A, 0x9D, 0xFF, 0x04, 0x63, 0xFF, 0x2A, 0x9D, 0xFF, 0x66, 0x6B, 0xFF, 0x88, 0x8C, 0xFF, 0x04, 0x63, 0xFF, 0x2C, 0xA5, 0xFF, 0x2C, 0xBE, 0xFF, 0xF4, 0xFF, 0xFF, 0xEA, 0x94, 0xFF, 0xE6, 0x7B, 0xFF, 0xEC, 0xB5, 0xFF, 0x73, 0xEF, 0xFF, 0x47, 0x84, 0xFF, 0x69, 0x8C, 0xFF, 0x09, 0x9D, 0xFF, 0x27, 0x84, 0xFF, 0x6E, 0xCE, 0xFF, 0x0C, 0xBE, 0xFF, 0x88, 0x8C, 0xFF, 0xF2, 0xFF, 0xFF, 0x88, 0x94, 0xFF, 0xF0, 0xDE, 0xFF, 0xCB, 0xB5, 0xFF, 0xAD, 0xD6, 0xFF, 0xEE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xC5, 0xFF, 0xF4, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x8B, 0xB5, 0xFF, 0x0A, 0xA5, 0xFF, 0x70, 0xEF, 0xFF, 0x70, 0xEF, 0xFF, 0x29, 0xAD, 0xFF, 0xC8, 0x94, 0xFF, 0x0C, 0xC6, 0xFF, 0x50, 0xEF, 0xFF, 0x50, 0xEF, 0xFF, 0x2A, 0xAD, 0xFF,
-    0xC9, 0x9C, 0xFF, 0xCE, 0xD6, 0xFF, 0xE9, 0x94, 0xFF, 0x6A, 0xAD, 0xFF, 0xC7, 0x94, 0xFF, 0x8B, 0xAD, 0xFF, 0x6B, 0xA5, 0xFF, 0x4D, 0xBE, 0xFF, 0x4A, 0xA5, 0xFF, 0xD3, 0xFF, 0xFF, 0xAD, 0xCE, 0xFF, 0x2C, 0xA5, 0xFF, 0xE7, 0x7B, 0xFF, 0xC6, 0x73, 0xFF, 0x27, 0x84, 0xFF, 0x85, 0x6B, 0xFF, 0xA6, 0x6B, 0xFF, 0x86, 0x6B, 0xFF, 0xE8, 0x7B, 0xFF, 0xA5, 0x6B, 0xFF, 0xE6, 0x73, 0xFF, 0xC6, 0x6B, 0xFF, 0x27, 0x7C, 0xFF, 0x8D, 0xAD, 0xFF, 0x27, 0x7C, 0xFF, 0x68, 0x84, 0xFF, 0x09, 0x95, 0xFF, 0x09, 0x9D, 0xFF, 0x8A, 0xAD, 0xFF, 0xCA, 0xB5, 0xFF, 0x49, 0xA5, 0xFF, 0xE9, 0x9C, 0xFF, 0x25, 0x63, 0xFF, 0x23, 0x42, 0xFF, 0x44, 0x4A, 0xFF, 0xC5, 0x5A, 0xFF, 0x8B, 0xAD, 0xFF, 0x26, 0x63, 0xFF, 0x66, 0x63, 0xFF, 0x05, 0x5B, 0xFF, 0x4B, 0xAD, 0xFF, 0xAE, 0xD6, 0xFF, 0x2B, 0x9D, 0xFF, 0xA8, 0x94, 0xFF, 0x09, 0x9D, 0xFF, 0xEA, 0x94, 0xFF, 0xC9, 0x9C, 0xFF, 0x8B, 0xA5, 0xFF, 0x8E, 0xCE, 0xFF, 0xED, 0xB5, 0xFF, 0xC6, 0x73, 0xFF, 0xCA, 0x94, 0xFF, 0x6D, 0xC6, 0xFF, 0x68, 0x8C, 0xFF, 0xEB, 0x9C, 0xFF, 0xAC, 0xB5, 0xFF, 0x6B, 0xA5, 0xFF, 0x8D, 0xCE, 0xFF, 0xE9, 0x9C, 0xFF, 0x2D, 0xC6, 0xFF, 0x6D, 0xCE, 0xFF, 0xEC, 0xC5, 0xFF, 0x8E, 0xD6, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xA7, 0x9C, 0xFF, 0x4C, 0xCE, 0xFF, 0x50, 0xE7, 0xFF, 0x4A, 0xB5, 0xFF, 0xF5, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xEB, 0xC5, 0xFF, 0xC9, 0x9C, 0xFF, 0x0C, 0xC6, 0xFF, 0xF4, 0xFF, 0xFF, 0xC7, 0xA4, 0xFF, 0x68, 0x8C, 0xFF, 0x09, 0xA5, 0xFF, 0x4A, 0xAD, 0xFF, 0xF3, 0xFF, 0xFF, 0xAA, 0xBD, 0xFF, 0xCC, 0xBD, 0xFF, 0xEE, 0xDE, 0xFF, 0x2D, 0xC6, 0xFF, 0xAB, 0xB5, 0xFF, 0xF3, 0xFF, 0xFF, 0x2C, 0xBE, 0xFF, 0x67, 0x84, 0xFF, 0x07, 0x7C, 0xFF, 0xE9, 0x9C, 0xFF, 0x30, 0xE7, 0xFF, 0xEA, 0x94, 0xFF, 0xE7, 0x7B, 0xFF, 0x48, 0x84, 0xFF, 0xA8, 0x94, 0xFF, 0xCE, 0xDE, 0xFF, 0x85, 0x6B, 0xFF, 0x08, 0x7C, 0xFF, 0x0C, 0xBE, 0xFF, 0xC6, 0x73, 0xFF, 0x8D, 0xCE, 0xFF, 0xCF, 0xD6, 0xFF, 0x47, 0x7C, 0xFF, 0x06, 0x7C, 0xFF, 0x0A, 0x9D, 0xFF, 0xF5, 0xFF, 0xFF, 0x90, 0xF7, 0xFF, 0xCB, 0xBD, 0xFF, 0x8A, 0xB5, 0xFF, 0xFD, 0xFF, 0xFF, 0x2A, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xC6, 0xFF, 0x2E, 0xBE, 0xFF, 0x07, 0x74, 0xFF, 0xA4, 0x52, 0xFF, 0x64, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0xC4, 0x52, 0xFF, 0xA9, 0x8C, 0xFF, 0xC3, 0x52, 0xFF, 0xE4, 0x5A, 0xFF, 0x89, 0x8C, 0xFF, 0x45, 0x63, 0xFF, 0xAF, 0xD6, 0xFF, 0xA2, 0x52, 0xFF, 0xA9, 0x94, 0xFF, 0x68, 0x8C, 0xFF, 0xE9, 0x94, 0xFF,
-    0x09, 0x9D, 0xFF, 0x29, 0x9D, 0xFF, 0x8D, 0xAD, 0xFF, 0x27, 0x84, 0xFF, 0x27, 0x84, 0xFF, 0x0B, 0xBE, 0xFF, 0xA9, 0x8C, 0xFF, 0x29, 0x84, 0xFF, 0xAB, 0xAD, 0xFF, 0x8E, 0xCE, 0xFF, 0xCE, 0xD6, 0xFF, 0xA8, 0x94, 0xFF, 0xC9, 0x9C, 0xFF, 0x0A, 0xA5, 0xFF, 0xAE, 0xD6, 0xFF, 0xB2, 0xFF, 0xFF, 0x6A, 0xB5, 0xFF, 0x2E, 0xCE, 0xFF, 0x69, 0xB5, 0xFF, 0xC8, 0xA4, 0xFF, 0xD1, 0xFF, 0xFF, 0x4D, 0xD6, 0xFF, 0x88, 0x94, 0xFF, 0x89, 0x94, 0xFF, 0x8A, 0xAD, 0xFF, 0xF2, 0xFF, 0xFF, 0xEC, 0xD5, 0xFF, 0x8C, 0xB5, 0xFF, 0xA7, 0x9C, 0xFF, 0x8C, 0xBD, 0xFF, 0xD2, 0xFF, 0xFF, 0x52, 0xF7, 0xFF, 0x8D, 0xD6, 0xFF, 0x2C, 0xCE, 0xFF, 0x6A, 0xAD, 0xFF, 0x71, 0xEF, 0xFF, 0x29, 0xA5, 0xFF, 0xAC, 0xB5, 0xFF, 0x68, 0x8C, 0xFF, 0x48, 0x84, 0xFF, 0xCE, 0xDE, 0xFF, 0xCA, 0x9C, 0xFF, 0x88, 0x8C, 0xFF, 0x28, 0x84, 0xFF, 0xA6, 0x94, 0xFF, 0x8E, 0xD6, 0xFF, 0x65, 0x63, 0xFF, 0x27, 0x84, 0xFF, 0x48, 0x84, 0xFF, 0x86, 0x6B, 0xFF, 0x0C, 0xC6, 0xFF, 0x27, 0x7C, 0xFF, 0xC8, 0x8C, 0xFF, 0x27, 0x7C, 0xFF, 0x47, 0x7C, 0xFF, 0x89, 0xB5, 0xFF, 0x6A, 0xA5, 0xFF, 0xEB, 0xBD, 0xFF, 0xF5, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF7, 0xFF, 0xEB, 0xC5, 0xFF, 0x2C, 0xCE, 0xFF,
-    0xE6, 0x5A, 0xFF, 0x44, 0x42, 0xFF, 0x43, 0x42, 0xFF, 0x83, 0x4A, 0xFF, 0x85, 0x4A, 0xFF, 0x43, 0x42, 0xFF, 0x29, 0x7C, 0xFF, 0xE5, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0x07, 0x7C, 0xFF, 0x05, 0x53, 0xFF, 0xE7, 0x73, 0xFF, 0x05, 0x5B, 0xFF, 0x87, 0x6B, 0xFF, 0x85, 0x6B, 0xFF, 0xE9, 0x94, 0xFF, 0x88, 0x8C, 0xFF, 0x4E, 0xBE, 0xFF, 0x88, 0x8C, 0xFF, 0x48, 0x84, 0xFF, 0x48, 0x84, 0xFF, 0xC6, 0x73, 0xFF, 0x2C, 0xBE, 0xFF, 0x08, 0x84, 0xFF, 0xA9, 0x94, 0xFF, 0x8C, 0xAD, 0xFF, 0x2E, 0xC6, 0xFF, 0x8E, 0xD6, 0xFF, 0xEC, 0xBD, 0xFF, 0x2B, 0xAD, 0xFF, 0x6B, 0xB5, 0xFF, 0x70, 0xEF, 0xFF, 0x09, 0xA5, 0xFF, 0x2D, 0xCE, 0xFF, 0xEB, 0xB5, 0xFF, 0xCC, 0xC5, 0xFF, 0xAE, 0xDE, 0xFF, 0x0D, 0xC6, 0xFF, 0x68, 0x8C, 0xFF, 0x28, 0x8C, 0xFF, 0x0C, 0xBE, 0xFF, 0x2F, 0xE7, 0xFF, 0x8B, 0xBD, 0xFF, 0xCC, 0xB5, 0xFF, 0x0C, 0xC6, 0xFF, 0xEA, 0xA4, 0xFF, 0xEF, 0xDE, 0xFF, 0x2A, 0xAD, 0xFF, 0xF3, 0xFF, 0xFF, 0xCC, 0xBD, 0xFF, 0x70, 0xE7, 0xFF, 0xA7, 0x9C, 0xFF, 0x4A, 0xA5, 0xFF, 0x4E, 0xCE, 0xFF, 0x90, 0xD6, 0xFF, 0x70, 0xF7, 0xFF, 0xAB, 0xB5, 0xFF, 0xEA, 0x9C, 0xFF, 0xC8, 0x94, 0xFF, 0xCB, 0xBD, 0xFF, 0x8D, 0xDE, 0xFF, 0xE7, 0x73, 0xFF, 0x07, 0x84, 0xFF, 0x2A, 0x9D, 0xFF,
-    0x6D, 0xCE, 0xFF, 0x8C, 0xAD, 0xFF, 0x28, 0x7C, 0xFF, 0x48, 0x84, 0xFF, 0x89, 0x8C, 0xFF, 0x91, 0xEF, 0xFF, 0x87, 0x8C, 0xFF, 0x6A, 0xAD, 0xFF, 0x8E, 0xD6, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x2E, 0xEF, 0xFF, 0x2C, 0xC6, 0xFF, 0x2C, 0xBE, 0xFF, 0xF8, 0xFF, 0xFF, 0x03, 0x42, 0xFF, 0xE6, 0x5A, 0xFF, 0x64, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0xA5, 0x4A, 0xFF, 0xC4, 0x52, 0xFF, 0x07, 0x7C, 0xFF, 0xC4, 0x52, 0xFF, 0xE4, 0x52, 0xFF, 0x4C, 0xA5, 0xFF, 0x04, 0x5B, 0xFF, 0x86, 0x6B, 0xFF, 0x04, 0x5B, 0xFF, 0x48, 0x84, 0xFF, 0x0A, 0x95, 0xFF, 0x8B, 0xAD, 0xFF, 0x27, 0x84, 0xFF, 0x89, 0x8C, 0xFF, 0x27, 0x7C, 0xFF, 0x4B, 0xA5, 0xFF, 0xE6, 0x73, 0xFF, 0xA6, 0x73, 0xFF, 0xE7, 0x7B, 0xFF, 0x0A, 0x9D, 0xFF, 0x08, 0x84, 0xFF, 0x69, 0x94, 0xFF, 0x89, 0x94, 0xFF, 0x8D, 0xCE, 0xFF, 0x26, 0x84, 0xFF, 0x0A, 0xAD, 0xFF, 0xAB, 0xB5, 0xFF, 0xA9, 0x94, 0xFF, 0x2A, 0xAD, 0xFF, 0x09, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEF, 0xFF, 0x8E, 0xD6, 0xFF, 0x2D, 0xC6, 0xFF, 0x88, 0x94, 0xFF, 0x89, 0x94, 0xFF, 0xCB, 0xB5, 0xFF, 0xD3, 0xFF, 0xFF, 0xED, 0xC5, 0xFF, 0x4D, 0xB6, 0xFF, 0x8B, 0xB5, 0xFF, 0xEF, 0xDE, 0xFF, 0xCA, 0x9C, 0xFF, 0xAB, 0xBD, 0xFF,
-    0x88, 0x94, 0xFF, 0xED, 0xBD, 0xFF, 0x50, 0xEF, 0xFF, 0x29, 0xA5, 0xFF, 0x4B, 0xAD, 0xFF, 0xAB, 0xBD, 0xFF, 0x2F, 0xE7, 0xFF, 0x88, 0x9C, 0xFF, 0x6C, 0xAD, 0xFF, 0x50, 0xCF, 0xFF, 0x09, 0xA5, 0xFF, 0xF6, 0xFF, 0xFF, 0x8C, 0xAD, 0xFF, 0x4B, 0xA5, 0xFF, 0x07, 0x84, 0xFF, 0x8D, 0xD6, 0xFF, 0xAC, 0xAD, 0xFF, 0xC6, 0x73, 0xFF, 0x47, 0x7C, 0xFF, 0x06, 0x74, 0xFF, 0xAD, 0xD6, 0xFF, 0x47, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0xC9, 0x94, 0xFF, 0xFE, 0xFF, 0xFF, 0x2B, 0xCE, 0xFF, 0x8D, 0xDE, 0xFF, 0x2C, 0xC6, 0xFF, 0xCB, 0xB5, 0xFF, 0x0B, 0xBE, 0xFF, 0xF2, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x03, 0x3A, 0xFF, 0xC5, 0x52, 0xFF, 0x71, 0xB6, 0xFF, 0xC5, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0xE5, 0x52, 0xFF, 0x09, 0x7C, 0xFF, 0xC8, 0x73, 0xFF, 0x47, 0x84, 0xFF, 0x09, 0x7C, 0xFF, 0x44, 0x63, 0xFF, 0x86, 0x6B, 0xFF, 0x09, 0x95, 0xFF, 0xE7, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0xA5, 0xFF, 0xE8, 0x8C, 0xFF, 0x27, 0x7C, 0xFF, 0x0A, 0x9D, 0xFF, 0x2C, 0xA5, 0xFF, 0xC9, 0x94, 0xFF, 0xEA, 0x9C, 0xFF, 0x28, 0x84, 0xFF, 0xA6, 0x73, 0xFF, 0xEB, 0xB5, 0xFF, 0x0B, 0xA5, 0xFF, 0x48, 0x8C, 0xFF, 0xED, 0xBD, 0xFF, 0x0D, 0xC6, 0xFF, 0x89, 0x9C, 0xFF, 0x2A, 0xAD, 0xFF, 0xA9, 0x9C, 0xFF,
-    0xA8, 0x9C, 0xFF, 0xC9, 0xA4, 0xFF, 0xE9, 0xA4, 0xFF, 0x6B, 0xB5, 0xFF, 0x29, 0xAD, 0xFF, 0xAB, 0xB5, 0xFF, 0x88, 0x8C, 0xFF, 0x88, 0x94, 0xFF, 0x8B, 0xAD, 0xFF, 0xA8, 0x94, 0xFF, 0x09, 0xAD, 0xFF, 0x4B, 0xAD, 0xFF, 0xE8, 0x9C, 0xFF, 0xAF, 0xD6, 0xFF, 0xA9, 0x9C, 0xFF, 0x0A, 0xA5, 0xFF, 0x68, 0x8C, 0xFF, 0x0F, 0xDF, 0xFF, 0x2A, 0xA5, 0xFF, 0x27, 0x84, 0xFF, 0x6B, 0xAD, 0xFF, 0xEB, 0xBD, 0xFF, 0x68, 0x8C, 0xFF, 0x68, 0x8C, 0xFF, 0xAB, 0xAD, 0xFF, 0xF2, 0xFF, 0xFF, 0x4D, 0xCE, 0xFF, 0x06, 0x84, 0xFF, 0x47, 0x84, 0xFF, 0x50, 0xE7, 0xFF, 0xD5, 0xFF, 0xFF, 0x27, 0x84, 0xFF, 0x06, 0x84, 0xFF, 0x6E, 0xCE, 0xFF, 0x0C, 0xBE, 0xFF, 0xAC, 0xAD, 0xFF, 0xA5, 0x6B, 0xFF, 0xC5, 0x7B, 0xFF, 0x67, 0x94, 0xFF, 0xC5, 0x73, 0xFF, 0x87, 0x8C, 0xFF, 0x29, 0x9D, 0xFF, 0x49, 0x9D, 0xFF, 0x6A, 0xA5, 0xFF, 0x8B, 0xAD, 0xFF, 0x29, 0x9D, 0xFF, 0x0E, 0xD7, 0xFF, 0x49, 0xA5, 0xFF, 0xC2, 0x39, 0xFF, 0x84, 0x4A, 0xFF, 0xC4, 0x52, 0xFF, 0x2A, 0x95, 0xFF, 0x09, 0x95, 0xFF, 0x45, 0x53, 0xFF, 0x25, 0x5B, 0xFF, 0xA3, 0x4A, 0xFF, 0x05, 0x5B, 0xFF, 0x6A, 0xA5, 0xFF, 0xCA, 0x8C, 0xFF, 0x29, 0x7C, 0xFF, 0x87, 0x84, 0xFF, 0xEF, 0xAE, 0xFF, 0xAD, 0xC6, 0xFF, 0xD1, 0xEF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0x8D, 0xBE, 0xFF, 0x2A, 0x9D, 0xFF, 0xA6, 0x73, 0xFF, 0x2C, 0xBE, 0xFF, 0xAB, 0xAD, 0xFF, 0x8C, 0xAD, 0xFF, 0x07, 0x7C, 0xFF, 0x89, 0x8C, 0xFF, 0xF9, 0xFF, 0xFF, 0x47, 0x8C, 0xFF, 0x73, 0xEF, 0xFF, 0x2D, 0xC6, 0xFF, 0xEC, 0xBD, 0xFF, 0x8B, 0xB5, 0xFF, 0xF4, 0xFF, 0xFF, 0x09, 0xAD, 0xFF, 0x09, 0xAD, 0xFF, 0x4A, 0xAD, 0xFF, 0x2A, 0xAD, 0xFF, 0xF2, 0xFF, 0xFF, 0xCC, 0xBD, 0xFF, 0x88, 0x94, 0xFF, 0x88, 0x94, 0xFF, 0x6D, 0xC6, 0xFF, 0xB0, 0xF7, 0xFF, 0x4A, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xBE, 0xFF, 0xAC, 0xB5, 0xFF, 0x10, 0xE7, 0xFF, 0xA8, 0x94, 0xFF, 0x8F, 0xD6, 0xFF, 0x4A, 0xAD, 0xFF, 0x0A, 0xA5, 0xFF, 0xA8, 0x94, 0xFF, 0x2F, 0xDF, 0xFF, 0xA9, 0x9C, 0xFF, 0x89, 0x8C, 0xFF, 0xCC, 0xB5, 0xFF, 0x4C, 0xCE, 0xFF, 0xB1, 0xEF, 0xFF, 0x2A, 0xA5, 0xFF, 0x0A, 0x9D, 0xFF, 0x2E, 0xDF, 0xFF, 0xC9, 0x94, 0xFF, 0xCE, 0xD6, 0xFF, 0xE9, 0x9C, 0xFF, 0x2D, 0xBE, 0xFF, 0x28, 0x7C, 0xFF, 0xE6, 0x73, 0xFF, 0xEF, 0xD6, 0xFF, 0x0F, 0xDF, 0xFF, 0x27, 0x7C, 0xFF, 0x89, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0x29, 0x9D, 0xFF, 0xF2, 0xFF, 0xFF, 0x4A, 0xA5, 0xFF, 0x4A, 0x9D, 0xFF, 0xC8, 0x8C, 0xFF, 0x49, 0x9D, 0xFF, 0xF2, 0xFF, 0xFF, 0x29, 0x9D, 0xFF,
-    0x63, 0x42, 0xFF, 0xA8, 0x94, 0xFF, 0x43, 0x42, 0xFF, 0xEB, 0x94, 0xFF, 0xC5, 0x52, 0xFF, 0xCB, 0x94, 0xFF, 0x09, 0x9D, 0xFF, 0x46, 0x63, 0xFF, 0x45, 0x5B, 0xFF, 0xA6, 0x6B, 0xFF, 0xEC, 0x94, 0xFF, 0xAF, 0xCE, 0xFF, 0x27, 0x7C, 0xFF, 0x48, 0x7C, 0xFF, 0xC9, 0x8C, 0xFF, 0x6A, 0x9D, 0xFF, 0x2B, 0xB6, 0xFF, 0x52, 0xD7, 0xFF, 0x87, 0x84, 0xFF, 0xC8, 0x8C, 0xFF, 0xA9, 0x8C, 0xFF, 0xEC, 0xBD, 0xFF, 0xAC, 0xB5, 0xFF, 0x2A, 0x9D, 0xFF, 0x88, 0x8C, 0xFF, 0x49, 0xA5, 0xFF, 0xEF, 0xDE, 0xFF, 0xA9, 0x9C, 0xFF, 0xC9, 0x9C, 0xFF, 0x10, 0xE7, 0xFF, 0x0D, 0xC6, 0xFF, 0x70, 0xF7, 0xFF, 0x49, 0xB5, 0xFF, 0x6D, 0xC6, 0xFF, 0xC8, 0x9C, 0xFF, 0x6B, 0xB5, 0xFF, 0x50, 0xEF, 0xFF, 0x4A, 0xAD, 0xFF, 0x88, 0x94, 0xFF, 0x89, 0x94, 0xFF, 0x6B, 0xAD, 0xFF, 0xF2, 0xFF, 0xFF, 0x6E, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xC6, 0xFF, 0x0A, 0xA5, 0xFF, 0x91, 0xF7, 0xFF, 0x90, 0xEF, 0xFF, 0x68, 0x94, 0xFF, 0x4B, 0xAD, 0xFF, 0xC8, 0x94, 0xFF, 0x0E, 0xE7, 0xFF, 0x8C, 0xB5, 0xFF, 0x8B, 0xB5, 0xFF, 0x09, 0x9D, 0xFF, 0x30, 0xE7, 0xFF, 0x30, 0xEF, 0xFF, 0x09, 0xA5, 0xFF, 0x10, 0xDF, 0xFF, 0xAE, 0xCE, 0xFF, 0x28, 0x8C, 0xFF, 0xCE, 0xDE, 0xFF, 0x2D, 0xBE, 0xFF, 0x48, 0x8C, 0xFF,
-    0x68, 0x8C, 0xFF, 0x06, 0x7C, 0xFF, 0xEE, 0xDE, 0xFF, 0x67, 0x84, 0xFF, 0x47, 0x7C, 0xFF, 0x67, 0x84, 0xFF, 0xA8, 0x8C, 0xFF, 0x8A, 0xB5, 0xFF, 0xAC, 0xB5, 0xFF, 0xC8, 0x94, 0xFF, 0xE9, 0x94, 0xFF, 0xCF, 0xCE, 0xFF, 0xAA, 0xAD, 0xFF, 0x6E, 0xC6, 0xFF, 0x29, 0x9D, 0xFF, 0x29, 0x9D, 0xFF, 0x23, 0x42, 0xFF, 0xC5, 0x52, 0xFF, 0x43, 0x42, 0xFF, 0x43, 0x42, 0xFF, 0x05, 0x5B, 0xFF, 0x48, 0x7C, 0xFF, 0x02, 0x3A, 0xFF, 0x87, 0x6B, 0xFF, 0xE5, 0x52, 0xFF, 0xE6, 0x73, 0xFF, 0x26, 0x5B, 0xFF, 0x66, 0x6B, 0xFF, 0xE5, 0x52, 0xFF, 0x45, 0x63, 0xFF, 0x4A, 0x9D, 0xFF, 0x44, 0x63, 0xFF, 0x89, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0xCC, 0xB5, 0xFF, 0x27, 0x7C, 0xFF, 0xA9, 0x8C, 0xFF, 0x68, 0x8C, 0xFF, 0xAF, 0xD6, 0xFF, 0x31, 0xE7, 0xFF, 0x6E, 0xC6, 0xFF, 0x68, 0x8C, 0xFF, 0xA9, 0x94, 0xFF, 0xAE, 0xDE, 0xFF, 0xE9, 0x9C, 0xFF, 0x0A, 0xA5, 0xFF, 0xEC, 0xC5, 0xFF, 0xC8, 0x9C, 0xFF, 0x09, 0xB5, 0xFF, 0xE9, 0xA4, 0xFF, 0x6B, 0xAD, 0xFF, 0x09, 0xA5, 0xFF, 0x8D, 0xDE, 0xFF, 0x8B, 0xB5, 0xFF, 0x48, 0x8C, 0xFF, 0xC7, 0x83, 0xFF, 0x6E, 0xCE, 0xFF, 0xB0, 0xFF, 0xFF, 0x8A, 0xB5, 0xFF, 0x29, 0xA5, 0xFF, 0xA9, 0x9C, 0xFF, 0xCB, 0xBD, 0xFF, 0x09, 0xA5, 0xFF, 0xCC, 0xBD, 0xFF,
-    0xA9, 0x94, 0xFF, 0x09, 0xA5, 0xFF, 0xF4, 0xFF, 0xFF, 0x67, 0x94, 0xFF, 0x68, 0x8C, 0xFF, 0x4B, 0xAD, 0xFF, 0x4A, 0xAD, 0xFF, 0xAE, 0xDE, 0xFF, 0x0A, 0xA5, 0xFF, 0x6B, 0xAD, 0xFF, 0x0A, 0xAD, 0xFF, 0xB2, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x68, 0x94, 0xFF, 0x28, 0x8C, 0xFF, 0xCC, 0xBD, 0xFF, 0xAE, 0xD6, 0xFF, 0x2A, 0xAD, 0xFF, 0x88, 0x8C, 0xFF, 0xC9, 0x94, 0xFF, 0x67, 0x84, 0xFF, 0xEE, 0xDE, 0xFF, 0x2A, 0x9D, 0xFF, 0x88, 0x8C, 0xFF, 0xC9, 0x94, 0xFF, 0x87, 0x8C, 0xFF, 0x4D, 0xC6, 0xFF, 0x4A, 0x9D, 0xFF, 0x27, 0x7C, 0xFF, 0xAA, 0xAD, 0xFF, 0x8A, 0xA5, 0xFF, 0xAA, 0xAD, 0xFF, 0x23, 0x42, 0xFF, 0x43, 0x42, 0xFF, 0xE6, 0x52, 0xFF, 0x84, 0x4A, 0xFF, 0x85, 0x4A, 0xFF, 0x63, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0xE6, 0x5A, 0xFF, 0x6D, 0xA5, 0xFF, 0xE4, 0x52, 0xFF, 0x83, 0x4A, 0xFF, 0xE8, 0x73, 0xFF, 0x88, 0x84, 0xFF, 0x66, 0x63, 0xFF, 0xA7, 0x6B, 0xFF, 0x8D, 0xAD, 0xFF, 0xC9, 0x94, 0xFF, 0x86, 0x6B, 0xFF, 0x86, 0x6B, 0xFF, 0x06, 0x7C, 0xFF, 0x8A, 0xA5, 0xFF, 0xEA, 0x9C, 0xFF, 0x8B, 0xA5, 0xFF, 0xC6, 0x73, 0xFF, 0xEC, 0xBD, 0xFF, 0x29, 0x9D, 0xFF, 0x68, 0x94, 0xFF, 0xA9, 0x9C, 0xFF, 0x8E, 0xD6, 0xFF, 0x2A, 0xB5, 0xFF, 0x4A, 0xBD, 0xFF, 0xEC, 0xC5, 0xFF,
-    0x8E, 0xDE, 0xFF, 0x09, 0xAD, 0xFF, 0x6A, 0xAD, 0xFF, 0xCC, 0xBD, 0xFF, 0xCB, 0xBD, 0xFF, 0x52, 0xEF, 0xFF, 0x48, 0x8C, 0xFF, 0x86, 0x7B, 0xFF, 0xEC, 0xBD, 0xFF, 0x0C, 0xCE, 0xFF, 0x6B, 0xB5, 0xFF, 0x6B, 0xA5, 0xFF, 0xA8, 0x9C, 0xFF, 0xF4, 0xFF, 0xFF, 0x67, 0x8C, 0xFF, 0xE9, 0xA4, 0xFF, 0x88, 0x94, 0xFF, 0xCB, 0xC5, 0xFF, 0xCB, 0xBD, 0xFF, 0xA8, 0x9C, 0xFF, 0xE9, 0xA4, 0xFF, 0xD3, 0xFF, 0xFF, 0x2A, 0xAD, 0xFF, 0x6B, 0xAD, 0xFF, 0x4A, 0xAD, 0xFF, 0xD2, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x0F, 0xE7, 0xFF, 0x0B, 0xCE, 0xFF, 0xFA, 0xFF, 0xFF, 0x30, 0xEF, 0xFF, 0x09, 0xAD, 0xFF, 0xEC, 0xCD, 0xFF, 0xFB, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x09, 0xA5, 0xFF, 0xF3, 0xDF, 0xFF, 0xA9, 0xAD, 0xFF, 0x96, 0xF7, 0xFF, 0xA7, 0x94, 0xFF, 0x09, 0x9D, 0xFF, 0x09, 0x9D, 0xFF, 0x2A, 0xA5, 0xFF, 0xEB, 0xB5, 0xFF, 0x87, 0x94, 0xFF, 0x8A, 0xAD, 0xFF, 0xD3, 0xEF, 0xFF, 0x09, 0xA5, 0xFF, 0xE2, 0x39, 0xFF, 0x24, 0x42, 0xFF, 0x47, 0x63, 0xFF, 0x84, 0x4A, 0xFF, 0x64, 0x4A, 0xFF, 0x43, 0x42, 0xFF, 0xC5, 0x52, 0xFF, 0x47, 0x63, 0xFF, 0xA5, 0x4A, 0xFF, 0xA5, 0x52, 0xFF, 0x28, 0x7C, 0xFF, 0x45, 0x63, 0xFF, 0xC4, 0x52, 0xFF, 0xA3, 0x52, 0xFF, 0xC5, 0x6B, 0xFF, 0xC6, 0x73, 0xFF,
-    0x66, 0x6B, 0xFF, 0xA9, 0x8C, 0xFF, 0xA8, 0x84, 0xFF, 0xE7, 0x73, 0xFF, 0x87, 0x6B, 0xFF, 0xEA, 0x9C, 0xFF, 0x07, 0x84, 0xFF, 0x07, 0x84, 0xFF, 0x68, 0x8C, 0xFF, 0x0A, 0xA5, 0xFF, 0x87, 0x8C, 0xFF, 0x48, 0x94, 0xFF, 0x8B, 0xBD, 0xFF, 0x4D, 0xDE, 0xFF, 0xAE, 0xFE, 0xFF, 0x2C, 0xE6, 0xFF, 0x8A, 0xC5, 0xFF, 0x8D, 0xD6, 0xFF, 0x2A, 0xB5, 0xFF, 0x6B, 0xB5, 0xFF, 0x0A, 0xA5, 0xFF, 0x2A, 0xAD, 0xFF, 0x69, 0x94, 0xFF, 0x89, 0x94, 0xFF, 0x2A, 0x9D, 0xFF, 0xA9, 0x94, 0xFF, 0x0A, 0xAD, 0xFF, 0x48, 0x84, 0xFF, 0xEF, 0xDE, 0xFF, 0x6B, 0xAD, 0xFF, 0xA9, 0x94, 0xFF, 0xE9, 0xA4, 0xFF, 0xEC, 0xC5, 0xFF, 0xAC, 0xBD, 0xFF, 0x2A, 0xA5, 0xFF, 0x0A, 0xAD, 0xFF, 0xFE, 0xFF, 0xFF, 0xAB, 0xBD, 0xFF, 0x4A, 0xA5, 0xFF, 0x8B, 0xB5, 0xFF, 0xF5, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x71, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xC6, 0xFF, 0xAE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xCB, 0xC5, 0xFF, 0xDF, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0x30, 0xDF, 0xFF, 0xC8, 0x94, 0xFF, 0xC8, 0x9C, 0xFF, 0xA8, 0x9C, 0xFF, 0x6C, 0xC6, 0xFF, 0xCF, 0xDE, 0xFF, 0x29, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF7, 0xFF, 0xEA, 0xBD, 0xFF, 0xD4, 0xFF, 0xFF,
-    0x84, 0x4A, 0xFF, 0x44, 0x42, 0xFF, 0xC5, 0x52, 0xFF, 0x25, 0x5B, 0xFF, 0x0A, 0x95, 0xFF, 0x67, 0x6B, 0xFF, 0xE5, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0x84, 0x52, 0xFF, 0x89, 0x8C, 0xFF, 0x25, 0x63, 0xFF, 0xC4, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0x04, 0x5B, 0xFF, 0x05, 0x5B, 0xFF, 0x47, 0x7C, 0xFF, 0x69, 0x84, 0xFF, 0x69, 0x84, 0xFF, 0x65, 0x63, 0xFF, 0xE7, 0x7B, 0xFF, 0xE9, 0x94, 0xFF, 0x69, 0x8C, 0xFF, 0x69, 0x8C, 0xFF, 0xE9, 0x94, 0xFF, 0xC9, 0x9C, 0xFF, 0xA8, 0x9C, 0xFF, 0xC8, 0x9C, 0xFF, 0x0D, 0xC6, 0xFF, 0xAC, 0xC5, 0xFF, 0x6D, 0xF6, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x30, 0xF7, 0xFF, 0xEC, 0xCD, 0xFF, 0x29, 0xAD, 0xFF, 0xAB, 0xC5, 0xFF, 0xEC, 0xBD, 0xFF, 0x4E, 0xC6, 0xFF, 0x68, 0x8C, 0xFF, 0x89, 0x94, 0xFF, 0xE9, 0x94, 0xFF, 0xCC, 0xBD, 0xFF, 0x09, 0xAD, 0xFF, 0x0A, 0x9D, 0xFF, 0xCC, 0xBD, 0xFF, 0xCB, 0xBD, 0xFF, 0x0A, 0xA5, 0xFF, 0xEC, 0xC5, 0xFF, 0xD0, 0xDE, 0xFF, 0x2D, 0xCE, 0xFF, 0x2D, 0xCE, 0xFF, 0xAE, 0xDE, 0xFF, 0x6A, 0xB5, 0xFF, 0xF0, 0xDE, 0xFF, 0x90, 0xE7, 0xFF, 0xAB, 0xBD, 0xFF, 0xE9, 0xA4, 0xFF, 0xAA, 0xBD, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x0C, 0xC6, 0xFF, 0x4F, 0xE7, 0xFF, 0xF9, 0xFF, 0xFF, 0x2D, 0xD6, 0xFF,
-    0x4D, 0xCE, 0xFF, 0x4E, 0xCE, 0xFF, 0xA7, 0x94, 0xFF, 0x4A, 0xAD, 0xFF, 0xA8, 0x8C, 0xFF, 0xC9, 0x94, 0xFF, 0xC9, 0x94, 0xFF, 0x6A, 0xA5, 0xFF, 0x6A, 0xAD, 0xFF, 0xD2, 0xEF, 0xFF, 0x48, 0xA5, 0xFF, 0xAA, 0xAD, 0xFF, 0xE9, 0xA4, 0xFF, 0xAA, 0xAD, 0xFF, 0xAC, 0xB5, 0xFF, 0x4C, 0xC6, 0xFF, 0x2A, 0x7C, 0xFF, 0x2A, 0x95, 0xFF, 0x64, 0x4A, 0xFF, 0x28, 0x7C, 0xFF, 0x85, 0x6B, 0xFF, 0xAA, 0x7C, 0xFF, 0xE9, 0x94, 0xFF, 0xE4, 0x52, 0xFF, 0xE9, 0x94, 0xFF, 0xA4, 0x4A, 0xFF, 0x83, 0x52, 0xFF, 0x2A, 0xA5, 0xFF, 0x6B, 0xA5, 0xFF, 0xE7, 0x7B, 0xFF, 0x25, 0x5B, 0xFF, 0x04, 0x5B, 0xFF, 0x6A, 0xA5, 0xFF, 0x6B, 0xAD, 0xFF, 0x24, 0x5B, 0xFF, 0x69, 0x8C, 0xFF, 0x45, 0x63, 0xFF, 0x4C, 0xC6, 0xFF, 0xEB, 0xBD, 0xFF, 0x07, 0x84, 0xFF, 0x8A, 0xB5, 0xFF, 0xFE, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0x74, 0xEF, 0xFF, 0x2C, 0xCE, 0xFF, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x6B, 0xBD, 0xFF, 0x0C, 0xC6, 0xFF, 0x2A, 0xB5, 0xFF, 0xD3, 0xF7, 0xFF, 0xCB, 0xC5, 0xFF, 0x68, 0x8C, 0xFF, 0x68, 0x94, 0xFF, 0xCC, 0xB5, 0xFF, 0xF2, 0xFF, 0xFF, 0x2D, 0xD6, 0xFF, 0x2A, 0xAD, 0xFF, 0x2A, 0xB5, 0xFF, 0x0C, 0xCE, 0xFF, 0xF2, 0xFF, 0xFF, 0x0C, 0xCE, 0xFF,
-    0x0A, 0xAD, 0xFF, 0x0C, 0xCE, 0xFF, 0xED, 0xCD, 0xFF, 0xF6, 0xFF, 0xFF, 0x2D, 0xCE, 0xFF, 0xEC, 0xCD, 0xFF, 0x0A, 0xAD, 0xFF, 0xEC, 0xC5, 0xFF, 0xF1, 0xFF, 0xFF, 0x8B, 0xBD, 0xFF, 0x0C, 0xC6, 0xFF, 0x8C, 0xBD, 0xFF, 0x09, 0xAD, 0xFF, 0x91, 0xF7, 0xFF, 0xF8, 0xFF, 0xFF, 0xCC, 0xC5, 0xFF, 0xA8, 0x9C, 0xFF, 0xC9, 0x9C, 0xFF, 0x50, 0xF7, 0xFF, 0xD1, 0xFF, 0xFF, 0x67, 0x8C, 0xFF, 0xE8, 0x9C, 0xFF, 0x4C, 0xC6, 0xFF, 0xF2, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x2A, 0xA5, 0xFF, 0xE9, 0x9C, 0xFF, 0x2E, 0xDF, 0xFF, 0xAE, 0xCE, 0xFF, 0xD1, 0xF7, 0xFF, 0xAA, 0xB5, 0xFF, 0x09, 0x9D, 0xFF, 0xE9, 0x73, 0xFF, 0xC5, 0x4A, 0xFF, 0x63, 0x42, 0xFF, 0xC8, 0x73, 0xFF, 0x64, 0x42, 0xFF, 0x6A, 0x84, 0xFF, 0x6B, 0x9D, 0xFF, 0xA4, 0x52, 0xFF, 0xEA, 0x94, 0xFF, 0xA4, 0x52, 0xFF, 0xEE, 0xB5, 0xFF, 0xF2, 0xDE, 0xFF, 0xCD, 0xB5, 0xFF, 0x04, 0x5B, 0xFF, 0x0B, 0x9D, 0xFF, 0xCF, 0xCE, 0xFF, 0x4B, 0xA5, 0xFF, 0xC7, 0x73, 0xFF, 0x24, 0x5B, 0xFF, 0x6B, 0xAD, 0xFF, 0xAD, 0xB5, 0xFF, 0x68, 0x8C, 0xFF, 0x07, 0x84, 0xFF, 0x4C, 0xC6, 0xFF, 0x6A, 0xAD, 0xFF, 0x0C, 0xC6, 0xFF, 0x2A, 0xA5, 0xFF, 0x50, 0xEF, 0xFF, 0xCF, 0xE6, 0xFF, 0xEC, 0xD5, 0xFF, 0xF8, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xF4, 0xFF, 0xFF, 0x4D, 0xD6, 0xFF, 0xE8, 0xA4, 0xFF, 0x8C, 0xDE, 0xFF, 0x8E, 0xDE, 0xFF, 0x88, 0x94, 0xFF, 0x68, 0x8C, 0xFF, 0x68, 0x8C, 0xFF, 0xEC, 0xBD, 0xFF, 0xF5, 0xF7, 0xFF, 0xCB, 0xCD, 0xFF, 0x2A, 0xAD, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x4A, 0xBD, 0xFF, 0x8E, 0xDE, 0xFF, 0xAB, 0xBD, 0xFF, 0xD3, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x6D, 0xE6, 0xFF, 0xCC, 0xCD, 0xFF, 0xAD, 0xDE, 0xFF, 0x91, 0xFF, 0xFF, 0x0D, 0xCE, 0xFF, 0xAC, 0xBD, 0xFF, 0xAC, 0xBD, 0xFF, 0x50, 0xF7, 0xFF, 0x30, 0xEF, 0xFF, 0x68, 0x94, 0xFF, 0x47, 0x94, 0xFF, 0x70, 0xFF, 0xFF, 0x29, 0xAD, 0xFF, 0x0A, 0xA5, 0xFF, 0x68, 0x94, 0xFF, 0xF4, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xC8, 0x9C, 0xFF, 0xE8, 0xA4, 0xFF, 0xEE, 0xDE, 0xFF, 0x0A, 0x9D, 0xFF, 0x6D, 0xCE, 0xFF, 0x2A, 0xA5, 0xFF, 0xA8, 0x8C, 0xFF, 0xCB, 0xB5, 0xFF, 0x09, 0x9D, 0xFF, 0xAA, 0xAD, 0xFF, 0x4A, 0xA5, 0xFF, 0xEB, 0xBD, 0xFF, 0x68, 0x84, 0xFF, 0x64, 0x42, 0xFF, 0x84, 0x4A, 0xFF, 0x26, 0x63, 0xFF, 0x27, 0x5B, 0xFF, 0x28, 0x7C, 0xFF, 0xC5, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0xE6, 0x5A, 0xFF, 0xA4, 0x4A, 0xFF, 0x89, 0x8C, 0xFF, 0xCE, 0xAD, 0xFF, 0xA7, 0x6B, 0xFF, 0xF2, 0xDE, 0xFF, 0x27, 0x84, 0xFF, 0x89, 0x8C, 0xFF,
-    0x89, 0x84, 0xFF, 0x46, 0x63, 0xFF, 0x4A, 0x9D, 0xFF, 0x68, 0x84, 0xFF, 0xA7, 0x6B, 0xFF, 0xAB, 0xB5, 0xFF, 0x0A, 0x9D, 0xFF, 0x46, 0x84, 0xFF, 0x29, 0xA5, 0xFF, 0x87, 0x94, 0xFF, 0x2C, 0xC6, 0xFF, 0x0D, 0xC6, 0xFF, 0x6A, 0xB5, 0xFF, 0xEF, 0xE6, 0xFF, 0xAE, 0xEE, 0xFF, 0x4A, 0xB5, 0xFF, 0x2D, 0xD6, 0xFF, 0xEE, 0xD6, 0xFF, 0x87, 0x94, 0xFF, 0xD3, 0xFF, 0xFF, 0xCB, 0xBD, 0xFF, 0x8A, 0xB5, 0xFF, 0x48, 0x8C, 0xFF, 0x68, 0x8C, 0xFF, 0x4B, 0xB5, 0xFF, 0x6B, 0xAD, 0xFF, 0x71, 0xFF, 0xFF, 0x4A, 0xB5, 0xFF, 0xF6, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x6D, 0xDE, 0xFF, 0xAE, 0xDE, 0xFF, 0xD4, 0xFF, 0xFF, 0x30, 0xEF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x8F, 0xE6, 0xFF, 0x4A, 0xB5, 0xFF, 0x30, 0xEF, 0xFF, 0xF2, 0xFF, 0xFF, 0xEA, 0xA4, 0xFF, 0x91, 0xEF, 0xFF, 0x91, 0xE7, 0xFF, 0xD2, 0xF7, 0xFF, 0x48, 0x8C, 0xFF, 0x2A, 0xA5, 0xFF, 0xAC, 0xBD, 0xFF, 0xC9, 0xA4, 0xFF, 0x68, 0x94, 0xFF, 0x70, 0xE7, 0xFF, 0xA8, 0x94, 0xFF, 0x68, 0x94, 0xFF, 0x2D, 0xCE, 0xFF, 0x2A, 0xA5, 0xFF, 0x29, 0xAD, 0xFF, 0xEC, 0xBD, 0xFF, 0x4A, 0xA5, 0xFF, 0xC9, 0x9C, 0xFF, 0xAA, 0xAD, 0xFF, 0x4A, 0xA5, 0xFF, 0x49, 0xA5, 0xFF, 0x49, 0xA5, 0xFF, 0x8A, 0xAD, 0xFF,
-    0x42, 0x42, 0xFF, 0x44, 0x42, 0xFF, 0xA5, 0x4A, 0xFF, 0x84, 0x42, 0xFF, 0xEF, 0xBD, 0xFF, 0xA3, 0x4A, 0xFF, 0xA5, 0x4A, 0xFF, 0x63, 0x4A, 0xFF, 0xA4, 0x52, 0xFF, 0x84, 0x4A, 0xFF, 0xE8, 0x94, 0xFF, 0xCD, 0xAD, 0xFF, 0xE3, 0x52, 0xFF, 0x2C, 0xA5, 0xFF, 0x86, 0x6B, 0xFF, 0x07, 0x7C, 0xFF, 0x86, 0x63, 0xFF, 0xC7, 0x73, 0xFF, 0x07, 0x7C, 0xFF, 0x67, 0x84, 0xFF, 0x86, 0x6B, 0xFF, 0x47, 0x8C, 0xFF, 0x2A, 0x9D, 0xFF, 0xE7, 0x7B, 0xFF, 0xD0, 0xD6, 0xFF, 0xE9, 0x9C, 0xFF, 0x88, 0x8C, 0xFF, 0xB0, 0xD6, 0xFF, 0x8B, 0xB5, 0xFF, 0xC8, 0xA4, 0xFF, 0x8B, 0xBD, 0xFF, 0xCC, 0xBD, 0xFF, 0xF8, 0xFF, 0xFF, 0x2A, 0xA5, 0xFF, 0xAC, 0xB5, 0xFF, 0x2D, 0xD6, 0xFF, 0xEC, 0xBD, 0xFF, 0x6A, 0xAD, 0xFF, 0x06, 0x7C, 0xFF, 0x68, 0x8C, 0xFF, 0x6A, 0xA5, 0xFF, 0xC8, 0x94, 0xFF, 0x30, 0xF7, 0xFF, 0xCB, 0xBD, 0xFF, 0x6E, 0xDE, 0xFF, 0x51, 0xFF, 0xFF, 0xCF, 0xE6, 0xFF, 0xEF, 0xE6, 0xFF, 0xCF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xB1, 0xFF, 0xFF, 0x31, 0xF7, 0xFF, 0x8E, 0xDE, 0xFF, 0x4D, 0xD6, 0xFF, 0xF0, 0xE6, 0xFF, 0xE9, 0xA4, 0xFF, 0x2D, 0xCE, 0xFF, 0x0D, 0xCE, 0xFF, 0xAA, 0x9C, 0xFF, 0xCA, 0x9C, 0xFF, 0xCC, 0xB5, 0xFF, 0x6B, 0xB5, 0xFF,
-    0x27, 0x8C, 0xFF, 0x89, 0x94, 0xFF, 0xC9, 0xA4, 0xFF, 0xE9, 0xA4, 0xFF, 0xA8, 0x94, 0xFF, 0x6E, 0xD6, 0xFF, 0x8A, 0xBD, 0xFF, 0x2D, 0xD6, 0xFF, 0x8A, 0xB5, 0xFF, 0xCB, 0xB5, 0xFF, 0x4A, 0xA5, 0xFF, 0x8A, 0xAD, 0xFF, 0x4A, 0xAD, 0xFF, 0x4A, 0xA5, 0xFF, 0xFD, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xE2, 0x31, 0xFF, 0x23, 0x3A, 0xFF, 0x64, 0x4A, 0xFF, 0x44, 0x42, 0xFF, 0xA8, 0x6B, 0xFF, 0x43, 0x42, 0xFF, 0x84, 0x4A, 0xFF, 0x63, 0x42, 0xFF, 0xA5, 0x4A, 0xFF, 0x06, 0x5B, 0xFF, 0x26, 0x63, 0xFF, 0x66, 0x6B, 0xFF, 0xE5, 0x5A, 0xFF, 0x86, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0x25, 0x63, 0xFF, 0xE4, 0x52, 0xFF, 0x28, 0x84, 0xFF, 0x0E, 0xB6, 0xFF, 0x45, 0x63, 0xFF, 0x66, 0x63, 0xFF, 0x07, 0x84, 0xFF, 0xA6, 0x73, 0xFF, 0xC6, 0x73, 0xFF, 0x2A, 0xA5, 0xFF, 0x28, 0x84, 0xFF, 0x07, 0x84, 0xFF, 0x4B, 0xAD, 0xFF, 0xA9, 0x9C, 0xFF, 0x68, 0x94, 0xFF, 0xC9, 0xA4, 0xFF, 0x69, 0x94, 0xFF, 0xCC, 0xBD, 0xFF, 0xF0, 0xDE, 0xFF, 0x27, 0x8C, 0xFF, 0x2A, 0xAD, 0xFF, 0x2A, 0xA5, 0xFF, 0x68, 0x84, 0xFF, 0x27, 0x84, 0xFF, 0x48, 0x84, 0xFF, 0x48, 0x8C, 0xFF, 0x8C, 0xBD, 0xFF, 0x8B, 0xBD, 0xFF, 0xE9, 0x9C, 0xFF, 0xAB, 0xBD, 0xFF, 0xEC, 0xCD, 0xFF, 0xCC, 0xC5, 0xFF, 0x10, 0xEF, 0xFF,
-    0x4D, 0xDE, 0xFF, 0x30, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF0, 0xFE, 0xFF, 0x4E, 0xDE, 0xFF, 0x2D, 0xD6, 0xFF, 0xAB, 0xC5, 0xFF, 0x2A, 0xAD, 0xFF, 0x6B, 0xB5, 0xFF, 0x2A, 0xAD, 0xFF, 0x89, 0x94, 0xFF, 0x48, 0x8C, 0xFF, 0x48, 0x8C, 0xFF, 0xA9, 0x9C, 0xFF, 0x48, 0x8C, 0xFF, 0x47, 0x84, 0xFF, 0xC9, 0x94, 0xFF, 0xC9, 0x9C, 0xFF, 0x09, 0xAD, 0xFF, 0xAE, 0xEE, 0xFF, 0xB1, 0xFF, 0xFF, 0x30, 0xFF, 0xFF, 0x6D, 0xE6, 0xFF, 0x8A, 0xB5, 0xFF, 0x6A, 0xA5, 0xFF, 0x6A, 0xA5, 0xFF, 0x4A, 0xAD, 0xFF, 0x49, 0xA5, 0xFF, 0x4A, 0xA5, 0xFF, 0x29, 0xA5, 0xFF, 0x43, 0x42, 0xFF, 0x27, 0x7C, 0xFF, 0xC5, 0x52, 0xFF, 0x28, 0x84, 0xFF, 0xA9, 0x8C, 0xFF, 0xA6, 0x73, 0xFF, 0xA8, 0x8C, 0xFF, 0x8C, 0xA5, 0xFF, 0xAF, 0xCE, 0xFF, 0xEC, 0xB5, 0xFF, 0xCD, 0xB5, 0xFF, 0x04, 0x63, 0xFF, 0xCD, 0xC5, 0xFF, 0x2D, 0xC6, 0xFF, 0x4E, 0xC6, 0xFF, 0xF6, 0xFF, 0xFF, 0xCC, 0xB5, 0xFF, 0x2D, 0xC6, 0xFF, 0xA9, 0x9C, 0xFF, 0xA6, 0x73, 0xFF, 0x31, 0xE7, 0xFF, 0x0D, 0xC6, 0xFF, 0x2C, 0xC6, 0xFF, 0x2D, 0xC6, 0xFF, 0x88, 0x94, 0xFF, 0x47, 0x8C, 0xFF, 0x71, 0xEF, 0xFF, 0x29, 0xA5, 0xFF, 0x6A, 0xB5, 0xFF, 0x89, 0x94, 0xFF, 0x27, 0x8C, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xAE, 0xDE, 0xFF, 0xA8, 0x9C, 0xFF, 0x47, 0x8C, 0xFF, 0xED, 0xC5, 0xFF, 0xB1, 0xF7, 0xFF, 0xAE, 0xD6, 0xFF, 0x69, 0x8C, 0xFF, 0x68, 0x8C, 0xFF, 0x4B, 0xB5, 0xFF, 0xF1, 0xFF, 0xFF, 0x0C, 0xCE, 0xFF, 0xC9, 0xA4, 0xFF, 0x0D, 0xCE, 0xFF, 0xF4, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xD8, 0xFF, 0xFF, 0x4E, 0xDE, 0xFF, 0x30, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x4B, 0xB5, 0xFF, 0x88, 0x9C, 0xFF, 0xCE, 0xE6, 0xFF, 0x70, 0xEF, 0xFF, 0x71, 0xF7, 0xFF, 0x2E, 0xD6, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x4D, 0xC6, 0xFF, 0xF4, 0xFF, 0xFF, 0x69, 0xB5, 0xFF, 0xF1, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEB, 0xBD, 0xFF, 0x64, 0x4A, 0xFF, 0x64, 0x42, 0xFF, 0x84, 0x4A, 0xFF, 0xEA, 0x74, 0xFF, 0xA4, 0x4A, 0xFF, 0xA5, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0xE8, 0x73, 0xFF, 0xA5, 0x52, 0xFF, 0xA5, 0x4A, 0xFF, 0x45, 0x5B, 0xFF, 0xA3, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0xE4, 0x5A, 0xFF, 0xAA, 0x94, 0xFF, 0x69, 0x8C, 0xFF,
-    0xE7, 0x7B, 0xFF, 0x07, 0x7C, 0xFF, 0xA9, 0x94, 0xFF, 0x06, 0x7C, 0xFF, 0x85, 0x6B, 0xFF, 0x67, 0x84, 0xFF, 0x88, 0x94, 0xFF, 0xB2, 0xEF, 0xFF, 0x4A, 0xAD, 0xFF, 0xA9, 0x94, 0xFF, 0xB3, 0xF7, 0xFF, 0x46, 0x84, 0xFF, 0x08, 0x9D, 0xFF, 0x6F, 0xB6, 0xFF, 0x4A, 0xB5, 0xFF, 0x0A, 0x9D, 0xFF, 0xAF, 0xD6, 0xFF, 0x66, 0x94, 0xFF, 0xAB, 0xB5, 0xFF, 0xAE, 0xDE, 0xFF, 0x71, 0xEF, 0xFF, 0xF2, 0xFF, 0xFF, 0x68, 0x8C, 0xFF, 0x48, 0x8C, 0xFF, 0xAC, 0xBD, 0xFF, 0x0F, 0xE7, 0xFF, 0x72, 0xFF, 0xFF, 0x09, 0xAD, 0xFF, 0x4E, 0xD6, 0xFF, 0x0A, 0xAD, 0xFF, 0xEC, 0xC5, 0xFF, 0xB4, 0xF7, 0xFF, 0xAB, 0xBD, 0xFF, 0x30, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCE, 0xD6, 0xFF, 0xEF, 0xE6, 0xFF, 0x71, 0xEF, 0xFF, 0x50, 0xEF, 0xFF, 0x8E, 0xCE, 0xFF, 0x4D, 0xC6, 0xFF, 0x2C, 0xBE, 0xFF, 0x8A, 0xB5, 0xFF, 0x8D, 0xCE, 0xFF, 0x4D, 0xCE, 0xFF, 0xEB, 0xC5, 0xFF, 0x4D, 0xCE, 0xFF, 0x4C, 0xD6, 0xFF, 0xF3, 0xFF, 0xFF, 0x70, 0xFF, 0xFF, 0x2B, 0xEE, 0xFF, 0xCE, 0xE6, 0xFF, 0xCE, 0xDE, 0xFF, 0x69, 0xAD, 0xFF, 0xAB, 0xAD, 0xFF, 0xEC, 0xB5, 0xFF, 0x8A, 0xAD, 0xFF, 0xAB, 0xB5, 0xFF, 0x6A, 0xAD, 0xFF,
-    0x44, 0x42, 0xFF, 0x64, 0x42, 0xFF, 0x43, 0x42, 0xFF, 0x84, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0x64, 0x42, 0xFF, 0xA4, 0x4A, 0xFF, 0x06, 0x5B, 0xFF, 0x84, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0xE5, 0x52, 0xFF, 0xC4, 0x52, 0xFF, 0x25, 0x5B, 0xFF, 0x25, 0x63, 0xFF, 0xA7, 0x73, 0xFF, 0x66, 0x6B, 0xFF, 0x25, 0x5B, 0xFF, 0x45, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0x46, 0x6B, 0xFF, 0x49, 0x8C, 0xFF, 0xA6, 0x7B, 0xFF, 0xC6, 0x73, 0xFF, 0xA9, 0x94, 0xFF, 0x08, 0x84, 0xFF, 0x88, 0x94, 0xFF, 0x07, 0x84, 0xFF, 0x06, 0x84, 0xFF, 0x28, 0x84, 0xFF, 0x28, 0x8C, 0xFF, 0xE7, 0x7B, 0xFF, 0xA9, 0x94, 0xFF, 0x47, 0x8C, 0xFF, 0x48, 0x8C, 0xFF, 0xA8, 0x9C, 0xFF, 0x4A, 0xA5, 0xFF, 0xC8, 0x9C, 0xFF, 0x88, 0x94, 0xFF, 0x86, 0x73, 0xFF, 0xA9, 0x9C, 0xFF, 0x68, 0x94, 0xFF, 0xAB, 0xBD, 0xFF, 0xB4, 0xFF, 0xFF, 0x2B, 0xB5, 0xFF, 0x0A, 0xAD, 0xFF, 0x2A, 0xAD, 0xFF, 0xEC, 0xCD, 0xFF, 0x4E, 0xD6, 0xFF, 0x0C, 0xD6, 0xFF, 0x11, 0xFF, 0xFF, 0x50, 0xFF, 0xFF, 0xCF, 0xF6, 0xFF, 0x0D, 0xD6, 0xFF, 0xAB, 0xC5, 0xFF, 0xAB, 0xC5, 0xFF, 0x4B, 0xB5, 0xFF, 0x2A, 0xB5, 0xFF, 0xE9, 0xA4, 0xFF, 0x47, 0x94, 0xFF, 0x89, 0x94, 0xFF, 0x68, 0x8C, 0xFF, 0x68, 0x94, 0xFF, 0x0E, 0xC6, 0xFF,
-    0xA9, 0x8C, 0xFF, 0x68, 0x8C, 0xFF, 0x48, 0x8C, 0xFF, 0xA9, 0x94, 0xFF, 0x0A, 0xA5, 0xFF, 0x6A, 0xB5, 0xFF, 0xAB, 0xBD, 0xFF, 0x09, 0xA5, 0xFF, 0xAB, 0xBD, 0xFF, 0x6A, 0xAD, 0xFF, 0x09, 0x9D, 0xFF, 0x09, 0x9D, 0xFF, 0x2A, 0xA5, 0xFF, 0x09, 0x9D, 0xFF, 0xE9, 0x94, 0xFF, 0xE9, 0x9C, 0xFF, 0xA4, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0xA4, 0x4A, 0xFF, 0xA5, 0x4A, 0xFF, 0xA4, 0x4A, 0xFF, 0xA4, 0x4A, 0xFF, 0x63, 0x42, 0xFF, 0x46, 0x63, 0xFF, 0x05, 0x53, 0xFF, 0xA4, 0x4A, 0xFF, 0x05, 0x5B, 0xFF, 0x25, 0x63, 0xFF, 0xC7, 0x73, 0xFF, 0x07, 0x7C, 0xFF, 0xC6, 0x7B, 0xFF, 0x68, 0x84, 0xFF, 0x86, 0x6B, 0xFF, 0x05, 0x63, 0xFF, 0xA6, 0x73, 0xFF, 0x86, 0x73, 0xFF, 0x46, 0x6B, 0xFF, 0x27, 0x84, 0xFF, 0x68, 0x94, 0xFF, 0xA9, 0xA4, 0xFF, 0xED, 0xCD, 0xFF, 0x47, 0x8C, 0xFF, 0xA9, 0x94, 0xFF, 0x07, 0x7C, 0xFF, 0x27, 0x84, 0xFF, 0x28, 0x84, 0xFF, 0x07, 0x84, 0xFF, 0xC7, 0x7B, 0xFF, 0x88, 0x94, 0xFF, 0x88, 0x94, 0xFF, 0x27, 0x84, 0xFF, 0xC9, 0x9C, 0xFF, 0xE9, 0x9C, 0xFF, 0x69, 0x8C, 0xFF, 0x28, 0x84, 0xFF, 0xA7, 0x7B, 0xFF, 0x68, 0x8C, 0xFF, 0xA9, 0x94, 0xFF, 0x8C, 0xBD, 0xFF, 0x68, 0x94, 0xFF, 0x2B, 0xB5, 0xFF, 0xC9, 0xA4, 0xFF, 0x0A, 0xAD, 0xFF, 0x4B, 0xB5, 0xFF,
-    0x2A, 0xB5, 0xFF, 0x8B, 0xC5, 0xFF, 0xEC, 0xD5, 0xFF, 0x2E, 0xDE, 0xFF, 0xAB, 0xC5, 0xFF, 0x6A, 0xB5, 0xFF, 0x4A, 0xBD, 0xFF, 0x6A, 0xBD, 0xFF, 0xE9, 0xAC, 0xFF, 0xC9, 0xA4, 0xFF, 0xCA, 0xA4, 0xFF, 0x68, 0x94, 0xFF, 0x48, 0x8C, 0xFF, 0x48, 0x8C, 0xFF, 0x88, 0x8C, 0xFF, 0x48, 0x8C, 0xFF, 0xA9, 0x94, 0xFF, 0x67, 0x84, 0xFF, 0x68, 0x8C, 0xFF, 0xA8, 0x94, 0xFF, 0xC9, 0x94, 0xFF, 0x2A, 0x9D, 0xFF, 0x29, 0xA5, 0xFF, 0xC8, 0x9C, 0xFF, 0x09, 0xA5, 0xFF, 0x4A, 0xA5, 0xFF, 0x2A, 0xA5, 0xFF, 0x2A, 0x9D, 0xFF, 0xE9, 0x9C, 0xFF, 0x09, 0x9D, 0xFF, 0x09, 0x9D, 0xFF, 0xE9, 0x94, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xF7, 0xFF, 0x22, 0x5B, 0xFF, 0x92, 0xBE, 0xFF, 0x66, 0x6B, 0xFF, 0x08, 0x84, 0xFF, 0x69, 0x8C, 0xFF, 0xEA, 0x9C, 0xFF, 0xE5, 0x5A, 0xFF, 0x27, 0x84, 0xFF, 0x2A, 0xA5, 0xFF, 0x8F, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0xA5, 0xFF, 0x09, 0x9D, 0xFF, 0xEC, 0xBD, 0xFF, 0x2F, 0xDF, 0xFF, 0xA6, 0x94, 0xFF, 0x4E, 0xCE, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xC5, 0xFF, 0xD3, 0xFF, 0xFF, 0xAE, 0xD6, 0xFF, 0xEC, 0xC5, 0xFF, 0x29, 0xA5, 0xFF, 0xCC, 0xC5, 0xFF, 0x2A, 0xA5, 0xFF,
-    0x8C, 0xB5, 0xFF, 0x2D, 0xC6, 0xFF, 0x09, 0xA5, 0xFF, 0x09, 0xAD, 0xFF, 0xC9, 0x9C, 0xFF, 0x4A, 0xAD, 0xFF, 0x28, 0x8C, 0xFF, 0x86, 0x7B, 0xFF, 0x0A, 0xA5, 0xFF, 0x89, 0x9C, 0xFF, 0x0C, 0xCE, 0xFF, 0xEA, 0xA4, 0xFF, 0x2D, 0xD6, 0xFF, 0xC9, 0xA4, 0xFF, 0xAB, 0xBD, 0xFF, 0x6E, 0xDE, 0xFF, 0x4E, 0xD6, 0xFF, 0xAF, 0xEE, 0xFF, 0x0D, 0xD6, 0xFF, 0xEC, 0xC5, 0xFF, 0xEF, 0xE6, 0xFF, 0x71, 0xEF, 0xFF, 0x8E, 0xDE, 0xFF, 0xCF, 0xDE, 0xFF, 0xCB, 0xBD, 0xFF, 0x8A, 0xB5, 0xFF, 0xEF, 0xDE, 0xFF, 0x4E, 0xC6, 0xFF, 0x29, 0xA5, 0xFF, 0xAD, 0xB6, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xA5, 0xFF, 0xFB, 0xFF, 0xFF, 0x96, 0xEF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE9, 0x9C, 0xFF, 0x29, 0x9D, 0xFF, 0xCB, 0xB5, 0xFF, 0x4A, 0xA5, 0xFF, 0x09, 0x9D, 0xFF, 0x49, 0xA5, 0xFF, 0x69, 0xA5, 0xFF, 0x49, 0xA5, 0xFF, 0x6B, 0xAD, 0xFF, 0x4A, 0xA5, 0xFF, 0x29, 0x9D, 0xFF, 0x4A, 0xA5, 0xFF, 0xE5, 0x5A, 0xFF, 0xC3, 0x5A, 0xFF, 0x88, 0x8C, 0xFF, 0xC5, 0x5A, 0xFF, 0x6B, 0xA5, 0xFF, 0xC7, 0x7B, 0xFF, 0xC6, 0x7B, 0xFF, 0x67, 0x73, 0xFF, 0x26, 0x63, 0xFF, 0x48, 0x8C, 0xFF, 0xCB, 0xB5, 0xFF, 0xEA, 0x9C, 0xFF, 0x49, 0x94, 0xFF, 0xE7, 0x7B, 0xFF, 0xE9, 0xA4, 0xFF, 0xAE, 0xCE, 0xFF,
-    0x0C, 0xBE, 0xFF, 0x65, 0x73, 0xFF, 0xE8, 0x9C, 0xFF, 0xF0, 0xE6, 0xFF, 0x8A, 0xB5, 0xFF, 0xAE, 0xDE, 0xFF, 0x6C, 0xBD, 0xFF, 0xEC, 0xCD, 0xFF, 0x4A, 0xBD, 0xFF, 0x88, 0x9C, 0xFF, 0x30, 0xEF, 0xFF, 0x09, 0xAD, 0xFF, 0x0A, 0xAD, 0xFF, 0xED, 0xC5, 0xFF, 0x27, 0x8C, 0xFF, 0x50, 0xF7, 0xFF, 0x47, 0x8C, 0xFF, 0xE9, 0xA4, 0xFF, 0x09, 0xAD, 0xFF, 0x09, 0xB5, 0xFF, 0x70, 0xEF, 0xFF, 0x48, 0x94, 0xFF, 0x28, 0x84, 0xFF, 0xA7, 0x7B, 0xFF, 0x0A, 0xB5, 0xFF, 0xF3, 0xFF, 0xFF, 0xCC, 0xCD, 0xFF, 0xC5, 0x8B, 0xFF, 0x09, 0xB5, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x4E, 0xE6, 0xFF, 0x0A, 0xBD, 0xFF, 0x88, 0xBD, 0xFF, 0x0F, 0xEF, 0xFF, 0xF8, 0xFF, 0xFF, 0x8B, 0xC5, 0xFF, 0x69, 0xBD, 0xFF, 0xD4, 0xFF, 0xFF, 0xAC, 0xC5, 0xFF, 0xF6, 0xFF, 0xFF, 0x6A, 0xBD, 0xFF, 0x92, 0xFF, 0xFF, 0xB2, 0xF7, 0xFF, 0xB2, 0xFF, 0xFF, 0x0C, 0xC6, 0xFF, 0x71, 0xF7, 0xFF, 0x6F, 0xDE, 0xFF, 0x07, 0x94, 0xFF, 0x91, 0xEF, 0xFF, 0x0A, 0xAD, 0xFF, 0x0F, 0xEF, 0xFF, 0xEA, 0xB4, 0xFF, 0xEE, 0xEE, 0xFF, 0x2F, 0xEF, 0xFF, 0x51, 0xEF, 0xFF, 0xD2, 0xFF, 0xFF, 0xB3, 0xF7, 0xFF, 0x09, 0xA5, 0xFF, 0x30, 0xEF, 0xFF, 0x47, 0x8C, 0xFF, 0xF9, 0xFF, 0xFF, 0x66, 0x8C, 0xFF, 0x6A, 0xAD, 0xFF,
-    0x64, 0x42, 0xFF, 0x64, 0x42, 0xFF, 0xC5, 0x52, 0xFF, 0xA5, 0x52, 0xFF, 0xC4, 0x52, 0xFF, 0x84, 0x4A, 0xFF, 0xCA, 0x9C, 0xFF, 0xE5, 0x5A, 0xFF, 0x66, 0x6B, 0xFF, 0xE5, 0x52, 0xFF, 0x08, 0x7C, 0xFF, 0x07, 0x84, 0xFF, 0x28, 0x84, 0xFF, 0xC7, 0x7B, 0xFF, 0x28, 0x8C, 0xFF, 0x46, 0x6B, 0xFF, 0x46, 0x6B, 0xFF, 0x67, 0x73, 0xFF, 0x48, 0x8C, 0xFF, 0xA6, 0x7B, 0xFF, 0x8A, 0x94, 0xFF, 0x27, 0x8C, 0xFF, 0x69, 0x94, 0xFF, 0x6C, 0xB5, 0xFF, 0xC9, 0xA4, 0xFF, 0x89, 0x9C, 0xFF, 0xAC, 0xC5, 0xFF, 0x89, 0x9C, 0xFF, 0x51, 0xEF, 0xFF, 0x48, 0x94, 0xFF, 0x68, 0x9C, 0xFF, 0xF1, 0xDE, 0xFF, 0x4B, 0xAD, 0xFF, 0x6B, 0xB5, 0xFF, 0xC6, 0x7B, 0xFF, 0x0A, 0xAD, 0xFF, 0x0D, 0xC6, 0xFF, 0x48, 0x94, 0xFF, 0x28, 0x84, 0xFF, 0x07, 0x8C, 0xFF, 0x48, 0x94, 0xFF, 0x48, 0x8C, 0xFF, 0xAC, 0xC5, 0xFF, 0x07, 0x8C, 0xFF, 0x0A, 0xB5, 0xFF, 0xE9, 0xAC, 0xFF, 0x8C, 0xBD, 0xFF, 0x2A, 0xB5, 0xFF, 0x2E, 0xD6, 0xFF, 0x2D, 0xCE, 0xFF, 0x4A, 0xB5, 0xFF, 0xF0, 0xDE, 0xFF, 0xCC, 0xC5, 0xFF, 0xAB, 0xBD, 0xFF, 0xCF, 0xE6, 0xFF, 0x0C, 0xCE, 0xFF, 0x4A, 0xB5, 0xFF, 0x4A, 0xB5, 0xFF, 0x4A, 0xB5, 0xFF, 0x0A, 0xAD, 0xFF, 0x68, 0x94, 0xFF, 0x88, 0x8C, 0xFF, 0x0B, 0xB6, 0xFF, 0x89, 0x9C, 0xFF,
-    0x27, 0x84, 0xFF, 0x68, 0x8C, 0xFF, 0x68, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0xC6, 0x7B, 0xFF, 0x09, 0x95, 0xFF, 0x2A, 0x9D, 0xFF, 0xE9, 0x94, 0xFF, 0x4A, 0x9D, 0xFF, 0x0A, 0x9D, 0xFF, 0x2A, 0x9D, 0xFF, 0x09, 0x9D, 0xFF, 0x88, 0x94, 0xFF, 0xE9, 0x94, 0xFF, 0x09, 0x9D, 0xFF, 0xC8, 0x94, 0xFF, 0x63, 0x42, 0xFF, 0xC5, 0x52, 0xFF, 0xA5, 0x52, 0xFF, 0xA4, 0x52, 0xFF, 0xA4, 0x52, 0xFF, 0xE5, 0x5A, 0xFF, 0x25, 0x63, 0xFF, 0xC4, 0x5A, 0xFF, 0x25, 0x63, 0xFF, 0xC4, 0x52, 0xFF, 0x49, 0x8C, 0xFF, 0x0A, 0xA5, 0xFF, 0x05, 0x63, 0xFF, 0x25, 0x63, 0xFF, 0x25, 0x6B, 0xFF, 0xC7, 0x7B, 0xFF, 0xE7, 0x7B, 0xFF, 0xC7, 0x7B, 0xFF, 0x88, 0x8C, 0xFF, 0x2D, 0xC6, 0xFF, 0x29, 0xA5, 0xFF, 0x2B, 0xAD, 0xFF, 0x0E, 0xCE, 0xFF, 0x8C, 0xBD, 0xFF, 0xCA, 0xA4, 0xFF, 0x32, 0xF7, 0xFF, 0x50, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0x0C, 0xCE, 0xFF, 0x68, 0x94, 0xFF, 0x67, 0x9C, 0xFF, 0xC8, 0x9C, 0xFF, 0x68, 0x94, 0xFF, 0xF5, 0xFF, 0xFF, 0x2A, 0xA5, 0xFF, 0x8B, 0xC5, 0xFF, 0x8A, 0xBD, 0xFF, 0x4B, 0xAD, 0xFF, 0x48, 0x8C, 0xFF, 0x28, 0x8C, 0xFF, 0x09, 0xA5, 0xFF, 0x6B, 0xBD, 0xFF, 0xF0, 0xEE, 0xFF, 0xA9, 0xA4, 0xFF, 0x4D, 0xD6, 0xFF, 0xE9, 0xAC, 0xFF, 0x8A, 0xC5, 0xFF, 0xE9, 0xB4, 0xFF,
-    0x8B, 0xBD, 0xFF, 0x4D, 0xD6, 0xFF, 0xEC, 0xCD, 0xFF, 0x2F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xAE, 0xE6, 0xFF, 0xF3, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x0C, 0xCE, 0xFF, 0xE9, 0xA4, 0xFF, 0xA9, 0x94, 0xFF, 0xD0, 0xDE, 0xFF, 0x6A, 0xAD, 0xFF, 0x47, 0x8C, 0xFF, 0x88, 0x94, 0xFF, 0xA8, 0x94, 0xFF, 0x8A, 0xA5, 0xFF, 0xCC, 0xB5, 0xFF, 0xFC, 0xFF, 0xFF, 0x73, 0xD7, 0xFF, 0x6E, 0xCE, 0xFF, 0xCA, 0xAD, 0xFF, 0xCB, 0xAD, 0xFF, 0xCE, 0xCE, 0xFF, 0x4D, 0xC6, 0xFF, 0x2C, 0xBE, 0xFF, 0x49, 0xAD, 0xFF, 0xAB, 0xAD, 0xFF, 0x29, 0x9D, 0xFF, 0xC4, 0x52, 0xFF, 0x84, 0x52, 0xFF, 0xC5, 0x52, 0xFF, 0x25, 0x63, 0xFF, 0xE5, 0x5A, 0xFF, 0x66, 0x6B, 0xFF, 0xA4, 0x52, 0xFF, 0x05, 0x63, 0xFF, 0xE4, 0x62, 0xFF, 0x06, 0x7C, 0xFF, 0x68, 0x8C, 0xFF, 0xE9, 0x9C, 0xFF, 0x69, 0x94, 0xFF, 0xCA, 0x9C, 0xFF, 0xEA, 0xA4, 0xFF, 0xC5, 0x73, 0xFF, 0x46, 0x6B, 0xFF, 0x8B, 0xAD, 0xFF, 0xEF, 0xD6, 0xFF, 0xAF, 0xD6, 0xFF, 0xCA, 0xA4, 0xFF, 0x6E, 0xDE, 0xFF, 0x92, 0xF7, 0xFF, 0x0D, 0xCE, 0xFF, 0x28, 0x8C, 0xFF, 0x8A, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xF7, 0xFF, 0xEC, 0xCD, 0xFF, 0xAE, 0xDE, 0xFF, 0x4A, 0xB5, 0xFF, 0xE6, 0x7B, 0xFF,
-    0x2A, 0xB5, 0xFF, 0xEF, 0xE6, 0xFF, 0x28, 0x8C, 0xFF, 0x6B, 0xC5, 0xFF, 0xAF, 0xDE, 0xFF, 0x88, 0x9C, 0xFF, 0xE7, 0x8B, 0xFF, 0x48, 0x94, 0xFF, 0x6E, 0xD6, 0xFF, 0x2C, 0xBD, 0xFF, 0x2C, 0xDE, 0xFF, 0x27, 0x94, 0xFF, 0xB3, 0xFF, 0xFF, 0x6B, 0xD5, 0xFF, 0xAB, 0xD5, 0xFF, 0x2D, 0xE6, 0xFF, 0xCE, 0xDE, 0xFF, 0xAC, 0xCD, 0xFF, 0x2A, 0xB5, 0xFF, 0xB1, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x8E, 0xD6, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x88, 0x9C, 0xFF, 0x27, 0x84, 0xFF, 0xF1, 0xFF, 0xFF, 0x8D, 0xD6, 0xFF, 0x48, 0x8C, 0xFF, 0xCB, 0xBD, 0xFF, 0x50, 0xE7, 0xFF, 0xAF, 0xCE, 0xFF, 0x28, 0x84, 0xFF, 0xAB, 0xA5, 0xFF, 0xE9, 0x94, 0xFF, 0x09, 0x95, 0xFF, 0x09, 0x95, 0xFF, 0x66, 0x84, 0xFF, 0x91, 0xEF, 0xFF, 0xFC, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x09, 0xA5, 0xFF, 0xC3, 0x52, 0xFF, 0xA4, 0x4A, 0xFF, 0x87, 0x6B, 0xFF, 0x4B, 0xA5, 0xFF, 0x64, 0x4A, 0xFF, 0xA8, 0x94, 0xFF, 0xE4, 0x5A, 0xFF, 0x2B, 0xA5, 0xFF, 0xAB, 0xB5, 0xFF, 0x66, 0x73, 0xFF, 0x29, 0xAD, 0xFF, 0x8B, 0xBD, 0xFF, 0x25, 0x6B, 0xFF, 0xB0, 0xF7, 0xFF, 0x8E, 0xD6, 0xFF, 0xA9, 0x9C, 0xFF,
-    0x46, 0x6B, 0xFF, 0x66, 0x73, 0xFF, 0x0A, 0xA5, 0xFF, 0x6D, 0xCE, 0xFF, 0x6C, 0xB5, 0xFF, 0x48, 0x94, 0xFF, 0xC8, 0xA4, 0xFF, 0xCE, 0xE6, 0xFF, 0x6E, 0xDE, 0xFF, 0xEA, 0xAC, 0xFF, 0xCC, 0xCD, 0xFF, 0x0F, 0xE7, 0xFF, 0x6D, 0xD6, 0xFF, 0x07, 0x8C, 0xFF, 0xC9, 0xA4, 0xFF, 0x8F, 0xDE, 0xFF, 0x10, 0xEF, 0xFF, 0x8C, 0xBD, 0xFF, 0x07, 0x8C, 0xFF, 0xAB, 0xBD, 0xFF, 0x8E, 0xDE, 0xFF, 0xA8, 0xA4, 0xFF, 0x08, 0x8C, 0xFF, 0x68, 0x94, 0xFF, 0xA9, 0x9C, 0xFF, 0xD3, 0xFF, 0xFF, 0x8D, 0xDE, 0xFF, 0xA8, 0xAC, 0xFF, 0xEC, 0xE5, 0xFF, 0xF7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xCF, 0xFE, 0xFF, 0x2A, 0xBD, 0xFF, 0x90, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0x30, 0xF7, 0xFF, 0x6A, 0xBD, 0xFF, 0xB1, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0xEE, 0xFF, 0xEF, 0xF6, 0xFF, 0x10, 0xEF, 0xFF, 0xCB, 0xCD, 0xFF, 0x6A, 0xBD, 0xFF, 0x68, 0x94, 0xFF, 0xE7, 0x83, 0xFF, 0x2A, 0xB5, 0xFF, 0x8E, 0xDE, 0xFF, 0x84, 0x7B, 0xFF, 0x08, 0x84, 0xFF, 0x2D, 0xCE, 0xFF, 0xCB, 0xBD, 0xFF, 0x26, 0x84, 0xFF, 0xA8, 0x8C, 0xFF, 0x6A, 0xAD, 0xFF, 0xED, 0xBD, 0xFF, 0xA8, 0x8C, 0xFF, 0x66, 0x8C, 0xFF, 0x06, 0x7C, 0xFF, 0x09, 0x9D, 0xFF, 0x27, 0x84, 0xFF, 0x09, 0x9D, 0xFF, 0x06, 0x7C, 0xFF, 0x2A, 0x9D, 0xFF,
-    0x43, 0x42, 0xFF, 0xE9, 0x9C, 0xFF, 0x25, 0x63, 0xFF, 0x06, 0x63, 0xFF, 0xC9, 0x94, 0xFF, 0xCB, 0xB5, 0xFF, 0x8C, 0xB5, 0xFF, 0xE4, 0x5A, 0xFF, 0xE5, 0x5A, 0xFF, 0x29, 0x8C, 0xFF, 0x0F, 0xDF, 0xFF, 0x0C, 0xC6, 0xFF, 0x08, 0x8C, 0xFF, 0x66, 0x73, 0xFF, 0x88, 0x94, 0xFF, 0xCE, 0xE6, 0xFF, 0xAE, 0xD6, 0xFF, 0xC7, 0x7B, 0xFF, 0x28, 0x84, 0xFF, 0x0A, 0xAD, 0xFF, 0xCC, 0xC5, 0xFF, 0xF4, 0xFF, 0xFF, 0xC9, 0xA4, 0xFF, 0xC9, 0xAC, 0xFF, 0xA8, 0x94, 0xFF, 0x0A, 0xAD, 0xFF, 0xF3, 0xFF, 0xFF, 0x89, 0x9C, 0xFF, 0xAC, 0xBD, 0xFF, 0x27, 0x8C, 0xFF, 0xE9, 0xA4, 0xFF, 0x90, 0xF7, 0xFF, 0x27, 0x8C, 0xFF, 0x09, 0xAD, 0xFF, 0x8A, 0xAD, 0xFF, 0x2A, 0xB5, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0xEF, 0xFF, 0x28, 0x8C, 0xFF, 0x89, 0x9C, 0xFF, 0xCC, 0xBD, 0xFF, 0xD2, 0xFF, 0xFF, 0xCC, 0xCD, 0xFF, 0x09, 0xBD, 0xFF, 0x4E, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x4A, 0xC5, 0xFF, 0x88, 0xA4, 0xFF, 0x29, 0xBD, 0xFF, 0xF7, 0xFF, 0xFF, 0x2D, 0xCE, 0xFF, 0x09, 0xA5, 0xFF, 0x6D, 0xDE, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xAC, 0xC5, 0xFF, 0xE8, 0xA4, 0xFF, 0xE8, 0xAC, 0xFF, 0xD2, 0xFF, 0xFF, 0xC9, 0x9C, 0xFF, 0x47, 0x8C, 0xFF, 0x28, 0x8C, 0xFF,
-    0x27, 0x8C, 0xFF, 0xAE, 0xD6, 0xFF, 0x06, 0x84, 0xFF, 0xEF, 0xDE, 0xFF, 0x48, 0x84, 0xFF, 0x88, 0x8C, 0xFF, 0x8A, 0xAD, 0xFF, 0x8B, 0xA5, 0xFF, 0x6E, 0xCE, 0xFF, 0xA9, 0x8C, 0xFF, 0xE6, 0x73, 0xFF, 0xAB, 0xB5, 0xFF, 0xC9, 0x94, 0xFF, 0x2C, 0xBE, 0xFF, 0xC5, 0x73, 0xFF, 0x88, 0x8C, 0xFF, 0xA4, 0x4A, 0xFF, 0xCB, 0x9C, 0xFF, 0x46, 0x63, 0xFF, 0x0C, 0x9D, 0xFF, 0x67, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0x05, 0x63, 0xFF, 0x05, 0x5B, 0xFF, 0x05, 0x63, 0xFF, 0x85, 0x6B, 0xFF, 0xC3, 0x52, 0xFF, 0x8D, 0xBD, 0xFF, 0xA9, 0x94, 0xFF, 0x0A, 0xA5, 0xFF, 0xF2, 0xE6, 0xFF, 0x45, 0x6B, 0xFF, 0x4E, 0xC6, 0xFF, 0x08, 0x84, 0xFF, 0xCA, 0xA4, 0xFF, 0x8A, 0xB5, 0xFF, 0x2D, 0xCE, 0xFF, 0x68, 0x94, 0xFF, 0x47, 0x9C, 0xFF, 0x6D, 0xDE, 0xFF, 0x68, 0x94, 0xFF, 0x47, 0x94, 0xFF, 0x0B, 0xC6, 0xFF, 0x4A, 0xAD, 0xFF, 0xB0, 0xDE, 0xFF, 0x28, 0x94, 0xFF, 0xB6, 0xF7, 0xFF, 0x47, 0x94, 0xFF, 0xC8, 0xA4, 0xFF, 0xF0, 0xE6, 0xFF, 0xCA, 0xA4, 0xFF, 0xEC, 0xD5, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x89, 0xA4, 0xFF, 0xA9, 0x94, 0xFF, 0xB3, 0xF7, 0xFF, 0x29, 0xB5, 0xFF, 0xAB, 0xCD, 0xFF, 0x89, 0xAC, 0xFF, 0xAB, 0xD5, 0xFF, 0xB0, 0xF6, 0xFF, 0xAE, 0xFE, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x8C, 0xCD, 0xFF, 0x4B, 0xBD, 0xFF, 0x2D, 0xD6, 0xFF, 0x92, 0xFF, 0xFF, 0x09, 0xAD, 0xFF, 0x09, 0xA5, 0xFF, 0xF3, 0xFF, 0xFF, 0x6A, 0xB5, 0xFF, 0xCB, 0xC5, 0xFF, 0x6D, 0xD6, 0xFF, 0xA8, 0x9C, 0xFF, 0xC8, 0xA4, 0xFF, 0x2A, 0xA5, 0xFF, 0xA8, 0x94, 0xFF, 0xC6, 0x7B, 0xFF, 0x8B, 0xA5, 0xFF, 0xAE, 0xCE, 0xFF, 0xA6, 0x73, 0xFF, 0xE7, 0x83, 0xFF, 0x27, 0x7C, 0xFF, 0xA9, 0x94, 0xFF, 0x68, 0x84, 0xFF, 0xE9, 0x8C, 0xFF, 0xA5, 0x6B, 0xFF, 0x6B, 0x9D, 0xFF, 0x88, 0x84, 0xFF, 0xE5, 0x73, 0xFF, 0x6A, 0xA5, 0xFF, 0xE9, 0x9C, 0xFF, 0x09, 0x9D, 0xFF, 0x06, 0x7C, 0xFF, 0x6A, 0xA5, 0xFF, 0xE6, 0x5A, 0xFF, 0x0F, 0xBE, 0xFF, 0xE5, 0x5A, 0xFF, 0xAA, 0x94, 0xFF, 0x05, 0x5B, 0xFF, 0x65, 0x63, 0xFF, 0x26, 0x63, 0xFF, 0x25, 0x63, 0xFF, 0x83, 0x52, 0xFF, 0x86, 0x73, 0xFF, 0xF5, 0xFF, 0xFF, 0x6B, 0xAD, 0xFF, 0x49, 0x94, 0xFF, 0xA6, 0x7B, 0xFF, 0x09, 0xA5, 0xFF, 0xE7, 0x83, 0xFF, 0xA9, 0x94, 0xFF, 0x47, 0x84, 0xFF, 0x8B, 0xB5, 0xFF, 0xC8, 0xAC, 0xFF, 0xA7, 0xA4, 0xFF, 0x51, 0xFF, 0xFF, 0x4A, 0xC5, 0xFF, 0x4D, 0xD6, 0xFF, 0x27, 0x8C, 0xFF, 0x2C, 0xD6, 0xFF, 0x2D, 0xD6, 0xFF, 0x47, 0x8C, 0xFF, 0x2A, 0xB5, 0xFF, 0x0F, 0xE7, 0xFF, 0xAF, 0xDE, 0xFF, 0xA9, 0xA4, 0xFF,
-    0xE9, 0xAC, 0xFF, 0xF3, 0xFF, 0xFF, 0x87, 0x9C, 0xFF, 0xEF, 0xFE, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xBD, 0xFF, 0xC9, 0x9C, 0xFF, 0xEA, 0xA4, 0xFF, 0x4B, 0xBD, 0xFF, 0xB6, 0xFF, 0xFF, 0x89, 0xA4, 0xFF, 0x50, 0xFF, 0xFF, 0x4A, 0xC5, 0xFF, 0x2A, 0xC5, 0xFF, 0x0D, 0xE6, 0xFF, 0x0F, 0xEF, 0xFF, 0xA8, 0xA4, 0xFF, 0xA9, 0xA4, 0xFF, 0x11, 0xEF, 0xFF, 0x70, 0xF7, 0xFF, 0xEA, 0xAC, 0xFF, 0xF0, 0xEE, 0xFF, 0x30, 0xF7, 0xFF, 0xCE, 0xE6, 0xFF, 0x6B, 0xC5, 0xFF, 0x88, 0xA4, 0xFF, 0x29, 0xB5, 0xFF, 0x68, 0x94, 0xFF, 0x27, 0x8C, 0xFF, 0xF4, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xCD, 0xBD, 0xFF, 0xE7, 0x73, 0xFF, 0xC8, 0x9C, 0xFF, 0xA9, 0xAD, 0xFF, 0x69, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0xC9, 0x84, 0xFF, 0x05, 0x74, 0xFF, 0x4A, 0x9D, 0xFF, 0xE9, 0x94, 0xFF, 0x09, 0x95, 0xFF, 0xC8, 0x8C, 0xFF, 0xE9, 0x94, 0xFF, 0x47, 0x84, 0xFF, 0x4A, 0xA5, 0xFF, 0xE9, 0x9C, 0xFF, 0x48, 0x84, 0xFF, 0x45, 0x63, 0xFF, 0xA7, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0x26, 0x63, 0xFF, 0x05, 0x63, 0xFF, 0xA6, 0x73, 0xFF, 0x2C, 0xBE, 0xFF, 0xC2, 0x5A, 0xFF, 0xC8, 0x7B, 0xFF, 0x30, 0xDF, 0xFF, 0xE9, 0xA4, 0xFF, 0xC6, 0x7B, 0xFF, 0x48, 0x8C, 0xFF, 0x87, 0x9C, 0xFF, 0xA7, 0x9C, 0xFF,
-    0x68, 0x94, 0xFF, 0x89, 0x94, 0xFF, 0x07, 0x94, 0xFF, 0x6C, 0xDE, 0xFF, 0xB2, 0xFF, 0xFF, 0x50, 0xFF, 0xFF, 0xEE, 0xFE, 0xFF, 0xD2, 0xFF, 0xFF, 0xEF, 0xE6, 0xFF, 0xE9, 0xA4, 0xFF, 0xA9, 0x9C, 0xFF, 0x68, 0x94, 0xFF, 0xEF, 0xE6, 0xFF, 0xC8, 0xA4, 0xFF, 0x4D, 0xCE, 0xFF, 0x92, 0xF7, 0xFF, 0xCE, 0xE6, 0xFF, 0x4A, 0xBD, 0xFF, 0x2D, 0xC6, 0xFF, 0x2D, 0xDE, 0xFF, 0x50, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xB5, 0xFF, 0x88, 0x9C, 0xFF, 0xEB, 0xBD, 0xFF, 0xA8, 0xAC, 0xFF, 0xEC, 0xD5, 0xFF, 0x0A, 0xB5, 0xFF, 0x09, 0xB5, 0xFF, 0xEF, 0xEE, 0xFF, 0x8B, 0xC5, 0xFF, 0x6B, 0xC5, 0xFF, 0x88, 0xA4, 0xFF, 0x50, 0xF7, 0xFF, 0x48, 0x9C, 0xFF, 0xF5, 0xFF, 0xFF, 0x6B, 0xBD, 0xFF, 0x71, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xAF, 0xF6, 0xFF, 0x2C, 0xDE, 0xFF, 0x6A, 0xC5, 0xFF, 0x4D, 0xDE, 0xFF, 0x88, 0xA4, 0xFF, 0xCD, 0xCD, 0xFF, 0xB1, 0xF7, 0xFF, 0x2C, 0xCE, 0xFF, 0x48, 0x94, 0xFF, 0xEA, 0x9C, 0xFF, 0xEF, 0xCE, 0xFF, 0x30, 0xEF, 0xFF, 0x06, 0x7C, 0xFF, 0x68, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0x87, 0x84, 0xFF, 0x47, 0x7C, 0xFF, 0xE9, 0x8C, 0xFF, 0x67, 0x84, 0xFF, 0xC8, 0x8C, 0xFF, 0x09, 0x95, 0xFF, 0x0A, 0x9D, 0xFF, 0x88, 0x8C, 0xFF, 0x89, 0x8C, 0xFF, 0xE9, 0x9C, 0xFF,
-    0xC7, 0x73, 0xFF, 0x46, 0x6B, 0xFF, 0x46, 0x63, 0xFF, 0x09, 0xA5, 0xFF, 0xAF, 0xD6, 0xFF, 0x30, 0xE7, 0xFF, 0x2E, 0xC6, 0xFF, 0xAC, 0xB5, 0xFF, 0x6D, 0xCE, 0xFF, 0x4B, 0xAD, 0xFF, 0x08, 0x84, 0xFF, 0x47, 0x94, 0xFF, 0x6B, 0xAD, 0xFF, 0x10, 0xE7, 0xFF, 0xF2, 0xFF, 0xFF, 0xA8, 0x9C, 0xFF, 0x6B, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0x0C, 0xCE, 0xFF, 0xCC, 0xC5, 0xFF, 0xC8, 0x9C, 0xFF, 0x50, 0xEF, 0xFF, 0xCA, 0xA4, 0xFF, 0x6B, 0xB5, 0xFF, 0xAB, 0xBD, 0xFF, 0xAA, 0xBD, 0xFF, 0x87, 0x9C, 0xFF, 0xAC, 0xC5, 0xFF, 0x67, 0x94, 0xFF, 0x2A, 0xB5, 0xFF, 0x91, 0xF7, 0xFF, 0xF8, 0xFF, 0xFF, 0x89, 0x9C, 0xFF, 0xAA, 0x9C, 0xFF, 0xCF, 0xDE, 0xFF, 0x51, 0xF7, 0xFF, 0x6B, 0xC5, 0xFF, 0x89, 0xA4, 0xFF, 0x67, 0x9C, 0xFF, 0xF3, 0xFF, 0xFF, 0xE8, 0xAC, 0xFF, 0x09, 0xAD, 0xFF, 0x68, 0x94, 0xFF, 0xA9, 0xA4, 0xFF, 0xB2, 0xFF, 0xFF, 0x4F, 0xD6, 0xFF, 0x0A, 0xAD, 0xFF, 0xAF, 0xE6, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x0C, 0xE6, 0xFF, 0x4B, 0xBD, 0xFF, 0xEF, 0xE6, 0xFF, 0xB3, 0xFF, 0xFF, 0x4A, 0xAD, 0xFF, 0xDB, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x6D, 0xD6, 0xFF, 0x07, 0x84, 0xFF, 0x35, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xE6, 0xFF, 0xA8, 0x94, 0xFF, 0xE5, 0x73, 0xFF, 0xC9, 0x8C, 0xFF, 0xE9, 0x8C, 0xFF, 0x4A, 0xA5, 0xFF, 0xA9, 0x8C, 0xFF, 0xE9, 0x8C, 0xFF, 0x88, 0x8C, 0xFF, 0x88, 0x84, 0xFF, 0x0A, 0x9D, 0xFF, 0x47, 0x84, 0xFF, 0x0D, 0xC6, 0xFF, 0xA7, 0x73, 0xFF, 0xC4, 0x5A, 0xFF, 0x89, 0xA4, 0xFF, 0xDD, 0xFF, 0xFF, 0x0F, 0xDF, 0xFF, 0x26, 0x84, 0xFF, 0x07, 0x84, 0xFF, 0xD1, 0xE6, 0xFF, 0x2E, 0xCE, 0xFF, 0x91, 0xF7, 0xFF, 0x2C, 0xC6, 0xFF, 0x2F, 0xE7, 0xFF, 0x2B, 0xAD, 0xFF, 0x4E, 0xE6, 0xFF, 0xF3, 0xFF, 0xFF, 0x8B, 0xAD, 0xFF, 0x88, 0x94, 0xFF, 0xC9, 0xAC, 0xFF, 0xF2, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x6D, 0xF6, 0xFF, 0xC9, 0xA4, 0xFF, 0xE8, 0xA4, 0xFF, 0xF4, 0xFF, 0xFF, 0x6F, 0xD6, 0xFF, 0x47, 0x94, 0xFF, 0x09, 0xA5, 0xFF, 0x4A, 0xAD, 0xFF, 0xF3, 0xFF, 0xFF, 0xA8, 0x9C, 0xFF, 0x2C, 0xCE, 0xFF, 0x67, 0x9C, 0xFF, 0x11, 0xEF, 0xFF, 0xF8, 0xFF, 0xFF, 0x6E, 0xD6, 0xFF, 0x88, 0x94, 0xFF, 0x68, 0x94, 0xFF, 0xE9, 0xAC, 0xFF, 0xF4, 0xFF, 0xFF, 0xEC, 0xCD, 0xFF, 0x2B, 0xB5, 0xFF, 0xEC, 0xC5, 0xFF, 0x67, 0x9C, 0xFF, 0xF6, 0xFF, 0xFF, 0x47, 0x94, 0xFF,
-    0x4B, 0xB5, 0xFF, 0x07, 0x8C, 0xFF, 0x05, 0x8C, 0xFF, 0xF4, 0xFF, 0xFF, 0x2A, 0xB5, 0xFF, 0x4B, 0xBD, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFE, 0xFF, 0xD0, 0xEE, 0xFF, 0xEA, 0xAC, 0xFF, 0xB6, 0xFF, 0xFF, 0x8D, 0xCE, 0xFF, 0xEF, 0xDE, 0xFF, 0x07, 0x84, 0xFF, 0xEA, 0xA4, 0xFF, 0x91, 0xD6, 0xFF, 0xC6, 0x7B, 0xFF, 0x48, 0x8C, 0xFF, 0xA9, 0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0x8B, 0xB5, 0xFF, 0x68, 0x84, 0xFF, 0xE8, 0x8C, 0xFF, 0x4A, 0x9D, 0xFF, 0x67, 0x7C, 0xFF, 0xAB, 0xB5, 0xFF, 0x88, 0x8C, 0xFF, 0x88, 0x84, 0xFF, 0x67, 0x84, 0xFF, 0x88, 0x84, 0xFF, 0xA7, 0x73, 0xFF, 0x46, 0x63, 0xFF, 0x25, 0x5B, 0xFF, 0xE8, 0x7B, 0xFF, 0x07, 0x84, 0xFF, 0xA9, 0x94, 0xFF, 0xC7, 0x73, 0xFF, 0x07, 0x7C, 0xFF, 0x6D, 0xAD, 0xFF, 0xCC, 0xC5, 0xFF, 0x93, 0xF7, 0xFF, 0xA9, 0x9C, 0xFF, 0x2B, 0xAD, 0xFF, 0x4D, 0xCE, 0xFF, 0xAA, 0xBD, 0xFF, 0xC8, 0x9C, 0xFF, 0x27, 0x84, 0xFF, 0x68, 0x94, 0xFF, 0x48, 0x9C, 0xFF, 0xCF, 0xEE, 0xFF, 0xAE, 0xFE, 0xFF, 0x70, 0xFF, 0xFF, 0x6D, 0xF6, 0xFF, 0x4A, 0xCD, 0xFF, 0x89, 0xA4, 0xFF, 0x0F, 0xE7, 0xFF, 0xCB, 0xBD, 0xFF, 0xA9, 0x94, 0xFF, 0x4D, 0xC6, 0xFF, 0xEF, 0xD6, 0xFF, 0x6E, 0xC6, 0xFF, 0x2D, 0xBE, 0xFF,
-    0x68, 0x94, 0xFF, 0x52, 0xEF, 0xFF, 0xCC, 0xBD, 0xFF, 0x6E, 0xE6, 0xFF, 0xAC, 0xCD, 0xFF, 0xAD, 0xCE, 0xFF, 0x68, 0x94, 0xFF, 0x68, 0x94, 0xFF, 0xAC, 0xAD, 0xFF, 0xAC, 0xC5, 0xFF, 0xCC, 0xCD, 0xFF, 0x2B, 0xAD, 0xFF, 0x68, 0x9C, 0xFF, 0xAC, 0xBD, 0xFF, 0xAC, 0xB5, 0xFF, 0x27, 0x94, 0xFF, 0x2D, 0xCE, 0xFF, 0x2B, 0xAD, 0xFF, 0x48, 0x94, 0xFF, 0xA8, 0x9C, 0xFF, 0x6D, 0xCE, 0xFF, 0x8C, 0xC5, 0xFF, 0xB0, 0xF6, 0xFF, 0x10, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xEC, 0xED, 0xFF, 0x0A, 0xB5, 0xFF, 0xEA, 0xAC, 0xFF, 0xE9, 0xA4, 0xFF, 0x4B, 0xAD, 0xFF, 0xC7, 0x83, 0xFF, 0xEC, 0xBD, 0xFF, 0xA8, 0x94, 0xFF, 0x86, 0x73, 0xFF, 0xA6, 0x73, 0xFF, 0xA5, 0x73, 0xFF, 0x27, 0x7C, 0xFF, 0x07, 0x74, 0xFF, 0x07, 0x74, 0xFF, 0x88, 0x7C, 0xFF, 0x88, 0x84, 0xFF, 0xA8, 0x84, 0xFF, 0x67, 0x7C, 0xFF, 0xA8, 0x8C, 0xFF, 0x68, 0x84, 0xFF, 0x88, 0x84, 0xFF, 0x47, 0x7C, 0xFF, 0x27, 0x7C, 0xFF, 0xA7, 0x73, 0xFF, 0x47, 0x6B, 0xFF, 0xE9, 0x94, 0xFF, 0xC6, 0x73, 0xFF, 0xE7, 0x7B, 0xFF, 0xCA, 0x9C, 0xFF, 0xE7, 0x7B, 0xFF, 0xF4, 0xFF, 0xFF, 0x0A, 0xA5, 0xFF, 0x2B, 0xAD, 0xFF, 0x47, 0x84, 0xFF, 0xF2, 0xFF, 0xFF, 0x6B, 0xB5, 0xFF, 0xCB, 0xBD, 0xFF, 0x4A, 0xAD, 0xFF, 0x09, 0xA5, 0xFF,
-    0xB2, 0xF7, 0xFF, 0x48, 0x8C, 0xFF, 0x2A, 0xAD, 0xFF, 0x2D, 0xCE, 0xFF, 0x4D, 0xD6, 0xFF, 0x8F, 0xE6, 0xFF, 0xAB, 0xCD, 0xFF, 0x6A, 0xBD, 0xFF, 0x2F, 0xEF, 0xFF, 0x2D, 0xCE, 0xFF, 0xCC, 0xBD, 0xFF, 0x4D, 0xCE, 0xFF, 0x50, 0xE7, 0xFF, 0xCE, 0xCE, 0xFF, 0x0C, 0xC6, 0xFF, 0x0D, 0xCE, 0xFF, 0xEF, 0xEE, 0xFF, 0xCC, 0xCD, 0xFF, 0xEC, 0xC5, 0xFF, 0xCF, 0xF6, 0xFF, 0x32, 0xFF, 0xFF, 0xEE, 0xE6, 0xFF, 0xA9, 0xA4, 0xFF, 0x48, 0x8C, 0xFF, 0x4D, 0xCE, 0xFF, 0xA5, 0x83, 0xFF, 0x2D, 0xDE, 0xFF, 0xA9, 0x9C, 0xFF, 0x67, 0x9C, 0xFF, 0xCF, 0xE6, 0xFF, 0x0B, 0xAD, 0xFF, 0x89, 0x9C, 0xFF, 0x08, 0x8C, 0xFF, 0xCE, 0xDE, 0xFF, 0x88, 0x9C, 0xFF, 0x28, 0x94, 0xFF, 0x47, 0x94, 0xFF, 0x0F, 0xE7, 0xFF, 0x4B, 0xC5, 0xFF, 0xE9, 0xBC, 0xFF, 0xCC, 0xCD, 0xFF, 0x6E, 0xE6, 0xFF, 0x4F, 0xD6, 0xFF, 0x27, 0x8C, 0xFF, 0x27, 0x8C, 0xFF, 0xEB, 0xBD, 0xFF, 0x8C, 0xAD, 0xFF, 0x65, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0xEA, 0x9C, 0xFF, 0x48, 0x8C, 0xFF, 0x65, 0x6B, 0xFF, 0xC6, 0x73, 0xFF, 0xC6, 0x6B, 0xFF, 0xCA, 0x94, 0xFF, 0x47, 0x7C, 0xFF, 0x68, 0x84, 0xFF, 0xA8, 0x84, 0xFF, 0x48, 0x7C, 0xFF, 0x88, 0x84, 0xFF, 0x47, 0x7C, 0xFF, 0x68, 0x84, 0xFF, 0x47, 0x7C, 0xFF, 0x88, 0x84, 0xFF,
-    0x52, 0xEF, 0xFF, 0x28, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x94, 0xFF, 0x68, 0x94, 0xFF, 0x2F, 0xEF, 0xFF, 0xA9, 0x94, 0xFF, 0x89, 0x94, 0xFF, 0xCC, 0xC5, 0xFF, 0x89, 0xBD, 0xFF, 0xF7, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x0A, 0xA5, 0xFF, 0x2D, 0xCE, 0xFF, 0x70, 0xEF, 0xFF, 0x8B, 0xB5, 0xFF, 0x48, 0x84, 0xFF, 0x08, 0x84, 0xFF, 0xAF, 0xDE, 0xFF, 0xEB, 0xBD, 0xFF, 0xCC, 0xC5, 0xFF, 0x2A, 0xB5, 0xFF, 0xCC, 0xC5, 0xFF, 0x50, 0xEF, 0xFF, 0xA9, 0x9C, 0xFF, 0xA8, 0x94, 0xFF, 0xAB, 0xB5, 0xFF, 0xF4, 0xFF, 0xFF, 0x30, 0xDF, 0xFF, 0xF5, 0xEF, 0xFF, 0xCF, 0xD6, 0xFF, 0xAC, 0xB5, 0xFF, 0xAB, 0xC5, 0xFF, 0x4D, 0xCE, 0xFF, 0x8B, 0xBD, 0xFF, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xC9, 0xAC, 0xFF, 0x89, 0x94, 0xFF, 0xCA, 0xA4, 0xFF, 0xAE, 0xD6, 0xFF, 0xF8, 0xFF, 0xFF, 0xEA, 0xAC, 0xFF, 0x6B, 0xB5, 0xFF, 0x30, 0xEF, 0xFF, 0x0B, 0xAD, 0xFF, 0xC9, 0x9C, 0xFF, 0x89, 0x9C, 0xFF, 0x85, 0x7B, 0xFF, 0x87, 0x94, 0xFF, 0x48, 0x94, 0xFF, 0x07, 0x8C, 0xFF, 0x27, 0x8C, 0xFF, 0x4D, 0xDE, 0xFF, 0xCA, 0xAC, 0xFF, 0xC9, 0xAC, 0xFF, 0xC9, 0xA4, 0xFF, 0x2E, 0xD6, 0xFF, 0xE7, 0x83, 0xFF, 0xC6, 0x7B, 0xFF, 0x2B, 0xA5, 0xFF, 0xC6, 0x7B, 0xFF, 0x04, 0x63, 0xFF,
-    0x44, 0x63, 0xFF, 0xC7, 0x7B, 0xFF, 0xA7, 0x73, 0xFF, 0x07, 0x7C, 0xFF, 0x48, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0xE6, 0x73, 0xFF, 0x8A, 0xA5, 0xFF, 0x48, 0x84, 0xFF, 0x68, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0x68, 0x84, 0xFF, 0x68, 0x84, 0xFF, 0xA9, 0x8C, 0xFF, 0x07, 0x7C, 0xFF, 0x48, 0x84, 0xFF, 0xF8, 0xFF, 0xFF, 0xA9, 0x9C, 0xFF, 0x10, 0xE7, 0xFF, 0xCC, 0xC5, 0xFF, 0x29, 0xAD, 0xFF, 0xEB, 0xD5, 0xFF, 0x71, 0xF7, 0xFF, 0x71, 0xF7, 0xFF, 0xEE, 0xEE, 0xFF, 0xD0, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xCE, 0xFF, 0x0C, 0xC6, 0xFF, 0xEC, 0xC5, 0xFF, 0xAE, 0xCE, 0xFF, 0x88, 0x8C, 0xFF, 0xE6, 0x83, 0xFF, 0xCC, 0xC5, 0xFF, 0xF0, 0xDE, 0xFF, 0xEC, 0xC5, 0xFF, 0x6B, 0xB5, 0xFF, 0xD2, 0xFF, 0xFF, 0xA7, 0xA4, 0xFF, 0xA9, 0x94, 0xFF, 0x4D, 0xC6, 0xFF, 0x69, 0xAD, 0xFF, 0x0F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xDF, 0xFF, 0xCF, 0xDE, 0xFF, 0xF2, 0xFF, 0xFF, 0x8A, 0xBD, 0xFF, 0x8E, 0xDE, 0xFF, 0x2D, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x4B, 0xB5, 0xFF, 0xE9, 0xA4, 0xFF, 0x4B, 0xAD, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0xAC, 0xFF, 0x0B, 0xAD, 0xFF, 0x4E, 0xCE, 0xFF, 0xE7, 0x8B, 0xFF, 0x0D, 0xC6, 0xFF, 0x89, 0x94, 0xFF,
-    0x27, 0x8C, 0xFF, 0xC9, 0x9C, 0xFF, 0xEB, 0xC5, 0xFF, 0xEB, 0xC5, 0xFF, 0x89, 0x9C, 0xFF, 0xC6, 0x7B, 0xFF, 0x07, 0x8C, 0xFF, 0x73, 0xEF, 0xFF, 0x68, 0x94, 0xFF, 0x07, 0x8C, 0xFF, 0xC9, 0x9C, 0xFF, 0x68, 0x94, 0xFF, 0xA7, 0x94, 0xFF, 0xC6, 0x7B, 0xFF, 0x26, 0x84, 0xFF, 0x65, 0x6B, 0xFF, 0xEC, 0xB5, 0xFF, 0x2A, 0xA5, 0xFF, 0x65, 0x63, 0xFF, 0xA6, 0x6B, 0xFF, 0x65, 0x63, 0xFF, 0xC7, 0x73, 0xFF, 0x47, 0x7C, 0xFF, 0x07, 0x74, 0xFF, 0xC6, 0x73, 0xFF, 0x4A, 0x9D, 0xFF, 0xA8, 0x8C, 0xFF, 0x89, 0x8C, 0xFF, 0x28, 0x7C, 0xFF, 0x47, 0x7C, 0xFF, 0x68, 0x8C, 0xFF, 0x47, 0x84, 0xFF, 0x4C, 0xD6, 0xFF, 0x29, 0xAD, 0xFF, 0x2A, 0xB5, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xEF, 0xEE, 0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xE7, 0xFF, 0xD4, 0xFF, 0xFF, 0x2D, 0xCE, 0xFF, 0x8C, 0xB5, 0xFF, 0xEB, 0xBD, 0xFF, 0x27, 0x84, 0xFF, 0x4D, 0xCE, 0xFF, 0xEC, 0xBD, 0xFF, 0xEC, 0xCD, 0xFF, 0x11, 0xE7, 0xFF, 0xF5, 0xFF, 0xFF, 0x6E, 0xD6, 0xFF, 0x87, 0x9C, 0xFF, 0xCC, 0xBD, 0xFF, 0xC6, 0x94, 0xFF, 0xF5, 0xFF, 0xFF, 0x8A, 0xAD, 0xFF, 0x2A, 0xA5, 0xFF, 0x8A, 0xAD, 0xFF, 0xEF, 0xDE, 0xFF, 0xF4, 0xFF, 0xFF,
-    0x6B, 0xB5, 0xFF, 0x2D, 0xD6, 0xFF, 0xAB, 0xCD, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xEA, 0xAC, 0xFF, 0x89, 0x9C, 0xFF, 0xEC, 0xC5, 0xFF, 0xF4, 0xFF, 0xFF, 0x8B, 0xC5, 0xFF, 0xAA, 0xA4, 0xFF, 0xE9, 0xAC, 0xFF, 0xA7, 0xA4, 0xFF, 0xF2, 0xFF, 0xFF, 0x07, 0x8C, 0xFF, 0xAF, 0xD6, 0xFF, 0xC5, 0x83, 0xFF, 0x68, 0x94, 0xFF, 0xF2, 0xFF, 0xFF, 0x6D, 0xCE, 0xFF, 0x2B, 0xAD, 0xFF, 0xE7, 0x8B, 0xFF, 0x84, 0x83, 0xFF, 0xF3, 0xFF, 0xFF, 0x49, 0x94, 0xFF, 0x8A, 0x9C, 0xFF, 0xA6, 0x7B, 0xFF, 0x89, 0x94, 0xFF, 0x05, 0x84, 0xFF, 0xC7, 0x7B, 0xFF, 0x69, 0x8C, 0xFF, 0x0D, 0xB6, 0xFF, 0x27, 0x84, 0xFF, 0xE4, 0x62, 0xFF, 0xCA, 0x94, 0xFF, 0x0A, 0x95, 0xFF, 0xC6, 0x73, 0xFF, 0xE6, 0x73, 0xFF, 0x06, 0x74, 0xFF, 0x64, 0x63, 0xFF, 0x48, 0x7C, 0xFF, 0x07, 0x74, 0xFF, 0x48, 0x84, 0xFF, 0xC5, 0x73, 0xFF, 0x88, 0x84, 0xFF, 0x48, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0x27, 0x8C, 0xFF, 0xAE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0x8D, 0xE6, 0xFF, 0xF9, 0xFF, 0xFF, 0xCE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0x2C, 0xCE, 0xFF, 0x13, 0xE7, 0xFF, 0x2C, 0xCE, 0xFF, 0xEC, 0xC5, 0xFF, 0x88, 0x94, 0xFF, 0x26, 0x8C, 0xFF,
-    0xF2, 0xF7, 0xFF, 0x2A, 0x9D, 0xFF, 0x2A, 0xAD, 0xFF, 0xF0, 0xE6, 0xFF, 0x4B, 0xCE, 0xFF, 0x2D, 0xCE, 0xFF, 0x8C, 0xBD, 0xFF, 0x0C, 0xC6, 0xFF, 0x70, 0xEF, 0xFF, 0x8F, 0xCE, 0xFF, 0xF5, 0xFF, 0xFF, 0xAB, 0xAD, 0xFF, 0x0F, 0xDF, 0xFF, 0xEB, 0xBD, 0xFF, 0xF4, 0xFF, 0xFF, 0x6A, 0xAD, 0xFF, 0xF4, 0xFF, 0xFF, 0x2D, 0xD6, 0xFF, 0x2A, 0xBD, 0xFF, 0x6B, 0xCD, 0xFF, 0x6D, 0xE6, 0xFF, 0x8E, 0xDE, 0xFF, 0x68, 0x94, 0xFF, 0x68, 0x94, 0xFF, 0x8C, 0xB5, 0xFF, 0x27, 0x8C, 0xFF, 0x4E, 0xDE, 0xFF, 0x68, 0x94, 0xFF, 0x86, 0x83, 0xFF, 0x2C, 0xCE, 0xFF, 0x4C, 0xB5, 0xFF, 0xA9, 0xA4, 0xFF, 0x87, 0x7B, 0xFF, 0x0F, 0xE7, 0xFF, 0xC9, 0x9C, 0xFF, 0xC6, 0x8B, 0xFF, 0xE7, 0x83, 0xFF, 0x6E, 0xCE, 0xFF, 0x08, 0x8C, 0xFF, 0x24, 0x6B, 0xFF, 0xA6, 0x7B, 0xFF, 0xAB, 0xB5, 0xFF, 0x86, 0x7B, 0xFF, 0xE8, 0x83, 0xFF, 0x65, 0x73, 0xFF, 0xCB, 0xB5, 0xFF, 0xE8, 0x83, 0xFF, 0xE7, 0x7B, 0xFF, 0x2E, 0xBE, 0xFF, 0xEA, 0x9C, 0xFF, 0xC8, 0x73, 0xFF, 0xA5, 0x73, 0xFF, 0xE7, 0x73, 0xFF, 0xC9, 0x8C, 0xFF, 0xE7, 0x73, 0xFF, 0x07, 0x74, 0xFF, 0x0A, 0x9D, 0xFF, 0x65, 0x63, 0xFF, 0x27, 0x7C, 0xFF, 0xA3, 0x4A, 0xFF, 0x07, 0x7C, 0xFF, 0x06, 0x74, 0xFF, 0x48, 0x84, 0xFF, 0x27, 0x7C, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x49, 0xAD, 0xFF, 0x8A, 0xB5, 0xFF, 0xF6, 0xDF, 0xFF, 0xED, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xEB, 0xD5, 0xFF, 0x28, 0xBD, 0xFF, 0xCF, 0xF7, 0xFF, 0x27, 0x8C, 0xFF, 0x8A, 0xB5, 0xFF, 0x8B, 0xB5, 0xFF, 0x0F, 0xE7, 0xFF, 0x68, 0x8C, 0xFF, 0x4A, 0xA5, 0xFF, 0x07, 0x84, 0xFF, 0xCD, 0xC5, 0xFF, 0xF4, 0xFF, 0xFF, 0x2D, 0xCE, 0xFF, 0x2D, 0xDE, 0xFF, 0xAE, 0xE6, 0xFF, 0xF2, 0xFF, 0xFF, 0x88, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xC5, 0xFF, 0xA8, 0x94, 0xFF, 0xAF, 0xD6, 0xFF, 0x48, 0x94, 0xFF, 0x6E, 0xD6, 0xFF, 0xEC, 0xBD, 0xFF, 0x4F, 0xEF, 0xFF, 0x4D, 0xDE, 0xFF, 0xAB, 0xBD, 0xFF, 0x09, 0xBD, 0xFF, 0xF3, 0xFF, 0xFF, 0x6A, 0xB5, 0xFF, 0x48, 0x9C, 0xFF, 0x48, 0x94, 0xFF, 0x2A, 0xB5, 0xFF, 0xF3, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xC9, 0xA4, 0xFF, 0x2D, 0xD6, 0xFF, 0x2F, 0xEF, 0xFF, 0x2B, 0xAD, 0xFF, 0xE8, 0x8B, 0xFF, 0x85, 0x7B, 0xFF, 0xCE, 0xE6, 0xFF, 0x66, 0x73, 0xFF, 0x8B, 0xB5, 0xFF, 0x69, 0x94, 0xFF, 0xC6, 0x83, 0xFF, 0xAB, 0xBD, 0xFF, 0x28, 0x8C, 0xFF, 0x87, 0x7B, 0xFF, 0xAA, 0xA4, 0xFF, 0xCB, 0xB5, 0xFF, 0x04, 0x63, 0xFF, 0xC7, 0x83, 0xFF, 0xEB, 0x9C, 0xFF, 0x6C, 0xAD, 0xFF, 0x87, 0x73, 0xFF,
-    0x05, 0x63, 0xFF, 0x25, 0x63, 0xFF, 0x86, 0x6B, 0xFF, 0x4B, 0xA5, 0xFF, 0x66, 0x6B, 0xFF, 0xA6, 0x6B, 0xFF, 0xE7, 0x73, 0xFF, 0xC8, 0x94, 0xFF, 0x86, 0x6B, 0xFF, 0xC6, 0x6B, 0xFF, 0x07, 0x74, 0xFF, 0x44, 0x63, 0xFF, 0x48, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0xC6, 0x73, 0xFF, 0x07, 0x74, 0xFF, 0x25, 0x63, 0xFF, 0xC6, 0x83, 0xFF, 0x27, 0x84, 0xFF, 0xC9, 0xA4, 0xFF, 0xCD, 0xEE, 0xFF, 0x4B, 0xBD, 0xFF, 0xE9, 0xA4, 0xFF, 0xC8, 0xA4, 0xFF, 0xD3, 0xFF, 0xFF, 0xEA, 0xCD, 0xFF, 0xCF, 0xD6, 0xFF, 0x48, 0x8C, 0xFF, 0xA5, 0x7B, 0xFF, 0xCE, 0xE6, 0xFF, 0xCB, 0xAD, 0xFF, 0x4B, 0x9D, 0xFF, 0x68, 0x8C, 0xFF, 0x4A, 0xAD, 0xFF, 0xF2, 0xFF, 0xFF, 0x8A, 0xBD, 0xFF, 0xAE, 0xE6, 0xFF, 0xFE, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xCA, 0xCD, 0xFF, 0x88, 0x94, 0xFF, 0xAE, 0xDE, 0xFF, 0xAC, 0xBD, 0xFF, 0x91, 0xF7, 0xFF, 0x47, 0x8C, 0xFF, 0xEB, 0xC5, 0xFF, 0xEC, 0xCD, 0xFF, 0x88, 0x9C, 0xFF, 0xEB, 0xC5, 0xFF, 0x52, 0xEF, 0xFF, 0xEC, 0xBD, 0xFF, 0x2A, 0xBD, 0xFF, 0x70, 0xF7, 0xFF, 0x4A, 0xB5, 0xFF, 0x48, 0x9C, 0xFF, 0x68, 0x94, 0xFF, 0x6A, 0xBD, 0xFF, 0xF3, 0xFF, 0xFF, 0xAF, 0xF6, 0xFF, 0x4B, 0xB5, 0xFF, 0x91, 0xF7, 0xFF, 0xD7, 0xFF, 0xFF, 0xEB, 0xAC, 0xFF, 0x68, 0x9C, 0xFF,
-    0xED, 0xC5, 0xFF, 0x66, 0x6B, 0xFF, 0x0F, 0xEF, 0xFF, 0x86, 0x83, 0xFF, 0x27, 0x8C, 0xFF, 0x65, 0x73, 0xFF, 0xAF, 0xDE, 0xFF, 0xE7, 0x83, 0xFF, 0x28, 0x8C, 0xFF, 0xE4, 0x6A, 0xFF, 0x66, 0x73, 0xFF, 0xAB, 0xB5, 0xFF, 0x49, 0x94, 0xFF, 0xA7, 0x7B, 0xFF, 0x08, 0x84, 0xFF, 0x28, 0x84, 0xFF, 0x4C, 0xAD, 0xFF, 0x26, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0xE5, 0x5A, 0xFF, 0xEB, 0xBD, 0xFF, 0x85, 0x63, 0xFF, 0x86, 0x6B, 0xFF, 0x28, 0x84, 0xFF, 0xC6, 0x6B, 0xFF, 0x0A, 0x9D, 0xFF, 0xC6, 0x6B, 0xFF, 0x07, 0x7C, 0xFF, 0x07, 0x74, 0xFF, 0x07, 0x7C, 0xFF, 0x88, 0x84, 0xFF, 0x07, 0x7C, 0xFF, 0xC7, 0x7B, 0xFF, 0x2B, 0xAD, 0xFF, 0x8E, 0xDE, 0xFF, 0xC9, 0x9C, 0xFF, 0xC8, 0x9C, 0xFF, 0x28, 0x84, 0xFF, 0x85, 0x73, 0xFF, 0xD2, 0xFF, 0xFF, 0x2A, 0xAD, 0xFF, 0xEB, 0xB5, 0xFF, 0x88, 0x8C, 0xFF, 0xE6, 0x7B, 0xFF, 0x4F, 0xF7, 0xFF, 0xA8, 0x9C, 0xFF, 0x9A, 0xEF, 0xFF, 0xC9, 0x94, 0xFF, 0xAA, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0xF7, 0xFF, 0xCF, 0xEE, 0xFF, 0xF5, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x8B, 0xCD, 0xFF, 0x2B, 0xB5, 0xFF, 0x8D, 0xD6, 0xFF, 0x6F, 0xF7, 0xFF, 0x49, 0xAD, 0xFF, 0xC8, 0x94, 0xFF, 0x8B, 0xB5, 0xFF, 0x10, 0xEF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xC8, 0x9C, 0xFF, 0xCC, 0xBD, 0xFF, 0xC9, 0xA4, 0xFF, 0xEF, 0xEE, 0xFF, 0xF3, 0xFF, 0xFF, 0x6A, 0xBD, 0xFF, 0x27, 0x94, 0xFF, 0x68, 0x9C, 0xFF, 0x51, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x4D, 0xE6, 0xFF, 0xCA, 0xAC, 0xFF, 0xC9, 0xAC, 0xFF, 0x6A, 0xBD, 0xFF, 0xCE, 0xE6, 0xFF, 0x07, 0x8C, 0xFF, 0xD1, 0xFF, 0xFF, 0xC5, 0x83, 0xFF, 0xF2, 0xFF, 0xFF, 0x66, 0x7B, 0xFF, 0x4D, 0xCE, 0xFF, 0xC5, 0x7B, 0xFF, 0xAA, 0xA4, 0xFF, 0x10, 0xEF, 0xFF, 0xAC, 0xB5, 0xFF, 0x47, 0x8C, 0xFF, 0x66, 0x7B, 0xFF, 0xCB, 0x9C, 0xFF, 0x6A, 0xAD, 0xFF, 0x48, 0x8C, 0xFF, 0xA7, 0x73, 0xFF, 0x25, 0x6B, 0xFF, 0x4D, 0xBE, 0xFF, 0x24, 0x6B, 0xFF, 0xC4, 0x5A, 0xFF, 0xA3, 0x52, 0xFF, 0xE7, 0x7B, 0xFF, 0x24, 0x63, 0xFF, 0x66, 0x6B, 0xFF, 0xE4, 0x5A, 0xFF, 0x46, 0x63, 0xFF, 0xA6, 0x6B, 0xFF, 0xB4, 0xF7, 0xFF, 0xA7, 0x6B, 0xFF, 0xA6, 0x6B, 0xFF, 0x27, 0x7C, 0xFF, 0x48, 0x7C, 0xFF, 0xE7, 0x73, 0xFF, 0xAC, 0xB5, 0xFF, 0xCE, 0xBD, 0xFF, 0xC9, 0x9C, 0xFF, 0x8F, 0xCE, 0xFF, 0x04, 0x63, 0xFF, 0xF4, 0xFF, 0xFF, 0x66, 0x6B, 0xFF, 0xCC, 0xC5, 0xFF, 0xE7, 0x7B, 0xFF, 0xE6, 0x7B, 0xFF, 0x45, 0x8C, 0xFF, 0x8F, 0xDE, 0xFF, 0xCB, 0xBD, 0xFF, 0x67, 0x94, 0xFF, 0xA6, 0x7B, 0xFF, 0xA8, 0x9C, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xE6, 0x8B, 0xFF, 0x0F, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF6, 0xFF, 0x6D, 0xDE, 0xFF, 0x30, 0xEF, 0xFF, 0x0B, 0xC6, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0xA4, 0xFF, 0x0D, 0xC6, 0xFF, 0x4B, 0xB5, 0xFF, 0x6A, 0xB5, 0xFF, 0xFC, 0xFF, 0xFF, 0x6E, 0xD6, 0xFF, 0xAF, 0xE6, 0xFF, 0xED, 0xC5, 0xFF, 0x6D, 0xD6, 0xFF, 0xF5, 0xFF, 0xFF, 0x4D, 0xCE, 0xFF, 0xC7, 0x8B, 0xFF, 0x28, 0xA4, 0xFF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEB, 0xE5, 0xFF, 0xF4, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0x09, 0xA5, 0xFF, 0x07, 0x8C, 0xFF, 0x4C, 0xCE, 0xFF, 0x65, 0x73, 0xFF, 0x71, 0xF7, 0xFF, 0xCA, 0xA4, 0xFF, 0x0C, 0xC6, 0xFF, 0x0D, 0xBE, 0xFF, 0xE5, 0x83, 0xFF, 0xFB, 0xFF, 0xFF, 0xAB, 0xC5, 0xFF, 0xE8, 0x83, 0xFF, 0x46, 0x6B, 0xFF, 0xA7, 0x7B, 0xFF, 0xE8, 0x9C, 0xFF, 0x25, 0x6B, 0xFF, 0x22, 0x4A, 0xFF, 0x49, 0x8C, 0xFF, 0x65, 0x73, 0xFF, 0x0F, 0xE7, 0xFF, 0xE4, 0x52, 0xFF, 0x8A, 0x8C, 0xFF, 0xA6, 0x73, 0xFF, 0x65, 0x6B, 0xFF, 0xAC, 0xB5, 0xFF, 0xC7, 0x73, 0xFF, 0x65, 0x63, 0xFF, 0x08, 0x7C, 0xFF, 0xE7, 0x73, 0xFF, 0x8B, 0xA5, 0xFF, 0x27, 0x74, 0xFF, 0x07, 0x7C, 0xFF, 0x28, 0x7C, 0xFF,
-    0x65, 0x6B, 0xFF, 0xAD, 0xB5, 0xFF, 0xC5, 0x52, 0xFF, 0x6A, 0x8C, 0xFF, 0x04, 0x63, 0xFF, 0xC4, 0x5A, 0xFF, 0x87, 0x94, 0xFF, 0xA6, 0x73, 0xFF, 0x08, 0x84, 0xFF, 0x46, 0x6B, 0xFF, 0xFD, 0xFF, 0xFF, 0xEC, 0xB5, 0xFF, 0x44, 0x6B, 0xFF, 0xAA, 0x9C, 0xFF, 0x86, 0x73, 0xFF, 0xCC, 0xBD, 0xFF, 0x88, 0x94, 0xFF, 0xA8, 0xB4, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x10, 0xEF, 0xFF, 0x6D, 0xDE, 0xFF, 0xB4, 0xFF, 0xFF, 0x8C, 0xBD, 0xFF, 0x07, 0x8C, 0xFF, 0xEF, 0xEE, 0xFF, 0x47, 0x94, 0xFF, 0xCE, 0xE6, 0xFF, 0x27, 0x8C, 0xFF, 0xA9, 0xA4, 0xFF, 0xCC, 0xBD, 0xFF, 0x30, 0xEF, 0xFF, 0x6A, 0xBD, 0xFF, 0x68, 0x94, 0xFF, 0x08, 0xBD, 0xFF, 0xF3, 0xFF, 0xFF, 0x2B, 0xB5, 0xFF, 0x08, 0x94, 0xFF, 0x68, 0xB4, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0xFE, 0xFF, 0x6D, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x6E, 0xE6, 0xFF, 0x24, 0x73, 0xFF, 0xC7, 0x7B, 0xFF, 0xD2, 0xFF, 0xFF, 0x49, 0x8C, 0xFF, 0x4C, 0xC6, 0xFF, 0x4A, 0xB5, 0xFF, 0x29, 0xAD, 0xFF, 0x6F, 0xD6, 0xFF, 0x0C, 0xCE, 0xFF, 0x06, 0x9C, 0xFF, 0xC6, 0x8B, 0xFF, 0x2C, 0xC6, 0xFF, 0x66, 0x6B, 0xFF, 0x29, 0x8C, 0xFF, 0x49, 0x8C, 0xFF, 0xEA, 0xA4, 0xFF, 0xA4, 0x52, 0xFF,
-    0xE5, 0x5A, 0xFF, 0x8A, 0x94, 0xFF, 0x25, 0x63, 0xFF, 0x84, 0x52, 0xFF, 0x25, 0x63, 0xFF, 0x86, 0x6B, 0xFF, 0xC6, 0x73, 0xFF, 0x45, 0x63, 0xFF, 0x65, 0x63, 0xFF, 0xA6, 0x6B, 0xFF, 0xE7, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0xC6, 0x6B, 0xFF, 0x07, 0x74, 0xFF, 0xA6, 0x6B, 0xFF, 0x07, 0x74, 0xFF, 0x83, 0x4A, 0xFF, 0xC8, 0x73, 0xFF, 0xA4, 0x52, 0xFF, 0x47, 0x6B, 0xFF, 0xC5, 0x5A, 0xFF, 0x66, 0x6B, 0xFF, 0x45, 0x63, 0xFF, 0x24, 0x63, 0xFF, 0x49, 0x8C, 0xFF, 0x25, 0x63, 0xFF, 0xE9, 0x9C, 0xFF, 0x86, 0x6B, 0xFF, 0x24, 0x63, 0xFF, 0x28, 0x8C, 0xFF, 0x2C, 0xBE, 0xFF, 0xC6, 0x7B, 0xFF, 0xA8, 0x9C, 0xFF, 0x69, 0xC5, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEB, 0xD5, 0xFF, 0x8A, 0xBD, 0xFF, 0x69, 0xBD, 0xFF, 0x6A, 0xB5, 0xFF, 0x6F, 0xD6, 0xFF, 0xAE, 0xDE, 0xFF, 0x0C, 0xD6, 0xFF, 0x50, 0xF7, 0xFF, 0x47, 0x94, 0xFF, 0x0C, 0xCE, 0xFF, 0xA8, 0x9C, 0xFF, 0x93, 0xF7, 0xFF, 0x07, 0x8C, 0xFF, 0x2C, 0xCE, 0xFF, 0xC6, 0x83, 0xFF, 0xC8, 0xB4, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0x8B, 0xFF, 0x08, 0x94, 0xFF, 0x88, 0xB4, 0xFF, 0xF6, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xCF, 0xFE, 0xFF, 0x4B, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF6, 0xFF, 0x90, 0xE6, 0xFF, 0x45, 0x6B, 0xFF,
-    0x2F, 0xDF, 0xFF, 0x05, 0x6B, 0xFF, 0xC5, 0x83, 0xFF, 0x45, 0x73, 0xFF, 0xCB, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0xBD, 0xFF, 0xE7, 0x83, 0xFF, 0x04, 0x63, 0xFF, 0x47, 0x73, 0xFF, 0xC3, 0x5A, 0xFF, 0x88, 0x8C, 0xFF, 0xA8, 0x7B, 0xFF, 0x28, 0x8C, 0xFF, 0xE5, 0x62, 0xFF, 0x48, 0x84, 0xFF, 0x27, 0x6B, 0xFF, 0x85, 0x52, 0xFF, 0x47, 0x6B, 0xFF, 0x24, 0x63, 0xFF, 0x67, 0x6B, 0xFF, 0x05, 0x5B, 0xFF, 0x46, 0x63, 0xFF, 0x85, 0x6B, 0xFF, 0x49, 0x84, 0xFF, 0x66, 0x63, 0xFF, 0x86, 0x6B, 0xFF, 0x27, 0x74, 0xFF, 0xA6, 0x6B, 0xFF, 0x48, 0x7C, 0xFF, 0x27, 0x7C, 0xFF, 0x27, 0x7C, 0xFF, 0x87, 0x6B, 0xFF, 0xC4, 0x52, 0xFF, 0x84, 0x52, 0xFF, 0xE5, 0x62, 0xFF, 0xC6, 0x7B, 0xFF, 0xE5, 0x5A, 0xFF, 0xE4, 0x5A, 0xFF, 0xA6, 0x73, 0xFF, 0xAE, 0xDE, 0xFF, 0x72, 0xE7, 0xFF, 0x48, 0x8C, 0xFF, 0x05, 0x63, 0xFF, 0x72, 0xEF, 0xFF, 0xF2, 0xFF, 0xFF, 0x8A, 0x95, 0xFF, 0x6A, 0xA5, 0xFF, 0x8F, 0xD6, 0xFF, 0xF1, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEC, 0xCD, 0xFF, 0xEC, 0xCD, 0xFF, 0xCE, 0xE6, 0xFF, 0x26, 0x94, 0xFF, 0x52, 0xEF, 0xFF, 0x68, 0x9C, 0xFF, 0xCE, 0xEE, 0xFF, 0x71, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0x8B, 0xBD, 0xFF, 0xCC, 0xC5, 0xFF, 0x29, 0xAD, 0xFF, 0x67, 0x94, 0xFF,
-    0x27, 0x8C, 0xFF, 0xA8, 0x9C, 0xFF, 0x08, 0x8C, 0xFF, 0x49, 0xBD, 0xFF, 0xC8, 0xA4, 0xFF, 0xC6, 0x83, 0xFF, 0xE7, 0x93, 0xFF, 0x48, 0xA4, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x11, 0xFF, 0xFF, 0xCA, 0xAC, 0xFF, 0xAF, 0xF6, 0xFF, 0xAC, 0xD5, 0xFF, 0x0A, 0xB5, 0xFF, 0x07, 0x8C, 0xFF, 0x0D, 0xC6, 0xFF, 0xC3, 0x62, 0xFF, 0x47, 0x8C, 0xFF, 0xE5, 0x6A, 0xFF, 0x2C, 0xC6, 0xFF, 0x4A, 0xBD, 0xFF, 0xF0, 0xE6, 0xFF, 0x87, 0x7B, 0xFF, 0x0A, 0xA5, 0xFF, 0x47, 0x6B, 0xFF, 0xE5, 0x5A, 0xFF, 0xCC, 0xB5, 0xFF, 0x65, 0x73, 0xFF, 0x67, 0x6B, 0xFF, 0xC5, 0x5A, 0xFF, 0x64, 0x4A, 0xFF, 0x44, 0x63, 0xFF, 0x64, 0x4A, 0xFF, 0xC5, 0x5A, 0xFF, 0xA5, 0x52, 0xFF, 0xE7, 0x7B, 0xFF, 0x25, 0x5B, 0xFF, 0x46, 0x63, 0xFF, 0x87, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0xC7, 0x73, 0xFF, 0xA6, 0x6B, 0xFF, 0xC7, 0x73, 0xFF, 0xE7, 0x73, 0xFF, 0x27, 0x74, 0xFF, 0x68, 0x84, 0xFF, 0x8C, 0xA5, 0xFF, 0x44, 0x4A, 0xFF, 0x83, 0x52, 0xFF, 0xCC, 0xC5, 0xFF, 0xE5, 0x5A, 0xFF, 0x84, 0x52, 0xFF, 0xC4, 0x52, 0xFF, 0x09, 0x84, 0xFF, 0xEB, 0xCD, 0xFF, 0x65, 0x6B, 0xFF, 0xE5, 0x5A, 0xFF, 0x89, 0x8C, 0xFF, 0xC2, 0x62, 0xFF, 0xF6, 0xFF, 0xFF, 0xE9, 0x9C, 0xFF, 0x4C, 0xAE, 0xFF, 0xF0, 0xDE, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x0B, 0xB6, 0xFF, 0x8B, 0xBD, 0xFF, 0xF3, 0xFF, 0xFF, 0x2C, 0xCE, 0xFF, 0x8E, 0xDE, 0xFF, 0x73, 0xEF, 0xFF, 0xF2, 0xFF, 0xFF, 0x4C, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0x70, 0xF7, 0xFF, 0x4A, 0xAD, 0xFF, 0xC9, 0xA4, 0xFF, 0xF3, 0xFF, 0xFF, 0xCC, 0xBD, 0xFF, 0xAB, 0xBD, 0xFF, 0x08, 0x8C, 0xFF, 0x49, 0xB5, 0xFF, 0xF2, 0xFF, 0xFF, 0x48, 0x94, 0xFF, 0x6A, 0x9C, 0xFF, 0x28, 0x9C, 0xFF, 0xF2, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xAF, 0xF6, 0xFF, 0x28, 0x9C, 0xFF, 0x6A, 0xC5, 0xFF, 0x90, 0xFF, 0xFF, 0x2D, 0xD6, 0xFF, 0x26, 0x6B, 0xFF, 0x45, 0x6B, 0xFF, 0xEE, 0xE6, 0xFF, 0xC9, 0xA4, 0xFF, 0x2B, 0xA5, 0xFF, 0x46, 0x73, 0xFF, 0xEC, 0xC5, 0xFF, 0x96, 0xEF, 0xFF, 0x0C, 0xC6, 0xFF, 0x05, 0x63, 0xFF, 0x2B, 0xA5, 0xFF, 0x4C, 0xAD, 0xFF, 0x06, 0x63, 0xFF, 0x6B, 0xAD, 0xFF, 0xEE, 0xBD, 0xFF, 0x03, 0x42, 0xFF, 0x44, 0x4A, 0xFF, 0x67, 0x6B, 0xFF, 0x2A, 0x9D, 0xFF, 0x84, 0x52, 0xFF, 0x23, 0x42, 0xFF, 0x87, 0x73, 0xFF, 0xE9, 0x94, 0xFF, 0xCC, 0xB5, 0xFF, 0x87, 0x6B, 0xFF, 0x46, 0x63, 0xFF, 0xA6, 0x6B, 0xFF, 0x4C, 0xBE, 0xFF, 0x65, 0x63, 0xFF, 0xC7, 0x73, 0xFF, 0x04, 0x53, 0xFF, 0xE9, 0x8C, 0xFF, 0x27, 0x7C, 0xFF,
-    0x2B, 0xAD, 0xFF, 0x84, 0x52, 0xFF, 0xA4, 0x52, 0xFF, 0x04, 0x5B, 0xFF, 0xC5, 0x52, 0xFF, 0xC9, 0x9C, 0xFF, 0x89, 0x94, 0xFF, 0x27, 0x84, 0xFF, 0x86, 0x63, 0xFF, 0x45, 0x63, 0xFF, 0xAA, 0xBD, 0xFF, 0x44, 0x6B, 0xFF, 0xB4, 0xF7, 0xFF, 0x07, 0x7C, 0xFF, 0xEB, 0xA5, 0xFF, 0xAB, 0xB5, 0xFF, 0x08, 0xA5, 0xFF, 0xF4, 0xFF, 0xFF, 0x2C, 0xC6, 0xFF, 0x8B, 0xBD, 0xFF, 0x67, 0x94, 0xFF, 0xF3, 0xFF, 0xFF, 0x8A, 0xBD, 0xFF, 0x11, 0xEF, 0xFF, 0x09, 0xB5, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x8A, 0xBD, 0xFF, 0x4A, 0xAD, 0xFF, 0x0D, 0xCE, 0xFF, 0xF9, 0xFF, 0xFF, 0xEE, 0xE6, 0xFF, 0x68, 0x94, 0xFF, 0xE8, 0x8B, 0xFF, 0xAC, 0xC5, 0xFF, 0xF5, 0xFF, 0xFF, 0xEC, 0xCD, 0xFF, 0xC7, 0x83, 0xFF, 0x08, 0x94, 0xFF, 0x8B, 0xCD, 0xFF, 0xF2, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xC7, 0x83, 0xFF, 0x23, 0x73, 0xFF, 0x46, 0x94, 0xFF, 0x4F, 0xF7, 0xFF, 0x46, 0x73, 0xFF, 0xE4, 0x62, 0xFF, 0xA3, 0x5A, 0xFF, 0x24, 0x6B, 0xFF, 0x0E, 0xE7, 0xFF, 0x26, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0x45, 0x6B, 0xFF, 0x10, 0xEF, 0xFF, 0x4C, 0xCE, 0xFF, 0xE5, 0x62, 0xFF, 0x84, 0x52, 0xFF, 0x64, 0x52, 0xFF, 0xA5, 0x5A, 0xFF, 0xED, 0xBD, 0xFF, 0x25, 0x63, 0xFF, 0xC6, 0x5A, 0xFF,
-    0x65, 0x52, 0xFF, 0x62, 0x4A, 0xFF, 0x4D, 0xC6, 0xFF, 0x64, 0x4A, 0xFF, 0x06, 0x63, 0xFF, 0x87, 0x6B, 0xFF, 0x8A, 0x8C, 0xFF, 0x0F, 0xE7, 0xFF, 0x87, 0x6B, 0xFF, 0xC7, 0x73, 0xFF, 0x08, 0x7C, 0xFF, 0xA6, 0x73, 0xFF, 0xD2, 0xF7, 0xFF, 0x86, 0x6B, 0xFF, 0xE7, 0x73, 0xFF, 0xC6, 0x73, 0xFF, 0x48, 0x94, 0xFF, 0xC4, 0x52, 0xFF, 0xA5, 0x4A, 0xFF, 0xA4, 0x4A, 0xFF, 0xA5, 0x4A, 0xFF, 0xEC, 0xC5, 0xFF, 0x67, 0x84, 0xFF, 0xA7, 0x6B, 0xFF, 0x04, 0x5B, 0xFF, 0x25, 0x5B, 0xFF, 0xAE, 0xE6, 0xFF, 0xC4, 0x52, 0xFF, 0x2B, 0xA5, 0xFF, 0xE6, 0x7B, 0xFF, 0xF6, 0xFF, 0xFF, 0x6B, 0xB5, 0xFF, 0xAE, 0xDE, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE6, 0x7B, 0xFF, 0x4A, 0xAD, 0xFF, 0x48, 0x94, 0xFF, 0xF3, 0xFF, 0xFF, 0xEA, 0xB4, 0xFF, 0xF2, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x8D, 0xE6, 0xFF, 0x6B, 0xB5, 0xFF, 0x8E, 0xD6, 0xFF, 0x4A, 0xB5, 0xFF, 0xEA, 0xAC, 0xFF, 0x6B, 0xBD, 0xFF, 0x68, 0x94, 0xFF, 0x08, 0x8C, 0xFF, 0x48, 0x9C, 0xFF, 0x0A, 0xB5, 0xFF, 0x07, 0x8C, 0xFF, 0xE7, 0x8B, 0xFF, 0xE8, 0x8B, 0xFF, 0xC7, 0x83, 0xFF, 0xD2, 0xFF, 0xFF, 0x53, 0xF7, 0xFF, 0xA7, 0x83, 0xFF, 0x65, 0x7B, 0xFF, 0xB1, 0xFF, 0xFF, 0x4B, 0xAD, 0xFF, 0x05, 0x63, 0xFF,
-    0x04, 0x63, 0xFF, 0x84, 0x5A, 0xFF, 0x25, 0x63, 0xFF, 0xE7, 0x83, 0xFF, 0x25, 0x63, 0xFF, 0x6A, 0xA5, 0xFF, 0x26, 0x63, 0xFF, 0x26, 0x63, 0xFF, 0x64, 0x52, 0xFF, 0xC5, 0x5A, 0xFF, 0xC9, 0x94, 0xFF, 0x28, 0x84, 0xFF, 0x65, 0x52, 0xFF, 0x64, 0x4A, 0xFF, 0xC5, 0x5A, 0xFF, 0x6A, 0x84, 0xFF, 0x44, 0x4A, 0xFF, 0x44, 0x4A, 0xFF, 0x85, 0x52, 0xFF, 0x23, 0x42, 0xFF, 0xE4, 0x5A, 0xFF, 0x47, 0x6B, 0xFF, 0x46, 0x63, 0xFF, 0xE9, 0xA4, 0xFF, 0x68, 0x94, 0xFF, 0x28, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0x48, 0x84, 0xFF, 0x48, 0x84, 0xFF, 0x27, 0x7C, 0xFF, 0x48, 0x7C, 0xFF, 0xE7, 0x73, 0xFF, 0x66, 0x6B, 0xFF, 0x64, 0x42, 0xFF, 0xA5, 0x4A, 0xFF, 0xA4, 0x52, 0xFF, 0xEB, 0xC5, 0xFF, 0xE4, 0x5A, 0xFF, 0xC4, 0x5A, 0xFF, 0x62, 0x4A, 0xFF, 0xC5, 0x62, 0xFF, 0x6C, 0xD6, 0xFF, 0x0E, 0xC6, 0xFF, 0xC5, 0x5A, 0xFF, 0xEA, 0xA4, 0xFF, 0x6F, 0xFF, 0xFF, 0x0B, 0xAD, 0xFF, 0xE9, 0xAC, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xEE, 0xFF, 0x2A, 0xB5, 0xFF, 0xE7, 0x83, 0xFF, 0x0D, 0xCE, 0xFF, 0x08, 0x8C, 0xFF, 0x09, 0xAD, 0xFF, 0x28, 0x94, 0xFF, 0x4C, 0xD6, 0xFF, 0xED, 0xE6, 0xFF, 0x70, 0xF7, 0xFF, 0x09, 0xA5, 0xFF, 0xAB, 0xBD, 0xFF, 0x8B, 0xBD, 0xFF, 0x6C, 0xE6, 0xFF,
-    0x2E, 0xD6, 0xFF, 0xA9, 0xAC, 0xFF, 0x28, 0x94, 0xFF, 0x27, 0x94, 0xFF, 0xB1, 0xFF, 0xFF, 0x28, 0x94, 0xFF, 0x07, 0x8C, 0xFF, 0xC7, 0x83, 0xFF, 0x07, 0x84, 0xFF, 0x71, 0xFF, 0xFF, 0xAD, 0xC5, 0xFF, 0xA7, 0x7B, 0xFF, 0x45, 0x73, 0xFF, 0x8E, 0xDE, 0xFF, 0xE8, 0x83, 0xFF, 0x05, 0x63, 0xFF, 0x83, 0x52, 0xFF, 0xC3, 0x5A, 0xFF, 0x0C, 0xCE, 0xFF, 0x05, 0x6B, 0xFF, 0x8B, 0xB5, 0xFF, 0xCD, 0xD6, 0xFF, 0x6B, 0xAD, 0xFF, 0xE5, 0x5A, 0xFF, 0x88, 0x84, 0xFF, 0xA4, 0x52, 0xFF, 0x85, 0x52, 0xFF, 0x88, 0x94, 0xFF, 0xE7, 0x7B, 0xFF, 0x03, 0x42, 0xFF, 0x03, 0x42, 0xFF, 0x2C, 0xA5, 0xFF, 0x29, 0x84, 0xFF, 0x03, 0x42, 0xFF, 0x65, 0x4A, 0xFF, 0x85, 0x4A, 0xFF, 0x04, 0x63, 0xFF, 0xE6, 0x5A, 0xFF, 0x26, 0x63, 0xFF, 0xCB, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0x6C, 0xBD, 0xFF, 0xE8, 0xAC, 0xFF, 0x88, 0x8C, 0xFF, 0xA8, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0xA5, 0xFF, 0x64, 0x42, 0xFF, 0x63, 0x4A, 0xFF, 0x08, 0x84, 0xFF, 0x64, 0x4A, 0xFF, 0xA5, 0x52, 0xFF, 0x26, 0x5B, 0xFF, 0x25, 0x63, 0xFF, 0xE3, 0x62, 0xFF, 0x83, 0x52, 0xFF, 0x05, 0x63, 0xFF, 0x08, 0x84, 0xFF, 0xA3, 0x52, 0xFF, 0x07, 0x94, 0xFF, 0x46, 0x6B, 0xFF, 0x48, 0x8C, 0xFF, 0xF6, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x2E, 0xF7, 0xFF, 0xCC, 0xC5, 0xFF, 0xAA, 0xA4, 0xFF, 0x0E, 0xDF, 0xFF, 0xA9, 0x9C, 0xFF, 0x05, 0x8C, 0xFF, 0x48, 0x94, 0xFF, 0x2D, 0xCE, 0xFF, 0xA8, 0x9C, 0xFF, 0x6E, 0xD6, 0xFF, 0x2B, 0xB5, 0xFF, 0xEC, 0xBD, 0xFF, 0x6D, 0xD6, 0xFF, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xEA, 0xB4, 0xFF, 0x89, 0xA4, 0xFF, 0x2A, 0xBD, 0xFF, 0xFB, 0xFF, 0xFF, 0x2D, 0xDE, 0xFF, 0xE7, 0x83, 0xFF, 0xE8, 0x83, 0xFF, 0xC8, 0x83, 0xFF, 0x6F, 0xDE, 0xFF, 0x69, 0x9C, 0xFF, 0x66, 0x73, 0xFF, 0x66, 0x7B, 0xFF, 0x8C, 0xC5, 0xFF, 0x05, 0x6B, 0xFF, 0xC4, 0x5A, 0xFF, 0xE4, 0x62, 0xFF, 0xE7, 0x83, 0xFF, 0x05, 0x63, 0xFF, 0xE5, 0x62, 0xFF, 0x2A, 0xAD, 0xFF, 0x47, 0x8C, 0xFF, 0xF3, 0xFF, 0xFF, 0xEA, 0x9C, 0xFF, 0xA4, 0x52, 0xFF, 0x88, 0x8C, 0xFF, 0x44, 0x4A, 0xFF, 0x85, 0x52, 0xFF, 0x05, 0x5B, 0xFF, 0x8A, 0x8C, 0xFF, 0x23, 0x4A, 0xFF, 0x85, 0x52, 0xFF, 0xA5, 0x52, 0xFF, 0x4C, 0x9D, 0xFF, 0x24, 0x42, 0xFF, 0x24, 0x42, 0xFF, 0xC5, 0x52, 0xFF, 0x47, 0x84, 0xFF, 0x06, 0x63, 0xFF, 0x86, 0x6B, 0xFF, 0x67, 0x94, 0xFF, 0x2D, 0xE6, 0xFF, 0xFE, 0xFF, 0xFF, 0x4C, 0xD6, 0xFF, 0x4B, 0xAD, 0xFF, 0x88, 0x94, 0xFF, 0x2B, 0xA5, 0xFF, 0xC7, 0x9C, 0xFF,
-    0x44, 0x42, 0xFF, 0x44, 0x4A, 0xFF, 0x09, 0xAD, 0xFF, 0x85, 0x52, 0xFF, 0x84, 0x52, 0xFF, 0x06, 0x5B, 0xFF, 0xA4, 0x52, 0xFF, 0xD4, 0xFF, 0xFF, 0xA3, 0x52, 0xFF, 0xC4, 0x5A, 0xFF, 0x26, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0x8A, 0xBD, 0xFF, 0x86, 0x73, 0xFF, 0x07, 0x84, 0xFF, 0x2D, 0xDE, 0xFF, 0xEB, 0xCD, 0xFF, 0x49, 0xAD, 0xFF, 0x47, 0x84, 0xFF, 0xE7, 0x83, 0xFF, 0x66, 0x73, 0xFF, 0xC7, 0x7B, 0xFF, 0xC6, 0x7B, 0xFF, 0x69, 0x94, 0xFF, 0xA6, 0x7B, 0xFF, 0x88, 0x8C, 0xFF, 0x4A, 0xAD, 0xFF, 0xE9, 0x9C, 0xFF, 0xAB, 0xB5, 0xFF, 0x4D, 0xD6, 0xFF, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE9, 0xBC, 0xFF, 0xA9, 0xAC, 0xFF, 0xEC, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xD5, 0xFF, 0x28, 0x94, 0xFF, 0xA7, 0x7B, 0xFF, 0xA7, 0x7B, 0xFF, 0x70, 0xFF, 0xFF, 0x69, 0x9C, 0xFF, 0x45, 0x6B, 0xFF, 0xE4, 0x62, 0xFF, 0x06, 0x6B, 0xFF, 0x86, 0x7B, 0xFF, 0xE5, 0x62, 0xFF, 0xE4, 0x5A, 0xFF, 0xE4, 0x5A, 0xFF, 0x05, 0x6B, 0xFF, 0x06, 0x63, 0xFF, 0x29, 0xAD, 0xFF, 0x49, 0xC6, 0xFF, 0xFB, 0xFF, 0xFF, 0xA6, 0x73, 0xFF, 0x26, 0x63, 0xFF, 0xA5, 0x52, 0xFF, 0x64, 0x4A, 0xFF, 0x24, 0x42, 0xFF, 0x4B, 0xA5, 0xFF, 0x24, 0x42, 0xFF, 0x44, 0x4A, 0xFF, 0x44, 0x4A, 0xFF,
-    0x24, 0x42, 0xFF, 0xE7, 0x7B, 0xFF, 0x24, 0x42, 0xFF, 0x24, 0x42, 0xFF, 0x65, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0xC5, 0x52, 0xFF, 0x26, 0x5B, 0xFF, 0xC8, 0x7B, 0xFF, 0x4A, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x6A, 0xB5, 0xFF, 0x2A, 0xAD, 0xFF, 0x6B, 0xA5, 0xFF, 0xAB, 0xB5, 0xFF, 0xC7, 0x73, 0xFF, 0x23, 0x4A, 0xFF, 0x44, 0x42, 0xFF, 0x85, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0x0B, 0xA5, 0xFF, 0x0C, 0xBE, 0xFF, 0xC8, 0x7B, 0xFF, 0x83, 0x52, 0xFF, 0x05, 0x6B, 0xFF, 0x30, 0xF7, 0xFF, 0xF5, 0xFF, 0xFF, 0x2B, 0xAD, 0xFF, 0x46, 0x6B, 0xFF, 0x0A, 0xB5, 0xFF, 0x88, 0x9C, 0xFF, 0x72, 0xF7, 0xFF, 0xAC, 0xB5, 0xFF, 0x28, 0x7C, 0xFF, 0xF0, 0xE6, 0xFF, 0x11, 0xE7, 0xFF, 0x71, 0xF7, 0xFF, 0x85, 0x7B, 0xFF, 0x68, 0x8C, 0xFF, 0xA6, 0x73, 0xFF, 0x07, 0x84, 0xFF, 0xF3, 0xFF, 0xFF, 0xB4, 0xF7, 0xFF, 0x8B, 0xB5, 0xFF, 0xAB, 0xC5, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xEA, 0xB4, 0xFF, 0xEA, 0xBC, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x28, 0x9C, 0xFF, 0xC7, 0x83, 0xFF, 0x48, 0x94, 0xFF, 0xF6, 0xFF, 0xFF, 0x48, 0x94, 0xFF, 0x46, 0x73, 0xFF, 0xE4, 0x62, 0xFF, 0xA8, 0x9C, 0xFF, 0xAE, 0xE6, 0xFF, 0xA5, 0x5A, 0xFF,
-    0x05, 0x63, 0xFF, 0x8B, 0xB5, 0xFF, 0xEB, 0x9C, 0xFF, 0xF5, 0xFF, 0xFF, 0x47, 0x8C, 0xFF, 0x25, 0x84, 0xFF, 0x91, 0xFF, 0xFF, 0x69, 0x8C, 0xFF, 0x8B, 0xB5, 0xFF, 0xE5, 0x5A, 0xFF, 0xA9, 0x8C, 0xFF, 0x44, 0x4A, 0xFF, 0x4C, 0x84, 0xFF, 0x2B, 0xA5, 0xFF, 0x66, 0x6B, 0xFF, 0x45, 0x4A, 0xFF, 0x44, 0x42, 0xFF, 0x65, 0x4A, 0xFF, 0x2B, 0xA5, 0xFF, 0x23, 0x3A, 0xFF, 0x24, 0x42, 0xFF, 0x64, 0x42, 0xFF, 0xA5, 0x52, 0xFF, 0x10, 0xDF, 0xFF, 0x69, 0x94, 0xFF, 0xC7, 0x83, 0xFF, 0x4B, 0xBD, 0xFF, 0x29, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0xAD, 0xFF, 0xA9, 0x94, 0xFF, 0xC9, 0x94, 0xFF, 0x92, 0xF7, 0xFF, 0x64, 0x4A, 0xFF, 0x64, 0x4A, 0xFF, 0xC6, 0x52, 0xFF, 0x42, 0x4A, 0xFF, 0x6E, 0xCE, 0xFF, 0x84, 0x52, 0xFF, 0x46, 0x6B, 0xFF, 0xA5, 0x5A, 0xFF, 0xD4, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xC9, 0x94, 0xFF, 0x8C, 0xB5, 0xFF, 0x65, 0x6B, 0xFF, 0x25, 0x6B, 0xFF, 0xA6, 0x73, 0xFF, 0xA6, 0x73, 0xFF, 0x06, 0x7C, 0xFF, 0xF4, 0xFF, 0xFF, 0xE8, 0x83, 0xFF, 0x66, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0xB0, 0xD6, 0xFF, 0xC6, 0x7B, 0xFF, 0x45, 0x6B, 0xFF, 0xC6, 0x7B, 0xFF, 0xE7, 0x83, 0xFF, 0x6D, 0xCE, 0xFF, 0xA9, 0x9C, 0xFF, 0xE9, 0xAC, 0xFF, 0x8E, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x6D, 0xDE, 0xFF, 0x26, 0x9C, 0xFF, 0xEA, 0xBC, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xED, 0xFF, 0x08, 0x94, 0xFF, 0xE7, 0x83, 0xFF, 0xF1, 0xE6, 0xFF, 0xB2, 0xFF, 0xFF, 0x08, 0x8C, 0xFF, 0x86, 0x7B, 0xFF, 0x27, 0x8C, 0xFF, 0x2D, 0xD6, 0xFF, 0x2D, 0xD6, 0xFF, 0xC5, 0x5A, 0xFF, 0x06, 0x63, 0xFF, 0xCC, 0x9C, 0xFF, 0x2B, 0xA5, 0xFF, 0xA7, 0x7B, 0xFF, 0x48, 0x94, 0xFF, 0x65, 0x73, 0xFF, 0x4B, 0xAD, 0xFF, 0x26, 0x84, 0xFF, 0x84, 0x52, 0xFF, 0x64, 0x4A, 0xFF, 0x4B, 0x8C, 0xFF, 0x87, 0x6B, 0xFF, 0x24, 0x42, 0xFF, 0x24, 0x42, 0xFF, 0x65, 0x4A, 0xFF, 0xAA, 0x8C, 0xFF, 0xA2, 0x31, 0xFF, 0x03, 0x42, 0xFF, 0xE3, 0x39, 0xFF, 0x0B, 0x7C, 0xFF, 0x64, 0x4A, 0xFF, 0x44, 0x42, 0xFF, 0x65, 0x42, 0xFF, 0x2A, 0x7C, 0xFF, 0xA3, 0x52, 0xFF, 0x0C, 0x9D, 0xFF, 0x67, 0x6B, 0xFF, 0x29, 0x84, 0xFF, 0xC8, 0x9C, 0xFF, 0xA9, 0x94, 0xFF, 0x69, 0x84, 0xFF, 0x07, 0x7C, 0xFF, 0x44, 0x4A, 0xFF, 0x64, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0x85, 0x52, 0xFF, 0x6C, 0xAD, 0xFF, 0x03, 0x42, 0xFF, 0xA5, 0x52, 0xFF, 0x2C, 0xA5, 0xFF, 0xA4, 0x52, 0xFF, 0xA4, 0x52, 0xFF, 0xE5, 0x5A, 0xFF, 0x45, 0x6B, 0xFF, 0x86, 0x6B, 0xFF, 0xAE, 0xDE, 0xFF, 0x45, 0x6B, 0xFF, 0xCA, 0x9C, 0xFF,
-    0x48, 0x8C, 0xFF, 0x26, 0x8C, 0xFF, 0xB2, 0xFF, 0xFF, 0x28, 0x84, 0xFF, 0x66, 0x6B, 0xFF, 0xC7, 0x7B, 0xFF, 0x25, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0x66, 0x73, 0xFF, 0x86, 0x73, 0xFF, 0xA7, 0x7B, 0xFF, 0x27, 0x8C, 0xFF, 0x07, 0x84, 0xFF, 0x48, 0x94, 0xFF, 0x07, 0x94, 0xFF, 0xEA, 0xAC, 0xFF, 0x07, 0x94, 0xFF, 0x08, 0x94, 0xFF, 0x27, 0x94, 0xFF, 0x6B, 0xCD, 0xFF, 0x0B, 0xD5, 0xFF, 0x48, 0xA4, 0xFF, 0xC7, 0x8B, 0xFF, 0xC7, 0x83, 0xFF, 0xC7, 0x7B, 0xFF, 0x66, 0x73, 0xFF, 0xE7, 0x83, 0xFF, 0xC6, 0x83, 0xFF, 0xAB, 0xBD, 0xFF, 0xA7, 0x83, 0xFF, 0x26, 0x6B, 0xFF, 0xC5, 0x5A, 0xFF, 0xC5, 0x5A, 0xFF, 0x06, 0x63, 0xFF, 0x84, 0x52, 0xFF, 0xC4, 0x52, 0xFF, 0xC3, 0x5A, 0xFF, 0x26, 0x84, 0xFF, 0xAB, 0xBD, 0xFF, 0xE6, 0x5A, 0xFF, 0xA5, 0x52, 0xFF, 0x64, 0x4A, 0xFF, 0x45, 0x42, 0xFF, 0x0C, 0x9D, 0xFF, 0x45, 0x42, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x24, 0x3A, 0xFF, 0x45, 0x42, 0xFF, 0xE3, 0x39, 0xFF, 0x24, 0x42, 0xFF, 0x65, 0x42, 0xFF, 0x44, 0x42, 0xFF, 0xC6, 0x52, 0xFF, 0xA5, 0x4A, 0xFF, 0xE6, 0x52, 0xFF, 0x06, 0x63, 0xFF, 0x47, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0x08, 0x7C, 0xFF, 0xE8, 0x73, 0xFF,
-    0x85, 0x52, 0xFF, 0xA4, 0x52, 0xFF, 0x84, 0x52, 0xFF, 0x43, 0x4A, 0xFF, 0x85, 0x52, 0xFF, 0x43, 0x42, 0xFF, 0xE6, 0x5A, 0xFF, 0xB5, 0xF7, 0xFF, 0xC7, 0x73, 0xFF, 0x63, 0x4A, 0xFF, 0xC5, 0x5A, 0xFF, 0xA7, 0x7B, 0xFF, 0xE4, 0x83, 0xFF, 0x44, 0x6B, 0xFF, 0x24, 0x63, 0xFF, 0xE7, 0x7B, 0xFF, 0xF3, 0xFF, 0xFF, 0xE5, 0x8B, 0xFF, 0x8B, 0xBD, 0xFF, 0x86, 0x73, 0xFF, 0x45, 0x6B, 0xFF, 0xC9, 0xA4, 0xFF, 0x8E, 0xD6, 0xFF, 0x45, 0x6B, 0xFF, 0x46, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0x8C, 0xB5, 0xFF, 0x07, 0x8C, 0xFF, 0xEA, 0x9C, 0xFF, 0x0A, 0x9D, 0xFF, 0xEA, 0xA4, 0xFF, 0x0E, 0xDF, 0xFF, 0xA6, 0x83, 0xFF, 0xA6, 0x83, 0xFF, 0x08, 0x8C, 0xFF, 0x90, 0xE6, 0xFF, 0x0E, 0xEF, 0xFF, 0x28, 0x9C, 0xFF, 0xC7, 0x83, 0xFF, 0xA7, 0x7B, 0xFF, 0xED, 0xC5, 0xFF, 0x6B, 0xB5, 0xFF, 0xC7, 0x83, 0xFF, 0x47, 0x94, 0xFF, 0x8D, 0xEE, 0xFF, 0xE9, 0xAC, 0xFF, 0xE8, 0x83, 0xFF, 0x06, 0x63, 0xFF, 0x84, 0x52, 0xFF, 0x06, 0x63, 0xFF, 0x8B, 0xB5, 0xFF, 0x05, 0x5B, 0xFF, 0x67, 0x6B, 0xFF, 0x65, 0x6B, 0xFF, 0xAC, 0xB5, 0xFF, 0x49, 0xA5, 0xFF, 0x43, 0x42, 0xFF, 0x03, 0x3A, 0xFF, 0x24, 0x42, 0xFF, 0xA5, 0x52, 0xFF, 0xCA, 0x8C, 0xFF, 0x64, 0x42, 0xFF, 0x45, 0x42, 0xFF, 0xE3, 0x39, 0xFF,
-    0x87, 0x6B, 0xFF, 0x46, 0x4A, 0xFF, 0x24, 0x42, 0xFF, 0x25, 0x42, 0xFF, 0x24, 0x42, 0xFF, 0x6C, 0xA5, 0xFF, 0x24, 0x42, 0xFF, 0x45, 0x42, 0xFF, 0x85, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0x8A, 0xA5, 0xFF, 0xA5, 0x52, 0xFF, 0x06, 0x5B, 0xFF, 0x26, 0x5B, 0xFF, 0x66, 0x63, 0xFF, 0xA7, 0x6B, 0xFF, 0xA7, 0x7B, 0xFF, 0xA7, 0x7B, 0xFF, 0x0C, 0xC6, 0xFF, 0xC6, 0x5A, 0xFF, 0x64, 0x4A, 0xFF, 0x64, 0x4A, 0xFF, 0x84, 0x4A, 0xFF, 0xAA, 0x9C, 0xFF, 0xC5, 0x5A, 0xFF, 0x63, 0x52, 0xFF, 0xC5, 0x5A, 0xFF, 0xA4, 0x52, 0xFF, 0x05, 0x63, 0xFF, 0xE4, 0x5A, 0xFF, 0x66, 0x6B, 0xFF, 0x47, 0x8C, 0xFF, 0xF8, 0xFF, 0xFF, 0x0F, 0xEF, 0xFF, 0xED, 0xFE, 0xFF, 0x86, 0x73, 0xFF, 0xA7, 0x73, 0xFF, 0x04, 0x63, 0xFF, 0xA6, 0x73, 0xFF, 0x66, 0x6B, 0xFF, 0x66, 0x6B, 0xFF, 0x46, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0xC7, 0x7B, 0xFF, 0x68, 0x8C, 0xFF, 0x69, 0x8C, 0xFF, 0xA6, 0x7B, 0xFF, 0xA6, 0x73, 0xFF, 0x66, 0x73, 0xFF, 0x86, 0x7B, 0xFF, 0xA7, 0x7B, 0xFF, 0xE7, 0x8B, 0xFF, 0x85, 0x83, 0xFF, 0xE7, 0x83, 0xFF, 0xA6, 0x7B, 0xFF, 0x07, 0x84, 0xFF, 0x07, 0x84, 0xFF, 0xA6, 0x7B, 0xFF, 0x86, 0x7B, 0xFF, 0xEC, 0xDD, 0xFF, 0xB3, 0xFF, 0xFF, 0x07, 0x94, 0xFF, 0x88, 0x7B, 0xFF, 0x84, 0x52, 0xFF,
-    0xA5, 0x5A, 0xFF, 0xE6, 0x5A, 0xFF, 0x85, 0x52, 0xFF, 0x06, 0x5B, 0xFF, 0x25, 0x63, 0xFF, 0x65, 0x6B, 0xFF, 0x4A, 0xA5, 0xFF, 0xAB, 0x9C, 0xFF, 0x64, 0x42, 0xFF, 0x03, 0x3A, 0xFF, 0x24, 0x42, 0xFF, 0x24, 0x42, 0xFF, 0x03, 0x3A, 0xFF, 0x45, 0x42, 0xFF, 0x65, 0x4A, 0xFF, 0x65, 0x42, 0xFF, 0x24, 0x3A, 0xFF, 0x25, 0x42, 0xFF, 0x24, 0x42, 0xFF, 0x45, 0x42, 0xFF, 0x24, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x45, 0x42, 0xFF, 0x24, 0x42, 0xFF, 0x45, 0x42, 0xFF, 0x44, 0x42, 0xFF, 0x64, 0x42, 0xFF, 0xA5, 0x4A, 0xFF, 0xA5, 0x4A, 0xFF, 0xE5, 0x52, 0xFF, 0x26, 0x5B, 0xFF, 0x46, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xE7, 0x7B, 0xFF, 0xC4, 0x52, 0xFF, 0x64, 0x4A, 0xFF, 0xE4, 0x5A, 0xFF, 0x2A, 0x9D, 0xFF, 0x43, 0x4A, 0xFF, 0x84, 0x52, 0xFF, 0x84, 0x52, 0xFF, 0x68, 0x8C, 0xFF, 0x4B, 0xAD, 0xFF, 0x26, 0x6B, 0xFF, 0x25, 0x63, 0xFF, 0x66, 0x6B, 0xFF, 0x87, 0x94, 0xFF, 0x6C, 0xD6, 0xFF, 0x09, 0xBD, 0xFF, 0x2C, 0xE6, 0xFF, 0xC7, 0x7B, 0xFF, 0xC7, 0x7B, 0xFF, 0x6D, 0xCE, 0xFF, 0xA9, 0x94, 0xFF, 0xC6, 0x7B, 0xFF, 0x86, 0x6B, 0xFF, 0x65, 0x6B, 0xFF, 0x0F, 0xE7, 0xFF, 0x0E, 0xC6, 0xFF, 0x07, 0x84, 0xFF, 0xA6, 0x7B, 0xFF, 0x27, 0x8C, 0xFF, 0xF2, 0xFF, 0xFF,
-    0x45, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0x86, 0x73, 0xFF, 0x87, 0x7B, 0xFF, 0xF2, 0xFF, 0xFF, 0x11, 0xE7, 0xFF, 0xA7, 0x7B, 0xFF, 0x27, 0x84, 0xFF, 0xAB, 0xC5, 0xFF, 0x92, 0xFF, 0xFF, 0x6B, 0xBD, 0xFF, 0x2D, 0xEE, 0xFF, 0x8F, 0xE6, 0xFF, 0xEA, 0xB4, 0xFF, 0x6D, 0xE6, 0xFF, 0x6C, 0xAD, 0xFF, 0x27, 0x6B, 0xFF, 0x47, 0x6B, 0xFF, 0x26, 0x63, 0xFF, 0xEC, 0xBD, 0xFF, 0xEE, 0xB5, 0xFF, 0x28, 0x84, 0xFF, 0xEA, 0x94, 0xFF, 0x47, 0x6B, 0xFF, 0xCE, 0xBD, 0xFF, 0x2A, 0x9D, 0xFF, 0x24, 0x42, 0xFF, 0x04, 0x3A, 0xFF, 0x44, 0x42, 0xFF, 0x09, 0x9D, 0xFF, 0xEE, 0xB5, 0xFF, 0x65, 0x42, 0xFF, 0xED, 0x94, 0xFF, 0x04, 0x3A, 0xFF, 0x2B, 0x9D, 0xFF, 0x65, 0x4A, 0xFF, 0x45, 0x4A, 0xFF, 0x24, 0x42, 0xFF, 0x69, 0x6B, 0xFF, 0x8E, 0xCE, 0xFF, 0x24, 0x42, 0xFF, 0x03, 0x3A, 0xFF, 0xC7, 0x52, 0xFF, 0x44, 0x4A, 0xFF, 0xD4, 0xFF, 0xFF, 0x85, 0x42, 0xFF, 0xA5, 0x4A, 0xFF, 0xE6, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0xE7, 0xFF, 0x66, 0x6B, 0xFF, 0xA5, 0x52, 0xFF, 0x43, 0x42, 0xFF, 0x02, 0x3A, 0xFF, 0x43, 0x4A, 0xFF, 0xC5, 0x5A, 0xFF, 0x84, 0x52, 0xFF, 0x84, 0x52, 0xFF, 0xA4, 0x52, 0xFF, 0x25, 0x63, 0xFF, 0x25, 0x63, 0xFF, 0xC4, 0x5A, 0xFF, 0x46, 0x6B, 0xFF, 0x6A, 0xBD, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xEF, 0xEE, 0xFF, 0xEC, 0xD5, 0xFF, 0x08, 0x84, 0xFF, 0x24, 0x6B, 0xFF, 0xC7, 0x7B, 0xFF, 0xC9, 0x9C, 0xFF, 0x86, 0x73, 0xFF, 0x66, 0x6B, 0xFF, 0x25, 0x63, 0xFF, 0x45, 0x6B, 0xFF, 0x86, 0x73, 0xFF, 0xC7, 0x7B, 0xFF, 0x46, 0x6B, 0xFF, 0xC7, 0x7B, 0xFF, 0x45, 0x6B, 0xFF, 0x45, 0x6B, 0xFF, 0x46, 0x6B, 0xFF, 0xA7, 0x73, 0xFF, 0x46, 0x6B, 0xFF, 0xE9, 0x83, 0xFF, 0x25, 0x63, 0xFF, 0xE7, 0x7B, 0xFF, 0x0A, 0xA5, 0xFF, 0x90, 0xFF, 0xFF, 0xCD, 0xE6, 0xFF, 0x85, 0x83, 0xFF, 0x2D, 0xEE, 0xFF, 0x49, 0xCD, 0xFF, 0x2A, 0xB5, 0xFF, 0xAA, 0xA4, 0xFF, 0x84, 0x52, 0xFF, 0x84, 0x52, 0xFF, 0xE6, 0x5A, 0xFF, 0xA5, 0x52, 0xFF, 0xC4, 0x5A, 0xFF, 0xC8, 0x73, 0xFF, 0x07, 0x74, 0xFF, 0x28, 0x7C, 0xFF, 0xE5, 0x52, 0xFF, 0xA5, 0x52, 0xFF, 0xA6, 0x4A, 0xFF, 0x04, 0x3A, 0xFF, 0x24, 0x42, 0xFF, 0x24, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x85, 0x4A, 0xFF, 0x45, 0x42, 0xFF, 0xE4, 0x31, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x05, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x84, 0x31, 0xFF, 0x65, 0x42, 0xFF, 0x04, 0x3A, 0xFF, 0x04, 0x3A, 0xFF, 0x45, 0x42, 0xFF, 0x44, 0x42, 0xFF, 0xA6, 0x4A, 0xFF, 0x85, 0x4A, 0xFF, 0xC5, 0x52, 0xFF,
+    0xE2, 0x31, 0x23, 0x42, 0x24, 0x42, 0x23, 0x3A, 0xE3, 0x39, 0x03, 0x42, 0xE3, 0x39, 0x23, 0x42, 0x44, 0x42, 0xA4, 0x4A, 0xA5, 0x52, 0x43, 0x42, 0x63, 0x4A, 0xE4, 0x5A, 0x0D, 0xBE, 0xB2, 0xE7, 0x65, 0x6B, 0xE7, 0x73, 0x86, 0x6B, 0xC4, 0x52, 0x2D, 0xC6, 0xE8, 0x7B, 0x86, 0x73, 0x28, 0x8C, 0xE8, 0xA4, 0xFF, 0xFF, 0xEB, 0xC5, 0xCD, 0xBD, 0x28, 0x84, 0x6E, 0xCE, 0xA7, 0x9C, 0x6B, 0xB5,
+    0x27, 0x8C, 0x07, 0x84, 0x48, 0x94, 0xA9, 0x9C, 0x6F, 0xF7, 0xAB, 0xB5, 0xE7, 0x7B, 0xE7, 0x73, 0x08, 0x7C, 0x8D, 0xD6, 0x07, 0x7C, 0x27, 0x7C, 0x48, 0x84, 0x07, 0x7C, 0x8D, 0xCE, 0x2A, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xBD, 0x09, 0x9D, 0xCE, 0xDE, 0xFA, 0xF7, 0xC6, 0x73, 0xE7, 0x7B, 0xE7, 0x73, 0x8D, 0xD6, 0xC7, 0x73, 0x05, 0x5B, 0x05, 0x5B, 0x06, 0x5B, 0xA4, 0x4A, 0x8B, 0xA5,
+    0xA5, 0x4A, 0x84, 0x4A, 0xC5, 0x52, 0xE7, 0x7B, 0x88, 0x8C, 0xE5, 0x52, 0xE4, 0x4A, 0xA4, 0x4A, 0xE5, 0x4A, 0xAF, 0xCE, 0x25, 0x5B, 0xC5, 0x52, 0xE5, 0x52, 0xE4, 0x52, 0xE4, 0x52, 0x67, 0x84, 0x03, 0x3A, 0x03, 0x3A, 0xA4, 0x4A, 0x24, 0x42, 0x44, 0x42, 0xE8, 0x7B, 0x43, 0x42, 0x44, 0x42, 0xC6, 0x52, 0x84, 0x4A, 0x2C, 0xA5, 0xA5, 0x52, 0xE5, 0x5A, 0xE5, 0x52, 0x05, 0x5B, 0x08, 0x7C,
+    0xC6, 0x6B, 0x46, 0x63, 0x05, 0x5B, 0x66, 0x6B, 0x46, 0x63, 0x25, 0x5B, 0x46, 0x6B, 0x46, 0x6B, 0xE6, 0x7B, 0xA8, 0x94, 0xA9, 0x9C, 0xA6, 0x73, 0x86, 0x73, 0xC6, 0x73, 0xC7, 0x73, 0x07, 0x84, 0x48, 0x8C, 0x07, 0x7C, 0x68, 0x84, 0xCA, 0x9C, 0xF4, 0xFF, 0x6A, 0xB5, 0x48, 0x84, 0x28, 0x7C, 0x27, 0x84, 0x91, 0xEF, 0x07, 0x7C, 0x07, 0x7C, 0x28, 0x7C, 0x88, 0x8C, 0x68, 0x84, 0x8B, 0xAD,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x4A, 0xAD, 0xA9, 0x8C, 0x48, 0x84, 0xE9, 0x9C, 0x07, 0x7C, 0xE7, 0x73, 0xC6, 0x73, 0xC6, 0x73, 0x65, 0x63, 0x25, 0x5B, 0x05, 0x5B, 0xE4, 0x5A, 0xA4, 0x4A, 0x84, 0x4A, 0xC5, 0x52, 0xA5, 0x4A, 0x06, 0x5B, 0xA4, 0x4A, 0xA4, 0x4A, 0x83, 0x42, 0xC4, 0x4A, 0xE5, 0x52, 0xE4, 0x52, 0xA3, 0x42, 0x05, 0x5B, 0xC4, 0x52, 0xC4, 0x4A, 0xC5, 0x4A, 0x08, 0x74, 0x84, 0x4A,
+    0xE7, 0x73, 0x44, 0x42, 0x85, 0x52, 0x64, 0x4A, 0x05, 0x5B, 0xC7, 0x73, 0x63, 0x4A, 0x85, 0x52, 0x64, 0x4A, 0x64, 0x4A, 0x6A, 0x8C, 0xC9, 0x7B, 0xE5, 0x5A, 0xA9, 0x74, 0x08, 0x7C, 0xA9, 0x94, 0x29, 0xA5, 0xC7, 0x6B, 0x46, 0x63, 0x25, 0x63, 0x45, 0x63, 0xD5, 0xFF, 0x46, 0x6B, 0xA7, 0x73, 0x65, 0x6B, 0xFE, 0xFF, 0xF3, 0xFF, 0xE7, 0x7B, 0xE7, 0x7B, 0xA6, 0x7B, 0xC6, 0x73, 0x2F, 0xEF,
+    0x28, 0x84, 0x67, 0x84, 0x27, 0x7C, 0x88, 0x8C, 0xED, 0xE6, 0x6B, 0xBD, 0x68, 0x8C, 0x68, 0x84, 0x69, 0x84, 0xAE, 0xD6, 0x48, 0x84, 0x88, 0x8C, 0xA9, 0x8C, 0x68, 0x84, 0x8D, 0xCE, 0x0C, 0xBE, 0xDF, 0xFF, 0xCC, 0xCE, 0x8A, 0xAD, 0x4E, 0xEF, 0x88, 0x8C, 0xA9, 0x94, 0x48, 0x84, 0x07, 0x7C, 0x09, 0x9D, 0x12, 0xDF, 0xA6, 0x73, 0x25, 0x5B, 0x05, 0x5B, 0xE4, 0x52, 0x05, 0x5B, 0x84, 0x4A,
+    0x06, 0x5B, 0xA5, 0x4A, 0xA5, 0x4A, 0x28, 0x7C, 0x05, 0x53, 0xA4, 0x4A, 0xE5, 0x4A, 0xE4, 0x4A, 0x28, 0x74, 0x05, 0x5B, 0xE4, 0x52, 0xE5, 0x52, 0xC4, 0x4A, 0x86, 0x63, 0xA4, 0x4A, 0xE4, 0x4A, 0x03, 0x3A, 0xA3, 0x62, 0x64, 0x4A, 0x44, 0x42, 0xC5, 0x52, 0x85, 0x4A, 0x84, 0x4A, 0x84, 0x4A, 0x64, 0x4A, 0x85, 0x52, 0x06, 0x63, 0xE5, 0x5A, 0xE5, 0x5A, 0x65, 0x6B, 0x88, 0x84, 0x07, 0x74,
+    0xCA, 0x8C, 0x87, 0x6B, 0x45, 0x63, 0xA8, 0x73, 0x46, 0x6B, 0x46, 0x6B, 0x66, 0x6B, 0x86, 0x73, 0xC7, 0x7B, 0x0A, 0x9D, 0x48, 0x84, 0x89, 0x8C, 0x69, 0x8C, 0xE7, 0x7B, 0x07, 0x84, 0x71, 0xEF, 0x07, 0x84, 0x27, 0x7C, 0x88, 0x8C, 0x0A, 0xA5, 0xF8, 0xFF, 0x8A, 0xBD, 0x68, 0x8C, 0x69, 0x84, 0x88, 0x8C, 0xEC, 0xBD, 0x27, 0x84, 0xFC, 0xFF, 0x88, 0x8C, 0x68, 0x84, 0x6E, 0xC6, 0x69, 0xA5,
+    0x4C, 0xCE, 0x2C, 0xBE, 0x8A, 0xAD, 0xF3, 0xFF, 0xC9, 0xA4, 0x2A, 0xAD, 0x68, 0x8C, 0x28, 0x84, 0xAD, 0xD6, 0xA6, 0x6B, 0xA7, 0x73, 0x45, 0x63, 0xE4, 0x52, 0xA6, 0x73, 0xA5, 0x52, 0xA4, 0x52, 0xC5, 0x52, 0x26, 0x5B, 0xA3, 0x52, 0xE5, 0x52, 0xC4, 0x4A, 0xC4, 0x52, 0xA4, 0x4A, 0x48, 0x7C, 0x05, 0x53, 0xE4, 0x52, 0xC4, 0x52, 0xA4, 0x4A, 0xA9, 0x8C, 0xA3, 0x4A, 0xC4, 0x52, 0xE5, 0x52,
+    0xE3, 0x39, 0xE2, 0x39, 0x46, 0x6B, 0xC5, 0x52, 0x84, 0x4A, 0xA5, 0x52, 0xE9, 0x73, 0x67, 0x8C, 0xC5, 0x52, 0xC6, 0x5A, 0x85, 0x52, 0xAB, 0x8C, 0xE9, 0x94, 0xE8, 0x7B, 0x86, 0x6B, 0x2C, 0xAD, 0xE6, 0x7B, 0x0B, 0xA5, 0x25, 0x5B, 0x26, 0x5B, 0xFE, 0xFF, 0x4B, 0xAD, 0x25, 0x6B, 0x87, 0x73, 0x86, 0x73, 0x27, 0x84, 0x2E, 0xBE, 0xA7, 0x73, 0xE7, 0x7B, 0x07, 0x84, 0x48, 0x8C, 0x50, 0xEF,
+    0x8C, 0xB5, 0xA8, 0x8C, 0xE9, 0x9C, 0xA8, 0x94, 0x8E, 0xD6, 0xC9, 0x9C, 0x68, 0x8C, 0x27, 0x84, 0xA9, 0x94, 0xEE, 0xE6, 0x88, 0x8C, 0xFF, 0xFF, 0xE9, 0x94, 0xC9, 0x94, 0xCE, 0xDE, 0x6B, 0xAD, 0x2D, 0xC6, 0xEB, 0xB5, 0xAB, 0xB5, 0xF2, 0xFF, 0x0D, 0xCE, 0x2A, 0xAD, 0x89, 0x8C, 0x06, 0x7C, 0xC6, 0x73, 0x27, 0x84, 0x86, 0x6B, 0x65, 0x63, 0x85, 0x6B, 0xE5, 0x5A, 0xC4, 0x52, 0xE5, 0x52,
+    0xC4, 0x52, 0xEA, 0x94, 0xA4, 0x4A, 0xC4, 0x52, 0xC4, 0x52, 0xE5, 0x52, 0xCA, 0x8C, 0xE5, 0x52, 0xE5, 0x52, 0x05, 0x53, 0xA4, 0x4A, 0xA4, 0x4A, 0xC4, 0x4A, 0x84, 0x4A, 0xE5, 0x52, 0x05, 0x53, 0xE3, 0x39, 0x23, 0x42, 0xE2, 0x31, 0xE7, 0x73, 0x05, 0x5B, 0xC5, 0x52, 0x06, 0x5B, 0xA5, 0x4A, 0xC5, 0x52, 0x89, 0x8C, 0xA5, 0x52, 0xC5, 0x52, 0x05, 0x5B, 0x87, 0x6B, 0x29, 0xA5, 0x13, 0xDF,
+    0x28, 0x7C, 0x66, 0x63, 0x66, 0x63, 0x46, 0x6B, 0x4E, 0xC6, 0x46, 0x63, 0x86, 0x73, 0x86, 0x6B, 0x86, 0x73, 0x6F, 0xF7, 0x68, 0x84, 0xC6, 0x73, 0x07, 0x7C, 0x48, 0x8C, 0xFB, 0xFF, 0x4B, 0xBD, 0xC9, 0x9C, 0xC9, 0x9C, 0x2A, 0xA5, 0xA8, 0x94, 0xF2, 0xFF, 0x49, 0xAD, 0x89, 0x94, 0xA9, 0x94, 0x09, 0x9D, 0x91, 0xF7, 0xA9, 0x94, 0xFF, 0xFF, 0xC8, 0x8C, 0xC9, 0x94, 0x09, 0x9D, 0xAB, 0xB5,
+    0xEC, 0xBD, 0x6D, 0xCE, 0x4F, 0xEF, 0x90, 0xF7, 0xFF, 0xFF, 0x2A, 0xAD, 0x0A, 0x9D, 0x87, 0x94, 0x28, 0x7C, 0x8A, 0xAD, 0xA6, 0x73, 0x46, 0x63, 0xCA, 0xAD, 0x08, 0x7C, 0x46, 0x63, 0x45, 0x63, 0xE5, 0x52, 0x08, 0x74, 0x06, 0x5B, 0xC4, 0x4A, 0x48, 0x84, 0xC4, 0x4A, 0x67, 0x63, 0xC4, 0x52, 0x06, 0x5B, 0x43, 0x42, 0x07, 0x7C, 0x05, 0x53, 0xE5, 0x52, 0xE5, 0x52, 0x05, 0x53, 0x86, 0x6B,
+    0x03, 0x42, 0x44, 0x42, 0x43, 0x42, 0xC5, 0x52, 0xE8, 0x73, 0xE5, 0x52, 0xE5, 0x5A, 0x84, 0x52, 0x05, 0x5B, 0xA8, 0x94, 0x43, 0x4A, 0x06, 0x63, 0x05, 0x5B, 0xC6, 0x73, 0xCB, 0x9C, 0xE9, 0x9C, 0x0C, 0xBE, 0xEB, 0x9C, 0xCA, 0x9C, 0x8C, 0xAD, 0x29, 0xA5, 0xA7, 0x73, 0x0A, 0xA5, 0xC7, 0x7B, 0xC7, 0x7B, 0xA6, 0x73, 0x28, 0x84, 0x6E, 0xCE, 0x48, 0x8C, 0x89, 0x94, 0xCB, 0xC5, 0xF1, 0xFF,
+    0xCC, 0xCD, 0x8B, 0xB5, 0x0C, 0xBE, 0x4A, 0xAD, 0xF4, 0xFF, 0x8B, 0xB5, 0xA9, 0x94, 0xEA, 0x9C, 0x2A, 0xA5, 0xF2, 0xFF, 0x6B, 0xAD, 0x0A, 0x9D, 0xEA, 0x94, 0xAB, 0xB5, 0xF3, 0xFF, 0x4D, 0xCE, 0x0C, 0xC6, 0x4F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x0C, 0xC6, 0x4B, 0xAD, 0x68, 0x84, 0xEB, 0xB5, 0x8E, 0xEF, 0x28, 0x84, 0xAB, 0xAD, 0x25, 0x63, 0xC7, 0x73, 0xEC, 0xB5, 0xC4, 0x52,
+    0x6B, 0xA5, 0xC5, 0x52, 0xA3, 0x4A, 0xE4, 0x52, 0xC9, 0x94, 0xE5, 0x52, 0xE5, 0x52, 0x26, 0x5B, 0x49, 0x7C, 0x8A, 0xA5, 0xC4, 0x52, 0xC4, 0x52, 0xC4, 0x52, 0xE5, 0x52, 0xE9, 0x94, 0x66, 0x63, 0x86, 0x6B, 0x85, 0x4A, 0x43, 0x42, 0x85, 0x4A, 0xC5, 0x52, 0x07, 0x7C, 0x05, 0x5B, 0xE5, 0x52, 0xA4, 0x4A, 0xE5, 0x52, 0xCA, 0x94, 0x46, 0x63, 0xC4, 0x5A, 0x86, 0x6B, 0xA6, 0x73, 0xE9, 0x94,
+    0xEF, 0xCE, 0xCA, 0x8C, 0xC7, 0x6B, 0xC7, 0x73, 0x66, 0x6B, 0xCC, 0xBD, 0x66, 0x6B, 0xC8, 0x7B, 0xA6, 0x73, 0x08, 0x7C, 0x6F, 0xEF, 0x28, 0x84, 0xA9, 0x94, 0xC9, 0xA4, 0x91, 0xFF, 0xFF, 0xFF, 0x2D, 0xE6, 0xEC, 0xBD, 0xFF, 0xFF, 0x2A, 0xA5, 0xF3, 0xFF, 0x8E, 0xD6, 0x0A, 0x9D, 0x0A, 0xA5, 0x8B, 0xB5, 0xF1, 0xFF, 0xC9, 0x9C, 0x09, 0x95, 0x0A, 0x9D, 0x2A, 0xAD, 0xF2, 0xFF, 0xCC, 0xBD,
+    0xEC, 0xC5, 0xF2, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x0F, 0xF7, 0x0B, 0xBE, 0xCA, 0x94, 0x88, 0x8C, 0xC7, 0x84, 0x65, 0x6B, 0x44, 0x63, 0xA7, 0x73, 0xA7, 0x73, 0x25, 0x5B, 0xC5, 0x52, 0xA4, 0x4A, 0xC5, 0x52, 0x65, 0x53, 0xE4, 0x52, 0x08, 0x7C, 0xA4, 0x4A, 0x46, 0x5B, 0x26, 0x5B, 0x86, 0x63, 0xC4, 0x52, 0xA4, 0x4A, 0x05, 0x5B, 0x25, 0x5B, 0x05, 0x53, 0x86, 0x63, 0x86, 0x63,
+    0x23, 0x42, 0x84, 0x4A, 0xC5, 0x52, 0x85, 0x4A, 0x84, 0x4A, 0x84, 0x52, 0xC3, 0x52, 0xA2, 0x4A, 0xE5, 0x52, 0xE5, 0x5A, 0x08, 0x7C, 0xE8, 0x73, 0x05, 0x5B, 0x45, 0x63, 0xE7, 0x73, 0x0A, 0x9D, 0xAA, 0xA5, 0xA8, 0x94, 0x89, 0x8C, 0xEC, 0xBD, 0x66, 0x6B, 0x67, 0x8C, 0x86, 0x6B, 0x2B, 0xA5, 0x6B, 0xAD, 0x07, 0x84, 0xE9, 0x9C, 0x89, 0x94, 0x8A, 0xAD, 0x09, 0xB5, 0xF3, 0xFF, 0xFD, 0xFF,
+    0xF2, 0xFF, 0xEC, 0xCD, 0xFF, 0xFF, 0xAB, 0xBD, 0xFC, 0xFF, 0xAE, 0xDE, 0x2A, 0xA5, 0x4A, 0xAD, 0xAB, 0xBD, 0xD1, 0xFF, 0x4B, 0xAD, 0x29, 0x9D, 0xAB, 0xB5, 0x8D, 0xD6, 0xD1, 0xFF, 0x8D, 0xDE, 0xEE, 0xEE, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x4C, 0xD6, 0xAF, 0xDE, 0xAC, 0xB5, 0x70, 0xEF, 0xCC, 0xB5, 0x4C, 0xBE, 0x86, 0x6B, 0xA7, 0x73, 0xEC, 0xBD, 0x85, 0x6B, 0x04, 0x5B,
+    0xE5, 0x5A, 0xAB, 0x8C, 0x72, 0xE7, 0x68, 0x84, 0x05, 0x53, 0xC4, 0x52, 0x46, 0x63, 0xF5, 0xF7, 0x45, 0x5B, 0xE5, 0x52, 0x06, 0x5B, 0x66, 0x63, 0xCC, 0xB5, 0x46, 0x5B, 0xA6, 0x63, 0x65, 0x63, 0x04, 0x42, 0x43, 0x4A, 0x47, 0x63, 0x06, 0x63, 0x84, 0x4A, 0xA4, 0x4A, 0x84, 0x52, 0x69, 0x8C, 0xE6, 0x5A, 0x83, 0x4A, 0xC5, 0x5A, 0x86, 0x6B, 0x68, 0x8C, 0x46, 0x63, 0x26, 0x5B, 0xA6, 0x6B,
+    0xE6, 0x73, 0xE7, 0x83, 0x65, 0x6B, 0x66, 0x6B, 0xC6, 0x73, 0xA6, 0x6B, 0x8B, 0xAD, 0x86, 0x73, 0x2E, 0xC6, 0xC7, 0x7B, 0x30, 0xE7, 0xA9, 0x94, 0x2D, 0xBE, 0x4B, 0xB5, 0xD2, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xCC, 0xC5, 0xFF, 0xFF, 0x8B, 0xB5, 0xF6, 0xF7, 0x4F, 0xF7, 0x2A, 0xAD, 0x2A, 0xAD, 0x49, 0xA5, 0xD1, 0xFF, 0x6A, 0xAD, 0x2A, 0xA5, 0x2A, 0xA5, 0xCE, 0xDE, 0xF2, 0xFF, 0x2D, 0xCE,
+    0x91, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x4F, 0xF7, 0x2B, 0xBE, 0x6A, 0xA5, 0xE9, 0x9C, 0x89, 0x8C, 0x07, 0x7C, 0x06, 0x84, 0xA7, 0x6B, 0x0D, 0xBE, 0xA7, 0x73, 0x25, 0x63, 0x05, 0x5B, 0x05, 0x5B, 0x8B, 0xAD, 0xE5, 0x52, 0xE4, 0x52, 0x05, 0x5B, 0xC4, 0x52, 0xA9, 0x8C, 0xA4, 0x4A, 0xE5, 0x52, 0x05, 0x53, 0xC4, 0x4A, 0x05, 0x5B, 0x86, 0x63, 0x25, 0x5B, 0x86, 0x63, 0x24, 0x5B,
+    0x08, 0x84, 0x44, 0x4A, 0xA4, 0x52, 0xAB, 0xAD, 0x29, 0x84, 0x46, 0x63, 0xC4, 0x52, 0xC8, 0x73, 0x84, 0x52, 0xA3, 0x52, 0x26, 0x63, 0xA7, 0x6B, 0x86, 0x6B, 0x86, 0x6B, 0x65, 0x73, 0x86, 0x6B, 0xA7, 0x73, 0xA7, 0x73, 0xA6, 0x73, 0x86, 0x6B, 0xE7, 0x7B, 0x69, 0x8C, 0xC7, 0x73, 0x48, 0x8C, 0x90, 0xCE, 0x47, 0x8C, 0x27, 0x84, 0x89, 0x94, 0x0C, 0xBE, 0xCB, 0xC5, 0xF8, 0xFF, 0xF8, 0xFF,
+    0x2F, 0xF7, 0xAB, 0xC5, 0x8B, 0xB5, 0xAB, 0xC5, 0xFF, 0xFF, 0xF7, 0xFF, 0x8B, 0xB5, 0x2A, 0xAD, 0x8B, 0xAD, 0x30, 0xE7, 0xB0, 0xFF, 0x09, 0x9D, 0x30, 0xEF, 0x51, 0xF7, 0x4A, 0xA5, 0x0C, 0xC6, 0xB2, 0xF7, 0xF7, 0xFF, 0xF3, 0xFF, 0xF2, 0xFF, 0x6D, 0xD6, 0x4C, 0xC6, 0xAC, 0xB5, 0x6C, 0xCE, 0x4A, 0xA5, 0xAB, 0xAD, 0xA5, 0x73, 0xE8, 0x7B, 0xCD, 0xB5, 0x89, 0x8C, 0x04, 0x5B, 0x05, 0x5B,
+    0x67, 0x63, 0x28, 0x7C, 0x29, 0x7C, 0x05, 0x5B, 0x25, 0x5B, 0xC7, 0x6B, 0x25, 0x5B, 0x25, 0x5B, 0x87, 0x63, 0x05, 0x53, 0xC6, 0x6B, 0x86, 0x6B, 0x85, 0x63, 0x45, 0x5B, 0xA6, 0x6B, 0xC6, 0x6B, 0x24, 0x42, 0x44, 0x4A, 0x84, 0x52, 0x83, 0x4A, 0xE5, 0x5A, 0xEE, 0xB5, 0xC5, 0x52, 0x25, 0x63, 0xE4, 0x5A, 0xAE, 0xCE, 0x66, 0x73, 0xE7, 0x73, 0xAA, 0x94, 0x86, 0x7B, 0x2D, 0xC6, 0x86, 0x73,
+    0x45, 0x6B, 0x68, 0x94, 0xEC, 0xC5, 0x24, 0x73, 0x30, 0xE7, 0x89, 0x8C, 0x0C, 0xC6, 0x89, 0x8C, 0x53, 0xEF, 0xEE, 0xE6, 0x47, 0x8C, 0x0E, 0xDF, 0x8B, 0xAD, 0x0A, 0x9D, 0x72, 0xF7, 0xF7, 0xFF, 0x0D, 0xD6, 0xEC, 0xC5, 0xF0, 0xE6, 0x2F, 0xEF, 0xF9, 0xFF, 0xF4, 0xFF, 0x8B, 0xBD, 0x6A, 0xAD, 0x4A, 0xA5, 0xF3, 0xFF, 0x30, 0xEF, 0x0A, 0x9D, 0x6B, 0xB5, 0x0F, 0xE7, 0xF4, 0xFF, 0xAE, 0xDE,
+    0x4D, 0xCE, 0xCD, 0xDE, 0xF4, 0xFF, 0x8D, 0xD6, 0xF5, 0xFF, 0x2A, 0xA5, 0x70, 0xEF, 0xFF, 0xFF, 0x89, 0x8C, 0x4F, 0xE7, 0x89, 0x8C, 0xCB, 0xAD, 0xA6, 0x73, 0x86, 0x6B, 0x0E, 0xD7, 0x66, 0x6B, 0xC9, 0x8C, 0x05, 0x5B, 0x73, 0xEF, 0x05, 0x5B, 0xCB, 0xAD, 0xE5, 0x52, 0x05, 0x5B, 0xF3, 0xBF, 0x24, 0x5B, 0xAA, 0xAD, 0x45, 0x5B, 0x45, 0x5B, 0x86, 0x63, 0x86, 0x63, 0x8B, 0xAD, 0xC5, 0x6B,
+    0x28, 0x7C, 0x46, 0x63, 0x69, 0x84, 0x25, 0x5B, 0x83, 0x52, 0x0A, 0xA5, 0x88, 0x84, 0x66, 0x6B, 0x25, 0x63, 0x24, 0x63, 0xEC, 0xC5, 0x85, 0x7B, 0x4C, 0xB5, 0x28, 0x94, 0xFE, 0xFF, 0x88, 0xA4, 0x6B, 0xB5, 0x48, 0x8C, 0x27, 0x84, 0x8E, 0xDE, 0xC7, 0x7B, 0x46, 0x84, 0xC6, 0x73, 0x6D, 0xC6, 0x2B, 0xA5, 0xA9, 0x94, 0x88, 0x94, 0x07, 0x84, 0x2A, 0xA5, 0x0C, 0xBE, 0x28, 0xAD, 0x33, 0xEF,
+    0xF2, 0xFF, 0x0C, 0xCE, 0x6A, 0xAD, 0x8A, 0xBD, 0xF4, 0xFF, 0x91, 0xFF, 0x4A, 0xB5, 0x2A, 0xAD, 0x6B, 0xAD, 0xF3, 0xFF, 0x8B, 0xBD, 0x2A, 0xA5, 0x2D, 0xC6, 0x2E, 0xE7, 0x6D, 0xCE, 0x8A, 0xAD, 0xD1, 0xF7, 0xEC, 0xC5, 0x4A, 0xB5, 0xCB, 0xC5, 0xAD, 0xD6, 0xCB, 0xBD, 0x4C, 0xBE, 0xA8, 0x94, 0x0A, 0x9D, 0xE6, 0x7B, 0x47, 0x84, 0xB1, 0xCE, 0xA7, 0x73, 0xA7, 0x73, 0x88, 0x8C, 0x05, 0x5B,
+    0x05, 0x5B, 0xE5, 0x52, 0x87, 0x6B, 0x04, 0x5B, 0x86, 0x63, 0x45, 0x63, 0xF8, 0xFF, 0x45, 0x5B, 0x28, 0x7C, 0x86, 0x63, 0x86, 0x63, 0x65, 0x5B, 0xA6, 0x63, 0x85, 0x63, 0x85, 0x63, 0x47, 0x7C, 0x83, 0x4A, 0xC5, 0x52, 0xE3, 0x5A, 0x32, 0xDF, 0x86, 0x6B, 0x68, 0x9C, 0xE7, 0x7B, 0x0D, 0xCE, 0x48, 0x94, 0xA7, 0x7B, 0x25, 0x6B, 0xCC, 0xBD, 0xCC, 0xC5, 0x6F, 0xD6, 0x2D, 0xCE, 0xFF, 0xFF,
+    0xD3, 0xFF, 0x4B, 0xBD, 0x6F, 0xCE, 0x07, 0x84, 0xE7, 0x83, 0x0C, 0xC6, 0x2A, 0x9D, 0x6C, 0xA5, 0x6C, 0xAD, 0xA8, 0x94, 0xF1, 0xF7, 0x68, 0x8C, 0x8A, 0xB5, 0xA8, 0x9C, 0xEB, 0xC5, 0xF5, 0xFF, 0xAB, 0xBD, 0xEC, 0xC5, 0x6A, 0xB5, 0xCF, 0xE6, 0xF4, 0xFF, 0xB1, 0xFF, 0xCB, 0xC5, 0x6B, 0xB5, 0xCF, 0xDE, 0xF3, 0xFF, 0xEC, 0xC5, 0x2A, 0xA5, 0x8E, 0xCE, 0x8E, 0xD6, 0xF3, 0xFF, 0xCB, 0xBD,
+    0x10, 0xE7, 0x0C, 0xD6, 0x4D, 0xD6, 0xF5, 0xFF, 0xCF, 0xDE, 0x2C, 0xC6, 0xFD, 0xFF, 0x88, 0x8C, 0x6F, 0xE7, 0xED, 0xBD, 0x6E, 0xC6, 0x69, 0x8C, 0xC6, 0x73, 0x30, 0xE7, 0xA6, 0x6B, 0x05, 0x5B, 0x05, 0x5B, 0x25, 0x5B, 0x87, 0x84, 0xC7, 0x73, 0x45, 0x63, 0xFE, 0xFF, 0x65, 0x63, 0x4D, 0xBE, 0xE4, 0x52, 0x04, 0x5B, 0x45, 0x63, 0xC6, 0x6B, 0xCB, 0xB5, 0x24, 0x5B, 0xC6, 0x6B, 0xE6, 0x73,
+    0x46, 0x63, 0x05, 0x53, 0xE4, 0x5A, 0xE8, 0x7B, 0xF7, 0xFF, 0x71, 0xF7, 0x68, 0x8C, 0x8E, 0xDE, 0x8B, 0xCD, 0xE6, 0x8B, 0xE7, 0x8B, 0x07, 0x8C, 0x29, 0xAD, 0x0E, 0xCE, 0xF3, 0xFF, 0xF6, 0xFF, 0xFA, 0xFF, 0xF3, 0xFF, 0xEB, 0xAC, 0x0C, 0xB6, 0x8F, 0xE7, 0x2F, 0xC6, 0x8D, 0xCE, 0x4B, 0xA5, 0x4D, 0xBE, 0x07, 0x84, 0xAE, 0xD6, 0x88, 0x94, 0xAB, 0xB5, 0x88, 0x94, 0x4A, 0xB5, 0xF4, 0xFF,
+    0xAE, 0xDE, 0xEC, 0xC5, 0x8A, 0xC5, 0x6D, 0xE6, 0xFF, 0xFF, 0xB1, 0xFF, 0x4D, 0xD6, 0x6B, 0xB5, 0x6A, 0xAD, 0xF3, 0xFF, 0x0F, 0xE7, 0x2A, 0xA5, 0xEC, 0xC5, 0x6E, 0xD6, 0xF3, 0xFF, 0xEC, 0xCD, 0x2C, 0xD6, 0xB2, 0xF7, 0x4A, 0xAD, 0xAB, 0xB5, 0x6A, 0xAD, 0xB3, 0xF7, 0xC9, 0x94, 0xAE, 0xD6, 0x4B, 0xA5, 0x0F, 0xD7, 0x8C, 0xAD, 0xA7, 0x73, 0x4C, 0xC6, 0xAA, 0x94, 0x48, 0x84, 0x46, 0x63,
+    0x04, 0x5B, 0x0C, 0xBE, 0x87, 0x6B, 0x46, 0x63, 0x86, 0x63, 0xA8, 0x8C, 0xCA, 0x8C, 0x86, 0x63, 0xA7, 0x6B, 0x86, 0x63, 0xE7, 0x73, 0x65, 0x63, 0x85, 0x63, 0x65, 0x63, 0x07, 0x74, 0x48, 0x7C, 0x27, 0x63, 0x63, 0x4A, 0x8B, 0xAD, 0x66, 0x6B, 0x2A, 0xA5, 0x10, 0xE7, 0xFF, 0xFF, 0x8E, 0xF6, 0xEF, 0xFE, 0xF2, 0xFF, 0x6C, 0xCD, 0x68, 0x94, 0x07, 0x84, 0x8E, 0xCE, 0xD1, 0xF7, 0x55, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xC7, 0x83, 0xCF, 0xD6, 0x68, 0x94, 0x6A, 0xAD, 0x4B, 0xA5, 0x0D, 0xBE, 0x8B, 0xAD, 0xE8, 0x7B, 0x8D, 0xCE, 0xAC, 0xB5, 0xC8, 0x9C, 0x0B, 0xC6, 0x49, 0xAD, 0xEC, 0xC5, 0x2D, 0xD6, 0x6D, 0xE6, 0xF6, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x0C, 0xD6, 0x6B, 0xB5, 0x8A, 0xB5, 0x6D, 0xCE, 0xEC, 0xC5, 0x0A, 0xA5, 0x0C, 0xCE, 0xB1, 0xFF, 0xF5, 0xFF, 0xF6, 0xFF,
+    0xF3, 0xFF, 0xAE, 0xE6, 0x29, 0xA5, 0xC9, 0x9C, 0xF4, 0xFF, 0x2A, 0xA5, 0xE9, 0x9C, 0x47, 0x84, 0x0A, 0x9D, 0x2B, 0xA5, 0x2B, 0x9D, 0x07, 0x7C, 0xEA, 0x94, 0xE7, 0x7B, 0x86, 0x6B, 0x86, 0x6B, 0x68, 0x84, 0x05, 0x5B, 0x66, 0x63, 0x86, 0x6B, 0xE6, 0x73, 0x47, 0x7C, 0x66, 0x63, 0x66, 0x63, 0xA6, 0x6B, 0xE7, 0x73, 0xC6, 0x6B, 0xA6, 0x6B, 0xE7, 0x73, 0xC6, 0x6B, 0x27, 0x74, 0xC6, 0x73,
+    0x43, 0x42, 0xA4, 0x52, 0xE8, 0x73, 0x2D, 0xBE, 0x6E, 0xC6, 0xEA, 0x9C, 0x27, 0x8C, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0x4B, 0xB5, 0x68, 0x94, 0xC6, 0x73, 0x71, 0xE7, 0x68, 0x94, 0x2C, 0xD6, 0x6F, 0xEF, 0xF3, 0xFF, 0x88, 0x8C, 0x6E, 0xCE, 0x8B, 0xAD, 0x48, 0x8C, 0x2A, 0x9D, 0xED, 0xB5, 0x30, 0xE7, 0x88, 0x8C, 0x6B, 0xAD, 0xAB, 0xB5, 0xAB, 0xBD, 0xAA, 0xB5, 0x69, 0xBD,
+    0x2C, 0xCE, 0xAE, 0xE6, 0xEF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xEF, 0xF6, 0x8A, 0xB5, 0x4D, 0xCE, 0xF4, 0xFF, 0xCF, 0xEE, 0x4A, 0xAD, 0x4F, 0xEF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xE6, 0xF5, 0xFF, 0xC9, 0x9C, 0x2F, 0xE7, 0xEC, 0xBD, 0x50, 0xEF, 0x28, 0x84, 0x8B, 0xAD, 0x8E, 0xCE, 0xEA, 0x9C, 0xEC, 0xB5, 0xE7, 0x73, 0x28, 0x84, 0xA6, 0x73, 0x6B, 0xA5,
+    0x05, 0x5B, 0x05, 0x5B, 0x66, 0x63, 0x89, 0x84, 0x07, 0x7C, 0x66, 0x63, 0xA6, 0x6B, 0x24, 0x5B, 0x27, 0x7C, 0xEA, 0x94, 0x86, 0x63, 0xC6, 0x6B, 0xE7, 0x73, 0x07, 0x74, 0xA7, 0x84, 0xC5, 0x6B, 0x68, 0x8C, 0x84, 0x4A, 0x4A, 0x84, 0x05, 0x5B, 0xE9, 0x7B, 0xCC, 0xB5, 0x89, 0x9C, 0x2A, 0xB5, 0xF5, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xA9, 0x9C, 0xE6, 0x83, 0x69, 0x94, 0x2F, 0xDF,
+    0xEC, 0xBD, 0x48, 0x8C, 0xE9, 0x9C, 0x8E, 0xD6, 0x67, 0x94, 0x0A, 0x9D, 0x4A, 0x9D, 0x4B, 0x9D, 0xED, 0xBD, 0xA7, 0x94, 0x8B, 0xAD, 0x06, 0x84, 0xA7, 0x94, 0xA8, 0x94, 0x49, 0xAD, 0x09, 0xA5, 0xF6, 0xFF, 0x4C, 0xD6, 0x8E, 0xE6, 0xF6, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x2C, 0xDE, 0x8B, 0xB5, 0x2D, 0xCE, 0xF6, 0xFF, 0x70, 0xEF, 0x8B, 0xAD, 0x2F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF4, 0xFF, 0x0C, 0xBE, 0x8D, 0xCE, 0x6A, 0xAD, 0xAB, 0xBD, 0x08, 0x84, 0xCB, 0xAD, 0xCC, 0xA5, 0x70, 0xEF, 0xE9, 0x9C, 0xA6, 0x73, 0xC7, 0x73, 0x28, 0x84, 0xAD, 0xD6, 0xC7, 0x73, 0x46, 0x63, 0x46, 0x5B, 0x67, 0x84, 0xCB, 0xB5, 0xE6, 0x73, 0x86, 0x63, 0xE7, 0x73, 0x68, 0x84, 0xC5, 0x6B, 0x08, 0x95, 0x07, 0x74, 0xA5, 0x6B, 0x88, 0x84, 0x27, 0x7C, 0x2D, 0xE7, 0xE7, 0x7B,
+    0x83, 0x4A, 0x26, 0x6B, 0x8A, 0x84, 0xE5, 0x52, 0xE8, 0x7B, 0x05, 0x5B, 0xEA, 0x9C, 0x85, 0x7B, 0xE9, 0xB4, 0xA8, 0xB4, 0x8E, 0xE6, 0xF7, 0xFF, 0xCA, 0xBD, 0xA6, 0x7B, 0xE7, 0x7B, 0x0A, 0xA5, 0xED, 0xDE, 0xE7, 0x83, 0xCA, 0x9C, 0x2B, 0xA5, 0x69, 0xAD, 0xEB, 0xBD, 0x28, 0x84, 0xA8, 0x8C, 0x2C, 0xB6, 0xED, 0xBD, 0xAD, 0xD6, 0x0C, 0xBE, 0x2C, 0xBE, 0x2A, 0xA5, 0x69, 0xB5, 0xD0, 0xFF,
+    0xF9, 0xFF, 0xEB, 0xC5, 0xAD, 0xE6, 0xF7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x2C, 0xD6, 0x8B, 0xB5, 0x6E, 0xD6, 0xF2, 0xFF, 0xEF, 0xE6, 0x6B, 0xB5, 0x30, 0xEF, 0xFB, 0xFF, 0xFF, 0xFF, 0xB2, 0xFF, 0x50, 0xF7, 0xB2, 0xFF, 0xEC, 0xBD, 0xFC, 0xFF, 0x2E, 0xC6, 0xEF, 0xDE, 0x8B, 0xA5, 0xFB, 0xFF, 0xEE, 0xD6, 0xC8, 0x94, 0x30, 0xE7, 0xA6, 0x73, 0x89, 0x8C, 0x8D, 0xD6, 0x69, 0x8C, 0xA7, 0x73,
+    0x28, 0x7C, 0xAC, 0xAD, 0x0A, 0x9D, 0x07, 0x74, 0x66, 0x63, 0x0A, 0x95, 0xC6, 0x73, 0xCB, 0xB5, 0xA6, 0x6B, 0xE7, 0x73, 0xA9, 0x8C, 0x48, 0x7C, 0x8C, 0xCE, 0x67, 0x84, 0xA8, 0x84, 0xA8, 0x8C, 0x22, 0x3A, 0xA5, 0x52, 0x66, 0x6B, 0xAB, 0x94, 0x87, 0x6B, 0x04, 0x5B, 0x05, 0x63, 0x65, 0x7B, 0xCC, 0xC5, 0x2A, 0xA5, 0x49, 0x94, 0xAA, 0x94, 0xD0, 0xDE, 0xE9, 0x9C, 0x2B, 0xA5, 0x0B, 0xA5,
+    0x09, 0x9D, 0x49, 0xAD, 0x69, 0x94, 0x8A, 0x94, 0x2A, 0xA5, 0xA8, 0x94, 0xEC, 0xBD, 0x48, 0x84, 0xF1, 0xDE, 0xA8, 0x8C, 0xE9, 0x9C, 0x29, 0xA5, 0x47, 0x8C, 0x88, 0x94, 0x87, 0x94, 0x2F, 0xE7, 0xD4, 0xFF, 0xAE, 0xE6, 0x4F, 0xEF, 0xCF, 0xF6, 0xFC, 0xFF, 0xF5, 0xFF, 0xCB, 0xC5, 0x6B, 0xB5, 0x4E, 0xCE, 0xF2, 0xFF, 0x8D, 0xDE, 0xC9, 0x9C, 0xE8, 0xA4, 0x0E, 0xEF, 0xF2, 0xFF, 0x6E, 0xE6,
+    0x89, 0xB5, 0x8B, 0xB5, 0x71, 0xEF, 0x68, 0x8C, 0x50, 0xE7, 0x0D, 0xBE, 0x8D, 0xBE, 0x2F, 0xDF, 0xAB, 0xB5, 0x4E, 0xBE, 0x2D, 0xBE, 0x85, 0x6B, 0xCB, 0xBD, 0x07, 0x7C, 0x86, 0x6B, 0x85, 0x6B, 0x6A, 0xA5, 0x4D, 0xC6, 0xE8, 0x73, 0xE7, 0x73, 0xA5, 0x73, 0xCB, 0xAD, 0xEB, 0x9D, 0x28, 0x7C, 0xC6, 0x6B, 0x68, 0x84, 0x2C, 0xBE, 0x48, 0x7C, 0x68, 0x84, 0xE9, 0x8C, 0x49, 0xA5, 0xC9, 0x8C,
+    0x63, 0x42, 0xA5, 0x52, 0x64, 0x63, 0xE5, 0x52, 0x82, 0x4A, 0x25, 0x63, 0x05, 0x5B, 0xE4, 0x5A, 0x0B, 0xA5, 0x89, 0x94, 0x45, 0x6B, 0xAC, 0xB5, 0xCA, 0x9C, 0x86, 0x73, 0x8A, 0xAD, 0x2B, 0xA5, 0xCB, 0xBD, 0x07, 0x7C, 0xEC, 0xB5, 0x68, 0x8C, 0x8B, 0xB5, 0xEA, 0x9C, 0x09, 0x9D, 0xE7, 0x7B, 0xAB, 0xAD, 0x0A, 0xA5, 0x90, 0xD6, 0xCD, 0xD6, 0xA9, 0x94, 0x8E, 0xCE, 0xA8, 0x9C, 0xCC, 0xBD,
+    0xEE, 0xDE, 0x2E, 0xE7, 0xFD, 0xFF, 0x4C, 0xDE, 0xFD, 0xFF, 0xFB, 0xFF, 0xAA, 0xBD, 0x4A, 0xAD, 0x8B, 0xB5, 0xF2, 0xFF, 0x6A, 0xBD, 0x89, 0x94, 0x2C, 0xCE, 0x91, 0xFF, 0x92, 0xFF, 0xEB, 0xBD, 0xF2, 0xFF, 0x6B, 0xB5, 0x71, 0xEF, 0x68, 0x8C, 0x2C, 0xC6, 0x0E, 0xC6, 0xB1, 0xE7, 0x2B, 0x9D, 0x8A, 0xA5, 0x0D, 0xBE, 0xD6, 0xF7, 0x6D, 0xCE, 0x08, 0x84, 0xA6, 0x73, 0xCA, 0x94, 0xA8, 0x8C,
+    0x86, 0x6B, 0x25, 0x5B, 0xE7, 0x73, 0x68, 0x84, 0x0D, 0xBE, 0xA6, 0x6B, 0xE6, 0x73, 0x68, 0x84, 0xE6, 0x73, 0x68, 0x84, 0x68, 0x84, 0xE9, 0x94, 0xC9, 0x94, 0xE9, 0x94, 0x4A, 0xA5, 0xE9, 0x9C, 0xE5, 0x52, 0xC5, 0x52, 0x83, 0x4A, 0x64, 0x4A, 0x62, 0x4A, 0x26, 0x5B, 0x06, 0x74, 0x04, 0x5B, 0x0A, 0x9D, 0x04, 0x63, 0x2A, 0x9D, 0x66, 0x6B, 0x88, 0x8C, 0x04, 0x63, 0x2C, 0xA5, 0x2C, 0xBE,
+    0xF4, 0xFF, 0xEA, 0x94, 0xE6, 0x7B, 0xEC, 0xB5, 0x73, 0xEF, 0x47, 0x84, 0x69, 0x8C, 0x09, 0x9D, 0x27, 0x84, 0x6E, 0xCE, 0x0C, 0xBE, 0x88, 0x8C, 0xF2, 0xFF, 0x88, 0x94, 0xF0, 0xDE, 0xCB, 0xB5, 0xAD, 0xD6, 0xEE, 0xDE, 0xFF, 0xFF, 0xCB, 0xC5, 0xF4, 0xFF, 0xD1, 0xFF, 0x8B, 0xB5, 0x0A, 0xA5, 0x70, 0xEF, 0x70, 0xEF, 0x29, 0xAD, 0xC8, 0x94, 0x0C, 0xC6, 0x50, 0xEF, 0x50, 0xEF, 0x2A, 0xAD,
+    0xC9, 0x9C, 0xCE, 0xD6, 0xE9, 0x94, 0x6A, 0xAD, 0xC7, 0x94, 0x8B, 0xAD, 0x6B, 0xA5, 0x4D, 0xBE, 0x4A, 0xA5, 0xD3, 0xFF, 0xAD, 0xCE, 0x2C, 0xA5, 0xE7, 0x7B, 0xC6, 0x73, 0x27, 0x84, 0x85, 0x6B, 0xA6, 0x6B, 0x86, 0x6B, 0xE8, 0x7B, 0xA5, 0x6B, 0xE6, 0x73, 0xC6, 0x6B, 0x27, 0x7C, 0x8D, 0xAD, 0x27, 0x7C, 0x68, 0x84, 0x09, 0x95, 0x09, 0x9D, 0x8A, 0xAD, 0xCA, 0xB5, 0x49, 0xA5, 0xE9, 0x9C,
+    0x25, 0x63, 0x23, 0x42, 0x44, 0x4A, 0xC5, 0x5A, 0x8B, 0xAD, 0x26, 0x63, 0x66, 0x63, 0x05, 0x5B, 0x4B, 0xAD, 0xAE, 0xD6, 0x2B, 0x9D, 0xA8, 0x94, 0x09, 0x9D, 0xEA, 0x94, 0xC9, 0x9C, 0x8B, 0xA5, 0x8E, 0xCE, 0xED, 0xB5, 0xC6, 0x73, 0xCA, 0x94, 0x6D, 0xC6, 0x68, 0x8C, 0xEB, 0x9C, 0xAC, 0xB5, 0x6B, 0xA5, 0x8D, 0xCE, 0xE9, 0x9C, 0x2D, 0xC6, 0x6D, 0xCE, 0xEC, 0xC5, 0x8E, 0xD6, 0xF4, 0xFF,
+    0xA7, 0x9C, 0x4C, 0xCE, 0x50, 0xE7, 0x4A, 0xB5, 0xF5, 0xFF, 0x4F, 0xF7, 0xEB, 0xC5, 0xC9, 0x9C, 0x0C, 0xC6, 0xF4, 0xFF, 0xC7, 0xA4, 0x68, 0x8C, 0x09, 0xA5, 0x4A, 0xAD, 0xF3, 0xFF, 0xAA, 0xBD, 0xCC, 0xBD, 0xEE, 0xDE, 0x2D, 0xC6, 0xAB, 0xB5, 0xF3, 0xFF, 0x2C, 0xBE, 0x67, 0x84, 0x07, 0x7C, 0xE9, 0x9C, 0x30, 0xE7, 0xEA, 0x94, 0xE7, 0x7B, 0x48, 0x84, 0xA8, 0x94, 0xCE, 0xDE, 0x85, 0x6B,
+    0x08, 0x7C, 0x0C, 0xBE, 0xC6, 0x73, 0x8D, 0xCE, 0xCF, 0xD6, 0x47, 0x7C, 0x06, 0x7C, 0x0A, 0x9D, 0xF5, 0xFF, 0x90, 0xF7, 0xCB, 0xBD, 0x8A, 0xB5, 0xFD, 0xFF, 0x2A, 0xC6, 0xFF, 0xFF, 0x0C, 0xC6, 0x2E, 0xBE, 0x07, 0x74, 0xA4, 0x52, 0x64, 0x4A, 0x84, 0x4A, 0xC4, 0x52, 0xA9, 0x8C, 0xC3, 0x52, 0xE4, 0x5A, 0x89, 0x8C, 0x45, 0x63, 0xAF, 0xD6, 0xA2, 0x52, 0xA9, 0x94, 0x68, 0x8C, 0xE9, 0x94,
+    0x09, 0x9D, 0x29, 0x9D, 0x8D, 0xAD, 0x27, 0x84, 0x27, 0x84, 0x0B, 0xBE, 0xA9, 0x8C, 0x29, 0x84, 0xAB, 0xAD, 0x8E, 0xCE, 0xCE, 0xD6, 0xA8, 0x94, 0xC9, 0x9C, 0x0A, 0xA5, 0xAE, 0xD6, 0xB2, 0xFF, 0x6A, 0xB5, 0x2E, 0xCE, 0x69, 0xB5, 0xC8, 0xA4, 0xD1, 0xFF, 0x4D, 0xD6, 0x88, 0x94, 0x89, 0x94, 0x8A, 0xAD, 0xF2, 0xFF, 0xEC, 0xD5, 0x8C, 0xB5, 0xA7, 0x9C, 0x8C, 0xBD, 0xD2, 0xFF, 0x52, 0xF7,
+    0x8D, 0xD6, 0x2C, 0xCE, 0x6A, 0xAD, 0x71, 0xEF, 0x29, 0xA5, 0xAC, 0xB5, 0x68, 0x8C, 0x48, 0x84, 0xCE, 0xDE, 0xCA, 0x9C, 0x88, 0x8C, 0x28, 0x84, 0xA6, 0x94, 0x8E, 0xD6, 0x65, 0x63, 0x27, 0x84, 0x48, 0x84, 0x86, 0x6B, 0x0C, 0xC6, 0x27, 0x7C, 0xC8, 0x8C, 0x27, 0x7C, 0x47, 0x7C, 0x89, 0xB5, 0x6A, 0xA5, 0xEB, 0xBD, 0xF5, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0x0F, 0xF7, 0xEB, 0xC5, 0x2C, 0xCE,
+    0xE6, 0x5A, 0x44, 0x42, 0x43, 0x42, 0x83, 0x4A, 0x85, 0x4A, 0x43, 0x42, 0x29, 0x7C, 0xE5, 0x52, 0x05, 0x5B, 0x07, 0x7C, 0x05, 0x53, 0xE7, 0x73, 0x05, 0x5B, 0x87, 0x6B, 0x85, 0x6B, 0xE9, 0x94, 0x88, 0x8C, 0x4E, 0xBE, 0x88, 0x8C, 0x48, 0x84, 0x48, 0x84, 0xC6, 0x73, 0x2C, 0xBE, 0x08, 0x84, 0xA9, 0x94, 0x8C, 0xAD, 0x2E, 0xC6, 0x8E, 0xD6, 0xEC, 0xBD, 0x2B, 0xAD, 0x6B, 0xB5, 0x70, 0xEF,
+    0x09, 0xA5, 0x2D, 0xCE, 0xEB, 0xB5, 0xCC, 0xC5, 0xAE, 0xDE, 0x0D, 0xC6, 0x68, 0x8C, 0x28, 0x8C, 0x0C, 0xBE, 0x2F, 0xE7, 0x8B, 0xBD, 0xCC, 0xB5, 0x0C, 0xC6, 0xEA, 0xA4, 0xEF, 0xDE, 0x2A, 0xAD, 0xF3, 0xFF, 0xCC, 0xBD, 0x70, 0xE7, 0xA7, 0x9C, 0x4A, 0xA5, 0x4E, 0xCE, 0x90, 0xD6, 0x70, 0xF7, 0xAB, 0xB5, 0xEA, 0x9C, 0xC8, 0x94, 0xCB, 0xBD, 0x8D, 0xDE, 0xE7, 0x73, 0x07, 0x84, 0x2A, 0x9D,
+    0x6D, 0xCE, 0x8C, 0xAD, 0x28, 0x7C, 0x48, 0x84, 0x89, 0x8C, 0x91, 0xEF, 0x87, 0x8C, 0x6A, 0xAD, 0x8E, 0xD6, 0xF7, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0x2E, 0xEF, 0x2C, 0xC6, 0x2C, 0xBE, 0xF8, 0xFF, 0x03, 0x42, 0xE6, 0x5A, 0x64, 0x4A, 0xC5, 0x52, 0xA5, 0x4A, 0xC4, 0x52, 0x07, 0x7C, 0xC4, 0x52, 0xE4, 0x52, 0x4C, 0xA5, 0x04, 0x5B, 0x86, 0x6B, 0x04, 0x5B, 0x48, 0x84, 0x0A, 0x95, 0x8B, 0xAD,
+    0x27, 0x84, 0x89, 0x8C, 0x27, 0x7C, 0x4B, 0xA5, 0xE6, 0x73, 0xA6, 0x73, 0xE7, 0x7B, 0x0A, 0x9D, 0x08, 0x84, 0x69, 0x94, 0x89, 0x94, 0x8D, 0xCE, 0x26, 0x84, 0x0A, 0xAD, 0xAB, 0xB5, 0xA9, 0x94, 0x2A, 0xAD, 0x09, 0xA5, 0xFF, 0xFF, 0x51, 0xEF, 0x8E, 0xD6, 0x2D, 0xC6, 0x88, 0x94, 0x89, 0x94, 0xCB, 0xB5, 0xD3, 0xFF, 0xED, 0xC5, 0x4D, 0xB6, 0x8B, 0xB5, 0xEF, 0xDE, 0xCA, 0x9C, 0xAB, 0xBD,
+    0x88, 0x94, 0xED, 0xBD, 0x50, 0xEF, 0x29, 0xA5, 0x4B, 0xAD, 0xAB, 0xBD, 0x2F, 0xE7, 0x88, 0x9C, 0x6C, 0xAD, 0x50, 0xCF, 0x09, 0xA5, 0xF6, 0xFF, 0x8C, 0xAD, 0x4B, 0xA5, 0x07, 0x84, 0x8D, 0xD6, 0xAC, 0xAD, 0xC6, 0x73, 0x47, 0x7C, 0x06, 0x74, 0xAD, 0xD6, 0x47, 0x84, 0x27, 0x7C, 0xC9, 0x94, 0xFE, 0xFF, 0x2B, 0xCE, 0x8D, 0xDE, 0x2C, 0xC6, 0xCB, 0xB5, 0x0B, 0xBE, 0xF2, 0xFF, 0xFB, 0xFF,
+    0x03, 0x3A, 0xC5, 0x52, 0x71, 0xB6, 0xC5, 0x52, 0x05, 0x5B, 0xE5, 0x52, 0x09, 0x7C, 0xC8, 0x73, 0x47, 0x84, 0x09, 0x7C, 0x44, 0x63, 0x86, 0x6B, 0x09, 0x95, 0xE7, 0x7B, 0xFF, 0xFF, 0x6A, 0xA5, 0xE8, 0x8C, 0x27, 0x7C, 0x0A, 0x9D, 0x2C, 0xA5, 0xC9, 0x94, 0xEA, 0x9C, 0x28, 0x84, 0xA6, 0x73, 0xEB, 0xB5, 0x0B, 0xA5, 0x48, 0x8C, 0xED, 0xBD, 0x0D, 0xC6, 0x89, 0x9C, 0x2A, 0xAD, 0xA9, 0x9C,
+    0xA8, 0x9C, 0xC9, 0xA4, 0xE9, 0xA4, 0x6B, 0xB5, 0x29, 0xAD, 0xAB, 0xB5, 0x88, 0x8C, 0x88, 0x94, 0x8B, 0xAD, 0xA8, 0x94, 0x09, 0xAD, 0x4B, 0xAD, 0xE8, 0x9C, 0xAF, 0xD6, 0xA9, 0x9C, 0x0A, 0xA5, 0x68, 0x8C, 0x0F, 0xDF, 0x2A, 0xA5, 0x27, 0x84, 0x6B, 0xAD, 0xEB, 0xBD, 0x68, 0x8C, 0x68, 0x8C, 0xAB, 0xAD, 0xF2, 0xFF, 0x4D, 0xCE, 0x06, 0x84, 0x47, 0x84, 0x50, 0xE7, 0xD5, 0xFF, 0x27, 0x84,
+    0x06, 0x84, 0x6E, 0xCE, 0x0C, 0xBE, 0xAC, 0xAD, 0xA5, 0x6B, 0xC5, 0x7B, 0x67, 0x94, 0xC5, 0x73, 0x87, 0x8C, 0x29, 0x9D, 0x49, 0x9D, 0x6A, 0xA5, 0x8B, 0xAD, 0x29, 0x9D, 0x0E, 0xD7, 0x49, 0xA5, 0xC2, 0x39, 0x84, 0x4A, 0xC4, 0x52, 0x2A, 0x95, 0x09, 0x95, 0x45, 0x53, 0x25, 0x5B, 0xA3, 0x4A, 0x05, 0x5B, 0x6A, 0xA5, 0xCA, 0x8C, 0x29, 0x7C, 0x87, 0x84, 0xEF, 0xAE, 0xAD, 0xC6, 0xD1, 0xEF,
+    0xFD, 0xFF, 0x8D, 0xBE, 0x2A, 0x9D, 0xA6, 0x73, 0x2C, 0xBE, 0xAB, 0xAD, 0x8C, 0xAD, 0x07, 0x7C, 0x89, 0x8C, 0xF9, 0xFF, 0x47, 0x8C, 0x73, 0xEF, 0x2D, 0xC6, 0xEC, 0xBD, 0x8B, 0xB5, 0xF4, 0xFF, 0x09, 0xAD, 0x09, 0xAD, 0x4A, 0xAD, 0x2A, 0xAD, 0xF2, 0xFF, 0xCC, 0xBD, 0x88, 0x94, 0x88, 0x94, 0x6D, 0xC6, 0xB0, 0xF7, 0x4A, 0xAD, 0xFF, 0xFF, 0x0C, 0xBE, 0xAC, 0xB5, 0x10, 0xE7, 0xA8, 0x94,
+    0x8F, 0xD6, 0x4A, 0xAD, 0x0A, 0xA5, 0xA8, 0x94, 0x2F, 0xDF, 0xA9, 0x9C, 0x89, 0x8C, 0xCC, 0xB5, 0x4C, 0xCE, 0xB1, 0xEF, 0x2A, 0xA5, 0x0A, 0x9D, 0x2E, 0xDF, 0xC9, 0x94, 0xCE, 0xD6, 0xE9, 0x9C, 0x2D, 0xBE, 0x28, 0x7C, 0xE6, 0x73, 0xEF, 0xD6, 0x0F, 0xDF, 0x27, 0x7C, 0x89, 0x8C, 0x68, 0x84, 0x29, 0x9D, 0xF2, 0xFF, 0x4A, 0xA5, 0x4A, 0x9D, 0xC8, 0x8C, 0x49, 0x9D, 0xF2, 0xFF, 0x29, 0x9D,
+    0x63, 0x42, 0xA8, 0x94, 0x43, 0x42, 0xEB, 0x94, 0xC5, 0x52, 0xCB, 0x94, 0x09, 0x9D, 0x46, 0x63, 0x45, 0x5B, 0xA6, 0x6B, 0xEC, 0x94, 0xAF, 0xCE, 0x27, 0x7C, 0x48, 0x7C, 0xC9, 0x8C, 0x6A, 0x9D, 0x2B, 0xB6, 0x52, 0xD7, 0x87, 0x84, 0xC8, 0x8C, 0xA9, 0x8C, 0xEC, 0xBD, 0xAC, 0xB5, 0x2A, 0x9D, 0x88, 0x8C, 0x49, 0xA5, 0xEF, 0xDE, 0xA9, 0x9C, 0xC9, 0x9C, 0x10, 0xE7, 0x0D, 0xC6, 0x70, 0xF7,
+    0x49, 0xB5, 0x6D, 0xC6, 0xC8, 0x9C, 0x6B, 0xB5, 0x50, 0xEF, 0x4A, 0xAD, 0x88, 0x94, 0x89, 0x94, 0x6B, 0xAD, 0xF2, 0xFF, 0x6E, 0xD6, 0xFF, 0xFF, 0x4D, 0xC6, 0x0A, 0xA5, 0x91, 0xF7, 0x90, 0xEF, 0x68, 0x94, 0x4B, 0xAD, 0xC8, 0x94, 0x0E, 0xE7, 0x8C, 0xB5, 0x8B, 0xB5, 0x09, 0x9D, 0x30, 0xE7, 0x30, 0xEF, 0x09, 0xA5, 0x10, 0xDF, 0xAE, 0xCE, 0x28, 0x8C, 0xCE, 0xDE, 0x2D, 0xBE, 0x48, 0x8C,
+    0x68, 0x8C, 0x06, 0x7C, 0xEE, 0xDE, 0x67, 0x84, 0x47, 0x7C, 0x67, 0x84, 0xA8, 0x8C, 0x8A, 0xB5, 0xAC, 0xB5, 0xC8, 0x94, 0xE9, 0x94, 0xCF, 0xCE, 0xAA, 0xAD, 0x6E, 0xC6, 0x29, 0x9D, 0x29, 0x9D, 0x23, 0x42, 0xC5, 0x52, 0x43, 0x42, 0x43, 0x42, 0x05, 0x5B, 0x48, 0x7C, 0x02, 0x3A, 0x87, 0x6B, 0xE5, 0x52, 0xE6, 0x73, 0x26, 0x5B, 0x66, 0x6B, 0xE5, 0x52, 0x45, 0x63, 0x4A, 0x9D, 0x44, 0x63,
+    0x89, 0x8C, 0x68, 0x84, 0xCC, 0xB5, 0x27, 0x7C, 0xA9, 0x8C, 0x68, 0x8C, 0xAF, 0xD6, 0x31, 0xE7, 0x6E, 0xC6, 0x68, 0x8C, 0xA9, 0x94, 0xAE, 0xDE, 0xE9, 0x9C, 0x0A, 0xA5, 0xEC, 0xC5, 0xC8, 0x9C, 0x09, 0xB5, 0xE9, 0xA4, 0x6B, 0xAD, 0x09, 0xA5, 0x8D, 0xDE, 0x8B, 0xB5, 0x48, 0x8C, 0xC7, 0x83, 0x6E, 0xCE, 0xB0, 0xFF, 0x8A, 0xB5, 0x29, 0xA5, 0xA9, 0x9C, 0xCB, 0xBD, 0x09, 0xA5, 0xCC, 0xBD,
+    0xA9, 0x94, 0x09, 0xA5, 0xF4, 0xFF, 0x67, 0x94, 0x68, 0x8C, 0x4B, 0xAD, 0x4A, 0xAD, 0xAE, 0xDE, 0x0A, 0xA5, 0x6B, 0xAD, 0x0A, 0xAD, 0xB2, 0xFF, 0xD3, 0xFF, 0x68, 0x94, 0x28, 0x8C, 0xCC, 0xBD, 0xAE, 0xD6, 0x2A, 0xAD, 0x88, 0x8C, 0xC9, 0x94, 0x67, 0x84, 0xEE, 0xDE, 0x2A, 0x9D, 0x88, 0x8C, 0xC9, 0x94, 0x87, 0x8C, 0x4D, 0xC6, 0x4A, 0x9D, 0x27, 0x7C, 0xAA, 0xAD, 0x8A, 0xA5, 0xAA, 0xAD,
+    0x23, 0x42, 0x43, 0x42, 0xE6, 0x52, 0x84, 0x4A, 0x85, 0x4A, 0x63, 0x4A, 0x84, 0x4A, 0xE6, 0x5A, 0x6D, 0xA5, 0xE4, 0x52, 0x83, 0x4A, 0xE8, 0x73, 0x88, 0x84, 0x66, 0x63, 0xA7, 0x6B, 0x8D, 0xAD, 0xC9, 0x94, 0x86, 0x6B, 0x86, 0x6B, 0x06, 0x7C, 0x8A, 0xA5, 0xEA, 0x9C, 0x8B, 0xA5, 0xC6, 0x73, 0xEC, 0xBD, 0x29, 0x9D, 0x68, 0x94, 0xA9, 0x9C, 0x8E, 0xD6, 0x2A, 0xB5, 0x4A, 0xBD, 0xEC, 0xC5,
+    0x8E, 0xDE, 0x09, 0xAD, 0x6A, 0xAD, 0xCC, 0xBD, 0xCB, 0xBD, 0x52, 0xEF, 0x48, 0x8C, 0x86, 0x7B, 0xEC, 0xBD, 0x0C, 0xCE, 0x6B, 0xB5, 0x6B, 0xA5, 0xA8, 0x9C, 0xF4, 0xFF, 0x67, 0x8C, 0xE9, 0xA4, 0x88, 0x94, 0xCB, 0xC5, 0xCB, 0xBD, 0xA8, 0x9C, 0xE9, 0xA4, 0xD3, 0xFF, 0x2A, 0xAD, 0x6B, 0xAD, 0x4A, 0xAD, 0xD2, 0xFF, 0xFD, 0xFF, 0x0F, 0xE7, 0x0B, 0xCE, 0xFA, 0xFF, 0x30, 0xEF, 0x09, 0xAD,
+    0xEC, 0xCD, 0xFB, 0xFF, 0xD2, 0xFF, 0x09, 0xA5, 0xF3, 0xDF, 0xA9, 0xAD, 0x96, 0xF7, 0xA7, 0x94, 0x09, 0x9D, 0x09, 0x9D, 0x2A, 0xA5, 0xEB, 0xB5, 0x87, 0x94, 0x8A, 0xAD, 0xD3, 0xEF, 0x09, 0xA5, 0xE2, 0x39, 0x24, 0x42, 0x47, 0x63, 0x84, 0x4A, 0x64, 0x4A, 0x43, 0x42, 0xC5, 0x52, 0x47, 0x63, 0xA5, 0x4A, 0xA5, 0x52, 0x28, 0x7C, 0x45, 0x63, 0xC4, 0x52, 0xA3, 0x52, 0xC5, 0x6B, 0xC6, 0x73,
+    0x66, 0x6B, 0xA9, 0x8C, 0xA8, 0x84, 0xE7, 0x73, 0x87, 0x6B, 0xEA, 0x9C, 0x07, 0x84, 0x07, 0x84, 0x68, 0x8C, 0x0A, 0xA5, 0x87, 0x8C, 0x48, 0x94, 0x8B, 0xBD, 0x4D, 0xDE, 0xAE, 0xFE, 0x2C, 0xE6, 0x8A, 0xC5, 0x8D, 0xD6, 0x2A, 0xB5, 0x6B, 0xB5, 0x0A, 0xA5, 0x2A, 0xAD, 0x69, 0x94, 0x89, 0x94, 0x2A, 0x9D, 0xA9, 0x94, 0x0A, 0xAD, 0x48, 0x84, 0xEF, 0xDE, 0x6B, 0xAD, 0xA9, 0x94, 0xE9, 0xA4,
+    0xEC, 0xC5, 0xAC, 0xBD, 0x2A, 0xA5, 0x0A, 0xAD, 0xFE, 0xFF, 0xAB, 0xBD, 0x4A, 0xA5, 0x8B, 0xB5, 0xF5, 0xFF, 0xF4, 0xFF, 0x71, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xC6, 0xAE, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xCB, 0xC5, 0xDF, 0xFF, 0xB2, 0xFF, 0x30, 0xDF, 0xC8, 0x94, 0xC8, 0x9C, 0xA8, 0x9C, 0x6C, 0xC6, 0xCF, 0xDE, 0x29, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF7, 0xEA, 0xBD, 0xD4, 0xFF,
+    0x84, 0x4A, 0x44, 0x42, 0xC5, 0x52, 0x25, 0x5B, 0x0A, 0x95, 0x67, 0x6B, 0xE5, 0x52, 0xE5, 0x52, 0x84, 0x52, 0x89, 0x8C, 0x25, 0x63, 0xC4, 0x52, 0x05, 0x5B, 0x04, 0x5B, 0x05, 0x5B, 0x47, 0x7C, 0x69, 0x84, 0x69, 0x84, 0x65, 0x63, 0xE7, 0x7B, 0xE9, 0x94, 0x69, 0x8C, 0x69, 0x8C, 0xE9, 0x94, 0xC9, 0x9C, 0xA8, 0x9C, 0xC8, 0x9C, 0x0D, 0xC6, 0xAC, 0xC5, 0x6D, 0xF6, 0xFD, 0xFF, 0xFE, 0xFF,
+    0x30, 0xF7, 0xEC, 0xCD, 0x29, 0xAD, 0xAB, 0xC5, 0xEC, 0xBD, 0x4E, 0xC6, 0x68, 0x8C, 0x89, 0x94, 0xE9, 0x94, 0xCC, 0xBD, 0x09, 0xAD, 0x0A, 0x9D, 0xCC, 0xBD, 0xCB, 0xBD, 0x0A, 0xA5, 0xEC, 0xC5, 0xD0, 0xDE, 0x2D, 0xCE, 0x2D, 0xCE, 0xAE, 0xDE, 0x6A, 0xB5, 0xF0, 0xDE, 0x90, 0xE7, 0xAB, 0xBD, 0xE9, 0xA4, 0xAA, 0xBD, 0xF8, 0xFF, 0xF8, 0xFF, 0x0C, 0xC6, 0x4F, 0xE7, 0xF9, 0xFF, 0x2D, 0xD6,
+    0x4D, 0xCE, 0x4E, 0xCE, 0xA7, 0x94, 0x4A, 0xAD, 0xA8, 0x8C, 0xC9, 0x94, 0xC9, 0x94, 0x6A, 0xA5, 0x6A, 0xAD, 0xD2, 0xEF, 0x48, 0xA5, 0xAA, 0xAD, 0xE9, 0xA4, 0xAA, 0xAD, 0xAC, 0xB5, 0x4C, 0xC6, 0x2A, 0x7C, 0x2A, 0x95, 0x64, 0x4A, 0x28, 0x7C, 0x85, 0x6B, 0xAA, 0x7C, 0xE9, 0x94, 0xE4, 0x52, 0xE9, 0x94, 0xA4, 0x4A, 0x83, 0x52, 0x2A, 0xA5, 0x6B, 0xA5, 0xE7, 0x7B, 0x25, 0x5B, 0x04, 0x5B,
+    0x6A, 0xA5, 0x6B, 0xAD, 0x24, 0x5B, 0x69, 0x8C, 0x45, 0x63, 0x4C, 0xC6, 0xEB, 0xBD, 0x07, 0x84, 0x8A, 0xB5, 0xFE, 0xFF, 0x70, 0xEF, 0x74, 0xEF, 0x2C, 0xCE, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x6B, 0xBD, 0x0C, 0xC6, 0x2A, 0xB5, 0xD3, 0xF7, 0xCB, 0xC5, 0x68, 0x8C, 0x68, 0x94, 0xCC, 0xB5, 0xF2, 0xFF, 0x2D, 0xD6, 0x2A, 0xAD, 0x2A, 0xB5, 0x0C, 0xCE, 0xF2, 0xFF, 0x0C, 0xCE,
+    0x0A, 0xAD, 0x0C, 0xCE, 0xED, 0xCD, 0xF6, 0xFF, 0x2D, 0xCE, 0xEC, 0xCD, 0x0A, 0xAD, 0xEC, 0xC5, 0xF1, 0xFF, 0x8B, 0xBD, 0x0C, 0xC6, 0x8C, 0xBD, 0x09, 0xAD, 0x91, 0xF7, 0xF8, 0xFF, 0xCC, 0xC5, 0xA8, 0x9C, 0xC9, 0x9C, 0x50, 0xF7, 0xD1, 0xFF, 0x67, 0x8C, 0xE8, 0x9C, 0x4C, 0xC6, 0xF2, 0xFF, 0xF3, 0xFF, 0x2A, 0xA5, 0xE9, 0x9C, 0x2E, 0xDF, 0xAE, 0xCE, 0xD1, 0xF7, 0xAA, 0xB5, 0x09, 0x9D,
+    0xE9, 0x73, 0xC5, 0x4A, 0x63, 0x42, 0xC8, 0x73, 0x64, 0x42, 0x6A, 0x84, 0x6B, 0x9D, 0xA4, 0x52, 0xEA, 0x94, 0xA4, 0x52, 0xEE, 0xB5, 0xF2, 0xDE, 0xCD, 0xB5, 0x04, 0x5B, 0x0B, 0x9D, 0xCF, 0xCE, 0x4B, 0xA5, 0xC7, 0x73, 0x24, 0x5B, 0x6B, 0xAD, 0xAD, 0xB5, 0x68, 0x8C, 0x07, 0x84, 0x4C, 0xC6, 0x6A, 0xAD, 0x0C, 0xC6, 0x2A, 0xA5, 0x50, 0xEF, 0xCF, 0xE6, 0xEC, 0xD5, 0xF8, 0xFF, 0x4F, 0xFF,
+    0xF4, 0xFF, 0x4D, 0xD6, 0xE8, 0xA4, 0x8C, 0xDE, 0x8E, 0xDE, 0x88, 0x94, 0x68, 0x8C, 0x68, 0x8C, 0xEC, 0xBD, 0xF5, 0xF7, 0xCB, 0xCD, 0x2A, 0xAD, 0xF6, 0xFF, 0xFD, 0xFF, 0x4A, 0xBD, 0x8E, 0xDE, 0xAB, 0xBD, 0xD3, 0xFF, 0xF5, 0xFF, 0x6D, 0xE6, 0xCC, 0xCD, 0xAD, 0xDE, 0x91, 0xFF, 0x0D, 0xCE, 0xAC, 0xBD, 0xAC, 0xBD, 0x50, 0xF7, 0x30, 0xEF, 0x68, 0x94, 0x47, 0x94, 0x70, 0xFF, 0x29, 0xAD,
+    0x0A, 0xA5, 0x68, 0x94, 0xF4, 0xFF, 0xCF, 0xFF, 0xC8, 0x9C, 0xE8, 0xA4, 0xEE, 0xDE, 0x0A, 0x9D, 0x6D, 0xCE, 0x2A, 0xA5, 0xA8, 0x8C, 0xCB, 0xB5, 0x09, 0x9D, 0xAA, 0xAD, 0x4A, 0xA5, 0xEB, 0xBD, 0x68, 0x84, 0x64, 0x42, 0x84, 0x4A, 0x26, 0x63, 0x27, 0x5B, 0x28, 0x7C, 0xC5, 0x52, 0xE5, 0x52, 0xE6, 0x5A, 0xA4, 0x4A, 0x89, 0x8C, 0xCE, 0xAD, 0xA7, 0x6B, 0xF2, 0xDE, 0x27, 0x84, 0x89, 0x8C,
+    0x89, 0x84, 0x46, 0x63, 0x4A, 0x9D, 0x68, 0x84, 0xA7, 0x6B, 0xAB, 0xB5, 0x0A, 0x9D, 0x46, 0x84, 0x29, 0xA5, 0x87, 0x94, 0x2C, 0xC6, 0x0D, 0xC6, 0x6A, 0xB5, 0xEF, 0xE6, 0xAE, 0xEE, 0x4A, 0xB5, 0x2D, 0xD6, 0xEE, 0xD6, 0x87, 0x94, 0xD3, 0xFF, 0xCB, 0xBD, 0x8A, 0xB5, 0x48, 0x8C, 0x68, 0x8C, 0x4B, 0xB5, 0x6B, 0xAD, 0x71, 0xFF, 0x4A, 0xB5, 0xF6, 0xFF, 0xF8, 0xFF, 0x6D, 0xDE, 0xAE, 0xDE,
+    0xD4, 0xFF, 0x30, 0xEF, 0xF9, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0x8F, 0xE6, 0x4A, 0xB5, 0x30, 0xEF, 0xF2, 0xFF, 0xEA, 0xA4, 0x91, 0xEF, 0x91, 0xE7, 0xD2, 0xF7, 0x48, 0x8C, 0x2A, 0xA5, 0xAC, 0xBD, 0xC9, 0xA4, 0x68, 0x94, 0x70, 0xE7, 0xA8, 0x94, 0x68, 0x94, 0x2D, 0xCE, 0x2A, 0xA5, 0x29, 0xAD, 0xEC, 0xBD, 0x4A, 0xA5, 0xC9, 0x9C, 0xAA, 0xAD, 0x4A, 0xA5, 0x49, 0xA5, 0x49, 0xA5, 0x8A, 0xAD,
+    0x42, 0x42, 0x44, 0x42, 0xA5, 0x4A, 0x84, 0x42, 0xEF, 0xBD, 0xA3, 0x4A, 0xA5, 0x4A, 0x63, 0x4A, 0xA4, 0x52, 0x84, 0x4A, 0xE8, 0x94, 0xCD, 0xAD, 0xE3, 0x52, 0x2C, 0xA5, 0x86, 0x6B, 0x07, 0x7C, 0x86, 0x63, 0xC7, 0x73, 0x07, 0x7C, 0x67, 0x84, 0x86, 0x6B, 0x47, 0x8C, 0x2A, 0x9D, 0xE7, 0x7B, 0xD0, 0xD6, 0xE9, 0x9C, 0x88, 0x8C, 0xB0, 0xD6, 0x8B, 0xB5, 0xC8, 0xA4, 0x8B, 0xBD, 0xCC, 0xBD,
+    0xF8, 0xFF, 0x2A, 0xA5, 0xAC, 0xB5, 0x2D, 0xD6, 0xEC, 0xBD, 0x6A, 0xAD, 0x06, 0x7C, 0x68, 0x8C, 0x6A, 0xA5, 0xC8, 0x94, 0x30, 0xF7, 0xCB, 0xBD, 0x6E, 0xDE, 0x51, 0xFF, 0xCF, 0xE6, 0xEF, 0xE6, 0xCF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xB1, 0xFF, 0x31, 0xF7, 0x8E, 0xDE, 0x4D, 0xD6, 0xF0, 0xE6, 0xE9, 0xA4, 0x2D, 0xCE, 0x0D, 0xCE, 0xAA, 0x9C, 0xCA, 0x9C, 0xCC, 0xB5, 0x6B, 0xB5,
+    0x27, 0x8C, 0x89, 0x94, 0xC9, 0xA4, 0xE9, 0xA4, 0xA8, 0x94, 0x6E, 0xD6, 0x8A, 0xBD, 0x2D, 0xD6, 0x8A, 0xB5, 0xCB, 0xB5, 0x4A, 0xA5, 0x8A, 0xAD, 0x4A, 0xAD, 0x4A, 0xA5, 0xFD, 0xFF, 0xF5, 0xFF, 0xE2, 0x31, 0x23, 0x3A, 0x64, 0x4A, 0x44, 0x42, 0xA8, 0x6B, 0x43, 0x42, 0x84, 0x4A, 0x63, 0x42, 0xA5, 0x4A, 0x06, 0x5B, 0x26, 0x63, 0x66, 0x6B, 0xE5, 0x5A, 0x86, 0x6B, 0xA7, 0x73, 0x25, 0x63,
+    0xE4, 0x52, 0x28, 0x84, 0x0E, 0xB6, 0x45, 0x63, 0x66, 0x63, 0x07, 0x84, 0xA6, 0x73, 0xC6, 0x73, 0x2A, 0xA5, 0x28, 0x84, 0x07, 0x84, 0x4B, 0xAD, 0xA9, 0x9C, 0x68, 0x94, 0xC9, 0xA4, 0x69, 0x94, 0xCC, 0xBD, 0xF0, 0xDE, 0x27, 0x8C, 0x2A, 0xAD, 0x2A, 0xA5, 0x68, 0x84, 0x27, 0x84, 0x48, 0x84, 0x48, 0x8C, 0x8C, 0xBD, 0x8B, 0xBD, 0xE9, 0x9C, 0xAB, 0xBD, 0xEC, 0xCD, 0xCC, 0xC5, 0x10, 0xEF,
+    0x4D, 0xDE, 0x30, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xFB, 0xFF, 0xF0, 0xFE, 0x4E, 0xDE, 0x2D, 0xD6, 0xAB, 0xC5, 0x2A, 0xAD, 0x6B, 0xB5, 0x2A, 0xAD, 0x89, 0x94, 0x48, 0x8C, 0x48, 0x8C, 0xA9, 0x9C, 0x48, 0x8C, 0x47, 0x84, 0xC9, 0x94, 0xC9, 0x9C, 0x09, 0xAD, 0xAE, 0xEE, 0xB1, 0xFF, 0x30, 0xFF, 0x6D, 0xE6, 0x8A, 0xB5, 0x6A, 0xA5, 0x6A, 0xA5, 0x4A, 0xAD, 0x49, 0xA5, 0x4A, 0xA5, 0x29, 0xA5,
+    0x43, 0x42, 0x27, 0x7C, 0xC5, 0x52, 0x28, 0x84, 0xA9, 0x8C, 0xA6, 0x73, 0xA8, 0x8C, 0x8C, 0xA5, 0xAF, 0xCE, 0xEC, 0xB5, 0xCD, 0xB5, 0x04, 0x63, 0xCD, 0xC5, 0x2D, 0xC6, 0x4E, 0xC6, 0xF6, 0xFF, 0xCC, 0xB5, 0x2D, 0xC6, 0xA9, 0x9C, 0xA6, 0x73, 0x31, 0xE7, 0x0D, 0xC6, 0x2C, 0xC6, 0x2D, 0xC6, 0x88, 0x94, 0x47, 0x8C, 0x71, 0xEF, 0x29, 0xA5, 0x6A, 0xB5, 0x89, 0x94, 0x27, 0x8C, 0xD2, 0xFF,
+    0xAE, 0xDE, 0xA8, 0x9C, 0x47, 0x8C, 0xED, 0xC5, 0xB1, 0xF7, 0xAE, 0xD6, 0x69, 0x8C, 0x68, 0x8C, 0x4B, 0xB5, 0xF1, 0xFF, 0x0C, 0xCE, 0xC9, 0xA4, 0x0D, 0xCE, 0xF4, 0xFF, 0xF9, 0xFF, 0xD8, 0xFF, 0x4E, 0xDE, 0x30, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0x91, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF, 0xF9, 0xFF, 0x4B, 0xB5, 0x88, 0x9C, 0xCE, 0xE6, 0x70, 0xEF, 0x71, 0xF7, 0x2E, 0xD6,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xF1, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x4D, 0xC6, 0xF4, 0xFF, 0x69, 0xB5, 0xF1, 0xFF, 0xF3, 0xFF, 0xEB, 0xBD, 0x64, 0x4A, 0x64, 0x42, 0x84, 0x4A, 0xEA, 0x74, 0xA4, 0x4A, 0xA5, 0x4A, 0xC5, 0x52, 0xE8, 0x73, 0xA5, 0x52, 0xA5, 0x4A, 0x45, 0x5B, 0xA3, 0x52, 0x05, 0x5B, 0xE4, 0x5A, 0xAA, 0x94, 0x69, 0x8C,
+    0xE7, 0x7B, 0x07, 0x7C, 0xA9, 0x94, 0x06, 0x7C, 0x85, 0x6B, 0x67, 0x84, 0x88, 0x94, 0xB2, 0xEF, 0x4A, 0xAD, 0xA9, 0x94, 0xB3, 0xF7, 0x46, 0x84, 0x08, 0x9D, 0x6F, 0xB6, 0x4A, 0xB5, 0x0A, 0x9D, 0xAF, 0xD6, 0x66, 0x94, 0xAB, 0xB5, 0xAE, 0xDE, 0x71, 0xEF, 0xF2, 0xFF, 0x68, 0x8C, 0x48, 0x8C, 0xAC, 0xBD, 0x0F, 0xE7, 0x72, 0xFF, 0x09, 0xAD, 0x4E, 0xD6, 0x0A, 0xAD, 0xEC, 0xC5, 0xB4, 0xF7,
+    0xAB, 0xBD, 0x30, 0xFF, 0xF9, 0xFF, 0xFE, 0xFF, 0xF9, 0xFF, 0xB2, 0xFF, 0xF2, 0xFF, 0xF3, 0xFF, 0xCE, 0xD6, 0xEF, 0xE6, 0x71, 0xEF, 0x50, 0xEF, 0x8E, 0xCE, 0x4D, 0xC6, 0x2C, 0xBE, 0x8A, 0xB5, 0x8D, 0xCE, 0x4D, 0xCE, 0xEB, 0xC5, 0x4D, 0xCE, 0x4C, 0xD6, 0xF3, 0xFF, 0x70, 0xFF, 0x2B, 0xEE, 0xCE, 0xE6, 0xCE, 0xDE, 0x69, 0xAD, 0xAB, 0xAD, 0xEC, 0xB5, 0x8A, 0xAD, 0xAB, 0xB5, 0x6A, 0xAD,
+    0x44, 0x42, 0x64, 0x42, 0x43, 0x42, 0x84, 0x4A, 0x84, 0x4A, 0x64, 0x42, 0xA4, 0x4A, 0x06, 0x5B, 0x84, 0x4A, 0xC5, 0x52, 0xE5, 0x52, 0xC4, 0x52, 0x25, 0x5B, 0x25, 0x63, 0xA7, 0x73, 0x66, 0x6B, 0x25, 0x5B, 0x45, 0x6B, 0x66, 0x6B, 0x66, 0x6B, 0x46, 0x6B, 0x49, 0x8C, 0xA6, 0x7B, 0xC6, 0x73, 0xA9, 0x94, 0x08, 0x84, 0x88, 0x94, 0x07, 0x84, 0x06, 0x84, 0x28, 0x84, 0x28, 0x8C, 0xE7, 0x7B,
+    0xA9, 0x94, 0x47, 0x8C, 0x48, 0x8C, 0xA8, 0x9C, 0x4A, 0xA5, 0xC8, 0x9C, 0x88, 0x94, 0x86, 0x73, 0xA9, 0x9C, 0x68, 0x94, 0xAB, 0xBD, 0xB4, 0xFF, 0x2B, 0xB5, 0x0A, 0xAD, 0x2A, 0xAD, 0xEC, 0xCD, 0x4E, 0xD6, 0x0C, 0xD6, 0x11, 0xFF, 0x50, 0xFF, 0xCF, 0xF6, 0x0D, 0xD6, 0xAB, 0xC5, 0xAB, 0xC5, 0x4B, 0xB5, 0x2A, 0xB5, 0xE9, 0xA4, 0x47, 0x94, 0x89, 0x94, 0x68, 0x8C, 0x68, 0x94, 0x0E, 0xC6,
+    0xA9, 0x8C, 0x68, 0x8C, 0x48, 0x8C, 0xA9, 0x94, 0x0A, 0xA5, 0x6A, 0xB5, 0xAB, 0xBD, 0x09, 0xA5, 0xAB, 0xBD, 0x6A, 0xAD, 0x09, 0x9D, 0x09, 0x9D, 0x2A, 0xA5, 0x09, 0x9D, 0xE9, 0x94, 0xE9, 0x9C, 0xA4, 0x4A, 0x84, 0x4A, 0xA4, 0x4A, 0xA5, 0x4A, 0xA4, 0x4A, 0xA4, 0x4A, 0x63, 0x42, 0x46, 0x63, 0x05, 0x53, 0xA4, 0x4A, 0x05, 0x5B, 0x25, 0x63, 0xC7, 0x73, 0x07, 0x7C, 0xC6, 0x7B, 0x68, 0x84,
+    0x86, 0x6B, 0x05, 0x63, 0xA6, 0x73, 0x86, 0x73, 0x46, 0x6B, 0x27, 0x84, 0x68, 0x94, 0xA9, 0xA4, 0xED, 0xCD, 0x47, 0x8C, 0xA9, 0x94, 0x07, 0x7C, 0x27, 0x84, 0x28, 0x84, 0x07, 0x84, 0xC7, 0x7B, 0x88, 0x94, 0x88, 0x94, 0x27, 0x84, 0xC9, 0x9C, 0xE9, 0x9C, 0x69, 0x8C, 0x28, 0x84, 0xA7, 0x7B, 0x68, 0x8C, 0xA9, 0x94, 0x8C, 0xBD, 0x68, 0x94, 0x2B, 0xB5, 0xC9, 0xA4, 0x0A, 0xAD, 0x4B, 0xB5,
+    0x2A, 0xB5, 0x8B, 0xC5, 0xEC, 0xD5, 0x2E, 0xDE, 0xAB, 0xC5, 0x6A, 0xB5, 0x4A, 0xBD, 0x6A, 0xBD, 0xE9, 0xAC, 0xC9, 0xA4, 0xCA, 0xA4, 0x68, 0x94, 0x48, 0x8C, 0x48, 0x8C, 0x88, 0x8C, 0x48, 0x8C, 0xA9, 0x94, 0x67, 0x84, 0x68, 0x8C, 0xA8, 0x94, 0xC9, 0x94, 0x2A, 0x9D, 0x29, 0xA5, 0xC8, 0x9C, 0x09, 0xA5, 0x4A, 0xA5, 0x2A, 0xA5, 0x2A, 0x9D, 0xE9, 0x9C, 0x09, 0x9D, 0x09, 0x9D, 0xE9, 0x94,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x91, 0xF7, 0x22, 0x5B, 0x92, 0xBE, 0x66, 0x6B, 0x08, 0x84, 0x69, 0x8C, 0xEA, 0x9C, 0xE5, 0x5A, 0x27, 0x84, 0x2A, 0xA5, 0x8F, 0xEE, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0x6B, 0xA5, 0x09, 0x9D, 0xEC, 0xBD, 0x2F, 0xDF, 0xA6, 0x94, 0x4E, 0xCE, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xC5, 0xD3, 0xFF, 0xAE, 0xD6, 0xEC, 0xC5, 0x29, 0xA5, 0xCC, 0xC5, 0x2A, 0xA5,
+    0x8C, 0xB5, 0x2D, 0xC6, 0x09, 0xA5, 0x09, 0xAD, 0xC9, 0x9C, 0x4A, 0xAD, 0x28, 0x8C, 0x86, 0x7B, 0x0A, 0xA5, 0x89, 0x9C, 0x0C, 0xCE, 0xEA, 0xA4, 0x2D, 0xD6, 0xC9, 0xA4, 0xAB, 0xBD, 0x6E, 0xDE, 0x4E, 0xD6, 0xAF, 0xEE, 0x0D, 0xD6, 0xEC, 0xC5, 0xEF, 0xE6, 0x71, 0xEF, 0x8E, 0xDE, 0xCF, 0xDE, 0xCB, 0xBD, 0x8A, 0xB5, 0xEF, 0xDE, 0x4E, 0xC6, 0x29, 0xA5, 0xAD, 0xB6, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x07, 0xA5, 0xFB, 0xFF, 0x96, 0xEF, 0xFB, 0xFF, 0xE9, 0x9C, 0x29, 0x9D, 0xCB, 0xB5, 0x4A, 0xA5, 0x09, 0x9D, 0x49, 0xA5, 0x69, 0xA5, 0x49, 0xA5, 0x6B, 0xAD, 0x4A, 0xA5, 0x29, 0x9D, 0x4A, 0xA5, 0xE5, 0x5A, 0xC3, 0x5A, 0x88, 0x8C, 0xC5, 0x5A, 0x6B, 0xA5, 0xC7, 0x7B, 0xC6, 0x7B, 0x67, 0x73, 0x26, 0x63, 0x48, 0x8C, 0xCB, 0xB5, 0xEA, 0x9C, 0x49, 0x94, 0xE7, 0x7B, 0xE9, 0xA4, 0xAE, 0xCE,
+    0x0C, 0xBE, 0x65, 0x73, 0xE8, 0x9C, 0xF0, 0xE6, 0x8A, 0xB5, 0xAE, 0xDE, 0x6C, 0xBD, 0xEC, 0xCD, 0x4A, 0xBD, 0x88, 0x9C, 0x30, 0xEF, 0x09, 0xAD, 0x0A, 0xAD, 0xED, 0xC5, 0x27, 0x8C, 0x50, 0xF7, 0x47, 0x8C, 0xE9, 0xA4, 0x09, 0xAD, 0x09, 0xB5, 0x70, 0xEF, 0x48, 0x94, 0x28, 0x84, 0xA7, 0x7B, 0x0A, 0xB5, 0xF3, 0xFF, 0xCC, 0xCD, 0xC5, 0x8B, 0x09, 0xB5, 0xF3, 0xFF, 0xFB, 0xFF, 0x4E, 0xE6,
+    0x0A, 0xBD, 0x88, 0xBD, 0x0F, 0xEF, 0xF8, 0xFF, 0x8B, 0xC5, 0x69, 0xBD, 0xD4, 0xFF, 0xAC, 0xC5, 0xF6, 0xFF, 0x6A, 0xBD, 0x92, 0xFF, 0xB2, 0xF7, 0xB2, 0xFF, 0x0C, 0xC6, 0x71, 0xF7, 0x6F, 0xDE, 0x07, 0x94, 0x91, 0xEF, 0x0A, 0xAD, 0x0F, 0xEF, 0xEA, 0xB4, 0xEE, 0xEE, 0x2F, 0xEF, 0x51, 0xEF, 0xD2, 0xFF, 0xB3, 0xF7, 0x09, 0xA5, 0x30, 0xEF, 0x47, 0x8C, 0xF9, 0xFF, 0x66, 0x8C, 0x6A, 0xAD,
+    0x64, 0x42, 0x64, 0x42, 0xC5, 0x52, 0xA5, 0x52, 0xC4, 0x52, 0x84, 0x4A, 0xCA, 0x9C, 0xE5, 0x5A, 0x66, 0x6B, 0xE5, 0x52, 0x08, 0x7C, 0x07, 0x84, 0x28, 0x84, 0xC7, 0x7B, 0x28, 0x8C, 0x46, 0x6B, 0x46, 0x6B, 0x67, 0x73, 0x48, 0x8C, 0xA6, 0x7B, 0x8A, 0x94, 0x27, 0x8C, 0x69, 0x94, 0x6C, 0xB5, 0xC9, 0xA4, 0x89, 0x9C, 0xAC, 0xC5, 0x89, 0x9C, 0x51, 0xEF, 0x48, 0x94, 0x68, 0x9C, 0xF1, 0xDE,
+    0x4B, 0xAD, 0x6B, 0xB5, 0xC6, 0x7B, 0x0A, 0xAD, 0x0D, 0xC6, 0x48, 0x94, 0x28, 0x84, 0x07, 0x8C, 0x48, 0x94, 0x48, 0x8C, 0xAC, 0xC5, 0x07, 0x8C, 0x0A, 0xB5, 0xE9, 0xAC, 0x8C, 0xBD, 0x2A, 0xB5, 0x2E, 0xD6, 0x2D, 0xCE, 0x4A, 0xB5, 0xF0, 0xDE, 0xCC, 0xC5, 0xAB, 0xBD, 0xCF, 0xE6, 0x0C, 0xCE, 0x4A, 0xB5, 0x4A, 0xB5, 0x4A, 0xB5, 0x0A, 0xAD, 0x68, 0x94, 0x88, 0x8C, 0x0B, 0xB6, 0x89, 0x9C,
+    0x27, 0x84, 0x68, 0x8C, 0x68, 0x8C, 0x68, 0x84, 0xC6, 0x7B, 0x09, 0x95, 0x2A, 0x9D, 0xE9, 0x94, 0x4A, 0x9D, 0x0A, 0x9D, 0x2A, 0x9D, 0x09, 0x9D, 0x88, 0x94, 0xE9, 0x94, 0x09, 0x9D, 0xC8, 0x94, 0x63, 0x42, 0xC5, 0x52, 0xA5, 0x52, 0xA4, 0x52, 0xA4, 0x52, 0xE5, 0x5A, 0x25, 0x63, 0xC4, 0x5A, 0x25, 0x63, 0xC4, 0x52, 0x49, 0x8C, 0x0A, 0xA5, 0x05, 0x63, 0x25, 0x63, 0x25, 0x6B, 0xC7, 0x7B,
+    0xE7, 0x7B, 0xC7, 0x7B, 0x88, 0x8C, 0x2D, 0xC6, 0x29, 0xA5, 0x2B, 0xAD, 0x0E, 0xCE, 0x8C, 0xBD, 0xCA, 0xA4, 0x32, 0xF7, 0x50, 0xFF, 0xB2, 0xFF, 0x0C, 0xCE, 0x68, 0x94, 0x67, 0x9C, 0xC8, 0x9C, 0x68, 0x94, 0xF5, 0xFF, 0x2A, 0xA5, 0x8B, 0xC5, 0x8A, 0xBD, 0x4B, 0xAD, 0x48, 0x8C, 0x28, 0x8C, 0x09, 0xA5, 0x6B, 0xBD, 0xF0, 0xEE, 0xA9, 0xA4, 0x4D, 0xD6, 0xE9, 0xAC, 0x8A, 0xC5, 0xE9, 0xB4,
+    0x8B, 0xBD, 0x4D, 0xD6, 0xEC, 0xCD, 0x2F, 0xEF, 0xFF, 0xFF, 0x91, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xAE, 0xE6, 0xF3, 0xFF, 0xF4, 0xFF, 0x0C, 0xCE, 0xE9, 0xA4, 0xA9, 0x94, 0xD0, 0xDE, 0x6A, 0xAD, 0x47, 0x8C, 0x88, 0x94, 0xA8, 0x94, 0x8A, 0xA5, 0xCC, 0xB5, 0xFC, 0xFF, 0x73, 0xD7, 0x6E, 0xCE, 0xCA, 0xAD, 0xCB, 0xAD, 0xCE, 0xCE, 0x4D, 0xC6, 0x2C, 0xBE, 0x49, 0xAD, 0xAB, 0xAD, 0x29, 0x9D,
+    0xC4, 0x52, 0x84, 0x52, 0xC5, 0x52, 0x25, 0x63, 0xE5, 0x5A, 0x66, 0x6B, 0xA4, 0x52, 0x05, 0x63, 0xE4, 0x62, 0x06, 0x7C, 0x68, 0x8C, 0xE9, 0x9C, 0x69, 0x94, 0xCA, 0x9C, 0xEA, 0xA4, 0xC5, 0x73, 0x46, 0x6B, 0x8B, 0xAD, 0xEF, 0xD6, 0xAF, 0xD6, 0xCA, 0xA4, 0x6E, 0xDE, 0x92, 0xF7, 0x0D, 0xCE, 0x28, 0x8C, 0x8A, 0xC5, 0xFF, 0xFF, 0xB3, 0xF7, 0xEC, 0xCD, 0xAE, 0xDE, 0x4A, 0xB5, 0xE6, 0x7B,
+    0x2A, 0xB5, 0xEF, 0xE6, 0x28, 0x8C, 0x6B, 0xC5, 0xAF, 0xDE, 0x88, 0x9C, 0xE7, 0x8B, 0x48, 0x94, 0x6E, 0xD6, 0x2C, 0xBD, 0x2C, 0xDE, 0x27, 0x94, 0xB3, 0xFF, 0x6B, 0xD5, 0xAB, 0xD5, 0x2D, 0xE6, 0xCE, 0xDE, 0xAC, 0xCD, 0x2A, 0xB5, 0xB1, 0xFF, 0xF4, 0xFF, 0x8E, 0xD6, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x88, 0x9C, 0x27, 0x84, 0xF1, 0xFF, 0x8D, 0xD6,
+    0x48, 0x8C, 0xCB, 0xBD, 0x50, 0xE7, 0xAF, 0xCE, 0x28, 0x84, 0xAB, 0xA5, 0xE9, 0x94, 0x09, 0x95, 0x09, 0x95, 0x66, 0x84, 0x91, 0xEF, 0xFC, 0xFF, 0xD3, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF, 0x09, 0xA5, 0xC3, 0x52, 0xA4, 0x4A, 0x87, 0x6B, 0x4B, 0xA5, 0x64, 0x4A, 0xA8, 0x94, 0xE4, 0x5A, 0x2B, 0xA5, 0xAB, 0xB5, 0x66, 0x73, 0x29, 0xAD, 0x8B, 0xBD, 0x25, 0x6B, 0xB0, 0xF7, 0x8E, 0xD6, 0xA9, 0x9C,
+    0x46, 0x6B, 0x66, 0x73, 0x0A, 0xA5, 0x6D, 0xCE, 0x6C, 0xB5, 0x48, 0x94, 0xC8, 0xA4, 0xCE, 0xE6, 0x6E, 0xDE, 0xEA, 0xAC, 0xCC, 0xCD, 0x0F, 0xE7, 0x6D, 0xD6, 0x07, 0x8C, 0xC9, 0xA4, 0x8F, 0xDE, 0x10, 0xEF, 0x8C, 0xBD, 0x07, 0x8C, 0xAB, 0xBD, 0x8E, 0xDE, 0xA8, 0xA4, 0x08, 0x8C, 0x68, 0x94, 0xA9, 0x9C, 0xD3, 0xFF, 0x8D, 0xDE, 0xA8, 0xAC, 0xEC, 0xE5, 0xF7, 0xFF, 0xF9, 0xFF, 0xCF, 0xFE,
+    0x2A, 0xBD, 0x90, 0xFF, 0xD1, 0xFF, 0x30, 0xF7, 0x6A, 0xBD, 0xB1, 0xFF, 0xF4, 0xFF, 0xD0, 0xEE, 0xEF, 0xF6, 0x10, 0xEF, 0xCB, 0xCD, 0x6A, 0xBD, 0x68, 0x94, 0xE7, 0x83, 0x2A, 0xB5, 0x8E, 0xDE, 0x84, 0x7B, 0x08, 0x84, 0x2D, 0xCE, 0xCB, 0xBD, 0x26, 0x84, 0xA8, 0x8C, 0x6A, 0xAD, 0xED, 0xBD, 0xA8, 0x8C, 0x66, 0x8C, 0x06, 0x7C, 0x09, 0x9D, 0x27, 0x84, 0x09, 0x9D, 0x06, 0x7C, 0x2A, 0x9D,
+    0x43, 0x42, 0xE9, 0x9C, 0x25, 0x63, 0x06, 0x63, 0xC9, 0x94, 0xCB, 0xB5, 0x8C, 0xB5, 0xE4, 0x5A, 0xE5, 0x5A, 0x29, 0x8C, 0x0F, 0xDF, 0x0C, 0xC6, 0x08, 0x8C, 0x66, 0x73, 0x88, 0x94, 0xCE, 0xE6, 0xAE, 0xD6, 0xC7, 0x7B, 0x28, 0x84, 0x0A, 0xAD, 0xCC, 0xC5, 0xF4, 0xFF, 0xC9, 0xA4, 0xC9, 0xAC, 0xA8, 0x94, 0x0A, 0xAD, 0xF3, 0xFF, 0x89, 0x9C, 0xAC, 0xBD, 0x27, 0x8C, 0xE9, 0xA4, 0x90, 0xF7,
+    0x27, 0x8C, 0x09, 0xAD, 0x8A, 0xAD, 0x2A, 0xB5, 0xF3, 0xFF, 0x30, 0xEF, 0x28, 0x8C, 0x89, 0x9C, 0xCC, 0xBD, 0xD2, 0xFF, 0xCC, 0xCD, 0x09, 0xBD, 0x4E, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x4A, 0xC5, 0x88, 0xA4, 0x29, 0xBD, 0xF7, 0xFF, 0x2D, 0xCE, 0x09, 0xA5, 0x6D, 0xDE, 0xF3, 0xFF, 0xF7, 0xFF, 0xAC, 0xC5, 0xE8, 0xA4, 0xE8, 0xAC, 0xD2, 0xFF, 0xC9, 0x9C, 0x47, 0x8C, 0x28, 0x8C,
+    0x27, 0x8C, 0xAE, 0xD6, 0x06, 0x84, 0xEF, 0xDE, 0x48, 0x84, 0x88, 0x8C, 0x8A, 0xAD, 0x8B, 0xA5, 0x6E, 0xCE, 0xA9, 0x8C, 0xE6, 0x73, 0xAB, 0xB5, 0xC9, 0x94, 0x2C, 0xBE, 0xC5, 0x73, 0x88, 0x8C, 0xA4, 0x4A, 0xCB, 0x9C, 0x46, 0x63, 0x0C, 0x9D, 0x67, 0x6B, 0x66, 0x6B, 0x05, 0x63, 0x05, 0x5B, 0x05, 0x63, 0x85, 0x6B, 0xC3, 0x52, 0x8D, 0xBD, 0xA9, 0x94, 0x0A, 0xA5, 0xF2, 0xE6, 0x45, 0x6B,
+    0x4E, 0xC6, 0x08, 0x84, 0xCA, 0xA4, 0x8A, 0xB5, 0x2D, 0xCE, 0x68, 0x94, 0x47, 0x9C, 0x6D, 0xDE, 0x68, 0x94, 0x47, 0x94, 0x0B, 0xC6, 0x4A, 0xAD, 0xB0, 0xDE, 0x28, 0x94, 0xB6, 0xF7, 0x47, 0x94, 0xC8, 0xA4, 0xF0, 0xE6, 0xCA, 0xA4, 0xEC, 0xD5, 0xF3, 0xFF, 0xFC, 0xFF, 0x89, 0xA4, 0xA9, 0x94, 0xB3, 0xF7, 0x29, 0xB5, 0xAB, 0xCD, 0x89, 0xAC, 0xAB, 0xD5, 0xB0, 0xF6, 0xAE, 0xFE, 0xD3, 0xFF,
+    0x8C, 0xCD, 0x4B, 0xBD, 0x2D, 0xD6, 0x92, 0xFF, 0x09, 0xAD, 0x09, 0xA5, 0xF3, 0xFF, 0x6A, 0xB5, 0xCB, 0xC5, 0x6D, 0xD6, 0xA8, 0x9C, 0xC8, 0xA4, 0x2A, 0xA5, 0xA8, 0x94, 0xC6, 0x7B, 0x8B, 0xA5, 0xAE, 0xCE, 0xA6, 0x73, 0xE7, 0x83, 0x27, 0x7C, 0xA9, 0x94, 0x68, 0x84, 0xE9, 0x8C, 0xA5, 0x6B, 0x6B, 0x9D, 0x88, 0x84, 0xE5, 0x73, 0x6A, 0xA5, 0xE9, 0x9C, 0x09, 0x9D, 0x06, 0x7C, 0x6A, 0xA5,
+    0xE6, 0x5A, 0x0F, 0xBE, 0xE5, 0x5A, 0xAA, 0x94, 0x05, 0x5B, 0x65, 0x63, 0x26, 0x63, 0x25, 0x63, 0x83, 0x52, 0x86, 0x73, 0xF5, 0xFF, 0x6B, 0xAD, 0x49, 0x94, 0xA6, 0x7B, 0x09, 0xA5, 0xE7, 0x83, 0xA9, 0x94, 0x47, 0x84, 0x8B, 0xB5, 0xC8, 0xAC, 0xA7, 0xA4, 0x51, 0xFF, 0x4A, 0xC5, 0x4D, 0xD6, 0x27, 0x8C, 0x2C, 0xD6, 0x2D, 0xD6, 0x47, 0x8C, 0x2A, 0xB5, 0x0F, 0xE7, 0xAF, 0xDE, 0xA9, 0xA4,
+    0xE9, 0xAC, 0xF3, 0xFF, 0x87, 0x9C, 0xEF, 0xFE, 0xF6, 0xFF, 0xFF, 0xFF, 0x0A, 0xBD, 0xC9, 0x9C, 0xEA, 0xA4, 0x4B, 0xBD, 0xB6, 0xFF, 0x89, 0xA4, 0x50, 0xFF, 0x4A, 0xC5, 0x2A, 0xC5, 0x0D, 0xE6, 0x0F, 0xEF, 0xA8, 0xA4, 0xA9, 0xA4, 0x11, 0xEF, 0x70, 0xF7, 0xEA, 0xAC, 0xF0, 0xEE, 0x30, 0xF7, 0xCE, 0xE6, 0x6B, 0xC5, 0x88, 0xA4, 0x29, 0xB5, 0x68, 0x94, 0x27, 0x8C, 0xF4, 0xFF, 0xF9, 0xFF,
+    0xCD, 0xBD, 0xE7, 0x73, 0xC8, 0x9C, 0xA9, 0xAD, 0x69, 0x8C, 0x68, 0x84, 0xC9, 0x84, 0x05, 0x74, 0x4A, 0x9D, 0xE9, 0x94, 0x09, 0x95, 0xC8, 0x8C, 0xE9, 0x94, 0x47, 0x84, 0x4A, 0xA5, 0xE9, 0x9C, 0x48, 0x84, 0x45, 0x63, 0xA7, 0x6B, 0x66, 0x6B, 0x26, 0x63, 0x05, 0x63, 0xA6, 0x73, 0x2C, 0xBE, 0xC2, 0x5A, 0xC8, 0x7B, 0x30, 0xDF, 0xE9, 0xA4, 0xC6, 0x7B, 0x48, 0x8C, 0x87, 0x9C, 0xA7, 0x9C,
+    0x68, 0x94, 0x89, 0x94, 0x07, 0x94, 0x6C, 0xDE, 0xB2, 0xFF, 0x50, 0xFF, 0xEE, 0xFE, 0xD2, 0xFF, 0xEF, 0xE6, 0xE9, 0xA4, 0xA9, 0x9C, 0x68, 0x94, 0xEF, 0xE6, 0xC8, 0xA4, 0x4D, 0xCE, 0x92, 0xF7, 0xCE, 0xE6, 0x4A, 0xBD, 0x2D, 0xC6, 0x2D, 0xDE, 0x50, 0xF7, 0xFF, 0xFF, 0x0A, 0xB5, 0x88, 0x9C, 0xEB, 0xBD, 0xA8, 0xAC, 0xEC, 0xD5, 0x0A, 0xB5, 0x09, 0xB5, 0xEF, 0xEE, 0x8B, 0xC5, 0x6B, 0xC5,
+    0x88, 0xA4, 0x50, 0xF7, 0x48, 0x9C, 0xF5, 0xFF, 0x6B, 0xBD, 0x71, 0xFF, 0xF3, 0xFF, 0xAF, 0xF6, 0x2C, 0xDE, 0x6A, 0xC5, 0x4D, 0xDE, 0x88, 0xA4, 0xCD, 0xCD, 0xB1, 0xF7, 0x2C, 0xCE, 0x48, 0x94, 0xEA, 0x9C, 0xEF, 0xCE, 0x30, 0xEF, 0x06, 0x7C, 0x68, 0x8C, 0x68, 0x84, 0x87, 0x84, 0x47, 0x7C, 0xE9, 0x8C, 0x67, 0x84, 0xC8, 0x8C, 0x09, 0x95, 0x0A, 0x9D, 0x88, 0x8C, 0x89, 0x8C, 0xE9, 0x9C,
+    0xC7, 0x73, 0x46, 0x6B, 0x46, 0x63, 0x09, 0xA5, 0xAF, 0xD6, 0x30, 0xE7, 0x2E, 0xC6, 0xAC, 0xB5, 0x6D, 0xCE, 0x4B, 0xAD, 0x08, 0x84, 0x47, 0x94, 0x6B, 0xAD, 0x10, 0xE7, 0xF2, 0xFF, 0xA8, 0x9C, 0x6B, 0xBD, 0xFF, 0xFF, 0xB4, 0xFF, 0xB2, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0x0C, 0xCE, 0xCC, 0xC5, 0xC8, 0x9C, 0x50, 0xEF, 0xCA, 0xA4, 0x6B, 0xB5, 0xAB, 0xBD, 0xAA, 0xBD,
+    0x87, 0x9C, 0xAC, 0xC5, 0x67, 0x94, 0x2A, 0xB5, 0x91, 0xF7, 0xF8, 0xFF, 0x89, 0x9C, 0xAA, 0x9C, 0xCF, 0xDE, 0x51, 0xF7, 0x6B, 0xC5, 0x89, 0xA4, 0x67, 0x9C, 0xF3, 0xFF, 0xE8, 0xAC, 0x09, 0xAD, 0x68, 0x94, 0xA9, 0xA4, 0xB2, 0xFF, 0x4F, 0xD6, 0x0A, 0xAD, 0xAF, 0xE6, 0xFD, 0xFF, 0xFD, 0xFF, 0xF9, 0xFF, 0x0C, 0xE6, 0x4B, 0xBD, 0xEF, 0xE6, 0xB3, 0xFF, 0x4A, 0xAD, 0xDB, 0xF7, 0xFF, 0xFF,
+    0x6D, 0xD6, 0x07, 0x84, 0x35, 0xE7, 0xFF, 0xFF, 0xCF, 0xE6, 0xA8, 0x94, 0xE5, 0x73, 0xC9, 0x8C, 0xE9, 0x8C, 0x4A, 0xA5, 0xA9, 0x8C, 0xE9, 0x8C, 0x88, 0x8C, 0x88, 0x84, 0x0A, 0x9D, 0x47, 0x84, 0x0D, 0xC6, 0xA7, 0x73, 0xC4, 0x5A, 0x89, 0xA4, 0xDD, 0xFF, 0x0F, 0xDF, 0x26, 0x84, 0x07, 0x84, 0xD1, 0xE6, 0x2E, 0xCE, 0x91, 0xF7, 0x2C, 0xC6, 0x2F, 0xE7, 0x2B, 0xAD, 0x4E, 0xE6, 0xF3, 0xFF,
+    0x8B, 0xAD, 0x88, 0x94, 0xC9, 0xAC, 0xF2, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x6D, 0xF6, 0xC9, 0xA4, 0xE8, 0xA4, 0xF4, 0xFF, 0x6F, 0xD6, 0x47, 0x94, 0x09, 0xA5, 0x4A, 0xAD, 0xF3, 0xFF, 0xA8, 0x9C, 0x2C, 0xCE, 0x67, 0x9C, 0x11, 0xEF, 0xF8, 0xFF, 0x6E, 0xD6, 0x88, 0x94, 0x68, 0x94, 0xE9, 0xAC, 0xF4, 0xFF, 0xEC, 0xCD, 0x2B, 0xB5, 0xEC, 0xC5, 0x67, 0x9C, 0xF6, 0xFF, 0x47, 0x94,
+    0x4B, 0xB5, 0x07, 0x8C, 0x05, 0x8C, 0xF4, 0xFF, 0x2A, 0xB5, 0x4B, 0xBD, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFE, 0xD0, 0xEE, 0xEA, 0xAC, 0xB6, 0xFF, 0x8D, 0xCE, 0xEF, 0xDE, 0x07, 0x84, 0xEA, 0xA4, 0x91, 0xD6, 0xC6, 0x7B, 0x48, 0x8C, 0xA9, 0x8C, 0xFE, 0xFF, 0x8B, 0xB5, 0x68, 0x84, 0xE8, 0x8C, 0x4A, 0x9D, 0x67, 0x7C, 0xAB, 0xB5, 0x88, 0x8C, 0x88, 0x84, 0x67, 0x84, 0x88, 0x84,
+    0xA7, 0x73, 0x46, 0x63, 0x25, 0x5B, 0xE8, 0x7B, 0x07, 0x84, 0xA9, 0x94, 0xC7, 0x73, 0x07, 0x7C, 0x6D, 0xAD, 0xCC, 0xC5, 0x93, 0xF7, 0xA9, 0x9C, 0x2B, 0xAD, 0x4D, 0xCE, 0xAA, 0xBD, 0xC8, 0x9C, 0x27, 0x84, 0x68, 0x94, 0x48, 0x9C, 0xCF, 0xEE, 0xAE, 0xFE, 0x70, 0xFF, 0x6D, 0xF6, 0x4A, 0xCD, 0x89, 0xA4, 0x0F, 0xE7, 0xCB, 0xBD, 0xA9, 0x94, 0x4D, 0xC6, 0xEF, 0xD6, 0x6E, 0xC6, 0x2D, 0xBE,
+    0x68, 0x94, 0x52, 0xEF, 0xCC, 0xBD, 0x6E, 0xE6, 0xAC, 0xCD, 0xAD, 0xCE, 0x68, 0x94, 0x68, 0x94, 0xAC, 0xAD, 0xAC, 0xC5, 0xCC, 0xCD, 0x2B, 0xAD, 0x68, 0x9C, 0xAC, 0xBD, 0xAC, 0xB5, 0x27, 0x94, 0x2D, 0xCE, 0x2B, 0xAD, 0x48, 0x94, 0xA8, 0x9C, 0x6D, 0xCE, 0x8C, 0xC5, 0xB0, 0xF6, 0x10, 0xFF, 0xD2, 0xFF, 0xEC, 0xED, 0x0A, 0xB5, 0xEA, 0xAC, 0xE9, 0xA4, 0x4B, 0xAD, 0xC7, 0x83, 0xEC, 0xBD,
+    0xA8, 0x94, 0x86, 0x73, 0xA6, 0x73, 0xA5, 0x73, 0x27, 0x7C, 0x07, 0x74, 0x07, 0x74, 0x88, 0x7C, 0x88, 0x84, 0xA8, 0x84, 0x67, 0x7C, 0xA8, 0x8C, 0x68, 0x84, 0x88, 0x84, 0x47, 0x7C, 0x27, 0x7C, 0xA7, 0x73, 0x47, 0x6B, 0xE9, 0x94, 0xC6, 0x73, 0xE7, 0x7B, 0xCA, 0x9C, 0xE7, 0x7B, 0xF4, 0xFF, 0x0A, 0xA5, 0x2B, 0xAD, 0x47, 0x84, 0xF2, 0xFF, 0x6B, 0xB5, 0xCB, 0xBD, 0x4A, 0xAD, 0x09, 0xA5,
+    0xB2, 0xF7, 0x48, 0x8C, 0x2A, 0xAD, 0x2D, 0xCE, 0x4D, 0xD6, 0x8F, 0xE6, 0xAB, 0xCD, 0x6A, 0xBD, 0x2F, 0xEF, 0x2D, 0xCE, 0xCC, 0xBD, 0x4D, 0xCE, 0x50, 0xE7, 0xCE, 0xCE, 0x0C, 0xC6, 0x0D, 0xCE, 0xEF, 0xEE, 0xCC, 0xCD, 0xEC, 0xC5, 0xCF, 0xF6, 0x32, 0xFF, 0xEE, 0xE6, 0xA9, 0xA4, 0x48, 0x8C, 0x4D, 0xCE, 0xA5, 0x83, 0x2D, 0xDE, 0xA9, 0x9C, 0x67, 0x9C, 0xCF, 0xE6, 0x0B, 0xAD, 0x89, 0x9C,
+    0x08, 0x8C, 0xCE, 0xDE, 0x88, 0x9C, 0x28, 0x94, 0x47, 0x94, 0x0F, 0xE7, 0x4B, 0xC5, 0xE9, 0xBC, 0xCC, 0xCD, 0x6E, 0xE6, 0x4F, 0xD6, 0x27, 0x8C, 0x27, 0x8C, 0xEB, 0xBD, 0x8C, 0xAD, 0x65, 0x6B, 0xA7, 0x73, 0xEA, 0x9C, 0x48, 0x8C, 0x65, 0x6B, 0xC6, 0x73, 0xC6, 0x6B, 0xCA, 0x94, 0x47, 0x7C, 0x68, 0x84, 0xA8, 0x84, 0x48, 0x7C, 0x88, 0x84, 0x47, 0x7C, 0x68, 0x84, 0x47, 0x7C, 0x88, 0x84,
+    0x52, 0xEF, 0x28, 0x84, 0xFF, 0xFF, 0xC8, 0x94, 0x68, 0x94, 0x2F, 0xEF, 0xA9, 0x94, 0x89, 0x94, 0xCC, 0xC5, 0x89, 0xBD, 0xF7, 0xFF, 0xF4, 0xFF, 0x0A, 0xA5, 0x2D, 0xCE, 0x70, 0xEF, 0x8B, 0xB5, 0x48, 0x84, 0x08, 0x84, 0xAF, 0xDE, 0xEB, 0xBD, 0xCC, 0xC5, 0x2A, 0xB5, 0xCC, 0xC5, 0x50, 0xEF, 0xA9, 0x9C, 0xA8, 0x94, 0xAB, 0xB5, 0xF4, 0xFF, 0x30, 0xDF, 0xF5, 0xEF, 0xCF, 0xD6, 0xAC, 0xB5,
+    0xAB, 0xC5, 0x4D, 0xCE, 0x8B, 0xBD, 0xD5, 0xFF, 0xFF, 0xFF, 0x91, 0xFF, 0xC9, 0xAC, 0x89, 0x94, 0xCA, 0xA4, 0xAE, 0xD6, 0xF8, 0xFF, 0xEA, 0xAC, 0x6B, 0xB5, 0x30, 0xEF, 0x0B, 0xAD, 0xC9, 0x9C, 0x89, 0x9C, 0x85, 0x7B, 0x87, 0x94, 0x48, 0x94, 0x07, 0x8C, 0x27, 0x8C, 0x4D, 0xDE, 0xCA, 0xAC, 0xC9, 0xAC, 0xC9, 0xA4, 0x2E, 0xD6, 0xE7, 0x83, 0xC6, 0x7B, 0x2B, 0xA5, 0xC6, 0x7B, 0x04, 0x63,
+    0x44, 0x63, 0xC7, 0x7B, 0xA7, 0x73, 0x07, 0x7C, 0x48, 0x84, 0x27, 0x7C, 0xE6, 0x73, 0x8A, 0xA5, 0x48, 0x84, 0x68, 0x84, 0x27, 0x7C, 0x68, 0x84, 0x68, 0x84, 0xA9, 0x8C, 0x07, 0x7C, 0x48, 0x84, 0xF8, 0xFF, 0xA9, 0x9C, 0x10, 0xE7, 0xCC, 0xC5, 0x29, 0xAD, 0xEB, 0xD5, 0x71, 0xF7, 0x71, 0xF7, 0xEE, 0xEE, 0xD0, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x2D, 0xCE, 0x0C, 0xC6, 0xEC, 0xC5, 0xAE, 0xCE,
+    0x88, 0x8C, 0xE6, 0x83, 0xCC, 0xC5, 0xF0, 0xDE, 0xEC, 0xC5, 0x6B, 0xB5, 0xD2, 0xFF, 0xA7, 0xA4, 0xA9, 0x94, 0x4D, 0xC6, 0x69, 0xAD, 0x0F, 0xD7, 0xFF, 0xFF, 0xB1, 0xDF, 0xCF, 0xDE, 0xF2, 0xFF, 0x8A, 0xBD, 0x8E, 0xDE, 0x2D, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x4B, 0xB5, 0xE9, 0xA4, 0x4B, 0xAD, 0xF4, 0xFF, 0xE9, 0xAC, 0x0B, 0xAD, 0x4E, 0xCE, 0xE7, 0x8B, 0x0D, 0xC6, 0x89, 0x94,
+    0x27, 0x8C, 0xC9, 0x9C, 0xEB, 0xC5, 0xEB, 0xC5, 0x89, 0x9C, 0xC6, 0x7B, 0x07, 0x8C, 0x73, 0xEF, 0x68, 0x94, 0x07, 0x8C, 0xC9, 0x9C, 0x68, 0x94, 0xA7, 0x94, 0xC6, 0x7B, 0x26, 0x84, 0x65, 0x6B, 0xEC, 0xB5, 0x2A, 0xA5, 0x65, 0x63, 0xA6, 0x6B, 0x65, 0x63, 0xC7, 0x73, 0x47, 0x7C, 0x07, 0x74, 0xC6, 0x73, 0x4A, 0x9D, 0xA8, 0x8C, 0x89, 0x8C, 0x28, 0x7C, 0x47, 0x7C, 0x68, 0x8C, 0x47, 0x84,
+    0x4C, 0xD6, 0x29, 0xAD, 0x2A, 0xB5, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xEF, 0xEE, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xE7, 0xD4, 0xFF, 0x2D, 0xCE, 0x8C, 0xB5, 0xEB, 0xBD, 0x27, 0x84, 0x4D, 0xCE, 0xEC, 0xBD, 0xEC, 0xCD, 0x11, 0xE7, 0xF5, 0xFF, 0x6E, 0xD6, 0x87, 0x9C, 0xCC, 0xBD, 0xC6, 0x94, 0xF5, 0xFF, 0x8A, 0xAD, 0x2A, 0xA5, 0x8A, 0xAD, 0xEF, 0xDE, 0xF4, 0xFF,
+    0x6B, 0xB5, 0x2D, 0xD6, 0xAB, 0xCD, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xEA, 0xAC, 0x89, 0x9C, 0xEC, 0xC5, 0xF4, 0xFF, 0x8B, 0xC5, 0xAA, 0xA4, 0xE9, 0xAC, 0xA7, 0xA4, 0xF2, 0xFF, 0x07, 0x8C, 0xAF, 0xD6, 0xC5, 0x83, 0x68, 0x94, 0xF2, 0xFF, 0x6D, 0xCE, 0x2B, 0xAD, 0xE7, 0x8B, 0x84, 0x83, 0xF3, 0xFF, 0x49, 0x94, 0x8A, 0x9C, 0xA6, 0x7B, 0x89, 0x94, 0x05, 0x84, 0xC7, 0x7B, 0x69, 0x8C,
+    0x0D, 0xB6, 0x27, 0x84, 0xE4, 0x62, 0xCA, 0x94, 0x0A, 0x95, 0xC6, 0x73, 0xE6, 0x73, 0x06, 0x74, 0x64, 0x63, 0x48, 0x7C, 0x07, 0x74, 0x48, 0x84, 0xC5, 0x73, 0x88, 0x84, 0x48, 0x84, 0x27, 0x7C, 0x27, 0x8C, 0xAE, 0xDE, 0xFF, 0xFF, 0x91, 0xFF, 0x8D, 0xE6, 0xF9, 0xFF, 0xCE, 0xEE, 0xFF, 0xFF, 0xF8, 0xFF, 0xDA, 0xFF, 0x2C, 0xCE, 0x13, 0xE7, 0x2C, 0xCE, 0xEC, 0xC5, 0x88, 0x94, 0x26, 0x8C,
+    0xF2, 0xF7, 0x2A, 0x9D, 0x2A, 0xAD, 0xF0, 0xE6, 0x4B, 0xCE, 0x2D, 0xCE, 0x8C, 0xBD, 0x0C, 0xC6, 0x70, 0xEF, 0x8F, 0xCE, 0xF5, 0xFF, 0xAB, 0xAD, 0x0F, 0xDF, 0xEB, 0xBD, 0xF4, 0xFF, 0x6A, 0xAD, 0xF4, 0xFF, 0x2D, 0xD6, 0x2A, 0xBD, 0x6B, 0xCD, 0x6D, 0xE6, 0x8E, 0xDE, 0x68, 0x94, 0x68, 0x94, 0x8C, 0xB5, 0x27, 0x8C, 0x4E, 0xDE, 0x68, 0x94, 0x86, 0x83, 0x2C, 0xCE, 0x4C, 0xB5, 0xA9, 0xA4,
+    0x87, 0x7B, 0x0F, 0xE7, 0xC9, 0x9C, 0xC6, 0x8B, 0xE7, 0x83, 0x6E, 0xCE, 0x08, 0x8C, 0x24, 0x6B, 0xA6, 0x7B, 0xAB, 0xB5, 0x86, 0x7B, 0xE8, 0x83, 0x65, 0x73, 0xCB, 0xB5, 0xE8, 0x83, 0xE7, 0x7B, 0x2E, 0xBE, 0xEA, 0x9C, 0xC8, 0x73, 0xA5, 0x73, 0xE7, 0x73, 0xC9, 0x8C, 0xE7, 0x73, 0x07, 0x74, 0x0A, 0x9D, 0x65, 0x63, 0x27, 0x7C, 0xA3, 0x4A, 0x07, 0x7C, 0x06, 0x74, 0x48, 0x84, 0x27, 0x7C,
+    0xFF, 0xFF, 0x49, 0xAD, 0x8A, 0xB5, 0xF6, 0xDF, 0xED, 0xC5, 0xFF, 0xFF, 0xFE, 0xFF, 0xF5, 0xFF, 0xEB, 0xD5, 0x28, 0xBD, 0xCF, 0xF7, 0x27, 0x8C, 0x8A, 0xB5, 0x8B, 0xB5, 0x0F, 0xE7, 0x68, 0x8C, 0x4A, 0xA5, 0x07, 0x84, 0xCD, 0xC5, 0xF4, 0xFF, 0x2D, 0xCE, 0x2D, 0xDE, 0xAE, 0xE6, 0xF2, 0xFF, 0x88, 0x94, 0xFF, 0xFF, 0xCB, 0xC5, 0xA8, 0x94, 0xAF, 0xD6, 0x48, 0x94, 0x6E, 0xD6, 0xEC, 0xBD,
+    0x4F, 0xEF, 0x4D, 0xDE, 0xAB, 0xBD, 0x09, 0xBD, 0xF3, 0xFF, 0x6A, 0xB5, 0x48, 0x9C, 0x48, 0x94, 0x2A, 0xB5, 0xF3, 0xFF, 0xD3, 0xFF, 0xC9, 0xA4, 0x2D, 0xD6, 0x2F, 0xEF, 0x2B, 0xAD, 0xE8, 0x8B, 0x85, 0x7B, 0xCE, 0xE6, 0x66, 0x73, 0x8B, 0xB5, 0x69, 0x94, 0xC6, 0x83, 0xAB, 0xBD, 0x28, 0x8C, 0x87, 0x7B, 0xAA, 0xA4, 0xCB, 0xB5, 0x04, 0x63, 0xC7, 0x83, 0xEB, 0x9C, 0x6C, 0xAD, 0x87, 0x73,
+    0x05, 0x63, 0x25, 0x63, 0x86, 0x6B, 0x4B, 0xA5, 0x66, 0x6B, 0xA6, 0x6B, 0xE7, 0x73, 0xC8, 0x94, 0x86, 0x6B, 0xC6, 0x6B, 0x07, 0x74, 0x44, 0x63, 0x48, 0x84, 0x27, 0x7C, 0xC6, 0x73, 0x07, 0x74, 0x25, 0x63, 0xC6, 0x83, 0x27, 0x84, 0xC9, 0xA4, 0xCD, 0xEE, 0x4B, 0xBD, 0xE9, 0xA4, 0xC8, 0xA4, 0xD3, 0xFF, 0xEA, 0xCD, 0xCF, 0xD6, 0x48, 0x8C, 0xA5, 0x7B, 0xCE, 0xE6, 0xCB, 0xAD, 0x4B, 0x9D,
+    0x68, 0x8C, 0x4A, 0xAD, 0xF2, 0xFF, 0x8A, 0xBD, 0xAE, 0xE6, 0xFE, 0xFF, 0xFA, 0xFF, 0xCA, 0xCD, 0x88, 0x94, 0xAE, 0xDE, 0xAC, 0xBD, 0x91, 0xF7, 0x47, 0x8C, 0xEB, 0xC5, 0xEC, 0xCD, 0x88, 0x9C, 0xEB, 0xC5, 0x52, 0xEF, 0xEC, 0xBD, 0x2A, 0xBD, 0x70, 0xF7, 0x4A, 0xB5, 0x48, 0x9C, 0x68, 0x94, 0x6A, 0xBD, 0xF3, 0xFF, 0xAF, 0xF6, 0x4B, 0xB5, 0x91, 0xF7, 0xD7, 0xFF, 0xEB, 0xAC, 0x68, 0x9C,
+    0xED, 0xC5, 0x66, 0x6B, 0x0F, 0xEF, 0x86, 0x83, 0x27, 0x8C, 0x65, 0x73, 0xAF, 0xDE, 0xE7, 0x83, 0x28, 0x8C, 0xE4, 0x6A, 0x66, 0x73, 0xAB, 0xB5, 0x49, 0x94, 0xA7, 0x7B, 0x08, 0x84, 0x28, 0x84, 0x4C, 0xAD, 0x26, 0x6B, 0x86, 0x73, 0xE5, 0x5A, 0xEB, 0xBD, 0x85, 0x63, 0x86, 0x6B, 0x28, 0x84, 0xC6, 0x6B, 0x0A, 0x9D, 0xC6, 0x6B, 0x07, 0x7C, 0x07, 0x74, 0x07, 0x7C, 0x88, 0x84, 0x07, 0x7C,
+    0xC7, 0x7B, 0x2B, 0xAD, 0x8E, 0xDE, 0xC9, 0x9C, 0xC8, 0x9C, 0x28, 0x84, 0x85, 0x73, 0xD2, 0xFF, 0x2A, 0xAD, 0xEB, 0xB5, 0x88, 0x8C, 0xE6, 0x7B, 0x4F, 0xF7, 0xA8, 0x9C, 0x9A, 0xEF, 0xC9, 0x94, 0xAA, 0xAD, 0xFF, 0xFF, 0x92, 0xF7, 0xCF, 0xEE, 0xF5, 0xFF, 0xFA, 0xFF, 0xF3, 0xFF, 0x8B, 0xCD, 0x2B, 0xB5, 0x8D, 0xD6, 0x6F, 0xF7, 0x49, 0xAD, 0xC8, 0x94, 0x8B, 0xB5, 0x10, 0xEF, 0xF2, 0xFF,
+    0xC8, 0x9C, 0xCC, 0xBD, 0xC9, 0xA4, 0xEF, 0xEE, 0xF3, 0xFF, 0x6A, 0xBD, 0x27, 0x94, 0x68, 0x9C, 0x51, 0xFF, 0xD2, 0xFF, 0x4D, 0xE6, 0xCA, 0xAC, 0xC9, 0xAC, 0x6A, 0xBD, 0xCE, 0xE6, 0x07, 0x8C, 0xD1, 0xFF, 0xC5, 0x83, 0xF2, 0xFF, 0x66, 0x7B, 0x4D, 0xCE, 0xC5, 0x7B, 0xAA, 0xA4, 0x10, 0xEF, 0xAC, 0xB5, 0x47, 0x8C, 0x66, 0x7B, 0xCB, 0x9C, 0x6A, 0xAD, 0x48, 0x8C, 0xA7, 0x73, 0x25, 0x6B,
+    0x4D, 0xBE, 0x24, 0x6B, 0xC4, 0x5A, 0xA3, 0x52, 0xE7, 0x7B, 0x24, 0x63, 0x66, 0x6B, 0xE4, 0x5A, 0x46, 0x63, 0xA6, 0x6B, 0xB4, 0xF7, 0xA7, 0x6B, 0xA6, 0x6B, 0x27, 0x7C, 0x48, 0x7C, 0xE7, 0x73, 0xAC, 0xB5, 0xCE, 0xBD, 0xC9, 0x9C, 0x8F, 0xCE, 0x04, 0x63, 0xF4, 0xFF, 0x66, 0x6B, 0xCC, 0xC5, 0xE7, 0x7B, 0xE6, 0x7B, 0x45, 0x8C, 0x8F, 0xDE, 0xCB, 0xBD, 0x67, 0x94, 0xA6, 0x7B, 0xA8, 0x9C,
+    0xF3, 0xFF, 0xE6, 0x8B, 0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF6, 0x6D, 0xDE, 0x30, 0xEF, 0x0B, 0xC6, 0xF4, 0xFF, 0xE9, 0xA4, 0x0D, 0xC6, 0x4B, 0xB5, 0x6A, 0xB5, 0xFC, 0xFF, 0x6E, 0xD6, 0xAF, 0xE6, 0xED, 0xC5, 0x6D, 0xD6, 0xF5, 0xFF, 0x4D, 0xCE, 0xC7, 0x8B, 0x28, 0xA4, 0xF7, 0xFF, 0xFB, 0xFF, 0xD2, 0xFF, 0xF3, 0xFF, 0xEB, 0xE5, 0xF4, 0xFF, 0x91, 0xFF, 0x09, 0xA5,
+    0x07, 0x8C, 0x4C, 0xCE, 0x65, 0x73, 0x71, 0xF7, 0xCA, 0xA4, 0x0C, 0xC6, 0x0D, 0xBE, 0xE5, 0x83, 0xFB, 0xFF, 0xAB, 0xC5, 0xE8, 0x83, 0x46, 0x6B, 0xA7, 0x7B, 0xE8, 0x9C, 0x25, 0x6B, 0x22, 0x4A, 0x49, 0x8C, 0x65, 0x73, 0x0F, 0xE7, 0xE4, 0x52, 0x8A, 0x8C, 0xA6, 0x73, 0x65, 0x6B, 0xAC, 0xB5, 0xC7, 0x73, 0x65, 0x63, 0x08, 0x7C, 0xE7, 0x73, 0x8B, 0xA5, 0x27, 0x74, 0x07, 0x7C, 0x28, 0x7C,
+    0x65, 0x6B, 0xAD, 0xB5, 0xC5, 0x52, 0x6A, 0x8C, 0x04, 0x63, 0xC4, 0x5A, 0x87, 0x94, 0xA6, 0x73, 0x08, 0x84, 0x46, 0x6B, 0xFD, 0xFF, 0xEC, 0xB5, 0x44, 0x6B, 0xAA, 0x9C, 0x86, 0x73, 0xCC, 0xBD, 0x88, 0x94, 0xA8, 0xB4, 0xF5, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x10, 0xEF, 0x6D, 0xDE, 0xB4, 0xFF, 0x8C, 0xBD, 0x07, 0x8C, 0xEF, 0xEE, 0x47, 0x94, 0xCE, 0xE6, 0x27, 0x8C, 0xA9, 0xA4, 0xCC, 0xBD,
+    0x30, 0xEF, 0x6A, 0xBD, 0x68, 0x94, 0x08, 0xBD, 0xF3, 0xFF, 0x2B, 0xB5, 0x08, 0x94, 0x68, 0xB4, 0xF3, 0xFF, 0xFF, 0xFF, 0xAE, 0xFE, 0x6D, 0xEE, 0xFF, 0xFF, 0xF3, 0xFF, 0x6E, 0xE6, 0x24, 0x73, 0xC7, 0x7B, 0xD2, 0xFF, 0x49, 0x8C, 0x4C, 0xC6, 0x4A, 0xB5, 0x29, 0xAD, 0x6F, 0xD6, 0x0C, 0xCE, 0x06, 0x9C, 0xC6, 0x8B, 0x2C, 0xC6, 0x66, 0x6B, 0x29, 0x8C, 0x49, 0x8C, 0xEA, 0xA4, 0xA4, 0x52,
+    0xE5, 0x5A, 0x8A, 0x94, 0x25, 0x63, 0x84, 0x52, 0x25, 0x63, 0x86, 0x6B, 0xC6, 0x73, 0x45, 0x63, 0x65, 0x63, 0xA6, 0x6B, 0xE7, 0x6B, 0xA7, 0x73, 0xC6, 0x6B, 0x07, 0x74, 0xA6, 0x6B, 0x07, 0x74, 0x83, 0x4A, 0xC8, 0x73, 0xA4, 0x52, 0x47, 0x6B, 0xC5, 0x5A, 0x66, 0x6B, 0x45, 0x63, 0x24, 0x63, 0x49, 0x8C, 0x25, 0x63, 0xE9, 0x9C, 0x86, 0x6B, 0x24, 0x63, 0x28, 0x8C, 0x2C, 0xBE, 0xC6, 0x7B,
+    0xA8, 0x9C, 0x69, 0xC5, 0xFD, 0xFF, 0xFE, 0xFF, 0xEB, 0xD5, 0x8A, 0xBD, 0x69, 0xBD, 0x6A, 0xB5, 0x6F, 0xD6, 0xAE, 0xDE, 0x0C, 0xD6, 0x50, 0xF7, 0x47, 0x94, 0x0C, 0xCE, 0xA8, 0x9C, 0x93, 0xF7, 0x07, 0x8C, 0x2C, 0xCE, 0xC6, 0x83, 0xC8, 0xB4, 0xF3, 0xFF, 0xE7, 0x8B, 0x08, 0x94, 0x88, 0xB4, 0xF6, 0xFF, 0xF5, 0xFF, 0xCF, 0xFE, 0x4B, 0xC5, 0xFF, 0xFF, 0xF0, 0xF6, 0x90, 0xE6, 0x45, 0x6B,
+    0x2F, 0xDF, 0x05, 0x6B, 0xC5, 0x83, 0x45, 0x73, 0xCB, 0xBD, 0xFF, 0xFF, 0x89, 0xBD, 0xE7, 0x83, 0x04, 0x63, 0x47, 0x73, 0xC3, 0x5A, 0x88, 0x8C, 0xA8, 0x7B, 0x28, 0x8C, 0xE5, 0x62, 0x48, 0x84, 0x27, 0x6B, 0x85, 0x52, 0x47, 0x6B, 0x24, 0x63, 0x67, 0x6B, 0x05, 0x5B, 0x46, 0x63, 0x85, 0x6B, 0x49, 0x84, 0x66, 0x63, 0x86, 0x6B, 0x27, 0x74, 0xA6, 0x6B, 0x48, 0x7C, 0x27, 0x7C, 0x27, 0x7C,
+    0x87, 0x6B, 0xC4, 0x52, 0x84, 0x52, 0xE5, 0x62, 0xC6, 0x7B, 0xE5, 0x5A, 0xE4, 0x5A, 0xA6, 0x73, 0xAE, 0xDE, 0x72, 0xE7, 0x48, 0x8C, 0x05, 0x63, 0x72, 0xEF, 0xF2, 0xFF, 0x8A, 0x95, 0x6A, 0xA5, 0x8F, 0xD6, 0xF1, 0xFF, 0xF7, 0xFF, 0xEC, 0xCD, 0xEC, 0xCD, 0xCE, 0xE6, 0x26, 0x94, 0x52, 0xEF, 0x68, 0x9C, 0xCE, 0xEE, 0x71, 0xFF, 0x10, 0xFF, 0x8B, 0xBD, 0xCC, 0xC5, 0x29, 0xAD, 0x67, 0x94,
+    0x27, 0x8C, 0xA8, 0x9C, 0x08, 0x8C, 0x49, 0xBD, 0xC8, 0xA4, 0xC6, 0x83, 0xE7, 0x93, 0x48, 0xA4, 0xFB, 0xFF, 0xFE, 0xFF, 0x11, 0xFF, 0xCA, 0xAC, 0xAF, 0xF6, 0xAC, 0xD5, 0x0A, 0xB5, 0x07, 0x8C, 0x0D, 0xC6, 0xC3, 0x62, 0x47, 0x8C, 0xE5, 0x6A, 0x2C, 0xC6, 0x4A, 0xBD, 0xF0, 0xE6, 0x87, 0x7B, 0x0A, 0xA5, 0x47, 0x6B, 0xE5, 0x5A, 0xCC, 0xB5, 0x65, 0x73, 0x67, 0x6B, 0xC5, 0x5A, 0x64, 0x4A,
+    0x44, 0x63, 0x64, 0x4A, 0xC5, 0x5A, 0xA5, 0x52, 0xE7, 0x7B, 0x25, 0x5B, 0x46, 0x63, 0x87, 0x6B, 0x66, 0x6B, 0xC7, 0x73, 0xA6, 0x6B, 0xC7, 0x73, 0xE7, 0x73, 0x27, 0x74, 0x68, 0x84, 0x8C, 0xA5, 0x44, 0x4A, 0x83, 0x52, 0xCC, 0xC5, 0xE5, 0x5A, 0x84, 0x52, 0xC4, 0x52, 0x09, 0x84, 0xEB, 0xCD, 0x65, 0x6B, 0xE5, 0x5A, 0x89, 0x8C, 0xC2, 0x62, 0xF6, 0xFF, 0xE9, 0x9C, 0x4C, 0xAE, 0xF0, 0xDE,
+    0xF2, 0xFF, 0xD2, 0xFF, 0x0B, 0xB6, 0x8B, 0xBD, 0xF3, 0xFF, 0x2C, 0xCE, 0x8E, 0xDE, 0x73, 0xEF, 0xF2, 0xFF, 0x4C, 0xE6, 0xFF, 0xFF, 0xFA, 0xFF, 0x70, 0xF7, 0x4A, 0xAD, 0xC9, 0xA4, 0xF3, 0xFF, 0xCC, 0xBD, 0xAB, 0xBD, 0x08, 0x8C, 0x49, 0xB5, 0xF2, 0xFF, 0x48, 0x94, 0x6A, 0x9C, 0x28, 0x9C, 0xF2, 0xFF, 0xF3, 0xFF, 0xAF, 0xF6, 0x28, 0x9C, 0x6A, 0xC5, 0x90, 0xFF, 0x2D, 0xD6, 0x26, 0x6B,
+    0x45, 0x6B, 0xEE, 0xE6, 0xC9, 0xA4, 0x2B, 0xA5, 0x46, 0x73, 0xEC, 0xC5, 0x96, 0xEF, 0x0C, 0xC6, 0x05, 0x63, 0x2B, 0xA5, 0x4C, 0xAD, 0x06, 0x63, 0x6B, 0xAD, 0xEE, 0xBD, 0x03, 0x42, 0x44, 0x4A, 0x67, 0x6B, 0x2A, 0x9D, 0x84, 0x52, 0x23, 0x42, 0x87, 0x73, 0xE9, 0x94, 0xCC, 0xB5, 0x87, 0x6B, 0x46, 0x63, 0xA6, 0x6B, 0x4C, 0xBE, 0x65, 0x63, 0xC7, 0x73, 0x04, 0x53, 0xE9, 0x8C, 0x27, 0x7C,
+    0x2B, 0xAD, 0x84, 0x52, 0xA4, 0x52, 0x04, 0x5B, 0xC5, 0x52, 0xC9, 0x9C, 0x89, 0x94, 0x27, 0x84, 0x86, 0x63, 0x45, 0x63, 0xAA, 0xBD, 0x44, 0x6B, 0xB4, 0xF7, 0x07, 0x7C, 0xEB, 0xA5, 0xAB, 0xB5, 0x08, 0xA5, 0xF4, 0xFF, 0x2C, 0xC6, 0x8B, 0xBD, 0x67, 0x94, 0xF3, 0xFF, 0x8A, 0xBD, 0x11, 0xEF, 0x09, 0xB5, 0xF8, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x8A, 0xBD, 0x4A, 0xAD, 0x0D, 0xCE, 0xF9, 0xFF,
+    0xEE, 0xE6, 0x68, 0x94, 0xE8, 0x8B, 0xAC, 0xC5, 0xF5, 0xFF, 0xEC, 0xCD, 0xC7, 0x83, 0x08, 0x94, 0x8B, 0xCD, 0xF2, 0xFF, 0xD5, 0xFF, 0xC7, 0x83, 0x23, 0x73, 0x46, 0x94, 0x4F, 0xF7, 0x46, 0x73, 0xE4, 0x62, 0xA3, 0x5A, 0x24, 0x6B, 0x0E, 0xE7, 0x26, 0x6B, 0x86, 0x73, 0x45, 0x6B, 0x10, 0xEF, 0x4C, 0xCE, 0xE5, 0x62, 0x84, 0x52, 0x64, 0x52, 0xA5, 0x5A, 0xED, 0xBD, 0x25, 0x63, 0xC6, 0x5A,
+    0x65, 0x52, 0x62, 0x4A, 0x4D, 0xC6, 0x64, 0x4A, 0x06, 0x63, 0x87, 0x6B, 0x8A, 0x8C, 0x0F, 0xE7, 0x87, 0x6B, 0xC7, 0x73, 0x08, 0x7C, 0xA6, 0x73, 0xD2, 0xF7, 0x86, 0x6B, 0xE7, 0x73, 0xC6, 0x73, 0x48, 0x94, 0xC4, 0x52, 0xA5, 0x4A, 0xA4, 0x4A, 0xA5, 0x4A, 0xEC, 0xC5, 0x67, 0x84, 0xA7, 0x6B, 0x04, 0x5B, 0x25, 0x5B, 0xAE, 0xE6, 0xC4, 0x52, 0x2B, 0xA5, 0xE6, 0x7B, 0xF6, 0xFF, 0x6B, 0xB5,
+    0xAE, 0xDE, 0xF8, 0xFF, 0xFE, 0xFF, 0xF4, 0xFF, 0xE6, 0x7B, 0x4A, 0xAD, 0x48, 0x94, 0xF3, 0xFF, 0xEA, 0xB4, 0xF2, 0xFF, 0xF9, 0xFF, 0x8D, 0xE6, 0x6B, 0xB5, 0x8E, 0xD6, 0x4A, 0xB5, 0xEA, 0xAC, 0x6B, 0xBD, 0x68, 0x94, 0x08, 0x8C, 0x48, 0x9C, 0x0A, 0xB5, 0x07, 0x8C, 0xE7, 0x8B, 0xE8, 0x8B, 0xC7, 0x83, 0xD2, 0xFF, 0x53, 0xF7, 0xA7, 0x83, 0x65, 0x7B, 0xB1, 0xFF, 0x4B, 0xAD, 0x05, 0x63,
+    0x04, 0x63, 0x84, 0x5A, 0x25, 0x63, 0xE7, 0x83, 0x25, 0x63, 0x6A, 0xA5, 0x26, 0x63, 0x26, 0x63, 0x64, 0x52, 0xC5, 0x5A, 0xC9, 0x94, 0x28, 0x84, 0x65, 0x52, 0x64, 0x4A, 0xC5, 0x5A, 0x6A, 0x84, 0x44, 0x4A, 0x44, 0x4A, 0x85, 0x52, 0x23, 0x42, 0xE4, 0x5A, 0x47, 0x6B, 0x46, 0x63, 0xE9, 0xA4, 0x68, 0x94, 0x28, 0x84, 0x27, 0x7C, 0x48, 0x84, 0x48, 0x84, 0x27, 0x7C, 0x48, 0x7C, 0xE7, 0x73,
+    0x66, 0x6B, 0x64, 0x42, 0xA5, 0x4A, 0xA4, 0x52, 0xEB, 0xC5, 0xE4, 0x5A, 0xC4, 0x5A, 0x62, 0x4A, 0xC5, 0x62, 0x6C, 0xD6, 0x0E, 0xC6, 0xC5, 0x5A, 0xEA, 0xA4, 0x6F, 0xFF, 0x0B, 0xAD, 0xE9, 0xAC, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF, 0xEE, 0x2A, 0xB5, 0xE7, 0x83, 0x0D, 0xCE, 0x08, 0x8C, 0x09, 0xAD, 0x28, 0x94, 0x4C, 0xD6, 0xED, 0xE6, 0x70, 0xF7, 0x09, 0xA5, 0xAB, 0xBD, 0x8B, 0xBD, 0x6C, 0xE6,
+    0x2E, 0xD6, 0xA9, 0xAC, 0x28, 0x94, 0x27, 0x94, 0xB1, 0xFF, 0x28, 0x94, 0x07, 0x8C, 0xC7, 0x83, 0x07, 0x84, 0x71, 0xFF, 0xAD, 0xC5, 0xA7, 0x7B, 0x45, 0x73, 0x8E, 0xDE, 0xE8, 0x83, 0x05, 0x63, 0x83, 0x52, 0xC3, 0x5A, 0x0C, 0xCE, 0x05, 0x6B, 0x8B, 0xB5, 0xCD, 0xD6, 0x6B, 0xAD, 0xE5, 0x5A, 0x88, 0x84, 0xA4, 0x52, 0x85, 0x52, 0x88, 0x94, 0xE7, 0x7B, 0x03, 0x42, 0x03, 0x42, 0x2C, 0xA5,
+    0x29, 0x84, 0x03, 0x42, 0x65, 0x4A, 0x85, 0x4A, 0x04, 0x63, 0xE6, 0x5A, 0x26, 0x63, 0xCB, 0x9C, 0xFF, 0xFF, 0x94, 0xFF, 0x6C, 0xBD, 0xE8, 0xAC, 0x88, 0x8C, 0xA8, 0x94, 0xFF, 0xFF, 0x4A, 0xA5, 0x64, 0x42, 0x63, 0x4A, 0x08, 0x84, 0x64, 0x4A, 0xA5, 0x52, 0x26, 0x5B, 0x25, 0x63, 0xE3, 0x62, 0x83, 0x52, 0x05, 0x63, 0x08, 0x84, 0xA3, 0x52, 0x07, 0x94, 0x46, 0x6B, 0x48, 0x8C, 0xF6, 0xFF,
+    0xFF, 0xFF, 0x2E, 0xF7, 0xCC, 0xC5, 0xAA, 0xA4, 0x0E, 0xDF, 0xA9, 0x9C, 0x05, 0x8C, 0x48, 0x94, 0x2D, 0xCE, 0xA8, 0x9C, 0x6E, 0xD6, 0x2B, 0xB5, 0xEC, 0xBD, 0x6D, 0xD6, 0xB2, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xEA, 0xB4, 0x89, 0xA4, 0x2A, 0xBD, 0xFB, 0xFF, 0x2D, 0xDE, 0xE7, 0x83, 0xE8, 0x83, 0xC8, 0x83, 0x6F, 0xDE, 0x69, 0x9C, 0x66, 0x73, 0x66, 0x7B, 0x8C, 0xC5, 0x05, 0x6B, 0xC4, 0x5A,
+    0xE4, 0x62, 0xE7, 0x83, 0x05, 0x63, 0xE5, 0x62, 0x2A, 0xAD, 0x47, 0x8C, 0xF3, 0xFF, 0xEA, 0x9C, 0xA4, 0x52, 0x88, 0x8C, 0x44, 0x4A, 0x85, 0x52, 0x05, 0x5B, 0x8A, 0x8C, 0x23, 0x4A, 0x85, 0x52, 0xA5, 0x52, 0x4C, 0x9D, 0x24, 0x42, 0x24, 0x42, 0xC5, 0x52, 0x47, 0x84, 0x06, 0x63, 0x86, 0x6B, 0x67, 0x94, 0x2D, 0xE6, 0xFE, 0xFF, 0x4C, 0xD6, 0x4B, 0xAD, 0x88, 0x94, 0x2B, 0xA5, 0xC7, 0x9C,
+    0x44, 0x42, 0x44, 0x4A, 0x09, 0xAD, 0x85, 0x52, 0x84, 0x52, 0x06, 0x5B, 0xA4, 0x52, 0xD4, 0xFF, 0xA3, 0x52, 0xC4, 0x5A, 0x26, 0x6B, 0x86, 0x73, 0x8A, 0xBD, 0x86, 0x73, 0x07, 0x84, 0x2D, 0xDE, 0xEB, 0xCD, 0x49, 0xAD, 0x47, 0x84, 0xE7, 0x83, 0x66, 0x73, 0xC7, 0x7B, 0xC6, 0x7B, 0x69, 0x94, 0xA6, 0x7B, 0x88, 0x8C, 0x4A, 0xAD, 0xE9, 0x9C, 0xAB, 0xB5, 0x4D, 0xD6, 0xB1, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xE9, 0xBC, 0xA9, 0xAC, 0xEC, 0xDD, 0xFF, 0xFF, 0xAC, 0xD5, 0x28, 0x94, 0xA7, 0x7B, 0xA7, 0x7B, 0x70, 0xFF, 0x69, 0x9C, 0x45, 0x6B, 0xE4, 0x62, 0x06, 0x6B, 0x86, 0x7B, 0xE5, 0x62, 0xE4, 0x5A, 0xE4, 0x5A, 0x05, 0x6B, 0x06, 0x63, 0x29, 0xAD, 0x49, 0xC6, 0xFB, 0xFF, 0xA6, 0x73, 0x26, 0x63, 0xA5, 0x52, 0x64, 0x4A, 0x24, 0x42, 0x4B, 0xA5, 0x24, 0x42, 0x44, 0x4A, 0x44, 0x4A,
+    0x24, 0x42, 0xE7, 0x7B, 0x24, 0x42, 0x24, 0x42, 0x65, 0x4A, 0x84, 0x4A, 0xC5, 0x52, 0x26, 0x5B, 0xC8, 0x7B, 0x4A, 0xB5, 0xFF, 0xFF, 0xF2, 0xFF, 0x6A, 0xB5, 0x2A, 0xAD, 0x6B, 0xA5, 0xAB, 0xB5, 0xC7, 0x73, 0x23, 0x4A, 0x44, 0x42, 0x85, 0x4A, 0x84, 0x4A, 0x0B, 0xA5, 0x0C, 0xBE, 0xC8, 0x7B, 0x83, 0x52, 0x05, 0x6B, 0x30, 0xF7, 0xF5, 0xFF, 0x2B, 0xAD, 0x46, 0x6B, 0x0A, 0xB5, 0x88, 0x9C,
+    0x72, 0xF7, 0xAC, 0xB5, 0x28, 0x7C, 0xF0, 0xE6, 0x11, 0xE7, 0x71, 0xF7, 0x85, 0x7B, 0x68, 0x8C, 0xA6, 0x73, 0x07, 0x84, 0xF3, 0xFF, 0xB4, 0xF7, 0x8B, 0xB5, 0xAB, 0xC5, 0xF5, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xEA, 0xB4, 0xEA, 0xBC, 0xFA, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x28, 0x9C, 0xC7, 0x83, 0x48, 0x94, 0xF6, 0xFF, 0x48, 0x94, 0x46, 0x73, 0xE4, 0x62, 0xA8, 0x9C, 0xAE, 0xE6, 0xA5, 0x5A,
+    0x05, 0x63, 0x8B, 0xB5, 0xEB, 0x9C, 0xF5, 0xFF, 0x47, 0x8C, 0x25, 0x84, 0x91, 0xFF, 0x69, 0x8C, 0x8B, 0xB5, 0xE5, 0x5A, 0xA9, 0x8C, 0x44, 0x4A, 0x4C, 0x84, 0x2B, 0xA5, 0x66, 0x6B, 0x45, 0x4A, 0x44, 0x42, 0x65, 0x4A, 0x2B, 0xA5, 0x23, 0x3A, 0x24, 0x42, 0x64, 0x42, 0xA5, 0x52, 0x10, 0xDF, 0x69, 0x94, 0xC7, 0x83, 0x4B, 0xBD, 0x29, 0xAD, 0xFF, 0xFF, 0x4A, 0xAD, 0xA9, 0x94, 0xC9, 0x94,
+    0x92, 0xF7, 0x64, 0x4A, 0x64, 0x4A, 0xC6, 0x52, 0x42, 0x4A, 0x6E, 0xCE, 0x84, 0x52, 0x46, 0x6B, 0xA5, 0x5A, 0xD4, 0xFF, 0xF8, 0xFF, 0xC9, 0x94, 0x8C, 0xB5, 0x65, 0x6B, 0x25, 0x6B, 0xA6, 0x73, 0xA6, 0x73, 0x06, 0x7C, 0xF4, 0xFF, 0xE8, 0x83, 0x66, 0x6B, 0x86, 0x73, 0xB0, 0xD6, 0xC6, 0x7B, 0x45, 0x6B, 0xC6, 0x7B, 0xE7, 0x83, 0x6D, 0xCE, 0xA9, 0x9C, 0xE9, 0xAC, 0x8E, 0xF6, 0xFF, 0xFF,
+    0x6D, 0xDE, 0x26, 0x9C, 0xEA, 0xBC, 0xD3, 0xFF, 0xFF, 0xFF, 0xCD, 0xED, 0x08, 0x94, 0xE7, 0x83, 0xF1, 0xE6, 0xB2, 0xFF, 0x08, 0x8C, 0x86, 0x7B, 0x27, 0x8C, 0x2D, 0xD6, 0x2D, 0xD6, 0xC5, 0x5A, 0x06, 0x63, 0xCC, 0x9C, 0x2B, 0xA5, 0xA7, 0x7B, 0x48, 0x94, 0x65, 0x73, 0x4B, 0xAD, 0x26, 0x84, 0x84, 0x52, 0x64, 0x4A, 0x4B, 0x8C, 0x87, 0x6B, 0x24, 0x42, 0x24, 0x42, 0x65, 0x4A, 0xAA, 0x8C,
+    0xA2, 0x31, 0x03, 0x42, 0xE3, 0x39, 0x0B, 0x7C, 0x64, 0x4A, 0x44, 0x42, 0x65, 0x42, 0x2A, 0x7C, 0xA3, 0x52, 0x0C, 0x9D, 0x67, 0x6B, 0x29, 0x84, 0xC8, 0x9C, 0xA9, 0x94, 0x69, 0x84, 0x07, 0x7C, 0x44, 0x4A, 0x64, 0x4A, 0x84, 0x4A, 0x85, 0x52, 0x6C, 0xAD, 0x03, 0x42, 0xA5, 0x52, 0x2C, 0xA5, 0xA4, 0x52, 0xA4, 0x52, 0xE5, 0x5A, 0x45, 0x6B, 0x86, 0x6B, 0xAE, 0xDE, 0x45, 0x6B, 0xCA, 0x9C,
+    0x48, 0x8C, 0x26, 0x8C, 0xB2, 0xFF, 0x28, 0x84, 0x66, 0x6B, 0xC7, 0x7B, 0x25, 0x6B, 0x86, 0x73, 0x66, 0x73, 0x86, 0x73, 0xA7, 0x7B, 0x27, 0x8C, 0x07, 0x84, 0x48, 0x94, 0x07, 0x94, 0xEA, 0xAC, 0x07, 0x94, 0x08, 0x94, 0x27, 0x94, 0x6B, 0xCD, 0x0B, 0xD5, 0x48, 0xA4, 0xC7, 0x8B, 0xC7, 0x83, 0xC7, 0x7B, 0x66, 0x73, 0xE7, 0x83, 0xC6, 0x83, 0xAB, 0xBD, 0xA7, 0x83, 0x26, 0x6B, 0xC5, 0x5A,
+    0xC5, 0x5A, 0x06, 0x63, 0x84, 0x52, 0xC4, 0x52, 0xC3, 0x5A, 0x26, 0x84, 0xAB, 0xBD, 0xE6, 0x5A, 0xA5, 0x52, 0x64, 0x4A, 0x45, 0x42, 0x0C, 0x9D, 0x45, 0x42, 0x04, 0x3A, 0x04, 0x3A, 0x04, 0x3A, 0x04, 0x3A, 0x04, 0x3A, 0x24, 0x3A, 0x45, 0x42, 0xE3, 0x39, 0x24, 0x42, 0x65, 0x42, 0x44, 0x42, 0xC6, 0x52, 0xA5, 0x4A, 0xE6, 0x52, 0x06, 0x63, 0x47, 0x6B, 0xA7, 0x73, 0x08, 0x7C, 0xE8, 0x73,
+    0x85, 0x52, 0xA4, 0x52, 0x84, 0x52, 0x43, 0x4A, 0x85, 0x52, 0x43, 0x42, 0xE6, 0x5A, 0xB5, 0xF7, 0xC7, 0x73, 0x63, 0x4A, 0xC5, 0x5A, 0xA7, 0x7B, 0xE4, 0x83, 0x44, 0x6B, 0x24, 0x63, 0xE7, 0x7B, 0xF3, 0xFF, 0xE5, 0x8B, 0x8B, 0xBD, 0x86, 0x73, 0x45, 0x6B, 0xC9, 0xA4, 0x8E, 0xD6, 0x45, 0x6B, 0x46, 0x6B, 0x66, 0x6B, 0x8C, 0xB5, 0x07, 0x8C, 0xEA, 0x9C, 0x0A, 0x9D, 0xEA, 0xA4, 0x0E, 0xDF,
+    0xA6, 0x83, 0xA6, 0x83, 0x08, 0x8C, 0x90, 0xE6, 0x0E, 0xEF, 0x28, 0x9C, 0xC7, 0x83, 0xA7, 0x7B, 0xED, 0xC5, 0x6B, 0xB5, 0xC7, 0x83, 0x47, 0x94, 0x8D, 0xEE, 0xE9, 0xAC, 0xE8, 0x83, 0x06, 0x63, 0x84, 0x52, 0x06, 0x63, 0x8B, 0xB5, 0x05, 0x5B, 0x67, 0x6B, 0x65, 0x6B, 0xAC, 0xB5, 0x49, 0xA5, 0x43, 0x42, 0x03, 0x3A, 0x24, 0x42, 0xA5, 0x52, 0xCA, 0x8C, 0x64, 0x42, 0x45, 0x42, 0xE3, 0x39,
+    0x87, 0x6B, 0x46, 0x4A, 0x24, 0x42, 0x25, 0x42, 0x24, 0x42, 0x6C, 0xA5, 0x24, 0x42, 0x45, 0x42, 0x85, 0x4A, 0x84, 0x4A, 0x8A, 0xA5, 0xA5, 0x52, 0x06, 0x5B, 0x26, 0x5B, 0x66, 0x63, 0xA7, 0x6B, 0xA7, 0x7B, 0xA7, 0x7B, 0x0C, 0xC6, 0xC6, 0x5A, 0x64, 0x4A, 0x64, 0x4A, 0x84, 0x4A, 0xAA, 0x9C, 0xC5, 0x5A, 0x63, 0x52, 0xC5, 0x5A, 0xA4, 0x52, 0x05, 0x63, 0xE4, 0x5A, 0x66, 0x6B, 0x47, 0x8C,
+    0xF8, 0xFF, 0x0F, 0xEF, 0xED, 0xFE, 0x86, 0x73, 0xA7, 0x73, 0x04, 0x63, 0xA6, 0x73, 0x66, 0x6B, 0x66, 0x6B, 0x46, 0x6B, 0x86, 0x73, 0xC7, 0x7B, 0x68, 0x8C, 0x69, 0x8C, 0xA6, 0x7B, 0xA6, 0x73, 0x66, 0x73, 0x86, 0x7B, 0xA7, 0x7B, 0xE7, 0x8B, 0x85, 0x83, 0xE7, 0x83, 0xA6, 0x7B, 0x07, 0x84, 0x07, 0x84, 0xA6, 0x7B, 0x86, 0x7B, 0xEC, 0xDD, 0xB3, 0xFF, 0x07, 0x94, 0x88, 0x7B, 0x84, 0x52,
+    0xA5, 0x5A, 0xE6, 0x5A, 0x85, 0x52, 0x06, 0x5B, 0x25, 0x63, 0x65, 0x6B, 0x4A, 0xA5, 0xAB, 0x9C, 0x64, 0x42, 0x03, 0x3A, 0x24, 0x42, 0x24, 0x42, 0x03, 0x3A, 0x45, 0x42, 0x65, 0x4A, 0x65, 0x42, 0x24, 0x3A, 0x25, 0x42, 0x24, 0x42, 0x45, 0x42, 0x24, 0x3A, 0x04, 0x3A, 0x45, 0x42, 0x24, 0x42, 0x45, 0x42, 0x44, 0x42, 0x64, 0x42, 0xA5, 0x4A, 0xA5, 0x4A, 0xE5, 0x52, 0x26, 0x5B, 0x46, 0x63,
+    0xFF, 0xFF, 0xB3, 0xFF, 0xE7, 0x7B, 0xC4, 0x52, 0x64, 0x4A, 0xE4, 0x5A, 0x2A, 0x9D, 0x43, 0x4A, 0x84, 0x52, 0x84, 0x52, 0x68, 0x8C, 0x4B, 0xAD, 0x26, 0x6B, 0x25, 0x63, 0x66, 0x6B, 0x87, 0x94, 0x6C, 0xD6, 0x09, 0xBD, 0x2C, 0xE6, 0xC7, 0x7B, 0xC7, 0x7B, 0x6D, 0xCE, 0xA9, 0x94, 0xC6, 0x7B, 0x86, 0x6B, 0x65, 0x6B, 0x0F, 0xE7, 0x0E, 0xC6, 0x07, 0x84, 0xA6, 0x7B, 0x27, 0x8C, 0xF2, 0xFF,
+    0x45, 0x6B, 0x86, 0x73, 0x86, 0x73, 0x87, 0x7B, 0xF2, 0xFF, 0x11, 0xE7, 0xA7, 0x7B, 0x27, 0x84, 0xAB, 0xC5, 0x92, 0xFF, 0x6B, 0xBD, 0x2D, 0xEE, 0x8F, 0xE6, 0xEA, 0xB4, 0x6D, 0xE6, 0x6C, 0xAD, 0x27, 0x6B, 0x47, 0x6B, 0x26, 0x63, 0xEC, 0xBD, 0xEE, 0xB5, 0x28, 0x84, 0xEA, 0x94, 0x47, 0x6B, 0xCE, 0xBD, 0x2A, 0x9D, 0x24, 0x42, 0x04, 0x3A, 0x44, 0x42, 0x09, 0x9D, 0xEE, 0xB5, 0x65, 0x42,
+    0xED, 0x94, 0x04, 0x3A, 0x2B, 0x9D, 0x65, 0x4A, 0x45, 0x4A, 0x24, 0x42, 0x69, 0x6B, 0x8E, 0xCE, 0x24, 0x42, 0x03, 0x3A, 0xC7, 0x52, 0x44, 0x4A, 0xD4, 0xFF, 0x85, 0x42, 0xA5, 0x4A, 0xE6, 0x52, 0xFF, 0xFF, 0x30, 0xE7, 0x66, 0x6B, 0xA5, 0x52, 0x43, 0x42, 0x02, 0x3A, 0x43, 0x4A, 0xC5, 0x5A, 0x84, 0x52, 0x84, 0x52, 0xA4, 0x52, 0x25, 0x63, 0x25, 0x63, 0xC4, 0x5A, 0x46, 0x6B, 0x6A, 0xBD,
+    0xF7, 0xFF, 0xEF, 0xEE, 0xEC, 0xD5, 0x08, 0x84, 0x24, 0x6B, 0xC7, 0x7B, 0xC9, 0x9C, 0x86, 0x73, 0x66, 0x6B, 0x25, 0x63, 0x45, 0x6B, 0x86, 0x73, 0xC7, 0x7B, 0x46, 0x6B, 0xC7, 0x7B, 0x45, 0x6B, 0x45, 0x6B, 0x46, 0x6B, 0xA7, 0x73, 0x46, 0x6B, 0xE9, 0x83, 0x25, 0x63, 0xE7, 0x7B, 0x0A, 0xA5, 0x90, 0xFF, 0xCD, 0xE6, 0x85, 0x83, 0x2D, 0xEE, 0x49, 0xCD, 0x2A, 0xB5, 0xAA, 0xA4, 0x84, 0x52,
+    0x84, 0x52, 0xE6, 0x5A, 0xA5, 0x52, 0xC4, 0x5A, 0xC8, 0x73, 0x07, 0x74, 0x28, 0x7C, 0xE5, 0x52, 0xA5, 0x52, 0xA6, 0x4A, 0x04, 0x3A, 0x24, 0x42, 0x24, 0x3A, 0x04, 0x3A, 0x04, 0x3A, 0x85, 0x4A, 0x45, 0x42, 0xE4, 0x31, 0x04, 0x3A, 0x04, 0x3A, 0x04, 0x3A, 0x05, 0x3A, 0x04, 0x3A, 0x84, 0x31, 0x65, 0x42, 0x04, 0x3A, 0x04, 0x3A, 0x45, 0x42, 0x44, 0x42, 0xA6, 0x4A, 0x85, 0x4A, 0xC5, 0x52,
 };
 const lv_img_dsc_t ui_img_starfield_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_starfield_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_starfield_80_png_data
 };
 
@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Twinkels1_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_twinkels1_80_png_data[] = {
-    0x03, 0x21, 0xFF, 0x64, 0x31, 0xFF, 0xE3, 0x20, 0xFF, 0x03, 0x21, 0xFF, 0x09, 0x6B, 0xFF, 0x03, 0x21, 0xFF, 0x23, 0x29, 0xFF, 0x64, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0x68, 0x5A, 0xFF, 0x24, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0xA8, 0x62, 0xFF, 0xE6, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0x06, 0x42, 0xFF, 0xC5, 0x39, 0xFF, 0x8B, 0x83, 0xFF, 0xE5, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x42, 0xFF, 0xC4, 0x39, 0xFF, 0xEC, 0x8B, 0xFF, 0xA7, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF, 0xA7, 0x52, 0xFF, 0xC8, 0x5A, 0xFF, 0x69, 0x83, 0xFF, 0x47, 0x4A, 0xFF, 0x47, 0x4A, 0xFF, 0xA8, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0xCB, 0x8B, 0xFF, 0x06, 0x42, 0xFF, 0x0D, 0x8C, 0xFF, 0x27, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0xC9, 0x62, 0xFF, 0x88, 0x5A, 0xFF, 0x2A, 0x6B, 0xFF, 0xD0, 0xA4, 0xFF, 0xC9, 0x62, 0xFF, 0x67, 0x52, 0xFF, 0x6A, 0x7B, 0xFF, 0xA8, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x6B, 0x73, 0xFF, 0x6A, 0x7B, 0xFF, 0x70, 0x9C, 0xFF, 0xA9, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0xC5, 0x39, 0xFF, 0x67, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0x87, 0x5A, 0xFF,
-    0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0xE5, 0x41, 0xFF, 0x46, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x88, 0x5A, 0xFF, 0xF5, 0xC5, 0xFF, 0xEC, 0x9B, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x46, 0x4A, 0xFF, 0x05, 0x42, 0xFF, 0xE5, 0x41, 0xFF, 0x64, 0x29, 0xFF, 0x03, 0x21, 0xFF, 0xC6, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0x24, 0x29, 0xFF, 0x03, 0x21, 0xFF, 0x23, 0x21, 0xFF, 0x03, 0x21, 0xFF, 0x64, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x44, 0x29, 0xFF, 0x84, 0x31, 0xFF, 0xA8, 0x5A, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0xE8, 0x62, 0xFF, 0xE6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0xA7, 0x62, 0xFF, 0xE6, 0x41, 0xFF, 0x28, 0x63, 0xFF, 0xA7, 0x5A, 0xFF, 0xEC, 0x83, 0xFF, 0x05, 0x4A, 0xFF, 0x88, 0x5A, 0xFF, 0x87, 0x52, 0xFF, 0x47, 0x4A, 0xFF, 0x84, 0x31, 0xFF, 0x47, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x4A, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x6B, 0x73, 0xFF, 0x14, 0xDE, 0xFF, 0x0A, 0x6B, 0xFF, 0x47, 0x52, 0xFF, 0x09, 0x6B, 0xFF,
-    0xA5, 0x41, 0xFF, 0x68, 0x52, 0xFF, 0x87, 0x5A, 0xFF, 0x92, 0xCD, 0xFF, 0xEF, 0xC4, 0xFF, 0x4A, 0x73, 0xFF, 0x0B, 0x8C, 0xFF, 0xE9, 0x72, 0xFF, 0x84, 0x31, 0xFF, 0x8A, 0x7B, 0xFF, 0xA8, 0x5A, 0xFF, 0xE6, 0x41, 0xFF, 0xC5, 0x39, 0xFF, 0x06, 0x42, 0xFF, 0xE6, 0x41, 0xFF, 0x4A, 0x73, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x6A, 0x7B, 0xFF, 0x06, 0x42, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x29, 0x6B, 0xFF, 0x67, 0x5A, 0xFF, 0x46, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x05, 0x4A, 0xFF, 0x46, 0x52, 0xFF, 0x28, 0x6B, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0x23, 0x21, 0xFF, 0xA5, 0x39, 0xFF, 0x03, 0x21, 0xFF, 0x03, 0x21, 0xFF, 0xE9, 0x62, 0xFF, 0x44, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x09, 0x6B, 0xFF, 0x44, 0x29, 0xFF, 0xA5, 0x39, 0xFF, 0x43, 0x29, 0xFF, 0x64, 0x29, 0xFF, 0x29, 0x73, 0xFF, 0xD7, 0xFF, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0x0C, 0x94, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0x26, 0x4A, 0xFF, 0x2C, 0x9C, 0xFF, 0xE6, 0x41, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x2A, 0x6B, 0xFF,
-    0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0x27, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0x87, 0x5A, 0xFF, 0x47, 0x4A, 0xFF, 0xA8, 0x5A, 0xFF, 0xCC, 0x83, 0xFF, 0x67, 0x52, 0xFF, 0x88, 0x52, 0xFF, 0x0A, 0x6B, 0xFF, 0x88, 0x52, 0xFF, 0x0A, 0x6B, 0xFF, 0x6E, 0xA4, 0xFF, 0x10, 0xB5, 0xFF, 0x11, 0xBD, 0xFF, 0x6F, 0xA4, 0xFF, 0xC9, 0x62, 0xFF, 0x27, 0x4A, 0xFF, 0x68, 0x52, 0xFF, 0xCC, 0x83, 0xFF, 0x27, 0x4A, 0xFF, 0x47, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xC5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x42, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x87, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0xA4, 0x39, 0xFF, 0xE9, 0x62, 0xFF, 0xE5, 0x41, 0xFF, 0x03, 0x21, 0xFF, 0x84, 0x31, 0xFF, 0x03, 0x21, 0xFF, 0x23, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0x23, 0x21, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x44, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0xC6, 0x39, 0xFF,
-    0xA8, 0x5A, 0xFF, 0x85, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0xAA, 0x8B, 0xFF, 0x84, 0x39, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0x26, 0x52, 0xFF, 0xA7, 0x62, 0xFF, 0x06, 0x42, 0xFF, 0xA8, 0x5A, 0xFF, 0xC8, 0x5A, 0xFF, 0xC8, 0x5A, 0xFF, 0x0A, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0x67, 0x5A, 0xFF, 0xA8, 0x62, 0xFF, 0x88, 0x62, 0xFF, 0x47, 0x4A, 0xFF, 0xA9, 0x62, 0xFF, 0xAC, 0x83, 0xFF, 0x8C, 0x7B, 0xFF, 0xA8, 0x62, 0xFF, 0x0D, 0x94, 0xFF, 0xA8, 0x62, 0xFF, 0x09, 0x6B, 0xFF, 0xC9, 0x62, 0xFF, 0x68, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0xEA, 0x62, 0xFF, 0xAB, 0x83, 0xFF, 0xD0, 0xA4, 0xFF, 0xAC, 0x83, 0xFF, 0xA9, 0x5A, 0xFF, 0xE6, 0x41, 0xFF, 0xC9, 0x62, 0xFF, 0x67, 0x52, 0xFF, 0x6A, 0x83, 0xFF, 0xE6, 0x41, 0xFF, 0x27, 0x4A, 0xFF, 0x88, 0x5A, 0xFF, 0x87, 0x5A, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x27, 0x4A, 0xFF, 0xC5, 0x39, 0xFF, 0x29, 0x73, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0xA8, 0x52, 0xFF, 0x0A, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0xE5, 0x41, 0xFF, 0xE5, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0x05, 0x42, 0xFF, 0xE5, 0x41, 0xFF,
-    0x23, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0xA8, 0x5A, 0xFF, 0x23, 0x21, 0xFF, 0x23, 0x29, 0xFF, 0x03, 0x21, 0xFF, 0xE5, 0x41, 0xFF, 0x64, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0xCC, 0x83, 0xFF, 0x44, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0xEC, 0x8B, 0xFF, 0xE6, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0x68, 0x5A, 0xFF, 0x84, 0x39, 0xFF, 0x87, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0x26, 0x4A, 0xFF, 0xA8, 0x5A, 0xFF, 0x66, 0x52, 0xFF, 0x47, 0x4A, 0xFF, 0xE9, 0x8A, 0xFF, 0xCC, 0x83, 0xFF, 0x88, 0x52, 0xFF, 0xE9, 0x62, 0xFF, 0xEC, 0x83, 0xFF, 0x09, 0x6B, 0xFF, 0x68, 0x52, 0xFF, 0x6B, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0xE9, 0x62, 0xFF, 0xC8, 0x5A, 0xFF, 0x4A, 0x73, 0xFF, 0xCC, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x88, 0x52, 0xFF, 0xE9, 0x62, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x42, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x42, 0xFF, 0xC5, 0x41, 0xFF, 0xC5, 0x41, 0xFF,
-    0x64, 0x31, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0x26, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x87, 0x52, 0xFF, 0x06, 0x42, 0xFF, 0xE5, 0x41, 0xFF, 0x0A, 0x6B, 0xFF, 0xA4, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xE5, 0x41, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x21, 0xFF, 0x03, 0x21, 0xFF, 0x23, 0x29, 0xFF, 0xC5, 0x41, 0xFF, 0x88, 0x5A, 0xFF, 0x44, 0x29, 0xFF, 0x64, 0x29, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0xE6, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x27, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0xC5, 0x41, 0xFF, 0xE5, 0x41, 0xFF, 0x30, 0xBD, 0xFF, 0xE5, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0xCC, 0x8B, 0xFF, 0x06, 0x4A, 0xFF, 0xC5, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x46, 0x5A, 0xFF, 0x0D, 0x8C, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x4A, 0xFF, 0xC5, 0x41, 0xFF, 0x6B, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0xCC, 0x8B, 0xFF, 0xA8, 0x5A, 0xFF, 0x4B, 0x73, 0xFF, 0x10, 0xBD, 0xFF, 0x09, 0x6B, 0xFF, 0xCC, 0x8B, 0xFF, 0xA8, 0x5A, 0xFF,
-    0x47, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0xC8, 0x62, 0xFF, 0xEC, 0x8B, 0xFF, 0x88, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF, 0x46, 0x4A, 0xFF, 0x0A, 0x6B, 0xFF, 0x0F, 0xBD, 0xFF, 0x27, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0x88, 0x5A, 0xFF, 0xA4, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0xC5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0x4B, 0x7B, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0x27, 0x4A, 0xFF, 0xEF, 0x9C, 0xFF, 0xE9, 0x6A, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x46, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x05, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0xA4, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0xE2, 0x20, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0xA8, 0x62, 0xFF, 0x88, 0x5A, 0xFF, 0x44, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x42, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0x4A, 0x73, 0xFF, 0x49, 0x7B, 0xFF, 0x84, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0x6A, 0x7B, 0xFF, 0xC5, 0x49, 0xFF, 0xA6, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0x26, 0x4A, 0xFF, 0x6B, 0x83, 0xFF, 0x0E, 0x94, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x09, 0x73, 0xFF, 0x4A, 0x83, 0xFF,
-    0x67, 0x5A, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xC5, 0x41, 0xFF, 0xAE, 0xA4, 0xFF, 0x09, 0x63, 0xFF, 0x88, 0x5A, 0xFF, 0x27, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x8B, 0x83, 0xFF, 0x0A, 0x6B, 0xFF, 0x4E, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x8B, 0xFF, 0xEA, 0x6A, 0xFF, 0x4A, 0x73, 0xFF, 0x05, 0x4A, 0xFF, 0xC9, 0x5A, 0xFF, 0x88, 0x5A, 0xFF, 0x68, 0x52, 0xFF, 0x6B, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x88, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x2A, 0x6B, 0xFF, 0x47, 0x4A, 0xFF, 0x47, 0x4A, 0xFF, 0x47, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0xC6, 0x41, 0xFF, 0x09, 0x6B, 0xFF, 0xA5, 0x39, 0xFF, 0xC6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0xE8, 0x62, 0xFF, 0x47, 0x4A, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x42, 0xFF, 0xA8, 0x5A, 0xFF, 0x29, 0x6B, 0xFF, 0x84, 0x39, 0xFF, 0x26, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x05, 0x42, 0xFF, 0x69, 0x7B, 0xFF, 0xE2, 0x18, 0xFF, 0xE2, 0x20, 0xFF, 0x44, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0xA5, 0x39, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0xC9, 0x62, 0xFF, 0x43, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x39, 0xFF,
-    0x64, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x46, 0x5A, 0xFF, 0xE5, 0x41, 0xFF, 0x05, 0x4A, 0xFF, 0x71, 0xC5, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x46, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0x27, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0xC5, 0x49, 0xFF, 0x67, 0x62, 0xFF, 0x47, 0x5A, 0xFF, 0x26, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0xE5, 0x49, 0xFF, 0xC9, 0x62, 0xFF, 0xA9, 0x5A, 0xFF, 0x27, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x0C, 0x94, 0xFF, 0xA8, 0x62, 0xFF, 0x4D, 0xA4, 0xFF, 0x9C, 0xFF, 0xFF, 0xCB, 0x8B, 0xFF, 0xAB, 0x83, 0xFF, 0x88, 0x5A, 0xFF, 0xC8, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0xEC, 0x8B, 0xFF, 0x0D, 0x8C, 0xFF, 0x4A, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0xC8, 0x5A, 0xFF, 0xC9, 0x6A, 0xFF, 0x2E, 0x8C, 0xFF, 0x06, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x2A, 0x73, 0xFF, 0x07, 0x4A, 0xFF, 0x06, 0x42, 0xFF, 0xC5, 0x41, 0xFF, 0xC6, 0x41, 0xFF, 0x2A, 0x73, 0xFF, 0x06, 0x42, 0xFF, 0xE6, 0x41, 0xFF, 0x27, 0x4A, 0xFF, 0xE9, 0x6A, 0xFF, 0xA5, 0x39, 0xFF, 0x88, 0x5A, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x29, 0x73, 0xFF, 0x67, 0x52, 0xFF, 0xE5, 0x41, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x42, 0xFF, 0x87, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF,
-    0xC2, 0x18, 0xFF, 0x44, 0x31, 0xFF, 0x44, 0x29, 0xFF, 0x24, 0x29, 0xFF, 0x03, 0x21, 0xFF, 0x24, 0x29, 0xFF, 0x67, 0x52, 0xFF, 0x64, 0x31, 0xFF, 0x43, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x31, 0xAD, 0xFF, 0x2A, 0x73, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0x43, 0x31, 0xFF, 0x6A, 0x73, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xEB, 0x83, 0xFF, 0xE6, 0x41, 0xFF, 0x87, 0x62, 0xFF, 0x4E, 0x94, 0xFF, 0xE6, 0x41, 0xFF, 0x6A, 0x7B, 0xFF, 0x26, 0x52, 0xFF, 0x0A, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x32, 0xD6, 0xFF, 0x67, 0x5A, 0xFF, 0x67, 0x62, 0xFF, 0x2D, 0x9C, 0xFF, 0xEC, 0x93, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x8B, 0x83, 0xFF, 0x2A, 0x73, 0xFF, 0x27, 0x4A, 0xFF, 0x68, 0x52, 0xFF, 0xA8, 0x5A, 0xFF, 0xEC, 0x8B, 0xFF, 0x4A, 0x7B, 0xFF, 0x0C, 0x8C, 0xFF, 0xD0, 0xAC, 0xFF, 0x88, 0x5A, 0xFF, 0xCC, 0x8B, 0xFF, 0xA8, 0x62, 0xFF, 0x88, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x4B, 0x7B, 0xFF, 0xED, 0x8B, 0xFF, 0x47, 0x52, 0xFF, 0x87, 0x5A, 0xFF, 0xCB, 0x8B, 0xFF, 0xE6, 0x41, 0xFF, 0xAF, 0xAC, 0xFF, 0x26, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0xC6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x67, 0x5A, 0xFF, 0xE6, 0x41, 0xFF,
-    0x06, 0x42, 0xFF, 0xC5, 0x39, 0xFF, 0x06, 0x4A, 0xFF, 0x6A, 0x7B, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x6A, 0x7B, 0xFF, 0x67, 0x4A, 0xFF, 0xE5, 0x39, 0xFF, 0xE5, 0x41, 0xFF, 0xC9, 0x62, 0xFF, 0x4A, 0x73, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xC2, 0x18, 0xFF, 0x43, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0xA8, 0x5A, 0xFF, 0x23, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0xC6, 0x39, 0xFF, 0x43, 0x29, 0xFF, 0x2A, 0x6B, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0x27, 0x4A, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x66, 0x5A, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0xAB, 0x8B, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x52, 0xFF, 0x27, 0x52, 0xFF, 0x67, 0x5A, 0xFF, 0x0A, 0x7B, 0xFF, 0xC8, 0x6A, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x5A, 0xFF, 0x07, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0x8C, 0x7B, 0xFF, 0x0D, 0x8C, 0xFF, 0xA8, 0x5A, 0xFF, 0xE9, 0x62, 0xFF, 0x88, 0x5A, 0xFF,
-    0x68, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0xC9, 0x62, 0xFF, 0x27, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xA9, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xA5, 0x39, 0xFF, 0x0A, 0x6B, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0x2B, 0x73, 0xFF, 0xE5, 0x49, 0xFF, 0xA4, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0x08, 0x73, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0x47, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x26, 0x52, 0xFF, 0x43, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x84, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0xA4, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x27, 0x4A, 0xFF, 0xE8, 0x62, 0xFF, 0xE6, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0xA9, 0x5A, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xC9, 0x62, 0xFF, 0xE5, 0x49, 0xFF, 0x4E, 0xA4, 0xFF, 0xE5, 0x49, 0xFF, 0x67, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0xE9, 0x72, 0xFF, 0x2A, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x5A, 0xFF, 0x09, 0x6B, 0xFF, 0x88, 0x62, 0xFF,
-    0x06, 0x52, 0xFF, 0x0A, 0x6B, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xEC, 0x8B, 0xFF, 0x2C, 0x94, 0xFF, 0x47, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0xA8, 0x62, 0xFF, 0x6E, 0x9C, 0xFF, 0xA8, 0x62, 0xFF, 0x4A, 0x73, 0xFF, 0x46, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0xCB, 0x83, 0xFF, 0xC9, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x4B, 0x7B, 0xFF, 0x0A, 0x6B, 0xFF, 0x0C, 0x94, 0xFF, 0xE5, 0x49, 0xFF, 0xEC, 0x8B, 0xFF, 0xA8, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x67, 0x5A, 0xFF, 0x07, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x2D, 0x94, 0xFF, 0xC6, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0xE8, 0x6A, 0xFF, 0x26, 0x52, 0xFF, 0xC5, 0x39, 0xFF, 0x67, 0x52, 0xFF, 0xA5, 0x39, 0xFF, 0x05, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0xC8, 0x62, 0xFF, 0x6A, 0x73, 0xFF, 0x67, 0x52, 0xFF, 0x46, 0x52, 0xFF, 0x87, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x43, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0x67, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0x4A, 0x7B, 0xFF, 0xC5, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x26, 0x52, 0xFF, 0xAB, 0x83, 0xFF,
-    0xA5, 0x39, 0xFF, 0x2A, 0x6B, 0xFF, 0xA5, 0x39, 0xFF, 0x87, 0x5A, 0xFF, 0xEC, 0xA3, 0xFF, 0xE9, 0x6A, 0xFF, 0xC8, 0x6A, 0xFF, 0x72, 0xD5, 0xFF, 0x06, 0x4A, 0xFF, 0x8A, 0x83, 0xFF, 0xAF, 0xB4, 0xFF, 0xEC, 0x9B, 0xFF, 0xAC, 0x9B, 0xFF, 0xAE, 0xA4, 0xFF, 0xA8, 0x6A, 0xFF, 0xCC, 0x9B, 0xFF, 0x91, 0xDD, 0xFF, 0xC8, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x0D, 0x94, 0xFF, 0x4E, 0x9C, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x4E, 0x94, 0xFF, 0x4D, 0x9C, 0xFF, 0x88, 0x5A, 0xFF, 0x67, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x29, 0x73, 0xFF, 0x6B, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF, 0x47, 0x52, 0xFF, 0x0A, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x68, 0x52, 0xFF, 0xA8, 0x5A, 0xFF, 0xEF, 0xAC, 0xFF, 0xAF, 0xAC, 0xFF, 0x26, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0x2A, 0x6B, 0xFF, 0x27, 0x4A, 0xFF, 0xC5, 0x39, 0xFF, 0xC6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0xA4, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0x26, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x26, 0x4A, 0xFF, 0x87, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x87, 0x5A, 0xFF, 0x46, 0x52, 0xFF, 0xC8, 0x62, 0xFF, 0xC8, 0x62, 0xFF,
-    0x85, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0x44, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xC9, 0x62, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0xA7, 0x5A, 0xFF, 0x64, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0xE6, 0x41, 0xFF, 0x46, 0x52, 0xFF, 0x85, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0xAB, 0x7B, 0xFF, 0xC5, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x88, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x27, 0x52, 0xFF, 0xC9, 0x6A, 0xFF, 0xEC, 0x93, 0xFF, 0xC8, 0x7A, 0xFF, 0x2F, 0xCD, 0xFF, 0x6B, 0x93, 0xFF, 0x2A, 0x83, 0xFF, 0xA8, 0x72, 0xFF, 0xC8, 0x62, 0xFF, 0x8B, 0x7B, 0xFF, 0x27, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x5A, 0xFF, 0xD0, 0xA4, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x4E, 0xA4, 0xFF, 0xAF, 0xAC, 0xFF, 0x88, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x67, 0x5A, 0xFF, 0x68, 0x52, 0xFF, 0x2D, 0x94, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x0C, 0x94, 0xFF, 0x06, 0x4A, 0xFF, 0x07, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xEA, 0x62, 0xFF, 0x2C, 0x94, 0xFF, 0x87, 0x52, 0xFF, 0x06, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x5A, 0xFF,
-    0x67, 0x52, 0xFF, 0xC5, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x2C, 0x94, 0xFF, 0xA4, 0x39, 0xFF, 0xE5, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x8B, 0x7B, 0xFF, 0xEC, 0x93, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0xC8, 0x62, 0xFF, 0x87, 0x5A, 0xFF, 0x0C, 0x94, 0xFF, 0x45, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0xC8, 0x62, 0xFF, 0x24, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xE9, 0x6A, 0xFF, 0x85, 0x39, 0xFF, 0x43, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x26, 0x52, 0xFF, 0xE5, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0x26, 0x4A, 0xFF, 0x8A, 0x83, 0xFF, 0xC5, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0x27, 0x52, 0xFF, 0x2A, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF, 0x46, 0x5A, 0xFF, 0x54, 0xE6, 0xFF, 0xAB, 0x8B, 0xFF, 0x49, 0x8B, 0xFF, 0x2C, 0xBC, 0xFF, 0xDD, 0xFF, 0xFF, 0xD3, 0xED, 0xFF, 0xAC, 0x93, 0xFF, 0x0D, 0xA4, 0xFF, 0xE8, 0x72, 0xFF, 0xA8, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x26, 0x52, 0xFF, 0x4A, 0x83, 0xFF, 0x6E, 0x9C, 0xFF, 0x26, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0xAF, 0xAC, 0xFF, 0x2A, 0x7B, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x8E, 0x9C, 0xFF, 0x67, 0x52, 0xFF,
-    0x47, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0x2B, 0x7B, 0xFF, 0x2E, 0x9C, 0xFF, 0x29, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x28, 0x73, 0xFF, 0x27, 0x4A, 0xFF, 0x0C, 0x8C, 0xFF, 0x27, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x06, 0x42, 0xFF, 0xE6, 0x41, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x6A, 0x7B, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x42, 0xFF, 0xE5, 0x41, 0xFF, 0x4A, 0x73, 0xFF, 0x06, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x47, 0x4A, 0xFF, 0x6A, 0x7B, 0xFF, 0xE8, 0x6A, 0xFF, 0x46, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0xC8, 0x62, 0xFF, 0x08, 0x6B, 0xFF, 0x87, 0x5A, 0xFF, 0x26, 0x4A, 0xFF, 0xA8, 0x62, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0xE5, 0x49, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x44, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x6B, 0x7B, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x63, 0x39, 0xFF, 0x05, 0x4A, 0xFF, 0x2D, 0x9C, 0xFF, 0x64, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0xC8, 0x62, 0xFF, 0xA4, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x43, 0x39, 0xFF, 0xCC, 0x8B, 0xFF, 0x8B, 0x83, 0xFF, 0xAF, 0xBC, 0xFF, 0x8A, 0x7B, 0xFF, 0xE9, 0x72, 0xFF, 0x76, 0xEE, 0xFF, 0x8E, 0xBC, 0xFF, 0x71, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xB4, 0xFF, 0xC9, 0x72, 0xFF,
-    0xE9, 0x72, 0xFF, 0x4D, 0xAC, 0xFF, 0x67, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0x67, 0x5A, 0xFF, 0xCC, 0x8B, 0xFF, 0x67, 0x5A, 0xFF, 0x27, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0xAB, 0x8B, 0xFF, 0x67, 0x5A, 0xFF, 0x68, 0x52, 0xFF, 0x48, 0x52, 0xFF, 0x09, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0x68, 0x52, 0xFF, 0xAB, 0x83, 0xFF, 0xE9, 0x6A, 0xFF, 0x68, 0x5A, 0xFF, 0x87, 0x5A, 0xFF, 0x2B, 0x73, 0xFF, 0xCD, 0x8B, 0xFF, 0x27, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0x0A, 0x73, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x52, 0xFF, 0x05, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x0C, 0x8C, 0xFF, 0x06, 0x42, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0xED, 0x93, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0xE5, 0x41, 0xFF, 0xC8, 0x62, 0xFF, 0xCB, 0x83, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF, 0x0C, 0x94, 0xFF, 0x87, 0x5A, 0xFF, 0x29, 0x73, 0xFF, 0xC7, 0x62, 0xFF, 0x06, 0x42, 0xFF, 0x85, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0xA4, 0x39, 0xFF, 0x44, 0x29, 0xFF, 0xE5, 0x49, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x06, 0x42, 0xFF, 0x85, 0x39, 0xFF, 0x85, 0x41, 0xFF, 0x85, 0x39, 0xFF, 0x2A, 0x6B, 0xFF, 0xA4, 0x41, 0xFF, 0xC5, 0x39, 0xFF,
-    0x85, 0x39, 0xFF, 0xAC, 0x83, 0xFF, 0x84, 0x39, 0xFF, 0xE5, 0x49, 0xFF, 0x4A, 0x73, 0xFF, 0x8A, 0x7B, 0xFF, 0x68, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0x68, 0x5A, 0xFF, 0xCB, 0x8B, 0xFF, 0x88, 0x6A, 0xFF, 0xEC, 0xA3, 0xFF, 0x0F, 0xD5, 0xFF, 0x95, 0xFE, 0xFF, 0x2D, 0xAC, 0xFF, 0xC8, 0x6A, 0xFF, 0xE9, 0x72, 0xFF, 0x8B, 0x83, 0xFF, 0x47, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0x46, 0x5A, 0xFF, 0x8E, 0x9C, 0xFF, 0x87, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0xAF, 0xAC, 0xFF, 0x4E, 0xA4, 0xFF, 0x88, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x5A, 0xFF, 0x2A, 0x73, 0xFF, 0x6D, 0xA4, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xE9, 0x72, 0xFF, 0x67, 0x52, 0xFF, 0x0C, 0x94, 0xFF, 0x47, 0x52, 0xFF, 0xAF, 0xA4, 0xFF, 0x27, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x4A, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0xC8, 0x6A, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xA9, 0x5A, 0xFF, 0x09, 0x73, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x52, 0xFF, 0xEC, 0x8B, 0xFF, 0x67, 0x52, 0xFF, 0xC8, 0x62, 0xFF, 0x67, 0x52, 0xFF, 0x08, 0x73, 0xFF, 0x87, 0x5A, 0xFF, 0x2A, 0x73, 0xFF, 0x87, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF, 0xA7, 0x5A, 0xFF,
-    0x23, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0xA8, 0x5A, 0xFF, 0x44, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0x27, 0x4A, 0xFF, 0x64, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0xA8, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x23, 0x29, 0xFF, 0xC5, 0x41, 0xFF, 0x2A, 0x73, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x8A, 0x7B, 0xFF, 0x8E, 0xA4, 0xFF, 0xEC, 0x83, 0xFF, 0x26, 0x4A, 0xFF, 0xA8, 0x62, 0xFF, 0x92, 0xCD, 0xFF, 0xE9, 0x72, 0xFF, 0xA8, 0x62, 0xFF, 0x4A, 0x83, 0xFF, 0x31, 0xCD, 0xFF, 0xC8, 0x82, 0xFF, 0x6A, 0x8B, 0xFF, 0xAF, 0xAC, 0xFF, 0xA8, 0x6A, 0xFF, 0xAE, 0xB4, 0xFF, 0x4A, 0x83, 0xFF, 0x87, 0x5A, 0xFF, 0x46, 0x52, 0xFF, 0x30, 0xB5, 0xFF, 0x8F, 0xA4, 0xFF, 0xA8, 0x6A, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x8E, 0xAC, 0xFF, 0x87, 0x5A, 0xFF, 0x68, 0x5A, 0xFF, 0x0C, 0x8C, 0xFF, 0x91, 0xC5, 0xFF, 0x2D, 0x9C, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0xC8, 0x6A, 0xFF, 0x19, 0xEF, 0xFF, 0x09, 0x6B, 0xFF, 0x27, 0x52, 0xFF, 0x8B, 0x7B, 0xFF, 0x0A, 0x6B, 0xFF, 0x27, 0x52, 0xFF, 0x6B, 0x73, 0xFF, 0x27, 0x4A, 0xFF, 0x10, 0xC5, 0xFF, 0x27, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0x07, 0x4A, 0xFF,
-    0x4D, 0x9C, 0xFF, 0x6B, 0x7B, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xAB, 0x83, 0xFF, 0xE5, 0x49, 0xFF, 0x88, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x8E, 0x9C, 0xFF, 0x26, 0x52, 0xFF, 0xC8, 0x62, 0xFF, 0xE9, 0x62, 0xFF, 0xC8, 0x62, 0xFF, 0xA8, 0x62, 0xFF, 0xA8, 0x62, 0xFF, 0x85, 0x41, 0xFF, 0x84, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x06, 0x4A, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x68, 0x52, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x31, 0xFF, 0x4A, 0x7B, 0xFF, 0xC5, 0x49, 0xFF, 0x67, 0x52, 0xFF, 0x85, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x6B, 0x83, 0xFF, 0xE6, 0x41, 0xFF, 0x85, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xE9, 0x6A, 0xFF, 0x09, 0x7B, 0xFF, 0x96, 0xEE, 0xFF, 0x88, 0x5A, 0xFF, 0x71, 0xB5, 0xFF, 0x34, 0xE6, 0xFF, 0xE9, 0x72, 0xFF, 0x4D, 0xAC, 0xFF, 0xA8, 0x7A, 0xFF, 0x77, 0xFF, 0xFF, 0xE9, 0x7A, 0xFF, 0x4D, 0x9C, 0xFF, 0x8B, 0x8B, 0xFF, 0x6D, 0x94, 0xFF, 0x87, 0x62, 0xFF, 0x66, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0x13, 0xD6, 0xFF, 0x5B, 0xF7, 0xFF, 0xA8, 0x6A, 0xFF, 0x47, 0x52, 0xFF, 0x88, 0x62, 0xFF, 0x6E, 0xA4, 0xFF, 0x87, 0x62, 0xFF, 0xA9, 0x62, 0xFF, 0x2A, 0x73, 0xFF, 0xE9, 0x72, 0xFF, 0xC9, 0x62, 0xFF, 0x0D, 0x94, 0xFF,
-    0x6F, 0x9C, 0xFF, 0x0A, 0x6B, 0xFF, 0x09, 0x73, 0xFF, 0x88, 0x5A, 0xFF, 0xCB, 0x8B, 0xFF, 0xA8, 0x5A, 0xFF, 0x2D, 0x9C, 0xFF, 0x46, 0x52, 0xFF, 0x46, 0x52, 0xFF, 0x0C, 0x94, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0x87, 0x5A, 0xFF, 0xCB, 0x8B, 0xFF, 0x06, 0x4A, 0xFF, 0x07, 0x4A, 0xFF, 0x07, 0x4A, 0xFF, 0xAC, 0x83, 0xFF, 0x6D, 0x9C, 0xFF, 0x26, 0x52, 0xFF, 0x08, 0x63, 0xFF, 0xC8, 0x62, 0xFF, 0xAB, 0x83, 0xFF, 0xCB, 0x83, 0xFF, 0x47, 0x52, 0xFF, 0x4B, 0x7B, 0xFF, 0xE9, 0x6A, 0xFF, 0x87, 0x5A, 0xFF, 0x8D, 0x9C, 0xFF, 0x08, 0x6B, 0xFF, 0x23, 0x29, 0xFF, 0x46, 0x52, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0xA8, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0x87, 0x52, 0xFF, 0xA5, 0x39, 0xFF, 0x68, 0x52, 0xFF, 0x29, 0x7B, 0xFF, 0x87, 0x5A, 0xFF, 0x26, 0x4A, 0xFF, 0x84, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x4A, 0x7B, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x49, 0xFF, 0x47, 0x52, 0xFF, 0x09, 0x6B, 0xFF, 0x0A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0x6A, 0x7B, 0xFF, 0x46, 0x5A, 0xFF, 0x67, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0x0C, 0x9C, 0xFF, 0x6A, 0x93, 0xFF, 0x09, 0x7B, 0xFF, 0xCC, 0x8B, 0xFF, 0x87, 0x6A, 0xFF,
-    0x4B, 0x7B, 0xFF, 0xE8, 0x6A, 0xFF, 0xE8, 0x6A, 0xFF, 0x67, 0x5A, 0xFF, 0x2A, 0x7B, 0xFF, 0x2E, 0x9C, 0xFF, 0xC9, 0x6A, 0xFF, 0x47, 0x52, 0xFF, 0xC9, 0x6A, 0xFF, 0x11, 0xC5, 0xFF, 0x88, 0x6A, 0xFF, 0x2A, 0x7B, 0xFF, 0xB0, 0xB4, 0xFF, 0x8F, 0xB4, 0xFF, 0xAC, 0x8B, 0xFF, 0x88, 0x5A, 0xFF, 0x14, 0xE6, 0xFF, 0x6A, 0x83, 0xFF, 0x87, 0x5A, 0xFF, 0x2D, 0x94, 0xFF, 0x68, 0x52, 0xFF, 0xCD, 0x93, 0xFF, 0x87, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x09, 0x6B, 0xFF, 0x67, 0x5A, 0xFF, 0xE8, 0x6A, 0xFF, 0xA8, 0x62, 0xFF, 0x27, 0x4A, 0xFF, 0xE9, 0x6A, 0xFF, 0x26, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x09, 0x6B, 0xFF, 0x26, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0x4A, 0x73, 0xFF, 0x67, 0x62, 0xFF, 0x4A, 0x73, 0xFF, 0x2A, 0x6B, 0xFF, 0xC8, 0x62, 0xFF, 0x09, 0x6B, 0xFF, 0x49, 0x73, 0xFF, 0x87, 0x5A, 0xFF, 0x09, 0x6B, 0xFF, 0xE8, 0x6A, 0xFF, 0x23, 0x29, 0xFF, 0xA5, 0x39, 0xFF, 0x43, 0x29, 0xFF, 0xC9, 0x62, 0xFF, 0x44, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0x0A, 0x6B, 0xFF, 0x06, 0x42, 0xFF, 0x27, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x85, 0x39, 0xFF, 0xCC, 0x8B, 0xFF, 0x47, 0x52, 0xFF, 0x84, 0x31, 0xFF,
-    0xA5, 0x39, 0xFF, 0x6E, 0xA4, 0xFF, 0xCC, 0x8B, 0xFF, 0x47, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x6D, 0x9C, 0xFF, 0xCC, 0x93, 0xFF, 0xF0, 0xAC, 0xFF, 0x6A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0xA8, 0x62, 0xFF, 0x2D, 0xA4, 0xFF, 0x67, 0x62, 0xFF, 0x10, 0xB5, 0xFF, 0x4B, 0x7B, 0xFF, 0xA8, 0x62, 0xFF, 0x09, 0x7B, 0xFF, 0x2D, 0x9C, 0xFF, 0xEC, 0x83, 0xFF, 0x67, 0x5A, 0xFF, 0xF1, 0xB4, 0xFF, 0x11, 0xBD, 0xFF, 0xE9, 0x72, 0xFF, 0x68, 0x52, 0xFF, 0x68, 0x5A, 0xFF, 0xAF, 0xB4, 0xFF, 0x6B, 0x8B, 0xFF, 0xD0, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xCC, 0xFF, 0x2E, 0xA4, 0xFF, 0x88, 0x62, 0xFF, 0xC9, 0x6A, 0xFF, 0x8C, 0x93, 0xFF, 0xC9, 0x6A, 0xFF, 0xEC, 0x93, 0xFF, 0xE9, 0x6A, 0xFF, 0x90, 0xAC, 0xFF, 0xCF, 0xA4, 0xFF, 0x0A, 0x6B, 0xFF, 0x4E, 0x9C, 0xFF, 0xE9, 0x6A, 0xFF, 0x88, 0x5A, 0xFF, 0x27, 0x4A, 0xFF, 0x26, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0xAF, 0x9C, 0xFF, 0x67, 0x5A, 0xFF, 0xC8, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0xE9, 0x6A, 0xFF, 0xE5, 0x49, 0xFF, 0x09, 0x6B, 0xFF, 0xC8, 0x6A, 0xFF, 0xC8, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0x8B, 0x7B, 0xFF, 0x4A, 0x73, 0xFF, 0x4D, 0xA4, 0xFF, 0x87, 0x62, 0xFF, 0x49, 0x73, 0xFF, 0xC8, 0x62, 0xFF,
-    0x84, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x43, 0x29, 0xFF, 0xE8, 0x62, 0xFF, 0x84, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0x2A, 0x73, 0xFF, 0x27, 0x4A, 0xFF, 0xC5, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0x4D, 0x9C, 0xFF, 0x07, 0x4A, 0xFF, 0xA5, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x8D, 0x9C, 0xFF, 0x29, 0x73, 0xFF, 0x27, 0x52, 0xFF, 0x27, 0x52, 0xFF, 0x6B, 0x7B, 0xFF, 0xAC, 0x83, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x5A, 0xFF, 0x09, 0x73, 0xFF, 0xA8, 0x62, 0xFF, 0xA7, 0x6A, 0xFF, 0xCB, 0x83, 0xFF, 0x6E, 0x9C, 0xFF, 0x8B, 0x83, 0xFF, 0x4D, 0x9C, 0xFF, 0xB2, 0xD5, 0xFF, 0x49, 0x7B, 0xFF, 0x27, 0x52, 0xFF, 0x4A, 0x83, 0xFF, 0x51, 0xBD, 0xFF, 0x52, 0xCD, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x52, 0xCD, 0xFF, 0x7A, 0xFF, 0xFF, 0xB9, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0xE5, 0xFF, 0xE9, 0x7A, 0xFF, 0xF1, 0xA4, 0xFF, 0xC8, 0x82, 0xFF, 0xA8, 0x6A, 0xFF, 0x8A, 0x8B, 0xFF, 0x26, 0x6A, 0xFF, 0xD0, 0xBC, 0xFF, 0xC9, 0x6A, 0xFF, 0x88, 0x62, 0xFF, 0x88, 0x62, 0xFF, 0x8F, 0xA4, 0xFF, 0xA8, 0x62, 0xFF, 0x88, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x0D, 0x9C, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xE9, 0x6A, 0xFF,
-    0xC9, 0x6A, 0xFF, 0xCB, 0x8B, 0xFF, 0xA8, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x87, 0x5A, 0xFF, 0x87, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0xC8, 0x62, 0xFF, 0x2A, 0x73, 0xFF, 0x09, 0x6B, 0xFF, 0xD7, 0xEE, 0xFF, 0x67, 0x5A, 0xFF, 0x29, 0x73, 0xFF, 0xC8, 0x62, 0xFF, 0x29, 0x73, 0xFF, 0xA8, 0x62, 0xFF, 0x43, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x44, 0x29, 0xFF, 0x66, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0xC5, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0x93, 0xBD, 0xFF, 0xA8, 0x62, 0xFF, 0x87, 0x5A, 0xFF, 0x64, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0x4C, 0x9C, 0xFF, 0x06, 0x4A, 0xFF, 0xC5, 0x41, 0xFF, 0xE6, 0x49, 0xFF, 0xCC, 0x8B, 0xFF, 0xA9, 0x62, 0xFF, 0x26, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xEC, 0x93, 0xFF, 0x51, 0xC5, 0xFF, 0x26, 0x52, 0xFF, 0x09, 0x73, 0xFF, 0xC9, 0x62, 0xFF, 0x71, 0xC5, 0xFF, 0x47, 0x5A, 0xFF, 0x0C, 0x8C, 0xFF, 0x67, 0x62, 0xFF, 0x6B, 0x83, 0xFF, 0xC8, 0x6A, 0xFF, 0xE9, 0x6A, 0xFF, 0xA9, 0x62, 0xFF, 0x4A, 0x7B, 0xFF, 0x0D, 0x94, 0xFF, 0x0C, 0x8C, 0xFF, 0x68, 0x5A, 0xFF, 0x4B, 0x7B, 0xFF, 0x19, 0xFF, 0xFF, 0x2A, 0x83, 0xFF, 0xAC, 0x9B, 0xFF, 0x93, 0xE5, 0xFF, 0x6B, 0x93, 0xFF, 0xE9, 0x6A, 0xFF, 0x4B, 0x7B, 0xFF,
-    0xD0, 0xB4, 0xFF, 0xC8, 0x6A, 0xFF, 0x0D, 0xA4, 0xFF, 0x67, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0xAC, 0x83, 0xFF, 0x67, 0x5A, 0xFF, 0x4E, 0x94, 0xFF, 0xAB, 0x83, 0xFF, 0xA8, 0x5A, 0xFF, 0x87, 0x5A, 0xFF, 0x13, 0xD6, 0xFF, 0x26, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0xA8, 0x62, 0xFF, 0xAC, 0x83, 0xFF, 0x47, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x6E, 0xA4, 0xFF, 0x2A, 0x73, 0xFF, 0xEC, 0x8B, 0xFF, 0x09, 0x6B, 0xFF, 0x4A, 0x73, 0xFF, 0x09, 0x6B, 0xFF, 0x0C, 0x94, 0xFF, 0x8A, 0x83, 0xFF, 0xAB, 0x83, 0xFF, 0x6A, 0x7B, 0xFF, 0x4A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0xAB, 0x83, 0xFF, 0xA8, 0x62, 0xFF, 0x68, 0x52, 0xFF, 0x64, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xA8, 0x62, 0xFF, 0x84, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xE7, 0x62, 0xFF, 0xA5, 0x39, 0xFF, 0x4A, 0x7B, 0xFF, 0xC5, 0x41, 0xFF, 0x4D, 0x9C, 0xFF, 0x64, 0x31, 0xFF, 0x47, 0x52, 0xFF, 0x6A, 0x7B, 0xFF, 0x10, 0xB5, 0xFF, 0x09, 0x6B, 0xFF, 0x06, 0x4A, 0xFF, 0x68, 0x5A, 0xFF, 0x2D, 0x94, 0xFF, 0x6A, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x0A, 0x73, 0xFF, 0x87, 0x62, 0xFF, 0x2D, 0x9C, 0xFF, 0x09, 0x6B, 0xFF, 0x67, 0x5A, 0xFF, 0xC8, 0x6A, 0xFF, 0xC9, 0x6A, 0xFF, 0x8B, 0x83, 0xFF,
-    0xE9, 0x6A, 0xFF, 0xA8, 0x62, 0xFF, 0x6A, 0x7B, 0xFF, 0x0D, 0x8C, 0xFF, 0xEC, 0x93, 0xFF, 0x88, 0x62, 0xFF, 0x2E, 0x94, 0xFF, 0xA9, 0x62, 0xFF, 0x4A, 0x7B, 0xFF, 0x10, 0xBD, 0xFF, 0x0A, 0x7B, 0xFF, 0x0A, 0x73, 0xFF, 0x9A, 0xF7, 0xFF, 0x4A, 0x7B, 0xFF, 0xAC, 0x8B, 0xFF, 0xAC, 0x83, 0xFF, 0x09, 0x6B, 0xFF, 0x2A, 0x7B, 0xFF, 0xC9, 0x6A, 0xFF, 0x6E, 0xA4, 0xFF, 0x0C, 0x8C, 0xFF, 0x2A, 0x73, 0xFF, 0x4D, 0x9C, 0xFF, 0xE9, 0x6A, 0xFF, 0xA8, 0x62, 0xFF, 0x8E, 0xA4, 0xFF, 0x8D, 0x9C, 0xFF, 0xA8, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x87, 0x62, 0xFF, 0xAB, 0x8B, 0xFF, 0xA9, 0x62, 0xFF, 0x4E, 0x9C, 0xFF, 0xA8, 0x62, 0xFF, 0x6A, 0x7B, 0xFF, 0x8E, 0x9C, 0xFF, 0x4A, 0x73, 0xFF, 0x6A, 0x73, 0xFF, 0x8E, 0xAC, 0xFF, 0x6A, 0x7B, 0xFF, 0xCF, 0xA4, 0xFF, 0x4A, 0x7B, 0xFF, 0x09, 0x73, 0xFF, 0xCC, 0x8B, 0xFF, 0xE9, 0x6A, 0xFF, 0x8A, 0x7B, 0xFF, 0xC7, 0x62, 0xFF, 0x44, 0x29, 0xFF, 0x27, 0x4A, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x44, 0x29, 0xFF, 0x84, 0x39, 0xFF, 0x46, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x44, 0x31, 0xFF, 0x06, 0x4A, 0xFF, 0x49, 0x73, 0xFF, 0xE5, 0x41, 0xFF, 0x67, 0x52, 0xFF, 0xE5, 0x41, 0xFF, 0xA8, 0x5A, 0xFF,
-    0x0C, 0x9C, 0xFF, 0xCF, 0xB4, 0xFF, 0xA8, 0x5A, 0xFF, 0x67, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0xB1, 0xCD, 0xFF, 0xC8, 0x6A, 0xFF, 0x46, 0x52, 0xFF, 0x67, 0x5A, 0xFF, 0x70, 0xC5, 0xFF, 0xC8, 0x6A, 0xFF, 0xC9, 0x6A, 0xFF, 0x6B, 0x7B, 0xFF, 0x92, 0xD5, 0xFF, 0xA8, 0x6A, 0xFF, 0x2A, 0x7B, 0xFF, 0x0A, 0x73, 0xFF, 0x08, 0x73, 0xFF, 0xCC, 0x8B, 0xFF, 0xC8, 0x6A, 0xFF, 0x2A, 0x7B, 0xFF, 0x31, 0xBD, 0xFF, 0xAB, 0x83, 0xFF, 0x88, 0x5A, 0xFF, 0x2B, 0x7B, 0xFF, 0xCF, 0xB4, 0xFF, 0x0A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0x53, 0xBD, 0xFF, 0x8B, 0x83, 0xFF, 0xEC, 0x93, 0xFF, 0x93, 0xBD, 0xFF, 0x2A, 0x7B, 0xFF, 0x4E, 0xA4, 0xFF, 0xAB, 0x83, 0xFF, 0x2E, 0x9C, 0xFF, 0xAC, 0x8B, 0xFF, 0x2A, 0x7B, 0xFF, 0xA8, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x8F, 0xA4, 0xFF, 0x88, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x09, 0x6B, 0xFF, 0x87, 0x62, 0xFF, 0x8B, 0x7B, 0xFF, 0x88, 0x5A, 0xFF, 0xA8, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0xA7, 0x6A, 0xFF, 0x4A, 0x7B, 0xFF, 0x29, 0x73, 0xFF, 0x6A, 0x7B, 0xFF, 0x4A, 0x73, 0xFF, 0x8A, 0x83, 0xFF, 0x2D, 0x9C, 0xFF, 0xAB, 0x83, 0xFF, 0xE8, 0x6A, 0xFF, 0x8A, 0x83, 0xFF, 0x08, 0x6B, 0xFF, 0xF0, 0xAC, 0xFF, 0xE8, 0x6A, 0xFF,
-    0xA9, 0x5A, 0xFF, 0x64, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0x68, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0x84, 0x31, 0xFF, 0x67, 0x5A, 0xFF, 0x84, 0x31, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x6B, 0x73, 0xFF, 0x4A, 0x7B, 0xFF, 0x27, 0x52, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x52, 0xFF, 0x0C, 0x94, 0xFF, 0xA8, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x8B, 0x83, 0xFF, 0xC9, 0x6A, 0xFF, 0x87, 0x5A, 0xFF, 0xB4, 0xC5, 0xFF, 0x26, 0x5A, 0xFF, 0x4D, 0xA4, 0xFF, 0xA8, 0x6A, 0xFF, 0x36, 0xD6, 0xFF, 0x88, 0x6A, 0xFF, 0xA8, 0x6A, 0xFF, 0x0C, 0x94, 0xFF, 0x08, 0x6B, 0xFF, 0xEC, 0x8B, 0xFF, 0xC9, 0x6A, 0xFF, 0xC8, 0x6A, 0xFF, 0xAF, 0xA4, 0xFF, 0x8A, 0x83, 0xFF, 0x47, 0x52, 0xFF, 0xE9, 0x6A, 0xFF, 0xB0, 0xB4, 0xFF, 0x2A, 0x7B, 0xFF, 0x2A, 0x7B, 0xFF, 0x11, 0xBD, 0xFF, 0x6B, 0x83, 0xFF, 0x2E, 0x9C, 0xFF, 0x09, 0x73, 0xFF, 0x7A, 0xFF, 0xFF, 0x8B, 0x83, 0xFF, 0x6B, 0x7B, 0xFF, 0xAC, 0x8B, 0xFF, 0x6F, 0xAC, 0xFF, 0x0A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0xC8, 0x6A, 0xFF, 0x9A, 0xFF, 0xFF, 0x88, 0x62, 0xFF, 0xC8, 0x62, 0xFF, 0x6B, 0x7B, 0xFF, 0x0D, 0x94, 0xFF, 0xE9, 0x6A, 0xFF, 0x6B, 0x7B, 0xFF, 0x6E, 0x9C, 0xFF,
-    0xA9, 0x62, 0xFF, 0x91, 0xC5, 0xFF, 0xCF, 0xAC, 0xFF, 0x4A, 0x7B, 0xFF, 0x49, 0x73, 0xFF, 0x8B, 0x83, 0xFF, 0xAC, 0x8B, 0xFF, 0x6A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0xCB, 0x83, 0xFF, 0x0C, 0x94, 0xFF, 0x4A, 0x7B, 0xFF, 0xF0, 0xB4, 0xFF, 0x29, 0x73, 0xFF, 0x6A, 0x7B, 0xFF, 0x29, 0x73, 0xFF, 0x64, 0x31, 0xFF, 0x43, 0x29, 0xFF, 0xC5, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x68, 0x52, 0xFF, 0xE6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xC6, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x8B, 0x83, 0xFF, 0x84, 0x39, 0xFF, 0x47, 0x52, 0xFF, 0xAC, 0x83, 0xFF, 0x4A, 0x73, 0xFF, 0x27, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x27, 0x4A, 0xFF, 0x46, 0x52, 0xFF, 0x08, 0x6B, 0xFF, 0x87, 0x5A, 0xFF, 0x87, 0x5A, 0xFF, 0xA8, 0x6A, 0xFF, 0x2A, 0x7B, 0xFF, 0x2A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x7B, 0xFF, 0x51, 0xB5, 0xFF, 0x0D, 0x94, 0xFF, 0xE9, 0x72, 0xFF, 0x6D, 0x9C, 0xFF, 0xE9, 0x72, 0xFF, 0x8E, 0xAC, 0xFF, 0x6A, 0x7B, 0xFF, 0xED, 0x8B, 0xFF, 0xE9, 0x6A, 0xFF, 0x2D, 0x9C, 0xFF, 0x8F, 0x9C, 0xFF, 0x6B, 0x83, 0xFF, 0xC9, 0x62, 0xFF, 0xC9, 0x6A, 0xFF, 0x4E, 0x9C, 0xFF, 0x4B, 0x83, 0xFF, 0xAF, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xBC, 0xFF, 0x2E, 0xA4, 0xFF, 0x2A, 0x73, 0xFF,
-    0x52, 0xC5, 0xFF, 0x0D, 0x8C, 0xFF, 0x6E, 0xA4, 0xFF, 0x6A, 0x83, 0xFF, 0x6B, 0x7B, 0xFF, 0x09, 0x6B, 0xFF, 0x8B, 0x83, 0xFF, 0x92, 0xC5, 0xFF, 0xC8, 0x6A, 0xFF, 0xA8, 0x62, 0xFF, 0xCC, 0x8B, 0xFF, 0xCF, 0xAC, 0xFF, 0xC8, 0x62, 0xFF, 0xC9, 0x62, 0xFF, 0x4E, 0xA4, 0xFF, 0xE9, 0x6A, 0xFF, 0xAB, 0x83, 0xFF, 0x09, 0x73, 0xFF, 0xCC, 0x8B, 0xFF, 0x29, 0x73, 0xFF, 0x92, 0xCD, 0xFF, 0x6A, 0x7B, 0xFF, 0x0D, 0x94, 0xFF, 0x29, 0x73, 0xFF, 0x29, 0x73, 0xFF, 0xEC, 0x8B, 0xFF, 0xEC, 0x93, 0xFF, 0x29, 0x73, 0xFF, 0xCB, 0x8B, 0xFF, 0xCC, 0x8B, 0xFF, 0x2C, 0x94, 0xFF, 0x4A, 0x7B, 0xFF, 0x44, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0xC5, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0xC6, 0x39, 0xFF, 0x2A, 0x6B, 0xFF, 0x88, 0x52, 0xFF, 0x64, 0x31, 0xFF, 0x27, 0x4A, 0xFF, 0x68, 0x52, 0xFF, 0xCC, 0x83, 0xFF, 0xA4, 0x41, 0xFF, 0xAC, 0x83, 0xFF, 0x67, 0x5A, 0xFF, 0xE5, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0xC9, 0x6A, 0xFF, 0x8C, 0x8B, 0xFF, 0x0A, 0x73, 0xFF, 0xEC, 0x93, 0xFF, 0x2A, 0x7B, 0xFF, 0xAC, 0xAB, 0xFF, 0x55, 0xE6, 0xFF, 0x4A, 0x7B, 0xFF, 0xAB, 0x8B, 0xFF, 0x4A, 0x7B, 0xFF, 0x96, 0xEE, 0xFF, 0xE8, 0x72, 0xFF, 0x4A, 0x83, 0xFF, 0x6F, 0xA4, 0xFF,
-    0x6E, 0xA4, 0xFF, 0x09, 0x73, 0xFF, 0x77, 0xDE, 0xFF, 0xC8, 0x62, 0xFF, 0x57, 0xD6, 0xFF, 0xD0, 0xAC, 0xFF, 0xDD, 0xFF, 0xFF, 0xC9, 0x62, 0xFF, 0x2A, 0x73, 0xFF, 0x2E, 0x9C, 0xFF, 0x2E, 0x9C, 0xFF, 0xB0, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xBC, 0xFF, 0x8C, 0x8B, 0xFF, 0xED, 0x93, 0xFF, 0x4B, 0x7B, 0xFF, 0x2A, 0x7B, 0xFF, 0x73, 0xCD, 0xFF, 0x0C, 0x9C, 0xFF, 0x0A, 0x73, 0xFF, 0x4A, 0x83, 0xFF, 0xB3, 0xCD, 0xFF, 0xE9, 0x6A, 0xFF, 0xA8, 0x6A, 0xFF, 0xC8, 0x7A, 0xFF, 0x6D, 0xA4, 0xFF, 0x0A, 0x73, 0xFF, 0xA8, 0x6A, 0xFF, 0x4A, 0x8B, 0xFF, 0xAF, 0xA4, 0xFF, 0xE8, 0x6A, 0xFF, 0x6E, 0x9C, 0xFF, 0x2A, 0x7B, 0xFF, 0x31, 0xB5, 0xFF, 0xAE, 0xA4, 0xFF, 0x2D, 0x94, 0xFF, 0xEC, 0x8B, 0xFF, 0x8B, 0x83, 0xFF, 0x0C, 0x94, 0xFF, 0x4A, 0x7B, 0xFF, 0xEC, 0x8B, 0xFF, 0xCB, 0x8B, 0xFF, 0xAB, 0x8B, 0xFF, 0x4D, 0x9C, 0xFF, 0xAB, 0x83, 0xFF, 0xEC, 0x93, 0xFF, 0x6A, 0x7B, 0xFF, 0x84, 0x31, 0xFF, 0xC6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xC6, 0x49, 0xFF, 0x8C, 0x8B, 0xFF, 0xE5, 0x49, 0xFF, 0x06, 0x4A, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x6B, 0x8B, 0xFF, 0xA8, 0x62, 0xFF, 0xA4, 0x39, 0xFF, 0xA8, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x87, 0x5A, 0xFF, 0x4A, 0x7B, 0xFF,
-    0x68, 0x5A, 0xFF, 0x87, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0xA8, 0x6A, 0xFF, 0x0C, 0x9C, 0xFF, 0xAC, 0x9B, 0xFF, 0xD0, 0xC4, 0xFF, 0x4E, 0xAC, 0xFF, 0x76, 0xF6, 0xFF, 0x4A, 0x7B, 0xFF, 0x8C, 0x83, 0xFF, 0xAB, 0x8B, 0xFF, 0xB3, 0xDD, 0xFF, 0x0F, 0xC5, 0xFF, 0x0C, 0xA4, 0xFF, 0x6B, 0x8B, 0xFF, 0x48, 0x83, 0xFF, 0x6A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0xEC, 0x93, 0xFF, 0xD0, 0xB4, 0xFF, 0x0D, 0x9C, 0xFF, 0xC9, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0xF0, 0xBC, 0xFF, 0x6B, 0x83, 0xFF, 0x2E, 0x9C, 0xFF, 0x8F, 0xB4, 0xFF, 0x2E, 0xAC, 0xFF, 0x6B, 0x7B, 0xFF, 0xE8, 0x6A, 0xFF, 0x2A, 0x7B, 0xFF, 0x8E, 0xAC, 0xFF, 0x6B, 0x83, 0xFF, 0x8C, 0x8B, 0xFF, 0x4B, 0x7B, 0xFF, 0xAF, 0xB4, 0xFF, 0x4B, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF, 0x13, 0xE6, 0xFF, 0x6A, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF, 0xD0, 0xAC, 0xFF, 0x09, 0x73, 0xFF, 0x6B, 0x7B, 0xFF, 0x6B, 0x7B, 0xFF, 0xE8, 0x72, 0xFF, 0x09, 0x73, 0xFF, 0xEC, 0x93, 0xFF, 0x4A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0x8B, 0x83, 0xFF, 0xAF, 0xA4, 0xFF, 0x0C, 0x94, 0xFF, 0xCB, 0x8B, 0xFF, 0xEC, 0x93, 0xFF, 0xEC, 0x93, 0xFF, 0x0C, 0x94, 0xFF, 0x6E, 0xA4, 0xFF, 0xEC, 0x8B, 0xFF, 0xEC, 0x8B, 0xFF, 0x2C, 0x94, 0xFF, 0x8A, 0x83, 0xFF,
-    0xE5, 0x49, 0xFF, 0x09, 0x73, 0xFF, 0x87, 0x52, 0xFF, 0x5A, 0xFF, 0xFF, 0x27, 0x4A, 0xFF, 0xC4, 0x49, 0xFF, 0x2A, 0x83, 0xFF, 0xA8, 0x62, 0xFF, 0xCD, 0x8B, 0xFF, 0xA4, 0x39, 0xFF, 0x67, 0x5A, 0xFF, 0xEC, 0x9B, 0xFF, 0x14, 0xD6, 0xFF, 0x8B, 0x8B, 0xFF, 0x88, 0x5A, 0xFF, 0x46, 0x5A, 0xFF, 0x4D, 0xA4, 0xFF, 0xE6, 0x51, 0xFF, 0x88, 0x62, 0xFF, 0x0C, 0xA4, 0xFF, 0x8C, 0x83, 0xFF, 0xD3, 0xDD, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xFE, 0xFF, 0x72, 0xC5, 0xFF, 0x0D, 0xA4, 0xFF, 0xAF, 0xB4, 0xFF, 0xAF, 0xB4, 0xFF, 0xF4, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xCC, 0xFF, 0xDD, 0xFF, 0xFF, 0x2C, 0x9C, 0xFF, 0xAF, 0x9C, 0xFF, 0x5A, 0xF7, 0xFF, 0x52, 0xC5, 0xFF, 0x52, 0xBD, 0xFF, 0x8B, 0x8B, 0xFF, 0x88, 0x5A, 0xFF, 0x32, 0xB5, 0xFF, 0x72, 0xCD, 0xFF, 0x0A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0xAB, 0x8B, 0xFF, 0xC8, 0x6A, 0xFF, 0x6B, 0x83, 0xFF, 0xD3, 0xE5, 0xFF, 0x4A, 0x83, 0xFF, 0x8F, 0xA4, 0xFF, 0x0A, 0x7B, 0xFF, 0xF1, 0xBC, 0xFF, 0x72, 0xCD, 0xFF, 0xA8, 0x6A, 0xFF, 0x6C, 0x83, 0xFF, 0xAC, 0x8B, 0xFF, 0x8F, 0xA4, 0xFF, 0x4D, 0x94, 0xFF, 0x4A, 0x7B, 0xFF, 0x09, 0x7B, 0xFF, 0xE9, 0x6A, 0xFF, 0x8E, 0xA4, 0xFF, 0x10, 0xB5, 0xFF, 0x6E, 0xA4, 0xFF,
-    0x6B, 0x83, 0xFF, 0x6A, 0x83, 0xFF, 0x29, 0x7B, 0xFF, 0xF2, 0xD5, 0xFF, 0x90, 0xBD, 0xFF, 0x2D, 0x94, 0xFF, 0x8F, 0xA4, 0xFF, 0x0C, 0x94, 0xFF, 0xEC, 0x93, 0xFF, 0x16, 0xEF, 0xFF, 0x4D, 0x94, 0xFF, 0x2C, 0x94, 0xFF, 0x4D, 0x9C, 0xFF, 0x0C, 0x94, 0xFF, 0xD1, 0xC5, 0xFF, 0xEC, 0x8B, 0xFF, 0x67, 0x5A, 0xFF, 0xA4, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0xCC, 0x8B, 0xFF, 0xD5, 0xCD, 0xFF, 0x6B, 0x83, 0xFF, 0x69, 0x8B, 0xFF, 0x26, 0x4A, 0xFF, 0x0D, 0x94, 0xFF, 0x06, 0x52, 0xFF, 0x4A, 0x7B, 0xFF, 0xA5, 0x41, 0xFF, 0x56, 0xDE, 0xFF, 0x6A, 0x8B, 0xFF, 0xE8, 0x7A, 0xFF, 0xB0, 0x9C, 0xFF, 0x27, 0x4A, 0xFF, 0x2A, 0x73, 0xFF, 0xD0, 0xC4, 0xFF, 0xC9, 0x7A, 0xFF, 0x4E, 0x9C, 0xFF, 0x8B, 0x93, 0xFF, 0xD3, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xD5, 0xFF, 0x93, 0xD5, 0xFF, 0x10, 0xC5, 0xFF, 0x50, 0xD5, 0xFF, 0x32, 0xD5, 0xFF, 0x32, 0xD5, 0xFF, 0x2D, 0xA4, 0xFF, 0x52, 0xDD, 0xFF, 0x6B, 0x8B, 0xFF, 0x2D, 0x9C, 0xFF, 0x2A, 0x7B, 0xFF, 0x4D, 0xA4, 0xFF, 0xC9, 0x62, 0xFF, 0x2D, 0x9C, 0xFF, 0x47, 0x52, 0xFF, 0x09, 0x7B, 0xFF, 0x4E, 0xA4, 0xFF, 0x4E, 0xA4, 0xFF, 0x2A, 0x73, 0xFF, 0xF8, 0xEE, 0xFF, 0xE9, 0x6A, 0xFF, 0xED, 0x93, 0xFF, 0xC8, 0x6A, 0xFF,
-    0x6B, 0x83, 0xFF, 0xE9, 0x72, 0xFF, 0x0A, 0x83, 0xFF, 0x11, 0xC5, 0xFF, 0x8B, 0x93, 0xFF, 0xEC, 0x9B, 0xFF, 0x09, 0x7B, 0xFF, 0xD4, 0xCD, 0xFF, 0x8F, 0xA4, 0xFF, 0xAF, 0xA4, 0xFF, 0x8F, 0xA4, 0xFF, 0x6B, 0x83, 0xFF, 0x8F, 0xAC, 0xFF, 0xEC, 0x93, 0xFF, 0x2A, 0x7B, 0xFF, 0x6A, 0x7B, 0xFF, 0xCC, 0x93, 0xFF, 0x33, 0xE6, 0xFF, 0xCF, 0xC4, 0xFF, 0xAF, 0xB4, 0xFF, 0x8E, 0xAC, 0xFF, 0x50, 0xBD, 0xFF, 0x2C, 0x9C, 0xFF, 0x4D, 0x9C, 0xFF, 0x4D, 0x9C, 0xFF, 0x6E, 0xA4, 0xFF, 0x71, 0xD5, 0xFF, 0x8E, 0xA4, 0xFF, 0xAE, 0xA4, 0xFF, 0x2D, 0x94, 0xFF, 0x2C, 0x94, 0xFF, 0x4C, 0x9C, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0xA9, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0xA5, 0x41, 0xFF, 0x8B, 0x7B, 0xFF, 0x2B, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0xCB, 0x93, 0xFF, 0x2D, 0x94, 0xFF, 0x18, 0xF7, 0xFF, 0x4A, 0xA4, 0xFF, 0xCF, 0xBC, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x52, 0xFF, 0x67, 0x6A, 0xFF, 0x49, 0x83, 0xFF, 0xB3, 0xDD, 0xFF, 0xCC, 0x9B, 0xFF, 0x51, 0xD5, 0xFF, 0x8F, 0xC4, 0xFF, 0x76, 0xFE, 0xFF, 0xB2, 0xDD, 0xFF, 0xEC, 0x9B, 0xFF, 0xEF, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xED, 0xFF, 0xAC, 0x9B, 0xFF, 0xAB, 0x8B, 0xFF,
-    0x8E, 0xB4, 0xFF, 0x4C, 0xA4, 0xFF, 0xAC, 0x8B, 0xFF, 0xCC, 0x8B, 0xFF, 0xCF, 0xAC, 0xFF, 0xEF, 0xB4, 0xFF, 0x72, 0xBD, 0xFF, 0x07, 0x4A, 0xFF, 0x6A, 0x83, 0xFF, 0x72, 0xC5, 0xFF, 0x6E, 0xA4, 0xFF, 0xA9, 0x62, 0xFF, 0x6A, 0x7B, 0xFF, 0xAB, 0x8B, 0xFF, 0x2A, 0x7B, 0xFF, 0x8B, 0x8B, 0xFF, 0x2A, 0x7B, 0xFF, 0x8B, 0x8B, 0xFF, 0x6F, 0xB4, 0xFF, 0xF0, 0xDC, 0xFF, 0x7A, 0xFF, 0xFF, 0xAF, 0xC4, 0xFF, 0x2D, 0xA4, 0xFF, 0xAC, 0x8B, 0xFF, 0x17, 0xFF, 0xFF, 0x8B, 0x83, 0xFF, 0xF0, 0xB4, 0xFF, 0xF0, 0xB4, 0xFF, 0x6A, 0x7B, 0xFF, 0x6B, 0x83, 0xFF, 0x4E, 0x9C, 0xFF, 0x38, 0xFF, 0xFF, 0xCD, 0x8B, 0xFF, 0x8E, 0xB4, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xF6, 0xFF, 0xAE, 0xAC, 0xFF, 0xAE, 0xAC, 0xFF, 0xCF, 0xC4, 0xFF, 0xF7, 0xFE, 0xFF, 0x31, 0xC5, 0xFF, 0x8F, 0xAC, 0xFF, 0x8E, 0xA4, 0xFF, 0xAE, 0xAC, 0xFF, 0x10, 0xBD, 0xFF, 0x6D, 0xA4, 0xFF, 0x4D, 0xA4, 0xFF, 0x64, 0x31, 0xFF, 0xE6, 0x49, 0xFF, 0xC5, 0x39, 0xFF, 0x2A, 0x7B, 0xFF, 0xA5, 0x39, 0xFF, 0xA8, 0x5A, 0xFF, 0xC5, 0x39, 0xFF, 0x06, 0x42, 0xFF, 0x0D, 0x94, 0xFF, 0xAF, 0xA4, 0xFF, 0x4D, 0x94, 0xFF, 0xE5, 0x49, 0xFF, 0x2A, 0x73, 0xFF, 0xAC, 0x8B, 0xFF, 0x4A, 0x7B, 0xFF, 0x67, 0x52, 0xFF,
-    0x06, 0x4A, 0xFF, 0xE9, 0x6A, 0xFF, 0xEB, 0x93, 0xFF, 0x6E, 0xA4, 0xFF, 0x09, 0x73, 0xFF, 0x49, 0x93, 0xFF, 0xEC, 0x9B, 0xFF, 0x6A, 0x8B, 0xFF, 0x2A, 0x83, 0xFF, 0xF7, 0xFE, 0xFF, 0xAC, 0x93, 0xFF, 0xEC, 0x93, 0xFF, 0x55, 0xFE, 0xFF, 0xF6, 0xFE, 0xFF, 0x8E, 0xB4, 0xFF, 0x29, 0x83, 0xFF, 0x4A, 0x83, 0xFF, 0x30, 0xC5, 0xFF, 0x2D, 0x9C, 0xFF, 0x38, 0xEF, 0xFF, 0xC7, 0x6A, 0xFF, 0xD3, 0xCD, 0xFF, 0x4E, 0x9C, 0xFF, 0x47, 0x52, 0xFF, 0xCB, 0x93, 0xFF, 0x8F, 0xAC, 0xFF, 0x4A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0xC8, 0x6A, 0xFF, 0x2C, 0xA4, 0xFF, 0x11, 0xBD, 0xFF, 0x2D, 0x9C, 0xFF, 0xCD, 0x93, 0xFF, 0x39, 0xF7, 0xFF, 0x11, 0xD5, 0xFF, 0xB6, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xFE, 0xFF, 0x71, 0xC5, 0xFF, 0xF9, 0xE6, 0xFF, 0x6E, 0xA4, 0xFF, 0x72, 0xC5, 0xFF, 0x4E, 0xA4, 0xFF, 0xAB, 0x8B, 0xFF, 0x92, 0xCD, 0xFF, 0x6A, 0x83, 0xFF, 0x6A, 0x93, 0xFF, 0xAC, 0x93, 0xFF, 0xD0, 0xBC, 0xFF, 0xD3, 0xDD, 0xFF, 0x74, 0xFE, 0xFF, 0xB6, 0xFE, 0xFF, 0x30, 0xC5, 0xFF, 0x51, 0xCD, 0xFF, 0xB2, 0xD5, 0xFF, 0x92, 0xD5, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0xCD, 0xFF, 0x6E, 0xA4, 0xFF, 0xAE, 0xAC, 0xFF, 0x6E, 0xA4, 0xFF, 0x30, 0xBD, 0xFF, 0x34, 0xDE, 0xFF,
-    0xC5, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x47, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x84, 0x31, 0xFF, 0x07, 0x4A, 0xFF, 0xC5, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0x27, 0x4A, 0xFF, 0xC9, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0xE6, 0x49, 0xFF, 0x27, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x6E, 0x9C, 0xFF, 0xEC, 0x8B, 0xFF, 0x26, 0x4A, 0xFF, 0x88, 0x5A, 0xFF, 0xA7, 0x62, 0xFF, 0xCB, 0x8B, 0xFF, 0x10, 0xAD, 0xFF, 0xC8, 0x72, 0xFF, 0x0D, 0x94, 0xFF, 0xF8, 0xEE, 0xFF, 0x11, 0xAD, 0xFF, 0xD0, 0xAC, 0xFF, 0xA8, 0x6A, 0xFF, 0x14, 0xC6, 0xFF, 0x6B, 0x8B, 0xFF, 0xEC, 0x93, 0xFF, 0x6A, 0x7B, 0xFF, 0xAB, 0x83, 0xFF, 0xC7, 0x6A, 0xFF, 0x8B, 0x83, 0xFF, 0x71, 0xBD, 0xFF, 0xD0, 0xAC, 0xFF, 0x6A, 0x7B, 0xFF, 0x2D, 0x8C, 0xFF, 0x8A, 0x83, 0xFF, 0x47, 0x52, 0xFF, 0xC8, 0x6A, 0xFF, 0x12, 0xB5, 0xFF, 0xE9, 0x72, 0xFF, 0x88, 0x5A, 0xFF, 0xA8, 0x6A, 0xFF, 0x6B, 0x7B, 0xFF, 0x4B, 0x7B, 0xFF, 0x29, 0x73, 0xFF, 0x8B, 0x8B, 0xFF, 0x6B, 0x83, 0xFF, 0x8A, 0x93, 0xFF, 0x51, 0xE5, 0xFF, 0x30, 0xE5, 0xFF, 0x4D, 0xAC, 0xFF, 0x8F, 0xB4, 0xFF, 0x31, 0xC5, 0xFF, 0x8B, 0x83, 0xFF, 0xEC, 0x93, 0xFF, 0xEC, 0x9B, 0xFF, 0xAB, 0x8B, 0xFF, 0x6A, 0x83, 0xFF, 0xCC, 0x8B, 0xFF, 0xED, 0x93, 0xFF, 0xAC, 0x93, 0xFF,
-    0xEC, 0x93, 0xFF, 0x8E, 0xA4, 0xFF, 0xF0, 0xBC, 0xFF, 0xF0, 0xB4, 0xFF, 0x6E, 0xAC, 0xFF, 0xB6, 0xDE, 0xFF, 0xD6, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xF6, 0xFE, 0xFF, 0xEF, 0xC4, 0xFF, 0x10, 0xB5, 0xFF, 0xEF, 0xB4, 0xFF, 0x4D, 0xA4, 0xFF, 0xCF, 0xAC, 0xFF, 0x6E, 0xA4, 0xFF, 0x4D, 0xA4, 0xFF, 0x23, 0x29, 0xFF, 0x6B, 0x7B, 0xFF, 0x0A, 0x73, 0xFF, 0xC5, 0x49, 0xFF, 0xA5, 0x39, 0xFF, 0x0D, 0x94, 0xFF, 0x2D, 0x94, 0xFF, 0x6A, 0x83, 0xFF, 0xA8, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0xE8, 0x72, 0xFF, 0x2D, 0x9C, 0xFF, 0x71, 0xC5, 0xFF, 0x6B, 0x83, 0xFF, 0x4B, 0x73, 0xFF, 0x09, 0x73, 0xFF, 0xCB, 0x8B, 0xFF, 0x11, 0xBD, 0xFF, 0x2A, 0x73, 0xFF, 0x6B, 0x83, 0xFF, 0x6B, 0x7B, 0xFF, 0xED, 0xA3, 0xFF, 0x31, 0xCD, 0xFF, 0x68, 0x5A, 0xFF, 0x09, 0x73, 0xFF, 0x0C, 0x94, 0xFF, 0xCC, 0x93, 0xFF, 0x79, 0xFF, 0xFF, 0xA8, 0x6A, 0xFF, 0x7A, 0xE7, 0xFF, 0x47, 0x5A, 0xFF, 0xCC, 0x93, 0xFF, 0xC8, 0x6A, 0xFF, 0x4A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0x2A, 0x73, 0xFF, 0xEC, 0x93, 0xFF, 0x8B, 0x7B, 0xFF, 0xCB, 0x8B, 0xFF, 0x68, 0x5A, 0xFF, 0x8C, 0x83, 0xFF, 0x96, 0xE6, 0xFF, 0xA8, 0x6A, 0xFF, 0x8C, 0x7B, 0xFF, 0x29, 0x73, 0xFF, 0x4A, 0x7B, 0xFF, 0x6B, 0x8B, 0xFF, 0xCC, 0x93, 0xFF,
-    0x4A, 0x7B, 0xFF, 0xAB, 0x83, 0xFF, 0x09, 0x83, 0xFF, 0x6B, 0x8B, 0xFF, 0xF0, 0xB4, 0xFF, 0x30, 0xC5, 0xFF, 0xAB, 0x8B, 0xFF, 0xAC, 0x8B, 0xFF, 0x2E, 0x9C, 0xFF, 0x72, 0xBD, 0xFF, 0x0D, 0x94, 0xFF, 0x6E, 0xA4, 0xFF, 0xAB, 0x8B, 0xFF, 0x6E, 0xA4, 0xFF, 0x75, 0xDE, 0xFF, 0x2D, 0x9C, 0xFF, 0xED, 0x93, 0xFF, 0x2D, 0x94, 0xFF, 0xCF, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x34, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xBD, 0xFF, 0xCF, 0xAC, 0xFF, 0x13, 0xCE, 0xFF, 0x96, 0xDE, 0xFF, 0x16, 0xF7, 0xFF, 0x2C, 0x94, 0xFF, 0xA5, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x85, 0x39, 0xFF, 0x85, 0x31, 0xFF, 0x67, 0x5A, 0xFF, 0x83, 0x31, 0xFF, 0x6A, 0x73, 0xFF, 0xC5, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0x6A, 0x7B, 0xFF, 0xAE, 0xA4, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x5A, 0xFF, 0x4E, 0x9C, 0xFF, 0x6B, 0x83, 0xFF, 0xC5, 0x49, 0xFF, 0x29, 0x7B, 0xFF, 0x30, 0xC5, 0xFF, 0x8D, 0xB4, 0xFF, 0xCC, 0x93, 0xFF, 0x09, 0x6B, 0xFF, 0x0A, 0x73, 0xFF, 0xF0, 0xBC, 0xFF, 0x8B, 0x8B, 0xFF, 0x2A, 0x73, 0xFF, 0x6B, 0x83, 0xFF, 0xB6, 0xE6, 0xFF, 0x49, 0x83, 0xFF, 0x09, 0x73, 0xFF, 0x87, 0x62, 0xFF, 0x29, 0x7B, 0xFF,
-    0xAF, 0xBC, 0xFF, 0xA7, 0x6A, 0xFF, 0xE9, 0x6A, 0xFF, 0x4A, 0x7B, 0xFF, 0xE9, 0x6A, 0xFF, 0x87, 0x5A, 0xFF, 0xCC, 0x8B, 0xFF, 0x68, 0x52, 0xFF, 0x67, 0x5A, 0xFF, 0x8F, 0xA4, 0xFF, 0x2A, 0x73, 0xFF, 0x0A, 0x6B, 0xFF, 0x88, 0x62, 0xFF, 0x2A, 0x7B, 0xFF, 0x6A, 0x8B, 0xFF, 0xED, 0x8B, 0xFF, 0xAC, 0x83, 0xFF, 0xC8, 0x6A, 0xFF, 0x8F, 0xAC, 0xFF, 0xCC, 0x8B, 0xFF, 0xAF, 0xA4, 0xFF, 0x2E, 0x9C, 0xFF, 0xF8, 0xF6, 0xFF, 0x8F, 0xA4, 0xFF, 0x8B, 0x83, 0xFF, 0x0D, 0x94, 0xFF, 0x4A, 0x7B, 0xFF, 0xCF, 0xB4, 0xFF, 0xF0, 0xB4, 0xFF, 0xD1, 0xAC, 0xFF, 0x8B, 0x83, 0xFF, 0xD2, 0xCD, 0xFF, 0x0D, 0x94, 0xFF, 0xD3, 0xD5, 0xFF, 0x10, 0xBD, 0xFF, 0x76, 0xEE, 0xFF, 0x75, 0xE6, 0xFF, 0xB6, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xB2, 0xDD, 0xFF, 0x91, 0xCD, 0xFF, 0x6D, 0xA4, 0xFF, 0x10, 0xBD, 0xFF, 0x2C, 0x94, 0xFF, 0x4D, 0x9C, 0xFF, 0x4D, 0x9C, 0xFF, 0xCA, 0x93, 0xFF, 0x49, 0x7B, 0xFF, 0xA5, 0x39, 0xFF, 0x07, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0x47, 0x6A, 0xFF, 0x84, 0x39, 0xFF, 0xE5, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0x04, 0x72, 0xFF, 0xCC, 0x83, 0xFF, 0x29, 0x7B, 0xFF, 0x27, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0xCF, 0xAC, 0xFF, 0x6D, 0x94, 0xFF,
-    0xE5, 0x49, 0xFF, 0x4A, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0xEE, 0xFF, 0x0D, 0xA4, 0xFF, 0xE8, 0x7A, 0xFF, 0xEC, 0x93, 0xFF, 0x09, 0x73, 0xFF, 0xA8, 0x62, 0xFF, 0x52, 0xBD, 0xFF, 0xEC, 0x8B, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0xCF, 0xAC, 0xFF, 0x87, 0x62, 0xFF, 0xC9, 0x6A, 0xFF, 0x47, 0x5A, 0xFF, 0x6E, 0xA4, 0xFF, 0xE9, 0x6A, 0xFF, 0x6B, 0x7B, 0xFF, 0x2A, 0x73, 0xFF, 0xCF, 0xA4, 0xFF, 0x09, 0x73, 0xFF, 0x88, 0x5A, 0xFF, 0xC8, 0x6A, 0xFF, 0x2E, 0x94, 0xFF, 0x67, 0x62, 0xFF, 0xA8, 0x62, 0xFF, 0xC9, 0x6A, 0xFF, 0x10, 0xBD, 0xFF, 0x8C, 0x83, 0xFF, 0x32, 0xBD, 0xFF, 0xF5, 0xD5, 0xFF, 0x2D, 0x9C, 0xFF, 0xC9, 0x72, 0xFF, 0x4A, 0x7B, 0xFF, 0x35, 0xE6, 0xFF, 0x93, 0xCD, 0xFF, 0xAC, 0x83, 0xFF, 0xED, 0x93, 0xFF, 0xCC, 0x8B, 0xFF, 0x6E, 0xA4, 0xFF, 0x8B, 0x8B, 0xFF, 0x0D, 0x94, 0xFF, 0x8A, 0x8B, 0xFF, 0xF0, 0xBC, 0xFF, 0xEC, 0x93, 0xFF, 0xAB, 0x8B, 0xFF, 0xCC, 0x93, 0xFF, 0xF9, 0xEE, 0xFF, 0x0C, 0x94, 0xFF, 0x10, 0xB5, 0xFF, 0x4D, 0xAC, 0xFF, 0xB6, 0xF6, 0xFF, 0xD3, 0xE5, 0xFF, 0xD3, 0xED, 0xFF, 0x91, 0xDD, 0xFF, 0x10, 0xC5, 0xFF, 0x0F, 0xBD, 0xFF, 0x6E, 0xA4, 0xFF, 0x72, 0xC5, 0xFF, 0xAF, 0xAC, 0xFF, 0x0C, 0x94, 0xFF, 0xCB, 0x8B, 0xFF,
-    0xA5, 0x39, 0xFF, 0x28, 0x52, 0xFF, 0x65, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0x85, 0x31, 0xFF, 0x06, 0x4A, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x26, 0x52, 0xFF, 0xA5, 0x39, 0xFF, 0x68, 0x5A, 0xFF, 0xC5, 0x41, 0xFF, 0xC8, 0x6A, 0xFF, 0xC9, 0x6A, 0xFF, 0x67, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0xC8, 0x62, 0xFF, 0xCB, 0xA3, 0xFF, 0x8B, 0x9B, 0xFF, 0xE9, 0x72, 0xFF, 0x8B, 0x83, 0xFF, 0x09, 0x6B, 0xFF, 0x48, 0x52, 0xFF, 0x09, 0x6B, 0xFF, 0x29, 0x73, 0xFF, 0x68, 0x5A, 0xFF, 0x67, 0x5A, 0xFF, 0x8B, 0x83, 0xFF, 0x67, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0x6B, 0x7B, 0xFF, 0x47, 0x5A, 0xFF, 0x4A, 0x7B, 0xFF, 0xAB, 0x7B, 0xFF, 0x87, 0x5A, 0xFF, 0x29, 0x7B, 0xFF, 0x67, 0x5A, 0xFF, 0xE8, 0x6A, 0xFF, 0x88, 0x52, 0xFF, 0xC9, 0x6A, 0xFF, 0x46, 0x52, 0xFF, 0x09, 0x73, 0xFF, 0x8C, 0x7B, 0xFF, 0x6B, 0x7B, 0xFF, 0x2A, 0x7B, 0xFF, 0x2A, 0x73, 0xFF, 0x2E, 0x9C, 0xFF, 0x8F, 0xA4, 0xFF, 0xE9, 0x72, 0xFF, 0x2E, 0xA4, 0xFF, 0x8B, 0x8B, 0xFF, 0xF7, 0xE6, 0xFF, 0xD3, 0xD5, 0xFF, 0x6E, 0xA4, 0xFF, 0x0D, 0x9C, 0xFF, 0x11, 0xB5, 0xFF, 0x0D, 0x9C, 0xFF, 0x4F, 0xAC, 0xFF, 0x9D, 0xFF, 0xFF, 0xD4, 0xDD, 0xFF, 0xCB, 0x8B, 0xFF, 0x0D, 0x94, 0xFF, 0xAC, 0x8B, 0xFF,
-    0x4E, 0xA4, 0xFF, 0x2D, 0x94, 0xFF, 0x4E, 0x9C, 0xFF, 0xCF, 0xAC, 0xFF, 0x11, 0xBD, 0xFF, 0xF4, 0xED, 0xFF, 0x72, 0xCD, 0xFF, 0xCF, 0xB4, 0xFF, 0xB2, 0xCD, 0xFF, 0x51, 0xC5, 0xFF, 0x10, 0xBD, 0xFF, 0x6D, 0xA4, 0xFF, 0xAE, 0xAC, 0xFF, 0x4D, 0x9C, 0xFF, 0x0C, 0x94, 0xFF, 0xAA, 0x8B, 0xFF, 0x84, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x65, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x47, 0x52, 0xFF, 0xC5, 0x39, 0xFF, 0xA9, 0x62, 0xFF, 0xA5, 0x39, 0xFF, 0x47, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0xE5, 0x49, 0xFF, 0x84, 0x39, 0xFF, 0x47, 0x52, 0xFF, 0x46, 0x5A, 0xFF, 0xA8, 0x62, 0xFF, 0x68, 0x5A, 0xFF, 0x67, 0x5A, 0xFF, 0xE5, 0x49, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0xC8, 0x6A, 0xFF, 0x26, 0x52, 0xFF, 0x47, 0x5A, 0xFF, 0xA8, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x52, 0xFF, 0xE9, 0x6A, 0xFF, 0x26, 0x52, 0xFF, 0x8B, 0x7B, 0xFF, 0x88, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0xCC, 0x83, 0xFF, 0xE9, 0x62, 0xFF, 0x29, 0x73, 0xFF, 0x87, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0xA8, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0xE9, 0x6A, 0xFF, 0xE9, 0x6A, 0xFF, 0xE9, 0x6A, 0xFF, 0x8C, 0x83, 0xFF,
-    0xAC, 0x83, 0xFF, 0x8C, 0x83, 0xFF, 0xED, 0x93, 0xFF, 0x6B, 0x83, 0xFF, 0x0D, 0x9C, 0xFF, 0x4E, 0xA4, 0xFF, 0x1A, 0xF7, 0xFF, 0x4E, 0xA4, 0xFF, 0x0D, 0x94, 0xFF, 0x0D, 0x94, 0xFF, 0x0D, 0x9C, 0xFF, 0xEC, 0x9B, 0xFF, 0x0C, 0x94, 0xFF, 0xCB, 0x8B, 0xFF, 0xEC, 0x8B, 0xFF, 0xCC, 0x8B, 0xFF, 0x0D, 0x94, 0xFF, 0x4E, 0x9C, 0xFF, 0xAF, 0xA4, 0xFF, 0xCF, 0xA4, 0xFF, 0xF0, 0xAC, 0xFF, 0xF0, 0xAC, 0xFF, 0x6E, 0xA4, 0xFF, 0x2D, 0x9C, 0xFF, 0xCF, 0xAC, 0xFF, 0xCF, 0xAC, 0xFF, 0x8E, 0xA4, 0xFF, 0x4D, 0x9C, 0xFF, 0x49, 0x7B, 0xFF, 0xEC, 0x8B, 0xFF, 0xAA, 0x83, 0xFF, 0x8B, 0x83, 0xFF, 0xCC, 0x83, 0xFF, 0x23, 0x29, 0xFF, 0x8B, 0x83, 0xFF, 0xC6, 0x41, 0xFF, 0x8A, 0x83, 0xFF, 0x8B, 0x83, 0xFF, 0x26, 0x5A, 0xFF, 0xCC, 0x93, 0xFF, 0x06, 0x4A, 0xFF, 0x64, 0x39, 0xFF, 0x09, 0x73, 0xFF, 0xC5, 0x41, 0xFF, 0xAB, 0x8B, 0xFF, 0xA4, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0xEC, 0x93, 0xFF, 0x26, 0x52, 0xFF, 0x4C, 0x9C, 0xFF, 0x2D, 0x9C, 0xFF, 0x88, 0x62, 0xFF, 0x88, 0x62, 0xFF, 0x8B, 0x83, 0xFF, 0x0C, 0x94, 0xFF, 0xC5, 0x49, 0xFF, 0x27, 0x52, 0xFF, 0xA4, 0x41, 0xFF, 0x8B, 0x83, 0xFF, 0x4D, 0xA4, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x5A, 0xFF, 0x27, 0x52, 0xFF, 0x8B, 0x83, 0xFF,
-    0xCC, 0x8B, 0xFF, 0x87, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x8F, 0x9C, 0xFF, 0x67, 0x52, 0xFF, 0xE9, 0x6A, 0xFF, 0x67, 0x52, 0xFF, 0x29, 0x63, 0xFF, 0x8B, 0x83, 0xFF, 0x87, 0x5A, 0xFF, 0xC9, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0xE9, 0x6A, 0xFF, 0xAB, 0x8B, 0xFF, 0x8B, 0x83, 0xFF, 0xAC, 0x83, 0xFF, 0xAC, 0x8B, 0xFF, 0xCD, 0x8B, 0xFF, 0x31, 0xBD, 0xFF, 0x8F, 0xA4, 0xFF, 0x2E, 0xA4, 0xFF, 0xD0, 0xBC, 0xFF, 0x4E, 0xA4, 0xFF, 0x0D, 0x94, 0xFF, 0xF8, 0xEE, 0xFF, 0x2D, 0x9C, 0xFF, 0xAB, 0x8B, 0xFF, 0xEC, 0x93, 0xFF, 0x75, 0xDE, 0xFF, 0x37, 0xEF, 0xFF, 0xED, 0x93, 0xFF, 0x0D, 0x94, 0xFF, 0x0D, 0x94, 0xFF, 0x72, 0xBD, 0xFF, 0xFA, 0xFF, 0xFF, 0xAF, 0xA4, 0xFF, 0xAF, 0xAC, 0xFF, 0x2D, 0x9C, 0xFF, 0x4D, 0x9C, 0xFF, 0x58, 0xF7, 0xFF, 0xF2, 0xCD, 0xFF, 0xEB, 0x93, 0xFF, 0x2D, 0x94, 0xFF, 0x69, 0x7B, 0xFF, 0x58, 0xF7, 0xFF, 0x13, 0xD6, 0xFF, 0xCB, 0x8B, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0x06, 0x42, 0xFF, 0xC5, 0x39, 0xFF, 0x06, 0x4A, 0xFF, 0xC5, 0x41, 0xFF, 0x09, 0x63, 0xFF, 0x4B, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x6E, 0x94, 0xFF,
-    0x8B, 0x7B, 0xFF, 0xE5, 0x49, 0xFF, 0x05, 0x4A, 0xFF, 0x0A, 0x6B, 0xFF, 0x4A, 0x73, 0xFF, 0xA8, 0x62, 0xFF, 0x2A, 0x73, 0xFF, 0xEC, 0x83, 0xFF, 0x2A, 0x6B, 0xFF, 0x8B, 0x7B, 0xFF, 0x6F, 0x9C, 0xFF, 0x2A, 0x6B, 0xFF, 0x67, 0x5A, 0xFF, 0x09, 0x6B, 0xFF, 0xE9, 0x6A, 0xFF, 0xC8, 0x62, 0xFF, 0x07, 0x4A, 0xFF, 0x6F, 0x9C, 0xFF, 0xC8, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0x6B, 0x7B, 0xFF, 0x6E, 0x9C, 0xFF, 0x2A, 0x73, 0xFF, 0x88, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0x8E, 0xA4, 0xFF, 0xA8, 0x62, 0xFF, 0xE9, 0x62, 0xFF, 0xCC, 0x8B, 0xFF, 0x6E, 0x9C, 0xFF, 0x27, 0x52, 0xFF, 0x2E, 0x94, 0xFF, 0xAF, 0xAC, 0xFF, 0xF0, 0xB4, 0xFF, 0xD0, 0xAC, 0xFF, 0x8F, 0xA4, 0xFF, 0x72, 0xCD, 0xFF, 0x35, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0x31, 0xC5, 0xFF, 0x32, 0xC5, 0xFF, 0xCF, 0xB4, 0xFF, 0x4E, 0xAC, 0xFF, 0x8E, 0xAC, 0xFF, 0x34, 0xDE, 0xFF, 0x31, 0xC5, 0xFF, 0x76, 0xE6, 0xFF, 0x4E, 0xA4, 0xFF, 0x0D, 0x9C, 0xFF, 0x51, 0xC5, 0xFF, 0x8E, 0xAC, 0xFF, 0xAE, 0xAC, 0xFF, 0xD3, 0xDD, 0xFF, 0x6D, 0x9C, 0xFF, 0x4D, 0x9C, 0xFF, 0x30, 0xB5, 0xFF, 0x4D, 0x9C, 0xFF, 0xCB, 0x8B, 0xFF, 0xF3, 0xCD, 0xFF, 0x49, 0x7B, 0xFF, 0x4D, 0x9C, 0xFF, 0xCB, 0x8B, 0xFF, 0x0C, 0x94, 0xFF,
-    0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x85, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x84, 0x31, 0xFF, 0xE6, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x42, 0xFF, 0xC9, 0x62, 0xFF, 0x46, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xA8, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0x46, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0x67, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xC8, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x5A, 0xFF, 0x0A, 0x73, 0xFF, 0x2A, 0x73, 0xFF, 0x87, 0x5A, 0xFF, 0x0D, 0x94, 0xFF, 0xAC, 0x8B, 0xFF, 0xED, 0x8B, 0xFF, 0x0E, 0x9C, 0xFF, 0x8F, 0xA4, 0xFF, 0x90, 0xAC, 0xFF, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0xFF, 0xD0, 0xB4, 0xFF, 0x4E, 0x9C, 0xFF, 0x6F, 0xA4, 0xFF, 0x2D, 0x9C, 0xFF, 0x2D, 0x9C, 0xFF, 0xAF, 0xAC, 0xFF, 0xAF, 0xAC, 0xFF, 0x6E, 0xA4, 0xFF,
-    0x2D, 0x9C, 0xFF, 0xEC, 0x8B, 0xFF, 0x6E, 0x9C, 0xFF, 0xF0, 0xAC, 0xFF, 0x31, 0xB5, 0xFF, 0xB6, 0xEE, 0xFF, 0xAF, 0xA4, 0xFF, 0x6E, 0xA4, 0xFF, 0xAF, 0xA4, 0xFF, 0x4D, 0x94, 0xFF, 0xAA, 0x8B, 0xFF, 0x0C, 0x94, 0xFF, 0x29, 0x7B, 0xFF, 0xCB, 0x8B, 0xFF, 0xCB, 0x8B, 0xFF, 0xAB, 0x8B, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0xC5, 0x39, 0xFF, 0x06, 0x42, 0xFF, 0xC5, 0x39, 0xFF, 0x06, 0x42, 0xFF, 0xC5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0x26, 0x4A, 0xFF, 0xA4, 0x39, 0xFF, 0x88, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xE6, 0x49, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x68, 0x52, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x52, 0xFF, 0xE6, 0x49, 0xFF, 0x88, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0x47, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0x27, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x68, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x87, 0x5A, 0xFF, 0x88, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x73, 0xFF, 0x47, 0x5A, 0xFF, 0x8B, 0x83, 0xFF,
-    0x8B, 0x83, 0xFF, 0xAC, 0x83, 0xFF, 0x0D, 0x94, 0xFF, 0x2E, 0x9C, 0xFF, 0x0D, 0x9C, 0xFF, 0xF0, 0xBC, 0xFF, 0xF5, 0xE5, 0xFF, 0xF1, 0xBC, 0xFF, 0x8F, 0xAC, 0xFF, 0xCC, 0x8B, 0xFF, 0x6F, 0xA4, 0xFF, 0xAF, 0xAC, 0xFF, 0xF0, 0xBC, 0xFF, 0x31, 0xC5, 0xFF, 0x10, 0xBD, 0xFF, 0x8E, 0xA4, 0xFF, 0x4E, 0x9C, 0xFF, 0x0D, 0x94, 0xFF, 0x4E, 0x94, 0xFF, 0x8E, 0x9C, 0xFF, 0x10, 0xAD, 0xFF, 0xF0, 0xAC, 0xFF, 0x4D, 0x9C, 0xFF, 0xAE, 0x9C, 0xFF, 0xAF, 0xA4, 0xFF, 0x6E, 0x9C, 0xFF, 0xEC, 0x8B, 0xFF, 0x0C, 0x94, 0xFF, 0x6A, 0x83, 0xFF, 0x0C, 0x94, 0xFF, 0xAB, 0x8B, 0xFF, 0x6A, 0x7B, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xC6, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x47, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x42, 0xFF, 0xE6, 0x41, 0xFF, 0x27, 0x4A, 0xFF, 0xE9, 0x62, 0xFF, 0x4A, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0x2A, 0x73, 0xFF, 0x68, 0x52, 0xFF, 0xA8, 0x5A, 0xFF, 0x27, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0xC5, 0x41, 0xFF, 0x67, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x67, 0x5A, 0xFF, 0x27, 0x52, 0xFF, 0x06, 0x4A, 0xFF,
-    0x88, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0xCC, 0x8B, 0xFF, 0x47, 0x52, 0xFF, 0xE8, 0x6A, 0xFF, 0x87, 0x62, 0xFF, 0x88, 0x62, 0xFF, 0x87, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x88, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x73, 0xFF, 0x67, 0x62, 0xFF, 0x6B, 0x7B, 0xFF, 0x8C, 0x83, 0xFF, 0x0E, 0x94, 0xFF, 0xED, 0x8B, 0xFF, 0x0D, 0x94, 0xFF, 0x6F, 0xA4, 0xFF, 0x72, 0xC5, 0xFF, 0x72, 0xBD, 0xFF, 0x36, 0xDE, 0xFF, 0x8F, 0xAC, 0xFF, 0x2E, 0x9C, 0xFF, 0xB0, 0xB4, 0xFF, 0xB2, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x54, 0xF6, 0xFF, 0xCF, 0xBC, 0xFF, 0xD0, 0xAC, 0xFF, 0x2D, 0x9C, 0xFF, 0xD3, 0xC5, 0xFF, 0x2D, 0x9C, 0xFF, 0xCF, 0xA4, 0xFF, 0x30, 0xAD, 0xFF, 0xD3, 0xCD, 0xFF, 0xAF, 0xAC, 0xFF, 0xAF, 0xA4, 0xFF, 0x4D, 0x9C, 0xFF, 0x6E, 0x9C, 0xFF, 0x2D, 0x9C, 0xFF, 0x4A, 0x7B, 0xFF, 0xCC, 0x93, 0xFF, 0x6A, 0x83, 0xFF, 0x6A, 0x83, 0xFF, 0x6B, 0x8B, 0xFF, 0x0B, 0x73, 0xFF, 0xCC, 0x8B, 0xFF, 0xC5, 0x41, 0xFF, 0x09, 0x73, 0xFF, 0x6B, 0x8B, 0xFF, 0x9C, 0xFF, 0xFF, 0xCC, 0x93, 0xFF, 0xB0, 0xA4, 0xFF, 0xC4, 0x49, 0xFF, 0x6B, 0x83, 0xFF, 0x27, 0x52, 0xFF, 0xCC, 0x93, 0xFF, 0xCF, 0xB4, 0xFF, 0x26, 0x4A, 0xFF, 0xCB, 0x8B, 0xFF,
-    0x51, 0xBD, 0xFF, 0x2D, 0x94, 0xFF, 0x2E, 0x94, 0xFF, 0xA8, 0x62, 0xFF, 0x0D, 0x8C, 0xFF, 0xF1, 0xB4, 0xFF, 0xAC, 0x8B, 0xFF, 0x4D, 0x94, 0xFF, 0x06, 0x52, 0xFF, 0x43, 0x39, 0xFF, 0x4A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0xC4, 0x41, 0xFF, 0xD4, 0xD5, 0xFF, 0x88, 0x5A, 0xFF, 0x8F, 0xAC, 0xFF, 0x6E, 0xA4, 0xFF, 0x87, 0x5A, 0xFF, 0x27, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x2A, 0x73, 0xFF, 0xEC, 0x8B, 0xFF, 0xA8, 0x62, 0xFF, 0xA5, 0x39, 0xFF, 0xA8, 0x6A, 0xFF, 0x8F, 0xAC, 0xFF, 0x46, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x09, 0x7B, 0xFF, 0xAC, 0x8B, 0xFF, 0xAC, 0x8B, 0xFF, 0x2A, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF, 0xB0, 0xAC, 0xFF, 0x32, 0xBD, 0xFF, 0x8F, 0xAC, 0xFF, 0xEB, 0x93, 0xFF, 0x8F, 0xAC, 0xFF, 0xF1, 0xB4, 0xFF, 0x51, 0xC5, 0xFF, 0x76, 0xD6, 0xFF, 0x72, 0xC5, 0xFF, 0x76, 0xE6, 0xFF, 0xF7, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xEE, 0xFF, 0x13, 0xD6, 0xFF, 0x8F, 0xAC, 0xFF, 0x10, 0xAD, 0xFF, 0xF4, 0xD5, 0xFF, 0x6D, 0xA4, 0xFF, 0x6D, 0x9C, 0xFF, 0xAF, 0xAC, 0xFF, 0x0C, 0x94, 0xFF, 0xAF, 0xAC, 0xFF, 0xCF, 0xAC, 0xFF, 0x4E, 0x9C, 0xFF, 0x92, 0xCD, 0xFF, 0xAB, 0x8B, 0xFF, 0xCB, 0x8B, 0xFF, 0x6A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF,
-    0xA5, 0x31, 0xFF, 0xE6, 0x41, 0xFF, 0xC6, 0x39, 0xFF, 0x48, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x68, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x73, 0xFF, 0x67, 0x5A, 0xFF, 0xC8, 0x62, 0xFF, 0x87, 0x5A, 0xFF, 0xA8, 0x5A, 0xFF, 0x07, 0x4A, 0xFF, 0xC9, 0x62, 0xFF, 0xC8, 0x62, 0xFF, 0x2A, 0x73, 0xFF, 0x89, 0x62, 0xFF, 0x0A, 0x6B, 0xFF, 0x26, 0x4A, 0xFF, 0x88, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x68, 0x5A, 0xFF, 0x88, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0x26, 0x4A, 0xFF, 0x26, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x88, 0x62, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0xE9, 0x6A, 0xFF, 0x88, 0x5A, 0xFF, 0x09, 0x73, 0xFF, 0x84, 0x39, 0xFF, 0x06, 0x4A, 0xFF, 0xA8, 0x62, 0xFF, 0x47, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0x09, 0x73, 0xFF, 0x2A, 0x73, 0xFF, 0xE9, 0x6A, 0xFF, 0x4A, 0x7B, 0xFF, 0x8B, 0x7B, 0xFF, 0x6B, 0x83, 0xFF, 0xED, 0x8B, 0xFF, 0x6B, 0x7B, 0xFF, 0xEC, 0x8B, 0xFF, 0xEC, 0x93, 0xFF, 0x6E, 0x9C, 0xFF, 0xCC, 0x93, 0xFF, 0x8F, 0xA4, 0xFF, 0x8F, 0xA4, 0xFF, 0xD4, 0xC5, 0xFF, 0x72, 0xD5, 0xFF, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0xFF, 0xF3, 0xE5, 0xFF,
-    0x4D, 0x9C, 0xFF, 0x6E, 0x9C, 0xFF, 0x8F, 0xA4, 0xFF, 0xAB, 0x8B, 0xFF, 0x8F, 0xA4, 0xFF, 0x4E, 0x9C, 0xFF, 0xD0, 0xA4, 0xFF, 0x2D, 0x94, 0xFF, 0x2D, 0x94, 0xFF, 0x2C, 0x94, 0xFF, 0x2C, 0x94, 0xFF, 0x0C, 0x94, 0xFF, 0x6A, 0x83, 0xFF, 0x8B, 0x8B, 0xFF, 0x6A, 0x7B, 0xFF, 0xE9, 0x72, 0xFF, 0xE6, 0x41, 0xFF, 0xCA, 0x62, 0xFF, 0x47, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0xEA, 0x6A, 0xFF, 0x0A, 0x7B, 0xFF, 0x6B, 0x83, 0xFF, 0x6B, 0x83, 0xFF, 0xB0, 0xB4, 0xFF, 0xAC, 0x93, 0xFF, 0xB0, 0xAC, 0xFF, 0xAC, 0x8B, 0xFF, 0xCC, 0x8B, 0xFF, 0x68, 0x52, 0xFF, 0xE9, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x2A, 0x73, 0xFF, 0xC9, 0x62, 0xFF, 0x09, 0x6B, 0xFF, 0x26, 0x4A, 0xFF, 0x2A, 0x6B, 0xFF, 0x27, 0x4A, 0xFF, 0xE9, 0x6A, 0xFF, 0x27, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x8F, 0x9C, 0xFF, 0xE9, 0x72, 0xFF, 0x88, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x68, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0x88, 0x62, 0xFF, 0xC9, 0x62, 0xFF, 0x88, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x85, 0x39, 0xFF, 0x93, 0xD5, 0xFF, 0xA8, 0x62, 0xFF, 0xC9, 0x6A, 0xFF, 0xE5, 0x49, 0xFF, 0x0A, 0x73, 0xFF, 0x88, 0x62, 0xFF, 0x0D, 0x94, 0xFF, 0x2A, 0x7B, 0xFF,
-    0x6B, 0x7B, 0xFF, 0x09, 0x73, 0xFF, 0xCD, 0x8B, 0xFF, 0x09, 0x73, 0xFF, 0x6E, 0x9C, 0xFF, 0x8B, 0x8B, 0xFF, 0xB3, 0xC5, 0xFF, 0x2D, 0x9C, 0xFF, 0x4E, 0x9C, 0xFF, 0xB3, 0xC5, 0xFF, 0x73, 0xCD, 0xFF, 0x8F, 0xAC, 0xFF, 0x71, 0xD5, 0xFF, 0x52, 0xD5, 0xFF, 0x30, 0xC5, 0xFF, 0x51, 0xCD, 0xFF, 0x4E, 0x9C, 0xFF, 0x4D, 0x9C, 0xFF, 0xCB, 0x8B, 0xFF, 0x6A, 0x7B, 0xFF, 0x8E, 0x9C, 0xFF, 0xEB, 0x83, 0xFF, 0xAF, 0xA4, 0xFF, 0x4D, 0x9C, 0xFF, 0x8E, 0xA4, 0xFF, 0x6E, 0x9C, 0xFF, 0xEC, 0x8B, 0xFF, 0x0C, 0x94, 0xFF, 0x0C, 0x94, 0xFF, 0xAB, 0x83, 0xFF, 0x4A, 0x7B, 0xFF, 0xAB, 0x83, 0xFF, 0x06, 0x42, 0xFF, 0x06, 0x4A, 0xFF, 0x8C, 0x73, 0xFF, 0x37, 0xD6, 0xFF, 0x8C, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0xE6, 0xFF, 0x73, 0xC5, 0xFF, 0x73, 0xCD, 0xFF, 0x78, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0xAC, 0x83, 0xFF, 0xFB, 0xFF, 0xFF, 0x0D, 0x8C, 0xFF, 0x5A, 0xF7, 0xFF, 0x47, 0x5A, 0xFF, 0xFE, 0xFF, 0xFF, 0x6B, 0x7B, 0xFF, 0x5A, 0xEF, 0xFF, 0xE6, 0x41, 0xFF, 0xAC, 0x83, 0xFF, 0x0A, 0x6B, 0xFF, 0x26, 0x4A, 0xFF, 0x32, 0xC5, 0xFF, 0xE9, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0xE7, 0x49, 0xFF, 0x26, 0x52, 0xFF, 0x87, 0x62, 0xFF, 0x46, 0x52, 0xFF,
-    0x47, 0x52, 0xFF, 0x26, 0x52, 0xFF, 0x09, 0x6B, 0xFF, 0x67, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0x2D, 0x94, 0xFF, 0xC9, 0x6A, 0xFF, 0x85, 0x39, 0xFF, 0xA9, 0x6A, 0xFF, 0xCC, 0x8B, 0xFF, 0xA8, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x4F, 0x9C, 0xFF, 0x0A, 0x73, 0xFF, 0xEA, 0x72, 0xFF, 0x2A, 0x7B, 0xFF, 0xF1, 0xBC, 0xFF, 0x2A, 0x7B, 0xFF, 0xED, 0x93, 0xFF, 0xD0, 0xB4, 0xFF, 0x4A, 0x83, 0xFF, 0x2D, 0x9C, 0xFF, 0x72, 0xC5, 0xFF, 0x6B, 0x8B, 0xFF, 0x8F, 0xAC, 0xFF, 0x4E, 0xAC, 0xFF, 0x75, 0xEE, 0xFF, 0x2D, 0xA4, 0xFF, 0x6D, 0xA4, 0xFF, 0xDA, 0xFF, 0xFF, 0x96, 0xF6, 0xFF, 0x6E, 0xAC, 0xFF, 0xDD, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xCC, 0x8B, 0xFF, 0xAB, 0x8B, 0xFF, 0x8E, 0x9C, 0xFF, 0x8B, 0x83, 0xFF, 0x8E, 0xA4, 0xFF, 0x6A, 0x83, 0xFF, 0xCB, 0x83, 0xFF, 0x5A, 0xF7, 0xFF, 0x2D, 0x9C, 0xFF, 0x0C, 0x94, 0xFF, 0xCC, 0x8B, 0xFF, 0x2D, 0x9C, 0xFF, 0x4A, 0x7B, 0xFF, 0x6A, 0x83, 0xFF, 0x06, 0x4A, 0xFF, 0xC5, 0x39, 0xFF, 0x89, 0x5A, 0xFF, 0x68, 0x5A, 0xFF, 0xC9, 0x6A, 0xFF, 0x10, 0xBD, 0xFF, 0x52, 0xD5, 0xFF, 0xAC, 0x8B, 0xFF, 0xCD, 0x93, 0xFF, 0x56, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xEE, 0xFF, 0xFE, 0xFF, 0xFF, 0x26, 0x52, 0xFF, 0xC8, 0x62, 0xFF, 0x52, 0xBD, 0xFF,
-    0x6B, 0x7B, 0xFF, 0x06, 0x4A, 0xFF, 0xC9, 0x62, 0xFF, 0x2A, 0x73, 0xFF, 0x0D, 0x8C, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x52, 0xFF, 0x26, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x4A, 0xFF, 0x4B, 0x7B, 0xFF, 0xE9, 0x6A, 0xFF, 0xE5, 0x49, 0xFF, 0x06, 0x52, 0xFF, 0xED, 0x8B, 0xFF, 0xAC, 0x83, 0xFF, 0xE5, 0x49, 0xFF, 0x26, 0x52, 0xFF, 0xC8, 0x6A, 0xFF, 0x4E, 0x9C, 0xFF, 0x88, 0x6A, 0xFF, 0x68, 0x5A, 0xFF, 0xA8, 0x62, 0xFF, 0x6E, 0xA4, 0xFF, 0xC9, 0x72, 0xFF, 0x47, 0x5A, 0xFF, 0xA8, 0x62, 0xFF, 0x4E, 0xA4, 0xFF, 0xE9, 0x72, 0xFF, 0x09, 0x73, 0xFF, 0x6F, 0xA4, 0xFF, 0x4E, 0xA4, 0xFF, 0x8A, 0x83, 0xFF, 0x8B, 0x83, 0xFF, 0xAC, 0x93, 0xFF, 0xD3, 0xDD, 0xFF, 0xD7, 0xF6, 0xFF, 0xED, 0x9B, 0xFF, 0x0D, 0x9C, 0xFF, 0xF0, 0xBC, 0xFF, 0x72, 0xCD, 0xFF, 0xEB, 0x93, 0xFF, 0x2D, 0x94, 0xFF, 0x52, 0xCD, 0xFF, 0x51, 0xCD, 0xFF, 0xEC, 0x9B, 0xFF, 0x0D, 0x94, 0xFF, 0xEC, 0x93, 0xFF, 0xAF, 0xAC, 0xFF, 0xAF, 0xAC, 0xFF, 0xCF, 0xAC, 0xFF, 0x6A, 0x83, 0xFF, 0xEF, 0xBC, 0xFF, 0xE9, 0x72, 0xFF, 0x09, 0x73, 0xFF, 0x0C, 0x94, 0xFF, 0xEC, 0x93, 0xFF, 0x8E, 0xA4, 0xFF, 0xCC, 0x8B, 0xFF, 0x6A, 0x83, 0xFF, 0x29, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF,
-    0x88, 0x5A, 0xFF, 0xA5, 0x39, 0xFF, 0xC9, 0x6A, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x15, 0xDE, 0xFF, 0x26, 0x52, 0xFF, 0x8B, 0x8B, 0xFF, 0xA9, 0x62, 0xFF, 0x4A, 0x7B, 0xFF, 0x8B, 0x83, 0xFF, 0x10, 0xAD, 0xFF, 0xEC, 0x93, 0xFF, 0x26, 0x4A, 0xFF, 0x27, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x46, 0x52, 0xFF, 0xC5, 0x41, 0xFF, 0x0A, 0x6B, 0xFF, 0xA8, 0x5A, 0xFF, 0xC5, 0x41, 0xFF, 0x0D, 0x94, 0xFF, 0x8B, 0x83, 0xFF, 0x27, 0x52, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0xCC, 0x8B, 0xFF, 0x49, 0x7B, 0xFF, 0xE5, 0x41, 0xFF, 0x26, 0x52, 0xFF, 0xE6, 0x49, 0xFF, 0xC8, 0x6A, 0xFF, 0x2D, 0x94, 0xFF, 0x27, 0x5A, 0xFF, 0x06, 0x52, 0xFF, 0x05, 0x52, 0xFF, 0x4A, 0x7B, 0xFF, 0xA8, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x8F, 0xAC, 0xFF, 0x67, 0x62, 0xFF, 0xA8, 0x62, 0xFF, 0xA8, 0x6A, 0xFF, 0x2A, 0x7B, 0xFF, 0x6E, 0xA4, 0xFF, 0xC8, 0x6A, 0xFF, 0x2A, 0x7B, 0xFF, 0x2A, 0x7B, 0xFF, 0x0C, 0x9C, 0xFF, 0x31, 0xBD, 0xFF, 0xAD, 0x93, 0xFF, 0x10, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xCD, 0xFF, 0xB3, 0xC5, 0xFF, 0x34, 0xDE, 0xFF, 0x55, 0xEE, 0xFF, 0xAB, 0x8B, 0xFF, 0x71, 0xC5, 0xFF, 0x76, 0xE6, 0xFF, 0xEC, 0x93, 0xFF, 0x4A, 0x83, 0xFF,
-    0xF0, 0xBC, 0xFF, 0x51, 0xBD, 0xFF, 0x0C, 0x9C, 0xFF, 0xB0, 0xAC, 0xFF, 0x31, 0xC5, 0xFF, 0x2D, 0x9C, 0xFF, 0xCF, 0xAC, 0xFF, 0x4E, 0x9C, 0xFF, 0x2D, 0x9C, 0xFF, 0xAF, 0xB4, 0xFF, 0xEC, 0x93, 0xFF, 0x38, 0xF7, 0xFF, 0x67, 0x62, 0xFF, 0xE8, 0x6A, 0xFF, 0x6A, 0x83, 0xFF, 0x8B, 0x8B, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0xC6, 0x39, 0xFF, 0x06, 0x42, 0xFF, 0xE6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xA9, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x88, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0xE9, 0x62, 0xFF, 0x67, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0xC5, 0x41, 0xFF, 0xE9, 0x62, 0xFF, 0xC9, 0x62, 0xFF, 0xA9, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0xE6, 0x49, 0xFF, 0xA9, 0x62, 0xFF, 0x05, 0x4A, 0xFF, 0x84, 0x39, 0xFF, 0xE5, 0x41, 0xFF, 0x87, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xA8, 0x62, 0xFF, 0x47, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0xA8, 0x62, 0xFF, 0x26, 0x52, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x73, 0xFF, 0xE9, 0x72, 0xFF, 0x88, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x87, 0x62, 0xFF, 0xC8, 0x6A, 0xFF, 0xC8, 0x6A, 0xFF, 0xE9, 0x72, 0xFF, 0x4B, 0x7B, 0xFF, 0x0A, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF,
-    0x09, 0x73, 0xFF, 0xE9, 0x72, 0xFF, 0xAF, 0xAC, 0xFF, 0x0D, 0x94, 0xFF, 0x6A, 0x83, 0xFF, 0x0D, 0x9C, 0xFF, 0x5A, 0xFF, 0xFF, 0xEC, 0x93, 0xFF, 0xCC, 0x8B, 0xFF, 0x6E, 0xA4, 0xFF, 0x0D, 0x9C, 0xFF, 0xED, 0x93, 0xFF, 0x14, 0xD6, 0xFF, 0xEC, 0x93, 0xFF, 0xFD, 0xFF, 0xFF, 0xB7, 0xE6, 0xFF, 0xD0, 0xAC, 0xFF, 0x0D, 0x8C, 0xFF, 0xE9, 0x72, 0xFF, 0xD3, 0xCD, 0xFF, 0x2E, 0x9C, 0xFF, 0xCF, 0xA4, 0xFF, 0x8E, 0x9C, 0xFF, 0x4D, 0x94, 0xFF, 0x39, 0xF7, 0xFF, 0x2D, 0x94, 0xFF, 0x0C, 0x94, 0xFF, 0xAB, 0x83, 0xFF, 0x87, 0x62, 0xFF, 0x4E, 0xA4, 0xFF, 0x29, 0x73, 0xFF, 0x4A, 0x7B, 0xFF, 0x64, 0x31, 0xFF, 0x68, 0x52, 0xFF, 0x07, 0x42, 0xFF, 0xA5, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0xC9, 0x62, 0xFF, 0xA9, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xAB, 0x7B, 0xFF, 0x26, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x52, 0xFF, 0x6E, 0x84, 0xFF, 0x4A, 0x6B, 0xFF, 0x67, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x6B, 0x73, 0xFF, 0x4B, 0x73, 0xFF, 0xE6, 0x41, 0xFF, 0xC9, 0x62, 0xFF, 0xAC, 0x7B, 0xFF, 0x26, 0x4A, 0xFF, 0x85, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0x4A, 0x73, 0xFF, 0x47, 0x52, 0xFF, 0xE5, 0x49, 0xFF, 0xC8, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0x26, 0x52, 0xFF,
-    0x67, 0x5A, 0xFF, 0xED, 0x8B, 0xFF, 0x67, 0x5A, 0xFF, 0x87, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0x2D, 0x94, 0xFF, 0xE9, 0x72, 0xFF, 0xA8, 0x62, 0xFF, 0xC9, 0x6A, 0xFF, 0x8F, 0xA4, 0xFF, 0x6D, 0x9C, 0xFF, 0xE9, 0x72, 0xFF, 0xE9, 0x72, 0xFF, 0x09, 0x7B, 0xFF, 0x2A, 0x7B, 0xFF, 0x09, 0x73, 0xFF, 0x52, 0xC5, 0xFF, 0x2A, 0x7B, 0xFF, 0xAC, 0x8B, 0xFF, 0xCC, 0x8B, 0xFF, 0x2E, 0xA4, 0xFF, 0x6B, 0x83, 0xFF, 0x2D, 0x9C, 0xFF, 0xAC, 0x93, 0xFF, 0x56, 0xE6, 0xFF, 0xED, 0x93, 0xFF, 0xF1, 0xBC, 0xFF, 0x72, 0xCD, 0xFF, 0x4A, 0x83, 0xFF, 0xCC, 0x8B, 0xFF, 0xCB, 0x93, 0xFF, 0x6B, 0x83, 0xFF, 0xAB, 0x83, 0xFF, 0x8B, 0x83, 0xFF, 0x67, 0x6A, 0xFF, 0x8E, 0x9C, 0xFF, 0xEC, 0x8B, 0xFF, 0x10, 0xAD, 0xFF, 0xAF, 0x9C, 0xFF, 0x6E, 0x9C, 0xFF, 0x4D, 0x9C, 0xFF, 0x49, 0x7B, 0xFF, 0x0D, 0x94, 0xFF, 0xAB, 0x83, 0xFF, 0xA7, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0x6B, 0x7B, 0xFF, 0xE8, 0x6A, 0xFF, 0x44, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x27, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0xA5, 0x39, 0xFF, 0xE6, 0x41, 0xFF, 0x68, 0x52, 0xFF, 0x0A, 0x73, 0xFF, 0x11, 0xB5, 0xFF, 0xC5, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x6B, 0x73, 0xFF, 0xF0, 0xB4, 0xFF, 0x0A, 0x6B, 0xFF, 0x85, 0x39, 0xFF, 0x84, 0x39, 0xFF,
-    0x88, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x67, 0x52, 0xFF, 0x0D, 0x84, 0xFF, 0x68, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0xA9, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0xE6, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0x67, 0x5A, 0xFF, 0xC5, 0x49, 0xFF, 0xE9, 0x6A, 0xFF, 0x06, 0x52, 0xFF, 0x47, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0x4E, 0x9C, 0xFF, 0x88, 0x62, 0xFF, 0x67, 0x62, 0xFF, 0x0D, 0x9C, 0xFF, 0x2D, 0x9C, 0xFF, 0xC8, 0x72, 0xFF, 0x88, 0x62, 0xFF, 0x09, 0x73, 0xFF, 0xF0, 0xB4, 0xFF, 0x4A, 0x83, 0xFF, 0x0D, 0x94, 0xFF, 0x2A, 0x83, 0xFF, 0xED, 0x9B, 0xFF, 0x2A, 0x7B, 0xFF, 0xE9, 0x72, 0xFF, 0x6B, 0x83, 0xFF, 0x4E, 0xA4, 0xFF, 0x6A, 0x83, 0xFF, 0x8C, 0x8B, 0xFF, 0x6E, 0xA4, 0xFF, 0x8F, 0xB4, 0xFF, 0xCC, 0x93, 0xFF, 0x0D, 0xA4, 0xFF, 0x6B, 0x8B, 0xFF, 0xCD, 0x9B, 0xFF, 0x9B, 0xFF, 0xFF, 0x6B, 0x8B, 0xFF, 0x0D, 0x94, 0xFF, 0x6F, 0xAC, 0xFF, 0x4E, 0xAC, 0xFF, 0x8B, 0x8B, 0xFF, 0x09, 0x73, 0xFF, 0x8F, 0xA4, 0xFF, 0x4B, 0x7B, 0xFF, 0xD0, 0xA4, 0xFF, 0xC8, 0x6A, 0xFF, 0xE8, 0x72, 0xFF, 0x31, 0xC5, 0xFF, 0xAF, 0xA4, 0xFF, 0x6E, 0xA4, 0xFF, 0xCB, 0x8B, 0xFF, 0xEC, 0x8B, 0xFF, 0xEC, 0x93, 0xFF, 0x8B, 0x8B, 0xFF, 0xAC, 0x8B, 0xFF, 0xA8, 0x62, 0xFF, 0x6B, 0x83, 0xFF,
-    0x44, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x0A, 0x73, 0xFF, 0xE6, 0x41, 0xFF, 0x68, 0x5A, 0xFF, 0xE6, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0x6B, 0x8B, 0xFF, 0x68, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x06, 0x52, 0xFF, 0x4B, 0x83, 0xFF, 0xA4, 0x41, 0xFF, 0x26, 0x4A, 0xFF, 0x47, 0x52, 0xFF, 0xA5, 0x39, 0xFF, 0x8B, 0x83, 0xFF, 0x67, 0x5A, 0xFF, 0xE6, 0x41, 0xFF, 0x4A, 0x6B, 0xFF, 0xA4, 0x41, 0xFF, 0xCC, 0x8B, 0xFF, 0x63, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0xED, 0x93, 0xFF, 0x47, 0x5A, 0xFF, 0x8B, 0x83, 0xFF, 0xC5, 0x49, 0xFF, 0x8B, 0x83, 0xFF, 0x4D, 0x9C, 0xFF, 0x0A, 0x73, 0xFF, 0x4A, 0x7B, 0xFF, 0xA7, 0x62, 0xFF, 0x0C, 0x94, 0xFF, 0xE8, 0x72, 0xFF, 0x29, 0x7B, 0xFF, 0x88, 0x62, 0xFF, 0xAB, 0x8B, 0xFF, 0x72, 0xCD, 0xFF, 0xE9, 0x7A, 0xFF, 0x4B, 0x7B, 0xFF, 0x29, 0x83, 0xFF, 0x6B, 0x8B, 0xFF, 0xAF, 0xB4, 0xFF, 0x4A, 0x83, 0xFF, 0x32, 0xBD, 0xFF, 0x0D, 0x9C, 0xFF, 0x8F, 0xAC, 0xFF, 0xCC, 0x8B, 0xFF, 0x6B, 0x83, 0xFF, 0x29, 0x83, 0xFF, 0xD8, 0xF6, 0xFF, 0xF0, 0xBC, 0xFF, 0x52, 0xCD, 0xFF, 0x4F, 0xB4, 0xFF, 0xCD, 0xA3, 0xFF, 0xCC, 0x9B, 0xFF, 0xB8, 0xFE, 0xFF, 0x8B, 0x83, 0xFF, 0xB7, 0xEE, 0xFF, 0xB0, 0xB4, 0xFF,
-    0x09, 0x7B, 0xFF, 0x2A, 0x7B, 0xFF, 0x6F, 0xA4, 0xFF, 0x8F, 0xAC, 0xFF, 0xE8, 0x72, 0xFF, 0xAF, 0xA4, 0xFF, 0x6E, 0xA4, 0xFF, 0xAF, 0xAC, 0xFF, 0xAF, 0xAC, 0xFF, 0x66, 0x5A, 0xFF, 0x0D, 0x94, 0xFF, 0x6A, 0x83, 0xFF, 0xAB, 0x8B, 0xFF, 0xCB, 0x8B, 0xFF, 0x67, 0x62, 0xFF, 0x4A, 0x7B, 0xFF, 0x64, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0xC8, 0x6A, 0xFF, 0x84, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0xC6, 0x41, 0xFF, 0x43, 0x31, 0xFF, 0x09, 0x73, 0xFF, 0xC6, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xAC, 0x83, 0xFF, 0x66, 0x62, 0xFF, 0xE5, 0x49, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x4B, 0x7B, 0xFF, 0x6A, 0x83, 0xFF, 0xA8, 0x5A, 0xFF, 0x27, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xA8, 0x62, 0xFF, 0x6B, 0x7B, 0xFF, 0x0A, 0x6B, 0xFF, 0xE6, 0x49, 0xFF, 0xA4, 0x41, 0xFF, 0x8B, 0x83, 0xFF, 0x6E, 0xA4, 0xFF, 0x47, 0x52, 0xFF, 0xC9, 0x6A, 0xFF, 0x4A, 0x7B, 0xFF, 0xAB, 0x8B, 0xFF, 0x26, 0x5A, 0xFF, 0x67, 0x62, 0xFF, 0xE8, 0x72, 0xFF, 0x08, 0x73, 0xFF, 0xAB, 0x93, 0xFF, 0x2D, 0x94, 0xFF, 0x6A, 0x83, 0xFF, 0xC8, 0x6A, 0xFF, 0x4A, 0x83, 0xFF, 0x34, 0xE6, 0xFF, 0xEC, 0xA3, 0xFF, 0xAC, 0x9B, 0xFF, 0x6F, 0xBC, 0xFF, 0x2E, 0xAC, 0xFF, 0x31, 0xC5, 0xFF, 0x4A, 0x83, 0xFF,
-    0xF0, 0xBC, 0xFF, 0xCC, 0x93, 0xFF, 0xF9, 0xEE, 0xFF, 0xAF, 0xB4, 0xFF, 0x0D, 0xA4, 0xFF, 0x8B, 0x8B, 0xFF, 0x6B, 0x8B, 0xFF, 0xAF, 0xB4, 0xFF, 0x32, 0xCD, 0xFF, 0x52, 0xE5, 0xFF, 0xB7, 0xFE, 0xFF, 0x8B, 0xA3, 0xFF, 0xB2, 0xCD, 0xFF, 0x8F, 0xB4, 0xFF, 0xAC, 0x8B, 0xFF, 0x8F, 0xA4, 0xFF, 0xC8, 0x6A, 0xFF, 0x52, 0xCD, 0xFF, 0xED, 0x93, 0xFF, 0x8F, 0xA4, 0xFF, 0xE9, 0x7A, 0xFF, 0xB3, 0xCD, 0xFF, 0xAB, 0x8B, 0xFF, 0x4A, 0x7B, 0xFF, 0x4E, 0x9C, 0xFF, 0x67, 0x62, 0xFF, 0x2A, 0x7B, 0xFF, 0xCC, 0x93, 0xFF, 0x0D, 0x94, 0xFF, 0xAB, 0x8B, 0xFF, 0xC8, 0x6A, 0xFF, 0x09, 0x73, 0xFF, 0x27, 0x4A, 0xFF, 0x43, 0x29, 0xFF, 0xA5, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0xA8, 0x62, 0xFF, 0x84, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0x4B, 0x7B, 0xFF, 0xAC, 0x83, 0xFF, 0x84, 0x49, 0xFF, 0x67, 0x52, 0xFF, 0x6B, 0x73, 0xFF, 0x85, 0x31, 0xFF, 0xE4, 0x49, 0xFF, 0xE5, 0x41, 0xFF, 0xE9, 0x6A, 0xFF, 0xA4, 0x41, 0xFF, 0x27, 0x52, 0xFF, 0x8F, 0xA4, 0xFF, 0x8B, 0x73, 0xFF, 0x88, 0x62, 0xFF, 0xC5, 0x41, 0xFF, 0xE5, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0xCC, 0x8B, 0xFF, 0x06, 0x4A, 0xFF, 0xD4, 0xC5, 0xFF, 0x26, 0x5A, 0xFF, 0xA9, 0x6A, 0xFF,
-    0xC9, 0x6A, 0xFF, 0x2D, 0x9C, 0xFF, 0xE9, 0x6A, 0xFF, 0xC8, 0x6A, 0xFF, 0x2D, 0x9C, 0xFF, 0xAF, 0xA4, 0xFF, 0xEB, 0x93, 0xFF, 0xE9, 0x72, 0xFF, 0x31, 0xCD, 0xFF, 0xD3, 0xD5, 0xFF, 0xF0, 0xCC, 0xFF, 0xB4, 0xFD, 0xFF, 0xF2, 0xE4, 0xFF, 0xAC, 0x9B, 0xFF, 0x8B, 0x93, 0xFF, 0x0A, 0x83, 0xFF, 0x70, 0xB4, 0xFF, 0x8F, 0xAC, 0xFF, 0xAC, 0x93, 0xFF, 0x6F, 0xAC, 0xFF, 0x51, 0xC5, 0xFF, 0xD4, 0xE5, 0xFF, 0x29, 0x83, 0xFF, 0x4E, 0xB4, 0xFF, 0x72, 0xDD, 0xFF, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0xE5, 0xFF, 0xF4, 0xE5, 0xFF, 0xED, 0x8B, 0xFF, 0x71, 0xC5, 0xFF, 0xB7, 0xF6, 0xFF, 0x79, 0xFF, 0xFF, 0x4B, 0x83, 0xFF, 0xB0, 0xB4, 0xFF, 0xAF, 0xAC, 0xFF, 0x7D, 0xFF, 0xFF, 0x72, 0xC5, 0xFF, 0xF5, 0xED, 0xFF, 0x11, 0xBD, 0xFF, 0x0D, 0x94, 0xFF, 0x09, 0x73, 0xFF, 0x66, 0x6A, 0xFF, 0xE9, 0x7A, 0xFF, 0xCC, 0x93, 0xFF, 0x6A, 0x83, 0xFF, 0x2A, 0x7B, 0xFF, 0xCC, 0x9B, 0xFF, 0x43, 0x29, 0xFF, 0x65, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x84, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x10, 0xA5, 0xFF, 0xA8, 0x5A, 0xFF, 0x43, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x06, 0x4A, 0xFF, 0xE5, 0x41, 0xFF, 0x63, 0x31, 0xFF, 0xA5, 0x39, 0xFF,
-    0x87, 0x5A, 0xFF, 0xE5, 0x41, 0xFF, 0x67, 0x52, 0xFF, 0xA5, 0x41, 0xFF, 0xAE, 0xA4, 0xFF, 0x4A, 0x73, 0xFF, 0x88, 0x5A, 0xFF, 0x46, 0x5A, 0xFF, 0x87, 0x5A, 0xFF, 0xA4, 0x41, 0xFF, 0x88, 0x62, 0xFF, 0x29, 0x6B, 0xFF, 0x67, 0x5A, 0xFF, 0x09, 0x73, 0xFF, 0x07, 0x52, 0xFF, 0xAA, 0x83, 0xFF, 0x8F, 0xA4, 0xFF, 0xB0, 0xB4, 0xFF, 0xC8, 0x6A, 0xFF, 0x4A, 0x7B, 0xFF, 0xAB, 0x8B, 0xFF, 0xAF, 0xAC, 0xFF, 0x29, 0x7B, 0xFF, 0x2A, 0x83, 0xFF, 0x0C, 0xAC, 0xFF, 0xF5, 0xF5, 0xFF, 0x76, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x72, 0xED, 0xFF, 0x6A, 0x8B, 0xFF, 0xD0, 0xBC, 0xFF, 0xED, 0x9B, 0xFF, 0x3A, 0xEF, 0xFF, 0x11, 0xBD, 0xFF, 0x8F, 0xAC, 0xFF, 0xF1, 0xBC, 0xFF, 0x30, 0xC5, 0xFF, 0xAC, 0x8B, 0xFF, 0xCD, 0x9B, 0xFF, 0x3A, 0xFF, 0xFF, 0xB0, 0xD4, 0xFF, 0x90, 0xE4, 0xFF, 0x16, 0xEE, 0xFF, 0x8B, 0x8B, 0xFF, 0xCD, 0x9B, 0xFF, 0x77, 0xEE, 0xFF, 0x2A, 0x7B, 0xFF, 0x2A, 0x7B, 0xFF, 0x6B, 0x83, 0xFF, 0xD0, 0xB4, 0xFF, 0x3A, 0xF7, 0xFF, 0x88, 0x6A, 0xFF, 0x31, 0xB5, 0xFF, 0xF4, 0xDD, 0xFF, 0xC8, 0x6A, 0xFF, 0x2D, 0x94, 0xFF, 0x4E, 0xA4, 0xFF, 0x87, 0x62, 0xFF, 0xAB, 0x8B, 0xFF, 0x4A, 0x7B, 0xFF, 0x8B, 0x8B, 0xFF, 0xE8, 0x6A, 0xFF, 0x6A, 0x83, 0xFF,
-    0x44, 0x29, 0xFF, 0x07, 0x42, 0xFF, 0x44, 0x29, 0xFF, 0x24, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0xCC, 0x8B, 0xFF, 0xC5, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0xCB, 0x8B, 0xFF, 0xA4, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x2C, 0x94, 0xFF, 0xA4, 0x39, 0xFF, 0x88, 0x5A, 0xFF, 0x67, 0x52, 0xFF, 0x2D, 0x9C, 0xFF, 0x27, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0x47, 0x5A, 0xFF, 0x2D, 0x94, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x5A, 0xFF, 0xC9, 0x6A, 0xFF, 0x0D, 0x9C, 0xFF, 0xA8, 0x62, 0xFF, 0x87, 0x62, 0xFF, 0x88, 0x62, 0xFF, 0x09, 0x7B, 0xFF, 0x86, 0x5A, 0xFF, 0x9A, 0xF7, 0xFF, 0xE9, 0x72, 0xFF, 0x39, 0xEF, 0xFF, 0xAC, 0x8B, 0xFF, 0x2A, 0x83, 0xFF, 0x0D, 0xA4, 0xFF, 0xEF, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xF5, 0xFF, 0x51, 0xDD, 0xFF, 0x8E, 0xCC, 0xFF, 0x7A, 0xFF, 0xFF, 0xAC, 0x9B, 0xFF, 0xCB, 0x9B, 0xFF, 0xC9, 0x7A, 0xFF, 0x0D, 0x9C, 0xFF, 0xAF, 0xBC, 0xFF, 0xAF, 0xB4, 0xFF, 0x6B, 0x83, 0xFF, 0x6B, 0x8B, 0xFF, 0x11, 0xC5, 0xFF, 0x6B, 0x8B, 0xFF, 0xAC, 0x93, 0xFF, 0x2A, 0x93, 0xFF, 0x93, 0xDD, 0xFF, 0x2E, 0xAC, 0xFF, 0x11, 0xBD, 0xFF, 0x6B, 0x8B, 0xFF, 0x0D, 0x9C, 0xFF, 0x2D, 0xA4, 0xFF,
-    0x4E, 0xA4, 0xFF, 0x2A, 0x7B, 0xFF, 0xAC, 0x8B, 0xFF, 0x0D, 0x9C, 0xFF, 0x27, 0x5A, 0xFF, 0x10, 0xA5, 0xFF, 0x4D, 0x9C, 0xFF, 0x87, 0x6A, 0xFF, 0x2D, 0x9C, 0xFF, 0xAC, 0x8B, 0xFF, 0x6B, 0x83, 0xFF, 0xAB, 0x8B, 0xFF, 0x4A, 0x7B, 0xFF, 0x6A, 0x83, 0xFF, 0x4A, 0x7B, 0xFF, 0xA8, 0x62, 0xFF, 0x43, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0xA9, 0x62, 0xFF, 0x44, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0xE6, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0x67, 0x5A, 0xFF, 0x64, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x68, 0x62, 0xFF, 0x64, 0x39, 0xFF, 0x26, 0x4A, 0xFF, 0xA8, 0x62, 0xFF, 0xE5, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xCC, 0x8B, 0xFF, 0x0A, 0x73, 0xFF, 0xE5, 0x49, 0xFF, 0xA8, 0x62, 0xFF, 0xD3, 0xCD, 0xFF, 0x06, 0x52, 0xFF, 0xC5, 0x41, 0xFF, 0xE5, 0x49, 0xFF, 0x6A, 0x7B, 0xFF, 0xD0, 0xB4, 0xFF, 0x26, 0x52, 0xFF, 0x67, 0x62, 0xFF, 0xED, 0x93, 0xFF, 0x2A, 0x7B, 0xFF, 0xC8, 0x72, 0xFF, 0xE5, 0x51, 0xFF, 0x87, 0x62, 0xFF, 0xE9, 0x72, 0xFF, 0x6B, 0x8B, 0xFF, 0x2D, 0x9C, 0xFF, 0x09, 0x83, 0xFF, 0xAB, 0x93, 0xFF, 0x91, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0x8F, 0xC4, 0xFF, 0x19, 0xFF, 0xFF, 0x76, 0xF6, 0xFF, 0x2D, 0xB4, 0xFF, 0x8B, 0x93, 0xFF,
-    0x8B, 0x93, 0xFF, 0x4A, 0x83, 0xFF, 0x92, 0xE5, 0xFF, 0x8B, 0x8B, 0xFF, 0xCC, 0x93, 0xFF, 0x4A, 0x83, 0xFF, 0xC8, 0x6A, 0xFF, 0xD0, 0xBC, 0xFF, 0xED, 0x9B, 0xFF, 0x2A, 0x8B, 0xFF, 0xB2, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x93, 0xFF, 0x73, 0xBD, 0xFF, 0x31, 0xCD, 0xFF, 0x0A, 0x7B, 0xFF, 0xEC, 0x9B, 0xFF, 0x8F, 0xAC, 0xFF, 0x6B, 0x8B, 0xFF, 0x4D, 0x94, 0xFF, 0x09, 0x83, 0xFF, 0x0D, 0x9C, 0xFF, 0x10, 0xB5, 0xFF, 0x4A, 0x7B, 0xFF, 0xEC, 0x93, 0xFF, 0x8B, 0x8B, 0xFF, 0x0D, 0x9C, 0xFF, 0x09, 0x73, 0xFF, 0x2A, 0x7B, 0xFF, 0xEC, 0x93, 0xFF, 0x5A, 0xFF, 0xFF, 0xE8, 0x72, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x8B, 0x83, 0xFF, 0x24, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x8C, 0x7B, 0xFF, 0xC5, 0x49, 0xFF, 0x64, 0x31, 0xFF, 0x27, 0x4A, 0xFF, 0x23, 0x29, 0xFF, 0x2A, 0x73, 0xFF, 0x6B, 0x83, 0xFF, 0xC5, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x6A, 0x7B, 0xFF, 0x4A, 0x7B, 0xFF, 0x8B, 0x7B, 0xFF, 0xC5, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0x4A, 0x7B, 0xFF, 0xE5, 0x49, 0xFF, 0xE5, 0x49, 0xFF, 0x88, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0xF0, 0xB4, 0xFF, 0xAC, 0x8B, 0xFF, 0xA8, 0x62, 0xFF, 0xA8, 0x62, 0xFF, 0x06, 0x52, 0xFF, 0x10, 0xB5, 0xFF,
-    0x06, 0x52, 0xFF, 0x6A, 0x83, 0xFF, 0xAC, 0x8B, 0xFF, 0xC9, 0x6A, 0xFF, 0xCC, 0x9B, 0xFF, 0xEC, 0x93, 0xFF, 0x29, 0x83, 0xFF, 0x4A, 0x8B, 0xFF, 0x4D, 0xB4, 0xFF, 0x37, 0xFF, 0xFF, 0x8F, 0xC4, 0xFF, 0x4E, 0xB4, 0xFF, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xE5, 0xFF, 0xCC, 0x9B, 0xFF, 0x2A, 0x83, 0xFF, 0xE9, 0x82, 0xFF, 0x8F, 0xAC, 0xFF, 0x87, 0x6A, 0xFF, 0x4B, 0x83, 0xFF, 0xED, 0x9B, 0xFF, 0x4A, 0x7B, 0xFF, 0x6A, 0x8B, 0xFF, 0xF1, 0xC4, 0xFF, 0x2A, 0x83, 0xFF, 0x0D, 0xAC, 0xFF, 0xD8, 0xF6, 0xFF, 0xE8, 0x82, 0xFF, 0xEA, 0x7A, 0xFF, 0x72, 0xB5, 0xFF, 0x1A, 0xEF, 0xFF, 0xE9, 0x72, 0xFF, 0xD0, 0xBC, 0xFF, 0xA7, 0x6A, 0xFF, 0x2E, 0x9C, 0xFF, 0xA8, 0x62, 0xFF, 0x55, 0xDE, 0xFF, 0x6B, 0x83, 0xFF, 0xCC, 0x8B, 0xFF, 0x6E, 0xA4, 0xFF, 0x4A, 0x83, 0xFF, 0x6A, 0x83, 0xFF, 0xCC, 0x93, 0xFF, 0x4A, 0x7B, 0xFF, 0xE9, 0x72, 0xFF, 0x29, 0x7B, 0xFF, 0x4A, 0x83, 0xFF, 0x88, 0x5A, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x4A, 0x7B, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x2A, 0x6B, 0xFF, 0x06, 0x4A, 0xFF, 0x43, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0xCB, 0x83, 0xFF, 0xE6, 0x41, 0xFF, 0x88, 0x5A, 0xFF, 0xA4, 0x39, 0xFF,
-    0xA8, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0x26, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x0D, 0x94, 0xFF, 0xCD, 0x8B, 0xFF, 0xE6, 0x49, 0xFF, 0x26, 0x52, 0xFF, 0xCC, 0x8B, 0xFF, 0xE5, 0x51, 0xFF, 0xC8, 0x6A, 0xFF, 0x88, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0x4A, 0x83, 0xFF, 0x26, 0x52, 0xFF, 0xA8, 0x6A, 0xFF, 0x05, 0x52, 0xFF, 0x8F, 0xAC, 0xFF, 0x67, 0x62, 0xFF, 0xC8, 0x6A, 0xFF, 0x4E, 0xA4, 0xFF, 0x2C, 0x9C, 0xFF, 0x6A, 0x8B, 0xFF, 0xE9, 0x7A, 0xFF, 0x2A, 0x8B, 0xFF, 0xAF, 0xBC, 0xFF, 0x6B, 0x93, 0xFF, 0x8C, 0x93, 0xFF, 0xAB, 0xB3, 0xFF, 0xCC, 0xA3, 0xFF, 0xC9, 0x82, 0xFF, 0x11, 0xC5, 0xFF, 0x87, 0x6A, 0xFF, 0xC8, 0x82, 0xFF, 0x4E, 0x9C, 0xFF, 0x09, 0x7B, 0xFF, 0xA8, 0x6A, 0xFF, 0xCC, 0x93, 0xFF, 0x9B, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x76, 0xDE, 0xFF, 0x2D, 0xAC, 0xFF, 0x2A, 0x83, 0xFF, 0xC8, 0x7A, 0xFF, 0x2E, 0xA4, 0xFF, 0xEE, 0x9B, 0xFF, 0x2E, 0xA4, 0xFF, 0xE9, 0x72, 0xFF, 0x96, 0xF6, 0xFF, 0x6B, 0x83, 0xFF, 0x4A, 0x7B, 0xFF, 0x0D, 0x94, 0xFF, 0x8F, 0xA4, 0xFF, 0x30, 0xAD, 0xFF, 0xAF, 0xA4, 0xFF, 0xD0, 0xAC, 0xFF, 0xAB, 0x8B, 0xFF, 0xEC, 0x93, 0xFF, 0xCC, 0x93, 0xFF, 0x29, 0x7B, 0xFF, 0xC8, 0x6A, 0xFF, 0x6A, 0x83, 0xFF, 0x8B, 0x8B, 0xFF, 0xC8, 0x6A, 0xFF,
-    0x03, 0x21, 0xFF, 0x85, 0x31, 0xFF, 0x06, 0x4A, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0xC8, 0x62, 0xFF, 0x26, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0xF4, 0xCD, 0xFF, 0x84, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xE9, 0x62, 0xFF, 0x8A, 0x7B, 0xFF, 0x47, 0x52, 0xFF, 0x2D, 0x9C, 0xFF, 0xE5, 0x49, 0xFF, 0xC5, 0x39, 0xFF, 0x26, 0x52, 0xFF, 0x11, 0xB5, 0xFF, 0x88, 0x62, 0xFF, 0x67, 0x62, 0xFF, 0x06, 0x52, 0xFF, 0x09, 0x73, 0xFF, 0x34, 0xEE, 0xFF, 0xC8, 0x7A, 0xFF, 0x8B, 0x8B, 0xFF, 0x47, 0x62, 0xFF, 0xAB, 0x93, 0xFF, 0x09, 0x73, 0xFF, 0x06, 0x52, 0xFF, 0x47, 0x5A, 0xFF, 0x31, 0xC5, 0xFF, 0x26, 0x5A, 0xFF, 0xE9, 0x6A, 0xFF, 0x46, 0x5A, 0xFF, 0xE9, 0x7A, 0xFF, 0xF0, 0xBC, 0xFF, 0x4A, 0x83, 0xFF, 0xA8, 0x6A, 0xFF, 0xE9, 0x82, 0xFF, 0x2D, 0xA4, 0xFF, 0x2A, 0x83, 0xFF, 0x8C, 0x8B, 0xFF, 0xAC, 0x9B, 0xFF, 0xD4, 0xDD, 0xFF, 0x2A, 0x83, 0xFF, 0x8B, 0x8B, 0xFF, 0x2A, 0x7B, 0xFF, 0xE9, 0x7A, 0xFF, 0x2A, 0x7B, 0xFF, 0xE9, 0x7A, 0xFF, 0xED, 0x93, 0xFF, 0x4A, 0x83, 0xFF, 0x4E, 0xA4, 0xFF, 0x8F, 0xAC, 0xFF, 0xA9, 0x6A, 0xFF, 0x77, 0xF6, 0xFF, 0x77, 0xF6, 0xFF, 0x87, 0x6A, 0xFF, 0xC9, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xB4, 0xFF, 0x8C, 0x93, 0xFF,
-    0x0D, 0x9C, 0xFF, 0x96, 0xFE, 0xFF, 0x11, 0xBD, 0xFF, 0xD7, 0xEE, 0xFF, 0xD3, 0xC5, 0xFF, 0xD3, 0xCD, 0xFF, 0xA8, 0x6A, 0xFF, 0x87, 0x62, 0xFF, 0x09, 0x7B, 0xFF, 0x4E, 0xA4, 0xFF, 0xF0, 0xB4, 0xFF, 0x8B, 0x83, 0xFF, 0x0D, 0x9C, 0xFF, 0xE8, 0x72, 0xFF, 0xA8, 0x6A, 0xFF, 0xA7, 0x62, 0xFF, 0x02, 0x21, 0xFF, 0xA5, 0x39, 0xFF, 0x46, 0x5A, 0xFF, 0x43, 0x29, 0xFF, 0xA8, 0x62, 0xFF, 0x44, 0x31, 0xFF, 0x07, 0x4A, 0xFF, 0x26, 0x52, 0xFF, 0x63, 0x31, 0xFF, 0x8B, 0x83, 0xFF, 0xA5, 0x39, 0xFF, 0x9B, 0xFF, 0xFF, 0x27, 0x52, 0xFF, 0x29, 0x6B, 0xFF, 0x6E, 0xA4, 0xFF, 0x26, 0x52, 0xFF, 0xA5, 0x41, 0xFF, 0xC6, 0x41, 0xFF, 0x29, 0x73, 0xFF, 0x29, 0x7B, 0xFF, 0x68, 0x5A, 0xFF, 0xA8, 0x6A, 0xFF, 0xAF, 0xB4, 0xFF, 0x8A, 0x8B, 0xFF, 0xE9, 0x7A, 0xFF, 0x50, 0xF5, 0xFF, 0xB8, 0xEE, 0xFF, 0x6B, 0x93, 0xFF, 0xC9, 0x72, 0xFF, 0x26, 0x5A, 0xFF, 0x27, 0x5A, 0xFF, 0xE5, 0x49, 0xFF, 0xEC, 0x9B, 0xFF, 0x25, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0x0A, 0x7B, 0xFF, 0xC8, 0x72, 0xFF, 0xEC, 0x9B, 0xFF, 0x2D, 0xA4, 0xFF, 0xA8, 0x6A, 0xFF, 0x2A, 0x83, 0xFF, 0x8E, 0xAC, 0xFF, 0x2A, 0x83, 0xFF, 0xC8, 0x72, 0xFF, 0x8B, 0x8B, 0xFF, 0x09, 0x7B, 0xFF, 0xCC, 0x93, 0xFF, 0xC8, 0x72, 0xFF,
-    0xCC, 0x93, 0xFF, 0x47, 0x62, 0xFF, 0x2D, 0x9C, 0xFF, 0xC8, 0x6A, 0xFF, 0xC8, 0x7A, 0xFF, 0xA8, 0x6A, 0xFF, 0xC9, 0x6A, 0xFF, 0xB0, 0xB4, 0xFF, 0x14, 0xD6, 0xFF, 0xA9, 0x6A, 0xFF, 0x0D, 0x94, 0xFF, 0xE5, 0x61, 0xFF, 0xA9, 0x6A, 0xFF, 0x6E, 0x9B, 0xFF, 0xDF, 0xFF, 0xFF, 0x0A, 0x7B, 0xFF, 0xAC, 0x8B, 0xFF, 0xED, 0xA3, 0xFF, 0x14, 0xEE, 0xFF, 0xE9, 0x72, 0xFF, 0x8B, 0x8B, 0xFF, 0xF4, 0xD5, 0xFF, 0xE4, 0x51, 0xFF, 0x6E, 0xA4, 0xFF, 0x31, 0xBD, 0xFF, 0x2E, 0xA4, 0xFF, 0x8B, 0x8B, 0xFF, 0x2D, 0x9C, 0xFF, 0x2A, 0x7B, 0xFF, 0x88, 0x62, 0xFF, 0xE8, 0x72, 0xFF, 0x09, 0x73, 0xFF, 0x44, 0x29, 0xFF, 0x03, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x84, 0x31, 0xFF, 0xE5, 0x49, 0xFF, 0x06, 0x4A, 0xFF, 0x43, 0x39, 0xFF, 0x26, 0x4A, 0xFF, 0xA5, 0x41, 0xFF, 0xAF, 0xA4, 0xFF, 0x09, 0x6B, 0xFF, 0xA8, 0x62, 0xFF, 0x6A, 0x83, 0xFF, 0x46, 0x52, 0xFF, 0x2D, 0x9C, 0xFF, 0xC9, 0x6A, 0xFF, 0x67, 0x62, 0xFF, 0x27, 0x5A, 0xFF, 0xCC, 0x8B, 0xFF, 0xC8, 0x72, 0xFF, 0x67, 0x62, 0xFF, 0xC8, 0x72, 0xFF, 0x33, 0xE6, 0xFF, 0x75, 0xEE, 0xFF, 0xCC, 0x93, 0xFF, 0x26, 0x52, 0xFF, 0x66, 0x62, 0xFF, 0x26, 0x52, 0xFF, 0xC9, 0x6A, 0xFF,
-    0xAF, 0xB4, 0xFF, 0x88, 0x62, 0xFF, 0xC5, 0x51, 0xFF, 0xA4, 0x49, 0xFF, 0xAF, 0xB4, 0xFF, 0xF0, 0xCC, 0xFF, 0x2C, 0xAC, 0xFF, 0x87, 0x62, 0xFF, 0xA8, 0x72, 0xFF, 0xB2, 0xD5, 0xFF, 0xCC, 0x8B, 0xFF, 0x0A, 0x7B, 0xFF, 0x6B, 0x83, 0xFF, 0xCF, 0xB4, 0xFF, 0xF0, 0xB4, 0xFF, 0x15, 0xD6, 0xFF, 0x67, 0x62, 0xFF, 0x88, 0x6A, 0xFF, 0x4B, 0x83, 0xFF, 0x31, 0xC5, 0xFF, 0xC9, 0x6A, 0xFF, 0x0A, 0x73, 0xFF, 0xA8, 0x6A, 0xFF, 0x88, 0x62, 0xFF, 0x09, 0x7B, 0xFF, 0x4F, 0xA4, 0xFF, 0xA9, 0x6A, 0xFF, 0x27, 0x52, 0xFF, 0xF4, 0xD5, 0xFF, 0x67, 0x62, 0xFF, 0x2A, 0x7B, 0xFF, 0xA8, 0x6A, 0xFF, 0xA8, 0x72, 0xFF, 0x6E, 0xA4, 0xFF, 0x6B, 0x7B, 0xFF, 0xA4, 0x41, 0xFF, 0x0D, 0x94, 0xFF, 0x46, 0x52, 0xFF, 0x4A, 0x83, 0xFF, 0xF4, 0xCD, 0xFF, 0x2D, 0x9C, 0xFF, 0xCC, 0x8B, 0xFF, 0xC9, 0x72, 0xFF, 0xA8, 0x62, 0xFF, 0x87, 0x62, 0xFF, 0xE9, 0x72, 0xFF, 0xE9, 0x6A, 0xFF, 0xC8, 0x6A, 0xFF, 0x23, 0x29, 0xFF, 0x06, 0x4A, 0xFF, 0x44, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0xA5, 0x39, 0xFF, 0xE5, 0x49, 0xFF, 0x84, 0x39, 0xFF, 0xC5, 0x49, 0xFF, 0x71, 0xE5, 0xFF, 0xFC, 0xFF, 0xFF, 0x0B, 0x9C, 0xFF, 0x6A, 0x7B, 0xFF, 0xCB, 0x8B, 0xFF, 0x4A, 0x83, 0xFF, 0xF8, 0xE6, 0xFF,
-    0xA7, 0x62, 0xFF, 0x44, 0x31, 0xFF, 0x27, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x8B, 0xFF, 0x4A, 0x7B, 0xFF, 0x8F, 0xB4, 0xFF, 0x67, 0x6A, 0xFF, 0xC8, 0x72, 0xFF, 0x29, 0x8B, 0xFF, 0x95, 0xE6, 0xFF, 0x88, 0x62, 0xFF, 0x44, 0x41, 0xFF, 0x47, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0xAF, 0xAC, 0xFF, 0xC8, 0x72, 0xFF, 0x11, 0xCD, 0xFF, 0x8B, 0x93, 0xFF, 0xC5, 0x51, 0xFF, 0x8A, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xF7, 0xFF, 0xE5, 0x51, 0xFF, 0xE8, 0x82, 0xFF, 0x56, 0xF6, 0xFF, 0xC9, 0x72, 0xFF, 0x26, 0x52, 0xFF, 0xA8, 0x72, 0xFF, 0x16, 0xD6, 0xFF, 0xA7, 0x6A, 0xFF, 0x68, 0x62, 0xFF, 0xE6, 0x51, 0xFF, 0x6A, 0x93, 0xFF, 0x2A, 0x7B, 0xFF, 0x6A, 0x83, 0xFF, 0xEA, 0x72, 0xFF, 0xAF, 0xBC, 0xFF, 0xA8, 0x62, 0xFF, 0x4B, 0x7B, 0xFF, 0x68, 0x62, 0xFF, 0xA8, 0x72, 0xFF, 0x87, 0x62, 0xFF, 0x27, 0x52, 0xFF, 0x07, 0x52, 0xFF, 0xF1, 0xB4, 0xFF, 0x27, 0x5A, 0xFF, 0x27, 0x52, 0xFF, 0x2A, 0x73, 0xFF, 0xED, 0x8B, 0xFF, 0xC9, 0x62, 0xFF, 0xA5, 0x41, 0xFF, 0x4D, 0x8C, 0xFF, 0x4A, 0x7B, 0xFF, 0x6B, 0x83, 0xFF, 0x2D, 0x9C, 0xFF, 0xCC, 0x93, 0xFF, 0x47, 0x5A, 0xFF, 0xA8, 0x6A, 0xFF, 0x43, 0x31, 0xFF, 0x67, 0x5A, 0xFF, 0xC8, 0x6A, 0xFF, 0x87, 0x62, 0xFF, 0x67, 0x5A, 0xFF,
-    0x4A, 0x7B, 0xFF, 0x64, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x84, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0x44, 0x39, 0xFF, 0xE5, 0x51, 0xFF, 0xC6, 0x49, 0xFF, 0xA4, 0x49, 0xFF, 0x47, 0x62, 0xFF, 0x43, 0x31, 0xFF, 0xC5, 0x41, 0xFF, 0x88, 0x62, 0xFF, 0xC5, 0x49, 0xFF, 0x44, 0x31, 0xFF, 0x06, 0x52, 0xFF, 0x8B, 0x93, 0xFF, 0x67, 0x5A, 0xFF, 0x69, 0x83, 0xFF, 0x11, 0xB5, 0xFF, 0xA8, 0x62, 0xFF, 0xE8, 0x72, 0xFF, 0xC8, 0x72, 0xFF, 0x8B, 0x83, 0xFF, 0x27, 0x52, 0xFF, 0xAB, 0x8B, 0xFF, 0x47, 0x5A, 0xFF, 0x6A, 0x7B, 0xFF, 0x25, 0x52, 0xFF, 0x67, 0x62, 0xFF, 0xC9, 0x6A, 0xFF, 0xC5, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0x66, 0x6A, 0xFF, 0xF0, 0xE4, 0xFF, 0xC9, 0x8A, 0xFF, 0xC5, 0x49, 0xFF, 0x67, 0x62, 0xFF, 0x93, 0xDD, 0xFF, 0x06, 0x5A, 0xFF, 0xA5, 0x41, 0xFF, 0x6B, 0x83, 0xFF, 0x67, 0x62, 0xFF, 0xE5, 0x51, 0xFF, 0x06, 0x52, 0xFF, 0x26, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0x06, 0x52, 0xFF, 0xC8, 0x72, 0xFF, 0x27, 0x5A, 0xFF, 0xCC, 0x8B, 0xFF, 0xC5, 0x51, 0xFF, 0x8B, 0x8B, 0xFF, 0xD3, 0xC5, 0xFF, 0xE6, 0x51, 0xFF, 0xA8, 0x6A, 0xFF, 0x8A, 0x7B, 0xFF, 0xA5, 0x41, 0xFF, 0xC6, 0x41, 0xFF, 0x6B, 0x83, 0xFF, 0xC5, 0x41, 0xFF,
-    0xE6, 0x49, 0xFF, 0x47, 0x5A, 0xFF, 0x47, 0x62, 0xFF, 0x6B, 0x7B, 0xFF, 0x8B, 0x7B, 0xFF, 0x8E, 0x94, 0xFF, 0xAF, 0xA4, 0xFF, 0x8B, 0x83, 0xFF, 0x4A, 0x7B, 0xFF, 0xC5, 0x49, 0xFF, 0x8B, 0x83, 0xFF, 0xA5, 0x41, 0xFF, 0x67, 0x5A, 0xFF, 0x09, 0x73, 0xFF, 0x47, 0x5A, 0xFF, 0x67, 0x5A, 0xFF, 0x03, 0x21, 0xFF, 0x03, 0x21, 0xFF, 0x43, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0xA5, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0x47, 0x52, 0xFF, 0x44, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0x06, 0x52, 0xFF, 0x44, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0xA8, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0x85, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0xC9, 0x6A, 0xFF, 0xC8, 0x72, 0xFF, 0x47, 0x5A, 0xFF, 0x46, 0x5A, 0xFF, 0x6A, 0x7B, 0xFF, 0x4B, 0x7B, 0xFF, 0x64, 0x39, 0xFF, 0xE6, 0x49, 0xFF, 0xAB, 0x83, 0xFF, 0x07, 0x52, 0xFF, 0x63, 0x39, 0xFF, 0xE6, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x5A, 0xFF, 0xAF, 0xAC, 0xFF, 0xC5, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0x26, 0x5A, 0xFF, 0xAB, 0x8B, 0xFF, 0x67, 0x62, 0xFF, 0xA5, 0x41, 0xFF, 0xA9, 0x6A, 0xFF, 0x52, 0xCD, 0xFF, 0xC5, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0xC6, 0x49, 0xFF, 0x27, 0x52, 0xFF, 0xE5, 0x49, 0xFF, 0x2E, 0x94, 0xFF,
-    0x47, 0x62, 0xFF, 0x88, 0x62, 0xFF, 0x8C, 0x83, 0xFF, 0x06, 0x52, 0xFF, 0x46, 0x5A, 0xFF, 0xA5, 0x41, 0xFF, 0xE9, 0x72, 0xFF, 0xC9, 0x6A, 0xFF, 0xAB, 0x83, 0xFF, 0xC6, 0x49, 0xFF, 0x64, 0x39, 0xFF, 0xC5, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0x27, 0x4A, 0xFF, 0xE6, 0x49, 0xFF, 0x0C, 0x9C, 0xFF, 0xE6, 0x49, 0xFF, 0x07, 0x4A, 0xFF, 0x64, 0x39, 0xFF, 0x2A, 0x83, 0xFF, 0x29, 0x6B, 0xFF, 0xAC, 0x83, 0xFF, 0xED, 0x8B, 0xFF, 0x6A, 0x83, 0xFF, 0x43, 0x39, 0xFF, 0x85, 0x41, 0xFF, 0x0A, 0x73, 0xFF, 0x6B, 0x7B, 0xFF, 0xC8, 0x6A, 0xFF, 0xC8, 0x6A, 0xFF, 0x47, 0x5A, 0xFF, 0x67, 0x5A, 0xFF, 0x03, 0x21, 0xFF, 0x03, 0x21, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0xC8, 0x5A, 0xFF, 0xC2, 0x20, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0x6A, 0x7B, 0xFF, 0x44, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x4A, 0x73, 0xFF, 0x26, 0x52, 0xFF, 0xA5, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0xC8, 0x62, 0xFF, 0x6A, 0x7B, 0xFF, 0xC5, 0x41, 0xFF, 0xE5, 0x49, 0xFF, 0xA7, 0x62, 0xFF, 0xA5, 0x41, 0xFF, 0x09, 0x73, 0xFF, 0x64, 0x39, 0xFF, 0x29, 0x7B, 0xFF, 0x6E, 0x9C, 0xFF, 0xE5, 0x51, 0xFF, 0x44, 0x31, 0xFF, 0x4D, 0x9C, 0xFF, 0x27, 0x52, 0xFF, 0x64, 0x39, 0xFF,
-    0x6B, 0x83, 0xFF, 0xEC, 0x93, 0xFF, 0x84, 0x41, 0xFF, 0x43, 0x39, 0xFF, 0xC9, 0x6A, 0xFF, 0xEC, 0x93, 0xFF, 0x26, 0x52, 0xFF, 0x85, 0x39, 0xFF, 0xA8, 0x62, 0xFF, 0x2D, 0xAC, 0xFF, 0xE5, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0xE9, 0x72, 0xFF, 0xF0, 0xBC, 0xFF, 0x2A, 0x7B, 0xFF, 0xC5, 0x49, 0xFF, 0xC6, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0x87, 0x6A, 0xFF, 0xE6, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0x26, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0x84, 0x41, 0xFF, 0x0A, 0x63, 0xFF, 0x0E, 0x9C, 0xFF, 0x4E, 0x94, 0xFF, 0x88, 0x62, 0xFF, 0xC5, 0x41, 0xFF, 0xC6, 0x41, 0xFF, 0x8B, 0x8B, 0xFF, 0xE6, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x27, 0x4A, 0xFF, 0x8B, 0x8B, 0xFF, 0xC9, 0x62, 0xFF, 0x44, 0x39, 0xFF, 0xE9, 0x6A, 0xFF, 0xE5, 0x49, 0xFF, 0x67, 0x62, 0xFF, 0xE9, 0x72, 0xFF, 0x2A, 0x73, 0xFF, 0x26, 0x5A, 0xFF, 0x0A, 0x73, 0xFF, 0xC8, 0x6A, 0xFF, 0x26, 0x52, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x85, 0x39, 0xFF, 0xAB, 0x83, 0xFF, 0xE6, 0x41, 0xFF, 0x03, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0xE9, 0x6A, 0xFF, 0x67, 0x5A, 0xFF, 0xC4, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0xEB, 0x93, 0xFF, 0x23, 0x29, 0xFF, 0xE6, 0x49, 0xFF, 0x27, 0x4A, 0xFF,
-    0xC5, 0x41, 0xFF, 0xC8, 0x6A, 0xFF, 0x47, 0x52, 0xFF, 0x29, 0x73, 0xFF, 0xC5, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0x4A, 0x7B, 0xFF, 0xC5, 0x41, 0xFF, 0x43, 0x31, 0xFF, 0xC5, 0x49, 0xFF, 0x44, 0x31, 0xFF, 0x09, 0x7B, 0xFF, 0x64, 0x39, 0xFF, 0xE5, 0x51, 0xFF, 0x84, 0x41, 0xFF, 0x23, 0x31, 0xFF, 0x4E, 0xA4, 0xFF, 0xAF, 0xAC, 0xFF, 0x44, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0xA8, 0x6A, 0xFF, 0xCC, 0x93, 0xFF, 0xC6, 0x49, 0xFF, 0x85, 0x39, 0xFF, 0xD1, 0xAC, 0xFF, 0xEC, 0x9B, 0xFF, 0xE6, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0x29, 0x8B, 0xFF, 0xCC, 0xA3, 0xFF, 0x4A, 0x83, 0xFF, 0xC6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0xD2, 0xDD, 0xFF, 0xC6, 0x49, 0xFF, 0xED, 0x9B, 0xFF, 0xE6, 0x49, 0xFF, 0x6B, 0x8B, 0xFF, 0xC9, 0x6A, 0xFF, 0x06, 0x5A, 0xFF, 0xC5, 0x49, 0xFF, 0x64, 0x41, 0xFF, 0x64, 0x39, 0xFF, 0xE6, 0x49, 0xFF, 0x8F, 0xAC, 0xFF, 0xA4, 0x41, 0xFF, 0xA6, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0x64, 0x39, 0xFF, 0xAC, 0x8B, 0xFF, 0xE6, 0x49, 0xFF, 0xA9, 0x5A, 0xFF, 0xC8, 0x62, 0xFF, 0x26, 0x52, 0xFF, 0x23, 0x31, 0xFF, 0xE9, 0x62, 0xFF, 0xC9, 0x6A, 0xFF, 0xE9, 0x6A, 0xFF, 0x29, 0x7B, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x73, 0xFF, 0x87, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0x26, 0x52, 0xFF,
-    0xE3, 0x20, 0xFF, 0x09, 0x6B, 0xFF, 0x23, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0xC5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xB3, 0xC5, 0xFF, 0x44, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0xEB, 0xB3, 0xFF, 0x94, 0xEE, 0xFF, 0xA4, 0x41, 0xFF, 0x23, 0x39, 0xFF, 0x23, 0x31, 0xFF, 0x06, 0x4A, 0xFF, 0xC8, 0x62, 0xFF, 0x8B, 0x83, 0xFF, 0xE5, 0x49, 0xFF, 0x88, 0x62, 0xFF, 0x8B, 0x83, 0xFF, 0x25, 0x72, 0xFF, 0x26, 0x52, 0xFF, 0xE5, 0x49, 0xFF, 0x84, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0xE5, 0x49, 0xFF, 0xA8, 0x6A, 0xFF, 0x4A, 0x73, 0xFF, 0x43, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x41, 0xFF, 0x26, 0x52, 0xFF, 0x44, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0x8C, 0x83, 0xFF, 0x88, 0x62, 0xFF, 0x88, 0x6A, 0xFF, 0xE6, 0x49, 0xFF, 0x85, 0x39, 0xFF, 0x06, 0x52, 0xFF, 0xE6, 0x49, 0xFF, 0xC5, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0x10, 0xCD, 0xFF, 0x88, 0x6A, 0xFF, 0xC6, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0xC5, 0x49, 0xFF, 0xC6, 0x41, 0xFF, 0x85, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0xC5, 0x49, 0xFF, 0xE5, 0x51, 0xFF, 0xC6, 0x41, 0xFF, 0xE6, 0x49, 0xFF, 0xA8, 0x62, 0xFF, 0xC9, 0x62, 0xFF, 0x2A, 0x7B, 0xFF, 0x47, 0x62, 0xFF, 0xA5, 0x41, 0xFF,
-    0x07, 0x4A, 0xFF, 0x85, 0x39, 0xFF, 0x67, 0x5A, 0xFF, 0x88, 0x52, 0xFF, 0xA8, 0x5A, 0xFF, 0x06, 0x4A, 0xFF, 0x68, 0x5A, 0xFF, 0xE5, 0x49, 0xFF, 0x8C, 0x7B, 0xFF, 0xE9, 0x6A, 0xFF, 0x2A, 0x73, 0xFF, 0x88, 0x62, 0xFF, 0xC8, 0x6A, 0xFF, 0x87, 0x62, 0xFF, 0x47, 0x52, 0xFF, 0x67, 0x5A, 0xFF, 0x05, 0x52, 0xFF, 0x43, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x0A, 0x73, 0xFF, 0x23, 0x29, 0xFF, 0x6B, 0x7B, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0x8D, 0xC4, 0xFF, 0xF2, 0xDD, 0xFF, 0x6B, 0x83, 0xFF, 0xA5, 0x41, 0xFF, 0x43, 0x31, 0xFF, 0x88, 0x5A, 0xFF, 0x87, 0x62, 0xFF, 0x67, 0x5A, 0xFF, 0x64, 0x39, 0xFF, 0xC8, 0x6A, 0xFF, 0x4D, 0xA4, 0xFF, 0xC3, 0x69, 0xFF, 0x4A, 0x7B, 0xFF, 0xA8, 0x62, 0xFF, 0x64, 0x39, 0xFF, 0xA8, 0x72, 0xFF, 0xA8, 0x62, 0xFF, 0x87, 0x62, 0xFF, 0xE6, 0x49, 0xFF, 0xEC, 0x9B, 0xFF, 0x64, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0x06, 0x5A, 0xFF, 0x84, 0x41, 0xFF, 0x6E, 0xA4, 0xFF, 0x85, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0x09, 0x73, 0xFF, 0x8D, 0xAC, 0xFF, 0xC5, 0x41, 0xFF, 0x64, 0x31, 0xFF, 0xC6, 0x41, 0xFF, 0x8B, 0x8B, 0xFF, 0xA5, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xE5, 0x49, 0xFF, 0x07, 0x52, 0xFF, 0x84, 0x41, 0xFF, 0xC6, 0x41, 0xFF,
-    0x2A, 0x7B, 0xFF, 0xA5, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x41, 0xFF, 0xC4, 0x51, 0xFF, 0xC6, 0x41, 0xFF, 0xEC, 0x93, 0xFF, 0xC5, 0x41, 0xFF, 0x6F, 0xAC, 0xFF, 0x85, 0x41, 0xFF, 0x06, 0x52, 0xFF, 0xEA, 0x72, 0xFF, 0xB4, 0xD5, 0xFF, 0xCC, 0xA3, 0xFF, 0x4B, 0x83, 0xFF, 0xA4, 0x49, 0xFF, 0x8B, 0x8B, 0xFF, 0x44, 0x39, 0xFF, 0xA8, 0x62, 0xFF, 0x8B, 0x8B, 0xFF, 0x47, 0x52, 0xFF, 0x84, 0x39, 0xFF, 0xEA, 0x62, 0xFF, 0xA8, 0x62, 0xFF, 0x4B, 0x83, 0xFF, 0x67, 0x5A, 0xFF, 0xA8, 0x62, 0xFF, 0xE9, 0x6A, 0xFF, 0x87, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0x88, 0x5A, 0xFF, 0x23, 0x29, 0xFF, 0xE3, 0x20, 0xFF, 0x64, 0x31, 0xFF, 0x02, 0x21, 0xFF, 0x84, 0x39, 0xFF, 0x70, 0xBD, 0xFF, 0xE2, 0x28, 0xFF, 0x24, 0x29, 0xFF, 0x84, 0x41, 0xFF, 0x33, 0xD6, 0xFF, 0x4A, 0x8B, 0xFF, 0x88, 0x6A, 0xFF, 0x05, 0x52, 0xFF, 0xAC, 0x83, 0xFF, 0xB2, 0xD5, 0xFF, 0xC5, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x09, 0x6B, 0xFF, 0x6A, 0x7B, 0xFF, 0x71, 0xCD, 0xFF, 0xA6, 0x7A, 0xFF, 0xE5, 0x49, 0xFF, 0xA1, 0x20, 0xFF, 0x29, 0x7B, 0xFF, 0x64, 0x31, 0xFF, 0x47, 0x5A, 0xFF, 0x23, 0x29, 0xFF, 0xE6, 0x49, 0xFF, 0x84, 0x41, 0xFF, 0x87, 0x62, 0xFF, 0x85, 0x39, 0xFF, 0x23, 0x31, 0xFF,
-    0x4A, 0x83, 0xFF, 0x09, 0x73, 0xFF, 0x23, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0xCC, 0x93, 0xFF, 0x85, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0xE6, 0x49, 0xFF, 0x09, 0x7B, 0xFF, 0x4B, 0x73, 0xFF, 0x64, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0x06, 0x52, 0xFF, 0x27, 0x52, 0xFF, 0xC6, 0x41, 0xFF, 0x85, 0x39, 0xFF, 0x07, 0x4A, 0xFF, 0xC5, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0x64, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0xA5, 0x41, 0xFF, 0x64, 0x39, 0xFF, 0x67, 0x62, 0xFF, 0x64, 0x39, 0xFF, 0x03, 0x31, 0xFF, 0xAC, 0x93, 0xFF, 0xCA, 0x72, 0xFF, 0x19, 0xF7, 0xFF, 0x46, 0x6A, 0xFF, 0x03, 0x31, 0xFF, 0xA8, 0x72, 0xFF, 0xE2, 0x30, 0xFF, 0xC8, 0x72, 0xFF, 0x4B, 0x7B, 0xFF, 0x6B, 0x8B, 0xFF, 0x84, 0x39, 0xFF, 0xC9, 0x62, 0xFF, 0x87, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0xA8, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0x47, 0x5A, 0xFF, 0x88, 0x62, 0xFF, 0x06, 0x4A, 0xFF, 0x64, 0x29, 0xFF, 0x03, 0x21, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x84, 0x39, 0xFF, 0x06, 0x4A, 0xFF, 0x64, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0xE6, 0x49, 0xFF, 0x87, 0x62, 0xFF, 0xA8, 0x72, 0xFF, 0xA7, 0x6A, 0xFF, 0x49, 0x83, 0xFF, 0x44, 0x31, 0xFF, 0x46, 0x52, 0xFF, 0xA5, 0x41, 0xFF,
-    0x84, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x26, 0x52, 0xFF, 0x59, 0xFF, 0xFF, 0xA8, 0x72, 0xFF, 0x6C, 0x83, 0xFF, 0x84, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0xE7, 0x49, 0xFF, 0x03, 0x29, 0xFF, 0xA8, 0x6A, 0xFF, 0x23, 0x29, 0xFF, 0x84, 0x41, 0xFF, 0x64, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x88, 0x5A, 0xFF, 0x64, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x0A, 0x73, 0xFF, 0x4B, 0x7B, 0xFF, 0xA5, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0x2A, 0x83, 0xFF, 0x85, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0x69, 0x5A, 0xFF, 0x48, 0x5A, 0xFF, 0x85, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0x92, 0xDD, 0xFF, 0xA5, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xC5, 0x49, 0xFF, 0xAE, 0xB4, 0xFF, 0x06, 0x4A, 0xFF, 0x64, 0x39, 0xFF, 0xE9, 0x72, 0xFF, 0xE6, 0x51, 0xFF, 0xCC, 0x93, 0xFF, 0xCD, 0x8B, 0xFF, 0x52, 0xCD, 0xFF, 0xF9, 0xEE, 0xFF, 0x0A, 0x8B, 0xFF, 0x0A, 0x7B, 0xFF, 0x51, 0xD5, 0xFF, 0x85, 0x49, 0xFF, 0x8F, 0xAC, 0xFF, 0x4A, 0x7B, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0xE9, 0x6A, 0xFF, 0x47, 0x52, 0xFF, 0xC5, 0x41, 0xFF, 0xC8, 0x6A, 0xFF, 0x68, 0x5A, 0xFF, 0xE6, 0x49, 0xFF, 0x84, 0x39, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF,
-    0x8E, 0x9C, 0xFF, 0x03, 0x21, 0xFF, 0x50, 0xC5, 0xFF, 0x59, 0xEF, 0xFF, 0x03, 0x29, 0xFF, 0x4B, 0x73, 0xFF, 0x2E, 0x94, 0xFF, 0x72, 0xDD, 0xFF, 0xFE, 0xFF, 0xFF, 0xE9, 0x7A, 0xFF, 0x71, 0xDD, 0xFF, 0xD3, 0xE5, 0xFF, 0x13, 0xF6, 0xFF, 0x84, 0x41, 0xFF, 0x2E, 0x84, 0xFF, 0x9A, 0xFF, 0xFF, 0xA7, 0x6A, 0xFF, 0x0C, 0x9C, 0xFF, 0xC5, 0x49, 0xFF, 0x78, 0xFF, 0xFF, 0xAB, 0x9B, 0xFF, 0x06, 0x52, 0xFF, 0x6B, 0x83, 0xFF, 0x07, 0x4A, 0xFF, 0xE2, 0x20, 0xFF, 0xA5, 0x41, 0xFF, 0x43, 0x31, 0xFF, 0x4A, 0x7B, 0xFF, 0x44, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x64, 0x39, 0xFF, 0x43, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0xE6, 0x49, 0xFF, 0x44, 0x31, 0xFF, 0x69, 0x5A, 0xFF, 0x64, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0xAB, 0x93, 0xFF, 0xC5, 0x41, 0xFF, 0xE6, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0xE6, 0x49, 0xFF, 0x6A, 0x83, 0xFF, 0x85, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0x2A, 0x7B, 0xFF, 0x27, 0x52, 0xFF, 0xC9, 0x62, 0xFF, 0x85, 0x41, 0xFF, 0xA4, 0x41, 0xFF, 0x88, 0x6A, 0xFF, 0x4F, 0xB4, 0xFF, 0xD1, 0xB4, 0xFF, 0xA9, 0x6A, 0xFF, 0xA5, 0x49, 0xFF, 0xD1, 0xD4, 0xFF, 0x47, 0x6A, 0xFF, 0xED, 0x9B, 0xFF,
-    0x6F, 0xBC, 0xFF, 0x47, 0x5A, 0xFF, 0x2E, 0x9C, 0xFF, 0x6B, 0x8B, 0xFF, 0x44, 0x39, 0xFF, 0xE6, 0x49, 0xFF, 0x09, 0x73, 0xFF, 0x88, 0x5A, 0xFF, 0x47, 0x52, 0xFF, 0xA5, 0x41, 0xFF, 0xA8, 0x62, 0xFF, 0x26, 0x52, 0xFF, 0x27, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x27, 0x52, 0xFF, 0x06, 0x4A, 0xFF, 0x63, 0x31, 0xFF, 0xA6, 0x6A, 0xFF, 0xE3, 0x20, 0xFF, 0x65, 0x39, 0xFF, 0xE5, 0x51, 0xFF, 0xA5, 0x41, 0xFF, 0x38, 0xF7, 0xFF, 0x65, 0x39, 0xFF, 0x47, 0x6A, 0xFF, 0xCA, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x95, 0xF6, 0xFF, 0x84, 0x39, 0xFF, 0xA4, 0x41, 0xFF, 0x0D, 0x8C, 0xFF, 0x8E, 0xAC, 0xFF, 0x64, 0x39, 0xFF, 0x06, 0x52, 0xFF, 0x92, 0xDD, 0xFF, 0x8B, 0x8B, 0xFF, 0xC5, 0x49, 0xFF, 0x64, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x6B, 0x7B, 0xFF, 0x84, 0x39, 0xFF, 0x8E, 0xA4, 0xFF, 0x44, 0x31, 0xFF, 0xE9, 0x6A, 0xFF, 0x23, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0x26, 0x52, 0xFF, 0x47, 0x5A, 0xFF, 0x43, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0x2E, 0x9C, 0xFF, 0xE5, 0x51, 0xFF, 0x85, 0x41, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x4A, 0x7B, 0xFF, 0xA5, 0x41, 0xFF, 0x27, 0x52, 0xFF, 0x4E, 0xCC, 0xFF, 0x43, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x64, 0x39, 0xFF,
-    0x85, 0x39, 0xFF, 0x85, 0x41, 0xFF, 0xA5, 0x41, 0xFF, 0x23, 0x31, 0xFF, 0xA5, 0x41, 0xFF, 0x27, 0x52, 0xFF, 0x6B, 0x83, 0xFF, 0x64, 0x39, 0xFF, 0x47, 0x5A, 0xFF, 0xF0, 0xC4, 0xFF, 0xEA, 0x72, 0xFF, 0x89, 0x6A, 0xFF, 0x23, 0x39, 0xFF, 0xE6, 0x61, 0xFF, 0x0A, 0x83, 0xFF, 0xAC, 0x93, 0xFF, 0x84, 0x41, 0xFF, 0x8C, 0x8B, 0xFF, 0x63, 0x41, 0xFF, 0xAC, 0x8B, 0xFF, 0x44, 0x39, 0xFF, 0x07, 0x4A, 0xFF, 0xE6, 0x41, 0xFF, 0xA8, 0x62, 0xFF, 0xE6, 0x41, 0xFF, 0x88, 0x5A, 0xFF, 0xC5, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0xA8, 0x62, 0xFF, 0x64, 0x39, 0xFF, 0x07, 0x4A, 0xFF, 0x07, 0x4A, 0xFF, 0x64, 0x39, 0xFF, 0xC2, 0x18, 0xFF, 0x03, 0x21, 0xFF, 0xE2, 0x20, 0xFF, 0x24, 0x29, 0xFF, 0x6F, 0x94, 0xFF, 0x6D, 0xA4, 0xFF, 0x44, 0x31, 0xFF, 0xE5, 0x51, 0xFF, 0x6D, 0xBC, 0xFF, 0x13, 0xEE, 0xFF, 0xAA, 0x9B, 0xFF, 0xCF, 0xBC, 0xFF, 0x85, 0x39, 0xFF, 0xEA, 0x72, 0xFF, 0xC5, 0x41, 0xFF, 0xCC, 0x8B, 0xFF, 0x44, 0x31, 0xFF, 0x46, 0x52, 0xFF, 0x30, 0xC5, 0xFF, 0x4A, 0x8B, 0xFF, 0xAB, 0x93, 0xFF, 0xA5, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0x03, 0x21, 0xFF, 0x44, 0x29, 0xFF, 0x2A, 0x73, 0xFF, 0xE3, 0x20, 0xFF, 0x44, 0x31, 0xFF, 0xE2, 0x28, 0xFF, 0x03, 0x29, 0xFF, 0xCC, 0x8B, 0xFF,
-    0xE9, 0x6A, 0xFF, 0x64, 0x31, 0xFF, 0x43, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0x6A, 0x83, 0xFF, 0x88, 0x6A, 0xFF, 0x47, 0x5A, 0xFF, 0x84, 0x41, 0xFF, 0x64, 0x39, 0xFF, 0x29, 0x7B, 0xFF, 0xA4, 0x41, 0xFF, 0x2A, 0x7B, 0xFF, 0x92, 0xFD, 0xFF, 0x43, 0x41, 0xFF, 0x06, 0x52, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0x64, 0x39, 0xFF, 0xC8, 0x6A, 0xFF, 0xA7, 0x62, 0xFF, 0x4B, 0x7B, 0xFF, 0x47, 0x62, 0xFF, 0x2D, 0xA4, 0xFF, 0x68, 0x5A, 0xFF, 0x85, 0x41, 0xFF, 0x7A, 0xFF, 0xFF, 0x89, 0x7A, 0xFF, 0xA4, 0x51, 0xFF, 0x04, 0x39, 0xFF, 0xE6, 0x49, 0xFF, 0xE9, 0x7A, 0xFF, 0x26, 0x62, 0xFF, 0x44, 0x31, 0xFF, 0xD0, 0xB4, 0xFF, 0x64, 0x41, 0xFF, 0xED, 0x9B, 0xFF, 0xE6, 0x51, 0xFF, 0x27, 0x52, 0xFF, 0xE5, 0x69, 0xFF, 0xC5, 0x41, 0xFF, 0xC5, 0x49, 0xFF, 0x06, 0x4A, 0xFF, 0xC5, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x06, 0x4A, 0xFF, 0x23, 0x31, 0xFF, 0xA5, 0x41, 0xFF, 0xA5, 0x41, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0xC5, 0x39, 0xFF, 0xE2, 0x20, 0xFF, 0x4E, 0x9C, 0xFF, 0x64, 0x39, 0xFF, 0x23, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0xE6, 0x51, 0xFF, 0xFD, 0xFF, 0xFF, 0xCB, 0x9B, 0xFF, 0x49, 0x8B, 0xFF, 0xAB, 0x93, 0xFF, 0x64, 0x39, 0xFF, 0x26, 0x5A, 0xFF, 0x84, 0x39, 0xFF,
-    0x23, 0x31, 0xFF, 0x24, 0x31, 0xFF, 0xAB, 0x83, 0xFF, 0x6E, 0xAC, 0xFF, 0x4A, 0x7B, 0xFF, 0x84, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0x2A, 0x73, 0xFF, 0x02, 0x29, 0xFF, 0x23, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0xE3, 0x28, 0xFF, 0x03, 0x29, 0xFF, 0x03, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0xE9, 0x72, 0xFF, 0x44, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0xE5, 0x49, 0xFF, 0x84, 0x41, 0xFF, 0x67, 0x6A, 0xFF, 0xC5, 0x49, 0xFF, 0x44, 0x31, 0xFF, 0x6B, 0x93, 0xFF, 0x65, 0x39, 0xFF, 0xEA, 0x72, 0xFF, 0x10, 0xED, 0xFF, 0x03, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0x0E, 0x94, 0xFF, 0x85, 0x39, 0xFF, 0x2D, 0x9C, 0xFF, 0xED, 0x9B, 0xFF, 0x0E, 0x94, 0xFF, 0xA5, 0x41, 0xFF, 0x85, 0x49, 0xFF, 0x3A, 0xFF, 0xFF, 0x81, 0x28, 0xFF, 0xA9, 0x6A, 0xFF, 0x04, 0x31, 0xFF, 0x65, 0x39, 0xFF, 0xC2, 0x28, 0xFF, 0x0A, 0x7B, 0xFF, 0x43, 0x39, 0xFF, 0x2D, 0x9C, 0xFF, 0x24, 0x31, 0xFF, 0x0D, 0x9C, 0xFF, 0x48, 0x5A, 0xFF, 0x68, 0x5A, 0xFF, 0xE3, 0x28, 0xFF, 0xA6, 0x41, 0xFF, 0xA6, 0x41, 0xFF, 0x06, 0x4A, 0xFF, 0x85, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0x03, 0x29, 0xFF, 0x06, 0x4A, 0xFF, 0xC6, 0x41, 0xFF,
-    0xC2, 0x18, 0xFF, 0xE2, 0x20, 0xFF, 0xC2, 0x18, 0xFF, 0x05, 0x5A, 0xFF, 0xE3, 0x20, 0xFF, 0x84, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x09, 0x73, 0xFF, 0x26, 0x5A, 0xFF, 0x47, 0x5A, 0xFF, 0x26, 0x52, 0xFF, 0xC8, 0x6A, 0xFF, 0x88, 0x6A, 0xFF, 0x84, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0x84, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x26, 0x5A, 0xFF, 0xA5, 0x41, 0xFF, 0x43, 0x29, 0xFF, 0xE8, 0x6A, 0xFF, 0xE2, 0x28, 0xFF, 0x03, 0x21, 0xFF, 0x03, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x87, 0x6A, 0xFF, 0x43, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0x47, 0x5A, 0xFF, 0x24, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0x2C, 0xA4, 0xFF, 0xEB, 0xC3, 0xFF, 0x2D, 0xBC, 0xFF, 0xC8, 0x6A, 0xFF, 0x23, 0x29, 0xFF, 0x4B, 0x8B, 0xFF, 0x6F, 0xA4, 0xFF, 0x6A, 0x9B, 0xFF, 0xCD, 0xBB, 0xFF, 0x03, 0x39, 0xFF, 0x32, 0xBD, 0xFF, 0xE3, 0x28, 0xFF, 0x64, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x65, 0x31, 0xFF, 0x27, 0x62, 0xFF, 0xC6, 0x49, 0xFF, 0xC6, 0x49, 0xFF, 0xA5, 0x41, 0xFF, 0x0A, 0x73, 0xFF, 0x47, 0x62, 0xFF, 0x19, 0xF7, 0xFF, 0xE6, 0x49, 0xFF, 0x8F, 0xB4, 0xFF, 0xE3, 0x30, 0xFF, 0x03, 0x41, 0xFF, 0x31, 0xCD, 0xFF, 0xC9, 0x72, 0xFF,
-    0xE9, 0x6A, 0xFF, 0xC9, 0x72, 0xFF, 0x6C, 0x83, 0xFF, 0x2E, 0xA4, 0xFF, 0xA5, 0x41, 0xFF, 0xAC, 0x8B, 0xFF, 0x64, 0x39, 0xFF, 0x24, 0x29, 0xFF, 0x07, 0x4A, 0xFF, 0xA5, 0x39, 0xFF, 0xE9, 0x6A, 0xFF, 0xEA, 0x6A, 0xFF, 0x07, 0x4A, 0xFF, 0x44, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0xC6, 0x41, 0xFF, 0xE3, 0x20, 0xFF, 0xE3, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x40, 0x10, 0xFF, 0xA2, 0x18, 0xFF, 0x24, 0x29, 0xFF, 0x03, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x64, 0x31, 0xFF, 0xC5, 0x49, 0xFF, 0xC6, 0x41, 0xFF, 0x84, 0x39, 0xFF, 0x05, 0x5A, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x64, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0xE9, 0x72, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x5A, 0xFF, 0x06, 0x52, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0xE2, 0x20, 0xFF, 0x03, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x02, 0x29, 0xFF, 0x23, 0x31, 0xFF, 0x23, 0x29, 0xFF, 0x03, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x29, 0xFF, 0x23, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0x4A, 0x8B, 0xFF, 0x6E, 0xDC, 0xFF, 0x06, 0x62, 0xFF, 0xF6, 0xFE, 0xFF, 0x24, 0x31, 0xFF, 0x2A, 0x83, 0xFF, 0xED, 0x9B, 0xFF, 0x0E, 0xAC, 0xFF, 0x89, 0x92, 0xFF, 0xE2, 0x30, 0xFF, 0x44, 0x39, 0xFF, 0x44, 0x31, 0xFF,
-    0x85, 0x41, 0xFF, 0x65, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0xC5, 0x49, 0xFF, 0xA5, 0x39, 0xFF, 0x4B, 0x8B, 0xFF, 0x44, 0x39, 0xFF, 0x8C, 0x8B, 0xFF, 0x2A, 0xA3, 0xFF, 0x90, 0xBC, 0xFF, 0xB0, 0x94, 0xFF, 0xC9, 0x7A, 0xFF, 0xE2, 0x30, 0xFF, 0x03, 0x29, 0xFF, 0xEC, 0x93, 0xFF, 0x85, 0x39, 0xFF, 0x27, 0x5A, 0xFF, 0x88, 0x6A, 0xFF, 0x28, 0x5A, 0xFF, 0x8B, 0x8B, 0xFF, 0x24, 0x29, 0xFF, 0x07, 0x52, 0xFF, 0xE6, 0x49, 0xFF, 0xE3, 0x20, 0xFF, 0x24, 0x29, 0xFF, 0x47, 0x52, 0xFF, 0x47, 0x52, 0xFF, 0x65, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0x24, 0x29, 0xFF, 0xA5, 0x39, 0xFF, 0xA5, 0x39, 0xFF, 0x87, 0x52, 0xFF, 0xA8, 0x6A, 0xFF, 0xC2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x02, 0x31, 0xFF, 0x87, 0x5A, 0xFF, 0x23, 0x29, 0xFF, 0x84, 0x39, 0xFF, 0xC5, 0x41, 0xFF, 0xA9, 0x62, 0xFF, 0x09, 0x7B, 0xFF, 0x26, 0x4A, 0xFF, 0x84, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0xC8, 0x72, 0xFF, 0x23, 0x29, 0xFF, 0xC5, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0x47, 0x52, 0xFF, 0x03, 0x29, 0xFF, 0xA5, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xAC, 0x8B, 0xFF, 0x64, 0x39, 0xFF, 0x64, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0x67, 0x5A, 0xFF,
-    0x23, 0x29, 0xFF, 0x44, 0x31, 0xFF, 0x43, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x2A, 0x7B, 0xFF, 0x43, 0x39, 0xFF, 0x09, 0x7B, 0xFF, 0x26, 0x5A, 0xFF, 0x03, 0x31, 0xFF, 0x87, 0x6A, 0xFF, 0x2E, 0xAC, 0xFF, 0x6F, 0xC4, 0xFF, 0x88, 0x8A, 0xFF, 0x03, 0x39, 0xFF, 0x6B, 0x83, 0xFF, 0x44, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0x27, 0x4A, 0xFF, 0xED, 0x9B, 0xFF, 0x28, 0x5A, 0xFF, 0xA7, 0x72, 0xFF, 0xC2, 0x38, 0xFF, 0x23, 0x41, 0xFF, 0x0A, 0x7B, 0xFF, 0xCD, 0xA3, 0xFF, 0xD5, 0xDD, 0xFF, 0x2F, 0xAC, 0xFF, 0xC3, 0x30, 0xFF, 0x28, 0x5A, 0xFF, 0xCF, 0xBC, 0xFF, 0x65, 0x39, 0xFF, 0x07, 0x52, 0xFF, 0xA5, 0x41, 0xFF, 0xC9, 0x6A, 0xFF, 0xC9, 0x72, 0xFF, 0x03, 0x29, 0xFF, 0xA6, 0x41, 0xFF, 0xC5, 0x41, 0xFF, 0xA8, 0x62, 0xFF, 0x44, 0x31, 0xFF, 0x24, 0x29, 0xFF, 0x65, 0x39, 0xFF, 0x23, 0x31, 0xFF, 0xC9, 0x6A, 0xFF, 0x44, 0x31, 0xFF, 0x44, 0x31, 0xFF, 0x85, 0x39, 0xFF, 0xA1, 0x18, 0xFF, 0x81, 0x10, 0xFF, 0xC2, 0x20, 0xFF, 0xC2, 0x18, 0xFF, 0x03, 0x21, 0xFF, 0x03, 0x29, 0xFF, 0x23, 0x31, 0xFF, 0x03, 0x29, 0xFF, 0x64, 0x39, 0xFF, 0xA5, 0x41, 0xFF, 0x49, 0x7B, 0xFF, 0xCC, 0x93, 0xFF, 0xEC, 0x83, 0xFF, 0xA5, 0x39, 0xFF, 0x64, 0x31, 0xFF, 0x23, 0x29, 0xFF,
-    0x88, 0x62, 0xFF, 0x43, 0x31, 0xFF, 0x84, 0x39, 0xFF, 0xA4, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x88, 0x5A, 0xFF, 0xE2, 0x20, 0xFF, 0xE2, 0x20, 0xFF, 0x24, 0x31, 0xFF, 0x26, 0x52, 0xFF, 0xA7, 0x6A, 0xFF, 0xE5, 0x49, 0xFF, 0x23, 0x29, 0xFF, 0x03, 0x29, 0xFF, 0x03, 0x29, 0xFF, 0xA8, 0x62, 0xFF, 0x23, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x43, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0xC8, 0x72, 0xFF, 0xAA, 0xAB, 0xFF, 0x88, 0x6A, 0xFF, 0x22, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0x06, 0x52, 0xFF, 0x06, 0x5A, 0xFF, 0x4F, 0xBC, 0xFF, 0x8C, 0x9B, 0xFF, 0x85, 0x51, 0xFF, 0xA4, 0x41, 0xFF, 0x64, 0x39, 0xFF, 0x84, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0x44, 0x31, 0xFF, 0xEA, 0x6A, 0xFF, 0xA9, 0x62, 0xFF, 0x65, 0x39, 0xFF, 0x03, 0x39, 0xFF, 0xEA, 0x72, 0xFF, 0x81, 0x30, 0xFF, 0xC5, 0x41, 0xFF, 0x70, 0xB4, 0xFF, 0x68, 0x5A, 0xFF, 0x48, 0x5A, 0xFF, 0xE3, 0x30, 0xFF, 0x8E, 0xC4, 0xFF, 0x07, 0x52, 0xFF, 0xC6, 0x49, 0xFF, 0x28, 0x5A, 0xFF, 0xA6, 0x41, 0xFF, 0x48, 0x5A, 0xFF, 0x03, 0x29, 0xFF, 0xC6, 0x41, 0xFF, 0x85, 0x39, 0xFF, 0x23, 0x29, 0xFF, 0x45, 0x31, 0xFF, 0x24, 0x29, 0xFF, 0x03, 0x29, 0xFF, 0x03, 0x21, 0xFF, 0x03, 0x21, 0xFF, 0x03, 0x29, 0xFF, 0x65, 0x31, 0xFF, 0xC6, 0x41, 0xFF,
+    0x03, 0x21, 0x64, 0x31, 0xE3, 0x20, 0x03, 0x21, 0x09, 0x6B, 0x03, 0x21, 0x23, 0x29, 0x64, 0x29, 0x85, 0x31, 0x68, 0x5A, 0x24, 0x29, 0x44, 0x29, 0x85, 0x31, 0x64, 0x31, 0x84, 0x39, 0xA8, 0x62, 0xE6, 0x41, 0x64, 0x31, 0x06, 0x42, 0xC5, 0x39, 0x8B, 0x83, 0xE5, 0x41, 0x06, 0x42, 0x26, 0x4A, 0x06, 0x42, 0xC4, 0x39, 0xEC, 0x8B, 0xA7, 0x5A, 0xA8, 0x5A, 0xA7, 0x52, 0xC8, 0x5A, 0x69, 0x83,
+    0x47, 0x4A, 0x47, 0x4A, 0xA8, 0x5A, 0x06, 0x4A, 0xCB, 0x8B, 0x06, 0x42, 0x0D, 0x8C, 0x27, 0x4A, 0x27, 0x4A, 0xC9, 0x62, 0x88, 0x5A, 0x2A, 0x6B, 0xD0, 0xA4, 0xC9, 0x62, 0x67, 0x52, 0x6A, 0x7B, 0xA8, 0x5A, 0x47, 0x52, 0x68, 0x52, 0x6B, 0x73, 0x6A, 0x7B, 0x70, 0x9C, 0xA9, 0x5A, 0x47, 0x52, 0x47, 0x52, 0x06, 0x4A, 0x27, 0x4A, 0xC5, 0x39, 0x67, 0x52, 0xE6, 0x41, 0xA5, 0x39, 0x87, 0x5A,
+    0xE6, 0x41, 0x06, 0x42, 0xE6, 0x41, 0x06, 0x42, 0xE5, 0x41, 0x46, 0x4A, 0x26, 0x4A, 0x26, 0x4A, 0x88, 0x5A, 0xF5, 0xC5, 0xEC, 0x9B, 0x67, 0x52, 0x67, 0x52, 0x46, 0x4A, 0x05, 0x42, 0xE5, 0x41, 0x64, 0x29, 0x03, 0x21, 0xC6, 0x39, 0x23, 0x29, 0x24, 0x29, 0x03, 0x21, 0x23, 0x21, 0x03, 0x21, 0x64, 0x29, 0x44, 0x29, 0x43, 0x29, 0x64, 0x31, 0x64, 0x31, 0x44, 0x29, 0x84, 0x31, 0xA8, 0x5A,
+    0x64, 0x31, 0x84, 0x31, 0x84, 0x31, 0xE8, 0x62, 0xE6, 0x41, 0xA5, 0x39, 0xE6, 0x41, 0xE6, 0x41, 0x06, 0x4A, 0x26, 0x4A, 0xA7, 0x62, 0xE6, 0x41, 0x28, 0x63, 0xA7, 0x5A, 0xEC, 0x83, 0x05, 0x4A, 0x88, 0x5A, 0x87, 0x52, 0x47, 0x4A, 0x84, 0x31, 0x47, 0x52, 0xA8, 0x62, 0x47, 0x52, 0x27, 0x4A, 0x27, 0x4A, 0x4A, 0x7B, 0x88, 0x5A, 0x6B, 0x73, 0x14, 0xDE, 0x0A, 0x6B, 0x47, 0x52, 0x09, 0x6B,
+    0xA5, 0x41, 0x68, 0x52, 0x87, 0x5A, 0x92, 0xCD, 0xEF, 0xC4, 0x4A, 0x73, 0x0B, 0x8C, 0xE9, 0x72, 0x84, 0x31, 0x8A, 0x7B, 0xA8, 0x5A, 0xE6, 0x41, 0xC5, 0x39, 0x06, 0x42, 0xE6, 0x41, 0x4A, 0x73, 0xA5, 0x39, 0xC5, 0x41, 0xE6, 0x41, 0xE6, 0x41, 0x6A, 0x7B, 0x06, 0x42, 0x26, 0x4A, 0x26, 0x4A, 0x26, 0x4A, 0x29, 0x6B, 0x67, 0x5A, 0x46, 0x4A, 0x67, 0x52, 0x05, 0x4A, 0x46, 0x52, 0x28, 0x6B,
+    0x64, 0x31, 0xA5, 0x39, 0x23, 0x21, 0xA5, 0x39, 0x03, 0x21, 0x03, 0x21, 0xE9, 0x62, 0x44, 0x29, 0x85, 0x31, 0x44, 0x29, 0x44, 0x29, 0x09, 0x6B, 0x44, 0x29, 0xA5, 0x39, 0x43, 0x29, 0x64, 0x29, 0x29, 0x73, 0xD7, 0xFF, 0xA5, 0x39, 0xE6, 0x41, 0xA5, 0x39, 0x0C, 0x94, 0xE6, 0x41, 0xE6, 0x41, 0x06, 0x42, 0x26, 0x4A, 0x2C, 0x9C, 0xE6, 0x41, 0x67, 0x52, 0x67, 0x52, 0x67, 0x52, 0x2A, 0x6B,
+    0x47, 0x52, 0x27, 0x4A, 0x26, 0x4A, 0x06, 0x42, 0x06, 0x4A, 0x67, 0x52, 0x88, 0x5A, 0x27, 0x4A, 0x27, 0x52, 0x87, 0x5A, 0x47, 0x4A, 0xA8, 0x5A, 0xCC, 0x83, 0x67, 0x52, 0x88, 0x52, 0x0A, 0x6B, 0x88, 0x52, 0x0A, 0x6B, 0x6E, 0xA4, 0x10, 0xB5, 0x11, 0xBD, 0x6F, 0xA4, 0xC9, 0x62, 0x27, 0x4A, 0x68, 0x52, 0xCC, 0x83, 0x27, 0x4A, 0x47, 0x4A, 0xE6, 0x41, 0x06, 0x4A, 0x06, 0x4A, 0xC5, 0x39,
+    0xA5, 0x39, 0xE6, 0x41, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x4A, 0x26, 0x4A, 0x47, 0x52, 0x06, 0x42, 0x67, 0x52, 0x67, 0x52, 0x87, 0x52, 0x88, 0x5A, 0xA4, 0x39, 0xE9, 0x62, 0xE5, 0x41, 0x03, 0x21, 0x84, 0x31, 0x03, 0x21, 0x23, 0x29, 0x43, 0x29, 0x23, 0x29, 0x85, 0x31, 0x23, 0x21, 0x23, 0x29, 0x23, 0x29, 0x23, 0x29, 0x43, 0x31, 0x44, 0x29, 0x64, 0x31, 0x64, 0x31, 0xC6, 0x39,
+    0xA8, 0x5A, 0x85, 0x31, 0x84, 0x39, 0xE6, 0x41, 0xAA, 0x8B, 0x84, 0x39, 0x06, 0x42, 0x06, 0x4A, 0xE6, 0x41, 0x26, 0x52, 0xA7, 0x62, 0x06, 0x42, 0xA8, 0x5A, 0xC8, 0x5A, 0xC8, 0x5A, 0x0A, 0x73, 0x47, 0x52, 0x68, 0x52, 0x26, 0x4A, 0xE6, 0x41, 0x67, 0x5A, 0xA8, 0x62, 0x88, 0x62, 0x47, 0x4A, 0xA9, 0x62, 0xAC, 0x83, 0x8C, 0x7B, 0xA8, 0x62, 0x0D, 0x94, 0xA8, 0x62, 0x09, 0x6B, 0xC9, 0x62,
+    0x68, 0x52, 0xC9, 0x62, 0xEA, 0x62, 0xAB, 0x83, 0xD0, 0xA4, 0xAC, 0x83, 0xA9, 0x5A, 0xE6, 0x41, 0xC9, 0x62, 0x67, 0x52, 0x6A, 0x83, 0xE6, 0x41, 0x27, 0x4A, 0x88, 0x5A, 0x87, 0x5A, 0xA5, 0x39, 0xA5, 0x39, 0x27, 0x4A, 0xC5, 0x39, 0x29, 0x73, 0xE6, 0x41, 0x06, 0x42, 0x06, 0x4A, 0xA8, 0x52, 0x0A, 0x73, 0x47, 0x52, 0x67, 0x52, 0xE5, 0x41, 0xE5, 0x41, 0xC5, 0x41, 0x05, 0x42, 0xE5, 0x41,
+    0x23, 0x29, 0x43, 0x29, 0x23, 0x29, 0xA8, 0x5A, 0x23, 0x21, 0x23, 0x29, 0x03, 0x21, 0xE5, 0x41, 0x64, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0xCC, 0x83, 0x44, 0x31, 0x64, 0x31, 0xA5, 0x39, 0x64, 0x31, 0xEC, 0x8B, 0xE6, 0x41, 0xC5, 0x41, 0x68, 0x5A, 0x84, 0x39, 0x87, 0x62, 0x06, 0x4A, 0xE6, 0x41, 0xE6, 0x41, 0xE6, 0x41, 0x47, 0x52, 0x27, 0x4A, 0x27, 0x4A, 0x27, 0x4A, 0x06, 0x4A,
+    0x47, 0x52, 0x27, 0x4A, 0x47, 0x52, 0xE6, 0x41, 0x26, 0x4A, 0xA8, 0x5A, 0x66, 0x52, 0x47, 0x4A, 0xE9, 0x8A, 0xCC, 0x83, 0x88, 0x52, 0xE9, 0x62, 0xEC, 0x83, 0x09, 0x6B, 0x68, 0x52, 0x6B, 0x73, 0x47, 0x52, 0xE9, 0x62, 0xC8, 0x5A, 0x4A, 0x73, 0xCC, 0x7B, 0x88, 0x5A, 0x88, 0x52, 0xE9, 0x62, 0x26, 0x4A, 0x06, 0x42, 0x47, 0x52, 0x47, 0x4A, 0x27, 0x4A, 0x06, 0x42, 0xC5, 0x41, 0xC5, 0x41,
+    0x64, 0x31, 0xE6, 0x41, 0x06, 0x42, 0x26, 0x4A, 0xE5, 0x41, 0x26, 0x4A, 0x26, 0x4A, 0x26, 0x4A, 0x47, 0x52, 0x87, 0x52, 0x06, 0x42, 0xE5, 0x41, 0x0A, 0x6B, 0xA4, 0x39, 0xC5, 0x41, 0xE5, 0x41, 0x23, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x23, 0x29, 0x23, 0x21, 0x03, 0x21, 0x23, 0x29, 0xC5, 0x41, 0x88, 0x5A, 0x44, 0x29, 0x64, 0x29, 0xA5, 0x39, 0x84, 0x31, 0x84, 0x31, 0xE6, 0x41,
+    0x84, 0x39, 0x64, 0x31, 0x27, 0x4A, 0x27, 0x4A, 0xC5, 0x41, 0xE5, 0x41, 0x30, 0xBD, 0xE5, 0x41, 0x47, 0x52, 0x06, 0x4A, 0x26, 0x4A, 0xCC, 0x8B, 0x06, 0x4A, 0xC5, 0x41, 0x06, 0x4A, 0x46, 0x5A, 0x0D, 0x8C, 0x47, 0x52, 0x47, 0x4A, 0xC5, 0x41, 0x6B, 0x7B, 0x88, 0x5A, 0x67, 0x52, 0x47, 0x4A, 0x47, 0x52, 0xCC, 0x8B, 0xA8, 0x5A, 0x4B, 0x73, 0x10, 0xBD, 0x09, 0x6B, 0xCC, 0x8B, 0xA8, 0x5A,
+    0x47, 0x52, 0x88, 0x5A, 0xC8, 0x62, 0xEC, 0x8B, 0x88, 0x5A, 0xA8, 0x5A, 0xA8, 0x5A, 0x46, 0x4A, 0x0A, 0x6B, 0x0F, 0xBD, 0x27, 0x4A, 0xE6, 0x41, 0x88, 0x5A, 0xA4, 0x39, 0xE6, 0x41, 0xC5, 0x39, 0xC5, 0x41, 0x4B, 0x7B, 0xE6, 0x41, 0x06, 0x42, 0x27, 0x4A, 0xEF, 0x9C, 0xE9, 0x6A, 0x06, 0x4A, 0x47, 0x52, 0x46, 0x4A, 0x26, 0x4A, 0x05, 0x4A, 0xE5, 0x41, 0xA4, 0x39, 0xE6, 0x41, 0x06, 0x4A,
+    0xE2, 0x20, 0x23, 0x29, 0x44, 0x29, 0x44, 0x29, 0xA8, 0x62, 0x88, 0x5A, 0x44, 0x29, 0x43, 0x29, 0x44, 0x29, 0x26, 0x4A, 0x06, 0x42, 0x64, 0x31, 0xA5, 0x39, 0x84, 0x31, 0x4A, 0x73, 0x49, 0x7B, 0x84, 0x39, 0x85, 0x39, 0x84, 0x39, 0xC5, 0x41, 0x6A, 0x7B, 0xC5, 0x49, 0xA6, 0x41, 0xC5, 0x41, 0xC5, 0x41, 0x26, 0x4A, 0x6B, 0x83, 0x0E, 0x94, 0x47, 0x52, 0x27, 0x4A, 0x09, 0x73, 0x4A, 0x83,
+    0x67, 0x5A, 0x27, 0x4A, 0x06, 0x4A, 0xC5, 0x41, 0xAE, 0xA4, 0x09, 0x63, 0x88, 0x5A, 0x27, 0x4A, 0x67, 0x52, 0x8B, 0x83, 0x0A, 0x6B, 0x4E, 0xA4, 0xFF, 0xFF, 0xED, 0x8B, 0xEA, 0x6A, 0x4A, 0x73, 0x05, 0x4A, 0xC9, 0x5A, 0x88, 0x5A, 0x68, 0x52, 0x6B, 0x7B, 0x88, 0x5A, 0x88, 0x52, 0x26, 0x4A, 0x47, 0x52, 0x2A, 0x6B, 0x47, 0x4A, 0x47, 0x4A, 0x47, 0x4A, 0xE6, 0x41, 0xC6, 0x41, 0x09, 0x6B,
+    0xA5, 0x39, 0xC6, 0x41, 0xE6, 0x41, 0xE6, 0x41, 0xE8, 0x62, 0x47, 0x4A, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0xA8, 0x5A, 0x29, 0x6B, 0x84, 0x39, 0x26, 0x4A, 0xE5, 0x41, 0x05, 0x42, 0x69, 0x7B, 0xE2, 0x18, 0xE2, 0x20, 0x44, 0x29, 0x23, 0x29, 0x23, 0x29, 0x44, 0x29, 0xA5, 0x39, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0xC9, 0x62, 0x43, 0x31, 0xA5, 0x39, 0xA5, 0x39, 0xC5, 0x39,
+    0x64, 0x31, 0x84, 0x39, 0xA5, 0x39, 0x85, 0x39, 0x46, 0x5A, 0xE5, 0x41, 0x05, 0x4A, 0x71, 0xC5, 0x27, 0x4A, 0x06, 0x52, 0x06, 0x4A, 0x46, 0x5A, 0x47, 0x5A, 0x27, 0x52, 0x68, 0x52, 0xC5, 0x49, 0x67, 0x62, 0x47, 0x5A, 0x26, 0x4A, 0xE6, 0x41, 0xE5, 0x49, 0xC9, 0x62, 0xA9, 0x5A, 0x27, 0x4A, 0x67, 0x52, 0x0C, 0x94, 0xA8, 0x62, 0x4D, 0xA4, 0x9C, 0xFF, 0xCB, 0x8B, 0xAB, 0x83, 0x88, 0x5A,
+    0xC8, 0x5A, 0x47, 0x52, 0xEC, 0x8B, 0x0D, 0x8C, 0x4A, 0x73, 0x47, 0x52, 0xC8, 0x5A, 0xC9, 0x6A, 0x2E, 0x8C, 0x06, 0x4A, 0x67, 0x52, 0x2A, 0x73, 0x07, 0x4A, 0x06, 0x42, 0xC5, 0x41, 0xC6, 0x41, 0x2A, 0x73, 0x06, 0x42, 0xE6, 0x41, 0x27, 0x4A, 0xE9, 0x6A, 0xA5, 0x39, 0x88, 0x5A, 0x26, 0x4A, 0x06, 0x4A, 0x29, 0x73, 0x67, 0x52, 0xE5, 0x41, 0x26, 0x4A, 0x06, 0x42, 0x87, 0x5A, 0xA8, 0x5A,
+    0xC2, 0x18, 0x44, 0x31, 0x44, 0x29, 0x24, 0x29, 0x03, 0x21, 0x24, 0x29, 0x67, 0x52, 0x64, 0x31, 0x43, 0x29, 0x44, 0x29, 0x31, 0xAD, 0x2A, 0x73, 0x64, 0x31, 0xA5, 0x39, 0xC5, 0x41, 0x43, 0x31, 0x6A, 0x73, 0xA5, 0x39, 0xA5, 0x39, 0xEB, 0x83, 0xE6, 0x41, 0x87, 0x62, 0x4E, 0x94, 0xE6, 0x41, 0x6A, 0x7B, 0x26, 0x52, 0x0A, 0x7B, 0x88, 0x5A, 0x32, 0xD6, 0x67, 0x5A, 0x67, 0x62, 0x2D, 0x9C,
+    0xEC, 0x93, 0x26, 0x4A, 0x26, 0x4A, 0x06, 0x4A, 0x8B, 0x83, 0x2A, 0x73, 0x27, 0x4A, 0x68, 0x52, 0xA8, 0x5A, 0xEC, 0x8B, 0x4A, 0x7B, 0x0C, 0x8C, 0xD0, 0xAC, 0x88, 0x5A, 0xCC, 0x8B, 0xA8, 0x62, 0x88, 0x5A, 0x67, 0x52, 0x4B, 0x7B, 0xED, 0x8B, 0x47, 0x52, 0x87, 0x5A, 0xCB, 0x8B, 0xE6, 0x41, 0xAF, 0xAC, 0x26, 0x4A, 0xE6, 0x41, 0xC6, 0x41, 0xE6, 0x41, 0xE6, 0x41, 0x67, 0x5A, 0xE6, 0x41,
+    0x06, 0x42, 0xC5, 0x39, 0x06, 0x4A, 0x6A, 0x7B, 0x06, 0x42, 0x06, 0x42, 0x06, 0x4A, 0x06, 0x4A, 0x6A, 0x7B, 0x67, 0x4A, 0xE5, 0x39, 0xE5, 0x41, 0xC9, 0x62, 0x4A, 0x73, 0x67, 0x52, 0x47, 0x52, 0xC2, 0x18, 0x43, 0x29, 0x44, 0x29, 0xA8, 0x5A, 0x23, 0x29, 0x43, 0x29, 0xC6, 0x39, 0x43, 0x29, 0x2A, 0x6B, 0x64, 0x31, 0x84, 0x31, 0xA5, 0x39, 0xA5, 0x41, 0x27, 0x4A, 0xA5, 0x39, 0x84, 0x39,
+    0x64, 0x31, 0x66, 0x5A, 0xA5, 0x39, 0xA5, 0x39, 0xC5, 0x41, 0x06, 0x4A, 0xAB, 0x8B, 0xC5, 0x41, 0x47, 0x52, 0x06, 0x52, 0x27, 0x52, 0x67, 0x5A, 0x0A, 0x7B, 0xC8, 0x6A, 0x47, 0x52, 0x67, 0x5A, 0x07, 0x4A, 0x47, 0x52, 0x27, 0x4A, 0x27, 0x4A, 0x47, 0x52, 0x27, 0x4A, 0x47, 0x52, 0x47, 0x52, 0x88, 0x5A, 0x67, 0x52, 0xC9, 0x62, 0x8C, 0x7B, 0x0D, 0x8C, 0xA8, 0x5A, 0xE9, 0x62, 0x88, 0x5A,
+    0x68, 0x52, 0x47, 0x52, 0x47, 0x52, 0x68, 0x52, 0x47, 0x52, 0xC9, 0x62, 0xC9, 0x62, 0x27, 0x4A, 0x67, 0x52, 0x27, 0x4A, 0x06, 0x4A, 0xA9, 0x5A, 0x06, 0x4A, 0x06, 0x4A, 0xA5, 0x39, 0x0A, 0x6B, 0xA5, 0x39, 0xC5, 0x39, 0x2B, 0x73, 0xE5, 0x49, 0xA4, 0x39, 0xE6, 0x41, 0xA5, 0x39, 0x08, 0x73, 0xE6, 0x41, 0xE6, 0x41, 0x06, 0x42, 0x47, 0x4A, 0x47, 0x52, 0x67, 0x52, 0x47, 0x52, 0x26, 0x52,
+    0x43, 0x29, 0x23, 0x29, 0x85, 0x31, 0x03, 0x29, 0x43, 0x29, 0x84, 0x31, 0x23, 0x29, 0x85, 0x31, 0xA4, 0x39, 0x84, 0x31, 0xA5, 0x39, 0xA5, 0x39, 0x27, 0x4A, 0xE8, 0x62, 0xE6, 0x41, 0x64, 0x31, 0xA9, 0x5A, 0xA5, 0x39, 0x84, 0x39, 0xC5, 0x41, 0xC9, 0x62, 0xE5, 0x49, 0x4E, 0xA4, 0xE5, 0x49, 0x67, 0x5A, 0x47, 0x5A, 0xE9, 0x72, 0x2A, 0x83, 0xFF, 0xFF, 0x46, 0x5A, 0x09, 0x6B, 0x88, 0x62,
+    0x06, 0x52, 0x0A, 0x6B, 0x26, 0x4A, 0x06, 0x4A, 0xEC, 0x8B, 0x2C, 0x94, 0x47, 0x4A, 0x27, 0x4A, 0xA8, 0x62, 0x6E, 0x9C, 0xA8, 0x62, 0x4A, 0x73, 0x46, 0x52, 0xA8, 0x62, 0xCB, 0x83, 0xC9, 0x62, 0x47, 0x52, 0x4B, 0x7B, 0x0A, 0x6B, 0x0C, 0x94, 0xE5, 0x49, 0xEC, 0x8B, 0xA8, 0x5A, 0x06, 0x4A, 0x67, 0x52, 0x27, 0x4A, 0x67, 0x5A, 0x07, 0x4A, 0x47, 0x52, 0x06, 0x4A, 0x2D, 0x94, 0xC6, 0x39,
+    0xE6, 0x41, 0xE8, 0x6A, 0x26, 0x52, 0xC5, 0x39, 0x67, 0x52, 0xA5, 0x39, 0x05, 0x4A, 0x06, 0x4A, 0xE5, 0x41, 0xE6, 0x41, 0xC8, 0x62, 0x6A, 0x73, 0x67, 0x52, 0x46, 0x52, 0x87, 0x5A, 0x47, 0x52, 0x43, 0x29, 0x64, 0x31, 0xA5, 0x39, 0x23, 0x29, 0x67, 0x5A, 0x47, 0x52, 0x64, 0x31, 0x64, 0x31, 0x84, 0x31, 0x4A, 0x7B, 0xC5, 0x41, 0xA5, 0x39, 0x85, 0x39, 0xE6, 0x41, 0x26, 0x52, 0xAB, 0x83,
+    0xA5, 0x39, 0x2A, 0x6B, 0xA5, 0x39, 0x87, 0x5A, 0xEC, 0xA3, 0xE9, 0x6A, 0xC8, 0x6A, 0x72, 0xD5, 0x06, 0x4A, 0x8A, 0x83, 0xAF, 0xB4, 0xEC, 0x9B, 0xAC, 0x9B, 0xAE, 0xA4, 0xA8, 0x6A, 0xCC, 0x9B, 0x91, 0xDD, 0xC8, 0x62, 0x06, 0x4A, 0xE5, 0x41, 0x0D, 0x94, 0x4E, 0x9C, 0x06, 0x4A, 0x47, 0x52, 0x4E, 0x94, 0x4D, 0x9C, 0x88, 0x5A, 0x67, 0x5A, 0x47, 0x52, 0x29, 0x73, 0x6B, 0x7B, 0x4A, 0x7B,
+    0x47, 0x52, 0x0A, 0x7B, 0x88, 0x5A, 0x68, 0x52, 0xA8, 0x5A, 0xEF, 0xAC, 0xAF, 0xAC, 0x26, 0x52, 0x88, 0x5A, 0x2A, 0x6B, 0x27, 0x4A, 0xC5, 0x39, 0xC6, 0x41, 0x06, 0x4A, 0xC5, 0x41, 0x47, 0x4A, 0x47, 0x52, 0xA5, 0x39, 0xE6, 0x41, 0x06, 0x42, 0x06, 0x4A, 0xA4, 0x39, 0xA4, 0x39, 0x26, 0x4A, 0xE5, 0x41, 0x26, 0x4A, 0x87, 0x5A, 0x67, 0x52, 0x87, 0x5A, 0x46, 0x52, 0xC8, 0x62, 0xC8, 0x62,
+    0x85, 0x31, 0xA5, 0x39, 0x84, 0x31, 0x44, 0x29, 0x85, 0x31, 0xA5, 0x39, 0xC9, 0x62, 0x44, 0x29, 0x44, 0x29, 0x64, 0x31, 0xA7, 0x5A, 0x64, 0x39, 0xE6, 0x41, 0x64, 0x31, 0xE6, 0x41, 0x46, 0x52, 0x85, 0x39, 0xC5, 0x39, 0xAB, 0x7B, 0xC5, 0x41, 0xE6, 0x41, 0x06, 0x4A, 0x88, 0x5A, 0x88, 0x62, 0x27, 0x52, 0xC9, 0x6A, 0xEC, 0x93, 0xC8, 0x7A, 0x2F, 0xCD, 0x6B, 0x93, 0x2A, 0x83, 0xA8, 0x72,
+    0xC8, 0x62, 0x8B, 0x7B, 0x27, 0x52, 0x06, 0x4A, 0x47, 0x5A, 0xD0, 0xA4, 0x47, 0x52, 0x06, 0x4A, 0x4E, 0xA4, 0xAF, 0xAC, 0x88, 0x5A, 0x47, 0x52, 0x27, 0x4A, 0x67, 0x5A, 0x68, 0x52, 0x2D, 0x94, 0x67, 0x52, 0x47, 0x52, 0x67, 0x52, 0xA8, 0x62, 0x0C, 0x94, 0x06, 0x4A, 0x07, 0x4A, 0x06, 0x4A, 0xEA, 0x62, 0x2C, 0x94, 0x87, 0x52, 0x06, 0x52, 0xE6, 0x41, 0x67, 0x52, 0x67, 0x52, 0x67, 0x5A,
+    0x67, 0x52, 0xC5, 0x41, 0xE6, 0x41, 0x47, 0x52, 0x2C, 0x94, 0xA4, 0x39, 0xE5, 0x41, 0x06, 0x4A, 0x8B, 0x7B, 0xEC, 0x93, 0x67, 0x52, 0x67, 0x52, 0xC8, 0x62, 0x87, 0x5A, 0x0C, 0x94, 0x45, 0x52, 0xE6, 0x41, 0xC8, 0x62, 0x24, 0x29, 0x85, 0x31, 0x84, 0x31, 0xA5, 0x39, 0xE9, 0x6A, 0x85, 0x39, 0x43, 0x29, 0x44, 0x29, 0x23, 0x29, 0x26, 0x52, 0xE5, 0x41, 0x64, 0x31, 0x85, 0x39, 0x26, 0x4A,
+    0x8A, 0x83, 0xC5, 0x41, 0xA5, 0x39, 0xC5, 0x41, 0x27, 0x52, 0x2A, 0x7B, 0x4A, 0x7B, 0x46, 0x5A, 0x54, 0xE6, 0xAB, 0x8B, 0x49, 0x8B, 0x2C, 0xBC, 0xDD, 0xFF, 0xD3, 0xED, 0xAC, 0x93, 0x0D, 0xA4, 0xE8, 0x72, 0xA8, 0x62, 0x47, 0x52, 0x26, 0x52, 0x4A, 0x83, 0x6E, 0x9C, 0x26, 0x4A, 0x27, 0x4A, 0x47, 0x52, 0xAF, 0xAC, 0x2A, 0x7B, 0x47, 0x52, 0x47, 0x52, 0x67, 0x52, 0x8E, 0x9C, 0x67, 0x52,
+    0x47, 0x52, 0x88, 0x5A, 0x2B, 0x7B, 0x2E, 0x9C, 0x29, 0x7B, 0x88, 0x5A, 0x28, 0x73, 0x27, 0x4A, 0x0C, 0x8C, 0x27, 0x52, 0xA8, 0x62, 0x06, 0x42, 0xE6, 0x41, 0x27, 0x4A, 0x06, 0x4A, 0x6A, 0x7B, 0x47, 0x52, 0x06, 0x42, 0xE5, 0x41, 0x4A, 0x73, 0x06, 0x4A, 0xE5, 0x41, 0x47, 0x4A, 0x6A, 0x7B, 0xE8, 0x6A, 0x46, 0x52, 0x06, 0x4A, 0xC8, 0x62, 0x08, 0x6B, 0x87, 0x5A, 0x26, 0x4A, 0xA8, 0x62,
+    0x23, 0x29, 0x23, 0x29, 0x44, 0x29, 0xE5, 0x49, 0xA5, 0x39, 0xE6, 0x41, 0x44, 0x29, 0x64, 0x31, 0x6B, 0x7B, 0x64, 0x31, 0x84, 0x39, 0x63, 0x39, 0x05, 0x4A, 0x2D, 0x9C, 0x64, 0x39, 0x64, 0x31, 0xC8, 0x62, 0xA4, 0x39, 0xA5, 0x39, 0x43, 0x39, 0xCC, 0x8B, 0x8B, 0x83, 0xAF, 0xBC, 0x8A, 0x7B, 0xE9, 0x72, 0x76, 0xEE, 0x8E, 0xBC, 0x71, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0xB4, 0xC9, 0x72,
+    0xE9, 0x72, 0x4D, 0xAC, 0x67, 0x5A, 0x26, 0x52, 0x67, 0x5A, 0xCC, 0x8B, 0x67, 0x5A, 0x27, 0x4A, 0x47, 0x52, 0xAB, 0x8B, 0x67, 0x5A, 0x68, 0x52, 0x48, 0x52, 0x09, 0x7B, 0x88, 0x5A, 0x68, 0x52, 0xAB, 0x83, 0xE9, 0x6A, 0x68, 0x5A, 0x87, 0x5A, 0x2B, 0x73, 0xCD, 0x8B, 0x27, 0x52, 0x26, 0x4A, 0x0A, 0x73, 0x26, 0x4A, 0x26, 0x52, 0x05, 0x4A, 0xE6, 0x41, 0x06, 0x4A, 0x0C, 0x8C, 0x06, 0x42,
+    0xE6, 0x41, 0x06, 0x42, 0xED, 0x93, 0xE6, 0x41, 0xE6, 0x41, 0xE5, 0x41, 0xC8, 0x62, 0xCB, 0x83, 0x67, 0x5A, 0x88, 0x5A, 0xA8, 0x5A, 0xA8, 0x5A, 0x0C, 0x94, 0x87, 0x5A, 0x29, 0x73, 0xC7, 0x62, 0x06, 0x42, 0x85, 0x31, 0x23, 0x29, 0xA4, 0x39, 0x44, 0x29, 0xE5, 0x49, 0x64, 0x31, 0xA5, 0x39, 0x64, 0x31, 0x06, 0x42, 0x85, 0x39, 0x85, 0x41, 0x85, 0x39, 0x2A, 0x6B, 0xA4, 0x41, 0xC5, 0x39,
+    0x85, 0x39, 0xAC, 0x83, 0x84, 0x39, 0xE5, 0x49, 0x4A, 0x73, 0x8A, 0x7B, 0x68, 0x62, 0x67, 0x5A, 0x68, 0x5A, 0xCB, 0x8B, 0x88, 0x6A, 0xEC, 0xA3, 0x0F, 0xD5, 0x95, 0xFE, 0x2D, 0xAC, 0xC8, 0x6A, 0xE9, 0x72, 0x8B, 0x83, 0x47, 0x5A, 0x26, 0x52, 0x46, 0x5A, 0x8E, 0x9C, 0x87, 0x5A, 0x06, 0x4A, 0xAF, 0xAC, 0x4E, 0xA4, 0x88, 0x62, 0x47, 0x52, 0x47, 0x5A, 0x2A, 0x73, 0x6D, 0xA4, 0x47, 0x52,
+    0x47, 0x52, 0xE9, 0x72, 0x67, 0x52, 0x0C, 0x94, 0x47, 0x52, 0xAF, 0xA4, 0x27, 0x52, 0xA8, 0x62, 0x47, 0x52, 0x47, 0x52, 0x4A, 0x73, 0x47, 0x52, 0xC8, 0x6A, 0x06, 0x4A, 0x27, 0x4A, 0x06, 0x4A, 0xA9, 0x5A, 0x09, 0x73, 0x06, 0x4A, 0x26, 0x4A, 0x06, 0x4A, 0x26, 0x52, 0xEC, 0x8B, 0x67, 0x52, 0xC8, 0x62, 0x67, 0x52, 0x08, 0x73, 0x87, 0x5A, 0x2A, 0x73, 0x87, 0x5A, 0xA8, 0x5A, 0xA7, 0x5A,
+    0x23, 0x31, 0x84, 0x31, 0x44, 0x29, 0x44, 0x31, 0xA8, 0x5A, 0x44, 0x31, 0xA5, 0x39, 0x27, 0x4A, 0x64, 0x31, 0x44, 0x31, 0xA8, 0x5A, 0x47, 0x52, 0x23, 0x29, 0xC5, 0x41, 0x2A, 0x73, 0xA5, 0x39, 0xC5, 0x39, 0x84, 0x39, 0x8A, 0x7B, 0x8E, 0xA4, 0xEC, 0x83, 0x26, 0x4A, 0xA8, 0x62, 0x92, 0xCD, 0xE9, 0x72, 0xA8, 0x62, 0x4A, 0x83, 0x31, 0xCD, 0xC8, 0x82, 0x6A, 0x8B, 0xAF, 0xAC, 0xA8, 0x6A,
+    0xAE, 0xB4, 0x4A, 0x83, 0x87, 0x5A, 0x46, 0x52, 0x30, 0xB5, 0x8F, 0xA4, 0xA8, 0x6A, 0x47, 0x52, 0x06, 0x4A, 0x8E, 0xAC, 0x87, 0x5A, 0x68, 0x5A, 0x0C, 0x8C, 0x91, 0xC5, 0x2D, 0x9C, 0x67, 0x5A, 0x88, 0x62, 0x47, 0x52, 0xC8, 0x6A, 0x19, 0xEF, 0x09, 0x6B, 0x27, 0x52, 0x8B, 0x7B, 0x0A, 0x6B, 0x27, 0x52, 0x6B, 0x73, 0x27, 0x4A, 0x10, 0xC5, 0x27, 0x4A, 0xE6, 0x41, 0xC5, 0x41, 0x07, 0x4A,
+    0x4D, 0x9C, 0x6B, 0x7B, 0x27, 0x4A, 0x06, 0x4A, 0xAB, 0x83, 0xE5, 0x49, 0x88, 0x5A, 0xA8, 0x5A, 0xE9, 0x6A, 0x8E, 0x9C, 0x26, 0x52, 0xC8, 0x62, 0xE9, 0x62, 0xC8, 0x62, 0xA8, 0x62, 0xA8, 0x62, 0x85, 0x41, 0x84, 0x31, 0x85, 0x31, 0x64, 0x31, 0x06, 0x4A, 0x84, 0x39, 0x84, 0x39, 0x68, 0x52, 0x64, 0x31, 0xA5, 0x31, 0x4A, 0x7B, 0xC5, 0x49, 0x67, 0x52, 0x85, 0x39, 0x85, 0x39, 0x6B, 0x83,
+    0xE6, 0x41, 0x85, 0x39, 0xC5, 0x41, 0xE9, 0x6A, 0x09, 0x7B, 0x96, 0xEE, 0x88, 0x5A, 0x71, 0xB5, 0x34, 0xE6, 0xE9, 0x72, 0x4D, 0xAC, 0xA8, 0x7A, 0x77, 0xFF, 0xE9, 0x7A, 0x4D, 0x9C, 0x8B, 0x8B, 0x6D, 0x94, 0x87, 0x62, 0x66, 0x5A, 0x26, 0x52, 0x13, 0xD6, 0x5B, 0xF7, 0xA8, 0x6A, 0x47, 0x52, 0x88, 0x62, 0x6E, 0xA4, 0x87, 0x62, 0xA9, 0x62, 0x2A, 0x73, 0xE9, 0x72, 0xC9, 0x62, 0x0D, 0x94,
+    0x6F, 0x9C, 0x0A, 0x6B, 0x09, 0x73, 0x88, 0x5A, 0xCB, 0x8B, 0xA8, 0x5A, 0x2D, 0x9C, 0x46, 0x52, 0x46, 0x52, 0x0C, 0x94, 0x06, 0x4A, 0x27, 0x52, 0x68, 0x52, 0xE6, 0x41, 0x87, 0x5A, 0xCB, 0x8B, 0x06, 0x4A, 0x07, 0x4A, 0x07, 0x4A, 0xAC, 0x83, 0x6D, 0x9C, 0x26, 0x52, 0x08, 0x63, 0xC8, 0x62, 0xAB, 0x83, 0xCB, 0x83, 0x47, 0x52, 0x4B, 0x7B, 0xE9, 0x6A, 0x87, 0x5A, 0x8D, 0x9C, 0x08, 0x6B,
+    0x23, 0x29, 0x46, 0x52, 0x64, 0x31, 0x84, 0x39, 0x64, 0x31, 0x64, 0x31, 0xA8, 0x62, 0x06, 0x4A, 0x87, 0x52, 0xA5, 0x39, 0x68, 0x52, 0x29, 0x7B, 0x87, 0x5A, 0x26, 0x4A, 0x84, 0x39, 0xA5, 0x39, 0x4A, 0x7B, 0xA5, 0x39, 0xE6, 0x49, 0x47, 0x52, 0x09, 0x6B, 0x0A, 0x73, 0xE9, 0x6A, 0x6A, 0x7B, 0x46, 0x5A, 0x67, 0x62, 0x09, 0x73, 0x0C, 0x9C, 0x6A, 0x93, 0x09, 0x7B, 0xCC, 0x8B, 0x87, 0x6A,
+    0x4B, 0x7B, 0xE8, 0x6A, 0xE8, 0x6A, 0x67, 0x5A, 0x2A, 0x7B, 0x2E, 0x9C, 0xC9, 0x6A, 0x47, 0x52, 0xC9, 0x6A, 0x11, 0xC5, 0x88, 0x6A, 0x2A, 0x7B, 0xB0, 0xB4, 0x8F, 0xB4, 0xAC, 0x8B, 0x88, 0x5A, 0x14, 0xE6, 0x6A, 0x83, 0x87, 0x5A, 0x2D, 0x94, 0x68, 0x52, 0xCD, 0x93, 0x87, 0x5A, 0x67, 0x52, 0x09, 0x6B, 0x67, 0x5A, 0xE8, 0x6A, 0xA8, 0x62, 0x27, 0x4A, 0xE9, 0x6A, 0x26, 0x52, 0xE6, 0x41,
+    0x06, 0x4A, 0x47, 0x52, 0x09, 0x6B, 0x26, 0x52, 0xA8, 0x62, 0x06, 0x4A, 0x4A, 0x73, 0x67, 0x62, 0x4A, 0x73, 0x2A, 0x6B, 0xC8, 0x62, 0x09, 0x6B, 0x49, 0x73, 0x87, 0x5A, 0x09, 0x6B, 0xE8, 0x6A, 0x23, 0x29, 0xA5, 0x39, 0x43, 0x29, 0xC9, 0x62, 0x44, 0x31, 0xA5, 0x39, 0xA5, 0x39, 0x84, 0x31, 0x0A, 0x6B, 0x06, 0x42, 0x27, 0x4A, 0xE5, 0x41, 0x85, 0x39, 0xCC, 0x8B, 0x47, 0x52, 0x84, 0x31,
+    0xA5, 0x39, 0x6E, 0xA4, 0xCC, 0x8B, 0x47, 0x52, 0xA8, 0x62, 0x6D, 0x9C, 0xCC, 0x93, 0xF0, 0xAC, 0x6A, 0x7B, 0x8B, 0x83, 0xA8, 0x62, 0x2D, 0xA4, 0x67, 0x62, 0x10, 0xB5, 0x4B, 0x7B, 0xA8, 0x62, 0x09, 0x7B, 0x2D, 0x9C, 0xEC, 0x83, 0x67, 0x5A, 0xF1, 0xB4, 0x11, 0xBD, 0xE9, 0x72, 0x68, 0x52, 0x68, 0x5A, 0xAF, 0xB4, 0x6B, 0x8B, 0xD0, 0xD4, 0xFF, 0xFF, 0xD0, 0xCC, 0x2E, 0xA4, 0x88, 0x62,
+    0xC9, 0x6A, 0x8C, 0x93, 0xC9, 0x6A, 0xEC, 0x93, 0xE9, 0x6A, 0x90, 0xAC, 0xCF, 0xA4, 0x0A, 0x6B, 0x4E, 0x9C, 0xE9, 0x6A, 0x88, 0x5A, 0x27, 0x4A, 0x26, 0x52, 0xA8, 0x62, 0x06, 0x4A, 0x26, 0x4A, 0xAF, 0x9C, 0x67, 0x5A, 0xC8, 0x62, 0x47, 0x52, 0xE9, 0x6A, 0xE5, 0x49, 0x09, 0x6B, 0xC8, 0x6A, 0xC8, 0x62, 0xE9, 0x6A, 0x8B, 0x7B, 0x4A, 0x73, 0x4D, 0xA4, 0x87, 0x62, 0x49, 0x73, 0xC8, 0x62,
+    0x84, 0x31, 0x23, 0x29, 0x43, 0x29, 0x64, 0x31, 0x43, 0x29, 0xE8, 0x62, 0x84, 0x39, 0xA5, 0x39, 0x85, 0x39, 0x84, 0x31, 0x2A, 0x73, 0x27, 0x4A, 0xC5, 0x39, 0xA4, 0x39, 0x4D, 0x9C, 0x07, 0x4A, 0xA5, 0x39, 0x85, 0x39, 0x8D, 0x9C, 0x29, 0x73, 0x27, 0x52, 0x27, 0x52, 0x6B, 0x7B, 0xAC, 0x83, 0x47, 0x52, 0x67, 0x5A, 0x09, 0x73, 0xA8, 0x62, 0xA7, 0x6A, 0xCB, 0x83, 0x6E, 0x9C, 0x8B, 0x83,
+    0x4D, 0x9C, 0xB2, 0xD5, 0x49, 0x7B, 0x27, 0x52, 0x4A, 0x83, 0x51, 0xBD, 0x52, 0xCD, 0x67, 0x5A, 0x88, 0x62, 0x52, 0xCD, 0x7A, 0xFF, 0xB9, 0xEE, 0xFF, 0xFF, 0x52, 0xE5, 0xE9, 0x7A, 0xF1, 0xA4, 0xC8, 0x82, 0xA8, 0x6A, 0x8A, 0x8B, 0x26, 0x6A, 0xD0, 0xBC, 0xC9, 0x6A, 0x88, 0x62, 0x88, 0x62, 0x8F, 0xA4, 0xA8, 0x62, 0x88, 0x5A, 0x47, 0x52, 0x0D, 0x9C, 0x06, 0x4A, 0x06, 0x4A, 0xE9, 0x6A,
+    0xC9, 0x6A, 0xCB, 0x8B, 0xA8, 0x5A, 0x67, 0x52, 0x87, 0x5A, 0x87, 0x62, 0x09, 0x73, 0xC8, 0x62, 0x2A, 0x73, 0x09, 0x6B, 0xD7, 0xEE, 0x67, 0x5A, 0x29, 0x73, 0xC8, 0x62, 0x29, 0x73, 0xA8, 0x62, 0x43, 0x29, 0x64, 0x31, 0x84, 0x39, 0x44, 0x31, 0x64, 0x31, 0x44, 0x29, 0x66, 0x52, 0x67, 0x52, 0xC5, 0x39, 0x84, 0x31, 0x93, 0xBD, 0xA8, 0x62, 0x87, 0x5A, 0x64, 0x31, 0x85, 0x39, 0x4C, 0x9C,
+    0x06, 0x4A, 0xC5, 0x41, 0xE6, 0x49, 0xCC, 0x8B, 0xA9, 0x62, 0x26, 0x52, 0x47, 0x52, 0xEC, 0x93, 0x51, 0xC5, 0x26, 0x52, 0x09, 0x73, 0xC9, 0x62, 0x71, 0xC5, 0x47, 0x5A, 0x0C, 0x8C, 0x67, 0x62, 0x6B, 0x83, 0xC8, 0x6A, 0xE9, 0x6A, 0xA9, 0x62, 0x4A, 0x7B, 0x0D, 0x94, 0x0C, 0x8C, 0x68, 0x5A, 0x4B, 0x7B, 0x19, 0xFF, 0x2A, 0x83, 0xAC, 0x9B, 0x93, 0xE5, 0x6B, 0x93, 0xE9, 0x6A, 0x4B, 0x7B,
+    0xD0, 0xB4, 0xC8, 0x6A, 0x0D, 0xA4, 0x67, 0x5A, 0xE9, 0x6A, 0xAC, 0x83, 0x67, 0x5A, 0x4E, 0x94, 0xAB, 0x83, 0xA8, 0x5A, 0x87, 0x5A, 0x13, 0xD6, 0x26, 0x52, 0x26, 0x4A, 0xA8, 0x62, 0xAC, 0x83, 0x47, 0x5A, 0x47, 0x52, 0x6E, 0xA4, 0x2A, 0x73, 0xEC, 0x8B, 0x09, 0x6B, 0x4A, 0x73, 0x09, 0x6B, 0x0C, 0x94, 0x8A, 0x83, 0xAB, 0x83, 0x6A, 0x7B, 0x4A, 0x73, 0xE9, 0x6A, 0xAB, 0x83, 0xA8, 0x62,
+    0x68, 0x52, 0x64, 0x31, 0x44, 0x31, 0xA5, 0x39, 0xA8, 0x62, 0x84, 0x39, 0xA5, 0x39, 0xA5, 0x39, 0xE7, 0x62, 0xA5, 0x39, 0x4A, 0x7B, 0xC5, 0x41, 0x4D, 0x9C, 0x64, 0x31, 0x47, 0x52, 0x6A, 0x7B, 0x10, 0xB5, 0x09, 0x6B, 0x06, 0x4A, 0x68, 0x5A, 0x2D, 0x94, 0x6A, 0x7B, 0x88, 0x5A, 0xE9, 0x6A, 0x0A, 0x73, 0x87, 0x62, 0x2D, 0x9C, 0x09, 0x6B, 0x67, 0x5A, 0xC8, 0x6A, 0xC9, 0x6A, 0x8B, 0x83,
+    0xE9, 0x6A, 0xA8, 0x62, 0x6A, 0x7B, 0x0D, 0x8C, 0xEC, 0x93, 0x88, 0x62, 0x2E, 0x94, 0xA9, 0x62, 0x4A, 0x7B, 0x10, 0xBD, 0x0A, 0x7B, 0x0A, 0x73, 0x9A, 0xF7, 0x4A, 0x7B, 0xAC, 0x8B, 0xAC, 0x83, 0x09, 0x6B, 0x2A, 0x7B, 0xC9, 0x6A, 0x6E, 0xA4, 0x0C, 0x8C, 0x2A, 0x73, 0x4D, 0x9C, 0xE9, 0x6A, 0xA8, 0x62, 0x8E, 0xA4, 0x8D, 0x9C, 0xA8, 0x62, 0x67, 0x5A, 0x88, 0x62, 0x87, 0x62, 0xAB, 0x8B,
+    0xA9, 0x62, 0x4E, 0x9C, 0xA8, 0x62, 0x6A, 0x7B, 0x8E, 0x9C, 0x4A, 0x73, 0x6A, 0x73, 0x8E, 0xAC, 0x6A, 0x7B, 0xCF, 0xA4, 0x4A, 0x7B, 0x09, 0x73, 0xCC, 0x8B, 0xE9, 0x6A, 0x8A, 0x7B, 0xC7, 0x62, 0x44, 0x29, 0x27, 0x4A, 0xA5, 0x39, 0xA5, 0x39, 0x44, 0x29, 0x84, 0x39, 0x46, 0x52, 0x27, 0x4A, 0x26, 0x4A, 0x44, 0x31, 0x06, 0x4A, 0x49, 0x73, 0xE5, 0x41, 0x67, 0x52, 0xE5, 0x41, 0xA8, 0x5A,
+    0x0C, 0x9C, 0xCF, 0xB4, 0xA8, 0x5A, 0x67, 0x5A, 0x26, 0x52, 0xB1, 0xCD, 0xC8, 0x6A, 0x46, 0x52, 0x67, 0x5A, 0x70, 0xC5, 0xC8, 0x6A, 0xC9, 0x6A, 0x6B, 0x7B, 0x92, 0xD5, 0xA8, 0x6A, 0x2A, 0x7B, 0x0A, 0x73, 0x08, 0x73, 0xCC, 0x8B, 0xC8, 0x6A, 0x2A, 0x7B, 0x31, 0xBD, 0xAB, 0x83, 0x88, 0x5A, 0x2B, 0x7B, 0xCF, 0xB4, 0x0A, 0x73, 0xE9, 0x6A, 0x53, 0xBD, 0x8B, 0x83, 0xEC, 0x93, 0x93, 0xBD,
+    0x2A, 0x7B, 0x4E, 0xA4, 0xAB, 0x83, 0x2E, 0x9C, 0xAC, 0x8B, 0x2A, 0x7B, 0xA8, 0x62, 0x67, 0x5A, 0xE9, 0x6A, 0x8F, 0xA4, 0x88, 0x62, 0x67, 0x5A, 0xE9, 0x6A, 0x09, 0x6B, 0x87, 0x62, 0x8B, 0x7B, 0x88, 0x5A, 0xA8, 0x62, 0x09, 0x73, 0xA7, 0x6A, 0x4A, 0x7B, 0x29, 0x73, 0x6A, 0x7B, 0x4A, 0x73, 0x8A, 0x83, 0x2D, 0x9C, 0xAB, 0x83, 0xE8, 0x6A, 0x8A, 0x83, 0x08, 0x6B, 0xF0, 0xAC, 0xE8, 0x6A,
+    0xA9, 0x5A, 0x64, 0x31, 0x44, 0x31, 0x68, 0x52, 0xE6, 0x41, 0xA5, 0x39, 0xC5, 0x41, 0x84, 0x31, 0x67, 0x5A, 0x84, 0x31, 0xE6, 0x41, 0x06, 0x4A, 0x6B, 0x73, 0x4A, 0x7B, 0x27, 0x52, 0xC5, 0x41, 0x47, 0x52, 0x27, 0x52, 0x0C, 0x94, 0xA8, 0x62, 0x67, 0x5A, 0x88, 0x62, 0x8B, 0x83, 0xC9, 0x6A, 0x87, 0x5A, 0xB4, 0xC5, 0x26, 0x5A, 0x4D, 0xA4, 0xA8, 0x6A, 0x36, 0xD6, 0x88, 0x6A, 0xA8, 0x6A,
+    0x0C, 0x94, 0x08, 0x6B, 0xEC, 0x8B, 0xC9, 0x6A, 0xC8, 0x6A, 0xAF, 0xA4, 0x8A, 0x83, 0x47, 0x52, 0xE9, 0x6A, 0xB0, 0xB4, 0x2A, 0x7B, 0x2A, 0x7B, 0x11, 0xBD, 0x6B, 0x83, 0x2E, 0x9C, 0x09, 0x73, 0x7A, 0xFF, 0x8B, 0x83, 0x6B, 0x7B, 0xAC, 0x8B, 0x6F, 0xAC, 0x0A, 0x73, 0xE9, 0x6A, 0xC8, 0x6A, 0x9A, 0xFF, 0x88, 0x62, 0xC8, 0x62, 0x6B, 0x7B, 0x0D, 0x94, 0xE9, 0x6A, 0x6B, 0x7B, 0x6E, 0x9C,
+    0xA9, 0x62, 0x91, 0xC5, 0xCF, 0xAC, 0x4A, 0x7B, 0x49, 0x73, 0x8B, 0x83, 0xAC, 0x8B, 0x6A, 0x7B, 0x8B, 0x83, 0xCB, 0x83, 0x0C, 0x94, 0x4A, 0x7B, 0xF0, 0xB4, 0x29, 0x73, 0x6A, 0x7B, 0x29, 0x73, 0x64, 0x31, 0x43, 0x29, 0xC5, 0x41, 0x64, 0x31, 0x64, 0x31, 0x68, 0x52, 0xE6, 0x41, 0xA5, 0x39, 0xC6, 0x41, 0x47, 0x52, 0x8B, 0x83, 0x84, 0x39, 0x47, 0x52, 0xAC, 0x83, 0x4A, 0x73, 0x27, 0x4A,
+    0xE5, 0x41, 0x27, 0x4A, 0x46, 0x52, 0x08, 0x6B, 0x87, 0x5A, 0x87, 0x5A, 0xA8, 0x6A, 0x2A, 0x7B, 0x2A, 0x73, 0xE9, 0x6A, 0x2A, 0x7B, 0x51, 0xB5, 0x0D, 0x94, 0xE9, 0x72, 0x6D, 0x9C, 0xE9, 0x72, 0x8E, 0xAC, 0x6A, 0x7B, 0xED, 0x8B, 0xE9, 0x6A, 0x2D, 0x9C, 0x8F, 0x9C, 0x6B, 0x83, 0xC9, 0x62, 0xC9, 0x6A, 0x4E, 0x9C, 0x4B, 0x83, 0xAF, 0xA4, 0xFF, 0xFF, 0xD0, 0xBC, 0x2E, 0xA4, 0x2A, 0x73,
+    0x52, 0xC5, 0x0D, 0x8C, 0x6E, 0xA4, 0x6A, 0x83, 0x6B, 0x7B, 0x09, 0x6B, 0x8B, 0x83, 0x92, 0xC5, 0xC8, 0x6A, 0xA8, 0x62, 0xCC, 0x8B, 0xCF, 0xAC, 0xC8, 0x62, 0xC9, 0x62, 0x4E, 0xA4, 0xE9, 0x6A, 0xAB, 0x83, 0x09, 0x73, 0xCC, 0x8B, 0x29, 0x73, 0x92, 0xCD, 0x6A, 0x7B, 0x0D, 0x94, 0x29, 0x73, 0x29, 0x73, 0xEC, 0x8B, 0xEC, 0x93, 0x29, 0x73, 0xCB, 0x8B, 0xCC, 0x8B, 0x2C, 0x94, 0x4A, 0x7B,
+    0x44, 0x29, 0x64, 0x31, 0xC5, 0x39, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0xC6, 0x39, 0x2A, 0x6B, 0x88, 0x52, 0x64, 0x31, 0x27, 0x4A, 0x68, 0x52, 0xCC, 0x83, 0xA4, 0x41, 0xAC, 0x83, 0x67, 0x5A, 0xE5, 0x41, 0x06, 0x4A, 0xC9, 0x6A, 0x8C, 0x8B, 0x0A, 0x73, 0xEC, 0x93, 0x2A, 0x7B, 0xAC, 0xAB, 0x55, 0xE6, 0x4A, 0x7B, 0xAB, 0x8B, 0x4A, 0x7B, 0x96, 0xEE, 0xE8, 0x72, 0x4A, 0x83, 0x6F, 0xA4,
+    0x6E, 0xA4, 0x09, 0x73, 0x77, 0xDE, 0xC8, 0x62, 0x57, 0xD6, 0xD0, 0xAC, 0xDD, 0xFF, 0xC9, 0x62, 0x2A, 0x73, 0x2E, 0x9C, 0x2E, 0x9C, 0xB0, 0xB4, 0xFF, 0xFF, 0x8F, 0xBC, 0x8C, 0x8B, 0xED, 0x93, 0x4B, 0x7B, 0x2A, 0x7B, 0x73, 0xCD, 0x0C, 0x9C, 0x0A, 0x73, 0x4A, 0x83, 0xB3, 0xCD, 0xE9, 0x6A, 0xA8, 0x6A, 0xC8, 0x7A, 0x6D, 0xA4, 0x0A, 0x73, 0xA8, 0x6A, 0x4A, 0x8B, 0xAF, 0xA4, 0xE8, 0x6A,
+    0x6E, 0x9C, 0x2A, 0x7B, 0x31, 0xB5, 0xAE, 0xA4, 0x2D, 0x94, 0xEC, 0x8B, 0x8B, 0x83, 0x0C, 0x94, 0x4A, 0x7B, 0xEC, 0x8B, 0xCB, 0x8B, 0xAB, 0x8B, 0x4D, 0x9C, 0xAB, 0x83, 0xEC, 0x93, 0x6A, 0x7B, 0x84, 0x31, 0xC6, 0x41, 0xA5, 0x39, 0xC6, 0x49, 0x8C, 0x8B, 0xE5, 0x49, 0x06, 0x4A, 0xA5, 0x39, 0x84, 0x39, 0x6B, 0x8B, 0xA8, 0x62, 0xA4, 0x39, 0xA8, 0x5A, 0x47, 0x52, 0x87, 0x5A, 0x4A, 0x7B,
+    0x68, 0x5A, 0x87, 0x5A, 0x88, 0x62, 0x09, 0x73, 0xA8, 0x6A, 0x0C, 0x9C, 0xAC, 0x9B, 0xD0, 0xC4, 0x4E, 0xAC, 0x76, 0xF6, 0x4A, 0x7B, 0x8C, 0x83, 0xAB, 0x8B, 0xB3, 0xDD, 0x0F, 0xC5, 0x0C, 0xA4, 0x6B, 0x8B, 0x48, 0x83, 0x6A, 0x7B, 0x8B, 0x83, 0xEC, 0x93, 0xD0, 0xB4, 0x0D, 0x9C, 0xC9, 0x62, 0xE9, 0x6A, 0xF0, 0xBC, 0x6B, 0x83, 0x2E, 0x9C, 0x8F, 0xB4, 0x2E, 0xAC, 0x6B, 0x7B, 0xE8, 0x6A,
+    0x2A, 0x7B, 0x8E, 0xAC, 0x6B, 0x83, 0x8C, 0x8B, 0x4B, 0x7B, 0xAF, 0xB4, 0x4B, 0x7B, 0x4A, 0x7B, 0x13, 0xE6, 0x6A, 0x7B, 0x4A, 0x7B, 0xD0, 0xAC, 0x09, 0x73, 0x6B, 0x7B, 0x6B, 0x7B, 0xE8, 0x72, 0x09, 0x73, 0xEC, 0x93, 0x4A, 0x7B, 0x8B, 0x83, 0x8B, 0x83, 0xAF, 0xA4, 0x0C, 0x94, 0xCB, 0x8B, 0xEC, 0x93, 0xEC, 0x93, 0x0C, 0x94, 0x6E, 0xA4, 0xEC, 0x8B, 0xEC, 0x8B, 0x2C, 0x94, 0x8A, 0x83,
+    0xE5, 0x49, 0x09, 0x73, 0x87, 0x52, 0x5A, 0xFF, 0x27, 0x4A, 0xC4, 0x49, 0x2A, 0x83, 0xA8, 0x62, 0xCD, 0x8B, 0xA4, 0x39, 0x67, 0x5A, 0xEC, 0x9B, 0x14, 0xD6, 0x8B, 0x8B, 0x88, 0x5A, 0x46, 0x5A, 0x4D, 0xA4, 0xE6, 0x51, 0x88, 0x62, 0x0C, 0xA4, 0x8C, 0x83, 0xD3, 0xDD, 0xF9, 0xFE, 0xFF, 0xFF, 0xB8, 0xFE, 0x72, 0xC5, 0x0D, 0xA4, 0xAF, 0xB4, 0xAF, 0xB4, 0xF4, 0xED, 0xFF, 0xFF, 0xD0, 0xCC,
+    0xDD, 0xFF, 0x2C, 0x9C, 0xAF, 0x9C, 0x5A, 0xF7, 0x52, 0xC5, 0x52, 0xBD, 0x8B, 0x8B, 0x88, 0x5A, 0x32, 0xB5, 0x72, 0xCD, 0x0A, 0x73, 0xE9, 0x6A, 0xAB, 0x8B, 0xC8, 0x6A, 0x6B, 0x83, 0xD3, 0xE5, 0x4A, 0x83, 0x8F, 0xA4, 0x0A, 0x7B, 0xF1, 0xBC, 0x72, 0xCD, 0xA8, 0x6A, 0x6C, 0x83, 0xAC, 0x8B, 0x8F, 0xA4, 0x4D, 0x94, 0x4A, 0x7B, 0x09, 0x7B, 0xE9, 0x6A, 0x8E, 0xA4, 0x10, 0xB5, 0x6E, 0xA4,
+    0x6B, 0x83, 0x6A, 0x83, 0x29, 0x7B, 0xF2, 0xD5, 0x90, 0xBD, 0x2D, 0x94, 0x8F, 0xA4, 0x0C, 0x94, 0xEC, 0x93, 0x16, 0xEF, 0x4D, 0x94, 0x2C, 0x94, 0x4D, 0x9C, 0x0C, 0x94, 0xD1, 0xC5, 0xEC, 0x8B, 0x67, 0x5A, 0xA4, 0x41, 0x84, 0x39, 0xCC, 0x8B, 0xD5, 0xCD, 0x6B, 0x83, 0x69, 0x8B, 0x26, 0x4A, 0x0D, 0x94, 0x06, 0x52, 0x4A, 0x7B, 0xA5, 0x41, 0x56, 0xDE, 0x6A, 0x8B, 0xE8, 0x7A, 0xB0, 0x9C,
+    0x27, 0x4A, 0x2A, 0x73, 0xD0, 0xC4, 0xC9, 0x7A, 0x4E, 0x9C, 0x8B, 0x93, 0xD3, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xD5, 0x93, 0xD5, 0x10, 0xC5, 0x50, 0xD5, 0x32, 0xD5, 0x32, 0xD5, 0x2D, 0xA4, 0x52, 0xDD, 0x6B, 0x8B, 0x2D, 0x9C, 0x2A, 0x7B, 0x4D, 0xA4, 0xC9, 0x62, 0x2D, 0x9C, 0x47, 0x52, 0x09, 0x7B, 0x4E, 0xA4, 0x4E, 0xA4, 0x2A, 0x73, 0xF8, 0xEE, 0xE9, 0x6A, 0xED, 0x93, 0xC8, 0x6A,
+    0x6B, 0x83, 0xE9, 0x72, 0x0A, 0x83, 0x11, 0xC5, 0x8B, 0x93, 0xEC, 0x9B, 0x09, 0x7B, 0xD4, 0xCD, 0x8F, 0xA4, 0xAF, 0xA4, 0x8F, 0xA4, 0x6B, 0x83, 0x8F, 0xAC, 0xEC, 0x93, 0x2A, 0x7B, 0x6A, 0x7B, 0xCC, 0x93, 0x33, 0xE6, 0xCF, 0xC4, 0xAF, 0xB4, 0x8E, 0xAC, 0x50, 0xBD, 0x2C, 0x9C, 0x4D, 0x9C, 0x4D, 0x9C, 0x6E, 0xA4, 0x71, 0xD5, 0x8E, 0xA4, 0xAE, 0xA4, 0x2D, 0x94, 0x2C, 0x94, 0x4C, 0x9C,
+    0x64, 0x31, 0xA5, 0x39, 0xE6, 0x41, 0x06, 0x4A, 0xA9, 0x5A, 0x06, 0x4A, 0xA5, 0x41, 0x8B, 0x7B, 0x2B, 0x73, 0x47, 0x52, 0x06, 0x4A, 0xCB, 0x93, 0x2D, 0x94, 0x18, 0xF7, 0x4A, 0xA4, 0xCF, 0xBC, 0x06, 0x4A, 0x06, 0x52, 0x67, 0x6A, 0x49, 0x83, 0xB3, 0xDD, 0xCC, 0x9B, 0x51, 0xD5, 0x8F, 0xC4, 0x76, 0xFE, 0xB2, 0xDD, 0xEC, 0x9B, 0xEF, 0xC4, 0xFF, 0xFF, 0xF2, 0xED, 0xAC, 0x9B, 0xAB, 0x8B,
+    0x8E, 0xB4, 0x4C, 0xA4, 0xAC, 0x8B, 0xCC, 0x8B, 0xCF, 0xAC, 0xEF, 0xB4, 0x72, 0xBD, 0x07, 0x4A, 0x6A, 0x83, 0x72, 0xC5, 0x6E, 0xA4, 0xA9, 0x62, 0x6A, 0x7B, 0xAB, 0x8B, 0x2A, 0x7B, 0x8B, 0x8B, 0x2A, 0x7B, 0x8B, 0x8B, 0x6F, 0xB4, 0xF0, 0xDC, 0x7A, 0xFF, 0xAF, 0xC4, 0x2D, 0xA4, 0xAC, 0x8B, 0x17, 0xFF, 0x8B, 0x83, 0xF0, 0xB4, 0xF0, 0xB4, 0x6A, 0x7B, 0x6B, 0x83, 0x4E, 0x9C, 0x38, 0xFF,
+    0xCD, 0x8B, 0x8E, 0xB4, 0xFD, 0xFF, 0xFF, 0xFF, 0x95, 0xF6, 0xAE, 0xAC, 0xAE, 0xAC, 0xCF, 0xC4, 0xF7, 0xFE, 0x31, 0xC5, 0x8F, 0xAC, 0x8E, 0xA4, 0xAE, 0xAC, 0x10, 0xBD, 0x6D, 0xA4, 0x4D, 0xA4, 0x64, 0x31, 0xE6, 0x49, 0xC5, 0x39, 0x2A, 0x7B, 0xA5, 0x39, 0xA8, 0x5A, 0xC5, 0x39, 0x06, 0x42, 0x0D, 0x94, 0xAF, 0xA4, 0x4D, 0x94, 0xE5, 0x49, 0x2A, 0x73, 0xAC, 0x8B, 0x4A, 0x7B, 0x67, 0x52,
+    0x06, 0x4A, 0xE9, 0x6A, 0xEB, 0x93, 0x6E, 0xA4, 0x09, 0x73, 0x49, 0x93, 0xEC, 0x9B, 0x6A, 0x8B, 0x2A, 0x83, 0xF7, 0xFE, 0xAC, 0x93, 0xEC, 0x93, 0x55, 0xFE, 0xF6, 0xFE, 0x8E, 0xB4, 0x29, 0x83, 0x4A, 0x83, 0x30, 0xC5, 0x2D, 0x9C, 0x38, 0xEF, 0xC7, 0x6A, 0xD3, 0xCD, 0x4E, 0x9C, 0x47, 0x52, 0xCB, 0x93, 0x8F, 0xAC, 0x4A, 0x7B, 0x8B, 0x83, 0xC8, 0x6A, 0x2C, 0xA4, 0x11, 0xBD, 0x2D, 0x9C,
+    0xCD, 0x93, 0x39, 0xF7, 0x11, 0xD5, 0xB6, 0xEE, 0xFF, 0xFF, 0x75, 0xFE, 0x71, 0xC5, 0xF9, 0xE6, 0x6E, 0xA4, 0x72, 0xC5, 0x4E, 0xA4, 0xAB, 0x8B, 0x92, 0xCD, 0x6A, 0x83, 0x6A, 0x93, 0xAC, 0x93, 0xD0, 0xBC, 0xD3, 0xDD, 0x74, 0xFE, 0xB6, 0xFE, 0x30, 0xC5, 0x51, 0xCD, 0xB2, 0xD5, 0x92, 0xD5, 0xFC, 0xFF, 0xFF, 0xFF, 0x71, 0xCD, 0x6E, 0xA4, 0xAE, 0xAC, 0x6E, 0xA4, 0x30, 0xBD, 0x34, 0xDE,
+    0xC5, 0x39, 0x64, 0x31, 0x47, 0x4A, 0x06, 0x4A, 0x84, 0x31, 0x07, 0x4A, 0xC5, 0x39, 0xC5, 0x39, 0x27, 0x4A, 0xC9, 0x62, 0x47, 0x52, 0xE6, 0x49, 0x27, 0x52, 0xA8, 0x62, 0x6E, 0x9C, 0xEC, 0x8B, 0x26, 0x4A, 0x88, 0x5A, 0xA7, 0x62, 0xCB, 0x8B, 0x10, 0xAD, 0xC8, 0x72, 0x0D, 0x94, 0xF8, 0xEE, 0x11, 0xAD, 0xD0, 0xAC, 0xA8, 0x6A, 0x14, 0xC6, 0x6B, 0x8B, 0xEC, 0x93, 0x6A, 0x7B, 0xAB, 0x83,
+    0xC7, 0x6A, 0x8B, 0x83, 0x71, 0xBD, 0xD0, 0xAC, 0x6A, 0x7B, 0x2D, 0x8C, 0x8A, 0x83, 0x47, 0x52, 0xC8, 0x6A, 0x12, 0xB5, 0xE9, 0x72, 0x88, 0x5A, 0xA8, 0x6A, 0x6B, 0x7B, 0x4B, 0x7B, 0x29, 0x73, 0x8B, 0x8B, 0x6B, 0x83, 0x8A, 0x93, 0x51, 0xE5, 0x30, 0xE5, 0x4D, 0xAC, 0x8F, 0xB4, 0x31, 0xC5, 0x8B, 0x83, 0xEC, 0x93, 0xEC, 0x9B, 0xAB, 0x8B, 0x6A, 0x83, 0xCC, 0x8B, 0xED, 0x93, 0xAC, 0x93,
+    0xEC, 0x93, 0x8E, 0xA4, 0xF0, 0xBC, 0xF0, 0xB4, 0x6E, 0xAC, 0xB6, 0xDE, 0xD6, 0xFE, 0xFC, 0xFF, 0xF6, 0xFE, 0xEF, 0xC4, 0x10, 0xB5, 0xEF, 0xB4, 0x4D, 0xA4, 0xCF, 0xAC, 0x6E, 0xA4, 0x4D, 0xA4, 0x23, 0x29, 0x6B, 0x7B, 0x0A, 0x73, 0xC5, 0x49, 0xA5, 0x39, 0x0D, 0x94, 0x2D, 0x94, 0x6A, 0x83, 0xA8, 0x5A, 0x47, 0x52, 0xE8, 0x72, 0x2D, 0x9C, 0x71, 0xC5, 0x6B, 0x83, 0x4B, 0x73, 0x09, 0x73,
+    0xCB, 0x8B, 0x11, 0xBD, 0x2A, 0x73, 0x6B, 0x83, 0x6B, 0x7B, 0xED, 0xA3, 0x31, 0xCD, 0x68, 0x5A, 0x09, 0x73, 0x0C, 0x94, 0xCC, 0x93, 0x79, 0xFF, 0xA8, 0x6A, 0x7A, 0xE7, 0x47, 0x5A, 0xCC, 0x93, 0xC8, 0x6A, 0x4A, 0x7B, 0x8B, 0x83, 0x2A, 0x73, 0xEC, 0x93, 0x8B, 0x7B, 0xCB, 0x8B, 0x68, 0x5A, 0x8C, 0x83, 0x96, 0xE6, 0xA8, 0x6A, 0x8C, 0x7B, 0x29, 0x73, 0x4A, 0x7B, 0x6B, 0x8B, 0xCC, 0x93,
+    0x4A, 0x7B, 0xAB, 0x83, 0x09, 0x83, 0x6B, 0x8B, 0xF0, 0xB4, 0x30, 0xC5, 0xAB, 0x8B, 0xAC, 0x8B, 0x2E, 0x9C, 0x72, 0xBD, 0x0D, 0x94, 0x6E, 0xA4, 0xAB, 0x8B, 0x6E, 0xA4, 0x75, 0xDE, 0x2D, 0x9C, 0xED, 0x93, 0x2D, 0x94, 0xCF, 0xB4, 0xFF, 0xFF, 0xFD, 0xFF, 0x34, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xBD, 0xCF, 0xAC, 0x13, 0xCE, 0x96, 0xDE, 0x16, 0xF7, 0x2C, 0x94,
+    0xA5, 0x41, 0xC5, 0x41, 0xE6, 0x41, 0x85, 0x39, 0x85, 0x31, 0x67, 0x5A, 0x83, 0x31, 0x6A, 0x73, 0xC5, 0x41, 0x64, 0x31, 0x6A, 0x7B, 0xAE, 0xA4, 0xC5, 0x41, 0x47, 0x5A, 0x4E, 0x9C, 0x6B, 0x83, 0xC5, 0x49, 0x29, 0x7B, 0x30, 0xC5, 0x8D, 0xB4, 0xCC, 0x93, 0x09, 0x6B, 0x0A, 0x73, 0xF0, 0xBC, 0x8B, 0x8B, 0x2A, 0x73, 0x6B, 0x83, 0xB6, 0xE6, 0x49, 0x83, 0x09, 0x73, 0x87, 0x62, 0x29, 0x7B,
+    0xAF, 0xBC, 0xA7, 0x6A, 0xE9, 0x6A, 0x4A, 0x7B, 0xE9, 0x6A, 0x87, 0x5A, 0xCC, 0x8B, 0x68, 0x52, 0x67, 0x5A, 0x8F, 0xA4, 0x2A, 0x73, 0x0A, 0x6B, 0x88, 0x62, 0x2A, 0x7B, 0x6A, 0x8B, 0xED, 0x8B, 0xAC, 0x83, 0xC8, 0x6A, 0x8F, 0xAC, 0xCC, 0x8B, 0xAF, 0xA4, 0x2E, 0x9C, 0xF8, 0xF6, 0x8F, 0xA4, 0x8B, 0x83, 0x0D, 0x94, 0x4A, 0x7B, 0xCF, 0xB4, 0xF0, 0xB4, 0xD1, 0xAC, 0x8B, 0x83, 0xD2, 0xCD,
+    0x0D, 0x94, 0xD3, 0xD5, 0x10, 0xBD, 0x76, 0xEE, 0x75, 0xE6, 0xB6, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xB2, 0xDD, 0x91, 0xCD, 0x6D, 0xA4, 0x10, 0xBD, 0x2C, 0x94, 0x4D, 0x9C, 0x4D, 0x9C, 0xCA, 0x93, 0x49, 0x7B, 0xA5, 0x39, 0x07, 0x52, 0x26, 0x4A, 0x47, 0x6A, 0x84, 0x39, 0xE5, 0x49, 0xA5, 0x41, 0x04, 0x72, 0xCC, 0x83, 0x29, 0x7B, 0x27, 0x52, 0xA8, 0x62, 0xCF, 0xAC, 0x6D, 0x94,
+    0xE5, 0x49, 0x4A, 0x83, 0xFF, 0xFF, 0x97, 0xEE, 0x0D, 0xA4, 0xE8, 0x7A, 0xEC, 0x93, 0x09, 0x73, 0xA8, 0x62, 0x52, 0xBD, 0xEC, 0x8B, 0x67, 0x5A, 0x88, 0x62, 0xCF, 0xAC, 0x87, 0x62, 0xC9, 0x6A, 0x47, 0x5A, 0x6E, 0xA4, 0xE9, 0x6A, 0x6B, 0x7B, 0x2A, 0x73, 0xCF, 0xA4, 0x09, 0x73, 0x88, 0x5A, 0xC8, 0x6A, 0x2E, 0x94, 0x67, 0x62, 0xA8, 0x62, 0xC9, 0x6A, 0x10, 0xBD, 0x8C, 0x83, 0x32, 0xBD,
+    0xF5, 0xD5, 0x2D, 0x9C, 0xC9, 0x72, 0x4A, 0x7B, 0x35, 0xE6, 0x93, 0xCD, 0xAC, 0x83, 0xED, 0x93, 0xCC, 0x8B, 0x6E, 0xA4, 0x8B, 0x8B, 0x0D, 0x94, 0x8A, 0x8B, 0xF0, 0xBC, 0xEC, 0x93, 0xAB, 0x8B, 0xCC, 0x93, 0xF9, 0xEE, 0x0C, 0x94, 0x10, 0xB5, 0x4D, 0xAC, 0xB6, 0xF6, 0xD3, 0xE5, 0xD3, 0xED, 0x91, 0xDD, 0x10, 0xC5, 0x0F, 0xBD, 0x6E, 0xA4, 0x72, 0xC5, 0xAF, 0xAC, 0x0C, 0x94, 0xCB, 0x8B,
+    0xA5, 0x39, 0x28, 0x52, 0x65, 0x31, 0x85, 0x39, 0x85, 0x31, 0x06, 0x4A, 0xA5, 0x39, 0xA5, 0x39, 0x84, 0x39, 0x26, 0x52, 0xA5, 0x39, 0x68, 0x5A, 0xC5, 0x41, 0xC8, 0x6A, 0xC9, 0x6A, 0x67, 0x5A, 0x47, 0x52, 0xC8, 0x62, 0xCB, 0xA3, 0x8B, 0x9B, 0xE9, 0x72, 0x8B, 0x83, 0x09, 0x6B, 0x48, 0x52, 0x09, 0x6B, 0x29, 0x73, 0x68, 0x5A, 0x67, 0x5A, 0x8B, 0x83, 0x67, 0x5A, 0x26, 0x52, 0x6B, 0x7B,
+    0x47, 0x5A, 0x4A, 0x7B, 0xAB, 0x7B, 0x87, 0x5A, 0x29, 0x7B, 0x67, 0x5A, 0xE8, 0x6A, 0x88, 0x52, 0xC9, 0x6A, 0x46, 0x52, 0x09, 0x73, 0x8C, 0x7B, 0x6B, 0x7B, 0x2A, 0x7B, 0x2A, 0x73, 0x2E, 0x9C, 0x8F, 0xA4, 0xE9, 0x72, 0x2E, 0xA4, 0x8B, 0x8B, 0xF7, 0xE6, 0xD3, 0xD5, 0x6E, 0xA4, 0x0D, 0x9C, 0x11, 0xB5, 0x0D, 0x9C, 0x4F, 0xAC, 0x9D, 0xFF, 0xD4, 0xDD, 0xCB, 0x8B, 0x0D, 0x94, 0xAC, 0x8B,
+    0x4E, 0xA4, 0x2D, 0x94, 0x4E, 0x9C, 0xCF, 0xAC, 0x11, 0xBD, 0xF4, 0xED, 0x72, 0xCD, 0xCF, 0xB4, 0xB2, 0xCD, 0x51, 0xC5, 0x10, 0xBD, 0x6D, 0xA4, 0xAE, 0xAC, 0x4D, 0x9C, 0x0C, 0x94, 0xAA, 0x8B, 0x84, 0x31, 0x85, 0x31, 0x65, 0x31, 0x64, 0x31, 0x84, 0x31, 0x85, 0x39, 0xA5, 0x39, 0x84, 0x39, 0x84, 0x39, 0x47, 0x52, 0xC5, 0x39, 0xA9, 0x62, 0xA5, 0x39, 0x47, 0x52, 0x26, 0x4A, 0xE5, 0x49,
+    0x84, 0x39, 0x47, 0x52, 0x46, 0x5A, 0xA8, 0x62, 0x68, 0x5A, 0x67, 0x5A, 0xE5, 0x49, 0x06, 0x4A, 0x26, 0x4A, 0xC8, 0x6A, 0x26, 0x52, 0x47, 0x5A, 0xA8, 0x62, 0x47, 0x52, 0x27, 0x52, 0xE9, 0x6A, 0x26, 0x52, 0x8B, 0x7B, 0x88, 0x62, 0xE9, 0x6A, 0xCC, 0x83, 0xE9, 0x62, 0x29, 0x73, 0x87, 0x52, 0x47, 0x52, 0xC9, 0x62, 0xA8, 0x62, 0xE9, 0x6A, 0xE9, 0x6A, 0xE9, 0x6A, 0xE9, 0x6A, 0x8C, 0x83,
+    0xAC, 0x83, 0x8C, 0x83, 0xED, 0x93, 0x6B, 0x83, 0x0D, 0x9C, 0x4E, 0xA4, 0x1A, 0xF7, 0x4E, 0xA4, 0x0D, 0x94, 0x0D, 0x94, 0x0D, 0x9C, 0xEC, 0x9B, 0x0C, 0x94, 0xCB, 0x8B, 0xEC, 0x8B, 0xCC, 0x8B, 0x0D, 0x94, 0x4E, 0x9C, 0xAF, 0xA4, 0xCF, 0xA4, 0xF0, 0xAC, 0xF0, 0xAC, 0x6E, 0xA4, 0x2D, 0x9C, 0xCF, 0xAC, 0xCF, 0xAC, 0x8E, 0xA4, 0x4D, 0x9C, 0x49, 0x7B, 0xEC, 0x8B, 0xAA, 0x83, 0x8B, 0x83,
+    0xCC, 0x83, 0x23, 0x29, 0x8B, 0x83, 0xC6, 0x41, 0x8A, 0x83, 0x8B, 0x83, 0x26, 0x5A, 0xCC, 0x93, 0x06, 0x4A, 0x64, 0x39, 0x09, 0x73, 0xC5, 0x41, 0xAB, 0x8B, 0xA4, 0x41, 0xE6, 0x41, 0xEC, 0x93, 0x26, 0x52, 0x4C, 0x9C, 0x2D, 0x9C, 0x88, 0x62, 0x88, 0x62, 0x8B, 0x83, 0x0C, 0x94, 0xC5, 0x49, 0x27, 0x52, 0xA4, 0x41, 0x8B, 0x83, 0x4D, 0xA4, 0x47, 0x52, 0x47, 0x5A, 0x27, 0x52, 0x8B, 0x83,
+    0xCC, 0x8B, 0x87, 0x5A, 0x26, 0x52, 0xA8, 0x62, 0x8F, 0x9C, 0x67, 0x52, 0xE9, 0x6A, 0x67, 0x52, 0x29, 0x63, 0x8B, 0x83, 0x87, 0x5A, 0xC9, 0x62, 0xE9, 0x6A, 0xE9, 0x6A, 0xAB, 0x8B, 0x8B, 0x83, 0xAC, 0x83, 0xAC, 0x8B, 0xCD, 0x8B, 0x31, 0xBD, 0x8F, 0xA4, 0x2E, 0xA4, 0xD0, 0xBC, 0x4E, 0xA4, 0x0D, 0x94, 0xF8, 0xEE, 0x2D, 0x9C, 0xAB, 0x8B, 0xEC, 0x93, 0x75, 0xDE, 0x37, 0xEF, 0xED, 0x93,
+    0x0D, 0x94, 0x0D, 0x94, 0x72, 0xBD, 0xFA, 0xFF, 0xAF, 0xA4, 0xAF, 0xAC, 0x2D, 0x9C, 0x4D, 0x9C, 0x58, 0xF7, 0xF2, 0xCD, 0xEB, 0x93, 0x2D, 0x94, 0x69, 0x7B, 0x58, 0xF7, 0x13, 0xD6, 0xCB, 0x8B, 0x64, 0x31, 0xA5, 0x39, 0xA5, 0x39, 0xE6, 0x41, 0xA5, 0x39, 0xC5, 0x39, 0xC5, 0x39, 0x06, 0x42, 0xC5, 0x39, 0x06, 0x4A, 0xC5, 0x41, 0x09, 0x63, 0x4B, 0x73, 0x47, 0x52, 0x67, 0x52, 0x6E, 0x94,
+    0x8B, 0x7B, 0xE5, 0x49, 0x05, 0x4A, 0x0A, 0x6B, 0x4A, 0x73, 0xA8, 0x62, 0x2A, 0x73, 0xEC, 0x83, 0x2A, 0x6B, 0x8B, 0x7B, 0x6F, 0x9C, 0x2A, 0x6B, 0x67, 0x5A, 0x09, 0x6B, 0xE9, 0x6A, 0xC8, 0x62, 0x07, 0x4A, 0x6F, 0x9C, 0xC8, 0x62, 0x67, 0x5A, 0x6B, 0x7B, 0x6E, 0x9C, 0x2A, 0x73, 0x88, 0x52, 0x88, 0x5A, 0x8E, 0xA4, 0xA8, 0x62, 0xE9, 0x62, 0xCC, 0x8B, 0x6E, 0x9C, 0x27, 0x52, 0x2E, 0x94,
+    0xAF, 0xAC, 0xF0, 0xB4, 0xD0, 0xAC, 0x8F, 0xA4, 0x72, 0xCD, 0x35, 0xF6, 0xFF, 0xFF, 0x3A, 0xFF, 0x31, 0xC5, 0x32, 0xC5, 0xCF, 0xB4, 0x4E, 0xAC, 0x8E, 0xAC, 0x34, 0xDE, 0x31, 0xC5, 0x76, 0xE6, 0x4E, 0xA4, 0x0D, 0x9C, 0x51, 0xC5, 0x8E, 0xAC, 0xAE, 0xAC, 0xD3, 0xDD, 0x6D, 0x9C, 0x4D, 0x9C, 0x30, 0xB5, 0x4D, 0x9C, 0xCB, 0x8B, 0xF3, 0xCD, 0x49, 0x7B, 0x4D, 0x9C, 0xCB, 0x8B, 0x0C, 0x94,
+    0x44, 0x29, 0x44, 0x29, 0x85, 0x31, 0x64, 0x31, 0x85, 0x31, 0xA5, 0x39, 0xA5, 0x39, 0xE6, 0x41, 0x84, 0x31, 0xE6, 0x41, 0xA5, 0x39, 0xA5, 0x39, 0xC5, 0x39, 0x47, 0x52, 0x06, 0x42, 0xC9, 0x62, 0x46, 0x4A, 0xE6, 0x41, 0x47, 0x52, 0x68, 0x52, 0x26, 0x4A, 0x27, 0x4A, 0x06, 0x4A, 0x47, 0x52, 0x47, 0x52, 0xA8, 0x5A, 0x47, 0x52, 0x67, 0x52, 0x47, 0x52, 0x47, 0x52, 0xC9, 0x62, 0x46, 0x52,
+    0x47, 0x52, 0x88, 0x5A, 0x67, 0x52, 0x47, 0x52, 0xC9, 0x62, 0x67, 0x52, 0xA8, 0x62, 0x67, 0x52, 0x47, 0x52, 0xC8, 0x62, 0x67, 0x5A, 0x88, 0x5A, 0x0A, 0x73, 0x2A, 0x73, 0x87, 0x5A, 0x0D, 0x94, 0xAC, 0x8B, 0xED, 0x8B, 0x0E, 0x9C, 0x8F, 0xA4, 0x90, 0xAC, 0xF8, 0xFE, 0xFF, 0xFF, 0xF8, 0xFE, 0xD0, 0xB4, 0x4E, 0x9C, 0x6F, 0xA4, 0x2D, 0x9C, 0x2D, 0x9C, 0xAF, 0xAC, 0xAF, 0xAC, 0x6E, 0xA4,
+    0x2D, 0x9C, 0xEC, 0x8B, 0x6E, 0x9C, 0xF0, 0xAC, 0x31, 0xB5, 0xB6, 0xEE, 0xAF, 0xA4, 0x6E, 0xA4, 0xAF, 0xA4, 0x4D, 0x94, 0xAA, 0x8B, 0x0C, 0x94, 0x29, 0x7B, 0xCB, 0x8B, 0xCB, 0x8B, 0xAB, 0x8B, 0x64, 0x31, 0x84, 0x31, 0x85, 0x31, 0xA5, 0x39, 0x84, 0x31, 0x85, 0x31, 0xC5, 0x39, 0x06, 0x42, 0xC5, 0x39, 0x06, 0x42, 0xC5, 0x39, 0xA5, 0x39, 0xC5, 0x41, 0x26, 0x4A, 0xA4, 0x39, 0x88, 0x52,
+    0x68, 0x52, 0x06, 0x4A, 0x27, 0x4A, 0x26, 0x4A, 0x06, 0x4A, 0xE6, 0x41, 0x27, 0x4A, 0x06, 0x4A, 0xE6, 0x49, 0x67, 0x52, 0x47, 0x52, 0x68, 0x52, 0xC5, 0x41, 0x47, 0x52, 0x47, 0x52, 0x27, 0x52, 0xE6, 0x49, 0x88, 0x62, 0xE9, 0x6A, 0x47, 0x52, 0xC9, 0x62, 0x27, 0x52, 0xA8, 0x62, 0x68, 0x52, 0x47, 0x52, 0xA8, 0x62, 0x87, 0x5A, 0x88, 0x5A, 0xE9, 0x6A, 0x2A, 0x73, 0x47, 0x5A, 0x8B, 0x83,
+    0x8B, 0x83, 0xAC, 0x83, 0x0D, 0x94, 0x2E, 0x9C, 0x0D, 0x9C, 0xF0, 0xBC, 0xF5, 0xE5, 0xF1, 0xBC, 0x8F, 0xAC, 0xCC, 0x8B, 0x6F, 0xA4, 0xAF, 0xAC, 0xF0, 0xBC, 0x31, 0xC5, 0x10, 0xBD, 0x8E, 0xA4, 0x4E, 0x9C, 0x0D, 0x94, 0x4E, 0x94, 0x8E, 0x9C, 0x10, 0xAD, 0xF0, 0xAC, 0x4D, 0x9C, 0xAE, 0x9C, 0xAF, 0xA4, 0x6E, 0x9C, 0xEC, 0x8B, 0x0C, 0x94, 0x6A, 0x83, 0x0C, 0x94, 0xAB, 0x8B, 0x6A, 0x7B,
+    0x64, 0x31, 0xA5, 0x39, 0xC6, 0x39, 0xC5, 0x39, 0xC5, 0x41, 0xA5, 0x39, 0xE6, 0x41, 0x47, 0x4A, 0xE6, 0x41, 0xE6, 0x41, 0x06, 0x4A, 0xE6, 0x41, 0x06, 0x42, 0xE6, 0x41, 0x27, 0x4A, 0xE9, 0x62, 0x4A, 0x73, 0x47, 0x52, 0x2A, 0x73, 0x68, 0x52, 0xA8, 0x5A, 0x27, 0x4A, 0x67, 0x52, 0x06, 0x4A, 0x47, 0x52, 0x67, 0x52, 0xC5, 0x41, 0x67, 0x52, 0x06, 0x4A, 0x67, 0x5A, 0x27, 0x52, 0x06, 0x4A,
+    0x88, 0x5A, 0x88, 0x62, 0x47, 0x52, 0x88, 0x5A, 0xCC, 0x8B, 0x47, 0x52, 0xE8, 0x6A, 0x87, 0x62, 0x88, 0x62, 0x87, 0x5A, 0x88, 0x62, 0x88, 0x5A, 0xE9, 0x6A, 0x2A, 0x73, 0x67, 0x62, 0x6B, 0x7B, 0x8C, 0x83, 0x0E, 0x94, 0xED, 0x8B, 0x0D, 0x94, 0x6F, 0xA4, 0x72, 0xC5, 0x72, 0xBD, 0x36, 0xDE, 0x8F, 0xAC, 0x2E, 0x9C, 0xB0, 0xB4, 0xB2, 0xD5, 0xFF, 0xFF, 0xFC, 0xFF, 0x54, 0xF6, 0xCF, 0xBC,
+    0xD0, 0xAC, 0x2D, 0x9C, 0xD3, 0xC5, 0x2D, 0x9C, 0xCF, 0xA4, 0x30, 0xAD, 0xD3, 0xCD, 0xAF, 0xAC, 0xAF, 0xA4, 0x4D, 0x9C, 0x6E, 0x9C, 0x2D, 0x9C, 0x4A, 0x7B, 0xCC, 0x93, 0x6A, 0x83, 0x6A, 0x83, 0x6B, 0x8B, 0x0B, 0x73, 0xCC, 0x8B, 0xC5, 0x41, 0x09, 0x73, 0x6B, 0x8B, 0x9C, 0xFF, 0xCC, 0x93, 0xB0, 0xA4, 0xC4, 0x49, 0x6B, 0x83, 0x27, 0x52, 0xCC, 0x93, 0xCF, 0xB4, 0x26, 0x4A, 0xCB, 0x8B,
+    0x51, 0xBD, 0x2D, 0x94, 0x2E, 0x94, 0xA8, 0x62, 0x0D, 0x8C, 0xF1, 0xB4, 0xAC, 0x8B, 0x4D, 0x94, 0x06, 0x52, 0x43, 0x39, 0x4A, 0x7B, 0x8B, 0x83, 0xC4, 0x41, 0xD4, 0xD5, 0x88, 0x5A, 0x8F, 0xAC, 0x6E, 0xA4, 0x87, 0x5A, 0x27, 0x52, 0x06, 0x4A, 0x2A, 0x73, 0xEC, 0x8B, 0xA8, 0x62, 0xA5, 0x39, 0xA8, 0x6A, 0x8F, 0xAC, 0x46, 0x5A, 0xE9, 0x6A, 0x09, 0x7B, 0xAC, 0x8B, 0xAC, 0x8B, 0x2A, 0x7B,
+    0x4A, 0x7B, 0xB0, 0xAC, 0x32, 0xBD, 0x8F, 0xAC, 0xEB, 0x93, 0x8F, 0xAC, 0xF1, 0xB4, 0x51, 0xC5, 0x76, 0xD6, 0x72, 0xC5, 0x76, 0xE6, 0xF7, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xEE, 0x13, 0xD6, 0x8F, 0xAC, 0x10, 0xAD, 0xF4, 0xD5, 0x6D, 0xA4, 0x6D, 0x9C, 0xAF, 0xAC, 0x0C, 0x94, 0xAF, 0xAC, 0xCF, 0xAC, 0x4E, 0x9C, 0x92, 0xCD, 0xAB, 0x8B, 0xCB, 0x8B, 0x6A, 0x7B, 0x8B, 0x83,
+    0xA5, 0x31, 0xE6, 0x41, 0xC6, 0x39, 0x48, 0x52, 0x47, 0x52, 0x47, 0x52, 0x68, 0x5A, 0xE9, 0x6A, 0x2A, 0x73, 0x67, 0x5A, 0xC8, 0x62, 0x87, 0x5A, 0xA8, 0x5A, 0x07, 0x4A, 0xC9, 0x62, 0xC8, 0x62, 0x2A, 0x73, 0x89, 0x62, 0x0A, 0x6B, 0x26, 0x4A, 0x88, 0x5A, 0x67, 0x52, 0x68, 0x5A, 0x88, 0x5A, 0x47, 0x52, 0x06, 0x4A, 0x06, 0x4A, 0x67, 0x52, 0x06, 0x4A, 0x27, 0x52, 0x26, 0x4A, 0x26, 0x52,
+    0x27, 0x4A, 0x88, 0x62, 0xC5, 0x41, 0x47, 0x52, 0xE9, 0x6A, 0x88, 0x5A, 0x09, 0x73, 0x84, 0x39, 0x06, 0x4A, 0xA8, 0x62, 0x47, 0x5A, 0x26, 0x52, 0x09, 0x73, 0x2A, 0x73, 0xE9, 0x6A, 0x4A, 0x7B, 0x8B, 0x7B, 0x6B, 0x83, 0xED, 0x8B, 0x6B, 0x7B, 0xEC, 0x8B, 0xEC, 0x93, 0x6E, 0x9C, 0xCC, 0x93, 0x8F, 0xA4, 0x8F, 0xA4, 0xD4, 0xC5, 0x72, 0xD5, 0x58, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0xF3, 0xE5,
+    0x4D, 0x9C, 0x6E, 0x9C, 0x8F, 0xA4, 0xAB, 0x8B, 0x8F, 0xA4, 0x4E, 0x9C, 0xD0, 0xA4, 0x2D, 0x94, 0x2D, 0x94, 0x2C, 0x94, 0x2C, 0x94, 0x0C, 0x94, 0x6A, 0x83, 0x8B, 0x8B, 0x6A, 0x7B, 0xE9, 0x72, 0xE6, 0x41, 0xCA, 0x62, 0x47, 0x4A, 0x47, 0x52, 0xEA, 0x6A, 0x0A, 0x7B, 0x6B, 0x83, 0x6B, 0x83, 0xB0, 0xB4, 0xAC, 0x93, 0xB0, 0xAC, 0xAC, 0x8B, 0xCC, 0x8B, 0x68, 0x52, 0xE9, 0x62, 0x47, 0x52,
+    0x2A, 0x73, 0xC9, 0x62, 0x09, 0x6B, 0x26, 0x4A, 0x2A, 0x6B, 0x27, 0x4A, 0xE9, 0x6A, 0x27, 0x52, 0x27, 0x4A, 0x06, 0x4A, 0x47, 0x52, 0x8F, 0x9C, 0xE9, 0x72, 0x88, 0x5A, 0x47, 0x52, 0x47, 0x52, 0x68, 0x5A, 0x47, 0x5A, 0x06, 0x4A, 0x88, 0x62, 0xC9, 0x62, 0x88, 0x5A, 0xE9, 0x6A, 0x85, 0x39, 0x93, 0xD5, 0xA8, 0x62, 0xC9, 0x6A, 0xE5, 0x49, 0x0A, 0x73, 0x88, 0x62, 0x0D, 0x94, 0x2A, 0x7B,
+    0x6B, 0x7B, 0x09, 0x73, 0xCD, 0x8B, 0x09, 0x73, 0x6E, 0x9C, 0x8B, 0x8B, 0xB3, 0xC5, 0x2D, 0x9C, 0x4E, 0x9C, 0xB3, 0xC5, 0x73, 0xCD, 0x8F, 0xAC, 0x71, 0xD5, 0x52, 0xD5, 0x30, 0xC5, 0x51, 0xCD, 0x4E, 0x9C, 0x4D, 0x9C, 0xCB, 0x8B, 0x6A, 0x7B, 0x8E, 0x9C, 0xEB, 0x83, 0xAF, 0xA4, 0x4D, 0x9C, 0x8E, 0xA4, 0x6E, 0x9C, 0xEC, 0x8B, 0x0C, 0x94, 0x0C, 0x94, 0xAB, 0x83, 0x4A, 0x7B, 0xAB, 0x83,
+    0x06, 0x42, 0x06, 0x4A, 0x8C, 0x73, 0x37, 0xD6, 0x8C, 0x83, 0xFF, 0xFF, 0x77, 0xE6, 0x73, 0xC5, 0x73, 0xCD, 0x78, 0xF6, 0xFF, 0xFF, 0x3A, 0xFF, 0xBA, 0xFF, 0xAC, 0x83, 0xFB, 0xFF, 0x0D, 0x8C, 0x5A, 0xF7, 0x47, 0x5A, 0xFE, 0xFF, 0x6B, 0x7B, 0x5A, 0xEF, 0xE6, 0x41, 0xAC, 0x83, 0x0A, 0x6B, 0x26, 0x4A, 0x32, 0xC5, 0xE9, 0x62, 0x47, 0x52, 0xE7, 0x49, 0x26, 0x52, 0x87, 0x62, 0x46, 0x52,
+    0x47, 0x52, 0x26, 0x52, 0x09, 0x6B, 0x67, 0x5A, 0x47, 0x5A, 0x2D, 0x94, 0xC9, 0x6A, 0x85, 0x39, 0xA9, 0x6A, 0xCC, 0x8B, 0xA8, 0x62, 0x47, 0x52, 0x4F, 0x9C, 0x0A, 0x73, 0xEA, 0x72, 0x2A, 0x7B, 0xF1, 0xBC, 0x2A, 0x7B, 0xED, 0x93, 0xD0, 0xB4, 0x4A, 0x83, 0x2D, 0x9C, 0x72, 0xC5, 0x6B, 0x8B, 0x8F, 0xAC, 0x4E, 0xAC, 0x75, 0xEE, 0x2D, 0xA4, 0x6D, 0xA4, 0xDA, 0xFF, 0x96, 0xF6, 0x6E, 0xAC,
+    0xDD, 0xFF, 0xDB, 0xFF, 0xCC, 0x8B, 0xAB, 0x8B, 0x8E, 0x9C, 0x8B, 0x83, 0x8E, 0xA4, 0x6A, 0x83, 0xCB, 0x83, 0x5A, 0xF7, 0x2D, 0x9C, 0x0C, 0x94, 0xCC, 0x8B, 0x2D, 0x9C, 0x4A, 0x7B, 0x6A, 0x83, 0x06, 0x4A, 0xC5, 0x39, 0x89, 0x5A, 0x68, 0x5A, 0xC9, 0x6A, 0x10, 0xBD, 0x52, 0xD5, 0xAC, 0x8B, 0xCD, 0x93, 0x56, 0xEE, 0xFF, 0xFF, 0xD7, 0xEE, 0xFE, 0xFF, 0x26, 0x52, 0xC8, 0x62, 0x52, 0xBD,
+    0x6B, 0x7B, 0x06, 0x4A, 0xC9, 0x62, 0x2A, 0x73, 0x0D, 0x8C, 0x26, 0x4A, 0x06, 0x4A, 0x26, 0x52, 0x26, 0x52, 0x06, 0x4A, 0x06, 0x4A, 0x26, 0x4A, 0x4B, 0x7B, 0xE9, 0x6A, 0xE5, 0x49, 0x06, 0x52, 0xED, 0x8B, 0xAC, 0x83, 0xE5, 0x49, 0x26, 0x52, 0xC8, 0x6A, 0x4E, 0x9C, 0x88, 0x6A, 0x68, 0x5A, 0xA8, 0x62, 0x6E, 0xA4, 0xC9, 0x72, 0x47, 0x5A, 0xA8, 0x62, 0x4E, 0xA4, 0xE9, 0x72, 0x09, 0x73,
+    0x6F, 0xA4, 0x4E, 0xA4, 0x8A, 0x83, 0x8B, 0x83, 0xAC, 0x93, 0xD3, 0xDD, 0xD7, 0xF6, 0xED, 0x9B, 0x0D, 0x9C, 0xF0, 0xBC, 0x72, 0xCD, 0xEB, 0x93, 0x2D, 0x94, 0x52, 0xCD, 0x51, 0xCD, 0xEC, 0x9B, 0x0D, 0x94, 0xEC, 0x93, 0xAF, 0xAC, 0xAF, 0xAC, 0xCF, 0xAC, 0x6A, 0x83, 0xEF, 0xBC, 0xE9, 0x72, 0x09, 0x73, 0x0C, 0x94, 0xEC, 0x93, 0x8E, 0xA4, 0xCC, 0x8B, 0x6A, 0x83, 0x29, 0x7B, 0x4A, 0x7B,
+    0x88, 0x5A, 0xA5, 0x39, 0xC9, 0x6A, 0x06, 0x4A, 0x06, 0x4A, 0x15, 0xDE, 0x26, 0x52, 0x8B, 0x8B, 0xA9, 0x62, 0x4A, 0x7B, 0x8B, 0x83, 0x10, 0xAD, 0xEC, 0x93, 0x26, 0x4A, 0x27, 0x4A, 0x67, 0x52, 0x46, 0x52, 0xC5, 0x41, 0x0A, 0x6B, 0xA8, 0x5A, 0xC5, 0x41, 0x0D, 0x94, 0x8B, 0x83, 0x27, 0x52, 0xA5, 0x39, 0x84, 0x39, 0xCC, 0x8B, 0x49, 0x7B, 0xE5, 0x41, 0x26, 0x52, 0xE6, 0x49, 0xC8, 0x6A,
+    0x2D, 0x94, 0x27, 0x5A, 0x06, 0x52, 0x05, 0x52, 0x4A, 0x7B, 0xA8, 0x62, 0x09, 0x73, 0x67, 0x5A, 0x88, 0x62, 0x8F, 0xAC, 0x67, 0x62, 0xA8, 0x62, 0xA8, 0x6A, 0x2A, 0x7B, 0x6E, 0xA4, 0xC8, 0x6A, 0x2A, 0x7B, 0x2A, 0x7B, 0x0C, 0x9C, 0x31, 0xBD, 0xAD, 0x93, 0x10, 0xC5, 0xFF, 0xFF, 0xB3, 0xCD, 0xB3, 0xC5, 0x34, 0xDE, 0x55, 0xEE, 0xAB, 0x8B, 0x71, 0xC5, 0x76, 0xE6, 0xEC, 0x93, 0x4A, 0x83,
+    0xF0, 0xBC, 0x51, 0xBD, 0x0C, 0x9C, 0xB0, 0xAC, 0x31, 0xC5, 0x2D, 0x9C, 0xCF, 0xAC, 0x4E, 0x9C, 0x2D, 0x9C, 0xAF, 0xB4, 0xEC, 0x93, 0x38, 0xF7, 0x67, 0x62, 0xE8, 0x6A, 0x6A, 0x83, 0x8B, 0x8B, 0x64, 0x31, 0x84, 0x31, 0xC6, 0x39, 0x06, 0x42, 0xE6, 0x41, 0x06, 0x4A, 0x27, 0x52, 0x47, 0x52, 0x47, 0x52, 0xA9, 0x5A, 0x47, 0x52, 0x27, 0x4A, 0x88, 0x5A, 0x47, 0x52, 0xE9, 0x62, 0x67, 0x52,
+    0x67, 0x52, 0xC5, 0x41, 0xE9, 0x62, 0xC9, 0x62, 0xA9, 0x5A, 0x67, 0x52, 0xE6, 0x49, 0xA9, 0x62, 0x05, 0x4A, 0x84, 0x39, 0xE5, 0x41, 0x87, 0x5A, 0x06, 0x4A, 0x06, 0x4A, 0x06, 0x4A, 0xA8, 0x62, 0x47, 0x5A, 0x26, 0x52, 0xA8, 0x62, 0x26, 0x52, 0xE9, 0x6A, 0x2A, 0x73, 0xE9, 0x72, 0x88, 0x5A, 0x88, 0x62, 0x87, 0x62, 0xC8, 0x6A, 0xC8, 0x6A, 0xE9, 0x72, 0x4B, 0x7B, 0x0A, 0x7B, 0x4A, 0x7B,
+    0x09, 0x73, 0xE9, 0x72, 0xAF, 0xAC, 0x0D, 0x94, 0x6A, 0x83, 0x0D, 0x9C, 0x5A, 0xFF, 0xEC, 0x93, 0xCC, 0x8B, 0x6E, 0xA4, 0x0D, 0x9C, 0xED, 0x93, 0x14, 0xD6, 0xEC, 0x93, 0xFD, 0xFF, 0xB7, 0xE6, 0xD0, 0xAC, 0x0D, 0x8C, 0xE9, 0x72, 0xD3, 0xCD, 0x2E, 0x9C, 0xCF, 0xA4, 0x8E, 0x9C, 0x4D, 0x94, 0x39, 0xF7, 0x2D, 0x94, 0x0C, 0x94, 0xAB, 0x83, 0x87, 0x62, 0x4E, 0xA4, 0x29, 0x73, 0x4A, 0x7B,
+    0x64, 0x31, 0x68, 0x52, 0x07, 0x42, 0xA5, 0x39, 0x85, 0x39, 0xC9, 0x62, 0xA9, 0x5A, 0x67, 0x52, 0x27, 0x4A, 0x06, 0x4A, 0xAB, 0x7B, 0x26, 0x4A, 0x47, 0x52, 0x67, 0x52, 0x6E, 0x84, 0x4A, 0x6B, 0x67, 0x52, 0x47, 0x52, 0x6B, 0x73, 0x4B, 0x73, 0xE6, 0x41, 0xC9, 0x62, 0xAC, 0x7B, 0x26, 0x4A, 0x85, 0x39, 0xC5, 0x41, 0x4A, 0x73, 0x47, 0x52, 0xE5, 0x49, 0xC8, 0x62, 0x67, 0x5A, 0x26, 0x52,
+    0x67, 0x5A, 0xED, 0x8B, 0x67, 0x5A, 0x87, 0x62, 0x09, 0x73, 0x2D, 0x94, 0xE9, 0x72, 0xA8, 0x62, 0xC9, 0x6A, 0x8F, 0xA4, 0x6D, 0x9C, 0xE9, 0x72, 0xE9, 0x72, 0x09, 0x7B, 0x2A, 0x7B, 0x09, 0x73, 0x52, 0xC5, 0x2A, 0x7B, 0xAC, 0x8B, 0xCC, 0x8B, 0x2E, 0xA4, 0x6B, 0x83, 0x2D, 0x9C, 0xAC, 0x93, 0x56, 0xE6, 0xED, 0x93, 0xF1, 0xBC, 0x72, 0xCD, 0x4A, 0x83, 0xCC, 0x8B, 0xCB, 0x93, 0x6B, 0x83,
+    0xAB, 0x83, 0x8B, 0x83, 0x67, 0x6A, 0x8E, 0x9C, 0xEC, 0x8B, 0x10, 0xAD, 0xAF, 0x9C, 0x6E, 0x9C, 0x4D, 0x9C, 0x49, 0x7B, 0x0D, 0x94, 0xAB, 0x83, 0xA7, 0x62, 0x09, 0x73, 0x6B, 0x7B, 0xE8, 0x6A, 0x44, 0x29, 0x64, 0x31, 0x27, 0x52, 0x06, 0x4A, 0xA5, 0x39, 0xE6, 0x41, 0x68, 0x52, 0x0A, 0x73, 0x11, 0xB5, 0xC5, 0x41, 0x06, 0x4A, 0x6B, 0x73, 0xF0, 0xB4, 0x0A, 0x6B, 0x85, 0x39, 0x84, 0x39,
+    0x88, 0x5A, 0x06, 0x4A, 0x06, 0x4A, 0x67, 0x52, 0x0D, 0x84, 0x68, 0x52, 0x47, 0x52, 0xA9, 0x62, 0x06, 0x4A, 0xE6, 0x49, 0xC5, 0x49, 0x67, 0x5A, 0xC5, 0x49, 0xE9, 0x6A, 0x06, 0x52, 0x47, 0x5A, 0x26, 0x52, 0x4E, 0x9C, 0x88, 0x62, 0x67, 0x62, 0x0D, 0x9C, 0x2D, 0x9C, 0xC8, 0x72, 0x88, 0x62, 0x09, 0x73, 0xF0, 0xB4, 0x4A, 0x83, 0x0D, 0x94, 0x2A, 0x83, 0xED, 0x9B, 0x2A, 0x7B, 0xE9, 0x72,
+    0x6B, 0x83, 0x4E, 0xA4, 0x6A, 0x83, 0x8C, 0x8B, 0x6E, 0xA4, 0x8F, 0xB4, 0xCC, 0x93, 0x0D, 0xA4, 0x6B, 0x8B, 0xCD, 0x9B, 0x9B, 0xFF, 0x6B, 0x8B, 0x0D, 0x94, 0x6F, 0xAC, 0x4E, 0xAC, 0x8B, 0x8B, 0x09, 0x73, 0x8F, 0xA4, 0x4B, 0x7B, 0xD0, 0xA4, 0xC8, 0x6A, 0xE8, 0x72, 0x31, 0xC5, 0xAF, 0xA4, 0x6E, 0xA4, 0xCB, 0x8B, 0xEC, 0x8B, 0xEC, 0x93, 0x8B, 0x8B, 0xAC, 0x8B, 0xA8, 0x62, 0x6B, 0x83,
+    0x44, 0x29, 0x64, 0x31, 0x64, 0x31, 0x85, 0x31, 0x0A, 0x73, 0xE6, 0x41, 0x68, 0x5A, 0xE6, 0x41, 0x64, 0x31, 0x6B, 0x8B, 0x68, 0x5A, 0x47, 0x52, 0x06, 0x52, 0x4B, 0x83, 0xA4, 0x41, 0x26, 0x4A, 0x47, 0x52, 0xA5, 0x39, 0x8B, 0x83, 0x67, 0x5A, 0xE6, 0x41, 0x4A, 0x6B, 0xA4, 0x41, 0xCC, 0x8B, 0x63, 0x39, 0xC5, 0x41, 0xA4, 0x41, 0xED, 0x93, 0x47, 0x5A, 0x8B, 0x83, 0xC5, 0x49, 0x8B, 0x83,
+    0x4D, 0x9C, 0x0A, 0x73, 0x4A, 0x7B, 0xA7, 0x62, 0x0C, 0x94, 0xE8, 0x72, 0x29, 0x7B, 0x88, 0x62, 0xAB, 0x8B, 0x72, 0xCD, 0xE9, 0x7A, 0x4B, 0x7B, 0x29, 0x83, 0x6B, 0x8B, 0xAF, 0xB4, 0x4A, 0x83, 0x32, 0xBD, 0x0D, 0x9C, 0x8F, 0xAC, 0xCC, 0x8B, 0x6B, 0x83, 0x29, 0x83, 0xD8, 0xF6, 0xF0, 0xBC, 0x52, 0xCD, 0x4F, 0xB4, 0xCD, 0xA3, 0xCC, 0x9B, 0xB8, 0xFE, 0x8B, 0x83, 0xB7, 0xEE, 0xB0, 0xB4,
+    0x09, 0x7B, 0x2A, 0x7B, 0x6F, 0xA4, 0x8F, 0xAC, 0xE8, 0x72, 0xAF, 0xA4, 0x6E, 0xA4, 0xAF, 0xAC, 0xAF, 0xAC, 0x66, 0x5A, 0x0D, 0x94, 0x6A, 0x83, 0xAB, 0x8B, 0xCB, 0x8B, 0x67, 0x62, 0x4A, 0x7B, 0x64, 0x31, 0x85, 0x31, 0xC8, 0x6A, 0x84, 0x31, 0x64, 0x31, 0xC6, 0x41, 0x43, 0x31, 0x09, 0x73, 0xC6, 0x41, 0x64, 0x31, 0xA5, 0x39, 0xAC, 0x83, 0x66, 0x62, 0xE5, 0x49, 0x64, 0x31, 0x84, 0x39,
+    0x4B, 0x7B, 0x6A, 0x83, 0xA8, 0x5A, 0x27, 0x4A, 0x06, 0x4A, 0xA8, 0x62, 0x6B, 0x7B, 0x0A, 0x6B, 0xE6, 0x49, 0xA4, 0x41, 0x8B, 0x83, 0x6E, 0xA4, 0x47, 0x52, 0xC9, 0x6A, 0x4A, 0x7B, 0xAB, 0x8B, 0x26, 0x5A, 0x67, 0x62, 0xE8, 0x72, 0x08, 0x73, 0xAB, 0x93, 0x2D, 0x94, 0x6A, 0x83, 0xC8, 0x6A, 0x4A, 0x83, 0x34, 0xE6, 0xEC, 0xA3, 0xAC, 0x9B, 0x6F, 0xBC, 0x2E, 0xAC, 0x31, 0xC5, 0x4A, 0x83,
+    0xF0, 0xBC, 0xCC, 0x93, 0xF9, 0xEE, 0xAF, 0xB4, 0x0D, 0xA4, 0x8B, 0x8B, 0x6B, 0x8B, 0xAF, 0xB4, 0x32, 0xCD, 0x52, 0xE5, 0xB7, 0xFE, 0x8B, 0xA3, 0xB2, 0xCD, 0x8F, 0xB4, 0xAC, 0x8B, 0x8F, 0xA4, 0xC8, 0x6A, 0x52, 0xCD, 0xED, 0x93, 0x8F, 0xA4, 0xE9, 0x7A, 0xB3, 0xCD, 0xAB, 0x8B, 0x4A, 0x7B, 0x4E, 0x9C, 0x67, 0x62, 0x2A, 0x7B, 0xCC, 0x93, 0x0D, 0x94, 0xAB, 0x8B, 0xC8, 0x6A, 0x09, 0x73,
+    0x27, 0x4A, 0x43, 0x29, 0xA5, 0x31, 0x64, 0x31, 0x64, 0x31, 0xA8, 0x62, 0x84, 0x39, 0x85, 0x39, 0x64, 0x31, 0x85, 0x39, 0x4B, 0x7B, 0xAC, 0x83, 0x84, 0x49, 0x67, 0x52, 0x6B, 0x73, 0x85, 0x31, 0xE4, 0x49, 0xE5, 0x41, 0xE9, 0x6A, 0xA4, 0x41, 0x27, 0x52, 0x8F, 0xA4, 0x8B, 0x73, 0x88, 0x62, 0xC5, 0x41, 0xE5, 0x49, 0xC5, 0x49, 0xCC, 0x8B, 0x06, 0x4A, 0xD4, 0xC5, 0x26, 0x5A, 0xA9, 0x6A,
+    0xC9, 0x6A, 0x2D, 0x9C, 0xE9, 0x6A, 0xC8, 0x6A, 0x2D, 0x9C, 0xAF, 0xA4, 0xEB, 0x93, 0xE9, 0x72, 0x31, 0xCD, 0xD3, 0xD5, 0xF0, 0xCC, 0xB4, 0xFD, 0xF2, 0xE4, 0xAC, 0x9B, 0x8B, 0x93, 0x0A, 0x83, 0x70, 0xB4, 0x8F, 0xAC, 0xAC, 0x93, 0x6F, 0xAC, 0x51, 0xC5, 0xD4, 0xE5, 0x29, 0x83, 0x4E, 0xB4, 0x72, 0xDD, 0x9C, 0xFF, 0xFF, 0xFF, 0x53, 0xE5, 0xF4, 0xE5, 0xED, 0x8B, 0x71, 0xC5, 0xB7, 0xF6,
+    0x79, 0xFF, 0x4B, 0x83, 0xB0, 0xB4, 0xAF, 0xAC, 0x7D, 0xFF, 0x72, 0xC5, 0xF5, 0xED, 0x11, 0xBD, 0x0D, 0x94, 0x09, 0x73, 0x66, 0x6A, 0xE9, 0x7A, 0xCC, 0x93, 0x6A, 0x83, 0x2A, 0x7B, 0xCC, 0x9B, 0x43, 0x29, 0x65, 0x31, 0x64, 0x31, 0x85, 0x31, 0x84, 0x31, 0x85, 0x31, 0x64, 0x31, 0x10, 0xA5, 0xA8, 0x5A, 0x43, 0x31, 0x64, 0x31, 0x84, 0x39, 0x06, 0x4A, 0xE5, 0x41, 0x63, 0x31, 0xA5, 0x39,
+    0x87, 0x5A, 0xE5, 0x41, 0x67, 0x52, 0xA5, 0x41, 0xAE, 0xA4, 0x4A, 0x73, 0x88, 0x5A, 0x46, 0x5A, 0x87, 0x5A, 0xA4, 0x41, 0x88, 0x62, 0x29, 0x6B, 0x67, 0x5A, 0x09, 0x73, 0x07, 0x52, 0xAA, 0x83, 0x8F, 0xA4, 0xB0, 0xB4, 0xC8, 0x6A, 0x4A, 0x7B, 0xAB, 0x8B, 0xAF, 0xAC, 0x29, 0x7B, 0x2A, 0x83, 0x0C, 0xAC, 0xF5, 0xF5, 0x76, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0x72, 0xED, 0x6A, 0x8B, 0xD0, 0xBC,
+    0xED, 0x9B, 0x3A, 0xEF, 0x11, 0xBD, 0x8F, 0xAC, 0xF1, 0xBC, 0x30, 0xC5, 0xAC, 0x8B, 0xCD, 0x9B, 0x3A, 0xFF, 0xB0, 0xD4, 0x90, 0xE4, 0x16, 0xEE, 0x8B, 0x8B, 0xCD, 0x9B, 0x77, 0xEE, 0x2A, 0x7B, 0x2A, 0x7B, 0x6B, 0x83, 0xD0, 0xB4, 0x3A, 0xF7, 0x88, 0x6A, 0x31, 0xB5, 0xF4, 0xDD, 0xC8, 0x6A, 0x2D, 0x94, 0x4E, 0xA4, 0x87, 0x62, 0xAB, 0x8B, 0x4A, 0x7B, 0x8B, 0x8B, 0xE8, 0x6A, 0x6A, 0x83,
+    0x44, 0x29, 0x07, 0x42, 0x44, 0x29, 0x24, 0x29, 0x44, 0x29, 0x44, 0x29, 0xCC, 0x8B, 0xC5, 0x41, 0x64, 0x31, 0x43, 0x31, 0xCB, 0x8B, 0xA4, 0x39, 0xA5, 0x39, 0x84, 0x31, 0x84, 0x39, 0x2C, 0x94, 0xA4, 0x39, 0x88, 0x5A, 0x67, 0x52, 0x2D, 0x9C, 0x27, 0x52, 0xC9, 0x62, 0x06, 0x4A, 0x47, 0x5A, 0x2D, 0x94, 0xC5, 0x41, 0x47, 0x5A, 0xC9, 0x6A, 0x0D, 0x9C, 0xA8, 0x62, 0x87, 0x62, 0x88, 0x62,
+    0x09, 0x7B, 0x86, 0x5A, 0x9A, 0xF7, 0xE9, 0x72, 0x39, 0xEF, 0xAC, 0x8B, 0x2A, 0x83, 0x0D, 0xA4, 0xEF, 0xDC, 0xFF, 0xFF, 0xF4, 0xF5, 0x51, 0xDD, 0x8E, 0xCC, 0x7A, 0xFF, 0xAC, 0x9B, 0xCB, 0x9B, 0xC9, 0x7A, 0x0D, 0x9C, 0xAF, 0xBC, 0xAF, 0xB4, 0x6B, 0x83, 0x6B, 0x8B, 0x11, 0xC5, 0x6B, 0x8B, 0xAC, 0x93, 0x2A, 0x93, 0x93, 0xDD, 0x2E, 0xAC, 0x11, 0xBD, 0x6B, 0x8B, 0x0D, 0x9C, 0x2D, 0xA4,
+    0x4E, 0xA4, 0x2A, 0x7B, 0xAC, 0x8B, 0x0D, 0x9C, 0x27, 0x5A, 0x10, 0xA5, 0x4D, 0x9C, 0x87, 0x6A, 0x2D, 0x9C, 0xAC, 0x8B, 0x6B, 0x83, 0xAB, 0x8B, 0x4A, 0x7B, 0x6A, 0x83, 0x4A, 0x7B, 0xA8, 0x62, 0x43, 0x29, 0x44, 0x29, 0x23, 0x29, 0x43, 0x29, 0xA9, 0x62, 0x44, 0x29, 0x44, 0x31, 0xE6, 0x41, 0x64, 0x31, 0x67, 0x5A, 0x64, 0x31, 0x43, 0x31, 0x68, 0x62, 0x64, 0x39, 0x26, 0x4A, 0xA8, 0x62,
+    0xE5, 0x41, 0xA5, 0x39, 0xCC, 0x8B, 0x0A, 0x73, 0xE5, 0x49, 0xA8, 0x62, 0xD3, 0xCD, 0x06, 0x52, 0xC5, 0x41, 0xE5, 0x49, 0x6A, 0x7B, 0xD0, 0xB4, 0x26, 0x52, 0x67, 0x62, 0xED, 0x93, 0x2A, 0x7B, 0xC8, 0x72, 0xE5, 0x51, 0x87, 0x62, 0xE9, 0x72, 0x6B, 0x8B, 0x2D, 0x9C, 0x09, 0x83, 0xAB, 0x93, 0x91, 0xF5, 0xFF, 0xFF, 0x38, 0xFF, 0x8F, 0xC4, 0x19, 0xFF, 0x76, 0xF6, 0x2D, 0xB4, 0x8B, 0x93,
+    0x8B, 0x93, 0x4A, 0x83, 0x92, 0xE5, 0x8B, 0x8B, 0xCC, 0x93, 0x4A, 0x83, 0xC8, 0x6A, 0xD0, 0xBC, 0xED, 0x9B, 0x2A, 0x8B, 0xB2, 0xED, 0xFF, 0xFF, 0x8C, 0x93, 0x73, 0xBD, 0x31, 0xCD, 0x0A, 0x7B, 0xEC, 0x9B, 0x8F, 0xAC, 0x6B, 0x8B, 0x4D, 0x94, 0x09, 0x83, 0x0D, 0x9C, 0x10, 0xB5, 0x4A, 0x7B, 0xEC, 0x93, 0x8B, 0x8B, 0x0D, 0x9C, 0x09, 0x73, 0x2A, 0x7B, 0xEC, 0x93, 0x5A, 0xFF, 0xE8, 0x72,
+    0x23, 0x29, 0x23, 0x29, 0x8B, 0x83, 0x24, 0x29, 0x23, 0x29, 0x64, 0x31, 0x8C, 0x7B, 0xC5, 0x49, 0x64, 0x31, 0x27, 0x4A, 0x23, 0x29, 0x2A, 0x73, 0x6B, 0x83, 0xC5, 0x41, 0x84, 0x39, 0x84, 0x39, 0x6A, 0x7B, 0x4A, 0x7B, 0x8B, 0x7B, 0xC5, 0x41, 0xC5, 0x41, 0x4A, 0x7B, 0xE5, 0x49, 0xE5, 0x49, 0x88, 0x62, 0x67, 0x5A, 0xF0, 0xB4, 0xAC, 0x8B, 0xA8, 0x62, 0xA8, 0x62, 0x06, 0x52, 0x10, 0xB5,
+    0x06, 0x52, 0x6A, 0x83, 0xAC, 0x8B, 0xC9, 0x6A, 0xCC, 0x9B, 0xEC, 0x93, 0x29, 0x83, 0x4A, 0x8B, 0x4D, 0xB4, 0x37, 0xFF, 0x8F, 0xC4, 0x4E, 0xB4, 0xF8, 0xFE, 0xFF, 0xFF, 0xD3, 0xE5, 0xCC, 0x9B, 0x2A, 0x83, 0xE9, 0x82, 0x8F, 0xAC, 0x87, 0x6A, 0x4B, 0x83, 0xED, 0x9B, 0x4A, 0x7B, 0x6A, 0x8B, 0xF1, 0xC4, 0x2A, 0x83, 0x0D, 0xAC, 0xD8, 0xF6, 0xE8, 0x82, 0xEA, 0x7A, 0x72, 0xB5, 0x1A, 0xEF,
+    0xE9, 0x72, 0xD0, 0xBC, 0xA7, 0x6A, 0x2E, 0x9C, 0xA8, 0x62, 0x55, 0xDE, 0x6B, 0x83, 0xCC, 0x8B, 0x6E, 0xA4, 0x4A, 0x83, 0x6A, 0x83, 0xCC, 0x93, 0x4A, 0x7B, 0xE9, 0x72, 0x29, 0x7B, 0x4A, 0x83, 0x88, 0x5A, 0x23, 0x29, 0x44, 0x29, 0x64, 0x31, 0x23, 0x29, 0x4A, 0x7B, 0x84, 0x39, 0x84, 0x39, 0x2A, 0x6B, 0x06, 0x4A, 0x43, 0x31, 0x43, 0x31, 0xCB, 0x83, 0xE6, 0x41, 0x88, 0x5A, 0xA4, 0x39,
+    0xA8, 0x62, 0xE9, 0x6A, 0x26, 0x52, 0x06, 0x4A, 0x0D, 0x94, 0xCD, 0x8B, 0xE6, 0x49, 0x26, 0x52, 0xCC, 0x8B, 0xE5, 0x51, 0xC8, 0x6A, 0x88, 0x62, 0x06, 0x4A, 0x4A, 0x83, 0x26, 0x52, 0xA8, 0x6A, 0x05, 0x52, 0x8F, 0xAC, 0x67, 0x62, 0xC8, 0x6A, 0x4E, 0xA4, 0x2C, 0x9C, 0x6A, 0x8B, 0xE9, 0x7A, 0x2A, 0x8B, 0xAF, 0xBC, 0x6B, 0x93, 0x8C, 0x93, 0xAB, 0xB3, 0xCC, 0xA3, 0xC9, 0x82, 0x11, 0xC5,
+    0x87, 0x6A, 0xC8, 0x82, 0x4E, 0x9C, 0x09, 0x7B, 0xA8, 0x6A, 0xCC, 0x93, 0x9B, 0xFF, 0xFC, 0xFF, 0x76, 0xDE, 0x2D, 0xAC, 0x2A, 0x83, 0xC8, 0x7A, 0x2E, 0xA4, 0xEE, 0x9B, 0x2E, 0xA4, 0xE9, 0x72, 0x96, 0xF6, 0x6B, 0x83, 0x4A, 0x7B, 0x0D, 0x94, 0x8F, 0xA4, 0x30, 0xAD, 0xAF, 0xA4, 0xD0, 0xAC, 0xAB, 0x8B, 0xEC, 0x93, 0xCC, 0x93, 0x29, 0x7B, 0xC8, 0x6A, 0x6A, 0x83, 0x8B, 0x8B, 0xC8, 0x6A,
+    0x03, 0x21, 0x85, 0x31, 0x06, 0x4A, 0x23, 0x29, 0x23, 0x29, 0x64, 0x31, 0xC8, 0x62, 0x26, 0x4A, 0x06, 0x4A, 0xF4, 0xCD, 0x84, 0x39, 0xC5, 0x41, 0xE9, 0x62, 0x8A, 0x7B, 0x47, 0x52, 0x2D, 0x9C, 0xE5, 0x49, 0xC5, 0x39, 0x26, 0x52, 0x11, 0xB5, 0x88, 0x62, 0x67, 0x62, 0x06, 0x52, 0x09, 0x73, 0x34, 0xEE, 0xC8, 0x7A, 0x8B, 0x8B, 0x47, 0x62, 0xAB, 0x93, 0x09, 0x73, 0x06, 0x52, 0x47, 0x5A,
+    0x31, 0xC5, 0x26, 0x5A, 0xE9, 0x6A, 0x46, 0x5A, 0xE9, 0x7A, 0xF0, 0xBC, 0x4A, 0x83, 0xA8, 0x6A, 0xE9, 0x82, 0x2D, 0xA4, 0x2A, 0x83, 0x8C, 0x8B, 0xAC, 0x9B, 0xD4, 0xDD, 0x2A, 0x83, 0x8B, 0x8B, 0x2A, 0x7B, 0xE9, 0x7A, 0x2A, 0x7B, 0xE9, 0x7A, 0xED, 0x93, 0x4A, 0x83, 0x4E, 0xA4, 0x8F, 0xAC, 0xA9, 0x6A, 0x77, 0xF6, 0x77, 0xF6, 0x87, 0x6A, 0xC9, 0x7A, 0xFF, 0xFF, 0x0F, 0xB4, 0x8C, 0x93,
+    0x0D, 0x9C, 0x96, 0xFE, 0x11, 0xBD, 0xD7, 0xEE, 0xD3, 0xC5, 0xD3, 0xCD, 0xA8, 0x6A, 0x87, 0x62, 0x09, 0x7B, 0x4E, 0xA4, 0xF0, 0xB4, 0x8B, 0x83, 0x0D, 0x9C, 0xE8, 0x72, 0xA8, 0x6A, 0xA7, 0x62, 0x02, 0x21, 0xA5, 0x39, 0x46, 0x5A, 0x43, 0x29, 0xA8, 0x62, 0x44, 0x31, 0x07, 0x4A, 0x26, 0x52, 0x63, 0x31, 0x8B, 0x83, 0xA5, 0x39, 0x9B, 0xFF, 0x27, 0x52, 0x29, 0x6B, 0x6E, 0xA4, 0x26, 0x52,
+    0xA5, 0x41, 0xC6, 0x41, 0x29, 0x73, 0x29, 0x7B, 0x68, 0x5A, 0xA8, 0x6A, 0xAF, 0xB4, 0x8A, 0x8B, 0xE9, 0x7A, 0x50, 0xF5, 0xB8, 0xEE, 0x6B, 0x93, 0xC9, 0x72, 0x26, 0x5A, 0x27, 0x5A, 0xE5, 0x49, 0xEC, 0x9B, 0x25, 0x5A, 0x26, 0x52, 0x0A, 0x7B, 0xC8, 0x72, 0xEC, 0x9B, 0x2D, 0xA4, 0xA8, 0x6A, 0x2A, 0x83, 0x8E, 0xAC, 0x2A, 0x83, 0xC8, 0x72, 0x8B, 0x8B, 0x09, 0x7B, 0xCC, 0x93, 0xC8, 0x72,
+    0xCC, 0x93, 0x47, 0x62, 0x2D, 0x9C, 0xC8, 0x6A, 0xC8, 0x7A, 0xA8, 0x6A, 0xC9, 0x6A, 0xB0, 0xB4, 0x14, 0xD6, 0xA9, 0x6A, 0x0D, 0x94, 0xE5, 0x61, 0xA9, 0x6A, 0x6E, 0x9B, 0xDF, 0xFF, 0x0A, 0x7B, 0xAC, 0x8B, 0xED, 0xA3, 0x14, 0xEE, 0xE9, 0x72, 0x8B, 0x8B, 0xF4, 0xD5, 0xE4, 0x51, 0x6E, 0xA4, 0x31, 0xBD, 0x2E, 0xA4, 0x8B, 0x8B, 0x2D, 0x9C, 0x2A, 0x7B, 0x88, 0x62, 0xE8, 0x72, 0x09, 0x73,
+    0x44, 0x29, 0x03, 0x29, 0x23, 0x29, 0x23, 0x29, 0x64, 0x31, 0x23, 0x29, 0x84, 0x31, 0xE5, 0x49, 0x06, 0x4A, 0x43, 0x39, 0x26, 0x4A, 0xA5, 0x41, 0xAF, 0xA4, 0x09, 0x6B, 0xA8, 0x62, 0x6A, 0x83, 0x46, 0x52, 0x2D, 0x9C, 0xC9, 0x6A, 0x67, 0x62, 0x27, 0x5A, 0xCC, 0x8B, 0xC8, 0x72, 0x67, 0x62, 0xC8, 0x72, 0x33, 0xE6, 0x75, 0xEE, 0xCC, 0x93, 0x26, 0x52, 0x66, 0x62, 0x26, 0x52, 0xC9, 0x6A,
+    0xAF, 0xB4, 0x88, 0x62, 0xC5, 0x51, 0xA4, 0x49, 0xAF, 0xB4, 0xF0, 0xCC, 0x2C, 0xAC, 0x87, 0x62, 0xA8, 0x72, 0xB2, 0xD5, 0xCC, 0x8B, 0x0A, 0x7B, 0x6B, 0x83, 0xCF, 0xB4, 0xF0, 0xB4, 0x15, 0xD6, 0x67, 0x62, 0x88, 0x6A, 0x4B, 0x83, 0x31, 0xC5, 0xC9, 0x6A, 0x0A, 0x73, 0xA8, 0x6A, 0x88, 0x62, 0x09, 0x7B, 0x4F, 0xA4, 0xA9, 0x6A, 0x27, 0x52, 0xF4, 0xD5, 0x67, 0x62, 0x2A, 0x7B, 0xA8, 0x6A,
+    0xA8, 0x72, 0x6E, 0xA4, 0x6B, 0x7B, 0xA4, 0x41, 0x0D, 0x94, 0x46, 0x52, 0x4A, 0x83, 0xF4, 0xCD, 0x2D, 0x9C, 0xCC, 0x8B, 0xC9, 0x72, 0xA8, 0x62, 0x87, 0x62, 0xE9, 0x72, 0xE9, 0x6A, 0xC8, 0x6A, 0x23, 0x29, 0x06, 0x4A, 0x44, 0x31, 0x64, 0x31, 0x23, 0x29, 0xA5, 0x39, 0xE5, 0x49, 0x84, 0x39, 0xC5, 0x49, 0x71, 0xE5, 0xFC, 0xFF, 0x0B, 0x9C, 0x6A, 0x7B, 0xCB, 0x8B, 0x4A, 0x83, 0xF8, 0xE6,
+    0xA7, 0x62, 0x44, 0x31, 0x27, 0x5A, 0xFF, 0xFF, 0x6A, 0x8B, 0x4A, 0x7B, 0x8F, 0xB4, 0x67, 0x6A, 0xC8, 0x72, 0x29, 0x8B, 0x95, 0xE6, 0x88, 0x62, 0x44, 0x41, 0x47, 0x62, 0xE9, 0x6A, 0xAF, 0xAC, 0xC8, 0x72, 0x11, 0xCD, 0x8B, 0x93, 0xC5, 0x51, 0x8A, 0x9B, 0xFF, 0xFF, 0x59, 0xF7, 0xE5, 0x51, 0xE8, 0x82, 0x56, 0xF6, 0xC9, 0x72, 0x26, 0x52, 0xA8, 0x72, 0x16, 0xD6, 0xA7, 0x6A, 0x68, 0x62,
+    0xE6, 0x51, 0x6A, 0x93, 0x2A, 0x7B, 0x6A, 0x83, 0xEA, 0x72, 0xAF, 0xBC, 0xA8, 0x62, 0x4B, 0x7B, 0x68, 0x62, 0xA8, 0x72, 0x87, 0x62, 0x27, 0x52, 0x07, 0x52, 0xF1, 0xB4, 0x27, 0x5A, 0x27, 0x52, 0x2A, 0x73, 0xED, 0x8B, 0xC9, 0x62, 0xA5, 0x41, 0x4D, 0x8C, 0x4A, 0x7B, 0x6B, 0x83, 0x2D, 0x9C, 0xCC, 0x93, 0x47, 0x5A, 0xA8, 0x6A, 0x43, 0x31, 0x67, 0x5A, 0xC8, 0x6A, 0x87, 0x62, 0x67, 0x5A,
+    0x4A, 0x7B, 0x64, 0x31, 0x23, 0x29, 0x44, 0x29, 0x84, 0x39, 0x43, 0x31, 0x43, 0x31, 0x64, 0x39, 0x44, 0x39, 0xE5, 0x51, 0xC6, 0x49, 0xA4, 0x49, 0x47, 0x62, 0x43, 0x31, 0xC5, 0x41, 0x88, 0x62, 0xC5, 0x49, 0x44, 0x31, 0x06, 0x52, 0x8B, 0x93, 0x67, 0x5A, 0x69, 0x83, 0x11, 0xB5, 0xA8, 0x62, 0xE8, 0x72, 0xC8, 0x72, 0x8B, 0x83, 0x27, 0x52, 0xAB, 0x8B, 0x47, 0x5A, 0x6A, 0x7B, 0x25, 0x52,
+    0x67, 0x62, 0xC9, 0x6A, 0xC5, 0x49, 0xC5, 0x49, 0x66, 0x6A, 0xF0, 0xE4, 0xC9, 0x8A, 0xC5, 0x49, 0x67, 0x62, 0x93, 0xDD, 0x06, 0x5A, 0xA5, 0x41, 0x6B, 0x83, 0x67, 0x62, 0xE5, 0x51, 0x06, 0x52, 0x26, 0x5A, 0x47, 0x5A, 0x06, 0x52, 0xC8, 0x72, 0x27, 0x5A, 0xCC, 0x8B, 0xC5, 0x51, 0x8B, 0x8B, 0xD3, 0xC5, 0xE6, 0x51, 0xA8, 0x6A, 0x8A, 0x7B, 0xA5, 0x41, 0xC6, 0x41, 0x6B, 0x83, 0xC5, 0x41,
+    0xE6, 0x49, 0x47, 0x5A, 0x47, 0x62, 0x6B, 0x7B, 0x8B, 0x7B, 0x8E, 0x94, 0xAF, 0xA4, 0x8B, 0x83, 0x4A, 0x7B, 0xC5, 0x49, 0x8B, 0x83, 0xA5, 0x41, 0x67, 0x5A, 0x09, 0x73, 0x47, 0x5A, 0x67, 0x5A, 0x03, 0x21, 0x03, 0x21, 0x43, 0x29, 0x23, 0x29, 0xA5, 0x39, 0x23, 0x29, 0x47, 0x52, 0x44, 0x31, 0x43, 0x31, 0x44, 0x31, 0x64, 0x39, 0x06, 0x52, 0x44, 0x31, 0x64, 0x31, 0xA8, 0x62, 0x67, 0x5A,
+    0x85, 0x39, 0x23, 0x29, 0xC9, 0x6A, 0xC8, 0x72, 0x47, 0x5A, 0x46, 0x5A, 0x6A, 0x7B, 0x4B, 0x7B, 0x64, 0x39, 0xE6, 0x49, 0xAB, 0x83, 0x07, 0x52, 0x63, 0x39, 0xE6, 0x49, 0xA5, 0x41, 0xC5, 0x41, 0x47, 0x5A, 0xAF, 0xAC, 0xC5, 0x49, 0xA5, 0x41, 0x26, 0x5A, 0xAB, 0x8B, 0x67, 0x62, 0xA5, 0x41, 0xA9, 0x6A, 0x52, 0xCD, 0xC5, 0x49, 0xA5, 0x41, 0xC6, 0x49, 0x27, 0x52, 0xE5, 0x49, 0x2E, 0x94,
+    0x47, 0x62, 0x88, 0x62, 0x8C, 0x83, 0x06, 0x52, 0x46, 0x5A, 0xA5, 0x41, 0xE9, 0x72, 0xC9, 0x6A, 0xAB, 0x83, 0xC6, 0x49, 0x64, 0x39, 0xC5, 0x49, 0xE6, 0x49, 0x27, 0x4A, 0xE6, 0x49, 0x0C, 0x9C, 0xE6, 0x49, 0x07, 0x4A, 0x64, 0x39, 0x2A, 0x83, 0x29, 0x6B, 0xAC, 0x83, 0xED, 0x8B, 0x6A, 0x83, 0x43, 0x39, 0x85, 0x41, 0x0A, 0x73, 0x6B, 0x7B, 0xC8, 0x6A, 0xC8, 0x6A, 0x47, 0x5A, 0x67, 0x5A,
+    0x03, 0x21, 0x03, 0x21, 0x23, 0x29, 0x23, 0x29, 0xC8, 0x5A, 0xC2, 0x20, 0x23, 0x29, 0x23, 0x29, 0x44, 0x31, 0x6A, 0x7B, 0x44, 0x31, 0x84, 0x39, 0x44, 0x31, 0x4A, 0x73, 0x26, 0x52, 0xA5, 0x39, 0x64, 0x31, 0xC8, 0x62, 0x6A, 0x7B, 0xC5, 0x41, 0xE5, 0x49, 0xA7, 0x62, 0xA5, 0x41, 0x09, 0x73, 0x64, 0x39, 0x29, 0x7B, 0x6E, 0x9C, 0xE5, 0x51, 0x44, 0x31, 0x4D, 0x9C, 0x27, 0x52, 0x64, 0x39,
+    0x6B, 0x83, 0xEC, 0x93, 0x84, 0x41, 0x43, 0x39, 0xC9, 0x6A, 0xEC, 0x93, 0x26, 0x52, 0x85, 0x39, 0xA8, 0x62, 0x2D, 0xAC, 0xE5, 0x49, 0xA5, 0x41, 0xE9, 0x72, 0xF0, 0xBC, 0x2A, 0x7B, 0xC5, 0x49, 0xC6, 0x49, 0xE6, 0x49, 0x87, 0x6A, 0xE6, 0x49, 0xC5, 0x49, 0xE6, 0x49, 0xE6, 0x49, 0x26, 0x5A, 0x47, 0x5A, 0x84, 0x41, 0x0A, 0x63, 0x0E, 0x9C, 0x4E, 0x94, 0x88, 0x62, 0xC5, 0x41, 0xC6, 0x41,
+    0x8B, 0x8B, 0xE6, 0x41, 0x84, 0x39, 0x27, 0x4A, 0x8B, 0x8B, 0xC9, 0x62, 0x44, 0x39, 0xE9, 0x6A, 0xE5, 0x49, 0x67, 0x62, 0xE9, 0x72, 0x2A, 0x73, 0x26, 0x5A, 0x0A, 0x73, 0xC8, 0x6A, 0x26, 0x52, 0xE2, 0x20, 0xE2, 0x20, 0x85, 0x39, 0xAB, 0x83, 0xE6, 0x41, 0x03, 0x29, 0x02, 0x29, 0xE9, 0x6A, 0x67, 0x5A, 0xC4, 0x41, 0xC5, 0x41, 0x64, 0x31, 0xEB, 0x93, 0x23, 0x29, 0xE6, 0x49, 0x27, 0x4A,
+    0xC5, 0x41, 0xC8, 0x6A, 0x47, 0x52, 0x29, 0x73, 0xC5, 0x49, 0xA5, 0x41, 0x4A, 0x7B, 0xC5, 0x41, 0x43, 0x31, 0xC5, 0x49, 0x44, 0x31, 0x09, 0x7B, 0x64, 0x39, 0xE5, 0x51, 0x84, 0x41, 0x23, 0x31, 0x4E, 0xA4, 0xAF, 0xAC, 0x44, 0x39, 0x84, 0x39, 0xA8, 0x6A, 0xCC, 0x93, 0xC6, 0x49, 0x85, 0x39, 0xD1, 0xAC, 0xEC, 0x9B, 0xE6, 0x49, 0xC5, 0x49, 0x29, 0x8B, 0xCC, 0xA3, 0x4A, 0x83, 0xC6, 0x41,
+    0x06, 0x4A, 0xD2, 0xDD, 0xC6, 0x49, 0xED, 0x9B, 0xE6, 0x49, 0x6B, 0x8B, 0xC9, 0x6A, 0x06, 0x5A, 0xC5, 0x49, 0x64, 0x41, 0x64, 0x39, 0xE6, 0x49, 0x8F, 0xAC, 0xA4, 0x41, 0xA6, 0x39, 0xA5, 0x41, 0x64, 0x39, 0xAC, 0x8B, 0xE6, 0x49, 0xA9, 0x5A, 0xC8, 0x62, 0x26, 0x52, 0x23, 0x31, 0xE9, 0x62, 0xC9, 0x6A, 0xE9, 0x6A, 0x29, 0x7B, 0xE9, 0x6A, 0x2A, 0x73, 0x87, 0x5A, 0x06, 0x4A, 0x26, 0x52,
+    0xE3, 0x20, 0x09, 0x6B, 0x23, 0x29, 0x02, 0x29, 0xC5, 0x39, 0xC5, 0x41, 0xB3, 0xC5, 0x44, 0x31, 0x44, 0x31, 0xEB, 0xB3, 0x94, 0xEE, 0xA4, 0x41, 0x23, 0x39, 0x23, 0x31, 0x06, 0x4A, 0xC8, 0x62, 0x8B, 0x83, 0xE5, 0x49, 0x88, 0x62, 0x8B, 0x83, 0x25, 0x72, 0x26, 0x52, 0xE5, 0x49, 0x84, 0x39, 0x43, 0x31, 0xE5, 0x49, 0xA8, 0x6A, 0x4A, 0x73, 0x43, 0x31, 0x84, 0x39, 0x84, 0x41, 0x26, 0x52,
+    0x44, 0x39, 0x64, 0x31, 0x44, 0x31, 0x8C, 0x83, 0x88, 0x62, 0x88, 0x6A, 0xE6, 0x49, 0x85, 0x39, 0x06, 0x52, 0xE6, 0x49, 0xC5, 0x49, 0xE6, 0x49, 0x10, 0xCD, 0x88, 0x6A, 0xC6, 0x49, 0xE6, 0x49, 0xA5, 0x41, 0xC5, 0x49, 0xC6, 0x41, 0x85, 0x41, 0xA5, 0x39, 0xA5, 0x39, 0xA5, 0x41, 0xC5, 0x49, 0xE5, 0x51, 0xC6, 0x41, 0xE6, 0x49, 0xA8, 0x62, 0xC9, 0x62, 0x2A, 0x7B, 0x47, 0x62, 0xA5, 0x41,
+    0x07, 0x4A, 0x85, 0x39, 0x67, 0x5A, 0x88, 0x52, 0xA8, 0x5A, 0x06, 0x4A, 0x68, 0x5A, 0xE5, 0x49, 0x8C, 0x7B, 0xE9, 0x6A, 0x2A, 0x73, 0x88, 0x62, 0xC8, 0x6A, 0x87, 0x62, 0x47, 0x52, 0x67, 0x5A, 0x05, 0x52, 0x43, 0x31, 0x43, 0x31, 0x23, 0x29, 0x0A, 0x73, 0x23, 0x29, 0x6B, 0x7B, 0x23, 0x29, 0x44, 0x31, 0x8D, 0xC4, 0xF2, 0xDD, 0x6B, 0x83, 0xA5, 0x41, 0x43, 0x31, 0x88, 0x5A, 0x87, 0x62,
+    0x67, 0x5A, 0x64, 0x39, 0xC8, 0x6A, 0x4D, 0xA4, 0xC3, 0x69, 0x4A, 0x7B, 0xA8, 0x62, 0x64, 0x39, 0xA8, 0x72, 0xA8, 0x62, 0x87, 0x62, 0xE6, 0x49, 0xEC, 0x9B, 0x64, 0x31, 0x84, 0x39, 0x06, 0x5A, 0x84, 0x41, 0x6E, 0xA4, 0x85, 0x39, 0xA5, 0x41, 0x09, 0x73, 0x8D, 0xAC, 0xC5, 0x41, 0x64, 0x31, 0xC6, 0x41, 0x8B, 0x8B, 0xA5, 0x41, 0xA5, 0x39, 0xE5, 0x49, 0x07, 0x52, 0x84, 0x41, 0xC6, 0x41,
+    0x2A, 0x7B, 0xA5, 0x41, 0x84, 0x39, 0x84, 0x41, 0xC4, 0x51, 0xC6, 0x41, 0xEC, 0x93, 0xC5, 0x41, 0x6F, 0xAC, 0x85, 0x41, 0x06, 0x52, 0xEA, 0x72, 0xB4, 0xD5, 0xCC, 0xA3, 0x4B, 0x83, 0xA4, 0x49, 0x8B, 0x8B, 0x44, 0x39, 0xA8, 0x62, 0x8B, 0x8B, 0x47, 0x52, 0x84, 0x39, 0xEA, 0x62, 0xA8, 0x62, 0x4B, 0x83, 0x67, 0x5A, 0xA8, 0x62, 0xE9, 0x6A, 0x87, 0x5A, 0x47, 0x5A, 0x47, 0x52, 0x88, 0x5A,
+    0x23, 0x29, 0xE3, 0x20, 0x64, 0x31, 0x02, 0x21, 0x84, 0x39, 0x70, 0xBD, 0xE2, 0x28, 0x24, 0x29, 0x84, 0x41, 0x33, 0xD6, 0x4A, 0x8B, 0x88, 0x6A, 0x05, 0x52, 0xAC, 0x83, 0xB2, 0xD5, 0xC5, 0x41, 0x84, 0x39, 0x09, 0x6B, 0x6A, 0x7B, 0x71, 0xCD, 0xA6, 0x7A, 0xE5, 0x49, 0xA1, 0x20, 0x29, 0x7B, 0x64, 0x31, 0x47, 0x5A, 0x23, 0x29, 0xE6, 0x49, 0x84, 0x41, 0x87, 0x62, 0x85, 0x39, 0x23, 0x31,
+    0x4A, 0x83, 0x09, 0x73, 0x23, 0x31, 0x64, 0x39, 0x64, 0x39, 0xCC, 0x93, 0x85, 0x39, 0x64, 0x31, 0xE6, 0x49, 0x09, 0x7B, 0x4B, 0x73, 0x64, 0x39, 0x64, 0x39, 0x06, 0x52, 0x27, 0x52, 0xC6, 0x41, 0x85, 0x39, 0x07, 0x4A, 0xC5, 0x49, 0xE6, 0x49, 0x64, 0x39, 0xA5, 0x41, 0xA5, 0x41, 0x64, 0x39, 0x67, 0x62, 0x64, 0x39, 0x03, 0x31, 0xAC, 0x93, 0xCA, 0x72, 0x19, 0xF7, 0x46, 0x6A, 0x03, 0x31,
+    0xA8, 0x72, 0xE2, 0x30, 0xC8, 0x72, 0x4B, 0x7B, 0x6B, 0x8B, 0x84, 0x39, 0xC9, 0x62, 0x87, 0x5A, 0x47, 0x5A, 0x88, 0x62, 0xA8, 0x62, 0x06, 0x4A, 0x27, 0x52, 0x47, 0x5A, 0x88, 0x62, 0x06, 0x4A, 0x64, 0x29, 0x03, 0x21, 0xE2, 0x20, 0xE2, 0x20, 0x84, 0x39, 0x06, 0x4A, 0x64, 0x31, 0x44, 0x31, 0xE6, 0x49, 0x87, 0x62, 0xA8, 0x72, 0xA7, 0x6A, 0x49, 0x83, 0x44, 0x31, 0x46, 0x52, 0xA5, 0x41,
+    0x84, 0x41, 0x84, 0x39, 0x26, 0x52, 0x59, 0xFF, 0xA8, 0x72, 0x6C, 0x83, 0x84, 0x39, 0x44, 0x31, 0x43, 0x31, 0xE7, 0x49, 0x03, 0x29, 0xA8, 0x6A, 0x23, 0x29, 0x84, 0x41, 0x64, 0x39, 0x84, 0x39, 0x84, 0x39, 0x88, 0x5A, 0x64, 0x39, 0x44, 0x31, 0x0A, 0x73, 0x4B, 0x7B, 0xA5, 0x39, 0x84, 0x39, 0xA5, 0x41, 0x2A, 0x83, 0x85, 0x39, 0x64, 0x39, 0x69, 0x5A, 0x48, 0x5A, 0x85, 0x39, 0xA5, 0x39,
+    0xA5, 0x41, 0x92, 0xDD, 0xA5, 0x39, 0xC5, 0x41, 0xC5, 0x49, 0xAE, 0xB4, 0x06, 0x4A, 0x64, 0x39, 0xE9, 0x72, 0xE6, 0x51, 0xCC, 0x93, 0xCD, 0x8B, 0x52, 0xCD, 0xF9, 0xEE, 0x0A, 0x8B, 0x0A, 0x7B, 0x51, 0xD5, 0x85, 0x49, 0x8F, 0xAC, 0x4A, 0x7B, 0x06, 0x4A, 0x06, 0x4A, 0x27, 0x52, 0xE9, 0x6A, 0x47, 0x52, 0xC5, 0x41, 0xC8, 0x6A, 0x68, 0x5A, 0xE6, 0x49, 0x84, 0x39, 0x06, 0x4A, 0x06, 0x4A,
+    0x8E, 0x9C, 0x03, 0x21, 0x50, 0xC5, 0x59, 0xEF, 0x03, 0x29, 0x4B, 0x73, 0x2E, 0x94, 0x72, 0xDD, 0xFE, 0xFF, 0xE9, 0x7A, 0x71, 0xDD, 0xD3, 0xE5, 0x13, 0xF6, 0x84, 0x41, 0x2E, 0x84, 0x9A, 0xFF, 0xA7, 0x6A, 0x0C, 0x9C, 0xC5, 0x49, 0x78, 0xFF, 0xAB, 0x9B, 0x06, 0x52, 0x6B, 0x83, 0x07, 0x4A, 0xE2, 0x20, 0xA5, 0x41, 0x43, 0x31, 0x4A, 0x7B, 0x44, 0x31, 0x03, 0x29, 0x02, 0x29, 0x64, 0x39,
+    0x43, 0x31, 0x64, 0x39, 0x64, 0x39, 0x64, 0x39, 0xE6, 0x49, 0x44, 0x31, 0x69, 0x5A, 0x64, 0x39, 0x85, 0x39, 0xAB, 0x93, 0xC5, 0x41, 0xE6, 0x49, 0xE6, 0x49, 0xE6, 0x49, 0x6A, 0x83, 0x85, 0x39, 0x64, 0x31, 0x44, 0x31, 0x85, 0x39, 0x2A, 0x7B, 0x27, 0x52, 0xC9, 0x62, 0x85, 0x41, 0xA4, 0x41, 0x88, 0x6A, 0x4F, 0xB4, 0xD1, 0xB4, 0xA9, 0x6A, 0xA5, 0x49, 0xD1, 0xD4, 0x47, 0x6A, 0xED, 0x9B,
+    0x6F, 0xBC, 0x47, 0x5A, 0x2E, 0x9C, 0x6B, 0x8B, 0x44, 0x39, 0xE6, 0x49, 0x09, 0x73, 0x88, 0x5A, 0x47, 0x52, 0xA5, 0x41, 0xA8, 0x62, 0x26, 0x52, 0x27, 0x52, 0x06, 0x4A, 0x27, 0x52, 0x06, 0x4A, 0x63, 0x31, 0xA6, 0x6A, 0xE3, 0x20, 0x65, 0x39, 0xE5, 0x51, 0xA5, 0x41, 0x38, 0xF7, 0x65, 0x39, 0x47, 0x6A, 0xCA, 0xA3, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0xF6, 0x84, 0x39, 0xA4, 0x41, 0x0D, 0x8C,
+    0x8E, 0xAC, 0x64, 0x39, 0x06, 0x52, 0x92, 0xDD, 0x8B, 0x8B, 0xC5, 0x49, 0x64, 0x31, 0x03, 0x29, 0x6B, 0x7B, 0x84, 0x39, 0x8E, 0xA4, 0x44, 0x31, 0xE9, 0x6A, 0x23, 0x29, 0x64, 0x31, 0x26, 0x52, 0x47, 0x5A, 0x43, 0x31, 0x23, 0x29, 0x44, 0x31, 0x2E, 0x9C, 0xE5, 0x51, 0x85, 0x41, 0xA5, 0x39, 0xA5, 0x39, 0x4A, 0x7B, 0xA5, 0x41, 0x27, 0x52, 0x4E, 0xCC, 0x43, 0x39, 0x84, 0x39, 0x64, 0x39,
+    0x85, 0x39, 0x85, 0x41, 0xA5, 0x41, 0x23, 0x31, 0xA5, 0x41, 0x27, 0x52, 0x6B, 0x83, 0x64, 0x39, 0x47, 0x5A, 0xF0, 0xC4, 0xEA, 0x72, 0x89, 0x6A, 0x23, 0x39, 0xE6, 0x61, 0x0A, 0x83, 0xAC, 0x93, 0x84, 0x41, 0x8C, 0x8B, 0x63, 0x41, 0xAC, 0x8B, 0x44, 0x39, 0x07, 0x4A, 0xE6, 0x41, 0xA8, 0x62, 0xE6, 0x41, 0x88, 0x5A, 0xC5, 0x41, 0x84, 0x39, 0xA8, 0x62, 0x64, 0x39, 0x07, 0x4A, 0x07, 0x4A,
+    0x64, 0x39, 0xC2, 0x18, 0x03, 0x21, 0xE2, 0x20, 0x24, 0x29, 0x6F, 0x94, 0x6D, 0xA4, 0x44, 0x31, 0xE5, 0x51, 0x6D, 0xBC, 0x13, 0xEE, 0xAA, 0x9B, 0xCF, 0xBC, 0x85, 0x39, 0xEA, 0x72, 0xC5, 0x41, 0xCC, 0x8B, 0x44, 0x31, 0x46, 0x52, 0x30, 0xC5, 0x4A, 0x8B, 0xAB, 0x93, 0xA5, 0x39, 0x64, 0x39, 0x03, 0x21, 0x44, 0x29, 0x2A, 0x73, 0xE3, 0x20, 0x44, 0x31, 0xE2, 0x28, 0x03, 0x29, 0xCC, 0x8B,
+    0xE9, 0x6A, 0x64, 0x31, 0x43, 0x29, 0x44, 0x31, 0x6A, 0x83, 0x88, 0x6A, 0x47, 0x5A, 0x84, 0x41, 0x64, 0x39, 0x29, 0x7B, 0xA4, 0x41, 0x2A, 0x7B, 0x92, 0xFD, 0x43, 0x41, 0x06, 0x52, 0xA5, 0x39, 0xA5, 0x41, 0x64, 0x39, 0xC8, 0x6A, 0xA7, 0x62, 0x4B, 0x7B, 0x47, 0x62, 0x2D, 0xA4, 0x68, 0x5A, 0x85, 0x41, 0x7A, 0xFF, 0x89, 0x7A, 0xA4, 0x51, 0x04, 0x39, 0xE6, 0x49, 0xE9, 0x7A, 0x26, 0x62,
+    0x44, 0x31, 0xD0, 0xB4, 0x64, 0x41, 0xED, 0x9B, 0xE6, 0x51, 0x27, 0x52, 0xE5, 0x69, 0xC5, 0x41, 0xC5, 0x49, 0x06, 0x4A, 0xC5, 0x41, 0x06, 0x4A, 0x06, 0x4A, 0x23, 0x31, 0xA5, 0x41, 0xA5, 0x41, 0xE2, 0x20, 0xE2, 0x20, 0xC5, 0x39, 0xE2, 0x20, 0x4E, 0x9C, 0x64, 0x39, 0x23, 0x31, 0x64, 0x39, 0xE6, 0x51, 0xFD, 0xFF, 0xCB, 0x9B, 0x49, 0x8B, 0xAB, 0x93, 0x64, 0x39, 0x26, 0x5A, 0x84, 0x39,
+    0x23, 0x31, 0x24, 0x31, 0xAB, 0x83, 0x6E, 0xAC, 0x4A, 0x7B, 0x84, 0x39, 0x23, 0x29, 0x2A, 0x73, 0x02, 0x29, 0x23, 0x31, 0x03, 0x29, 0x23, 0x29, 0xE3, 0x28, 0x03, 0x29, 0x03, 0x29, 0x23, 0x29, 0xE9, 0x72, 0x44, 0x31, 0x85, 0x39, 0x64, 0x31, 0xE5, 0x49, 0x84, 0x41, 0x67, 0x6A, 0xC5, 0x49, 0x44, 0x31, 0x6B, 0x93, 0x65, 0x39, 0xEA, 0x72, 0x10, 0xED, 0x03, 0x41, 0x84, 0x39, 0x64, 0x39,
+    0x85, 0x39, 0x64, 0x39, 0x0E, 0x94, 0x85, 0x39, 0x2D, 0x9C, 0xED, 0x9B, 0x0E, 0x94, 0xA5, 0x41, 0x85, 0x49, 0x3A, 0xFF, 0x81, 0x28, 0xA9, 0x6A, 0x04, 0x31, 0x65, 0x39, 0xC2, 0x28, 0x0A, 0x7B, 0x43, 0x39, 0x2D, 0x9C, 0x24, 0x31, 0x0D, 0x9C, 0x48, 0x5A, 0x68, 0x5A, 0xE3, 0x28, 0xA6, 0x41, 0xA6, 0x41, 0x06, 0x4A, 0x85, 0x39, 0xA5, 0x39, 0x64, 0x39, 0x03, 0x29, 0x06, 0x4A, 0xC6, 0x41,
+    0xC2, 0x18, 0xE2, 0x20, 0xC2, 0x18, 0x05, 0x5A, 0xE3, 0x20, 0x84, 0x39, 0x44, 0x31, 0x03, 0x29, 0x09, 0x73, 0x26, 0x5A, 0x47, 0x5A, 0x26, 0x52, 0xC8, 0x6A, 0x88, 0x6A, 0x84, 0x39, 0x84, 0x39, 0x23, 0x29, 0x84, 0x39, 0xA5, 0x39, 0x26, 0x5A, 0xA5, 0x41, 0x43, 0x29, 0xE8, 0x6A, 0xE2, 0x28, 0x03, 0x21, 0x03, 0x29, 0x23, 0x29, 0x87, 0x6A, 0x43, 0x31, 0x44, 0x31, 0x03, 0x29, 0x44, 0x31,
+    0x47, 0x5A, 0x24, 0x31, 0x23, 0x29, 0x44, 0x31, 0x2C, 0xA4, 0xEB, 0xC3, 0x2D, 0xBC, 0xC8, 0x6A, 0x23, 0x29, 0x4B, 0x8B, 0x6F, 0xA4, 0x6A, 0x9B, 0xCD, 0xBB, 0x03, 0x39, 0x32, 0xBD, 0xE3, 0x28, 0x64, 0x39, 0x44, 0x31, 0x65, 0x31, 0x27, 0x62, 0xC6, 0x49, 0xC6, 0x49, 0xA5, 0x41, 0x0A, 0x73, 0x47, 0x62, 0x19, 0xF7, 0xE6, 0x49, 0x8F, 0xB4, 0xE3, 0x30, 0x03, 0x41, 0x31, 0xCD, 0xC9, 0x72,
+    0xE9, 0x6A, 0xC9, 0x72, 0x6C, 0x83, 0x2E, 0xA4, 0xA5, 0x41, 0xAC, 0x8B, 0x64, 0x39, 0x24, 0x29, 0x07, 0x4A, 0xA5, 0x39, 0xE9, 0x6A, 0xEA, 0x6A, 0x07, 0x4A, 0x44, 0x31, 0x85, 0x39, 0xC6, 0x41, 0xE3, 0x20, 0xE3, 0x20, 0xE2, 0x20, 0x40, 0x10, 0xA2, 0x18, 0x24, 0x29, 0x03, 0x29, 0x23, 0x29, 0x64, 0x31, 0xC5, 0x49, 0xC6, 0x41, 0x84, 0x39, 0x05, 0x5A, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31,
+    0x23, 0x29, 0xE9, 0x72, 0xC5, 0x41, 0x47, 0x5A, 0x06, 0x52, 0x23, 0x29, 0x23, 0x29, 0xE2, 0x20, 0x03, 0x29, 0x23, 0x29, 0x02, 0x29, 0x23, 0x31, 0x23, 0x29, 0x03, 0x29, 0x23, 0x29, 0x23, 0x29, 0x23, 0x29, 0x23, 0x31, 0x44, 0x31, 0x64, 0x39, 0x4A, 0x8B, 0x6E, 0xDC, 0x06, 0x62, 0xF6, 0xFE, 0x24, 0x31, 0x2A, 0x83, 0xED, 0x9B, 0x0E, 0xAC, 0x89, 0x92, 0xE2, 0x30, 0x44, 0x39, 0x44, 0x31,
+    0x85, 0x41, 0x65, 0x39, 0x64, 0x31, 0xC5, 0x49, 0xA5, 0x39, 0x4B, 0x8B, 0x44, 0x39, 0x8C, 0x8B, 0x2A, 0xA3, 0x90, 0xBC, 0xB0, 0x94, 0xC9, 0x7A, 0xE2, 0x30, 0x03, 0x29, 0xEC, 0x93, 0x85, 0x39, 0x27, 0x5A, 0x88, 0x6A, 0x28, 0x5A, 0x8B, 0x8B, 0x24, 0x29, 0x07, 0x52, 0xE6, 0x49, 0xE3, 0x20, 0x24, 0x29, 0x47, 0x52, 0x47, 0x52, 0x65, 0x31, 0x85, 0x39, 0x24, 0x29, 0xA5, 0x39, 0xA5, 0x39,
+    0x87, 0x52, 0xA8, 0x6A, 0xC2, 0x20, 0xE2, 0x20, 0xE2, 0x20, 0x02, 0x31, 0x87, 0x5A, 0x23, 0x29, 0x84, 0x39, 0xC5, 0x41, 0xA9, 0x62, 0x09, 0x7B, 0x26, 0x4A, 0x84, 0x39, 0x85, 0x39, 0x64, 0x31, 0xC8, 0x72, 0x23, 0x29, 0xC5, 0x41, 0xC5, 0x41, 0xC5, 0x41, 0x47, 0x52, 0x03, 0x29, 0xA5, 0x39, 0x64, 0x31, 0xA5, 0x39, 0xAC, 0x8B, 0x64, 0x39, 0x64, 0x39, 0x44, 0x31, 0x85, 0x39, 0x67, 0x5A,
+    0x23, 0x29, 0x44, 0x31, 0x43, 0x31, 0x03, 0x29, 0x2A, 0x7B, 0x43, 0x39, 0x09, 0x7B, 0x26, 0x5A, 0x03, 0x31, 0x87, 0x6A, 0x2E, 0xAC, 0x6F, 0xC4, 0x88, 0x8A, 0x03, 0x39, 0x6B, 0x83, 0x44, 0x31, 0x64, 0x39, 0xA5, 0x41, 0x27, 0x4A, 0xED, 0x9B, 0x28, 0x5A, 0xA7, 0x72, 0xC2, 0x38, 0x23, 0x41, 0x0A, 0x7B, 0xCD, 0xA3, 0xD5, 0xDD, 0x2F, 0xAC, 0xC3, 0x30, 0x28, 0x5A, 0xCF, 0xBC, 0x65, 0x39,
+    0x07, 0x52, 0xA5, 0x41, 0xC9, 0x6A, 0xC9, 0x72, 0x03, 0x29, 0xA6, 0x41, 0xC5, 0x41, 0xA8, 0x62, 0x44, 0x31, 0x24, 0x29, 0x65, 0x39, 0x23, 0x31, 0xC9, 0x6A, 0x44, 0x31, 0x44, 0x31, 0x85, 0x39, 0xA1, 0x18, 0x81, 0x10, 0xC2, 0x20, 0xC2, 0x18, 0x03, 0x21, 0x03, 0x29, 0x23, 0x31, 0x03, 0x29, 0x64, 0x39, 0xA5, 0x41, 0x49, 0x7B, 0xCC, 0x93, 0xEC, 0x83, 0xA5, 0x39, 0x64, 0x31, 0x23, 0x29,
+    0x88, 0x62, 0x43, 0x31, 0x84, 0x39, 0xA4, 0x39, 0x85, 0x39, 0x88, 0x5A, 0xE2, 0x20, 0xE2, 0x20, 0x24, 0x31, 0x26, 0x52, 0xA7, 0x6A, 0xE5, 0x49, 0x23, 0x29, 0x03, 0x29, 0x03, 0x29, 0xA8, 0x62, 0x23, 0x29, 0x44, 0x29, 0x43, 0x31, 0x64, 0x39, 0xC8, 0x72, 0xAA, 0xAB, 0x88, 0x6A, 0x22, 0x39, 0x23, 0x29, 0x06, 0x52, 0x06, 0x5A, 0x4F, 0xBC, 0x8C, 0x9B, 0x85, 0x51, 0xA4, 0x41, 0x64, 0x39,
+    0x84, 0x39, 0x85, 0x39, 0x44, 0x31, 0xEA, 0x6A, 0xA9, 0x62, 0x65, 0x39, 0x03, 0x39, 0xEA, 0x72, 0x81, 0x30, 0xC5, 0x41, 0x70, 0xB4, 0x68, 0x5A, 0x48, 0x5A, 0xE3, 0x30, 0x8E, 0xC4, 0x07, 0x52, 0xC6, 0x49, 0x28, 0x5A, 0xA6, 0x41, 0x48, 0x5A, 0x03, 0x29, 0xC6, 0x41, 0x85, 0x39, 0x23, 0x29, 0x45, 0x31, 0x24, 0x29, 0x03, 0x29, 0x03, 0x21, 0x03, 0x21, 0x03, 0x29, 0x65, 0x31, 0xC6, 0x41,
 };
 const lv_img_dsc_t ui_img_twinkels1_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_twinkels1_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_twinkels1_80_png_data
 };
 
@@ -11,113 +11,213 @@
 
 // IMAGE DATA: assets/Twinkels2_80.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_twinkels2_80_png_data[] = {
-    0xA5, 0x18, 0xFF, 0xCC, 0x39, 0xFF, 0xC6, 0x18, 0xFF, 0xC6, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x07, 0x21, 0xFF, 0x4E, 0x52, 0xFF, 0x06, 0x21, 0xFF, 0x07, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0x27, 0x29, 0xFF, 0x07, 0x21, 0xFF, 0x07, 0x29, 0xFF, 0x48, 0x31, 0xFF, 0x07, 0x21, 0xFF, 0x11, 0x6B, 0xFF, 0x07, 0x29, 0xFF, 0x27, 0x29, 0xFF, 0x27, 0x29, 0xFF, 0x48, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x92, 0x83, 0xFF, 0x48, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x27, 0x29, 0xFF, 0x50, 0x83, 0xFF, 0x68, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x67, 0x31, 0xFF, 0xCA, 0x41, 0xFF, 0x69, 0x31, 0xFF, 0xAA, 0x39, 0xFF, 0x69, 0x31, 0xFF, 0x69, 0x31, 0xFF, 0xCB, 0x41, 0xFF, 0x8B, 0x39, 0xFF, 0x6A, 0x39, 0xFF, 0xAB, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0xD3, 0x83, 0xFF, 0x8B, 0x39, 0xFF, 0x6B, 0x39, 0xFF, 0x4B, 0x31, 0xFF, 0x8D, 0x39, 0xFF, 0x2B, 0x31, 0xFF, 0x6C, 0x31, 0xFF, 0x2B, 0x31, 0xFF, 0x4B, 0x31, 0xFF, 0x4B, 0x31, 0xFF, 0x6B, 0x31, 0xFF, 0x92, 0x7B, 0xFF, 0x2A, 0x29, 0xFF, 0x29, 0x29, 0xFF, 0xAB, 0x39, 0xFF, 0x29, 0x29, 0xFF, 0x4B, 0x21, 0xFF, 0x6A, 0x29, 0xFF, 0x09, 0x21, 0xFF, 0x29, 0x21, 0xFF,
-    0x69, 0x29, 0xFF, 0xCC, 0x39, 0xFF, 0x10, 0x63, 0xFF, 0x49, 0x29, 0xFF, 0x8B, 0x31, 0xFF, 0x6A, 0x29, 0xFF, 0xAB, 0x31, 0xFF, 0x2D, 0x4A, 0xFF, 0xCC, 0x39, 0xFF, 0xED, 0x41, 0xFF, 0xAC, 0x39, 0xFF, 0xCC, 0x39, 0xFF, 0xCB, 0x39, 0xFF, 0xCB, 0x41, 0xFF, 0x48, 0x29, 0xFF, 0x8A, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0xEC, 0x41, 0xFF, 0xE6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0xAA, 0x39, 0xFF, 0xAA, 0x41, 0xFF, 0xE7, 0x28, 0xFF, 0x48, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0x8D, 0x5A, 0xFF, 0xD4, 0x83, 0xFF, 0x48, 0x31, 0xFF, 0xE7, 0x28, 0xFF, 0x28, 0x29, 0xFF, 0x07, 0x29, 0xFF, 0x0B, 0x4A, 0xFF, 0x2C, 0x4A, 0xFF, 0x48, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x30, 0x7B, 0xFF, 0x89, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x89, 0x41, 0xFF, 0xCA, 0x41, 0xFF, 0xCD, 0x62, 0xFF, 0x2D, 0x83, 0xFF, 0xA9, 0x41, 0xFF, 0xEA, 0x41, 0xFF, 0xA9, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0x54, 0xA4, 0xFF, 0x89, 0x39, 0xFF, 0xAA, 0x39, 0xFF, 0x69, 0x31, 0xFF, 0x54, 0x9C, 0xFF, 0xF1, 0x72, 0xFF, 0x49, 0x31, 0xFF, 0xCB, 0x49, 0xFF, 0x0C, 0x4A, 0xFF, 0xEC, 0x41, 0xFF, 0xB5, 0xAC, 0xFF, 0xCD, 0x41, 0xFF, 0x8C, 0x39, 0xFF, 0xCD, 0x41, 0xFF,
-    0x0E, 0x4A, 0xFF, 0xD1, 0x62, 0xFF, 0x8F, 0x39, 0xFF, 0xAC, 0x41, 0xFF, 0x8C, 0x39, 0xFF, 0x6B, 0x31, 0xFF, 0xED, 0x41, 0xFF, 0xD0, 0x5A, 0xFF, 0x4A, 0x31, 0xFF, 0x29, 0x29, 0xFF, 0x29, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0xD0, 0x62, 0xFF, 0x4A, 0x29, 0xFF, 0x28, 0x21, 0xFF, 0x49, 0x29, 0xFF, 0x89, 0x29, 0xFF, 0x69, 0x29, 0xFF, 0x2D, 0x42, 0xFF, 0x49, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0x6A, 0x29, 0xFF, 0x6A, 0x31, 0xFF, 0xB3, 0x73, 0xFF, 0xE7, 0x20, 0xFF, 0x49, 0x31, 0xFF, 0x6B, 0x31, 0xFF, 0xAB, 0x39, 0xFF, 0xCE, 0x5A, 0xFF, 0xA9, 0x31, 0xFF, 0x8A, 0x31, 0xFF, 0xA9, 0x31, 0xFF, 0x07, 0x21, 0xFF, 0xC5, 0x18, 0xFF, 0xE6, 0x20, 0xFF, 0x6A, 0x31, 0xFF, 0xE6, 0x20, 0xFF, 0xC6, 0x18, 0xFF, 0xE6, 0x20, 0xFF, 0x07, 0x29, 0xFF, 0x49, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0x07, 0x21, 0xFF, 0xE7, 0x20, 0xFF, 0x07, 0x29, 0xFF, 0x07, 0x29, 0xFF, 0xCA, 0x41, 0xFF, 0x27, 0x29, 0xFF, 0x27, 0x29, 0xFF, 0x27, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0x69, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x28, 0x29, 0xFF, 0x69, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x68, 0x39, 0xFF, 0x69, 0x39, 0xFF, 0x68, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0xA9, 0x39, 0xFF, 0x68, 0x39, 0xFF, 0xAA, 0x41, 0xFF,
-    0xA9, 0x41, 0xFF, 0x68, 0x39, 0xFF, 0xCA, 0x41, 0xFF, 0xCA, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0x69, 0x31, 0xFF, 0x49, 0x31, 0xFF, 0x6A, 0x39, 0xFF, 0x8A, 0x39, 0xFF, 0x6A, 0x39, 0xFF, 0x8A, 0x39, 0xFF, 0x6A, 0x39, 0xFF, 0xAC, 0x41, 0xFF, 0x8C, 0x39, 0xFF, 0xAD, 0x41, 0xFF, 0x4C, 0x39, 0xFF, 0xCE, 0x41, 0xFF, 0x6C, 0x31, 0xFF, 0xAE, 0x41, 0xFF, 0x6C, 0x39, 0xFF, 0x8D, 0x39, 0xFF, 0x8C, 0x39, 0xFF, 0x8B, 0x39, 0xFF, 0x4B, 0x31, 0xFF, 0x8B, 0x39, 0xFF, 0x10, 0x42, 0xFF, 0x6B, 0x31, 0xFF, 0xAC, 0x31, 0xFF, 0xAD, 0x29, 0xFF, 0x8B, 0x21, 0xFF, 0x6A, 0x29, 0xFF, 0x49, 0x29, 0xFF, 0xAC, 0x39, 0xFF, 0x49, 0x29, 0xFF, 0x49, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x8B, 0x31, 0xFF, 0x8B, 0x31, 0xFF, 0xAC, 0x31, 0xFF, 0xEE, 0x39, 0xFF, 0x0D, 0x42, 0xFF, 0xCF, 0x41, 0xFF, 0x6B, 0x31, 0xFF, 0xAB, 0x39, 0xFF, 0xAA, 0x39, 0xFF, 0x8A, 0x31, 0xFF, 0x8A, 0x31, 0xFF, 0x69, 0x31, 0xFF, 0x07, 0x21, 0xFF, 0xC6, 0x18, 0xFF, 0xE7, 0x20, 0xFF, 0xAC, 0x39, 0xFF, 0xE6, 0x20, 0xFF, 0x07, 0x21, 0xFF, 0xE7, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0x49, 0x31, 0xFF, 0x28, 0x31, 0xFF, 0xE7, 0x20, 0xFF, 0x27, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0xEA, 0x41, 0xFF, 0x89, 0x39, 0xFF, 0x28, 0x31, 0xFF,
-    0x48, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x68, 0x31, 0xFF, 0x8A, 0x39, 0xFF, 0x27, 0x31, 0xFF, 0x6B, 0x39, 0xFF, 0x89, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0x50, 0x7B, 0xFF, 0x68, 0x39, 0xFF, 0x68, 0x31, 0xFF, 0x88, 0x39, 0xFF, 0xA9, 0x39, 0xFF, 0x12, 0x7B, 0xFF, 0xA9, 0x49, 0xFF, 0x2A, 0x62, 0xFF, 0xA9, 0x41, 0xFF, 0xC9, 0x41, 0xFF, 0xD1, 0x93, 0xFF, 0x89, 0x41, 0xFF, 0xAB, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0x8A, 0x39, 0xFF, 0xEC, 0x49, 0xFF, 0x49, 0x31, 0xFF, 0xAB, 0x41, 0xFF, 0xAB, 0x41, 0xFF, 0xED, 0x49, 0xFF, 0x11, 0x73, 0xFF, 0x4B, 0x31, 0xFF, 0x0F, 0x52, 0xFF, 0xAE, 0x41, 0xFF, 0xB0, 0x49, 0xFF, 0x72, 0x62, 0xFF, 0xAD, 0x41, 0xFF, 0x8D, 0x39, 0xFF, 0x8C, 0x39, 0xFF, 0x8C, 0x39, 0xFF, 0x11, 0x6B, 0xFF, 0x8C, 0x39, 0xFF, 0x8B, 0x31, 0xFF, 0xAC, 0x39, 0xFF, 0xAC, 0x31, 0xFF, 0xB1, 0x52, 0xFF, 0x3B, 0x4B, 0xFF, 0xAD, 0x31, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x6E, 0x4A, 0xFF, 0x6A, 0x29, 0xFF, 0x49, 0x29, 0xFF, 0x8B, 0x31, 0xFF, 0x8A, 0x31, 0xFF, 0x2D, 0x4A, 0xFF, 0x8B, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x39, 0xFF, 0xF7, 0x59, 0xFF, 0x32, 0x6B, 0xFF, 0xAB, 0x31, 0xFF, 0x8A, 0x31, 0xFF, 0xCB, 0x39, 0xFF, 0x8A, 0x31, 0xFF, 0xCB, 0x39, 0xFF,
-    0x07, 0x21, 0xFF, 0xC6, 0x18, 0xFF, 0x08, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x07, 0x29, 0xFF, 0x07, 0x29, 0xFF, 0xE7, 0x28, 0xFF, 0x27, 0x29, 0xFF, 0x07, 0x21, 0xFF, 0x07, 0x29, 0xFF, 0x48, 0x31, 0xFF, 0x27, 0x29, 0xFF, 0x27, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x68, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0xA9, 0x39, 0xFF, 0xA9, 0x39, 0xFF, 0xA9, 0x41, 0xFF, 0x88, 0x39, 0xFF, 0xEA, 0x49, 0xFF, 0xA9, 0x39, 0xFF, 0xCA, 0x41, 0xFF, 0xA9, 0x39, 0xFF, 0x8A, 0x39, 0xFF, 0x8A, 0x39, 0xFF, 0xAA, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0x6A, 0x39, 0xFF, 0x8A, 0x39, 0xFF, 0xED, 0x49, 0xFF, 0xAC, 0x39, 0xFF, 0x8D, 0x41, 0xFF, 0xCD, 0x41, 0xFF, 0xD0, 0x49, 0xFF, 0xAF, 0x41, 0xFF, 0xB0, 0x49, 0xFF, 0xD2, 0x51, 0xFF, 0xAF, 0x41, 0xFF, 0x4C, 0x39, 0xFF, 0x8D, 0x39, 0xFF, 0xAD, 0x41, 0xFF, 0x8D, 0x39, 0xFF, 0x8F, 0x52, 0xFF, 0xAE, 0x31, 0xFF, 0xAC, 0x31, 0xFF, 0x4F, 0x42, 0xFF, 0xD3, 0x4A, 0xFF, 0x72, 0x2A, 0xFF, 0x8E, 0x31, 0xFF, 0x6A, 0x29, 0xFF, 0x4A, 0x29, 0xFF,
-    0x48, 0x29, 0xFF, 0xCC, 0x31, 0xFF, 0x6A, 0x29, 0xFF, 0x8A, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0x6B, 0x31, 0xFF, 0xAC, 0x31, 0xFF, 0xCE, 0x31, 0xFF, 0x4B, 0x29, 0xFF, 0xCF, 0x41, 0xFF, 0xAC, 0x39, 0xFF, 0xAB, 0x39, 0xFF, 0xEC, 0x39, 0xFF, 0x8A, 0x31, 0xFF, 0xCC, 0x39, 0xFF, 0x0C, 0x42, 0xFF, 0x6A, 0x31, 0xFF, 0xE7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0x07, 0x21, 0xFF, 0xC6, 0x20, 0xFF, 0xCD, 0x41, 0xFF, 0x07, 0x21, 0xFF, 0x08, 0x29, 0xFF, 0x07, 0x29, 0xFF, 0x4C, 0x52, 0xFF, 0x2D, 0x4A, 0xFF, 0x07, 0x29, 0xFF, 0x28, 0x31, 0xFF, 0x28, 0x31, 0xFF, 0x27, 0x29, 0xFF, 0xCE, 0x62, 0xFF, 0x2B, 0x52, 0xFF, 0x07, 0x29, 0xFF, 0x89, 0x39, 0xFF, 0xA9, 0x39, 0xFF, 0x48, 0x31, 0xFF, 0x88, 0x39, 0xFF, 0x48, 0x39, 0xFF, 0x47, 0x31, 0xFF, 0x8D, 0x5A, 0xFF, 0xA9, 0x41, 0xFF, 0xA9, 0x41, 0xFF, 0xC9, 0x41, 0xFF, 0xCA, 0x49, 0xFF, 0x70, 0x83, 0xFF, 0xC9, 0x41, 0xFF, 0xE9, 0x51, 0xFF, 0xA9, 0x41, 0xFF, 0xD1, 0x93, 0xFF, 0x70, 0x83, 0xFF, 0xA9, 0x41, 0xFF, 0xCB, 0x41, 0xFF, 0xAA, 0x41, 0xFF, 0xCA, 0x41, 0xFF, 0x8D, 0x5A, 0xFF, 0xAA, 0x41, 0xFF, 0x2C, 0x52, 0xFF, 0xEC, 0x49, 0xFF, 0xCC, 0x49, 0xFF, 0xD1, 0x6A, 0xFF, 0xAD, 0x41, 0xFF, 0xAF, 0x49, 0xFF, 0xAF, 0x41, 0xFF,
-    0x11, 0x52, 0xFF, 0xF2, 0x51, 0xFF, 0x13, 0x5A, 0xFF, 0xAF, 0x41, 0xFF, 0xF0, 0x49, 0xFF, 0xF1, 0x62, 0xFF, 0x8D, 0x39, 0xFF, 0x8C, 0x39, 0xFF, 0x6B, 0x31, 0xFF, 0x6A, 0x31, 0xFF, 0xB0, 0x5A, 0xFF, 0xED, 0x39, 0xFF, 0x8C, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0x6A, 0x31, 0xFF, 0xAF, 0x52, 0xFF, 0x69, 0x29, 0xFF, 0x49, 0x29, 0xFF, 0x6A, 0x29, 0xFF, 0x8A, 0x31, 0xFF, 0x6E, 0x52, 0xFF, 0x8B, 0x31, 0xFF, 0x8B, 0x39, 0xFF, 0xED, 0x41, 0xFF, 0x4A, 0x29, 0xFF, 0xED, 0x41, 0xFF, 0x90, 0x5A, 0xFF, 0x8A, 0x31, 0xFF, 0xAB, 0x39, 0xFF, 0xCC, 0x41, 0xFF, 0x2D, 0x4A, 0xFF, 0x2D, 0x4A, 0xFF, 0xE7, 0x20, 0xFF, 0x4F, 0x52, 0xFF, 0xE7, 0x20, 0xFF, 0x07, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0x8B, 0x39, 0xFF, 0x2E, 0x52, 0xFF, 0xE7, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0x07, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0x56, 0x9C, 0xFF, 0x07, 0x29, 0xFF, 0x07, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0xF1, 0x72, 0xFF, 0xB0, 0x72, 0xFF, 0x48, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x69, 0x31, 0xFF, 0x68, 0x39, 0xFF, 0x93, 0x93, 0xFF, 0x88, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0x47, 0x31, 0xFF, 0x91, 0xA3, 0xFF, 0xC9, 0x49, 0xFF, 0xA9, 0x41, 0xFF, 0x88, 0x39, 0xFF,
-    0xC9, 0x41, 0xFF, 0xEA, 0x49, 0xFF, 0x34, 0xA4, 0xFF, 0xAA, 0x41, 0xFF, 0xAA, 0x41, 0xFF, 0xAA, 0x39, 0xFF, 0x8A, 0x39, 0xFF, 0x71, 0x83, 0xFF, 0xCB, 0x41, 0xFF, 0xAC, 0x41, 0xFF, 0x2F, 0x52, 0xFF, 0xAC, 0x41, 0xFF, 0xB4, 0x93, 0xFF, 0xEE, 0x51, 0xFF, 0xF1, 0x51, 0xFF, 0xD0, 0x49, 0xFF, 0xD0, 0x49, 0xFF, 0x35, 0x5A, 0xFF, 0xD0, 0x49, 0xFF, 0xD0, 0x49, 0xFF, 0xAE, 0x39, 0xFF, 0x0F, 0x4A, 0xFF, 0x6C, 0x31, 0xFF, 0x71, 0x6B, 0xFF, 0x8B, 0x39, 0xFF, 0x0E, 0x3A, 0xFF, 0x6B, 0x29, 0xFF, 0x8B, 0x31, 0xFF, 0x0F, 0x63, 0xFF, 0xAC, 0x31, 0xFF, 0x49, 0x29, 0xFF, 0x69, 0x29, 0xFF, 0x49, 0x29, 0xFF, 0x6A, 0x29, 0xFF, 0x51, 0x73, 0xFF, 0x8A, 0x31, 0xFF, 0x6B, 0x31, 0xFF, 0x8B, 0x31, 0xFF, 0xCC, 0x39, 0xFF, 0xEF, 0x62, 0xFF, 0x6A, 0x29, 0xFF, 0xCC, 0x39, 0xFF, 0xCD, 0x39, 0xFF, 0xAB, 0x39, 0xFF, 0xCF, 0x62, 0xFF, 0xCC, 0x41, 0xFF, 0x0D, 0x4A, 0xFF, 0xCC, 0x41, 0xFF, 0x48, 0x31, 0xFF, 0x07, 0x21, 0xFF, 0x28, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0xEB, 0x41, 0xFF, 0x0E, 0x4A, 0xFF, 0x08, 0x29, 0xFF, 0x49, 0x31, 0xFF, 0x08, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0x49, 0x31, 0xFF, 0xE7, 0x28, 0xFF, 0x49, 0x31, 0xFF, 0x07, 0x29, 0xFF,
-    0x0B, 0x4A, 0xFF, 0x48, 0x31, 0xFF, 0x15, 0x94, 0xFF, 0x8A, 0x39, 0xFF, 0xEB, 0x49, 0xFF, 0xAA, 0x41, 0xFF, 0x69, 0x39, 0xFF, 0x49, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x2F, 0x6B, 0xFF, 0x47, 0x31, 0xFF, 0xA9, 0x41, 0xFF, 0xC9, 0x49, 0xFF, 0xAC, 0x62, 0xFF, 0xCD, 0x6A, 0xFF, 0x09, 0x5A, 0xFF, 0x2B, 0x5A, 0xFF, 0xA9, 0x41, 0xFF, 0xB1, 0x93, 0xFF, 0xEA, 0x49, 0xFF, 0xCA, 0x49, 0xFF, 0x8A, 0x41, 0xFF, 0xAA, 0x41, 0xFF, 0x6E, 0x62, 0xFF, 0x8A, 0x41, 0xFF, 0x0D, 0x52, 0xFF, 0x0E, 0x52, 0xFF, 0x12, 0x73, 0xFF, 0xF1, 0x7A, 0xFF, 0x52, 0x62, 0xFF, 0xF1, 0x51, 0xFF, 0x13, 0x5A, 0xFF, 0x72, 0x62, 0xFF, 0xF1, 0x49, 0xFF, 0xF2, 0x51, 0xFF, 0xCF, 0x49, 0xFF, 0xAF, 0x41, 0xFF, 0x8E, 0x39, 0xFF, 0xAC, 0x39, 0xFF, 0x8C, 0x31, 0xFF, 0xCD, 0x39, 0xFF, 0x6F, 0x52, 0xFF, 0x6B, 0x29, 0xFF, 0x4A, 0x31, 0xFF, 0xED, 0x39, 0xFF, 0x8B, 0x31, 0xFF, 0xB0, 0x5A, 0xFF, 0x6A, 0x29, 0xFF, 0x69, 0x29, 0xFF, 0x8A, 0x31, 0xFF, 0xAF, 0x5A, 0xFF, 0x8B, 0x31, 0xFF, 0xAC, 0x39, 0xFF, 0xCC, 0x39, 0xFF, 0x6B, 0x31, 0xFF, 0x6E, 0x52, 0xFF, 0x49, 0x29, 0xFF, 0x8C, 0x31, 0xFF, 0xCC, 0x39, 0xFF, 0xCC, 0x39, 0xFF, 0x4F, 0x52, 0xFF, 0x4E, 0x4A, 0xFF, 0xEE, 0x41, 0xFF, 0xED, 0x41, 0xFF,
-    0xE7, 0x20, 0xFF, 0xA6, 0x18, 0xFF, 0xE7, 0x20, 0xFF, 0xAB, 0x41, 0xFF, 0x08, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0x4E, 0x52, 0xFF, 0x69, 0x31, 0xFF, 0x49, 0x31, 0xFF, 0x08, 0x29, 0xFF, 0x28, 0x31, 0xFF, 0x4D, 0x5A, 0xFF, 0x49, 0x39, 0xFF, 0x28, 0x31, 0xFF, 0x28, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0xF4, 0x8B, 0xFF, 0x68, 0x39, 0xFF, 0x89, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0x68, 0x39, 0xFF, 0x33, 0xAC, 0xFF, 0x68, 0x39, 0xFF, 0xA8, 0x41, 0xFF, 0xA8, 0x41, 0xFF, 0xE9, 0x49, 0xFF, 0x53, 0xC4, 0xFF, 0x2F, 0x73, 0xFF, 0xC9, 0x49, 0xFF, 0xC9, 0x49, 0xFF, 0xE9, 0x49, 0xFF, 0xB3, 0xBC, 0xFF, 0xA9, 0x41, 0xFF, 0xEB, 0x49, 0xFF, 0xCA, 0x49, 0xFF, 0xAA, 0x41, 0xFF, 0x11, 0x73, 0xFF, 0xCB, 0x49, 0xFF, 0x0E, 0x52, 0xFF, 0xEE, 0x51, 0xFF, 0x0E, 0x52, 0xFF, 0xB4, 0x8B, 0xFF, 0x10, 0x52, 0xFF, 0xB1, 0x49, 0xFF, 0xF3, 0x51, 0xFF, 0x5A, 0x72, 0xFF, 0x35, 0x7B, 0xFF, 0x14, 0x52, 0xFF, 0xF2, 0x51, 0xFF, 0x8F, 0x41, 0xFF, 0xAE, 0x41, 0xFF, 0x93, 0x73, 0xFF, 0x8C, 0x31, 0xFF, 0x8C, 0x31, 0xFF, 0x8C, 0x31, 0xFF, 0x6B, 0x31, 0xFF, 0x51, 0x6B, 0xFF, 0x6B, 0x31, 0xFF, 0x8B, 0x31, 0xFF, 0x6A, 0x29, 0xFF, 0x6A, 0x29, 0xFF,
-    0xCC, 0x39, 0xFF, 0x8A, 0x31, 0xFF, 0x8A, 0x31, 0xFF, 0x8A, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0x11, 0x63, 0xFF, 0x8B, 0x31, 0xFF, 0x6B, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0x10, 0x63, 0xFF, 0x0D, 0x4A, 0xFF, 0x2F, 0x4A, 0xFF, 0x4F, 0x4A, 0xFF, 0x30, 0x4A, 0xFF, 0x2E, 0x4A, 0xFF, 0xC7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0x8B, 0x39, 0xFF, 0xC7, 0x18, 0xFF, 0xE8, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0x49, 0x31, 0xFF, 0x07, 0x29, 0xFF, 0x49, 0x31, 0xFF, 0x08, 0x29, 0xFF, 0x49, 0x31, 0xFF, 0xAA, 0x39, 0xFF, 0x69, 0x39, 0xFF, 0x08, 0x29, 0xFF, 0x6D, 0x52, 0xFF, 0x69, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0x69, 0x39, 0xFF, 0xEA, 0x49, 0xFF, 0xA9, 0x41, 0xFF, 0x88, 0x41, 0xFF, 0x88, 0x41, 0xFF, 0x8D, 0x62, 0xFF, 0xF1, 0x8B, 0xFF, 0x0B, 0x5A, 0xFF, 0x4F, 0x8B, 0xFF, 0x4F, 0x7B, 0xFF, 0xC9, 0x49, 0xFF, 0x2A, 0x52, 0xFF, 0xC9, 0x49, 0xFF, 0x8D, 0x62, 0xFF, 0x2B, 0x52, 0xFF, 0xEB, 0x49, 0xFF, 0xEB, 0x49, 0xFF, 0xCB, 0x49, 0xFF, 0x4D, 0x5A, 0xFF, 0xCB, 0x49, 0xFF, 0xED, 0x51, 0xFF, 0x0E, 0x52, 0xFF, 0x4F, 0x5A, 0xFF, 0xB1, 0x62, 0xFF, 0xEF, 0x49, 0xFF, 0xF2, 0x51, 0xFF, 0x38, 0x6A, 0xFF,
-    0x7E, 0x92, 0xFF, 0xF4, 0x61, 0xFF, 0x13, 0x5A, 0xFF, 0xF6, 0x69, 0xFF, 0xF0, 0x49, 0xFF, 0xCF, 0x41, 0xFF, 0x6D, 0x31, 0xFF, 0xCD, 0x39, 0xFF, 0x4F, 0x52, 0xFF, 0x6B, 0x29, 0xFF, 0xCC, 0x39, 0xFF, 0x6E, 0x4A, 0xFF, 0x8B, 0x31, 0xFF, 0x2D, 0x42, 0xFF, 0x89, 0x29, 0xFF, 0x8A, 0x31, 0xFF, 0x69, 0x29, 0xFF, 0x8E, 0x52, 0xFF, 0xCB, 0x39, 0xFF, 0x8A, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0xF0, 0x62, 0xFF, 0x49, 0x29, 0xFF, 0x8B, 0x31, 0xFF, 0xAB, 0x39, 0xFF, 0xCD, 0x39, 0xFF, 0x70, 0x52, 0xFF, 0x6B, 0x31, 0xFF, 0xEF, 0x41, 0xFF, 0xEE, 0x41, 0xFF, 0x0F, 0x4A, 0xFF, 0x0D, 0x4A, 0xFF, 0xE7, 0x20, 0xFF, 0x49, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x21, 0xFF, 0x08, 0x29, 0xFF, 0xAB, 0x39, 0xFF, 0x49, 0x31, 0xFF, 0xE8, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0x86, 0x10, 0xFF, 0x0D, 0x4A, 0xFF, 0xEB, 0x49, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x33, 0x94, 0xFF, 0x8A, 0x41, 0xFF, 0x48, 0x31, 0xFF, 0x48, 0x31, 0xFF, 0xEA, 0x41, 0xFF, 0x69, 0x39, 0xFF, 0x30, 0x73, 0xFF, 0xCA, 0x41, 0xFF, 0x6E, 0x5A, 0xFF, 0x68, 0x39, 0xFF, 0x6F, 0x83, 0xFF, 0xC9, 0x49, 0xFF, 0xAD, 0x62, 0xFF, 0xC9, 0x49, 0xFF, 0xC9, 0x49, 0xFF, 0x13, 0xD5, 0xFF, 0xCD, 0x72, 0xFF, 0xE9, 0x49, 0xFF,
-    0x2B, 0x5A, 0xFF, 0xED, 0x6A, 0xFF, 0xB2, 0xAC, 0xFF, 0x0A, 0x52, 0xFF, 0xEA, 0x49, 0xFF, 0xEB, 0x49, 0xFF, 0x0B, 0x52, 0xFF, 0x92, 0x8B, 0xFF, 0xCB, 0x49, 0xFF, 0x2D, 0x5A, 0xFF, 0x2E, 0x52, 0xFF, 0xB1, 0x6A, 0xFF, 0x34, 0x83, 0xFF, 0x76, 0x6A, 0xFF, 0x39, 0x83, 0xFF, 0xD9, 0x82, 0xFF, 0x3F, 0xF4, 0xFF, 0x18, 0x72, 0xFF, 0x14, 0x5A, 0xFF, 0x73, 0x5A, 0xFF, 0xCF, 0x41, 0xFF, 0x93, 0x7B, 0xFF, 0xAE, 0x41, 0xFF, 0xAE, 0x39, 0xFF, 0xAC, 0x39, 0xFF, 0xAC, 0x39, 0xFF, 0x32, 0x6B, 0xFF, 0x8B, 0x31, 0xFF, 0xEC, 0x39, 0xFF, 0x8A, 0x31, 0xFF, 0x49, 0x29, 0xFF, 0x11, 0x63, 0xFF, 0x4E, 0x4A, 0xFF, 0x8A, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0xEC, 0x41, 0xFF, 0x11, 0x63, 0xFF, 0x8B, 0x31, 0xFF, 0x6A, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0xF0, 0x5A, 0xFF, 0x0F, 0x4A, 0xFF, 0x2F, 0x4A, 0xFF, 0x8B, 0x39, 0xFF, 0x30, 0x4A, 0xFF, 0x0E, 0x4A, 0xFF, 0x53, 0x5A, 0xFF, 0x50, 0x52, 0xFF, 0x86, 0x18, 0xFF, 0x92, 0x52, 0xFF, 0xCC, 0x41, 0xFF, 0xC7, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xE8, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0x8B, 0x39, 0xFF, 0x09, 0x29, 0xFF, 0x28, 0x29, 0xFF, 0x6A, 0x39, 0xFF, 0x6A, 0x39, 0xFF, 0x91, 0x5A, 0xFF, 0x6A, 0x39, 0xFF, 0x69, 0x31, 0xFF, 0x49, 0x31, 0xFF,
-    0xAB, 0x41, 0xFF, 0x28, 0x29, 0xFF, 0x69, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x89, 0x39, 0xFF, 0xA9, 0x41, 0xFF, 0x68, 0x39, 0xFF, 0xF4, 0x93, 0xFF, 0xA8, 0x41, 0xFF, 0xEA, 0x49, 0xFF, 0xE9, 0x49, 0xFF, 0xE9, 0x49, 0xFF, 0x91, 0x8B, 0xFF, 0xE9, 0x51, 0xFF, 0x0A, 0x5A, 0xFF, 0x0A, 0x5A, 0xFF, 0x09, 0x52, 0xFF, 0xC9, 0x49, 0xFF, 0x57, 0xC5, 0xFF, 0x0A, 0x52, 0xFF, 0xEA, 0x49, 0xFF, 0x2C, 0x5A, 0xFF, 0x0C, 0x52, 0xFF, 0x8E, 0x62, 0xFF, 0x0C, 0x4A, 0xFF, 0x2D, 0x62, 0xFF, 0xED, 0x51, 0xFF, 0x55, 0x83, 0xFF, 0x10, 0x52, 0xFF, 0xDA, 0x72, 0xFF, 0x94, 0x51, 0xFF, 0x5E, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x8A, 0xFF, 0x36, 0x6A, 0xFF, 0x77, 0x62, 0xFF, 0xB1, 0x49, 0xFF, 0xEE, 0x41, 0xFF, 0x58, 0x94, 0xFF, 0xEE, 0x41, 0xFF, 0xAC, 0x39, 0xFF, 0x8B, 0x31, 0xFF, 0xCC, 0x39, 0xFF, 0x8A, 0x31, 0xFF, 0x8A, 0x31, 0xFF, 0x89, 0x29, 0xFF, 0x49, 0x29, 0xFF, 0x69, 0x29, 0xFF, 0x8A, 0x29, 0xFF, 0xAB, 0x31, 0xFF, 0xCC, 0x39, 0xFF, 0x0D, 0x4A, 0xFF, 0x6B, 0x29, 0xFF, 0xCC, 0x39, 0xFF, 0xAB, 0x31, 0xFF, 0x6F, 0x52, 0xFF, 0x2F, 0x4A, 0xFF, 0x2F, 0x4A, 0xFF, 0x50, 0x4A, 0xFF, 0x8B, 0x31, 0xFF, 0x0F, 0x42, 0xFF, 0x32, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0x5A, 0xFF,
-    0xE8, 0x20, 0xFF, 0x08, 0x21, 0xFF, 0xE8, 0x20, 0xFF, 0x29, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0x97, 0x6B, 0xFF, 0x2A, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0x8A, 0x39, 0xFF, 0x08, 0x31, 0xFF, 0xB2, 0x62, 0xFF, 0xCC, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0x6A, 0x39, 0xFF, 0xCB, 0x41, 0xFF, 0xB0, 0x62, 0xFF, 0x54, 0x83, 0xFF, 0x2C, 0x52, 0xFF, 0xEC, 0x49, 0xFF, 0x89, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x77, 0xAC, 0xFF, 0x33, 0x94, 0xFF, 0x12, 0x94, 0xFF, 0xEA, 0x51, 0xFF, 0x2B, 0x5A, 0xFF, 0xD3, 0x93, 0xFF, 0x0D, 0x83, 0xFF, 0x2A, 0x62, 0xFF, 0x2A, 0x5A, 0xFF, 0x2A, 0x5A, 0xFF, 0x4A, 0x62, 0xFF, 0xB3, 0xB4, 0xFF, 0x4B, 0x5A, 0xFF, 0xEB, 0x49, 0xFF, 0x0B, 0x52, 0xFF, 0xB2, 0xED, 0xFF, 0x54, 0x9C, 0xFF, 0x2B, 0x5A, 0xFF, 0x8D, 0x72, 0xFF, 0x2C, 0x62, 0xFF, 0x56, 0x8B, 0xFF, 0xB8, 0xAC, 0xFF, 0x50, 0x5A, 0xFF, 0xF3, 0x51, 0xFF, 0x7B, 0x82, 0xFF, 0xDC, 0x9A, 0xFF, 0xD9, 0x9B, 0xFF, 0x34, 0x5A, 0xFF, 0x12, 0x52, 0xFF, 0xB3, 0x62, 0xFF, 0xAE, 0x39, 0xFF, 0xB6, 0x7B, 0xFF, 0x17, 0x7C, 0xFF, 0xED, 0x41, 0xFF, 0xF1, 0x5A, 0xFF, 0xED, 0x41, 0xFF, 0x8E, 0x4A, 0xFF, 0x15, 0x7C, 0xFF, 0xAE, 0x52, 0xFF, 0x4A, 0x29, 0xFF, 0xAA, 0x31, 0xFF,
-    0x0C, 0x42, 0xFF, 0x52, 0x6B, 0xFF, 0x6E, 0x52, 0xFF, 0xCB, 0x39, 0xFF, 0xCC, 0x39, 0xFF, 0xEC, 0x39, 0xFF, 0x0C, 0x42, 0xFF, 0xB0, 0x52, 0xFF, 0x0F, 0x42, 0xFF, 0x2F, 0x4A, 0xFF, 0x50, 0x4A, 0xFF, 0xAB, 0x39, 0xFF, 0x14, 0x84, 0xFF, 0x8C, 0x39, 0xFF, 0x51, 0x52, 0xFF, 0x8F, 0x52, 0xFF, 0x08, 0x29, 0xFF, 0xE8, 0x20, 0xFF, 0x29, 0x29, 0xFF, 0x8D, 0x39, 0xFF, 0xCD, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0x08, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0xB2, 0x5A, 0xFF, 0x2A, 0x31, 0xFF, 0x4A, 0x31, 0xFF, 0x69, 0x31, 0xFF, 0x6A, 0x31, 0xFF, 0x2E, 0x52, 0xFF, 0xCC, 0x41, 0xFF, 0x49, 0x31, 0xFF, 0xCC, 0x41, 0xFF, 0x8E, 0x5A, 0xFF, 0x69, 0x39, 0xFF, 0x12, 0x73, 0xFF, 0xEB, 0x49, 0xFF, 0xAA, 0x41, 0xFF, 0xCA, 0x41, 0xFF, 0xC9, 0x41, 0xFF, 0xB6, 0xD4, 0xFF, 0x0A, 0x52, 0xFF, 0x90, 0x8B, 0xFF, 0x4F, 0x83, 0xFF, 0x6B, 0x6A, 0xFF, 0x73, 0xC4, 0xFF, 0x31, 0xAC, 0xFF, 0x8F, 0x8B, 0xFF, 0xCC, 0x72, 0xFF, 0x11, 0x9C, 0xFF, 0x95, 0xE5, 0xFF, 0x4C, 0x62, 0xFF, 0xCA, 0x49, 0xFF, 0xEB, 0x51, 0xFF, 0xAE, 0x6A, 0xFF, 0xD4, 0x9B, 0xFF, 0x6C, 0x6A, 0xFF, 0x91, 0xD4, 0xFF, 0xEE, 0xB3, 0xFF, 0x93, 0x8B, 0xFF, 0x35, 0xA4, 0xFF, 0x70, 0x62, 0xFF, 0x90, 0x49, 0xFF, 0x55, 0x6A, 0xFF,
-    0xF5, 0x59, 0xFF, 0xF7, 0x9B, 0xFF, 0x34, 0x5A, 0xFF, 0xAF, 0x41, 0xFF, 0x34, 0x73, 0xFF, 0xEE, 0x41, 0xFF, 0x57, 0x8C, 0xFF, 0xCC, 0x39, 0xFF, 0xF2, 0x62, 0xFF, 0xAC, 0x39, 0xFF, 0x35, 0x5B, 0xFF, 0xD4, 0x83, 0xFF, 0xAB, 0x39, 0xFF, 0x6C, 0x29, 0xFF, 0x8A, 0x29, 0xFF, 0xAA, 0x31, 0xFF, 0xB3, 0x6B, 0xFF, 0xAF, 0x5A, 0xFF, 0xAB, 0x31, 0xFF, 0xAA, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0xF0, 0x5A, 0xFF, 0x2D, 0x42, 0xFF, 0x2F, 0x4A, 0xFF, 0x30, 0x4A, 0xFF, 0x6F, 0x4A, 0xFF, 0xF0, 0x5A, 0xFF, 0x6A, 0x31, 0xFF, 0x4E, 0x4A, 0xFF, 0xAB, 0x39, 0xFF, 0xB0, 0x5A, 0xFF, 0x6E, 0x52, 0xFF, 0x8B, 0x39, 0xFF, 0x09, 0x29, 0xFF, 0x49, 0x31, 0xFF, 0x6A, 0x31, 0xFF, 0xC8, 0x20, 0xFF, 0x6B, 0x39, 0xFF, 0x09, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0xAC, 0x39, 0xFF, 0x6A, 0x31, 0xFF, 0x6A, 0x39, 0xFF, 0x29, 0x31, 0xFF, 0xAB, 0x39, 0xFF, 0x56, 0x94, 0xFF, 0x29, 0x31, 0xFF, 0x08, 0x29, 0xFF, 0xAB, 0x39, 0xFF, 0xAF, 0x62, 0xFF, 0x6A, 0x39, 0xFF, 0xAA, 0x41, 0xFF, 0x89, 0x41, 0xFF, 0x11, 0x73, 0xFF, 0x89, 0x41, 0xFF, 0x71, 0x9B, 0xFF, 0x09, 0x52, 0xFF, 0x71, 0x83, 0xFF, 0xEC, 0x7A, 0xFF, 0x4E, 0x9B, 0xFF, 0x12, 0xDD, 0xFF, 0xAD, 0xAB, 0xFF, 0x2D, 0x93, 0xFF,
-    0xEC, 0x7A, 0xFF, 0x29, 0x62, 0xFF, 0xF5, 0xED, 0xFF, 0x4C, 0x62, 0xFF, 0xEB, 0x51, 0xFF, 0x0B, 0x52, 0xFF, 0x6C, 0x62, 0xFF, 0x54, 0xAC, 0xFF, 0x2B, 0x62, 0xFF, 0x6D, 0xA3, 0xFF, 0x4F, 0x9B, 0xFF, 0xF5, 0x93, 0xFF, 0xB0, 0x72, 0xFF, 0x0E, 0x52, 0xFF, 0xF1, 0x51, 0xFF, 0x56, 0x83, 0xFF, 0x32, 0x5A, 0xFF, 0x31, 0x5A, 0xFF, 0xD0, 0x49, 0xFF, 0x96, 0x83, 0xFF, 0x0F, 0x4A, 0xFF, 0xEF, 0x41, 0xFF, 0xAD, 0x39, 0xFF, 0x0D, 0x42, 0xFF, 0xCC, 0x39, 0xFF, 0x37, 0x53, 0xFF, 0xCC, 0x39, 0xFF, 0xCB, 0x39, 0xFF, 0xAB, 0x31, 0xFF, 0x8A, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0xAB, 0x31, 0xFF, 0x32, 0x63, 0xFF, 0xAA, 0x31, 0xFF, 0xCB, 0x39, 0xFF, 0xCB, 0x39, 0xFF, 0x6F, 0x4A, 0xFF, 0xED, 0x41, 0xFF, 0xAC, 0x39, 0xFF, 0x30, 0x4A, 0xFF, 0x92, 0x4A, 0xFF, 0x0D, 0x42, 0xFF, 0x6F, 0x4A, 0xFF, 0x0D, 0x42, 0xFF, 0x90, 0x52, 0xFF, 0xEB, 0x41, 0xFF, 0xAF, 0x5A, 0xFF, 0xAF, 0x5A, 0xFF, 0x29, 0x29, 0xFF, 0xAD, 0x39, 0xFF, 0x6A, 0x31, 0xFF, 0xE9, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0x6A, 0x31, 0xFF, 0x8B, 0x39, 0xFF, 0x8C, 0x39, 0xFF, 0xE9, 0x28, 0xFF, 0x4A, 0x31, 0xFF, 0xCD, 0x41, 0xFF, 0x4B, 0x31, 0xFF, 0x29, 0x31, 0xFF, 0xAB, 0x41, 0xFF, 0xAC, 0x41, 0xFF, 0xB0, 0x5A, 0xFF,
-    0x4A, 0x31, 0xFF, 0x49, 0x39, 0xFF, 0xAA, 0x41, 0xFF, 0xCB, 0x49, 0xFF, 0xF3, 0x8B, 0xFF, 0x2C, 0x52, 0xFF, 0x0B, 0x4A, 0xFF, 0xA9, 0x41, 0xFF, 0x4C, 0x62, 0xFF, 0x2A, 0x62, 0xFF, 0x4A, 0x6A, 0xFF, 0x0C, 0x8B, 0xFF, 0x90, 0xD4, 0xFF, 0xFD, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0xCD, 0xB3, 0xFF, 0x4D, 0x93, 0xFF, 0x0C, 0x7B, 0xFF, 0xD5, 0xDD, 0xFF, 0x6C, 0x6A, 0xFF, 0x2C, 0x5A, 0xFF, 0x2C, 0x5A, 0xFF, 0xD5, 0xB4, 0xFF, 0x32, 0x83, 0xFF, 0x4F, 0x83, 0xFF, 0xAD, 0x72, 0xFF, 0xAF, 0x72, 0xFF, 0xB1, 0x6A, 0xFF, 0x74, 0x83, 0xFF, 0x0F, 0x52, 0xFF, 0x53, 0x62, 0xFF, 0xF0, 0x51, 0xFF, 0xB4, 0x6A, 0xFF, 0x95, 0x62, 0xFF, 0x31, 0x52, 0xFF, 0x10, 0x52, 0xFF, 0x72, 0x5A, 0xFF, 0x98, 0x94, 0xFF, 0xED, 0x39, 0xFF, 0x0E, 0x42, 0xFF, 0x16, 0x6B, 0xFF, 0x53, 0x5B, 0xFF, 0xD5, 0x6B, 0xFF, 0xCB, 0x39, 0xFF, 0x2E, 0x42, 0xFF, 0xAB, 0x31, 0xFF, 0xD0, 0x52, 0xFF, 0xB4, 0x6B, 0xFF, 0xEB, 0x31, 0xFF, 0xCB, 0x31, 0xFF, 0xEB, 0x39, 0xFF, 0xB4, 0x6B, 0xFF, 0xED, 0x39, 0xFF, 0x0D, 0x42, 0xFF, 0xCC, 0x41, 0xFF, 0xEF, 0x39, 0xFF, 0x73, 0x73, 0xFF, 0x4E, 0x4A, 0xFF, 0x91, 0x52, 0xFF, 0xED, 0x41, 0xFF, 0x4E, 0x4A, 0xFF, 0x2D, 0x4A, 0xFF, 0x90, 0x52, 0xFF, 0xD0, 0x5A, 0xFF,
-    0x09, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0x2A, 0x29, 0xFF, 0x4B, 0x31, 0xFF, 0x2A, 0x29, 0xFF, 0x4A, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0x0F, 0x4A, 0xFF, 0x0A, 0x29, 0xFF, 0x6B, 0x31, 0xFF, 0x4A, 0x31, 0xFF, 0x6B, 0x39, 0xFF, 0x30, 0x4A, 0xFF, 0x4A, 0x31, 0xFF, 0x8B, 0x41, 0xFF, 0xAB, 0x41, 0xFF, 0xB1, 0x62, 0xFF, 0x4A, 0x39, 0xFF, 0x08, 0x31, 0xFF, 0xAF, 0x62, 0xFF, 0x8A, 0x41, 0xFF, 0xAA, 0x41, 0xFF, 0xCB, 0x7A, 0xFF, 0xCE, 0x72, 0xFF, 0x0A, 0x52, 0xFF, 0xD4, 0xAC, 0xFF, 0x4A, 0x72, 0xFF, 0x2E, 0x93, 0xFF, 0x4D, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xBB, 0xFF, 0x0D, 0x8B, 0xFF, 0x69, 0x62, 0xFF, 0x15, 0xDE, 0xFF, 0xB4, 0xCD, 0xFF, 0x0B, 0x52, 0xFF, 0x0B, 0x52, 0xFF, 0x0C, 0x52, 0xFF, 0x13, 0xAC, 0xFF, 0x0B, 0x5A, 0xFF, 0x2D, 0x5A, 0xFF, 0x2E, 0x5A, 0xFF, 0x8D, 0x49, 0xFF, 0x0F, 0x52, 0xFF, 0x10, 0x52, 0xFF, 0x52, 0x5A, 0xFF, 0xF3, 0x59, 0xFF, 0xBA, 0xA3, 0xFF, 0xB7, 0x72, 0xFF, 0x53, 0x5A, 0xFF, 0x33, 0x5A, 0xFF, 0xFF, 0xE5, 0xFF, 0x0F, 0x42, 0xFF, 0xEE, 0x41, 0xFF, 0x0F, 0x4A, 0xFF, 0xED, 0x41, 0xFF, 0xD6, 0x83, 0xFF, 0x2D, 0x42, 0xFF, 0x0E, 0x42, 0xFF, 0xEC, 0x39, 0xFF, 0xEC, 0x39, 0xFF, 0xD6, 0x7B, 0xFF, 0x8F, 0x52, 0xFF,
-    0xEB, 0x31, 0xFF, 0xEB, 0x39, 0xFF, 0xB0, 0x5A, 0xFF, 0x2E, 0x42, 0xFF, 0x0E, 0x42, 0xFF, 0x0D, 0x42, 0xFF, 0xED, 0x39, 0xFF, 0x73, 0x6B, 0xFF, 0x50, 0x4A, 0xFF, 0xED, 0x39, 0xFF, 0xF2, 0x5A, 0xFF, 0x74, 0x73, 0xFF, 0xD1, 0x62, 0xFF, 0xF3, 0x6A, 0xFF, 0x54, 0x73, 0xFF, 0x90, 0x5A, 0xFF, 0xC7, 0x20, 0xFF, 0xB4, 0x5A, 0xFF, 0xB3, 0x5A, 0xFF, 0x0A, 0x29, 0xFF, 0x2A, 0x29, 0xFF, 0x6B, 0x39, 0xFF, 0x2A, 0x31, 0xFF, 0x17, 0x6B, 0xFF, 0x2A, 0x29, 0xFF, 0x8C, 0x39, 0xFF, 0x4B, 0x31, 0xFF, 0x4A, 0x31, 0xFF, 0x7A, 0x7B, 0xFF, 0x8B, 0x39, 0xFF, 0x6B, 0x39, 0xFF, 0x2A, 0x29, 0xFF, 0xED, 0x49, 0xFF, 0xB1, 0x62, 0xFF, 0x1F, 0xE6, 0xFF, 0xAF, 0x62, 0xFF, 0x0F, 0x6B, 0xFF, 0x0B, 0x52, 0xFF, 0x2C, 0x52, 0xFF, 0x36, 0xB4, 0xFF, 0x90, 0x8B, 0xFF, 0x2A, 0x5A, 0xFF, 0x6C, 0x6A, 0xFF, 0xAC, 0x7A, 0xFF, 0x57, 0xED, 0xFF, 0xD1, 0xFD, 0xFF, 0xD5, 0xFE, 0xFF, 0x10, 0xBC, 0xFF, 0x4E, 0x93, 0xFF, 0xEA, 0x7A, 0xFF, 0xF5, 0xCC, 0xFF, 0x90, 0x9B, 0xFF, 0x2C, 0x5A, 0xFF, 0x0B, 0x52, 0xFF, 0xEB, 0x59, 0xFF, 0x95, 0xBC, 0xFF, 0xAD, 0x72, 0xFF, 0x2D, 0x52, 0xFF, 0x71, 0x62, 0xFF, 0xBB, 0xCD, 0xFF, 0x98, 0xB4, 0xFF, 0xBF, 0xAB, 0xFF, 0x98, 0x61, 0xFF, 0x7B, 0x82, 0xFF,
-    0x7D, 0xF5, 0xFF, 0x5F, 0xCC, 0xFF, 0x3A, 0x8B, 0xFF, 0x12, 0x4A, 0xFF, 0xF4, 0x6A, 0xFF, 0x10, 0x4A, 0xFF, 0x57, 0x7B, 0xFF, 0x18, 0xAD, 0xFF, 0x2E, 0x4A, 0xFF, 0x10, 0x42, 0xFF, 0x33, 0x42, 0xFF, 0x2E, 0x42, 0xFF, 0x95, 0x94, 0xFF, 0x13, 0x63, 0xFF, 0x0E, 0x3A, 0xFF, 0xCB, 0x31, 0xFF, 0x0C, 0x3A, 0xFF, 0x98, 0x94, 0xFF, 0x8F, 0x52, 0xFF, 0x4E, 0x42, 0xFF, 0x2E, 0x42, 0xFF, 0x10, 0x4A, 0xFF, 0x0E, 0x42, 0xFF, 0x75, 0x84, 0xFF, 0xF4, 0x5A, 0xFF, 0xEE, 0x39, 0xFF, 0xD2, 0x5A, 0xFF, 0x97, 0x7B, 0xFF, 0xF4, 0x83, 0xFF, 0xDB, 0x8B, 0xFF, 0x1A, 0x7B, 0xFF, 0x99, 0x93, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xA9, 0x20, 0xFF, 0x90, 0x5A, 0xFF, 0x6C, 0x39, 0xFF, 0x4B, 0x31, 0xFF, 0x8C, 0x5A, 0xFF, 0xAC, 0x39, 0xFF, 0x2B, 0x31, 0xFF, 0xCE, 0x41, 0xFF, 0x8C, 0x39, 0xFF, 0x4B, 0x31, 0xFF, 0xCC, 0x41, 0xFF, 0x8C, 0x39, 0xFF, 0xAC, 0x41, 0xFF, 0x4B, 0x39, 0xFF, 0xCD, 0x49, 0xFF, 0x0E, 0x52, 0xFF, 0x0F, 0x52, 0xFF, 0xEE, 0x51, 0xFF, 0x8A, 0x41, 0xFF, 0xEC, 0x51, 0xFF, 0xAE, 0x62, 0xFF, 0x0C, 0x5A, 0xFF, 0x59, 0xEE, 0xFF, 0xEA, 0x51, 0xFF, 0x0F, 0x7B, 0xFF, 0x8E, 0x9B, 0xFF, 0xAD, 0x82, 0xFF, 0x2F, 0xCC, 0xFF, 0x8E, 0xAB, 0xFF, 0xEC, 0x8A, 0xFF,
-    0xCD, 0x7A, 0xFF, 0x6B, 0x72, 0xFF, 0xCD, 0x7A, 0xFF, 0x91, 0x93, 0xFF, 0x2D, 0x5A, 0xFF, 0x0B, 0x52, 0xFF, 0x6E, 0x6A, 0xFF, 0x34, 0xAC, 0xFF, 0xF2, 0xAB, 0xFF, 0xD0, 0x72, 0xFF, 0x1D, 0xAC, 0xFF, 0x74, 0x8B, 0xFF, 0x7C, 0xD5, 0xFF, 0x3E, 0xA3, 0xFF, 0x5A, 0x8A, 0xFF, 0xFE, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xD4, 0xFF, 0x5D, 0xAB, 0xFF, 0x1F, 0x8B, 0xFF, 0x3A, 0x83, 0xFF, 0x7C, 0x9B, 0xFF, 0x9C, 0xAD, 0xFF, 0x50, 0x4A, 0xFF, 0x15, 0x6B, 0xFF, 0x5E, 0x74, 0xFF, 0x90, 0x52, 0xFF, 0xBC, 0xA5, 0xFF, 0x17, 0x5B, 0xFF, 0x70, 0x3A, 0xFF, 0x90, 0x4A, 0xFF, 0x0E, 0x3A, 0xFF, 0x78, 0x84, 0xFF, 0xAF, 0x52, 0xFF, 0x4F, 0x4A, 0xFF, 0xEE, 0x39, 0xFF, 0xF4, 0x5A, 0xFF, 0x8F, 0x4A, 0xFF, 0x70, 0x42, 0xFF, 0xDF, 0x44, 0xFF, 0x7F, 0x6C, 0xFF, 0x51, 0x42, 0xFF, 0xB4, 0x73, 0xFF, 0xF4, 0x62, 0xFF, 0xB8, 0x6A, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xBA, 0x6B, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0x0A, 0x29, 0xFF, 0xE9, 0x20, 0xFF, 0x4B, 0x29, 0xFF, 0x2A, 0x29, 0xFF, 0x6F, 0x5A, 0xFF, 0xAD, 0x39, 0xFF, 0x2B, 0x29, 0xFF, 0x10, 0x4A, 0xFF, 0xAE, 0x41, 0xFF, 0xAD, 0x41, 0xFF, 0xAD, 0x41, 0xFF, 0x6C, 0x39, 0xFF, 0xB5, 0x8B, 0xFF, 0x4B, 0x31, 0xFF,
-    0xAD, 0x41, 0xFF, 0x4C, 0x39, 0xFF, 0x90, 0x5A, 0xFF, 0xB7, 0x83, 0xFF, 0x8B, 0x39, 0xFF, 0x8B, 0x41, 0xFF, 0xB5, 0x8B, 0xFF, 0x0E, 0x83, 0xFF, 0x16, 0xD5, 0xFF, 0x8A, 0x41, 0xFF, 0xEB, 0x51, 0xFF, 0xB1, 0xA3, 0xFF, 0xB4, 0xBC, 0xFF, 0x97, 0xF5, 0xFF, 0xAC, 0x7A, 0xFF, 0xAD, 0x72, 0xFF, 0x4D, 0x62, 0xFF, 0x6F, 0x93, 0xFF, 0x37, 0xF6, 0xFF, 0x2C, 0x62, 0xFF, 0x91, 0x62, 0xFF, 0x2C, 0x5A, 0xFF, 0x93, 0x93, 0xFF, 0x91, 0x93, 0xFF, 0x17, 0xDE, 0xFF, 0x76, 0x93, 0xFF, 0xD1, 0x82, 0xFF, 0x77, 0xAC, 0xFF, 0xBB, 0xBC, 0xFF, 0x52, 0x62, 0xFF, 0x55, 0x62, 0xFF, 0x9A, 0x82, 0xFF, 0xDD, 0xA2, 0xFF, 0x9C, 0xAB, 0xFF, 0xB7, 0x83, 0xFF, 0x36, 0x73, 0xFF, 0x92, 0x5A, 0xFF, 0x72, 0x52, 0xFF, 0xFE, 0xAD, 0xFF, 0xF4, 0x62, 0xFF, 0x1A, 0x7C, 0xFF, 0x93, 0x4A, 0xFF, 0x71, 0x42, 0xFF, 0x2F, 0x3A, 0xFF, 0xB0, 0x42, 0xFF, 0x2E, 0x3A, 0xFF, 0xF3, 0x52, 0xFF, 0x14, 0x53, 0xFF, 0x6F, 0x42, 0xFF, 0x4E, 0x42, 0xFF, 0x4F, 0x4A, 0xFF, 0x91, 0x5A, 0xFF, 0x0F, 0x3A, 0xFF, 0x2E, 0x42, 0xFF, 0xF4, 0x4A, 0xFF, 0x5A, 0x43, 0xFF, 0x36, 0x5B, 0xFF, 0x0F, 0x4A, 0xFF, 0x91, 0x52, 0xFF, 0xF2, 0x5A, 0xFF, 0xB2, 0x5A, 0xFF, 0xB3, 0x62, 0xFF, 0xF4, 0x6A, 0xFF, 0xF1, 0x62, 0xFF,
-    0x87, 0x20, 0xFF, 0xEE, 0x41, 0xFF, 0xE9, 0x20, 0xFF, 0x2A, 0x29, 0xFF, 0x0A, 0x29, 0xFF, 0x0A, 0x31, 0xFF, 0xB3, 0x6A, 0xFF, 0x4C, 0x31, 0xFF, 0x2C, 0x31, 0xFF, 0x2B, 0x31, 0xFF, 0x6D, 0x39, 0xFF, 0x4C, 0x31, 0xFF, 0x8D, 0x41, 0xFF, 0x8D, 0x39, 0xFF, 0x8E, 0x41, 0xFF, 0xD4, 0x6A, 0xFF, 0x11, 0x52, 0xFF, 0xCD, 0x49, 0xFF, 0x70, 0x62, 0xFF, 0x3B, 0xB5, 0xFF, 0x58, 0x94, 0xFF, 0x90, 0x62, 0xFF, 0x6F, 0x5A, 0xFF, 0x6F, 0x62, 0xFF, 0x6D, 0x62, 0xFF, 0xF3, 0x9B, 0xFF, 0x5A, 0x8B, 0xFF, 0x30, 0x7B, 0xFF, 0x0C, 0x62, 0xFF, 0x16, 0xCD, 0xFF, 0xB5, 0xCC, 0xFF, 0x2D, 0x6A, 0xFF, 0xB0, 0x72, 0xFF, 0xEE, 0x7A, 0xFF, 0x54, 0xCD, 0xFF, 0x75, 0xAC, 0xFF, 0x70, 0x6A, 0xFF, 0x4C, 0x5A, 0xFF, 0x4C, 0x62, 0xFF, 0xB4, 0xC4, 0xFF, 0xD2, 0xA3, 0xFF, 0x77, 0xFD, 0xFF, 0x16, 0xF5, 0xFF, 0x2E, 0x6A, 0xFF, 0x38, 0xAC, 0xFF, 0x17, 0x83, 0xFF, 0x32, 0x62, 0xFF, 0x32, 0x6A, 0xFF, 0xF7, 0x82, 0xFF, 0x34, 0x83, 0xFF, 0xF4, 0x6A, 0xFF, 0x11, 0x52, 0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x94, 0xFF, 0xB3, 0x5A, 0xFF, 0x70, 0x4A, 0xFF, 0x5A, 0x84, 0xFF, 0xFE, 0xA6, 0xFF, 0x8F, 0x42, 0xFF, 0xB0, 0x42, 0xFF, 0x96, 0x6B, 0xFF, 0x5B, 0x7C, 0xFF, 0x11, 0x5B, 0xFF,
-    0x0C, 0x3A, 0xFF, 0x6D, 0x4A, 0xFF, 0x51, 0x63, 0xFF, 0x96, 0x84, 0xFF, 0x4F, 0x42, 0xFF, 0x4E, 0x4A, 0xFF, 0xB0, 0x52, 0xFF, 0x13, 0x63, 0xFF, 0xD5, 0x7B, 0xFF, 0x6F, 0x4A, 0xFF, 0xF2, 0x62, 0xFF, 0x13, 0x63, 0xFF, 0xB1, 0x5A, 0xFF, 0x32, 0x6B, 0xFF, 0x32, 0x6B, 0xFF, 0x52, 0x83, 0xFF, 0xE8, 0x28, 0xFF, 0x0A, 0x29, 0xFF, 0x0E, 0x4A, 0xFF, 0x10, 0x4A, 0xFF, 0x0A, 0x29, 0xFF, 0x0A, 0x29, 0xFF, 0xAD, 0x41, 0xFF, 0x8D, 0x39, 0xFF, 0x2C, 0x31, 0xFF, 0x30, 0x4A, 0xFF, 0xD4, 0x6A, 0xFF, 0x51, 0x5A, 0xFF, 0xB3, 0x62, 0xFF, 0xAF, 0x49, 0xFF, 0xF0, 0x51, 0xFF, 0x4D, 0x31, 0xFF, 0x4E, 0x39, 0xFF, 0x52, 0x5A, 0xFF, 0x0F, 0x52, 0xFF, 0x8D, 0x41, 0xFF, 0x0F, 0x4A, 0xFF, 0xF6, 0x8B, 0xFF, 0x2D, 0x5A, 0xFF, 0x6E, 0x5A, 0xFF, 0x4D, 0x5A, 0xFF, 0x74, 0xA4, 0xFF, 0xD0, 0x72, 0xFF, 0x4D, 0x62, 0xFF, 0x4D, 0x62, 0xFF, 0x0F, 0x83, 0xFF, 0x33, 0xA4, 0xFF, 0xCB, 0x51, 0xFF, 0xAE, 0x72, 0xFF, 0xCD, 0x82, 0xFF, 0xB3, 0xC4, 0xFF, 0x71, 0x83, 0xFF, 0x6E, 0x6A, 0xFF, 0x2C, 0x5A, 0xFF, 0xCF, 0x72, 0xFF, 0xD6, 0xB4, 0xFF, 0x50, 0x8B, 0xFF, 0x10, 0x93, 0xFF, 0x16, 0xB4, 0xFF, 0xBE, 0xF6, 0xFF, 0x56, 0x83, 0xFF, 0x3C, 0x8B, 0xFF, 0x53, 0x6A, 0xFF, 0x51, 0x5A, 0xFF,
-    0xD3, 0x72, 0xFF, 0xD3, 0x6A, 0xFF, 0xF4, 0x6A, 0xFF, 0x9A, 0x83, 0xFF, 0xBD, 0xB5, 0xFF, 0x13, 0x6B, 0xFF, 0xB4, 0x62, 0xFF, 0x11, 0x5B, 0xFF, 0x78, 0x7C, 0xFF, 0x99, 0x7C, 0xFF, 0x54, 0x53, 0xFF, 0x8F, 0x42, 0xFF, 0xF1, 0x5A, 0xFF, 0xFA, 0x94, 0xFF, 0xD3, 0x6B, 0xFF, 0x4D, 0x42, 0xFF, 0xD0, 0x5A, 0xFF, 0xAF, 0x52, 0xFF, 0xCF, 0x5A, 0xFF, 0x6E, 0x4A, 0xFF, 0x6F, 0x4A, 0xFF, 0x6E, 0x4A, 0xFF, 0x53, 0x6B, 0xFF, 0x93, 0x73, 0xFF, 0x92, 0x4A, 0xFF, 0xD0, 0x52, 0xFF, 0x54, 0x6B, 0xFF, 0xD0, 0x5A, 0xFF, 0x32, 0x6B, 0xFF, 0xD1, 0x62, 0xFF, 0xF0, 0x62, 0xFF, 0x0F, 0x63, 0xFF, 0xAC, 0x41, 0xFF, 0xA8, 0x20, 0xFF, 0x2C, 0x31, 0xFF, 0xEA, 0x28, 0xFF, 0xCF, 0x41, 0xFF, 0x2B, 0x29, 0xFF, 0x6D, 0x39, 0xFF, 0x50, 0x39, 0xFF, 0xD0, 0x49, 0xFF, 0x52, 0x52, 0xFF, 0xB0, 0x41, 0xFF, 0x72, 0x5A, 0xFF, 0xD7, 0x51, 0xFF, 0x94, 0x5A, 0xFF, 0x73, 0x5A, 0xFF, 0x6E, 0x39, 0xFF, 0x6E, 0x39, 0xFF, 0xB3, 0x62, 0xFF, 0x11, 0x5A, 0xFF, 0x6C, 0x39, 0xFF, 0xAD, 0x41, 0xFF, 0x30, 0x52, 0xFF, 0x2F, 0x52, 0xFF, 0xB2, 0x6A, 0xFF, 0x0C, 0x4A, 0xFF, 0x32, 0x7B, 0xFF, 0xF3, 0x93, 0xFF, 0x6D, 0x62, 0xFF, 0x6F, 0x6A, 0xFF, 0xEB, 0x51, 0xFF, 0x54, 0xAC, 0xFF, 0x0B, 0x62, 0xFF,
-    0xEF, 0x7A, 0xFF, 0x51, 0x8B, 0xFF, 0xAD, 0x7A, 0xFF, 0x18, 0xBD, 0xFF, 0x2D, 0x62, 0xFF, 0x4C, 0x62, 0xFF, 0xAE, 0x72, 0xFF, 0x94, 0xBC, 0xFF, 0x71, 0x93, 0xFF, 0x8E, 0x72, 0xFF, 0xD0, 0x7A, 0xFF, 0x3B, 0xE6, 0xFF, 0xFB, 0xD5, 0xFF, 0x91, 0x6A, 0xFF, 0x52, 0x62, 0xFF, 0x56, 0x8B, 0xFF, 0x91, 0x62, 0xFF, 0x78, 0x83, 0xFF, 0xB1, 0x62, 0xFF, 0x2E, 0x4A, 0xFF, 0x16, 0x84, 0xFF, 0x71, 0x52, 0xFF, 0x6F, 0x4A, 0xFF, 0x93, 0x6B, 0xFF, 0xB8, 0x84, 0xFF, 0x11, 0x53, 0xFF, 0x31, 0x53, 0xFF, 0xAF, 0x4A, 0xFF, 0xD4, 0x73, 0xFF, 0x30, 0x5B, 0xFF, 0x6E, 0x42, 0xFF, 0x95, 0x63, 0xFF, 0x4D, 0x42, 0xFF, 0xCF, 0x52, 0xFF, 0xEF, 0x5A, 0xFF, 0xCF, 0x52, 0xFF, 0x8F, 0x52, 0xFF, 0x6E, 0x4A, 0xFF, 0xD0, 0x5A, 0xFF, 0x14, 0x84, 0xFF, 0xB0, 0x52, 0xFF, 0xD0, 0x52, 0xFF, 0x54, 0x6B, 0xFF, 0xB0, 0x52, 0xFF, 0x10, 0x63, 0xFF, 0xCF, 0x5A, 0xFF, 0x72, 0x6B, 0xFF, 0x0F, 0x63, 0xFF, 0x6B, 0x39, 0xFF, 0x0A, 0x21, 0xFF, 0xB8, 0x5A, 0xFF, 0x2C, 0x31, 0xFF, 0x0B, 0x29, 0xFF, 0x4C, 0x31, 0xFF, 0x8F, 0x39, 0xFF, 0xDA, 0x62, 0xFF, 0x92, 0x41, 0xFF, 0x4F, 0x31, 0xFF, 0xD1, 0x49, 0xFF, 0x13, 0x52, 0xFF, 0xD3, 0x51, 0xFF, 0x11, 0x39, 0xFF, 0x54, 0x52, 0xFF, 0xD1, 0x49, 0xFF,
-    0x6F, 0x39, 0xFF, 0xB0, 0x49, 0xFF, 0x9F, 0xA4, 0xFF, 0x70, 0x41, 0xFF, 0xAD, 0x41, 0xFF, 0xEE, 0x49, 0xFF, 0x91, 0x62, 0xFF, 0xB7, 0x8B, 0xFF, 0xED, 0x51, 0xFF, 0xED, 0x51, 0xFF, 0x75, 0xA4, 0xFF, 0xCB, 0x51, 0xFF, 0x2C, 0x62, 0xFF, 0xEC, 0x61, 0xFF, 0x18, 0xD6, 0xFF, 0xEA, 0x51, 0xFF, 0x6E, 0x6A, 0xFF, 0x0F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x62, 0xFF, 0x50, 0x8B, 0xFF, 0x4D, 0x62, 0xFF, 0xAE, 0x7A, 0xFF, 0xB5, 0xCC, 0xFF, 0x2F, 0x83, 0xFF, 0x8E, 0x6A, 0xFF, 0xF0, 0x7A, 0xFF, 0x5F, 0xFF, 0xFF, 0x98, 0xDD, 0xFF, 0x91, 0x6A, 0xFF, 0x1B, 0x83, 0xFF, 0x38, 0xA4, 0xFF, 0x6F, 0x5A, 0xFF, 0x57, 0xAC, 0xFF, 0x53, 0x73, 0xFF, 0x97, 0x9C, 0xFF, 0x17, 0x73, 0xFF, 0x90, 0x52, 0xFF, 0xF1, 0x52, 0xFF, 0x7A, 0x95, 0xFF, 0x15, 0x6C, 0xFF, 0x76, 0x64, 0xFF, 0xF5, 0x5B, 0xFF, 0x19, 0x9D, 0xFF, 0xBB, 0xDE, 0xFF, 0x71, 0x63, 0xFF, 0xD0, 0x52, 0xFF, 0x10, 0x5B, 0xFF, 0xCF, 0x52, 0xFF, 0xFC, 0xEE, 0xFF, 0xCF, 0x52, 0xFF, 0x93, 0x6B, 0xFF, 0xB0, 0x52, 0xFF, 0xF4, 0x6A, 0xFF, 0xD2, 0x73, 0xFF, 0xD0, 0x5A, 0xFF, 0x33, 0x63, 0xFF, 0x11, 0x63, 0xFF, 0x72, 0x73, 0xFF, 0xF0, 0x62, 0xFF, 0x51, 0x6B, 0xFF, 0xEF, 0x62, 0xFF, 0x10, 0x63, 0xFF, 0x0F, 0x63, 0xFF,
-    0x4B, 0x31, 0xFF, 0xEA, 0x20, 0xFF, 0xAD, 0x39, 0xFF, 0xEB, 0x20, 0xFF, 0x55, 0x4A, 0xFF, 0x2C, 0x31, 0xFF, 0x4D, 0x31, 0xFF, 0x0D, 0x31, 0xFF, 0xB8, 0x7B, 0xFF, 0x5C, 0x73, 0xFF, 0xD2, 0x49, 0xFF, 0x13, 0x52, 0xFF, 0x92, 0x41, 0xFF, 0x5F, 0x9C, 0xFF, 0xFC, 0x72, 0xFF, 0xD9, 0x6A, 0xFF, 0x13, 0x52, 0xFF, 0xB1, 0x49, 0xFF, 0xDF, 0xCD, 0xFF, 0x9E, 0x7B, 0xFF, 0x6F, 0x41, 0xFF, 0xCF, 0x41, 0xFF, 0x51, 0x5A, 0xFF, 0x71, 0x62, 0xFF, 0x1A, 0x9C, 0xFF, 0x2D, 0x52, 0xFF, 0x52, 0x83, 0xFF, 0x0C, 0x5A, 0xFF, 0x52, 0x83, 0xFF, 0x58, 0xBC, 0xFF, 0x2D, 0x62, 0xFF, 0xD3, 0x8B, 0xFF, 0xAA, 0x51, 0xFF, 0x70, 0x8B, 0xFF, 0x16, 0xDD, 0xFF, 0x92, 0x8B, 0xFF, 0xCF, 0x72, 0xFF, 0x6D, 0x62, 0xFF, 0xEE, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x8B, 0xFF, 0xCF, 0x72, 0xFF, 0xAE, 0x72, 0xFF, 0x10, 0x7B, 0xFF, 0xB8, 0xE5, 0xFF, 0xB1, 0x6A, 0xFF, 0x70, 0x62, 0xFF, 0x2F, 0x52, 0xFF, 0xB0, 0x62, 0xFF, 0x9F, 0xE6, 0xFF, 0x54, 0x7B, 0xFF, 0xB1, 0x5A, 0xFF, 0x52, 0x63, 0xFF, 0xD1, 0x52, 0xFF, 0xFF, 0xE7, 0xFF, 0x72, 0x53, 0xFF, 0xD8, 0x64, 0xFF, 0x7F, 0x87, 0xFF, 0x5F, 0xAF, 0xFF, 0x9A, 0x9D, 0xFF, 0x71, 0x5B, 0xFF, 0x31, 0x53, 0xFF, 0xB3, 0x6B, 0xFF, 0xF0, 0x52, 0xFF,
-    0x77, 0x84, 0xFF, 0xCF, 0x52, 0xFF, 0x34, 0x7C, 0xFF, 0xCF, 0x5A, 0xFF, 0xD0, 0x5A, 0xFF, 0xAE, 0x52, 0xFF, 0xAF, 0x5A, 0xFF, 0x11, 0x63, 0xFF, 0xD0, 0x5A, 0xFF, 0x31, 0x6B, 0xFF, 0x52, 0x6B, 0xFF, 0x31, 0x63, 0xFF, 0x10, 0x63, 0xFF, 0x10, 0x63, 0xFF, 0xF0, 0x5A, 0xFF, 0x30, 0x63, 0xFF, 0xEA, 0x28, 0xFF, 0xEB, 0x20, 0xFF, 0x4C, 0x31, 0xFF, 0x4D, 0x31, 0xFF, 0x0B, 0x29, 0xFF, 0x0B, 0x29, 0xFF, 0x4E, 0x39, 0xFF, 0x8F, 0x39, 0xFF, 0x74, 0x5A, 0xFF, 0x70, 0x39, 0xFF, 0x14, 0x52, 0xFF, 0x15, 0x52, 0xFF, 0xB4, 0x41, 0xFF, 0x16, 0x52, 0xFF, 0x36, 0x62, 0xFF, 0xB5, 0x51, 0xFF, 0x93, 0x49, 0xFF, 0x75, 0x62, 0xFF, 0xD1, 0x49, 0xFF, 0x12, 0x52, 0xFF, 0x1B, 0x8C, 0xFF, 0x11, 0x52, 0xFF, 0x0F, 0x52, 0xFF, 0x50, 0x5A, 0xFF, 0x70, 0x62, 0xFF, 0x98, 0xAC, 0xFF, 0xB1, 0x6A, 0xFF, 0xEC, 0x51, 0xFF, 0x32, 0x7B, 0xFF, 0xAB, 0x51, 0xFF, 0x8E, 0x6A, 0xFF, 0x2C, 0x5A, 0xFF, 0xEB, 0x51, 0xFF, 0xCF, 0x72, 0xFF, 0xF8, 0xED, 0xFF, 0xD3, 0x93, 0xFF, 0xF0, 0x7A, 0xFF, 0xAE, 0x72, 0xFF, 0x91, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x8B, 0xFF, 0xCE, 0x72, 0xFF, 0xEF, 0x7A, 0xFF, 0x30, 0x83, 0xFF, 0xCF, 0x7A, 0xFF, 0x2E, 0x5A, 0xFF, 0x33, 0x7B, 0xFF, 0x53, 0x7B, 0xFF,
-    0x93, 0x83, 0xFF, 0x11, 0x6B, 0xFF, 0x53, 0x73, 0xFF, 0x8F, 0x52, 0xFF, 0x52, 0x5B, 0xFF, 0x3C, 0x95, 0xFF, 0x74, 0x53, 0xFF, 0x19, 0x75, 0xFF, 0xFF, 0x97, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xCF, 0xFF, 0x55, 0x64, 0xFF, 0x55, 0x64, 0xFF, 0x54, 0x5C, 0xFF, 0x51, 0x5B, 0xFF, 0x0F, 0x53, 0xFF, 0xF5, 0x73, 0xFF, 0xEF, 0x52, 0xFF, 0x50, 0x63, 0xFF, 0x92, 0x6B, 0xFF, 0x32, 0x63, 0xFF, 0xAF, 0x5A, 0xFF, 0x31, 0x63, 0xFF, 0x31, 0x6B, 0xFF, 0x94, 0x7B, 0xFF, 0x11, 0x63, 0xFF, 0x31, 0x63, 0xFF, 0x52, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x5A, 0xFF, 0x31, 0x63, 0xFF, 0x51, 0x6B, 0xFF, 0xEA, 0x28, 0xFF, 0xEB, 0x28, 0xFF, 0x0B, 0x29, 0xFF, 0x10, 0x4A, 0xFF, 0x2D, 0x31, 0xFF, 0x4E, 0x31, 0xFF, 0x2D, 0x31, 0xFF, 0x4F, 0x39, 0xFF, 0x75, 0x5A, 0xFF, 0x96, 0x5A, 0xFF, 0xD3, 0x49, 0xFF, 0xF5, 0x51, 0xFF, 0x1A, 0x5A, 0xFF, 0xFD, 0x7A, 0xFF, 0x7A, 0x6A, 0xFF, 0x39, 0x62, 0xFF, 0xD6, 0x51, 0xFF, 0x9A, 0x83, 0xFF, 0xD2, 0x49, 0xFF, 0x94, 0x62, 0xFF, 0x6E, 0x39, 0xFF, 0x97, 0x7B, 0xFF, 0x51, 0x5A, 0xFF, 0x30, 0x52, 0xFF, 0xAD, 0x41, 0xFF, 0x4F, 0x5A, 0xFF, 0xB1, 0x6A, 0xFF, 0xAB, 0x41, 0xFF, 0x11, 0x7B, 0xFF, 0xEC, 0x51, 0xFF, 0x34, 0x9C, 0xFF, 0x0C, 0x5A, 0xFF,
-    0x30, 0x7B, 0xFF, 0x50, 0x83, 0xFF, 0x54, 0xB4, 0xFF, 0x4D, 0x62, 0xFF, 0xEF, 0x82, 0xFF, 0xCF, 0x82, 0xFF, 0xF2, 0xBB, 0xFF, 0x96, 0xE5, 0xFF, 0x33, 0xBC, 0xFF, 0xF0, 0x82, 0xFF, 0x30, 0x83, 0xFF, 0x1C, 0xFF, 0xFF, 0xF0, 0x7A, 0xFF, 0x8F, 0x5A, 0xFF, 0xAF, 0x62, 0xFF, 0x8F, 0x62, 0xFF, 0xD5, 0x6B, 0xFF, 0x33, 0x6B, 0xFF, 0xFB, 0xA5, 0xFF, 0xAF, 0x52, 0xFF, 0x3B, 0xAD, 0xFF, 0x32, 0x53, 0xFF, 0x11, 0x4B, 0xFF, 0x36, 0x64, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0x5A, 0x6D, 0xFF, 0xF3, 0x63, 0xFF, 0xF7, 0x74, 0xFF, 0xF3, 0x63, 0xFF, 0xF3, 0x6B, 0xFF, 0x50, 0x63, 0xFF, 0xCD, 0x52, 0xFF, 0x34, 0x84, 0xFF, 0x0F, 0x5B, 0xFF, 0x50, 0x63, 0xFF, 0x10, 0x63, 0xFF, 0x13, 0x84, 0xFF, 0xAE, 0x5A, 0xFF, 0xEF, 0x62, 0xFF, 0xCF, 0x5A, 0xFF, 0x31, 0x63, 0xFF, 0xD4, 0x7B, 0xFF, 0xB3, 0x73, 0xFF, 0x31, 0x6B, 0xFF, 0x10, 0x63, 0xFF, 0x71, 0x6B, 0xFF, 0x50, 0x63, 0xFF, 0x0A, 0x29, 0xFF, 0x8D, 0x39, 0xFF, 0xEB, 0x28, 0xFF, 0x52, 0x52, 0xFF, 0x0C, 0x29, 0xFF, 0x0D, 0x29, 0xFF, 0xF2, 0x49, 0xFF, 0x4F, 0x39, 0xFF, 0xBB, 0x83, 0xFF, 0x93, 0x39, 0xFF, 0x78, 0x62, 0xFF, 0x58, 0x62, 0xFF, 0x3A, 0x72, 0xFF, 0x1F, 0xAB, 0xFF, 0x1F, 0xAB, 0xFF, 0x5E, 0x7A, 0xFF,
-    0x38, 0x62, 0xFF, 0x5A, 0x83, 0xFF, 0x97, 0x62, 0xFF, 0x95, 0x62, 0xFF, 0x8F, 0x41, 0xFF, 0xAE, 0x41, 0xFF, 0x72, 0x5A, 0xFF, 0x93, 0x62, 0xFF, 0xCD, 0x41, 0xFF, 0x4E, 0x5A, 0xFF, 0xB0, 0x62, 0xFF, 0xEC, 0x49, 0xFF, 0x2D, 0x5A, 0xFF, 0x2D, 0x62, 0xFF, 0x52, 0x7B, 0xFF, 0x30, 0x83, 0xFF, 0xAE, 0x6A, 0xFF, 0x10, 0x83, 0xFF, 0x50, 0x8B, 0xFF, 0x17, 0xC5, 0xFF, 0x71, 0x93, 0xFF, 0x0F, 0x93, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFE, 0xFF, 0xD4, 0xAB, 0xFF, 0x54, 0xB4, 0xFF, 0xBC, 0xF6, 0xFF, 0x13, 0x9C, 0xFF, 0x94, 0x83, 0xFF, 0x31, 0x7B, 0xFF, 0x76, 0x9C, 0xFF, 0xF2, 0x8B, 0xFF, 0x11, 0x63, 0xFF, 0x93, 0x7B, 0xFF, 0xFD, 0xC5, 0xFF, 0xB3, 0x63, 0xFF, 0xD0, 0x52, 0xFF, 0x93, 0x63, 0xFF, 0x3B, 0x9D, 0xFF, 0xB7, 0x6C, 0xFF, 0x7E, 0x9E, 0xFF, 0x76, 0x6C, 0xFF, 0x5A, 0x9D, 0xFF, 0xD2, 0x6B, 0xFF, 0x71, 0x6B, 0xFF, 0x70, 0x63, 0xFF, 0x96, 0x8C, 0xFF, 0x8C, 0x4A, 0xFF, 0xEE, 0x5A, 0xFF, 0x0E, 0x63, 0xFF, 0x55, 0x8C, 0xFF, 0x71, 0x73, 0xFF, 0x0E, 0x5B, 0xFF, 0x30, 0x63, 0xFF, 0x10, 0x63, 0xFF, 0x51, 0x6B, 0xFF, 0x31, 0x63, 0xFF, 0xF0, 0x5A, 0xFF, 0x10, 0x63, 0xFF, 0x31, 0x6B, 0xFF, 0x30, 0x6B, 0xFF, 0x30, 0x6B, 0xFF, 0x30, 0x6B, 0xFF,
-    0xEA, 0x28, 0xFF, 0x6F, 0x31, 0xFF, 0xDA, 0x5A, 0xFF, 0xCF, 0x41, 0xFF, 0x2C, 0x31, 0xFF, 0x6E, 0x39, 0xFF, 0x8F, 0x39, 0xFF, 0x9F, 0xA4, 0xFF, 0x3E, 0x73, 0xFF, 0xDA, 0x49, 0xFF, 0xD5, 0x51, 0xFF, 0x3A, 0x62, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBA, 0xFF, 0xFF, 0x82, 0xFF, 0x7D, 0x72, 0xFF, 0x7F, 0xCD, 0xFF, 0x16, 0x5A, 0xFF, 0x94, 0x5A, 0xFF, 0xAF, 0x41, 0xFF, 0x75, 0x52, 0xFF, 0x5F, 0x9C, 0xFF, 0xB2, 0x62, 0xFF, 0xED, 0x51, 0xFF, 0x6F, 0x72, 0xFF, 0x8B, 0x41, 0xFF, 0x53, 0x83, 0xFF, 0x3C, 0xFE, 0xFF, 0x11, 0x7B, 0xFF, 0xB6, 0x9C, 0xFF, 0x6D, 0x62, 0xFF, 0x0E, 0x73, 0xFF, 0xB9, 0xF5, 0xFF, 0xF2, 0x9B, 0xFF, 0x50, 0x93, 0xFF, 0x51, 0x9B, 0xFF, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0xED, 0xFF, 0x31, 0x8B, 0xFF, 0x90, 0x93, 0xFF, 0x36, 0xBD, 0xFF, 0x18, 0xCD, 0xFF, 0x6D, 0x62, 0xFF, 0xF5, 0x9B, 0xFF, 0x4D, 0x5A, 0xFF, 0xEF, 0x6A, 0xFF, 0xD9, 0xDD, 0xFF, 0xB3, 0x83, 0xFF, 0x71, 0x7B, 0xFF, 0x71, 0x7B, 0xFF, 0xAF, 0x52, 0xFF, 0x56, 0x94, 0xFF, 0xBD, 0xD6, 0xFF, 0x76, 0x7C, 0xFF, 0x55, 0x74, 0xFF, 0x10, 0x4B, 0xFF, 0xB2, 0x6B, 0xFF, 0xBA, 0xD6, 0xFF, 0x6E, 0x73, 0xFF, 0x70, 0x6B, 0xFF, 0x4F, 0x63, 0xFF,
-    0xD2, 0xA4, 0xFF, 0xFC, 0xFF, 0xFF, 0xAF, 0x7B, 0xFF, 0x4F, 0x6B, 0xFF, 0x4F, 0x63, 0xFF, 0xD1, 0x7B, 0xFF, 0xD8, 0xDE, 0xFF, 0x9D, 0xFF, 0xFF, 0x30, 0x6B, 0xFF, 0x52, 0x6B, 0xFF, 0x50, 0x6B, 0xFF, 0x15, 0xA5, 0xFF, 0x56, 0xAD, 0xFF, 0x71, 0x73, 0xFF, 0x50, 0x6B, 0xFF, 0x71, 0x73, 0xFF, 0x0A, 0x29, 0xFF, 0x1F, 0x84, 0xFF, 0x0A, 0x29, 0xFF, 0x2C, 0x31, 0xFF, 0xF1, 0x41, 0xFF, 0xF0, 0x49, 0xFF, 0x35, 0x4A, 0xFF, 0x6F, 0x39, 0xFF, 0x54, 0x52, 0xFF, 0xFC, 0xBD, 0xFF, 0x38, 0x5A, 0xFF, 0xBC, 0x72, 0xFF, 0x5F, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x5E, 0x72, 0xFF, 0xDF, 0xFF, 0xFF, 0x39, 0x5A, 0xFF, 0x1F, 0x84, 0xFF, 0x59, 0x7B, 0xFF, 0x6F, 0x41, 0xFF, 0xCF, 0x49, 0xFF, 0x33, 0x73, 0xFF, 0x9B, 0xA4, 0xFF, 0xF3, 0x6A, 0xFF, 0xCD, 0x49, 0xFF, 0x8C, 0x41, 0xFF, 0x90, 0x62, 0xFF, 0x36, 0x9C, 0xFF, 0x57, 0x9C, 0xFF, 0x8E, 0x62, 0xFF, 0xD2, 0x83, 0xFF, 0x70, 0x83, 0xFF, 0xF6, 0xD4, 0xFF, 0x71, 0x83, 0xFF, 0xD2, 0x9B, 0xFF, 0xEF, 0x92, 0xFF, 0xB3, 0xD4, 0xFF, 0x96, 0xDC, 0xFF, 0x74, 0xCC, 0xFF, 0x0F, 0x83, 0xFF, 0x70, 0x93, 0xFF, 0x2F, 0x83, 0xFF, 0xF7, 0xCC, 0xFF, 0xAE, 0x6A, 0xFF, 0xF4, 0x8B, 0xFF, 0x4D, 0x5A, 0xFF,
-    0x50, 0x83, 0xFF, 0x7F, 0xDE, 0xFF, 0x0F, 0x63, 0xFF, 0xCF, 0x5A, 0xFF, 0xCE, 0x5A, 0xFF, 0xFD, 0xBD, 0xFF, 0x7F, 0xDF, 0xFF, 0x30, 0x5B, 0xFF, 0x37, 0x84, 0xFF, 0xB2, 0x6B, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xAD, 0xFF, 0x31, 0x84, 0xFF, 0x4F, 0x6B, 0xFF, 0xBC, 0xD6, 0xFF, 0x31, 0x8C, 0xFF, 0x8F, 0x73, 0xFF, 0xAF, 0x7B, 0xFF, 0xB9, 0xB5, 0xFF, 0x70, 0x73, 0xFF, 0x0E, 0x63, 0xFF, 0x50, 0x6B, 0xFF, 0x71, 0x73, 0xFF, 0xF7, 0xAC, 0xFF, 0x91, 0x73, 0xFF, 0x0F, 0x6B, 0xFF, 0x71, 0x73, 0xFF, 0x50, 0x6B, 0xFF, 0x71, 0x73, 0xFF, 0xF3, 0x83, 0xFF, 0x91, 0x73, 0xFF, 0x0A, 0x29, 0xFF, 0x5F, 0xBE, 0xFF, 0x2C, 0x29, 0xFF, 0x59, 0x4A, 0xFF, 0x2D, 0x31, 0xFF, 0x15, 0x6B, 0xFF, 0xB4, 0x62, 0xFF, 0x50, 0x31, 0xFF, 0x3A, 0x5B, 0xFF, 0xFC, 0x6A, 0xFF, 0xD5, 0x49, 0xFF, 0x7A, 0x6A, 0xFF, 0x7F, 0xE6, 0xFF, 0xBF, 0xFE, 0xFF, 0x1E, 0xDC, 0xFF, 0xDF, 0xA2, 0xFF, 0x5C, 0x62, 0xFF, 0xDE, 0x93, 0xFF, 0xD6, 0x51, 0xFF, 0x17, 0x52, 0xFF, 0xD3, 0x49, 0xFF, 0xDA, 0x83, 0xFF, 0x11, 0x52, 0xFF, 0x9A, 0x6A, 0xFF, 0xAE, 0x41, 0xFF, 0x18, 0x9C, 0xFF, 0x72, 0x62, 0xFF, 0xAC, 0x41, 0xFF, 0xF2, 0x72, 0xFF, 0x90, 0x6A, 0xFF, 0x1E, 0xAD, 0xFF, 0x71, 0x8B, 0xFF,
-    0x6D, 0x62, 0xFF, 0x2F, 0x8B, 0xFF, 0xFB, 0xFE, 0xFF, 0xB2, 0x93, 0xFF, 0x5A, 0xE6, 0xFF, 0x0F, 0x93, 0xFF, 0xB6, 0xF5, 0xFF, 0x5B, 0xFE, 0xFF, 0x92, 0xE4, 0xFF, 0xEE, 0x8A, 0xFF, 0x11, 0xA4, 0xFF, 0xDF, 0xFF, 0xFF, 0x50, 0x8B, 0xFF, 0x52, 0x83, 0xFF, 0x8E, 0x62, 0xFF, 0xAD, 0x62, 0xFF, 0x93, 0x8B, 0xFF, 0x91, 0x7B, 0xFF, 0xCF, 0x62, 0xFF, 0xD2, 0x7B, 0xFF, 0xDC, 0xBD, 0xFF, 0x75, 0x8C, 0xFF, 0xD2, 0x7B, 0xFF, 0x0F, 0x5B, 0xFF, 0x50, 0x6B, 0xFF, 0x3D, 0xAE, 0xFF, 0xD3, 0x7B, 0xFF, 0xB0, 0x73, 0xFF, 0x18, 0xB6, 0xFF, 0x36, 0xA5, 0xFF, 0x31, 0x8C, 0xFF, 0x92, 0x94, 0xFF, 0x8E, 0x7B, 0xFF, 0x10, 0x84, 0xFF, 0x37, 0xAD, 0xFF, 0xAF, 0x7B, 0xFF, 0xB0, 0x73, 0xFF, 0x4F, 0x6B, 0xFF, 0xD7, 0xA4, 0xFF, 0x0E, 0x63, 0xFF, 0x91, 0x73, 0xFF, 0x71, 0x73, 0xFF, 0x0E, 0x63, 0xFF, 0x91, 0x73, 0xFF, 0xF3, 0x83, 0xFF, 0x71, 0x73, 0xFF, 0x71, 0x73, 0xFF, 0x91, 0x73, 0xFF, 0x0A, 0x29, 0xFF, 0xF2, 0x41, 0xFF, 0x2C, 0x29, 0xFF, 0x2F, 0x31, 0xFF, 0xEB, 0x20, 0xFF, 0xBF, 0xC5, 0xFF, 0xD1, 0x41, 0xFF, 0x4E, 0x39, 0xFF, 0xB3, 0x41, 0xFF, 0x19, 0x7B, 0xFF, 0xB8, 0x5A, 0xFF, 0xD5, 0x51, 0xFF, 0xFE, 0x9B, 0xFF, 0x5E, 0x93, 0xFF, 0x3E, 0x83, 0xFF, 0x5A, 0x6A, 0xFF,
-    0x38, 0x62, 0xFF, 0xF5, 0x59, 0xFF, 0x15, 0x52, 0xFF, 0x93, 0x39, 0xFF, 0xD7, 0x6A, 0xFF, 0xF1, 0x49, 0xFF, 0x13, 0x4A, 0xFF, 0x56, 0x7B, 0xFF, 0xCE, 0x49, 0xFF, 0xF1, 0xBB, 0xFF, 0x50, 0x41, 0xFF, 0xD0, 0x6A, 0xFF, 0xBF, 0xFF, 0xFF, 0x72, 0x8B, 0xFF, 0xD0, 0x9A, 0xFF, 0x1B, 0xD6, 0xFF, 0x34, 0x8C, 0xFF, 0xBE, 0xFF, 0xFF, 0xB3, 0xCC, 0xFF, 0x5A, 0xDE, 0xFF, 0x4F, 0x8B, 0xFF, 0x0E, 0x9B, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x8A, 0xFF, 0xDB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x2F, 0x8B, 0xFF, 0x1C, 0xFF, 0xFF, 0xEE, 0x72, 0xFF, 0x9B, 0xDE, 0xFF, 0x56, 0xF6, 0xFF, 0x4B, 0x62, 0xFF, 0xEF, 0x72, 0xFF, 0x79, 0xBD, 0xFF, 0xCE, 0x62, 0xFF, 0x4F, 0x7B, 0xFF, 0x53, 0x94, 0xFF, 0xFA, 0xC5, 0xFF, 0x12, 0x84, 0xFF, 0x0F, 0x63, 0xFF, 0xAC, 0x5A, 0xFF, 0xD6, 0xA4, 0xFF, 0x71, 0x94, 0xFF, 0x71, 0x94, 0xFF, 0x0F, 0x84, 0xFF, 0x97, 0xC5, 0xFF, 0x16, 0xD6, 0xFF, 0xB1, 0x9C, 0xFF, 0x71, 0x9C, 0xFF, 0x57, 0xB5, 0xFF, 0x31, 0x94, 0xFF, 0x90, 0x7B, 0xFF, 0x6F, 0x73, 0xFF, 0x6F, 0x73, 0xFF, 0x13, 0x8C, 0xFF, 0x91, 0x7B, 0xFF, 0x50, 0x6B, 0xFF, 0xD2, 0x83, 0xFF, 0x91, 0x7B, 0xFF, 0x91, 0x7B, 0xFF, 0x70, 0x73, 0xFF, 0x91, 0x7B, 0xFF,
-    0xE9, 0x20, 0xFF, 0x0B, 0x39, 0xFF, 0x0A, 0x29, 0xFF, 0x2C, 0x31, 0xFF, 0xF3, 0x62, 0xFF, 0xBB, 0x83, 0xFF, 0xB1, 0x41, 0xFF, 0xEC, 0x28, 0xFF, 0x90, 0x41, 0xFF, 0x1F, 0xFF, 0xFF, 0xD2, 0x49, 0xFF, 0xB2, 0x49, 0xFF, 0xF4, 0x61, 0xFF, 0x16, 0xB4, 0xFF, 0xD5, 0x59, 0xFF, 0x95, 0x49, 0xFF, 0x15, 0x4A, 0xFF, 0x55, 0x5A, 0xFF, 0xB0, 0x49, 0xFF, 0xB4, 0x6A, 0xFF, 0xDF, 0xFE, 0xFF, 0xEF, 0x41, 0xFF, 0x10, 0x4A, 0xFF, 0x14, 0x7B, 0xFF, 0xD4, 0x62, 0xFF, 0xAD, 0x49, 0xFF, 0x8D, 0x41, 0xFF, 0xAC, 0x49, 0xFF, 0xF2, 0x7A, 0xFF, 0x6E, 0x62, 0xFF, 0xF0, 0x72, 0xFF, 0xD7, 0xBC, 0xFF, 0xF2, 0xAC, 0xFF, 0x31, 0x72, 0xFF, 0x4E, 0x8B, 0xFF, 0x38, 0xBD, 0xFF, 0xEE, 0x82, 0xFF, 0x0E, 0x93, 0xFF, 0x57, 0xFE, 0xFF, 0x1A, 0xFE, 0xFF, 0x52, 0xDC, 0xFF, 0x0E, 0x8B, 0xFF, 0xF0, 0xAB, 0xFF, 0x30, 0x83, 0xFF, 0x0E, 0x83, 0xFF, 0x5F, 0xFF, 0xFF, 0x76, 0xAC, 0xFF, 0xF3, 0x93, 0xFF, 0x79, 0x9C, 0xFF, 0x0F, 0x73, 0xFF, 0xB9, 0xAC, 0xFF, 0x52, 0x9C, 0xFF, 0x39, 0xD6, 0xFF, 0x4D, 0x52, 0xFF, 0xFA, 0xB4, 0xFF, 0xF2, 0x83, 0xFF, 0xB1, 0x7B, 0xFF, 0x2F, 0x6B, 0xFF, 0x4E, 0x73, 0xFF, 0x92, 0x9C, 0xFF, 0x30, 0x9C, 0xFF, 0xD3, 0xA4, 0xFF, 0xB1, 0xB4, 0xFF, 0x33, 0xE6, 0xFF,
-    0x56, 0xFF, 0xFF, 0x98, 0xEE, 0xFF, 0x32, 0xB5, 0xFF, 0x0E, 0x84, 0xFF, 0x51, 0x94, 0xFF, 0xD0, 0x7B, 0xFF, 0x8F, 0x73, 0xFF, 0x4F, 0x73, 0xFF, 0x16, 0xAD, 0xFF, 0x13, 0x84, 0xFF, 0xB0, 0x7B, 0xFF, 0xD2, 0x7B, 0xFF, 0xB2, 0x7B, 0xFF, 0x91, 0x7B, 0xFF, 0x90, 0x7B, 0xFF, 0xB1, 0x83, 0xFF, 0x0A, 0x29, 0xFF, 0xC9, 0x28, 0xFF, 0xB7, 0x52, 0xFF, 0xEA, 0x28, 0xFF, 0xFE, 0xAC, 0xFF, 0x72, 0x83, 0xFF, 0x0D, 0x31, 0xFF, 0xDF, 0x83, 0xFF, 0x92, 0x39, 0xFF, 0xF5, 0x72, 0xFF, 0x6F, 0x39, 0xFF, 0x71, 0x41, 0xFF, 0x36, 0x5A, 0xFF, 0x1F, 0xC6, 0xFF, 0xB3, 0x49, 0xFF, 0x92, 0x41, 0xFF, 0xB1, 0x41, 0xFF, 0xB1, 0x49, 0xFF, 0xDE, 0x8B, 0xFF, 0x94, 0x62, 0xFF, 0xF3, 0x72, 0xFF, 0x8E, 0x41, 0xFF, 0x31, 0x52, 0xFF, 0x93, 0x62, 0xFF, 0x2E, 0x4A, 0xFF, 0xCE, 0x49, 0xFF, 0x8C, 0x41, 0xFF, 0x6B, 0x39, 0xFF, 0x2F, 0x62, 0xFF, 0x76, 0xAC, 0xFF, 0x10, 0x73, 0xFF, 0xF0, 0x72, 0xFF, 0x95, 0xAC, 0xFF, 0xF0, 0x82, 0xFF, 0xDF, 0xFF, 0xFF, 0x13, 0x9C, 0xFF, 0xAD, 0x7A, 0xFF, 0xAC, 0x7A, 0xFF, 0xF0, 0xB3, 0xFF, 0x3A, 0xE6, 0xFF, 0x58, 0xC4, 0xFF, 0xCD, 0x72, 0xFF, 0xF4, 0xA3, 0xFF, 0x30, 0x7B, 0xFF, 0xD9, 0xDD, 0xFF, 0x93, 0x8B, 0xFF, 0x6D, 0x62, 0xFF, 0xB0, 0x6A, 0xFF,
-    0x50, 0x83, 0xFF, 0xF7, 0xC4, 0xFF, 0x6D, 0x5A, 0xFF, 0x17, 0x94, 0xFF, 0xF4, 0x8B, 0xFF, 0x6D, 0x5A, 0xFF, 0x58, 0xB5, 0xFF, 0x1B, 0xCE, 0xFF, 0x78, 0xBD, 0xFF, 0x0E, 0x6B, 0xFF, 0xF1, 0x8B, 0xFF, 0x52, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xBD, 0xFF, 0xD9, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0xCD, 0xFF, 0x91, 0x9C, 0xFF, 0xD2, 0xA4, 0xFF, 0x50, 0x94, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x70, 0x73, 0xFF, 0xD2, 0x7B, 0xFF, 0xB0, 0x83, 0xFF, 0xD8, 0xBD, 0xFF, 0xF9, 0xC5, 0xFF, 0x92, 0x7B, 0xFF, 0x91, 0x7B, 0xFF, 0x70, 0x7B, 0xFF, 0xEA, 0x20, 0xFF, 0xF1, 0x41, 0xFF, 0xEA, 0x28, 0xFF, 0xEB, 0x28, 0xFF, 0x53, 0x4A, 0xFF, 0x4D, 0x31, 0xFF, 0x74, 0x52, 0xFF, 0x72, 0x5A, 0xFF, 0x2D, 0x31, 0xFF, 0x14, 0x52, 0xFF, 0x2F, 0x31, 0xFF, 0x3A, 0x73, 0xFF, 0x35, 0x52, 0xFF, 0xB2, 0x49, 0xFF, 0x3F, 0x94, 0xFF, 0xFF, 0x93, 0xFF, 0xB8, 0x62, 0xFF, 0xB0, 0x41, 0xFF, 0x11, 0x4A, 0xFF, 0x53, 0x52, 0xFF, 0x3C, 0x8C, 0xFF, 0xAF, 0x41, 0xFF, 0xCE, 0x41, 0xFF, 0x51, 0x5A, 0xFF, 0x1E, 0xB5, 0xFF, 0x99, 0xA4, 0xFF, 0xAD, 0x49, 0xFF, 0x0D, 0x4A, 0xFF, 0x70, 0x5A, 0xFF, 0x59, 0xB4, 0xFF, 0xBC, 0xE5, 0xFF, 0x8E, 0x62, 0xFF,
-    0x19, 0xBD, 0xFF, 0x6E, 0x6A, 0xFF, 0xB6, 0xC4, 0xFF, 0x6E, 0x6A, 0xFF, 0x0C, 0x62, 0xFF, 0x6C, 0x6A, 0xFF, 0x31, 0xB4, 0xFF, 0x35, 0xBC, 0xFF, 0xEF, 0x82, 0xFF, 0xAD, 0x6A, 0xFF, 0xEE, 0x7A, 0xFF, 0x2F, 0x8B, 0xFF, 0x58, 0xD5, 0xFF, 0x2F, 0x7B, 0xFF, 0xAE, 0x62, 0xFF, 0x71, 0x7B, 0xFF, 0xB6, 0xAC, 0xFF, 0x5F, 0xFF, 0xFF, 0x30, 0x73, 0xFF, 0x92, 0x7B, 0xFF, 0x71, 0x7B, 0xFF, 0xBB, 0xC5, 0xFF, 0x5A, 0xCE, 0xFF, 0x2F, 0x73, 0xFF, 0x8F, 0x83, 0xFF, 0x91, 0x83, 0xFF, 0x7B, 0xD6, 0xFF, 0x72, 0x9C, 0xFF, 0xD2, 0xB4, 0xFF, 0x9D, 0xF7, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF4, 0xE5, 0xFF, 0x5A, 0xD6, 0xFF, 0xF3, 0xAC, 0xFF, 0xB0, 0x83, 0xFF, 0xB0, 0x8B, 0xFF, 0x74, 0x94, 0xFF, 0xB6, 0xAC, 0xFF, 0x9A, 0xC5, 0xFF, 0x51, 0x7B, 0xFF, 0xD2, 0x83, 0xFF, 0xB2, 0x83, 0xFF, 0xF4, 0x8B, 0xFF, 0xF3, 0x8B, 0xFF, 0x33, 0x8C, 0xFF, 0x2A, 0x29, 0xFF, 0xE9, 0x20, 0xFF, 0x0A, 0x29, 0xFF, 0x0A, 0x21, 0xFF, 0x2B, 0x29, 0xFF, 0x11, 0x4A, 0xFF, 0x10, 0x4A, 0xFF, 0x6D, 0x39, 0xFF, 0x2C, 0x29, 0xFF, 0xB0, 0x39, 0xFF, 0xB0, 0x41, 0xFF, 0xF1, 0x49, 0xFF, 0x74, 0x5A, 0xFF, 0xB6, 0x62, 0xFF, 0x95, 0x5A, 0xFF, 0x91, 0x39, 0xFF,
-    0x70, 0x39, 0xFF, 0x90, 0x39, 0xFF, 0xDF, 0x94, 0xFF, 0x98, 0x7B, 0xFF, 0xAF, 0x41, 0xFF, 0x52, 0x4A, 0xFF, 0xFA, 0x7B, 0xFF, 0xB3, 0x6A, 0xFF, 0x8D, 0x41, 0xFF, 0x33, 0x73, 0xFF, 0x9A, 0x94, 0xFF, 0x53, 0x73, 0xFF, 0xCC, 0x49, 0xFF, 0x16, 0x94, 0xFF, 0x8F, 0x62, 0xFF, 0x31, 0x7B, 0xFF, 0x10, 0x73, 0xFF, 0x30, 0x7B, 0xFF, 0x4D, 0x62, 0xFF, 0x37, 0xBD, 0xFF, 0xAF, 0x72, 0xFF, 0xCE, 0x7A, 0xFF, 0x30, 0x8B, 0xFF, 0x76, 0xD5, 0xFF, 0x90, 0x9B, 0xFF, 0x8D, 0x62, 0xFF, 0x50, 0x8B, 0xFF, 0x1C, 0xFF, 0xFF, 0xB6, 0xCD, 0xFF, 0x94, 0xA4, 0xFF, 0x10, 0x7B, 0xFF, 0x97, 0xAC, 0xFF, 0xFD, 0xFF, 0xFF, 0x2C, 0x52, 0xFF, 0x2E, 0x73, 0xFF, 0xD4, 0x93, 0xFF, 0xAD, 0x6A, 0xFF, 0x6D, 0x5A, 0xFF, 0xFD, 0xFF, 0xFF, 0x9B, 0xCD, 0xFF, 0x38, 0xBD, 0xFF, 0x0E, 0x73, 0xFF, 0x36, 0xB5, 0xFF, 0x75, 0xAC, 0xFF, 0xB8, 0xD5, 0xFF, 0x13, 0xD6, 0xFF, 0x35, 0xDE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xD6, 0xF6, 0xFF, 0xF1, 0xB4, 0xFF, 0xD8, 0xD5, 0xFF, 0xD2, 0xAC, 0xFF, 0x90, 0x83, 0xFF, 0xF2, 0x8B, 0xFF, 0x30, 0x7B, 0xFF, 0xF5, 0xB4, 0xFF, 0x33, 0x8C, 0xFF, 0xB1, 0x83, 0xFF, 0x13, 0x94, 0xFF, 0x14, 0x94, 0xFF, 0xD3, 0x8B, 0xFF, 0x34, 0x94, 0xFF, 0xB3, 0x83, 0xFF,
-    0x09, 0x29, 0xFF, 0x09, 0x21, 0xFF, 0x4B, 0x31, 0xFF, 0x0A, 0x21, 0xFF, 0x2B, 0x29, 0xFF, 0x2B, 0x29, 0xFF, 0x2C, 0x31, 0xFF, 0x6D, 0x39, 0xFF, 0x2C, 0x31, 0xFF, 0xF0, 0x49, 0xFF, 0xF1, 0x41, 0xFF, 0xD1, 0x41, 0xFF, 0xCF, 0x41, 0xFF, 0x74, 0x52, 0xFF, 0xB6, 0x5A, 0xFF, 0xB0, 0x39, 0xFF, 0x4E, 0x31, 0xFF, 0xB7, 0x52, 0xFF, 0x37, 0x6B, 0xFF, 0x6E, 0x31, 0xFF, 0x11, 0x4A, 0xFF, 0x15, 0x3A, 0xFF, 0x10, 0x4A, 0xFF, 0xCE, 0x41, 0xFF, 0x50, 0x4A, 0xFF, 0x50, 0x52, 0xFF, 0x0D, 0x4A, 0xFF, 0x8B, 0x41, 0xFF, 0x73, 0x6B, 0xFF, 0x71, 0x73, 0xFF, 0x4E, 0x5A, 0xFF, 0xAC, 0x41, 0xFF, 0xD5, 0x83, 0xFF, 0x36, 0xBD, 0xFF, 0x50, 0x7B, 0xFF, 0xF3, 0x83, 0xFF, 0x6D, 0x62, 0xFF, 0x2C, 0x5A, 0xFF, 0x2F, 0x83, 0xFF, 0xF4, 0x93, 0xFF, 0x0E, 0x7B, 0xFF, 0x6C, 0x62, 0xFF, 0x74, 0xA4, 0xFF, 0xAE, 0x72, 0xFF, 0xD2, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xE5, 0xFF, 0xD1, 0x93, 0xFF, 0x32, 0x9C, 0xFF, 0x7F, 0xE6, 0xFF, 0x33, 0x83, 0xFF, 0x53, 0x9C, 0xFF, 0x31, 0x7B, 0xFF, 0xD9, 0xA3, 0xFF, 0x95, 0xA4, 0xFF, 0x8E, 0x62, 0xFF, 0x37, 0xA4, 0xFF, 0x15, 0xA4, 0xFF, 0xD1, 0x93, 0xFF, 0x32, 0x94, 0xFF, 0x93, 0xA4, 0xFF, 0xD2, 0xB4, 0xFF, 0x94, 0xCD, 0xFF, 0x95, 0xCD, 0xFF,
-    0x98, 0xE6, 0xFF, 0x30, 0x9C, 0xFF, 0x14, 0xBD, 0xFF, 0xCF, 0x8B, 0xFF, 0xF4, 0xB4, 0xFF, 0x91, 0x83, 0xFF, 0x91, 0x83, 0xFF, 0x92, 0x83, 0xFF, 0x0F, 0x73, 0xFF, 0xB2, 0x83, 0xFF, 0xD2, 0x8B, 0xFF, 0xB3, 0x83, 0xFF, 0xD3, 0x83, 0xFF, 0x93, 0x83, 0xFF, 0xF4, 0x8B, 0xFF, 0xBB, 0xB4, 0xFF, 0xE8, 0x20, 0xFF, 0x29, 0x29, 0xFF, 0xE9, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0xEA, 0x20, 0xFF, 0x0A, 0x29, 0xFF, 0x09, 0x21, 0xFF, 0xEA, 0x20, 0xFF, 0xB1, 0x62, 0xFF, 0xEB, 0x20, 0xFF, 0x30, 0x4A, 0xFF, 0x2D, 0x29, 0xFF, 0xB2, 0x5A, 0xFF, 0x11, 0x4A, 0xFF, 0xD0, 0x41, 0xFF, 0x71, 0x31, 0xFF, 0x35, 0x52, 0xFF, 0x7A, 0xBD, 0xFF, 0x8E, 0x39, 0xFF, 0xCF, 0x39, 0xFF, 0x71, 0x52, 0xFF, 0xCE, 0x39, 0xFF, 0xCF, 0x41, 0xFF, 0xF2, 0x62, 0xFF, 0xF2, 0x62, 0xFF, 0xDE, 0xD6, 0xFF, 0xCD, 0x41, 0xFF, 0x8C, 0x39, 0xFF, 0x12, 0x6B, 0xFF, 0xED, 0x49, 0xFF, 0xCC, 0x41, 0xFF, 0xCF, 0x5A, 0xFF, 0x30, 0x73, 0xFF, 0x53, 0x94, 0xFF, 0xCE, 0x6A, 0xFF, 0xCD, 0x6A, 0xFF, 0x93, 0xCC, 0xFF, 0x50, 0x83, 0xFF, 0xCF, 0x6A, 0xFF, 0xEE, 0x72, 0xFF, 0x8D, 0x62, 0xFF, 0x0F, 0x7B, 0xFF, 0x0F, 0x73, 0xFF, 0xD2, 0x93, 0xFF, 0xFA, 0xE5, 0xFF, 0x75, 0xA4, 0xFF, 0x71, 0x83, 0xFF,
-    0x71, 0x7B, 0xFF, 0x2C, 0x52, 0xFF, 0x8F, 0x62, 0xFF, 0x35, 0x9C, 0xFF, 0x51, 0x83, 0xFF, 0x31, 0x73, 0xFF, 0x92, 0x83, 0xFF, 0xAD, 0x62, 0xFF, 0x91, 0x83, 0xFF, 0xEE, 0x6A, 0xFF, 0xF1, 0x8B, 0xFF, 0xD0, 0x8B, 0xFF, 0x31, 0x9C, 0xFF, 0x51, 0x9C, 0xFF, 0x13, 0xBD, 0xFF, 0xEF, 0x93, 0xFF, 0x74, 0xC5, 0xFF, 0xD0, 0x8B, 0xFF, 0x31, 0x94, 0xFF, 0xB0, 0x83, 0xFF, 0xB1, 0x83, 0xFF, 0x50, 0x73, 0xFF, 0x50, 0x7B, 0xFF, 0x30, 0x73, 0xFF, 0x50, 0x7B, 0xFF, 0x91, 0x83, 0xFF, 0xD2, 0x8B, 0xFF, 0x93, 0x83, 0xFF, 0xB3, 0x83, 0xFF, 0x93, 0x83, 0xFF, 0xD4, 0x83, 0xFF, 0x94, 0x83, 0xFF, 0xC8, 0x18, 0xFF, 0xE8, 0x20, 0xFF, 0x0A, 0x21, 0xFF, 0x09, 0x29, 0xFF, 0x6B, 0x31, 0xFF, 0x09, 0x21, 0xFF, 0x0A, 0x29, 0xFF, 0x4B, 0x31, 0xFF, 0x0B, 0x29, 0xFF, 0xAE, 0x39, 0xFF, 0x0B, 0x29, 0xFF, 0x92, 0x5A, 0xFF, 0x4D, 0x31, 0xFF, 0x51, 0x4A, 0xFF, 0x14, 0x63, 0xFF, 0x6D, 0x31, 0xFF, 0x4D, 0x31, 0xFF, 0xF0, 0x41, 0xFF, 0x72, 0x52, 0xFF, 0xCF, 0x39, 0xFF, 0xD0, 0x39, 0xFF, 0x52, 0x42, 0xFF, 0xCF, 0x39, 0xFF, 0xCF, 0x41, 0xFF, 0x8F, 0x5A, 0xFF, 0xD1, 0x62, 0xFF, 0x33, 0x73, 0xFF, 0x6C, 0x31, 0xFF, 0x6B, 0x39, 0xFF, 0xF1, 0x6A, 0xFF, 0xAB, 0x41, 0xFF, 0x92, 0x83, 0xFF,
-    0xAB, 0x41, 0xFF, 0x6E, 0x62, 0xFF, 0x72, 0x7B, 0xFF, 0x2C, 0x52, 0xFF, 0x2C, 0x52, 0xFF, 0xEB, 0x49, 0xFF, 0xAD, 0x62, 0xFF, 0xCF, 0x6A, 0xFF, 0xAD, 0x62, 0xFF, 0x6C, 0x5A, 0xFF, 0xAE, 0x6A, 0xFF, 0x0F, 0x6B, 0xFF, 0x50, 0x83, 0xFF, 0x71, 0x83, 0xFF, 0xEF, 0x72, 0xFF, 0x10, 0x73, 0xFF, 0xCF, 0x6A, 0xFF, 0x4D, 0x52, 0xFF, 0x4E, 0x5A, 0xFF, 0xB4, 0x8B, 0xFF, 0xD0, 0x72, 0xFF, 0xF0, 0x72, 0xFF, 0x10, 0x73, 0xFF, 0x4C, 0x5A, 0xFF, 0xCE, 0x6A, 0xFF, 0xCE, 0x6A, 0xFF, 0x0F, 0x73, 0xFF, 0x90, 0x8B, 0xFF, 0x31, 0x9C, 0xFF, 0x31, 0xA4, 0xFF, 0x72, 0xAC, 0xFF, 0x6E, 0x83, 0xFF, 0xD0, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x83, 0xFF, 0x11, 0x94, 0xFF, 0x2F, 0x73, 0xFF, 0x78, 0xB5, 0xFF, 0xF1, 0x8B, 0xFF, 0x30, 0x7B, 0xFF, 0x71, 0x83, 0xFF, 0xB2, 0x83, 0xFF, 0x91, 0x83, 0xFF, 0x34, 0x9C, 0xFF, 0xD4, 0x8B, 0xFF, 0x93, 0x83, 0xFF, 0x73, 0x7B, 0xFF, 0x74, 0x7B, 0xFF, 0x2B, 0x29, 0xFF, 0xEF, 0x41, 0xFF, 0x15, 0x63, 0xFF, 0xAF, 0x39, 0xFF, 0x51, 0x52, 0xFF, 0xCF, 0x41, 0xFF, 0x10, 0x4A, 0xFF, 0x4C, 0x31, 0xFF, 0x16, 0x63, 0xFF, 0x93, 0x5A, 0xFF, 0x4D, 0x31, 0xFF, 0xB5, 0x5A, 0xFF, 0x37, 0x6B, 0xFF, 0x19, 0x63, 0xFF, 0x37, 0x6B, 0xFF, 0xB9, 0x6B, 0xFF,
-    0x99, 0x7B, 0xFF, 0x76, 0x73, 0xFF, 0xD0, 0x39, 0xFF, 0xD8, 0x7B, 0xFF, 0xFF, 0x74, 0xFF, 0x9F, 0x67, 0xFF, 0x3D, 0x6C, 0xFF, 0x98, 0x73, 0xFF, 0x79, 0xE5, 0xFF, 0x99, 0xC4, 0xFF, 0xDE, 0xCD, 0xFF, 0x38, 0x8C, 0xFF, 0x8B, 0x39, 0xFF, 0x5F, 0xDE, 0xFF, 0xBF, 0xF7, 0xFF, 0xB5, 0x7B, 0xFF, 0x0D, 0x4A, 0xFF, 0x4D, 0x5A, 0xFF, 0xBD, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x5A, 0xFF, 0x10, 0x73, 0xFF, 0xF3, 0x93, 0xFF, 0x35, 0xA4, 0xFF, 0xB2, 0x83, 0xFF, 0x8D, 0x5A, 0xFF, 0xAE, 0x6A, 0xFF, 0x7A, 0xCD, 0xFF, 0x39, 0xCD, 0xFF, 0xD3, 0x93, 0xFF, 0xAE, 0x6A, 0xFF, 0xF5, 0x9B, 0xFF, 0x16, 0x9C, 0xFF, 0x77, 0xA4, 0xFF, 0x51, 0x83, 0xFF, 0x34, 0x8B, 0xFF, 0xBF, 0xF4, 0xFF, 0x3C, 0xCD, 0xFF, 0xD1, 0x7A, 0xFF, 0x54, 0x83, 0xFF, 0x39, 0xC5, 0xFF, 0xBA, 0xBC, 0xFF, 0xDA, 0xD5, 0xFF, 0x10, 0x8B, 0xFF, 0xD5, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0x97, 0xAC, 0xFF, 0x53, 0x83, 0xFF, 0xFB, 0xBC, 0xFF, 0x95, 0xAC, 0xFF, 0x36, 0xA4, 0xFF, 0xD3, 0x93, 0xFF, 0x59, 0xAC, 0xFF, 0x52, 0x8B, 0xFF, 0xB8, 0xC4, 0xFF, 0xDF, 0xFF, 0xFF, 0x76, 0xBC, 0xFF, 0x78, 0xBC, 0xFF, 0xB9, 0xA3, 0xFF, 0x37, 0xA4, 0xFF, 0xD6, 0x93, 0xFF, 0x9F, 0xF6, 0xFF,
-    0xEE, 0x31, 0xFF, 0x12, 0x63, 0xFF, 0x2A, 0x29, 0xFF, 0x2B, 0x29, 0xFF, 0xAE, 0x39, 0xFF, 0xC9, 0x18, 0xFF, 0x0A, 0x29, 0xFF, 0xD3, 0x5A, 0xFF, 0x2B, 0x31, 0xFF, 0x0B, 0x29, 0xFF, 0xF4, 0x62, 0xFF, 0x8F, 0x39, 0xFF, 0x2D, 0x31, 0xFF, 0xF9, 0x6B, 0xFF, 0xF7, 0x52, 0xFF, 0xD1, 0x39, 0xFF, 0x2D, 0x31, 0xFF, 0x51, 0x52, 0xFF, 0x12, 0x42, 0xFF, 0xF7, 0x52, 0xFF, 0x9D, 0x53, 0xFF, 0xBF, 0x26, 0xFF, 0xBF, 0x6D, 0xFF, 0xB4, 0x62, 0xFF, 0x76, 0xD4, 0xFF, 0x9E, 0xD5, 0xFF, 0x71, 0x5A, 0xFF, 0xB2, 0x5A, 0xFF, 0xAD, 0x41, 0xFF, 0x91, 0x52, 0xFF, 0x53, 0x73, 0xFF, 0x4E, 0x39, 0xFF, 0xAE, 0x41, 0xFF, 0xD7, 0x93, 0xFF, 0x9F, 0xC5, 0xFF, 0x11, 0x63, 0xFF, 0x5E, 0xC5, 0xFF, 0xEC, 0x49, 0xFF, 0x54, 0x83, 0xFF, 0xF2, 0x6A, 0xFF, 0x50, 0x5A, 0xFF, 0x0C, 0x52, 0xFF, 0x2E, 0x5A, 0xFF, 0xCC, 0x49, 0xFF, 0x0D, 0x52, 0xFF, 0xF3, 0x7A, 0xFF, 0x6F, 0x62, 0xFF, 0x12, 0x73, 0xFF, 0x12, 0x7B, 0xFF, 0xCE, 0x49, 0xFF, 0x92, 0x72, 0xFF, 0x5C, 0xBB, 0xFF, 0x9D, 0xEE, 0xFF, 0x74, 0x7A, 0xFF, 0xD1, 0x72, 0xFF, 0x2F, 0x62, 0xFF, 0x8F, 0x6A, 0xFF, 0xEF, 0x7A, 0xFF, 0x32, 0x83, 0xFF, 0x52, 0x93, 0xFF, 0x73, 0x9B, 0xFF, 0x18, 0xFD, 0xFF, 0x96, 0xD4, 0xFF, 0x14, 0xA4, 0xFF,
-    0xAE, 0x72, 0xFF, 0xAF, 0x6A, 0xFF, 0xF0, 0x7A, 0xFF, 0x31, 0x7B, 0xFF, 0xD0, 0x72, 0xFF, 0xF0, 0x72, 0xFF, 0x52, 0x83, 0xFF, 0x12, 0x7B, 0xFF, 0x73, 0x8B, 0xFF, 0xB5, 0xAB, 0xFF, 0x53, 0x8B, 0xFF, 0x54, 0x83, 0xFF, 0x77, 0x93, 0xFF, 0x55, 0x8B, 0xFF, 0x34, 0x7B, 0xFF, 0x35, 0x83, 0xFF, 0x29, 0x21, 0xFF, 0xCC, 0x41, 0xFF, 0x4B, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0x0A, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xAD, 0x39, 0xFF, 0xEA, 0x20, 0xFF, 0xEA, 0x20, 0xFF, 0xEE, 0x41, 0xFF, 0x0B, 0x29, 0xFF, 0x0B, 0x29, 0xFF, 0x31, 0x4A, 0xFF, 0x8E, 0x31, 0xFF, 0x72, 0x52, 0xFF, 0x0B, 0x21, 0xFF, 0x10, 0x4A, 0xFF, 0xAE, 0x31, 0xFF, 0x73, 0x52, 0xFF, 0xB5, 0x52, 0xFF, 0xF1, 0x31, 0xFF, 0x37, 0x53, 0xFF, 0x51, 0x52, 0xFF, 0x51, 0x5A, 0xFF, 0x71, 0x5A, 0xFF, 0x50, 0x52, 0xFF, 0x2F, 0x4A, 0xFF, 0x8C, 0x39, 0xFF, 0xEE, 0x41, 0xFF, 0xB1, 0x5A, 0xFF, 0x30, 0x42, 0xFF, 0x8C, 0x39, 0xFF, 0xED, 0x49, 0xFF, 0xF3, 0x62, 0xFF, 0x91, 0x5A, 0xFF, 0xD3, 0x62, 0xFF, 0xED, 0x49, 0xFF, 0xB0, 0x62, 0xFF, 0x90, 0x5A, 0xFF, 0x2E, 0x52, 0xFF, 0x4D, 0x5A, 0xFF, 0x6E, 0x5A, 0xFF, 0xEC, 0x49, 0xFF, 0x0D, 0x52, 0xFF, 0xAF, 0x62, 0xFF, 0x0D, 0x52, 0xFF, 0xAF, 0x62, 0xFF,
-    0x16, 0xB4, 0xFF, 0xB0, 0x6A, 0xFF, 0x0D, 0x5A, 0xFF, 0x92, 0x72, 0xFF, 0x71, 0x72, 0xFF, 0x50, 0x62, 0xFF, 0x2E, 0x62, 0xFF, 0x4E, 0x62, 0xFF, 0x6E, 0x6A, 0xFF, 0x8E, 0x6A, 0xFF, 0x71, 0x8B, 0xFF, 0xCF, 0x7A, 0xFF, 0xCF, 0x7A, 0xFF, 0x31, 0x8B, 0xFF, 0x72, 0x93, 0xFF, 0x11, 0x83, 0xFF, 0x8F, 0x6A, 0xFF, 0xD0, 0x72, 0xFF, 0xAF, 0x72, 0xFF, 0x11, 0x7B, 0xFF, 0xF1, 0x72, 0xFF, 0xF1, 0x72, 0xFF, 0x11, 0x73, 0xFF, 0xF1, 0x72, 0xFF, 0x53, 0x83, 0xFF, 0x12, 0x7B, 0xFF, 0x33, 0x83, 0xFF, 0x54, 0x83, 0xFF, 0x54, 0x83, 0xFF, 0x34, 0x83, 0xFF, 0x55, 0x83, 0xFF, 0x55, 0x83, 0xFF, 0xC8, 0x18, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xE9, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0x4B, 0x31, 0xFF, 0x0A, 0x29, 0xFF, 0xEA, 0x20, 0xFF, 0xEA, 0x20, 0xFF, 0x8D, 0x39, 0xFF, 0xEB, 0x20, 0xFF, 0x0B, 0x29, 0xFF, 0x6D, 0x31, 0xFF, 0x4D, 0x29, 0xFF, 0x92, 0x5A, 0xFF, 0x8D, 0x39, 0xFF, 0x10, 0x42, 0xFF, 0xCF, 0x39, 0xFF, 0xAF, 0x31, 0xFF, 0x52, 0x4A, 0xFF, 0x31, 0x42, 0xFF, 0x10, 0x42, 0xFF, 0xAE, 0x39, 0xFF, 0x10, 0x4A, 0xFF, 0x31, 0x4A, 0xFF, 0x0F, 0x42, 0xFF, 0x50, 0x52, 0xFF, 0x8C, 0x39, 0xFF, 0xCD, 0x41, 0xFF, 0x0F, 0x4A, 0xFF, 0xAC, 0x41, 0xFF,
-    0x4C, 0x31, 0xFF, 0x0E, 0x4A, 0xFF, 0x55, 0x6B, 0xFF, 0x10, 0x4A, 0xFF, 0xD8, 0x7B, 0xFF, 0x0E, 0x4A, 0xFF, 0xD2, 0x6A, 0xFF, 0xB2, 0x5A, 0xFF, 0x92, 0x62, 0xFF, 0x4D, 0x52, 0xFF, 0x4E, 0x5A, 0xFF, 0x8B, 0x41, 0xFF, 0x2D, 0x52, 0xFF, 0x4E, 0x5A, 0xFF, 0x4D, 0x5A, 0xFF, 0xD0, 0x6A, 0xFF, 0x6E, 0x5A, 0xFF, 0x4E, 0x5A, 0xFF, 0xED, 0x51, 0xFF, 0x2F, 0x62, 0xFF, 0x4F, 0x62, 0xFF, 0x70, 0x6A, 0xFF, 0x6F, 0x62, 0xFF, 0x6E, 0x62, 0xFF, 0x6E, 0x6A, 0xFF, 0xAE, 0x72, 0xFF, 0x92, 0xA3, 0xFF, 0xAF, 0x7A, 0xFF, 0x0D, 0x5A, 0xFF, 0xF0, 0x7A, 0xFF, 0x32, 0x83, 0xFF, 0xB0, 0x72, 0xFF, 0x8F, 0x6A, 0xFF, 0xD1, 0x72, 0xFF, 0xB0, 0x6A, 0xFF, 0xD1, 0x72, 0xFF, 0x12, 0x7B, 0xFF, 0x12, 0x7B, 0xFF, 0xF1, 0x72, 0xFF, 0xD1, 0x72, 0xFF, 0x12, 0x7B, 0xFF, 0xF2, 0x72, 0xFF, 0x33, 0x83, 0xFF, 0x33, 0x7B, 0xFF, 0x55, 0x83, 0xFF, 0x34, 0x83, 0xFF, 0x55, 0x83, 0xFF, 0x15, 0x7B, 0xFF, 0x09, 0x21, 0xFF, 0xC9, 0x20, 0xFF, 0x0B, 0x21, 0xFF, 0xE9, 0x20, 0xFF, 0x2A, 0x29, 0xFF, 0x2B, 0x31, 0xFF, 0x70, 0x52, 0xFF, 0xCF, 0x41, 0xFF, 0xEF, 0x41, 0xFF, 0x8D, 0x39, 0xFF, 0xCF, 0x41, 0xFF, 0xF6, 0x62, 0xFF, 0x37, 0x6B, 0xFF, 0x12, 0x3A, 0xFF, 0xFA, 0x6B, 0xFF, 0x9A, 0x5B, 0xFF,
-    0xBC, 0x6C, 0xFF, 0x93, 0x4A, 0xFF, 0xDF, 0x75, 0xFF, 0x9D, 0xB6, 0xFF, 0x73, 0x3A, 0xFF, 0x9F, 0x64, 0xFF, 0x9A, 0x5C, 0xFF, 0xBF, 0xEE, 0xFF, 0x36, 0x6B, 0xFF, 0x72, 0x5A, 0xFF, 0xD6, 0x7B, 0xFF, 0xDA, 0x94, 0xFF, 0xF8, 0x8C, 0xFF, 0xF2, 0x62, 0xFF, 0x7F, 0xD6, 0xFF, 0xBF, 0xA5, 0xFF, 0x5A, 0x9E, 0xFF, 0x0E, 0x4A, 0xFF, 0xBA, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xC6, 0xFF, 0xCD, 0x39, 0xFF, 0x38, 0x8C, 0xFF, 0xBC, 0x9C, 0xFF, 0x9D, 0x9C, 0xFF, 0xCE, 0x62, 0xFF, 0x72, 0x7B, 0xFF, 0xBC, 0xD5, 0xFF, 0x12, 0x7B, 0xFF, 0x32, 0x83, 0xFF, 0xF3, 0x7A, 0xFF, 0x54, 0x83, 0xFF, 0xD0, 0x7A, 0xFF, 0x14, 0x83, 0xFF, 0x18, 0xA4, 0xFF, 0xB7, 0x9B, 0xFF, 0x3E, 0xEE, 0xFF, 0x1F, 0xEE, 0xFF, 0xB8, 0xAB, 0xFF, 0x38, 0xB4, 0xFF, 0x1D, 0xD5, 0xFF, 0x11, 0x9B, 0xFF, 0x1D, 0xFE, 0xFF, 0x3B, 0xDD, 0xFF, 0x7E, 0xE5, 0xFF, 0xBF, 0xFF, 0xFF, 0x78, 0xC4, 0xFF, 0x5C, 0xD5, 0xFF, 0xDF, 0xFF, 0xFF, 0xF8, 0xAB, 0xFF, 0x77, 0x9B, 0xFF, 0x36, 0x9B, 0xFF, 0x7E, 0xE5, 0xFF, 0x34, 0x8B, 0xFF, 0x77, 0x93, 0xFF, 0x13, 0x7B, 0xFF, 0x33, 0x83, 0xFF, 0xF9, 0xCC, 0xFF, 0xB6, 0x93, 0xFF, 0x5A, 0xAC, 0xFF, 0xF4, 0x82, 0xFF, 0xF9, 0xA3, 0xFF, 0x77, 0x8B, 0xFF, 0x37, 0x8B, 0xFF,
-    0xF0, 0x51, 0xFF, 0xE8, 0x20, 0xFF, 0xB2, 0x52, 0xFF, 0xB2, 0x5A, 0xFF, 0x09, 0x29, 0xFF, 0xCA, 0x20, 0xFF, 0x4B, 0x31, 0xFF, 0xC9, 0x20, 0xFF, 0x72, 0x52, 0xFF, 0x0A, 0x29, 0xFF, 0xED, 0x41, 0xFF, 0xAD, 0x39, 0xFF, 0x4F, 0x52, 0xFF, 0xD4, 0x62, 0xFF, 0xCE, 0x41, 0xFF, 0x30, 0x4A, 0xFF, 0x0F, 0x4A, 0xFF, 0xEF, 0x41, 0xFF, 0xEF, 0x39, 0xFF, 0xF7, 0x7B, 0xFF, 0x8C, 0x39, 0xFF, 0x13, 0x63, 0xFF, 0xEF, 0x41, 0xFF, 0x8C, 0x31, 0xFF, 0x96, 0x7B, 0xFF, 0x4F, 0x52, 0xFF, 0x71, 0x52, 0xFF, 0xB2, 0x5A, 0xFF, 0x0E, 0x4A, 0xFF, 0x17, 0x94, 0xFF, 0x6F, 0x52, 0xFF, 0x4F, 0x4A, 0xFF, 0xB1, 0x52, 0xFF, 0x2D, 0x4A, 0xFF, 0x16, 0x9C, 0xFF, 0xF0, 0x41, 0xFF, 0x14, 0x63, 0xFF, 0xCC, 0x41, 0xFF, 0x50, 0x5A, 0xFF, 0xF5, 0x8B, 0xFF, 0x4E, 0x5A, 0xFF, 0x6D, 0x5A, 0xFF, 0x6E, 0x5A, 0xFF, 0x2C, 0x4A, 0xFF, 0x55, 0xAC, 0xFF, 0x4D, 0x5A, 0xFF, 0xCF, 0x6A, 0xFF, 0xAF, 0x62, 0xFF, 0x4D, 0x5A, 0xFF, 0x76, 0xAC, 0xFF, 0xEC, 0x51, 0xFF, 0xEC, 0x51, 0xFF, 0x4D, 0x62, 0xFF, 0x4E, 0x62, 0xFF, 0xF8, 0xCC, 0xFF, 0x0D, 0x62, 0xFF, 0x4D, 0x6A, 0xFF, 0xB0, 0x7A, 0xFF, 0xD0, 0x7A, 0xFF, 0xB0, 0x7A, 0xFF, 0xFD, 0xDD, 0xFF, 0x2F, 0x6A, 0xFF, 0xF3, 0x7A, 0xFF, 0x92, 0x72, 0xFF,
-    0x32, 0x6A, 0xFF, 0x1D, 0xDE, 0xFF, 0x72, 0x6A, 0xFF, 0x92, 0x72, 0xFF, 0x93, 0x72, 0xFF, 0x92, 0x6A, 0xFF, 0x7E, 0xCD, 0xFF, 0xD2, 0x72, 0xFF, 0xD2, 0x72, 0xFF, 0xF3, 0x72, 0xFF, 0x13, 0x7B, 0xFF, 0xBA, 0xB4, 0xFF, 0x55, 0x83, 0xFF, 0x15, 0x7B, 0xFF, 0x15, 0x7B, 0xFF, 0xB5, 0x7A, 0xFF, 0xC7, 0x20, 0xFF, 0xC7, 0x18, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0x72, 0x4C, 0xFF, 0x0D, 0x4A, 0xFF, 0x2B, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0x8B, 0x39, 0xFF, 0xE9, 0x20, 0xFF, 0xAD, 0x41, 0xFF, 0xB2, 0x62, 0xFF, 0x32, 0x52, 0xFF, 0x0A, 0x29, 0xFF, 0x0E, 0x4A, 0xFF, 0xD2, 0x5A, 0xFF, 0x70, 0x52, 0xFF, 0xEF, 0x49, 0xFF, 0xCE, 0x41, 0xFF, 0x50, 0x52, 0xFF, 0xEE, 0x41, 0xFF, 0x91, 0x52, 0xFF, 0x0E, 0x42, 0xFF, 0xAD, 0x39, 0xFF, 0x2F, 0x4A, 0xFF, 0xB1, 0x5A, 0xFF, 0x70, 0x52, 0xFF, 0xB1, 0x5A, 0xFF, 0xED, 0x41, 0xFF, 0x0D, 0x42, 0xFF, 0x90, 0x52, 0xFF, 0xB0, 0x5A, 0xFF, 0xF1, 0x52, 0xFF, 0x0E, 0x42, 0xFF, 0x50, 0x4A, 0xFF, 0x8F, 0x42, 0xFF, 0xBD, 0x9C, 0xFF, 0x2D, 0x4A, 0xFF, 0xD2, 0x6A, 0xFF, 0x4D, 0x4A, 0xFF, 0x70, 0x5A, 0xFF, 0x91, 0x73, 0xFF, 0x4E, 0x5A, 0xFF, 0x0C, 0x4A, 0xFF, 0xCF, 0x6A, 0xFF, 0x8F, 0x62, 0xFF, 0x0C, 0x52, 0xFF, 0x52, 0x7B, 0xFF,
-    0x4D, 0x5A, 0xFF, 0xCB, 0x49, 0xFF, 0xCB, 0x49, 0xFF, 0x0E, 0x5A, 0xFF, 0xB0, 0x72, 0xFF, 0xCF, 0x72, 0xFF, 0x8E, 0x6A, 0xFF, 0xF0, 0x7A, 0xFF, 0x4D, 0x62, 0xFF, 0xB0, 0x72, 0xFF, 0xD1, 0x7A, 0xFF, 0x94, 0x93, 0xFF, 0x2F, 0x62, 0xFF, 0x0F, 0x62, 0xFF, 0x93, 0x72, 0xFF, 0x33, 0x72, 0xFF, 0x34, 0x72, 0xFF, 0x7A, 0x9B, 0xFF, 0x73, 0x6A, 0xFF, 0x74, 0x72, 0xFF, 0x92, 0x6A, 0xFF, 0x71, 0x6A, 0xFF, 0xF3, 0x7A, 0xFF, 0xD2, 0x72, 0xFF, 0xF2, 0x72, 0xFF, 0xD2, 0x72, 0xFF, 0x34, 0x7B, 0xFF, 0xB3, 0x72, 0xFF, 0x15, 0x7B, 0xFF, 0xF5, 0x7A, 0xFF, 0x16, 0x83, 0xFF, 0x16, 0x7B, 0xFF, 0xE8, 0x20, 0xFF, 0xC7, 0x18, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0x2D, 0x4A, 0xFF, 0x6A, 0x31, 0xFF, 0xE9, 0x20, 0xFF, 0x4A, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x4B, 0x31, 0xFF, 0x32, 0x63, 0xFF, 0x8C, 0x39, 0xFF, 0xC9, 0x18, 0xFF, 0x0E, 0x42, 0xFF, 0x5A, 0x95, 0xFF, 0x11, 0x63, 0xFF, 0xEE, 0x49, 0xFF, 0x4A, 0x29, 0xFF, 0x32, 0x53, 0xFF, 0x10, 0x52, 0xFF, 0xBD, 0xA4, 0xFF, 0x0E, 0x42, 0xFF, 0x10, 0x4A, 0xFF, 0x6F, 0x4A, 0xFF, 0xCD, 0x39, 0xFF, 0x2F, 0x4A, 0xFF, 0x15, 0x84, 0xFF, 0xEC, 0x31, 0xFF, 0x73, 0x63, 0xFF, 0xCF, 0x42, 0xFF, 0x32, 0x6B, 0xFF,
-    0xFF, 0xEF, 0xFF, 0x36, 0x65, 0xFF, 0x11, 0x53, 0xFF, 0x74, 0x74, 0xFF, 0xD7, 0x8C, 0xFF, 0x8A, 0x39, 0xFF, 0x72, 0x6A, 0xFF, 0x52, 0x63, 0xFF, 0x0C, 0x42, 0xFF, 0xEB, 0x41, 0xFF, 0xD0, 0x62, 0xFF, 0xCB, 0x41, 0xFF, 0xCC, 0x49, 0xFF, 0xB6, 0x8B, 0xFF, 0x4E, 0x5A, 0xFF, 0x37, 0x9C, 0xFF, 0xAC, 0x49, 0xFF, 0x0D, 0x52, 0xFF, 0xEC, 0x51, 0xFF, 0x90, 0x6A, 0xFF, 0x2D, 0x5A, 0xFF, 0x53, 0x8B, 0xFF, 0xCF, 0x7A, 0xFF, 0x94, 0x9B, 0xFF, 0x6F, 0x72, 0xFF, 0x16, 0x8B, 0xFF, 0x74, 0x9B, 0xFF, 0x71, 0x7A, 0xFF, 0xD2, 0x7A, 0xFF, 0x34, 0x8B, 0xFF, 0x57, 0x9B, 0xFF, 0x97, 0x8A, 0xFF, 0x7B, 0xA2, 0xFF, 0xDE, 0xAA, 0xFF, 0x77, 0x82, 0xFF, 0x19, 0x93, 0xFF, 0x94, 0x72, 0xFF, 0xD3, 0x7A, 0xFF, 0x92, 0x72, 0xFF, 0x30, 0x62, 0xFF, 0x13, 0x7B, 0xFF, 0xF4, 0x7A, 0xFF, 0xD3, 0x72, 0xFF, 0x15, 0x7B, 0xFF, 0x15, 0x7B, 0xFF, 0xD6, 0x7A, 0xFF, 0x18, 0x8B, 0xFF, 0xD7, 0x82, 0xFF, 0xE8, 0x20, 0xFF, 0x4A, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0xAC, 0x41, 0xFF, 0xE9, 0x28, 0xFF, 0x10, 0x52, 0xFF, 0x4D, 0x39, 0xFF, 0x0A, 0x31, 0xFF, 0x4A, 0x31, 0xFF, 0x4C, 0x31, 0xFF, 0x4B, 0x39, 0xFF, 0xB0, 0x49, 0xFF, 0x8D, 0x41, 0xFF, 0x94, 0x5A, 0xFF,
-    0x11, 0x52, 0xFF, 0x0F, 0x4A, 0xFF, 0x6D, 0x39, 0xFF, 0x15, 0x5B, 0xFF, 0xAD, 0x41, 0xFF, 0xEE, 0x49, 0xFF, 0x8C, 0x39, 0xFF, 0xD9, 0x63, 0xFF, 0x0E, 0x42, 0xFF, 0x8C, 0x39, 0xFF, 0xCB, 0x41, 0xFF, 0xD3, 0x5A, 0xFF, 0x4E, 0x52, 0xFF, 0xAB, 0x41, 0xFF, 0xB0, 0x5A, 0xFF, 0xF5, 0x5A, 0xFF, 0xB2, 0x5B, 0xFF, 0x6D, 0x42, 0xFF, 0x4E, 0x42, 0xFF, 0xDD, 0x84, 0xFF, 0xAF, 0x5A, 0xFF, 0x48, 0x31, 0xFF, 0x10, 0x7B, 0xFF, 0x9C, 0x84, 0xFF, 0x6E, 0x5A, 0xFF, 0xEB, 0x49, 0xFF, 0x4C, 0x52, 0xFF, 0xF7, 0x8B, 0xFF, 0x2C, 0x52, 0xFF, 0x15, 0xA4, 0xFF, 0xEC, 0x49, 0xFF, 0x9F, 0xF6, 0xFF, 0x2D, 0x62, 0xFF, 0x2D, 0x5A, 0xFF, 0xD1, 0x7A, 0xFF, 0xD7, 0x9B, 0xFF, 0x2C, 0x62, 0xFF, 0xBE, 0xE5, 0xFF, 0x78, 0xCC, 0xFF, 0xF7, 0xBB, 0xFF, 0x4D, 0x72, 0xFF, 0x37, 0xB4, 0xFF, 0x9A, 0xC4, 0xFF, 0x3B, 0xBC, 0xFF, 0x11, 0x6A, 0xFF, 0xBA, 0xAB, 0xFF, 0x37, 0xA3, 0xFF, 0xBF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xEB, 0xFF, 0xBF, 0xBB, 0xFF, 0x9F, 0xFF, 0xFF, 0x15, 0x72, 0xFF, 0xF6, 0x82, 0xFF, 0x93, 0x72, 0xFF, 0xF8, 0xA3, 0xFF, 0xF5, 0x82, 0xFF, 0xB4, 0x72, 0xFF, 0x3C, 0xB4, 0xFF, 0x17, 0x83, 0xFF, 0xDC, 0xAB, 0xFF, 0xFE, 0xB2, 0xFF, 0x9F, 0xF4, 0xFF, 0x1E, 0xBB, 0xFF,
-    0xA7, 0x20, 0xFF, 0x29, 0x29, 0xFF, 0xB4, 0x52, 0xFF, 0x08, 0x31, 0xFF, 0x1F, 0xFF, 0xFF, 0xC8, 0x20, 0xFF, 0xED, 0x49, 0xFF, 0xAB, 0x41, 0xFF, 0x50, 0x52, 0xFF, 0xE9, 0x28, 0xFF, 0x0B, 0x31, 0xFF, 0xF0, 0x51, 0xFF, 0xCA, 0x30, 0xFF, 0x52, 0x62, 0xFF, 0x0A, 0x31, 0xFF, 0xCD, 0x49, 0xFF, 0xCF, 0x49, 0xFF, 0x55, 0x7B, 0xFF, 0x6B, 0x39, 0xFF, 0xAD, 0x41, 0xFF, 0xFD, 0x9C, 0xFF, 0x4C, 0x39, 0xFF, 0x6B, 0x39, 0xFF, 0x6B, 0x39, 0xFF, 0xED, 0x49, 0xFF, 0x18, 0x8C, 0xFF, 0xD6, 0x83, 0xFF, 0xCC, 0x41, 0xFF, 0xAB, 0x39, 0xFF, 0xED, 0x41, 0xFF, 0xBB, 0xA4, 0xFF, 0xAC, 0x39, 0xFF, 0xEB, 0x41, 0xFF, 0x2C, 0x4A, 0xFF, 0xBF, 0xDE, 0xFF, 0x2D, 0x52, 0xFF, 0xF0, 0x62, 0xFF, 0x68, 0x31, 0xFF, 0xEB, 0x49, 0xFF, 0xBF, 0xC5, 0xFF, 0x32, 0x7B, 0xFF, 0xCA, 0x41, 0xFF, 0x0B, 0x52, 0xFF, 0xF0, 0x72, 0xFF, 0xD5, 0x93, 0xFF, 0x2F, 0x7B, 0xFF, 0xA9, 0x41, 0xFF, 0x8E, 0x62, 0xFF, 0xB5, 0xAC, 0xFF, 0xAD, 0x72, 0xFF, 0xC9, 0x49, 0xFF, 0x2B, 0x62, 0xFF, 0x98, 0xC4, 0xFF, 0x7D, 0xFF, 0xFF, 0xB4, 0xFE, 0xFF, 0x71, 0xFD, 0xFF, 0x2E, 0xB3, 0xFF, 0xD5, 0xAB, 0xFF, 0x70, 0x7A, 0xFF, 0x91, 0x7A, 0xFF, 0x71, 0x6A, 0xFF, 0x76, 0x92, 0xFF, 0x3D, 0xC3, 0xFF, 0x7F, 0xEC, 0xFF,
-    0xBF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0x5B, 0x92, 0xFF, 0x99, 0xA3, 0xFF, 0x39, 0xAC, 0xFF, 0x93, 0x72, 0xFF, 0x34, 0x72, 0xFF, 0x38, 0xA2, 0xFF, 0xD5, 0x82, 0xFF, 0x3D, 0xBC, 0xFF, 0x93, 0x72, 0xFF, 0x3C, 0x9B, 0xFF, 0x17, 0x8B, 0xFF, 0x9F, 0xBB, 0xFF, 0x9F, 0xCB, 0xFF, 0x1F, 0xE5, 0xFF, 0xA8, 0x18, 0xFF, 0x09, 0x29, 0xFF, 0xA8, 0x20, 0xFF, 0xD0, 0x5A, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x8B, 0x39, 0xFF, 0x72, 0x5A, 0xFF, 0x6B, 0x39, 0xFF, 0x2A, 0x31, 0xFF, 0x4B, 0x39, 0xFF, 0xEA, 0x30, 0xFF, 0xF4, 0x6A, 0xFF, 0x8D, 0x41, 0xFF, 0x6D, 0x41, 0xFF, 0x6C, 0x39, 0xFF, 0x6D, 0x41, 0xFF, 0x0F, 0x52, 0xFF, 0x95, 0x73, 0xFF, 0xEA, 0x30, 0xFF, 0xAD, 0x41, 0xFF, 0x6C, 0x41, 0xFF, 0xAD, 0x41, 0xFF, 0x37, 0x94, 0xFF, 0xAB, 0x41, 0xFF, 0xAB, 0x41, 0xFF, 0xCC, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0x57, 0x94, 0xFF, 0x4C, 0x4A, 0xFF, 0xEB, 0x41, 0xFF, 0xEB, 0x41, 0xFF, 0x8D, 0x5A, 0xFF, 0x35, 0x94, 0xFF, 0xCA, 0x39, 0xFF, 0xEF, 0x62, 0xFF, 0x28, 0x29, 0xFF, 0x6D, 0x62, 0xFF, 0x94, 0x83, 0xFF, 0x2C, 0x5A, 0xFF, 0xAA, 0x41, 0xFF, 0x2C, 0x52, 0xFF, 0x48, 0x39, 0xFF, 0x35, 0xA4, 0xFF, 0x2C, 0x52, 0xFF, 0xAA, 0x41, 0xFF, 0x2C, 0x52, 0xFF,
-    0x89, 0x41, 0xFF, 0x56, 0xBD, 0xFF, 0x4B, 0x62, 0xFF, 0xAE, 0x72, 0xFF, 0x4F, 0xA4, 0xFF, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x6F, 0xBB, 0xFF, 0xEF, 0x8A, 0xFF, 0x6D, 0x72, 0xFF, 0x2C, 0x6A, 0xFF, 0x58, 0xCD, 0xFF, 0x71, 0x72, 0xFF, 0x51, 0x72, 0xFF, 0x34, 0x8A, 0xFF, 0xDE, 0xCB, 0xFF, 0x3D, 0xBC, 0xFF, 0x33, 0x6A, 0xFF, 0x95, 0x72, 0xFF, 0x72, 0x6A, 0xFF, 0x92, 0x6A, 0xFF, 0xD7, 0x93, 0xFF, 0x50, 0x62, 0xFF, 0xB2, 0x6A, 0xFF, 0x92, 0x6A, 0xFF, 0x10, 0x62, 0xFF, 0x96, 0x93, 0xFF, 0x6E, 0x49, 0xFF, 0xD6, 0x7A, 0xFF, 0x17, 0x83, 0xFF, 0x37, 0x83, 0xFF, 0xC7, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x0A, 0x31, 0xFF, 0x0A, 0x31, 0xFF, 0xE9, 0x30, 0xFF, 0x2B, 0x39, 0xFF, 0x11, 0x62, 0xFF, 0x4D, 0x41, 0xFF, 0xCE, 0x51, 0xFF, 0x36, 0x7A, 0xFF, 0xF0, 0x59, 0xFF, 0x6D, 0x41, 0xFF, 0x92, 0x6A, 0xFF, 0x75, 0x72, 0xFF, 0xAE, 0x49, 0xFF, 0x8C, 0x41, 0xFF, 0x0F, 0x52, 0xFF, 0x0E, 0x52, 0xFF, 0x8C, 0x41, 0xFF, 0x90, 0x62, 0xFF, 0xB6, 0x83, 0xFF, 0xCB, 0x49, 0xFF, 0xAA, 0x39, 0xFF, 0x2C, 0x4A, 0xFF, 0x4C, 0x52, 0xFF, 0x0C, 0x52, 0xFF, 0xEB, 0x49, 0xFF,
-    0x2B, 0x32, 0xFF, 0x2C, 0x52, 0xFF, 0x0B, 0x4A, 0xFF, 0xF1, 0x73, 0xFF, 0x10, 0x63, 0xFF, 0x49, 0x31, 0xFF, 0x2C, 0x52, 0xFF, 0xD0, 0x5A, 0xFF, 0x2B, 0x52, 0xFF, 0x6C, 0x5A, 0xFF, 0xEB, 0x49, 0xFF, 0x89, 0x41, 0xFF, 0xEE, 0x6A, 0xFF, 0x0B, 0x52, 0xFF, 0x31, 0x73, 0xFF, 0x4C, 0x5A, 0xFF, 0x68, 0x39, 0xFF, 0x2C, 0x5A, 0xFF, 0x4C, 0x62, 0xFF, 0xCA, 0x51, 0xFF, 0x2B, 0x62, 0xFF, 0xB1, 0xAB, 0xFF, 0xCE, 0xCB, 0xFF, 0x0F, 0xDC, 0xFF, 0xCD, 0x92, 0xFF, 0xAE, 0x82, 0xFF, 0x8E, 0x72, 0xFF, 0x2C, 0x6A, 0xFF, 0x35, 0xDE, 0xFF, 0xEE, 0x61, 0xFF, 0xF0, 0x61, 0xFF, 0xF6, 0x8A, 0xFF, 0x74, 0x7A, 0xFF, 0x13, 0x6A, 0xFF, 0x12, 0x62, 0xFF, 0x73, 0x72, 0xFF, 0xD2, 0x7A, 0xFF, 0x70, 0x6A, 0xFF, 0x70, 0x6A, 0xFF, 0x2F, 0x62, 0xFF, 0xD2, 0x72, 0xFF, 0x71, 0x62, 0xFF, 0x51, 0x62, 0xFF, 0xF4, 0x72, 0xFF, 0xCF, 0x51, 0xFF, 0xD4, 0x72, 0xFF, 0x17, 0x7B, 0xFF, 0xD9, 0x9B, 0xFF, 0x09, 0x29, 0xFF, 0x87, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0x4A, 0x39, 0xFF, 0x0D, 0x50, 0xFF, 0x09, 0x31, 0xFF, 0x0A, 0x31, 0xFF, 0x6D, 0x49, 0xFF, 0x0F, 0x5A, 0xFF, 0x2A, 0x39, 0xFF, 0x4C, 0x41, 0xFF, 0xEE, 0x59, 0xFF, 0xB0, 0x59, 0xFF, 0x4D, 0x49, 0xFF, 0x8D, 0x51, 0xFF, 0x16, 0x83, 0xFF,
-    0x8F, 0x51, 0xFF, 0x8E, 0x51, 0xFF, 0xCE, 0x51, 0xFF, 0x71, 0x62, 0xFF, 0xCE, 0x51, 0xFF, 0x6C, 0x41, 0xFF, 0xCD, 0x49, 0xFF, 0x16, 0x73, 0xFF, 0xEF, 0x51, 0xFF, 0xAB, 0x41, 0xFF, 0x4D, 0x5A, 0xFF, 0xD1, 0x5A, 0xFF, 0x4C, 0x52, 0xFF, 0xAA, 0x41, 0xFF, 0x4D, 0x52, 0xFF, 0x11, 0x63, 0xFF, 0x2C, 0x4A, 0xFF, 0x0C, 0x52, 0xFF, 0xCA, 0x41, 0xFF, 0xD4, 0x7B, 0xFF, 0x6F, 0x9C, 0xFF, 0x89, 0x39, 0xFF, 0xEE, 0x6A, 0xFF, 0xB5, 0x73, 0xFF, 0x2C, 0x5A, 0xFF, 0xCA, 0x41, 0xFF, 0x6D, 0x5A, 0xFF, 0x72, 0x7B, 0xFF, 0xCA, 0x49, 0xFF, 0x4C, 0x5A, 0xFF, 0xCA, 0x49, 0xFF, 0xF2, 0x72, 0xFF, 0x88, 0x41, 0xFF, 0xEA, 0x51, 0xFF, 0x0F, 0x73, 0xFF, 0xD4, 0x93, 0xFF, 0x2B, 0x62, 0xFF, 0x2F, 0x8B, 0xFF, 0x71, 0x9B, 0xFF, 0x37, 0xBC, 0xFF, 0xAE, 0x7A, 0xFF, 0xAD, 0x7A, 0xFF, 0xB8, 0xC4, 0xFF, 0xB9, 0xCC, 0xFF, 0x6D, 0x6A, 0xFF, 0xED, 0x61, 0xFF, 0x9A, 0xBC, 0xFF, 0x74, 0x7A, 0xFF, 0xF0, 0x61, 0xFF, 0xAF, 0x59, 0xFF, 0x10, 0x62, 0xFF, 0xF5, 0x82, 0xFF, 0x30, 0x5A, 0xFF, 0x0F, 0x62, 0xFF, 0x12, 0x7B, 0xFF, 0xD1, 0x72, 0xFF, 0x53, 0x83, 0xFF, 0x90, 0x6A, 0xFF, 0xB2, 0x72, 0xFF, 0x14, 0x7B, 0xFF, 0x52, 0x62, 0xFF, 0xB4, 0x72, 0xFF, 0x95, 0x72, 0xFF, 0x95, 0x72, 0xFF,
-    0xE8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x4A, 0x39, 0xFF, 0x4A, 0x39, 0xFF, 0x10, 0x5A, 0xFF, 0xEA, 0x38, 0xFF, 0xAA, 0x30, 0xFF, 0x2B, 0x39, 0xFF, 0x0F, 0x5A, 0xFF, 0x6D, 0x49, 0xFF, 0x2D, 0x49, 0xFF, 0x4C, 0x41, 0xFF, 0x4D, 0x49, 0xFF, 0x74, 0x7A, 0xFF, 0x9C, 0xC4, 0xFF, 0xB4, 0x71, 0xFF, 0x50, 0x51, 0xFF, 0x52, 0x72, 0xFF, 0xD5, 0x7A, 0xFF, 0xAF, 0x59, 0xFF, 0xD2, 0x61, 0xFF, 0xEF, 0x51, 0xFF, 0xD2, 0x72, 0xFF, 0x6E, 0x49, 0xFF, 0xEE, 0x51, 0xFF, 0x98, 0x9C, 0xFF, 0x11, 0x6B, 0xFF, 0x8E, 0x5A, 0xFF, 0xCA, 0x49, 0xFF, 0xAA, 0x41, 0xFF, 0xB8, 0x94, 0xFF, 0x2B, 0x52, 0xFF, 0xAA, 0x41, 0xFF, 0x0C, 0x52, 0xFF, 0x4C, 0x52, 0xFF, 0xAB, 0x41, 0xFF, 0x8D, 0x62, 0xFF, 0x69, 0x31, 0xFF, 0xCC, 0x72, 0xFF, 0xD7, 0x7B, 0xFF, 0xCA, 0x49, 0xFF, 0xAA, 0x41, 0xFF, 0x2C, 0x52, 0xFF, 0xF4, 0x8B, 0xFF, 0x88, 0x41, 0xFF, 0x4C, 0x5A, 0xFF, 0xC9, 0x49, 0xFF, 0x2F, 0x73, 0xFF, 0xD3, 0x8B, 0xFF, 0xEA, 0x49, 0xFF, 0x2A, 0x5A, 0xFF, 0xD2, 0x93, 0xFF, 0xD4, 0x9B, 0xFF, 0xD1, 0x9B, 0xFF, 0x8D, 0x72, 0xFF, 0x4C, 0x72, 0xFF, 0x79, 0xD5, 0xFF, 0xAD, 0x82, 0xFF, 0xCF, 0xAB, 0xFF, 0xEE, 0xB3, 0xFF, 0x10, 0x9B, 0xFF, 0xBD, 0xAB, 0xFF, 0x0F, 0x6A, 0xFF, 0x50, 0x62, 0xFF,
-    0xD0, 0x61, 0xFF, 0xBE, 0xBB, 0xFF, 0xB4, 0x72, 0xFF, 0x2F, 0x62, 0xFF, 0x4F, 0x62, 0xFF, 0x91, 0x72, 0xFF, 0x9F, 0xC4, 0xFF, 0xD0, 0x72, 0xFF, 0xB0, 0x6A, 0xFF, 0x70, 0x62, 0xFF, 0xB2, 0x72, 0xFF, 0xF7, 0x82, 0xFF, 0x92, 0x6A, 0xFF, 0x73, 0x62, 0xFF, 0x95, 0x6A, 0xFF, 0x32, 0x62, 0xFF, 0xAC, 0x41, 0xFF, 0x0B, 0x41, 0xFF, 0xCF, 0x51, 0xFF, 0x0A, 0x31, 0xFF, 0xED, 0x48, 0xFF, 0x8E, 0x49, 0xFF, 0xCA, 0x30, 0xFF, 0xEF, 0x69, 0xFF, 0x2D, 0x49, 0xFF, 0xB0, 0x59, 0xFF, 0x3D, 0x85, 0xFF, 0xF4, 0x82, 0xFF, 0x1F, 0xB1, 0xFF, 0xB4, 0x79, 0xFF, 0x8F, 0x61, 0xFF, 0x36, 0x9B, 0xFF, 0x74, 0x82, 0xFF, 0x17, 0x9A, 0xFF, 0xB3, 0x71, 0xFF, 0x53, 0x69, 0xFF, 0x38, 0x84, 0xFF, 0x0E, 0x52, 0xFF, 0xD2, 0x61, 0xFF, 0x0F, 0x5A, 0xFF, 0x4F, 0x5A, 0xFF, 0xD5, 0x83, 0xFF, 0xF1, 0x72, 0xFF, 0xAA, 0x49, 0xFF, 0xD0, 0x6A, 0xFF, 0x11, 0x73, 0xFF, 0xCD, 0x49, 0xFF, 0x4D, 0x5A, 0xFF, 0x8E, 0x5A, 0xFF, 0x6D, 0x5A, 0xFF, 0x33, 0x73, 0xFF, 0x4E, 0x5A, 0xFF, 0x70, 0x83, 0xFF, 0x89, 0x39, 0xFF, 0x4C, 0x52, 0xFF, 0x54, 0x7B, 0xFF, 0x2B, 0x52, 0xFF, 0xC9, 0x41, 0xFF, 0x6C, 0x5A, 0xFF, 0xA9, 0x41, 0xFF, 0x52, 0x7B, 0xFF, 0xB2, 0x83, 0xFF, 0x48, 0x39, 0xFF, 0x2B, 0x52, 0xFF,
-    0x28, 0x39, 0xFF, 0xD0, 0x72, 0xFF, 0xC9, 0x41, 0xFF, 0xEC, 0x59, 0xFF, 0x8D, 0x6A, 0xFF, 0x98, 0xB4, 0xFF, 0x90, 0x8B, 0xFF, 0x6C, 0x6A, 0xFF, 0x2F, 0xAC, 0xFF, 0x0E, 0x93, 0xFF, 0x9C, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xBB, 0xFF, 0x6D, 0x6A, 0xFF, 0xF7, 0xAB, 0xFF, 0x79, 0xA3, 0xFF, 0x53, 0x8B, 0xFF, 0xBC, 0xF6, 0xFF, 0x6B, 0x49, 0xFF, 0x7F, 0xEC, 0xFF, 0xDF, 0xFD, 0xFF, 0xCB, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xC4, 0xFF, 0xF4, 0xAB, 0xFF, 0x75, 0x82, 0xFF, 0xF2, 0x7A, 0xFF, 0x91, 0x6A, 0xFF, 0x92, 0x6A, 0xFF, 0x98, 0x93, 0xFF, 0xD4, 0x72, 0xFF, 0x10, 0x62, 0xFF, 0x49, 0x51, 0xFF, 0x09, 0x39, 0xFF, 0xA8, 0x28, 0xFF, 0xB4, 0x4A, 0xFF, 0xCB, 0x38, 0xFF, 0x2F, 0x59, 0xFF, 0x8D, 0x48, 0xFF, 0x0E, 0x59, 0xFF, 0x92, 0x6A, 0xFF, 0xEF, 0x59, 0xFF, 0x18, 0x89, 0xFF, 0x8D, 0x69, 0xFF, 0xB0, 0xDB, 0xFF, 0xB4, 0x9B, 0xFF, 0xD5, 0xA2, 0xFF, 0xB2, 0x81, 0xFF, 0xD4, 0x80, 0xFF, 0x9E, 0xD1, 0xFF, 0x74, 0x89, 0xFF, 0xF8, 0x9B, 0xFF, 0xD0, 0x61, 0xFF, 0x53, 0x82, 0xFF, 0xEF, 0x61, 0xFF, 0x54, 0x72, 0xFF, 0xD7, 0x9C, 0xFF, 0x2E, 0x62, 0xFF, 0x0E, 0x5A, 0xFF, 0x8B, 0x49, 0xFF, 0x73, 0x7B, 0xFF, 0xD6, 0xA4, 0xFF, 0x71, 0x83, 0xFF, 0xCB, 0x49, 0xFF,
-    0xAC, 0x49, 0xFF, 0x2D, 0x5A, 0xFF, 0x77, 0x9C, 0xFF, 0x91, 0x7B, 0xFF, 0xAE, 0x72, 0xFF, 0x48, 0x31, 0xFF, 0x0B, 0x52, 0xFF, 0xB3, 0x7B, 0xFF, 0xA9, 0x49, 0xFF, 0x88, 0x39, 0xFF, 0xAA, 0x49, 0xFF, 0x68, 0x39, 0xFF, 0x15, 0x94, 0xFF, 0xEA, 0x51, 0xFF, 0x51, 0x73, 0xFF, 0x69, 0x41, 0xFF, 0x48, 0x39, 0xFF, 0x16, 0x9C, 0xFF, 0x4C, 0x52, 0xFF, 0x89, 0x49, 0xFF, 0x68, 0x41, 0xFF, 0x4C, 0x62, 0xFF, 0x57, 0xAC, 0xFF, 0xCA, 0x51, 0xFF, 0xD2, 0x9B, 0xFF, 0x09, 0x72, 0xFF, 0xEC, 0x8A, 0xFF, 0x7E, 0xFE, 0xFF, 0x1B, 0xDD, 0xFF, 0x51, 0x8B, 0xFF, 0x0C, 0x5A, 0xFF, 0x4D, 0x62, 0xFF, 0xBE, 0xFF, 0xFF, 0xD9, 0xAB, 0xFF, 0xAC, 0x49, 0xFF, 0xED, 0x51, 0xFF, 0xED, 0x59, 0xFF, 0x0C, 0x62, 0xFF, 0x98, 0xA3, 0xFF, 0x4E, 0x6A, 0xFF, 0x73, 0x83, 0xFF, 0xB0, 0x6A, 0xFF, 0x91, 0x6A, 0xFF, 0x36, 0x93, 0xFF, 0x10, 0x83, 0xFF, 0x92, 0x62, 0xFF, 0x94, 0x6A, 0xFF, 0x11, 0x62, 0xFF, 0xB4, 0xA1, 0xFF, 0xE9, 0x38, 0xFF, 0xCA, 0x40, 0xFF, 0x8A, 0x40, 0xFF, 0x53, 0x82, 0xFF, 0x30, 0x50, 0xFF, 0x1A, 0x90, 0xFF, 0x78, 0xB1, 0xFF, 0x30, 0x61, 0xFF, 0x75, 0x92, 0xFF, 0x8F, 0x61, 0xFF, 0x90, 0xAA, 0xFF, 0xB6, 0xC2, 0xFF, 0x59, 0xB0, 0xFF, 0xB2, 0x71, 0xFF, 0x39, 0xAA, 0xFF,
-    0x3F, 0xF8, 0xFF, 0x1E, 0xF3, 0xFF, 0xDE, 0xD0, 0xFF, 0x78, 0x92, 0xFF, 0xD4, 0x79, 0xFF, 0x16, 0xAB, 0xFF, 0x7C, 0x90, 0xFF, 0xF5, 0x82, 0xFF, 0x2F, 0x62, 0xFF, 0x0F, 0x62, 0xFF, 0x10, 0x62, 0xFF, 0x54, 0x7B, 0xFF, 0x4D, 0x5A, 0xFF, 0x4C, 0x5A, 0xFF, 0x0C, 0x5A, 0xFF, 0x74, 0x8B, 0xFF, 0xCA, 0x41, 0xFF, 0x4E, 0x83, 0xFF, 0x6C, 0x5A, 0xFF, 0x31, 0x73, 0xFF, 0x8C, 0x5A, 0xFF, 0x68, 0x31, 0xFF, 0x4B, 0x5A, 0xFF, 0x11, 0x6B, 0xFF, 0x0A, 0x52, 0xFF, 0x68, 0x39, 0xFF, 0xA9, 0x41, 0xFF, 0x73, 0x7B, 0xFF, 0xEA, 0x49, 0xFF, 0xC9, 0x41, 0xFF, 0x47, 0x39, 0xFF, 0x10, 0x73, 0xFF, 0xA9, 0x41, 0xFF, 0x68, 0x39, 0xFF, 0x68, 0x39, 0xFF, 0xB3, 0x8B, 0xFF, 0x27, 0x39, 0xFF, 0x2B, 0x5A, 0xFF, 0x0A, 0x52, 0xFF, 0x33, 0x83, 0xFF, 0xC9, 0x51, 0xFF, 0xEA, 0x59, 0xFF, 0x4B, 0x62, 0xFF, 0x16, 0xAC, 0xFF, 0x0B, 0x62, 0xFF, 0xAA, 0x49, 0xFF, 0xB0, 0x6A, 0xFF, 0xB2, 0x72, 0xFF, 0xEC, 0x51, 0xFF, 0xAB, 0x49, 0xFF, 0xB0, 0x72, 0xFF, 0x94, 0x93, 0xFF, 0x2E, 0x5A, 0xFF, 0xCC, 0x51, 0xFF, 0x6E, 0x62, 0xFF, 0xD0, 0x6A, 0xFF, 0xCC, 0x49, 0xFF, 0x90, 0x62, 0xFF, 0x0F, 0x52, 0xFF, 0x51, 0x5A, 0xFF, 0x30, 0x5A, 0xFF, 0x72, 0x62, 0xFF, 0x73, 0x62, 0xFF, 0x10, 0x5A, 0xFF,
-    0xC9, 0x38, 0xFF, 0xEB, 0x38, 0xFF, 0xCE, 0x50, 0xFF, 0x4A, 0x30, 0xFF, 0xB9, 0xAA, 0xFF, 0xCF, 0x60, 0xFF, 0xBB, 0xB8, 0xFF, 0x1C, 0xC8, 0xFF, 0xD1, 0x60, 0xFF, 0xF6, 0x88, 0xFF, 0x12, 0x72, 0xFF, 0x2D, 0x51, 0xFF, 0x70, 0x58, 0xFF, 0x5B, 0xA1, 0xFF, 0x36, 0x9A, 0xFF, 0x9D, 0xB9, 0xFF, 0x1F, 0xFE, 0xFF, 0x3F, 0xFE, 0xFF, 0x5F, 0xEA, 0xFF, 0x12, 0x71, 0xFF, 0xD1, 0x69, 0xFF, 0x72, 0x72, 0xFF, 0xD6, 0xAB, 0xFF, 0xAE, 0x51, 0xFF, 0xEC, 0x49, 0xFF, 0xD3, 0xDC, 0xFF, 0x32, 0x73, 0xFF, 0xEA, 0x49, 0xFF, 0x2A, 0x52, 0xFF, 0xCE, 0x62, 0xFF, 0x10, 0x6B, 0xFF, 0xAD, 0x62, 0xFF, 0x2A, 0x52, 0xFF, 0x6B, 0x5A, 0xFF, 0x6B, 0x5A, 0xFF, 0xEF, 0x72, 0xFF, 0x8B, 0x6A, 0xFF, 0x68, 0x31, 0xFF, 0x6A, 0x6A, 0xFF, 0xD4, 0x8B, 0xFF, 0x09, 0x5A, 0xFF, 0x47, 0x39, 0xFF, 0x2E, 0x7B, 0xFF, 0xEB, 0x49, 0xFF, 0xEE, 0x72, 0xFF, 0xA9, 0x41, 0xFF, 0x88, 0x41, 0xFF, 0xEA, 0x49, 0xFF, 0x67, 0x39, 0xFF, 0x68, 0x39, 0xFF, 0x68, 0x39, 0xFF, 0x68, 0x41, 0xFF, 0x72, 0x83, 0xFF, 0x8D, 0x6A, 0xFF, 0x88, 0x41, 0xFF, 0x6C, 0x62, 0xFF, 0x69, 0x41, 0xFF, 0xC9, 0x51, 0xFF, 0x12, 0xAC, 0xFF, 0x0A, 0x5A, 0xFF, 0x54, 0x83, 0xFF, 0x49, 0x41, 0xFF, 0x74, 0x9C, 0xFF, 0xCB, 0x49, 0xFF,
-    0x53, 0x83, 0xFF, 0x56, 0x83, 0xFF, 0x8B, 0x49, 0xFF, 0xAB, 0x49, 0xFF, 0x70, 0x6A, 0xFF, 0x6B, 0x41, 0xFF, 0x4E, 0x5A, 0xFF, 0x2D, 0x52, 0xFF, 0x4A, 0x39, 0xFF, 0x6F, 0x62, 0xFF, 0x0F, 0x5A, 0xFF, 0x10, 0x5A, 0xFF, 0x0F, 0x5A, 0xFF, 0x52, 0x5A, 0xFF, 0x52, 0x5A, 0xFF, 0xEF, 0x51, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xCC, 0x49, 0xFF, 0xEA, 0x30, 0xFF, 0xCC, 0x49, 0xFF, 0x6D, 0x49, 0xFF, 0x53, 0x60, 0xFF, 0x11, 0x6A, 0xFF, 0x0B, 0x39, 0xFF, 0x4B, 0x41, 0xFF, 0x0A, 0x41, 0xFF, 0xF2, 0x69, 0xFF, 0xF1, 0x61, 0xFF, 0x4F, 0x51, 0xFF, 0xB0, 0x61, 0xFF, 0x95, 0x92, 0xFF, 0x79, 0xB2, 0xFF, 0x18, 0xA1, 0xFF, 0xD9, 0x99, 0xFF, 0xD1, 0x61, 0xFF, 0x70, 0x6A, 0xFF, 0x93, 0x83, 0xFF, 0x10, 0x7B, 0xFF, 0x8E, 0x6A, 0xFF, 0x2C, 0x52, 0xFF, 0x52, 0x8C, 0xFF, 0xCF, 0x83, 0xFF, 0x4B, 0x52, 0xFF, 0x6B, 0x52, 0xFF, 0xCC, 0x62, 0xFF, 0x96, 0x94, 0xFF, 0x8F, 0x7B, 0xFF, 0xCE, 0x62, 0xFF, 0xE9, 0x41, 0xFF, 0xC8, 0x41, 0xFF, 0xAD, 0x62, 0xFF, 0xEA, 0x49, 0xFF, 0x88, 0x39, 0xFF, 0x88, 0x41, 0xFF, 0x32, 0x73, 0xFF, 0x8C, 0x5A, 0xFF, 0x47, 0x31, 0xFF, 0x88, 0x41, 0xFF, 0x26, 0x31, 0xFF, 0x30, 0x6B, 0xFF, 0xC9, 0x41, 0xFF, 0xCE, 0x62, 0xFF, 0x0A, 0x4A, 0xFF,
-    0xCF, 0x6A, 0xFF, 0x8D, 0x62, 0xFF, 0x88, 0x41, 0xFF, 0x88, 0x41, 0xFF, 0x06, 0x31, 0xFF, 0xB7, 0xA4, 0xFF, 0x68, 0x39, 0xFF, 0x68, 0x41, 0xFF, 0xCD, 0x72, 0xFF, 0xAF, 0x72, 0xFF, 0xAD, 0x6A, 0xFF, 0x88, 0x41, 0xFF, 0xF1, 0xE5, 0xFF, 0x6B, 0x49, 0xFF, 0x18, 0x8B, 0xFF, 0xF1, 0x93, 0xFF, 0x8A, 0x41, 0xFF, 0x6A, 0x39, 0xFF, 0x90, 0x62, 0xFF, 0xAC, 0x41, 0xFF, 0x2D, 0x5A, 0xFF, 0xCC, 0x49, 0xFF, 0x0E, 0x52, 0xFF, 0x19, 0x8B, 0xFF, 0xED, 0x51, 0xFF, 0x2E, 0x52, 0xFF, 0x2F, 0x52, 0xFF, 0xD2, 0x72, 0xFF, 0x30, 0x5A, 0xFF, 0x52, 0x62, 0xFF, 0x93, 0x62, 0xFF, 0x4C, 0x39, 0xFF, 0x6A, 0x39, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x2A, 0x31, 0xFF, 0x0D, 0x4A, 0xFF, 0x2C, 0x39, 0xFF, 0x2B, 0x39, 0xFF, 0x0B, 0x39, 0xFF, 0xAD, 0x51, 0xFF, 0x32, 0x73, 0xFF, 0x6C, 0x41, 0xFF, 0x2C, 0x41, 0xFF, 0x2E, 0x51, 0xFF, 0x6D, 0x51, 0xFF, 0x91, 0x72, 0xFF, 0xD9, 0xA2, 0xFF, 0x76, 0x8A, 0xFF, 0x91, 0x61, 0xFF, 0xCD, 0x59, 0xFF, 0xF5, 0xA4, 0xFF, 0x6E, 0x6A, 0xFF, 0xAF, 0x83, 0xFF, 0x91, 0x7B, 0xFF, 0xF1, 0x83, 0xFF, 0x53, 0xA5, 0xFF, 0x10, 0x8C, 0xFF, 0x0D, 0x63, 0xFF, 0x4B, 0x52, 0xFF, 0xCB, 0x62, 0xFF, 0x6C, 0x5A, 0xFF, 0x2A, 0x4A, 0xFF,
-    0xC9, 0x41, 0xFF, 0x6E, 0x73, 0xFF, 0x94, 0x94, 0xFF, 0x90, 0x83, 0xFF, 0xCA, 0x41, 0xFF, 0x88, 0x31, 0xFF, 0x8C, 0x5A, 0xFF, 0xB3, 0x73, 0xFF, 0x89, 0x39, 0xFF, 0x47, 0x31, 0xFF, 0x88, 0x39, 0xFF, 0x0F, 0x6B, 0xFF, 0xB5, 0x83, 0xFF, 0xA7, 0x39, 0xFF, 0x69, 0x31, 0xFF, 0x0B, 0x4A, 0xFF, 0x26, 0x31, 0xFF, 0x2B, 0x52, 0xFF, 0xAD, 0x62, 0xFF, 0x4C, 0x5A, 0xFF, 0xE6, 0x28, 0xFF, 0x13, 0x7B, 0xFF, 0x8E, 0x6A, 0xFF, 0xAE, 0x6A, 0xFF, 0xEB, 0x51, 0xFF, 0x49, 0x41, 0xFF, 0xAD, 0x49, 0xFF, 0xD3, 0x93, 0xFF, 0x89, 0x41, 0xFF, 0x8E, 0x62, 0xFF, 0x4A, 0x41, 0xFF, 0x38, 0x8B, 0xFF, 0x09, 0x39, 0xFF, 0xD3, 0x9B, 0xFF, 0x4B, 0x41, 0xFF, 0x4B, 0x41, 0xFF, 0xD7, 0x7A, 0xFF, 0xAB, 0x41, 0xFF, 0x1A, 0xEF, 0xFF, 0x4D, 0x5A, 0xFF, 0xEC, 0x49, 0xFF, 0xF7, 0x82, 0xFF, 0x90, 0x6A, 0xFF, 0x0F, 0x52, 0xFF, 0x50, 0x5A, 0xFF, 0x31, 0x5A, 0xFF, 0x73, 0x62, 0xFF, 0x8D, 0x41, 0xFF, 0xA7, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0x29, 0x31, 0xFF, 0xEC, 0x41, 0xFF, 0x48, 0x31, 0xFF, 0x2A, 0x39, 0xFF, 0x73, 0x59, 0xFF, 0xAD, 0x49, 0xFF, 0x4E, 0x5A, 0xFF, 0x73, 0x7B, 0xFF, 0x33, 0x9C, 0xFF, 0x0D, 0x5A, 0xFF, 0x6C, 0x41, 0xFF, 0xF3, 0x69, 0xFF, 0x55, 0x9C, 0xFF, 0x30, 0x6A, 0xFF,
-    0x5E, 0xA0, 0xFF, 0xD2, 0x69, 0xFF, 0xED, 0x59, 0xFF, 0xF4, 0xBD, 0xFF, 0x4D, 0x62, 0xFF, 0x6C, 0x5A, 0xFF, 0x8E, 0x7B, 0xFF, 0xD1, 0x7B, 0xFF, 0xF9, 0xFF, 0xFF, 0x74, 0xEF, 0xFF, 0x51, 0x94, 0xFF, 0xAF, 0x7B, 0xFF, 0xEB, 0x62, 0xFF, 0x16, 0xDF, 0xFF, 0x8D, 0x73, 0xFF, 0x4F, 0x6B, 0xFF, 0xE9, 0x41, 0xFF, 0x0A, 0x4A, 0xFF, 0xF5, 0x9C, 0xFF, 0x0F, 0x63, 0xFF, 0xEB, 0x49, 0xFF, 0x68, 0x31, 0xFF, 0x2B, 0x4A, 0xFF, 0x52, 0x6B, 0xFF, 0xA9, 0x41, 0xFF, 0x47, 0x31, 0xFF, 0xC9, 0x41, 0xFF, 0x10, 0x6B, 0xFF, 0x94, 0x83, 0xFF, 0xC9, 0x39, 0xFF, 0x28, 0x31, 0xFF, 0x4E, 0x5A, 0xFF, 0x48, 0x31, 0xFF, 0x52, 0x7B, 0xFF, 0x27, 0x31, 0xFF, 0x31, 0x7B, 0xFF, 0x48, 0x39, 0xFF, 0x89, 0x41, 0xFF, 0x96, 0x8B, 0xFF, 0x92, 0x8B, 0xFF, 0x48, 0x31, 0xFF, 0xAA, 0x41, 0xFF, 0xCB, 0x49, 0xFF, 0xF1, 0x7A, 0xFF, 0xCF, 0x6A, 0xFF, 0x8A, 0x41, 0xFF, 0xE8, 0x28, 0xFF, 0x94, 0x8B, 0xFF, 0x0A, 0x31, 0xFF, 0xD9, 0x82, 0xFF, 0x4A, 0x39, 0xFF, 0xED, 0x51, 0xFF, 0x6B, 0x41, 0xFF, 0x4B, 0x39, 0xFF, 0x95, 0x6A, 0xFF, 0x2E, 0x52, 0xFF, 0x4E, 0x5A, 0xFF, 0x0D, 0x52, 0xFF, 0xAD, 0x49, 0xFF, 0xB5, 0x7A, 0xFF, 0xEF, 0x51, 0xFF, 0x10, 0x52, 0xFF, 0x11, 0x5A, 0xFF, 0x2B, 0x31, 0xFF,
-    0xC7, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x66, 0x31, 0xFF, 0xCD, 0x51, 0xFF, 0xC9, 0x30, 0xFF, 0x4C, 0x41, 0xFF, 0x2D, 0x63, 0xFF, 0x76, 0xB5, 0xFF, 0x4B, 0x41, 0xFF, 0x53, 0x69, 0xFF, 0xCC, 0x49, 0xFF, 0x71, 0x6A, 0xFF, 0x6C, 0x51, 0xFF, 0x8B, 0x49, 0xFF, 0x8C, 0x49, 0xFF, 0x12, 0x8B, 0xFF, 0x2C, 0x5A, 0xFF, 0xAC, 0x62, 0xFF, 0x8B, 0x5A, 0xFF, 0xB2, 0x94, 0xFF, 0xCE, 0x83, 0xFF, 0x6C, 0x7B, 0xFF, 0xD1, 0xA4, 0xFF, 0xF7, 0xFF, 0xFF, 0x2B, 0x63, 0xFF, 0xA9, 0x5A, 0xFF, 0xAB, 0x5A, 0xFF, 0x31, 0x8C, 0xFF, 0x2F, 0x6B, 0xFF, 0xCD, 0x62, 0xFF, 0x4A, 0x52, 0xFF, 0x87, 0x31, 0xFF, 0x51, 0x73, 0xFF, 0x88, 0x39, 0xFF, 0x67, 0x31, 0xFF, 0x4B, 0x52, 0xFF, 0xCF, 0x5A, 0xFF, 0x89, 0x39, 0xFF, 0x27, 0x29, 0xFF, 0x69, 0x39, 0xFF, 0x32, 0x73, 0xFF, 0x28, 0x31, 0xFF, 0xAA, 0x39, 0xFF, 0x69, 0x39, 0xFF, 0xAB, 0x41, 0xFF, 0x27, 0x31, 0xFF, 0x49, 0x31, 0xFF, 0x28, 0x31, 0xFF, 0xCB, 0x49, 0xFF, 0xAA, 0x41, 0xFF, 0x69, 0x39, 0xFF, 0x49, 0x39, 0xFF, 0x08, 0x31, 0xFF, 0xAB, 0x49, 0xFF, 0x49, 0x39, 0xFF, 0x48, 0x31, 0xFF, 0x49, 0x39, 0xFF, 0xD0, 0x6A, 0xFF, 0x08, 0x31, 0xFF, 0xE9, 0x30, 0xFF, 0x6A, 0x39, 0xFF,
-    0x12, 0x7B, 0xFF, 0x2A, 0x39, 0xFF, 0x4A, 0x39, 0xFF, 0x4B, 0x39, 0xFF, 0xF4, 0x7A, 0xFF, 0x6B, 0x39, 0xFF, 0x8C, 0x41, 0xFF, 0xEC, 0x49, 0xFF, 0xCC, 0x49, 0xFF, 0xD1, 0x6A, 0xFF, 0x4B, 0x39, 0xFF, 0xEE, 0x49, 0xFF, 0xAD, 0x49, 0xFF, 0xEF, 0x51, 0xFF, 0xF0, 0x51, 0xFF, 0x8E, 0x41, 0xFF, 0x65, 0x18, 0xFF, 0xA6, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xCC, 0x49, 0xFF, 0x8D, 0x5A, 0xFF, 0x09, 0x31, 0xFF, 0x08, 0x29, 0xFF, 0x2D, 0x52, 0xFF, 0x49, 0x39, 0xFF, 0x94, 0x94, 0xFF, 0x4A, 0x39, 0xFF, 0xAB, 0x49, 0xFF, 0x90, 0x62, 0xFF, 0x2D, 0x5A, 0xFF, 0x0D, 0x52, 0xFF, 0xAB, 0x49, 0xFF, 0xF0, 0x7A, 0xFF, 0x8E, 0x6A, 0xFF, 0x6C, 0x5A, 0xFF, 0x8B, 0x5A, 0xFF, 0x73, 0x8B, 0xFF, 0x6B, 0x73, 0xFF, 0xAE, 0xA4, 0xFF, 0x71, 0xCD, 0xFF, 0xCF, 0xC5, 0xFF, 0xF6, 0xFF, 0xFF, 0x6B, 0x6B, 0xFF, 0xEE, 0x83, 0xFF, 0x0B, 0x63, 0xFF, 0xF2, 0x7B, 0xFF, 0x8A, 0x5A, 0xFF, 0x2A, 0x4A, 0xFF, 0x49, 0x63, 0xFF, 0x8B, 0x52, 0xFF, 0xEE, 0x6A, 0xFF, 0xA9, 0x41, 0xFF, 0x67, 0x31, 0xFF, 0xD1, 0x6A, 0xFF, 0x73, 0x73, 0xFF, 0xCB, 0x41, 0xFF, 0x27, 0x29, 0xFF, 0x69, 0x39, 0xFF, 0x08, 0x29, 0xFF, 0x27, 0x29, 0xFF, 0x89, 0x39, 0xFF, 0x4D, 0x52, 0xFF, 0xA9, 0x39, 0xFF,
-    0xF5, 0x83, 0xFF, 0x08, 0x29, 0xFF, 0xE7, 0x28, 0xFF, 0x48, 0x31, 0xFF, 0x72, 0x83, 0xFF, 0xAA, 0x41, 0xFF, 0x69, 0x39, 0xFF, 0x07, 0x29, 0xFF, 0x6A, 0x41, 0xFF, 0x91, 0x83, 0xFF, 0x29, 0x31, 0xFF, 0x08, 0x31, 0xFF, 0x49, 0x39, 0xFF, 0x16, 0x83, 0xFF, 0x09, 0x31, 0xFF, 0x4A, 0x39, 0xFF, 0x6D, 0x5A, 0xFF, 0xD3, 0x6A, 0xFF, 0x4E, 0x5A, 0xFF, 0x2A, 0x31, 0xFF, 0x4B, 0x39, 0xFF, 0x8C, 0x41, 0xFF, 0xAD, 0x49, 0xFF, 0x6B, 0x39, 0xFF, 0xCD, 0x49, 0xFF, 0x6C, 0x41, 0xFF, 0x8D, 0x41, 0xFF, 0xCE, 0x49, 0xFF, 0x0F, 0x52, 0xFF, 0xCE, 0x49, 0xFF, 0xAD, 0x41, 0xFF, 0x6D, 0x41, 0xFF, 0x08, 0x31, 0xFF, 0xA6, 0x20, 0xFF, 0xCB, 0x41, 0xFF, 0xC7, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xEA, 0x49, 0xFF, 0x29, 0x31, 0xFF, 0xEC, 0x41, 0xFF, 0xE7, 0x28, 0xFF, 0x2C, 0x49, 0xFF, 0x48, 0x31, 0xFF, 0xAB, 0x41, 0xFF, 0xCD, 0x51, 0xFF, 0xAC, 0x49, 0xFF, 0xAB, 0x41, 0xFF, 0xAA, 0x41, 0xFF, 0x2F, 0x73, 0xFF, 0x6E, 0x62, 0xFF, 0x0B, 0x52, 0xFF, 0xEC, 0x6A, 0xFF, 0xB1, 0x83, 0xFF, 0xAD, 0x73, 0xFF, 0x4C, 0x94, 0xFF, 0xCE, 0xD5, 0xFF, 0xFA, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x94, 0xFF, 0x8A, 0x73, 0xFF, 0x8A, 0x7B, 0xFF, 0xAD, 0x73, 0xFF, 0x6A, 0x52, 0xFF,
-    0x08, 0x42, 0xFF, 0x29, 0x42, 0xFF, 0xCB, 0x5A, 0xFF, 0xEF, 0x6A, 0xFF, 0xA9, 0x39, 0xFF, 0x67, 0x31, 0xFF, 0xEE, 0x49, 0xFF, 0x12, 0x73, 0xFF, 0x89, 0x39, 0xFF, 0x47, 0x29, 0xFF, 0x89, 0x39, 0xFF, 0xEF, 0x6A, 0xFF, 0xE7, 0x20, 0xFF, 0xCA, 0x41, 0xFF, 0x27, 0x29, 0xFF, 0x69, 0x39, 0xFF, 0xD6, 0x83, 0xFF, 0x28, 0x29, 0xFF, 0xCB, 0x49, 0xFF, 0x08, 0x31, 0xFF, 0x08, 0x31, 0xFF, 0xCC, 0x49, 0xFF, 0xAE, 0x6A, 0xFF, 0x8A, 0x41, 0xFF, 0xE7, 0x28, 0xFF, 0x69, 0x39, 0xFF, 0x29, 0x39, 0xFF, 0x08, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0x6A, 0x39, 0xFF, 0x37, 0x83, 0xFF, 0xE8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0x2E, 0x5A, 0xFF, 0x2A, 0x31, 0xFF, 0x0A, 0x29, 0xFF, 0x4B, 0x39, 0xFF, 0x2B, 0x39, 0xFF, 0xEE, 0x51, 0xFF, 0x16, 0x7B, 0xFF, 0x13, 0x7B, 0xFF, 0xA9, 0x28, 0xFF, 0xAE, 0x49, 0xFF, 0x4C, 0x39, 0xFF, 0x8D, 0x41, 0xFF, 0xEF, 0x51, 0xFF, 0x8E, 0x41, 0xFF, 0x4E, 0x39, 0xFF, 0xAA, 0x39, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x07, 0x31, 0xFF, 0xE7, 0x28, 0xFF, 0x69, 0x31, 0xFF, 0x28, 0x29, 0xFF, 0xCD, 0x51, 0xFF, 0x29, 0x31, 0xFF, 0x28, 0x31, 0xFF, 0x2D, 0x4A, 0xFF, 0x71, 0x72, 0xFF, 0xAD, 0x49, 0xFF, 0x69, 0x39, 0xFF, 0xC9, 0x41, 0xFF, 0xEE, 0x62, 0xFF,
-    0xC9, 0x41, 0xFF, 0xE9, 0x41, 0xFF, 0x2A, 0x52, 0xFF, 0x92, 0x8B, 0xFF, 0x95, 0xB6, 0xFF, 0x6B, 0x7B, 0xFF, 0xAD, 0xA4, 0xFF, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x12, 0xAD, 0xFF, 0x6B, 0x73, 0xFF, 0x8C, 0x6B, 0xFF, 0xCA, 0x62, 0xFF, 0x4F, 0x7B, 0xFF, 0x8B, 0x52, 0xFF, 0x8B, 0x52, 0xFF, 0x6C, 0x52, 0xFF, 0x10, 0x6B, 0xFF, 0xA9, 0x39, 0xFF, 0x67, 0x31, 0xFF, 0xEE, 0x49, 0xFF, 0x13, 0x6B, 0xFF, 0xA9, 0x41, 0xFF, 0x26, 0x29, 0xFF, 0x68, 0x31, 0xFF, 0x11, 0x73, 0xFF, 0xF4, 0x72, 0xFF, 0xAB, 0x41, 0xFF, 0x07, 0x29, 0xFF, 0xEF, 0x51, 0xFF, 0xE6, 0x20, 0xFF, 0x6B, 0x39, 0xFF, 0xC6, 0x20, 0xFF, 0x8B, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0xAE, 0x49, 0xFF, 0xE7, 0x20, 0xFF, 0x2E, 0x52, 0xFF, 0x08, 0x31, 0xFF, 0x08, 0x31, 0xFF, 0xCA, 0x28, 0xFF, 0x2E, 0x52, 0xFF, 0xE7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xCB, 0x49, 0xFF, 0x10, 0x5A, 0xFF, 0x0A, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x0A, 0x31, 0xFF, 0xEA, 0x28, 0xFF, 0xD1, 0x51, 0xFF, 0x2B, 0x31, 0xFF, 0x2B, 0x31, 0xFF, 0x4C, 0x39, 0xFF, 0x6D, 0x41, 0xFF, 0xED, 0x38, 0xFF, 0x6D, 0x41, 0xFF, 0xAE, 0x49, 0xFF, 0x8E, 0x41, 0xFF, 0xCE, 0x49, 0xFF, 0xAF, 0x49, 0xFF, 0xAF, 0x49, 0xFF,
-    0xC6, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xEC, 0x39, 0xFF, 0x27, 0x31, 0xFF, 0x8B, 0x41, 0xFF, 0x07, 0x31, 0xFF, 0x07, 0x29, 0xFF, 0x8D, 0x52, 0xFF, 0x6A, 0x39, 0xFF, 0xCE, 0x51, 0xFF, 0x89, 0x41, 0xFF, 0xA9, 0x39, 0xFF, 0x0F, 0x84, 0xFF, 0x6C, 0x52, 0xFF, 0xA8, 0x39, 0xFF, 0x88, 0x39, 0xFF, 0xF7, 0xD6, 0xFF, 0x73, 0xC6, 0xFF, 0xEA, 0x62, 0xFF, 0x0B, 0x6B, 0xFF, 0xCB, 0x83, 0xFF, 0x53, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x51, 0xE7, 0xFF, 0x6E, 0x94, 0xFF, 0x0D, 0x84, 0xFF, 0x96, 0xEF, 0xFF, 0xCA, 0x5A, 0xFF, 0xF1, 0x8B, 0xFF, 0x0E, 0x6B, 0xFF, 0x09, 0x42, 0xFF, 0x74, 0x8C, 0xFF, 0x51, 0x73, 0xFF, 0x88, 0x39, 0xFF, 0x26, 0x29, 0xFF, 0xCB, 0x49, 0xFF, 0xD0, 0x5A, 0xFF, 0x48, 0x31, 0xFF, 0x06, 0x29, 0xFF, 0x48, 0x31, 0xFF, 0x12, 0x73, 0xFF, 0xD3, 0x6A, 0xFF, 0xFB, 0x7A, 0xFF, 0xCA, 0x41, 0xFF, 0x6F, 0x5A, 0xFF, 0xC6, 0x20, 0xFF, 0xB4, 0x6A, 0xFF, 0x86, 0x18, 0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0x2B, 0x31, 0xFF, 0xB2, 0x62, 0xFF, 0x66, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0xB5, 0x6A, 0xFF, 0xAC, 0x49, 0xFF, 0xC7, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0x0A, 0x31, 0xFF,
-    0x51, 0x62, 0xFF, 0xF6, 0x7A, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x4C, 0x41, 0xFF, 0xB2, 0x51, 0xFF, 0x19, 0x62, 0xFF, 0x0B, 0x31, 0xFF, 0x2C, 0x39, 0xFF, 0xAE, 0x49, 0xFF, 0x13, 0x5A, 0xFF, 0x76, 0x72, 0xFF, 0x2D, 0x39, 0xFF, 0x11, 0x5A, 0xFF, 0xD0, 0x49, 0xFF, 0xAF, 0x41, 0xFF, 0xA6, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0xE7, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0x69, 0x39, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xE6, 0x20, 0xFF, 0x69, 0x39, 0xFF, 0xEC, 0x51, 0xFF, 0xAD, 0x49, 0xFF, 0x27, 0x31, 0xFF, 0x27, 0x31, 0xFF, 0x4E, 0x5A, 0xFF, 0x6C, 0x52, 0xFF, 0x88, 0x39, 0xFF, 0xA7, 0x39, 0xFF, 0x6E, 0x6A, 0xFF, 0xC8, 0x41, 0xFF, 0x28, 0x4A, 0xFF, 0xAA, 0x5A, 0xFF, 0xCA, 0x62, 0xFF, 0x30, 0x94, 0xFF, 0x4C, 0x94, 0xFF, 0x4B, 0x8C, 0xFF, 0x2C, 0xA5, 0xFF, 0x11, 0xAD, 0xFF, 0x4A, 0x6B, 0xFF, 0x6C, 0x73, 0xFF, 0xEB, 0x5A, 0xFF, 0x2D, 0x6B, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xE8, 0x41, 0xFF, 0xC8, 0x39, 0xFF, 0xA9, 0x39, 0xFF, 0x67, 0x31, 0xFF, 0x26, 0x29, 0xFF, 0x4D, 0x52, 0xFF, 0xF1, 0x62, 0xFF, 0x68, 0x39, 0xFF, 0x06, 0x21, 0xFF, 0x69, 0x39, 0xFF, 0xB0, 0x49, 0xFF, 0x07, 0x29, 0xFF, 0xAC, 0x41, 0xFF, 0xC6, 0x20, 0xFF, 0x28, 0x29, 0xFF,
-    0xCC, 0x41, 0xFF, 0x07, 0x29, 0xFF, 0xEC, 0x49, 0xFF, 0x08, 0x29, 0xFF, 0x71, 0x62, 0xFF, 0x0A, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x31, 0xFF, 0x2C, 0x39, 0xFF, 0x4E, 0x5A, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0x87, 0x20, 0xFF, 0xEE, 0x49, 0xFF, 0xA8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x0B, 0x31, 0xFF, 0xAB, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xD1, 0x51, 0xFF, 0x0C, 0x39, 0xFF, 0x2C, 0x31, 0xFF, 0x6D, 0x41, 0xFF, 0x0C, 0x31, 0xFF, 0x6E, 0x41, 0xFF, 0xD0, 0x49, 0xFF, 0x8F, 0x41, 0xFF, 0x8F, 0x41, 0xFF, 0x6F, 0x41, 0xFF, 0x0E, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xA6, 0x20, 0xFF, 0x07, 0x29, 0xFF, 0xE6, 0x20, 0xFF, 0xE6, 0x28, 0xFF, 0x4D, 0x52, 0xFF, 0xE6, 0x20, 0xFF, 0x6B, 0x41, 0xFF, 0x68, 0x39, 0xFF, 0x48, 0x31, 0xFF, 0xB1, 0x72, 0xFF, 0xEB, 0x49, 0xFF, 0x2B, 0x52, 0xFF, 0x88, 0x39, 0xFF, 0x6E, 0x62, 0xFF, 0x47, 0x39, 0xFF, 0xE7, 0x41, 0xFF, 0xF0, 0x6A, 0xFF, 0x31, 0x8C, 0xFF, 0xF0, 0x7B, 0xFF, 0xAD, 0x83, 0xFF, 0x0C, 0x84, 0xFF, 0x6F, 0x94, 0xFF, 0xAB, 0x7B, 0xFF, 0x2E, 0x8C, 0xFF, 0xA8, 0x5A, 0xFF, 0x68, 0x4A, 0xFF, 0xAB, 0x5A, 0xFF, 0xD2, 0x83, 0xFF, 0xA7, 0x39, 0xFF,
-    0xE9, 0x41, 0xFF, 0xC8, 0x39, 0xFF, 0xA8, 0x39, 0xFF, 0xEA, 0x41, 0xFF, 0x68, 0x39, 0xFF, 0x26, 0x21, 0xFF, 0x69, 0x39, 0xFF, 0x17, 0x73, 0xFF, 0xAA, 0x41, 0xFF, 0xE6, 0x20, 0xFF, 0x49, 0x31, 0xFF, 0xAB, 0x41, 0xFF, 0x4A, 0x31, 0xFF, 0xAA, 0x39, 0xFF, 0xC6, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0x71, 0x62, 0xFF, 0x07, 0x29, 0xFF, 0xC7, 0x20, 0xFF, 0x07, 0x29, 0xFF, 0x2B, 0x31, 0xFF, 0xEA, 0x28, 0xFF, 0x2C, 0x52, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0x70, 0x62, 0xFF, 0xC9, 0x28, 0xFF, 0x87, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0x67, 0x18, 0xFF, 0xB5, 0x6A, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x4D, 0x39, 0xFF, 0x12, 0x5A, 0xFF, 0x73, 0x62, 0xFF, 0xEA, 0x28, 0xFF, 0x0C, 0x31, 0xFF, 0x0C, 0x31, 0xFF, 0xCF, 0x38, 0xFF, 0x4D, 0x39, 0xFF, 0x2D, 0x39, 0xFF, 0x2D, 0x39, 0xFF, 0x8F, 0x41, 0xFF, 0xD1, 0x51, 0xFF, 0x90, 0x41, 0xFF, 0x2F, 0x39, 0xFF, 0x0E, 0x31, 0xFF, 0x85, 0x18, 0xFF, 0xC6, 0x20, 0xFF, 0xCC, 0x49, 0xFF, 0xC6, 0x20, 0xFF, 0xA5, 0x20, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xE6, 0x20, 0xFF, 0x07, 0x29, 0xFF, 0x48, 0x39, 0xFF, 0xF8, 0xFF, 0xFF, 0x67, 0x39, 0xFF, 0x0B, 0x4A, 0xFF, 0x88, 0x39, 0xFF, 0x6D, 0x5A, 0xFF,
-    0x86, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0xEC, 0x49, 0xFF, 0x4D, 0x6B, 0xFF, 0x14, 0xA5, 0xFF, 0x8A, 0x5A, 0xFF, 0xCC, 0x62, 0xFF, 0x4D, 0x73, 0xFF, 0xC8, 0x5A, 0xFF, 0x33, 0xA5, 0xFF, 0x8E, 0x94, 0xFF, 0x4D, 0x6B, 0xFF, 0x69, 0x52, 0xFF, 0x6A, 0x52, 0xFF, 0xC7, 0x39, 0xFF, 0xEF, 0x6A, 0xFF, 0xEA, 0x49, 0xFF, 0xA8, 0x39, 0xFF, 0x51, 0x73, 0xFF, 0xB2, 0x83, 0xFF, 0xCA, 0x41, 0xFF, 0x26, 0x21, 0xFF, 0xEC, 0x49, 0xFF, 0x32, 0x6B, 0xFF, 0x68, 0x31, 0xFF, 0x07, 0x21, 0xFF, 0x48, 0x31, 0xFF, 0x8B, 0x39, 0xFF, 0x76, 0x83, 0xFF, 0x6A, 0x39, 0xFF, 0x49, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0x29, 0x31, 0xFF, 0x6B, 0x39, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0x6C, 0x39, 0xFF, 0x86, 0x18, 0xFF, 0x08, 0x29, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0x69, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xA8, 0x20, 0xFF, 0x0C, 0x31, 0xFF, 0x0B, 0x31, 0xFF, 0x50, 0x38, 0xFF, 0xCA, 0x28, 0xFF, 0xEB, 0x28, 0xFF, 0x8C, 0x28, 0xFF, 0xCB, 0x28, 0xFF, 0x0C, 0x31, 0xFF, 0x0D, 0x39, 0xFF, 0x37, 0x6A, 0xFF, 0x0F, 0x39, 0xFF, 0x2E, 0x39, 0xFF, 0x2F, 0x39, 0xFF, 0x70, 0x41, 0xFF, 0xB1, 0x49, 0xFF, 0xB3, 0x49, 0xFF, 0x0F, 0x39, 0xFF,
-    0xEF, 0x51, 0xFF, 0x07, 0x29, 0xFF, 0x06, 0x29, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0x6D, 0x52, 0xFF, 0x4B, 0x39, 0xFF, 0x06, 0x21, 0xFF, 0x06, 0x29, 0xFF, 0x06, 0x21, 0xFF, 0x6D, 0x52, 0xFF, 0x08, 0x31, 0xFF, 0x27, 0x31, 0xFF, 0x2B, 0x4A, 0xFF, 0xCB, 0x41, 0xFF, 0x8F, 0x73, 0xFF, 0x67, 0x31, 0xFF, 0x87, 0x31, 0xFF, 0x1B, 0xDC, 0xFF, 0x4B, 0x52, 0xFF, 0xCB, 0x5A, 0xFF, 0xF0, 0x72, 0xFF, 0x08, 0x4A, 0xFF, 0xEB, 0x62, 0xFF, 0x68, 0x52, 0xFF, 0xCB, 0x62, 0xFF, 0xAA, 0x5A, 0xFF, 0x2E, 0x73, 0xFF, 0xAC, 0x5A, 0xFF, 0x29, 0x4A, 0xFF, 0xC8, 0x39, 0xFF, 0x71, 0x7B, 0xFF, 0x09, 0x4A, 0xFF, 0xA8, 0x31, 0xFF, 0x88, 0x39, 0xFF, 0xF1, 0x62, 0xFF, 0x89, 0x39, 0xFF, 0x27, 0x21, 0xFF, 0xCD, 0x49, 0xFF, 0x33, 0x6B, 0xFF, 0x8A, 0x39, 0xFF, 0x07, 0x21, 0xFF, 0x49, 0x31, 0xFF, 0x33, 0x73, 0xFF, 0x87, 0x18, 0xFF, 0xEB, 0x49, 0xFF, 0xCB, 0x41, 0xFF, 0xF1, 0x6A, 0xFF, 0xC7, 0x20, 0xFF, 0x49, 0x31, 0xFF, 0xA6, 0x20, 0xFF, 0x4B, 0x39, 0xFF, 0x87, 0x20, 0xFF, 0x6B, 0x39, 0xFF, 0xC9, 0x28, 0xFF, 0x86, 0x18, 0xFF, 0xC8, 0x20, 0xFF, 0x6B, 0x39, 0xFF, 0x0D, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0x4A, 0x39, 0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x0C, 0x31, 0xFF,
-    0x4E, 0x39, 0xFF, 0x89, 0x20, 0xFF, 0x8A, 0x20, 0xFF, 0xCB, 0x28, 0xFF, 0x92, 0x49, 0xFF, 0xED, 0x30, 0xFF, 0x0D, 0x31, 0xFF, 0x2F, 0x39, 0xFF, 0x4F, 0x39, 0xFF, 0x51, 0x41, 0xFF, 0x10, 0x39, 0xFF, 0xEF, 0x30, 0xFF, 0x30, 0x39, 0xFF, 0x71, 0x41, 0xFF, 0x51, 0x41, 0xFF, 0xAE, 0x28, 0xFF, 0xE6, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xEC, 0x42, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x18, 0xFF, 0xE5, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0xCD, 0x5A, 0xFF, 0x88, 0x39, 0xFF, 0xE5, 0x20, 0xFF, 0x06, 0x29, 0xFF, 0xEB, 0x51, 0xFF, 0x0F, 0x7C, 0xFF, 0x27, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x67, 0x31, 0xFF, 0xE8, 0x41, 0xFF, 0xB0, 0x8C, 0xFF, 0x55, 0x94, 0xFF, 0xE8, 0x41, 0xFF, 0x70, 0x7B, 0xFF, 0x2C, 0x63, 0xFF, 0x93, 0xCE, 0xFF, 0x4A, 0x52, 0xFF, 0xCD, 0x62, 0xFF, 0x28, 0x52, 0xFF, 0x49, 0x4A, 0xFF, 0xB4, 0xAD, 0xFF, 0x8D, 0x5A, 0xFF, 0x09, 0x42, 0xFF, 0x69, 0x31, 0xFF, 0x0A, 0x4A, 0xFF, 0x14, 0x84, 0xFF, 0xED, 0x49, 0xFF, 0xED, 0x49, 0xFF, 0x07, 0x21, 0xFF, 0xCD, 0x49, 0xFF, 0xF4, 0x6A, 0xFF, 0xAC, 0x41, 0xFF, 0xE7, 0x20, 0xFF, 0x29, 0x31, 0xFF, 0x10, 0x52, 0xFF, 0x35, 0x7B, 0xFF, 0x29, 0x31, 0xFF, 0xE8, 0x20, 0xFF, 0xEC, 0x49, 0xFF,
-    0x2A, 0x31, 0xFF, 0x92, 0x62, 0xFF, 0x6A, 0x39, 0xFF, 0x29, 0x31, 0xFF, 0x6E, 0x41, 0xFF, 0xA8, 0x20, 0xFF, 0xB6, 0x72, 0xFF, 0x66, 0x18, 0xFF, 0x67, 0x18, 0xFF, 0x6A, 0x31, 0xFF, 0x32, 0x39, 0xFF, 0x75, 0x6A, 0xFF, 0xCD, 0x49, 0xFF, 0x0B, 0x31, 0xFF, 0xC9, 0x20, 0xFF, 0x30, 0x41, 0xFF, 0xF8, 0x61, 0xFF, 0x94, 0x49, 0xFF, 0x89, 0x20, 0xFF, 0x8A, 0x20, 0xFF, 0x2F, 0x39, 0xFF, 0x5C, 0x59, 0xFF, 0x90, 0x38, 0xFF, 0x90, 0x38, 0xFF, 0x0F, 0x39, 0xFF, 0xAF, 0x30, 0xFF, 0x5D, 0x59, 0xFF, 0xF6, 0x48, 0xFF, 0x31, 0x41, 0xFF, 0x51, 0x41, 0xFF, 0x31, 0x41, 0xFF, 0xF0, 0x30, 0xFF, 0xA5, 0x18, 0xFF, 0xC5, 0x20, 0xFF, 0xA5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0x88, 0x39, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0x06, 0x29, 0xFF, 0x06, 0x21, 0xFF, 0xE5, 0x20, 0xFF, 0x47, 0x29, 0xFF, 0x47, 0x31, 0xFF, 0x46, 0x29, 0xFF, 0x47, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x78, 0x9C, 0xFF, 0x4B, 0x52, 0xFF, 0x89, 0x39, 0xFF, 0xE8, 0x41, 0xFF, 0x4A, 0x4A, 0xFF, 0xE8, 0x41, 0xFF, 0x6C, 0x52, 0xFF, 0x09, 0x4A, 0xFF, 0xA7, 0x39, 0xFF, 0xE8, 0x41, 0xFF, 0x09, 0x4A, 0xFF, 0xB3, 0x7B, 0xFF, 0x67, 0x31, 0xFF,
-    0x68, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x69, 0x31, 0xFF, 0xCA, 0x39, 0xFF, 0x33, 0x62, 0xFF, 0x28, 0x29, 0xFF, 0x30, 0x52, 0xFF, 0x52, 0x5A, 0xFF, 0x93, 0x6A, 0xFF, 0xE8, 0x20, 0xFF, 0x2B, 0x31, 0xFF, 0x8C, 0x41, 0xFF, 0xA7, 0x20, 0xFF, 0x6A, 0x39, 0xFF, 0xE7, 0x20, 0xFF, 0x2A, 0x31, 0xFF, 0x91, 0x62, 0xFF, 0xA7, 0x20, 0xFF, 0x49, 0x31, 0xFF, 0xA7, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0xE9, 0x30, 0xFF, 0x87, 0x18, 0xFF, 0x66, 0x18, 0xFF, 0xC8, 0x28, 0xFF, 0xAC, 0x41, 0xFF, 0xC9, 0x20, 0xFF, 0x2B, 0x31, 0xFF, 0x87, 0x18, 0xFF, 0x88, 0x18, 0xFF, 0xCA, 0x28, 0xFF, 0xB5, 0x38, 0xFF, 0x4A, 0x18, 0xFF, 0x49, 0x18, 0xFF, 0xB1, 0x51, 0xFF, 0xAC, 0x20, 0xFF, 0x6B, 0x20, 0xFF, 0xAD, 0x28, 0xFF, 0x4D, 0x20, 0xFF, 0xF1, 0x40, 0xFF, 0xB0, 0x30, 0xFF, 0xD2, 0x40, 0xFF, 0xD1, 0x38, 0xFF, 0xF3, 0x40, 0xFF, 0x12, 0x39, 0xFF, 0x32, 0x41, 0xFF, 0x32, 0x41, 0xFF, 0xF1, 0x38, 0xFF, 0x84, 0x10, 0xFF, 0xA4, 0x18, 0xFF, 0xE6, 0x28, 0xFF, 0x27, 0x29, 0xFF, 0xA5, 0x18, 0xFF, 0xC5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0x89, 0x39, 0xFF, 0x06, 0x21, 0xFF, 0x47, 0x31, 0xFF, 0xC5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0x2C, 0x4A, 0xFF, 0x06, 0x29, 0xFF, 0x26, 0x29, 0xFF, 0x47, 0x31, 0xFF,
-    0x0E, 0x6B, 0xFF, 0x28, 0x31, 0xFF, 0xCA, 0x49, 0xFF, 0x2B, 0x52, 0xFF, 0xA8, 0x39, 0xFF, 0x90, 0x7B, 0xFF, 0xC7, 0x39, 0xFF, 0x8C, 0x5A, 0xFF, 0xA7, 0x39, 0xFF, 0xEA, 0x41, 0xFF, 0x09, 0x52, 0xFF, 0x8D, 0x62, 0xFF, 0x4A, 0x52, 0xFF, 0xAD, 0x62, 0xFF, 0x52, 0x73, 0xFF, 0x89, 0x39, 0xFF, 0x47, 0x29, 0xFF, 0xEB, 0x41, 0xFF, 0x8A, 0x39, 0xFF, 0xF0, 0x62, 0xFF, 0x4B, 0x39, 0xFF, 0xE9, 0x20, 0xFF, 0xB5, 0x72, 0xFF, 0xDE, 0x8A, 0xFF, 0x8D, 0x41, 0xFF, 0xE9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x68, 0x18, 0xFF, 0x4A, 0x31, 0xFF, 0xC7, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0x0A, 0x29, 0xFF, 0x47, 0x18, 0xFF, 0xC6, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xAA, 0x20, 0xFF, 0xA8, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0xA7, 0x20, 0xFF, 0x67, 0x18, 0xFF, 0xA8, 0x20, 0xFF, 0x67, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0xAE, 0x49, 0xFF, 0x69, 0x18, 0xFF, 0x8B, 0x20, 0xFF, 0x6A, 0x18, 0xFF, 0x2A, 0x18, 0xFF, 0x4B, 0x18, 0xFF, 0x6D, 0x20, 0xFF, 0x8C, 0x20, 0xFF, 0x6E, 0x20, 0xFF, 0xD1, 0x38, 0xFF, 0x91, 0x30, 0xFF, 0x73, 0x38, 0xFF, 0x73, 0x38, 0xFF, 0x97, 0x48, 0xFF, 0x13, 0x41, 0xFF, 0xB1, 0x30, 0xFF, 0xF2, 0x38, 0xFF, 0x54, 0x41, 0xFF,
-    0xC5, 0x18, 0xFF, 0xA9, 0x39, 0xFF, 0xE5, 0x20, 0xFF, 0x84, 0x18, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0x8A, 0x39, 0xFF, 0xE6, 0x28, 0xFF, 0x26, 0x29, 0xFF, 0x06, 0x21, 0xFF, 0x68, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x06, 0x29, 0xFF, 0x06, 0x21, 0xFF, 0x06, 0x29, 0xFF, 0x2B, 0x4A, 0xFF, 0x08, 0x31, 0xFF, 0x2A, 0x31, 0xFF, 0x89, 0x39, 0xFF, 0x0A, 0x4A, 0xFF, 0xAD, 0x5A, 0xFF, 0x87, 0x31, 0xFF, 0x87, 0x39, 0xFF, 0xD7, 0xA3, 0xFF, 0x4A, 0x4A, 0xFF, 0x30, 0x83, 0xFF, 0xE8, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x62, 0xFF, 0x6D, 0x5A, 0xFF, 0xD0, 0x62, 0xFF, 0x71, 0x62, 0xFF, 0x27, 0x29, 0xFF, 0x89, 0x39, 0xFF, 0x12, 0x62, 0xFF, 0x92, 0x6A, 0xFF, 0x6C, 0x39, 0xFF, 0x2B, 0x31, 0xFF, 0xF6, 0x61, 0xFF, 0x5B, 0x82, 0xFF, 0xF0, 0x40, 0xFF, 0x2A, 0x31, 0xFF, 0x0B, 0x31, 0xFF, 0xF4, 0x72, 0xFF, 0x14, 0x62, 0xFF, 0xE9, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xF1, 0x51, 0xFF, 0x67, 0x18, 0xFF, 0x2D, 0x39, 0xFF, 0xA7, 0x18, 0xFF, 0x2A, 0x31, 0xFF, 0x6B, 0x39, 0xFF, 0x51, 0x62, 0xFF, 0xA7, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xC8, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0x6F, 0x39, 0xFF, 0x88, 0x18, 0xFF, 0xA8, 0x20, 0xFF, 0xA8, 0x20, 0xFF, 0xA9, 0x20, 0xFF, 0xB3, 0x51, 0xFF,
-    0x29, 0x18, 0xFF, 0x49, 0x18, 0xFF, 0x29, 0x18, 0xFF, 0x4C, 0x20, 0xFF, 0xF4, 0x40, 0xFF, 0x4D, 0x20, 0xFF, 0x6E, 0x20, 0xFF, 0x72, 0x30, 0xFF, 0x5A, 0x59, 0xFF, 0x1D, 0x58, 0xFF, 0x3D, 0x60, 0xFF, 0x1D, 0x68, 0xFF, 0xB5, 0x40, 0xFF, 0x14, 0x41, 0xFF, 0xF4, 0x40, 0xFF, 0xB4, 0x38, 0xFF, 0xE6, 0x28, 0xFF, 0x84, 0x18, 0xFF, 0xA4, 0x18, 0xFF, 0xE5, 0x20, 0xFF, 0xC5, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0xC5, 0x18, 0xFF, 0xC5, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0x06, 0x21, 0xFF, 0x05, 0x21, 0xFF, 0xE6, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x0D, 0x41, 0xFF, 0x0E, 0x41, 0xFF, 0x49, 0x39, 0xFF, 0x69, 0x31, 0xFF, 0x68, 0x31, 0xFF, 0x88, 0x31, 0xFF, 0xEF, 0x62, 0xFF, 0x09, 0x4A, 0xFF, 0x87, 0x31, 0xFF, 0x87, 0x39, 0xFF, 0x0A, 0x62, 0xFF, 0x45, 0x51, 0xFF, 0xAD, 0x62, 0xFF, 0x2C, 0x52, 0xFF, 0x88, 0x31, 0xFF, 0x8E, 0x5A, 0xFF, 0x27, 0x29, 0xFF, 0x7E, 0xA3, 0xFF, 0x29, 0x31, 0xFF, 0xF5, 0x59, 0xFF, 0x6E, 0x39, 0xFF, 0x0D, 0x31, 0xFF, 0xBF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x92, 0xFF, 0x0C, 0x31, 0xFF, 0x0C, 0x31, 0xFF, 0x4E, 0x39, 0xFF, 0x8E, 0x41, 0xFF, 0x35, 0x51, 0xFF, 0x08, 0x29, 0xFF, 0xA7, 0x20, 0xFF,
-    0x4A, 0x31, 0xFF, 0x87, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0xD1, 0x6A, 0xFF, 0x67, 0x18, 0xFF, 0x66, 0x18, 0xFF, 0x09, 0x29, 0xFF, 0xEA, 0x28, 0xFF, 0xAC, 0x41, 0xFF, 0xA8, 0x18, 0xFF, 0x0D, 0x4A, 0xFF, 0x88, 0x20, 0xFF, 0x4C, 0x39, 0xFF, 0x88, 0x18, 0xFF, 0x48, 0x18, 0xFF, 0x28, 0x18, 0xFF, 0x6F, 0x41, 0xFF, 0x4A, 0x18, 0xFF, 0x6C, 0x20, 0xFF, 0x0C, 0x18, 0xFF, 0x19, 0x83, 0xFF, 0x71, 0x30, 0xFF, 0x53, 0x30, 0xFF, 0x19, 0x40, 0xFF, 0x1E, 0x78, 0xFF, 0xFF, 0xFD, 0xFF, 0xDE, 0xD8, 0xFF, 0x1A, 0x58, 0xFF, 0xB6, 0x40, 0xFF, 0x1E, 0x48, 0xFF, 0x77, 0x40, 0xFF, 0xA5, 0x20, 0xFF, 0x84, 0x18, 0xFF, 0xA4, 0x18, 0xFF, 0xE5, 0x20, 0xFF, 0xEA, 0x41, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xA9, 0x39, 0xFF, 0x07, 0x29, 0xFF, 0x6C, 0x4A, 0xFF, 0x06, 0x21, 0xFF, 0xE5, 0x20, 0xFF, 0x06, 0x21, 0xFF, 0x0B, 0x4A, 0xFF, 0xF0, 0x7B, 0xFF, 0x0B, 0x31, 0xFF, 0x74, 0x60, 0xFF, 0x3A, 0x80, 0xFF, 0x0B, 0x41, 0xFF, 0xD0, 0x7B, 0xFF, 0x47, 0x29, 0xFF, 0x68, 0x31, 0xFF, 0xE9, 0x41, 0xFF, 0xA8, 0x39, 0xFF, 0xF0, 0x7B, 0xFF, 0x67, 0x31, 0xFF, 0x47, 0x39, 0xFF, 0x26, 0x29, 0xFF, 0xE9, 0x41, 0xFF, 0x14, 0x8C, 0xFF, 0x27, 0x29, 0xFF, 0x27, 0x29, 0xFF,
-    0x28, 0x29, 0xFF, 0x48, 0x29, 0xFF, 0x34, 0x7B, 0xFF, 0x0A, 0x29, 0xFF, 0x2C, 0x31, 0xFF, 0xEC, 0x30, 0xFF, 0x7F, 0x9A, 0xFF, 0xFF, 0xDB, 0xFF, 0xB9, 0x79, 0xFF, 0x2E, 0x39, 0xFF, 0x2B, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xF5, 0x82, 0xFF, 0x2A, 0x31, 0xFF, 0xA7, 0x18, 0xFF, 0xA8, 0x20, 0xFF, 0xA7, 0x18, 0xFF, 0xD4, 0x6A, 0xFF, 0xE7, 0x20, 0xFF, 0xA6, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0x87, 0x18, 0xFF, 0x31, 0x52, 0xFF, 0xA7, 0x20, 0xFF, 0x66, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0xA8, 0x20, 0xFF, 0x32, 0x5A, 0xFF, 0x88, 0x18, 0xFF, 0x88, 0x18, 0xFF, 0x68, 0x18, 0xFF, 0x69, 0x18, 0xFF, 0xD5, 0x51, 0xFF, 0x4B, 0x20, 0xFF, 0x0B, 0x18, 0xFF, 0x6D, 0x28, 0xFF, 0x4D, 0x20, 0xFF, 0x1F, 0x40, 0xFF, 0x13, 0x20, 0xFF, 0x13, 0x28, 0xFF, 0x38, 0x40, 0xFF, 0x1F, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFD, 0xFF, 0x1F, 0x70, 0xFF, 0x58, 0x48, 0xFF, 0xBB, 0x48, 0xFF, 0xB6, 0x40, 0xFF, 0x84, 0x18, 0xFF, 0xA4, 0x18, 0xFF, 0xA4, 0x18, 0xFF, 0x29, 0x31, 0xFF, 0xE6, 0x20, 0xFF, 0xA5, 0x18, 0xFF, 0xA8, 0x20, 0xFF, 0xA6, 0x20, 0xFF, 0x08, 0x31, 0xFF, 0xC6, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0xCA, 0x41, 0xFF, 0x27, 0x29, 0xFF, 0x08, 0x31, 0xFF, 0xAB, 0x30, 0xFF,
-    0xC7, 0x28, 0xFF, 0x34, 0x71, 0xFF, 0xEC, 0x40, 0xFF, 0x4E, 0x59, 0xFF, 0x2A, 0x31, 0xFF, 0x4B, 0x52, 0xFF, 0x46, 0x29, 0xFF, 0x67, 0x31, 0xFF, 0x47, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0xA9, 0x39, 0xFF, 0x46, 0x31, 0xFF, 0x88, 0x31, 0xFF, 0x47, 0x29, 0xFF, 0x92, 0x62, 0xFF, 0x27, 0x29, 0xFF, 0x27, 0x29, 0xFF, 0x48, 0x29, 0xFF, 0x29, 0x31, 0xFF, 0x0A, 0x29, 0xFF, 0xEA, 0x28, 0xFF, 0x2C, 0x31, 0xFF, 0x96, 0x61, 0xFF, 0xBF, 0xD2, 0xFF, 0x31, 0x59, 0xFF, 0x0B, 0x31, 0xFF, 0x0A, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0xEF, 0x38, 0xFF, 0x2A, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0x53, 0x5A, 0xFF, 0x86, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0xC7, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0xAE, 0x49, 0xFF, 0xA7, 0x18, 0xFF, 0xA8, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0x88, 0x18, 0xFF, 0xF2, 0x51, 0xFF, 0x68, 0x18, 0xFF, 0x69, 0x18, 0xFF, 0xAB, 0x28, 0xFF, 0x51, 0x41, 0xFF, 0x6B, 0x18, 0xFF, 0x6B, 0x18, 0xFF, 0x4C, 0x18, 0xFF, 0x4F, 0x20, 0xFF, 0x96, 0x51, 0xFF, 0x73, 0x38, 0xFF, 0x1A, 0x48, 0xFF, 0x1F, 0x78, 0xFF, 0x5F, 0x98, 0xFF, 0x19, 0x58, 0xFF, 0x75, 0x40, 0xFF, 0x94, 0x38, 0xFF, 0x17, 0x49, 0xFF,
-    0xA4, 0x18, 0xFF, 0x84, 0x10, 0xFF, 0xA4, 0x18, 0xFF, 0xE6, 0x20, 0xFF, 0x88, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0xC8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xC8, 0x30, 0xFF, 0xA5, 0x20, 0xFF, 0xE5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0x90, 0x50, 0xFF, 0x75, 0x80, 0xFF, 0x1F, 0xB8, 0xFF, 0xEA, 0x38, 0xFF, 0xCC, 0x48, 0xFF, 0x28, 0x31, 0xFF, 0x27, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x46, 0x29, 0xFF, 0x6B, 0x52, 0xFF, 0x46, 0x29, 0xFF, 0x47, 0x31, 0xFF, 0x47, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x27, 0x21, 0xFF, 0x07, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0x28, 0x31, 0xFF, 0x09, 0x29, 0xFF, 0x29, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0x0B, 0x31, 0xFF, 0x4E, 0x41, 0xFF, 0xED, 0x28, 0xFF, 0x2E, 0x41, 0xFF, 0x0A, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x0A, 0x29, 0xFF, 0xA8, 0x18, 0xFF, 0x4A, 0x31, 0xFF, 0xC7, 0x20, 0xFF, 0xA7, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0x66, 0x10, 0xFF, 0xA7, 0x18, 0xFF, 0x46, 0x10, 0xFF, 0x87, 0x18, 0xFF, 0xA7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0xA8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x18, 0xFF, 0xA8, 0x20, 0xFF, 0x67, 0x10, 0xFF, 0x89, 0x20, 0xFF,
-    0x69, 0x18, 0xFF, 0x49, 0x18, 0xFF, 0x29, 0x10, 0xFF, 0x6B, 0x18, 0xFF, 0x6B, 0x18, 0xFF, 0x2B, 0x18, 0xFF, 0x2C, 0x18, 0xFF, 0x6E, 0x20, 0xFF, 0xB2, 0x30, 0xFF, 0x13, 0x30, 0xFF, 0x16, 0x38, 0xFF, 0x19, 0x48, 0xFF, 0x54, 0x40, 0xFF, 0x94, 0x38, 0xFF, 0xB4, 0x38, 0xFF, 0x73, 0x38, 0xFF, 0x63, 0x10, 0xFF, 0x89, 0x39, 0xFF, 0xC6, 0x20, 0xFF, 0x67, 0x20, 0xFF, 0x84, 0x18, 0xFF, 0xA6, 0x20, 0xFF, 0xC9, 0x39, 0xFF, 0x68, 0x28, 0xFF, 0xC5, 0x20, 0xFF, 0xE6, 0x20, 0xFF, 0xC6, 0x20, 0xFF, 0x27, 0x29, 0xFF, 0xE6, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0x0A, 0x31, 0xFF, 0x2B, 0x52, 0xFF, 0x36, 0x70, 0xFF, 0x3E, 0xC8, 0xFF, 0x27, 0x31, 0xFF, 0x50, 0x61, 0xFF, 0x6B, 0x52, 0xFF, 0xEE, 0x62, 0xFF, 0x06, 0x29, 0xFF, 0x47, 0x31, 0xFF, 0x47, 0x29, 0xFF, 0x4E, 0x5A, 0xFF, 0x26, 0x29, 0xFF, 0x26, 0x29, 0xFF, 0x47, 0x29, 0xFF, 0x06, 0x29, 0xFF, 0x27, 0x21, 0xFF, 0x07, 0x21, 0xFF, 0xE7, 0x20, 0xFF, 0x48, 0x29, 0xFF, 0xD0, 0x59, 0xFF, 0x2A, 0x29, 0xFF, 0x2B, 0x31, 0xFF, 0x0A, 0x29, 0xFF, 0x51, 0x62, 0xFF, 0xD1, 0x49, 0xFF, 0x2C, 0x39, 0xFF, 0x4A, 0x39, 0xFF, 0x09, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0xBB, 0x92, 0xFF, 0xC8, 0x20, 0xFF, 0xA7, 0x18, 0xFF, 0xA7, 0x18, 0xFF,
-    0xA6, 0x18, 0xFF, 0x50, 0x52, 0xFF, 0xA7, 0x18, 0xFF, 0x66, 0x10, 0xFF, 0xA6, 0x18, 0xFF, 0x87, 0x18, 0xFF, 0x86, 0x18, 0xFF, 0x4A, 0x39, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xF1, 0x49, 0xFF, 0x08, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xA7, 0x18, 0xFF, 0xD3, 0x51, 0xFF, 0x69, 0x18, 0xFF, 0x8A, 0x18, 0xFF, 0x6A, 0x18, 0xFF, 0x49, 0x18, 0xFF, 0x11, 0x39, 0xFF, 0x4B, 0x18, 0xFF, 0x2B, 0x18, 0xFF, 0x6D, 0x20, 0xFF, 0x0D, 0x18, 0xFF, 0x11, 0x28, 0xFF, 0x31, 0x28, 0xFF, 0xB4, 0x40, 0xFF, 0x71, 0x30, 0xFF, 0xD2, 0x30, 0xFF, 0xB2, 0x38, 0xFF, 0xB1, 0x30, 0xFF, 0xA4, 0x18, 0xFF, 0x84, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0x64, 0x10, 0xFF, 0x86, 0x20, 0xFF, 0x8B, 0x30, 0xFF, 0x68, 0x28, 0xFF, 0x2B, 0x41, 0xFF, 0xA7, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0x29, 0x31, 0xFF, 0xEB, 0x38, 0xFF, 0x34, 0x78, 0xFF, 0x1A, 0x70, 0xFF, 0x1F, 0xD8, 0xFF, 0x0A, 0x49, 0xFF, 0xCC, 0x48, 0xFF, 0xCE, 0x50, 0xFF, 0xE8, 0x28, 0xFF, 0x27, 0x29, 0xFF, 0x06, 0x21, 0xFF, 0x06, 0x29, 0xFF, 0x26, 0x29, 0xFF, 0x88, 0x41, 0xFF, 0x69, 0x8A, 0xFF, 0x67, 0x31, 0xFF, 0x47, 0x31, 0xFF, 0x07, 0x21, 0xFF, 0x27, 0x29, 0xFF,
-    0x07, 0x21, 0xFF, 0x49, 0x29, 0xFF, 0x29, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0x2A, 0x31, 0xFF, 0x2B, 0x31, 0xFF, 0x6D, 0x41, 0xFF, 0x0C, 0x31, 0xFF, 0xCE, 0x69, 0xFF, 0x6B, 0x41, 0xFF, 0x09, 0x31, 0xFF, 0xC9, 0x20, 0xFF, 0xF9, 0xAC, 0xFF, 0xC8, 0x20, 0xFF, 0xA7, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0xD0, 0x62, 0xFF, 0xC7, 0x18, 0xFF, 0xA6, 0x18, 0xFF, 0x08, 0x29, 0xFF, 0xA6, 0x18, 0xFF, 0x11, 0x6B, 0xFF, 0xA6, 0x18, 0xFF, 0xA6, 0x20, 0xFF, 0x27, 0x29, 0xFF, 0xA7, 0x18, 0xFF, 0x89, 0x41, 0xFF, 0x49, 0x39, 0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x88, 0x18, 0xFF, 0x28, 0x10, 0xFF, 0x89, 0x18, 0xFF, 0x69, 0x18, 0xFF, 0x89, 0x18, 0xFF, 0x0A, 0x10, 0xFF, 0x4A, 0x20, 0xFF, 0x4A, 0x18, 0xFF, 0x6C, 0x20, 0xFF, 0x4C, 0x18, 0xFF, 0x0F, 0x20, 0xFF, 0xDA, 0x50, 0xFF, 0x92, 0x30, 0xFF, 0x70, 0x28, 0xFF, 0x8F, 0x28, 0xFF, 0xD1, 0x30, 0xFF, 0xD1, 0x30, 0xFF, 0xA4, 0x18, 0xFF, 0xA5, 0x18, 0xFF, 0xE6, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC9, 0x39, 0xFF, 0x86, 0x20, 0xFF, 0x84, 0x18, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x6C, 0x52, 0xFF, 0xC6, 0x20, 0xFF, 0x85, 0x18, 0xFF, 0xE7, 0x28, 0xFF, 0xC6, 0x20, 0xFF, 0x6B, 0x52, 0xFF, 0x89, 0x28, 0xFF,
-    0x1C, 0x98, 0xFF, 0x1F, 0xC8, 0xFF, 0x87, 0x28, 0xFF, 0xCC, 0x5A, 0xFF, 0xC7, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x06, 0x29, 0xFF, 0xAD, 0x52, 0xFF, 0x26, 0x29, 0xFF, 0xE8, 0x59, 0xFF, 0x2C, 0xF4, 0xFF, 0x27, 0x31, 0xFF, 0x11, 0x6B, 0xFF, 0x07, 0x29, 0xFF, 0x07, 0x29, 0xFF, 0x07, 0x21, 0xFF, 0x28, 0x29, 0xFF, 0xF4, 0x7A, 0xFF, 0x2A, 0x31, 0xFF, 0x8C, 0x49, 0xFF, 0x4D, 0x39, 0xFF, 0xEF, 0x38, 0xFF, 0xB2, 0x62, 0xFF, 0x97, 0x69, 0xFF, 0x8E, 0x49, 0xFF, 0x0A, 0x31, 0xFF, 0x6B, 0x39, 0xFF, 0xB4, 0x7A, 0xFF, 0xC8, 0x20, 0xFF, 0x87, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0xA7, 0x18, 0xFF, 0x53, 0x5A, 0xFF, 0xA6, 0x18, 0xFF, 0xA7, 0x18, 0xFF, 0xE8, 0x20, 0xFF, 0x86, 0x18, 0xFF, 0xB0, 0x41, 0xFF, 0x86, 0x10, 0xFF, 0xC7, 0x20, 0xFF, 0x88, 0x39, 0xFF, 0x08, 0x29, 0xFF, 0xCF, 0x51, 0xFF, 0x89, 0x41, 0xFF, 0xC7, 0x20, 0xFF, 0xA8, 0x20, 0xFF, 0x67, 0x18, 0xFF, 0x36, 0x49, 0xFF, 0x68, 0x18, 0xFF, 0x89, 0x20, 0xFF, 0x89, 0x18, 0xFF, 0x69, 0x18, 0xFF, 0xDC, 0x50, 0xFF, 0x6B, 0x20, 0xFF, 0x6B, 0x20, 0xFF, 0x4B, 0x18, 0xFF, 0x4D, 0x20, 0xFF, 0x9A, 0x50, 0xFF, 0x8F, 0x28, 0xFF, 0x6E, 0x20, 0xFF, 0xD0, 0x30, 0xFF, 0xAF, 0x28, 0xFF, 0xD0, 0x30, 0xFF,
+    0xA5, 0x18, 0xCC, 0x39, 0xC6, 0x18, 0xC6, 0x18, 0xA5, 0x18, 0x07, 0x21, 0x4E, 0x52, 0x06, 0x21, 0x07, 0x29, 0xE7, 0x20, 0xE7, 0x20, 0xE6, 0x20, 0x27, 0x29, 0x07, 0x21, 0x07, 0x29, 0x48, 0x31, 0x07, 0x21, 0x11, 0x6B, 0x07, 0x29, 0x27, 0x29, 0x27, 0x29, 0x48, 0x31, 0x68, 0x31, 0x92, 0x83, 0x48, 0x31, 0x68, 0x31, 0x48, 0x31, 0x27, 0x29, 0x50, 0x83, 0x68, 0x31, 0x68, 0x31, 0x48, 0x31,
+    0x68, 0x31, 0x67, 0x31, 0xCA, 0x41, 0x69, 0x31, 0xAA, 0x39, 0x69, 0x31, 0x69, 0x31, 0xCB, 0x41, 0x8B, 0x39, 0x6A, 0x39, 0xAB, 0x41, 0x8A, 0x39, 0xD3, 0x83, 0x8B, 0x39, 0x6B, 0x39, 0x4B, 0x31, 0x8D, 0x39, 0x2B, 0x31, 0x6C, 0x31, 0x2B, 0x31, 0x4B, 0x31, 0x4B, 0x31, 0x6B, 0x31, 0x92, 0x7B, 0x2A, 0x29, 0x29, 0x29, 0xAB, 0x39, 0x29, 0x29, 0x4B, 0x21, 0x6A, 0x29, 0x09, 0x21, 0x29, 0x21,
+    0x69, 0x29, 0xCC, 0x39, 0x10, 0x63, 0x49, 0x29, 0x8B, 0x31, 0x6A, 0x29, 0xAB, 0x31, 0x2D, 0x4A, 0xCC, 0x39, 0xED, 0x41, 0xAC, 0x39, 0xCC, 0x39, 0xCB, 0x39, 0xCB, 0x41, 0x48, 0x29, 0x8A, 0x31, 0xC6, 0x20, 0xEC, 0x41, 0xE6, 0x20, 0xC6, 0x20, 0xE6, 0x20, 0xE7, 0x20, 0xE7, 0x20, 0xAA, 0x39, 0xAA, 0x41, 0xE7, 0x28, 0x48, 0x31, 0xC6, 0x20, 0x8D, 0x5A, 0xD4, 0x83, 0x48, 0x31, 0xE7, 0x28,
+    0x28, 0x29, 0x07, 0x29, 0x0B, 0x4A, 0x2C, 0x4A, 0x48, 0x31, 0x68, 0x31, 0x89, 0x39, 0x30, 0x7B, 0x89, 0x31, 0x48, 0x31, 0x89, 0x41, 0xCA, 0x41, 0xCD, 0x62, 0x2D, 0x83, 0xA9, 0x41, 0xEA, 0x41, 0xA9, 0x39, 0x88, 0x39, 0x54, 0xA4, 0x89, 0x39, 0xAA, 0x39, 0x69, 0x31, 0x54, 0x9C, 0xF1, 0x72, 0x49, 0x31, 0xCB, 0x49, 0x0C, 0x4A, 0xEC, 0x41, 0xB5, 0xAC, 0xCD, 0x41, 0x8C, 0x39, 0xCD, 0x41,
+    0x0E, 0x4A, 0xD1, 0x62, 0x8F, 0x39, 0xAC, 0x41, 0x8C, 0x39, 0x6B, 0x31, 0xED, 0x41, 0xD0, 0x5A, 0x4A, 0x31, 0x29, 0x29, 0x29, 0x29, 0x4A, 0x29, 0xD0, 0x62, 0x4A, 0x29, 0x28, 0x21, 0x49, 0x29, 0x89, 0x29, 0x69, 0x29, 0x2D, 0x42, 0x49, 0x29, 0x28, 0x29, 0x6A, 0x29, 0x6A, 0x31, 0xB3, 0x73, 0xE7, 0x20, 0x49, 0x31, 0x6B, 0x31, 0xAB, 0x39, 0xCE, 0x5A, 0xA9, 0x31, 0x8A, 0x31, 0xA9, 0x31,
+    0x07, 0x21, 0xC5, 0x18, 0xE6, 0x20, 0x6A, 0x31, 0xE6, 0x20, 0xC6, 0x18, 0xE6, 0x20, 0x07, 0x29, 0x49, 0x31, 0xC6, 0x20, 0x07, 0x21, 0xE7, 0x20, 0x07, 0x29, 0x07, 0x29, 0xCA, 0x41, 0x27, 0x29, 0x27, 0x29, 0x27, 0x29, 0x28, 0x29, 0x69, 0x31, 0x48, 0x31, 0x28, 0x29, 0x69, 0x31, 0x47, 0x31, 0x48, 0x31, 0x68, 0x39, 0x69, 0x39, 0x68, 0x31, 0x48, 0x31, 0xA9, 0x39, 0x68, 0x39, 0xAA, 0x41,
+    0xA9, 0x41, 0x68, 0x39, 0xCA, 0x41, 0xCA, 0x41, 0x8A, 0x39, 0x69, 0x31, 0x49, 0x31, 0x6A, 0x39, 0x8A, 0x39, 0x6A, 0x39, 0x8A, 0x39, 0x6A, 0x39, 0xAC, 0x41, 0x8C, 0x39, 0xAD, 0x41, 0x4C, 0x39, 0xCE, 0x41, 0x6C, 0x31, 0xAE, 0x41, 0x6C, 0x39, 0x8D, 0x39, 0x8C, 0x39, 0x8B, 0x39, 0x4B, 0x31, 0x8B, 0x39, 0x10, 0x42, 0x6B, 0x31, 0xAC, 0x31, 0xAD, 0x29, 0x8B, 0x21, 0x6A, 0x29, 0x49, 0x29,
+    0xAC, 0x39, 0x49, 0x29, 0x49, 0x29, 0x4A, 0x29, 0x8B, 0x31, 0x8B, 0x31, 0xAC, 0x31, 0xEE, 0x39, 0x0D, 0x42, 0xCF, 0x41, 0x6B, 0x31, 0xAB, 0x39, 0xAA, 0x39, 0x8A, 0x31, 0x8A, 0x31, 0x69, 0x31, 0x07, 0x21, 0xC6, 0x18, 0xE7, 0x20, 0xAC, 0x39, 0xE6, 0x20, 0x07, 0x21, 0xE7, 0x20, 0xE7, 0x20, 0x49, 0x31, 0x28, 0x31, 0xE7, 0x20, 0x27, 0x29, 0x28, 0x29, 0xEA, 0x41, 0x89, 0x39, 0x28, 0x31,
+    0x48, 0x31, 0x89, 0x39, 0x68, 0x31, 0x8A, 0x39, 0x27, 0x31, 0x6B, 0x39, 0x89, 0x39, 0x88, 0x39, 0x50, 0x7B, 0x68, 0x39, 0x68, 0x31, 0x88, 0x39, 0xA9, 0x39, 0x12, 0x7B, 0xA9, 0x49, 0x2A, 0x62, 0xA9, 0x41, 0xC9, 0x41, 0xD1, 0x93, 0x89, 0x41, 0xAB, 0x41, 0x8A, 0x39, 0x8A, 0x39, 0xEC, 0x49, 0x49, 0x31, 0xAB, 0x41, 0xAB, 0x41, 0xED, 0x49, 0x11, 0x73, 0x4B, 0x31, 0x0F, 0x52, 0xAE, 0x41,
+    0xB0, 0x49, 0x72, 0x62, 0xAD, 0x41, 0x8D, 0x39, 0x8C, 0x39, 0x8C, 0x39, 0x11, 0x6B, 0x8C, 0x39, 0x8B, 0x31, 0xAC, 0x39, 0xAC, 0x31, 0xB1, 0x52, 0x3B, 0x4B, 0xAD, 0x31, 0x4A, 0x29, 0x4A, 0x29, 0x6E, 0x4A, 0x6A, 0x29, 0x49, 0x29, 0x8B, 0x31, 0x8A, 0x31, 0x2D, 0x4A, 0x8B, 0x31, 0xFF, 0xFF, 0xAD, 0x39, 0xF7, 0x59, 0x32, 0x6B, 0xAB, 0x31, 0x8A, 0x31, 0xCB, 0x39, 0x8A, 0x31, 0xCB, 0x39,
+    0x07, 0x21, 0xC6, 0x18, 0x08, 0x29, 0xE7, 0x20, 0xC6, 0x20, 0xC6, 0x20, 0xE6, 0x20, 0xC6, 0x20, 0xE7, 0x28, 0xE7, 0x20, 0xC6, 0x20, 0x07, 0x29, 0x07, 0x29, 0xE7, 0x28, 0x27, 0x29, 0x07, 0x21, 0x07, 0x29, 0x48, 0x31, 0x27, 0x29, 0x27, 0x31, 0x48, 0x31, 0x48, 0x31, 0x48, 0x31, 0x68, 0x31, 0x68, 0x31, 0x89, 0x39, 0x68, 0x39, 0x88, 0x39, 0xA9, 0x39, 0xA9, 0x39, 0xA9, 0x41, 0x88, 0x39,
+    0xEA, 0x49, 0xA9, 0x39, 0xCA, 0x41, 0xA9, 0x39, 0x8A, 0x39, 0x8A, 0x39, 0xAA, 0x41, 0x8A, 0x39, 0x6A, 0x39, 0x8A, 0x39, 0xED, 0x49, 0xAC, 0x39, 0x8D, 0x41, 0xCD, 0x41, 0xD0, 0x49, 0xAF, 0x41, 0xB0, 0x49, 0xD2, 0x51, 0xAF, 0x41, 0x4C, 0x39, 0x8D, 0x39, 0xAD, 0x41, 0x8D, 0x39, 0x8F, 0x52, 0xAE, 0x31, 0xAC, 0x31, 0x4F, 0x42, 0xD3, 0x4A, 0x72, 0x2A, 0x8E, 0x31, 0x6A, 0x29, 0x4A, 0x29,
+    0x48, 0x29, 0xCC, 0x31, 0x6A, 0x29, 0x8A, 0x31, 0xAB, 0x31, 0x6B, 0x31, 0xAC, 0x31, 0xCE, 0x31, 0x4B, 0x29, 0xCF, 0x41, 0xAC, 0x39, 0xAB, 0x39, 0xEC, 0x39, 0x8A, 0x31, 0xCC, 0x39, 0x0C, 0x42, 0x6A, 0x31, 0xE7, 0x20, 0xC7, 0x20, 0x07, 0x21, 0xC6, 0x20, 0xCD, 0x41, 0x07, 0x21, 0x08, 0x29, 0x07, 0x29, 0x4C, 0x52, 0x2D, 0x4A, 0x07, 0x29, 0x28, 0x31, 0x28, 0x31, 0x27, 0x29, 0xCE, 0x62,
+    0x2B, 0x52, 0x07, 0x29, 0x89, 0x39, 0xA9, 0x39, 0x48, 0x31, 0x88, 0x39, 0x48, 0x39, 0x47, 0x31, 0x8D, 0x5A, 0xA9, 0x41, 0xA9, 0x41, 0xC9, 0x41, 0xCA, 0x49, 0x70, 0x83, 0xC9, 0x41, 0xE9, 0x51, 0xA9, 0x41, 0xD1, 0x93, 0x70, 0x83, 0xA9, 0x41, 0xCB, 0x41, 0xAA, 0x41, 0xCA, 0x41, 0x8D, 0x5A, 0xAA, 0x41, 0x2C, 0x52, 0xEC, 0x49, 0xCC, 0x49, 0xD1, 0x6A, 0xAD, 0x41, 0xAF, 0x49, 0xAF, 0x41,
+    0x11, 0x52, 0xF2, 0x51, 0x13, 0x5A, 0xAF, 0x41, 0xF0, 0x49, 0xF1, 0x62, 0x8D, 0x39, 0x8C, 0x39, 0x6B, 0x31, 0x6A, 0x31, 0xB0, 0x5A, 0xED, 0x39, 0x8C, 0x31, 0xAB, 0x31, 0x6A, 0x31, 0xAF, 0x52, 0x69, 0x29, 0x49, 0x29, 0x6A, 0x29, 0x8A, 0x31, 0x6E, 0x52, 0x8B, 0x31, 0x8B, 0x39, 0xED, 0x41, 0x4A, 0x29, 0xED, 0x41, 0x90, 0x5A, 0x8A, 0x31, 0xAB, 0x39, 0xCC, 0x41, 0x2D, 0x4A, 0x2D, 0x4A,
+    0xE7, 0x20, 0x4F, 0x52, 0xE7, 0x20, 0x07, 0x29, 0x28, 0x29, 0xE7, 0x20, 0x8B, 0x39, 0x2E, 0x52, 0xE7, 0x20, 0x28, 0x29, 0x07, 0x29, 0x28, 0x29, 0x56, 0x9C, 0x07, 0x29, 0x07, 0x29, 0x28, 0x29, 0x28, 0x29, 0xF1, 0x72, 0xB0, 0x72, 0x48, 0x31, 0x48, 0x31, 0x69, 0x31, 0x68, 0x39, 0x93, 0x93, 0x88, 0x39, 0x88, 0x39, 0x88, 0x39, 0x47, 0x31, 0x91, 0xA3, 0xC9, 0x49, 0xA9, 0x41, 0x88, 0x39,
+    0xC9, 0x41, 0xEA, 0x49, 0x34, 0xA4, 0xAA, 0x41, 0xAA, 0x41, 0xAA, 0x39, 0x8A, 0x39, 0x71, 0x83, 0xCB, 0x41, 0xAC, 0x41, 0x2F, 0x52, 0xAC, 0x41, 0xB4, 0x93, 0xEE, 0x51, 0xF1, 0x51, 0xD0, 0x49, 0xD0, 0x49, 0x35, 0x5A, 0xD0, 0x49, 0xD0, 0x49, 0xAE, 0x39, 0x0F, 0x4A, 0x6C, 0x31, 0x71, 0x6B, 0x8B, 0x39, 0x0E, 0x3A, 0x6B, 0x29, 0x8B, 0x31, 0x0F, 0x63, 0xAC, 0x31, 0x49, 0x29, 0x69, 0x29,
+    0x49, 0x29, 0x6A, 0x29, 0x51, 0x73, 0x8A, 0x31, 0x6B, 0x31, 0x8B, 0x31, 0xCC, 0x39, 0xEF, 0x62, 0x6A, 0x29, 0xCC, 0x39, 0xCD, 0x39, 0xAB, 0x39, 0xCF, 0x62, 0xCC, 0x41, 0x0D, 0x4A, 0xCC, 0x41, 0x48, 0x31, 0x07, 0x21, 0x28, 0x29, 0xE7, 0x20, 0xE7, 0x20, 0xE7, 0x20, 0xEB, 0x41, 0x0E, 0x4A, 0x08, 0x29, 0x49, 0x31, 0x08, 0x29, 0x28, 0x29, 0x49, 0x31, 0xE7, 0x28, 0x49, 0x31, 0x07, 0x29,
+    0x0B, 0x4A, 0x48, 0x31, 0x15, 0x94, 0x8A, 0x39, 0xEB, 0x49, 0xAA, 0x41, 0x69, 0x39, 0x49, 0x31, 0x89, 0x39, 0x2F, 0x6B, 0x47, 0x31, 0xA9, 0x41, 0xC9, 0x49, 0xAC, 0x62, 0xCD, 0x6A, 0x09, 0x5A, 0x2B, 0x5A, 0xA9, 0x41, 0xB1, 0x93, 0xEA, 0x49, 0xCA, 0x49, 0x8A, 0x41, 0xAA, 0x41, 0x6E, 0x62, 0x8A, 0x41, 0x0D, 0x52, 0x0E, 0x52, 0x12, 0x73, 0xF1, 0x7A, 0x52, 0x62, 0xF1, 0x51, 0x13, 0x5A,
+    0x72, 0x62, 0xF1, 0x49, 0xF2, 0x51, 0xCF, 0x49, 0xAF, 0x41, 0x8E, 0x39, 0xAC, 0x39, 0x8C, 0x31, 0xCD, 0x39, 0x6F, 0x52, 0x6B, 0x29, 0x4A, 0x31, 0xED, 0x39, 0x8B, 0x31, 0xB0, 0x5A, 0x6A, 0x29, 0x69, 0x29, 0x8A, 0x31, 0xAF, 0x5A, 0x8B, 0x31, 0xAC, 0x39, 0xCC, 0x39, 0x6B, 0x31, 0x6E, 0x52, 0x49, 0x29, 0x8C, 0x31, 0xCC, 0x39, 0xCC, 0x39, 0x4F, 0x52, 0x4E, 0x4A, 0xEE, 0x41, 0xED, 0x41,
+    0xE7, 0x20, 0xA6, 0x18, 0xE7, 0x20, 0xAB, 0x41, 0x08, 0x29, 0xE7, 0x20, 0xC7, 0x20, 0xE7, 0x20, 0x4E, 0x52, 0x69, 0x31, 0x49, 0x31, 0x08, 0x29, 0x28, 0x31, 0x4D, 0x5A, 0x49, 0x39, 0x28, 0x31, 0x28, 0x31, 0x48, 0x31, 0x68, 0x31, 0xF4, 0x8B, 0x68, 0x39, 0x89, 0x39, 0x88, 0x39, 0x68, 0x39, 0x33, 0xAC, 0x68, 0x39, 0xA8, 0x41, 0xA8, 0x41, 0xE9, 0x49, 0x53, 0xC4, 0x2F, 0x73, 0xC9, 0x49,
+    0xC9, 0x49, 0xE9, 0x49, 0xB3, 0xBC, 0xA9, 0x41, 0xEB, 0x49, 0xCA, 0x49, 0xAA, 0x41, 0x11, 0x73, 0xCB, 0x49, 0x0E, 0x52, 0xEE, 0x51, 0x0E, 0x52, 0xB4, 0x8B, 0x10, 0x52, 0xB1, 0x49, 0xF3, 0x51, 0x5A, 0x72, 0x35, 0x7B, 0x14, 0x52, 0xF2, 0x51, 0x8F, 0x41, 0xAE, 0x41, 0x93, 0x73, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x6B, 0x31, 0x51, 0x6B, 0x6B, 0x31, 0x8B, 0x31, 0x6A, 0x29, 0x6A, 0x29,
+    0xCC, 0x39, 0x8A, 0x31, 0x8A, 0x31, 0x8A, 0x31, 0xAB, 0x31, 0x11, 0x63, 0x8B, 0x31, 0x6B, 0x31, 0xAB, 0x31, 0xAB, 0x31, 0x10, 0x63, 0x0D, 0x4A, 0x2F, 0x4A, 0x4F, 0x4A, 0x30, 0x4A, 0x2E, 0x4A, 0xC7, 0x20, 0xC7, 0x20, 0xE7, 0x20, 0x28, 0x29, 0x8B, 0x39, 0xC7, 0x18, 0xE8, 0x20, 0x28, 0x29, 0xE7, 0x20, 0x49, 0x31, 0x07, 0x29, 0x49, 0x31, 0x08, 0x29, 0x49, 0x31, 0xAA, 0x39, 0x69, 0x39,
+    0x08, 0x29, 0x6D, 0x52, 0x69, 0x31, 0x48, 0x31, 0x48, 0x31, 0x69, 0x39, 0xEA, 0x49, 0xA9, 0x41, 0x88, 0x41, 0x88, 0x41, 0x8D, 0x62, 0xF1, 0x8B, 0x0B, 0x5A, 0x4F, 0x8B, 0x4F, 0x7B, 0xC9, 0x49, 0x2A, 0x52, 0xC9, 0x49, 0x8D, 0x62, 0x2B, 0x52, 0xEB, 0x49, 0xEB, 0x49, 0xCB, 0x49, 0x4D, 0x5A, 0xCB, 0x49, 0xED, 0x51, 0x0E, 0x52, 0x4F, 0x5A, 0xB1, 0x62, 0xEF, 0x49, 0xF2, 0x51, 0x38, 0x6A,
+    0x7E, 0x92, 0xF4, 0x61, 0x13, 0x5A, 0xF6, 0x69, 0xF0, 0x49, 0xCF, 0x41, 0x6D, 0x31, 0xCD, 0x39, 0x4F, 0x52, 0x6B, 0x29, 0xCC, 0x39, 0x6E, 0x4A, 0x8B, 0x31, 0x2D, 0x42, 0x89, 0x29, 0x8A, 0x31, 0x69, 0x29, 0x8E, 0x52, 0xCB, 0x39, 0x8A, 0x31, 0xAB, 0x31, 0xF0, 0x62, 0x49, 0x29, 0x8B, 0x31, 0xAB, 0x39, 0xCD, 0x39, 0x70, 0x52, 0x6B, 0x31, 0xEF, 0x41, 0xEE, 0x41, 0x0F, 0x4A, 0x0D, 0x4A,
+    0xE7, 0x20, 0x49, 0x29, 0x08, 0x29, 0x08, 0x21, 0x08, 0x29, 0xAB, 0x39, 0x49, 0x31, 0xE8, 0x20, 0x08, 0x29, 0x86, 0x10, 0x0D, 0x4A, 0xEB, 0x49, 0x08, 0x29, 0x08, 0x29, 0x33, 0x94, 0x8A, 0x41, 0x48, 0x31, 0x48, 0x31, 0xEA, 0x41, 0x69, 0x39, 0x30, 0x73, 0xCA, 0x41, 0x6E, 0x5A, 0x68, 0x39, 0x6F, 0x83, 0xC9, 0x49, 0xAD, 0x62, 0xC9, 0x49, 0xC9, 0x49, 0x13, 0xD5, 0xCD, 0x72, 0xE9, 0x49,
+    0x2B, 0x5A, 0xED, 0x6A, 0xB2, 0xAC, 0x0A, 0x52, 0xEA, 0x49, 0xEB, 0x49, 0x0B, 0x52, 0x92, 0x8B, 0xCB, 0x49, 0x2D, 0x5A, 0x2E, 0x52, 0xB1, 0x6A, 0x34, 0x83, 0x76, 0x6A, 0x39, 0x83, 0xD9, 0x82, 0x3F, 0xF4, 0x18, 0x72, 0x14, 0x5A, 0x73, 0x5A, 0xCF, 0x41, 0x93, 0x7B, 0xAE, 0x41, 0xAE, 0x39, 0xAC, 0x39, 0xAC, 0x39, 0x32, 0x6B, 0x8B, 0x31, 0xEC, 0x39, 0x8A, 0x31, 0x49, 0x29, 0x11, 0x63,
+    0x4E, 0x4A, 0x8A, 0x31, 0xAB, 0x31, 0xEC, 0x41, 0x11, 0x63, 0x8B, 0x31, 0x6A, 0x31, 0xAB, 0x31, 0xF0, 0x5A, 0x0F, 0x4A, 0x2F, 0x4A, 0x8B, 0x39, 0x30, 0x4A, 0x0E, 0x4A, 0x53, 0x5A, 0x50, 0x52, 0x86, 0x18, 0x92, 0x52, 0xCC, 0x41, 0xC7, 0x20, 0x08, 0x29, 0xE8, 0x20, 0x08, 0x29, 0x8B, 0x39, 0x09, 0x29, 0x28, 0x29, 0x6A, 0x39, 0x6A, 0x39, 0x91, 0x5A, 0x6A, 0x39, 0x69, 0x31, 0x49, 0x31,
+    0xAB, 0x41, 0x28, 0x29, 0x69, 0x31, 0x89, 0x39, 0x89, 0x39, 0xA9, 0x41, 0x68, 0x39, 0xF4, 0x93, 0xA8, 0x41, 0xEA, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0x91, 0x8B, 0xE9, 0x51, 0x0A, 0x5A, 0x0A, 0x5A, 0x09, 0x52, 0xC9, 0x49, 0x57, 0xC5, 0x0A, 0x52, 0xEA, 0x49, 0x2C, 0x5A, 0x0C, 0x52, 0x8E, 0x62, 0x0C, 0x4A, 0x2D, 0x62, 0xED, 0x51, 0x55, 0x83, 0x10, 0x52, 0xDA, 0x72, 0x94, 0x51, 0x5E, 0x92,
+    0xFF, 0xFF, 0x3C, 0x8A, 0x36, 0x6A, 0x77, 0x62, 0xB1, 0x49, 0xEE, 0x41, 0x58, 0x94, 0xEE, 0x41, 0xAC, 0x39, 0x8B, 0x31, 0xCC, 0x39, 0x8A, 0x31, 0x8A, 0x31, 0x89, 0x29, 0x49, 0x29, 0x69, 0x29, 0x8A, 0x29, 0xAB, 0x31, 0xCC, 0x39, 0x0D, 0x4A, 0x6B, 0x29, 0xCC, 0x39, 0xAB, 0x31, 0x6F, 0x52, 0x2F, 0x4A, 0x2F, 0x4A, 0x50, 0x4A, 0x8B, 0x31, 0x0F, 0x42, 0x32, 0x5A, 0xFF, 0xFF, 0x72, 0x5A,
+    0xE8, 0x20, 0x08, 0x21, 0xE8, 0x20, 0x29, 0x29, 0xE7, 0x20, 0xE8, 0x20, 0x28, 0x29, 0x97, 0x6B, 0x2A, 0x31, 0x09, 0x29, 0x8A, 0x39, 0x08, 0x31, 0xB2, 0x62, 0xCC, 0x41, 0x8A, 0x39, 0x6A, 0x39, 0xCB, 0x41, 0xB0, 0x62, 0x54, 0x83, 0x2C, 0x52, 0xEC, 0x49, 0x89, 0x41, 0x47, 0x39, 0x77, 0xAC, 0x33, 0x94, 0x12, 0x94, 0xEA, 0x51, 0x2B, 0x5A, 0xD3, 0x93, 0x0D, 0x83, 0x2A, 0x62, 0x2A, 0x5A,
+    0x2A, 0x5A, 0x4A, 0x62, 0xB3, 0xB4, 0x4B, 0x5A, 0xEB, 0x49, 0x0B, 0x52, 0xB2, 0xED, 0x54, 0x9C, 0x2B, 0x5A, 0x8D, 0x72, 0x2C, 0x62, 0x56, 0x8B, 0xB8, 0xAC, 0x50, 0x5A, 0xF3, 0x51, 0x7B, 0x82, 0xDC, 0x9A, 0xD9, 0x9B, 0x34, 0x5A, 0x12, 0x52, 0xB3, 0x62, 0xAE, 0x39, 0xB6, 0x7B, 0x17, 0x7C, 0xED, 0x41, 0xF1, 0x5A, 0xED, 0x41, 0x8E, 0x4A, 0x15, 0x7C, 0xAE, 0x52, 0x4A, 0x29, 0xAA, 0x31,
+    0x0C, 0x42, 0x52, 0x6B, 0x6E, 0x52, 0xCB, 0x39, 0xCC, 0x39, 0xEC, 0x39, 0x0C, 0x42, 0xB0, 0x52, 0x0F, 0x42, 0x2F, 0x4A, 0x50, 0x4A, 0xAB, 0x39, 0x14, 0x84, 0x8C, 0x39, 0x51, 0x52, 0x8F, 0x52, 0x08, 0x29, 0xE8, 0x20, 0x29, 0x29, 0x8D, 0x39, 0xCD, 0x41, 0x8A, 0x39, 0x08, 0x29, 0x09, 0x29, 0xB2, 0x5A, 0x2A, 0x31, 0x4A, 0x31, 0x69, 0x31, 0x6A, 0x31, 0x2E, 0x52, 0xCC, 0x41, 0x49, 0x31,
+    0xCC, 0x41, 0x8E, 0x5A, 0x69, 0x39, 0x12, 0x73, 0xEB, 0x49, 0xAA, 0x41, 0xCA, 0x41, 0xC9, 0x41, 0xB6, 0xD4, 0x0A, 0x52, 0x90, 0x8B, 0x4F, 0x83, 0x6B, 0x6A, 0x73, 0xC4, 0x31, 0xAC, 0x8F, 0x8B, 0xCC, 0x72, 0x11, 0x9C, 0x95, 0xE5, 0x4C, 0x62, 0xCA, 0x49, 0xEB, 0x51, 0xAE, 0x6A, 0xD4, 0x9B, 0x6C, 0x6A, 0x91, 0xD4, 0xEE, 0xB3, 0x93, 0x8B, 0x35, 0xA4, 0x70, 0x62, 0x90, 0x49, 0x55, 0x6A,
+    0xF5, 0x59, 0xF7, 0x9B, 0x34, 0x5A, 0xAF, 0x41, 0x34, 0x73, 0xEE, 0x41, 0x57, 0x8C, 0xCC, 0x39, 0xF2, 0x62, 0xAC, 0x39, 0x35, 0x5B, 0xD4, 0x83, 0xAB, 0x39, 0x6C, 0x29, 0x8A, 0x29, 0xAA, 0x31, 0xB3, 0x6B, 0xAF, 0x5A, 0xAB, 0x31, 0xAA, 0x31, 0xAB, 0x31, 0xF0, 0x5A, 0x2D, 0x42, 0x2F, 0x4A, 0x30, 0x4A, 0x6F, 0x4A, 0xF0, 0x5A, 0x6A, 0x31, 0x4E, 0x4A, 0xAB, 0x39, 0xB0, 0x5A, 0x6E, 0x52,
+    0x8B, 0x39, 0x09, 0x29, 0x49, 0x31, 0x6A, 0x31, 0xC8, 0x20, 0x6B, 0x39, 0x09, 0x29, 0x09, 0x29, 0x09, 0x29, 0xAC, 0x39, 0x6A, 0x31, 0x6A, 0x39, 0x29, 0x31, 0xAB, 0x39, 0x56, 0x94, 0x29, 0x31, 0x08, 0x29, 0xAB, 0x39, 0xAF, 0x62, 0x6A, 0x39, 0xAA, 0x41, 0x89, 0x41, 0x11, 0x73, 0x89, 0x41, 0x71, 0x9B, 0x09, 0x52, 0x71, 0x83, 0xEC, 0x7A, 0x4E, 0x9B, 0x12, 0xDD, 0xAD, 0xAB, 0x2D, 0x93,
+    0xEC, 0x7A, 0x29, 0x62, 0xF5, 0xED, 0x4C, 0x62, 0xEB, 0x51, 0x0B, 0x52, 0x6C, 0x62, 0x54, 0xAC, 0x2B, 0x62, 0x6D, 0xA3, 0x4F, 0x9B, 0xF5, 0x93, 0xB0, 0x72, 0x0E, 0x52, 0xF1, 0x51, 0x56, 0x83, 0x32, 0x5A, 0x31, 0x5A, 0xD0, 0x49, 0x96, 0x83, 0x0F, 0x4A, 0xEF, 0x41, 0xAD, 0x39, 0x0D, 0x42, 0xCC, 0x39, 0x37, 0x53, 0xCC, 0x39, 0xCB, 0x39, 0xAB, 0x31, 0x8A, 0x31, 0xAB, 0x31, 0xAB, 0x31,
+    0x32, 0x63, 0xAA, 0x31, 0xCB, 0x39, 0xCB, 0x39, 0x6F, 0x4A, 0xED, 0x41, 0xAC, 0x39, 0x30, 0x4A, 0x92, 0x4A, 0x0D, 0x42, 0x6F, 0x4A, 0x0D, 0x42, 0x90, 0x52, 0xEB, 0x41, 0xAF, 0x5A, 0xAF, 0x5A, 0x29, 0x29, 0xAD, 0x39, 0x6A, 0x31, 0xE9, 0x20, 0x09, 0x29, 0x6A, 0x31, 0x8B, 0x39, 0x8C, 0x39, 0xE9, 0x28, 0x4A, 0x31, 0xCD, 0x41, 0x4B, 0x31, 0x29, 0x31, 0xAB, 0x41, 0xAC, 0x41, 0xB0, 0x5A,
+    0x4A, 0x31, 0x49, 0x39, 0xAA, 0x41, 0xCB, 0x49, 0xF3, 0x8B, 0x2C, 0x52, 0x0B, 0x4A, 0xA9, 0x41, 0x4C, 0x62, 0x2A, 0x62, 0x4A, 0x6A, 0x0C, 0x8B, 0x90, 0xD4, 0xFD, 0xFF, 0x74, 0xFF, 0xCD, 0xB3, 0x4D, 0x93, 0x0C, 0x7B, 0xD5, 0xDD, 0x6C, 0x6A, 0x2C, 0x5A, 0x2C, 0x5A, 0xD5, 0xB4, 0x32, 0x83, 0x4F, 0x83, 0xAD, 0x72, 0xAF, 0x72, 0xB1, 0x6A, 0x74, 0x83, 0x0F, 0x52, 0x53, 0x62, 0xF0, 0x51,
+    0xB4, 0x6A, 0x95, 0x62, 0x31, 0x52, 0x10, 0x52, 0x72, 0x5A, 0x98, 0x94, 0xED, 0x39, 0x0E, 0x42, 0x16, 0x6B, 0x53, 0x5B, 0xD5, 0x6B, 0xCB, 0x39, 0x2E, 0x42, 0xAB, 0x31, 0xD0, 0x52, 0xB4, 0x6B, 0xEB, 0x31, 0xCB, 0x31, 0xEB, 0x39, 0xB4, 0x6B, 0xED, 0x39, 0x0D, 0x42, 0xCC, 0x41, 0xEF, 0x39, 0x73, 0x73, 0x4E, 0x4A, 0x91, 0x52, 0xED, 0x41, 0x4E, 0x4A, 0x2D, 0x4A, 0x90, 0x52, 0xD0, 0x5A,
+    0x09, 0x29, 0x09, 0x29, 0x2A, 0x29, 0x4B, 0x31, 0x2A, 0x29, 0x4A, 0x31, 0x09, 0x29, 0x0F, 0x4A, 0x0A, 0x29, 0x6B, 0x31, 0x4A, 0x31, 0x6B, 0x39, 0x30, 0x4A, 0x4A, 0x31, 0x8B, 0x41, 0xAB, 0x41, 0xB1, 0x62, 0x4A, 0x39, 0x08, 0x31, 0xAF, 0x62, 0x8A, 0x41, 0xAA, 0x41, 0xCB, 0x7A, 0xCE, 0x72, 0x0A, 0x52, 0xD4, 0xAC, 0x4A, 0x72, 0x2E, 0x93, 0x4D, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xBB,
+    0x0D, 0x8B, 0x69, 0x62, 0x15, 0xDE, 0xB4, 0xCD, 0x0B, 0x52, 0x0B, 0x52, 0x0C, 0x52, 0x13, 0xAC, 0x0B, 0x5A, 0x2D, 0x5A, 0x2E, 0x5A, 0x8D, 0x49, 0x0F, 0x52, 0x10, 0x52, 0x52, 0x5A, 0xF3, 0x59, 0xBA, 0xA3, 0xB7, 0x72, 0x53, 0x5A, 0x33, 0x5A, 0xFF, 0xE5, 0x0F, 0x42, 0xEE, 0x41, 0x0F, 0x4A, 0xED, 0x41, 0xD6, 0x83, 0x2D, 0x42, 0x0E, 0x42, 0xEC, 0x39, 0xEC, 0x39, 0xD6, 0x7B, 0x8F, 0x52,
+    0xEB, 0x31, 0xEB, 0x39, 0xB0, 0x5A, 0x2E, 0x42, 0x0E, 0x42, 0x0D, 0x42, 0xED, 0x39, 0x73, 0x6B, 0x50, 0x4A, 0xED, 0x39, 0xF2, 0x5A, 0x74, 0x73, 0xD1, 0x62, 0xF3, 0x6A, 0x54, 0x73, 0x90, 0x5A, 0xC7, 0x20, 0xB4, 0x5A, 0xB3, 0x5A, 0x0A, 0x29, 0x2A, 0x29, 0x6B, 0x39, 0x2A, 0x31, 0x17, 0x6B, 0x2A, 0x29, 0x8C, 0x39, 0x4B, 0x31, 0x4A, 0x31, 0x7A, 0x7B, 0x8B, 0x39, 0x6B, 0x39, 0x2A, 0x29,
+    0xED, 0x49, 0xB1, 0x62, 0x1F, 0xE6, 0xAF, 0x62, 0x0F, 0x6B, 0x0B, 0x52, 0x2C, 0x52, 0x36, 0xB4, 0x90, 0x8B, 0x2A, 0x5A, 0x6C, 0x6A, 0xAC, 0x7A, 0x57, 0xED, 0xD1, 0xFD, 0xD5, 0xFE, 0x10, 0xBC, 0x4E, 0x93, 0xEA, 0x7A, 0xF5, 0xCC, 0x90, 0x9B, 0x2C, 0x5A, 0x0B, 0x52, 0xEB, 0x59, 0x95, 0xBC, 0xAD, 0x72, 0x2D, 0x52, 0x71, 0x62, 0xBB, 0xCD, 0x98, 0xB4, 0xBF, 0xAB, 0x98, 0x61, 0x7B, 0x82,
+    0x7D, 0xF5, 0x5F, 0xCC, 0x3A, 0x8B, 0x12, 0x4A, 0xF4, 0x6A, 0x10, 0x4A, 0x57, 0x7B, 0x18, 0xAD, 0x2E, 0x4A, 0x10, 0x42, 0x33, 0x42, 0x2E, 0x42, 0x95, 0x94, 0x13, 0x63, 0x0E, 0x3A, 0xCB, 0x31, 0x0C, 0x3A, 0x98, 0x94, 0x8F, 0x52, 0x4E, 0x42, 0x2E, 0x42, 0x10, 0x4A, 0x0E, 0x42, 0x75, 0x84, 0xF4, 0x5A, 0xEE, 0x39, 0xD2, 0x5A, 0x97, 0x7B, 0xF4, 0x83, 0xDB, 0x8B, 0x1A, 0x7B, 0x99, 0x93,
+    0xE8, 0x20, 0xE9, 0x20, 0xA9, 0x20, 0x90, 0x5A, 0x6C, 0x39, 0x4B, 0x31, 0x8C, 0x5A, 0xAC, 0x39, 0x2B, 0x31, 0xCE, 0x41, 0x8C, 0x39, 0x4B, 0x31, 0xCC, 0x41, 0x8C, 0x39, 0xAC, 0x41, 0x4B, 0x39, 0xCD, 0x49, 0x0E, 0x52, 0x0F, 0x52, 0xEE, 0x51, 0x8A, 0x41, 0xEC, 0x51, 0xAE, 0x62, 0x0C, 0x5A, 0x59, 0xEE, 0xEA, 0x51, 0x0F, 0x7B, 0x8E, 0x9B, 0xAD, 0x82, 0x2F, 0xCC, 0x8E, 0xAB, 0xEC, 0x8A,
+    0xCD, 0x7A, 0x6B, 0x72, 0xCD, 0x7A, 0x91, 0x93, 0x2D, 0x5A, 0x0B, 0x52, 0x6E, 0x6A, 0x34, 0xAC, 0xF2, 0xAB, 0xD0, 0x72, 0x1D, 0xAC, 0x74, 0x8B, 0x7C, 0xD5, 0x3E, 0xA3, 0x5A, 0x8A, 0xFE, 0xD3, 0xFF, 0xFF, 0x5F, 0xD4, 0x5D, 0xAB, 0x1F, 0x8B, 0x3A, 0x83, 0x7C, 0x9B, 0x9C, 0xAD, 0x50, 0x4A, 0x15, 0x6B, 0x5E, 0x74, 0x90, 0x52, 0xBC, 0xA5, 0x17, 0x5B, 0x70, 0x3A, 0x90, 0x4A, 0x0E, 0x3A,
+    0x78, 0x84, 0xAF, 0x52, 0x4F, 0x4A, 0xEE, 0x39, 0xF4, 0x5A, 0x8F, 0x4A, 0x70, 0x42, 0xDF, 0x44, 0x7F, 0x6C, 0x51, 0x42, 0xB4, 0x73, 0xF4, 0x62, 0xB8, 0x6A, 0xBF, 0xFF, 0x7F, 0xFF, 0xBA, 0x6B, 0xE8, 0x20, 0xE9, 0x20, 0x0A, 0x29, 0xE9, 0x20, 0x4B, 0x29, 0x2A, 0x29, 0x6F, 0x5A, 0xAD, 0x39, 0x2B, 0x29, 0x10, 0x4A, 0xAE, 0x41, 0xAD, 0x41, 0xAD, 0x41, 0x6C, 0x39, 0xB5, 0x8B, 0x4B, 0x31,
+    0xAD, 0x41, 0x4C, 0x39, 0x90, 0x5A, 0xB7, 0x83, 0x8B, 0x39, 0x8B, 0x41, 0xB5, 0x8B, 0x0E, 0x83, 0x16, 0xD5, 0x8A, 0x41, 0xEB, 0x51, 0xB1, 0xA3, 0xB4, 0xBC, 0x97, 0xF5, 0xAC, 0x7A, 0xAD, 0x72, 0x4D, 0x62, 0x6F, 0x93, 0x37, 0xF6, 0x2C, 0x62, 0x91, 0x62, 0x2C, 0x5A, 0x93, 0x93, 0x91, 0x93, 0x17, 0xDE, 0x76, 0x93, 0xD1, 0x82, 0x77, 0xAC, 0xBB, 0xBC, 0x52, 0x62, 0x55, 0x62, 0x9A, 0x82,
+    0xDD, 0xA2, 0x9C, 0xAB, 0xB7, 0x83, 0x36, 0x73, 0x92, 0x5A, 0x72, 0x52, 0xFE, 0xAD, 0xF4, 0x62, 0x1A, 0x7C, 0x93, 0x4A, 0x71, 0x42, 0x2F, 0x3A, 0xB0, 0x42, 0x2E, 0x3A, 0xF3, 0x52, 0x14, 0x53, 0x6F, 0x42, 0x4E, 0x42, 0x4F, 0x4A, 0x91, 0x5A, 0x0F, 0x3A, 0x2E, 0x42, 0xF4, 0x4A, 0x5A, 0x43, 0x36, 0x5B, 0x0F, 0x4A, 0x91, 0x52, 0xF2, 0x5A, 0xB2, 0x5A, 0xB3, 0x62, 0xF4, 0x6A, 0xF1, 0x62,
+    0x87, 0x20, 0xEE, 0x41, 0xE9, 0x20, 0x2A, 0x29, 0x0A, 0x29, 0x0A, 0x31, 0xB3, 0x6A, 0x4C, 0x31, 0x2C, 0x31, 0x2B, 0x31, 0x6D, 0x39, 0x4C, 0x31, 0x8D, 0x41, 0x8D, 0x39, 0x8E, 0x41, 0xD4, 0x6A, 0x11, 0x52, 0xCD, 0x49, 0x70, 0x62, 0x3B, 0xB5, 0x58, 0x94, 0x90, 0x62, 0x6F, 0x5A, 0x6F, 0x62, 0x6D, 0x62, 0xF3, 0x9B, 0x5A, 0x8B, 0x30, 0x7B, 0x0C, 0x62, 0x16, 0xCD, 0xB5, 0xCC, 0x2D, 0x6A,
+    0xB0, 0x72, 0xEE, 0x7A, 0x54, 0xCD, 0x75, 0xAC, 0x70, 0x6A, 0x4C, 0x5A, 0x4C, 0x62, 0xB4, 0xC4, 0xD2, 0xA3, 0x77, 0xFD, 0x16, 0xF5, 0x2E, 0x6A, 0x38, 0xAC, 0x17, 0x83, 0x32, 0x62, 0x32, 0x6A, 0xF7, 0x82, 0x34, 0x83, 0xF4, 0x6A, 0x11, 0x52, 0xFC, 0xA5, 0xFF, 0xFF, 0xD9, 0x94, 0xB3, 0x5A, 0x70, 0x4A, 0x5A, 0x84, 0xFE, 0xA6, 0x8F, 0x42, 0xB0, 0x42, 0x96, 0x6B, 0x5B, 0x7C, 0x11, 0x5B,
+    0x0C, 0x3A, 0x6D, 0x4A, 0x51, 0x63, 0x96, 0x84, 0x4F, 0x42, 0x4E, 0x4A, 0xB0, 0x52, 0x13, 0x63, 0xD5, 0x7B, 0x6F, 0x4A, 0xF2, 0x62, 0x13, 0x63, 0xB1, 0x5A, 0x32, 0x6B, 0x32, 0x6B, 0x52, 0x83, 0xE8, 0x28, 0x0A, 0x29, 0x0E, 0x4A, 0x10, 0x4A, 0x0A, 0x29, 0x0A, 0x29, 0xAD, 0x41, 0x8D, 0x39, 0x2C, 0x31, 0x30, 0x4A, 0xD4, 0x6A, 0x51, 0x5A, 0xB3, 0x62, 0xAF, 0x49, 0xF0, 0x51, 0x4D, 0x31,
+    0x4E, 0x39, 0x52, 0x5A, 0x0F, 0x52, 0x8D, 0x41, 0x0F, 0x4A, 0xF6, 0x8B, 0x2D, 0x5A, 0x6E, 0x5A, 0x4D, 0x5A, 0x74, 0xA4, 0xD0, 0x72, 0x4D, 0x62, 0x4D, 0x62, 0x0F, 0x83, 0x33, 0xA4, 0xCB, 0x51, 0xAE, 0x72, 0xCD, 0x82, 0xB3, 0xC4, 0x71, 0x83, 0x6E, 0x6A, 0x2C, 0x5A, 0xCF, 0x72, 0xD6, 0xB4, 0x50, 0x8B, 0x10, 0x93, 0x16, 0xB4, 0xBE, 0xF6, 0x56, 0x83, 0x3C, 0x8B, 0x53, 0x6A, 0x51, 0x5A,
+    0xD3, 0x72, 0xD3, 0x6A, 0xF4, 0x6A, 0x9A, 0x83, 0xBD, 0xB5, 0x13, 0x6B, 0xB4, 0x62, 0x11, 0x5B, 0x78, 0x7C, 0x99, 0x7C, 0x54, 0x53, 0x8F, 0x42, 0xF1, 0x5A, 0xFA, 0x94, 0xD3, 0x6B, 0x4D, 0x42, 0xD0, 0x5A, 0xAF, 0x52, 0xCF, 0x5A, 0x6E, 0x4A, 0x6F, 0x4A, 0x6E, 0x4A, 0x53, 0x6B, 0x93, 0x73, 0x92, 0x4A, 0xD0, 0x52, 0x54, 0x6B, 0xD0, 0x5A, 0x32, 0x6B, 0xD1, 0x62, 0xF0, 0x62, 0x0F, 0x63,
+    0xAC, 0x41, 0xA8, 0x20, 0x2C, 0x31, 0xEA, 0x28, 0xCF, 0x41, 0x2B, 0x29, 0x6D, 0x39, 0x50, 0x39, 0xD0, 0x49, 0x52, 0x52, 0xB0, 0x41, 0x72, 0x5A, 0xD7, 0x51, 0x94, 0x5A, 0x73, 0x5A, 0x6E, 0x39, 0x6E, 0x39, 0xB3, 0x62, 0x11, 0x5A, 0x6C, 0x39, 0xAD, 0x41, 0x30, 0x52, 0x2F, 0x52, 0xB2, 0x6A, 0x0C, 0x4A, 0x32, 0x7B, 0xF3, 0x93, 0x6D, 0x62, 0x6F, 0x6A, 0xEB, 0x51, 0x54, 0xAC, 0x0B, 0x62,
+    0xEF, 0x7A, 0x51, 0x8B, 0xAD, 0x7A, 0x18, 0xBD, 0x2D, 0x62, 0x4C, 0x62, 0xAE, 0x72, 0x94, 0xBC, 0x71, 0x93, 0x8E, 0x72, 0xD0, 0x7A, 0x3B, 0xE6, 0xFB, 0xD5, 0x91, 0x6A, 0x52, 0x62, 0x56, 0x8B, 0x91, 0x62, 0x78, 0x83, 0xB1, 0x62, 0x2E, 0x4A, 0x16, 0x84, 0x71, 0x52, 0x6F, 0x4A, 0x93, 0x6B, 0xB8, 0x84, 0x11, 0x53, 0x31, 0x53, 0xAF, 0x4A, 0xD4, 0x73, 0x30, 0x5B, 0x6E, 0x42, 0x95, 0x63,
+    0x4D, 0x42, 0xCF, 0x52, 0xEF, 0x5A, 0xCF, 0x52, 0x8F, 0x52, 0x6E, 0x4A, 0xD0, 0x5A, 0x14, 0x84, 0xB0, 0x52, 0xD0, 0x52, 0x54, 0x6B, 0xB0, 0x52, 0x10, 0x63, 0xCF, 0x5A, 0x72, 0x6B, 0x0F, 0x63, 0x6B, 0x39, 0x0A, 0x21, 0xB8, 0x5A, 0x2C, 0x31, 0x0B, 0x29, 0x4C, 0x31, 0x8F, 0x39, 0xDA, 0x62, 0x92, 0x41, 0x4F, 0x31, 0xD1, 0x49, 0x13, 0x52, 0xD3, 0x51, 0x11, 0x39, 0x54, 0x52, 0xD1, 0x49,
+    0x6F, 0x39, 0xB0, 0x49, 0x9F, 0xA4, 0x70, 0x41, 0xAD, 0x41, 0xEE, 0x49, 0x91, 0x62, 0xB7, 0x8B, 0xED, 0x51, 0xED, 0x51, 0x75, 0xA4, 0xCB, 0x51, 0x2C, 0x62, 0xEC, 0x61, 0x18, 0xD6, 0xEA, 0x51, 0x6E, 0x6A, 0x0F, 0x83, 0xFF, 0xFF, 0x2D, 0x62, 0x50, 0x8B, 0x4D, 0x62, 0xAE, 0x7A, 0xB5, 0xCC, 0x2F, 0x83, 0x8E, 0x6A, 0xF0, 0x7A, 0x5F, 0xFF, 0x98, 0xDD, 0x91, 0x6A, 0x1B, 0x83, 0x38, 0xA4,
+    0x6F, 0x5A, 0x57, 0xAC, 0x53, 0x73, 0x97, 0x9C, 0x17, 0x73, 0x90, 0x52, 0xF1, 0x52, 0x7A, 0x95, 0x15, 0x6C, 0x76, 0x64, 0xF5, 0x5B, 0x19, 0x9D, 0xBB, 0xDE, 0x71, 0x63, 0xD0, 0x52, 0x10, 0x5B, 0xCF, 0x52, 0xFC, 0xEE, 0xCF, 0x52, 0x93, 0x6B, 0xB0, 0x52, 0xF4, 0x6A, 0xD2, 0x73, 0xD0, 0x5A, 0x33, 0x63, 0x11, 0x63, 0x72, 0x73, 0xF0, 0x62, 0x51, 0x6B, 0xEF, 0x62, 0x10, 0x63, 0x0F, 0x63,
+    0x4B, 0x31, 0xEA, 0x20, 0xAD, 0x39, 0xEB, 0x20, 0x55, 0x4A, 0x2C, 0x31, 0x4D, 0x31, 0x0D, 0x31, 0xB8, 0x7B, 0x5C, 0x73, 0xD2, 0x49, 0x13, 0x52, 0x92, 0x41, 0x5F, 0x9C, 0xFC, 0x72, 0xD9, 0x6A, 0x13, 0x52, 0xB1, 0x49, 0xDF, 0xCD, 0x9E, 0x7B, 0x6F, 0x41, 0xCF, 0x41, 0x51, 0x5A, 0x71, 0x62, 0x1A, 0x9C, 0x2D, 0x52, 0x52, 0x83, 0x0C, 0x5A, 0x52, 0x83, 0x58, 0xBC, 0x2D, 0x62, 0xD3, 0x8B,
+    0xAA, 0x51, 0x70, 0x8B, 0x16, 0xDD, 0x92, 0x8B, 0xCF, 0x72, 0x6D, 0x62, 0xEE, 0x82, 0xFF, 0xFF, 0x50, 0x8B, 0xCF, 0x72, 0xAE, 0x72, 0x10, 0x7B, 0xB8, 0xE5, 0xB1, 0x6A, 0x70, 0x62, 0x2F, 0x52, 0xB0, 0x62, 0x9F, 0xE6, 0x54, 0x7B, 0xB1, 0x5A, 0x52, 0x63, 0xD1, 0x52, 0xFF, 0xE7, 0x72, 0x53, 0xD8, 0x64, 0x7F, 0x87, 0x5F, 0xAF, 0x9A, 0x9D, 0x71, 0x5B, 0x31, 0x53, 0xB3, 0x6B, 0xF0, 0x52,
+    0x77, 0x84, 0xCF, 0x52, 0x34, 0x7C, 0xCF, 0x5A, 0xD0, 0x5A, 0xAE, 0x52, 0xAF, 0x5A, 0x11, 0x63, 0xD0, 0x5A, 0x31, 0x6B, 0x52, 0x6B, 0x31, 0x63, 0x10, 0x63, 0x10, 0x63, 0xF0, 0x5A, 0x30, 0x63, 0xEA, 0x28, 0xEB, 0x20, 0x4C, 0x31, 0x4D, 0x31, 0x0B, 0x29, 0x0B, 0x29, 0x4E, 0x39, 0x8F, 0x39, 0x74, 0x5A, 0x70, 0x39, 0x14, 0x52, 0x15, 0x52, 0xB4, 0x41, 0x16, 0x52, 0x36, 0x62, 0xB5, 0x51,
+    0x93, 0x49, 0x75, 0x62, 0xD1, 0x49, 0x12, 0x52, 0x1B, 0x8C, 0x11, 0x52, 0x0F, 0x52, 0x50, 0x5A, 0x70, 0x62, 0x98, 0xAC, 0xB1, 0x6A, 0xEC, 0x51, 0x32, 0x7B, 0xAB, 0x51, 0x8E, 0x6A, 0x2C, 0x5A, 0xEB, 0x51, 0xCF, 0x72, 0xF8, 0xED, 0xD3, 0x93, 0xF0, 0x7A, 0xAE, 0x72, 0x91, 0x9B, 0xFF, 0xFF, 0x0F, 0x8B, 0xCE, 0x72, 0xEF, 0x7A, 0x30, 0x83, 0xCF, 0x7A, 0x2E, 0x5A, 0x33, 0x7B, 0x53, 0x7B,
+    0x93, 0x83, 0x11, 0x6B, 0x53, 0x73, 0x8F, 0x52, 0x52, 0x5B, 0x3C, 0x95, 0x74, 0x53, 0x19, 0x75, 0xFF, 0x97, 0xFF, 0xFF, 0xDF, 0xCF, 0x55, 0x64, 0x55, 0x64, 0x54, 0x5C, 0x51, 0x5B, 0x0F, 0x53, 0xF5, 0x73, 0xEF, 0x52, 0x50, 0x63, 0x92, 0x6B, 0x32, 0x63, 0xAF, 0x5A, 0x31, 0x63, 0x31, 0x6B, 0x94, 0x7B, 0x11, 0x63, 0x31, 0x63, 0x52, 0x63, 0xFF, 0xFF, 0xF0, 0x5A, 0x31, 0x63, 0x51, 0x6B,
+    0xEA, 0x28, 0xEB, 0x28, 0x0B, 0x29, 0x10, 0x4A, 0x2D, 0x31, 0x4E, 0x31, 0x2D, 0x31, 0x4F, 0x39, 0x75, 0x5A, 0x96, 0x5A, 0xD3, 0x49, 0xF5, 0x51, 0x1A, 0x5A, 0xFD, 0x7A, 0x7A, 0x6A, 0x39, 0x62, 0xD6, 0x51, 0x9A, 0x83, 0xD2, 0x49, 0x94, 0x62, 0x6E, 0x39, 0x97, 0x7B, 0x51, 0x5A, 0x30, 0x52, 0xAD, 0x41, 0x4F, 0x5A, 0xB1, 0x6A, 0xAB, 0x41, 0x11, 0x7B, 0xEC, 0x51, 0x34, 0x9C, 0x0C, 0x5A,
+    0x30, 0x7B, 0x50, 0x83, 0x54, 0xB4, 0x4D, 0x62, 0xEF, 0x82, 0xCF, 0x82, 0xF2, 0xBB, 0x96, 0xE5, 0x33, 0xBC, 0xF0, 0x82, 0x30, 0x83, 0x1C, 0xFF, 0xF0, 0x7A, 0x8F, 0x5A, 0xAF, 0x62, 0x8F, 0x62, 0xD5, 0x6B, 0x33, 0x6B, 0xFB, 0xA5, 0xAF, 0x52, 0x3B, 0xAD, 0x32, 0x53, 0x11, 0x4B, 0x36, 0x64, 0x9F, 0x9F, 0xFF, 0xBF, 0x5A, 0x6D, 0xF3, 0x63, 0xF7, 0x74, 0xF3, 0x63, 0xF3, 0x6B, 0x50, 0x63,
+    0xCD, 0x52, 0x34, 0x84, 0x0F, 0x5B, 0x50, 0x63, 0x10, 0x63, 0x13, 0x84, 0xAE, 0x5A, 0xEF, 0x62, 0xCF, 0x5A, 0x31, 0x63, 0xD4, 0x7B, 0xB3, 0x73, 0x31, 0x6B, 0x10, 0x63, 0x71, 0x6B, 0x50, 0x63, 0x0A, 0x29, 0x8D, 0x39, 0xEB, 0x28, 0x52, 0x52, 0x0C, 0x29, 0x0D, 0x29, 0xF2, 0x49, 0x4F, 0x39, 0xBB, 0x83, 0x93, 0x39, 0x78, 0x62, 0x58, 0x62, 0x3A, 0x72, 0x1F, 0xAB, 0x1F, 0xAB, 0x5E, 0x7A,
+    0x38, 0x62, 0x5A, 0x83, 0x97, 0x62, 0x95, 0x62, 0x8F, 0x41, 0xAE, 0x41, 0x72, 0x5A, 0x93, 0x62, 0xCD, 0x41, 0x4E, 0x5A, 0xB0, 0x62, 0xEC, 0x49, 0x2D, 0x5A, 0x2D, 0x62, 0x52, 0x7B, 0x30, 0x83, 0xAE, 0x6A, 0x10, 0x83, 0x50, 0x8B, 0x17, 0xC5, 0x71, 0x93, 0x0F, 0x93, 0xDF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFE, 0xD4, 0xAB, 0x54, 0xB4, 0xBC, 0xF6, 0x13, 0x9C, 0x94, 0x83, 0x31, 0x7B, 0x76, 0x9C,
+    0xF2, 0x8B, 0x11, 0x63, 0x93, 0x7B, 0xFD, 0xC5, 0xB3, 0x63, 0xD0, 0x52, 0x93, 0x63, 0x3B, 0x9D, 0xB7, 0x6C, 0x7E, 0x9E, 0x76, 0x6C, 0x5A, 0x9D, 0xD2, 0x6B, 0x71, 0x6B, 0x70, 0x63, 0x96, 0x8C, 0x8C, 0x4A, 0xEE, 0x5A, 0x0E, 0x63, 0x55, 0x8C, 0x71, 0x73, 0x0E, 0x5B, 0x30, 0x63, 0x10, 0x63, 0x51, 0x6B, 0x31, 0x63, 0xF0, 0x5A, 0x10, 0x63, 0x31, 0x6B, 0x30, 0x6B, 0x30, 0x6B, 0x30, 0x6B,
+    0xEA, 0x28, 0x6F, 0x31, 0xDA, 0x5A, 0xCF, 0x41, 0x2C, 0x31, 0x6E, 0x39, 0x8F, 0x39, 0x9F, 0xA4, 0x3E, 0x73, 0xDA, 0x49, 0xD5, 0x51, 0x3A, 0x62, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBA, 0xFF, 0x82, 0x7D, 0x72, 0x7F, 0xCD, 0x16, 0x5A, 0x94, 0x5A, 0xAF, 0x41, 0x75, 0x52, 0x5F, 0x9C, 0xB2, 0x62, 0xED, 0x51, 0x6F, 0x72, 0x8B, 0x41, 0x53, 0x83, 0x3C, 0xFE, 0x11, 0x7B, 0xB6, 0x9C,
+    0x6D, 0x62, 0x0E, 0x73, 0xB9, 0xF5, 0xF2, 0x9B, 0x50, 0x93, 0x51, 0x9B, 0x3D, 0xFF, 0xFF, 0xFF, 0xB9, 0xED, 0x31, 0x8B, 0x90, 0x93, 0x36, 0xBD, 0x18, 0xCD, 0x6D, 0x62, 0xF5, 0x9B, 0x4D, 0x5A, 0xEF, 0x6A, 0xD9, 0xDD, 0xB3, 0x83, 0x71, 0x7B, 0x71, 0x7B, 0xAF, 0x52, 0x56, 0x94, 0xBD, 0xD6, 0x76, 0x7C, 0x55, 0x74, 0x10, 0x4B, 0xB2, 0x6B, 0xBA, 0xD6, 0x6E, 0x73, 0x70, 0x6B, 0x4F, 0x63,
+    0xD2, 0xA4, 0xFC, 0xFF, 0xAF, 0x7B, 0x4F, 0x6B, 0x4F, 0x63, 0xD1, 0x7B, 0xD8, 0xDE, 0x9D, 0xFF, 0x30, 0x6B, 0x52, 0x6B, 0x50, 0x6B, 0x15, 0xA5, 0x56, 0xAD, 0x71, 0x73, 0x50, 0x6B, 0x71, 0x73, 0x0A, 0x29, 0x1F, 0x84, 0x0A, 0x29, 0x2C, 0x31, 0xF1, 0x41, 0xF0, 0x49, 0x35, 0x4A, 0x6F, 0x39, 0x54, 0x52, 0xFC, 0xBD, 0x38, 0x5A, 0xBC, 0x72, 0x5F, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+    0x5E, 0x72, 0xDF, 0xFF, 0x39, 0x5A, 0x1F, 0x84, 0x59, 0x7B, 0x6F, 0x41, 0xCF, 0x49, 0x33, 0x73, 0x9B, 0xA4, 0xF3, 0x6A, 0xCD, 0x49, 0x8C, 0x41, 0x90, 0x62, 0x36, 0x9C, 0x57, 0x9C, 0x8E, 0x62, 0xD2, 0x83, 0x70, 0x83, 0xF6, 0xD4, 0x71, 0x83, 0xD2, 0x9B, 0xEF, 0x92, 0xB3, 0xD4, 0x96, 0xDC, 0x74, 0xCC, 0x0F, 0x83, 0x70, 0x93, 0x2F, 0x83, 0xF7, 0xCC, 0xAE, 0x6A, 0xF4, 0x8B, 0x4D, 0x5A,
+    0x50, 0x83, 0x7F, 0xDE, 0x0F, 0x63, 0xCF, 0x5A, 0xCE, 0x5A, 0xFD, 0xBD, 0x7F, 0xDF, 0x30, 0x5B, 0x37, 0x84, 0xB2, 0x6B, 0x7F, 0xBF, 0xFF, 0xFF, 0x57, 0xAD, 0x31, 0x84, 0x4F, 0x6B, 0xBC, 0xD6, 0x31, 0x8C, 0x8F, 0x73, 0xAF, 0x7B, 0xB9, 0xB5, 0x70, 0x73, 0x0E, 0x63, 0x50, 0x6B, 0x71, 0x73, 0xF7, 0xAC, 0x91, 0x73, 0x0F, 0x6B, 0x71, 0x73, 0x50, 0x6B, 0x71, 0x73, 0xF3, 0x83, 0x91, 0x73,
+    0x0A, 0x29, 0x5F, 0xBE, 0x2C, 0x29, 0x59, 0x4A, 0x2D, 0x31, 0x15, 0x6B, 0xB4, 0x62, 0x50, 0x31, 0x3A, 0x5B, 0xFC, 0x6A, 0xD5, 0x49, 0x7A, 0x6A, 0x7F, 0xE6, 0xBF, 0xFE, 0x1E, 0xDC, 0xDF, 0xA2, 0x5C, 0x62, 0xDE, 0x93, 0xD6, 0x51, 0x17, 0x52, 0xD3, 0x49, 0xDA, 0x83, 0x11, 0x52, 0x9A, 0x6A, 0xAE, 0x41, 0x18, 0x9C, 0x72, 0x62, 0xAC, 0x41, 0xF2, 0x72, 0x90, 0x6A, 0x1E, 0xAD, 0x71, 0x8B,
+    0x6D, 0x62, 0x2F, 0x8B, 0xFB, 0xFE, 0xB2, 0x93, 0x5A, 0xE6, 0x0F, 0x93, 0xB6, 0xF5, 0x5B, 0xFE, 0x92, 0xE4, 0xEE, 0x8A, 0x11, 0xA4, 0xDF, 0xFF, 0x50, 0x8B, 0x52, 0x83, 0x8E, 0x62, 0xAD, 0x62, 0x93, 0x8B, 0x91, 0x7B, 0xCF, 0x62, 0xD2, 0x7B, 0xDC, 0xBD, 0x75, 0x8C, 0xD2, 0x7B, 0x0F, 0x5B, 0x50, 0x6B, 0x3D, 0xAE, 0xD3, 0x7B, 0xB0, 0x73, 0x18, 0xB6, 0x36, 0xA5, 0x31, 0x8C, 0x92, 0x94,
+    0x8E, 0x7B, 0x10, 0x84, 0x37, 0xAD, 0xAF, 0x7B, 0xB0, 0x73, 0x4F, 0x6B, 0xD7, 0xA4, 0x0E, 0x63, 0x91, 0x73, 0x71, 0x73, 0x0E, 0x63, 0x91, 0x73, 0xF3, 0x83, 0x71, 0x73, 0x71, 0x73, 0x91, 0x73, 0x0A, 0x29, 0xF2, 0x41, 0x2C, 0x29, 0x2F, 0x31, 0xEB, 0x20, 0xBF, 0xC5, 0xD1, 0x41, 0x4E, 0x39, 0xB3, 0x41, 0x19, 0x7B, 0xB8, 0x5A, 0xD5, 0x51, 0xFE, 0x9B, 0x5E, 0x93, 0x3E, 0x83, 0x5A, 0x6A,
+    0x38, 0x62, 0xF5, 0x59, 0x15, 0x52, 0x93, 0x39, 0xD7, 0x6A, 0xF1, 0x49, 0x13, 0x4A, 0x56, 0x7B, 0xCE, 0x49, 0xF1, 0xBB, 0x50, 0x41, 0xD0, 0x6A, 0xBF, 0xFF, 0x72, 0x8B, 0xD0, 0x9A, 0x1B, 0xD6, 0x34, 0x8C, 0xBE, 0xFF, 0xB3, 0xCC, 0x5A, 0xDE, 0x4F, 0x8B, 0x0E, 0x9B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x8A, 0xDB, 0xFF, 0xBF, 0xFF, 0x2F, 0x8B, 0x1C, 0xFF, 0xEE, 0x72, 0x9B, 0xDE,
+    0x56, 0xF6, 0x4B, 0x62, 0xEF, 0x72, 0x79, 0xBD, 0xCE, 0x62, 0x4F, 0x7B, 0x53, 0x94, 0xFA, 0xC5, 0x12, 0x84, 0x0F, 0x63, 0xAC, 0x5A, 0xD6, 0xA4, 0x71, 0x94, 0x71, 0x94, 0x0F, 0x84, 0x97, 0xC5, 0x16, 0xD6, 0xB1, 0x9C, 0x71, 0x9C, 0x57, 0xB5, 0x31, 0x94, 0x90, 0x7B, 0x6F, 0x73, 0x6F, 0x73, 0x13, 0x8C, 0x91, 0x7B, 0x50, 0x6B, 0xD2, 0x83, 0x91, 0x7B, 0x91, 0x7B, 0x70, 0x73, 0x91, 0x7B,
+    0xE9, 0x20, 0x0B, 0x39, 0x0A, 0x29, 0x2C, 0x31, 0xF3, 0x62, 0xBB, 0x83, 0xB1, 0x41, 0xEC, 0x28, 0x90, 0x41, 0x1F, 0xFF, 0xD2, 0x49, 0xB2, 0x49, 0xF4, 0x61, 0x16, 0xB4, 0xD5, 0x59, 0x95, 0x49, 0x15, 0x4A, 0x55, 0x5A, 0xB0, 0x49, 0xB4, 0x6A, 0xDF, 0xFE, 0xEF, 0x41, 0x10, 0x4A, 0x14, 0x7B, 0xD4, 0x62, 0xAD, 0x49, 0x8D, 0x41, 0xAC, 0x49, 0xF2, 0x7A, 0x6E, 0x62, 0xF0, 0x72, 0xD7, 0xBC,
+    0xF2, 0xAC, 0x31, 0x72, 0x4E, 0x8B, 0x38, 0xBD, 0xEE, 0x82, 0x0E, 0x93, 0x57, 0xFE, 0x1A, 0xFE, 0x52, 0xDC, 0x0E, 0x8B, 0xF0, 0xAB, 0x30, 0x83, 0x0E, 0x83, 0x5F, 0xFF, 0x76, 0xAC, 0xF3, 0x93, 0x79, 0x9C, 0x0F, 0x73, 0xB9, 0xAC, 0x52, 0x9C, 0x39, 0xD6, 0x4D, 0x52, 0xFA, 0xB4, 0xF2, 0x83, 0xB1, 0x7B, 0x2F, 0x6B, 0x4E, 0x73, 0x92, 0x9C, 0x30, 0x9C, 0xD3, 0xA4, 0xB1, 0xB4, 0x33, 0xE6,
+    0x56, 0xFF, 0x98, 0xEE, 0x32, 0xB5, 0x0E, 0x84, 0x51, 0x94, 0xD0, 0x7B, 0x8F, 0x73, 0x4F, 0x73, 0x16, 0xAD, 0x13, 0x84, 0xB0, 0x7B, 0xD2, 0x7B, 0xB2, 0x7B, 0x91, 0x7B, 0x90, 0x7B, 0xB1, 0x83, 0x0A, 0x29, 0xC9, 0x28, 0xB7, 0x52, 0xEA, 0x28, 0xFE, 0xAC, 0x72, 0x83, 0x0D, 0x31, 0xDF, 0x83, 0x92, 0x39, 0xF5, 0x72, 0x6F, 0x39, 0x71, 0x41, 0x36, 0x5A, 0x1F, 0xC6, 0xB3, 0x49, 0x92, 0x41,
+    0xB1, 0x41, 0xB1, 0x49, 0xDE, 0x8B, 0x94, 0x62, 0xF3, 0x72, 0x8E, 0x41, 0x31, 0x52, 0x93, 0x62, 0x2E, 0x4A, 0xCE, 0x49, 0x8C, 0x41, 0x6B, 0x39, 0x2F, 0x62, 0x76, 0xAC, 0x10, 0x73, 0xF0, 0x72, 0x95, 0xAC, 0xF0, 0x82, 0xDF, 0xFF, 0x13, 0x9C, 0xAD, 0x7A, 0xAC, 0x7A, 0xF0, 0xB3, 0x3A, 0xE6, 0x58, 0xC4, 0xCD, 0x72, 0xF4, 0xA3, 0x30, 0x7B, 0xD9, 0xDD, 0x93, 0x8B, 0x6D, 0x62, 0xB0, 0x6A,
+    0x50, 0x83, 0xF7, 0xC4, 0x6D, 0x5A, 0x17, 0x94, 0xF4, 0x8B, 0x6D, 0x5A, 0x58, 0xB5, 0x1B, 0xCE, 0x78, 0xBD, 0x0E, 0x6B, 0xF1, 0x8B, 0x52, 0x94, 0xFF, 0xFF, 0x31, 0xBD, 0xD9, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0xCD, 0x91, 0x9C, 0xD2, 0xA4, 0x50, 0x94, 0xFE, 0xFF, 0xFC, 0xFF, 0x70, 0x73, 0xD2, 0x7B, 0xB0, 0x83, 0xD8, 0xBD, 0xF9, 0xC5, 0x92, 0x7B, 0x91, 0x7B, 0x70, 0x7B,
+    0xEA, 0x20, 0xF1, 0x41, 0xEA, 0x28, 0xEB, 0x28, 0x53, 0x4A, 0x4D, 0x31, 0x74, 0x52, 0x72, 0x5A, 0x2D, 0x31, 0x14, 0x52, 0x2F, 0x31, 0x3A, 0x73, 0x35, 0x52, 0xB2, 0x49, 0x3F, 0x94, 0xFF, 0x93, 0xB8, 0x62, 0xB0, 0x41, 0x11, 0x4A, 0x53, 0x52, 0x3C, 0x8C, 0xAF, 0x41, 0xCE, 0x41, 0x51, 0x5A, 0x1E, 0xB5, 0x99, 0xA4, 0xAD, 0x49, 0x0D, 0x4A, 0x70, 0x5A, 0x59, 0xB4, 0xBC, 0xE5, 0x8E, 0x62,
+    0x19, 0xBD, 0x6E, 0x6A, 0xB6, 0xC4, 0x6E, 0x6A, 0x0C, 0x62, 0x6C, 0x6A, 0x31, 0xB4, 0x35, 0xBC, 0xEF, 0x82, 0xAD, 0x6A, 0xEE, 0x7A, 0x2F, 0x8B, 0x58, 0xD5, 0x2F, 0x7B, 0xAE, 0x62, 0x71, 0x7B, 0xB6, 0xAC, 0x5F, 0xFF, 0x30, 0x73, 0x92, 0x7B, 0x71, 0x7B, 0xBB, 0xC5, 0x5A, 0xCE, 0x2F, 0x73, 0x8F, 0x83, 0x91, 0x83, 0x7B, 0xD6, 0x72, 0x9C, 0xD2, 0xB4, 0x9D, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFB, 0xFF, 0xF4, 0xE5, 0x5A, 0xD6, 0xF3, 0xAC, 0xB0, 0x83, 0xB0, 0x8B, 0x74, 0x94, 0xB6, 0xAC, 0x9A, 0xC5, 0x51, 0x7B, 0xD2, 0x83, 0xB2, 0x83, 0xF4, 0x8B, 0xF3, 0x8B, 0x33, 0x8C, 0x2A, 0x29, 0xE9, 0x20, 0x0A, 0x29, 0x0A, 0x21, 0x2B, 0x29, 0x11, 0x4A, 0x10, 0x4A, 0x6D, 0x39, 0x2C, 0x29, 0xB0, 0x39, 0xB0, 0x41, 0xF1, 0x49, 0x74, 0x5A, 0xB6, 0x62, 0x95, 0x5A, 0x91, 0x39,
+    0x70, 0x39, 0x90, 0x39, 0xDF, 0x94, 0x98, 0x7B, 0xAF, 0x41, 0x52, 0x4A, 0xFA, 0x7B, 0xB3, 0x6A, 0x8D, 0x41, 0x33, 0x73, 0x9A, 0x94, 0x53, 0x73, 0xCC, 0x49, 0x16, 0x94, 0x8F, 0x62, 0x31, 0x7B, 0x10, 0x73, 0x30, 0x7B, 0x4D, 0x62, 0x37, 0xBD, 0xAF, 0x72, 0xCE, 0x7A, 0x30, 0x8B, 0x76, 0xD5, 0x90, 0x9B, 0x8D, 0x62, 0x50, 0x8B, 0x1C, 0xFF, 0xB6, 0xCD, 0x94, 0xA4, 0x10, 0x7B, 0x97, 0xAC,
+    0xFD, 0xFF, 0x2C, 0x52, 0x2E, 0x73, 0xD4, 0x93, 0xAD, 0x6A, 0x6D, 0x5A, 0xFD, 0xFF, 0x9B, 0xCD, 0x38, 0xBD, 0x0E, 0x73, 0x36, 0xB5, 0x75, 0xAC, 0xB8, 0xD5, 0x13, 0xD6, 0x35, 0xDE, 0xFD, 0xFF, 0xFE, 0xFF, 0xD6, 0xF6, 0xF1, 0xB4, 0xD8, 0xD5, 0xD2, 0xAC, 0x90, 0x83, 0xF2, 0x8B, 0x30, 0x7B, 0xF5, 0xB4, 0x33, 0x8C, 0xB1, 0x83, 0x13, 0x94, 0x14, 0x94, 0xD3, 0x8B, 0x34, 0x94, 0xB3, 0x83,
+    0x09, 0x29, 0x09, 0x21, 0x4B, 0x31, 0x0A, 0x21, 0x2B, 0x29, 0x2B, 0x29, 0x2C, 0x31, 0x6D, 0x39, 0x2C, 0x31, 0xF0, 0x49, 0xF1, 0x41, 0xD1, 0x41, 0xCF, 0x41, 0x74, 0x52, 0xB6, 0x5A, 0xB0, 0x39, 0x4E, 0x31, 0xB7, 0x52, 0x37, 0x6B, 0x6E, 0x31, 0x11, 0x4A, 0x15, 0x3A, 0x10, 0x4A, 0xCE, 0x41, 0x50, 0x4A, 0x50, 0x52, 0x0D, 0x4A, 0x8B, 0x41, 0x73, 0x6B, 0x71, 0x73, 0x4E, 0x5A, 0xAC, 0x41,
+    0xD5, 0x83, 0x36, 0xBD, 0x50, 0x7B, 0xF3, 0x83, 0x6D, 0x62, 0x2C, 0x5A, 0x2F, 0x83, 0xF4, 0x93, 0x0E, 0x7B, 0x6C, 0x62, 0x74, 0xA4, 0xAE, 0x72, 0xD2, 0x9B, 0xFF, 0xFF, 0xFD, 0xE5, 0xD1, 0x93, 0x32, 0x9C, 0x7F, 0xE6, 0x33, 0x83, 0x53, 0x9C, 0x31, 0x7B, 0xD9, 0xA3, 0x95, 0xA4, 0x8E, 0x62, 0x37, 0xA4, 0x15, 0xA4, 0xD1, 0x93, 0x32, 0x94, 0x93, 0xA4, 0xD2, 0xB4, 0x94, 0xCD, 0x95, 0xCD,
+    0x98, 0xE6, 0x30, 0x9C, 0x14, 0xBD, 0xCF, 0x8B, 0xF4, 0xB4, 0x91, 0x83, 0x91, 0x83, 0x92, 0x83, 0x0F, 0x73, 0xB2, 0x83, 0xD2, 0x8B, 0xB3, 0x83, 0xD3, 0x83, 0x93, 0x83, 0xF4, 0x8B, 0xBB, 0xB4, 0xE8, 0x20, 0x29, 0x29, 0xE9, 0x20, 0xE8, 0x20, 0xC8, 0x20, 0xEA, 0x20, 0x0A, 0x29, 0x09, 0x21, 0xEA, 0x20, 0xB1, 0x62, 0xEB, 0x20, 0x30, 0x4A, 0x2D, 0x29, 0xB2, 0x5A, 0x11, 0x4A, 0xD0, 0x41,
+    0x71, 0x31, 0x35, 0x52, 0x7A, 0xBD, 0x8E, 0x39, 0xCF, 0x39, 0x71, 0x52, 0xCE, 0x39, 0xCF, 0x41, 0xF2, 0x62, 0xF2, 0x62, 0xDE, 0xD6, 0xCD, 0x41, 0x8C, 0x39, 0x12, 0x6B, 0xED, 0x49, 0xCC, 0x41, 0xCF, 0x5A, 0x30, 0x73, 0x53, 0x94, 0xCE, 0x6A, 0xCD, 0x6A, 0x93, 0xCC, 0x50, 0x83, 0xCF, 0x6A, 0xEE, 0x72, 0x8D, 0x62, 0x0F, 0x7B, 0x0F, 0x73, 0xD2, 0x93, 0xFA, 0xE5, 0x75, 0xA4, 0x71, 0x83,
+    0x71, 0x7B, 0x2C, 0x52, 0x8F, 0x62, 0x35, 0x9C, 0x51, 0x83, 0x31, 0x73, 0x92, 0x83, 0xAD, 0x62, 0x91, 0x83, 0xEE, 0x6A, 0xF1, 0x8B, 0xD0, 0x8B, 0x31, 0x9C, 0x51, 0x9C, 0x13, 0xBD, 0xEF, 0x93, 0x74, 0xC5, 0xD0, 0x8B, 0x31, 0x94, 0xB0, 0x83, 0xB1, 0x83, 0x50, 0x73, 0x50, 0x7B, 0x30, 0x73, 0x50, 0x7B, 0x91, 0x83, 0xD2, 0x8B, 0x93, 0x83, 0xB3, 0x83, 0x93, 0x83, 0xD4, 0x83, 0x94, 0x83,
+    0xC8, 0x18, 0xE8, 0x20, 0x0A, 0x21, 0x09, 0x29, 0x6B, 0x31, 0x09, 0x21, 0x0A, 0x29, 0x4B, 0x31, 0x0B, 0x29, 0xAE, 0x39, 0x0B, 0x29, 0x92, 0x5A, 0x4D, 0x31, 0x51, 0x4A, 0x14, 0x63, 0x6D, 0x31, 0x4D, 0x31, 0xF0, 0x41, 0x72, 0x52, 0xCF, 0x39, 0xD0, 0x39, 0x52, 0x42, 0xCF, 0x39, 0xCF, 0x41, 0x8F, 0x5A, 0xD1, 0x62, 0x33, 0x73, 0x6C, 0x31, 0x6B, 0x39, 0xF1, 0x6A, 0xAB, 0x41, 0x92, 0x83,
+    0xAB, 0x41, 0x6E, 0x62, 0x72, 0x7B, 0x2C, 0x52, 0x2C, 0x52, 0xEB, 0x49, 0xAD, 0x62, 0xCF, 0x6A, 0xAD, 0x62, 0x6C, 0x5A, 0xAE, 0x6A, 0x0F, 0x6B, 0x50, 0x83, 0x71, 0x83, 0xEF, 0x72, 0x10, 0x73, 0xCF, 0x6A, 0x4D, 0x52, 0x4E, 0x5A, 0xB4, 0x8B, 0xD0, 0x72, 0xF0, 0x72, 0x10, 0x73, 0x4C, 0x5A, 0xCE, 0x6A, 0xCE, 0x6A, 0x0F, 0x73, 0x90, 0x8B, 0x31, 0x9C, 0x31, 0xA4, 0x72, 0xAC, 0x6E, 0x83,
+    0xD0, 0x8B, 0xFF, 0xFF, 0xB0, 0x83, 0x11, 0x94, 0x2F, 0x73, 0x78, 0xB5, 0xF1, 0x8B, 0x30, 0x7B, 0x71, 0x83, 0xB2, 0x83, 0x91, 0x83, 0x34, 0x9C, 0xD4, 0x8B, 0x93, 0x83, 0x73, 0x7B, 0x74, 0x7B, 0x2B, 0x29, 0xEF, 0x41, 0x15, 0x63, 0xAF, 0x39, 0x51, 0x52, 0xCF, 0x41, 0x10, 0x4A, 0x4C, 0x31, 0x16, 0x63, 0x93, 0x5A, 0x4D, 0x31, 0xB5, 0x5A, 0x37, 0x6B, 0x19, 0x63, 0x37, 0x6B, 0xB9, 0x6B,
+    0x99, 0x7B, 0x76, 0x73, 0xD0, 0x39, 0xD8, 0x7B, 0xFF, 0x74, 0x9F, 0x67, 0x3D, 0x6C, 0x98, 0x73, 0x79, 0xE5, 0x99, 0xC4, 0xDE, 0xCD, 0x38, 0x8C, 0x8B, 0x39, 0x5F, 0xDE, 0xBF, 0xF7, 0xB5, 0x7B, 0x0D, 0x4A, 0x4D, 0x5A, 0xBD, 0xE6, 0xFF, 0xFF, 0x4D, 0x5A, 0x10, 0x73, 0xF3, 0x93, 0x35, 0xA4, 0xB2, 0x83, 0x8D, 0x5A, 0xAE, 0x6A, 0x7A, 0xCD, 0x39, 0xCD, 0xD3, 0x93, 0xAE, 0x6A, 0xF5, 0x9B,
+    0x16, 0x9C, 0x77, 0xA4, 0x51, 0x83, 0x34, 0x8B, 0xBF, 0xF4, 0x3C, 0xCD, 0xD1, 0x7A, 0x54, 0x83, 0x39, 0xC5, 0xBA, 0xBC, 0xDA, 0xD5, 0x10, 0x8B, 0xD5, 0xB3, 0xFF, 0xFF, 0xBF, 0xFE, 0x7F, 0xFF, 0x97, 0xAC, 0x53, 0x83, 0xFB, 0xBC, 0x95, 0xAC, 0x36, 0xA4, 0xD3, 0x93, 0x59, 0xAC, 0x52, 0x8B, 0xB8, 0xC4, 0xDF, 0xFF, 0x76, 0xBC, 0x78, 0xBC, 0xB9, 0xA3, 0x37, 0xA4, 0xD6, 0x93, 0x9F, 0xF6,
+    0xEE, 0x31, 0x12, 0x63, 0x2A, 0x29, 0x2B, 0x29, 0xAE, 0x39, 0xC9, 0x18, 0x0A, 0x29, 0xD3, 0x5A, 0x2B, 0x31, 0x0B, 0x29, 0xF4, 0x62, 0x8F, 0x39, 0x2D, 0x31, 0xF9, 0x6B, 0xF7, 0x52, 0xD1, 0x39, 0x2D, 0x31, 0x51, 0x52, 0x12, 0x42, 0xF7, 0x52, 0x9D, 0x53, 0xBF, 0x26, 0xBF, 0x6D, 0xB4, 0x62, 0x76, 0xD4, 0x9E, 0xD5, 0x71, 0x5A, 0xB2, 0x5A, 0xAD, 0x41, 0x91, 0x52, 0x53, 0x73, 0x4E, 0x39,
+    0xAE, 0x41, 0xD7, 0x93, 0x9F, 0xC5, 0x11, 0x63, 0x5E, 0xC5, 0xEC, 0x49, 0x54, 0x83, 0xF2, 0x6A, 0x50, 0x5A, 0x0C, 0x52, 0x2E, 0x5A, 0xCC, 0x49, 0x0D, 0x52, 0xF3, 0x7A, 0x6F, 0x62, 0x12, 0x73, 0x12, 0x7B, 0xCE, 0x49, 0x92, 0x72, 0x5C, 0xBB, 0x9D, 0xEE, 0x74, 0x7A, 0xD1, 0x72, 0x2F, 0x62, 0x8F, 0x6A, 0xEF, 0x7A, 0x32, 0x83, 0x52, 0x93, 0x73, 0x9B, 0x18, 0xFD, 0x96, 0xD4, 0x14, 0xA4,
+    0xAE, 0x72, 0xAF, 0x6A, 0xF0, 0x7A, 0x31, 0x7B, 0xD0, 0x72, 0xF0, 0x72, 0x52, 0x83, 0x12, 0x7B, 0x73, 0x8B, 0xB5, 0xAB, 0x53, 0x8B, 0x54, 0x83, 0x77, 0x93, 0x55, 0x8B, 0x34, 0x7B, 0x35, 0x83, 0x29, 0x21, 0xCC, 0x41, 0x4B, 0x31, 0x09, 0x29, 0x0A, 0x29, 0xC8, 0x20, 0xE9, 0x20, 0xAD, 0x39, 0xEA, 0x20, 0xEA, 0x20, 0xEE, 0x41, 0x0B, 0x29, 0x0B, 0x29, 0x31, 0x4A, 0x8E, 0x31, 0x72, 0x52,
+    0x0B, 0x21, 0x10, 0x4A, 0xAE, 0x31, 0x73, 0x52, 0xB5, 0x52, 0xF1, 0x31, 0x37, 0x53, 0x51, 0x52, 0x51, 0x5A, 0x71, 0x5A, 0x50, 0x52, 0x2F, 0x4A, 0x8C, 0x39, 0xEE, 0x41, 0xB1, 0x5A, 0x30, 0x42, 0x8C, 0x39, 0xED, 0x49, 0xF3, 0x62, 0x91, 0x5A, 0xD3, 0x62, 0xED, 0x49, 0xB0, 0x62, 0x90, 0x5A, 0x2E, 0x52, 0x4D, 0x5A, 0x6E, 0x5A, 0xEC, 0x49, 0x0D, 0x52, 0xAF, 0x62, 0x0D, 0x52, 0xAF, 0x62,
+    0x16, 0xB4, 0xB0, 0x6A, 0x0D, 0x5A, 0x92, 0x72, 0x71, 0x72, 0x50, 0x62, 0x2E, 0x62, 0x4E, 0x62, 0x6E, 0x6A, 0x8E, 0x6A, 0x71, 0x8B, 0xCF, 0x7A, 0xCF, 0x7A, 0x31, 0x8B, 0x72, 0x93, 0x11, 0x83, 0x8F, 0x6A, 0xD0, 0x72, 0xAF, 0x72, 0x11, 0x7B, 0xF1, 0x72, 0xF1, 0x72, 0x11, 0x73, 0xF1, 0x72, 0x53, 0x83, 0x12, 0x7B, 0x33, 0x83, 0x54, 0x83, 0x54, 0x83, 0x34, 0x83, 0x55, 0x83, 0x55, 0x83,
+    0xC8, 0x18, 0x09, 0x29, 0xC8, 0x20, 0x09, 0x29, 0xE9, 0x20, 0xE9, 0x20, 0x4B, 0x31, 0x0A, 0x29, 0xEA, 0x20, 0xEA, 0x20, 0x8D, 0x39, 0xEB, 0x20, 0x0B, 0x29, 0x6D, 0x31, 0x4D, 0x29, 0x92, 0x5A, 0x8D, 0x39, 0x10, 0x42, 0xCF, 0x39, 0xAF, 0x31, 0x52, 0x4A, 0x31, 0x42, 0x10, 0x42, 0xAE, 0x39, 0x10, 0x4A, 0x31, 0x4A, 0x0F, 0x42, 0x50, 0x52, 0x8C, 0x39, 0xCD, 0x41, 0x0F, 0x4A, 0xAC, 0x41,
+    0x4C, 0x31, 0x0E, 0x4A, 0x55, 0x6B, 0x10, 0x4A, 0xD8, 0x7B, 0x0E, 0x4A, 0xD2, 0x6A, 0xB2, 0x5A, 0x92, 0x62, 0x4D, 0x52, 0x4E, 0x5A, 0x8B, 0x41, 0x2D, 0x52, 0x4E, 0x5A, 0x4D, 0x5A, 0xD0, 0x6A, 0x6E, 0x5A, 0x4E, 0x5A, 0xED, 0x51, 0x2F, 0x62, 0x4F, 0x62, 0x70, 0x6A, 0x6F, 0x62, 0x6E, 0x62, 0x6E, 0x6A, 0xAE, 0x72, 0x92, 0xA3, 0xAF, 0x7A, 0x0D, 0x5A, 0xF0, 0x7A, 0x32, 0x83, 0xB0, 0x72,
+    0x8F, 0x6A, 0xD1, 0x72, 0xB0, 0x6A, 0xD1, 0x72, 0x12, 0x7B, 0x12, 0x7B, 0xF1, 0x72, 0xD1, 0x72, 0x12, 0x7B, 0xF2, 0x72, 0x33, 0x83, 0x33, 0x7B, 0x55, 0x83, 0x34, 0x83, 0x55, 0x83, 0x15, 0x7B, 0x09, 0x21, 0xC9, 0x20, 0x0B, 0x21, 0xE9, 0x20, 0x2A, 0x29, 0x2B, 0x31, 0x70, 0x52, 0xCF, 0x41, 0xEF, 0x41, 0x8D, 0x39, 0xCF, 0x41, 0xF6, 0x62, 0x37, 0x6B, 0x12, 0x3A, 0xFA, 0x6B, 0x9A, 0x5B,
+    0xBC, 0x6C, 0x93, 0x4A, 0xDF, 0x75, 0x9D, 0xB6, 0x73, 0x3A, 0x9F, 0x64, 0x9A, 0x5C, 0xBF, 0xEE, 0x36, 0x6B, 0x72, 0x5A, 0xD6, 0x7B, 0xDA, 0x94, 0xF8, 0x8C, 0xF2, 0x62, 0x7F, 0xD6, 0xBF, 0xA5, 0x5A, 0x9E, 0x0E, 0x4A, 0xBA, 0x84, 0xFF, 0xFF, 0x3E, 0xC6, 0xCD, 0x39, 0x38, 0x8C, 0xBC, 0x9C, 0x9D, 0x9C, 0xCE, 0x62, 0x72, 0x7B, 0xBC, 0xD5, 0x12, 0x7B, 0x32, 0x83, 0xF3, 0x7A, 0x54, 0x83,
+    0xD0, 0x7A, 0x14, 0x83, 0x18, 0xA4, 0xB7, 0x9B, 0x3E, 0xEE, 0x1F, 0xEE, 0xB8, 0xAB, 0x38, 0xB4, 0x1D, 0xD5, 0x11, 0x9B, 0x1D, 0xFE, 0x3B, 0xDD, 0x7E, 0xE5, 0xBF, 0xFF, 0x78, 0xC4, 0x5C, 0xD5, 0xDF, 0xFF, 0xF8, 0xAB, 0x77, 0x9B, 0x36, 0x9B, 0x7E, 0xE5, 0x34, 0x8B, 0x77, 0x93, 0x13, 0x7B, 0x33, 0x83, 0xF9, 0xCC, 0xB6, 0x93, 0x5A, 0xAC, 0xF4, 0x82, 0xF9, 0xA3, 0x77, 0x8B, 0x37, 0x8B,
+    0xF0, 0x51, 0xE8, 0x20, 0xB2, 0x52, 0xB2, 0x5A, 0x09, 0x29, 0xCA, 0x20, 0x4B, 0x31, 0xC9, 0x20, 0x72, 0x52, 0x0A, 0x29, 0xED, 0x41, 0xAD, 0x39, 0x4F, 0x52, 0xD4, 0x62, 0xCE, 0x41, 0x30, 0x4A, 0x0F, 0x4A, 0xEF, 0x41, 0xEF, 0x39, 0xF7, 0x7B, 0x8C, 0x39, 0x13, 0x63, 0xEF, 0x41, 0x8C, 0x31, 0x96, 0x7B, 0x4F, 0x52, 0x71, 0x52, 0xB2, 0x5A, 0x0E, 0x4A, 0x17, 0x94, 0x6F, 0x52, 0x4F, 0x4A,
+    0xB1, 0x52, 0x2D, 0x4A, 0x16, 0x9C, 0xF0, 0x41, 0x14, 0x63, 0xCC, 0x41, 0x50, 0x5A, 0xF5, 0x8B, 0x4E, 0x5A, 0x6D, 0x5A, 0x6E, 0x5A, 0x2C, 0x4A, 0x55, 0xAC, 0x4D, 0x5A, 0xCF, 0x6A, 0xAF, 0x62, 0x4D, 0x5A, 0x76, 0xAC, 0xEC, 0x51, 0xEC, 0x51, 0x4D, 0x62, 0x4E, 0x62, 0xF8, 0xCC, 0x0D, 0x62, 0x4D, 0x6A, 0xB0, 0x7A, 0xD0, 0x7A, 0xB0, 0x7A, 0xFD, 0xDD, 0x2F, 0x6A, 0xF3, 0x7A, 0x92, 0x72,
+    0x32, 0x6A, 0x1D, 0xDE, 0x72, 0x6A, 0x92, 0x72, 0x93, 0x72, 0x92, 0x6A, 0x7E, 0xCD, 0xD2, 0x72, 0xD2, 0x72, 0xF3, 0x72, 0x13, 0x7B, 0xBA, 0xB4, 0x55, 0x83, 0x15, 0x7B, 0x15, 0x7B, 0xB5, 0x7A, 0xC7, 0x20, 0xC7, 0x18, 0xC8, 0x20, 0x09, 0x29, 0x72, 0x4C, 0x0D, 0x4A, 0x2B, 0x31, 0x09, 0x29, 0x8B, 0x39, 0xE9, 0x20, 0xAD, 0x41, 0xB2, 0x62, 0x32, 0x52, 0x0A, 0x29, 0x0E, 0x4A, 0xD2, 0x5A,
+    0x70, 0x52, 0xEF, 0x49, 0xCE, 0x41, 0x50, 0x52, 0xEE, 0x41, 0x91, 0x52, 0x0E, 0x42, 0xAD, 0x39, 0x2F, 0x4A, 0xB1, 0x5A, 0x70, 0x52, 0xB1, 0x5A, 0xED, 0x41, 0x0D, 0x42, 0x90, 0x52, 0xB0, 0x5A, 0xF1, 0x52, 0x0E, 0x42, 0x50, 0x4A, 0x8F, 0x42, 0xBD, 0x9C, 0x2D, 0x4A, 0xD2, 0x6A, 0x4D, 0x4A, 0x70, 0x5A, 0x91, 0x73, 0x4E, 0x5A, 0x0C, 0x4A, 0xCF, 0x6A, 0x8F, 0x62, 0x0C, 0x52, 0x52, 0x7B,
+    0x4D, 0x5A, 0xCB, 0x49, 0xCB, 0x49, 0x0E, 0x5A, 0xB0, 0x72, 0xCF, 0x72, 0x8E, 0x6A, 0xF0, 0x7A, 0x4D, 0x62, 0xB0, 0x72, 0xD1, 0x7A, 0x94, 0x93, 0x2F, 0x62, 0x0F, 0x62, 0x93, 0x72, 0x33, 0x72, 0x34, 0x72, 0x7A, 0x9B, 0x73, 0x6A, 0x74, 0x72, 0x92, 0x6A, 0x71, 0x6A, 0xF3, 0x7A, 0xD2, 0x72, 0xF2, 0x72, 0xD2, 0x72, 0x34, 0x7B, 0xB3, 0x72, 0x15, 0x7B, 0xF5, 0x7A, 0x16, 0x83, 0x16, 0x7B,
+    0xE8, 0x20, 0xC7, 0x18, 0xE8, 0x20, 0xE8, 0x20, 0xE9, 0x20, 0x2D, 0x4A, 0x6A, 0x31, 0xE9, 0x20, 0x4A, 0x31, 0xE9, 0x28, 0x4B, 0x31, 0x32, 0x63, 0x8C, 0x39, 0xC9, 0x18, 0x0E, 0x42, 0x5A, 0x95, 0x11, 0x63, 0xEE, 0x49, 0x4A, 0x29, 0x32, 0x53, 0x10, 0x52, 0xBD, 0xA4, 0x0E, 0x42, 0x10, 0x4A, 0x6F, 0x4A, 0xCD, 0x39, 0x2F, 0x4A, 0x15, 0x84, 0xEC, 0x31, 0x73, 0x63, 0xCF, 0x42, 0x32, 0x6B,
+    0xFF, 0xEF, 0x36, 0x65, 0x11, 0x53, 0x74, 0x74, 0xD7, 0x8C, 0x8A, 0x39, 0x72, 0x6A, 0x52, 0x63, 0x0C, 0x42, 0xEB, 0x41, 0xD0, 0x62, 0xCB, 0x41, 0xCC, 0x49, 0xB6, 0x8B, 0x4E, 0x5A, 0x37, 0x9C, 0xAC, 0x49, 0x0D, 0x52, 0xEC, 0x51, 0x90, 0x6A, 0x2D, 0x5A, 0x53, 0x8B, 0xCF, 0x7A, 0x94, 0x9B, 0x6F, 0x72, 0x16, 0x8B, 0x74, 0x9B, 0x71, 0x7A, 0xD2, 0x7A, 0x34, 0x8B, 0x57, 0x9B, 0x97, 0x8A,
+    0x7B, 0xA2, 0xDE, 0xAA, 0x77, 0x82, 0x19, 0x93, 0x94, 0x72, 0xD3, 0x7A, 0x92, 0x72, 0x30, 0x62, 0x13, 0x7B, 0xF4, 0x7A, 0xD3, 0x72, 0x15, 0x7B, 0x15, 0x7B, 0xD6, 0x7A, 0x18, 0x8B, 0xD7, 0x82, 0xE8, 0x20, 0x4A, 0x31, 0xE9, 0x28, 0x09, 0x29, 0xE9, 0x28, 0xAC, 0x41, 0xE9, 0x28, 0x10, 0x52, 0x4D, 0x39, 0x0A, 0x31, 0x4A, 0x31, 0x4C, 0x31, 0x4B, 0x39, 0xB0, 0x49, 0x8D, 0x41, 0x94, 0x5A,
+    0x11, 0x52, 0x0F, 0x4A, 0x6D, 0x39, 0x15, 0x5B, 0xAD, 0x41, 0xEE, 0x49, 0x8C, 0x39, 0xD9, 0x63, 0x0E, 0x42, 0x8C, 0x39, 0xCB, 0x41, 0xD3, 0x5A, 0x4E, 0x52, 0xAB, 0x41, 0xB0, 0x5A, 0xF5, 0x5A, 0xB2, 0x5B, 0x6D, 0x42, 0x4E, 0x42, 0xDD, 0x84, 0xAF, 0x5A, 0x48, 0x31, 0x10, 0x7B, 0x9C, 0x84, 0x6E, 0x5A, 0xEB, 0x49, 0x4C, 0x52, 0xF7, 0x8B, 0x2C, 0x52, 0x15, 0xA4, 0xEC, 0x49, 0x9F, 0xF6,
+    0x2D, 0x62, 0x2D, 0x5A, 0xD1, 0x7A, 0xD7, 0x9B, 0x2C, 0x62, 0xBE, 0xE5, 0x78, 0xCC, 0xF7, 0xBB, 0x4D, 0x72, 0x37, 0xB4, 0x9A, 0xC4, 0x3B, 0xBC, 0x11, 0x6A, 0xBA, 0xAB, 0x37, 0xA3, 0xBF, 0xEB, 0xFF, 0xFF, 0x9E, 0xEB, 0xBF, 0xBB, 0x9F, 0xFF, 0x15, 0x72, 0xF6, 0x82, 0x93, 0x72, 0xF8, 0xA3, 0xF5, 0x82, 0xB4, 0x72, 0x3C, 0xB4, 0x17, 0x83, 0xDC, 0xAB, 0xFE, 0xB2, 0x9F, 0xF4, 0x1E, 0xBB,
+    0xA7, 0x20, 0x29, 0x29, 0xB4, 0x52, 0x08, 0x31, 0x1F, 0xFF, 0xC8, 0x20, 0xED, 0x49, 0xAB, 0x41, 0x50, 0x52, 0xE9, 0x28, 0x0B, 0x31, 0xF0, 0x51, 0xCA, 0x30, 0x52, 0x62, 0x0A, 0x31, 0xCD, 0x49, 0xCF, 0x49, 0x55, 0x7B, 0x6B, 0x39, 0xAD, 0x41, 0xFD, 0x9C, 0x4C, 0x39, 0x6B, 0x39, 0x6B, 0x39, 0xED, 0x49, 0x18, 0x8C, 0xD6, 0x83, 0xCC, 0x41, 0xAB, 0x39, 0xED, 0x41, 0xBB, 0xA4, 0xAC, 0x39,
+    0xEB, 0x41, 0x2C, 0x4A, 0xBF, 0xDE, 0x2D, 0x52, 0xF0, 0x62, 0x68, 0x31, 0xEB, 0x49, 0xBF, 0xC5, 0x32, 0x7B, 0xCA, 0x41, 0x0B, 0x52, 0xF0, 0x72, 0xD5, 0x93, 0x2F, 0x7B, 0xA9, 0x41, 0x8E, 0x62, 0xB5, 0xAC, 0xAD, 0x72, 0xC9, 0x49, 0x2B, 0x62, 0x98, 0xC4, 0x7D, 0xFF, 0xB4, 0xFE, 0x71, 0xFD, 0x2E, 0xB3, 0xD5, 0xAB, 0x70, 0x7A, 0x91, 0x7A, 0x71, 0x6A, 0x76, 0x92, 0x3D, 0xC3, 0x7F, 0xEC,
+    0xBF, 0xFE, 0xDF, 0xFF, 0x5B, 0x92, 0x99, 0xA3, 0x39, 0xAC, 0x93, 0x72, 0x34, 0x72, 0x38, 0xA2, 0xD5, 0x82, 0x3D, 0xBC, 0x93, 0x72, 0x3C, 0x9B, 0x17, 0x8B, 0x9F, 0xBB, 0x9F, 0xCB, 0x1F, 0xE5, 0xA8, 0x18, 0x09, 0x29, 0xA8, 0x20, 0xD0, 0x5A, 0xE9, 0x28, 0xC8, 0x28, 0xE9, 0x28, 0x8B, 0x39, 0x72, 0x5A, 0x6B, 0x39, 0x2A, 0x31, 0x4B, 0x39, 0xEA, 0x30, 0xF4, 0x6A, 0x8D, 0x41, 0x6D, 0x41,
+    0x6C, 0x39, 0x6D, 0x41, 0x0F, 0x52, 0x95, 0x73, 0xEA, 0x30, 0xAD, 0x41, 0x6C, 0x41, 0xAD, 0x41, 0x37, 0x94, 0xAB, 0x41, 0xAB, 0x41, 0xCC, 0x41, 0x8A, 0x39, 0x57, 0x94, 0x4C, 0x4A, 0xEB, 0x41, 0xEB, 0x41, 0x8D, 0x5A, 0x35, 0x94, 0xCA, 0x39, 0xEF, 0x62, 0x28, 0x29, 0x6D, 0x62, 0x94, 0x83, 0x2C, 0x5A, 0xAA, 0x41, 0x2C, 0x52, 0x48, 0x39, 0x35, 0xA4, 0x2C, 0x52, 0xAA, 0x41, 0x2C, 0x52,
+    0x89, 0x41, 0x56, 0xBD, 0x4B, 0x62, 0xAE, 0x72, 0x4F, 0xA4, 0x58, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x6F, 0xBB, 0xEF, 0x8A, 0x6D, 0x72, 0x2C, 0x6A, 0x58, 0xCD, 0x71, 0x72, 0x51, 0x72, 0x34, 0x8A, 0xDE, 0xCB, 0x3D, 0xBC, 0x33, 0x6A, 0x95, 0x72, 0x72, 0x6A, 0x92, 0x6A, 0xD7, 0x93, 0x50, 0x62, 0xB2, 0x6A, 0x92, 0x6A, 0x10, 0x62, 0x96, 0x93, 0x6E, 0x49, 0xD6, 0x7A, 0x17, 0x83, 0x37, 0x83,
+    0xC7, 0x20, 0xC9, 0x28, 0xA7, 0x20, 0x09, 0x31, 0x09, 0x29, 0xC8, 0x28, 0xE9, 0x30, 0x0A, 0x31, 0x0A, 0x31, 0xE9, 0x30, 0x2B, 0x39, 0x11, 0x62, 0x4D, 0x41, 0xCE, 0x51, 0x36, 0x7A, 0xF0, 0x59, 0x6D, 0x41, 0x92, 0x6A, 0x75, 0x72, 0xAE, 0x49, 0x8C, 0x41, 0x0F, 0x52, 0x0E, 0x52, 0x8C, 0x41, 0x90, 0x62, 0xB6, 0x83, 0xCB, 0x49, 0xAA, 0x39, 0x2C, 0x4A, 0x4C, 0x52, 0x0C, 0x52, 0xEB, 0x49,
+    0x2B, 0x32, 0x2C, 0x52, 0x0B, 0x4A, 0xF1, 0x73, 0x10, 0x63, 0x49, 0x31, 0x2C, 0x52, 0xD0, 0x5A, 0x2B, 0x52, 0x6C, 0x5A, 0xEB, 0x49, 0x89, 0x41, 0xEE, 0x6A, 0x0B, 0x52, 0x31, 0x73, 0x4C, 0x5A, 0x68, 0x39, 0x2C, 0x5A, 0x4C, 0x62, 0xCA, 0x51, 0x2B, 0x62, 0xB1, 0xAB, 0xCE, 0xCB, 0x0F, 0xDC, 0xCD, 0x92, 0xAE, 0x82, 0x8E, 0x72, 0x2C, 0x6A, 0x35, 0xDE, 0xEE, 0x61, 0xF0, 0x61, 0xF6, 0x8A,
+    0x74, 0x7A, 0x13, 0x6A, 0x12, 0x62, 0x73, 0x72, 0xD2, 0x7A, 0x70, 0x6A, 0x70, 0x6A, 0x2F, 0x62, 0xD2, 0x72, 0x71, 0x62, 0x51, 0x62, 0xF4, 0x72, 0xCF, 0x51, 0xD4, 0x72, 0x17, 0x7B, 0xD9, 0x9B, 0x09, 0x29, 0x87, 0x20, 0xE9, 0x30, 0x4A, 0x39, 0x0D, 0x50, 0x09, 0x31, 0x0A, 0x31, 0x6D, 0x49, 0x0F, 0x5A, 0x2A, 0x39, 0x4C, 0x41, 0xEE, 0x59, 0xB0, 0x59, 0x4D, 0x49, 0x8D, 0x51, 0x16, 0x83,
+    0x8F, 0x51, 0x8E, 0x51, 0xCE, 0x51, 0x71, 0x62, 0xCE, 0x51, 0x6C, 0x41, 0xCD, 0x49, 0x16, 0x73, 0xEF, 0x51, 0xAB, 0x41, 0x4D, 0x5A, 0xD1, 0x5A, 0x4C, 0x52, 0xAA, 0x41, 0x4D, 0x52, 0x11, 0x63, 0x2C, 0x4A, 0x0C, 0x52, 0xCA, 0x41, 0xD4, 0x7B, 0x6F, 0x9C, 0x89, 0x39, 0xEE, 0x6A, 0xB5, 0x73, 0x2C, 0x5A, 0xCA, 0x41, 0x6D, 0x5A, 0x72, 0x7B, 0xCA, 0x49, 0x4C, 0x5A, 0xCA, 0x49, 0xF2, 0x72,
+    0x88, 0x41, 0xEA, 0x51, 0x0F, 0x73, 0xD4, 0x93, 0x2B, 0x62, 0x2F, 0x8B, 0x71, 0x9B, 0x37, 0xBC, 0xAE, 0x7A, 0xAD, 0x7A, 0xB8, 0xC4, 0xB9, 0xCC, 0x6D, 0x6A, 0xED, 0x61, 0x9A, 0xBC, 0x74, 0x7A, 0xF0, 0x61, 0xAF, 0x59, 0x10, 0x62, 0xF5, 0x82, 0x30, 0x5A, 0x0F, 0x62, 0x12, 0x7B, 0xD1, 0x72, 0x53, 0x83, 0x90, 0x6A, 0xB2, 0x72, 0x14, 0x7B, 0x52, 0x62, 0xB4, 0x72, 0x95, 0x72, 0x95, 0x72,
+    0xE8, 0x28, 0xA8, 0x28, 0x4A, 0x39, 0x4A, 0x39, 0x10, 0x5A, 0xEA, 0x38, 0xAA, 0x30, 0x2B, 0x39, 0x0F, 0x5A, 0x6D, 0x49, 0x2D, 0x49, 0x4C, 0x41, 0x4D, 0x49, 0x74, 0x7A, 0x9C, 0xC4, 0xB4, 0x71, 0x50, 0x51, 0x52, 0x72, 0xD5, 0x7A, 0xAF, 0x59, 0xD2, 0x61, 0xEF, 0x51, 0xD2, 0x72, 0x6E, 0x49, 0xEE, 0x51, 0x98, 0x9C, 0x11, 0x6B, 0x8E, 0x5A, 0xCA, 0x49, 0xAA, 0x41, 0xB8, 0x94, 0x2B, 0x52,
+    0xAA, 0x41, 0x0C, 0x52, 0x4C, 0x52, 0xAB, 0x41, 0x8D, 0x62, 0x69, 0x31, 0xCC, 0x72, 0xD7, 0x7B, 0xCA, 0x49, 0xAA, 0x41, 0x2C, 0x52, 0xF4, 0x8B, 0x88, 0x41, 0x4C, 0x5A, 0xC9, 0x49, 0x2F, 0x73, 0xD3, 0x8B, 0xEA, 0x49, 0x2A, 0x5A, 0xD2, 0x93, 0xD4, 0x9B, 0xD1, 0x9B, 0x8D, 0x72, 0x4C, 0x72, 0x79, 0xD5, 0xAD, 0x82, 0xCF, 0xAB, 0xEE, 0xB3, 0x10, 0x9B, 0xBD, 0xAB, 0x0F, 0x6A, 0x50, 0x62,
+    0xD0, 0x61, 0xBE, 0xBB, 0xB4, 0x72, 0x2F, 0x62, 0x4F, 0x62, 0x91, 0x72, 0x9F, 0xC4, 0xD0, 0x72, 0xB0, 0x6A, 0x70, 0x62, 0xB2, 0x72, 0xF7, 0x82, 0x92, 0x6A, 0x73, 0x62, 0x95, 0x6A, 0x32, 0x62, 0xAC, 0x41, 0x0B, 0x41, 0xCF, 0x51, 0x0A, 0x31, 0xED, 0x48, 0x8E, 0x49, 0xCA, 0x30, 0xEF, 0x69, 0x2D, 0x49, 0xB0, 0x59, 0x3D, 0x85, 0xF4, 0x82, 0x1F, 0xB1, 0xB4, 0x79, 0x8F, 0x61, 0x36, 0x9B,
+    0x74, 0x82, 0x17, 0x9A, 0xB3, 0x71, 0x53, 0x69, 0x38, 0x84, 0x0E, 0x52, 0xD2, 0x61, 0x0F, 0x5A, 0x4F, 0x5A, 0xD5, 0x83, 0xF1, 0x72, 0xAA, 0x49, 0xD0, 0x6A, 0x11, 0x73, 0xCD, 0x49, 0x4D, 0x5A, 0x8E, 0x5A, 0x6D, 0x5A, 0x33, 0x73, 0x4E, 0x5A, 0x70, 0x83, 0x89, 0x39, 0x4C, 0x52, 0x54, 0x7B, 0x2B, 0x52, 0xC9, 0x41, 0x6C, 0x5A, 0xA9, 0x41, 0x52, 0x7B, 0xB2, 0x83, 0x48, 0x39, 0x2B, 0x52,
+    0x28, 0x39, 0xD0, 0x72, 0xC9, 0x41, 0xEC, 0x59, 0x8D, 0x6A, 0x98, 0xB4, 0x90, 0x8B, 0x6C, 0x6A, 0x2F, 0xAC, 0x0E, 0x93, 0x9C, 0xFE, 0xFF, 0xFF, 0xAD, 0xBB, 0x6D, 0x6A, 0xF7, 0xAB, 0x79, 0xA3, 0x53, 0x8B, 0xBC, 0xF6, 0x6B, 0x49, 0x7F, 0xEC, 0xDF, 0xFD, 0xCB, 0x61, 0xFF, 0xFF, 0xB3, 0xC4, 0xF4, 0xAB, 0x75, 0x82, 0xF2, 0x7A, 0x91, 0x6A, 0x92, 0x6A, 0x98, 0x93, 0xD4, 0x72, 0x10, 0x62,
+    0x49, 0x51, 0x09, 0x39, 0xA8, 0x28, 0xB4, 0x4A, 0xCB, 0x38, 0x2F, 0x59, 0x8D, 0x48, 0x0E, 0x59, 0x92, 0x6A, 0xEF, 0x59, 0x18, 0x89, 0x8D, 0x69, 0xB0, 0xDB, 0xB4, 0x9B, 0xD5, 0xA2, 0xB2, 0x81, 0xD4, 0x80, 0x9E, 0xD1, 0x74, 0x89, 0xF8, 0x9B, 0xD0, 0x61, 0x53, 0x82, 0xEF, 0x61, 0x54, 0x72, 0xD7, 0x9C, 0x2E, 0x62, 0x0E, 0x5A, 0x8B, 0x49, 0x73, 0x7B, 0xD6, 0xA4, 0x71, 0x83, 0xCB, 0x49,
+    0xAC, 0x49, 0x2D, 0x5A, 0x77, 0x9C, 0x91, 0x7B, 0xAE, 0x72, 0x48, 0x31, 0x0B, 0x52, 0xB3, 0x7B, 0xA9, 0x49, 0x88, 0x39, 0xAA, 0x49, 0x68, 0x39, 0x15, 0x94, 0xEA, 0x51, 0x51, 0x73, 0x69, 0x41, 0x48, 0x39, 0x16, 0x9C, 0x4C, 0x52, 0x89, 0x49, 0x68, 0x41, 0x4C, 0x62, 0x57, 0xAC, 0xCA, 0x51, 0xD2, 0x9B, 0x09, 0x72, 0xEC, 0x8A, 0x7E, 0xFE, 0x1B, 0xDD, 0x51, 0x8B, 0x0C, 0x5A, 0x4D, 0x62,
+    0xBE, 0xFF, 0xD9, 0xAB, 0xAC, 0x49, 0xED, 0x51, 0xED, 0x59, 0x0C, 0x62, 0x98, 0xA3, 0x4E, 0x6A, 0x73, 0x83, 0xB0, 0x6A, 0x91, 0x6A, 0x36, 0x93, 0x10, 0x83, 0x92, 0x62, 0x94, 0x6A, 0x11, 0x62, 0xB4, 0xA1, 0xE9, 0x38, 0xCA, 0x40, 0x8A, 0x40, 0x53, 0x82, 0x30, 0x50, 0x1A, 0x90, 0x78, 0xB1, 0x30, 0x61, 0x75, 0x92, 0x8F, 0x61, 0x90, 0xAA, 0xB6, 0xC2, 0x59, 0xB0, 0xB2, 0x71, 0x39, 0xAA,
+    0x3F, 0xF8, 0x1E, 0xF3, 0xDE, 0xD0, 0x78, 0x92, 0xD4, 0x79, 0x16, 0xAB, 0x7C, 0x90, 0xF5, 0x82, 0x2F, 0x62, 0x0F, 0x62, 0x10, 0x62, 0x54, 0x7B, 0x4D, 0x5A, 0x4C, 0x5A, 0x0C, 0x5A, 0x74, 0x8B, 0xCA, 0x41, 0x4E, 0x83, 0x6C, 0x5A, 0x31, 0x73, 0x8C, 0x5A, 0x68, 0x31, 0x4B, 0x5A, 0x11, 0x6B, 0x0A, 0x52, 0x68, 0x39, 0xA9, 0x41, 0x73, 0x7B, 0xEA, 0x49, 0xC9, 0x41, 0x47, 0x39, 0x10, 0x73,
+    0xA9, 0x41, 0x68, 0x39, 0x68, 0x39, 0xB3, 0x8B, 0x27, 0x39, 0x2B, 0x5A, 0x0A, 0x52, 0x33, 0x83, 0xC9, 0x51, 0xEA, 0x59, 0x4B, 0x62, 0x16, 0xAC, 0x0B, 0x62, 0xAA, 0x49, 0xB0, 0x6A, 0xB2, 0x72, 0xEC, 0x51, 0xAB, 0x49, 0xB0, 0x72, 0x94, 0x93, 0x2E, 0x5A, 0xCC, 0x51, 0x6E, 0x62, 0xD0, 0x6A, 0xCC, 0x49, 0x90, 0x62, 0x0F, 0x52, 0x51, 0x5A, 0x30, 0x5A, 0x72, 0x62, 0x73, 0x62, 0x10, 0x5A,
+    0xC9, 0x38, 0xEB, 0x38, 0xCE, 0x50, 0x4A, 0x30, 0xB9, 0xAA, 0xCF, 0x60, 0xBB, 0xB8, 0x1C, 0xC8, 0xD1, 0x60, 0xF6, 0x88, 0x12, 0x72, 0x2D, 0x51, 0x70, 0x58, 0x5B, 0xA1, 0x36, 0x9A, 0x9D, 0xB9, 0x1F, 0xFE, 0x3F, 0xFE, 0x5F, 0xEA, 0x12, 0x71, 0xD1, 0x69, 0x72, 0x72, 0xD6, 0xAB, 0xAE, 0x51, 0xEC, 0x49, 0xD3, 0xDC, 0x32, 0x73, 0xEA, 0x49, 0x2A, 0x52, 0xCE, 0x62, 0x10, 0x6B, 0xAD, 0x62,
+    0x2A, 0x52, 0x6B, 0x5A, 0x6B, 0x5A, 0xEF, 0x72, 0x8B, 0x6A, 0x68, 0x31, 0x6A, 0x6A, 0xD4, 0x8B, 0x09, 0x5A, 0x47, 0x39, 0x2E, 0x7B, 0xEB, 0x49, 0xEE, 0x72, 0xA9, 0x41, 0x88, 0x41, 0xEA, 0x49, 0x67, 0x39, 0x68, 0x39, 0x68, 0x39, 0x68, 0x41, 0x72, 0x83, 0x8D, 0x6A, 0x88, 0x41, 0x6C, 0x62, 0x69, 0x41, 0xC9, 0x51, 0x12, 0xAC, 0x0A, 0x5A, 0x54, 0x83, 0x49, 0x41, 0x74, 0x9C, 0xCB, 0x49,
+    0x53, 0x83, 0x56, 0x83, 0x8B, 0x49, 0xAB, 0x49, 0x70, 0x6A, 0x6B, 0x41, 0x4E, 0x5A, 0x2D, 0x52, 0x4A, 0x39, 0x6F, 0x62, 0x0F, 0x5A, 0x10, 0x5A, 0x0F, 0x5A, 0x52, 0x5A, 0x52, 0x5A, 0xEF, 0x51, 0xE9, 0x28, 0xC8, 0x28, 0xCC, 0x49, 0xEA, 0x30, 0xCC, 0x49, 0x6D, 0x49, 0x53, 0x60, 0x11, 0x6A, 0x0B, 0x39, 0x4B, 0x41, 0x0A, 0x41, 0xF2, 0x69, 0xF1, 0x61, 0x4F, 0x51, 0xB0, 0x61, 0x95, 0x92,
+    0x79, 0xB2, 0x18, 0xA1, 0xD9, 0x99, 0xD1, 0x61, 0x70, 0x6A, 0x93, 0x83, 0x10, 0x7B, 0x8E, 0x6A, 0x2C, 0x52, 0x52, 0x8C, 0xCF, 0x83, 0x4B, 0x52, 0x6B, 0x52, 0xCC, 0x62, 0x96, 0x94, 0x8F, 0x7B, 0xCE, 0x62, 0xE9, 0x41, 0xC8, 0x41, 0xAD, 0x62, 0xEA, 0x49, 0x88, 0x39, 0x88, 0x41, 0x32, 0x73, 0x8C, 0x5A, 0x47, 0x31, 0x88, 0x41, 0x26, 0x31, 0x30, 0x6B, 0xC9, 0x41, 0xCE, 0x62, 0x0A, 0x4A,
+    0xCF, 0x6A, 0x8D, 0x62, 0x88, 0x41, 0x88, 0x41, 0x06, 0x31, 0xB7, 0xA4, 0x68, 0x39, 0x68, 0x41, 0xCD, 0x72, 0xAF, 0x72, 0xAD, 0x6A, 0x88, 0x41, 0xF1, 0xE5, 0x6B, 0x49, 0x18, 0x8B, 0xF1, 0x93, 0x8A, 0x41, 0x6A, 0x39, 0x90, 0x62, 0xAC, 0x41, 0x2D, 0x5A, 0xCC, 0x49, 0x0E, 0x52, 0x19, 0x8B, 0xED, 0x51, 0x2E, 0x52, 0x2F, 0x52, 0xD2, 0x72, 0x30, 0x5A, 0x52, 0x62, 0x93, 0x62, 0x4C, 0x39,
+    0x6A, 0x39, 0x09, 0x31, 0xE8, 0x28, 0xE9, 0x28, 0x2A, 0x31, 0x0D, 0x4A, 0x2C, 0x39, 0x2B, 0x39, 0x0B, 0x39, 0xAD, 0x51, 0x32, 0x73, 0x6C, 0x41, 0x2C, 0x41, 0x2E, 0x51, 0x6D, 0x51, 0x91, 0x72, 0xD9, 0xA2, 0x76, 0x8A, 0x91, 0x61, 0xCD, 0x59, 0xF5, 0xA4, 0x6E, 0x6A, 0xAF, 0x83, 0x91, 0x7B, 0xF1, 0x83, 0x53, 0xA5, 0x10, 0x8C, 0x0D, 0x63, 0x4B, 0x52, 0xCB, 0x62, 0x6C, 0x5A, 0x2A, 0x4A,
+    0xC9, 0x41, 0x6E, 0x73, 0x94, 0x94, 0x90, 0x83, 0xCA, 0x41, 0x88, 0x31, 0x8C, 0x5A, 0xB3, 0x73, 0x89, 0x39, 0x47, 0x31, 0x88, 0x39, 0x0F, 0x6B, 0xB5, 0x83, 0xA7, 0x39, 0x69, 0x31, 0x0B, 0x4A, 0x26, 0x31, 0x2B, 0x52, 0xAD, 0x62, 0x4C, 0x5A, 0xE6, 0x28, 0x13, 0x7B, 0x8E, 0x6A, 0xAE, 0x6A, 0xEB, 0x51, 0x49, 0x41, 0xAD, 0x49, 0xD3, 0x93, 0x89, 0x41, 0x8E, 0x62, 0x4A, 0x41, 0x38, 0x8B,
+    0x09, 0x39, 0xD3, 0x9B, 0x4B, 0x41, 0x4B, 0x41, 0xD7, 0x7A, 0xAB, 0x41, 0x1A, 0xEF, 0x4D, 0x5A, 0xEC, 0x49, 0xF7, 0x82, 0x90, 0x6A, 0x0F, 0x52, 0x50, 0x5A, 0x31, 0x5A, 0x73, 0x62, 0x8D, 0x41, 0xA7, 0x20, 0x87, 0x20, 0x29, 0x31, 0xEC, 0x41, 0x48, 0x31, 0x2A, 0x39, 0x73, 0x59, 0xAD, 0x49, 0x4E, 0x5A, 0x73, 0x7B, 0x33, 0x9C, 0x0D, 0x5A, 0x6C, 0x41, 0xF3, 0x69, 0x55, 0x9C, 0x30, 0x6A,
+    0x5E, 0xA0, 0xD2, 0x69, 0xED, 0x59, 0xF4, 0xBD, 0x4D, 0x62, 0x6C, 0x5A, 0x8E, 0x7B, 0xD1, 0x7B, 0xF9, 0xFF, 0x74, 0xEF, 0x51, 0x94, 0xAF, 0x7B, 0xEB, 0x62, 0x16, 0xDF, 0x8D, 0x73, 0x4F, 0x6B, 0xE9, 0x41, 0x0A, 0x4A, 0xF5, 0x9C, 0x0F, 0x63, 0xEB, 0x49, 0x68, 0x31, 0x2B, 0x4A, 0x52, 0x6B, 0xA9, 0x41, 0x47, 0x31, 0xC9, 0x41, 0x10, 0x6B, 0x94, 0x83, 0xC9, 0x39, 0x28, 0x31, 0x4E, 0x5A,
+    0x48, 0x31, 0x52, 0x7B, 0x27, 0x31, 0x31, 0x7B, 0x48, 0x39, 0x89, 0x41, 0x96, 0x8B, 0x92, 0x8B, 0x48, 0x31, 0xAA, 0x41, 0xCB, 0x49, 0xF1, 0x7A, 0xCF, 0x6A, 0x8A, 0x41, 0xE8, 0x28, 0x94, 0x8B, 0x0A, 0x31, 0xD9, 0x82, 0x4A, 0x39, 0xED, 0x51, 0x6B, 0x41, 0x4B, 0x39, 0x95, 0x6A, 0x2E, 0x52, 0x4E, 0x5A, 0x0D, 0x52, 0xAD, 0x49, 0xB5, 0x7A, 0xEF, 0x51, 0x10, 0x52, 0x11, 0x5A, 0x2B, 0x31,
+    0xC7, 0x28, 0x08, 0x31, 0xC7, 0x28, 0xC7, 0x20, 0xE8, 0x28, 0x66, 0x31, 0xCD, 0x51, 0xC9, 0x30, 0x4C, 0x41, 0x2D, 0x63, 0x76, 0xB5, 0x4B, 0x41, 0x53, 0x69, 0xCC, 0x49, 0x71, 0x6A, 0x6C, 0x51, 0x8B, 0x49, 0x8C, 0x49, 0x12, 0x8B, 0x2C, 0x5A, 0xAC, 0x62, 0x8B, 0x5A, 0xB2, 0x94, 0xCE, 0x83, 0x6C, 0x7B, 0xD1, 0xA4, 0xF7, 0xFF, 0x2B, 0x63, 0xA9, 0x5A, 0xAB, 0x5A, 0x31, 0x8C, 0x2F, 0x6B,
+    0xCD, 0x62, 0x4A, 0x52, 0x87, 0x31, 0x51, 0x73, 0x88, 0x39, 0x67, 0x31, 0x4B, 0x52, 0xCF, 0x5A, 0x89, 0x39, 0x27, 0x29, 0x69, 0x39, 0x32, 0x73, 0x28, 0x31, 0xAA, 0x39, 0x69, 0x39, 0xAB, 0x41, 0x27, 0x31, 0x49, 0x31, 0x28, 0x31, 0xCB, 0x49, 0xAA, 0x41, 0x69, 0x39, 0x49, 0x39, 0x08, 0x31, 0xAB, 0x49, 0x49, 0x39, 0x48, 0x31, 0x49, 0x39, 0xD0, 0x6A, 0x08, 0x31, 0xE9, 0x30, 0x6A, 0x39,
+    0x12, 0x7B, 0x2A, 0x39, 0x4A, 0x39, 0x4B, 0x39, 0xF4, 0x7A, 0x6B, 0x39, 0x8C, 0x41, 0xEC, 0x49, 0xCC, 0x49, 0xD1, 0x6A, 0x4B, 0x39, 0xEE, 0x49, 0xAD, 0x49, 0xEF, 0x51, 0xF0, 0x51, 0x8E, 0x41, 0x65, 0x18, 0xA6, 0x20, 0x09, 0x31, 0xC7, 0x28, 0xCC, 0x49, 0x8D, 0x5A, 0x09, 0x31, 0x08, 0x29, 0x2D, 0x52, 0x49, 0x39, 0x94, 0x94, 0x4A, 0x39, 0xAB, 0x49, 0x90, 0x62, 0x2D, 0x5A, 0x0D, 0x52,
+    0xAB, 0x49, 0xF0, 0x7A, 0x8E, 0x6A, 0x6C, 0x5A, 0x8B, 0x5A, 0x73, 0x8B, 0x6B, 0x73, 0xAE, 0xA4, 0x71, 0xCD, 0xCF, 0xC5, 0xF6, 0xFF, 0x6B, 0x6B, 0xEE, 0x83, 0x0B, 0x63, 0xF2, 0x7B, 0x8A, 0x5A, 0x2A, 0x4A, 0x49, 0x63, 0x8B, 0x52, 0xEE, 0x6A, 0xA9, 0x41, 0x67, 0x31, 0xD1, 0x6A, 0x73, 0x73, 0xCB, 0x41, 0x27, 0x29, 0x69, 0x39, 0x08, 0x29, 0x27, 0x29, 0x89, 0x39, 0x4D, 0x52, 0xA9, 0x39,
+    0xF5, 0x83, 0x08, 0x29, 0xE7, 0x28, 0x48, 0x31, 0x72, 0x83, 0xAA, 0x41, 0x69, 0x39, 0x07, 0x29, 0x6A, 0x41, 0x91, 0x83, 0x29, 0x31, 0x08, 0x31, 0x49, 0x39, 0x16, 0x83, 0x09, 0x31, 0x4A, 0x39, 0x6D, 0x5A, 0xD3, 0x6A, 0x4E, 0x5A, 0x2A, 0x31, 0x4B, 0x39, 0x8C, 0x41, 0xAD, 0x49, 0x6B, 0x39, 0xCD, 0x49, 0x6C, 0x41, 0x8D, 0x41, 0xCE, 0x49, 0x0F, 0x52, 0xCE, 0x49, 0xAD, 0x41, 0x6D, 0x41,
+    0x08, 0x31, 0xA6, 0x20, 0xCB, 0x41, 0xC7, 0x28, 0x08, 0x31, 0xEA, 0x49, 0x29, 0x31, 0xEC, 0x41, 0xE7, 0x28, 0x2C, 0x49, 0x48, 0x31, 0xAB, 0x41, 0xCD, 0x51, 0xAC, 0x49, 0xAB, 0x41, 0xAA, 0x41, 0x2F, 0x73, 0x6E, 0x62, 0x0B, 0x52, 0xEC, 0x6A, 0xB1, 0x83, 0xAD, 0x73, 0x4C, 0x94, 0xCE, 0xD5, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x4C, 0x94, 0x8A, 0x73, 0x8A, 0x7B, 0xAD, 0x73, 0x6A, 0x52,
+    0x08, 0x42, 0x29, 0x42, 0xCB, 0x5A, 0xEF, 0x6A, 0xA9, 0x39, 0x67, 0x31, 0xEE, 0x49, 0x12, 0x73, 0x89, 0x39, 0x47, 0x29, 0x89, 0x39, 0xEF, 0x6A, 0xE7, 0x20, 0xCA, 0x41, 0x27, 0x29, 0x69, 0x39, 0xD6, 0x83, 0x28, 0x29, 0xCB, 0x49, 0x08, 0x31, 0x08, 0x31, 0xCC, 0x49, 0xAE, 0x6A, 0x8A, 0x41, 0xE7, 0x28, 0x69, 0x39, 0x29, 0x39, 0x08, 0x31, 0xE8, 0x28, 0x6A, 0x39, 0x37, 0x83, 0xE8, 0x28,
+    0x09, 0x31, 0x2E, 0x5A, 0x2A, 0x31, 0x0A, 0x29, 0x4B, 0x39, 0x2B, 0x39, 0xEE, 0x51, 0x16, 0x7B, 0x13, 0x7B, 0xA9, 0x28, 0xAE, 0x49, 0x4C, 0x39, 0x8D, 0x41, 0xEF, 0x51, 0x8E, 0x41, 0x4E, 0x39, 0xAA, 0x39, 0xC7, 0x28, 0xE7, 0x28, 0x07, 0x31, 0xE7, 0x28, 0x69, 0x31, 0x28, 0x29, 0xCD, 0x51, 0x29, 0x31, 0x28, 0x31, 0x2D, 0x4A, 0x71, 0x72, 0xAD, 0x49, 0x69, 0x39, 0xC9, 0x41, 0xEE, 0x62,
+    0xC9, 0x41, 0xE9, 0x41, 0x2A, 0x52, 0x92, 0x8B, 0x95, 0xB6, 0x6B, 0x7B, 0xAD, 0xA4, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x12, 0xAD, 0x6B, 0x73, 0x8C, 0x6B, 0xCA, 0x62, 0x4F, 0x7B, 0x8B, 0x52, 0x8B, 0x52, 0x6C, 0x52, 0x10, 0x6B, 0xA9, 0x39, 0x67, 0x31, 0xEE, 0x49, 0x13, 0x6B, 0xA9, 0x41, 0x26, 0x29, 0x68, 0x31, 0x11, 0x73, 0xF4, 0x72, 0xAB, 0x41, 0x07, 0x29, 0xEF, 0x51,
+    0xE6, 0x20, 0x6B, 0x39, 0xC6, 0x20, 0x8B, 0x41, 0x8A, 0x39, 0xAE, 0x49, 0xE7, 0x20, 0x2E, 0x52, 0x08, 0x31, 0x08, 0x31, 0xCA, 0x28, 0x2E, 0x52, 0xE7, 0x20, 0xC7, 0x20, 0xCB, 0x49, 0x10, 0x5A, 0x0A, 0x31, 0xE9, 0x28, 0x0A, 0x31, 0xEA, 0x28, 0xD1, 0x51, 0x2B, 0x31, 0x2B, 0x31, 0x4C, 0x39, 0x6D, 0x41, 0xED, 0x38, 0x6D, 0x41, 0xAE, 0x49, 0x8E, 0x41, 0xCE, 0x49, 0xAF, 0x49, 0xAF, 0x49,
+    0xC6, 0x20, 0xE7, 0x20, 0xC6, 0x20, 0x08, 0x29, 0xEC, 0x39, 0x27, 0x31, 0x8B, 0x41, 0x07, 0x31, 0x07, 0x29, 0x8D, 0x52, 0x6A, 0x39, 0xCE, 0x51, 0x89, 0x41, 0xA9, 0x39, 0x0F, 0x84, 0x6C, 0x52, 0xA8, 0x39, 0x88, 0x39, 0xF7, 0xD6, 0x73, 0xC6, 0xEA, 0x62, 0x0B, 0x6B, 0xCB, 0x83, 0x53, 0xEE, 0xFF, 0xFF, 0xF6, 0xFF, 0x51, 0xE7, 0x6E, 0x94, 0x0D, 0x84, 0x96, 0xEF, 0xCA, 0x5A, 0xF1, 0x8B,
+    0x0E, 0x6B, 0x09, 0x42, 0x74, 0x8C, 0x51, 0x73, 0x88, 0x39, 0x26, 0x29, 0xCB, 0x49, 0xD0, 0x5A, 0x48, 0x31, 0x06, 0x29, 0x48, 0x31, 0x12, 0x73, 0xD3, 0x6A, 0xFB, 0x7A, 0xCA, 0x41, 0x6F, 0x5A, 0xC6, 0x20, 0xB4, 0x6A, 0x86, 0x18, 0x08, 0x31, 0xC7, 0x28, 0x2B, 0x31, 0xB2, 0x62, 0x66, 0x20, 0xE7, 0x20, 0x08, 0x29, 0x08, 0x29, 0xB5, 0x6A, 0xAC, 0x49, 0xC7, 0x20, 0xC8, 0x20, 0x0A, 0x31,
+    0x51, 0x62, 0xF6, 0x7A, 0xE9, 0x28, 0xE9, 0x28, 0x4C, 0x41, 0xB2, 0x51, 0x19, 0x62, 0x0B, 0x31, 0x2C, 0x39, 0xAE, 0x49, 0x13, 0x5A, 0x76, 0x72, 0x2D, 0x39, 0x11, 0x5A, 0xD0, 0x49, 0xAF, 0x41, 0xA6, 0x20, 0xA6, 0x20, 0xE7, 0x20, 0xE6, 0x20, 0x69, 0x39, 0xC7, 0x20, 0xE7, 0x28, 0xE6, 0x20, 0x69, 0x39, 0xEC, 0x51, 0xAD, 0x49, 0x27, 0x31, 0x27, 0x31, 0x4E, 0x5A, 0x6C, 0x52, 0x88, 0x39,
+    0xA7, 0x39, 0x6E, 0x6A, 0xC8, 0x41, 0x28, 0x4A, 0xAA, 0x5A, 0xCA, 0x62, 0x30, 0x94, 0x4C, 0x94, 0x4B, 0x8C, 0x2C, 0xA5, 0x11, 0xAD, 0x4A, 0x6B, 0x6C, 0x73, 0xEB, 0x5A, 0x2D, 0x6B, 0xC7, 0x39, 0xC7, 0x39, 0xE8, 0x41, 0xC8, 0x39, 0xA9, 0x39, 0x67, 0x31, 0x26, 0x29, 0x4D, 0x52, 0xF1, 0x62, 0x68, 0x39, 0x06, 0x21, 0x69, 0x39, 0xB0, 0x49, 0x07, 0x29, 0xAC, 0x41, 0xC6, 0x20, 0x28, 0x29,
+    0xCC, 0x41, 0x07, 0x29, 0xEC, 0x49, 0x08, 0x29, 0x71, 0x62, 0x0A, 0x29, 0x08, 0x29, 0x08, 0x31, 0x2C, 0x39, 0x4E, 0x5A, 0xE8, 0x28, 0xC7, 0x20, 0x87, 0x20, 0xEE, 0x49, 0xA8, 0x20, 0xC9, 0x28, 0x0B, 0x31, 0xAB, 0x28, 0xCA, 0x28, 0xE9, 0x28, 0xC9, 0x20, 0xD1, 0x51, 0x0C, 0x39, 0x2C, 0x31, 0x6D, 0x41, 0x0C, 0x31, 0x6E, 0x41, 0xD0, 0x49, 0x8F, 0x41, 0x8F, 0x41, 0x6F, 0x41, 0x0E, 0x31,
+    0xC6, 0x20, 0xA6, 0x20, 0x08, 0x29, 0xA6, 0x20, 0x07, 0x29, 0xE6, 0x20, 0xE6, 0x28, 0x4D, 0x52, 0xE6, 0x20, 0x6B, 0x41, 0x68, 0x39, 0x48, 0x31, 0xB1, 0x72, 0xEB, 0x49, 0x2B, 0x52, 0x88, 0x39, 0x6E, 0x62, 0x47, 0x39, 0xE7, 0x41, 0xF0, 0x6A, 0x31, 0x8C, 0xF0, 0x7B, 0xAD, 0x83, 0x0C, 0x84, 0x6F, 0x94, 0xAB, 0x7B, 0x2E, 0x8C, 0xA8, 0x5A, 0x68, 0x4A, 0xAB, 0x5A, 0xD2, 0x83, 0xA7, 0x39,
+    0xE9, 0x41, 0xC8, 0x39, 0xA8, 0x39, 0xEA, 0x41, 0x68, 0x39, 0x26, 0x21, 0x69, 0x39, 0x17, 0x73, 0xAA, 0x41, 0xE6, 0x20, 0x49, 0x31, 0xAB, 0x41, 0x4A, 0x31, 0xAA, 0x39, 0xC6, 0x18, 0xC7, 0x20, 0x71, 0x62, 0x07, 0x29, 0xC7, 0x20, 0x07, 0x29, 0x2B, 0x31, 0xEA, 0x28, 0x2C, 0x52, 0xE8, 0x28, 0x08, 0x29, 0x70, 0x62, 0xC9, 0x28, 0x87, 0x18, 0xA6, 0x18, 0x67, 0x18, 0xB5, 0x6A, 0xC9, 0x28,
+    0xC9, 0x28, 0x4D, 0x39, 0x12, 0x5A, 0x73, 0x62, 0xEA, 0x28, 0x0C, 0x31, 0x0C, 0x31, 0xCF, 0x38, 0x4D, 0x39, 0x2D, 0x39, 0x2D, 0x39, 0x8F, 0x41, 0xD1, 0x51, 0x90, 0x41, 0x2F, 0x39, 0x0E, 0x31, 0x85, 0x18, 0xC6, 0x20, 0xCC, 0x49, 0xC6, 0x20, 0xA5, 0x20, 0xA5, 0x18, 0xA5, 0x20, 0x08, 0x29, 0xE6, 0x20, 0x07, 0x29, 0x48, 0x39, 0xF8, 0xFF, 0x67, 0x39, 0x0B, 0x4A, 0x88, 0x39, 0x6D, 0x5A,
+    0x86, 0x31, 0x87, 0x31, 0xEC, 0x49, 0x4D, 0x6B, 0x14, 0xA5, 0x8A, 0x5A, 0xCC, 0x62, 0x4D, 0x73, 0xC8, 0x5A, 0x33, 0xA5, 0x8E, 0x94, 0x4D, 0x6B, 0x69, 0x52, 0x6A, 0x52, 0xC7, 0x39, 0xEF, 0x6A, 0xEA, 0x49, 0xA8, 0x39, 0x51, 0x73, 0xB2, 0x83, 0xCA, 0x41, 0x26, 0x21, 0xEC, 0x49, 0x32, 0x6B, 0x68, 0x31, 0x07, 0x21, 0x48, 0x31, 0x8B, 0x39, 0x76, 0x83, 0x6A, 0x39, 0x49, 0x31, 0xE8, 0x28,
+    0x29, 0x31, 0x6B, 0x39, 0xC7, 0x20, 0xE8, 0x28, 0xC7, 0x20, 0x6C, 0x39, 0x86, 0x18, 0x08, 0x29, 0xE8, 0x28, 0x08, 0x29, 0x69, 0x20, 0xA7, 0x20, 0xE8, 0x28, 0xA7, 0x20, 0xA8, 0x20, 0x0C, 0x31, 0x0B, 0x31, 0x50, 0x38, 0xCA, 0x28, 0xEB, 0x28, 0x8C, 0x28, 0xCB, 0x28, 0x0C, 0x31, 0x0D, 0x39, 0x37, 0x6A, 0x0F, 0x39, 0x2E, 0x39, 0x2F, 0x39, 0x70, 0x41, 0xB1, 0x49, 0xB3, 0x49, 0x0F, 0x39,
+    0xEF, 0x51, 0x07, 0x29, 0x06, 0x29, 0xC5, 0x20, 0xC5, 0x20, 0x6D, 0x52, 0x4B, 0x39, 0x06, 0x21, 0x06, 0x29, 0x06, 0x21, 0x6D, 0x52, 0x08, 0x31, 0x27, 0x31, 0x2B, 0x4A, 0xCB, 0x41, 0x8F, 0x73, 0x67, 0x31, 0x87, 0x31, 0x1B, 0xDC, 0x4B, 0x52, 0xCB, 0x5A, 0xF0, 0x72, 0x08, 0x4A, 0xEB, 0x62, 0x68, 0x52, 0xCB, 0x62, 0xAA, 0x5A, 0x2E, 0x73, 0xAC, 0x5A, 0x29, 0x4A, 0xC8, 0x39, 0x71, 0x7B,
+    0x09, 0x4A, 0xA8, 0x31, 0x88, 0x39, 0xF1, 0x62, 0x89, 0x39, 0x27, 0x21, 0xCD, 0x49, 0x33, 0x6B, 0x8A, 0x39, 0x07, 0x21, 0x49, 0x31, 0x33, 0x73, 0x87, 0x18, 0xEB, 0x49, 0xCB, 0x41, 0xF1, 0x6A, 0xC7, 0x20, 0x49, 0x31, 0xA6, 0x20, 0x4B, 0x39, 0x87, 0x20, 0x6B, 0x39, 0xC9, 0x28, 0x86, 0x18, 0xC8, 0x20, 0x6B, 0x39, 0x0D, 0x31, 0x09, 0x29, 0x4A, 0x39, 0xE8, 0x28, 0xA8, 0x20, 0x0C, 0x31,
+    0x4E, 0x39, 0x89, 0x20, 0x8A, 0x20, 0xCB, 0x28, 0x92, 0x49, 0xED, 0x30, 0x0D, 0x31, 0x2F, 0x39, 0x4F, 0x39, 0x51, 0x41, 0x10, 0x39, 0xEF, 0x30, 0x30, 0x39, 0x71, 0x41, 0x51, 0x41, 0xAE, 0x28, 0xE6, 0x20, 0xC5, 0x20, 0xC6, 0x20, 0xC5, 0x20, 0xEC, 0x42, 0xC5, 0x20, 0xC5, 0x18, 0xE5, 0x20, 0xE6, 0x20, 0xCD, 0x5A, 0x88, 0x39, 0xE5, 0x20, 0x06, 0x29, 0xEB, 0x51, 0x0F, 0x7C, 0x27, 0x31,
+    0x46, 0x29, 0x67, 0x31, 0xE8, 0x41, 0xB0, 0x8C, 0x55, 0x94, 0xE8, 0x41, 0x70, 0x7B, 0x2C, 0x63, 0x93, 0xCE, 0x4A, 0x52, 0xCD, 0x62, 0x28, 0x52, 0x49, 0x4A, 0xB4, 0xAD, 0x8D, 0x5A, 0x09, 0x42, 0x69, 0x31, 0x0A, 0x4A, 0x14, 0x84, 0xED, 0x49, 0xED, 0x49, 0x07, 0x21, 0xCD, 0x49, 0xF4, 0x6A, 0xAC, 0x41, 0xE7, 0x20, 0x29, 0x31, 0x10, 0x52, 0x35, 0x7B, 0x29, 0x31, 0xE8, 0x20, 0xEC, 0x49,
+    0x2A, 0x31, 0x92, 0x62, 0x6A, 0x39, 0x29, 0x31, 0x6E, 0x41, 0xA8, 0x20, 0xB6, 0x72, 0x66, 0x18, 0x67, 0x18, 0x6A, 0x31, 0x32, 0x39, 0x75, 0x6A, 0xCD, 0x49, 0x0B, 0x31, 0xC9, 0x20, 0x30, 0x41, 0xF8, 0x61, 0x94, 0x49, 0x89, 0x20, 0x8A, 0x20, 0x2F, 0x39, 0x5C, 0x59, 0x90, 0x38, 0x90, 0x38, 0x0F, 0x39, 0xAF, 0x30, 0x5D, 0x59, 0xF6, 0x48, 0x31, 0x41, 0x51, 0x41, 0x31, 0x41, 0xF0, 0x30,
+    0xA5, 0x18, 0xC5, 0x20, 0xA5, 0x20, 0xC5, 0x20, 0xC6, 0x20, 0xC5, 0x20, 0xC5, 0x20, 0x88, 0x39, 0xC5, 0x20, 0xC5, 0x20, 0x06, 0x29, 0x06, 0x21, 0xE5, 0x20, 0x47, 0x29, 0x47, 0x31, 0x46, 0x29, 0x47, 0x31, 0x47, 0x31, 0x47, 0x31, 0x78, 0x9C, 0x4B, 0x52, 0x89, 0x39, 0xE8, 0x41, 0x4A, 0x4A, 0xE8, 0x41, 0x6C, 0x52, 0x09, 0x4A, 0xA7, 0x39, 0xE8, 0x41, 0x09, 0x4A, 0xB3, 0x7B, 0x67, 0x31,
+    0x68, 0x31, 0x89, 0x39, 0x69, 0x31, 0xCA, 0x39, 0x33, 0x62, 0x28, 0x29, 0x30, 0x52, 0x52, 0x5A, 0x93, 0x6A, 0xE8, 0x20, 0x2B, 0x31, 0x8C, 0x41, 0xA7, 0x20, 0x6A, 0x39, 0xE7, 0x20, 0x2A, 0x31, 0x91, 0x62, 0xA7, 0x20, 0x49, 0x31, 0xA7, 0x18, 0x87, 0x18, 0xE9, 0x30, 0x87, 0x18, 0x66, 0x18, 0xC8, 0x28, 0xAC, 0x41, 0xC9, 0x20, 0x2B, 0x31, 0x87, 0x18, 0x88, 0x18, 0xCA, 0x28, 0xB5, 0x38,
+    0x4A, 0x18, 0x49, 0x18, 0xB1, 0x51, 0xAC, 0x20, 0x6B, 0x20, 0xAD, 0x28, 0x4D, 0x20, 0xF1, 0x40, 0xB0, 0x30, 0xD2, 0x40, 0xD1, 0x38, 0xF3, 0x40, 0x12, 0x39, 0x32, 0x41, 0x32, 0x41, 0xF1, 0x38, 0x84, 0x10, 0xA4, 0x18, 0xE6, 0x28, 0x27, 0x29, 0xA5, 0x18, 0xC5, 0x20, 0xE5, 0x20, 0x89, 0x39, 0x06, 0x21, 0x47, 0x31, 0xC5, 0x20, 0xE5, 0x20, 0x2C, 0x4A, 0x06, 0x29, 0x26, 0x29, 0x47, 0x31,
+    0x0E, 0x6B, 0x28, 0x31, 0xCA, 0x49, 0x2B, 0x52, 0xA8, 0x39, 0x90, 0x7B, 0xC7, 0x39, 0x8C, 0x5A, 0xA7, 0x39, 0xEA, 0x41, 0x09, 0x52, 0x8D, 0x62, 0x4A, 0x52, 0xAD, 0x62, 0x52, 0x73, 0x89, 0x39, 0x47, 0x29, 0xEB, 0x41, 0x8A, 0x39, 0xF0, 0x62, 0x4B, 0x39, 0xE9, 0x20, 0xB5, 0x72, 0xDE, 0x8A, 0x8D, 0x41, 0xE9, 0x20, 0xE9, 0x28, 0xE9, 0x28, 0x68, 0x18, 0x4A, 0x31, 0xC7, 0x20, 0xE9, 0x28,
+    0x0A, 0x29, 0x47, 0x18, 0xC6, 0x18, 0x86, 0x18, 0xAA, 0x20, 0xA8, 0x20, 0xC7, 0x20, 0x66, 0x18, 0xC7, 0x20, 0xA7, 0x20, 0x67, 0x18, 0xA8, 0x20, 0x67, 0x18, 0x87, 0x18, 0xAE, 0x49, 0x69, 0x18, 0x8B, 0x20, 0x6A, 0x18, 0x2A, 0x18, 0x4B, 0x18, 0x6D, 0x20, 0x8C, 0x20, 0x6E, 0x20, 0xD1, 0x38, 0x91, 0x30, 0x73, 0x38, 0x73, 0x38, 0x97, 0x48, 0x13, 0x41, 0xB1, 0x30, 0xF2, 0x38, 0x54, 0x41,
+    0xC5, 0x18, 0xA9, 0x39, 0xE5, 0x20, 0x84, 0x18, 0xC5, 0x20, 0xC5, 0x20, 0x8A, 0x39, 0xE6, 0x28, 0x26, 0x29, 0x06, 0x21, 0x68, 0x31, 0x47, 0x31, 0x06, 0x29, 0x06, 0x21, 0x06, 0x29, 0x2B, 0x4A, 0x08, 0x31, 0x2A, 0x31, 0x89, 0x39, 0x0A, 0x4A, 0xAD, 0x5A, 0x87, 0x31, 0x87, 0x39, 0xD7, 0xA3, 0x4A, 0x4A, 0x30, 0x83, 0xE8, 0x69, 0xFF, 0xFF, 0x6B, 0x62, 0x6D, 0x5A, 0xD0, 0x62, 0x71, 0x62,
+    0x27, 0x29, 0x89, 0x39, 0x12, 0x62, 0x92, 0x6A, 0x6C, 0x39, 0x2B, 0x31, 0xF6, 0x61, 0x5B, 0x82, 0xF0, 0x40, 0x2A, 0x31, 0x0B, 0x31, 0xF4, 0x72, 0x14, 0x62, 0xE9, 0x28, 0xA7, 0x20, 0xF1, 0x51, 0x67, 0x18, 0x2D, 0x39, 0xA7, 0x18, 0x2A, 0x31, 0x6B, 0x39, 0x51, 0x62, 0xA7, 0x18, 0x86, 0x18, 0xC8, 0x20, 0x66, 0x18, 0x6F, 0x39, 0x88, 0x18, 0xA8, 0x20, 0xA8, 0x20, 0xA9, 0x20, 0xB3, 0x51,
+    0x29, 0x18, 0x49, 0x18, 0x29, 0x18, 0x4C, 0x20, 0xF4, 0x40, 0x4D, 0x20, 0x6E, 0x20, 0x72, 0x30, 0x5A, 0x59, 0x1D, 0x58, 0x3D, 0x60, 0x1D, 0x68, 0xB5, 0x40, 0x14, 0x41, 0xF4, 0x40, 0xB4, 0x38, 0xE6, 0x28, 0x84, 0x18, 0xA4, 0x18, 0xE5, 0x20, 0xC5, 0x18, 0x84, 0x18, 0xC5, 0x18, 0xC5, 0x20, 0xE6, 0x20, 0xC5, 0x20, 0xE6, 0x20, 0xE5, 0x20, 0x06, 0x21, 0x05, 0x21, 0xE6, 0x28, 0xE7, 0x28,
+    0x0D, 0x41, 0x0E, 0x41, 0x49, 0x39, 0x69, 0x31, 0x68, 0x31, 0x88, 0x31, 0xEF, 0x62, 0x09, 0x4A, 0x87, 0x31, 0x87, 0x39, 0x0A, 0x62, 0x45, 0x51, 0xAD, 0x62, 0x2C, 0x52, 0x88, 0x31, 0x8E, 0x5A, 0x27, 0x29, 0x7E, 0xA3, 0x29, 0x31, 0xF5, 0x59, 0x6E, 0x39, 0x0D, 0x31, 0xBF, 0xF5, 0xFF, 0xFF, 0xBD, 0x92, 0x0C, 0x31, 0x0C, 0x31, 0x4E, 0x39, 0x8E, 0x41, 0x35, 0x51, 0x08, 0x29, 0xA7, 0x20,
+    0x4A, 0x31, 0x87, 0x18, 0xA7, 0x18, 0xC7, 0x20, 0xD1, 0x6A, 0x67, 0x18, 0x66, 0x18, 0x09, 0x29, 0xEA, 0x28, 0xAC, 0x41, 0xA8, 0x18, 0x0D, 0x4A, 0x88, 0x20, 0x4C, 0x39, 0x88, 0x18, 0x48, 0x18, 0x28, 0x18, 0x6F, 0x41, 0x4A, 0x18, 0x6C, 0x20, 0x0C, 0x18, 0x19, 0x83, 0x71, 0x30, 0x53, 0x30, 0x19, 0x40, 0x1E, 0x78, 0xFF, 0xFD, 0xDE, 0xD8, 0x1A, 0x58, 0xB6, 0x40, 0x1E, 0x48, 0x77, 0x40,
+    0xA5, 0x20, 0x84, 0x18, 0xA4, 0x18, 0xE5, 0x20, 0xEA, 0x41, 0xC5, 0x20, 0xC5, 0x20, 0xA9, 0x39, 0x07, 0x29, 0x6C, 0x4A, 0x06, 0x21, 0xE5, 0x20, 0x06, 0x21, 0x0B, 0x4A, 0xF0, 0x7B, 0x0B, 0x31, 0x74, 0x60, 0x3A, 0x80, 0x0B, 0x41, 0xD0, 0x7B, 0x47, 0x29, 0x68, 0x31, 0xE9, 0x41, 0xA8, 0x39, 0xF0, 0x7B, 0x67, 0x31, 0x47, 0x39, 0x26, 0x29, 0xE9, 0x41, 0x14, 0x8C, 0x27, 0x29, 0x27, 0x29,
+    0x28, 0x29, 0x48, 0x29, 0x34, 0x7B, 0x0A, 0x29, 0x2C, 0x31, 0xEC, 0x30, 0x7F, 0x9A, 0xFF, 0xDB, 0xB9, 0x79, 0x2E, 0x39, 0x2B, 0x31, 0xC8, 0x28, 0xF5, 0x82, 0x2A, 0x31, 0xA7, 0x18, 0xA8, 0x20, 0xA7, 0x18, 0xD4, 0x6A, 0xE7, 0x20, 0xA6, 0x18, 0xA7, 0x20, 0x87, 0x18, 0x31, 0x52, 0xA7, 0x20, 0x66, 0x18, 0xA7, 0x18, 0xA8, 0x20, 0x32, 0x5A, 0x88, 0x18, 0x88, 0x18, 0x68, 0x18, 0x69, 0x18,
+    0xD5, 0x51, 0x4B, 0x20, 0x0B, 0x18, 0x6D, 0x28, 0x4D, 0x20, 0x1F, 0x40, 0x13, 0x20, 0x13, 0x28, 0x38, 0x40, 0x1F, 0x60, 0xFF, 0xFF, 0x7F, 0xFD, 0x1F, 0x70, 0x58, 0x48, 0xBB, 0x48, 0xB6, 0x40, 0x84, 0x18, 0xA4, 0x18, 0xA4, 0x18, 0x29, 0x31, 0xE6, 0x20, 0xA5, 0x18, 0xA8, 0x20, 0xA6, 0x20, 0x08, 0x31, 0xC6, 0x20, 0xC5, 0x20, 0xE5, 0x20, 0xCA, 0x41, 0x27, 0x29, 0x08, 0x31, 0xAB, 0x30,
+    0xC7, 0x28, 0x34, 0x71, 0xEC, 0x40, 0x4E, 0x59, 0x2A, 0x31, 0x4B, 0x52, 0x46, 0x29, 0x67, 0x31, 0x47, 0x29, 0x46, 0x29, 0xA9, 0x39, 0x46, 0x31, 0x88, 0x31, 0x47, 0x29, 0x92, 0x62, 0x27, 0x29, 0x27, 0x29, 0x48, 0x29, 0x29, 0x31, 0x0A, 0x29, 0xEA, 0x28, 0x2C, 0x31, 0x96, 0x61, 0xBF, 0xD2, 0x31, 0x59, 0x0B, 0x31, 0x0A, 0x31, 0xE9, 0x28, 0xEF, 0x38, 0x2A, 0x31, 0x09, 0x29, 0xC8, 0x20,
+    0x53, 0x5A, 0x86, 0x18, 0xA7, 0x18, 0xC7, 0x18, 0xA7, 0x18, 0x87, 0x18, 0xA7, 0x18, 0x86, 0x18, 0xA7, 0x20, 0xAE, 0x49, 0xA7, 0x18, 0xA8, 0x18, 0x87, 0x18, 0x88, 0x18, 0xF2, 0x51, 0x68, 0x18, 0x69, 0x18, 0xAB, 0x28, 0x51, 0x41, 0x6B, 0x18, 0x6B, 0x18, 0x4C, 0x18, 0x4F, 0x20, 0x96, 0x51, 0x73, 0x38, 0x1A, 0x48, 0x1F, 0x78, 0x5F, 0x98, 0x19, 0x58, 0x75, 0x40, 0x94, 0x38, 0x17, 0x49,
+    0xA4, 0x18, 0x84, 0x10, 0xA4, 0x18, 0xE6, 0x20, 0x88, 0x20, 0x86, 0x18, 0xC8, 0x28, 0xA7, 0x20, 0xC8, 0x30, 0xA5, 0x20, 0xE5, 0x20, 0xC5, 0x20, 0xE6, 0x20, 0xC6, 0x20, 0x08, 0x29, 0x90, 0x50, 0x75, 0x80, 0x1F, 0xB8, 0xEA, 0x38, 0xCC, 0x48, 0x28, 0x31, 0x27, 0x29, 0x47, 0x29, 0x47, 0x29, 0x46, 0x29, 0x6B, 0x52, 0x46, 0x29, 0x47, 0x31, 0x47, 0x29, 0x47, 0x29, 0x27, 0x21, 0x07, 0x29,
+    0xE7, 0x20, 0x28, 0x31, 0x09, 0x29, 0x29, 0x29, 0xE9, 0x28, 0x0B, 0x31, 0x4E, 0x41, 0xED, 0x28, 0x2E, 0x41, 0x0A, 0x31, 0xE9, 0x28, 0x0A, 0x29, 0xA8, 0x18, 0x4A, 0x31, 0xC7, 0x20, 0xA7, 0x18, 0xA7, 0x18, 0xA7, 0x18, 0xA7, 0x18, 0x66, 0x10, 0xA7, 0x18, 0x46, 0x10, 0x87, 0x18, 0xA7, 0x20, 0xC7, 0x20, 0xC8, 0x20, 0xA8, 0x20, 0xE8, 0x28, 0xA7, 0x18, 0xA8, 0x20, 0x67, 0x10, 0x89, 0x20,
+    0x69, 0x18, 0x49, 0x18, 0x29, 0x10, 0x6B, 0x18, 0x6B, 0x18, 0x2B, 0x18, 0x2C, 0x18, 0x6E, 0x20, 0xB2, 0x30, 0x13, 0x30, 0x16, 0x38, 0x19, 0x48, 0x54, 0x40, 0x94, 0x38, 0xB4, 0x38, 0x73, 0x38, 0x63, 0x10, 0x89, 0x39, 0xC6, 0x20, 0x67, 0x20, 0x84, 0x18, 0xA6, 0x20, 0xC9, 0x39, 0x68, 0x28, 0xC5, 0x20, 0xE6, 0x20, 0xC6, 0x20, 0x27, 0x29, 0xE6, 0x20, 0xE7, 0x28, 0x0A, 0x31, 0x2B, 0x52,
+    0x36, 0x70, 0x3E, 0xC8, 0x27, 0x31, 0x50, 0x61, 0x6B, 0x52, 0xEE, 0x62, 0x06, 0x29, 0x47, 0x31, 0x47, 0x29, 0x4E, 0x5A, 0x26, 0x29, 0x26, 0x29, 0x47, 0x29, 0x06, 0x29, 0x27, 0x21, 0x07, 0x21, 0xE7, 0x20, 0x48, 0x29, 0xD0, 0x59, 0x2A, 0x29, 0x2B, 0x31, 0x0A, 0x29, 0x51, 0x62, 0xD1, 0x49, 0x2C, 0x39, 0x4A, 0x39, 0x09, 0x29, 0xE9, 0x28, 0xBB, 0x92, 0xC8, 0x20, 0xA7, 0x18, 0xA7, 0x18,
+    0xA6, 0x18, 0x50, 0x52, 0xA7, 0x18, 0x66, 0x10, 0xA6, 0x18, 0x87, 0x18, 0x86, 0x18, 0x4A, 0x39, 0xA7, 0x20, 0xE8, 0x28, 0xF1, 0x49, 0x08, 0x31, 0xE8, 0x28, 0xA8, 0x20, 0xA7, 0x18, 0xD3, 0x51, 0x69, 0x18, 0x8A, 0x18, 0x6A, 0x18, 0x49, 0x18, 0x11, 0x39, 0x4B, 0x18, 0x2B, 0x18, 0x6D, 0x20, 0x0D, 0x18, 0x11, 0x28, 0x31, 0x28, 0xB4, 0x40, 0x71, 0x30, 0xD2, 0x30, 0xB2, 0x38, 0xB1, 0x30,
+    0xA4, 0x18, 0x84, 0x18, 0xA5, 0x18, 0xA5, 0x18, 0x64, 0x10, 0x86, 0x20, 0x8B, 0x30, 0x68, 0x28, 0x2B, 0x41, 0xA7, 0x20, 0xC5, 0x20, 0xC5, 0x20, 0xE7, 0x28, 0x29, 0x31, 0xEB, 0x38, 0x34, 0x78, 0x1A, 0x70, 0x1F, 0xD8, 0x0A, 0x49, 0xCC, 0x48, 0xCE, 0x50, 0xE8, 0x28, 0x27, 0x29, 0x06, 0x21, 0x06, 0x29, 0x26, 0x29, 0x88, 0x41, 0x69, 0x8A, 0x67, 0x31, 0x47, 0x31, 0x07, 0x21, 0x27, 0x29,
+    0x07, 0x21, 0x49, 0x29, 0x29, 0x29, 0x09, 0x29, 0x2A, 0x31, 0x2B, 0x31, 0x6D, 0x41, 0x0C, 0x31, 0xCE, 0x69, 0x6B, 0x41, 0x09, 0x31, 0xC9, 0x20, 0xF9, 0xAC, 0xC8, 0x20, 0xA7, 0x18, 0xA7, 0x18, 0xC7, 0x20, 0xD0, 0x62, 0xC7, 0x18, 0xA6, 0x18, 0x08, 0x29, 0xA6, 0x18, 0x11, 0x6B, 0xA6, 0x18, 0xA6, 0x20, 0x27, 0x29, 0xA7, 0x18, 0x89, 0x41, 0x49, 0x39, 0xE8, 0x28, 0xA8, 0x20, 0x88, 0x18,
+    0x28, 0x10, 0x89, 0x18, 0x69, 0x18, 0x89, 0x18, 0x0A, 0x10, 0x4A, 0x20, 0x4A, 0x18, 0x6C, 0x20, 0x4C, 0x18, 0x0F, 0x20, 0xDA, 0x50, 0x92, 0x30, 0x70, 0x28, 0x8F, 0x28, 0xD1, 0x30, 0xD1, 0x30, 0xA4, 0x18, 0xA5, 0x18, 0xE6, 0x20, 0xC5, 0x20, 0xC9, 0x39, 0x86, 0x20, 0x84, 0x18, 0xA7, 0x28, 0xE8, 0x28, 0x6C, 0x52, 0xC6, 0x20, 0x85, 0x18, 0xE7, 0x28, 0xC6, 0x20, 0x6B, 0x52, 0x89, 0x28,
+    0x1C, 0x98, 0x1F, 0xC8, 0x87, 0x28, 0xCC, 0x5A, 0xC7, 0x20, 0x08, 0x29, 0x08, 0x29, 0x06, 0x29, 0xAD, 0x52, 0x26, 0x29, 0xE8, 0x59, 0x2C, 0xF4, 0x27, 0x31, 0x11, 0x6B, 0x07, 0x29, 0x07, 0x29, 0x07, 0x21, 0x28, 0x29, 0xF4, 0x7A, 0x2A, 0x31, 0x8C, 0x49, 0x4D, 0x39, 0xEF, 0x38, 0xB2, 0x62, 0x97, 0x69, 0x8E, 0x49, 0x0A, 0x31, 0x6B, 0x39, 0xB4, 0x7A, 0xC8, 0x20, 0x87, 0x18, 0xC7, 0x20,
+    0xA7, 0x18, 0x53, 0x5A, 0xA6, 0x18, 0xA7, 0x18, 0xE8, 0x20, 0x86, 0x18, 0xB0, 0x41, 0x86, 0x10, 0xC7, 0x20, 0x88, 0x39, 0x08, 0x29, 0xCF, 0x51, 0x89, 0x41, 0xC7, 0x20, 0xA8, 0x20, 0x67, 0x18, 0x36, 0x49, 0x68, 0x18, 0x89, 0x20, 0x89, 0x18, 0x69, 0x18, 0xDC, 0x50, 0x6B, 0x20, 0x6B, 0x20, 0x4B, 0x18, 0x4D, 0x20, 0x9A, 0x50, 0x8F, 0x28, 0x6E, 0x20, 0xD0, 0x30, 0xAF, 0x28, 0xD0, 0x30,
 };
 const lv_img_dsc_t ui_img_twinkels2_80_png = {
     .header.always_zero = 0,
     .header.w = 80,
     .header.h = 80,
     .data_size = sizeof(ui_img_twinkels2_80_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
     .data = ui_img_twinkels2_80_png_data
 };
 
@@ -1,58 +1,160 @@
 #include <Arduino.h>
 
+#include "core/Alloc.h"
+#include "core/Boot.h"
+#include "core/Bus.h"
 #include "core/Config.h"
+#include "core/DrawList.h"
 #include "core/ESP8266.h"
+#include "core/Footprint.h"
 #include "core/LCD.h"
+#include "core/Log.h"
+#include "core/Latency.h"
+#include "core/Mic.h"
+#include "core/Net.h"
+#include "core/Outbox.h"
+#include "core/Recorder.h"
+#include "core/Replay.h"
+#include "core/Rotor.h"
+#include "core/Scheduler.h"
+#include "core/Sync.h"
+#include "core/Tasks.h"
+#include "core/Telemetry.h"
+#include "core/Transpose.h"
+#include "core/USB.h"
+#include "core/Voxels.h"
 #include "space/animation.h"
 /*------------------------------------------------------------------------------
  * Globals
  *----------------------------------------------------------------------------*/
 Config config;
+// Constant initialized, so it stays in flash
+PROGMEM constexpr Settings defaults{};
+/*------------------------------------------------------------------------------
+ * Boot stages, the reports once the boot is done
+ *----------------------------------------------------------------------------*/
+static void boot() {
+  if (!Boot::loop()) return;
+  static char times[256];
+  Boot::report(times, sizeof(times));
+  Serial.println(times);
+  // Where the RAM went, the stack as deep as the boot took it
+  static char memory[2048];
+  Footprint::report(memory, sizeof(memory));
+  Serial.println(memory);
+  Footprint::report_animations(memory, sizeof(memory));
+  Serial.println(memory);
+}
+/*------------------------------------------------------------------------------
+ * Statistics to the console and the ESP8266 every print interval
+ *----------------------------------------------------------------------------*/
+static void report() {
+  // Print FPS once every x seconds
+  static Timer print_interval = 10.0f;
+  // Print the animation draw profile once every x seconds
+  static Timer profile_interval = 120.0f;
+
+  if (print_interval.update()) {
+    static char frames[512];
+    Scheduler::log();
+    DrawList::log();
+    Bus::report(frames, sizeof(frames));
+    Serial.println(frames);
+    Tasks::report(frames, sizeof(frames));
+    Serial.println(frames);
+#if defined CUBE_ALLOC_TRACE
+    Alloc::report(frames, sizeof(frames));
+    Serial.println(frames);
+#endif
+    // Snapshot of the window that ends here, for the ESP8266 and the LCD
+    Telemetry::sample();
+    Telemetry::publish();
+    Scheduler::reset();
+    DrawList::reset();
+    Tasks::reset();
+#if defined LCD_TUNING
+    LCD::report(frames, sizeof(frames));
+    Serial.println(frames);
+#endif
+  }
+  if (profile_interval.update()) Animation::dump_profile();
+}
+/*------------------------------------------------------------------------------
+ * The main loop, budgets in microseconds (see Tasks.h)
+ *----------------------------------------------------------------------------*/
+static Tasks::task_t tasks[] = {
+    // Frame submission and the dma buffers, then the SPI queue before its
+    // clients
+    {"animation", Animation::loop, Tasks::FRAME, 16000},
+    {"bus", Bus::loop, Tasks::FRAME, 50},
+    // Input of the links, and output to the ESP8266 without waiting
+    {"link", ESP8266::loop, Tasks::RECEIVE, 1000},
+    {"net", Net::loop, Tasks::RECEIVE, 2000},
+    {"outbox", Outbox::drain, Tasks::RECEIVE, 100},
+    {"latency", Latency::loop, Tasks::RECEIVE, 100},
+    {"mic", Mic::loop, Tasks::RECEIVE, 300},
+    // In the slack before the next frame
+    {"boot", boot, Tasks::BACKGROUND, 20000},
+    {"lcd", LCD::loop, Tasks::BACKGROUND, 8000},
+    {"config", [] { config.loop(); }, Tasks::BACKGROUND, 10000},
+    {"rotor", Rotor::loop, Tasks::BACKGROUND, 100},
+    {"sync", Sync::loop, Tasks::BACKGROUND, 200},
+    {"esp8266", ESP8266::update, Tasks::BACKGROUND, 1000},
+    // SD card slices, when the bus is theirs
+    {"recorder", Recorder::loop, Tasks::BACKGROUND, 3000},
+    {"replay", Replay::loop, Tasks::BACKGROUND, 3000},
+    {"report", report, Tasks::BACKGROUND, 5000},
+    {"log", Log::loop, Tasks::BACKGROUND, 500},
+};
 /*------------------------------------------------------------------------------
  * Initialize setup parameters
  *----------------------------------------------------------------------------*/
 void setup() {
   // Start with clearing blue leds asap
   Animation::begin();
+  // Before the first message
+  Log::begin();
+  // Mark the free stack before it is used, for the high watermark
+  Footprint::paint();
+  // Settings from flash, a current snapshot only takes a memcpy
+  config.load();
   // Safety delay in case of code crash
   // delay(5000);
   // Serial output to usb for console display
   Serial.begin(115200);
-  // ESP8266 UART baudrate on Hardware Serial1
-  Serial1.begin(460800);
-  // Prevents RX buffer overflow if not reading fast enough
-  DMAMEM static char read_buffer[4096];
-  Serial1.addMemoryForRead(read_buffer, sizeof(read_buffer));
-  // Prevents TX buffer overflow and blocking the program
-  DMAMEM static char write_buffer[1024];
-  Serial1.addMemoryForWrite(write_buffer, sizeof(write_buffer));
-  // Request time from Internet, the UART or Internet might fail
-  ESP8266::request_time();
-  // Start the LCD driver
-  LCD::begin();
+#if defined CUBE_PSRAM
+  // The BULKMEM buffers are in PSRAM, a board without the chip faults on them
+  if (!external_psram_size) Serial.println("No PSRAM on this Teensy 4.1");
+#endif
+#if defined TRANSPOSE_BENCH
+  // Cycles per frame of the transpose variants
+  while (!Serial && millis() < 3000) {
+  }
+  Transpose::benchmark();
+#endif
+  // Black streaming frames until the first one arrives
+  Voxels::begin();
+  // ESP8266 link on Hardware Serial1, it moves up to a faster rate later
+  ESP8266::begin();
+  // Motor of the rotating base and its index sensor, or the microphone on
+  // their pins
+  Rotor::begin();
+  Mic::begin();
+  // The time, the calibration and the LCD come up over the first frames, see
+  // Boot.h
+  Boot::begin();
+  Tasks::begin(tasks, sizeof(tasks) / sizeof(tasks[0]));
 }
+/*------------------------------------------------------------------------------
+ * Serial1 input, called from yield() between loops and while blocking. Only
+ * the device samples, the commands wait for the link task.
+ *----------------------------------------------------------------------------*/
+void serialEvent1() { ESP8266::receive(); }
+/*------------------------------------------------------------------------------
+ * USB input, voxel frames and commands of a host
+ *----------------------------------------------------------------------------*/
+void serialEvent() { USB::loop(); }
 /*------------------------------------------------------------------------------
  * Start the main loop
  *----------------------------------------------------------------------------*/
-void loop() {
-  // Print FPS once every x seconds
-  static Timer print_interval = 10.0f;
-
-  Animation::loop();
-  ESP8266::loop();
-  LCD::loop();
-
-  if (print_interval.update()) {
-    static char fps[20];
-    sprintf(fps, "FPS=%1.2f", Animation::fps());
-    Serial.println(fps);
-    // Serial1.print(fps);
-    // Serial1.print("\xf8\xfa");
-    //  Serial1.flush();
-    //   Testing connection from teensy to esp to wio terminal
-    //   Send end esp and end wio commands to reset bit errors
-    // static uint8_t byte = 0;
-    // Serial1.printf("\xf8%02X ", byte++);
-    // Serial1.flush();
-  }
-}
\ No newline at end of file
+void loop() { Tasks::loop(); }
@@ -0,0 +1,58 @@
+#ifndef AGENTPOOL_H
+#define AGENTPOOL_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * AGENTPOOL CLASS
+ *------------------------------------------------------------------------------
+ * Fixed pool of N agents of any type. The live agents are always the first
+ * count() entries, an agent that dies is replaced by the last live one, so
+ * updates never skip inactive slots and no slot has an active flag. Spawns
+ * go into a ring buffer of Q agents and join the pool on the next update,
+ * they wait in the queue while the pool is full.
+ *
+ * AgentPool<Drop, 80> drops;
+ * drops.spawn(Drop{...});                   // false when the queue is full
+ * drops.update([&](Drop &d) { ... });       // return false when d dies
+ *----------------------------------------------------------------------------*/
+template <typename T, uint16_t N, uint8_t Q = 16>
+class AgentPool {
+ public:
+  void clear() {
+    m_count = 0;
+    m_head = m_tail = 0;
+  }
+
+  bool spawn(const T &agent) {
+    const uint8_t next = (m_tail + 1) % Q;
+    if (next == m_head) return false;
+    m_queue[m_tail] = agent;
+    m_tail = next;
+    return true;
+  }
+
+  // Move the queued agents into the pool and update every live agent
+  template <typename F>
+  void update(F visit) {
+    while (m_head != m_tail && m_count < N) {
+      m_agents[m_count++] = m_queue[m_head];
+      m_head = (m_head + 1) % Q;
+    }
+    for (uint16_t i = 0; i < m_count;) {
+      if (visit(m_agents[i]))
+        i++;
+      else
+        m_agents[i] = m_agents[--m_count];
+    }
+  }
+
+  uint16_t count() const { return m_count; }
+  T &operator[](const uint16_t i) { return m_agents[i]; }
+
+ private:
+  T m_agents[N];
+  T m_queue[Q];
+  uint16_t m_count = 0;
+  uint8_t m_head = 0;
+  uint8_t m_tail = 0;
+};
+#endif
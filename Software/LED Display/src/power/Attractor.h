@@ -0,0 +1,129 @@
+#ifndef ATTRACTOR_H
+#define ATTRACTOR_H
+#include <math.h>
+#include <stdint.h>
+
+#include "Math3D.h"
+/*------------------------------------------------------------------------------
+ * ATTRACTOR CLASS
+ *------------------------------------------------------------------------------
+ * A strange attractor integrated with RK4 at RATE steps per second whatever
+ * the frame rate, its trail kept in a ring of the last N points. The system
+ * is an equation functor: its derivative, the step of an integration, the
+ * start and the view that maps it into the cube (-7.5 to 7.5). The ring
+ * only holds the viewed points, so the systems share it and the trail can
+ * be faded by the age of a point instead of updating every point.
+ *
+ * A larger stride takes fewer and longer steps, for a lower quality.
+ *
+ * Attractor<500> trail;
+ * trail.reset(LorenzSystem());
+ * trail.advance(LorenzSystem(), dt);
+ * trail.each([&](const Vector3 &p, uint16_t age) { splat_aa(p, fade[age]); });
+ *----------------------------------------------------------------------------*/
+template <uint16_t N>
+class Attractor {
+ public:
+  static const uint16_t CAPACITY = N;
+  // Integration steps per second
+  static const uint16_t RATE = 240;
+
+  template <typename E>
+  void reset(const E &e) {
+    m_p = e.start();
+    m_head = 0;
+    m_count = 0;
+    m_due = 0;
+  }
+
+  // Take the steps due after dt seconds, at most a ring full
+  template <typename E>
+  void advance(const E &e, const float dt, const uint8_t stride = 1) {
+    m_due += dt * RATE;
+    if (m_due > N * stride) m_due = N * stride;
+    const float h = E::STEP * stride;
+    while (m_due >= stride) {
+      m_due -= stride;
+      const Vector3 k1 = e(m_p);
+      const Vector3 k2 = e(m_p + k1 * (h / 2));
+      const Vector3 k3 = e(m_p + k2 * (h / 2));
+      const Vector3 k4 = e(m_p + k3 * h);
+      m_p += (k1 + (k2 + k3) * 2 + k4) * (h / 6);
+      m_trail[m_head] = e.view(m_p);
+      m_head = m_head + 1 == N ? 0 : m_head + 1;
+      if (m_count < N) m_count++;
+    }
+  }
+
+  uint16_t count() const { return m_count; }
+
+  // Every point oldest first with its age, 0 is the newest
+  template <typename F>
+  void each(F f) const {
+    uint16_t i = (m_head + N - m_count) % N;
+    for (uint16_t age = m_count; age-- > 0; i = i + 1 == N ? 0 : i + 1)
+      f(m_trail[i], age);
+  }
+
+ private:
+  Vector3 m_p;
+  Vector3 m_trail[N];
+  uint16_t m_head = 0;
+  uint16_t m_count = 0;
+  // Steps due, with the fraction left of the last frame
+  float m_due = 0;
+};
+
+// sigma 10, rho 28, beta 8/3
+struct LorenzSystem {
+  static constexpr float STEP = 0.005f;
+  Vector3 start() const { return Vector3(1, 1, 1); }
+  Vector3 operator()(const Vector3 &p) const {
+    return Vector3(10 * (p.y - p.x), p.x * (28 - p.z) - p.y,
+                   p.x * p.y - 8.0f / 3 * p.z);
+  }
+  Vector3 view(const Vector3 &p) const {
+    return Vector3(p.x * 0.3f, (p.z - 25) * 0.24f, p.y * 0.3f);
+  }
+};
+
+// a 0.2, b 0.2, c 5.7
+struct RosslerSystem {
+  static constexpr float STEP = 0.025f;
+  Vector3 start() const { return Vector3(1, 1, 0); }
+  Vector3 operator()(const Vector3 &p) const {
+    return Vector3(-p.y - p.z, p.x + 0.2f * p.y, 0.2f + p.z * (p.x - 5.7f));
+  }
+  Vector3 view(const Vector3 &p) const {
+    return Vector3(p.x * 0.5f, p.z * 0.5f - 5, p.y * 0.5f);
+  }
+};
+
+// b 0.208186, cyclically symmetric
+struct ThomasSystem {
+  static constexpr float STEP = 0.06f;
+  Vector3 start() const { return Vector3(0.1f, 0, 0); }
+  Vector3 operator()(const Vector3 &p) const {
+    const float b = 0.208186f;
+    return Vector3(sinf(p.y) - b * p.x, sinf(p.z) - b * p.y,
+                   sinf(p.x) - b * p.z);
+  }
+  Vector3 view(const Vector3 &p) const { return p * 1.3f; }
+};
+
+// a 0.95, b 0.7, c 0.6, d 3.5, e 0.25, f 0.1
+struct AizawaSystem {
+  static constexpr float STEP = 0.01f;
+  Vector3 start() const { return Vector3(0.1f, 0, 0); }
+  Vector3 operator()(const Vector3 &p) const {
+    const float r2 = p.x * p.x + p.y * p.y;
+    return Vector3((p.z - 0.7f) * p.x - 3.5f * p.y,
+                   3.5f * p.x + (p.z - 0.7f) * p.y,
+                   0.6f + 0.95f * p.z - p.z * p.z * p.z / 3 -
+                       r2 * (1 + 0.25f * p.z) + 0.1f * p.z * p.x * p.x * p.x);
+  }
+  Vector3 view(const Vector3 &p) const {
+    return Vector3(p.x * 4, (p.z - 0.7f) * 4, p.y * 4);
+  }
+};
+#endif
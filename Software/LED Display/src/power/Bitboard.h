@@ -0,0 +1,84 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+#include <stdint.h>
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * BITBOARD CLASS
+ *------------------------------------------------------------------------------
+ * A set of voxels as 16x16 columns of 16 bits, bit z of column[x][y] like
+ * the cells of space/Life.h. A breadth first search moves a whole front at
+ * a time: the neighbours along z are the column shifted by one, along x and
+ * y the columns beside it, so a step is a few shifts and ors per column and
+ * a full distance map of the cube costs about 256 words per distance.
+ *
+ * flood() visits the fronts at every distance from the voxels of the board
+ * through the free ones, until the visitor returns true or nothing new can
+ * be reached, and returns the last distance.
+ *
+ * Bitboard free, start;
+ * start.set(x, y, z);
+ * start.flood(free, [&](const Bitboard &front, uint8_t distance) {
+ *   return front.get(fx, fy, fz);
+ * });
+ *----------------------------------------------------------------------------*/
+class Bitboard {
+ public:
+  uint16_t column[16][16];
+
+  void clear() { memset(column, 0, sizeof(column)); }
+  void fill() { memset(column, 0xFF, sizeof(column)); }
+  bool get(const uint8_t x, const uint8_t y, const uint8_t z) const {
+    return column[x][y] >> z & 1;
+  }
+  void set(const uint8_t x, const uint8_t y, const uint8_t z) {
+    column[x][y] |= 1 << z;
+  }
+  void reset(const uint8_t x, const uint8_t y, const uint8_t z) {
+    column[x][y] &= ~(1 << z);
+  }
+  // Voxels set
+  uint16_t count() const {
+    uint16_t n = 0;
+    for (uint8_t x = 0; x < 16; x++)
+      for (uint8_t y = 0; y < 16; y++) n += __builtin_popcount(column[x][y]);
+    return n;
+  }
+  // Voxels that are not set
+  void invert(Bitboard &out) const {
+    for (uint8_t x = 0; x < 16; x++)
+      for (uint8_t y = 0; y < 16; y++) out.column[x][y] = ~column[x][y];
+  }
+
+  // The neighbours of this front along the axes that are free and not seen,
+  // added to seen, false if there are none
+  bool expand(const Bitboard &free, Bitboard &seen, Bitboard &next) const {
+    static const uint16_t none[16] = {0};
+    uint16_t any = 0;
+    for (uint8_t x = 0; x < 16; x++) {
+      const uint16_t *c = column[x];
+      const uint16_t *l = x > 0 ? column[x - 1] : none;
+      const uint16_t *r = x < 15 ? column[x + 1] : none;
+      for (uint8_t y = 0; y < 16; y++) {
+        uint16_t n = c[y] << 1 | c[y] >> 1 | l[y] | r[y];
+        if (y > 0) n |= c[y - 1];
+        if (y < 15) n |= c[y + 1];
+        n &= free.column[x][y] & ~seen.column[x][y];
+        next.column[x][y] = n;
+        seen.column[x][y] |= n;
+        any |= n;
+      }
+    }
+    return any;
+  }
+
+  template <typename F>
+  uint8_t flood(const Bitboard &free, F visit) const {
+    Bitboard seen = *this, front = *this, next;
+    for (uint8_t distance = 0;; distance++) {
+      if (visit(front, distance)) return distance;
+      if (!front.expand(free, seen, next)) return distance;
+      memcpy(front.column, next.column, sizeof(column));
+    }
+  }
+};
+#endif
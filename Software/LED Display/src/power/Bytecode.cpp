@@ -0,0 +1,115 @@
+#include "Bytecode.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "FastTrig.h"
+/*------------------------------------------------------------------------------
+ * BYTECODE CLASS
+ *----------------------------------------------------------------------------*/
+static const PaletteLUT *const luts[Bytecode::PALETTES] = {
+    &RainbowGradientLUT, &SunsetRealLUT, &LavaLUT};
+
+bool Bytecode::load(const uint8_t *data, const uint16_t size) {
+  if (size < 8 || memcmp(data, "MVM1", 4) != 0) return false;
+  const uint8_t palette = data[4];
+  const uint8_t constants = data[5];
+  const uint16_t count = data[6] | data[7] << 8;
+  if (palette >= PALETTES || constants > CONSTANTS || count == 0 ||
+      count > BUDGET || size != 8 + constants * 4 + count * 4)
+    return false;
+  const instruction_t *code = (const instruction_t *)&data[8 + constants * 4];
+  for (uint8_t i = 0; i < count; i++) {
+    const instruction_t &in = code[i];
+    const uint8_t a = in.op == CONST ? constants : in.op == NOISE ? REGISTERS - 2
+                                                                  : REGISTERS;
+    if (in.op >= OPS || in.dst >= REGISTERS || in.a >= a || in.b >= REGISTERS)
+      return false;
+  }
+  m_palette = palette;
+  memcpy(m_constants, &data[8], constants * 4);
+  memcpy(m_code, code, count * 4);
+  memset(m_reg, 0, sizeof(m_reg));
+  m_count = count;
+  return true;
+}
+
+uint16_t Bytecode::run(const uint8_t x, const uint8_t y, const float t,
+                       const uint8_t brightness, Color *row) {
+  uint16_t lit = 0;
+  for (uint8_t i = 0; i < LANES; i++) {
+    m_reg[X][i] = x - 7.5f;
+    m_reg[Y][i] = y - 7.5f;
+    m_reg[Z][i] = i - 7.5f;
+    m_reg[T][i] = t;
+  }
+  for (uint8_t pc = 0; pc < m_count; pc++) {
+    const instruction_t in = m_code[pc];
+    float *d = m_reg[in.dst];
+    const float *a = m_reg[in.a];
+    const float *b = m_reg[in.b];
+    switch (in.op) {
+      case MOV:
+        memmove(d, a, sizeof(m_reg[0]));
+        break;
+      case CONST:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = m_constants[in.a];
+        break;
+      case ADD:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = a[i] + b[i];
+        break;
+      case SUB:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = a[i] - b[i];
+        break;
+      case MUL:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = a[i] * b[i];
+        break;
+      case DIV:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = b[i] ? a[i] / b[i] : 0;
+        break;
+      case MAD:
+        for (uint8_t i = 0; i < LANES; i++) d[i] += a[i] * b[i];
+        break;
+      case MIN:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = a[i] < b[i] ? a[i] : b[i];
+        break;
+      case MAX:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = a[i] > b[i] ? a[i] : b[i];
+        break;
+      case ABS:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = fabsf(a[i]);
+        break;
+      case FLOOR:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = floorf(a[i]);
+        break;
+      case FRACT:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = a[i] - floorf(a[i]);
+        break;
+      case SQRT:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = a[i] > 0 ? sqrtf(a[i]) : 0;
+        break;
+      case SIN:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = fsin(a[i]);
+        break;
+      case COS:
+        for (uint8_t i = 0; i < LANES; i++) d[i] = fcos(a[i]);
+        break;
+      case NOISE:
+        for (uint8_t i = 0; i < LANES; i++)
+          d[i] = m_noise.noise3(a[i], a[i + LANES], a[i + 2 * LANES]);
+        break;
+      case OUT:
+        lit = 0;
+        for (uint8_t i = 0; i < LANES; i++) {
+          const float v = b[i] < 1 ? b[i] : 1;
+          if (!(v > 0)) continue;
+          const uint8_t position = (a[i] - floorf(a[i])) * 255;
+          row[i] = Color::fromLUT(position, *luts[m_palette])
+                       .scale(v * brightness);
+          lit |= 1 << i;
+        }
+        break;
+    }
+  }
+  return lit;
+}
@@ -0,0 +1,86 @@
+#ifndef BYTECODE_H
+#define BYTECODE_H
+#include <stdint.h>
+
+#include "Color.h"
+#include "Noise.h"
+/*------------------------------------------------------------------------------
+ * BYTECODE CLASS
+ *------------------------------------------------------------------------------
+ * A small register machine for voxel shaders uploaded at runtime (see
+ * space/Program.h). A program runs once per row of 16 voxels along z and
+ * every register holds a value for each voxel of the row, so an instruction
+ * does 16 operations and its dispatch is paid once for all of them.
+ *
+ * Registers X, Y and Z start as the coordinates relative to the center of the
+ * cube (-7.5 to 7.5) and T as the time in seconds, the others at zero. There
+ * are no jumps, the cost of a frame is known when a program is loaded and a
+ * program of more than BUDGET instructions per row is rejected.
+ *
+ * A program is a header, its constants and its code, little endian:
+ *
+ *   "MVM1", palette, constants, instructions (uint16),
+ *   constants * float, instructions * {op, dst, a, b}
+ *
+ * OUT takes the palette position from register a (a turn per 1.0) and the
+ * brightness from register b (0 to 1), voxels without brightness are not
+ * drawn. The palette is one of PALETTES.
+ *
+ * Bytecode vm;
+ * if (!vm.load(data, size)) return;
+ * uint16_t lit = vm.run(x, y, t, brightness, row);  // row of 16 colors
+ *----------------------------------------------------------------------------*/
+class Bytecode {
+ public:
+  static const uint8_t LANES = 16;
+  static const uint8_t REGISTERS = 16;
+  static const uint8_t CONSTANTS = 32;
+  // Instructions per row, 16384 per frame
+  static const uint8_t BUDGET = 64;
+  static const uint8_t PALETTES = 3;
+  // Largest program in bytes
+  static const uint16_t SIZE = 8 + CONSTANTS * 4 + BUDGET * 4;
+
+  enum reg_t : uint8_t { X = 0, Y = 1, Z = 2, T = 3 };
+
+  enum op_t : uint8_t {
+    MOV,    // dst = a
+    CONST,  // dst = constant a
+    ADD,    // dst = a + b
+    SUB,    // dst = a - b
+    MUL,    // dst = a * b
+    DIV,    // dst = a / b
+    MAD,    // dst += a * b
+    MIN,    // dst = min(a, b)
+    MAX,    // dst = max(a, b)
+    ABS,    // dst = |a|
+    FLOOR,  // dst = floor(a)
+    FRACT,  // dst = a - floor(a)
+    SQRT,   // dst = sqrt(max(a, 0))
+    SIN,    // dst = sin(a)
+    COS,    // dst = cos(a)
+    NOISE,  // dst = noise3(a, a + 1, a + 2), 0 to 1
+    OUT,    // palette position a, brightness b
+    OPS
+  };
+
+  // Validate and take a program, keeps the last one when it is invalid
+  bool load(const uint8_t *data, const uint16_t size);
+  bool loaded() const { return m_count > 0; }
+  // Shade row x, y at time t, returns the mask of the voxels lit
+  uint16_t run(const uint8_t x, const uint8_t y, const float t,
+               const uint8_t brightness, Color *row);
+
+ private:
+  struct instruction_t {
+    uint8_t op, dst, a, b;
+  };
+
+  uint8_t m_palette = 0;
+  uint8_t m_count = 0;
+  float m_constants[CONSTANTS];
+  instruction_t m_code[BUDGET];
+  float m_reg[REGISTERS][LANES];
+  Noise m_noise;
+};
+#endif
@@ -3,6 +3,8 @@
 #include <Arduino.h>
 
 #include "Math8.h"
+#include "Memory.h"
+#include "Noise.h"
 /*------------------------------------------------------------------------------
  * Color CLASS
  *----------------------------------------------------------------------------*/
@@ -23,27 +25,36 @@ Color::Color(const uint8_t red_, const uint8_t green_, const uint8_t blue_) {
 }
 // Create a random color with red, green and blue between min and max inclusive
 Color::Color(const uint8_t min, const uint8_t max) {
-  red = random(min, max + 1);
-  green = random(min, max + 1);
-  blue = random(min, max + 1);
+  red = Noise::nextRandom16(min, max);
+  green = Noise::nextRandom16(min, max);
+  blue = Noise::nextRandom16(min, max);
 }
-// Create a color from a color pallete, by interpolating between entries
-Color::Color(const uint8_t index, const uint8_t* pallete) {
+// Interpolate between the entries of a color pallete
+static void interpolate(Color& c, const uint8_t index, const uint8_t* pallete) {
   uint8_t i = 0;
   while (index > pallete[i]) i += 4;
   if (pallete[i] != index) {
-    red = map8(index, pallete[i - 4], pallete[i], pallete[i + 1 - 4],
-               pallete[i + 1]);
-    green = map8(index, pallete[i - 4], pallete[i], pallete[i + 2 - 4],
-                 pallete[i + 2]);
-    blue = map8(index, pallete[i - 4], pallete[i], pallete[i + 3 - 4],
-                pallete[i + 3]);
+    c.red = map8(index, pallete[i - 4], pallete[i], pallete[i + 1 - 4],
+                 pallete[i + 1]);
+    c.green = map8(index, pallete[i - 4], pallete[i], pallete[i + 2 - 4],
+                   pallete[i + 2]);
+    c.blue = map8(index, pallete[i - 4], pallete[i], pallete[i + 3 - 4],
+                  pallete[i + 3]);
   } else {
-    red = pallete[i + 1];
-    green = pallete[i + 2];
-    blue = pallete[i + 3];
+    c.red = pallete[i + 1];
+    c.green = pallete[i + 2];
+    c.blue = pallete[i + 3];
   }
 }
+// Create a color from a color pallete, by interpolating between entries or
+// from its lookup table when the pallete is expanded
+Color::Color(const uint8_t index, const uint8_t* pallete) {
+  const PaletteLUT* lut = PaletteLUT::find(pallete);
+  if (lut)
+    *this = lut->color[index];
+  else
+    interpolate(*this, index, pallete);
+}
 // Create a color between source and target. Scaler determine how much between
 // scalar = 000 -> source
 // scalar = 200 -> (55/256)% source + (200/256)% target
@@ -78,6 +89,13 @@ Color& Color::maximize(const Color& c) {
   b = max(blue, c.blue);
   return *this;
 }
+// Filters a color by another color, white keeps it and black removes it
+Color& Color::multiply(const Color& c) {
+  r = map8(c.r, r);
+  g = map8(c.g, g);
+  b = map8(c.b, b);
+  return *this;
+}
 bool Color::isBlack() const { return (r | g | b) == 0; }
 bool Color::operator==(const Color& c) const {
   return ((red == c.r) & (green == c.g) & (blue == c.b));
@@ -146,7 +164,7 @@ const uint8_t Color::GAMMA[256] = {
 
 // Color gradient Palletes, starts with an index and than red, green, blue
 // The first index starts at 0 and must increase and the last must be 255
-uint8_t RainbowGradientPalette[] = {
+HOTMEM uint8_t RainbowGradientPalette[] = {
     0,   255, 0,   0,    // Red
     32,  171, 85,  0,    // Orange
     64,  171, 171, 0,    // Yellow
@@ -158,7 +176,7 @@ uint8_t RainbowGradientPalette[] = {
     255, 255, 0,   0     // and back to Red
 };
 
-uint8_t SunsetRealPalette[] = {
+HOTMEM uint8_t SunsetRealPalette[] = {
     0,   120, 0,   0,    //
     22,  179, 22,  0,    //
     51,  255, 104, 0,    //
@@ -168,7 +186,7 @@ uint8_t SunsetRealPalette[] = {
     255, 0,   0,   160   //
 };
 
-uint8_t LavaPalette[] = {
+HOTMEM uint8_t LavaPalette[] = {
     0,   0,   0,   0,   //
     46,  18,  0,   0,   //
     96,  113, 0,   0,   //
@@ -182,4 +200,27 @@ uint8_t LavaPalette[] = {
     234, 255, 255, 4,   //
     244, 255, 255, 71,  //
     255, 255, 255, 255  //
-};
\ No newline at end of file
+};
+
+/*------------------------------------------------------------------------------
+ * PaletteLUT CLASS
+ *----------------------------------------------------------------------------*/
+PaletteLUT* PaletteLUT::first = 0;
+
+PaletteLUT RainbowGradientLUT(RainbowGradientPalette);
+PaletteLUT SunsetRealLUT(SunsetRealPalette);
+PaletteLUT LavaLUT(LavaPalette);
+
+PaletteLUT::PaletteLUT(const uint8_t* pallete) : m_pallete(pallete) {
+  update();
+  m_next = first;
+  first = this;
+}
+void PaletteLUT::update() {
+  for (uint16_t i = 0; i < 256; i++) interpolate(color[i], i, m_pallete);
+}
+const PaletteLUT* PaletteLUT::find(const uint8_t* pallete) {
+  for (const PaletteLUT* lut = first; lut; lut = lut->m_next)
+    if (lut->m_pallete == pallete) return lut;
+  return 0;
+}
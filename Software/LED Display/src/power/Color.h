@@ -7,6 +7,11 @@
 extern uint8_t RainbowGradientPalette[];
 extern uint8_t SunsetRealPalette[];
 extern uint8_t LavaPalette[];
+
+class PaletteLUT;
+extern PaletteLUT RainbowGradientLUT;
+extern PaletteLUT SunsetRealLUT;
+extern PaletteLUT LavaLUT;
 /*---------------------------------------------------------------------------------------
  * Color CLASS
  *---------------------------------------------------------------------------------------
@@ -51,11 +56,14 @@ class Color {
   Color(const uint8_t min, const uint8_t max);
   Color(const uint8_t index, const uint8_t* pallete);
   Color(const uint8_t scalar, const Color& source, const Color& target);
+  // Color from an expanded palette, a single table lookup
+  static Color fromLUT(const uint8_t index, const PaletteLUT& lut);
 
   Color& scale(const uint8_t scalar);
   Color scaled(const uint8_t scalar) const;
   Color& blend(const uint8_t scalar, const Color& target);
   Color& maximize(const Color& c);
+  Color& multiply(const Color& c);
 
   Color& gamma();
   uint32_t bits();
@@ -68,4 +76,35 @@ class Color {
   bool operator==(const Color& c) const;
   bool isBlack() const;
 };
+
+/*---------------------------------------------------------------------------------------
+ * PaletteLUT CLASS
+ *---------------------------------------------------------------------------------------
+ * A gradient pallete expanded into 256 colors. Creating a PaletteLUT registers
+ * it, from then on Color(index, pallete) also uses the table for that pallete.
+ *
+ * PaletteLUT OceanLUT(OceanPalette);
+ * Color c = Color::fromLUT(hue, OceanLUT);
+ *-------------------------------------------------------------------------------------*/
+class PaletteLUT {
+ public:
+  Color color[256];
+
+  PaletteLUT(const uint8_t* pallete);
+  // Registered by address, so it can't be copied
+  PaletteLUT(const PaletteLUT&) = delete;
+  // Expand again after the pallete entries have been changed
+  void update();
+  // Registered table of a pallete, 0 when not expanded
+  static const PaletteLUT* find(const uint8_t* pallete);
+
+ private:
+  const uint8_t* m_pallete;
+  PaletteLUT* m_next;
+  static PaletteLUT* first;
+};
+
+inline Color Color::fromLUT(const uint8_t index, const PaletteLUT& lut) {
+  return lut.color[index];
+}
 #endif
\ No newline at end of file
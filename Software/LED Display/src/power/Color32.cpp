@@ -0,0 +1,52 @@
+#include "Color32.h"
+
+#include <string.h>
+
+#include "Math8.h"
+/*------------------------------------------------------------------------------
+ * BULK COLOR OPERATIONS
+ *------------------------------------------------------------------------------
+ * A buffer of n colors is processed as 3 * n bytes, four at a time. The words
+ * are copied in and out with memcpy since color buffers are only byte aligned,
+ * the Cortex-M7 does this with single unaligned loads and stores.
+ *----------------------------------------------------------------------------*/
+static inline uint32_t load(const uint8_t* p) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+static inline void store(uint8_t* p, uint32_t v) { memcpy(p, &v, 4); }
+
+void blend_buffer(Color* dst, const Color* src, size_t n, uint8_t scalar) {
+  uint8_t* d = (uint8_t*)dst;
+  const uint8_t* s = (const uint8_t*)src;
+  size_t i = 0, bytes = n * sizeof(Color);
+  for (; i + 4 <= bytes; i += 4)
+    store(d + i, ublend8(load(d + i), load(s + i), scalar));
+  for (; i < bytes; i++) d[i] = blend8(scalar, d[i], s[i]);
+}
+
+void scale_buffer(Color* dst, size_t n, uint8_t scalar) {
+  uint8_t* d = (uint8_t*)dst;
+  size_t i = 0, bytes = n * sizeof(Color);
+  for (; i + 4 <= bytes; i += 4) store(d + i, uscale8(load(d + i), scalar));
+  for (; i < bytes; i++) d[i] = map8(scalar, d[i]);
+}
+
+void max_buffer(Color* dst, const Color* src, size_t n) {
+  uint8_t* d = (uint8_t*)dst;
+  const uint8_t* s = (const uint8_t*)src;
+  size_t i = 0, bytes = n * sizeof(Color);
+  for (; i + 4 <= bytes; i += 4)
+    store(d + i, umax8(load(d + i), load(s + i)));
+  for (; i < bytes; i++) d[i] = d[i] > s[i] ? d[i] : s[i];
+}
+
+void add_buffer(Color* dst, const Color* src, size_t n) {
+  uint8_t* d = (uint8_t*)dst;
+  const uint8_t* s = (const uint8_t*)src;
+  size_t i = 0, bytes = n * sizeof(Color);
+  for (; i + 4 <= bytes; i += 4)
+    store(d + i, uqadd8(load(d + i), load(s + i)));
+  for (; i < bytes; i++) d[i] = qadd8(d[i], s[i]);
+}
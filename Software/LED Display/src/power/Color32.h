@@ -0,0 +1,124 @@
+#ifndef COLOR32_H
+#define COLOR32_H
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Color.h"
+/*------------------------------------------------------------------------------
+ * Color32 CLASS
+ *------------------------------------------------------------------------------
+ * Four packed unsigned bytes, used as a color (red in the low byte) or as any
+ * four consecutive channels of a color buffer. All operations give the same
+ * result per byte as their Color and Math8 counterparts:
+ *
+ * add()      qadd8  UQADD8
+ * maximize() max    USUB8 + SEL
+ * scale()    map8   two bytes per 16 bit lane
+ * blend()    blend8 two bytes per 16 bit lane
+ *
+ * The Cortex-M7 DSP extension does four saturating byte operations in one
+ * instruction, other targets (the simulator) use the portable version. The
+ * byte helpers also work on any packed bytes, like the lamp levels of
+ * space/Twinkels.h.
+ *----------------------------------------------------------------------------*/
+#if defined(__ARM_FEATURE_DSP)
+static inline uint32_t uqadd8(uint32_t a, uint32_t b) {
+  uint32_t r;
+  asm("uqadd8 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+static inline uint32_t uqsub8(uint32_t a, uint32_t b) {
+  uint32_t r;
+  asm("uqsub8 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+// USUB8 sets a GE flag per byte where a >= b, SEL takes those bytes from a
+static inline uint32_t umax8(uint32_t a, uint32_t b) {
+  uint32_t r;
+  asm("usub8 %0, %1, %2\n\tsel %0, %1, %2"
+      : "=&r"(r)
+      : "r"(a), "r"(b)
+      : "cc");
+  return r;
+}
+#else
+static inline uint32_t uqadd8(uint32_t a, uint32_t b) {
+  uint32_t r = 0;
+  for (uint8_t s = 0; s < 32; s += 8) {
+    uint32_t t = ((a >> s) & 0xFF) + ((b >> s) & 0xFF);
+    r |= (t > 0xFF ? 0xFF : t) << s;
+  }
+  return r;
+}
+static inline uint32_t uqsub8(uint32_t a, uint32_t b) {
+  uint32_t r = 0;
+  for (uint8_t s = 0; s < 32; s += 8) {
+    uint32_t x = (a >> s) & 0xFF, y = (b >> s) & 0xFF;
+    r |= (x > y ? x - y : 0) << s;
+  }
+  return r;
+}
+static inline uint32_t umax8(uint32_t a, uint32_t b) {
+  uint32_t r = 0;
+  for (uint8_t s = 0; s < 32; s += 8) {
+    uint32_t x = (a >> s) & 0xFF, y = (b >> s) & 0xFF;
+    r |= (x > y ? x : y) << s;
+  }
+  return r;
+}
+#endif
+// 0xFF for every byte of v that is 0xFF, 0 for the others
+static inline uint32_t ufull8(uint32_t v) {
+  return ((((v & 0x7F7F7F7F) + 0x01010101) & v & 0x80808080) >> 7) * 0xFF;
+}
+// ((v + 1) * scalar) >> 8 for every byte
+static inline uint32_t uscale8(uint32_t v, uint8_t scalar) {
+  uint32_t even = (((v & 0x00FF00FF) + 0x00010001) * scalar >> 8) & 0x00FF00FF;
+  uint32_t odd = ((((v >> 8) & 0x00FF00FF) + 0x00010001) * scalar) & 0xFF00FF00;
+  return even | odd;
+}
+// (a * (256 - amount) + b * (amount + 1)) >> 8 for every byte, never above
+// 0xFFFF per 16 bit lane
+static inline uint32_t ublend8(uint32_t a, uint32_t b, uint8_t amount) {
+  const uint32_t ka = 256 - amount, kb = amount + 1;
+  uint32_t even =
+      (((a & 0x00FF00FF) * ka + (b & 0x00FF00FF) * kb) >> 8) & 0x00FF00FF;
+  uint32_t odd = (((a >> 8) & 0x00FF00FF) * ka + ((b >> 8) & 0x00FF00FF) * kb) &
+                 0xFF00FF00;
+  return even | odd;
+}
+
+class Color32 {
+ public:
+  uint32_t v;
+
+ public:
+  Color32() : v(0) {}
+  Color32(const uint32_t v_) : v(v_) {}
+  Color32(const Color& c) : v(c.r | c.g << 8 | c.b << 16) {}
+  operator Color() const { return Color(v, v >> 8, v >> 16); }
+
+  Color32& operator+=(const Color32& c) {
+    v = uqadd8(v, c.v);
+    return *this;
+  }
+  Color32& maximize(const Color32& c) {
+    v = umax8(v, c.v);
+    return *this;
+  }
+  Color32& scale(const uint8_t scalar) {
+    v = uscale8(v, scalar);
+    return *this;
+  }
+  Color32& blend(const uint8_t scalar, const Color32& target) {
+    v = ublend8(v, target.v, scalar);
+    return *this;
+  }
+};
+
+// Bulk operations on n colors, four channels at a time
+void blend_buffer(Color* dst, const Color* src, size_t n, uint8_t scalar);
+void scale_buffer(Color* dst, size_t n, uint8_t scalar);
+void max_buffer(Color* dst, const Color* src, size_t n);
+void add_buffer(Color* dst, const Color* src, size_t n);
+#endif
@@ -0,0 +1,42 @@
+#include "Cost.h"
+
+#if defined COST_MODEL
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * COST MODEL
+ *----------------------------------------------------------------------------*/
+// Cortex-M7 FPU: VDIV.F32 and VSQRT.F32 take 14 cycles, newlib sinf and cosf
+// around 80, a noise sample mostly its 16 (Perlin) or 5 (simplex) gradients
+uint32_t Cost::count[OPS] = {};
+uint16_t Cost::cycles[OPS] = {14, 14, 80, 20, 600, 350, 8};
+const char *const Cost::names[OPS] = {"divide", "sqrt",    "trig", "fasttrig",
+                                      "noise4", "snoise4", "voxel"};
+
+void Cost::reset() { memset(count, 0, sizeof(count)); }
+
+bool Cost::set(const char *name, const uint16_t cycles_) {
+  for (uint8_t op = 0; op < OPS; op++) {
+    if (!strcmp(name, names[op])) {
+      cycles[op] = cycles_;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t Cost::total() {
+  uint32_t sum = 0;
+  for (uint8_t op = 0; op < OPS; op++) sum += count[op] * cycles[op];
+  return sum;
+}
+
+float Cost::micros() { return total() / 600.0f; }
+
+Cost::op_t Cost::dominant() {
+  uint8_t best = 0;
+  for (uint8_t op = 1; op < OPS; op++) {
+    if (count[op] * cycles[op] > count[best] * cycles[best]) best = op;
+  }
+  return (op_t)best;
+}
+#endif
@@ -0,0 +1,55 @@
+#ifndef COST_H
+#define COST_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * COST MODEL
+ *------------------------------------------------------------------------------
+ * Counts the operations that dominate a frame on the Cortex-M7 at 600 MHz, so
+ * an animation can be judged in the simulator before it reaches the cube. A
+ * desktop runs the same code many times faster and with other relative costs
+ * (a float divide or sqrtf is 14 cycles on the M7, a libm sinf many more).
+ *
+ * Only with COST_MODEL defined, the simulator benchmark does. COST(op, n)
+ * compiles to nothing otherwise, the firmware carries no counters.
+ *
+ * Cost::reset();
+ * ... draw a frame ...
+ * float us = Cost::micros();  // estimated Teensy time of the counted ops
+ *
+ * The cycles per operation are a table that set() changes. Divides written
+ * directly in an animation are not counted, only those in Math3D.
+ *----------------------------------------------------------------------------*/
+#if defined COST_MODEL
+class Cost {
+ public:
+  enum op_t : uint8_t {
+    DIVIDE,    // float divide (Math3D)
+    SQRT,      // sqrtf (Math3D magnitudes)
+    TRIG,      // libm sin, cos
+    FASTTRIG,  // FastTrig table lookups
+    NOISE4,    // Perlin noise4, pnoise4
+    SNOISE4,   // simplex snoise4
+    VOXEL,     // voxel written to the drawing buffer
+    OPS
+  };
+
+  static uint32_t count[OPS];
+  static uint16_t cycles[OPS];
+  static const char *const names[OPS];
+
+  // clear the counts
+  static void reset();
+  // change the cycles of an operation by name, false for an unknown name
+  static bool set(const char *name, const uint16_t cycles);
+  // estimated cycles and microseconds of the counted operations
+  static uint32_t total();
+  static float micros();
+  // operation with the most cycles
+  static op_t dominant();
+};
+
+#define COST(op, n) (Cost::count[Cost::op] += (n))
+#else
+#define COST(op, n) ((void)0)
+#endif
+#endif
@@ -0,0 +1,37 @@
+#include "Crc.h"
+/*------------------------------------------------------------------------------
+ * CRC FUNCTIONS
+ *----------------------------------------------------------------------------*/
+// Reflected polynomial 0xEDB88320 for every value of a nibble
+static const uint32_t crc32_table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+uint32_t crc32(const void *data, size_t size, uint32_t crc) {
+  const uint8_t *p = (const uint8_t *)data;
+  crc = ~crc;
+  while (size--) {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ crc32_table[crc & 0x0F];
+    crc = (crc >> 4) ^ crc32_table[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+// Polynomial 0x1021 for every value of a nibble
+static const uint16_t crc16_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+
+uint16_t crc16_update(uint16_t crc, uint8_t byte) {
+  crc = (crc << 4) ^ crc16_table[(crc >> 12) ^ (byte >> 4)];
+  crc = (crc << 4) ^ crc16_table[(crc >> 12) ^ (byte & 0x0F)];
+  return crc;
+}
+
+uint16_t crc16(const void *data, size_t size, uint16_t crc) {
+  const uint8_t *p = (const uint8_t *)data;
+  while (size--) crc = crc16_update(crc, *p++);
+  return crc;
+}
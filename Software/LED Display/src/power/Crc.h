@@ -0,0 +1,18 @@
+#ifndef CRC_H
+#define CRC_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * CRC FUNCTIONS
+ *------------------------------------------------------------------------------
+ * CRC-32 (IEEE 802.3, as zlib) and CRC-16 (CCITT-FALSE, polynomial 0x1021,
+ * initial 0xFFFF) with a 16 entry table each, one lookup per nibble. Pass the
+ * previous result to continue over more data, crc16_update() adds one byte.
+ *
+ * uint32_t crc = crc32(&header, sizeof(header));
+ * crc = crc32(data, size, crc);
+ *----------------------------------------------------------------------------*/
+uint32_t crc32(const void *data, size_t size, uint32_t crc = 0);
+uint16_t crc16(const void *data, size_t size, uint16_t crc = 0xFFFF);
+uint16_t crc16_update(uint16_t crc, uint8_t byte);
+#endif
@@ -0,0 +1,77 @@
+#include "FastTrig.h"
+/*------------------------------------------------------------------------------
+ * FAST TRIGONOMETRY TABLES
+ *----------------------------------------------------------------------------*/
+// 128 + 127 * sin(2 * PI * i / 256)
+const uint8_t Sin8Table[256] = {
+    128, 131, 134, 137, 140, 144, 147, 150, 153, 156, 159, 162, 165, 168, 171,
+    174, 177, 179, 182, 185, 188, 191, 193, 196, 199, 201, 204, 206, 209, 211,
+    213, 216, 218, 220, 222, 224, 226, 228, 230, 232, 234, 235, 237, 239, 240,
+    241, 243, 244, 245, 246, 248, 249, 250, 250, 251, 252, 253, 253, 254, 254,
+    254, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 253, 253, 252, 251,
+    250, 250, 249, 248, 246, 245, 244, 243, 241, 240, 239, 237, 235, 234, 232,
+    230, 228, 226, 224, 222, 220, 218, 216, 213, 211, 209, 206, 204, 201, 199,
+    196, 193, 191, 188, 185, 182, 179, 177, 174, 171, 168, 165, 162, 159, 156,
+    153, 150, 147, 144, 140, 137, 134, 131, 128, 125, 122, 119, 116, 112, 109,
+    106, 103, 100, 97, 94, 91, 88, 85, 82, 79, 77, 74, 71, 68, 65, 63, 60, 57,
+    55, 52, 50, 47, 45, 43, 40, 38, 36, 34, 32, 30, 28, 26, 24, 22, 21, 19, 17,
+    16, 15, 13, 12, 11, 10, 8, 7, 6, 6, 5, 4, 3, 3, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 3, 3, 4, 5, 6, 6, 7, 8, 10, 11, 12, 13, 15, 16, 17, 19, 21, 22,
+    24, 26, 28, 30, 32, 34, 36, 38, 40, 43, 45, 47, 50, 52, 55, 57, 60, 63, 65,
+    68, 71, 74, 77, 79, 82, 85, 88, 91, 94, 97, 100, 103, 106, 109, 112, 116,
+    119, 122, 125};
+
+// sin(2 * PI * i / 256), one extra entry to interpolate the last sample
+const float SinTable[257] = {
+    0.00000000f, 0.02454123f, 0.04906767f, 0.07356456f, 0.09801714f,
+    0.12241068f, 0.14673047f, 0.17096189f, 0.19509032f, 0.21910124f,
+    0.24298018f, 0.26671276f, 0.29028468f, 0.31368174f, 0.33688985f,
+    0.35989504f, 0.38268343f, 0.40524131f, 0.42755509f, 0.44961133f,
+    0.47139674f, 0.49289819f, 0.51410274f, 0.53499762f, 0.55557023f,
+    0.57580819f, 0.59569930f, 0.61523159f, 0.63439328f, 0.65317284f,
+    0.67155895f, 0.68954054f, 0.70710678f, 0.72424708f, 0.74095113f,
+    0.75720885f, 0.77301045f, 0.78834643f, 0.80320753f, 0.81758481f,
+    0.83146961f, 0.84485357f, 0.85772861f, 0.87008699f, 0.88192126f,
+    0.89322430f, 0.90398929f, 0.91420976f, 0.92387953f, 0.93299280f,
+    0.94154407f, 0.94952818f, 0.95694034f, 0.96377607f, 0.97003125f,
+    0.97570213f, 0.98078528f, 0.98527764f, 0.98917651f, 0.99247953f,
+    0.99518473f, 0.99729046f, 0.99879546f, 0.99969882f, 1.00000000f,
+    0.99969882f, 0.99879546f, 0.99729046f, 0.99518473f, 0.99247953f,
+    0.98917651f, 0.98527764f, 0.98078528f, 0.97570213f, 0.97003125f,
+    0.96377607f, 0.95694034f, 0.94952818f, 0.94154407f, 0.93299280f,
+    0.92387953f, 0.91420976f, 0.90398929f, 0.89322430f, 0.88192126f,
+    0.87008699f, 0.85772861f, 0.84485357f, 0.83146961f, 0.81758481f,
+    0.80320753f, 0.78834643f, 0.77301045f, 0.75720885f, 0.74095113f,
+    0.72424708f, 0.70710678f, 0.68954054f, 0.67155895f, 0.65317284f,
+    0.63439328f, 0.61523159f, 0.59569930f, 0.57580819f, 0.55557023f,
+    0.53499762f, 0.51410274f, 0.49289819f, 0.47139674f, 0.44961133f,
+    0.42755509f, 0.40524131f, 0.38268343f, 0.35989504f, 0.33688985f,
+    0.31368174f, 0.29028468f, 0.26671276f, 0.24298018f, 0.21910124f,
+    0.19509032f, 0.17096189f, 0.14673047f, 0.12241068f, 0.09801714f,
+    0.07356456f, 0.04906767f, 0.02454123f, 0.00000000f, -0.02454123f,
+    -0.04906767f, -0.07356456f, -0.09801714f, -0.12241068f, -0.14673047f,
+    -0.17096189f, -0.19509032f, -0.21910124f, -0.24298018f, -0.26671276f,
+    -0.29028468f, -0.31368174f, -0.33688985f, -0.35989504f, -0.38268343f,
+    -0.40524131f, -0.42755509f, -0.44961133f, -0.47139674f, -0.49289819f,
+    -0.51410274f, -0.53499762f, -0.55557023f, -0.57580819f, -0.59569930f,
+    -0.61523159f, -0.63439328f, -0.65317284f, -0.67155895f, -0.68954054f,
+    -0.70710678f, -0.72424708f, -0.74095113f, -0.75720885f, -0.77301045f,
+    -0.78834643f, -0.80320753f, -0.81758481f, -0.83146961f, -0.84485357f,
+    -0.85772861f, -0.87008699f, -0.88192126f, -0.89322430f, -0.90398929f,
+    -0.91420976f, -0.92387953f, -0.93299280f, -0.94154407f, -0.94952818f,
+    -0.95694034f, -0.96377607f, -0.97003125f, -0.97570213f, -0.98078528f,
+    -0.98527764f, -0.98917651f, -0.99247953f, -0.99518473f, -0.99729046f,
+    -0.99879546f, -0.99969882f, -1.00000000f, -0.99969882f, -0.99879546f,
+    -0.99729046f, -0.99518473f, -0.99247953f, -0.98917651f, -0.98527764f,
+    -0.98078528f, -0.97570213f, -0.97003125f, -0.96377607f, -0.95694034f,
+    -0.94952818f, -0.94154407f, -0.93299280f, -0.92387953f, -0.91420976f,
+    -0.90398929f, -0.89322430f, -0.88192126f, -0.87008699f, -0.85772861f,
+    -0.84485357f, -0.83146961f, -0.81758481f, -0.80320753f, -0.78834643f,
+    -0.77301045f, -0.75720885f, -0.74095113f, -0.72424708f, -0.70710678f,
+    -0.68954054f, -0.67155895f, -0.65317284f, -0.63439328f, -0.61523159f,
+    -0.59569930f, -0.57580819f, -0.55557023f, -0.53499762f, -0.51410274f,
+    -0.49289819f, -0.47139674f, -0.44961133f, -0.42755509f, -0.40524131f,
+    -0.38268343f, -0.35989504f, -0.33688985f, -0.31368174f, -0.29028468f,
+    -0.26671276f, -0.24298018f, -0.21910124f, -0.19509032f, -0.17096189f,
+    -0.14673047f, -0.12241068f, -0.09801714f, -0.07356456f, -0.04906767f,
+    -0.02454123f, 0.00000000f};
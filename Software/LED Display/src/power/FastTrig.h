@@ -0,0 +1,67 @@
+#ifndef FASTTRIG_H
+#define FASTTRIG_H
+#include <stdint.h>
+
+#include "Cost.h"
+/*------------------------------------------------------------------------------
+ * FAST TRIGONOMETRY
+ *------------------------------------------------------------------------------
+ * Table based sine and cosine for inner loops.
+ *
+ * sin8(theta) / cos8(theta): a full turn is 0 to 255, the result is
+ * 128 + 127 * sin, so 0 to 255 (hue and phase domain, FastLED convention).
+ *
+ * fsin(rad) / fcos(rad) / fsincos(rad, s, c): radians, linear interpolation
+ * between 256 samples per turn, the error is below 0.0001. fsincos() gives
+ * both with a single table lookup.
+ *
+ * isincos(turn, s, c): the same for an angle kept in fixed point, a full turn
+ * is 0 to 65535. Advancing it is an integer add that wraps by itself and the
+ * lookup needs no float to int conversion.
+ *----------------------------------------------------------------------------*/
+extern const uint8_t Sin8Table[256];
+extern const float SinTable[257];
+
+static inline uint8_t sin8(const uint8_t theta) { return Sin8Table[theta]; }
+static inline uint8_t cos8(const uint8_t theta) {
+  return Sin8Table[(uint8_t)(theta + 64)];
+}
+
+// Table position of an angle in radians, split in index and fraction
+static inline uint8_t fposition(const float rad, float &fraction) {
+  const float t = rad * (256.0f / 6.283185307f);
+  int32_t i = (int32_t)t;
+  if (t < i) i--;
+  fraction = t - i;
+  return (uint8_t)i;
+}
+
+static inline float fsin(const float rad) {
+  COST(FASTTRIG, 1);
+  float f;
+  const uint8_t i = fposition(rad, f);
+  return SinTable[i] + f * (SinTable[i + 1] - SinTable[i]);
+}
+static inline float fcos(const float rad) {
+  COST(FASTTRIG, 1);
+  float f;
+  const uint8_t i = fposition(rad, f) + 64;
+  return SinTable[i] + f * (SinTable[i + 1] - SinTable[i]);
+}
+static inline void fsincos(const float rad, float &s, float &c) {
+  COST(FASTTRIG, 1);
+  float f;
+  const uint8_t i = fposition(rad, f);
+  const uint8_t j = i + 64;
+  s = SinTable[i] + f * (SinTable[i + 1] - SinTable[i]);
+  c = SinTable[j] + f * (SinTable[j + 1] - SinTable[j]);
+}
+static inline void isincos(const uint16_t turn, float &s, float &c) {
+  COST(FASTTRIG, 1);
+  const float f = (turn & 0xFF) * (1.0f / 256);
+  const uint8_t i = turn >> 8;
+  const uint8_t j = i + 64;
+  s = SinTable[i] + f * (SinTable[i + 1] - SinTable[i]);
+  c = SinTable[j] + f * (SinTable[j + 1] - SinTable[j]);
+}
+#endif
@@ -0,0 +1,39 @@
+#include "Field.h"
+/*------------------------------------------------------------------------------
+ * FIELD CLASSES
+ *----------------------------------------------------------------------------*/
+static void axis(const float k, const float offset, float *s, float *c) {
+  for (uint8_t i = 0; i < 16; i++) {
+    const float a = k * (i - 7.5f) + offset;
+    s[i] = sinf(a);
+    c[i] = cosf(a);
+  }
+}
+
+void PlaneWave::set(const Vector3 &k, const float offset) {
+  axis(k.x, offset, sx, cx);
+  axis(k.y, 0, sy, cy);
+  axis(k.z, 0, sz, cz);
+}
+
+// Twice the distance along an axis is 2 * i - 15 - h with h twice the source
+// coordinate, odd squares are 1 and even squares 0 modulo 4
+static uint16_t axis(const float v, uint16_t *q) {
+  int16_t h = (int16_t)(v * 2 + 32768.5f) - 32768;
+  if (h < -15) h = -15;
+  if (h > 15) h = 15;
+  uint16_t largest = 0;
+  for (uint8_t i = 0; i < 16; i++) {
+    const int16_t d = 2 * i - 15 - h;
+    q[i] = d * d;
+    if (q[i] > largest) largest = q[i];
+  }
+  return largest;
+}
+
+void RadialWave::center(const Vector3 &source) {
+  const uint16_t largest =
+      axis(source.x, qx) + axis(source.y, qy) + axis(source.z, qz);
+  residue = (qx[0] & 3) + (qy[0] & 3) + (qz[0] & 3);
+  count = (largest >> 2) + 1;
+}
@@ -0,0 +1,78 @@
+#ifndef FIELD_H
+#define FIELD_H
+#include <math.h>
+#include <stdint.h>
+
+#include "Math3D.h"
+/*------------------------------------------------------------------------------
+ * FIELD CLASSES
+ *------------------------------------------------------------------------------
+ * Waves over the 16x16x16 voxels built from per axis tables, the work per
+ * voxel is a few multiply adds and no trig. Coordinates are relative to the
+ * center of the cube (voxel x is at x - 7.5).
+ *
+ * PlaneWave is sin(kx * x + ky * y + kz * z + offset). The angle addition
+ *   sin(a + b) = sin a cos b + cos a sin b
+ *   cos(a + b) = cos a cos b - sin a sin b
+ * combines the sine and cosine of the term of every axis, 48 of each are all
+ * the trig of a frame.
+ *
+ * RadialWave is f(distance to a source). The squared distance is the sum of
+ * the squares per axis. With the source on the half voxel grid four times it
+ * is an integer, so f is a table over it filled once per frame. The parity of
+ * every axis is the same for all voxels, only every fourth integer occurs and
+ * the table holds just those, at most 676 for a source inside the cube.
+ *
+ * PlaneWave foam;
+ * foam.set(Vector3(5 / 7.5f, 0, 3 / 7.5f), phase * 3);
+ * foam.at(x, y, z);
+ *
+ * RadialWave wave;
+ * wave.center(Vector3(-7, -7, -7));
+ * wave.fill([](float d) { return sinf(d * 1.5f - phase); });
+ * wave.at(x, y, z);
+ *----------------------------------------------------------------------------*/
+class PlaneWave {
+ public:
+  // Wave vector in radians per voxel and the phase at the center
+  void set(const Vector3 &k, const float offset);
+  float at(const uint8_t x, const uint8_t y, const uint8_t z) const {
+    const float s = sx[x] * cy[y] + cx[x] * sy[y];
+    const float c = cx[x] * cy[y] - sx[x] * sy[y];
+    return s * cz[z] + c * sz[z];
+  }
+
+ private:
+  float sx[16], cx[16], sy[16], cy[16], sz[16], cz[16];
+};
+
+class RadialWave {
+ public:
+  static const uint16_t SIZE = 676;
+
+  // Source rounded to the half voxel grid, inside the cube
+  void center(const Vector3 &source);
+  // Table of f(distance in voxels) for the distances of this source
+  template <typename F>
+  void fill(F f) {
+    for (uint16_t i = 0; i < count; i++)
+      value[i] = f(sqrtf((i * 4 + residue) * 0.25f));
+  }
+  float at(const uint8_t x, const uint8_t y, const uint8_t z) const {
+    return value[(qx[x] + qy[y] + qz[z]) >> 2];
+  }
+  // The same along a row, with the term of x and y taken once per row
+  uint16_t row(const uint8_t x, const uint8_t y) const { return qx[x] + qy[y]; }
+  float at(const uint16_t row, const uint8_t z) const {
+    return value[(row + qz[z]) >> 2];
+  }
+
+ private:
+  // Four times the squared distance per axis
+  uint16_t qx[16], qy[16], qz[16];
+  // Four times every squared distance modulo 4, the table entries
+  uint8_t residue = 0;
+  uint16_t count = 0;
+  float value[SIZE];
+};
+#endif
@@ -0,0 +1,24 @@
+#include "Fractal.h"
+
+#include <Arduino.h>
+/*------------------------------------------------------------------------------
+ * FRACTAL VOLUMES
+ *----------------------------------------------------------------------------*/
+#define DEPTHS(f)                                                    \
+  Fractal::bake(f, 1), Fractal::bake(f, 2), Fractal::bake(f, 3), \
+      Fractal::bake(f, 4)
+
+// Evaluated by the compiler, only the bits end up in flash
+PROGMEM static constexpr fractal_volume_t volumes[][Fractal::DEPTHS] = {
+    {DEPTHS(fractal_t::TETRAHEDRON)},
+    {DEPTHS(fractal_t::CORNER)},
+    {DEPTHS(fractal_t::SPONGE)},
+};
+#undef DEPTHS
+
+const fractal_volume_t &Fractal::volume(const fractal_t fractal,
+                                        const uint8_t depth) {
+  const uint8_t f = fractal < fractal_t::COUNT ? (uint8_t)fractal : 0;
+  const uint8_t d = depth < 1 ? 1 : depth > DEPTHS ? DEPTHS : depth;
+  return volumes[f][d - 1];
+}
@@ -0,0 +1,75 @@
+#ifndef FRACTAL_H
+#define FRACTAL_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * FRACTAL VOLUMES
+ *------------------------------------------------------------------------------
+ * Self similar sets on the 16x16x16 grid, baked by the compiler into 512
+ * bytes of flash each: bit z of column[x][y] is voxel x, y, z. Each holds
+ * DEPTHS levels, a lower depth stops the recursion early and keeps the
+ * cells below it solid.
+ *
+ *   TETRAHEDRON  Sierpinski tetrahedron, 4 half size copies at alternate
+ *                corners of the cube: every bit of x ^ y ^ z is 0
+ *   CORNER       Pascal tetrahedron mod 2, copies at a corner and its three
+ *                neighbours: no two of x, y and z share a bit
+ *   SPONGE       Menger sponge in quarters, 4x4x4 cells without those that
+ *                have two or three coordinates in the middle two
+ *
+ * const fractal_volume_t &v = Fractal::volume(fractal_t::TETRAHEDRON, 4);
+ * sample_y(v.column, angle, color);  // see Graphics.h
+ *----------------------------------------------------------------------------*/
+enum class fractal_t : uint8_t { TETRAHEDRON, CORNER, SPONGE, COUNT };
+
+struct fractal_volume_t {
+  uint16_t column[16][16];
+};
+
+class Fractal {
+ public:
+  static const uint8_t DEPTHS = 4;
+
+  // Volume of a fractal, depth 1 to DEPTHS (SPONGE has 2, more is clamped)
+  static const fractal_volume_t &volume(const fractal_t fractal,
+                                        const uint8_t depth);
+
+  // Voxel x, y, z of a fractal, for the compiler
+  static constexpr bool inside(const fractal_t fractal, const uint8_t depth,
+                               const uint8_t x, const uint8_t y,
+                               const uint8_t z) {
+    return fractal == fractal_t::TETRAHEDRON
+               ? ((x ^ y ^ z) >> (4 - depth)) == 0
+           : fractal == fractal_t::CORNER
+               ? (((x & y) | (y & z) | (x & z)) >> (4 - depth)) == 0
+               : sponge(depth, x, y, z);
+  }
+
+  static constexpr fractal_volume_t bake(const fractal_t fractal,
+                                         const uint8_t depth) {
+    fractal_volume_t v{};
+    for (uint8_t x = 0; x < 16; x++)
+      for (uint8_t y = 0; y < 16; y++)
+        for (uint8_t z = 0; z < 16; z++)
+          if (inside(fractal, depth, x, y, z))
+            v.column[x][y] |= (uint16_t)(1 << z);
+    return v;
+  }
+
+ private:
+  // A base 4 digit in the middle (1 or 2)
+  static constexpr uint8_t middle(const uint8_t d) {
+    return ((d >> 1) ^ d) & 1;
+  }
+  static constexpr bool sponge(const uint8_t depth, const uint8_t x,
+                               const uint8_t y, const uint8_t z) {
+    for (uint8_t level = 0; level < depth && level < 2; level++) {
+      const uint8_t shift = 2 - 2 * level;
+      if (middle(x >> shift & 3) + middle(y >> shift & 3) +
+              middle(z >> shift & 3) >
+          1)
+        return false;
+    }
+    return true;
+  }
+};
+#endif
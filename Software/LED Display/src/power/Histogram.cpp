@@ -0,0 +1,39 @@
+#include "Histogram.h"
+
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * HISTOGRAM CLASS
+ *----------------------------------------------------------------------------*/
+Histogram::Histogram(const uint16_t width) : m_width(width) { reset(); }
+void Histogram::add(const uint32_t value) {
+  uint32_t bin = value / m_width;
+  m_bins[bin < BINS ? bin : BINS - 1]++;
+  if (m_count == 0 || value < m_min) m_min = value;
+  if (value > m_max) m_max = value;
+  m_sum += value;
+  m_count++;
+}
+void Histogram::reset() {
+  memset(m_bins, 0, sizeof(m_bins));
+  m_count = 0;
+  m_sum = 0;
+  m_min = 0;
+  m_max = 0;
+}
+uint32_t Histogram::count() const { return m_count; }
+uint32_t Histogram::min() const { return m_min; }
+uint32_t Histogram::max() const { return m_max; }
+uint32_t Histogram::avg() const { return m_count ? m_sum / m_count : 0; }
+// Upper bound of the bin holding the p-th percentile, limited by the maximum
+uint32_t Histogram::percentile(const uint8_t p) const {
+  uint32_t rank = (m_count * p + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < BINS; i++) {
+    seen += m_bins[i];
+    if (seen >= rank && seen > 0 && i < BINS - 1) {
+      uint32_t bound = (i + 1) * m_width;
+      return bound < m_max ? bound : m_max;
+    }
+  }
+  return m_max;
+}
@@ -0,0 +1,38 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * HISTOGRAM CLASS
+ *------------------------------------------------------------------------------
+ * The Histogram class collects durations in microseconds. Minimum, maximum
+ * and average are exact, percentiles are resolved to the width of a bin. The
+ * last bin also holds all values beyond the range of the histogram.
+ *
+ * Histogram h = Histogram(250);  // 64 bins of 250us -> 0 to 16ms
+ * h.add(1234);
+ * h.percentile(99);
+ *----------------------------------------------------------------------------*/
+class Histogram {
+ public:
+  static const uint8_t BINS = 64;
+
+  Histogram(const uint16_t width);
+  void add(const uint32_t value);
+  void reset();
+  // Statistics in microseconds, zero when empty
+  uint32_t count() const;
+  uint32_t min() const;
+  uint32_t max() const;
+  uint32_t avg() const;
+  uint32_t percentile(const uint8_t p) const;
+
+ private:
+  // width of a bin in microseconds
+  uint16_t m_width;
+  uint32_t m_bins[BINS];
+  uint32_t m_count;
+  uint32_t m_sum;
+  uint32_t m_min;
+  uint32_t m_max;
+};
+#endif
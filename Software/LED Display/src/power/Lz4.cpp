@@ -0,0 +1,44 @@
+#include "Lz4.h"
+
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * LZ4 FUNCTIONS
+ *----------------------------------------------------------------------------*/
+// A count of a nibble, 15 goes on in the bytes after it, false when the
+// input ends first
+static bool count(const uint8_t *&in, const uint8_t *end, size_t &n) {
+  if (n != 15) return true;
+  uint8_t b;
+  do {
+    if (in == end) return false;
+    b = *in++;
+    n += b;
+  } while (b == 255);
+  return true;
+}
+
+int lz4_decode(const uint8_t *in, size_t size, uint8_t *out, size_t capacity) {
+  const uint8_t *end = in + size;
+  size_t n = 0;
+  while (in < end) {
+    const uint8_t token = *in++;
+    size_t literals = token >> 4;
+    if (!count(in, end, literals) || literals > (size_t)(end - in) ||
+        literals > capacity - n)
+      return -1;
+    memcpy(&out[n], in, literals);
+    in += literals;
+    n += literals;
+    if (in == end) break;
+    if (end - in < 2) return -1;
+    const size_t offset = in[0] | in[1] << 8;
+    in += 2;
+    size_t length = token & 0x0F;
+    if (!count(in, end, length)) return -1;
+    length += 4;
+    if (offset == 0 || offset > n || length > capacity - n) return -1;
+    // Byte by byte, a match may overlap what it repeats
+    for (; length; length--, n++) out[n] = out[n - offset];
+  }
+  return n;
+}
@@ -0,0 +1,21 @@
+#ifndef LZ4_H
+#define LZ4_H
+#include <stddef.h>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * LZ4 FUNCTIONS
+ *------------------------------------------------------------------------------
+ * Decoder of the LZ4 block format: sequences of a token (literal count and
+ * match length in a nibble each, 15 continues in bytes up to a byte below
+ * 255), the literals, a 16 bit LE offset back into the output and the rest of
+ * the match length. The last sequence ends after its literals. Every count
+ * and offset is checked, a corrupt block fails instead of writing outside
+ * the output. firmware_pack.py compresses the firmware blocks of an update
+ * with it, lz4.block.compress() of python-lz4 makes the same format.
+ *
+ * const int n = lz4_decode(block, size, sector, 1024);
+ * if (n < 0) ... corrupt
+ *----------------------------------------------------------------------------*/
+// Decoded size, -1 when the block is corrupt or does not fit capacity
+int lz4_decode(const uint8_t *in, size_t size, uint8_t *out, size_t capacity);
+#endif
@@ -3,6 +3,9 @@
 #include <math.h>
 #include <stdint.h>
 
+#include "Cost.h"
+#include "FastTrig.h"
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846f
 #endif
@@ -45,6 +48,7 @@ Vector3 Vector3::operator*(float s) const {
   return Vector3(x * s, y * s, z * s);
 }
 Vector3 Vector3::operator/(float s) const {
+  COST(DIVIDE, 3);
   return Vector3(x / s, y / s, z / s);
 }
 Vector3& Vector3::operator*=(float s) {
@@ -54,6 +58,7 @@ Vector3& Vector3::operator*=(float s) {
   return *this;
 }
 Vector3& Vector3::operator/=(float s) {
+  COST(DIVIDE, 3);
   x /= s;
   y /= s;
   z /= s;
@@ -77,14 +82,17 @@ float Vector3::operator%(const Vector3& v) const { return dot(v); }
 Vector3& Vector3::normalize() { return *this /= magnitude(); }
 Vector3 Vector3::normalized() const { return *this / magnitude(); }
 // magnitude
-float Vector3::magnitude() const { return sqrt(norm()); }
+float Vector3::magnitude() const {
+  COST(SQRT, 1);
+  return sqrt(norm());
+}
 float Vector3::norm() const { return x * x + y * y + z * z; }
 
 // rotate v by an angle and this vector holding an axis using Rodrigues formula
 Vector3 Vector3::rotate(float angle, const Vector3& v) const {
   // Angle is in degree and is converted to radian by multiplying by 2PI/360
-  float c = cosf(2 * M_PI / 360 * angle);
-  float s = sinf(2 * M_PI / 360 * angle);
+  float s, c;
+  fsincos(2 * (float)M_PI / 360 * angle, s, c);
   // normalize this vector to get n hat
   Vector3 n = normalized();
   // (1-cos(0))(v.n)n + cos(0)v + sin(0)(n x v)
@@ -115,24 +123,28 @@ Quaternion::Quaternion(float a, const Vector3& v_) {
   Vector3 n = v_.normalized();
   // Angle is in degree and is converted to radian by 2PI/360 * angle
   // Angles are divided by 2 when using quaternions so back to PI/360
-  a = a * M_PI / 360;
+  a = a * (float)M_PI / 360;
+  float s, c;
+  fsincos(a, s, c);
   // Multiply n hat by sin(0) (scale n, but no directional change)
   // So v still represents the axis of rotation, but changed magnitude
-  v = n * sinf(a);
+  v = n * s;
   // Store cos(0) in the scalar part of the quaternion, results in a
   // unit quaternion => w^2+x^2+y^2+z^2=1, since sin(x)^2+cos(x)^2=1
   // Magnitude is always one. To stack rotations multiply unit
   // quaternions together and keep magnitude 1. So multiple rotations
   // without changing size of an object
-  w = cosf(a);
+  w = c;
 }
 
 // add, subtract (operator +, -, +=, -=)
+// Quaternion(float, Vector3) takes an angle and axis, so the operators that
+// return a new quaternion work on a copy
 Quaternion Quaternion::operator+(const Quaternion& q) const {
-  return Quaternion(w + q.w, v + q.v);
+  return Quaternion(*this) += q;
 }
 Quaternion Quaternion::operator-(const Quaternion& q) const {
-  return Quaternion(w - q.w, v - q.v);
+  return Quaternion(*this) -= q;
 }
 Quaternion& Quaternion::operator+=(const Quaternion& q) {
   w += q.w;
@@ -147,10 +159,10 @@ Quaternion& Quaternion::operator-=(const Quaternion& q) {
 
 // multiply, divide by scalar (operator *, /, *=, /=)
 Quaternion Quaternion::operator*(float s) const {
-  return Quaternion(w * s, v * s);
+  return Quaternion(*this) *= s;
 }
 Quaternion Quaternion::operator/(float s) const {
-  return Quaternion(w / s, v / s);
+  return Quaternion(*this) /= s;
 }
 Quaternion& Quaternion::operator*=(float s) {
   w *= s;
@@ -158,6 +170,7 @@ Quaternion& Quaternion::operator*=(float s) {
   return *this;
 }
 Quaternion& Quaternion::operator/=(float s) {
+  COST(DIVIDE, 1);
   w /= s;
   v /= s;
   return *this;
@@ -185,25 +198,104 @@ float Quaternion::operator%(const Quaternion& q) const { return dot(q); }
 
 // inverse
 Quaternion& Quaternion::inverse() {
+  COST(DIVIDE, 1);
   conjugate();
   return *this *= 1 / norm();
 }
-Quaternion Quaternion::inversed() const { return conjugated() * (1 / norm()); }
+Quaternion Quaternion::inversed() const {
+  COST(DIVIDE, 1);
+  return conjugated() * (1 / norm());
+}
 // conjugate
 Quaternion& Quaternion::conjugate() {
   v = -v;
   return *this;
 }
-Quaternion Quaternion::conjugated() const { return Quaternion(w, -v); }
+Quaternion Quaternion::conjugated() const {
+  return Quaternion(*this).conjugate();
+}
 // normalize
 Quaternion& Quaternion::normalize() { return *this /= magnitude(); }
 Quaternion Quaternion::normalized() const { return *this / magnitude(); }
+// 1 / sqrt(n) ~ (3 - n) / 2 close to n = 1
+Quaternion& Quaternion::renormalize() { return *this *= (3 - norm()) * 0.5f; }
 // magnitude
-float Quaternion::magnitude() const { return sqrt(norm()); }
+float Quaternion::magnitude() const {
+  COST(SQRT, 1);
+  return sqrt(norm());
+}
 float Quaternion::norm() const { return w * w + v.dot(v); }
 
 // rotate v_ by this quaternion holding an angle and axis
 Vector3 Quaternion::rotate(const Vector3& v_) const {
   Vector3 vcv_ = v.cross(v_);
   return v_ + vcv_ * (2 * w) + v.cross(vcv_) * 2;
-}
\ No newline at end of file
+}
+// Rotate a fixed point vector, convert to Quaternionq when rotating many
+Vector3q Quaternion::rotate(const Vector3q& v_) const {
+  return Quaternionq(*this).rotate(v_);
+}
+/*------------------------------------------------------------------------------
+ * RotationMatrix CLASS
+ *----------------------------------------------------------------------------*/
+RotationMatrix::RotationMatrix() {
+  for (uint8_t i = 0; i < 3; i++)
+    for (uint8_t j = 0; j < 3; j++) m[i][j] = i == j ? 1.0f : 0.0f;
+}
+// Same rotation as q v q*, 2 / norm keeps it a rotation for any length of q
+RotationMatrix::RotationMatrix(const Quaternion& q) {
+  COST(DIVIDE, 1);
+  const float s = 2 / q.norm();
+  const float w = q.w, x = q.v.x, y = q.v.y, z = q.v.z;
+  m[0][0] = 1 - s * (y * y + z * z);
+  m[0][1] = s * (x * y - w * z);
+  m[0][2] = s * (x * z + w * y);
+  m[1][0] = s * (x * y + w * z);
+  m[1][1] = 1 - s * (x * x + z * z);
+  m[1][2] = s * (y * z - w * x);
+  m[2][0] = s * (x * z - w * y);
+  m[2][1] = s * (y * z + w * x);
+  m[2][2] = 1 - s * (x * x + y * y);
+}
+// Rodrigues formula in matrix form, angle in degree
+RotationMatrix::RotationMatrix(float angle, const Vector3& axis) {
+  float s, c;
+  fsincos(2 * (float)M_PI / 360 * angle, s, c);
+  const Vector3 n = axis.normalized();
+  const float t = 1 - c;
+  m[0][0] = t * n.x * n.x + c;
+  m[0][1] = t * n.x * n.y - s * n.z;
+  m[0][2] = t * n.x * n.z + s * n.y;
+  m[1][0] = t * n.x * n.y + s * n.z;
+  m[1][1] = t * n.y * n.y + c;
+  m[1][2] = t * n.y * n.z - s * n.x;
+  m[2][0] = t * n.x * n.z - s * n.y;
+  m[2][1] = t * n.y * n.z + s * n.x;
+  m[2][2] = t * n.z * n.z + c;
+}
+
+RotationMatrix RotationMatrix::operator*(const RotationMatrix& r) const {
+  RotationMatrix p;
+  for (uint8_t i = 0; i < 3; i++)
+    for (uint8_t j = 0; j < 3; j++)
+      p.m[i][j] =
+          m[i][0] * r.m[0][j] + m[i][1] * r.m[1][j] + m[i][2] * r.m[2][j];
+  return p;
+}
+RotationMatrix& RotationMatrix::operator*=(const RotationMatrix& r) {
+  return *this = operator*(r);
+}
+
+// Coefficients in locals so the loop keeps them in registers
+void RotationMatrix::rotate_batch(const Vector3* in, Vector3* out,
+                                  uint16_t n) const {
+  const float m00 = m[0][0], m01 = m[0][1], m02 = m[0][2];
+  const float m10 = m[1][0], m11 = m[1][1], m12 = m[1][2];
+  const float m20 = m[2][0], m21 = m[2][1], m22 = m[2][2];
+  for (uint16_t i = 0; i < n; i++) {
+    const float x = in[i].x, y = in[i].y, z = in[i].z;
+    out[i].x = m00 * x + m01 * y + m02 * z;
+    out[i].y = m10 * x + m11 * y + m12 * z;
+    out[i].z = m20 * x + m21 * y + m22 * z;
+  }
+}
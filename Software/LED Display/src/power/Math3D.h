@@ -1,5 +1,6 @@
 #ifndef MATH3D_H_
 #define MATH3D_H_
+#include <stdint.h>
 /*------------------------------------------------------------------------------
  * Vector3 CLASS
  *------------------------------------------------------------------------------
@@ -68,6 +69,72 @@ class Vector3 {
   bool inside(const Vector3& l, const Vector3& h) const;
 };
 
+/*------------------------------------------------------------------------------
+ * Vector3q CLASS
+ *------------------------------------------------------------------------------
+ * Fixed point version of Vector3 in Q8.8, 256 is 1.0. Coordinates are meant
+ * to stay within +/-64 so products fit in 32 bits. Defined inline since it is
+ * used in tight loops drawing thousands of voxels.
+ *
+ * Vector3q p = Vector3q(Vector3(1.5f, 0, -2));  // (384, 0, -512)
+ * voxel(q.rotate(p), c);
+ *----------------------------------------------------------------------------*/
+class Vector3q {
+ public:
+  static const int16_t ONE = 256;
+
+ public:
+  int16_t x, y, z;
+
+ public:
+  // constructors, from Vector3 rounded to the nearest step
+  Vector3q() : x(0), y(0), z(0) {}
+  Vector3q(int16_t x_, int16_t y_, int16_t z_) : x(x_), y(y_), z(z_) {}
+  explicit Vector3q(const Vector3& v) : x(q(v.x)), y(q(v.y)), z(q(v.z)) {}
+  // back to floating point
+  Vector3 toVector3() const {
+    return Vector3(x / 256.0f, y / 256.0f, z / 256.0f);
+  }
+
+  // moving
+  Vector3q operator+(const Vector3q& v) const {
+    return Vector3q(x + v.x, y + v.y, z + v.z);
+  }
+  Vector3q operator-(const Vector3q& v) const {
+    return Vector3q(x - v.x, y - v.y, z - v.z);
+  }
+  Vector3q& operator+=(const Vector3q& v) {
+    x += v.x;
+    y += v.y;
+    z += v.z;
+    return *this;
+  }
+  Vector3q& operator-=(const Vector3q& v) {
+    x -= v.x;
+    y -= v.y;
+    z -= v.z;
+    return *this;
+  }
+  // negate
+  Vector3q operator-() const { return Vector3q(-x, -y, -z); }
+
+  // scaling by an integer, or by s / 256 (Q8.8)
+  Vector3q operator*(int16_t s) const {
+    return Vector3q(x * s, y * s, z * s);
+  }
+  Vector3q operator/(int16_t s) const {
+    return Vector3q(x / s, y / s, z / s);
+  }
+  Vector3q scaled(int16_t s) const {
+    return Vector3q((x * s) >> 8, (y * s) >> 8, (z * s) >> 8);
+  }
+
+ private:
+  static int16_t q(float f) {
+    return (int16_t)(f * 256.0f + (f < 0 ? -0.5f : 0.5f));
+  }
+};
+
 /*------------------------------------------------------------------------------
  * Quaternion CLASS
  *------------------------------------------------------------------------------
@@ -118,10 +185,84 @@ class Quaternion {
   // unit quaternion
   Quaternion& normalize();
   Quaternion normalized() const;
+  // cheap normalize for a quaternion that drifted slightly from unit length,
+  // e.g. after a chain of multiplies (one Newton step, no sqrt or divide)
+  Quaternion& renormalize();
   // magnitude or length of the quaterion
   float magnitude() const;
   float norm() const;
   // rotate v by quaternion
   Vector3 rotate(const Vector3& v) const;
+  Vector3q rotate(const Vector3q& v) const;
+};
+
+/*------------------------------------------------------------------------------
+ * Quaternionq CLASS
+ *------------------------------------------------------------------------------
+ * Unit quaternion in Q1.14 to rotate Vector3q without floating point. Convert
+ * once per frame and rotate all points with it.
+ *
+ * Quaternionq r = Quaternion(angle, Vector3::Y);
+ * Vector3q p1 = r.rotate(p0);
+ *----------------------------------------------------------------------------*/
+class Quaternionq {
+ public:
+  int16_t w, x, y, z;
+
+ public:
+  Quaternionq(const Quaternion& q)
+      : w(q14(q.w)), x(q14(q.v.x)), y(q14(q.v.y)), z(q14(q.v.z)) {}
+
+  // t = 2 * (v x p), p' = p + w * t + v x t
+  Vector3q rotate(const Vector3q& p) const {
+    int32_t tx = (y * p.z - z * p.y) >> 13;
+    int32_t ty = (z * p.x - x * p.z) >> 13;
+    int32_t tz = (x * p.y - y * p.x) >> 13;
+    return Vector3q(p.x + ((w * tx + y * tz - z * ty) >> 14),
+                    p.y + ((w * ty + z * tx - x * tz) >> 14),
+                    p.z + ((w * tz + x * ty - y * tx) >> 14));
+  }
+
+ private:
+  static int16_t q14(float f) {
+    return (int16_t)(f * 16384.0f + (f < 0 ? -0.5f : 0.5f));
+  }
+};
+
+/*------------------------------------------------------------------------------
+ * RotationMatrix CLASS
+ *------------------------------------------------------------------------------
+ * 3x3 matrix of a rotation, built once from a quaternion or from an angle in
+ * degrees and an axis (same as Vector3::rotate). Rotating a point costs 9
+ * multiplies against about 24 for Quaternion::rotate, so build one when many
+ * points share the same orientation. The quaternion does not need to be unit
+ * length, its norm is divided out while building.
+ *
+ * Composing matrices never needs a normalize, r1 * r2 first rotates by r2.
+ *
+ * RotationMatrix r = RotationMatrix(q2 * q1);
+ * r.rotate_batch(model, world, 24);
+ *----------------------------------------------------------------------------*/
+class RotationMatrix {
+ public:
+  float m[3][3];
+
+ public:
+  // identity
+  RotationMatrix();
+  RotationMatrix(const Quaternion& q);
+  RotationMatrix(float angle, const Vector3& axis);
+
+  // compose rotations, the right hand side is applied first
+  RotationMatrix operator*(const RotationMatrix& r) const;
+  RotationMatrix& operator*=(const RotationMatrix& r);
+
+  Vector3 rotate(const Vector3& v) const {
+    return Vector3(m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+                   m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                   m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
+  }
+  // rotate n points, in and out may be the same array
+  void rotate_batch(const Vector3* in, Vector3* out, uint16_t n) const;
 };
 #endif
\ No newline at end of file
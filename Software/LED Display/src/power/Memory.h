@@ -0,0 +1,41 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+#include <Arduino.h>
+/*------------------------------------------------------------------------------
+ * MEMORY PLACEMENT
+ *------------------------------------------------------------------------------
+ * Both Teensy boards have 512 KB of RAM1 (ITCM and DTCM, no wait states) and
+ * 512 KB of RAM2 (OCRAM, DMAMEM, behind the data cache). The Teensy 4.1 of
+ * the newer boards adds 8 MB of PSRAM on FlexSPI (EXTMEM), behind the same
+ * cache but much slower on a miss, built with CUBE_PSRAM (env:teensy41).
+ *
+ * BULKMEM is for large buffers that are filled and read in order and never
+ * go to a DMA channel: the SD card read ahead and write buffers and baked
+ * noise. In PSRAM they leave RAM2 to the DMA buffers of the display, the LCD
+ * and the serial ports, and can be made much larger. Like DMAMEM it can not
+ * be initialized statically.
+ *
+ * HOTMEM is for the lookup tables read per voxel or per noise sample: the
+ * sprites of Scroller and Mario, the noise permutation and the palettes. A
+ * plain const table is copied to DTCM at boot on the Teensy 4 as well, but a
+ * PROGMEM one stays in flash behind the cache. HOTMEM tables go to the
+ * .data.hot section in DTCM, and memory_report.py prints what the hot set
+ * costs after every build. With COLD_TABLES defined they stay in flash, to
+ * compare the draw times of Animation::dump_profile() on the cube.
+ *----------------------------------------------------------------------------*/
+// Keep the hot tables in flash
+// #define COLD_TABLES
+#if defined CUBE_PSRAM
+#define BULKMEM EXTMEM
+#else
+#define BULKMEM DMAMEM
+#endif
+
+#if defined COLD_TABLES
+#define HOTMEM PROGMEM
+#elif defined __IMXRT1062__
+#define HOTMEM __attribute__((section(".data.hot")))
+#else
+#define HOTMEM
+#endif
+#endif
@@ -0,0 +1,80 @@
+#include "Metaballs.h"
+
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * METABALLS CLASS
+ *----------------------------------------------------------------------------*/
+// ONE * 16 / 9 * (1 - u)^2 for u = d^2 / R^2 in 1/256 steps, ONE at u = 1 / 4
+static const uint16_t SIZE = 256;
+static const uint16_t Falloff[SIZE] = {
+    7282, 7225, 7168, 7112, 7056, 7000, 6944, 6889, 6834, 6779, 6724, 6669,
+    6615, 6561, 6507, 6453, 6400, 6347, 6294, 6241, 6188, 6136, 6084, 6032,
+    5980, 5929, 5878, 5827, 5776, 5725, 5675, 5625, 5575, 5525, 5476, 5427,
+    5378, 5329, 5280, 5232, 5184, 5136, 5088, 5041, 4994, 4947, 4900, 4853,
+    4807, 4761, 4715, 4669, 4624, 4579, 4534, 4489, 4444, 4400, 4356, 4312,
+    4268, 4225, 4182, 4139, 4096, 4053, 4011, 3969, 3927, 3885, 3844, 3803,
+    3762, 3721, 3680, 3640, 3600, 3560, 3520, 3481, 3442, 3403, 3364, 3325,
+    3287, 3249, 3211, 3173, 3136, 3099, 3062, 3025, 2988, 2952, 2916, 2880,
+    2844, 2809, 2774, 2739, 2704, 2669, 2635, 2601, 2567, 2533, 2500, 2467,
+    2434, 2401, 2368, 2336, 2304, 2272, 2240, 2209, 2178, 2147, 2116, 2085,
+    2055, 2025, 1995, 1965, 1936, 1907, 1878, 1849, 1820, 1792, 1764, 1736,
+    1708, 1681, 1654, 1627, 1600, 1573, 1547, 1521, 1495, 1469, 1444, 1419,
+    1394, 1369, 1344, 1320, 1296, 1272, 1248, 1225, 1202, 1179, 1156, 1133,
+    1111, 1089, 1067, 1045, 1024, 1003, 982, 961, 940, 920, 900, 880, 860, 841,
+    822, 803, 784, 765, 747, 729, 711, 693, 676, 659, 642, 625, 608, 592, 576,
+    560, 544, 529, 514, 499, 484, 469, 455, 441, 427, 413, 400, 387, 374, 361,
+    348, 336, 324, 312, 300, 289, 278, 267, 256, 245, 235, 225, 215, 205, 196,
+    187, 178, 169, 160, 152, 144, 136, 128, 121, 114, 107, 100, 93, 87, 81, 75,
+    69, 64, 59, 54, 49, 44, 40, 36, 32, 28, 25, 22, 19, 16, 13, 11, 9, 7, 5, 4,
+    3, 2, 1, 0, 0};
+
+void Metaballs::clear() { memset(field, 0, sizeof(field)); }
+
+// Table index in Q8 of the squared distance along an axis for the voxels i0
+// to i1 around a ball, false without any inside the cube
+static bool axis(const float c, const float r, const float scale, uint32_t *q,
+                 uint8_t &i0, uint8_t &i1) {
+  const int16_t lo = (int16_t)(c + 7.5f - r + 32768.0f) - 32767;
+  const int16_t hi = (int16_t)(c + 7.5f + r + 32768.0f) - 32768;
+  if (lo > 15 || hi < 0 || lo > hi) return false;
+  i0 = lo < 0 ? 0 : lo;
+  i1 = hi > 15 ? 15 : hi;
+  for (uint8_t i = i0; i <= i1; i++) {
+    const float d = i - 7.5f - c;
+    q[i] = d * d * scale * 256;
+  }
+  return true;
+}
+
+void Metaballs::add(const Vector3 &center, const float size) {
+  const float r = 2 * size;
+  const float scale = SIZE / (r * r);
+  uint32_t qx[16], qy[16], qz[16];
+  uint8_t x0, x1, y0, y1, z0, z1;
+  if (!axis(center.x, r, scale, qx, x0, x1) ||
+      !axis(center.y, r, scale, qy, y0, y1) ||
+      !axis(center.z, r, scale, qz, z0, z1))
+    return;
+  for (uint8_t x = x0; x <= x1; x++) {
+    for (uint8_t y = y0; y <= y1; y++) {
+      const uint32_t row = qx[x] + qy[y];
+      if (row >= SIZE << 8) continue;
+      uint16_t *f = field[x][y];
+      for (uint8_t z = z0; z <= z1; z++) {
+        const uint32_t i = (row + qz[z]) >> 8;
+        if (i >= SIZE) continue;
+        const uint32_t v = f[z] + Falloff[i];
+        f[z] = v > 0xFFFF ? 0xFFFF : v;
+      }
+    }
+  }
+}
+
+void Metaballs::add_layer(const uint8_t y, const uint16_t value) {
+  for (uint8_t x = 0; x < 16; x++) {
+    for (uint8_t z = 0; z < 16; z++) {
+      const uint32_t v = field[x][y][z] + value;
+      field[x][y][z] = v > 0xFFFF ? 0xFFFF : v;
+    }
+  }
+}
@@ -0,0 +1,40 @@
+#ifndef METABALLS_H
+#define METABALLS_H
+#include <stdint.h>
+
+#include "Math3D.h"
+/*------------------------------------------------------------------------------
+ * METABALLS CLASS
+ *------------------------------------------------------------------------------
+ * A field over the 16x16x16 voxels summed from balls of bounded influence.
+ * A ball of size s adds k * (1 - d^2 / R^2)^2 within R = 2 * s of its center
+ * and nothing beyond, k is chosen so a ball on its own reaches ONE at a
+ * distance of s. A ball only visits the voxels in the box around its
+ * influence, taking its falloff from a table by the squared distance, so the
+ * cost of a ball follows its volume instead of the whole cube.
+ *
+ * The field is fixed point, ONE is 1.0, and saturates at its largest value.
+ * Coordinates are relative to the center of the cube (voxel x is at x - 7.5).
+ *
+ * Metaballs field;
+ * field.clear();
+ * field.add(Vector3(0, 2, 0), 2.5f);
+ * if (field.at(x, y, z) > Metaballs::ONE) ...
+ *----------------------------------------------------------------------------*/
+class Metaballs {
+ public:
+  static const uint16_t ONE = 4096;
+
+  void clear();
+  // Add a ball reaching ONE at size voxels from its center on its own
+  void add(const Vector3 &center, const float size);
+  // Add value to every voxel of layer y
+  void add_layer(const uint8_t y, const uint16_t value);
+  uint16_t at(const uint8_t x, const uint8_t y, const uint8_t z) const {
+    return field[x][y][z];
+  }
+
+ private:
+  uint16_t field[16][16][16];
+};
+#endif
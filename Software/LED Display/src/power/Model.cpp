@@ -0,0 +1,21 @@
+#include "Model.h"
+/*------------------------------------------------------------------------------
+ * MODEL CLASS
+ *----------------------------------------------------------------------------*/
+bool Model::open(const uint8_t *data, const uint32_t size, model_t &m) {
+  if (size < HEADER || memcmp(data, "VXM1", 4)) return false;
+  m.width = data[4];
+  m.height = data[5];
+  m.depth = data[6];
+  m.count = data[7];
+  m.colors = data[8];
+  m.palette = data + HEADER;
+  m.frames = m.palette + m.colors * 3;
+  // The last entry of the frame table holds the totals
+  const uint32_t table = (m.count + 1) * 4;
+  if (!m.count || m.frames + table > data + size) return false;
+  const uint8_t *last = m.frames + m.count * 4;
+  m.bricks = m.frames + table;
+  m.runs = m.bricks + le16(last) * BRICK;
+  return m.runs + le16(last + 2) * 2 == data + size;
+}
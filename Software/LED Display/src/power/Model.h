@@ -0,0 +1,90 @@
+#ifndef MODEL_H
+#define MODEL_H
+#include <stdint.h>
+#include <string.h>
+
+#include "Color.h"
+/*------------------------------------------------------------------------------
+ * MODEL CLASS
+ *------------------------------------------------------------------------------
+ * Voxel models of MagicaVoxel converted by model_convert.py, one frame per
+ * model of a .vox file or per file of a sequence. The volume is cut in bricks
+ * of 4x4x4 and only occupied bricks are stored, each as its place and a 64
+ * bit mask of its voxels. The colors of the set bits, in brick order, are
+ * runs of (length, palette index) bytes that never cross a frame, so memory
+ * goes with the occupied voxels and not with the bounding volume. All frames
+ * share one palette of at most 255 colors, index 1 is its first color.
+ *
+ * The converter writes the bytes as a header for flash or as a .vxm file for
+ * the SD card, open() takes either from memory without copying:
+ *
+ *   "VXM1" width height depth frames colors
+ *   palette      colors x (r, g, b)
+ *   frames       (frames + 1) x (first brick, first run), 16 bit
+ *   bricks       x, y, z of the brick, mask (bit x + 4y + 16z), 64 bit
+ *   runs         (length, index)
+ *
+ * Numbers are little endian, y is up as on the cube (z of MagicaVoxel).
+ *
+ * model_t m;
+ * Model::open(heart_model, sizeof(heart_model), m);
+ * Model::frame(m, 0, [&](uint8_t x, uint8_t y, uint8_t z, uint8_t i) { ... });
+ *----------------------------------------------------------------------------*/
+struct model_t {
+  uint8_t width;
+  uint8_t height;
+  uint8_t depth;
+  uint8_t count;
+  uint8_t colors;
+  const uint8_t *palette;  // r, g, b of every color
+  const uint8_t *frames;   // first brick and run of every frame
+  const uint8_t *bricks;   // place and mask of every occupied brick
+  const uint8_t *runs;     // (length, index) of all frames
+};
+
+class Model {
+ public:
+  static const uint8_t HEADER = 9;
+  static const uint8_t BRICK = 11;
+
+  // Point m into the converted bytes, false when they are not a model
+  static bool open(const uint8_t *data, const uint32_t size, model_t &m);
+
+  // Color of a palette index, from another palette of the same layout when
+  // one is given
+  static Color color(const model_t &m, const uint8_t index,
+                     const uint8_t *palette = nullptr) {
+    const uint8_t *p = &(palette ? palette : m.palette)[(index - 1) * 3];
+    return Color(p[0], p[1], p[2]);
+  }
+
+  // Visit the voxels of a frame as visit(x, y, z, palette index)
+  template <typename F>
+  static void frame(const model_t &m, const uint8_t frame, F visit) {
+    const uint8_t *f = &m.frames[frame * 4];
+    const uint8_t *brick = &m.bricks[le16(f) * BRICK];
+    const uint8_t *end = &m.bricks[le16(f + 4) * BRICK];
+    const uint8_t *run = &m.runs[le16(f + 2) * 2];
+    uint8_t left = 0, index = 0;
+    for (; brick < end; brick += BRICK) {
+      const uint8_t x = brick[0] * 4, y = brick[1] * 4, z = brick[2] * 4;
+      uint64_t mask;
+      memcpy(&mask, brick + 3, sizeof(mask));
+      while (mask) {
+        const uint8_t bit = __builtin_ctzll(mask);
+        mask &= mask - 1;
+        if (!left) {
+          left = run[0];
+          index = run[1];
+          run += 2;
+        }
+        left--;
+        visit(x + (bit & 3), y + (bit >> 2 & 3), z + (bit >> 4), index);
+      }
+    }
+  }
+
+ private:
+  static uint16_t le16(const uint8_t *p) { return p[0] | p[1] << 8; }
+};
+#endif
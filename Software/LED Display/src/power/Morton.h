@@ -0,0 +1,33 @@
+#ifndef MORTON_H
+#define MORTON_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * MORTON FUNCTIONS
+ *------------------------------------------------------------------------------
+ * Z-order index of a voxel of the 16x16x16 cube: the bits of x, y and z are
+ * interleaved (x highest), so every aligned 2x2x2 brick is 8 consecutive
+ * voxels and every 4x4x4 brick 64. A neighbour in x is mostly within the
+ * same 24 or 192 bytes instead of 768 bytes away, kernels over 3D
+ * neighbourhoods touch a few cache lines per voxel instead of nine rows.
+ * The cube buffers are stored this way with MORTON (core/Display.h).
+ *
+ * uint16_t i = Morton::index(x, y, z);
+ * uint16_t j = Morton::packed(x << 8 | y << 4 | z);  // the same
+ *----------------------------------------------------------------------------*/
+namespace Morton {
+// The 4 bits of a coordinate spread to every third bit
+static const uint16_t SPREAD[16] = {0x000, 0x001, 0x008, 0x009, 0x040, 0x041,
+                                    0x048, 0x049, 0x200, 0x201, 0x208, 0x209,
+                                    0x240, 0x241, 0x248, 0x249};
+
+static inline uint16_t index(const uint8_t x, const uint8_t y,
+                             const uint8_t z) {
+  return SPREAD[x & 15] << 2 | SPREAD[y & 15] << 1 | SPREAD[z & 15];
+}
+
+// From a voxel packed as x << 8 | y << 4 | z (Display::voxelMap)
+static inline uint16_t packed(const uint16_t v) {
+  return SPREAD[v >> 8 & 15] << 2 | SPREAD[v >> 4 & 15] << 1 | SPREAD[v & 15];
+}
+}  // namespace Morton
+#endif
@@ -1,12 +1,32 @@
 #include "Noise.h"
+
+#include <math.h>
+
+#include "Cost.h"
+#include "Memory.h"
 /*------------------------------------------------------------------------------
  * Noise CLASS
  *----------------------------------------------------------------------------*/
-float Noise::nextRandom(const float min, const float max) const {
-  return min + (rand() / ((float)RAND_MAX)) * (max - min);
+NOISE_THREAD uint32_t Noise::state[4] = {0x9E3779B9, 0x243F6A88, 0xB7E15162, 0x5A827999};
+
+// Spread the seed over the state with splitmix32, never all zero
+void Noise::seed(const uint32_t seed) {
+  uint32_t z = seed;
+  for (uint8_t i = 0; i < 4; i++) {
+    z += 0x9E3779B9;
+    uint32_t x = z;
+    x = (x ^ (x >> 16)) * 0x85EBCA6B;
+    x = (x ^ (x >> 13)) * 0xC2B2AE35;
+    state[i] = x ^ (x >> 16);
+  }
+}
+
+float Noise::nextRandom(const float min, const float max) {
+  return min + (next32() >> 8) * (1.0f / 16777215.0f) * (max - min);
 }
-uint16_t Noise::nextRandom16(const uint16_t min, const uint16_t max) const {
-  return min + (rand() / (RAND_MAX)) * (max - min);
+uint16_t Noise::nextRandom16(const uint16_t min, const uint16_t max) {
+  const uint32_t range = (uint32_t)max - min + 1;
+  return min + (uint16_t)(((uint64_t)next32() * range) >> 32);
 }
 float Noise::nextGaussian(const float mean, const float stdev,
                           const float range) {
@@ -17,21 +37,82 @@ float Noise::nextGaussian(const float mean, const float stdev,
   return gauss;
 }
 float Noise::nextGaussian(const float mean, const float stdev) {
-  if (hasSpare) {
-    hasSpare = false;
-    return mean + stdev * spare;
+  return mean + stdev * gaussian();
+}
+
+void Noise::fill(uint32_t *out, const uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) out[i] = next32();
+}
+void Noise::fill(float *out, const uint16_t n, const float min,
+                 const float max) {
+  const float scale = (max - min) * (1.0f / 16777215.0f);
+  for (uint16_t i = 0; i < n; i++) out[i] = min + (next32() >> 8) * scale;
+}
+void Noise::fillGaussian(float *out, const uint16_t n, const float mean,
+                         const float stdev) {
+  for (uint16_t i = 0; i < n; i++) out[i] = mean + stdev * gaussian();
+}
+/*------------------------------------------------------------------------------
+ * Ziggurat standard normal, after Marsaglia and Tsang (2000)
+ *------------------------------------------------------------------------------
+ * The normal curve is covered by 128 layers of equal area. A random layer and
+ * position is accepted straight away when it falls inside the curve, only the
+ * ragged layer edges and the tail beyond R need an exp() or log().
+ *----------------------------------------------------------------------------*/
+#define ZIGGURAT_R 3.442619855899
+#define ZIGGURAT_V 9.91256303526217e-3
+
+namespace {
+uint32_t kn[128];
+float wn[128], fn[128];
+bool ziggurat = false;
+
+// Layer edges kn, widths wn and curve heights fn, computed once
+void layers() {
+  const double m = 2147483648.0;
+  double d = ZIGGURAT_R, t = d;
+  const double q = ZIGGURAT_V / exp(-0.5 * d * d);
+  kn[0] = (d / q) * m;
+  kn[1] = 0;
+  wn[0] = q / m;
+  wn[127] = d / m;
+  fn[0] = 1.0f;
+  fn[127] = exp(-0.5 * d * d);
+  for (uint8_t i = 126; i >= 1; i--) {
+    d = sqrt(-2.0 * log(ZIGGURAT_V / d + exp(-0.5 * d * d)));
+    kn[i + 1] = (d / t) * m;
+    t = d;
+    fn[i] = exp(-0.5 * d * d);
+    wn[i] = d / m;
+  }
+  ziggurat = true;
+}
+
+// Uniform in the open interval (0, 1), safe for log()
+float uniform(const uint32_t r) { return ((r >> 8) + 0.5f) / 16777216.0f; }
+}  // namespace
+
+float Noise::gaussian() {
+  if (!ziggurat) layers();
+  for (;;) {
+    const int32_t h = next32();
+    const uint8_t i = h & 127;
+    const uint32_t a = h < 0 ? -(uint32_t)h : (uint32_t)h;
+    const float x = h * wn[i];
+    if (a < kn[i]) return x;
+    if (i == 0) {
+      // Tail beyond R
+      float tx, ty;
+      do {
+        tx = -logf(uniform(next32())) * (float)(1.0 / ZIGGURAT_R);
+        ty = -logf(uniform(next32()));
+      } while (ty + ty < tx * tx);
+      return h > 0 ? (float)ZIGGURAT_R + tx : -(float)ZIGGURAT_R - tx;
+    }
+    // Wedge between two layers
+    if (fn[i] + uniform(next32()) * (fn[i - 1] - fn[i]) < expf(-0.5f * x * x))
+      return x;
   }
-  hasSpare = true;
-  float u, v, s;
-  do {
-    u = (rand() / ((float)RAND_MAX)) * 2.0 - 1.0;
-    v = (rand() / ((float)RAND_MAX)) * 2.0 - 1.0;
-    s = u * u + v * v;
-  } while ((s >= 1.0) || (s == 0.0));
-
-  s = sqrt(-2.0 * log(s) / s);
-  spare = v * s;
-  return mean + stdev * u * s;
 }
 /*------------------------------------------------------------------------------
  * Full credit to Ken Perlin and Stefan Gustavson for the Perlin noise c code
@@ -46,7 +127,7 @@ float Noise::nextGaussian(const float mean, const float stdev) {
  * Values below 0 are clamped to 0
  * Values above 1 are clamped to 1
  *----------------------------------------------------------------------------*/
-const uint8_t Noise::perm[512] = {  // static class variable initialization
+HOTMEM const uint8_t Noise::perm[512] = {  // static class variable initialization
     151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,
     225, 140, 36,  103, 30,  69,  142, 8,   99,  37,  240, 21,  10,  23,  190,
     6,   148, 247, 120, 234, 75,  0,   26,  197, 62,  94,  252, 219, 203, 117,
@@ -376,6 +457,7 @@ float Noise::pnoise3(float x, float y, float z, int px, int py, int pz) {
  * 4D float Perlin noise.
  *----------------------------------------------------------------------------*/
 float Noise::noise4(float x, float y, float z, float w) {
+  COST(NOISE4, 1);
   int ix0, iy0, iz0, iw0, ix1, iy1, iz1, iw1;
   float fx0, fy0, fz0, fw0, fx1, fy1, fz1, fw1;
   float s, t, r, q;
@@ -481,6 +563,7 @@ float Noise::noise4(float x, float y, float z, float w) {
  *----------------------------------------------------------------------------*/
 float Noise::pnoise4(float x, float y, float z, float w, int px, int py, int pz,
                      int pw) {
+  COST(NOISE4, 1);
   int ix0, iy0, iz0, iw0, ix1, iy1, iz1, iw1;
   float fx0, fy0, fz0, fw0, fx1, fy1, fz1, fw1;
   float s, t, r, q;
@@ -580,4 +663,384 @@ float Noise::pnoise4(float x, float y, float z, float w, int px, int py, int pz,
   else if (n0 > 1)
     n0 = 1;
   return n0;
-}
\ No newline at end of file
+}
+/*------------------------------------------------------------------------------
+ * Simplex noise, also after Stefan Gustavson (simplexnoise1234)
+ *------------------------------------------------------------------------------
+ * Sums the gradients of the dimension + 1 corners of the simplex that holds
+ * the point instead of the 2^dimension corners of the lattice cube, 5 instead
+ * of 16 in 4D. Hashes and gradients are the same as used for Perlin noise.
+ * The range is scaled the same way to have 95% of all noise between 0 and 1.
+ *----------------------------------------------------------------------------*/
+#define F2 0.366025403f  // 0.5 * (sqrt(3) - 1)
+#define G2 0.211324865f  // (3 - sqrt(3)) / 6
+#define F3 0.333333333f  // 1 / 3
+#define G3 0.166666667f  // 1 / 6
+#define F4 0.309016994f  // (sqrt(5) - 1) / 4
+#define G4 0.138196601f  // (5 - sqrt(5)) / 20
+#define CLAMP01(n) ((n) < 0 ? 0 : (n) > 1 ? 1 : (n))
+/*------------------------------------------------------------------------------
+ * 2D float simplex noise
+ *----------------------------------------------------------------------------*/
+float Noise::snoise2(float x, float y) {
+  float n0 = 0, n1 = 0, n2 = 0;  // Noise contributions from the corners
+
+  // Skew the input space to find the simplex cell
+  float s = (x + y) * F2;
+  float xs = x + s, ys = y + s;
+  int i = FASTFLOOR(xs);
+  int j = FASTFLOOR(ys);
+  // Unskew the cell origin back to (x,y) space
+  float t = (i + j) * G2;
+  float x0 = x - (i - t);
+  float y0 = y - (j - t);
+
+  // Lower or upper triangle of the cell
+  int i1 = x0 > y0 ? 1 : 0;
+  int j1 = 1 - i1;
+
+  float x1 = x0 - i1 + G2;
+  float y1 = y0 - j1 + G2;
+  float x2 = x0 - 1.0f + 2.0f * G2;
+  float y2 = y0 - 1.0f + 2.0f * G2;
+  int ii = i & 0xff;  // Wrap to 0..255
+  int jj = j & 0xff;
+
+  float t0 = 0.5f - x0 * x0 - y0 * y0;
+  if (t0 > 0) {
+    t0 *= t0;
+    n0 = t0 * t0 * grad2(perm[ii + perm[jj]], x0, y0);
+  }
+  float t1 = 0.5f - x1 * x1 - y1 * y1;
+  if (t1 > 0) {
+    t1 *= t1;
+    n1 = t1 * t1 * grad2(perm[ii + i1 + perm[jj + j1]], x1, y1);
+  }
+  float t2 = 0.5f - x2 * x2 - y2 * y2;
+  if (t2 > 0) {
+    t2 *= t2;
+    n2 = t2 * t2 * grad2(perm[ii + 1 + perm[jj + 1]], x2, y2);
+  }
+
+  // 2sd = 0.0199, below 2sd or above 2sd = 95% of the noise surface
+  // scale all between -2sd and +2sd to -0.5 and 0.5 and add 0.5
+  n0 = 0.5f + (n0 + n1 + n2) * 0.50f / 0.0199f;
+  return CLAMP01(n0);
+}
+/*------------------------------------------------------------------------------
+ * 3D float simplex noise
+ *----------------------------------------------------------------------------*/
+float Noise::snoise3(float x, float y, float z) {
+  float n0 = 0, n1 = 0, n2 = 0, n3 = 0;  // Noise contributions from the corners
+
+  // Skew the input space to find the simplex cell
+  float s = (x + y + z) * F3;
+  float xs = x + s, ys = y + s, zs = z + s;
+  int i = FASTFLOOR(xs);
+  int j = FASTFLOOR(ys);
+  int k = FASTFLOOR(zs);
+  // Unskew the cell origin back to (x,y,z) space
+  float t = (i + j + k) * G3;
+  float x0 = x - (i - t);
+  float y0 = y - (j - t);
+  float z0 = z - (k - t);
+
+  // Second and third corner of the tetrahedron, ordered by magnitude
+  int i1, j1, k1, i2, j2, k2;
+  if (x0 >= y0) {
+    if (y0 >= z0) {  // X Y Z order
+      i1 = 1, j1 = 0, k1 = 0, i2 = 1, j2 = 1, k2 = 0;
+    } else if (x0 >= z0) {  // X Z Y order
+      i1 = 1, j1 = 0, k1 = 0, i2 = 1, j2 = 0, k2 = 1;
+    } else {  // Z X Y order
+      i1 = 0, j1 = 0, k1 = 1, i2 = 1, j2 = 0, k2 = 1;
+    }
+  } else {
+    if (y0 < z0) {  // Z Y X order
+      i1 = 0, j1 = 0, k1 = 1, i2 = 0, j2 = 1, k2 = 1;
+    } else if (x0 < z0) {  // Y Z X order
+      i1 = 0, j1 = 1, k1 = 0, i2 = 0, j2 = 1, k2 = 1;
+    } else {  // Y X Z order
+      i1 = 0, j1 = 1, k1 = 0, i2 = 1, j2 = 1, k2 = 0;
+    }
+  }
+
+  float x1 = x0 - i1 + G3;
+  float y1 = y0 - j1 + G3;
+  float z1 = z0 - k1 + G3;
+  float x2 = x0 - i2 + 2.0f * G3;
+  float y2 = y0 - j2 + 2.0f * G3;
+  float z2 = z0 - k2 + 2.0f * G3;
+  float x3 = x0 - 1.0f + 3.0f * G3;
+  float y3 = y0 - 1.0f + 3.0f * G3;
+  float z3 = z0 - 1.0f + 3.0f * G3;
+  int ii = i & 0xff;  // Wrap to 0..255
+  int jj = j & 0xff;
+  int kk = k & 0xff;
+
+  float t0 = 0.5f - x0 * x0 - y0 * y0 - z0 * z0;
+  if (t0 > 0) {
+    t0 *= t0;
+    n0 = t0 * t0 * grad3(perm[ii + perm[jj + perm[kk]]], x0, y0, z0);
+  }
+  float t1 = 0.5f - x1 * x1 - y1 * y1 - z1 * z1;
+  if (t1 > 0) {
+    t1 *= t1;
+    n1 = t1 * t1 *
+         grad3(perm[ii + i1 + perm[jj + j1 + perm[kk + k1]]], x1, y1, z1);
+  }
+  float t2 = 0.5f - x2 * x2 - y2 * y2 - z2 * z2;
+  if (t2 > 0) {
+    t2 *= t2;
+    n2 = t2 * t2 *
+         grad3(perm[ii + i2 + perm[jj + j2 + perm[kk + k2]]], x2, y2, z2);
+  }
+  float t3 = 0.5f - x3 * x3 - y3 * y3 - z3 * z3;
+  if (t3 > 0) {
+    t3 *= t3;
+    n3 = t3 * t3 *
+         grad3(perm[ii + 1 + perm[jj + 1 + perm[kk + 1]]], x3, y3, z3);
+  }
+
+  // 2sd = 0.0102, below 2sd or above 2sd = 95% of the noise surface
+  // scale all between -2sd and +2sd to -0.5 and 0.5 and add 0.5
+  n0 = 0.5f + (n0 + n1 + n2 + n3) * 0.50f / 0.0102f;
+  return CLAMP01(n0);
+}
+/*------------------------------------------------------------------------------
+ * 4D float simplex noise
+ *----------------------------------------------------------------------------*/
+float Noise::snoise4(float x, float y, float z, float w) {
+  COST(SNOISE4, 1);
+  float n0 = 0, n1 = 0, n2 = 0, n3 = 0, n4 = 0;  // Corner contributions
+
+  // Skew the input space to find the simplex cell
+  float s = (x + y + z + w) * F4;
+  float xs = x + s, ys = y + s, zs = z + s, ws = w + s;
+  int i = FASTFLOOR(xs);
+  int j = FASTFLOOR(ys);
+  int k = FASTFLOOR(zs);
+  int l = FASTFLOOR(ws);
+  // Unskew the cell origin back to (x,y,z,w) space
+  float t = (i + j + k + l) * G4;
+  float x0 = x - (i - t);
+  float y0 = y - (j - t);
+  float z0 = z - (k - t);
+  float w0 = w - (l - t);
+
+  // Rank the coordinates, the largest one steps first along the simplex
+  int xy = x0 > y0, xz = x0 > z0, xw = x0 > w0;
+  int yz = y0 > z0, yw = y0 > w0, zw = z0 > w0;
+  int rankx = xy + xz + xw;
+  int ranky = 1 - xy + yz + yw;
+  int rankz = 2 - xz - yz + zw;
+  int rankw = 3 - xw - yw - zw;
+
+  int i1 = rankx >= 3, j1 = ranky >= 3, k1 = rankz >= 3, l1 = rankw >= 3;
+  int i2 = rankx >= 2, j2 = ranky >= 2, k2 = rankz >= 2, l2 = rankw >= 2;
+  int i3 = rankx >= 1, j3 = ranky >= 1, k3 = rankz >= 1, l3 = rankw >= 1;
+
+  float x1 = x0 - i1 + G4;
+  float y1 = y0 - j1 + G4;
+  float z1 = z0 - k1 + G4;
+  float w1 = w0 - l1 + G4;
+  float x2 = x0 - i2 + 2.0f * G4;
+  float y2 = y0 - j2 + 2.0f * G4;
+  float z2 = z0 - k2 + 2.0f * G4;
+  float w2 = w0 - l2 + 2.0f * G4;
+  float x3 = x0 - i3 + 3.0f * G4;
+  float y3 = y0 - j3 + 3.0f * G4;
+  float z3 = z0 - k3 + 3.0f * G4;
+  float w3 = w0 - l3 + 3.0f * G4;
+  float x4 = x0 - 1.0f + 4.0f * G4;
+  float y4 = y0 - 1.0f + 4.0f * G4;
+  float z4 = z0 - 1.0f + 4.0f * G4;
+  float w4 = w0 - 1.0f + 4.0f * G4;
+  int ii = i & 0xff;  // Wrap to 0..255
+  int jj = j & 0xff;
+  int kk = k & 0xff;
+  int ll = l & 0xff;
+
+  float t0 = 0.5f - x0 * x0 - y0 * y0 - z0 * z0 - w0 * w0;
+  if (t0 > 0) {
+    t0 *= t0;
+    n0 = t0 * t0 *
+         grad4(perm[ii + perm[jj + perm[kk + perm[ll]]]], x0, y0, z0, w0);
+  }
+  float t1 = 0.5f - x1 * x1 - y1 * y1 - z1 * z1 - w1 * w1;
+  if (t1 > 0) {
+    t1 *= t1;
+    n1 = t1 * t1 *
+         grad4(perm[ii + i1 + perm[jj + j1 + perm[kk + k1 + perm[ll + l1]]]],
+               x1, y1, z1, w1);
+  }
+  float t2 = 0.5f - x2 * x2 - y2 * y2 - z2 * z2 - w2 * w2;
+  if (t2 > 0) {
+    t2 *= t2;
+    n2 = t2 * t2 *
+         grad4(perm[ii + i2 + perm[jj + j2 + perm[kk + k2 + perm[ll + l2]]]],
+               x2, y2, z2, w2);
+  }
+  float t3 = 0.5f - x3 * x3 - y3 * y3 - z3 * z3 - w3 * w3;
+  if (t3 > 0) {
+    t3 *= t3;
+    n3 = t3 * t3 *
+         grad4(perm[ii + i3 + perm[jj + j3 + perm[kk + k3 + perm[ll + l3]]]],
+               x3, y3, z3, w3);
+  }
+  float t4 = 0.5f - x4 * x4 - y4 * y4 - z4 * z4 - w4 * w4;
+  if (t4 > 0) {
+    t4 *= t4;
+    n4 = t4 * t4 *
+         grad4(perm[ii + 1 + perm[jj + 1 + perm[kk + 1 + perm[ll + 1]]]], x4,
+               y4, z4, w4);
+  }
+
+  // 2sd = 0.0091, below 2sd or above 2sd = 95% of the noise surface
+  // scale all between -2sd and +2sd to -0.5 and 0.5 and add 0.5
+  n0 = 0.5f + (n0 + n1 + n2 + n3 + n4) * 0.50f / 0.0091f;
+  return CLAMP01(n0);
+}
+/*------------------------------------------------------------------------------
+ * Grid sampling of 3D and 4D float Perlin noise
+ *------------------------------------------------------------------------------
+ * Along a z row x, y and w are fixed, so the quadrilinear blend of the corner
+ * gradients collapses into two straight lines, one for each z side of the
+ * current cell: n = a + b * fz. Only a and b need the hashes and gradients,
+ * every sample in the cell then costs two multiply adds and the z fade.
+ *----------------------------------------------------------------------------*/
+namespace {
+// Lattice cell, offset in the cell and fade curve of one coordinate
+struct lattice_t {
+  uint8_t i;
+  float f;
+  float fade;
+};
+
+lattice_t lattice(const float v) {
+  int i = FASTFLOOR(v);
+  float f = v - i;
+  return {(uint8_t)(i & 0xff), f, FADE(f)};
+}
+
+// Scale like the point functions and convert to 0..255
+uint8_t level(const float n, const float sd2) {
+  float v = 0.5f + n * 0.50f / sd2;
+  if (v < 0)
+    v = 0;
+  else if (v > 1)
+    v = 1;
+  return v * 255;
+}
+
+// The gradient grad3() dots with (x,y,z)
+void gradient3(int hash, float g[3]) {
+  int h = hash & 15;
+  g[0] = g[1] = g[2] = 0;
+  g[h < 8 ? 0 : 1] += (h & 1) ? -1 : 1;
+  g[h < 4 ? 1 : h == 12 || h == 14 ? 0 : 2] += (h & 2) ? -1 : 1;
+}
+
+// The gradient grad4() dots with (x,y,z,w)
+void gradient4(int hash, float g[4]) {
+  int h = hash & 31;
+  g[0] = g[1] = g[2] = g[3] = 0;
+  g[h < 24 ? 0 : 1] += (h & 1) ? -1 : 1;
+  g[h < 16 ? 1 : 2] += (h & 2) ? -1 : 1;
+  g[h < 8 ? 2 : 3] += (h & 4) ? -1 : 1;
+}
+
+// Lattice data of the z samples, shared by every row of a fill
+lattice_t column[256];
+}  // namespace
+
+void Noise::fill3(uint8_t *out, uint8_t nx, uint8_t ny, uint8_t nz, float x,
+                  float y, float z, float step, basis_t basis) {
+  if (basis == basis_t::SIMPLEX) {
+    for (uint8_t i = 0; i < nx; i++)
+      for (uint8_t j = 0; j < ny; j++)
+        for (uint8_t k = 0; k < nz; k++)
+          *out++ = snoise3(x + step * i, y + step * j, z + step * k) * 255;
+    return;
+  }
+  for (uint8_t k = 0; k < nz; k++) column[k] = lattice(z + step * k);
+
+  for (uint8_t i = 0; i < nx; i++) {
+    const lattice_t lx = lattice(x + step * i);
+    for (uint8_t j = 0; j < ny; j++) {
+      const lattice_t ly = lattice(y + step * j);
+      float a[2], b[2];
+      for (uint8_t k = 0; k < nz; k++) {
+        const lattice_t &lz = column[k];
+        if (k == 0 || lz.i != column[k - 1].i) {
+          for (uint8_t dz = 0; dz < 2; dz++) {
+            a[dz] = b[dz] = 0;
+            const uint8_t iz = lz.i + dz;
+            for (uint8_t dx = 0; dx < 2; dx++)
+              for (uint8_t dy = 0; dy < 2; dy++) {
+                const uint8_t ix = lx.i + dx, iy = ly.i + dy;
+                const float weight = (dx ? lx.fade : 1 - lx.fade) *
+                                     (dy ? ly.fade : 1 - ly.fade);
+                float g[3];
+                gradient3(perm[ix + perm[iy + perm[iz]]], g);
+                a[dz] += weight * (g[0] * (lx.f - dx) + g[1] * (ly.f - dy) -
+                                   g[2] * dz);
+                b[dz] += weight * g[2];
+              }
+          }
+        }
+        const float n0 = a[0] + b[0] * lz.f;
+        const float n1 = a[1] + b[1] * lz.f;
+        *out++ = level(LERP(lz.fade, n0, n1), 0.54f);
+      }
+    }
+  }
+}
+
+void Noise::fill4(uint8_t *out, uint8_t nx, uint8_t ny, uint8_t nz, float x,
+                  float y, float z, float w, float step, basis_t basis) {
+  if (basis == basis_t::SIMPLEX) {
+    for (uint8_t i = 0; i < nx; i++)
+      for (uint8_t j = 0; j < ny; j++)
+        for (uint8_t k = 0; k < nz; k++)
+          *out++ = snoise4(x + step * i, y + step * j, z + step * k, w) * 255;
+    return;
+  }
+  for (uint8_t k = 0; k < nz; k++) column[k] = lattice(z + step * k);
+  const lattice_t lw = lattice(w);
+
+  for (uint8_t i = 0; i < nx; i++) {
+    const lattice_t lx = lattice(x + step * i);
+    for (uint8_t j = 0; j < ny; j++) {
+      const lattice_t ly = lattice(y + step * j);
+      float a[2], b[2];
+      for (uint8_t k = 0; k < nz; k++) {
+        const lattice_t &lz = column[k];
+        if (k == 0 || lz.i != column[k - 1].i) {
+          for (uint8_t dz = 0; dz < 2; dz++) {
+            a[dz] = b[dz] = 0;
+            const uint8_t iz = lz.i + dz;
+            for (uint8_t dw = 0; dw < 2; dw++) {
+              const uint8_t hzw = perm[iz + perm[(uint8_t)(lw.i + dw)]];
+              for (uint8_t dx = 0; dx < 2; dx++)
+                for (uint8_t dy = 0; dy < 2; dy++) {
+                  const uint8_t ix = lx.i + dx, iy = ly.i + dy;
+                  const float weight = (dx ? lx.fade : 1 - lx.fade) *
+                                       (dy ? ly.fade : 1 - ly.fade) *
+                                       (dw ? lw.fade : 1 - lw.fade);
+                  float g[4];
+                  gradient4(perm[ix + perm[iy + hzw]], g);
+                  a[dz] += weight * (g[0] * (lx.f - dx) + g[1] * (ly.f - dy) -
+                                     g[2] * dz + g[3] * (lw.f - dw));
+                  b[dz] += weight * g[2];
+                }
+            }
+          }
+        }
+        const float n0 = a[0] + b[0] * lz.f;
+        const float n1 = a[1] + b[1] * lz.f;
+        *out++ = level(LERP(lz.fade, n0, n1), 0.58f);
+      }
+    }
+  }
+}
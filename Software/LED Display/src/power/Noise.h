@@ -8,6 +8,20 @@
  * This class generates numbers according to a plan. The numbers can be random,
  * from a Perlin noise like distribution or from a Gaussian distribution.
  *
+ * Random Numbers:
+ * All instances share one xoshiro128** generator, 16 bytes of state and a few
+ * shifts per number. It starts from a fixed seed, seed() restarts the sequence
+ * so runs can be repeated exactly. In the simulator every thread has its own
+ * generator, so animations run side by side repeat their serial sequences. Gaussian values use the ziggurat method,
+ * which needs a single random number for about 99% of the values.
+ *
+ * Hashed Random Numbers:
+ * hash() gives stateless random bits, the same arguments always give the same
+ * bits. An element derives its phase, speed or hue from its index or voxel,
+ * a seed and a time bucket when it draws, instead of storing them or seeding
+ * them in a loop. lowbias32 (Chris Wellons), every input bit flips about half
+ * of the output bits, two multiplies and three shifts.
+ *
  * Perlin Noise:
  * The float x,y,z,w parameters for the noise functions use the integer part &
  * 0xff and the fractional part so the range for integer part is 0 to 255 and
@@ -20,24 +34,96 @@
  * are clamped 2.5% at the lower end and 2.5% at the higher end.
  *
  * NOTE: NOT al values are distributed equally, and 5% of the values are clamped
+ *
+ * Simplex Noise:
+ * snoise2, snoise3 and snoise4 take the same parameters and give the same range
+ * but only visit dimension + 1 corners per sample (5 instead of 16 in 4D). The
+ * basis_t overloads select either kind per call, so an animation can keep the
+ * choice in its settings.
  *----------------------------------------------------------------------------*/
+enum class basis_t : uint8_t { PERLIN, SIMPLEX };
+
+#ifdef SIMULATOR_BUILD
+#define NOISE_THREAD thread_local
+#else
+#define NOISE_THREAD
+#endif
+
 class Noise {
  private:
-  float spare;
-  bool hasSpare = false;
+  static NOISE_THREAD uint32_t state[4];
   static const uint8_t perm[512];
 
+ public:
+  // restart the random sequence from a seed
+  static void seed(const uint32_t seed);
+  // get the next 32 random bits
+  static inline uint32_t next32() {
+    const uint32_t result = rotl(state[1] * 5, 7) * 9;
+    const uint32_t t = state[1] << 9;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 11);
+    return result;
+  }
+
  public:
   // get next normally divided value with given mean and stdev
-  float nextGaussian(const float mean, const float stdev);
+  static float nextGaussian(const float mean, const float stdev);
   // nextGaussian but with a max deviation of range * stdev
-  float nextGaussian(const float mean, const float stdev, const float range);
+  static float nextGaussian(const float mean, const float stdev,
+                            const float range);
 
  public:
   // get a random float value between min and max (boundaries included)
-  float nextRandom(const float min, const float max) const;
+  static float nextRandom(const float min, const float max);
   // get a random uint16_t value between min and max (boundaries included)
-  uint16_t nextRandom16(const uint16_t min, const uint16_t max) const;
+  static uint16_t nextRandom16(const uint16_t min, const uint16_t max);
+
+ public:
+  // random bits of an index, or of a few of them chained
+  static inline uint32_t hash(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352D;
+    x ^= x >> 15;
+    x *= 0x846CA68B;
+    return x ^ (x >> 16);
+  }
+  static inline uint32_t hash(const uint32_t a, const uint32_t b) {
+    return hash(hash(a) + b);
+  }
+  static inline uint32_t hash(const uint32_t a, const uint32_t b,
+                              const uint32_t c) {
+    return hash(hash(a, b) + c);
+  }
+  // random bits of a voxel, a seed and a time bucket
+  static inline uint32_t hash(const uint8_t x, const uint8_t y,
+                              const uint8_t z, const uint32_t seed,
+                              const uint32_t bucket) {
+    return hash(x << 16 | y << 8 | z, seed, bucket);
+  }
+  // a float value between min and max (boundaries included) of hash bits
+  static inline float hashRandom(const uint32_t bits, const float min,
+                                 const float max) {
+    return min + (bits >> 8) * (1.0f / 16777215.0f) * (max - min);
+  }
+
+ public:
+  // fill n values with random bits, random floats or gaussian floats
+  static void fill(uint32_t *out, const uint16_t n);
+  static void fill(float *out, const uint16_t n, const float min,
+                   const float max);
+  static void fillGaussian(float *out, const uint16_t n, const float mean,
+                           const float stdev);
+
+ private:
+  static inline uint32_t rotl(const uint32_t x, const uint8_t k) {
+    return (x << k) | (x >> (32 - k));
+  }
+  static float gaussian();
 
  private:
   float grad1(int hash, float x);
@@ -55,5 +141,33 @@ class Noise {
   float noise4(float x, float y, float z, float w);
   float pnoise4(float x, float y, float z, float w, int px, int py, int pz,
                 int pw);
+
+ public:
+  float snoise2(float x, float y);
+  float snoise3(float x, float y, float z);
+  float snoise4(float x, float y, float z, float w);
+
+  float noise2(float x, float y, basis_t basis) {
+    return basis == basis_t::SIMPLEX ? snoise2(x, y) : noise2(x, y);
+  }
+  float noise3(float x, float y, float z, basis_t basis) {
+    return basis == basis_t::SIMPLEX ? snoise3(x, y, z) : noise3(x, y, z);
+  }
+  float noise4(float x, float y, float z, float w, basis_t basis) {
+    return basis == basis_t::SIMPLEX ? snoise4(x, y, z, w)
+                                     : noise4(x, y, z, w);
+  }
+
+ public:
+  // Sample a regular nx * ny * nz grid starting at (x,y,z) with the same step
+  // on every axis into out[x][y][z] (z fastest). Every sample is noise * 255,
+  // the same value noise3() / noise4() give, but lattice hashes, gradients
+  // and fade curves are only computed when a row enters a new lattice cell.
+  // Simplex noise is sampled point by point.
+  void fill3(uint8_t *out, uint8_t nx, uint8_t ny, uint8_t nz, float x,
+             float y, float z, float step, basis_t basis = basis_t::PERLIN);
+  void fill4(uint8_t *out, uint8_t nx, uint8_t ny, uint8_t nz, float x,
+             float y, float z, float w, float step,
+             basis_t basis = basis_t::PERLIN);
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "NoiseLoop.h"
+
+#include <string.h>
+
+#include "Color32.h"
+#include "Memory.h"
+#include "Upsample.h"
+/*------------------------------------------------------------------------------
+ * NOISELOOP CLASS
+ *----------------------------------------------------------------------------*/
+BULKMEM uint8_t NoiseLoop::keys[KEYS][HALF][HALF][HALF];
+bool NoiseLoop::baked = false;
+
+// Without wrapping in space the spatial periods are the whole lattice
+void NoiseLoop::bake(Noise &noise) {
+  if (baked) return;
+  for (uint8_t k = 0; k < KEYS; k++) {
+    const float w = (float)k * PERIOD / KEYS;
+    for (uint8_t x = 0; x < HALF; x++)
+      for (uint8_t y = 0; y < HALF; y++)
+        for (uint8_t z = 0; z < HALF; z++)
+          keys[k][x][y][z] = noise.pnoise4(x * STEP, y * STEP, z * STEP, w,
+                                           256, 256, 256, PERIOD) *
+                             255;
+  }
+  baked = true;
+}
+
+void NoiseLoop::update(float phase) {
+  phase -= floorf(phase);
+  const uint16_t position = phase * KEYS * 256;
+  const uint8_t from = (position >> 8) % KEYS;
+  const uint8_t to = (from + 1) % KEYS;
+  const uint8_t amount = position;
+  // Blend four samples at a time, a keyframe is a multiple of 4 bytes
+  const uint8_t *a = &keys[from][0][0][0];
+  const uint8_t *b = &keys[to][0][0][0];
+  uint8_t *v = &m_blend[0][0][0];
+  for (uint16_t i = 0; i < sizeof(m_blend); i += 4) {
+    uint32_t pa, pb;
+    memcpy(&pa, a + i, 4);
+    memcpy(&pb, b + i, 4);
+    const uint32_t pv = ublend8(pa, pb, amount);
+    memcpy(v + i, &pv, 4);
+  }
+  upsample(&m_blend[0][0][0], &m_volume[0][0][0], HALF);
+}
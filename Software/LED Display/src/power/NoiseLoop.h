@@ -0,0 +1,50 @@
+#ifndef NOISELOOP_H
+#define NOISELOOP_H
+#include <stdint.h>
+
+#include "Noise.h"
+/*------------------------------------------------------------------------------
+ * NOISELOOP CLASS
+ *------------------------------------------------------------------------------
+ * A 16x16x16 volume of noise that changes smoothly and loops, for ambient
+ * animations that need nothing more. The noise is baked once: KEYS keyframes
+ * of periodic 4D noise (pnoise4 wrapping PERIOD lattice cells along w) are
+ * sampled 8x8x8 into RAM2 the first time bake() is called (a few ms, once
+ * per boot), 16KB shared by all loops (PSRAM on the Teensy 4.1, see
+ * Memory.h). The keyframes are evenly spaced along w, so the last one blends
+ * seamlessly into the first.
+ *
+ * A frame then costs no noise at all, only a blend of the two keyframes
+ * around the phase and upsampling it to the cube (see Upsample.h).
+ *
+ * NoiseLoop loop;
+ * NoiseLoop::bake(noise);   // before the first update, then a no-op
+ * loop.update(phase);       // every frame, a loop per 1.0 of phase
+ * loop.at(x, y, z);         // noise * 255
+ *----------------------------------------------------------------------------*/
+class NoiseLoop {
+ public:
+  static const uint8_t SIZE = 16;
+  static const uint8_t HALF = SIZE / 2;
+  static const uint8_t KEYS = 32;
+  // Lattice cells of the noise along w in a loop
+  static const uint8_t PERIOD = 4;
+
+  // Sample the keyframes, only the first call does
+  static void bake(Noise &noise);
+  // Blend the volume at a phase of the loop, only the fraction is used
+  void update(float phase);
+  uint8_t at(const uint8_t x, const uint8_t y, const uint8_t z) const {
+    return m_volume[x][y][z];
+  }
+
+ private:
+  // Distance between two samples in lattice cells
+  static constexpr float STEP = 0.3f;
+  static uint8_t keys[KEYS][HALF][HALF][HALF];
+  static bool baked;
+
+  uint8_t m_blend[HALF][HALF][HALF];
+  uint8_t m_volume[SIZE][SIZE][SIZE];
+};
+#endif
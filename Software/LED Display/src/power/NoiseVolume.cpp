@@ -0,0 +1,79 @@
+#include "NoiseVolume.h"
+
+#include <string.h>
+
+#include "Color32.h"
+#include "Upsample.h"
+/*------------------------------------------------------------------------------
+ * NOISEVOLUME CLASS
+ *----------------------------------------------------------------------------*/
+NoiseVolume::NoiseVolume(const uint8_t slices, const bool half)
+    : m_slices(slices),
+      m_slicesNext(slices),
+      m_slice(0),
+      m_half(half),
+      m_from(0),
+      m_to(1),
+      m_next(2) {
+  memset(m_volume, 0, sizeof(m_volume));
+}
+
+void NoiseVolume::reset(Noise &noise, float x, float y, float z, float w,
+                        float step, basis_t basis) {
+  m_pending = {x, y, z, w, step, basis};
+  sample(noise, m_from, m_pending, 0, m_half ? HALF : SIZE);
+  memcpy(m_key[m_to], m_key[m_from], sizeof(m_key[0]));
+  memcpy(m_volume, m_key[m_from], sizeof(m_volume));
+  m_slice = 0;
+}
+
+void NoiseVolume::update(Noise &noise, float x, float y, float z, float w,
+                         float step, basis_t basis) {
+  if (m_slice == 0) {
+    m_pending = {x, y, z, w, step, basis};
+    m_slices = m_slicesNext;
+  }
+  const uint8_t planes = (m_half ? HALF : SIZE) / m_slices;
+  sample(noise, m_next, m_pending, m_slice * planes, planes);
+
+  if (++m_slice == m_slices) {
+    // The pending keyframe is complete, blend on towards it
+    const uint8_t from = m_from;
+    m_from = m_to;
+    m_to = m_next;
+    m_next = from;
+    m_slice = 0;
+    memcpy(m_volume, m_key[m_from], sizeof(m_volume));
+    return;
+  }
+
+  // Blend four voxels at a time, the volume is a multiple of 4 bytes
+  const uint8_t amount = m_slice * 256 / m_slices - 1;
+  const uint8_t *a = &m_key[m_from][0][0][0];
+  const uint8_t *b = &m_key[m_to][0][0][0];
+  uint8_t *v = &m_volume[0][0][0];
+  for (uint16_t i = 0; i < sizeof(m_volume); i += 4) {
+    uint32_t pa, pb;
+    memcpy(&pa, a + i, 4);
+    memcpy(&pb, b + i, 4);
+    const uint32_t pv = ublend8(pa, pb, amount);
+    memcpy(v + i, &pv, 4);
+  }
+}
+
+// Sample planes x to x + planes of a keyframe. At half resolution a sample is
+// at the center of 2x2x2 voxels and the last planes complete the keyframe.
+void NoiseVolume::sample(Noise &noise, uint8_t key, const key_t &at, uint8_t x,
+                         uint8_t planes) {
+  if (!m_half) {
+    noise.fill4(&m_key[key][x][0][0], planes, SIZE, SIZE, at.x + at.step * x,
+                at.y, at.z, at.w, at.step, at.basis);
+    return;
+  }
+  const float center = at.step * 0.5f;
+  noise.fill4(&m_sample[x][0][0], planes, HALF, HALF,
+              at.x + at.step * 2 * x + center, at.y + center, at.z + center,
+              at.w, at.step * 2, at.basis);
+  if (x + planes == HALF)
+    upsample(&m_sample[0][0][0], &m_key[key][0][0][0], HALF);
+}
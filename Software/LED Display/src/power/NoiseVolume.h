@@ -0,0 +1,64 @@
+#ifndef NOISEVOLUME_H
+#define NOISEVOLUME_H
+#include <stdint.h>
+
+#include "Noise.h"
+/*------------------------------------------------------------------------------
+ * NOISEVOLUME CLASS
+ *------------------------------------------------------------------------------
+ * A 16x16x16 volume of 4D noise that moves slowly. Instead of sampling the
+ * whole volume every frame, keyframes are computed 1 / slices of the volume
+ * per frame and the volume blends between the last two finished keyframes.
+ * The noise cost per frame drops by the number of slices, the motion stays
+ * smooth but lags slices to 2 * slices frames behind the coordinates.
+ *
+ * At half resolution a keyframe is sampled 8x8x8 and upsampled to 16x16x16
+ * when complete (see Upsample.h), another 8 times less noise.
+ *
+ * NoiseVolume volume = NoiseVolume(4);          // a keyframe every 4 frames
+ * volume.reset(noise, x, y, z, w, step);        // when the animation starts
+ * volume.update(noise, x, y, z, w, step);       // every frame
+ * volume.at(x, y, z);                           // noise * 255
+ *----------------------------------------------------------------------------*/
+class NoiseVolume {
+ public:
+  static const uint8_t SIZE = 16;
+
+  static const uint8_t HALF = SIZE / 2;
+
+  // slices is 1, 2, 4, 8 or 16, 8 at most at half resolution
+  NoiseVolume(const uint8_t slices, const bool half = false);
+  // Start over with both keyframes sampled at the given coordinates
+  void reset(Noise &noise, float x, float y, float z, float w, float step,
+             basis_t basis = basis_t::PERLIN);
+  // Sample the next slice of the pending keyframe and blend the volume,
+  // the coordinates are latched when a new keyframe starts
+  void update(Noise &noise, float x, float y, float z, float w, float step,
+              basis_t basis = basis_t::PERLIN);
+  // Slices of the keyframes from the next one on
+  void setSlices(const uint8_t slices) { m_slicesNext = slices; }
+  uint8_t at(const uint8_t x, const uint8_t y, const uint8_t z) const {
+    return m_volume[x][y][z];
+  }
+
+ private:
+  struct key_t {
+    float x, y, z, w, step;
+    basis_t basis;
+  };
+  void sample(Noise &noise, uint8_t key, const key_t &at, uint8_t x,
+              uint8_t planes);
+
+  uint8_t m_slices;
+  uint8_t m_slicesNext;
+  uint8_t m_slice;
+  bool m_half;
+  // keyframes blended from, to and being computed
+  uint8_t m_from, m_to, m_next;
+  key_t m_pending;
+  uint8_t m_key[3][SIZE][SIZE][SIZE];
+  // keyframe being computed at half resolution
+  uint8_t m_sample[HALF][HALF][HALF];
+  uint8_t m_volume[SIZE][SIZE][SIZE];
+};
+#endif
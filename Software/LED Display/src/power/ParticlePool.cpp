@@ -0,0 +1,240 @@
+#include "ParticlePool.h"
+
+#include <math.h>
+/*------------------------------------------------------------------------------
+ * PARTICLE ARENA
+ *----------------------------------------------------------------------------*/
+static const uint16_t BLOCKS = ParticlePool::ARENA / ParticlePool::BLOCK;
+static_assert(BLOCKS <= 16, "one bit per block in ParticlePool::used");
+
+static struct {
+  float x[ParticlePool::ARENA];
+  float y[ParticlePool::ARENA];
+  float z[ParticlePool::ARENA];
+  float vx[ParticlePool::ARENA];
+  float vy[ParticlePool::ARENA];
+  float vz[ParticlePool::ARENA];
+  float life[ParticlePool::ARENA];
+  float rate[ParticlePool::ARENA];
+  uint8_t hue[ParticlePool::ARENA];
+  float sx[ParticlePool::ARENA];
+  float sy[ParticlePool::ARENA];
+  float sz[ParticlePool::ARENA];
+  float born[ParticlePool::ARENA];
+  float ends[ParticlePool::ARENA];
+} arena;
+
+uint16_t ParticlePool::used = 0;
+/*------------------------------------------------------------------------------
+ * PARTICLEPOOL CLASS
+ *----------------------------------------------------------------------------*/
+ParticlePool::ParticlePool()
+    : m_first(0),
+      m_capacity(0),
+      m_count(0),
+      m_gravity(0),
+      m_floor(-1e9f),
+      m_side(0),
+      m_rest(false) {
+  bind();
+}
+ParticlePool::~ParticlePool() { release(); }
+
+// Reserve the first free run of blocks, or the largest one when the arena
+// is too full. A pool that is already holding blocks gives them back first.
+uint16_t ParticlePool::acquire(const uint16_t capacity) {
+  release();
+  uint16_t want = (capacity + BLOCK - 1) / BLOCK;
+  uint16_t best = 0, bestLength = 0;
+  for (uint16_t b = 0; b < BLOCKS;) {
+    if (used & (1 << b)) {
+      b++;
+      continue;
+    }
+    uint16_t length = 0;
+    while (b + length < BLOCKS && !(used & (1 << (b + length)))) length++;
+    if (length > bestLength) {
+      best = b;
+      bestLength = length;
+    }
+    if (length >= want) break;
+    b += length;
+  }
+  if (bestLength > want) bestLength = want;
+  for (uint16_t b = best; b < best + bestLength; b++) used |= 1 << b;
+  m_first = best * BLOCK;
+  m_capacity = bestLength * BLOCK;
+  m_count = 0;
+  bind();
+  return m_capacity;
+}
+
+void ParticlePool::release() {
+  for (uint16_t b = m_first / BLOCK; b < (m_first + m_capacity) / BLOCK; b++)
+    used &= ~(1 << b);
+  m_capacity = 0;
+  m_count = 0;
+}
+
+int16_t ParticlePool::add(const Vector3 p, const Vector3 v, const uint8_t h,
+                          const float l, const float r) {
+  if (m_count >= m_capacity) return -1;
+  uint16_t i = m_count++;
+  x[i] = p.x;
+  y[i] = p.y;
+  z[i] = p.z;
+  vx[i] = v.x;
+  vy[i] = v.y;
+  vz[i] = v.z;
+  life[i] = l;
+  rate[i] = r;
+  hue[i] = h;
+  return i;
+}
+
+void ParticlePool::clear() { m_count = 0; }
+
+void ParticlePool::integrate(const float dt) {
+  float *__restrict px = x, *__restrict py = y, *__restrict pz = z;
+  const float *__restrict qx = vx, *__restrict qy = vy, *__restrict qz = vz;
+  for (uint16_t i = 0; i < m_count; i++) {
+    px[i] += qx[i] * dt;
+    py[i] += qy[i] * dt;
+    pz[i] += qz[i] * dt;
+  }
+}
+
+void ParticlePool::integrate(const float dt, const Vector3 gravity) {
+  integrate(dt);
+  const float gx = gravity.x * dt, gy = gravity.y * dt, gz = gravity.z * dt;
+  float *__restrict qx = vx, *__restrict qy = vy, *__restrict qz = vz;
+  for (uint16_t i = 0; i < m_count; i++) {
+    qx[i] += gx;
+    qy[i] += gy;
+    qz[i] += gz;
+  }
+}
+
+void ParticlePool::age(const float dt) {
+  float *__restrict l = life;
+  const float *__restrict r = rate;
+  for (uint16_t i = 0; i < m_count; i++) l[i] = fmaxf(l[i] - r[i] * dt, 0.0f);
+}
+
+void ParticlePool::ground(const float h) {
+  for (uint16_t i = 0; i < m_count; i++) {
+    if (y[i] < h) {
+      y[i] = h;
+      vx[i] = vy[i] = vz[i] = 0;
+    }
+  }
+}
+
+uint16_t ParticlePool::compact(const float h) {
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < m_count; i++) {
+    if (life[i] <= 0 || y[i] < h) continue;
+    if (n != i) move(i, n);
+    n++;
+  }
+  return m_count = n;
+}
+
+void ParticlePool::ballistic(const float gravity, const float floor,
+                             const float side, const bool rest) {
+  m_gravity = gravity;
+  m_floor = floor;
+  m_side = side;
+  m_rest = rest;
+}
+
+// Time from s with velocity v until the wall at +-side, infinite without one
+static float leaves(const float s, const float v, const float side) {
+  if (v > 0) return (side - s) / v;
+  if (v < 0) return (-side - s) / v;
+  return INFINITY;
+}
+
+int16_t ParticlePool::launch(const float t, const Vector3 p, const Vector3 v,
+                             const uint8_t h, const float l, const float r) {
+  const int16_t i = add(p, v, h, l, r);
+  if (i < 0) return i;
+  sx[i] = p.x;
+  sy[i] = p.y;
+  sz[i] = p.z;
+  born[i] = t;
+  // Later root of floor = y + v t + g t^2 / 2, the earlier one is the past
+  const float a = 0.5f * m_gravity, c = p.y - m_floor;
+  float lands = INFINITY;
+  if (c <= 0)
+    lands = v.y > 0 && a < 0 ? -v.y / a : 0;
+  else if (a < 0)
+    lands = (-v.y - sqrtf(v.y * v.y - 4 * a * c)) / (2 * a);
+  else if (v.y < 0)
+    lands = c / -v.y;
+  if (!m_rest && m_side > 0)
+    lands = fminf(lands, fminf(leaves(p.x, v.x, m_side),
+                               leaves(p.z, v.z, m_side)));
+  ends[i] = t + lands;
+  return i;
+}
+
+void ParticlePool::fly(const float t) {
+  const float a = 0.5f * m_gravity;
+  for (uint16_t i = 0; i < m_count; i++) {
+    // A resting particle stays where it landed
+    const float s = (m_rest ? fminf(t, ends[i]) : t) - born[i];
+    x[i] = sx[i] + vx[i] * s;
+    y[i] = sy[i] + (vy[i] + a * s) * s;
+    z[i] = sz[i] + vz[i] * s;
+  }
+}
+
+uint16_t ParticlePool::expire(const float t) {
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < m_count; i++) {
+    if (life[i] <= 0 || (!m_rest && t >= ends[i])) continue;
+    if (n != i) move(i, n);
+    n++;
+  }
+  return m_count = n;
+}
+
+uint16_t ParticlePool::count() const { return m_count; }
+uint16_t ParticlePool::capacity() const { return m_capacity; }
+
+// Point the arrays at the reserved slice of the arena
+void ParticlePool::bind() {
+  x = arena.x + m_first;
+  y = arena.y + m_first;
+  z = arena.z + m_first;
+  vx = arena.vx + m_first;
+  vy = arena.vy + m_first;
+  vz = arena.vz + m_first;
+  life = arena.life + m_first;
+  rate = arena.rate + m_first;
+  hue = arena.hue + m_first;
+  sx = arena.sx + m_first;
+  sy = arena.sy + m_first;
+  sz = arena.sz + m_first;
+  born = arena.born + m_first;
+  ends = arena.ends + m_first;
+}
+
+// Particle from to the lower index to, while compacting
+void ParticlePool::move(const uint16_t from, const uint16_t to) {
+  x[to] = x[from];
+  y[to] = y[from];
+  z[to] = z[from];
+  vx[to] = vx[from];
+  vy[to] = vy[from];
+  vz[to] = vz[from];
+  life[to] = life[from];
+  rate[to] = rate[from];
+  hue[to] = hue[from];
+  sx[to] = sx[from];
+  sy[to] = sy[from];
+  sz[to] = sz[from];
+  born[to] = born[from];
+  ends[to] = ends[from];
+}
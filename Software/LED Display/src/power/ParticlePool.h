@@ -0,0 +1,100 @@
+#ifndef PARTICLEPOOL_H
+#define PARTICLEPOOL_H
+#include <stdint.h>
+
+#include "Math3D.h"
+/*------------------------------------------------------------------------------
+ * PARTICLEPOOL CLASS
+ *------------------------------------------------------------------------------
+ * The ParticlePool class keeps particles as a structure of arrays. All pools
+ * share one arena of ARENA particles that is handed out in blocks of BLOCK, so
+ * animations only hold memory while they are running. Every pass is a plain
+ * loop over separate arrays which the compiler can pipeline and unroll.
+ *
+ * ParticlePool p;
+ * p.acquire(200);      // reserve room, returns the capacity received
+ * p.add(...);          // spawn a particle, -1 when the pool is full
+ * p.integrate(dt, Vector3(0, -1, 0));
+ * p.age(dt);
+ * p.compact();         // drop particles without life
+ * p.release();         // hand the room back to the arena
+ *
+ * Ballistic particles are not integrated. launch() keeps the position and
+ * velocity at their time of birth, fly() evaluates every position at the time
+ * of the frame under a gravity along y, so the paths do not depend on the
+ * frame rate and cost the same whatever dt was. The time a particle reaches
+ * the floor, or leaves the sides, is solved once at launch: particles of a
+ * resting pool lie where they landed until their life is gone, the others are
+ * dropped by expire() from then on.
+ *
+ * p.ballistic(-10.0f, -7.5f, 8.0f);  // gravity, floor and sides
+ * p.launch(t, position, velocity, hue, 1.0f, 0.2f);
+ * p.fly(t);
+ * p.age(dt);
+ * p.expire(t);
+ *----------------------------------------------------------------------------*/
+class ParticlePool {
+ public:
+  static const uint16_t ARENA = 512;
+  static const uint16_t BLOCK = 32;
+
+  // position and velocity in system coordinates
+  float *x, *y, *z;
+  float *vx, *vy, *vz;
+  // (0.0f - 1.0f) brightness, particles without life are compacted
+  float *life;
+  // life lost per second
+  float *rate;
+  // position in color palette
+  uint8_t *hue;
+  // ballistic position and time of birth, the time of landing or leaving
+  float *sx, *sy, *sz;
+  float *born;
+  float *ends;
+
+  ParticlePool();
+  ~ParticlePool();
+  uint16_t acquire(const uint16_t capacity);
+  void release();
+  int16_t add(const Vector3 p, const Vector3 v, const uint8_t h = 0,
+              const float l = 1.0f, const float r = 1.0f);
+  void clear();
+  // position += velocity * dt, velocity += gravity * dt
+  void integrate(const float dt);
+  void integrate(const float dt, const Vector3 gravity);
+  // life -= rate * dt, limited to zero
+  void age(const float dt);
+  // particles below h rest there without moving
+  void ground(const float h);
+  // remove particles without life or below h, keeps order
+  uint16_t compact(const float h = -1e9f);
+  // gravity along y for launch() and fly(), the floor and the sides at +-side
+  // (0 for none), a resting pool keeps landed particles on the floor
+  void ballistic(const float gravity, const float floor, const float side = 0,
+                 const bool rest = false);
+  // spawn a ballistic particle born at time t, -1 when the pool is full
+  int16_t launch(const float t, const Vector3 p, const Vector3 v,
+                 const uint8_t h = 0, const float l = 1.0f,
+                 const float r = 1.0f);
+  // positions of the ballistic particles at time t
+  void fly(const float t);
+  // remove particles without life or past their landing or leaving, keeps
+  // order
+  uint16_t expire(const float t);
+  uint16_t count() const;
+  uint16_t capacity() const;
+
+ private:
+  // arena blocks in use, bit n is block n
+  static uint16_t used;
+  uint16_t m_first;
+  uint16_t m_capacity;
+  uint16_t m_count;
+  float m_gravity;
+  float m_floor;
+  float m_side;
+  bool m_rest;
+  void bind();
+  void move(const uint16_t from, const uint16_t to);
+};
+#endif
@@ -0,0 +1,32 @@
+#include "Predictor.h"
+/*------------------------------------------------------------------------------
+ * PREDICTOR CLASS
+ *----------------------------------------------------------------------------*/
+Predictor::Predictor(const float a, const float b, const uint16_t ms)
+    : alpha(a), beta(b), ahead(ms) {}
+
+void Predictor::update(const Vector3 &sample, const uint32_t time) {
+  const int32_t elapsed = time - last;
+  if (started && elapsed < 0) return;
+  if (!started || elapsed >= 1000) {
+    value = sample;
+    rate = Vector3(0, 0, 0);
+    last = time;
+    started = true;
+    return;
+  }
+  // Samples of the same ms only correct the value
+  const float dt = elapsed * 0.001f;
+  const Vector3 residual = sample - (value + rate * dt);
+  value += rate * dt + residual * alpha;
+  if (dt > 0) rate += residual * (beta / dt);
+  last = time;
+}
+
+Vector3 Predictor::at(const uint32_t time) const {
+  if (!started) return Vector3(0, 0, 0);
+  int32_t elapsed = time - last;
+  if (elapsed < 0) elapsed = 0;
+  if (elapsed > ahead) elapsed = ahead;
+  return value + rate * (elapsed * 0.001f);
+}
@@ -0,0 +1,41 @@
+#ifndef PREDICTOR_H
+#define PREDICTOR_H
+#include <stdint.h>
+
+#include "Math3D.h"
+/*------------------------------------------------------------------------------
+ * PREDICTOR CLASS
+ *------------------------------------------------------------------------------
+ * An alpha-beta filter over timestamped samples of a vector, to smooth the
+ * noise of an input and extrapolate it to when the frame is on the leds. A
+ * sample moves the filtered value alpha of the way to itself and the rate of
+ * change beta of the residual per second, larger is quicker and noisier.
+ * Prediction is capped at ahead ms past the last sample, so an input that
+ * stops does not run away. A sample older than the last is ignored, one a
+ * second or more after it starts the filter over.
+ *
+ * Predictor p = Predictor(0.5f, 0.1f, 100);
+ * p.update(Vector3(hid.x, hid.z, hid.y), hid.time);
+ * Vector3 v = p.at(Scheduler::shown());
+ *----------------------------------------------------------------------------*/
+class Predictor {
+ public:
+  Predictor(const float alpha = 0.5f, const float beta = 0.1f,
+            const uint16_t ahead = 100);
+  // A sample taken at time ms
+  void update(const Vector3 &sample, const uint32_t time);
+  // The filtered value extrapolated to time ms, zero before any sample
+  Vector3 at(const uint32_t time) const;
+  bool valid() const { return started; }
+  void reset() { started = false; }
+
+ private:
+  float alpha;
+  float beta;
+  uint16_t ahead;
+  bool started = false;
+  uint32_t last = 0;
+  Vector3 value;
+  Vector3 rate;
+};
+#endif
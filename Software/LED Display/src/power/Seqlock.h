@@ -0,0 +1,49 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * SEQLOCK CLASS
+ *------------------------------------------------------------------------------
+ * Latest value of T from one writer for any number of readers. The sequence
+ * is odd while a write is in progress, a reader copies the value and retries
+ * when the sequence was odd or moved meanwhile. Writers never wait, readers
+ * only retry when they overlap a write, and no reader sees a torn value.
+ *
+ * Seqlock<accelerometer_t> latest;
+ * latest.write(a);                  // writer
+ * uint32_t n = latest.read(a);      // reader, n = writes so far, 0 is none
+ *----------------------------------------------------------------------------*/
+template <typename T>
+class Seqlock {
+ public:
+  void write(const T &value) {
+    const uint32_t s = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy((void *)&m_value, &value, sizeof(T));
+    m_sequence.store(s + 2, std::memory_order_release);
+  }
+
+  uint32_t read(T &value) const {
+    uint32_t s1, s2;
+    do {
+      s1 = m_sequence.load(std::memory_order_acquire);
+      memcpy((void *)&value, (const void *)&m_value, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      s2 = m_sequence.load(std::memory_order_relaxed);
+    } while ((s1 & 1) || s1 != s2);
+    return s1 / 2;
+  }
+
+  // Number of writes so far, to see if there is anything new
+  uint32_t sequence() const {
+    return m_sequence.load(std::memory_order_acquire) / 2;
+  }
+
+ private:
+  std::atomic<uint32_t> m_sequence{0};
+  volatile T m_value{};
+};
+#endif
@@ -0,0 +1,75 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+#include <stdint.h>
+#include <string.h>
+
+#include "Math3D.h"
+/*------------------------------------------------------------------------------
+ * SPATIALGRID CLASS
+ *------------------------------------------------------------------------------
+ * Uniform 4x4x4 grid over the cube in system coordinates (-8..8), so every
+ * cell is 4 voxels wide. build() sorts the items into their cells with a
+ * counting sort, query() visits the items in the 27 cells around a position.
+ * Every item within SIZE of that position is visited, some further away as
+ * well, so compare squared distances in the visitor. Positions outside the
+ * cube are kept in the outer cells.
+ *
+ * SpatialGrid grid;
+ * grid.build(n, [&](uint16_t i) { return Vector3(x[i], y[i], z[i]); });
+ * grid.query(p, [&](uint16_t i) { ... });
+ *----------------------------------------------------------------------------*/
+class SpatialGrid {
+ public:
+  static const uint8_t CELLS = 4;
+  static constexpr float SIZE = 4.0f;
+  static const uint16_t CAPACITY = 512;
+
+ private:
+  // Items of cell c are items[start[c]] up to items[start[c + 1]]
+  uint16_t start[CELLS * CELLS * CELLS + 1];
+  uint16_t items[CAPACITY];
+  uint8_t cells[CAPACITY];
+
+  static inline uint8_t axis(const float v) {
+    const int32_t c = (int32_t)((v + CELLS * SIZE / 2) * (1 / SIZE));
+    return c < 0 ? 0 : c >= CELLS ? CELLS - 1 : c;
+  }
+  static inline uint8_t index(const uint8_t x, const uint8_t y,
+                              const uint8_t z) {
+    return (x * CELLS + y) * CELLS + z;
+  }
+
+ public:
+  // Sort n items (at most CAPACITY) by the cell of position(i)
+  template <typename F>
+  void build(uint16_t n, F position) {
+    if (n > CAPACITY) n = CAPACITY;
+    memset(start, 0, sizeof(start));
+    for (uint16_t i = 0; i < n; i++) {
+      const Vector3 p = position(i);
+      cells[i] = index(axis(p.x), axis(p.y), axis(p.z));
+      start[cells[i] + 1]++;
+    }
+    for (uint8_t c = 0; c < CELLS * CELLS * CELLS; c++)
+      start[c + 1] += start[c];
+    uint16_t next[CELLS * CELLS * CELLS];
+    memcpy(next, start, sizeof(next));
+    for (uint16_t i = 0; i < n; i++) items[next[cells[i]]++] = i;
+  }
+
+  // Call visit(i) for every item in the cells around p, cells along z are
+  // consecutive so every (x, y) is one run of items
+  template <typename F>
+  void query(const Vector3 &p, F visit) const {
+    const uint8_t cx = axis(p.x), cy = axis(p.y), cz = axis(p.z);
+    const uint8_t z1 = cz > 0 ? cz - 1 : 0;
+    const uint8_t z2 = cz < CELLS - 1 ? cz + 1 : cz;
+    for (uint8_t x = cx > 0 ? cx - 1 : 0; x <= cx + 1 && x < CELLS; x++)
+      for (uint8_t y = cy > 0 ? cy - 1 : 0; y <= cy + 1 && y < CELLS; y++) {
+        const uint16_t end = start[index(x, y, z2) + 1];
+        for (uint16_t i = start[index(x, y, z1)]; i < end; i++)
+          visit(items[i]);
+      }
+  }
+};
+#endif
@@ -0,0 +1,31 @@
+#include "SphereMap.h"
+
+#include <math.h>
+/*------------------------------------------------------------------------------
+ * SPHEREMAP CLASS
+ *----------------------------------------------------------------------------*/
+uint16_t SphereMap::shell[16][16];
+SphereMap::point_t SphereMap::points[COUNT];
+bool SphereMap::built = false;
+
+void SphereMap::build() {
+  if (built) return;
+  point_t *p = points;
+  for (uint8_t x = 0; x < 16; x++)
+    for (uint8_t y = 0; y < 16; y++) {
+      shell[x][y] = 0;
+      for (uint8_t z = 0; z < 16; z++) {
+        const float fx = x - 7.5f, fy = y - 7.5f, fz = z - 7.5f;
+        const float d = sqrtf(fx * fx + fy * fy + fz * fz);
+        if (d < RADIUS - SHELL || d > RADIUS + SHELL || p == points + COUNT)
+          continue;
+        shell[x][y] |= 1 << z;
+        // asin -pi/2 to pi/2 onto 0 to 32767, atan2 wraps onto 0 to 65535
+        const float lat = (asinf(fy / d) / (float)M_PI + 0.5f) * 32768;
+        p->lat = lat < 32767 ? (uint16_t)lat : 32767;
+        p->lon = (int32_t)lroundf(atan2f(fz, fx) / (2 * (float)M_PI) * 65536);
+        p++;
+      }
+    }
+  built = true;
+}
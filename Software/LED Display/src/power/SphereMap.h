@@ -0,0 +1,64 @@
+#ifndef SPHEREMAP_H
+#define SPHEREMAP_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * SPHEREMAP CLASS
+ *------------------------------------------------------------------------------
+ * Latitude and longitude of every voxel on the shell of the largest sphere in
+ * the cube (radius RADIUS, SHELL thick on both sides), computed once with trig
+ * by build() for all animations that wrap an image around a sphere. Angles
+ * are fixed point turns: longitude 0 to 65535 for a full turn (from +x
+ * towards +z), latitude 0 to 32767 from the south pole to the north pole
+ * (-y to +y). A spin about y is an add on the longitude that wraps by
+ * itself, the image is fetched without trig.
+ *
+ * shell[x][y] holds the members of a column as bits z, like the occupancy of
+ * the display. each() visits them in x, y, z order with their angles.
+ *
+ * SphereMap::build();  // before the first each(), then a no-op
+ * SphereMap::each([&](uint8_t x, uint8_t y, uint8_t z, uint16_t lat,
+ *                     uint16_t lon) {
+ *   const uint16_t r = SphereMap::row(lat, 5);         // 32 rows
+ *   const uint16_t c = SphereMap::column(lon + spin, 6);  // 64 columns
+ *   voxel(x, y, z, image[r][c]);
+ * });
+ *----------------------------------------------------------------------------*/
+class SphereMap {
+ public:
+  static constexpr float RADIUS = 7.0f;
+  static constexpr float SHELL = 0.8f;
+  // Voxels on the shell of RADIUS and SHELL
+  static const uint16_t COUNT = 1040;
+
+  struct point_t {
+    uint16_t lat;
+    uint16_t lon;
+  };
+
+  static uint16_t shell[16][16];
+  static point_t points[COUNT];
+
+  // Compute the shell, only the first call does
+  static void build();
+
+  // Row and column of an image of 2^bits rows (latitude) or columns
+  static inline uint16_t row(const uint16_t lat, const uint8_t bits) {
+    return lat >> (15 - bits);
+  }
+  static inline uint16_t column(const uint16_t lon, const uint8_t bits) {
+    return lon >> (16 - bits);
+  }
+
+  template <typename F>
+  static void each(F f) {
+    const point_t *p = points;
+    for (uint8_t x = 0; x < 16; x++)
+      for (uint8_t y = 0; y < 16; y++)
+        for (uint16_t bits = shell[x][y]; bits; bits &= bits - 1, p++)
+          f(x, y, (uint8_t)__builtin_ctz(bits), p->lat, p->lon);
+  }
+
+ private:
+  static bool built;
+};
+#endif
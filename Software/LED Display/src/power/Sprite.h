@@ -0,0 +1,53 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+#include <stdint.h>
+
+#include "Color.h"
+/*------------------------------------------------------------------------------
+ * SPRITE CLASS
+ *------------------------------------------------------------------------------
+ * Frames of a Piskel export converted by sprite_convert.py. Every frame has
+ * its own palette of at most 255 colors, its pixels are runs of (length,
+ * palette index) bytes where index 0 is transparent. Runs never cross a line,
+ * so every line of every frame can be decoded on its own. Decoding streams
+ * the opaque pixels into a visitor, transparent runs are skipped at once.
+ *
+ * Sprite::frame(mario_sprite, 2, [&](uint8_t x, uint8_t y, Color c) { ... });
+ *----------------------------------------------------------------------------*/
+struct sprite_t {
+  uint8_t width;
+  uint8_t height;
+  uint8_t count;
+  const uint8_t *palette;    // r, g, b of the colors of all frames
+  const uint16_t *palettes;  // first color of every frame
+  const uint8_t *runs;       // (length, index) of all frames
+  const uint16_t *lines;     // first run of every line of every frame
+};
+
+class Sprite {
+ public:
+  // Visit the opaque pixels of a line as visit(x, color)
+  template <typename F>
+  static void line(const sprite_t &s, const uint8_t frame, const uint8_t y,
+                   F visit) {
+    const uint8_t *palette = &s.palette[s.palettes[frame] * 3];
+    const uint8_t *run = &s.runs[s.lines[frame * s.height + y] * 2];
+    for (uint8_t x = 0; x < s.width; run += 2) {
+      const uint8_t length = run[0], index = run[1];
+      if (index) {
+        const uint8_t *p = &palette[(index - 1) * 3];
+        const Color c = Color(p[0], p[1], p[2]);
+        for (uint8_t i = 0; i < length; i++) visit(x + i, c);
+      }
+      x += length;
+    }
+  }
+
+  // Visit the opaque pixels of a frame as visit(x, y, color)
+  template <typename F>
+  static void frame(const sprite_t &s, const uint8_t frame, F visit) {
+    for (uint8_t y = 0; y < s.height; y++)
+      line(s, frame, y, [&](uint8_t x, const Color &c) { visit(x, y, c); });
+  }
+};
+#endif
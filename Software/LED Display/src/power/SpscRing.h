@@ -0,0 +1,49 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+#include <atomic>
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * SPSCRING CLASS
+ *------------------------------------------------------------------------------
+ * Lock free ring of N (a power of two) items between one producer and one
+ * consumer. Each side only writes its own index, published with release and
+ * read with acquire, so push and pop never block or disable interrupts. A
+ * push into a full ring fails, the consumer decides what is stale.
+ *
+ * SpscRing<sample_t, 16> ring;
+ * ring.push(sample);              // producer, false when full
+ * while (ring.pop(sample)) {...}  // consumer, false when empty
+ *----------------------------------------------------------------------------*/
+template <typename T, uint16_t N>
+class SpscRing {
+  static_assert(N && (N & (N - 1)) == 0, "N must be a power of two");
+
+ public:
+  bool push(const T &item) {
+    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == N) return false;
+    m_items[tail & (N - 1)] = item;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    const uint32_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) return false;
+    item = m_items[head & (N - 1)];
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint16_t size() const {
+    return m_tail.load(std::memory_order_acquire) -
+           m_head.load(std::memory_order_acquire);
+  }
+
+ private:
+  // Free running, only the low bits index the items
+  std::atomic<uint32_t> m_head{0};
+  std::atomic<uint32_t> m_tail{0};
+  T m_items[N];
+};
+#endif
@@ -2,6 +2,23 @@
 /*------------------------------------------------------------------------------
  * TIMER CLASS
  *----------------------------------------------------------------------------*/
+uint64_t Timer::clock = 0;
+uint32_t Timer::lastMicros = 0;
+uint32_t Timer::fixedStep = 0;
+
+// Only the difference of micros() is used, so its wrap is harmless
+void Timer::tick() {
+  const uint32_t m = micros();
+  clock += fixedStep ? fixedStep : (uint32_t)(m - lastMicros);
+  lastMicros = m;
+}
+void Timer::tick(const uint32_t elapsed) {
+  clock += elapsed;
+  lastMicros = micros();
+}
+void Timer::setFixedStep(const float step) { fixedStep = step * 1000000.0f; }
+uint64_t Timer::now() { return clock; }
+
 Timer::Timer() { operator=(0); }
 Timer::Timer(const float alarm) { operator=(alarm); }
 Timer::Timer(const float alarm, const float ratio, const bool inversed) {
@@ -15,18 +32,18 @@ Timer::Timer(const float alarm, const float ratio, const bool inversed) {
 void Timer::operator=(const float alarm) {
   m_alarmCount = 0;
   m_alarmTime = alarm * 1000000.0f;
-  m_currentTime = micros();
+  m_currentTime = now();
   m_startTime = m_currentTime;
   m_lastTime = m_currentTime;
 }
 void Timer::reset() {
   m_alarmCount = 0;
-  m_currentTime = micros();
+  m_currentTime = now();
   m_startTime = m_currentTime;
   m_lastTime = m_currentTime;
 }
 void Timer::update_internals() {
-  m_currentTime = micros();
+  m_currentTime = now();
   m_deltaTime = m_currentTime - m_lastTime;
   m_runTime = m_currentTime - m_startTime;
   m_lastTime = m_currentTime;
@@ -15,8 +15,24 @@
  * Returns an integer of the times the timer has counted 0.10 seconds but only
  * if the next alarm threshold has passed since last call to update, otherwise
  * returns zero.
+ *
+ * All timers read one shared frame clock instead of micros(). Timer::tick()
+ * samples it once per frame, so every timer sees the same time within a frame.
+ * The clock counts microseconds in 64 bits and does not wrap after 71 minutes
+ * like micros(). With a fixed step every tick advances the clock by exactly
+ * that step, which makes playback independent of the real frame rate.
  *----------------------------------------------------------------------------*/
 class Timer {
+ public:
+  // sample the frame clock, or advance it by the fixed step
+  static void tick();
+  // advance the clock by elapsed microseconds instead
+  static void tick(const uint32_t elapsed);
+  // advance by step seconds every tick, 0 goes back to real time
+  static void setFixedStep(const float step);
+  // frame clock in microseconds
+  static uint64_t now();
+
  public:
   Timer();
   Timer(const float alarm);
@@ -34,16 +50,20 @@ class Timer {
   float set_time() const;
 
  private:
+  static uint64_t clock;
+  static uint32_t lastMicros;
+  static uint32_t fixedStep;
+
   void update_internals();
   // alarm time in microseconds
-  unsigned long m_alarmTime = 0;
+  uint64_t m_alarmTime = 0;
   // amount of times counted to alarm
   unsigned long m_alarmCount = 0;
   // time management in microseconds
-  unsigned long m_startTime = 0;
-  unsigned long m_lastTime = 0;
-  unsigned long m_currentTime = 0;
-  unsigned long m_deltaTime = 0;
-  unsigned long m_runTime = 0;
+  uint64_t m_startTime = 0;
+  uint64_t m_lastTime = 0;
+  uint64_t m_currentTime = 0;
+  uint64_t m_deltaTime = 0;
+  uint64_t m_runTime = 0;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "Upsample.h"
+/*------------------------------------------------------------------------------
+ * UPSAMPLE
+ *----------------------------------------------------------------------------*/
+// Upsampled along z, then along y
+static uint16_t rows[8][16][16];
+static uint16_t planes[8][16][16];
+
+void upsample(const uint8_t *in, uint8_t *out, const uint8_t height) {
+  for (uint8_t x = 0; x < 8; x++)
+    for (uint8_t y = 0; y < height; y++) {
+      const uint8_t *s = in + (x * height + y) * 8;
+      uint16_t *d = rows[x][y];
+      for (uint8_t i = 0; i < 8; i++) {
+        const uint16_t a = 3 * s[i];
+        d[2 * i] = a + s[i ? i - 1 : 0];
+        d[2 * i + 1] = a + s[i < 7 ? i + 1 : 7];
+      }
+    }
+  // A full resolution y is 4 times less in the sum
+  uint16_t(*p)[16][16] = rows;
+  uint8_t shift = 4;
+  if (height == 8) {
+    for (uint8_t x = 0; x < 8; x++)
+      for (uint8_t z = 0; z < 16; z++)
+        for (uint8_t i = 0; i < 8; i++) {
+          const uint16_t a = 3 * rows[x][i][z];
+          planes[x][2 * i][z] = a + rows[x][i ? i - 1 : 0][z];
+          planes[x][2 * i + 1][z] = a + rows[x][i < 7 ? i + 1 : 7][z];
+        }
+    p = planes;
+    shift = 6;
+  }
+  const uint16_t round = 1 << (shift - 1);
+  for (uint8_t i = 0; i < 8; i++) {
+    const uint16_t *a = &p[i][0][0];
+    const uint16_t *lo = &p[i ? i - 1 : 0][0][0];
+    const uint16_t *hi = &p[i < 7 ? i + 1 : 7][0][0];
+    uint8_t *even = out + 2 * i * 256;
+    uint8_t *odd = even + 256;
+    for (uint16_t j = 0; j < 256; j++) {
+      const uint16_t c = 3 * a[j] + round;
+      even[j] = (c + lo[j]) >> shift;
+      odd[j] = (c + hi[j]) >> shift;
+    }
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef UPSAMPLE_H
+#define UPSAMPLE_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * UPSAMPLE
+ *------------------------------------------------------------------------------
+ * Trilinear upsampling of a half resolution volume to the 16x16x16 cube. A
+ * smooth field (noise) sampled at 8x8x8 costs 8 times less to compute and
+ * hardly looks different.
+ *
+ * Sample i is at the center of voxels 2i and 2i + 1, so voxel 2i is 3/4 of
+ * sample i and 1/4 of sample i - 1 and voxel 2i + 1 is 3/4 of sample i and 1/4
+ * of sample i + 1, the edges repeat the last sample. For the fixed 2x ratio
+ * every axis is a pass of 3 * a + b in 16 bits, the last pass rounds the sum
+ * back to 8 bits.
+ *
+ * uint8_t half[8][8][8];
+ * uint8_t full[16][16][16];
+ * upsample(&half[0][0][0], &full[0][0][0], 8);  // [8][16][8] with 16
+ *----------------------------------------------------------------------------*/
+// in is [8][height][8] with height 8 or 16 (y at full resolution), out is
+// [16][16][16]
+void upsample(const uint8_t *in, uint8_t *out, const uint8_t height);
+#endif
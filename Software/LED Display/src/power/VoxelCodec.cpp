@@ -0,0 +1,125 @@
+#include "VoxelCodec.h"
+
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * VOXELCODEC CLASS
+ *----------------------------------------------------------------------------*/
+static const uint8_t COLUMN = 16;
+
+uint16_t VoxelCodec::palettize(const uint8_t *rgb, const uint16_t count,
+                               uint8_t *palette, uint8_t *indices) {
+  // Open addressing over the 24 bit colors, twice the palette size
+  const uint16_t SLOTS = 512;
+  uint32_t keys[SLOTS];
+  uint8_t values[SLOTS];
+  memset(keys, 0xFF, sizeof(keys));
+  uint16_t colors = 0;
+  for (uint16_t i = 0; i < count; i++, rgb += 3) {
+    const uint32_t key = rgb[0] | rgb[1] << 8 | rgb[2] << 16;
+    uint16_t slot = (key * 2654435761u) >> 23;
+    while (keys[slot] != key && keys[slot] != 0xFFFFFFFF)
+      slot = (slot + 1) & (SLOTS - 1);
+    if (keys[slot] != key) {
+      if (colors == 256) return 0;
+      keys[slot] = key;
+      values[slot] = colors;
+      memcpy(&palette[colors * 3], rgb, 3);
+      colors++;
+    }
+    indices[i] = values[slot];
+  }
+  return colors;
+}
+
+uint16_t VoxelCodec::encode_rle(uint8_t *out, const uint16_t capacity,
+                                const uint8_t *indices,
+                                const uint16_t columns) {
+  uint16_t n = 0;
+  for (uint16_t c = 0; c < columns; c++, indices += COLUMN) {
+    for (uint8_t z = 0; z < COLUMN;) {
+      uint8_t length = 1;
+      while (z + length < COLUMN && indices[z + length] == indices[z]) length++;
+      if (n + 2 > capacity) return 0;
+      out[n++] = length;
+      out[n++] = indices[z];
+      z += length;
+    }
+  }
+  return n;
+}
+
+bool VoxelCodec::decode_rle(Color *out, const Color *palette,
+                            const uint8_t *data, const uint16_t size,
+                            const uint16_t columns) {
+  const uint8_t *end = data + size;
+  for (uint16_t c = 0; c < columns; c++) {
+    for (uint8_t z = 0; z < COLUMN;) {
+      if (end - data < 2) return false;
+      const uint8_t length = data[0];
+      if (length == 0 || z + length > COLUMN) return false;
+      const Color &color = palette[data[1]];
+      for (uint8_t i = 0; i < length; i++) *out++ = color;
+      z += length;
+      data += 2;
+    }
+  }
+  return data == end;
+}
+
+uint16_t VoxelCodec::encode_delta(uint8_t *out, const uint16_t capacity,
+                                  const uint8_t *rgb, const uint8_t *previous,
+                                  const uint16_t count) {
+  uint16_t n = 0;
+  uint16_t i = 0;
+  // The decoder leaves what follows the last pair unchanged
+  while (true) {
+    uint16_t skip = 0;
+    while (i + skip < count &&
+           !memcmp(&rgb[(i + skip) * 3], &previous[(i + skip) * 3], 3))
+      skip++;
+    if (i + skip == count) break;
+    i += skip;
+    // Longer skips take empty pairs first
+    for (; skip > 255; skip -= 255) {
+      if (n + 2 > capacity) return 0;
+      out[n++] = 255;
+      out[n++] = 0;
+    }
+    uint16_t literals = 0;
+    while (i + literals < count && literals < 255 &&
+           memcmp(&rgb[(i + literals) * 3], &previous[(i + literals) * 3], 3))
+      literals++;
+    if (n + 2 + literals * 3 > capacity) return 0;
+    out[n++] = skip;
+    out[n++] = literals;
+    for (uint16_t k = 0; k < literals; k++, i++)
+      for (uint8_t b = 0; b < 3; b++)
+        out[n++] = rgb[i * 3 + b] ^ previous[i * 3 + b];
+  }
+  // Without changes a single empty pair, 0 means it did not fit
+  if (n == 0 && capacity >= 2) {
+    out[n++] = 0;
+    out[n++] = 0;
+  }
+  return n;
+}
+
+bool VoxelCodec::decode_delta(Color *out, const Color *previous,
+                              const uint8_t *data, const uint16_t size,
+                              const uint16_t count) {
+  const uint8_t *end = data + size;
+  uint16_t i = 0;
+  while (data < end) {
+    if (end - data < 2) return false;
+    const uint8_t skip = data[0], literals = data[1];
+    data += 2;
+    if (i + skip + literals > count || end - data < literals * 3) return false;
+    for (uint8_t k = 0; k < skip; k++, i++) out[i] = previous[i];
+    for (uint8_t k = 0; k < literals; k++, i++, data += 3) {
+      const Color &p = previous[i];
+      out[i] = Color(p.r ^ data[0], p.g ^ data[1], p.b ^ data[2]);
+    }
+  }
+  for (; i < count; i++) out[i] = previous[i];
+  return true;
+}
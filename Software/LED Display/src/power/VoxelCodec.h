@@ -0,0 +1,58 @@
+#ifndef VOXELCODEC_H
+#define VOXELCODEC_H
+#include <stdint.h>
+
+#include "Color.h"
+/*------------------------------------------------------------------------------
+ * VOXELCODEC CLASS
+ *------------------------------------------------------------------------------
+ * Compressed voxel chunks for the live stream (core/Voxels.h), voxels are r,
+ * g, b bytes in [x][y][z] order, so a z column is 16 consecutive voxels.
+ *
+ * RLE    whole z columns in palette colors, every column is a list of
+ *        (length 1-16, palette index) byte pairs. An empty column is 2 bytes.
+ * DELTA  XOR against the previous frame, (skip, literals) byte pairs where
+ *        skip voxels are unchanged and literals XOR values of 3 bytes follow.
+ *
+ * Encoders return the amount of bytes written, 0 when the chunk does not fit
+ * the capacity (send it as RGB then). Decoders return false on malformed
+ * data, they never write beyond count voxels.
+ *
+ * uint8_t indices[4096];
+ * uint16_t colors = VoxelCodec::palettize(rgb, 4096, palette, indices);
+ * uint16_t n = VoxelCodec::encode_rle(out, sizeof(out), &indices[0], 16);
+ *----------------------------------------------------------------------------*/
+// Voxels of a frame and the bytes of a chunk header of the stream
+#define VOXELS_COUNT 4096
+#define VOXELS_HEADER 7
+
+// Chunk formats of the stream (core/Voxels.h)
+enum class voxels_t : uint8_t {
+  RGB = 0,
+  INDEXED = 1,
+  PALETTE = 2,
+  RLE = 3,
+  DELTA = 4
+};
+
+class VoxelCodec {
+ public:
+  // Palette of at most 256 colors and the index of every voxel, returns the
+  // amount of colors or 0 when there are more
+  static uint16_t palettize(const uint8_t *rgb, const uint16_t count,
+                            uint8_t *palette, uint8_t *indices);
+
+  static uint16_t encode_rle(uint8_t *out, const uint16_t capacity,
+                             const uint8_t *indices, const uint16_t columns);
+  static bool decode_rle(Color *out, const Color *palette,
+                         const uint8_t *data, const uint16_t size,
+                         const uint16_t columns);
+
+  static uint16_t encode_delta(uint8_t *out, const uint16_t capacity,
+                               const uint8_t *rgb, const uint8_t *previous,
+                               const uint16_t count);
+  static bool decode_delta(Color *out, const Color *previous,
+                           const uint8_t *data, const uint16_t size,
+                           const uint16_t count);
+};
+#endif
@@ -0,0 +1,196 @@
+#include "VoxelFile.h"
+
+#include <string.h>
+
+#include <algorithm>
+/*------------------------------------------------------------------------------
+ * VOXELENCODER CLASS
+ *----------------------------------------------------------------------------*/
+static const uint16_t CHUNK = 2 + VOXELS_HEADER;
+
+// Length and header of a chunk in front of its data, returns the total size
+static uint16_t chunk(uint8_t *out, const uint16_t sequence,
+                      const voxels_t format, const uint16_t count,
+                      const uint8_t *data, const uint16_t size) {
+  const uint16_t length = VOXELS_HEADER + size;
+  const uint8_t bytes[CHUNK] = {
+      (uint8_t)length, (uint8_t)(length >> 8), (uint8_t)sequence,
+      (uint8_t)(sequence >> 8), (uint8_t)format, 0, 0, (uint8_t)count,
+      (uint8_t)(count >> 8)};
+  memcpy(out, bytes, CHUNK);
+  if (data != out + CHUNK) memcpy(out + CHUNK, data, size);
+  return CHUNK + size;
+}
+
+uint16_t VoxelEncoder::encode(uint8_t *out, const uint8_t *rgb,
+                              const uint8_t *previous, const uint16_t sequence,
+                              const bool keyframe, const uint16_t duration,
+                              const uint8_t motion_blur) {
+  // A player that seeks knows the palette from the keyframe on
+  if (keyframe) colors = 0;
+  uint8_t *data = out + sizeof(voxel_frame_t);
+  uint16_t size = 0;
+  // RGB unless a palette and runs or the delta are smaller
+  uint16_t best = VOXELS_COUNT * 3;
+  const uint16_t used =
+      VoxelCodec::palettize(rgb, VOXELS_COUNT, found, indices);
+  const bool same = !keyframe && used == colors &&
+                    !memcmp(found, palette, used * 3);
+  const uint16_t rle =
+      used ? VoxelCodec::encode_rle(runs, sizeof(runs), indices,
+                                    VOXELS_COUNT / 16)
+           : 0;
+  const uint16_t cost = rle + (same ? 0 : CHUNK + used * 3);
+  const bool runs_win = rle && cost < best;
+  if (runs_win) best = cost;
+  const uint16_t delta =
+      keyframe ? 0
+               : VoxelCodec::encode_delta(data + CHUNK, best - 1, rgb,
+                                          previous, VOXELS_COUNT);
+  if (delta) {
+    size = chunk(data, sequence, voxels_t::DELTA, VOXELS_COUNT, data + CHUNK,
+                 delta);
+  } else if (runs_win) {
+    if (!same) {
+      size = chunk(data, sequence, voxels_t::PALETTE, used, found, used * 3);
+      memcpy(palette, found, used * 3);
+      colors = used;
+    }
+    size += chunk(data + size, sequence, voxels_t::RLE, VOXELS_COUNT, runs,
+                  rle);
+  } else {
+    size = chunk(data, sequence, voxels_t::RGB, VOXELS_COUNT, rgb,
+                 VOXELS_COUNT * 3);
+  }
+  const voxel_frame_t f = {size, duration, motion_blur,
+                           keyframe ? voxel_frame_t::KEYFRAME : (uint8_t)0};
+  memcpy(out, &f, sizeof(f));
+  return sizeof(f) + size;
+}
+/*------------------------------------------------------------------------------
+ * VOXELFILE CLASS
+ *----------------------------------------------------------------------------*/
+bool VoxelFile::open(const uint8_t *file, const uint32_t size) {
+  data = nullptr;
+  if (size < sizeof(header)) return false;
+  memcpy(&header, file, sizeof(header));
+  if (header.magic != VOXEL_FILE_MAGIC ||
+      header.version != VOXEL_FILE_VERSION ||
+      header.header_size < sizeof(header) || header.header_size > size)
+    return false;
+  // An index that does not fit is ignored, the frames end at the file end
+  if (header.index_offset < header.header_size ||
+      header.index_offset > size ||
+      (size - header.index_offset) / 4 < header.index_count)
+    header.index_count = 0;
+  end = header.index_count ? header.index_offset : size;
+  data = file;
+  // Count the frames of a file that was not closed
+  count = header.frames;
+  offset = header.header_size;
+  if (!count || !header.index_count) {
+    for (count = 0; offset + sizeof(voxel_frame_t) <= end; count++) {
+      voxel_frame_t f;
+      memcpy(&f, &data[offset], sizeof(f));
+      if (end - offset - sizeof(f) < f.size) break;
+      offset += sizeof(f) + f.size;
+    }
+  }
+  next = 0;
+  offset = header.header_size;
+  std::fill(palette, palette + 256, Color::BLACK);
+  return true;
+}
+
+bool VoxelFile::decode(const uint32_t n, Color *out, voxel_frame_t *frame) {
+  if (!data || n >= count) return false;
+  // The keyframe at or before n, unless the frames since are decoded
+  const uint32_t interval = header.keyframe_interval;
+  const uint32_t key = interval ? n - n % interval : 0;
+  if (n < next || next < key) {
+    next = 0;
+    offset = header.header_size;
+    if (header.index_count && header.index_interval) {
+      uint32_t entry = key / header.index_interval;
+      if (entry >= header.index_count) entry = header.index_count - 1;
+      memcpy(&offset, &data[header.index_offset + entry * 4], 4);
+      next = entry * header.index_interval;
+    }
+    // Frames before the keyframe are skipped without decoding
+    while (next < key) {
+      voxel_frame_t f;
+      if (offset < header.header_size || offset > end ||
+          end - offset < sizeof(f))
+        return false;
+      memcpy(&f, &data[offset], sizeof(f));
+      if (end - offset - sizeof(f) < f.size) return false;
+      offset += sizeof(f) + f.size;
+      next++;
+    }
+  }
+  while (next < n)
+    if (!step(out, nullptr)) return false;
+  return step(out, frame);
+}
+
+bool VoxelFile::step(Color *out, voxel_frame_t *frame) {
+  voxel_frame_t f;
+  if (offset < header.header_size || offset > end ||
+      end - offset < sizeof(f))
+    return false;
+  memcpy(&f, &data[offset], sizeof(f));
+  if (end - offset - sizeof(f) < f.size) return false;
+  const uint8_t *chunks = &data[offset + sizeof(f)];
+  offset += sizeof(f) + f.size;
+  next++;
+  if (frame) *frame = f;
+  return decode(out, palette, chunks, f.size);
+}
+
+// The chunks of a frame, as Voxels::receive() but whole frames in order
+bool VoxelFile::decode(Color *out, Color *palette, const uint8_t *data,
+                       const uint16_t size) {
+  const uint8_t *end = data + size;
+  while (data < end) {
+    if (end - data < CHUNK) return false;
+    const uint16_t length = data[0] | data[1] << 8;
+    data += 2;
+    if (length < VOXELS_HEADER || end - data < length) return false;
+    const voxels_t format = (voxels_t)data[2];
+    const uint16_t offset = data[3] | data[4] << 8;
+    const uint16_t n = data[5] | data[6] << 8;
+    const uint8_t *p = data + VOXELS_HEADER;
+    const uint16_t bytes = length - VOXELS_HEADER;
+    data += length;
+
+    if (format == voxels_t::PALETTE) {
+      if (offset + n > 256 || bytes != n * 3) return false;
+      for (uint16_t i = 0; i < n; i++, p += 3)
+        palette[offset + i] = Color(p[0], p[1], p[2]);
+      continue;
+    }
+    if (offset + n > VOXELS_COUNT) return false;
+    Color *v = &out[offset];
+    switch (format) {
+      case voxels_t::RGB:
+        if (bytes != n * 3) return false;
+        for (uint16_t i = 0; i < n; i++, p += 3) v[i] = Color(p[0], p[1], p[2]);
+        break;
+      case voxels_t::INDEXED:
+        if (bytes != n) return false;
+        for (uint16_t i = 0; i < n; i++) v[i] = palette[p[i]];
+        break;
+      case voxels_t::RLE:
+        if ((offset | n) % 16) return false;
+        if (!VoxelCodec::decode_rle(v, palette, p, bytes, n / 16)) return false;
+        break;
+      case voxels_t::DELTA:
+        // In place, out still holds the frame before
+        if (!VoxelCodec::decode_delta(v, v, p, bytes, n)) return false;
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
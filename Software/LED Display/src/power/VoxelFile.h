@@ -0,0 +1,109 @@
+#ifndef VOXELFILE_H
+#define VOXELFILE_H
+#include <stdint.h>
+
+#include "Color.h"
+#include "VoxelCodec.h"
+/*------------------------------------------------------------------------------
+ * VOXEL FILE FORMAT
+ *------------------------------------------------------------------------------
+ * Recorded cube frames, little endian. A file is a header, the frames one
+ * after the other and an index of keyframes written when it is closed:
+ *
+ *   header   voxel_file_t
+ *   frame    voxel_frame_t, then chunks of a 2 byte length and a chunk of the
+ *            live stream (core/Voxels.h: 7 byte header, RGB, PALETTE, RLE or
+ *            DELTA data), together covering all 4096 voxels
+ *   index    a 4 byte file offset of every index_interval-th frame
+ *
+ * Every keyframe_interval-th frame is a keyframe that starts with its palette
+ * and has no DELTA chunks. index_interval is 1 (an offset of every frame, the
+ * simulator exports) or a multiple of keyframe_interval (the recorder on the
+ * cube). Seeking goes to the keyframe before a frame and decodes from there.
+ * A file without index (the recorder did not close it) can still be played
+ * from the start.
+ *
+ * VoxelEncoder writes the frames, VoxelFile reads a whole file in place from
+ * memory, flash or a mapped file, nothing is copied:
+ *
+ * VoxelFile file;
+ * if (file.open(data, size))
+ *   for (uint32_t n = 0; n < file.frames(); n++) file.decode(n, frame);
+ *----------------------------------------------------------------------------*/
+#define VOXEL_FILE_MAGIC 0x5856434d  // "MCVX"
+#define VOXEL_FILE_VERSION 1
+#define VOXEL_FILE_KEYFRAME 16
+// Largest frame: the frame header and one RGB chunk of all voxels
+#define VOXEL_FILE_FRAME_MAX (6 + 2 + VOXELS_HEADER + VOXELS_COUNT * 3)
+
+struct voxel_file_t {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t header_size;
+  uint32_t frames;
+  uint16_t keyframe_interval;
+  uint16_t index_interval;
+  // Offset and amount of entries of the index, 0 when there is none
+  uint32_t index_offset;
+  uint32_t index_count;
+  uint32_t reserved[2];
+};
+
+struct voxel_frame_t {
+  // Bytes of the chunks that follow
+  uint16_t size;
+  // Frame period in ms when it was recorded, the time it stays on display
+  uint16_t duration;
+  uint8_t motion_blur;
+  uint8_t flags;
+  static const uint8_t KEYFRAME = 1;
+};
+
+static_assert(sizeof(voxel_file_t) == 32, "voxel_file_t is stored as is");
+static_assert(sizeof(voxel_frame_t) == 6, "voxel_frame_t is stored as is");
+
+class VoxelEncoder {
+ public:
+  // Encode a frame of r, g, b bytes in [x][y][z] order into out (at least
+  // VOXEL_FILE_FRAME_MAX bytes) as the smallest of RGB, a palette and RLE or
+  // a DELTA against previous, returns the size with the frame header. A
+  // frame that is not written after all has to be followed by a keyframe.
+  uint16_t encode(uint8_t *out, const uint8_t *rgb, const uint8_t *previous,
+                  const uint16_t sequence, const bool keyframe,
+                  const uint16_t duration, const uint8_t motion_blur);
+
+ private:
+  // Palette of the frame and the palette the player has since the keyframe
+  uint8_t found[256 * 3];
+  uint8_t palette[256 * 3];
+  uint16_t colors = 0;
+  uint8_t indices[VOXELS_COUNT];
+  uint8_t runs[VOXELS_COUNT * 2];
+};
+
+class VoxelFile {
+ public:
+  // Check the header of a file of size bytes, false when it is no voxel file
+  bool open(const uint8_t *data, const uint32_t size);
+  uint32_t frames() const { return count; }
+  // Decode frame n over the frame decoded last in out, from the keyframe
+  // before n unless n follows it. False for a damaged or missing frame.
+  bool decode(const uint32_t n, Color *out, voxel_frame_t *frame = nullptr);
+  // Decode the chunks of one frame over the frame before it in out
+  static bool decode(Color *out, Color *palette, const uint8_t *data,
+                     const uint16_t size);
+
+ private:
+  const uint8_t *data = nullptr;
+  voxel_file_t header;
+  // End of the frames, amount of frames
+  uint32_t end = 0;
+  uint32_t count = 0;
+  // Frame that follows the one decoded last and its offset
+  uint32_t next = 0;
+  uint32_t offset = 0;
+  Color palette[256];
+
+  bool step(Color *out, voxel_frame_t *frame);
+};
+#endif
@@ -0,0 +1,45 @@
+#include "WaveField.h"
+
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * WAVEFIELD CLASS
+ *----------------------------------------------------------------------------*/
+WaveField::WaveField() : current(a), previous(b) { clear(); }
+
+void WaveField::clear() {
+  memset(a, 0, sizeof(a));
+  memset(b, 0, sizeof(b));
+}
+
+void WaveField::drop(const uint8_t x, const uint8_t z, const int16_t amount) {
+  if (x < SIZE && z < SIZE) {
+    int32_t h = current[x + 1][z + 1] + amount;
+    current[x + 1][z + 1] = h > 32767 ? 32767 : h < -32768 ? -32768 : h;
+  }
+}
+
+void WaveField::set(const uint8_t x, const uint8_t z, const int16_t h) {
+  if (x < SIZE && z < SIZE) current[x + 1][z + 1] = h;
+}
+
+void WaveField::step(const uint8_t damping) {
+  for (uint8_t i = 1; i <= SIZE; i++) {
+    current[0][i] = current[1][i];
+    current[SIZE + 1][i] = current[SIZE][i];
+    current[i][0] = current[i][1];
+    current[i][SIZE + 1] = current[i][SIZE];
+  }
+  // The previous heights are not needed after this step, overwrite them
+  for (uint8_t x = 1; x <= SIZE; x++)
+    for (uint8_t z = 1; z <= SIZE; z++) {
+      int32_t h = ((current[x - 1][z] + current[x + 1][z] + current[x][z - 1] +
+                    current[x][z + 1]) >>
+                   1) -
+                  previous[x][z];
+      h -= h >> damping;
+      previous[x][z] = h > 32767 ? 32767 : h < -32768 ? -32768 : h;
+    }
+  int16_t(*t)[SIZE + 2] = current;
+  current = previous;
+  previous = t;
+}
@@ -0,0 +1,41 @@
+#ifndef WAVEFIELD_H
+#define WAVEFIELD_H
+#include <stdint.h>
+/*------------------------------------------------------------------------------
+ * WAVEFIELD CLASS
+ *------------------------------------------------------------------------------
+ * Height field of 16x16 water columns in 1/256 voxel, solved with the damped
+ * wave equation on two int16 buffers. Every step the new height is half the
+ * sum of the 4 neighbours minus the height of the step before, minus
+ * 1 / 2^damping of that. The border copies the edge, so waves reflect from
+ * the walls of the cube. A step costs the same for any amount of waves.
+ *
+ * WaveField w;
+ * w.drop(4, 9, 3 * WaveField::ONE);  // impulse of 3 voxels
+ * w.step(5);                         // lose 1/32 every step
+ * w.height(x, z);
+ *----------------------------------------------------------------------------*/
+class WaveField {
+ public:
+  static const uint8_t SIZE = 16;
+  static const int16_t ONE = 256;
+
+  WaveField();
+  void clear();
+  // add an impulse to a column
+  void drop(const uint8_t x, const uint8_t z, const int16_t amount);
+  // force the height of a column, a wave maker when set every step
+  void set(const uint8_t x, const uint8_t z, const int16_t h);
+  void step(const uint8_t damping);
+  int16_t height(const uint8_t x, const uint8_t z) const {
+    return current[x + 1][z + 1];
+  }
+
+ private:
+  // one column of padding on every side for the reflecting border
+  int16_t a[SIZE + 2][SIZE + 2];
+  int16_t b[SIZE + 2][SIZE + 2];
+  int16_t (*current)[SIZE + 2];
+  int16_t (*previous)[SIZE + 2];
+};
+#endif
@@ -3,10 +3,14 @@
 
 #include "Animation.h"
 #include "power/Math8.h"
+#include "power/Predictor.h"
 
 class Accelerometer : public Animation {
  private:
   float radius;
+  // Gravity smoothed and extrapolated to the frame on the leds
+  Predictor gravity;
+  uint32_t samples = 0;
 
  public:
   static constexpr auto &settings = config.animation.accelerometer;
@@ -19,7 +23,7 @@ class Accelerometer : public Animation {
   void draw(float dt) {
     radius = settings.radius;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
     if (timer_running.update()) {
       state = state_t::INACTIVE;
     }
@@ -27,8 +31,13 @@ class Accelerometer : public Animation {
       state = state_t::INACTIVE;
     }
 
-    auto &hid = config.devices.accelerometer;
-    Vector3 v = Vector3(hid.x, hid.z, hid.y);
+    accelerometer_t hid = {};
+    const uint32_t sequence = config.devices.read(hid);
+    if (sequence != samples) {
+      samples = sequence;
+      gravity.update(Vector3(hid.x, hid.z, hid.y), hid.time);
+    }
+    Vector3 v = gravity.at(Scheduler::shown());
     if (v.magnitude() > 0)
       v.normalize();
     else {  // Demo  mode
@@ -42,12 +42,25 @@
 #include "Ripple.h"
 #include "Kaleidoscope.h"
 #include "Interference.h"
+#include "Streaming.h"
+#include "Playback.h"
+#include "Program.h"
+#include "core/Alloc.h"
+#include "core/Latency.h"
+#include "core/Recorder.h"
+#include "core/Sync.h"
+#include "core/Trace.h"
 /*------------------------------------------------------------------------------
  * ANIMATION STATIC DEFINITIONS
  *----------------------------------------------------------------------------*/
 Noise Animation::noise = Noise();
 Timer Animation::animation_timer = Timer();
 uint16_t Animation::animation_sequence = 0;
+uint64_t Animation::ahead = 0;
+Animation *Animation::active[ACTIVE_MAX];
+uint8_t Animation::active_count = 0;
+Animation *Animation::prepared = nullptr;
+DMAMEM Color Playback::frame[VOXELS_COUNT];
 /*------------------------------------------------------------------------------
  * ANIMATION GLOBAL DEFINITIONS
  *----------------------------------------------------------------------------*/
@@ -94,56 +107,232 @@ Matrix matrix;
 Ripple ripple;
 Kaleidoscope kaleidoscope;
 Interference interference;
+Streaming streaming;
+Playback playback;
+Program program;
 
-Animation *Animations[] = {&atoms,      &sinus,    &starfield,    &fireworks1,
-                           &fireworks2, &twinkels, &helix,        &arrows,
-                           &plasma,     &mario,    &life,         &pong,
-                           &spectrum,   &scroller, &accelerometer, &cube,
-                           &rain,       &aurora,   &lavalamp,     &fireflies,
-                           &ocean,      &lorenz,   &torus,        &sierpinski,
-                           &moebius,    &spirograph, &snake,      &tetris,
-                           &pong3d,     &maze,     &globe,        &dna,
-                           &heart,      &hourglass, &galaxy,      &tornado,
-                           &fountain,   &explosion, &boids,       &matrix,
-                           &ripple,     &kaleidoscope, &interference};
+void FIREWORKS() {
+  fireworks2.init();
+  fireworks2.timer_running = fireworks1.timer_running;
+  // Both fireworks share the sky
+  Animation::activate(&fireworks2, blend_t::MAX);
+}
+void SCROLLER() { scroller.set_text("#MALT WHISKEY"); }
+void PLASMATEXT() {
+  scroller.init();
+  scroller.timer_running = plasma.timer_running;
+  scroller.set_text("#MEGA CUBE");
+  Animation::activate(&scroller, blend_t::SET);
+}
+void TWINKELS1() {
+  twinkels.set_mode(true, false);
+  twinkels.set_color(Color(255, 150, 30));
+  twinkels.set_clear();
+}
+void TWINKELS2() { twinkels.set_mode(false, true); }
 
-const uint8_t ANIMATIONS = sizeof(Animations) / sizeof(Animation *);
+// Sequence of all animations, this is the only place they are registered.
+// The index is the id used by the gui, the last item terminates the table.
+PROGMEM const jump_item_t jump_table[] = {
+    {"Accelerometer", "Test accelerometer", 0, &accelerometer,
+     sizeof(accelerometer)},
+    {"Arrows", "Moving arrows", 0, &arrows, sizeof(arrows)},
+    {"Atoms", "Electons arround nucleas", 0, &atoms, sizeof(atoms)},
+    {"Cube", "Cube in a cube", 0, &cube, sizeof(cube)},
+    {"Fireworks", "Fireing Fireworks", &FIREWORKS, &fireworks1,
+     sizeof(fireworks1)},
+    {"Helix", "Double strand DNA", 0, &helix, sizeof(helix)},
+    {"Life", "Game of Life 3D", 0, &life, sizeof(life)},
+    {"Mario", "Super Mario Run", 0, &mario, sizeof(mario)},
+    {"Plasma", "Perlin noise plasma field", 0, &plasma, sizeof(plasma)},
+    {"Pong", "The classical game of Pong", 0, &pong, sizeof(pong)},
+    {"Scroller", "Circulair text scroller ", &SCROLLER, &scroller,
+     sizeof(scroller)},
+    {"Sinus", "3D Wave Function", 0, &sinus, sizeof(sinus)},
+    {"Spectrum", "WiFi Spectrum Analyser", 0, &spectrum, sizeof(spectrum)},
+    {"Starfield", "To boldly go...", 0, &starfield, sizeof(starfield)},
+    {"Fairylights", "Beautifull fairylights", &TWINKELS1, &twinkels,
+     sizeof(twinkels)},
+    {"Multilights", "Multicolor fairylights", &TWINKELS2, &twinkels,
+     sizeof(twinkels)},
+    {"Rain", "Rainfall with splashes", 0, &rain, sizeof(rain)},
+    {"Aurora", "Northern lights", 0, &aurora, sizeof(aurora)},
+    {"Lava Lamp", "Metaball lava lamp", 0, &lavalamp, sizeof(lavalamp)},
+    {"Fireflies", "Glowing fireflies", 0, &fireflies, sizeof(fireflies)},
+    {"Ocean", "Rolling ocean waves", 0, &ocean, sizeof(ocean)},
+    {"Lorenz", "Lorenz attractor", 0, &lorenz, sizeof(lorenz)},
+    {"Torus", "Spinning torus", 0, &torus, sizeof(torus)},
+    {"Sierpinski", "Sierpinski fractal", 0, &sierpinski, sizeof(sierpinski)},
+    {"Moebius", "Moebius strip", 0, &moebius, sizeof(moebius)},
+    {"Spirograph", "3D spirograph", 0, &spirograph, sizeof(spirograph)},
+    {"Snake", "Snake game", 0, &snake, sizeof(snake)},
+    {"Tetris", "3D Tetris", 0, &tetris, sizeof(tetris)},
+    {"Pong 3D", "3D Pong game", 0, &pong3d, sizeof(pong3d)},
+    {"Maze", "3D maze generator", 0, &maze, sizeof(maze)},
+    {"Globe", "Spinning globe", 0, &globe, sizeof(globe)},
+    {"DNA", "DNA double helix", 0, &dna, sizeof(dna)},
+    {"Heart", "Beating heart", 0, &heart, sizeof(heart)},
+    {"Hourglass", "Sand hourglass", 0, &hourglass, sizeof(hourglass)},
+    {"Galaxy", "Spiral galaxy", 0, &galaxy, sizeof(galaxy)},
+    {"Tornado", "Spinning tornado", 0, &tornado, sizeof(tornado)},
+    {"Fountain", "Particle fountain", 0, &fountain, sizeof(fountain)},
+    {"Explosion", "Fireball explosion", 0, &explosion, sizeof(explosion)},
+    {"Boids", "Flocking boids", 0, &boids, sizeof(boids)},
+    {"Matrix", "Matrix rain", 0, &matrix, sizeof(matrix)},
+    {"Ripple", "Water ripples", 0, &ripple, sizeof(ripple)},
+    {"Kaleidoscope", "Kaleidoscope pattern", 0, &kaleidoscope,
+     sizeof(kaleidoscope)},
+    {"Interference", "Wave interference", 0, &interference,
+     sizeof(interference)},
+    {"Streaming", "Live voxels from the network", 0, &streaming,
+     sizeof(streaming)},
+    {"Playback", "Recorded voxels from the SD card", 0, &playback,
+     sizeof(playback)},
+    {"Plasma Text", "Text scroller over plasma", &PLASMATEXT, &plasma,
+     sizeof(plasma)},
+    {"Program", "Uploaded bytecode program", 0, &program, sizeof(program)},
+    {0, 0, 0, 0, 0}};
+
+const uint16_t JUMPITEMS = sizeof(jump_table) / sizeof(jump_item_t) - 1;
 /*----------------------------------------------------------------------------*/
 // Start display asap to minimize PL9823 blue startup
-void Animation::begin() { Display::begin(); }
+void Animation::begin() {
+  Display::begin();
+  // Enable the cycle counter used for profiling
+  ARM_DEMCR |= ARM_DEMCR_TRCENA;
+  ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+}
 
 // Render an animation frame, but only if the display allows it (non blocking)
 void Animation::loop() {
-  // Only draw to the display if it's available
-  if (Display::available()) {
-    // Update the animation timer to determine frame deltatime
+  HOT_PATH("frame");
+  // Only draw when the display is available and the frame slot is due
+  if (Scheduler::ready()) {
+    TRACE_BEGIN(ANIMATION);
+    const uint32_t frame_start = micros();
+    // A probed input published before now shows in this frame
+    Latency::frame(frame_start);
+    // Sample the frame clock once for all timers of this frame and update
+    // the animation timer to determine frame deltatime
+    if (Scheduler::synced)
+      synchronize();
+    else
+      Timer::tick();
     animation_timer.update();
-    // Clear the display before drawing any animations
+    // Clear the display and the effects before drawing any animations
+    Display::setOrientation(config.display.orientation);
     Display::clear();
-    // Draw all active animations from the animation pool
-    uint8_t active_animation_count = 0;
-    for (uint8_t i = 0; i < ANIMATIONS; i++) {
-      Animation &animation = *Animations[i];
-      if (animation.state != state_t::INACTIVE) {
-        animation.draw(animation_timer.dt());
-      }
-      // Animation can become inactive after drawing so check again
-      if (animation.state != state_t::INACTIVE) {
-        active_animation_count++;
-        if (settings.changed) animation.end();
+    PostProcess::reset();
+    // The audio for all animations, and the fields bound to it
+    Modulation::update(animation_timer.dt());
+    Modulation::apply();
+    // Draw the active animations as layers, in order of activation. The
+    // bottom layer can be drawn straight into the cleared frame.
+    uint8_t running_animation_count = 0;
+    uint8_t count = 0;
+    bool steady = active_count > 0;
+    for (uint8_t i = 0; i < active_count; i++) {
+      Animation &animation = *active[i];
+      const bool composite = count > 0 || animation.opacity < 255 ||
+                             animation.blend == blend_t::MULTIPLY;
+      if (animation.quality != Governor::level)
+        animation.set_quality(Governor::level);
+      const uint32_t start = ARM_DWT_CYCCNT;
+      if (composite) Layer::begin();
+      animation.draw(animation_timer.dt());
+      DrawList::flush();
+      if (composite) Layer::end(animation.blend, animation.opacity);
+      const uint32_t cycles = ARM_DWT_CYCCNT - start;
+      animation.profile_calls++;
+      animation.profile_total += cycles;
+      if (cycles > animation.profile_max) animation.profile_max = cycles;
+      // Animation can become inactive after drawing, drop it from the list
+      // and give its working memory back
+      if (animation.state == state_t::INACTIVE) {
+        animation.release();
+        continue;
       }
+      active[count++] = &animation;
+      steady &= animation.state == state_t::RUNNING;
+      if (settings.changed) animation.end();
+      if (animation.state != state_t::ENDING) running_animation_count++;
+    }
+    active_count = count;
+    Modulation::restore();
+    // Prepare the animation coming up a few steps a frame, so starting it
+    // does not hitch. Every cube in sync does the same steps. Its working
+    // memory is only taken with a slot of the arena to spare for next().
+    uint16_t position;
+    const jump_item_t &coming =
+        upcoming(settings.play_one, settings.animation, position);
+    if (prepared && prepared != coming.object &&
+        prepared->state == state_t::INACTIVE)
+      prepared->release();
+    prepared = nullptr;
+    if (coming.object && coming.object->state == state_t::INACTIVE &&
+        (coming.object->scratch || Arena::available() > 1)) {
+      coming.object->prepare(PREPARE);
+      prepared = coming.object;
     }
     // Clear the settings changed flag. Animations are ended allready
     settings.changed = false;
-    // Select the next or specific animation from the sequence list
-    if (active_animation_count == 0) {
+    // Select the next or specific animation from the sequence list, with
+    // crossfade as soon as all animations are ending
+    if (active_count == 0 ||
+        (settings.crossfade && running_animation_count == 0)) {
       Animation::next(settings.play_one, settings.animation);
     }
-    // Commit current animation frame to the display
-    Display::update();
+    // Apply the effects enabled by the animations to the whole frame
+    PostProcess::apply();
+    // Record the frame as it goes to the display
+    Recorder::capture(animation_timer.dt() * 1000, Display::getMotionBlur());
+    // Commit current animation frame to the display within the current limit
+    Display::setMaxMilliamps(config.power.max_milliamps);
+    Display::setDimming(Energy::dimming);
+    Display::setInterpolation(config.display.interpolate);
+    Display::submit();
+    Scheduler::submitted();
+    // Adapt the quality of the next frames to the time this one took
+    Governor::add(micros() - frame_start);
+    // Learn the current of the animation and follow its energy plan
+    Energy::add(Display::getMilliamps(), animation_timer.dt(), steady);
+    TRACE_END(ANIMATION, active_count);
   }
 }
 
+// Cubes in sync draw a frame slot with the same time and random numbers, the
+// clock advances by the slots passed. The sequence starts over on all of them
+// with the first slot of an epoch, one that has passed before it was known is
+// too late to join.
+void Animation::synchronize() {
+  static uint64_t epoch = 0;
+  static uint32_t frame = 0;
+  static bool pending = false;
+  const uint32_t period = 1000000 / config.display.fps;
+  const uint64_t slot = (uint64_t)Scheduler::frame * period;
+  if (!frame) frame = Scheduler::frame;
+  if (Sync::epoch != epoch) {
+    epoch = Sync::epoch;
+    pending = slot < epoch;
+  }
+  if (pending && slot >= epoch) {
+    pending = false;
+    Sync::joined = true;
+    for (uint8_t i = 0; i < active_count; i++) {
+      active[i]->state = state_t::INACTIVE;
+      active[i]->release();
+    }
+    active_count = 0;
+    animation_sequence = 0;
+    ahead = 0;
+  }
+  Timer::tick((Scheduler::frame - frame) * period);
+  frame = Scheduler::frame;
+  const uint32_t seed = Sync::seed(frame);
+  Noise::seed(seed);
+  randomSeed(seed);
+}
+
 // Override end method if more is needed than changing state and ending timer.
 void Animation::end() {
   if (state == state_t::STARTING) {
@@ -159,6 +348,45 @@ void Animation::end() {
   time_reduction = true;
 }
 
+// Shared lifecycle of the animations, the timers are set by init()
+float Animation::update_lifecycle() {
+  float t = 1;
+  if (state == state_t::STARTING) {
+    if (timer_starting.update()) {
+      state = state_t::RUNNING;
+      timer_running.reset();
+    } else {
+      t = timer_starting.ratio();
+    }
+  }
+  if (state == state_t::RUNNING) {
+    if (timer_running.update()) {
+      state = state_t::ENDING;
+      timer_ending.reset();
+    }
+  }
+  if (state == state_t::ENDING) {
+    if (timer_ending.update()) {
+      state = state_t::INACTIVE;
+      return 0;
+    }
+    t = 1 - timer_ending.ratio();
+  }
+  return ease(t, settings.ease);
+}
+
+float Animation::ease(float t, ease_t curve) {
+  t = t < 0 ? 0 : t > 1 ? 1 : t;
+  switch (curve) {
+    case ease_t::QUADRATIC:
+      return t * t;
+    case ease_t::SMOOTH:
+      return t * t * (3 - 2 * t);
+    default:
+      return t;
+  }
+}
+
 // Get fps, if animate has been called than t > 0
 float Animation::fps() {
   if (animation_timer.dt() > 0) {
@@ -167,93 +395,115 @@ float Animation::fps() {
   return 0;
 }
 
-void FIREWORKS() {
-  fireworks2.init();
-  fireworks2.timer_running = fireworks1.timer_running;
+const jump_item_t &Animation::get_item(uint16_t index) {
+  return jump_table[index < JUMPITEMS ? index : JUMPITEMS];
 }
-void SCROLLER() { scroller.set_text("#MALT WHISKEY"); }
-void TWINKELS1() {
-  twinkels.set_mode(true, false);
-  twinkels.set_color(Color(255, 150, 30));
-  twinkels.set_clear();
+
+Animation *Animation::get_active(uint8_t index) {
+  return index < active_count ? active[index] : nullptr;
 }
-void TWINKELS2() { twinkels.set_mode(false, true); }
 
-jump_item_t Animation::get_item(uint16_t index) {
-  const jump_item_t jump_table[] = {
-      {"Accelerometer", "Test accelerometer", 0, &accelerometer},
-      {"Arrows", "Moving arrows", 0, &arrows},
-      {"Atoms", "Electons arround nucleas", 0, &atoms},
-      {"Cube", "Cube in a cube", 0, &cube},
-      {"Fireworks", "Fireing Fireworks", &FIREWORKS, &fireworks1},
-      {"Helix", "Double strand DNA", 0, &helix},
-      {"Life", "Game of Life 3D", 0, &life},
-      {"Mario", "Super Mario Run", 0, &mario},
-      {"Plasma", "Perlin noise plasma field", 0, &plasma},
-      {"Pong", "The classical game of Pong", 0, &pong},
-      {"Scroller", "Circulair text scroller ", &SCROLLER, &scroller},
-      {"Sinus", "3D Wave Function", 0, &sinus},
-      {"Spectrum", "WiFi Spectrum Analyser", 0, &spectrum},
-      {"Starfield", "To boldly go...", 0, &starfield},
-      {"Fairylights", "Beautifull fairylights", &TWINKELS1, &twinkels},
-      {"Multilights", "Multicolor fairylights", &TWINKELS2, &twinkels},
-      {"Rain", "Rainfall with splashes", 0, &rain},
-      {"Aurora", "Northern lights", 0, &aurora},
-      {"Lava Lamp", "Metaball lava lamp", 0, &lavalamp},
-      {"Fireflies", "Glowing fireflies", 0, &fireflies},
-      {"Ocean", "Rolling ocean waves", 0, &ocean},
-      {"Lorenz", "Lorenz attractor", 0, &lorenz},
-      {"Torus", "Spinning torus", 0, &torus},
-      {"Sierpinski", "Sierpinski fractal", 0, &sierpinski},
-      {"Moebius", "Moebius strip", 0, &moebius},
-      {"Spirograph", "3D spirograph", 0, &spirograph},
-      {"Snake", "Snake game", 0, &snake},
-      {"Tetris", "3D Tetris", 0, &tetris},
-      {"Pong 3D", "3D Pong game", 0, &pong3d},
-      {"Maze", "3D maze generator", 0, &maze},
-      {"Globe", "Spinning globe", 0, &globe},
-      {"DNA", "DNA double helix", 0, &dna},
-      {"Heart", "Beating heart", 0, &heart},
-      {"Hourglass", "Sand hourglass", 0, &hourglass},
-      {"Galaxy", "Spiral galaxy", 0, &galaxy},
-      {"Tornado", "Spinning tornado", 0, &tornado},
-      {"Fountain", "Particle fountain", 0, &fountain},
-      {"Explosion", "Fireball explosion", 0, &explosion},
-      {"Boids", "Flocking boids", 0, &boids},
-      {"Matrix", "Matrix rain", 0, &matrix},
-      {"Ripple", "Water ripples", 0, &ripple},
-      {"Kaleidoscope", "Kaleidoscope pattern", 0, &kaleidoscope},
-      {"Interference", "Wave interference", 0, &interference},
-      {0, 0, 0, 0}};
-  const uint16_t JUMPITEMS = sizeof(jump_table) / sizeof(jump_item_t) - 1;
-  if (index > JUMPITEMS)
-    return jump_table[JUMPITEMS];
-  else
-    return jump_table[index];
+// Add an animation to the top of the active list, once
+void Animation::activate(Animation *animation, blend_t blend,
+                         uint8_t opacity) {
+  animation->blend = blend;
+  animation->opacity = opacity;
+  for (uint8_t i = 0; i < active_count; i++)
+    if (active[i] == animation) return;
+  if (active_count < ACTIVE_MAX) active[active_count++] = animation;
 }
 
-void Animation::next(bool play_one, uint16_t index) {
+// Print average and maximum draw time per animation, marking animations that
+// exceed the frame budget. Animations sharing an object are listed once.
+void Animation::dump_profile() {
+  const float cycles_per_us = F_CPU_ACTUAL / 1000000.0f;
+  const float budget = config.display.fps ? 1000000.0f / config.display.fps : 0;
+  Serial.printf("%-16s %8s %10s %10s\n", "Animation", "calls", "avg us",
+                "max us");
+  for (uint16_t i = 0;; i++) {
+    jump_item_t item = get_item(i);
+    if (!item.object) break;
+    bool listed = false;
+    for (uint16_t j = 0; j < i; j++)
+      listed |= get_item(j).object == item.object;
+    Animation &a = *item.object;
+    if (listed || a.profile_calls == 0) continue;
+    const float avg = a.profile_total / a.profile_calls / cycles_per_us;
+    const float max = a.profile_max / cycles_per_us;
+    Serial.printf("%-16s %8lu %10.1f %10.1f%s\n", item.name, a.profile_calls,
+                  avg, max, budget && max > budget ? " over budget" : "");
+    a.profile_calls = 0;
+    a.profile_max = 0;
+    a.profile_total = 0;
+  }
+}
+
+void Animation::release() {
+  if (scratch) Arena::release(scratch);
+  scratch = nullptr;
+}
+
+const jump_item_t &Animation::upcoming(bool play_one, uint16_t index,
+                                       uint16_t &position) {
+  // Play one specific animation endlessly or the next from the sequence
   if (play_one) {
-    // Play one specific animation endlessly
-    jump_item_t jump = Animation::get_item(index);
-    if (jump.object) {
-      jump.object->init();
-      jump.object->time_reduction = false;
-      jump.object->timer_running = 0;
-    }
-    if (jump.custom_init) jump.custom_init();
+    position = index;
+    return get_item(position);
   }
-  else {
-    // Play the next animation from the sequence
-    jump_item_t jump = get_item(animation_sequence++);
-    if (!jump.object) {
-      animation_sequence = 0;
-      jump = get_item(animation_sequence++);
+  position = turn(animation_sequence);
+  // Over the energy budget a lighter item a few further on plays first, the
+  // heavy one keeps its turn until the average cooled down. Cubes in sync
+  // play the sequence as it is.
+  if (Energy::enabled() && !Scheduler::synced && !Energy::fits(position)) {
+    uint16_t candidate = position;
+    for (uint8_t i = 0; i < LOOKAHEAD; i++) {
+      candidate = turn(candidate + 1);
+      if (candidate == position) break;
+      if (Energy::fits(candidate)) {
+        position = candidate;
+        break;
+      }
     }
-    if (jump.object) {
-      jump.object->init();
-      jump.object->time_reduction = false;
+  }
+  return get_item(position);
+}
+
+uint16_t Animation::turn(uint16_t position) {
+  for (uint16_t i = 0; i <= JUMPITEMS; i++, position++) {
+    if (!get_item(position).object) position = 0;
+    if (position >= AHEAD || !(ahead >> position & 1)) break;
+  }
+  return position;
+}
+
+void Animation::next(bool play_one, uint16_t index) {
+  uint16_t position;
+  const jump_item_t *jump = &upcoming(play_one, index, position);
+  // An animation still ending can not crossfade with itself, wait for it,
+  // and wait for a slot of the arena to free up for its state
+  if (jump->object && jump->object->state != state_t::INACTIVE) return;
+  if (jump->object && !jump->object->scratch && !Arena::available()) return;
+  if (!play_one) {
+    // Its turn passes the items played ahead, otherwise it plays ahead
+    const uint16_t due = turn(animation_sequence);
+    if (position == due) {
+      uint16_t p = animation_sequence;
+      for (uint16_t i = 0; i < JUMPITEMS; i++, p++) {
+        if (!get_item(p).object) p = 0;
+        if (p == due) break;
+        if (p < AHEAD) ahead &= ~(1ull << p);
+      }
+      animation_sequence = position + 1;
+    } else if (position < AHEAD) {
+      ahead |= 1ull << position;
     }
-    if (jump.custom_init) jump.custom_init();
   }
-}
\ No newline at end of file
+  Energy::start(position, play_one);
+  if (jump->object) {
+    jump->object->init();
+    jump->object->time_reduction = false;
+    if (play_one) jump->object->timer_running = 0;
+    activate(jump->object);
+  }
+  if (jump->custom_init) jump->custom_init();
+}
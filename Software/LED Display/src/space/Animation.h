@@ -2,9 +2,21 @@
 #define ANIMATION_H
 #include <stdint.h>
 
+#include <new>
+
+#include "core/Arena.h"
 #include "core/Config.h"
 #include "core/Display.h"
+#include "core/DrawList.h"
+#include "core/Energy.h"
+#include "core/Governor.h"
 #include "core/Graphics.h"
+#include "core/Layer.h"
+#include "core/Modulation.h"
+#include "core/PostProcess.h"
+#include "core/SDF.h"
+#include "core/Scheduler.h"
+#include "power/FastTrig.h"
 #include "power/Math3D.h"
 #include "power/Math8.h"
 #include "power/Noise.h"
@@ -29,6 +41,8 @@ struct jump_item_t {
   const char* description;
   void (*custom_init)();
   Animation* object;
+  // sizeof the object, for the memory report
+  uint32_t size;
 };
 
 class Animation {
@@ -39,6 +53,32 @@ class Animation {
   static uint16_t animation_sequence;
   // Settings of animations
   static constexpr auto& settings = config.animation;
+  // Animations that are not inactive, drawn in order of activation
+  static const uint8_t ACTIVE_MAX = 8;
+  static Animation* active[ACTIVE_MAX];
+  static uint8_t active_count;
+  // Steps of the next animation prepared per frame, see prepare()
+  static const uint16_t PREPARE = 4;
+  // The animation prepared ahead, see prepare()
+  static Animation* prepared;
+  // Working memory from the arena, see memory()
+  void* scratch = nullptr;
+  // Give the working memory back to the arena
+  void release();
+  // Items played ahead of their turn for the energy budget, skipped when
+  // the sequence gets to them (bit per position)
+  static uint64_t ahead;
+  static const uint8_t AHEAD = 64;
+  // Items ahead in the sequence a lighter one is looked for
+  static const uint8_t LOOKAHEAD = 4;
+  // The item next() will start and its position in the sequence
+  static const jump_item_t& upcoming(bool play_one, uint16_t index,
+                                     uint16_t& position);
+  // Position of the turn of the sequence from position on, skipping the
+  // items played ahead
+  static uint16_t turn(uint16_t position);
+  // Take the frame clock and random numbers from the shared frame slot
+  static void synchronize();
 
  public:
   // Shared Noise Object
@@ -52,10 +92,19 @@ class Animation {
   int16_t hue16_speed;
   // Animation brightness
   uint8_t brightness;
+  // Compositing of this animation over the layers below it
+  blend_t blend = blend_t::SET;
+  uint8_t opacity = 255;
   // When animation is not inactive draw this on the display
   state_t state = state_t::INACTIVE;
   // When animation is ended, time is reduced only once
   bool time_reduction = false;
+  // Draw profile in cpu cycles (ARM DWT CYCCNT)
+  uint32_t profile_calls = 0;
+  uint32_t profile_max = 0;
+  uint64_t profile_total = 0;
+  // Quality level the animation draws at, 0 to Governor::FULL
+  uint8_t quality = Governor::FULL;
 
   virtual ~Animation(){};
   // Start displaying animations
@@ -66,17 +115,52 @@ class Animation {
   static void next(boolean changed = false, uint16_t index = 0);
   // Get current fps
   static float fps();
+  // Print the draw profile of every animation and start a new profile
+  static void dump_profile();
   // Draws antimation frame respecting elapsed time
   virtual void draw(float dt) = 0;
   // End animation gracefully (may be overriden)
   virtual void end();
   // Initialization of animation with configuration
   virtual void init() = 0;
+  // Do up to budget steps of the work of the next init() ahead of it, while
+  // the animation before it plays, true when nothing is left. A step is about
+  // a row of voxels worth of work, init() finishes what is left (may be
+  // overriden by animations with a heavy init)
+  virtual bool prepare(uint16_t) { return true; }
+  // Draw at another quality level of the governor from the next frame on
+  // (may be overriden when more is needed than reading quality in draw)
+  virtual void set_quality(uint8_t level) { quality = level; }
   // Get animation jump_items_t (returns 0 when above index)
-  static jump_item_t get_item(uint16_t index);
+  static const jump_item_t& get_item(uint16_t index);
+  // Get an animation that is drawn, in order of activation (nullptr when
+  // above the active ones)
+  static Animation* get_active(uint8_t index);
+  // Draw an initialized animation from now on on top of the active ones,
+  // until it becomes inactive
+  static void activate(Animation* animation, blend_t blend = blend_t::SET,
+                       uint8_t opacity = 255);
+  // Shape a linear ratio 0..1 with an easing curve
+  static float ease(float t, ease_t curve);
+
+ protected:
+  // The state of the animation in the arena, constructed the first time it
+  // is needed after the animation was inactive. Large state lives here
+  // instead of in the animation, init() takes it so it is never nullptr
+  // while the animation is drawn.
+  template <typename T>
+  T* memory() {
+    static_assert(sizeof(T) <= Arena::SLOT, "state does not fit in a slot");
+    if (!scratch && (scratch = Arena::acquire())) new (scratch) T();
+    return (T*)scratch;
+  }
+  // Step STARTING -> RUNNING -> ENDING -> INACTIVE and return the envelope
+  // brightness 0..1 of this frame, 0 when the animation has just ended
+  float update_lifecycle();
 };
 
 inline void setMotionBlur(uint8_t n) { Display::setMotionBlur(n); }
+inline void setPostProcess(const post_t &p) { PostProcess::set(p); }
 inline uint8_t getMotionBlur() { return Display::getMotionBlur(); }
 inline void setBrightness(float n) { Display::setBrightness(n); }
 inline float getBrightness() { return Display::getBrightness()/255.0f; }
@@ -45,35 +45,12 @@ public:
     radius_start = settings.radius_start;
     distance = settings.distance;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
     float radius = radius_max;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      }
-      else {
-        brightness *= timer_starting.ratio();
-        radius *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      }
-      else {
-        brightness *= (1 - timer_ending.ratio());
-        radius *= (1 - timer_ending.ratio());
-      }
-    }
+    const float envelope = update_lifecycle();
+    brightness *= envelope;
+    radius *= envelope;
     if (radius < radius_start) {
       radius = radius_start;
     }
@@ -88,6 +65,14 @@ public:
     Quaternion q4 = Quaternion(angle * 0.8f, Vector3(0, 1, 0));
 
     for (uint8_t y = 0; y < 10; y++) {
+      if (!bitmap[y]) continue;
+      // Rotation around X-axis with increased rotation by y offset, the same
+      // for the whole row so combine it with the others once per row
+      float py = (4.5f - y) / 7.5f * radius;
+      Quaternion q1 = Quaternion(angle - (arc * py), Vector3::X);
+      RotationMatrix r2 = RotationMatrix(q2 * q1);
+      RotationMatrix r3 = RotationMatrix(q3 * q1);
+      RotationMatrix r4 = RotationMatrix(q4 * q1);
       uint16_t mask = 0x8000;
       for (uint8_t x = 0; x < 16; x++) {
         if (bitmap[y] & mask) {
@@ -95,15 +80,13 @@ public:
           Vector3 point = Vector3(x - 7.5f, 4.5f - y, 0) / 7.5f * radius;
           // Project to a line at the bottom of the coordinate system
           Vector3 line = Vector3(point.x, -radius, 0);
-          // Rotation around X-axis with increased rotation by y offset
-          Quaternion q1 = Quaternion(angle - (arc * point.y), Vector3::X);
           // Apply both rotations on the projected line and fill in color
           Color c = Color((hue16 >> 8) + 000 + 8 * y, RainbowGradientPalette);
-          radiate((q2 * q1).rotate(line * 0.8f), c.scale(brightness), distance);
+          radiate(r2.rotate(line * 0.8f), c.scale(brightness), distance);
           c = Color((hue16 >> 8) + 064 + 8 * y, RainbowGradientPalette);
-          radiate((q3 * q1).rotate(line * 0.9f), c.scale(brightness), distance);
+          radiate(r3.rotate(line * 0.9f), c.scale(brightness), distance);
           c = Color((hue16 >> 8) + 128 + 8 * y, RainbowGradientPalette);
-          radiate((q4 * q1).rotate(line * 1.0f), c.scale(brightness), distance);
+          radiate(r4.rotate(line * 1.0f), c.scale(brightness), distance);
         }
         mask >>= 1;
       }
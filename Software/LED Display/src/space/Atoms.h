@@ -31,35 +31,12 @@ public:
     radius_start = settings.radius_start;
     distance = settings.distance;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
     float radius = radius_max;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      }
-      else {
-        brightness *= timer_starting.ratio();
-        radius *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      }
-      else {
-        brightness *= (1 - timer_ending.ratio());
-        radius *= (1 - timer_ending.ratio());
-      }
-    }
+    const float envelope = update_lifecycle();
+    brightness *= envelope;
+    radius *= envelope;
     if (radius < radius_start) {
       radius = radius_start;
     }
@@ -96,7 +73,7 @@ public:
     for (uint8_t i = 0; i < ATOMS; i++) {
       Vector3 v = axes[i].rotate(atoms[i]) * radius;
       Color c = Color((hue16 >> 8) + (i * 8), RainbowGradientPalette);
-      radiate5(v, c.scale(brightness), distance);
+      radiate(v, c.scale(brightness), distance, falloff_t::QUINTIC);
     }
   }
 };
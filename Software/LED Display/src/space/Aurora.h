@@ -2,10 +2,13 @@
 #define AURORA_H
 
 #include "Animation.h"
+#include "power/NoiseLoop.h"
 
 class Aurora : public Animation {
  private:
   float phase = 0;
+  // Baked noise that loops, instead of sampling noise every frame
+  NoiseLoop noise_loop;
 
   static constexpr auto &settings = config.animation.aurora;
 
@@ -20,24 +23,27 @@ class Aurora : public Animation {
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     phase += dt * 0.3f;
+    // Both curtains from planes of the loop far apart, a loop every 40
+    // seconds, baked the first time
+    if (settings.baked) {
+      NoiseLoop::bake(noise);
+      noise_loop.update(phase / 12);
+    }
     for (int x = 0; x < 16; x++) {
       for (int z = 0; z < 16; z++) {
-        float h1 = 10 + 4 * noise.noise3(x * 0.15f + phase, z * 0.15f, phase * 0.5f);
-        float h2 = 8 + 3 * noise.noise3(x * 0.2f, z * 0.2f + phase * 0.7f, phase * 0.3f);
+        float h1, h2;
+        if (settings.baked) {
+          h1 = 10 + 4 * noise_loop.at(x, 3, z) / 255.0f;
+          h2 = 8 + 3 * noise_loop.at(x, 12, z) / 255.0f;
+        } else {
+          h1 = 10 + 4 * noise.noise3(x * 0.15f + phase, z * 0.15f, phase * 0.5f);
+          h2 = 8 + 3 * noise.noise3(x * 0.2f, z * 0.2f + phase * 0.7f, phase * 0.3f);
+        }
         for (int y = 0; y < 16; y++) {
           float b1 = fmaxf(0.0f, 1.0f - fabsf(y - h1) * 0.4f);
           float b2 = fmaxf(0.0f, 0.7f - fabsf(y - h2) * 0.35f);
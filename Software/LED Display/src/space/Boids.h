@@ -2,10 +2,11 @@
 #define BOIDS_H
 
 #include "Animation.h"
+#include "power/SpatialGrid.h"
 
 class Boids : public Animation {
  private:
-  static const int NUM_BOIDS = 50;
+  static const int MAX_BOIDS = SpatialGrid::CAPACITY;
 
   struct Boid {
     float x, y, z;
@@ -13,7 +14,14 @@ class Boids : public Animation {
     uint8_t hue;
   };
 
-  Boid boids[NUM_BOIDS];
+  // Working memory in the arena, with the boids seeded ahead of init().
+  // Neighbour queries only visit the boids in the 27 cells around a boid.
+  struct State {
+    Boid boids[MAX_BOIDS];
+    SpatialGrid grid;
+    int seeded = 0;
+  };
+  int count;
 
   static constexpr auto &settings = config.animation.boids;
 
@@ -23,32 +31,32 @@ class Boids : public Animation {
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
+    prepare(0xFFFF);
+  }
 
-    for (int i = 0; i < NUM_BOIDS; i++) {
-      boids[i].x = noise.nextRandom(-5.0f, 5.0f);
-      boids[i].y = noise.nextRandom(-5.0f, 5.0f);
-      boids[i].z = noise.nextRandom(-5.0f, 5.0f);
-      boids[i].vx = noise.nextRandom(-1.0f, 1.0f);
-      boids[i].vy = noise.nextRandom(-1.0f, 1.0f);
-      boids[i].vz = noise.nextRandom(-1.0f, 1.0f);
-      boids[i].hue = (uint8_t)(int)noise.nextRandom(0, 256);
-    }
+  // Seed 16 boids a step
+  bool prepare(uint16_t budget) {
+    State &s = *memory<State>();
+    count = settings.count < MAX_BOIDS ? settings.count : MAX_BOIDS;
+    for (; budget && s.seeded < count; budget--)
+      for (int end = min(s.seeded + 16, count); s.seeded < end; s.seeded++) {
+        Boid &boid = s.boids[s.seeded];
+        boid.x = noise.nextRandom(-5.0f, 5.0f);
+        boid.y = noise.nextRandom(-5.0f, 5.0f);
+        boid.z = noise.nextRandom(-5.0f, 5.0f);
+        boid.vx = noise.nextRandom(-1.0f, 1.0f);
+        boid.vy = noise.nextRandom(-1.0f, 1.0f);
+        boid.vz = noise.nextRandom(-1.0f, 1.0f);
+        boid.hue = (uint8_t)(int)noise.nextRandom(0, 256);
+      }
+    return s.seeded >= count;
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     // Flocking parameters
     const float cohesionWeight = 0.005f;
@@ -58,21 +66,33 @@ class Boids : public Animation {
     const float speedLimit = 4.0f;
     const float wallLimit = 6.5f;
     const float wallForce = 2.0f;
-
-    for (int i = 0; i < NUM_BOIDS; i++) {
+    // Neighbours are within one grid cell
+    const float viewDist = SpatialGrid::SIZE;
+
+    // Lower quality flocks with fewer boids and draws them smaller
+    const int flock = count - count * (Governor::FULL - quality) / 8;
+    const float radius = 1.25f + 0.25f * quality;
+    Boid *boids = memory<State>()->boids;
+    SpatialGrid &grid = memory<State>()->grid;
+
+    grid.build(flock, [&](uint16_t i) {
+      return Vector3(boids[i].x, boids[i].y, boids[i].z);
+    });
+    for (int i = 0; i < flock; i++) {
       float cohX = 0, cohY = 0, cohZ = 0;
       float sepX = 0, sepY = 0, sepZ = 0;
       float aliX = 0, aliY = 0, aliZ = 0;
       int neighbors = 0;
 
-      for (int j = 0; j < NUM_BOIDS; j++) {
-        if (i == j) continue;
+      const Vector3 p = Vector3(boids[i].x, boids[i].y, boids[i].z);
+      grid.query(p, [&](uint16_t j) {
+        if (i == j) return;
         float dx = boids[j].x - boids[i].x;
         float dy = boids[j].y - boids[i].y;
         float dz = boids[j].z - boids[i].z;
-        float dist = sqrtf(dx * dx + dy * dy + dz * dz);
+        float dist2 = dx * dx + dy * dy + dz * dz;
 
-        if (dist < 8.0f && dist > 0.001f) {
+        if (dist2 < viewDist * viewDist && dist2 > 0.000001f) {
           // Cohesion: steer toward center of neighbors
           cohX += boids[j].x;
           cohY += boids[j].y;
@@ -85,13 +105,14 @@ class Boids : public Animation {
           aliZ += boids[j].vz;
 
           // Separation: avoid crowding
-          if (dist < separationDist) {
-            sepX -= dx / dist;
-            sepY -= dy / dist;
-            sepZ -= dz / dist;
+          if (dist2 < separationDist * separationDist) {
+            float inverse = 1 / sqrtf(dist2);
+            sepX -= dx * inverse;
+            sepY -= dy * inverse;
+            sepZ -= dz * inverse;
           }
         }
-      }
+      });
 
       if (neighbors > 0) {
         // Cohesion: steer toward average position
@@ -142,7 +163,7 @@ class Boids : public Animation {
       Vector3 pos = Vector3(boids[i].x, boids[i].y, boids[i].z);
       Color c = Color(boids[i].hue, RainbowGradientPalette);
       c.scale(brightness);
-      radiate5(pos, c, 2.0f);
+      DrawList::splat(pos, c, radius, falloff_t::QUINTIC);
     }
   }
 };
@@ -40,35 +40,12 @@ public:
     radius_start = settings.radius_start;
     distance = settings.distance;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
     float radius = radius_max;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      }
-      else {
-        brightness *= timer_starting.ratio();
-        radius *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      }
-      else {
-        brightness *= (1 - timer_ending.ratio());
-        radius *= (1 - timer_ending.ratio());
-      }
-    }
+    const float envelope = update_lifecycle();
+    brightness *= envelope;
+    radius *= envelope;
     if (radius < radius_start) {
       radius = radius_start;
     }
@@ -86,9 +63,10 @@ public:
       q = Quaternion(angle, Vector3(1, 1, 1));
     }
 
+    RotationMatrix r = RotationMatrix(q);
     for (uint16_t i = 0; i < 12; i++) {
-      Vector3 v1 = q.rotate(polygon[i][0] * radius);
-      Vector3 v2 = q.rotate(polygon[i][1] * radius);
+      Vector3 v1 = r.rotate(polygon[i][0] * radius);
+      Vector3 v2 = r.rotate(polygon[i][1] * radius);
       Vector3 n = v1 - v2;
       // Get the amount of steps needed
       float steps = 1 + max(abs(n.z), max(abs(n.x), abs(n.y)));
@@ -7,13 +7,8 @@ class Explosion : public Animation {
  private:
   static const int NUM_P = 250;
 
-  struct EPart {
-    Vector3 dir;
-    float dist;
-    uint8_t hue;
-  };
-
-  EPart parts[NUM_P];
+  // velocity holds the offset at full expansion
+  ParticlePool parts;
   float phase = 0;
 
   static constexpr auto &settings = config.animation.explosion;
@@ -26,30 +21,26 @@ class Explosion : public Animation {
     timer_ending = settings.endtime;
     phase = 0;
 
+    parts.acquire(NUM_P);
     for (int i = 0; i < NUM_P; i++) {
       // Random direction on unit sphere, then normalize
-      parts[i].dir = Vector3(
+      Vector3 dir = Vector3(
           noise.nextRandom(-1.0f, 1.0f),
           noise.nextRandom(-1.0f, 1.0f),
           noise.nextRandom(-1.0f, 1.0f)).normalized();
-      parts[i].dist = noise.nextRandom(0.5f, 1.0f);
-      parts[i].hue = (uint8_t)(int)noise.nextRandom(0, 256);
+      float dist = noise.nextRandom(0.5f, 1.0f);
+      parts.add(Vector3(0, 0, 0), dir * dist * 7.5f,
+                (uint8_t)(int)noise.nextRandom(0, 256), 1.0f, 0.0f);
     }
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) {
+      parts.release();
+      return;
     }
 
     phase += dt;
@@ -66,15 +57,15 @@ class Explosion : public Animation {
       expansion = sinf(cycle * PI);
     }
 
-    for (int i = 0; i < NUM_P; i++) {
-      float radius = parts[i].dist * expansion * 7.5f;
-      Vector3 pos = parts[i].dir * radius;
+    for (uint16_t i = 0; i < parts.count(); i++) {
+      Vector3 pos =
+          Vector3(parts.vx[i], parts.vy[i], parts.vz[i]) * expansion;
 
       // LavaPalette colors based on expansion and particle hue
-      uint8_t palIdx = parts[i].hue + (uint8_t)(expansion * 64.0f);
+      uint8_t palIdx = parts.hue[i] + (uint8_t)(expansion * 64.0f);
       Color c = Color(palIdx, LavaPalette);
       c.scale(brightness);
-      radiate(pos, c, 1.5f);
+      radiate(pos, c, 1.5f, falloff_t::LINEAR);
     }
   }
 };
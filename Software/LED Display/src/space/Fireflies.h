@@ -32,18 +32,9 @@ class Fireflies : public Animation {
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     for (int i = 0; i < NUM_FLIES; i++) {
       Firefly& f = flies[i];
@@ -68,7 +59,7 @@ class Fireflies : public Animation {
       if (glow > 0.05f) {
         Color c = Color(f.hue, RainbowGradientPalette);
         c.scale((uint8_t)(glow * 255));
-        radiate5(Vector3(f.x, f.y, f.z), c, 2.0f);
+        DrawList::splat(Vector3(f.x, f.y, f.z), c, 2.0f, falloff_t::QUINTIC);
       }
     }
   }
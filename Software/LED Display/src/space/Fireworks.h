@@ -6,14 +6,20 @@
 class Fireworks : public Animation {
  private:
   float radius;
-  uint16_t numDebris;
   Vector3 source;
   Vector3 target;
   Vector3 velocity;
   Vector3 gravity;
-  Particle missile;
-  Particle debris[200];
+  static const uint16_t DEBRIS = 200;
+  ParticlePool debris;
+  // Debris drawn white this frame instead of in its color
+  uint32_t sparkles[(DEBRIS + 31) / 32];
   boolean exploded;
+  // Time of the animation, the launch of the missile and its flight until
+  // it bursts
+  float time;
+  float launched;
+  float burst;
 
   static constexpr auto &settings = config.animation.fireworks;
 
@@ -22,6 +28,10 @@ class Fireworks : public Animation {
     state = state_t::RUNNING;
     timer_running = settings.runtime;
     radius = settings.radius;
+    debris.acquire(DEBRIS);
+    // Debris rests on the ground until it faded
+    debris.ballistic(-1.0f, -1.0f, 0, true);
+    time = 0;
     fireArrow();
   }
 
@@ -37,77 +47,86 @@ class Fireworks : public Animation {
     float t = noise.nextGaussian(0.60f, 0.20f);
     // Determine directional velocities in pixels per second
     velocity = (target - source) / t;
-    // Set missile source and velocity
-    missile.position = source;
-    missile.velocity = velocity;
     // Set some system gravity
     gravity = Vector3(0, -1.0f, 0);
+    // The missile bursts at the top of its arc or when it passes the target
+    launched = time;
+    burst = velocity.y / -gravity.y;
+    const float rise = target.y - source.y;
+    const float d = velocity.y * velocity.y + 2 * gravity.y * rise;
+    if (d >= 0) burst = fminf(burst, (velocity.y - sqrtf(d)) / -gravity.y);
     exploded = false;
   }
 
+  // Position of the missile s seconds after its launch
+  Vector3 missile(const float s) {
+    return source + velocity * s + gravity * (0.5f * s * s);
+  }
+
     void draw(float dt) {
     radius = settings.radius;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    setPostProcess(settings.post);
+    uint8_t brightness = settings.brightness;
 
+    time += dt;
+    if (exploded) {
+      debris.age(dt);
+    }
     // Missile drawing mode
-    if (!exploded) {
-      Vector3 temp = missile.position;
-      missile.move(dt, gravity);
-      // If missile falls back to earth or moved past the target explode it
-      if ((temp.y > missile.position.y) | (missile.position.y > target.y)) {
-        // Activate explode drawing mode
-        exploded = true;
-        // If target is reached the missile is exploded and debris is formed
-        numDebris = random((sizeof(debris) / sizeof(Particle)) / 2,
-                           sizeof(debris) / sizeof(Particle));
-        // Overall exploding power of particles for all debris
-        float pwr = noise.nextRandom(0.50f, 1.00f);
-        // starting position in the hue color palette
-        uint8_t hue = (uint8_t)random(0, 256);
-        // generate debris with power and hue
-        for (uint16_t i = 0; i < numDebris; i++) {
-          // Debris has random velocities depending on overall power
-          Vector3 explode =
-              Vector3(noise.nextRandom(-pwr, pwr), noise.nextRandom(-pwr, pwr),
-                      noise.nextRandom(-pwr, pwr));
-          debris[i] = {temp, explode, uint8_t(hue + random(0, 64)), 1.0f,
-                       noise.nextRandom(1.0f, 2.0f)};
-        }
-      }
-      else {
-        voxel(missile.position * radius, Color::WHITE);
+    else if (time - launched >= burst) {
+      // Activate explode drawing mode
+      exploded = true;
+      // If target is reached the missile is exploded and debris is formed
+      const float born = launched + burst;
+      const Vector3 temp = missile(burst);
+      uint16_t numDebris = random(debris.capacity() / 2, debris.capacity());
+      debris.clear();
+      // Overall exploding power of particles for all debris
+      float pwr = noise.nextRandom(0.50f, 1.00f);
+      // starting position in the hue color palette
+      uint8_t hue = (uint8_t)random(0, 256);
+      // generate debris with power and hue, aged since the burst
+      for (uint16_t i = 0; i < numDebris; i++) {
+        // Debris has random velocities depending on overall power
+        Vector3 explode =
+            Vector3(noise.nextRandom(-pwr, pwr), noise.nextRandom(-pwr, pwr),
+                    noise.nextRandom(-pwr, pwr));
+        const float rate = 1.0f / noise.nextRandom(1.0f, 2.0f);
+        debris.launch(born, temp, explode, uint8_t(hue + random(0, 64)),
+                      1.0f - rate * (time - born), rate);
       }
     }
+    else {
+      voxel(missile(time - launched) * radius, Color::WHITE);
+    }
 
     // Explosion drawing mode
     if (exploded) {
-      uint16_t visible = 0;
-      for (uint16_t i = 0; i < numDebris; i++) {
-        if (debris[i].position.y > -1.0f)
-          debris[i].move(dt, gravity);
-        else
-          debris[i].position.y = -1.0f;
-        if (debris[i].brightness > 0) {
-          visible++;
-          debris[i].brightness -= dt * (1 / debris[i].seconds);
-        } else {
-          debris[i].brightness = 0;
-        }
-        Color c = Color(debris[i].hue, RainbowGradientPalette);
-        // Add some random sparkles
-        if (random(0, 20) == 0) {
-          c = Color::WHITE;
+      debris.fly(time);
+      uint16_t visible = debris.compact();
+      // Some random sparkles, white instead of their color
+      memset(sparkles, 0, sizeof(sparkles));
+      for (uint16_t i = 0; i < visible; i++)
+        if (random(0, 20) == 0) sparkles[i >> 5] |= 1u << (i & 31);
+      splat_light(debris, RainbowGradientPalette, brightness, radius,
+                  sparkles);
+      for (uint16_t i = 0; i < visible; i++) {
+        if (sparkles[i >> 5] & 1u << (i & 31)) {
+          Color c = Color::WHITE;
+          c.scale(debris.life[i] * brightness);
+          voxel_light(Vector3(debris.x[i], debris.y[i], debris.z[i]) * radius,
+                      c);
         }
-        c.scale(debris[i].brightness * brightness);
-        voxel_add(debris[i].position * radius, c);
       }
       if (timer_running.update()) {
         state = state_t::ENDING;
       }
       if (visible == 0) {
-        if (state == state_t::ENDING)
+        if (state == state_t::ENDING) {
           state = state_t::INACTIVE;
+          debris.release();
+        }
         else
           fireArrow();
       }
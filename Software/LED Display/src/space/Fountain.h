@@ -7,16 +7,9 @@ class Fountain : public Animation {
  private:
   static const int MAX_P = 300;
 
-  struct FPart {
-    float x, y, z;
-    float vx, vy, vz;
-    float life;
-    uint8_t hue;
-  };
-
-  FPart parts[MAX_P];
-  int numParts = 0;
+  ParticlePool parts;
   float spawnTimer = 0;
+  float time = 0;
   uint16_t hue16 = 0;
 
   static constexpr auto &settings = config.animation.fountain;
@@ -27,75 +20,55 @@ class Fountain : public Animation {
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
-    numParts = 0;
+    parts.acquire(MAX_P);
+    // Particles leave at the floor and the sides of the cube
+    parts.ballistic(-10.0f, -7.5f, 8.0f);
     spawnTimer = 0;
+    time = 0;
     hue16 = 0;
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) {
+      parts.release();
+      return;
     }
 
     hue16 += (uint16_t)(dt * 512);
 
-    // Spawn new particles from bottom center
+    // Age the particles, remove dead particles or those past the floor
+    time += dt;
+    parts.age(dt);
+    parts.expire(time);
+
+    // Spawn new particles from bottom center, at their time in the frame
     spawnTimer += dt;
     float spawnInterval = 0.005f;
-    while (spawnTimer >= spawnInterval && numParts < MAX_P) {
+    while (spawnTimer >= spawnInterval && parts.count() < parts.capacity()) {
       spawnTimer -= spawnInterval;
-      FPart &p = parts[numParts];
-      p.x = 0.0f;
-      p.y = -7.5f;
-      p.z = 0.0f;
-      p.vy = noise.nextRandom(13.0f, 17.0f);
       float spread = noise.nextRandom(1.0f, 4.0f);
       float angle = noise.nextRandom(0.0f, 2.0f * PI);
-      p.vx = cosf(angle) * spread;
-      p.vz = sinf(angle) * spread;
-      p.life = 1.0f;
-      p.hue = (uint8_t)(hue16 >> 8);
-      numParts++;
+      Vector3 v = Vector3(cosf(angle) * spread, noise.nextRandom(13.0f, 17.0f),
+                          sinf(angle) * spread);
+      parts.launch(time - spawnTimer, Vector3(0.0f, -7.5f, 0.0f), v,
+                   (uint8_t)(hue16 >> 8), 1.0f - 0.2f * spawnTimer, 0.2f);
     }
+    // A full pool drops the backlog, particles are born in this frame
+    if (spawnTimer > dt) spawnTimer = dt;
+    parts.fly(time);
 
-    // Update and draw particles
-    int alive = 0;
-    for (int i = 0; i < numParts; i++) {
-      // Apply gravity
-      parts[i].vy -= 10.0f * dt;
-      // Move
-      parts[i].x += parts[i].vx * dt;
-      parts[i].y += parts[i].vy * dt;
-      parts[i].z += parts[i].vz * dt;
-      // Decay life
-      parts[i].life -= 0.2f * dt;
-
-      // Remove dead particles or those below floor
-      if (parts[i].y < -7.5f || parts[i].life <= 0.0f) {
-        continue;
-      }
-
-      // Draw particle
-      Vector3 pos = Vector3(parts[i].x, parts[i].y, parts[i].z);
-      float b = parts[i].life;
+    // Draw particles
+    for (uint16_t i = 0; i < parts.count(); i++) {
+      Vector3 pos = Vector3(parts.x[i], parts.y[i], parts.z[i]);
+      float b = parts.life[i];
       if (b < 0.15f) b = 0.15f;
-      Color c = Color(parts[i].hue, RainbowGradientPalette);
+      Color c = Color(parts.hue[i], RainbowGradientPalette);
       c.scale((uint8_t)(b * brightness));
-      voxel(pos, c);
-      parts[alive] = parts[i];
-      alive++;
+      voxel_light(pos, c);
     }
-    numParts = alive;
   }
 };
 #endif
@@ -7,20 +7,59 @@ class Galaxy : public Animation {
  private:
   static const int NUM_STARS = 600;
 
+  // A star turns with its arm, the spread and height stay put. The arm
+  // position is kept at angle 0 and turned by the angle of the frame
   struct Star {
-    float r;
-    float armAngle;
-    float spread_x;
-    float spread_z;
+    float x, z;
+    float spread_x, spread_z;
     float height;
-    uint8_t arm;
+    Color color;
+    float bright;
   };
 
-  Star stars[NUM_STARS];
+  // Working memory in the arena, with the stars placed ahead of init()
+  struct State {
+    Star stars[NUM_STARS];
+    int placed = 0;
+  };
   float angle = 0;
 
   static constexpr auto &settings = config.animation.galaxy;
 
+  // Place a star of the arms at random
+  static void place(Star &star) {
+    float r = noise.nextRandom(0.0f, 1.0f);
+    float armAngle = noise.nextRandom(0.0f, 2.0f * PI);
+    float spread_x = noise.nextGaussian(0.0f, 0.15f);
+    float spread_z = noise.nextGaussian(0.0f, 0.15f);
+    float height = noise.nextGaussian(0.0f, 0.08f);
+    uint8_t arm = (uint8_t)(int)noise.nextRandom(0, 3);
+
+    // Spiral arm angle: base arm offset + winding with radius + individual spread
+    float armOffset = arm * (2.0f * PI / 3.0f);
+    float spiralAngle = armOffset + armAngle + r * 4.0f;
+    star.x = r * cosf(spiralAngle) * 7.5f;
+    star.z = r * sinf(spiralAngle) * 7.5f;
+    star.spread_x = spread_x * r * 7.5f;
+    star.spread_z = spread_z * r * 7.5f;
+    star.height = height * (1.0f - r) * 7.5f;
+
+    // Color gradient: warm center (yellow/orange) to blue outer
+    uint8_t hueVal;
+    if (r < 0.3f) {
+      // Warm center: orange to yellow (hue ~32-48)
+      hueVal = 32 + (uint8_t)(r * 50.0f);
+    } else if (r < 0.6f) {
+      // Mid region: white-blue (hue ~128-160)
+      hueVal = 128 + (uint8_t)((r - 0.3f) * 100.0f);
+    } else {
+      // Outer: deep blue (hue ~160-200)
+      hueVal = 160 + (uint8_t)((r - 0.6f) * 100.0f);
+    }
+    star.color = Color(hueVal, RainbowGradientPalette);
+    star.bright = (1.0f - r * 0.6f);
+  }
+
  public:
   void init() {
     state = state_t::STARTING;
@@ -28,31 +67,23 @@ class Galaxy : public Animation {
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
     angle = 0;
+    prepare(0xFFFF);
+  }
 
-    for (int i = 0; i < NUM_STARS; i++) {
-      stars[i].r = noise.nextRandom(0.0f, 1.0f);
-      stars[i].armAngle = noise.nextRandom(0.0f, 2.0f * PI);
-      stars[i].spread_x = noise.nextGaussian(0.0f, 0.15f);
-      stars[i].spread_z = noise.nextGaussian(0.0f, 0.15f);
-      stars[i].height = noise.nextGaussian(0.0f, 0.08f);
-      stars[i].arm = (uint8_t)(int)noise.nextRandom(0, 3);
-    }
+  // Place 16 stars a step
+  bool prepare(uint16_t budget) {
+    State &s = *memory<State>();
+    for (; budget && s.placed < NUM_STARS; budget--)
+      for (int end = min(s.placed + 16, NUM_STARS); s.placed < end; s.placed++)
+        place(s.stars[s.placed]);
+    return s.placed == NUM_STARS;
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     angle += dt * 0.15f;
 
@@ -65,35 +96,17 @@ class Galaxy : public Animation {
     Color coreColor = Color(255, 220, 180);
     radiate5(q.rotate(Vector3(0, 0, 0)), coreColor.scale(brightness), 3.0f);
 
-    // Render each star along spiral arms
+    // Render each star along spiral arms, all arms turn by the same angle so
+    // a frame takes one sine and cosine and a complex multiply per star
+    float sn, cs;
+    fsincos(angle * 2.0f, sn, cs);
+    const Star *stars = memory<State>()->stars;
     for (int i = 0; i < NUM_STARS; i++) {
-      float r = stars[i].r;
-      // Spiral arm angle: base arm offset + winding with radius + individual spread
-      float armOffset = stars[i].arm * (2.0f * PI / 3.0f);
-      float spiralAngle = armOffset + stars[i].armAngle + r * 4.0f + angle * 2.0f;
-
-      float px = r * cosf(spiralAngle) + stars[i].spread_x * r;
-      float pz = r * sinf(spiralAngle) + stars[i].spread_z * r;
-      float py = stars[i].height * (1.0f - r);
-
-      Vector3 pos = q.rotate(Vector3(px, py, pz) * 7.5f);
-
-      // Color gradient: warm center (yellow/orange) to blue outer
-      uint8_t hueVal;
-      if (r < 0.3f) {
-        // Warm center: orange to yellow (hue ~32-48)
-        hueVal = 32 + (uint8_t)(r * 50.0f);
-      } else if (r < 0.6f) {
-        // Mid region: white-blue (hue ~128-160)
-        hueVal = 128 + (uint8_t)((r - 0.3f) * 100.0f);
-      } else {
-        // Outer: deep blue (hue ~160-200)
-        hueVal = 160 + (uint8_t)((r - 0.6f) * 100.0f);
-      }
-      Color c = Color(hueVal, RainbowGradientPalette);
-      float starBright = (1.0f - r * 0.6f);
-      c.scale((uint8_t)(starBright * brightness));
-      voxel(pos, c);
+      const Star &star = stars[i];
+      float px = star.x * cs - star.z * sn + star.spread_x;
+      float pz = star.x * sn + star.z * cs + star.spread_z;
+      Vector3 pos = q.rotate(Vector3(px, star.height, pz));
+      voxel_light(pos, star.color.scaled((uint8_t)(star.bright * brightness)));
     }
   }
 };
@@ -42,7 +42,7 @@ public:
     radius = settings.radius;
     resolution = settings.resolution;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
 
     phase += dt * phase_speed;
     angle += dt * angle_speed;
@@ -52,18 +52,24 @@ public:
     Quaternion q2 = Quaternion(angle, Vector3(1, 0, 0));
 
     // Resize the function to be big enough to have the rotated version fit
-    // sqrt(3) * 7.5 * 2 => 26 is big enough but more resolution is better
-    for (uint16_t y = bottom; y <= top; y++) {
-      float xf = sinf(phase + mapf(y, 0, resolution, 0, 2 * PI));
-      float zf = cosf(phase + mapf(y, 0, resolution, 0, 2 * PI));
-      Vector3 p0 = Vector3(xf, 2 * (y / resolution) - 1, zf) * radius;
-      Vector3 p1 = q2.rotate(p0);
-      Vector3 p2 = (q2 * q1).rotate(p0);
-      Color c1 = Color((hue16 >> 8) + y * 2 + 000, RainbowGradientPalette);
-      Color c2 = Color((hue16 >> 8) + y * 2 + 128, RainbowGradientPalette);
-      radiate(p1, c1.scale(brightness), 1.0f + (float)thickness / 20.0f);
-      radiate(p2, c2.scale(brightness), 1.0f + (float)thickness / 20.0f);
-    }
+    // sqrt(3) * 7.5 * 2 => 26 is big enough but more resolution is better.
+    // Both strands have the same length, the first one is traced and the
+    // second one mirrored from it, points about a radius apart.
+    const float r = 1.0f + (float)thickness / 20.0f;
+    const Quaternion q3 = q2 * q1;
+    auto strand = [&](float y) {
+      float xf, zf;
+      fsincos(phase + mapf(y, 0, resolution, 0, 2 * PI), xf, zf);
+      return Vector3(xf, 2 * (y / resolution) - 1, zf) * radius;
+    };
+    trace(strand, bottom, top, r, 256, [&](const Vector3 &p0, float y) {
+      Color c1 = Color((hue16 >> 8) + (uint8_t)(y * 2) + 000,
+                       RainbowGradientPalette);
+      Color c2 = Color((hue16 >> 8) + (uint8_t)(y * 2) + 128,
+                       RainbowGradientPalette);
+      radiate(q2.rotate(p0), c1.scale(brightness), r);
+      radiate(q3.rotate(p0), c2.scale(brightness), r);
+    });
     if (timer_interval.update()) {
       int progress = 0;
       if (stage == progress++) top <= resolution ? top++ : stage++;
@@ -5,39 +5,43 @@
 
 class Hourglass : public Animation {
  private:
-  static const int MAX_SAND = 300;
-  struct Sand {
-    float x, y, z;
-    bool falling;
-  };
-  Sand grains[MAX_SAND];
-  int numGrains;
+  // Sand and the inside of the glass, one bit per voxel. A layer is a
+  // horizontal slice at voxel height y, a row is x and the bit is z.
+  uint16_t sand[16][16];
+  uint16_t mask[16][16];
+  // Grains that moved in the last step are drawn brighter
+  uint16_t moved[16][16];
+  float stepTimer;
   float flipTimer;
   float phase;
   bool flipped;
+  // Layers of the glass shaped ahead of the next init(), the glass follows
+  // the center of the cube (Sync::shift) so it is shaped for every run
+  uint8_t shaped = 0;
 
   static constexpr auto &settings = config.animation.hourglass;
 
+  // The top bulb filled with sand
   void resetSand() {
-    numGrains = MAX_SAND;
     flipped = false;
     flipTimer = 0;
+    stepTimer = 0;
     phase = 0;
+    memset(moved, 0, sizeof(moved));
+    for (uint8_t y = 0; y < 16; y++)
+      for (uint8_t x = 0; x < 16; x++) sand[y][x] = y > CY + 1 ? mask[y][x] : 0;
+  }
 
-    // Fill top half with sand grains
-    for (int i = 0; i < numGrains; i++) {
-      // Place grains in the top bulb (y > 0)
-      float angle = noise.nextRandom(0, 2.0f * PI);
-      float r = noise.nextRandom(0, 1.0f);
-      float height = noise.nextRandom(1.0f, 6.5f);
-      // Hourglass shape: radius decreases near center
-      float maxR = height * 0.8f;
-      if (maxR > 5.0f) maxR = 5.0f;
-      r *= maxR;
-      grains[i].x = cosf(angle) * r;
-      grains[i].y = height;
-      grains[i].z = sinf(angle) * r;
-      grains[i].falling = false;
+  // Inside of the glass of layer y
+  void shape(const uint8_t y) {
+    for (uint8_t x = 0; x < 16; x++) {
+      uint16_t inside = 0;
+      for (uint8_t z = 0; z < 16; z++) {
+        const float r = sqrtf((x - CX) * (x - CX) + (z - CZ) * (z - CZ));
+        // Half a voxel of slack, so the neck is two voxels wide
+        if (r < hourglassRadius(y - CY) + 0.25f) inside |= 1 << z;
+      }
+      mask[y][x] = inside;
     }
   }
 
@@ -48,106 +52,90 @@ class Hourglass : public Animation {
     return 0.6f + (absY - 0.5f) * 0.85f;
   }
 
+  // Move the grains of a source row that are free to go to the row below,
+  // shifted by dz along z. Returns the grains that arrived below.
+  static inline uint16_t fall(uint16_t &source, uint16_t &below,
+                              const uint16_t inside, const int8_t dz) {
+    const uint16_t to = dz > 0 ? source << 1 : dz < 0 ? source >> 1 : source;
+    const uint16_t free = to & ~below & inside;
+    below |= free;
+    const uint16_t from = dz > 0 ? free >> 1 : dz < 0 ? free << 1 : free;
+    source &= ~from;
+    return free;
+  }
+
+  // One step of the falling sand, layer by layer from the bottom up so every
+  // grain moves at most one layer. Grains fall straight down when they can,
+  // or slide down to one of the four sides in a random order.
+  void step() {
+    memset(moved, 0, sizeof(moved));
+    for (uint8_t y = 1; y < 16; y++) {
+      uint16_t(&above)[16] = sand[y];
+      uint16_t(&below)[16] = sand[y - 1];
+      const uint16_t(&inside)[16] = mask[y - 1];
+      for (uint8_t x = 0; x < 16; x++)
+        moved[y - 1][x] |= fall(above[x], below[x], inside[x], 0);
+      static const int8_t sides[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+      const uint8_t first = noise.nextRandom16(0, 3);
+      for (uint8_t s = 0; s < 4; s++) {
+        const int8_t dx = sides[(first + s) & 3][0];
+        const int8_t dz = sides[(first + s) & 3][1];
+        for (uint8_t x = 0; x < 16; x++) {
+          if (!above[x] || x + dx < 0 || x + dx > 15) continue;
+          moved[y - 1][x + dx] |=
+              fall(above[x], below[x + dx], inside[x + dx], dz);
+        }
+      }
+    }
+  }
+
  public:
   void init() {
     state = state_t::STARTING;
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
+    prepare(0xFFFF);
+    shaped = 0;
     resetSand();
   }
 
+  // The inside of the glass, a layer a step
+  bool prepare(uint16_t budget) {
+    for (; budget && shaped < 16; budget--) shape(shaped++);
+    return shaped == 16;
+  }
+
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     phase += dt;
     flipTimer += dt;
 
-    // Flip hourglass every 10 seconds
+    // Flip hourglass every 10 seconds, the glass is symmetric
     if (flipTimer > 10.0f) {
       flipTimer = 0;
-      // Flip all grains
-      for (int i = 0; i < numGrains; i++) {
-        grains[i].y = -grains[i].y;
-        grains[i].falling = false;
-      }
+      for (uint8_t y = 0; y < 8; y++)
+        for (uint8_t x = 0; x < 16; x++) {
+          const uint16_t s = sand[y][x];
+          sand[y][x] = sand[15 - y][x];
+          sand[15 - y][x] = s;
+        }
+      memset(moved, 0, sizeof(moved));
       flipped = !flipped;
     }
 
-    float gravity = 8.0f;
-
-    // Update sand physics
-    for (int i = 0; i < numGrains; i++) {
-      if (grains[i].y > 0) {
-        // Check if near the center neck - start falling
-        float r = sqrtf(grains[i].x * grains[i].x + grains[i].z * grains[i].z);
-        float maxR = hourglassRadius(grains[i].y);
-
-        if (grains[i].y < 1.5f && r < 1.0f) {
-          grains[i].falling = true;
-        }
-
-        if (grains[i].falling) {
-          // Fall through center and into bottom
-          grains[i].y -= gravity * dt;
-
-          // Constrain to hourglass shape
-          float curMaxR = hourglassRadius(grains[i].y);
-          if (r > curMaxR) {
-            float scale = curMaxR / r;
-            grains[i].x *= scale;
-            grains[i].z *= scale;
-          }
-        } else {
-          // Slide toward center
-          if (grains[i].y > 0.5f) {
-            float slideSpeed = 1.0f;
-            grains[i].y -= slideSpeed * dt * 0.5f;
-
-            // Slight inward drift
-            if (r > 0.1f) {
-              float drift = slideSpeed * dt * 0.3f;
-              grains[i].x -= grains[i].x / r * drift;
-              grains[i].z -= grains[i].z / r * drift;
-            }
-          }
-        }
-      } else {
-        // In bottom half, settle
-        if (grains[i].falling) {
-          grains[i].y -= gravity * dt * 0.3f;
-          float floorY = -6.5f;
-          // Pile up: floor rises as grains accumulate
-          if (grains[i].y < floorY) {
-            grains[i].y = floorY;
-            grains[i].falling = false;
-            // Spread out slightly
-            grains[i].x += noise.nextRandom(-0.5f, 0.5f);
-            grains[i].z += noise.nextRandom(-0.5f, 0.5f);
-          }
-          // Constrain to hourglass shape
-          float r2 = sqrtf(grains[i].x * grains[i].x + grains[i].z * grains[i].z);
-          float curMaxR = hourglassRadius(grains[i].y);
-          if (r2 > curMaxR) {
-            float scale = curMaxR / r2;
-            grains[i].x *= scale;
-            grains[i].z *= scale;
-          }
-        }
-      }
+    // Update sand physics at a fixed rate
+    stepTimer += dt;
+    const float interval = 1.0f / settings.steps;
+    for (uint8_t n = 0; stepTimer >= interval && n < 4; n++) {
+      stepTimer -= interval;
+      step();
     }
+    if (stepTimer >= interval) stepTimer = 0;
 
     // Draw hourglass wireframe
     Color frameColor = Color(100, 120, 160).scaled(brightness);
@@ -174,18 +162,18 @@ class Hourglass : public Animation {
     }
 
     // Draw sand grains
-    for (int i = 0; i < numGrains; i++) {
-      // Sandy color with slight variation
-      uint8_t sandR = 220 + (uint8_t)(noise.nextRandom(-20, 20));
-      uint8_t sandG = 180 + (uint8_t)(noise.nextRandom(-15, 15));
-      uint8_t sandB = 80;
-      Color sandColor(sandR, sandG, sandB);
-      if (grains[i].falling) {
-        sandColor = Color(255, 200, 100);  // Brighter when falling
-      }
-      sandColor.scale(brightness);
-      voxel(Vector3(grains[i].x, grains[i].y, grains[i].z), sandColor);
-    }
+    for (uint8_t y = 0; y < 16; y++)
+      for (uint8_t x = 0; x < 16; x++)
+        for (uint16_t bits = sand[y][x]; bits; bits &= bits - 1) {
+          const uint8_t z = __builtin_ctz(bits);
+          // Sandy color with slight variation
+          Color sandColor = Color(200 + (noise.nextRandom16(0, 40)),
+                                  165 + (noise.nextRandom16(0, 30)), 80);
+          if (moved[y][x] & (1 << z)) {
+            sandColor = Color(255, 200, 100);  // Brighter when falling
+          }
+          voxel(x, y, z, sandColor.scale(brightness));
+        }
   }
 };
 #endif
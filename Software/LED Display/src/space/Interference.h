@@ -2,11 +2,16 @@
 #define INTERFERENCE_H
 
 #include "Animation.h"
+#include "power/Field.h"
 
 class Interference : public Animation {
  private:
   float phase = 0;
   uint16_t hue16 = 0;
+  // The wave tables of the sources, in the arena
+  struct State {
+    RadialWave waves[4];
+  };
 
   static constexpr auto &settings = config.animation.interference;
 
@@ -18,22 +23,14 @@ class Interference : public Animation {
     timer_ending = settings.endtime;
     phase = 0;
     hue16 = 0;
+    memory<State>();
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     phase += dt;
     hue16 += (uint16_t)(dt * 512);
@@ -44,36 +41,47 @@ class Interference : public Animation {
     float sz[4] = {-7.0f, 7.0f, 7.0f, -7.0f};
     float freq[4] = {3.0f, 3.5f, 4.0f, 2.5f};
 
-    for (int x = 0; x < 16; x++) {
-      for (int y = 0; y < 16; y++) {
-        for (int z = 0; z < 16; z++) {
-          float px = (float)x - 7.5f;
-          float py = (float)y - 7.5f;
-          float pz = (float)z - 7.5f;
+    // The waves of the sources only depend on the distance, one table each
+    RadialWave *waves = memory<State>()->waves;
+    for (int s = 0; s < 4; s++) {
+      const float f = freq[s] * 0.5f;
+      const float p = phase * 4.0f;
+      waves[s].center(Vector3(sx[s], sy[s], sz[s]));
+      waves[s].fill([f, p](float dist) { return sinf(dist * f - p); });
+    }
+
+    Shader shader(waves, hue16 >> 8, brightness);
+    shade(shader);
+  }
 
-          float val = 0;
-          for (int s = 0; s < 4; s++) {
-            float dx = px - sx[s];
-            float dy = py - sy[s];
-            float dz = pz - sz[s];
-            float dist = sqrtf(dx * dx + dy * dy + dz * dz);
-            val += sinf(dist * freq[s] * 0.5f - phase * 4.0f);
-          }
-          val /= 4.0f;
+ private:
+  // The sum of the waves from the row terms of the sources
+  struct Shader : shader_t {
+    const RadialWave *waves;
+    uint8_t hue;
+    uint8_t brightness;
+    uint16_t row[4];
 
-          // Draw if absolute value exceeds threshold
-          if (fabsf(val) > 0.3f) {
-            float intensity = (fabsf(val) - 0.3f) / 0.7f;
-            if (intensity > 1.0f) intensity = 1.0f;
-            // Rainbow palette coloring
-            uint8_t hue = (uint8_t)(hue16 >> 8) + (uint8_t)((val + 1.0f) * 64.0f);
-            Color c = Color(hue, RainbowGradientPalette);
-            c.scale((uint8_t)(intensity * brightness));
-            voxel(x, y, z, c);
-          }
-        }
-      }
+    Shader(const RadialWave *waves, uint8_t hue, uint8_t brightness)
+        : waves(waves), hue(hue), brightness(brightness) {}
+    void begin_row(const uint8_t x, const uint8_t y) {
+      for (int s = 0; s < 4; s++) row[s] = waves[s].row(x, y);
     }
-  }
+    bool operator()(const uint8_t z, Color &c) {
+      float val = 0;
+      for (int s = 0; s < 4; s++) val += waves[s].at(row[s], z);
+      val /= 4.0f;
+
+      // Draw if absolute value exceeds threshold
+      if (fabsf(val) <= 0.3f) return false;
+      float intensity = (fabsf(val) - 0.3f) / 0.7f;
+      if (intensity > 1.0f) intensity = 1.0f;
+      // Rainbow palette coloring
+      uint8_t h = hue + (uint8_t)((val + 1.0f) * 64.0f);
+      c = Color(h, RainbowGradientPalette);
+      c.scale((uint8_t)(intensity * brightness));
+      return true;
+    }
+  };
 };
 #endif
@@ -2,6 +2,7 @@
 #define LAVALAMP_H
 
 #include "Animation.h"
+#include "power/Metaballs.h"
 
 class LavaLamp : public Animation {
  private:
@@ -28,71 +29,56 @@ class LavaLamp : public Animation {
       blobs[i].speedZ = noise.nextRandom(0.08f, 0.2f);
       blobs[i].size = noise.nextRandom(2.2f, 3.2f);
     }
+    memory<Metaballs>();
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     phase += dt;
 
-    // Blob centers - drift through full cube space
-    float bx[NUM_BLOBS], by[NUM_BLOBS], bz[NUM_BLOBS];
+    // Blob centers - drift through full cube space, they merge when close,
+    // summed in a field in the arena
+    Metaballs &field = *memory<Metaballs>();
+    field.clear();
     for (int i = 0; i < NUM_BLOBS; i++) {
-      by[i] = sinf(phase * blobs[i].speedY + blobs[i].phaseY) * 6.5f;
-      bx[i] = sinf(phase * blobs[i].speedX + blobs[i].phaseX) * 4.0f;
-      bz[i] = sinf(phase * blobs[i].speedZ + blobs[i].phaseZ) * 4.0f;
+      float by = sinf(phase * blobs[i].speedY + blobs[i].phaseY) * 6.5f;
+      float bx = sinf(phase * blobs[i].speedX + blobs[i].phaseX) * 4.0f;
+      float bz = sinf(phase * blobs[i].speedZ + blobs[i].phaseZ) * 4.0f;
+      field.add(Vector3(bx, by, bz), blobs[i].size);
     }
 
-    float threshold = 1.0f;
+    // Thin wax pool settled at the bottom (1-2 voxels thick)
+    for (int vy = 0; vy < 2; vy++)
+      field.add_layer(vy, Metaballs::ONE * 1.5f / (vy * vy + 0.5f));
+
+    // Dim liquid fill across entire cube
+    float glow[16];
+    for (int vy = 0; vy < 16; vy++)
+      glow[vy] = 0.04f + 0.02f * sinf((vy - 7.5f) * 0.3f + phase * 0.1f);
+
+    const float threshold = 1.0f;
     for (int vx = 0; vx < 16; vx++) {
       for (int vy = 0; vy < 16; vy++) {
         for (int vz = 0; vz < 16; vz++) {
-          float fx = vx - 7.5f, fy = vy - 7.5f, fz = vz - 7.5f;
-
-          // Metaball field from blobs - they merge when close
-          float field = 0;
-          for (int i = 0; i < NUM_BLOBS; i++) {
-            float dx = fx - bx[i], dy = fy - by[i], dz = fz - bz[i];
-            float r2 = blobs[i].size * blobs[i].size;
-            field += r2 / (dx*dx + dy*dy + dz*dz + 0.5f);
-          }
-
-          // Thin wax pool settled at the bottom (1-2 voxels thick)
-          if (fy < -5.5f) {
-            float poolDy = fy + 7.5f; // distance from very bottom
-            float poolField = 1.5f / (poolDy * poolDy + 0.5f);
-            field += poolField;
-          }
-
-          if (field > threshold) {
+          float f = field.at(vx, vy, vz) * (1.0f / Metaballs::ONE);
+          if (f > threshold) {
             // Depth into blob: 0 at surface, slow ramp to 1 deep inside
-            float depth = fminf((field - threshold) * 0.6f, 1.0f);
+            float depth = fminf((f - threshold) * 0.6f, 1.0f);
             // Surface = deep red, core = bright yellow-white
             uint8_t r = (uint8_t)(100 + 155 * depth);
             uint8_t g = (uint8_t)(20 + 180 * depth * depth);
             uint8_t b = (uint8_t)(5 + 60 * depth * depth * depth);
             voxel((uint8_t)vx, (uint8_t)vy, (uint8_t)vz, Color(r, g, b));
           } else {
-            // Dim liquid fill across entire cube
-            float glow = 0.04f + 0.02f * sinf(fy * 0.3f + phase * 0.1f);
-            glow += field * 0.04f;
-            uint8_t r = (uint8_t)(100 * glow);
-            uint8_t g = (uint8_t)(25 * glow);
-            uint8_t b = (uint8_t)(8 * glow);
+            float g = glow[vy] + f * 0.04f;
+            uint8_t r = (uint8_t)(100 * g);
             if (r > 2)
-              voxel((uint8_t)vx, (uint8_t)vy, (uint8_t)vz, Color(r, g, b));
+              voxel((uint8_t)vx, (uint8_t)vy, (uint8_t)vz,
+                    Color(r, (uint8_t)(25 * g), (uint8_t)(8 * g)));
           }
         }
       }
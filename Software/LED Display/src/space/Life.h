@@ -14,10 +14,21 @@ class Life : public Animation {
   enum class rule_t : uint8_t { DIE = 0, LIVE = 1, BIRTH = 2 };
   rule_t rules[27];
 
-  // Hash list containing the hashes of past generations
-  uint32_t hash_list[256];
-  // Amount of hashes available and position to store new  hash in
-  uint32_t hash_nr;
+  // Zobrist hash of the new generation, the xor of the keys of living cells
+  uint64_t hash = 0;
+  // Open addressing set with the generation at which a hash was seen
+  static const uint16_t SEEN = 256;
+  struct seen_t {
+    uint64_t hash;
+    uint16_t generation;
+  };
+  seen_t seen[SEEN];
+  uint16_t seen_count = 0;
+  // Generations since the start of the game
+  uint16_t generation = 0;
+  // Period of the oscillator and the generation it was detected, 0 if none
+  uint16_t period = 0;
+  uint16_t detected = 0;
   // The amount of living cells in the new generation
   uint16_t living = 0;
   // Sequence for generate different rules and start conditions
@@ -83,9 +94,37 @@ class Life : public Animation {
     // Overestimate of amount because of duplicates
     living = amount;
   }
+  // Zobrist key of a cell, a 64 bit mix of its index
+  static inline uint64_t zobrist(const uint8_t x, const uint8_t y,
+                                 const uint8_t z) {
+    uint64_t k = ((x << 8 | y << 4 | z) + 1) * 0x9E3779B97F4A7C15ull;
+    k = (k ^ (k >> 31)) * 0xBF58476D1CE4E5B9ull;
+    return k ^ (k >> 29);
+  }
+  // Toggle the keys of the changed cells of column (x, y) in the hash
+  void game_hash(const uint8_t x, const uint8_t y, uint16_t changed) {
+    for (; changed; changed &= changed - 1)
+      hash ^= zobrist(x, y, __builtin_ctz(changed));
+  }
+  // Generation at which the hash of the new generation was seen before, or
+  // -1 after adding it to the set
+  int32_t game_seen() {
+    if (seen_count >= SEEN * 3 / 4) {
+      memset(seen, 0, sizeof(seen));
+      seen_count = 0;
+    }
+    uint16_t i = hash & (SEEN - 1);
+    for (; seen[i].hash; i = (i + 1) & (SEEN - 1))
+      if (seen[i].hash == hash) return seen[i].generation;
+    seen[i] = {hash, generation};
+    seen_count++;
+    return -1;
+  }
   // Clear all generations and reset the game rules
   void game_reset() {
-    living = hash_nr = 0;
+    living = generation = period = seen_count = 0;
+    hash = 0;
+    memset(seen, 0, sizeof(seen));
     for (uint8_t x = 0; x < 16; x++)
       for (uint8_t y = 0; y < 16; y++) {
         cells_g1[x][y] = 0;
@@ -99,102 +138,148 @@ class Life : public Animation {
       rules[i] = rule_t::DIE;
     }
   }
-  // Count the neighbours of a given cell
-  uint16_t count_neighbours(int16_t x_, int16_t y_, int16_t z_) {
-    uint16_t neighbours = 0;
-    for (int16_t x = x_ - 1; x <= x_ + 1; x++)
-      for (int16_t y = y_ - 1; y <= y_ + 1; y++) {
-        uint16_t cells = cells_g1[x & 0xF][y & 0xF];
-        for (int16_t z = z_ - 1; z <= z_ + 1; z++) {
-          uint16_t cell = cells & (1 << (z & 0xF));
-          if (!(x == x_ && y == y_ && z == z_) && cell) {
-            neighbours++;
-          }
-        }
-      }
-    return neighbours;
+  // Add the bit sliced numbers a (na bits) and b (nb bits) into sum, which
+  // gets max(na, nb) + 1 bits. Every bit of a word is a separate number.
+  static inline void add_sliced(const uint16_t *a, const uint8_t na,
+                                const uint16_t *b, const uint8_t nb,
+                                uint16_t *sum) {
+    uint16_t carry = 0;
+    const uint8_t n = na > nb ? na : nb;
+    for (uint8_t i = 0; i < n; i++) {
+      const uint16_t p = i < na ? a[i] : 0;
+      const uint16_t q = i < nb ? b[i] : 0;
+      sum[i] = p ^ q ^ carry;
+      carry = (p & q) | (carry & (p ^ q));
+    }
+    sum[n] = carry;
   }
-  // Create a new generation using the game rules, calculates
+  // Create a new generation using the game rules, updates the
   // hash value to detect cycles and amount of living cells.
   // These conditions can be used to start a new game if it's
   // spinning out of control, is in a cycle or all is extinct
-  uint32_t game_next_generation() {
+  //
+  // All 16 cells of a z column are counted at once. Every bit of a word is
+  // one cell, a count is stored bit sliced over several words. The column
+  // is summed with its z neighbours (rotated words), then with its y and x
+  // neighbour columns. The total includes the cell itself and is compared
+  // with the totals that give birth or let a living cell survive.
+  void game_next_generation() {
     uint16_t living = 0;
-    uint32_t hash = 0;
     memcpy(cells_g1, cells_g2, sizeof(cells_g1));
-    for (int16_t x = 0; x < 16; x++) {
-      for (int16_t y = 0; y < 16; y++) {
-        uint16_t cells = cells_g1[x][y];
-        for (int16_t z = 0; z < 16; z++) {
-          uint16_t count = count_neighbours(x, y, z);
-          hash += count * (x * 3 + y * 5 + z * 7);
-          if (rules[count] == rule_t::DIE)
-            cells &= ~(1 << z);
-          else if (rules[count] == rule_t::BIRTH)
-            cells |= (1 << z);
-          if (cells & (1 << z)) living++;
+    // Totals of 27 cells that make a dead cell or a living cell alive
+    uint32_t birth = 0, survive = 0;
+    for (uint8_t i = 0; i < 27; i++) {
+      if (rules[i] == rule_t::BIRTH) birth |= 1 << i;
+      if (rules[i] != rule_t::DIE) survive |= 1 << (i + 1);
+    }
+    // Sum of every cell with its z neighbours (0..3)
+    uint16_t zsum[16][16][2];
+    for (uint8_t x = 0; x < 16; x++)
+      for (uint8_t y = 0; y < 16; y++) {
+        const uint16_t c = cells_g1[x][y];
+        const uint16_t l = c << 1 | c >> 15;
+        const uint16_t r = c >> 1 | c << 15;
+        zsum[x][y][0] = l ^ c ^ r;
+        zsum[x][y][1] = (l & c) | (r & (l ^ c));
+      }
+    // Sum of 3 z sums along y (0..9)
+    uint16_t ysum[16][16][4];
+    for (uint8_t x = 0; x < 16; x++)
+      for (uint8_t y = 0; y < 16; y++) {
+        uint16_t s[3];
+        add_sliced(zsum[x][(y - 1) & 0xF], 2, zsum[x][y], 2, s);
+        add_sliced(s, 3, zsum[x][(y + 1) & 0xF], 2, ysum[x][y]);
+      }
+    for (uint8_t x = 0; x < 16; x++)
+      for (uint8_t y = 0; y < 16; y++) {
+        // Sum of 3 y sums along x (0..27)
+        uint16_t s[5], total[6];
+        add_sliced(ysum[(x - 1) & 0xF][y], 4, ysum[x][y], 4, s);
+        add_sliced(s, 5, ysum[(x + 1) & 0xF][y], 4, total);
+        const uint16_t self = cells_g1[x][y];
+        uint16_t cells = 0;
+        for (uint8_t k = 0; k < 28; k++) {
+          const uint16_t alive = (birth >> k & 1 ? ~self : 0) |
+                                 (survive >> k & 1 ? self : 0);
+          if (!alive) continue;
+          uint16_t equal = alive;
+          for (uint8_t i = 0; i < 5; i++)
+            equal &= k >> i & 1 ? total[i] : ~total[i];
+          cells |= equal;
         }
         cells_g2[x][y] = cells;
+        living += __builtin_popcount(cells);
+        game_hash(x, y, cells ^ self);
       }
-    }
     this->living = living;
-    return hash;
+  }
+  // Start the next game from the sequence with new rules and cells
+  void game_start() {
+    game_reset();
+    switch (sequence++) {
+      case 0:  // Life 4444 gliders
+        rules[4] = rule_t::BIRTH;
+        game_gliders();
+        break;
+      case 1:  // Life 4555
+        rules[4] = rule_t::LIVE;
+        rules[5] = rule_t::BIRTH;
+        game_randomize(random(200, 400), noise.nextRandom(5.0f, 7.0f));
+        break;
+      case 2:  // Life 5766
+        rules[5] = rule_t::LIVE;
+        rules[7] = rule_t::LIVE;
+        rules[6] = rule_t::BIRTH;
+        game_randomize(random(200, 400), noise.nextRandom(5.0f, 7.0f));
+        break;
+      case 3:  // Life 5655
+        rules[5] = rule_t::BIRTH;
+        rules[6] = rule_t::LIVE;
+        game_randomize(random(200, 400), noise.nextRandom(5.0f, 7.0f));
+        break;
+      case 4:  // Life 5855
+        sequence = 0;
+        rules[5] = rule_t::BIRTH;
+        rules[6] = rule_t::LIVE;
+        rules[7] = rule_t::LIVE;
+        rules[8] = rule_t::LIVE;
+        game_randomize(25, 3.0f);
+        break;
+    }
+    for (uint8_t x = 0; x < 16; x++)
+      for (uint8_t y = 0; y < 16; y++) game_hash(x, y, cells_g2[x][y]);
   }
   // Main game progress loop, selects rules and start conditions.
   // Creates a new generation is all cells are dead. Also checks
   // for other ending conditions and if those are met all will die.
   void game_progress() {
-    uint32_t hash = game_next_generation();
+    game_next_generation();
+    generation++;
     if (living == 0) {
-      game_reset();
-      switch (sequence++) {
-        case 0:  // Life 4444 gliders
-          rules[4] = rule_t::BIRTH;
-          game_gliders();
-          break;
-        case 1:  // Life 4555
-          rules[4] = rule_t::LIVE;
-          rules[5] = rule_t::BIRTH;
-          game_randomize(random(200, 400), noise.nextRandom(5.0f, 7.0f));
-          break;
-        case 2:  // Life 5766
-          rules[5] = rule_t::LIVE;
-          rules[7] = rule_t::LIVE;
-          rules[6] = rule_t::BIRTH;
-          game_randomize(random(200, 400), noise.nextRandom(5.0f, 7.0f));
-          break;
-        case 3:  // Life 5655
-          rules[5] = rule_t::BIRTH;
-          rules[6] = rule_t::LIVE;
-          game_randomize(random(200, 400), noise.nextRandom(5.0f, 7.0f));
-          break;
-        case 4:  // Life 5855
-          sequence = 0;
-          rules[5] = rule_t::BIRTH;
-          rules[6] = rule_t::LIVE;
-          rules[7] = rule_t::LIVE;
-          rules[8] = rule_t::LIVE;
-          game_randomize(25, 3.0f);
-          break;
-      }
-    } else {
-      // Dectect how many of current generation existed before. The hash
-      // isn't deterministic, but there is only a tiny chance of the same
-      // hash with different generations.
-      uint8_t matches = 0;
-      for (uint8_t i = 0; i < hash_nr && i <= 255; i++)
-        if (hash_list[i] == hash) matches++;
-      // Show only 1 cycles of custom gliders in life 4444
-      if (sequence - 1 == 0 && matches >= 1) {
-        game_rule_reset();
-        game_next_generation();
+      game_start();
+      return;
+    }
+    // The first repeated hash gives the period of the oscillator. The hash
+    // isn't unique, but there is only a tiny chance of the same hash with
+    // different generations.
+    if (!period) {
+      const int32_t before = game_seen();
+      if (before >= 0) {
+        period = generation - before;
+        detected = generation;
       }
-      // Allow maximum 6 duplicate hashes and no more than 500 living cells
-      else if (matches >= 6 || living >= 500) {
+    }
+    // Show only 1 cycle of custom gliders in life 4444
+    const uint8_t cycles = sequence - 1 == 0 ? 1 : settings.cycles;
+    const bool cycled =
+        period && generation - detected >= period * (cycles ? cycles - 1 : 0);
+    // No more than 500 living cells
+    if (cycled || living >= 500) {
+      if (period && cycles == 0) {
+        game_start();
+      } else {
         game_rule_reset();
         game_next_generation();
-      } else {
-        hash_list[hash_nr++ & 0xFF] = hash;
       }
     }
   }
@@ -208,7 +293,7 @@ class Life : public Animation {
  void draw(float dt) {
     time_interval = settings.interval;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
 
     if (timer_running.update()) {
       state = state_t::ENDING;
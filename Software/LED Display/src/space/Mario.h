@@ -36,34 +36,13 @@ class Mario : public Animation {
     radius_max = settings.radius;
     radius_start = settings.radius_start;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
 
     float radius = radius_max;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      } else {
-        brightness *= timer_starting.ratio();
-        radius *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      } else {
-        brightness *= (1 - timer_ending.ratio());
-        radius *= (1 - timer_ending.ratio());
-      }
-    }
+    const float envelope = update_lifecycle();
+    brightness *= envelope;
+    radius *= envelope;
     if (radius < radius_start) {
       radius = radius_start;
     }
@@ -75,25 +54,16 @@ class Mario : public Animation {
     angle += dt * angle_speed;
     arc = 2 * (180 / M_PI) * asinf(0.5f / radius);
 
-    for (uint8_t y = 0; y < FRAME_HEIGHT; y++) {
-      for (uint8_t x = 0; x < FRAME_WIDTH; x++) {
-        uint32_t data = mario_data[frame_display[frame]][y * 16 + x];
-        Color c = Color(0, 0, 0);
-        if (data >> 24 & 0xff) {
-          c = Color(data & 0xff, data >> 8 & 0xff, data >> 16 & 0xff);
-          if (c.isBlack())
-            c = Color(0, 0, 0);
-          else {
-            c.gamma().scale(brightness);
-          }
-        }
-        // Map to coordinates with center (0,0,0) scaled by radius
-        // Project on a line at the left of the coordinate system
-        Vector3 point = Vector3(-radius, (CY - y) / CY * radius, 0);
-        Quaternion q = Quaternion(angle - (arc * x), Vector3::Y);
-        radiate(q.rotate(point), c, 1.0f);
-      }
-    }
+    // Transparent and black pixels would only maximize with black
+    Sprite::frame(mario_sprite, frame_display[frame],
+                  [&](uint8_t x, uint8_t y, Color c) {
+                    if (c.isBlack()) return;
+                    // Map to coordinates with center (0,0,0) scaled by radius
+                    // Project on a line at the left of the coordinate system
+                    Vector3 point = Vector3(-radius, (CY - y) / CY * radius, 0);
+                    Quaternion q = Quaternion(angle - (arc * x), Vector3::Y);
+                    radiate(q.rotate(point), c.scale(brightness), 1.0f);
+                  });
   }
 };
 #endif
\ No newline at end of file
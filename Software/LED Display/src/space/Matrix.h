@@ -3,68 +3,57 @@
 
 #include "Animation.h"
 
+/*------------------------------------------------------------------------------
+ * MATRIX
+ *------------------------------------------------------------------------------
+ * Green trails falling down the 256 columns. Nothing is stored per column: a
+ * column falls at a speed and from a start hashed from its index, and every
+ * drop covers SPAN voxels, so the drop a column is in is its distance over
+ * SPAN. The length of the drop and the delay before its head enters the cube
+ * are hashed from the column and the drop.
+ *----------------------------------------------------------------------------*/
 class Matrix : public Animation {
  private:
-  struct Column {
-    float y;
-    float speed;
-    uint8_t length;
-  };
-
-  Column cols[16][16];
+  // Voxels a column falls per drop, the head enters 0 to 16 above the cube
+  // and its trail has left at the bottom
+  static constexpr float SPAN = 48.0f;
+  float time;
+  uint32_t seed;
 
   static constexpr auto &settings = config.animation.matrix;
 
-  void resetColumn(int x, int z) {
-    cols[x][z].y = noise.nextRandom(16.0f, 32.0f);
-    cols[x][z].speed = noise.nextRandom(4.0f, 12.0f);
-    cols[x][z].length = 4 + (int)noise.nextRandom(0, 8);
-  }
-
  public:
   void init() {
     state = state_t::STARTING;
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
-
-    for (int x = 0; x < 16; x++) {
-      for (int z = 0; z < 16; z++) {
-        cols[x][z].y = noise.nextRandom(0.0f, 32.0f);
-        cols[x][z].speed = noise.nextRandom(4.0f, 12.0f);
-        cols[x][z].length = 4 + (int)noise.nextRandom(0, 8);
-      }
-    }
+    time = 0;
+    seed = Noise::next32();
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
+    time += dt;
     for (int x = 0; x < 16; x++) {
       for (int z = 0; z < 16; z++) {
-        // Move column downward
-        cols[x][z].y -= cols[x][z].speed * dt;
-
-        float headY = cols[x][z].y;
-        uint8_t length = cols[x][z].length;
+        const uint32_t column = x << 4 | z;
+        const uint32_t h = Noise::hash(column, seed);
+        const float speed = Noise::hashRandom(h, 4.0f, 12.0f);
+        const float fallen =
+            time * speed + Noise::hashRandom(Noise::hash(h), 0, SPAN);
+        const uint32_t drop = fallen / SPAN;
+        const uint32_t r = Noise::hash(column, seed, drop);
+        const uint8_t length = 4 + (r & 7);
+        const float headY =
+            16 + Noise::hashRandom(r, 0, 16) - (fallen - drop * SPAN);
 
-        // Reset column when it has fully passed below the cube
-        if (headY < -(float)length) {
-          resetColumn(x, z);
-          continue;
-        }
+        // Between drops, the trail has passed below the cube
+        if (headY < -(float)length) continue;
 
         // Draw the column trail
         for (int t = 0; t < length; t++) {
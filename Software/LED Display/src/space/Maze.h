@@ -7,21 +7,30 @@
 class Maze : public Animation {
  private:
   static const int SZ = 8;
-  // 6 directions: +x, -x, +y, -y, +z, -z
-  bool walls[SZ][SZ][SZ][6];
-  bool visited[SZ][SZ][SZ];
+  static const int CELLS = SZ * SZ * SZ;
 
   struct Pos { int8_t x, y, z; };
 
-  Pos path[512];
+  // Generate, solve and trace the path a few steps every frame, then walk it
+  enum class phase_t : uint8_t { GENERATE, SOLVE, TRACE, WALK };
+  phase_t phase;
+  // Open passages towards +x, +y and +z, bit z of a row is cell (x, y, z).
+  // The passage towards -x of a cell is the +x passage of its neighbour.
+  uint16_t passage[3][SZ][SZ];
+  uint16_t visited[SZ][SZ];
+  // Direction towards the end of every cell reached by the solver
+  uint8_t toward[SZ][SZ][SZ];
+
+  Pos path[CELLS];
   int pathLen;
   float pathProgress;
   float timer;
   float doneTimer;
 
-  // DFS stack for generation
-  Pos stack[512];
+  // DFS stack for generation, reused as BFS queue by the solver
+  Pos stack[CELLS];
   int stackTop;
+  int queueHead;
 
   static constexpr auto &settings = config.animation.maze;
 
@@ -34,159 +43,143 @@ class Maze : public Animation {
   bool inBounds(int x, int y, int z) {
     return x >= 0 && x < SZ && y >= 0 && y < SZ && z >= 0 && z < SZ;
   }
+  Pos neighbour(const Pos &p, int d) {
+    return {(int8_t)(p.x + dx(d)), (int8_t)(p.y + dy(d)),
+            (int8_t)(p.z + dz(d))};
+  }
+  bool isVisited(const Pos &p) { return visited[p.x][p.y] >> p.z & 1; }
+  void visit(const Pos &p) { visited[p.x][p.y] |= 1 << p.z; }
+  // Passage bit of direction d, stored at the cell on the negative side
+  uint16_t &passageRow(const Pos &p, int d) {
+    const Pos q = d & 1 ? neighbour(p, d) : p;
+    return passage[d >> 1][q.x][q.y];
+  }
+  int passageBit(const Pos &p, int d) { return d & 1 ? p.z + dz(d) : p.z; }
+  bool isOpen(const Pos &p, int d) {
+    const Pos q = neighbour(p, d);
+    if (!inBounds(q.x, q.y, q.z)) return false;
+    return passageRow(p, d) >> passageBit(p, d) & 1;
+  }
 
-  void generate() {
-    // Initialize all walls to true
-    memset(walls, 1, sizeof(walls));
+  // Start a new maze, it is built over the next frames
+  void restart() {
+    memset(passage, 0, sizeof(passage));
     memset(visited, 0, sizeof(visited));
-
-    // DFS maze generation starting from (0,0,0)
     stackTop = 0;
     stack[stackTop++] = {0, 0, 0};
-    visited[0][0][0] = true;
-
-    while (stackTop > 0) {
-      Pos cur = stack[stackTop - 1];
-
-      // Find unvisited neighbors
-      int neighbors[6];
-      int nv = 0;
-      for (int d = 0; d < 6; d++) {
-        int nx = cur.x + dx(d);
-        int ny = cur.y + dy(d);
-        int nz = cur.z + dz(d);
-        if (inBounds(nx, ny, nz) && !visited[nx][ny][nz]) {
-          neighbors[nv++] = d;
-        }
-      }
-
-      if (nv > 0) {
-        // Pick random neighbor
-        int pick = (int)noise.nextRandom(0, nv);
-        if (pick >= nv) pick = nv - 1;
-        int d = neighbors[pick];
-        int nx = cur.x + dx(d);
-        int ny = cur.y + dy(d);
-        int nz = cur.z + dz(d);
-
-        // Remove walls between cur and neighbor
-        walls[cur.x][cur.y][cur.z][d] = false;
-        walls[nx][ny][nz][opposite(d)] = false;
-
-        visited[nx][ny][nz] = true;
-        stack[stackTop++] = {(int8_t)nx, (int8_t)ny, (int8_t)nz};
-      } else {
-        stackTop--;
-      }
-    }
+    visit(stack[0]);
+    pathLen = 0;
+    pathProgress = 0;
+    doneTimer = 0;
+    phase = phase_t::GENERATE;
   }
 
-  void solve() {
-    // BFS from (0,0,0) to (SZ-1, SZ-1, SZ-1)
-    memset(visited, 0, sizeof(visited));
+  // One step of the DFS backtracker, carves a passage or backtracks
+  void generateStep() {
+    Pos cur = stack[stackTop - 1];
 
-    // BFS queue and parent tracking
-    Pos queue[512];
-    int parent[SZ][SZ][SZ];
-    int parentDir[SZ][SZ][SZ];
-    memset(parent, -1, sizeof(parent));
-
-    int qHead = 0, qTail = 0;
-    queue[qTail++] = {0, 0, 0};
-    visited[0][0][0] = true;
-
-    bool found = false;
-    while (qHead < qTail && !found) {
-      Pos cur = queue[qHead++];
-      if (cur.x == SZ - 1 && cur.y == SZ - 1 && cur.z == SZ - 1) {
-        found = true;
-        break;
-      }
-      for (int d = 0; d < 6; d++) {
-        if (walls[cur.x][cur.y][cur.z][d]) continue;
-        int nx = cur.x + dx(d);
-        int ny = cur.y + dy(d);
-        int nz = cur.z + dz(d);
-        if (!inBounds(nx, ny, nz)) continue;
-        if (visited[nx][ny][nz]) continue;
-        visited[nx][ny][nz] = true;
-        parent[nx][ny][nz] = cur.x * SZ * SZ + cur.y * SZ + cur.z;
-        parentDir[nx][ny][nz] = d;
-        queue[qTail++] = {(int8_t)nx, (int8_t)ny, (int8_t)nz};
-      }
+    // Find unvisited neighbors
+    int neighbors[6];
+    int nv = 0;
+    for (int d = 0; d < 6; d++) {
+      Pos n = neighbour(cur, d);
+      if (inBounds(n.x, n.y, n.z) && !isVisited(n)) neighbors[nv++] = d;
     }
 
-    // Reconstruct path
-    pathLen = 0;
-    if (found) {
-      Pos cur = {(int8_t)(SZ - 1), (int8_t)(SZ - 1), (int8_t)(SZ - 1)};
-      while (!(cur.x == 0 && cur.y == 0 && cur.z == 0)) {
-        path[pathLen++] = cur;
-        int p = parent[cur.x][cur.y][cur.z];
-        cur.x = p / (SZ * SZ);
-        cur.y = (p / SZ) % SZ;
-        cur.z = p % SZ;
-      }
+    if (nv > 0) {
+      // Pick random neighbor and remove the wall between them
+      int d = neighbors[noise.nextRandom16(0, nv - 1)];
+      passageRow(cur, d) |= 1 << passageBit(cur, d);
+      Pos n = neighbour(cur, d);
+      visit(n);
+      stack[stackTop++] = n;
+    } else if (--stackTop == 0) {
+      // BFS from the end, so following toward from the start is the path
+      memset(visited, 0, sizeof(visited));
+      stack[0] = {(int8_t)(SZ - 1), (int8_t)(SZ - 1), (int8_t)(SZ - 1)};
+      visit(stack[0]);
+      queueHead = 0;
+      stackTop = 1;
+      phase = phase_t::SOLVE;
+    }
+  }
+
+  // One step of the BFS solver, expands one cell of the queue
+  void solveStep() {
+    Pos cur = stack[queueHead++];
+    for (int d = 0; d < 6; d++) {
+      if (!isOpen(cur, d)) continue;
+      Pos n = neighbour(cur, d);
+      if (isVisited(n)) continue;
+      visit(n);
+      toward[n.x][n.y][n.z] = opposite(d);
+      stack[stackTop++] = n;
+    }
+    if (isVisited({0, 0, 0}) || queueHead == stackTop) {
       path[pathLen++] = {0, 0, 0};
-      // Reverse path
-      for (int i = 0; i < pathLen / 2; i++) {
-        Pos tmp = path[i];
-        path[i] = path[pathLen - 1 - i];
-        path[pathLen - 1 - i] = tmp;
-      }
+      phase = phase_t::TRACE;
     }
   }
 
+  // One step of tracing the path from the start towards the end
+  void traceStep() {
+    Pos cur = path[pathLen - 1];
+    if (cur.x == SZ - 1 && cur.y == SZ - 1 && cur.z == SZ - 1) {
+      phase = phase_t::WALK;
+      return;
+    }
+    path[pathLen++] = neighbour(cur, toward[cur.x][cur.y][cur.z]);
+  }
+
  public:
   void init() {
     state = state_t::STARTING;
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
-    generate();
-    solve();
-    pathProgress = 0;
+    restart();
     timer = 0;
-    doneTimer = 0;
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     timer += dt;
 
-    // Advance solve progress
+    // Build the maze within a fixed amount of steps per frame
+    for (uint16_t budget = settings.budget; budget && phase != phase_t::WALK;
+         budget--) {
+      if (phase == phase_t::GENERATE)
+        generateStep();
+      else if (phase == phase_t::SOLVE)
+        solveStep();
+      else
+        traceStep();
+    }
+
+    // Advance solve progress once the path is known
     float solveSpeed = 4.0f;  // cells per second
-    if (pathProgress < pathLen) {
-      pathProgress += solveSpeed * dt;
-      doneTimer = 0;
-    } else {
-      doneTimer += dt;
-      if (doneTimer > 3.0f) {
-        // Generate new maze
-        generate();
-        solve();
-        pathProgress = 0;
+    if (phase == phase_t::WALK) {
+      if (pathProgress < pathLen) {
+        pathProgress += solveSpeed * dt;
         doneTimer = 0;
+      } else {
+        doneTimer += dt;
+        // Generate new maze
+        if (doneTimer > 3.0f) restart();
       }
     }
 
-    // Draw maze walls as dim voxels (2x2x2 blocks per cell)
+    // Draw maze cells as dim voxels (2x2x2 blocks per cell), while
+    // generating only the cells carved so far
     for (int cx = 0; cx < SZ; cx++)
       for (int cy = 0; cy < SZ; cy++)
         for (int cz = 0; cz < SZ; cz++) {
+          const Pos c = {(int8_t)cx, (int8_t)cy, (int8_t)cz};
+          if (phase == phase_t::GENERATE && !isVisited(c)) continue;
           // Draw cell center as dim block
           float bx = cx * 2.0f - 7.0f;
           float by = cy * 2.0f - 7.0f;
@@ -8,6 +8,11 @@ class Moebius : public Animation {
   float angle = 0;
   uint16_t hue16 = 0;
 
+  // Strip of T segments along the loop and S vertices across its width
+  static const uint16_t T = 30;
+  static const uint16_t S = 3;
+  Mesh<T * S, T * (S - 1) * 2> strip;
+
   static constexpr auto &settings = config.animation.moebius;
 
  public:
@@ -18,40 +23,54 @@ class Moebius : public Animation {
     timer_ending = settings.endtime;
     angle = 0;
     hue16 = 0;
+    build();
   }
 
-  void draw(float dt) {
-    setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
+  void build() {
+    float R = 5.0f, width = 2.5f;
+    for (uint16_t i = 0; i < T; i++) {
+      float t = (float)i / T * (2.0f * PI);
+      for (uint16_t j = 0; j < S; j++) {
+        float s = ((float)j / (S - 1) - 0.5f) * width;
+        strip.vertex[i * S + j] =
+            Vector3((R + s * cosf(t / 2)) * cosf(t), s * sinf(t / 2),
+                    (R + s * cosf(t / 2)) * sinf(t));
+      }
     }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
+    // The last segment joins the first one upside down
+    uint16_t f = 0;
+    for (uint16_t i = 0; i < T; i++) {
+      for (uint16_t j = 0; j < S - 1; j++) {
+        uint16_t a = i * S + j, b = a + 1;
+        uint16_t c = i < T - 1 ? a + S : S - 1 - j;
+        uint16_t d = i < T - 1 ? b + S : S - 2 - j;
+        strip.face[f][0] = a;
+        strip.face[f][1] = b;
+        strip.face[f++][2] = d;
+        strip.face[f][0] = a;
+        strip.face[f][1] = d;
+        strip.face[f++][2] = c;
+      }
     }
+  }
+
+  void draw(float dt) {
+    setMotionBlur(settings.motionBlur);
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     angle += dt;
     hue16 += (uint16_t)(dt * 40 * 255);
     Quaternion q = Quaternion(angle * 25, Vector3(0, 1, 0));
-    float R = 5.0f, width = 2.5f;
-    int resT = 60, resS = 8;
-
-    for (int i = 0; i < resT; i++) {
-      float t = (float)i / resT * (2.0f * PI);
-      for (int j = 0; j < resS; j++) {
-        float s = ((float)j / (resS - 1) - 0.5f) * width;
-        float x = (R + s * cosf(t / 2)) * cosf(t);
-        float y = s * sinf(t / 2);
-        float z = (R + s * cosf(t / 2)) * sinf(t);
-        Color c = Color((uint8_t)((hue16 >> 8) + i * 3), RainbowGradientPalette);
-        radiate(q.rotate(Vector3(x, y, z)), c, 1.0f);
-      }
-    }
+    strip.transform(q);
+    strip.draw(
+        [&](uint16_t f) {
+          uint8_t i = f / ((S - 1) * 2);
+          return Color((uint8_t)((hue16 >> 8) + i * 6), RainbowGradientPalette)
+              .scale(brightness);
+        },
+        true);
   }
 };
 #endif
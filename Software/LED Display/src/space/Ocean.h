@@ -2,9 +2,22 @@
 #define OCEAN_H
 
 #include "Animation.h"
+#include "power/Field.h"
+#include "power/WaveField.h"
 
+/*------------------------------------------------------------------------------
+ * OCEAN CLASS
+ *------------------------------------------------------------------------------
+ * A wave maker moves the water along the x = 0 wall, slightly out of phase
+ * over z. The waves run through the wave field, reflect from the far wall
+ * and interfere with the waves coming in. Every column is filled up to the
+ * height of the water.
+ *----------------------------------------------------------------------------*/
 class Ocean : public Animation {
  private:
+  WaveField water;
+  PlaneWave crest;
+  float elapsed = 0;
   float phase = 0;
 
   static constexpr auto &settings = config.animation.ocean;
@@ -15,33 +28,35 @@ class Ocean : public Animation {
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
+    elapsed = 0;
     phase = 0;
+    water.clear();
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     phase += dt;
+    // Step the water at a fixed rate, independent of the frame rate
+    elapsed += dt;
+    for (uint8_t i = 0; elapsed >= settings.interval && i < 4; i++) {
+      elapsed -= settings.interval;
+      for (uint8_t z = 0; z < 16; z++)
+        water.set(0, z,
+                  (int16_t)(settings.amplitude * WaveField::ONE *
+                            sinf(phase * 2 + z * 0.2f)));
+      water.step(settings.damping);
+    }
+    if (elapsed >= settings.interval) elapsed = 0;
+    crest.set(Vector3(5 / 7.5f, 0, 3 / 7.5f), phase * 3);
     for (int x = 0; x < 16; x++) {
       for (int z = 0; z < 16; z++) {
-        float fx = (x - 7.5f) / 7.5f;
-        float fz = (z - 7.5f) / 7.5f;
-        float h = sinf(fx * 3 + phase * 2) * 0.3f
-                + sinf(fz * 4 + phase * 1.5f) * 0.25f
-                + sinf((fx + fz) * 2.5f + phase * 1.8f) * 0.2f;
-        int surfaceY = (int)(7.5f + h * 5);
+        int surfaceY =
+            (int)(7.5f + water.height(x, z) * (1.0f / WaveField::ONE));
+        if (surfaceY < 0) surfaceY = 0;
         if (surfaceY > 15) surfaceY = 15;
 
         for (int y = 0; y <= surfaceY && y < 16; y++) {
@@ -50,7 +65,7 @@ class Ocean : public Animation {
 
           if (y >= surfaceY - 1) {
             // Foam/crest - bright white-blue
-            float foam = 0.7f + 0.3f * sinf(fx * 5 + fz * 3 + phase * 3);
+            float foam = 0.7f + 0.3f * crest.at(x, 0, z);
             voxel((uint8_t)x, (uint8_t)y, (uint8_t)z,
                   Color((uint8_t)(180*foam), (uint8_t)(220*foam), 255));
           } else if (depthRatio < 0.3f) {
@@ -4,6 +4,8 @@
 #include "Animation.h"
 #include "power/Math8.h"
 #include "power/Noise.h"
+#include "power/NoiseLoop.h"
+#include "power/NoiseVolume.h"
 /*---------------------------------------------------------------------------------------
  * Noise
  *-------------------------------------------------------------------------------------*/
@@ -25,8 +27,14 @@ private:
   float noise_y = noise.nextRandom(0, 255);
   float noise_z = noise.nextRandom(0, 255);
   float noise_w = noise.nextRandom(0, 255);
-  // Allocate noise memory
-  uint8_t noise_map[Display::width][Display::height][Display::depth];
+  // Working memory in the arena
+  struct State {
+    // Noise memory, a keyframe is sampled at half resolution over 4 frames
+    NoiseVolume noise_map = NoiseVolume(4, true);
+    // Baked noise that loops, instead of sampling noise every frame
+    NoiseLoop noise_loop;
+  };
+  float loop_phase;
 
   static constexpr auto &settings = config.animation.plasma;
 
@@ -37,6 +45,16 @@ public:
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
     speed_offset = 0;
+    loop_phase = 0;
+    set_quality(quality);
+    memory<State>()->noise_map.reset(noise, noise_x, noise_y, noise_z, noise_w,
+                                    settings.scale_p, settings.basis);
+  }
+
+  // Lower quality samples a keyframe over twice as many frames
+  void set_quality(uint8_t level) {
+    quality = level;
+    memory<State>()->noise_map.setSlices(level > 1 ? 4 : 8);
   }
 
   void draw(float dt) {
@@ -47,67 +65,60 @@ public:
     speed_w = settings.speed_w;
     speed_offset_speed = settings.speed_offset_speed;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      } else {
-        brightness *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      } else {
-        brightness *= (1 - timer_ending.ratio());
-      }
+    brightness *= update_lifecycle();
+    State &s = *memory<State>();
+    if (settings.baked) {
+      // A loop every 30 seconds, baked the first time
+      NoiseLoop::bake(noise);
+      loop_phase += dt / 30;
+      s.noise_loop.update(loop_phase);
+      drawNoise(s.noise_loop, brightness);
+      return;
     }
     updateNoise(dt);
     makeNoise();
-    drawNoise(brightness);
+    drawNoise(s.noise_map, brightness);
   }
 
   // Create the 3D noise data matrix[][][]
   void makeNoise() {
-    for (int x = 0; x < Display::width; x++) {
-      float xoffset = noise_x + scale_p * x;
-      for (int y = 0; y < Display::height; y++) {
-        float yoffset = noise_y + scale_p * y;
-        for (int z = 0; z < Display::depth; z++) {
-          float zoffset = noise_z + scale_p * z;
-          noise_map[x][y][z] =
-            noise.noise4(xoffset, yoffset, zoffset, noise_w) * 255;
-        }
-      }
-    }
+    memory<State>()->noise_map.update(noise, noise_x, noise_y, noise_z, noise_w,
+                                     scale_p, settings.basis);
   }
 
   // Draw the 3D noise data matrix[][][]
-  void drawNoise(uint8_t brightness) {
-    for (int x = 0; x < Display::width; x++) {
-      for (int y = 0; y < Display::height; y++) {
-        for (int z = 0; z < Display::depth; z++) {
-          // The index at (x,y,z) is the index in the color palette
-          uint8_t index = noise_map[x][y][z];
-          // The value at (y,x,z) is the overlay for the brightness
-          voxel(x, y, z,
-            Color((hue16 >> 8) + index, LavaPalette)
-            .scale(noise_map[y][x][z])
-            .scale(brightness));
-        }
-      }
-    }
+  template <typename V>
+  void drawNoise(const V &volume, uint8_t brightness) {
+    Shader<V> shader(volume, hue16 >> 8, brightness);
+    shade(shader);
   }
 
+  template <typename V>
+  struct Shader : shader_t {
+    const V &volume;
+    uint8_t hue;
+    uint8_t brightness;
+    uint8_t x, y;
+
+    Shader(const V &volume, uint8_t hue, uint8_t brightness)
+        : volume(volume), hue(hue), brightness(brightness) {}
+    void begin_row(const uint8_t x, const uint8_t y) {
+      this->x = x;
+      this->y = y;
+    }
+    bool operator()(const uint8_t z, Color &c) {
+      // The index at (x,y,z) is the index in the color palette
+      uint8_t index = volume.at(x, y, z);
+      // The value at (y,x,z) is the overlay for the brightness
+      c = Color::fromLUT(hue + index, LavaLUT)
+              .scale(volume.at(y, x, z))
+              .scale(brightness);
+      return true;
+    }
+  };
+
   void updateNoise(float dt) {
     speed_offset += dt * speed_offset_speed;
     // use same speed offset, but offset each in the noise map
@@ -0,0 +1,69 @@
+#ifndef PLAYBACK_H
+#define PLAYBACK_H
+
+#include <algorithm>
+
+#include "Animation.h"
+#include "core/Replay.h"
+#include "core/Voxels.h"
+
+/*------------------------------------------------------------------------------
+ * PLAYBACK CLASS
+ *------------------------------------------------------------------------------
+ * Plays a voxel file recorded by core/Recorder.h from the SD card. Every
+ * frame stays on display for the time it was recorded with, with its motion
+ * blur. Frames come from the read ahead of core/Replay.h, when the card falls
+ * behind the last frame stays on display. At the end of the file it starts
+ * again from the start frame, without card or file the animation ends.
+ *----------------------------------------------------------------------------*/
+class Playback : public Animation {
+ private:
+  float wait = 0;
+  uint8_t blur = 0;
+
+  // Frame being decoded into, the previous one for deltas (12 KB in RAM2)
+  static Color frame[VOXELS_COUNT];
+
+  static constexpr auto &settings = config.animation.playback;
+
+ public:
+  void init() {
+    state = state_t::STARTING;
+    timer_starting = settings.starttime;
+    timer_running = settings.runtime;
+    timer_ending = settings.endtime;
+    wait = 0;
+    blur = 0;
+    std::fill(frame, frame + VOXELS_COUNT, Color::BLACK);
+    if (Replay::open(settings.file)) Replay::seek(settings.start);
+  }
+
+  void draw(float dt) {
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) {
+      Replay::close();
+      return;
+    }
+    if (!Replay::is_open() && state != state_t::ENDING) end();
+
+    // Catch up a few frames when the recording ran faster than the display
+    wait -= dt * 1000;
+    for (uint8_t i = 0; i < 4 && wait <= 0; i++) {
+      voxel_frame_t f;
+      if (Replay::ended()) Replay::seek(settings.start);
+      if (!Replay::next(frame, f)) break;
+      wait += f.duration;
+      blur = f.motion_blur;
+    }
+    if (wait < 0) wait = 0;
+    setMotionBlur(blur);
+
+    const Color *v = frame;
+    for (uint8_t x = 0; x < Display::width; x++)
+      for (uint8_t y = 0; y < Display::height; y++)
+        for (uint8_t z = 0; z < Display::depth; z++)
+          cell(x, y, z) = v++->scaled(brightness);
+  }
+};
+#endif
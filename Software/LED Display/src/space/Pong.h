@@ -1,6 +1,7 @@
 #ifndef PONG_H
 #define PONG_H
 #include "Animation.h"
+#include "power/Predictor.h"
 class Pad {
  private:
   Vector3 position;
@@ -9,6 +10,9 @@ class Pad {
   Vector3 velocity;
   Particle debris[100];
   bool exploded;
+  // Gravity smoothed and extrapolated to the frame on the leds
+  Predictor gravity;
+  uint32_t samples = 0;
 
  public:
   Pad(Vector3 p = Vector3(0, 0, 0), Vector3 s = Vector3(0, 0, 0),
@@ -17,8 +21,13 @@ class Pad {
 
   bool move(const float dt, uint8_t scale) {
     if (!exploded) {  // Exploded pads don't move
-      auto& hid = config.devices.accelerometer;
-      Vector3 v = Vector3(hid.x, hid.z, hid.y);
+      accelerometer_t hid = {};
+      const uint32_t sequence = config.devices.read(hid);
+      if (sequence != samples) {
+        samples = sequence;
+        gravity.update(Vector3(hid.x, hid.z, hid.y), hid.time);
+      }
+      Vector3 v = gravity.at(Scheduler::shown());
       if (v.magnitude() > 0)
         v.normalize();
       else {
@@ -164,28 +173,7 @@ class Pong : public Animation {
     uint8_t brightness = settings.brightness;
     hue16 += dt * hue16_speed;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      } else {
-        brightness *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      } else {
-        brightness *= (1 - timer_ending.ratio());
-      }
-    }
+    brightness *= update_lifecycle();
 
     if (pad.move(dt, brightness)) {
       pad.init();
@@ -30,6 +30,26 @@ class Pong3D : public Animation {
     }
   }
 
+  // Fold a coordinate into the walls at -7 and 7 as if it bounced off them
+  static float fold(float v) {
+    float p = fmodf(v + 7.0f, 28.0f);
+    if (p < 0) p += 28.0f;
+    return p < 14.0f ? p - 7.0f : 21.0f - p;
+  }
+
+  // Where a paddle at y should be: the point where the ball will cross its
+  // plane when it comes towards it, the center otherwise
+  void intercept(float padY, float &x, float &z) {
+    float t = (padY - ballY) / ballVY;
+    if (t < 0) {
+      x = 0;
+      z = 0;
+      return;
+    }
+    x = fold(ballX + ballVX * t);
+    z = fold(ballZ + ballVZ * t);
+  }
+
  public:
   void init() {
     state = state_t::STARTING;
@@ -43,34 +63,24 @@ class Pong3D : public Animation {
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
-    // AI paddle tracking with noise wobble
+    // AI paddles move to the predicted intercept with noise wobble
     float trackSpeed = 8.0f;
-    float wobble1X = noise.nextRandom(-0.5f, 0.5f);
-    float wobble1Z = noise.nextRandom(-0.5f, 0.5f);
-    float targetP1X = ballX + wobble1X;
-    float targetP1Z = ballZ + wobble1Z;
+    float targetP1X, targetP1Z, targetP2X, targetP2Z;
+    intercept(-7.0f, targetP1X, targetP1Z);
+    intercept(7.0f, targetP2X, targetP2Z);
+    targetP1X += noise.nextRandom(-0.5f, 0.5f);
+    targetP1Z += noise.nextRandom(-0.5f, 0.5f);
     if (p1X < targetP1X) p1X += trackSpeed * dt;
     if (p1X > targetP1X) p1X -= trackSpeed * dt;
     if (p1Z < targetP1Z) p1Z += trackSpeed * dt;
     if (p1Z > targetP1Z) p1Z -= trackSpeed * dt;
 
-    float wobble2X = noise.nextRandom(-0.5f, 0.5f);
-    float wobble2Z = noise.nextRandom(-0.5f, 0.5f);
-    float targetP2X = ballX + wobble2X;
-    float targetP2Z = ballZ + wobble2Z;
+    targetP2X += noise.nextRandom(-0.5f, 0.5f);
+    targetP2Z += noise.nextRandom(-0.5f, 0.5f);
     if (p2X < targetP2X) p2X += trackSpeed * dt;
     if (p2X > targetP2X) p2X -= trackSpeed * dt;
     if (p2Z < targetP2Z) p2Z += trackSpeed * dt;
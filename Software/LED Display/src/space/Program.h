@@ -0,0 +1,113 @@
+#ifndef PROGRAM_H
+#define PROGRAM_H
+
+#include "Animation.h"
+#include "core/Programs.h"
+#include "power/Bytecode.h"
+/*------------------------------------------------------------------------------
+ * PROGRAM
+ *------------------------------------------------------------------------------
+ * Draws an uploaded bytecode program (see core/Programs.h), the built in
+ * rings below without one. A program uploaded while it runs takes over from
+ * the next frame.
+ *----------------------------------------------------------------------------*/
+// Rings moving out from the center, colored by noise drifting along z
+static const uint8_t ProgramRings[] = {
+    'M', 'V', 'M', '1', 0, 7, 27, 0,
+    0xcd, 0xcc, 0x4c, 0x3e,  // 0: 0.2
+    0x9a, 0x99, 0x99, 0x3e,  // 1: 0.3
+    0xcd, 0xcc, 0x4c, 0x3f,  // 2: 0.8
+    0x00, 0x00, 0x40, 0x40,  // 3: 3.0
+    0x00, 0x00, 0x00, 0x3f,  // 4: 0.5
+    0xcd, 0xcc, 0x4c, 0x3d,  // 5: 0.05
+    0xcd, 0xcc, 0xcc, 0x3d,  // 6: 0.1
+    // r4 = distance to the center
+    Bytecode::MUL, 4, Bytecode::X, Bytecode::X,
+    Bytecode::MAD, 4, Bytecode::Y, Bytecode::Y,
+    Bytecode::MAD, 4, Bytecode::Z, Bytecode::Z,
+    Bytecode::SQRT, 4, 4, 0,
+    // r7 = (0.5 + 0.5 * sin(0.8 * d - 3 * t))^2
+    Bytecode::CONST, 5, 2, 0,
+    Bytecode::CONST, 6, 3, 0,
+    Bytecode::MUL, 7, 4, 5,
+    Bytecode::MUL, 8, Bytecode::T, 6,
+    Bytecode::SUB, 7, 7, 8,
+    Bytecode::SIN, 7, 7, 0,
+    Bytecode::CONST, 9, 4, 0,
+    Bytecode::MUL, 7, 7, 9,
+    Bytecode::ADD, 7, 7, 9,
+    Bytecode::MUL, 7, 7, 7,
+    // r15 = noise(0.2 * x, 0.2 * y, 0.2 * z + 0.3 * t) + 0.05 * t
+    Bytecode::CONST, 10, 0, 0,
+    Bytecode::MUL, 11, Bytecode::X, 10,
+    Bytecode::MUL, 12, Bytecode::Y, 10,
+    Bytecode::MUL, 13, Bytecode::Z, 10,
+    Bytecode::CONST, 14, 1, 0,
+    Bytecode::MAD, 13, Bytecode::T, 14,
+    Bytecode::NOISE, 15, 11, 0,
+    Bytecode::CONST, 10, 5, 0,
+    Bytecode::MUL, 14, Bytecode::T, 10,
+    Bytecode::ADD, 15, 15, 14,
+    // Palette by r15, the troughs below 0.1 stay dark
+    Bytecode::CONST, 10, 6, 0,
+    Bytecode::SUB, 7, 7, 10,
+    Bytecode::OUT, 0, 15, 7};
+
+class Program : public Animation {
+ private:
+  Bytecode vm;
+  float time;
+  uint32_t revision;
+  char name[sizeof(config.animation.program.name)];
+
+  static constexpr auto &settings = config.animation.program;
+
+  // A row of the program at a time
+  struct Shader : shader_t {
+    Bytecode &vm;
+    float time;
+    uint8_t brightness;
+    Color row[Bytecode::LANES];
+    uint16_t lit;
+
+    Shader(Bytecode &vm, float time, uint8_t brightness)
+        : vm(vm), time(time), brightness(brightness) {}
+    void begin_row(const uint8_t x, const uint8_t y) {
+      lit = vm.run(x, y, time, brightness, row);
+    }
+    bool operator()(const uint8_t z, Color &c) {
+      if (!(lit & 1 << z)) return false;
+      c = row[z];
+      return true;
+    }
+  };
+
+  void reload() {
+    revision = Programs::revision;
+    strcpy(name, settings.name);
+    if (!Programs::load(name, vm)) vm.load(ProgramRings, sizeof(ProgramRings));
+  }
+
+ public:
+  void init() {
+    state = state_t::STARTING;
+    timer_starting = settings.starttime;
+    timer_running = settings.runtime;
+    timer_ending = settings.endtime;
+    time = 0;
+    reload();
+  }
+
+  void draw(float dt) {
+    setMotionBlur(settings.motionBlur);
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
+
+    if (revision != Programs::revision || strcmp(name, settings.name)) reload();
+    time += dt;
+    Shader shader(vm, time, brightness);
+    shade(shader);
+  }
+};
+#endif
@@ -3,16 +3,24 @@
 
 #include "Animation.h"
 
+/*------------------------------------------------------------------------------
+ * RAIN
+ *------------------------------------------------------------------------------
+ * Drops falling from the top and splashing on the floor. The drops are not
+ * stored: drop k falls from time k * INTERVAL, at a speed and from a column
+ * hashed from k, so a frame draws the drops that can still be in the air and
+ * splashes the ones that reached the floor since the frame before. Only the
+ * splashes are particles.
+ *----------------------------------------------------------------------------*/
 class Rain : public Animation {
  private:
-  struct Drop { float x, y, z, speed; bool active; };
-  struct Splash { float x, y, z, vx, vy, vz, life; };
-  static const int MAX_DROPS = 80;
+  static constexpr float INTERVAL = 0.02f;
+  static constexpr float MIN_SPEED = 15.0f;
+  static constexpr float MAX_SPEED = 25.0f;
   static const int MAX_SPLASHES = 150;
-  Drop drops[MAX_DROPS];
-  Splash splashes[MAX_SPLASHES];
-  int numSplashes = 0;
-  float spawnTimer = 0;
+  ParticlePool splashes;
+  float time;
+  uint32_t seed;
 
   static constexpr auto &settings = config.animation.rain;
 
@@ -22,75 +30,54 @@ class Rain : public Animation {
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
-    for (int i = 0; i < MAX_DROPS; i++) drops[i].active = false;
-    numSplashes = 0;
-    spawnTimer = 0;
+    splashes.acquire(MAX_SPLASHES);
+    time = 0;
+    seed = Noise::next32();
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) {
+      splashes.release();
+      return;
     }
 
-    // spawn drops
-    spawnTimer += dt;
-    if (spawnTimer > 0.02f) {
-      spawnTimer = 0;
-      for (int i = 0; i < MAX_DROPS; i++) {
-        if (!drops[i].active) {
-          drops[i].x = noise.nextRandom(-7.5f, 7.5f);
-          drops[i].z = noise.nextRandom(-7.5f, 7.5f);
-          drops[i].y = 7.5f;
-          drops[i].speed = noise.nextRandom(15, 25);
-          drops[i].active = true;
-          break;
-        }
+    // The drops in the air, from the slowest one that could have landed
+    // since the frame before on
+    const float before = time;
+    time += dt;
+    const float fall = 15.0f / MIN_SPEED + dt;
+    const uint32_t last = time / INTERVAL;
+    const uint32_t first = time > fall ? (time - fall) / INTERVAL : 0;
+    for (uint32_t k = first; k <= last; k++) {
+      const uint32_t h = Noise::hash(k, seed);
+      const float speed = Noise::hashRandom(h, MIN_SPEED, MAX_SPEED);
+      const float x = Noise::hashRandom(Noise::hash(h), -7.5f, 7.5f);
+      const float z = Noise::hashRandom(Noise::hash(h, 1), -7.5f, 7.5f);
+      const float y = 7.5f - speed * (time - k * INTERVAL);
+      if (y > -7.5f) {
+        voxel(Vector3(x, y, z), Color(80, 130, 255));
+        continue;
       }
-    }
-
-    // move drops
-    for (int i = 0; i < MAX_DROPS; i++) {
-      if (!drops[i].active) continue;
-      drops[i].y -= drops[i].speed * dt;
-      if (drops[i].y <= -7.5f) {
-        for (int j = 0; j < 4 && numSplashes < MAX_SPLASHES; j++) {
-          Splash& s = splashes[numSplashes++];
-          s.x = drops[i].x; s.y = -7.5f; s.z = drops[i].z;
-          s.vx = noise.nextRandom(-3, 3);
-          s.vy = noise.nextRandom(3, 8);
-          s.vz = noise.nextRandom(-3, 3);
-          s.life = 1.0f;
-        }
-        drops[i].active = false;
-      } else {
-        voxel(Vector3(drops[i].x, drops[i].y, drops[i].z), Color(80, 130, 255));
+      // Landed since the frame before
+      if (7.5f - speed * (before - k * INTERVAL) <= -7.5f) continue;
+      for (int j = 0; j < 4; j++) {
+        Vector3 v = Vector3(noise.nextRandom(-3, 3), noise.nextRandom(3, 8),
+                            noise.nextRandom(-3, 3));
+        splashes.add(Vector3(x, -7.5f, z), v, 0, 1.0f, 2.5f);
       }
     }
 
     // splashes
-    for (int i = 0; i < numSplashes; ) {
-      Splash& s = splashes[i];
-      s.x += s.vx * dt; s.y += s.vy * dt; s.z += s.vz * dt;
-      s.vy -= 20.0f * dt;
-      s.life -= dt * 2.5f;
-      if (s.life <= 0 || s.y < -7.5f) {
-        splashes[i] = splashes[--numSplashes];
-      } else {
-        Color c(150, 200, 255);
-        c.scale((uint8_t)(s.life * 255));
-        voxel(Vector3(s.x, s.y, s.z), c);
-        i++;
-      }
+    splashes.integrate(dt, Vector3(0, -20.0f, 0));
+    splashes.age(dt);
+    splashes.compact(-7.5f);
+    for (uint16_t i = 0; i < splashes.count(); i++) {
+      Color c(150, 200, 255);
+      c.scale((uint8_t)(splashes.life[i] * 255));
+      voxel(Vector3(splashes.x[i], splashes.y[i], splashes.z[i]), c);
     }
   }
 };
@@ -2,19 +2,20 @@
 #define RIPPLE_H
 
 #include "Animation.h"
-
+#include "power/WaveField.h"
+
+/*------------------------------------------------------------------------------
+ * RIPPLE CLASS
+ *------------------------------------------------------------------------------
+ * Drops fall on a water surface halfway up the cube. Every drop is a single
+ * impulse in the wave field, the ripples spread, interfere and reflect from
+ * the walls. A column is filled from the rest level up or down to its height.
+ *----------------------------------------------------------------------------*/
 class Ripple : public Animation {
  private:
-  static const int MAX_SRC = 5;
-
-  struct Source {
-    float x, y, z;
-    float time;
-  };
-
-  Source sources[MAX_SRC];
+  WaveField water;
+  float elapsed = 0;
   float timer = 0;
-  int nextSrc = 0;
   uint16_t hue16 = 0;
 
   static constexpr auto &settings = config.animation.ripple;
@@ -25,84 +26,52 @@ class Ripple : public Animation {
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
+    elapsed = 0;
     timer = 0;
-    nextSrc = 0;
     hue16 = 0;
-
-    for (int i = 0; i < MAX_SRC; i++) {
-      sources[i].time = -100.0f;  // inactive
-    }
+    water.clear();
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     hue16 += (uint16_t)(dt * 1024);
 
-    // Update all source times
-    for (int i = 0; i < MAX_SRC; i++) {
-      sources[i].time += dt;
-    }
-
-    // Spawn a new source every 1.5 seconds
+    // Drop a new source every 1.5 seconds
     timer += dt;
     if (timer >= 1.5f) {
       timer -= 1.5f;
-      sources[nextSrc].x = noise.nextRandom(-5.0f, 5.0f);
-      sources[nextSrc].y = noise.nextRandom(-5.0f, 5.0f);
-      sources[nextSrc].z = noise.nextRandom(-5.0f, 5.0f);
-      sources[nextSrc].time = 0.0f;
-      nextSrc = (nextSrc + 1) % MAX_SRC;
+      water.drop(noise.nextRandom16(3, 12), noise.nextRandom16(3, 12),
+                 (int16_t)(-settings.drop * WaveField::ONE));
     }
 
-    // For each voxel, compute wave contribution from all sources
-    for (int x = 0; x < 16; x++) {
-      for (int y = 0; y < 16; y++) {
-        for (int z = 0; z < 16; z++) {
-          float px = (float)x - 7.5f;
-          float py = (float)y - 7.5f;
-          float pz = (float)z - 7.5f;
-
-          float val = 0;
-          for (int s = 0; s < MAX_SRC; s++) {
-            if (sources[s].time < 0 || sources[s].time > 6.0f) continue;
-
-            float dx = px - sources[s].x;
-            float dy = py - sources[s].y;
-            float dz = pz - sources[s].z;
-            float dist = sqrtf(dx * dx + dy * dy + dz * dz);
-
-            // Expanding spherical wave with sine
-            float wave = sinf(dist * 2.0f - sources[s].time * 6.0f);
-            // Fade over time
-            float fade = 1.0f - sources[s].time / 6.0f;
-            // Fade with distance
-            float distFade = 1.0f / (1.0f + dist * 0.15f);
-            val += wave * fade * distFade;
-          }
-
-          // Draw above threshold
-          if (fabsf(val) > 0.2f) {
-            float intensity = (fabsf(val) - 0.2f) / 0.8f;
-            if (intensity > 1.0f) intensity = 1.0f;
-            uint8_t hue = (uint8_t)(hue16 >> 8) + (uint8_t)(val * 40.0f);
-            Color c = Color(hue, RainbowGradientPalette);
-            c.scale((uint8_t)(intensity * brightness));
-            voxel(x, y, z, c);
-          }
-        }
+    // Step the water at a fixed rate, independent of the frame rate
+    elapsed += dt;
+    for (uint8_t i = 0; elapsed >= settings.interval && i < 4; i++) {
+      elapsed -= settings.interval;
+      water.step(settings.damping);
+    }
+    if (elapsed >= settings.interval) elapsed = 0;
+
+    for (uint8_t x = 0; x < 16; x++) {
+      for (uint8_t z = 0; z < 16; z++) {
+        const int16_t h = water.height(x, z);
+        // The surface of calm water is layer 8
+        int16_t top = (int16_t)((8 * WaveField::ONE + h) >> 8);
+        top = top < 0 ? 0 : top > 15 ? 15 : top;
+        const int16_t a = abs(h);
+        // Calm water is dim, crests and troughs are bright
+        const uint8_t intensity =
+            a >= WaveField::ONE ? 255 : 64 + (a * 191 >> 8);
+        const uint8_t hue = (uint8_t)(hue16 >> 8) + (h >> 3);
+        Color c = Color(hue, RainbowGradientPalette);
+        c.scale(map8(intensity, brightness));
+        const uint8_t from = top < 8 ? top : 8;
+        const uint8_t to = top < 8 ? 7 : top;
+        for (uint8_t y = from; y <= to; y++) voxel(x, y, z, c);
       }
     }
   }
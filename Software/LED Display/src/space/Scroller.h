@@ -5,12 +5,36 @@
 #include "gfx/Charset.h"
 #include "power/Math8.h"
 
+/*------------------------------------------------------------------------------
+ * SCROLLER CLASS
+ *------------------------------------------------------------------------------
+ * Wraps the text around a cylinder on the x axis. Rotating about x leaves the
+ * x of a pixel untouched, so every line of the text is one cube (y, z) and each
+ * pixel of a line one cube x. Both are looked up in tables that are only
+ * rebuilt when the radius changes. set_text() converts the text to glyph
+ * indices once (characters beyond 'Z' become '#'), the lit pixels of a glyph
+ * line are streamed from the run length encoded charset.
+ *----------------------------------------------------------------------------*/
+#define SCROLLER_MAX_TEXT 64
+#define SCROLLER_MAX_LINES 64
+
 class Scroller : public Animation {
  private:
   float radius;
   float text_rotation;
   float text_rotation_speed;
-  String text;
+
+  // Glyph index of every character of the text
+  uint8_t text[SCROLLER_MAX_TEXT];
+  uint8_t length = 0;
+
+  // Cube coordinates of the lines from 100 degrees down and of the columns
+  float table_radius = 0;
+  float line_angle_adj;
+  uint8_t line_count;
+  int16_t line_y[SCROLLER_MAX_LINES];
+  int16_t line_z[SCROLLER_MAX_LINES];
+  int16_t column_x[CHARSET_FRAME_WIDTH];
 
   static constexpr auto &settings = config.animation.arc_scroller;
 
@@ -22,88 +46,86 @@ class Scroller : public Animation {
     timer_ending = settings.endtime;
     text_rotation = -100.0f;
   }
-  void set_text(String s) { text = s; }
+  void set_text(const char *s) {
+    length = 0;
+    while (*s && length < SCROLLER_MAX_TEXT) text[length++] = match_char(*s++);
+  }
 
-void draw(float dt) {
+  void draw(float dt) {
     text_rotation_speed = settings.rotation_speed;
     radius = settings.radius;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      } else {
-        brightness *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      } else {
-        brightness *= (1 - timer_ending.ratio());
-      }
-    }
+    brightness *= update_lifecycle();
+    if (length == 0) return;
+    if (radius != table_radius) build_table();
 
     // Amount of degrees the text has been rotated
     text_rotation += text_rotation_speed * dt;
-    // Full circle resolution in amount of pixels
-    float circle_resolution = 2 * PI * radius;
-    // Angle adjustment in degrees for each line
-    float line_angle_adj = 360 / circle_resolution;
     // Amount of pixels the text has been rotated
     float pixel_start = text_rotation / line_angle_adj;
-    // Start of the line_angle at a bit over 90 degrees
-    float line_angle = 100.0f;
-    // Fine adjustment for angles between lines.
-    // Ignore because this will add a lot of jittering.
-    // line_angle += fmod(text_rotation, line_angle_adj);
 
     // Adjust for negative rotation (inserts blanks at begin text)
     int16_t pixel_line = pixel_start;
+    uint8_t first = 0;
     if (pixel_line < 0) {
-      line_angle += line_angle_adj * pixel_line;
+      first = pixel_line < -line_count ? line_count : -pixel_line;
       pixel_line = 0;
     }
     //  Insert an amount of blank_lines after every character
     const uint16_t blank_lines = 1;
+    const uint16_t char_lines = CHARSET_FRAME_HEIGHT + blank_lines;
+    const uint16_t text_lines = char_lines * length;
 
-    uint16_t text_lines = (CHARSET_FRAME_HEIGHT + blank_lines) * text.length();
-    while (line_angle > -line_angle_adj) {
-      uint16_t text_offset = pixel_line % text_lines;
-      uint16_t char_offset = text_offset / (CHARSET_FRAME_HEIGHT + blank_lines);
-      uint16_t t = match_char(text.charAt(char_offset));
-      uint16_t y = pixel_line++ % (CHARSET_FRAME_HEIGHT + blank_lines);
-      if (y < CHARSET_FRAME_HEIGHT) {
-        Quaternion q = Quaternion(line_angle, Vector3::X);
-        for (uint8_t x = 0; x < CHARSET_FRAME_WIDTH; x++) {
-          uint32_t data = charset_data[t][y * CHARSET_FRAME_WIDTH + x];
-          if (data & 0xff000000) {
-            Color c = Color(data & 0xff, data >> 8 & 0xff, data >> 16 & 0xff);
-            Vector3 pixel = q.rotate(
-                Vector3(x / (CHARSET_FRAME_WIDTH - 1.0f), 0, -1) * radius);
-            pixel += Vector3(-radius / 2, -radius / 2, radius / 2);
-            voxel(pixel, c.scale(brightness).gamma());
-          }
-        }
-      }
+    uint16_t text_offset = pixel_line % text_lines;
+    for (uint8_t i = first; i < line_count; i++) {
+      const uint8_t t = text[text_offset / char_lines];
+      const uint8_t y = text_offset % char_lines;
+      if (++text_offset == text_lines) text_offset = 0;
+      if (y >= CHARSET_FRAME_HEIGHT) continue;
+      const int16_t vy = line_y[i], vz = line_z[i];
+      if ((vy | vz) & 0xFFF0) continue;
+      Sprite::line(charset_sprite, t, y, [&](uint8_t x, Color c) {
+        const int16_t vx = column_x[x];
+        if ((vx & 0xFFF0) == 0) cell(vx, vy, vz) = c.scale(brightness);
+      });
+    }
+  }
+
+ private:
+  // Round a system coordinate to the cube like voxel() does
+  static int16_t to_cube(const float v, const float c) {
+    return (int16_t)(v + 32768.5f + c) - 32768;
+  }
+
+  void build_table() {
+    table_radius = radius;
+    // Full circle resolution in amount of pixels
+    float circle_resolution = 2 * PI * radius;
+    // Angle adjustment in degrees for each line
+    line_angle_adj = 360 / circle_resolution;
+    // Start of the line_angle at a bit over 90 degrees
+    float line_angle = 100.0f;
+    line_count = 0;
+    while (line_angle > -line_angle_adj && line_count < SCROLLER_MAX_LINES) {
+      Quaternion q = Quaternion(line_angle, Vector3::X);
+      Vector3 pixel = q.rotate(Vector3(0, 0, -radius));
+      line_y[line_count] = to_cube(pixel.y - radius / 2, CY);
+      line_z[line_count] = to_cube(pixel.z + radius / 2, CZ);
+      line_count++;
       line_angle -= line_angle_adj;
     }
+    for (uint8_t x = 0; x < CHARSET_FRAME_WIDTH; x++)
+      column_x[x] =
+          to_cube(x / (CHARSET_FRAME_WIDTH - 1.0f) * radius - radius / 2, CX);
   }
 
-  uint16_t match_char(uint16_t chr) {
-    if (chr >= ' ' && chr <= '~')
+  static uint8_t match_char(char chr) {
+    if (chr >= ' ' && chr - ' ' < CHARSET_FRAME_COUNT)
       return chr - ' ';
     else
       return '#' - ' ';
   }
 };
-#endif
\ No newline at end of file
+#endif
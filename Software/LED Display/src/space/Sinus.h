@@ -32,32 +32,11 @@ class Sinus : public Animation {
     radius = settings.radius;
     phase_speed = settings.phase_speed;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
     phase += dt * phase_speed;
     hue16 += dt * hue16_speed;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      } else {
-        brightness *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      } else {
-        brightness *= (1 - timer_ending.ratio());
-      }
-    }
+    brightness *= update_lifecycle();
 
     // Resize the function to be big enough to have the rotated version fit
     // sqrt(3) * 7.5 * 2 => 26 is big enough but more resolution is better
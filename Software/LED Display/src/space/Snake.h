@@ -3,6 +3,7 @@
 
 #include <string.h>
 #include "Animation.h"
+#include "power/Bitboard.h"
 
 class Snake : public Animation {
  private:
@@ -14,7 +15,7 @@ class Snake : public Animation {
   Pos food;
   float moveTimer;
   float moveInterval = 0.1f;
-  bool grid[16][16][16];
+  Bitboard grid;
 
   static constexpr auto &settings = config.animation.snake;
 
@@ -27,7 +28,7 @@ class Snake : public Animation {
       if (food.x > 15) food.x = 15;
       if (food.y > 15) food.y = 15;
       if (food.z > 15) food.z = 15;
-      if (!grid[food.x][food.y][food.z]) return;
+      if (!grid.get(food.x, food.y, food.z)) return;
     }
   }
 
@@ -36,14 +37,14 @@ class Snake : public Animation {
   }
 
   void resetGame() {
-    memset(grid, 0, sizeof(grid));
+    grid.clear();
     length = 3;
     headIdx = 2;
     for (int i = 0; i < length; i++) {
       body[i].x = 8;
       body[i].y = 8;
       body[i].z = 8 + i;
-      grid[body[i].x][body[i].y][body[i].z] = true;
+      grid.set(body[i].x, body[i].y, body[i].z);
     }
     placeFood();
     moveTimer = 0;
@@ -61,18 +62,9 @@ class Snake : public Animation {
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     moveTimer += dt;
     if (moveTimer >= moveInterval) {
@@ -81,40 +73,81 @@ class Snake : public Animation {
 
       Pos head = body[headIdx];
 
-      // AI: determine direction toward food
-      // Try the 6 possible directions, prefer the one closest to food
+      // AI: follow the shortest path to the food among the moves after which
+      // the head can still reach the tail, so the snake never traps itself.
+      // Without such a move take the one with the most room.
       int dx[6] = {1, -1, 0, 0, 0, 0};
       int dy[6] = {0, 0, 1, -1, 0, 0};
       int dz[6] = {0, 0, 0, 0, 1, -1};
+      int tailIdx = (headIdx - length + 1 + MAX_LEN) % MAX_LEN;
 
-      int bestDir = -1;
-      float bestDist = 1e9f;
-
+      Bitboard free, from;
+      grid.invert(free);
+      uint8_t distance[6];
+      int candidates = 0;
       for (int d = 0; d < 6; d++) {
         int nx = head.x + dx[d];
         int ny = head.y + dy[d];
         int nz = head.z + dz[d];
-        if (!isValid(nx, ny, nz)) continue;
-        if (grid[nx][ny][nz]) continue;
-        float dist = (float)((nx - food.x) * (nx - food.x) +
-                             (ny - food.y) * (ny - food.y) +
-                             (nz - food.z) * (nz - food.z));
-        if (dist < bestDist) {
-          bestDist = dist;
-          bestDir = d;
-        }
+        distance[d] = 255;
+        if (isValid(nx, ny, nz) && !grid.get(nx, ny, nz)) candidates++;
       }
-
-      // If no best direction toward food, pick any valid direction
-      if (bestDir < 0) {
+      // Distance of every move to the food, one search from the food
+      from.clear();
+      from.set(food.x, food.y, food.z);
+      from.flood(free, [&](const Bitboard &front, uint8_t steps) {
+        int found = 0;
         for (int d = 0; d < 6; d++) {
           int nx = head.x + dx[d];
           int ny = head.y + dy[d];
           int nz = head.z + dz[d];
-          if (isValid(nx, ny, nz) && !grid[nx][ny][nz]) {
-            bestDir = d;
-            break;
-          }
+          if (!isValid(nx, ny, nz) || grid.get(nx, ny, nz)) continue;
+          if (distance[d] == 255 && front.get(nx, ny, nz))
+            distance[d] = steps;
+          if (distance[d] != 255) found++;
+        }
+        return found == candidates;
+      });
+
+      // Try the moves nearest to the food first, the first safe one wins
+      int order[6] = {0, 1, 2, 3, 4, 5};
+      for (int i = 1; i < 6; i++)
+        for (int j = i; j > 0 && distance[order[j]] < distance[order[j - 1]];
+             j--) {
+          int t = order[j];
+          order[j] = order[j - 1];
+          order[j - 1] = t;
+        }
+      int bestDir = -1;
+      uint16_t bestRoom = 0;
+      for (int i = 0; i < 6; i++) {
+        int d = order[i];
+        int nx = head.x + dx[d];
+        int ny = head.y + dy[d];
+        int nz = head.z + dz[d];
+        if (!isValid(nx, ny, nz) || grid.get(nx, ny, nz)) continue;
+        // The tail after the move, freed as the snake moves on
+        bool eats = nx == food.x && ny == food.y && nz == food.z;
+        Pos tail = body[eats ? tailIdx : (tailIdx + 1) % MAX_LEN];
+        Bitboard room = free;
+        room.reset(nx, ny, nz);
+        room.set(tail.x, tail.y, tail.z);
+        if (!eats) room.set(body[tailIdx].x, body[tailIdx].y, body[tailIdx].z);
+        bool safe = false;
+        uint16_t reached = 0;
+        from.clear();
+        from.set(nx, ny, nz);
+        from.flood(room, [&](const Bitboard &front, uint8_t) {
+          reached += front.count();
+          return safe = front.get(tail.x, tail.y, tail.z);
+        });
+        if (safe) {
+          bestDir = d;
+          break;
+        }
+        if (bestDir < 0 || reached > bestRoom) {
+          bestDir = d;
+          bestRoom = reached;
         }
       }
 
@@ -131,8 +164,7 @@ class Snake : public Animation {
 
         if (!ate) {
           // Remove tail
-          int tailIdx = (headIdx - length + 1 + MAX_LEN) % MAX_LEN;
-          grid[body[tailIdx].x][body[tailIdx].y][body[tailIdx].z] = false;
+          grid.reset(body[tailIdx].x, body[tailIdx].y, body[tailIdx].z);
         } else {
           if (length < MAX_LEN) length++;
           placeFood();
@@ -140,7 +172,7 @@ class Snake : public Animation {
 
         headIdx = (headIdx + 1) % MAX_LEN;
         body[headIdx] = newHead;
-        grid[newHead.x][newHead.y][newHead.z] = true;
+        grid.set(newHead.x, newHead.y, newHead.z);
       }
     }
 
@@ -5,16 +5,18 @@
 
 class Spectrum : public Animation {
  private:
-  float amplitude[64] = {0};
   uint8_t rx, ry, rz;
   bool btn_A = false;
   bool btn_B = false;
   bool btn_C = false;
+  // Beats of the modulation bus already shown
+  uint32_t beats = 0;
 
   static constexpr auto &settings = config.animation.spectrum;
 
  public:
-  void rotate_voxel(Color c, uint8_t x, uint8_t y, uint8_t z) {
+  // Turn a voxel by the rotations selected with the buttons
+  void rotate(uint8_t &x, uint8_t &y, uint8_t &z) {
     uint8_t d = Display::width - 1;
     uint8_t t;
     for (uint8_t i = 0; i < rx; i++) {
@@ -32,7 +34,6 @@ class Spectrum : public Animation {
       y = x;
       x = t;
     }
-    voxel(x, y, z, c);
   }
 
   void init() {
@@ -42,76 +43,67 @@ class Spectrum : public Animation {
     timer_ending = settings.endtime;
     hue16_speed = settings.hue_speed * 255;
     setMotionBlur(settings.motionBlur);
+    beats = Modulation::beats;
+    // Button edges and windows that piled up while another animation ran
+    config.devices.drain();
   }
 
   void draw(float dt) {
     uint8_t brightness = settings.brightness;
     hue16 += dt * hue16_speed;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      } else {
-        brightness *= timer_starting.ratio();
+    brightness *= update_lifecycle();
+    // Every button edge in order, the fft bands come from the modulation
+    // bus in step with the audio
+    device_sample_t sample;
+    while (config.devices.next(sample)) {
+      if (sample.type != device_t::JOYSTICK) continue;
+      const uint8_t buttons = sample.joystick.buttons;
+      if (btn_A != (bool)(buttons & joystick_t::A)) {
+        btn_A = !btn_A;
+        if (btn_A) rx = (rx + 1) & 3;
       }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      } else {
-        brightness *= (1 - timer_ending.ratio());
+      if (btn_B != (bool)(buttons & joystick_t::B)) {
+        btn_B = !btn_B;
+        if (btn_B) ry = (ry + 1) & 3;
       }
-    }
-/*
-    auto &hid = config.hid.button;
-    if (btn_A != hid.a) {
-      btn_A = hid.a;
-      if (hid.a) rx = (rx + 1) & 3;
-    }
-    if (btn_B != hid.b) {
-      btn_B = hid.b;
-      if (hid.b) ry = (ry + 1) & 3;
-    }
-    if (btn_C != hid.c) {
-      btn_C = hid.c;
-      if (hid.c) rz = (rz + 1) & 3;
-    }
-
-    auto &fft = config.hid.fft;
-    if (fft.updated) {
-      fft.updated = false;
-      for (uint8_t i = 0; i < 64; i++) {
-        uint8_t a = fft.data[i] & 0x0F;
-        if (a > amplitude[i]) {
-          amplitude[i] = a;
-        }
+      if (btn_C != (bool)(buttons & joystick_t::C)) {
+        btn_C = !btn_C;
+        if (btn_C) rz = (rz + 1) & 3;
       }
     }
-*/
+    // A beat moves the colors along
+    hue16 += (uint16_t)(Modulation::beats - beats) * 8192;
+    beats = Modulation::beats;
 
     // Adjust bars and draw Spectrum
     for (uint8_t i = 0; i < 64; i++) {
-      uint8_t a = (int)round(amplitude[i]) & 0xF;
-      amplitude[i] *= 0.99f;
+      uint8_t a = (int)round(Modulation::band[i] * 15) & 0xF;
       uint8_t z = (i >> 2) & 0xE;
       uint8_t x = (i << 1) & 0xF;
+      Color gradient[16];
       for (uint8_t y = 0; y <= a; y++) {
         Color c = Color(y * 15 + x * 2 + 10, LavaPalette);
         Color d = Color((hue16 >> 8) + x * 5 + z * 5, RainbowGradientPalette);
-        Color e = Color(25, c, d).scale(brightness);
-        rotate_voxel(e, x, y, z);
-        rotate_voxel(e, x, y, z + 1);
-        rotate_voxel(e, x + 1, y, z);
-        rotate_voxel(e, x + 1, y, z + 1);
+        gradient[y] = Color(25, c, d).scale(brightness);
       }
+      // The bar of 2 by 2 columns is a box after the rotation too, the axis
+      // of its height is where its first two levels differ
+      uint8_t lo[3] = {x, 0, z};
+      uint8_t hi[3] = {(uint8_t)(x + 1), a, (uint8_t)(z + 1)};
+      uint8_t up[3] = {x, 1, z};
+      rotate(lo[0], lo[1], lo[2]);
+      rotate(hi[0], hi[1], hi[2]);
+      rotate(up[0], up[1], up[2]);
+      const uint8_t k = lo[0] != up[0] ? 0 : lo[1] != up[1] ? 1 : 2;
+      const int8_t dir = up[k] > lo[k] ? 1 : -1;
+      const uint8_t base = lo[k];
+      fill_box(min(lo[0], hi[0]), min(lo[1], hi[1]), min(lo[2], hi[2]),
+               max(lo[0], hi[0]), max(lo[1], hi[1]), max(lo[2], hi[2]),
+               [&](uint8_t vx, uint8_t vy, uint8_t vz) {
+                 const uint8_t v[3] = {vx, vy, vz};
+                 return gradient[(v[k] - base) * dir];
+               });
     }
   }
 };
@@ -7,7 +7,10 @@ class Spirograph : public Animation {
  private:
   float phase = 0;
   static const int TRAIL_LEN = 600;
-  Vector3 trail[TRAIL_LEN];
+  // The points traced last, in the arena
+  struct State {
+    Vector3 trail[TRAIL_LEN];
+  };
   int trailCount = 0;
   int trailHead = 0;
 
@@ -22,36 +25,38 @@ class Spirograph : public Animation {
     phase = 0;
     trailCount = 0;
     trailHead = 0;
+    memory<State>();
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
+    // Trace the curve since the last frame into the trail, a point about
+    // every voxel without gaps when it runs faster than a voxel per frame
+    auto curve = [](float phase) {
+      float t = phase * 2;
+      float a = 3 + sinf(phase * 0.1f);
+      float b = 2 + cosf(phase * 0.13f);
+      float cp = 5 + sinf(phase * 0.07f);
+      float d = 3 + cosf(phase * 0.11f);
+      float x = sinf(a * t) * cosf(b * t) * 6.5f;
+      float y = sinf(cp * t) * 6.5f;
+      float z = cosf(d * t) * sinf(b * t) * 6.5f;
+      return Vector3(x, y, z);
+    };
+    Vector3 *trail = memory<State>()->trail;
+    const float from = phase;
     phase += dt;
-    float t = phase * 2;
-    float a = 3 + sinf(phase * 0.1f);
-    float b = 2 + cosf(phase * 0.13f);
-    float cp = 5 + sinf(phase * 0.07f);
-    float d = 3 + cosf(phase * 0.11f);
-    float x = sinf(a * t) * cosf(b * t) * 6.5f;
-    float y = sinf(cp * t) * 6.5f;
-    float z = cosf(d * t) * sinf(b * t) * 6.5f;
-
-    trail[trailHead] = Vector3(x, y, z);
-    trailHead = (trailHead + 1) % TRAIL_LEN;
-    if (trailCount < TRAIL_LEN) trailCount++;
+    trace(curve, from, phase, 1, 64, [&](const Vector3 &p, float t) {
+      // The first point was added by the last frame
+      if (t == from && trailCount) return;
+      trail[trailHead] = p;
+      trailHead = (trailHead + 1) % TRAIL_LEN;
+      if (trailCount < TRAIL_LEN) trailCount++;
+    });
 
     for (int i = 0; i < trailCount; i++) {
       int idx = (trailHead - trailCount + i + TRAIL_LEN) % TRAIL_LEN;
@@ -3,6 +3,14 @@
 
 #include "Animation.h"
 
+/*------------------------------------------------------------------------------
+ * STARFIELD
+ *------------------------------------------------------------------------------
+ * Stars flying through the cube along z, forward and back, turning about y.
+ * A star keeps only how far it moved and how often it wrapped around: its
+ * start depth is hashed from its index, and its x and y from its index and
+ * its wraps, so a star leaving the cube comes back somewhere else.
+ *----------------------------------------------------------------------------*/
 class Starfield : public Animation {
  private:
   float phase;
@@ -10,11 +18,20 @@ class Starfield : public Animation {
   float body_diagonal;
 
   static const int numStars = 200;
-  Vector3 stars[numStars];
+  float moved[numStars];
+  uint8_t wraps[numStars];
+  uint32_t seed;
   bool initialized = false;
 
   static constexpr auto &settings = config.animation.starfield;
 
+  // A star at a depth, x and y change whenever it wraps
+  Vector3 position(const int i, const float z) {
+    const uint32_t h = Noise::hash(i, seed, wraps[i]);
+    return Vector3(Noise::hashRandom(h, -1, 1),
+                   Noise::hashRandom(Noise::hash(h), -1, 1), z);
+  }
+
  public:
   void init() {
     state = state_t::STARTING;
@@ -24,10 +41,9 @@ class Starfield : public Animation {
     phase = 0;
 
     if (!initialized) {
-      for (int i = 0; i < numStars; i++) {
-        stars[i] = Vector3(noise.nextRandom(-1, 1), noise.nextRandom(-1, 1),
-                           noise.nextRandom(-1, 1));
-      }
+      memset(moved, 0, sizeof(moved));
+      memset(wraps, 0, sizeof(wraps));
+      seed = Noise::next32();
       initialized = true;
     }
   }
@@ -37,46 +53,28 @@ class Starfield : public Animation {
     hue16_speed = settings.hue_speed * 255;
     body_diagonal = settings.body_diagonal;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
     phase += dt * phase_speed;
     hue16 += dt * hue16_speed;
 
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) {
-        state = state_t::RUNNING;
-        timer_running.reset();
-      } else {
-        brightness *= timer_starting.ratio();
-      }
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) {
-        state = state_t::ENDING;
-        timer_ending.reset();
-      }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) {
-        state = state_t::INACTIVE;
-        brightness = 0;
-      } else {
-        brightness *= (1 - timer_ending.ratio());
-      }
-    }
+    brightness *= update_lifecycle();
 
     Quaternion q = Quaternion(25.0f * phase, Vector3(0, 1, 0));
+    const float speed = sinf(phase) * 1.75f * dt;
     for (int i = 0; i < numStars; i++) {
-      float r = (stars[i] * 3 - Vector3(0, 0, -2.0f)).magnitude();
-      stars[i].z += sinf(phase) * 1.75f * dt * r;
-      if (stars[i].z > 1) {
-        stars[i] =
-            Vector3(noise.nextRandom(-1, 1), noise.nextRandom(-1, 1), -1);
-      } else if (stars[i].z < -1) {
-        stars[i] = Vector3(noise.nextRandom(-1, 1), noise.nextRandom(-1, 1), 1);
+      const float start = Noise::hashRandom(Noise::hash(i, seed), -1, 1);
+      Vector3 star = position(i, start + moved[i]);
+      float r = (star * 3 - Vector3(0, 0, -2.0f)).magnitude();
+      star.z += speed * r;
+      if (star.z > 1 || star.z < -1) {
+        // In again at the other side, somewhere else
+        wraps[i]++;
+        star = position(i, star.z > 1 ? -1 : 1);
       }
+      moved[i] = star.z - start;
       Color c = Color((hue16 >> 8) + (int8_t)(r * 6), RainbowGradientPalette);
       // Multiply by something a bit bigger than sqrt(3) * radius
-      voxel(q.rotate(stars[i]) * body_diagonal, c.scale(brightness));
+      voxel(q.rotate(star) * body_diagonal, c.scale(brightness));
     }
   }
 };
@@ -0,0 +1,66 @@
+#ifndef STREAMING_H
+#define STREAMING_H
+
+#include "Animation.h"
+#include "core/Voxels.h"
+
+/*------------------------------------------------------------------------------
+ * STREAMING CLASS
+ *------------------------------------------------------------------------------
+ * Shows the live voxel frames of a desktop renderer (core/Voxels.h). The
+ * latest complete frame is copied into the cube every frame, in the order of
+ * the cube buffers. A lost frame leaves the last one on display, the next
+ * frame after a gap fades in with a raised motion blur instead of jumping.
+ * Without frames for the timeout the animation ends, so the sequence goes on.
+ *----------------------------------------------------------------------------*/
+class Streaming : public Animation {
+ private:
+  uint32_t shown = 0;
+  uint16_t sequence = 0;
+  float idle = 0;
+  float recover = 0;
+
+  static constexpr auto &settings = config.animation.streaming;
+
+ public:
+  void init() {
+    state = state_t::STARTING;
+    timer_starting = settings.starttime;
+    timer_running = settings.runtime;
+    timer_ending = settings.endtime;
+    shown = Voxels::completed;
+    sequence = Voxels::sequence();
+    idle = 0;
+    recover = 0;
+  }
+
+  void draw(float dt) {
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+
+    if (Voxels::completed != shown) {
+      // More than one step means frames were lost on the way
+      const uint16_t step = Voxels::sequence() - sequence;
+      if (step > 1) recover = 1;
+      shown = Voxels::completed;
+      sequence = Voxels::sequence();
+      idle = 0;
+    } else {
+      idle += dt;
+    }
+    if (idle > settings.timeout && state == state_t::RUNNING) end();
+
+    const float blur = settings.motionBlur +
+                       (settings.drop_blur - settings.motionBlur) * recover;
+    setMotionBlur(blur);
+    recover = settings.drop_time > 0 ? recover - dt / settings.drop_time : 0;
+    if (recover < 0) recover = 0;
+
+    const Color *v = Voxels::frame();
+    for (uint8_t x = 0; x < Display::width; x++)
+      for (uint8_t y = 0; y < Display::height; y++)
+        for (uint8_t z = 0; z < Display::depth; z++)
+          cell(x, y, z) = v++->scaled(brightness);
+  }
+};
+#endif
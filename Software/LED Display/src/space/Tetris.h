@@ -6,20 +6,32 @@
 
 class Tetris : public Animation {
  private:
-  bool board[16][16][16];
-  Color boardColors[16][16][16];
+  // The well as one bitboard per layer y, row x and bit z, like Life
+  uint16_t well[16][16];
+  // The colors of the cells in the well, in the arena
+  struct State {
+    Color colors[16][16][16];
+  };
 
   struct Piece {
     int8_t cells[4][3];  // up to 4 cells, each with x,y,z offset
     int8_t numCells;
   };
+  // Piece as bitboard, rows[y][x] holds the z bits at offset 0
+  struct Shape {
+    uint16_t rows[4][4];
+  };
 
   static const int NUM_TYPES = 5;
   Piece types[NUM_TYPES];
+  // Every piece type turned 0, 90, 180 and 270 degrees around y
+  Shape shapes[NUM_TYPES][4];
 
   int pieceX, pieceY, pieceZ;
-  Piece cur;
+  const Shape *cur;
   Color pieceColor;
+  // Placement chosen by the autoplayer
+  int targetX, targetZ;
   float fallTimer;
   float fallInterval = 0.25f;
 
@@ -36,73 +48,135 @@ class Tetris : public Animation {
     types[3] = {{{0,0,0},{1,0,0},{1,1,0},{2,1,0}}, 4};
     // O-piece (2x2 block)
     types[4] = {{{0,0,0},{1,0,0},{0,0,1},{1,0,1}}, 4};
+    // Turn (x, z) into (z, -x) and move the offsets back to zero
+    for (int t = 0; t < NUM_TYPES; t++) {
+      Piece p = types[t];
+      for (int r = 0; r < 4; r++) {
+        int8_t minX = 0, minZ = 0;
+        for (int i = 0; i < p.numCells; i++) {
+          if (p.cells[i][0] < minX) minX = p.cells[i][0];
+          if (p.cells[i][2] < minZ) minZ = p.cells[i][2];
+        }
+        Shape &s = shapes[t][r];
+        memset(&s, 0, sizeof(s));
+        for (int i = 0; i < p.numCells; i++)
+          s.rows[p.cells[i][1]][p.cells[i][0] - minX] |=
+              1 << (p.cells[i][2] - minZ);
+        for (int i = 0; i < p.numCells; i++) {
+          const int8_t x = p.cells[i][0];
+          p.cells[i][0] = p.cells[i][2];
+          p.cells[i][2] = -x;
+        }
+      }
+    }
   }
 
-  bool fits(int px, int py, int pz, const Piece &p) {
-    for (int i = 0; i < p.numCells; i++) {
-      int x = px + p.cells[i][0];
-      int y = py + p.cells[i][1];
-      int z = pz + p.cells[i][2];
-      if (x < 0 || x > 15 || y < 0 || y > 15 || z < 0 || z > 15) return false;
-      if (board[x][y][z]) return false;
-    }
+  // A piece fits when no row of it is outside the well or overlaps
+  bool fits(int px, int py, int pz, const Shape &p) {
+    if (pz < 0) return false;
+    for (int y = 0; y < 4; y++)
+      for (int x = 0; x < 4; x++) {
+        const uint32_t row = (uint32_t)p.rows[y][x] << pz;
+        if (!row) continue;
+        if (px + x > 15 || py + y > 15 || px + x < 0 || py + y < 0)
+          return false;
+        if (row > 0xFFFF || (well[py + y][px + x] & row)) return false;
+      }
     return true;
   }
 
-  void lock(int px, int py, int pz, const Piece &p, Color c) {
-    for (int i = 0; i < p.numCells; i++) {
-      int x = px + p.cells[i][0];
-      int y = py + p.cells[i][1];
-      int z = pz + p.cells[i][2];
-      if (x >= 0 && x < 16 && y >= 0 && y < 16 && z >= 0 && z < 16) {
-        board[x][y][z] = true;
-        boardColors[x][y][z] = c;
+  void lock(int px, int py, int pz, const Shape &p, Color c) {
+    for (int y = 0; y < 4; y++)
+      for (int x = 0; x < 4; x++) {
+        const uint16_t row = p.rows[y][x] << pz;
+        if (!row) continue;
+        well[py + y][px + x] |= row;
+        for (uint16_t bits = row; bits; bits &= bits - 1)
+          memory<State>()->colors[py + y][px + x][__builtin_ctz(bits)] = c;
       }
-    }
+  }
+
+  bool full(int y) {
+    for (int x = 0; x < 16; x++)
+      if (well[y][x] != 0xFFFF) return false;
+    return true;
   }
 
   void clearLayers() {
+    Color(&wellColors)[16][16][16] = memory<State>()->colors;
     for (int y = 15; y >= 0; y--) {
-      bool full = true;
-      for (int x = 0; x < 16 && full; x++)
-        for (int z = 0; z < 16 && full; z++)
-          if (!board[x][y][z]) full = false;
-      if (full) {
-        // Shift everything above down
-        for (int yy = y; yy < 15; yy++)
-          for (int x = 0; x < 16; x++)
-            for (int z = 0; z < 16; z++) {
-              board[x][yy][z] = board[x][yy + 1][z];
-              boardColors[x][yy][z] = boardColors[x][yy + 1][z];
-            }
-        // Clear top layer
-        for (int x = 0; x < 16; x++)
-          for (int z = 0; z < 16; z++) {
-            board[x][15][z] = false;
-            boardColors[x][15][z] = Color::BLACK;
-          }
-        y++;  // re-check this layer
+      if (!full(y)) continue;
+      // Shift everything above down and clear the top layer
+      memmove(well[y], well[y + 1], (15 - y) * sizeof(well[0]));
+      memmove(wellColors[y], wellColors[y + 1],
+              (15 - y) * sizeof(wellColors[0]));
+      memset(well[15], 0, sizeof(well[0]));
+      memset(wellColors[15], 0, sizeof(wellColors[0]));
+    }
+  }
+
+  // Score of dropping a piece at (px, pz): prefer low, dense layers and
+  // few empty cells left right below the piece
+  int32_t evaluate(int px, int pz, const Shape &p, int &py) {
+    if (!fits(px, py, pz, p)) return INT32_MIN;
+    while (fits(px, py - 1, pz, p)) py--;
+    int32_t score = -16 * py;
+    for (int y = 0; y < 4; y++)
+      for (int x = 0; x < 4; x++) {
+        const uint16_t row = p.rows[y][x] << pz;
+        if (!row) continue;
+        score += __builtin_popcount(well[py + y][px + x]) * 2;
+        // Holes under the piece that can't be filled anymore
+        if (py + y > 0 && (y == 0 || !p.rows[y - 1][x]))
+          score -= 8 * __builtin_popcount(row & ~well[py + y - 1][px + x]);
       }
+    return score;
+  }
+
+  // Try every turn and place of the new piece and keep the best one
+  void plan(int type) {
+    int32_t best = INT32_MIN;
+    cur = &shapes[type][0];
+    targetX = pieceX;
+    targetZ = pieceZ;
+    for (int r = 0; r < 4; r++) {
+      const Shape &s = shapes[type][r];
+      if (!fits(pieceX, pieceY, pieceZ, s)) continue;
+      for (int x = 0; x < 16; x++)
+        for (int z = 0; z < 16; z++) {
+          int y = pieceY;
+          const int32_t score = evaluate(x, z, s, y);
+          // The piece moves one step along x and z while falling one layer
+          const int steps = max(abs(x - pieceX), abs(z - pieceZ));
+          if (steps > pieceY - y) continue;
+          if (score > best) {
+            best = score;
+            cur = &s;
+            targetX = x;
+            targetZ = z;
+          }
+        }
     }
   }
 
   void spawn() {
     int type = (int)noise.nextRandom(0, NUM_TYPES);
     if (type >= NUM_TYPES) type = NUM_TYPES - 1;
-    cur = types[type];
     pieceX = (int)noise.nextRandom(2, 12);
     if (pieceX > 12) pieceX = 12;
     pieceZ = (int)noise.nextRandom(2, 12);
     if (pieceZ > 12) pieceZ = 12;
-    pieceY = 15;
+    pieceY = 12;
     uint8_t hue = (uint8_t)noise.nextRandom(0, 256);
     pieceColor = Color(hue, RainbowGradientPalette);
     fallTimer = 0;
+    plan(type);
 
-    // If the piece doesn't fit at spawn, clear the board (game over)
-    if (!fits(pieceX, pieceY, pieceZ, cur)) {
-      memset(board, 0, sizeof(board));
-      memset(boardColors, 0, sizeof(boardColors));
+    // If the piece doesn't fit at spawn, clear the well (game over)
+    if (!fits(pieceX, pieceY, pieceZ, *cur)) {
+      memset(well, 0, sizeof(well));
+      memset(memory<State>()->colors, 0, sizeof(State::colors));
+      plan(type);
     }
   }
 
@@ -112,80 +186,54 @@ class Tetris : public Animation {
     timer_starting = settings.starttime;
     timer_running = settings.runtime;
     timer_ending = settings.endtime;
-    memset(board, 0, sizeof(board));
-    memset(boardColors, 0, sizeof(boardColors));
+    memset(well, 0, sizeof(well));
+    memset(memory<State>()->colors, 0, sizeof(State::colors));
     initTypes();
     spawn();
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     fallTimer += dt;
     if (fallTimer >= fallInterval) {
       fallTimer -= fallInterval;
 
-      // AI: try to move piece toward center-bottom, try random horizontal moves
-      int bestX = pieceX;
-      int bestZ = pieceZ;
-
-      // Try a random horizontal move toward a better position
-      int dx = 0, dz = 0;
-      int rdir = (int)noise.nextRandom(0, 4);
-      if (rdir >= 4) rdir = 3;
-      if (rdir == 0) dx = 1;
-      else if (rdir == 1) dx = -1;
-      else if (rdir == 2) dz = 1;
-      else dz = -1;
-
-      if (fits(pieceX + dx, pieceY, pieceZ + dz, cur)) {
-        pieceX += dx;
-        pieceZ += dz;
-      }
+      // AI: move one step toward the planned placement
+      int dx = targetX > pieceX ? 1 : targetX < pieceX ? -1 : 0;
+      int dz = targetZ > pieceZ ? 1 : targetZ < pieceZ ? -1 : 0;
+      if (dx && fits(pieceX + dx, pieceY, pieceZ, *cur)) pieceX += dx;
+      if (dz && fits(pieceX, pieceY, pieceZ + dz, *cur)) pieceZ += dz;
 
       // Try to fall
-      if (fits(pieceX, pieceY - 1, pieceZ, cur)) {
+      if (fits(pieceX, pieceY - 1, pieceZ, *cur)) {
         pieceY--;
       } else {
         // Lock piece
-        lock(pieceX, pieceY, pieceZ, cur, pieceColor);
+        lock(pieceX, pieceY, pieceZ, *cur, pieceColor);
         clearLayers();
         spawn();
       }
     }
 
-    // Draw the board
-    for (int x = 0; x < 16; x++)
-      for (int y = 0; y < 16; y++)
-        for (int z = 0; z < 16; z++) {
-          if (board[x][y][z]) {
-            Vector3 pos(x - 7.5f, y - 7.5f, z - 7.5f);
-            voxel(pos, boardColors[x][y][z].scaled(brightness));
-          }
+    // Draw the well
+    const Color(&wellColors)[16][16][16] = memory<State>()->colors;
+    for (int y = 0; y < 16; y++)
+      for (int x = 0; x < 16; x++)
+        for (uint16_t bits = well[y][x]; bits; bits &= bits - 1) {
+          const int z = __builtin_ctz(bits);
+          voxel(x, y, z, wellColors[y][x][z].scaled(brightness));
         }
 
     // Draw the falling piece
-    for (int i = 0; i < cur.numCells; i++) {
-      int x = pieceX + cur.cells[i][0];
-      int y = pieceY + cur.cells[i][1];
-      int z = pieceZ + cur.cells[i][2];
-      if (x >= 0 && x < 16 && y >= 0 && y < 16 && z >= 0 && z < 16) {
-        Vector3 pos(x - 7.5f, y - 7.5f, z - 7.5f);
-        voxel(pos, pieceColor.scaled(brightness));
-      }
-    }
+    for (int y = 0; y < 4; y++)
+      for (int x = 0; x < 4; x++)
+        for (uint16_t bits = cur->rows[y][x] << pieceZ; bits; bits &= bits - 1)
+          voxel(pieceX + x, pieceY + y, __builtin_ctz(bits),
+                pieceColor.scaled(brightness));
   }
 };
 #endif
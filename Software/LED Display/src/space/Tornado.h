@@ -7,15 +7,20 @@ class Tornado : public Animation {
  private:
   static const int NUM_PARTICLES = 300;
 
+  // The angle in fixed point turns (see isincos()) and the turns per second
   struct TParticle {
-    float angle;
+    uint16_t angle;
+    float turn;
     float y;
     float radius;
     float speed;
     uint8_t hue;
   };
 
-  TParticle parts[NUM_PARTICLES];
+  // The particles, in the arena
+  struct State {
+    TParticle parts[NUM_PARTICLES];
+  };
   float phase = 0;
 
   static constexpr auto &settings = config.animation.tornado;
@@ -28,35 +33,30 @@ class Tornado : public Animation {
     timer_ending = settings.endtime;
     phase = 0;
 
+    TParticle *parts = memory<State>()->parts;
     for (int i = 0; i < NUM_PARTICLES; i++) {
-      parts[i].angle = noise.nextRandom(0.0f, 2.0f * PI);
+      parts[i].angle = noise.nextRandom(0.0f, 65535.0f);
       parts[i].y = noise.nextRandom(-7.5f, 7.5f);
       parts[i].radius = noise.nextRandom(0.3f, 1.0f);
       parts[i].speed = noise.nextRandom(1.5f, 4.0f);
+      // 2 * speed radians per second
+      parts[i].turn = parts[i].speed * 2.0f * (65536.0f / (2.0f * PI));
       parts[i].hue = (uint8_t)(int)noise.nextRandom(0, 256);
     }
   }
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     phase += dt;
 
+    TParticle *parts = memory<State>()->parts;
     for (int i = 0; i < NUM_PARTICLES; i++) {
       // Move particles upward and rotate
-      parts[i].angle += dt * parts[i].speed * 2.0f;
+      parts[i].angle += (uint32_t)(dt * parts[i].turn);
       parts[i].y += dt * parts[i].speed * 0.8f;
 
       // Wrap around when past top
@@ -71,8 +71,10 @@ class Tornado : public Animation {
       // Radius widens with height: narrow at bottom, wide at top
       float effectiveRadius = parts[i].radius * (1.0f + t * 5.0f);
 
-      float px = cosf(parts[i].angle) * effectiveRadius;
-      float pz = sinf(parts[i].angle) * effectiveRadius;
+      float sn, cs;
+      isincos(parts[i].angle, sn, cs);
+      float px = cs * effectiveRadius;
+      float pz = sn * effectiveRadius;
       float py = parts[i].y;
 
       Vector3 pos = Vector3(px, py, pz);
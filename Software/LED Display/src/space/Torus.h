@@ -22,18 +22,9 @@ class Torus : public Animation {
 
   void draw(float dt) {
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
-    if (state == state_t::STARTING) {
-      if (timer_starting.update()) { state = state_t::RUNNING; timer_running.reset(); }
-      else brightness *= timer_starting.ratio();
-    }
-    if (state == state_t::RUNNING) {
-      if (timer_running.update()) { state = state_t::ENDING; timer_ending.reset(); }
-    }
-    if (state == state_t::ENDING) {
-      if (timer_ending.update()) { state = state_t::INACTIVE; brightness = 0; return; }
-      else brightness *= (1 - timer_ending.ratio());
-    }
+    uint8_t brightness = settings.brightness;
+    brightness *= update_lifecycle();
+    if (state == state_t::INACTIVE) return;
 
     angle += dt;
     hue16 += (uint16_t)(dt * 40 * 255);
@@ -41,18 +32,17 @@ class Torus : public Animation {
     Quaternion q = Quaternion(angle * 30, Vector3(1, 0, 0))
                  * Quaternion(angle * 20, Vector3(0, 0, 1));
 
-    int resU = 40, resV = 20;
-    for (int i = 0; i < resU; i++) {
-      float u = (float)i / resU * (2.0f * PI);
-      for (int j = 0; j < resV; j++) {
-        float v = (float)j / resV * (2.0f * PI);
-        Vector3 p((R + r * cosf(v)) * cosf(u),
-                  (R + r * cosf(v)) * sinf(u),
-                  r * sinf(v));
-        Color c = Color((uint8_t)((hue16 >> 8) + i * 5), RainbowGradientPalette);
-        radiate(q.rotate(p), c, 1.2f);
-      }
-    }
+    // Distance to the torus in its own space, the shell fades to black
+    Quaternion inv = q.conjugated();
+    Color c = Color((uint8_t)(hue16 >> 8), RainbowGradientPalette);
+    uint8_t palette[] = {0, 0, 0, 0, 255, c.r, c.g, c.b};
+    sdf(
+        [&](const Vector3 &p) {
+          Vector3 l = inv.rotate(p);
+          float m = sqrtf(l.x * l.x + l.y * l.y) - R;
+          return sqrtf(m * m + l.z * l.z) - r;
+        },
+        1.2f, palette, brightness);
   }
 };
 #endif
@@ -2,34 +2,59 @@
 #define TWINKELS_H
 
 #include "Animation.h"
-
-// source buffer for original value
-DMAMEM Color colors[Display::width][Display::height][Display::depth];
-// time the pixel is activated
-DMAMEM float duration[Display::width][Display::height][Display::depth];
+#include "power/Color32.h"
+/*------------------------------------------------------------------------------
+ * TWINKELS
+ *------------------------------------------------------------------------------
+ * Lamps fading in and out at random voxels. The state of every voxel is kept
+ * in byte planes, its level and whether it is still rising, so a frame fades
+ * four lamps per word with saturating byte operations and only draws the
+ * lamps that are lit. The hue of a lamp is hashed from its voxel and the
+ * seed of the run, it is not stored. The cost stays about the same from a few
+ * lamps to hundreds, an interval below the frame time spawns several lamps a
+ * frame.
+ *----------------------------------------------------------------------------*/
+static const uint16_t TwinkelCount =
+    Display::width * Display::height * Display::depth;
+// Level of a lamp, 0 is off
+DMAMEM uint32_t twinkel_level[TwinkelCount / 4];
+// 0xFF while a lamp fades in, 0x00 while it fades out
+DMAMEM uint32_t twinkel_rising[TwinkelCount / 4];
 
 class Twinkels : public Animation {
  private:
-  // amount of time before adding a new pixel
-  Timer timer_interval;
-  // amount of seconds it takes to fade a pixel to max
-  float fade_in_speed;
-  // amount of seconds it takes to fade a pixel to min
-  float fade_out_speed;
+  // lamps to spawn, the fraction is kept for the next frame
+  float spawn;
+  // level steps to fade in and out, the fraction is kept for the next frame
+  float attack;
+  float decay;
   // single color for single color mode
   Color single_color;
   // different animation modes
   boolean mode_single_color;
   boolean mode_fade_out;
+  // hues of the lamps in the rainbow palette, hashed per voxel
+  uint32_t seed;
 
   static constexpr auto &settings = config.animation.twinkels;
 
+  // Whole steps of a fade over seconds, keeping the fraction in acc
+  static uint8_t steps(float &acc, const float dt, const float seconds) {
+    acc += seconds > 0 ? 255 * dt / seconds : 255;
+    const uint8_t n = acc < 255 ? acc : 255;
+    acc -= n;
+    return n;
+  }
+
  public:
   Twinkels() { set_clear(); }
   void init() {
     state = state_t::RUNNING;
     timer_running = settings.runtime;
-    timer_interval = settings.interval;
+    spawn = 0;
+    attack = 0;
+    decay = 0;
+    seed = Noise::next32();
   }
   void set_mode(bool single, bool fade_out) {
     mode_single_color = single;
@@ -37,12 +62,8 @@ class Twinkels : public Animation {
   }
   void set_color(Color c) { single_color = c; }
   void set_clear() {
-    for (uint8_t x = 0; x < Display::width; x++)
-      for (uint8_t y = 0; y < Display::height; y++)
-        for (uint8_t z = 0; z < Display::depth; z++) {
-          duration[x][y][z] = 0;
-          colors[x][y][z] = Color::BLACK;
-        }
+    memset(twinkel_level, 0, sizeof(twinkel_level));
+    memset(twinkel_rising, 0, sizeof(twinkel_rising));
   }
   void end() {
     if (state == state_t::RUNNING) {
@@ -52,51 +73,49 @@ class Twinkels : public Animation {
   }
 
   void draw(float dt) {
-    fade_in_speed = settings.fade_in_speed;
-    fade_out_speed = settings.fade_out_speed;
     setMotionBlur(settings.motionBlur);
-    uint8_t brightness = settings.brightness * getBrightness();
+    uint8_t brightness = settings.brightness;
     uint16_t pixels_active = 0;
-    
-    for (uint8_t x = 0; x < Display::width; x++) {
-      for (uint8_t y = 0; y < Display::height; y++) {
-        for (uint8_t z = 0; z < Display::depth; z++) {
-          if (!colors[x][y][z].isBlack()) {
-            if (duration[x][y][z] < fade_in_speed) {
-              float t = duration[x][y][z] / fade_in_speed;
-              voxel(x, y, z, colors[x][y][z].scaled(brightness * t));
-              duration[x][y][z] += dt;
-              pixels_active++;
-            } else if (duration[x][y][z] < (fade_in_speed + fade_out_speed)) {
-              float t = (duration[x][y][z] - fade_in_speed) / fade_out_speed;
-              voxel(x, y, z, colors[x][y][z].scaled(brightness * (1 - t)));
-              duration[x][y][z] += dt;
-              pixels_active++;
-            } else {
-              duration[x][y][z] = 0;
-              colors[x][y][z] = Color::BLACK;
-              voxel(x, y, z, Color::BLACK);
-            }
-          }
-        }
+
+    // Fade every lamp, rising lamps up and the others down, a lamp reaching
+    // the top starts to fall
+    const uint32_t up = steps(attack, dt, settings.fade_in_speed) * 0x01010101;
+    const uint32_t down = steps(decay, dt, settings.fade_out_speed) * 0x01010101;
+    const uint8_t *level = (const uint8_t *)twinkel_level;
+    for (uint16_t w = 0; w < TwinkelCount / 4; w++) {
+      const uint32_t rising = twinkel_rising[w];
+      uint32_t v = twinkel_level[w];
+      if (!v) continue;
+      v = uqsub8(uqadd8(v, up & rising), down & ~rising);
+      twinkel_level[w] = v;
+      twinkel_rising[w] = rising & ~ufull8(v);
+      if (!v) continue;
+      for (uint8_t i = 0; i < 4; i++) {
+        const uint16_t n = w * 4 + i;
+        if (!level[n]) continue;
+        const uint8_t scale = scale8(level[n], brightness);
+        Color c = mode_single_color
+                      ? single_color
+                      : Color(Noise::hash(n, seed) >> 24,
+                              RainbowGradientPalette);
+        voxel(n >> 8, n >> 4 & 15, n & 15, c.scale(scale));
+        pixels_active++;
       }
     }
     if (timer_running.update()) {
       state = state_t::ENDING;
     }
-    // Consider adding a new random twinkle
+    // Spawn new lamps at random voxels that are off
     if (state != state_t::ENDING) {
-      if (timer_interval.update()) {
-        uint8_t x = random(0, Display::width);
-        uint8_t y = random(0, Display::height);
-        uint8_t z = random(0, Display::depth);
-        if (duration[x][y][z] == 0) {
-          if (mode_single_color) {
-            colors[x][y][z] = single_color;
-          } else {
-            colors[x][y][z] = Color(0, 255);
-          }
-        }
+      const float interval = settings.interval;
+      spawn += interval > 0 ? dt / interval : 1;
+      uint8_t *lamp = (uint8_t *)twinkel_level;
+      uint8_t *rising = (uint8_t *)twinkel_rising;
+      for (; spawn >= 1; spawn--) {
+        const uint16_t n = Noise::next32() & (TwinkelCount - 1);
+        if (lamp[n]) continue;
+        lamp[n] = 1;
+        rising[n] = 0xFF;
       }
     } else if (mode_fade_out) {
       if (pixels_active == 0) {
@@ -107,4 +126,4 @@ class Twinkels : public Animation {
     }
   }
 };
-#endif
\ No newline at end of file
+#endif
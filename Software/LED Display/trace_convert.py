@@ -0,0 +1,101 @@
+# Convert a dump of the trace ring (core/Trace.h) to the JSON of the Chrome
+# trace viewer, to open in chrome://tracing or ui.perfetto.dev. The dump is
+# the console output of the "trace" command, from a log of the USB serial
+# port or read here, which sends the command itself (needs pyserial):
+#
+# python trace_convert.py log.txt trace.json
+# python trace_convert.py --port /dev/ttyACM0 trace.json
+#
+# Every context of the firmware is a row: the main loop, the transpose isr
+# and the dma isr. Cycles are unwrapped, the counter wraps every 7 seconds at
+# 600 MHz, and records of an isr that got in between may be a little late.
+import argparse
+import json
+import struct
+import sys
+
+PHASES = ["B", "E", "i"]
+
+
+# A JSON frame of core/Frame.h with its CRC-16 CCITT-FALSE
+def frame(text):
+    payload = text.encode()
+    body = struct.pack("<BH", 0, len(payload)) + payload
+    crc = 0xFFFF
+    for b in body:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = (crc << 1 ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return b"\xf3" + body + struct.pack("<H", crc)
+
+
+def read_port(port):
+    import serial
+    with serial.Serial(port, timeout=5) as s:
+        s.reset_input_buffer()
+        s.write(frame('{"event":"trace"}'))
+        lines = []
+        while True:
+            line = s.readline()
+            if not line:
+                sys.exit("%s: no trace end" % port)
+            line = line.decode(errors="replace").strip()
+            if lines or line.startswith("trace "):
+                lines.append(line)
+            if line == "trace end":
+                return lines
+
+
+def convert(lines):
+    start = next(i for i, l in enumerate(lines) if l.startswith("trace ")
+                 and l != "trace end")
+    header = lines[start].split()
+    mhz = int(header[1]) / 1e6
+    events = [name.split(":") for name in header[2:]]
+    contexts = []
+    for _, context in events:
+        if context not in contexts:
+            contexts.append(context)
+    out = [{"name": "thread_name", "ph": "M", "pid": 0, "tid": tid,
+            "args": {"name": context}}
+           for tid, context in enumerate(contexts)]
+    last = None
+    time = 0
+    for line in lines[start + 1:]:
+        if line == "trace end":
+            break
+        cycles, event, phase, arg = (int(v) for v in line.split())
+        if last is not None:
+            delta = (cycles - last) & 0xFFFFFFFF
+            time += delta - (1 << 32) if delta >= 1 << 31 else delta
+        last = cycles
+        name, context = events[event]
+        record = {"name": name, "ph": PHASES[phase], "ts": time / mhz,
+                  "pid": 0, "tid": contexts.index(context)}
+        if phase == 2:
+            record["s"] = "t"
+        if phase:
+            record["args"] = {"arg": arg}
+        out.append(record)
+    return {"traceEvents": out, "displayTimeUnit": "ms"}
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("log", nargs="?", help="console output with a dump")
+    parser.add_argument("out", help="trace JSON to write")
+    parser.add_argument("--port", help="USB serial port of the Teensy")
+    args = parser.parse_args()
+    if args.port:
+        lines = read_port(args.port)
+    elif args.log:
+        lines = [line.strip() for line in open(args.log, errors="replace")]
+    else:
+        sys.exit("a log or --port")
+    trace = convert(lines)
+    json.dump(trace, open(args.out, "w"))
+    print("%s: %d events" % (args.out, len(trace["traceEvents"])))
+
+
+if __name__ == "__main__":
+    main()
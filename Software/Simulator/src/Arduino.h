@@ -10,6 +10,7 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <cmath>
 #include <chrono>
 
@@ -38,6 +39,10 @@ inline long random(long min, long max) {
     return min + (std::rand() % (max - min));
 }
 
+inline void randomSeed(unsigned long seed) {
+    std::srand(seed);
+}
+
 inline float randomf() {
     return (float)std::rand() / (float)RAND_MAX;
 }
@@ -100,4 +105,75 @@ using std::fabs;
 #include <string>
 typedef std::string String;
 
+// Teensy memory placement (one memory on desktop)
+#define DMAMEM
+#define FASTRUN
+#define FLASHMEM
+#define EXTMEM
+
+// Teensy 4 core clock and the ARM DWT cycle counter, counted from the wall
+// clock at that rate so cycle profiles read as on the cube
+#define F_CPU_ACTUAL 600000000
+inline uint32_t armCycles() {
+    static auto start = std::chrono::steady_clock::now();
+    auto now = std::chrono::steady_clock::now();
+    return (uint32_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count() * 3 / 5);
+}
+inline uint32_t simArmDemcr = 0;
+inline uint32_t simArmDwtCtrl = 0;
+#define ARM_DEMCR simArmDemcr
+#define ARM_DEMCR_TRCENA (1 << 24)
+#define ARM_DWT_CTRL simArmDwtCtrl
+#define ARM_DWT_CTRL_CYCCNTENA (1 << 0)
+#define ARM_DWT_CYCCNT (armCycles())
+
+// Interrupts of the firmware run synchronously, a software interrupt that is
+// set pending runs at once. There are no caches to maintain.
+#define IRQ_SOFTWARE 70
+inline void (*simVectors[160])() = {};
+inline void attachInterruptVector(int irq, void (*function)()) { simVectors[irq] = function; }
+inline void NVIC_SET_PENDING(int irq) {
+    if (simVectors[irq]) simVectors[irq]();
+}
+#define NVIC_SET_PRIORITY(irq, priority)
+#define NVIC_ENABLE_IRQ(irq)
+#define NVIC_DISABLE_IRQ(irq)
+inline void arm_dcache_flush(void*, uint32_t) {}
+
+// Pins lead nowhere, pin interrupts never fire (the rotating base stands still)
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define FALLING 2
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void analogWrite(uint8_t, int) {}
+inline void analogWriteFrequency(uint8_t, float) {}
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+
+// Byte source of files and serial ports, what core/JsonReader.h reads from
+class Stream {
+public:
+    virtual ~Stream() = default;
+    virtual int read() = 0;
+};
+
+// Serial console on stdout
+#include <cstdio>
+#include <cstdarg>
+struct SimSerial {
+    void begin(unsigned long) {}
+    int printf(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        int n = vprintf(format, args);
+        va_end(args);
+        return n;
+    }
+    void print(const char* text) { fputs(text, stdout); }
+    void println(const char* text = "") { puts(text); }
+};
+inline SimSerial Serial;
+
 #endif // ARDUINO_H_SIMULATOR
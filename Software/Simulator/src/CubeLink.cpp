@@ -0,0 +1,136 @@
+#include "CubeLink.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+// Frames between keyframes, as the ESP8266 streams them
+static const uint16_t KEYFRAME = 16;
+
+bool CubeLink::open(const char* device) {
+    close();
+#ifdef _WIN32
+    HANDLE h = CreateFileA(device, GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr);
+    if (h == INVALID_HANDLE_VALUE) return false;
+    port = h;
+#else
+    port = ::open(device, O_WRONLY | O_NOCTTY);
+    if (port < 0) return false;
+    // Raw bytes, the baudrate means nothing to the USB serial of the Teensy
+    termios tty;
+    if (tcgetattr(port, &tty) == 0) {
+        cfmakeraw(&tty);
+        tcsetattr(port, TCSANOW, &tty);
+    }
+#endif
+    restart();
+    return true;
+}
+
+void CubeLink::close() {
+#ifdef _WIN32
+    if (port) CloseHandle((HANDLE)port);
+    port = nullptr;
+#else
+    if (port >= 0) ::close(port);
+    port = -1;
+#endif
+}
+
+bool CubeLink::isOpen() const {
+#ifdef _WIN32
+    return port != nullptr;
+#else
+    return port >= 0;
+#endif
+}
+
+void CubeLink::restart() {
+    memset(previous, 0, sizeof(previous));
+    colors = 0;
+    keyframe = true;
+}
+
+// A link frame of one chunk, returns its size
+static size_t chunk(uint8_t* out, uint16_t sequence, voxels_t format,
+                    uint16_t offset, uint16_t count, const uint8_t* data,
+                    uint16_t size) {
+    uint8_t payload[VOXELS_HEADER + 256 * 3];
+    payload[0] = sequence & 0xFF;
+    payload[1] = sequence >> 8;
+    payload[2] = (uint8_t)format;
+    payload[3] = offset & 0xFF;
+    payload[4] = offset >> 8;
+    payload[5] = count & 0xFF;
+    payload[6] = count >> 8;
+    memcpy(&payload[VOXELS_HEADER], data, size);
+    return Frame::encode(out, 6 + sizeof(payload), frame_t::VOXELS, payload,
+                         VOXELS_HEADER + size);
+}
+
+size_t CubeLink::encode(uint8_t* out, const uint8_t* rgb) {
+    const bool key = keyframe || sequence % KEYFRAME == 0;
+    size_t size = 0;
+    const uint16_t n = VoxelCodec::palettize(rgb, VOXELS_COUNT, found, indices);
+    if (n && (key || n != colors || memcmp(found, palette, n * 3))) {
+        memcpy(palette, found, n * 3);
+        colors = n;
+        size += chunk(&out[size], sequence, voxels_t::PALETTE, 0, n, palette, n * 3);
+    }
+    uint8_t data[256 * 3];
+    for (uint16_t c = 0; c < VOXELS_COUNT; c += 256) {
+        voxels_t format = voxels_t::RGB;
+        uint16_t best = sizeof(data);
+        if (n) {
+            const uint16_t k = VoxelCodec::encode_rle(data, best, &indices[c], 16);
+            if (k) {
+                format = voxels_t::RLE;
+                best = k;
+            }
+        }
+        uint8_t delta[256 * 3];
+        if (!key) {
+            const uint16_t k = VoxelCodec::encode_delta(delta, best, &rgb[c * 3],
+                                                        &previous[c * 3], 256);
+            if (k) {
+                format = voxels_t::DELTA;
+                best = k;
+                memcpy(data, delta, k);
+            }
+        }
+        if (format == voxels_t::RGB) memcpy(data, &rgb[c * 3], best);
+        size += chunk(&out[size], sequence, format, c, 256, data, best);
+    }
+    memcpy(previous, rgb, sizeof(previous));
+    keyframe = false;
+    sequence++;
+    return size;
+}
+
+bool CubeLink::send(const uint8_t* rgb) {
+    if (!isOpen()) return false;
+    size_t size = encode(bytes, rgb);
+    const uint8_t* p = bytes;
+    while (size > 0) {
+#ifdef _WIN32
+        DWORD written = 0;
+        if (!WriteFile((HANDLE)port, p, (DWORD)size, &written, nullptr)) written = 0;
+        const long n = (long)written;
+#else
+        const long n = (long)::write(port, p, size);
+#endif
+        if (n <= 0) {
+            close();
+            return false;
+        }
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/Frame.h"
+#include "power/VoxelCodec.h"
+
+// Live voxel frames for the cube (core/Voxels.h of the firmware), sent to
+// its USB serial port (core/USB.h) as VOXELS frames of the ESP8266 link.
+//
+// Every frame goes out as 16 chunks of 256 voxels, each the smallest of
+// RGB, RLE in the palette of the frame and a DELTA against the frame before.
+// The palette goes first whenever it changed, every 16th frame is a keyframe
+// without deltas. USB does not lose bytes, but a keyframe lets a cube that
+// was plugged in or reset pick up the stream.
+//
+// CubeLink link;
+// if (link.open("/dev/ttyACM0")) link.send(rgb);
+class CubeLink {
+public:
+    // A palette and 16 RGB chunks, each a link frame around a chunk header
+    static const size_t FRAME_BYTES_MAX = 17 * (6 + VOXELS_HEADER + 256 * 3);
+
+    CubeLink() { restart(); }
+    ~CubeLink() { close(); }
+
+    bool open(const char* device);
+    void close();
+    bool isOpen() const;
+    // Send a frame of 4096 voxels of r, g, b bytes in [x][y][z] order, false
+    // when the port failed
+    bool send(const uint8_t* rgb);
+    // Encode the next frame into out (FRAME_BYTES_MAX), returns the bytes
+    size_t encode(uint8_t* out, const uint8_t* rgb);
+    // Start over with a keyframe and a new palette
+    void restart();
+
+private:
+    uint8_t previous[VOXELS_COUNT * 3];
+    uint8_t found[256 * 3];
+    uint8_t palette[256 * 3];
+    uint16_t colors = 0;
+    uint8_t indices[VOXELS_COUNT];
+    uint16_t sequence = 0;
+    bool keyframe = true;
+    uint8_t bytes[FRAME_BYTES_MAX];
+#ifdef _WIN32
+    void* port = nullptr;
+#else
+    int port = -1;
+#endif
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <vector>
+
+// Simple animation base class for demos
+class DemoAnimation {
+public:
+    virtual ~DemoAnimation() = default;
+    virtual void init() = 0;
+    virtual void update(float dt) = 0;
+    virtual const char* name() = 0;
+};
+
+// All demo animations in display order, owned by the caller
+std::vector<DemoAnimation*> createDemos();
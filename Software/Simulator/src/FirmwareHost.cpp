@@ -0,0 +1,78 @@
+#include "FirmwareHost.h"
+
+#include <Arduino.h>
+#include <DMAChannel.h>
+
+#include "core/Bus.h"
+#include "core/Card.h"
+#include "core/Config.h"
+#include "core/Display.h"
+#include "core/Log.h"
+#include "core/Programs.h"
+#include "core/Schema.h"
+#include "space/Animation.h"
+
+//=============================================================================
+// Firmware services the simulator does without
+//=============================================================================
+Config config;
+
+// The config stays in memory, nothing is read or written behind
+void Config::load() {}
+void Config::save() {}
+void Config::loop() {}
+
+// The "card" is the working directory, see shim/SdFat.h
+SdFs Card::fs;
+bool Card::mount() { return true; }
+bool Card::idle() { return true; }
+void Card::wait() {}
+
+// Nothing else shares the "card"
+bool Bus::acquire(const client_t) { return true; }
+void Bus::release(const client_t, const uint32_t) {}
+
+// Messages go into the log ring, nothing drains it
+Log::record_t Log::ring[LOG_RECORDS];
+std::atomic<uint32_t> Log::head{0};
+
+// No programs are uploaded, the Program animation runs its built in one
+uint32_t Programs::revision = 0;
+bool Programs::load(const char*, Bytecode&) { return false; }
+
+// No schema, modulation bindings find no field and leave the config as is
+const field_t* Schema::find(const char*) { return nullptr; }
+float Schema::get(const field_t&, const Settings&) { return 0; }
+void Schema::set(const field_t&, const float, Settings&) {}
+
+//=============================================================================
+// FirmwareHost
+//=============================================================================
+void FirmwareHost::frame() {
+    Animation::loop();
+    DMAChannel::complete();
+}
+
+void FirmwareHost::select(uint16_t index) {
+    config.animation.play_one = true;
+    config.animation.animation = index;
+    config.animation.changed = true;
+}
+
+uint16_t FirmwareHost::count() {
+    uint16_t items = 0;
+    while (Animation::get_item(items).object) items++;
+    return items;
+}
+
+void FirmwareHost::shown(uint8_t rgb[16][16][16][3]) {
+    const uint8_t buffer = Display::getPreviousBuffer();
+    for (uint8_t x = 0; x < 16; x++)
+        for (uint8_t y = 0; y < 16; y++)
+            for (uint8_t z = 0; z < 16; z++) {
+                const Color& c = Display::at(buffer, x, y, z);
+                rgb[x][y][z][0] = c.r;
+                rgb[x][y][z][1] = c.g;
+                rgb[x][y][z][2] = c.b;
+            }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+// The firmware animations on the desktop, see firmware.cpp. Provides what the
+// firmware expects from the rest of the cube (config, SD card) and drives the
+// display the way the DMA interrupts of the Teensy would.
+class FirmwareHost {
+public:
+    // Draw a frame when the scheduler lets it through and have it shown
+    static void frame();
+    // Play one animation of the jump table from now on
+    static void select(uint16_t index);
+    // Amount of animations in the jump table
+    static uint16_t count();
+    // The last transposed frame, blended with the frame before it
+    static void shown(uint8_t rgb[16][16][16][3]);
+};
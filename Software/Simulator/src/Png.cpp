@@ -0,0 +1,133 @@
+#include "Png.h"
+
+#include <cstdio>
+
+#include "power/Crc.h"
+
+// Deflate bits go out from the least significant end
+struct BitWriter {
+    std::vector<uint8_t>& out;
+    uint32_t bits = 0;
+    int count = 0;
+
+    void put(uint32_t value, int n) {
+        bits |= value << count;
+        count += n;
+        while (count >= 8) {
+            out.push_back(bits & 0xFF);
+            bits >>= 8;
+            count -= 8;
+        }
+    }
+    // Huffman codes go out from their most significant bit
+    void code(uint32_t value, int n) {
+        uint32_t reversed = 0;
+        for (int i = 0; i < n; i++) reversed |= ((value >> i) & 1) << (n - 1 - i);
+        put(reversed, n);
+    }
+    void flush() {
+        if (count) out.push_back(bits & 0xFF);
+        bits = 0;
+        count = 0;
+    }
+};
+
+// Fixed Huffman code of a literal or length symbol (RFC 1951 3.2.6)
+static void symbol(BitWriter& w, int s) {
+    if (s < 144) w.code(0x30 + s, 8);
+    else if (s < 256) w.code(0x190 + s - 144, 9);
+    else if (s < 280) w.code(s - 256, 7);
+    else w.code(0xC0 + s - 280, 8);
+}
+
+static const uint16_t lengthBase[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                        31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                        2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+// A match of length 3 to 258 at distance 1
+static void run(BitWriter& w, int length) {
+    int i = 28;
+    while (lengthBase[i] > length) i--;
+    symbol(w, 257 + i);
+    w.put(length - lengthBase[i], lengthExtra[i]);
+    w.code(0, 5);
+}
+
+static void deflate(std::vector<uint8_t>& out, const std::vector<uint8_t>& data) {
+    // zlib header of a 32K window and no dictionary
+    out.push_back(0x78);
+    out.push_back(0x01);
+    BitWriter w{out};
+    // A single final block with the fixed codes
+    w.put(1, 1);
+    w.put(1, 2);
+    const size_t n = data.size();
+    for (size_t i = 0; i < n;) {
+        size_t length = 0;
+        if (i > 0) {
+            while (length < 258 && i + length < n && data[i + length] == data[i - 1]) length++;
+        }
+        if (length >= 3) {
+            run(w, (int)length);
+            i += length;
+        } else {
+            symbol(w, data[i++]);
+        }
+    }
+    symbol(w, 256);
+    w.flush();
+    uint32_t a = 1, b = 0;
+    for (uint8_t c : data) {
+        a = (a + c) % 65521;
+        b = (b + a) % 65521;
+    }
+    const uint32_t adler = b << 16 | a;
+    for (int shift = 24; shift >= 0; shift -= 8) out.push_back((adler >> shift) & 0xFF);
+}
+
+static void chunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data) {
+    const uint32_t size = (uint32_t)data.size();
+    for (int shift = 24; shift >= 0; shift -= 8) out.push_back((size >> shift) & 0xFF);
+    const size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    const uint32_t crc = crc32(&out[start], out.size() - start);
+    for (int shift = 24; shift >= 0; shift -= 8) out.push_back((crc >> shift) & 0xFF);
+}
+
+void Png::encode(std::vector<uint8_t>& out, const uint8_t* rgb, int width, int height) {
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    out.assign(signature, signature + 8);
+
+    std::vector<uint8_t> header;
+    for (uint32_t v : {(uint32_t)width, (uint32_t)height}) {
+        for (int shift = 24; shift >= 0; shift -= 8) header.push_back((v >> shift) & 0xFF);
+    }
+    // 8 bit rgb, deflate, adaptive filters, no interlace
+    header.insert(header.end(), {8, 2, 0, 0, 0});
+    chunk(out, "IHDR", header);
+
+    // Sub filter, every byte less the one of the pixel before
+    const size_t stride = (size_t)width * 3;
+    std::vector<uint8_t> filtered(height * (stride + 1));
+    for (int y = 0; y < height; y++) {
+        const uint8_t* row = rgb + y * stride;
+        uint8_t* f = &filtered[y * (stride + 1)];
+        f[0] = 1;
+        for (size_t x = 0; x < stride; x++) f[1 + x] = row[x] - (x >= 3 ? row[x - 3] : 0);
+    }
+    std::vector<uint8_t> compressed;
+    deflate(compressed, filtered);
+    chunk(out, "IDAT", compressed);
+    chunk(out, "IEND", {});
+}
+
+bool Png::save(const char* path, const uint8_t* rgb, int width, int height) {
+    std::vector<uint8_t> png;
+    encode(png, rgb, width, height);
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    const bool written = fwrite(png.data(), 1, png.size(), f) == png.size();
+    return fclose(f) == 0 && written;
+}
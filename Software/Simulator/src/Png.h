@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// PNG images of rgb pixels without zlib. Every row gets the Sub filter, so
+// an even background turns into runs of zero bytes, and the deflate stream
+// has fixed Huffman codes with matches at distance 1 only, a run-length
+// coder. Renders of the cube are mostly background and shrink a lot, noisy
+// images come out a little larger than raw.
+//
+// std::vector<uint8_t> png;
+// Png::encode(png, rgb, 1920, 1080);
+class Png {
+public:
+    // Encode width x height rgb pixels, rows from the top, into out
+    static void encode(std::vector<uint8_t>& out, const uint8_t* rgb, int width, int height);
+    static bool save(const char* path, const uint8_t* rgb, int width, int height);
+};
@@ -8,11 +8,174 @@
 #endif
 #include <GL/gl.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
+#include <cstring>
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+// OpenGL 3.1 entry points and enums, gl.h only declares OpenGL 1.1 on Windows
+namespace gl {
+const GLenum VERTEX_SHADER = 0x8B31;
+const GLenum FRAGMENT_SHADER = 0x8B30;
+const GLenum COMPILE_STATUS = 0x8B81;
+const GLenum LINK_STATUS = 0x8B82;
+const GLenum ARRAY_BUFFER = 0x8892;
+const GLenum STATIC_DRAW = 0x88E4;
+const GLenum TEXTURE_3D = 0x806F;
+const GLenum RGB8 = 0x8051;
+const GLenum TEXTURE0 = 0x84C0;
+const GLenum TEXTURE_WRAP_R = 0x8072;
+const GLenum CLAMP_TO_EDGE = 0x812F;
+const GLenum PIXEL_UNPACK_BUFFER = 0x88EC;
+const GLenum STREAM_DRAW = 0x88E0;
+const GLbitfield MAP_WRITE_BIT = 0x0002;
+const GLbitfield MAP_INVALIDATE_BUFFER_BIT = 0x0008;
+const GLenum FRAMEBUFFER = 0x8D40;
+const GLenum RENDERBUFFER = 0x8D41;
+const GLenum COLOR_ATTACHMENT0 = 0x8CE0;
+const GLenum DEPTH_ATTACHMENT = 0x8D00;
+const GLenum DEPTH_COMPONENT24 = 0x81A6;
+const GLenum FRAMEBUFFER_COMPLETE = 0x8CD5;
+
+GLuint (APIENTRY* CreateShader)(GLenum);
+void (APIENTRY* ShaderSource)(GLuint, GLsizei, const char* const*, const GLint*);
+void (APIENTRY* CompileShader)(GLuint);
+void (APIENTRY* GetShaderiv)(GLuint, GLenum, GLint*);
+void (APIENTRY* GetShaderInfoLog)(GLuint, GLsizei, GLsizei*, char*);
+void (APIENTRY* DeleteShader)(GLuint);
+GLuint (APIENTRY* CreateProgram)();
+void (APIENTRY* AttachShader)(GLuint, GLuint);
+void (APIENTRY* BindAttribLocation)(GLuint, GLuint, const char*);
+void (APIENTRY* LinkProgram)(GLuint);
+void (APIENTRY* GetProgramiv)(GLuint, GLenum, GLint*);
+void (APIENTRY* UseProgram)(GLuint);
+void (APIENTRY* DeleteProgram)(GLuint);
+GLint (APIENTRY* GetUniformLocation)(GLuint, const char*);
+void (APIENTRY* Uniform1i)(GLint, GLint);
+void (APIENTRY* Uniform1f)(GLint, GLfloat);
+void (APIENTRY* UniformMatrix4fv)(GLint, GLsizei, GLboolean, const GLfloat*);
+void (APIENTRY* GenVertexArrays)(GLsizei, GLuint*);
+void (APIENTRY* BindVertexArray)(GLuint);
+void (APIENTRY* DeleteVertexArrays)(GLsizei, const GLuint*);
+void (APIENTRY* GenBuffers)(GLsizei, GLuint*);
+void (APIENTRY* BindBuffer)(GLenum, GLuint);
+void (APIENTRY* BufferData)(GLenum, ptrdiff_t, const void*, GLenum);
+void (APIENTRY* DeleteBuffers)(GLsizei, const GLuint*);
+void* (APIENTRY* MapBufferRange)(GLenum, ptrdiff_t, ptrdiff_t, GLbitfield);
+GLboolean (APIENTRY* UnmapBuffer)(GLenum);
+void (APIENTRY* VertexAttribPointer)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*);
+void (APIENTRY* EnableVertexAttribArray)(GLuint);
+void (APIENTRY* DrawArraysInstanced)(GLenum, GLint, GLsizei, GLsizei);
+void (APIENTRY* TexImage3D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*);
+void (APIENTRY* TexSubImage3D)(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void*);
+void (APIENTRY* ActiveTexture)(GLenum);
+void (APIENTRY* GenFramebuffers)(GLsizei, GLuint*);
+void (APIENTRY* BindFramebuffer)(GLenum, GLuint);
+void (APIENTRY* DeleteFramebuffers)(GLsizei, const GLuint*);
+void (APIENTRY* GenRenderbuffers)(GLsizei, GLuint*);
+void (APIENTRY* BindRenderbuffer)(GLenum, GLuint);
+void (APIENTRY* DeleteRenderbuffers)(GLsizei, const GLuint*);
+void (APIENTRY* RenderbufferStorage)(GLenum, GLenum, GLsizei, GLsizei);
+void (APIENTRY* FramebufferRenderbuffer)(GLenum, GLenum, GLenum, GLuint);
+GLenum (APIENTRY* CheckFramebufferStatus)(GLenum);
+}
+
+// The voxel of an instance comes from gl_InstanceID, its color from the 3D
+// texture in [x][y][z] order, blended with the frame before it by blend8()
+// of Color::blend on the bytes. Voxels too dim to see are moved outside the
+// clip volume, their triangles are dropped before rasterization.
+static const char* vertexShader = R"(#version 140
+uniform mat4 projection;
+uniform mat4 modelview;
+uniform sampler3D colors;
+uniform sampler3D previous;
+uniform float blur;
+uniform float brightness;
+in vec3 position;
+out vec3 color;
+void main() {
+    ivec3 voxel = ivec3(gl_InstanceID >> 8, (gl_InstanceID >> 4) & 15, gl_InstanceID & 15);
+    vec3 a = floor(texelFetch(colors, voxel.zyx, 0).rgb * 255.0 + 0.5);
+    vec3 b = floor(texelFetch(previous, voxel.zyx, 0).rgb * 255.0 + 0.5);
+    color = floor((a * (256.0 - blur) + b * (blur + 1.0)) / 256.0) / 255.0 * brightness;
+    if (max(color.r, max(color.g, color.b)) < 0.01) {
+        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+        return;
+    }
+    gl_Position = projection * modelview * vec4(position + vec3(voxel) - 7.5, 1.0);
+}
+)";
+
+static const char* fragmentShader = R"(#version 140
+in vec3 color;
+out vec4 fragment;
+void main() {
+    fragment = vec4(color, 1.0);
+}
+)";
+
+// A triangle over the whole screen, with the ray of every corner from the
+// near to the far plane. The homogeneous ends interpolate linearly.
+static const char* raymarchVertexShader = R"(#version 140
+uniform mat4 projection;
+uniform mat4 modelview;
+out vec4 near;
+out vec4 far;
+void main() {
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2) * 2.0 - 1.0;
+    mat4 unproject = inverse(projection * modelview);
+    near = unproject * vec4(corner, -1.0, 1.0);
+    far = unproject * vec4(corner, 1.0, 1.0);
+    gl_Position = vec4(corner, 0.0, 1.0);
+}
+)";
+
+// Fixed steps through the cube whatever is lit. The 3D textures are filtered
+// between LEDs and blended, every sample glows with a gaussian of its
+// distance to the nearest LED, normalized so a ray through an LED sees about
+// its color.
+static const char* raymarchFragmentShader = R"(#version 140
+uniform sampler3D colors;
+uniform sampler3D previous;
+uniform float blur;
+uniform float brightness;
+uniform float spread;
+in vec4 near;
+in vec4 far;
+out vec4 fragment;
+const float STEP = 0.125;
+void main() {
+    vec3 origin = near.xyz / near.w;
+    vec3 direction = normalize(far.xyz / far.w - origin);
+    vec3 t0 = (vec3(-8.0) - origin) / direction;
+    vec3 t1 = (vec3(8.0) - origin) / direction;
+    vec3 first = min(t0, t1);
+    vec3 last = max(t0, t1);
+    float enter = max(max(first.x, first.y), max(first.z, 0.0));
+    float leave = min(min(last.x, last.y), last.z);
+    vec3 glow = vec3(0.0);
+    for (float t = enter; t < leave; t += STEP) {
+        vec3 p = origin + direction * t;
+        vec3 led = p + 7.5 - floor(p + 8.0);
+        float weight = exp(-dot(led, led) / (spread * spread));
+        vec3 uvw = (p.zyx + 8.0) / 16.0;
+        glow += mix(texture(colors, uvw).rgb, texture(previous, uvw).rgb, (blur + 1.0) / 256.0) * weight;
+    }
+    fragment = vec4(glow * STEP / (spread * 1.7725) * brightness, 1.0);
+}
+)";
 
 // Static member definitions
 GLFWwindow* Renderer::window = nullptr;
+unsigned int Renderer::framebuffer = 0;
+unsigned int Renderer::renderbuffers[2] = {0, 0};
+int Renderer::offscreenWidth = 0;
+int Renderer::offscreenHeight = 0;
 float Renderer::cameraAngleX = 30.0f;
 float Renderer::cameraAngleY = 45.0f;
 float Renderer::cameraDistance = 40.0f;
@@ -22,6 +185,17 @@ bool Renderer::mousePressed = false;
 double Renderer::lastMouseX = 0.0;
 double Renderer::lastMouseY = 0.0;
 bool Renderer::keyStates[512] = {false};
+bool Renderer::instanced = false;
+unsigned int Renderer::program = 0;
+unsigned int Renderer::mesh = 0;
+unsigned int Renderer::vertices = 0;
+unsigned int Renderer::colors[2] = {0, 0};
+int Renderer::newest = 0;
+unsigned int Renderer::pixels = 0;
+uint8_t Renderer::blur = 0;
+bool Renderer::raymarch = false;
+float Renderer::spread = 0.35f;
+unsigned int Renderer::raymarchProgram = 0;
 
 bool Renderer::init(int width, int height) {
     if (!glfwInit()) {
@@ -50,16 +224,108 @@ bool Renderer::init(int width, int height) {
 
     lastTime = (float)glfwGetTime();
 
-    printf("MEGA CUBE Simulator\n");
+    instanced = initInstanced();
+
+    printf("MEGA CUBE Simulator (%s)\n", instanced ? "instanced" : "immediate mode");
     printf("Controls:\n");
     printf("  Left mouse drag: Rotate view\n");
     printf("  Scroll wheel: Zoom in/out\n");
+    if (instanced) {
+        printf("  V: Toggle raymarched LED glow\n");
+        printf("  [ ]: LED spread of the glow\n");
+    }
     printf("  ESC: Quit\n\n");
 
     return true;
 }
 
+bool Renderer::initOffscreen(int width, int height) {
+    if (!glfwInit()) {
+        fprintf(stderr, "Failed to initialize GLFW\n");
+        return false;
+    }
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    window = glfwCreateWindow(64, 64, "MEGA CUBE Simulator", nullptr, nullptr);
+    if (!window) {
+        fprintf(stderr, "Failed to create GLFW window\n");
+        glfwTerminate();
+        return false;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSwapInterval(0);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    lastTime = (float)glfwGetTime();
+
+    instanced = initInstanced();
+#define LOAD(name) (gl::name = (decltype(gl::name))glfwGetProcAddress("gl" #name)) &&
+    if (!instanced || !(LOAD(GenFramebuffers) LOAD(BindFramebuffer) LOAD(DeleteFramebuffers)
+                        LOAD(GenRenderbuffers) LOAD(BindRenderbuffer) LOAD(DeleteRenderbuffers)
+                        LOAD(RenderbufferStorage) LOAD(FramebufferRenderbuffer)
+                        LOAD(CheckFramebufferStatus) true)) {
+        fprintf(stderr, "Offscreen rendering needs OpenGL 3.1\n");
+        shutdown();
+        return false;
+    }
+#undef LOAD
+
+    gl::GenFramebuffers(1, &framebuffer);
+    gl::BindFramebuffer(gl::FRAMEBUFFER, framebuffer);
+    gl::GenRenderbuffers(2, renderbuffers);
+    gl::BindRenderbuffer(gl::RENDERBUFFER, renderbuffers[0]);
+    gl::RenderbufferStorage(gl::RENDERBUFFER, GL_RGBA8, width, height);
+    gl::FramebufferRenderbuffer(gl::FRAMEBUFFER, gl::COLOR_ATTACHMENT0, gl::RENDERBUFFER, renderbuffers[0]);
+    gl::BindRenderbuffer(gl::RENDERBUFFER, renderbuffers[1]);
+    gl::RenderbufferStorage(gl::RENDERBUFFER, gl::DEPTH_COMPONENT24, width, height);
+    gl::FramebufferRenderbuffer(gl::FRAMEBUFFER, gl::DEPTH_ATTACHMENT, gl::RENDERBUFFER, renderbuffers[1]);
+    gl::BindRenderbuffer(gl::RENDERBUFFER, 0);
+    if (gl::CheckFramebufferStatus(gl::FRAMEBUFFER) != gl::FRAMEBUFFER_COMPLETE) {
+        fprintf(stderr, "Offscreen framebuffer of %dx%d incomplete\n", width, height);
+        shutdown();
+        return false;
+    }
+    offscreenWidth = width;
+    offscreenHeight = height;
+    return true;
+}
+
+void Renderer::readPixels(uint8_t* rgb) {
+    const int w = offscreenWidth, h = offscreenHeight;
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, w, h, GL_RGB, GL_UNSIGNED_BYTE, rgb);
+    // GL rows start at the bottom
+    const size_t stride = (size_t)w * 3;
+    for (int y = 0; y < h / 2; y++) {
+        uint8_t* top = rgb + y * stride;
+        std::swap_ranges(top, top + stride, rgb + (h - 1 - y) * stride);
+    }
+}
+
+void Renderer::framebufferSize(int& width, int& height) {
+    if (framebuffer) {
+        width = offscreenWidth;
+        height = offscreenHeight;
+    } else {
+        glfwGetFramebufferSize(window, &width, &height);
+    }
+}
+
 void Renderer::shutdown() {
+    if (instanced) {
+        gl::DeleteProgram(program);
+        gl::DeleteProgram(raymarchProgram);
+        gl::DeleteVertexArrays(1, &mesh);
+        gl::DeleteBuffers(1, &vertices);
+        gl::DeleteBuffers(1, &pixels);
+        glDeleteTextures(2, colors);
+        instanced = false;
+    }
+    if (framebuffer) {
+        gl::DeleteFramebuffers(1, &framebuffer);
+        gl::DeleteRenderbuffers(2, renderbuffers);
+        framebuffer = 0;
+    }
     if (window) {
         glfwDestroyWindow(window);
         window = nullptr;
@@ -82,7 +348,7 @@ void Renderer::beginFrame() {
 
     // Get window size
     int width, height;
-    glfwGetFramebufferSize(window, &width, &height);
+    framebufferSize(width, height);
     glViewport(0, 0, width, height);
 
     // Clear
@@ -133,6 +399,19 @@ void Renderer::handleInput() {
     } else {
         mousePressed = false;
     }
+
+    if (instanced && wasKeyPressed(GLFW_KEY_V)) {
+        raymarch = !raymarch;
+        printf("Renderer: %s\n", raymarch ? "raymarch" : "instanced");
+    }
+    if (raymarch && wasKeyPressed(GLFW_KEY_LEFT_BRACKET)) {
+        spread = fmaxf(spread / 1.25f, 0.1f);
+        printf("LED spread: %.2f\n", spread);
+    }
+    if (raymarch && wasKeyPressed(GLFW_KEY_RIGHT_BRACKET)) {
+        spread = fminf(spread * 1.25f, 2.0f);
+        printf("LED spread: %.2f\n", spread);
+    }
 }
 
 void Renderer::mouseCallback(GLFWwindow* window, int button, int action, int mods) {
@@ -148,7 +427,7 @@ void Renderer::scrollCallback(GLFWwindow* window, double xoffset, double yoffset
 
 void Renderer::setupCamera() {
     int width, height;
-    glfwGetFramebufferSize(window, &width, &height);
+    framebufferSize(width, height);
     float aspect = (float)width / (float)height;
 
     // Projection matrix
@@ -202,7 +481,158 @@ void Renderer::setupCamera() {
     glTranslatef(-camX, -camY, -camZ);
 }
 
-void Renderer::renderCube(uint8_t cube[16][16][16][3], float brightness) {
+static GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = gl::CreateShader(type);
+    gl::ShaderSource(shader, 1, &source, nullptr);
+    gl::CompileShader(shader);
+    GLint ok = 0;
+    gl::GetShaderiv(shader, gl::COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[512];
+        gl::GetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        fprintf(stderr, "Shader: %s\n", log);
+        gl::DeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// Program of a vertex and fragment shader, 0 when either fails
+static GLuint linkProgram(const char* vertex, const char* fragment) {
+    GLuint vs = compileShader(gl::VERTEX_SHADER, vertex);
+    GLuint fs = compileShader(gl::FRAGMENT_SHADER, fragment);
+    if (!vs || !fs) {
+        if (vs) gl::DeleteShader(vs);
+        if (fs) gl::DeleteShader(fs);
+        return 0;
+    }
+    GLuint program = gl::CreateProgram();
+    gl::AttachShader(program, vs);
+    gl::AttachShader(program, fs);
+    gl::BindAttribLocation(program, 0, "position");
+    gl::LinkProgram(program);
+    gl::DeleteShader(vs);
+    gl::DeleteShader(fs);
+    GLint ok = 0;
+    gl::GetProgramiv(program, gl::LINK_STATUS, &ok);
+    if (!ok) {
+        gl::DeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+bool Renderer::initInstanced() {
+    if (glfwGetWindowAttrib(window, GLFW_CONTEXT_VERSION_MAJOR) * 10 +
+        glfwGetWindowAttrib(window, GLFW_CONTEXT_VERSION_MINOR) < 31) {
+        return false;
+    }
+#define LOAD(name) \
+    if (!(gl::name = (decltype(gl::name))glfwGetProcAddress("gl" #name))) return false;
+    LOAD(CreateShader) LOAD(ShaderSource) LOAD(CompileShader) LOAD(GetShaderiv)
+    LOAD(GetShaderInfoLog) LOAD(DeleteShader) LOAD(CreateProgram) LOAD(AttachShader)
+    LOAD(BindAttribLocation) LOAD(LinkProgram) LOAD(GetProgramiv) LOAD(UseProgram)
+    LOAD(DeleteProgram) LOAD(GetUniformLocation) LOAD(Uniform1i) LOAD(Uniform1f)
+    LOAD(UniformMatrix4fv) LOAD(GenVertexArrays) LOAD(BindVertexArray)
+    LOAD(DeleteVertexArrays) LOAD(GenBuffers) LOAD(BindBuffer) LOAD(BufferData)
+    LOAD(DeleteBuffers) LOAD(MapBufferRange) LOAD(UnmapBuffer)
+    LOAD(VertexAttribPointer) LOAD(EnableVertexAttribArray)
+    LOAD(DrawArraysInstanced) LOAD(TexImage3D) LOAD(TexSubImage3D) LOAD(ActiveTexture)
+#undef LOAD
+
+    program = linkProgram(vertexShader, fragmentShader);
+    if (!program) return false;
+    raymarchProgram = linkProgram(raymarchVertexShader, raymarchFragmentShader);
+    if (!raymarchProgram) {
+        gl::DeleteProgram(program);
+        return false;
+    }
+
+    // One cube of the LED size, 12 triangles
+    const float h = 0.2f;
+    const float corners[8][3] = {
+        {-h, -h, -h}, { h, -h, -h}, { h,  h, -h}, {-h,  h, -h},
+        {-h, -h,  h}, { h, -h,  h}, { h,  h,  h}, {-h,  h,  h}
+    };
+    const uint8_t faces[36] = {
+        0, 2, 1, 0, 3, 2,  4, 5, 6, 4, 6, 7,  0, 1, 5, 0, 5, 4,
+        3, 6, 2, 3, 7, 6,  0, 4, 7, 0, 7, 3,  1, 2, 6, 1, 6, 5
+    };
+    float triangles[36][3];
+    for (int i = 0; i < 36; i++) {
+        for (int j = 0; j < 3; j++) triangles[i][j] = corners[faces[i]][j];
+    }
+    gl::GenVertexArrays(1, &mesh);
+    gl::BindVertexArray(mesh);
+    gl::GenBuffers(1, &vertices);
+    gl::BindBuffer(gl::ARRAY_BUFFER, vertices);
+    gl::BufferData(gl::ARRAY_BUFFER, sizeof(triangles), triangles, gl::STATIC_DRAW);
+    gl::VertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    gl::EnableVertexAttribArray(0);
+    gl::BindVertexArray(0);
+
+    // Width is z, height y and depth x, the memory order of the cube buffer
+    static const uint8_t black[16][16][16][3] = {};
+    glGenTextures(2, colors);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (GLuint texture : colors) {
+        glBindTexture(gl::TEXTURE_3D, texture);
+        // Filtered for the raymarch, the instances fetch single texels
+        glTexParameteri(gl::TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(gl::TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(gl::TEXTURE_3D, GL_TEXTURE_WRAP_S, gl::CLAMP_TO_EDGE);
+        glTexParameteri(gl::TEXTURE_3D, GL_TEXTURE_WRAP_T, gl::CLAMP_TO_EDGE);
+        glTexParameteri(gl::TEXTURE_3D, gl::TEXTURE_WRAP_R, gl::CLAMP_TO_EDGE);
+        gl::TexImage3D(gl::TEXTURE_3D, 0, gl::RGB8, 16, 16, 16, 0, GL_RGB, GL_UNSIGNED_BYTE, black);
+    }
+    glBindTexture(gl::TEXTURE_3D, 0);
+    // Mapped with the old contents invalidated, the driver hands out fresh
+    // memory while the GPU still reads the last frame
+    gl::GenBuffers(1, &pixels);
+    gl::BindBuffer(gl::PIXEL_UNPACK_BUFFER, pixels);
+    gl::BufferData(gl::PIXEL_UNPACK_BUFFER, sizeof(black), nullptr, gl::STREAM_DRAW);
+    gl::BindBuffer(gl::PIXEL_UNPACK_BUFFER, 0);
+
+    const GLuint programs[] = {program, raymarchProgram};
+    for (GLuint p : programs) {
+        gl::UseProgram(p);
+        gl::Uniform1i(gl::GetUniformLocation(p, "colors"), 0);
+        gl::Uniform1i(gl::GetUniformLocation(p, "previous"), 1);
+    }
+    gl::UseProgram(0);
+    return glGetError() == GL_NO_ERROR;
+}
+
+void Renderer::renderCube(const uint8_t cube[16][16][16][3], float brightness) {
+    renderCube(cube, 0, brightness);
+}
+
+// The frames of the immediate mode fallback, blended on the CPU
+static uint8_t previousFrame[16][16][16][3];
+static uint8_t blendedFrame[16][16][16][3];
+
+void Renderer::renderCube(const uint8_t frame[16][16][16][3], uint8_t motionBlur, float brightness) {
+    if (instanced) {
+        if (frame) {
+            upload(frame);
+            blur = motionBlur;
+        }
+        renderInstanced(brightness);
+        drawOutline();
+        return;
+    }
+
+    if (frame) {
+        const uint8_t* a = &frame[0][0][0][0];
+        uint8_t* b = &previousFrame[0][0][0][0];
+        uint8_t* out = &blendedFrame[0][0][0][0];
+        for (size_t i = 0; i < sizeof(blendedFrame); i++) {
+            out[i] = (uint8_t)((a[i] * (256 - motionBlur) + b[i] * (motionBlur + 1)) >> 8);
+        }
+        memcpy(previousFrame, frame, sizeof(previousFrame));
+    }
+    const uint8_t (*cube)[16][16][3] = blendedFrame;
+
     const float voxelSize = 0.4f;  // Size of each LED
     const float spacing = 1.0f;    // Spacing between LEDs
     const float offset = 7.5f;     // Center offset
@@ -225,7 +655,73 @@ void Renderer::renderCube(uint8_t cube[16][16][16][3], float brightness) {
             }
         }
     }
+    drawOutline();
+}
+
+// All voxels in a single copy into the pixel buffer, the texture is filled
+// from it by the GPU. The frame before stays in the other texture.
+void Renderer::upload(const uint8_t cube[16][16][16][3]) {
+    const size_t size = 16 * 16 * 16 * 3;
+    newest ^= 1;
+    glBindTexture(gl::TEXTURE_3D, colors[newest]);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    gl::BindBuffer(gl::PIXEL_UNPACK_BUFFER, pixels);
+    void* mapped = gl::MapBufferRange(gl::PIXEL_UNPACK_BUFFER, 0, size,
+                                      gl::MAP_WRITE_BIT | gl::MAP_INVALIDATE_BUFFER_BIT);
+    if (mapped) {
+        memcpy(mapped, cube, size);
+        gl::UnmapBuffer(gl::PIXEL_UNPACK_BUFFER);
+        gl::TexSubImage3D(gl::TEXTURE_3D, 0, 0, 0, 0, 16, 16, 16, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+        gl::BindBuffer(gl::PIXEL_UNPACK_BUFFER, 0);
+    } else {
+        gl::BindBuffer(gl::PIXEL_UNPACK_BUFFER, 0);
+        gl::TexSubImage3D(gl::TEXTURE_3D, 0, 0, 0, 0, 16, 16, 16, GL_RGB, GL_UNSIGNED_BYTE, cube);
+    }
+    glBindTexture(gl::TEXTURE_3D, 0);
+}
+
+void Renderer::renderInstanced(float brightness) {
+    // The camera of setupCamera() from the fixed function matrices
+    GLfloat projection[16], modelview[16];
+    glGetFloatv(GL_PROJECTION_MATRIX, projection);
+    glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+
+    gl::ActiveTexture(gl::TEXTURE0 + 1);
+    glBindTexture(gl::TEXTURE_3D, colors[newest ^ 1]);
+    gl::ActiveTexture(gl::TEXTURE0);
+    glBindTexture(gl::TEXTURE_3D, colors[newest]);
+
+    const GLuint active = raymarch ? raymarchProgram : program;
+    gl::UseProgram(active);
+    gl::UniformMatrix4fv(gl::GetUniformLocation(active, "projection"), 1, GL_FALSE, projection);
+    gl::UniformMatrix4fv(gl::GetUniformLocation(active, "modelview"), 1, GL_FALSE, modelview);
+    gl::Uniform1f(gl::GetUniformLocation(active, "brightness"), brightness);
+    gl::Uniform1f(gl::GetUniformLocation(active, "blur"), blur);
+    gl::BindVertexArray(mesh);
+    if (raymarch) {
+        renderRaymarch();
+    } else {
+        gl::DrawArraysInstanced(GL_TRIANGLES, 0, 36, 16 * 16 * 16);
+    }
+    gl::BindVertexArray(0);
+    gl::UseProgram(0);
+    glBindTexture(gl::TEXTURE_3D, 0);
+    gl::ActiveTexture(gl::TEXTURE0 + 1);
+    glBindTexture(gl::TEXTURE_3D, 0);
+    gl::ActiveTexture(gl::TEXTURE0);
+}
+
+void Renderer::renderRaymarch() {
+    gl::Uniform1f(gl::GetUniformLocation(raymarchProgram, "spread"), spread);
+    // Added to the background, the outline is drawn on top
+    glDisable(GL_DEPTH_TEST);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_DEPTH_TEST);
+}
 
+void Renderer::drawOutline() {
     // Draw wireframe outline of the cube
     glColor4f(0.3f, 0.3f, 0.3f, 0.5f);
     glBegin(GL_LINES);
@@ -8,13 +8,22 @@ struct GLFWwindow;
 class Renderer {
 public:
     static bool init(int width = 1280, int height = 720);
+    // Render to a framebuffer object of width x height behind a hidden
+    // window, as fast as the machine allows, needs OpenGL 3.1
+    static bool initOffscreen(int width, int height);
+    // Pixels of the offscreen frame, rgb rows from the top
+    static void readPixels(uint8_t* rgb);
     static void shutdown();
     static bool shouldClose();
     static void beginFrame();
     static void endFrame();
 
-    // Render the cube buffer
-    static void renderCube(uint8_t cube[16][16][16][3], float brightness = 1.0f);
+    // Render the cube buffer, instanced when the context has OpenGL 3.1
+    static void renderCube(const uint8_t cube[16][16][16][3], float brightness = 1.0f);
+    // Render a frame before motion blur, the GPU blends it with the frame
+    // uploaded before it like Color::blend(blur) does. nullptr shows the last
+    // frame again without uploading anything.
+    static void renderCube(const uint8_t cube[16][16][16][3], uint8_t blur, float brightness);
 
     // Camera control
     static void handleInput();
@@ -30,6 +39,11 @@ public:
 
 private:
     static GLFWwindow* window;
+    // Offscreen framebuffer with its color and depth attachments
+    static unsigned int framebuffer;
+    static unsigned int renderbuffers[2];
+    static int offscreenWidth, offscreenHeight;
+    static void framebufferSize(int& width, int& height);
     static bool keyStates[512];
     static float cameraAngleX;
     static float cameraAngleY;
@@ -39,6 +53,29 @@ private:
     static bool mousePressed;
     static double lastMouseX, lastMouseY;
 
+    // Instanced path: a cube mesh drawn 4096 times, colors in a 3D texture
+    static bool instanced;
+    static unsigned int program;
+    static unsigned int mesh;
+    static unsigned int vertices;
+    // The last two frames uploaded, newest is the index of the last one.
+    // They go through a pixel buffer mapped for a single copy per frame.
+    static unsigned int colors[2];
+    static int newest;
+    static unsigned int pixels;
+    static uint8_t blur;
+    // Raymarch path: a fullscreen pass through the 3D texture, LEDs glow
+    // with a gaussian of radius spread
+    static bool raymarch;
+    static float spread;
+    static unsigned int raymarchProgram;
+    static bool initInstanced();
+    static void upload(const uint8_t cube[16][16][16][3]);
+    static void renderInstanced(float brightness);
+    static void renderRaymarch();
+    static void drawOutline();
+
+    // Immediate mode fallback for contexts before OpenGL 3.1
     static void drawVoxel(float x, float y, float z, float r, float g, float b, float size);
     static void setupCamera();
     static void mouseCallback(GLFWwindow* window, int button, int action, int mods);
@@ -0,0 +1,122 @@
+#include "Sequence.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(Color) == 3, "cube buffers are exported as r, g, b bytes");
+
+SequenceWriter::SequenceWriter() { clear(); }
+
+void SequenceWriter::clear() {
+    voxel_file_t header = {};
+    header.magic = VOXEL_FILE_MAGIC;
+    header.version = VOXEL_FILE_VERSION;
+    header.header_size = sizeof(header);
+    header.keyframe_interval = VOXEL_FILE_KEYFRAME;
+    header.index_interval = 1;
+    bytes.assign((const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+    offsets.clear();
+    memset(previous, 0, sizeof(previous));
+    finished = false;
+}
+
+void SequenceWriter::add(const Color* cube, uint16_t duration, uint8_t motionBlur) {
+    // Drop the index of an earlier finish()
+    if (finished) {
+        const voxel_file_t* header = (const voxel_file_t*)bytes.data();
+        bytes.resize(header->index_offset);
+        finished = false;
+    }
+    const uint32_t n = frames();
+    const uint8_t* rgb = (const uint8_t*)cube;
+    const uint16_t size = encoder.encode(frame, rgb, previous, (uint16_t)n,
+                                         n % VOXEL_FILE_KEYFRAME == 0, duration,
+                                         motionBlur);
+    offsets.push_back((uint32_t)bytes.size());
+    bytes.insert(bytes.end(), frame, frame + size);
+    memcpy(previous, rgb, sizeof(previous));
+}
+
+const std::vector<uint8_t>& SequenceWriter::finish() {
+    if (finished) return bytes;
+    voxel_file_t header;
+    memcpy(&header, bytes.data(), sizeof(header));
+    header.frames = frames();
+    header.index_offset = (uint32_t)bytes.size();
+    header.index_count = frames();
+    memcpy(bytes.data(), &header, sizeof(header));
+    const uint8_t* index = (const uint8_t*)offsets.data();
+    bytes.insert(bytes.end(), index, index + offsets.size() * sizeof(uint32_t));
+    finished = true;
+    return bytes;
+}
+
+bool SequenceWriter::save(const char* path) {
+    const std::vector<uint8_t>& file = finish();
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    const bool written = fwrite(file.data(), 1, file.size(), f) == file.size();
+    return fclose(f) == 0 && written;
+}
+
+#ifdef _WIN32
+bool SequenceMap::open(const char* path) {
+    close();
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                       FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        file = nullptr;
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) bytes = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        length = bytes ? (size_t)size.QuadPart : 0;
+    }
+    if (!bytes) close();
+    return bytes != nullptr;
+}
+
+void SequenceMap::close() {
+    if (bytes) UnmapViewOfFile(bytes);
+    if (mapping) CloseHandle(mapping);
+    if (file) CloseHandle(file);
+    bytes = nullptr;
+    mapping = nullptr;
+    file = nullptr;
+    length = 0;
+}
+#else
+bool SequenceMap::open(const char* path) {
+    close();
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            bytes = (const uint8_t*)p;
+            length = (size_t)st.st_size;
+        }
+    }
+    // The mapping stays valid without the descriptor
+    ::close(fd);
+    return bytes != nullptr;
+}
+
+void SequenceMap::close() {
+    if (bytes) munmap((void*)bytes, length);
+    bytes = nullptr;
+    length = 0;
+}
+#endif
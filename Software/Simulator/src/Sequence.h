@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "power/VoxelFile.h"
+
+// Voxel files (power/VoxelFile.h) of the simulator, the same format the cube
+// records to its SD card and plays back.
+//
+// SequenceWriter exports frames with an offset of every frame in the index,
+// so any frame can be found without walking the file. SequenceMap maps a
+// file read-only, VoxelFile then decodes straight from the mapped pages.
+class SequenceWriter {
+public:
+    SequenceWriter();
+
+    // Start a new sequence
+    void clear();
+    // Append a frame of 4096 voxels in [x][y][z] order, duration in ms
+    void add(const Color* cube, uint16_t duration, uint8_t motionBlur);
+    uint32_t frames() const { return (uint32_t)offsets.size(); }
+    // The whole file with header and index, valid until the next add()
+    const std::vector<uint8_t>& finish();
+    bool save(const char* path);
+
+private:
+    std::vector<uint8_t> bytes;
+    std::vector<uint32_t> offsets;
+    uint8_t previous[VOXELS_COUNT * 3];
+    uint8_t frame[VOXEL_FILE_FRAME_MAX];
+    VoxelEncoder encoder;
+    bool finished = false;
+};
+
+class SequenceMap {
+public:
+    ~SequenceMap() { close(); }
+
+    bool open(const char* path);
+    void close();
+    const uint8_t* data() const { return bytes; }
+    size_t size() const { return length; }
+
+private:
+    const uint8_t* bytes = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    void* file = nullptr;
+    void* mapping = nullptr;
+#endif
+};
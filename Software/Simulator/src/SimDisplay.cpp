@@ -1,18 +1,19 @@
 #include "SimDisplay.h"
 #include <cmath>
 
-// Static member definitions
-Color Display::cube[2][16][16][16];
-uint32_t Display::cubeBuffer = 0;
-uint8_t Display::rawBuffer[16][16][16][3];
+// Static member definitions, one set per thread
+thread_local Color Display::cube[2][16][16][16];
+thread_local uint32_t Display::cubeBuffer = 0;
+thread_local uint8_t Display::rawBuffer[16][16][16][3];
 
-SimConfig simConfig;
+thread_local SimConfig simConfig;
 
 // Global noise generator
 Noise noise;
 
+// Both buffers, the first frame must not blur with what the thread ran before
 void Display::begin() {
-    clear();
+    memset(cube, 0, sizeof(cube));
     cubeBuffer = 0;
 }
 
@@ -35,7 +36,10 @@ void Display::update() {
         }
     }
 
-    // Swap buffers
+    swap();
+}
+
+void Display::swap() {
     cubeBuffer = 1 - cubeBuffer;
     clear();
 }
@@ -12,7 +12,8 @@
 
 // Simulator version of the Display class
 // Provides the same interface as the real Display for LED cube
-// but renders to an OpenGL window instead
+// but renders to an OpenGL window instead. Every thread has a cube and
+// config of its own, so the benchmark runs animations side by side.
 
 class Display {
 public:
@@ -21,18 +22,21 @@ public:
     static const int depth = 16;
 
     // Double-buffered cube (same as real Display)
-    static Color cube[2][width][height][depth];
-    static uint32_t cubeBuffer;
+    static thread_local Color cube[2][width][height][depth];
+    static thread_local uint32_t cubeBuffer;
 
     static void begin();
     static void update();
     static void clear();
+    // Swap and clear without the blend into the raw buffer, for a renderer
+    // that blends on the GPU (Renderer::renderCube with blur)
+    static void swap();
 
     // Get raw buffer for rendering
     static uint8_t* getRawBuffer();
 
 private:
-    static uint8_t rawBuffer[16][16][16][3];  // For renderer
+    static thread_local uint8_t rawBuffer[16][16][16][3];  // For renderer
 };
 
 // Global config stub (simplified for simulator)
@@ -47,11 +51,15 @@ struct SimConfig {
     } animation;
 };
 
-extern SimConfig simConfig;
+extern thread_local SimConfig simConfig;
 
 // Global noise generator (same as real cube)
 extern Noise noise;
 
+// rand() of the demos, from the noise generator of the thread so parallel
+// runs repeat
+inline int simRand() { return (int)(Noise::next32() >> 1); }
+
 // Define the center of the physical cube coordinates (matching Graphics.h)
 #define CX 7.5f
 #define CY 7.5f
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Lock free hand over of whole frames from one writer to one reader thread.
+// The writer fills back() and publishes it, the reader takes the newest
+// published buffer from front(). Neither side ever waits, a reader that is
+// slower than the writer skips frames and a faster one sees the same frame
+// again.
+//
+//     TripleBuffer<Frame> frames;
+//     writer: draw(frames.back()); frames.publish();
+//     reader: show(frames.front());
+template <typename T>
+class TripleBuffer {
+public:
+    // Buffer being written, owned by the writer until publish()
+    T& back() { return buffers[backIndex]; }
+
+    // Swap the written buffer with the middle one and mark it fresh
+    void publish() {
+        backIndex = middle.exchange(backIndex | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // True when a buffer was published since the last front()
+    bool fresh() const { return middle.load(std::memory_order_acquire) & FRESH; }
+
+    // Newest published buffer, owned by the reader until the next front()
+    const T& front() {
+        if (fresh()) {
+            frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX;
+        }
+        return buffers[frontIndex];
+    }
+
+private:
+    static const uint8_t INDEX = 3;
+    static const uint8_t FRESH = 4;
+
+    T buffers[3] = {};
+    // Index of the buffer between writer and reader, with the FRESH bit
+    std::atomic<uint8_t> middle{1};
+    uint8_t backIndex = 0;
+    uint8_t frontIndex = 2;
+};
@@ -0,0 +1,176 @@
+#include "VirtualCube.h"
+
+#include <Arduino.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "core/Voxels.h"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#define closesocket_ closesocket
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define closesocket_ ::close
+#endif
+
+// A socket bound to port on all interfaces, -1 when it is taken
+template <typename T>
+static T bound(int type, uint16_t port) {
+    const T s = (T)socket(AF_INET, type, 0);
+    if (s == (T)-1) return s;
+    const int on = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char*)&on, sizeof(on));
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (bind(s, (const sockaddr*)&address, sizeof(address)) != 0 ||
+        (type == SOCK_STREAM && listen(s, 1) != 0)) {
+        closesocket_(s);
+        return (T)-1;
+    }
+    return s;
+}
+
+bool VirtualCube::start(uint16_t udpPort, uint16_t tcpPort) {
+    stop();
+#ifdef _WIN32
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) return false;
+#endif
+    udp = bound<socket_t>(SOCK_DGRAM, udpPort);
+    listener = bound<socket_t>(SOCK_STREAM, tcpPort);
+    if (udp == (socket_t)-1 || listener == (socket_t)-1) {
+        stop();
+        return false;
+    }
+    // A stream faster than the display must not overflow the socket
+    const int room = 1 << 20;
+    setsockopt(udp, SOL_SOCKET, SO_RCVBUF, (const char*)&room, sizeof(room));
+    running = true;
+    thread = std::thread(&VirtualCube::run, this);
+    return true;
+}
+
+void VirtualCube::stop() {
+    running = false;
+    if (thread.joinable()) thread.join();
+    for (socket_t* s : {&udp, &listener, &client}) {
+        if (*s != (socket_t)-1) closesocket_(*s);
+        *s = (socket_t)-1;
+    }
+}
+
+void VirtualCube::run() {
+    static uint8_t datagram[65536];
+    uint8_t received[4096];
+    uint32_t second = micros();
+    while (running) {
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(udp, &readable);
+        FD_SET(listener, &readable);
+        socket_t highest = udp > listener ? udp : listener;
+        if (client != (socket_t)-1) {
+            FD_SET(client, &readable);
+            if (client > highest) highest = client;
+        }
+        timeval timeout = {0, 100000};
+        if (select((int)highest + 1, &readable, nullptr, nullptr, &timeout) > 0) {
+            // Drain the voxel stream first, like the ESP8266 does
+            if (FD_ISSET(udp, &readable)) {
+                const long n = (long)recv(udp, (char*)datagram, sizeof(datagram), 0);
+                if (n > 0 && n <= FRAME_MAX) receive(datagram, (uint16_t)n);
+            }
+            // A new connection replaces the one before
+            if (FD_ISSET(listener, &readable)) {
+                const socket_t s = (socket_t)accept(listener, nullptr, nullptr);
+                if (s != (socket_t)-1) {
+                    if (client != (socket_t)-1) closesocket_(client);
+                    client = s;
+                    errors += parser.errors();
+                    parser = Frame();
+                    const int on = 1;
+                    setsockopt(client, IPPROTO_TCP, TCP_NODELAY, (const char*)&on, sizeof(on));
+                    printf("Virtual cube: client connected\n");
+                }
+            } else if (client != (socket_t)-1 && FD_ISSET(client, &readable)) {
+                const long n = (long)recv(client, (char*)received, sizeof(received), 0);
+                if (n <= 0) {
+                    closesocket_(client);
+                    client = (socket_t)-1;
+                    errors += parser.errors();
+                    parser = Frame();
+                    printf("Virtual cube: client gone\n");
+                }
+                for (long i = 0; i < n; i++) {
+                    if (parser.feed(received[i]) == Frame::FRAME &&
+                        parser.type() == frame_t::VOXELS) {
+                        receive(parser.payload(), parser.size());
+                    }
+                }
+            }
+        }
+        const uint32_t elapsed = micros() - second;
+        if (elapsed >= 1000000) {
+            report(elapsed / 1e6f);
+            second += elapsed;
+        }
+    }
+}
+
+void VirtualCube::receive(const uint8_t* chunk, uint16_t size) {
+    chunks++;
+    bytes += size;
+    const uint16_t before = Voxels::sequence();
+    const uint32_t complete = Voxels::completed;
+    const uint32_t start = micros();
+    Voxels::receive(chunk, size);
+    const uint32_t now = micros();
+    decoding += now - start;
+    if (Voxels::completed == complete) return;
+
+    // The frames between two complete ones never made it, a sequence that
+    // went back is a restarted source
+    const uint16_t gap = Voxels::sequence() - before;
+    if (complete && gap > 1 && gap < 0x8000) lost += gap - 1;
+    decode.add(decoding);
+    decoding = 0;
+    if (complete) {
+        const uint32_t time = now - lastFrame;
+        if (interval) jitter.add(time > interval ? time - interval : interval - time);
+        interval = time;
+    }
+    lastFrame = now;
+    memcpy(frames.back().voxels, Voxels::frame(), sizeof(Cube::voxels));
+    frames.publish();
+}
+
+void VirtualCube::report(float seconds) {
+    const uint32_t complete = Voxels::completed - completed;
+    const uint32_t abandoned = Voxels::dropped - dropped;
+    const uint32_t parsed = errors + parser.errors();
+    if (chunks) {
+        printf("Virtual cube: %.1f fps %.1f kB/s %u chunks, decode %u/%u/%u us "
+               "(avg/p99/max), jitter %u/%u us (avg/max), lost %u (%u incomplete), "
+               "link errors %u\n",
+               complete / seconds, bytes / seconds / 1000, chunks, decode.avg(),
+               decode.percentile(99), decode.max(), jitter.avg(), jitter.max(),
+               lost, abandoned, parsed - reported);
+    }
+    reported = parsed;
+    completed = Voxels::completed;
+    dropped = Voxels::dropped;
+    decode.reset();
+    jitter.reset();
+    chunks = bytes = lost = 0;
+}
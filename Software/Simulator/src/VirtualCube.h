@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "TripleBuffer.h"
+#include "core/Frame.h"
+#include "power/Color.h"
+#include "power/Histogram.h"
+#include "power/VoxelCodec.h"
+
+// A cube without hardware for the streaming protocols, it listens where the
+// ESP8266 does (WIFI Module/src/main.cpp): the voxel stream on udp port 7000,
+// one VOXELS chunk per datagram, and the link frames on tcp port 8000. The
+// tcp port carries the same units as the WebSocket of the browsers, so a
+// stream source is tested with either. The chunks are decoded by the
+// firmware's own core/Voxels.cpp, a complete frame goes to the render thread
+// through frames.
+//
+// Once a second it prints the frames completed, the decode time of a frame
+// (all its chunks), the jitter (change of the interval between complete
+// frames), the frames lost (sequence gaps and abandoned frames) and the link
+// frames the tcp parser dropped. Decoding runs on its own thread, a source
+// can be profiled at far higher rates than the link to the cube takes.
+//
+// VirtualCube cube;
+// if (cube.start(7000, 8000)) show(cube.frames.front().voxels);
+class VirtualCube {
+public:
+    struct Cube {
+        Color voxels[VOXELS_COUNT];
+    };
+    // The newest complete frame for the render thread
+    TripleBuffer<Cube> frames;
+
+    ~VirtualCube() { stop(); }
+
+    // Listen on both ports, false when one of them is taken
+    bool start(uint16_t udpPort, uint16_t tcpPort);
+    void stop();
+
+private:
+    std::thread thread;
+    std::atomic<bool> running{false};
+#ifdef _WIN32
+    typedef uintptr_t socket_t;
+#else
+    typedef int socket_t;
+#endif
+    socket_t udp = (socket_t)-1;
+    socket_t listener = (socket_t)-1;
+    socket_t client = (socket_t)-1;
+    Frame parser;
+
+    // Statistics since the last report, decode and jitter in microseconds
+    Histogram decode = Histogram(10);
+    Histogram jitter = Histogram(250);
+    uint32_t chunks = 0;
+    uint32_t bytes = 0;
+    uint32_t lost = 0;
+    uint32_t decoding = 0;
+    uint32_t completed = 0;
+    uint32_t dropped = 0;
+    // Frames dropped by the parsers of closed connections, all of them at
+    // the last report
+    uint32_t errors = 0;
+    uint32_t reported = 0;
+    uint32_t lastFrame = 0;
+    uint32_t interval = 0;
+
+    void run();
+    void receive(const uint8_t* chunk, uint16_t size);
+    void report(float seconds);
+};
@@ -0,0 +1,209 @@
+/*
+ * MEGA CUBE Benchmark
+ *
+ * Headless performance baseline, steps every demo animation for a fixed
+ * amount of frames at a fixed dt without any OpenGL.
+ *
+ * Usage: cube_bench [frames] [dt] [threads]
+ *
+ * Reports per animation the time per frame (update and Display::update), the
+ * heap allocations made while stepping and a checksum of the displayed cube
+ * so behavioural changes show up next to performance changes. The Clock demo
+ * shows the wall clock, its checksum changes from run to run.
+ *
+ * Every run is also exported as a voxel file in memory (power/VoxelFile.h)
+ * and decoded again, in order and by seeking to the last frame. The size of
+ * the file is reported, a frame that does not decode to what was drawn fails
+ * the benchmark.
+ *
+ * The link fps is the frame rate the run could be streamed at over the
+ * 2 Mbaud ESP8266 link, as CubeLink encodes it.
+ *
+ * The animations are spread over a pool of threads, one per core unless
+ * threads says otherwise. Every thread has its own cube, config and random
+ * generator (SimDisplay.h), so the results match a serial run and come out
+ * in the same order. The wall time of the whole suite is reported last.
+ */
+
+#include "CubeLink.h"
+#include "Demo.h"
+#include "Sequence.h"
+#include "SimDisplay.h"
+#include "power/FastTrig.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+
+// Count heap allocations while benchmarking, per thread
+static thread_local size_t allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// Time of one sine and cosine pair with libm and with the FastTrig tables
+static void trig() {
+    const int n = 1000000;
+    volatile float sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        float a = i * 0.001f;
+        sink = sink + sinf(a) + cosf(a);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        float a = i * 0.001f, s, c;
+        fsincos(a, s, c);
+        sink = sink + s + c;
+    }
+    auto end = std::chrono::steady_clock::now();
+    printf("%-24s %12.1f\n", "sinf + cosf (ns)",
+           std::chrono::duration<double, std::nano>(middle - start).count() / n);
+    printf("%-24s %12.1f\n", "fsincos (ns)",
+           std::chrono::duration<double, std::nano>(end - middle).count() / n);
+}
+
+// FNV-1a over the rendered (motion blurred) cube
+static uint32_t checksum(uint32_t hash, const uint8_t* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Result of one animation, a row of the table
+struct Result {
+    double ns = 0;
+    size_t allocations = 0;
+    uint32_t hash = 0;
+    double linkFps = 0;
+    size_t fileBytes = 0;
+    bool valid = false;
+};
+
+// Buffers of a worker thread, too large for its stack
+struct Worker {
+    SequenceWriter exporter;
+    CubeLink streamer;
+    uint8_t stream[CubeLink::FRAME_BYTES_MAX];
+    Color decoded[VOXELS_COUNT];
+    Color last[VOXELS_COUNT];
+};
+
+static Result run(DemoAnimation* demo, Worker& w, int frames, float dt) {
+    // Same starting point for every run
+    Noise::seed(1);
+    Display::begin();
+    demo->init();
+
+    Result r;
+    allocations = 0;
+    uint32_t hash = 2166136261u;
+    double ns = 0;
+    size_t link = 0;
+    w.streamer.restart();
+    // Exported frames before motion blur, their allocations do not count
+    w.exporter.clear();
+    const uint16_t duration = (uint16_t)(dt * 1000 + 0.5f);
+    uint32_t drawn = 2166136261u;
+    size_t exporting = 0;
+    for (int f = 0; f < frames; f++) {
+        auto start = std::chrono::steady_clock::now();
+        demo->update(dt);
+        auto middle = std::chrono::steady_clock::now();
+        const Color* cube = &Display::cube[Display::cubeBuffer][0][0][0];
+        const size_t before = allocations;
+        w.exporter.add(cube, duration, simConfig.animation.motionBlur);
+        exporting += allocations - before;
+        drawn = checksum(drawn, (const uint8_t*)cube, sizeof(w.decoded));
+        auto resumed = std::chrono::steady_clock::now();
+        Display::update();
+        auto end = std::chrono::steady_clock::now();
+        ns += std::chrono::duration<double, std::nano>(end - resumed + middle - start).count();
+        const uint8_t* rgb = Display::getRawBuffer();
+        hash = checksum(hash, rgb, sizeof(w.decoded));
+        // Streamed over the 2 Mbaud link, 10 bits a byte
+        link += w.streamer.encode(w.stream, rgb);
+    }
+    r.allocations = allocations - exporting;
+
+    // Decode the file in order, then seek back to the last frame
+    const std::vector<uint8_t>& bytes = w.exporter.finish();
+    VoxelFile file;
+    uint32_t replayed = 2166136261u;
+    bool valid = file.open(bytes.data(), (uint32_t)bytes.size()) &&
+                 file.frames() == (uint32_t)frames;
+    for (int f = 0; valid && f < frames; f++) {
+        valid = file.decode(f, w.decoded);
+        replayed = checksum(replayed, (const uint8_t*)w.decoded, sizeof(w.decoded));
+    }
+    std::copy(w.decoded, w.decoded + VOXELS_COUNT, w.last);
+    r.valid = valid && file.decode(0, w.decoded) &&
+              file.decode(frames - 1, w.decoded) &&
+              !memcmp(w.last, w.decoded, sizeof(w.last)) && replayed == drawn;
+
+    r.ns = ns / frames;
+    r.hash = hash;
+    r.linkFps = 200000.0 * frames / link;
+    r.fileBytes = bytes.size();
+    return r;
+}
+
+int main(int argc, char** argv) {
+    const int frames = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const float dt = argc > 2 ? (float)std::atof(argv[2]) : 1.0f / 60.0f;
+    int threads = argc > 3 ? std::atoi(argv[3]) : (int)std::thread::hardware_concurrency();
+
+    std::vector<DemoAnimation*> demos = createDemos();
+    const int count = (int)demos.size();
+    threads = std::max(1, std::min(threads, count));
+    printf("%-24s %12s %8s %10s %10s %10s\n", "Animation", "ns/frame", "allocs",
+           "checksum", "link fps", "file KB");
+
+    // Every worker takes the next animation until none is left
+    std::vector<Result> results(count);
+    std::atomic<int> next{0};
+    auto work = [&]() {
+        std::unique_ptr<Worker> w(new Worker());
+        for (int i = next++; i < count; i = next++) {
+            results[i] = run(demos[i], *w, frames, dt);
+        }
+    };
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; t++) pool.emplace_back(work);
+    work();
+    for (std::thread& t : pool) t.join();
+    auto end = std::chrono::steady_clock::now();
+
+    bool failed = false;
+    double total = 0;
+    for (int i = 0; i < count; i++) {
+        const Result& r = results[i];
+        failed |= !r.valid;
+        total += r.ns;
+        printf("%-24s %12.0f %8zu   %08x %10.1f %10.1f%s\n", demos[i]->name(), r.ns,
+               r.allocations, r.hash, r.linkFps, r.fileBytes / 1024.0,
+               r.valid ? "" : " decode failed");
+    }
+    printf("%-24s %12.0f\n", "Total", total);
+    printf("%-24s %12.1f %d threads\n", "Wall time (ms)",
+           std::chrono::duration<double, std::milli>(end - start).count(), threads);
+    trig();
+
+    for (DemoAnimation* demo : demos) {
+        delete demo;
+    }
+    return failed ? 1 : 0;
+}
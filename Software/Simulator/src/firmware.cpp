@@ -0,0 +1,238 @@
+/*
+ * MEGA CUBE Firmware
+ *
+ * The animations of the cube as they are flashed: space/Animation.cpp, the
+ * animation headers and core/Display.cpp compile unchanged against the shims
+ * in this directory (Arduino.h and shim/ for DMAChannel, LittleFS, ArduinoJson
+ * and SdFat). Display transposes every frame into its dma buffers exactly as
+ * on the Teensy, the "transfer" to the leds completes right away.
+ *
+ * Usage: firmware_bench [frames] [dt] [op=cycles ...]
+ *        firmware_sim
+ *
+ * The benchmark runs every animation of the jump table for a fixed amount of
+ * frames at a fixed dt and reports the time of Animation::loop() per frame,
+ * the part of it spent transposing, the heap allocations and a checksum of
+ * the frames as they were transposed. An animation first runs 3 seconds
+ * unmeasured, so the one before it has ended.
+ *
+ * Built with COST_MODEL (cmake -DCOST_MODEL=ON) it also counts the operations
+ * of power/Cost.h and estimates the time of a frame on the Teensy from them,
+ * op=cycles arguments (e.g. noise4=700) change the cycle table. An animation
+ * whose estimate exceeds dt is reported and fails the benchmark. Calls of the
+ * libm sin and cos are counted by wrapping them at link time (GNU ld).
+ *
+ * Last come the transpose variants of core/Transpose.h. Their cycles are the
+ * host's time at 600 MHz, only the ratios between them carry over.
+ *
+ * The simulator shows the animations in real time.
+ *   Space / Right: Next animation
+ *   Left: Previous animation
+ *   ESC: Quit
+ */
+
+#include <Arduino.h>
+
+#include "FirmwareHost.h"
+#include "core/Config.h"
+#include "core/Display.h"
+#include "core/Transpose.h"
+#include "power/Cost.h"
+#include "power/Noise.h"
+#include "power/Timer.h"
+#include "space/Animation.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#ifndef CUBE_BENCH
+#include "Renderer.h"
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#endif
+
+#ifdef CUBE_BENCH
+//=============================================================================
+// Benchmark
+//=============================================================================
+// Count heap allocations while benchmarking
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+#if defined COST_MODEL
+// libm trigonometry, the linker sends the calls here (-Wl,--wrap=sinf ...)
+extern "C" {
+float __real_sinf(float x);
+float __real_cosf(float x);
+double __real_sin(double x);
+double __real_cos(double x);
+void __real_sincosf(float x, float* s, float* c);
+float __wrap_sinf(float x) {
+    COST(TRIG, 1);
+    return __real_sinf(x);
+}
+float __wrap_cosf(float x) {
+    COST(TRIG, 1);
+    return __real_cosf(x);
+}
+double __wrap_sin(double x) {
+    COST(TRIG, 1);
+    return __real_sin(x);
+}
+double __wrap_cos(double x) {
+    COST(TRIG, 1);
+    return __real_cos(x);
+}
+void __wrap_sincosf(float x, float* s, float* c) {
+    COST(TRIG, 2);
+    __real_sincosf(x, s, c);
+}
+}
+#endif
+
+// FNV-1a over the transposed (motion blurred) cube
+static uint32_t checksum(uint32_t hash, const uint8_t* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+int main(int argc, char** argv) {
+    const int frames = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const float dt = argc > 2 ? (float)std::atof(argv[2]) : 1.0f / 60.0f;
+    const int settle = (int)(3.0f / dt);
+#if defined COST_MODEL
+    for (int a = 3; a < argc; a++) {
+        const char* value = std::strchr(argv[a], '=');
+        std::string name(argv[a], value ? value - argv[a] : 0);
+        if (!value || !Cost::set(name.c_str(), (uint16_t)std::atoi(value + 1))) {
+            printf("Unknown cost %s\n", argv[a]);
+            return 1;
+        }
+    }
+    const float budget = dt * 1000000.0f;
+    bool failed = false;
+#endif
+
+    // Timers advance by exactly dt per frame, frames are not paced
+    Timer::setFixedStep(dt);
+    config.display.fps = 0;
+    Animation::begin();
+
+    printf("%-24s %12s %12s %8s %10s", "Animation", "ns/frame",
+           "transpose ns", "allocs", "checksum");
+#if defined COST_MODEL
+    printf(" %10s  %s", "teensy us", "dominant");
+#endif
+    printf("\n");
+    double total = 0;
+    for (uint16_t i = 0;; i++) {
+        const jump_item_t& item = Animation::get_item(i);
+        if (!item.object) break;
+        // Same starting point for every run
+        std::srand(1);
+        Noise::seed(1);
+        FirmwareHost::select(i);
+        for (int f = 0; f < settle; f++) FirmwareHost::frame();
+
+        allocations = 0;
+#if defined COST_MODEL
+        Cost::reset();
+#endif
+        uint32_t hash = 2166136261u;
+        double ns = 0, transpose = 0;
+        static uint8_t rgb[16][16][16][3];
+        for (int f = 0; f < frames; f++) {
+            auto start = std::chrono::steady_clock::now();
+            FirmwareHost::frame();
+            auto end = std::chrono::steady_clock::now();
+            ns += std::chrono::duration<double, std::nano>(end - start).count();
+            transpose += Display::getTransposeMicros() * 1000.0;
+            FirmwareHost::shown(rgb);
+            hash = checksum(hash, &rgb[0][0][0][0], sizeof(rgb));
+        }
+        ns /= frames;
+        transpose /= frames;
+        total += ns;
+        printf("%-24s %12.0f %12.0f %8zu   %08x", item.name, ns, transpose,
+               allocations, hash);
+#if defined COST_MODEL
+        // Estimate of the whole frame, the animation's own operations
+        const float teensy = Cost::micros() / frames;
+        const bool slow = teensy > budget;
+        failed |= slow;
+        printf(" %10.0f  %s%s", teensy, Cost::names[Cost::dominant()],
+               slow ? " over budget" : "");
+#endif
+        printf("\n");
+    }
+    printf("%-24s %12.0f\n", "Total", total);
+    Transpose::benchmark();
+#if defined COST_MODEL
+    printf("Cycles:");
+    for (uint8_t op = 0; op < Cost::OPS; op++) {
+        printf(" %s=%u", Cost::names[op], Cost::cycles[op]);
+    }
+    printf("\n");
+    return failed ? 1 : 0;
+#else
+    return 0;
+#endif
+}
+#else
+//=============================================================================
+// Simulator
+//=============================================================================
+int main() {
+    if (!Renderer::init(1280, 720)) {
+        return 1;
+    }
+    Animation::begin();
+
+    const uint16_t items = FirmwareHost::count();
+    uint16_t current = 0;
+    FirmwareHost::select(current);
+    printf("Animation: %s\n", Animation::get_item(current).name);
+
+    static uint8_t rgb[16][16][16][3];
+    while (!Renderer::shouldClose()) {
+        Renderer::beginFrame();
+
+        int step = 0;
+        if (Renderer::wasKeyPressed(GLFW_KEY_SPACE) || Renderer::wasKeyPressed(GLFW_KEY_RIGHT)) {
+            step = 1;
+        }
+        if (Renderer::wasKeyPressed(GLFW_KEY_LEFT)) {
+            step = items - 1;
+        }
+        if (step) {
+            current = (current + step) % items;
+            FirmwareHost::select(current);
+            printf("Animation: %s\n", Animation::get_item(current).name);
+        }
+
+        // Paced by the scheduler at config.display.fps
+        FirmwareHost::frame();
+        FirmwareHost::shown(rgb);
+        Renderer::renderCube(rgb);
+
+        Renderer::endFrame();
+    }
+    Renderer::shutdown();
+    return 0;
+}
+#endif
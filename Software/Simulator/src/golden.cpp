@@ -0,0 +1,199 @@
+/*
+ * MEGA CUBE Golden Frames
+ *
+ * Regression test of the firmware animations, for rewrites that should not
+ * change what the cube shows.
+ *
+ * Usage: firmware_golden [--record] [directory] [tolerance]
+ *
+ * Every animation of the jump table runs 3 seconds unmeasured and then FRAMES
+ * frames at a fixed dt of 1/60 s with the random generators seeded, so a run
+ * is the same every time. Every SAMPLE-th frame as it is shown (motion
+ * blurred) is compared to the golden voxel file of the animation in the
+ * directory (golden/ next to CMakeLists.txt). A channel may differ by the
+ * tolerance (default 2), more fails the test. --record writes the golden
+ * files instead.
+ *
+ * Every frame is also checked at bit level: the led data Display::update()
+ * transposed into its dma buffer must equal the reference below, which takes
+ * every voxel through the wiring of the shift register boards one bit at a
+ * time. Current limiting is off so no power scale is involved. The levels
+ * have 12 bits, the reference adds the dither threshold of every voxel before
+ * dropping the 4 bits of fraction.
+ *
+ * Chaotic animations amplify the smallest difference in floating point
+ * results, goldens recorded by another compiler or with other optimisation
+ * settings may not match them. Record them again after a change that is
+ * meant to change the visuals.
+ */
+
+#include <Arduino.h>
+
+#include "FirmwareHost.h"
+#include "Sequence.h"
+#include "core/Config.h"
+#include "core/Display.h"
+#include "power/Math8.h"
+#include "power/Noise.h"
+#include "power/Timer.h"
+#include "space/Animation.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef GOLDEN_DIR
+#define GOLDEN_DIR "golden"
+#endif
+
+static const int FRAMES = 60;
+static const int SAMPLE = 20;
+static const float DT = 1.0f / 60.0f;
+
+static const uint8_t BITCOUNT = 24;
+static const uint16_t LEDCOUNT = 128;
+static const uint8_t CHANNELS = 32;
+
+// Golden file of an animation, its name in lower case with underscores
+static std::string path(const std::string& directory, const char* name) {
+    std::string file;
+    for (const char* c = name; *c; c++) {
+        file += std::isalnum((unsigned char)*c) ? (char)std::tolower(*c) : '_';
+    }
+    return directory + "/" + file + ".vox";
+}
+
+// Output level of a color value in 1/16 of the led level, the gamma table
+// interpolated linearly when dithering
+static uint16_t level(const uint8_t v) {
+    if (!Display::getDither()) {
+        const uint8_t level = map8(v, Display::getBrightness());
+        return (Display::getGamma() ? Color::GAMMA[level] : level) * 16;
+    }
+    const float position = (Display::getBrightness() + 1) * v / 256.0f;
+    if (!Display::getGamma()) return (uint16_t)(position * 16);
+    const int i = (int)position;
+    const int next = i < 255 ? i + 1 : i;
+    const float gamma = Color::GAMMA[i] + (Color::GAMMA[next] - Color::GAMMA[i]) * (position - i);
+    return (uint16_t)(gamma * 16);
+}
+
+// Led data of the shown frame a bit at a time, 24 bits per led msb first
+static void reference(uint32_t out[BITCOUNT * LEDCOUNT]) {
+    uint16_t levels[256];
+    for (uint16_t v = 0; v < 256; v++) levels[v] = level(v);
+    memset(out, 0, BITCOUNT * LEDCOUNT * sizeof(uint32_t));
+    const uint8_t buffer = Display::getPreviousBuffer();
+    for (uint8_t x = 0; x < 16; x++) {
+        for (uint8_t y = 0; y < 16; y++) {
+            uint8_t led = 0x7F - (x << 4 & 0x30) - (((0x10 - (x & 1)) ^ y) & 0x0F);
+            for (uint8_t z = 0; z < 16; z++) {
+                led = 0x7F - led;
+                const uint8_t chn = (x >> 1 & 0x0E) + (z << 1 & 0xF8) + (z >> 1 & 1);
+                const Color& c = Display::at(buffer, x, y, z);
+                const uint8_t* order = Display::getProtocol().order;
+                uint8_t bytes[3];
+                const uint8_t t = Transpose::threshold(Display::getDitherPhase(), led, chn);
+                bytes[order[0]] = (levels[c.r] + t) / 16;
+                bytes[order[1]] = (levels[c.g] + t) / 16;
+                bytes[order[2]] = (levels[c.b] + t) / 16;
+                for (uint8_t i = 0; i < BITCOUNT; i++) {
+                    const uint32_t bit = bytes[i / 8] >> (7 - i % 8) & 1;
+                    out[led * BITCOUNT + i] |= bit << chn;
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    bool record = false;
+    std::string directory = GOLDEN_DIR;
+    int tolerance = 2;
+    int arg = 1;
+    if (arg < argc && !std::strcmp(argv[arg], "--record")) {
+        record = true;
+        arg++;
+    }
+    if (arg < argc) directory = argv[arg++];
+    if (arg < argc) tolerance = std::atoi(argv[arg++]);
+
+    // Timers advance by exactly dt per frame, frames are not paced
+    Timer::setFixedStep(DT);
+    config.display.fps = 0;
+    config.power.max_milliamps = 0;
+    Animation::begin();
+
+    static uint8_t rgb[16][16][16][3];
+    static uint32_t expected[BITCOUNT * LEDCOUNT];
+    static Color golden[VOXELS_COUNT];
+    static SequenceWriter writer;
+    const uint16_t duration = (uint16_t)(DT * 1000 + 0.5f);
+    const int settle = (int)(3.0f / DT);
+    int failures = 0;
+    for (uint16_t i = 0; i < FirmwareHost::count(); i++) {
+        const jump_item_t& item = Animation::get_item(i);
+        const std::string file = path(directory, item.name);
+        // Same starting point for every run
+        std::srand(1);
+        Noise::seed(1);
+        FirmwareHost::select(i);
+        for (int f = 0; f < settle; f++) FirmwareHost::frame();
+
+        SequenceMap map;
+        VoxelFile voxels;
+        const char* error = nullptr;
+        if (!record && !(map.open(file.c_str()) &&
+                         voxels.open(map.data(), (uint32_t)map.size()) &&
+                         voxels.frames() == FRAMES / SAMPLE)) {
+            error = "no golden file";
+        }
+        writer.clear();
+        int bits = -1, worst = 0, differ = 0;
+        for (int f = 0; f < FRAMES && !error; f++) {
+            FirmwareHost::frame();
+            reference(expected);
+            if (bits < 0 && memcmp(expected, Display::getDmaBuffer(), sizeof(expected))) {
+                bits = f;
+            }
+            if ((f + 1) % SAMPLE) continue;
+            FirmwareHost::shown(rgb);
+            if (record) {
+                writer.add((const Color*)rgb, duration, 0);
+                continue;
+            }
+            if (!voxels.decode(f / SAMPLE, golden)) {
+                error = "golden file damaged";
+                break;
+            }
+            const uint8_t* shown = &rgb[0][0][0][0];
+            const uint8_t* stored = (const uint8_t*)golden;
+            for (size_t n = 0; n < sizeof(rgb); n++) {
+                const int d = std::abs(shown[n] - stored[n]);
+                if (d > worst) worst = d;
+                if (d > tolerance) differ++;
+            }
+        }
+        if (record && !writer.save(file.c_str())) error = "can't write";
+
+        const bool failed = error || bits >= 0 || differ;
+        failures += failed;
+        printf("%-24s ", item.name);
+        if (error) {
+            printf("%s %s\n", error, file.c_str());
+        } else if (record) {
+            printf("recorded\n");
+        } else {
+            printf("max diff %3d", worst);
+            if (differ) printf(", %d channels over %d", differ, tolerance);
+            printf("\n");
+        }
+        if (bits >= 0) {
+            printf("%-24s dma buffer differs from the reference in frame %d\n", "", bits);
+        }
+    }
+    printf("%d of %u animations failed\n", failures, FirmwareHost::count());
+    return failures ? 1 : 0;
+}
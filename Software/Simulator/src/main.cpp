@@ -4,33 +4,57 @@
  * Test LED cube animations without flashing hardware.
  * Direct ports of the real cube animations.
  *
+ * Usage: simulator [--fps N] [--usb port] [--listen] [file.vox]
+ *        simulator --render out.mp4|dir [--demo N] [--frames N] [--fps N]
+ *                  [--size WxH]
+ *
+ * Plays a voxel file (power/VoxelFile.h) mapped read-only when one is given,
+ * the frames streamed to it as a virtual cube with --listen (VirtualCube.h),
+ * otherwise the demo animations. The demos step on their own thread at a
+ * fixed N frames per second (60, the default of the cube) and hand their
+ * frames to the render thread, which shows the newest one at display rate.
+ *
+ * --render steps demo N (1 based) offline instead, as fast as the machine
+ * renders it at WxH (1920x1080) to a framebuffer object. The frames go to
+ * ffmpeg for a video file, a directory otherwise gets frame00000.png and
+ * up. The voxel file of the run is written next to it as out.mp4.vox.
+ *
  * Controls:
  *   Left mouse drag: Rotate view
  *   Scroll wheel: Zoom in/out
  *   Space: Next animation
  *   R: Reset animation
+ *   E: Start or stop exporting the animation to a voxel file
  *   ESC: Quit
  */
 
-#include "Renderer.h"
+#include "Demo.h"
 #include "SimDisplay.h"
 #include <cmath>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <algorithm>
 
+#ifndef CUBE_BENCH
+#include "CubeLink.h"
+#include "Png.h"
+#include "Renderer.h"
+#include "Sequence.h"
+#include "TripleBuffer.h"
+#include "VirtualCube.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
-
-// Simple animation base class for demos
-class DemoAnimation {
-public:
-    virtual ~DemoAnimation() = default;
-    virtual void init() = 0;
-    virtual void update(float dt) = 0;
-    virtual const char* name() = 0;
-};
+#endif
 
 //=============================================================================
 // Demo 1: Plasma (Direct port from real cube)
@@ -412,9 +436,9 @@ public:
 
             if ((temp.y > missile.position.y) || (missile.position.y > target.y)) {
                 exploded = true;
-                numDebris = (uint16_t)((rand() % (MAX_DEBRIS / 2)) + MAX_DEBRIS / 2);
+                numDebris = (uint16_t)((simRand() % (MAX_DEBRIS / 2)) + MAX_DEBRIS / 2);
                 float pwr = noise.nextRandom(0.50f, 1.00f);
-                uint8_t hue = (uint8_t)(rand() % 256);
+                uint8_t hue = (uint8_t)(simRand() % 256);
 
                 for (uint16_t i = 0; i < numDebris; i++) {
                     Vector3 explode = Vector3(
@@ -422,7 +446,7 @@ public:
                         noise.nextRandom(-pwr, pwr),
                         noise.nextRandom(-pwr, pwr)
                     );
-                    debris[i] = Particle(temp, explode, (uint8_t)(hue + rand() % 64),
+                    debris[i] = Particle(temp, explode, (uint8_t)(hue + simRand() % 64),
                                          1.0f, noise.nextRandom(1.0f, 2.0f));
                 }
             } else {
@@ -446,7 +470,7 @@ public:
                 }
 
                 Color c = Color(debris[i].hue, RainbowGradientPalette);
-                if (rand() % 20 == 0) c = Color::WHITE;
+                if (simRand() % 20 == 0) c = Color::WHITE;
                 c.scale((uint8_t)(debris[i].brightness * 255));
                 voxel_add(debris[i].position * radius, c);
             }
@@ -557,18 +581,18 @@ public:
                 case 0:  // Life 4555
                     rules[4] = rule_t::LIVE;
                     rules[5] = rule_t::BIRTH;
-                    game_randomize((uint16_t)(200 + rand() % 200), noise.nextRandom(5.0f, 7.0f));
+                    game_randomize((uint16_t)(200 + simRand() % 200), noise.nextRandom(5.0f, 7.0f));
                     break;
                 case 1:  // Life 5766
                     rules[5] = rule_t::LIVE;
                     rules[7] = rule_t::LIVE;
                     rules[6] = rule_t::BIRTH;
-                    game_randomize((uint16_t)(200 + rand() % 200), noise.nextRandom(5.0f, 7.0f));
+                    game_randomize((uint16_t)(200 + simRand() % 200), noise.nextRandom(5.0f, 7.0f));
                     break;
                 case 2:  // Life 5655
                     rules[5] = rule_t::BIRTH;
                     rules[6] = rule_t::LIVE;
-                    game_randomize((uint16_t)(200 + rand() % 200), noise.nextRandom(5.0f, 7.0f));
+                    game_randomize((uint16_t)(200 + simRand() % 200), noise.nextRandom(5.0f, 7.0f));
                     break;
                 case 3:  // Life 5855
                 default:
@@ -688,11 +712,11 @@ public:
         // Add new twinkles
         if (timer >= interval) {
             timer = 0;
-            uint8_t x = rand() % 16;
-            uint8_t y = rand() % 16;
-            uint8_t z = rand() % 16;
+            uint8_t x = simRand() % 16;
+            uint8_t y = simRand() % 16;
+            uint8_t z = simRand() % 16;
             if (duration[x][y][z] == 0) {
-                colors[x][y][z] = Color((uint8_t)(rand() % 256), 255);  // Random bright color
+                colors[x][y][z] = Color((uint8_t)(simRand() % 256), 255);  // Random bright color
             }
         }
     }
@@ -808,25 +832,15 @@ public:
 
         float arc = 2 * (180 / PI) * asinf(0.5f / radius);
 
-        for (uint8_t y = 0; y < FRAME_HEIGHT; y++) {
-            for (uint8_t x = 0; x < FRAME_WIDTH; x++) {
-                uint32_t data = mario_data[frame_display[frame]][y * 16 + x];
-                // Default to black
-                Color c = Color(0, 0, 0);
-                if (data >> 24 & 0xff) {  // If alpha channel is set
-                    c = Color(data & 0xff, data >> 8 & 0xff, data >> 16 & 0xff);
-                    if (c.isBlack()) {
-                        c = Color(0, 0, 0);
-                    } else {
-                        c.gamma();
-                    }
-                }
-                // Map to coordinates - project on cylinder at left of coordinate system
-                Vector3 point = Vector3(-radius, (CY - y) / CY * radius, 0);
-                Quaternion q = Quaternion(angle - (arc * x), Vector3(0, 1, 0));
-                radiate(q.rotate(point), c, 1.0f);
-            }
-        }
+        // Only the opaque pixels are visited
+        Sprite::frame(mario_sprite, frame_display[frame],
+                      [&](uint8_t x, uint8_t y, Color c) {
+            if (!c.isBlack()) c.gamma();
+            // Map to coordinates - project on cylinder at left of coordinate system
+            Vector3 point = Vector3(-radius, (CY - y) / CY * radius, 0);
+            Quaternion q = Quaternion(angle - (arc * x), Vector3(0, 1, 0));
+            radiate(q.rotate(point), c, 1.0f);
+        });
     }
 };
 
@@ -850,7 +864,7 @@ public:
     const char* name() override { return "Scroller (Real Port)"; }
 
     uint16_t match_char(char chr) {
-        if (chr >= ' ' && chr <= '~')
+        if (chr >= ' ' && chr - ' ' < CHARSET_FRAME_COUNT)
             return chr - ' ';
         else
             return '#' - ' ';
@@ -886,16 +900,12 @@ public:
 
             if (y < CHARSET_FRAME_HEIGHT) {
                 Quaternion q = Quaternion(line_angle, Vector3(1, 0, 0));
-                for (uint8_t x = 0; x < CHARSET_FRAME_WIDTH; x++) {
-                    uint32_t data = charset_data[t][y * CHARSET_FRAME_WIDTH + x];
-                    if (data & 0xff000000) {
-                        Color c = Color(data & 0xff, data >> 8 & 0xff, data >> 16 & 0xff);
-                        Vector3 pixel = q.rotate(
-                            Vector3(x / (CHARSET_FRAME_WIDTH - 1.0f), 0, -1) * radius);
-                        pixel = pixel + Vector3(-radius / 2.0f, -radius / 2.0f, radius / 2.0f);
-                        voxel(pixel, c.scale(brightness).gamma());
-                    }
-                }
+                Sprite::line(charset_sprite, t, y, [&](uint8_t x, Color c) {
+                    Vector3 pixel = q.rotate(
+                        Vector3(x / (CHARSET_FRAME_WIDTH - 1.0f), 0, -1) * radius);
+                    pixel = pixel + Vector3(-radius / 2.0f, -radius / 2.0f, radius / 2.0f);
+                    voxel(pixel, c.scale(brightness).gamma());
+                });
             }
             line_angle -= line_angle_adj;
         }
@@ -1109,7 +1119,7 @@ public:
             flies[i].vz = noise.nextRandom(-1, 1);
             flies[i].phase = noise.nextRandom(0, TWO_PI);
             flies[i].speed = noise.nextRandom(0.5f, 2.0f);
-            flies[i].hue = (uint8_t)(rand() % 256);
+            flies[i].hue = (uint8_t)(simRand() % 256);
         }
     }
 
@@ -1304,7 +1314,7 @@ public:
         angle = 0; hue16 = 0;
         Vector3 p(0, 0, 0);
         for (int i = 0; i < NUM_POINTS; i++) {
-            p = (p + vertices[rand() % 4] * 6.0f) * 0.5f;
+            p = (p + vertices[simRand() % 4] * 6.0f) * 0.5f;
             points[i] = p;
         }
     }
@@ -1411,7 +1421,7 @@ class SnakeDemo : public DemoAnimation {
 
     void placeFood() {
         for (int attempt = 0; attempt < 100; attempt++) {
-            food.x = rand() % 16; food.y = rand() % 16; food.z = rand() % 16;
+            food.x = simRand() % 16; food.y = simRand() % 16; food.z = simRand() % 16;
             if (!grid[food.x][food.y][food.z]) return;
         }
     }
@@ -1511,9 +1521,9 @@ class TetrisDemo : public DemoAnimation {
     };
 
     void spawn() {
-        cur = types[rand() % NUM_TYPES];
-        pieceX = 5 + rand() % 6; pieceY = 14; pieceZ = 5 + rand() % 6;
-        pieceColor = Color((uint8_t)(rand() % 256), RainbowGradientPalette);
+        cur = types[simRand() % NUM_TYPES];
+        pieceX = 5 + simRand() % 6; pieceY = 14; pieceZ = 5 + simRand() % 6;
+        pieceColor = Color((uint8_t)(simRand() % 256), RainbowGradientPalette);
     }
 
     bool fits(int px, int py, int pz) {
@@ -1608,7 +1618,7 @@ class PongDemo : public DemoAnimation {
     void resetBall() {
         ballX = 7.5f; ballY = 7.5f; ballZ = 7.5f;
         ballVX = noise.nextRandom(-5, 5);
-        ballVY = (rand() % 2 ? 1 : -1) * noise.nextRandom(8, 12);
+        ballVY = (simRand() % 2 ? 1 : -1) * noise.nextRandom(8, 12);
         ballVZ = noise.nextRandom(-5, 5);
     }
 
@@ -1706,7 +1716,7 @@ class MazeDemo : public DemoAnimation {
                     valid[nv++] = d;
             }
             if (nv == 0) { top--; continue; }
-            int d = valid[rand() % nv];
+            int d = valid[simRand() % nv];
             int nx=cur.x+dirs[d][0], ny=cur.y+dirs[d][1], nz=cur.z+dirs[d][2];
             walls[cur.x][cur.y][cur.z][d] = false;
             walls[nx][ny][nz][opp[d]] = false;
@@ -2031,7 +2041,7 @@ public:
         for (int i = 0; i < NUM_STARS; i++) {
             float t = noise.nextRandom(0.05f, 1.0f);
             stars[i].r = t * 7.0f;
-            stars[i].arm = (uint8_t)(rand() % 3);
+            stars[i].arm = (uint8_t)(simRand() % 3);
             stars[i].armAngle = t * 2.5f * PI;
             float armWidth = 0.5f + t * 1.5f;
             stars[i].spread_x = noise.nextGaussian(0, armWidth * 0.4f);
@@ -2086,7 +2096,7 @@ public:
             float t = (parts[i].y + 7.5f) / 15.0f;
             parts[i].radius = 1.0f + t * 5.0f;
             parts[i].speed = noise.nextRandom(2, 5);
-            parts[i].hue = (uint8_t)(rand() % 256);
+            parts[i].hue = (uint8_t)(simRand() % 256);
         }
     }
 
@@ -2182,7 +2192,7 @@ public:
         for (int i = 0; i < NUM_P; i++) {
             parts[i].dir = Vector3(noise.nextRandom(-1,1), noise.nextRandom(-1,1), noise.nextRandom(-1,1)).normalize();
             parts[i].dist = noise.nextRandom(0.5f, 1.0f);
-            parts[i].hue = (uint8_t)(rand() % 256);
+            parts[i].hue = (uint8_t)(simRand() % 256);
         }
     }
 
@@ -2284,7 +2294,7 @@ public:
             for (int z = 0; z < 16; z++) {
                 cols[x][z].y = noise.nextRandom(0, 20);
                 cols[x][z].speed = noise.nextRandom(5, 15);
-                cols[x][z].length = 4 + rand() % 8;
+                cols[x][z].length = 4 + simRand() % 8;
             }
     }
 
@@ -2298,7 +2308,7 @@ public:
                 if (col.y < -(int)col.length) {
                     col.y = 16 + noise.nextRandom(0, 8);
                     col.speed = noise.nextRandom(5, 15);
-                    col.length = 4 + rand() % 8;
+                    col.length = 4 + simRand() % 8;
                 }
 
                 for (int i = 0; i < col.length; i++) {
@@ -2464,17 +2474,10 @@ public:
 };
 
 //=============================================================================
-// Main
+// Demo list, shared with the headless benchmark
 //=============================================================================
-int main() {
-    if (!Renderer::init(1280, 720)) {
-        return 1;
-    }
-
-    Display::begin();
-
-    // Create demo animations
-    DemoAnimation* demos[] = {
+std::vector<DemoAnimation*> createDemos() {
+    return {
         new PlasmaDemo(),
         new CubeDemo(),
         new AtomsDemo(),
@@ -2517,42 +2520,423 @@ int main() {
         new KaleidoscopeDemo(),
         new InterferenceDemo()
     };
-    int numDemos = sizeof(demos) / sizeof(demos[0]);
+}
+
+#ifndef CUBE_BENCH
+//=============================================================================
+// Voxel file playback, decoded straight from the mapped file
+//=============================================================================
+static int play(const char* path) {
+    SequenceMap map;
+    VoxelFile file;
+    if (!map.open(path) || !file.open(map.data(), (uint32_t)map.size()) ||
+        !file.frames()) {
+        fprintf(stderr, "Not a voxel file: %s\n", path);
+        return 1;
+    }
+    if (!Renderer::init(1280, 720)) {
+        return 1;
+    }
+    printf("Playing %s, %u frames\n", path, file.frames());
+
+    // Uploaded once when decoded, the renderer blurs it on the GPU
+    static Color frame[VOXELS_COUNT];
+    uint32_t n = 0;
+    float wait = 0;
+    uint8_t blur = 0;
+    while (!Renderer::shouldClose()) {
+        Renderer::beginFrame();
+        wait -= Renderer::getDeltaTime() * 1000;
+        bool decoded = false;
+        while (wait <= 0) {
+            voxel_frame_t f;
+            if (!file.decode(n, frame, &f)) break;
+            wait += f.duration ? f.duration : 1;
+            blur = f.motion_blur;
+            decoded = true;
+            n = (n + 1) % file.frames();
+        }
+        if (wait < 0) wait = 0;
+        Renderer::renderCube(decoded ? (const uint8_t(*)[16][16][3])frame : nullptr, blur,
+                             simConfig.power.brightness);
+        Renderer::endFrame();
+    }
+    Renderer::shutdown();
+    return 0;
+}
+
+//=============================================================================
+// Virtual cube, shows what is streamed to the ports of the ESP8266
+//=============================================================================
+static int listenAsCube() {
+    static VirtualCube cube;
+    if (!cube.start(7000, 8000)) {
+        fprintf(stderr, "Cannot listen on udp port 7000 and tcp port 8000\n");
+        return 1;
+    }
+    if (!Renderer::init(1280, 720)) {
+        return 1;
+    }
+    printf("Virtual cube on udp port 7000 and tcp port 8000\n");
+
+    while (!Renderer::shouldClose()) {
+        Renderer::beginFrame();
+        const bool fresh = cube.frames.fresh();
+        const Color* voxels = cube.frames.front().voxels;
+        Renderer::renderCube(fresh ? (const uint8_t(*)[16][16][3])voxels : nullptr,
+                             simConfig.animation.motionBlur, simConfig.power.brightness);
+        Renderer::endFrame();
+    }
+    cube.stop();
+    Renderer::shutdown();
+    return 0;
+}
+
+//=============================================================================
+// Offline render, fixed dt and no vsync, encoded while the next frames render
+//=============================================================================
+struct OfflineRender {
+    const char* path = nullptr;
+    int demo = 1;
+    int frames = 600;
+    int fps = 60;
+    int width = 1920;
+    int height = 1080;
+};
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+// Extensions that go to ffmpeg, anything else is a directory of PNGs
+static bool isVideo(const std::string& path) {
+    for (const char* extension : {".mp4", ".mkv", ".mov", ".webm", ".gif"}) {
+        const size_t n = strlen(extension);
+        if (path.size() > n && !path.compare(path.size() - n, n, extension)) return true;
+    }
+    return false;
+}
+
+static int renderOffline(const OfflineRender& r) {
+    std::vector<DemoAnimation*> demos = createDemos();
+    const int numDemos = (int)demos.size();
+    if (r.demo < 1 || r.demo > numDemos) {
+        fprintf(stderr, "No demo %d, there are %d\n", r.demo, numDemos);
+        return 1;
+    }
+    DemoAnimation* demo = demos[r.demo - 1];
+    const std::string path = r.path;
+    const bool video = isVideo(path);
+
+    // ffmpeg encodes on threads of its own, the PNGs on one per core
+    FILE* ffmpeg = nullptr;
+    int workers = 1;
+    if (video) {
+        char command[1024];
+        snprintf(command, sizeof(command),
+                 "ffmpeg -y -loglevel error -f rawvideo -pix_fmt rgb24 -s %dx%d -r %d -i - %s\"%s\"",
+                 r.width, r.height, r.fps,
+                 path.size() > 4 && !path.compare(path.size() - 4, 4, ".gif") ? "" : "-pix_fmt yuv420p ",
+                 path.c_str());
+        ffmpeg = popen(command, "w");
+        if (!ffmpeg) {
+            fprintf(stderr, "Cannot start ffmpeg\n");
+            return 1;
+        }
+    } else {
+        std::error_code error;
+        std::filesystem::create_directories(path, error);
+        workers = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+    if (!Renderer::initOffscreen(r.width, r.height)) {
+        if (ffmpeg) pclose(ffmpeg);
+        return 1;
+    }
+    printf("Rendering %s, %d frames at %dx%d to %s\n", demo->name(), r.frames, r.width,
+           r.height, path.c_str());
+
+    // Slots of pixels, the renderer fills the free ones and the encoders
+    // take the full ones in frame order
+    struct Slot {
+        std::vector<uint8_t> rgb;
+        int frame;
+    };
+    std::vector<Slot> slots(workers + 2);
+    std::deque<int> free, full;
+    for (int i = 0; i < (int)slots.size(); i++) {
+        slots[i].rgb.resize((size_t)r.width * r.height * 3);
+        free.push_back(i);
+    }
+    std::mutex lock;
+    std::condition_variable changed;
+    bool done = false;
+    std::atomic<bool> failed{false};
+    auto encode = [&]() {
+        std::vector<uint8_t> png;
+        for (;;) {
+            int i;
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                changed.wait(guard, [&]() { return done || !full.empty(); });
+                if (full.empty()) return;
+                i = full.front();
+                full.pop_front();
+            }
+            const Slot& slot = slots[i];
+            if (ffmpeg) {
+                failed = failed || fwrite(slot.rgb.data(), 1, slot.rgb.size(), ffmpeg) != slot.rgb.size();
+            } else {
+                char name[32];
+                snprintf(name, sizeof(name), "/frame%05d.png", slot.frame);
+                failed = failed || !Png::save((path + name).c_str(), slot.rgb.data(), r.width, r.height);
+            }
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                free.push_back(i);
+            }
+            changed.notify_all();
+        }
+    };
+    std::vector<std::thread> encoders;
+    for (int t = 0; t < workers; t++) encoders.emplace_back(encode);
+
+    // The same start as the benchmark, so a render repeats
+    Noise::seed(1);
+    Display::begin();
+    demo->init();
+    static SequenceWriter exporter;
+    const float dt = 1.0f / r.fps;
+    const uint16_t duration = (uint16_t)(dt * 1000 + 0.5f);
+    const auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < r.frames && !failed; f++) {
+        demo->update(dt);
+        const Color* cube = &Display::cube[Display::cubeBuffer][0][0][0];
+        exporter.add(cube, duration, simConfig.animation.motionBlur);
+        Renderer::beginFrame();
+        Renderer::renderCube((const uint8_t(*)[16][16][3])cube, simConfig.animation.motionBlur,
+                             simConfig.power.brightness);
+        Display::swap();
+
+        int i;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            changed.wait(guard, [&]() { return !free.empty(); });
+            i = free.front();
+            free.pop_front();
+        }
+        Renderer::readPixels(slots[i].rgb.data());
+        slots[i].frame = f;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            full.push_back(i);
+        }
+        changed.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        done = true;
+    }
+    changed.notify_all();
+    for (std::thread& t : encoders) t.join();
+    if (ffmpeg && pclose(ffmpeg) != 0) failed = true;
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    Renderer::shutdown();
+
+    const std::string voxels = path + ".vox";
+    if (!exporter.save(voxels.c_str())) failed = true;
+    for (DemoAnimation* d : demos) delete d;
+    if (failed) {
+        fprintf(stderr, "Failed to write %s\n", path.c_str());
+        return 1;
+    }
+    printf("Rendered %u frames in %.1f s (%.1f fps), voxels in %s\n", exporter.frames(),
+           seconds, exporter.frames() / seconds, voxels.c_str());
+    return 0;
+}
+
+//=============================================================================
+// Main
+//=============================================================================
+// A frame before motion blur, the renderer blends it with the one before
+struct SimFrame {
+    uint8_t voxels[16][16][16][3];
+    uint8_t blur;
+};
+
+// Keys of the render thread for the simulation thread
+enum class SimCommand { NONE, NEXT, PREVIOUS, RESET, EXPORT };
+
+int main(int argc, char** argv) {
+    int fps = 60;
+    // Frames also go to a cube on a USB serial port
+    static CubeLink link;
+    OfflineRender offline;
+    while (argc > 1 && argv[1][0] == '-') {
+        if (!strcmp(argv[1], "--listen")) {
+            return listenAsCube();
+        }
+        if (argc < 3) {
+            break;
+        }
+        if (!strcmp(argv[1], "--fps")) {
+            fps = std::max(1, atoi(argv[2]));
+        } else if (!strcmp(argv[1], "--render")) {
+            offline.path = argv[2];
+        } else if (!strcmp(argv[1], "--demo")) {
+            offline.demo = atoi(argv[2]);
+        } else if (!strcmp(argv[1], "--frames")) {
+            offline.frames = std::max(1, atoi(argv[2]));
+        } else if (!strcmp(argv[1], "--size")) {
+            if (sscanf(argv[2], "%dx%d", &offline.width, &offline.height) != 2 ||
+                offline.width < 1 || offline.height < 1) {
+                fprintf(stderr, "Size is WxH, not %s\n", argv[2]);
+                return 1;
+            }
+        } else if (!strcmp(argv[1], "--usb")) {
+            if (!link.open(argv[2])) {
+                fprintf(stderr, "Cannot open %s\n", argv[2]);
+                return 1;
+            }
+        } else {
+            break;
+        }
+        argc -= 2;
+        argv += 2;
+    }
+    if (offline.path) {
+        offline.fps = fps;
+        return renderOffline(offline);
+    }
+    if (argc > 1) {
+        return play(argv[1]);
+    }
+    if (!Renderer::init(1280, 720)) {
+        return 1;
+    }
+
+    // Create demo animations
+    std::vector<DemoAnimation*> demos = createDemos();
+    int numDemos = (int)demos.size();
     int currentDemo = 0;
 
+    // Export of the current demo, saved when stopped or when it changes
+    static SequenceWriter exporter;
+    bool exporting = false;
+    char exportPath[32];
+    auto stopExport = [&]() {
+        if (!exporting) return;
+        exporting = false;
+        if (exporter.save(exportPath))
+            printf("Exported %u frames to %s\n", exporter.frames(), exportPath);
+        else
+            fprintf(stderr, "Failed to write %s\n", exportPath);
+    };
+
     demos[currentDemo]->init();
-    printf("Animation: %s\n", demos[currentDemo]->name());
-    printf("Press RIGHT/SPACE for next, LEFT for previous, R to reset\n\n");
+    printf("Animation: %s (%d fps)\n", demos[currentDemo]->name(), fps);
+    printf("Press RIGHT/SPACE for next, LEFT for previous, R to reset, E to export\n\n");
+
+    // The simulation steps at a fixed rate whatever the display does, the
+    // demos, the exporter and Display belong to this thread
+    static TripleBuffer<SimFrame> frames;
+    std::atomic<bool> running{true};
+    std::atomic<SimCommand> command{SimCommand::NONE};
+    std::thread simulation([&]() {
+        // The cube of this thread (SimDisplay.h)
+        Display::begin();
+        using clock = std::chrono::steady_clock;
+        const float dt = 1.0f / fps;
+        const auto period = std::chrono::duration_cast<clock::duration>(
+            std::chrono::duration<double>(1.0 / fps));
+        auto next = clock::now();
+        while (running) {
+            switch (command.exchange(SimCommand::NONE)) {
+                case SimCommand::NEXT:
+                    stopExport();
+                    currentDemo = (currentDemo + 1) % numDemos;
+                    demos[currentDemo]->init();
+                    printf("Animation: %s\n", demos[currentDemo]->name());
+                    break;
+                case SimCommand::PREVIOUS:
+                    stopExport();
+                    currentDemo = (currentDemo - 1 + numDemos) % numDemos;
+                    demos[currentDemo]->init();
+                    printf("Animation: %s\n", demos[currentDemo]->name());
+                    break;
+                case SimCommand::RESET:
+                    demos[currentDemo]->init();
+                    printf("Reset: %s\n", demos[currentDemo]->name());
+                    break;
+                case SimCommand::EXPORT:
+                    if (exporting) {
+                        stopExport();
+                    } else {
+                        snprintf(exportPath, sizeof(exportPath), "demo%02d.vox", currentDemo + 1);
+                        exporter.clear();
+                        exporting = true;
+                        printf("Exporting %s to %s\n", demos[currentDemo]->name(), exportPath);
+                    }
+                    break;
+                case SimCommand::NONE:
+                    break;
+            }
 
-    while (!Renderer::shouldClose()) {
-        float dt = Renderer::getDeltaTime();
+            demos[currentDemo]->update(dt);
+
+            // The frame before motion blur, the player blurs it again
+            if (exporting) {
+                exporter.add(&Display::cube[Display::cubeBuffer][0][0][0],
+                             (uint16_t)(dt * 1000 + 0.5f), simConfig.animation.motionBlur);
+            }
+
+            // Before motion blur as well, the cube blurs it again
+            if (link.isOpen() &&
+                !link.send((const uint8_t*)&Display::cube[Display::cubeBuffer][0][0][0])) {
+                fprintf(stderr, "USB link lost\n");
+            }
 
+            // The only copy of the frame, the GPU does the motion blur
+            memcpy(frames.back().voxels, Display::cube[Display::cubeBuffer], sizeof(SimFrame::voxels));
+            frames.back().blur = simConfig.animation.motionBlur;
+            frames.publish();
+            Display::swap();
+
+            // Skip ahead instead of catching up after a stall
+            next += period;
+            const auto now = clock::now();
+            if (now > next + period * 4) next = now;
+            std::this_thread::sleep_until(next);
+        }
+        stopExport();
+    });
+
+    while (!Renderer::shouldClose()) {
         Renderer::beginFrame();
 
         if (Renderer::wasKeyPressed(GLFW_KEY_SPACE) || Renderer::wasKeyPressed(GLFW_KEY_RIGHT)) {
-            currentDemo = (currentDemo + 1) % numDemos;
-            demos[currentDemo]->init();
-            printf("Animation: %s\n", demos[currentDemo]->name());
+            command = SimCommand::NEXT;
         }
-
         if (Renderer::wasKeyPressed(GLFW_KEY_LEFT)) {
-            currentDemo = (currentDemo - 1 + numDemos) % numDemos;
-            demos[currentDemo]->init();
-            printf("Animation: %s\n", demos[currentDemo]->name());
+            command = SimCommand::PREVIOUS;
         }
-
         if (Renderer::wasKeyPressed(GLFW_KEY_R)) {
-            demos[currentDemo]->init();
-            printf("Reset: %s\n", demos[currentDemo]->name());
+            command = SimCommand::RESET;
+        }
+        if (Renderer::wasKeyPressed(GLFW_KEY_E)) {
+            command = SimCommand::EXPORT;
         }
 
-        demos[currentDemo]->update(dt);
-
-        Display::update();
-        Renderer::renderCube((uint8_t(*)[16][16][3])Display::getRawBuffer(), simConfig.power.brightness);
+        // Nothing to upload while the simulation has no new frame
+        const bool fresh = frames.fresh();
+        const SimFrame& frame = frames.front();
+        Renderer::renderCube(fresh ? frame.voxels : nullptr, frame.blur, simConfig.power.brightness);
 
         Renderer::endFrame();
     }
+    running = false;
+    simulation.join();
 
     for (int i = 0; i < numDemos; i++) {
         delete demos[i];
@@ -2561,3 +2945,4 @@ int main() {
     Renderer::shutdown();
     return 0;
 }
+#endif
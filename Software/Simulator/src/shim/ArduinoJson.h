@@ -0,0 +1,6 @@
+#pragma once
+// The simulator does not (de)serialize the config, see core/Config.h, the
+// schema only names the types
+class JsonObject;
+class JsonObjectConst;
+class Print;
@@ -0,0 +1,32 @@
+#pragma once
+// Teensy DMA of core/Display.h without leds. The simulator calls complete()
+// when it has shown a frame, which runs the completion interrupts as the end
+// of a transfer to the leds would.
+#include <cstdint>
+
+class DMASetting {
+public:
+    // Transfer control descriptor, only the source is changed on the fly
+    struct TCD_t {
+        volatile const void* volatile SADDR = nullptr;
+    };
+    TCD_t storage;
+    TCD_t* TCD = &storage;
+
+    void sourceBuffer(const volatile void* p, uint32_t) { TCD->SADDR = p; }
+};
+
+class DMAChannel {
+public:
+    void attachInterrupt(void (*isr)()) { interrupt() = isr; }
+    void clearInterrupt() {}
+    static void complete() {
+        if (interrupt()) interrupt()();
+    }
+
+private:
+    static void (*&interrupt())() {
+        static void (*isr)() = nullptr;
+        return isr;
+    }
+};
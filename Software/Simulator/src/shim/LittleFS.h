@@ -0,0 +1,5 @@
+#pragma once
+// The config of core/Config.h stays in memory in the simulator, there is no
+// file system behind Config::filesystem()
+class FS;
+class File;
@@ -0,0 +1,49 @@
+#pragma once
+// SdFat of core/Card.h on the working directory, files are stdio files
+#include <cstdint>
+#include <cstdio>
+
+#define O_RDONLY 0x00
+#define O_WRONLY 0x01
+#define O_CREAT 0x40
+#define O_TRUNC 0x200
+#define SHARED_SPI 0
+#define SD_SCK_MHZ(mhz) (mhz)
+
+struct SdSpiConfig {
+    SdSpiConfig(uint8_t, uint8_t, uint32_t) {}
+};
+
+class FsFile {
+public:
+    ~FsFile() { close(); }
+    bool open(const char* path, int flags) {
+        close();
+        file = fopen(path, flags & O_WRONLY ? "wb" : "rb");
+        return file;
+    }
+    bool isOpen() const { return file; }
+    void close() {
+        if (file) fclose(file);
+        file = nullptr;
+    }
+    int read(void* data, size_t size) { return file ? (int)fread(data, 1, size, file) : -1; }
+    size_t write(const void* data, size_t size) { return file ? fwrite(data, 1, size, file) : 0; }
+    bool seekSet(uint64_t position) { return file && !fseek(file, (long)position, SEEK_SET); }
+    uint64_t fileSize() {
+        if (!file) return 0;
+        long at = ftell(file);
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, at, SEEK_SET);
+        return (uint64_t)size;
+    }
+
+private:
+    FILE* file = nullptr;
+};
+
+class SdFs {
+public:
+    bool begin(SdSpiConfig) { return true; }
+};
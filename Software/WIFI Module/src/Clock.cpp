@@ -0,0 +1,125 @@
+#include "Clock.h"
+
+#include <ESP8266WiFi.h>
+#include <lwip/dns.h>
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * CLOCK CLASS
+ *----------------------------------------------------------------------------*/
+// Seconds from the NTP era (1900) to the Unix epoch
+static const uint32_t UNIX_EPOCH = 2208988800UL;
+
+static uint32_t get32(const uint8_t* p) {
+  return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+// An NTP timestamp, 32.32 fixed point seconds since 1900, in Unix microseconds
+static uint64_t unix_us(const uint8_t* p) {
+  const uint64_t seconds = get32(p) - UNIX_EPOCH;
+  return seconds * 1000000 + ((uint64_t)get32(p + 4) * 1000000 >> 32);
+}
+
+void Clock::begin(sink_t synced) {
+  sink = synced;
+  udp.begin(0);
+  Serial.printf("ESP8266 clock from %s ready\n", CLOCK_SERVER);
+}
+
+void Clock::resolved(const char* name, const ip_addr_t* address, void* arg) {
+  Clock* clock = static_cast<Clock*>(arg);
+  if (address) clock->server = IPAddress(address);
+  clock->resolving = false;
+}
+
+void Clock::loop() {
+  read();
+  const uint32_t ms = millis();
+  if (asked && micros64() - asked > CLOCK_TIMEOUT_MS * 1000ull) asked = 0;
+  const uint32_t interval = count ? CLOCK_POLL_MS : CLOCK_RETRY_MS;
+  if (asked || (polled && ms - polled < interval)) return;
+  if (!WiFi.isConnected()) return;
+  if (!server.isSet()) {
+    // Answered at once from the cache, or later through resolved()
+    if (resolving) return;
+    ip_addr_t address;
+    const err_t err =
+        dns_gethostbyname(CLOCK_SERVER, &address, &Clock::resolved, this);
+    if (err == ERR_OK) server = IPAddress(&address);
+    resolving = err == ERR_INPROGRESS;
+    if (!server.isSet()) {
+      if (!resolving) polled = ms;
+      return;
+    }
+  }
+  polled = ms;
+  request();
+}
+
+// Client mode, version 4, the local time of the request as the transmit
+// timestamp. The server returns it as the origin of its answer.
+void Clock::request() {
+  memset(packet, 0, sizeof(packet));
+  packet[0] = 0x23;
+  asked = micros64();
+  memcpy(&packet[40], &asked, 8);
+  udp.beginPacket(server, CLOCK_PORT);
+  udp.write(packet, sizeof(packet));
+  udp.endPacket();
+}
+
+void Clock::read() {
+  const int size = udp.parsePacket();
+  if (size <= 0) return;
+  // Taken first, reading the packet does not delay it
+  const uint64_t t4 = micros64();
+  if (size != sizeof(packet) || !asked) return;
+  udp.read(packet, size);
+  uint64_t origin;
+  memcpy(&origin, &packet[24], 8);
+  // Not our request, a server mode answer and no kiss of death
+  if (origin != asked || (packet[0] & 7) != 4 || packet[1] == 0) return;
+  const uint64_t t1 = asked;
+  asked = 0;
+  const uint64_t t2 = unix_us(&packet[32]);
+  const uint64_t t3 = unix_us(&packet[40]);
+  if (t3 < t2 || t4 < t1) return;
+  sample_t& s = samples[next];
+  next = (next + 1) % CLOCK_SAMPLES;
+  const bool first = count == 0;
+  if (count < CLOCK_SAMPLES) count++;
+  s.offset = ((int64_t)(t2 - t1) + (int64_t)(t3 - t4)) / 2;
+  s.local = t4;
+  s.delay = (t4 - t1) - (t3 - t2);
+  choose();
+  if (first && sink) sink(now());
+}
+
+// The answer with the shortest round trip, the drift from the change of the
+// offset since the reference
+void Clock::choose() {
+  const sample_t* shortest = &samples[0];
+  for (uint8_t i = 1; i < count; i++)
+    if (samples[i].delay < shortest->delay) shortest = &samples[i];
+  best = *shortest;
+  if (!reference.local) {
+    reference = best;
+    return;
+  }
+  if (best.local <= reference.local) return;
+  const uint64_t span = best.local - reference.local;
+  if (span < CLOCK_DRIFT_MS * 1000ull) return;
+  const int64_t measured =
+      (best.offset - reference.offset) * 1000000000ll / (int64_t)span;
+  // Averaged over about 4 measurements, a wrong one is filtered out
+  ppb += (int32_t)((measured - ppb) / 4);
+  reference = best;
+}
+
+uint64_t Clock::now() {
+  const uint64_t local = micros64();
+  if (!count) return local;
+  const int64_t since = local - best.local;
+  return local + best.offset + since * ppb / 1000000000ll;
+}
+
+uint64_t Clock::delay() { return best.delay; }
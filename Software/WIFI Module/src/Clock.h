@@ -0,0 +1,78 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <WiFiUdp.h>
+/*------------------------------------------------------------------------------
+ * CLOCK CLASS
+ *------------------------------------------------------------------------------
+ * Wall clock from NTP that never blocks the bridge. loop() resolves the
+ * server with the asynchronous DNS of lwIP, sends a request every
+ * CLOCK_POLL_MS (CLOCK_RETRY_MS until the first answer) and takes the answer
+ * in a later loop, so asking for the time is answered from memory.
+ *
+ * An answer gives the offset of Unix time to micros64() and the round trip
+ * from the four timestamps, as in Sync.h. The answer with the shortest round
+ * trip of the last CLOCK_SAMPLES sets the offset, and the change of the offset
+ * between answers at least CLOCK_DRIFT_MS apart the drift of the crystal,
+ * which now() applies in between.
+ *
+ * Clock ntp;
+ * ntp.begin(on_synced);        // after WiFi is started
+ * ntp.loop();                  // every main loop
+ * if (ntp.synced()) ntp.now() ...
+ *----------------------------------------------------------------------------*/
+#define CLOCK_SERVER "pool.ntp.org"
+#define CLOCK_PORT 123
+#define CLOCK_POLL_MS 64000
+#define CLOCK_RETRY_MS 2000
+// An answer later than this is ignored
+#define CLOCK_TIMEOUT_MS 1000
+#define CLOCK_SAMPLES 8
+#define CLOCK_DRIFT_MS 60000
+
+class Clock {
+ public:
+  // Unix time in microseconds, called once with the first answer
+  typedef void (*sink_t)(uint64_t time);
+
+  void begin(sink_t synced);
+  void loop();
+  bool synced() { return count > 0; }
+  // Unix time in microseconds, micros64() until synced
+  uint64_t now();
+  // Round trip of the answer in use in microseconds, drift in parts per
+  // billion
+  uint64_t delay();
+  int32_t drift() { return ppb; }
+
+ private:
+  struct sample_t {
+    // Unix time minus micros64() at local, and the round trip
+    int64_t offset;
+    uint64_t local;
+    uint64_t delay;
+  };
+
+  WiFiUDP udp;
+  sink_t sink = nullptr;
+  IPAddress server;
+  bool resolving = false;
+  // micros64() of the request waiting for its answer, 0 when none
+  uint64_t asked = 0;
+  uint32_t polled = 0;
+  sample_t samples[CLOCK_SAMPLES];
+  uint8_t count = 0;
+  uint8_t next = 0;
+  // The answer in use and the one the drift was last measured from
+  sample_t best = {};
+  sample_t reference = {};
+  int32_t ppb = 0;
+  uint8_t packet[48];
+
+  static void resolved(const char* name, const ip_addr_t* address, void* arg);
+  void request();
+  void read();
+  void choose();
+};
+#endif
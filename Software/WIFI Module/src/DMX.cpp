@@ -0,0 +1,133 @@
+#include "DMX.h"
+
+#include <ESP8266WiFi.h>
+#include <lwip/igmp.h>
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * DMX CLASS
+ *----------------------------------------------------------------------------*/
+static const uint8_t ARTNET_ID[8] = {'A', 'r', 't', '-', 'N', 'e', 't', 0};
+static const uint16_t ARTNET_DMX = 0x5000;
+static const uint16_t ARTNET_SYNC = 0x5200;
+static const uint8_t ARTNET_DATA = 18;
+
+static const uint8_t E131_ID[12] = {'A', 'S', 'C', '-', 'E', '1',
+                                    '.', '1', '7', 0,   0,   0};
+static const uint32_t E131_ROOT_DATA = 0x00000004;
+static const uint32_t E131_ROOT_EXTENDED = 0x00000008;
+static const uint32_t E131_FRAMING_DATA = 0x00000002;
+static const uint32_t E131_FRAMING_SYNC = 0x00000001;
+static const uint8_t E131_PREVIEW = 0x40;
+static const uint8_t E131_TERMINATED = 0x20;
+static const uint8_t E131_DATA = 126;
+static const uint8_t E131_SYNC_SIZE = 49;
+
+static uint16_t be16(const uint8_t* p) { return p[0] << 8 | p[1]; }
+static uint32_t be32(const uint8_t* p) {
+  return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+void DMX::begin(const uint16_t first, sink_t sink) {
+  this->first = first;
+  this->sink = sink;
+  artnet.begin(DMX_ARTNET_PORT);
+  e131.begin(DMX_E131_PORT);
+  if (WiFi.status() == WL_CONNECTED) join();
+  Serial.printf("ESP8266 DMX universes %u-%u ready\n", first,
+                first + DMX_UNIVERSES - 1);
+}
+
+// E1.31 multicast goes to 239.255.<universe hi>.<universe lo>
+void DMX::join() {
+  const IPAddress local = WiFi.localIP();
+  for (uint16_t u = first; u < first + DMX_UNIVERSES; u++) {
+    const IPAddress group(239, 255, u >> 8, u & 0xFF);
+    igmp_joingroup(ip_2_ip4((const ip_addr_t*)local),
+                   ip_2_ip4((const ip_addr_t*)group));
+  }
+}
+
+void DMX::loop(const bool drop) {
+  read_artnet(drop);
+  read_e131(drop);
+}
+
+uint8_t DMX::index(const uint16_t universe) {
+  const uint16_t i = universe - first;
+  return i < DMX_UNIVERSES ? i : DMX_UNIVERSES;
+}
+
+// Same rule as E1.31: a number up to 20 behind the last one is stale
+bool DMX::fresh(const uint8_t index, const uint8_t number) {
+  const uint32_t bit = 1ul << index;
+  const int8_t ahead = number - sequence[index];
+  if ((numbered & bit) && ahead <= 0 && ahead > -20) return false;
+  numbered |= bit;
+  sequence[index] = number;
+  return true;
+}
+
+void DMX::data(const uint8_t index, const uint8_t* dmx,
+               const uint16_t channels, const bool drop) {
+  const uint32_t bit = 1ul << index;
+  // Without sync packets a universe seen twice starts the next frame
+  if (sent & bit) sync();
+  sent |= bit;
+  uint16_t count = channels / 3;
+  if (count > DMX_VOXELS) count = DMX_VOXELS;
+  const uint16_t offset = index * DMX_VOXELS;
+  if (offset + count > 4096) count = 4096 - offset;
+  if (!drop && count) sink(frame, offset, dmx, count);
+}
+
+void DMX::sync() {
+  frame++;
+  sent = 0;
+}
+
+void DMX::read_artnet(const bool drop) {
+  for (uint8_t n = 0; n < DMX_PACKETS; n++) {
+    const int size = artnet.parsePacket();
+    if (size <= 0) return;
+    if (size < 12 || size > DMX_PACKET_MAX) continue;
+    artnet.read(packet, size);
+    if (memcmp(packet, ARTNET_ID, sizeof(ARTNET_ID))) continue;
+    const uint16_t opcode = packet[8] | packet[9] << 8;
+    if (opcode == ARTNET_SYNC) {
+      sync();
+    } else if (opcode == ARTNET_DMX && size >= ARTNET_DATA) {
+      // 15 bit port address of net, sub net and universe
+      const uint8_t i = index((packet[15] & 0x7F) << 8 | packet[14]);
+      if (i == DMX_UNIVERSES) continue;
+      // Sequence 0 means the sender does not number its packets
+      if (packet[12] && !fresh(i, packet[12])) continue;
+      uint16_t channels = be16(&packet[16]);
+      if (channels > size - ARTNET_DATA) channels = size - ARTNET_DATA;
+      data(i, &packet[ARTNET_DATA], channels, drop);
+    }
+  }
+}
+
+void DMX::read_e131(const bool drop) {
+  for (uint8_t n = 0; n < DMX_PACKETS; n++) {
+    const int size = e131.parsePacket();
+    if (size <= 0) return;
+    if (size < E131_SYNC_SIZE || size > DMX_PACKET_MAX) continue;
+    e131.read(packet, size);
+    if (memcmp(&packet[4], E131_ID, sizeof(E131_ID))) continue;
+    const uint32_t root = be32(&packet[18]);
+    const uint32_t framing = be32(&packet[40]);
+    if (root == E131_ROOT_EXTENDED && framing == E131_FRAMING_SYNC) {
+      sync();
+    } else if (root == E131_ROOT_DATA && framing == E131_FRAMING_DATA &&
+               size > E131_DATA && packet[125] == 0) {
+      if (packet[112] & (E131_PREVIEW | E131_TERMINATED)) continue;
+      const uint8_t i = index(be16(&packet[113]));
+      if (i == DMX_UNIVERSES || !fresh(i, packet[111])) continue;
+      // Property count includes the start code
+      uint16_t channels = be16(&packet[123]) - 1;
+      if (channels > size - E131_DATA) channels = size - E131_DATA;
+      data(i, &packet[E131_DATA], channels, drop);
+    }
+  }
+}
@@ -0,0 +1,64 @@
+#ifndef DMX_H
+#define DMX_H
+#include <Arduino.h>
+#include <WiFiUdp.h>
+/*------------------------------------------------------------------------------
+ * DMX CLASS
+ *------------------------------------------------------------------------------
+ * Receives the cube as a DMX fixture over Art-Net or E1.31 (sACN), unicast or
+ * multicast. Every universe holds 170 RGB voxels in the voxel order of the
+ * Teensy, 25 consecutive universes from the first one cover all 4096. Each
+ * universe goes on as soon as it arrives, as a chunk of the current frame.
+ *
+ * A frame ends with a sync packet (ArtSync or E1.31 synchronization), or
+ * without those when a universe arrives a second time. The Teensy shows a
+ * frame once all of its universes are in, so a frame is never torn.
+ * Retransmits and packets older than the last one of a universe are dropped
+ * by their sequence number before they cost serial bus time.
+ *----------------------------------------------------------------------------*/
+#define DMX_ARTNET_PORT 6454
+#define DMX_E131_PORT 5568
+#define DMX_VOXELS 170
+#define DMX_UNIVERSES 25
+// Packets handled per protocol per loop
+#define DMX_PACKETS 8
+// Largest E1.31 data packet, Art-Net is smaller
+#define DMX_PACKET_MAX 638
+
+class DMX {
+ public:
+  // Voxels offset to offset + count of frame sequence, 3 bytes each
+  typedef void (*sink_t)(uint16_t sequence, uint16_t offset,
+                         const uint8_t* rgb, uint16_t count);
+
+  // Listen for the universes from first on
+  void begin(const uint16_t first, sink_t sink);
+  // Join the multicast groups of the universes on the current address, on
+  // every (re)connect to WiFi
+  void join();
+  // Handle the waiting packets, the voxels are dropped when drop is set
+  void loop(const bool drop);
+
+ private:
+  WiFiUDP artnet;
+  WiFiUDP e131;
+  sink_t sink = nullptr;
+  uint16_t first = 1;
+  uint16_t frame = 0;
+  // Universes of the frame passed on, and those with a sequence number
+  uint32_t sent = 0;
+  uint32_t numbered = 0;
+  uint8_t sequence[DMX_UNIVERSES];
+  uint8_t packet[DMX_PACKET_MAX];
+
+  void read_artnet(const bool drop);
+  void read_e131(const bool drop);
+  // Index of a universe of the cube, DMX_UNIVERSES when it is not one
+  uint8_t index(const uint16_t universe);
+  // Whether the sequence number is newer than the last one of the universe
+  bool fresh(const uint8_t index, const uint8_t number);
+  void data(const uint8_t index, const uint8_t* dmx, const uint16_t channels,
+            const bool drop);
+  void sync();
+};
+#endif
@@ -0,0 +1,127 @@
+#include "Sync.h"
+
+#include <ESP8266WiFi.h>
+#include <string.h>
+/*------------------------------------------------------------------------------
+ * SYNC CLASS
+ *----------------------------------------------------------------------------*/
+// Little endian in the packets, as both ends
+static uint64_t get64(const uint8_t* p) {
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+static void put64(uint8_t* p, const uint64_t v) { memcpy(p, &v, 8); }
+
+void Sync::begin(sink_t sink, Clock* wall) {
+  this->sink = sink;
+  this->wall = wall;
+  udp.begin(SYNC_PORT);
+  Serial.printf("ESP8266 sync on udp port %u ready\n", SYNC_PORT);
+}
+
+void Sync::set(const uint8_t cube, const uint8_t cubes, const bool join) {
+  if (cube != this->cube || cubes != this->cubes) {
+    this->cube = cube;
+    this->cubes = cubes;
+    // A new role starts without a leader or samples
+    offset = 0;
+    heard = 0;
+    count = next = 0;
+  }
+  joining = join;
+  if (joining && leading()) this->join();
+}
+
+void Sync::loop() {
+  if (cubes < 2) return;
+  read();
+  const uint32_t ms = millis();
+  if (leading() && wall && wall->synced()) offset = wall->now() - micros64();
+  if (leading() && ms - beaconed >= SYNC_BEACON_MS) {
+    beaconed = ms;
+    packet[0] = BEACON;
+    put64(&packet[1], epoch);
+    send(WiFi.broadcastIP(), 9);
+  }
+  if (!leading() && leader.isSet() && ms - polled >= SYNC_POLL_MS) {
+    polled = ms;
+    packet[0] = REQUEST;
+    put64(&packet[1], micros64());
+    packet[9] = joining;
+    send(leader, 10);
+  }
+  if (sink && ms - clocked >= SYNC_CLOCK_MS) {
+    clocked = ms;
+    sink(now(), epoch, locked());
+  }
+}
+
+bool Sync::locked() {
+  return leading() || (count && millis() - heard < SYNC_TIMEOUT_MS);
+}
+
+void Sync::send(const IPAddress& to, const uint8_t size) {
+  udp.beginPacket(to, SYNC_PORT);
+  udp.write(packet, size);
+  udp.endPacket();
+}
+
+void Sync::read() {
+  for (uint8_t i = 0; i < SYNC_PACKETS; i++) {
+    const int size = udp.parsePacket();
+    if (size <= 0) return;
+    // Taken first, reading the packet does not delay it
+    const uint64_t arrived = micros64();
+    if (size > (int)sizeof(packet)) continue;
+    udp.read(packet, size);
+    const uint8_t kind = packet[0];
+    if (kind == BEACON && size == 9 && !leading()) {
+      leader = udp.remoteIP();
+    } else if (kind == REQUEST && size == 10 && leading()) {
+      if (packet[9]) join();
+      request(udp.remoteIP(), get64(&packet[1]), arrived);
+    } else if (kind == REPLY && size == 33 && !leading() &&
+               udp.remoteIP() == leader) {
+      epoch = get64(&packet[25]);
+      reply(get64(&packet[1]), get64(&packet[9]), get64(&packet[17]), arrived);
+    }
+  }
+}
+
+// A new epoch ahead, unless the last one is still to come
+void Sync::join() {
+  const uint64_t time = now();
+  if (epoch <= time) epoch = time + SYNC_LEAD_US;
+}
+
+void Sync::request(const IPAddress& from, const uint64_t t1,
+                   const uint64_t t2) {
+  packet[0] = REPLY;
+  put64(&packet[1], t1);
+  put64(&packet[9], t2);
+  put64(&packet[25], epoch);
+  // Last, as close to sending as it gets
+  put64(&packet[17], micros64());
+  send(from, 33);
+}
+
+void Sync::reply(const uint64_t t1, const uint64_t t2, const uint64_t t3,
+                 const uint64_t t4) {
+  // An answer to a request of an earlier leader
+  if (t4 < t1 || t3 < t2) return;
+  const int64_t measured = ((int64_t)(t2 - t1) + (int64_t)(t3 - t4)) / 2;
+  // The leader jumped to its wall clock or restarted
+  if (count && (measured - offset > 1000000 || offset - measured > 1000000))
+    count = next = 0;
+  sample_t& s = samples[next];
+  next = (next + 1) % SYNC_SAMPLES;
+  if (count < SYNC_SAMPLES) count++;
+  s.offset = measured;
+  s.delay = (t4 - t1) - (t3 - t2);
+  const sample_t* best = &samples[0];
+  for (uint8_t i = 1; i < count; i++)
+    if (samples[i].delay < best->delay) best = &samples[i];
+  offset = best->offset;
+  heard = millis();
+}
@@ -0,0 +1,97 @@
+#ifndef SYNC_H
+#define SYNC_H
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#include "Clock.h"
+/*------------------------------------------------------------------------------
+ * SYNC CLASS
+ *------------------------------------------------------------------------------
+ * Shared clock of cubes side by side, so they draw the same frames at the same
+ * time (core/Sync.h of the Teensy). The Teensy tells its position, cube 0 is
+ * the leader and its micros64() is the shared time.
+ *
+ * The leader broadcasts a beacon every second, the others learn its address
+ * from it and ask it for the time four times a second. Like NTP a request
+ * carries the time it was sent (t1), the leader adds when it arrived (t2) and
+ * when the reply leaves (t3), the reply arrives at t4. With equal delays both
+ * ways the offset is ((t2 - t1) + (t3 - t4)) / 2 and the round trip without
+ * the time at the leader is (t4 - t1) - (t3 - t2). WiFi delays come in bursts,
+ * the sample of the last SYNC_SAMPLES with the shortest round trip is the one
+ * used, as in the clock filter of NTP.
+ *
+ * The epoch is the shared time the cubes start their sequence over. A Teensy
+ * that has not started with the others asks to join, the leader then sets a
+ * new epoch SYNC_LEAD_US ahead (unless one is still to come). The followers
+ * get it with their next reply, well before it has come.
+ *
+ * A leader with a synced wall clock (Clock.h) shares Unix time instead of its
+ * micros64(), so cubes on networks that can not see each other start their
+ * sequences within the accuracy of NTP as well. A follower that sees the
+ * leader jump more than a second drops its older samples.
+ *
+ * Every SYNC_CLOCK_MS the Teensy gets a CLOCK frame with the shared time, the
+ * epoch and whether the clock is locked (a recent reply of the leader).
+ *----------------------------------------------------------------------------*/
+#define SYNC_PORT 7001
+#define SYNC_SAMPLES 8
+#define SYNC_BEACON_MS 1000
+#define SYNC_POLL_MS 250
+#define SYNC_CLOCK_MS 100
+// Without a reply of the leader this long the clock is not locked
+#define SYNC_TIMEOUT_MS 3000
+#define SYNC_LEAD_US 1000000ull
+// Packets handled per loop
+#define SYNC_PACKETS 4
+
+class Sync {
+ public:
+  // Shared time, epoch and whether the clock is locked to the leader
+  typedef void (*sink_t)(uint64_t time, uint64_t epoch, bool locked);
+
+  // The leader shares the time of wall once it is synced
+  void begin(sink_t sink, Clock* wall = nullptr);
+  // Position of this cube of cubes and whether it asks to join, from the
+  // Teensy
+  void set(const uint8_t cube, const uint8_t cubes, const bool join);
+  void loop();
+  // Shared time in microseconds
+  uint64_t now() { return micros64() + offset; }
+
+ private:
+  // Kind of packet, the first byte
+  enum kind_t : uint8_t { BEACON = 1, REQUEST = 2, REPLY = 3 };
+  struct sample_t {
+    int64_t offset;
+    uint64_t delay;
+  };
+
+  WiFiUDP udp;
+  sink_t sink = nullptr;
+  Clock* wall = nullptr;
+  uint8_t cube = 0;
+  uint8_t cubes = 1;
+  uint64_t epoch = 0;
+  int64_t offset = 0;
+  // Follower: the leader and its replies
+  IPAddress leader;
+  bool joining = false;
+  uint32_t heard = 0;
+  sample_t samples[SYNC_SAMPLES];
+  uint8_t count = 0;
+  uint8_t next = 0;
+  uint32_t beaconed = 0;
+  uint32_t polled = 0;
+  uint32_t clocked = 0;
+  uint8_t packet[40];
+
+  bool leading() { return cubes > 1 && cube == 0; }
+  bool locked();
+  void send(const IPAddress& to, const uint8_t size);
+  void read();
+  void join();
+  void request(const IPAddress& from, const uint64_t t1, const uint64_t t2);
+  void reply(const uint64_t t1, const uint64_t t2, const uint64_t t3,
+             const uint64_t t4);
+};
+#endif
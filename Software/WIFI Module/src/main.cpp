@@ -1,12 +1,17 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <ArduinoOTA.h>
+#include <ESP8266WebServer.h>
 #include <ESP8266WiFi.h>
 #include <ESP8266mDNS.h>
-#include <NTPClient.h>
+#include <WebSocketsServer.h>
 #include <WiFiUdp.h>
 #include <string.h>
 
+#include "Clock.h"
+#include "DMX.h"
+#include "Sync.h"
+
 // Start and stop bytes for commands (outside of ascii range)
 const char ESP_START = 0xf0;
 const char TEENSY_START = 0xf1;
@@ -14,19 +19,143 @@ const char WIO_START = 0xf2;
 const char ESP_STOP = 0xf8;
 const char TEENSY_STOP = 0xf9;
 const char WIO_STOP = 0xfa;
+// Start of a binary frame: type, length (2 bytes LE), payload, CRC-16 (2
+// bytes LE). Frames are passed through untouched, their bytes may look like
+// start or stop bytes.
+const char FRAME_START = 0xf3;
+// Low priority frame types, dropped while the Teensy asks to throttle
+const uint8_t FRAME_FFT = 1;
+const uint8_t FRAME_WINDOW = 4;
+const uint8_t FRAME_VOXELS = 5;
+// Shared clock of cubes side by side, never dropped
+const uint8_t FRAME_CLOCK = 6;
+// Top view of the cube from the Teensy, only for the clients that asked
+const uint8_t FRAME_PREVIEW = 8;
+// Slices of config.json text, first byte 1 = first and 2 = last
+const uint8_t FRAME_CONFIG = 9;
+// A firmware update of the Teensy, its ACKs are taken aside
+const uint8_t FRAME_UPDATE = 10;
+// A latency probe of the WIO Terminal, stamped on its way to the Teensy
+const uint8_t FRAME_PROBE = 11;
+// Set by the throttle command of the Teensy when it falls behind
+static bool throttled = false;
 const char START = ESP_START;
 const char STOP = ESP_STOP;
 // Buffers used for redirection
 const uint8_t WIFI_TO_SERIAL = 0;
 const uint8_t SERIAL_TO_WIFI = 1;
+// Bytes read per direction per loop, and the longest command
+#define BRIDGE_CHUNK 512
+#define COMMAND_MAX 1024
+// Simultaneous tcp clients, a client without a streaming frame recently is
+// read a quarter chunk per loop so it can not starve the FFT stream
+#define CLIENTS 4
+#define STREAM_MS 1000
+// Longest unit (binary frame or framed command) passed on to the Teensy
+#define UNIT_MAX (COMMAND_MAX + 8)
+// UART baudrate the link starts at, the Teensy has to match it. It moves the
+// link to faster rates with the baud event, see baud().
+#define SERIAL_BAUD 460800
+// A rate change the Teensy does not confirm within this long falls back to
+// SERIAL_BAUD, half the time the Teensy waits
+#define BAUD_CONFIRM_MS 500
+// Hardware flow control on UART0, CTS on GPIO13 and RTS on GPIO15 wired to
+// the Teensy, which needs ESP8266_FLOW as well. RTS holds the Teensy off at
+// this many bytes in the receive FIFO of 128.
+// #define SERIAL_FLOW
+#define SERIAL_FLOW_THRESHOLD 96
+// Rate of the link, and since when a change waits for the Teensy to confirm
+static uint32_t serial_rate = SERIAL_BAUD;
+static bool baud_waiting = false;
+static uint32_t baud_since = 0;
+// Live voxel frames over UDP, every datagram is one chunk (sequence, format,
+// offset, count and the voxels, see core/Voxels.h of the Teensy) and goes on
+// as one VOXELS frame. Reassembly is up to the Teensy, a lost datagram only
+// costs the frame it belongs to.
+#define STREAM_PORT 7000
+#define STREAM_HEADER 7
+#define STREAM_RGB 0
+#define STREAM_DELTA 4
+// Chunks of every 16th frame are never deltas, so a lost frame heals
+#define STREAM_KEYFRAME 16
+#define STREAM_PACKETS 8
+// Audio features of the WIO Terminal over UDP, a datagram is the type of a
+// binary frame and its payload, which starts with a sequence number. Of the
+// datagrams waiting only the newest goes on, one not newer than the last
+// sent is late and dropped, unless that was FEATURE_RESET_MS ago (a restarted
+// sender).
+#define FEATURE_PORT 7002
+#define FEATURE_PACKETS 8
+#define FEATURE_RESET_MS 1000
+// Largest payload of a feature frame, a WINDOW keyframe is 43 bytes
+#define FRAME_FEATURE_MAX 64
+// Joining the access point runs beside the bridge: an attempt gets
+// WIFI_JOIN_MS, after a failure or a lost connection the next one waits a
+// backoff that doubles up to the maximum
+#define WIFI_JOIN_MS 10000
+#define WIFI_BACKOFF_MIN 500
+#define WIFI_BACKOFF_MAX 30000
+// Browsers on a WebSocket, a binary message carries the same units as the tcp
+// socket and gets the Teensy output as binary messages of whole units. What
+// a browser sends is limited to SOCKET_RATE bytes per second with bursts of
+// SOCKET_BURST, a message beyond that is dropped and the browser told once
+// per second. WEBSOCKETS_SERVER_CLIENT_MAX in platformio.ini matches SOCKETS.
+#define SOCKET_PORT 81
+#define SOCKETS 2
+#define SOCKET_RATE 8192
+#define SOCKET_BURST 2048
+// Largest frame of the Teensy taken aside for the preview or an export
+#define ASIDE_MAX (6 + COMMAND_MAX)
+// The Teensy sends the preview while this asks for it every second
+#define PREVIEW_REPEAT_MS 1000
+// config.json of the Teensy over HTTP, GET /config exports it (?all=1 with
+// the defaults), POST /config imports one. Both stream: the export goes out
+// chunked as the CONFIG frames of the Teensy come in, the upload goes on as
+// CONFIG frames of CONFIG_SLICE bytes as it is received. Neither end holds
+// the whole text. A request waits up to CONFIG_WAIT_MS for the Teensy.
+#define HTTP_PORT 80
+#define CONFIG_SLICE 512
+#define CONFIG_WAIT_MS 3000
+// A new Teensy firmware over HTTP, POST /firmware with the .mcfw file of
+// firmware_pack.py. The header goes on as BEGIN and every block as it is
+// received as a DATA frame, then END applies it. Each frame waits for the
+// ACK of the Teensy, which is the flow control, and is sent again up to
+// FIRMWARE_RETRIES times when it got corrupted or its ACK did not come in
+// FIRMWARE_ACK_MS. Only a block is held at a time.
+#define FIRMWARE_BLOCK 1024
+#define FIRMWARE_HEADER 16
+#define FIRMWARE_RECORD 6
+#define FIRMWARE_RETRIES 3
+#define FIRMWARE_ACK_MS 1000
+// Status of the Teensy (core/Firmware.h), and the ones of the ESP8266
+#define FIRMWARE_OK 0
+#define FIRMWARE_CRC 1
+#define FIRMWARE_ORDER 2
+#define FIRMWARE_FORMAT 16
+#define FIRMWARE_TIMEOUT 17
+// Payload of a probe: uint8 id, source, then uint32 us of the wio, wifi,
+// bridge and uart stages, see core/Latency.h of the LED Display
+#define PROBE_SIZE 18
+// Transmit FIFO of the UART, the bytes in it go ahead of a probe
+#define UART_FIFO 128
 
 void startNTP();
 void startWiFi();
+void wifi();
 void startOTA();
 void startMDNS();
 void startSerial();
-void redirect(char c, uint8_t buf);
-void execute(const char* char_buffer);
+void startStream();
+void stream();
+void features();
+void startSync();
+void startSockets();
+void preview();
+void startHTTP();
+void serial();
+void baud(JsonDocument& doc);
+class Client;
+void execute(const char* char_buffer, Client* from);
 void rpc(String msg);
 
 static struct {
@@ -41,14 +170,117 @@ static struct {
       uint16_t ota_port = 8266;
     } server;
   } network;
+  struct {
+    // First of the universes of the cube
+    uint16_t universe = 1;
+  } dmx;
 } Config;
 
 WiFiServer server(Config.network.server.tcp_port);
-// Active WiFiClient tcp/ip connection
-WiFiClient wifiClient;
-// Define NTP Client to get time
-WiFiUDP ntpUDP;
-NTPClient ntpClient(ntpUDP, "pool.ntp.org");
+WebSocketsServer sockets(SOCKET_PORT);
+ESP8266WebServer http(HTTP_PORT);
+// Wall clock from NTP, see Clock.h
+Clock ntp;
+WiFiUDP streamUDP;
+WiFiUDP featureUDP;
+DMX dmx;
+Sync sync;
+
+// A frame of the Teensy being collected aside, see Bridge::pass()
+static uint8_t aside[ASIDE_MAX];
+static size_t aside_size = 0;
+void send_aside();
+void send_export();
+void firmware_ack();
+static void send_probe(uint8_t* frame, uint32_t arrived, Client* to);
+static uint16_t crc16(const uint8_t* data, size_t size, uint16_t crc);
+// An export waits for the CONFIG frames of the Teensy, an import for its
+// result
+static bool exporting = false;
+static bool importing = false;
+static char imported[COMMAND_MAX + 1];
+// An update waits for the ACK of every frame, the status of the last one
+static bool updating = false;
+static bool acked = false;
+static uint16_t ack_next = 0;
+static uint8_t ack_status = FIRMWARE_OK;
+
+// One direction of the bridge. Bytes arrive in chunks, spans between markers
+// are passed on in bulk and commands for the ESP8266 are collected in a fixed
+// buffer. Parser state carries over from one chunk to the next. Only whole
+// units (binary frames and framed commands) are written, so the output of
+// several clients sharing the serial line never interleaves within one.
+class Bridge {
+ public:
+  explicit Bridge(uint8_t src) : src(src) {}
+  void reset();
+  void feed(const uint8_t* data, size_t size, Client* from);
+  // Write the passthrough bytes of this pass up to the last whole unit
+  void flush();
+  // Time of the last streaming frame passed on
+  uint32_t streamed = 0;
+
+ private:
+  const uint8_t src;
+  bool command = false;
+  bool overflow = false;
+  char message[COMMAND_MAX + 1];
+  uint16_t length = 0;
+  // Binary frame being passed through: header bytes, then the rest
+  uint8_t header = 0;
+  uint16_t frame_length = 0;
+  uint32_t remaining = 0;
+  bool dropping = false;
+  // A preview frame or an export of the Teensy, collected aside
+  bool diverting = false;
+  // A probe of a client, collected to be stamped, and when it came in
+  bool probing = false;
+  uint8_t probe[6 + PROBE_SIZE];
+  size_t probe_size = 0;
+  uint32_t probed = 0;
+  // Inside a command framed for the Teensy or WIO Terminal
+  bool unit = false;
+  uint8_t out[UNIT_MAX + BRIDGE_CHUNK];
+  size_t out_size = 0;
+  size_t whole = 0;
+
+  void emit(const uint8_t* data, size_t size);
+  // Frame bytes, passed on, dropped or diverted
+  void pass(const uint8_t* data, size_t size);
+  void mark() {
+    if (!header && !remaining && !unit) whole = out_size;
+  }
+};
+
+// A tcp client or WebSocket slot with its own receive parser
+class Client {
+ public:
+  WiFiClient tcp;
+  // WebSocket number of a browser, -1 for a tcp client
+  int8_t socket = -1;
+  bool open = false;
+  Bridge bridge = Bridge(WIFI_TO_SERIAL);
+  // Receives the Teensy output, its telemetry and the preview, a client
+  // subscribes to each on its own
+  bool subscribed = true;
+  bool telemetry = true;
+  bool preview = false;
+  // Token bucket of a browser, the bytes it may send and messages dropped
+  uint32_t tokens = SOCKET_BURST;
+  uint32_t refilled = 0;
+  uint32_t limited = 0;
+  uint32_t told = 0;
+
+  void reset();
+  bool active() { return socket >= 0 ? open : tcp && tcp.connected(); }
+  void write(const uint8_t* data, size_t size);
+  // A message of a browser fits its rate
+  bool admit(size_t size);
+};
+
+Client clients[CLIENTS];
+Client browsers[SOCKETS];
+Bridge teensy(SERIAL_TO_WIFI);
 
 void setup() {
   startSerial();
@@ -56,97 +288,820 @@ void setup() {
   startOTA();
   startMDNS();
   startNTP();
+  startStream();
+  startSync();
+  startSockets();
+  startHTTP();
 }
 
 void loop() {
+  uint8_t chunk[BRIDGE_CHUNK];
+  wifi();
   // Check for OTA updates
   ArduinoOTA.handle();
-  // Check for new incomming connections
-  WiFiClient client = server.available();
-  if (client) {
-    // Terminate the old connection
-    if (wifiClient) wifiClient.stop();
-    // Set new wifiClient as active connection
-    wifiClient = client;
-  }
-  // Redirect Serial to WiFi
-  if (Serial.available()) {
-    char c = Serial.read();
-    redirect(c, SERIAL_TO_WIFI);
-  }
-  // Redirect WiFi to Serial
-  if (wifiClient && wifiClient.connected() && wifiClient.available()) {
-    char c = wifiClient.read();
-    redirect(c, WIFI_TO_SERIAL);
-  }
-}
-
-// Need to redirect this character or it is part of a command
-void redirect(char c, uint8_t src) {
-  static boolean command[] = {false, false};
-  static String message[] = {"", ""};
-  if (c == START) {
-    message[src] = "";
-    command[src] = true;
-  } else if (c == STOP) {
-    if (command[src]) {
-      execute(message[src].c_str());
+  // Check for new incomming connections, refused when all slots are taken
+  WiFiClient tcp = server.available();
+  if (tcp) {
+    Client* slot = nullptr;
+    for (Client& c : clients)
+      if (!slot && !c.active()) slot = &c;
+    if (slot) {
+      // The bridge coalesces its writes itself, Nagle would only add latency
+      slot->tcp = tcp;
+      slot->tcp.setNoDelay(true);
+      slot->reset();
+    } else {
+      tcp.stop();
     }
-    message[src] = "";
-    command[src] = false;
-  } else {
-    if (command[src]) {
-      // Accumulate command until stop character
-      message[src] += c;
+  }
+  serial();
+  // Voxel frames and audio features from the network, ahead of the tcp
+  // clients
+  stream();
+  features();
+  dmx.loop(throttled);
+  // Browsers, their messages are read in the event callback
+  sockets.loop();
+  preview();
+  http.handleClient();
+  ntp.loop();
+  sync.loop();
+  // Redirect WiFi to Serial, streaming clients first and with a full chunk
+  const uint32_t now = millis();
+  // The Teensy did not follow the rate change, go back to where both start
+  if (baud_waiting && now - baud_since >= BAUD_CONFIRM_MS) {
+    Serial.updateBaudRate(SERIAL_BAUD);
+    serial_rate = SERIAL_BAUD;
+    baud_waiting = false;
+  }
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    for (Client& c : clients) {
+      const bool streaming = now - c.bridge.streamed < STREAM_MS;
+      if (streaming != (pass == 0) || !c.active() || !c.tcp.available())
+        continue;
+      const size_t n =
+          c.tcp.read(chunk, streaming ? sizeof(chunk) : sizeof(chunk) / 4);
+      c.bridge.feed(chunk, n, &c);
+      c.bridge.flush();
+    }
+  }
+}
+
+// Redirect Serial to all subscribed clients, also while a request waits for
+// the Teensy
+void serial() {
+  uint8_t chunk[BRIDGE_CHUNK];
+  size_t n = Serial.available();
+  if (!n) return;
+  if (n > sizeof(chunk)) n = sizeof(chunk);
+  n = Serial.readBytes((char*)chunk, n);
+  teensy.feed(chunk, n, nullptr);
+  teensy.flush();
+}
+
+// Index of the first marker byte (0xf0 and up), size when there is none
+static size_t find(const uint8_t* data, size_t size) {
+  for (size_t i = 0; i < size; i++)
+    if (data[i] >= 0xf0) return i;
+  return size;
+}
+
+void Bridge::reset() {
+  command = overflow = dropping = diverting = unit = false;
+  header = 0;
+  remaining = 0;
+  out_size = whole = 0;
+  streamed = 0;
+}
+
+// Need to redirect these bytes or they are part of a command
+void Bridge::feed(const uint8_t* data, size_t size, Client* from) {
+  size_t i = 0;
+  while (i < size) {
+    if (header) {
+      const uint8_t c = data[i++];
+      if (header == 3) {
+        // The type decides, the start byte was held back until now
+        const bool stream =
+            c == FRAME_FFT || c == FRAME_WINDOW || c == FRAME_VOXELS;
+        if (stream) streamed = millis();
+        dropping = throttled && src == WIFI_TO_SERIAL && stream;
+        diverting = src == SERIAL_TO_WIFI &&
+                    (c == FRAME_PREVIEW || (c == FRAME_CONFIG && exporting) ||
+                     (c == FRAME_UPDATE && updating));
+        if (diverting) aside_size = 0;
+        probing = src == WIFI_TO_SERIAL && c == FRAME_PROBE;
+        if (probing) {
+          probe_size = 0;
+          probed = micros();
+        }
+        pass((const uint8_t*)&FRAME_START, 1);
+      }
+      // Type, length lo, length hi, the payload and CRC follow
+      header--;
+      if (header == 1) frame_length = c;
+      if (header == 0) remaining = (frame_length | c << 8) + 2;
+      pass(&c, 1);
+      mark();
+    } else if (remaining) {
+      // Frame bytes may look like markers, pass them on as they are
+      const size_t k = remaining < size - i ? remaining : size - i;
+      pass(&data[i], k);
+      remaining -= k;
+      i += k;
+      if (!remaining && diverting) send_aside();
+      mark();
+      if (!remaining && probing) {
+        // Behind the bytes before it, a corrupt one is dropped
+        flush();
+        const uint16_t crc = probe[4 + PROBE_SIZE] | probe[5 + PROBE_SIZE] << 8;
+        if (probe_size == sizeof(probe) &&
+            crc16(&probe[1], PROBE_SIZE + 3, 0xFFFF) == crc)
+          send_probe(probe, probed, from);
+        probing = false;
+      }
+    } else if (command) {
+      // Accumulate command until stop character, a new start restarts it
+      size_t k = i;
+      while (k < size && data[k] != (uint8_t)START && data[k] != (uint8_t)STOP)
+        k++;
+      k -= i;
+      if (length + k > COMMAND_MAX) overflow = true;
+      if (!overflow) memcpy(&message[length], &data[i], k);
+      length += overflow ? 0 : k;
+      i += k;
+      if (i == size) break;
+      if (data[i++] == (uint8_t)STOP) {
+        message[length] = 0;
+        if (!overflow) execute(message, from);
+        command = false;
+      }
+      length = 0;
+      overflow = false;
     } else {
-      // Serial passthrough (WIFI to Serial)
-      if (src == WIFI_TO_SERIAL) Serial.write(c);
-      // Serial passthrough (Serial to WiFi)
-      if (src == SERIAL_TO_WIFI && wifiClient && wifiClient.connected())
-        wifiClient.write(c);
+      // Serial passthrough up to the next marker
+      const size_t k = find(&data[i], size - i);
+      emit(&data[i], k);
+      i += k;
+      mark();
+      if (i == size) break;
+      const uint8_t c = data[i++];
+      if (c == (uint8_t)FRAME_START) {
+        header = 3;
+      } else if (c == (uint8_t)START) {
+        command = true;
+        length = 0;
+        overflow = false;
+      } else if (c != (uint8_t)STOP) {
+        // Start and stop bytes of the others are passed on
+        emit(&c, 1);
+        if (c == (uint8_t)TEENSY_START || c == (uint8_t)WIO_START) unit = true;
+        if (c == (uint8_t)TEENSY_STOP || c == (uint8_t)WIO_STOP) unit = false;
+        mark();
+      }
+    }
+  }
+}
+
+void Bridge::pass(const uint8_t* data, size_t size) {
+  if (probing) {
+    if (probe_size + size <= sizeof(probe))
+      memcpy(&probe[probe_size], data, size);
+    probe_size += size;
+  } else if (diverting) {
+    // A frame longer than the buffer is broken, it is not sent
+    if (aside_size + size <= sizeof(aside))
+      memcpy(&aside[aside_size], data, size);
+    aside_size += size;
+  } else if (!dropping) {
+    emit(data, size);
+  }
+}
+
+void Bridge::emit(const uint8_t* data, size_t size) {
+  while (size) {
+    // A unit longer than the buffer is broken anyway, let it go
+    if (out_size == sizeof(out)) {
+      whole = out_size;
+      flush();
+    }
+    size_t k = sizeof(out) - out_size;
+    if (k > size) k = size;
+    memcpy(&out[out_size], data, k);
+    out_size += k;
+    data += k;
+    size -= k;
+  }
+}
+
+void Bridge::flush() {
+  if (whole == 0) return;
+  // Serial passthrough (WIFI to Serial)
+  if (src == WIFI_TO_SERIAL) Serial.write(out, whole);
+  // Serial passthrough (Serial to WiFi), to every subscribed client
+  if (src == SERIAL_TO_WIFI) {
+    for (Client& c : clients)
+      if (c.subscribed && c.active()) c.write(out, whole);
+    for (Client& c : browsers)
+      if (c.subscribed && c.active()) c.write(out, whole);
+  }
+  out_size -= whole;
+  memmove(out, &out[whole], out_size);
+  whole = 0;
+}
+
+void Client::reset() {
+  bridge.reset();
+  subscribed = telemetry = true;
+  preview = false;
+  tokens = SOCKET_BURST;
+  refilled = millis();
+  limited = told = 0;
+}
+
+void Client::write(const uint8_t* data, size_t size) {
+  if (socket >= 0)
+    sockets.sendBIN(socket, data, size);
+  else
+    tcp.write(data, size);
+}
+
+bool Client::admit(size_t size) {
+  const uint32_t now = millis();
+  const uint32_t elapsed = now - refilled;
+  refilled = now;
+  tokens += elapsed >= 1000 ? SOCKET_RATE : elapsed * SOCKET_RATE / 1000;
+  if (tokens > SOCKET_BURST) tokens = SOCKET_BURST;
+  if (size > tokens) {
+    limited++;
+    return false;
+  }
+  tokens -= size;
+  return true;
+}
+
+// A command framed for the clients, WIO_START, text, WIO_STOP
+static size_t reply_unit(uint8_t* out, const char* text) {
+  const size_t n = strlen(text);
+  out[0] = WIO_START;
+  memcpy(&out[1], text, n);
+  out[n + 1] = WIO_STOP;
+  return n + 2;
+}
+
+// Messages of the browsers go the way of the tcp bytes. One over the rate is
+// dropped with what its bridge held of a unit, so the rest of a cut unit is
+// not glued to the next.
+static void on_socket(uint8_t num, WStype_t type, uint8_t* payload,
+                      size_t length) {
+  if (num >= SOCKETS) return;
+  Client& c = browsers[num];
+  switch (type) {
+    case WStype_CONNECTED:
+      c.socket = num;
+      c.reset();
+      c.open = true;
+      break;
+    case WStype_DISCONNECTED:
+      c.open = false;
+      break;
+    case WStype_BIN: {
+      if (!c.admit(length)) {
+        c.bridge.reset();
+        if (millis() - c.told < 1000) break;
+        c.told = millis();
+        char text[64];
+        uint8_t unit[sizeof(text) + 2];
+        StaticJsonDocument<64> doc;
+        doc["event"] = "limited";
+        doc["dropped"] = c.limited;
+        serializeJson(doc, text);
+        c.write(unit, reply_unit(unit, text));
+        break;
+      }
+      c.bridge.feed(payload, length, &c);
+      c.bridge.flush();
+    } break;
+    default:
+      break;
+  }
+}
+
+void startSockets() {
+  sockets.begin();
+  sockets.onEvent(on_socket);
+  Serial.printf("ESP8266 WebSocket on port %u ready\n", SOCKET_PORT);
+}
+
+// A whole frame of the Teensy taken aside, a preview to the clients that
+// asked for it, a slice of config.json to the export waiting for it and an
+// ACK to the update
+void send_aside() {
+  if (aside_size > sizeof(aside)) return;
+  if (aside[1] == FRAME_CONFIG) {
+    send_export();
+    return;
+  }
+  if (aside[1] == FRAME_UPDATE) {
+    firmware_ack();
+    return;
+  }
+  for (Client& c : clients)
+    if (c.preview && c.active()) c.write(aside, aside_size);
+  for (Client& c : browsers)
+    if (c.preview && c.active()) c.write(aside, aside_size);
+}
+
+// Ask the Teensy for the preview while a client wants it, every second so a
+// restarted Teensy starts again, and once more when the last one is gone
+void preview() {
+  static bool asking = false;
+  static uint32_t asked = 0;
+  bool viewers = false;
+  for (Client& c : clients) viewers |= c.preview && c.active();
+  for (Client& c : browsers) viewers |= c.preview && c.active();
+  if (viewers == asking &&
+      (!viewers || millis() - asked < PREVIEW_REPEAT_MS))
+    return;
+  asking = viewers;
+  asked = millis();
+  char buffer[64];
+  StaticJsonDocument<64> doc;
+  doc["event"] = "preview";
+  doc["on"] = viewers;
+  serializeJson(doc, buffer);
+  rpc(buffer);
+}
+
+// CRC-16 CCITT-FALSE of the binary frames, over type, length and payload
+static uint16_t crc16(const uint8_t* data, size_t size, uint16_t crc) {
+  while (size--) {
+    crc ^= *data++ << 8;
+    for (uint8_t i = 0; i < 8; i++)
+      crc = crc & 0x8000 ? crc << 1 ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+// Write a binary frame to the Teensy, the payload starts at frame[4] and
+// there is room for the CRC behind it
+static void send_frame(uint8_t type, uint8_t* frame, uint16_t length) {
+  frame[0] = FRAME_START;
+  frame[1] = type;
+  frame[2] = length & 0xFF;
+  frame[3] = length >> 8;
+  const uint16_t crc = crc16(&frame[1], length + 3, 0xFFFF);
+  frame[4 + length] = crc & 0xFF;
+  frame[5 + length] = crc >> 8;
+  Serial.write(frame, length + 6);
+}
+
+// A probe on its way to the Teensy, the payload at frame[4]: echoed to the
+// client it came from, which times the round trip, and stamped with the time
+// it spent here and the time the UART takes to send it after the FIFO
+static void send_probe(uint8_t* frame, uint32_t arrived, Client* to) {
+  if (to) {
+    char text[48];
+    uint8_t unit[sizeof(text) + 2];
+    StaticJsonDocument<48> doc;
+    doc["event"] = "probe";
+    doc["id"] = frame[4];
+    serializeJson(doc, text, sizeof(text));
+    to->write(unit, reply_unit(unit, text));
+  }
+  const uint32_t queued = UART_FIFO - Serial.availableForWrite();
+  const uint32_t uart =
+      (uint64_t)(queued + 6 + PROBE_SIZE) * 10 * 1000000 / serial_rate;
+  const uint32_t bridge = micros() - arrived;
+  memcpy(&frame[4 + 10], &bridge, 4);
+  memcpy(&frame[4 + 14], &uart, 4);
+  send_frame(FRAME_PROBE, frame, PROBE_SIZE);
+}
+
+// Forward the waiting voxel chunks as whole frames, a bounded number per loop.
+// While the Teensy throttles they are dropped, it keeps the last frame.
+void stream() {
+  static uint8_t frame[4 + COMMAND_MAX + 2];
+  for (uint8_t i = 0; i < STREAM_PACKETS; i++) {
+    const int size = streamUDP.parsePacket();
+    if (size <= 0) return;
+    // The next parsePacket() discards what is left of this one
+    if (size < STREAM_HEADER || size > COMMAND_MAX || throttled) continue;
+    send_frame(FRAME_VOXELS, frame, streamUDP.read(&frame[4], size));
+  }
+}
+
+// Forward the newest of the waiting feature datagrams as a whole frame. They
+// are dropped while the Teensy throttles like the stream. A probe goes
+// behind the window, its echo to the tcp client of the same address.
+void features() {
+  static uint8_t frame[4 + FRAME_FEATURE_MAX + 2];
+  static uint8_t newest[1 + FRAME_FEATURE_MAX];
+  static uint8_t probe[6 + PROBE_SIZE];
+  static uint8_t last = 0;
+  static uint32_t last_at = 0;
+  int size = 0;
+  bool probing = false;
+  uint32_t probed = 0;
+  Client* prober = nullptr;
+  for (uint8_t i = 0; i < FEATURE_PACKETS; i++) {
+    const int n = featureUDP.parsePacket();
+    if (n <= 0) break;
+    if (n < 2 || n > (int)sizeof(newest)) continue;
+    uint8_t datagram[sizeof(newest)];
+    featureUDP.read(datagram, n);
+    if (datagram[0] == FRAME_PROBE) {
+      if (n != 1 + PROBE_SIZE) continue;
+      memcpy(&probe[4], &datagram[1], PROBE_SIZE);
+      probing = true;
+      probed = micros();
+      for (Client& c : clients)
+        if (c.active() && c.tcp.remoteIP() == featureUDP.remoteIP())
+          prober = &c;
+      continue;
+    }
+    const uint8_t ahead = size ? newest[1] : last;
+    const bool reset = !size && millis() - last_at >= FEATURE_RESET_MS;
+    if (!reset && (int8_t)(datagram[1] - ahead) <= 0) continue;
+    memcpy(newest, datagram, n);
+    size = n;
+  }
+  if (throttled) return;
+  if (size) {
+    last = newest[1];
+    last_at = millis();
+    memcpy(&frame[4], &newest[1], size - 1);
+    send_frame(newest[0], frame, size - 1);
+  }
+  if (probing) send_probe(probe, probed, prober);
+}
+
+// XOR delta of a chunk against the frame before, (skip, literals) pairs as
+// decoded by VoxelCodec::decode_delta() on the Teensy. Returns 0 when it is
+// not smaller than capacity.
+static uint16_t encode_delta(uint8_t* out, uint16_t capacity,
+                             const uint8_t* rgb, const uint8_t* previous,
+                             uint16_t count) {
+  uint16_t n = 0, i = 0;
+  while (true) {
+    uint16_t skip = 0;
+    while (i + skip < count && !memcmp(&rgb[(i + skip) * 3],
+                                       &previous[(i + skip) * 3], 3))
+      skip++;
+    if (i + skip == count) break;
+    i += skip;
+    for (; skip > 255; skip -= 255) {
+      if (n + 2 > capacity) return 0;
+      out[n++] = 255;
+      out[n++] = 0;
     }
+    uint16_t literals = 0;
+    while (i + literals < count && literals < 255 &&
+           memcmp(&rgb[(i + literals) * 3], &previous[(i + literals) * 3], 3))
+      literals++;
+    if (n + 2 + literals * 3 > capacity) return 0;
+    out[n++] = skip;
+    out[n++] = literals;
+    for (; literals; literals--, i++)
+      for (uint8_t b = 0; b < 3; b++)
+        out[n++] = rgb[i * 3 + b] ^ previous[i * 3 + b];
+  }
+  if (n == 0 && capacity >= 2) {
+    out[n++] = 0;
+    out[n++] = 0;
   }
+  return n;
+}
+
+// A universe of the DMX receiver as a chunk of a voxel frame. Keyframes are
+// plain RGB, in between a universe goes as a delta when that is smaller.
+static void dmx_voxels(uint16_t sequence, uint16_t offset, const uint8_t* rgb,
+                       uint16_t count) {
+  static uint8_t frame[4 + STREAM_HEADER + DMX_VOXELS * 3 + 2];
+  static uint8_t previous[4096 * 3];
+  uint8_t* chunk = &frame[4];
+  uint8_t* data = &chunk[STREAM_HEADER];
+  uint8_t* before = &previous[offset * 3];
+  uint16_t size = 0;
+  if (sequence % STREAM_KEYFRAME)
+    size = encode_delta(data, count * 3 - 1, rgb, before, count);
+  chunk[2] = size ? STREAM_DELTA : STREAM_RGB;
+  if (!size) {
+    size = count * 3;
+    memcpy(data, rgb, size);
+  }
+  memcpy(before, rgb, count * 3);
+  chunk[0] = sequence & 0xFF;
+  chunk[1] = sequence >> 8;
+  chunk[3] = offset & 0xFF;
+  chunk[4] = offset >> 8;
+  chunk[5] = count & 0xFF;
+  chunk[6] = count >> 8;
+  send_frame(FRAME_VOXELS, frame, STREAM_HEADER + size);
+}
+
+void startStream() {
+  streamUDP.begin(STREAM_PORT);
+  Serial.printf("ESP8266 voxel stream on udp port %u ready\n", STREAM_PORT);
+  featureUDP.begin(FEATURE_PORT);
+  Serial.printf("ESP8266 feature stream on udp port %u ready\n",
+                FEATURE_PORT);
+  dmx.begin(Config.dmx.universe, dmx_voxels);
+}
+
+// Shared time (uint64), epoch (uint64) and flags (1 = locked). Waiting for
+// the serial line only makes the clock look older, the Teensy allows for it.
+static void clock_frame(uint64_t time, uint64_t epoch, bool locked) {
+  uint8_t frame[4 + 17 + 2];
+  memcpy(&frame[4], &time, 8);
+  memcpy(&frame[12], &epoch, 8);
+  frame[20] = locked;
+  send_frame(FRAME_CLOCK, frame, 17);
+}
+
+void startSync() { sync.begin(clock_frame, &ntp); }
+
+// A slice of config.json from the Teensy, its text goes out as a chunk of
+// the response. A corrupt slice ends the export, the client gets cut off
+// text rather than a wrong value.
+void send_export() {
+  const uint16_t length = aside[2] | aside[3] << 8;
+  const uint16_t crc = aside[4 + length] | aside[5 + length] << 8;
+  if (length < 1 || crc16(&aside[1], length + 3, 0xFFFF) != crc) {
+    exporting = false;
+    return;
+  }
+  http.sendContent((const char*)&aside[5], length - 1);
+  if (aside[4] & 2) exporting = false;
+}
+
+// Ask the Teensy for its config and pass the slices on as they come in
+static void on_export() {
+  char buffer[64];
+  StaticJsonDocument<64> doc;
+  doc["event"] = "export";
+  doc["all"] = http.arg("all") == "1";
+  serializeJson(doc, buffer);
+  http.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  http.send(200, "application/json", "");
+  exporting = true;
+  rpc(buffer);
+  const uint32_t start = millis();
+  while (exporting && millis() - start < CONFIG_WAIT_MS) {
+    serial();
+    yield();
+  }
+  exporting = false;
+}
+
+// The body as it arrives, in CONFIG frames of a slice each. The last frame
+// is empty, the end of the body is only known after it.
+static void on_import_body() {
+  static uint8_t frame[4 + 1 + CONFIG_SLICE + 2];
+  static bool first = true;
+  HTTPRaw& raw = http.raw();
+  if (raw.status == RAW_START) {
+    first = true;
+    return;
+  }
+  if (raw.status != RAW_WRITE && raw.status != RAW_END) return;
+  const uint8_t* data = raw.buf;
+  size_t size = raw.status == RAW_WRITE ? raw.currentSize : 0;
+  do {
+    const size_t k = size < CONFIG_SLICE ? size : CONFIG_SLICE;
+    frame[4] = (first ? 1 : 0) | (raw.status == RAW_END ? 2 : 0);
+    memcpy(&frame[5], data, k);
+    send_frame(FRAME_CONFIG, frame, 1 + k);
+    first = false;
+    data += k;
+    size -= k;
+  } while (size);
+  if (raw.status == RAW_END) importing = true;
+}
+
+// Answered with the result of the Teensy once it read the config
+static void on_import() {
+  const uint32_t start = millis();
+  while (importing && millis() - start < CONFIG_WAIT_MS) {
+    serial();
+    yield();
+  }
+  if (importing) {
+    importing = false;
+    http.send(504, "application/json", "{\"event\":\"import\"}");
+    return;
+  }
+  http.send(200, "application/json", imported);
+}
+
+// The ACK of the Teensy to the frame of an update: op 3, uint16 next block,
+// status. One that is corrupt counts as lost.
+void firmware_ack() {
+  const uint16_t length = aside[2] | aside[3] << 8;
+  if (length != 4 || aside[4] != 3) return;
+  const uint16_t crc = aside[8] | aside[9] << 8;
+  if (crc16(&aside[1], length + 3, 0xFFFF) != crc) return;
+  ack_next = aside[5] | aside[6] << 8;
+  ack_status = aside[7];
+  acked = true;
+}
+
+// An UPDATE frame until the Teensy took it, the status of its ACK
+static uint8_t firmware_send(uint8_t* frame, uint16_t length) {
+  uint8_t status = FIRMWARE_TIMEOUT;
+  for (uint8_t attempt = 0; attempt < FIRMWARE_RETRIES; attempt++) {
+    acked = false;
+    send_frame(FRAME_UPDATE, frame, length);
+    const uint32_t start = millis();
+    while (!acked && millis() - start < FIRMWARE_ACK_MS) {
+      serial();
+      yield();
+    }
+    status = acked ? ack_status : FIRMWARE_TIMEOUT;
+    if (status != FIRMWARE_CRC && status != FIRMWARE_TIMEOUT) break;
+  }
+  return status;
+}
+
+// The upload as it arrives: the header, then per block its record (uint16
+// length, bit 15 stored, and uint32 CRC-32) and its bytes. The block is
+// collected behind the header of its DATA frame.
+static uint8_t firmware_frame[4 + 8 + FIRMWARE_BLOCK + 2];
+static uint8_t firmware_header[FIRMWARE_HEADER];
+static uint8_t firmware_record[FIRMWARE_RECORD];
+static uint8_t* firmware_piece = firmware_header;
+static size_t firmware_need = FIRMWARE_HEADER;
+static size_t firmware_have = 0;
+static uint16_t firmware_index = 0;
+static uint16_t firmware_blocks = 0;
+static uint8_t firmware_status = FIRMWARE_OK;
+
+// A whole piece of the upload, the next one to collect
+static void firmware_piece_done() {
+  uint8_t* frame = firmware_frame;
+  if (firmware_piece == firmware_header) {
+    if (memcmp(firmware_header, "MCFW", 4) != 0 ||
+        (firmware_header[12] | firmware_header[13] << 8) != FIRMWARE_BLOCK) {
+      firmware_status = FIRMWARE_FORMAT;
+      return;
+    }
+    firmware_blocks = firmware_header[14] | firmware_header[15] << 8;
+    frame[4] = 0;
+    memcpy(&frame[5], &firmware_header[4], 10);
+    firmware_status = firmware_send(frame, 11);
+    firmware_piece = firmware_record;
+    firmware_need = FIRMWARE_RECORD;
+  } else if (firmware_piece == firmware_record) {
+    const uint16_t length = firmware_record[0] | firmware_record[1] << 8;
+    firmware_need = length & 0x7FFF;
+    if (firmware_need > FIRMWARE_BLOCK || firmware_index >= firmware_blocks) {
+      firmware_status = FIRMWARE_FORMAT;
+      return;
+    }
+    frame[4] = 1;
+    frame[5] = firmware_index & 0xFF;
+    frame[6] = firmware_index >> 8;
+    memcpy(&frame[7], &firmware_record[2], 4);
+    frame[11] = length & 0x8000 ? 1 : 0;
+    firmware_piece = &frame[12];
+  } else {
+    firmware_status = firmware_send(frame, 8 + firmware_need);
+    if (firmware_status == FIRMWARE_OK && ack_next != firmware_index + 1)
+      firmware_status = FIRMWARE_ORDER;
+    firmware_index++;
+    firmware_piece = firmware_record;
+    firmware_need = FIRMWARE_RECORD;
+  }
+}
+
+static void on_firmware_body() {
+  HTTPRaw& raw = http.raw();
+  if (raw.status == RAW_START) {
+    updating = true;
+    firmware_piece = firmware_header;
+    firmware_need = FIRMWARE_HEADER;
+    firmware_have = 0;
+    firmware_index = 0;
+    firmware_blocks = 0;
+    firmware_status = FIRMWARE_OK;
+    return;
+  }
+  if (raw.status == RAW_ABORTED) updating = false;
+  if (raw.status != RAW_WRITE) return;
+  const uint8_t* data = raw.buf;
+  size_t size = raw.currentSize;
+  while (size && firmware_status == FIRMWARE_OK) {
+    size_t k = firmware_need - firmware_have;
+    if (k > size) k = size;
+    memcpy(&firmware_piece[firmware_have], data, k);
+    firmware_have += k;
+    data += k;
+    size -= k;
+    if (firmware_have < firmware_need) continue;
+    firmware_have = 0;
+    firmware_piece_done();
+  }
+}
+
+// Answered once the Teensy verified the image, it resets into it and the
+// link starts over at SERIAL_BAUD
+static void on_firmware() {
+  uint8_t status = firmware_status;
+  if (status == FIRMWARE_OK &&
+      (firmware_index != firmware_blocks || firmware_blocks == 0 ||
+       firmware_piece != firmware_record || firmware_have))
+    status = FIRMWARE_FORMAT;
+  if (status == FIRMWARE_OK) {
+    firmware_frame[4] = 2;
+    firmware_frame[5] = 1;
+    status = firmware_send(firmware_frame, 2);
+  }
+  updating = false;
+  if (status == FIRMWARE_OK) {
+    Serial.updateBaudRate(SERIAL_BAUD);
+    serial_rate = SERIAL_BAUD;
+    baud_waiting = false;
+  }
+  char buffer[96];
+  StaticJsonDocument<96> doc;
+  doc["event"] = "firmware";
+  doc["ok"] = status == FIRMWARE_OK;
+  doc["status"] = status;
+  doc["block"] = firmware_index;
+  serializeJson(doc, buffer);
+  const int code = status == FIRMWARE_OK       ? 200
+                   : status == FIRMWARE_FORMAT  ? 400
+                   : status == FIRMWARE_TIMEOUT ? 504
+                                                : 502;
+  http.send(code, "application/json", buffer);
+}
+
+void startHTTP() {
+  http.on("/config", HTTP_GET, on_export);
+  http.on("/config", HTTP_POST, on_import, on_import_body);
+  http.on("/firmware", HTTP_POST, on_firmware, on_firmware_body);
+  http.begin();
+  Serial.printf("ESP8266 HTTP on port %u ready\n", HTTP_PORT);
 }
 
 void startSerial() {
-  Serial.begin(460800);
+  Serial.begin(SERIAL_BAUD);
+#if defined SERIAL_FLOW
+  // U0CTS and U0RTS are the fourth function of GPIO13 and GPIO15
+  pinMode(13, FUNCTION_4);
+  pinMode(15, FUNCTION_4);
+  USC1(0) = (USC1(0) & ~(0x7F << UCRXHFT)) |
+            SERIAL_FLOW_THRESHOLD << UCRXHFT | 1 << UCRXHFE;
+  USC0(0) |= 1 << UCTXHFE;
+#endif
   Serial.println("ESP8266 Serial ready");
 }
 
+// Start joining, wifi() carries on from the main loop. The server listens
+// from the start and gets clients once there is an address.
 void startWiFi() {
   WiFi.mode(WIFI_STA);
+  WiFi.persistent(true);
+  WiFi.setAutoReconnect(false);
   WiFi.begin(Config.network.wifi.ssid, Config.network.wifi.password);
   Serial.println("Connecting to Wifi");
-  uint16_t retries = 0;
-  while (WiFi.status() != WL_CONNECTED) {
-    Serial.print(".");
-    if (retries++ >= 20) {
-      Serial.println();
-      Serial.println("Unable to connect to Wifi. Rebooting the ESP..");
-      Serial.flush();
-      ESP.reset();
-    }
-    delay(500);
-  }
-  // Functions below may or may not work
-  WiFi.setAutoReconnect(true);
-  WiFi.persistent(true);
-  // Alternatively implement event handler on disconnect
-  WiFi.onStationModeDisconnected(
-      [](const WiFiEventStationModeDisconnected& event) {
-        Serial.println("Disconnected from Wi-Fi, trying to reconnect...");
-        WiFi.disconnect();
-        startWiFi();
-      });
-  Serial.println();
-  Serial.print("Connected to ");
-  Serial.println(Config.network.wifi.ssid);
-  Serial.print("IP address: ");
-  Serial.println(WiFi.localIP());
-  Serial.print("Port: ");
-  Serial.println(Config.network.server.tcp_port);
   server.begin(Config.network.server.tcp_port);
-  Serial.println("ESP8266 WiFi ready");
+}
+
+// Joins again without blocking after a failed attempt or a lost connection
+void wifi() {
+  static bool joined = false;
+  static uint32_t since = 0;
+  static uint32_t wait = WIFI_JOIN_MS;
+  static uint32_t backoff = WIFI_BACKOFF_MIN;
+  const uint32_t now = millis();
+  if (WiFi.status() == WL_CONNECTED) {
+    if (joined) return;
+    joined = true;
+    backoff = WIFI_BACKOFF_MIN;
+    Serial.print("Connected to ");
+    Serial.println(Config.network.wifi.ssid);
+    Serial.print("IP address: ");
+    Serial.println(WiFi.localIP());
+    Serial.print("Port: ");
+    Serial.println(Config.network.server.tcp_port);
+    Serial.println("ESP8266 WiFi ready");
+    // The groups of a join before there was an address are gone
+    dmx.join();
+    return;
+  }
+  if (joined) {
+    Serial.println("Disconnected from Wi-Fi, trying to reconnect...");
+    joined = false;
+    since = now;
+    wait = backoff;
+  }
+  if (now - since < wait) return;
+  WiFi.disconnect();
+  WiFi.begin(Config.network.wifi.ssid, Config.network.wifi.password);
+  since = now;
+  wait = WIFI_JOIN_MS + backoff;
+  backoff = backoff * 2 < WIFI_BACKOFF_MAX ? backoff * 2 : WIFI_BACKOFF_MAX;
 }
 
 void startOTA() {
@@ -187,7 +1142,21 @@ void startMDNS() {
                 Config.network.server.hostname);
 }
 
-void startNTP() { ntpClient.begin(); }
+// The time as the Teensy asks for it, Unix seconds and the microseconds into
+// the second. Pushed as soon as the clock is synced, a request before that
+// gets synced false.
+static void send_time(uint64_t time) {
+  char buffer[128];
+  StaticJsonDocument<128> doc;
+  doc["event"] = "time";
+  doc["epoc"] = (uint32_t)(time / 1000000);
+  doc["us"] = (uint32_t)(time % 1000000);
+  doc["synced"] = ntp.synced();
+  serializeJson(doc, buffer);
+  rpc(buffer);
+}
+
+void startNTP() { ntp.begin(send_time); }
 
 void rpc(String msg) {
   Serial.write(TEENSY_START);
@@ -195,9 +1164,21 @@ void rpc(String msg) {
   Serial.write(TEENSY_STOP);
 }
 
-// Executes a json command present in the char_buffer
-void execute(const char* char_buffer) {
-  char buffer[1024];
+// A command of the Teensy to the subscribed clients, framed like its replies
+static void pass_on(const char* text, const bool telemetry) {
+  static uint8_t unit[COMMAND_MAX + 2];
+  const size_t n = reply_unit(unit, text);
+  for (Client& c : clients)
+    if (c.subscribed && (c.telemetry || !telemetry) && c.active())
+      c.write(unit, n);
+  for (Client& c : browsers)
+    if (c.subscribed && (c.telemetry || !telemetry) && c.active())
+      c.write(unit, n);
+}
+
+// Executes a json command present in the char_buffer, from a tcp client or
+// from the Teensy (from is nullptr)
+void execute(const char* char_buffer, Client* from) {
   StaticJsonDocument<1024> doc;
   DeserializationError err = deserializeJson(doc, char_buffer);
   if (err) {
@@ -207,12 +1188,54 @@ void execute(const char* char_buffer) {
   String event = doc["event"];
   Serial.printf("Executing: %s\n", event.c_str());
   if (event.equals("time")) {
-    doc.clear();
-    ntpClient.update();
-    doc["event"] = "time";
-    doc["epoc"] = ntpClient.getEpochTime();
+    send_time(ntp.now());
+  } else if (event.equals("throttle")) {
+    throttled = doc["on"];
+  } else if (event.equals("baud") && !from) {
+    baud(doc);
+  } else if (event.equals("subscribe") && from) {
+    // Whether this client receives the Teensy output, its telemetry and the
+    // preview, the ones left out stay as they were
+    from->subscribed = doc["on"] | true;
+    from->telemetry = doc["telemetry"] | from->telemetry;
+    from->preview = doc["preview"] | from->preview;
+  } else if (event.equals("sync") && !from) {
+    // Position of the cube among the cubes sharing an animation
+    sync.set(doc["cube"] | 0, doc["cubes"] | 1, doc["join"] | false);
+  } else if (event.equals("import") && !from) {
+    // The result of an upload, for the request waiting for it and the
+    // clients like the telemetry
+    snprintf(imported, sizeof(imported), "%s", char_buffer);
+    importing = false;
+    pass_on(char_buffer, false);
+  } else if (event.equals("telemetry") && !from) {
+    // Published by the Teensy, passed on like its replies
+    pass_on(char_buffer, true);
+  }
+}
+
+// The Teensy moves the link to another rate: acknowledged at the old rate,
+// then confirmed by the Teensy at the new one. A confirmation of the rate in
+// use is answered again, in case the answer got lost.
+void baud(JsonDocument& doc) {
+  char buffer[64];
+  const uint32_t rate = doc["rate"] | 0;
+  const uint32_t confirm = doc["confirm"] | 0;
+  doc.clear();
+  doc["event"] = "baud";
+  if (rate) {
+    doc["rate"] = rate;
+    serializeJson(doc, buffer);
+    rpc(buffer);
+    Serial.flush();
+    Serial.updateBaudRate(rate);
+    serial_rate = rate;
+    baud_waiting = true;
+    baud_since = millis();
+  } else if (confirm && confirm == serial_rate) {
+    baud_waiting = false;
+    doc["ok"] = confirm;
     serializeJson(doc, buffer);
-    doc.clear();
     rpc(buffer);
   }
-}
\ No newline at end of file
+}
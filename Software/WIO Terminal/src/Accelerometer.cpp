@@ -0,0 +1,77 @@
+#include "Accelerometer.h"
+
+// Registers of the LIS3DHTR, the top bit of the address auto-increments it
+static const uint8_t WHO_AM_I = 0x0F;
+static const uint8_t CTRL_REG1 = 0x20;
+static const uint8_t CTRL_REG4 = 0x23;
+static const uint8_t CTRL_REG5 = 0x24;
+static const uint8_t OUT_X_L = 0x28;
+static const uint8_t FIFO_CTRL_REG = 0x2E;
+static const uint8_t FIFO_SRC_REG = 0x2F;
+static const uint8_t AUTO_INCREMENT = 0x80;
+
+static const uint8_t LIS3DHTR_ID = 0x33;
+// Raw counts per g at +-2g, as in the Seeed library
+static const int32_t COUNTS_PER_G = 16380;
+
+void Accelerometer::write_register(uint8_t reg, uint8_t value) {
+  wire->beginTransmission(address);
+  wire->write(reg);
+  wire->write(value);
+  wire->endTransmission();
+}
+
+uint8_t Accelerometer::read_register(uint8_t reg) {
+  wire->beginTransmission(address);
+  wire->write(reg);
+  wire->endTransmission(false);
+  wire->requestFrom(address, (uint8_t)1);
+  return wire->available() ? wire->read() : 0;
+}
+
+bool Accelerometer::begin(TwoWire &wire, uint8_t address) {
+  this->wire = &wire;
+  this->address = address;
+  wire.begin();
+  if (read_register(WHO_AM_I) != LIS3DHTR_ID) return false;
+  // ODR with X, Y and Z on; block data update, +-2g, high resolution
+  write_register(CTRL_REG1, ACCEL_ODR << 4 | 0x07);
+  write_register(CTRL_REG4, 0x88);
+  // FIFO on, bypass first to empty it, then stream
+  write_register(CTRL_REG5, 0x40);
+  write_register(FIFO_CTRL_REG, 0x00);
+  write_register(FIFO_CTRL_REG, 0x80);
+  return true;
+}
+
+const int16_t *Accelerometer::read() {
+  if (!wire) return mg;
+  // Unread samples in the low 5 bits, the FIFO is full when OVRN is set
+  const uint8_t source = read_register(FIFO_SRC_REG);
+  const bool overrun = source & 0x40;
+  const uint8_t count = overrun ? ACCEL_FIFO : source & 0x1F;
+  if (overrun) overruns++;
+  if (!count) return mg;
+
+  // 192 bytes at most, within the 256 byte receive buffer of Wire
+  wire->beginTransmission(address);
+  wire->write(OUT_X_L | AUTO_INCREMENT);
+  wire->endTransmission(false);
+  const uint8_t received = wire->requestFrom(address, (uint8_t)(count * 6));
+  int32_t sum[3] = {0, 0, 0};
+  uint8_t n = 0;
+  for (; n < received / 6; n++)
+    for (uint8_t i = 0; i < 3; i++) {
+      const uint8_t low = wire->read();
+      sum[i] += (int16_t)(wire->read() << 8 | low);
+    }
+  while (wire->available()) wire->read();
+  if (!n) return mg;
+
+  samples += n;
+  for (uint8_t i = 0; i < 3; i++) {
+    int32_t v = sum[i] * 1000 / (COUNTS_PER_G * n);
+    mg[i] = v > 32767 ? 32767 : v < -32767 ? -32767 : v;
+  }
+  return mg;
+}
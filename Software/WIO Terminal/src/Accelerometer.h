@@ -0,0 +1,39 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+
+// Output data rate of the LIS3DHTR, CTRL_REG1 ODR code 6 is 200 Hz, 3 samples
+// per 16ms window
+#define ACCEL_ODR 6
+// Samples the FIFO of the LIS3DHTR holds, older ones are overwritten
+#define ACCEL_FIFO 32
+
+/*
+ * LIS3DHTR on Wire1 in FIFO stream mode. It samples X, Y and Z at ACCEL_ODR
+ * into its own FIFO, read() drains every sample since the last call with one
+ * auto-increment burst and returns their mean, so a window costs two I2C
+ * transactions instead of one per axis and the vector is filtered over the
+ * window instead of being a single sample. Full scale is +-2g in high
+ * resolution, read() scales like getAcceleration() of the Seeed library did.
+ */
+class Accelerometer {
+ private:
+  TwoWire *wire = nullptr;
+  uint8_t address;
+  // The last mean, returned again when the FIFO was empty
+  int16_t mg[3] = {0, 0, 0};
+
+ public:
+  // Samples read and FIFO overruns, windows that missed samples
+  uint32_t samples = 0;
+  uint32_t overruns = 0;
+
+  // Set up the sensor, false when it does not answer
+  bool begin(TwoWire &wire, uint8_t address = 0x18);
+  // Mean in milli g of the samples since the last call
+  const int16_t *read();
+
+ private:
+  void write_register(uint8_t reg, uint8_t value);
+  uint8_t read_register(uint8_t reg);
+};
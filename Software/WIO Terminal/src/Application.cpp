@@ -3,6 +3,7 @@
 #include <Arduino.h>
 
 #include "AudioProcessing/Processor.h"
+#include "Buttons.h"
 #include "Display.h"
 #include "Sampler.h"
 #include "Serializer.h"
@@ -13,23 +14,15 @@
 Application::Application(Display &display) {
   m_window_size = WINDOW_SIZE;
   m_ui = new UI(display, m_window_size);
-  m_processor = new Processor(m_window_size);
-  m_sampler = new Sampler(SAMPLE_RATE, m_window_size);
+  m_processor = new Processor(m_window_size, HOP_SIZE);
+  m_sampler = new Sampler(SAMPLE_RATE, HOP_SIZE);
   m_tcp = new TCP();
   m_serializer = new Serializer(m_window_size, m_tcp);
-
-  pinMode(WIO_5S_PRESS, INPUT_PULLUP);
-  pinMode(WIO_KEY_A, INPUT_PULLUP);
-  pinMode(WIO_KEY_B, INPUT_PULLUP);
-  pinMode(WIO_KEY_C, INPUT_PULLUP);
-  pinMode(WIO_5S_UP, INPUT_PULLUP);
-  pinMode(WIO_5S_DOWN, INPUT_PULLUP);
-  pinMode(WIO_5S_LEFT, INPUT_PULLUP);
-  pinMode(WIO_5S_RIGHT, INPUT_PULLUP);
-  pinMode(WIO_5S_PRESS, INPUT_PULLUP);
+  m_buttons = new Buttons();
 }
 
 void Application::begin() {
+  m_buttons->begin();
   // start sampling from the microphone
   m_sampler->start();
 }
@@ -39,23 +32,42 @@ int process_count = 0;
 int last_push = 0;
 
 void Application::loop() {
-  auto start = millis();
-  // run the fft
-  m_processor->update(m_sampler->get_buffer());
-  auto end = millis();
-  process_time += end - start;
-  process_count++;
-  if (process_count == 20) {
-    Serial.printf("Processing time %ld\n", process_time / 20);
-    process_count = 0;
-    process_time = 0;
+  // button changes go out right away, not with the next window
+  m_buttons->loop();
+  uint8_t buttons;
+  uint32_t changed;
+  while (m_buttons->next(buttons, changed)) {
+    m_serializer->button(buttons, changed);
+    m_serializer->probe(false, (millis() - changed) * 1000);
+  }
+  // analyse the window again every hop the sampler completes, the UI sends
+  // its strips in between
+  int16_t *hop = m_sampler->read();
+  if (hop) {
+    auto start = micros();
+    // run the fft
+    m_processor->update(hop);
+    auto end = micros();
+    process_time += end - start;
+    process_count++;
+    if (process_count == 20) {
+      Serial.printf("Processing time %ldus\n", process_time / 20);
+      process_count = 0;
+      process_time = 0;
+    }
+    m_serializer->update(m_processor->m_bands, m_sampler->time(),
+                         m_processor->m_onset, m_buttons->pressed());
+    // an onset is somewhere in the hop, taken as read when it was complete
+    if (m_processor->m_onset)
+      m_serializer->probe(true, HOP_SIZE * 1000000UL / SAMPLE_RATE +
+                                    micros() - start);
+    m_ui->update(m_processor->m_window, m_processor->m_bands);
   }
-  // m_ui->update(m_processor->m_fft_input, m_processor->m_energy);
-  m_serializer->update(m_processor->m_energy);
+  m_ui->loop();
   //  change display on button push
   if (digitalRead(WIO_5S_PRESS) == LOW && millis() - last_push > 500) {
     last_push = millis();
-    // m_ui->toggle_display();
+    m_ui->toggle_display();
   }
   m_tcp->loop();
-}
\ No newline at end of file
+}
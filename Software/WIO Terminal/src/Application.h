@@ -1,6 +1,7 @@
 #pragma once
 
 class UI;
+class Buttons;
 class Processor;
 class Sampler;
 class Display;
@@ -11,6 +12,7 @@ class Application {
  private:
   int m_window_size;
   UI *m_ui;
+  Buttons *m_buttons;
   Processor *m_processor;
   Sampler *m_sampler;
   Serializer *m_serializer;
@@ -0,0 +1,50 @@
+#include "AutoGain.h"
+
+// log2(1 + i / 16) in q8
+static const uint8_t LOG2_FRACTION[16] = {0,   22,  44,  63,  82,  100,
+                                          118, 134, 150, 165, 179, 193,
+                                          207, 220, 232, 244};
+
+AutoGain::AutoGain()
+{
+  for (int i = 0; i < BANDS; i++)
+  {
+    m_floor[i] = BAND_FLOOR << 8;
+    m_peak[i] = (BAND_FLOOR + AGC_RANGE_MIN) << 8;
+  }
+}
+
+int32_t AutoGain::log2_q8(uint64_t x)
+{
+  if (!x)
+    return 0;
+  const int msb = 63 - __builtin_clzll(x);
+  const int fraction = msb >= 4 ? x >> (msb - 4) & 15 : x << (4 - msb) & 15;
+  return msb << 8 | LOG2_FRACTION[fraction];
+}
+
+void AutoGain::update(const int32_t *power, uint8_t *bands)
+{
+  for (int i = 0; i < BANDS; i++)
+  {
+    const int32_t p = power[i];
+    int32_t &floor = m_floor[i];
+    int32_t &peak = m_peak[i];
+    // the floor drops fast to the quietest hops and creeps up with the room
+    if (p < floor)
+      floor += (p - floor) >> AGC_FLOOR_FALL;
+    else
+      floor += (p - floor) >> AGC_FLOOR_RISE;
+    if (floor < BAND_FLOOR << 8)
+      floor = BAND_FLOOR << 8;
+    if (p > peak)
+      peak = p;
+    else
+      peak += (p - peak) >> AGC_PEAK_DECAY;
+    int32_t range = peak - floor;
+    if (range < AGC_RANGE_MIN << 8)
+      range = AGC_RANGE_MIN << 8;
+    const int32_t level = (p - floor) * 16 / range;
+    bands[i] = level < 0 ? 0 : level > 15 ? 15 : level;
+  }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "../config.h"
+
+// Automatic gain of the bands, integer only. Each band keeps a running noise
+// floor and peak of its log2 power in q8. The floor follows the power down
+// within a few hops and up over AGC_FLOOR_RISE, the peak jumps up and decays
+// over AGC_PEAK_DECAY. A band maps from its floor to its peak onto the 16
+// levels, at least AGC_RANGE_MIN levels of 3dB apart so a quiet room shows
+// small bars instead of its noise, and the floor never goes below
+// BAND_FLOOR.
+class AutoGain
+{
+private:
+  int32_t m_floor[BANDS];
+  int32_t m_peak[BANDS];
+
+public:
+  AutoGain();
+  // log2 of the power in q8, see log2_q8(), to levels of 0 to 15
+  void update(const int32_t *power, uint8_t *bands);
+  // log2 of x in q8, the fraction from a 16 entry table, 0 for 0
+  static int32_t log2_q8(uint64_t x);
+};
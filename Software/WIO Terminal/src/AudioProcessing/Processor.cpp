@@ -1,27 +1,109 @@
 #include <Arduino.h>
 #include "Processor.h"
+#include "AutoGain.h"
+#include "RealFFT.h"
 #include "approx_fft.h"
 
-Processor::Processor(int window_size)
+Processor::Processor(int window_size, int hop_size)
 {
   m_window_size = window_size;
+  m_hop_size = hop_size;
+#ifdef USE_APPROX_FFT
   m_fft_input = static_cast<int *>(malloc(sizeof(int) * window_size));
   m_real = static_cast<int *>(malloc(sizeof(int) * window_size));
   m_imag = static_cast<int *>(malloc(sizeof(int) * window_size));
   m_energy = static_cast<int *>(malloc(sizeof(int) * window_size / 2));
+#endif
+  m_fft = new RealFFT(window_size, SAMPLE_BITS);
+  m_gain = new AutoGain();
+  m_window = static_cast<int16_t *>(calloc(window_size, sizeof(int16_t)));
+  memset(m_bands, 0, sizeof(m_bands));
+  memset(m_levels, 0, sizeof(m_levels));
+  m_flux_mean = 0;
+  m_hold = 0;
+  m_flux = 0;
+  m_onset = false;
+
+  // log spaced from bin 1 (bin 0 has dc and mains hum) to the last bin, at
+  // least one bin per band
+  const int bins = window_size / 2;
+  m_band_edges[0] = 1;
+  for (int i = 1; i <= BANDS; i++)
+  {
+    int edge = lrintf(powf(bins, (float)i / BANDS));
+    if (edge <= m_band_edges[i - 1])
+      edge = m_band_edges[i - 1] + 1;
+    m_band_edges[i] = edge < bins ? edge : bins;
+  }
 }
 
 void Processor::update(int16_t *samples)
 {
-  // grab the sample
+  // the hop goes behind the samples of the window before, the FFT reads the
+  // window and keeps its magnitudes in its own buffer
+  const int keep = m_window_size - m_hop_size;
+  memmove(m_window, &m_window[m_hop_size], sizeof(int16_t) * keep);
+  memcpy(&m_window[keep], samples, sizeof(int16_t) * m_hop_size);
+#ifdef USE_APPROX_FFT
   for (int i = 0; i < m_window_size; i++)
   {
-    m_fft_input[i] = samples[i];
+    m_fft_input[i] = m_window[i];
   }
-  Approx_FFT(m_fft_input, m_real, m_imag, m_window_size, 8000);
+  Approx_FFT(m_fft_input, m_real, m_imag, m_window_size, SAMPLE_RATE);
 
   for (int i = 0; i < m_window_size / 2; i++)
   {
     m_energy[i] = m_real[i];
   }
-}
\ No newline at end of file
+#else
+  m_fft->update(m_window);
+#endif
+  update_bands();
+#ifdef USE_AGC
+  m_gain->update(m_power, m_bands);
+#endif
+}
+
+// magnitude of a bin of the last update
+int32_t Processor::energy(int bin)
+{
+#ifdef USE_APPROX_FFT
+  return m_energy[bin];
+#else
+  return m_fft->magnitude(bin);
+#endif
+}
+
+// mean power of the bins of each band in 3dB steps above BAND_FLOOR, the
+// flux is the sum of the levels that rose since the hop before. The bands are
+// these levels unless the automatic gain maps them after
+void Processor::update_bands()
+{
+  m_flux = 0;
+  for (int i = 0; i < BANDS; i++)
+  {
+    const int from = m_band_edges[i];
+    const int to = m_band_edges[i + 1];
+    uint64_t power = 0;
+    for (int bin = from; bin < to; bin++)
+    {
+      const int64_t e = energy(bin);
+      power += e * e;
+    }
+    if (to > from)
+      power /= to - from;
+    m_power[i] = AutoGain::log2_q8(power);
+    int level = power ? (m_power[i] >> 8) - BAND_FLOOR : 0;
+    level = level < 0 ? 0 : level;
+    if (level > m_levels[i])
+      m_flux += level - m_levels[i];
+    m_levels[i] = level;
+    m_bands[i] = level > 15 ? 15 : level;
+  }
+
+  const int threshold = (m_flux_mean * ONSET_RATIO >> 8) + ONSET_MIN;
+  m_onset = !m_hold && m_flux > threshold;
+  m_hold = m_onset ? ONSET_HOLD : m_hold ? m_hold - 1 : 0;
+  // mean over about 16 hops
+  m_flux_mean += m_flux - (m_flux_mean >> 4);
+}
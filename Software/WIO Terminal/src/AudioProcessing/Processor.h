@@ -2,16 +2,49 @@
 
 #include <stdint.h>
 
+#include "../config.h"
+
+class RealFFT;
+class AutoGain;
+
 class Processor
 {
 private:
-public:
-  int m_window_size;
-  int *m_energy;
+  RealFFT *m_fft;
+  AutoGain *m_gain;
+  // first bin of every band and the end of the last one
+  uint16_t m_band_edges[BANDS + 1];
+  // unclamped levels of the last hop, running mean of the flux in 1/16,
+  // hops left before the next onset
+  int8_t m_levels[BANDS];
+  // log2 of the mean power of every band in q8
+  int32_t m_power[BANDS];
+  int32_t m_flux_mean;
+  int m_hold;
+
+#ifdef USE_APPROX_FFT
+  // Approx_FFT scales its input in place and needs a real and imaginary part
   int *m_fft_input;
   int *m_imag;
   int *m_real;
+  int *m_energy;
+#endif
+
+  void update_bands();
+  int32_t energy(int bin);
+
+public:
+  int m_window_size;
+  int m_hop_size;
+  // the last window_size samples
+  int16_t *m_window;
+  // level of every band, 0 to 15, after the automatic gain
+  uint8_t m_bands[BANDS];
+  // rise of the bands over the last hop and whether it is an onset
+  int m_flux;
+  bool m_onset;
 
-  Processor(int window_size);
+  Processor(int window_size, int hop_size);
+  // slide the window by hop_size samples and analyse it again
   void update(int16_t *samples);
-};
\ No newline at end of file
+};
@@ -0,0 +1,132 @@
+#include "RealFFT.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+RealFFT::RealFFT(int size, int bits)
+{
+  m_size = size;
+  m_bits = bits;
+  m_points = size / 2;
+  m_cos = static_cast<int16_t *>(malloc(sizeof(int16_t) * size));
+  m_sin = static_cast<int16_t *>(malloc(sizeof(int16_t) * size));
+  m_window = static_cast<int16_t *>(malloc(sizeof(int16_t) * size));
+  m_reverse = static_cast<uint16_t *>(malloc(sizeof(uint16_t) * m_points));
+  m_data = static_cast<int32_t *>(malloc(sizeof(int32_t) * size));
+  for (int i = 0; i < size; i++)
+  {
+    const float angle = 2 * M_PI * i / size;
+    m_cos[i] = lrintf(cosf(angle) * 32767);
+    m_sin[i] = lrintf(sinf(angle) * 32767);
+    m_window[i] = lrintf((0.5f - 0.5f * cosf(angle)) * 32767);
+  }
+  int digits = 0;
+  while ((1 << (2 * digits)) < m_points)
+    digits++;
+  for (int i = 0; i < m_points; i++)
+  {
+    int r = 0;
+    for (int d = 0, v = i; d < digits; d++, v >>= 2)
+      r = (r << 2) | (v & 3);
+    m_reverse[i] = r;
+  }
+}
+
+// (re + j im) * e^(-j 2 pi k / size)
+static inline void rotate(int32_t &re, int32_t &im, int16_t c, int16_t s)
+{
+  const int32_t r = ((int64_t)re * c + (int64_t)im * s) >> 15;
+  im = ((int64_t)im * c - (int64_t)re * s) >> 15;
+  re = r;
+}
+
+// radix 4 decimation in frequency, in place, output in base 4 digit reversed
+// order
+void RealFFT::transform()
+{
+  int32_t *x = m_data;
+  // twiddles of the complex transform are every 2nd of the real one
+  for (int span = m_points, step = 2; span >= 4; span /= 4, step *= 4)
+  {
+    const int q = span / 4;
+    for (int j = 0; j < q; j++)
+    {
+      const int k1 = j * step;
+      const int k2 = 2 * k1;
+      const int k3 = 3 * k1;
+      for (int i = j; i < m_points; i += span)
+      {
+        int32_t *a = &x[2 * i];
+        int32_t *b = &x[2 * (i + q)];
+        int32_t *c = &x[2 * (i + 2 * q)];
+        int32_t *d = &x[2 * (i + 3 * q)];
+        const int32_t t0r = a[0] + c[0], t0i = a[1] + c[1];
+        const int32_t t1r = a[0] - c[0], t1i = a[1] - c[1];
+        const int32_t t2r = b[0] + d[0], t2i = b[1] + d[1];
+        const int32_t t3r = b[0] - d[0], t3i = b[1] - d[1];
+        a[0] = t0r + t2r;
+        a[1] = t0i + t2i;
+        // t1 - j t3, t0 - t2 and t1 + j t3, rotated by their twiddle
+        int32_t yr = t1r + t3i, yi = t1i - t3r;
+        rotate(yr, yi, m_cos[k1], m_sin[k1]);
+        b[0] = yr;
+        b[1] = yi;
+        yr = t0r - t2r;
+        yi = t0i - t2i;
+        rotate(yr, yi, m_cos[k2], m_sin[k2]);
+        c[0] = yr;
+        c[1] = yi;
+        yr = t1r - t3i;
+        yi = t1i + t3r;
+        rotate(yr, yi, m_cos[k3], m_sin[k3]);
+        d[0] = yr;
+        d[1] = yi;
+      }
+    }
+  }
+}
+
+// bin k of the real input from the complex points a = Z[k] and b =
+// Z[points - k]: half the sum of a and the conjugate of b is the even part,
+// half their difference over j the odd part, rotated by e^(-j 2 pi k / size).
+// Alpha max plus beta min magnitude, within 4%
+static inline int32_t bin_magnitude(const int32_t *a, const int32_t *b,
+                                    int16_t c, int16_t s)
+{
+  const int32_t er = (a[0] + b[0]) >> 1, ei = (a[1] - b[1]) >> 1;
+  int32_t odr = (a[1] + b[1]) >> 1, odi = (b[0] - a[0]) >> 1;
+  rotate(odr, odi, c, s);
+  int32_t re = abs(er + odr), im = abs(ei + odi);
+  if (re < im)
+  {
+    const int32_t t = re;
+    re = im;
+    im = t;
+  }
+  return re + (im * 3 >> 3);
+}
+
+void RealFFT::update(const int16_t *samples)
+{
+  // remove dc, window, scale to q15 and pack even samples as real, odd as imaginary parts
+  int32_t mean = 0;
+  for (int i = 0; i < m_size; i++)
+    mean += samples[i];
+  mean /= m_size;
+  for (int i = 0; i < m_size; i++)
+    m_data[i] = ((samples[i] - mean) * m_window[i]) >> m_bits;
+  transform();
+
+  // Z is in digit reversed order, bins k and points - k take the same two
+  // points, so both magnitudes go into their real parts once they are read
+  for (int k = 0; k <= m_points / 2; k++)
+  {
+    const int m = (m_points - k) % m_points;
+    int32_t *a = &m_data[2 * m_reverse[k]];
+    int32_t *b = &m_data[2 * m_reverse[m]];
+    const int32_t at_k = bin_magnitude(a, b, m_cos[k], m_sin[k]);
+    const int32_t at_m = bin_magnitude(b, a, m_cos[m], m_sin[m]);
+    a[0] = at_k;
+    b[0] = at_m;
+  }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+
+// Fixed point FFT of a real window of size samples, size is 2 x a power of
+// 4 (32, 128, 512, 2048). The window is packed into a complex sequence of
+// size / 2 points, transformed with radix 4 butterflies and split into the
+// size / 2 bins of the real input. Twiddles and the Hann window are q15 and
+// computed once, data stays in 32 bit so nothing is scaled between stages:
+// a full scale q15 sine ends up around 2^22 in its bin.
+class RealFFT
+{
+private:
+  int m_size;
+  int m_points;
+  // bits of the samples
+  int m_bits;
+  // cos and sin of 2 pi k / size in q15
+  int16_t *m_cos;
+  int16_t *m_sin;
+  int16_t *m_window;
+  // base 4 digit reversal of the complex points
+  uint16_t *m_reverse;
+  // interleaved real and imaginary parts
+  int32_t *m_data;
+
+  void transform();
+
+public:
+  // size samples of bits each, at most 15
+  RealFFT(int size, int bits);
+  // Hann windowed transform of the samples, dc removed, the magnitudes of
+  // the size / 2 bins are written over the transform
+  void update(const int16_t *samples);
+  // magnitude of bin k after update(), in the slot of its complex point
+  int32_t magnitude(int k) const { return m_data[2 * m_reverse[k]]; }
+};
@@ -0,0 +1,73 @@
+#include "Buttons.h"
+
+#include <Arduino.h>
+
+// In the order of the bits
+static const uint8_t pins[8] = {WIO_5S_PRESS, WIO_KEY_A,   WIO_KEY_B,
+                                WIO_KEY_C,    WIO_5S_LEFT, WIO_5S_RIGHT,
+                                WIO_5S_UP,    WIO_5S_DOWN};
+
+struct event_t {
+  uint8_t buttons;
+  uint32_t time;
+};
+
+// Written by the interrupt and by loop() with interrupts off
+static volatile uint8_t stable = 0;
+static volatile uint32_t changed_at = 0;
+static volatile event_t events[BUTTON_EVENTS];
+static volatile uint8_t head = 0;
+static volatile uint8_t count = 0;
+
+static uint8_t sample() {
+  uint8_t buttons = 0;
+  for (uint8_t i = 0; i < 8; i++)
+    if (digitalRead(pins[i]) == LOW) buttons |= 1 << i;
+  return buttons;
+}
+
+// Takes the state unless the last change is too recent
+static void update() {
+  const uint8_t buttons = sample();
+  const uint32_t now = millis();
+  if (buttons == stable || now - changed_at < BUTTON_DEBOUNCE_MS) return;
+  stable = buttons;
+  changed_at = now;
+  if (count == BUTTON_EVENTS) {
+    head = (head + 1) % BUTTON_EVENTS;
+    count--;
+  }
+  volatile event_t &e = events[(head + count) % BUTTON_EVENTS];
+  e.buttons = buttons;
+  e.time = now;
+  count++;
+}
+
+void Buttons::begin() {
+  for (uint8_t i = 0; i < 8; i++) {
+    pinMode(pins[i], INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(pins[i]), update, CHANGE);
+  }
+  stable = sample();
+}
+
+void Buttons::loop() {
+  noInterrupts();
+  update();
+  interrupts();
+}
+
+uint8_t Buttons::pressed() { return stable; }
+
+bool Buttons::next(uint8_t &buttons, uint32_t &time) {
+  noInterrupts();
+  const bool any = count;
+  if (any) {
+    buttons = events[head].buttons;
+    time = events[head].time;
+    head = (head + 1) % BUTTON_EVENTS;
+    count--;
+  }
+  interrupts();
+  return any;
+}
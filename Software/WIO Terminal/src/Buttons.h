@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+
+// Edges of a button within this long after it changed are bounce
+#define BUTTON_DEBOUNCE_MS 20
+// Changes waiting for next(), the oldest are dropped
+#define BUTTON_EVENTS 8
+
+/*
+ * The A, B and C keys and the five-way switch, as a bitmask: press, a, b, c,
+ * left, right, up, down. Every pin interrupts on a change, the handler reads
+ * all of them and takes a new state at once when the last change is more than
+ * BUTTON_DEBOUNCE_MS ago, the bounce after it is ignored. loop() catches the
+ * state the bounce settled on and the keys that share a line of the EIC with
+ * another. Each change is queued with the millis() of its first edge.
+ *
+ * buttons.loop();
+ * while (buttons.next(state, time)) ...
+ */
+class Buttons {
+ public:
+  void begin();
+  void loop();
+  // Debounced buttons
+  uint8_t pressed();
+  // The next change, the buttons after it and the millis() of its first edge
+  bool next(uint8_t &buttons, uint32_t &time);
+};
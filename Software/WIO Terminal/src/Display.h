@@ -8,6 +8,12 @@ public:
   virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) = 0;
   virtual void setSwapBytes(bool swap) = 0;
   virtual void pushImage(int32_t x, int32_t y, int32_t width, int32_t height, uint16_t *pixels) = 0;
+  // Hold the SPI bus for a run of DMA transfers, endWrite() waits for the last
+  virtual void startWrite() = 0;
+  virtual void endWrite() = 0;
+  // Start sending the pixels and return, they must not change while dmaBusy()
+  virtual void pushImageDMA(int32_t x, int32_t y, int32_t width, int32_t height, uint16_t *pixels) = 0;
+  virtual bool dmaBusy() = 0;
   virtual int32_t width() = 0;
   virtual int32_t height() = 0;
 };
@@ -38,6 +44,22 @@ public:
   {
     display.pushImage(x, y, width, height, pixels);
   }
+  inline void startWrite() override
+  {
+    display.startWrite();
+  }
+  inline void endWrite() override
+  {
+    display.endWrite();
+  }
+  inline void pushImageDMA(int32_t x, int32_t y, int32_t width, int32_t height, uint16_t *pixels) override
+  {
+    display.pushImageDMA(x, y, width, height, pixels);
+  }
+  inline bool dmaBusy() override
+  {
+    return display.dmaBusy();
+  }
   inline int32_t width() override
   {
     return display.width();
@@ -1,30 +1,131 @@
 #include "Sampler.h"
 
 #include <Arduino.h>
+#include <wiring_private.h>
 
-#include "SAMD51_InterruptTimer.h"
+// DMAC channel and event channel, the last ones so libraries that allocate
+// from 0 up keep theirs
+static const uint8_t DMA_CHANNEL = DMAC_CH_NUM - 1;
+static const uint8_t EVENT_CHANNEL = EVSYS_CHANNELS - 1;
 
-static Sampler *instance = NULL;
-
-void timerIsr() {
-  instance->buffer[instance->current_index] = analogRead(WIO_MIC);
-  instance->current_index++;
-  // have we collected enough samples?
-  if (instance->current_index >= instance->buffer_size) {
-    // just loop back round to the start - doesn't really matter if we overwrite
-    // samples
-    instance->current_index = 0;
-  }
-}
+// Descriptor table when no library has set one up yet, the other blocks are
+// chained from the channel descriptor
+__attribute__((aligned(16))) static DmacDescriptor descriptors[DMAC_CH_NUM];
+__attribute__((aligned(16))) static DmacDescriptor writeback[DMAC_CH_NUM];
+__attribute__((aligned(16))) static DmacDescriptor chained[SAMPLER_BLOCKS - 1];
+static DmacDescriptor *blocks[SAMPLER_BLOCKS];
 
 Sampler::Sampler(int sample_rate, int buffer_size) {
   this->sample_rate = sample_rate;
   this->buffer_size = buffer_size;
-  this->buffer =
-      reinterpret_cast<int16_t *>(malloc(buffer_size * sizeof(int16_t)));
-  this->current_index = 0;
+  this->buffer = reinterpret_cast<int16_t *>(
+      malloc(SAMPLER_BLOCKS * buffer_size * sizeof(int16_t)));
+  memset(buffer, 0, SAMPLER_BLOCKS * buffer_size * sizeof(int16_t));
   pinMode(WIO_MIC, INPUT);
-  instance = this;
 }
 
-void Sampler::start() { TC.startTimer(1000000 / sample_rate, timerIsr); }
+void Sampler::start() {
+  // The microphone is on ADC1 when the pin has the alternative attribute
+  const PinDescription &pin = g_APinDescription[WIO_MIC];
+  const bool alt = pin.ulPinAttribute & PIN_ATTR_ANALOG_ALT;
+  Adc *adc = alt ? ADC1 : ADC0;
+  pinPeripheral(WIO_MIC, alt ? PIO_ANALOG_ALT : PIO_ANALOG);
+
+  // ADC at 48 MHz / 32, 10 bits like analogRead(), started by events
+  if (alt)
+    MCLK->APBDMASK.bit.ADC1_ = 1;
+  else
+    MCLK->APBDMASK.bit.ADC0_ = 1;
+  GCLK->PCHCTRL[alt ? ADC1_GCLK_ID : ADC0_GCLK_ID].reg =
+      GCLK_PCHCTRL_GEN_GCLK1 | GCLK_PCHCTRL_CHEN;
+  adc->CTRLA.bit.ENABLE = 0;
+  while (adc->SYNCBUSY.bit.ENABLE)
+    ;
+  adc->CTRLA.reg = ADC_CTRLA_PRESCALER_DIV32;
+  adc->CTRLB.reg = ADC_CTRLB_RESSEL_10BIT;
+  adc->REFCTRL.reg = ADC_REFCTRL_REFSEL_INTVCC1;
+  adc->INPUTCTRL.reg = ADC_INPUTCTRL_MUXNEG_GND | pin.ulADCChannelNumber;
+  adc->SAMPCTRL.reg = 5;
+  adc->AVGCTRL.reg = 0;
+  adc->EVCTRL.reg = ADC_EVCTRL_STARTEI;
+  while (adc->SYNCBUSY.reg)
+    ;
+  adc->CTRLA.bit.ENABLE = 1;
+  while (adc->SYNCBUSY.bit.ENABLE)
+    ;
+
+  // Every result to the next sample of a block, the blocks in a ring
+  MCLK->AHBMASK.bit.DMAC_ = 1;
+  if (!DMAC->BASEADDR.reg) {
+    DMAC->CTRL.bit.DMAENABLE = 0;
+    DMAC->CTRL.bit.SWRST = 1;
+    while (DMAC->CTRL.bit.SWRST)
+      ;
+    DMAC->BASEADDR.reg = (uint32_t)descriptors;
+    DMAC->WRBADDR.reg = (uint32_t)writeback;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xF);
+  }
+  blocks[0] = &((DmacDescriptor *)DMAC->BASEADDR.reg)[DMA_CHANNEL];
+  for (uint8_t i = 1; i < SAMPLER_BLOCKS; i++) blocks[i] = &chained[i - 1];
+  for (uint8_t i = 0; i < SAMPLER_BLOCKS; i++) {
+    blocks[i]->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_HWORD |
+                            DMAC_BTCTRL_DSTINC | DMAC_BTCTRL_BLOCKACT_NOACT;
+    blocks[i]->BTCNT.reg = buffer_size;
+    blocks[i]->SRCADDR.reg = (uint32_t)&adc->RESULT.reg;
+    // The end of the block, the DMAC counts back from it
+    blocks[i]->DSTADDR.reg = (uint32_t)&buffer[(i + 1) * buffer_size];
+    blocks[i]->DESCADDR.reg = (uint32_t)blocks[(i + 1) % SAMPLER_BLOCKS];
+  }
+  next = 0;
+  samples = 0;
+  DmacChannel &channel = DMAC->Channel[DMA_CHANNEL];
+  channel.CHCTRLA.bit.ENABLE = 0;
+  channel.CHCTRLA.bit.SWRST = 1;
+  while (channel.CHCTRLA.bit.SWRST)
+    ;
+  channel.CHCTRLA.reg =
+      DMAC_CHCTRLA_TRIGSRC(alt ? ADC1_DMAC_ID_RESRDY : ADC0_DMAC_ID_RESRDY) |
+      DMAC_CHCTRLA_TRIGACT_BURST;
+  channel.CHCTRLA.bit.ENABLE = 1;
+
+  // TC3 overflow starts a conversion
+  MCLK->APBBMASK.bit.EVSYS_ = 1;
+  EVSYS->USER[alt ? EVSYS_ID_USER_ADC1_START : EVSYS_ID_USER_ADC0_START].reg =
+      EVSYS_USER_CHANNEL(EVENT_CHANNEL + 1);
+  EVSYS->Channel[EVENT_CHANNEL].CHANNEL.reg =
+      EVSYS_CHANNEL_EVGEN(EVSYS_ID_GEN_TC3_OVF) |
+      EVSYS_CHANNEL_PATH_ASYNCHRONOUS;
+
+  // TC3 at 48 MHz counting up to the sample period
+  MCLK->APBBMASK.bit.TC3_ = 1;
+  GCLK->PCHCTRL[TC3_GCLK_ID].reg = GCLK_PCHCTRL_GEN_GCLK1 | GCLK_PCHCTRL_CHEN;
+  TcCount16 &tc = TC3->COUNT16;
+  tc.CTRLA.bit.ENABLE = 0;
+  while (tc.SYNCBUSY.bit.ENABLE)
+    ;
+  tc.CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_PRESCALER_DIV1;
+  tc.WAVE.reg = TC_WAVE_WAVEGEN_MFRQ;
+  tc.CC[0].reg = 48000000 / sample_rate - 1;
+  tc.EVCTRL.reg = TC_EVCTRL_OVFEO;
+  while (tc.SYNCBUSY.reg)
+    ;
+  tc.CTRLA.bit.ENABLE = 1;
+}
+
+int16_t *Sampler::read() {
+  // The write back descriptor links to the block after the one being
+  // filled, every block before that one is complete
+  const DmacDescriptor *active =
+      &((DmacDescriptor *)DMAC->WRBADDR.reg)[DMA_CHANNEL];
+  uint8_t filling = SAMPLER_BLOCKS;
+  for (uint8_t i = 0; i < SAMPLER_BLOCKS; i++)
+    if (active->DESCADDR.reg == (uint32_t)blocks[i])
+      filling = (i + SAMPLER_BLOCKS - 1) % SAMPLER_BLOCKS;
+  if (filling == SAMPLER_BLOCKS || filling == next) return nullptr;
+  int16_t *block = &buffer[next * buffer_size];
+  next = (next + 1) % SAMPLER_BLOCKS;
+  samples += buffer_size;
+  return block;
+}
+
+uint32_t Sampler::time() { return (uint64_t)samples * 1000 / sample_rate; }
@@ -1,15 +1,31 @@
 #pragma once
 #include <stdint.h>
+
+// Blocks in the ring, read() has to be called before they all fill up
+#define SAMPLER_BLOCKS 4
+
+/*
+ * Microphone sampling without the CPU. TC3 overflows at the sample rate and
+ * starts an ADC conversion through the event system, the DMAC moves every
+ * result into a ring of SAMPLER_BLOCKS blocks of buffer_size samples.
+ * read() returns the completed blocks in order, a block is not written again
+ * until the DMAC has gone round the ring.
+ */
 class Sampler {
  private:
   int sample_rate;
   int buffer_size;
   int16_t *buffer;
-  int current_index;
+  // Block read() returns next, samples returned so far
+  uint8_t next = 0;
+  uint32_t samples = 0;
 
  public:
   Sampler(int sample_rate, int buffer_size);
   void start();
-  int16_t *get_buffer() { return buffer; }
-  friend void timerIsr();
-};
\ No newline at end of file
+  // The next completed block, nullptr when there is none
+  int16_t *read();
+  // ms of audio read up to the end of the last block, a clock that counts
+  // samples so it does not jitter with the loop
+  uint32_t time();
+};
@@ -1,70 +1,105 @@
 #include "Serializer.h"
 
 #include <Arduino.h>
-#include <ArduinoJson.h>
-#include <LIS3DHTR.h>
-extern LIS3DHTR<TwoWire> lis;
+#include <string.h>
+
+#include "Accelerometer.h"
+#include "config.h"
+extern Accelerometer accelerometer;
+
+static_assert(BANDS == 64, "a window packet carries 64 bands");
 
 Serializer::Serializer(int m_bins, TCP* m_tcp) {
   this->m_bins = m_bins;
   this->m_tcp = m_tcp;
 }
-void Serializer::update(int* fft) {
-  char buffer[1024];
-  String msg = "";
-  // NORMALLY bin zero has dc and mains hum, should ignore.
-  // NORMALLY 2nd half of bins are not usable
-  // THIS appox library i don't know and i don't care so lets
-  // just ignore bin[0] and skip 2nd half > bin[m_bins/2]
-  // Also m_bins = 512 so lets hard code it, to make it easy
-  // i need 64 channels for nice 4x16x4 analyzer
-  for (int i = 1; i < 256; i++) {
-    // add 4 bins together or (3 for the first)
-    static int32_t amp = 0;
-    amp += fft[i];
-    if ((i & 3) == 3) {
-      uint8_t byte = (amp >> 10) & 0xF;
-      if ((amp >> 10) > 0xf) byte = 0xf;
-      byte += 'A';
-      msg += (char)byte;
-      amp = 0;
-    }
+// Frame types of a button change and a window, see core/Frame.h of the LED
+// Display
+const uint8_t FRAME_BUTTON = 2;
+const uint8_t FRAME_WINDOW = 4;
+const uint8_t FRAME_PROBE = 11;
+const uint8_t WINDOW_DELTA = 1;
+const uint8_t WINDOW_TIMED = 2;
+const uint8_t WINDOW_ONSET = 4;
+// A full set of bands every so many windows, for receivers that lost one
+const uint8_t WINDOW_KEYFRAME = 16;
+
+// One packet per window: sequence, flags, buttons, accelerometer as int16
+// milli g, the time of the end of the window in ms (16 bits), then the 64
+// bands of 4 bits. A keyframe packs them into 32 bytes, a delta has a 64 bit
+// mask of the changed bands followed by only those, packed the same way. A
+// window without changes is 8 zero bytes.
+void Serializer::update(const uint8_t* bands, uint32_t time, bool onset,
+                        uint8_t buttons) {
+  uint8_t packet[11 + 8 + 32];
+#if TCP_FEATURE_PORT
+  // over UDP windows get lost or dropped as late, a delta would be useless
+  const bool delta = false;
+#else
+  const bool delta = m_sequence % WINDOW_KEYFRAME != 0;
+#endif
+  packet[0] = m_sequence++;
+  packet[1] = (delta ? WINDOW_DELTA : 0) | WINDOW_TIMED |
+              (onset ? WINDOW_ONSET : 0);
+
+  packet[2] = buttons;
+
+  // Mean of the samples of the accelerometer since the last window
+  const int16_t *mg = accelerometer.read();
+  for (uint8_t i = 0; i < 3; i++) {
+    const int16_t v = mg[i];
+    packet[3 + i * 2] = v & 0xFF;
+    packet[4 + i * 2] = (uint16_t)v >> 8;
   }
-  StaticJsonDocument<1024> doc;
-  doc["event"] = "fft";
-  doc["data"] = msg;
-  serializeJson(doc, buffer);
-  m_tcp->rpc(buffer);
-  doc.clear();
 
-  doc["event"] = "button";
-  if (digitalRead(WIO_5S_LEFT) == LOW) {
-    doc["x"] = (int)-1;
-  } else if (digitalRead(WIO_5S_RIGHT) == LOW) {
-    doc["x"] = (int)1;
-  } else {
-    doc["x"] = (int)0;
+  packet[9] = time & 0xFF;
+  packet[10] = (time >> 8) & 0xFF;
+
+  uint16_t size = 11;
+  uint8_t nibbles = 0;
+  if (delta) {
+    memset(&packet[size], 0, 8);
+    size += 8;
   }
-  if (digitalRead(WIO_5S_UP) == LOW) {
-    doc["y"] = (int)1;
-  } else if (digitalRead(WIO_5S_DOWN) == LOW) {
-    doc["y"] = (int)-1;
-  } else {
-    doc["y"] = (int)0;
+  for (uint8_t i = 0; i < 64; i++) {
+    if (delta) {
+      if (bands[i] == m_bands[i]) continue;
+      packet[11 + i / 8] |= 1 << (i & 7);
+    }
+    if (nibbles & 1)
+      packet[size - 1] |= bands[i] << 4;
+    else
+      packet[size++] = bands[i];
+    nibbles++;
   }
-  doc["z"] = (digitalRead(WIO_5S_PRESS) == LOW);
-  doc["a"] = (digitalRead(WIO_KEY_A) == LOW);
-  doc["b"] = (digitalRead(WIO_KEY_B) == LOW);
-  doc["c"] = (digitalRead(WIO_KEY_C) == LOW);
-  serializeJson(doc, buffer);
-  m_tcp->rpc(buffer);
-  doc.clear();
+  memcpy(m_bands, bands, sizeof(m_bands));
+  m_tcp->feature(FRAME_WINDOW, packet, size);
+}
 
-  doc["event"] = "accelerometer";
-  doc["x"] = (float)lis.getAccelerationX();
-  doc["y"] = (float)lis.getAccelerationY();
-  doc["z"] = (float)lis.getAccelerationZ();
-  serializeJson(doc, buffer);
-  m_tcp->rpc(buffer);
-  doc.clear();
-}
\ No newline at end of file
+// The joystick as int8 x and y, the press and the keys as the low bits, then
+// the time of the change in ms (16 bits), on its own clock: the cube takes
+// the fastest change as the offset and measures the delay of the others
+void Serializer::button(uint8_t buttons, uint32_t time) {
+  const uint8_t packet[5] = {
+      (uint8_t)((buttons & 0x20 ? 1 : 0) - (buttons & 0x10 ? 1 : 0)),
+      (uint8_t)((buttons & 0x40 ? 1 : 0) - (buttons & 0x80 ? 1 : 0)),
+      (uint8_t)(buttons & 0x0F), (uint8_t)(time & 0xFF),
+      (uint8_t)((time >> 8) & 0xFF)};
+  m_tcp->frame(FRAME_BUTTON, packet, sizeof(packet));
+}
+
+// The probe goes the way of its input: id, source (1 button, 2 beat), then
+// the us of the input here and of the wifi as uint32, the ESP8266 fills in
+// the bridge and the uart behind them
+void Serializer::probe(bool beat, uint32_t input) {
+  const TCP::probe_t source = beat ? TCP::probe_t::BEAT : TCP::probe_t::BUTTON;
+  if (m_tcp->probing != source) return;
+  uint8_t packet[18] = {m_probe++, (uint8_t)source};
+  memcpy(&packet[2], &input, 4);
+  memcpy(&packet[6], &m_tcp->wifi, 4);
+  m_tcp->probed(packet[0]);
+  if (beat)
+    m_tcp->feature(FRAME_PROBE, packet, sizeof(packet));
+  else
+    m_tcp->frame(FRAME_PROBE, packet, sizeof(packet));
+}
@@ -7,8 +7,20 @@ class Serializer {
  private:
   int m_bins;
   TCP *m_tcp;
+  // Bands of the last window sent, deltas are against these
+  uint8_t m_bands[64] = {0};
+  uint8_t m_sequence = 0;
+  uint8_t m_probe = 0;
 
  public:
   Serializer(int m_bins, TCP *m_tcp);
-  void update(int *fft);
+  // bands of the window, see Processor, time in ms of its last sample, the
+  // debounced buttons
+  void update(const uint8_t *bands, uint32_t time, bool onset,
+              uint8_t buttons);
+  // A change of the buttons, sent at once, time in ms of its first edge
+  void button(uint8_t buttons, uint32_t time);
+  // A latency probe behind an input while the Teensy asks for them, beat an
+  // onset or else a button change, input the us since it happened
+  void probe(bool beat, uint32_t input);
 };
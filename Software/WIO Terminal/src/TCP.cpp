@@ -9,8 +9,8 @@ const char TEENSY_STOP = 0xf9;
 const char WIO_STOP = 0xfa;
 const char START = WIO_START;
 const char STOP = WIO_STOP;
-
-void execute(const char* char_buffer);
+// Start of a binary frame
+const uint8_t FRAME_START = 0xf3;
 
 TCP::TCP() { begin(); }
 
@@ -18,58 +18,96 @@ void TCP::begin() {
   WiFi.mode(WIFI_STA);
   WiFi.begin(network.ssid, network.password);
   Serial.println("Connecting to Wifi");
-  uint16_t retries = 0;
-  while (WiFi.status() != WL_CONNECTED) {
-    Serial.print(".");
-    if (retries++ >= 20) {
-      Serial.println();
-      Serial.println("Unable to connect to Wifi. Rebooting the WIO Terminal..");
-      NVIC_SystemReset();
-    }
-    delay(500);
-  }
-  // Functions below may or may not work
-  WiFi.setAutoReconnect(true);
-  WiFi.persistent(true);
+  state = state_t::JOINING;
+  since = millis();
+  backoff = TCP_BACKOFF_MIN;
+}
 
-  if (retries > 0) Serial.println();
-  Serial.print("Connected to ");
-  Serial.println(network.ssid);
-  Serial.print("IP address: ");
-  Serial.println(WiFi.localIP());
-  Serial.println("WiFi ready");
+// Wait a little longer after every failure
+void TCP::retry(uint32_t now) {
+  retry_at = now + backoff;
+  backoff = backoff * 2 < TCP_BACKOFF_MAX ? backoff * 2 : TCP_BACKOFF_MAX;
 }
 
-bool TCP::connected() {
-  if (!client.connected()) {
+void TCP::loop() {
+  const uint32_t now = millis();
+  if (state != state_t::JOINING && WiFi.status() != WL_CONNECTED) {
+    Serial.println("Lost Wifi");
     client.stop();
-    if (!client.connect(network.hostname, network.tcp_port)) {
-      Serial.println("Connection failed...");
-      return false;
-    }
+    sent = 0;
+    state = state_t::JOINING;
+    since = now;
+  }
+  switch (state) {
+    case state_t::JOINING:
+      if (WiFi.status() == WL_CONNECTED) {
+        Serial.print("Connected to ");
+        Serial.println(network.ssid);
+        Serial.print("IP address: ");
+        Serial.println(WiFi.localIP());
+        state = state_t::CONNECTING;
+        retry_at = now;
+        backoff = TCP_BACKOFF_MIN;
+      } else if ((int32_t)(now - since) > TCP_JOIN_MS &&
+                 (int32_t)(now - retry_at) >= 0) {
+        // Start over instead of rebooting
+        Serial.println("Unable to connect to Wifi, retrying");
+        WiFi.disconnect();
+        WiFi.begin(network.ssid, network.password);
+        since = now;
+        retry(now);
+      }
+      break;
+    case state_t::CONNECTING:
+      if ((int32_t)(now - retry_at) < 0) break;
+      client.stop();
+      if (client.connect(network.hostname, network.tcp_port, TCP_CONNECT_MS)) {
+        Serial.println("Connected to the cube");
+        state = state_t::CONNECTED;
+        backoff = TCP_BACKOFF_MIN;
+      } else {
+        retry(now);
+      }
+      break;
+    case state_t::CONNECTED:
+      if (!client.connected()) {
+        Serial.println("Connection lost");
+        // The frame cut short goes again whole on the next connection
+        sent = 0;
+        state = state_t::CONNECTING;
+        retry(now);
+        break;
+      }
+      receive();
+      send();
+      break;
   }
-  return true;
 }
-// Check input from WiFI connected to ESP8266
-void TCP::loop() {
-  if (!connected()) return;
+
+// Check input from WiFI connected to ESP8266, a command is collected in a
+// fixed buffer
+void TCP::receive() {
   static boolean command = false;
-  static String message = "";
+  static char message[TCP_COMMAND_MAX + 1];
+  static uint16_t length = 0;
   while (client.available()) {
     char c = (char)client.read();
     if (c == START) {
-      message = "";
+      length = 0;
       command = true;
     } else if (c == STOP) {
-      if (command) {
-        execute(message.c_str());
+      if (command && length <= TCP_COMMAND_MAX) {
+        message[length] = 0;
+        execute(message);
       }
-      message = "";
+      length = 0;
       command = false;
     } else {
       if (command) {
-        // Accumulate command until stop character
-        message += c;
+        // Accumulate command until stop character, past the buffer it only
+        // counts so the command is dropped
+        if (length < TCP_COMMAND_MAX) message[length] = c;
+        if (length <= TCP_COMMAND_MAX) length++;
       } else {
         // Serial passthrough (USB console logger)
         Serial.write(c);
@@ -78,24 +116,106 @@ void TCP::loop() {
   }
 }
 
-// Executes a json command present in the char_buffer
-void execute(const char* char_buffer) {
+// Send the queued frames oldest first. A short write leaves the rest of the
+// frame for the next call, the parsers of the ESP8266 and the Teensy go by
+// the length and would lose the frames behind a frame cut short.
+void TCP::send() {
+  while (count) {
+    const queued_t &q = queue[head];
+    sent += client.write(q.data + sent, q.size - sent);
+    if (sent < q.size) break;
+    sent = 0;
+    head = (head + 1) % TCP_QUEUE;
+    count--;
+  }
+  client.flush();
+}
+
+// Executes a json command present in the char_buffer, the probe event of the
+// Teensy sets the input to probe and the one of the ESP8266 echoes a probe
+void TCP::execute(const char* char_buffer) {
   StaticJsonDocument<1024> doc;
   DeserializationError err = deserializeJson(doc, char_buffer);
   if (err) {
     Serial.printf("Deserialization error: %s\n", err.c_str());
     return;
   }
-  String event = doc["event"];
-  Serial.printf("Executing: %s\n", event.c_str());
+  const char *event = doc["event"] | "";
+  if (!strcmp(event, "probe")) {
+    const char *on = doc["on"];
+    if (on)
+      probing = !strcmp(on, "button") ? probe_t::BUTTON
+                : !strcmp(on, "beat") ? probe_t::BEAT
+                                      : probe_t::OFF;
+    else if (doc["id"] == probe_id)
+      wifi = (micros() - probe_at) / 2;
+    return;
+  }
+  Serial.printf("Executing: %s\n", event);
   Serial.println(char_buffer);
 }
 
-void TCP::rpc(String msg) {
+// CRC-16 CCITT-FALSE (polynomial 0x1021, initial 0xFFFF)
+static uint16_t crc16(uint16_t crc, const uint8_t *data, size_t size) {
+  while (size--) {
+    crc ^= (uint16_t)*data++ << 8;
+    for (uint8_t i = 0; i < 8; i++)
+      crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+// Start byte, type, length LE, payload and the CRC-16 LE of all but the
+// start, assembled in the queue and sent with a single write. A full queue
+// drops its oldest frame, or the one behind it while the oldest is partly
+// written.
+void TCP::frame(uint8_t type, const void *payload, uint16_t size) {
+  if (size > FRAME_PAYLOAD) return;
+  if (count == TCP_QUEUE) {
+    if (sent) queue[(head + 1) % TCP_QUEUE] = queue[head];
+    head = (head + 1) % TCP_QUEUE;
+    count--;
+    dropped++;
+  }
+  queued_t &q = queue[(head + count++) % TCP_QUEUE];
+  uint8_t *out = q.data;
+  out[0] = FRAME_START;
+  out[1] = type;
+  out[2] = size & 0xFF;
+  out[3] = size >> 8;
+  memcpy(&out[4], payload, size);
+  const uint16_t crc = crc16(0xFFFF, &out[1], size + 3);
+  out[size + 4] = crc & 0xFF;
+  out[size + 5] = crc >> 8;
+  q.size = size + 6;
+  if (connected()) send();
+}
+
+void TCP::feature(uint8_t type, const void *payload, uint16_t size) {
+#if TCP_FEATURE_PORT
+  if (state == state_t::JOINING || size > FRAME_PAYLOAD) return;
+  udp.beginPacket(network.hostname, TCP_FEATURE_PORT);
+  udp.write(type);
+  udp.write(static_cast<const uint8_t *>(payload), size);
+  udp.endPacket();
+#else
+  frame(type, payload, size);
+#endif
+}
+
+void TCP::probed(uint8_t id) {
+  probe_id = id;
+  probe_at = micros();
+}
+
+void TCP::rpc(const char *msg) {
   if (!connected()) return;
+  // Not into the middle of a frame
+  if (sent) send();
+  if (sent) return;
   client.write(TEENSY_START);
   client.print(msg);
   client.write(TEENSY_STOP);
   client.flush();
   //  Serial.println(msg);
-}
\ No newline at end of file
+}
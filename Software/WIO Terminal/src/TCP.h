@@ -2,12 +2,56 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <SPI.h>
+#include <WiFiUdp.h>
 #include <rpcWiFi.h>
 #include <string.h>
 
+// Largest payload of a binary frame sent by frame()
+#define FRAME_PAYLOAD 128
+// Longest command received, a longer one is dropped
+#define TCP_COMMAND_MAX 1024
+// Frames waiting to be sent, while offline the oldest are dropped
+#define TCP_QUEUE 8
+// Wait before the next attempt to join or connect, doubled after every
+// failure up to the maximum
+#define TCP_BACKOFF_MIN 250
+#define TCP_BACKOFF_MAX 8000
+// Time to join the access point, and the longest a connect() may block
+#define TCP_JOIN_MS 10000
+#define TCP_CONNECT_MS 50
+// UDP port of the ESP8266 for the audio windows, see feature(). 0 queues them
+// with the other frames on the TCP connection.
+#define TCP_FEATURE_PORT 7002
+
+/*
+ * Link to the ESP8266 of the cube. loop() runs a state machine that joins the
+ * access point and connects without waiting, with a backoff between failed
+ * attempts, so sampling, FFT and UI carry on during an outage. Frames go to a
+ * bounded queue that loop() sends while connected. Audio windows go as UDP
+ * datagrams instead, so a lost segment can not hold up the windows behind it
+ * and the ESP8266 can drop late ones.
+ */
 class TCP {
  private:
   WiFiClient client;
+  WiFiUDP udp;
+
+  enum class state_t : uint8_t { JOINING, CONNECTING, CONNECTED };
+  state_t state = state_t::JOINING;
+  // Start of the current attempt, time of the next one and the wait after it
+  uint32_t since = 0;
+  uint32_t retry_at = 0;
+  uint32_t backoff = TCP_BACKOFF_MIN;
+
+  struct queued_t {
+    uint16_t size;
+    uint8_t data[FRAME_PAYLOAD + 6];
+  };
+  queued_t queue[TCP_QUEUE];
+  uint8_t head = 0;
+  uint8_t count = 0;
+  // Bytes of the oldest frame already written, the rest goes next
+  uint16_t sent = 0;
 
   struct {
     char ssid[64] = "-^..^-";
@@ -21,8 +65,32 @@ class TCP {
   TCP();
   void begin();
   void loop();
-  void rpc(String msg);
+  bool connected() { return state == state_t::CONNECTED; }
+  // Dropped while offline or a frame is partly written
+  void rpc(const char *msg);
+  // Binary frame for the Teensy, see core/Frame.h of the LED Display, queued
+  void frame(uint8_t type, const void *payload, uint16_t size);
+  // A frame whose payload starts with a sequence number and that is only worth
+  // sending while it is new, a datagram of the type and the payload, sent at
+  // once and dropped while offline
+  void feature(uint8_t type, const void *payload, uint16_t size);
+  // Frames dropped from the queue
+  uint32_t dropped = 0;
+  // Inputs followed by a latency probe, as the Teensy asks, see core/Latency.h
+  // of the LED Display
+  enum class probe_t : uint8_t { OFF, BUTTON, BEAT };
+  probe_t probing = probe_t::OFF;
+  // Half the round trip of the last probe echoed by the ESP8266, in us
+  uint32_t wifi = 0;
+  // A probe went out, its echo times the round trip
+  void probed(uint8_t id);
 
  private:
-  bool connected();
+  uint8_t probe_id = 0;
+  uint32_t probe_at = 0;
+
+  void retry(uint32_t now);
+  void receive();
+  void send();
+  void execute(const char *command);
 };
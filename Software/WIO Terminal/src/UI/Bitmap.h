@@ -1,13 +1,16 @@
 #pragma once
 #include <stdint.h>
 
+// A byte per pixel, scrolled by moving the column written next instead of
+// the pixels, column is the oldest one on screen
 class Bitmap
 {
 public:
-  uint16_t *pixels;
-  uint16_t **rows;
+  uint8_t *pixels;
+  uint8_t **rows;
   uint16_t width;
   uint16_t height;
+  uint16_t column;
   Bitmap(int width, int height);
   void scroll_left();
-};
\ No newline at end of file
+};
@@ -1,20 +1,59 @@
 #pragma once
 
-class Display;
+#include <stdint.h>
+#include <stdlib.h>
+
+// A part of the screen that is drawn again where it changed. It is split into
+// columns of column_width pixels, update() marks the rows of a column that
+// differ from what was drawn and the UI only renders and sends those.
 class Component
 {
+private:
+  // rows changed per column since it was drawn, top > bottom when none
+  int16_t *m_dirty_top;
+  int16_t *m_dirty_bottom;
+
 public:
   int x, y, width, height;
   bool visible;
-  Component(int x, int y, int width, int height) : x(x), y(y), width(width), height(height), visible(true)
+  int column_width;
+  int columns;
+  Component(int x, int y, int width, int height, int column_width) : x(x), y(y), width(width), height(height), visible(true), column_width(column_width)
+  {
+    columns = (width + column_width - 1) / column_width;
+    m_dirty_top = static_cast<int16_t *>(malloc(sizeof(int16_t) * columns));
+    m_dirty_bottom = static_cast<int16_t *>(malloc(sizeof(int16_t) * columns));
+    invalidate();
+  }
+  // Render rows top to top + lines - 1 of the pixels left to left + span - 1
+  // into pixels, span pixels per row
+  virtual void render(uint16_t *pixels, int left, int top, int span, int lines) = 0;
+  // Rows from to to of a column changed, clipped to the component
+  void mark(int column, int from, int to)
   {
+    from = from < 0 ? 0 : from;
+    to = to >= height ? height - 1 : to;
+    if (from < m_dirty_top[column])
+      m_dirty_top[column] = from;
+    if (to > m_dirty_bottom[column])
+      m_dirty_bottom[column] = to;
   }
-  virtual void _draw(Display &display) = 0;
-  void draw(Display &display)
+  // Draw it all again
+  void invalidate()
   {
-    if (visible)
+    for (int i = 0; i < columns; i++)
     {
-      _draw(display);
+      m_dirty_top[i] = 0;
+      m_dirty_bottom[i] = height - 1;
     }
   }
-};
\ No newline at end of file
+  // Take the changed rows of a column to draw them, false when there are none
+  bool take(int column, int &top, int &bottom)
+  {
+    top = m_dirty_top[column];
+    bottom = m_dirty_bottom[column];
+    m_dirty_top[column] = height;
+    m_dirty_bottom[column] = -1;
+    return top <= bottom;
+  }
+};
@@ -1,32 +1,34 @@
 #include <Arduino.h>
 #include <algorithm>
-#include "../Display.h"
 #include "Palette.h"
 #include "GraphicEqualiser.h"
 
 #undef min
+#undef max
 
-GraphicEqualiser::GraphicEqualiser(Palette *palette, int x, int y, int width, int height, int num_bins) : Component(x, y, width, height)
+GraphicEqualiser::GraphicEqualiser(Palette *palette, int x, int y, int width, int height, int num_bands) : Component(x, y, width, height, width / num_bands)
 {
   m_palette = palette;
-  m_num_bins = num_bins;
-  bar_chart = static_cast<float *>(malloc(sizeof(float) * num_bins));
-  for (int i = 0; i < num_bins; i++)
+  m_num_bands = num_bands;
+  bar_chart = static_cast<float *>(malloc(sizeof(float) * num_bands));
+  for (int i = 0; i < num_bands; i++)
   {
     bar_chart[i] = 0.0f;
   }
-  bar_chart_peaks = static_cast<float *>(malloc(sizeof(float) * num_bins));
-  for (int i = 0; i < num_bins; i++)
+  bar_chart_peaks = static_cast<float *>(malloc(sizeof(float) * num_bands));
+  for (int i = 0; i < num_bands; i++)
   {
     bar_chart_peaks[i] = 0.0f;
   }
+  m_bars = static_cast<int16_t *>(calloc(num_bands, sizeof(int16_t)));
+  m_peaks = static_cast<int16_t *>(calloc(num_bands, sizeof(int16_t)));
 }
 
-void GraphicEqualiser::update(int *mag)
+void GraphicEqualiser::update(const uint8_t *bands)
 {
-  for (int i = 0; i < m_num_bins; i++)
+  for (int i = 0; i < m_num_bands; i++)
   {
-    float m = (float)(mag[i])/10.0f;
+    float m = bands[i] * (height - 1) / 15.0f;
     if (m > bar_chart[i])
     {
       bar_chart[i] = m;
@@ -43,33 +45,45 @@ void GraphicEqualiser::update(int *mag)
     {
       bar_chart_peaks[i] = 0.95 * bar_chart_peaks[i] + 0.05 * m;
     }
+    // a bar only changes between its old and new top, and at both peaks
+    const int bar = std::min(height - 1, int(bar_chart[i]));
+    const int peak = std::min(height - 1, int(bar_chart_peaks[i]));
+    if (bar != m_bars[i])
+      mark(i, height - std::max(bar, (int)m_bars[i]) - 1,
+           height - std::min(bar, (int)m_bars[i]) - 1);
+    if (peak != m_peaks[i])
+    {
+      mark(i, height - peak - 1, height - peak - 1);
+      mark(i, height - m_peaks[i] - 1, height - m_peaks[i] - 1);
+    }
+    m_bars[i] = bar;
+    m_peaks[i] = peak;
   }
 }
 
-void GraphicEqualiser::_draw(Display &display)
+void GraphicEqualiser::render(uint16_t *pixels, int left, int top, int span, int lines)
 {
-  int x = 0;
-  int x_step = int(width / (m_num_bins / 16));
-  for (int i = 2; i < m_num_bins / 4; i += 4)
+  const int x_step = column_width;
+  for (int y = top; y < top + lines; y++)
   {
-    float ave = 0;
-    for (int j = 0; j < 4; j++)
+    uint16_t *out = &pixels[(y - top) * span];
+    for (int x = left; x < left + span; x++)
     {
-      ave += bar_chart[i + j];
+      const int i = x / x_step;
+      uint16_t color = 0;
+      if (i < m_num_bands)
+      {
+        const int bar_value = m_bars[i];
+        const int peak_value = m_peaks[i];
+        // the color of a row is that of a bar up to it, so a bar that grows
+        // or shrinks leaves the rows below as they are. A gap between the
+        // bars, the peak line runs over it
+        if (y == height - peak_value - 1)
+          color = m_palette->get_color(100 + peak_value);
+        else if (y >= height - bar_value - 1 && x % x_step != x_step - 1)
+          color = m_palette->get_color(100 + height - y - 1);
+      }
+      *out++ = color;
     }
-    ave /= 4;
-    int bar_value = std::min(height - 1, int(0.5f * ave));
-    ave = 0;
-    for (int j = 0; j < 4; j++)
-    {
-      ave += bar_chart_peaks[i + j];
-    }
-    ave /= 4;
-    int peak_value = std::min(height - 1, int(0.5f * ave));
-    display.fillRect(x, 0, x_step, height - bar_value - 1, 0);
-    display.drawLine(x, height - peak_value - 1, x + x_step - 1, height - peak_value - 1, m_palette->get_color(100 + peak_value));
-    display.fillRect(x, height - bar_value - 1, x_step - 1, bar_value, m_palette->get_color(100 + bar_value));
-    x += x_step;
   }
-  display.fillRect(x, 0, width - x, height, 0);
-}
\ No newline at end of file
+}
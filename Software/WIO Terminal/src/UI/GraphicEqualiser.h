@@ -7,12 +7,15 @@ class GraphicEqualiser : public Component
 {
 private:
   Palette *m_palette;
-  int m_num_bins;
+  int m_num_bands;
   float *bar_chart;
   float *bar_chart_peaks;
+  // heights of the bars and the peaks as they are drawn
+  int16_t *m_bars;
+  int16_t *m_peaks;
 
 public:
-  GraphicEqualiser(Palette *palette, int x, int y, int width, int height, int num_bins);
-  void update(int *mag);
-  void _draw(Display &display);
+  GraphicEqualiser(Palette *palette, int x, int y, int width, int height, int num_bands);
+  void update(const uint8_t *bands);
+  void render(uint16_t *pixels, int left, int top, int span, int lines);
 };
@@ -1,27 +1,42 @@
 #include <Arduino.h>
-#include "../Display.h"
 #include "Spectrogram.h"
 #include "Bitmap.h"
 #include "Palette.h"
 
-Spectrogram::Spectrogram(Palette *palette, int x, int y, int width, int height) : Component(x, y, width, height)
+Spectrogram::Spectrogram(Palette *palette, int x, int y, int width, int height, int num_bands) : Component(x, y, width, height, width)
 {
   m_palette = palette;
-  this->bitmap = new Bitmap(width, height);
+  m_num_bands = num_bands;
+  this->bitmap = new Bitmap(width, num_bands);
 }
 
-void Spectrogram::update(int *mag)
+void Spectrogram::update(const uint8_t *bands)
 {
+  // the new column goes over the oldest, which moves on to the next one
+  const int column = bitmap->column;
   bitmap->scroll_left();
   for (int i = 0; i < bitmap->height; i++)
   {
-    bitmap->rows[bitmap->height - i - 1][bitmap->width - 1] = m_palette->get_color(mag[i] / 4);
+    bitmap->rows[bitmap->height - i - 1][column] = bands[i];
   }
+  // everything moves, one column across the whole width
+  mark(0, 0, height - 1);
 }
 
-void Spectrogram::_draw(Display &display)
+void Spectrogram::render(uint16_t *pixels, int left, int top, int span, int lines)
 {
-  display.setSwapBytes(true);
-  display.pushImage(x, y, bitmap->width, bitmap->height, bitmap->pixels);
-  display.setSwapBytes(false);
-}
\ No newline at end of file
+  // every row from the oldest column to the end, then from the start
+  const int column = bitmap->column;
+  for (int y = top; y < top + lines; y++)
+  {
+    const uint8_t *row = bitmap->rows[y * m_num_bands / height];
+    uint16_t *out = &pixels[(y - top) * span];
+    int from = column + left;
+    from = from >= width ? from - width : from;
+    for (int x = 0; x < span; x++)
+    {
+      *out++ = m_palette->get_color(row[from] * 17);
+      from = from + 1 == width ? 0 : from + 1;
+    }
+  }
+}
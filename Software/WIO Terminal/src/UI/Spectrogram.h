@@ -9,11 +9,13 @@ class Spectrogram : public Component
 {
 private:
   Palette *m_palette;
+  int m_num_bands;
 
+  // a row per band and a column per update
   Bitmap *bitmap;
 
 public:
-  Spectrogram(Palette *palette, int x, int y, int width, int height);
-  void update(int *magnitudes);
-  void _draw(Display &display);
+  Spectrogram(Palette *palette, int x, int y, int width, int height, int num_bands);
+  void update(const uint8_t *bands);
+  void render(uint16_t *pixels, int left, int top, int span, int lines);
 };
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 
 #include "../Display.h"
+#include "../config.h"
 #include "UI/GraphicEqualiser.h"
 #include "UI/Palette.h"
 #include "UI/Spectrogram.h"
@@ -11,51 +12,115 @@
 UI::UI(Display &display, int window_size) : m_display(display) {
   Serial.printf("Display is %d x %d\n", display.width(), display.height());
   m_palette = new Palette();
-  m_waveform = new Waveform(display, 0, 0, display.width(), display.height(),
-                            window_size);
+  m_waveform =
+      new Waveform(0, 0, display.width(), display.height(), window_size);
 
   m_graphic_equaliser = new GraphicEqualiser(m_palette, 0, 0, display.width(),
-                                             display.height(), window_size);
+                                             display.height(), BANDS);
 
-  // Not enough memory for this
-  //  m_spectrogram =      new Spectrogram(m_palette, 0, 0, display.width(),
-  //  display.height());
+  // A byte per band and column, the colors are looked up per strip
+  m_spectrogram = new Spectrogram(m_palette, 0, 0, display.width(),
+                                  display.height(), BANDS);
+
+  m_strip_pixels = display.width() * UI_STRIP;
+  for (int i = 0; i < 2; i++)
+    m_strips[i] =
+        static_cast<uint16_t *>(malloc(m_strip_pixels * sizeof(uint16_t)));
+  m_strip = 0;
+  m_column = 0;
+  m_left = 0;
+  m_span = 0;
+  m_line = 0;
+  m_bottom = -1;
+  m_lines = 0;
+  m_rendered = false;
+  m_drawing = false;
+  m_dirty = false;
+  m_pixels = 0;
+  m_busy = 0;
 
   // start off with the graphic equaliser visible
   m_waveform->visible = false;
-  // m_spectrogram->visible = false;
+  m_spectrogram->visible = false;
   m_graphic_equaliser->visible = true;
 }
 
 void UI::toggle_display() {
-  // bool tmp = m_graphic_equaliser->visible;
-  // m_graphic_equaliser->visible = m_spectrogram->visible;
-  // m_spectrogram->visible = m_waveform->visible;
-  // m_waveform->visible = tmp;
-  m_waveform->visible = !m_waveform->visible;
-  m_graphic_equaliser->visible = !m_graphic_equaliser->visible;
+  bool tmp = m_graphic_equaliser->visible;
+  m_graphic_equaliser->visible = m_spectrogram->visible;
+  m_spectrogram->visible = m_waveform->visible;
+  m_waveform->visible = tmp;
+  visible()->invalidate();
+  m_dirty = true;
 }
 
-void UI::update(int *samples, int *fft) {
+void UI::update(const int16_t *samples, const uint8_t *bands) {
   m_waveform->update(samples);
-  m_graphic_equaliser->update(fft);
-  // m_spectrogram->update(fft);
-  draw();
+  m_graphic_equaliser->update(bands);
+  m_spectrogram->update(bands);
+  m_dirty = true;
+}
+
+Component *UI::visible() {
+  if (m_graphic_equaliser->visible) return m_graphic_equaliser;
+  if (m_spectrogram->visible) return m_spectrogram;
+  return m_waveform;
 }
 
+unsigned long draw_start = 0;
 unsigned long draw_time = 0;
 int draw_count = 0;
-void UI::draw() {
-  auto start = millis();
-  // m_spectrogram->draw(m_display);
-  m_graphic_equaliser->draw(m_display);
-  m_waveform->draw(m_display);
-  auto end = millis();
-  draw_time += end - start;
+void UI::loop() {
+  const unsigned long entered = micros();
+  Component *component = visible();
+  if (!m_drawing) {
+    if (!m_dirty) return;
+    m_dirty = false;
+    m_drawing = true;
+    m_column = 0;
+    m_line = 0;
+    m_bottom = -1;
+    draw_start = entered;
+    m_display.startWrite();
+    m_display.setSwapBytes(true);
+  }
+  // the next piece of a changed column goes into the buffer that is not being
+  // sent
+  if (!m_rendered) {
+    while (m_line > m_bottom && m_column < component->columns) {
+      m_left = m_column * component->column_width;
+      m_span = min(component->column_width, component->width - m_left);
+      component->take(m_column++, m_line, m_bottom);
+    }
+    if (m_line <= m_bottom) {
+      m_lines = min(m_bottom - m_line + 1, max(1, m_strip_pixels / m_span));
+      component->render(m_strips[m_strip], m_left, m_line, m_span, m_lines);
+      m_rendered = true;
+    }
+  }
+  m_busy += micros() - entered;
+  if (m_display.dmaBusy()) return;
+  if (m_rendered) {
+    m_display.pushImageDMA(component->x + m_left, component->y + m_line,
+                           m_span, m_lines, m_strips[m_strip]);
+    m_pixels += m_span * m_lines;
+    m_strip ^= 1;
+    m_line += m_lines;
+    m_rendered = false;
+    return;
+  }
+  m_display.setSwapBytes(false);
+  m_display.endWrite();
+  m_drawing = false;
+  draw_time += micros() - draw_start;
   draw_count++;
   if (draw_count == 20) {
-    Serial.printf("Drawing time %ld\n", draw_time / 20);
+    // wall time of a frame, the part of it in loop() and the pixels sent
+    Serial.printf("Frame time %ldus, UI %ldus, %ld pixels\n", draw_time / 20,
+                  m_busy / 20, m_pixels / 20);
     draw_count = 0;
     draw_time = 0;
+    m_busy = 0;
+    m_pixels = 0;
   }
-}
\ No newline at end of file
+}
@@ -1,23 +1,58 @@
 #pragma once
 
+#include <stdint.h>
+
+// Lines rendered and sent at once, two strips of 320 x 16 take 20KB
+#define UI_STRIP 16
+
 class Palette;
 class Waveform;
 class GraphicEqualiser;
-//class Spectrogram;
+class Spectrogram;
+class Component;
 class Display;
 
+/*
+ * Draws what changed in the visible component. Every column of it with
+ * changed rows is rendered and sent in pieces of up to a strip of pixels.
+ * While the DMA sends one piece the next is rendered into the other buffer,
+ * and loop() returns in between so the FFT and the network carry on while a
+ * frame is sent.
+ */
 class UI
 {
 private:
   Palette *m_palette;
   Waveform *m_waveform;
   GraphicEqualiser *m_graphic_equaliser;
-//  Spectrogram *m_spectrogram;
+  Spectrogram *m_spectrogram;
   Display &m_display;
 
+  uint16_t *m_strips[2];
+  int m_strip_pixels;
+  // strip rendered next, the column drawn, its pixels and the rows left of
+  // it, the rows of the piece in the strip and whether it waits for the DMA
+  int m_strip;
+  int m_column;
+  int m_left;
+  int m_span;
+  int m_line;
+  int m_bottom;
+  int m_lines;
+  bool m_rendered;
+  // a frame is being sent, an update came in since the last one
+  bool m_drawing;
+  bool m_dirty;
+  // pixels sent and time spent in loop() over the frames of the stats
+  uint32_t m_pixels;
+  uint32_t m_busy;
+
+  Component *visible();
+
 public:
   UI(Display &display, int window_size);
   void toggle_display();
-  void update(int *samples, int *fft);
-  void draw();
+  void update(const int16_t *samples, const uint8_t *bands);
+  // Render and send the next strip, call every loop
+  void loop();
 };
@@ -1,26 +1,73 @@
 #include <Arduino.h>
-#include "../Display.h"
+#include <algorithm>
 #include "Waveform.h"
 
-Waveform::Waveform(Display &display, int x, int y, int width, int height, int num_samples) : Component(x, y, width, height)
+#undef min
+#undef max
+
+Waveform::Waveform(int x, int y, int width, int height, int num_samples) : Component(x, y, width, height, WAVEFORM_COLUMN)
 {
   m_num_samples = num_samples;
-  m_samples = static_cast<int *>(malloc(sizeof(int) * num_samples));
+  m_rows = static_cast<int16_t *>(malloc(sizeof(int16_t) * (width + 1)));
+  for (int x = 0; x <= width; x++)
+  {
+    m_rows[x] = height / 2;
+  }
 }
 
-void Waveform::update(int *samples)
+void Waveform::covered(int column, int &top, int &bottom)
 {
-  memcpy(m_samples, samples, sizeof(int) * m_num_samples);
+  const int from = column * column_width;
+  const int to = std::min(width, from + column_width);
+  top = height;
+  bottom = -1;
+  for (int x = from; x < to; x++)
+  {
+    top = std::min(top, (int)std::min(m_rows[x], m_rows[x + 1]));
+    bottom = std::max(bottom, (int)std::max(m_rows[x], m_rows[x + 1]));
+  }
 }
 
-void Waveform::_draw(Display &display)
+void Waveform::update(const int16_t *samples)
 {
-  float x = 0;
-  float x_step = (float)width / (float)m_num_samples;
-  display.fillRect(x, y, width, height, 0);
-  for (int i = 4; i < m_num_samples; i += 4)
+  // around the middle of the window
+  int mean = 0;
+  for (int i = 0; i < m_num_samples; i++)
+  {
+    mean += samples[i];
+  }
+  mean /= m_num_samples;
+  // a column changes where the line was and where it is now
+  for (int column = 0; column < columns; column++)
+  {
+    int top, bottom;
+    covered(column, top, bottom);
+    mark(column, top, bottom);
+  }
+  m_rows[0] = height / 2 + (samples[0] - mean) / 5;
+  for (int x = 0; x < width; x++)
   {
-    display.drawLine(x, height / 2 + m_samples[i - 4] / 5, x + x_step * 4, height / 2 + m_samples[i] / 5, 0xfff);
-    x += x_step * 4;
+    m_rows[x + 1] = height / 2 + (samples[(x + 1) * (m_num_samples - 1) / width] - mean) / 5;
   }
-}
\ No newline at end of file
+  for (int column = 0; column < columns; column++)
+  {
+    int top, bottom;
+    covered(column, top, bottom);
+    mark(column, top, bottom);
+  }
+}
+
+void Waveform::render(uint16_t *pixels, int left, int top, int span, int lines)
+{
+  memset(pixels, 0, span * lines * sizeof(uint16_t));
+  // a vertical span per column from its sample to the next one
+  for (int x = left; x < left + span; x++)
+  {
+    const int from = std::max(top, (int)std::min(m_rows[x], m_rows[x + 1]));
+    const int to = std::min(top + lines - 1, (int)std::max(m_rows[x], m_rows[x + 1]));
+    for (int row = from; row <= to; row++)
+    {
+      pixels[(row - top) * span + x - left] = 0xfff;
+    }
+  }
+}
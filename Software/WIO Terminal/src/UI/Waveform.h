@@ -2,14 +2,22 @@
 
 #include "Component.h"
 
+// Columns of the waveform redrawn separately
+#define WAVEFORM_COLUMN 8
+
 class Waveform : public Component
 {
 private:
-  int *m_samples;
+  // row of the sample drawn at every pixel column, the first one is where the
+  // line starts
+  int16_t *m_rows;
   int m_num_samples;
 
+  // rows the line covers in a column of the component
+  void covered(int column, int &top, int &bottom);
+
 public:
-  Waveform(Display &display, int x, int y, int width, int height, int num_samples);
-  void update(int *samples);
-  void _draw(Display &display);
+  Waveform(int x, int y, int width, int height, int num_samples);
+  void update(const int16_t *samples);
+  void render(uint16_t *pixels, int left, int top, int span, int lines);
 };
@@ -1,7 +1,41 @@
 #pragma once
 
-// sample rate for the system
+// sample rate for the system, TC3 divides 48MHz by it
 #define SAMPLE_RATE 8000
 
-// approx 60ms of audio @ 8KHz
+// approx 60ms of audio @ 8KHz, 2 x a power of 4 for the FFT
 #define WINDOW_SIZE 512
+
+// samples between two windows, they overlap by the rest: a spectrum every
+// 16ms @ 8KHz
+#define HOP_SIZE 128
+
+// bits of the microphone samples
+#define SAMPLE_BITS 10
+
+// log spaced bands sent per window, 4 bits each
+#define BANDS 64
+// log2 of the band power shown as level 0, every level above is 3dB more,
+// with USE_AGC the lowest the noise floor goes
+#define BAND_FLOOR 24
+
+// automatic gain of the bands, see AudioProcessing/AutoGain.h: the noise
+// floor falls within 2^AGC_FLOOR_FALL hops and rises over 2^AGC_FLOOR_RISE
+// (about 8s), the peak decays over 2^AGC_PEAK_DECAY (about 2s), the bands
+// span at least AGC_RANGE_MIN levels of 3dB
+#define USE_AGC
+#define AGC_FLOOR_FALL 2
+#define AGC_FLOOR_RISE 9
+#define AGC_PEAK_DECAY 7
+#define AGC_RANGE_MIN 8
+
+// an onset is a rise of the bands (flux, in 3dB levels summed over all bands)
+// above ONSET_RATIO / 16 of its running mean plus ONSET_MIN, followed by
+// ONSET_HOLD hops without one
+#define ONSET_RATIO 24
+#define ONSET_MIN 16
+#define ONSET_HOLD 6
+
+// the approximate FFT the fixed point one replaced, for comparison, its
+// magnitudes are scaled differently so BAND_FLOOR needs lowering
+//#define USE_APPROX_FFT
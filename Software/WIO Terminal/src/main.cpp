@@ -6,26 +6,37 @@
 #else
 #include <LovyanGFX.hpp>
 #endif
-#include <LIS3DHTR.h>
 
+#include "Accelerometer.h"
 #include "Display.h"
 
 Application *application;
 
-LIS3DHTR<TwoWire> lis;
+Accelerometer accelerometer;
 #define USE_LGFX
 //#define USE_TFT
 
+#ifdef USE_TFT
+// No DMA on the SAMD51 in TFT_eSPI, the strips are sent as they are rendered
+template <>
+void DisplayWrapper<TFT_eSPI>::pushImageDMA(int32_t x, int32_t y, int32_t width,
+                                            int32_t height, uint16_t *pixels) {
+  display.pushImage(x, y, width, height, pixels);
+}
+template <>
+bool DisplayWrapper<TFT_eSPI>::dmaBusy() {
+  return false;
+}
+#endif
+
 void setup() {
   Serial.begin(115200);
-  lis.begin(Wire1);
+  const bool accelerometer_ok = accelerometer.begin(Wire1);
   // while (!Serial)
   //   ;
   delay(2000);
   Serial.println("Starting");
-  if (!lis) Serial.println("ERROR starting LIS");
-  lis.setOutputDataRate(LIS3DHTR_DATARATE_200HZ);
-  lis.setFullScaleRange(LIS3DHTR_RANGE_2G);
+  if (!accelerometer_ok) Serial.println("ERROR starting LIS");
 
 #ifdef USE_LGFX
   LGFX *lcd = new LGFX();